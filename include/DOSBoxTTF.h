@@ -1,4 +1,4 @@
-unsigned char DOSBoxTTFbi[48868]=
+extern const unsigned char DOSBoxTTFbi[48868]=
 {
 	0x00,0x01,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x04,0x00,
 	0x00,0x46,0x46,0x54,0x4D,0x70,0x79,0x49,0x3B,0x00,0x00,
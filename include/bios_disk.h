@@ -19,6 +19,9 @@
 #ifndef DOSBOX_BIOS_DISK_H
 #define DOSBOX_BIOS_DISK_H
 
+#include <list>
+#include <map>
+#include <vector>
 #include "dos_inc.h"
 #include "logging.h"
 #include "../src/dos/cdrom.h"
@@ -81,7 +84,8 @@ class imageDisk {
 			ID_D88,
 			ID_NFD,
 			ID_EMPTY_DRIVE,
-			ID_INT13
+			ID_INT13,
+			ID_OVERLAY
 		};
 
 		virtual uint8_t Read_Sector(uint32_t head,uint32_t cylinder,uint32_t sector,void * data,unsigned int req_sector_size=0);
@@ -96,6 +100,8 @@ class imageDisk {
 		virtual void Get_Geometry(uint32_t * getHeads, uint32_t *getCyl, uint32_t *getSect, uint32_t *getSectSize);
 		virtual uint8_t GetBiosType(void);
 		virtual uint32_t getSectSize(void);
+		uint64_t getImageLength(void) const { return image_length; }
+		uint64_t getImageBase(void) const { return image_base; }
 		imageDisk(class DOS_Drive *useDrive, unsigned int letter, uint32_t freeMB, int timeout);
 		imageDisk(FILE *imgFile, const char *imgName, uint32_t imgSizeK, bool isHardDisk);
 		imageDisk(FILE* diskimg, const char* diskName, uint32_t cylinders, uint32_t heads, uint32_t sectors, uint32_t sector_size, bool hardDrive);
@@ -119,6 +125,13 @@ class imageDisk {
 		/* this is intended only for when the disk can change out from under us while mounted */
 		virtual bool detectDiskChange(void) { const bool r = diskChangeFlag; diskChangeFlag = false; return r; }
 
+		/* fork server child: reopen the image read only and keep writes in memory from now on */
+		virtual bool Fork_Private(void);
+		/* whether Fork_Private() can be done for this disk, asked by the fork server before forking */
+		virtual bool Can_Fork_Private(void) const;
+		bool private_writes = false;
+		std::map<uint32_t,std::vector<uint8_t> > private_sectors;
+
 	protected:
 		imageDisk(IMAGE_TYPE class_id);
 		uint8_t floppytype = 0;
@@ -396,6 +409,8 @@ public:
     bool MergeSnapshot(uint32_t* totalSectorsMerged, uint32_t* totalBlocksUpdated);
     static void SizeToCHS(uint64_t size, uint16_t* c, uint8_t* h, uint8_t* s);
     bool UpdateUUID();
+    bool FlushBlockMaps();
+    static void FlushTick(void); /* PIC tick handler, in the save state timer table */
     static void mk_uuid(uint8_t* buf);
     virtual ~imageDiskVHD();
 
@@ -428,6 +443,19 @@ private:
         void SetDefaults();
     };
 
+    /* sector bitmap of one allocated block, dirty ones are written back when
+     * evicted from the cache, on flush, when the disk is closed and at the
+     * latest mapFlushTicks after a write first changed one (see FlushTick) */
+    struct BlockMap {
+        uint32_t block = 0;
+        uint32_t sectorOffset = 0;
+        bool dirty = false;
+        std::vector<uint8_t> map;
+    };
+    static const size_t blockMapCacheSize = 256;
+    static const uint32_t readAheadMaxSectors = 64;
+    static const Bitu mapFlushTicks = 1000;
+
 	imageDiskVHD() : imageDisk(ID_VHD) { }
     static ErrorCodes TryOpenParent(const char* childFileName, const ParentLocatorEntry& entry, const uint8_t* data, const uint32_t dataLength, imageDisk** disk, const uint8_t* uniqueId);
 	static ErrorCodes Open(const char* fileName, const bool readOnly, imageDisk** disk, const uint8_t* matchUniqueId);
@@ -435,6 +463,9 @@ private:
 	static bool convert_UTF16_for_fopen(std::string &string, const void* data, const uint32_t dataLength);
     bool is_zeroed_sector(const void* data);
 	bool is_block_allocated(uint32_t blockNumber);
+    BlockMap* getBlockMap(const uint32_t blockNumber, const uint32_t blockSectorOffset, const bool load);
+    bool writeBlockMap(BlockMap& bm);
+    void noteDirtyMap();
 
     imageDisk* parentDisk = NULL;
     imageDisk* fixedDisk = NULL;
@@ -450,6 +481,58 @@ private:
     bool currentBlockAllocated = false;
 	uint32_t currentBlockSectorOffset = 0;
 	uint8_t* currentBlockDirtyMap = nullptr;
+    BlockMap* currentBlockMap = nullptr;
+    std::vector<uint32_t> bat; /* host byte order, 0xFFFFFFFF for unallocated blocks */
+    std::list<BlockMap> blockMaps; /* most recently used first */
+    std::map<uint32_t,std::list<BlockMap>::iterator> blockMapIndex;
+    std::vector<uint8_t> readAhead; /* run of sectors present in this image, read with one fread */
+    uint32_t readAheadStart = 0;
+    uint32_t readAheadCount = 0;
+    Bitu mapsDirtySince = 0; /* PIC_Ticks of the first change since the last periodic flush */
+};
+
+/* Copy-on-write overlay over any other image. Clusters written by the guest are
+ * copied into a sparse delta file (see diskdelta.h), everything else is read
+ * straight from the base image, which is never written to. */
+class imageDiskOverlay : public imageDisk {
+public:
+	uint8_t Read_AbsoluteSector(uint32_t sectnum, void * data) override;
+	uint8_t Write_AbsoluteSector(uint32_t sectnum, const void * data) override;
+
+	void UpdateFloppyType(void) override;
+	void Set_Reserved_Cylinders(Bitu resCyl) override;
+	uint32_t Get_Reserved_Cylinders() override;
+	void Set_Geometry(uint32_t setHeads, uint32_t setCyl, uint32_t setSect, uint32_t setSectSize) override;
+	uint8_t GetBiosType(void) override;
+
+	/* returns NULL (and the reason in error) if the delta file cannot be opened or created */
+	static imageDiskOverlay* Open(imageDisk *base, const char *deltaName, uint32_t clusterSize, std::string &error);
+	/* IMGMOUNT -o delta=file and -o deltacluster=bytes, returns false if no delta file is given */
+	static bool ParseOptions(const std::vector<std::string> &options, std::string &deltaName, uint32_t &clusterSize);
+	bool Flush(void);
+	bool Fork_Private(void) override;
+	bool Can_Fork_Private(void) const override;
+	virtual ~imageDiskOverlay();
+
+	imageDisk* basedisk = NULL;
+
+private:
+	imageDiskOverlay(imageDisk *base);
+	bool isClusterPresent(uint64_t cluster) const {
+		return (bitmap[cluster >> 3u] >> (cluster & 7u)) & 1u;
+	}
+	bool setClusterPresent(uint64_t cluster);
+	uint8_t copyUpCluster(uint64_t cluster, uint32_t sectnum, const void * data);
+
+	FILE* deltaimg = NULL;
+	std::string deltaname;
+	uint32_t cluster_size = 0;
+	uint64_t disk_size = 0;
+	uint64_t bitmap_offset = 0;
+	uint64_t data_offset = 0;
+	uint8_t* bitmap = NULL; /* mapped from the delta file, or a copy written through */
+	size_t bitmap_map_size = 0; /* nonzero if the bitmap is mapped */
+	std::vector<uint8_t> bitmap_copy;
 };
 
 /* C++ class implementing El Torito floppy emulation */
@@ -0,0 +1,138 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_DISKDELTA_H
+#define DOSBOX_DISKDELTA_H
+
+#include <stdint.h>
+#include <string.h>
+
+/* Sparse delta file of a disk image overlay (IMGMOUNT -o delta=file), shared
+ * with the offline src/tool/deltacommit tool. All fields are little endian.
+ *
+ *   0                header, DISKDELTA_HEADER_SIZE bytes
+ *   bitmap_offset    one bit per cluster of the base image, set once the
+ *                    cluster has been copied into the delta
+ *   data_offset      cluster data, byte N of the disk is stored at
+ *                    data_offset + N so clusters never written stay holes
+ *                    in the file
+ *
+ * A cluster is always written completely before its bit is set.
+ *
+ * The header also records where byte 0 of the disk sits in the base image
+ * file (the NHD, HDI and FDI headers come before it) and a checksum of the
+ * first sector, so a delta is not put in front of, or merged into, some other
+ * image of the same size. Only deltas over plain image files can be merged
+ * offline, VHD and qcow2 images store their sectors elsewhere in the file. */
+
+#define DISKDELTA_MAGIC           "DBXDELTA"
+#define DISKDELTA_VERSION         2u
+#define DISKDELTA_HEADER_SIZE     512u
+#define DISKDELTA_DEFAULT_CLUSTER 4096u
+
+#define DISKDELTA_BASE_FILE       0u	/* disk byte N at base_offset + N of the base image file */
+#define DISKDELTA_BASE_OTHER      1u	/* VHD, qcow2 and anything else, not mergeable offline */
+
+struct DiskDeltaHeader {
+	uint32_t version = DISKDELTA_VERSION;
+	uint32_t cluster_size = DISKDELTA_DEFAULT_CLUSTER;
+	uint32_t sector_size = 512;
+	uint64_t disk_size = 0;		/* size of the base image in bytes */
+	uint64_t bitmap_offset = 0;
+	uint64_t data_offset = 0;
+	uint64_t base_offset = 0;	/* offset of disk byte 0 in the base image file */
+	uint32_t base_format = DISKDELTA_BASE_FILE;
+	uint32_t base_check = 0;	/* checksum() of the first sector of the disk */
+
+	uint64_t clusters(void) const {
+		return (disk_size + cluster_size - 1u) / cluster_size;
+	}
+	uint64_t bitmap_bytes(void) const {
+		return (clusters() + 7u) / 8u;
+	}
+
+	/* fill in the offsets for the current disk and cluster size */
+	void layout(void) {
+		const uint64_t align = cluster_size > 4096u ? cluster_size : 4096u;
+
+		bitmap_offset = DISKDELTA_HEADER_SIZE;
+		data_offset = ((bitmap_offset + bitmap_bytes() + align - 1u) / align) * align;
+	}
+
+	/* cluster size must be a power of two and whole sectors */
+	bool valid(void) const {
+		if (sector_size == 0 || cluster_size < sector_size || (cluster_size % sector_size) != 0) return false;
+		if ((cluster_size & (cluster_size - 1u)) != 0) return false;
+		if (disk_size == 0 || bitmap_offset < DISKDELTA_HEADER_SIZE) return false;
+		if (data_offset < bitmap_offset + bitmap_bytes()) return false;
+		if (base_format > DISKDELTA_BASE_OTHER) return false;
+		return true;
+	}
+
+	void encode(unsigned char *buf) const {
+		memset(buf,0,DISKDELTA_HEADER_SIZE);
+		memcpy(buf,DISKDELTA_MAGIC,8);
+		put32(buf+8,version);
+		put32(buf+12,cluster_size);
+		put32(buf+16,sector_size);
+		put64(buf+24,disk_size);
+		put64(buf+32,bitmap_offset);
+		put64(buf+40,data_offset);
+		put64(buf+48,base_offset);
+		put32(buf+56,base_format);
+		put32(buf+60,base_check);
+	}
+
+	bool decode(const unsigned char *buf) {
+		if (memcmp(buf,DISKDELTA_MAGIC,8) != 0) return false;
+		version = get32(buf+8);
+		cluster_size = get32(buf+12);
+		sector_size = get32(buf+16);
+		disk_size = get64(buf+24);
+		bitmap_offset = get64(buf+32);
+		data_offset = get64(buf+40);
+		base_offset = get64(buf+48);
+		base_format = get32(buf+56);
+		base_check = get32(buf+60);
+		return version == DISKDELTA_VERSION;
+	}
+
+	/* FNV-1a */
+	static uint32_t checksum(const unsigned char *p,size_t len) {
+		uint32_t h = 0x811C9DC5u;
+		for (size_t i=0;i < len;i++) h = (h ^ p[i]) * 0x01000193u;
+		return h;
+	}
+
+	static void put32(unsigned char *p,uint32_t v) {
+		for (unsigned int i=0;i < 4;i++) p[i] = (unsigned char)(v >> (i * 8u));
+	}
+	static void put64(unsigned char *p,uint64_t v) {
+		for (unsigned int i=0;i < 8;i++) p[i] = (unsigned char)(v >> (i * 8u));
+	}
+	static uint32_t get32(const unsigned char *p) {
+		uint32_t v = 0;
+		for (unsigned int i=0;i < 4;i++) v |= (uint32_t)p[i] << (i * 8u);
+		return v;
+	}
+	static uint64_t get64(const unsigned char *p) {
+		uint64_t v = 0;
+		for (unsigned int i=0;i < 8;i++) v |= (uint64_t)p[i] << (i * 8u);
+		return v;
+	}
+};
+
+#endif
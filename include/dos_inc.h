@@ -100,10 +100,14 @@ bool MEM_unmap_physmem(Bitu start,Bitu end);
 bool MEM_map_RAM_physmem(Bitu start,Bitu end);
 bool MEM_map_ROM_physmem(Bitu start,Bitu end);
 
+/* A file compiled into the Z: drive. If compressed_length is nonzero, data holds
+ * that many bytes of zlib stream which inflate to length bytes, use
+ * VFILE_BuiltinFileBlobData() rather than reading data directly. */
 struct BuiltinFileBlob {
 	const char		*recommended_file_name;
 	const unsigned char	*data;
 	size_t			length;
+	size_t			compressed_length;
 };
 
 struct DOS_Date {
@@ -268,6 +272,10 @@ bool DOS_ForceDuplicateEntry(uint16_t entry,uint16_t newentry);
 bool DOS_GetFileDate(uint16_t entry, uint16_t* otime, uint16_t* odate);
 bool DOS_SetFileDate(uint16_t entry, uint16_t ntime, uint16_t ndate);
 
+/* Changes every time a file is written, created, renamed or deleted through DOS.
+ * Lets code that caches file contents (batch files) notice guest changes cheaply. */
+extern uint32_t dos_file_generation;
+
 /* Routines for Drive Class */
 bool DOS_OpenFile(char const * name,uint8_t flags,uint16_t * entry,bool fcb = false);
 bool DOS_OpenFileExtended(char const * name, uint16_t flags, uint16_t createAttr, uint16_t action, uint16_t *entry, uint16_t* status);
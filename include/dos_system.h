@@ -378,4 +378,5 @@ void DOS_DelDevice(DOS_Device * dev);
 
 void VFILE_Register(const char * name,uint8_t * data,uint32_t size,const char *dir = "");
 void VFILE_RegisterBuiltinFileBlob(const struct BuiltinFileBlob &b,const char *dir = "");
+const uint8_t *VFILE_BuiltinFileBlobData(const struct BuiltinFileBlob &b);
 #endif
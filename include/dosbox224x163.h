@@ -1,4 +1,4 @@
-unsigned char dosbox224x163_png[] = {
+static const unsigned char dosbox224x163_png[] = {
   0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
   0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xa3,
   0x04, 0x03, 0x00, 0x00, 0x00, 0x61, 0xcf, 0x0f, 0x10, 0x00, 0x00, 0x00,
@@ -750,4 +750,4 @@ unsigned char dosbox224x163_png[] = {
   0xc7, 0x71, 0xf6, 0x9d, 0xa2, 0x18, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00,
   0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
 };
-unsigned int dosbox224x163_png_len = 8996;
+static const unsigned int dosbox224x163_png_len = 8996;
@@ -1,4 +1,4 @@
-unsigned char dosbox224x186_png[] = {
+static const unsigned char dosbox224x186_png[] = {
   0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
   0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xba,
   0x04, 0x03, 0x00, 0x00, 0x00, 0x45, 0x16, 0x5c, 0x43, 0x00, 0x00, 0x00,
@@ -825,4 +825,4 @@ unsigned char dosbox224x186_png[] = {
   0x66, 0x2d, 0x6e, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
   0xae, 0x42, 0x60, 0x82
 };
-unsigned int dosbox224x186_png_len = 9892;
+static const unsigned int dosbox224x186_png_len = 9892;
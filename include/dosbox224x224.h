@@ -1,4 +1,4 @@
-unsigned char dosbox224x224_png[] = {
+static const unsigned char dosbox224x224_png[] = {
   0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
   0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0,
   0x04, 0x03, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x77, 0xd2, 0x00, 0x00, 0x00,
@@ -993,4 +993,4 @@ unsigned char dosbox224x224_png[] = {
   0x3a, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
   0x82
 };
-unsigned int dosbox224x224_png_len = 11905;
+static const unsigned int dosbox224x224_png_len = 11905;
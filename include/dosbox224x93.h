@@ -1,4 +1,4 @@
-unsigned char dosbox224x93_png[] = {
+static const unsigned char dosbox224x93_png[] = {
   0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
   0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x5d,
   0x04, 0x03, 0x00, 0x00, 0x00, 0x4e, 0x57, 0x77, 0x79, 0x00, 0x00, 0x00,
@@ -425,4 +425,4 @@ unsigned char dosbox224x93_png[] = {
   0x07, 0x67, 0xf5, 0x0b, 0x14, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x49,
   0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
 };
-unsigned int dosbox224x93_png_len = 5095;
+static const unsigned int dosbox224x93_png_len = 5095;
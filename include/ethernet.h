@@ -20,6 +20,9 @@
 #define DOSBOX_ETHERNET_H
 
 #include "control.h"
+#include <atomic>
+#include <functional>
+#include <vector>
 
 /** A virtual Ethernet connection
  * While emulated Ethernet adapters provide the ability for the guest OS to
@@ -70,11 +73,73 @@ class EthernetConnection
          * instead of jumping around between functions and sharing global state.
          * This function does not define the state of the packet data outside
          * the callback. Copy the packet data if you need to use it later.
+         * It is called from a timer tick, so it should return right away
+         * when nothing is pending; backends that have to wait on the host
+         * do so on a thread of their own and queue frames for this call.
          * @param callback The function called for each pending packet
          */
         virtual void GetPackets(std::function<void(const uint8_t*, int)> callback) = 0;
 };
 
+/** A single-producer, single-consumer queue of Ethernet frames
+ * Backends that do their I/O on a thread of their own use this to hand
+ * frames between that thread and the emulation thread without locking.
+ * Exactly one thread may call Push and exactly one other thread may call
+ * Empty and Drain. Slots keep their storage, so once a slot has seen a
+ * frame of a given size passing frames through it does not allocate.
+ */
+class EthernetFrameQueue
+{
+    public:
+        /** Creates a queue
+         * @param slots Number of frames the queue can hold, a power of 2
+         */
+        EthernetFrameQueue(unsigned int slots = 256) : frames(slots), mask(slots - 1)
+        {
+            for (auto &f : frames) f.reserve(1518);
+        }
+
+        /** Adds a copy of a frame to the queue
+         * @param packet A pointer to bytes of an Ethernet frame
+         * @param len The size (in bytes) of the Ethernet frame
+         * @return True if queued, false if the queue was full and the frame dropped
+         */
+        bool Push(const uint8_t* packet, int len)
+        {
+            const unsigned int h = head.load(std::memory_order_relaxed);
+            if ((h - tail.load(std::memory_order_acquire)) > mask) return false;
+            frames[h & mask].assign(packet, packet + len);
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** Checks for pending frames, no more than an atomic load */
+        bool Empty() const
+        {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+        }
+
+        /** Passes every pending frame to the callback and removes it
+         * @param callback The function called for each frame
+         */
+        void Drain(const std::function<void(const uint8_t*, int)> &callback)
+        {
+            const unsigned int h = head.load(std::memory_order_acquire);
+            unsigned int t = tail.load(std::memory_order_relaxed);
+            for (;t != h;t++) {
+                const std::vector<uint8_t> &f = frames[t & mask];
+                callback(f.data(), (int)f.size());
+                tail.store(t + 1, std::memory_order_release);
+            }
+        }
+
+    private:
+        std::vector<std::vector<uint8_t>> frames;
+        const unsigned int mask;
+        std::atomic<unsigned int> head = {0}; /*!< Frames pushed, only advanced by the producer */
+        std::atomic<unsigned int> tail = {0}; /*!< Frames drained, only advanced by the consumer */
+};
+
 /** Opens a virtual Ethernet connection to a backend.
  * This function will try to create a new EthernetConnection based on whichever
  * implementation is most appropriate for the backend requested.
@@ -0,0 +1,49 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DOSBOX_FORKSERVER_H
+#define DOSBOX_FORKSERVER_H
+
+#include <string>
+
+/* Fork server (Linux only, -fork-server <socket>).
+ *
+ * The emulator boots normally up to a fork point (the FORKPT command, or the
+ * "forkpoint" mapper event once a guest OS is running). From there it listens on
+ * a unix socket and forks one child per request. Each child continues from the
+ * fork point with copy on write guest memory, keeps its disk image writes to
+ * itself and applies the per child settings from the request. */
+
+bool FORKSERVER_Enabled(void);
+bool FORKSERVER_IsChild(void);
+
+enum FORKSERVER_RESULT {
+    FORKSERVER_CHILD,       /* in a child, command holds the command of the request (may be empty) */
+    FORKSERVER_STOPPED,     /* in the server, told to stop */
+    FORKSERVER_FAILED       /* in the server, could not start serving requests */
+};
+
+/* Serve requests until told to stop. Without a DOS shell to run them in
+ * (with_commands false), requests with a command are refused. */
+FORKSERVER_RESULT FORKSERVER_Run(std::string &command, bool with_commands);
+
+/* Finish a child without running the normal shutdown, the threads the server had
+ * running (audio, printer, serial, ...) do not exist in the child to be joined. */
+void FORKSERVER_ExitChild(int code);
+
+void FORKSERVER_Init(void);
+
+#endif
@@ -47,7 +47,7 @@ bool TS_Get_Address(Bitu& tsaddr, Bitu& tsirq, Bitu& tsdma);
 extern uint8_t adlib_commandreg;
 FILE * OpenCaptureFile(const char * type,const char * ext);
 
-void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data);
+void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data, const float * fdata = NULL);
 #define CAPTURE_FLAG_DBLW	0x1
 #define CAPTURE_FLAG_DBLH	0x2
 #define CAPTURE_FLAG_NOCHANGE   0x4
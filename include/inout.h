@@ -51,6 +51,26 @@ void IO_FreeWriteHandler(Bitu port,Bitu mask,Bitu range=1);
 
 void IO_InvalidateCachedHandler(Bitu port,Bitu range=1);
 
+/* Block I/O handlers, optional, for devices with a data port that the guest typically
+ * drains or fills with REP INS/OUTS (NIC remote DMA, IDE PIO). The CPU core hands the
+ * device up to count elements of iolen bytes each in one call, to or from buf in guest
+ * (little endian) byte order. The handler returns how many elements it transferred and
+ * may stop short, or return 0 to decline, the CPU then continues one element at a time
+ * through the regular handlers. */
+typedef Bitu IO_ReadBlockHandler(Bitu port,uint8_t *buf,Bitu count,Bitu iolen);
+typedef Bitu IO_WriteBlockHandler(Bitu port,const uint8_t *buf,Bitu count,Bitu iolen);
+
+void IO_RegisterBlockHandler(Bitu port,IO_ReadBlockHandler *r_handler,IO_WriteBlockHandler *w_handler,Bitu range=1);
+void IO_FreeBlockHandler(Bitu port,Bitu range=1);
+
+/* REP INS/OUTS fast path for the CPU cores. Moves up to count elements between the port
+ * and guest memory at linear address addr (ascending), as long as the port has a block
+ * handler and the memory is plain RAM, and returns the number of elements moved. The
+ * caller handles the rest, if any, one element at a time. */
+bool IO_HasBlockHandler(Bitu port);
+Bitu IO_ReadBlockToMem(Bitu port,uint32_t addr,Bitu count,Bitu iolen);
+Bitu IO_WriteBlockFromMem(Bitu port,uint32_t addr,Bitu count,Bitu iolen);
+
 void IO_WriteB(Bitu port,uint8_t val);
 void IO_WriteW(Bitu port,uint16_t val);
 void IO_WriteD(Bitu port,uint32_t val);
@@ -148,6 +168,13 @@ public:
 	void Uninstall();
 	~IO_WriteHandleObject();
 };
+class IO_BlockHandleObject: private IO_Base{
+public:
+    IO_BlockHandleObject() : IO_Base() {};
+	void Install(Bitu port,IO_ReadBlockHandler * r_handler,IO_WriteBlockHandler * w_handler,Bitu range=1);
+	void Uninstall();
+	~IO_BlockHandleObject();
+};
 
 static INLINE void IO_Write(Bitu port,uint8_t val) {
 	IO_WriteB(port,val);
@@ -114,6 +114,9 @@ public:
 	bool isInESRList;
    	ECBClass *prevECB;	// Linked List
 	ECBClass *nextECB;
+	ECBClass *prevSockECB;	// Listening ECBs of the same socket
+	ECBClass *nextSockECB;
+	bool isListening;
 	
 	uint8_t iuflag;		// Need to save data since we are not always in
 	uint16_t mysocket;	// real mode
@@ -144,6 +147,9 @@ public:
 
 	void NotifyESR(void);
 
+	void linkListening(void);
+	void unlinkListening(void);
+
 	void setImmAddress(uint8_t *immAddr);
 	void getImmAddress(uint8_t* immAddr);
 
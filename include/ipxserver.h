@@ -43,7 +43,7 @@ struct packetBuffer {
 
 void IPX_StopServer();
 bool IPX_StartServer(uint16_t portnum);
-bool IPX_isConnectedToServer(Bits tableNum, IPaddress ** ptrAddr);
+bool IPX_isConnectedToServer(Bits tableNum, IPaddress * ptrAddr);
 
 uint8_t packetCRC(uint8_t *buffer, uint16_t bufSize);
 
@@ -58,6 +58,7 @@ extern bool jp_ega;
 extern uint8_t jfont_sbcs_19[256 * 19];//SBCS font 256 * 19( * 8)
 extern uint8_t jfont_sbcs_16[256 * 16];//SBCS font 256 * 16( * 8)
 extern uint8_t jfont_dbcs_16[65536 * 32];//DBCS font 65536 * 16 * 2 (* 8)
+extern const uint8_t pc98_freecg_sbcs[256 * 16];//PC-98 FreeCG SBCS font, read-only
 void SVGA_Setup_JEGA(void);//Init JEGA and AX system area
 bool INT10_AX_SetCRTBIOSMode(Bitu mode);
 Bitu INT10_AX_GetCRTBIOSMode(void);
@@ -137,7 +138,7 @@ inline bool isJEGAEnabled() {
 }
 
 #ifdef INCJFONT
-static uint8_t dosv_font19_data[] = 
+static const uint8_t dosv_font19_data[] = 
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x10,0x17,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
@@ -173,7 +174,7 @@ static uint8_t dosv_font19_data[] =
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0xfe,0x60,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-static uint8_t ax_font19_data[] = 
+static const uint8_t ax_font19_data[] = 
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x1e,0x3a,0x7a,0x7a,0x7a,0x3a,0x1a,0x0a,0x0a,0x0a,0x0a,0x0a,0x0a,0x00,0x00,
@@ -209,7 +210,7 @@ static uint8_t ax_font19_data[] =
 	0x00,0x00,0x00,0x48,0x48,0x24,0x24,0x12,0x12,0x09,0x12,0x12,0x24,0x24,0x48,0x48,0x00,0x00,0x00,
 };
 
-static uint8_t dosv_font16_data[] = 
+static const uint8_t dosv_font16_data[] = 
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x10,0x17,0x14,0x14,0x14,0x14,0x14,0x14,
@@ -245,7 +246,7 @@ static uint8_t dosv_font16_data[] =
 	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0xfe,0x60,0x20,0x00,0x00,0x00,0x00,0x00,
 };
 
-static uint8_t dosv_font24_data[] = {
+static const uint8_t dosv_font24_data[] = {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf0,0x1f,0xf0,0x18,0x00,0x18,0x00,0x19,0xf0,0x19,0xf0,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0xff,0x80,0x01,0x80,0x01,0x80,0xf9,0x80,0xf9,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,
@@ -280,7 +281,7 @@ static uint8_t dosv_font24_data[] = {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xff,0xf0,0xff,0xf0,0x60,0x00,0x30,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-static uint8_t double_frame_font_data[] =
+static const uint8_t double_frame_font_data[] =
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,
@@ -290,7 +291,7 @@ static uint8_t double_frame_font_data[] =
 	0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-static uint8_t frame_font_data[] = 
+static const uint8_t frame_font_data[] = 
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
@@ -326,7 +327,7 @@ static uint8_t frame_font_data[] =
 	0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0xff,0xff,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80
 };
 
-static uint8_t frame_font24_data[] = 
+static const uint8_t frame_font24_data[] = 
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,
@@ -362,7 +363,7 @@ static uint8_t frame_font24_data[] =
 	0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0xff,0xff,0xff,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,
 };
 
-uint8_t pc98_freecg_sbcs[]=
+const uint8_t pc98_freecg_sbcs[256 * 16]=
 {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x38,0x40,0x30,0x18,0x08,0x70,
@@ -739,7 +740,7 @@ uint8_t pc98_freecg_sbcs[]=
 	0x00,0x00,0x00,0x00,
 };
 
-uint8_t JPNHN16X[]=
+static const uint8_t JPNHN16X[]=
 {
 	0x46,0x4F,0x4E,0x54,0x58,0x32,0x54,0x4C,0x47,0x4F,0x54,
 	0x48,0x43,0x4E,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -1117,7 +1118,7 @@ uint8_t JPNHN16X[]=
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-uint8_t JPNHN19X[]=
+static const uint8_t JPNHN19X[]=
 {
 	0x46,0x4F,0x4E,0x54,0x58,0x32,0x54,0x4C,0x47,0x4F,0x54,
 	0x48,0x43,0x4E,0x08,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -1565,7 +1566,7 @@ uint8_t JPNHN19X[]=
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-uint8_t JPNZN16X[]=
+static const uint8_t JPNZN16X[]=
 {
 	0x46,0x4F,0x4E,0x54,0x58,0x32,0x54,0x4C,0x47,0x4F,0x54,
 	0x48,0x43,0x20,0x10,0x10,0x01,0x59,0x40,0x81,0x7E,0x81,
@@ -25394,7 +25395,7 @@ uint8_t JPNZN16X[]=
 	0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
-uint8_t JPNHN24X[]=
+static const uint8_t JPNHN24X[]=
 {
 	0x46,0x4F,0x4E,0x54,0x58,0x32,0x57,0x58,0x50,0x20,0x20,
 	0x20,0x20,0x20,0x0C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -26517,7 +26518,7 @@ uint8_t JPNHN24X[]=
 	0xE0,0x7F,0xE0,0x00,0x00,0x00,0x00,
 };
 
-uint8_t SHMZN14X[]=
+static const uint8_t SHMZN14X[]=
 {
 	0x46,0x4F,0x4E,0x54,0x58,0x32,0x53,0x48,0x4E,0x4D,0x2D,
 	0x4D,0x49,0x4E,0x0E,0x0E,0x01,0x58,0x40,0x81,0x7E,0x81,
@@ -61,4 +61,7 @@ struct DB_Midi {
 extern bool roland_gs_sysex;
 extern DB_Midi midi;
 
+/* Opens a software synth that was deferred to its first use */
+void MIDI_OpenPending(void);
+
 #endif
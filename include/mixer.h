@@ -62,6 +62,7 @@ public:
 	void lowpassUpdate();
 	int32_t lowpassStep(int32_t in,const unsigned int iteration,const unsigned int channel);
 	void lowpassProc(int32_t ch[2]);
+	void lowpassProcOut(float ch[2]);
 
 	template<class Type,bool stereo,bool signeddata,bool nativeorder,bool lowpass>
 	void loadCurrentSample(Bitu &len, const Type* &data);
@@ -94,15 +95,26 @@ public:
 
 	void FillUp(void);
 	void Enable(bool _yesno);
+
+	/* Idle sleep. A device that has gone quiescent (voices off, no DMA in flight, output
+	 * settled at zero) calls Sleep() and the mixer skips the channel entirely, handler
+	 * included, until the device calls WakeUp() from its next port write or DMA event.
+	 * WakeUp() returns how long the channel slept in ms so the device can fast-forward
+	 * whatever internal state keeps running while silent. */
+	void Sleep(void);
+	double WakeUp(void);
+	bool IsQuiet(Bitu ms) const { return quiet_ms >= ms; } // output exactly zero for the last 'ms' ms
 	void SaveState( std::ostream& stream );
 	void LoadState( std::istream& stream );
 
 	MIXER_Handler handler;
 	float volmain[2];
 	float scale[2];
-	int32_t volmul[2];
-	int32_t lowpass[LOWPASS_ORDER][2];	// lowpass filter
+	float volmul[2];			// scale * volmain, applied as samples leave the channel
+	int32_t lowpass[LOWPASS_ORDER][2];	// lowpass filter (on load, source rate)
 	int32_t lowpass_alpha;			// "alpha" multiplier for lowpass (16.16 fixed point)
+	float lowpass_out[LOWPASS_ORDER][2];	// lowpass filter (on output, mixer rate)
+	float lowpass_out_alpha;
 	Bitu lowpass_freq;
 	unsigned int lowpass_order;
 	bool lowpass_on_load;			// apply lowpass on sample load (if source rate > mixer rate)
@@ -114,12 +126,15 @@ public:
 	unsigned int freq_n,freq_d,freq_d_orig;
 	bool current_loaded;
 	int32_t current[2],last[2],delta[2],max_change;
-	int32_t msbuffer[2048][2];		// more than enough for 1ms of audio, at mixer sample rate
+	float msbuffer[2048][2];		// more than enough for 1ms of audio, at mixer sample rate. 16-bit full scale, volume applied
 	Bits last_sample_write;
 	Bitu msbuffer_o;
 	Bitu msbuffer_i;
 	const char * name;
 	bool enabled;
+	bool sleeping;
+	double sleep_start;			// PIC_FullIndex() at Sleep()
+	Bitu quiet_ms;				// consecutive whole ms the channel rendered nothing but zero
 	MixerChannel * next;
 };
 
@@ -218,6 +218,10 @@ public:
   BX_NE2K_SMF uint32_t page2_read(uint32_t offset, unsigned int io_len);
   BX_NE2K_SMF uint32_t page3_read(uint32_t offset, unsigned int io_len);
 
+  BX_NE2K_SMF unsigned remote_read_block(uint8_t *buf, unsigned count, unsigned io_len);
+  BX_NE2K_SMF unsigned remote_write_block(const uint8_t *buf, unsigned count, unsigned io_len);
+  BX_NE2K_SMF void remote_dma_done(void);
+
   BX_NE2K_SMF void chipmem_write(uint32_t address, uint32_t value, unsigned io_len);
   BX_NE2K_SMF void asic_write(uint32_t address, uint32_t value, unsigned io_len);
   BX_NE2K_SMF void page0_write(uint32_t address, uint32_t value, unsigned io_len);
@@ -231,7 +235,7 @@ public:
 
   //static void rx_handler(void *arg, const void *buf, unsigned len);
   BX_NE2K_SMF unsigned mcast_index(const void *dst);
-  BX_NE2K_SMF void rx_frame(const void *buf, unsigned io_len);
+  BX_NE2K_SMF bool rx_frame(const void *buf, unsigned io_len, bool raise_irq = true);
 
 
   static uint32_t read_handler(void *this_ptr, uint32_t address, unsigned io_len);
@@ -128,6 +128,10 @@ public:
 
 	uint8_t Write_AbsoluteSector(uint32_t sectnum, const void* data) override;
 
+	/* the image file is also used by qcowImage, which Fork_Private() does not know about */
+	bool Can_Fork_Private(void) const override { return false; }
+	bool Fork_Private(void) override { return false; }
+
 private:
 
 	QCow2Image qcowImage;
@@ -338,6 +338,11 @@ extern std::list<Function_wrapper> vm_event_functions[VM_EVENT_MAX];
 void AddVMEventFunction(enum vm_event event,SectionFunction func,const char *name,bool canchange=false);
 void DispatchVMEvent(enum vm_event event);
 
+/* -time-startup: collects the time spent in each init function and VM event handler,
+ * the list is logged once when the DOS shell is ready or a guest OS is booted */
+void STARTUP_AddTime(const char *name,double ms);
+void STARTUP_Report(void);
+
 /* for use with AddExitFunction and a name of a function.
  * this turns it into function pointer and function name. it turns one param into two. */
 #define AddVMEventFunctionFuncPair(x) &x, #x
@@ -73,6 +73,18 @@ public:
 	BatchFile * prev;
 	CommandLine * cmd;
 	std::string filename;
+protected:
+	/* The batch file is read into memory once and reread only when it
+	 * changed, since DOS allows a running batch file to be modified */
+	bool Refresh(void);
+	std::vector<uint8_t> contents;
+	bool loaded = false;
+	uint32_t loaded_generation = 0;			/* dos_file_generation at load time */
+	bool host_stat = false;					/* drive reports size and mtime */
+	int64_t host_size = 0, host_mtime = 0;
+	uint32_t host_checked = 0;				/* GetTicks() of the last look at the host file */
+	std::map<std::string,uint32_t> labels;	/* upper case label => offset of the next line */
+	bool labels_valid = false;
 };
 
 class AutoexecEditor;
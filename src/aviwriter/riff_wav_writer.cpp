@@ -41,6 +41,7 @@
 
 #include "riff_wav_writer.h"
 #include "rawint.h"
+#include "wave_mmreg.h"
 
 riff_wav_writer *riff_wav_writer_create() {
 	riff_wav_writer *w = (riff_wav_writer*)malloc(sizeof(riff_wav_writer));
@@ -97,8 +98,8 @@ int riff_wav_writer_set_format_ex(riff_wav_writer *w,windows_WAVEFORMATEX *f,siz
 	if (w->fmt != NULL)
 		return 0;
 
-	w->fmt_len = sizeof(windows_WAVEFORMAT);
-	if (__le_u16(&f->cbSize) != 0u) w->fmt_len += (size_t)2u + __le_u16(&f->cbSize);
+	/* cbSize is written even when zero, non-PCM readers expect the full 18 bytes */
+	w->fmt_len = sizeof(windows_WAVEFORMATEX) + __le_u16(&f->cbSize);
 	if (w->fmt_len > len)
 		return 0;
 	if ((w->fmt = malloc(w->fmt_len)) == NULL)
@@ -166,6 +167,18 @@ int riff_wav_writer_begin_header(riff_wav_writer *w) {
 	assert((int)riff_stack_write(w->riff,riff_stack_top(w->riff),w->fmt,w->fmt_len) == (int)w->fmt_len);
 	riff_stack_pop(w->riff);
 
+	/* 'fact' (required for anything but PCM, sample frame count filled in by end_data) */
+	if (__le_u16(&((windows_WAVEFORMAT*)w->fmt)->wFormatTag) != windows_WAVE_FORMAT_PCM) {
+		uint32_t frames = 0;
+
+		assert(riff_stack_begin_new_chunk_here(w->riff,&chunk));
+		assert(riff_stack_set_chunk_data_type(&chunk,riff_fourcc_const('f','a','c','t')));
+		assert(riff_stack_push(w->riff,&chunk)); /* NTS: we can reuse chunk, the stack copies it here */
+		assert((int)riff_stack_write(w->riff,riff_stack_top(w->riff),&frames,4) == 4);
+		w->fact = *riff_stack_top(w->riff);
+		riff_stack_pop(w->riff);
+	}
+
 	/* state change */
 	w->state = RIFF_WRITER_HEADER;
 	return 1;
@@ -256,6 +269,16 @@ int riff_wav_writer_end_data(riff_wav_writer *w) {
 	if (c->fourcc != riff_fourcc_const('d','a','t','a'))
 		return 0;
 
+	/* the 'fact' chunk holds the length in sample frames */
+	if (w->fact.fourcc != 0) {
+		const uint16_t align = __le_u16(&((windows_WAVEFORMAT*)w->fmt)->nBlockAlign);
+		uint32_t frames = 0;
+
+		if (align != 0u) __w_le_u32(&frames,(uint32_t)(c->data_length / align));
+		w->fact.write_offset = 0;
+		riff_stack_write(w->riff,&w->fact,&frames,4);
+	}
+
 	/* state change */
 	riff_stack_pop(w->riff);
 	w->state = RIFF_WRITER_FOOTER;
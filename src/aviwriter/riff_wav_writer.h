@@ -28,6 +28,7 @@ typedef struct riff_wav_writer {
 	int			fd,own_fd;
 	void*			fmt;
 	size_t			fmt_len;
+	riff_chunk		fact;			/* 'fact' chunk of non-PCM formats, fact.fourcc == 0 if none */
 } riff_wav_writer;
 
 enum {
@@ -2,3493 +2,3783 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_chkdsk_exe[] = {
-  0x4d, 0x5a, 0x32, 0x01, 0x52, 0x00, 0x01, 0x00, 0x02, 0x00, 0x36, 0x11,
-  0xff, 0xff, 0x47, 0x1b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x30, 0x0a, 0xb9, 0x5e, 0x51, 0xbe,
-  0xba, 0xa2, 0x89, 0xf7, 0x1e, 0xa9, 0xb5, 0x80, 0x8c, 0xc8, 0x05, 0x05,
-  0x00, 0x8e, 0xd8, 0x05, 0x24, 0x11, 0x8e, 0xc0, 0xfd, 0xf3, 0xa5, 0xfc,
-  0x2e, 0x80, 0x6c, 0x12, 0x10, 0x73, 0xe7, 0x92, 0xaf, 0xad, 0x0e, 0x0e,
-  0x0e, 0x06, 0x1f, 0x07, 0x16, 0xbd, 0x0d, 0x00, 0xbb, 0xcf, 0x80, 0x55,
-  0xcb, 0x55, 0x50, 0x58, 0x21, 0x0d, 0x03, 0x03, 0x08, 0x78, 0xdb, 0xc2,
-  0xef, 0x32, 0xbe, 0x46, 0x7f, 0x4d, 0xb4, 0x01, 0xec, 0xa1, 0x00, 0x38,
-  0xcc, 0x01, 0x00, 0x90, 0xff, 0xba, 0x5c, 0x17, 0x2e, 0x89, 0x16, 0x06,
-  0x02, 0xff, 0xb4, 0x30, 0xcd, 0x21, 0x8b, 0x2e, 0x02, 0x00, 0xff, 0x8b,
-  0x1e, 0x2c, 0x00, 0x8e, 0xda, 0xa3, 0x7b, 0xff, 0x00, 0x8c, 0x06, 0x79,
-  0x00, 0x89, 0x1e, 0x75, 0x6f, 0x03, 0x2e, 0x8d, 0x00, 0xfd, 0xe8, 0x0d,
-  0x01, 0xc4, 0x3e, 0x73, 0xbf, 0x1b, 0xc7, 0x8b, 0xd8, 0xb9, 0xff, 0xff,
-  0x7f, 0xfc, 0xf2, 0xae, 0xe3, 0x3c, 0x43, 0x26, 0xff, 0x38, 0x05, 0x75,
-  0xf6, 0x80, 0xcd, 0x80, 0xf7, 0xed, 0xd9, 0x89, 0x0e, 0x1a, 0xb7, 0xb9,
-  0x39, 0xd3, 0xe3, 0xfd, 0x83, 0xc3, 0x10, 0x83, 0xe3, 0xf0, 0xb6, 0x34,
-  0x77, 0x3c, 0xff, 0xd2, 0x2b, 0xea, 0x8b, 0x3e, 0xfe, 0x1f, 0xfe, 0x81,
-  0xff, 0x00, 0x02, 0x73, 0x07, 0xbf, 0xdb, 0x04, 0x89, 0x0c, 0xbf, 0xb1,
-  0x04, 0xd3, 0xef, 0x47, 0x3b, 0xff, 0xef, 0x73, 0x03, 0xe9, 0x79, 0x01,
-  0x8b, 0xdf, 0xdb, 0x03, 0xda, 0x28, 0x85, 0x77, 0x61, 0x89, 0x00, 0xa1,
-  0x6f, 0x68, 0x2b, 0xd8, 0x8e, 0xf6, 0xc0, 0xb4, 0x4a, 0x57, 0x82, 0xff,
-  0x5f, 0xd3, 0xe7, 0xfa, 0x8e, 0xd2, 0x8b, 0xbf, 0xe7, 0x2f, 0xfb, 0x33,
-  0xf6, 0xc0, 0x2e, 0x8e, 0x06, 0x9a, 0xff, 0xbf, 0x3c, 0x21, 0xb9, 0xea,
-  0x35, 0x2b, 0xff, 0xcf, 0xfc, 0xf3, 0xaa, 0xb4, 0x00, 0xcd, 0x1a, 0x6d,
-  0xad, 0x7f, 0xbf, 0x36, 0x0e, 0x81, 0x00, 0x33, 0xed, 0xff, 0xb8, 0x5a,
-  0x17, 0x8e, 0xd8, 0xbe, 0x00, 0x00, 0xdb, 0xbf, 0x12, 0xa1, 0xdb, 0xb6,
-  0x00, 0x2b, 0x1e, 0x5f, 0x2e, 0xc6, 0x06, 0xb7, 0xdd, 0x01, 0x72, 0x05,
-  0xa6, 0xfb, 0x01, 0x00, 0xff, 0x36, 0x71, 0x03, 0xa6, 0x6f, 0x9a, 0x6d,
-  0x6b, 0x6f, 0x69, 0x00, 0x9a, 0x07, 0xfe, 0x00, 0xb7, 0x03, 0x50, 0x9a,
-  0xde, 0x0c, 0xdd, 0x35, 0xb8, 0x5b, 0xf2, 0x3d, 0x02, 0xcb, 0x02, 0x9d,
-  0x27, 0xff, 0xed, 0x1e, 0x2e, 0x1e, 0x03, 0x9b, 0x32, 0x36, 0x1e, 0xb1,
-  0x50, 0x11, 0xed, 0x0e, 0xe8, 0x55, 0xf6, 0xfd, 0xec, 0xb4, 0x4c, 0x8a,
-  0x46, 0x04, 0xbf, 0x9c, 0xb9, 0x0e, 0x00, 0xba, 0x2d, 0xff, 0x00, 0xe9,
-  0xc1, 0x00, 0x1e, 0xb8, 0x00, 0x35, 0x6b, 0x0e, 0xbb, 0x61, 0x59, 0x25,
-  0xad, 0x5b, 0x48, 0xb1, 0x04, 0x0c, 0x9a, 0x5d, 0x5f, 0x59, 0x05, 0x19,
-  0x61, 0xa5, 0x63, 0x91, 0x06, 0x9a, 0x65, 0x67, 0x5f, 0x00, 0x25, 0x8c,
-  0xca, 0x0b, 0x5a, 0xba, 0xdb, 0x2c, 0x01, 0x13, 0x1f, 0xbb, 0xc3, 0x42,
-  0x25, 0xc5, 0xb5, 0x16, 0x40, 0xcd, 0x0b, 0x0a, 0x9a, 0x04, 0x5d, 0x4e,
-  0x05, 0x69, 0x61, 0x39, 0x06, 0xa7, 0x65, 0xff, 0xcb, 0xb4, 0xff, 0x8b,
-  0xd7, 0x8b, 0xde, 0x3b, 0xff, 0xdf, 0x74, 0x14, 0x80, 0x3f, 0xff, 0x74,
-  0x0a, 0xfd, 0x38, 0x67, 0x01, 0x77, 0x05, 0x8a, 0xb8, 0x04, 0x8b, 0xd3,
-  0x5f, 0x71, 0x06, 0xeb, 0xe8, 0x3b, 0xff, 0xd7, 0x74, 0x20, 0x8b, 0xda,
-  0x1e, 0x07, 0x06, 0x6f, 0x1c, 0x00, 0xc6, 0x07, 0xb1, 0xff, 0xb7, 0xff,
-  0x74, 0x07, 0x26, 0xff, 0x5f, 0x02, 0x1f, 0xeb, 0xb6, 0xc5, 0x06, 0x57,
-  0x6f, 0xbe, 0xc3, 0xb4, 0x40, 0xdd, 0xbb, 0x02, 0x4b, 0xc3, 0xdb, 0xb9,
-  0x1e, 0xc3, 0x3b, 0x67, 0xed, 0xe8, 0xfd, 0xea, 0xff, 0xb8, 0x03, 0x00,
-  0x50, 0xb0, 0xe2, 0x14, 0xbe, 0xa5, 0x00, 0x04, 0xc0, 0x55, 0xd8, 0xe7,
-  0x56, 0x5f, 0x71, 0x50, 0xff, 0x76, 0x08, 0x6f, 0x02, 0x06, 0x9a, 0xce,
-  0x85, 0x22, 0x57, 0xff, 0x83, 0xc4, 0x06, 0x8b, 0xf0, 0x83, 0xfe, 0xff,
-  0xff, 0x75, 0x02, 0xeb, 0x1a, 0xf7, 0x46, 0x0a, 0x02, 0xf9, 0x00, 0x74,
-  0x06, 0xf7, 0xc6, 0x76, 0x75, 0x04, 0x26, 0xff, 0xeb, 0x09, 0xc7, 0x06,
-  0x7d, 0x00, 0x05, 0x6f, 0xd4, 0xff, 0xff, 0x5e, 0xdc, 0x5d, 0xcb, 0x3a,
-  0xdb, 0x33, 0x12, 0x02, 0x65, 0x10, 0x96, 0x0e, 0x0c, 0x5b, 0x0a, 0x45,
-  0x36, 0xc3, 0xc2, 0x64, 0x47, 0xf7, 0x9a, 0x75, 0x12, 0x4a, 0xf6, 0x12,
-  0x9a, 0xf0, 0x3a, 0xd8, 0x00, 0x2b, 0xff, 0x83, 0x3e, 0x54, 0x1b, 0x20,
-  0x75, 0x05, 0xb7, 0xb8, 0x0f, 0xeb, 0x1c, 0x1a, 0x6f, 0xdd, 0x0b, 0xd1,
-  0xe3, 0xbf, 0x01, 0x8b, 0x46, 0x08, 0x8b, 0x56, 0xff, 0x06, 0x89, 0x97,
-  0x22, 0x35, 0x89, 0x87, 0x24, 0xed, 0x35, 0xff, 0x06, 0x15, 0x6b, 0x64,
-  0x2c, 0x1d, 0x56, 0x8b, 0xbe, 0x47, 0x0b, 0xf6, 0x7c, 0x05, 0xde, 0x87,
-  0x14, 0x7c, 0x09, 0x15, 0x13, 0xbf, 0xaf, 0xe8, 0xb7, 0x22, 0xeb, 0x11,
-  0x0a, 0x0d, 0xdf, 0x32, 0xc7, 0x87, 0xcc, 0x1f, 0x6f, 0x7e, 0x56, 0x9a,
-  0xeb, 0x75, 0xaa, 0x59, 0x9f, 0x85, 0x4c, 0x4c, 0x56, 0xb7, 0x57, 0x37,
-  0xba, 0x3c, 0x6d, 0x25, 0x52, 0x9f, 0x81, 0xe8, 0x80, 0x35, 0xec, 0xa3,
-  0xbc, 0x35, 0x12, 0x2e, 0x5e, 0xdb, 0x62, 0x46, 0x69, 0x76, 0x56, 0x08,
-  0x28, 0x17, 0x57, 0x2c, 0xbe, 0x90, 0xc9, 0x35, 0x7b, 0xf8, 0x88, 0x15,
-  0x26, 0x1f, 0x6e, 0xfe, 0xd1, 0xe0, 0xdf, 0x01, 0xa3, 0xc6, 0x35, 0x83,
-  0xb6, 0x06, 0x03, 0x46, 0xdf, 0xba, 0xfe, 0xba, 0xb5, 0x05, 0x8d, 0xf7,
-  0xf0, 0xb0, 0xf0, 0x28, 0xbb, 0x05, 0x3e, 0x07, 0xbf, 0x38, 0xdc, 0x22,
-  0xf7, 0x27, 0x17, 0x6a, 0x75, 0x03, 0xe9, 0x83, 0xc7, 0x18, 0x44, 0x76,
-  0x99, 0x3b, 0x13, 0xfd, 0x7c, 0x07, 0x7f, 0x1e, 0x3b, 0xbb, 0x1d, 0x77,
-  0x19, 0x0e, 0x7f, 0xbb, 0x18, 0x00, 0x99, 0xf7, 0xfb, 0xee, 0x03, 0xf0,
-  0xff, 0x23, 0x75, 0x1c, 0x29, 0xb6, 0x15, 0x19, 0x1f, 0xfc, 0xeb, 0xca,
-  0x83, 0x7e, 0x0a, 0x2c, 0x6f, 0x47, 0x2e, 0x2a, 0x9a, 0x20, 0xdb, 0x06,
-  0x40, 0x97, 0xa4, 0x18, 0xbe, 0xac, 0x34, 0x50, 0xc2, 0x10, 0xe7, 0x8c,
-  0x0b, 0xb9, 0x36, 0x6f, 0x40, 0xe8, 0x34, 0x2a, 0xe9, 0x0b, 0xc0, 0x74,
-  0x86, 0x5b, 0x44, 0x01, 0xb6, 0x83, 0x45, 0x00, 0x17, 0xa4, 0xcc, 0x35,
-  0x0d, 0x65, 0x06, 0x78, 0x07, 0x56, 0x24, 0x34, 0x17, 0x66, 0xf6, 0x34,
-  0xa3, 0xc0, 0x35, 0x12, 0x17, 0x44, 0xb3, 0x34, 0xb1, 0xb7, 0x8b, 0x05,
-  0xa3, 0xca, 0x9b, 0x35, 0x05, 0x04, 0xb7, 0x00, 0x98, 0x8b, 0xc6, 0xdb,
-  0xbb, 0x07, 0x3b, 0xd2, 0xd2, 0xf7, 0xf3, 0x79, 0xec, 0xc8, 0x35, 0x59,
-  0x36, 0xd1, 0x0d, 0x32, 0xad, 0xa6, 0x0b, 0xf6, 0x7c, 0x12, 0x7f, 0x06,
-  0x07, 0xe1, 0x06, 0x3c, 0xf6, 0x77, 0x83, 0x6e, 0x1d, 0x4a, 0x5e, 0x35,
-  0x2f, 0xfb, 0x17, 0x75, 0x14, 0x15, 0xf6, 0x75, 0x0e, 0x85, 0xca, 0xc4,
-  0xee, 0x8b, 0xc2, 0x35, 0x1d, 0x5b, 0x38, 0x0d, 0xe1, 0x00, 0xf9, 0x65,
-  0x14, 0x6f, 0x07, 0x8a, 0x87, 0x56, 0xd8, 0x1b, 0x98, 0xf2, 0x37, 0xff,
-  0x17, 0x32, 0x13, 0xc3, 0x23, 0xf3, 0xdd, 0x75, 0x05, 0x6f, 0x72, 0xd6,
-  0x8e, 0x6f, 0x3b, 0x8c, 0xda, 0xb8, 0x0b, 0xc9, 0x5f, 0xe1, 0x5e, 0x8b,
-  0xe5, 0xe9, 0x17, 0xef, 0x71, 0xc4, 0x5e, 0x06, 0xbb, 0xdd, 0x77, 0x02,
-  0x03, 0x63, 0x37, 0xc2, 0x71, 0x02, 0xfe, 0xc3, 0xac, 0x5c, 0x3f, 0xec,
-  0x04, 0x9a, 0x1a, 0xb5, 0x2c, 0x60, 0xf9, 0x1d, 0x8b, 0x47, 0x7f, 0x8b,
-  0x17, 0x2b, 0x16, 0x96, 0x20, 0xf6, 0x1b, 0x06, 0x98, 0x20, 0xd8, 0xc3,
-  0xfc, 0xb9, 0x0e, 0x75, 0x1d, 0xe3, 0xfe, 0x2d, 0xfc, 0xb8, 0x35, 0xcc,
-  0xfd, 0xf6, 0xe2, 0x50, 0x6c, 0x2f, 0xfe, 0x0a, 0x05, 0x6c, 0x07, 0x50,
-  0xe7, 0x51, 0x58, 0xba, 0x03, 0x04, 0x67, 0x16, 0x63, 0x5f, 0x08, 0xa2,
-  0xfd, 0xff, 0xb7, 0xb4, 0x1b, 0xbe, 0x03, 0xb2, 0x1b, 0x8b, 0x5e, 0xf9,
-  0x12, 0x0c, 0x39, 0x7c, 0xb1, 0x7a, 0x1b, 0xbc, 0xe8, 0xfb, 0x1c, 0x50,
-  0x6e, 0xed, 0xa2, 0x35, 0x5c, 0x13, 0x1a, 0xf7, 0x1a, 0xad, 0x35, 0x0d,
-  0x88, 0x58, 0x4d, 0x5b, 0xbf, 0x6c, 0x62, 0xff, 0x59, 0x59, 0x52, 0xb6,
-  0x50, 0x07, 0x92, 0x66, 0xa9, 0x0c, 0x0a, 0x6f, 0xad, 0x8b, 0x7e, 0x04,
-  0x1d, 0xe0, 0x83, 0xf0, 0xff, 0x46, 0x7c, 0x06, 0x2f, 0x2c, 0x8a, 0x00,
-  0x7e, 0xc6, 0x09, 0xba, 0xd2, 0xa6, 0x54, 0xa6, 0xe9, 0xdd, 0xf1, 0x46,
-  0x0e, 0xbb, 0x3c, 0xfd, 0x1a, 0x01, 0x46, 0x0c, 0xce, 0x0b, 0x08, 0xe5,
-  0x89, 0x56, 0x0e, 0xb1, 0x0c, 0x11, 0xbd, 0x0a, 0x08, 0xee, 0x11, 0x1a,
-  0x8f, 0x0a, 0x41, 0x7d, 0x14, 0x08, 0xcc, 0x0b, 0x14, 0x78, 0x0a, 0xf7,
-  0xc7, 0x6a, 0x9b, 0x1b, 0x5e, 0x32, 0x01, 0x75, 0x16, 0x1b, 0x88, 0x1c,
-  0x7e, 0xc2, 0x1a, 0x46, 0x99, 0xfe, 0x08, 0x1d, 0xeb, 0x13, 0x8a, 0x84,
-  0x1a, 0x5b, 0x29, 0xdb, 0x28, 0x46, 0x08, 0x19, 0x3b, 0x70, 0x7e, 0xed,
-  0xd1, 0xdd, 0x0c, 0x8d, 0x80, 0xf8, 0xae, 0x09, 0x06, 0xf1, 0x8b, 0xf2,
-  0x83, 0xef, 0xba, 0xd1, 0xc7, 0x40, 0xdb, 0x2e, 0x04, 0x15, 0xc3, 0x30,
-  0x37, 0x0c, 0x05, 0x46, 0xdd, 0x00, 0xa9, 0x4f, 0x08, 0x2f, 0x02, 0x7d,
-  0x03, 0xdd, 0xff, 0x4e, 0x11, 0x99, 0x1a, 0x32, 0x37, 0x10, 0xb8, 0x6d,
-  0xfe, 0x01, 0x59, 0x5b, 0xe8, 0x7f, 0x33, 0x50, 0x9b, 0x00, 0x52, 0x99,
-  0xff, 0x5b, 0x59, 0x03, 0xc8, 0x13, 0xda, 0x51, 0x53, 0x4f, 0x99, 0x8b,
-  0xec, 0x87, 0x62, 0x1b, 0x10, 0x14, 0xd7, 0xd7, 0x99, 0x07, 0xff, 0x89,
-  0x4e, 0xfa, 0x89, 0x5e, 0xfc, 0x8b, 0xb7, 0x4e, 0x02, 0x5e, 0xfa, 0x85,
-  0xba, 0x82, 0xfb, 0xb8, 0x80, 0x51, 0xe8, 0x45, 0x39, 0xf6, 0x0a, 0x52,
-  0x4b, 0x79, 0x10, 0x0e, 0xb6, 0x33, 0x33, 0x34, 0x6f, 0xdc, 0x6b, 0x49,
-  0x17, 0x1c, 0x3c, 0x00, 0xd2, 0x1b, 0x4d, 0x0e, 0x8e, 0x4c, 0x03, 0x0e,
-  0x17, 0xd1, 0x13, 0x1e, 0x2b, 0x54, 0x65, 0xf6, 0xa4, 0xf8, 0x23, 0xeb,
-  0x1b, 0x75, 0x36, 0xc4, 0xfe, 0x40, 0x50, 0x57, 0xe8, 0x2e, 0x27, 0x9b,
-  0x05, 0x09, 0x81, 0xdb, 0x6e, 0xf6, 0x56, 0x83, 0x6c, 0x20, 0x00, 0x6c,
-  0xa4, 0xf8, 0xb3, 0x10, 0xee, 0xf6, 0x00, 0x22, 0xb7, 0x56, 0xea, 0x46,
-  0xf6, 0x4a, 0x14, 0x13, 0x69, 0x18, 0x51, 0xc6, 0xc3, 0x38, 0x63, 0x03,
-  0xc2, 0xfb, 0x58, 0xee, 0x0e, 0x06, 0x48, 0x50, 0xeb, 0x09, 0x08, 0x03,
-  0xb8, 0x0a, 0xe8, 0x4c, 0xe8, 0x62, 0x0c, 0x51, 0x0f, 0xb6, 0x43, 0x56,
-  0x08, 0xc0, 0x7e, 0xce, 0x14, 0x4d, 0x81, 0xfc, 0x8c, 0x7b, 0x1c, 0x16,
-  0x8d, 0x12, 0x43, 0xd5, 0x65, 0x84, 0xfd, 0x09, 0xe9, 0x8e, 0xa5, 0x5b,
-  0xf4, 0xb9, 0x07, 0x92, 0x6d, 0x46, 0x32, 0x69, 0x96, 0xfe, 0xfc, 0xe0,
-  0x5f, 0x9c, 0xee, 0x20, 0xad, 0x2c, 0xba, 0xe0, 0x42, 0x8c, 0x58, 0xbf,
-  0x5d, 0x03, 0xe9, 0xd9, 0xd8, 0x70, 0x0c, 0x26, 0x16, 0xb5, 0x25, 0x97,
-  0xb0, 0x47, 0x26, 0xdf, 0x8a, 0x07, 0x7d, 0x88, 0x02, 0xbf, 0x8d, 0xec,
-  0xe3, 0xe9, 0xb4, 0x04, 0x4b, 0x7b, 0x1a, 0x1d, 0x50, 0x5a, 0xa3, 0xe0,
-  0x50, 0x73, 0x5d, 0x2b, 0xb4, 0x59, 0x2b, 0x13, 0x2d, 0xdb, 0x26, 0x98,
-  0x6f, 0x40, 0xfa, 0xb9, 0x16, 0xff, 0x00, 0xbb, 0x85, 0x0c, 0x2e, 0x8b,
-  0x07, 0x3b, 0x68, 0x0b, 0x17, 0xea, 0x43, 0x43, 0xff, 0xe2, 0xf4, 0xe9,
-  0x3a, 0x04, 0x2e, 0xff, 0x67, 0xb6, 0x2c, 0x22, 0x10, 0x30, 0x9b, 0xf2,
-  0x8b, 0x87, 0xe5, 0x8b, 0x97, 0x19, 0xf6, 0xf6, 0xe9, 0x1a, 0x04, 0x1b,
-  0x13, 0x98, 0x37, 0x96, 0x1b, 0xeb, 0xb3, 0xe2, 0x14, 0x93, 0x08, 0x9a,
-  0xb4, 0xb2, 0x59, 0xcd, 0x09, 0x9a, 0xe4, 0xe2, 0x58, 0xb8, 0x13, 0xe1,
-  0x6e, 0xe9, 0xd2, 0xfc, 0x50, 0x9f, 0x06, 0xe9, 0xc6, 0x03, 0xad, 0xb8,
-  0xa4, 0x6b, 0xa6, 0x2e, 0xe1, 0x83, 0x5d, 0x70, 0x0a, 0x7d, 0x23, 0xd2,
-  0x02, 0x4b, 0x9a, 0x8d, 0xfb, 0x56, 0xe0, 0x03, 0xc2, 0x50, 0x16, 0xd3,
-  0x3e, 0x6c, 0xe9, 0x78, 0x25, 0x0e, 0x04, 0x40, 0xbf, 0x04, 0xe9, 0x52,
-  0x03, 0x60, 0x20, 0xfc, 0x0c, 0x75, 0x05, 0xbe, 0x0c, 0xb6, 0x0f, 0x84,
-  0x38, 0x47, 0x04, 0xf1, 0x9d, 0xec, 0x96, 0x43, 0x46, 0x81, 0xb2, 0x3e,
-  0x3f, 0x56, 0xe9, 0x19, 0x03, 0x67, 0x29, 0x0e, 0x81, 0x40, 0x80, 0x59,
-  0x24, 0x4d, 0x50, 0xb2, 0x0c, 0x64, 0x4f, 0x5a, 0x03, 0xd0, 0x0c, 0x51,
-  0xdb, 0x04, 0x52, 0x34, 0x72, 0xe4, 0x02, 0x73, 0x08, 0xb0, 0x59, 0x8c,
-  0x5a, 0x19, 0xc0, 0xb8, 0x64, 0x02, 0x0b, 0xf6, 0x02, 0xe9, 0x99, 0x02,
-  0xa9, 0x12, 0x0f, 0x19, 0x42, 0x26, 0x85, 0x36, 0xcb, 0x14, 0x1c, 0x12,
-  0xf6, 0x1c, 0xe9, 0x80, 0xfe, 0x43, 0x5d, 0x3f, 0x81, 0x42, 0x3d, 0x37,
-  0xe9, 0x57, 0x83, 0x41, 0x0c, 0xb9, 0x50, 0x04, 0x2c, 0xf4, 0x07, 0xfd,
-  0x58, 0x2b, 0xc2, 0xa0, 0x99, 0xd4, 0xf7, 0xb1, 0x6f, 0x83, 0x2b, 0xd2,
-  0xdf, 0x07, 0x03, 0xc6, 0x66, 0x1a, 0xc8, 0xb1, 0x19, 0x0d, 0x31, 0xec,
-  0x37, 0x9e, 0xfd, 0x0c, 0xe9, 0xfa, 0x01, 0x81, 0x5c, 0x0d, 0x48, 0x95,
-  0x5d, 0x37, 0xaf, 0x4a, 0xac, 0xfa, 0x8c, 0x61, 0xa4, 0x23, 0xb6, 0x64,
-  0x1d, 0x3c, 0xe1, 0x2a, 0x8b, 0x31, 0xc0, 0x90, 0x3f, 0xb0, 0x1f, 0x96,
-  0x31, 0xc9, 0x1f, 0x0b, 0x7e, 0x16, 0x55, 0x73, 0x86, 0x0d, 0x6c, 0x18,
-  0x4d, 0x4f, 0x9a, 0x65, 0x26, 0x60, 0x37, 0xc8, 0x21, 0x04, 0xf1, 0xe9,
-  0xee, 0x00, 0x80, 0x7d, 0x0b, 0x55, 0x2e, 0x24, 0xc0, 0x8d, 0xac, 0x76,
-  0x13, 0x09, 0x7e, 0x32, 0x5b, 0x63, 0x2b, 0x56, 0x59, 0x4c, 0xc9, 0x02,
-  0x72, 0x27, 0x10, 0x36, 0x3f, 0x4b, 0x00, 0xf4, 0x37, 0xeb, 0x3d, 0x9f,
-  0x05, 0x0a, 0xbb, 0x64, 0x24, 0x58, 0x94, 0x4e, 0x21, 0xf8, 0x20, 0xc1,
-  0xc8, 0x61, 0x89, 0xe9, 0xeb, 0x1e, 0xd1, 0x39, 0x10, 0x3c, 0x90, 0x20,
-  0xbf, 0x8e, 0x20, 0xe9, 0xe5, 0xfb, 0xa5, 0xc7, 0xc6, 0xf8, 0x2a, 0x1d,
-  0x8c, 0x5e, 0xfe, 0x93, 0x0f, 0x60, 0x93, 0xad, 0xb4, 0xfe, 0x0a, 0x2b,
-  0xd7, 0x3b, 0xc2, 0x73, 0x0f, 0xc2, 0x15, 0x70, 0xeb, 0x05, 0x36, 0xab,
-  0x2b, 0xc7, 0x36, 0x1d, 0x56, 0xcd, 0x16, 0x18, 0x26, 0x39, 0xa5, 0x2b,
-  0xf0, 0x0a, 0x03, 0x6b, 0x69, 0x0c, 0x57, 0xa1, 0x2c, 0xde, 0x98, 0x3b,
-  0xb6, 0xbd, 0x73, 0xb1, 0xaf, 0x47, 0x93, 0x54, 0x74, 0xba, 0xf0, 0x16,
-  0xfb, 0xf1, 0xdc, 0xb6, 0x6c, 0x00, 0x12, 0x1a, 0x3e, 0x42, 0x03, 0x0d,
-  0x47, 0x89, 0x48, 0xcf, 0x3f, 0x25, 0x00, 0x41, 0x00, 0xff, 0x42, 0x00,
-  0x48, 0x00, 0x49, 0x00, 0x4d, 0x00, 0xd4, 0x53, 0x00, 0xbd, 0x71, 0x57,
-  0x00, 0x58, 0xbd, 0x72, 0x00, 0x5a, 0x00, 0x4b, 0x45, 0x62, 0x95, 0x00,
-  0xba, 0xfa, 0x6a, 0x00, 0x97, 0xc1, 0x70, 0x00, 0x56, 0x56, 0xea, 0x78,
-  0x00, 0xdf, 0x2a, 0xfd, 0x0b, 0xeb, 0x07, 0xe0, 0x15, 0x08, 0x65, 0x50,
-  0xc5, 0xbf, 0x5f, 0x09, 0x62, 0x09, 0x86, 0x09, 0xb7, 0xe3, 0x01, 0x0a,
-  0xc9, 0xf6, 0x0b, 0xe7, 0x0b, 0xcf, 0x5c, 0xfd, 0x08, 0x2a, 0x08, 0x3f,
-  0x08, 0xbf, 0xed, 0xf9, 0x08, 0x44, 0x09, 0xd0, 0xf8, 0x09, 0x2e, 0x0a,
-  0xa0, 0x0b, 0x1f, 0x76, 0xeb, 0x0c, 0x46, 0x62, 0x1e, 0xff, 0x9f, 0x8d,
-  0x5c, 0xb7, 0xa1, 0x0a, 0xff, 0x0e, 0x68, 0x03, 0x37, 0x1d, 0x75, 0xe9,
-  0x17, 0xf0, 0xe2, 0xfa, 0xf3, 0x4c, 0x8a, 0x4c, 0x87, 0x05, 0x76, 0x5d,
-  0x0a, 0x2b, 0xb4, 0x36, 0x60, 0x1b, 0x41, 0x05, 0x6f, 0xa0, 0xb1, 0x06,
-  0xd3, 0xb7, 0xe8, 0x0e, 0x3b, 0x36, 0xd1, 0x3a, 0x1e, 0xae, 0xbd, 0x1a,
-  0x0b, 0x13, 0x04, 0x16, 0xfc, 0xf5, 0x87, 0x00, 0xa3, 0x68, 0xac, 0x7b,
-  0x76, 0x48, 0x1d, 0xaa, 0xe6, 0xdb, 0xde, 0x8d, 0x2a, 0xa0, 0x03, 0x17,
-  0x25, 0x3b, 0xc7, 0x07, 0x53, 0x6e, 0xc7, 0x2b, 0x09, 0x0e, 0x1d, 0xee,
-  0x41, 0x9a, 0x9b, 0x2a, 0x11, 0x48, 0x06, 0x99, 0x83, 0x5e, 0x76, 0x75,
-  0x0b, 0x24, 0xbe, 0x4c, 0xa3, 0xdd, 0x49, 0xeb, 0xb6, 0x5d, 0xe9, 0x03,
-  0xda, 0xc7, 0xc7, 0x4d, 0xd6, 0x1d, 0x4a, 0xd0, 0x8d, 0xcd, 0x8e, 0xfd,
-  0xc4, 0x5d, 0xc2, 0xae, 0x66, 0x7f, 0xe0, 0x8b, 0x0e, 0x85, 0x17, 0x79,
-  0x83, 0x00, 0x53, 0x02, 0x37, 0x6d, 0x04, 0xe8, 0xf6, 0x42, 0x2c, 0x72,
-  0x20, 0x12, 0xcd, 0x8d, 0x8b, 0x21, 0xfb, 0x2f, 0x2c, 0x77, 0x0d, 0xb1,
-  0x9a, 0x02, 0xdd, 0x0a, 0x4e, 0xff, 0xc1, 0xbe, 0xff, 0x73, 0xff, 0xff,
-  0x83, 0xba, 0x05, 0xb0, 0x80, 0x16, 0x0b, 0x48, 0x87, 0x6c, 0x2d, 0x4e,
-  0xb2, 0x5e, 0xe0, 0x6b, 0x2b, 0x4d, 0xa1, 0x92, 0x57, 0xdf, 0x0d, 0xe8,
-  0xed, 0x2b, 0x72, 0xb2, 0x13, 0x54, 0xef, 0xfe, 0x12, 0xda, 0xda, 0x2b,
-  0xb9, 0x24, 0x05, 0xd4, 0xb6, 0x43, 0xa1, 0x3f, 0xdc, 0x8b, 0xe2, 0xd8,
-  0x34, 0xf8, 0x38, 0x5f, 0x27, 0xe3, 0xe8, 0xdc, 0xe4, 0xfe, 0x69, 0xa5,
-  0xfc, 0xb6, 0xdc, 0x2e, 0xfa, 0x58, 0xf8, 0x90, 0x27, 0x76, 0x56, 0xbe,
-  0x2e, 0xa1, 0x2c, 0x3a, 0x12, 0x18, 0x9d, 0x36, 0xdc, 0x94, 0x00, 0x70,
-  0x70, 0x00, 0x58, 0xd6, 0x33, 0xee, 0xc7, 0x00, 0x7d, 0x13, 0x30, 0x1c,
-  0x70, 0xde, 0x0e, 0xed, 0x06, 0x42, 0x96, 0x74, 0x71, 0x87, 0x8e, 0x95,
-  0xf7, 0xb8, 0xed, 0x74, 0x0f, 0x9c, 0x4d, 0x4f, 0x55, 0x9a, 0xde, 0x7e,
-  0x35, 0x1f, 0xfd, 0x19, 0x80, 0x7f, 0xb8, 0x18, 0x7c, 0x0e, 0x34, 0xdc,
-  0x0b, 0x44, 0x98, 0x1b, 0xb4, 0x9e, 0xb8, 0x02, 0x16, 0x2b, 0x4a, 0x17,
-  0xf7, 0xc7, 0x47, 0x0b, 0x3a, 0x05, 0x06, 0x7b, 0x07, 0x04, 0xad, 0xc6,
-  0x21, 0xba, 0xff, 0x6a, 0x10, 0x5b, 0x1f, 0xfb, 0x45, 0xa2, 0x1e, 0xd7,
-  0x22, 0x48, 0x7d, 0x10, 0xe8, 0xbd, 0x0f, 0x52, 0xbb, 0x36, 0xe5, 0x2e,
-  0x4d, 0x37, 0x35, 0xb4, 0x1f, 0x35, 0x9b, 0x5e, 0x58, 0x3f, 0x32, 0x46,
-  0x8b, 0x84, 0x6d, 0x75, 0x6e, 0xcb, 0xae, 0x0f, 0xe9, 0xd8, 0xb7, 0x00,
-  0xbb, 0x0d, 0x06, 0x0f, 0x69, 0xa7, 0x7b, 0x11, 0xb7, 0xf7, 0x7c, 0x4e,
-  0xa1, 0xa3, 0xb6, 0xa0, 0x15, 0x70, 0x10, 0xda, 0x77, 0x83, 0xc2, 0x39,
-  0x7f, 0xbe, 0x39, 0x35, 0x26, 0x39, 0x57, 0x0d, 0x94, 0xbd, 0x2f, 0x25,
-  0xec, 0x83, 0x1c, 0x2e, 0x18, 0x46, 0x12, 0x9d, 0x71, 0xb1, 0x03, 0x57,
-  0x6d, 0x29, 0x89, 0xad, 0x0d, 0x03, 0x6f, 0x20, 0xeb, 0x50, 0xeb, 0xb3,
-  0x4e, 0x68, 0x6e, 0x03, 0x03, 0x07, 0x39, 0x59, 0xbd, 0x09, 0x07, 0x2b,
-  0xc6, 0xbb, 0x19, 0x07, 0x56, 0x29, 0x23, 0x73, 0xc2, 0xf6, 0xc0, 0xd2,
-  0x42, 0x1f, 0x3e, 0x3b, 0xc6, 0x74, 0x14, 0xf9, 0xfa, 0xf7, 0xbf, 0x02,
-  0x75, 0x09, 0x26, 0x81, 0x4f, 0xb7, 0x02, 0xcd, 0xe9, 0x55, 0xb6, 0xff,
-  0xee, 0x5e, 0x8c, 0xdf, 0x35, 0x77, 0xe3, 0xff, 0xbe, 0x14, 0xa6, 0x00,
-  0xbd, 0xcd, 0x3c, 0x1e, 0xeb, 0xb6, 0x1d, 0x2f, 0xfc, 0x78, 0x03, 0x5a,
-  0x15, 0x0e, 0x41, 0xb4, 0x09, 0x7a, 0xab, 0x3e, 0x5b, 0x22, 0x14, 0x0b,
-  0x08, 0x4e, 0x0c, 0xc5, 0x16, 0xc3, 0xc7, 0xa4, 0x3b, 0x97, 0x3f, 0x76,
-  0xf6, 0x33, 0xc9, 0x43, 0xa6, 0x8c, 0x4c, 0xb3, 0x2e, 0x52, 0xf0, 0x8a,
-  0xd0, 0x3c, 0x72, 0xb1, 0x20, 0xbe, 0xb1, 0xda, 0xbf, 0xde, 0xdd, 0x1f,
-  0x80, 0xfa, 0x77, 0x26, 0x82, 0x6e, 0x4d, 0xeb, 0x08, 0xde, 0x09, 0x61,
-  0x75, 0x0b, 0x5e, 0x09, 0xb9, 0x80, 0x09, 0x25, 0x96, 0x02, 0xb7, 0x83,
-  0xe9, 0x85, 0x48, 0xc2, 0xbd, 0x32, 0xcd, 0x3a, 0x1f, 0xe9, 0x2b, 0x74,
-  0x13, 0xd2, 0x3e, 0x2b, 0x75, 0x27, 0xde, 0x0d, 0x74, 0x74, 0x05, 0xde,
-  0x04, 0x62, 0x75, 0x1d, 0xe6, 0x17, 0x4e, 0xb0, 0x27, 0xdb, 0x7f, 0x25,
-  0x5b, 0x2d, 0x0d, 0xa6, 0x04, 0x1c, 0x6e, 0x46, 0x01, 0xbf, 0xd7, 0xa3,
-  0x26, 0x21, 0x3b, 0x7d, 0x81, 0xce, 0x00, 0x40, 0x6b, 0x95, 0x2c, 0xdf,
-  0x0a, 0x80, 0x12, 0xed, 0xf5, 0xa1, 0xf4, 0x1f, 0xba, 0x05, 0xc0, 0x0b,
-  0xba, 0x6c, 0xa9, 0xd5, 0x0e, 0xbd, 0x1e, 0x81, 0xcf, 0x40, 0x5d, 0x30,
-  0x32, 0xed, 0x1e, 0x8a, 0x20, 0x05, 0xd4, 0x34, 0x1e, 0xe1, 0xcd, 0x30,
-  0xad, 0x37, 0x05, 0x52, 0x2c, 0xc3, 0xc1, 0x44, 0x3d, 0xcb, 0x28, 0x39,
-  0x94, 0x6e, 0x26, 0x0e, 0x93, 0x16, 0x5d, 0xfb, 0xfe, 0xa1, 0x50, 0x8c,
-  0x14, 0x6b, 0x2e, 0xd9, 0xc3, 0x5b, 0x47, 0x02, 0x7a, 0x46, 0x26, 0x5b,
-  0x3a, 0x7d, 0x33, 0xc6, 0xb2, 0xfe, 0x8c, 0x23, 0xf8, 0x9a, 0x03, 0x28,
-  0x45, 0x6a, 0xf0, 0x25, 0x88, 0xbe, 0x7b, 0x0a, 0xc0, 0x7d, 0x14, 0xf1,
-  0x0a, 0xe3, 0x5b, 0x71, 0x31, 0xab, 0x58, 0x9e, 0xaf, 0x69, 0x13, 0x09,
-  0x9a, 0xe1, 0xa9, 0x25, 0x4d, 0x91, 0xef, 0x51, 0x12, 0x0c, 0x90, 0x16,
-  0x98, 0xb8, 0xdb, 0x02, 0x50, 0x0c, 0xc2, 0xa5, 0x31, 0x74, 0x64, 0x6d,
-  0x8c, 0x93, 0xc1, 0x23, 0x05, 0x9a, 0xdf, 0xb4, 0x18, 0x65, 0x0c, 0x75,
-  0x37, 0x0f, 0x83, 0x11, 0x2f, 0x08, 0x95, 0xef, 0xeb, 0xa0, 0x39, 0x19,
-  0xa4, 0xa9, 0xd1, 0x10, 0xcc, 0x96, 0xcc, 0x90, 0x86, 0xd4, 0x96, 0x15,
-  0xfc, 0x4e, 0x0c, 0x98, 0xa8, 0x3f, 0xc6, 0x3d, 0xcc, 0x1f, 0xd9, 0x72,
-  0xea, 0x15, 0x36, 0x06, 0xa2, 0x34, 0x06, 0x64, 0x60, 0xc8, 0xc3, 0xa5,
-  0xf8, 0xc9, 0xb9, 0xff, 0xf6, 0x0b, 0xc2, 0x75, 0x22, 0x70, 0x15, 0x20,
-  0xae, 0x60, 0x91, 0x9b, 0xea, 0xe8, 0xc7, 0xfe, 0xc9, 0xf3, 0xa4, 0x0e,
-  0x0a, 0xf6, 0x0e, 0x74, 0x2d, 0x70, 0x22, 0x48, 0xc3, 0xb0, 0xa8, 0x59,
-  0x0c, 0xb0, 0x3a, 0x9c, 0x8c, 0xfe, 0x61, 0x84, 0x80, 0x56, 0xda, 0x86,
-  0xf6, 0x0d, 0xe8, 0x48, 0x70, 0x47, 0x1f, 0x75, 0xa3, 0x8a, 0x28, 0x5b,
-  0x76, 0x58, 0x7a, 0x61, 0x13, 0x0c, 0x3a, 0x79, 0x99, 0x44, 0x83, 0x7a,
-  0xb8, 0xec, 0x47, 0x16, 0x50, 0x59, 0x0c, 0x2c, 0xb8, 0x0e, 0xb8, 0x86,
-  0x1c, 0xcb, 0xe2, 0x0c, 0xeb, 0xb1, 0x4c, 0xa4, 0x0a, 0x43, 0x3d, 0xeb,
-  0x0b, 0xe9, 0x12, 0x46, 0x78, 0x99, 0x33, 0xc2, 0xbc, 0xbe, 0x0a, 0x5d,
-  0xf0, 0x0e, 0xc3, 0x7f, 0x28, 0x57, 0x5f, 0x5e, 0x43, 0x0c, 0x96, 0x59,
-  0x0e, 0x6a, 0x0c, 0x33, 0xf0, 0x63, 0x3c, 0x25, 0x81, 0xeb, 0x34, 0x55,
-  0xa1, 0x72, 0x35, 0x14, 0x2f, 0x7c, 0x75, 0x01, 0x47, 0x49, 0x0b, 0x83,
-  0x13, 0x6e, 0x14, 0x12, 0x1a, 0xbf, 0xc8, 0x15, 0x52, 0x21, 0x08, 0x13,
-  0x91, 0x59, 0xc2, 0x18, 0x11, 0x6f, 0xb7, 0x65, 0xf4, 0x0e, 0x01, 0xd6,
-  0x75, 0x19, 0x2f, 0x0e, 0x7e, 0x10, 0x09, 0x36, 0x3c, 0x4b, 0xff, 0x06,
-  0xc2, 0xfb, 0x0a, 0x19, 0x56, 0x0c, 0x18, 0xfe, 0x81, 0x67, 0x02, 0x5f,
-  0xfe, 0xb3, 0x28, 0x49, 0xe9, 0x08, 0x84, 0x1c, 0x31, 0x83, 0x55, 0xba,
-  0x8c, 0x25, 0x85, 0x60, 0x83, 0x5e, 0x6d, 0x75, 0x0a, 0x3d, 0xd0, 0x5d,
-  0x25, 0xd2, 0xd5, 0xcb, 0x96, 0x8d, 0xcf, 0x29, 0x39, 0x1b, 0x70, 0x85,
-  0x4d, 0x67, 0x83, 0x7b, 0x7d, 0x90, 0x12, 0x7d, 0xcf, 0xfe, 0x99, 0x01,
-  0xb2, 0x18, 0x11, 0xd8, 0xeb, 0x8d, 0x79, 0xbd, 0xfe, 0xa5, 0xfc, 0xab,
-  0xfe, 0x7d, 0x21, 0xe2, 0x44, 0x9a, 0xbb, 0x17, 0x28, 0x04, 0x41, 0xfe,
-  0x88, 0x46, 0xbc, 0xc6, 0x46, 0xbd, 0x3a, 0xdd, 0x03, 0xbe, 0x5c, 0x34,
-  0x2e, 0xbf, 0x17, 0x39, 0x71, 0x9a, 0x09, 0x23, 0x0e, 0xed, 0xf0, 0x85,
-  0x9c, 0xc5, 0x55, 0x5d, 0xa5, 0xbc, 0x21, 0xdb, 0x3b, 0xdc, 0x72, 0x88,
-  0x08, 0x66, 0xef, 0x3f, 0xe0, 0xeb, 0xe1, 0x41, 0x4e, 0x00, 0xdd, 0x6e,
-  0x9a, 0x64, 0x36, 0xe0, 0x97, 0xbc, 0x32, 0x33, 0xff, 0x22, 0x19, 0x08,
-  0x6c, 0xbe, 0x3b, 0x59, 0x8d, 0xa3, 0x18, 0x0e, 0x8b, 0x0b, 0x54, 0xd8,
-  0x8b, 0x3e, 0xb4, 0x2a, 0xcd, 0x21, 0xfc, 0xc7, 0x89, 0x0f, 0x35, 0x1a,
-  0x02, 0x9c, 0x12, 0x2c, 0x94, 0x8f, 0x21, 0x42, 0x42, 0xb5, 0x02, 0x82,
-  0x49, 0x36, 0x20, 0x0a, 0x5c, 0x65, 0x1a, 0x60, 0xb7, 0xc7, 0x08, 0x08,
-  0x57, 0x48, 0x09, 0x0c, 0x56, 0xc7, 0x6f, 0x5b, 0x98, 0xc4, 0xd4, 0x91,
-  0x14, 0x59, 0xe2, 0xbb, 0x12, 0xa2, 0xce, 0xbc, 0x35, 0x28, 0x2f, 0x2d,
-  0xff, 0x7d, 0x4f, 0x74, 0x2e, 0x40, 0xc3, 0x22, 0x38, 0x77, 0x5a, 0x8e,
-  0xff, 0x97, 0x0f, 0x8a, 0x16, 0x6e, 0x1f, 0x8e, 0xc0, 0x37, 0xa7, 0x14,
-  0x8e, 0x68, 0x59, 0x13, 0xf8, 0xf6, 0x74, 0x25, 0x80, 0x3e, 0x13, 0xf7,
-  0x0a, 0x74, 0x07, 0x06, 0xf6, 0x0d, 0x75, 0x17, 0x5c, 0x63, 0x03, 0x2c,
-  0x18, 0x2e, 0xc0, 0xfa, 0xb5, 0x8c, 0xf2, 0xef, 0x8e, 0x32, 0x82, 0x90,
-  0x57, 0x14, 0x07, 0xcb, 0x02, 0x0b, 0x78, 0x12, 0x11, 0xab, 0xd8, 0xeb,
-  0xd9, 0x0a, 0x38, 0x00, 0x01, 0x93, 0x14, 0x9c, 0x69, 0x0a, 0x27, 0xc8,
-  0x4d, 0xc6, 0xb4, 0xde, 0xb0, 0x28, 0x3b, 0xdd, 0xf7, 0xd8, 0x65, 0x9a,
-  0x5c, 0x22, 0x84, 0xc9, 0x14, 0x18, 0x96, 0x85, 0x62, 0x36, 0x3b, 0x5b,
-  0xc4, 0x23, 0x0a, 0x88, 0xc1, 0x9d, 0x96, 0x40, 0x1c, 0xb8, 0x98, 0x37,
-  0x44, 0xf8, 0x1f, 0x50, 0x18, 0x49, 0x38, 0xed, 0x33, 0x47, 0x8e, 0x3d,
-  0x01, 0x6c, 0x1b, 0x1f, 0x9b, 0x31, 0x6f, 0x50, 0x2f, 0x64, 0x1e, 0x60,
-  0xd6, 0x49, 0x45, 0x60, 0xf6, 0x84, 0x5c, 0xf6, 0x21, 0xff, 0xa0, 0x27,
-  0xf1, 0xb4, 0x00, 0x5e, 0x48, 0x91, 0x61, 0x98, 0x15, 0xb8, 0xbc, 0xe8,
-  0x93, 0x86, 0x77, 0xa1, 0x5e, 0x43, 0x0d, 0x0d, 0x07, 0xfe, 0x49, 0x95,
-  0xbe, 0xb2, 0x2e, 0xbe, 0x4e, 0x06, 0x51, 0xcd, 0xc8, 0xac, 0x70, 0xc8,
-  0x0d, 0xba, 0xb6, 0x50, 0x31, 0x61, 0x71, 0xe0, 0x68, 0xfd, 0x4d, 0x69,
-  0x01, 0x27, 0x7b, 0xd7, 0xe9, 0xe9, 0x5d, 0x01, 0xce, 0x25, 0xd8, 0x6f,
-  0xc8, 0x00, 0x77, 0x3a, 0x09, 0xcb, 0x9c, 0x39, 0x52, 0xf5, 0xe1, 0x73,
-  0x3a, 0x43, 0x0d, 0xe1, 0x4f, 0x43, 0x03, 0xd2, 0xba, 0x56, 0x53, 0x6f,
-  0x3d, 0x61, 0xc3, 0x22, 0x5b, 0x47, 0x73, 0x1d, 0x7d, 0x9c, 0xe9, 0x05,
-  0x01, 0x66, 0x35, 0xad, 0xdf, 0xdf, 0x7c, 0x26, 0x43, 0x75, 0x86, 0x0c,
-  0xc4, 0xd7, 0x26, 0x2b, 0x52, 0x05, 0x72, 0x5a, 0x06, 0xc8, 0x4f, 0xdb,
-  0x6f, 0x69, 0xb2, 0xff, 0x50, 0xc5, 0xd0, 0x5b, 0x0e, 0x0d, 0x43, 0x9a,
-  0x5a, 0x28, 0x8c, 0xe5, 0x58, 0x49, 0x61, 0xad, 0xe0, 0x01, 0x14, 0x5a,
-  0x1a, 0xa9, 0xc8, 0x7c, 0x16, 0x4a, 0xc6, 0x1e, 0x2c, 0xa1, 0x4f, 0x5e,
-  0x1a, 0x31, 0x05, 0xec, 0x5e, 0xeb, 0x53, 0x3f, 0xc7, 0x87, 0xb7, 0x6a,
-  0x7d, 0x26, 0x0f, 0xf0, 0x50, 0x80, 0x53, 0x6e, 0x4e, 0x8b, 0xc3, 0x5b,
-  0x1c, 0xf5, 0x21, 0x26, 0xf6, 0x17, 0x8b, 0xd8, 0x5f, 0xf8, 0x88, 0x17,
-  0x8a, 0xc2, 0x5c, 0x70, 0xeb, 0x17, 0x24, 0x41, 0x21, 0x40, 0xb2, 0xfe,
-  0xfc, 0x0b, 0x61, 0x70, 0xbc, 0xfe, 0x9c, 0x3e, 0xa6, 0x0a, 0x75, 0xca,
-  0x89, 0x72, 0x5d, 0x1f, 0x5e, 0x94, 0xfe, 0x24, 0x31, 0xe7, 0x0a, 0xa4,
-  0x56, 0x4f, 0xd4, 0x87, 0xed, 0xf0, 0x67, 0x0e, 0x56, 0x08, 0xd1, 0xf6,
-  0xe8, 0x36, 0xfe, 0x30, 0xac, 0xeb, 0xec, 0x1e, 0x10, 0x55, 0xe9, 0x55,
-  0x58, 0x0e, 0x3d, 0xd6, 0x0b, 0x1a, 0x60, 0x98, 0xcf, 0x37, 0xf3, 0xa0,
-  0x40, 0x1e, 0x12, 0x1b, 0x58, 0x9b, 0xc7, 0x26, 0x3e, 0x6c, 0xf1, 0xfd,
-  0x4f, 0x18, 0xf7, 0xb4, 0x06, 0x09, 0x49, 0x15, 0x5b, 0x4f, 0x65, 0x3c,
-  0x12, 0x14, 0x1e, 0xa0, 0x54, 0xc8, 0x3b, 0x64, 0x52, 0x99, 0x52, 0x39,
-  0x02, 0x0b, 0x92, 0x50, 0xe3, 0xc3, 0x6c, 0x30, 0x28, 0x8a, 0xda, 0x6f,
-  0x10, 0x12, 0xcc, 0xd2, 0x81, 0xa9, 0x6d, 0x76, 0x02, 0x7f, 0x49, 0x83,
-  0x72, 0x74, 0x7f, 0x76, 0x8d, 0xa8, 0xf3, 0xb8, 0x2b, 0x3e, 0xfc, 0x5e,
-  0x04, 0x75, 0x0f, 0x81, 0x0d, 0xa9, 0x6a, 0x3d, 0xf6, 0x9d, 0x0d, 0xba,
-  0x90, 0x14, 0xd9, 0x15, 0xfa, 0xa6, 0x0d, 0x96, 0x3c, 0x06, 0x59, 0xfa,
-  0x9e, 0x46, 0x3e, 0x60, 0x18, 0x9d, 0x13, 0x98, 0x72, 0x41, 0x25, 0xc2,
-  0x15, 0x13, 0xfa, 0x68, 0xc8, 0xbe, 0x90, 0x36, 0xf3, 0xf3, 0xff, 0x8c,
-  0xa6, 0xd0, 0x7a, 0xc7, 0x3c, 0x1c, 0x0d, 0xf5, 0x08, 0x34, 0x0a, 0x08,
-  0xfd, 0x6e, 0x9d, 0xfc, 0x74, 0x5f, 0x0b, 0xf6, 0x76, 0x5b, 0x5b, 0xd6,
-  0x2e, 0xcd, 0x1e, 0xc4, 0x30, 0x30, 0x16, 0x4c, 0x0a, 0x54, 0x68, 0x3e,
-  0x50, 0xbd, 0x21, 0x4a, 0xcb, 0x0a, 0x0c, 0x2d, 0x74, 0x74, 0x4d, 0x06,
-  0xed, 0x6f, 0x0b, 0x6c, 0xe9, 0xa9, 0x31, 0x6e, 0xc5, 0xf6, 0x26, 0x56,
-  0x4c, 0x4b, 0x5c, 0x2d, 0x2b, 0x1b, 0x58, 0x41, 0xac, 0x92, 0x2c, 0x6a,
-  0x08, 0xf4, 0x51, 0x93, 0xa2, 0x08, 0x18, 0xc7, 0x4a, 0x06, 0x25, 0x18,
-  0xc6, 0x1f, 0x01, 0x37, 0x53, 0x6c, 0xd0, 0x8e, 0xbc, 0x8c, 0xc0, 0x07,
-  0x6e, 0x7b, 0x8b, 0x1f, 0xb8, 0x6c, 0x02, 0x9c, 0xa9, 0x32, 0xc6, 0x23,
-  0x60, 0x13, 0xad, 0xe8, 0xb8, 0xd3, 0x19, 0x70, 0x52, 0xa2, 0x3e, 0x40,
-  0xa3, 0x73, 0xe2, 0x14, 0xb0, 0x21, 0x84, 0x1d, 0xe2, 0xe8, 0xb3, 0xc1,
-  0x20, 0x57, 0x93, 0x21, 0x92, 0xa4, 0xf8, 0xde, 0x2d, 0xc1, 0x84, 0xc2,
-  0x80, 0x1c, 0xc4, 0x2c, 0x16, 0x70, 0x9a, 0xb7, 0x0e, 0x28, 0xf6, 0x27,
-  0x0b, 0xc8, 0xcc, 0xb4, 0xc2, 0x19, 0xb0, 0x2c, 0x23, 0x1c, 0x71, 0x14,
-  0x97, 0x84, 0x65, 0x0b, 0xb3, 0x1c, 0xc6, 0x53, 0x1b, 0xe5, 0x21, 0x38,
-  0x65, 0xf4, 0x83, 0xf6, 0x9a, 0x3c, 0x74, 0x10, 0x23, 0x2e, 0xf6, 0x2c,
-  0xf4, 0xb4, 0x17, 0x7d, 0x06, 0x8b, 0xf6, 0x1a, 0xf4, 0x57, 0x4d, 0x04,
-  0x21, 0x01, 0x6a, 0x60, 0x9c, 0x9e, 0xb4, 0x03, 0xd6, 0x2c, 0x39, 0xd3,
-  0x74, 0x0b, 0x33, 0x34, 0xb0, 0x6e, 0x3a, 0xa3, 0x90, 0x38, 0x44, 0x9e,
-  0x47, 0xeb, 0x09, 0x97, 0x69, 0xf6, 0x75, 0x89, 0xe5, 0x1d, 0xd4, 0x86,
-  0x47, 0x30, 0x2c, 0x38, 0x06, 0x90, 0xce, 0xd8, 0x64, 0x29, 0x50, 0x68,
-  0x57, 0x3f, 0x86, 0xa1, 0x98, 0xd0, 0x20, 0x8b, 0x6f, 0x7f, 0x81, 0xc2,
-  0x00, 0xf6, 0xa6, 0x15, 0xce, 0x12, 0x60, 0x63, 0xb4, 0x1f, 0x07, 0x05,
-  0x44, 0xf8, 0x6e, 0x79, 0xd1, 0xf8, 0xd4, 0x01, 0x0b, 0x00, 0xba, 0xf8,
-  0x86, 0x07, 0xb8, 0x80, 0x1f, 0xad, 0xe9, 0xc4, 0x31, 0x1e, 0x9a, 0xcd,
-  0x99, 0x34, 0x4a, 0x29, 0xfc, 0x18, 0xe1, 0x01, 0xb3, 0x33, 0x48, 0x18,
-  0x3b, 0xf7, 0xc6, 0x17, 0x45, 0x6b, 0xd9, 0x0b, 0x7b, 0x80, 0x51, 0x83,
-  0x0d, 0x6a, 0x01, 0x71, 0xc4, 0x7f, 0x25, 0x03, 0x98, 0x48, 0x6a, 0x4c,
-  0x97, 0xb0, 0x4e, 0x8a, 0xfd, 0x84, 0x00, 0x20, 0x98, 0x03, 0xf8, 0xbb,
-  0xa9, 0x7f, 0xf4, 0x18, 0x39, 0x02, 0x5a, 0x0e, 0x8e, 0x33, 0xe0, 0x03,
-  0x02, 0x7e, 0x6b, 0xce, 0x07, 0x3c, 0x45, 0xf4, 0xef, 0xc7, 0x4b, 0xf4,
-  0xf7, 0x47, 0x4c, 0x2e, 0x51, 0xfc, 0x57, 0x01, 0xb6, 0x00, 0x03, 0xc2,
-  0x02, 0xf2, 0xa0, 0x46, 0x45, 0x1f, 0xed, 0x32, 0x01, 0xb4, 0xb4, 0xd6,
-  0x57, 0xcc, 0x7a, 0xa6, 0x18, 0x4e, 0x5e, 0x6b, 0xe8, 0xde, 0x11, 0x07,
-  0x1c, 0x0a, 0x16, 0x03, 0x06, 0x68, 0xfa, 0x12, 0xaf, 0xf6, 0x83, 0x1d,
-  0x94, 0x6c, 0x49, 0x6d, 0x07, 0x36, 0xa0, 0x99, 0x49, 0xb2, 0xd8, 0x68,
-  0x1d, 0x14, 0xf6, 0x5f, 0x03, 0xb7, 0x4c, 0xad, 0xdf, 0x41, 0x83, 0x1e,
-  0x01, 0xb6, 0x4e, 0x2e, 0x5e, 0x2c, 0x98, 0x15, 0x64, 0x8e, 0x84, 0x27,
-  0x01, 0x85, 0x29, 0x8d, 0x85, 0x19, 0x93, 0x47, 0x9e, 0xc1, 0xc6, 0xca,
-  0x81, 0x10, 0x95, 0x9d, 0xae, 0x1b, 0xf6, 0x17, 0x88, 0xf2, 0xa8, 0x42,
-  0xd5, 0x72, 0x88, 0x1b, 0x00, 0xd9, 0x81, 0x2c, 0xd4, 0x07, 0x21, 0xd8,
-  0x39, 0x5c, 0x1b, 0x00, 0x71, 0x46, 0x1b, 0x4d, 0xbb, 0x05, 0xde, 0xbc,
-  0x07, 0xb9, 0x05, 0xa3, 0x61, 0x1c, 0x76, 0x38, 0x32, 0x0a, 0x2f, 0xef,
-  0xeb, 0x44, 0x7f, 0x07, 0x54, 0xfe, 0x22, 0x76, 0x3b, 0x81, 0x6e, 0xe4,
-  0x06, 0x5c, 0xf1, 0xf9, 0x33, 0xff, 0xf2, 0x38, 0x22, 0x4e, 0xf5, 0x1a,
-  0xf9, 0x15, 0x01, 0x21, 0xd9, 0xee, 0x1a, 0x49, 0x84, 0x70, 0xea, 0x3e,
-  0x10, 0x81, 0x9e, 0xd1, 0x1a, 0x50, 0xc2, 0x10, 0xe7, 0xb1, 0x0d, 0x8a,
-  0x0a, 0x21, 0xe6, 0x53, 0x10, 0xa8, 0x08, 0x41, 0x86, 0x61, 0x2c, 0x78,
-  0x93, 0x1a, 0x4e, 0x1a, 0x01, 0xc2, 0x16, 0xec, 0x6d, 0x71, 0x36, 0x34,
-  0x6f, 0xab, 0x19, 0x0a, 0xd4, 0x33, 0x20, 0xbd, 0x5c, 0x1b, 0xf3, 0x15,
-  0xde, 0x0f, 0x2d, 0x14, 0x85, 0x68, 0x3f, 0x7e, 0x8a, 0x1d, 0xeb, 0x51,
-  0xc1, 0x0e, 0x68, 0x24, 0x4c, 0xe0, 0x70, 0x79, 0x37, 0xae, 0x8a, 0x87,
-  0x1c, 0x75, 0xa1, 0xc6, 0x3b, 0x8b, 0x15, 0xa5, 0xfe, 0x64, 0x1c, 0x6a,
-  0x1a, 0xcf, 0xce, 0x47, 0xc7, 0xc4, 0x66, 0x22, 0xac, 0x25, 0xd0, 0x98,
-  0xec, 0x24, 0xa4, 0x1b, 0xc7, 0x07, 0x7b, 0xd2, 0x35, 0x8c, 0x83, 0x56,
-  0x5e, 0x08, 0x17, 0xf7, 0x0c, 0x20, 0x46, 0x49, 0x18, 0xa4, 0x43, 0xb5,
-  0x1c, 0x99, 0xd7, 0x81, 0x17, 0x07, 0x1b, 0x13, 0xc0, 0xd6, 0x8f, 0xd9,
-  0x6d, 0x2e, 0x92, 0x10, 0x34, 0x66, 0x78, 0xa5, 0xd4, 0x92, 0x06, 0xc2,
-  0x78, 0xea, 0xd0, 0x35, 0x70, 0x6d, 0x75, 0x61, 0x03, 0x36, 0xc2, 0x01,
-  0x06, 0xdb, 0x0e, 0xa1, 0x02, 0x42, 0x59, 0xe3, 0x77, 0xff, 0x15, 0x0d,
-  0x87, 0x43, 0x0a, 0xa9, 0x02, 0x16, 0x26, 0xc4, 0xc1, 0x48, 0x78, 0xac,
-  0x1e, 0xe0, 0xfa, 0xa4, 0xaf, 0x18, 0x1a, 0x9d, 0xa6, 0xbe, 0xe4, 0xf6,
-  0x87, 0x2d, 0x1d, 0xb6, 0x79, 0x09, 0xfd, 0x0c, 0x05, 0xe0, 0xb3, 0x15,
-  0x04, 0xb1, 0x2b, 0xf1, 0x81, 0xec, 0x8e, 0x00, 0x1d, 0x5d, 0x0c, 0xdb,
-  0x40, 0x3d, 0x4c, 0x73, 0x17, 0xf3, 0xea, 0x10, 0x01, 0x37, 0x40, 0xd1,
-  0xe3, 0xaa, 0xf7, 0xd0, 0xbd, 0x1b, 0xe9, 0x17, 0x00, 0x20, 0x2f, 0x22,
-  0xc3, 0x3e, 0xec, 0xe9, 0xec, 0x00, 0x23, 0x75, 0x81, 0xa7, 0x5b, 0xe1,
-  0xfd, 0x07, 0x24, 0x39, 0x7c, 0xab, 0x98, 0xe2, 0x57, 0xd4, 0x35, 0x48,
-  0x36, 0xab, 0xeb, 0x7a, 0x98, 0x8a, 0x5b, 0x13, 0xf4, 0x2c, 0xf4, 0xca,
-  0x5d, 0xd0, 0xf9, 0x3c, 0x6c, 0xa6, 0x0a, 0x2c, 0x32, 0xfc, 0xca, 0xd9,
-  0xef, 0x46, 0xed, 0x8a, 0x13, 0x45, 0xff, 0x4b, 0xfc, 0x8d, 0x86, 0x72,
-  0xff, 0x6f, 0x3d, 0xfc, 0x33, 0xdb, 0xff, 0x2b, 0xd0, 0x83, 0xdb, 0x00,
-  0x0b, 0xdb, 0x7c, 0x89, 0x49, 0x6d, 0xbe, 0xfa, 0x80, 0x00, 0x72, 0x41,
-  0xc2, 0x19, 0xf8, 0x8b, 0xf2, 0x56, 0x06, 0x90, 0x64, 0x82, 0xe2, 0x8b,
-  0xf8, 0xef, 0x08, 0x13, 0x0b, 0xff, 0x73, 0x63, 0xe5, 0x58, 0x74, 0x77,
-  0x2b, 0xdd, 0x4c, 0xeb, 0x4e, 0xea, 0x36, 0x16, 0x05, 0x8c, 0x68, 0xfa,
-  0xa6, 0xdb, 0xd9, 0x73, 0xff, 0x49, 0x1e, 0x8b, 0xc2, 0x37, 0xa2, 0x76,
-  0x27, 0x6b, 0x4f, 0x17, 0xd9, 0x53, 0x4c, 0x0f, 0xc8, 0x5b, 0x98, 0xaa,
-  0x50, 0xbc, 0x03, 0xc7, 0x2b, 0xc6, 0x2b, 0x81, 0x08, 0x96, 0x09, 0x48,
-  0x1f, 0x9b, 0x33, 0xf6, 0x05, 0x80, 0xd7, 0x32, 0x0d, 0x73, 0x2f, 0x82,
-  0x68, 0x0f, 0x46, 0x03, 0x10, 0xac, 0xde, 0x39, 0x0f, 0xbe, 0x04, 0x10,
-  0x80, 0x12, 0x72, 0x0d, 0x07, 0x4e, 0x30, 0x1a, 0xc8, 0xdf, 0xcb, 0x39,
-  0x86, 0x06, 0xd7, 0xfe, 0x3b, 0x06, 0x16, 0x20, 0x74, 0x3b, 0xa3, 0xd0,
-  0x04, 0x76, 0x56, 0xfa, 0x50, 0x3a, 0x99, 0xfe, 0x01, 0x15, 0x64, 0xab,
-  0x5b, 0x0d, 0xfa, 0x1a, 0xbf, 0x3a, 0x73, 0xfc, 0xb5, 0xc5, 0x77, 0xd8,
-  0x8f, 0x18, 0x0b, 0xf8, 0xd2, 0x7c, 0x0c, 0x7f, 0x05, 0xe8, 0x14, 0x76,
-  0xb0, 0xe1, 0xf1, 0xa3, 0xe0, 0xad, 0x41, 0x02, 0x10, 0x87, 0x5d, 0x1e,
-  0x54, 0xfa, 0xef, 0xa2, 0xff, 0x3e, 0x51, 0x33, 0xed, 0x4b, 0x16, 0x1f,
-  0x52, 0xea, 0xe2, 0x8b, 0xdc, 0x60, 0xbf, 0x6b, 0x8f, 0x04, 0x6a, 0x0c,
-  0xec, 0xe0, 0x8b, 0x4e, 0x2e, 0xcf, 0x4f, 0x04, 0xd9, 0x0b, 0x0e, 0x41,
-  0x2c, 0xc3, 0x10, 0x4d, 0xcd, 0xb9, 0x6f, 0x4e, 0xcd, 0x25, 0x1b, 0x8e,
-  0xc9, 0xc4, 0xdc, 0xeb, 0x10, 0x32, 0xe7, 0x20, 0x2e, 0x52, 0xc5, 0xcd,
-  0xbf, 0x14, 0x5b, 0x1f, 0xf8, 0xe3, 0x08, 0xa3, 0x7d, 0x00, 0x0c, 0x1e,
-  0xc2, 0x2d, 0xb0, 0x66, 0x99, 0x3b, 0x0a, 0x99, 0x26, 0x00, 0xe4, 0x26,
-  0x29, 0xed, 0x06, 0x55, 0xc4, 0x67, 0xfa, 0xfc, 0x2b, 0xc0, 0x99, 0xb9,
-  0x50, 0x79, 0x2c, 0xcc, 0xbf, 0x68, 0xe7, 0xd8, 0x72, 0x1c, 0xd8, 0x88,
-  0x01, 0xb7, 0x74, 0xf7, 0xbd, 0x0b, 0x1e, 0x80, 0xf6, 0xfb, 0x2b, 0x74,
-  0x06, 0x04, 0xd2, 0x2d, 0x0c, 0xde, 0x45, 0x16, 0xd5, 0x09, 0x2f, 0xac,
-  0x2f, 0x80, 0xeb, 0xff, 0x30, 0x72, 0x2a, 0xf7, 0xe1, 0x03, 0xc3, 0x12,
-  0xfe, 0xd6, 0x74, 0xea, 0xeb, 0x12, 0x8b, 0xfa, 0xe6, 0x38, 0x0e, 0xff,
-  0x97, 0x87, 0xd1, 0xf7, 0xe2, 0x92, 0x97, 0x6e, 0x15, 0x13, 0xd1, 0xc3,
-  0x29, 0x9b, 0x05, 0x73, 0xe0, 0xff, 0x4d, 0x7c, 0x07, 0xf7, 0xda, 0xf7,
-  0xd8, 0x83, 0xa5, 0xda, 0x30, 0xbc, 0x07, 0x74, 0x00, 0x97, 0x32, 0x7e,
-  0x00, 0x20, 0x2a, 0xfa, 0x1e, 0xb4, 0x3b, 0xc5, 0x50, 0x74, 0x42, 0x0a,
-  0xd0, 0x72, 0x75, 0x38, 0x04, 0x2d, 0xab, 0xb3, 0x76, 0x36, 0xb4, 0x19,
-  0xd8, 0x10, 0x98, 0x0f, 0x3c, 0xdf, 0x0e, 0x8a, 0x1c, 0x98, 0x66, 0x2a,
-  0xde, 0xd3, 0x0c, 0xb4, 0x43, 0xdb, 0xdb, 0x0a, 0x30, 0x07, 0x03, 0x91,
-  0x7c, 0x2f, 0x83, 0x06, 0x66, 0x74, 0x3e, 0xcd, 0x57, 0x15, 0xc0, 0x72,
-  0x0c, 0x58, 0x3d, 0x2c, 0x4d, 0xec, 0x65, 0x1d, 0xed, 0x56, 0x66, 0xba,
-  0x47, 0x49, 0xc5, 0xd6, 0x7d, 0x69, 0x03, 0x49, 0x8a, 0x02, 0x4b, 0x77,
-  0x81, 0xc4, 0x11, 0x50, 0xbf, 0x31, 0x0b, 0xc7, 0x74, 0x20, 0xb0, 0xb6,
-  0x00, 0xc4, 0x25, 0x18, 0x4c, 0x14, 0xbc, 0x0b, 0xf7, 0xd1, 0x49, 0x5d,
-  0x72, 0x3e, 0xe2, 0x20, 0x21, 0x8c, 0x5f, 0xd9, 0x8c, 0xc3, 0x0b, 0xdf,
-  0xe8, 0x89, 0x7e, 0xfc, 0xd0, 0x5d, 0x4f, 0x44, 0x33, 0x1d, 0x6b, 0x04,
-  0x68, 0x32, 0xdd, 0x88, 0xc4, 0x3d, 0xe1, 0x18, 0x0c, 0x5b, 0x33, 0x05,
-  0x85, 0x0a, 0xab, 0xe2, 0xe3, 0x3a, 0xe0, 0xdc, 0x47, 0x8b, 0xd9, 0x4b,
-  0x94, 0x39, 0xf6, 0x3d, 0x75, 0xdd, 0x1e, 0x6d, 0xff, 0x06, 0xf3, 0xa6,
-  0x1f, 0x87, 0xcb, 0x75, 0x89, 0xd2, 0x97, 0xb4, 0x8c, 0xc2, 0x92, 0x0b,
-  0x13, 0x03, 0x6a, 0x67, 0x9b, 0xf1, 0x05, 0x00, 0x30, 0x41, 0x07, 0xcf,
-  0x1c, 0x8a, 0x8a, 0xc5, 0x27, 0x1f, 0x3c, 0x11, 0x07, 0x13, 0x2d, 0x43,
-  0x26, 0xe3, 0x33, 0xbf, 0xd8, 0xb4, 0x36, 0x1d, 0xec, 0x8b, 0xf3, 0x1c,
-  0x55, 0xf6, 0xe3, 0x37, 0x20, 0x1d, 0x5e, 0x08, 0x94, 0x1a, 0x16, 0x78,
-  0x7b, 0x4b, 0x04, 0x21, 0xb3, 0x6d, 0x6e, 0x9a, 0x07, 0x0e, 0x92, 0x1d,
-  0x63, 0x0e, 0x68, 0xbe, 0x8d, 0x4e, 0xf2, 0x89, 0x4e, 0x9f, 0xf2, 0xc6,
-  0x46, 0xdb, 0xf2, 0x55, 0x03, 0xf3, 0xa6, 0xcd, 0x31, 0x5b, 0x75, 0xf4,
-  0x4b, 0x6d, 0xf5, 0x6f, 0x24, 0x3c, 0x25, 0x72, 0xfb, 0x15, 0x3c, 0x26,
-  0x77, 0x11, 0x16, 0x76, 0xf5, 0x36, 0x10, 0xf6, 0xf6, 0x8f, 0x06, 0x29,
-  0xdb, 0xf8, 0x18, 0xfa, 0x2c, 0xc5, 0x46, 0x3d, 0xf0, 0x34, 0xff, 0x74,
-  0xf1, 0x4e, 0x8b, 0xb1, 0x83, 0x5c, 0xb6, 0x8c, 0x4c, 0x05, 0xc6, 0x54,
-  0x71, 0xc6, 0x7c, 0xa2, 0x83, 0xbe, 0x6b, 0x1f, 0x9a, 0x52, 0x9f, 0xe1,
-  0x9c, 0x9c, 0x70, 0x6e, 0x06, 0x25, 0xf3, 0x8f, 0x04, 0x8f, 0x44, 0x5b,
-  0x0c, 0x05, 0x08, 0x6c, 0x02, 0x0e, 0xbf, 0x0c, 0x83, 0x64, 0x0c, 0x01,
-  0xb6, 0x89, 0x27, 0x89, 0xdb, 0x2d, 0x89, 0x33, 0x6d, 0x89, 0x39, 0xed,
-  0x89, 0x04, 0x1f, 0x46, 0x85, 0x50, 0x8a, 0xe1, 0xbe, 0x00, 0x58, 0x1e,
-  0xd9, 0xc9, 0x02, 0xc8, 0xc6, 0xe9, 0x0c, 0x93, 0x2d, 0xb2, 0x8e, 0x0e,
-  0x0c, 0x06, 0x80, 0x30, 0x55, 0xb6, 0x35, 0x5d, 0x8f, 0x0c, 0x0e, 0x83,
-  0x0a, 0x25, 0x4c, 0x2e, 0xe1, 0x97, 0x06, 0x44, 0x34, 0x71, 0x1c, 0xfa,
-  0x9a, 0x50, 0x0e, 0x36, 0x77, 0x0a, 0x78, 0x0c, 0x91, 0x43, 0x6f, 0x63,
-  0xc2, 0xeb, 0x06, 0x1e, 0x46, 0x05, 0xfc, 0x04, 0x60, 0xcd, 0xcb, 0x04,
-  0x15, 0x5b, 0xbc, 0x58, 0xff, 0x7e, 0x03, 0xbe, 0x57, 0x00, 0x89, 0x36,
-  0x18, 0xa1, 0x20, 0xb3, 0x65, 0x1a, 0x43, 0xbd, 0x50, 0x11, 0xa9, 0xf4,
-  0x06, 0x41, 0x4d, 0x70, 0x23, 0xd5, 0x7f, 0xe5, 0xad, 0x1e, 0x17, 0x1a,
-  0x5d, 0xd4, 0x1d, 0x8a, 0x8e, 0x9a, 0x95, 0x02, 0x7e, 0xb8, 0x00, 0x44,
-  0x31, 0xbe, 0xec, 0x92, 0x25, 0x80, 0x4d, 0xc1, 0x80, 0x24, 0xed, 0xb4,
-  0x42, 0x80, 0x91, 0x0c, 0x07, 0x2c, 0x8e, 0xe2, 0x02, 0x63, 0xdb, 0x05,
-  0x75, 0x8c, 0xc2, 0xff, 0x99, 0x2d, 0x0d, 0x22, 0x30, 0xc8, 0xd6, 0x8a,
-  0x1b, 0x8d, 0x18, 0xfa, 0x83, 0xfb, 0x24, 0x77, 0x5c, 0x5c, 0x7e, 0x02,
-  0x72, 0x1d, 0x95, 0x0e, 0x68, 0x2e, 0xb7, 0x4e, 0xc9, 0x7d, 0xc5, 0x12,
-  0x80, 0x2d, 0xcc, 0x74, 0x02, 0x01, 0xfd, 0x05, 0x2d, 0x47, 0xf7, 0xd9,
-  0x37, 0x8b, 0xd9, 0x00, 0x8d, 0xfc, 0x76, 0xde, 0xe3, 0x10, 0x91, 0x2b,
-  0x10, 0xb6, 0xf5, 0x91, 0x02, 0xe0, 0x36, 0x88, 0x5a, 0x6e, 0xe3, 0xdb,
-  0x31, 0xf0, 0x0e, 0xde, 0x0b, 0x01, 0xb2, 0x63, 0xf4, 0x13, 0x6d, 0xde,
-  0x2a, 0xf1, 0x03, 0xce, 0xfc, 0x4e, 0xbf, 0x73, 0x04, 0x2c, 0x0a, 0x73,
-  0x04, 0xc0, 0x04, 0x3a, 0xbf, 0xcb, 0x02, 0x46, 0x04, 0xaa, 0xe2, 0x8d,
-  0xee, 0xb3, 0xe0, 0xaa, 0x07, 0x8b, 0x2f, 0x98, 0x0c, 0xad, 0x2b, 0xda,
-  0x67, 0x0e, 0xc1, 0x7e, 0x0c, 0xa0, 0xa3, 0x7a, 0x69, 0x99, 0x8e, 0x49,
-  0x11, 0xb8, 0x64, 0x52, 0x50, 0x43, 0xab, 0xfd, 0x0c, 0xb0, 0x01, 0x50,
-  0xb0, 0x61, 0xaa, 0xac, 0x51, 0x96, 0x80, 0xf8, 0xab, 0x4f, 0x25, 0x33,
-  0x01, 0x1c, 0xe4, 0x39, 0x09, 0x6c, 0x55, 0x0e, 0xa0, 0x30, 0x67, 0xdf,
-  0x27, 0x11, 0x84, 0xff, 0xf0, 0x37, 0xdd, 0xf0, 0xc8, 0xe3, 0x14, 0xce,
-  0xef, 0xf7, 0xa5, 0xfc, 0x63, 0xfa, 0x8a, 0x44, 0xff, 0x32, 0xe4, 0x5b,
-  0x81, 0x4d, 0x05, 0x7d, 0xed, 0x1f, 0x2b, 0xc1, 0x64, 0xde, 0xed, 0x8c,
-  0xda, 0x1e, 0x0e, 0xed, 0x1b, 0xb9, 0xd1, 0xe9, 0x6f, 0x26, 0xa5, 0x73,
-  0x01, 0xe2, 0xa4, 0x8e, 0xda, 0x4d, 0xec, 0x82, 0x23, 0x9c, 0xf5, 0x30,
-  0x56, 0x6f, 0x5f, 0x8a, 0xe0, 0xfc, 0xf7, 0x88, 0xc7, 0x5f, 0x1b, 0x04,
-  0xe3, 0x09, 0xaa, 0xb7, 0x49, 0x2d, 0xf3, 0xab, 0x6e, 0x2c, 0xaa, 0x5f,
-  0xc5, 0x23, 0x70, 0x6f, 0xcc, 0x7e, 0x67, 0x7b, 0xc8, 0x8b, 0xff, 0x7a,
-  0x2d, 0x9a, 0x66, 0xf4, 0x96, 0x33, 0x1a, 0x13, 0x3f, 0xe8, 0x61, 0x12,
-  0x73, 0xdf, 0x06, 0xfd, 0xb6, 0x03, 0x40, 0xac, 0x1e, 0xa1, 0xdc, 0x7f,
-  0x23, 0x62, 0xbf, 0x03, 0xf1, 0x4e, 0x03, 0xf9, 0x4f, 0x60, 0x65, 0xf8,
-  0x11, 0xa4, 0x49, 0x2b, 0x5b, 0x74, 0xf8, 0x69, 0x9a, 0x96, 0x2d, 0xf0,
-  0xa9, 0xf0, 0xc8, 0x7b, 0xa4, 0xfc, 0x1f, 0x94, 0x05, 0x02, 0x98, 0x16,
-  0xd9, 0x72, 0x98, 0xa4, 0x0a, 0x05, 0xdc, 0x70, 0x04, 0xb4, 0x3c, 0x08,
-  0x04, 0x31, 0x02, 0xfa, 0x82, 0x7f, 0xfd, 0x10, 0x06, 0x54, 0x6e, 0x21,
-  0x2b, 0xc9, 0x17, 0xcb, 0xb4, 0x40, 0x68, 0x1a, 0xcd, 0x59, 0x67, 0xdc,
-  0x8b, 0x6a, 0x46, 0xb6, 0x5d, 0x00, 0x16, 0xda, 0x0c, 0x89, 0x8b, 0x1f,
-  0x8b, 0xd6, 0x0b, 0xd0, 0x12, 0xcb, 0xba, 0x11, 0x01, 0x0b, 0x69, 0x6a,
-  0x88, 0x5e, 0xa0, 0xf6, 0x1f, 0x21, 0x39, 0x61, 0xbb, 0x02, 0xa9, 0x80,
-  0x10, 0x6e, 0x07, 0xbb, 0x1d, 0xff, 0xfd, 0x10, 0x64, 0x2f, 0x6a, 0xe4,
-  0xdd, 0x3e, 0x2d, 0x2c, 0xf7, 0x8b, 0x1c, 0x55, 0x26, 0xe5, 0xe7, 0x2a,
-  0x15, 0x36, 0x47, 0xf0, 0x23, 0x11, 0x59, 0x2c, 0xb9, 0x35, 0x4a, 0x82,
-  0x2d, 0x31, 0x88, 0xf8, 0x58, 0x05, 0x13, 0x85, 0xea, 0x77, 0x62, 0x04,
-  0x74, 0x28, 0xdd, 0xb8, 0x50, 0x51, 0xdc, 0xf8, 0xfc, 0xe9, 0xba, 0x00,
-  0x57, 0x81, 0xd1, 0x14, 0x2b, 0x5a, 0xe0, 0x0e, 0xfe, 0xd6, 0x69, 0x2d,
-  0x7c, 0x7c, 0xe9, 0x9a, 0x4d, 0xe2, 0xfe, 0x6d, 0x1c, 0x56, 0x83, 0x75,
-  0x53, 0x91, 0x29, 0x7e, 0x1c, 0x7c, 0x5f, 0xe6, 0x56, 0x3a, 0xc1, 0x43,
-  0x72, 0x52, 0x06, 0x2b, 0xba, 0xa9, 0x7f, 0x23, 0x8b, 0x5b, 0x6e, 0x20,
-  0x5e, 0xb7, 0x80, 0x09, 0x25, 0xff, 0xd4, 0x00, 0x0d, 0xa3, 0x6e, 0x76,
-  0xde, 0xba, 0xcc, 0x27, 0x00, 0xcf, 0x19, 0xf2, 0xb7, 0x02, 0xa8, 0x57,
-  0xe8, 0x8b, 0xe6, 0xcf, 0xa5, 0xfe, 0xb1, 0x19, 0xa8, 0xbd, 0x13, 0x24,
-  0x85, 0xda, 0xc5, 0x08, 0xbb, 0xb7, 0x7c, 0x1d, 0x2c, 0xa0, 0x03, 0xb7,
-  0x9b, 0x00, 0x10, 0x30, 0x5f, 0x20, 0x81, 0xe2, 0xff, 0xf8, 0x0d, 0x24,
-  0xdf, 0x4b, 0x84, 0x89, 0x95, 0x97, 0x42, 0x61, 0x5e, 0x4c, 0x4c, 0x34,
-  0xd3, 0x76, 0x32, 0xf7, 0xc1, 0x2b, 0x19, 0x7b, 0x0a, 0xb0, 0x02, 0x07,
-  0x65, 0x04, 0x8d, 0x02, 0xc9, 0x86, 0x1e, 0x8e, 0xed, 0xb1, 0xf0, 0x22,
-  0x18, 0xf0, 0x0a, 0xc1, 0xb4, 0x3d, 0xf0, 0x97, 0x1a, 0x53, 0x5f, 0x0b,
-  0xae, 0x5a, 0x3f, 0x99, 0x2c, 0xbb, 0xa1, 0xf8, 0x0d, 0xa9, 0x77, 0x89,
-  0x87, 0x48, 0x34, 0x14, 0x3e, 0xaf, 0xcf, 0xfb, 0x2c, 0xdc, 0xb4, 0x64,
-  0x42, 0xe8, 0x72, 0x0d, 0xcb, 0x3d, 0x6a, 0xb7, 0x3f, 0x4f, 0x95, 0x00,
-  0x46, 0x42, 0x13, 0x5f, 0x91, 0x2a, 0x73, 0x58, 0x2e, 0x23, 0x95, 0x80,
-  0xf6, 0x59, 0x66, 0x98, 0xe2, 0xfe, 0xc4, 0x9b, 0xa9, 0x8b, 0xde, 0x06,
-  0x99, 0xff, 0xac, 0x3c, 0x1a, 0x74, 0x30, 0x3c, 0x0d, 0x6a, 0x19, 0x5f,
-  0xb7, 0xf3, 0xeb, 0x1f, 0xe2, 0xef, 0xef, 0x06, 0x53, 0xf9, 0x02, 0x4c,
-  0xd1, 0xfd, 0xec, 0x0c, 0x4c, 0x9d, 0x5b, 0x07, 0x1d, 0x50, 0xfd, 0xea,
-  0xaa, 0x3b, 0xfb, 0xb6, 0x0c, 0x92, 0x15, 0x9c, 0x8a, 0x23, 0x58, 0xfc,
-  0x1b, 0x58, 0x6f, 0x51, 0x0c, 0xf8, 0xb6, 0x97, 0x39, 0x81, 0x8f, 0xfc,
-  0x5b, 0x2b, 0xfb, 0x97, 0x24, 0x0b, 0x81, 0x1b, 0x6b, 0x3f, 0x97, 0x18,
-  0x0c, 0xd9, 0x8b, 0x08, 0x27, 0xf3, 0xfa, 0x49, 0x17, 0x89, 0x17, 0x5a,
-  0x8a, 0x0e, 0xa6, 0xaa, 0x1c, 0xd0, 0xe2, 0x6c, 0xa9, 0x44, 0xbb, 0x8c,
-  0x54, 0x07, 0x7e, 0x8c, 0x5c, 0x06, 0x8e, 0xc3, 0x33, 0xe5, 0xd7, 0xb4,
-  0x4a, 0xb0, 0x62, 0x8e, 0x46, 0x74, 0xb2, 0x62, 0x87, 0xd6, 0x9e, 0x3a,
-  0xf6, 0xb8, 0xfa, 0x58, 0x3b, 0x79, 0xb4, 0x2b, 0xf6, 0x8b, 0x0c, 0x02,
-  0xed, 0x54, 0x02, 0x20, 0x7b, 0x30, 0x14, 0xe4, 0x2d, 0x01, 0xe9, 0x57,
-  0xfc, 0x1e, 0xc3, 0xf8, 0xd7, 0x32, 0xc0, 0x98, 0xb2, 0x4b, 0xb1, 0x06,
-  0xe9, 0x8d, 0x75, 0xff, 0x71, 0x9e, 0x0b, 0x26, 0xbd, 0xe0, 0x2b, 0xf9,
-  0x06, 0x5c, 0xff, 0x87, 0xf7, 0x45, 0xdd, 0xd9, 0x74, 0x02, 0xa4, 0x3a,
-  0xd6, 0xf8, 0x03, 0x92, 0x95, 0x8a, 0x21, 0x6a, 0xa3, 0xd9, 0x44, 0xf4,
-  0xa4, 0x8a, 0xac, 0xbc, 0x22, 0x7f, 0x09, 0xac, 0x3a, 0xc3, 0x74, 0x1c,
-  0xa5, 0x22, 0xaa, 0xdd, 0x11, 0xad, 0x08, 0x14, 0x37, 0x08, 0x3a, 0xe3,
-  0xfe, 0x74, 0x0b, 0x22, 0xe4, 0x75, 0xef, 0x1f, 0x24, 0xf5, 0x7e, 0x07,
-  0x46, 0x8d, 0x44, 0xfe, 0xb6, 0x55, 0x1f, 0xc9, 0x7b, 0x4f, 0xdc, 0xf7,
-  0x66, 0x7a, 0xe4, 0x6e, 0x6f, 0x9e, 0xc0, 0x8e, 0xd8, 0x77, 0x8d, 0xf3,
-  0xa4, 0x1f, 0x59, 0x65, 0x4b, 0x3d, 0x55, 0x76, 0x52, 0x04, 0x3b, 0x2d,
-  0x60, 0x5a, 0xb0, 0xc4, 0x2e, 0x0b, 0x7b, 0xd0, 0xd9, 0x48, 0x5f, 0x47,
-  0x08, 0x55, 0x11, 0xb6, 0xd7, 0xcb, 0x49, 0xe5, 0x2b, 0xd9, 0xe6, 0xc7,
-  0x8e, 0xdf, 0x16, 0x3b, 0xb5, 0x4b, 0xbb, 0x11, 0xf3, 0xaa, 0x4f, 0x0b,
-  0x5d, 0x72, 0xfc, 0x59, 0x59, 0x23, 0xac, 0xbf, 0xd8, 0xba, 0x7a, 0x61,
-  0xe3, 0x24, 0x8b, 0xac, 0x82, 0x66, 0x1d, 0xff, 0x1c, 0xae, 0xe1, 0xf3,
-  0x3a, 0xc6, 0x72, 0x06, 0xff, 0x3a, 0xc2, 0x77, 0x02, 0x2c, 0x20, 0x3a,
-  0xde, 0xfd, 0x72, 0x07, 0x3a, 0xda, 0x77, 0x03, 0x0b, 0x8e, 0x20, 0x77,
-  0xd2, 0xda, 0x2b, 0xc3, 0x61, 0xf9, 0x8f, 0x78, 0xf1, 0x1e, 0xb8, 0x9c,
-  0x20, 0x2e, 0x65, 0x26, 0x23, 0x90, 0x56, 0x54, 0x3a, 0xea, 0xec, 0x10,
-  0x97, 0x00, 0x05, 0x81, 0x1e, 0xc6, 0x3d, 0xe0, 0x8a, 0xdc, 0x67, 0x82,
-  0x00, 0x42, 0x36, 0x20, 0x1d, 0xf5, 0x1b, 0x28, 0x98, 0xc2, 0xa9, 0x0c,
-  0x2f, 0xef, 0x6f, 0x8b, 0x12, 0xd8, 0x47, 0x01, 0x13, 0x1c, 0x5b, 0x9c,
-  0x02, 0x81, 0xce, 0x47, 0x0b, 0xa7, 0x7b, 0x2d, 0x74, 0x15, 0x06, 0xd1,
-  0xb0, 0x56, 0x0e, 0x19, 0x3f, 0x80, 0x61, 0x5a, 0xbb, 0xe9, 0x28, 0xc4,
-  0x32, 0x19, 0x03, 0x25, 0x35, 0x59, 0x53, 0x9d, 0x46, 0x04, 0x81, 0x13,
-  0xe3, 0x3f, 0xc7, 0x90, 0x62, 0x20, 0x2e, 0x6c, 0xb6, 0x96, 0xb5, 0x46,
-  0xda, 0x05, 0x98, 0x50, 0xf3, 0x1b, 0x44, 0x9f, 0x2f, 0x36, 0x90, 0x20,
-  0x6e, 0x03, 0x8e, 0x20, 0x08, 0xc9, 0xa9, 0xbe, 0xa3, 0x14, 0x94, 0x69,
-  0x92, 0x27, 0xe9, 0xf1, 0x15, 0x28, 0xcc, 0x86, 0xd3, 0x65, 0x19, 0xe4,
-  0x44, 0x27, 0x45, 0x4c, 0x28, 0xcd, 0xf0, 0x92, 0x48, 0x02, 0xcf, 0xfa,
-  0xc4, 0x1e, 0x68, 0x0b, 0x27, 0x10, 0x57, 0x20, 0x00, 0xf8, 0x94, 0xfe,
-  0x5c, 0x2d, 0x1d, 0x22, 0xe2, 0x12, 0x27, 0x7b, 0x5b, 0x0c, 0xa3, 0x8e,
-  0x76, 0x89, 0x16, 0x8c, 0xbd, 0x9c, 0xb0, 0x1a, 0xbe, 0x4b, 0x3d, 0x7c,
-  0x63, 0xcf, 0x00, 0x60, 0xdf, 0xf7, 0x0c, 0x74, 0x6b, 0x3e, 0x6f, 0x03,
-  0xc6, 0x3d, 0x08, 0x51, 0x6d, 0x24, 0xe1, 0x72, 0x63, 0xc4, 0x3b, 0xe4,
-  0x40, 0x26, 0x4f, 0x46, 0x40, 0x42, 0x6f, 0x3b, 0x9e, 0x64, 0x40, 0xb2,
-  0xbb, 0x59, 0xa1, 0x32, 0x92, 0x61, 0x1a, 0x3e, 0xeb, 0x0d, 0x46, 0xa9,
-  0x10, 0xe0, 0x38, 0x1b, 0xbc, 0x78, 0xff, 0x00, 0x61, 0x14, 0xaa, 0x60,
-  0xd0, 0x28, 0xb8, 0xad, 0x38, 0x17, 0xb8, 0x45, 0x3b, 0xa9, 0xbe, 0x91,
-  0x84, 0x49, 0xf7, 0xe0, 0x01, 0x4e, 0x96, 0x95, 0x00, 0x0e, 0xab, 0x10,
-  0x6a, 0x9a, 0x47, 0xe4, 0x39, 0xb7, 0x52, 0x00, 0xfb, 0x76, 0xf2, 0xeb,
-  0x21, 0x31, 0xbb, 0x03, 0x72, 0x0b, 0x28, 0x24, 0x47, 0x20, 0x2f, 0x05,
-  0x82, 0x4b, 0x39, 0x63, 0xa2, 0x21, 0x2d, 0x8f, 0x77, 0x20, 0x04, 0x72,
-  0x7b, 0xbf, 0x74, 0x07, 0x0a, 0x77, 0xec, 0x73, 0x75, 0x6c, 0x3d, 0x5b,
-  0x0c, 0x04, 0xef, 0x10, 0x7e, 0x0f, 0x1a, 0xff, 0x75, 0x09, 0x8b, 0x8f,
-  0x72, 0x20, 0x83, 0xc1, 0xad, 0x07, 0x11, 0x6b, 0x08, 0x30, 0x41, 0xdf,
-  0x96, 0x81, 0xc3, 0xb2, 0x07, 0xf6, 0x81, 0xc3, 0x62, 0x77, 0x01, 0x49,
-  0x0c, 0x76, 0x43, 0xd1, 0xfb, 0x01, 0xe2, 0x03, 0xd9, 0x2d, 0x66, 0xea,
-  0xf7, 0x66, 0x04, 0xdc, 0x37, 0x05, 0x04, 0x0c, 0xbe, 0x0a, 0xd1, 0xa3,
-  0x6f, 0x82, 0x2b, 0xca, 0x8b, 0x67, 0x5b, 0x75, 0xff, 0x0e, 0x3b, 0xc1,
-  0x77, 0x16, 0x75, 0x19, 0x80, 0x1a, 0xe4, 0x2d, 0xce, 0xed, 0x13, 0xeb,
-  0x0c, 0x0d, 0xf3, 0x72, 0x08, 0x75, 0x0b, 0x62, 0x01, 0x77, 0xc3, 0x14,
-  0x43, 0x3b, 0x21, 0x86, 0x55, 0x8c, 0x41, 0x41, 0x85, 0xe5, 0x71, 0xf6,
-  0xd0, 0x8a, 0xc6, 0xdf, 0x97, 0x8a, 0xc2, 0xd4, 0x10, 0x86, 0xb9, 0xe0,
-  0x08, 0xbf, 0x04, 0x04, 0x90, 0x27, 0x14, 0x40, 0xe0, 0x27, 0xaa, 0xc3,
-  0x9e, 0xb7, 0x96, 0x56, 0xf8, 0xca, 0xee, 0xdc, 0x04, 0xec, 0x50, 0xd0,
-  0xea, 0xda, 0x02, 0x4a, 0x57, 0x64, 0x96, 0xaa, 0x82, 0x47, 0xf4, 0x5f,
-  0xc3, 0x42, 0x0a, 0xff, 0x05, 0x47, 0xfe, 0x4e, 0xec, 0x75, 0x33, 0xeb,
-  0x53, 0x51, 0x52, 0x53, 0x78, 0x86, 0x6a, 0xff, 0x96, 0xaa, 0x16, 0xf0,
-  0x06, 0x68, 0x5e, 0x10, 0x91, 0x70, 0x56, 0x0e, 0x43, 0xa9, 0x3a, 0x3a,
-  0x01, 0xcf, 0x44, 0x01, 0x7e, 0xed, 0xee, 0x8d, 0xbe, 0x1f, 0xc6, 0x07,
-  0x5a, 0x13, 0xf7, 0xc3, 0x06, 0xfc, 0x0a, 0xab, 0x2c, 0xad, 0x8b, 0x02,
-  0x5f, 0xb2, 0xac, 0x4d, 0x96, 0x12, 0x52, 0x4c, 0xad, 0x56, 0x60, 0x55,
-  0xfa, 0x7f, 0xed, 0xe8, 0xa7, 0xdf, 0xf0, 0xe8, 0xe9, 0xfa, 0x03, 0xed,
-  0x89, 0x76, 0xf0, 0x1d, 0x75, 0x19, 0xe6, 0xda, 0x2c, 0x33, 0xc9, 0x96,
-  0x5e, 0xf2, 0x26, 0x02, 0x1b, 0x45, 0x88, 0xdb, 0x4e, 0xf5, 0x07, 0xf8,
-  0x6a, 0x8d, 0x98, 0x73, 0x03, 0xb0, 0x34, 0x21, 0x5b, 0xdc, 0x8b, 0x8d,
-  0xd0, 0x13, 0x4c, 0xc3, 0x85, 0xdb, 0xfc, 0x60, 0x73, 0x13, 0x8a, 0x9f,
-  0xaf, 0x2f, 0x59, 0xfb, 0x17, 0x76, 0x0b, 0xe2, 0xa5, 0x85, 0x03, 0x73,
-  0x12, 0x3f, 0xfd, 0xa7, 0xbd, 0x33, 0xe9, 0x9b, 0x2f, 0xe1, 0xfd, 0x00,
-  0x77, 0xc0, 0xf8, 0x83, 0xbd, 0xff, 0x01, 0xeb, 0xcf, 0xf3, 0x0a, 0xed,
-  0x73, 0x02, 0xeb, 0xc4, 0xc2, 0xe2, 0x35, 0xd2, 0xf5, 0x73, 0xff, 0x03,
-  0x88, 0x56, 0xf5, 0xeb, 0xb4, 0x83, 0xe1, 0x66, 0xfe, 0xdf, 0x22, 0x5d,
-  0x1b, 0x20, 0xf7, 0xb5, 0x05, 0xeb, 0xa6, 0x1d, 0xed, 0x4d, 0xf7, 0x72,
-  0x4d, 0x5c, 0x29, 0x76, 0x13, 0x08, 0xb5, 0xdf, 0x3c, 0x92, 0xe9, 0x50,
-  0x03, 0x14, 0x6f, 0xb8, 0x36, 0x8b, 0x05, 0x85, 0x83, 0xfc, 0xb7, 0x02,
-  0x20, 0x02, 0x73, 0xb6, 0x12, 0xe8, 0x79, 0xa3, 0xc7, 0x5f, 0x4f, 0x89,
-  0x6d, 0x95, 0xb5, 0xbb, 0x75, 0x6e, 0xff, 0x16, 0x42, 0x9f, 0xdb, 0xd7,
-  0x0c, 0xf6, 0xf3, 0xfe, 0xc5, 0xe9, 0x61, 0xfd, 0x73, 0xca, 0xb5, 0x04,
-  0xff, 0xbf, 0x0e, 0xe9, 0x54, 0xff, 0x92, 0x2c, 0xdd, 0x30, 0x98, 0x34,
-  0x77, 0xf8, 0x19, 0xb5, 0x02, 0x87, 0x46, 0x9e, 0xba, 0xd1, 0x22, 0x58,
-  0x32, 0xd0, 0xa6, 0x7c, 0xed, 0x03, 0xc2, 0x01, 0x10, 0xd8, 0xe9, 0x32,
-  0x3b, 0xdb, 0x9b, 0x1b, 0xf6, 0x2e, 0x74, 0xb5, 0x40, 0xdb, 0x3d, 0x16,
-  0xbb, 0xff, 0x63, 0x10, 0xe9, 0xed, 0x65, 0xff, 0x81, 0x06, 0x0a, 0x4f,
-  0xef, 0xa9, 0xef, 0xe9, 0x59, 0xff, 0x89, 0xb7, 0xc7, 0xb7, 0xb7, 0x0a,
-  0x03, 0x7d, 0x10, 0xb3, 0xe9, 0x02, 0xda, 0x5d, 0x89, 0x00, 0x6c, 0xc7,
-  0xfb, 0x6b, 0x2c, 0x04, 0x6c, 0xfa, 0xa5, 0xf6, 0xeb, 0x10, 0x1d, 0xb7,
-  0x15, 0xfa, 0x01, 0x33, 0x10, 0x3e, 0x99, 0x47, 0x47, 0x16, 0x55, 0x06,
-  0xea, 0xd4, 0x10, 0x2d, 0xd2, 0x6d, 0x0f, 0x15, 0xcd, 0x0e, 0x17, 0xe1,
-  0x8d, 0x7e, 0xbb, 0xae, 0xbe, 0x2f, 0x0b, 0xd2, 0x75, 0x2b, 0x28, 0xe6,
-  0x28, 0xed, 0x86, 0x99, 0x02, 0x3b, 0xfe, 0xf8, 0xe3, 0x1a, 0x83, 0xf9,
-  0xff, 0xb4, 0x94, 0x4d, 0x3a, 0x25, 0x8b, 0x08, 0xd2, 0xb0, 0xb2, 0x30,
-  0xb8, 0x6c, 0xb2, 0x20, 0xdf, 0x34, 0xe8, 0x00, 0xfe, 0xe2, 0xc0, 0xf9,
-  0xe9, 0xae, 0xe9, 0x8e, 0x8b, 0x04, 0x54, 0x7e, 0x16, 0x57, 0x8a, 0xc7,
-  0x98, 0x0b, 0x37, 0x7f, 0xfa, 0x50, 0x53, 0xe8, 0x8e, 0xf4, 0xa3, 0x16,
-  0xff, 0x9b, 0xbb, 0xd2, 0x5b, 0xc5, 0xe9, 0xf7, 0xf4, 0x00, 0xe9, 0xff,
-  0x8c, 0xb9, 0x6d, 0xb1, 0x5e, 0xba, 0xdf, 0xd4, 0x36, 0xff, 0x37, 0x43,
-  0x43, 0xb5, 0x89, 0x07, 0xd2, 0x7b, 0x20, 0xcb, 0x10, 0x17, 0x62, 0x0e,
-  0xd1, 0x31, 0xbe, 0x90, 0xfd, 0xb0, 0x3a, 0xaa, 0xdf, 0x07, 0x5a, 0xe8,
-  0x68, 0xfd, 0xa9, 0x36, 0x88, 0x6e, 0x00, 0xaf, 0xba, 0x00, 0xde, 0xfb,
-  0xa5, 0x67, 0x83, 0xba, 0xa1, 0x77, 0x87, 0xcf, 0x50, 0x75, 0x3b, 0xd1,
-  0x7f, 0x68, 0xb5, 0x37, 0x9e, 0xa1, 0x00, 0x73, 0x4c, 0xc9, 0x24, 0x3b,
-  0x80, 0x34, 0x5c, 0xba, 0x17, 0xfe, 0x36, 0x89, 0xc5, 0x05, 0xb9, 0x1b,
-  0x55, 0xbc, 0x65, 0x1f, 0xbd, 0x64, 0x16, 0xea, 0xb6, 0x26, 0x3d, 0x7e,
-  0x1e, 0x07, 0x0b, 0x37, 0x28, 0x0b, 0x36, 0xbe, 0xc4, 0x0c, 0x04, 0x03,
-  0xc6, 0x86, 0x9a, 0xb7, 0x12, 0xbf, 0xa8, 0xfe, 0x20, 0xe8, 0x29, 0xfd,
-  0x3b, 0x4e, 0xf6, 0x35, 0x29, 0xa1, 0xeb, 0x5e, 0x6c, 0x7f, 0x3c, 0xb7,
-  0x0e, 0x2b, 0x1a, 0xb4, 0x03, 0xb9, 0xad, 0xfa, 0xdc, 0x8d, 0x51, 0xd7,
-  0xf4, 0x5e, 0xbb, 0x53, 0x52, 0xd6, 0x53, 0x23, 0x52, 0x8a, 0x9a, 0xef,
-  0xa9, 0x14, 0x7b, 0x4b, 0x09, 0xb8, 0x0a, 0x0f, 0xe0, 0x4a, 0xb7, 0x77,
-  0x07, 0x05, 0x50, 0x08, 0x4e, 0x9a, 0xa5, 0xf8, 0x62, 0x8b, 0xe0, 0x77,
-  0xd0, 0x2a, 0x18, 0xb2, 0x04, 0xf8, 0xfa, 0x7e, 0x11, 0xe8, 0xc9, 0xed,
-  0x6d, 0x3d, 0x2d, 0x6a, 0x47, 0x37, 0xcc, 0xd1, 0x7e, 0x1b, 0xcd, 0x56,
-  0x85, 0xf2, 0x26, 0x8f, 0xf5, 0xec, 0x7a, 0x14, 0xb7, 0x74, 0x83, 0x6e,
-  0x8a, 0xf2, 0xdf, 0x94, 0xf2, 0x00, 0x4f, 0x26, 0x1b, 0xf7, 0xe8, 0x85,
-  0x9f, 0x70, 0x87, 0xf7, 0x75, 0xf7, 0x5e, 0xf8, 0xb8, 0x05, 0x6a, 0xdb,
-  0x3d, 0x05, 0x75, 0x1b, 0xca, 0x66, 0xf6, 0xfb, 0x80, 0xfc, 0x6f, 0xc6,
-  0x85, 0x94, 0x6d, 0x25, 0x7f, 0x33, 0x4d, 0x2f, 0x45, 0x6b, 0xa1, 0x11,
-  0x61, 0x78, 0xb9, 0x5b, 0x04, 0x58, 0xc3, 0x75, 0x11, 0x80, 0x77, 0x40,
-  0x4b, 0x4b, 0x46, 0x6f, 0x02, 0x7d, 0x1c, 0x4b, 0xa5, 0x03, 0x4a, 0x21,
-  0x33, 0xae, 0x8b, 0x0c, 0x2f, 0x6d, 0xb0, 0xdd, 0xfe, 0x58, 0xfc, 0x4b,
-  0x3b, 0xd9, 0x7f, 0xf6, 0xe9, 0x93, 0x40, 0x7e, 0x0b, 0xb0, 0x30, 0xe8,
-  0x47, 0x2e, 0xcc, 0xf6, 0xfb, 0xe8, 0x41, 0xfc, 0x9e, 0xcd, 0xf2, 0x27,
-  0x5b, 0x4d, 0x2b, 0x81, 0xda, 0x50, 0x76, 0x04, 0x3c, 0x8b, 0xfb, 0x08,
-  0x3c, 0x20, 0x74, 0x07, 0x68, 0x2b, 0xd4, 0xdd, 0xbf, 0x4c, 0xe8, 0x22,
-  0xfc, 0x49, 0x4b, 0xf7, 0x87, 0xca, 0xe3, 0x07, 0x2f, 0x61, 0x17, 0xfc,
-  0xe8, 0x5d, 0x0a, 0x12, 0x12, 0x71, 0xb5, 0x17, 0x21, 0x9c, 0xf6, 0x03,
-  0xe8, 0x0a, 0x15, 0xfa, 0xf0, 0x0b, 0xdb, 0x7e, 0xdb, 0xc2, 0xcb, 0x63,
-  0xb1, 0xf4, 0xfb, 0xd8, 0x0b, 0x38, 0xfc, 0x60, 0x3b, 0x93, 0x75, 0x0b,
-  0x24, 0x85, 0x1f, 0x08, 0x73, 0x28, 0xea, 0xe2, 0x2a, 0xda, 0x06, 0x03,
-  0xd8, 0x53, 0x26, 0x51, 0xa9, 0x9c, 0x7b, 0x07, 0x6e, 0x78, 0x26, 0xc7,
-  0xd0, 0xe3, 0xb0, 0xb4, 0xf9, 0xa9, 0x71, 0xe5, 0x6b, 0x8e, 0xd5, 0x5d,
-  0xfc, 0xb0, 0xf5, 0x25, 0xe8, 0xa5, 0xfb, 0xfa, 0x0e, 0x75, 0xf7, 0x55,
-  0x93, 0xa1, 0x34, 0x81, 0x42, 0x15, 0xed, 0xfb, 0x07, 0xfb, 0xaa, 0xea,
-  0x41, 0x7c, 0xb4, 0x8b, 0x3f, 0x02, 0x57, 0x20, 0x5f, 0xf8, 0x04, 0x30,
-  0xee, 0x2f, 0xfd, 0x39, 0x30, 0xf9, 0x2f, 0x67, 0x30, 0x0a, 0xc4, 0x37,
-  0x97, 0xb9, 0x30, 0xff, 0xbe, 0x30, 0x22, 0x30, 0xe7, 0x30, 0xc5, 0x30,
-  0xff, 0xc9, 0x30, 0xcd, 0x30, 0x64, 0x31, 0x11, 0x32, 0xfe, 0xb4, 0x31,
-  0xd4, 0x31, 0x4d, 0x33, 0x89, 0xc7, 0x01, 0x14, 0x30, 0xd7, 0x1a, 0x30,
-  0xd7, 0x23, 0x0e, 0x2e, 0x08, 0x37, 0xd3, 0xb8, 0x02, 0x45, 0x95, 0xc0,
-  0xa1, 0xaf, 0x64, 0x40, 0x27, 0x0f, 0x50, 0x42, 0xd9, 0x5e, 0x10, 0x58,
-  0x07, 0x3a, 0xcb, 0x36, 0xf1, 0x00, 0x60, 0x00, 0x0f, 0x2e, 0x3b, 0x16,
-  0xff, 0x40, 0x34, 0x74, 0x37, 0x8e, 0xda, 0x8e, 0x1e, 0xaa, 0x02, 0x56,
-  0x7c, 0x03, 0xbb, 0xe0, 0x2e, 0x8c, 0xfe, 0x1e, 0x42, 0x34, 0xeb, 0x38,
-  0x8c, 0xd8, 0xd9, 0x1c, 0x06, 0xbb, 0x15, 0xa1, 0x08, 0x26, 0x6d, 0xa3,
-  0x11, 0xab, 0x1e, 0x03, 0xe8, 0xa1, 0x8e, 0x87, 0xb7, 0x46, 0x1d, 0x23,
-  0x2e, 0xbb, 0x8b, 0x38, 0x2e, 0xc7, 0x73, 0x20, 0x44, 0x9b, 0x06, 0x42,
-  0x27, 0x44, 0x3b, 0x20, 0xef, 0x52, 0x2c, 0xfb, 0xd8, 0xd8, 0x58, 0x58,
-  0xc3, 0x5a, 0x44, 0xb6, 0x6d, 0x06, 0x57, 0xb6, 0x1b, 0x02, 0xee, 0x72,
-  0x8c, 0x06, 0x08, 0x41, 0xd8, 0x2e, 0x26, 0x6d, 0xed, 0x75, 0x26, 0x51,
-  0xc0, 0x00, 0x5b, 0xbb, 0x4a, 0x01, 0x06, 0x1c, 0xbe, 0xc1, 0x03, 0xd0,
-  0x8e, 0xc2, 0xc1, 0x17, 0x10, 0xb4, 0x26, 0x0e, 0x1b, 0xd6, 0x0a, 0x72,
-  0x06, 0x06, 0xf4, 0xf1, 0xe8, 0x51, 0x00, 0x07, 0xbb, 0xff, 0x26, 0x03,
-  0x26, 0x90, 0xac, 0x8a, 0xa7, 0xf7, 0x01, 0xc3, 0x3a, 0x33, 0x38, 0xfb,
-  0xc0, 0x8c, 0xdb, 0x03, 0x1e, 0x19, 0xb9, 0xc3, 0x26, 0xa3, 0x5b, 0x0b,
-  0x3b, 0xd5, 0x1e, 0x06, 0xcd, 0x15, 0x75, 0x6b, 0x05, 0x8a, 0x6e, 0x04,
-  0x73, 0x6a, 0x07, 0x35, 0xa0, 0xce, 0x08, 0xd7, 0x6f, 0x9f, 0x8e, 0xdb,
-  0xc3, 0x60, 0xa7, 0xb6, 0x07, 0xa1, 0xd5, 0x06, 0xdf, 0xad, 0x20, 0x8c,
-  0xd3, 0xfa, 0x8e, 0xdf, 0xd0, 0x36, 0x2e, 0x36, 0xbb, 0x8c, 0x39, 0x8c,
-  0x16, 0x6f, 0x2a, 0x8e, 0xd3, 0xfb, 0x62, 0x32, 0xfb, 0x3b, 0xc3, 0x37,
-  0x17, 0x0d, 0xbd, 0x1d, 0x56, 0xc9, 0x2e, 0x12, 0x68, 0xe3, 0xd9, 0x8c,
-  0x08, 0x77, 0x74, 0x0f, 0xcf, 0x35, 0xfd, 0x2f, 0x97, 0xe8, 0xb3, 0xfe,
-  0x76, 0xa6, 0x10, 0xff, 0xc5, 0xfe, 0x0f, 0x8c, 0x50, 0x62, 0x09, 0x18,
-  0x07, 0x2f, 0x08, 0x0e, 0xd8, 0x5b, 0xea, 0x5b, 0x25, 0x0f, 0xe8, 0xa3,
-  0xba, 0xdd, 0x40, 0x2b, 0xd0, 0xac, 0x12, 0x19, 0x42, 0xc1, 0xf6, 0xe8,
-  0xf6, 0xd7, 0x17, 0xc2, 0x58, 0xce, 0xf5, 0xdb, 0x8a, 0xdc, 0x02, 0x68,
-  0xf6, 0xeb, 0xd3, 0xe0, 0x17, 0x2a, 0x6b, 0x2f, 0xde, 0x17, 0xa0, 0x5b,
-  0x15, 0x94, 0x2e, 0x8f, 0x2e, 0x89, 0x1e, 0x66, 0x89, 0xe0, 0x61, 0xb7,
-  0x47, 0x89, 0xe2, 0x36, 0x09, 0x02, 0x2f, 0xef, 0x97, 0xc3, 0x99, 0xc3,
-  0x60, 0x38, 0x0c, 0xa5, 0x97, 0x8b, 0xc8, 0x0e, 0x42, 0x4c, 0x0e, 0x97,
-  0x8b, 0xc3, 0xda, 0x29, 0x35, 0x75, 0x03, 0x16, 0x00, 0x07, 0x36, 0x3a,
-  0x1a, 0x1e, 0x56, 0x12, 0x84, 0x40, 0x6c, 0xdb, 0x5f, 0x37, 0xe5, 0x0d,
-  0x63, 0x47, 0x99, 0x6e, 0xeb, 0x09, 0x09, 0x46, 0xa4, 0x6c, 0xf5, 0x3f,
-  0xc8, 0x0b, 0xca, 0x74, 0xe3, 0x5e, 0x05, 0x13, 0x2d, 0x68, 0xd2, 0x37,
-  0x91, 0xf7, 0xc2, 0xf7, 0xf0, 0xff, 0x75, 0x3b, 0x84, 0x7c, 0xe8, 0xd3,
-  0xe2, 0x0a, 0xe2, 0x62, 0x14, 0x1a, 0x13, 0x20, 0xe9, 0x08, 0x44, 0xed,
-  0x12, 0x57, 0x6d, 0x62, 0x39, 0xdb, 0x6c, 0x73, 0x1c, 0x11, 0x5b, 0x06,
-  0x3b, 0xe9, 0xd3, 0x75, 0xf0, 0xcb, 0x52, 0x10, 0xf0, 0x1f, 0xe8, 0xe1,
-  0xbd, 0x2c, 0x1a, 0xe8, 0x76, 0xb7, 0x09, 0x15, 0x8f, 0x01, 0xea, 0x7d,
-  0x77, 0xf4, 0xe8, 0x48, 0x5b, 0xdb, 0x1e, 0xbd, 0x08, 0x8a, 0xe1, 0x7e,
-  0x43, 0x26, 0x53, 0xdf, 0x48, 0x36, 0x48, 0x34, 0x56, 0x76, 0x05, 0x4a,
-  0x34, 0x02, 0xdd, 0xba, 0x72, 0xff, 0xa0, 0xdd, 0x65, 0xeb, 0x6a, 0xac,
-  0x34, 0xee, 0x6e, 0x28, 0x06, 0x1e, 0x8d, 0x4c, 0x77, 0xc2, 0xfc, 0x4a,
-  0xbf, 0x6a, 0x30, 0xd5, 0x82, 0xca, 0xf3, 0xd7, 0x04, 0x71, 0x46, 0x37,
-  0x0c, 0xe3, 0x40, 0x8e, 0x0f, 0x6d, 0xd8, 0x04, 0xeb, 0xd8, 0x33, 0xff,
-  0x99, 0xba, 0xca, 0x81, 0xf9, 0x50, 0x02, 0x2d, 0x28, 0xb9, 0xbb, 0x04,
-  0xd1, 0xe1, 0x01, 0xdb, 0x24, 0x81, 0xba, 0xea, 0x10, 0x10, 0xdb, 0x26,
-  0x05, 0x06, 0x5e, 0x28, 0xf8, 0x06, 0xd8, 0x56, 0x42, 0x72, 0x2d, 0x61,
-  0xed, 0x20, 0xfe, 0x5a, 0x00, 0x0e, 0x00, 0x16, 0xd5, 0x1e, 0x5e, 0x74,
-  0x44, 0x8b, 0x88, 0x5f, 0x64, 0x8e, 0xc7, 0x8b, 0xf1, 0xc6, 0x2b, 0xf0,
-  0x88, 0xc7, 0x36, 0x6e, 0x3f, 0xa0, 0x06, 0x50, 0x1e, 0x68, 0x37, 0xaf,
-  0x8b, 0xd3, 0xc8, 0x03, 0xd1, 0x73, 0x74, 0x44, 0x3e, 0x4c, 0x6f, 0xe6,
-  0x06, 0xc6, 0xed, 0x8b, 0xf3, 0x49, 0xcb, 0xd6, 0xfd, 0x8b, 0xbe, 0xd6,
-  0x4a, 0x53, 0xcf, 0x2e, 0x03, 0xd8, 0xa7, 0x53, 0x14, 0xd9, 0xc3, 0xd5,
-  0x61, 0x84, 0x62, 0xd6, 0xee, 0x84, 0x5f, 0x65, 0x0c, 0x10, 0xc1, 0xe7,
-  0x62, 0x30, 0xed, 0xb6, 0xf4, 0x4a, 0x72, 0xd5, 0xf2, 0xb8, 0xac, 0x74,
-  0x32, 0x46, 0x6f, 0x34, 0x4c, 0x21, 0x67, 0xb8, 0x50, 0x2b, 0xde, 0x51,
-  0x7f, 0x3b, 0xc8, 0x72, 0x0e, 0x77, 0x07, 0x6b, 0x86, 0x4d, 0xbc, 0xeb,
-  0x1d, 0xe8, 0x4c, 0x2f, 0x57, 0x18, 0xe8, 0xcd, 0x2d, 0x13, 0x11, 0xd6,
-  0xb1, 0x48, 0x07, 0xe6, 0x09, 0x53, 0xc3, 0x50, 0xfd, 0x60, 0x61, 0x5f,
-  0x5f, 0x50, 0x27, 0x56, 0x96, 0xc1, 0x92, 0x85, 0x0b, 0x83, 0xf7, 0xea,
-  0xe3, 0xe3, 0x05, 0xdf, 0xa8, 0xe6, 0x03, 0xc1, 0x96, 0x6f, 0x09, 0x03,
-  0xd6, 0x5e, 0xf1, 0xcb, 0x59, 0x0e, 0x51, 0x6e, 0xa6, 0xeb, 0x16, 0xe0,
-  0x06, 0x76, 0x8e, 0xeb, 0x0e, 0xf9, 0x07, 0x02, 0x67, 0x06, 0x46, 0x24,
-  0xda, 0x55, 0x96, 0xeb, 0xa3, 0xf9, 0xa2, 0xdd, 0xa8, 0x5e, 0x11, 0x8c,
-  0x80, 0x75, 0x7d, 0xfb, 0x69, 0xd0, 0xa0, 0x65, 0x5d, 0xf8, 0x75, 0xb7,
-  0x1c, 0x0d, 0x79, 0x0a, 0x41, 0x9f, 0x13, 0x83, 0xcf, 0x0c, 0x6b, 0x1f,
-  0x0d, 0x44, 0x6c, 0x95, 0xdb, 0xb8, 0x83, 0xf7, 0x37, 0x96, 0xe9, 0xb9,
-  0x02, 0x5d, 0x8a, 0x17, 0x00, 0x33, 0xf6, 0x17, 0x14, 0x7f, 0xd2, 0xd1,
-  0xd6, 0xd1, 0xd7, 0x3b, 0xfd, 0x46, 0x84, 0xff, 0x77, 0x04, 0x3b, 0xf3,
-  0x72, 0x05, 0x2b, 0xff, 0xf3, 0x1b, 0xfd, 0x40, 0xe2, 0xe7, 0x5b, 0xf7,
-  0xa8, 0xc3, 0x3b, 0xab, 0x8b, 0xc6, 0xf6, 0x8b, 0xd7, 0xd1, 0xeb, 0x0b,
-  0xc3, 0x04, 0x50, 0x30, 0x4d, 0x5d, 0xb5, 0xca, 0xa3, 0x08, 0x41, 0x9a,
-  0x66, 0xec, 0x20, 0x01, 0x92, 0x37, 0x32, 0xed, 0x5b, 0x0e, 0xfd, 0x53,
-  0x80, 0xf9, 0x10, 0x73, 0x10, 0x0a, 0x3a, 0x34, 0xf9, 0x2f, 0x0e, 0xf6,
-  0xd9, 0x80, 0xd2, 0xc1, 0x10, 0x04, 0xfe, 0x0b, 0xd3, 0xcb, 0x80, 0xe9,
-  0x10, 0xdb, 0x1f, 0xc0, 0x11, 0x6c, 0xcb, 0x20, 0x98, 0xda, 0x6b, 0x2f,
-  0xea, 0x20, 0x3e, 0xe3, 0x0b, 0xc3, 0x4e, 0xd2, 0xdf, 0x13, 0xcb, 0x07,
-  0x0e, 0x06, 0x13, 0x28, 0x74, 0x0c, 0xf7, 0xd3, 0x6e, 0x14, 0x83, 0xc3,
-  0x0d, 0xcb, 0xb6, 0xd1, 0xeb, 0x2f, 0x8d, 0xad, 0xd5, 0x73, 0x04, 0x6f,
-  0xca, 0x10, 0x8a, 0xe9, 0x0b, 0x65, 0xd2, 0xf6, 0xe5, 0x02, 0xf5, 0x8a,
-  0x39, 0xd6, 0xe8, 0x8f, 0xe9, 0x8a, 0xc5, 0xb7, 0x98, 0x2e, 0x03, 0xd1,
-  0x9e, 0x2b, 0xea, 0x69, 0xf9, 0xbe, 0xe7, 0x32, 0xdb, 0x2b, 0xd3, 0xc8,
-  0x30, 0x45, 0x60, 0xc2, 0x88, 0xf0, 0xca, 0x1d, 0xa1, 0x13, 0x80, 0xc9,
-  0xd6, 0x3f, 0xcd, 0x61, 0x85, 0x02, 0xf6, 0xc3, 0x51, 0x42, 0x87, 0xe1,
-  0x7e, 0x44, 0x8a, 0xe3, 0xde, 0xd1, 0x59, 0x03, 0xcb, 0x95, 0xdf, 0xdc,
-  0x4d, 0x83, 0xe3, 0x0f, 0x5a, 0x47, 0x37, 0xf4, 0x3b, 0xc3, 0xf8, 0xc3,
-  0xff, 0x26, 0x24, 0x21, 0x5f, 0xf6, 0x8f, 0x06, 0x16, 0x21, 0x6c, 0x03,
-  0x18, 0xd8, 0x1a, 0x21, 0xec, 0x2f, 0xfe, 0x39, 0x6e, 0x99, 0x1c, 0x21,
-  0x37, 0x76, 0x1e, 0x21, 0xc5, 0xfc, 0x8e, 0x5b, 0xd0, 0xbe, 0xc5, 0x80,
-  0x00, 0x2f, 0x33, 0xac, 0x40, 0x8c, 0xf4, 0xc5, 0x87, 0xd6, 0x93, 0xbe,
-  0x37, 0x73, 0x00, 0x46, 0x46, 0x1b, 0xd3, 0x80, 0x3e, 0x8d, 0x7b, 0x80,
-  0xdb, 0x72, 0x11, 0x20, 0x75, 0x1b, 0x9c, 0xfe, 0xd4, 0xb1, 0x7f, 0xff,
-  0x0f, 0xe3, 0x6e, 0x80, 0xf1, 0x7f, 0x06, 0x28, 0xdb, 0xc1, 0xf8, 0x40,
-  0xd2, 0x25, 0xfe, 0x2a, 0xd4, 0xfc, 0xbf, 0x09, 0x72, 0x5c, 0x8b, 0xe7,
-  0x06, 0x8b, 0x1f, 0x0e, 0x76, 0x51, 0x49, 0xa9, 0xb7, 0x21, 0xaa, 0x8e,
-  0xfd, 0xdd, 0x87, 0xf2, 0x87, 0xd9, 0x8b, 0x6f, 0x2e, 0xd0, 0x43, 0xe8,
-  0xc6, 0x19, 0x00, 0x68, 0xfb, 0x72, 0x42, 0xe8, 0x12, 0x06, 0x62, 0xf9,
-  0x61, 0x71, 0x2c, 0x75, 0x0d, 0xdd, 0x09, 0x75, 0xe8, 0xb8, 0x25, 0xeb,
-  0xe4, 0x1b, 0x42, 0x07, 0x42, 0x83, 0xaa, 0xfb, 0xb5, 0x01, 0x43, 0x2b,
-  0x8e, 0x10, 0x7f, 0xf9, 0xe3, 0x15, 0xac, 0x49, 0x2c, 0x81, 0x22, 0x17,
-  0x7c, 0x04, 0x22, 0x3c, 0x5c, 0x0b, 0xc6, 0x80, 0xda, 0x3c, 0x22, 0xba,
-  0xda, 0x10, 0x0b, 0xb6, 0x22, 0xea, 0xa2, 0xe6, 0x4c, 0xd3, 0xc7, 0xca,
-  0x8b, 0x3b, 0xb2, 0x1e, 0x10, 0xf6, 0x21, 0x43, 0x03, 0xdb, 0x01, 0xe1,
-  0x8b, 0xf4, 0x27, 0x7c, 0x2b, 0xeb, 0x72, 0xe2, 0x4b, 0x1d, 0x89, 0xe0,
-  0x2e, 0x12, 0x21, 0x5f, 0x7b, 0x14, 0x21, 0xe3, 0x11, 0x42, 0x2c, 0xfe,
-  0x00, 0x8c, 0x56, 0x02, 0x83, 0xc5, 0x51, 0x37, 0x52, 0xe0, 0xfa, 0x74,
-  0x85, 0xed, 0xd4, 0x46, 0x94, 0x88, 0xdb, 0x91, 0x02, 0x3a, 0x1b, 0x8b,
-  0xed, 0xa6, 0x8b, 0xee, 0xff, 0x36, 0x1a, 0x03, 0x0b, 0x06, 0xa1, 0x6f,
-  0x49, 0xa3, 0x69, 0x00, 0xdb, 0xa1, 0x14, 0x05, 0x6d, 0x2c, 0x12, 0xaa,
-  0x8d, 0x35, 0x85, 0x26, 0x20, 0x0a, 0x7b, 0xf1, 0xeb, 0xb6, 0x73, 0x06,
-  0x22, 0xe0, 0x77, 0x00, 0x87, 0xaa, 0x82, 0x5b, 0x97, 0xa3, 0xa3, 0x20,
-  0x0b, 0x28, 0x16, 0xeb, 0x22, 0x21, 0x1e, 0x94, 0x41, 0x2d, 0x11, 0x05,
-  0x8c, 0x91, 0x33, 0x13, 0xe5, 0x7b, 0x89, 0x3f, 0x8c, 0x47, 0x70, 0x46,
-  0x76, 0x85, 0x15, 0x55, 0x37, 0x23, 0xf1, 0x89, 0x07, 0x01, 0x68, 0x82,
-  0x6d, 0xab, 0xa1, 0x22, 0xb2, 0x54, 0x71, 0xcb, 0x20, 0x6f, 0x4e, 0xaf,
-  0x29, 0x73, 0x66, 0x2e, 0xb5, 0x06, 0x56, 0x5b, 0x65, 0xf0, 0x3d, 0xee,
-  0x58, 0x25, 0xbe, 0x09, 0xea, 0xf9, 0x04, 0xe8, 0xe7, 0xe6, 0x9e, 0xe4,
-  0xe2, 0x58, 0x9a, 0x3b, 0x67, 0x1a, 0x88, 0xf8, 0x46, 0xe1, 0x1e, 0xb8,
-  0xc0, 0x29, 0x95, 0x60, 0x97, 0x87, 0x0b, 0x50, 0x2e, 0x93, 0x75, 0x47,
-  0x89, 0xee, 0xb8, 0xc4, 0x5f, 0x04, 0x0b, 0xb0, 0xfb, 0xe1, 0x74, 0x0d,
-  0x0e, 0x0f, 0x80, 0x3f, 0xa3, 0x2f, 0xca, 0x59, 0x0c, 0x3f, 0x7f, 0x01,
-  0x3f, 0x75, 0x1d, 0x65, 0x0d, 0xa1, 0x1f, 0xb6, 0x0f, 0x8a, 0x2d, 0xb4,
-  0x47, 0x5b, 0xa0, 0xb7, 0xc4, 0x03, 0x59, 0x6a, 0x47, 0xad, 0xd4, 0x46,
-  0xc9, 0xee, 0x7e, 0x15, 0x13, 0x46, 0xc8, 0xb7, 0x61, 0x0c, 0x01, 0x38,
-  0xa7, 0x5d, 0xd5, 0xe9, 0xe0, 0x0b, 0x7c, 0x01, 0x47, 0xcc, 0x6e, 0x59,
-  0x01, 0x86, 0x7d, 0xa4, 0xf4, 0x1d, 0x66, 0x0f, 0x50, 0x6d, 0xa0, 0xf4,
-  0x4e, 0x97, 0xe5, 0x52, 0xad, 0x8d, 0x54, 0xb0, 0x1f, 0x7d, 0x6c, 0x30,
-  0x16, 0x0b, 0x8b, 0x19, 0xc1, 0x5a, 0x35, 0x95, 0xe7, 0x8e, 0xc7, 0xe9,
-  0xd0, 0xa0, 0x58, 0x91, 0xe4, 0x0e, 0x7e, 0x8d, 0xc7, 0xfc, 0xb1, 0x8f,
-  0x0a, 0xb6, 0x0d, 0x71, 0x34, 0x41, 0xec, 0xe9, 0x6f, 0x05, 0xf2, 0x59,
-  0x47, 0x48, 0x2d, 0x43, 0x6e, 0xf5, 0x31, 0x1f, 0x6d, 0x2d, 0x44, 0xa9,
-  0x1d, 0xce, 0x7d, 0xfb, 0x12, 0x77, 0x55, 0x58, 0xda, 0xed, 0xf8, 0x06,
-  0x92, 0x97, 0xf0, 0x47, 0xeb, 0x80, 0x60, 0x4e, 0x6a, 0xe4, 0xba, 0x77,
-  0xf1, 0xd9, 0x06, 0xec, 0x9d, 0x0d, 0xee, 0x96, 0x00, 0xe3, 0x59, 0xe8,
-  0xaf, 0x3f, 0x28, 0x0e, 0x56, 0xe6, 0x2d, 0x5f, 0x12, 0x08, 0xc4, 0x9c,
-  0x15, 0xb0, 0x66, 0x01, 0x5a, 0x03, 0xc0, 0x19, 0x99, 0x6c, 0x6c, 0xd7,
-  0x93, 0xa4, 0x3b, 0x46, 0xc6, 0xa3, 0xca, 0xf2, 0x5b, 0x18, 0x39, 0xed,
-  0x76, 0xf4, 0x7d, 0x0a, 0xc1, 0xe9, 0xfe, 0x4b, 0x8f, 0x7e, 0xed, 0x02,
-  0xeb, 0x11, 0xd6, 0x96, 0xe8, 0x12, 0xe4, 0x0c, 0x7c, 0xb8, 0xf0, 0x5c,
-  0x83, 0xd9, 0x42, 0x84, 0x76, 0x1b, 0xff, 0x17, 0x3f, 0x05, 0x9a, 0x1d,
-  0x00, 0x38, 0xb6, 0x04, 0x0a, 0xe6, 0x79, 0x12, 0xaa, 0xb8, 0xad, 0x95,
-  0xe0, 0xb8, 0x62, 0x07, 0x8d, 0xed, 0x9a, 0x02, 0x9a, 0xdf, 0x05, 0x47,
-  0x0e, 0x9a, 0x36, 0x70, 0x04, 0x65, 0x79, 0xad, 0xc9, 0x28, 0x96, 0xe2,
-  0x2f, 0x28, 0x43, 0xbf, 0xf2, 0xde, 0xc6, 0x46, 0xdf, 0xe0, 0xe0, 0x00,
-  0xa4, 0x08, 0x1b, 0xde, 0x37, 0x7c, 0x36, 0x0b, 0x3a, 0x04, 0x57, 0xa4,
-  0x25, 0x39, 0xb1, 0x62, 0x10, 0xd8, 0xeb, 0x27, 0x1c, 0xb9, 0xa9, 0x45,
-  0xe8, 0xc2, 0x8e, 0xe3, 0x65, 0x22, 0xd8, 0x1b, 0x16, 0x08, 0x59, 0x78,
-  0xb3, 0x31, 0x0f, 0x00, 0xf5, 0xa3, 0x03, 0x09, 0x50, 0x4b, 0xfd, 0xf8,
-  0xdc, 0x9a, 0xef, 0x2c, 0xd7, 0x87, 0x2b, 0x46, 0x0f, 0x5c, 0x5b, 0x79,
-  0x90, 0xad, 0xfe, 0x77, 0xd8, 0xde, 0x3f, 0x23, 0x2b, 0x3e, 0x44, 0xa0,
-  0xc8, 0xb6, 0xa8, 0x20, 0xc6, 0xdc, 0xc5, 0x5d, 0x3e, 0xfe, 0x1e, 0xa6,
-  0x23, 0x1c, 0x70, 0x24, 0x02, 0xb2, 0x62, 0xd2, 0xa0, 0x60, 0xd2, 0x56,
-  0xd8, 0x08, 0x29, 0x5b, 0x6c, 0xd8, 0x0f, 0x0e, 0xda, 0x5b, 0xdc, 0x6a,
-  0x09, 0x6d, 0x12, 0xd4, 0xb2, 0x3d, 0xd4, 0xdb, 0x3d, 0xf1, 0x03, 0xde,
-  0x75, 0x38, 0x2a, 0xd7, 0x1b, 0x21, 0x78, 0xda, 0x9a, 0xe5, 0x13, 0xc5,
-  0x85, 0x35, 0x63, 0x22, 0xb2, 0xab, 0xe4, 0x62, 0xaf, 0x9c, 0xb6, 0xd8,
-  0x02, 0xd6, 0x20, 0x4d, 0x84, 0x9f, 0x2a, 0xe9, 0x96, 0x01, 0x63, 0x42,
-  0x36, 0x1d, 0xc8, 0x74, 0x81, 0x31, 0xfe, 0x61, 0x48, 0xab, 0x0b, 0xbf,
-  0x3f, 0x9a, 0xc4, 0x00, 0x64, 0x17, 0x61, 0xc3, 0x73, 0x01, 0x3a, 0x6c,
-  0xab, 0x00, 0x30, 0x01, 0xd8, 0x74, 0x73, 0x2d, 0x07, 0x75, 0xb1, 0x5d,
-  0x66, 0xb2, 0x2b, 0x1b, 0x30, 0xa3, 0x21, 0xa0, 0x0c, 0x06, 0x09, 0xd8,
-  0xde, 0x0b, 0x7f, 0x5a, 0x3b, 0xd0, 0x74, 0x14, 0x6e, 0xb9, 0x04, 0x02,
-  0x43, 0x0c, 0x1b, 0x3a, 0xe5, 0x8b, 0xc2, 0x6f, 0xc4, 0x5b, 0x17, 0x40,
-  0x1e, 0x6b, 0x16, 0xb8, 0x13, 0xf1, 0x17, 0x90, 0x7e, 0xb0, 0xec, 0x44,
-  0x67, 0xa6, 0xeb, 0x0d, 0xd6, 0xda, 0x63, 0x9e, 0x0b, 0x66, 0x8f, 0x14,
-  0xd6, 0x2d, 0x4f, 0x02, 0x9b, 0x23, 0x3c, 0x02, 0x42, 0x47, 0x3e, 0xa3,
-  0x01, 0x17, 0x0e, 0xa2, 0xfb, 0xc1, 0xd2, 0xbd, 0x60, 0xd2, 0x15, 0x1c,
-  0xb2, 0x92, 0x21, 0x4b, 0x11, 0xf6, 0x74, 0x46, 0x41, 0x6d, 0x17, 0x93,
-  0x48, 0x7b, 0x6a, 0x3b, 0x30, 0x92, 0x65, 0xf0, 0x1f, 0x82, 0xb5, 0xad,
-  0x7d, 0xc6, 0x5e, 0x16, 0x4d, 0x6e, 0x49, 0x93, 0x4d, 0x11, 0xad, 0x5b,
-  0x01, 0x60, 0x32, 0x0b, 0x0c, 0x05, 0x52, 0xb0, 0x30, 0x9a, 0x8f, 0xee,
-  0xe9, 0x8c, 0xfb, 0x18, 0x69, 0x3e, 0x0a, 0x00, 0xe5, 0x12, 0x77, 0x91,
-  0xc9, 0x7c, 0x23, 0x1b, 0x07, 0x04, 0x00, 0xcf, 0x7b, 0x10, 0xf2, 0x00,
-  0xa9, 0xfc, 0x49, 0x63, 0x40, 0x78, 0x29, 0xb0, 0x2e, 0x27, 0x7c, 0xfd,
-  0x00, 0x3e, 0x08, 0x86, 0xc6, 0xdb, 0x9b, 0x4b, 0x6f, 0x11, 0xff, 0x75,
-  0x24, 0x2d, 0xb0, 0x2d, 0x94, 0x16, 0x8d, 0x1d, 0x06, 0xb2, 0x0b, 0xc9,
-  0xde, 0x0a, 0x17, 0xf9, 0x29, 0xdd, 0x03, 0x53, 0xea, 0x24, 0xad, 0x6b,
-  0x06, 0x95, 0x66, 0xee, 0x60, 0x5d, 0x8b, 0xb6, 0x76, 0x49, 0x15, 0x1e,
-  0x31, 0x01, 0xd4, 0x28, 0xf9, 0xf6, 0x76, 0xfc, 0x33, 0xe4, 0x96, 0x1a,
-  0xe9, 0xec, 0x9a, 0x98, 0xca, 0x3e, 0x06, 0x00, 0x88, 0x16, 0x46, 0x12,
-  0xd9, 0x56, 0xf5, 0x24, 0x12, 0x35, 0xb9, 0x34, 0xb9, 0x68, 0x0a, 0x01,
-  0x2e, 0xf0, 0x58, 0x2c, 0x26, 0x31, 0x6c, 0x15, 0x90, 0x7b, 0xe8, 0x3d,
-  0x1e, 0x52, 0x00, 0x2d, 0x9a, 0x9f, 0x0a, 0xa7, 0x71, 0x8a, 0x0e, 0x99,
-  0x81, 0xb1, 0xa3, 0x6d, 0x0a, 0xdc, 0x1b, 0x54, 0x66, 0xeb, 0xb1, 0x42,
-  0x8e, 0xb2, 0x5e, 0x31, 0x39, 0x0c, 0x2e, 0x20, 0x82, 0xe6, 0x9e, 0x35,
-  0x7c, 0x37, 0xeb, 0xc8, 0x6e, 0x6e, 0x2c, 0x03, 0x4b, 0xae, 0xf6, 0xf9,
-  0xb6, 0x22, 0x12, 0x10, 0x49, 0x4b, 0x84, 0x01, 0x68, 0xd0, 0x40, 0x8d,
-  0xc1, 0x4d, 0x0b, 0x57, 0x01, 0x8b, 0x09, 0xd7, 0x06, 0x2b, 0xde, 0xe2,
-  0x1b, 0x56, 0xfe, 0x85, 0xfd, 0x1b, 0x0d, 0x7a, 0x92, 0x03, 0xc2, 0xb1,
-  0x7c, 0x01, 0x00, 0x4c, 0x9d, 0x05, 0xcd, 0x5b, 0x39, 0x08, 0x48, 0xb3,
-  0x0a, 0x65, 0x58, 0x22, 0x25, 0x87, 0x45, 0x8f, 0x08, 0x5e, 0x01, 0xa4,
-  0xdc, 0x01, 0x56, 0x03, 0xd9, 0x05, 0x7f, 0xd8, 0x01, 0x4f, 0x6a, 0x01,
-  0x71, 0x63, 0x07, 0x78, 0x89, 0x01, 0x16, 0x90, 0x0e, 0xcb, 0xc2, 0x04,
-  0x25, 0xb2, 0xa2, 0x8e, 0x4c, 0x18, 0x41, 0x8c, 0x51, 0x0f, 0x0c, 0x39,
-  0x89, 0x05, 0x34, 0x46, 0xd2, 0xa2, 0x37, 0xed, 0xf6, 0xeb, 0xa8, 0x2d,
-  0x45, 0x1f, 0x2a, 0x1f, 0x74, 0x1e, 0xf3, 0x20, 0x0a, 0xda, 0x1f, 0xa2,
-  0x1e, 0x3d, 0x0a, 0x2a, 0xf8, 0x4b, 0x09, 0x96, 0x8a, 0xeb, 0x09, 0x63,
-  0xff, 0x08, 0x46, 0x3b, 0x76, 0x0e, 0x72, 0x8a, 0xce, 0x9d, 0x34, 0x9b,
-  0x45, 0x40, 0xa4, 0x4b, 0x09, 0xbe, 0x5f, 0xe4, 0xf8, 0xa1, 0x7b, 0x3c,
-  0x7a, 0x07, 0x7a, 0x85, 0x81, 0x9d, 0x06, 0x22, 0xd7, 0x3f, 0x5b, 0xc3,
-  0x11, 0x95, 0xe0, 0x07, 0x3d, 0xea, 0x28, 0x05, 0x2d, 0x1b, 0x02, 0x40,
-  0xfb, 0xeb, 0xb3, 0xeb, 0xe1, 0x5e, 0xe3, 0xb0, 0x17, 0x98, 0x5f, 0x3d,
-  0xa1, 0x2a, 0x05, 0x9c, 0x07, 0x2c, 0x9e, 0xc7, 0x06, 0xd6, 0x10, 0x1c,
-  0xb0, 0x0a, 0x64, 0x2c, 0x35, 0x5b, 0xd0, 0x0b, 0xd0, 0x46, 0x10, 0x34,
-  0x4d, 0x08, 0x3f, 0xe6, 0x1b, 0xb8, 0x44, 0x1f, 0x0d, 0x6d, 0xba, 0x05,
-  0x04, 0x5c, 0x75, 0x28, 0xd7, 0x5c, 0x05, 0x45, 0x02, 0xf5, 0x0e, 0x72,
-  0x1b, 0xb3, 0x07, 0xd2, 0xb1, 0x09, 0x42, 0xda, 0x39, 0x12, 0x15, 0xc7,
-  0xe8, 0x9e, 0x2c, 0x70, 0xb9, 0x25, 0xaa, 0x20, 0x18, 0xc7, 0x1d, 0x7e,
-  0x73, 0xd8, 0x07, 0x59, 0x47, 0xee, 0xb8, 0x49, 0x0e, 0x98, 0x28, 0x0c,
-  0x6e, 0xfb, 0xc0, 0x34, 0x40, 0x65, 0x08, 0x52, 0x16, 0xd1, 0x50, 0x19,
-  0x08, 0xbb, 0x42, 0xa1, 0x29, 0x22, 0xf9, 0x3d, 0x14, 0x23, 0x8d, 0x4f,
-  0x43, 0xa0, 0xc0, 0xb0, 0xbd, 0x6d, 0x7e, 0x17, 0x65, 0xae, 0x32, 0x59,
-  0x55, 0x32, 0x02, 0x17, 0x5e, 0x25, 0x4e, 0x5d, 0x1f, 0x40, 0x64, 0x02,
-  0x2e, 0x64, 0x4b, 0x65, 0xaa, 0x32, 0x7d, 0x14, 0x87, 0xe9, 0x01, 0x19,
-  0xe7, 0x6f, 0x64, 0x6e, 0xf7, 0xd8, 0x0f, 0x8a, 0x44, 0xe7, 0x25, 0x50,
-  0x32, 0x82, 0x17, 0x02, 0x09, 0x1e, 0x07, 0x8b, 0x61, 0x73, 0x07, 0x03,
-  0xc9, 0x00, 0xe4, 0x32, 0x02, 0x17, 0x90, 0x20, 0x58, 0xab, 0x12, 0x98,
-  0x73, 0x20, 0x29, 0x4f, 0x58, 0x71, 0xc9, 0x98, 0x02, 0xf0, 0x6e, 0x05,
-  0xc1, 0x4e, 0x8a, 0x61, 0x56, 0x48, 0xf3, 0x4f, 0x21, 0xcf, 0x0c, 0x3b,
-  0x60, 0x8b, 0x70, 0x56, 0x07, 0xee, 0xec, 0xbb, 0xfe, 0xff, 0x21, 0x92,
-  0x9f, 0x9b, 0x5e, 0x8c, 0x08, 0xe4, 0xa9, 0x0a, 0xe4, 0xb6, 0xb8, 0x3e,
-  0x0a, 0xf6, 0x77, 0x8f, 0x47, 0x9b, 0x34, 0x0e, 0x20, 0x1b, 0x1d, 0xb0,
-  0x84, 0x8f, 0x23, 0x80, 0x82, 0x61, 0x16, 0x0b, 0xa3, 0xad, 0x40, 0x2b,
-  0x6e, 0x3e, 0x2b, 0x08, 0xe0, 0x4a, 0x92, 0xb4, 0xc6, 0xa9, 0xc0, 0x49,
-  0x92, 0x78, 0x9b, 0x12, 0x46, 0x28, 0xd1, 0x6e, 0x58, 0x14, 0x04, 0x6b,
-  0xf4, 0x31, 0x40, 0xeb, 0xdd, 0x9c, 0x9b, 0x23, 0x12, 0x10, 0x36, 0x9c,
-  0x56, 0xf0, 0x0e, 0xbe, 0x6e, 0x0b, 0x10, 0x0b, 0xd4, 0x0e, 0x8c, 0x2e,
-  0xd5, 0x93, 0x7d, 0x24, 0x70, 0xff, 0xc9, 0x3b, 0x30, 0x80, 0x12, 0xd9,
-  0x60, 0x54, 0x50, 0x5b, 0x75, 0xec, 0xa8, 0xfd, 0xcd, 0x9f, 0x00, 0xf8,
-  0x6a, 0xb7, 0x3b, 0x5a, 0x25, 0x8b, 0x3e, 0x3d, 0xc4, 0xb8, 0xd9, 0x5d,
-  0xf5, 0x40, 0x63, 0x22, 0xfb, 0x20, 0x87, 0xa5, 0x00, 0x58, 0xea, 0x3c,
-  0x9f, 0x33, 0x06, 0x20, 0x4a, 0xb6, 0x71, 0xe3, 0x49, 0x92, 0x84, 0x14,
-  0x13, 0x99, 0x33, 0x41, 0x62, 0x6a, 0x82, 0xd9, 0x12, 0x26, 0x80, 0xed,
-  0x36, 0x36, 0x90, 0xe7, 0xa4, 0x2b, 0xda, 0x7b, 0xaa, 0xa5, 0x96, 0x13,
-  0xf2, 0xd9, 0x02, 0xf0, 0x65, 0xf6, 0xa8, 0xf4, 0xdb, 0xa5, 0x2b, 0xfb,
-  0x58, 0x7e, 0x03, 0x17, 0x09, 0xa1, 0xc8, 0xf1, 0x4c, 0xe9, 0x0a, 0x3b,
-  0xd9, 0xea, 0xf2, 0x65, 0xf0, 0x96, 0xec, 0xee, 0x80, 0x45, 0xd5, 0x51,
-  0x88, 0xa2, 0x14, 0xd0, 0x33, 0xb4, 0xd0, 0xa5, 0xee, 0x83, 0xec, 0x97,
-  0x36, 0xf9, 0x4c, 0x5b, 0x8e, 0x0e, 0x81, 0x01, 0x4c, 0x68, 0x02, 0x5a,
-  0x19, 0xf8, 0x0d, 0x5e, 0xa6, 0xfa, 0x6e, 0xa0, 0xfa, 0xd8, 0x8e, 0x3b,
-  0x5c, 0x2e, 0x72, 0xc8, 0x51, 0xa1, 0x85, 0x38, 0x76, 0x72, 0xc1, 0x89,
-  0x6b, 0x30, 0xea, 0x01, 0xd0, 0x14, 0xac, 0x85, 0xe2, 0xde, 0xdc, 0xcd,
-  0xae, 0x04, 0x82, 0x2d, 0xd9, 0x45, 0xf0, 0x50, 0xae, 0x94, 0xca, 0xaa,
-  0x0f, 0x15, 0x20, 0x06, 0xfa, 0x88, 0xb4, 0xe9, 0x50, 0x8b, 0x8b, 0x5a,
-  0x66, 0xfc, 0xb5, 0xfe, 0x6c, 0x55, 0xaa, 0xec, 0x6d, 0xf9, 0x79, 0xfe,
-  0x8c, 0xee, 0x89, 0x90, 0xe3, 0x0c, 0x03, 0xb8, 0x58, 0xf1, 0x17, 0x0b,
-  0x27, 0x11, 0x52, 0x38, 0xec, 0x0b, 0xff, 0xd9, 0x03, 0x7b, 0x45, 0xd9,
-  0x08, 0xe4, 0xf0, 0xb4, 0xe2, 0x18, 0x1e, 0x48, 0x0c, 0x80, 0x6f, 0x61,
-  0x3b, 0x5e, 0xfa, 0x77, 0xbb, 0xc0, 0xe1, 0x4e, 0xf8, 0xda, 0x77, 0xb9,
-  0x46, 0x02, 0x43, 0x84, 0x41, 0x62, 0x3e, 0xdc, 0x41, 0x32, 0x05, 0x5b,
-  0xda, 0x3b, 0xfa, 0x16, 0x30, 0x05, 0x74, 0x33, 0x21, 0x8e, 0x62, 0x21,
-  0x04, 0x31, 0xc7, 0x0f, 0xaf, 0x63, 0x4f, 0x3a, 0x5c, 0x93, 0xfd, 0x50,
-  0x63, 0x06, 0x12, 0x67, 0x37, 0x89, 0x75, 0x31, 0xa3, 0xbb, 0x3a, 0x8c,
-  0xda, 0x33, 0x84, 0x08, 0x7d, 0x28, 0x86, 0x81, 0x8c, 0x0a, 0xba, 0x37,
-  0xb6, 0x8c, 0xba, 0xd3, 0xcf, 0x48, 0xff, 0xe4, 0x6a, 0x01, 0x23, 0xb6,
-  0xa1, 0x49, 0x8b, 0xe0, 0x50, 0xbc, 0x8b, 0x0e, 0x72, 0x2e, 0xfc, 0x0c,
-  0x72, 0x27, 0x4a, 0x29, 0xc0, 0xc2, 0xed, 0x1e, 0x20, 0xed, 0x72, 0x14,
-  0x77, 0xa7, 0x95, 0x0e, 0xa2, 0x9f, 0x56, 0x00, 0x05, 0xe5, 0xff, 0xff,
-  0x99, 0x32, 0x55, 0x8a, 0x67, 0x17, 0x47, 0x75, 0x21, 0x52, 0x4e, 0xa4,
-  0xd8, 0x2f, 0x75, 0x01, 0x18, 0x36, 0x4c, 0xa4, 0x35, 0x84, 0x14, 0x20,
-  0x8d, 0x70, 0x57, 0x93, 0x7e, 0x37, 0x34, 0x0e, 0xf4, 0x3d, 0xe9, 0x79,
-  0x46, 0x2f, 0xeb, 0x1f, 0x49, 0x3f, 0x0c, 0xb4, 0x8c, 0x06, 0x21, 0xe5,
-  0x8b, 0x12, 0x7b, 0xf7, 0x7c, 0xdd, 0x6c, 0x3f, 0x7c, 0x01, 0xeb, 0x91,
-  0x64, 0x3c, 0x30, 0x2e, 0x98, 0xb2, 0x76, 0xac, 0x46, 0x61, 0xb2, 0x2b,
-  0x9d, 0xf8, 0x97, 0x4b, 0xce, 0x09, 0x9d, 0x84, 0x4e, 0x85, 0x05, 0xee,
-  0xc0, 0x07, 0x96, 0x0c, 0x0e, 0x11, 0x46, 0x92, 0xa5, 0x64, 0x8a, 0x87,
-  0x83, 0xff, 0x56, 0xe4, 0xc0, 0x05, 0x73, 0x5f, 0x26, 0xe4, 0xa6, 0x9a,
-  0xa0, 0x48, 0xba, 0xf0, 0x43, 0x06, 0x09, 0x74, 0xaa, 0x9c, 0x14, 0x45,
-  0x8d, 0x31, 0x8b, 0xbf, 0x06, 0x0b, 0x47, 0x02, 0x75, 0x16, 0x09, 0x3c,
-  0xc9, 0xa9, 0x60, 0xb7, 0x07, 0xbc, 0x02, 0x7b, 0x32, 0xcf, 0x9e, 0x2f,
-  0xac, 0x41, 0xc0, 0x48, 0x05, 0x23, 0x24, 0x35, 0x36, 0xb1, 0x3c, 0x06,
-  0x71, 0xd4, 0xed, 0xea, 0x53, 0x3a, 0xab, 0xf8, 0x2f, 0x05, 0xbf, 0x55,
-  0x3e, 0x7b, 0xc4, 0x1f, 0xe6, 0x69, 0x08, 0x6f, 0x3e, 0xae, 0xb0, 0xff,
-  0x45, 0x68, 0x69, 0x1a, 0xe9, 0x31, 0xc1, 0x14, 0xd2, 0xc7, 0x87, 0x06,
-  0xff, 0x63, 0x03, 0x26, 0x8c, 0x8f, 0x35, 0x06, 0x64, 0x11, 0xf3, 0x37,
-  0x06, 0x87, 0xc8, 0x39, 0x75, 0x89, 0x02, 0x62, 0xec, 0xeb, 0x01, 0x30,
-  0x07, 0x46, 0x02, 0x24, 0x79, 0xd3, 0x02, 0x10, 0x19, 0xea, 0xbd, 0x16,
-  0xc2, 0x8b, 0xa6, 0xba, 0x91, 0xc9, 0x04, 0x0f, 0xa8, 0x37, 0x60, 0xc8,
-  0x2a, 0xcd, 0x88, 0xea, 0x10, 0x87, 0xa1, 0x55, 0x38, 0xed, 0x32, 0xb4,
-  0x3a, 0xce, 0x58, 0x90, 0xee, 0x17, 0x55, 0xf4, 0xfe, 0x66, 0x50, 0xb9,
-  0x26, 0xb2, 0x89, 0x47, 0xc8, 0x61, 0x1e, 0x08, 0x00, 0x48, 0xf2, 0xb3,
-  0x00, 0x23, 0xc8, 0x41, 0x4a, 0xc3, 0x90, 0x4c, 0x55, 0x59, 0x66, 0xc2,
-  0x06, 0x10, 0x46, 0xe6, 0x74, 0x71, 0xb0, 0x0b, 0x76, 0x83, 0x3f, 0x9f,
-  0xc8, 0x40, 0x50, 0xc2, 0xe2, 0xae, 0x5e, 0xe9, 0x4e, 0xdc, 0xa8, 0x4b,
-  0xfe, 0x36, 0xab, 0xba, 0x0b, 0x82, 0x50, 0xee, 0x96, 0x70, 0x84, 0x3a,
-  0x06, 0x45, 0x76, 0x62, 0x14, 0x72, 0xf4, 0x64, 0x7e, 0xeb, 0xfd, 0xe9,
-  0xe8, 0xfd, 0x27, 0x48, 0x7a, 0x32, 0x0b, 0x84, 0x55, 0xa0, 0x74, 0x3d,
-  0xa7, 0x9a, 0x69, 0x32, 0x10, 0xd8, 0x64, 0x55, 0xc8, 0xfd, 0x0c, 0x86,
-  0xbb, 0x83, 0xfd, 0xbf, 0x07, 0x81, 0x7f, 0x82, 0x0c, 0xb5, 0xda, 0x2d,
-  0xe2, 0x05, 0x85, 0x2e, 0xe4, 0x06, 0x02, 0xb9, 0x57, 0x64, 0x54, 0x1d,
-  0xa1, 0x2e, 0x12, 0x26, 0xd2, 0x87, 0x68, 0xed, 0xff, 0x06, 0x08, 0x70,
-  0x61, 0x00, 0xc9, 0xe4, 0x58, 0xdb, 0x32, 0x04, 0x5e, 0x94, 0xfc, 0x06,
-  0xcf, 0x18, 0x86, 0xa8, 0x98, 0x6b, 0x27, 0x8a, 0x0a, 0x80, 0x02, 0x2c,
-  0x29, 0x90, 0x25, 0x0d, 0x76, 0x62, 0x31, 0x01, 0xc9, 0x01, 0x23, 0xfb,
-  0xd2, 0x4a, 0x78, 0x74, 0x38, 0x8e, 0x0e, 0x9a, 0x83, 0x0f, 0xf0, 0x15,
-  0x98, 0x1c, 0x02, 0xf7, 0xc9, 0x0e, 0x84, 0x15, 0x86, 0x06, 0x40, 0x41,
-  0x46, 0x7c, 0x02, 0xc0, 0x0b, 0x64, 0x02, 0x19, 0x0a, 0x94, 0x1e, 0x0d,
-  0x39, 0x83, 0x10, 0x8d, 0x53, 0x0d, 0xf5, 0x0d, 0x88, 0xac, 0x54, 0x1b,
-  0xe4, 0x0e, 0xe4, 0x0f, 0xe4, 0x10, 0xe4, 0x11, 0xe4, 0x11, 0xe7, 0x12,
-  0x6d, 0x9a, 0x13, 0x46, 0x32, 0xba, 0x14, 0x13, 0x4e, 0x14, 0xe4, 0x7d,
-  0x5b, 0xf0, 0xeb, 0xb3, 0x16, 0x2a, 0xb7, 0x22, 0x19, 0x57, 0x20, 0x23,
-  0x57, 0xba, 0x14, 0x4e, 0x16, 0x4e, 0x15, 0x4e, 0x18, 0x13, 0x18, 0xf8,
-  0x9a, 0xc1, 0x08, 0xf9, 0x04, 0x24, 0x76, 0x6c, 0x1e, 0x35, 0xe6, 0x26,
-  0x93, 0x24, 0xba, 0x19, 0x53, 0x1b, 0x69, 0x12, 0xa4, 0x22, 0xec, 0x16,
-  0x69, 0xee, 0x19, 0x15, 0x95, 0x1b, 0x95, 0x92, 0xb6, 0x0d, 0x18, 0x4e,
-  0x1d, 0x4e, 0x1a, 0x4e, 0x1f, 0xce, 0x5b, 0x2e, 0x69, 0x2c, 0x3b, 0x21,
-  0x23, 0xa4, 0x23, 0xe4, 0x30, 0xe1, 0x25, 0x1d, 0x16, 0x96, 0x60, 0x31,
-  0xb6, 0x09, 0xb5, 0x7c, 0x9a, 0xce, 0x03, 0x47, 0xe7, 0x54, 0x0e, 0x78,
-  0xb9, 0xab, 0x12, 0x09, 0xc7, 0xac, 0xfe, 0xaa, 0x02, 0x3a, 0x18, 0x13,
-  0x2d, 0x6c, 0x9a, 0xca, 0x69, 0x4b, 0x52, 0x25, 0x4a, 0x89, 0x91, 0xe0,
-  0x74, 0x7c, 0x53, 0x78, 0x00, 0xd3, 0xca, 0xcf, 0xf9, 0xd1, 0x25, 0xb0,
-  0x55, 0xb9, 0x56, 0x06, 0x50, 0xc2, 0x8f, 0x1c, 0x93, 0x06, 0xf3, 0x10,
-  0x82, 0x30, 0x95, 0x46, 0x52, 0x8a, 0x6b, 0xd7, 0x11, 0x85, 0x39, 0x7e,
-  0x2c, 0x61, 0x58, 0xa0, 0xbd, 0xce, 0x78, 0x24, 0x0a, 0x68, 0x1a, 0x0e,
-  0x5e, 0x6f, 0x4a, 0x9a, 0xbd, 0xd8, 0x37, 0x0f, 0x81, 0x7e, 0x16, 0xa1,
-  0xcb, 0xfc, 0xfe, 0xd9, 0x75, 0x15, 0xc2, 0xc8, 0x97, 0x1e, 0xeb, 0x3a,
-  0x0c, 0x7c, 0xd8, 0x99, 0x73, 0xda, 0xb4, 0x6b, 0x40, 0x9d, 0xa9, 0xcb,
-  0xc1, 0x42, 0xbe, 0x58, 0x78, 0x0c, 0x9e, 0x84, 0x88, 0x04, 0x07, 0xb8,
-  0xc6, 0xd1, 0x56, 0xf2, 0x9d, 0x08, 0x0b, 0x4e, 0x0f, 0x65, 0xff, 0x55,
-  0x38, 0x24, 0xc6, 0x80, 0x8a, 0x51, 0x2a, 0x20, 0x85, 0x3f, 0x60, 0x86,
-  0xc9, 0xba, 0x62, 0xf6, 0x38, 0x36, 0x13, 0x2e, 0x27, 0x09, 0x19, 0xd8,
-  0xc2, 0x0f, 0x7c, 0x1c, 0xc8, 0x94, 0xb0, 0x30, 0xf2, 0xfd, 0xfe, 0x5b,
-  0x67, 0x6c, 0x11, 0x30, 0x39, 0xd6, 0x2c, 0x1a, 0x50, 0xc2, 0x61, 0x72,
-  0xcc, 0xfe, 0x07, 0x12, 0x21, 0xc8, 0xe5, 0x53, 0x9b, 0x21, 0x32, 0x18,
-  0x1c, 0xf3, 0x85, 0x32, 0x6a, 0x72, 0x0d, 0x3b, 0x57, 0x16, 0x65, 0xac,
-  0x14, 0xfa, 0x3c, 0x01, 0x01, 0x85, 0x76, 0x33, 0x36, 0x13, 0x1b, 0x34,
-  0x19, 0x87, 0x0f, 0x24, 0x0e, 0xfc, 0xfd, 0xc0, 0xcf, 0xe4, 0x1d, 0x3c,
-  0x1d, 0x01, 0x84, 0x76, 0xcb, 0x30, 0x13, 0x1f, 0x21, 0xc9, 0x2b, 0x4e,
-  0x4c, 0x4c, 0xc3, 0x9a, 0x9b, 0x26, 0x88, 0x46, 0x85, 0xff, 0xc4, 0x13,
-  0xc7, 0x59, 0x17, 0x92, 0xc8, 0x3f, 0x5e, 0xeb, 0x7b, 0xc3, 0x5e, 0x98,
-  0xfa, 0x13, 0x93, 0x33, 0x39, 0x98, 0xe7, 0x6b, 0xe0, 0x0d, 0x0e, 0x15,
-  0x6e, 0x5a, 0x5b, 0x2b, 0xa9, 0x5d, 0xac, 0x53, 0x14, 0x99, 0x62, 0x94,
-  0x73, 0x7d, 0x18, 0x29, 0x99, 0x18, 0x45, 0xec, 0x27, 0x10, 0x39, 0xd1,
-  0xbe, 0x59, 0x5b, 0x9a, 0x3c, 0x38, 0xa1, 0x53, 0x7f, 0x59, 0x2b, 0xc8,
-  0x1b, 0xda, 0x53, 0xee, 0x51, 0x9a, 0x5d, 0x0c, 0x14, 0x64, 0xfa, 0x8c,
-  0x46, 0x39, 0x40, 0x92, 0x01, 0x12, 0xc1, 0xb5, 0x92, 0x54, 0x14, 0x73,
-  0xb0, 0x21, 0xf5, 0x05, 0x02, 0x5c, 0xe4, 0x8a, 0x49, 0xe4, 0x48, 0x41,
-  0x32, 0xfa, 0xcb, 0xfc, 0xfa, 0x2c, 0xfc, 0x87, 0x6a, 0x65, 0x3f, 0xc0,
-  0xb0, 0x42, 0xe2, 0xa4, 0x3e, 0x6c, 0xfa, 0x74, 0x3c, 0x98, 0xfb, 0x56,
-  0xe3, 0x36, 0x19, 0x16, 0x69, 0x43, 0x05, 0x9d, 0x38, 0x6f, 0x1b, 0x06,
-  0xc5, 0xd8, 0xeb, 0xcc, 0x18, 0x20, 0x4b, 0x1b, 0x1d, 0x54, 0xfa, 0x37,
-  0x40, 0xeb, 0x07, 0x67, 0x08, 0x24, 0x0c, 0x65, 0xc2, 0x3d, 0x6d, 0x8a,
-  0x0f, 0x15, 0x25, 0xd8, 0xa4, 0xd9, 0xae, 0x16, 0x4e, 0x8e, 0x8c, 0xd2,
-  0x0d, 0xb4, 0x23, 0x78, 0x85, 0xda, 0xec, 0xff, 0xfa, 0x98, 0x97, 0x16,
-  0xb0, 0x98, 0x99, 0x93, 0x7b, 0xc4, 0xeb, 0xcb, 0x18, 0x05, 0x97, 0x98,
-  0x15, 0x14, 0x23, 0x42, 0x42, 0x54, 0x72, 0xd4, 0xc4, 0x88, 0x6d, 0xc2,
-  0x10, 0xac, 0x01, 0x14, 0xe7, 0x26, 0x5b, 0xf4, 0xe9, 0x5e, 0x9a, 0xc2,
-  0x51, 0x56, 0x18, 0x5e, 0xb0, 0x29, 0x32, 0x01, 0x77, 0x43, 0xff, 0x94,
-  0x33, 0x14, 0x92, 0x80, 0x64, 0x2e, 0x94, 0x73, 0xce, 0xd5, 0x06, 0xf8,
-  0x16, 0xad, 0xfa, 0x59, 0xf8, 0x79, 0xfa, 0x75, 0x18, 0x39, 0xc1, 0x03,
-  0x7d, 0xd7, 0x73, 0x48, 0x35, 0x6c, 0xd7, 0xe4, 0x27, 0xb7, 0x16, 0xb0,
-  0xd7, 0x99, 0xc6, 0x7b, 0xc2, 0xeb, 0xc9, 0x18, 0x05, 0x97, 0xd7, 0x0d,
-  0x1b, 0xf5, 0xf8, 0x35, 0x45, 0x37, 0x61, 0x43, 0xeb, 0x0b, 0x67, 0x0c,
-  0x29, 0x35, 0x27, 0x49, 0x9b, 0xb0, 0x48, 0x90, 0x14, 0x85, 0x13, 0xc0,
-  0x04, 0x85, 0x57, 0x39, 0xdd, 0x01, 0x03, 0x84, 0x7a, 0x7c, 0x2f, 0x82,
-  0xf9, 0x21, 0x5c, 0xe2, 0x66, 0x15, 0x12, 0x7c, 0x3d, 0x0c, 0xb8, 0x0c,
-  0xa1, 0x3e, 0x96, 0x47, 0x08, 0xd6, 0x87, 0x0b, 0x1c, 0x2b, 0x51, 0xe2,
-  0x2e, 0x41, 0x5d, 0x01, 0x9b, 0x6f, 0x52, 0x09, 0x0c, 0xa5, 0xc0, 0xab,
-  0x06, 0xfc, 0x48, 0x3c, 0xd6, 0xf8, 0x85, 0x79, 0x01, 0x02, 0x08, 0x64,
-  0x08, 0xe7, 0x52, 0x93, 0x08, 0x90, 0x36, 0x83, 0x80, 0x14, 0x45, 0xa9,
-  0xa2, 0xe6, 0x47, 0x48, 0x1d, 0x02, 0x21, 0xe4, 0x00, 0x06, 0x2c, 0x19,
-  0xe0, 0xd9, 0x0d, 0x26, 0xc9, 0x1e, 0x32, 0x15, 0x56, 0x2f, 0x3b, 0xf0,
-  0xb1, 0x05, 0xd3, 0xe0, 0xde, 0xd7, 0x0b, 0x4a, 0x03, 0xc2, 0x37, 0x3b,
-  0x26, 0xf7, 0xc3, 0x77, 0x0b, 0x0c, 0x20, 0xbd, 0x0e, 0xd2, 0x6a, 0x16,
-  0xc5, 0x0e, 0xed, 0x73, 0x12, 0x45, 0x70, 0x7d, 0xb8, 0x84, 0x5e, 0x69,
-  0x2c, 0xa2, 0x30, 0x18, 0xa0, 0xb3, 0x93, 0xb3, 0x13, 0x28, 0x96, 0x13,
-  0xf4, 0x59, 0xf6, 0x2d, 0x08, 0x01, 0x82, 0x44, 0xd8, 0x19, 0x15, 0xd6,
-  0x10, 0xa7, 0x20, 0xa3, 0xfa, 0x15, 0x82, 0xa1, 0xc7, 0x29, 0x5f, 0x0e,
-  0xfe, 0x33, 0xc9, 0x03, 0xd8, 0x13, 0xca, 0x03, 0x96, 0x38, 0x13, 0xa5,
-  0x7e, 0x04, 0x8f, 0xb8, 0x2b, 0xd3, 0x1b, 0x88, 0xc1, 0x4d, 0xc0, 0x8c,
-  0x3b, 0x0d, 0xd0, 0x52, 0x58, 0x48, 0x2b, 0xce, 0xdb, 0x19, 0xec, 0x6d,
-  0x1f, 0xee, 0x13, 0xc5, 0x75, 0x77, 0x0e, 0x72, 0x56, 0x3c, 0xf5, 0xec,
-  0xf5, 0x0f, 0x42, 0x59, 0xd0, 0x0c, 0xcc, 0x7f, 0x13, 0x7c, 0x0d, 0x72,
-  0x06, 0x83, 0xce, 0x12, 0xaa, 0x10, 0x38, 0x94, 0x28, 0x83, 0x00, 0xca,
-  0xac, 0x51, 0x64, 0xf3, 0x87, 0x2b, 0x92, 0x50, 0x64, 0x2d, 0x84, 0x61,
-  0x25, 0x4e, 0x53, 0x02, 0x40, 0xe4, 0x47, 0x2f, 0xb0, 0xf6, 0x27, 0x04,
-  0x41, 0xb5, 0xe8, 0x07, 0xfc, 0x12, 0x8b, 0x77, 0x2a, 0x58, 0x36, 0x47,
-  0x5f, 0x90, 0x02, 0x05, 0x81, 0xa5, 0x32, 0x6a, 0x14, 0x89, 0x20, 0x0f,
-  0x12, 0xf7, 0x20, 0x73, 0x23, 0x48, 0x21, 0x79, 0x6f, 0x02, 0x08, 0xd9,
-  0x65, 0x0c, 0x7a, 0x95, 0x38, 0xac, 0xf6, 0x90, 0x1e, 0x39, 0x25, 0x0f,
-  0x7f, 0x02, 0x24, 0x61, 0x6f, 0x0a, 0x64, 0x8d, 0x2a, 0xe4, 0x90, 0x83,
-  0xc9, 0x40, 0xf5, 0x4c, 0x32, 0x84, 0x72, 0x9c, 0x15, 0xb7, 0x48, 0x8f,
-  0xfc, 0x67, 0xa4, 0x0a, 0x42, 0xb7, 0x7e, 0x42, 0x80, 0xeb, 0x08, 0xcd,
-  0x09, 0x2b, 0x57, 0x27, 0x09, 0x92, 0x67, 0x19, 0x29, 0x26, 0x29, 0x84,
-  0xf6, 0x34, 0x72, 0xfa, 0x9a, 0x5a, 0x11, 0xc3, 0x0e, 0x9a, 0x8a, 0x88,
-  0x35, 0xc9, 0x85, 0x1d, 0xc8, 0x0e, 0x5d, 0x10, 0x85, 0x2c, 0xc8, 0x15,
-  0x5d, 0x13, 0x84, 0x81, 0xe4, 0xe5, 0xfb, 0xe0, 0x13, 0x23, 0xcd, 0x01,
-  0x96, 0x24, 0x26, 0xb5, 0x64, 0x93, 0x32, 0x16, 0x61, 0x41, 0x76, 0x18,
-  0x50, 0x17, 0x1a, 0x21, 0x32, 0x94, 0x0d, 0x0c, 0x93, 0x7f, 0x40, 0x62,
-  0x49, 0xce, 0x0b, 0x24, 0xc2, 0x7c, 0x64, 0x68, 0x03, 0x9a, 0x43, 0x45,
-  0x9d, 0xff, 0x97, 0x12, 0x27, 0x34, 0x29, 0x04, 0x60, 0x7f, 0xe0, 0x56,
-  0x57, 0x23, 0x81, 0x19, 0x84, 0x2e, 0x71, 0x74, 0x52, 0x0d, 0xa5, 0xe1,
-  0xd6, 0xb1, 0x08, 0x8e, 0xc1, 0x8a, 0xa0, 0x62, 0x21, 0x3f, 0xad, 0x03,
-  0x1a, 0x00, 0x5b, 0x37, 0x8b, 0xd0, 0xf8, 0x8a, 0xef, 0x50, 0x15, 0x9d,
-  0xfe, 0x46, 0x9e, 0xed, 0xfb, 0x98, 0x0d, 0x11, 0x5a, 0x76, 0xaa, 0xea,
-  0x42, 0x03, 0x81, 0x4d, 0x44, 0x16, 0x0b, 0xdb, 0x10, 0x10, 0x8b, 0xb5,
-  0xd7, 0x0b, 0x72, 0x69, 0xc4, 0x7e, 0x04, 0x62, 0x9b, 0x23, 0x09, 0x2d,
-  0xc3, 0x75, 0x13, 0x95, 0xe8, 0xee, 0x26, 0xa2, 0xff, 0x75, 0x10, 0x8b,
-  0xfe, 0xeb, 0x05, 0xc6, 0x43, 0xfe, 0xf4, 0x20, 0x47, 0x83, 0xff, 0x0b,
-  0x7c, 0xd0, 0x18, 0x08, 0xe8, 0xf8, 0x00, 0x88, 0x42, 0xf4, 0x00, 0x56,
-  0x00, 0x10, 0xd8, 0xd8, 0xe0, 0x79, 0x87, 0xfa, 0x38, 0x11, 0x3d, 0x5b,
-  0xd0, 0xaa, 0xf4, 0x74, 0x6c, 0x06, 0xf6, 0x0f, 0x10, 0x13, 0x2b, 0x00,
-  0x4e, 0x35, 0x04, 0xbf, 0x36, 0x76, 0x03, 0x08, 0x20, 0x4c, 0xf8, 0xf2,
-  0x08, 0x07, 0xf8, 0x34, 0x08, 0x97, 0x10, 0x24, 0xc8, 0x08, 0xc8, 0xf8,
-  0xce, 0x52, 0xc0, 0x10, 0xec, 0x36, 0x76, 0x0b, 0x09, 0xd8, 0x36, 0x2a,
-  0x0e, 0x58, 0x41, 0x88, 0x9a, 0x2c, 0x2e, 0xc2, 0x24, 0xec, 0x30, 0x0e,
-  0x2e, 0x32, 0x02, 0x92, 0x69, 0x52, 0xd7, 0x70, 0x04, 0x4a, 0x88, 0x20,
-  0xb8, 0x8f, 0x53, 0xfc, 0x24, 0xc2, 0x70, 0xc8, 0x02, 0x78, 0xd1, 0x26,
-  0xbe, 0x17, 0x7d, 0xea, 0x4e, 0x06, 0xd9, 0xa6, 0x39, 0x0b, 0xd8, 0xe9,
-  0x84, 0x2a, 0x73, 0xf9, 0xa9, 0x0f, 0xf8, 0x80, 0x7e, 0xff, 0xe6, 0x51,
-  0x2d, 0x76, 0x3c, 0xc6, 0xf6, 0xd0, 0xeb, 0xd7, 0x21, 0x0e, 0xc3, 0x03,
-  0x74, 0x64, 0x40, 0x6f, 0x54, 0x92, 0x3f, 0xfc, 0xeb, 0xa9, 0xeb, 0xa7,
-  0x62, 0x03, 0x0d, 0x22, 0x41, 0xae, 0x26, 0xfa, 0x83, 0xfa, 0x38, 0x3c,
-  0x8b, 0xde, 0x19, 0x33, 0xa2, 0x95, 0xad, 0xb4, 0xb9, 0x5d, 0x56, 0xea,
-  0xeb, 0x4d, 0x06, 0xf1, 0x36, 0xb7, 0x21, 0x86, 0x03, 0x60, 0x6d, 0xd6,
-  0x86, 0x04, 0x28, 0xc8, 0x16, 0xdf, 0x6d, 0x57, 0x25, 0xbb, 0xc0, 0xae,
-  0x00, 0x52, 0x48, 0x1c, 0xf2, 0xc8, 0x42, 0x70, 0x58, 0xc4, 0x32, 0x5a,
-  0xf5, 0xce, 0xeb, 0xd5, 0x98, 0x5b, 0x65, 0x38, 0x38, 0x95, 0x3d, 0xd3,
-  0x0a, 0x25, 0xd5, 0x8f, 0x36, 0x1f, 0x52, 0x53, 0x09, 0x38, 0x00, 0xf5,
-  0x75, 0x22, 0x83, 0x8c, 0xac, 0x22, 0xce, 0xe7, 0x60, 0x40, 0x78, 0x84,
-  0xeb, 0x82, 0x39, 0xa5, 0xd1, 0xe0, 0x0a, 0x06, 0x53, 0x89, 0x97, 0xdc,
-  0xee, 0x35, 0xd4, 0xc2, 0x34, 0x03, 0xfc, 0x31, 0x64, 0x21, 0x32, 0xac,
-  0x53, 0x06, 0x00, 0x4e, 0x68, 0xa0, 0xc9, 0xb6, 0xaa, 0x15, 0x35, 0xaf,
-  0x17, 0x50, 0x84, 0x55, 0x38, 0x7b, 0x0c, 0xd8, 0x0e, 0x19, 0xcd, 0x56,
-  0x9b, 0x34, 0x31, 0x3e, 0xe1, 0x04, 0x8b, 0xe8, 0x1c, 0x0c, 0x92, 0x29,
-  0x95, 0x74, 0xa0, 0xfd, 0x24, 0x3a, 0x2c, 0x52, 0x19, 0x8d, 0x09, 0x84,
-  0x2c, 0x0d, 0x99, 0xfe, 0x64, 0xfc, 0x6d, 0xc4, 0x61, 0x50, 0x6b, 0x8b,
-  0x02, 0x76, 0x54, 0x02, 0x11, 0xd9, 0x0c, 0xdb, 0x8e, 0x68, 0xb8, 0x04,
-  0xb7, 0x25, 0xa1, 0x8d, 0x6e, 0x4e, 0x0a, 0x21, 0xf5, 0x38, 0x09, 0xa0,
-  0xed, 0x53, 0x10, 0x7d, 0x03, 0xa8, 0xb5, 0x5c, 0xe0, 0x65, 0xe9, 0x85,
-  0x7f, 0xf2, 0x57, 0x06, 0x16, 0x37, 0x8d, 0x2a, 0x03, 0x24, 0xa2, 0x3a,
-  0x82, 0x6f, 0xc4, 0xcb, 0x10, 0xaa, 0xae, 0x49, 0x40, 0xc2, 0x38, 0xff,
-  0x00, 0x72, 0x16, 0x75, 0xab, 0x18, 0xab, 0x4d, 0x3f, 0x88, 0x76, 0xaa,
-  0xfb, 0xd0, 0x3b, 0xd5, 0x7a, 0x77, 0x0c, 0x72, 0x25, 0x39, 0xd4, 0xfa,
-  0x73, 0x8d, 0xc7, 0x24, 0x84, 0x1a, 0xad, 0xe3, 0x76, 0x18, 0x75, 0x0e,
-  0x3d, 0x58, 0x16, 0xee, 0xd1, 0x7f, 0x48, 0x08, 0x62, 0xab, 0xe7, 0x03,
-  0xaf, 0x14, 0x87, 0x43, 0x44, 0x40, 0x03, 0xae, 0x53, 0xf7, 0x62, 0x18,
-  0x0b, 0xf9, 0x2e, 0xcd, 0xc9, 0xcb, 0x92, 0xa1, 0x17, 0x69, 0x26, 0xcf,
-  0xb4, 0x25, 0x8f, 0x0e, 0x8d, 0x00, 0x51, 0x6f, 0x1c, 0x49, 0xc4, 0x3d,
-  0x17, 0xae, 0x20, 0xcd, 0xbe, 0xbc, 0x41, 0x22, 0xb8, 0xdc, 0x85, 0x21,
-  0xe6, 0x9b, 0x26, 0x20, 0xa1, 0x46, 0xf9, 0x3f, 0x0b, 0x0f, 0x74, 0xf1,
-  0x15, 0x5b, 0x76, 0x5e, 0x58, 0xfb, 0x6c, 0x83, 0x06, 0xf7, 0x12, 0x4f,
-  0x64, 0xa7, 0xad, 0x21, 0x22, 0x0c, 0x0e, 0x98, 0x80, 0x5b, 0xa2, 0xde,
-  0x02, 0x6a, 0xe4, 0x84, 0x17, 0x27, 0xe8, 0x02, 0xca, 0x46, 0x06, 0x90,
-  0x22, 0x98, 0x1b, 0xc0, 0xe5, 0x1d, 0x00, 0x01, 0x10, 0xa2, 0x61, 0x2b,
-  0x14, 0x59, 0x1a, 0xab, 0x3c, 0x34, 0x81, 0x23, 0x72, 0x19, 0x00, 0xd4,
-  0x06, 0xbc, 0xfd, 0x64, 0xeb, 0x6b, 0x44, 0x23, 0xa6, 0x20, 0xee, 0x2e,
-  0x75, 0x39, 0x06, 0x96, 0x21, 0x32, 0x6f, 0x22, 0x20, 0x75, 0x2b, 0x53,
-  0x47, 0xc8, 0x20, 0xa5, 0xaf, 0x9c, 0x73, 0x11, 0x7b, 0xb6, 0x46, 0x09,
-  0x06, 0x0f, 0x78, 0xeb, 0x2e, 0x1c, 0x3e, 0x56, 0xfd, 0x2c, 0x65, 0x01,
-  0xa9, 0x13, 0xf0, 0x2c, 0x50, 0x22, 0xbe, 0x2b, 0xf3, 0x04, 0x24, 0x81,
-  0x85, 0x3f, 0x9e, 0x2d, 0xe6, 0x79, 0xe0, 0xe4, 0xb8, 0xad, 0x41, 0x8b,
-  0x66, 0x13, 0x5d, 0x2e, 0x29, 0x44, 0x84, 0xc5, 0x88, 0xee, 0x9e, 0x41,
-  0x7c, 0x14, 0xdc, 0x04, 0x5a, 0x7f, 0x57, 0xcd, 0x82, 0xbc, 0x64, 0x64,
-  0x48, 0xb3, 0x6a, 0x10, 0x83, 0xdd, 0x87, 0x23, 0x1f, 0x60, 0x41, 0x1c,
-  0x0a, 0xbb, 0x42, 0x7f, 0x37, 0x0b, 0x02, 0x9a, 0x12, 0x35, 0x80, 0x21,
-  0xbb, 0xa9, 0x9b, 0x30, 0x13, 0x09, 0xd0, 0x7a, 0x81, 0x51, 0x34, 0xee,
-  0xd2, 0xbf, 0x40, 0x12, 0x10, 0x18, 0x58, 0x50, 0x39, 0x29, 0x01, 0x55,
-  0x81, 0xe8, 0x6f, 0x39, 0xc1, 0x45, 0x00, 0x24, 0x11, 0x62, 0xb1, 0x48,
-  0xb0, 0x08, 0x2c, 0x94, 0x9c, 0x1b, 0x08, 0x48, 0x8b, 0x1b, 0xe6, 0x0e,
-  0x57, 0x67, 0xd4, 0x85, 0xc5, 0xab, 0x0d, 0x5f, 0xc0, 0x57, 0x69, 0x08,
-  0x17, 0xc4, 0x81, 0x00, 0x41, 0xb6, 0x1a, 0x7b, 0xea, 0xe6, 0x0c, 0x74,
-  0xef, 0x10, 0x74, 0x05, 0x1f, 0x5f, 0x0c, 0x64, 0x3c, 0xee, 0xf9, 0x1c,
-  0x07, 0xa4, 0xf4, 0x21, 0x6a, 0xe4, 0xab, 0x74, 0xc1, 0xf3, 0x9d, 0xee,
-  0x49, 0x67, 0x0d, 0xd0, 0x57, 0x6e, 0x34, 0x09, 0x0a, 0x5e, 0x08, 0x7e,
-  0x14, 0x05, 0xff, 0x01, 0x98, 0xaa, 0x10, 0xb2, 0x21, 0x25, 0x83, 0x87,
-  0x3b, 0xeb, 0x6b, 0x60, 0xd6, 0xc8, 0x9e, 0x61, 0xf6, 0x35, 0x65, 0xf8,
-  0x96, 0xf6, 0xf8, 0x43, 0x81, 0x70, 0xb6, 0x01, 0xe0, 0xa8, 0xeb, 0xa6,
-  0xc8, 0xf0, 0x62, 0xf5, 0x30, 0x00, 0x5f, 0x2a, 0x73, 0x25, 0xfe, 0xe9,
-  0x7c, 0xff, 0xe9, 0x79, 0xff, 0x24, 0x48, 0x2d, 0x2d, 0x33, 0xff, 0x87,
-  0x29, 0x76, 0x20, 0x32, 0x52, 0xe0, 0x4f, 0xff, 0xd9, 0xf5, 0xf5, 0x39,
-  0xf8, 0xa4, 0xf6, 0xdb, 0x09, 0xc7, 0x54, 0x28, 0x02, 0x28, 0x5f, 0xf9,
-  0xc1, 0x13, 0xd3, 0x03, 0x6c, 0xb0, 0x13, 0xa0, 0xc0, 0xe9, 0x69, 0x06,
-  0xeb, 0x01, 0x84, 0x8d, 0x2e, 0x99, 0x6a, 0x02, 0xec, 0x91, 0xad, 0x19,
-  0xff, 0x03, 0x84, 0x90, 0x2e, 0x2c, 0x43, 0x21, 0x04, 0xab, 0xf1, 0x42,
-  0xfe, 0x24, 0xa8, 0x36, 0x0c, 0x30, 0x70, 0x93, 0xbc, 0xe4, 0xcd, 0xeb,
-  0xd4, 0x4e, 0x9f, 0x01, 0x9d, 0x85, 0x9d, 0x6a, 0x2b, 0x6d, 0x0c, 0x1b,
-  0x0d, 0xe3, 0x52, 0x00, 0xfc, 0xa5, 0x8a, 0x5e, 0xff, 0x14, 0x66, 0xae,
-  0x01, 0xf0, 0x31, 0x00, 0x8b, 0x90, 0x31, 0x0d, 0x66, 0x4f, 0xc4, 0x29,
-  0x46, 0x5d, 0x20, 0x60, 0x07, 0x01, 0xb6, 0x02, 0x0f, 0xd3, 0x04, 0xc9,
-  0xa6, 0x32, 0x71, 0x10, 0x32, 0xa9, 0x43, 0x4b, 0x21, 0xe4, 0x6e, 0xfd,
-  0x0b, 0x91, 0xac, 0x00, 0x58, 0x5c, 0xee, 0x81, 0xe3, 0x8f, 0x96, 0xe1,
-  0x83, 0x35, 0x17, 0x04, 0xac, 0x2b, 0xb5, 0xd8, 0xc6, 0x84, 0x7c, 0xc4,
-  0x80, 0x29, 0xb0, 0xa7, 0x19, 0xc7, 0x26, 0x7c, 0x48, 0x41, 0x09, 0xa0,
-  0xbe, 0xcc, 0xc8, 0x49, 0x90, 0x84, 0x25, 0xb8, 0x9f, 0x37, 0xfc, 0x30,
-  0xdb, 0x69, 0x16, 0xab, 0x39, 0xcb, 0x03, 0x15, 0x7c, 0x2c, 0x10, 0x10,
-  0x68, 0x87, 0x68, 0x2d, 0xff, 0x54, 0x34, 0xad, 0xdc, 0x09, 0x6c, 0xcb,
-  0x10, 0x0b, 0x6a, 0x30, 0xe1, 0x99, 0xf7, 0xfe, 0x57, 0x11, 0x41, 0xf0,
-  0x74, 0x6d, 0x8c, 0x70, 0x0e, 0xb4, 0x10, 0xdb, 0x50, 0x75, 0x74, 0x31,
-  0x3f, 0xd1, 0xe8, 0xd1, 0xda, 0x6d, 0xda, 0x10, 0x55, 0xbe, 0xc3, 0x03,
-  0xca, 0x13, 0xd8, 0x02, 0xb7, 0x85, 0x89, 0x5e, 0xa8, 0xfe, 0x67, 0xd3,
-  0xc1, 0x35, 0xd5, 0x36, 0xfc, 0x0c, 0x50, 0x00, 0x44, 0xe9, 0x58, 0x70,
-  0x6e, 0xb4, 0xad, 0x25, 0x6f, 0xa2, 0x0d, 0x95, 0xf4, 0x4d, 0xd7, 0x12,
-  0xed, 0x26, 0x81, 0x27, 0x6d, 0x10, 0x4c, 0x9e, 0x9b, 0xab, 0x88, 0x00,
-  0x7d, 0x10, 0x8b, 0x57, 0xfd, 0x89, 0xf7, 0x52, 0x45, 0x2e, 0x8a, 0x7e,
-  0x13, 0x89, 0x07, 0xa1, 0x8a, 0x1d, 0xeb, 0x66, 0x36, 0xc4, 0x75, 0x2a,
-  0xcd, 0x5e, 0xa2, 0x79, 0xe9, 0xd3, 0x0a, 0x9b, 0x62, 0x52, 0x21, 0x6c,
-  0x57, 0x1a, 0xff, 0x54, 0x4b, 0xf6, 0xee, 0x24, 0x2e, 0x4b, 0x30, 0x0a,
-  0x70, 0xeb, 0x0e, 0x98, 0x13, 0x34, 0x91, 0x55, 0xbc, 0x1e, 0xe9, 0xef,
-  0xfe, 0x58, 0x4f, 0x0c, 0x56, 0x21, 0x3f, 0xe7, 0xf7, 0xfa, 0x7c, 0xf8,
-  0x24, 0x05, 0x2f, 0x2a, 0x00, 0x72, 0x1a, 0x82, 0x75, 0xdf, 0x25, 0x0a,
-  0xf8, 0x0f, 0x72, 0xbf, 0x11, 0x0e, 0x77, 0x0b, 0x22, 0xd8, 0xae, 0x77,
-  0x58, 0x8d, 0x62, 0x86, 0xe3, 0x7d, 0xa8, 0x22, 0x8c, 0x28, 0x18, 0x45,
-  0xcd, 0xab, 0x28, 0xdf, 0x72, 0x10, 0x0d, 0x77, 0x91, 0x0a, 0xba, 0xff,
-  0x26, 0x3b, 0x8d, 0xb9, 0x6b, 0x01, 0xa0, 0xe3, 0x3b, 0xe8, 0x30, 0x82,
-  0x7a, 0x0d, 0xb8, 0x6e, 0x52, 0x25, 0x75, 0xb6, 0xa8, 0xfa, 0xdb, 0x31,
-  0x1e, 0x18, 0x23, 0xce, 0x77, 0x0c, 0xd0, 0x3c, 0x23, 0xb1, 0x9b, 0xda,
-  0xeb, 0x97, 0x01, 0x13, 0xcb, 0x90, 0xfc, 0x3b, 0x5e, 0xb7, 0x0b, 0x92,
-  0x3f, 0x63, 0x44, 0x54, 0x30, 0x06, 0x14, 0xef, 0x0a, 0x01, 0x8b, 0x56,
-  0x43, 0xbb, 0xb1, 0xf7, 0x0f, 0xed, 0x75, 0x09, 0xba, 0x59, 0x12, 0xcd,
-  0xad, 0x23, 0xd8, 0xf8, 0x00, 0xd8, 0xc8, 0x1b, 0x72, 0x12, 0x32, 0x0c,
-  0x18, 0xa9, 0x81, 0xb7, 0xeb, 0x3c, 0xd7, 0xd9, 0x40, 0x48, 0x39, 0xc1,
-  0x00, 0x1c, 0x08, 0x83, 0xc0, 0x6b, 0x57, 0xb6, 0xf0, 0x22, 0x62, 0x6d,
-  0x0c, 0x42, 0x6b, 0xe9, 0x16, 0x5f, 0xf5, 0x76, 0x21, 0x3b, 0x0b, 0xd0,
-  0x3e, 0xac, 0x74, 0xef, 0x8d, 0xdb, 0x58, 0xfa, 0xf7, 0x66, 0xb0, 0x5d,
-  0xff, 0x94, 0x22, 0xc9, 0x28, 0xc9, 0x21, 0x4c, 0x0f, 0x9a, 0x00, 0x59,
-  0x36, 0x0f, 0xac, 0x24, 0x74, 0xd6, 0x08, 0x08, 0x2e, 0xba, 0x4f, 0xc5,
-  0x1f, 0x90, 0x01, 0x91, 0x61, 0xde, 0xc1, 0x28, 0x4d, 0xf7, 0xf8, 0x1a,
-  0x68, 0x0c, 0x40, 0x52, 0x82, 0x03, 0x3c, 0xa4, 0x01, 0x5d, 0x39, 0x8c,
-  0x08, 0x71, 0xc5, 0xf8, 0x61, 0x2c, 0xb6, 0x36, 0xf4, 0x54, 0x93, 0x65,
-  0x3f, 0x90, 0x01, 0x3c, 0x48, 0x02, 0x18, 0x0c, 0x48, 0x11, 0xaf, 0x93,
-  0x0c, 0x8b, 0x42, 0x97, 0x7a, 0xd5, 0xeb, 0xdc, 0xc8, 0x79, 0x67, 0xd9,
-  0x61, 0x21, 0xcb, 0x45, 0xb3, 0xc8, 0xeb, 0xba, 0x39, 0x0c, 0x05, 0xdb,
-  0x71, 0xe6, 0x2c, 0xe8, 0xb2, 0xe6, 0xd8, 0xe8, 0x26, 0x72, 0x48, 0xf4,
-  0x8c, 0xeb, 0x93, 0x45, 0xb4, 0xb5, 0x03, 0x45, 0xe8, 0x12, 0x83, 0x1f,
-  0xde, 0x08, 0xb9, 0x98, 0x87, 0xac, 0x2c, 0x35, 0x50, 0x3f, 0xdc, 0x5b,
-  0xf7, 0xfb, 0xb6, 0x99, 0x20, 0xea, 0x0a, 0x44, 0xbb, 0x52, 0x1e, 0x80,
-  0x27, 0x44, 0x67, 0x60, 0x97, 0x13, 0x6f, 0x39, 0xb4, 0xb2, 0x61, 0xe2,
-  0xcb, 0xe4, 0xe2, 0x2f, 0xe4, 0x75, 0x0e, 0x27, 0x51, 0x42, 0x80, 0xc6,
-  0x29, 0x2d, 0xd1, 0x2f, 0x4b, 0xe0, 0xe9, 0xe2, 0x4e, 0x01, 0x3b, 0x50,
-  0x9e, 0xa2, 0x70, 0x21, 0x7d, 0xae, 0x03, 0x3c, 0x14, 0xad, 0x5e, 0x3b,
-  0xb6, 0xe4, 0x02, 0xe2, 0x8d, 0x32, 0xb7, 0xba, 0x0d, 0xf7, 0xea, 0xad,
-  0x99, 0x18, 0x96, 0xf6, 0xf4, 0x08, 0xec, 0x33, 0x53, 0x51, 0x53, 0x6c,
-  0xaa, 0x48, 0xff, 0x42, 0xdb, 0xec, 0xe6, 0x00, 0x32, 0xd0, 0x92, 0x3f,
-  0xf9, 0x62, 0x5b, 0x69, 0xc6, 0x88, 0x70, 0xcc, 0xfe, 0x56, 0x14, 0x0f,
-  0xe8, 0x72, 0x0d, 0x76, 0x2a, 0xd3, 0x00, 0xa5, 0x38, 0xda, 0xe6, 0x72,
-  0x07, 0xb5, 0xba, 0x04, 0xe8, 0x41, 0x4d, 0xfa, 0x9a, 0x3d, 0x0c, 0x9d,
-  0x19, 0xbf, 0x68, 0x10, 0x26, 0x40, 0x60, 0x54, 0x0c, 0x65, 0xb2, 0x71,
-  0xd0, 0x77, 0x66, 0x6f, 0x83, 0x2a, 0x06, 0xe6, 0x64, 0x06, 0xee, 0x0a,
-  0xf4, 0xe6, 0x02, 0x1e, 0x2d, 0x24, 0x96, 0xe0, 0xde, 0x43, 0xcc, 0xad,
-  0xfc, 0xa1, 0x60, 0x06, 0xff, 0x05, 0xc8, 0x70, 0x64, 0xa3, 0x95, 0xa7,
-  0x08, 0xec, 0x1d, 0xeb, 0x61, 0x6d, 0x01, 0x96, 0x71, 0x03, 0x5c, 0x09,
-  0xfe, 0x15, 0x90, 0xdf, 0xed, 0xf0, 0x73, 0xc0, 0x5a, 0x9b, 0x35, 0xd9,
-  0xb7, 0xca, 0xee, 0x09, 0x47, 0x1d, 0xd9, 0x4b, 0xec, 0xea, 0xb6, 0x01,
-  0x0d, 0x11, 0xda, 0x1a, 0x46, 0x54, 0x29, 0xa8, 0xca, 0x23, 0x65, 0x0d,
-  0x6c, 0xac, 0xfe, 0xbd, 0x3b, 0xd6, 0x7e, 0xbb, 0x25, 0x99, 0xfe, 0x60,
-  0x09, 0x01, 0x25, 0x45, 0x8e, 0xb4, 0xd1, 0x1c, 0x56, 0x0a, 0x33, 0xd6,
-  0x8c, 0x04, 0xca, 0xf2, 0x0c, 0x11, 0x06, 0x8f, 0x30, 0xb3, 0xa5, 0x21,
-  0x32, 0x28, 0x11, 0x79, 0x18, 0xc6, 0x79, 0xfe, 0xf5, 0xe5, 0xe4, 0x96,
-  0xe6, 0xe4, 0x59, 0xe6, 0x0e, 0x93, 0x42, 0x70, 0xf2, 0x01, 0x61, 0x54,
-  0xe4, 0xe2, 0xf5, 0xc6, 0x7c, 0x1c, 0x96, 0xbc, 0xd6, 0xeb, 0xdd, 0x60,
-  0x46, 0x1a, 0x32, 0x2c, 0xc3, 0xc8, 0x6c, 0x87, 0x01, 0x2e, 0xe5, 0x99,
-  0xe0, 0xa7, 0xeb, 0xae, 0xc0, 0x66, 0x43, 0x98, 0xa0, 0x4d, 0x8e, 0x26,
-  0x4b, 0x20, 0xea, 0x5a, 0x3b, 0x60, 0x4e, 0x0b, 0x4b, 0xf4, 0xa3, 0x74,
-  0x50, 0x05, 0x30, 0x61, 0xc6, 0x5d, 0x8b, 0xec, 0xa5, 0x5e, 0xe4, 0x12,
-  0x25, 0x0d, 0x03, 0x58, 0x01, 0x07, 0x1b, 0x24, 0x23, 0xbe, 0xe5, 0xa6,
-  0x96, 0x31, 0x37, 0x20, 0x43, 0xd1, 0x41, 0xc3, 0x14, 0x12, 0x0b, 0xc8,
-  0xd3, 0xf7, 0xcb, 0xe8, 0xea, 0x10, 0xe0, 0x20, 0xac, 0x36, 0x04, 0x61,
-  0x68, 0xe4, 0x56, 0xf8, 0x96, 0x61, 0x53, 0xb0, 0x1b, 0x68, 0xcf, 0x2c,
-  0xd5, 0x90, 0xe7, 0x69, 0xfa, 0x41, 0xeb, 0x66, 0xe7, 0x65, 0xee, 0x90,
-  0xec, 0x19, 0x05, 0xb6, 0x74, 0x11, 0x16, 0x12, 0x06, 0x11, 0x60, 0x5b,
-  0x1c, 0xc3, 0xaa, 0xd1, 0x98, 0x06, 0xca, 0x83, 0xc0, 0x36, 0x02, 0xcb,
-  0xea, 0xe8, 0x11, 0x20, 0x63, 0x8c, 0x9c, 0xe4, 0x0e, 0x86, 0x35, 0xc0,
-  0xa1, 0x19, 0xcd, 0x65, 0x2d, 0x92, 0x33, 0x1a, 0x0f, 0x84, 0x35, 0xc2,
-  0xa0, 0xec, 0x6b, 0xfe, 0x34, 0x24, 0x49, 0x0f, 0x68, 0xa9, 0x13, 0x31,
-  0x65, 0x78, 0xe4, 0xe3, 0x01, 0x39, 0x91, 0x08, 0x72, 0xbe, 0xf3, 0x17,
-  0xe6, 0x90, 0x01, 0x3d, 0x1c, 0x01, 0x49, 0x9c, 0x5d, 0xe8, 0x93, 0x53,
-  0x97, 0x21, 0x0e, 0x56, 0xf3, 0x03, 0x58, 0x0b, 0x8c, 0x0c, 0x50, 0xe5,
-  0xeb, 0xe4, 0xa2, 0xeb, 0xa9, 0xd4, 0xc8, 0x6a, 0xc2, 0x12, 0xc0, 0x67,
-  0x59, 0x4e, 0x10, 0xc0, 0x5b, 0x51, 0x11, 0xc8, 0x30, 0x44, 0x7a, 0x50,
-  0x20, 0x20, 0xab, 0xde, 0xe5, 0x27, 0x41, 0x1d, 0x28, 0x2b, 0x2c, 0x29,
-  0x12, 0x9a, 0x88, 0xbf, 0x87, 0x74, 0x4f, 0x14, 0xd3, 0x1f, 0x2d, 0x84,
-  0x14, 0xc6, 0x6a, 0x05, 0xa9, 0x77, 0x07, 0xf7, 0x01, 0x25, 0xed, 0x1f,
-  0xff, 0xde, 0x14, 0x5e, 0x1a, 0x22, 0xf1, 0x93, 0x4b, 0x33, 0x29, 0x2c,
-  0x2b, 0x51, 0x80, 0x80, 0xb2, 0x5a, 0xd2, 0x81, 0x58, 0x60, 0xbe, 0x6b,
-  0x18, 0x8f, 0xe5, 0x89, 0x48, 0xe6, 0x0c, 0x1e, 0x53, 0x45, 0xa1, 0x07,
-  0xa5, 0x27, 0x08, 0x5a, 0x79, 0x63, 0xf2, 0x0b, 0xc8, 0x1e, 0x02, 0x1e,
-  0x9c, 0x03, 0xa9, 0xb3, 0x0e, 0xf2, 0xac, 0x79, 0x86, 0x0c, 0x4f, 0x21,
-  0x02, 0x11, 0xea, 0x7a, 0xc2, 0xa0, 0xe5, 0xf2, 0x96, 0xf4, 0xf2, 0x59,
-  0xf4, 0x0e, 0x24, 0xcb, 0x56, 0x4d, 0xaf, 0xa5, 0x08, 0x5e, 0x72, 0xe8,
-  0x16, 0xa5, 0xa2, 0x08, 0x54, 0xa9, 0x98, 0x06, 0x01, 0xd9, 0x6e, 0x11,
-  0x56, 0x09, 0x01, 0xa9, 0x22, 0x2c, 0x21, 0x33, 0xe4, 0x2a, 0x02, 0xb9,
-  0x46, 0x70, 0x43, 0xff, 0x48, 0xd7, 0x61, 0x6d, 0x64, 0xf6, 0x0b, 0xb3,
-  0x24, 0x22, 0x18, 0xd4, 0x4d, 0x2f, 0x80, 0x46, 0xc6, 0xff, 0xdd, 0xec,
-  0xfc, 0xfe, 0xa8, 0xd9, 0xa5, 0x75, 0x6d, 0x64, 0x30, 0x8f, 0x73, 0x1b,
-  0xe5, 0xe3, 0xa3, 0x00, 0xf4, 0x09, 0x17, 0x70, 0xcf, 0x0f, 0x0a, 0x8d,
-  0xc7, 0xdf, 0x42, 0x17, 0xb7, 0x04, 0x10, 0x00, 0x60, 0x20, 0x4c, 0xff,
-  0x8c, 0xff, 0x9e, 0x33, 0xc9, 0x8a, 0x34, 0x55, 0x59, 0x63, 0xab, 0x90,
-  0x01, 0x17, 0x71, 0xd1, 0x07, 0x8c, 0xe4, 0x4f, 0x40, 0xce, 0x98, 0x0e,
-  0x53, 0x26, 0x39, 0x01, 0x1b, 0x7f, 0xfa, 0x3e, 0xfc, 0x52, 0xbb, 0x57,
-  0xe6, 0x50, 0x52, 0x12, 0x5f, 0xe6, 0x25, 0x00, 0x5d, 0x86, 0xe6, 0x4c,
-  0x57, 0xe5, 0x66, 0xc9, 0xd7, 0xfc, 0x40, 0xcf, 0x82, 0x39, 0x7b, 0x27,
-  0x3e, 0x2c, 0x42, 0x35, 0xb0, 0x4e, 0x01, 0xf4, 0x81, 0x66, 0xe6, 0x0f,
-  0x07, 0xbd, 0x0a, 0x5e, 0x3b, 0xe0, 0xeb, 0xb2, 0x87, 0xb0, 0xb2, 0x52,
-  0xe7, 0x06, 0xff, 0x4a, 0x36, 0x20, 0x6c, 0x8c, 0x19, 0x0e, 0x16, 0x56,
-  0xd4, 0x56, 0xf2, 0x59, 0x62, 0x72, 0x0a, 0x6c, 0x8a, 0xb9, 0xe2, 0x01,
-  0x73, 0x3f, 0x04, 0x79, 0x10, 0xff, 0x0f, 0x54, 0x5a, 0x57, 0xdb, 0x04,
-  0xe4, 0xe7, 0x41, 0xcd, 0x59, 0x2c, 0xdb, 0xe2, 0x01, 0x6d, 0x11, 0x6b,
-  0x57, 0x40, 0xde, 0x55, 0xca, 0x45, 0x58, 0x40, 0x6b, 0x79, 0x71, 0x20,
-  0x50, 0x84, 0x0d, 0x20, 0xa4, 0xb5, 0x0c, 0x88, 0xb8, 0xec, 0x61, 0x17,
-  0x29, 0x30, 0x1e, 0x87, 0x2d, 0x06, 0xd4, 0x1d, 0xbb, 0xd1, 0x87, 0x2f,
-  0x0b, 0x7f, 0x0b, 0x87, 0x31, 0x06, 0x75, 0x1e, 0x46, 0x0e, 0xcc, 0xf2,
-  0x0a, 0xb8, 0x69, 0x50, 0xb6, 0x28, 0xfc, 0x26, 0x0d, 0x89, 0xf9, 0x1f,
-  0x89, 0x97, 0x5e, 0x0c, 0xc9, 0x2c, 0xc1, 0x74, 0x56, 0xcd, 0x6c, 0x29,
-  0xc0, 0x05, 0x01, 0x72, 0x4c, 0x13, 0x23, 0x44, 0x6c, 0x82, 0x3c, 0x54,
-  0xf1, 0xf7, 0xee, 0x53, 0x13, 0xc5, 0xf8, 0xb2, 0xdf, 0xf6, 0x6b, 0x63,
-  0x05, 0x0e, 0x4d, 0x04, 0x8d, 0x62, 0xea, 0x8c, 0x61, 0x6f, 0x31, 0x04,
-  0x6e, 0x4e, 0x9a, 0xae, 0xe0, 0x6a, 0x32, 0x5e, 0x25, 0xae, 0xeb, 0x03,
-  0x7c, 0xbf, 0x11, 0x92, 0xda, 0x4a, 0x49, 0xd5, 0x50, 0x81, 0x0f, 0xed,
-  0x88, 0xee, 0x97, 0x55, 0xa8, 0xdd, 0x42, 0xee, 0x52, 0x5a, 0x0e, 0xb1,
-  0x03, 0x01, 0x1b, 0xc0, 0x60, 0x2b, 0xa9, 0x47, 0x21, 0xd9, 0x74, 0x2e,
-  0x10, 0x83, 0x5d, 0x23, 0xb2, 0x17, 0x16, 0x98, 0x0a, 0x70, 0xe2, 0x8d,
-  0x3a, 0x5a, 0x48, 0xc5, 0xcd, 0x0a, 0x01, 0x15, 0xf6, 0xfa, 0x4a, 0x76,
-  0x12, 0x83, 0xe4, 0x21, 0x8a, 0xee, 0xdc, 0xfb, 0x9e, 0x02, 0x81, 0xd9,
-  0x19, 0x5c, 0x81, 0x33, 0x85, 0x63, 0xf7, 0xfc, 0x8b, 0x73, 0xc4, 0x25,
-  0x9b, 0xe4, 0x7c, 0x20, 0x6c, 0x56, 0xc0, 0x8a, 0x67, 0x09, 0x7c, 0xaf,
-  0x13, 0x40, 0x84, 0xef, 0xcc, 0xe6, 0x8a, 0x47, 0xaf, 0xdc, 0x07, 0x60,
-  0x7e, 0xef, 0x06, 0xa3, 0x0a, 0x45, 0x3b, 0xaf, 0x08, 0x42, 0x3c, 0x5e,
-  0xb8, 0x0a, 0xa2, 0xc9, 0xf1, 0x16, 0xa2, 0x03, 0x78, 0x15, 0xae, 0x20,
-  0x33, 0x41, 0xcc, 0x5b, 0x57, 0xc5, 0x56, 0x8a, 0x08, 0xa9, 0xa9, 0x0e,
-  0xfc, 0x42, 0xd1, 0x52, 0x8c, 0x62, 0x2c, 0x41, 0xf6, 0xeb, 0x37, 0x36,
-  0x6f, 0x27, 0x11, 0x66, 0x5a, 0xa2, 0xcd, 0x1a, 0xdf, 0x11, 0xa1, 0xe0,
-  0x07, 0x8b, 0x16, 0xbc, 0xde, 0x3d, 0x47, 0xe0, 0xa0, 0x33, 0xb1, 0x75,
-  0x11, 0xa3, 0xc1, 0x18, 0x2e, 0x36, 0x22, 0x0b, 0x14, 0x7e, 0x3c, 0x23,
-  0xa3, 0x3e, 0x23, 0x81, 0x26, 0x03, 0x87, 0xe9, 0x75, 0x61, 0xde, 0xb7,
-  0x1e, 0x0b, 0x06, 0x68, 0x1f, 0x47, 0x03, 0x39, 0xc4, 0xb5, 0x1e, 0x0d,
-  0x07, 0x53, 0x0c, 0xcd, 0x6c, 0x07, 0x0d, 0xd0, 0x7a, 0x72, 0x0e, 0x7c,
-  0x40, 0x08, 0x67, 0xb0, 0x14, 0x68, 0x08, 0xb9, 0xd7, 0x82, 0x5b, 0x19,
-  0x81, 0x16, 0xd9, 0x0b, 0x74, 0x07, 0xeb, 0x32, 0x7b, 0xb5, 0x25, 0x0d,
-  0x18, 0x1e, 0x8a, 0x10, 0x1e, 0x96, 0xe9, 0x12, 0x8c, 0xd6, 0xc1, 0x0e,
-  0xc8, 0x30, 0x22, 0xd0, 0x06, 0x20, 0x4c, 0x2c, 0x34, 0xdb, 0x14, 0xb0,
-  0x12, 0x12, 0xb5, 0x28, 0x0c, 0xaa, 0xdc, 0x02, 0xe5, 0x08, 0x8b, 0x6f,
-  0x5d, 0x31, 0x08, 0x6e, 0x43, 0xe2, 0xa8, 0x07, 0x40, 0xba, 0xd0, 0x1d,
-  0x36, 0xb0, 0xc0, 0x00, 0xc6, 0x5b, 0x4e, 0xe9, 0xd5, 0x9b, 0x00, 0xd4,
-  0x7b, 0x83, 0xa8, 0x6c, 0x06, 0xc5, 0x8a, 0xf4, 0x1c, 0xd7, 0x57, 0x99,
-  0x57, 0x30, 0x49, 0x54, 0xd4, 0x62, 0xd2, 0x8b, 0x81, 0x3c, 0xd5, 0x03,
-  0xee, 0x4e, 0x93, 0x0c, 0x8d, 0x4d, 0x6e, 0xf5, 0xaf, 0xeb, 0xb6, 0x80,
-  0x47, 0x1c, 0x03, 0xfa, 0x6c, 0x3e, 0x3c, 0x15, 0x52, 0x67, 0x6c, 0x38,
-  0x05, 0x87, 0x18, 0x1f, 0x72, 0x3c, 0xfa, 0x5f, 0x06, 0xa0, 0x6d, 0xb2,
-  0xeb, 0x12, 0x9d, 0x43, 0x59, 0xb6, 0x7f, 0x6a, 0x89, 0xc5, 0x70, 0x07,
-  0x99, 0x60, 0x22, 0x46, 0x64, 0x5d, 0x16, 0x59, 0xea, 0x75, 0xff, 0x43,
-  0xe5, 0xb6, 0xfe, 0x9e, 0x8a, 0xdb, 0x02, 0x3a, 0xc4, 0x54, 0xda, 0xdb,
-  0x5a, 0xff, 0x10, 0x37, 0x9a, 0x0e, 0xa6, 0xc0, 0x00, 0x60, 0xbb, 0x62,
-  0x51, 0xe6, 0x16, 0xcc, 0x42, 0xd4, 0x5f, 0x06, 0x47, 0xe5, 0x13, 0x08,
-  0xc9, 0xeb, 0x07, 0x60, 0x58, 0x6a, 0x57, 0x90, 0xa4, 0x72, 0xb5, 0x0a,
-  0x53, 0x16, 0x67, 0x96, 0x7d, 0x10, 0x81, 0xcf, 0xa9, 0xb0, 0x51, 0x19,
-  0xea, 0x1c, 0xf4, 0x02, 0x80, 0x4c, 0x21, 0x23, 0x17, 0x12, 0xd0, 0xe9,
-  0x6d, 0xb2, 0x7c, 0xff, 0xf2, 0x11, 0x83, 0xff, 0x84, 0x20, 0x19, 0x83,
-  0x5b, 0x7a, 0xbf, 0x40, 0x85, 0x03, 0xd5, 0xfc, 0xe1, 0x96, 0x42, 0x0e,
-  0x86, 0x5e, 0x96, 0xeb, 0x9d, 0x1a, 0x2c, 0xf6, 0x80, 0xe5, 0x82, 0x19,
-  0x1c, 0x1d, 0x0e, 0x9c, 0x25, 0x88, 0x00, 0x6c, 0x25, 0xff, 0x30, 0x17,
-  0xb3, 0x6f, 0x50, 0x34, 0x44, 0xfa, 0x2b, 0x28, 0xe6, 0xe4, 0x8a, 0x99,
-  0x18, 0x21, 0x04, 0x7f, 0x28, 0xe9, 0xcc, 0x00, 0x07, 0xb0, 0xc2, 0x0a,
-  0x4f, 0xcd, 0xf6, 0xf8, 0x0c, 0xe7, 0x16, 0xe4, 0xfa, 0x8a, 0x7e, 0xd8,
-  0x7e, 0x9a, 0xdc, 0x83, 0x75, 0xd9, 0xf9, 0x6c, 0x6b, 0x39, 0x9a, 0x65,
-  0x03, 0xd9, 0x09, 0xff, 0xe2, 0xbc, 0x99, 0x25, 0xff, 0x76, 0x1b, 0x1c,
-  0x78, 0x9a, 0xea, 0xb0, 0x2f, 0x5f, 0x37, 0x9f, 0x2c, 0xcb, 0x5b, 0x26,
-  0xd1, 0x43, 0xfb, 0x55, 0xf2, 0x5f, 0x7b, 0x0f, 0x61, 0x23, 0x3b, 0xeb,
-  0x4e, 0x0e, 0x09, 0x09, 0x4b, 0xb0, 0x5c, 0x10, 0x1f, 0x05, 0x0c, 0x24,
-  0x8d, 0x1f, 0xb3, 0x1d, 0x56, 0x96, 0xaf, 0x74, 0x5a, 0x7a, 0x56, 0x23,
-  0xcf, 0xaa, 0x2e, 0x79, 0x50, 0xb1, 0xf0, 0x7d, 0xb3, 0x0b, 0x29, 0xc6,
-  0x5f, 0x0c, 0x12, 0x21, 0x44, 0x3b, 0x38, 0x4b, 0x68, 0x16, 0x84, 0x0b,
-  0x25, 0x10, 0x8c, 0xe7, 0xca, 0xc2, 0x8c, 0x86, 0x37, 0x58, 0xc5, 0xc4,
-  0x18, 0x0d, 0x0e, 0xeb, 0x66, 0xd8, 0x8a, 0xf2, 0xaa, 0x45, 0xe6, 0x62,
-  0xab, 0x9d, 0x4e, 0x20, 0xe5, 0xa4, 0x73, 0xd7, 0x5e, 0x5d, 0x04, 0x0d,
-  0x06, 0x2d, 0x16, 0x7a, 0x65, 0xa0, 0x47, 0x05, 0xb8, 0x07, 0x15, 0x20,
-  0x04, 0x8c, 0x88, 0x1c, 0xbc, 0x09, 0xa8, 0xc4, 0x70, 0x6b, 0x03, 0x67,
-  0x26, 0xd0, 0x4b, 0x11, 0x49, 0x31, 0x74, 0x81, 0x52, 0xab, 0xaa, 0x4b,
-  0x58, 0x0f, 0xcb, 0xf0, 0x24, 0xc9, 0x3c, 0x0b, 0x28, 0xd5, 0x21, 0x78,
-  0xd9, 0xf1, 0x26, 0x32, 0x4d, 0x42, 0xac, 0x47, 0x06, 0xf2, 0xc9, 0x24,
-  0x92, 0x63, 0x14, 0x52, 0xf3, 0xa5, 0x56, 0xbd, 0x50, 0x51, 0x66, 0x85,
-  0xa1, 0xeb, 0x02, 0x6c, 0x15, 0xbb, 0xe8, 0xf6, 0xb0, 0x81, 0x38, 0x28,
-  0x01, 0x02, 0x90, 0x09, 0x40, 0xc0, 0x04, 0x0d, 0x04, 0x8d, 0xb4, 0x96,
-  0x4a, 0x04, 0xa1, 0xf6, 0x69, 0x31, 0x65, 0x63, 0xaa, 0xc1, 0xf5, 0xc2,
-  0xb8, 0x06, 0x1e, 0x42, 0xa0, 0x43, 0x45, 0x50, 0x86, 0x5c, 0xa1, 0x0f,
-  0x24, 0x24, 0x0a, 0xd9, 0x11, 0xea, 0xd8, 0x0a, 0xcd, 0x0e, 0x0c, 0x01,
-  0x43, 0x93, 0x6a, 0x54, 0x95, 0x1b, 0x62, 0x2b, 0x2a, 0xaa, 0xce, 0x33,
-  0xd5, 0x65, 0xed, 0x18, 0x01, 0xfd, 0x21, 0x7e, 0xfa, 0x14, 0x01, 0x49,
-  0xf3, 0xeb, 0xb4, 0xeb, 0xb2, 0xb3, 0xe7, 0x65, 0xff, 0x80, 0x32, 0x04,
-  0x59, 0xfb, 0x60, 0xd6, 0xd2, 0x72, 0x40, 0xa1, 0x63, 0x25, 0xb2, 0x72,
-  0x24, 0x00, 0xd5, 0x1d, 0x80, 0xec, 0xca, 0x40, 0xe0, 0x26, 0x06, 0x4d,
-  0x04, 0xa0, 0xc0, 0xce, 0x66, 0x30, 0xdd, 0xc3, 0x08, 0x04, 0xbe, 0x3e,
-  0x96, 0x08, 0x00, 0x48, 0x86, 0x72, 0x1b, 0x0b, 0x1d, 0x15, 0xe1, 0x29,
-  0xd4, 0x64, 0x33, 0x2c, 0x26, 0xa1, 0xba, 0x7c, 0x56, 0x80, 0xc0, 0x53,
-  0x95, 0x19, 0xcf, 0x6c, 0x7b, 0x86, 0x44, 0x42, 0xae, 0x47, 0x00, 0xc2,
-  0x92, 0x5e, 0x71, 0xca, 0x7f, 0xd1, 0x81, 0x8d, 0x68, 0x0c, 0x29, 0x36,
-  0x81, 0x03, 0x58, 0x24, 0xc8, 0xcc, 0x48, 0x2b, 0xa6, 0x64, 0xfb, 0x86,
-  0x0e, 0xcf, 0x81, 0x5b, 0x00, 0x07, 0xea, 0x28, 0x3c, 0xb5, 0x16, 0x7f,
-  0x03, 0xa8, 0x17, 0xe3, 0xae, 0x78, 0x89, 0x54, 0xac, 0xff, 0x81, 0x7f,
-  0x02, 0x61, 0x41, 0x75, 0xb7, 0x2a, 0x07, 0x3f, 0x52, 0xed, 0x52, 0x75,
-  0x23, 0x06, 0xfe, 0xbf, 0xe6, 0x01, 0x41, 0x61, 0x75, 0x1a, 0xef, 0x08,
-  0xe4, 0x01, 0x72, 0x72, 0xcc, 0x75, 0x11, 0xb7, 0x46, 0x55, 0xaa, 0x45,
-  0x4b, 0x0b, 0x83, 0xda, 0xbf, 0xfc, 0x9c, 0xc9, 0xa1, 0x41, 0x48, 0x47,
-  0x84, 0xb4, 0x1c, 0x09, 0x01, 0x83, 0xeb, 0xb0, 0x20, 0x11, 0x90, 0x9c,
-  0x07, 0x69, 0x81, 0x8a, 0x0c, 0xf6, 0x24, 0x24, 0x5e, 0xc9, 0x7a, 0x32,
-  0xd5, 0x05, 0x83, 0xf6, 0x0f, 0x3d, 0x0c, 0x6f, 0x83, 0x0d, 0x3d, 0x10,
-  0x6f, 0x04, 0x08, 0x3d, 0x20, 0x2f, 0x17, 0xe9, 0x9e, 0x41, 0x72, 0x7c,
-  0x23, 0x88, 0x64, 0x02, 0x9c, 0xe9, 0x9d, 0x0c, 0xfb, 0x12, 0x13, 0xb9,
-  0x0c, 0x38, 0x88, 0xa3, 0x96, 0x45, 0x09, 0x47, 0x0e, 0x96, 0xfd, 0x13,
-  0x11, 0x8b, 0x41, 0xbe, 0x1e, 0x87, 0xee, 0x01, 0xde, 0x04, 0x97, 0xec,
-  0x01, 0x2c, 0xfc, 0xb4, 0x43, 0xfc, 0x28, 0x05, 0x3d, 0x45, 0x32, 0xd1,
-  0x23, 0x2c, 0xd0, 0x87, 0xb9, 0x0e, 0x61, 0x7b, 0x72, 0xbe, 0xb0, 0xfe,
-  0x90, 0x34, 0x6a, 0x13, 0x27, 0x02, 0x9a, 0x20, 0x68, 0x21, 0x12, 0x0b,
-  0x08, 0xe2, 0x0c, 0xab, 0x93, 0xdf, 0x25, 0x48, 0xc1, 0x64, 0x90, 0xae,
-  0x9b, 0x40, 0xd7, 0x0b, 0xc9, 0xbe, 0xfc, 0xc9, 0x1a, 0xcf, 0xea, 0xe8,
-  0x20, 0x2c, 0xb0, 0xad, 0x86, 0x9a, 0x00, 0xcb, 0x6c, 0x8c, 0xc4, 0xf9,
-  0x29, 0x05, 0x25, 0xd3, 0x86, 0x2e, 0x68, 0x04, 0x66, 0x38, 0x3c, 0x47,
-  0xd3, 0x20, 0x13, 0xe8, 0x3c, 0xea, 0xe1, 0x14, 0xe8, 0x3a, 0x43, 0xe1,
-  0x88, 0xea, 0xd0, 0xf2, 0x6c, 0xaa, 0xee, 0xb2, 0xe6, 0xc0, 0xe8, 0x03,
-  0x4b, 0x81, 0x28, 0x03, 0xbf, 0x48, 0x5a, 0x29, 0x09, 0x74, 0x04, 0x18,
-  0xf6, 0xf0, 0x5a, 0x5a, 0x30, 0x2d, 0xdc, 0x39, 0x88, 0x98, 0xfe, 0x4c,
-  0xf8, 0x81, 0x29, 0x14, 0x66, 0x4b, 0x2d, 0x2c, 0xed, 0xd6, 0x05, 0x73,
-  0x04, 0x8a, 0xda, 0xeb, 0xf2, 0x12, 0x0f, 0x74, 0xde, 0x8a, 0x01, 0xd6,
-  0xef, 0xdc, 0x0b, 0xcb, 0xe6, 0xd8, 0x8a, 0x8b, 0x5c, 0xb9, 0x46, 0xfe,
-  0xee, 0x04, 0x9e, 0xc6, 0xd6, 0xdd, 0x56, 0xe3, 0x24, 0x55, 0xe0, 0x93,
-  0x29, 0x48, 0xd4, 0x12, 0xc8, 0x63, 0xc7, 0x2e, 0x60, 0x20, 0x57, 0x7e,
-  0x67, 0x36, 0xa1, 0xf2, 0xdb, 0x08, 0xa0, 0xb0, 0x9b, 0x08, 0xee, 0x6f,
-  0x5c, 0xdc, 0x03, 0x73, 0xdf, 0xb8, 0x04, 0x9f, 0x34, 0x28, 0x0d, 0xd5,
-  0x90, 0xf4, 0xdc, 0x6c, 0x08, 0x18, 0xe5, 0x5e, 0x86, 0x8c, 0xf5, 0x41,
-  0x2d, 0xba, 0xe2, 0xb0, 0x2e, 0xa2, 0x4c, 0x45, 0xeb, 0xad, 0xf8, 0xa7,
-  0x9c, 0xed, 0xde, 0x10, 0xe0, 0x2c, 0x00, 0xc3, 0x84, 0x9e, 0xcc, 0xdc,
-  0x40, 0x62, 0xd8, 0xa9, 0x7b, 0x1a, 0x0b, 0x36, 0x8a, 0xcc, 0x77, 0x4a,
-  0x44, 0xa8, 0x08, 0xe9, 0x0a, 0x48, 0x2f, 0x43, 0xe2, 0x23, 0x04, 0xb4,
-  0x74, 0x03, 0x72, 0xff, 0xc1, 0xa8, 0x91, 0x7b, 0x15, 0x20, 0x5e, 0x8c,
-  0x4d, 0xd1, 0xf9, 0x09, 0x38, 0x09, 0x64, 0x26, 0x27, 0x95, 0x00, 0x40,
-  0x25, 0xea, 0x36, 0x0c, 0x28, 0x7a, 0x2a, 0x00, 0x2f, 0x73, 0x04, 0xe0,
-  0x5b, 0x24, 0xa5, 0x87, 0x74, 0x24, 0x59, 0xdc, 0x8a, 0xc9, 0xf9, 0x06,
-  0x13, 0x00, 0xd9, 0x15, 0x47, 0xc0, 0x30, 0x19, 0xc0, 0x7d, 0x8d, 0xeb,
-  0x8b, 0x98, 0x34, 0xa1, 0x26, 0x09, 0x7c, 0x26, 0x36, 0x58, 0xbf, 0x18,
-  0x89, 0x50, 0x09, 0x61, 0xef, 0x62, 0xe7, 0xf4, 0xec, 0xe4, 0x66, 0x01,
-  0x83, 0x93, 0x17, 0xab, 0x4e, 0x20, 0x0b, 0xd8, 0x5d, 0x01, 0xed, 0x53,
-  0x52, 0x2f, 0xd4, 0xeb, 0xdb, 0x60, 0x1e, 0xa8, 0x4b, 0xa9, 0xb0, 0x22,
-  0xaf, 0x96, 0x2b, 0x70, 0x58, 0x12, 0x92, 0x42, 0x12, 0x22, 0xbf, 0xf7,
-  0xd8, 0x1b, 0xc0, 0x89, 0x40, 0x18, 0x36, 0x3f, 0x57, 0x5e, 0x65, 0x95,
-  0xe5, 0xe9, 0x67, 0xd5, 0x64, 0xff, 0x58, 0x6c, 0x84, 0x48, 0xc1, 0x95,
-  0xb5, 0xb2, 0x4b, 0x64, 0x31, 0x25, 0x9b, 0x34, 0x58, 0x09, 0x90, 0x65,
-  0x10, 0x2a, 0x55, 0xab, 0x97, 0x40, 0x03, 0x15, 0x30, 0x5c, 0xd8, 0x3a,
-  0x8b, 0xb2, 0x2b, 0x1a, 0x3f, 0xc2, 0x55, 0xb4, 0x2e, 0xe0, 0xeb, 0x2b,
-  0x08, 0x5e, 0x21, 0x04, 0xb0, 0x01, 0xd6, 0x29, 0x03, 0xe1, 0x0a, 0xc0,
-  0xab, 0x0e, 0x70, 0x4b, 0x73, 0x1e, 0x49, 0x18, 0x03, 0x61, 0x5f, 0x12,
-  0x08, 0x02, 0x21, 0x28, 0x09, 0xa6, 0x4d, 0xef, 0x10, 0x92, 0x28, 0xbd,
-  0xe2, 0x9a, 0xec, 0x04, 0x7f, 0xa5, 0xa0, 0x05, 0xb3, 0xc0, 0x7e, 0x40,
-  0xc4, 0x9f, 0x5c, 0x03, 0xd8, 0x11, 0xdf, 0x97, 0x8a, 0x4e, 0xf8, 0x80,
-  0xe1, 0xf7, 0x07, 0xd3, 0xf8, 0x25, 0x6a, 0x8b, 0x3a, 0x2c, 0x57, 0xf8,
-  0x86, 0xf7, 0x5e, 0xe4, 0x31, 0x23, 0xce, 0x8c, 0x11, 0xa3, 0x97, 0x03,
-  0x18, 0xf7, 0x32, 0xa0, 0x13, 0xe8, 0x8c, 0x03, 0x54, 0x19, 0x0d, 0x11,
-  0x08, 0xbc, 0x8d, 0x11, 0x96, 0xee, 0xf0, 0x43, 0x80, 0xa3, 0x9c, 0x9a,
-  0x10, 0x81, 0x6f, 0xda, 0xb4, 0x77, 0x34, 0x33, 0x64, 0xd8, 0xc8, 0xa6,
-  0x0f, 0xac, 0xeb, 0xaa, 0x11, 0x61, 0x68, 0x4c, 0x17, 0x27, 0x9d, 0xa9,
-  0x20, 0x32, 0x7b, 0xc8, 0x78, 0xe1, 0x9a, 0x07, 0x69, 0xc4, 0x62, 0x18,
-  0xd9, 0x2e, 0xea, 0x64, 0xec, 0x39, 0xac, 0x01, 0x96, 0x4c, 0x49, 0x42,
-  0x55, 0x25, 0xd9, 0xc4, 0x24, 0x63, 0x4f, 0x9a, 0x8c, 0x4f, 0x08, 0x06,
-  0xb2, 0xc0, 0x3b, 0x65, 0x10, 0xd7, 0x0d, 0xff, 0x23, 0x6a, 0xe9, 0xb9,
-  0x69, 0xfb, 0xf0, 0x5c, 0xe9, 0xbb, 0x98, 0xf4, 0xe9, 0xc0, 0xef, 0x00,
-  0x15, 0xd8, 0xa3, 0x75, 0x20, 0xa4, 0x40, 0x10, 0x19, 0x01, 0x80, 0x8f,
-  0x11, 0x91, 0x3a, 0x00, 0x3b, 0xc3, 0x5e, 0x36, 0x1f, 0x68, 0x40, 0x52,
-  0xb8, 0x6d, 0xa4, 0x87, 0x5e, 0x26, 0x28, 0x6b, 0x29, 0x8b, 0xf8, 0x11,
-  0x42, 0x38, 0x35, 0x5e, 0xb8, 0xbb, 0x4e, 0xf2, 0xa4, 0x01, 0x51, 0x81,
-  0x38, 0x76, 0x62, 0xbd, 0x12, 0x8b, 0xae, 0xec, 0xe6, 0xca, 0x26, 0xc2,
-  0x40, 0x7e, 0x45, 0xfe, 0xe9, 0x42, 0xfe, 0xca, 0x30, 0x39, 0xc9, 0x01,
-  0x96, 0x14, 0x11, 0xa9, 0x63, 0x65, 0xf2, 0xd9, 0xf4, 0x00, 0xfd, 0xc6,
-  0x03, 0x64, 0xc0, 0x13, 0x68, 0xb3, 0x36, 0x8a, 0x1d, 0xd8, 0x9e, 0x3b,
-  0x5b, 0x06, 0x76, 0xe2, 0x75, 0xf7, 0xfe, 0x4d, 0x6f, 0xf2, 0x76, 0x09,
-  0xed, 0xfe, 0x10, 0x12, 0xaf, 0x27, 0xfd, 0x21, 0xe4, 0x70, 0x01, 0xd9,
-  0x4f, 0x5a, 0x8b, 0xc7, 0x02, 0xdd, 0x33, 0x0b, 0xb3, 0x01, 0xa9, 0x09,
-  0x1f, 0x0c, 0x03, 0x6c, 0x77, 0x13, 0xa0, 0x84, 0xdf, 0x69, 0x2d, 0x1d,
-  0xa0, 0xda, 0x81, 0x3b, 0x58, 0x42, 0x17, 0x31, 0x65, 0xf6, 0x1c, 0xd7,
-  0x80, 0xfc, 0x1d, 0xfd, 0xe9, 0x1a, 0xfd, 0x77, 0xfe, 0x25, 0xff, 0x01,
-  0x12, 0x0d, 0x34, 0xf8, 0x5d, 0x14, 0xf6, 0x66, 0x41, 0xc1, 0x3a, 0x40,
-  0x96, 0x41, 0xc8, 0x99, 0x0c, 0x21, 0xc1, 0x07, 0xe3, 0x20, 0x3f, 0x83,
-  0xfc, 0xe9, 0x80, 0xfc, 0x65, 0x30, 0x1c, 0xea, 0x80, 0xcb, 0x52, 0x4f,
-  0x80, 0xfc, 0x25, 0x70, 0x10, 0xbb, 0x31, 0x40, 0xfd, 0x38, 0x0a, 0xc2,
-  0xb7, 0x83, 0x49, 0x2e, 0xf1, 0x4b, 0x40, 0x80, 0x49, 0xa9, 0x8f, 0x2c,
-  0x36, 0xcd, 0xc2, 0xfb, 0x02, 0x84, 0x1d, 0xd9, 0x35, 0x3a, 0x00, 0x01,
-  0xa1, 0xc6, 0x23, 0xa8, 0x56, 0x7e, 0xf7, 0xbf, 0x2d, 0x06, 0x25, 0x8e,
-  0x95, 0x67, 0x93, 0x3b, 0x86, 0x26, 0xb0, 0xe1, 0xba, 0x22, 0x04, 0xcc,
-  0xba, 0x94, 0x0c, 0x37, 0x39, 0xc7, 0x42, 0x4b, 0xba, 0x06, 0x31, 0x66,
-  0x10, 0x73, 0x2d, 0x30, 0x76, 0x19, 0x1c, 0x03, 0x58, 0xda, 0xab, 0x18,
-  0x0e, 0x0a, 0x2d, 0x6c, 0x96, 0xfa, 0xf6, 0x51, 0x18, 0x07, 0x0c, 0x45,
-  0xdb, 0x74, 0x09, 0x04, 0xa7, 0x6a, 0xc4, 0x42, 0x09, 0x21, 0x20, 0x28,
-  0x43, 0x16, 0x70, 0x38, 0x31, 0x48, 0x05, 0xfa, 0x91, 0xb8, 0xbd, 0x39,
-  0x44, 0x28, 0xc7, 0x2c, 0xf6, 0x1c, 0x14, 0x01, 0xd1, 0x0e, 0x47, 0xa9,
-  0xbf, 0x4a, 0xb8, 0x4b, 0x14, 0x61, 0xa9, 0x34, 0x39, 0x14, 0xf1, 0x48,
-  0x13, 0x52, 0x26, 0x04, 0xd9, 0x4d, 0x7f, 0x32, 0x7d, 0x43, 0x8b, 0x28,
-  0x10, 0xfd, 0x38, 0x0e, 0xac, 0x5e, 0xc5, 0x22, 0xfb, 0xc0, 0x4c, 0xb9,
-  0x58, 0x26, 0xba, 0x48, 0x71, 0x9a, 0xdc, 0x24, 0xa6, 0x62, 0x69, 0xd0,
-  0x74, 0xa4, 0x5b, 0x2c, 0x0a, 0x23, 0x24, 0x7c, 0x30, 0x78, 0x47, 0x84,
-  0xd7, 0x8d, 0x41, 0x83, 0x85, 0xea, 0x26, 0xfb, 0x41, 0x60, 0x0b, 0x7a,
-  0xbc, 0xeb, 0xc3, 0x83, 0x66, 0x85, 0x1c, 0xbf, 0x86, 0x5d, 0xb1, 0x59,
-  0x0b, 0xdd, 0x3f, 0xe5, 0x0a, 0x4e, 0x3f, 0xf6, 0x47, 0x0b, 0x46, 0xd8,
-  0xd4, 0x44, 0xea, 0x4e, 0x58, 0xf1, 0x04, 0x50, 0x43, 0x49, 0xf5, 0x2a,
-  0x29, 0x87, 0x0b, 0x60, 0x5b, 0x0d, 0x75, 0x48, 0xa9, 0x4d, 0x10, 0x84,
-  0x21, 0x83, 0xb4, 0x2c, 0x05, 0x1b, 0xe5, 0xc6, 0xea, 0x46, 0xff, 0x00,
-  0x40, 0x42, 0x67, 0x22, 0xdd, 0x0a, 0x0a, 0x04, 0x04, 0x3c, 0xdc, 0x25,
-  0x08, 0xa0, 0x97, 0xd4, 0x1f, 0xf6, 0x6c, 0x2c, 0x01, 0x4d, 0x83, 0x80,
-  0x37, 0x00, 0x8a, 0x56, 0xfe, 0xff, 0xb6, 0x00, 0xd1, 0xfa, 0x02, 0xc2,
-  0x3d, 0x4c, 0xa8, 0x22, 0x15, 0x0f, 0x04, 0xf7, 0xd0, 0xdc, 0x27, 0x48,
-  0x20, 0x57, 0x40, 0xb3, 0x08, 0x28, 0xe2, 0x03, 0x7c, 0xdb, 0x0d, 0x56,
-  0x12, 0xa5, 0x5c, 0x32, 0x62, 0x34, 0xd9, 0x04, 0xf6, 0xe7, 0xf8, 0x9e,
-  0xee, 0xf0, 0x51, 0xb2, 0x7b, 0xd2, 0xcb, 0xce, 0xd0, 0x18, 0x51, 0x6e,
-  0x0e, 0xa9, 0xd4, 0xb4, 0x0e, 0xd6, 0xa6, 0x46, 0x6c, 0x25, 0xda, 0xa3,
-  0x62, 0x06, 0xce, 0x59, 0xe3, 0xb2, 0x89, 0x03, 0x04, 0xe2, 0x10, 0x0a,
-  0x59, 0x7c, 0x6c, 0x09, 0xc6, 0xfe, 0x02, 0x62, 0xb5, 0x3d, 0x0d, 0xc3,
-  0xf2, 0x83, 0x02, 0xd3, 0x64, 0x04, 0xc4, 0x85, 0x31, 0xd9, 0x0a, 0x36,
-  0xdb, 0x72, 0x18, 0xc7, 0x11, 0x49, 0x49, 0xdf, 0xea, 0x04, 0xec, 0x2b,
-  0x6e, 0xb5, 0xe8, 0x50, 0x08, 0x61, 0xa8, 0x45, 0xf3, 0x83, 0x72, 0x46,
-  0xe0, 0x02, 0xd6, 0x09, 0x24, 0x73, 0x60, 0x18, 0x4d, 0xbd, 0x64, 0x51,
-  0xbe, 0x48, 0x7d, 0x0d, 0xfd, 0xdb, 0x7d, 0xff, 0x5b, 0xe8, 0x2d, 0xea,
-  0x16, 0x17, 0xda, 0x7e, 0x47, 0x06, 0x92, 0xc6, 0x29, 0x02, 0x65, 0x60,
-  0x2c, 0xd0, 0xb6, 0x3b, 0x04, 0xcb, 0x86, 0x41, 0xd2, 0xff, 0x81, 0x13,
-  0xf8, 0x80, 0x00, 0x7d, 0x72, 0xe1, 0x8c, 0x52, 0xe1, 0x82, 0x35, 0x0c,
-  0x5c, 0x54, 0x24, 0x4c, 0x38, 0xe0, 0xb9, 0x6d, 0x48, 0xbf, 0x80, 0x03,
-  0xc2, 0xd8, 0x40, 0x38, 0xf8, 0x03, 0x51, 0x11, 0xcb, 0x83, 0xa0, 0x81,
-  0x0a, 0x9b, 0xcc, 0xb3, 0x64, 0x9c, 0x76, 0x4a, 0x1c, 0x63, 0x1e, 0x05,
-  0x80, 0x78, 0x32, 0x9b, 0xec, 0xc8, 0xfe, 0x24, 0xa3, 0x96, 0x94, 0xa3,
-  0x43, 0xf4, 0x3e, 0x03, 0xeb, 0x05, 0x08, 0xfe, 0x5b, 0xe6, 0x42, 0x68,
-  0xb6, 0xa8, 0xf4, 0x5a, 0xf2, 0x84, 0x41, 0x37, 0x13, 0x48, 0xc6, 0x58,
-  0x81, 0x4b, 0x2e, 0xac, 0xc0, 0x19, 0x99, 0xff, 0xb4, 0x92, 0x00, 0x18,
-  0x24, 0x1d, 0xbb, 0x0c, 0x68, 0xac, 0x0a, 0xe3, 0x7a, 0x35, 0x2d, 0x9a,
-  0x3b, 0x99, 0x3c, 0x30, 0xba, 0xc0, 0x1b, 0x10, 0xe8, 0xae, 0x30, 0x63,
-  0x90, 0xd6, 0x06, 0x25, 0xe1, 0x51, 0xcb, 0xac, 0xc1, 0x8c, 0xfd, 0x30,
-  0x6c, 0x68, 0x2a, 0x25, 0x00, 0xab, 0xe4, 0x73, 0xb8, 0x48, 0x7e, 0x50,
-  0x4a, 0x7c, 0x72, 0x2e, 0x04, 0x2c, 0x17, 0x23, 0x6c, 0xa5, 0xe2, 0xbf,
-  0xe0, 0x83, 0xc2, 0x01, 0x15, 0x68, 0xb1, 0x0c, 0x41, 0x1b, 0xde, 0xb7,
-  0x64, 0xdc, 0xc5, 0x4b, 0x94, 0x98, 0x61, 0x67, 0x77, 0x7c, 0x7d, 0x4b,
-  0xfe, 0x39, 0x64, 0x4f, 0x17, 0xe9, 0xd9, 0x3d, 0xfd, 0xd4, 0x6a, 0x8c,
-  0x13, 0x84, 0x09, 0x27, 0x5d, 0xfc, 0x16, 0x70, 0x0a, 0xc0, 0xd2, 0xd1,
-  0x64, 0x6b, 0xc5, 0x18, 0x13, 0x61, 0x08, 0x0e, 0x91, 0xeb, 0x22, 0xeb,
-  0x25, 0xa2, 0x39, 0x08, 0x57, 0x6b, 0x42, 0x1b, 0x2b, 0x74, 0xf3, 0x60,
-  0x92, 0x2a, 0x49, 0x96, 0x15, 0x83, 0xbe, 0x08, 0x14, 0x81, 0xf2, 0xc4,
-  0x07, 0x13, 0x07, 0x8a, 0x59, 0xf3, 0x06, 0xa4, 0x08, 0x36, 0x1c, 0x6a,
-  0xa3, 0xe5, 0x80, 0x00, 0x9c, 0xab, 0x0a, 0x9b, 0x3f, 0xd9, 0x36, 0x5a,
-  0x04, 0x2c, 0x25, 0x86, 0xd7, 0x20, 0x9c, 0xb7, 0x12, 0x7b, 0x88, 0x07,
-  0xcf, 0x48, 0xdf, 0x6a, 0x92, 0x41, 0xea, 0x58, 0x40, 0xfe, 0xd0, 0x7a,
-  0xdc, 0x32, 0x53, 0x39, 0x26, 0x62, 0x60, 0xb3, 0x7b, 0x66, 0x62, 0xf1,
-  0x25, 0x65, 0x7b, 0x2a, 0xd1, 0xbf, 0x58, 0x54, 0x32, 0x4f, 0xf4, 0xe9,
-  0x91, 0x00, 0x09, 0x40, 0x13, 0x8b, 0x81, 0x00, 0x27, 0xac, 0x5d, 0x31,
-  0xd6, 0xd8, 0x7d, 0x03, 0xd6, 0x15, 0x08, 0xb6, 0x46, 0xd9, 0x83, 0x2e,
-  0x2d, 0x66, 0xfa, 0xca, 0x2d, 0xd8, 0x8b, 0x0c, 0x04, 0x00, 0xb1, 0xfb,
-  0x06, 0x6b, 0xa9, 0xa6, 0x71, 0x72, 0x9e, 0x58, 0xe8, 0x1a, 0x24, 0x3b,
-  0xe1, 0x1c, 0x9e, 0xa8, 0x46, 0x90, 0x3b, 0x0c, 0x13, 0xd3, 0x0c, 0x08,
-  0x0d, 0x47, 0xf5, 0x2c, 0x9a, 0x16, 0xbf, 0x58, 0x9f, 0x00, 0x26, 0x0a,
-  0x2c, 0x2e, 0x85, 0xc4, 0x80, 0x26, 0xdd, 0x24, 0x00, 0x21, 0xb0, 0x17,
-  0x89, 0x64, 0xea, 0x59, 0x41, 0xc4, 0x33, 0xc0, 0x00, 0xd9, 0xfe, 0xfc,
-  0x3b, 0x09, 0x06, 0x3e, 0x2a, 0xeb, 0x1c, 0xed, 0x12, 0x06, 0xc4, 0x2f,
-  0xa2, 0x26, 0x8a, 0x44, 0x89, 0x04, 0xa8, 0x62, 0x84, 0x50, 0x03, 0x28,
-  0x83, 0x93, 0x23, 0x88, 0x04, 0xb5, 0x84, 0xfd, 0x09, 0x83, 0x07, 0x01,
-  0xb0, 0x03, 0x57, 0x6b, 0x72, 0x51, 0x09, 0x51, 0x98, 0xc2, 0xb2, 0xb0,
-  0x34, 0x12, 0x62, 0x48, 0x37, 0x6e, 0x0e, 0x88, 0x68, 0xbc, 0xb2, 0x8a,
-  0x68, 0x0e, 0x12, 0x21, 0x56, 0x08, 0x53, 0x19, 0x66, 0x9e, 0x09, 0x1c,
-  0x2c, 0x04, 0x19, 0xdb, 0xd1, 0x06, 0x98, 0x96, 0x02, 0xc8, 0x52, 0x40,
-  0x19, 0x7f, 0x58, 0x70, 0xe4, 0xcd, 0x12, 0x48, 0xe2, 0x44, 0x23, 0x50,
-  0x4d, 0xb7, 0xe0, 0xab, 0xc1, 0x94, 0xf2, 0x03, 0x00, 0x57, 0x10, 0x69,
-  0xe1, 0x6c, 0xd8, 0x19, 0x27, 0x08, 0x00, 0x9b, 0x20, 0x08, 0xa3, 0xd0,
-  0x40, 0x23, 0x12, 0x23, 0xed, 0x23, 0xa1, 0x06, 0xca, 0x0b, 0x06, 0xe8,
-  0x25, 0xb2, 0x0a, 0xce, 0x0b, 0x4e, 0x26, 0xda, 0x84, 0xf2, 0xf2, 0x9d,
-  0x09, 0x00, 0x22, 0xf5, 0xe8, 0x47, 0x14, 0x59, 0xd5, 0x32, 0x0b, 0xe9,
-  0xe9, 0x7e, 0xff, 0xdf, 0x01, 0xe9, 0x3e, 0x30, 0x0a, 0xa8, 0x6c, 0x27,
-  0x8d, 0x77, 0x9a, 0x67, 0x7d, 0x2e, 0xde, 0xb5, 0x36, 0x58, 0xad, 0x03,
-  0x60, 0xdc, 0x9a, 0x9f, 0x72, 0xd4, 0x0e, 0x05, 0xa0, 0x7c, 0x8b, 0xe8,
-  0x5b, 0x05, 0x46, 0x22, 0xe8, 0x2d, 0x00, 0x2c, 0xf4, 0x10, 0x98, 0xff,
-  0x2c, 0x88, 0xb0, 0xf3, 0xff, 0x32, 0x48, 0x61, 0x5e, 0x28, 0x01, 0x10,
-  0x4d, 0x9a, 0x7c, 0xa7, 0x69, 0xa8, 0x08, 0xe9, 0x77, 0x48, 0xe8, 0x4c,
-  0x92, 0xb8, 0x51, 0x49, 0x48, 0xc8, 0x14, 0x08, 0xb3, 0xa1, 0x64, 0x95,
-  0xc2, 0xb1, 0x08, 0x6c, 0xda, 0xbb, 0x69, 0x85, 0x6c, 0x90, 0x09, 0xe5,
-  0x6c, 0x82, 0x86, 0xcc, 0x49, 0x60, 0x6a, 0x5d, 0x18, 0x98, 0x1d, 0xc9,
-  0x6a, 0x89, 0x32, 0xbf, 0x18, 0xe9, 0x50, 0x35, 0x03, 0x2e, 0x22, 0xbe,
-  0x2a, 0x6d, 0x86, 0x65, 0xe8, 0x2e, 0x75, 0x07, 0x8e, 0x8e, 0xef, 0x20,
-  0x74, 0x60, 0x16, 0x7c, 0x0f, 0x0e, 0xec, 0x16, 0xe5, 0x02, 0x93, 0x49,
-  0xec, 0xe5, 0x74, 0x40, 0x4e, 0xc1, 0x92, 0xd3, 0x1d, 0xe4, 0x86, 0x79,
-  0x1c, 0xba, 0x27, 0x55, 0x7d, 0x08, 0xd3, 0xbe, 0x7e, 0x10, 0x42, 0x7b,
-  0xe9, 0xe2, 0xfe, 0x0f, 0x2d, 0x41, 0x90, 0xba, 0x84, 0x97, 0x70, 0x75,
-  0x1a, 0x14, 0x83, 0x7c, 0xaa, 0x38, 0x09, 0x25, 0xe1, 0x5e, 0x84, 0xda,
-  0x2a, 0xa0, 0xcd, 0xa6, 0xec, 0x6c, 0x66, 0xe4, 0xb7, 0x91, 0xc8, 0x3a,
-  0x87, 0xf2, 0x8b, 0x12, 0xa8, 0x0d, 0x01, 0xc0, 0x4d, 0x8b, 0x0d, 0x90,
-  0xac, 0xa6, 0x09, 0xd1, 0x9b, 0x30, 0x41, 0xd4, 0x61, 0x47, 0x1a, 0x89,
-  0x3d, 0x25, 0xec, 0x80, 0x61, 0x8d, 0xf6, 0x87, 0x53, 0x81, 0x53, 0x7d,
-  0x20, 0x37, 0xde, 0x61, 0xb5, 0x25, 0x98, 0x64, 0x2a, 0x41, 0xdb, 0x65,
-  0x51, 0x2c, 0x31, 0x0e, 0xac, 0xc0, 0x7c, 0xe8, 0x1c, 0x44, 0xf4, 0x60,
-  0xe5, 0xee, 0x74, 0x24, 0x6a, 0x90, 0xfe, 0x46, 0x07, 0x4c, 0x09, 0x2b,
-  0x89, 0x3b, 0x05, 0x3e, 0x50, 0x76, 0x01, 0xf1, 0xf2, 0x76, 0x02, 0x6a,
-  0x01, 0x02, 0x40, 0x8c, 0xd0, 0x84, 0xb1, 0xb6, 0x64, 0xd5, 0xa0, 0x40,
-  0xaf, 0x91, 0x65, 0x8c, 0xba, 0x23, 0xb1, 0x13, 0x13, 0x64, 0x23, 0x62,
-  0x12, 0x7c, 0xdb, 0x23, 0x8d, 0x49, 0xde, 0x08, 0x84, 0x19, 0xb8, 0x03,
-  0x03, 0x36, 0x51, 0x97, 0xad, 0xe9, 0x87, 0x88, 0xa9, 0x8b, 0xe4, 0x58,
-  0x04, 0x24, 0x47, 0x6d, 0x2b, 0xa1, 0x43, 0xf1, 0xab, 0xe6, 0x3b, 0x60,
-  0xe4, 0x97, 0xe5, 0x72, 0x56, 0x11, 0x37, 0xad, 0xf2, 0x72, 0x4f, 0x16,
-  0xa1, 0x60, 0x91, 0xb3, 0x6f, 0x17, 0xe6, 0x72, 0x3e, 0x9b, 0x77, 0xe4,
-  0x76, 0x82, 0x37, 0x41, 0xcb, 0xb7, 0xe4, 0x17, 0xe6, 0x2b, 0x6d, 0x20,
-  0x1b, 0x33, 0x79, 0x0b, 0x65, 0x89, 0x65, 0x60, 0x32, 0x7d, 0x58, 0xe0,
-  0x64, 0x06, 0x88, 0x0a, 0x33, 0x17, 0x6c, 0x50, 0xec, 0x54, 0xb3, 0xbe,
-  0x6a, 0xcb, 0xea, 0x60, 0x84, 0xff, 0x57, 0x87, 0x5c, 0x01, 0x49, 0x5f,
-  0xbf, 0x3c, 0xa5, 0xfe, 0x09, 0x0b, 0xa4, 0x7c, 0xad, 0xd8, 0x1c, 0x88,
-  0xfe, 0x40, 0xb1, 0xe1, 0x0c, 0x11, 0x21, 0x58, 0x15, 0x0a, 0xf9, 0xf0,
-  0xd0, 0xa6, 0x4a, 0x9e, 0x04, 0xf6, 0x59, 0xf4, 0x00, 0xc2, 0x36, 0xe6,
-  0xfc, 0x02, 0x9a, 0xfe, 0x85, 0x83, 0x78, 0xc0, 0x85, 0x1c, 0xa5, 0x10,
-  0xc6, 0xbe, 0x09, 0x2d, 0x48, 0x21, 0xb5, 0x10, 0x52, 0x72, 0x4d, 0x4d,
-  0x98, 0x10, 0x29, 0x72, 0x21, 0xb0, 0x36, 0x16, 0x0d, 0x6c, 0x78, 0x1f,
-  0x01, 0xeb, 0x4c, 0x59, 0x37, 0x98, 0x84, 0x33, 0x2f, 0x4e, 0xff, 0x10,
-  0x48, 0x45, 0x20, 0x8c, 0xd9, 0x42, 0x33, 0xcd, 0xf6, 0x6d, 0x23, 0xf4,
-  0x34, 0x63, 0x08, 0x40, 0x4c, 0x3e, 0xd6, 0x1e, 0x44, 0x73, 0x67, 0x01,
-  0x31, 0xe4, 0x4a, 0x64, 0x4c, 0x64, 0x3e, 0xba, 0x08, 0xb0, 0xc0, 0x63,
-  0xfa, 0xda, 0xa6, 0x4a, 0x96, 0x4c, 0x7e, 0xc1, 0x88, 0x0e, 0x82, 0xca,
-  0xe6, 0x53, 0x66, 0xc4, 0x60, 0x9b, 0xd5, 0xe8, 0x2e, 0x4c, 0xcd, 0x10,
-  0x91, 0xe8, 0xd9, 0x35, 0x16, 0x5b, 0xe8, 0xe9, 0x1e, 0xe5, 0xa4, 0x0a,
-  0x16, 0xe8, 0x46, 0x16, 0x45, 0x9f, 0xc8, 0xc7, 0x56, 0x70, 0x5e, 0x2a,
-  0xfe, 0x49, 0xbd, 0x28, 0xc3, 0xac, 0x27, 0x43, 0xd6, 0x71, 0x1c, 0x4a,
-  0x90, 0xed, 0xd7, 0xb8, 0x21, 0x00, 0x59, 0xde, 0x5a, 0x27, 0x0b, 0x65,
-  0xe2, 0x7e, 0x2c, 0x0c, 0x46, 0x06, 0x70, 0x0f, 0x7b, 0x40, 0x2c, 0x28,
-  0x81, 0xc0, 0x34, 0x40, 0xaa, 0xb2, 0x9a, 0x60, 0x10, 0x6e, 0x69, 0x3d,
-  0x20, 0x9e, 0xd7, 0x9d, 0x35, 0x13, 0xa2, 0x84, 0x41, 0x41, 0x8b, 0x11,
-  0x89, 0xc1, 0x56, 0xde, 0x4e, 0xe9, 0x01, 0x93, 0xfc, 0xf4, 0x12, 0x81,
-  0x7e, 0xfc, 0x46, 0x0c, 0xd9, 0x0b, 0x1d, 0xa2, 0x37, 0x0e, 0xd1, 0x00,
-  0x78, 0x17, 0x6b, 0xb0, 0xd0, 0x1c, 0x66, 0x0a, 0xdd, 0xf8, 0x0f, 0x0b,
-  0xc4, 0x63, 0x14, 0x76, 0x2c, 0xbb, 0x98, 0x57, 0x29, 0x0b, 0x5b, 0xaf,
-  0x5d, 0x9c, 0x93, 0x00, 0x75, 0xcc, 0xa0, 0xe8, 0x21, 0x8e, 0x12, 0x9a,
-  0xfc, 0xb0, 0xc1, 0x44, 0xb6, 0x8b, 0x12, 0x09, 0x6b, 0xf8, 0x43, 0xa4,
-  0x80, 0x70, 0x77, 0x7a, 0x50, 0x23, 0xa0, 0x77, 0x87, 0x72, 0xa5, 0x1e,
-  0x28, 0xac, 0xbf, 0x0f, 0x5a, 0xff, 0x66, 0x13, 0xac, 0xbf, 0xae, 0x5e,
-  0xc8, 0x19, 0x51, 0x1b, 0x0b, 0x30, 0x23, 0x29, 0x61, 0x18, 0x68, 0x8d,
-  0x0b, 0x91, 0x17, 0xb3, 0x10, 0xf1, 0xce, 0xff, 0xff, 0x88, 0xd7, 0x04,
-  0x0f, 0xb3, 0x2b, 0x54, 0x98, 0x42, 0xb0, 0xe4, 0x98, 0x1a, 0x28, 0x3a,
-  0x04, 0xe6, 0x44, 0x12, 0x0f, 0x0b, 0x0e, 0xa0, 0xe8, 0x32, 0xa1, 0x41,
-  0x58, 0xd4, 0x2a, 0xcc, 0x08, 0x43, 0xb9, 0xb7, 0x97, 0xdb, 0x00, 0x55,
-  0x95, 0xe4, 0x84, 0x83, 0x64, 0x0b, 0xe5, 0xba, 0xc1, 0xad, 0x00, 0x19,
-  0x40, 0xc1, 0x0e, 0x48, 0x37, 0x48, 0x03, 0x70, 0xdb, 0x21, 0x8a, 0x82,
-  0x00, 0x32, 0xe3, 0x90, 0xd3, 0xe2, 0x4c, 0x48, 0x57, 0x4e, 0x94, 0x00,
-  0x08, 0xc8, 0xeb, 0x19, 0x17, 0x0b, 0x7d, 0x3f, 0x5c, 0xb0, 0x0b, 0xbe,
-  0x46, 0xe7, 0x78, 0x74, 0x17, 0x30, 0xbf, 0x6a, 0xf6, 0x04, 0x99, 0x2d,
-  0x84, 0x36, 0x88, 0xdb, 0xaa, 0x2f, 0x3a, 0x39, 0x6c, 0x68, 0x83, 0x41,
-  0xde, 0xb6, 0xfc, 0x0d, 0xd6, 0x86, 0x29, 0xd0, 0x50, 0x01, 0x81, 0xe1,
-  0x20, 0x04, 0x12, 0x04, 0x21, 0x38, 0xab, 0xf2, 0xc1, 0x55, 0x9b, 0x39,
-  0x02, 0x9a, 0x08, 0x8f, 0x96, 0xd4, 0xc4, 0x1f, 0x82, 0x08, 0xc1, 0x0c,
-  0xe0, 0x3b, 0x47, 0x06, 0x0d, 0xbb, 0xf8, 0x3b, 0x57, 0x04, 0x75, 0x24,
-  0x84, 0x8a, 0x96, 0x1b, 0x08, 0x08, 0x13, 0xca, 0x61, 0xa2, 0x88, 0x99,
-  0xeb, 0x83, 0x19, 0x83, 0xd1, 0x47, 0x04, 0xed, 0xae, 0x30, 0x02, 0x47,
-  0x07, 0x0a, 0x6c, 0x68, 0x10, 0x51, 0xea, 0xf9, 0x87, 0x90, 0x16, 0x53,
-  0x6c, 0xe9, 0xd4, 0x94, 0x43, 0x80, 0x85, 0x1a, 0x82, 0xfe, 0xc6, 0x4e,
-  0x15, 0xce, 0xe7, 0x9e, 0x21, 0xda, 0x03, 0x84, 0x2a, 0x1b, 0xc1, 0x98,
-  0x18, 0x0b, 0x67, 0x22, 0x59, 0x7d, 0x31, 0x10, 0xb2, 0x37, 0xf0, 0x16,
-  0x82, 0xe1, 0x5b, 0x45, 0x92, 0x49, 0x30, 0x37, 0xd4, 0xe1, 0xfe, 0x51,
-  0x0b, 0xc8, 0xa0, 0x02, 0x12, 0x12, 0x4f, 0x64, 0x24, 0x23, 0x01, 0xea,
-  0xb1, 0xc2, 0x1a, 0x36, 0xd7, 0x74, 0xcf, 0x61, 0x4f, 0x7f, 0x8e, 0x00,
-  0xf6, 0x46, 0xe7, 0x85, 0x08, 0x70, 0xe8, 0x80, 0x7e, 0xe7, 0x5b, 0xb0,
-  0x24, 0x05, 0x7c, 0xdc, 0xe5, 0x74, 0x1e, 0xd4, 0x2e, 0xad, 0x8d, 0x0b,
-  0xf2, 0xdd, 0x20, 0x74, 0x12, 0x33, 0x0e, 0x36, 0x05, 0x08, 0x5c, 0xde,
-  0x20, 0x53, 0x3f, 0x3b, 0x31, 0x10, 0x74, 0x84, 0x53, 0xbb, 0x2a, 0x18,
-  0x04, 0x59, 0x3d, 0x0e, 0x30, 0x97, 0x1b, 0x0e, 0x76, 0xbf, 0x3c, 0x00,
-  0x12, 0x1b, 0x2e, 0x0c, 0xd9, 0x54, 0x0e, 0xc0, 0x25, 0x5c, 0x1d, 0x58,
-  0xe0, 0x4c, 0x10, 0x5c, 0x9c, 0x33, 0x01, 0x84, 0x1c, 0x58, 0xb2, 0x41,
-  0x5e, 0x74, 0x06, 0x2b, 0x56, 0xd3, 0xfc, 0xbc, 0x12, 0x56, 0x57, 0xdd,
-  0x10, 0x0c, 0xce, 0xa9, 0x00, 0x06, 0x19, 0x54, 0x1d, 0x75, 0x4d, 0x86,
-  0x61, 0x2b, 0x29, 0xf5, 0x57, 0x03, 0x22, 0xbe, 0xc0, 0x75, 0x1c, 0xe1,
-  0x04, 0x82, 0xbb, 0x4b, 0x8c, 0x00, 0x60, 0x78, 0x0d, 0x52, 0x6c, 0x3f,
-  0x42, 0x12, 0x0b, 0x6a, 0x49, 0x33, 0x17, 0x27, 0xbd, 0x79, 0x49, 0x66,
-  0x5c, 0x4a, 0x59, 0x3e, 0xe3, 0x74, 0x42, 0xbb, 0x30, 0x78, 0x7d, 0x47,
-  0x4d, 0xb6, 0x01, 0x16, 0x42, 0x16, 0x01, 0x9d, 0x26, 0x18, 0xc0, 0x73,
-  0x19, 0x5e, 0x70, 0xce, 0xfe, 0x19, 0x0f, 0x08, 0x0c, 0xd4, 0xb5, 0x1a,
-  0x74, 0x10, 0x7d, 0x83, 0x90, 0x71, 0xbc, 0xc6, 0x00, 0x85, 0x4c, 0x76,
-  0x95, 0xd9, 0x12, 0x9f, 0x1e, 0xeb, 0x6f, 0x10, 0x12, 0xe4, 0x47, 0xe1,
-  0x40, 0x89, 0xa5, 0x02, 0x90, 0x39, 0xa3, 0x04, 0x52, 0x64, 0x80, 0xbe,
-  0x27, 0xf6, 0xc2, 0x61, 0x44, 0x10, 0xd0, 0x6f, 0x0b, 0x9c, 0x1e, 0x8f,
-  0xb0, 0x2d, 0x6d, 0x8e, 0xc6, 0x65, 0xf7, 0xc0, 0x28, 0x45, 0x92, 0xf9,
-  0x90, 0x8e, 0x7c, 0x0f, 0x00, 0xa5, 0x0b, 0x93, 0x64, 0x0d, 0x03, 0x4c,
-  0x21, 0x7a, 0xd5, 0x00, 0x0c, 0xfe, 0xd0, 0xfa, 0xe7, 0xc8, 0x00, 0x69,
-  0xcf, 0xd8, 0x08, 0xef, 0x0a, 0x40, 0x00, 0x7d, 0xc7, 0xbd, 0xb0, 0x39,
-  0x0f, 0x4b, 0x3a, 0x50, 0xa1, 0x52, 0xe1, 0x09, 0xc5, 0xa3, 0x0d, 0x9b,
-  0x17, 0x29, 0x26, 0x55, 0x5b, 0x93, 0x50, 0x05, 0xec, 0x26, 0xf2, 0x36,
-  0x63, 0x56, 0xcb, 0xf1, 0x82, 0x34, 0x76, 0x10, 0x57, 0x11, 0xce, 0x0b,
-  0x0a, 0xfd, 0x91, 0x3a, 0xff, 0x9e, 0x0a, 0x5d, 0x00, 0xa2, 0xd1, 0x08,
-  0x20, 0x4e, 0x0a, 0x4b, 0x9d, 0x41, 0x9a, 0x5e, 0xf7, 0xb9, 0x22, 0x8a,
-  0xa4, 0x41, 0xe2, 0x40, 0xac, 0x37, 0x05, 0x19, 0xac, 0x06, 0x10, 0x35,
-  0x64, 0x7c, 0x2f, 0x23, 0x01, 0x46, 0xc1, 0x47, 0x2e, 0x20, 0x5c, 0x17,
-  0x94, 0xc5, 0x86, 0x75, 0xec, 0x81, 0x18, 0xd8, 0x17, 0x14, 0x01, 0x09,
-  0xd4, 0x21, 0x41, 0x39, 0x83, 0x6c, 0x87, 0x98, 0x27, 0x9e, 0x02, 0xd5,
-  0x3a, 0x0a, 0xea, 0xd0, 0x48, 0xa1, 0xe2, 0x92, 0xe1, 0xd3, 0xa2, 0x26,
-  0xf4, 0xe2, 0xa2, 0x58, 0xc5, 0xbe, 0x26, 0x64, 0x12, 0x47, 0x2e, 0x8d,
-  0x5c, 0x28, 0xff, 0x25, 0xca, 0xbd, 0x30, 0x94, 0x2a, 0xc2, 0x27, 0xea,
-  0x41, 0x84, 0x83, 0xe5, 0x93, 0xc8, 0xe1, 0xfe, 0x80, 0xa9, 0x52, 0x2d,
-  0x58, 0x5d, 0x10, 0xd9, 0x1a, 0x42, 0xc4, 0xa0, 0x24, 0x92, 0x2a, 0x85,
-  0x63, 0x08, 0xb8, 0x1e, 0xeb, 0x42, 0x12, 0xa3, 0x0c, 0x60, 0x6e, 0xcb,
-  0xa6, 0xb9, 0x09, 0x96, 0x08, 0x3a, 0x3c, 0x61, 0xac, 0x0d, 0xa7, 0x72,
-  0xb3, 0x51, 0x3e, 0xce, 0x72, 0xac, 0xc2, 0x61, 0x64, 0x49, 0x83, 0x08,
-  0x30, 0x32, 0xaf, 0xa9, 0x1e, 0x59, 0x62, 0x18, 0x0a, 0x90, 0xfe, 0x7b,
-  0x1a, 0x83, 0x6e, 0x68, 0xb4, 0x5e, 0xfe, 0x67, 0x5d, 0xb1, 0x9f, 0x72,
-  0x02, 0x73, 0x8d, 0xa9, 0xce, 0x12, 0xa1, 0x48, 0xa9, 0x71, 0x3a, 0x6f,
-  0x10, 0xa8, 0x91, 0x07, 0x8b, 0x4d, 0x0c, 0x07, 0x36, 0x18, 0xeb, 0x82,
-  0x10, 0x3d, 0xc2, 0xef, 0x39, 0x3e, 0x04, 0x1d, 0xeb, 0x55, 0x00, 0x85,
-  0x7f, 0xa2, 0x93, 0xe4, 0x7d, 0x4e, 0x20, 0x9c, 0xfd, 0xd8, 0xb6, 0x08,
-  0x09, 0x75, 0xdc, 0x48, 0x6d, 0x4d, 0x1a, 0x01, 0x61, 0x71, 0x6f, 0x56,
-  0xcf, 0x5e, 0x05, 0x0c, 0x05, 0x09, 0x20, 0x2a, 0xac, 0x17, 0xe4, 0x2a,
-  0x91, 0x83, 0xf8, 0xeb, 0x21, 0x71, 0xe8, 0x6b, 0xd4, 0xdd, 0x40, 0x98,
-  0x5f, 0x24, 0x9b, 0xb0, 0x87, 0x81, 0xf0, 0x2c, 0xd1, 0x56, 0xff, 0xd6,
-  0x7e, 0xe5, 0x74, 0x56, 0x02, 0x9c, 0x79, 0xda, 0x00, 0x06, 0x17, 0xcc,
-  0x18, 0x09, 0x51, 0x2f, 0x33, 0x96, 0xf7, 0x9d, 0x22, 0x99, 0x07, 0x00,
-  0xd6, 0x01, 0x33, 0x1f, 0x12, 0xce, 0xb1, 0x56, 0x8c, 0xaa, 0x2c, 0x25,
-  0x8c, 0xcb, 0xff, 0x63, 0x6d, 0xdd, 0x51, 0x9c, 0x3b, 0xe5, 0x2d, 0x86,
-  0x39, 0xa0, 0x98, 0xd8, 0xba, 0x89, 0x50, 0xbf, 0x02, 0xca, 0x3b, 0x7b,
-  0xff, 0x4b, 0x09, 0x76, 0x1c, 0x73, 0x2b, 0x21, 0xdd, 0x2d, 0x81, 0x52,
-  0x78, 0x0f, 0x01, 0x0b, 0xcb, 0x50, 0x82, 0x55, 0x8f, 0x4d, 0x59, 0x43,
-  0x1a, 0xf5, 0x3a, 0x84, 0x4f, 0xac, 0x52, 0x05, 0x74, 0x44, 0xfc, 0x94,
-  0x39, 0x24, 0x01, 0x09, 0xd5, 0x21, 0x01, 0x90, 0x77, 0xaf, 0x2d, 0x56,
-  0x74, 0x43, 0x19, 0x3a, 0xca, 0x16, 0x7d, 0x2a, 0x01, 0xeb, 0xb5, 0x91,
-  0x2a, 0xc1, 0x74, 0x72, 0xba, 0xf8, 0x44, 0x03, 0x29, 0xf1, 0x42, 0xf2,
-  0x1c, 0xfa, 0xb2, 0xf8, 0x0e, 0xe1, 0x06, 0x45, 0x1e, 0x38, 0x88, 0xb3,
-  0x06, 0xec, 0x0d, 0xeb, 0x76, 0xf6, 0xe5, 0x36, 0xc4, 0x65, 0xff, 0x1e,
-  0x61, 0xa8, 0x42, 0x8f, 0x76, 0xbd, 0xfa, 0x30, 0x0c, 0x53, 0x9d, 0x57,
-  0x61, 0x23, 0x38, 0x36, 0x08, 0xc4, 0x9a, 0x25, 0x3d, 0xcb, 0x3e, 0x1e,
-  0x59, 0x77, 0x22, 0x10, 0x7e, 0x15, 0xc8, 0x1b, 0x8c, 0xad, 0xd5, 0x72,
-  0xf0, 0xa7, 0xd4, 0xd9, 0xeb, 0x25, 0x33, 0xcb, 0x46, 0xea, 0x8c, 0xfe,
-  0xa0, 0x01, 0xc8, 0x42, 0x09, 0xa3, 0xda, 0x2e, 0x56, 0x23, 0x18, 0x0b,
-  0x00, 0x21, 0xb8, 0x21, 0x5d, 0xe4, 0x58, 0x2f, 0x17, 0x01, 0x11, 0x81,
-  0x2d, 0x2b, 0x7c, 0x2c, 0x61, 0xb5, 0xc4, 0x5b, 0x52, 0x90, 0xa2, 0x42,
-  0xd5, 0x96, 0x24, 0x0c, 0x5e, 0xb5, 0xa0, 0x1e, 0x81, 0xa8, 0xbd, 0x41,
-  0x47, 0xab, 0x87, 0xea, 0x59, 0xf3, 0xd4, 0x03, 0xb2, 0x68, 0x13, 0x82,
-  0x10, 0x9b, 0x86, 0x18, 0x2a, 0xc2, 0xb9, 0xdf, 0xf7, 0x65, 0x2b, 0x29,
-  0x53, 0x2a, 0x44, 0x3e, 0xa8, 0xbd, 0x06, 0x17, 0x82, 0xc4, 0x8e, 0x5f,
-  0x48, 0x02, 0xd8, 0x2c, 0x51, 0x18, 0x71, 0x38, 0x46, 0x3c, 0x7d, 0x89,
-  0x77, 0x04, 0x84, 0x46, 0x87, 0x43, 0xa2, 0x35, 0x1b, 0xfe, 0x72, 0xbd,
-  0xb5, 0x83, 0x96, 0x54, 0x3a, 0x20, 0xab, 0xad, 0x06, 0xfa, 0x0b, 0xee,
-  0x67, 0x60, 0x94, 0xf8, 0x2b, 0x38, 0x37, 0x09, 0x15, 0x68, 0x16, 0x4b,
-  0x54, 0x09, 0x53, 0x08, 0x40, 0x1a, 0x64, 0x16, 0xea, 0x80, 0xa4, 0x2b,
-  0x0f, 0xd1, 0x00, 0x09, 0x26, 0x53, 0x83, 0x2c, 0xcd, 0x15, 0xcd, 0x45,
-  0x2d, 0x12, 0xf4, 0x18, 0xac, 0x3d, 0xc1, 0x42, 0x6a, 0x14, 0x84, 0x55,
-  0xbd, 0xeb, 0x4f, 0x42, 0x0e, 0x02, 0x07, 0x65, 0x08, 0x58, 0x02, 0xa1,
-  0x0f, 0x30, 0x84, 0x58, 0x72, 0x8e, 0xe1, 0x4b, 0xff, 0x11, 0x23, 0x02,
-  0xf2, 0xc9, 0xa6, 0xd0, 0x9f, 0x18, 0x20, 0x16, 0x8b, 0x5a, 0x23, 0x56,
-  0xef, 0x06, 0x02, 0xc9, 0xe6, 0xbb, 0x3a, 0x60, 0xa8, 0x09, 0x45, 0x84,
-  0x5e, 0x31, 0x16, 0x9c, 0x87, 0xa0, 0x84, 0xaa, 0x86, 0x8e, 0x80, 0xfa,
-  0xb0, 0xb6, 0xa4, 0x05, 0x80, 0x86, 0x6f, 0x45, 0xc0, 0xad, 0x01, 0x58,
-  0x86, 0x1c, 0x81, 0x91, 0x32, 0x17, 0x16, 0x1e, 0x8a, 0xb2, 0x58, 0xbc,
-  0x0b, 0x78, 0x06, 0x33, 0xc2, 0x1f, 0x55, 0x3c, 0xd6, 0x07, 0x05, 0xb2,
-  0x78, 0x04, 0x5c, 0x04, 0x02, 0x2b, 0xc9, 0x02, 0x60, 0x2c, 0x5b, 0x21,
-  0x0b, 0x2a, 0x0e, 0x2c, 0xf6, 0xb2, 0xf2, 0xc2, 0xf4, 0x25, 0x1a, 0xae,
-  0x85, 0x01, 0x83, 0x5c, 0xfa, 0x14, 0x20, 0x27, 0x84, 0x36, 0x19, 0xf2,
-  0x66, 0xe0, 0xc9, 0x7f, 0x00, 0x03, 0x6e, 0x56, 0xd7, 0x21, 0x36, 0x23,
-  0x92, 0xfe, 0x64, 0x24, 0x8c, 0x06, 0x76, 0x40, 0xb0, 0x4f, 0x64, 0x4d,
-  0x2e, 0x57, 0x03, 0x6f, 0x85, 0xd5, 0x0e, 0x4c, 0x43, 0xc1, 0x20, 0x70,
-  0x73, 0x02, 0x09, 0x5f, 0x9a, 0xd6, 0x2b, 0x11, 0x60, 0xb4, 0xc0, 0x2c,
-  0xec, 0x6b, 0x5e, 0x54, 0x49, 0x3b, 0x6c, 0x1e, 0xb8, 0x0d, 0x01, 0x12,
-  0x2c, 0x45, 0x84, 0x26, 0xc5, 0x12, 0x5e, 0x64, 0x09, 0x7c, 0x2c, 0x42,
-  0x9e, 0x61, 0x15, 0x38, 0xf2, 0xa0, 0xc1, 0x4d, 0x06, 0x32, 0xcb, 0x18,
-  0x16, 0x26, 0xd0, 0x42, 0xf2, 0x20, 0xfc, 0xcd, 0xf2, 0x80, 0x24, 0x1c,
-  0x78, 0xd2, 0x44, 0x53, 0xf6, 0x00, 0x94, 0x09, 0x8c, 0x5b, 0xa9, 0xa9,
-  0x78, 0xc1, 0x11, 0x84, 0x5b, 0xc8, 0xae, 0x45, 0xbe, 0x41, 0x57, 0x01,
-  0x06, 0x43, 0x28, 0xb3, 0x1a, 0x09, 0x29, 0x62, 0x84, 0xfd, 0xb8, 0x4a,
-  0x77, 0x68, 0x77, 0x6f, 0x05, 0x08, 0x5e, 0x08, 0x6d, 0x4b, 0x24, 0x2c,
-  0x01, 0x82, 0x61, 0x3a, 0x8b, 0x06, 0x40, 0x66, 0x0c, 0x92, 0x0a, 0x6c,
-  0xf6, 0x80, 0x25, 0x59, 0xee, 0x60, 0xcd, 0x36, 0x59, 0x30, 0xb0, 0xbb,
-  0x9c, 0x9c, 0x01, 0x2a, 0x50, 0xe0, 0x22, 0x82, 0x1b, 0x80, 0xbc, 0x8a,
-  0x0e, 0x5a, 0xa7, 0x27, 0xd9, 0xb7, 0x01, 0x0d, 0xc0, 0x5c, 0x3d, 0xbc,
-  0x2f, 0x4a, 0x2a, 0x0a, 0x85, 0x35, 0x09, 0x27, 0xa2, 0xcb, 0x05, 0x13,
-  0x42, 0x6c, 0x54, 0x01, 0xe8, 0xf0, 0xa9, 0x00, 0x44, 0x28, 0x8e, 0x68,
-  0xa4, 0xee, 0xcc, 0xca, 0x51, 0x9b, 0x4d, 0x97, 0x70, 0xe7, 0x0d, 0xca,
-  0x1c, 0x1d, 0x11, 0x96, 0x1c, 0xa0, 0x42, 0x3f, 0x65, 0xe9, 0xa8, 0x14,
-  0x12, 0x9e, 0x44, 0xb6, 0x6c, 0x81, 0x51, 0x72, 0xb8, 0xdb, 0xbe, 0xed,
-  0x5c, 0x21, 0xe3, 0x9a, 0x20, 0x5b, 0x18, 0x06, 0xa1, 0x70, 0x1d, 0xb8,
-  0x2f, 0x95, 0x17, 0x8a, 0x31, 0x68, 0x00, 0x0b, 0x6b, 0xe6, 0x8a, 0x3b,
-  0x36, 0x6b, 0x27, 0xb7, 0xc6, 0xe2, 0x75, 0x8a, 0x22, 0x33, 0x78, 0xec,
-  0x1a, 0xb8, 0x30, 0x2f, 0xad, 0x1f, 0x1a, 0xeb, 0xb3, 0x2a, 0x21, 0xda,
-  0x74, 0x0d, 0x07, 0xee, 0x36, 0xe2, 0x73, 0x0d, 0x28, 0x56, 0xc7, 0x89,
-  0xb3, 0x46, 0x55, 0xa0, 0xee, 0x01, 0x02, 0xea, 0x42, 0x84, 0x0a, 0x44,
-  0x18, 0xf2, 0xb1, 0xcb, 0x09, 0xfb, 0x4d, 0x23, 0x98, 0x1c, 0x42, 0xfb,
-  0x63, 0xcf, 0x87, 0x0b, 0xb0, 0x66, 0x22, 0x41, 0x66, 0x12, 0x0a, 0x1d,
-  0x9e, 0x04, 0x8e, 0x60, 0x75, 0x10, 0xc2, 0x3d, 0x78, 0xe9, 0x7f, 0xfe,
-  0xac, 0xac, 0xc4, 0x40, 0xb2, 0xf7, 0x0a, 0x7b, 0xa3, 0xfe, 0x23, 0x09,
-  0x15, 0x9c, 0x19, 0xfa, 0x85, 0xa4, 0x67, 0x0e, 0x22, 0x81, 0x1e, 0xa0,
-  0xde, 0xe9, 0x3a, 0x8c, 0xc1, 0x19, 0x17, 0x29, 0x67, 0x30, 0xae, 0x2c,
-  0xda, 0x49, 0x62, 0xa0, 0x70, 0x34, 0x83, 0x1c, 0x86, 0x32, 0x3c, 0xd7,
-  0x14, 0x4d, 0x03, 0x10, 0x63, 0x7d, 0x38, 0xee, 0x2f, 0x74, 0x0b, 0x05,
-  0x1b, 0x07, 0x05, 0x05, 0x12, 0xb5, 0xed, 0x7d, 0xec, 0x03, 0xb6, 0x7f,
-  0x8c, 0x09, 0x83, 0xb9, 0x60, 0x40, 0x2c, 0x4c, 0x0e, 0x56, 0xab, 0x10,
-  0x01, 0x61, 0x8d, 0x8f, 0xb3, 0xb4, 0xc6, 0x09, 0x21, 0xf3, 0x2f, 0x1f,
-  0x18, 0x7d, 0x58, 0x79, 0xfa, 0x18, 0x18, 0x2a, 0x90, 0x80, 0x64, 0x4f,
-  0x11, 0x00, 0x6b, 0x1e, 0x11, 0x09, 0x1b, 0x17, 0x82, 0x34, 0x4a, 0xb6,
-  0xc9, 0x17, 0x16, 0x32, 0x97, 0x94, 0x3b, 0x68, 0x2a, 0xf4, 0x50, 0x00,
-  0x46, 0xb1, 0x84, 0xb6, 0x99, 0xf2, 0x2b, 0x92, 0x17, 0x18, 0x82, 0x24,
-  0x8c, 0x61, 0x6a, 0xaa, 0x21, 0x54, 0xcc, 0x14, 0x29, 0x25, 0x52, 0x21,
-  0x1c, 0x4e, 0x05, 0x82, 0xbb, 0x3a, 0x23, 0xde, 0x58, 0xe0, 0x10, 0xcb,
-  0x68, 0xf8, 0x96, 0xeb, 0x0b, 0x02, 0x98, 0xbd, 0x40, 0x86, 0x1f, 0xb2,
-  0xaa, 0xb9, 0x82, 0xa4, 0x63, 0x85, 0x45, 0xe2, 0x7b, 0x42, 0x04, 0x85,
-  0xf5, 0x47, 0x6f, 0x85, 0xa8, 0xc8, 0xb9, 0x45, 0xbe, 0x41, 0x74, 0x21,
-  0xaf, 0xe4, 0xf8, 0x62, 0x24, 0x32, 0xa7, 0xbb, 0x10, 0x1d, 0xc5, 0x34,
-  0x2e, 0x09, 0xee, 0xfb, 0xac, 0x44, 0xb4, 0xb5, 0x94, 0xde, 0xa9, 0xd2,
-  0x69, 0xc3, 0xf8, 0xc3, 0xd6, 0x59, 0x1e, 0x15, 0x8a, 0xf6, 0x61, 0x8f,
-  0x06, 0xa2, 0x19, 0xf0, 0xc2, 0x21, 0x42, 0x3c, 0x98, 0x08, 0x09, 0x4d,
-  0x00, 0x5c, 0x4f, 0xea, 0xf1, 0x8e, 0x84, 0x4a, 0x2c, 0x40, 0x34, 0xde,
-  0x75, 0x04, 0x85, 0x5d, 0x28, 0x42, 0x7c, 0xdf, 0x3c, 0x2b, 0x6d, 0x6d,
-  0xc1, 0x59, 0x92, 0x17, 0xc2, 0xe4, 0x01, 0x9e, 0x09, 0x58, 0x32, 0x72,
-  0x32, 0xd8, 0x8e, 0x44, 0x2b, 0x1d, 0x42, 0x7e, 0x3e, 0xeb, 0x8b, 0xeb,
-  0xbb, 0x08, 0x84, 0x14, 0x34, 0x85, 0x3e, 0xc4, 0xf0, 0x46, 0x18, 0x06,
-  0x03, 0x25, 0xb4, 0x74, 0x34, 0x12, 0x9d, 0xe3, 0x30, 0x40, 0x81, 0x04,
-  0x45, 0xb8, 0x6f, 0x03, 0xc6, 0xa2, 0x7c, 0xc7, 0xb5, 0x27, 0xf6, 0x56,
-  0xec, 0x12, 0x0a, 0xb0, 0xec, 0x6e, 0x18, 0x33, 0xb0, 0x14, 0x19, 0x90,
-  0x01, 0x98, 0x9b, 0xd1, 0x23, 0x24, 0xef, 0x42, 0xf8, 0xc9, 0x65, 0xc2,
-  0x73, 0xe8, 0x49, 0x3e, 0x59, 0x06, 0x24, 0xf5, 0x1b, 0x38, 0x40, 0x11,
-  0x82, 0xf8, 0x1e, 0xb9, 0x3b, 0xad, 0x8b, 0x5a, 0xdc, 0xde, 0x05, 0x07,
-  0x75, 0x1e, 0x0c, 0x78, 0x24, 0x19, 0x9f, 0xc9, 0xfc, 0x89, 0xe1, 0x23,
-  0xa6, 0x0c, 0x00, 0x53, 0x24, 0x4e, 0x8c, 0x00, 0x32, 0x3d, 0x56, 0x79,
-  0x1b, 0xa6, 0xc1, 0x19, 0x85, 0xcb, 0xf4, 0x2f, 0x45, 0x81, 0xa3, 0x22,
-  0x49, 0xb1, 0x9d, 0x3c, 0x96, 0x7b, 0x91, 0xc7, 0x59, 0x60, 0x70, 0x0e,
-  0x51, 0x70, 0xdb, 0x3a, 0x59, 0xd2, 0x4d, 0x94, 0xf3, 0xce, 0x0b, 0x22,
-  0x7b, 0xbf, 0xe9, 0x26, 0xf6, 0xda, 0x50, 0x2b, 0x1d, 0xc4, 0xb8, 0x44,
-  0x3f, 0x02, 0x31, 0x9c, 0x0a, 0x64, 0x08, 0x6c, 0x62, 0x99, 0x0a, 0x45,
-  0x5d, 0x60, 0xc4, 0x21, 0x8a, 0xe6, 0x4d, 0x10, 0x2b, 0xb8, 0x30, 0x6d,
-  0xa6, 0x17, 0x44, 0xcc, 0xc7, 0x64, 0xc6, 0x92, 0x47, 0x18, 0x7b, 0x3e,
-  0x28, 0x26, 0xee, 0xa0, 0xe5, 0xde, 0x13, 0x18, 0x56, 0x82, 0xf9, 0x18,
-  0x33, 0xe7, 0xc6, 0x28, 0xfd, 0x8d, 0x46, 0xd8, 0x40, 0x5e, 0xc2, 0x74,
-  0x61, 0xd8, 0x75, 0x94, 0x92, 0xed, 0x00, 0x16, 0x88, 0xff, 0xa9, 0x9c,
-  0xb2, 0xf8, 0xff, 0xd9, 0x36, 0x49, 0xa0, 0x4b, 0x16, 0x50, 0x83, 0x1b,
-  0x8d, 0x22, 0x0e, 0x21, 0xd9, 0xf8, 0xfe, 0xeb, 0xc4, 0xb6, 0x06, 0x63,
-  0x06, 0xa4, 0xb7, 0xb5, 0x9a, 0xa9, 0x30, 0x83, 0xc4, 0x3d, 0x11, 0x48,
-  0x9d, 0x31, 0xcd, 0x42, 0x50, 0x07, 0x77, 0x00, 0x26, 0x4b, 0x1d, 0x6d,
-  0x21, 0x0d, 0x1d, 0xd2, 0x55, 0x68, 0x00, 0xa1, 0x80, 0x05, 0x1e, 0xc7,
-  0xc1, 0x4f, 0x81, 0xc5, 0xea, 0xa4, 0xfe, 0x96, 0xa9, 0x62, 0x8f, 0x12,
-  0xe7, 0x4e, 0x02, 0x4e, 0x19, 0x84, 0x34, 0xd9, 0x64, 0xc4, 0x08, 0x21,
-  0x92, 0xc1, 0x15, 0x85, 0x82, 0xe5, 0x3b, 0xff, 0x10, 0x53, 0x6b, 0x59,
-  0x2b, 0x5d, 0x89, 0x85, 0x01, 0x00, 0x43, 0xd3, 0x30, 0x9c, 0x99, 0xf2,
-  0x68, 0x0d, 0x8b, 0x9a, 0x37, 0x0e, 0xd5, 0xf8, 0x09, 0x10, 0x5a, 0xc2,
-  0x5e, 0xb1, 0x7e, 0xfb, 0x8f, 0x00, 0xc2, 0x7c, 0xf5, 0x6e, 0xfb, 0x84,
-  0x47, 0x35, 0x13, 0x6c, 0x39, 0x53, 0x20, 0xc1, 0x43, 0xa8, 0x09, 0x15,
-  0x84, 0xc2, 0x03, 0xc2, 0xca, 0xfc, 0x1a, 0x13, 0x1a, 0x00, 0x85, 0x16,
-  0xa2, 0x42, 0xc8, 0x55, 0x08, 0x03, 0xc9, 0x00, 0x80, 0x30, 0x21, 0x90,
-  0x10, 0x80, 0x51, 0xf2, 0xd8, 0x01, 0xec, 0xd9, 0x08, 0x56, 0xc3, 0xa0,
-  0x06, 0x48, 0x39, 0x18, 0x2b, 0xac, 0xc1, 0x60, 0x4b, 0x2c, 0x8f, 0xd1,
-  0x3e, 0x08, 0x5d, 0x02, 0x67, 0x90, 0xd9, 0x0a, 0x39, 0xc5, 0x3f, 0x02,
-  0xf2, 0xaa, 0x12, 0x86, 0xc6, 0x69, 0x8d, 0x2f, 0x50, 0x60, 0x06, 0x1d,
-  0xb6, 0x87, 0x16, 0xe3, 0x54, 0x5f, 0xb0, 0x3d, 0x00, 0x03, 0xd0, 0xea,
-  0xa1, 0x00, 0x84, 0x4c, 0xa6, 0x0b, 0xce, 0x57, 0x4c, 0x97, 0x22, 0x6b,
-  0xff, 0x08, 0x3e, 0x4b, 0xe9, 0x58, 0xb4, 0x75, 0x18, 0x46, 0xd9, 0x16,
-  0xf9, 0x2f, 0x51, 0x65, 0x3b, 0xc1, 0x36, 0x9e, 0x0b, 0xc4, 0x9c, 0x16,
-  0x69, 0x1e, 0x78, 0x03, 0xc5, 0x31, 0x84, 0x45, 0xc9, 0x7d, 0x13, 0x59,
-  0x2e, 0xf5, 0xfe, 0xc2, 0x17, 0x45, 0x42, 0xf3, 0x48, 0x7f, 0x4e, 0x03,
-  0x17, 0x26, 0x13, 0x6e, 0x0c, 0x89, 0x16, 0xdd, 0x62, 0xa3, 0x9e, 0x0e,
-  0x4f, 0xa8, 0xc0, 0x3e, 0x41, 0x02, 0x6d, 0x41, 0xbe, 0x5c, 0x72, 0x00,
-  0x42, 0xfd, 0xed, 0xa1, 0x45, 0xdb, 0x0b, 0x06, 0x46, 0x74, 0xdb, 0x13,
-  0xa1, 0x04, 0x8b, 0x72, 0x52, 0x8a, 0x6c, 0x35, 0x28, 0x77, 0xdb, 0x76,
-  0x21, 0x31, 0x5a, 0x0f, 0x12, 0xad, 0xb0, 0x83, 0x73, 0x78, 0x2c, 0xb5,
-  0x21, 0xa1, 0x2c, 0xf6, 0x90, 0x81, 0xa3, 0x85, 0x79, 0x64, 0xbb, 0x0a,
-  0x0b, 0xd9, 0x37, 0x4d, 0xd1, 0x80, 0x46, 0x9e, 0x56, 0x83, 0x6e, 0x22,
-  0x58, 0xcf, 0x34, 0x90, 0x06, 0x2c, 0x12, 0x32, 0x6f, 0x16, 0x0d, 0xc9,
-  0x12, 0x68, 0x30, 0x86, 0x99, 0x52, 0x22, 0xdf, 0xe3, 0x9b, 0x2d, 0xa1,
-  0x06, 0x23, 0x43, 0x12, 0x45, 0x90, 0xa2, 0xe8, 0xeb, 0x1a, 0x32, 0x96,
-  0x99, 0xa3, 0x1b, 0x9c, 0x8d, 0xd0, 0x59, 0xca, 0xf6, 0x61, 0xeb, 0x4d,
-  0x71, 0x41, 0x8c, 0x71, 0x19, 0xa9, 0x68, 0x2e, 0x32, 0x96, 0x3b, 0x26,
-  0xc6, 0xc5, 0x08, 0x52, 0x2c, 0x6c, 0xae, 0xa8, 0x4e, 0xa1, 0x93, 0x86,
-  0x04, 0x64, 0xe1, 0x78, 0xc7, 0x06, 0x57, 0x6c, 0x05, 0xcd, 0x9e, 0xeb,
-  0xa8, 0x3d, 0xc8, 0x55, 0x56, 0x9b, 0xce, 0xc4, 0x92, 0x85, 0xeb, 0xc8,
-  0xf7, 0x0b, 0x8c, 0x31, 0x3e, 0xc1, 0x1f, 0x80, 0x25, 0x66, 0x98, 0xde,
-  0x73, 0x0c, 0x72, 0xb8, 0x7e, 0x0a, 0x72, 0xb1, 0xa1, 0xaf, 0x20, 0xc1,
-  0x59, 0x89, 0x13, 0x7f, 0x8a, 0x00, 0x45, 0x1f, 0x40, 0x88, 0x0d, 0x41,
-  0x95, 0x92, 0x4c, 0x0d, 0xf0, 0x83, 0x4a, 0x80, 0x8f, 0x32, 0x0a, 0x17,
-  0x24, 0x44, 0x81, 0xbd, 0xc9, 0xae, 0xd6, 0xa6, 0x97, 0x16, 0x10, 0x2c,
-  0x91, 0x9b, 0x18, 0x88, 0x2a, 0xb9, 0x0e, 0x02, 0x19, 0x0e, 0x08, 0x6c,
-  0x0c, 0xa3, 0x2c, 0x21, 0x3f, 0x5b, 0x80, 0xe2, 0x70, 0x2b, 0x5f, 0x27,
-  0xeb, 0x4f, 0x10, 0x25, 0x46, 0x88, 0x12, 0xa4, 0xb8, 0xd1, 0x29, 0x15,
-  0x21, 0xa4, 0x17, 0x95, 0xb4, 0x06, 0x8a, 0x2c, 0xb2, 0xd5, 0x12, 0x41,
-  0x46, 0x29, 0x6d, 0x25, 0x90, 0xa6, 0xc8, 0x0e, 0x14, 0xd2, 0x72, 0x75,
-  0x13, 0x4f, 0x10, 0x64, 0x4d, 0x4c, 0xcf, 0x24, 0x54, 0x77, 0x31, 0x6a,
-  0xb0, 0xa8, 0x25, 0x24, 0x05, 0x6c, 0xa8, 0xac, 0x01, 0x28, 0x4b, 0x2b,
-  0x4f, 0x74, 0x8b, 0xde, 0x0b, 0x95, 0xe3, 0xf0, 0x83, 0xbf, 0x56, 0x23,
-  0x3c, 0xec, 0x9e, 0x2e, 0x6f, 0x00, 0x44, 0x03, 0x17, 0x36, 0x19, 0x7f,
-  0x89, 0x87, 0x64, 0x23, 0x89, 0xed, 0x97, 0x66, 0x23, 0x0d, 0x6c, 0x0b,
-  0x8b, 0xd9, 0x0b, 0x87, 0x41, 0x09, 0x8f, 0x2c, 0x22, 0x1b, 0x58, 0x1e,
-  0x1d, 0xc7, 0x87, 0xae, 0x44, 0x5d, 0x63, 0x09, 0x5a, 0x10, 0x6b, 0x53,
-  0x05, 0x66, 0x5c, 0x67, 0x0f, 0x60, 0x23, 0x62, 0x26, 0x80, 0x0c, 0xe1,
-  0x3b, 0x50, 0x5a, 0x7b, 0x87, 0x52, 0x23, 0x31, 0x39, 0x68, 0x19, 0x6a,
-  0x27, 0x6c, 0x23, 0x6b, 0xe4, 0x05, 0x66, 0x6e, 0x5b, 0xf1, 0xd3, 0xdb,
-  0xe0, 0x05, 0x2a, 0x8c, 0x8b, 0xda, 0x15, 0x50, 0x6a, 0x06, 0xa2, 0xec,
-  0x5f, 0x49, 0xff, 0x50, 0x64, 0x4b, 0x8a, 0x29, 0x70, 0x0e, 0x22, 0x80,
-  0x99, 0xcb, 0x74, 0x4b, 0x16, 0x44, 0x5f, 0x97, 0x16, 0x2c, 0x14, 0x06,
-  0x5e, 0x6f, 0x22, 0x11, 0x17, 0x91, 0x80, 0x04, 0xf6, 0x8d, 0x07, 0x0f,
-  0x8a, 0xb2, 0xf6, 0x98, 0xab, 0xa2, 0xb3, 0x15, 0x00, 0x02, 0x83, 0x7a,
-  0x2d, 0x04, 0x89, 0xb3, 0x85, 0x98, 0x13, 0xc2, 0x82, 0xd0, 0x6c, 0xd7,
-  0x78, 0x20, 0x41, 0x76, 0x6a, 0xdd, 0x2f, 0xd3, 0x70, 0xdb, 0x28, 0x3b,
-  0xc0, 0x59, 0x3b, 0x6e, 0xe7, 0x75, 0x54, 0x33, 0x79, 0x7e, 0x1b, 0xff,
-  0xb7, 0x15, 0x03, 0xa1, 0x03, 0x0d, 0x44, 0x12, 0xc7, 0x6c, 0x18, 0x37,
-  0x41, 0xb2, 0x1a, 0x66, 0x6d, 0xc0, 0x0b, 0xd2, 0x50, 0xc1, 0xc8, 0xf4,
-  0x61, 0x76, 0x6a, 0x0c, 0x44, 0x19, 0x35, 0xed, 0xc4, 0x7e, 0x7e, 0xf0,
-  0x01, 0x0d, 0x26, 0x11, 0x68, 0x3f, 0x7c, 0x0a, 0x7c, 0x83, 0x06, 0x6f,
-  0x46, 0x80, 0x3d, 0x3b, 0x50, 0xe0, 0x76, 0xa7, 0x54, 0x45, 0x94, 0x6f,
-  0xfe, 0xa5, 0x0a, 0x0e, 0x0c, 0xe9, 0xef, 0x22, 0x06, 0x16, 0xca, 0x00,
-  0x44, 0xaa, 0xc0, 0x34, 0x43, 0x05, 0xa0, 0x04, 0xf7, 0x6d, 0x1a, 0x03,
-  0xc1, 0x57, 0x18, 0xc3, 0xeb, 0x12, 0x91, 0xa0, 0x29, 0xe7, 0xec, 0x07,
-  0x6a, 0xca, 0x00, 0x04, 0xc3, 0x58, 0x38, 0x5b, 0xab, 0x9b, 0x11, 0xdb,
-  0x95, 0xb9, 0x40, 0x76, 0xaf, 0x89, 0x4e, 0xad, 0x26, 0x90, 0x5e, 0x46,
-  0x73, 0xf3, 0xfa, 0x77, 0x3e, 0xf6, 0xf8, 0x77, 0x37, 0x88, 0x4b, 0x3b,
-  0x2b, 0x63, 0x6e, 0x57, 0xe1, 0x14, 0x03, 0xd0, 0xb2, 0xe2, 0x52, 0x12,
-  0x05, 0xfb, 0xe9, 0x4f, 0x01, 0x36, 0x64, 0xf8, 0x22, 0xd9, 0x79, 0xdb,
-  0x2b, 0x72, 0x1b, 0x47, 0x5b, 0x44, 0x52, 0x2e, 0x9a, 0x03, 0x46, 0xf8,
-  0x41, 0x50, 0x24, 0xe2, 0xdb, 0x17, 0x13, 0x38, 0xb8, 0x3d, 0x27, 0x26,
-  0x04, 0x40, 0x16, 0x4d, 0x2f, 0x5a, 0x18, 0x30, 0x6d, 0xfa, 0x9b, 0x4f,
-  0x5f, 0x18, 0x1a, 0x5e, 0x99, 0x07, 0x50, 0xf8, 0xbb, 0x52, 0x50, 0x40,
-  0x37, 0x52, 0x87, 0xc8, 0x10, 0xc6, 0x66, 0x51, 0x71, 0x04, 0xd4, 0xab,
-  0x4e, 0x14, 0xcc, 0x31, 0x2e, 0xbb, 0x05, 0x07, 0x77, 0x83, 0xd2, 0x9e,
-  0x80, 0x5f, 0x77, 0x12, 0x77, 0x42, 0x75, 0x77, 0x07, 0x47, 0x10, 0x77,
-  0xb0, 0x3a, 0x66, 0x5e, 0x17, 0xc1, 0x69, 0x64, 0x38, 0x6c, 0x67, 0x9c,
-  0x66, 0x0d, 0x87, 0x1e, 0x03, 0x46, 0xb9, 0x1f, 0x17, 0x62, 0x30, 0x39,
-  0x14, 0x58, 0x67, 0x22, 0x23, 0xee, 0x01, 0xa0, 0x18, 0x8e, 0x83, 0x08,
-  0xf2, 0x46, 0x0d, 0xc3, 0xdc, 0xe1, 0xfd, 0x51, 0x30, 0x25, 0x89, 0xcd,
-  0x66, 0x0d, 0xe9, 0x20, 0x57, 0xcc, 0x20, 0xc6, 0xc4, 0x1f, 0x11, 0x33,
-  0x72, 0xce, 0x73, 0x12, 0xe2, 0x8d, 0x00, 0x91, 0xff, 0x8c, 0x1f, 0xd8,
-  0x36, 0x45, 0x8c, 0x1f, 0x08, 0x64, 0xfb, 0xa2, 0xa6, 0xe7, 0x42, 0xc1,
-  0x12, 0xc8, 0x03, 0xd2, 0x54, 0x34, 0x4e, 0xdc, 0xd3, 0xd4, 0x64, 0xac,
-  0x0a, 0x90, 0x6c, 0x3e, 0xe0, 0x81, 0xcb, 0x75, 0xcf, 0xac, 0x00, 0xff,
-  0xe6, 0x6e, 0x9a, 0x6c, 0x0c, 0x85, 0xb7, 0x43, 0x06, 0x25, 0x04, 0x0f,
-  0xaf, 0xbe, 0x66, 0x2b, 0xc0, 0x1d, 0xe2, 0x76, 0xa6, 0x2e, 0xd0, 0x72,
-  0x08, 0xed, 0x29, 0x09, 0xb2, 0x93, 0x1f, 0x66, 0x5c, 0x06, 0x3f, 0xc1,
-  0xeb, 0x09, 0x87, 0xa0, 0xac, 0xb3, 0x2b, 0x80, 0x02, 0x81, 0xca, 0xba,
-  0x90, 0x24, 0x50, 0x0a, 0xc8, 0x99, 0x10, 0x15, 0xfe, 0x80, 0x43, 0xa1,
-  0x92, 0x24, 0xa5, 0xbd, 0x68, 0x29, 0x82, 0x40, 0x3c, 0x74, 0x74, 0x10,
-  0x9b, 0x3d, 0xa5, 0xe7, 0x95, 0xb2, 0x90, 0x0f, 0xde, 0x92, 0xec, 0xce,
-  0x47, 0xff, 0x18, 0x6f, 0x2a, 0xd0, 0x86, 0x49, 0x88, 0x23, 0x72, 0x9c,
-  0x68, 0x89, 0x86, 0x09, 0xd3, 0x63, 0x07, 0xb3, 0xc1, 0x0c, 0x83, 0x5e,
-  0x24, 0x28, 0x0a, 0xb3, 0xa8, 0xa9, 0xe6, 0x54, 0x2d, 0x45, 0xc8, 0xd9,
-  0xcb, 0x74, 0xe1, 0xe9, 0xf6, 0x02, 0x3e, 0xb2, 0xd9, 0x02, 0x17, 0xc8,
-  0x70, 0x0f, 0x48, 0x20, 0xf2, 0xb4, 0x02, 0x1e, 0xaa, 0x02, 0xcb, 0x55,
-  0x09, 0x2a, 0x0c, 0x5e, 0x00, 0x66, 0x8b, 0x00, 0xc2, 0x00, 0x90, 0x7e,
-  0xd5, 0x9d, 0x02, 0x10, 0x2d, 0x65, 0xf6, 0x90, 0xf4, 0x2d, 0x00, 0xad,
-  0x20, 0xb0, 0x96, 0xea, 0xe8, 0x82, 0x44, 0xb1, 0x24, 0x36, 0xb5, 0x0f,
-  0xca, 0x15, 0x87, 0xf2, 0x0e, 0x36, 0xf0, 0x20, 0xf3, 0x26, 0x89, 0xd9,
-  0x84, 0x0f, 0x29, 0xfe, 0xb7, 0x06, 0x02, 0x12, 0x39, 0x07, 0x5a, 0xb9,
-  0xf1, 0xa1, 0x7c, 0x12, 0x5e, 0xc2, 0x04, 0xa5, 0x07, 0x1a, 0x04, 0x30,
-  0x0a, 0x49, 0xd3, 0x80, 0x2e, 0xa5, 0xb2, 0x14, 0x94, 0xbd, 0xde, 0xc3,
-  0x25, 0x80, 0xcf, 0xe5, 0x44, 0xff, 0x09, 0xb0, 0xba, 0x0a, 0x39, 0x03,
-  0x6d, 0x2d, 0x7e, 0xd7, 0x4f, 0xfd, 0x22, 0x87, 0x4a, 0x01, 0x34, 0xb3,
-  0xbb, 0x21, 0xbd, 0xf0, 0xe2, 0x72, 0x1f, 0x7f, 0x76, 0xe0, 0x72, 0x18,
-  0x51, 0x62, 0x4b, 0x96, 0xd6, 0x0e, 0x58, 0x10, 0x8a, 0x6c, 0x2f, 0x98,
-  0x75, 0xdd, 0x77, 0x91, 0x83, 0xc0, 0x76, 0x0b, 0x9f, 0x95, 0x19, 0xa7,
-  0xd9, 0x17, 0xaa, 0x8a, 0xcc, 0x4e, 0x34, 0x4e, 0x89, 0x32, 0x56, 0x83,
-  0x0c, 0xd4, 0x5c, 0xb8, 0x12, 0x53, 0x05, 0xb8, 0x43, 0xa9, 0xfe, 0x4a,
-  0x51, 0x96, 0x24, 0xc1, 0x84, 0x08, 0x3c, 0x21, 0x49, 0xa1, 0xa3, 0x50,
-  0x40, 0x0c, 0xf8, 0xc0, 0x35, 0xb0, 0x02, 0xef, 0x5a, 0x09, 0xdb, 0x62,
-  0xfe, 0xc8, 0xa2, 0x6d, 0xdc, 0x78, 0x96, 0xde, 0xdc, 0x59, 0xde, 0xb0,
-  0x30, 0xfe, 0x81, 0xf1, 0x76, 0xf0, 0x24, 0xcb, 0xf2, 0xf0, 0x2c, 0xf2,
-  0xda, 0x0b, 0xfe, 0x40, 0x41, 0xb1, 0x54, 0x8d, 0x17, 0xec, 0xb3, 0x24,
-  0xee, 0x55, 0xe6, 0x0b, 0x51, 0xdc, 0x15, 0x19, 0xd6, 0xa8, 0x87, 0xa3,
-  0x04, 0x87, 0xc9, 0x29, 0xb8, 0x09, 0xc2, 0x23, 0x81, 0xc2, 0xa4, 0xfd,
-  0xba, 0x84, 0x12, 0x04, 0xc8, 0x26, 0xc2, 0x1f, 0x3c, 0x17, 0x6c, 0x33,
-  0x23, 0x74, 0xeb, 0x09, 0x83, 0x37, 0x1f, 0xa3, 0xfd, 0x88, 0x66, 0x0a,
-  0xd4, 0x0c, 0x00, 0x91, 0x39, 0xc0, 0x10, 0x4b, 0xaf, 0xfc, 0xa7, 0xfc,
-  0x68, 0xbb, 0x0e, 0x09, 0xf2, 0xfc, 0x16, 0xc7, 0x17, 0x18, 0x02, 0x91,
-  0x1c, 0x12, 0xb1, 0x14, 0x23, 0x4c, 0x47, 0xf1, 0x12, 0x72, 0x56, 0x77,
-  0x3f, 0x54, 0x10, 0x76, 0x4e, 0x60, 0x1c, 0x62, 0x43, 0x53, 0x99, 0x0c,
-  0x06, 0x3e, 0x17, 0xde, 0x89, 0x0f, 0x48, 0x0c, 0x7e, 0xfc, 0x63, 0x02,
-  0xc8, 0x53, 0xed, 0x89, 0x4b, 0x55, 0x4e, 0x7e, 0xaa, 0xb2, 0x93, 0x42,
-  0x6a, 0x18, 0x4b, 0x45, 0x4d, 0x10, 0xc3, 0xb1, 0x8b, 0x0c, 0x46, 0x0a,
-  0x42, 0x08, 0x10, 0x76, 0x2c, 0x55, 0x73, 0xc8, 0x16, 0x09, 0x80, 0x6d,
-  0xa7, 0xb8, 0x0b, 0x1c, 0x4e, 0x89, 0xfc, 0x00, 0x2c, 0x26, 0xba, 0xcb,
-  0xb7, 0x58, 0x45, 0x79, 0xae, 0x12, 0x10, 0x90, 0xa0, 0xe8, 0x42, 0xff,
-  0x4b, 0x50, 0x93, 0x47, 0x89, 0x40, 0xb0, 0x0c, 0x4e, 0xbc, 0xca, 0x6e,
-  0x6e, 0x05, 0xa2, 0x8b, 0xd2, 0x4f, 0x10, 0xec, 0xd4, 0xde, 0x07, 0xff,
-  0x14, 0x7f, 0x5f, 0x14, 0xe9, 0x58, 0x82, 0x01, 0x90, 0x34, 0x96, 0x3f,
-  0x14, 0x23, 0x12, 0x1b, 0xac, 0xd2, 0x43, 0xd1, 0x09, 0x41, 0x42, 0xcf,
-  0x76, 0x29, 0x9e, 0xda, 0x19, 0xa4, 0x80, 0x49, 0x7e, 0xc0, 0xeb, 0x61,
-  0x92, 0x25, 0xf6, 0x43, 0xdf, 0x01, 0x8a, 0x40, 0x4d, 0x5d, 0x2c, 0x04,
-  0x3b, 0x70, 0x20, 0xe6, 0x3b, 0x98, 0xfc, 0x6c, 0x48, 0xf4, 0xcd, 0x63,
-  0x61, 0xb6, 0x87, 0x02, 0x08, 0x7c, 0xdb, 0x3b, 0x14, 0x77, 0x86, 0x89,
-  0x1f, 0x6e, 0x1f, 0x77, 0x82, 0xc2, 0x1c, 0x54, 0x8f, 0x4e, 0xc2, 0x74,
-  0x60, 0x61, 0x92, 0x12, 0xcb, 0x3b, 0x0c, 0x09, 0xc0, 0x9f, 0x0e, 0x9b,
-  0x22, 0x0e, 0xc3, 0x19, 0xc0, 0x17, 0x0d, 0x20, 0x8f, 0x8e, 0xc6, 0x4c,
-  0x02, 0x77, 0x56, 0x83, 0x59, 0x09, 0xab, 0xda, 0x82, 0x0a, 0x42, 0xb7,
-  0x18, 0xca, 0x77, 0x5e, 0x16, 0x30, 0x77, 0x99, 0xfa, 0x64, 0xf8, 0xe5,
-  0xf4, 0x90, 0xf6, 0x8b, 0x92, 0x59, 0x65, 0xf6, 0x9b, 0x72, 0xf4, 0x73,
-  0x24, 0x2c, 0x6e, 0xc6, 0x77, 0x55, 0xe4, 0x6a, 0x13, 0x8d, 0x7b, 0xf8,
-  0x3f, 0x0a, 0x91, 0x8c, 0x77, 0xc3, 0xd2, 0xf4, 0x32, 0xf6, 0xc8, 0xf4,
-  0x73, 0xf0, 0xc8, 0xf2, 0x44, 0xbc, 0x7c, 0x20, 0xd7, 0xb2, 0x70, 0x26,
-  0x52, 0x30, 0xe8, 0x41, 0x48, 0x68, 0x2c, 0x39, 0xc6, 0x77, 0x13, 0xf2,
-  0x27, 0xf0, 0x3b, 0x1c, 0xc6, 0x77, 0x44, 0x6c, 0x3b, 0x84, 0x7b, 0x77,
-  0x9f, 0x2a, 0xe3, 0xb2, 0x77, 0x09, 0xa8, 0x1c, 0xcd, 0x87, 0x60, 0xca,
-  0x18, 0xfd, 0x76, 0x18, 0x02, 0x60, 0xcd, 0x48, 0x3c, 0xd4, 0x26, 0x95,
-  0xce, 0x65, 0x12, 0xe8, 0x03, 0x10, 0x0c, 0xa2, 0xd9, 0x17, 0x58, 0x0c,
-  0x9f, 0x81, 0x44, 0x58, 0x95, 0xb3, 0x33, 0x66, 0xcb, 0xc2, 0x46, 0x59,
-  0x12, 0xb2, 0x41, 0x26, 0x2b, 0x59, 0x1b, 0x40, 0x9a, 0x29, 0x16, 0x30,
-  0xec, 0x79, 0xee, 0xb4, 0x43, 0x01, 0x5b, 0x54, 0xe8, 0x26, 0x2c, 0x45,
-  0xa4, 0x55, 0x4c, 0x96, 0x2c, 0x9f, 0xc5, 0xdb, 0x50, 0x16, 0xff, 0x2a,
-  0x04, 0x7b, 0xee, 0x30, 0x31, 0x61, 0x50, 0x3b, 0xf6, 0xfe, 0x2a, 0x37,
-  0x0a, 0x6c, 0xeb, 0xfe, 0x25, 0x0c, 0x5b, 0x50, 0xfe, 0x9e, 0xf4, 0xf0,
-  0x44, 0x1a, 0xc2, 0xfc, 0x57, 0xc9, 0xfe, 0x10, 0x9b, 0x76, 0x4d, 0x03,
-  0x84, 0x22, 0xbe, 0xd8, 0x4d, 0xe0, 0xa8, 0xfe, 0x2c, 0x03, 0xd5, 0x02,
-  0x4f, 0x28, 0x70, 0x0b, 0x72, 0x5a, 0x8a, 0x6e, 0x95, 0x0c, 0xeb, 0x49,
-  0x24, 0x17, 0xc1, 0x16, 0xd0, 0x08, 0x4c, 0xe8, 0x64, 0x02, 0x60, 0x29,
-  0x32, 0x98, 0x5d, 0x62, 0xcd, 0x71, 0x94, 0x63, 0xec, 0x44, 0xfe, 0x58,
-  0xd1, 0x46, 0x2c, 0x2a, 0x2d, 0x7e, 0x91, 0x01, 0x00, 0x8c, 0x86, 0x1e,
-  0xb1, 0x1c, 0x2f, 0x93, 0xea, 0x72, 0x18, 0x3f, 0xe8, 0x76, 0x11, 0x60,
-  0x88, 0x73, 0x1c, 0x46, 0x1e, 0xbc, 0xcc, 0xec, 0x15, 0x46, 0x04, 0x62,
-  0xf6, 0x22, 0x47, 0x37, 0xaf, 0xfe, 0x20, 0xe8, 0xa5, 0xfe, 0x90, 0x25,
-  0x91, 0x06, 0xc0, 0x04, 0xac, 0x9c, 0xb1, 0x1f, 0xb7, 0x5c, 0x17, 0xc3,
-  0xa1, 0xb4, 0x05, 0x18, 0x4b, 0x47, 0xd8, 0x55, 0x98, 0x3d, 0xb2, 0xf8,
-  0x96, 0x34, 0x62, 0xca, 0xf8, 0xdf, 0x34, 0xa3, 0x40, 0x65, 0xd3, 0x6a,
-  0xa3, 0x8b, 0x26, 0x83, 0x00, 0x8e, 0x02, 0xa0, 0x0f, 0x2c, 0x05, 0x61,
-  0x03, 0x77, 0x7e, 0x13, 0x56, 0x10, 0xe9, 0x8d, 0x00, 0x9c, 0x1d, 0x27,
-  0x10, 0xeb, 0x8c, 0x69, 0xae, 0x0d, 0x3a, 0x2c, 0xb0, 0x38, 0x86, 0x26,
-  0x48, 0x59, 0x30, 0x6c, 0xc2, 0x0c, 0x01, 0x8d, 0x99, 0x2d, 0x49, 0x06,
-  0x20, 0x28, 0xf1, 0xea, 0x48, 0x5a, 0x5f, 0x10, 0x72, 0x8c, 0x37, 0x0e,
-  0x72, 0x85, 0x15, 0x42, 0x5b, 0x17, 0x0c, 0x14, 0x21, 0xc8, 0x5a, 0x00,
-  0x11, 0xf0, 0x09, 0x68, 0x52, 0xa7, 0x8e, 0x04, 0x7a, 0x63, 0x80, 0xcc,
-  0xea, 0x59, 0x49, 0xa4, 0x67, 0xb0, 0x80, 0x83, 0x0d, 0x96, 0x01, 0x7f,
-  0xe9, 0x01, 0xba, 0x00, 0xd5, 0x02, 0x2b, 0x12, 0x74, 0xb4, 0x76, 0x6f,
-  0x27, 0x14, 0x72, 0x17, 0x32, 0x51, 0x85, 0xfb, 0x8c, 0x12, 0x1e, 0x1e,
-  0x3b, 0x05, 0x47, 0x41, 0x45, 0xb6, 0x80, 0x56, 0x0d, 0x5b, 0x4b, 0xa5,
-  0x18, 0x82, 0x16, 0x41, 0x39, 0xb6, 0x01, 0x0a, 0x29, 0xdf, 0x2c, 0x83,
-  0x5e, 0x14, 0x00, 0x12, 0xe4, 0x03, 0x3b, 0x08, 0x0a, 0x6c, 0x2b, 0xd9,
-  0x87, 0x07, 0x03, 0x10, 0x0b, 0x36, 0x81, 0xda, 0x46, 0x16, 0x84, 0x24,
-  0xbe, 0x36, 0xd6, 0xcb, 0x14, 0x12, 0x20, 0x89, 0xba, 0xe4, 0xb3, 0xee,
-  0xac, 0x15, 0x75, 0x81, 0x0d, 0xb9, 0x5e, 0x74, 0x47, 0x0d, 0x95, 0xe5,
-  0x23, 0xcc, 0xd9, 0x37, 0x8f, 0x60, 0x64, 0xbb, 0x63, 0xdc, 0xc2, 0x94,
-  0x05, 0x32, 0xed, 0x41, 0x84, 0x8a, 0xa8, 0x64, 0xa0, 0x01, 0x93, 0x4f,
-  0x99, 0x48, 0x98, 0xb5, 0x40, 0x82, 0x59, 0xc0, 0x69, 0x38, 0x00, 0x18,
-  0x03, 0xa2, 0xee, 0x16, 0x2c, 0x01, 0x56, 0xca, 0x45, 0x8f, 0xfa, 0xfe,
-  0x08, 0xeb, 0x13, 0x3f, 0x21, 0xbc, 0x46, 0x26, 0xef, 0xc8, 0x47, 0xbc,
-  0xb2, 0xfe, 0x24, 0xef, 0x5c, 0xaf, 0x9c, 0xa8, 0x97, 0x70, 0x21, 0x03,
-  0x54, 0x21, 0xb0, 0xee, 0x6c, 0xb8, 0xe8, 0x2a, 0xeb, 0x11, 0xf5, 0x0b,
-  0xd6, 0x20, 0x56, 0x45, 0x5a, 0x8c, 0x1c, 0xb1, 0x64, 0x5a, 0x82, 0x85,
-  0x3a, 0xcb, 0xff, 0xff, 0xff, 0x15, 0x6a, 0xcb, 0x10, 0xba, 0x04, 0x11,
-  0x65, 0xf7, 0x89, 0x67, 0xe6, 0x89, 0x78, 0x0f, 0x92, 0x67, 0x18, 0xe0,
-  0x81, 0xb6, 0x51, 0x53, 0x42, 0xd1, 0xe0, 0x02, 0xcd, 0x06, 0xc2, 0x12,
-  0x44, 0x91, 0x5d, 0x68, 0x76, 0xc7, 0x9e, 0x58, 0x29, 0xc1, 0x74, 0x5e,
-  0xf8, 0x19, 0x7d, 0x37, 0x2e, 0x0d, 0x00, 0x4b, 0xa5, 0x06, 0x11, 0xf3,
-  0x77, 0x1c, 0x72, 0xec, 0x73, 0x15, 0x26, 0xd9, 0x1a, 0x20, 0x91, 0xd0,
-  0x00, 0x9a, 0x93, 0xab, 0x23, 0x7c, 0xfa, 0x00, 0x72, 0xb6, 0xde, 0xf8,
-  0x0a, 0x72, 0xae, 0xd6, 0x05, 0xe3, 0xed, 0x75, 0x28, 0x05, 0x96, 0xe8,
-  0x22, 0xcb, 0xe8, 0x45, 0x86, 0xbe, 0x8f, 0x69, 0x12, 0x3e, 0x48, 0x94,
-  0xcc, 0x19, 0x67, 0xa8, 0xcc, 0x1a, 0x11, 0xe8, 0x25, 0x20, 0x78, 0x2f,
-  0xec, 0x10, 0x5a, 0x59, 0x40, 0x68, 0xb2, 0xc7, 0xdb, 0x37, 0xdc, 0xa2,
-  0xfe, 0x84, 0x80, 0x86, 0x18, 0x04, 0x56, 0x8d, 0x14, 0x67, 0x88, 0x16,
-  0xdd, 0x83, 0x6e, 0xa4, 0x5e, 0x27, 0x77, 0xcf, 0xa5, 0x72, 0x02, 0xc4,
-  0x73, 0x9d, 0x8c, 0x6a, 0xfa, 0xb2, 0xf8, 0x18, 0x30, 0xe9, 0xd0, 0x1a,
-  0xae, 0xca, 0x7e, 0xb9, 0x5d, 0x29, 0xb2, 0x52, 0x2f, 0x9c, 0xfb, 0x19,
-  0x4f, 0x7e, 0x08, 0x42, 0x3b, 0x7b, 0x74, 0x24, 0x1f, 0x30, 0x48, 0x21,
-  0xa2, 0x81, 0x6c, 0x01, 0xd8, 0xcc, 0xf8, 0x54, 0x7b, 0x08, 0xfe, 0x91,
-  0x35, 0x46, 0x8a, 0x3e, 0xeb, 0x03, 0xbe, 0x01, 0x03, 0xf4, 0x23, 0xa0,
-  0xea, 0x30, 0xae, 0xe7, 0xe8, 0x61, 0x5c, 0x8b, 0x61, 0x36, 0x5c, 0x57,
-  0x6f, 0x24, 0xea, 0xab, 0xfd, 0x83, 0x15, 0x0e, 0x17, 0x83, 0x11, 0x34,
-  0x18, 0x0e, 0x06, 0x27, 0x2c, 0x01, 0x82, 0xd8, 0x82, 0x5a, 0x48, 0x0e,
-  0xc2, 0xfb, 0xd1, 0x64, 0xf4, 0x4e, 0x91, 0x00, 0x80, 0xcd, 0xce, 0x26,
-  0x4d, 0x80, 0xc8, 0xcd, 0x31, 0x09, 0x05, 0x60, 0x94, 0x21, 0x60, 0x90,
-  0x34, 0x38, 0x92, 0x7d, 0xa4, 0xa1, 0xd0, 0x20, 0x54, 0x89, 0xed, 0x08,
-  0xe0, 0x87, 0x88, 0xca, 0x94, 0x67, 0xbd, 0x1a, 0x90, 0xab, 0x82, 0x03,
-  0x10, 0x58, 0x3d, 0xcb, 0x3d, 0x16, 0x15, 0x0b, 0x99, 0x41, 0x97, 0x06,
-  0x3f, 0x06, 0x24, 0xe2, 0xeb, 0x76, 0x30, 0x63, 0x1c, 0x4c, 0x05, 0xe0,
-  0x2b, 0x88, 0x05, 0x52, 0x53, 0x60, 0x28, 0x4e, 0x50, 0xe5, 0xcd, 0x19,
-  0xb1, 0x32, 0xe4, 0x86, 0x6a, 0x05, 0xf9, 0xa1, 0x07, 0x08, 0x9d, 0x11,
-  0xd2, 0x26, 0x83, 0x20, 0x16, 0x5c, 0x58, 0x09, 0x9f, 0x0d, 0xb3, 0x75,
-  0x89, 0x35, 0x04, 0xfb, 0x7f, 0xc7, 0x87, 0x8c, 0x5a, 0xa0, 0xc0, 0xa3,
-  0xc2, 0x6c, 0xd9, 0x2e, 0xe3, 0x22, 0x8c, 0xa2, 0x30, 0x98, 0x63, 0x80,
-  0xfa, 0x9c, 0x12, 0x04, 0x55, 0xc5, 0x42, 0x94, 0x03, 0x3c, 0x36, 0x2f,
-  0x0b, 0xe9, 0x04, 0x10, 0xe8, 0xe8, 0x12, 0x5d, 0x44, 0x61, 0xf3, 0xa9,
-  0x01, 0x55, 0x08, 0x85, 0x82, 0x97, 0x3a, 0x6d, 0xb8, 0xbe, 0x03, 0x2f,
-  0x3a, 0x54, 0x66, 0x49, 0x08, 0xac, 0x7a, 0xbb, 0x16, 0x46, 0x1c, 0xb8,
-  0x43, 0x04, 0x81, 0xee, 0xd5, 0xc9, 0x66, 0x7b, 0x88, 0x8d, 0x97, 0x90,
-  0xf2, 0xde, 0x0c, 0x88, 0x84, 0x73, 0x9f, 0xf2, 0x03, 0xc2, 0x8b, 0xd0,
-  0xd8, 0x36, 0x11, 0xd1, 0xbd, 0x08, 0x02, 0xa0, 0x06, 0x02, 0x35, 0xd8,
-  0xc3, 0x81, 0x96, 0x61, 0x2b, 0xf0, 0xac, 0xda, 0xd6, 0x31, 0x02, 0xba,
-  0x06, 0x8b, 0xbd, 0xb0, 0xc0, 0x2b, 0xa9, 0x13, 0xf8, 0x9d, 0x16, 0x03,
-  0x60, 0x44, 0x1f, 0x9a, 0x70, 0x01, 0xd9, 0xc3, 0x0d, 0x9f, 0xde, 0x23,
-  0xba, 0xcd, 0xb5, 0xc2, 0x57, 0xa9, 0x77, 0x98, 0x1d, 0x1a, 0xc3, 0xe6,
-  0xd9, 0xeb, 0x18, 0x41, 0x6c, 0x72, 0xd8, 0x24, 0x62, 0x24, 0xa7, 0xb1,
-  0x12, 0x98, 0x06, 0x10, 0x5b, 0x72, 0x0a, 0x8b, 0x61, 0x53, 0xe4, 0x6d,
-  0x99, 0x3e, 0x21, 0x61, 0x3b, 0x21, 0xf7, 0x78, 0x0e, 0x76, 0x15, 0x4e,
-  0x35, 0x70, 0x20, 0x40, 0x3e, 0xe8, 0x64, 0x8e, 0xac, 0x55, 0x0f, 0xea,
-  0x38, 0x8e, 0x2a, 0x14, 0xb3, 0x52, 0x0a, 0xe2, 0x3f, 0x74, 0x29, 0x82,
-  0xe1, 0xa3, 0x00, 0x60, 0xd4, 0x8f, 0x1d, 0x65, 0x0e, 0x88, 0x03, 0xd7,
-  0xaf, 0x0a, 0x4b, 0x04, 0x3c, 0xf7, 0xb2, 0x11, 0x1d, 0xd3, 0xbe, 0xc5,
-  0xeb, 0x14, 0x48, 0x7d, 0xd8, 0x20, 0x19, 0x72, 0x7d, 0xe0, 0x98, 0x46,
-  0xa8, 0xdc, 0xed, 0x7c, 0xe7, 0xe8, 0x23, 0x9e, 0x2c, 0x61, 0x1f, 0x5d,
-  0x2d, 0xf3, 0xcb, 0x92, 0xcf, 0x74, 0x4c, 0x92, 0x0b, 0x46, 0x6c, 0x01,
-  0xa8, 0x31, 0xa6, 0x6a, 0x02, 0x55, 0x4e, 0x5d, 0x7a, 0x08, 0x30, 0xdd,
-  0x3f, 0xd1, 0x01, 0xac, 0x7d, 0x2a, 0xac, 0x01, 0x76, 0xf7, 0xb8, 0x5c,
-  0xca, 0x17, 0xd1, 0x56, 0xb9, 0x4a, 0x06, 0xe8, 0x01, 0x0d, 0x17, 0x74,
-  0xb9, 0x14, 0x0f, 0xb0, 0x4f, 0xf2, 0xa2, 0x94, 0x03, 0x91, 0x01, 0x66,
-  0x23, 0xfa, 0xb3, 0xf6, 0xbe, 0x4e, 0x0a, 0x0a, 0x32, 0xa5, 0x54, 0x49,
-  0x27, 0xb6, 0x78, 0x9a, 0xf1, 0x0a, 0x86, 0x41, 0x14, 0xa9, 0x20, 0xb9,
-  0x80, 0x89, 0x35, 0x09, 0x0d, 0xee, 0x2b, 0xc0, 0xc7, 0x50, 0x04, 0x9e,
-  0x3e, 0x03, 0xc7, 0xe5, 0x1c, 0x92, 0x78, 0xc1, 0x61, 0xba, 0x13, 0x44,
-  0x40, 0xa6, 0x59, 0x40, 0x12, 0x51, 0x69, 0x4e, 0xb7, 0xeb, 0x12, 0x12,
-  0x89, 0xd9, 0x86, 0xc5, 0x1a, 0x28, 0xfb, 0x8b, 0xfe, 0x14, 0x0d, 0x46,
-  0x29, 0x17, 0x03, 0x6b, 0x60, 0x1e, 0x59, 0x61, 0xa8, 0x69, 0xef, 0xfe,
-  0xb6, 0xeb, 0x62, 0x5c, 0x0d, 0x0d, 0xcc, 0x07, 0xa1, 0x3c, 0xeb, 0x0d,
-  0x64, 0x5a, 0x2c, 0xb0, 0x28, 0xc7, 0xe1, 0xa0, 0x8c, 0x0a, 0x96, 0x15,
-  0x18, 0xe8, 0x4c, 0x15, 0xc2, 0x2c, 0xdf, 0x0d, 0x88, 0xd9, 0x00, 0x46,
-  0x57, 0x8c, 0x8c, 0x3e, 0xc6, 0x77, 0xda, 0xce, 0x29, 0x0e, 0x42, 0x64,
-  0x0e, 0xd8, 0x50, 0xb2, 0x29, 0xc0, 0x42, 0xfe, 0x12, 0x30, 0x3c, 0xa6,
-  0x6d, 0x42, 0xb4, 0x91, 0x65, 0xa4, 0xd3, 0x34, 0x11, 0x27, 0xb1, 0x07,
-  0x01, 0x67, 0x8e, 0x03, 0x44, 0x06, 0x31, 0x18, 0xda, 0xc5, 0xf4, 0xce,
-  0x7c, 0x9d, 0x40, 0x1a, 0x37, 0x02, 0x1d, 0x68, 0x01, 0x0d, 0x72, 0x2e,
-  0x2a, 0x4b, 0xe9, 0x40, 0x61, 0x4c, 0x22, 0x6b, 0xe1, 0x02, 0x51, 0x0b,
-  0x63, 0x33, 0x47, 0x00, 0x84, 0xee, 0xb1, 0xcd, 0x7c, 0xbd, 0x27, 0xf3,
-  0xd1, 0xcf, 0xca, 0xa2, 0x20, 0x30, 0x2f, 0x24, 0x67, 0xe4, 0xee, 0x1a,
-  0x04, 0x7b, 0xcf, 0x17, 0x23, 0x53, 0xde, 0x83, 0xd2, 0x86, 0xe6, 0x46,
-  0x0c, 0xbf, 0xc1, 0xf5, 0xa0, 0x4a, 0x05, 0xd2, 0x7d, 0x24, 0xec, 0x75,
-  0x1f, 0xc2, 0xec, 0x00, 0x5e, 0x23, 0x64, 0x2f, 0xcf, 0xfa, 0xf8, 0x3c,
-  0xf8, 0xec, 0x76, 0x23, 0x4b, 0x36, 0xf8, 0x2c, 0xfc, 0xe8, 0xa1, 0xb7,
-  0x23, 0x07, 0x96, 0xd8, 0x0a, 0x6e, 0x6c, 0xff, 0x96, 0xfc, 0x4f, 0x21,
-  0xb8, 0x46, 0x24, 0xc9, 0xdc, 0x08, 0xa2, 0x35, 0x8c, 0xa2, 0x26, 0xbd,
-  0x3c, 0x00, 0x87, 0xe1, 0x2f, 0xdf, 0x74, 0xec, 0x06, 0x5c, 0xd8, 0x74,
-  0xe5, 0x16, 0x74, 0x1f, 0x02, 0xf8, 0x36, 0x18, 0x2a, 0x5b, 0x23, 0x5f,
-  0x05, 0x5c, 0x44, 0x4a, 0x79, 0xd6, 0x12, 0x7a, 0x80, 0xfb, 0xd6, 0x21,
-  0x48, 0x20, 0x45, 0x54, 0x96, 0x3c, 0x0a, 0x43, 0xff, 0x66, 0xc1, 0x32,
-  0x6f, 0x06, 0x61, 0xc9, 0xb4, 0x92, 0xe5, 0x11, 0xec, 0xf2, 0x83, 0xb4,
-  0x02, 0x11, 0x18, 0xc4, 0x46, 0x1f, 0x96, 0xe9, 0x83, 0xeb, 0xa9, 0x05,
-  0x80, 0x13, 0x8b, 0xd2, 0x34, 0x47, 0xce, 0x83, 0xdc, 0xa6, 0xd1, 0x90,
-  0x6a, 0x9c, 0xbe, 0x00, 0x15, 0x58, 0xa9, 0x61, 0xd7, 0x2c, 0x3a, 0x77,
-  0x09, 0x04, 0x1b, 0xff, 0x6d, 0x6f, 0x42, 0x06, 0x6c, 0xcc, 0x3b, 0x55,
-  0xb6, 0xf8, 0x0c, 0x29, 0x18, 0xab, 0x1c, 0x06, 0x26, 0x2a, 0x41, 0xec,
-  0x82, 0x86, 0xac, 0xb1, 0x6c, 0x0a, 0x62, 0xea, 0x73, 0xa1, 0xec, 0x42,
-  0xaf, 0x06, 0xa0, 0x24, 0x1d, 0x18, 0x60, 0x02, 0xb0, 0x51, 0xc4, 0x40,
-  0xb4, 0x7b, 0xc4, 0x84, 0x90, 0xab, 0x66, 0x05, 0x83, 0x0d, 0x5a, 0xad,
-  0x03, 0xa5, 0x16, 0xee, 0xec, 0x76, 0x0b, 0x4e, 0xed, 0x79, 0xd9, 0xa8,
-  0x4b, 0xcd, 0xb2, 0x85, 0x7f, 0x84, 0xf4, 0xbf, 0x9a, 0x22, 0x01, 0x8a,
-  0xea, 0x0e, 0xa3, 0x0c, 0xb3, 0x3b, 0xb4, 0x3e, 0x08, 0x44, 0x4d, 0x06,
-  0xb7, 0x72, 0x13, 0x80, 0x4f, 0x42, 0x08, 0x0c, 0x6b, 0x2a, 0x0a, 0x26,
-  0x00, 0x43, 0xb2, 0x0a, 0x15, 0xe4, 0x0a, 0xb9, 0x0e, 0x9b, 0xab, 0xb6,
-  0xb3, 0xff, 0x58, 0x82, 0xe6, 0xa1, 0x6d, 0x50, 0x06, 0x9b, 0x0c, 0x1d,
-  0x04, 0x81, 0xe5, 0x37, 0xdf, 0x67, 0x06, 0x9e, 0x61, 0x2f, 0x23, 0x9b,
-  0xec, 0x17, 0x28, 0x8f, 0x98, 0x05, 0x3c, 0x0a, 0x81, 0xec, 0x74, 0x11,
-  0x1e, 0xbc, 0x07, 0x07, 0xf2, 0x06, 0x12, 0xdc, 0xc5, 0x54, 0x08, 0xec,
-  0xd6, 0x9b, 0x1a, 0x06, 0x66, 0x0a, 0x96, 0x13, 0x08, 0x5c, 0x75, 0x0c,
-  0xb3, 0x0e, 0x22, 0x24, 0xec, 0x0d, 0xbb, 0xbb, 0xd1, 0xff, 0x81, 0x05,
-  0xb9, 0x3d, 0xad, 0x0d, 0x35, 0xe2, 0xe4, 0x0b, 0x27, 0x77, 0x98, 0x0f,
-  0x53, 0x77, 0x64, 0x9a, 0x56, 0x08, 0x24, 0x8e, 0xc4, 0x1b, 0x34, 0x01,
-  0xe6, 0x72, 0x51, 0x77, 0xe8, 0x00, 0x76, 0x49, 0x93, 0x2c, 0x80, 0x0e,
-  0xff, 0x5f, 0xa3, 0x94, 0x26, 0x81, 0xb7, 0x3e, 0x03, 0x00, 0x10, 0x68,
-  0x9a, 0x57, 0x14, 0x07, 0xda, 0xa1, 0x04, 0x35, 0xf2, 0xc0, 0x1c, 0x83,
-  0xaa, 0x24, 0x20, 0xb4, 0xdc, 0x81, 0x4e, 0x17, 0xb4, 0xa3, 0x9a, 0xb5,
-  0x26, 0x8d, 0xad, 0x03, 0x8d, 0xb4, 0x0a, 0x8a, 0x6b, 0x89, 0x32, 0x19,
-  0x00, 0xba, 0xa3, 0x92, 0x26, 0xc3, 0x99, 0x78, 0x4d, 0xa1, 0xc3, 0x9b,
-  0x24, 0x9a, 0xbd, 0xc7, 0x32, 0x10, 0x48, 0xfc, 0x6a, 0x02, 0x64, 0xe2,
-  0x54, 0x63, 0x49, 0x9e, 0x47, 0x92, 0x51, 0x9c, 0xbb, 0x1b, 0x16, 0x96,
-  0x37, 0x76, 0x98, 0x26, 0x16, 0x5d, 0xa2, 0xba, 0x0e, 0x90, 0x26, 0x00,
-  0xb4, 0xe6, 0x6e, 0xb5, 0xfe, 0x04, 0x2a, 0x1e, 0xa8, 0xb5, 0x6d, 0x5a,
-  0x0c, 0xd3, 0x04, 0x38, 0xeb, 0x10, 0x0c, 0xd7, 0x2e, 0x00, 0x82, 0xdb,
-  0x5e, 0x36, 0x3c, 0x5a, 0x03, 0xdd, 0x43, 0xa1, 0x90, 0x96, 0xb1, 0x89,
-  0x12, 0x5f, 0x78, 0x0f, 0x95, 0x01, 0x00, 0xcd, 0x43, 0x25, 0xd8, 0x74,
-  0x15, 0x41, 0xe2, 0xb8, 0xba, 0xc2, 0xb7, 0x6f, 0x38, 0x3f, 0x03, 0xc1,
-  0x32, 0x37, 0x16, 0x51, 0x0b, 0x3f, 0x64, 0x55, 0xb9, 0x0a, 0x38, 0xc0,
-  0x22, 0xd0, 0xaa, 0xc2, 0x7f, 0x0a, 0x4b, 0xd8, 0xbc, 0x7c, 0x43, 0x40,
-  0x82, 0xfe, 0xcd, 0xc2, 0x1a, 0xed, 0xed, 0xd5, 0x97, 0x9e, 0x96, 0xd2,
-  0xeb, 0x0f, 0x0b, 0xed, 0xb1, 0x75, 0x35, 0x14, 0xbd, 0xa3, 0x18, 0x8b,
-  0xdf, 0x9e, 0x15, 0xff, 0xb7, 0xd6, 0x11, 0x03, 0xb4, 0x19, 0x40, 0x9f,
-  0x71, 0x47, 0x3b, 0xfe, 0xdb, 0x7c, 0xe4, 0xa4, 0x68, 0x34, 0x43, 0x84,
-  0xd8, 0x3b, 0x46, 0x6a, 0x58, 0x3f, 0xa0, 0x66, 0x65, 0x64, 0x4c, 0xb7,
-  0x2a, 0x27, 0xad, 0x33, 0x97, 0x04, 0x7c, 0xff, 0x6a, 0xbc, 0x54, 0x48,
-  0xb0, 0x12, 0xdc, 0xcd, 0x93, 0x03, 0xc3, 0x04, 0x73, 0xc2, 0x38, 0x06,
-  0x2b, 0x8f, 0x04, 0x6c, 0x5f, 0xa8, 0x17, 0xa7, 0x36, 0x77, 0xde, 0x40,
-  0x97, 0x43, 0xfb, 0x7c, 0xe3, 0x9a, 0x87, 0x40, 0x91, 0x16, 0x13, 0x18,
-  0x7d, 0xa6, 0x3b, 0x36, 0xb0, 0x3e, 0x73, 0xf3, 0x7d, 0x6f, 0xcf, 0x68,
-  0x9b, 0x3c, 0x73, 0x97, 0x39, 0xb6, 0x36, 0x82, 0x75, 0x2a, 0x56, 0xe3,
-  0x4f, 0xda, 0xa1, 0x4e, 0x0a, 0x95, 0x65, 0xb2, 0x0f, 0xaa, 0x32, 0xa6,
-  0xcb, 0xa4, 0x8c, 0x34, 0xb2, 0xb2, 0x09, 0xcb, 0xae, 0xac, 0xed, 0x26,
-  0xeb, 0x7d, 0x0e, 0x91, 0xba, 0x96, 0xb6, 0xb4, 0x5c, 0x6e, 0x56, 0x2f,
-  0x62, 0x66, 0x0c, 0x9a, 0xb9, 0x9d, 0x77, 0x7f, 0x4e, 0x74, 0x3f, 0x8b,
-  0xb5, 0x1e, 0x0e, 0x96, 0xda, 0xf1, 0x0d, 0x90, 0x27, 0xac, 0x5e, 0xed,
-  0x06, 0x17, 0x6f, 0xe5, 0x66, 0x0c, 0x04, 0x9a, 0x75, 0x66, 0x98, 0xc8,
-  0x04, 0x27, 0x60, 0x1f, 0xd9, 0xb8, 0xb7, 0xa7, 0x32, 0xc2, 0x42, 0x20,
-  0xf1, 0xf9, 0x24, 0x31, 0xc8, 0x06, 0x0c, 0x6c, 0xfb, 0x14, 0x0d, 0x04,
-  0xa7, 0x0e, 0xb2, 0xe6, 0x33, 0xc0, 0x15, 0xfe, 0x90, 0x87, 0xfe, 0x3f,
-  0x88, 0x08, 0xb2, 0xd2, 0x50, 0x4c, 0xf4, 0x2a, 0x99, 0x39, 0x6d, 0x1a,
-  0x8a, 0xbe, 0x05, 0x98, 0xba, 0x0c, 0x02, 0x88, 0x06, 0x04, 0x80, 0xfa,
-  0x05, 0x9a, 0xec, 0xd1, 0x6f, 0x06, 0x03, 0x3b, 0xfe, 0x19, 0x5d, 0x1c,
-  0x3a, 0x6e, 0x34, 0x7c, 0xdb, 0xda, 0x9e, 0xe4, 0xdb, 0x0e, 0x1f, 0x76,
-  0x2d, 0x15, 0x1c, 0xf9, 0xc0, 0x7a, 0x64, 0x7e, 0x29, 0x65, 0x6f, 0x32,
-  0x44, 0x42, 0x0a, 0xfb, 0x88, 0x2c, 0x14, 0x26, 0x8b, 0x74, 0x44, 0x7d,
-  0xe7, 0x18, 0x90, 0x13, 0xca, 0x8b, 0xe7, 0x11, 0xc2, 0x40, 0xfe, 0x51,
-  0xfd, 0x9a, 0x1f, 0x7c, 0xb6, 0x12, 0xa1, 0xd6, 0x73, 0x98, 0x8b, 0xa7,
-  0xbc, 0x02, 0xb0, 0x3e, 0x5e, 0x08, 0x4f, 0x7c, 0x0b, 0x00, 0x6f, 0xb4,
-  0xe2, 0xd3, 0xd0, 0xe2, 0x5e, 0x15, 0x95, 0x36, 0x83, 0x95, 0x42, 0x62,
-  0x6c, 0xaa, 0xf6, 0xd4, 0x1e, 0xa8, 0xac, 0x93, 0xf0, 0xa3, 0xde, 0xb8,
-  0x8d, 0x16, 0xe0, 0x56, 0xc6, 0x06, 0xe5, 0x0b, 0x06, 0x12, 0x21, 0xee,
-  0x9a, 0xb4, 0x41, 0x78, 0x37, 0xab, 0xe0, 0xec, 0xc6, 0x2c, 0x86, 0xe4,
-  0x69, 0xe6, 0x66, 0xe4, 0x96, 0xe6, 0x1e, 0xd6, 0x1a, 0x32, 0xb6, 0x1e,
-  0xde, 0x59, 0x94, 0x16, 0x3b, 0x03, 0xa3, 0x2c, 0x8a, 0x40, 0x60, 0x6c,
-  0xb1, 0x16, 0x64, 0x2a, 0x2d, 0x0e, 0x9a, 0xe6, 0xe4, 0x43, 0x56, 0x0e,
-  0x02, 0x05, 0xa7, 0xe1, 0x8b, 0x7e, 0x12, 0x2b, 0xd8, 0x7a, 0x38, 0xba,
-  0x1f, 0x8f, 0x23, 0x51, 0x4f, 0x1c, 0x5d, 0x51, 0xea, 0x18, 0x89, 0x5f,
-  0x38, 0xf2, 0x80, 0x92, 0x1c, 0xe1, 0xb8, 0x81, 0x26, 0x1f, 0x48, 0x41,
-  0xb2, 0x76, 0xf2, 0xb8, 0x7f, 0x56, 0xec, 0x12, 0x97, 0x68, 0x3e, 0x03,
-  0x53, 0xe0, 0x2a, 0x0c, 0xdd, 0x76, 0xc4, 0x1e, 0x96, 0xa0, 0xac, 0x1b,
-  0x19, 0xf2, 0xf5, 0xa8, 0x01, 0x28, 0x1c, 0xd9, 0x35, 0xf8, 0x05, 0x2d,
-  0xe8, 0x1f, 0xed, 0x8b, 0x48, 0x64, 0xc3, 0xaa, 0x04, 0x63, 0xdf, 0x22,
-  0xc6, 0x30, 0x08, 0x1b, 0xfb, 0x20, 0x83, 0xc1, 0x06, 0xd0, 0xbc, 0x80,
-  0x83, 0x16, 0xd2, 0x6b, 0xc7, 0x2c, 0x0d, 0x9b, 0xe1, 0x2c, 0x0c, 0x48,
-  0x58, 0x68, 0x99, 0x45, 0x44, 0x7b, 0x5c, 0x95, 0x46, 0x0b, 0xc8, 0xfe,
-  0x70, 0xf4, 0xe0, 0xe2, 0x28, 0x4c, 0xb8, 0x11, 0xd1, 0x42, 0xc1, 0x5b,
-  0x26, 0x08, 0x75, 0x07, 0xb9, 0x97, 0x24, 0x8b, 0x20, 0xd4, 0x04, 0x00,
-  0x8d, 0x6c, 0x9f, 0xf2, 0x75, 0x0a, 0xcf, 0xd4, 0xd6, 0xb2, 0x0c, 0x4c,
-  0x10, 0xb5, 0xa2, 0x0c, 0x04, 0xd1, 0x94, 0xff, 0xcc, 0xb8, 0x40, 0x84,
-  0x6b, 0x71, 0x15, 0x6a, 0x75, 0x0c, 0xb7, 0xc1, 0xba, 0x72, 0xb7, 0xfc,
-  0x66, 0xb1, 0x47, 0xd9, 0x1f, 0x8a, 0x08, 0xf7, 0x96, 0x5c, 0xcf, 0xc8,
-  0xca, 0x24, 0x62, 0x16, 0x5b, 0x08, 0xc8, 0x55, 0x78, 0x89, 0x7f, 0x0a,
-  0x86, 0x3f, 0x12, 0x39, 0x6e, 0x1b, 0xea, 0xe9, 0xc4, 0x01, 0x23, 0xa2,
-  0x0d, 0x74, 0xd6, 0x14, 0x66, 0xb3, 0xd9, 0xb5, 0xab, 0x06, 0xdc, 0xf9,
-  0x58, 0xde, 0x43, 0x42, 0x0e, 0xd6, 0xa2, 0xfe, 0x83, 0xe2, 0x43, 0x47,
-  0x36, 0xc2, 0xff, 0x40, 0xb1, 0xa9, 0xce, 0x7f, 0x99, 0xb4, 0x73, 0x02,
-  0x30, 0x2b, 0xb5, 0x40, 0x9b, 0x43, 0x14, 0xd9, 0x94, 0x68, 0x80, 0x44,
-  0x2e, 0x16, 0xc6, 0x6c, 0xaf, 0x8d, 0x94, 0xc1, 0x7e, 0xff, 0xe9, 0x02,
-  0x01, 0xc3, 0x6f, 0x98, 0x09, 0x6d, 0x06, 0xfd, 0xbe, 0xc2, 0xfd, 0x3e,
-  0x75, 0x48, 0x3e, 0x50, 0x48, 0x26, 0x9d, 0x43, 0x37, 0xc6, 0x16, 0xec,
-  0x70, 0x03, 0x10, 0x81, 0x3d, 0xec, 0xe7, 0x00, 0x37, 0x3c, 0xd1, 0xfb,
-  0x88, 0xc0, 0x0f, 0xb0, 0x9c, 0x07, 0xe0, 0x3c, 0x60, 0xe2, 0xf6, 0xfd,
-  0xfa, 0x56, 0xf0, 0x14, 0x85, 0xb9, 0x38, 0xfd, 0xfa, 0x79, 0x04, 0xfd,
-  0x00, 0xe4, 0xfd, 0x2b, 0x92, 0xfd, 0x99, 0xfd, 0x20, 0x58, 0x1b, 0x63,
-  0xb4, 0x50, 0xd7, 0xd8, 0xc2, 0x7a, 0x45, 0xf6, 0x18, 0xa4, 0x08, 0x20,
-  0x40, 0x39, 0x52, 0xb0, 0xc9, 0xf7, 0x53, 0xf4, 0x20, 0x39, 0x20, 0x01,
-  0x08, 0xd2, 0x96, 0xc9, 0xf4, 0x5c, 0xf4, 0x8d, 0xa9, 0xaa, 0x73, 0xb8,
-  0xc0, 0x41, 0x72, 0x94, 0x40, 0xd3, 0x18, 0x14, 0x4e, 0x8c, 0x26, 0x4b,
-  0x04, 0x5a, 0x5c, 0x92, 0xc5, 0xe8, 0xf7, 0xc0, 0xd9, 0xd2, 0x80, 0xcb,
-  0xf6, 0xa2, 0x34, 0xf6, 0x87, 0xfc, 0x24, 0x33, 0x82, 0xec, 0x75, 0x7d,
-  0x21, 0x94, 0xb2, 0x7d, 0xfc, 0x4e, 0x75, 0x66, 0xc2, 0x16, 0xd2, 0x6c,
-  0x12, 0xcb, 0x18, 0x09, 0xb2, 0x4e, 0x4a, 0xf9, 0x50, 0xec, 0x5e, 0x24,
-  0xb6, 0x8c, 0x84, 0x58, 0xc1, 0x04, 0x91, 0x2e, 0xa3, 0x18, 0xf6, 0x10,
-  0xfe, 0x27, 0xba, 0x2a, 0x3a, 0xd1, 0xba, 0x12, 0x84, 0xca, 0x53, 0xa1,
-  0xc7, 0x2c, 0x20, 0x6f, 0x13, 0xb8, 0x84, 0x42, 0x65, 0x99, 0x26, 0x0a,
-  0x39, 0xde, 0x08, 0x5b, 0x63, 0x4c, 0x47, 0xe1, 0x61, 0xe9, 0xbf, 0x59,
-  0x22, 0x64, 0x96, 0x29, 0xc3, 0x75, 0x79, 0x56, 0xc8, 0x74, 0x17, 0x5d,
-  0x38, 0x6e, 0x1d, 0xf7, 0x98, 0x48, 0x23, 0x53, 0x77, 0x7d, 0x3f, 0x0e,
-  0xa2, 0x81, 0x94, 0x41, 0x00, 0xad, 0x03, 0x2a, 0x04, 0x13, 0x20, 0x04,
-  0x33, 0xb0, 0xed, 0x30, 0x10, 0x61, 0x0f, 0x61, 0x3a, 0x0e, 0x46, 0xff,
-  0x40, 0x3b, 0xc6, 0x7f, 0xca, 0x58, 0x5b, 0xc8, 0xf7, 0x38, 0xeb, 0x0e,
-  0x40, 0x4d, 0xe8, 0x5f, 0x08, 0xc9, 0xed, 0x05, 0xca, 0x78, 0x21, 0x63,
-  0x80, 0x93, 0xdc, 0x17, 0x91, 0x01, 0xc3, 0x46, 0x3b, 0x5b, 0x70, 0x72,
-  0xe5, 0x5e, 0x18, 0x9c, 0x38, 0x8b, 0xd0, 0xa0, 0x16, 0xc7, 0xc2, 0x10,
-  0x34, 0xe4, 0xe4, 0x38, 0xca, 0x30, 0x30, 0xd0, 0x54, 0xdb, 0xe0, 0x0c,
-  0x42, 0x04, 0x77, 0x3b, 0x06, 0x36, 0x45, 0xd6, 0x0a, 0x77, 0x2c, 0x2c,
-  0xba, 0x3e, 0x85, 0x3f, 0x9a, 0xfa, 0xfc, 0x2c, 0x36, 0x2e, 0x01, 0x2c,
-  0xb1, 0x39, 0x28, 0x0a, 0x60, 0xff, 0xfc, 0x2a, 0xeb, 0x71, 0x08, 0x7f,
-  0x0c, 0x06, 0x26, 0x2f, 0x1e, 0x4b, 0x57, 0xc9, 0x16, 0x9c, 0x8b, 0x10,
-  0x59, 0x14, 0x72, 0x3d, 0x36, 0x36, 0x37, 0x42, 0x04, 0xd6, 0x6f, 0x21,
-  0x14, 0x0a, 0x55, 0xc0, 0x3b, 0x91, 0x66, 0xa9, 0x04, 0xb9, 0x9d, 0x7c,
-  0x87, 0x40, 0xe2, 0x6f, 0xc2, 0xf6, 0xc0, 0x78, 0xf1, 0xac, 0x72, 0x06,
-  0x97, 0xc9, 0xc7, 0x92, 0x2c, 0x94, 0x47, 0x0a, 0x8e, 0x4a, 0x90, 0x06,
-  0xd5, 0xed, 0x7e, 0xde, 0x90, 0xfc, 0x65, 0xfb, 0x96, 0xfa, 0x51, 0x36,
-  0x2d, 0xfa, 0x42, 0xdd, 0xde, 0x08, 0xd9, 0x72, 0x37, 0x16, 0x33, 0x8b,
-  0xa1, 0x16, 0x94, 0xb6, 0x0f, 0x23, 0x13, 0x42, 0xe5, 0x2a, 0x11, 0x8b,
-  0x5c, 0x09, 0x6c, 0x37, 0x6d, 0xc6, 0xbd, 0xb6, 0xbe, 0xfa, 0xe6, 0x25,
-  0xbe, 0xf6, 0xfb, 0x7c, 0xa7, 0xbc, 0x5c, 0x10, 0x45, 0x49, 0x6a, 0x6a,
-  0x32, 0xd8, 0xed, 0xbf, 0xd1, 0x4b, 0x91, 0x3e, 0x00, 0x58, 0x0b, 0x1a,
-  0x71, 0x47, 0x95, 0xf7, 0xc5, 0x30, 0x49, 0x37, 0xc0, 0x0d, 0x12, 0xba,
-  0x12, 0x9c, 0x0c, 0x19, 0x04, 0xc8, 0xba, 0x4f, 0x92, 0x02, 0xe9, 0x8a,
-  0xb6, 0x24, 0x08, 0x18, 0x7b, 0x16, 0xe6, 0xcc, 0x79, 0xce, 0x46, 0xb3,
-  0x08, 0xe1, 0x99, 0x45, 0x3c, 0x94, 0x0a, 0x64, 0xc3, 0xd6, 0xf8, 0x07,
-  0x0c, 0xfa, 0x64, 0xd6, 0xbd, 0x22, 0x50, 0x25, 0x28, 0x88, 0xbb, 0x95,
-  0xb4, 0x01, 0xce, 0xb1, 0x0f, 0xbb, 0x9f, 0x46, 0x01, 0x65, 0x90, 0x1f,
-  0xcb, 0x01, 0xe9, 0xc5, 0x6c, 0xff, 0x08, 0xac, 0x76, 0x9a, 0x7b, 0x16,
-  0x13, 0xee, 0x45, 0x18, 0xbb, 0x38, 0xf2, 0x75, 0xdf, 0x35, 0x56, 0xf0,
-  0x75, 0x12, 0x61, 0x7b, 0x30, 0x39, 0x6e, 0x0b, 0x74, 0x65, 0x08, 0x91,
-  0x59, 0x83, 0x2b, 0x00, 0x6d, 0x1b, 0x45, 0x45, 0x23, 0x63, 0x01, 0xb7,
-  0x16, 0xcc, 0x11, 0x06, 0x6d, 0xcb, 0x57, 0x98, 0x77, 0x8a, 0x30, 0xdd,
-  0x5a, 0x23, 0xdb, 0x69, 0x40, 0xa5, 0x0b, 0xd9, 0x75, 0x25, 0xa2, 0x47,
-  0xdd, 0x2d, 0xc9, 0x1b, 0xbf, 0x08, 0x60, 0xa4, 0xd8, 0x29, 0xa1, 0x02,
-  0x84, 0x2f, 0xd8, 0x97, 0x4c, 0x8b, 0xac, 0x28, 0x09, 0x51, 0xc0, 0x78,
-  0x70, 0x5d, 0x80, 0x53, 0x6c, 0x9e, 0x50, 0x47, 0x42, 0x2c, 0x2d, 0xa5,
-  0x84, 0x4a, 0x88, 0x23, 0xe9, 0xdc, 0xc3, 0x04, 0xb0, 0x3d, 0x3d, 0xfc,
-  0x14, 0x27, 0xdb, 0x3e, 0x8a, 0x74, 0x39, 0x75, 0x16, 0x95, 0x1e, 0x86,
-  0x00, 0xcf, 0xb2, 0x74, 0x7e, 0x09, 0x1f, 0x44, 0xc8, 0x40, 0x12, 0xf4,
-  0xc3, 0x83, 0x4f, 0x3e, 0x24, 0x21, 0x3a, 0x01, 0x8d, 0x02, 0x60, 0x8b,
-  0x8e, 0x59, 0x39, 0x08, 0x25, 0x60, 0xb9, 0xb0, 0x55, 0x2c, 0x48, 0xaf,
-  0x48, 0x0f, 0x16, 0x41, 0xea, 0xb0, 0x20, 0x49, 0x2d, 0x57, 0x1b, 0x6e,
-  0x31, 0x56, 0x30, 0x46, 0x14, 0xcf, 0xcd, 0xc0, 0x56, 0x3e, 0x1e, 0x14,
-  0x02, 0x40, 0xec, 0x20, 0x30, 0xb4, 0x5c, 0xca, 0xa0, 0x26, 0xfa, 0xc1,
-  0xe1, 0xfb, 0x28, 0x58, 0xa8, 0x78, 0x8c, 0xc0, 0x0a, 0xb0, 0xd0, 0x17,
-  0x2c, 0x5d, 0x23, 0x1d, 0x8e, 0xa1, 0xff, 0x29, 0x01, 0xc8, 0x26, 0x02,
-  0x58, 0x0a, 0x61, 0x87, 0x6c, 0xca, 0x9d, 0xaa, 0x8a, 0xc7, 0x5e, 0xd0,
-  0xa1, 0x46, 0xc8, 0xe8, 0x8b, 0x16, 0xdf, 0xd1, 0x03, 0x16, 0xd8, 0x0c,
-  0xee, 0x13, 0x06, 0xda, 0x07, 0x9a, 0xdc, 0xde, 0x69, 0xe0, 0x90, 0xa0,
-  0x26, 0x5a, 0x5b, 0xd2, 0x03, 0x9e, 0xb6, 0x16, 0xd0, 0x05, 0xa2, 0xf0,
-  0x1f, 0x93, 0x28, 0x44, 0x24, 0x3b, 0xa1, 0xca, 0x47, 0xae, 0xc8, 0x37,
-  0x9a, 0xcc, 0xce, 0x48, 0xe4, 0x2e, 0x99, 0x6f, 0x21, 0xa3, 0xc7, 0xf1,
-  0x9a, 0x08, 0xd9, 0x05, 0xca, 0x19, 0xcc, 0x19, 0xce, 0x19, 0xd0, 0x19,
-  0xd2, 0x19, 0xd4, 0x19, 0xd6, 0x19, 0xd8, 0x19, 0xda, 0x19, 0xdc, 0x19,
-  0xde, 0x19, 0xe0, 0x19, 0xe2, 0x83, 0x13, 0x84, 0x76, 0x36, 0x71, 0xcf,
-  0xa0, 0x92, 0x97, 0x0d, 0xc8, 0x11, 0x14, 0xe8, 0x0b, 0x2b, 0xcc, 0x03,
-  0x88, 0x26, 0xc5, 0x51, 0xb2, 0x20, 0xa4, 0x84, 0xbd, 0xd5, 0x40, 0x9d,
-  0x33, 0x0c, 0x14, 0x18, 0xf5, 0x18, 0x76, 0x61, 0x4f, 0x11, 0x72, 0xa9,
-  0x01, 0x71, 0x0c, 0x7b, 0x4f, 0x2d, 0x71, 0xad, 0x0d, 0x55, 0x21, 0xf2,
-  0xa0, 0x04, 0xe7, 0x62, 0x5b, 0x03, 0xc1, 0x85, 0x95, 0x2f, 0xc1, 0xfe,
-  0x82, 0xfb, 0x9b, 0x11, 0x36, 0x01, 0x73, 0x51, 0x39, 0x64, 0xcd, 0xb7,
-  0x0f, 0x01, 0x46, 0x00, 0x6d, 0x0f, 0x23, 0x93, 0xe1, 0x70, 0x77, 0x20,
-  0xb4, 0x0d, 0x59, 0x45, 0x70, 0xfd, 0x08, 0x20, 0x48, 0xd1, 0x9a, 0x55,
-  0x2a, 0x65, 0xb6, 0x95, 0xfc, 0x48, 0xdd, 0x6b, 0xbc, 0x62, 0x17, 0xeb,
-  0xf6, 0xea, 0x6d, 0x2d, 0x90, 0x29, 0x81, 0x37, 0x36, 0x21, 0xc9, 0xf7,
-  0x32, 0x08, 0x53, 0x04, 0x6e, 0x40, 0x05, 0x0e, 0x42, 0xbb, 0x06, 0x1e,
-  0x64, 0x12, 0x81, 0x96, 0x08, 0x1f, 0x48, 0x19, 0x0a, 0x64, 0x2c, 0xb6,
-  0xf4, 0xc9, 0x0c, 0x36, 0xfe, 0x2a, 0xb8, 0x2d, 0x5b, 0x86, 0xfd, 0x30,
-  0x82, 0x51, 0x46, 0x05, 0xe2, 0x5c, 0xf8, 0x33, 0x73, 0x0a, 0x98, 0x7e,
-  0x22, 0x89, 0x0d, 0xa9, 0x6f, 0x2f, 0x6e, 0x19, 0x8e, 0xed, 0xd8, 0x80,
-  0x3e, 0xee, 0x4b, 0x13, 0x33, 0xd7, 0xc6, 0x06, 0x94, 0x2d, 0x14, 0xf4,
-  0x43, 0xcd, 0x2f, 0x3c, 0x41, 0x2d, 0xb8, 0x31, 0x2d, 0x36, 0x20, 0xb3,
-  0x0d, 0x10, 0x50, 0x89, 0x15, 0x9f, 0x49, 0x30, 0xe4, 0x67, 0xda, 0xff,
-  0x1d, 0x0a, 0xda, 0x00, 0x3d, 0xd1, 0x38, 0x2b, 0xf6, 0x2d, 0xed, 0x01,
-  0x12, 0xb6, 0xa0, 0x05, 0x1f, 0x95, 0xef, 0x90, 0x4c, 0x85, 0x3c, 0xb7,
-  0x07, 0x3e, 0x31, 0xd2, 0x0a, 0x76, 0xeb, 0x4e, 0x08, 0x34, 0x07, 0xbb,
-  0x00, 0xec, 0x04, 0xf7, 0xe3, 0x2a, 0xf6, 0x89, 0xe5, 0x2c, 0x16, 0xfa,
-  0x6b, 0x2a, 0x2a, 0xe5, 0x5c, 0x73, 0x40, 0x26, 0xfa, 0xf3, 0x81, 0xfa,
-  0x08, 0x1b, 0x20, 0x40, 0x89, 0xb6, 0xc2, 0x3e, 0x09, 0xc3, 0x73, 0x1a,
-  0xdc, 0xc5, 0x93, 0x2e, 0x3e, 0x89, 0xd0, 0xc2, 0x45, 0xba, 0x0d, 0x8a,
-  0xb9, 0xbc, 0xb2, 0x34, 0x0a, 0x6c, 0x99, 0xfa, 0x50, 0xa3, 0x09, 0x6b,
-  0x20, 0x0b, 0x0e, 0xad, 0xbe, 0x08, 0xd8, 0xb4, 0x0b, 0x1a, 0x3b, 0x5a,
-  0x3d, 0x62, 0xad, 0x02, 0x4b, 0xb0, 0xc3, 0x8d, 0x85, 0xb3, 0x31, 0x0d,
-  0x3b, 0x93, 0xa3, 0x13, 0x77, 0x05, 0x08, 0xa3, 0x15, 0x37, 0x0a, 0xa3,
-  0x17, 0x37, 0x0c, 0xa3, 0x0f, 0x37, 0x0e, 0xa3, 0x11, 0x37, 0x10, 0xe8,
-  0xa0, 0xb2, 0xff, 0xd3, 0x0d, 0xb2, 0x45, 0x13, 0x0c, 0x15, 0x8c, 0x17,
-  0x8c, 0x0d, 0x94, 0xc9, 0x5a, 0xaf, 0xcd, 0xf8, 0x83, 0x3e, 0x3a, 0x0e,
-  0x01, 0xaf, 0xc2, 0x9b, 0x30, 0x87, 0x0e, 0x74, 0x04, 0x64, 0xf8, 0x3c,
-  0x0e, 0x84, 0xed, 0x06, 0x0b, 0xae, 0x3c, 0x7c, 0x24, 0x31, 0x93, 0x91,
-  0x24, 0x28, 0xee, 0x6f, 0x2f, 0x8b, 0x1e, 0xd1, 0x4c, 0x48, 0x11, 0x3a,
-  0xe8, 0x26, 0x3d, 0xfa, 0xb2, 0x31, 0x38, 0x4c, 0x97, 0x90, 0xa3, 0x89,
-  0x9b, 0x2e, 0x7c, 0xb2, 0xcb, 0x34, 0xdd, 0xb8, 0x89, 0x73, 0x37, 0x10,
-  0x03, 0x45, 0x57, 0x18, 0xf6, 0x97, 0xea, 0x26, 0x17, 0xc8, 0xec, 0x4d,
-  0x0c, 0xb1, 0x10, 0xee, 0xb6, 0x8e, 0x06, 0x10, 0x8a, 0xc1, 0xe6, 0x63,
-  0xc7, 0x7f, 0x7c, 0xa2, 0x47, 0x93, 0x9d, 0x24, 0x7f, 0xff, 0xeb, 0x4b,
-  0x8b, 0xdf, 0x61, 0xa0, 0x7f, 0x39, 0x8b, 0xf7, 0xeb, 0x27, 0x54, 0xd1,
-  0x39, 0x1e, 0x51, 0x60, 0xf7, 0xf6, 0x05, 0xf0, 0x26, 0x0c, 0x03, 0xe8,
-  0x2a, 0x92, 0x80, 0x7c, 0xa1, 0x3a, 0x0e, 0x48, 0xdd, 0xd1, 0xff, 0x0e,
-  0xaa, 0x08, 0x5d, 0x34, 0x47, 0x3b, 0xde, 0x72, 0x7c, 0xaf, 0xb8, 0x57,
-  0xc2, 0xe0, 0x91, 0x59, 0xda, 0x7d, 0x16, 0x8b, 0xde, 0x85, 0x77, 0xdb,
-  0x04, 0x61, 0xeb, 0x84, 0x25, 0x01, 0xfb, 0xe4, 0xb8, 0x66, 0x42, 0x0a,
-  0x54, 0xcc, 0x6f, 0xe1, 0x35, 0xc0, 0xf0, 0xdc, 0x52, 0xaf, 0xff, 0xcf,
-  0x35, 0xd9, 0x7d, 0x14, 0x51, 0x61, 0x1e, 0x66, 0x0b, 0x08, 0x9f, 0xd9,
-  0x70, 0x49, 0x32, 0xc1, 0x42, 0x83, 0xad, 0x68, 0x55, 0xb2, 0x2f, 0x94,
-  0x09, 0x71, 0x21, 0x4e, 0x59, 0x0b, 0x36, 0x9f, 0x50, 0xa0, 0x04, 0xa2,
-  0x84, 0x00, 0x59, 0xdf, 0xbf, 0x5a, 0xb8, 0x77, 0x45, 0x08, 0xa3, 0x0f,
-  0xeb, 0x1d, 0xb8, 0xb0, 0x7a, 0xbd, 0xa4, 0x45, 0x72, 0x85, 0x09, 0x3b,
-  0x25, 0x42, 0xc9, 0xd5, 0xe8, 0x47, 0x89, 0xc7, 0xee, 0x83, 0x20, 0x14,
-  0x24, 0x3a, 0xc5, 0x2b, 0x80, 0xaa, 0x0e, 0xa3, 0x6d, 0x2e, 0xe8, 0xd6,
-  0x04, 0x60, 0xcd, 0x25, 0x1c, 0x55, 0x1f, 0x6e, 0x0e, 0xe4, 0x83, 0x7e,
-  0xf4, 0xae, 0x26, 0x20, 0x3f, 0xab, 0xea, 0x8c, 0xd8, 0x56, 0xec, 0x55,
-  0xd6, 0xda, 0x9d, 0xc1, 0xea, 0x60, 0x0f, 0x6e, 0x5f, 0x05, 0xc2, 0x31,
-  0x88, 0xc4, 0xc0, 0x04, 0x18, 0x27, 0x20, 0x5a, 0xf2, 0xde, 0x9e, 0xe6,
-  0xea, 0xd9, 0x73, 0xdc, 0x64, 0xec, 0x06, 0xda, 0x4a, 0x64, 0xe6, 0x80,
-  0xb9, 0x26, 0x28, 0xe1, 0x04, 0xf3, 0x80, 0x44, 0x94, 0x5d, 0x8a, 0x2b,
-  0x1c, 0x64, 0x03, 0x98, 0xfe, 0x6a, 0x91, 0x5c, 0x04, 0x09, 0xb5, 0x40,
-  0x25, 0x36, 0xaa, 0xac, 0xc6, 0xa6, 0x64, 0x08, 0x6c, 0x45, 0xfe, 0x0e,
-  0xb9, 0x2f, 0x0f, 0x72, 0x07, 0x0f, 0x42, 0x02, 0x0c, 0x94, 0x58, 0x36,
-  0xa0, 0xb3, 0x52, 0x1b, 0x73, 0x73, 0xb2, 0xff, 0x10, 0xd5, 0x40, 0xb1,
-  0x66, 0xf7, 0x05, 0xad, 0x9d, 0x14, 0x90, 0x5e, 0x40, 0x01, 0x87, 0x3d,
-  0xff, 0x60, 0x36, 0xa1, 0xe6, 0xdb, 0x1e, 0x3f, 0x24, 0x32, 0x77, 0x48,
-  0x15, 0xe5, 0xd2, 0x3d, 0x20, 0x43, 0x58, 0x21, 0x76, 0x01, 0x1e, 0x43,
-  0x39, 0x3a, 0x12, 0xe1, 0x59, 0xce, 0x9e, 0x22, 0x7c, 0x63, 0x0f, 0xd3,
-  0x5e, 0xc9, 0x36, 0x6a, 0xb1, 0xea, 0x55, 0x09, 0x28, 0xdd, 0x50, 0x0a,
-  0x25, 0x55, 0x53, 0xe1, 0x08, 0x92, 0x81, 0x38, 0x5a, 0x82, 0x3a, 0xb3,
-  0x56, 0x12, 0x62, 0xbe, 0x74, 0x12, 0x56, 0x22, 0xb2, 0x01, 0x30, 0x9c,
-  0x53, 0x5e, 0x21, 0x54, 0x70, 0x0d, 0x95, 0x37, 0xb6, 0xa3, 0x06, 0x40,
-  0xe4, 0x38, 0x99, 0x6e, 0x29, 0x96, 0x0c, 0x0a, 0x41, 0x4a, 0xd5, 0xe7,
-  0x0b, 0xa4, 0x02, 0x15, 0xef, 0x44, 0x08, 0xac, 0x4a, 0x22, 0xb1, 0x70,
-  0xc5, 0xb2, 0x01, 0xbf, 0x96, 0xfa, 0xd2, 0xe2, 0x0a, 0xc2, 0x50, 0x16,
-  0xf4, 0xb3, 0x82, 0x65, 0x68, 0x32, 0x47, 0x04, 0x1f, 0xf6, 0xd2, 0x22,
-  0x65, 0x6a, 0xaf, 0x7d, 0x60, 0x68, 0x32, 0x67, 0x01, 0x6d, 0x4f, 0x55,
-  0x18, 0x99, 0x72, 0x0a, 0x0a, 0xd1, 0x47, 0x52, 0x6e, 0x6c, 0x22, 0xa6,
-  0x0e, 0x49, 0x82, 0xf0, 0xa5, 0x96, 0x01, 0x02, 0xcb, 0x17, 0xa8, 0x54,
-  0x03, 0xfc, 0xb0, 0x11, 0x3c, 0xff, 0xfe, 0x56, 0x6a, 0x35, 0x12, 0x9b,
-  0xc9, 0x28, 0x0e, 0x7f, 0x76, 0x11, 0x13, 0xd6, 0x7a, 0x28, 0xc9, 0x85,
-  0x8a, 0x08, 0x32, 0x0e, 0x45, 0x59, 0x31, 0xf9, 0x0c, 0x00, 0x0e, 0x0c,
-  0x0b, 0x49, 0x43, 0xc2, 0x62, 0x35, 0x13, 0x50, 0x9c, 0x52, 0x78, 0x43,
-  0xa1, 0xc5, 0x0a, 0x7c, 0x0a, 0x89, 0x5e, 0x0c, 0x11, 0x20, 0xb8, 0x3d,
-  0x9a, 0x18, 0x17, 0xa2, 0x5b, 0x0c, 0x97, 0x6c, 0x0f, 0x11, 0x1b, 0xd3,
-  0x6d, 0x1d, 0xeb, 0x9e, 0x51, 0x58, 0x6f, 0x63, 0xe5, 0x2d, 0x82, 0x1b,
-  0xc3, 0xa8, 0x08, 0x6f, 0x0c, 0x41, 0xf3, 0xa5, 0xcf, 0xa0, 0x78, 0x21,
-  0x08, 0x2b, 0x29, 0x04, 0x27, 0xdc, 0xf8, 0x44, 0x66, 0xa0, 0xa2, 0x16,
-  0x8d, 0xff, 0x4d, 0x44, 0x9e, 0x41, 0x03, 0x04, 0x41, 0xaa, 0x04, 0xe8,
-  0x5f, 0xb0, 0x6e, 0xf0, 0xf8, 0xd2, 0xe0, 0xa8, 0x17, 0x0e, 0x0a, 0xd0,
-  0xb5, 0x88, 0x04, 0x85, 0x36, 0x38, 0xdd, 0x01, 0x02, 0x49, 0x29, 0x80,
-  0xc7, 0x33, 0xe9, 0x65, 0xaa, 0x32, 0x57, 0x14, 0x1c, 0x3a, 0x83, 0xf6,
-  0xba, 0xd0, 0xac, 0x22, 0x40, 0xa6, 0xc5, 0x42, 0x39, 0x6d, 0x0a, 0x0e,
-  0x15, 0x89, 0xb3, 0x9c, 0xae, 0x31, 0xd3, 0x15, 0x18, 0x40, 0xb0, 0x87,
-  0x39, 0x04, 0x01, 0x92, 0x80, 0x64, 0xb0, 0x85, 0x15, 0x65, 0x79, 0x88,
-  0x29, 0x43, 0x2d, 0x15, 0x61, 0x76, 0xd5, 0x92, 0x49, 0x83, 0xa4, 0x19,
-  0x26, 0x17, 0xcd, 0x20, 0xd5, 0xf8, 0xdd, 0x14, 0xf6, 0x94, 0x32, 0x1e,
-  0x17, 0xa0, 0x8a, 0xfd, 0x10, 0x29, 0x69, 0xbe, 0x51, 0x0b, 0x91, 0x32,
-  0x7c, 0x37, 0xa5, 0xb2, 0xfc, 0xd8, 0x33, 0x77, 0x5d, 0x68, 0x93, 0x37,
-  0x86, 0x61, 0x18, 0x72, 0xfa, 0x0c, 0x03, 0x42, 0x95, 0xb0, 0xe1, 0x94,
-  0x90, 0x60, 0xa2, 0x30, 0x69, 0xb8, 0x3b, 0x50, 0x13, 0x00, 0x98, 0xaa,
-  0x92, 0x3f, 0x64, 0x0e, 0x42, 0x2a, 0xe1, 0x33, 0xc9, 0x7f, 0x30, 0x10,
-  0x9b, 0x41, 0x28, 0x95, 0x82, 0xf7, 0x90, 0x50, 0xd8, 0x63, 0x22, 0xa4,
-  0xd7, 0xb4, 0x96, 0x3b, 0xf1, 0x15, 0x52, 0x47, 0x36, 0x04, 0xdf, 0x60,
-  0x21, 0xf8, 0x6c, 0x04, 0x51, 0xa5, 0x92, 0x38, 0x30, 0x28, 0x59, 0x39,
-  0x00, 0x84, 0xee, 0x11, 0x86, 0x57, 0x18, 0x88, 0x45, 0x26, 0xd3, 0xb2,
-  0x61, 0x44, 0x46, 0x70, 0x3a, 0x66, 0x10, 0x02, 0xe8, 0x61, 0x50, 0x21,
-  0x53, 0x0d, 0x01, 0x60, 0x98, 0x89, 0xec, 0x18, 0x0d, 0x46, 0x6a, 0x04,
-  0x20, 0x92, 0xa9, 0x16, 0x4d, 0x57, 0x01, 0x20, 0x06, 0xc2, 0x43, 0x6d,
-  0x5c, 0xab, 0x88, 0x12, 0xc0, 0x6c, 0xc2, 0xb6, 0x6a, 0x83, 0x9c, 0x23,
-  0x40, 0x02, 0xd0, 0x28, 0xac, 0xc2, 0xba, 0x14, 0x29, 0x5a, 0x2b, 0x63,
-  0x5e, 0x65, 0x45, 0x58, 0xb1, 0x38, 0xba, 0x0f, 0xbe, 0xc2, 0xa4, 0x00,
-  0x23, 0x0a, 0x06, 0x0c, 0x18, 0x35, 0x42, 0x6a, 0x0b, 0x18, 0x05, 0x5b,
-  0xf9, 0x37, 0xa0, 0x17, 0x78, 0x27, 0xf4, 0xaf, 0xb9, 0x15, 0x16, 0x37,
-  0x34, 0x22, 0x10, 0x92, 0x8a, 0xf4, 0x47, 0x10, 0x91, 0xaa, 0x8d, 0x5a,
-  0xb2, 0x99, 0xc0, 0xf8, 0x81, 0xec, 0x1e, 0x94, 0xea, 0x15, 0x48, 0xed,
-  0x4c, 0xf0, 0x44, 0x59, 0xca, 0x08, 0x00, 0xb0, 0xd1, 0xb4, 0xea, 0xa6,
-  0x03, 0xfb, 0x24, 0x00, 0x58, 0xbd, 0x06, 0xa8, 0xbc, 0x8f, 0x04, 0x0e,
-  0x52, 0x0e, 0x3b, 0xaa, 0x16, 0x56, 0xbb, 0x95, 0xc4, 0x10, 0x56, 0x34,
-  0x38, 0x74, 0x08, 0x8b, 0xe2, 0x31, 0x14, 0xfb, 0xa9, 0x3b, 0x01, 0x1b,
-  0x81, 0x36, 0xff, 0x2f, 0x01, 0xe4, 0x16, 0x16, 0x92, 0xa2, 0x2c, 0x87,
-  0x9a, 0xe6, 0x0a, 0xb3, 0xba, 0xfe, 0xe9, 0xfb, 0x00, 0x01, 0x76, 0xea,
-  0x83, 0x8d, 0x0e, 0x74, 0x13, 0xe2, 0xf3, 0xe4, 0x43, 0xcb, 0xa6, 0x7a,
-  0x86, 0xe2, 0xfd, 0x50, 0x82, 0x41, 0x2c, 0xda, 0xe2, 0x13, 0x16, 0x80,
-  0x10, 0x56, 0x85, 0xb7, 0xee, 0x95, 0x2c, 0xcd, 0xfb, 0xec, 0x2c, 0xea,
-  0x91, 0x68, 0x09, 0x14, 0x85, 0x18, 0x04, 0xa8, 0x24, 0x7b, 0x6d, 0x3b,
-  0xe2, 0xf1, 0x75, 0x2e, 0x3b, 0x56, 0x5a, 0x5c, 0xa9, 0x82, 0x59, 0x46,
-  0xb3, 0x79, 0x11, 0x25, 0xc0, 0xb6, 0x60, 0x28, 0x12, 0x0e, 0xf4, 0xeb,
-  0x29, 0x3b, 0x5a, 0x29, 0x08, 0x47, 0x80, 0xee, 0x49, 0x81, 0x2b, 0xb6,
-  0x02, 0xcf, 0xf8, 0x80, 0xd9, 0xe0, 0xe2, 0x5a, 0xce, 0x88, 0xed, 0xcb,
-  0xe4, 0x76, 0xb4, 0x79, 0x2b, 0x07, 0xdc, 0x75, 0x76, 0xe2, 0x76, 0x13,
-  0x8e, 0x36, 0x1b, 0xe6, 0x68, 0xe8, 0x82, 0x11, 0x7b, 0xd4, 0x48, 0x99,
-  0x1c, 0x98, 0xa2, 0x67, 0x7a, 0x20, 0x66, 0x46, 0xe6, 0xa2, 0xec, 0x10,
-  0x7e, 0x11, 0xc0, 0x0d, 0xac, 0x49, 0xfc, 0x71, 0x02, 0x97, 0x10, 0x82,
-  0xf6, 0xdf, 0x16, 0x16, 0xac, 0x68, 0x9a, 0x03, 0x2c, 0x5d, 0x9a, 0x28,
-  0x20, 0x48, 0xc8, 0x17, 0xae, 0xd8, 0x70, 0x20, 0x88, 0xa4, 0x11, 0xd4,
-  0x18, 0x06, 0x5d, 0x30, 0x40, 0x25, 0xf3, 0x3a, 0x08, 0x00, 0x02, 0xc3,
-  0x3d, 0x84, 0x17, 0x1a, 0x45, 0x2e, 0xb8, 0xda, 0x0f, 0x0b, 0xbb, 0x05,
-  0xf4, 0x7c, 0x1f, 0x11, 0xe2, 0x6b, 0x0b, 0x08, 0x23, 0x6e, 0xa5, 0x43,
-  0x01, 0x7a, 0x0c, 0xcb, 0xd8, 0x50, 0x49, 0x34, 0x43, 0x3c, 0x19, 0xe7,
-  0x6c, 0x23, 0xc6, 0xe7, 0x53, 0xda, 0x14, 0x48, 0x96, 0x0b, 0x66, 0x08,
-  0x62, 0x12, 0x24, 0x9f, 0x04, 0x11, 0x08, 0xe2, 0x5c, 0xef, 0x2a, 0x7b,
-  0x46, 0xb9, 0xb7, 0x1b, 0xa3, 0xe9, 0xfa, 0x59, 0x1a, 0xa4, 0xc3, 0x27,
-  0x1a, 0x01, 0x64, 0xee, 0xc3, 0x06, 0xdf, 0xfb, 0xeb, 0x11, 0xeb, 0xd5,
-  0xf0, 0x3a, 0x5b, 0x61, 0x99, 0x1b, 0xa1, 0xc2, 0x00, 0x08, 0x6a, 0x68,
-  0x2c, 0x02, 0xa5, 0x96, 0xfd, 0x00, 0xb2, 0x84, 0x1b, 0x8a, 0x79, 0xe8,
-  0x50, 0x08, 0x40, 0xfe, 0x40, 0x16, 0x57, 0x46, 0xb1, 0x29, 0xa0, 0x68,
-  0x8c, 0x4c, 0x81, 0x05, 0x0c, 0xe8, 0x82, 0x32, 0x38, 0x19, 0x34, 0x14,
-  0x41, 0x90, 0x7d, 0xd0, 0x1d, 0x46, 0x24, 0x57, 0x11, 0x27, 0x09, 0x06,
-  0x6d, 0x13, 0x10, 0x01, 0x16, 0x80, 0x1a, 0x21, 0x0e, 0x3c, 0x5c, 0x04,
-  0x91, 0xa4, 0xd9, 0x6c, 0x91, 0xf8, 0x10, 0x42, 0xf9, 0x68, 0x2c, 0xf4,
-  0x2e, 0xdd, 0x70, 0x32, 0xef, 0xe0, 0x4d, 0x34, 0x70, 0xf0, 0xb3, 0x97,
-  0x64, 0x36, 0x03, 0xae, 0x0f, 0xcc, 0xff, 0x10, 0x9e, 0xe7, 0xeb, 0xa4,
-  0xcb, 0x2d, 0xc8, 0x7d, 0x04, 0x7e, 0x38, 0x05, 0x49, 0x15, 0x10, 0xf2,
-  0xec, 0xd0, 0x2f, 0x24, 0x0b, 0xf6, 0xf8, 0x20, 0x0c, 0x0c, 0x09, 0xb2,
-  0x1a, 0xa1, 0x69, 0x35, 0x47, 0x1f, 0xa2, 0xac, 0xb5, 0x04, 0x41, 0x09,
-  0xfa, 0x08, 0x0a, 0x58, 0x9a, 0x00, 0x82, 0x10, 0xfb, 0x86, 0xe4, 0xc0,
-  0x19, 0x99, 0xff, 0xb0, 0xca, 0x00, 0x60, 0x12, 0x5b, 0x34, 0xa4, 0xaf,
-  0x1e, 0x83, 0xea, 0x02, 0x8a, 0xc3, 0x02, 0x46, 0xb3, 0x6a, 0x49, 0xb9,
-  0x04, 0x53, 0xe1, 0x00, 0x83, 0x79, 0x09, 0x55, 0xb4, 0x2c, 0x60, 0x85,
-  0x16, 0xc7, 0x06, 0xd2, 0xc6, 0x08, 0x15, 0x1d, 0x5e, 0xe0, 0x34, 0xa3,
-  0x6d, 0xc0, 0x01, 0x26, 0x4b, 0x0c, 0x76, 0x0b, 0x11, 0x24, 0xc8, 0x8b,
-  0x7b, 0x0f, 0x87, 0xfc, 0x21, 0xd1, 0xb8, 0x48, 0xd1, 0x32, 0xf4, 0x08,
-  0x0b, 0x75, 0x30, 0x94, 0x46, 0x20, 0xa0, 0x40, 0x38, 0x42, 0x46, 0x5a,
-  0x1c, 0x96, 0x00, 0x5d, 0xcb, 0x75, 0x8a, 0x34, 0x84, 0x5f, 0x64, 0x2d,
-  0xae, 0x19, 0xf5, 0x24, 0x44, 0x97, 0x95, 0x09, 0x66, 0x0f, 0x8a, 0xbb,
-  0xb4, 0x17, 0x01, 0x66, 0xc0, 0xb3, 0x84, 0x18, 0x6b, 0x5a, 0x20, 0x19,
-  0x45, 0x44, 0x25, 0x95, 0x39, 0xe5, 0x00, 0x08, 0x6c, 0xcb, 0x19, 0x09,
-  0x9a, 0xff, 0xb1, 0x92, 0xa9, 0xc2, 0xa5, 0x47, 0x96, 0x60, 0x34, 0x84,
-  0xa5, 0x28, 0xec, 0x47, 0x51, 0xb0, 0x95, 0xa5, 0xc9, 0x45, 0x0d, 0x1a,
-  0x08, 0xee, 0x5e, 0x60, 0xfa, 0xaa, 0x11, 0x3d, 0x0d, 0x8c, 0xd1, 0x20,
-  0x12, 0x22, 0xe4, 0x81, 0x56, 0x4a, 0x1a, 0xcc, 0xaa, 0x61, 0x24, 0x32,
-  0xfc, 0x30, 0x0c, 0x0b, 0x24, 0x12, 0x27, 0xde, 0xb4, 0x08, 0x11, 0x55,
-  0x7e, 0x67, 0xa9, 0x00, 0x89, 0x3b, 0x01, 0x55, 0x65, 0x0f, 0xde, 0x2a,
-  0x73, 0x0a, 0x9e, 0xea, 0x0f, 0x2a, 0x10, 0x66, 0x3d, 0xeb, 0x19, 0xe0,
-  0x18, 0xa2, 0x43, 0x7a, 0x7a, 0x35, 0x41, 0xda, 0x84, 0xce, 0x29, 0xc6,
-  0x03, 0x18, 0x82, 0x13, 0x47, 0xd9, 0x70, 0xff, 0x60, 0xf6, 0xeb, 0x0c,
-  0x46, 0x38, 0x11, 0xe0, 0xe6, 0x56, 0x42, 0x0e, 0x77, 0x1c, 0x09, 0xad,
-  0xf6, 0x0a, 0x8b, 0xf8, 0xab, 0x12, 0xaa, 0xb0, 0xaa, 0x3a, 0x16, 0x08,
-  0xc3, 0x5e, 0x62, 0xac, 0x90, 0xc3, 0xc5, 0x13, 0x8f, 0x8a, 0x24, 0xeb,
-  0xb5, 0xd2, 0x30, 0xf2, 0x7a, 0xfc, 0x07, 0x10, 0xcf, 0x05, 0xd4, 0xfe,
-  0xac, 0x10, 0x81, 0x11, 0xa0, 0x86, 0x8d, 0x51, 0x49, 0x42, 0x3b, 0xe9,
-  0x81, 0x1c, 0xa4, 0xee, 0x10, 0x44, 0xd3, 0xb5, 0x55, 0x54, 0x50, 0x8d,
-  0xf1, 0x41, 0x01, 0x67, 0x05, 0x15, 0x61, 0xd0, 0xb5, 0x29, 0x02, 0x40,
-  0x88, 0xc5, 0x90, 0x05, 0xd6, 0x8c, 0xee, 0x17, 0x5a, 0x20, 0x41, 0x9e,
-  0x40, 0x08, 0x0e, 0x82, 0xa1, 0x7c, 0x06, 0x09, 0xf1, 0x23, 0x00, 0xe8,
-  0x08, 0x40, 0x31, 0xd8, 0x38, 0x0b, 0x8d, 0x34, 0x26, 0x38, 0x1b, 0x46,
-  0x74, 0xff, 0x48, 0x7e, 0x1c, 0x14, 0x81, 0x82, 0xcd, 0x58, 0x40, 0x60,
-  0xde, 0x6e, 0x45, 0x9a, 0x06, 0x04, 0xab, 0xda, 0x10, 0x08, 0x08, 0x80,
-  0x91, 0x7e, 0x09, 0x8d, 0x82, 0x2c, 0x74, 0x72, 0x8d, 0x00, 0xa3, 0x9d,
-  0xa4, 0x85, 0x21, 0x02, 0xb7, 0x58, 0xce, 0xb7, 0x61, 0x0a, 0x8c, 0x8a,
-  0xb0, 0x11, 0x96, 0xf3, 0x3a, 0xa7, 0xe1, 0xda, 0x80, 0xec, 0x2a, 0x40,
-  0xdb, 0xc6, 0xde, 0x6d, 0x96, 0x90, 0xf0, 0x5c, 0x1f, 0x10, 0x1f, 0xdc,
-  0x14, 0xa2, 0xc5, 0x45, 0x82, 0x2a, 0x82, 0x12, 0xdf, 0x55, 0x81, 0xda,
-  0x8f, 0x80, 0x84, 0x06, 0x0c, 0xb7, 0xe4, 0x88, 0xc0, 0x07, 0xc6, 0x6c,
-  0x1a, 0xf6, 0x64, 0xdf, 0x63, 0x80, 0x84, 0x10, 0x92, 0xff, 0x88, 0x10,
-  0xaa, 0xd0, 0x48, 0x82, 0x4c, 0x0e, 0x19, 0x74, 0xc1, 0xf6, 0x9e, 0x46,
-  0x60, 0x09, 0x43, 0xe7, 0x02, 0x00, 0xc6, 0x46, 0xff, 0x82, 0xb2, 0x97,
-  0xc2, 0x63, 0xc8, 0x16, 0x48, 0x0b, 0xb6, 0x17, 0x6b, 0xac, 0xd6, 0xa8,
-  0x42, 0x2e, 0xd6, 0x68, 0xd5, 0x42, 0xa2, 0x13, 0x23, 0x74, 0xee, 0x04,
-  0xcd, 0x1f, 0xb6, 0x3a, 0x7b, 0xf8, 0x41, 0x54, 0x34, 0xd0, 0x1a, 0xb8,
-  0x75, 0x15, 0x08, 0xc4, 0x02, 0x55, 0x1b, 0xd8, 0x10, 0x51, 0x86, 0x98,
-  0x85, 0x51, 0x7a, 0x35, 0xd6, 0xc8, 0x2e, 0x60, 0xaa, 0x4b, 0x0d, 0x42,
-  0xa7, 0x0d, 0xb8, 0x58, 0xf1, 0x4a, 0x25, 0x24, 0x12, 0xb9, 0x42, 0xac,
-  0x7e, 0x8e, 0x62, 0x90, 0x72, 0x44, 0xe0, 0xb8, 0x81, 0x57, 0x23, 0x88,
-  0xde, 0x2b, 0x63, 0x23, 0x42, 0x04, 0xf9, 0x5d, 0x06, 0x3a, 0x11, 0x06,
-  0x14, 0x6a, 0x0b, 0x28, 0xc6, 0x04, 0x0c, 0x89, 0x8d, 0x74, 0x08, 0xbe,
-  0x7c, 0x6d, 0xbe, 0xac, 0x2f, 0xc4, 0x82, 0x94, 0x08, 0xc0, 0x13, 0x50,
-  0x57, 0x90, 0xb2, 0x90, 0x86, 0x75, 0x4a, 0x06, 0x27, 0xce, 0x8c, 0x23,
-  0xc0, 0x25, 0x1c, 0x35, 0x01, 0x8a, 0xfd, 0x04, 0xeb, 0x00, 0x90, 0xa3,
-  0x70, 0x2a, 0x25, 0x11, 0xe2, 0xe9, 0xdb, 0xac, 0x64, 0xc0, 0x93, 0xf8,
-  0x0a, 0x55, 0x83, 0xcc, 0xfc, 0x24, 0xc1, 0xae, 0x87, 0x2f, 0xc2, 0x80,
-  0x02, 0x21, 0xa5, 0xd8, 0x70, 0x39, 0xe2, 0x0a, 0xc0, 0xea, 0xd4, 0x80,
-  0x77, 0x07, 0x99, 0x88, 0x38, 0x27, 0x7a, 0x8a, 0xaa, 0xb0, 0x2a, 0x9d,
-  0xa8, 0x03, 0x19, 0x55, 0x30, 0x60, 0x05, 0x20, 0x65, 0xf4, 0x10, 0xeb,
-  0x59, 0x6e, 0x58, 0x2a, 0x10, 0x43, 0xd8, 0xeb, 0x6b, 0x62, 0x58, 0x22,
-  0x3d, 0x3b, 0x83, 0xd8, 0x42, 0x90, 0x02, 0xc5, 0xf6, 0xf9, 0x45, 0x1a,
-  0x2c, 0x64, 0x54, 0x42, 0x45, 0x47, 0x06, 0x0b, 0x3e, 0xeb, 0xa9, 0xdc,
-  0x25, 0x55, 0x59, 0x3d, 0x08, 0x28, 0xec, 0x5e, 0x17, 0xff, 0x83, 0x0d,
-  0x58, 0x75, 0x4d, 0x18, 0x4d, 0x04, 0xf4, 0x21, 0x7b, 0x32, 0x04, 0x6f,
-  0x0c, 0x0f, 0x4d, 0xc4, 0x01, 0x5e, 0x6a, 0xf9, 0x70, 0xec, 0x0f, 0xd7,
-  0x05, 0x61, 0x20, 0xa1, 0xf9, 0x94, 0x73, 0x03, 0x1c, 0x35, 0x06, 0x1a,
-  0x12, 0x89, 0x6a, 0x58, 0x38, 0xa6, 0x61, 0x41, 0x0f, 0x55, 0x0c, 0x51,
-  0x86, 0x0f, 0xaa, 0x2c, 0x28, 0x68, 0x0b, 0x49, 0x45, 0x7a, 0x7a, 0x88,
-  0xc1, 0x23, 0x72, 0x1b, 0xc3, 0x72, 0x55, 0x62, 0xc2, 0xed, 0x29, 0x0c,
-  0x00, 0xda, 0x04, 0x0d, 0x00, 0x82, 0x31, 0x93, 0x63, 0x4f, 0x12, 0xa8,
-  0x00, 0x30, 0x6a, 0x36, 0x18, 0x5c, 0x0e, 0x84, 0x72, 0x10, 0x12, 0x8a,
-  0x05, 0xa7, 0x90, 0xf8, 0x59, 0x0b, 0xe7, 0xce, 0x04, 0x05, 0x64, 0x8e,
-  0x85, 0x51, 0xc0, 0xbb, 0x02, 0x15, 0x36, 0x58, 0x25, 0x1f, 0x3d, 0x13,
-  0x2d, 0xe1, 0x67, 0x00, 0xba, 0x13, 0x08, 0x47, 0xdb, 0x3b, 0x8a, 0x03,
-  0x5d, 0x12, 0x3d, 0x80, 0x1e, 0x88, 0xd6, 0xc2, 0x0b, 0x0d, 0x48, 0xcc,
-  0x03, 0x1f, 0x90, 0x20, 0xb2, 0xec, 0x25, 0x3f, 0x35, 0x65, 0x81, 0x80,
-  0x1f, 0x0e, 0x69, 0x6c, 0x1a, 0x09, 0x87, 0x04, 0x64, 0x50, 0xc0, 0x17,
-  0x15, 0x9b, 0xef, 0x36, 0xac, 0x17, 0x1b, 0xe4, 0x06, 0x9b, 0x18, 0x15,
-  0xe4, 0x18, 0xfd, 0x08, 0x40, 0x25, 0x0f, 0x83, 0x4d, 0x18, 0xd8, 0x1f,
-  0xfe, 0x4b, 0xbd, 0x19, 0x05, 0x5d, 0xee, 0x50, 0xd9, 0x7d, 0x0a, 0x2f,
-  0xfb, 0x19, 0x01, 0xeb, 0x1b, 0x2d, 0x36, 0xe9, 0xd0, 0xb0, 0xbb, 0x07,
-  0x7f, 0x00, 0x16, 0x0d, 0x8c, 0x5e, 0x19, 0x20, 0xef, 0x75, 0x16, 0x01,
-  0x80, 0xd3, 0x82, 0xb6, 0xf7, 0x01, 0x71, 0x44, 0x90, 0x96, 0x83, 0x07,
-  0x01, 0x1f, 0x03, 0x65, 0x80, 0x01, 0x48, 0xbb, 0x18, 0x41, 0xd1, 0x73,
-  0x60, 0x6f, 0x6a, 0x09, 0x1c, 0x02, 0x11, 0x4c, 0x30, 0x08, 0xb3, 0x46,
-  0x56, 0xd6, 0x47, 0x49, 0x20, 0x5d, 0x32, 0x80, 0x16, 0x69, 0x53, 0x68,
-  0x1b, 0x40, 0xe8, 0xb5, 0x04, 0xec, 0x10, 0x48, 0x0b, 0xb2, 0x29, 0x70,
-  0x3a, 0x18, 0x30, 0x2b, 0x86, 0x2b, 0xa2, 0x92, 0x25, 0x2d, 0xbe, 0x62,
-  0xe0, 0xfe, 0x83, 0x6e, 0xe9, 0xc4, 0x5e, 0x40, 0x61, 0x6b, 0x73, 0xeb,
-  0x3b, 0x20, 0xbf, 0xfe, 0xbe, 0x8a, 0x0b, 0x99, 0xd0, 0x43, 0x45, 0x88,
-  0x6c, 0x82, 0x93, 0x4c, 0x01, 0x09, 0x0b, 0xa8, 0x24, 0x22, 0x94, 0x20,
-  0xfc, 0x73, 0x0a, 0x34, 0xba, 0x4a, 0x3f, 0x08, 0x06, 0x8c, 0x88, 0x10,
-  0xe9, 0x33, 0xf6, 0x06, 0x0a, 0x90, 0x6e, 0x64, 0xf6, 0xad, 0x10, 0xd5,
-  0x18, 0x10, 0x42, 0xf0, 0x16, 0xab, 0xb5, 0x01, 0x58, 0x92, 0x4a, 0x5a,
-  0x4e, 0xe0, 0x20, 0xe0, 0xac, 0x52, 0x66, 0x2b, 0x56, 0xe8, 0x07, 0x23,
-  0x37, 0x60, 0x8d, 0xac, 0x14, 0x26, 0x60, 0x22, 0x4a, 0x20, 0xd5, 0x85,
-  0xfa, 0xf9, 0x03, 0x08, 0x3a, 0x11, 0x3b, 0x13, 0x8e, 0x04, 0x09, 0x6d,
-  0x82, 0x81, 0x11, 0x10, 0x04, 0x97, 0x08, 0x32, 0x52, 0x5e, 0x43, 0x0a,
-  0x52, 0x5b, 0x53, 0x08, 0x18, 0x0b, 0x60, 0x09, 0x02, 0x0b, 0x04, 0x1b,
-  0x51, 0xc3, 0x23, 0xbc, 0x60, 0x4f, 0x32, 0x4b, 0x54, 0xd1, 0x21, 0x06,
-  0x32, 0x57, 0x1d, 0xbc, 0x0b, 0xae, 0x27, 0xb7, 0x5b, 0xb2, 0xff, 0x68,
-  0xb9, 0xaa, 0x3b, 0xa3, 0xb8, 0x0a, 0x39, 0xf4, 0xa4, 0xf6, 0x81, 0x10,
-  0x67, 0x1c, 0x37, 0x05, 0x80, 0x00, 0x85, 0xac, 0xc5, 0x77, 0x10, 0x74,
-  0x0d, 0xa0, 0x83, 0x10, 0x21, 0x72, 0xa0, 0x1a, 0x8a, 0x38, 0x73, 0x40,
-  0x30, 0x2e, 0x01, 0xd3, 0xaa, 0x76, 0xa9, 0xfc, 0x0b, 0x53, 0x0d, 0x4b,
-  0x0a, 0x3a, 0x97, 0x11, 0x70, 0x08, 0x25, 0x60, 0xcd, 0x2f, 0x93, 0x22,
-  0x25, 0x92, 0x09, 0xb4, 0xb6, 0x85, 0xdb, 0x20, 0x5e, 0xde, 0x09, 0x09,
-  0x82, 0x00, 0x62, 0xba, 0x0a, 0x4b, 0xab, 0x46, 0xa3, 0x46, 0x22, 0x04,
-  0x43, 0x88, 0xe6, 0x1c, 0x65, 0x16, 0x73, 0x47, 0xd0, 0x42, 0x25, 0x57,
-  0x1b, 0xd8, 0xe1, 0x1f, 0x68, 0x30, 0x08, 0xc4, 0xaa, 0x0c, 0xa7, 0x10,
-  0x09, 0x4a, 0x5b, 0xb4, 0x2a, 0x44, 0x8b, 0xbd, 0xb7, 0x02, 0xec, 0x71,
-  0x16, 0xad, 0x7d, 0x71, 0x5a, 0x06, 0x13, 0x05, 0xb0, 0xb8, 0x29, 0x7b,
-  0x54, 0xb8, 0x21, 0xc9, 0x17, 0x01, 0x16, 0x8f, 0x01, 0x04, 0x84, 0x90,
-  0x4a, 0x30, 0xa2, 0x67, 0x20, 0x46, 0xc9, 0x56, 0x09, 0x90, 0x2f, 0x8e,
-  0x00, 0x21, 0x1e, 0x74, 0x73, 0x04, 0x9b, 0x8e, 0x62, 0x40, 0xb9, 0x4b,
-  0x02, 0xe4, 0x34, 0x21, 0xb3, 0x1c, 0x2e, 0x09, 0x03, 0x72, 0xfa, 0xc8,
-  0xf8, 0x06, 0x2b, 0x35, 0xd1, 0x02, 0xbe, 0x10, 0xa3, 0x4e, 0x1b, 0x0f,
-  0xa9, 0x31, 0x19, 0x16, 0x48, 0x00, 0xb3, 0x0c, 0x42, 0x52, 0x61, 0xf9,
-  0x30, 0x64, 0x8f, 0x18, 0x02, 0xb1, 0xf0, 0x65, 0xdd, 0x33, 0x18, 0x2f,
-  0xde, 0x02, 0x48, 0x5b, 0xa6, 0x1d, 0xeb, 0x11, 0x84, 0x12, 0x8c, 0x76,
-  0x16, 0xd5, 0x06, 0x23, 0x7e, 0x30, 0x90, 0x3e, 0xc8, 0x6c, 0x17, 0x55,
-  0x20, 0x5c, 0x3e, 0x84, 0x30, 0x26, 0x06, 0x0e, 0x6b, 0x96, 0x29, 0xa0,
-  0x0e, 0x92, 0xb2, 0xda, 0xa1, 0x12, 0x0d, 0xd0, 0x02, 0xa8, 0x12, 0xe9,
-  0x05, 0x04, 0x19, 0x06, 0x19, 0x08, 0x19, 0x0a, 0x56, 0x2a, 0x73, 0xfc,
-  0x64, 0x51, 0x00, 0x84, 0x25, 0x53, 0xa2, 0x2c, 0xf6, 0x91, 0x48, 0x66,
-  0x42, 0x00, 0x24, 0x6d, 0x14, 0x11, 0x9a, 0x84, 0x48, 0x6e, 0xe0, 0x10,
-  0x02, 0x48, 0x8d, 0x52, 0x64, 0x53, 0x15, 0x0e, 0x73, 0xcb, 0x26, 0x9d,
-  0x08, 0xac, 0x9e, 0xcd, 0xbd, 0xb8, 0x38, 0x08, 0xd8, 0x84, 0x7b, 0xd0,
-  0x96, 0xd4, 0xfd, 0xbc, 0x09, 0x12, 0x04, 0x7a, 0x95, 0xc2, 0xc6, 0xd4,
-  0x60, 0xa6, 0x89, 0xcd, 0x66, 0xff, 0xf8, 0x26, 0x2b, 0x17, 0x26, 0x1b,
-  0x54, 0x06, 0x11, 0xbc, 0x99, 0x77, 0x14, 0x72, 0xdb, 0x73, 0x0d, 0x1b,
-  0x99, 0x8e, 0x60, 0x83, 0x3b, 0x26, 0x01, 0xda, 0x28, 0x11, 0x22, 0x13,
-  0x70, 0x18, 0x81, 0x48, 0x22, 0xc1, 0xa8, 0x65, 0x12, 0x82, 0x2c, 0xa8,
-  0x0b, 0x12, 0xec, 0xa0, 0x21, 0xdc, 0x95, 0x25, 0x0a, 0xa9, 0x75, 0x0c,
-  0x01, 0x08, 0x92, 0x08, 0x92, 0x66, 0xd0, 0x21, 0x8c, 0xa4, 0xe8, 0x0c,
-  0x58, 0x57, 0x48, 0xb0, 0x36, 0x50, 0x84, 0xa1, 0xa0, 0x7d, 0x9f, 0xfd,
-  0x01, 0x61, 0x04, 0x8b, 0xf7, 0xac, 0xed, 0x0c, 0x57, 0x0a, 0x8b, 0xa1,
-  0xe9, 0x01, 0xe9, 0x2e, 0xd4, 0xc3, 0x25, 0xbb, 0x10, 0x0c, 0xd7, 0x00,
-  0x58, 0x26, 0xc8, 0x0a, 0xba, 0x28, 0xb7, 0x4d, 0xd3, 0x12, 0x11, 0xb3,
-  0x19, 0x9e, 0x02, 0x9d, 0x28, 0x70, 0x97, 0x8c, 0x8b, 0x2c, 0xf4, 0x2e,
-  0x64, 0x2f, 0x60, 0xa1, 0x07, 0x03, 0xc4, 0x6f, 0xff, 0x12, 0xc0, 0x2a,
-  0x2c, 0x24, 0x1a, 0xf0, 0x8a, 0x37, 0x69, 0xf2, 0x2e, 0xb7, 0xa1, 0x06,
-  0x0b, 0x06, 0x2a, 0xec, 0x6e, 0x4f, 0xff, 0x80, 0x20, 0xce, 0xf4, 0xf0,
-  0x13, 0xc0, 0xd2, 0x22, 0x03, 0xa4, 0x16, 0xa0, 0x32, 0x68, 0x47, 0xd5,
-  0xed, 0xff, 0x36, 0x46, 0x6b, 0x03, 0x4e, 0x45, 0x82, 0x6c, 0x24, 0x4f,
-  0xde, 0xa0, 0xdd, 0x24, 0x05, 0x30, 0x00, 0x4c, 0xde, 0xcc, 0xac, 0x64,
-  0x7f, 0xbf, 0xd5, 0xff, 0x77, 0xba, 0x1e, 0x03, 0x1c, 0xc1, 0x25, 0xa2,
-  0x04, 0x2b, 0xa9, 0x14, 0x04, 0x70, 0x10, 0xe1, 0x38, 0x11, 0x9b, 0x51,
-  0x25, 0x2d, 0xb8, 0x17, 0x0d, 0xfe, 0xa8, 0x1d, 0x77, 0x83, 0x2e, 0x0c,
-  0x21, 0xce, 0xb8, 0x10, 0x41, 0x78, 0x04, 0x74, 0x3f, 0x49, 0x14, 0x9f,
-  0x20, 0x22, 0x00, 0x60, 0x48, 0x0e, 0xc4, 0xfd, 0x40, 0xe4, 0x24, 0x39,
-  0x6f, 0x01, 0x90, 0x02, 0x19, 0x14, 0xe4, 0x16, 0x03, 0x90, 0x7b, 0x99,
-  0x18, 0x0e, 0x26, 0x74, 0x61, 0x3a, 0x6a, 0x83, 0xc2, 0x01, 0x06, 0x30,
-  0x11, 0xa2, 0x8c, 0x2d, 0x01, 0x46, 0x0b, 0x63, 0x4c, 0x1a, 0xbe, 0x89,
-  0x95, 0x84, 0x42, 0x0a, 0xaf, 0x59, 0x15, 0xee, 0x2f, 0x0c, 0xa3, 0x98,
-  0xe0, 0x23, 0x91, 0xfb, 0x6e, 0x3b, 0xce, 0x8a, 0xfc, 0x0a, 0x99, 0x52,
-  0x44, 0x49, 0x2a, 0x62, 0x29, 0xed, 0x3d, 0x75, 0x65, 0x40, 0x61, 0xc5,
-  0x48, 0x20, 0x49, 0x5a, 0x76, 0x42, 0x8b, 0x8b, 0xc5, 0x0c, 0x61, 0xce,
-  0xc2, 0x1e, 0xdb, 0xa1, 0x66, 0x0e, 0xf6, 0x43, 0x01, 0x17, 0xd3, 0x82,
-  0x29, 0xe8, 0x30, 0x86, 0xff, 0x04, 0x74, 0xd6, 0x6e, 0x5c, 0x20, 0x8a,
-  0xa4, 0x49, 0xbf, 0x81, 0xec, 0xca, 0x00, 0x41, 0x13, 0xab, 0xd6, 0xde,
-  0x10, 0x1d, 0x0b, 0xb5, 0x32, 0x11, 0x04, 0x9b, 0x78, 0x16, 0xa0, 0xa6,
-  0x82, 0x49, 0x79, 0x1a, 0x76, 0x8c, 0xc8, 0xc5, 0x04, 0x93, 0xd2, 0xea,
-  0x64, 0xef, 0x32, 0xf3, 0x22, 0x25, 0xcb, 0x88, 0x9e, 0x4d, 0xab, 0x03,
-  0x6b, 0xf7, 0xed, 0x04, 0x8a, 0x19, 0xa0, 0xbe, 0x4b, 0xf8, 0x0b, 0xf8,
-  0x0a, 0x41, 0x0a, 0xfb, 0x09, 0x41, 0x01, 0x5b, 0x64, 0xbd, 0x82, 0x08,
-  0xc3, 0x3a, 0xc6, 0x27, 0x01, 0xd8, 0x30, 0xcd, 0x59, 0x41, 0xea, 0x1b,
-  0x01, 0x03, 0x00, 0x66, 0x86, 0x92, 0xec, 0x96, 0x1e, 0xed, 0x7e, 0xff,
-  0x81, 0x92, 0xbe, 0xe0, 0xf6, 0x80, 0x97, 0xbb, 0x42, 0x86, 0x15, 0x76,
-  0xfd, 0xcf, 0x10, 0x43, 0x05, 0x13, 0xb9, 0xd9, 0xe8, 0x1b, 0xc9, 0x8e,
-  0x5c, 0x03, 0xad, 0x43, 0x92, 0xd2, 0x5b, 0xc0, 0x9c, 0x01, 0xa0, 0x79,
-  0x96, 0x26, 0x9c, 0x03, 0xab, 0x60, 0xe8, 0x35, 0xbb, 0x40, 0xb4, 0x72,
-  0x9d, 0x02, 0xdd, 0x2f, 0x17, 0x6c, 0x1e, 0x9e, 0x9d, 0x9e, 0xd3, 0x1c,
-  0x0f, 0xdd, 0x9f, 0x18, 0x7f, 0xa0, 0x00, 0x8b, 0xd7, 0x5d, 0x59, 0xdf,
-  0x24, 0xdb, 0x10, 0x0c, 0xbd, 0x36, 0xef, 0x17, 0x81, 0x0b, 0xc0, 0x18,
-  0x83, 0x39, 0x97, 0x06, 0x94, 0x11, 0x88, 0xe9, 0x03, 0x35, 0x7b, 0x39,
-  0xeb, 0x3d, 0x18, 0x06, 0xc1, 0x71, 0x61, 0x6b, 0x76, 0x19, 0x17, 0xbe,
-  0x0a, 0x25, 0x14, 0x15, 0x44, 0xc2, 0x6d, 0x92, 0x11, 0xe0, 0x09, 0x2a,
-  0xdd, 0xb6, 0xe9, 0x85, 0xbb, 0x02, 0x82, 0xfe, 0x63, 0x03, 0x0e, 0x78,
-  0x88, 0x04, 0x89, 0x8c, 0x52, 0x77, 0x38, 0x81, 0x7e, 0xd5, 0x38, 0x2e,
-  0x33, 0x1b, 0x75, 0x47, 0x72, 0x13, 0x6e, 0x35, 0x21, 0x11, 0x0a, 0x93,
-  0x82, 0x75, 0xd5, 0xda, 0xbb, 0x32, 0xeb, 0x14, 0x12, 0x66, 0x36, 0x40,
-  0xea, 0x0a, 0x08, 0xc3, 0x5b, 0x0b, 0xb8, 0x05, 0x8f, 0x4c, 0x06, 0x6c,
-  0x8e, 0xb6, 0xbc, 0xb8, 0x74, 0x45, 0xb6, 0xa8, 0x02, 0xdb, 0xa6, 0x29,
-  0x4e, 0x80, 0x11, 0x1b, 0xfa, 0x36, 0xff, 0x01, 0x21, 0xb8, 0xb3, 0x0d,
-  0x6d, 0x3d, 0xb8, 0xdb, 0x29, 0xb1, 0x16, 0x3d, 0x17, 0x86, 0xc6, 0xb4,
-  0xc3, 0xf2, 0xb2, 0xb1, 0x0a, 0x20, 0xac, 0xdb, 0x7d, 0x53, 0x51, 0xeb,
-  0x25, 0x87, 0x44, 0x69, 0x20, 0x48, 0x69, 0xe1, 0xb4, 0x6c, 0xb2, 0x79,
-  0xb9, 0xba, 0x7b, 0xbc, 0x74, 0x7a, 0x81, 0x65, 0xc2, 0x9e, 0xc4, 0xbc,
-  0x59, 0xba, 0x64, 0x87, 0x23, 0xb9, 0xc4, 0x29, 0x80, 0x81, 0xcb, 0xc0,
-  0xbe, 0x20, 0x0b, 0x44, 0x3b, 0x9e, 0x81, 0x08, 0xe5, 0xc0, 0x92, 0xbe,
-  0xe5, 0xc6, 0x9e, 0xc8, 0xce, 0x59, 0xd0, 0xe5, 0xc8, 0x96, 0xc6, 0xb8,
-  0x42, 0x3b, 0xd0, 0x29, 0x98, 0x81, 0x0c, 0xcc, 0xb2, 0xca, 0x00, 0xb3,
-  0x44, 0xb0, 0xcf, 0x81, 0x8e, 0xcc, 0x59, 0xca, 0x2e, 0xda, 0xd9, 0x79,
-  0xdc, 0xe5, 0xd4, 0x96, 0xd2, 0xe9, 0x42, 0x3b, 0xdc, 0x29, 0x98, 0x79,
-  0x0c, 0xd8, 0xb2, 0xd6, 0x00, 0xb3, 0x44, 0xb0, 0xff, 0x79, 0x8e, 0xd8,
-  0x58, 0xd6, 0x48, 0xf7, 0x6d, 0x2b, 0x2e, 0xdd, 0x18, 0x12, 0x5f, 0xb0,
-  0x2c, 0xae, 0x80, 0xcb, 0xac, 0xaa, 0x24, 0x76, 0x0b, 0x2a, 0xee, 0x1b,
-  0x12, 0x45, 0x96, 0xac, 0xaa, 0x43, 0x19, 0x96, 0x72, 0xe4, 0xc9, 0xe2,
-  0x17, 0x2f, 0x92, 0x12, 0x9c, 0x4a, 0x12, 0x84, 0x63, 0xfb, 0x03, 0x6e,
-  0x0b, 0x68, 0x12, 0x87, 0x02, 0xb2, 0x57, 0x1c, 0xef, 0x7f, 0x88, 0xb6,
-  0xe0, 0xce, 0xde, 0x4b, 0xaa, 0xe6, 0x26, 0xfd, 0x75, 0x66, 0x98, 0xf2,
-  0x1a, 0xe8, 0xc9, 0xe6, 0x72, 0xe2, 0xcf, 0xe4, 0xaf, 0x3c, 0xe4, 0xb2,
-  0xe2, 0x1a, 0x8a, 0x9d, 0xa9, 0xba, 0x7a, 0xca, 0x07, 0x14, 0x39, 0x0d,
-  0x25, 0x0c, 0x5b, 0x28, 0xc7, 0x90, 0x12, 0xc1, 0x61, 0x1e, 0x2a, 0x89,
-  0x90, 0x40, 0x15, 0x77, 0xf3, 0x77, 0x21, 0x72, 0x37, 0xe8, 0x03, 0x73,
-  0xa2, 0x18, 0x30, 0x5d, 0x75, 0x10, 0x13, 0xf0, 0xbd, 0xde, 0x92, 0x6b,
-  0xfe, 0x26, 0x72, 0x43, 0x75, 0x4e, 0x72, 0x88, 0x19, 0xfe, 0xad, 0x06,
-  0xec, 0x42, 0x38, 0x5b, 0xe3, 0x98, 0x13, 0x5c, 0x5d, 0x8b, 0x48, 0x64,
-  0x14, 0x2e, 0x10, 0x6e, 0x0f, 0x72, 0x67, 0x47, 0x40, 0x42, 0xc9, 0x72,
-  0x5e, 0x03, 0xb8, 0x5b, 0xa8, 0xba, 0x6b, 0x22, 0x1b, 0x21, 0x60, 0x57,
-  0xb3, 0x1b, 0x65, 0x6c, 0x32, 0x1e, 0x17, 0x14, 0x66, 0x0c, 0x0a, 0x30,
-  0xff, 0x68, 0x83, 0xdc, 0x96, 0x7d, 0x1a, 0x0d, 0x51, 0x0d, 0x02, 0x39,
-  0xc9, 0xcd, 0x37, 0x46, 0x4a, 0x68, 0x2b, 0xc7, 0x0d, 0xda, 0xbd, 0xea,
-  0x2c, 0x76, 0xb4, 0x2e, 0x13, 0x49, 0x12, 0x62, 0x6d, 0x12, 0x92, 0x32,
-  0xc2, 0x3c, 0x03, 0x10, 0x54, 0x98, 0xd0, 0x88, 0x3f, 0xfc, 0x15, 0x08,
-  0x26, 0x24, 0x7d, 0xf6, 0x88, 0x00, 0x99, 0x1f, 0x01, 0xb5, 0x12, 0x01,
-  0x25, 0x6a, 0x28, 0x80, 0x43, 0x3f, 0x16, 0xf8, 0x60, 0x8c, 0x8e, 0xbb,
-  0x4d, 0x11, 0x36, 0x73, 0xcc, 0x5d, 0xad, 0xf3, 0xe1, 0x3f, 0x17, 0x52,
-  0x82, 0x25, 0xb2, 0x13, 0x8a, 0x58, 0x22, 0x4c, 0x76, 0x16, 0x70, 0x73,
-  0xf0, 0x30, 0x1a, 0xe0, 0x32, 0xb1, 0x72, 0x00, 0x84, 0x4a, 0x89, 0x46,
-  0x74, 0x04, 0x02, 0x51, 0x20, 0x6c, 0x20, 0xcf, 0xb6, 0x81, 0x00, 0x04,
-  0x7d, 0x10, 0x7d, 0x90, 0xac, 0xa2, 0x4b, 0xcd, 0x00, 0xf4, 0x9e, 0x60,
-  0xdd, 0x69, 0xfc, 0xfd, 0x50, 0x04, 0x49, 0x8d, 0x1b, 0x39, 0x64, 0xe1,
-  0x01, 0x42, 0xf6, 0x6c, 0x32, 0xfb, 0x9a, 0x73, 0x0e, 0x2c, 0x16, 0x40,
-  0x13, 0x7c, 0x24, 0xfd, 0x04, 0xeb, 0xa0, 0xeb, 0x9e, 0x96, 0xa4, 0x02,
-  0x04, 0x5c, 0x09, 0x9b, 0x10, 0x14, 0xeb, 0xff, 0x1b, 0x8b, 0x16, 0x38,
-  0x13, 0xa1, 0x36, 0x13, 0xdb, 0xeb, 0x16, 0x08, 0x3c, 0x2c, 0x3a, 0xb2,
-  0x0d, 0xcb, 0x40, 0x3e, 0x2c, 0x04, 0x51, 0xcc, 0xb5, 0xe6, 0x1d, 0x08,
-  0x04, 0xd2, 0xac, 0xf8, 0x56, 0xce, 0xc9, 0x6c, 0x20, 0x4b, 0x1a, 0x45,
-  0x94, 0xb7, 0xbe, 0x39, 0xfb, 0x28, 0x32, 0xf3, 0x2f, 0x28, 0x8a, 0xa3,
-  0x86, 0x59, 0x6e, 0x3a, 0x27, 0x16, 0x66, 0x71, 0x1b, 0x09, 0xf2, 0xcd,
-  0xf8, 0x1e, 0xe4, 0xb8, 0xec, 0x13, 0x31, 0x0e, 0xdf, 0xca, 0x93, 0x10,
-  0x00, 0x26, 0xc3, 0xc8, 0x94, 0x39, 0xdd, 0x00, 0x31, 0xae, 0x19, 0x23,
-  0xbb, 0x3a, 0x98, 0x74, 0x5f, 0x61, 0x8f, 0x4b, 0xb7, 0xe6, 0x88, 0x10,
-  0x53, 0xd4, 0x33, 0x53, 0x14, 0x19, 0x4e, 0x13, 0x63, 0xa8, 0xff, 0xa3,
-  0xf8, 0x39, 0x48, 0x05, 0x4e, 0xf6, 0x30, 0x51, 0x3d, 0x00, 0x02, 0xd9,
-  0xd6, 0x00, 0xfe, 0x2b, 0x43, 0xe8, 0xdb, 0x66, 0x6f, 0x15, 0x81, 0xfe,
-  0x44, 0x75, 0x2d, 0xf0, 0x44, 0x3f, 0xcd, 0x0f, 0x77, 0x53, 0x3d, 0x97,
-  0x50, 0x0c, 0x2a, 0x16, 0xcb, 0x35, 0xd9, 0x05, 0x17, 0x65, 0x2f, 0x96,
-  0x24, 0x29, 0x59, 0x31, 0x6a, 0x23, 0x85, 0x19, 0xd9, 0x14, 0x50, 0x4f,
-  0x82, 0x23, 0xdf, 0x70, 0xe5, 0x12, 0x82, 0x20, 0xd9, 0x1c, 0x4b, 0x7b,
-  0x06, 0xeb, 0x15, 0x1e, 0x64, 0x58, 0x8c, 0x64, 0xde, 0xf6, 0x7b, 0x00,
-  0x90, 0x01, 0x43, 0x5c, 0x63, 0x05, 0x50, 0x46, 0x38, 0xf8, 0x00, 0x44,
-  0x00, 0x4a, 0x08, 0xac, 0xf3, 0x1e, 0x81, 0x7f, 0x0b, 0xdd, 0xb1, 0x75,
-  0x6c, 0x40, 0x4e, 0x65, 0x8e, 0xd3, 0xf5, 0x3a, 0x07, 0x75, 0x60, 0x01,
-  0x34, 0x6d, 0x8b, 0x8f, 0x3b, 0x47, 0x01, 0xd9, 0x75, 0x50, 0x0f, 0xc9,
-  0x11, 0xf2, 0x03, 0x75, 0x40, 0x72, 0x13, 0x7c, 0x05, 0x75, 0x30, 0x9c,
-  0x16, 0x9f, 0x07, 0x75, 0x20, 0x27, 0x18, 0x27, 0x09, 0xc9, 0x75, 0x10,
-  0xc9, 0x1a, 0xc1, 0x0b, 0x61, 0xce, 0xa0, 0x92, 0x35, 0xd5, 0x66, 0xac,
-  0x00, 0x76, 0xf2, 0x19, 0x5a, 0x88, 0x11, 0x87, 0xfb, 0xf4, 0x2e, 0xa3,
-  0xf6, 0x2e, 0x26, 0x35, 0x14, 0x64, 0x44, 0x8a, 0x49, 0xb8, 0xa0, 0x06,
-  0x2b, 0x5a, 0x2c, 0x06, 0x1b, 0x0e, 0x74, 0x3b, 0x0a, 0x87, 0x0f, 0xaa,
-  0x35, 0xca, 0xe6, 0xe4, 0x21, 0x2e, 0x11, 0x23, 0x61, 0x0e, 0x07, 0x03,
-  0x3d, 0xc6, 0xbf, 0x71, 0x56, 0x18, 0x36, 0x53, 0x33, 0x14, 0x56, 0x5d,
-  0x1a, 0xa0, 0xf5, 0xda, 0x2c, 0xb2, 0xf6, 0xcd, 0xa3, 0x00, 0x81, 0xd5,
-  0xfa, 0x33, 0x01, 0xf8, 0x12, 0x59, 0x5e, 0x16, 0x0c, 0x45, 0xc8, 0x48,
-  0x03, 0xc2, 0xc7, 0x23, 0xb2, 0xf3, 0x16, 0xd2, 0x56, 0x12, 0x11, 0xb4,
-  0x46, 0x6f, 0x4d, 0xfa, 0x11, 0xb1, 0x23, 0x66, 0x2d, 0x4a, 0x50, 0x55,
-  0x0b, 0xad, 0x9a, 0x89, 0xa6, 0x42, 0x98, 0x82, 0xa2, 0x2c, 0xa9, 0x01,
-  0x5a, 0x25, 0x20, 0x84, 0xda, 0xc5, 0x14, 0x98, 0x04, 0x8b, 0xca, 0x3a,
-  0x22, 0xa3, 0xbc, 0xe3, 0x1c, 0x36, 0x71, 0x6c, 0x14, 0x50, 0x86, 0xdd,
-  0xc7, 0x2f, 0x04, 0x01, 0xa6, 0x3f, 0x0d, 0xaa, 0x0c, 0x0d, 0x05, 0x53,
-  0xa2, 0x4f, 0xda, 0xfa, 0x25, 0x69, 0x51, 0x7c, 0xb3, 0x80, 0x7e, 0xda,
-  0x2d, 0x3a, 0x0c, 0xb0, 0x05, 0xdb, 0x41, 0x7e, 0xdd, 0xdc, 0x20, 0x06,
-  0x26, 0xb1, 0xb2, 0x31, 0x08, 0x2a, 0x38, 0x3b, 0x56, 0x60, 0x41, 0x40,
-  0x4d, 0x5c, 0x59, 0x6c, 0x63, 0x8b, 0x81, 0x6d, 0x82, 0x8a, 0x1a, 0xb5,
-  0x83, 0x8a, 0x34, 0xa4, 0x21, 0x25, 0x94, 0x79, 0xaa, 0x49, 0xfe, 0xf0,
-  0x0b, 0xe9, 0x38, 0xff, 0x54, 0x61, 0x2b, 0x8a, 0x42, 0x08, 0x42, 0x3a,
-  0x38, 0x4a, 0x05, 0x09, 0xe8, 0x3c, 0xa3, 0xfe, 0x12, 0x92, 0xf9, 0x00,
-  0x2f, 0xa1, 0xfe, 0x5a, 0x06, 0xc7, 0xfc, 0x83, 0x00, 0x78, 0x1e, 0x54,
-  0x87, 0xcd, 0xcf, 0x21, 0xe5, 0x2f, 0xff, 0x36, 0x10, 0x83, 0x57, 0xb0,
-  0x8a, 0xff, 0x42, 0x7e, 0x79, 0xc7, 0x00, 0x3c, 0x60, 0x0a, 0x8a, 0x32,
-  0xf0, 0xed, 0x17, 0x05, 0x96, 0xfc, 0x11, 0xc9, 0x38, 0x04, 0x27, 0x0e,
-  0xa9, 0x1d, 0x0b, 0xba, 0x5b, 0x97, 0xf7, 0xb0, 0xea, 0x75, 0xf2, 0x02,
-  0x2f, 0xca, 0x04, 0xdc, 0x06, 0x0b, 0x06, 0xa0, 0x38, 0x39, 0x61, 0xbc,
-  0xcb, 0xf8, 0xfa, 0xbc, 0x2e, 0xb1, 0x24, 0xf9, 0x18, 0x0a, 0x85, 0xa6,
-  0xaa, 0x2e, 0x9c, 0x3d, 0x14, 0x12, 0xd0, 0x18, 0x02, 0x51, 0xac, 0x93,
-  0x97, 0x0d, 0x04, 0x42, 0x18, 0x13, 0x78, 0x05, 0x60, 0x63, 0xf8, 0xd4,
-  0x02, 0x1c, 0x13, 0x8a, 0x75, 0x14, 0x41, 0x2d, 0x98, 0x1e, 0xa0, 0x9b,
-  0x03, 0x1f, 0xb8, 0x37, 0xe9, 0xbd, 0xa0, 0x7d, 0x9b, 0x8b, 0xc6, 0x88,
-  0x9d, 0x35, 0x08, 0xbb, 0x90, 0x03, 0xd0, 0xb8, 0x5b, 0x92, 0x52, 0x11,
-  0x09, 0xcb, 0x1b, 0x48, 0x6d, 0x7f, 0x2a, 0x92, 0x03, 0x1e, 0x83, 0xc2,
-  0x08, 0xc5, 0x2d, 0xca, 0x96, 0xbc, 0xd9, 0x5c, 0x0e, 0xc9, 0x31, 0x5a,
-  0x06, 0x16, 0xd1, 0xc8, 0x79, 0x14, 0x64, 0x12, 0x8e, 0x16, 0x5a, 0x2c,
-  0x59, 0x09, 0xfa, 0x9a, 0xf0, 0x20, 0x32, 0x7f, 0xbb, 0xf9, 0xaa, 0x80,
-  0xb2, 0xda, 0x10, 0x1c, 0xb8, 0x45, 0xd6, 0xa4, 0xb3, 0xfc, 0xd8, 0xfe,
-  0x7c, 0x2d, 0xbe, 0xcf, 0x02, 0x2f, 0x77, 0x82, 0x0b, 0x57, 0xa7, 0x99,
-  0x2a, 0x8d, 0x43, 0x03, 0x6b, 0x6c, 0x13, 0x8b, 0xda, 0xb8, 0xa1, 0x50,
-  0x20, 0x15, 0x5f, 0xbc, 0x8b, 0xb2, 0xc7, 0x30, 0xd9, 0x14, 0x85, 0x21,
-  0x7b, 0xf0, 0x73, 0x37, 0x10, 0x32, 0xf7, 0x35, 0x18, 0x45, 0x0b, 0xd5,
-  0x2d, 0xec, 0x28, 0xf5, 0xad, 0x86, 0x2b, 0xcd, 0x1d, 0x93, 0x96, 0xc7,
-  0x68, 0x62, 0x09, 0x72, 0x43, 0xa2, 0x23, 0x24, 0x34, 0x90, 0xc2, 0x58,
-  0xc8, 0x41, 0x5e, 0x6f, 0xd6, 0x03, 0x5e, 0xa2, 0xb0, 0x25, 0x14, 0xda,
-  0xc6, 0xa5, 0x02, 0x22, 0xf4, 0xe7, 0x49, 0x19, 0xfa, 0x26, 0x03, 0x57,
-  0x04, 0xa2, 0xdb, 0x26, 0x06, 0x13, 0x50, 0x88, 0xe5, 0x81, 0x3e, 0x39,
-  0x04, 0xa1, 0x56, 0x8b, 0x75, 0xdd, 0x14, 0x4d, 0x3e, 0xfc, 0x21, 0xa0,
-  0x90, 0xf8, 0x30, 0xea, 0xa3, 0x90, 0x0f, 0xb0, 0x00, 0x74, 0xdb, 0x0c,
-  0x3a, 0x57, 0x21, 0xe3, 0xf8, 0x46, 0xeb, 0xbc, 0x76, 0x12, 0x34, 0x21,
-  0xed, 0x01, 0x54, 0x95, 0x5c, 0xa4, 0x8b, 0x2c, 0x20, 0x00, 0x4b, 0xfc,
-  0x00, 0xc2, 0x14, 0x5a, 0x43, 0x0a, 0xf8, 0x18, 0x2f, 0xa3, 0x1a, 0x2f,
-  0xdd, 0xea, 0x16, 0x2f, 0xa3, 0x27, 0xf0, 0x72, 0x08, 0x2f, 0x4a, 0x8a,
-  0x36, 0x0a, 0x06, 0x6e, 0x16, 0xbe, 0x01, 0x20, 0x40, 0x1a, 0xc5, 0x20,
-  0xdb, 0xf6, 0x5b, 0x83, 0x3e, 0x33, 0x83, 0xa1, 0x63, 0x52, 0x7e, 0x64,
-  0xe2, 0x86, 0x46, 0x4d, 0xd1, 0xd8, 0x2a, 0x34, 0x3f, 0x2f, 0x41, 0x35,
-  0x65, 0x2f, 0x34, 0xe4, 0x1a, 0xcd, 0x6c, 0x18, 0x7a, 0x3c, 0x19, 0x03,
-  0x54, 0x81, 0xec, 0xdd, 0x01, 0x81, 0xc7, 0x80, 0x7a, 0xd2, 0x01, 0xeb,
-  0x11, 0x43, 0x64, 0x90, 0x74, 0xdd, 0x93, 0xe9, 0xc1, 0xb9, 0x01, 0x93,
-  0x47, 0x76, 0x63, 0x7b, 0x74, 0x4b, 0x75, 0x8c, 0x21, 0xb7, 0x1f, 0xdb,
-  0x08, 0x40, 0x7b, 0x6a, 0x19, 0x5c, 0xc3, 0xdf, 0x54, 0x3a, 0x06, 0x06,
-  0x2f, 0xd9, 0x74, 0x46, 0x9b, 0x07, 0x27, 0x20, 0x02, 0xda, 0x60, 0x61,
-  0x00, 0xd7, 0x6f, 0x9a, 0xba, 0x7f, 0x20, 0x6b, 0xfa, 0x96, 0x77, 0x07,
-  0x40, 0x16, 0x2d, 0xbc, 0x66, 0xfd, 0xc0, 0x61, 0x01, 0xca, 0xff, 0xfe,
-  0x00, 0x24, 0x9e, 0x97, 0x2d, 0x84, 0xef, 0x97, 0x78, 0x8a, 0xe8, 0x4d,
-  0xfa, 0x0a, 0x8f, 0xd2, 0x10, 0xbb, 0x27, 0x48, 0xa3, 0xdc, 0x45, 0xf6,
-  0x11, 0xa2, 0xdc, 0xec, 0xe9, 0x91, 0x82, 0x45, 0xb6, 0x06, 0x17, 0x3c,
-  0x10, 0xb1, 0x1d, 0xd8, 0x74, 0x1f, 0x3d, 0x70, 0x3b, 0xc0, 0xdb, 0x50,
-  0x31, 0x8e, 0x1d, 0x74, 0x0a, 0xf0, 0x43, 0x8c, 0x21, 0x49, 0x90, 0x76,
-  0x28, 0x55, 0x6c, 0xc0, 0xa3, 0x99, 0x3e, 0x1b, 0xd4, 0xff, 0xb5, 0x0e,
-  0x59, 0x81, 0x89, 0xc9, 0x0a, 0x62, 0x8a, 0x4b, 0x03, 0x67, 0xb2, 0x07,
-  0x63, 0x86, 0x7e, 0xb3, 0x4b, 0x7c, 0x19, 0xd4, 0xaf, 0xb9, 0x20, 0x32,
-  0x12, 0xc0, 0x28, 0x18, 0x3f, 0xb3, 0x7e, 0x62, 0x55, 0xca, 0x7c, 0x44,
-  0x8c, 0xc6, 0x07, 0x58, 0xb7, 0x58, 0xcd, 0xdb, 0x25, 0x05, 0x80, 0xa3,
-  0x4b, 0x02, 0x30, 0x14, 0x64, 0x46, 0xb5, 0x5e, 0xb8, 0x03, 0x69, 0x03,
-  0x02, 0x12, 0x56, 0x26, 0x2c, 0x00, 0x8c, 0x39, 0xae, 0xd4, 0x42, 0x11,
-  0x8c, 0xe3, 0xe6, 0x74, 0x3f, 0xfc, 0x01, 0x63, 0x42, 0x26, 0x0e, 0x29,
-  0x2b, 0xa7, 0x0d, 0xe0, 0x32, 0x40, 0xd0, 0x62, 0x09, 0x0c, 0xca, 0x31,
-  0x2d, 0xc9, 0xdf, 0x00, 0xd6, 0x48, 0xaa, 0x38, 0x5a, 0x26, 0x19, 0x00,
-  0x0f, 0x03, 0xb8, 0xdf, 0x19, 0x15, 0xac, 0xd4, 0x09, 0x64, 0x22, 0x8b,
-  0xfe, 0x37, 0x14, 0xc1, 0xdc, 0x18, 0x76, 0x6a, 0xaa, 0x51, 0x9d, 0x7c,
-  0x8b, 0xd4, 0xf3, 0x02, 0x09, 0xd2, 0x0c, 0x04, 0x92, 0x5d, 0xdb, 0x21,
-  0xe0, 0x03, 0xa0, 0xe1, 0x8c, 0xeb, 0xdf, 0x3d, 0xe6, 0x26, 0x66, 0x13,
-  0x5c, 0xe2, 0x80, 0x30, 0xe4, 0x46, 0xdc, 0x03, 0xf4, 0x25, 0xc9, 0xf4,
-  0x22, 0x83, 0x0f, 0x04, 0x11, 0x97, 0xdc, 0x80, 0xfe, 0x66, 0xea, 0xe0,
-  0x08, 0x46, 0xea, 0x8a, 0xd0, 0x02, 0x46, 0xd6, 0x76, 0x11, 0x0a, 0x76,
-  0x48, 0x1b, 0x5b, 0x31, 0x10, 0x47, 0xd3, 0xda, 0x81, 0x10, 0x08, 0xc6,
-  0xcf, 0x09, 0xd0, 0x15, 0x47, 0xcb, 0xbe, 0x23, 0xeb, 0x08, 0xcd, 0xc7,
-  0xb7, 0x29, 0xeb, 0x13, 0x48, 0x06, 0xdd, 0xec, 0x0d, 0xec, 0x04, 0x66,
-  0xbb, 0xee, 0x35, 0xec, 0x1f, 0xfe, 0xf8, 0x33, 0xec, 0x23, 0xb3, 0x1b,
-  0x06, 0x1f, 0x6b, 0xed, 0x54, 0x6c, 0x16, 0x56, 0xc1, 0x19, 0xaf, 0xbd,
-  0x12, 0xf0, 0x42, 0xed, 0x95, 0xb6, 0x8b, 0xde, 0x2c, 0x28, 0x6d, 0xa1,
-  0x13, 0x34, 0x55, 0x27, 0xd0, 0x22, 0x08, 0xb6, 0x20, 0x0a, 0x70, 0xbc,
-  0x94, 0xb7, 0xa2, 0xb2, 0x1c, 0xad, 0xa8, 0x04, 0x84, 0x6a, 0x90, 0xba,
-  0xaf, 0xc6, 0x14, 0x21, 0x53, 0x38, 0x0d, 0x0f, 0xd7, 0xb9, 0x0c, 0x25,
-  0x1c, 0xe3, 0x31, 0xd3, 0x8e, 0x47, 0x88, 0x96, 0xf8, 0xac, 0x6c, 0x98,
-  0x00, 0x45, 0x85, 0x5e, 0xa0, 0xb1, 0x98, 0x14, 0x06, 0xd9, 0x2c, 0x19,
-  0x1a, 0x4e, 0xaa, 0x3d, 0x15, 0x8d, 0x18, 0xc1, 0x15, 0x80, 0xa8, 0x62,
-  0x28, 0x69, 0x9e, 0x16, 0x23, 0x54, 0x03, 0xfe, 0xaa, 0x40, 0x53, 0x5e,
-  0x9d, 0xa8, 0x30, 0x92, 0x87, 0xac, 0x01, 0x6a, 0x8d, 0x61, 0x00, 0x14,
-  0x20, 0xb9, 0x7c, 0x0a, 0xeb, 0x0f, 0x10, 0x08, 0xe2, 0x6f, 0xba, 0xc4,
-  0xeb, 0x00, 0x50, 0x96, 0xa3, 0x99, 0x4e, 0x95, 0xea, 0xd9, 0x02, 0xdf,
-  0xd9, 0x3b, 0xb8, 0x5d, 0xe8, 0x26, 0xee, 0xc7, 0xf3, 0x6a, 0x01, 0x25,
-  0x28, 0x8c, 0x78, 0x2c, 0x05, 0x09, 0x7a, 0xb9, 0x02, 0xac, 0x08, 0x69,
-  0xd9, 0xb6, 0x52, 0xa0, 0x4c, 0x7a, 0x19, 0xde, 0x72, 0x0c, 0x22, 0x2c,
-  0xce, 0x3c, 0x0c, 0x05, 0x91, 0xa4, 0xb7, 0x75, 0x0d, 0x06, 0x48, 0x10,
-  0x12, 0x21, 0x24, 0x03, 0x89, 0xd6, 0x16, 0x0c, 0x18, 0xaa, 0xea, 0xda,
-  0x05, 0xc0, 0xa8, 0x15, 0x48, 0x21, 0x75, 0x42, 0x60, 0xb2, 0xd9, 0x17,
-  0x24, 0xbd, 0xf7, 0x25, 0x9a, 0x89, 0x6d, 0x84, 0x04, 0xf8, 0x22, 0x48,
-  0x05, 0x17, 0x9a, 0x28, 0x15, 0x20, 0x4f, 0xe9, 0x2c, 0x05, 0x51, 0xb8,
-  0xe9, 0x38, 0x04, 0x6b, 0x14, 0x0d, 0x1f, 0x3c, 0x9a, 0x73, 0x44, 0xe2,
-  0xd3, 0x4d, 0x36, 0xd4, 0x16, 0x35, 0x6e, 0x13, 0x54, 0x15, 0x40, 0x95,
-  0x48, 0x8d, 0x21, 0xbf, 0x44, 0x4d, 0x11, 0x10, 0xa8, 0xeb, 0xf1, 0x13,
-  0x13, 0x1b, 0x39, 0x77, 0x3b, 0xdb, 0x38, 0x65, 0x70, 0x47, 0x67, 0xc9,
-  0x0e, 0x18, 0x88, 0xe6, 0x12, 0x21, 0x72, 0x73, 0x14, 0xd4, 0x9f, 0x7a,
-  0xfa, 0x8a, 0x95, 0x90, 0x3f, 0xdb, 0x1d, 0x00, 0x77, 0x80, 0x22, 0xe4,
-  0xaf, 0x48, 0xe3, 0xb6, 0x0f, 0x3b, 0x5b, 0x12, 0x1b, 0xa8, 0x0f, 0x90,
-  0xe8, 0xfe, 0x3d, 0x17, 0x00, 0x76, 0x6e, 0xcb, 0x30, 0x4b, 0x8e, 0x50,
-  0x60, 0x2e, 0x36, 0x50, 0x2a, 0x12, 0xed, 0x75, 0x76, 0x15, 0xda, 0x04,
-  0x1c, 0x2f, 0x10, 0x58, 0xef, 0x0e, 0x0c, 0x60, 0xe2, 0x4a, 0xcd, 0xa2,
-  0x96, 0xa2, 0xb2, 0xa7, 0x59, 0xe2, 0x32, 0x6f, 0x72, 0x10, 0x57, 0xb9,
-  0x21, 0x72, 0x10, 0x57, 0x97, 0x20, 0xce, 0x10, 0xdd, 0x50, 0x72, 0x2a,
-  0x86, 0x0b, 0xdd, 0x02, 0x77, 0x1e, 0xd2, 0xbf, 0x10, 0x36, 0x0f, 0x1b,
-  0x37, 0x0e, 0x0f, 0xb3, 0x0d, 0xb6, 0x0c, 0xea, 0x5e, 0xcb, 0x38, 0xb2,
-  0x50, 0x28, 0xdf, 0xda, 0xa8, 0x21, 0x72, 0x0c, 0x00, 0x72, 0x10, 0x44,
-  0xd8, 0x12, 0xb8, 0x57, 0x12, 0x20, 0x32, 0x12, 0x03, 0x12, 0x24, 0x32,
-  0x12, 0x47, 0x12, 0x20, 0xc9, 0x12, 0x72, 0xd5, 0x40, 0x32, 0x12, 0x46,
-  0x33, 0x32, 0x90, 0x16, 0x19, 0x16, 0x21, 0x90, 0x17, 0x0e, 0x16, 0x49,
-  0x90, 0x16, 0x19, 0x17, 0x03, 0xc8, 0x00, 0x16, 0x55, 0xd8, 0x16, 0x9e,
-  0x17, 0x18, 0x08, 0x35, 0x0c, 0x18, 0x80, 0xc9, 0x18, 0x0c, 0x18, 0x91,
-  0xc8, 0x18, 0x32, 0x18, 0x5e, 0x34, 0x16, 0x40, 0x85, 0xe2, 0x41, 0x87,
-  0x9b, 0xf1, 0x80, 0x4f, 0x18, 0x01, 0x42, 0x8e, 0x2d, 0x05, 0x6d, 0x0a,
-  0x20, 0x3a, 0xac, 0x49, 0xc8, 0x83, 0x35, 0x9e, 0xa6, 0x1c, 0xa2, 0x1e,
-  0xed, 0x46, 0x63, 0x16, 0x84, 0x48, 0x60, 0x85, 0x75, 0x9c, 0x1c, 0x4a,
-  0x72, 0xf1, 0x3e, 0x05, 0x76, 0x98, 0x72, 0x1a, 0x7e, 0x02, 0x72, 0x12,
-  0x88, 0x10, 0x8a, 0xf5, 0x72, 0x39, 0x15, 0xfa, 0xe2, 0x72, 0x32, 0x21,
-  0x79, 0x0e, 0xc0, 0xf1, 0x69, 0x09, 0xb0, 0x5c, 0x10, 0xcc, 0x79, 0x36,
-  0x26, 0xe0, 0x99, 0x00, 0x24, 0xca, 0x21, 0x12, 0x6b, 0x88, 0x42, 0xda,
-  0xec, 0x6f, 0xba, 0x9b, 0x2b, 0x65, 0x06, 0x23, 0xcc, 0xb3, 0x15, 0x61,
-  0xb0, 0x81, 0xb8, 0x1c, 0xed, 0x07, 0xea, 0x84, 0x53, 0xf8, 0x76, 0xfa,
-  0x57, 0x12, 0xe1, 0xb6, 0x2e, 0x12, 0xd8, 0xd5, 0x3c, 0x9a, 0x4e, 0x16,
-  0x79, 0x0b, 0xd0, 0x19, 0x3a, 0xf0, 0xe9, 0x3c, 0xfa, 0x06, 0x59, 0xd1,
-  0x25, 0xd0, 0xcd, 0x21, 0x08, 0x3d, 0x52, 0x91, 0x1f, 0xbb, 0x13, 0x28,
-  0x75, 0x1b, 0x61, 0x1e, 0x30, 0xc4, 0x72, 0x9d, 0x29, 0xc2, 0x07, 0xf4,
-  0xf9, 0x46, 0xc6, 0x88, 0xf4, 0x2c, 0x78, 0xcb, 0x84, 0xf9, 0x27, 0x22,
-  0x15, 0x24, 0x78, 0x33, 0xd2, 0x84, 0xf8, 0x23, 0x07, 0x53, 0x88, 0x4a,
-  0xf9, 0xe1, 0x9a, 0xb9, 0xde, 0xde, 0x21, 0xf9, 0x0b, 0x92, 0x9d, 0x26,
-  0xb2, 0x79, 0x06, 0x42, 0x58, 0x8a, 0xdf, 0x7e, 0xb3, 0x16, 0xeb, 0xb8,
-  0x10, 0x84, 0xf7, 0xcd, 0x0c, 0x0a, 0xdb, 0x74, 0x5b, 0x61, 0xdc, 0x20,
-  0x4a, 0x9a, 0x6b, 0x0e, 0x5b, 0x38, 0x34, 0x16, 0xb1, 0x62, 0x12, 0xf7,
-  0xa4, 0x59, 0x5e, 0xa9, 0x7b, 0x2c, 0x51, 0x97, 0x48, 0x24, 0x3a, 0x82,
-  0xcb, 0x35, 0x14, 0x56, 0xf3, 0x02, 0xaa, 0x93, 0x3e, 0x1e, 0x7f, 0x0a,
-  0xac, 0xa1, 0xe4, 0x3c, 0x2b, 0xe2, 0x08, 0xeb, 0x1b, 0x7c, 0x4b, 0x4b,
-  0x05, 0x15, 0x58, 0x91, 0x58, 0x9f, 0x77, 0xeb, 0x74, 0xe2, 0xe9, 0x2a,
-  0x04, 0x40, 0x96, 0xb5, 0x50, 0x81, 0xa8, 0xdd, 0x05, 0x24, 0xde, 0x2c,
-  0xdc, 0x47, 0xa4, 0x00, 0xb3, 0xd9, 0x05, 0x26, 0x4b, 0xca, 0x17, 0xd1,
-  0x52, 0xf9, 0x44, 0xf8, 0xe0, 0x89, 0x5e, 0xe2, 0xb0, 0x28, 0xad, 0xba,
-  0x69, 0x9b, 0x03, 0x0b, 0x64, 0x0a, 0x68, 0x10, 0x2c, 0x19, 0x0f, 0xe9,
-  0x70, 0xa8, 0x03, 0x44, 0x36, 0x45, 0x84, 0x40, 0xbd, 0x8a, 0x22, 0x15,
-  0xa0, 0x33, 0x43, 0x15, 0x60, 0x00, 0x6d, 0x54, 0x8e, 0x96, 0xdd, 0x0d,
-  0x9d, 0x1a, 0x60, 0x1c, 0x0c, 0x52, 0x8c, 0x0e, 0x00, 0x46, 0x3d, 0x4c,
-  0x14, 0x02, 0x90, 0xb2, 0x73, 0x1a, 0xe2, 0x80, 0xd9, 0x0a, 0xe4, 0x42,
-  0x7d, 0xa8, 0x76, 0x80, 0x3f, 0x62, 0x0c, 0x91, 0x8e, 0x1d, 0xc2, 0x34,
-  0x59, 0x91, 0x2d, 0xdd, 0xea, 0xa3, 0x02, 0xe9, 0xd1, 0x40, 0x05, 0x88,
-  0x6a, 0xa1, 0x3b, 0x2e, 0x5d, 0x6b, 0x58, 0x26, 0x0d, 0x15, 0x35, 0x27,
-  0x02, 0x81, 0xa1, 0x72, 0xa4, 0x5b, 0x66, 0x90, 0x5c, 0xb4, 0x00, 0x06,
-  0x7f, 0xd8, 0x7d, 0x02, 0x6e, 0x47, 0x34, 0x2c, 0x4b, 0x85, 0x88, 0x36,
-  0xc8, 0x7e, 0xca, 0x7f, 0x44, 0x1f, 0xc8, 0x67, 0x60, 0x16, 0x1b, 0x67,
-  0x55, 0x19, 0xfc, 0xa0, 0x12, 0x60, 0x38, 0x38, 0xcd, 0x79, 0x3c, 0x2c,
-  0xf6, 0xb4, 0x04, 0x52, 0x08, 0xd0, 0x17, 0x20, 0x0e, 0x1c, 0xbf, 0x78,
-  0xa3, 0x01, 0x28, 0x91, 0x51, 0x8b, 0x33, 0xae, 0x59, 0x7d, 0x4c, 0x3d,
-  0xcc, 0x4e, 0x0f, 0x44, 0x17, 0x3c, 0x5e, 0x81, 0x6c, 0x4b, 0x0d, 0xcc,
-  0x5a, 0x4e, 0x85, 0xac, 0xdd, 0x97, 0x0f, 0x88, 0x17, 0x3c, 0xa3, 0x81,
-  0x0a, 0xdd, 0xda, 0x75, 0x5a, 0x00, 0x88, 0xe8, 0x89, 0x9c, 0x0e, 0xfc,
-  0x08, 0xc1, 0xcc, 0x90, 0xf0, 0x58, 0x5d, 0x0c, 0xce, 0x8c, 0xe1, 0x81,
-  0x4e, 0x74, 0x47, 0x83, 0x19, 0x84, 0x40, 0xe8, 0xed, 0x0c, 0x9b, 0x90,
-  0x57, 0x2d, 0x20, 0x32, 0x9b, 0x10, 0x04, 0x5e, 0xb9, 0x10, 0xd1, 0x2c,
-  0x6f, 0x92, 0x63, 0xeb, 0x7b, 0x09, 0x90, 0x8c, 0xf4, 0x21, 0x8c, 0x63,
-  0x38, 0xa9, 0x19, 0xda, 0xcd, 0x3b, 0x37, 0x60, 0x64, 0x5b, 0x3f, 0x00,
-  0xf4, 0xcb, 0x01, 0x88, 0x37, 0x1f, 0x72, 0x03, 0x01, 0x09, 0x72, 0xac,
-  0x96, 0xfa, 0xe9, 0xef, 0xfc, 0x80, 0x10, 0xdb, 0xf1, 0x87, 0x00, 0x93,
-  0xc2, 0x7d, 0x14, 0x12, 0x66, 0x0c, 0xe2, 0x00, 0x1f, 0xc4, 0x74, 0xac,
-  0x6d, 0x20, 0x07, 0x8b, 0x4e, 0x45, 0x43, 0x85, 0x56, 0x8b, 0x5d, 0x20,
-  0x23, 0x65, 0x31, 0x2e, 0xcb, 0x04, 0x18, 0x78, 0x30, 0x03, 0x30, 0x0d,
-  0xe8, 0x0c, 0x90, 0x5e, 0xa5, 0x95, 0x43, 0xbe, 0x5f, 0x89, 0x26, 0x45,
-  0xed, 0x89, 0x57, 0x1e, 0xd9, 0x09, 0x0d, 0x32, 0x49, 0x05, 0xe4, 0x79,
-  0x01, 0x86, 0x07, 0x55, 0x03, 0x1d, 0xb0, 0xf9, 0xac, 0x21, 0x2a, 0x22,
-  0x12, 0x88, 0xe2, 0x56, 0x3b, 0xd6, 0x1c, 0x31, 0x40, 0x6c, 0x70, 0x2f,
-  0x49, 0x17, 0x5a, 0x05, 0xff, 0xa0, 0x14, 0x6f, 0x86, 0xd8, 0xff, 0x9f,
-  0x58, 0xa0, 0x18, 0x12, 0xd8, 0x42, 0xe8, 0xdd, 0xff, 0x32, 0x83, 0xf4,
-  0xfe, 0x05, 0x7c, 0xcc, 0x11, 0x96, 0xb6, 0x31, 0xcd, 0x55, 0x13, 0xee,
-  0x59, 0x12, 0x48, 0x13, 0x5c, 0x34, 0x0e, 0x01, 0x06, 0xe0, 0x57, 0x09,
-  0x10, 0x0a, 0x5a, 0xdd, 0x54, 0x7c, 0xc0, 0x50, 0xc0, 0x99, 0x0b, 0x52,
-  0x05, 0xea, 0x54, 0x22, 0x4a, 0x32, 0x91, 0x23, 0x48, 0x9c, 0x10, 0x64,
-  0x24, 0x32, 0xff, 0x71, 0xe2, 0x45, 0xf7, 0xb7, 0x74, 0x9a, 0x61, 0x60,
-  0x89, 0x00, 0x44, 0xd3, 0x43, 0xd8, 0xc8, 0xf8, 0x07, 0xb7, 0x2d, 0xd8,
-  0x10, 0x27, 0x0a, 0x4e, 0x64, 0xc6, 0xb2, 0x31, 0x98, 0xff, 0x46, 0x50,
-  0x12, 0xcb, 0xc2, 0x98, 0x07, 0x6c, 0x3c, 0x79, 0x01, 0x1d, 0xa4, 0x10,
-  0xd1, 0x7c, 0x9b, 0x10, 0x91, 0x17, 0xea, 0x72, 0x84, 0x8c, 0x6c, 0xc2,
-  0x26, 0x11, 0x32, 0x64, 0x04, 0x77, 0x56, 0x4d, 0x42, 0x23, 0xba, 0x44,
-  0xce, 0x68, 0xce, 0x36, 0xd7, 0x10, 0x5a, 0xe4, 0x0e, 0xd4, 0x59, 0x03,
-  0xe2, 0x1e, 0x31, 0x02, 0x12, 0x2e, 0xe3, 0xbc, 0xc9, 0xde, 0x11, 0x02,
-  0x4d, 0xac, 0xe8, 0x0c, 0xa9, 0xe2, 0x2d, 0x12, 0xce, 0x4a, 0x23, 0x0c,
-  0xd1, 0x20, 0xc0, 0x4a, 0x80, 0xc0, 0xa1, 0xdd, 0xa0, 0x0b, 0xff, 0x80,
-  0x7a, 0xf6, 0x20, 0x7d, 0x04, 0xc6, 0x42, 0xc4, 0xf6, 0x3f, 0x1f, 0x21,
-  0xf0, 0x67, 0x13, 0xf2, 0x23, 0xf2, 0x3c, 0x03, 0xac, 0x34, 0x58, 0x54,
-  0xd1, 0x1e, 0xd7, 0x87, 0x05, 0x75, 0x82, 0x2b, 0x59, 0x37, 0x2d, 0x47,
-  0x3f, 0xd7, 0x31, 0x89, 0x09, 0x35, 0x13, 0x60, 0x34, 0x12, 0x85, 0x71,
-  0xbb, 0x51, 0x61, 0xa1, 0x60, 0x82, 0xb8, 0x5f, 0x42, 0x9b, 0x18, 0xa0,
-  0x32, 0xcc, 0x2e, 0xe0, 0x2d, 0x81, 0xc7, 0xfd, 0x00, 0x41, 0x02, 0x07,
-  0xda, 0x11, 0x2d, 0x08, 0x18, 0x08, 0xdd, 0x22, 0x42, 0x98, 0xec, 0x56,
-  0x19, 0xac, 0x48, 0x95, 0x0c, 0x0d, 0x8c, 0x23, 0x00, 0x23, 0x12, 0x1c,
-  0x65, 0x2a, 0x69, 0xab, 0x06, 0xe9, 0x94, 0xa5, 0x14, 0x59, 0xfe, 0x3b,
-  0xc6, 0x14, 0x03, 0x74, 0x41, 0x01, 0x00, 0x65, 0x85, 0x2d, 0x47, 0xb0,
-  0xbf, 0x6c, 0x07, 0x79, 0x01, 0x24, 0x32, 0x0c, 0x77, 0x05, 0x06, 0x35,
-  0x13, 0x85, 0x71, 0x21, 0x6f, 0x9a, 0x96, 0xe9, 0x4e, 0xd1, 0x0d, 0xea,
-  0x01, 0x42, 0x50, 0xd0, 0x44, 0x98, 0x0d, 0x80, 0x92, 0x21, 0x09, 0x08,
-  0x84, 0xd5, 0x3d, 0x1f, 0x5d, 0x37, 0x6c, 0x65, 0xd0, 0xac, 0x2c, 0xad,
-  0x25, 0x56, 0x80, 0xa4, 0x00, 0xf8, 0x0b, 0xeb, 0xca, 0x8c, 0x9b, 0xd1,
-  0x7a, 0x8a, 0x2c, 0xd7, 0x88, 0xfe, 0x1e, 0x32, 0xa3, 0x20, 0x32, 0xc3,
-  0x24, 0x05, 0x78, 0x3c, 0x45, 0x12, 0x03, 0x23, 0x0c, 0xc7, 0x99, 0xde,
-  0x27, 0xf6, 0x46, 0x8a, 0xe9, 0xbb, 0xc7, 0x9e, 0x03, 0x5b, 0x0b, 0xde,
-  0x54, 0xd7, 0xce, 0x95, 0x08, 0x80, 0x1e, 0x52, 0xdf, 0x28, 0x0f, 0x30,
-  0x9d, 0xe0, 0xae, 0x11, 0x23, 0xdd, 0x96, 0x02, 0x14, 0x20, 0x55, 0x74,
-  0xf8, 0x02, 0x51, 0x80, 0xd5, 0x62, 0x02, 0x1d, 0x6b, 0x63, 0x9c, 0x53,
-  0xb8, 0x03, 0x56, 0x42, 0x6a, 0x89, 0xa2, 0x9b, 0x51, 0xdb, 0x91, 0x00,
-  0xbf, 0x44, 0x3c, 0x75, 0x3e, 0x13, 0x57, 0x52, 0x17, 0x73, 0xcf, 0xd5,
-  0xd4, 0x68, 0x04, 0x30, 0x2a, 0x10, 0x15, 0xd8, 0xef, 0xfe, 0x18, 0x84,
-  0xf7, 0x03, 0x40, 0x8f, 0xf8, 0x2f, 0x19, 0xeb, 0xb3, 0x3c, 0x3d, 0xc8,
-  0x38, 0x19, 0x13, 0x62, 0x92, 0x19, 0x06, 0x94, 0xd6, 0x1c, 0xf7, 0x12,
-  0xab, 0x23, 0xe9, 0x3e, 0xc5, 0xdb, 0x1b, 0x34, 0x23, 0xe6, 0x51, 0x93,
-  0x6e, 0x36, 0x0a, 0x40, 0xd0, 0x03, 0xac, 0x47, 0x30, 0x58, 0xea, 0x4f,
-  0x52, 0x04, 0xe1, 0xa2, 0x14, 0x41, 0xfe, 0xb7, 0x15, 0xe7, 0x64, 0x02,
-  0x08, 0x1a, 0x39, 0xb0, 0x00, 0x07, 0xa7, 0x00, 0x67, 0x6e, 0xa0, 0x21,
-  0x82, 0xc9, 0x89, 0xb2, 0x1a, 0x6c, 0x15, 0x59, 0xfb, 0x36, 0x73, 0x15,
-  0xea, 0xa9, 0x19, 0xb0, 0xc9, 0xa6, 0x54, 0xc8, 0x52, 0x64, 0xfc, 0xd9,
-  0xbb, 0x41, 0xec, 0x59, 0xfe, 0xb8, 0x1c, 0xa6, 0x01, 0xcf, 0x08, 0x9a,
-  0x9d, 0xe0, 0xfc, 0xc1, 0x94, 0x01, 0x9c, 0xc5, 0x95, 0xc8, 0x1d, 0x46,
-  0xed, 0x51, 0x5d, 0x01, 0x91, 0xc4, 0x2e, 0x21, 0xb2, 0x3b, 0x58, 0x36,
-  0xc7, 0x54, 0x6e, 0xac, 0xc5, 0xe7, 0x00, 0x52, 0x8b, 0x8a, 0x0b, 0xc3,
-  0xeb, 0x09, 0xa7, 0x1b, 0xc6, 0x2c, 0x60, 0x41, 0x6f, 0x3c, 0x39, 0x8a,
-  0x42, 0xde, 0xba, 0x98, 0x54, 0xce, 0x55, 0x00, 0x82, 0xa3, 0x80, 0x58,
-  0x23, 0x19, 0x15, 0x80, 0xbb, 0x28, 0x73, 0x06, 0x05, 0xbb, 0x05, 0x75,
-  0x0d, 0x21, 0xc1, 0x44, 0x61, 0x33, 0x81, 0x93, 0x5a, 0x36, 0xc4, 0x3f,
-  0x08, 0xac, 0xd9, 0xc2, 0x41, 0xc8, 0xe6, 0x13, 0xe6, 0x23, 0xe6, 0x23,
-  0xe6, 0x20, 0x72, 0xe6, 0x4c, 0x03, 0xa8, 0x3e, 0xa4, 0x4b, 0x12, 0xd6,
-  0x2e, 0x28, 0x10, 0xaa, 0x0b, 0xc0, 0xae, 0xfc, 0x66, 0x6a, 0xbd, 0x8b,
-  0x21, 0xf8, 0x0a, 0xf5, 0x1c, 0x19, 0x08, 0x16, 0x00, 0x60, 0xa5, 0x65,
-  0xaf, 0x80, 0x12, 0x97, 0x24, 0x41, 0xe9, 0x72, 0xcc, 0xd5, 0x12, 0x9e,
-  0x3b, 0x46, 0x56, 0xc8, 0x65, 0xde, 0x65, 0x3d, 0x80, 0x10, 0xe2, 0x40,
-  0xe8, 0x11, 0x2e, 0xd7, 0x91, 0x1e, 0xa4, 0x17, 0xa7, 0x35, 0x42, 0x1a,
-  0x16, 0xc3, 0x26, 0x9c, 0x80, 0x7e, 0x6b, 0x76, 0xff, 0x21, 0x4a, 0x11,
-  0x00, 0xec, 0x90, 0x33, 0x64, 0xe3, 0x8d, 0x45, 0x5a, 0xd1, 0x00, 0x48,
-  0xf4, 0x10, 0x21, 0x1a, 0x52, 0x10, 0x21, 0x31, 0x32, 0x09, 0x0c, 0xb4,
-  0xd6, 0xa1, 0xa0, 0xf5, 0x98, 0x02, 0x98, 0xc8, 0xd1, 0x02, 0x89, 0x1f,
-  0x22, 0xe2, 0xa0, 0x31, 0x4c, 0x93, 0x1d, 0x90, 0x15, 0xe1, 0x73, 0x3f,
-  0xc4, 0x63, 0x4f, 0x7a, 0x04, 0x9c, 0x09, 0x24, 0x46, 0x4c, 0x04, 0xc8,
-  0x5b, 0x0c, 0x4e, 0x6c, 0x2f, 0xec, 0x90, 0x3d, 0x2b, 0xb2, 0xe5, 0xd1,
-  0x2d, 0x8a, 0x11, 0xc2, 0xf4, 0x12, 0xd1, 0x2f, 0x61, 0xff, 0x18, 0x32,
-  0x23, 0x30, 0x28, 0x34, 0x01, 0x24, 0xa3, 0x1a, 0x9e, 0x15, 0x22, 0x08,
-  0xb0, 0xa6, 0x3e, 0xa3, 0x0c, 0x1a, 0x0d, 0x7a, 0xed, 0x0e, 0x1a, 0xa1,
-  0x06, 0xca, 0x0b, 0x06, 0x28, 0x71, 0x3d, 0x04, 0xec, 0x6a, 0x4a, 0x02,
-  0x6c, 0x4d, 0x36, 0x1c, 0x74, 0x41, 0x51, 0xb0, 0x89, 0x1a, 0x07, 0x39,
-  0x41, 0x1a, 0x11, 0x21, 0xea, 0xb5, 0x15, 0xad, 0x03, 0x1d, 0x11, 0x9e,
-  0x98, 0xb1, 0x01, 0x6b, 0x14, 0x15, 0x0d, 0x48, 0xde, 0x2a, 0x5c, 0xd0,
-  0x0c, 0x1a, 0xad, 0x05, 0x99, 0x0e, 0x84, 0x75, 0xd8, 0x56, 0x57, 0x20,
-  0xa8, 0xd9, 0x7a, 0x85, 0x21, 0x15, 0x30, 0x72, 0xbe, 0xf3, 0x0b, 0x7e,
-  0x06, 0xeb, 0x28, 0xe8, 0x86, 0x65, 0x30, 0xd6, 0x0c, 0x45, 0x49, 0xce,
-  0x62, 0x5e, 0xa3, 0x40, 0xeb, 0xd8, 0x20, 0x2c, 0x2e, 0x00, 0xdb, 0x2b,
-  0xb0, 0x61, 0xbf, 0x6a, 0x84, 0x2d, 0xb4, 0x87, 0xc6, 0xa1, 0xba, 0x10,
-  0xf3, 0x12, 0x5b, 0x1b, 0x23, 0x66, 0x12, 0x68, 0x0d, 0x21, 0x7c, 0xdf,
-  0xcd, 0x10, 0x23, 0x12, 0x30, 0x43, 0x17, 0xb2, 0x1b, 0xf1, 0x05, 0x42,
-  0xd4, 0x1a, 0xa9, 0x4c, 0x25, 0x91, 0xea, 0xa8, 0x6d, 0x57, 0x02, 0x02,
-  0x53, 0x09, 0x28, 0x32, 0x99, 0x40, 0x42, 0x9a, 0x5c, 0x7f, 0x94, 0x78,
-  0x74, 0x4d, 0x00, 0x1b, 0x07, 0x75, 0x12, 0x6a, 0x05, 0x94, 0xec, 0x5a,
-  0x1b, 0xe4, 0x48, 0x46, 0x03, 0xce, 0x02, 0xf0, 0x17, 0x04, 0x2d, 0xd8,
-  0x06, 0xfa, 0x19, 0x76, 0x0f, 0x02, 0xdd, 0x55, 0x40, 0x99, 0xf1, 0x1e,
-  0x01, 0xb6, 0xe0, 0x11, 0x1d, 0xb3, 0x28, 0x91, 0x01, 0x55, 0x25, 0xea,
-  0xd5, 0x08, 0x86, 0x33, 0x02, 0x10, 0x3e, 0x06, 0x73, 0x43, 0xde, 0x69,
-  0xff, 0x3f, 0x0a, 0xac, 0x3c, 0xe0, 0x11, 0xa8, 0xc2, 0x33, 0x45, 0x40,
-  0xaf, 0xd7, 0x1c, 0x09, 0x88, 0x8c, 0x82, 0xd4, 0x04, 0xb2, 0xb2, 0x12,
-  0x16, 0xdd, 0x43, 0x0c, 0x01, 0x40, 0x92, 0xf3, 0xcb, 0x81, 0x01, 0x19,
-  0x96, 0x72, 0xd3, 0x00, 0x3b, 0x9e, 0x00, 0xfe, 0x19, 0x0e, 0x15, 0x57,
-  0x86, 0x4e, 0x02, 0xf9, 0xfa, 0x58, 0x05, 0x01, 0x9a, 0x5d, 0x08, 0xc4,
-  0x89, 0x14, 0xd0, 0x35, 0x12, 0x45, 0x85, 0x72, 0xb0, 0x35, 0xc1, 0x12,
-  0xad, 0x1a, 0x81, 0x4b, 0xd9, 0x26, 0x78, 0xdf, 0x03, 0xf8, 0xda, 0x0e,
-  0x5d, 0x41, 0x99, 0x01, 0xb0, 0x29, 0x11, 0x11, 0x24, 0x17, 0xb0, 0x47,
-  0x06, 0x01, 0x70, 0x81, 0x4f, 0x1c, 0x1f, 0x92, 0x2d, 0xb0, 0x54, 0x48,
-  0xbf, 0x18, 0x28, 0x92, 0xfe, 0xea, 0x37, 0x82, 0x43, 0xb2, 0xd0, 0x74,
-  0x14, 0x60, 0x5c, 0x6c, 0x73, 0x15, 0x41, 0x64, 0x07, 0x80, 0x11, 0x2e,
-  0x65, 0x67, 0xea, 0x12, 0x99, 0xa2, 0x6c, 0xa6, 0x4e, 0x0a, 0x04, 0x06,
-  0xf7, 0x3c, 0xfe, 0x77, 0xb6, 0xa1, 0x39, 0x76, 0x77, 0xaf, 0x68, 0x4d,
-  0x0c, 0xd2, 0xa7, 0x01, 0x61, 0x89, 0x2d, 0x84, 0x7c, 0xc6, 0x46, 0x7c,
-  0x43, 0x06, 0x25, 0x2a, 0x83, 0xca, 0x38, 0x01, 0x5b, 0x5e, 0x11, 0x3d,
-  0x59, 0x0b, 0xfa, 0xd1, 0xe2, 0xd1, 0xd0, 0x89, 0xd3, 0x16, 0x8b, 0x5c,
-  0x0e, 0x90, 0xc9, 0xa7, 0xc0, 0xa0, 0x40, 0x9a, 0x1f, 0x92, 0xc8, 0x2b,
-  0x88, 0x22, 0xa1, 0x5a, 0x2d, 0x94, 0x2c, 0xa0, 0x89, 0xd7, 0xec, 0x10,
-  0x5d, 0x9a, 0x14, 0x40, 0x86, 0x45, 0x6a, 0x70, 0x28, 0x31, 0x69, 0x61,
-  0xef, 0xba, 0x0e, 0xf2, 0x13, 0x4b, 0x10, 0x8a, 0x8c, 0xc1, 0x02, 0x12,
-  0x40, 0xa2, 0xbe, 0x82, 0xb8, 0x35, 0x00, 0xba, 0x03, 0xda, 0x04, 0x02,
-  0xb0, 0xa3, 0x30, 0x0b, 0x1c, 0x34, 0x9d, 0x01, 0x95, 0x21, 0x80, 0x40,
-  0x1c, 0xe3, 0x73, 0xd3, 0x33, 0xa4, 0xfd, 0xa4, 0x14, 0x4f, 0x4d, 0xeb,
-  0x84, 0x51, 0x67, 0x2e, 0x1e, 0xd0, 0x7b, 0x94, 0x68, 0xc4, 0x41, 0x04,
-  0x84, 0xdb, 0x7e, 0xca, 0x06, 0x49, 0x15, 0x54, 0x5d, 0x65, 0x09, 0x22,
-  0x8b, 0xf9, 0x45, 0xd8, 0x1d, 0x97, 0x00, 0xc0, 0x7b, 0xf6, 0xeb, 0x68,
-  0x63, 0x68, 0x8a, 0xc5, 0x24, 0x80, 0x69, 0x7b, 0xfe, 0xc1, 0x6b, 0x0f,
-  0x31, 0x56, 0x04, 0x08, 0xea, 0x58, 0x10, 0x05, 0x7c, 0x0e, 0xe8, 0xc6,
-  0xfd, 0x04, 0x0c, 0xf9, 0xdb, 0x56, 0x11, 0x55, 0x57, 0x4f, 0x88, 0x22,
-  0x43, 0x5c, 0x18, 0xe5, 0x0c, 0x02, 0x80, 0xf1, 0x06, 0x16, 0x1a, 0xd2,
-  0xe6, 0x21, 0xf0, 0x09, 0x3b, 0x16, 0x6a, 0x3c, 0x82, 0x16, 0x95, 0x16,
-  0x4b, 0x01, 0xe2, 0xf6, 0x10, 0x29, 0x0c, 0x1f, 0x77, 0x7b, 0x10, 0x85,
-  0x6b, 0x22, 0x1e, 0x45, 0x50, 0x59, 0x3c, 0x54, 0x20, 0x82, 0x22, 0x10,
-  0x1a, 0x1c, 0x6b, 0x07, 0x27, 0x15, 0xea, 0x28, 0x27, 0x85, 0x91, 0x08,
-  0xc7, 0xeb, 0xa4, 0x35, 0xf1, 0x1e, 0xeb, 0x19, 0x0f, 0x21, 0xbf, 0x25,
-  0x36, 0xa8, 0xa0, 0x13, 0x20, 0x1d, 0x80, 0xe0, 0x24, 0x4d, 0x28, 0x4d,
-  0x9b, 0x00, 0x74, 0x0a, 0xea, 0xb6, 0x1d, 0x8b, 0x6c, 0x32, 0xa5, 0x2c,
-  0xdb, 0x0e, 0x65, 0x86, 0x83, 0x18, 0x79, 0x18, 0x1a, 0x01, 0x3b, 0xa1,
-  0x09, 0x58, 0x66, 0x35, 0x48, 0xb2, 0xfa, 0xfe, 0x48, 0x12, 0x13, 0xe3,
-  0xec, 0xac, 0xe7, 0xee, 0x96, 0xb8, 0xca, 0x5a, 0xcc, 0x20, 0x12, 0xce,
-  0xc0, 0x41, 0x90, 0xa5, 0xed, 0x31, 0x04, 0x1c, 0x92, 0x01, 0x65, 0xd2,
-  0x96, 0xd4, 0xd2, 0x58, 0xd4, 0xa8, 0xc3, 0x3d, 0x44, 0x18, 0xf1, 0xe9,
-  0xeb, 0xd4, 0x30, 0x6a, 0xd2, 0xa3, 0x63, 0xf6, 0x80, 0x00, 0x2d, 0x4e,
-  0xce, 0x89, 0x8a, 0xf6, 0xc0, 0x2d, 0xf2, 0xd0, 0x75, 0x15, 0x12, 0x8a,
-  0xc7, 0x38, 0xeb, 0xc3, 0x54, 0x65, 0xe8, 0x6a, 0x8c, 0xdd, 0x0d, 0xb2,
-  0x42, 0xc4, 0xcb, 0xc6, 0xc4, 0x2f, 0xc6, 0x75, 0x23, 0x20, 0x0b, 0x0c,
-  0x26, 0xd0, 0x5f, 0xce, 0xe9, 0x72, 0xff, 0x48, 0x75, 0x72, 0xb8, 0xc8,
-  0xba, 0x72, 0xbc, 0xd6, 0xbe, 0x82, 0xcf, 0xc8, 0xd4, 0x6c, 0x10, 0xd2,
-  0xb2, 0xc0, 0xd2, 0xc2, 0x5f, 0x0c, 0xca, 0xb3, 0xc6, 0x48, 0x81, 0x02,
-  0x34, 0x54, 0x45, 0x6d, 0x54, 0x7e, 0xb6, 0x36, 0x74, 0x77, 0x55, 0xe2,
-  0xf6, 0x02, 0x81, 0x6d, 0x25, 0x43, 0xf4, 0x82, 0xbd, 0x46, 0x06, 0x39,
-  0x08, 0x1d, 0xd3, 0x10, 0x19, 0xed, 0x1b, 0x5d, 0x74, 0x88, 0x01, 0x56,
-  0x27, 0x28, 0x80, 0xe9, 0xd8, 0xe6, 0xa4, 0x38, 0x1b, 0xde, 0xa2, 0x6d,
-  0xe0, 0x1b, 0x96, 0xde, 0xe0, 0x87, 0xd8, 0xa2, 0x01, 0x03, 0xc3, 0x10,
-  0x60, 0x6c, 0xa2, 0x09, 0xc5, 0x10, 0x55, 0x8b, 0x0d, 0x0b, 0x6a, 0xda,
-  0x35, 0x02, 0x05, 0x5b, 0xde, 0xd6, 0x26, 0xcf, 0xa7, 0x88, 0x06, 0x04,
-  0x7a, 0x46, 0x2b, 0xae, 0x16, 0x89, 0x62, 0x04, 0xa3, 0x8c, 0x42, 0xe7,
-  0x88, 0xa5, 0xa2, 0x64, 0x22, 0xec, 0xfc, 0x50, 0xc9, 0xd8, 0xdc, 0x36,
-  0xf1, 0x41, 0x32, 0x10, 0x6a, 0x49, 0x1e, 0x04, 0x52, 0xf0, 0x07, 0x10,
-  0xa2, 0x01, 0x48, 0xd4, 0x5a, 0x13, 0x35, 0x65, 0x16, 0x37, 0x47, 0x08,
-  0x33, 0x19, 0x64, 0xe2, 0xa4, 0x41, 0x60, 0x48, 0x85, 0x5f, 0x45, 0x81,
-  0xbb, 0x6d, 0x1a, 0x90, 0xad, 0xbd, 0xf2, 0x07, 0xec, 0x94, 0x1a, 0xe3,
-  0x92, 0xc4, 0x01, 0x41, 0x80, 0xe9, 0x84, 0xd5, 0xad, 0x00, 0x08, 0x15,
-  0x13, 0x3d, 0x66, 0xda, 0x22, 0x8c, 0x49, 0xc2, 0xdf, 0x51, 0xb2, 0x0c,
-  0x65, 0xc6, 0xf1, 0xc4, 0xe9, 0x0d, 0xfd, 0x8d, 0x15, 0x7b, 0x96, 0x42,
-  0x88, 0x0e, 0xd4, 0xcf, 0xda, 0xfd, 0x51, 0x09, 0x8d, 0x4c, 0xbe, 0x98,
-  0x4a, 0x64, 0xec, 0xcb, 0xcf, 0x62, 0x0c, 0xd9, 0x43, 0xdc, 0x64, 0xda,
-  0xd1, 0x62, 0x88, 0xd9, 0xd0, 0xd8, 0x64, 0xd6, 0xda, 0x5b, 0xc2, 0x66,
-  0x7d, 0xeb, 0x6d, 0x9a, 0xbf, 0x73, 0x7f, 0x7a, 0x0b, 0xa2, 0x82, 0x03,
-  0xe7, 0x1b, 0x52, 0x7a, 0x02, 0x87, 0xe9, 0x2a, 0x84, 0xfd, 0x0b, 0x83,
-  0x08, 0x32, 0x48, 0x74, 0x18, 0x41, 0x25, 0x27, 0x7d, 0x3a, 0x56, 0x57,
-  0x10, 0x09, 0x20, 0x08, 0x8c, 0x45, 0x8b, 0xf0, 0xc8, 0x01, 0x0b, 0xff,
-  0x00, 0xb2, 0x1b, 0xb1, 0x03, 0xa4, 0x26, 0x73, 0x49, 0xeb, 0x32, 0xeb,
-  0x05, 0xc8, 0x71, 0x52, 0x8a, 0x84, 0x82, 0xb0, 0x00, 0xef, 0x1b, 0x0c,
-  0x16, 0x88, 0x48, 0x00, 0xdc, 0x29, 0x5f, 0x0c, 0x18, 0xb9, 0x70, 0xe6,
-  0x61, 0xb7, 0xc2, 0x0a, 0x75, 0x20, 0x6a, 0x0c, 0x29, 0x28, 0xb3, 0x0e,
-  0x78, 0x28, 0x82, 0x8c, 0xa5, 0xd0, 0x86, 0x2f, 0x06, 0xd0, 0x90, 0xc6,
-  0x8d, 0xbb, 0xc3, 0x22, 0xff, 0x32, 0x37, 0x94, 0xd0, 0x08, 0x64, 0x68,
-  0xab, 0xf5, 0x65, 0x20, 0x60, 0x19, 0x68, 0x33, 0x8f, 0x50, 0x7b, 0x85,
-  0x50, 0xd5, 0x78, 0xc0, 0x2a, 0x42, 0xf5, 0xe8, 0xce, 0x3a, 0x7a, 0xec,
-  0x42, 0xe7, 0xf0, 0x90, 0xf0, 0x39, 0xec, 0xe4, 0xec, 0x9b, 0xec, 0x4f,
-  0x37, 0x70, 0x0e, 0xac, 0xc4, 0x26, 0x03, 0x5a, 0x41, 0xf4, 0x78, 0x18,
-  0x82, 0x6c, 0x88, 0xc5, 0x8b, 0xf2, 0x90, 0x0d, 0xe2, 0xd5, 0xca, 0xfa,
-  0xea, 0x14, 0x22, 0xcc, 0x3d, 0x50, 0xd2, 0xbe, 0xf8, 0xad, 0x0c, 0x08,
-  0x3a, 0x3a, 0x08, 0x03, 0x14, 0x83, 0x1e, 0x04, 0x20, 0x83, 0x67, 0xd1,
-  0x05, 0x91, 0xbf, 0x53, 0x0c, 0x10, 0x45, 0x84, 0x62, 0x8c, 0x7b, 0x68,
-  0x17, 0xd5, 0x36, 0x3d, 0xe0, 0xda, 0x82, 0x49, 0x24, 0x4a, 0x9a, 0xf8,
-  0x24, 0xd6, 0x2e, 0x12, 0x78, 0x14, 0x79, 0x5b, 0xf4, 0x21, 0x91, 0xf8,
-  0x90, 0xf8, 0x99, 0xf4, 0x19, 0xf4, 0x05, 0xef, 0x69, 0xa2, 0x56, 0x4a,
-  0x7c, 0x81, 0x3f, 0xf2, 0x0b, 0xaf, 0x3d, 0x0e, 0xdb, 0x20, 0x81, 0x15,
-  0x0b, 0x62, 0x5b, 0xc5, 0x7b, 0x85, 0x30, 0xb6, 0x09, 0x03, 0x36, 0x9c,
-  0x40, 0xe0, 0x2b, 0x80, 0x8a, 0xca, 0x0e, 0x82, 0x30, 0xe8, 0xd8, 0x0d,
-  0xd9, 0x0f, 0x30, 0x7b, 0x06, 0xc4, 0x2e, 0x78, 0x8c, 0xc2, 0x07, 0x5f,
-  0xc1, 0x07, 0x8b, 0xd8, 0x8e, 0x87, 0xc2, 0x70, 0x14, 0x42, 0xc6, 0x73,
-  0x2a, 0x41, 0xf6, 0x0b, 0xa6, 0x1a, 0x92, 0x1a, 0x41, 0x15, 0x30, 0xb4,
-  0x82, 0x4b, 0x36, 0x45, 0x21, 0xa3, 0x5e, 0x4e, 0x01, 0x00, 0xb3, 0x34,
-  0xab, 0x08, 0xe7, 0xd3, 0x1e, 0x44, 0xeb, 0x12, 0x0e, 0x46, 0x32, 0xd4,
-  0xdb, 0x1d, 0xcd, 0x22, 0x21, 0x3e, 0x03, 0x0c, 0x62, 0x2b, 0x2d, 0x73,
-  0x22, 0x1a, 0x48, 0xd6, 0x0c, 0x33, 0x30, 0x65, 0xad, 0x61, 0xc9, 0x27,
-  0x1a, 0x1c, 0x19, 0x40, 0x09, 0x0b, 0x33, 0x0e, 0x78, 0x09, 0xf6, 0x46,
-  0xe1, 0x09, 0x17, 0x70, 0xbf, 0x01, 0x09, 0xc1, 0x0b, 0x86, 0xd1, 0x59,
-  0x68, 0x16, 0x26, 0x44, 0xb0, 0xff, 0xc2, 0x67, 0x06, 0xd9, 0x74, 0x6e,
-  0xc0, 0x02, 0xd5, 0x2c, 0xac, 0x6b, 0xc1, 0x23, 0x92, 0x2b, 0xb9, 0x23,
-  0x0a, 0x58, 0xb1, 0x22, 0x2e, 0xcd, 0x41, 0x6a, 0xda, 0x80, 0x9c, 0x59,
-  0x55, 0x58, 0xed, 0x58, 0xa1, 0xee, 0x38, 0x5e, 0x68, 0x99, 0x37, 0x81,
-  0x7d, 0xd8, 0xc0, 0x5f, 0x0b, 0x00, 0x28, 0xa6, 0x0b, 0x55, 0x08, 0xc4,
-  0x33, 0x30, 0xcd, 0xf4, 0x34, 0x3c, 0x08, 0x98, 0x0a, 0xcb, 0xbc, 0x14,
-  0x64, 0xc2, 0xa0, 0x16, 0x86, 0xd0, 0x48, 0x3d, 0x8d, 0x01, 0xba, 0x9a,
-  0xdb, 0x08, 0x05, 0xea, 0x96, 0x81, 0xdb, 0x23, 0xf4, 0xae, 0x78, 0x08,
-  0xcd, 0xd0, 0xe5, 0x6f, 0x3d, 0x2e, 0xad, 0xbb, 0x0e, 0xcd, 0xd1, 0x20,
-  0x60, 0x27, 0x0f, 0x33, 0x14, 0x19, 0xd2, 0xf6, 0x4b, 0x01, 0x61, 0x22,
-  0x8b, 0x4a, 0x02, 0x75, 0x2e, 0x01, 0x8b, 0x4c, 0xd4, 0x1c, 0x1c, 0x02,
-  0x42, 0xbb, 0x6a, 0x28, 0xc2, 0x80, 0x5c, 0x86, 0x29, 0xf9, 0x81, 0x52,
-  0xa1, 0x71, 0x26, 0x26, 0x8c, 0xaa, 0x04, 0xaa, 0x3b, 0x64, 0xd9, 0x6a,
-  0x3c, 0xac, 0x39, 0x9b, 0xba, 0x0e, 0x41, 0x05, 0xb0, 0xaa, 0xfa, 0xd0,
-  0x36, 0xff, 0x10, 0x8c, 0x76, 0xd0, 0xd9, 0x3c, 0x1a, 0x0b, 0x6c, 0x12,
-  0x3f, 0x82, 0xd6, 0x90, 0x27, 0x72, 0xd8, 0x57, 0x03, 0x3c, 0x40, 0x92,
-  0x1a, 0x03, 0x20, 0x02, 0xec, 0x0d, 0x42, 0x1a, 0xd6, 0x44, 0x17, 0x07,
-  0x01, 0x3c, 0x46, 0x95, 0xcf, 0x02, 0x48, 0x25, 0x73, 0x04, 0xc9, 0x4a,
-  0x5c, 0x10, 0xf2, 0x4c, 0x43, 0x57, 0x6c, 0x97, 0x4e, 0x96, 0x81, 0xce,
-  0xc1, 0x52, 0x36, 0x14, 0xa0, 0x2c, 0xed, 0x02, 0x60, 0x49, 0x38, 0x96,
-  0x11, 0x21, 0xfa, 0x2a, 0x2b, 0x56, 0x06, 0xfa, 0x2b, 0x7d, 0xc1, 0x56,
-  0x0c, 0x57, 0x12, 0x35, 0x0d, 0xe8, 0x38, 0x22, 0x4a, 0xa1, 0xe2, 0x81,
-  0x54, 0xa4, 0x50, 0x3a, 0xf5, 0x69, 0x67, 0xca, 0xe5, 0xcc, 0x6c, 0xc2,
-  0x58, 0x92, 0xd9, 0x0b, 0x75, 0x01, 0x92, 0xc7, 0x40, 0x67, 0x6f, 0xb8,
-  0x38, 0x90, 0x53, 0x95, 0xf8, 0x47, 0x6b, 0x04, 0x03, 0xa8, 0x02, 0xe8,
-  0xe3, 0x82, 0xcf, 0x88, 0x5c, 0x04, 0x25, 0x7b, 0xc6, 0x8a, 0x27, 0xc0,
-  0x13, 0xdb, 0xbc, 0x14, 0x01, 0x21, 0xdb, 0x80, 0xa3, 0x3f, 0xea, 0x00,
-  0x88, 0x4d, 0xa4, 0x58, 0x83, 0x4e, 0x74, 0x2c, 0xcb, 0x17, 0x56, 0x6d,
-  0x13, 0x0f, 0x16, 0xb9, 0x0a, 0x89, 0x2b, 0x3e, 0x05, 0xbf, 0x20, 0x97,
-  0x8f, 0x14, 0x8d, 0xee, 0x86, 0xc6, 0xfd, 0x3d, 0x95, 0x8c, 0xd4, 0x09,
-  0xfb, 0x55, 0x26, 0x26, 0x2a, 0x27, 0xbb, 0x45, 0x12, 0xf1, 0x7a, 0x10,
-  0x03, 0x0a, 0x91, 0x2c, 0x1b, 0xa1, 0xf8, 0x2f, 0xf6, 0x2b, 0x5e, 0xf1,
-  0xe6, 0x1b, 0x4e, 0xe8, 0xd2, 0xa7, 0x4e, 0x06, 0xe9, 0x8f, 0xc6, 0x60,
-  0xc8, 0x03, 0xab, 0x1c, 0xc9, 0x1a, 0x86, 0x21, 0xc3, 0x5b, 0x33, 0xc8,
-  0x6f, 0x39, 0xc6, 0x2b, 0x4e, 0xff, 0xca, 0x1b, 0x5e, 0xcc, 0x3b, 0xd3,
-  0x72, 0xe0, 0x5a, 0x0a, 0x0a, 0xa9, 0x18, 0x6d, 0xda, 0x61, 0x95, 0xc8,
-  0xd6, 0x32, 0xca, 0x38, 0xc2, 0xcc, 0x63, 0xcf, 0xd6, 0xd8, 0xa2, 0x00,
-  0x0b, 0x78, 0x31, 0x51, 0x22, 0x59, 0x2a, 0x12, 0x3f, 0xf6, 0x91, 0x01,
-  0x18, 0x7e, 0x03, 0x56, 0xea, 0x13, 0x26, 0xad, 0x8c, 0x52, 0x0e, 0x8d,
-  0x58, 0x19, 0x0f, 0x40, 0x8c, 0xd0, 0xda, 0x8d, 0x96, 0xd0, 0x16, 0xf7,
-  0xd4, 0x7e, 0xd2, 0x74, 0x0d, 0xc2, 0xf2, 0x59, 0x1c, 0x0d, 0x10, 0x08,
-  0xbc, 0x2c, 0x1c, 0xfe, 0xe9, 0x5b, 0xfe, 0xe9, 0x58, 0x98, 0xc8, 0x4d,
-  0x4d, 0xde, 0x6c, 0x22, 0xd8, 0x47, 0x2b, 0x53, 0xd6, 0xd0, 0x4f, 0x00,
-  0xda, 0x00, 0x59, 0xe6, 0x88, 0x12, 0x2e, 0x36, 0x6f, 0x50, 0x60, 0x2a,
-  0xbd, 0xcb, 0x19, 0x6d, 0xa0, 0x24, 0x35, 0x0f, 0x8e, 0x00, 0x05, 0x72,
-  0xd4, 0xa0, 0x64, 0xe1, 0x60, 0x9e, 0x60, 0x68, 0xc0, 0x03, 0x5a, 0x12,
-  0x2b, 0xbc, 0xb7, 0x04, 0x3b, 0x3b, 0x8a, 0x07, 0xd1, 0x04, 0xcb, 0x88,
-  0x16, 0x12, 0x25, 0x43, 0x60, 0x2e, 0x5d, 0xfd, 0x10, 0x64, 0x34, 0x61,
-  0xfe, 0x87, 0x89, 0x09, 0x12, 0x80, 0x46, 0x62, 0x83, 0xda, 0x82, 0x01,
-  0x0a, 0x61, 0x47, 0x44, 0x5f, 0x38, 0xec, 0xed, 0x72, 0x2f, 0x77, 0x4d,
-  0x6e, 0x11, 0x76, 0x28, 0xc0, 0x3a, 0xd4, 0x14, 0x9a, 0x25, 0x37, 0x27,
-  0x13, 0x5e, 0xe0, 0xe8, 0x3b, 0xc3, 0xb7, 0x85, 0x41, 0xfe, 0x04, 0x12,
-  0xde, 0xdd, 0xd1, 0x08, 0x38, 0xaa, 0xfe, 0x83, 0x46, 0x03, 0x44, 0x46,
-  0xbd, 0x0b, 0x28, 0x65, 0x46, 0xf1, 0xd8, 0x72, 0x20, 0x77, 0xbd, 0x19,
-  0xca, 0x76, 0x1a, 0x81, 0x15, 0xdb, 0x2b, 0x7f, 0x1b, 0x28, 0xa8, 0xc7,
-  0xc1, 0xeb, 0x19, 0x61, 0x3c, 0x23, 0x50, 0x5b, 0x1a, 0x5e, 0x2c, 0x4e,
-  0xb8, 0x5e, 0xf0, 0x40, 0x26, 0xc0, 0x78, 0x5e, 0x40, 0x1f, 0xa9, 0xfb,
-  0x40, 0xfc, 0xe9, 0x3d, 0xfc, 0x7f, 0x95, 0x50, 0x8b, 0xe9, 0xb8, 0x09,
-  0x6d, 0xf9, 0x76, 0xb8, 0xd9, 0xdc, 0xfc, 0xfb, 0x2e, 0xf6, 0x09, 0xb4,
-  0xd2, 0xfc, 0x80, 0x04, 0x62, 0x22, 0x54, 0x80, 0xa9, 0x2f, 0x03, 0x26,
-  0xe1, 0x46, 0xdb, 0xd9, 0x24, 0x73, 0x25, 0x84, 0x9b, 0x1c, 0x0d, 0x84,
-  0x80, 0x0c, 0xf4, 0xe4, 0x7a, 0x9c, 0x93, 0xfb, 0x08, 0x54, 0x5c, 0x10,
-  0x44, 0x57, 0x9f, 0x89, 0x87, 0x81, 0x64, 0xec, 0xa8, 0xfc, 0xd9, 0x28,
-  0x02, 0x42, 0xca, 0x08, 0x9e, 0x2a, 0x57, 0x88, 0x04, 0xf4, 0xa6, 0x66,
-  0x0a, 0x0c, 0x6a, 0x59, 0x23, 0x5a, 0xa0, 0x32, 0x00, 0xe0, 0x42, 0x01,
-  0x74, 0x36, 0x43, 0x11, 0xc2, 0x22, 0x35, 0xa2, 0xa9, 0x36, 0xd8, 0x26,
-  0x6f, 0x4c, 0x00, 0x20, 0x2e, 0x78, 0xa2, 0x01, 0x08, 0xc1, 0xb5, 0xc8,
-  0xcb, 0x1a, 0x68, 0x10, 0x16, 0x10, 0x4a, 0xeb, 0xcc, 0x36, 0x01, 0x61,
-  0x52, 0x4b, 0xaa, 0x67, 0x69, 0x61, 0x26, 0x0b, 0xad, 0x2b, 0x64, 0x49,
-  0x1d, 0x1f, 0x10, 0x33, 0x7b, 0xad, 0x0a, 0x62, 0xc1, 0x0c, 0xde, 0xc1,
-  0x90, 0x91, 0x62, 0x09, 0xd3, 0x31, 0x40, 0x66, 0xa0, 0x3e, 0x18, 0xf4,
-  0x20, 0xf1, 0x62, 0x41, 0x2c, 0x02, 0xf0, 0x85, 0x31, 0xc9, 0x16, 0xec,
-  0x43, 0x16, 0x61, 0x2a, 0x38, 0x21, 0x07, 0xf8, 0xc7, 0x08, 0xaf, 0xc4,
-  0xa2, 0x25, 0x26, 0x9c, 0x90, 0xf7, 0x8c, 0x10, 0x02, 0xd8, 0x58, 0xc2,
-  0x1c, 0xea, 0xf6, 0x9d, 0x11, 0x98, 0x99, 0x2a, 0x90, 0x4a, 0xba, 0xc7,
-  0x0c, 0x31, 0x25, 0x10, 0x6c, 0x28, 0x8a, 0xd9, 0x4e, 0xfc, 0x71, 0x80,
-  0xfe, 0x24, 0xa4, 0x28, 0x2a, 0x42, 0xf8, 0xb1, 0x12, 0xe6, 0x84, 0x06,
-  0x18, 0x0e, 0xd9, 0xde, 0xf9, 0x27, 0xeb, 0x4d, 0x41, 0x56, 0x7b, 0x57,
-  0xae, 0x62, 0xd2, 0x2a, 0x3e, 0xa2, 0x2e, 0xa3, 0x83, 0xd4, 0x7d, 0x5a,
-  0xc0, 0xf6, 0xbc, 0x20, 0x62, 0x53, 0x8c, 0x90, 0x01, 0xf4, 0x9f, 0xeb,
-  0x0a, 0x6e, 0x32, 0xdc, 0x65, 0x4a, 0x06, 0x24, 0x28, 0x0b, 0xb8, 0xad,
-  0xda, 0x39, 0x15, 0x19, 0x59, 0x48, 0x4b, 0x63, 0x42, 0xfb, 0x38, 0x0e,
-  0x03, 0x8c, 0x31, 0x42, 0x67, 0x5b, 0x72, 0x6c, 0xe7, 0x35, 0x83, 0x6d,
-  0x1e, 0xc8, 0x90, 0x31, 0x86, 0x45, 0x88, 0xd8, 0x30, 0x9b, 0x2c, 0x40,
-  0x64, 0x93, 0xa2, 0x8b, 0x1e, 0x64, 0x90, 0x09, 0x05, 0x16, 0xa8, 0x5b,
-  0x48, 0x71, 0x6b, 0xff, 0x44, 0x85, 0xc2, 0xc9, 0xe3, 0x85, 0xdb, 0x45,
-  0x02, 0x0c, 0xc8, 0xde, 0x42, 0xdc, 0x1f, 0x32, 0xff, 0x44, 0x61, 0xa4,
-  0x58, 0x88, 0x96, 0xb3, 0x12, 0x4c, 0x18, 0x4f, 0xa2, 0x77, 0xaa, 0x2f,
-  0x48, 0xee, 0x58, 0xa8, 0xb2, 0x52, 0x51, 0x44, 0xfd, 0xfd, 0x7e, 0xdc,
-  0x00, 0x15, 0x88, 0xbb, 0x15, 0xe2, 0x5d, 0x1f, 0xb6, 0x3c, 0xee, 0x80,
-  0x7a, 0xb7, 0xfe, 0x16, 0xda, 0xc1, 0x5b, 0x3d, 0x24, 0xd1, 0x12, 0xd5,
-  0x12, 0x82, 0x2c, 0x0a, 0xaf, 0x04, 0x00, 0xd8, 0x0e, 0x0a, 0x38, 0x7a,
-  0x7e, 0xfe, 0xe6, 0x84, 0x2d, 0x86, 0xaf, 0xa0, 0x01, 0x81, 0xdd, 0x21,
-  0x06, 0x5b, 0x82, 0x87, 0x4b, 0x6d, 0xb0, 0xd8, 0xc2, 0x27, 0x20, 0x1a,
-  0xda, 0xe2, 0x82, 0x18, 0x36, 0x40, 0xb0, 0xc4, 0x30, 0x50, 0x8a, 0x2e,
-  0x16, 0x04, 0xe2, 0x51, 0xd2, 0xa3, 0xea, 0xd4, 0xe8, 0x50, 0x91, 0x80,
-  0x88, 0x03, 0x2f, 0x01, 0x55, 0x57, 0x73, 0xd7, 0xcb, 0x0d, 0xb0, 0x38,
-  0xb9, 0xe6, 0x6a, 0xe4, 0x28, 0x48, 0xb9, 0x1b, 0x12, 0x2e, 0x34, 0x10,
-  0x61, 0xb9, 0xa0, 0xa5, 0xff, 0xb5, 0xfe, 0x3a, 0xd0, 0x3d, 0x3a, 0xb4,
-  0x92, 0x73, 0x10, 0xcc, 0x36, 0x1f, 0x24, 0x58, 0x0d, 0x6f, 0xee, 0x15,
-  0x09, 0xa0, 0x1d, 0x24, 0x35, 0xa2, 0x1d, 0x16, 0x39, 0x56, 0x10, 0x0a,
-  0x7b, 0xe9, 0x77, 0xfd, 0x4e, 0x44, 0x68, 0x9c, 0xd4, 0xb4, 0x16, 0x90,
-  0x4a, 0x20, 0x10, 0x39, 0x0f, 0x61, 0xe9, 0xc2, 0x4d, 0xfd, 0x88, 0x40,
-  0xc1, 0x09, 0x15, 0x7c, 0xab, 0x97, 0x0a, 0xc6, 0xcc, 0x24, 0x04, 0x24,
-  0xb1, 0x6c, 0x37, 0x2c, 0x04, 0x93, 0x15, 0x0a, 0x50, 0xf8, 0x06, 0x5e,
-  0xff, 0xa3, 0xff, 0xe9, 0xda, 0xd7, 0x2e, 0x7e, 0x34, 0xf3, 0x04, 0x08,
-  0x1c, 0x80, 0x99, 0x1e, 0x98, 0x35, 0x17, 0x93, 0x1e, 0x1b, 0x20, 0x36,
-  0x10, 0x28, 0x11, 0x6c, 0x1a, 0x01, 0x64, 0x17, 0x48, 0x22, 0x85, 0xd1,
-  0xd8, 0x22, 0x32, 0x09, 0x7a, 0x21, 0x33, 0xaa, 0xc9, 0x5f, 0x68, 0x15,
-  0xc2, 0xb7, 0xfa, 0x12, 0x02, 0x54, 0xc1, 0x0b, 0x82, 0x1d, 0x12, 0xc8,
-  0x17, 0x2c, 0x82, 0xc3, 0x2e, 0x60, 0x39, 0x88, 0xbd, 0xe9, 0xca, 0x50,
-  0x01, 0x03, 0x00, 0xd9, 0x18, 0x82, 0x0c, 0x72, 0xc3, 0x0a, 0xb0, 0x74,
-  0x8f, 0x04, 0x04, 0x21, 0xd9, 0x18, 0x17, 0xb9, 0x22, 0xac, 0xc0, 0x6f,
-  0xde, 0x57, 0xcb, 0x6f, 0x7b, 0x87, 0x6f, 0x0a, 0x30, 0x16, 0x74, 0x2c,
-  0x58, 0xd9, 0x41, 0x00, 0xd9, 0x56, 0x92, 0x31, 0x32, 0x42, 0xcf, 0x5b,
-  0x0c, 0xc4, 0x22, 0xf3, 0x80, 0x8e, 0x8b, 0xed, 0x0f, 0x80, 0xbc, 0x10,
-  0xa1, 0x5c, 0x8a, 0x76, 0xc6, 0x84, 0x06, 0xa6, 0x85, 0x40, 0x47, 0x8a,
-  0x5b, 0xed, 0x03, 0x7f, 0xb0, 0x0c, 0x6e, 0xfb, 0x40, 0x1b, 0xeb, 0x7a,
-  0x25, 0x8b, 0xc7, 0xf6, 0xd5, 0x07, 0x3c, 0x3a, 0x7f, 0x5e, 0x20, 0x21,
-  0x63, 0x3e, 0x02, 0x3b, 0x18, 0xee, 0x05, 0x10, 0x00, 0x3a, 0x7e, 0x25,
-  0x3b, 0x00, 0xc0, 0x00, 0x1f, 0x54, 0x75, 0x72, 0x62, 0xfe, 0x6f, 0x20,
-  0x43, 0x2b, 0x2b, 0x20, 0x2d, 0xdf, 0x05, 0x6f, 0x70, 0x79, 0x72, 0xff,
-  0x69, 0x67, 0x68, 0x74, 0x20, 0x31, 0x39, 0x39, 0xff, 0x30, 0x20, 0x42,
-  0x6f, 0x72, 0x6c, 0x61, 0x6e, 0xff, 0x64, 0x20, 0x49, 0x6e, 0x74, 0x6c,
-  0x2e, 0x00, 0xff, 0x44, 0x69, 0x76, 0x69, 0x64, 0x65, 0x20, 0x65, 0xdb,
-  0x72, 0x72, 0x16, 0x0d, 0xf6, 0x0a, 0x41, 0x62, 0x6e, 0x06, 0xfd, 0x6d,
-  0x61, 0x6c, 0x20, 0x70, 0xbf, 0x0e, 0x67, 0x72, 0x61, 0x6d, 0x20, 0xcb,
-  0x74, 0x65, 0x69, 0xc4, 0x6e, 0x61, 0xbb, 0xd9, 0x6f, 0x6e, 0x1d, 0x5e,
-  0x61, 0xc8, 0x03, 0x07, 0x0f, 0x00, 0xe6, 0xce, 0x12, 0xa3, 0xf9, 0x09,
-  0x00, 0xb5, 0x12, 0xb8, 0xbe, 0x01, 0x00, 0x66, 0x10, 0x4f, 0x6f, 0x0c,
-  0x00, 0xac, 0x13, 0xca, 0x0c, 0x01, 0xde, 0x0f, 0x3a, 0x11, 0x91, 0xef,
-  0x03, 0x07, 0x00, 0x97, 0x10, 0x9b, 0x1d, 0x43, 0x68, 0xff, 0x6b, 0x44,
-  0x73, 0x6b, 0x20, 0x62, 0x65, 0x74, 0xff, 0x61, 0x20, 0x30, 0x2e, 0x39,
-  0x2e, 0x32, 0x0a, 0x65, 0xc1, 0xfd, 0x32, 0x30, 0x30, 0x32, 0x2c, 0xf2,
-  0x05, 0x33, 0x36, 0x39, 0xc5, 0xed, 0x6d, 0x72, 0xbd, 0xda, 0x4c, 0x65,
-  0x2c, 0x8d, 0xb9, 0xb5, 0x75, 0xd4, 0xdb, 0x05, 0x74, 0x68, 0x0f, 0x7b,
-  0x47, 0x4e, 0x55, 0x03, 0x7b, 0x50, 0x4c, 0x0a, 0xb1, 0x5b, 0xe4, 0x76,
-  0x6b, 0xcd, 0xe0, 0x5b, 0xcf, 0x61, 0x74, 0xcd, 0x65, 0xdf, 0x73, 0x20,
-  0x28, 0x74, 0x79, 0xb7, 0x70, 0x22, 0x25, 0x63, 0xed, 0x3f, 0x20, 0x66,
-  0xeb, 0xb7, 0x20, 0x2d, 0x6c, 0x70, 0xb7, 0x29, 0x27, 0x50, 0x6c, 0xed,
-  0x65, 0x61, 0x73, 0x15, 0xba, 0x75, 0x03, 0x61, 0xe6, 0x2c, 0x44, 0xb6,
-  0x06, 0x66, 0xee, 0x2d, 0x20, 0x2f, 0x64, 0xdb, 0x1b, 0x25, 0x33, 0x5a,
-  0x63, 0xdf, 0x18, 0x72, 0x76, 0x65, 0x64, 0x63, 0x32, 0x66, 0xc2, 0x75,
-  0x74, 0x5d, 0xb1, 0x2b, 0xf8, 0x21, 0x00, 0x55, 0x6e, 0x6b, 0x5e, 0x31,
-  0x77, 0x6e, 0x20, 0xd0, 0xa0, 0xed, 0x22, 0x55, 0xbe, 0x73, 0x16, 0x64,
-  0xdd, 0x17, 0x53, 0x6f, 0xad, 0x6d, 0x14, 0xb1, 0x66, 0x8d, 0x66, 0x1b,
-  0xdd, 0x19, 0x63, 0x61, 0xad, 0x20, 0x2c, 0xb9, 0x74, 0xd8, 0x8b, 0x24,
-  0x1b, 0x42, 0x62, 0xdd, 0x65, 0x1f, 0x72, 0xb6, 0x21, 0x62, 0x43, 0xd7,
-  0x1a, 0x19, 0xf6, 0x61, 0x63, 0x63, 0x68, 0xdc, 0x73, 0x45, 0xdf, 0x11,
-  0x46, 0x41, 0x54, 0x33, 0xb1, 0x32, 0x2e, 0xb5, 0x63, 0x6c, 0xa1, 0x6d,
-  0xab, 0xbf, 0x79, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6b, 0x7f, 0x96, 0x6c,
-  0x64, 0x30, 0x97, 0x40, 0x30, 0x1f, 0xd4, 0xad, 0xb8, 0x1a, 0x85, 0x6b,
-  0xaa, 0xfb, 0x67, 0x20, 0x64, 0x69, 0x72, 0xf7, 0x2e, 0x64, 0x15, 0x36,
-  0xad, 0xb6, 0x38, 0x6f, 0xf0, 0x63, 0x69, 0x66, 0xb5, 0x69, 0x80, 0xef,
-  0x88, 0x1c, 0xdd, 0x63, 0x6f, 0x33, 0x63, 0xba, 0x74, 0xd7, 0x6c, 0xe7,
-  0x13, 0x21, 0x3d, 0xf2, 0x91, 0x26, 0xb8, 0x86, 0x30, 0x18, 0xd8, 0x08,
-  0x62, 0x58, 0x1b, 0x6d, 0xe6, 0x10, 0x5b, 0xdf, 0x74, 0x5e, 0x6f, 0x6b,
-  0xfd, 0x55, 0x70, 0x65, 0x66, 0xbb, 0x4e, 0x67, 0x6d, 0x75, 0x98, 0x2a,
-  0x85, 0x11, 0x6b, 0xb8, 0xcc, 0x42, 0x5a, 0xdb, 0x2e, 0x2e, 0x53, 0xb6,
-  0x75, 0x44, 0x69, 0x56, 0x24, 0xcd, 0x73, 0x73, 0xb5, 0x63, 0x34, 0xa1,
-  0xfb, 0x31, 0x9a, 0x37, 0xdb, 0xf4, 0x6f, 0xae, 0x5b, 0x1e, 0x42, 0xed,
-  0x4f, 0x4f, 0x54, 0x19, 0xb5, 0x61, 0x76, 0xdd, 0xa5, 0x66, 0x66, 0x65,
-  0xec, 0xb7, 0x62, 0xb6, 0x0d, 0xef, 0x61, 0x64, 0x61, 0x7f, 0x24, 0x28,
-  0x73, 0x29, 0x0e, 0x03, 0xca, 0x2c, 0xb7, 0x23, 0x31, 0x2b, 0xb0, 0x0a,
-  0x18, 0xda, 0x74, 0x19, 0x1a, 0xe1, 0x19, 0x2d, 0x6e, 0x72, 0x97, 0xb6,
-  0x65, 0x1a, 0x45, 0x3c, 0xdb, 0x20, 0x5b, 0xbc, 0x18, 0x3f, 0x93, 0x76,
-  0x6f, 0x6c, 0xb5, 0x75, 0xbf, 0xcc, 0x36, 0x1c, 0x5b, 0x65, 0x77, 0x70,
-  0x5e, 0x61, 0xdc, 0xdd, 0x42, 0x2e, 0x20, 0x59, 0xae, 0x06, 0x71, 0x84,
-  0x64, 0x7c, 0x47, 0x10, 0xbf, 0x2f, 0x2f, 0x46, 0x6f, 0x4f, 0x77, 0x69,
-  0x74, 0xda, 0x63, 0x68, 0x1e, 0xc1, 0x31, 0x7b, 0x97, 0x21, 0xc2, 0x4a,
-  0x61, 0x94, 0xdc, 0x69, 0x16, 0x4d, 0x70, 0x11, 0xd9, 0xb6, 0x69, 0x5b,
-  0x3a, 0x17, 0xc6, 0x6c, 0x64, 0x0c, 0xc8, 0x35, 0xcd, 0xb7, 0x1d, 0x6b,
-  0x2e, 0x30, 0x72, 0x69, 0x20, 0x7a, 0xda, 0x30, 0x3a, 0x41, 0x6e, 0xf8,
-  0x14, 0x73, 0x68, 0x41, 0x75, 0xf0, 0x5f, 0xfc, 0xd8, 0x0a, 0x55, 0x73,
-  0x2b, 0x55, 0x38, 0x74, 0x0a, 0x09, 0xd3, 0x01, 0x64, 0x6c, 0x5b, 0x3c,
-  0x33, 0xf6, 0x3e, 0x5d, 0x0a, 0x8d, 0xaf, 0xb1, 0x66, 0x05, 0x6c, 0x3c,
-  0x3c, 0x2b, 0xa1, 0xe7, 0x6c, 0x73, 0x13, 0xec, 0x72, 0x05, 0x64, 0x73,
-  0x76, 0x76, 0x5d, 0x81, 0xb9, 0x25, 0xad, 0x77, 0x51, 0x6c, 0x8d, 0x6d,
-  0x28, 0x77, 0xe6, 0x5f, 0xd1, 0xee, 0x69, 0x78, 0x70, 0xa4, 0x79, 0xde,
-  0xec, 0x73, 0xe0, 0x17, 0x25, 0x61, 0x64, 0x3a, 0xd0, 0x30, 0x8b, 0xcd,
-  0xdf, 0xdb, 0x0b, 0x64, 0x0e, 0xf7, 0x3d, 0xe1, 0xec, 0x5d, 0xa5, 0x71,
-  0x73, 0x68, 0xac, 0xd9, 0x1c, 0x42, 0xec, 0x01, 0xbf, 0x45, 0x72, 0x3a,
-  0x08, 0x6d, 0xb1, 0x23, 0xb6, 0x64, 0x1c, 0x61, 0x1e, 0x13, 0x61, 0xc7,
-  0x3a, 0x74, 0x72, 0xbc, 0x79, 0x7e, 0x36, 0x18, 0x6f, 0x76, 0x91, 0x99,
-  0x0f, 0xae, 0x61, 0x0c, 0x9f, 0xc5, 0x27, 0xf2, 0x3b, 0x73, 0xb4, 0x4b,
-  0x7b, 0xd3, 0x64, 0xc6, 0xa5, 0x0b, 0xea, 0x56, 0x7a, 0xb5, 0x38, 0xfb,
-  0x1d, 0x76, 0x3a, 0x18, 0x37, 0x8c, 0x85, 0x65, 0x87, 0x61, 0x36, 0x68,
-  0x93, 0x56, 0x7e, 0x02, 0xd3, 0x73, 0x3d, 0x07, 0xc3, 0x87, 0x63, 0x55,
-  0xbb, 0x65, 0xcb, 0x0a, 0x4e, 0x0a, 0x83, 0x18, 0x6b, 0x68, 0x20, 0x43,
-  0x5f, 0x72, 0x22, 0x55, 0x7b, 0xae, 0xb3, 0xca, 0xbd, 0x2c, 0x98, 0x24,
-  0x1e, 0xbd, 0x63, 0xee, 0x1d, 0x49, 0x73, 0x68, 0x3a, 0xec, 0x00, 0x00,
-  0x19, 0xff, 0xb4, 0x41, 0x73, 0xcc, 0xe0, 0xde, 0x17, 0x73, 0x06, 0x1f,
-  0x1b, 0xfd, 0x2c, 0x66, 0x7e, 0xfe, 0x08, 0x6c, 0x69, 0x6e, 0x64, 0xd8,
-  0x77, 0x62, 0x75, 0xfe, 0x89, 0x20, 0x26, 0x26, 0xd8, 0x95, 0x73, 0x6f,
-  0xf5, 0x73, 0x00, 0x72, 0x64, 0xdf, 0x77, 0x72, 0x09, 0x2e, 0xde, 0x63,
-  0x00, 0xfd, 0xc1, 0x20, 0x1d, 0xba, 0x4c, 0xec, 0x53, 0x45, 0x00, 0x73,
-  0x42, 0x2b, 0xbd, 0x46, 0xf0, 0x32, 0x68, 0xcd, 0x1a, 0x09, 0xf8, 0x00,
-  0x28, 0x6d, 0x6f, 0x64, 0x6f, 0xf3, 0x3d, 0x3d, 0x20, 0x4f, 0xff, 0x5f,
-  0x52, 0x44, 0x57, 0x52, 0x29, 0x20, 0x7c, 0xd8, 0x7c, 0x20, 0x14, 0x5f,
-  0x4f, 0x4e, 0x4c, 0xda, 0x59, 0x29, 0x99, 0x9d, 0x34, 0xcc, 0x58, 0x9c,
-  0x22, 0xd8, 0x35, 0xf8, 0x2d, 0x3e, 0x42, 0x79, 0x5d, 0x02, 0x73, 0x50,
-  0xb7, 0x0e, 0x53, 0x9c, 0x58, 0x6f, 0x14, 0x6c, 0x0c, 0xdf, 0x16, 0x43,
-  0x0a, 0x2c, 0x35, 0x7b, 0xd1, 0x2c, 0x47, 0xb0, 0x8a, 0x46, 0xb0, 0x92,
-  0x4c, 0xab, 0x9b, 0x09, 0x7e, 0x53, 0x69, 0x7a, 0x65, 0x28, 0xce, 0xa3,
-  0x29, 0xf5, 0x88, 0x8b, 0x82, 0xc3, 0x63, 0x69, 0xde, 0xd8, 0x85, 0x40,
-  0x8d, 0xc9, 0xb6, 0x73, 0x68, 0x73, 0x45, 0xf6, 0xf4, 0x28, 0x0f, 0x36,
-  0x6f, 0x99, 0xd7, 0x73, 0xab, 0x41, 0x3c, 0xb6, 0x82, 0x36, 0xd7, 0x86,
-  0x8e, 0x0a, 0xe6, 0x0d, 0x00, 0x6b, 0x58, 0x81, 0x5d, 0x5d, 0x63, 0x60,
-  0x89, 0xb0, 0x60, 0x29, 0x08, 0x55, 0xb3, 0x05, 0x73, 0x96, 0x2b, 0x58,
-  0x9c, 0x41, 0xdd, 0x28, 0x2e, 0x6c, 0x7c, 0xec, 0x73, 0xcc, 0xe4, 0x1c,
-  0x31, 0x32, 0x26, 0x81, 0xc0, 0x1a, 0x39, 0x36, 0x0a, 0x42, 0x1a, 0xb5,
-  0xc8, 0x9b, 0xe5, 0x82, 0xd8, 0xc4, 0x63, 0x02, 0xa6, 0x64, 0xb1, 0x00,
-  0x2d, 0xb8, 0x6e, 0x1a, 0x6d, 0xfa, 0x63, 0x9b, 0x0c, 0x7a, 0x58, 0x77,
-  0x46, 0xc2, 0x74, 0x36, 0x71, 0x01, 0xb3, 0x00, 0x1b, 0xc0, 0x62, 0x0c,
-  0x38, 0xc2, 0xf6, 0x05, 0x8b, 0x86, 0x32, 0x83, 0x8b, 0x42, 0x2e, 0x9a,
-  0x5b, 0x10, 0x04, 0x20, 0x9b, 0x21, 0xbc, 0xef, 0x69, 0x4f, 0x08, 0xc1,
-  0x6c, 0x10, 0x05, 0x81, 0x26, 0x8c, 0x14, 0xc2, 0xea, 0x55, 0xb3, 0x65,
-  0x7b, 0x2b, 0xaa, 0x02, 0x96, 0x07, 0xad, 0xa5, 0x6d, 0xaf, 0x73, 0xee,
-  0x06, 0xe0, 0x4a, 0xaf, 0xde, 0x2d, 0x75, 0x6c, 0x74, 0x34, 0x2d, 0x0c,
-  0x28, 0xd5, 0x3d, 0xa9, 0x88, 0xda, 0x5a, 0x1b, 0xd8, 0x4e, 0x65, 0x41,
-  0x6e, 0xae, 0x63, 0xcf, 0x60, 0x59, 0x56, 0x93, 0xb1, 0x7a, 0x92, 0x41,
-  0x28, 0xad, 0x6c, 0x61, 0x0c, 0xba, 0x15, 0x56, 0xdd, 0x67, 0x3f, 0x3a,
-  0x5c, 0x2a, 0x22, 0xd8, 0xd8, 0x6b, 0x95, 0x61, 0xcc, 0x0c, 0x51, 0x0a,
-  0x56, 0x72, 0x6e, 0xf5, 0x60, 0x09, 0xba, 0x3b, 0x21, 0x0d, 0xfe, 0xb4,
-  0x70, 0x07, 0x08, 0x68, 0x84, 0xc4, 0x59, 0x18, 0x84, 0x28, 0x85, 0x9a,
-  0x14, 0x4a, 0x18, 0xd2, 0x3a, 0x55, 0xb0, 0x99, 0x23, 0x49, 0x62, 0xf7,
-  0x6c, 0x66, 0x6e, 0x92, 0x45, 0x77, 0xb8, 0x09, 0x6b, 0x74, 0x67, 0x34,
-  0xd9, 0xd0, 0x63, 0xb4, 0x48, 0x73, 0x88, 0xcd, 0x7d, 0xc2, 0x63, 0x6e,
-  0xee, 0x09, 0x00, 0x6c, 0x26, 0x64, 0x4a, 0xb3, 0xe6, 0x10, 0x0d, 0x7b,
-  0x67, 0x74, 0x17, 0x60, 0x68, 0x56, 0xa0, 0x1b, 0x2e, 0x09, 0x62, 0x4a,
-  0xfb, 0x0b, 0x61, 0x24, 0x66, 0x70, 0xbd, 0x73, 0x0b, 0xe0, 0x71, 0x57,
-  0x83, 0x5d, 0x85, 0x48, 0xd9, 0x78, 0x69, 0x2b, 0x85, 0x4e, 0x8b, 0x63,
-  0x46, 0xd8, 0x71, 0x3b, 0x77, 0x70, 0x0a, 0x1b, 0x00, 0x3c, 0x44, 0xcc,
-  0x84, 0x0b, 0xe3, 0x5c, 0xbd, 0x30, 0xe2, 0xc0, 0xd6, 0x25, 0x15, 0x84,
-  0x69, 0x20, 0xd2, 0x5f, 0x1c, 0x76, 0x18, 0x9e, 0xb5, 0xc3, 0x84, 0x3b,
-  0x1f, 0x6a, 0x6f, 0x6b, 0x02, 0xb2, 0x6f, 0x1a, 0x07, 0x4c, 0xbd, 0x0b,
-  0xad, 0xb5, 0x4e, 0x1a, 0x10, 0xe6, 0x3c, 0xac, 0xb5, 0x15, 0xa3, 0xd8,
-  0x5c, 0x6e, 0x64, 0x52, 0xb5, 0x20, 0x00, 0x96, 0x2d, 0x8e, 0x32, 0x18,
-  0x5b, 0x15, 0xbd, 0xf8, 0x85, 0x62, 0x6f, 0x1d, 0xb6, 0x63, 0x07, 0x76,
-  0xcd, 0x62, 0x61, 0xe9, 0x02, 0x93, 0x3a, 0xd6, 0x6d, 0x6b, 0x09, 0xc2,
-  0x73, 0x42, 0x68, 0x43, 0xb0, 0xa1, 0x00, 0xed, 0x05, 0xcf, 0x21, 0x6a,
-  0x61, 0x16, 0xb3, 0x0b, 0xa6, 0x73, 0x31, 0x09, 0x6c, 0xbc, 0x00, 0x08,
-  0x1b, 0x15, 0x85, 0xc0, 0xc3, 0x67, 0x62, 0xc4, 0x0b, 0x78, 0x6b, 0x3e,
-  0x6f, 0x69, 0x30, 0xbb, 0x16, 0x12, 0x58, 0xd8, 0x7e, 0x34, 0xe8, 0x9f,
-  0x68, 0x98, 0xef, 0x4c, 0x7a, 0x33, 0x27, 0x73, 0x1b, 0x0d, 0x0c, 0x20,
-  0x26, 0x53, 0x68, 0x0a, 0xba, 0x2e, 0x67, 0xb0, 0x6c, 0x53, 0xe9, 0x4e,
-  0x06, 0x54, 0xdd, 0xb9, 0x4f, 0x66, 0x50, 0x83, 0x17, 0x42, 0x3c, 0x73,
-  0x48, 0x3d, 0x2c, 0x00, 0x8b, 0x60, 0x72, 0x46, 0xc5, 0x6a, 0xd6, 0x05,
-  0x6b, 0xab, 0x1a, 0x41, 0xfc, 0x8d, 0x30, 0x99, 0x16, 0xd5, 0xd2, 0x00,
-  0xa8, 0x62, 0x7d, 0xce, 0x65, 0x77, 0x1a, 0xb0, 0x01, 0x0a, 0x58, 0x7b,
-  0x3f, 0x44, 0x42, 0x47, 0x5f, 0x41, 0xef, 0x20, 0x2b, 0x20, 0x07, 0x90,
-  0x42, 0x64, 0x43, 0x18, 0x44, 0x1d, 0x8f, 0xf4, 0x08, 0x54, 0x6b, 0xa7,
-  0x2c, 0x58, 0x2a, 0xfb, 0x48, 0x49, 0x54, 0x53, 0x1d, 0x04, 0x4a, 0xcf,
-  0xdd, 0x0b, 0x45, 0x53, 0x85, 0x22, 0xd6, 0x63, 0x5d, 0xa9, 0x32, 0x3a,
-  0x2e, 0xd0, 0x7f, 0xbb, 0x99, 0x61, 0x2b, 0x03, 0x63, 0x25, 0xcf, 0x54,
-  0x8c, 0x60, 0x00, 0x26, 0x01, 0xaf, 0x2a, 0x08, 0x1b, 0x76, 0x20, 0xb1,
-  0x28, 0x66, 0x1f, 0x23, 0x3e, 0x5b, 0x2d, 0x2d, 0x20, 0x11, 0x15, 0x63,
-  0x0f, 0x20, 0x6d, 0x0d, 0x5d, 0x49, 0x03, 0x37, 0x0a, 0xc1, 0xb5, 0x16,
-  0xef, 0x00, 0xe8, 0x58, 0x37, 0x36, 0x20, 0x37, 0x6c, 0xcc, 0x5f, 0x1c,
-  0x25, 0x72, 0x0c, 0x3d, 0x55, 0x9c, 0x27, 0x75, 0x62, 0x54, 0x05, 0x4f,
-  0x7b, 0x0e, 0x34, 0xc5, 0xef, 0xb3, 0x0b, 0x78, 0x19, 0x42, 0x55, 0x0f,
-  0x57, 0x72, 0x43, 0x61, 0x41, 0x46, 0xdb, 0x55, 0x50, 0x6f, 0x12, 0x53,
-  0x98, 0x06, 0xcb, 0xf6, 0x41, 0x4d, 0x4f, 0x46, 0xfd, 0x7f, 0x46, 0x55,
-  0x4e, 0x43, 0x53, 0x1a, 0xa1, 0xd0, 0x47, 0x3a, 0x51, 0xf7, 0x0e, 0x2c,
-  0x84, 0x58, 0x16, 0x38, 0x57, 0x3d, 0x65, 0x39, 0x3b, 0x28, 0x65, 0xdd,
-  0x97, 0x76, 0x39, 0x54, 0x91, 0x2e, 0x8c, 0x95, 0xd9, 0x15, 0x3b, 0x73,
-  0x5b, 0x2a, 0x07, 0x5d, 0x2e, 0x63, 0x64, 0x29, 0x5c, 0x5d, 0x8e, 0xfc,
-  0x68, 0x01, 0xc2, 0x93, 0x04, 0x2a, 0x34, 0xf6, 0x90, 0x2e, 0x05, 0x22,
-  0x71, 0x90, 0xad, 0x43, 0x6b, 0x6b, 0x19, 0x7a, 0x57, 0x33, 0xb0, 0x0a,
-  0xc2, 0x3b, 0x05, 0x6f, 0x11, 0x5d, 0xc8, 0x73, 0xb5, 0x62, 0x38, 0x90,
-  0x41, 0x80, 0x41, 0xb5, 0x58, 0xed, 0x2a, 0x4d, 0xaf, 0x4c, 0xcf, 0x33,
-  0x0b, 0x7c, 0x1f, 0x73, 0x70, 0xbc, 0x05, 0x5f, 0x46, 0xd0, 0x35, 0x69,
-  0x72, 0x22, 0xd0, 0x16, 0x32, 0x5d, 0x9d, 0x6a, 0xcd, 0x28, 0x2c, 0x53,
-  0x60, 0xc6, 0x63, 0x1c, 0xb5, 0x87, 0xeb, 0x6c, 0xc6, 0x59, 0x48, 0x30,
-  0x73, 0x1e, 0xc4, 0xd6, 0x2f, 0x1c, 0x12, 0xc8, 0x4f, 0xd9, 0x4a, 0xd4,
-  0x69, 0x9b, 0xce, 0x27, 0x55, 0xcb, 0xda, 0x7e, 0x3a, 0x6f, 0x93, 0xcb,
-  0x56, 0x9a, 0xae, 0x5e, 0x1a, 0x88, 0xd6, 0x4e, 0x54, 0x03, 0x46, 0xfd,
-  0x49, 0x4c, 0x45, 0x25, 0x30, 0x34, 0xbd, 0xb9, 0x43, 0x48, 0x4b, 0xaf,
-  0x0c, 0xac, 0x7b, 0xa8, 0x25, 0x0b, 0x7b, 0x51, 0x14, 0xd2, 0x7c, 0x85,
-  0x14, 0x68, 0x6e, 0x0c, 0xb9, 0x0d, 0x48, 0xf0, 0x2e, 0x21, 0x04, 0xb0,
-  0x56, 0x6d, 0x19, 0x75, 0xd4, 0x56, 0x98, 0xc6, 0xb1, 0xfc, 0x7b, 0xb2,
-  0xb9, 0x42, 0x21, 0xba, 0xb7, 0x65, 0xac, 0x9c, 0x5a, 0x20, 0xef, 0x0f,
-  0x30, 0x32, 0x64, 0x2d, 0x64, 0x04, 0x85, 0x57, 0x7d, 0x05, 0x3a, 0x93,
-  0x04, 0x00, 0xb8, 0x54, 0xbd, 0x26, 0x1a, 0xda, 0x7c, 0x69, 0x6a, 0x4d,
-  0x6e, 0x4d, 0x60, 0xcd, 0x49, 0x1e, 0xba, 0x58, 0x32, 0x58, 0xdd, 0x62,
-  0x4b, 0x62, 0xd7, 0xd0, 0x74, 0x1b, 0x2b, 0x13, 0x30, 0xeb, 0xd1, 0x27,
-  0x94, 0xec, 0x2f, 0x17, 0xad, 0xee, 0x2c, 0xc1, 0xb3, 0x61, 0x19, 0x4e,
-  0xa7, 0xf0, 0xcc, 0x62, 0x85, 0xcd, 0x32, 0x85, 0x1d, 0x2c, 0x38, 0xdf,
-  0x0f, 0x68, 0x0a, 0xd2, 0x96, 0x8e, 0x6e, 0xc8, 0x34, 0xd9, 0x19, 0x4b,
-  0x30, 0x2c, 0x1c, 0xe0, 0x39, 0xc5, 0x80, 0x30, 0x6c, 0x19, 0xd9, 0x30,
-  0x48, 0x43, 0xa9, 0xb2, 0x69, 0x2f, 0x36, 0x18, 0x06, 0xc9, 0xf6, 0x7b,
-  0xd8, 0xab, 0xd9, 0x45, 0x21, 0xda, 0x47, 0xb0, 0x00, 0x70, 0x9e, 0xc0,
-  0x60, 0x92, 0x1e, 0x59, 0x4a, 0xb2, 0x1d, 0x85, 0xcb, 0x68, 0x6a, 0x61,
-  0x65, 0xc5, 0x84, 0x86, 0xa2, 0xce, 0x63, 0x6e, 0xb2, 0xd7, 0x46, 0x08,
-  0x1d, 0x00, 0x96, 0x12, 0xb6, 0x17, 0x64, 0xc0, 0x16, 0x34, 0xec, 0x87,
-  0x17, 0xb8, 0x0a, 0x60, 0xc9, 0x4a, 0x63, 0x2d, 0x4b, 0x04, 0xd5, 0x27,
-  0x70, 0x98, 0xf2, 0xf0, 0x36, 0x5e, 0x85, 0x1c, 0xe1, 0x60, 0x37, 0x60,
-  0x1c, 0xeb, 0x64, 0x50, 0xb5, 0x04, 0xb7, 0x03, 0x62, 0x3a, 0x35, 0x34,
-  0xb0, 0x2a, 0x0a, 0x3b, 0x6b, 0x03, 0xe1, 0x2e, 0xfb, 0x6c, 0x33, 0x09,
-  0xb6, 0x0f, 0x58, 0xf1, 0x62, 0xdf, 0x97, 0x42, 0x13, 0x5c, 0x17, 0x4b,
-  0x74, 0x03, 0x54, 0xca, 0x44, 0x9c, 0x4e, 0xa9, 0xf9, 0x08, 0x36, 0x07,
-  0x33, 0x32, 0x38, 0xf0, 0x5e, 0xe1, 0x37, 0x89, 0x0d, 0xb6, 0x04, 0x72,
-  0x8f, 0x30, 0x6f, 0xc3, 0x0a, 0xd7, 0xc1, 0x20, 0x48, 0x88, 0x76, 0xc4,
-  0x2c, 0xd3, 0x69, 0x76, 0xba, 0xb5, 0x6e, 0xd0, 0xca, 0xa0, 0x14, 0x34,
-  0xee, 0x43, 0xe5, 0xc1, 0x6e, 0x23, 0x8f, 0x2c, 0x83, 0x0a, 0x8a, 0x53,
-  0x04, 0x08, 0xe4, 0x29, 0x73, 0x89, 0x03, 0x43, 0x46, 0x59, 0x6c, 0xd8,
-  0xb5, 0x16, 0xaa, 0x61, 0x67, 0x75, 0x52, 0x3d, 0xc9, 0xe0, 0x33, 0x11,
-  0x96, 0x73, 0xe4, 0x4d, 0x81, 0x66, 0x71, 0xd4, 0x4d, 0xd7, 0xc1, 0x57,
-  0xe2, 0x88, 0x40, 0x6a, 0x57, 0x40, 0x52, 0x75, 0xc5, 0x2e, 0xb1, 0xfb,
-  0x00, 0x01, 0x01, 0x00, 0x40, 0x01, 0x5d, 0x05, 0x08, 0x6e, 0x0a, 0x00,
-  0x02, 0xdf, 0x0c, 0x70, 0x00, 0x80, 0x02, 0x3d, 0x02, 0x9f, 0x19, 0x68,
-  0x01, 0x02, 0xc8, 0x00, 0x09, 0x7b, 0xd0, 0x02, 0x0c, 0xd8, 0x19, 0xfc,
-  0xe0, 0x00, 0x60, 0x09, 0x07, 0x52, 0xb6, 0xd9, 0x02, 0x19, 0xf2, 0xa0,
-  0x05, 0x03, 0x5f, 0x40, 0x0b, 0x09, 0xcc, 0x00, 0x12, 0xc1, 0x00, 0x59,
-  0x56, 0xd6, 0x61, 0x2a, 0x02, 0x21, 0x25, 0x60, 0x68, 0xbb, 0x55, 0x27,
-  0x2e, 0xc2, 0x2e, 0x27, 0x2d, 0x2f, 0x08, 0xa3, 0x20, 0x44, 0x17, 0x96,
-  0xb3, 0x30, 0x7a, 0xd2, 0x34, 0xdc, 0x46, 0x51, 0x6b, 0x5c, 0x83, 0xbc,
-  0x8a, 0x76, 0xe0, 0x48, 0x5d, 0x00, 0x60, 0x50, 0xac, 0xd6, 0xc0, 0x86,
-  0x46, 0x9b, 0xfd, 0x33, 0x64, 0x7a, 0x75, 0x1a, 0x4e, 0x74, 0xbd, 0x50,
-  0xc3, 0x7b, 0x40, 0x2e, 0x69, 0x04, 0x3f, 0x18, 0x6c, 0x70, 0x14, 0x59,
-  0x3b, 0x2f, 0x7c, 0x4f, 0x00, 0xe5, 0xfe, 0x4c, 0x46, 0x4e, 0x52, 0x4d,
-  0x56, 0x44, 0xcb, 0xbb, 0x65, 0x45, 0xd9, 0x6e, 0x3c, 0x07, 0x79, 0x78,
-  0x2b, 0x56, 0x82, 0x26, 0x12, 0x15, 0xe3, 0xc1, 0x54, 0xc0, 0xa0, 0x65,
-  0xb1, 0x42, 0x6b, 0x21, 0x22, 0x2b, 0x5e, 0xb5, 0x3c, 0x9c, 0x47, 0x0f,
-  0x83, 0xb5, 0x57, 0x9e, 0x6c, 0x75, 0x3a, 0x04, 0x9b, 0x29, 0x31, 0x22,
-  0x44, 0x2b, 0x26, 0x31, 0x06, 0x2f, 0xc2, 0x2c, 0x91, 0x59, 0x2d, 0xb0,
-  0x2a, 0x01, 0x02, 0x91, 0xcc, 0x61, 0x24, 0x21, 0x58, 0x8b, 0x15, 0xb2,
-  0x33, 0xd9, 0x62, 0x58, 0x40, 0xf6, 0xb0, 0x84, 0x45, 0xca, 0x65, 0xec,
-  0x11, 0x28, 0x73, 0x70, 0x0c, 0x35, 0xda, 0x3d, 0x8d, 0x30, 0x92, 0x36,
-  0xd1, 0x25, 0x1d, 0x9f, 0x79, 0x65, 0x3d, 0xbd, 0x18, 0x3f, 0x41, 0x6e,
-  0x27, 0x74, 0x08, 0x92, 0x6f, 0x25, 0x8e, 0x27, 0x38, 0x70, 0x93, 0x2f,
-  0x28, 0x09, 0x87, 0x0a, 0x4d, 0xdb, 0xec, 0x21, 0x18, 0xc2, 0xcd, 0x14,
-  0xac, 0x95, 0x38, 0x54, 0x32, 0xd4, 0xb6, 0x2e, 0x41, 0xb0, 0x4d, 0x95,
-  0xec, 0xaf, 0x48, 0x02, 0xde, 0x29, 0xc2, 0x43, 0x15, 0xec, 0xdc, 0x44,
-  0x08, 0x5e, 0x2a, 0xc2, 0x45, 0x1b, 0x6c, 0x34, 0x6c, 0x70, 0x3d, 0xa1,
-  0x78, 0x22, 0x40, 0xcf, 0x30, 0x38, 0xf5, 0x10, 0x26, 0x40, 0xe1, 0xff,
-  0x98, 0x2c, 0x0a, 0xda, 0x9c, 0xaf, 0x0c, 0x17, 0xd5, 0x1d, 0xef, 0x90,
-  0x21, 0x49, 0xae, 0xd6, 0x73, 0x7c, 0x8a, 0x6d, 0x75, 0x27, 0x73, 0xe8,
-  0x1c, 0x28, 0x6e, 0xd3, 0x33, 0x15, 0x1f, 0xe9, 0x03, 0x3d, 0xb2, 0x2e,
-  0x01, 0xcd, 0x4c, 0x02, 0x6e, 0x8c, 0x13, 0x1c, 0xe9, 0x03, 0x4d, 0xb2,
-  0xa1, 0x02, 0xe5, 0x02, 0x03, 0xf9, 0x06, 0x00, 0x1c, 0x13, 0xb8, 0xa6,
-  0xdc, 0xcb, 0x81, 0x02, 0x9f, 0x37, 0x0a, 0x00, 0xf8, 0xcd, 0x12, 0x24,
-  0x49, 0x34, 0xfe, 0xd9, 0x1c, 0x01, 0x7e, 0x0a, 0x00, 0xe1, 0x14, 0x24,
-  0x69, 0x49, 0xb2, 0x1d, 0x04, 0xcd, 0x3b, 0x5c, 0x60, 0xdc, 0x0a, 0xbc,
-  0xca, 0x25, 0xbf, 0x18, 0xcb, 0x08, 0x09, 0x2f, 0xb2, 0x18, 0xb7, 0xd7,
-  0x0d, 0xc5, 0x58, 0x7b, 0x76, 0x61, 0x5d, 0x03, 0x44, 0x52, 0xa2, 0xa9,
-  0x1b, 0x16, 0x62, 0x55, 0xb0, 0x63, 0xad, 0x80, 0x64, 0x1b, 0x67, 0x27,
-  0x2e, 0x20, 0x66, 0x00, 0xc2, 0x46, 0x46, 0x80, 0x4b, 0x40, 0x68, 0x72,
-  0x35, 0xd0, 0xb2, 0x24, 0x2e, 0x0f, 0x22, 0x2a, 0x2b, 0xf5, 0x2c, 0x2e,
-  0x3a, 0x3b, 0x2f, 0x26, 0x3e, 0x3f, 0x5b, 0xe0, 0x5c, 0x5d, 0x7c, 0x4d,
-  0x00, 0x86, 0x4e, 0xb2, 0x97, 0xb4, 0x98, 0x2d, 0xc9, 0x3d, 0x60, 0x00,
-  0x1d, 0x5c, 0x96, 0x81, 0xc9, 0x65, 0x61, 0x00, 0xa1, 0x6c, 0xdb, 0x0d,
-  0x41, 0xf4, 0x00, 0x2d, 0x00, 0x52, 0x01, 0x4b, 0x7c, 0x53, 0x6b, 0x68,
-  0x0e, 0x92, 0xf8, 0xc6, 0x64, 0x4e, 0xa2, 0x5a, 0x62, 0x53, 0x24, 0x59,
-  0xc6, 0x26, 0xd4, 0x70, 0x38, 0x2d, 0x99, 0x9a, 0x02, 0x92, 0xde, 0x2e,
-  0x01, 0x89, 0x48, 0x76, 0x7c, 0x2d, 0x00, 0x04, 0x4b, 0xe8, 0x5b, 0x86,
-  0x6f, 0x6e, 0x55, 0x4d, 0x65, 0x16, 0x43, 0x61, 0x24, 0x2e, 0xe1, 0x20,
-  0x59, 0x95, 0x82, 0xe3, 0x3c, 0xab, 0x07, 0xf3, 0x44, 0x6f, 0xce, 0x69,
-  0x90, 0x61, 0x83, 0xe9, 0x4e, 0x6f, 0x3a, 0x35, 0x24, 0x14, 0xb0, 0x22,
-  0x52, 0x4c, 0x4a, 0x85, 0x69, 0x12, 0xeb, 0x30, 0x61, 0x26, 0xdf, 0x13,
-  0x7c, 0x7b, 0xd2, 0x20, 0x0d, 0xe3, 0x59, 0x81, 0x00, 0xdd, 0x00, 0x1f,
-  0xee, 0x1c, 0x1f, 0x1e, 0x01, 0x62, 0x04, 0xed, 0x0d, 0x00, 0x3b, 0x00,
-  0x56, 0x8c, 0xff, 0x78, 0x00, 0x97, 0x00, 0xb5, 0x00, 0xd4, 0xff, 0x00,
-  0xf3, 0x00, 0x11, 0x01, 0x30, 0x01, 0x4e, 0xe2, 0x01, 0x1a, 0x1c, 0xdb,
-  0x3b, 0x1e, 0x03, 0xa6, 0x22, 0x9a, 0x26, 0x2a, 0x69, 0x2e, 0xa6, 0x32,
-  0x9a, 0x36, 0x3d, 0x69, 0x44, 0xa6, 0x4c, 0x9a, 0x56, 0x5f, 0x69, 0x66,
-  0xa6, 0x6f, 0x9a, 0x73, 0x77, 0x69, 0x7b, 0xa6, 0x7f, 0x9a, 0x83, 0x87,
-  0x69, 0x8b, 0xa6, 0x8f, 0x9a, 0x93, 0x97, 0x69, 0x9b, 0xa6, 0x9f, 0x9a,
-  0xa7, 0xb0, 0x69, 0xb6, 0xa6, 0xbc, 0x9a, 0xc0, 0xc5, 0x69, 0xca, 0xa6,
-  0xd1, 0x9a, 0xdb, 0xe3, 0x69, 0xec, 0xa6, 0xf5, 0x9a, 0xf8, 0x53, 0x25,
-  0x50, 0xda, 0x00, 0x4d, 0xf4, 0xab, 0x1d, 0x41, 0xba, 0xb5, 0x57, 0x65,
-  0x9d, 0x2b, 0xb0, 0xed, 0x46, 0x28, 0xe1, 0x50, 0xd9, 0xad, 0x23, 0x03,
-  0x13, 0x6c, 0x25, 0xef, 0x7b, 0x1e, 0x06, 0xdd, 0x21, 0x73, 0x7b, 0x07,
-  0x25, 0xac, 0x6e, 0x09, 0xdd, 0x2b, 0x72, 0x7b, 0x08, 0x30, 0xde, 0x06,
-  0xe6, 0x33, 0x10, 0xbe, 0x08, 0x4a, 0x35, 0x15, 0xbb, 0x13, 0x65, 0x62,
-  0x39, 0x46, 0xb8, 0x8d, 0x38, 0x42, 0xa7, 0xb9, 0x07, 0xce, 0x13, 0x68,
-  0x6d, 0x03, 0x6c, 0xbb, 0x0f, 0x75, 0x67, 0x28, 0x6b, 0x65, 0x8e, 0x61,
-  0x4f, 0x46, 0x43, 0x9d, 0x46, 0x76, 0x4e, 0x85, 0x4f, 0x7d, 0x2f, 0x75,
-  0x0c, 0xa4, 0xfb, 0x33, 0x72, 0x08, 0xde, 0x38, 0x35, 0xf5, 0xe1, 0x3a,
-  0x93, 0x58, 0x3c, 0x77, 0x65, 0x3d, 0xde, 0x79, 0x3e, 0x19, 0x96, 0xe1,
-  0x41, 0x9b, 0x44, 0xef, 0xe3, 0x47, 0xbd, 0x6f, 0x07, 0xcc, 0x4b, 0x10,
-  0xdc, 0x50, 0xce, 0x08, 0x41, 0xb7, 0x81, 0x50, 0x4d, 0x4e, 0x0e, 0xf5,
-  0x02, 0x72, 0x07, 0xb2, 0x16, 0x16, 0x0e, 0xd5, 0x34, 0xd8, 0xf0, 0x30,
-  0x30, 0xe6, 0x55, 0x01, 0xdb, 0x2c, 0x02, 0x3a, 0x9f, 0x30, 0x25, 0x00,
-  0x6b, 0x0d, 0x00, 0x0e, 0x21, 0x79, 0x20, 0x29, 0xc8, 0x01, 0x40, 0x5c,
-  0x02, 0x93, 0x40, 0x27, 0x14, 0x23, 0x04, 0x20, 0x0c, 0x40, 0x8c, 0x18,
-  0x8c, 0x08, 0x80, 0x33, 0x40, 0x64, 0x20, 0x00, 0xaa, 0x3d, 0xdd, 0x0c,
-  0xa4, 0x03, 0xd9, 0x89, 0xe4, 0x09, 0x02, 0x2f, 0x3c, 0x1e, 0x6f, 0x13,
-  0x0a, 0x02, 0x01, 0x21, 0x33, 0x50, 0x06, 0x01, 0x61, 0x13, 0x33, 0x64,
-  0x72, 0x43, 0x02, 0x03, 0x13, 0x78, 0x37, 0x42, 0x02, 0x04, 0x21, 0x3a,
-  0x8c, 0x1e, 0x11, 0x30, 0x61, 0x13, 0x32, 0xa0, 0x00, 0xc8, 0xb4, 0x03,
-  0xc8, 0x20, 0x0c, 0xdc, 0x80, 0x32, 0xf0, 0x00, 0xe4, 0x04, 0x1f, 0xae,
-  0x18, 0x40, 0x19, 0x2c, 0x00, 0x64, 0x40, 0x01, 0x90, 0x54, 0x06, 0x68,
-  0x40, 0x19, 0x7c, 0x00, 0x64, 0x90, 0x01, 0x90, 0xa4, 0x04, 0x11, 0x46,
-  0x35, 0xee, 0x20, 0x02, 0x01, 0xfb, 0x04, 0xa0, 0x02, 0xa0, 0xff, 0x00,
-  0x22, 0x5a, 0xa2, 0xdb, 0x03, 0x0d, 0x34, 0x3a, 0x10, 0xc0, 0xa9, 0xf8,
-  0x54, 0x4d, 0x50, 0x16, 0xe4, 0x24, 0xd4, 0x00, 0x62, 0xa2, 0x16, 0xb4,
-  0x13, 0x5e, 0x04, 0x05, 0x06, 0x3b, 0x7b, 0x14, 0x15, 0xfe, 0x05, 0x13,
-  0xff, 0x16, 0x05, 0x11, 0x02, 0xc2, 0x45, 0x76, 0x05, 0x05, 0x57, 0x47,
-  0x0f, 0xdb, 0xff, 0x23, 0x22, 0x0f, 0x3b, 0x2e, 0x6d, 0xff, 0x3c, 0xdf,
-  0x05, 0x0f, 0x30, 0x13, 0x21, 0xd9, 0x23, 0x04, 0xb6, 0x0f, 0x00, 0x04,
-  0x11, 0x23, 0xf5, 0x6d, 0x01, 0xe2, 0x35, 0xb7, 0x77, 0xe6, 0x03, 0x61,
-  0x50, 0x46, 0x35, 0x65, 0x01, 0x6f, 0x22, 0x45, 0x53, 0x54, 0x6c, 0x03,
-  0x44, 0xba, 0x00, 0x28, 0xdc, 0x07, 0x6c, 0x6c, 0x42, 0xb1, 0xa5, 0x3d,
-  0xb5, 0x01, 0x8e, 0x3d, 0x44, 0x02, 0xbf, 0x0a, 0x03, 0x04, 0x14, 0x09,
-  0x05, 0x61, 0x00, 0xc9, 0x14, 0x7e, 0x0f, 0x17, 0x0f, 0x08, 0xee, 0x06,
-  0x07, 0x14, 0x16, 0xc9, 0x12, 0xb2, 0x0d, 0x1d, 0xfd, 0x10, 0x0a, 0x0f,
-  0x0f, 0xb2, 0x1f, 0x0a, 0xfc, 0x06, 0x14, 0x12, 0x0b, 0x0e, 0xbc, 0x11,
-  0x14, 0x0c, 0x96, 0x90, 0x60, 0xa6, 0xff, 0x92, 0x7b, 0xaa, 0x58, 0x80,
-  0x41, 0x40, 0x17, 0xb8, 0xff, 0x00, 0x37, 0xcd, 0x21, 0x88, 0xd0, 0xcb,
-  0x24, 0x15, 0x05, 0xa8, 0x8a, 0xba, 0x27, 0xbc, 0xd8, 0x02, 0x03, 0xac,
-  0xd9, 0xa3, 0x92, 0xcc, 0x96, 0x00, 0x43, 0x3f, 0x90, 0x00, 0x2b, 0x91,
-  0x01, 0xe8, 0xb9, 0x00, 0x17, 0x10, 0x5a, 0x64, 0x03, 0xa2, 0x83, 0x54,
-  0x84, 0x35, 0xc8, 0xad, 0x5c, 0x29, 0x25, 0xfb, 0x0c, 0x1e, 0x85, 0x4d,
-  0x1c, 0x8c, 0x14, 0x50, 0xf2, 0x39, 0x4c, 0x34, 0x65, 0x62, 0x57, 0x35,
-  0x64, 0x34, 0xc9, 0x41, 0xc8, 0x5e, 0x00, 0xc6, 0x27, 0xda, 0x00, 0x15,
-  0xc2, 0x33, 0x0d, 0xc8, 0x0b, 0x45, 0x3f, 0x2a, 0x4d, 0x2d, 0x46, 0x48,
-  0xac, 0x46, 0x6c, 0x09, 0x0b, 0x21, 0x10, 0x20, 0x03, 0x26, 0xc9, 0x00,
-  0x3e, 0x53, 0x25, 0x2c, 0x0c, 0x91, 0xc8, 0x3e, 0xc8, 0x44, 0x54, 0xfc,
-  0x27, 0x00, 0x13, 0x00, 0x11, 0x90, 0xc8, 0x51, 0x1c, 0x13, 0x60, 0x39,
-  0x15, 0x32, 0x5f, 0x17, 0x22, 0x63, 0xa6, 0x11, 0x21, 0x44, 0xd9, 0x12,
-  0x3f, 0x44, 0xc8, 0x75, 0x07, 0x40, 0x60, 0x51, 0x32, 0x2c, 0x14, 0x77,
-  0x31, 0x04, 0xec, 0x1b, 0x00, 0x00, 0x80, 0x1c, 0xfd, 0x04, 0x97, 0x01,
-  0x25, 0x36, 0x9e, 0x14, 0x0e, 0x24, 0x04, 0xc2, 0x00, 0x16, 0x1a, 0xc8,
-  0xc6, 0x46, 0xca, 0x29, 0x6f, 0x1c, 0x04, 0xb7, 0x5c, 0x03, 0x15, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0xff, 0xa4, 0x00, 0xff, 0x75,
-  0x03, 0xe8, 0x75, 0x00, 0x72, 0xf6, 0x41, 0x8c, 0xc0, 0x01, 0xff, 0x73,
-  0x05, 0x80, 0xc4, 0x08, 0x8e, 0xc0, 0xd1, 0xef, 0xe8, 0x55, 0x00, 0xe3,
-  0x66, 0x73, 0xf9, 0x49, 0x49, 0x74, 0x11, 0x01, 0xc9, 0x01, 0xc9, 0x01,
-  0xc9, 0x01, 0xc9, 0x89, 0xcd, 0x8a, 0x1c, 0x46, 0xf6, 0xd3, 0x31, 0xc9,
-  0xe8, 0x39, 0x00, 0x11, 0xc9, 0x75, 0x08, 0x41, 0xe8, 0x31, 0x00, 0x73,
-  0xfb, 0x41, 0x41, 0x81, 0xfd, 0xd1, 0x00, 0x83, 0xd9, 0xfe, 0x29, 0xe8,
-  0x72, 0x0e, 0x8e, 0xd8, 0x8d, 0x01, 0x28, 0xfc, 0x96, 0xf3, 0xa4, 0x96,
-  0x8e, 0xda, 0xeb, 0xa5, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0,
-  0x50, 0x31, 0xc0, 0x8e, 0xd8, 0x58, 0x01, 0xd8, 0x01, 0xf8, 0xeb, 0xe2,
-  0x00, 0xff, 0x75, 0x03, 0xe8, 0x06, 0x00, 0x11, 0xc9, 0x00, 0xff, 0x75,
-  0x05, 0x8a, 0x3c, 0x46, 0x10, 0xff, 0xc3, 0x5d, 0x06, 0x1f, 0x8d, 0xb5,
-  0xeb, 0xf7, 0xad, 0x5b, 0x91, 0xad, 0x92, 0xad, 0x97, 0xad, 0x01, 0xc3,
-  0x8e, 0xc3, 0x31, 0xc0, 0x01, 0xc7, 0x26, 0x01, 0x2d, 0xac, 0x48, 0x74,
-  0x15, 0x40, 0x75, 0xf4, 0x47, 0x47, 0x26, 0x80, 0x3d, 0x9a, 0x75, 0xf9,
-  0x26, 0x39, 0x55, 0x03, 0x77, 0xf3, 0xb0, 0x03, 0xeb, 0xe2, 0x81, 0xc7,
-  0xfe, 0x00, 0x72, 0xd3, 0xe2, 0xdf, 0x07, 0x06, 0x1f, 0x8d, 0x86, 0xbb,
-  0x1a, 0x8e, 0xd0, 0xbc, 0x80, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0xbb,
-  0x1a, 0x80, 0x00, 0x00, 0x00, 0x1e
+	0x78,0xDA,0x1C,0x97,0x69,0x34,0xD4,0x8F,0xE3,0xFD,0xDF,
+	0xB3,0x8F,0xD9,0x8C,0x99,0x31,0x76,0x66,0xEC,0xB2,0xEF,
+	0xFB,0xBE,0x67,0x69,0x22,0x5B,0x93,0x35,0x24,0x7B,0x18,
+	0x2A,0xB2,0x84,0x2C,0x83,0xA4,0x12,0xDA,0x48,0xF5,0x89,
+	0x28,0x49,0x88,0xB2,0x67,0x49,0x0A,0x95,0x2C,0x85,0x50,
+	0x19,0x83,0x54,0x1A,0xB2,0xCC,0xFC,0xBE,0xFF,0xFF,0x3D,
+	0xE7,0x9E,0x73,0x9F,0xDC,0xFB,0xE0,0x3E,0x7B,0xB9,0x1C,
+	0xD5,0x02,0xB9,0x01,0x20,0x00,0x0C,0xE8,0x09,0xF0,0x78,
+	0xF6,0x62,0xFF,0x0B,0xFF,0x5F,0xE2,0xFF,0x33,0x1F,0xA0,
+	0x81,0x7A,0xEE,0x77,0xB8,0xA3,0xED,0x4E,0xDE,0x96,0x64,
+	0xCD,0xB3,0xF4,0x82,0x41,0x18,0x0C,0x28,0x9A,0x84,0xC9,
+	0x0A,0x14,0x75,0xED,0xFF,0xB9,0xB7,0xA7,0x96,0x1E,0x49,
+	0xC0,0xC7,0xFF,0x28,0x79,0x5C,0x8F,0xC3,0xE1,0xE0,0x52,
+	0x08,0xF2,0x4B,0x2C,0xD0,0xFE,0x2E,0xDD,0x63,0xD8,0x83,
+	0xE6,0x4D,0xC5,0x42,0x20,0xC8,0xD3,0x33,0x3D,0x3F,0xB5,
+	0x3A,0xEC,0xD2,0x5C,0x9A,0x40,0xAB,0x55,0x80,0xC1,0x1B,
+	0x10,0x50,0xCC,0x6B,0x3B,0x26,0xA4,0x96,0x47,0x86,0x83,
+	0x79,0x4D,0x1A,0x23,0x54,0xA6,0x1A,0x18,0xE0,0x31,0x25,
+	0x55,0x80,0xA2,0xE9,0xEA,0x64,0x1E,0x50,0x00,0x3F,0x03,
+	0xE4,0x49,0x32,0x62,0x20,0x6A,0x85,0xC0,0xFE,0x32,0x16,
+	0xD4,0x67,0x16,0xDF,0x29,0x36,0xC0,0x9C,0x7C,0xCE,0xE3,
+	0xA5,0xED,0xFD,0x7E,0xB4,0x68,0x62,0x2D,0xCF,0x33,0x80,
+	0x31,0x38,0xE9,0x23,0xE9,0x5B,0x6B,0x53,0x79,0x38,0xD1,
+	0x96,0xE7,0x86,0xEF,0x17,0xF7,0x33,0x7B,0xF1,0x99,0x8B,
+	0x1B,0xCD,0x3A,0x49,0x26,0xBC,0x71,0xE5,0x15,0xA6,0x19,
+	0x57,0x8A,0x9B,0xC1,0x03,0xC0,0xF1,0x88,0xCE,0x19,0x68,
+	0x1E,0xA6,0xF3,0x09,0xF4,0xFD,0x4F,0x7B,0x63,0xDE,0xCF,
+	0x78,0x08,0xEB,0x0C,0x88,0x39,0x37,0x03,0x99,0x56,0xCC,
+	0x4E,0x0A,0xCC,0x03,0xAA,0x62,0xC2,0x94,0x27,0x8B,0x38,
+	0x5D,0x4D,0x07,0xBD,0xCE,0xF3,0xFC,0xDF,0xFF,0xD8,0x29,
+	0x1A,0x67,0x76,0xFE,0x50,0xDF,0xD5,0xE6,0x74,0xA9,0x15,
+	0xC1,0x2B,0x78,0x9D,0x26,0xD4,0xE7,0x2B,0xBA,0xCA,0xBC,
+	0x77,0x7B,0x7F,0x6A,0x9B,0x80,0x11,0xD1,0xA8,0xFA,0xB4,
+	0x4E,0x3D,0x5C,0x06,0xA0,0xBD,0xC6,0x6B,0x3D,0x2A,0x54,
+	0x34,0xD9,0x01,0x00,0x33,0x9D,0x84,0xAA,0x99,0x66,0x40,
+	0x59,0xD2,0x5F,0xAD,0x1F,0xDE,0xF2,0x05,0x14,0x07,0xBB,
+	0xBF,0x0B,0x02,0x78,0x7A,0xA7,0x20,0xF7,0x63,0x2A,0xA2,
+	0x22,0x62,0x4E,0x02,0x15,0x08,0x2E,0xD0,0x02,0xA1,0x55,
+	0xCC,0x62,0xBE,0xE8,0xB6,0xD2,0x7F,0x9B,0x82,0x87,0xC1,
+	0x37,0x15,0x78,0x6B,0x92,0x6A,0x92,0x90,0xEB,0x5A,0x7A,
+	0x92,0x4F,0x68,0x02,0x6B,0xB8,0x65,0x0F,0xCE,0xFE,0x6A,
+	0x93,0x73,0xBE,0x1D,0xB4,0xF3,0xC6,0x73,0x1C,0xD0,0xA6,
+	0xCA,0x03,0x58,0xDD,0x80,0x64,0x2B,0xA0,0x1B,0x81,0x6B,
+	0x0F,0xF4,0x91,0xAB,0xA7,0x3B,0x3C,0x81,0x62,0x2A,0x7C,
+	0xFD,0x7D,0x60,0x22,0x81,0xF7,0x8E,0x5F,0x82,0x57,0x84,
+	0x9C,0xF0,0x07,0xE4,0x0A,0x5E,0xA3,0x8F,0xB6,0xCD,0xA8,
+	0x80,0x88,0x52,0xED,0xBD,0x56,0x72,0xAF,0x9E,0x91,0x2D,
+	0x46,0xD0,0xA8,0x0A,0xA8,0xAF,0x2B,0xEC,0x64,0xA0,0x21,
+	0xFC,0xBF,0x10,0xDE,0x70,0x13,0x8F,0xF9,0x89,0x39,0x6B,
+	0xCC,0x9B,0x4B,0x20,0xA5,0x9B,0xF3,0x12,0x50,0xFB,0x06,
+	0x27,0x40,0x49,0xB0,0xFC,0x56,0x28,0xF3,0xBD,0xFF,0x29,
+	0x38,0x7B,0xD9,0x98,0xF7,0x29,0x81,0xC2,0x9C,0x96,0x44,
+	0xC0,0x63,0xC4,0x81,0x7E,0xC4,0x13,0x5E,0x0B,0x2F,0x01,
+	0x21,0xCF,0xF3,0x07,0x4B,0xB1,0x9B,0x5F,0xC1,0xBD,0x62,
+	0x3A,0x7A,0x9B,0x2C,0xBE,0xB4,0x83,0x9D,0x7A,0x67,0x9E,
+	0x4B,0xF6,0x1A,0x9F,0x58,0x5B,0xDE,0x5F,0xE1,0xB5,0x42,
+	0x00,0x5A,0xC3,0x02,0xA9,0xE3,0x1E,0x00,0xED,0xF2,0x98,
+	0xFC,0xE1,0xE9,0x7F,0x8A,0xC6,0x4B,0x44,0xC6,0x80,0xE1,
+	0x15,0x6F,0xB3,0xA5,0xBD,0x78,0x99,0x7D,0x70,0xE6,0x46,
+	0x26,0x97,0xC7,0x63,0x80,0xD9,0xA2,0x5B,0x76,0x28,0xF0,
+	0x3F,0x20,0x01,0xBE,0xD5,0x9F,0xC8,0x80,0xCA,0xF3,0xD8,
+	0x7C,0x03,0xF0,0x73,0x00,0x2C,0xE6,0x03,0x8F,0xE7,0xF7,
+	0xD9,0x77,0xD8,0x68,0x46,0x9B,0x00,0x0E,0xC1,0x97,0xE2,
+	0x30,0x74,0x94,0xAD,0x5E,0x6F,0x4F,0xB0,0xFD,0x56,0x05,
+	0x83,0x70,0x90,0x43,0xA8,0xD8,0x30,0x9A,0x04,0x94,0x79,
+	0x99,0x66,0x47,0xC4,0x28,0x0C,0x58,0x4B,0x2B,0x3F,0x5B,
+	0x5C,0x34,0xE6,0x0B,0x7A,0x6C,0xB1,0x13,0xC4,0xB4,0x43,
+	0x32,0x3D,0x79,0xF0,0xBC,0x6B,0xD2,0xBA,0x79,0x39,0xB2,
+	0x6B,0xBA,0x3C,0xB8,0x60,0x44,0xB0,0x8A,0x84,0x27,0xB3,
+	0xC3,0x1E,0xCD,0x49,0x81,0xCD,0xE6,0x90,0x52,0xF8,0x04,
+	0x89,0x9D,0x8F,0x97,0x5B,0xA4,0xD9,0x02,0x28,0xEC,0x9C,
+	0xD6,0x40,0xCE,0x1B,0xA9,0x98,0x54,0xCF,0x0A,0x36,0xA3,
+	0xD6,0xE7,0x76,0xB6,0xB3,0xB3,0x67,0x8B,0x97,0x7E,0x9B,
+	0x49,0x94,0x9C,0xDB,0xED,0x8C,0xE5,0x74,0xDD,0xD5,0xEA,
+	0x17,0xBA,0x04,0x35,0xBF,0x99,0x20,0xBB,0x93,0x89,0x9E,
+	0x48,0x45,0x21,0x2F,0x95,0x8E,0xE2,0x21,0xDD,0xE4,0xED,
+	0x5C,0x41,0x79,0xA9,0x68,0xEE,0xD8,0xFC,0x1C,0xA8,0xBA,
+	0x5F,0x37,0xB3,0x19,0x0E,0xB1,0x9B,0x6B,0xE3,0xB6,0x3D,
+	0x83,0x15,0x6E,0x6D,0x34,0x6C,0x28,0xB6,0xC3,0xCC,0x10,
+	0x9D,0x06,0x9F,0xA5,0xB7,0x14,0x84,0xC2,0x19,0x10,0x56,
+	0xE6,0x80,0xB0,0x4D,0x62,0xB9,0x31,0x71,0x3F,0x05,0x91,
+	0x26,0x69,0xDC,0x2E,0x91,0x24,0x82,0x4B,0x6B,0x17,0x06,
+	0xCA,0xB7,0x76,0xD7,0x21,0x1B,0x3C,0x19,0x86,0xB8,0x52,
+	0xB3,0xA0,0x88,0xD4,0x1E,0xFB,0x75,0x66,0x2A,0x4A,0x25,
+	0xC6,0x5E,0xED,0x40,0x05,0x65,0x06,0x6E,0x71,0xED,0xAE,
+	0x70,0x47,0x9D,0x0E,0xAD,0x07,0xFF,0xA3,0x00,0xFD,0x5C,
+	0x2F,0xC6,0x62,0x59,0xE7,0x00,0x0B,0xDD,0x95,0x70,0x81,
+	0x6E,0x03,0x6A,0xCE,0xB4,0x05,0x84,0xEE,0xBE,0xD1,0xC5,
+	0x86,0xC0,0x4F,0x23,0x3C,0x65,0x75,0x84,0x42,0x39,0x3A,
+	0xD5,0x5D,0xBA,0x04,0x21,0x9B,0xA7,0x3A,0x4F,0x5A,0x98,
+	0xB0,0xEA,0xD7,0xD7,0x75,0x61,0xD0,0x16,0xA0,0x8C,0xD9,
+	0x3F,0xD3,0x8E,0x30,0x1E,0x1F,0xDF,0xFA,0x73,0x66,0x75,
+	0x50,0xD7,0x47,0x6F,0x0C,0xAB,0x55,0x7F,0xFF,0x7F,0x3F,
+	0x10,0xD2,0xE0,0x88,0xAF,0x70,0x13,0x4E,0x52,0x66,0xB4,
+	0xC4,0x41,0x3F,0x5D,0xF5,0x5D,0x21,0x06,0x49,0x90,0xC3,
+	0xC0,0x65,0xBF,0xEE,0x5B,0x67,0xF6,0xE8,0x4A,0xD0,0x0D,
+	0xB0,0x5F,0x81,0x7F,0x21,0xA4,0x18,0x44,0x7E,0x8E,0xE7,
+	0xA4,0x58,0xD9,0x6F,0x7D,0x9E,0x90,0x16,0xB1,0x57,0xE6,
+	0xCF,0x17,0x06,0x2C,0x26,0x6E,0xA2,0x28,0xC6,0xB8,0x60,
+	0xBA,0x15,0x3D,0xE4,0xFF,0xD5,0x8F,0xF9,0x8D,0x25,0xF4,
+	0xF3,0x54,0x9F,0x1F,0xBC,0xFD,0x4B,0x12,0x18,0x72,0x5C,
+	0xBF,0xE7,0x14,0x98,0xDB,0x5B,0x77,0xCC,0x7C,0x15,0x5A,
+	0x21,0xFA,0x4C,0x25,0xE0,0x9F,0x04,0xD3,0x3E,0x8D,0x29,
+	0xA4,0x4C,0x2E,0xA5,0x70,0xC4,0xE0,0x65,0x94,0xC9,0xDE,
+	0xBD,0xE7,0x38,0x86,0xC4,0x22,0x57,0x75,0xAF,0x55,0xF7,
+	0xCD,0x3E,0x67,0x81,0x16,0xA9,0xCE,0x45,0xC1,0x22,0x11,
+	0xB4,0x1F,0x87,0xBD,0xDB,0x20,0xD0,0x13,0xE4,0xE3,0xFE,
+	0xC8,0x3B,0xFB,0xBC,0x96,0x26,0xB1,0x0E,0x48,0xA3,0x18,
+	0xD3,0xEF,0x1F,0x01,0x63,0x98,0xF2,0xE4,0xAC,0xD8,0x8B,
+	0xE5,0x5D,0x71,0x5A,0xF4,0xDA,0x1D,0xDD,0x63,0x44,0xD1,
+	0x2D,0xD1,0x7A,0x5D,0x6C,0xAE,0xB7,0x0B,0xBD,0x33,0x32,
+	0x88,0xE7,0xE3,0xE3,0xD6,0x4C,0x43,0x94,0x84,0xD6,0x60,
+	0x50,0x31,0xF5,0xCC,0x54,0xA8,0xC4,0x7C,0xE6,0x06,0xCF,
+	0x2E,0x05,0xAE,0xAE,0x92,0x0F,0xA4,0xF6,0xF3,0xB5,0x8D,
+	0xDF,0x3F,0x72,0x9F,0xF5,0xE5,0x97,0x1D,0xAE,0xDD,0x64,
+	0x5F,0x14,0x64,0x87,0x79,0x8B,0x46,0x7E,0xCB,0xF3,0xC4,
+	0x3D,0xC1,0x08,0xBC,0x44,0x21,0xD7,0x05,0x44,0x2F,0xA2,
+	0x2C,0xCF,0x91,0x90,0x6F,0xD0,0xA4,0xD3,0xA8,0xAD,0x81,
+	0xF0,0xEB,0x62,0x7E,0x5A,0x20,0x06,0x59,0x2C,0x57,0x3C,
+	0xB5,0x47,0xD4,0xAE,0x9C,0x8B,0x94,0x60,0x13,0xF3,0xB3,
+	0x44,0xE9,0x4A,0x33,0x8A,0x76,0x48,0x11,0xE3,0xD8,0xD4,
+	0xB5,0xB1,0x2F,0x98,0xC2,0xF4,0xED,0x47,0x7C,0xF0,0x5F,
+	0xCC,0xDF,0x99,0x3F,0xDB,0xC6,0x06,0x2C,0x66,0xD4,0xA0,
+	0x82,0xBD,0x1A,0xFA,0x18,0x98,0xDD,0x17,0xA0,0xE6,0x10,
+	0x52,0x1D,0x7C,0x0E,0xF2,0x85,0xE7,0x2A,0x50,0x2E,0xAA,
+	0xA5,0x8F,0x6F,0x8D,0xE2,0x82,0x7C,0xE8,0xCB,0x69,0xDA,
+	0xB4,0xEB,0x80,0x5B,0x39,0x8F,0xEE,0x03,0x19,0x24,0x4E,
+	0x1F,0x76,0x3F,0x54,0xCE,0x5C,0xCD,0x09,0x12,0xC3,0x93,
+	0x3E,0x7D,0x2A,0x47,0xF0,0xF2,0x5C,0x77,0xF2,0xFC,0xF6,
+	0x98,0x2D,0xAE,0x60,0xBF,0x9D,0xEC,0xB6,0xF3,0xBB,0xAD,
+	0xE9,0x87,0x97,0x6D,0x0D,0x39,0x28,0x37,0xA7,0x33,0x78,
+	0x5C,0xB3,0xB6,0xB6,0x4E,0xCC,0xE7,0x08,0x47,0x21,0x71,
+	0x13,0x60,0x5C,0xCC,0x05,0x57,0xE4,0x0C,0xC1,0x09,0x8D,
+	0x11,0x25,0x95,0x8F,0x84,0x70,0xEE,0x6E,0xCB,0xB0,0xC5,
+	0x18,0x7A,0x7D,0x5C,0x0B,0x9A,0xD7,0xB2,0x9A,0xC2,0x75,
+	0x18,0x5F,0xC6,0x4C,0x34,0xC7,0x33,0x33,0x92,0x02,0x44,
+	0xDE,0xDD,0x7E,0x8A,0x5F,0xE7,0x00,0xD2,0x2D,0x9E,0x2B,
+	0x76,0x9C,0x83,0x24,0xE2,0x49,0xE1,0xC3,0xFD,0xBD,0x06,
+	0xC7,0x21,0x3D,0xBB,0xDE,0xEB,0x38,0xB8,0x03,0x8D,0xCD,
+	0x87,0x84,0xB4,0xA2,0x96,0x9D,0x97,0x83,0x30,0x87,0xF9,
+	0x9B,0xAD,0x3D,0x91,0x5D,0xA9,0x6F,0x49,0x2E,0x19,0x7B,
+	0x05,0xC9,0xE2,0xE4,0x42,0x82,0xF5,0xC7,0x90,0xAC,0x7D,
+	0x3E,0x56,0xD1,0x3D,0xFA,0xE6,0x73,0x44,0x49,0x94,0x9D,
+	0xD6,0xC9,0x52,0xEE,0xDE,0xBC,0xFF,0x8D,0x75,0x4A,0xBD,
+	0x4A,0xDB,0xBC,0x55,0x81,0x77,0xA7,0x2F,0x84,0x35,0x35,
+	0x19,0x8B,0x91,0x27,0x3F,0x93,0xBB,0xD6,0x60,0x2F,0x3F,
+	0x97,0x8F,0x38,0x97,0x0B,0xEE,0x2C,0x5C,0x5D,0x64,0x35,
+	0x41,0x9D,0x92,0x45,0x25,0x68,0x47,0xAB,0xE7,0x69,0xF1,
+	0xBE,0xCA,0x4D,0x3E,0xCA,0x44,0xD5,0x19,0xF9,0xB2,0x18,
+	0x8B,0x9D,0xE7,0x64,0x1E,0xD0,0x9E,0x8D,0x51,0x63,0x22,
+	0x8C,0xC3,0xD0,0x42,0x2B,0xD6,0xD6,0xBC,0x85,0x4D,0x96,
+	0x11,0x54,0x8D,0x77,0xA2,0x59,0x45,0x1A,0xAF,0x71,0xFD,
+	0x37,0x33,0xE7,0x1B,0xF3,0x9A,0x08,0x87,0xC3,0x12,0x85,
+	0x8A,0x11,0xCB,0xF4,0x4B,0xC5,0xD8,0x4F,0x17,0x48,0x97,
+	0x91,0x15,0x4D,0x8D,0x3E,0x23,0x7C,0x15,0x4B,0x0B,0xDE,
+	0xAD,0xC4,0xAF,0xD1,0xAC,0xF1,0x3D,0xDA,0x6D,0x38,0xAB,
+	0x1F,0x52,0xDF,0x7A,0x37,0xE2,0xBE,0xDA,0xD7,0x4C,0xDF,
+	0x58,0xD4,0x39,0x99,0x71,0xB0,0x53,0x45,0xE1,0xAE,0xE7,
+	0x3C,0xA4,0x87,0x46,0x7E,0x6F,0x16,0xC9,0x3A,0x2D,0x87,
+	0x83,0x5A,0x74,0x42,0x59,0x6E,0x90,0x00,0xCA,0x1E,0x86,
+	0x01,0xEB,0xC0,0x34,0xF3,0x67,0x19,0xD8,0x43,0x7F,0xDD,
+	0x5C,0x2D,0xB5,0xB6,0xCB,0x68,0x34,0x33,0xF7,0x64,0x89,
+	0x40,0x4E,0x28,0xE1,0x32,0x2C,0xD2,0x7D,0x64,0x5D,0x68,
+	0x8D,0x98,0xE0,0x43,0x47,0x21,0xA3,0x98,0xC3,0x33,0x50,
+	0x37,0x9D,0xB8,0x25,0x70,0x3C,0xB2,0xC1,0xA7,0xE0,0xA8,
+	0x48,0x57,0x6B,0x30,0x18,0xCD,0x01,0xB3,0xCA,0xC1,0x35,
+	0x04,0x7E,0x11,0x2B,0xF9,0x6C,0xBD,0x61,0x92,0x38,0x81,
+	0x23,0xCE,0x4A,0xE7,0x5A,0xFB,0x9A,0x67,0x58,0x99,0xEA,
+	0xB3,0xBC,0x32,0x2D,0x31,0xCF,0x69,0x50,0x95,0x4D,0xC4,
+	0xBE,0xB7,0x72,0x4F,0x65,0xF9,0x87,0xAD,0x27,0x31,0x99,
+	0xCA,0xE3,0x73,0x08,0x48,0x7F,0xA8,0xE8,0xE0,0x13,0x11,
+	0xAC,0xE6,0xAA,0xFE,0xAD,0x7D,0x0C,0x6B,0x07,0x94,0x71,
+	0x0C,0xEB,0x70,0xD5,0x57,0xFF,0xF1,0xC1,0xBA,0x9D,0x82,
+	0xC0,0xBB,0x32,0xCD,0xC1,0x12,0x26,0x5F,0x0F,0x30,0x35,
+	0xBB,0x8A,0xCD,0x1B,0xA4,0x4A,0x35,0x87,0xA4,0xD0,0xA9,
+	0x64,0x8F,0xF8,0x0B,0xD8,0x48,0x61,0x97,0x43,0x15,0x21,
+	0xF2,0x01,0xFA,0x83,0x54,0xE8,0x2F,0xD6,0x3A,0x90,0x7E,
+	0x0E,0xED,0xA1,0x26,0xDB,0x55,0x58,0x97,0x48,0xE4,0x4B,
+	0xD5,0xA2,0x1F,0x57,0xF6,0xF4,0x71,0x1E,0x02,0xC7,0x29,
+	0xE0,0xF5,0xCC,0x9D,0x80,0x4D,0x7D,0xB6,0xE9,0x6D,0x18,
+	0xAA,0x3D,0x58,0xD6,0xFB,0x8A,0x2B,0x75,0x9B,0xD2,0x3D,
+	0x18,0x98,0xC7,0x62,0x4B,0x8E,0x19,0xE2,0x4D,0x8A,0x29,
+	0x9D,0x45,0x14,0xD6,0xB7,0xDD,0x7B,0x03,0xFD,0xDB,0x07,
+	0x24,0x0A,0xFC,0xB8,0x97,0xF9,0x03,0x2E,0xD7,0x37,0x71,
+	0x51,0xCA,0x9F,0x8C,0x7B,0xE2,0xF9,0x7B,0x04,0x63,0xD9,
+	0x30,0xBD,0x87,0xCA,0x03,0x7A,0x12,0x9E,0x23,0x64,0x61,
+	0x79,0xC3,0x7B,0xCA,0x1B,0x28,0x48,0xC4,0x49,0x8C,0x57,
+	0x95,0xCA,0x6C,0x99,0x71,0xF3,0xCB,0xF8,0x27,0x8F,0xED,
+	0x2F,0x1F,0x49,0x68,0xDB,0x20,0xEF,0xFE,0xFA,0xDC,0x1C,
+	0x09,0x10,0x44,0xCD,0xAC,0x20,0x58,0xFB,0x3C,0x87,0x77,
+	0xE6,0x72,0x80,0x25,0xC0,0xB3,0x02,0x1C,0x00,0x47,0xC0,
+	0x05,0xF8,0xE0,0x0E,0xBC,0x3C,0xE5,0x05,0x78,0xBF,0x8C,
+	0x03,0x8E,0x02,0x4E,0xB6,0x41,0x57,0x81,0xB6,0x9D,0x70,
+	0xE0,0x5A,0x77,0x2C,0xE0,0xE9,0xB9,0x72,0x1A,0x98,0x3B,
+	0xB0,0x8F,0x66,0x23,0xE6,0x05,0x91,0x21,0xB4,0x57,0x9D,
+	0xFE,0x7C,0x41,0x7C,0x17,0xF8,0x5A,0x16,0x41,0xA8,0x21,
+	0x0E,0xFA,0x07,0xFA,0xDD,0xB1,0x7D,0xE4,0x01,0xA4,0x39,
+	0xB2,0x73,0xED,0x1F,0xD2,0x86,0x6F,0x74,0x9B,0x4F,0x0D,
+	0x55,0x89,0x96,0x4A,0x64,0x63,0xEC,0x82,0x24,0x79,0xB7,
+	0x0B,0x8F,0xB5,0x54,0xA1,0x78,0xB8,0x30,0x88,0xBE,0x04,
+	0x83,0x25,0xB4,0xB1,0xB0,0xF3,0xC7,0x39,0xDF,0x39,0x07,
+	0x96,0xE8,0x8B,0x52,0x6E,0xD2,0x0B,0x10,0xB3,0x84,0xC5,
+	0x54,0x3E,0x81,0xBF,0x6F,0x59,0xC6,0x19,0xEB,0x8D,0x19,
+	0x49,0x3E,0x7A,0x29,0x8A,0x26,0x42,0xC9,0x7B,0x7F,0x73,
+	0x80,0xEA,0xB0,0xBA,0xE4,0x44,0x07,0x89,0xDA,0xEF,0x33,
+	0xB3,0x85,0x07,0x2A,0x21,0x42,0x72,0xC6,0x03,0x08,0xF7,
+	0xE8,0x01,0x65,0x3E,0x9C,0xC4,0xBA,0x65,0xC5,0xF5,0x03,
+	0x02,0x0E,0xF0,0xF2,0x4C,0xBF,0x44,0x06,0x5A,0xB6,0xC3,
+	0xB9,0xFA,0x8B,0x23,0xBB,0xD9,0x97,0x05,0x99,0x1E,0x18,
+	0x70,0x99,0x90,0x38,0x38,0x5A,0x38,0x52,0xB4,0xDF,0xE7,
+	0xDB,0xF3,0x28,0x34,0x6D,0x9E,0x89,0xCB,0x16,0x3A,0x93,
+	0x09,0xB8,0x83,0xF5,0xA3,0xA0,0xCB,0x1C,0x2B,0x95,0x38,
+	0x0A,0x61,0xA4,0x90,0x49,0xDD,0x55,0x57,0x49,0xC2,0x3E,
+	0xA9,0x00,0x7F,0x41,0xB9,0xF2,0xBA,0x3B,0x78,0xF1,0x3C,
+	0x5E,0x66,0x1B,0xAC,0x21,0x9D,0x8C,0x76,0xC8,0x89,0x54,
+	0x75,0x6D,0xF4,0x9B,0x8F,0x50,0x76,0xA9,0x2A,0xF1,0x9A,
+	0xC3,0x2E,0xAF,0x29,0xC7,0x35,0x12,0x8F,0xFC,0xE4,0x12,
+	0xA6,0xA7,0x95,0x9F,0xCB,0xC2,0x3E,0x34,0x5B,0x57,0x99,
+	0x7F,0x66,0x2E,0x4C,0xEA,0x6C,0x1B,0xF8,0x2B,0x2C,0x2E,
+	0x7F,0x5E,0xE2,0x9E,0xBC,0xB7,0xD7,0xFC,0x59,0x6D,0xC7,
+	0x7B,0xBB,0x58,0x21,0xD1,0xB3,0x43,0xAD,0x4A,0xC5,0x88,
+	0x20,0x7C,0x53,0xEF,0xF3,0x15,0x20,0x36,0x16,0xF0,0x9E,
+	0xD0,0x5E,0x1F,0x00,0xCE,0x11,0x35,0xC4,0x63,0x67,0x71,
+	0x6B,0x70,0xAB,0xD2,0x84,0x53,0x39,0x45,0x57,0xB7,0x5A,
+	0xD7,0x12,0xF8,0x6F,0xB8,0x1C,0xF2,0xA8,0x98,0x4D,0xD5,
+	0x95,0xDA,0x17,0x49,0x4F,0x6B,0x15,0x4E,0xC1,0xE9,0x7C,
+	0x46,0xDB,0x94,0x89,0x35,0xDD,0x6A,0x05,0x93,0x95,0x0F,
+	0x0A,0x6D,0x0D,0xD8,0xA3,0x8D,0x60,0xF0,0x64,0x04,0xB4,
+	0xBE,0x9F,0xDA,0xC6,0x0B,0xC7,0xD3,0xA5,0x76,0x6D,0xEF,
+	0x48,0x7E,0x92,0x76,0x38,0x87,0x5F,0x7E,0xC9,0xEF,0xD6,
+	0xAE,0xF7,0x4D,0xCD,0x45,0x5F,0xB7,0x49,0x4A,0xF7,0xBA,
+	0x9F,0xB7,0xB9,0x96,0x1D,0x33,0x2B,0x8A,0x11,0x3D,0xFC,
+	0x88,0x9F,0x35,0xD9,0x02,0xB4,0x63,0xE1,0xFC,0x27,0xFF,
+	0x4B,0x16,0x68,0xD9,0x4A,0x71,0xAD,0xAA,0x6E,0xAE,0x14,
+	0x8C,0xC5,0x4F,0x27,0x65,0xF6,0x18,0xA6,0x75,0x18,0xEA,
+	0xCA,0x1B,0x7A,0x61,0xAF,0xBC,0x54,0x97,0x5B,0xCD,0x14,
+	0x57,0x13,0xB6,0x23,0xDC,0x3C,0xF5,0x04,0xE2,0x15,0xA5,
+	0x94,0x57,0x8F,0x85,0xC4,0x50,0xD8,0x34,0xF6,0x53,0xD7,
+	0xB0,0x68,0x08,0x04,0x61,0xE8,0xF3,0x92,0x0F,0xA1,0xDC,
+	0xDF,0x2E,0x82,0xF0,0x54,0x92,0x89,0xEF,0xE1,0x74,0x8D,
+	0x5B,0x49,0x99,0x19,0xF7,0x27,0x90,0xFE,0xED,0x6C,0x75,
+	0x82,0x19,0x7C,0xF2,0x19,0x87,0x5A,0xC0,0x23,0x2C,0x8F,
+	0x66,0xDE,0xBA,0x5F,0xC1,0x9C,0x6E,0xD2,0x22,0xAF,0x83,
+	0x74,0x1F,0x78,0x39,0x62,0x22,0xC9,0x6E,0x96,0x50,0xDF,
+	0x3B,0x0D,0x39,0x2A,0x88,0xB3,0x6C,0xE2,0x3B,0xFB,0xD0,
+	0x8C,0x2E,0x4D,0x42,0x23,0x5D,0x31,0xAF,0xC8,0xBD,0x03,
+	0x77,0x8D,0xAF,0x99,0x27,0x72,0xB4,0x87,0xAC,0xEF,0x17,
+	0x38,0x3F,0x55,0x73,0xDB,0xC8,0x1F,0x35,0x89,0x7B,0x42,
+	0xE9,0x78,0x32,0xDD,0x39,0xFB,0x45,0x2A,0x7D,0x27,0x49,
+	0xFE,0x7C,0xB4,0x0B,0x1B,0x39,0xCB,0x17,0xC8,0x40,0xFB,
+	0xF1,0x3D,0x4F,0xE7,0x93,0x2B,0x05,0xB7,0x64,0xB2,0xB2,
+	0x1D,0x7A,0x5E,0x6A,0x8D,0x18,0x49,0xB1,0x94,0x13,0x88,
+	0xE3,0x66,0xCA,0x0C,0x85,0x59,0x6C,0x42,0x02,0x6C,0x16,
+	0x1A,0xC4,0x90,0xF8,0x2E,0xE4,0xDA,0xA0,0x30,0x93,0x26,
+	0x47,0x57,0xC5,0xDE,0x87,0x8A,0x47,0xDB,0x81,0x3A,0x3F,
+	0x55,0xCB,0x53,0x8D,0xCF,0x65,0xBC,0x05,0x2C,0x22,0xAE,
+	0xAA,0xCC,0xA1,0xD2,0x09,0x6B,0x7F,0xAB,0x36,0xA5,0xDA,
+	0x60,0x5D,0xE8,0xB6,0xC8,0x9A,0x8F,0xB8,0x97,0x92,0x19,
+	0xEF,0x2C,0x7C,0x35,0xB4,0xD6,0x24,0xF3,0x29,0xB0,0x0F,
+	0x3A,0x92,0x5F,0x47,0x34,0xEA,0xF5,0x61,0x6E,0x2A,0xBD,
+	0xDD,0x36,0xA6,0xC3,0x8A,0x86,0x57,0xA2,0xE5,0x71,0x97,
+	0xC9,0xBE,0xBB,0xDC,0x2A,0x5A,0x01,0x29,0x42,0x6D,0xAA,
+	0x97,0x6E,0x0F,0x3E,0x6B,0x27,0x4F,0x37,0x3A,0xA7,0xDD,
+	0xDF,0xC8,0x2D,0x90,0xD9,0xAE,0x80,0x28,0xDA,0x86,0x6F,
+	0xC8,0xE5,0x76,0x24,0xA3,0xBA,0xCE,0x91,0x7E,0xA1,0x16,
+	0xE9,0xA7,0x34,0x1F,0x7A,0xDF,0x7A,0x7C,0x92,0xC8,0x57,
+	0xF1,0xB5,0x46,0xCE,0xE5,0xD2,0xCF,0xC3,0x04,0x4C,0x31,
+	0xB9,0xAC,0x75,0x06,0x4C,0xC3,0xF4,0xDC,0xD3,0x4C,0x08,
+	0x8E,0x2A,0xB8,0xDC,0x2D,0x03,0xAB,0x98,0x6B,0x12,0x0E,
+	0xC1,0x30,0xF4,0xF9,0x33,0x05,0xD4,0x91,0x57,0x7F,0xB2,
+	0x2B,0x0D,0x45,0xEE,0xD6,0x8C,0xE1,0xDF,0x94,0xBE,0x29,
+	0xBE,0xF0,0xA1,0x54,0x70,0xCF,0x15,0x53,0xF6,0xC0,0xBC,
+	0xDF,0xF4,0x8D,0xD4,0x54,0xDC,0x8A,0xA0,0x1E,0xFC,0x8E,
+	0x0E,0x3C,0x38,0x60,0xB0,0xF7,0xDE,0xF6,0xD0,0x73,0x1E,
+	0x07,0xDD,0xC3,0x90,0x8E,0x15,0xA4,0x3C,0x0A,0xB8,0x74,
+	0x7D,0x65,0x79,0x80,0x3B,0xF4,0xE7,0x2E,0x0E,0xC5,0xC1,
+	0x25,0xA8,0xC6,0x4A,0x3B,0xF4,0x36,0x3C,0xF0,0xC1,0x34,
+	0x18,0xDD,0x28,0xE0,0x06,0x66,0xA5,0x7B,0x4E,0x5F,0xE0,
+	0x60,0x97,0x1D,0x62,0xED,0xA5,0x18,0xD5,0xF9,0x8A,0xF4,
+	0x44,0xEF,0xB3,0x81,0x44,0x8C,0xD1,0x99,0x72,0x9B,0xCC,
+	0xB3,0xAD,0xAB,0xF6,0x64,0x9A,0x0F,0x46,0xA5,0x15,0xD7,
+	0x7A,0x41,0x7C,0x78,0x01,0xC3,0x7E,0xE2,0x7C,0x17,0x65,
+	0x6D,0xCA,0x46,0xB3,0x08,0x76,0xA7,0xCB,0xB5,0x7B,0x5E,
+	0x74,0xA0,0x7C,0x37,0x70,0xBD,0x69,0x8A,0x5E,0xFE,0x7E,
+	0xD6,0x98,0x52,0x1F,0x5C,0x38,0x46,0x7B,0xE3,0xB8,0x89,
+	0x5C,0x06,0x5B,0xC7,0xA3,0x2A,0x4E,0x97,0xA4,0x9E,0xC2,
+	0x00,0xD9,0x3B,0xA2,0x33,0x89,0xD1,0x24,0x82,0x68,0xE7,
+	0xA0,0xA0,0x1B,0x15,0x49,0xBC,0xE4,0xD3,0x23,0x2C,0x10,
+	0xD3,0x12,0xB2,0x89,0x03,0x4D,0x30,0x44,0xD4,0x71,0xA9,
+	0x78,0x3E,0x3D,0x13,0x27,0x1E,0xBC,0x67,0x17,0x25,0xE2,
+	0x89,0x11,0xE6,0x66,0x9C,0x00,0xFB,0x73,0x9F,0x2A,0x3A,
+	0xB2,0x90,0x59,0xE2,0x9A,0x99,0x1E,0x6D,0x05,0x72,0xD9,
+	0x01,0x99,0x7E,0x51,0x0C,0x94,0xE9,0xA8,0xAF,0xDC,0xF8,
+	0xC7,0xE1,0xD2,0xC2,0x77,0x4A,0x86,0x62,0xB1,0xD9,0x2E,
+	0x27,0x32,0x93,0xCF,0x15,0x13,0xCE,0xBD,0xE3,0x96,0x83,
+	0x1A,0x85,0x05,0x26,0xD9,0x85,0x67,0x5E,0x72,0xEF,0xED,
+	0x3D,0xE4,0x9E,0xA3,0x2E,0xD8,0x54,0xB4,0x0B,0x29,0x42,
+	0x2D,0xB9,0xB9,0x76,0x2F,0xFA,0xED,0x5E,0x1A,0x7D,0x81,
+	0x74,0x1C,0xD3,0x51,0xEB,0x14,0x32,0x3C,0x55,0xC1,0x27,
+	0x83,0x5B,0xDB,0xC8,0xBE,0xF1,0xCA,0xC3,0xF7,0xDE,0x0B,
+	0xEA,0x8C,0xF1,0xE7,0xB8,0x5C,0x64,0xE8,0x4F,0xF3,0x79,
+	0xF6,0x57,0x4B,0x57,0xE0,0x4B,0x74,0x45,0xB0,0xDE,0xFC,
+	0xB5,0x17,0x5A,0xDA,0x3C,0x69,0x11,0x64,0x64,0x87,0xB1,
+	0x4F,0x61,0xB5,0x30,0x8E,0x89,0x3E,0x32,0xC9,0x34,0x6B,
+	0x3A,0x30,0x42,0xDD,0x1B,0xC8,0xE3,0xD7,0x15,0x05,0xDF,
+	0x20,0xA8,0x5C,0xB9,0x48,0xB5,0xB2,0x7A,0x06,0x3E,0xEF,
+	0xA8,0x47,0x41,0x1D,0x0B,0x11,0x0D,0x68,0x19,0x40,0x22,
+	0xBD,0x1C,0xF8,0x30,0x9E,0x03,0x31,0xF4,0xB2,0xBE,0x0F,
+	0x97,0x48,0x3E,0x0B,0xED,0x84,0x3B,0x6F,0x5F,0xE8,0x2A,
+	0xAA,0xAB,0xF2,0xCE,0x1D,0x4A,0x50,0xB3,0xE8,0x95,0x36,
+	0x48,0x3A,0x5A,0xC4,0xBB,0xC6,0x9F,0x4F,0x8E,0x96,0x2A,
+	0xEA,0xD2,0xFF,0x8F,0x54,0x14,0xE6,0x43,0xDC,0xE6,0x24,
+	0xC8,0xA5,0x9B,0x11,0xB7,0x50,0x09,0x08,0x38,0x07,0xCB,
+	0x10,0x3A,0x76,0x1C,0xA2,0x22,0xAC,0xD6,0xB5,0xF3,0xAC,
+	0xE0,0xF7,0xCF,0x22,0xAD,0xF3,0xC5,0x5E,0x24,0xC4,0x30,
+	0x18,0x7D,0x9A,0x20,0xF0,0x70,0x92,0x3D,0x85,0x32,0x00,
+	0x40,0x97,0x49,0x37,0x4E,0xA2,0x14,0x06,0x5D,0xFA,0x9B,
+	0x66,0x1B,0x14,0x8D,0xBF,0x6C,0x4D,0x86,0x54,0x1C,0x93,
+	0xCE,0x1A,0x22,0x09,0x97,0x66,0x07,0xE9,0x19,0xD3,0xFB,
+	0x64,0x50,0xB9,0xDD,0x37,0x4B,0x2D,0xC4,0x5B,0xCB,0xF4,
+	0x6D,0xB6,0xA5,0x68,0xC2,0x8E,0x06,0x6B,0xDA,0xF6,0x45,
+	0xA6,0xA0,0x48,0x31,0xA9,0xEB,0x9A,0x31,0x34,0xF5,0x60,
+	0xC9,0x80,0x09,0x47,0xDB,0x00,0x4E,0xD6,0x31,0x0E,0x95,
+	0x57,0xA9,0xF0,0xAB,0x09,0xF0,0x73,0xB8,0x14,0x58,0x26,
+	0xD8,0xFA,0x62,0xF9,0xF2,0x85,0xA4,0x2A,0x3F,0x6B,0x2C,
+	0x16,0xC1,0x75,0xBC,0xDA,0xD1,0xA8,0xD6,0xE1,0x0A,0x3F,
+	0x3C,0x32,0x58,0x17,0x3B,0x88,0x6D,0x6B,0xA6,0x69,0x06,
+	0x9E,0x9A,0x0F,0xDB,0x77,0x39,0x09,0x52,0x48,0xFE,0xC4,
+	0x62,0xF9,0x82,0xDE,0xCA,0x4D,0xC6,0x0C,0x02,0x49,0x46,
+	0x7C,0xC3,0x37,0x0C,0xDD,0xFE,0x7E,0x8D,0x37,0xB2,0xC6,
+	0x7E,0x3D,0x64,0x0D,0x19,0x6F,0xF3,0x74,0x8F,0x31,0x0D,
+	0xEC,0x95,0xA6,0xDB,0xC7,0x4B,0x9C,0xBB,0xC1,0x82,0x81,
+	0x42,0x75,0xEB,0xE7,0xE6,0x52,0xE4,0xAD,0x19,0x17,0x30,
+	0x7D,0x9F,0xE4,0x95,0xDD,0x60,0x71,0x47,0xE1,0x83,0x87,
+	0x66,0x62,0x4E,0x36,0xF2,0x68,0xAF,0x46,0xE9,0x38,0xAC,
+	0x75,0xC5,0x51,0xC5,0x82,0x6F,0xDE,0x8E,0x81,0xF5,0xF3,
+	0x20,0xD2,0x51,0xD1,0x9A,0xC1,0x14,0xF2,0xC1,0x7E,0x49,
+	0x95,0xAA,0x43,0x7E,0xA2,0x9A,0xB0,0x55,0x3F,0xB6,0xBB,
+	0xF9,0x40,0x4E,0x4B,0xF8,0x39,0x79,0xFE,0x0D,0x5A,0xBA,
+	0x7B,0xB4,0x2B,0xB3,0x97,0x2E,0xFE,0x97,0x2A,0xCF,0x11,
+	0x62,0x4E,0xFA,0x6F,0xE7,0x0A,0xE5,0xF7,0x1C,0x8B,0x65,
+	0x0B,0xC9,0x5A,0x52,0x2D,0x1A,0xB9,0x7B,0xE8,0xC0,0xD8,
+	0x17,0xDC,0x1B,0x66,0xF7,0x51,0x8C,0xD7,0x79,0x71,0xBE,
+	0x52,0x7E,0x57,0xB8,0xB2,0x9A,0x3F,0x50,0x77,0x3D,0x0F,
+	0x7D,0xC8,0x59,0xDB,0x38,0x81,0xF3,0x44,0x8E,0x71,0x96,
+	0xF5,0xB8,0x1A,0x75,0xEC,0x55,0x49,0xBC,0x07,0xCB,0xC3,
+	0x1B,0x67,0x3A,0x81,0x16,0x0D,0x28,0x7B,0xA7,0xFF,0xA7,
+	0xD2,0x42,0x92,0x20,0xE6,0x7D,0x7D,0x40,0xDE,0x2C,0xF2,
+	0xD7,0xFE,0x21,0xE1,0xAD,0x26,0x38,0x9F,0xA3,0x20,0xFD,
+	0x50,0x88,0x09,0x81,0x24,0x59,0x79,0x64,0xD0,0x38,0xD8,
+	0xAD,0xDC,0xCD,0x10,0x8C,0x2E,0xA1,0x2D,0xF6,0x46,0x6A,
+	0x28,0xE6,0x4F,0xC7,0xE0,0x09,0x6F,0xC6,0x33,0x6A,0xA2,
+	0x12,0xC1,0x69,0x8E,0x99,0x71,0x09,0x69,0x89,0x85,0x0F,
+	0xFE,0xB4,0x2A,0x9B,0xED,0xF9,0x41,0x19,0xFC,0x19,0xD8,
+	0x9A,0x70,0x53,0xCE,0x4D,0x6C,0x5B,0x31,0x69,0x4A,0x70,
+	0xE7,0x3E,0xB6,0xD4,0x04,0xEE,0xB3,0x73,0xCB,0xCE,0x2C,
+	0x40,0xF8,0x26,0xB1,0x2C,0xCE,0x52,0xAE,0x47,0x90,0xB8,
+	0x13,0x36,0xD8,0x51,0xAC,0xF7,0xE7,0x0F,0xAF,0xE0,0xFE,
+	0xE8,0xD9,0x01,0x13,0x71,0xEC,0x5F,0xA4,0x0E,0x0A,0xB9,
+	0x1F,0x7D,0x73,0x2F,0xC1,0x1F,0xCD,0x49,0xA4,0xD3,0x27,
+	0xD4,0x46,0x24,0xFB,0x34,0x34,0xC8,0xCE,0xA8,0x23,0x61,
+	0x66,0xB4,0x97,0xD4,0x83,0xC3,0x28,0x8C,0x6A,0x42,0x82,
+	0x0B,0x7C,0x2D,0x06,0x1D,0xC9,0xAA,0xD1,0x8C,0x7E,0xC5,
+	0x91,0xF7,0x74,0x76,0x3A,0xA6,0xAA,0x2C,0xE6,0x6D,0x59,
+	0x57,0xA2,0x12,0x8E,0xDC,0x3C,0x7C,0xF9,0x0E,0x52,0x78,
+	0xE0,0x20,0x5C,0x4E,0xB8,0x5F,0x0A,0xA4,0xEF,0x1E,0x39,
+	0x5A,0xF4,0xA2,0xA0,0x0B,0x11,0x9D,0xCC,0x94,0x6A,0x8D,
+	0x04,0xDF,0xA8,0xD1,0xEA,0x97,0x09,0x20,0xD6,0x2F,0xB7,
+	0xBE,0x17,0x89,0x75,0xBB,0x63,0x66,0x51,0x1D,0xBF,0x40,
+	0x6A,0xA0,0x66,0x49,0x2C,0x2C,0x3F,0xED,0xA6,0x78,0x5D,
+	0xA6,0x96,0xDC,0xDD,0x9E,0x55,0xED,0xCE,0xEA,0x49,0x17,
+	0xEF,0x53,0x21,0xC7,0x56,0xB4,0xE0,0x14,0x39,0x0A,0xE8,
+	0xC1,0x37,0x4D,0x3D,0x22,0x0D,0x2A,0x32,0xE2,0xA7,0x48,
+	0xD7,0xB2,0x42,0xD0,0x4F,0xC5,0xFB,0xDD,0xC5,0xBE,0x51,
+	0x0D,0x42,0x36,0x33,0x39,0x15,0x26,0x09,0x78,0x19,0x35,
+	0x8E,0xCA,0x66,0x93,0xD0,0x39,0x38,0x93,0x23,0xBA,0xE9,
+	0xE5,0x02,0xA5,0x82,0xC2,0x03,0x6E,0xDC,0x6A,0x82,0x4C,
+	0xA8,0x18,0xBE,0x4F,0x40,0x6B,0xEB,0x34,0x44,0x1B,0x55,
+	0x17,0x1B,0xD8,0xDC,0xB2,0x67,0xF3,0x5D,0x3B,0xC9,0x61,
+	0xE4,0x7D,0x93,0xF8,0x70,0xC1,0x5E,0x43,0xC5,0x00,0x5E,
+	0xFC,0x76,0x32,0x58,0x89,0x16,0xE6,0x65,0x7E,0xA1,0xAA,
+	0x6C,0x94,0xC2,0x8C,0x49,0xCB,0xE8,0x01,0x38,0xF7,0x05,
+	0xDF,0x12,0x02,0x8E,0x37,0x49,0x21,0x60,0x36,0xDB,0xD1,
+	0x67,0xC6,0xB6,0x3F,0x80,0xD0,0x40,0xDB,0xF6,0x05,0x44,
+	0x6B,0xBA,0x54,0x3D,0xAB,0x4F,0x53,0xB2,0x62,0xA4,0x5C,
+	0xE7,0xA0,0xD2,0x9E,0xF0,0x57,0xD0,0x53,0x6D,0x07,0x61,
+	0xE3,0xAD,0x7E,0x21,0xDB,0x88,0x29,0x74,0x72,0xFA,0xE1,
+	0x4C,0x6C,0x38,0xE8,0x54,0x5F,0x9A,0x1C,0xA4,0xCC,0x21,
+	0xDC,0xF9,0x5A,0x83,0x6B,0xFE,0x7E,0x16,0x40,0x29,0x83,
+	0x6C,0xB7,0xD7,0xA4,0x6D,0x0A,0x1B,0x82,0x8F,0xE2,0x8A,
+	0xB4,0xE7,0x21,0xE0,0xD4,0x88,0xB7,0x08,0x13,0xDB,0xCD,
+	0x9F,0x03,0x4E,0x9B,0x5B,0xF6,0xCE,0x6A,0x87,0xF7,0xBC,
+	0x40,0xCD,0x00,0xA4,0x07,0xFC,0xBB,0xD2,0xCE,0x56,0x6A,
+	0x4D,0x0B,0xD4,0xD4,0x34,0xE1,0xF5,0xE6,0xEC,0x7D,0x61,
+	0x57,0xBF,0x88,0xE5,0x59,0x01,0x84,0x38,0x8A,0x0C,0x81,
+	0x87,0xED,0x10,0x1E,0x73,0x32,0x25,0xAE,0x44,0x3A,0x46,
+	0x21,0xF4,0x2A,0xCB,0x1D,0x1B,0x27,0xC3,0x24,0x48,0x1C,
+	0x7F,0x48,0x8B,0x73,0xFD,0x9C,0x65,0xA6,0x24,0xA8,0xD9,
+	0x55,0xCD,0x4F,0xA5,0x4C,0x30,0xB8,0x28,0x4B,0x01,0x94,
+	0xAD,0x54,0x98,0x2D,0x72,0xD9,0xFE,0x56,0x77,0xFF,0xEB,
+	0x0C,0xFC,0xD5,0x9B,0x8F,0xC4,0x38,0x42,0xB9,0xBF,0x1F,
+	0x58,0x7D,0x8C,0xCB,0x15,0x03,0xA6,0x32,0x54,0x3E,0x20,
+	0xA8,0x93,0x86,0xC7,0xC4,0x80,0x53,0x76,0x62,0x2E,0xED,
+	0xB0,0xD9,0x17,0x88,0xE7,0xB0,0xEA,0x40,0xF1,0x44,0x03,
+	0x2D,0x94,0xFA,0x4F,0xB6,0x4D,0x1A,0xE2,0x08,0x57,0x3A,
+	0xD1,0x38,0x23,0x7A,0x09,0x7E,0xEC,0xD7,0x3F,0x6D,0xDE,
+	0x6F,0x03,0x69,0xD7,0xBF,0xA2,0xFF,0x04,0x41,0xD4,0xA9,
+	0x75,0x51,0xC7,0xAC,0xD8,0x15,0x33,0x7C,0xC6,0xAD,0x31,
+	0xD1,0xFF,0x47,0x83,0x4F,0xB0,0xF9,0x28,0xEA,0x77,0x77,
+	0xFC,0x03,0xA4,0xE5,0x85,0x40,0x95,0xD3,0x97,0x45,0x5D,
+	0x45,0x41,0x3D,0xE4,0xD5,0xA8,0x53,0x7A,0x3A,0x31,0x0F,
+	0x45,0x50,0x1F,0xB4,0x29,0x2F,0x8F,0x89,0xFD,0x11,0x9C,
+	0xE5,0x57,0x25,0x65,0x87,0x99,0xA7,0xE6,0x4B,0xB0,0x0F,
+	0x77,0xE3,0xC2,0x64,0x9D,0xE7,0x63,0xCF,0xE8,0x3F,0xCA,
+	0xCF,0x11,0x67,0x54,0xF5,0x1B,0x33,0x05,0xEF,0x71,0x83,
+	0xC5,0xC3,0x45,0xDF,0xBD,0xB5,0x1F,0xE8,0x0B,0x95,0xAE,
+	0x93,0x1B,0x2D,0x5B,0x95,0xBD,0x2B,0x36,0x80,0x48,0x1E,
+	0xD7,0x2D,0xC8,0xF4,0xF4,0x43,0x0A,0x6D,0x61,0x28,0x76,
+	0x8E,0xC2,0x77,0xAD,0x9F,0x89,0x97,0x7F,0xCA,0x10,0x42,
+	0x88,0x11,0xBB,0x26,0x2E,0x4E,0x45,0xA9,0x95,0xE0,0x75,
+	0x42,0x4F,0xDF,0xFB,0x50,0x02,0xEF,0x39,0xBD,0x32,0xAA,
+	0x1B,0x1B,0xC5,0x08,0x84,0xE8,0xF5,0x80,0xE0,0x33,0xB8,
+	0x2A,0xB0,0x95,0xCF,0x62,0x12,0x4F,0x10,0x9B,0x63,0x8D,
+	0xAA,0x01,0x93,0xE5,0xFB,0xBA,0x1D,0x4E,0xD7,0x49,0xCE,
+	0xEF,0xDC,0x7D,0x2C,0x2C,0x7A,0xF3,0x7E,0xC7,0x12,0x27,
+	0x47,0x55,0xA2,0xF9,0x0C,0xDF,0x3E,0x06,0x36,0xFF,0x54,
+	0x10,0xFA,0x44,0xF9,0x57,0xC6,0x6A,0x11,0x20,0xE1,0x8B,
+	0x99,0xB1,0x30,0x75,0x8E,0x17,0xFA,0xB3,0x82,0x07,0xE9,
+	0x5B,0x8C,0x2D,0xD6,0x6E,0x8D,0xBE,0x14,0x63,0x09,0x01,
+	0x14,0x75,0xE9,0x5E,0xB3,0x55,0xD6,0x2A,0x20,0xC3,0xC8,
+	0xF8,0x8F,0xFE,0x75,0x1F,0x21,0x6B,0x98,0xF2,0xB0,0x6C,
+	0xC1,0xEB,0x83,0xAE,0x83,0xDE,0x43,0xF6,0xD9,0xB2,0x7C,
+	0x3A,0x71,0x53,0x65,0xF3,0xB5,0xEF,0xE8,0x3F,0x93,0xC8,
+	0xFB,0x28,0x15,0xAD,0xBD,0xD7,0x53,0x3F,0xED,0xD6,0xF2,
+	0x89,0xB6,0x3C,0xA7,0xBD,0xC2,0x0B,0x71,0xBC,0x18,0xD3,
+	0x3D,0xED,0x19,0x9E,0xF2,0x68,0xE6,0x0C,0x80,0x9E,0x49,
+	0xC9,0x73,0x8C,0xEA,0xD8,0x49,0x07,0xE2,0x2C,0x7B,0x44,
+	0xB6,0x99,0xBF,0x3D,0xE1,0xC5,0xC1,0xE7,0x17,0x98,0xDB,
+	0x3F,0x91,0x44,0x34,0x2F,0xFE,0xF8,0x37,0xEF,0x84,0x24,
+	0xE5,0x2F,0xCE,0x6C,0xD7,0x15,0x3D,0x32,0xAC,0x20,0x6C,
+	0xE7,0xFE,0xCC,0x54,0x3C,0xCF,0x51,0x92,0xD9,0xA3,0x7F,
+	0x27,0x51,0x21,0xE2,0x90,0xD0,0x94,0xBB,0x33,0xFF,0x20,
+	0xBD,0xAC,0x96,0xF6,0x02,0x32,0xA0,0xDC,0xAF,0x9C,0x81,
+	0x2C,0xE5,0x73,0x90,0xBA,0xAE,0xCD,0x81,0xA5,0x7F,0xD2,
+	0xC2,0xC6,0xAB,0x9F,0x0F,0xE3,0xB7,0x83,0xE0,0xEB,0x66,
+	0x0D,0xF9,0x3B,0xA0,0xF8,0x74,0x42,0x1C,0x16,0xE1,0xAA,
+	0x21,0x3A,0x38,0x37,0x6C,0x78,0x01,0xFE,0x89,0x6B,0x0C,
+	0x27,0x53,0x12,0x8C,0xAB,0x47,0xA1,0x89,0x9E,0x3B,0x34,
+	0xA3,0x72,0x2E,0x48,0x30,0xF8,0x21,0x1D,0xBB,0x23,0xDA,
+	0x69,0x14,0xBF,0xF7,0xEC,0x55,0xD2,0xE4,0x45,0x61,0xF4,
+	0xF6,0x78,0x0A,0x26,0x0D,0xB6,0x4C,0x4A,0x6C,0xF8,0xFA,
+	0xAB,0x7A,0xBE,0xDE,0x12,0x8C,0xCF,0xF1,0x95,0x3C,0xB2,
+	0xF3,0xF3,0x0E,0xCF,0xEC,0xB0,0xF6,0x9A,0x13,0x59,0xCA,
+	0x6D,0x65,0x81,0xF9,0x39,0xA0,0x33,0xE2,0x22,0x34,0x1C,
+	0xB3,0x3A,0xCF,0x74,0x55,0x7B,0x77,0x08,0x3A,0x85,0xC6,
+	0x59,0xAA,0xF4,0xE2,0x5D,0x46,0x9E,0xC7,0xB8,0x8E,0xC8,
+	0x89,0x15,0x0D,0xF5,0x7D,0x66,0xE3,0xB5,0x7E,0x50,0xD4,
+	0xDC,0x5E,0x8D,0x74,0x92,0xE8,0x52,0xDB,0x8B,0xC8,0xEA,
+	0x73,0x00,0x46,0xB2,0x47,0xB5,0x21,0xB4,0xDC,0x18,0x55,
+	0x2E,0x0F,0x2C,0xC9,0x2B,0xAD,0xC1,0x3D,0xFA,0x4E,0xEC,
+	0xEC,0x29,0x77,0x95,0x3F,0xA7,0x9D,0x51,0x79,0xD3,0x19,
+	0xF6,0x63,0x32,0x4E,0x7C,0x32,0x17,0xD4,0x92,0xB0,0xF5,
+	0x12,0x2D,0x99,0xCE,0xD9,0x55,0x4E,0x80,0x43,0xC7,0x55,
+	0x31,0xB3,0xB6,0xE4,0x8F,0x7C,0xEA,0x75,0xEA,0xE9,0x6C,
+	0x9E,0x46,0xDC,0x81,0xAD,0xAF,0x90,0x5E,0x02,0x77,0x22,
+	0x61,0x85,0x4D,0x60,0xEE,0x7C,0x37,0xC0,0xF1,0xAE,0xE5,
+	0x8C,0x6D,0x2D,0x94,0x5C,0x8B,0x16,0x24,0x8E,0xF5,0x2A,
+	0x5D,0x87,0xC5,0xCF,0xF3,0x5C,0x52,0x10,0x5B,0xD3,0x5B,
+	0x93,0x99,0xF7,0xA6,0x35,0x5E,0x20,0x12,0x80,0x6B,0x5A,
+	0xA9,0x00,0xE5,0xC0,0x8E,0x64,0x93,0xF1,0x2B,0x5A,0x82,
+	0x15,0x6A,0x34,0x8E,0x61,0x00,0x55,0x7D,0xF8,0x34,0x51,
+	0xAF,0x49,0x64,0x12,0x5F,0xC6,0x6F,0x32,0x87,0xCB,0x17,
+	0x2F,0x0B,0x3D,0x30,0xFB,0x1E,0xD3,0x64,0x3D,0x33,0x83,
+	0xD2,0x40,0x40,0x2E,0xA5,0xA8,0x67,0xC2,0x43,0x13,0xCC,
+	0x46,0xBC,0x04,0xBB,0xE2,0x30,0xDE,0xA6,0x2A,0x2E,0xAB,
+	0x21,0x12,0x6B,0x9E,0xA1,0x6D,0xF6,0x8E,0xAF,0x26,0xCE,
+	0x9D,0x84,0x38,0xE6,0x83,0x9D,0x92,0x32,0xFA,0x04,0x68,
+	0x9D,0x9A,0xE8,0x81,0x04,0x4A,0x43,0x33,0xD0,0x27,0x27,
+	0xEC,0x4C,0x7A,0x81,0xDE,0x1A,0x73,0xF4,0x8D,0x33,0x5B,
+	0xA0,0x50,0x0B,0xFC,0xA7,0x0A,0x7A,0xD1,0x73,0xCB,0x79,
+	0xA9,0x7B,0xA3,0xBE,0x87,0x6C,0xB4,0x25,0x22,0xA0,0x61,
+	0x5A,0x5F,0x72,0xFB,0x4C,0xBF,0x0A,0x63,0xE8,0xDA,0xB0,
+	0x6C,0xD4,0xC3,0x85,0x45,0xA3,0xF9,0xCF,0xF6,0xCC,0x29,
+	0xA7,0x2B,0x86,0x1C,0x53,0xC6,0x17,0xC9,0x28,0x1E,0xFC,
+	0xCF,0x7D,0xA9,0x9C,0x61,0x46,0xDE,0xF8,0xB5,0xA6,0x82,
+	0x9E,0x12,0x34,0x11,0x12,0x7E,0xE2,0xFA,0x2F,0x18,0xA0,
+	0x61,0x89,0x78,0x27,0x9E,0x9F,0xFF,0x4A,0x41,0xCA,0x44,
+	0x00,0x41,0x54,0xB5,0x96,0x5F,0xD4,0xEE,0x9C,0x6C,0xD2,
+	0x93,0x58,0x65,0xFE,0x11,0xF7,0xE0,0x2C,0xEA,0x53,0x24,
+	0xFC,0x90,0x57,0x44,0xC9,0xA7,0x93,0x9D,0xA0,0xD4,0xA7,
+	0x51,0xD1,0x15,0x08,0x5C,0x89,0xC4,0x71,0x5C,0x58,0x47,
+	0xA1,0xEB,0xEF,0x3C,0xD7,0xDB,0xBF,0xFB,0xED,0x66,0x7E,
+	0x7B,0x40,0xFE,0xDC,0x1F,0xD1,0xA4,0x33,0x36,0x9D,0xA2,
+	0xFE,0xC6,0xC8,0x9A,0xC8,0xC5,0xED,0x0A,0x9A,0xC8,0x27,
+	0x09,0x90,0x13,0xFF,0xEA,0xE1,0x39,0x9C,0x8B,0x70,0xA5,
+	0x99,0x6D,0xE1,0x1D,0x95,0x57,0x76,0xA6,0x1B,0x3A,0xBC,
+	0x84,0x5F,0xAE,0xCC,0x27,0x99,0xC7,0x9A,0x0B,0x9C,0x61,
+	0xFD,0x47,0x4E,0xF5,0xA7,0xDC,0xC9,0xEC,0x88,0x90,0xAA,
+	0x70,0xBB,0xFD,0xF5,0xC6,0x8D,0xD8,0x68,0xB8,0xDC,0x9F,
+	0x8B,0xD0,0x8B,0x36,0x74,0x0C,0x0C,0x19,0x09,0xC6,0x75,
+	0x62,0x32,0x83,0x31,0xA0,0xE6,0x3C,0x85,0xBC,0x19,0xD5,
+	0x3C,0xED,0xA8,0x3C,0xC3,0xB5,0x3C,0xA8,0x94,0x5D,0x36,
+	0x2D,0xFF,0x6B,0x07,0xE0,0x2D,0x39,0x35,0x04,0x1E,0xEC,
+	0x67,0x61,0x2E,0xAB,0x36,0x16,0xE1,0x30,0xF0,0x74,0x0D,
+	0x8F,0x66,0x5D,0xDF,0x8B,0x18,0x5C,0x26,0x4A,0xCE,0x59,
+	0xED,0xEB,0x35,0xB8,0x8D,0xCE,0x29,0xF1,0x9D,0x0A,0x1A,
+	0x4E,0x2F,0x09,0x75,0x1A,0x73,0xC9,0x3A,0xE6,0x78,0x0F,
+	0x1B,0x2E,0x69,0x07,0xDB,0x83,0x06,0x8C,0x0C,0x43,0x05,
+	0xE9,0x2F,0xBC,0x79,0xA9,0x90,0x0E,0x2F,0x20,0x4F,0x4F,
+	0xB8,0x8A,0xF2,0x34,0x44,0xD4,0xFA,0x25,0x4D,0xA0,0x66,
+	0x13,0x6E,0xE9,0x12,0x2B,0xF3,0x31,0xED,0x5B,0xBD,0xA4,
+	0x90,0xA8,0xEF,0x07,0x89,0xFC,0xA2,0x8A,0xAB,0xE0,0xD4,
+	0x56,0xC0,0x46,0xB3,0x63,0xB5,0x44,0x2E,0xDD,0xA5,0x3B,
+	0x5D,0x76,0xAD,0xC9,0x2A,0xFD,0x12,0x06,0xA1,0x52,0xB4,
+	0x00,0x3E,0x3E,0x03,0x63,0x14,0xF4,0xF0,0xCA,0x55,0xB1,
+	0xD2,0x1A,0x83,0x13,0xF9,0x62,0x85,0xC2,0x3B,0x99,0xBB,
+	0xB2,0x49,0xC7,0x8E,0xA5,0x82,0xE3,0x24,0xAE,0xE2,0xC2,
+	0xD4,0x5A,0x5C,0x87,0xCE,0xBD,0x22,0xA4,0xAB,0xBE,0x49,
+	0x00,0x83,0xF6,0x61,0xAA,0xF6,0x5B,0x53,0xFA,0xCC,0x29,
+	0xA0,0x70,0x2F,0x71,0x76,0x11,0x7F,0x49,0x19,0xDF,0xFC,
+	0xF7,0x12,0x78,0x5E,0x2F,0xF7,0x68,0xF4,0xE2,0x8C,0xE6,
+	0x06,0x6E,0x16,0x0D,0x6A,0x3C,0xBE,0x49,0x8C,0x9A,0x3D,
+	0xF0,0x0B,0xF2,0x76,0xCF,0xB5,0x33,0x1E,0xAA,0x82,0x8A,
+	0x87,0x76,0x41,0x8D,0x3A,0x87,0xC1,0x76,0xD0,0xDA,0x85,
+	0xC2,0xF5,0xA7,0xF3,0xB5,0x08,0xA6,0x7A,0x19,0xA6,0x5E,
+	0x79,0xFA,0x04,0xAE,0x3B,0x15,0x53,0x59,0x7D,0xF6,0x64,
+	0x79,0x91,0xA3,0x40,0x6B,0xB0,0x1B,0xCD,0xFA,0xE1,0x3E,
+	0xA6,0x01,0x44,0x6B,0x08,0xAC,0xAD,0x3B,0x5C,0x9A,0xBE,
+	0xFD,0xF0,0x90,0x9C,0x36,0x48,0x7C,0xC9,0x90,0x2F,0xD2,
+	0x03,0x57,0xA9,0x71,0x62,0x4E,0x41,0x20,0x8B,0xB7,0xA1,
+	0xFF,0x65,0x63,0x70,0x91,0xF4,0xF6,0xE7,0xD6,0xBD,0xBD,
+	0xE3,0x3B,0xF9,0x36,0x3C,0xAD,0x25,0x7A,0x86,0x0B,0xEC,
+	0xDC,0x9A,0x94,0x72,0x77,0xF0,0xEC,0x5A,0xC1,0xB4,0x24,
+	0x6E,0x4D,0xEC,0xF9,0x18,0x2B,0x46,0xFE,0x5E,0x3C,0x68,
+	0xE1,0x6E,0xD1,0xB4,0xCB,0xEA,0x79,0x99,0x1B,0x7F,0x35,
+	0x3C,0x63,0xFC,0xF3,0xE7,0xF7,0xB6,0x72,0x07,0xFC,0xC5,
+	0xA0,0x8B,0x7C,0xB5,0x2D,0x8E,0xAA,0x7F,0x1E,0x46,0xAB,
+	0xD4,0xFA,0xBF,0x92,0x89,0x8D,0x79,0x93,0x7A,0x22,0x79,
+	0x90,0xC9,0x3B,0xAB,0x5A,0x11,0xBA,0x59,0xAA,0x2D,0x4A,
+	0x34,0x5F,0x0E,0x24,0xC4,0xCF,0xC1,0xF7,0x9B,0x21,0x16,
+	0x75,0x92,0x55,0x9F,0xD3,0x64,0x82,0x3A,0x21,0xBF,0x5C,
+	0x21,0xFF,0x0E,0x05,0x84,0x6C,0x0B,0xDC,0x75,0x54,0xA6,
+	0x27,0x6C,0x9F,0xAC,0x28,0x55,0xDD,0xA8,0xD9,0x18,0x4C,
+	0xBE,0xBB,0x27,0x75,0x05,0x06,0x2E,0x23,0x4F,0xC5,0x95,
+	0xDD,0x45,0xC1,0x3E,0xC7,0x42,0x9B,0x4C,0x90,0x50,0x4D,
+	0xF0,0xCE,0xF9,0xB4,0x7D,0x3C,0xFC,0x48,0x34,0x55,0x79,
+	0x48,0x68,0xB8,0xC9,0x22,0x4C,0x74,0xC4,0xE7,0xC4,0x67,
+	0x66,0xB8,0x5D,0xB3,0x2F,0x40,0x9E,0xC6,0xE4,0x31,0xA5,
+	0x98,0x13,0xE8,0x51,0xC2,0x70,0x9B,0x00,0x08,0x7D,0x32,
+	0x3C,0xD7,0xAF,0x92,0x23,0x45,0x35,0x0C,0x6C,0x07,0xD7,
+	0xA4,0xE3,0xA3,0x11,0xED,0x12,0xBC,0x7D,0x7C,0xB0,0x7A,
+	0xF8,0xD2,0x17,0x33,0x55,0x95,0x2D,0xA6,0xB8,0x87,0xFC,
+	0xB7,0x1F,0x07,0x04,0xF5,0xEC,0x37,0x64,0x04,0x7C,0x54,
+	0x9E,0xEB,0x1E,0x3C,0xAF,0xAA,0x99,0xBB,0xED,0x0D,0x23,
+	0x66,0xAF,0x24,0x05,0x41,0x13,0x14,0xBF,0xB4,0xD2,0x0E,
+	0x7F,0xDE,0xDE,0x63,0xB5,0x01,0x5E,0x19,0x63,0x24,0xE5,
+	0xA3,0xF3,0x38,0xEE,0xC4,0x49,0xD5,0x94,0x14,0x56,0x85,
+	0xCB,0x02,0x37,0x4A,0xDC,0x33,0x93,0xE1,0x7E,0x49,0x29,
+	0x55,0x3C,0xC5,0xFF,0xBB,0xA7,0x51,0xB7,0x75,0x9C,0x1B,
+	0x5C,0xB9,0xAD,0x26,0x4D,0x86,0x49,0x8F,0xA6,0xF8,0xB5,
+	0xFC,0x0F,0xB8,0x78,0x1F,0x00,0x6C,0x75,0x74,0xE2,0x6C,
+	0xDB,0x1B,0x05,0xE0,0x9D,0xC8,0xEF,0x16,0xF0,0x03,0xAF,
+	0x65,0xE6,0xF7,0x77,0xF7,0xB8,0x4F,0x44,0x1E,0xBC,0x24,
+	0xCA,0x66,0x4F,0xBF,0x42,0xB6,0xB7,0xA4,0x48,0xA8,0x54,
+	0x42,0x5A,0xAE,0x03,0x78,0x0D,0x7F,0x4A,0xC6,0x02,0x6F,
+	0x1B,0x2B,0x3B,0xE7,0x94,0x95,0x77,0xF5,0x9A,0x55,0xA0,
+	0x9F,0xB3,0xB3,0xCE,0xFB,0x44,0xAD,0xAD,0x6E,0x65,0x91,
+	0x64,0x54,0x03,0x18,0x11,0x02,0x2D,0x04,0x0F,0x5D,0x90,
+	0x2C,0x5A,0x7B,0xB2,0x21,0x2D,0xBC,0x81,0xEA,0x6E,0x32,
+	0xDD,0xB8,0x26,0xEA,0xEE,0x8F,0x7E,0x74,0xD4,0xBC,0x5C,
+	0xA5,0xBD,0x6A,0x1B,0x5B,0x93,0x94,0x97,0xE3,0xA0,0x43,
+	0x32,0x7B,0xFC,0x6E,0x57,0xE5,0x73,0x53,0xB0,0xD5,0x72,
+	0x1C,0x76,0xD8,0x34,0xBC,0xC5,0xFC,0xD0,0x55,0xC0,0xCE,
+	0x8A,0xE8,0x7F,0xE9,0x40,0xBC,0xB7,0x9A,0xCC,0xD5,0x74,
+	0x8E,0x4F,0x68,0xD9,0x02,0xB7,0xEF,0x7A,0x0D,0x73,0x16,
+	0x5E,0xCE,0xAB,0x33,0x11,0x4D,0xD0,0x30,0xC1,0x86,0x8B,
+	0xF8,0xB7,0xFC,0x61,0x4B,0x2D,0xFC,0xFC,0x09,0x77,0xFF,
+	0x07,0x76,0x1E,0xDB,0x5F,0xC5,0x38,0xDF,0xA4,0x23,0x24,
+	0x68,0xFB,0x2B,0xB5,0xC6,0xBB,0xCD,0x98,0x12,0xC1,0x1B,
+	0xF9,0x32,0xDE,0x7B,0x62,0xDE,0x31,0x87,0x31,0xDB,0xCD,
+	0xD7,0x0C,0x33,0x2E,0xEE,0xD1,0x95,0x77,0xAF,0xC9,0xA2,
+	0x33,0xC4,0x22,0xCC,0xAF,0x09,0x63,0xA6,0x98,0x48,0x85,
+	0x3F,0x3B,0x8E,0x42,0x79,0x42,0x47,0xF3,0x71,0xF7,0x6B,
+	0xC5,0x47,0x17,0x22,0x6B,0x6C,0xDA,0x0B,0x8E,0x20,0x52,
+	0x0B,0x8E,0xC1,0x8B,0x7A,0xB5,0xBF,0x7D,0x6A,0x3A,0xD8,
+	0x10,0x54,0x64,0x97,0xD0,0x18,0x94,0x33,0x71,0xCB,0x88,
+	0xD3,0xBA,0xE3,0x6D,0x7C,0xA6,0x49,0x99,0xC3,0xC4,0x80,
+	0xD7,0x8E,0x80,0x29,0xC9,0x1A,0xA4,0x25,0x55,0x10,0xCB,
+	0x6B,0x4F,0xB2,0x77,0xFB,0x93,0x56,0x57,0x59,0xA3,0xD3,
+	0x13,0x38,0xAB,0x90,0xC1,0x3B,0x75,0x0B,0x2D,0xFF,0x72,
+	0x5E,0xF9,0x1F,0xFC,0x18,0x2F,0x67,0xCB,0xF6,0xCB,0x54,
+	0x02,0xF8,0xAE,0xD1,0xC4,0x36,0xA4,0xE4,0x6A,0x3E,0x35,
+	0xBC,0x7A,0xCA,0x66,0xF3,0x6E,0x7E,0xDD,0x0B,0xE9,0x34,
+	0xBE,0x3A,0xA3,0xDE,0x04,0xF1,0x7B,0xD2,0xB5,0x5F,0x04,
+	0xEA,0x91,0x24,0x7D,0xA4,0xD1,0x22,0x37,0x01,0x2D,0xBD,
+	0xC4,0xF8,0x29,0x25,0xFB,0x37,0x15,0x61,0x57,0x68,0xC3,
+	0x6D,0xF6,0x90,0x1A,0x4A,0x3E,0xF4,0x79,0x2B,0xF4,0xEC,
+	0x52,0x74,0xCC,0xAD,0xAE,0xA2,0xC9,0xA4,0xC2,0x3F,0x77,
+	0xA5,0x7C,0x42,0x9C,0x4C,0x3D,0x12,0xDD,0xA0,0xC6,0xAA,
+	0x01,0x47,0x1B,0xFA,0xD4,0xD0,0xC9,0xA3,0x53,0x0E,0xFE,
+	0xF6,0x48,0x0F,0x81,0xE6,0x4F,0xC3,0x8E,0xDF,0x94,0xA7,
+	0xBE,0x0F,0x14,0xCD,0x91,0x8D,0x9F,0x39,0xB5,0x0B,0xFC,
+	0xA9,0x3D,0x84,0xF6,0x8D,0xDB,0xF3,0xF1,0x91,0xA9,0xEB,
+	0x9C,0x6C,0x3B,0x1B,0xB8,0x28,0xCB,0xAC,0x3B,0x1F,0x2A,
+	0xC1,0x13,0x7F,0xF4,0xF5,0x8F,0x51,0x7F,0x1C,0x9C,0x67,
+	0xD4,0x93,0x04,0x56,0xA1,0x18,0xCD,0xEE,0xC7,0x21,0x8C,
+	0xA6,0x93,0x20,0xE8,0x22,0x4A,0xD2,0xF8,0xB4,0x72,0x6F,
+	0xE0,0xBF,0x8B,0xA7,0x7F,0x49,0xB6,0xDE,0xA0,0xA8,0x85,
+	0xC8,0xCB,0x14,0x7B,0x1E,0x31,0x5A,0x59,0xC5,0x5F,0x03,
+	0x60,0x19,0x92,0xFD,0xA6,0xF3,0xF9,0x9F,0x4F,0x9C,0x07,
+	0xAC,0xF4,0x28,0x12,0x7F,0xC5,0x14,0xCB,0x7A,0x6A,0x30,
+	0xEA,0x3F,0x63,0x98,0x84,0x49,0x7B,0x10,0x51,0x9C,0x7E,
+	0x03,0x9C,0xF1,0xD6,0x1E,0xFD,0x5F,0xB2,0x6A,0x82,0x20,
+	0x7C,0xAC,0xC1,0x13,0x27,0x62,0x9E,0x1E,0x78,0xB4,0x9D,
+	0xA5,0xD8,0xA7,0x25,0x02,0x91,0xD3,0xF5,0x71,0xBF,0x69,
+	0x07,0xCD,0x20,0x2E,0x9A,0x0F,0x14,0x07,0x51,0xD4,0x22,
+	0x9B,0x4B,0x9F,0xD9,0x4D,0xC3,0xCA,0x68,0x7F,0xC4,0x6C,
+	0x6E,0xAB,0xEB,0x15,0x53,0xA2,0x21,0x45,0x14,0xE4,0x50,
+	0x4D,0x47,0x35,0xE9,0xCA,0xC9,0x12,0x05,0xD6,0x2F,0x41,
+	0xC5,0x37,0x17,0xDE,0x87,0x88,0x2C,0xD9,0x28,0xD8,0x3A,
+	0x2B,0x8E,0x6C,0x94,0x38,0x80,0xDF,0xED,0xF4,0x49,0x86,
+	0xA1,0x15,0xF0,0x5E,0x14,0x60,0xFB,0x0A,0xF7,0x98,0xAA,
+	0x84,0xF4,0x02,0x41,0x21,0x99,0x8E,0xA9,0x2E,0x4A,0xCC,
+	0x23,0x17,0xBC,0xBC,0xD1,0x20,0xDA,0xE1,0x64,0x9A,0x72,
+	0xFC,0x1D,0x10,0x30,0xB7,0x85,0x49,0x88,0x30,0x8B,0x81,
+	0xF4,0x9B,0x22,0x0F,0x47,0xC9,0x7E,0x8D,0x3B,0xDE,0x67,
+	0xBC,0x64,0x21,0x7F,0xC8,0xCE,0xC2,0x2A,0xC6,0xF8,0x56,
+	0xB0,0x45,0x63,0xBB,0x4F,0x95,0x56,0x49,0xA0,0xA8,0x19,
+	0x1B,0x6B,0x57,0x83,0x9F,0x37,0x10,0x7B,0x71,0x9A,0x07,
+	0x04,0x92,0x6A,0x03,0x46,0x15,0x5B,0xEB,0x0D,0x84,0x5A,
+	0x6D,0x8D,0x6B,0x3A,0x2E,0x65,0x39,0x6E,0xCD,0x83,0x5C,
+	0x4B,0xAF,0x02,0xB8,0x87,0xF8,0xF0,0x0A,0xFB,0x25,0xC3,
+	0x16,0x37,0x60,0x37,0xF1,0x37,0x9B,0xAA,0xD9,0x0E,0x89,
+	0x43,0x2B,0xCA,0xDA,0x53,0xD4,0x61,0xE7,0x9D,0x0C,0x8F,
+	0xDF,0xA1,0xAA,0x5E,0x4C,0xA2,0x40,0xE3,0x92,0x3B,0x13,
+	0x10,0xA8,0xA4,0xD5,0x78,0x46,0xA4,0x29,0x1D,0x03,0xFD,
+	0x89,0x4F,0xE5,0x17,0xE5,0x31,0xF8,0x98,0x17,0xE3,0x28,
+	0x99,0xDD,0xF5,0x08,0x81,0x08,0xA4,0x86,0xE5,0x5C,0x69,
+	0x46,0x6F,0x23,0x82,0x93,0xD1,0x1B,0x94,0x04,0x72,0xC4,
+	0x24,0x5A,0x8F,0xED,0x82,0x16,0x20,0x53,0xAA,0xA1,0x2B,
+	0x5B,0xA1,0xD0,0xCF,0xFA,0x30,0x28,0xA6,0x03,0x35,0x56,
+	0x1D,0x73,0x5E,0xF9,0x35,0xF3,0x04,0x9D,0xC1,0xC3,0x19,
+	0x77,0x27,0x91,0x19,0x22,0xE9,0xA2,0x4B,0xAA,0x6F,0xD7,
+	0x88,0x6C,0x0C,0xF6,0x4F,0x1C,0x92,0x81,0x0E,0x02,0x25,
+	0xF5,0x92,0xAC,0x8D,0xA9,0x17,0x3C,0x0A,0x2C,0x2D,0xB3,
+	0xBF,0x9D,0xE2,0x8C,0xE6,0xF7,0xCF,0x5D,0xCB,0xEF,0xF9,
+	0x80,0xBF,0xF0,0x7C,0x1E,0xD9,0x09,0x85,0x16,0x2B,0x90,
+	0x2C,0xE6,0x15,0x6A,0x7B,0x6F,0xB5,0x94,0x7A,0x6E,0xBF,
+	0x5E,0xFF,0x0C,0x5D,0xA5,0x8D,0xAE,0x4C,0x83,0x0F,0x7A,
+	0x05,0x97,0xD6,0x9E,0xB7,0xDF,0xF4,0xEF,0xB5,0x42,0xF1,
+	0x60,0xF6,0x5C,0xD7,0x55,0x86,0x36,0xDB,0xFD,0xB0,0x9B,
+	0xFB,0xE9,0x0B,0xE1,0xBC,0xD2,0x5A,0xF2,0x06,0x3C,0xCC,
+	0x0F,0x7F,0x29,0xD6,0x13,0x67,0x5D,0x63,0x64,0x04,0x7A,
+	0x67,0x03,0x4A,0x5D,0x5B,0x2F,0xEC,0x90,0xEA,0x47,0x1C,
+	0x25,0x6E,0xF5,0xC2,0xF7,0x50,0x0F,0x55,0xEA,0x99,0x60,
+	0xFF,0xC6,0x3A,0x97,0x52,0x82,0x9B,0x73,0xBD,0x67,0x80,
+	0xC7,0x4E,0xDA,0xDA,0xF2,0x7F,0x73,0x1B,0xCB,0xAC,0x1D,
+	0xC8,0x5A,0x5E,0xE2,0x86,0x04,0x43,0xE4,0xFB,0xB4,0x8A,
+	0xF6,0x50,0xA9,0xDF,0x6F,0x79,0xB0,0x98,0x6D,0xEE,0x8C,
+	0xEB,0x5F,0xC4,0x76,0x78,0x61,0x59,0x3C,0xA4,0x41,0x87,
+	0x4A,0xFF,0xCC,0x2C,0x1C,0x25,0x3A,0xF7,0x66,0xCF,0xEC,
+	0x05,0xC4,0x13,0xF3,0x6F,0x3F,0x56,0xF7,0xD9,0x15,0x4A,
+	0x44,0x2F,0xDC,0xCB,0x86,0xC4,0x13,0xCC,0xF7,0xFF,0x7B,
+	0xA9,0xCD,0xBA,0xAE,0xFE,0x75,0x1F,0x48,0xEA,0xDA,0xCE,
+	0x7C,0xC9,0x03,0xB1,0xDF,0xFD,0x41,0xAD,0xC5,0x83,0xD9,
+	0x7D,0x3D,0x0B,0xBA,0xE3,0x7F,0xE3,0x79,0x90,0x5C,0xCF,
+	0xBF,0xEC,0xA6,0xCC,0xAF,0xA1,0xDC,0x39,0x69,0x5F,0x31,
+	0xCA,0xD6,0x33,0x18,0xFB,0xBE,0xC4,0x9A,0xCB,0x56,0x9C,
+	0xCB,0x31,0xA5,0x44,0x22,0xF2,0xD9,0x9C,0x49,0x09,0x8B,
+	0x06,0x21,0xC5,0xB4,0xEA,0x31,0x61,0xD9,0x99,0x7B,0x2D,
+	0x60,0x0A,0x38,0xBE,0x99,0xB0,0x7C,0xA6,0x7A,0xC0,0xFF,
+	0x50,0x5E,0xD4,0xD5,0x67,0xED,0x8C,0x68,0x1E,0xD9,0xEA,
+	0xF6,0xCC,0x27,0x0C,0xE7,0x0F,0xF7,0x15,0x2B,0x70,0x3F,
+	0xFE,0xF5,0x33,0x28,0xAF,0x13,0xC7,0x3A,0xC2,0x2B,0x51,
+	0xF9,0xA2,0x51,0xA6,0x93,0xB4,0x2D,0xF2,0x0C,0x9C,0x63,
+	0x77,0xAB,0x6D,0x4C,0xDA,0x5B,0x6B,0xF4,0x7E,0xCA,0x1A,
+	0xA4,0x07,0x84,0x9F,0x64,0x69,0x19,0xCF,0x5C,0x17,0xE3,
+	0xA8,0x25,0x3C,0xB3,0x98,0x31,0x25,0xB7,0xF3,0x8E,0xE3,
+	0x59,0x6B,0x21,0xBC,0x0C,0x38,0xEA,0xD0,0xCF,0x9A,0x9F,
+	0x2C,0x1F,0x5E,0x5E,0xCB,0x40,0x4B,0x0B,0x0A,0x72,0x0E,
+	0xFF,0x94,0x05,0x9E,0xF6,0xCD,0x03,0x22,0x07,0x76,0x23,
+	0x54,0xA0,0x91,0x3B,0xF7,0x38,0x6C,0xBC,0x44,0x8B,0xE0,
+	0x0E,0x48,0x1B,0x6F,0x56,0x6E,0x6F,0x4F,0xF6,0x80,0xAF,
+	0x7C,0xC0,0xAB,0x8E,0x47,0xF1,0x0B,0x8E,0xE0,0x84,0xBE,
+	0x16,0xA6,0xB6,0x3F,0xEA,0x50,0x47,0x8F,0x33,0x94,0x15,
+	0xBF,0x2B,0xAE,0x5D,0x28,0x07,0x1B,0x73,0xB7,0x17,0x45,
+	0x33,0xFF,0xF1,0x9A,0xAE,0xB8,0x18,0xC9,0x31,0x91,0xE3,
+	0x0D,0x8D,0x1A,0xAD,0x91,0x8D,0x94,0x39,0x9D,0x65,0x80,
+	0xBB,0xD0,0xF5,0x8F,0xF5,0x88,0x55,0xC4,0x84,0x1E,0x49,
+	0x25,0x7B,0xE5,0x0F,0x94,0xA1,0xF5,0xD3,0x76,0x68,0xEE,
+	0xCB,0x45,0x9B,0xD5,0x64,0xDE,0xF5,0xF6,0x71,0xFA,0x2B,
+	0xD6,0xD6,0x26,0xC0,0xE2,0x15,0x3C,0x8F,0x7A,0xE2,0xD7,
+	0x36,0xF7,0x41,0x8F,0xA7,0x6F,0x6D,0xFD,0x2C,0x0F,0x31,
+	0x9E,0x4C,0x19,0xC6,0x0B,0x05,0xE1,0xC6,0x34,0x3B,0x8A,
+	0xF7,0x1B,0x8C,0x6A,0xE7,0x10,0x47,0x97,0xC3,0xF6,0x6B,
+	0xF4,0x72,0xA3,0x81,0xC7,0x6D,0xC0,0xEC,0xEE,0xBD,0x13,
+	0x99,0x6D,0x55,0x49,0x39,0xEF,0x68,0x0C,0xE3,0xB1,0xB4,
+	0xB0,0x67,0xFA,0xB7,0xAA,0x80,0x78,0xE7,0x21,0x59,0xE3,
+	0x74,0x9D,0x63,0x6D,0x42,0x5C,0xBD,0xBC,0x57,0xB0,0xE7,
+	0x62,0x1E,0x2F,0x42,0xA4,0x5E,0x06,0x93,0x57,0x9A,0xE5,
+	0x4D,0x53,0x25,0x11,0x68,0x7D,0x45,0xB4,0x5E,0x47,0x1F,
+	0x06,0x0A,0xE9,0xBF,0x50,0xD1,0x42,0xE8,0x7C,0xC0,0xA5,
+	0x2C,0x2B,0xED,0x1B,0xBB,0x72,0x74,0x95,0xAA,0xD8,0x7E,
+	0x91,0x69,0x26,0x2D,0x38,0x65,0xD1,0x26,0xC8,0xF3,0xFA,
+	0x9D,0xCF,0x85,0x87,0x3F,0x6D,0xFA,0xB5,0xBB,0xBB,0x4D,
+	0xB8,0xCB,0xB8,0xE5,0x57,0xFC,0xAC,0x21,0x25,0x3B,0xF1,
+	0xB5,0xA2,0xF8,0xE7,0x0F,0xB6,0x24,0x21,0x60,0x34,0xA4,
+	0x6B,0xC5,0xBD,0xED,0x20,0xE6,0x7C,0xD2,0xE8,0x01,0xE1,
+	0x46,0xE8,0xF6,0x4E,0xAA,0xC0,0xF2,0xD0,0x5A,0x94,0xA9,
+	0x6A,0xB8,0xBD,0xFE,0x9B,0xB1,0x54,0xB1,0x11,0xCF,0xEC,
+	0xDF,0xF2,0x17,0xFF,0xAE,0x9E,0x25,0xB5,0x24,0x64,0x46,
+	0xE7,0xFF,0x9E,0xBB,0xF2,0x1B,0x38,0x24,0x2F,0xB6,0xB5,
+	0x9C,0x7D,0x3B,0x36,0x67,0x8B,0xB1,0xE5,0xB7,0xDD,0x0A,
+	0x0B,0x9F,0x31,0x85,0x31,0xC4,0x5E,0x87,0x72,0x76,0xD3,
+	0xF7,0x62,0xFA,0xB3,0xAF,0x44,0xC9,0xA5,0x69,0xBB,0xA8,
+	0xDB,0x46,0x54,0x09,0x04,0x9E,0x7E,0x4E,0x87,0x7A,0xF7,
+	0x32,0x04,0xD2,0x93,0x2C,0x9C,0x9C,0xEC,0x62,0xC0,0xE7,
+	0xC4,0x9D,0xEE,0x41,0x0E,0x52,0xB5,0x1F,0x31,0x31,0xEA,
+	0x51,0x0D,0x5F,0xB8,0xDE,0x7B,0x4E,0xC6,0x53,0x69,0x1C,
+	0xD6,0x65,0x8B,0x54,0x74,0x83,0xC6,0xB2,0xBD,0xDA,0x1B,
+	0xCE,0xEE,0xB2,0xE5,0xDE,0xAD,0x91,0xDF,0x0A,0x74,0x17,
+	0xE5,0x8C,0x69,0x5A,0x22,0xD4,0x84,0xB9,0x8B,0x34,0xA1,
+	0x24,0x20,0xC2,0x94,0x3F,0x7C,0xE9,0x74,0x5E,0x96,0xDE,
+	0x73,0x74,0xDA,0xCA,0x79,0xBD,0x88,0x50,0x0F,0x14,0xDA,
+	0x5B,0xF6,0x45,0x11,0x08,0xA7,0x9E,0x09,0x51,0x6F,0x70,
+	0x20,0xCB,0x28,0xC1,0x9D,0x0D,0xF4,0x4C,0xEA,0x4C,0xCF,
+	0xF0,0xF1,0x27,0x9B,0xBB,0x93,0x68,0x83,0xBD,0x00,0xE3,
+	0xCB,0x0C,0xB4,0x6C,0xB6,0x14,0x32,0x5E,0x71,0x65,0xE1,
+	0xC0,0x34,0x1C,0x32,0xE9,0x2E,0x7F,0xB8,0xE6,0x46,0x32,
+	0x22,0xFA,0xB4,0xFC,0xC0,0xE8,0x62,0x43,0xD3,0xBF,0x9A,
+	0x53,0xDF,0x22,0x8A,0x3E,0xFA,0xEE,0x35,0xFC,0x95,0x5B,
+	0xBE,0xB7,0xBB,0x83,0x63,0x6C,0x79,0x5C,0xAE,0xD2,0xC9,
+	0xB0,0x12,0x5C,0xDB,0x45,0xEC,0xD6,0xAE,0x58,0xA6,0x34,
+	0x31,0xCD,0xC1,0x5E,0x14,0xFF,0x6D,0xA8,0xC6,0xBA,0xFA,
+	0xBE,0xA1,0xC6,0x3F,0xF5,0x13,0x1A,0xA8,0x3E,0xFD,0x6B,
+	0xCF,0x35,0x78,0x1D,0x1A,0xD2,0x1A,0x3F,0x34,0x5E,0x69,
+	0xF0,0x86,0x34,0x46,0x34,0x82,0x35,0x05,0xB4,0xB8,0x4D,
+	0x9A,0x1F,0x34,0x5D,0xB4,0xF3,0x06,0x40,0x24,0x8D,0x4F,
+	0xA2,0x1A,0x9F,0x64,0x70,0x6A,0x48,0xFD,0xF7,0xAD,0x60,
+	0xDB,0xAB,0x5D,0x55,0x8F,0x83,0x2D,0x14,0xF8,0x69,0x56,
+	0x53,0x7E,0x78,0x6F,0x84,0xD1,0xB0,0xDE,0x2F,0x20,0x00,
+	0xE0,0x57,0x33,0x26,0xF3,0x2C,0x74,0x12,0xF4,0x8B,0xA6,
+	0x8B,0x24,0x6B,0xC1,0x9E,0x29,0x90,0xF6,0x79,0xB5,0x02,
+	0xAE,0xA4,0x95,0x0E,0xDB,0xA0,0x60,0x72,0x4A,0x1C,0xDE,
+	0x2E,0x58,0x85,0x94,0x8F,0xAA,0x16,0x78,0x28,0x09,0x59,
+	0xAE,0x2A,0xCA,0x69,0xB1,0x93,0x90,0x51,0x6B,0x67,0x1A,
+	0xA8,0x0D,0xC4,0x53,0x6C,0xAE,0xC3,0xAD,0x14,0x6C,0x8C,
+	0x29,0x3F,0xDD,0x54,0x76,0x27,0x27,0xBD,0xBD,0x7B,0x8F,
+	0xDA,0x34,0x47,0xC1,0xBD,0x9A,0xC5,0xC0,0xEB,0x71,0x05,
+	0x70,0xA4,0xE5,0xA4,0x9A,0x7C,0xD4,0x1A,0x43,0xFE,0x70,
+	0x17,0x40,0x6F,0x3F,0x08,0x82,0x8B,0x77,0x74,0x43,0x46,
+	0x8B,0x7A,0xBA,0x85,0xF0,0x4D,0xF2,0x38,0xB1,0x09,0x54,
+	0x1C,0x1C,0xBE,0xF9,0x6B,0xF9,0x30,0x80,0x68,0xE7,0xC9,
+	0x43,0xE4,0x8B,0xEB,0xF2,0xFF,0xDB,0x02,0xF5,0x1A,0x69,
+	0x1B,0xEC,0x76,0x15,0xCC,0x40,0x24,0x45,0x9E,0xF7,0xCA,
+	0x57,0xD3,0xD1,0xC6,0x1F,0x25,0xE1,0x23,0x82,0x8C,0x08,
+	0x58,0x7E,0x34,0x34,0x3E,0x1C,0xA1,0x5B,0xF9,0x16,0xF9,
+	0x29,0xE6,0x76,0xD1,0x4C,0x6F,0xC0,0x7F,0xCD,0x88,0xAA,
+	0x8F,0xF0,0xB9,0x7A,0x4A,0xC1,0xFB,0x9D,0xA2,0xB9,0x51,
+	0x3D,0x35,0xBD,0xF6,0x02,0xC3,0x02,0x72,0xCC,0x81,0xA2,
+	0xF7,0xBB,0x41,0x5A,0xBB,0xC6,0xBD,0xFA,0x42,0xD8,0x97,
+	0x12,0x9E,0x43,0x6A,0x84,0xB0,0xC5,0xA9,0x02,0x64,0x52,
+	0x02,0xFF,0x3B,0xDD,0x7D,0xF5,0x6B,0xCB,0x4F,0xB9,0x89,
+	0xF7,0xF1,0xBC,0x57,0x5C,0xFE,0x02,0x5A,0x10,0x9F,0x30,
+	0x42,0x1D,0x89,0x9B,0xA4,0xAF,0xD0,0xE5,0xF8,0x97,0xAB,
+	0xDB,0xBE,0x58,0x28,0x8F,0xD6,0x11,0x44,0xAC,0xBA,0x39,
+	0xCB,0x9C,0x4F,0x42,0x3D,0xDE,0x6F,0xFF,0xCE,0xE4,0x7F,
+	0x06,0x87,0x71,0xD8,0xEF,0xE7,0x85,0x0E,0x44,0xA8,0xCF,
+	0x0A,0x55,0xD2,0x05,0xAF,0xA8,0x5D,0x54,0xCB,0x93,0x0C,
+	0xCD,0x9B,0x0F,0x6C,0xB1,0xCF,0x5B,0xD0,0xE3,0x03,0xAB,
+	0xFF,0xBC,0xD6,0x5B,0xDE,0x1B,0x60,0x80,0xB9,0x77,0x8D,
+	0x39,0x88,0xB3,0x72,0xC6,0x5D,0x63,0xF6,0x4E,0x2B,0xE9,
+	0x32,0x20,0x64,0x00,0xA1,0x67,0x24,0x2A,0xE9,0x49,0xC8,
+	0xB2,0x88,0x9C,0xF1,0xD7,0xFF,0x86,0x3D,0x6E,0x5F,0x1E,
+	0xCD,0xE6,0xE3,0xB3,0xBB,0x1B,0xF9,0xD7,0x7C,0x10,0xFD,
+	0x3A,0x61,0xD1,0x0F,0x46,0x54,0x0D,0x1B,0xD7,0xBF,0xB4,
+	0xD5,0xB3,0xB5,0xC1,0x63,0x18,0x67,0xA5,0x2C,0xBF,0x5F,
+	0x40,0x2D,0x04,0x91,0x44,0x89,0x14,0x16,0xD2,0x66,0x8D,
+	0xE0,0x15,0x15,0x64,0x38,0x13,0x19,0x2F,0x2E,0x40,0x87,
+	0x1B,0xB3,0xDE,0x33,0x36,0x86,0xDD,0xF0,0x1B,0x52,0xCB,
+	0x5F,0x5F,0xAA,0x88,0x2E,0x27,0xB6,0xF0,0x09,0x5E,0x04,
+	0xAD,0x9C,0x4B,0xDA,0x5C,0x76,0xA0,0xCF,0x48,0xBE,0x44,
+	0xE6,0x7F,0x4D,0xB5,0x96,0x77,0x9F,0x73,0xD0,0x73,0xD0,
+	0xF1,0x4C,0x84,0x1D,0xD4,0x01,0x7F,0x69,0x8B,0xE3,0x55,
+	0x7E,0x09,0x61,0x87,0xD7,0xE9,0xAC,0x47,0x2B,0xC2,0x25,
+	0x0B,0x9D,0x93,0x7A,0xF6,0x0E,0x76,0x86,0x6B,0x7C,0x3C,
+	0xFF,0xFA,0xCF,0x27,0xE8,0x29,0x3B,0x7D,0xCC,0xA2,0x45,
+	0x11,0x7F,0xD4,0x24,0x94,0x3D,0xA9,0xCD,0x2B,0x6F,0x7B,
+	0x9D,0xF1,0x8F,0x06,0x56,0x55,0x7C,0xDE,0x0E,0x1D,0xFB,
+	0x0A,0x9A,0x91,0xCD,0x68,0x5B,0xC1,0xE3,0x67,0xE4,0x61,
+	0x70,0x3F,0xC5,0x6D,0xF8,0xA4,0xA7,0x55,0x9C,0x6A,0xE0,
+	0x1A,0x85,0x7B,0x14,0xC0,0x01,0xE4,0x8F,0x92,0x7E,0x09,
+	0x36,0xCC,0x5C,0xFF,0xE0,0xA2,0x01,0xE6,0xAF,0x7E,0xE5,
+	0x8D,0xDC,0x01,0xBD,0x68,0xF3,0x4A,0x38,0x4D,0x32,0x4C,
+	0xFF,0x31,0xF3,0xFD,0x20,0x64,0x2C,0x3E,0xC1,0xC6,0xCC,
+	0x39,0xE6,0x3B,0xBC,0x7F,0x8D,0xF9,0xC7,0x71,0x78,0x62,
+	0x9F,0xD9,0x31,0x71,0xD0,0xFD,0x9D,0x1A,0x64,0xF2,0x3F,
+	0x77,0xD2,0x54,0xEF,0xC7,0xC0,0xAC,0xA0,0x89,0xF5,0x2C,
+	0xFF,0x10,0x0C,0xBE,0xFB,0x47,0x90,0xC6,0x5A,0xF3,0xE6,
+	0xC1,0xB8,0x8F,0xBF,0x5B,0xEB,0x12,0xB4,0xEC,0x62,0x74,
+	0x9C,0xA9,0x27,0x5A,0x69,0xCA,0xB3,0x87,0xD3,0x8C,0x07,
+	0xE3,0x70,0x49,0x88,0x88,0x0B,0x2E,0x2F,0xD8,0x12,0xCB,
+	0xCE,0xEA,0x5E,0xC2,0xCB,0x23,0xAA,0x44,0x81,0x89,0x27,
+	0x0E,0x88,0xEF,0x7C,0xEE,0xBD,0xB4,0xFD,0x80,0x40,0x7F,
+	0x7F,0x9A,0x82,0x67,0x69,0x77,0x49,0x36,0x3A,0x73,0x6B,
+	0x65,0x71,0x11,0x36,0xF7,0xE0,0x3B,0xA4,0xBB,0x34,0x86,
+	0x0F,0x32,0xE1,0xF7,0x6B,0xD8,0x07,0x77,0x38,0xFA,0x3E,
+	0x9B,0x3C,0x0F,0x4F,0x2C,0x62,0xE3,0xFE,0x21,0xC0,0x27,
+	0xE0,0x76,0xB2,0xD3,0x1E,0xA5,0xEC,0xEA,0x7F,0x77,0xBE,
+	0x3C,0xF0,0x13,0x28,0x48,0x67,0x9C,0xDB,0x3D,0x39,0x5A,
+	0x19,0xE2,0xBB,0xCD,0x68,0x11,0xC7,0x9E,0x41,0x59,0xDE,
+	0x26,0x66,0xBE,0xC3,0x44,0x48,0x61,0x6D,0x22,0xAF,0xCE,
+	0xB4,0x66,0x6E,0xE9,0x97,0xB2,0x9E,0x83,0x7D,0xF3,0x85,
+	0x00,0x6D,0x8E,0x10,0x29,0x6D,0x7C,0x6C,0x62,0xEC,0x93,
+	0xF1,0xBE,0x5D,0x16,0x2F,0x09,0x6A,0xFC,0x27,0x0E,0xA6,
+	0xCC,0xFB,0x23,0xB6,0x6F,0xB1,0xF0,0x83,0xBE,0xF5,0xA0,
+	0xD7,0xF8,0x21,0xB3,0x9F,0xC3,0xFC,0x34,0xC6,0x46,0xF7,
+	0x42,0x69,0x1A,0x2E,0xBE,0xCF,0x5E,0x57,0x23,0x2D,0x2B,
+	0x42,0x57,0x29,0xA0,0x12,0x7D,0xAD,0x35,0x3A,0x6E,0xDF,
+	0x3D,0xFD,0x1F,0x3E,0x1E,0x8F,0x32,0xD2,0xF9,0xA7,0x8E,
+	0xE3,0x4C,0xA5,0x8F,0x77,0xE3,0xA1,0x5C,0xF4,0xFB,0xE1,
+	0x74,0x16,0x7E,0x46,0xAA,0x4B,0x20,0x72,0x98,0x52,0x36,
+	0x1D,0xA1,0xBE,0x42,0x31,0x5B,0x44,0xF7,0xBA,0x8E,0xCF,
+	0x11,0x87,0x11,0x38,0x38,0x51,0x31,0x01,0xB3,0xF5,0x3E,
+	0x9A,0x94,0xD9,0x8B,0x1D,0x6E,0x1E,0x63,0xAB,0x17,0xD6,
+	0x7F,0x8C,0x87,0xC6,0xBC,0xC6,0xE7,0xB3,0xD0,0x21,0xE3,
+	0x9C,0x6F,0xE0,0xBF,0xF9,0x86,0x13,0xCB,0x17,0x59,0xF9,
+	0xAF,0x5A,0xCA,0xD4,0x20,0x63,0xB7,0x94,0x57,0x4E,0xFE,
+	0xEB,0xF8,0xA1,0x35,0xA3,0xFC,0x7E,0x50,0xC3,0x36,0xA0,
+	0x27,0x77,0xE3,0xB5,0x44,0x15,0x31,0x7D,0x68,0xC2,0x7C,
+	0x24,0x30,0x1B,0xCC,0xE9,0x3D,0x6C,0x95,0xF3,0x35,0xD5,
+	0x26,0x7F,0x71,0x76,0xCC,0x07,0x32,0x7C,0x75,0xEE,0xB3,
+	0x4B,0xE6,0x22,0xFF,0x51,0x7B,0xFD,0x4D,0xE3,0xDE,0xED,
+	0x5E,0x9E,0xBC,0x2C,0xD5,0xFF,0x7F,0xD0,0x4A,0xA6,0x46,
+	0x42,0x84,0x27,0x45,0xA9,0xAB,0xEA,0x5C,0xC3,0xE8,0x72,
+	0x71,0xAA,0x7E,0xA2,0x24,0xF5,0xD5,0x5E,0x11,0x7D,0xB4,
+	0xE3,0x55,0x3A,0xA0,0xAE,0x5D,0x67,0x51,0xB0,0xF9,0x2A,
+	0x67,0xE2,0x72,0x87,0x7E,0x3C,0x60,0x67,0x27,0xF6,0x3E,
+	0xDD,0xAC,0x30,0x39,0x7D,0x26,0x4E,0x80,0xC2,0x10,0xBB,
+	0xC1,0xFD,0xF0,0x24,0x8D,0xC7,0xBF,0x18,0x9D,0xFE,0x2B,
+	0x0D,0xAE,0x38,0xD3,0xBD,0x6D,0x31,0x2E,0xC7,0x3D,0xF0,
+	0x61,0xAF,0x93,0x2F,0xEE,0x18,0xF3,0x07,0x9C,0x29,0x85,
+	0x4B,0x3C,0xEC,0x58,0xD3,0x42,0xAD,0x2D,0xDA,0xFF,0x92,
+	0xF3,0x3B,0x67,0x8A,0x19,0xA3,0x36,0x6A,0xBD,0xDC,0x2F,
+	0x02,0x84,0xED,0xC6,0x59,0x2D,0x13,0xE0,0x41,0xFF,0x02,
+	0x4F,0xA9,0x30,0xB0,0x5F,0xF8,0x18,0xCB,0xAD,0x72,0xEC,
+	0x25,0x31,0x2B,0x84,0x55,0x66,0xED,0xEE,0x33,0x90,0xB5,
+	0x72,0x11,0x3E,0xED,0xDF,0xA2,0x60,0x9D,0xA3,0x4A,0x86,
+	0xB4,0x50,0x0A,0x54,0xDA,0xE4,0x18,0xBA,0x3F,0x7D,0xDA,
+	0x44,0xBA,0x6D,0x1A,0x8F,0x6E,0x96,0x5E,0xB9,0xF3,0xDD,
+	0xF9,0xFD,0xC0,0x6B,0xA6,0x71,0xA3,0x24,0x9E,0x43,0xB5,
+	0x86,0xCC,0x80,0xBE,0x32,0x37,0x15,0x52,0x94,0xD9,0x71,
+	0x0B,0x4E,0x12,0x79,0xF3,0x6A,0x04,0xAA,0x7F,0x32,0x89,
+	0xBA,0x28,0x60,0xA5,0xC2,0x05,0x0A,0x3C,0xC1,0x99,0xAF,
+	0x0E,0xEB,0xBB,0xCD,0xEF,0x24,0x64,0xAF,0x7D,0xB0,0xBB,
+	0x92,0x3B,0x73,0x09,0x6C,0x24,0xC6,0x5C,0xBB,0xCF,0x5C,
+	0xE7,0xE9,0x89,0x42,0xD0,0xF0,0xAA,0x18,0xC7,0xEA,0x93,
+	0xC0,0x4C,0x15,0x09,0x16,0xA5,0x42,0xA8,0x2D,0xD4,0xCD,
+	0x96,0xA7,0xA0,0x92,0x7F,0xB1,0x9B,0xE3,0xE1,0xD2,0xF3,
+	0x49,0x40,0x4E,0xED,0x79,0xFA,0xB5,0xEA,0x6A,0x0A,0x5A,
+	0x91,0xCC,0x96,0xA6,0x4A,0x5E,0xB1,0x54,0x15,0x80,0x15,
+	0x5C,0xD2,0x26,0x7E,0x4B,0xCE,0x33,0x2F,0xB0,0x8F,0xB5,
+	0x4B,0xCC,0x16,0xF4,0xD0,0x97,0xF9,0x95,0x87,0x00,0x85,
+	0x9D,0x8F,0x7A,0x58,0x25,0xDD,0x78,0xE4,0xD4,0x30,0x25,
+	0xC6,0xF5,0xB1,0x52,0x7C,0xA8,0xDA,0x33,0xB8,0x27,0x3D,
+	0x64,0xC3,0x74,0xDD,0x5B,0xAE,0x83,0x6F,0xE5,0x1F,0x74,
+	0xF9,0xC7,0xF7,0x5B,0x4B,0x0B,0xDE,0x15,0xC6,0x27,0x44,
+	0x73,0xB7,0xED,0xBE,0x4A,0xB6,0x76,0x29,0x5D,0x0D,0xB8,
+	0x96,0x83,0xA6,0xA9,0x5D,0x66,0xD8,0xE7,0xAD,0xB7,0xF6,
+	0xF9,0x43,0xD1,0x0D,0xBB,0x5F,0x13,0xB0,0x38,0xFE,0x74,
+	0xF3,0x6A,0xF5,0xD7,0x3E,0x18,0xF3,0x34,0x90,0x39,0x43,
+	0x22,0x04,0x5B,0x25,0xD5,0xCC,0x9F,0xAF,0xDA,0x64,0x4F,
+	0xAF,0x6C,0xE9,0x83,0xF8,0x84,0xDB,0xD7,0x7F,0xB0,0x1B,
+	0x5A,0x4F,0x15,0x24,0xDA,0x0D,0xB6,0x04,0x62,0x40,0x06,
+	0xFF,0xF9,0x7E,0x64,0xCD,0xA3,0x53,0x40,0xF6,0x6F,0xA2,
+	0x7D,0x40,0x17,0xCE,0xDD,0xDD,0x94,0x08,0xE5,0xA7,0x45,
+	0x55,0x6E,0xBA,0x5E,0xFB,0xE6,0x56,0x5F,0x78,0xA4,0x41,
+	0xEA,0x5C,0xA4,0x06,0x19,0xCD,0x14,0xE9,0x3E,0xAA,0x7B,
+	0xF5,0x47,0xD1,0x00,0x6B,0xB4,0xD2,0xFB,0xD2,0x12,0x2E,
+	0xB5,0x70,0x60,0xEF,0xC9,0x45,0x54,0x33,0xF6,0x94,0x8E,
+	0xE5,0x2A,0x2B,0x06,0xF6,0xDB,0xC7,0xDE,0x41,0xD5,0x3A,
+	0xFA,0xAF,0xA6,0x54,0x94,0xAA,0x4D,0x8D,0xC4,0xDB,0x73,
+	0xBB,0x84,0x24,0x0F,0xEF,0xE9,0xB5,0x6D,0x78,0xC9,0xB5,
+	0x0D,0x7B,0x76,0x7A,0x80,0x6B,0xF8,0x52,0x5B,0xD2,0xAF,
+	0x29,0xF8,0xEA,0x4D,0xEC,0x7A,0x29,0xB0,0xE8,0xB3,0xFC,
+	0xD8,0x5C,0x11,0xE7,0xF9,0x5D,0xD5,0x9F,0x80,0xEC,0xBB,
+	0x21,0xD8,0x10,0x0A,0x3A,0x0A,0xE9,0x12,0x29,0x8F,0x8C,
+	0xFC,0x74,0xF9,0xAE,0xB1,0x5D,0x7F,0xF5,0xEB,0xDF,0x74,
+	0x61,0xC3,0xB5,0xC4,0xCD,0x73,0xA8,0x6E,0x16,0xD7,0xE9,
+	0x62,0xEA,0x1A,0x98,0x2D,0x30,0x51,0xBA,0x4C,0x58,0xC2,
+	0xA4,0xB4,0x6E,0x1C,0xCB,0x9C,0xB2,0xCA,0x4A,0x14,0xE3,
+	0x09,0x99,0xC3,0x2A,0x24,0x00,0x83,0x66,0x28,0xEA,0xFB,
+	0x19,0x42,0x6D,0x6B,0xFD,0xD5,0xF9,0xD6,0x20,0x44,0xE1,
+	0x5A,0x05,0xB8,0x62,0x0E,0x66,0x8F,0xAB,0xD0,0x8B,0x85,
+	0x86,0x9C,0xA9,0x1F,0x52,0x2C,0x5D,0x50,0x57,0xB4,0xEE,
+	0xFC,0x3D,0xDB,0x6F,0x37,0x37,0x3F,0x0F,0xDC,0x45,0x8A,
+	0xCD,0xEA,0xA7,0xE8,0xA1,0x8D,0xA0,0x5E,0x77,0xE5,0x0C,
+	0x9F,0x04,0xE1,0x27,0xD9,0x0A,0xE2,0xCF,0x6B,0x6C,0x97,
+	0x7B,0x8A,0x16,0x43,0xA4,0x27,0xC5,0xC8,0x48,0x9F,0xD3,
+	0x4F,0x35,0xF9,0x81,0xBF,0xD5,0x10,0x3E,0x9A,0xD3,0xFE,
+	0xF6,0xE7,0x8A,0x9F,0x2A,0x9F,0x72,0x94,0xED,0xF8,0x8F,
+	0xD1,0xCF,0x14,0xD7,0x73,0x93,0x26,0x67,0xCD,0x65,0x94,
+	0xCD,0x6C,0x2A,0x07,0x9B,0x1F,0x50,0xFA,0x3F,0xBF,0xF2,
+	0x35,0xE3,0x4A,0xDE,0x97,0x11,0x8F,0x95,0x05,0x37,0x06,
+	0x8D,0x57,0x06,0x8C,0x7B,0x4E,0x22,0x95,0xE8,0x91,0x93,
+	0xFC,0xB8,0x69,0xFA,0xE7,0x70,0xBE,0x28,0xC2,0x87,0x46,
+	0xD3,0x0F,0x33,0xA6,0xBF,0x20,0xB3,0x0C,0x83,0x03,0x9F,
+	0xC4,0xA8,0xA7,0xA7,0x2B,0xBE,0x11,0x5F,0x65,0xEB,0x1E,
+	0x97,0x6E,0x7C,0xB8,0x14,0xF4,0xF8,0x46,0xF3,0x24,0x78,
+	0x82,0xE2,0x92,0x75,0xFB,0x00,0xAB,0x14,0x74,0xDC,0x4A,
+	0x4F,0x62,0x30,0x21,0x43,0x93,0x1B,0xE8,0xF0,0x10,0xDD,
+	0x69,0x5E,0xD1,0x07,0x04,0x0B,0x05,0xF6,0xC6,0x83,0x8C,
+	0x22,0x1F,0x02,0x1A,0xA0,0xC9,0x84,0x78,0x55,0x04,0xE3,
+	0x89,0x6F,0x68,0xA3,0xB2,0x98,0x46,0x35,0xB5,0x12,0x03,
+	0xE7,0x9B,0x9C,0x45,0xA7,0x1D,0x35,0x1E,0x4D,0x20,0x45,
+	0x3F,0x87,0x82,0xAD,0x31,0x62,0x46,0xDF,0x98,0x3D,0x31,
+	0x7D,0x74,0x21,0x0B,0xC9,0x08,0x72,0x2B,0xF1,0x97,0x50,
+	0x71,0x6A,0xC3,0xAA,0xCD,0x89,0xFB,0x6C,0xEC,0xC4,0xF4,
+	0xF1,0x5B,0xE8,0xD0,0x8B,0xA4,0x09,0xD5,0x43,0xE0,0xEB,
+	0x32,0x26,0x60,0x2B,0x7B,0xB3,0x6A,0x90,0x10,0xEE,0xCE,
+	0x6E,0xF7,0xF8,0xCB,0x80,0x71,0x41,0xF1,0xC6,0x12,0xAA,
+	0x93,0x00,0x27,0xC1,0xCE,0x32,0x4A,0xE8,0xB2,0x43,0x72,
+	0xB8,0xB1,0x46,0x49,0xC8,0x86,0xD4,0xF9,0x67,0xF5,0xE7,
+	0xFA,0xFD,0xC8,0x2E,0xD1,0x8E,0x97,0x5D,0x04,0xEA,0xE9,
+	0xA0,0x00,0x2D,0x34,0x06,0xE6,0xD6,0xA0,0x51,0x71,0x71,
+	0x9D,0x55,0xB0,0x2B,0x7C,0xD2,0x0C,0x05,0x7C,0x23,0x24,
+	0x5D,0x1A,0x4A,0x91,0x11,0x43,0x40,0x81,0x77,0xC9,0xF8,
+	0xDF,0x40,0xCD,0x9E,0xE3,0x71,0x8B,0xD3,0x4A,0x0D,0x6A,
+	0x0A,0x29,0xFB,0x80,0x19,0xF2,0x42,0xFF,0xCC,0x75,0xA7,
+	0x18,0x01,0x1E,0x43,0x56,0xB5,0x41,0xF5,0x0A,0xB9,0x50,
+	0x02,0xDE,0x88,0x1E,0x9A,0x45,0x09,0xFD,0x53,0xFA,0x02,
+	0x71,0x5F,0x91,0xAD,0x8F,0x80,0x5F,0x0D,0x5D,0x0F,0xF0,
+	0x65,0x36,0x27,0x3A,0x0A,0x4A,0x6A,0x82,0x3E,0x28,0xFE,
+	0xE3,0x24,0xEE,0x69,0x2F,0x95,0x8A,0xB2,0x56,0x2B,0xCA,
+	0x5E,0x9B,0xC1,0x81,0x5C,0xB2,0x1D,0x61,0xCA,0xF3,0xAF,
+	0x2C,0x41,0xF7,0xB9,0xCE,0xF3,0x30,0x14,0x48,0x6D,0xC3,
+	0x5B,0x45,0x5E,0x33,0x52,0xB0,0x38,0x79,0xD9,0x54,0xD2,
+	0x0D,0x50,0xAD,0xB8,0x8D,0xFA,0xEF,0x54,0x3E,0xAE,0x3C,
+	0xE3,0x49,0x75,0x14,0xEA,0xB3,0xD8,0x91,0x50,0xF6,0x13,
+	0xAB,0xA2,0x46,0x3F,0x4D,0x43,0x8C,0x1A,0xE5,0xFC,0xF7,
+	0x5B,0xBA,0x29,0xFA,0xEC,0xC1,0xE8,0x68,0x15,0x88,0xD3,
+	0x23,0xCE,0xBF,0x66,0x69,0x02,0xDE,0xD1,0x29,0x0B,0x14,
+	0x36,0x6A,0x51,0xD8,0xED,0x82,0xF6,0x02,0x31,0xF9,0x3E,
+	0xC1,0x95,0x67,0x17,0xC4,0x3C,0xB9,0xD9,0xFB,0x62,0xD8,
+	0xB3,0x25,0x90,0x9E,0x27,0x29,0x20,0xC0,0xF9,0x26,0x6C,
+	0x84,0x6E,0x88,0x74,0x78,0x8A,0x0A,0xF1,0x96,0x96,0xCB,
+	0xB1,0xBD,0x88,0xF4,0x03,0xDD,0xFD,0x0C,0xF2,0x84,0x4C,
+	0xC1,0xD2,0x26,0x41,0x87,0xC2,0x41,0xA7,0x8E,0x23,0x4E,
+	0xE7,0x81,0xC8,0xC5,0xB8,0xE1,0x1E,0xA8,0x5C,0xE3,0x9D,
+	0x22,0x67,0x61,0xCB,0x82,0xC3,0xFC,0x18,0xC3,0x3C,0x98,
+	0x8E,0xDD,0xF8,0x1D,0xFD,0x35,0x0E,0xFB,0x81,0xAA,0xAD,
+	0xD4,0x01,0xA9,0x04,0xC9,0x3F,0x14,0xD4,0xB4,0xD4,0x1D,
+	0x49,0x53,0xD4,0x81,0x6D,0x27,0xBE,0xD2,0x7C,0x36,0xDF,
+	0x71,0x1E,0xD2,0xCE,0x38,0x11,0x17,0x97,0xFF,0xF6,0xA6,
+	0xCE,0x75,0x5B,0x8B,0xBB,0x4E,0x7C,0x1D,0xFE,0x4B,0xDB,
+	0x55,0xC9,0x26,0x67,0x11,0x67,0xB3,0x33,0x6E,0xC2,0xA5,
+	0x3F,0x99,0xD3,0x7B,0x05,0xAE,0xCE,0x23,0x4C,0x57,0x14,
+	0x61,0xAA,0x62,0x60,0x8B,0x5D,0xF6,0x53,0xF6,0x57,0xBF,
+	0xC5,0x06,0xA1,0x32,0x7F,0xD3,0xAA,0x03,0xB0,0x1B,0x08,
+	0x95,0x5B,0x03,0xF0,0x09,0xBC,0x78,0x03,0x2A,0x58,0x45,
+	0x97,0x3E,0x8A,0x1E,0xB5,0xC3,0xEB,0xB8,0x20,0xCD,0xBF,
+	0x8B,0xB5,0xDA,0x48,0x61,0xA3,0xDA,0x60,0xD0,0x63,0x0C,
+	0xC5,0x4F,0xC7,0x60,0xB6,0xE0,0xBF,0xB8,0x38,0xB1,0xA7,
+	0x88,0xF1,0x27,0x7C,0x56,0xD3,0x86,0x04,0xC1,0x81,0xE5,
+	0x5B,0x2A,0xB1,0xCF,0xE5,0x6A,0x29,0xC2,0x03,0x12,0xA9,
+	0xF1,0x93,0x08,0x1F,0xFB,0xF5,0x56,0x47,0x5C,0x99,0x22,
+	0x26,0x7A,0xB7,0x4B,0xC7,0x22,0x04,0xE9,0x46,0x1E,0xA3,
+	0x89,0x20,0xDB,0xAD,0xAA,0x94,0xA4,0xFF,0x99,0x92,0x64,
+	0x0A,0x0F,0x59,0x57,0x76,0x35,0xBC,0x8C,0x4A,0x15,0x0A,
+	0x79,0xA4,0xE5,0xE3,0xA1,0x05,0x16,0xF2,0x93,0x73,0xF5,
+	0x95,0xB2,0x08,0x06,0xAB,0x05,0x3B,0x85,0xD4,0x6A,0x9D,
+	0x23,0xE5,0xB0,0x40,0x22,0x3F,0x62,0x82,0xA3,0xB7,0x26,
+	0xF9,0xF3,0x6D,0x7E,0xC8,0xD1,0xB4,0xCE,0x0B,0x81,0xF9,
+	0x24,0x11,0xCC,0xC0,0x78,0x04,0x64,0x08,0x58,0xFA,0x5F,
+	0xA3,0x98,0xE2,0xFD,0x90,0x50,0x16,0x4F,0x51,0x3A,0xE4,
+	0x7D,0x6A,0xA8,0x0C,0xBC,0x11,0x0D,0xEB,0x76,0xCD,0x0F,
+	0xF4,0x74,0xF8,0x73,0x88,0xFA,0x0E,0x63,0x1C,0xC0,0x8C,
+	0xF5,0x44,0xAC,0xAF,0xB6,0x73,0x79,0xD4,0x92,0xDB,0xD7,
+	0xFD,0x0A,0x90,0x4B,0x35,0xA8,0xA5,0xE6,0x56,0x33,0x14,
+	0x27,0xE9,0xA2,0xFD,0x75,0x1D,0x1C,0x45,0x4C,0xA2,0x21,
+	0xEB,0xA2,0x4C,0xFA,0xF9,0x40,0x32,0xBA,0xBA,0xDE,0x42,
+	0x39,0xDA,0x4C,0x19,0x39,0x7F,0xB0,0xA4,0xA9,0xBF,0xA6,
+	0xCB,0xB1,0xE4,0xF4,0x75,0x82,0x9D,0xE2,0x58,0xB4,0x37,
+	0x09,0x1A,0xB1,0xA9,0x69,0xC1,0xFE,0x72,0xE3,0xBA,0x0C,
+	0x01,0xAF,0x77,0xC3,0x73,0x03,0xD7,0x11,0x8D,0xC6,0xA3,
+	0x3F,0xE0,0x0A,0xD4,0x3E,0x5E,0x3E,0x27,0x1B,0xCB,0x1B,
+	0x32,0xD6,0x48,0x27,0x4C,0x05,0x1C,0xA1,0xD1,0x19,0xAB,
+	0x0F,0xF6,0x47,0x6E,0x03,0xDB,0xE1,0x2D,0xC6,0x47,0xE5,
+	0x98,0x66,0xA6,0x7D,0xAD,0x53,0xBE,0x7F,0x2D,0x8E,0x4B,
+	0xEF,0x52,0x72,0xEE,0x01,0xDE,0x2B,0x26,0xB7,0xB5,0xE1,
+	0x94,0x83,0xCD,0xA7,0x16,0x1D,0x4B,0xB2,0x48,0xC4,0x72,
+	0x6D,0xCB,0xA0,0xF0,0xF3,0x53,0x04,0xF9,0xF4,0x35,0x3D,
+	0xBD,0xE2,0x1F,0x77,0x95,0xA7,0x93,0x6B,0xEF,0x95,0x12,
+	0x7F,0x4F,0x81,0x37,0x42,0x38,0x0F,0x36,0x67,0xEE,0x29,
+	0xEF,0x7A,0xA7,0x42,0x84,0xF8,0xAA,0x06,0x7F,0x39,0xB3,
+	0x50,0xC6,0x53,0x2B,0xBF,0x43,0x36,0x4A,0x57,0xD7,0xD3,
+	0x6D,0x3F,0x1E,0xCE,0xBD,0x43,0x1A,0xD5,0x6E,0x1A,0xBD,
+	0xB7,0x9E,0xB9,0x7A,0x4D,0xEF,0x9F,0x33,0xBD,0x08,0x97,
+	0x01,0x72,0x0E,0x03,0x1F,0x15,0xD9,0xC6,0xFA,0xDD,0xDF,
+	0x89,0xAE,0xDC,0x99,0x2C,0x32,0x3E,0xA6,0x16,0x37,0x78,
+	0xB8,0x2A,0xDB,0x20,0x31,0xAE,0x3B,0x2F,0x42,0x63,0x05,
+	0x34,0x4A,0xAA,0xCB,0x5E,0x98,0xFD,0x3C,0xF2,0x08,0x7A,
+	0x5E,0x75,0xCA,0x76,0x83,0xF6,0xE8,0xCA,0xEB,0x5A,0x7E,
+	0x41,0x0A,0x7C,0x27,0xB7,0x89,0x45,0x63,0x32,0x8F,0x86,
+	0xEE,0x3D,0xE3,0x46,0x7A,0xD4,0xAE,0x46,0xFD,0x3B,0xC3,
+	0x2D,0x58,0xCF,0x2B,0x5E,0xC4,0x40,0x5A,0xBD,0x7F,0x09,
+	0xA1,0x15,0x04,0xDC,0x0C,0x56,0xD1,0xBC,0x29,0x48,0xB2,
+	0xED,0x14,0x72,0x69,0xA3,0x69,0x41,0x58,0xD2,0x01,0x93,
+	0x1E,0x13,0x68,0xEC,0xB7,0x93,0xD4,0xDE,0xF5,0xD5,0x75,
+	0x7B,0x3A,0xE9,0xB9,0x1D,0xD8,0x3A,0xCB,0x32,0xC8,0xEC,
+	0xB3,0xA5,0x16,0x8C,0x3E,0x6D,0xBC,0x43,0xD6,0x80,0x25,
+	0x68,0x53,0x8B,0x82,0xA8,0x50,0xCD,0x01,0xFE,0xC7,0xC7,
+	0x0F,0x19,0x1D,0xBB,0xBC,0x4F,0x3B,0x0E,0x27,0x9C,0xD0,
+	0xCF,0x63,0x68,0x56,0xB7,0x1B,0x15,0x4C,0x6B,0x67,0x21,
+	0xCF,0x29,0x5E,0xC8,0x28,0x40,0xB5,0xE9,0x37,0x17,0xB4,
+	0xBD,0x7F,0xE7,0xC0,0x5B,0x0A,0x07,0xC9,0x34,0x57,0x39,
+	0x32,0xE7,0x69,0x2F,0x98,0xB8,0x38,0xB5,0x3D,0x4C,0x9C,
+	0xC2,0x41,0xA5,0xAE,0x9E,0x35,0x49,0xCA,0x5A,0x1C,0x29,
+	0xE9,0xBF,0xAB,0xB8,0x3B,0xB7,0x3D,0x01,0xD8,0x37,0x1E,
+	0xAF,0x5C,0xCB,0x23,0xFF,0x84,0x90,0x3D,0x83,0xEA,0xE6,
+	0x7A,0x77,0x52,0x9D,0x01,0x12,0xD6,0x73,0xBE,0xAB,0x9B,
+	0x45,0xA2,0x14,0xC6,0x7A,0x5D,0x4E,0xD5,0xD7,0xC1,0x6D,
+	0x9A,0xB2,0xCE,0xD8,0xA9,0xB3,0xA5,0x1C,0xCD,0x31,0x4D,
+	0x05,0x70,0xEA,0x37,0x26,0x21,0x79,0x2B,0xE5,0x4B,0xA4,
+	0x79,0x0A,0x88,0x7D,0x29,0xD8,0x44,0x43,0xAD,0xAC,0x31,
+	0xB1,0xCE,0x2E,0xB0,0x51,0xF9,0xE6,0xF6,0x35,0xA7,0xB7,
+	0x7C,0x37,0xB3,0x5C,0xB3,0x61,0xEB,0x5D,0x88,0x52,0x0C,
+	0x4E,0xC0,0xAE,0xE4,0x5E,0x70,0x7E,0x4E,0x26,0xCF,0x73,
+	0xA9,0x0B,0x16,0xEF,0x2F,0xBF,0x74,0xBF,0xA2,0xD2,0xA1,
+	0x6D,0xC3,0x1A,0xCE,0x97,0x50,0x7B,0x83,0x64,0x5B,0xA8,
+	0xC9,0xEC,0x84,0xA3,0xED,0xC1,0x0C,0x32,0x9F,0xC9,0x50,
+	0x4D,0x40,0x0B,0xE2,0x05,0x38,0x59,0xEB,0xDD,0x2D,0xF5,
+	0x3A,0xCB,0x2E,0x07,0x98,0x8C,0xAC,0xAE,0xDE,0x13,0x13,
+	0xF8,0xA9,0x0F,0x6B,0x2B,0xEE,0x46,0x0F,0xB7,0xD5,0x61,
+	0x9D,0x1E,0x66,0xC9,0x7D,0x52,0xDF,0x4F,0x22,0x63,0xCC,
+	0x1E,0x35,0xF0,0x6C,0xC3,0x4E,0x8A,0xB2,0x34,0xBB,0x49,
+	0xE3,0x03,0x39,0x70,0xDE,0x71,0x88,0x7C,0xC1,0x45,0x5D,
+	0x78,0xB0,0xC0,0x1F,0x7D,0x78,0xCE,0xA0,0x21,0x23,0x0F,
+	0x1C,0xB4,0xCA,0x06,0x69,0x20,0xEC,0xC0,0xB2,0x67,0xDE,
+	0x83,0xF1,0x22,0x2B,0x2F,0xC9,0x3D,0xCC,0xFB,0x6D,0x97,
+	0x86,0xA0,0xFC,0x0F,0xF4,0x03,0x06,0x0F,0x8C,0xE4,0xAE,
+	0xE0,0x73,0xAA,0x3C,0x0C,0xD6,0xB4,0x9A,0x8C,0xDE,0x7A,
+	0x17,0xAF,0x0B,0x79,0x6C,0x72,0x43,0x69,0xCF,0xE5,0x1B,
+	0xF3,0xEC,0x07,0x03,0x25,0x91,0x80,0xC3,0xEF,0xA7,0x80,
+	0xCC,0xA0,0xE5,0xC1,0xDE,0x62,0x67,0x0F,0x9F,0xD0,0x1E,
+	0x38,0xDE,0xEE,0x7B,0xC2,0xA9,0x06,0x74,0x62,0xA6,0xF9,
+	0xED,0x41,0x0B,0x5A,0xCF,0xC2,0x23,0x3F,0x96,0xEB,0xE7,
+	0x07,0x4E,0x5C,0xBD,0x87,0x6D,0xE8,0xF3,0xB4,0xF5,0xD2,
+	0xD8,0x2C,0x23,0xB8,0x6D,0x62,0x10,0x29,0x6E,0x33,0x38,
+	0x95,0xBD,0xCF,0x5A,0xDE,0x57,0x70,0x38,0xAB,0x85,0xCE,
+	0xF2,0xA8,0x4C,0x30,0xFD,0xAF,0xE2,0xA4,0x16,0x7E,0x32,
+	0xD8,0x63,0x70,0x1F,0x73,0xA1,0x3D,0x73,0xBF,0x13,0x91,
+	0x91,0x76,0x1E,0xF3,0x6C,0x5A,0x75,0x01,0x96,0xAD,0xB6,
+	0x04,0x07,0x3F,0xF7,0x0A,0x3E,0x22,0x51,0xA5,0x46,0x90,
+	0x1F,0xCF,0x09,0x5B,0xE3,0xC1,0x91,0xB1,0x81,0xC0,0xD0,
+	0x92,0xF7,0x8C,0x16,0xD4,0xEF,0xCA,0x1E,0xFC,0x9D,0xF0,
+	0x85,0x07,0x65,0x11,0x0A,0xF9,0xA8,0x74,0xB0,0x8A,0x52,
+	0xB1,0x1C,0x36,0x31,0x48,0x13,0x34,0x04,0x92,0xD9,0x1D,
+	0x3F,0x78,0x3A,0xC1,0xA0,0x08,0x57,0x91,0xC9,0xBF,0x21,
+	0x58,0x26,0x0E,0xDE,0x1A,0xC2,0x65,0x09,0x5E,0x80,0x5B,
+	0x58,0xDA,0xA5,0x80,0xBB,0xD0,0xC1,0x60,0x11,0xD4,0x15,
+	0x49,0xAC,0x61,0x26,0xBE,0xD0,0x1D,0xFB,0x17,0x9B,0x5B,
+	0x77,0x44,0x6C,0x09,0xB7,0xC4,0xBF,0x84,0x5F,0x12,0x58,
+	0x12,0xF8,0x41,0x88,0xAA,0x20,0xDA,0x69,0xB5,0x91,0x88,
+	0xAE,0xA4,0xA5,0x73,0xF4,0x0D,0xF6,0x53,0xF2,0x81,0x16,
+	0x69,0x11,0x2F,0x8A,0x8C,0x57,0x1B,0xC9,0x95,0xEC,0x2A,
+	0xE8,0x2A,0x4C,0x14,0xDE,0xAE,0xE8,0x46,0xFE,0x83,0xCA,
+	0x26,0x46,0x4A,0xEA,0x7E,0x97,0xBF,0x2C,0xDB,0x26,0xE2,
+	0x2E,0x76,0x92,0x70,0x57,0x7A,0x95,0x7C,0x72,0x5D,0x44,
+	0xF0,0xAA,0xD8,0xD5,0x92,0x66,0xAC,0xB0,0xAB,0x84,0xAB,
+	0xA8,0xAB,0xD4,0x5B,0xBA,0xDA,0x49,0x15,0x63,0xAA,0xCC,
+	0x5D,0x99,0x25,0x8D,0xAF,0x72,0x12,0xE4,0xD2,0x00,0xCD,
+	0x66,0xBE,0x67,0x29,0x15,0x6F,0x21,0xF6,0x3F,0x8E,0xE0,
+	0x4E,0x3F,0x7F,0x48,0xE0,0x1B,0xA8,0xE3,0xD6,0x82,0x8D,
+	0x84,0x89,0xAA,0x91,0x15,0xAF,0x4F,0x3A,0xB9,0xC9,0x1D,
+	0xCC,0xBB,0x34,0x9F,0x90,0xE2,0x7E,0x1A,0x78,0xFF,0xFA,
+	0xDD,0xBF,0x31,0xB9,0x06,0x8F,0xE7,0x9E,0x70,0x5A,0xCF,
+	0x45,0xF1,0xCB,0xF0,0x3F,0xF8,0xF3,0x1A,0x57,0xED,0xDC,
+	0xF2,0x23,0x3E,0x09,0x64,0x1B,0xA6,0xAA,0x04,0x7A,0x57,
+	0xBE,0x7C,0x7B,0x5A,0x16,0x15,0x26,0x8A,0xF3,0x8B,0x39,
+	0x58,0xF1,0x72,0x52,0x9F,0x3F,0x23,0x95,0x5C,0x35,0xBC,
+	0xC7,0x9D,0x62,0x08,0xF6,0x0C,0x5E,0x93,0x64,0x1B,0x61,
+	0x52,0x26,0xCB,0xE3,0xA7,0x9B,0x22,0x2C,0x6E,0xD6,0x0C,
+	0x77,0x5B,0x75,0x78,0x9F,0xC6,0xDC,0xCA,0xCA,0x85,0x22,
+	0x5A,0xFB,0xC7,0x3C,0x7F,0xDF,0x44,0xA2,0x5D,0xF9,0x43,
+	0x78,0x1E,0x06,0xB2,0xFD,0xE9,0xF9,0x87,0x0F,0x50,0xB2,
+	0xCD,0x03,0x2E,0x0C,0xB5,0x05,0x71,0x0C,0xF4,0x88,0x6A,
+	0x0A,0x7C,0x22,0x93,0x3D,0xFC,0x29,0xE2,0x83,0x57,0x1A,
+	0x34,0x7E,0xEF,0x73,0xE9,0x27,0x22,0x05,0x34,0x0C,0x27,
+	0x54,0x44,0x69,0x3D,0x81,0x71,0x6F,0xB8,0x08,0x02,0x75,
+	0xF0,0x9B,0xFB,0x75,0xAA,0x96,0xB0,0xF8,0x9F,0x6C,0xAD,
+	0xF0,0x38,0xAC,0xB1,0x17,0x39,0xA4,0x8E,0xB4,0x63,0x02,
+	0x02,0x65,0x27,0x6A,0xEB,0x11,0xC5,0x74,0x44,0x72,0xF8,
+	0x65,0x71,0x7B,0xFB,0x5D,0xEF,0x96,0x24,0x4C,0x24,0x40,
+	0x59,0x89,0xC3,0x1A,0x44,0x29,0xEA,0x90,0xB2,0xAB,0xB3,
+	0x73,0x6F,0xC5,0x75,0xF9,0x5C,0xBB,0x6C,0x5E,0x1F,0x71,
+	0xC0,0x47,0xA8,0x64,0xD0,0xDC,0x8F,0x9D,0xDC,0xEB,0x57,
+	0xB6,0x43,0xBC,0xAC,0x6D,0x58,0xF6,0x23,0x62,0x1E,0x8B,
+	0x13,0x8C,0x3E,0x4A,0x57,0xAE,0xF1,0xAD,0x73,0x27,0x95,
+	0x07,0x5D,0x89,0x3F,0x27,0xAC,0x54,0x2E,0x6C,0xBB,0xAA,
+	0x80,0x37,0x1C,0xEB,0xF0,0xA1,0x57,0x98,0x18,0x54,0xB9,
+	0xA7,0xF9,0x28,0x0F,0x8A,0x4D,0xBB,0xAF,0x1F,0xAE,0xF0,
+	0xC5,0x90,0x82,0x77,0x0A,0xEC,0x0C,0x2D,0x4A,0x40,0x84,
+	0xEE,0x67,0x25,0x47,0x48,0xF1,0x0D,0xD4,0xBF,0x30,0xF0,
+	0xB1,0xA5,0x7C,0xC7,0x25,0x07,0x4B,0xAD,0x9D,0xE1,0xBD,
+	0x1D,0x95,0xBD,0x9C,0xF0,0x10,0xF3,0xAE,0x06,0xAB,0x85,
+	0xBB,0x66,0x91,0x3B,0x09,0x26,0x65,0xBB,0x9E,0x8B,0x7A,
+	0x22,0xE4,0x93,0xD6,0xB0,0x9B,0x06,0x31,0x62,0xF0,0x57,
+	0x93,0xEC,0x37,0xC2,0x14,0x27,0x31,0x89,0x23,0x3B,0xFA,
+	0x16,0x6C,0xC4,0x09,0xA4,0x2C,0x26,0xA4,0xC7,0x34,0x2A,
+	0x9F,0x5F,0x50,0x6E,0xF2,0xEE,0xD4,0x23,0xB2,0x6B,0x51,
+	0xC1,0x38,0xB6,0x49,0xE6,0x74,0xF6,0xF4,0x2A,0x6F,0xA7,
+	0xEC,0x1A,0xB9,0xA1,0xAC,0xFC,0x72,0x72,0x1F,0x7B,0x58,
+	0x18,0x76,0xAD,0x4C,0x90,0x24,0x63,0x65,0x75,0x24,0xEE,
+	0x43,0x5F,0x6E,0x54,0x0F,0xBE,0x0E,0x44,0xFA,0x21,0x4F,
+	0xDF,0x64,0xF9,0x55,0xF4,0x1C,0xF6,0x14,0xF6,0x6B,0x50,
+	0xD2,0x02,0x25,0x59,0xF3,0xAE,0x68,0x93,0x4A,0xD2,0x83,
+	0xD5,0xAE,0xC4,0xBF,0xFD,0x08,0xDF,0x26,0xD7,0xEF,0xF8,
+	0x6C,0x9F,0xD9,0x61,0x08,0x1B,0x76,0x43,0xCE,0x7D,0x8A,
+	0x77,0xD0,0x8D,0xFC,0xB4,0xA4,0xD0,0x42,0x6E,0xF8,0x54,
+	0xDE,0x9F,0xDC,0xC3,0x1E,0xFA,0xDF,0xE4,0x27,0xAC,0xD8,
+	0xDF,0x6D,0x5D,0x5B,0xFD,0x40,0x6B,0x36,0xFA,0x04,0x46,
+	0x49,0x57,0xC1,0xF1,0x7A,0x83,0x43,0x31,0x29,0x9B,0xD8,
+	0x05,0xCD,0xF6,0x32,0xFC,0x02,0x82,0x64,0x9D,0x4D,0x51,
+	0x3F,0xFF,0x8F,0x7A,0x6C,0x21,0x54,0x90,0x90,0x62,0x8A,
+	0x69,0xC5,0x54,0x99,0x95,0xDA,0x23,0x27,0x72,0xD0,0xE2,
+	0xCA,0x87,0x17,0xD4,0x2C,0x7D,0x41,0xD7,0x63,0xDC,0xF8,
+	0x30,0xF7,0xBA,0x1E,0xC2,0xF7,0x1C,0x4C,0x26,0xB6,0xB3,
+	0xCF,0x80,0xC0,0xC8,0x60,0xE4,0x0F,0xB7,0xCB,0xC8,0x62,
+	0xBD,0xCC,0x74,0x92,0x6D,0xCD,0x9D,0xEF,0xF6,0x0E,0x12,
+	0x60,0xEA,0x12,0x00,0x57,0x11,0x99,0x9F,0xC2,0xCA,0x0F,
+	0x49,0x6A,0x09,0x7A,0xAA,0x1B,0x6F,0x3C,0x81,0xBD,0x9F,
+	0x9F,0xFD,0x84,0x3E,0x08,0xE9,0xD1,0x37,0x96,0xDF,0xEA,
+	0x4D,0x42,0x63,0x28,0x2F,0x71,0xE3,0xE1,0xE4,0x57,0xB8,
+	0xB5,0x78,0x82,0x6D,0xEC,0xB9,0xD6,0x2C,0xBF,0x93,0x2A,
+	0x77,0x34,0x84,0x2B,0x9F,0x5E,0x7E,0x4A,0x54,0x2C,0x25,
+	0x6E,0xFA,0x70,0x54,0x91,0xA0,0xF3,0x36,0x93,0x22,0x82,
+	0x13,0xF8,0xFF,0x28,0xD5,0x3B,0x82,0xE7,0xAB,0x06,0x94,
+	0xFC,0x71,0x5C,0xED,0x21,0xC8,0x24,0xF1,0x35,0xA4,0xD4,
+	0x80,0x78,0x2F,0x15,0x7A,0xB1,0x55,0xF9,0xBD,0x58,0x6E,
+	0xB7,0x4B,0x57,0x81,0x31,0x76,0xD4,0xCD,0xDB,0x41,0xF9,
+	0xED,0x8C,0xC8,0x6A,0x94,0xD4,0x3A,0xF1,0x15,0x23,0x09,
+	0x17,0xE7,0x69,0xF2,0x77,0xF5,0x2F,0xBF,0x95,0xCF,0x28,
+	0xE6,0x4D,0x1A,0x31,0x05,0x1B,0x07,0xCF,0x7C,0x4B,0xA8,
+	0xC5,0x1B,0x5C,0x51,0xCC,0x04,0x5E,0xD7,0x1D,0x0E,0xFE,
+	0x93,0xA3,0x5C,0x42,0x0B,0x56,0xCD,0x0A,0x94,0x73,0x75,
+	0x07,0x5B,0x2C,0xD9,0xAB,0x37,0x70,0x14,0xA0,0x96,0xCF,
+	0x96,0x11,0x7B,0x04,0x66,0xD2,0x01,0x6F,0x3D,0x7B,0xFF,
+	0x62,0x30,0x2C,0xE3,0x9E,0x56,0x38,0x29,0x8F,0xC2,0x4F,
+	0xD8,0xA2,0xC4,0xCB,0x38,0x50,0xCF,0xC4,0x80,0x91,0x53,
+	0x21,0x98,0xB3,0x57,0x0D,0xEA,0x38,0xC5,0x92,0x86,0x72,
+	0xFC,0x69,0x60,0xD9,0xC0,0x18,0x54,0x70,0xE1,0x81,0xA5,
+	0xE2,0xCC,0x21,0x8B,0xBF,0xCE,0x5A,0x59,0x71,0x37,0x04,
+	0x5B,0x1C,0x2E,0xEE,0x9D,0xB8,0x8B,0xB2,0x6A,0x49,0xB5,
+	0x4A,0x67,0x23,0x47,0xF8,0x94,0xBD,0x14,0xF8,0x4A,0x4E,
+	0x88,0x28,0xC9,0x2B,0x65,0x71,0x74,0xE2,0x76,0x2A,0x8E,
+	0x0A,0xF4,0xE2,0x2A,0xF2,0x73,0x75,0x87,0xB2,0x25,0x06,
+	0x71,0xBE,0xF8,0x6C,0x95,0x41,0x41,0x5F,0x62,0x56,0xC6,
+	0xD2,0xB7,0xDD,0x79,0xA2,0xCC,0x08,0xA8,0x54,0x56,0xFE,
+	0x59,0xF0,0x65,0x2D,0x72,0xA0,0x65,0xA2,0x30,0x4D,0x48,
+	0x94,0xAA,0x75,0x05,0x8B,0xB9,0x9C,0x66,0x11,0xE4,0xF8,
+	0x16,0x2D,0xDB,0x93,0x12,0x1C,0x06,0xA9,0xB0,0xB6,0xBD,
+	0xC9,0xBB,0x46,0x50,0xD0,0x51,0x82,0x06,0xA4,0xCD,0x7B,
+	0x7A,0xC9,0x64,0x88,0x64,0xA9,0x9D,0x4A,0x70,0xC3,0xDE,
+	0xFB,0x3A,0xF1,0x04,0x59,0xD4,0x9D,0x5F,0x19,0x44,0x35,
+	0xAF,0x87,0x88,0x02,0x74,0x7D,0xE6,0xE8,0x76,0xFE,0x4F,
+	0x9A,0xE0,0x4D,0xAE,0xDD,0xAD,0xB5,0xDD,0x32,0xAC,0xC0,
+	0xD1,0xC4,0xDA,0x15,0x2B,0x48,0x86,0x8B,0x0D,0x19,0x3D,
+	0x83,0xC7,0x33,0x9F,0x7D,0x42,0xC7,0x9D,0xEC,0x4B,0x85,
+	0x06,0x5D,0x97,0xE1,0x53,0xED,0x65,0x10,0xAF,0x2E,0xAF,
+	0xCB,0xDF,0xE1,0x31,0xF0,0x4C,0x2E,0x1B,0xD6,0x6F,0xCD,
+	0xDD,0xA4,0xD8,0x67,0xF2,0xD0,0x29,0xA3,0xC2,0xC8,0xE5,
+	0x6D,0x20,0xD7,0x6A,0x13,0xF0,0x04,0xF0,0x93,0x93,0xF3,
+	0x67,0x72,0x76,0x0C,0x04,0x4C,0xE9,0xA3,0xB5,0x9B,0x09,
+	0x91,0x70,0x0E,0x3F,0x9E,0xA8,0x0C,0xB8,0xEA,0x42,0x3B,
+	0xF5,0x12,0x21,0x48,0x8A,0xF3,0xF6,0x6F,0x24,0x62,0x5B,
+	0x07,0x79,0x0D,0x2F,0x3B,0x88,0x1C,0xDC,0x7E,0xEB,0xD6,
+	0x85,0x5F,0xD5,0x4B,0x44,0xF3,0x4D,0xEA,0x1D,0xC0,0x79,
+	0x5B,0xE6,0x56,0xA8,0xA8,0xF5,0xC8,0xAE,0x6A,0xE0,0xD4,
+	0xB4,0xC0,0x25,0x27,0xDD,0x3E,0xC5,0x42,0x0F,0xE6,0x52,
+	0x5A,0x2F,0xBA,0xEF,0xC9,0xF6,0xC4,0x0E,0x82,0x4F,0x8F,
+	0xC9,0x77,0x08,0x9D,0x5B,0x71,0x85,0x4F,0xDD,0x37,0x44,
+	0x4F,0xB2,0xB2,0x0E,0xC4,0xFF,0xAB,0xE1,0xDF,0x4E,0x4F,
+	0xE5,0x7D,0x3F,0xAC,0x9A,0x68,0xD2,0xCF,0x19,0x65,0x7F,
+	0xA2,0xE2,0x7A,0x21,0x09,0xC1,0x16,0x31,0x47,0x4A,0xCC,
+	0xF7,0xD8,0x35,0xEC,0xFF,0x82,0x20,0x58,0x69,0xCB,0x47,
+	0xF2,0x3B,0x99,0x3B,0x06,0x26,0xCC,0x59,0x11,0xED,0x3B,
+	0x57,0xEB,0x9B,0x9E,0xFB,0x7A,0xAE,0xB0,0x5D,0xE0,0xBF,
+	0xF4,0x5A,0xA8,0x17,0x20,0x01,0x51,0x13,0x17,0xA0,0x8A,
+	0x83,0xE4,0xB9,0x28,0x2F,0xB9,0xF6,0xAE,0x47,0x80,0x9B,
+	0x83,0xF8,0xEF,0x41,0xAB,0x58,0xEF,0x3E,0xAD,0xA3,0x7F,
+	0xDF,0xB2,0x3F,0x96,0xD1,0x43,0x0C,0x0C,0xAE,0x9A,0xBE,
+	0x47,0xC9,0x7D,0xBC,0xA8,0x27,0xE5,0xE6,0xCE,0x67,0x00,
+	0xFC,0x65,0x48,0x67,0x16,0xD4,0x49,0xBF,0xFD,0x11,0x60,
+	0x71,0x3A,0x8B,0x7D,0xDE,0xF0,0xDE,0xD8,0x3C,0x0A,0xEE,
+	0x9E,0x77,0xED,0xF3,0xBA,0xEE,0x87,0x1E,0x1D,0xC8,0x9E,
+	0x66,0x30,0x55,0xAB,0xCE,0x1D,0x0E,0xB8,0x86,0x55,0x0E,
+	0x35,0xD7,0x0A,0xEA,0x3E,0x16,0xA2,0x65,0x79,0x18,0x24,
+	0x63,0x26,0x71,0x22,0x23,0x9E,0xD7,0x75,0x34,0xCD,0xBE,
+	0x42,0x99,0xCB,0xE2,0x98,0x12,0xA5,0xAB,0x09,0x95,0xFB,
+	0xB2,0x46,0x2A,0x6E,0x22,0x85,0x7C,0x59,0x2A,0xD8,0x72,
+	0x6E,0xF0,0x5E,0x54,0x5F,0x20,0x2D,0x82,0x09,0x4E,0x3C,
+	0x02,0x16,0x98,0xC2,0xCC,0x14,0x85,0xB5,0x42,0x5B,0xE4,
+	0xAA,0x0A,0xA3,0x5D,0x51,0xD4,0xBF,0x06,0x7C,0x95,0x6B,
+	0xEE,0xF8,0x73,0x90,0x07,0xCF,0x8E,0xCD,0x87,0xB0,0xB2,
+	0xD3,0x7E,0x7B,0xC1,0xC9,0xFA,0x85,0x07,0x20,0xB2,0x77,
+	0x8C,0xCE,0xC7,0xF4,0x0D,0xE3,0x6B,0x1F,0x39,0x5A,0xF4,
+	0x18,0xF0,0x80,0x38,0x32,0xE3,0xA1,0xF0,0x43,0x17,0xF3,
+	0xDC,0xC4,0xDA,0xDD,0x51,0xE3,0x8F,0x67,0x93,0x30,0x71,
+	0x72,0x86,0x1F,0x76,0xE2,0x0B,0x07,0x64,0xB3,0x44,0xEB,
+	0x17,0x13,0x85,0x19,0x38,0x53,0x6F,0xF2,0xFA,0x58,0x9A,
+	0x03,0x32,0xE8,0xE1,0x0F,0xC8,0x63,0x52,0x8E,0xB5,0x8D,
+	0x05,0xE4,0x91,0xFB,0x56,0x90,0x30,0xFA,0x9F,0xDA,0xC8,
+	0xD0,0x70,0x49,0x95,0xD0,0x49,0xF9,0x77,0x4D,0x72,0x17,
+	0x71,0x85,0xC0,0xE1,0x18,0x71,0xC7,0x3E,0x53,0xA1,0x47,
+	0x94,0x91,0x8E,0x17,0x96,0xD2,0xAD,0x9F,0xB3,0xA9,0xDF,
+	0xAF,0xCB,0x53,0xAA,0xEC,0xFE,0x99,0xA3,0xF9,0x13,0x7E,
+	0x09,0xD2,0x13,0xFD,0xBC,0x77,0x23,0x33,0xE1,0x5B,0x84,
+	0x43,0xC1,0xFF,0xD5,0x53,0xA5,0x31,0xB8,0xB2,0x74,0xFA,
+	0x9D,0x59,0x70,0xF8,0x52,0x96,0x90,0xC2,0x32,0xF8,0xB5,
+	0x1D,0xBC,0x58,0xBA,0x4C,0xAC,0xEB,0x9B,0x04,0x00,0xC2,
+	0xDF,0x09,0x54,0x26,0xF9,0x88,0x3E,0x34,0xD1,0xC9,0x90,
+	0x89,0x13,0x01,0x3E,0xC0,0x5F,0xEC,0x07,0xB3,0x23,0x6C,
+	0x64,0xEE,0x53,0xD6,0xD5,0x18,0x86,0xF0,0x52,0xAA,0x56,
+	0x8C,0x34,0x85,0xA1,0xEC,0x6E,0x3F,0x48,0xB9,0xF7,0xF8,
+	0x46,0xBC,0x40,0x72,0xB3,0x1D,0x1F,0x9C,0xFF,0x34,0x5B,
+	0x4D,0xDC,0xCC,0x73,0x5F,0x25,0x04,0x54,0x43,0xDC,0x50,
+	0xA1,0x49,0x77,0x28,0xFF,0x81,0xCA,0x66,0x64,0x9B,0xDF,
+	0x52,0xFD,0x7E,0x66,0x7E,0xA9,0xB5,0xDE,0x92,0x19,0x4A,
+	0xF4,0x55,0x53,0xB2,0xC9,0x7A,0x95,0xBB,0x7E,0xCB,0x32,
+	0x85,0xF4,0x19,0x7A,0x34,0xCD,0x6B,0xE4,0xFC,0x8B,0xE0,
+	0x60,0x87,0xA7,0xE1,0xF8,0xCC,0x2F,0x39,0x32,0x52,0x01,
+	0x96,0xE2,0xA8,0x76,0xAB,0x34,0x7D,0x34,0xB8,0x82,0xA0,
+	0x9B,0x4E,0x6D,0xAF,0xB9,0xAE,0x41,0xE4,0x1B,0x3D,0x9B,
+	0x71,0x58,0x67,0x7D,0xBC,0xD3,0x82,0x80,0x17,0xF6,0xA6,
+	0x19,0x2A,0x81,0x3C,0x32,0x96,0x63,0x0C,0xBB,0x6D,0x01,
+	0x59,0x81,0xA0,0x27,0x0E,0x0D,0x48,0x95,0x2B,0x37,0xC4,
+	0x90,0x0E,0x4C,0xB1,0xEF,0x38,0xAF,0x13,0x1F,0xB2,0x5F,
+	0x3D,0xC4,0xFA,0x77,0x79,0x9D,0x44,0x0A,0xF5,0x65,0x00,
+	0x96,0xCD,0xA2,0xC9,0x2B,0xDF,0x31,0x09,0x3F,0xF1,0x09,
+	0x30,0x29,0x7F,0x4C,0xB0,0xC9,0xFA,0x3F,0x71,0xC4,0xDD,
+	0x4D,0x6A,0xF8,0xD2,0xC3,0x84,0xEE,0x3F,0x37,0xD7,0x1D,
+	0x4F,0x60,0x47,0xBD,0xA2,0x75,0xF8,0x50,0x7E,0xC8,0x54,
+	0x12,0x8C,0x07,0x2A,0xAB,0xC5,0x37,0x52,0xE5,0x32,0x73,
+	0x8C,0xD9,0x11,0x01,0x13,0x83,0xB7,0x02,0x39,0xBA,0x21,
+	0xDB,0xA5,0x9C,0x6D,0xEB,0x8C,0xD8,0x66,0xD0,0xFC,0x03,
+	0xF6,0xFD,0xC1,0x8D,0xA0,0xBF,0x1A,0x80,0xFF,0x81,0x78,
+	0x39,0x2E,0x2B,0x85,0xC7,0x3A,0xC3,0x93,0x75,0x50,0x55,
+	0xD5,0xE6,0xE5,0x28,0x25,0x52,0xB4,0xDC,0xE6,0x0F,0xF1,
+	0xA6,0xFE,0xFE,0x35,0xDC,0xBE,0xCB,0x99,0xE1,0x1B,0x38,
+	0xA2,0x08,0x56,0xF4,0xFF,0xD7,0x4D,0x7C,0x0F,0x89,0x6C,
+	0x20,0x56,0x76,0xB1,0x4E,0xC2,0xD9,0xA0,0xAC,0x42,0xB5,
+	0xF2,0x70,0xF0,0xEA,0xA5,0x7A,0x11,0x1E,0x24,0xAB,0x58,
+	0x4D,0xC5,0x9A,0x0A,0x7D,0xF8,0xCB,0x8A,0x2B,0xFB,0x40,
+	0x0F,0xA3,0x11,0x7B,0xF9,0xC5,0xD2,0x08,0xFB,0x83,0xEB,
+	0x6D,0xD0,0xCD,0xEC,0x9B,0xE1,0xCA,0x51,0x18,0x31,0xEC,
+	0xA2,0x1B,0xB0,0x77,0x2F,0xDF,0x8F,0x47,0x0A,0x7D,0x04,
+	0xDA,0xD0,0x04,0x98,0xC5,0x9A,0xD8,0xD0,0x43,0x7D,0x4A,
+	0x76,0xBE,0x94,0x00,0x04,0xA8,0x19,0xCC,0xFF,0x1E,0x3A,
+	0x74,0x5F,0xEB,0x14,0x5E,0xAB,0xC6,0xDA,0x89,0xBA,0x14,
+	0xBD,0x8F,0xBE,0x54,0x07,0x78,0x1F,0x5B,0xCF,0x58,0xBC,
+	0x58,0xFA,0x35,0x53,0x57,0x08,0x5A,0xA7,0xFC,0x6C,0xB2,
+	0x3F,0x2B,0xA5,0x2F,0x5D,0xA9,0xE1,0x3F,0x91,0x01,0xF9,
+	0x14,0x07,0x4B,0xBE,0xCA,0x8E,0x37,0x83,0x8E,0xC5,0x59,
+	0x72,0xAD,0xB7,0xF5,0xF7,0x34,0x66,0x4E,0x92,0x1F,0x1A,
+	0x0E,0x43,0x04,0x53,0x54,0xF0,0xF8,0xB0,0x9C,0x30,0x55,
+	0xDE,0x11,0x9D,0xFA,0xCF,0x7C,0x91,0xC3,0x78,0x74,0xB8,
+	0xC6,0xD7,0xF2,0x2D,0xAE,0x97,0x80,0xE5,0x46,0x42,0x54,
+	0x41,0x2C,0xAE,0x09,0x3F,0x43,0x63,0x24,0x68,0x9A,0x8F,
+	0x2D,0x8F,0x4D,0x47,0x4D,0xE3,0x3D,0x3A,0x7A,0x21,0xAF,
+	0x89,0x93,0xE0,0x96,0xEC,0x3C,0xBF,0x07,0xDC,0x13,0xEF,
+	0xBB,0x75,0x3F,0xEA,0xED,0x61,0x68,0x80,0x0D,0xCB,0x3B,
+	0x36,0xBA,0xA9,0x5E,0x2E,0xE6,0x0E,0xF6,0xEA,0xA6,0xCB,
+	0x27,0xC2,0x9A,0x7C,0x86,0x42,0x14,0xDE,0xF9,0xD6,0xF5,
+	0x87,0xB9,0xC0,0x39,0x3C,0xD3,0x6B,0x3F,0x6F,0xCB,0xCD,
+	0x56,0x2D,0x3F,0x95,0x98,0x87,0xA8,0xCA,0x97,0x60,0x87,
+	0xEA,0xF5,0x31,0x0E,0x8C,0xF8,0xDD,0x39,0xC3,0x7A,0x8F,
+	0xBA,0x1E,0xE4,0x46,0x8D,0xF4,0x12,0xE5,0x1D,0x71,0xE2,
+	0xAC,0xCB,0xAA,0x39,0x69,0xA0,0x62,0xD9,0xB8,0x32,0xA2,
+	0xCE,0x25,0x8F,0x17,0x92,0xAC,0x9F,0x5C,0xEF,0x43,0x18,
+	0x4F,0xAA,0xF9,0x8F,0xAD,0x9D,0x94,0x6D,0x59,0x98,0xFA,
+	0x01,0x20,0x4E,0xF4,0x3C,0x63,0x4E,0x0E,0xB5,0xCD,0x1F,
+	0xD7,0x29,0x80,0x4B,0x42,0x4B,0x4F,0x3E,0x4A,0xF2,0x2E,
+	0x0C,0xBA,0xB0,0x78,0xEE,0x81,0x74,0x81,0xA2,0xB0,0xED,
+	0xC8,0x43,0xC5,0xB9,0x38,0x3C,0x36,0xE9,0x12,0xAA,0x8D,
+	0x27,0x6F,0x5C,0xF8,0x3C,0x02,0x54,0xB9,0x68,0xBC,0xAC,
+	0x71,0xFE,0x2C,0xB6,0x35,0xDA,0x4D,0x8E,0xD1,0xFC,0x60,
+	0x67,0x46,0x53,0x52,0x58,0xE6,0x6D,0x12,0x66,0xD4,0x44,
+	0xE6,0xC9,0xF5,0x69,0xF6,0x35,0x10,0x71,0xB8,0x78,0xCF,
+	0xD8,0xAF,0x05,0x5D,0x62,0x7E,0xDC,0xE6,0x88,0x06,0x9C,
+	0xF4,0x13,0x05,0x62,0x7A,0x5A,0xB7,0x3F,0xD9,0xE2,0x5F,
+	0x63,0xF0,0xB5,0xF9,0x10,0x46,0xEA,0x65,0x26,0xB7,0x81,
+	0xC9,0x41,0xB1,0x38,0x82,0x16,0x46,0xB8,0x26,0xA3,0x85,
+	0x6D,0xF2,0x69,0xCA,0xC2,0xC1,0xB0,0x1B,0x10,0x47,0x66,
+	0x76,0x45,0x78,0x35,0x6F,0x48,0x07,0x45,0x61,0xAC,0x22,
+	0x58,0x64,0xFF,0xBF,0x89,0x54,0x63,0xF4,0xA8,0x59,0x5D,
+	0xC2,0xCF,0xC2,0x19,0xEF,0x9D,0xAD,0xD0,0x06,0x5F,0xDE,
+	0x15,0xE9,0x21,0xC5,0x21,0xAA,0x33,0x7F,0x05,0xE0,0xA3,
+	0xC7,0x5F,0x27,0x9B,0x30,0x81,0x44,0xAA,0xB5,0x1D,0x7A,
+	0x25,0x55,0x0C,0xBA,0x14,0x38,0xDB,0xAD,0xE8,0xB2,0xB5,
+	0x2D,0x1A,0x86,0xB1,0x70,0x3B,0x0F,0x31,0xB9,0x0B,0xF2,
+	0x35,0x2C,0x40,0x9E,0x7A,0xB5,0x1D,0xA8,0xD2,0xAC,0xB7,
+	0x79,0xE4,0x72,0x88,0x79,0x31,0xC8,0xC4,0x01,0x2C,0x8C,
+	0x71,0x10,0x78,0x7C,0x19,0xC3,0xB4,0xBA,0x76,0xF6,0x23,
+	0xFB,0xF3,0xE0,0x99,0x13,0x53,0x81,0xD4,0x61,0xDB,0xA7,
+	0x83,0xEC,0x36,0x43,0x0C,0x6C,0xE6,0xD4,0x77,0x95,0xE5,
+	0xC6,0xEF,0x93,0xCB,0xF2,0x71,0x0E,0x9B,0x05,0xEC,0xCB,
+	0xB6,0x4D,0xCF,0x20,0xB6,0xCB,0x84,0x4C,0xA9,0x59,0xE4,
+	0xF3,0xB2,0x9C,0x3A,0x15,0x5D,0x9A,0xF9,0x67,0xFA,0xD6,
+	0x6E,0x73,0x39,0x65,0x05,0x65,0xD3,0xEE,0x26,0x99,0xAE,
+	0x60,0x73,0x22,0xE0,0x1A,0x31,0xC6,0xB0,0xA9,0x31,0x70,
+	0x61,0x78,0x69,0x41,0x7D,0x89,0x81,0x53,0x38,0x6C,0x95,
+	0xDE,0xAF,0xA4,0x3A,0xA6,0xEE,0x34,0xCF,0x5A,0x70,0x05,
+	0x19,0xD3,0x6E,0xDD,0x89,0xA5,0x9E,0x7B,0x04,0x31,0x21,
+	0xD5,0xFB,0x19,0x37,0x2F,0x81,0x17,0x0A,0xB5,0x5A,0xDA,
+	0xB0,0x5B,0x2B,0xF5,0xE5,0xC2,0xA5,0x9C,0x4D,0xE4,0xAA,
+	0xB6,0xFB,0x61,0xF7,0xC8,0x5A,0x07,0x9E,0xD5,0xCC,0xEA,
+	0x77,0x40,0x6B,0xB4,0xC4,0xFC,0x5F,0x10,0xFD,0x64,0x7F,
+	0x6E,0xEC,0x1B,0xAE,0x27,0x89,0x7F,0x39,0x0E,0x9B,0x78,
+	0xE0,0x3D,0x70,0xCF,0x60,0xFA,0x7B,0x1C,0xE2,0x59,0x1B,
+	0x74,0xD9,0xD2,0x65,0xA7,0xC2,0x14,0x73,0x53,0xA4,0x33,
+	0x0C,0x2F,0x6F,0x11,0x70,0x04,0x13,0xD2,0x78,0x6A,0x34,
+	0x29,0x34,0x26,0xF3,0x00,0xFC,0x7B,0x30,0x7C,0x1D,0xB5,
+	0xF9,0x1D,0x2C,0xA9,0x2A,0x5B,0x3A,0x3F,0x6B,0xFD,0xA6,
+	0x7E,0xAF,0x2A,0x00,0xCE,0x83,0x0D,0xC6,0x06,0x57,0x5F,
+	0xFD,0x0F,0xB9,0x2A,0xC1,0x0E,0x8C,0x02,0x95,0x9E,0x82,
+	0x1C,0xE3,0xE3,0x0A,0x16,0xCF,0xAD,0x6D,0xC4,0x77,0x1D,
+	0xBD,0xAE,0x3B,0xD5,0xF2,0x7A,0x9D,0xCF,0x5E,0x62,0xCA,
+	0x69,0x75,0xA5,0x19,0x84,0x15,0x98,0x16,0xB5,0x3B,0xA2,
+	0xF4,0xE0,0xB5,0x4C,0x08,0x36,0xB2,0x8E,0xFB,0xD2,0x78,
+	0x22,0xB5,0x5D,0xAE,0x9C,0x1B,0xC0,0x07,0x92,0xB3,0x2D,
+	0x6A,0x1A,0x13,0xF7,0x44,0x69,0x4F,0x14,0x40,0x5F,0xFF,
+	0xC6,0x08,0xC0,0x2F,0x6A,0x3C,0xBD,0x47,0xD5,0x52,0x14,
+	0x38,0x23,0xDC,0x7F,0x86,0xFB,0xF7,0xDB,0x52,0xE9,0xF7,
+	0x25,0x9F,0xEF,0xB8,0xCB,0x56,0xB1,0xBF,0x41,0x81,0x47,
+	0x96,0x16,0xFE,0xF6,0xA7,0x88,0x97,0xBE,0x98,0x60,0x7F,
+	0x09,0xB0,0x13,0xD5,0x52,0xE9,0x1D,0x8C,0xCC,0x01,0xA9,
+	0x7D,0x2B,0x9F,0xFF,0x8F,0xFD,0xA8,0x2B,0xD4,0xBA,0xAC,
+	0xD2,0xA5,0x48,0xDE,0x89,0xB2,0x72,0xD4,0x38,0xC0,0x15,
+	0xED,0xB4,0x59,0x9D,0x40,0x83,0x69,0x04,0xF6,0xFB,0x32,
+	0x57,0xEF,0xF9,0x2D,0x11,0xE4,0xB0,0x10,0x6F,0x10,0x42,
+	0x4C,0x56,0xA6,0xE3,0xDB,0xFD,0x52,0x4D,0x7D,0x8A,0xF5,
+	0x98,0x65,0x2F,0x89,0x80,0x1E,0x7C,0xBF,0x35,0xBC,0xBC,
+	0x82,0x9F,0xA7,0xD4,0xE9,0x41,0x03,0xC3,0x96,0x3C,0xB7,
+	0x4B,0x03,0xDD,0x1B,0xC4,0xC2,0xDE,0xA9,0x7C,0x2C,0xFE,
+	0x71,0x72,0xC7,0x92,0x1D,0xFA,0x23,0x64,0xBD,0x78,0x55,
+	0x04,0xD6,0x9C,0x20,0x40,0x26,0xC0,0x05,0x02,0xE8,0xE2,
+	0xBD,0xB5,0x63,0x65,0xF0,0xD7,0x99,0x5D,0x7A,0xE0,0xE1,
+	0x95,0x65,0x01,0xCA,0xF1,0x82,0x1B,0x4B,0xB8,0x0B,0xBA,
+	0x5D,0x55,0x22,0x23,0x21,0xAA,0x25,0xDA,0xA2,0xFC,0x59,
+	0xBA,0x3D,0x95,0xAB,0x11,0x5C,0x1D,0x59,0x47,0xFE,0xB0,
+	0x1A,0xA2,0x66,0xC8,0xE9,0xA5,0x45,0x90,0xE1,0x25,0x64,
+	0x5C,0xC7,0x1F,0xA1,0xEF,0xC5,0x20,0x53,0x71,0x90,0xE3,
+	0x0D,0xDF,0xE5,0xCB,0xEE,0xD7,0xA8,0x38,0xCF,0x3F,0x10,
+	0x6F,0x74,0x01,0x86,0xF6,0x8D,0xBD,0x74,0x87,0x5D,0xF3,
+	0x61,0x30,0xBC,0x87,0xD0,0x75,0xC2,0xC7,0x15,0xDF,0x45,
+	0x3F,0x2C,0x30,0xA8,0x61,0x73,0x96,0x46,0xA1,0x3C,0x9C,
+	0xFD,0xA6,0x60,0x29,0xA1,0xA8,0xAC,0xA2,0x44,0xA8,0xC8,
+	0xED,0xCC,0x49,0x38,0x44,0x7A,0x2F,0xA5,0x9A,0x45,0xEA,
+	0x0F,0x87,0xD5,0x24,0x21,0xB6,0x40,0x72,0x6B,0x52,0xBC,
+	0x59,0x92,0x9F,0xA8,0xF4,0xAF,0xCB,0x4E,0xDA,0x4A,0x2A,
+	0xCA,0x87,0xD3,0xD3,0x1B,0x8F,0x8E,0x67,0x78,0x07,0x74,
+	0x44,0x08,0x5F,0xFC,0x96,0xE7,0xF0,0x1D,0x23,0xE9,0x6E,
+	0x5B,0x85,0xB8,0xA7,0x80,0x3C,0x7A,0xE6,0xF8,0x6F,0xF4,
+	0xA0,0x24,0x58,0xF2,0x06,0xA4,0xE6,0x29,0xEE,0x77,0xDD,
+	0x99,0x0B,0x98,0x43,0x54,0xB0,0xC0,0xCA,0xD9,0x9E,0xCA,
+	0x6F,0xBF,0x4B,0x37,0x7F,0xFB,0x6C,0xE2,0x64,0x87,0x3D,
+	0x5D,0x1E,0xDF,0x43,0xFA,0xC5,0x2D,0x93,0xEF,0xDD,0x41,
+	0x1E,0xA9,0x29,0x83,0x83,0xA6,0xA2,0x05,0x3C,0xF9,0x40,
+	0x35,0xD2,0x2A,0x54,0xED,0xA5,0x03,0xE0,0xE7,0x76,0xB1,
+	0xD6,0x3C,0x87,0x4F,0x81,0x51,0xC1,0x1C,0xF4,0x53,0x59,
+	0x69,0xE1,0x0F,0x2E,0xEA,0xE9,0x76,0xFD,0xBC,0x2F,0xAB,
+	0x7B,0xDC,0x07,0x53,0xF7,0x18,0x51,0xC1,0x1A,0x17,0xE3,
+	0xC5,0xBE,0x2D,0x56,0x03,0x9B,0x7C,0x42,0xB1,0xEF,0xF8,
+	0x51,0x85,0x03,0x73,0x56,0x42,0x2D,0x50,0x3C,0x10,0x40,
+	0x71,0xE6,0x15,0xF0,0x6E,0x69,0x0F,0xE5,0xEB,0x78,0xF8,
+	0x1C,0x7F,0x58,0x0C,0x12,0x3A,0x35,0x86,0x28,0x58,0x3A,
+	0x64,0xF1,0xB6,0x0C,0xE7,0x2E,0x6F,0x08,0x12,0x4B,0xDB,
+	0x31,0xDB,0x73,0x6B,0xF7,0xFA,0x4E,0x73,0x23,0xF8,0x7F,
+	0x97,0x03,0x7C,0x2F,0x7C,0x77,0xF6,0xFA,0x16,0x3A,0xF4,
+	0x69,0xCF,0xE2,0xDD,0x79,0xC3,0x64,0x05,0x33,0x15,0x2B,
+	0xDD,0x06,0x57,0xD0,0x66,0x46,0xE8,0x77,0x7E,0xC4,0x4B,
+	0x94,0x9F,0xF1,0x3C,0xBB,0x31,0xA7,0xA1,0xD1,0xED,0x07,
+	0x9C,0x77,0x50,0x8F,0x12,0x59,0x20,0x82,0x23,0x7B,0x7E,
+	0xF0,0xFC,0xED,0x13,0x14,0x87,0x8A,0xCC,0x7F,0xBE,0x00,
+	0x8A,0x37,0x87,0x9E,0xC1,0xF3,0xF8,0x8F,0x1C,0xF5,0x9A,
+	0x81,0x2E,0xFD,0xB0,0x1C,0xF1,0x51,0x99,0x59,0x00,0x45,
+	0x09,0x44,0x78,0x59,0xCC,0x7A,0xBC,0xB6,0xF5,0xB6,0x88,
+	0x38,0x73,0x8A,0x42,0xCB,0xC2,0x52,0xEE,0x3E,0xC3,0xE4,
+	0xB6,0xAE,0x06,0x0A,0x29,0x69,0x48,0xE6,0xA8,0xC2,0x3F,
+	0x48,0xB4,0x8F,0xE5,0xA8,0xA3,0xD3,0xD0,0x39,0x9A,0x70,
+	0x86,0xA4,0x1D,0xEE,0xCD,0x6F,0x54,0xEB,0x49,0x5A,0xB3,
+	0xE2,0x9E,0x3C,0x36,0xEF,0x9F,0x54,0xDE,0x35,0x3F,0xCC,
+	0x90,0x4A,0x77,0x82,0xE7,0x48,0xA4,0x52,0x17,0x0C,0x14,
+	0xE7,0x4C,0x94,0xB1,0x89,0x3C,0x6F,0x72,0xE4,0xD7,0xD6,
+	0xBA,0x3B,0xF1,0xD5,0x76,0xE3,0x1C,0x27,0xE2,0x38,0x0C,
+	0xE7,0x02,0x2D,0x0C,0x5A,0x29,0x08,0x8C,0xD1,0x84,0x46,
+	0xBB,0x56,0x3C,0x9A,0x0F,0xD7,0xF2,0x93,0x7B,0xC4,0x86,
+	0xA4,0x74,0x0A,0x94,0x4C,0x1F,0x74,0xFC,0x48,0xCB,0xE0,
+	0x5F,0xCB,0x5D,0xBF,0xE6,0xF1,0xE0,0x8B,0xD5,0xBA,0xDB,
+	0x51,0xDC,0x13,0x08,0x48,0xAC,0x2B,0x40,0xB9,0xC6,0x9E,
+	0x3A,0x95,0xA0,0x86,0xCF,0xF4,0x95,0x69,0x14,0x22,0x97,
+	0xA1,0x62,0x17,0x0A,0x8D,0x8E,0x3A,0xBC,0x1A,0x41,0x81,
+	0x04,0x39,0x3B,0x07,0x13,0x09,0x99,0x4B,0xD4,0xFC,0xF5,
+	0xCF,0xBB,0xB7,0xC0,0x19,0x53,0x22,0xC7,0x32,0xB4,0xB3,
+	0x8F,0x6F,0xED,0x31,0xE3,0xFB,0xE4,0xAE,0x2F,0xA5,0x50,
+	0x22,0x3D,0xBB,0xF2,0x4F,0xF0,0xA5,0x3C,0x26,0x5A,0x64,
+	0xFD,0x7C,0xF3,0x3D,0xDF,0xFE,0xF1,0x67,0x44,0x40,0xEA,
+	0x4F,0x78,0x35,0xCA,0xD6,0xF8,0x31,0xD2,0xCA,0xC4,0xAF,
+	0x15,0x75,0x67,0xE8,0x17,0xF9,0x0E,0xE4,0xB4,0xE0,0x23,
+	0x8A,0xB6,0xE5,0x1B,0xBA,0xD7,0x2B,0xCF,0x7C,0x64,0x4D,
+	0x0D,0x6E,0xCF,0x6A,0xCC,0xAD,0x20,0x48,0xC5,0x92,0xC3,
+	0xD6,0xD7,0x8B,0x51,0x10,0x08,0x3D,0x7A,0x67,0x44,0x74,
+	0x4E,0xA0,0x6A,0x1E,0xC1,0x24,0xBF,0x98,0x35,0xB5,0x9F,
+	0xAF,0xD4,0x7E,0xC2,0x10,0xA8,0xEE,0x16,0x56,0xD3,0x93,
+	0x46,0x93,0x52,0x4D,0x64,0xAA,0xCD,0x64,0x32,0xE4,0x21,
+	0x39,0x2C,0x46,0xE0,0x6C,0x8B,0x24,0x1A,0x1E,0x26,0x65,
+	0x0F,0x31,0xEC,0x7B,0x26,0x89,0x45,0xB8,0x63,0x46,0x22,
+	0x11,0xD8,0xD1,0xB3,0x71,0xB8,0x14,0x0B,0xE4,0x89,0x06,
+	0x52,0x18,0xF2,0xF9,0xA7,0xF3,0x74,0x91,0x0C,0xF2,0x14,
+	0x3A,0x01,0xC1,0xD6,0x4A,0x7E,0x26,0x87,0x15,0x96,0xCC,
+	0xC7,0x4B,0x96,0xB2,0x08,0x05,0x13,0xDD,0xB8,0x41,0x0D,
+	0xE9,0x51,0x38,0xC5,0x59,0x45,0x67,0x86,0xD4,0x40,0x20,
+	0x3C,0x53,0xC4,0xD4,0x7E,0x06,0x7F,0x43,0x32,0x63,0x7C,
+	0x35,0x91,0xD1,0xD6,0x0B,0x0F,0x10,0x16,0x6D,0xA3,0x12,
+	0x7A,0x0D,0x5D,0x40,0x3F,0xDD,0x95,0xF5,0xF1,0x3A,0xF0,
+	0x21,0x39,0xF3,0x41,0x24,0xFC,0x55,0xFE,0xA6,0xF8,0x27,
+	0xAF,0x72,0x2F,0x0D,0xC7,0x23,0x1F,0x82,0xC6,0x99,0x19,
+	0x26,0x1F,0x21,0xEB,0xAE,0x97,0x31,0x85,0x2E,0xD1,0x7F,
+	0x1F,0xB3,0x9B,0xD3,0xED,0xC5,0x21,0x3B,0x91,0x66,0x26,
+	0x82,0x6E,0x27,0x22,0x0D,0x60,0x39,0xC2,0x52,0x71,0x26,
+	0x3B,0xFE,0xF0,0xCA,0xA8,0x46,0x36,0xE1,0xA6,0xB5,0x4F,
+	0x73,0x5A,0x78,0xDE,0xAB,0x58,0x44,0x79,0x80,0xB4,0x5D,
+	0xB0,0x2F,0xD9,0x67,0x85,0xC1,0xB3,0xFE,0xD6,0xCC,0xBD,
+	0x95,0x3F,0x03,0x36,0xEA,0x3B,0x32,0x3D,0x73,0x94,0x87,
+	0xD7,0xAF,0xC0,0xDD,0xEF,0x02,0x02,0xDA,0x83,0x0E,0x7F,
+	0x27,0xBF,0xB1,0xFA,0xE0,0x0F,0xB7,0xFF,0x46,0x44,0x0E,
+	0xB1,0x11,0x01,0xDE,0xE1,0x5E,0xC5,0x77,0xE3,0x9E,0xA1,
+	0xDC,0xC9,0x27,0x4A,0xCF,0xE1,0x33,0xDE,0xD5,0x34,0x1C,
+	0x16,0x59,0x11,0xDF,0x04,0xA7,0x3B,0x53,0x65,0x84,0x08,
+	0xA3,0xAC,0xA8,0xC6,0x14,0xDE,0x6F,0x81,0x4C,0x5E,0x16,
+	0x45,0x24,0x93,0x7E,0xB6,0xD3,0x22,0x1B,0xF2,0x71,0xEF,
+	0x6B,0xA9,0x15,0xEE,0x82,0x5F,0x29,0xFB,0xA6,0xA8,0x0A,
+	0x27,0xFD,0xDB,0x79,0x11,0x71,0x09,0xDC,0x0D,0xB9,0x5C,
+	0x20,0x52,0x8E,0xA7,0x21,0xF4,0x34,0x86,0xA6,0x63,0xB3,
+	0xA3,0xAC,0xF8,0x7D,0x29,0xBF,0x5C,0x98,0x0A,0x4D,0x53,
+	0x64,0xBD,0x01,0x10,0x0D,0x3D,0xA8,0x43,0x23,0x9C,0x6D,
+	0xCC,0x0F,0xF2,0xD2,0x4E,0x7E,0xEA,0x64,0x6A,0xC5,0xE7,
+	0x4C,0xC6,0xD4,0xBF,0xC8,0x08,0xC3,0x8A,0x10,0xC8,0x14,
+	0x1F,0x6F,0xE1,0x45,0xB9,0x1C,0x2F,0x51,0x4C,0xFC,0x74,
+	0xC5,0x4A,0x83,0xBA,0xBF,0xFE,0x6D,0x95,0x61,0xBA,0xFC,
+	0x98,0xF5,0xAE,0xC7,0x6F,0xFF,0x64,0xFE,0x40,0x19,0x63,
+	0xB6,0x2B,0x8E,0x8F,0xCF,0xA9,0xE1,0x18,0x5E,0x0A,0x86,
+	0x91,0x2D,0x94,0x7A,0x2A,0xE1,0x59,0xFA,0x38,0xE1,0xE8,
+	0x59,0x4F,0x99,0x77,0xB5,0x6A,0x67,0x68,0x4F,0x36,0xCE,
+	0x3D,0x45,0x2B,0xF5,0xFB,0x63,0x08,0x54,0x1B,0x63,0x03,
+	0xA7,0x30,0x72,0x16,0x5A,0x0E,0x5F,0xF0,0xE3,0x75,0x4F,
+	0xC1,0x05,0x7D,0xEF,0x57,0x7D,0xC2,0x58,0x1C,0x3B,0x74,
+	0x32,0xFF,0x77,0xAD,0xED,0xF7,0xA0,0x87,0x37,0x5D,0x29,
+	0xDF,0xEE,0xC6,0x7F,0xF2,0xF3,0x85,0x62,0xE1,0xAA,0xE4,
+	0xB3,0x21,0x95,0xF6,0xB0,0x56,0x84,0x20,0x05,0x5A,0x90,
+	0x2B,0xFE,0x82,0xEF,0x41,0x5F,0x6C,0x04,0xE4,0x84,0xFC,
+	0xA8,0x93,0x80,0xA3,0x66,0x42,0x86,0xDB,0xC3,0x5A,0x27,
+	0x6F,0xFE,0xE1,0x0D,0xD9,0x21,0x13,0xB4,0xE2,0x47,0xEA,
+	0xE9,0xA9,0x5F,0xF2,0x5A,0x2E,0x56,0x75,0xF6,0xF0,0xDF,
+	0x43,0xB2,0x25,0xC7,0x49,0x6E,0x7F,0xEE,0x79,0xBE,0xA4,
+	0x1D,0x0E,0xCD,0xAE,0x62,0x83,0x23,0x05,0xDB,0x97,0x39,
+	0x0D,0x19,0x06,0x8A,0x20,0x70,0x31,0x9F,0x45,0x17,0x14,
+	0x0B,0x2D,0x6C,0x2A,0x3D,0x08,0xAD,0xE2,0x9C,0xD4,0x0C,
+	0x39,0x5E,0xDB,0xFD,0xB7,0xA7,0x15,0x2E,0x69,0x55,0x69,
+	0x6D,0x4B,0xBB,0x70,0xAC,0x8A,0x5F,0x56,0x16,0x35,0x25,
+	0xB0,0x32,0x89,0x1A,0xC1,0x61,0x40,0xD6,0x97,0xC3,0x8F,
+	0x5C,0x15,0x0B,0x52,0x3E,0x50,0xFB,0x56,0xFB,0x63,0xC8,
+	0x9A,0x30,0x68,0x9F,0x9A,0xBA,0x43,0x02,0x39,0xFE,0x61,
+	0x37,0xB1,0x1B,0x9F,0xFE,0x08,0xE1,0xA5,0x6B,0x41,0x7D,
+	0x76,0x03,0x26,0xC6,0xE3,0x2C,0xAA,0x8E,0xCB,0x35,0xC6,
+	0xC9,0x02,0x1F,0x25,0xD2,0x57,0x5F,0x5B,0xCC,0xCB,0xC3,
+	0x5D,0xA0,0x95,0x5D,0x6F,0x43,0x35,0xBE,0xF4,0x22,0xA1,
+	0x1D,0x66,0xA5,0x48,0xC0,0xE1,0x42,0x9C,0x18,0x5A,0x42,
+	0xF0,0xAB,0xD2,0x87,0x60,0x6D,0x15,0xF9,0xAA,0xB6,0x14,
+	0xCF,0xF4,0x2E,0xF7,0xAB,0x22,0xEF,0x22,0x93,0x2F,0xD8,
+	0x58,0x3D,0xB2,0x07,0x7A,0xFE,0x8F,0x42,0xFB,0x8E,0x87,
+	0xC2,0xF1,0x1F,0x38,0x7E,0xDB,0x6D,0x77,0xE7,0xDC,0x9D,
+	0x11,0x77,0x9C,0x7D,0x66,0xF6,0x3C,0x67,0x67,0x64,0xEF,
+	0x64,0x1C,0x49,0x67,0x64,0x56,0x46,0xC7,0xD9,0x54,0x48,
+	0x88,0x92,0x55,0x21,0x95,0x95,0x44,0xC9,0x4A,0x46,0x8A,
+	0x86,0xAC,0x84,0x54,0x56,0x25,0xF9,0x48,0x12,0xBF,0xEF,
+	0xEF,0xEF,0xF7,0x9F,0xEF,0x3F,0x5E,0xEF,0xE7,0xE3,0xF1,
+	0x2E,0xF0,0x39,0x3D,0x7C,0x7E,0x3C,0xF9,0x42,0x30,0x5A,
+	0x4E,0x33,0x19,0xEC,0x4E,0x1F,0x7C,0x61,0xA9,0x70,0x8B,
+	0xFD,0x37,0x1D,0xFB,0x2A,0xD9,0x0B,0xC0,0xB7,0x2A,0xAB,
+	0xFF,0x80,0x74,0x1E,0x5C,0x4B,0xFE,0x74,0xEF,0x4C,0x96,
+	0x73,0xC3,0x41,0xF2,0x79,0x90,0x9F,0x71,0xCC,0x43,0x79,
+	0x3E,0x23,0xC7,0x6F,0x8E,0x31,0x92,0xB0,0xFD,0xA7,0x5F,
+	0x80,0xC6,0x7E,0x31,0xC2,0x3F,0xE0,0x4B,0xC0,0xC8,0xC8,
+	0x17,0x31,0xF8,0x87,0xE6,0x2E,0xF5,0x66,0xD6,0x28,0xDE,
+	0xF4,0xD3,0xBD,0x6B,0x43,0x95,0xC6,0x96,0x16,0xA9,0xAD,
+	0xA2,0x08,0x20,0x6F,0xAD,0x91,0x8A,0xCF,0xBB,0xC6,0x77,
+	0x32,0x39,0x1B,0xBD,0x4D,0xA7,0xFB,0x0C,0x9D,0x53,0x7B,
+	0x07,0xE5,0x6D,0xF3,0x1B,0xA0,0xC3,0x79,0x18,0x03,0x5C,
+	0x38,0x04,0x6E,0x40,0x55,0x26,0xAF,0x94,0x1B,0x47,0x26,
+	0x48,0x66,0xB2,0x41,0xD7,0x56,0xAE,0xA3,0xFF,0x12,0x04,
+	0x1E,0xA1,0xB5,0x33,0xAB,0x8B,0xCC,0x10,0x16,0xD8,0xA2,
+	0x7F,0x02,0xF8,0x1C,0xE3,0x2E,0xB1,0x8C,0xEF,0xC0,0x39,
+	0x48,0xF1,0x3A,0x90,0xB1,0xD7,0x6A,0xB2,0x27,0x0B,0x35,
+	0x30,0x53,0x1B,0x97,0x64,0x8C,0x65,0x3C,0xC2,0xFA,0xC5,
+	0x47,0x76,0x35,0xEE,0xE7,0xA9,0x87,0x08,0xC8,0x80,0x4A,
+	0xA9,0xC1,0x34,0x02,0x0A,0xBE,0x88,0xBE,0x73,0xF9,0xA3,
+	0x94,0x65,0x0F,0x3B,0xEF,0x5E,0x19,0xF3,0x3D,0x6A,0xA8,
+	0x6B,0x6F,0x48,0xF8,0xD5,0xEA,0x32,0x95,0xD1,0x78,0x37,
+	0xBD,0x14,0x30,0xC2,0xC9,0xED,0xFF,0x23,0x07,0x95,0x7A,
+	0x93,0xAE,0x14,0x0C,0x09,0xD2,0xD6,0xB7,0x78,0x43,0x15,
+	0x58,0xD6,0x5F,0x5D,0x20,0x2E,0xEB,0x9A,0x2C,0x64,0xAE,
+	0x8E,0x6D,0x72,0xEA,0xBF,0x37,0x7F,0xE9,0x5E,0x06,0x5B,
+	0x27,0xCB,0x82,0x9F,0x5A,0x7A,0xCA,0x21,0xA2,0x21,0x94,
+	0xED,0x0D,0x4F,0x4F,0x15,0xC5,0x59,0x9D,0xCC,0x92,0x7D,
+	0x9B,0x9D,0x64,0x39,0x62,0x90,0xB5,0x22,0xE3,0xDB,0x04,
+	0x34,0x0A,0x92,0x3D,0xBD,0xB6,0x49,0xE0,0x8F,0x9E,0xCB,
+	0x06,0x4E,0xFC,0x98,0x45,0x8D,0x7C,0x99,0xCC,0xCE,0xF1,
+	0x7E,0x64,0xBE,0xFF,0x1D,0x52,0x3E,0x30,0xF1,0xC1,0xF5,
+	0x13,0xDD,0x65,0xFE,0xB2,0x9C,0xE5,0x5B,0xC2,0x60,0xC0,
+	0x73,0x25,0x5F,0xAA,0x5B,0xD2,0x09,0xCD,0xCA,0xCD,0x19,
+	0x78,0x45,0x63,0x19,0xFC,0x7B,0xB8,0xF7,0x2C,0x38,0xEA,
+	0x63,0x3B,0xE4,0x86,0xBA,0x2C,0xE6,0x5D,0xDE,0xD6,0x2C,
+	0x07,0x4E,0xF9,0xEC,0x93,0x9E,0xFB,0x9F,0xB1,0x62,0xC7,
+	0x62,0xA3,0x52,0x95,0x8D,0xD9,0xDA,0xDD,0x9D,0xDB,0xD7,
+	0xBE,0xCD,0xE1,0xE6,0x19,0x80,0xBE,0xD4,0xF2,0x17,0xB3,
+	0x4C,0xFF,0xC9,0xBA,0x78,0x61,0x94,0x66,0xF6,0x8B,0xB8,
+	0x23,0xA6,0xB5,0xF0,0x15,0xA4,0xA5,0xB2,0xC9,0xA2,0x24,
+	0xA4,0x35,0x1A,0x1C,0x79,0xD0,0x53,0x9B,0x1F,0x2F,0x48,
+	0xF5,0xC9,0xB5,0x1D,0xFF,0x83,0xD0,0x46,0xB0,0xA5,0x65,
+	0xAE,0x00,0x98,0x52,0xAB,0x9A,0x68,0xD9,0x73,0xF2,0x00,
+	0xE5,0x28,0xC8,0xBC,0x17,0xFD,0x66,0x46,0x34,0xDD,0x63,
+	0x36,0x7B,0xE8,0x0F,0x4C,0x00,0x30,0x25,0x68,0xD1,0xAD,
+	0x22,0xD4,0x9D,0x78,0x61,0x2D,0xA7,0x44,0xBD,0x52,0x1A,
+	0x91,0x20,0xAD,0xE9,0xFE,0x94,0x92,0x65,0x8F,0xF0,0xFB,
+	0xE1,0xFF,0x75,0x6B,0x7D,0x29,0x08,0xC8,0xBB,0x4C,0xBE,
+	0x63,0x47,0x45,0x4D,0x1E,0x03,0x7E,0x73,0x72,0x54,0x7E,
+	0xBB,0x36,0xE3,0x2B,0x56,0x6B,0x5D,0xD7,0x28,0x71,0xBF,
+	0x48,0x21,0xC2,0x9D,0x50,0xC0,0x22,0x48,0x3C,0xFD,0x3D,
+	0x29,0xD2,0x9D,0xC5,0xA4,0x68,0x1A,0xB9,0xF9,0x04,0x5E,
+	0xF9,0xBC,0x72,0xE2,0x1D,0xFB,0xC0,0x9D,0x93,0x6A,0xD9,
+	0x73,0xE5,0x41,0xB3,0x35,0x5B,0x55,0xAA,0x4C,0xDD,0x1D,
+	0x91,0x17,0x88,0x93,0x77,0xB9,0x53,0xCC,0x04,0x0B,0xAA,
+	0x78,0x4F,0xEA,0xE6,0x34,0x2B,0x08,0x1B,0xF5,0xBA,0xB4,
+	0x2A,0xCD,0xAF,0x29,0xC0,0x7D,0x68,0x90,0x46,0xE0,0x84,
+	0x1C,0x78,0x01,0xD9,0x7D,0x07,0x1B,0x61,0x1D,0x25,0x66,
+	0x45,0x01,0xFB,0x1D,0x27,0xC0,0x41,0x34,0x59,0xC4,0x2D,
+	0xDB,0x1F,0xB8,0x02,0xD9,0x27,0x8B,0xA5,0xEB,0x90,0xF3,
+	0x37,0x2B,0xA0,0x2D,0xDD,0x49,0xCC,0xFE,0x1B,0xDE,0xE0,
+	0x49,0xFC,0xC7,0xE2,0x6C,0xBB,0x1D,0xEE,0xC2,0x6F,0xBE,
+	0x37,0x3B,0x52,0x21,0x39,0xBA,0x0C,0xB7,0x9D,0xF4,0xDF,
+	0x3E,0x4B,0xAA,0x92,0x2F,0x73,0xF1,0xD5,0xC5,0x60,0xCA,
+	0x6F,0xB5,0x0A,0x81,0xE5,0x5C,0xB0,0xB3,0x10,0x06,0x0F,
+	0x7F,0x7C,0x01,0x5F,0xF4,0x7D,0xC3,0x84,0x5B,0x7D,0xAD,
+	0x14,0x97,0x1C,0x3E,0xDD,0x1A,0xA7,0x7E,0x98,0x3D,0x39,
+	0x78,0x8B,0xBF,0x61,0xAD,0x1E,0xEF,0x17,0x6C,0x43,0x96,
+	0xB9,0x5E,0x47,0x55,0x8B,0x1F,0x3C,0xB3,0x50,0xCA,0x77,
+	0xB2,0xDF,0x9F,0x32,0xA5,0xB4,0xCA,0x5E,0xD7,0x69,0x00,
+	0x16,0xD9,0x58,0xB1,0x5C,0xA4,0xA6,0xFA,0xE9,0x01,0x47,
+	0x4B,0x73,0x8F,0xC2,0x61,0xCD,0xDD,0x7A,0x81,0xB8,0xF7,
+	0x98,0x03,0xC9,0x90,0x95,0x47,0x27,0xFF,0x6E,0x78,0xAF,
+	0x74,0x96,0x6C,0xAD,0x74,0xFF,0x00,0x08,0x4E,0x56,0xC7,
+	0x50,0x6B,0x98,0x38,0x21,0x20,0xF7,0x12,0x3E,0x5F,0x17,
+	0xA0,0xD7,0xE7,0xA3,0x29,0x1E,0xCC,0x74,0x6C,0x0F,0xAD,
+	0xC9,0xF0,0x91,0x96,0x3D,0x25,0x97,0xB3,0x83,0x67,0x69,
+	0x6B,0xF8,0xB4,0x77,0xDA,0x6D,0xD6,0x00,0x1D,0x92,0xB5,
+	0x63,0xFD,0x9F,0x10,0x72,0xEE,0xAD,0x7F,0x19,0x96,0xEE,
+	0x65,0x26,0x99,0xED,0xAF,0xB0,0xF6,0x87,0x55,0x74,0x86,
+	0x80,0x45,0x44,0x7C,0x5D,0x40,0xE0,0xE6,0xD4,0x16,0xE0,
+	0xDF,0x00,0x98,0xDD,0x2D,0x10,0xDC,0xA2,0x99,0x7D,0x68,
+	0xB2,0x5C,0xCF,0x0B,0x16,0xBB,0x18,0xF3,0x7B,0xDF,0x36,
+	0x7C,0x33,0x16,0xF1,0x6D,0x1F,0x47,0xB8,0x2F,0xF3,0x8F,
+	0xB6,0x14,0x01,0x9C,0x3A,0xEA,0x99,0xF3,0x1C,0xF4,0xE1,
+	0x30,0xAA,0x05,0x58,0x87,0x10,0x47,0x83,0x39,0x71,0x02,
+	0x15,0xA9,0x1F,0x4F,0x2A,0x1E,0xAA,0x98,0x4E,0xD6,0x73,
+	0x67,0x91,0x55,0x03,0xB7,0x45,0xDF,0x73,0xF7,0x0E,0xFD,
+	0x5B,0x11,0xFE,0x17,0xB7,0x2F,0x75,0x00,0x24,0x60,0xD4,
+	0x77,0x8E,0x11,0xB7,0x83,0x8C,0x7B,0x74,0x99,0x45,0xC6,
+	0x83,0x57,0xD1,0xB4,0x1E,0xBE,0x4F,0x54,0x23,0xDE,0xDE,
+	0x0A,0x77,0x2F,0x50,0x45,0x74,0x95,0x3B,0xE2,0x78,0x94,
+	0xBB,0x27,0x15,0x81,0xEB,0x54,0x65,0xFE,0xD3,0x46,0xF6,
+	0x3E,0xE4,0x59,0x29,0xFD,0xB4,0x66,0x72,0xAD,0xEA,0x2E,
+	0x31,0x34,0x47,0x7B,0xFF,0x82,0x52,0x0F,0x4D,0x69,0xE8,
+	0x02,0x80,0x95,0x03,0x92,0xB5,0xAE,0x49,0xBF,0x9F,0x2A,
+	0xC2,0xA4,0x2E,0x5E,0x39,0x71,0x59,0x2F,0x5D,0xBA,0x71,
+	0xA1,0x43,0x02,0xF2,0xA2,0xA3,0x10,0xAD,0xA5,0xF3,0x9C,
+	0x65,0xDD,0x01,0x53,0x0D,0xC2,0x45,0x29,0xAA,0xC4,0x0A,
+	0x89,0x82,0xDD,0xA7,0xEF,0x50,0xB0,0x48,0x45,0x4E,0xD1,
+	0xEE,0xB6,0x03,0x85,0x0F,0x6D,0x36,0x13,0x8D,0x80,0xDC,
+	0x0E,0xE9,0x67,0x21,0x68,0x54,0x59,0x13,0x52,0x84,0xB6,
+	0xAA,0x25,0x74,0x37,0xBF,0xFD,0x89,0x8E,0xA9,0xEC,0x73,
+	0xC6,0xB6,0x28,0x11,0x38,0x8E,0xB5,0xA8,0x7B,0x7A,0xA4,
+	0xDD,0x9A,0xE8,0x57,0xA7,0xAE,0x43,0xFC,0x69,0x29,0xE0,
+	0x28,0x0D,0x99,0xB2,0x3D,0xAF,0x96,0x68,0x92,0x23,0x8B,
+	0xFB,0xA7,0x8D,0x6D,0xF0,0x79,0x26,0xF1,0xB7,0xDB,0xE6,
+	0x91,0xBB,0x74,0x87,0xE5,0xE9,0xD2,0x59,0xFA,0x2D,0xFF,
+	0x93,0x63,0xD1,0x35,0x5E,0x0C,0xA4,0x24,0x3D,0x41,0xE5,
+	0x8C,0x45,0xEA,0xFB,0x0B,0xC6,0xBC,0xB4,0x55,0xE9,0xBF,
+	0xC6,0xBE,0xA8,0x73,0x8F,0xD7,0xFA,0x78,0x41,0x69,0xA2,
+	0x4F,0xD3,0x8F,0x35,0x79,0xA0,0x3E,0x18,0x7D,0x46,0xDA,
+	0x19,0x6D,0x5B,0xA0,0xCC,0x27,0xDF,0x9A,0xAE,0xDA,0xB9,
+	0xFF,0x84,0xD8,0x9B,0x58,0xFD,0x27,0x2F,0x97,0x81,0xF2,
+	0xF5,0xC2,0xC4,0x58,0xD6,0xD9,0xE2,0x52,0x69,0xBC,0x56,
+	0x06,0x54,0xE4,0xF3,0xC0,0xAA,0xF9,0x01,0x80,0xC9,0x3A,
+	0x21,0xF1,0x01,0x89,0x84,0x40,0xF4,0x67,0xA5,0xE0,0x15,
+	0xC5,0x6F,0xC5,0xB7,0x39,0x0C,0xA0,0x2D,0x8F,0xAB,0x05,
+	0xC8,0x76,0xDD,0x3F,0x68,0x03,0x8C,0xEF,0x82,0x7A,0x0D,
+	0x6C,0x6A,0x25,0x04,0xF9,0x21,0xBF,0xC7,0x66,0x65,0x2C,
+	0xA9,0x6E,0xCC,0x16,0xB8,0xEC,0x22,0x38,0x61,0x06,0xE3,
+	0x4A,0xB8,0xE9,0xAD,0xE6,0xAF,0x3E,0x05,0xD9,0xFE,0xBA,
+	0x53,0xFE,0x7D,0xC3,0xA1,0x39,0xFE,0xF5,0xC8,0xCB,0x31,
+	0x8A,0x43,0x18,0xB6,0xEE,0x6D,0x2B,0x76,0xE2,0x96,0x39,
+	0x47,0x6A,0xBA,0xDA,0x1F,0xF6,0xD2,0xE3,0x53,0x73,0x16,
+	0x18,0xB2,0x88,0x43,0x7A,0x24,0x70,0x10,0x03,0xFB,0x20,
+	0xFF,0x07,0x06,0x98,0xBE,0x4D,0x1E,0xE8,0x0D,0x1B,0xD2,
+	0x9F,0xA6,0x3A,0x85,0xD4,0x9C,0x89,0xA4,0x3C,0xC7,0x5B,
+	0x59,0x7D,0x5C,0x85,0xAC,0x2B,0x84,0x3D,0x58,0xB6,0x87,
+	0xFB,0xD5,0x9A,0xFD,0xE2,0x45,0x9A,0xCF,0x83,0x26,0x10,
+	0xF4,0x28,0x5F,0x8A,0xED,0x13,0xB6,0x43,0x97,0x65,0x22,
+	0xE6,0xDF,0x4C,0xE2,0x81,0xD7,0xB2,0xE2,0x2A,0x89,0x3C,
+	0x9D,0x64,0x01,0x2B,0x18,0x90,0x03,0x05,0xFA,0x32,0xC6,
+	0xDA,0xF4,0x20,0x23,0xE9,0xC6,0xAF,0x0F,0x92,0x05,0x76,
+	0xB8,0x80,0xC4,0xC8,0x85,0x5C,0xC7,0x85,0x14,0x0D,0xB4,
+	0xB7,0x33,0xDD,0x46,0x7B,0xFE,0x51,0xA8,0xE5,0x53,0x2E,
+	0xB8,0x77,0x92,0xA9,0xBD,0x03,0x76,0xC0,0x8F,0xF0,0x2A,
+	0x92,0x91,0x65,0x2F,0x5A,0xD8,0xD7,0x62,0x8F,0x88,0x06,
+	0x88,0x41,0xB9,0x67,0xD4,0xCA,0xD6,0x07,0xF7,0xE9,0xD5,
+	0x45,0x85,0xD5,0x26,0x5B,0x86,0xE0,0x35,0x28,0x7C,0xDF,
+	0xEB,0x0B,0x2B,0xB8,0xAD,0x76,0xCB,0x73,0x33,0xD5,0x58,
+	0x4B,0xC0,0x72,0xC0,0x3D,0xD9,0x5A,0xA9,0xA1,0x5B,0xE8,
+	0xEA,0x41,0x6B,0x01,0x80,0x42,0x3F,0xD4,0x89,0x0E,0x6E,
+	0x40,0x7E,0x3A,0xA7,0xA1,0x58,0xAA,0x77,0x55,0x5F,0xA5,
+	0xA3,0x5B,0x04,0xB7,0x7C,0x4F,0x25,0x20,0x6F,0x02,0x26,
+	0xB5,0xE0,0x30,0xD2,0xD0,0x93,0xFB,0x4F,0x85,0x13,0x2C,
+	0x2F,0x05,0xB8,0xB3,0x14,0xD5,0x6E,0x99,0x64,0x7F,0x24,
+	0x21,0x52,0x09,0xC2,0x20,0x4B,0x72,0x6E,0x2E,0x3E,0x9D,
+	0xE7,0xF5,0x02,0x05,0x83,0x9B,0xD0,0xC6,0x22,0x73,0x0F,
+	0xD9,0xB3,0xCF,0xAC,0x0B,0x4B,0xFC,0x4E,0xC4,0x25,0x24,
+	0x5A,0xEF,0xEB,0xB0,0x8F,0x92,0x57,0xA6,0x0C,0xFE,0xBD,
+	0x0D,0xC9,0x15,0x48,0x45,0xC8,0x1C,0xDB,0x23,0x45,0x20,
+	0xBB,0x5F,0x8F,0xB3,0x4F,0x3D,0xA3,0x08,0xF8,0xC1,0xB1,
+	0xF9,0x6B,0x12,0x6B,0x52,0x55,0x3A,0x70,0xB7,0x53,0x2C,
+	0x11,0x85,0xE8,0x5F,0xBE,0x05,0xF2,0x56,0x45,0x82,0xBC,
+	0x2E,0x38,0x31,0x79,0xB3,0x9F,0x4F,0x80,0x2F,0xDB,0xE3,
+	0x17,0xAC,0x06,0xAE,0x29,0x1A,0x52,0xFD,0x99,0x0B,0xB8,
+	0x76,0x07,0x59,0x66,0x34,0xA5,0xE9,0x09,0x61,0x48,0xA5,
+	0xBF,0xA7,0x5E,0x7B,0x48,0x88,0xCF,0xE4,0x7B,0x65,0xF9,
+	0x31,0xA4,0xC0,0x78,0xD5,0x9D,0xB9,0x3F,0x76,0x6E,0x56,
+	0xCD,0x49,0x47,0xDA,0xDF,0xB7,0x25,0x3E,0xC8,0xFF,0xA7,
+	0x54,0x60,0xBC,0xFC,0xF8,0x53,0x77,0x67,0xB5,0xA3,0x5B,
+	0x2B,0xF9,0x00,0x04,0x53,0x20,0x27,0x19,0x20,0xD3,0x70,
+	0x4C,0x75,0x62,0x32,0x11,0x3C,0x21,0x08,0x6F,0x33,0x9F,
+	0xE2,0x29,0x29,0x06,0xED,0x0E,0x2B,0x4E,0xE6,0xA0,0x21,
+	0x80,0xA6,0xBF,0xB0,0x53,0x75,0xB7,0x4E,0x47,0x96,0xBB,
+	0x2F,0x0B,0xD3,0xF5,0x16,0x44,0xCB,0x6B,0xCD,0xF3,0xF4,
+	0xD0,0x02,0x6F,0xD0,0x70,0x8C,0xC5,0x7F,0x8C,0x52,0xD2,
+	0x53,0xF7,0x1B,0x00,0x69,0x24,0x43,0x29,0xAD,0x9F,0x2B,
+	0xFD,0x81,0x0E,0xA0,0x35,0x92,0xB3,0xD8,0xAB,0x1E,0xC6,
+	0xFD,0x87,0xBB,0x01,0x53,0xFB,0x7B,0x7A,0x08,0x98,0xA1,
+	0xFC,0x9A,0xE8,0x37,0x02,0xAC,0x5F,0xB9,0x4A,0x3A,0xDB,
+	0x34,0x0B,0x52,0xEB,0x9F,0x6A,0x0F,0x96,0xE5,0x5D,0x96,
+	0xCC,0x84,0x3C,0x48,0xFD,0x87,0xE0,0xF1,0x01,0x1B,0xC1,
+	0x6E,0xA7,0x22,0x1D,0x10,0x0E,0x25,0xBD,0xCD,0x8D,0xEA,
+	0x04,0x7F,0x4B,0xAD,0x30,0x6C,0x66,0xF0,0xE3,0xE6,0xEC,
+	0x60,0x2C,0x81,0xE6,0x0A,0x77,0x12,0x0A,0x2A,0x47,0x88,
+	0x32,0x20,0x42,0x33,0xE3,0xB0,0x92,0x22,0xD0,0xA0,0x23,
+	0x53,0xE8,0xBC,0x7B,0xC4,0xD2,0x28,0xC1,0x72,0xD1,0x54,
+	0xD2,0xDE,0xF6,0xE1,0xFC,0x9D,0x9E,0xC2,0x4D,0x30,0xC0,
+	0x0D,0x77,0x72,0x81,0x33,0x29,0x24,0x03,0x07,0x94,0x51,
+	0xE1,0xD5,0x63,0x4C,0x49,0x82,0xE4,0x37,0xC9,0x4A,0xD8,
+	0x30,0x0A,0xB6,0x2C,0xD5,0x8C,0x7C,0x89,0xB2,0x93,0x9E,
+	0x4E,0xDD,0xDC,0xBC,0x8E,0x00,0x48,0xFC,0xB7,0x6C,0x41,
+	0xF4,0x78,0xA7,0x86,0x5A,0x59,0x49,0x3A,0xF8,0x08,0x5C,
+	0x31,0x54,0x41,0xD6,0x72,0x64,0x2E,0xC4,0x95,0x9E,0x48,
+	0x54,0x9A,0x7B,0xA0,0xE9,0x7E,0x17,0xEC,0x3B,0x5B,0x7A,
+	0x23,0xF2,0x2D,0x16,0x5A,0x91,0x90,0xB3,0xEC,0x05,0x35,
+	0x97,0x58,0x56,0x04,0x30,0xB6,0x70,0x25,0x07,0x8C,0xCC,
+	0xC6,0x5F,0x07,0x6A,0x96,0x7E,0x3E,0xB2,0x40,0x9C,0x6D,
+	0x69,0xC2,0xED,0x93,0xFF,0x6B,0x52,0x9C,0xE5,0xB2,0x4D,
+	0x41,0xBB,0x83,0x95,0xE5,0x20,0x11,0xDE,0x52,0xC9,0xBE,
+	0xD2,0xDB,0x04,0xE7,0x4C,0x77,0x9E,0x4C,0xE3,0xE4,0x21,
+	0x3E,0x73,0x52,0xD2,0x5F,0x58,0xF9,0x86,0x1C,0xA3,0x94,
+	0x1C,0x1A,0x0A,0xC9,0x52,0x7B,0x4A,0x59,0xB1,0xD7,0x00,
+	0x2B,0x49,0x74,0xC9,0x87,0xA6,0x07,0x2E,0x2B,0xC5,0xF0,
+	0x5D,0xBC,0xF8,0x83,0x1A,0xED,0x4B,0x4A,0xE0,0xC7,0xAE,
+	0x93,0x3E,0x83,0x2E,0x5B,0xAD,0x7F,0x8E,0x66,0xDA,0xF5,
+	0x14,0xBC,0x39,0xB4,0x94,0x7E,0x56,0xB4,0x43,0xC6,0x25,
+	0x11,0xFE,0xA6,0x2B,0x09,0xC7,0x8A,0x5F,0x59,0xDC,0xE7,
+	0x57,0x34,0xCE,0xEB,0x48,0x2D,0x8E,0x88,0x11,0x26,0xF2,
+	0x12,0xEA,0xB5,0x11,0x52,0x0B,0x3E,0xA9,0xD3,0xF2,0x15,
+	0xA3,0xB7,0xD6,0x39,0x41,0x4B,0x0F,0xF3,0x07,0x75,0x33,
+	0x36,0x73,0x08,0xB5,0x18,0x60,0xB7,0x6D,0x0E,0x26,0xAF,
+	0xE1,0x16,0x62,0xBC,0x4C,0xC5,0xF8,0xAD,0x9F,0x85,0x70,
+	0x96,0x81,0xD4,0x3A,0xD7,0xEF,0xC2,0x76,0x86,0x53,0xB2,
+	0x53,0x22,0x55,0x6B,0xCE,0xEF,0x81,0x54,0x09,0x5B,0xDE,
+	0x78,0x26,0xD0,0x81,0xA1,0x8A,0x6D,0xE8,0x4E,0x58,0x16,
+	0x35,0xDD,0xF2,0xFD,0xFC,0x3D,0x9A,0x1E,0x92,0xB7,0x6F,
+	0xCE,0x67,0x83,0x50,0xC8,0xD2,0x83,0x1A,0xDA,0xC7,0x02,
+	0x7F,0x6E,0xC6,0x82,0x42,0x80,0x20,0x66,0xEE,0x58,0x6A,
+	0x53,0x1B,0xFB,0x5D,0x05,0xF3,0x7E,0x7E,0x60,0x6E,0x87,
+	0x64,0x93,0x80,0x00,0x5B,0xD2,0x9F,0x90,0x30,0x23,0x79,
+	0xC1,0x6A,0x0E,0x9E,0x2A,0xD4,0x0E,0x06,0x6B,0x3A,0x14,
+	0xDF,0x5D,0xC9,0xC8,0xAC,0xCB,0x59,0x72,0x87,0xD0,0x2D,
+	0x42,0x15,0x2A,0x4D,0x7E,0xDE,0xF9,0xA2,0xE7,0xBB,0x54,
+	0xFC,0x39,0xD2,0x15,0xAF,0x75,0x77,0x33,0xF2,0x28,0xA9,
+	0xD2,0x37,0xBF,0x25,0x9C,0xFC,0x25,0xD2,0xB0,0x2C,0x6E,
+	0x29,0x36,0x45,0xCB,0x78,0xE4,0xE1,0x12,0xF9,0x8B,0x42,
+	0x28,0x55,0xE4,0xF0,0x59,0x54,0x60,0x56,0xA0,0xAF,0x5A,
+	0xA2,0xFB,0x3C,0x1B,0x96,0x89,0x3C,0x4C,0xE6,0xD8,0xAF,
+	0x3B,0xB7,0x74,0x85,0x8C,0xAC,0xFA,0xA6,0x1E,0xB8,0x65,
+	0x78,0x03,0xAD,0x8E,0x3F,0xD5,0xBF,0xB9,0x8F,0x40,0xD5,
+	0x24,0xDC,0x9D,0x14,0xCD,0xDC,0x67,0x36,0x2D,0xA0,0xF1,
+	0x34,0x77,0x41,0xE4,0x9F,0x8D,0xB1,0x5B,0x47,0xCA,0x21,
+	0xDB,0x1E,0x5B,0x80,0x5E,0xCD,0x2F,0x7B,0xA0,0xD2,0xFD,
+	0x34,0xDE,0x99,0xEE,0x34,0xD1,0x9B,0xB8,0x81,0x2E,0x84,
+	0xA2,0x25,0xED,0x01,0xCE,0x31,0xD2,0xD6,0xB6,0x04,0x27,
+	0x17,0x49,0x6B,0xD4,0x24,0x61,0x38,0x67,0xC4,0x81,0x6B,
+	0x36,0x1E,0x5A,0x25,0xA9,0x87,0x95,0xED,0x0E,0x70,0x96,
+	0x66,0xD4,0xDC,0x29,0xD6,0xE1,0xD1,0xED,0x50,0xC9,0x2D,
+	0xF5,0x00,0x38,0xD3,0xC6,0x70,0x42,0xCC,0x34,0xEA,0x04,
+	0x50,0x75,0xE9,0x08,0xDB,0x86,0x6D,0xD8,0x01,0x6F,0xEC,
+	0x0E,0xD8,0x9D,0xBE,0x75,0xA4,0xC8,0x26,0xA9,0x27,0x13,
+	0x9B,0x32,0xFC,0xC5,0x29,0xA8,0xDF,0xB7,0xEC,0xDD,0xB2,
+	0x92,0xCD,0x28,0x2E,0x7F,0x79,0x4A,0x83,0xE4,0xB5,0xBC,
+	0x22,0xF6,0xB9,0x06,0x49,0x5A,0x36,0x27,0x99,0xDD,0x18,
+	0x7C,0xEE,0x1A,0xE1,0x23,0xBF,0x6F,0xF5,0x44,0xB6,0xAF,
+	0x41,0xC6,0x64,0xE2,0xB4,0xE8,0x91,0xBC,0x6F,0xEF,0xDB,
+	0x69,0x00,0x8F,0x39,0x4F,0x19,0x54,0xE0,0x62,0x12,0x03,
+	0x6D,0x0E,0x8B,0xE0,0x8F,0x67,0x32,0x64,0x93,0xBB,0xD5,
+	0x99,0xF5,0xCD,0xA5,0xBE,0xB8,0xB0,0x93,0x06,0xD4,0xF2,
+	0xF7,0xD7,0x35,0x04,0xAA,0x52,0x8D,0x8D,0x73,0xF0,0x59,
+	0x3D,0xAE,0x73,0x76,0x2B,0xC0,0xCB,0x7B,0x5B,0x84,0xE4,
+	0xA4,0x3D,0x73,0xF4,0x14,0xEA,0x50,0x95,0x16,0x76,0x1C,
+	0x70,0x86,0x7C,0xAA,0x71,0x4C,0x34,0x08,0xF9,0x61,0x87,
+	0x1F,0xD5,0x1F,0x40,0x8C,0x65,0x74,0x96,0xB8,0xC9,0xA1,
+	0xBC,0xEE,0x1F,0xBB,0x76,0x19,0x10,0xF3,0xA2,0x62,0x99,
+	0x76,0x91,0x50,0xBA,0xD7,0xD8,0x63,0xDA,0x96,0x43,0x40,
+	0x9C,0xDA,0x31,0xA9,0xE1,0x46,0xC4,0x9D,0xB3,0x97,0xAC,
+	0x88,0xCB,0x88,0xBC,0x29,0x26,0xDB,0xF0,0x94,0xDF,0xF3,
+	0x20,0x48,0xA0,0xE1,0xE9,0x3D,0x9F,0x41,0x21,0x07,0x11,
+	0x94,0x8A,0xA4,0x9C,0x1F,0x25,0xF8,0x02,0x2A,0x9F,0xDC,
+	0x82,0xFB,0xF9,0xF2,0xE0,0x20,0xF3,0x3D,0x84,0xBF,0x45,
+	0xC1,0xB9,0x84,0xD5,0xB8,0x54,0x22,0x2C,0xAB,0x0B,0xF9,
+	0x62,0x4A,0xE0,0x47,0x61,0x2B,0x96,0xD5,0x2A,0x8D,0xDD,
+	0xDF,0xCA,0xBF,0x80,0x9B,0x3C,0x7A,0x58,0x3C,0x03,0x70,
+	0xB9,0xB2,0x94,0xCA,0x63,0xA3,0x3E,0x77,0xF4,0xDC,0x05,
+	0x08,0x31,0x7B,0xB0,0x96,0x5A,0x96,0xE0,0x88,0x19,0x5A,
+	0x76,0x0A,0x40,0xED,0x53,0xDE,0x9B,0x45,0x1B,0x4B,0x37,
+	0xBB,0x42,0x00,0x7C,0x70,0x4D,0x88,0x8C,0x4A,0x34,0xF2,
+	0x6E,0x44,0x75,0x99,0x7F,0x3D,0x13,0x4D,0x56,0x79,0x1A,
+	0xB2,0x0D,0xB9,0xAA,0x98,0xAA,0x99,0x39,0x53,0xAF,0xAC,
+	0xAB,0xC3,0x09,0xE6,0x19,0xCF,0xB5,0xED,0x61,0x26,0xD2,
+	0xE5,0xC6,0xEC,0x81,0xC9,0x0B,0x54,0x08,0x01,0x42,0xD3,
+	0xBE,0xB3,0xD9,0xE3,0x52,0xA6,0x03,0x2A,0x85,0x5F,0x2A,
+	0x7A,0xDB,0x2F,0x9E,0x02,0xEF,0x41,0xCF,0xEB,0x59,0xC0,
+	0x30,0x9D,0x3B,0x7A,0x6E,0x90,0x18,0x7A,0x6A,0x76,0x91,
+	0x08,0x1C,0x2E,0x30,0xEC,0x57,0x95,0x79,0x75,0x8D,0x27,
+	0xC4,0x1B,0xB7,0x80,0x7C,0xBB,0xA7,0x02,0xB2,0xE0,0x43,
+	0x72,0x82,0x71,0x0E,0xAB,0x7F,0x32,0xF2,0x48,0x4E,0x9C,
+	0x95,0xB7,0x85,0x26,0xDC,0x34,0xE1,0x94,0xFD,0x01,0x3B,
+	0xC1,0x97,0x5F,0xCB,0x69,0xD3,0xE0,0x54,0x79,0x91,0x9E,
+	0x12,0x0A,0xEA,0x84,0x84,0x47,0xA2,0x2A,0xAE,0x59,0x6B,
+	0x83,0x94,0xB2,0xE0,0x65,0x56,0x60,0xA5,0xA2,0xF5,0x76,
+	0x61,0xDF,0x01,0x35,0x58,0x01,0x22,0x10,0x8E,0xB2,0xE9,
+	0x92,0xC0,0xD5,0xA6,0x5E,0x61,0xCD,0xF7,0xD1,0xAF,0xFC,
+	0x8E,0x9E,0xBF,0x08,0xD8,0x36,0xFF,0x9A,0x06,0x8F,0x58,
+	0xE6,0x26,0x7D,0xF5,0x6A,0xA4,0x43,0x13,0x66,0x3F,0x47,
+	0x8B,0xBD,0x55,0xBA,0x7B,0x01,0xB5,0xF9,0x81,0x1A,0x4D,
+	0x38,0x8C,0xD5,0x84,0xC2,0xBD,0xE7,0xA8,0x4E,0x46,0x7A,
+	0xAA,0xB8,0xE8,0x54,0xA7,0x4E,0x79,0x0A,0xC4,0xC3,0x00,
+	0xAB,0x52,0x2C,0x82,0x8D,0x7D,0xAA,0x0F,0x20,0x88,0x28,
+	0xA1,0xA7,0x9C,0xB1,0xDD,0x52,0xDE,0x87,0xDC,0xE7,0x6D,
+	0x70,0xDE,0xD7,0x0E,0x03,0x53,0x45,0xDD,0x9B,0x8D,0x7D,
+	0xA2,0x61,0x0A,0xAE,0x6F,0xF6,0x1E,0x13,0x5C,0xDD,0x3E,
+	0xE0,0xD0,0x2F,0xEB,0x00,0x30,0x21,0xE7,0x43,0x31,0xB6,
+	0xE9,0x7E,0x0A,0x72,0xFF,0xB9,0x81,0x25,0xBA,0xBA,0x63,
+	0x44,0x17,0x20,0x29,0x9D,0xD6,0xB9,0x00,0xDF,0x33,0x18,
+	0x47,0x8E,0x11,0x8B,0x80,0x0A,0xB1,0x3A,0x4C,0x96,0x79,
+	0x72,0xD6,0x2A,0xC8,0xFB,0x88,0x87,0xE1,0xA7,0x68,0x56,
+	0xA7,0xCA,0x99,0x44,0x0B,0xDB,0x36,0x20,0x89,0x45,0x02,
+	0x5E,0x97,0xA6,0x74,0x47,0x09,0xF9,0x44,0xBC,0xDC,0x17,
+	0xE2,0x87,0xA3,0xDF,0x3E,0x10,0x8E,0xC6,0x25,0xF2,0xF2,
+	0x4E,0x3F,0x1E,0x00,0xA4,0xD9,0xC4,0x5E,0x99,0x22,0xDC,
+	0x10,0x5B,0x0B,0xC7,0x11,0x96,0x2C,0x16,0x98,0x59,0x37,
+	0x41,0x79,0x3A,0xD5,0x10,0x47,0x36,0xB7,0x4B,0x66,0xBB,
+	0xD7,0xCF,0x14,0x37,0x16,0x8E,0xBA,0x26,0x76,0xA9,0x51,
+	0x31,0xF4,0xE2,0x40,0xE0,0xEF,0x6E,0x59,0xB3,0x82,0x3F,
+	0x79,0x17,0x13,0xF8,0x01,0x37,0x51,0x97,0xD9,0x18,0xB0,
+	0x0D,0xED,0xDC,0x3B,0x00,0x7A,0x7F,0x6C,0xF7,0xEB,0x20,
+	0xE0,0xE4,0xAB,0x49,0xF8,0x0F,0x24,0x13,0x90,0xF8,0xFC,
+	0x49,0xA3,0x0E,0xBF,0xB5,0xAE,0x7D,0xA5,0xE3,0x02,0xE2,
+	0x59,0x35,0xA6,0x8C,0x2C,0x27,0xED,0xE2,0x75,0xD9,0x1E,
+	0xBA,0x2E,0xBD,0xA9,0x19,0xE0,0x3A,0xF2,0x33,0x45,0x3D,
+	0x16,0xE7,0x86,0x7F,0x89,0x42,0xFE,0xCB,0xD7,0x3D,0x28,
+	0x47,0x1E,0x03,0x54,0x8D,0xC3,0xA9,0x76,0x48,0xEB,0xEB,
+	0xC6,0xA5,0x3E,0xBF,0x1F,0x49,0x64,0xD7,0x18,0x2F,0x32,
+	0x1B,0xB4,0xA0,0x42,0x0D,0x30,0x9C,0x06,0x3B,0x41,0x59,
+	0x12,0x68,0xDE,0x63,0xA1,0x44,0xF5,0x26,0x17,0x3E,0x4B,
+	0x8F,0x59,0x4F,0xA6,0x4C,0x92,0x89,0x40,0xC4,0x5B,0x9A,
+	0xB1,0x0E,0x8F,0x93,0x51,0x22,0x53,0x0E,0x7A,0xA7,0x8B,
+	0x5C,0x1D,0xB3,0xAC,0x5C,0x2C,0x58,0x78,0x53,0x25,0xBD,
+	0xB5,0x58,0xE5,0xFE,0xAC,0x4B,0x9A,0x4D,0xB0,0x50,0xBA,
+	0xE0,0x2D,0x7B,0x20,0x35,0xFC,0x44,0xA5,0x50,0xBE,0x57,
+	0x66,0xD5,0x38,0x95,0xF7,0xF9,0xF2,0xE0,0xC2,0x3E,0xB7,
+	0xCE,0x51,0xD1,0xFD,0x18,0x6E,0x4A,0x98,0xD5,0x5F,0x41,
+	0x2F,0x90,0x4F,0x0B,0x80,0xB7,0x8B,0xAD,0xB1,0x08,0xD5,
+	0x68,0xDF,0xB0,0x91,0x5B,0x8F,0x10,0x45,0x70,0x5D,0x7D,
+	0xBF,0x06,0xCC,0xED,0xC8,0x16,0x07,0xC3,0x97,0x91,0x0D,
+	0xBD,0x7E,0x6C,0x2B,0x1E,0x5C,0x45,0xED,0x7E,0x9D,0x98,
+	0x87,0x3F,0x05,0x99,0xB7,0x1F,0x2F,0xCC,0x0B,0x0B,0x6E,
+	0xF5,0xD9,0x3F,0x71,0xAC,0xE9,0x46,0x24,0x28,0xEA,0x42,
+	0xDD,0x4B,0x42,0xA5,0x65,0xDD,0x69,0xDD,0x70,0x5C,0x6D,
+	0x3E,0x5F,0x8E,0x2D,0x9A,0x4F,0x93,0xB2,0x96,0x82,0x33,
+	0xE8,0xFD,0xA1,0x63,0x08,0x39,0xB4,0xE6,0x02,0x48,0x3B,
+	0x5F,0x75,0x79,0x29,0xD1,0x8E,0x7A,0xED,0xDF,0x64,0x1B,
+	0x1C,0x11,0x33,0x6B,0x19,0x6A,0x2B,0x0C,0xF4,0x3B,0x1D,
+	0xEE,0xFA,0xCA,0x07,0x8A,0x86,0x22,0xA8,0xF2,0x0D,0xE4,
+	0x25,0xF9,0x7C,0xDE,0xCE,0x1A,0xED,0xF4,0xF2,0xA9,0xB7,
+	0x1F,0x98,0x25,0xC7,0xE9,0x65,0x8D,0x19,0xC9,0x1B,0x8C,
+	0x71,0xD7,0x83,0x89,0xA4,0xCF,0xD1,0xAE,0xA0,0x6B,0x67,
+	0xA7,0x01,0x30,0xF2,0x0B,0x0A,0xC2,0x41,0xF9,0x70,0xD1,
+	0xEF,0xEB,0x12,0x57,0xF9,0x00,0x13,0xC0,0xC3,0xE2,0x84,
+	0x97,0x4D,0xAE,0xB9,0xF5,0x0C,0xA9,0xDC,0x91,0x83,0x80,
+	0xD0,0x0F,0x0E,0xD7,0xF4,0x3E,0x2B,0xA6,0xEB,0x54,0x94,
+	0x4C,0x76,0x64,0xD9,0x3F,0x05,0x0D,0xEB,0xC5,0x1F,0x58,
+	0x23,0x62,0x45,0xA3,0x14,0x68,0x1F,0x14,0x93,0x1D,0xCF,
+	0xF0,0x03,0x51,0x23,0xF6,0x29,0x2E,0x97,0x6C,0x3D,0x4C,
+	0x84,0xFF,0xD3,0x4D,0x3D,0xDA,0xE0,0x08,0x8D,0x36,0xDD,
+	0x2B,0xD4,0xA1,0x03,0x11,0xEF,0x68,0xC0,0xBC,0xB8,0xFB,
+	0x8A,0xAE,0xD1,0x26,0x42,0xBA,0xC3,0xA4,0x44,0x79,0xE0,
+	0xDA,0x83,0x7C,0xF9,0x9E,0xE8,0xC8,0x8E,0x1D,0x53,0xB0,
+	0xDC,0x4F,0xD6,0xA6,0xE8,0x6E,0xF3,0x0E,0x76,0x01,0x66,
+	0x26,0xA6,0x9D,0xD9,0x02,0x5B,0xC7,0xAC,0xC5,0x6E,0x7F,
+	0xD6,0xEC,0x0F,0x3C,0x10,0xF3,0xAB,0x65,0x5D,0x8A,0x7D,
+	0xB2,0xAB,0x82,0x76,0xBA,0xEE,0xE6,0x27,0xA9,0xAD,0x09,
+	0xEF,0x2F,0x95,0x32,0x18,0x31,0x14,0xF3,0x88,0x93,0xC0,
+	0x25,0x09,0x0E,0x8A,0xE4,0xDE,0x7D,0x17,0xB9,0x71,0xFB,
+	0xED,0xD4,0x9A,0xD4,0xE1,0x11,0xF3,0xD5,0xDC,0xFD,0x0A,
+	0xE0,0x20,0x0B,0x51,0x3D,0xAD,0xE4,0x2A,0x49,0x41,0x01,
+	0x68,0xED,0xB4,0x63,0x4B,0xEE,0xCA,0x64,0x20,0x3E,0x59,
+	0x51,0x21,0x81,0xE1,0xF7,0xA0,0xDF,0xCB,0x31,0xAF,0x8A,
+	0xF5,0xAE,0x88,0x8E,0xF6,0x79,0x50,0x21,0x96,0x5C,0xFB,
+	0xC4,0xD8,0xE2,0x4E,0xC6,0xAA,0xC7,0xAF,0xB7,0xE0,0xE6,
+	0x60,0x81,0x14,0x5C,0x59,0x3A,0x45,0xBE,0xF7,0xD1,0xC7,
+	0xDF,0x81,0x0A,0x72,0x4E,0xF2,0xA6,0x86,0xB5,0x4F,0x60,
+	0xE4,0x94,0xFE,0x8B,0xC7,0x2D,0x41,0x93,0x0C,0x07,0xCA,
+	0x69,0x6D,0x73,0xFD,0xC4,0xAC,0x38,0x48,0xAA,0x79,0x86,
+	0x49,0x95,0x86,0xC8,0x7E,0xE4,0x93,0x07,0xBC,0x22,0x67,
+	0x5D,0xEA,0x9D,0xBB,0xB0,0x5D,0xD4,0xF7,0x13,0xBE,0x85,
+	0x3B,0x0A,0xDA,0x5A,0x08,0xC1,0x60,0x92,0xB5,0x33,0xC2,
+	0x09,0xCE,0x14,0x66,0x93,0x56,0xB9,0x35,0x0A,0xFC,0xE3,
+	0x00,0x84,0xB4,0x13,0x8F,0x31,0x2A,0x38,0x6A,0xA6,0x48,
+	0xD8,0xA2,0x34,0x18,0xF4,0xB0,0x42,0x88,0xA9,0x2E,0x4F,
+	0xD6,0x8E,0xB2,0xB0,0x20,0xBE,0x40,0xB8,0x3B,0xA8,0x92,
+	0x5F,0x25,0xD5,0x3D,0xF2,0xE2,0x82,0xF5,0x01,0x5E,0x12,
+	0xB4,0x39,0x74,0x6B,0xEC,0x06,0x85,0x4A,0xCA,0xF1,0x94,
+	0x74,0xFD,0x01,0x03,0x0D,0x7D,0xE9,0xD4,0xF5,0xAD,0x45,
+	0x98,0xA5,0xFA,0xA8,0x92,0xAE,0x65,0x54,0xA4,0xD6,0xA7,
+	0x5F,0xE4,0xEE,0x36,0xB6,0xD5,0x40,0xB9,0xE9,0xE1,0x66,
+	0xDD,0x77,0x81,0xEE,0xE9,0xA2,0xC9,0xF9,0x6A,0x64,0x92,
+	0x58,0x76,0xB3,0xFB,0x63,0xD4,0x19,0xD8,0xE1,0x5E,0x71,
+	0x17,0xFD,0x09,0x3E,0x68,0xF3,0x19,0x88,0x37,0x04,0xA4,
+	0x30,0x04,0xF2,0x65,0x78,0xD1,0x50,0xF2,0x58,0xC6,0x76,
+	0xF3,0x66,0xEF,0x96,0x94,0xF0,0xBD,0x34,0x20,0xCF,0x7B,
+	0x97,0x48,0x95,0x49,0xD5,0x14,0xDA,0x0C,0x9A,0x1F,0x3A,
+	0x0F,0x00,0x87,0xB9,0xBE,0xA7,0x69,0x4A,0x16,0xEC,0xB3,
+	0xE9,0xB9,0xB0,0x58,0x66,0xE3,0x51,0xB6,0xAD,0x92,0x1B,
+	0x38,0x3C,0xED,0x1D,0xD6,0xC6,0xA4,0x87,0x1A,0x11,0x05,
+	0x42,0x1C,0x2F,0x9D,0x50,0xC0,0xFB,0xB6,0x76,0x33,0xD6,
+	0x4F,0xF9,0x38,0x5B,0xE9,0x71,0xC4,0xDA,0x31,0x40,0x02,
+	0xC3,0x2C,0x55,0xFA,0x19,0xC1,0x87,0x8D,0x48,0x60,0xB0,
+	0xCA,0xFD,0x04,0xB5,0x37,0x2B,0x7A,0x6C,0x61,0x6A,0x23,
+	0x14,0x92,0xF4,0x18,0x6B,0x93,0xBA,0x37,0xBA,0xC9,0xA5,
+	0x8B,0x9E,0x79,0x6D,0xEA,0xB4,0x0D,0x28,0x44,0xE4,0x7A,
+	0xD5,0xD5,0x9D,0xE9,0xC1,0xA7,0x7A,0x0D,0xDE,0x33,0xEB,
+	0x32,0x76,0x03,0xC2,0x4C,0x64,0x5B,0x84,0x11,0x72,0xFE,
+	0xA9,0xFF,0xDA,0x8F,0xC4,0x05,0xC7,0x85,0x43,0xE1,0x3E,
+	0xF0,0x50,0x6B,0x3A,0x03,0x98,0xE2,0xA7,0x9B,0x03,0x63,
+	0x06,0xA1,0x0B,0x90,0x9C,0x6D,0xAE,0x94,0xC7,0x77,0xDF,
+	0x51,0x4D,0x0F,0x95,0xC6,0xCE,0x6B,0xD7,0x80,0xF2,0xF6,
+	0xF3,0x12,0x29,0x22,0xDC,0xC7,0xD9,0x58,0xCF,0xDB,0x32,
+	0x53,0x0F,0x81,0x98,0x6E,0x6F,0x83,0xC7,0xCA,0x47,0xE4,
+	0x91,0x69,0x1A,0x08,0x99,0xAA,0x11,0xA8,0x00,0x8B,0xE3,
+	0x0C,0x5C,0xDE,0xA8,0x03,0x98,0xCA,0x5E,0x0C,0xAE,0xF9,
+	0xFE,0x62,0xD8,0xA1,0xCC,0xB6,0x38,0xE2,0x2B,0x66,0x58,
+	0xF4,0x10,0xBE,0x48,0xB4,0x82,0x65,0x14,0xB8,0x52,0x4B,
+	0x24,0x94,0x9B,0xB6,0x71,0x92,0x1D,0x22,0xDB,0x67,0xBA,
+	0xBE,0x79,0xD3,0x3E,0x95,0x52,0xBD,0x28,0xB0,0xCA,0x88,
+	0x43,0xED,0xCA,0x57,0xC8,0xD9,0xAA,0xC1,0x00,0xD4,0xA9,
+	0x2F,0xD9,0x7A,0x9A,0xA7,0x64,0x1E,0x0E,0x2C,0xC6,0x64,
+	0x4B,0x1C,0x3E,0xB3,0x2E,0xDC,0xAE,0xA2,0x7C,0x57,0x5C,
+	0x78,0xAD,0x45,0x9E,0x36,0x1D,0x8D,0xE1,0xFB,0xAE,0xB9,
+	0x18,0x85,0x91,0x75,0x7D,0x9E,0xD5,0x62,0xEE,0x52,0xF1,
+	0x1D,0x08,0x5A,0x65,0xA5,0x22,0x4D,0x29,0x9B,0x4D,0x23,
+	0x88,0xBF,0xB6,0x92,0x25,0xA2,0xAC,0xBF,0x01,0xAF,0x32,
+	0x50,0x8D,0x41,0x12,0xC6,0x41,0x04,0xE4,0xA1,0x72,0xC8,
+	0x45,0xDF,0x18,0x5C,0xAF,0xC1,0x99,0x95,0xF3,0xFB,0x0D,
+	0x0D,0xFD,0xCC,0xE6,0xDF,0xC8,0xF8,0xEA,0x7D,0x49,0x84,
+	0xE0,0x35,0xA1,0xDD,0xB4,0x9A,0x13,0x58,0x89,0x64,0xB1,
+	0x8A,0xB9,0x15,0xDD,0xDC,0x1E,0x21,0xB2,0xDC,0x09,0x95,
+	0x7B,0x8C,0x69,0x2B,0xFF,0x8A,0x08,0x75,0x9E,0x68,0xBA,
+	0x9A,0xFE,0x7B,0xA2,0x2D,0x18,0x17,0x90,0xA8,0xFD,0x5D,
+	0x39,0x1A,0x05,0x15,0xE1,0x83,0x42,0x09,0x0F,0xBE,0x25,
+	0xAE,0x83,0xDB,0xCE,0xE7,0x22,0x78,0x8F,0x7C,0x99,0x0C,
+	0x1B,0xAC,0xEB,0x1D,0x1C,0xD0,0xEF,0xC2,0xA5,0x96,0xD6,
+	0x01,0x04,0xED,0x97,0xB2,0x38,0x25,0xD1,0xFD,0xEC,0x2E,
+	0x85,0x22,0x9F,0xC7,0x65,0x1F,0xC5,0x03,0x4E,0x89,0xE1,
+	0x11,0x22,0xE4,0x14,0xF5,0x23,0x6D,0x43,0x64,0x92,0x5A,
+	0x71,0xA1,0x5E,0xB0,0xFC,0x96,0x3D,0xC0,0xBC,0x29,0xB5,
+	0xED,0xEA,0xA6,0x42,0x01,0x99,0x92,0x42,0xCF,0xF5,0x0B,
+	0xA9,0xA7,0x39,0xBF,0x20,0xCA,0x49,0x39,0xD2,0x44,0xED,
+	0xA0,0x29,0x9D,0xBA,0x92,0x73,0xEE,0xF3,0xB8,0x91,0xE0,
+	0x9D,0xA2,0x35,0x14,0xA8,0xE4,0x09,0x33,0x5D,0xBC,0xB9,
+	0xFE,0x51,0x4A,0x4D,0x40,0x9A,0xD9,0x62,0x3C,0x0B,0x92,
+	0xF6,0x9F,0x45,0x78,0x5A,0xED,0xE0,0xA3,0xFF,0xED,0x2E,
+	0x9A,0x76,0x7F,0x69,0xC7,0x9F,0xAE,0x76,0xBB,0x13,0x77,
+	0xE8,0x99,0xBA,0x12,0xE2,0xFB,0xDF,0x06,0xD3,0xD6,0x07,
+	0x85,0x73,0x75,0xAF,0x4F,0xF6,0xED,0xF4,0x4D,0x78,0x88,
+	0x09,0x66,0x6F,0xFB,0x5D,0x82,0x55,0x09,0x6D,0xF4,0xD2,
+	0x58,0xFA,0x25,0x70,0x84,0x2D,0xC0,0xFB,0xE8,0xEA,0xCF,
+	0x8B,0xA9,0x47,0x18,0x4C,0xF5,0xB9,0x18,0x48,0xDA,0x31,
+	0x59,0x56,0xC2,0x47,0x7D,0x85,0xD0,0xD0,0x1E,0x8F,0x02,
+	0x72,0xEF,0x12,0xB0,0x1C,0xE1,0xAE,0x16,0xA9,0x36,0x79,
+	0xD1,0x54,0xE1,0x10,0x2B,0xC9,0x70,0x2D,0x67,0xAD,0x13,
+	0x9E,0x4A,0x54,0x4F,0x33,0xEC,0xDF,0x30,0xA7,0xC0,0xC0,
+	0x52,0xAD,0xD1,0xEA,0x84,0xEB,0x9F,0x54,0x98,0xC9,0x10,
+	0xB3,0xF6,0x70,0xF0,0x40,0x55,0xC2,0xF3,0x07,0x32,0xDB,
+	0xAE,0xEB,0x04,0x64,0xE3,0x7A,0x18,0xE5,0x70,0x23,0x51,
+	0x28,0x0F,0x58,0x52,0x36,0x2E,0x49,0xFF,0xC1,0xDA,0x19,
+	0x0A,0xEC,0x8D,0x5A,0xB6,0x32,0xF4,0x80,0xD1,0xFF,0x13,
+	0xD1,0x66,0xE2,0x53,0x76,0xC4,0x1E,0xE9,0xDD,0xCD,0xF1,
+	0x9C,0x9D,0x83,0xF2,0xC5,0x88,0xA1,0xCF,0xD0,0x85,0x6E,
+	0x0C,0xED,0x65,0x2D,0x48,0xDE,0x42,0x03,0x9C,0xE8,0x76,
+	0xB9,0x00,0x35,0x03,0xD7,0xB3,0x22,0xB7,0x7A,0x84,0xD2,
+	0x46,0xB6,0x94,0xCD,0x92,0xAB,0x25,0xAC,0x9A,0xAE,0xEB,
+	0x17,0xC5,0xE7,0x3F,0xF7,0xF0,0x8D,0xC0,0x3A,0x44,0xCC,
+	0xE8,0x7A,0xBC,0xB6,0x2D,0xFC,0xF5,0x12,0x25,0x11,0xFF,
+	0x74,0x45,0x7A,0x7B,0xDA,0x5E,0xE1,0x50,0x7F,0xBB,0xA9,
+	0x11,0x48,0xF5,0x1A,0x92,0x0D,0xE7,0xF8,0x5F,0x45,0x9A,
+	0x1D,0xF3,0xED,0xA7,0x65,0x7F,0xB1,0xC5,0x29,0xB4,0xAB,
+	0x84,0xDE,0x22,0x9B,0xBE,0x78,0xCE,0x1E,0x28,0xB0,0xA0,
+	0xC4,0x1B,0xCA,0x4A,0x7F,0xAF,0xF8,0x3C,0x27,0x40,0x71,
+	0x4D,0xF9,0x43,0x39,0xFC,0x75,0x40,0xF6,0xDF,0x05,0xF3,
+	0x49,0xA6,0x4F,0x6F,0xB4,0xDF,0x64,0x4C,0x61,0xC1,0x37,
+	0x00,0x29,0xF3,0xA0,0xEE,0x5A,0xF3,0xCE,0xC1,0x94,0xA6,
+	0x55,0x85,0x35,0xC9,0x9E,0x27,0x72,0x41,0x02,0x4B,0x9B,
+	0xDA,0xD9,0x5F,0xEB,0x6F,0x83,0x05,0xC0,0x6A,0x1E,0x3E,
+	0x28,0xAD,0x53,0xE1,0xF5,0x1B,0xE0,0x2D,0xAF,0xAB,0x8E,
+	0xB2,0xEC,0xF9,0xE2,0x00,0xD2,0xD6,0x87,0x42,0x69,0x98,
+	0x43,0xAF,0x5D,0x82,0x01,0x95,0x5C,0xA8,0xD8,0xF3,0x9E,
+	0xA3,0xC9,0xCF,0x56,0x6B,0xF6,0x8B,0xEA,0xFC,0x2F,0x11,
+	0xBE,0xDA,0x81,0xEC,0x84,0x52,0xD5,0xA7,0xD8,0xFD,0x70,
+	0x5A,0x41,0x8F,0x60,0x5A,0xCA,0x67,0xBD,0x03,0x9C,0xD3,
+	0x29,0x0F,0x85,0x63,0x59,0x69,0x40,0x80,0xC9,0x1B,0x95,
+	0x6B,0x57,0x37,0x83,0x31,0x39,0xA5,0x5A,0xD8,0x77,0x3B,
+	0x08,0x9C,0x67,0xAF,0x4F,0x53,0xD2,0xDF,0x4B,0x80,0xDE,
+	0x84,0xFF,0xC2,0xFE,0xA6,0x5A,0x68,0x08,0x70,0x74,0x9C,
+	0xA8,0x3D,0x26,0xB5,0x08,0xC1,0xD4,0x5E,0x70,0xEF,0xF0,
+	0x9E,0xB0,0x80,0x30,0x20,0x8D,0x54,0xC5,0x1A,0x74,0x81,
+	0x83,0x87,0x00,0x5C,0x15,0x5A,0x1E,0x8E,0xEB,0xB0,0x39,
+	0x09,0x5C,0x9F,0x82,0xBB,0xF6,0x55,0xC0,0x2C,0x75,0x28,
+	0x0A,0x0D,0x3D,0xBE,0xD6,0x8C,0x4B,0xE3,0x86,0xF0,0x63,
+	0xA0,0x13,0x79,0x53,0x48,0x9D,0x67,0x46,0xA0,0xCD,0x7A,
+	0x42,0xFA,0xC0,0xC9,0x0B,0xCA,0xF6,0xBE,0xB0,0x43,0x6D,
+	0x19,0xA4,0x4F,0xCE,0xC7,0x1B,0x0D,0x00,0xE0,0xB1,0xD5,
+	0x4A,0x40,0xAA,0xCD,0x2D,0xD4,0x4B,0x37,0x9B,0x62,0x89,
+	0x53,0x07,0x70,0x43,0xEB,0x15,0xF7,0xD6,0x18,0x8A,0xF9,
+	0x14,0xE9,0x8F,0xB2,0x43,0xA0,0x5E,0x8F,0x66,0x39,0xAA,
+	0xFF,0x1A,0xE9,0xA4,0xD8,0x19,0xF0,0x33,0xD5,0x54,0xB3,
+	0xA1,0x44,0x01,0x0F,0xA5,0xFF,0xF6,0x7B,0xC9,0x66,0xAC,
+	0x5F,0x96,0xE7,0xED,0xC0,0x64,0x69,0x81,0x30,0x74,0x16,
+	0xE9,0x83,0x7F,0x75,0x39,0xF6,0x68,0x6D,0xB7,0xA1,0x31,
+	0x28,0xD4,0xB8,0xCB,0x3B,0x12,0xC0,0xFA,0xF7,0xAD,0xD2,
+	0x6C,0x06,0x05,0x33,0x8F,0x9E,0x11,0xA8,0x84,0xE4,0x44,
+	0x3A,0x66,0x73,0x34,0x64,0xE3,0x66,0x62,0x69,0xAA,0x9E,
+	0xFC,0x84,0xBB,0x8D,0xBC,0xA8,0x33,0x8C,0x07,0xB4,0x4A,
+	0xC6,0x76,0x5E,0x72,0x75,0xDA,0x59,0x76,0x27,0x12,0x35,
+	0xA5,0x65,0x3B,0xCE,0x35,0x2F,0x77,0xE5,0x85,0x49,0xB8,
+	0xBF,0x52,0xCF,0x83,0x31,0x08,0x6A,0xE1,0x24,0xCC,0x10,
+	0x21,0x58,0x25,0xFD,0xAA,0xA3,0xC4,0xC7,0x4F,0x65,0x8A,
+	0x95,0x30,0x49,0x13,0x82,0x59,0x5E,0xD5,0xF2,0x9A,0xB0,
+	0x5A,0xD1,0xD5,0x6A,0x91,0x6B,0x17,0xC6,0x3C,0x86,0xB7,
+	0xFD,0xD6,0x6C,0x4F,0x1B,0xE7,0x9E,0x16,0xAA,0x0B,0x56,
+	0x52,0x2B,0xD2,0x93,0x1E,0x78,0x06,0x77,0x64,0x70,0xEE,
+	0xD5,0xDA,0x55,0x5E,0x4E,0x87,0xB0,0x17,0xCE,0x3C,0x87,
+	0xB9,0x71,0xA0,0xA3,0xE5,0x6B,0xB5,0x06,0x83,0x2E,0xAE,
+	0x65,0x2F,0xFB,0x0B,0xD2,0xD6,0x06,0x7F,0xA3,0x72,0x55,
+	0x0D,0x7B,0xC4,0xB9,0x52,0x41,0x25,0x73,0x51,0xE8,0xC8,
+	0xF6,0x24,0x64,0x64,0x53,0xE5,0x7D,0x6A,0x8F,0x47,0x96,
+	0xC0,0xF9,0x6C,0x80,0x99,0x38,0x33,0x13,0x63,0x7C,0xA5,
+	0xC0,0x06,0xB3,0xC1,0x3B,0xC2,0xBD,0xA4,0x86,0x24,0xD3,
+	0x4D,0x93,0x9F,0x0C,0xDD,0x9B,0xB8,0x55,0x4C,0xC2,0x31,
+	0xF2,0xCB,0x28,0x99,0xF2,0x8F,0xB0,0x20,0x21,0x2C,0x9C,
+	0x83,0xAE,0x66,0xD0,0x8C,0xBC,0xB8,0x8B,0x11,0x0A,0xC7,
+	0x65,0xD6,0x8E,0xE2,0xA4,0xCC,0x33,0x09,0x35,0xED,0xE3,
+	0x72,0x82,0xB4,0x1A,0xF2,0x95,0x56,0x58,0x36,0xA3,0xF9,
+	0x1D,0xC1,0xD8,0x5C,0x2E,0x54,0x2A,0xEF,0xD6,0x20,0x96,
+	0xF8,0x3A,0x32,0x46,0xE0,0x28,0x8E,0x6D,0x6B,0xF3,0x8A,
+	0xEE,0x1C,0xA7,0x1A,0xD2,0x58,0x2B,0x45,0x87,0x72,0x6A,
+	0x1B,0x80,0xB2,0xD6,0x0A,0x47,0xA3,0x73,0xE6,0x50,0x57,
+	0x3E,0x6D,0xF0,0x9E,0xBA,0x4A,0xEA,0xAF,0x97,0x2B,0x85,
+	0x03,0x4C,0xC1,0x64,0x4D,0xA1,0xF3,0x59,0x19,0x6C,0xC9,
+	0xAC,0x6F,0xC5,0x41,0x92,0x18,0x0E,0x2A,0x67,0x0A,0x95,
+	0x61,0x8C,0xB8,0xC4,0x90,0x10,0x71,0x17,0x3B,0xF4,0x3C,
+	0xE3,0x9E,0xE9,0xB1,0x00,0x84,0x27,0xEE,0x94,0x13,0x34,
+	0xC8,0xFB,0x04,0xBF,0xAF,0xA4,0xBF,0x34,0x17,0xBD,0xA0,
+	0x67,0xEF,0x19,0x9F,0xE1,0x28,0xA9,0xAA,0x13,0x2C,0x14,
+	0x22,0xC3,0x91,0x3C,0xB5,0x04,0x0D,0x0A,0xF3,0xFA,0xF9,
+	0x66,0x66,0x1E,0x2A,0x9F,0x9B,0x33,0x2D,0x68,0x1F,0x02,
+	0xAB,0x5A,0x3F,0x6E,0x75,0x60,0xCF,0xB6,0xCE,0x96,0x8B,
+	0xC0,0x4A,0x70,0xAF,0x8E,0x44,0x5B,0x93,0x4C,0x8F,0x17,
+	0x93,0x18,0x44,0x98,0x4F,0xB8,0x04,0x9E,0x9C,0xCF,0x85,
+	0x6C,0x5F,0xE0,0xE3,0xCF,0x6E,0xDE,0x2E,0xB9,0x53,0xD5,
+	0x22,0x08,0x00,0xF1,0xCE,0x29,0x42,0xB2,0x5A,0xD2,0x4A,
+	0x04,0x7A,0x53,0xC6,0x38,0xEF,0xCF,0x50,0x8D,0x63,0x43,
+	0x3E,0x28,0xBF,0x89,0x98,0x91,0xD5,0xEB,0xF6,0xD0,0x0B,
+	0xFB,0x1A,0xE3,0x7C,0xF8,0x6C,0x92,0xC8,0xC1,0x43,0x41,
+	0x70,0x25,0x18,0x63,0x4A,0x78,0xCE,0xA1,0x68,0x19,0x37,
+	0x0B,0x07,0x85,0x76,0xA3,0x5E,0xDB,0xF7,0x0C,0x6E,0xF9,
+	0xC5,0x86,0xA0,0x4D,0x85,0x34,0xBE,0xF5,0x27,0x25,0x6D,
+	0x00,0x31,0xD2,0xF8,0x60,0xA3,0x04,0x64,0x02,0x0F,0x16,
+	0x6E,0xCE,0x35,0xD0,0xB3,0x9F,0x8F,0xBD,0xED,0x6C,0x56,
+	0x18,0xBE,0x7F,0x13,0x89,0x45,0xAF,0xFC,0x90,0x80,0x91,
+	0x86,0x01,0xA6,0xF5,0xDD,0xEA,0x26,0xD0,0x0A,0xC8,0xEF,
+	0x50,0x61,0x70,0x8F,0x1B,0xA5,0x6F,0x8D,0x90,0x5F,0x21,
+	0xF7,0x75,0x9D,0x2F,0x64,0x18,0x00,0xE9,0x73,0xD7,0xF6,
+	0xBA,0x53,0x86,0x9F,0xB9,0xF2,0x88,0x19,0x7B,0x3F,0xCB,
+	0xEE,0xAE,0x74,0x9E,0x8F,0x79,0xD4,0xAF,0xDD,0x38,0xC3,
+	0xED,0x9D,0x38,0xAD,0x4C,0x6B,0x3D,0x85,0x80,0x30,0xB7,
+	0x05,0x22,0x78,0xAC,0x79,0xD1,0x91,0x00,0xFD,0xBB,0x72,
+	0x14,0xA8,0xC9,0xDE,0x91,0x98,0x3A,0x3B,0xA3,0x10,0x29,
+	0x62,0xE1,0x65,0xEA,0xA8,0x54,0x0A,0x36,0xDF,0x31,0xB6,
+	0xA7,0x2F,0xCE,0x90,0x05,0xB4,0xDB,0x0D,0x64,0xA4,0x21,
+	0x4C,0x92,0xAD,0xB2,0x27,0x45,0x25,0x74,0xB7,0xEC,0xE8,
+	0x71,0x8A,0xB0,0xCF,0x55,0x3E,0xFB,0x9D,0x4E,0x47,0x7B,
+	0xA6,0x96,0x63,0xC6,0x20,0x6E,0x20,0xC8,0xE1,0x34,0xE4,
+	0xED,0x1D,0x3B,0xE2,0x0B,0x55,0xA5,0x4E,0x28,0x5F,0x1C,
+	0xEF,0x75,0x39,0xF7,0x78,0x1C,0x21,0x8E,0x15,0x13,0xC7,
+	0x67,0x81,0x8B,0x6B,0xD4,0x0D,0xF2,0x21,0xF7,0x9C,0x64,
+	0x6B,0x73,0x4E,0x5C,0x0B,0xC2,0x64,0x88,0x81,0xCD,0x1F,
+	0x89,0x93,0xFD,0x55,0x74,0x88,0xEE,0x27,0x24,0x24,0xBF,
+	0x03,0x2B,0x28,0x17,0x79,0xF0,0x4D,0x73,0x4C,0xDF,0xEC,
+	0xC2,0x3F,0x07,0x15,0xA9,0xAC,0xD1,0x20,0xCC,0x0A,0xD5,
+	0xED,0x05,0x75,0xA0,0x5F,0x1C,0x7F,0x38,0xF2,0x65,0x14,
+	0x61,0xF1,0x02,0x20,0xFF,0x20,0x57,0x7C,0x52,0xD3,0x2C,
+	0x57,0x1C,0xCE,0xFE,0x5B,0x75,0xEB,0x2B,0xAB,0x87,0x30,
+	0x08,0x7E,0xED,0xAC,0x6E,0x37,0xFB,0xE6,0x2D,0xBB,0x01,
+	0x99,0xC7,0x31,0x9C,0x4F,0x1E,0x89,0x79,0xD5,0x00,0x38,
+	0xF8,0x12,0x56,0xCA,0x41,0xA7,0x3D,0x34,0x81,0x49,0x41,
+	0xF8,0xEF,0x77,0x05,0x29,0x74,0x1F,0x5A,0x8C,0xBD,0xA5,
+	0x34,0x16,0x09,0xFF,0x26,0x87,0x68,0xBE,0x2C,0x1E,0xE4,
+	0x0D,0x33,0xEA,0x59,0x43,0x64,0x54,0x34,0xB4,0x28,0x70,
+	0x41,0xC9,0xC3,0x1D,0x79,0x74,0x7B,0xE4,0xE0,0x55,0x9C,
+	0xE0,0x3E,0xD7,0xA4,0xB2,0x80,0x7E,0xF3,0x49,0xB0,0x5C,
+	0x0A,0x53,0x3F,0x3A,0x1A,0x57,0x66,0x70,0xF3,0xEB,0x95,
+	0xE6,0x3C,0xFE,0xB9,0x82,0xF5,0x97,0x16,0x07,0x94,0x70,
+	0xF9,0xB1,0x74,0xAB,0x4C,0xC9,0xC8,0x6B,0xC1,0x59,0xE9,
+	0x88,0x37,0x01,0x7C,0x2D,0x3D,0x68,0x9E,0x0F,0x5D,0x16,
+	0xD9,0x52,0x5B,0xF7,0xC5,0x59,0xD1,0x6C,0x70,0x6A,0x24,
+	0x7A,0x61,0x65,0x1B,0x64,0xD8,0x3C,0x05,0x22,0x0F,0x46,
+	0xF0,0x5B,0x52,0x37,0x5B,0x41,0x62,0xF5,0xA0,0x11,0x17,
+	0x84,0x3C,0xDA,0x07,0x10,0x94,0x03,0xE8,0x05,0xE4,0x25,
+	0xBD,0xBB,0x0E,0xC2,0x29,0x06,0x6E,0xE7,0x6D,0x29,0x02,
+	0xEE,0x52,0x1B,0x8B,0x56,0x97,0x53,0x4C,0x9B,0xE8,0x9A,
+	0x0F,0xF8,0x87,0x05,0x33,0x36,0xB1,0x9A,0x1B,0xD4,0x5F,
+	0xD2,0x59,0x53,0xA9,0xFC,0x72,0xFB,0x0F,0x61,0x20,0x82,
+	0x0E,0x9F,0xE7,0xA3,0x9F,0x95,0x09,0x04,0x9F,0x5E,0xC8,
+	0x4D,0x3E,0x61,0x88,0x0A,0xD2,0xEA,0x0D,0x57,0xE9,0x66,
+	0x33,0xB1,0xF0,0xC9,0x5C,0x9F,0x14,0xF7,0xD5,0x67,0xD3,
+	0x03,0x44,0x63,0x07,0x52,0x07,0x1C,0xAA,0x98,0xF4,0xFE,
+	0xE8,0x3F,0x89,0x8C,0x23,0x40,0xF5,0x96,0x4E,0xDA,0x93,
+	0x8D,0xC5,0x48,0xF1,0xF3,0xB1,0xF3,0x91,0x14,0x07,0x7F,
+	0xEB,0xA2,0x09,0xAC,0x3B,0x2E,0x9B,0xA3,0x5C,0x12,0xF3,
+	0x21,0x2E,0x9F,0xD7,0x1D,0x8B,0xBA,0x71,0x45,0xE8,0xF6,
+	0x14,0xB9,0x3E,0xFB,0x85,0x9D,0xBA,0x5D,0x96,0x9A,0x2B,
+	0x0F,0xFD,0xD6,0xBB,0x9D,0xE0,0x04,0x6D,0x37,0xA9,0xDB,
+	0x3F,0xE2,0x50,0x44,0xEF,0x49,0x85,0xEB,0xD3,0xAC,0x2A,
+	0xAB,0xED,0x99,0xE8,0x9D,0x6E,0x8D,0x46,0xD0,0x0F,0x4F,
+	0xC4,0x8C,0xFF,0xFE,0x60,0x55,0xE8,0xEC,0x99,0xA2,0xB9,
+	0x59,0x8F,0xB9,0x46,0x95,0xFD,0xE4,0x9F,0xB1,0x1B,0xF4,
+	0x91,0xCD,0x0D,0xC6,0xE6,0x34,0x6A,0x9F,0x69,0xDC,0xE4,
+	0x7C,0x81,0xBC,0xDE,0x42,0xFF,0xEE,0xF2,0x05,0xE5,0x30,
+	0x2B,0x28,0x34,0x51,0x9B,0x51,0x0D,0xC9,0x18,0x92,0x6B,
+	0x47,0xF4,0x4A,0x26,0xF7,0xD6,0xFC,0xEB,0x48,0x25,0x40,
+	0x06,0xA5,0x7B,0xC5,0xF5,0xC9,0x9C,0xC3,0x92,0xD1,0x6B,
+	0x08,0x9E,0x96,0x78,0xF5,0xBF,0xCC,0x20,0xE4,0x5B,0x34,
+	0x20,0x5F,0xA7,0x1B,0x67,0x7D,0x7F,0xEF,0xF6,0x5E,0x70,
+	0x27,0x16,0xB1,0xB9,0x47,0x7A,0x4E,0xA6,0x80,0xF2,0x45,
+	0x09,0x4D,0x44,0x49,0x1B,0x8B,0x9F,0x84,0x48,0xD7,0x38,
+	0x23,0x67,0x5C,0xAC,0x9D,0xAF,0xA8,0xBF,0x89,0xD3,0x55,
+	0x34,0xCC,0x90,0x3C,0x97,0xC5,0x6F,0x89,0x4E,0xDA,0x0B,
+	0x00,0x0D,0x3A,0x7D,0xCB,0xB2,0x76,0xB1,0x4B,0xAA,0x6F,
+	0xBE,0xCC,0x0A,0xA1,0x58,0x9B,0xD9,0xE2,0xFA,0x9A,0x72,
+	0xD0,0xE6,0x48,0x16,0x1C,0x17,0xCB,0x70,0x89,0x1A,0x24,
+	0x21,0xB8,0xA1,0xB7,0xDB,0x51,0xA2,0x76,0x59,0x7B,0x00,
+	0x86,0x74,0xC7,0xC8,0x43,0x77,0xB3,0xB3,0xF7,0x08,0xB8,
+	0xBC,0x8A,0x65,0xD6,0x81,0xB5,0xFD,0x65,0x8B,0x2C,0x66,
+	0x23,0xDA,0xEE,0xF1,0x70,0x58,0x18,0xB4,0x2A,0xE7,0xF5,
+	0x51,0xDC,0xFA,0xDB,0x39,0xBE,0x03,0xE2,0xF9,0xE3,0xC4,
+	0x15,0xF7,0x14,0x60,0x9E,0x7A,0x91,0x11,0x51,0x92,0x20,
+	0xD2,0xF0,0xDA,0x64,0x1C,0x61,0xCC,0x7A,0x15,0x2B,0x57,
+	0x3E,0x2D,0x54,0xC3,0xB5,0x4A,0xEA,0x5E,0xF3,0x2B,0x90,
+	0xDA,0x36,0xF9,0x08,0xCC,0x66,0xDA,0x1E,0x63,0x40,0xF4,
+	0x22,0xA8,0x5F,0xF4,0x4A,0xF6,0x38,0x96,0x5B,0xA3,0x01,
+	0x7E,0x6D,0x19,0x20,0x78,0xC2,0x8C,0x1E,0x31,0x2E,0x3D,
+	0x4B,0x3C,0x4C,0x3C,0x2E,0xA5,0x57,0xD4,0xF9,0x92,0x5D,
+	0x6F,0xB4,0xAF,0x5F,0x01,0x61,0x44,0x0F,0x8D,0xE8,0xBE,
+	0x81,0x2D,0x93,0xC0,0xF6,0x09,0x75,0x93,0x31,0xD4,0x4B,
+	0x17,0x07,0x6C,0x40,0x71,0xAE,0x3C,0x0F,0xC4,0x9D,0xE9,
+	0x14,0x24,0xEB,0x21,0x65,0x38,0xCE,0x87,0xA4,0x12,0x77,
+	0x75,0x97,0xBD,0xF3,0x79,0x2B,0x6F,0x3B,0xA7,0xC0,0x23,
+	0x70,0xBB,0x2C,0x72,0x2B,0x8A,0xCE,0x08,0x1B,0x88,0x73,
+	0x59,0x0A,0x11,0xB8,0x10,0xBF,0x63,0x84,0xCC,0xCF,0x8D,
+	0xEB,0x7B,0xBD,0xA5,0xB6,0x3D,0xB8,0x15,0xB5,0x31,0xB8,
+	0x69,0xFA,0x38,0x81,0xFA,0xBE,0x39,0x42,0xDA,0x51,0x65,
+	0xD9,0xD8,0x32,0x98,0xA1,0x33,0x10,0x27,0xB0,0x29,0xB3,
+	0xA1,0x27,0x3A,0x10,0x67,0xCA,0xD1,0x4B,0x8D,0x8F,0xBB,
+	0x21,0xFF,0xA9,0x39,0x0E,0x51,0x2B,0x3A,0x9A,0xE1,0x3B,
+	0x4C,0xF9,0x17,0x4B,0x01,0xF9,0x8E,0x5A,0xEA,0xBF,0x95,
+	0xBE,0xF2,0x32,0x90,0xB0,0x0C,0xC6,0xA1,0xAB,0xA6,0xC8,
+	0xEE,0xE8,0x1B,0xC9,0xA6,0xEE,0x57,0x5A,0x0E,0x07,0x8D,
+	0xF4,0x9A,0x7B,0x10,0x9A,0x8D,0xA5,0x15,0x3C,0x44,0x98,
+	0xA5,0x72,0x24,0x95,0xF5,0xB3,0xDF,0x5B,0x4D,0x80,0x5E,
+	0xCE,0xCB,0xD2,0x0C,0xB3,0x1A,0x17,0x9B,0x22,0xC6,0x8D,
+	0x67,0x33,0xF6,0xA4,0x03,0x79,0x48,0xFC,0x77,0x15,0x55,
+	0x3F,0x7B,0xBD,0xED,0x7D,0x79,0x2D,0x24,0x67,0x6D,0x5F,
+	0x0A,0xED,0x65,0xBF,0x5F,0xBE,0xB5,0x61,0x2A,0xDC,0xBB,
+	0xE7,0x36,0xB4,0x8F,0x2B,0x8B,0xB5,0x05,0xA7,0x4A,0x74,
+	0x4D,0xDA,0xCE,0xD7,0xEE,0x33,0xC0,0xEF,0x40,0x47,0x65,
+	0x23,0x50,0x91,0x9E,0xD9,0x61,0x57,0xD0,0x6B,0x56,0x74,
+	0x72,0x0F,0x69,0x0C,0x6E,0xB3,0xCC,0x06,0xF9,0xCA,0xA9,
+	0x95,0x1C,0xF3,0x1F,0x3D,0x5D,0x18,0xB0,0x6E,0xBA,0xEF,
+	0x3E,0x6E,0xCE,0x90,0x57,0x4C,0xCA,0x07,0x02,0x72,0xD3,
+	0xC5,0x9A,0x44,0x95,0x2F,0xAF,0x46,0x52,0x8C,0x96,0x63,
+	0xF1,0xBE,0x99,0x51,0xA2,0xE6,0x62,0x8F,0x5F,0xAC,0x0B,
+	0x9A,0x43,0xFC,0xB7,0x25,0x2C,0xB4,0xEE,0xEF,0x53,0x97,
+	0x6F,0xEE,0xE7,0x49,0xE5,0xC3,0xBA,0x21,0x0D,0xD7,0x9A,
+	0xC4,0x1F,0x7A,0x93,0xFB,0x2A,0x5B,0xA1,0x14,0x6B,0x8B,
+	0x49,0x97,0x12,0x83,0xE6,0x9D,0x22,0x75,0xFF,0xE1,0x9D,
+	0x8F,0xEA,0xD5,0xCC,0xC0,0x37,0x21,0xD5,0x39,0xD2,0x3C,
+	0xC0,0x45,0x50,0x05,0x3F,0x03,0xEA,0x07,0x8E,0x4B,0x12,
+	0x70,0xC5,0xAD,0x5C,0x00,0x5C,0x3B,0x24,0x83,0x5B,0xCB,
+	0x3D,0x79,0x0F,0xA3,0xCB,0x68,0xD4,0x4E,0x97,0xB6,0xF4,
+	0x50,0xE1,0xF4,0xA2,0x81,0x17,0xAE,0x2A,0x5A,0xC1,0xA8,
+	0xB2,0x3F,0x57,0x2D,0x3D,0x8F,0xE3,0x22,0x73,0xB5,0xB0,
+	0x91,0x69,0x82,0x2C,0x2F,0x32,0x9A,0x48,0x1B,0xF4,0x04,
+	0xE0,0x37,0x10,0xC1,0x8E,0xB7,0x2F,0x42,0xCE,0x05,0x70,
+	0x5F,0xAC,0x7A,0x58,0xD5,0x9C,0x68,0xE4,0xF2,0x30,0x45,
+	0xC0,0xF3,0x2B,0xC0,0x0E,0xC0,0x3B,0x90,0x02,0x21,0xBA,
+	0x35,0x36,0x5C,0x86,0x18,0x49,0x56,0x73,0x48,0xFB,0x9B,
+	0x4B,0x10,0x13,0xD3,0x83,0x5A,0x18,0x9B,0xB5,0x71,0x5D,
+	0x31,0x5E,0xD6,0x37,0x29,0x29,0x24,0x63,0x9D,0x36,0x20,
+	0x52,0xEE,0x23,0x83,0xE7,0x43,0x04,0x10,0x96,0xC0,0x7A,
+	0x70,0x24,0x47,0x61,0x2A,0x83,0x0F,0x8C,0x43,0x69,0x26,
+	0x4F,0x9B,0x93,0x52,0xE9,0x5D,0x9A,0x13,0x23,0x44,0x02,
+	0x35,0xAB,0x63,0xA9,0xE5,0x7B,0x83,0x60,0x4C,0x32,0xE6,
+	0x91,0x4F,0xB4,0x05,0xE6,0xCA,0x67,0xC9,0x17,0x53,0x5A,
+	0x97,0x7C,0xD9,0x9D,0x01,0xB3,0xBD,0x85,0x50,0xB5,0x6F,
+	0xC6,0xA9,0xD9,0xB5,0xEC,0x0A,0xE0,0xE5,0xA3,0x57,0x2D,
+	0x4B,0x1E,0x30,0x53,0x3C,0xBA,0x4F,0x6A,0x03,0x28,0xE0,
+	0xAA,0xEF,0x24,0x06,0xD0,0x75,0xD8,0xEC,0xD2,0xEE,0x3E,
+	0x7C,0x4D,0xC0,0x88,0xF6,0xD8,0x5C,0xFA,0xC7,0xA0,0xC5,
+	0xE3,0xE6,0x7D,0xFA,0x0F,0xEF,0xFB,0xD7,0x6A,0x8B,0x23,
+	0x68,0x60,0x67,0x5A,0xE3,0x77,0x4E,0xFB,0xB2,0xFC,0x1A,
+	0xFE,0x3F,0xD4,0x04,0xD5,0xD5,0xCC,0x33,0x57,0xB4,0x89,
+	0xED,0x99,0x92,0xA6,0x3B,0x72,0x70,0x70,0x20,0x18,0x32,
+	0x82,0xEB,0x80,0xE0,0x03,0x7F,0x67,0x9D,0xF8,0x92,0x75,
+	0x86,0xBF,0xE0,0x04,0x65,0x3E,0xB9,0xCD,0xC1,0x89,0x35,
+	0x3E,0x0F,0x1A,0x85,0xF5,0x12,0x4C,0xF3,0x8F,0x05,0xC7,
+	0x3E,0x2F,0x77,0x97,0xEB,0x89,0xF6,0xD9,0x11,0x4A,0xD4,
+	0x52,0xC2,0x00,0xAC,0x6F,0xC2,0xF0,0xBF,0xE2,0x44,0x23,
+	0xD7,0xA3,0x04,0xA5,0xA7,0x84,0xA9,0xF9,0x63,0x80,0xD2,
+	0xCB,0x77,0x24,0x13,0x76,0x01,0x91,0x6D,0x73,0x3B,0xC8,
+	0xC8,0x7B,0x13,0xD0,0x4F,0xDF,0x62,0x64,0xA1,0x45,0xCB,
+	0x12,0x23,0xCB,0x66,0xE9,0x5D,0x97,0x4E,0x12,0x0C,0x2D,
+	0x0B,0x5F,0x08,0x9D,0xA8,0x7D,0x21,0x8C,0x5F,0x96,0xA2,
+	0x9E,0x51,0x5E,0xC7,0x79,0x7A,0x30,0x83,0x9B,0x9F,0xCF,
+	0x68,0xCD,0x56,0xED,0xA7,0x72,0xD3,0x29,0x10,0xD7,0x0B,
+	0xC4,0x13,0x99,0xA4,0x0F,0xBC,0xB0,0x1A,0x1F,0x99,0xB8,
+	0x57,0x37,0x23,0x41,0xFD,0x51,0xD7,0x73,0x43,0xFE,0xC7,
+	0x64,0x8A,0xCA,0xCA,0x98,0xF0,0xBD,0xE1,0xA4,0x47,0xC7,
+	0xE4,0x9A,0x1D,0x95,0xAF,0xFD,0x15,0x3A,0x9A,0x04,0x67,
+	0xE9,0xC5,0x47,0xD3,0xC5,0x55,0x2C,0x69,0x55,0xC9,0x1C,
+	0xE0,0xE4,0x8B,0x1D,0xE7,0x78,0xF8,0x7E,0xBE,0x86,0x79,
+	0xB6,0xE1,0x1A,0xB8,0x0B,0x08,0xDE,0x92,0xAC,0x58,0x55,
+	0xB9,0xF7,0x75,0xD9,0xCF,0x3B,0xC7,0x4F,0xD3,0xDB,0x2D,
+	0x9C,0xBE,0x7A,0xE7,0x1F,0x4F,0x10,0x4B,0xE6,0xE1,0xD5,
+	0x29,0x58,0x98,0xCC,0xFF,0xE0,0x35,0x99,0xE2,0x69,0x89,
+	0xED,0xFD,0x3B,0xCE,0xDE,0xB2,0xCB,0x07,0x70,0x47,0x5F,
+	0x4A,0xDB,0x72,0x07,0x47,0x55,0x11,0x50,0xDF,0x42,0x9A,
+	0x6F,0x9E,0xBA,0x76,0x41,0x62,0x4D,0xE5,0x18,0xD5,0x39,
+	0xEB,0x1B,0x7C,0x3E,0x23,0x73,0xB8,0xF0,0xC4,0x13,0xE1,
+	0xBC,0x3B,0x29,0x60,0x9C,0xBB,0xC1,0x88,0x01,0x49,0x10,
+	0x75,0xD5,0xB8,0x18,0x66,0x04,0xA3,0x2F,0xAE,0xC5,0xAA,
+	0x04,0x88,0xDA,0x40,0xE7,0x15,0x32,0xA1,0x8E,0x4E,0xBE,
+	0xB2,0x76,0xF6,0x9F,0x47,0x85,0x9A,0xD4,0x96,0xD2,0x43,
+	0xA0,0x7F,0x2A,0xF9,0xE0,0xD7,0xF1,0xAF,0xA5,0x79,0x54,
+	0x92,0xB7,0x3B,0xE2,0x06,0xA6,0x25,0x26,0x4B,0x03,0xF2,
+	0xF7,0xFC,0xF3,0x8C,0x5C,0xCF,0x8A,0xEE,0xEA,0x5E,0xCE,
+	0x94,0xD2,0x27,0x89,0xDC,0x2A,0x95,0x92,0x00,0xEE,0xEE,
+	0x35,0x02,0xC4,0xE5,0x19,0xAB,0x10,0xAC,0xAF,0xA9,0x8C,
+	0x5A,0x81,0xE0,0x96,0x97,0x09,0xC7,0x4C,0xFD,0x7E,0xD5,
+	0x01,0x5D,0xE0,0x69,0x29,0xC5,0xBA,0xA1,0xED,0x5D,0x60,
+	0x65,0x5D,0xE7,0x20,0x2B,0x78,0xC3,0xB9,0x4E,0x92,0xB9,
+	0x68,0xBB,0x09,0x24,0xF9,0xFB,0xBB,0xA1,0xA0,0xF8,0xCC,
+	0x0B,0xC5,0x79,0x9B,0x73,0xE8,0xCC,0xD4,0xA8,0x1B,0x9B,
+	0xE0,0xDE,0x9C,0xB1,0x49,0x4D,0xFC,0xF8,0x13,0x38,0xA8,
+	0x02,0x06,0xD2,0x98,0xEC,0x4B,0x2E,0xF2,0x53,0xD8,0x68,
+	0x98,0x9E,0x50,0x05,0x75,0xC0,0x72,0x9E,0x34,0x76,0x2B,
+	0xD4,0x09,0xEC,0x5C,0x27,0x81,0x7D,0x4D,0xC5,0x4B,0x23,
+	0x80,0x53,0x7D,0x98,0x1B,0x73,0x92,0x1D,0xA3,0x0F,0x7A,
+	0xDD,0xEA,0xE2,0x4A,0x0E,0x09,0xF7,0x7D,0x99,0x5A,0xA3,
+	0x18,0x73,0x22,0x27,0xE9,0xFE,0xF4,0xDB,0x4D,0x84,0x12,
+	0x18,0xCE,0x2B,0x12,0x99,0xE3,0xE7,0xB4,0x14,0x7A,0xD5,
+	0x90,0xE6,0xA7,0x47,0xFB,0x7D,0x06,0x1B,0x2B,0x68,0xA7,
+	0x11,0x41,0x65,0x1A,0x2E,0xB3,0x2F,0x36,0xB8,0xF0,0xAF,
+	0x6A,0x5F,0x94,0x27,0xB6,0x38,0x22,0x17,0x8D,0xA2,0xE5,
+	0x52,0x16,0xAA,0x01,0xBE,0x6F,0x2F,0x1D,0x0A,0xC4,0x66,
+	0x82,0xDF,0xDF,0x47,0x5A,0x43,0xF4,0x7F,0x37,0xE3,0x0F,
+	0xBD,0xE9,0x7A,0xB6,0x46,0xB4,0x4C,0x9C,0xA4,0x0A,0x45,
+	0x26,0xCE,0x97,0x98,0xD7,0xCE,0x7E,0x4B,0xF8,0xBA,0x2C,
+	0x59,0xCE,0xF0,0x13,0x3F,0xA6,0xF8,0x6B,0xA4,0xE0,0x55,
+	0xB4,0x4D,0x01,0xCA,0x9C,0x03,0xAC,0x55,0xBD,0x15,0x02,
+	0x72,0xB1,0x3B,0x76,0x0E,0xAE,0xF2,0xC1,0x68,0x1C,0xD8,
+	0x90,0x28,0xDF,0x00,0x8C,0xFD,0xDD,0xEE,0x3D,0x4C,0x1E,
+	0x77,0x7D,0x74,0x04,0xB6,0x0C,0xC4,0x90,0xA3,0x1F,0x11,
+	0xF9,0x1B,0x8F,0x6E,0x56,0x15,0x82,0xF3,0x81,0x41,0x92,
+	0xBB,0x2D,0xDB,0x5D,0x76,0x48,0xA4,0xDA,0x4D,0x67,0x2B,
+	0x99,0xB6,0x33,0xA5,0x3F,0x91,0xE9,0xC6,0xC4,0x3A,0xEA,
+	0x23,0x6E,0x96,0x06,0x02,0xF3,0x5D,0xA1,0xFB,0xB9,0x3D,
+	0xA4,0xDC,0x10,0xFC,0xFC,0xB3,0x68,0xC1,0x99,0x1E,0xBF,
+	0x0E,0x01,0x53,0xE6,0x2D,0x0F,0x26,0xC1,0xE1,0xA4,0xDD,
+	0xC3,0x35,0x02,0x21,0x6B,0x2A,0xFD,0x99,0xB0,0xEC,0xDF,
+	0x9C,0x7D,0x22,0xC6,0x5C,0x8E,0x0C,0x3E,0xE5,0x2B,0xE6,
+	0xE1,0x57,0x7B,0xF2,0xC7,0x7E,0xDB,0x9A,0xBF,0x37,0x06,
+	0xF3,0x82,0xAF,0x52,0x7F,0x0D,0xC3,0xF6,0x64,0x34,0xCA,
+	0x3E,0x5F,0xA8,0xC8,0x45,0x16,0x09,0x52,0x96,0x6D,0x04,
+	0x7B,0x19,0x1F,0x31,0x99,0x53,0x00,0x73,0xB7,0xDC,0x5C,
+	0xC3,0x81,0xB8,0xE9,0x97,0x72,0x58,0x16,0x1B,0x3B,0x69,
+	0xDF,0x2C,0xD7,0xCD,0xDA,0x27,0xA8,0xE8,0xDF,0x0A,0x65,
+	0xB5,0xE6,0x07,0xD6,0xBC,0x51,0xC7,0xCB,0x34,0xF1,0x01,
+	0x4F,0x5C,0x04,0x9B,0xC2,0x54,0x29,0xD3,0xCF,0xB6,0x5E,
+	0x26,0x5C,0x67,0x0A,0x6B,0x81,0x0E,0x05,0x03,0x31,0x91,
+	0x4A,0xF2,0xD6,0x2B,0x4C,0x3F,0x1B,0x89,0x53,0x0B,0x20,
+	0x07,0x54,0xC0,0x61,0x0B,0x40,0xEA,0xF7,0xA6,0xD1,0x84,
+	0x27,0x32,0xBF,0xC6,0x5F,0x0D,0x57,0x51,0x55,0x94,0xE9,
+	0x27,0x96,0xBE,0x0B,0x43,0xE2,0x5F,0x91,0x25,0x9D,0xE6,
+	0x78,0xAF,0xD3,0xBF,0x98,0xA3,0x9F,0xF6,0xFC,0x57,0x71,
+	0x04,0xFA,0x3A,0x91,0xBE,0x1E,0x23,0xDE,0xBB,0x0E,0xF0,
+	0x91,0x64,0x2B,0xBF,0xDA,0xDD,0xD1,0xDF,0x59,0x8F,0x95,
+	0xB4,0xD6,0xDC,0x61,0xEC,0x2D,0x57,0x3E,0x94,0xE4,0x2B,
+	0x9A,0x44,0x86,0x71,0x0E,0x8A,0xF6,0x8E,0xD2,0xDA,0xCD,
+	0xE9,0x43,0xB3,0xF0,0x2A,0x8D,0xDC,0x2A,0xE9,0x27,0xFA,
+	0x80,0x8C,0x05,0xE5,0x8F,0xD1,0xEB,0x30,0xEF,0xC9,0xE8,
+	0xCF,0xA4,0x68,0x71,0xD0,0x8E,0x26,0x45,0xDE,0x4B,0xF2,
+	0x38,0xD4,0xDB,0xF4,0xC8,0xD9,0x09,0xC2,0x39,0xEE,0xDF,
+	0x09,0x9A,0x25,0xD5,0xCC,0xB9,0x48,0x1F,0x69,0x72,0x10,
+	0xD4,0xA3,0x16,0x0E,0xF3,0x1B,0x6A,0x2D,0xF8,0x8C,0x5F,
+	0xDF,0xE4,0xB5,0x82,0xF0,0x94,0x7E,0x73,0xF1,0xA2,0x15,
+	0xDE,0x5A,0x1D,0x94,0x2B,0x90,0xF3,0x5A,0xDD,0xE2,0x25,
+	0x6F,0xF6,0xD6,0x78,0x5E,0xC8,0xB5,0x2E,0x80,0xA0,0x7B,
+	0x9D,0xDF,0x7B,0x86,0x6E,0x1C,0x02,0x22,0x72,0x10,0x1A,
+	0xCE,0x82,0x71,0x5E,0xE8,0xB9,0xB4,0xED,0xA0,0xE5,0x28,
+	0x77,0x44,0x61,0xD2,0xF2,0xC6,0xEB,0x29,0xE9,0x0D,0x4D,
+	0x1C,0xA4,0xFF,0x6A,0x54,0xE5,0x3A,0xEB,0x3E,0xAC,0x82,
+	0x7E,0x88,0xE2,0x0B,0x6A,0x74,0xE8,0x67,0xB6,0xC6,0xF7,
+	0xA7,0xE6,0xDD,0x09,0x82,0xF2,0x30,0x9E,0x77,0xC1,0x37,
+	0x49,0xDF,0xD7,0x63,0x51,0x76,0xDF,0xCE,0x4E,0xD5,0x5A,
+	0x8F,0x36,0xA7,0x9D,0x4F,0xDD,0x7A,0x5A,0x2A,0x01,0xCC,
+	0x5E,0xC5,0x56,0xA3,0x5B,0xF4,0x5A,0x0D,0xE1,0xA6,0xB6,
+	0xB0,0x87,0x91,0x02,0xDC,0xA3,0x2C,0x38,0xFA,0x94,0x3C,
+	0x52,0x1A,0x60,0xD2,0x8C,0x14,0x5C,0x42,0x3E,0xC2,0x96,
+	0xDD,0x69,0x6B,0x39,0x70,0x4F,0xF9,0x52,0x19,0x6A,0x0F,
+	0x2B,0x43,0x1F,0x82,0x24,0x7F,0xD6,0xFA,0x78,0x02,0x56,
+	0xEE,0xA7,0x2C,0x59,0xB6,0x4E,0x96,0xBD,0x54,0x02,0xD5,
+	0x47,0x26,0xAF,0x47,0xE3,0xC5,0x1E,0xF3,0xF1,0x6D,0xC2,
+	0x08,0xB3,0xCF,0x9C,0xE1,0xEB,0x13,0x65,0xC2,0xB0,0x20,
+	0x64,0x91,0x00,0xDC,0x3B,0x06,0xDD,0x82,0x95,0xA0,0xAF,
+	0x63,0x3A,0x3B,0xC7,0x0F,0x92,0xA1,0x8F,0x0C,0xEE,0x62,
+	0x34,0x16,0x97,0x50,0x32,0x71,0x25,0xFC,0x4E,0x71,0xEC,
+	0x52,0x57,0x38,0xFD,0x62,0xBF,0x88,0x3A,0xF0,0x4B,0xA4,
+	0x43,0xDC,0x32,0x20,0xD6,0xEA,0x32,0x83,0x8B,0x3D,0x38,
+	0x5E,0x5D,0x28,0x9D,0xFC,0xD0,0x10,0x0C,0xC0,0x05,0x97,
+	0xBA,0x11,0xF9,0xA6,0x2B,0x21,0x1A,0x9B,0xDD,0xA2,0xBC,
+	0x7A,0x3A,0xB5,0x75,0x36,0xD9,0x8E,0xDC,0x5A,0x5D,0xFA,
+	0x40,0xFA,0xC2,0x5D,0xF0,0x85,0x56,0x64,0xF6,0xA9,0x2C,
+	0x35,0x21,0x40,0x47,0x75,0x81,0x74,0xDF,0xD5,0x33,0xB6,
+	0x95,0x7D,0x65,0xF4,0xD2,0x27,0xCF,0xD5,0x70,0x96,0x7B,
+	0x21,0x20,0xF6,0xA2,0x73,0x80,0x55,0xB9,0x45,0x81,0xC3,
+	0xB5,0x4E,0x11,0x52,0x91,0x56,0x6C,0x89,0x34,0xE9,0x58,
+	0x55,0x07,0x36,0x4F,0x1A,0xD0,0xFA,0x25,0xEC,0xC1,0x3E,
+	0x44,0x5E,0xAC,0xF6,0x41,0xA8,0x27,0xFA,0x0D,0x44,0x7B,
+	0x0D,0x87,0x7E,0xAF,0x04,0x48,0x99,0xF1,0xD1,0xD4,0xF7,
+	0x04,0x7F,0x30,0xA9,0xCC,0x2B,0x6A,0xCA,0x22,0x1C,0x3F,
+	0xC3,0x7F,0x05,0x08,0x18,0x35,0x91,0x9A,0x8C,0x16,0x34,
+	0x5E,0x6C,0xEF,0xE8,0x7D,0x18,0xAE,0x6D,0x04,0xEE,0x51,
+	0xD3,0x22,0x39,0xA0,0x8C,0xD8,0x2E,0x8F,0x90,0xDA,0xDD,
+	0x12,0x63,0xF5,0xBD,0xE7,0x91,0xD6,0x93,0x8F,0x13,0x4C,
+	0x98,0x29,0xFB,0xA3,0xBD,0xC2,0xDF,0xBE,0xBD,0x2B,0x2E,
+	0x2F,0x7A,0xBD,0xC6,0x8F,0xFA,0xD6,0x14,0xA3,0x41,0x7C,
+	0x52,0x4D,0xC9,0xF9,0x58,0x2E,0x78,0xF0,0x70,0x02,0x0F,
+	0x6E,0x15,0x62,0xDE,0x38,0x6D,0xA1,0xB7,0x3F,0x93,0xB0,
+	0x54,0x13,0xAC,0x6E,0x92,0x3A,0xA9,0x67,0x1E,0xE2,0x6E,
+	0x54,0x11,0x14,0xC8,0xB6,0x79,0x28,0x2F,0x73,0xF7,0x70,
+	0x31,0x24,0xE1,0x20,0xE4,0xB1,0xB3,0x65,0x23,0x61,0x76,
+	0xF4,0x32,0xB8,0x0F,0x12,0xD5,0xAB,0x0D,0x53,0xB8,0x04,
+	0xE1,0x1C,0xAF,0x25,0xDF,0xD6,0x8C,0x9B,0x63,0x16,0x9B,
+	0xFC,0x4D,0xF8,0x54,0x9A,0xC1,0xCC,0x27,0x09,0x50,0x12,
+	0x6F,0xE9,0x69,0x36,0x1A,0x46,0xFD,0x4A,0x0C,0x7F,0x15,
+	0x5C,0xA6,0x1F,0x55,0xAC,0xD3,0xA6,0x99,0x12,0x23,0xEF,
+	0xFA,0xE9,0xE8,0x74,0xA5,0x1D,0xF2,0x4A,0x60,0x33,0x7F,
+	0xBD,0xDA,0xAD,0x91,0x9A,0x5C,0xF5,0xE6,0x66,0xC4,0xC8,
+	0xBD,0x86,0x6F,0xD2,0x6B,0x89,0xD8,0xFC,0x8E,0xA2,0xB6,
+	0x56,0xEF,0x30,0x57,0x65,0xFF,0x20,0x74,0xE9,0xA3,0xEB,
+	0x71,0xE7,0xED,0xA2,0x8D,0x72,0x1E,0x88,0x61,0x8B,0xA6,
+	0x7F,0x62,0xF2,0x64,0x1A,0x7C,0xBE,0xC1,0xC8,0xE1,0x9F,
+	0x83,0xD0,0x90,0xD2,0x98,0xA0,0x92,0x41,0x88,0x8C,0xAF,
+	0xF8,0x54,0xFB,0xC3,0xDB,0x6A,0xBD,0x2C,0xEA,0xCF,0x3F,
+	0x74,0xD5,0x41,0x18,0x9A,0xF3,0x97,0x88,0x81,0xDC,0xC6,
+	0x36,0x7F,0x39,0xDC,0x2D,0xB8,0x9F,0x97,0xB1,0x6F,0x94,
+	0x09,0x6F,0x7E,0x6D,0x6F,0xB3,0x25,0x7F,0x55,0x27,0x54,
+	0x38,0xBB,0x0B,0x5A,0xD2,0x81,0x06,0x65,0xC2,0x20,0xDC,
+	0x5D,0x68,0xE9,0xFA,0x78,0x38,0x0C,0xAC,0xB7,0x2F,0x74,
+	0x4C,0x54,0x37,0x4C,0x3D,0x61,0x66,0xBA,0x7C,0x69,0x06,
+	0x2B,0x1E,0xAB,0x28,0x28,0xFA,0xA7,0xFB,0x1C,0x3B,0x49,
+	0x2E,0x30,0x5C,0xCD,0x94,0x85,0xFC,0x9B,0xC9,0x20,0x4A,
+	0xE7,0x44,0x9B,0x26,0x7E,0xA5,0xE4,0x09,0x0C,0xE7,0x7C,
+	0xC5,0xF7,0x32,0xF7,0x1D,0xFE,0x95,0x8A,0x27,0xB4,0x11,
+	0x2A,0x27,0xA2,0x4A,0x72,0x6E,0x3F,0x06,0x35,0x1A,0xFA,
+	0xC0,0x8F,0x26,0xA0,0x00,0xE1,0xAD,0x8B,0x6F,0xC6,0x16,
+	0x7D,0x04,0xAF,0x68,0xF2,0xAE,0xB0,0xFC,0x39,0xF5,0xDB,
+	0x6F,0xC5,0x6A,0x1B,0x2E,0x6F,0x54,0xCF,0xB5,0x5F,0x20,
+	0xCD,0xBB,0x0E,0xC0,0x3E,0xA3,0x60,0x04,0xDA,0xF7,0xD2,
+	0x56,0xE3,0x33,0x5A,0x77,0xE6,0xD7,0x07,0x18,0xE9,0x4B,
+	0x27,0xBF,0x04,0x2D,0x15,0x7D,0x11,0x9B,0x10,0x56,0x6B,
+	0x13,0x9B,0xF3,0x28,0x24,0xE9,0x81,0xAB,0x19,0xD9,0x4C,
+	0x5F,0x4E,0x13,0x89,0x2D,0xAF,0x88,0x2D,0xFD,0xB2,0x64,
+	0xE2,0x8A,0x05,0x41,0x6F,0x2F,0xE4,0x24,0x11,0x14,0x26,
+	0xCF,0x69,0x77,0x88,0x5F,0x92,0x74,0x38,0x2A,0x7A,0xCC,
+	0x61,0x95,0x92,0x75,0x5C,0x7B,0x93,0x5B,0x20,0xBA,0xD0,
+	0x9E,0x2C,0x2D,0x6E,0x69,0xDC,0x1C,0xBB,0xD9,0x7E,0xDE,
+	0x75,0x9D,0x50,0x1C,0x6C,0x08,0x76,0x9A,0x97,0x47,0x7F,
+	0x88,0xED,0x17,0x2B,0xAA,0x68,0x10,0x11,0xDA,0xFC,0xAF,
+	0x16,0x28,0x2B,0x3A,0xA5,0xB1,0x03,0x55,0x5C,0x16,0xFF,
+	0x96,0x63,0xC9,0xEE,0xAB,0x87,0x04,0x7C,0x94,0x18,0x50,
+	0x81,0x8B,0xFC,0xA5,0xF2,0x7A,0x60,0x63,0x8F,0xB9,0x3C,
+	0xD2,0xEB,0x53,0xCF,0x19,0x98,0xB2,0x05,0x06,0xDA,0xD2,
+	0x3D,0xF8,0xAA,0x99,0x69,0xBC,0xF7,0x15,0x73,0xD4,0xE0,
+	0x7E,0xC4,0xD6,0xFC,0xA2,0xAC,0x4D,0x3B,0x7E,0x9C,0xD5,
+	0xE3,0x25,0x0D,0x8F,0xE1,0x7B,0x54,0x4C,0xCF,0xA1,0xBE,
+	0x85,0x00,0x2E,0x70,0x6E,0x6C,0xC6,0x20,0x5F,0xBD,0x9D,
+	0x68,0x46,0xDB,0xE0,0x1E,0x54,0xA1,0x21,0xE3,0x85,0x07,
+	0x2F,0xDA,0x99,0xA9,0xA7,0x4E,0x0B,0x86,0xC4,0xA0,0x1F,
+	0xF6,0x74,0x44,0x3E,0xDC,0x0B,0x6A,0xB2,0x98,0x12,0xCF,
+	0x86,0xFF,0x2E,0xF2,0x7E,0x35,0x38,0x4C,0xF7,0x27,0x79,
+	0xC1,0x07,0x5D,0xCE,0x64,0x9D,0x47,0xA6,0x1B,0x11,0x74,
+	0xC2,0x44,0x56,0x57,0xFA,0x81,0x92,0x55,0x98,0xE8,0x09,
+	0x62,0x50,0xCB,0xD4,0x83,0x3B,0xB0,0xD9,0x3F,0xEE,0x73,
+	0x26,0x2C,0xEC,0x44,0xD5,0x3E,0x6F,0xD1,0xC4,0x42,0xB3,
+	0xF7,0x80,0xD9,0x54,0xF7,0xF2,0xFC,0xD5,0xD6,0x28,0x90,
+	0x8A,0xC2,0x03,0x66,0x99,0x09,0x71,0xAA,0x30,0x98,0x6B,
+	0xAA,0x44,0x1A,0xE0,0xDC,0xBF,0x50,0xD8,0x93,0x74,0xB0,
+	0x02,0x02,0xF6,0x85,0x97,0x20,0x42,0x61,0xFF,0xBA,0x7A,
+	0xFF,0x19,0xC6,0x58,0x1A,0xDA,0x5B,0x4A,0x5F,0x37,0xD1,
+	0x1A,0x20,0xAD,0x47,0x80,0x71,0xC9,0x06,0xEB,0x5F,0x01,
+	0x5A,0xFA,0xE3,0x7F,0x33,0xBB,0xF9,0x1B,0xAF,0xF1,0xCD,
+	0xEB,0xFB,0x2E,0x6E,0xFF,0xDB,0x75,0xDD,0x20,0xA6,0x3D,
+	0xD2,0xFE,0xB7,0x7B,0x16,0xF2,0x0F,0xB0,0xF4,0x4F,0xA1,
+	0xE0,0xDF,0xD5,0x7F,0x54,0x77,0x91,0x80,0x56,0xFB,0xF7,
+	0x93,0xBD,0xE7,0xCC,0xB6,0x29,0x35,0x70,0x2A,0x53,0xC7,
+	0xB1,0x71,0xE8,0xB7,0xD3,0x16,0x55,0x87,0x0A,0x84,0xBF,
+	0x2E,0x1A,0xDA,0xF2,0xDE,0xBA,0x50,0x57,0x1F,0xD5,0xDE,
+	0x6D,0x1C,0x59,0xC8,0x7C,0x43,0x21,0xDA,0xE5,0x4A,0x5B,
+	0x43,0x3C,0xBD,0x0B,0x9E,0x2D,0xFF,0xEE,0x9E,0x7A,0xCD,
+	0x1D,0xD9,0xAE,0x52,0xDF,0xCE,0xD8,0xA3,0x1F,0x4E,0x59,
+	0x8F,0x49,0xA4,0x15,0x36,0x27,0xEE,0xD9,0xC5,0x04,0xF5,
+	0x92,0x5E,0x73,0x08,0x23,0x14,0x44,0xB3,0xDD,0x91,0x3F,
+	0xF6,0xEB,0x3E,0xF4,0xB6,0xDC,0x54,0xF7,0x1E,0x48,0xBE,
+	0x52,0x35,0x65,0x1B,0xB7,0x2F,0xD3,0x21,0xAF,0x3B,0xDE,
+	0x41,0x48,0x1D,0x76,0xAA,0x7C,0xCE,0xA0,0x86,0x0B,0xB4,
+	0xA7,0xB2,0x02,0xAF,0x4A,0x23,0x75,0xE6,0xE0,0x5E,0x01,
+	0x36,0x16,0x0B,0x7E,0x2B,0x4F,0x3D,0x24,0xD8,0x45,0x72,
+	0x7D,0x31,0x67,0x5D,0x07,0xA3,0xC9,0xC7,0xB4,0xC3,0x0E,
+	0xFD,0x2E,0xB1,0x94,0x74,0x8A,0x4B,0x34,0xC2,0x56,0x25,
+	0x17,0x1A,0x03,0xEE,0x82,0xE5,0x21,0x02,0x54,0xC8,0xE1,
+	0xC6,0x6F,0x2A,0x38,0x3F,0x7E,0x3F,0x5D,0xAC,0xF9,0x01,
+	0x53,0x6F,0xE0,0xFC,0xB0,0xBB,0xD7,0xE0,0x6F,0xED,0x35,
+	0x2C,0xD3,0x76,0xF9,0x38,0x7C,0xE8,0x1B,0x74,0xF8,0x0C,
+	0x2D,0x80,0x7B,0x79,0x96,0x9C,0x0F,0xEC,0x33,0xD7,0xF3,
+	0x8A,0x88,0xFC,0xEC,0x43,0xB9,0xA6,0x9D,0x33,0x56,0x41,
+	0x7A,0xDE,0x8B,0x53,0x5F,0x5A,0xD2,0x1E,0x56,0x51,0x19,
+	0x73,0x9E,0x99,0x47,0xB3,0x20,0x71,0x7A,0x30,0x4D,0xB3,
+	0x09,0x64,0x1C,0x83,0xD1,0x61,0x98,0x66,0x54,0xBA,0xBB,
+	0xC7,0xD0,0x54,0x02,0x32,0x9A,0x74,0x64,0x91,0xBE,0x07,
+	0x7B,0xF2,0x6B,0xA7,0xE1,0xE7,0xD1,0x30,0x69,0x65,0x31,
+	0x6B,0xB7,0x21,0xD2,0xB5,0x1C,0x9C,0x07,0x31,0xD2,0x40,
+	0x53,0x53,0x8B,0x05,0x99,0x08,0xA7,0x11,0x91,0x2E,0xDD,
+	0x7A,0xF9,0x41,0x75,0x90,0x47,0xD7,0x13,0x32,0x98,0x8B,
+	0xE1,0xBD,0xDB,0xDD,0x67,0x7E,0x36,0x44,0xC2,0x8A,0x87,
+	0x9E,0x17,0x30,0x0A,0x2D,0x90,0x17,0x8F,0xE4,0xC1,0xDE,
+	0x7D,0x4B,0x9A,0xCB,0xDB,0x0B,0xFC,0x5B,0xB4,0xEB,0xA0,
+	0xA9,0xB8,0xCB,0xFA,0x30,0x07,0x9F,0x8A,0xD4,0x22,0x1D,
+	0xCE,0xA9,0x24,0x15,0xB6,0xF1,0x4B,0x0A,0xB0,0x3E,0xCB,
+	0xE3,0x73,0xBC,0x11,0x1C,0xAD,0xD0,0x81,0x27,0x6D,0x5D,
+	0xBB,0x5F,0xA4,0xBA,0xB6,0xFF,0x26,0xDC,0x7E,0xEC,0x8D,
+	0x33,0xB3,0x0A,0x09,0x51,0x9B,0xFC,0xF6,0x74,0xDC,0x3A,
+	0xDF,0x10,0xE0,0x8E,0x12,0x3E,0x6D,0x71,0xE5,0xF7,0x33,
+	0x15,0x2B,0xAD,0x6E,0x0C,0xA1,0x83,0x70,0x0D,0x2D,0x04,
+	0x19,0xEC,0x38,0x5A,0x00,0x5A,0xC9,0x6E,0xA3,0xC3,0x29,
+	0xF1,0xA4,0x2F,0x2F,0xCE,0xBE,0x34,0x6F,0x81,0x2F,0x5C,
+	0x35,0xD3,0x2F,0x44,0xB2,0xFB,0x26,0x76,0xF8,0xD0,0xBB,
+	0xEC,0x89,0x27,0x12,0xF6,0x52,0xB2,0x99,0x9D,0x57,0x5A,
+	0x81,0x2F,0x9B,0xF8,0x3B,0x6F,0x98,0x03,0x03,0xF3,0xC4,
+	0x47,0x80,0x2B,0xCF,0x38,0x07,0xF0,0x86,0xD8,0xD2,0x78,
+	0x92,0xC0,0x77,0x33,0x4A,0xA7,0xF6,0x66,0xCC,0x47,0x0D,
+	0xD7,0x8D,0x18,0x82,0x5F,0xBC,0x8A,0x4E,0x18,0x2A,0x3A,
+	0x10,0x9E,0xEF,0xC1,0x53,0x00,0x84,0x8A,0x98,0x99,0x49,
+	0x06,0x00,0x1F,0x92,0x5E,0xE0,0x61,0xA1,0x23,0x6E,0x25,
+	0x71,0xD9,0x2A,0x1F,0x3C,0x25,0x67,0x4E,0x32,0x6F,0xA2,
+	0xA6,0x62,0xA4,0xAA,0x2C,0x3E,0x28,0x0E,0x89,0x3C,0x85,
+	0xFB,0xD6,0x4C,0xCA,0x55,0x82,0x52,0x95,0x27,0x8B,0x6D,
+	0x72,0x1A,0x64,0x11,0x0E,0xDD,0x67,0x22,0x8E,0x71,0x9D,
+	0x38,0xE5,0xF6,0x16,0x2C,0x86,0xE2,0xCD,0xD4,0x23,0x99,
+	0x92,0x2B,0xB3,0x7D,0x90,0x46,0x03,0x83,0x3D,0xA2,0xCC,
+	0x8C,0x61,0x76,0xB4,0x4E,0x0C,0xE9,0x8A,0x58,0x3A,0xE0,
+	0x55,0x73,0x74,0x12,0x42,0xDC,0x74,0x90,0x49,0xD8,0xEA,
+	0xE3,0x1D,0x35,0xA4,0xD3,0x74,0x81,0x17,0x40,0xBE,0x39,
+	0x17,0x3D,0x74,0xE0,0x52,0xBE,0x8F,0x1A,0x5D,0x18,0x96,
+	0xF7,0x2D,0xF9,0x49,0xC6,0xAB,0x8D,0x54,0x2B,0x45,0x37,
+	0x91,0x30,0x55,0x57,0x15,0x73,0xE2,0xAB,0xD1,0x6E,0x57,
+	0x43,0x31,0x22,0x88,0xB9,0x4E,0x55,0x69,0xF5,0x1E,0xAE,
+	0x90,0xDE,0xED,0x59,0xF8,0x2B,0xEB,0x5E,0x7B,0x26,0xB7,
+	0x1B,0xD9,0x38,0x46,0x66,0x1C,0x93,0x3C,0x74,0xB1,0xF2,
+	0x40,0x0E,0x38,0x28,0x0D,0x72,0x47,0xFA,0x65,0x70,0x86,
+	0xAF,0xD7,0x67,0x3F,0xF7,0x19,0xAB,0x34,0x1F,0x5C,0xCE,
+	0x21,0x7D,0x1C,0x07,0x93,0x26,0xD1,0xDF,0x05,0x60,0xD3,
+	0x7C,0xA5,0xB3,0x73,0x27,0xE7,0xF3,0x2A,0xA4,0x3D,0xBD,
+	0x5E,0x83,0xCB,0xDB,0x48,0x63,0xD0,0xAA,0x0D,0xF1,0xCB,
+	0xB2,0xA6,0x74,0xBD,0xCA,0x61,0x8B,0x7B,0x83,0x5A,0xA5,
+	0x2F,0x5E,0x5A,0x2E,0x29,0x5D,0x0D,0xA7,0x55,0x3F,0xFF,
+	0x59,0x0A,0x9F,0x82,0x0E,0x0B,0xBD,0x10,0x7A,0x29,0x34,
+	0x26,0xF4,0x5A,0xE8,0xAD,0xD0,0x84,0xD0,0xA4,0xD0,0xB4,
+	0xD0,0xAC,0xD0,0x9C,0xD0,0xBC,0xD0,0x22,0x4F,0x20,0x35,
+	0x56,0xF3,0xF4,0xAB,0x8A,0x82,0x62,0xCC,0x20,0x9E,0xB8,
+	0x8C,0x52,0x78,0x01,0xCE,0x94,0x7E,0xE6,0xD0,0x4C,0xAD,
+	0x49,0x7D,0xF2,0x8E,0x79,0xFD,0x30,0x9A,0x48,0xF9,0x8F,
+	0x12,0xEB,0x77,0x14,0x1F,0x59,0x07,0x3C,0x8D,0x8E,0x3F,
+	0xAA,0x78,0xFA,0x2E,0xC6,0x85,0xB6,0x59,0x01,0xF9,0xEA,
+	0xEF,0x05,0xEE,0x49,0xBB,0xA2,0xDC,0xB3,0x9F,0xF2,0xB7,
+	0x0C,0xAF,0x09,0x8C,0x72,0xD0,0x61,0x8F,0x3E,0xE4,0x07,
+	0x9A,0x03,0x42,0xF9,0x25,0x2F,0x2F,0x44,0xC4,0x51,0x5B,
+	0x31,0x1E,0x66,0x11,0xFF,0xE0,0x54,0xCB,0xF1,0x52,0x17,
+	0xF9,0xC0,0xB6,0x2B,0x7B,0x96,0x1F,0x4E,0x3D,0xF6,0x27,
+	0xAF,0x6D,0xAF,0x86,0x2A,0xE6,0xC9,0x25,0x6B,0x69,0xD2,
+	0x86,0x7E,0xAB,0xC1,0x9D,0x20,0x61,0x4C,0x28,0x96,0xD5,
+	0x09,0x13,0x63,0x13,0x92,0x8B,0xE0,0xE2,0x96,0x42,0x48,
+	0x36,0xA3,0x6D,0x6B,0x08,0xAD,0xB9,0x2F,0xDF,0xAE,0xE8,
+	0x95,0xFE,0x4F,0x25,0xC5,0xC1,0x1C,0xBA,0xE8,0xBD,0x73,
+	0x38,0x0A,0x59,0x92,0x24,0x91,0x85,0xA9,0x0B,0x57,0x0E,
+	0x13,0xBA,0xF8,0x6D,0x92,0x6B,0xF8,0xDD,0x5A,0xE0,0xF0,
+	0xFB,0x01,0x58,0xA1,0x22,0x71,0xCB,0x64,0x54,0x59,0xDF,
+	0x58,0xB1,0x5D,0x55,0x51,0x93,0xDA,0x82,0xC1,0xD9,0x67,
+	0x09,0xDE,0xB0,0x52,0x59,0x3A,0x31,0x7D,0x70,0x08,0x39,
+	0x0D,0x30,0x18,0xD7,0x56,0xD8,0x56,0xFC,0x06,0x24,0xB4,
+	0x55,0x40,0xC5,0xAF,0xFC,0xC8,0xB3,0x49,0xD3,0x7F,0xC8,
+	0x67,0xA8,0xFA,0x1A,0x19,0xBB,0x66,0x07,0x57,0xE7,0xEB,
+	0x04,0xAC,0x43,0x7E,0x7F,0x92,0xDF,0xCE,0xFA,0xCC,0x20,
+	0xED,0x9E,0x92,0x97,0xFF,0xEC,0x1D,0xC5,0x94,0xDE,0xFD,
+	0x95,0xBC,0x0B,0x17,0xA1,0x32,0xB3,0xDA,0x7A,0x0D,0x11,
+	0x7D,0x51,0xC2,0xB3,0xCF,0x2E,0x2B,0x19,0x66,0x8D,0xF5,
+	0x9A,0x75,0x60,0xB2,0x1F,0x3D,0x6E,0x56,0x47,0x72,0xAE,
+	0xEE,0xDA,0x57,0x23,0x4E,0x51,0x51,0xD8,0xBB,0x5D,0xF0,
+	0xC9,0x56,0x94,0xB0,0x9E,0xA7,0x81,0xFF,0x5D,0x90,0x75,
+	0x63,0xDF,0x85,0xB4,0x16,0x55,0x8C,0xDE,0xE5,0x6A,0x81,
+	0x38,0x28,0xBC,0x5A,0x50,0x0B,0x59,0x4D,0xD6,0x42,0x57,
+	0xF3,0x6B,0x61,0xAB,0xF1,0x5A,0xB8,0xE5,0x8A,0xE6,0x83,
+	0x37,0x98,0x66,0x33,0x01,0xB4,0x60,0x2E,0x39,0x17,0x53,
+	0x38,0xE4,0x79,0x7F,0x74,0x87,0x67,0xA8,0x8B,0x05,0xDE,
+	0xEF,0x2D,0x53,0xC9,0xC0,0x46,0x43,0xD8,0x3B,0xFA,0xD8,
+	0xD4,0x6F,0x30,0xD4,0x3D,0xFD,0x04,0xBA,0xEA,0xE5,0x7C,
+	0xBA,0xEC,0xF7,0x70,0xE5,0x1C,0xB1,0x71,0x1B,0x4B,0xBC,
+	0xEE,0xB2,0xB4,0xC1,0x6E,0xB3,0xAA,0xB6,0x4D,0x71,0x5E,
+	0x75,0x56,0x99,0x52,0x42,0xF3,0x88,0xFA,0x87,0xF6,0xAC,
+	0x28,0x2D,0x1C,0xD8,0xCC,0x8D,0xB2,0x5D,0xBC,0x2A,0x4D,
+	0x1E,0x5C,0xB7,0x45,0x37,0xE1,0xBE,0xB7,0x5D,0x84,0xE1,
+	0xB2,0x7B,0xBE,0x04,0x3C,0x3F,0x9F,0x50,0x65,0x71,0xF9,
+	0x3A,0xFD,0xFC,0xC1,0x9A,0x75,0xCE,0x47,0xBF,0x8A,0xF3,
+	0x3A,0x39,0xBF,0xD7,0x64,0x9C,0xC7,0x75,0xC4,0x1C,0x7C,
+	0x7F,0x6F,0x43,0x37,0xA4,0xD1,0xE0,0x65,0xF9,0x02,0x6E,
+	0x42,0xA5,0x2E,0xD6,0xF2,0xC3,0xF8,0x01,0xB6,0x1E,0x7E,
+	0x4C,0xDD,0x42,0x6F,0x2E,0x32,0xE1,0x7E,0xBB,0x5B,0xEF,
+	0x7C,0xBE,0xC7,0x74,0x22,0x29,0x67,0x2E,0x2D,0x6E,0x06,
+	0xE2,0xB7,0x96,0x2A,0x05,0xFC,0xBB,0xD4,0x1E,0xC4,0x42,
+	0x3A,0xBF,0x08,0x5F,0xD0,0xE8,0xDE,0x98,0x75,0xBC,0x7F,
+	0xF0,0x4A,0x63,0x2A,0x91,0xE8,0xE0,0x27,0x16,0x84,0x82,
+	0xDF,0x98,0x8A,0xB0,0x52,0xEB,0x61,0xF1,0xEE,0x06,0xBB,
+	0x34,0x2B,0x17,0x22,0x4E,0xD3,0xEC,0x3C,0x50,0x9A,0x37,
+	0xEC,0x2B,0x20,0x55,0xA9,0x00,0x8F,0x8F,0x4F,0x3D,0xDB,
+	0xE3,0xCC,0xE0,0xD5,0xFC,0x6B,0x87,0xDA,0x1B,0xCF,0x3D,
+	0xA9,0x31,0x8B,0x4C,0x43,0xE8,0x49,0xB1,0x86,0xDE,0x2D,
+	0x5B,0x64,0x3D,0xFF,0xCE,0xA3,0x12,0xE9,0xBA,0xCF,0x14,
+	0xB8,0xF5,0xD8,0xEA,0x50,0xA5,0xE5,0x09,0x88,0xEF,0xA8,
+	0x94,0xA8,0x8B,0x78,0x18,0x76,0x89,0x97,0xB4,0x75,0x4F,
+	0x9A,0x6A,0x74,0x67,0x35,0x77,0xD2,0x75,0xDD,0x65,0x62,
+	0xFA,0x7A,0xCF,0xAA,0x2F,0x7F,0xD8,0x71,0x68,0xAF,0x6A,
+	0x66,0x7F,0x37,0x84,0x22,0x43,0xF5,0xDC,0x9C,0x2B,0xFF,
+	0xB2,0x3A,0x15,0x35,0xCB,0x5E,0x87,0x4D,0x1F,0x61,0x7F,
+	0xE1,0x3E,0x92,0x96,0x5D,0x80,0xFC,0xE2,0x9A,0x16,0x1E,
+	0xCB,0x56,0x10,0x65,0x83,0x4B,0xF6,0x43,0xF2,0xBD,0x21,
+	0x88,0x07,0x4C,0x29,0xCD,0xFA,0x86,0x81,0x5B,0x6C,0x38,
+	0xC7,0x6C,0x1F,0xFB,0x48,0x99,0x3F,0x92,0x8F,0x9F,0x05,
+	0x42,0x17,0xBA,0x6B,0x56,0xB4,0x38,0x8A,0x44,0x45,0x35,
+	0x1F,0xE0,0xDE,0x31,0x9B,0x82,0x7E,0x43,0xEF,0x5E,0x27,
+	0xE6,0xF9,0x30,0x81,0x19,0x06,0x07,0xBE,0x9A,0x95,0x5F,
+	0x66,0xC4,0x8C,0xE8,0x6A,0x71,0x96,0x82,0x9F,0x5F,0x1B,
+	0x50,0x4D,0xDC,0x69,0xB1,0x40,0x31,0x13,0x1D,0x5D,0xC2,
+	0x82,0xC7,0xCB,0x72,0x89,0x84,0x00,0xFE,0x37,0x3E,0x43,
+	0x9A,0x21,0x4D,0xAB,0x2E,0x08,0xD9,0x0F,0xF6,0x48,0x29,
+	0x17,0xA7,0x05,0x78,0x41,0xB2,0xB6,0x67,0x8A,0x6E,0x8B,
+	0x2B,0xC1,0xBF,0x2B,0x9A,0xE0,0x2A,0xD1,0x0C,0x54,0xB9,
+	0xE6,0xE4,0x43,0x73,0x8E,0xC0,0x5C,0xD1,0x6A,0xAB,0x86,
+	0x31,0x97,0xB4,0xAF,0x86,0xC9,0x15,0xA1,0x91,0xC6,0x47,
+	0xDE,0x7D,0x45,0xD5,0x80,0x04,0x7F,0x98,0xC2,0x1B,0x8E,
+	0x48,0x34,0x45,0x3C,0x6B,0x06,0x3E,0x2D,0xDA,0x7D,0xBD,
+	0x88,0xEC,0xB5,0x27,0x6D,0xB5,0xA4,0x04,0x06,0xAB,0x59,
+	0x40,0xC4,0xB7,0x5F,0x4B,0x04,0x86,0xDC,0x4F,0xF4,0x0D,
+	0x56,0x3B,0x01,0x0C,0x3D,0xEA,0x42,0xB9,0x1A,0x89,0x44,
+	0x8E,0x5B,0x38,0x86,0x71,0x24,0x6E,0x61,0xAD,0x52,0x36,
+	0x6E,0x16,0x01,0x41,0x23,0xE4,0x5A,0x67,0xF0,0x5E,0x23,
+	0x5E,0xFF,0x60,0xDF,0x35,0x44,0x83,0x50,0x36,0x24,0x8B,
+	0x3D,0x1F,0x8B,0x17,0x98,0x38,0x27,0x3B,0x94,0x96,0x0D,
+	0x57,0xC3,0x9A,0x79,0xA8,0xFE,0x41,0x03,0xB0,0x68,0x94,
+	0x95,0x49,0xAF,0xBF,0x86,0x80,0xFD,0x35,0xC7,0x33,0x26,
+	0x95,0xCF,0x90,0x09,0xC8,0x2C,0x1F,0x34,0x9E,0xDA,0x6E,
+	0x50,0x4A,0x21,0x57,0x79,0xA1,0x8B,0x39,0xFC,0x78,0x91,
+	0x37,0xA1,0x87,0xD6,0xCA,0x1D,0xDC,0xC3,0x03,0x3E,0x2B,
+	0xA6,0x88,0xF4,0xD5,0xC2,0xC3,0xD1,0xC6,0xBF,0x6E,0xBE,
+	0xAA,0x38,0x43,0x83,0x2B,0xC8,0x41,0x64,0x66,0x77,0x4C,
+	0x83,0x2A,0xAA,0x48,0x17,0x0E,0x6C,0x4D,0xCB,0x8D,0xC1,
+	0x10,0xE3,0x7A,0xC8,0xF2,0xF1,0xC6,0xB0,0x8D,0x9D,0xD7,
+	0xF3,0xB5,0x64,0x2C,0x72,0xEC,0x41,0x26,0x24,0x4D,0x53,
+	0xFB,0x03,0x10,0x64,0x25,0xC7,0x7D,0x7E,0x78,0x25,0xB0,
+	0x5E,0xCD,0x8D,0x28,0xAA,0xCB,0xDB,0xEE,0x18,0x6B,0x90,
+	0x60,0xDE,0x7A,0xC6,0xD2,0x09,0x45,0x62,0x05,0xB3,0x5A,
+	0xAE,0xDD,0x53,0x7D,0x23,0x48,0x61,0x36,0x66,0xE8,0x40,
+	0x80,0x05,0x5C,0x76,0x63,0x9A,0x60,0xE0,0xD9,0x4C,0x39,
+	0x13,0x45,0x41,0xBF,0xD8,0x77,0x05,0x56,0xBC,0x1A,0x21,
+	0x69,0xF2,0x28,0xF5,0xDD,0xCE,0x07,0xE2,0x76,0xA1,0x9A,
+	0x18,0xB9,0x22,0xFB,0x1F,0x4E,0xEE,0x64,0x97,0x03,0x2A,
+	0x5F,0x2D,0x41,0xEB,0x66,0xF3,0xDE,0xE4,0xE1,0xB8,0x63,
+	0xC1,0x97,0xB5,0xD2,0xFD,0x28,0x91,0xBB,0x68,0x30,0xEB,
+	0x4A,0xE3,0x42,0x61,0x9E,0x6F,0x95,0xCA,0xC9,0x76,0x3D,
+	0x7B,0x01,0x40,0x49,0x7D,0x81,0x11,0x1B,0xCB,0x92,0x5F,
+	0x38,0x3C,0x74,0x5E,0x05,0x57,0x66,0x2C,0x7B,0x25,0xE5,
+	0x77,0x9E,0xFD,0x64,0x80,0x44,0xCD,0xFB,0xD6,0x22,0xBD,
+	0x9F,0x82,0x8E,0x16,0x9A,0x90,0x8F,0xBE,0xB4,0x1D,0x0E,
+	0xC4,0xE1,0x66,0x81,0xB6,0x8A,0xAC,0x87,0xCE,0xFF,0x20,
+	0x86,0x4F,0x77,0xA3,0x64,0x9A,0x49,0xBF,0x69,0xF6,0x33,
+	0x35,0x8F,0xD0,0x0D,0xC2,0x81,0x96,0xFD,0xEC,0x69,0x4E,
+	0x18,0xA0,0x6F,0x49,0xD6,0x3A,0x05,0x63,0x1E,0x02,0xA1,
+	0x16,0xD4,0x91,0x6C,0xDD,0x80,0x54,0x58,0xAF,0x49,0xA8,
+	0xF7,0x9D,0x4C,0x42,0x37,0xA7,0xB7,0x2D,0x84,0x77,0x4D,
+	0x92,0x09,0x1A,0x93,0x6D,0xE8,0xED,0x20,0xCA,0x79,0x2A,
+	0x04,0xF8,0x04,0x9A,0xB9,0x37,0x69,0x77,0xF0,0x77,0xF5,
+	0xD6,0x00,0x24,0x91,0x30,0x34,0x45,0x83,0x15,0x82,0xA2,
+	0x40,0xBD,0xFE,0x68,0x55,0x90,0xCF,0xC8,0x6C,0xDD,0x7F,
+	0x24,0x48,0xD2,0x52,0x97,0xC0,0x15,0x64,0x6F,0x59,0xE0,
+	0xF2,0xEB,0x2F,0x78,0x36,0x5F,0xED,0xDE,0x49,0x5E,0x17,
+	0x2B,0x5C,0x15,0xB4,0xFC,0x66,0xB3,0x61,0xEA,0x31,0x0C,
+	0x07,0x34,0x8E,0xB7,0xAE,0xDE,0x02,0xFF,0xA5,0x03,0xDC,
+	0x9F,0xC0,0x6A,0x1F,0x5F,0x82,0x60,0x1D,0xB1,0x7A,0xF5,
+	0x24,0xD7,0xCE,0x2B,0xFD,0x38,0x57,0x75,0xED,0x68,0x78,
+	0xCE,0xA2,0x2A,0xF1,0x6F,0x9D,0x1E,0x50,0x24,0x59,0xF3,
+	0x40,0x19,0xB8,0x44,0x22,0x15,0x54,0x31,0x32,0x4A,0xBF,
+	0x20,0x5B,0x3A,0xF6,0x57,0xFE,0x02,0x80,0xB1,0xAB,0xBC,
+	0x0B,0xD8,0x68,0x81,0xC5,0x5F,0x4B,0x26,0x23,0xB7,0xCE,
+	0xA5,0x2F,0xFE,0xB3,0x4F,0x31,0x66,0x4C,0x2F,0x0A,0x90,
+	0xB8,0x38,0xD7,0xB4,0x87,0xDF,0xAF,0x30,0x46,0xFF,0xAE,
+	0x33,0x56,0xF3,0x83,0x11,0xC4,0x34,0x0A,0xA4,0x96,0x1E,
+	0x1F,0xAA,0xB7,0xF8,0x33,0x46,0x49,0xCF,0xD5,0xD3,0xBB,
+	0x2E,0xC5,0xC3,0xBC,0xE5,0x2C,0x5E,0xAA,0xBB,0xCD,0x57,
+	0x96,0x80,0xDD,0x5A,0x93,0xD3,0xF3,0x94,0x83,0x5B,0x70,
+	0xBF,0x5B,0x25,0x2B,0xB4,0x81,0x5E,0xED,0x70,0xA7,0xE6,
+	0x17,0x3D,0x5F,0x66,0x7E,0x1B,0x59,0x8A,0x6D,0x3D,0xAB,
+	0xC0,0x37,0x1B,0x13,0xBB,0x18,0x2B,0x70,0x51,0x53,0xE4,
+	0x4B,0xF0,0x72,0x0A,0x3E,0xFE,0xAD,0xE5,0x55,0xD1,0x92,
+	0xAA,0x13,0xE7,0xA8,0x41,0xE6,0x5F,0xAA,0xD6,0x71,0x49,
+	0xF8,0x6E,0x4C,0x83,0xD5,0xDE,0x69,0x50,0x31,0x2E,0x65,
+	0xFB,0x23,0x89,0xD4,0x10,0x5C,0x0A,0x66,0x1C,0x2B,0x95,
+	0xA5,0x5A,0x0E,0x92,0xEF,0x4D,0x46,0x50,0x33,0x6B,0xF0,
+	0x6F,0x29,0xB0,0x63,0x2A,0x4C,0xA9,0x5F,0xBA,0x70,0x00,
+	0xA8,0xCF,0x20,0x95,0x2C,0x6C,0xA6,0xD4,0x3E,0xCD,0x8F,
+	0xEA,0x84,0x6E,0x25,0x88,0xE3,0x17,0x4F,0xA1,0xE0,0x92,
+	0x61,0x37,0x4D,0x80,0xE7,0xD0,0x23,0x93,0xF6,0x56,0xEA,
+	0x26,0xFA,0x42,0x5F,0x39,0x92,0x03,0x5F,0x9D,0xA6,0x89,
+	0x96,0x45,0xA8,0x20,0xB8,0x3F,0x81,0x7E,0x03,0x82,0x87,
+	0x2F,0x7A,0xFF,0x90,0x8F,0x37,0x7F,0xF4,0x50,0xA4,0x7A,
+	0x65,0xD7,0x43,0xB8,0xA6,0x4F,0x46,0x18,0xC8,0xFE,0xDE,
+	0x07,0xFB,0xF8,0x77,0x0D,0xBF,0xF6,0x6E,0x43,0xD7,0xCB,
+	0xEF,0xAA,0x48,0x65,0x2F,0x00,0x1E,0x12,0xCC,0x00,0xDD,
+	0x2C,0xFA,0x07,0x68,0x4E,0x15,0xC9,0x3E,0xBB,0x6C,0x0F,
+	0x67,0xEE,0x33,0x49,0x6E,0xE6,0x4D,0x72,0x15,0xC1,0xB9,
+	0x36,0xC9,0x50,0xF4,0x72,0x8A,0x9A,0xB6,0x90,0x3A,0xD1,
+	0x38,0x2F,0x71,0xEC,0x90,0x39,0xDD,0x0D,0x2F,0x83,0x80,
+	0x85,0x0A,0xE0,0x80,0x24,0xAE,0x30,0x0D,0xAB,0xEF,0x0D,
+	0xC9,0xAF,0x99,0xE2,0xE4,0xEF,0xE0,0x58,0x7F,0x82,0x19,
+	0x5B,0x4A,0x1F,0x22,0xD4,0x7E,0xCC,0xDB,0xAA,0x47,0x6C,
+	0xB4,0x14,0xB3,0x35,0xC1,0xF7,0xF8,0x5F,0x1C,0xE0,0xCA,
+	0xBF,0xAE,0xD5,0x8C,0x28,0x0E,0x26,0x42,0x92,0xB4,0xA1,
+	0x56,0x82,0xB8,0xCD,0xF5,0x31,0x65,0x3A,0x6A,0x7B,0x87,
+	0x8A,0x46,0x23,0x9A,0x85,0x2B,0x4F,0x6A,0x58,0x88,0x57,
+	0x35,0x3C,0x80,0x18,0x23,0x76,0xE1,0x48,0xF7,0x52,0x40,
+	0x0A,0xEE,0x6F,0xFA,0xD2,0xFF,0xBF,0xAB,0x36,0x0E,0x03,
+	0x7C,0x09,0x5E,0xEA,0x35,0xF7,0xC5,0x78,0xAB,0xA0,0xEC,
+	0x3E,0x90,0x79,0x4B,0x88,0xD5,0x23,0x88,0xD3,0x02,0x80,
+	0x77,0x16,0xE1,0xD2,0xCA,0xF0,0x4D,0x23,0x3D,0x87,0xBD,
+	0x1E,0x80,0x0B,0x1E,0xF2,0x99,0x57,0xAF,0x0E,0xED,0x06,
+	0x4A,0x5B,0xA3,0x63,0x51,0x78,0xFA,0x60,0x4E,0x3C,0x7F,
+	0xC6,0x1E,0x6D,0xBC,0xDD,0x72,0x5C,0x6D,0x0B,0x8E,0x8A,
+	0x51,0x29,0x34,0xA7,0x56,0x30,0xB5,0x59,0xE6,0x9E,0xA2,
+	0x45,0x80,0x63,0x23,0x31,0xD9,0xEA,0xA9,0xC7,0xD9,0x8A,
+	0xF7,0x84,0xFE,0xA3,0x9B,0x16,0x5F,0x41,0x04,0xF1,0x67,
+	0x77,0xB6,0x92,0x81,0x41,0xDD,0x2D,0xA9,0x94,0x53,0x9E,
+	0x54,0x21,0x33,0x53,0xA9,0x2B,0x3A,0x9F,0x01,0x70,0xCE,
+	0x88,0x10,0xA2,0xF4,0xA0,0xA9,0xA0,0xAE,0xF7,0xA6,0x45,
+	0x91,0xAF,0x7A,0xEA,0x4D,0xD9,0x75,0x0B,0x87,0xC6,0x2B,
+	0x37,0x87,0xCC,0x30,0xC2,0xF0,0xEF,0x3E,0xBE,0xBB,0xF5,
+	0x78,0x03,0x4C,0xEE,0x38,0x95,0x20,0xB1,0x94,0xEC,0x7A,
+	0x44,0xF8,0x45,0xBD,0x1F,0x5D,0x6D,0x4F,0x05,0x8D,0xA2,
+	0x13,0x64,0xE6,0x5A,0xE1,0x78,0x97,0xA4,0x13,0x75,0x80,
+	0x2C,0x3D,0xA0,0x4B,0x20,0xFF,0x9C,0x7C,0x14,0xB2,0x7C,
+	0x95,0x5F,0x1E,0x17,0x64,0xB0,0x26,0x34,0x4F,0xA9,0x32,
+	0x39,0x77,0x4E,0xC3,0x78,0x3A,0xF5,0xA5,0xDC,0x00,0x98,
+	0x92,0x22,0x60,0x31,0x15,0x71,0xE0,0xBB,0xBD,0x86,0x36,
+	0xD7,0xC6,0xCF,0x7F,0x71,0x65,0x61,0xE3,0x44,0x11,0x77,
+	0xB7,0x91,0x39,0x3B,0x77,0x08,0xF5,0x8D,0xF5,0xBA,0x24,
+	0x78,0x9F,0x8F,0x7F,0x43,0x5E,0xDF,0x33,0x81,0x4B,0xD9,
+	0xF4,0xB5,0x07,0xAF,0x55,0x36,0xCF,0xED,0xF1,0xE1,0x5E,
+	0x41,0xDF,0xEE,0x37,0xE0,0x92,0xF1,0x15,0xE9,0x17,0x1C,
+	0xAC,0x58,0x7A,0x2B,0xC9,0xA2,0x35,0xDF,0x71,0xA6,0x6F,
+	0x1E,0xB8,0x38,0xDB,0x5F,0xF8,0x69,0x0C,0x3C,0x01,0x15,
+	0xF4,0x1B,0x7B,0x20,0x07,0x62,0x66,0x3E,0xCB,0x83,0x4E,
+	0xE4,0x7E,0x27,0x7B,0x52,0x8D,0xCB,0x99,0x70,0x6C,0x4A,
+	0x65,0x02,0x0C,0xF1,0x53,0x12,0xB0,0x0C,0x67,0xAA,0x4E,
+	0x6A,0xA3,0x2E,0xA8,0x4B,0x6B,0x8B,0x98,0x47,0x1F,0x58,
+	0x26,0x89,0x12,0x93,0x53,0x46,0xDD,0x99,0xBE,0x73,0x61,
+	0x66,0xA5,0x30,0xC8,0x9D,0x69,0x1C,0x1C,0xCE,0xCD,0x4F,
+	0x42,0x5C,0x48,0x61,0x44,0x47,0x5E,0x00,0x54,0x5F,0xAF,
+	0x49,0xA3,0x81,0x1E,0xBA,0xBF,0x7C,0xE8,0x87,0xCC,0xCD,
+	0x6E,0xC4,0x17,0xFD,0xD2,0xBD,0xBD,0x30,0xCD,0x5D,0x97,
+	0x67,0xCE,0x0C,0xCC,0x85,0x16,0xE5,0x6D,0x78,0x8B,0xE3,
+	0xC4,0x67,0x89,0x55,0xCF,0xCC,0x52,0xE4,0x53,0x08,0x1F,
+	0x5D,0x92,0xA7,0x2F,0x71,0x53,0x61,0xE8,0x87,0x4B,0x99,
+	0xDD,0x7C,0x03,0x1C,0xE1,0x6D,0xF6,0xC7,0x00,0x6E,0x2A,
+	0xAE,0xE0,0x20,0x13,0x57,0x3F,0x66,0x99,0x62,0x83,0x15,
+	0x8A,0xEE,0xD9,0x2E,0x37,0xF7,0x45,0x98,0x7C,0x05,0x01,
+	0x06,0xCC,0x0F,0x52,0x9A,0x8B,0x7B,0x03,0x06,0x49,0x96,
+	0xA8,0x36,0xF2,0xA9,0x86,0x89,0x5A,0x96,0xD2,0x44,0xF0,
+	0x3B,0x56,0x95,0x80,0x64,0xF4,0x77,0xC8,0xA8,0x78,0x9B,
+	0x6E,0xFC,0x8E,0xB1,0xB3,0xFA,0x98,0x70,0x7B,0x8C,0x20,
+	0xBC,0x1F,0xE4,0x22,0x32,0x89,0x73,0x48,0x2F,0x49,0x73,
+	0x38,0xA7,0x31,0x31,0xA8,0xE4,0x5B,0x6F,0x8D,0x61,0xDD,
+	0xC6,0xB4,0xBB,0xFF,0x3C,0x22,0x45,0x27,0x3C,0x62,0x35,
+	0x24,0x5D,0xF4,0xCF,0x8B,0x34,0x9D,0x6F,0x4F,0x76,0x93,
+	0xCC,0x9C,0x53,0x08,0x90,0x64,0x41,0xFE,0x1C,0x83,0xE9,
+	0xE2,0x61,0xC4,0x10,0x94,0xEC,0x00,0x04,0x9D,0x75,0x21,
+	0x1A,0xDE,0x95,0x10,0xDA,0xD5,0xA0,0xDC,0x9F,0x52,0x08,
+	0xEF,0x16,0xB0,0x77,0xCB,0x6B,0xCE,0x4B,0x8F,0x39,0x02,
+	0x93,0x79,0x99,0x2B,0xD9,0x2D,0x25,0xAA,0x01,0xCC,0xFE,
+	0x07,0x59,0x03,0xE4,0x55,0x47,0xC8,0x4B,0xE1,0x17,0x57,
+	0x66,0x1A,0xD8,0xDD,0x97,0x77,0x90,0x2E,0xBC,0x17,0x7B,
+	0xF4,0x9E,0x7B,0x19,0xCA,0xBD,0x5C,0x10,0xED,0xE6,0x64,
+	0x84,0xCE,0x22,0xB2,0x7B,0xF5,0x2D,0x37,0x8E,0xEF,0x6A,
+	0xA6,0xB6,0xCC,0xB9,0xEC,0xFA,0x46,0xF9,0xEB,0xB5,0x60,
+	0x21,0x17,0x15,0x5F,0x28,0x35,0x70,0x0B,0xB7,0xE6,0x11,
+	0xE6,0x2E,0x8F,0x33,0x99,0x5C,0x3B,0xE5,0xEF,0x2E,0x61,
+	0xA0,0xC7,0x9B,0x64,0xE5,0x81,0x9E,0x6D,0xFF,0x31,0x13,
+	0x66,0xB0,0x9D,0x59,0x66,0x16,0x30,0x94,0xE1,0x5A,0xDD,
+	0xAC,0x94,0x8B,0x87,0x01,0x5C,0x76,0xDD,0x87,0x7C,0xC0,
+	0xC3,0xB8,0xC7,0xD8,0x52,0x6C,0x21,0x5B,0xB4,0x78,0x35,
+	0x48,0x38,0x9A,0xDF,0xB6,0x1F,0xE8,0x13,0xF2,0x27,0x62,
+	0x9D,0xFF,0x3D,0xD4,0x8F,0x5A,0xF9,0xA7,0x30,0x0A,0x2C,
+	0xAA,0x01,0x13,0x26,0x64,0x85,0xB8,0x6B,0xDF,0xF2,0x33,
+	0xE6,0x77,0x41,0x3B,0xA4,0xF3,0xD7,0x33,0x64,0x83,0x51,
+	0x56,0x66,0xE7,0xCE,0x65,0xF6,0x48,0x46,0x8A,0xF4,0x45,
+	0xBA,0xF8,0xF7,0x7E,0x93,0x43,0x03,0xA6,0x21,0x18,0x40,
+	0x8A,0xEA,0xE5,0x80,0xA3,0x84,0x5A,0x80,0x4A,0x88,0x26,
+	0xC5,0x1B,0x9B,0x1A,0x89,0x23,0x64,0x43,0x6F,0xE7,0xED,
+	0x78,0xA0,0xBE,0xBE,0x84,0x40,0xD9,0x17,0xD3,0x1C,0xBA,
+	0x3B,0x41,0x82,0x9A,0xEE,0x52,0xE2,0x06,0x02,0x8A,0x0B,
+	0x27,0x00,0x1D,0x02,0x70,0x8B,0x19,0xBD,0x6C,0xF0,0x31,
+	0x82,0x01,0x57,0x2C,0x73,0xA2,0x17,0x85,0xB1,0x7C,0x01,
+	0x16,0xCF,0xA3,0x36,0xAF,0x4B,0x19,0x69,0x04,0x26,0x73,
+	0xC5,0xB1,0x27,0x39,0xC2,0x88,0x0C,0x08,0xDB,0xBE,0x9B,
+	0x2C,0x58,0xF6,0x43,0xB3,0x81,0x2C,0xB2,0x04,0x2B,0xA3,
+	0x08,0x2E,0x51,0xFE,0xC1,0x99,0x52,0xFC,0x3C,0x5B,0xCA,
+	0xA4,0xF8,0xBE,0xF5,0x13,0x21,0xE8,0xB1,0xEF,0xF6,0x53,
+	0x89,0x48,0xE5,0xBF,0x42,0xC0,0x35,0x11,0x45,0xCD,0x95,
+	0xB1,0xC6,0x4E,0xBE,0xF3,0x00,0x12,0x26,0xD7,0x47,0x88,
+	0xFA,0x23,0x86,0x04,0xE4,0xBE,0x49,0x69,0xFB,0x0D,0x3C,
+	0x6D,0x9A,0x57,0xC4,0xE3,0x03,0x8A,0x83,0x03,0xB9,0x40,
+	0xCB,0x4E,0x8A,0xF1,0x78,0x94,0x6F,0x78,0x08,0x42,0x14,
+	0x84,0xB7,0x51,0x81,0xB7,0x98,0xBB,0x4E,0x58,0x58,0x51,
+	0x8F,0xA9,0x71,0x49,0x27,0x9D,0x82,0x45,0x98,0xCB,0x0F,
+	0x20,0xEB,0x38,0x4B,0x54,0xB3,0x5C,0x84,0x2E,0x45,0x45,
+	0x21,0x5D,0xA1,0xAA,0x40,0x4A,0xB1,0xCB,0x7F,0x7E,0x9F,
+	0x17,0xB6,0xD2,0xEF,0xC3,0xF4,0x3B,0x15,0xB5,0xA6,0x47,
+	0x7D,0xBA,0xDF,0x95,0x8D,0xBA,0x3A,0x66,0x62,0x96,0xC9,
+	0x49,0xB9,0x6C,0x03,0x44,0xA0,0x6A,0xE9,0x12,0x85,0xD4,
+	0xBD,0x28,0xA4,0x7A,0xC7,0x11,0x23,0x38,0x2C,0x37,0x13,
+	0xB7,0x72,0x78,0x1B,0x86,0xCC,0x0B,0x63,0x6F,0xDF,0xC5,
+	0xBD,0xA3,0xE0,0x58,0x1B,0xA4,0x3B,0x0F,0x80,0xEE,0x05,
+	0x47,0x3C,0xED,0xE6,0xA9,0xF3,0x0D,0x8E,0x41,0x0A,0xAE,
+	0xCB,0x7C,0x92,0x5A,0xBE,0x17,0x1A,0x88,0xD2,0xBE,0x12,
+	0x47,0xA8,0xEF,0xD2,0x76,0xFF,0x80,0xE1,0xBA,0x78,0x3D,
+	0x81,0x8B,0x10,0x44,0x68,0x4A,0x32,0x1E,0x07,0x29,0x86,
+	0xAB,0x39,0xFA,0x98,0x20,0x1D,0xBD,0x9C,0xE0,0x14,0x94,
+	0x2F,0x02,0x84,0x82,0x88,0x38,0xF4,0x49,0x3E,0xF6,0x3D,
+	0xAA,0x66,0xED,0x3C,0x4E,0x83,0xA9,0xB9,0x1D,0x7A,0x8C,
+	0xBA,0x27,0xF3,0xD0,0xAB,0xF9,0x20,0xF8,0x51,0xBD,0x5E,
+	0x75,0x3B,0x52,0x67,0xAB,0x66,0x3B,0x19,0x77,0x42,0x54,
+	0x0B,0xCA,0x05,0xA4,0x35,0x3C,0x8B,0xC3,0x45,0x63,0x2A,
+	0x78,0x38,0x5A,0x64,0x85,0x70,0xB6,0x76,0x14,0x53,0x45,
+	0x09,0xF8,0xA6,0x3E,0xB6,0x6E,0x0F,0xE5,0x84,0xB1,0x46,
+	0xEA,0x16,0xE3,0x23,0xFE,0x27,0x9E,0x51,0xE5,0xCB,0x12,
+	0x52,0x05,0x88,0xD6,0xB6,0xB4,0x19,0xAA,0xCF,0x1C,0x02,
+	0x91,0x02,0xF0,0xEF,0x40,0x5A,0xDF,0x31,0xAF,0x36,0x97,
+	0x80,0x98,0x64,0x7E,0x11,0x0D,0x24,0x45,0x59,0x8C,0xB1,
+	0xA4,0xDC,0x44,0x26,0x17,0xC4,0x83,0x55,0xE0,0xFD,0xF5,
+	0xE8,0xDB,0x38,0xC4,0x11,0xAF,0x56,0x79,0xD3,0x9C,0x27,
+	0x0F,0x41,0xEB,0xA7,0x49,0x77,0x13,0x4F,0x7B,0xC2,0x04,
+	0xA0,0x8D,0xED,0x72,0xF1,0xCE,0xED,0xB4,0x21,0x32,0x90,
+	0x74,0x09,0x08,0x49,0xCD,0x3B,0xA2,0x52,0x75,0x82,0x6A,
+	0x3E,0xE4,0x8A,0xC8,0x53,0xBE,0x08,0xA0,0x89,0x45,0x47,
+	0x41,0xCA,0x2E,0xFA,0x33,0x1F,0x59,0x83,0x96,0xD4,0x69,
+	0x2D,0xA2,0x4A,0x08,0x70,0xE4,0xEE,0xE0,0x0E,0x4C,0x41,
+	0x63,0x1C,0xD4,0x85,0xAB,0xB6,0x13,0xE1,0xAF,0x53,0x15,
+	0x22,0x59,0x02,0x5A,0xD0,0x2C,0x47,0xBF,0x3F,0x2A,0xEC,
+	0x4B,0x14,0x50,0xD3,0x46,0xE0,0x87,0xC3,0x14,0xE5,0x39,
+	0x90,0xA5,0xD7,0xAD,0x43,0x6B,0xF8,0x54,0x42,0x6E,0x2C,
+	0xE9,0x1D,0x4C,0x32,0x49,0x25,0xCF,0x70,0x90,0x43,0x76,
+	0xA1,0x7A,0x1B,0xA6,0xAA,0x48,0xC3,0xB0,0xA7,0x8A,0xE4,
+	0x2A,0xB0,0x05,0xCD,0xD3,0x95,0x04,0xCC,0x18,0xA8,0x96,
+	0xB0,0x02,0x85,0x08,0xC1,0x84,0xE0,0x42,0x48,0x57,0xF9,
+	0xA8,0x3D,0xB6,0x03,0x20,0x55,0xCA,0xA9,0x8A,0xB1,0x9D,
+	0x6F,0x19,0xC4,0x02,0xD0,0x43,0x89,0xF8,0xD2,0x54,0xCB,
+	0xB0,0x79,0x1C,0xC8,0xF2,0x82,0x23,0xDB,0x49,0x10,0x1B,
+	0x35,0x22,0x7D,0x1D,0xDE,0x50,0x3E,0xFA,0xA4,0x5D,0x1B,
+	0x3E,0x99,0x1A,0x3F,0x56,0xF4,0xF6,0xDF,0x63,0x04,0x01,
+	0x72,0xEE,0x4A,0xEF,0xC0,0x5B,0xDF,0x5B,0x59,0xA3,0x41,
+	0x07,0x3B,0xD2,0x0A,0x64,0x69,0x11,0x67,0x18,0xFE,0xF1,
+	0xD5,0x38,0x62,0xE4,0x4C,0x14,0x46,0xE4,0xEA,0x45,0x5F,
+	0x9E,0x9E,0x34,0x70,0x5A,0x16,0x2F,0x21,0x10,0x41,0x49,
+	0xB6,0x94,0xE8,0xA9,0x0D,0x24,0xA4,0x30,0x6A,0x51,0x84,
+	0xF5,0x0A,0xDA,0xEC,0x15,0x29,0x64,0x5D,0x0C,0x1A,0x08,
+	0x2F,0x80,0x17,0x04,0x8D,0xD1,0x72,0x6B,0x96,0xD1,0xEE,
+	0x6E,0x96,0x8D,0x9A,0xF6,0xA9,0x95,0x15,0x89,0x37,0xFE,
+	0x01,0xFD,0x20,0x39,0xBF,0x1B,0xBE,0xA1,0xDD,0x90,0x39,
+	0x95,0x2B,0xC0,0x15,0xA5,0xB7,0x7D,0x52,0x9D,0x38,0xF4,
+	0x7B,0x80,0xBB,0xF4,0x20,0xB2,0x43,0xF6,0xA1,0xED,0x1B,
+	0x02,0xBE,0x45,0xA8,0x1C,0x74,0x5D,0x36,0xA2,0x38,0x37,
+	0xE7,0x7F,0x29,0x63,0x2B,0xFB,0x56,0xF2,0x81,0xFB,0xC3,
+	0x0F,0x08,0xDD,0xF2,0x0C,0xBA,0xF0,0x46,0xB6,0xD6,0xC9,
+	0x4D,0xA5,0x87,0x95,0x30,0x14,0x4C,0x7E,0x3D,0xEC,0xE8,
+	0x01,0x97,0xFA,0x72,0x6B,0x43,0xA0,0xFB,0xB5,0x04,0xB8,
+	0x86,0x54,0xA1,0x16,0x6C,0xF1,0xEE,0xDB,0x81,0xA6,0xF9,
+	0x29,0xB0,0x9D,0x59,0x0A,0x87,0x7E,0x74,0xAE,0xE2,0x03,
+	0x1D,0xAA,0x02,0xB0,0x99,0x7B,0xD1,0xC0,0x3E,0xFF,0xF4,
+	0xDD,0x41,0x5C,0x87,0x18,0x58,0xB4,0x47,0xAA,0x0A,0xA2,
+	0x50,0x47,0x84,0x44,0xE0,0x16,0xB4,0xF1,0x65,0x0E,0x52,
+	0x8A,0xED,0x64,0xCC,0x7E,0xED,0xA1,0x38,0x9E,0x12,0x9A,
+	0xF6,0xB2,0x1D,0x67,0x7C,0x06,0x12,0x6D,0x64,0x45,0xBC,
+	0x41,0x95,0x00,0xF8,0x5A,0x62,0xFB,0xFF,0x31,0x97,0xE8,
+	0x3A,0xE1,0xC0,0x3C,0x90,0x10,0x71,0x89,0x04,0xCE,0x8B,
+	0xBF,0x4A,0xC1,0x4A,0x47,0xFB,0xE9,0x86,0xF0,0x7A,0x81,
+	0x30,0x15,0x7C,0x55,0xAE,0x22,0xD0,0x1C,0x15,0x60,0x23,
+	0xDC,0x95,0x75,0x25,0x95,0x85,0xBC,0xEF,0x21,0xF8,0x5D,
+	0x19,0x5D,0x5D,0x32,0x2F,0x99,0xFF,0x37,0x4C,0xEF,0x65,
+	0xF6,0x1E,0xF2,0xAA,0xA3,0xA9,0x95,0xBC,0xBF,0xDC,0x37,
+	0x83,0x98,0x40,0xA6,0xDF,0x33,0x4B,0xAA,0x95,0x67,0x2C,
+	0x2B,0x27,0xE7,0x19,0xDA,0xEF,0x65,0xAF,0xD8,0x4C,0x65,
+	0x10,0x76,0xDB,0x04,0x48,0x7E,0x93,0x22,0xB7,0xAC,0x92,
+	0x7E,0x00,0x89,0x9E,0x08,0xF3,0xA6,0x66,0xD7,0x58,0x3D,
+	0x4D,0x5E,0x1F,0x06,0x18,0x0B,0xDC,0x99,0x98,0xC3,0x1D,
+	0x42,0x3D,0x50,0xC3,0x43,0xCA,0xCE,0x90,0x2A,0x6E,0xA5,
+	0x58,0x9D,0x15,0x8E,0xCD,0x1D,0x7C,0x06,0xB9,0xFC,0x7A,
+	0x95,0xFD,0x43,0xED,0x97,0x84,0xD4,0x48,0x66,0xB9,0xED,
+	0x1D,0xF0,0xA9,0xDF,0xDF,0x20,0xD9,0x42,0x15,0x5D,0xD6,
+	0x3B,0xA8,0x1D,0xA4,0x31,0xF2,0x2F,0xC2,0x18,0xE8,0xC5,
+	0x7E,0x92,0x02,0xEF,0xD3,0x1D,0x90,0x01,0x4E,0xAA,0x8C,
+	0x7A,0x18,0xAF,0x8A,0x00,0xC1,0x80,0xA0,0xF4,0x82,0xF5,
+	0x22,0xB1,0x6F,0x49,0x07,0xC9,0x05,0x5D,0xF3,0xDB,0xDC,
+	0xE2,0x4E,0x56,0xBA,0x60,0xEC,0xBF,0x57,0x38,0x13,0xA8,
+	0xC0,0xA3,0xA9,0x65,0x91,0xA1,0x8B,0xDE,0xE0,0xBB,0x26,
+	0x05,0xAF,0xBD,0xBA,0xAF,0x01,0x2B,0xCE,0x16,0x49,0x5F,
+	0x03,0xDF,0xF1,0x5D,0xD6,0xE8,0x64,0xB6,0x46,0x5E,0x07,
+	0x7D,0x50,0x26,0x73,0xC4,0xCA,0xAF,0x97,0xBF,0x11,0xE5,
+	0xFF,0x70,0x83,0x72,0xBE,0x02,0x90,0xF3,0xFE,0x98,0xC7,
+	0x47,0xFA,0x0C,0x0E,0xFD,0x44,0xF3,0x07,0x39,0x19,0xD5,
+	0x4D,0xE1,0xE9,0x14,0xC3,0x0A,0xF1,0x99,0x2B,0x60,0x8D,
+	0x78,0x9D,0x35,0x03,0x0A,0xAC,0xE7,0xB4,0xDF,0xA9,0x58,
+	0x21,0x72,0x17,0x52,0x8A,0x28,0x68,0xDA,0x1B,0x5A,0x80,
+	0x9F,0x47,0xC8,0x7F,0x68,0x5B,0x49,0xEB,0x04,0xA5,0xEC,
+	0x07,0x80,0xB1,0x67,0x32,0x21,0x59,0xB9,0x8E,0x71,0xDA,
+	0xC9,0x49,0xEF,0xB4,0x95,0x0E,0x8B,0xC4,0x58,0x44,0x0A,
+	0x84,0x69,0xD0,0xF0,0xC8,0xCB,0x29,0x31,0xEF,0xA6,0x3B,
+	0xD5,0xD6,0x88,0x84,0x20,0x4D,0xE6,0x2A,0x12,0xDE,0xE7,
+	0x85,0x6A,0x87,0x5E,0xB2,0x81,0x71,0x2E,0xB6,0x3D,0x6E,
+	0x8F,0x36,0x6B,0xAB,0x05,0xCD,0xDC,0x92,0xB3,0xE3,0xE2,
+	0x45,0x76,0x35,0x0F,0x80,0xB4,0xF6,0x16,0x4C,0xA8,0x41,
+	0xFB,0x8C,0x5C,0x13,0xC9,0x80,0x9C,0x3E,0xD0,0xDA,0xB7,
+	0xD9,0xDC,0x84,0xA4,0x36,0xCC,0x24,0x3A,0x39,0xAC,0x49,
+	0x65,0x98,0x9E,0xA4,0x5A,0x9E,0x5C,0x68,0xE5,0x34,0x9F,
+	0x7D,0xD4,0x11,0xFF,0x38,0xFA,0x5C,0x72,0x60,0x6F,0x79,
+	0xFF,0x63,0x8F,0x0E,0x76,0x86,0xE4,0xA3,0x7E,0x39,0x6E,
+	0xF2,0x48,0x77,0x17,0x15,0x65,0xAA,0x57,0x9E,0x0C,0xFF,
+	0xDC,0x5D,0xD0,0xF5,0x79,0xA0,0x7C,0xF0,0xA5,0xC7,0xD8,
+	0xE7,0xC1,0xA2,0x81,0x76,0x96,0xDE,0x98,0x5C,0x49,0x32,
+	0xFA,0x45,0xF3,0x30,0xA0,0xC5,0xB4,0xF1,0x55,0xF2,0xC5,
+	0x17,0x1E,0xC3,0x4A,0xD3,0x53,0x67,0x67,0x3F,0xBF,0x2D,
+	0x7A,0xBD,0xC2,0xD2,0x9B,0x95,0x2B,0x39,0x8B,0x9E,0x6C,
+	0x9E,0xF8,0xFF,0xE9,0xC1,0xD9,0x8B,0x93,0xEE,0x13,0x96,
+	0xBF,0x43,0x15,0x94,0x3E,0x50,0x08,0xC7,0x1B,0x19,0xF7,
+	0xB8,0x23,0x0D,0xF5,0xF4,0x58,0x94,0xFC,0x77,0x11,0x82,
+	0x59,0x51,0x43,0xBD,0x89,0x50,0x51,0xE4,0xD2,0xD0,0x22,
+	0x59,0xB9,0x80,0x70,0xED,0x08,0x21,0x35,0xE0,0x2F,0x38,
+	0x0C,0x15,0x4C,0xC8,0x00,0x35,0xBB,0x89,0xFE,0x38,0x9F,
+	0xD9,0x36,0xFF,0x72,0xCE,0xBA,0xFE,0x8B,0xF4,0xBF,0x98,
+	0xA0,0x92,0x4D,0xE1,0xE5,0xA1,0x2F,0x91,0x8B,0xAF,0x96,
+	0xEE,0xEB,0x2F,0x35,0x2F,0x0A,0x67,0x5F,0xAF,0xEB,0x38,
+	0x37,0xCC,0x47,0xD4,0xC1,0x48,0xA1,0xBD,0x64,0x9F,0xE7,
+	0x11,0x7A,0xFC,0xC4,0xE4,0xB3,0xF2,0x98,0x82,0x71,0xBF,
+	0xE2,0x68,0x91,0x5A,0xCB,0xE0,0xA8,0x2A,0x8A,0xCA,0xB1,
+	0x18,0x9C,0xC0,0xC6,0x93,0xB9,0x82,0x53,0xFB,0xD2,0x91,
+	0x26,0x31,0x76,0x91,0x99,0x42,0xFB,0x77,0x61,0xEB,0x2C,
+	0x6D,0xAF,0x4F,0x25,0x02,0xDE,0xC7,0x72,0x2C,0xD9,0x44,
+	0x25,0x5C,0x18,0x7F,0xE4,0x09,0x0B,0x26,0x6B,0x28,0xD2,
+	0x07,0xDC,0xEE,0x55,0xDB,0x71,0x4A,0x42,0x84,0xE6,0xEB,
+	0xD6,0x22,0x12,0xC8,0xF9,0x9F,0x56,0x88,0x41,0x68,0xA4,
+	0xCA,0x41,0x30,0x6F,0xB6,0x28,0x51,0x18,0xE3,0x80,0x01,
+	0xE9,0x0C,0x8D,0x6A,0x99,0x1F,0x09,0x56,0x78,0x8E,0x99,
+	0x7E,0xB2,0xCA,0x88,0x6D,0x55,0x12,0xB0,0x22,0xF8,0x87,
+	0x12,0x0A,0xD4,0x7A,0xF5,0xC1,0x38,0xE7,0x92,0xB1,0x4C,
+	0xA3,0x3D,0x41,0xB8,0x34,0x3D,0x71,0x3B,0x13,0x70,0x55,
+	0x1C,0xF8,0x80,0x00,0x94,0x0A,0x91,0xE5,0x9A,0x18,0x91,
+	0x76,0x7C,0x73,0x2F,0x76,0xDA,0xE2,0x35,0xA3,0x5E,0x1C,
+	0xBB,0xFB,0x6B,0xC1,0x88,0xEC,0x98,0x22,0xD5,0x2C,0x90,
+	0xED,0x2E,0x61,0x13,0x4B,0x8A,0x88,0xDA,0x50,0x11,0x9E,
+	0x57,0x6B,0x8A,0x04,0xA4,0x1E,0xC9,0x32,0x8F,0x86,0x80,
+	0x1C,0xA8,0x1C,0xEA,0xAB,0xB6,0x64,0x00,0x24,0x11,0x97,
+	0x98,0xD7,0x50,0x65,0x3D,0x0A,0xD8,0x2A,0xF7,0xFD,0x70,
+	0x72,0xEF,0x9F,0x3D,0xC4,0xEA,0x82,0x88,0x0E,0x7B,0x01,
+	0xC8,0xDA,0xE6,0xA8,0xFD,0x2D,0x8D,0xC2,0x32,0x48,0x4C,
+	0x81,0x04,0xFA,0xFF,0x8E,0x81,0x8A,0xB5,0xF2,0xA2,0x1A,
+	0x10,0xC4,0x1B,0x51,0x86,0x23,0xAE,0x1D,0x88,0xE4,0x90,
+	0xB4,0x05,0x2A,0x35,0x05,0x66,0xD6,0x48,0x70,0x7D,0x86,
+	0x6E,0x33,0x66,0x84,0x69,0xC8,0x80,0x38,0xBC,0x78,0xF0,
+	0xE5,0x10,0x1C,0xF2,0xBA,0x61,0xC7,0xF5,0xE5,0x10,0x87,
+	0x6A,0x2D,0x6C,0x56,0xF8,0xB0,0x4B,0xE7,0xAF,0xAC,0xDA,
+	0x2F,0x65,0xD9,0xEC,0xEA,0x74,0x8F,0x30,0x5D,0x19,0x52,
+	0xD0,0x69,0x11,0xC4,0xE6,0xE8,0x8E,0xD8,0x52,0xFB,0xBA,
+	0x80,0x2A,0xF6,0xE3,0xF0,0x65,0x1C,0x40,0xBA,0x6F,0xB0,
+	0x50,0xE7,0x03,0x40,0xF5,0x9E,0x90,0x64,0xA7,0x6E,0x49,
+	0xF4,0x71,0xBF,0x4B,0xD6,0x0F,0xBF,0x64,0xE2,0x9C,0xDE,
+	0x1E,0x76,0x22,0x0A,0xD9,0x09,0x04,0xD4,0x1E,0x54,0xEF,
+	0xE8,0x58,0x42,0xED,0xB6,0x55,0x1C,0x0C,0x00,0xA0,0xA9,
+	0x09,0xC0,0xBE,0x82,0xC9,0xF2,0x4C,0x50,0xB8,0x60,0xF2,
+	0xBE,0x69,0x8C,0xE2,0x86,0xA9,0xD1,0x28,0x7F,0x9C,0x93,
+	0x41,0xB1,0x3D,0x5A,0x9E,0x34,0xA2,0x31,0x05,0x25,0x07,
+	0x2A,0x17,0xD1,0xE5,0x3C,0x54,0x43,0x24,0xD3,0x84,0xA6,
+	0x88,0xF6,0x47,0x53,0x24,0x3F,0x46,0x7C,0x26,0xA4,0x50,
+	0xA7,0x44,0xAD,0xE3,0x61,0x6B,0x82,0x62,0x6C,0xF7,0x5C,
+	0xF6,0xDC,0x76,0x3C,0x20,0x0F,0x68,0xE2,0x1D,0x00,0xB5,
+	0x37,0xD7,0xDE,0x01,0x98,0x02,0x8E,0xC0,0x1B,0x7E,0x89,
+	0x25,0x9F,0x47,0x7D,0x68,0x8A,0xE1,0x30,0xED,0x02,0x2F,
+	0xBE,0xF9,0x4F,0x97,0x2F,0xC6,0x17,0xA8,0x1E,0x9A,0x73,
+	0x49,0xCF,0x02,0x38,0x15,0x63,0xCF,0x3F,0x84,0xDF,0x04,
+	0xC7,0x30,0x23,0x05,0x12,0xA0,0x31,0x2A,0xD7,0x48,0x37,
+	0xF8,0x62,0xA8,0x32,0x14,0x19,0xC4,0x50,0x0C,0x6E,0x48,
+	0xB8,0x07,0xE5,0xF7,0xB2,0xA2,0x40,0xE3,0x5D,0x50,0x03,
+	0x20,0x76,0x53,0xC8,0x33,0x13,0x9F,0xF1,0x77,0x4B,0xA9,
+	0x7A,0x5B,0x49,0x5A,0x83,0xC8,0x36,0xCD,0xB6,0x6A,0xAF,
+	0x80,0x29,0x78,0x32,0x60,0x22,0xD8,0x68,0x3D,0x64,0x06,
+	0x7F,0xBD,0xC6,0xF0,0x97,0x25,0x9A,0x12,0x5E,0xD2,0x0F,
+	0xCB,0x07,0x36,0x18,0x78,0x7A,0xDA,0x95,0xA2,0xE9,0x74,
+	0x98,0xE8,0x7A,0x4C,0xB8,0xE2,0xBF,0x69,0x46,0xF3,0xF6,
+	0x68,0x35,0x20,0xF9,0xDD,0xEE,0x61,0xE0,0x0E,0xC1,0xC3,
+	0x87,0x84,0x36,0x1B,0xB4,0x04,0xF7,0x3E,0x97,0x6C,0xFE,
+	0x45,0x7A,0xED,0x4A,0xC0,0xB7,0x9A,0x87,0xDB,0xEE,0xE2,
+	0x9B,0x24,0x83,0x14,0x8F,0xD8,0xBB,0xA0,0xEE,0x96,0x66,
+	0xDD,0x62,0x95,0xA4,0x54,0x31,0xEA,0x80,0x9E,0x52,0xD4,
+	0xD4,0xE9,0x67,0xC4,0x12,0x48,0xCE,0xB0,0xAE,0x44,0xF5,
+	0xE3,0x4F,0xA2,0x9A,0xA7,0x39,0x44,0xFB,0xF4,0x0F,0xCF,
+	0x95,0x21,0xC0,0x5B,0x46,0x98,0x7A,0x34,0x06,0xEA,0x54,
+	0x75,0x74,0x7A,0x57,0xEA,0xA4,0x43,0x42,0x0B,0x37,0x69,
+	0x5A,0x51,0x17,0xDD,0x08,0x9D,0x31,0x4E,0xFA,0x30,0x4B,
+	0x85,0x49,0x37,0x35,0xAB,0xC2,0xE5,0xB5,0xF5,0x5C,0x7D,
+	0x8D,0x99,0xB6,0xDE,0x1E,0x9C,0x80,0x9C,0xE4,0xD0,0x94,
+	0x6C,0xE1,0x07,0xBC,0x6C,0xF5,0x1A,0x9A,0x54,0xE1,0xD9,
+	0x7A,0xAB,0xFD,0x0D,0xD4,0x8A,0xF6,0x81,0xB3,0x9F,0x42,
+	0x36,0x0B,0xCE,0xD2,0xD5,0x3E,0x02,0x45,0x2C,0xEB,0x57,
+	0xEF,0x13,0x0A,0xFE,0x00,0x94,0x2B,0xF7,0x3D,0x61,0xCF,
+	0xF7,0x78,0x80,0x33,0x62,0xCE,0x19,0xA3,0xAF,0x68,0x9F,
+	0x95,0x0F,0x34,0x71,0x3C,0xB7,0xC6,0xEC,0x03,0x56,0xD2,
+	0xD9,0xE7,0x00,0x7D,0x5F,0x64,0xB6,0xDA,0xC6,0x37,0x32,
+	0xB4,0x68,0x0F,0x3F,0xA4,0x0D,0x91,0xC1,0xD6,0x1D,0x42,
+	0x75,0x78,0x15,0xFF,0x6E,0x5C,0x8D,0xD9,0x04,0x29,0x0F,
+	0x43,0x66,0xFF,0x17,0x90,0x0A,0x6D,0x1D,0xBF,0xC7,0x23,
+	0x3B,0xBB,0x8F,0x95,0x9A,0xE8,0x7F,0x28,0xC8,0xB4,0x5B,
+	0xF5,0x4A,0xD7,0x0C,0x88,0x84,0x31,0x0A,0xC8,0xA1,0xE1,
+	0x72,0x31,0x06,0xC2,0xA2,0x08,0x9C,0x81,0xFA,0x06,0xEC,
+	0xBC,0x05,0x89,0x0A,0x64,0xC7,0x10,0x8D,0x15,0x4B,0xC4,
+	0x2A,0xCA,0xC0,0xE2,0xED,0x5A,0x2B,0x4F,0x2A,0x12,0xCB,
+	0x72,0x06,0x32,0xAF,0x6B,0xC0,0x3B,0xF3,0xC0,0x63,0xED,
+	0x5E,0x05,0x8E,0x78,0xC4,0x88,0x88,0x65,0xE8,0x79,0xF9,
+	0x02,0xB0,0x18,0xAF,0x17,0xFE,0x4C,0x71,0xB8,0xE8,0xF1,
+	0x94,0x37,0x76,0x48,0xD5,0x13,0x46,0x1A,0x1F,0x3C,0x4B,
+	0x64,0x13,0x2E,0x92,0x3C,0x19,0x1E,0x88,0xDD,0xD2,0x0D,
+	0xAA,0xDA,0xF9,0xCE,0x3F,0xF5,0xDC,0xE6,0x69,0x9C,0x68,
+	0xBB,0xD9,0x44,0x4D,0xCB,0xDE,0xE4,0x7E,0x82,0x62,0xD7,
+	0x2B,0x90,0x72,0x5C,0x0A,0xCA,0xED,0xF6,0x55,0xF9,0x0B,
+	0x26,0xE0,0x53,0x1C,0x81,0x9C,0xE9,0xF6,0x4A,0x7B,0xAA,
+	0xE0,0xF1,0xC7,0x39,0xCD,0xCF,0x55,0xA6,0x88,0x69,0xB4,
+	0xF8,0x8D,0x28,0x2D,0x9C,0xDA,0x6F,0x0D,0x8A,0x19,0xEA,
+	0x9D,0xE2,0xBA,0xEC,0x7F,0x77,0xD3,0x15,0x46,0x0F,0x5D,
+	0x2E,0x7A,0x1E,0xEC,0x8F,0x88,0x34,0xA9,0x92,0xA4,0xAB,
+	0xE7,0xF5,0xBA,0x0F,0x1A,0xFB,0x84,0x4F,0x80,0x7D,0xAA,
+	0x1A,0xA5,0x88,0xD3,0x03,0x37,0x41,0x12,0x5B,0x5F,0xAD,
+	0x84,0x76,0xA5,0xC1,0x6E,0x90,0xAA,0x19,0x69,0x98,0x80,
+	0x7D,0xE6,0xE7,0x64,0x43,0x1D,0x48,0xA5,0x6B,0x4E,0xCC,
+	0x07,0xA2,0xAD,0xE1,0x1E,0xAD,0x22,0x6F,0x47,0x65,0xB5,
+	0x3A,0x8F,0xBF,0x11,0x10,0x3D,0x83,0xD6,0x75,0xA3,0x7D,
+	0xDA,0x31,0x5F,0x7B,0x1C,0x4B,0x50,0xA7,0x7D,0x03,0x3A,
+	0x5F,0xF1,0xAE,0xC9,0x61,0x50,0x01,0xD6,0x7B,0x80,0x5E,
+	0xA2,0xA7,0x09,0x72,0x87,0xA2,0x5C,0x2D,0xAC,0xFC,0x61,
+	0x95,0xA4,0x5C,0x2D,0xB3,0x11,0x09,0x57,0x3E,0x92,0xAD,
+	0x89,0x84,0x85,0x91,0xBA,0x80,0x54,0xA6,0xF0,0x33,0xEA,
+	0xCC,0xB6,0x17,0xCF,0xF0,0x30,0xAF,0x32,0xC0,0x31,0x89,
+	0xBD,0x98,0x6E,0x6E,0x3B,0x3E,0x29,0xAF,0x6E,0xA4,0x6C,
+	0xAC,0x11,0xA8,0xAC,0xBE,0x24,0x3C,0xCA,0xA1,0x9C,0xD3,
+	0x17,0x02,0x3B,0x27,0xAF,0x7F,0x00,0x26,0x3F,0xE7,0x9E,
+	0x7B,0x0D,0x5C,0xC3,0x9B,0xB0,0xF3,0xA2,0x3F,0x5C,0x5E,
+	0xE9,0x79,0x04,0xBC,0x6C,0x11,0x1B,0x10,0x1F,0x6D,0x1D,
+	0x93,0x4B,0x7B,0x28,0x3E,0x03,0x67,0xC6,0x87,0x08,0x79,
+	0xF7,0x7D,0x74,0xD6,0x85,0xC1,0x94,0xA7,0xA2,0xCD,0xCB,
+	0xF8,0x64,0xA8,0xA0,0x69,0x5F,0x3F,0xC0,0xFB,0xF0,0xD2,
+	0x8E,0xF3,0xD4,0x53,0xBB,0x45,0x71,0x7C,0x4C,0x92,0xE2,
+	0xE3,0xA0,0x7F,0xDD,0x7E,0xC0,0xE1,0x83,0x7D,0x00,0xBD,
+	0xBC,0x58,0x31,0xF5,0x47,0xF1,0x99,0xEC,0x65,0xDB,0x5D,
+	0xE4,0xA5,0xD7,0xB8,0x4E,0x19,0xCB,0xEA,0x59,0xB3,0x6D,
+	0x7C,0xD5,0xEC,0xFA,0x4A,0x7E,0x8A,0x59,0x1B,0x8C,0xAC,
+	0x8F,0x6B,0x3A,0x34,0x19,0x2D,0x6E,0x10,0xA1,0xD7,0x3D,
+	0x63,0xAF,0x7A,0xF1,0x50,0x34,0x72,0xC3,0x24,0x97,0x66,
+	0x95,0x17,0x2B,0xEB,0xC2,0xE9,0xAE,0xBE,0x6A,0x28,0xF2,
+	0xF6,0xE0,0x01,0xD6,0x23,0x39,0x6B,0x08,0xE9,0x9F,0x6D,
+	0x0D,0x3E,0xD1,0xCC,0x17,0x90,0x9E,0xD4,0x62,0x9D,0x20,
+	0xF4,0xF6,0xFE,0x23,0xAA,0x1A,0xA1,0x5B,0x96,0x62,0xD4,
+	0x92,0xE4,0xEF,0x32,0x9C,0x60,0x9A,0x3B,0xC0,0xE7,0xFE,
+	0xD0,0x7D,0x74,0x46,0x0A,0xCA,0xAD,0xB6,0x06,0xA9,0x10,
+	0xD9,0xE6,0x0F,0x7C,0xDA,0xC1,0x27,0xC1,0x20,0x82,0xAB,
+	0x34,0x03,0x90,0xAB,0x73,0xEF,0x2D,0x0B,0x9F,0xFB,0xE9,
+	0x4B,0xB4,0xD1,0xFF,0x95,0x70,0xA5,0x51,0x49,0x2E,0xD0,
+	0xF6,0x63,0x14,0x10,0x15,0x11,0x10,0x11,0x15,0x70,0x22,
+	0x45,0x44,0x1C,0x72,0x2C,0x40,0x45,0x73,0xCA,0x9C,0xCD,
+	0x21,0x51,0x70,0x44,0x31,0x70,0x4A,0xAD,0x70,0x2A,0xA7,
+	0xBA,0x6A,0x37,0x2B,0x1B,0xAE,0xD9,0x5C,0x5A,0x66,0x69,
+	0x66,0x75,0x53,0x33,0x73,0x2C,0x2D,0x33,0xD4,0x34,0xB3,
+	0x6E,0xD7,0xB1,0xD1,0xCC,0x26,0x7D,0xF7,0xBD,0x77,0xF6,
+	0x5A,0x7B,0xED,0x3F,0x7B,0x9D,0x75,0xD6,0xDA,0x3F,0xCE,
+	0xF9,0x73,0x7E,0x81,0x62,0x78,0x46,0xAA,0x1B,0x4C,0x2F,
+	0xA8,0x4C,0xB3,0x39,0x43,0xD1,0x48,0x74,0x9F,0x85,0x59,
+	0xEF,0x2B,0x60,0xD4,0xFD,0xB2,0xED,0x76,0x23,0x2D,0x40,
+	0x0D,0xD2,0xFA,0x4A,0x0B,0x5F,0x3F,0x82,0x14,0xD2,0xCA,
+	0xD6,0x36,0xE2,0x3A,0x5E,0x12,0x33,0x12,0x2F,0x6F,0x3B,
+	0x99,0x5B,0x36,0xF2,0x05,0x8C,0x7C,0x8A,0x86,0x56,0x45,
+	0x4C,0x50,0xA7,0x21,0xB5,0xAF,0xCB,0x17,0x5E,0x39,0xBD,
+	0x33,0x8A,0xD5,0x08,0x9F,0x91,0xB3,0xDE,0xF2,0x5F,0x42,
+	0x96,0x0D,0x7B,0x97,0x69,0x05,0x6A,0x50,0xF5,0x23,0x2F,
+	0xE5,0x6B,0xB1,0xF3,0xD3,0x08,0xFE,0x7C,0xE9,0x10,0x98,
+	0x3F,0x9A,0xA1,0x8E,0xCA,0x70,0xD7,0x0E,0xB3,0xC0,0xB8,
+	0x3D,0x1B,0xCF,0xC3,0x20,0xBA,0x9F,0x20,0x87,0xF0,0x6E,
+	0xFD,0x7F,0xEB,0x2F,0x20,0x06,0x1F,0xDD,0xDA,0xB0,0xA0,
+	0xE1,0x0E,0x9F,0x5C,0x54,0x59,0x84,0xC6,0xDE,0x79,0x6F,
+	0xBD,0xA8,0xB7,0xB6,0x6A,0xB9,0xA8,0x7F,0x43,0x1B,0xAE,
+	0x97,0xB4,0x14,0x20,0x26,0x04,0x75,0x68,0x5D,0xBB,0x87,
+	0xFD,0xC8,0x5B,0x3A,0xDC,0x52,0x36,0xC5,0xA0,0x27,0x9F,
+	0xD6,0xB0,0x0A,0x34,0x1E,0xA2,0x21,0x5A,0x28,0xA8,0xD4,
+	0xBB,0x7F,0xDE,0xAA,0x6B,0x22,0x37,0x5C,0x84,0x16,0x26,
+	0x56,0xB4,0x5D,0xEB,0xC6,0x51,0xFD,0x6D,0x55,0xD4,0x5E,
+	0xDC,0x46,0x1B,0x92,0xDF,0x58,0x3C,0x3B,0xE8,0x56,0x5C,
+	0xBD,0x5A,0x2F,0x3E,0x0A,0xB8,0x16,0x45,0xD6,0x5E,0x3F,
+	0x8A,0x83,0x8F,0x31,0xB4,0x48,0x3E,0x97,0x9D,0xF0,0x07,
+	0x88,0x1D,0x78,0xF9,0xC5,0x68,0x7A,0xC2,0x29,0x82,0x7E,
+	0x00,0x64,0xED,0x32,0xC7,0x3F,0xF2,0xE4,0x45,0x56,0xD5,
+	0xFE,0x7A,0x50,0xE2,0x01,0x01,0x80,0xA3,0xDC,0xCE,0x45,
+	0x2D,0xA8,0x61,0x10,0x33,0x92,0xB6,0xAE,0x05,0xC0,0xB7,
+	0xFA,0xCC,0x31,0x9F,0xC3,0xF3,0x63,0xE0,0x57,0x63,0x0E,
+	0xAD,0x11,0xB3,0x46,0xEF,0x1F,0x7D,0x49,0x04,0x19,0xD2,
+	0xCB,0xB3,0x18,0x30,0x64,0xF6,0x6D,0x70,0x3D,0x22,0x61,
+	0xAC,0xC5,0xAF,0xD6,0x2B,0x5B,0x6B,0x4A,0x8A,0xA6,0x31,
+	0x1E,0x3B,0xA2,0x61,0x95,0x67,0x6F,0xA5,0xAB,0xC0,0xDD,
+	0x31,0x58,0xAA,0x01,0xA4,0x64,0x94,0x80,0x26,0x5E,0x9E,
+	0x1F,0x87,0xB5,0x5F,0xC4,0xBB,0x53,0xD3,0x79,0x51,0x4D,
+	0x63,0x9A,0x06,0xF7,0xBE,0x19,0xD6,0x94,0x24,0x17,0x42,
+	0x57,0x69,0xEE,0x30,0xCD,0x1A,0x3A,0x9E,0xB2,0x75,0x8E,
+	0x01,0xDB,0xD6,0x3A,0x67,0x0B,0x4D,0xC2,0xA9,0xE8,0x39,
+	0xD6,0xC8,0x5C,0x66,0x9E,0x79,0xDB,0x8C,0x10,0xAC,0x53,
+	0x34,0x02,0xF0,0x9C,0xC3,0xEE,0x07,0xA8,0xF7,0x5D,0xBC,
+	0xD5,0x31,0x17,0x17,0x3E,0x69,0x68,0x68,0xDB,0x65,0x3A,
+	0x4C,0xD8,0x8A,0x52,0xDD,0xE2,0x7A,0x55,0x89,0xC5,0xEF,
+	0xB0,0x54,0xA9,0x0C,0x37,0xF2,0x57,0xF6,0x8F,0xD2,0xC3,
+	0x15,0x9B,0x27,0x74,0x80,0x4C,0x39,0xED,0xED,0x35,0xF7,
+	0x37,0x2D,0x6A,0x0E,0x61,0x58,0xED,0x8B,0x6A,0x15,0xB3,
+	0x6B,0x4E,0x9A,0x40,0x46,0x4A,0x3F,0xCB,0xF3,0xA0,0x6F,
+	0x14,0xD3,0xC6,0xD7,0x04,0xBB,0x94,0x9E,0x81,0x1F,0x87,
+	0x92,0xCD,0x31,0x21,0x1F,0x54,0xD1,0x51,0x33,0x1E,0x83,
+	0x75,0xD5,0x75,0x4D,0x17,0x42,0x67,0xD8,0x12,0x29,0x26,
+	0xF8,0x36,0xF5,0x3F,0x3A,0x42,0x79,0x8C,0x99,0xF4,0x95,
+	0x9A,0xEC,0x53,0x9E,0x04,0x67,0xEA,0x3E,0xBD,0x8F,0xB1,
+	0x51,0xD3,0xDE,0xA8,0xAA,0x76,0x43,0xA5,0x05,0x3D,0x1F,
+	0xD9,0x6F,0xDB,0xE4,0x4B,0x7F,0x35,0x7E,0x91,0x2A,0x45,
+	0x03,0x52,0x8C,0x8B,0x02,0xDB,0x1A,0x8C,0xFD,0x2F,0x82,
+	0x10,0xAC,0x01,0x1B,0xEB,0x86,0xA5,0xF4,0x62,0xA5,0xCF,
+	0x39,0x6C,0x2C,0xDF,0x92,0x5D,0x41,0xD0,0x22,0x50,0x2B,
+	0x34,0x55,0x09,0x5B,0xFE,0x53,0x9A,0x90,0x1E,0x80,0x10,
+	0xA8,0x20,0x9C,0xD2,0x24,0x22,0xAC,0xD1,0x44,0x79,0x2F,
+	0x11,0x4D,0xAC,0xEC,0x21,0xB2,0x89,0x91,0x56,0x04,0x4E,
+	0xD1,0x0C,0x77,0xFF,0xF1,0x4F,0xF2,0xAD,0x44,0x10,0xEF,
+	0xA0,0x19,0x2C,0x19,0x45,0xB1,0xAF,0xDF,0xD2,0x53,0x60,
+	0x7D,0xEA,0x3C,0xB9,0x4E,0x77,0x89,0x1F,0x43,0x28,0x74,
+	0x8F,0x2A,0x4A,0x3F,0x41,0xF6,0x90,0x7E,0xDA,0x04,0xCB,
+	0x38,0x2A,0x25,0xED,0x01,0x4B,0xB1,0xC5,0x98,0xD2,0xAF,
+	0x52,0x3B,0xFC,0x8F,0x19,0x29,0x9B,0xBA,0x4B,0xB5,0xFD,
+	0x53,0x02,0xB2,0x31,0x1C,0x33,0xB0,0xCB,0xC6,0x68,0xFA,
+	0x18,0x60,0xD0,0x47,0xC5,0x26,0x15,0xF3,0xC6,0x17,0x25,
+	0x6D,0xC7,0x4D,0x45,0x70,0xFD,0x81,0x1B,0x78,0x41,0x63,
+	0x5E,0x2B,0x79,0x49,0x69,0xBE,0xD0,0x7F,0x35,0xE3,0x47,
+	0x30,0xF6,0x75,0x0B,0x13,0xAB,0x78,0xEE,0x58,0xE3,0x43,
+	0xD8,0xA5,0x3C,0xA4,0x65,0xFF,0x71,0xCE,0xF1,0x07,0x3C,
+	0x74,0xD8,0x70,0x68,0x90,0x8A,0x70,0xF2,0xAB,0xD4,0xBB,
+	0xA3,0x41,0x4F,0xD7,0x16,0xE8,0xB2,0xBA,0xA4,0x27,0x37,
+	0x74,0x2A,0x2D,0x7F,0xE7,0x77,0x17,0x2F,0x33,0xB2,0xFA,
+	0x0B,0xBF,0x1B,0xD3,0xF0,0x06,0x59,0x96,0x4F,0x0B,0x57,
+	0xF5,0x95,0xFC,0x8B,0x3D,0xBE,0xBF,0xAE,0xB9,0x3D,0x35,
+	0x45,0xFD,0xAE,0x5C,0x75,0xD2,0xA8,0x69,0x17,0x9C,0x17,
+	0x52,0xFA,0x6A,0xCF,0x0D,0xC2,0x42,0x2B,0xA6,0xF0,0xDB,
+	0x20,0x1A,0x35,0x91,0x16,0x26,0x78,0x49,0xF1,0xA8,0x49,
+	0x52,0x0D,0xB3,0xB5,0x22,0x5C,0x8F,0xC6,0x7E,0x3B,0x1B,
+	0x1A,0x79,0x29,0x87,0xB1,0xED,0x88,0xBB,0x81,0x7D,0x7E,
+	0xBF,0x35,0x2E,0xE8,0x0B,0xF8,0xF2,0xA1,0x4D,0xBA,0x7B,
+	0x51,0xF5,0xA7,0xDF,0x3A,0x9A,0xCE,0x20,0x16,0xB4,0x73,
+	0x3D,0x3D,0x61,0xF8,0x90,0xCA,0x90,0xBF,0x32,0x17,0xD2,
+	0x66,0xE6,0x4C,0xA0,0x9C,0xEA,0x66,0xDF,0xBC,0x8B,0x93,
+	0x30,0x83,0x29,0xC6,0x4B,0xB7,0xB3,0xC0,0x8D,0x31,0x98,
+	0x91,0x67,0x9F,0xE6,0xB0,0xDF,0x77,0x97,0xD5,0xE9,0x92,
+	0xC8,0x99,0x46,0x7A,0x43,0x5B,0xC2,0x71,0x88,0xB2,0x10,
+	0x15,0x8F,0x61,0x68,0xA9,0xCD,0xA5,0x5E,0x84,0xB8,0xD8,
+	0xB8,0x16,0x72,0xEE,0x95,0xD2,0xF0,0xB5,0x96,0xCE,0xF8,
+	0x28,0x20,0x39,0xE0,0x60,0xF5,0xA4,0xCA,0x49,0x52,0x14,
+	0x19,0xED,0x57,0xAE,0x0A,0xF0,0x9D,0xBC,0x70,0xE0,0x8A,
+	0x26,0x19,0x69,0x46,0x3E,0x86,0x7A,0xCB,0xDB,0x7D,0x31,
+	0x43,0xBE,0x39,0x1A,0x5D,0x79,0x50,0xA7,0xD3,0x2A,0xB4,
+	0xD2,0x6C,0x72,0xFE,0x0C,0x78,0x6E,0x98,0x03,0x2B,0x4E,
+	0x3C,0xED,0xC0,0x8C,0x48,0x0A,0x31,0x52,0xC1,0x5B,0x1B,
+	0x83,0xF3,0x4E,0x4B,0xCF,0x86,0xC5,0x56,0x84,0xDF,0x04,
+	0xE0,0x7B,0x15,0xBB,0xC1,0x29,0x6E,0x56,0x0C,0xCF,0xA2,
+	0x62,0x9B,0x9E,0x3D,0x7D,0x7B,0x5D,0xF4,0x7A,0xE2,0xA2,
+	0x08,0xDA,0x71,0x81,0x5A,0xBF,0x6A,0xB1,0x51,0xB6,0xB6,
+	0x83,0xBB,0x1C,0x19,0x2B,0x37,0xA1,0x7E,0x88,0x21,0x4D,
+	0x8A,0x2A,0xF9,0x7E,0xD6,0x19,0x10,0xBD,0x72,0x5B,0x99,
+	0xE5,0xD5,0xD0,0xDD,0x5E,0x4E,0x03,0x3E,0x6A,0x2E,0x9A,
+	0x8E,0x91,0x79,0x62,0x4F,0x95,0x81,0xED,0x3E,0x45,0xF5,
+	0x93,0x47,0xD4,0x8A,0x35,0x1D,0xCF,0xE4,0xA1,0x26,0xC7,
+	0xD3,0xB7,0x03,0xC5,0xB3,0x25,0x27,0x54,0x7F,0x21,0x3A,
+	0x06,0x2A,0x3E,0x86,0x44,0xA0,0x1F,0x97,0xBF,0xCE,0xF3,
+	0x49,0x73,0x2B,0xD0,0x2A,0xE4,0xCC,0x2E,0xA1,0x8F,0x57,
+	0x04,0x9B,0x51,0xD8,0xC7,0x31,0xD0,0xC8,0xDB,0x98,0x61,
+	0x86,0xA4,0x2A,0x66,0x21,0x07,0x59,0x51,0xBE,0x4C,0x2D,
+	0x8F,0xB1,0xBD,0xA4,0x35,0x3E,0xE8,0xB0,0x31,0x4A,0x18,
+	0xB6,0x19,0x58,0xEE,0x07,0x15,0x6F,0xD4,0x93,0x42,0x40,
+	0x48,0x69,0x7D,0xF5,0x8F,0xB9,0x0F,0xBF,0xE4,0x98,0x89,
+	0x4F,0xFB,0x81,0x43,0x9D,0xBB,0xFF,0x5B,0xD3,0xD1,0x33,
+	0x80,0x5E,0x57,0x5A,0x7D,0x32,0x45,0xA9,0xCC,0xC7,0xD5,
+	0xB9,0x28,0xA8,0x2C,0x82,0xA2,0x2F,0xB2,0x60,0xF6,0x43,
+	0x89,0x59,0x2C,0x08,0x4B,0x65,0x16,0x5D,0x11,0x79,0xEE,
+	0xB0,0xF3,0xDF,0x3B,0x4A,0x8C,0x5C,0x97,0x4A,0x82,0x75,
+	0xC7,0x90,0x2A,0xEC,0x2D,0xB0,0xB7,0xBB,0x40,0xFB,0x94,
+	0x02,0x21,0x3A,0x8D,0xDF,0xEB,0xA9,0x26,0x34,0x6C,0xF1,
+	0x4C,0x90,0xC3,0x28,0xD9,0x82,0x23,0x4E,0x35,0xDF,0xA2,
+	0xB9,0x1D,0xB6,0x5E,0x8B,0x93,0xEC,0x53,0xAC,0xFF,0x15,
+	0x52,0x4B,0xC4,0x2A,0x78,0xB3,0x93,0xEB,0xEC,0x82,0xE5,
+	0x35,0x58,0xEE,0x80,0x7A,0x75,0x8B,0xC5,0x60,0xA0,0xC6,
+	0xFB,0x50,0xAC,0xBB,0x46,0xB8,0x95,0x2A,0x08,0x3E,0x1D,
+	0x8C,0xC4,0xA0,0xB6,0x4F,0x06,0xE4,0xB6,0xFB,0xB6,0x1F,
+	0x53,0xF6,0x83,0xCD,0x07,0xD0,0x3C,0xD8,0x95,0xFA,0xEE,
+	0x27,0x30,0x42,0x03,0xF6,0xFA,0xCE,0x19,0xD7,0x6F,0xB7,
+	0xD2,0x6A,0x04,0x51,0x25,0x80,0xCB,0x33,0x67,0x45,0xCF,
+	0xAA,0xD2,0x2D,0x33,0x05,0xC6,0x18,0xE5,0x23,0xEC,0x6E,
+	0xB2,0x38,0xBA,0xCE,0xF7,0xC5,0xF6,0x77,0x1E,0x55,0x12,
+	0x3B,0xEE,0x02,0xE9,0x9C,0xC5,0x0C,0xE7,0x1E,0xC7,0x54,
+	0x6A,0xCE,0x4B,0x0B,0xCB,0xC5,0x9D,0x46,0xEA,0x6C,0x21,
+	0x34,0x33,0xC8,0x9B,0xA7,0xDF,0xE6,0xF2,0x38,0xFE,0xB1,
+	0xCD,0x0B,0xCC,0xF6,0xB7,0xAA,0x23,0xA1,0x90,0x19,0x5D,
+	0x0B,0x30,0x96,0xF9,0xE6,0x6E,0xEF,0x94,0x3A,0xD8,0xBB,
+	0x7E,0x16,0x7D,0x69,0xC6,0x0C,0xFB,0xD8,0x43,0x1F,0x3D,
+	0x4C,0x69,0xF7,0x90,0xB7,0x9F,0x9E,0xAC,0x55,0x5E,0x97,
+	0x67,0xAF,0x50,0x76,0x43,0xBB,0x79,0x5D,0x2B,0x9B,0xF5,
+	0xA8,0x1F,0xE3,0x34,0x3E,0xEB,0x7F,0x76,0x84,0xD4,0x5B,
+	0x85,0x04,0x0C,0xEB,0xBE,0xD8,0x0F,0x4B,0xCF,0x37,0x0D,
+	0xDD,0x68,0xE6,0xB6,0xF9,0x85,0x45,0x09,0xD2,0x5A,0x23,
+	0xCA,0x0A,0x5B,0xB4,0xF3,0xCE,0x36,0xC1,0xE9,0xA8,0xFC,
+	0xD6,0x1D,0xBC,0xE3,0xC4,0x5A,0xF6,0x00,0x73,0xDA,0x2C,
+	0xEF,0xD1,0x6F,0x80,0x0B,0x56,0x1A,0x57,0x37,0x43,0x10,
+	0x11,0x93,0x34,0xDE,0xD1,0xC5,0x20,0xAD,0x7A,0xF7,0xC3,
+	0x68,0x95,0x72,0x7D,0x40,0x1F,0x4B,0x16,0x99,0x24,0x5C,
+	0x81,0xCF,0xFD,0x79,0x0E,0x17,0xBA,0xE6,0xD0,0x8D,0x83,
+	0xA4,0x71,0x41,0x80,0xA8,0xC8,0xCC,0xAD,0xF1,0xBE,0x58,
+	0x69,0x17,0xC8,0x80,0x8D,0xCE,0x84,0xC1,0xAD,0x35,0x8A,
+	0x76,0x52,0x25,0x35,0xD5,0x73,0x3E,0xC3,0x2A,0xF3,0x20,
+	0x9E,0xEF,0x90,0xCB,0x51,0x15,0x79,0x15,0x15,0x89,0x28,
+	0x7C,0xEE,0xA4,0x17,0xB1,0x51,0x2C,0x1A,0xAA,0x67,0x34,
+	0x18,0x06,0xC9,0xCF,0x02,0xAB,0xCA,0x0B,0x7D,0xE5,0xC7,
+	0x87,0xB3,0x4B,0x19,0x2F,0x8A,0xD7,0x74,0xD9,0x67,0x28,
+	0xEC,0x07,0x06,0xB0,0x2C,0x47,0x57,0x2C,0x44,0x1F,0xFD,
+	0xE8,0xD8,0x94,0xF1,0x0A,0xBF,0x74,0xEE,0xCE,0xA3,0x53,
+	0x90,0x30,0xE5,0xA9,0x80,0x17,0x8F,0x0F,0x23,0xE4,0xBA,
+	0x7E,0xAF,0xE8,0x6A,0xAC,0x93,0xD3,0x57,0xD5,0xF5,0x27,
+	0xAB,0xC1,0x38,0x4A,0x60,0xDA,0x2A,0x78,0x9B,0xFC,0x79,
+	0x34,0x58,0x27,0x29,0xE6,0x84,0x7F,0x2B,0x24,0x88,0x97,
+	0x58,0x52,0x77,0x7C,0xDB,0x44,0x25,0x70,0xDF,0xC5,0x31,
+	0x7D,0x93,0x46,0xB0,0x9F,0xA6,0xEC,0xC9,0xF3,0x91,0x78,
+	0x28,0xCB,0x04,0x83,0x57,0x7C,0x58,0x23,0x16,0x7E,0x83,
+	0x70,0xFE,0x58,0x35,0xD7,0x5A,0xB8,0xE1,0xE8,0xD4,0x63,
+	0xAB,0xA5,0x11,0x5D,0xA5,0x05,0xFF,0x73,0x94,0xFC,0x0D,
+	0x7B,0x45,0x7F,0x6E,0xD3,0xC3,0x09,0x6D,0x2B,0xFD,0x77,
+	0xDB,0x0E,0xA5,0xD8,0xA0,0x38,0x43,0x90,0x7A,0x37,0x56,
+	0xC8,0xFC,0x56,0x3F,0xE8,0xEB,0x3A,0x1C,0x77,0xED,0x16,
+	0xFE,0x5F,0x21,0x18,0x41,0xB2,0x6B,0x04,0x94,0x2E,0x00,
+	0x71,0x29,0xB5,0xD4,0xFC,0xDE,0x92,0x26,0x92,0x18,0x1F,
+	0xFA,0xD3,0x46,0x86,0x9F,0xBF,0xA4,0xD5,0xD8,0x7B,0x3E,
+	0xA0,0xC7,0x4F,0xF8,0x6B,0xEC,0x0E,0x77,0x31,0x74,0xAD,
+	0x95,0x7C,0x1E,0xF4,0x04,0x51,0x73,0x72,0xFA,0x57,0xC7,
+	0x9F,0xA0,0x13,0x0F,0x0F,0xF7,0xE8,0xF0,0x97,0xB6,0x45,
+	0x80,0x2A,0xBB,0x98,0xD4,0x26,0x87,0x10,0x9B,0x47,0x01,
+	0x29,0xF5,0x0F,0xFF,0x05,0xFC,0xCA,0x4A,0x95,0x1F,0x2C,
+	0x20,0x2F,0x68,0x77,0x33,0xA2,0xB8,0x12,0x47,0xBB,0x52,
+	0xDE,0x54,0xDB,0xD1,0x80,0xC7,0x81,0x40,0xFE,0x19,0x79,
+	0x88,0xBE,0x16,0x5E,0x7E,0x87,0x2E,0x83,0xC3,0xEE,0xC0,
+	0xD2,0x55,0xA8,0x1D,0x2E,0x02,0xCB,0xBC,0x43,0xDB,0x6D,
+	0xBA,0x36,0x23,0xEA,0xC7,0x3A,0xB9,0x3D,0xEF,0x34,0xDE,
+	0xE9,0xFF,0x07,0x8A,0xF4,0x9D,0x17,0xE4,0xE2,0xA6,0xB3,
+	0x9E,0xD8,0x51,0x26,0x1D,0x73,0x59,0xB9,0xFD,0xEA,0xAF,
+	0xD8,0xC4,0x7B,0x65,0xD4,0x55,0xD4,0x57,0xB2,0x16,0x82,
+	0x00,0x44,0x9D,0x13,0x5D,0x93,0x63,0x8F,0x18,0x70,0xE7,
+	0xA4,0x03,0xCF,0xB1,0xA7,0x1C,0xF8,0x41,0x3D,0xA2,0x29,
+	0x91,0x93,0x1C,0x33,0xC3,0x99,0x55,0x67,0xBE,0xA8,0xD4,
+	0x3D,0xAB,0x79,0xC1,0x9A,0x47,0x22,0x3C,0x30,0x3A,0x21,
+	0xDF,0x93,0x94,0xB1,0x4E,0xF5,0x50,0x07,0x16,0x2B,0x2C,
+	0x85,0x6F,0x0E,0xB8,0x6E,0x1F,0x06,0xDC,0x97,0x31,0x54,
+	0x92,0x1F,0x86,0x6A,0xC1,0x46,0xA2,0x6F,0x8E,0x9E,0xAE,
+	0xFD,0x7A,0x14,0x7C,0xB4,0x67,0x18,0x5C,0xA2,0x47,0x9B,
+	0xA9,0xB5,0xF0,0x3A,0xA4,0x53,0x81,0x7F,0x2D,0xDB,0xDC,
+	0x15,0xB3,0x35,0x1B,0x7A,0x02,0x69,0xC0,0xF7,0x82,0xF6,
+	0x84,0xA1,0x7D,0xC4,0xE6,0x8B,0x15,0x4E,0xA6,0x4D,0xFF,
+	0x0C,0x9B,0x95,0xAA,0x77,0x2E,0x63,0x87,0xCD,0x05,0xEB,
+	0x44,0xB6,0x3E,0x8B,0x6E,0x05,0x32,0x38,0x43,0x3A,0x85,
+	0xA7,0x21,0x1A,0xCF,0x6F,0x3A,0x83,0x26,0xA9,0x64,0x2F,
+	0xA9,0x92,0xFE,0xEF,0x99,0x01,0x7D,0xA7,0x13,0x74,0x31,
+	0xD1,0x03,0x2C,0xF6,0xB6,0x21,0xA7,0x71,0xB7,0x35,0x96,
+	0x90,0x94,0xEC,0xB8,0x24,0x75,0xEA,0x7C,0x33,0xBE,0x01,
+	0xA2,0xA3,0x7E,0xEA,0xE8,0x75,0x50,0x12,0x0E,0xAF,0xE2,
+	0x3E,0x65,0x12,0x3E,0x84,0x26,0x35,0xC0,0x8E,0xA9,0x16,
+	0xA6,0x2B,0x82,0x82,0x29,0x17,0xC7,0xB2,0x8B,0xA8,0x78,
+	0x96,0xF4,0xEF,0x2F,0xCA,0x7B,0xE0,0x0B,0xF4,0xD9,0x7D,
+	0x22,0xD6,0x28,0xDA,0x75,0xCB,0xE3,0xE8,0xC8,0x33,0x9C,
+	0x05,0x05,0x85,0xC1,0x04,0x26,0x4C,0x1B,0x05,0xF7,0x13,
+	0x0B,0xCD,0x6E,0xEE,0xEF,0x3E,0xDD,0x86,0xF9,0x82,0x0D,
+	0xD3,0xD6,0x8F,0xC5,0xC6,0xAB,0x50,0x73,0x5F,0x0D,0x62,
+	0xF4,0xB1,0x2C,0x67,0xCD,0x26,0xED,0x4F,0x30,0xDE,0x08,
+	0xE9,0x92,0x97,0x61,0xE5,0xFC,0xC5,0xE4,0x60,0x30,0xD8,
+	0x1F,0x49,0x67,0x1F,0xE3,0xF0,0x6A,0xC2,0xF7,0xFE,0x99,
+	0x95,0xE6,0x0D,0x68,0x2B,0xA5,0x63,0x13,0x61,0x7F,0x2E,
+	0x6E,0xD7,0x7E,0xEB,0xCE,0x87,0x3C,0x06,0x7F,0xD4,0x84,
+	0x9A,0x29,0xE0,0x3F,0xB4,0x32,0xD4,0xC0,0x93,0x81,0x9C,
+	0x63,0x9F,0x74,0x41,0x2D,0xD3,0xEA,0x3A,0x37,0xE8,0x95,
+	0xA0,0x40,0xC3,0xF9,0xE7,0x88,0x7D,0x96,0x60,0xCC,0x26,
+	0xB8,0xCC,0x79,0x2A,0x61,0x7D,0x33,0xAA,0xDE,0x71,0x5A,
+	0xFD,0x62,0xA7,0xA5,0x2B,0xE7,0xDA,0x0B,0x32,0xB2,0xB8,
+	0x3C,0x7F,0x04,0xDA,0xD4,0x84,0x25,0x4C,0x3A,0xA3,0x41,
+	0x9C,0xAA,0x2F,0xFD,0x79,0xA0,0xFF,0x8E,0xF2,0x67,0x80,
+	0xC3,0x29,0x60,0x4D,0x4B,0x15,0x1F,0xBC,0xCF,0x07,0xFC,
+	0xFD,0x47,0x08,0x0C,0x54,0x13,0x81,0xE8,0x2A,0xC1,0x0D,
+	0x59,0x63,0x5D,0x8B,0xA4,0x8D,0xD6,0x1D,0xD8,0x06,0x52,
+	0x9E,0xE7,0x98,0x51,0xD6,0x2B,0xC8,0xEA,0xB8,0x6A,0x04,
+	0xF7,0x18,0xA8,0x71,0x83,0xBA,0xBA,0x81,0x66,0xA3,0x1B,
+	0x1C,0x94,0x9A,0xB7,0x95,0xAC,0x57,0x65,0xD6,0x18,0xE0,
+	0x7E,0x9F,0x48,0xAF,0x5A,0x9B,0xDF,0x98,0xEF,0xDC,0x34,
+	0x94,0x86,0x8B,0x0A,0x17,0xCB,0xF0,0x5C,0xA1,0x92,0x5C,
+	0x9D,0x29,0x8A,0x9B,0xC7,0x1E,0xAB,0x13,0x9F,0xF7,0x41,
+	0x41,0xE1,0xDF,0x1C,0xD7,0x32,0x5B,0x4E,0xDB,0x65,0x64,
+	0x5E,0x8B,0xF7,0x46,0x3F,0xBD,0x00,0x12,0x94,0x98,0x15,
+	0xE6,0x76,0xF3,0x73,0x9D,0xE1,0x86,0x26,0x05,0x7D,0xB6,
+	0xA0,0xB0,0x48,0x75,0xA7,0x50,0xE5,0x1F,0xC3,0x33,0xC3,
+	0x43,0x25,0xCF,0x08,0x65,0xE1,0xAA,0x15,0xBD,0x17,0xDA,
+	0x6B,0x39,0x35,0x7A,0x55,0x3D,0xA6,0xC5,0xB4,0xD3,0xDB,
+	0xCD,0xFE,0x64,0xD4,0x96,0xBC,0x58,0xC4,0x44,0xD4,0xE0,
+	0x38,0xFB,0x5C,0x13,0x53,0xE9,0x16,0x09,0x82,0x0F,0x6D,
+	0xAA,0x9F,0x35,0x3C,0x31,0xA5,0xE5,0x1D,0x60,0x2C,0xA7,
+	0xEE,0xEF,0xFC,0x56,0x6B,0xA0,0x0D,0x32,0x0E,0x05,0x37,
+	0x9E,0x61,0x29,0x93,0xAD,0x4E,0x82,0x0E,0x53,0xE5,0x1C,
+	0xF2,0x1B,0xD9,0x33,0xCB,0xB3,0xBF,0xCF,0xE2,0xB6,0x7A,
+	0x2F,0x14,0x6E,0x8B,0x63,0xEA,0x0E,0xE5,0xFC,0x19,0xDF,
+	0xC5,0x85,0x16,0x4E,0xEC,0xE9,0x83,0x6F,0xC1,0x07,0x44,
+	0x88,0x90,0xB4,0xB2,0xEF,0xAE,0x0A,0x9D,0x23,0x40,0x7B,
+	0xCE,0xCA,0x42,0x7C,0x4C,0x7C,0xE9,0x43,0x03,0x79,0x42,
+	0xCE,0x5A,0x47,0x92,0x9A,0x45,0x10,0x14,0x31,0x1F,0x82,
+	0x81,0xE5,0xAA,0xCE,0x76,0xFF,0x86,0xA2,0xBF,0x4F,0x04,
+	0xA9,0x07,0x06,0x6F,0x2D,0xA6,0x39,0x87,0x13,0xFF,0x41,
+	0x83,0xE5,0x9F,0xE0,0x04,0xD2,0xD3,0x77,0xD4,0x8F,0x48,
+	0x07,0x42,0xA2,0x63,0x3E,0xE1,0x30,0xC1,0x13,0x34,0xB3,
+	0x82,0xD9,0x80,0xD6,0xCB,0xCC,0xC1,0x14,0x25,0xD1,0x74,
+	0x5D,0x7D,0x43,0x1D,0x03,0x28,0xF9,0x34,0x0C,0x89,0x9C,
+	0xA4,0x64,0x8C,0x9F,0xA7,0x1B,0x17,0x55,0x22,0x1E,0x2D,
+	0x9C,0xB5,0xFE,0xA4,0xBB,0xA0,0xA5,0x46,0xBD,0x6F,0x68,
+	0x73,0xB1,0x56,0x83,0xA2,0x23,0x9F,0x36,0xF0,0xA6,0x7B,
+	0x1F,0x07,0xD2,0x50,0xF3,0x2D,0x3A,0x65,0x62,0xF6,0x39,
+	0xC6,0x84,0xAA,0x68,0x5F,0x01,0x71,0x17,0x91,0x04,0x72,
+	0x38,0x8D,0x0C,0x89,0xB5,0x76,0x6F,0xFA,0xB1,0xE6,0x8E,
+	0xD5,0x78,0xB3,0x58,0xFF,0xEF,0xFB,0xEA,0xD6,0xBE,0xED,
+	0x03,0x14,0xEC,0xE3,0x76,0x6E,0xC5,0xB9,0x25,0x0B,0x28,
+	0xB9,0x0A,0x24,0x7A,0x5A,0x3D,0xF2,0x34,0x64,0xE4,0xE2,
+	0x03,0x27,0x17,0xE2,0xA7,0xB9,0x85,0x11,0x56,0xE2,0xD3,
+	0x33,0x31,0x2B,0x72,0xC0,0xCC,0xE7,0x71,0x49,0xE9,0x4A,
+	0xBB,0xD9,0xE7,0xA1,0x74,0x3C,0xB6,0xF4,0x91,0xED,0xC2,
+	0x83,0x00,0xD1,0x6C,0x62,0xF9,0xA4,0x4A,0x13,0xAF,0xAB,
+	0xBF,0xBB,0xCB,0xBC,0x3B,0x5D,0x9F,0xA2,0x8C,0x36,0x1A,
+	0xDA,0xF1,0x78,0x4E,0xBA,0xEE,0x9E,0x2E,0x6D,0xED,0x69,
+	0x93,0xDE,0x1D,0xFD,0x3B,0xFF,0x49,0xCF,0x88,0x18,0xF3,
+	0xB4,0xA9,0xFD,0x69,0xE7,0x0E,0x74,0xDF,0x8D,0x6E,0xF7,
+	0x3C,0xB0,0x55,0x80,0x6B,0x72,0xC0,0x9E,0x16,0x9B,0xB4,
+	0xCC,0xC0,0x99,0x15,0x70,0x5E,0xB2,0xA1,0xF3,0x72,0xFE,
+	0x3D,0x3E,0xDC,0x0E,0xA1,0xF3,0x0C,0xA3,0xB5,0xA4,0x1D,
+	0x91,0x56,0x0C,0x0A,0x32,0xA6,0xCB,0xE7,0x14,0xEF,0xCE,
+	0xDA,0x6A,0x4F,0xD5,0x25,0x4F,0x6B,0x57,0x4F,0x4D,0xEF,
+	0x57,0xD4,0x81,0x20,0x0F,0x30,0x51,0xE2,0x3A,0xE4,0x43,
+	0x4C,0x60,0x99,0x8A,0x72,0xE2,0xB8,0x35,0x18,0x16,0x36,
+	0x35,0x6A,0xF4,0xE4,0x42,0x31,0x1C,0x9A,0xCD,0x37,0xBD,
+	0x4A,0x28,0x89,0x86,0x9E,0x29,0xE7,0xFD,0x5B,0x7C,0xAE,
+	0x4E,0x48,0x5B,0xFC,0xE5,0xDB,0xAB,0x78,0x69,0xF3,0x89,
+	0xCB,0xC6,0x24,0x6E,0xD1,0x85,0xFA,0x7D,0x54,0xC2,0xD4,
+	0x81,0xDC,0x47,0xB6,0x6B,0x58,0x8B,0x08,0x1B,0xDD,0x10,
+	0x96,0x5A,0xC2,0x99,0xB3,0xDC,0x28,0xF7,0xA2,0x1D,0xAE,
+	0x79,0x77,0x92,0x49,0x15,0x0D,0xF7,0x3E,0x2B,0x2D,0xFE,
+	0x49,0x7A,0x53,0xD5,0x05,0xE2,0xCA,0xE7,0x0A,0x9F,0x37,
+	0x00,0x08,0xBC,0x86,0x53,0xEC,0x38,0xAD,0x7C,0x4B,0xE7,
+	0xAB,0x6D,0x4D,0x68,0x51,0xF7,0xA7,0xAE,0x39,0x95,0xDF,
+	0x07,0xF0,0x39,0xD5,0xBC,0x62,0xD5,0x91,0x27,0xE3,0xBF,
+	0xB7,0x21,0x0F,0x78,0xFD,0x7D,0xD4,0x43,0xB8,0xD8,0xFF,
+	0x24,0x1A,0x3D,0xE6,0xFC,0x52,0x38,0x3E,0x1C,0x5D,0x3C,
+	0x36,0xA4,0x10,0x8E,0x8E,0x87,0x75,0xC6,0xEE,0x5E,0x48,
+	0xAE,0xB9,0x2F,0xDB,0x9B,0xAD,0x5C,0x97,0x0F,0xF9,0x57,
+	0xDB,0x2F,0x1B,0xBC,0x7F,0xCE,0xA4,0xF0,0xB7,0x72,0x01,
+	0x82,0xED,0x9E,0x46,0xE4,0x1A,0x1A,0xEF,0xB6,0x0F,0x0A,
+	0xC6,0x20,0x29,0x88,0x72,0xD7,0xB2,0x8F,0x3D,0x20,0xE5,
+	0x75,0xA0,0x49,0xFB,0x3A,0xE4,0xAC,0x91,0x6C,0xCB,0x02,
+	0x7B,0x01,0xD6,0xB3,0xD3,0xAF,0xB4,0x30,0xBF,0x11,0xF8,
+	0xA0,0x8D,0x26,0x14,0xBB,0x03,0x2F,0x37,0xEC,0x40,0x13,
+	0x6F,0xA7,0xBE,0x13,0xDC,0xEA,0x44,0xA5,0x53,0x12,0xD1,
+	0x1B,0xE8,0x37,0x54,0xB3,0xE8,0xF9,0xE5,0xE7,0x86,0xF6,
+	0x99,0xC3,0x87,0x2A,0xBA,0x0F,0xDC,0x79,0x40,0x5B,0x67,
+	0x6F,0xFC,0x73,0x08,0x21,0x8C,0xBF,0xF2,0x55,0x44,0x89,
+	0xD2,0x8A,0xB7,0xFC,0xC3,0x37,0xA7,0xC8,0xF7,0x79,0x56,
+	0xBB,0x09,0xEF,0xEB,0xEC,0x63,0xFB,0xEC,0x45,0xDE,0xBF,
+	0x1F,0x2B,0x3E,0xDA,0x2D,0xBE,0x5D,0x3C,0xBE,0xB8,0x75,
+	0x63,0xAA,0x6A,0x7D,0x97,0x11,0x64,0x3B,0x77,0x39,0x8B,
+	0x98,0x2F,0x2E,0x7E,0x58,0xF6,0xB9,0x42,0x65,0xE6,0x79,
+	0xDF,0x8F,0x79,0x1C,0x6D,0xC0,0xC9,0xF7,0xE9,0xDF,0xAB,
+	0x0D,0x68,0x84,0xBD,0x3D,0x02,0x82,0x2B,0xD0,0x85,0x52,
+	0x0A,0xE2,0x86,0x61,0x95,0xF7,0xFD,0xD1,0x18,0xD7,0xC2,
+	0xE8,0xF2,0x9C,0x78,0xCD,0xE7,0x36,0x4E,0xD3,0xE3,0xF9,
+	0x5B,0x0C,0x3C,0x6A,0x56,0x0D,0x46,0x99,0xD8,0x2C,0xDC,
+	0xAE,0xB0,0x65,0x6A,0xE5,0x6A,0xC5,0xEA,0xB1,0x65,0xAD,
+	0x65,0xD8,0x87,0x84,0xBA,0x20,0x8F,0xDC,0xBC,0xCD,0x9F,
+	0x95,0xAF,0x39,0xA9,0x4E,0x50,0xF2,0xF0,0xCA,0xD1,0x61,
+	0x0F,0x73,0x8A,0x58,0x2D,0x48,0x88,0xCD,0x09,0xCE,0xB4,
+	0xA9,0xBC,0xB4,0x4F,0x35,0x9F,0x35,0xAB,0x50,0x19,0x53,
+	0x63,0xE5,0xC0,0xBB,0x98,0x59,0xE5,0x9D,0x4A,0x3B,0x3A,
+	0x94,0xCA,0x14,0x07,0xF7,0x77,0xA6,0xE2,0x78,0xDD,0x32,
+	0x13,0xEE,0x8A,0xF2,0x79,0x52,0x15,0x89,0x8B,0x67,0xDD,
+	0xCC,0xF7,0xB4,0x71,0xA5,0x9E,0x89,0xF4,0x01,0x01,0x37,
+	0xAC,0xAE,0x20,0xFE,0x7D,0xA6,0xEB,0xB2,0x80,0x55,0xE5,
+	0xB3,0x47,0x26,0x74,0x06,0x69,0xD4,0x4D,0x10,0x74,0xB4,
+	0xA9,0x99,0x8C,0x46,0x72,0x1F,0x45,0x5B,0xB2,0x44,0x0D,
+	0x82,0x5E,0x63,0x12,0x59,0x8B,0x83,0x54,0xB6,0x54,0xCD,
+	0x42,0xAE,0xF0,0x5F,0x23,0x35,0x53,0xEF,0x83,0x90,0x1D,
+	0xCA,0xFB,0x86,0x43,0xE3,0x09,0x46,0x2E,0x8D,0xEB,0x9D,
+	0x71,0xF0,0xB1,0xB4,0x94,0x76,0xF0,0x73,0x46,0x7D,0x52,
+	0x87,0x7E,0x95,0xE9,0x6D,0x7D,0x54,0xC8,0x75,0x1A,0x73,
+	0x90,0x9B,0x38,0x2E,0x3F,0x11,0x1A,0x18,0xB2,0x14,0x72,
+	0xFA,0xBD,0x6D,0x64,0xFC,0xB1,0x8D,0x79,0xBB,0x15,0xED,
+	0x3B,0x94,0x01,0xFA,0x79,0xE5,0x40,0x44,0x97,0x25,0x6B,
+	0x70,0xD9,0xCA,0x11,0x71,0x14,0xD5,0x7F,0x17,0x27,0xEC,
+	0xAC,0x25,0xEC,0x1B,0x72,0x77,0x3A,0x00,0x6A,0xAB,0x99,
+	0x40,0xC0,0xE6,0xAB,0xF3,0x26,0xF4,0x97,0xAF,0x66,0x21,
+	0x06,0x87,0xFE,0x91,0x38,0x31,0x1B,0xEE,0xA8,0x0E,0x0E,
+	0x53,0xA2,0x8C,0xD5,0x2C,0x71,0x5A,0x4F,0x57,0x3C,0x41,
+	0x02,0x5A,0x99,0x07,0x38,0x9D,0x09,0x2A,0xF3,0x1A,0x21,
+	0x93,0xC1,0xBC,0x3B,0x89,0xF4,0x4E,0x79,0xF8,0xBE,0x0D,
+	0xDF,0xF3,0xFC,0x4E,0xEF,0x34,0x32,0x2A,0xBF,0x0C,0xBD,
+	0xEC,0x20,0x1C,0x4B,0x74,0xAC,0xB7,0x3B,0xDE,0xA6,0xCA,
+	0x85,0x35,0x5E,0xFE,0x31,0x64,0xB3,0x8E,0x29,0xCF,0x18,
+	0x1A,0x73,0x24,0x29,0x8B,0xB1,0x9B,0xF3,0x47,0x2B,0x8C,
+	0xA5,0x8A,0x60,0x88,0x23,0xA7,0x8A,0x04,0xA1,0x80,0x17,
+	0x55,0x78,0xA4,0x51,0x17,0x4D,0x25,0x90,0x23,0xFF,0xF0,
+	0x13,0xB0,0xBB,0xA1,0x0C,0xDA,0xEB,0x11,0x8E,0xF9,0xEC,
+	0xE5,0x1C,0x2C,0x3E,0xE2,0x53,0x9D,0xF7,0xB8,0xC3,0xCF,
+	0x06,0x57,0xCB,0x58,0x02,0x47,0x6D,0xB1,0xAD,0x56,0xA7,
+	0xFE,0x30,0x31,0x0D,0x82,0xFF,0x30,0xDD,0xDD,0x11,0x84,
+	0x0E,0xC6,0x5A,0xAB,0xCC,0xDA,0xD2,0x3C,0x4E,0xCF,0xE4,
+	0x05,0x9C,0xF5,0xB5,0xFF,0x9A,0x10,0xD7,0xF7,0xCF,0x80,
+	0xB8,0x33,0xA4,0x6A,0x4C,0x39,0x1D,0x54,0xF5,0x88,0x13,
+	0x27,0x69,0xB5,0xAD,0xF0,0x3F,0xBC,0xEA,0x96,0x04,0x85,
+	0x5C,0x04,0xCF,0xBE,0xC9,0x7F,0x52,0x1C,0x0E,0x35,0xCC,
+	0xE9,0x2E,0x35,0x6E,0xD7,0x98,0xB8,0x8B,0x03,0x51,0x27,
+	0xE4,0x67,0x36,0xCF,0x03,0xC5,0xDE,0x67,0x43,0x0A,0x7C,
+	0xD2,0x18,0xFD,0x9A,0x41,0xC9,0x1A,0x6A,0x84,0xDB,0xA8,
+	0x12,0xD3,0x4D,0xB0,0xFB,0x94,0x23,0x7F,0xE0,0x0E,0xBC,
+	0xDF,0xD7,0xFD,0xDB,0xE9,0x70,0xF9,0x08,0xF2,0x67,0xA0,
+	0x91,0x91,0x89,0xF1,0x1D,0x57,0xEC,0xA7,0x6C,0x0C,0x04,
+	0x55,0xC9,0xD0,0x3E,0xBD,0x6A,0xBE,0x62,0x1A,0xF9,0xE9,
+	0x9D,0xB6,0xCF,0xEC,0xD3,0x0B,0x3E,0xF0,0xB9,0x3F,0xBA,
+	0xA3,0x7A,0x20,0x57,0xC8,0xBD,0xA4,0x7D,0xD4,0x07,0x61,
+	0x96,0x3D,0x12,0xBB,0x6E,0x53,0x9F,0xF5,0x3E,0xED,0xC8,
+	0x01,0x87,0x67,0xD2,0xE9,0xED,0x28,0xD4,0x25,0x62,0xF2,
+	0xB8,0xE0,0x70,0xCF,0x28,0xBB,0xCF,0xB6,0x73,0x20,0xE6,
+	0xC9,0xA8,0xA2,0x0E,0x50,0xCE,0xB2,0xD8,0x46,0x0B,0x35,
+	0xC1,0x6E,0x5E,0xA9,0x04,0x11,0xF7,0x40,0x82,0xE6,0x35,
+	0x8C,0x1A,0xCA,0xFD,0x54,0x0F,0x84,0x68,0xA9,0x71,0xCA,
+	0x87,0xC6,0x0F,0x54,0x0F,0x11,0xBE,0x8D,0xEC,0x79,0x9A,
+	0xA6,0xD2,0xF9,0x39,0x94,0xAC,0x82,0x41,0xDC,0x65,0x90,
+	0xD7,0xE6,0xC2,0xD6,0xE6,0x42,0x8E,0xF6,0x78,0x7B,0x4F,
+	0x89,0x69,0x0A,0x37,0x53,0xFF,0xD1,0xA1,0xAD,0xC0,0x38,
+	0x10,0xFA,0xAE,0x18,0xCB,0xB4,0x91,0xF8,0x46,0x99,0xDC,
+	0xEB,0xD7,0x4A,0xAE,0x35,0xB0,0x56,0x3B,0x08,0xC0,0xA4,
+	0x23,0xB5,0xC2,0xD7,0x51,0xA7,0xA2,0xE2,0xDB,0x21,0xDB,
+	0xB1,0xA6,0x77,0x6F,0x41,0x1D,0x1C,0x4A,0x95,0x86,0xA1,
+	0xFD,0xC5,0x04,0xAC,0xA1,0x73,0x14,0x33,0xE2,0x37,0x46,
+	0x68,0x25,0x58,0xDB,0x5F,0x82,0xC4,0xCA,0xF9,0xD1,0x05,
+	0xE3,0xF9,0x20,0x94,0xC0,0xCD,0x65,0x87,0xED,0xE2,0x92,
+	0xD4,0x3C,0xD3,0x3B,0x45,0x3D,0x83,0xDE,0x6E,0x3F,0x82,
+	0xAB,0x31,0xDC,0x68,0xAC,0x11,0x39,0x3D,0xEB,0xF0,0xE0,
+	0x56,0x11,0x77,0x0D,0x8A,0x9D,0x9A,0x1C,0x46,0xD8,0x5E,
+	0x5E,0x2B,0xE0,0x43,0x5C,0xF8,0xF7,0x94,0xE9,0x22,0xFE,
+	0x27,0x85,0x94,0x92,0x79,0x4F,0xAB,0x2F,0x83,0x94,0x87,
+	0x9F,0x30,0xDD,0xAB,0x4D,0xBF,0xF8,0xA8,0x63,0x41,0x4B,
+	0xE0,0xA8,0xEF,0x1B,0x46,0x8A,0x64,0xF8,0xB4,0x46,0x7E,
+	0xE4,0x18,0xB5,0x67,0x45,0x72,0xF4,0x2E,0xFD,0xE4,0xFC,
+	0x9A,0x73,0xFA,0xB5,0xF7,0xB0,0x6F,0xD9,0x5C,0x2B,0x32,
+	0xF9,0x7B,0x46,0xEB,0xD8,0xCB,0x5F,0x3F,0x99,0x2B,0xC8,
+	0x9B,0x4F,0x7F,0xC9,0xA1,0xD1,0xB4,0x00,0xF9,0x25,0x73,
+	0x88,0xD1,0x6B,0xFE,0xC4,0x98,0x81,0xCC,0xB0,0xF0,0x38,
+	0x59,0xA5,0x50,0x8E,0x5E,0x7E,0x9B,0x7D,0xE2,0xD0,0x4F,
+	0x44,0x40,0x38,0xC6,0x25,0xF8,0xAF,0x92,0xFD,0x79,0xC2,
+	0xC5,0x8B,0xBF,0xC6,0xE8,0x60,0x5E,0x1F,0xE2,0x94,0x49,
+	0x70,0x31,0x74,0xF9,0x7C,0x2C,0x0A,0x9D,0x18,0xAA,0xBF,
+	0xBD,0x96,0x0D,0x4C,0xF3,0x40,0x69,0x36,0xCE,0xEA,0x9D,
+	0x34,0xEB,0xBA,0x4B,0x36,0x0A,0x23,0x89,0x17,0x40,0x61,
+	0x66,0xD5,0x81,0x10,0x1D,0xCD,0x3D,0xFD,0xA4,0x78,0x0C,
+	0x01,0xE3,0xB1,0x30,0x60,0x03,0x12,0xF8,0x79,0x5E,0x8E,
+	0x4B,0x10,0x18,0x29,0x37,0x98,0x0A,0xB7,0xE8,0xE8,0x61,
+	0x2C,0x73,0x1A,0x50,0xD1,0x1D,0xE8,0xA9,0x8E,0x8A,0xCA,
+	0x68,0xE4,0x33,0x0B,0x4E,0x6C,0xED,0x26,0xE2,0x32,0xE5,
+	0x53,0x34,0x97,0x01,0xFE,0x58,0x64,0xD1,0x4B,0x58,0x74,
+	0x26,0x08,0x4C,0x6C,0xA9,0x4A,0xAB,0x8F,0x10,0xD7,0xBA,
+	0xEA,0x0C,0x8D,0x4E,0x54,0x7C,0x2B,0xC7,0x80,0x15,0x21,
+	0x9D,0xE4,0xF9,0x95,0x93,0xEA,0x47,0x8F,0x99,0x54,0x78,
+	0xB4,0x3D,0x42,0x5B,0x18,0x62,0xC4,0xF4,0xD2,0x31,0x9F,
+	0x5F,0x3B,0xE5,0x6B,0x06,0x67,0xE9,0x26,0xBC,0xD5,0xEB,
+	0xD8,0x77,0x85,0x70,0xA2,0xEA,0xD8,0xD4,0x77,0xE3,0x05,
+	0x6F,0x6E,0x50,0x4E,0xF0,0xD5,0xE8,0xA7,0x26,0x9B,0xEA,
+	0x98,0x67,0x0A,0x46,0x76,0x6F,0x6F,0x5F,0xB9,0x4B,0x89,
+	0xF6,0x2F,0xAF,0x00,0x2D,0xFF,0xB5,0x80,0x4A,0x61,0xBF,
+	0x14,0x79,0xC0,0x0D,0xE8,0xCA,0xAD,0x0D,0xE3,0x76,0x78,
+	0xAD,0x50,0x77,0xCF,0x18,0xDE,0x4F,0x5B,0x55,0x48,0xB9,
+	0x05,0x2F,0x2E,0x4C,0x2A,0xFE,0xD7,0xBA,0x20,0x59,0xB7,
+	0xA7,0xC2,0x62,0x9F,0x6B,0xB1,0x82,0x75,0x9C,0xC1,0x11,
+	0x1E,0xAA,0x2B,0xD3,0x15,0x56,0x20,0x61,0x84,0x8B,0x61,
+	0xEE,0x3B,0x93,0xD6,0x5D,0x8A,0x3A,0x7B,0xDF,0x14,0x4D,
+	0xB8,0x82,0xD1,0x3D,0x53,0xBC,0x97,0x7A,0xEC,0x75,0x17,
+	0xC1,0xD9,0x90,0xE2,0xEA,0x1B,0x58,0x2F,0xE2,0xD6,0xBA,
+	0xCC,0xCB,0xE6,0xEE,0xEF,0x43,0x2E,0x36,0xF9,0x6D,0x73,
+	0xF9,0xFD,0x7B,0xCF,0x4B,0x00,0x5F,0x7C,0x07,0x3F,0x13,
+	0xA1,0xD7,0xE2,0xF8,0x5E,0x9E,0x7D,0x6B,0x8D,0x30,0xDE,
+	0x11,0xE6,0x64,0x30,0x8C,0x7D,0x8E,0xCD,0x67,0xA0,0xAE,
+	0x41,0x01,0x85,0x2A,0xCA,0x36,0x7B,0xCF,0xDA,0xBB,0x42,
+	0xB3,0x7D,0xD7,0x6A,0x41,0x79,0x93,0x54,0x78,0x58,0xFE,
+	0x7E,0xCF,0xE4,0x46,0x45,0xA7,0x31,0x85,0x34,0x3E,0x93,
+	0x4F,0xB4,0xE1,0x34,0x76,0xB1,0x7C,0x4B,0x99,0x04,0xE8,
+	0xCC,0xB6,0xA7,0x67,0xE6,0x47,0x66,0x7D,0x2B,0xE5,0xC5,
+	0x10,0x73,0x50,0x60,0xB0,0xEC,0x45,0xBF,0x4A,0xA3,0xED,
+	0xED,0x77,0x89,0x6F,0xE9,0xEE,0xB7,0xB5,0xB1,0x4C,0x2B,
+	0x8C,0xE0,0x76,0xED,0xB9,0xF5,0xE6,0x35,0xFB,0x21,0x27,
+	0xFB,0x9B,0x55,0x32,0xCC,0x80,0x8D,0x9E,0x41,0x88,0x8A,
+	0xE4,0x3D,0x1E,0x59,0xAB,0x63,0x60,0x5D,0xA7,0x43,0xB0,
+	0x0B,0xC2,0xA0,0x72,0xE6,0x32,0x7F,0xFB,0xB8,0xC4,0x9F,
+	0x18,0xB9,0x49,0xA8,0xF0,0xA0,0x60,0xEC,0xD4,0x04,0x73,
+	0x9D,0xDE,0xBF,0x8B,0x39,0x1D,0x48,0x7C,0xEE,0x95,0x23,
+	0xA8,0xEE,0x01,0x03,0xA8,0xC1,0x75,0xF1,0x46,0x06,0xF4,
+	0x10,0x1E,0xE5,0xBB,0x0A,0x8F,0x5C,0x3F,0xB3,0x3E,0x37,
+	0xFE,0x82,0xB9,0xC7,0xEA,0x0B,0x14,0x41,0x96,0x1F,0xD3,
+	0x3D,0x6A,0xAD,0x79,0x48,0x57,0x9B,0x62,0x83,0xA1,0xAB,
+	0x8B,0x49,0x20,0xA1,0xA6,0x3B,0xAD,0x68,0x58,0x41,0x63,
+	0x23,0xB3,0xA9,0x96,0x97,0x7B,0x77,0xC4,0xE3,0x3B,0x6F,
+	0xFD,0xC0,0x82,0x03,0x3A,0x94,0xF3,0x75,0xB0,0x3D,0x9A,
+	0x8C,0xFC,0x07,0xCC,0x28,0xBB,0xE2,0x7B,0x73,0x7D,0xBE,
+	0x20,0x08,0x30,0x46,0xCC,0x47,0x4B,0x1F,0xA0,0x1A,0xD3,
+	0xFE,0x80,0x42,0xA9,0x63,0x44,0xCD,0xDB,0xB4,0xFA,0x76,
+	0xC9,0x54,0x70,0xBF,0x24,0x67,0xBF,0x04,0xC5,0x22,0xA4,
+	0x31,0x42,0xC6,0xB8,0xC0,0x58,0x50,0x95,0x05,0x9B,0xF7,
+	0x24,0x0C,0xDD,0x45,0xFB,0x22,0x3F,0x58,0xB6,0xA4,0x26,
+	0xBF,0x8B,0x39,0x1D,0x5E,0x9A,0xD1,0x5D,0x08,0x3F,0x5F,
+	0xC4,0x71,0x2B,0x0D,0x5B,0x82,0xEC,0x6D,0x44,0xA7,0xFC,
+	0xE4,0x68,0x2F,0x64,0x1B,0x96,0x3D,0x5A,0x79,0xAE,0xE4,
+	0x68,0xBF,0x37,0x92,0x42,0x8D,0xD9,0x04,0x76,0x20,0xBE,
+	0x87,0x61,0x00,0xFB,0x3D,0x86,0x0E,0x40,0x3B,0xA0,0x17,
+	0x90,0x2E,0x8D,0x5E,0x93,0x50,0x9C,0x4D,0x4D,0x29,0x66,
+	0xAF,0x60,0x92,0xD4,0x5D,0xD2,0xF5,0x84,0xB8,0xF8,0x34,
+	0x8A,0x85,0x9D,0xDD,0x3A,0x8B,0xC2,0x93,0x48,0xC5,0x82,
+	0x94,0x75,0x21,0x65,0x4B,0x4A,0x9A,0x98,0x09,0xAC,0xBB,
+	0x24,0x64,0x24,0x08,0x45,0x14,0xD1,0x84,0x54,0x4A,0x50,
+	0x59,0x41,0x71,0xA3,0x53,0xE0,0xBF,0x93,0x05,0x62,0x4A,
+	0xEA,0x7D,0xD5,0x38,0xA9,0x20,0x99,0xD2,0x9F,0x26,0x4A,
+	0xE8,0x4A,0x11,0xDC,0x19,0x93,0xA4,0xE8,0x44,0x0A,0x7A,
+	0x20,0x4A,0x6A,0xC0,0xBB,0xC7,0xD8,0x33,0xDF,0x91,0x40,
+	0x33,0xB6,0xF5,0x6F,0x10,0x10,0x8B,0xD9,0x2A,0x41,0x03,
+	0xF5,0x1A,0x7D,0x68,0xD0,0x94,0x9A,0xBD,0x7A,0xE5,0x07,
+	0x88,0x12,0x70,0x04,0x73,0x5C,0xC7,0x39,0x7E,0x3D,0xC9,
+	0x45,0x96,0x44,0x89,0x16,0xA5,0xAD,0x0B,0x28,0x2C,0xA6,
+	0x1D,0x93,0x8D,0x12,0x75,0xFC,0x66,0xB3,0x58,0x6C,0xC6,
+	0x67,0x98,0xA5,0x8D,0xDD,0xC3,0xA5,0x64,0xE9,0xBD,0x71,
+	0x2F,0x11,0xE3,0xC0,0xED,0xE6,0xF4,0x91,0x09,0x58,0x5A,
+	0xBC,0x5A,0x8E,0x9B,0x4F,0x20,0x24,0xC7,0xD7,0x0B,0x75,
+	0x3D,0xEC,0x6D,0x46,0xD2,0xE0,0x74,0xD8,0x13,0x41,0xDA,
+	0xA0,0xE8,0x95,0x8C,0x42,0x4F,0xDB,0x75,0x2B,0x95,0x66,
+	0x18,0xB3,0xB4,0x99,0x12,0xBB,0x70,0x8B,0x62,0x26,0x4E,
+	0xBD,0xB5,0xC1,0xD8,0x57,0xBC,0x24,0x12,0xC8,0xF0,0x6D,
+	0xE9,0x10,0xC1,0x3B,0x86,0x4B,0x0B,0x3C,0xF6,0xBD,0x19,
+	0xC5,0x5C,0x38,0xA1,0x6D,0x68,0xB9,0x3D,0xE6,0x15,0x51,
+	0x9A,0x21,0x12,0xC6,0xB0,0x63,0x3B,0xD3,0xD3,0x22,0xAE,
+	0x9B,0xAE,0x52,0x81,0xC0,0x94,0xA4,0x48,0x8B,0xCC,0x14,
+	0xCA,0x50,0xED,0x12,0x2D,0xF0,0x6F,0x19,0x41,0x38,0xA9,
+	0xE9,0x2F,0x69,0x48,0xC6,0x5D,0x8F,0x3D,0x10,0xAB,0x3D,
+	0xA9,0x15,0x23,0x68,0xA0,0x30,0x6E,0xA7,0x29,0xCA,0x0C,
+	0xB4,0x79,0xD1,0x93,0x22,0x3D,0x69,0x0B,0x35,0xDA,0xF9,
+	0x05,0x49,0x6B,0x45,0x10,0x13,0x13,0xFF,0x52,0xE6,0xFA,
+	0x4A,0x9D,0xCF,0x0D,0xB0,0xBC,0xCE,0x66,0x36,0xC7,0x88,
+	0x4F,0x27,0x5F,0xB9,0xBF,0x8B,0x22,0x4B,0x4F,0x4D,0x4D,
+	0xDA,0x5B,0x2D,0x16,0xB2,0x8E,0x70,0x58,0x7A,0x23,0x0D,
+	0xAD,0xA4,0xA2,0xA4,0xCB,0x3F,0xE3,0x28,0xC2,0x04,0xE9,
+	0x37,0xA6,0x10,0x6F,0xD3,0xD0,0x62,0x2B,0xF9,0x18,0x93,
+	0x10,0xDB,0x9C,0x20,0xFF,0x50,0x4C,0x9E,0x8C,0x91,0x58,
+	0xC6,0xB4,0xA5,0xBD,0x10,0xFF,0xAB,0x41,0x75,0xFA,0x5C,
+	0x69,0xD4,0xBA,0x8F,0x45,0x54,0x20,0xA2,0x43,0xB4,0x93,
+	0xDF,0x61,0xC2,0x5E,0xA5,0x45,0x4A,0x92,0x7E,0x07,0xA6,
+	0x8A,0x62,0xEF,0xF8,0xC4,0x25,0xA7,0x1F,0x35,0x29,0x52,
+	0x4F,0x6A,0x1D,0xE0,0x6D,0x9F,0x60,0x32,0xFD,0x5B,0xD2,
+	0x5D,0x12,0x82,0x0C,0x06,0x65,0xB2,0xE6,0x18,0xAB,0xD3,
+	0x3F,0x2D,0x6A,0x36,0x4E,0x2C,0x4B,0xAE,0x86,0xE9,0xF2,
+	0x96,0xB6,0x6E,0x0D,0xD0,0x6A,0x16,0x64,0x4C,0x9E,0x8B,
+	0x8D,0x15,0x2D,0xDE,0x8A,0x6E,0x51,0xF9,0x20,0x10,0x0A,
+	0xF6,0x1A,0xD0,0x65,0x1B,0x54,0x21,0x7D,0x8C,0x5B,0xFA,
+	0x16,0xA6,0x8D,0x28,0xE2,0x78,0x9A,0x16,0xE9,0xB5,0x96,
+	0x59,0x8A,0xF4,0x48,0x8B,0x88,0xE4,0xEA,0x38,0x41,0x09,
+	0xBB,0x4B,0xDC,0x7C,0x28,0x43,0x22,0x6E,0x4E,0xBF,0x3F,
+	0x60,0x43,0x0E,0x13,0x65,0xA6,0x46,0x0A,0x5E,0x4E,0xF2,
+	0x98,0x94,0xD0,0xAB,0xF0,0x9D,0x85,0xC2,0x5C,0x37,0xCC,
+	0x7D,0x73,0x73,0xBE,0x64,0x6B,0x66,0x42,0xDA,0x78,0x4C,
+	0xBC,0x6E,0x87,0x45,0xCE,0x11,0x6A,0xA7,0x87,0xE0,0xCF,
+	0x97,0x09,0x04,0xEF,0x54,0xF5,0xB1,0x96,0x84,0x30,0x7B,
+	0xCD,0x6E,0xB1,0x10,0xDD,0x63,0x3D,0x78,0x4B,0x27,0x89,
+	0xC9,0x92,0x26,0x50,0xB2,0xC7,0x59,0xF6,0xDC,0x94,0x55,
+	0x9C,0x2C,0x9E,0x9B,0xFE,0x71,0xC7,0x2F,0x05,0x2A,0x50,
+	0x66,0x1A,0x68,0x9B,0x86,0x42,0x3E,0x03,0x09,0xC5,0x61,
+	0x8E,0x96,0x2B,0x9B,0x22,0x50,0x07,0xAE,0x5D,0x8F,0x85,
+	0x89,0x1D,0x1D,0x4D,0x4F,0xFF,0x2B,0x96,0x69,0x2C,0x4A,
+	0x61,0x42,0x59,0x46,0x46,0x44,0xDE,0x6D,0xC3,0x86,0xCC,
+	0x6D,0xE2,0x03,0xC9,0xF4,0xCC,0x77,0x3B,0x86,0xDF,0x27,
+	0x64,0xA5,0x9E,0xDD,0x35,0xB5,0x28,0x9B,0xD6,0x34,0x14,
+	0x08,0xED,0x87,0x58,0x65,0x83,0xAF,0x26,0x94,0x85,0xAA,
+	0xDF,0x9C,0x5E,0x2F,0x46,0x9C,0xDB,0x29,0x8B,0xAF,0x1F,
+	0x23,0xF3,0x16,0x41,0xF7,0x5D,0xA5,0xF6,0x88,0xE4,0xEB,
+	0xFA,0x2D,0x42,0xB2,0x40,0x57,0x43,0xF0,0xC8,0x3E,0x4D,
+	0x7A,0x77,0xD7,0x1E,0x1B,0xA2,0x24,0xA3,0xF2,0x98,0xDA,
+	0x55,0x01,0xFA,0xAF,0x87,0xC6,0x9F,0x1D,0x64,0x37,0x3D,
+	0x73,0x9E,0x09,0xBB,0xCF,0x29,0xCF,0x07,0x65,0x37,0xDB,
+	0xFE,0xD4,0xC9,0xB0,0x27,0x6E,0x2C,0x2F,0x12,0xED,0x17,
+	0xD8,0xC4,0x1F,0x0A,0xDA,0x03,0x7E,0x26,0x73,0x52,0x7A,
+	0xB0,0x3F,0x26,0xF0,0x8E,0xA8,0x1F,0xE5,0x83,0x2A,0x20,
+	0x26,0xC5,0x53,0x9C,0x77,0x48,0x69,0x81,0x39,0x57,0x6F,
+	0xF4,0xDD,0x63,0x1C,0x35,0xD0,0xBD,0x17,0xF3,0x5E,0x67,
+	0x8B,0x2C,0xDE,0x7E,0x11,0x00,0xB4,0xD6,0x6F,0x72,0x65,
+	0x03,0xD3,0x53,0x9A,0x32,0xB8,0x9E,0xF6,0x6F,0x46,0xEC,
+	0x9E,0x35,0x84,0x38,0x21,0x45,0xA8,0xC8,0x8C,0x4E,0x5F,
+	0x2B,0xA1,0x18,0x19,0x29,0x0E,0xCB,0x24,0x5F,0x65,0x80,
+	0x54,0xF8,0x2A,0x53,0x8A,0x64,0x4E,0xC5,0x00,0xBF,0x3B,
+	0x28,0x3A,0x6D,0x5E,0x8B,0xFE,0xAE,0x80,0x8C,0x67,0x7A,
+	0x8F,0xFF,0x91,0x1D,0x3F,0x48,0x42,0xAE,0x02,0xF4,0x64,
+	0x89,0x50,0xF2,0xC5,0xC9,0x89,0xB2,0x75,0x7D,0x87,0x9F,
+	0x4B,0xB0,0xDF,0x06,0x4A,0xAE,0x22,0x97,0x82,0xDB,0xB1,
+	0xD5,0xC7,0x6B,0x3C,0x74,0xC3,0xB1,0x93,0x56,0x03,0x21,
+	0x27,0x68,0x0A,0xEB,0x55,0xB3,0x4D,0xBC,0x5D,0x11,0x60,
+	0x99,0xEF,0x2D,0x55,0xFF,0x13,0x21,0x12,0x9C,0x18,0xFD,
+	0x8A,0xE0,0x8C,0x62,0x58,0xE7,0x0C,0x33,0xDC,0x1A,0x4B,
+	0xF9,0x8D,0x55,0x5E,0x57,0x8E,0x23,0xF7,0xF8,0x27,0x64,
+	0x8B,0xE8,0x8F,0xCF,0x6C,0xF8,0x5A,0x5C,0x96,0xFF,0x20,
+	0x26,0x61,0x4A,0x51,0xC4,0x39,0xD0,0xDB,0x22,0x8B,0x97,
+	0xB9,0xAE,0x2C,0xD3,0xD5,0x6C,0x24,0xC7,0x5E,0xC8,0xAE,
+	0x70,0x1D,0x5B,0xF2,0x6D,0x5E,0xEC,0x3B,0x88,0x7A,0xA7,
+	0x02,0x24,0x85,0xE4,0x45,0x44,0xC4,0x44,0x95,0x34,0x46,
+	0x6D,0x40,0x04,0xDE,0x80,0xC9,0xAA,0x4D,0x43,0x4E,0x70,
+	0x27,0xE9,0x4C,0x71,0xEE,0xA2,0x6C,0xE0,0x2D,0xD9,0x82,
+	0x6D,0x94,0xD7,0x4E,0xB2,0xB3,0x41,0xF1,0x48,0xCD,0x3D,
+	0xC7,0xFF,0xC9,0x57,0x74,0xC5,0x80,0xCF,0x0B,0xAF,0x03,
+	0x66,0xAD,0x29,0xA4,0xE4,0x1F,0x31,0xC7,0xD1,0xD9,0x21,
+	0x99,0xFC,0xCE,0x34,0x9B,0x9D,0xA0,0x1B,0x80,0x76,0x7B,
+	0x34,0xDA,0xB6,0x73,0x05,0x56,0xB6,0x8F,0x5D,0x50,0xC6,
+	0x63,0xD6,0x84,0x61,0xA0,0x94,0xE3,0xD4,0xBB,0x1F,0x12,
+	0xB6,0x22,0x3A,0xC4,0x18,0x58,0x9E,0x51,0x39,0xAE,0x73,
+	0x3E,0xF0,0x86,0x28,0xC7,0xF4,0x32,0xB8,0x5A,0xA9,0xE1,
+	0x5C,0xF2,0x35,0xD9,0x7B,0xF8,0xB4,0xC7,0xB5,0x29,0xB3,
+	0x74,0x71,0x9A,0x95,0x19,0x9A,0xFE,0xDC,0xE9,0x52,0xF1,
+	0xF8,0x76,0x6D,0x85,0x8F,0x88,0x9B,0x72,0x35,0xE6,0x49,
+	0x54,0x68,0xD0,0xA1,0xEB,0xD9,0x55,0x5C,0x7A,0x83,0x58,
+	0x80,0x6E,0xC3,0x07,0x4D,0xC6,0x6D,0xB6,0x0F,0x37,0xA1,
+	0x29,0x14,0x49,0x87,0x05,0x03,0xE8,0x6D,0xA8,0x20,0x69,
+	0xCA,0xD7,0x28,0x64,0x9B,0x03,0x55,0x65,0xED,0x66,0xAA,
+	0x12,0x22,0xBE,0xB0,0x2B,0x94,0x58,0x48,0x2F,0xAA,0xC1,
+	0x79,0x10,0x9F,0xDA,0x07,0x36,0x1E,0xD3,0xDF,0x12,0xFD,
+	0x4D,0x1C,0x9B,0x52,0xE5,0x9A,0xD9,0x8A,0x4C,0x4A,0x8B,
+	0xB3,0x1A,0x1B,0x8A,0xB9,0xE9,0x2E,0x2B,0x1E,0xDC,0xDD,
+	0x19,0x93,0xF2,0x1E,0x09,0x88,0x8D,0x84,0x1E,0x37,0xDE,
+	0x61,0x54,0x72,0xE2,0xD2,0x34,0xA3,0xE2,0x83,0x6A,0xB5,
+	0x99,0xC8,0x68,0x8F,0x9F,0xCA,0x02,0x83,0xD8,0xD4,0x7B,
+	0x32,0xE5,0xE9,0x9D,0xC1,0x05,0x11,0x45,0xEE,0x63,0x59,
+	0x09,0xA6,0x45,0x3E,0x65,0x31,0x7C,0xC5,0x4E,0x87,0xCC,
+	0x54,0x94,0x36,0xE0,0xE8,0x32,0x50,0xA8,0xFC,0x26,0xFC,
+	0x1E,0x6B,0xA6,0x7D,0xD4,0x10,0x5F,0x98,0x40,0x79,0xBA,
+	0x83,0x9C,0x41,0x3C,0xD5,0xFC,0xA0,0xD0,0x41,0x2F,0x51,
+	0x92,0x04,0x6E,0x92,0x90,0x94,0xBC,0xEE,0x29,0x37,0x34,
+	0xFB,0x90,0x30,0xEF,0x1C,0xEB,0x9B,0xF1,0x67,0x14,0xE1,
+	0x29,0x42,0xBF,0x66,0x0A,0x50,0x6D,0x76,0x90,0x4D,0x0C,
+	0xC3,0xDF,0x5B,0x2D,0x8A,0x96,0xE8,0xB4,0xC4,0x28,0x65,
+	0x0C,0x46,0x0B,0xE6,0xC0,0x87,0xEC,0x47,0x93,0x93,0x90,
+	0x9D,0x32,0x5E,0xBC,0x73,0xE3,0x69,0x60,0x09,0xF6,0x84,
+	0x9A,0x28,0x20,0xDC,0x50,0x3E,0x2F,0xB3,0x40,0x8A,0xEF,
+	0x02,0x08,0x6D,0x7C,0x51,0xFB,0x83,0xB8,0xE8,0x2E,0xE5,
+	0xAC,0xA4,0x4D,0x92,0x04,0xD6,0x1D,0x02,0x36,0x44,0xB1,
+	0xC7,0x6A,0xF6,0xAF,0xF8,0xA3,0x1F,0xBC,0xB2,0x2D,0x8D,
+	0x65,0xDA,0x2A,0x68,0x8A,0x91,0x7F,0x3C,0xAA,0x8D,0x19,
+	0xD7,0x28,0xF6,0x9F,0xF3,0x81,0x07,0x4C,0xDE,0xDE,0x1A,
+	0xEB,0x5B,0xA0,0xC9,0x73,0x94,0xB9,0x3B,0x31,0x80,0xB2,
+	0x28,0x29,0xFF,0x61,0xE2,0x28,0x2C,0xE9,0x0A,0x89,0xFB,
+	0xEB,0x00,0xEB,0x18,0xE1,0xF9,0x53,0xE0,0x62,0xF4,0xEE,
+	0xC7,0xA2,0x4C,0x52,0x23,0x08,0x15,0x92,0xB3,0xD9,0x85,
+	0xE7,0xB6,0x83,0xFB,0x81,0x62,0x4A,0x51,0xAA,0xE0,0x09,
+	0x9D,0x89,0x2E,0x3A,0x7F,0x2C,0x23,0x02,0x92,0x2E,0x30,
+	0x42,0x4C,0x7E,0xBA,0x6F,0x09,0xF0,0xD7,0x81,0x7A,0x3C,
+	0x99,0x54,0x76,0xF5,0x2F,0xA2,0x8D,0xC6,0x44,0x5C,0x62,
+	0xDB,0x33,0x87,0xF6,0xDE,0x39,0x26,0x30,0x85,0xC4,0x18,
+	0x3E,0x09,0x28,0x8F,0x02,0x8C,0x40,0xD7,0x4C,0x10,0xDA,
+	0x19,0x94,0xEB,0xF4,0x58,0x3D,0xFD,0x4D,0x61,0x66,0x66,
+	0x14,0x75,0x7C,0x8C,0x1A,0x25,0x59,0x25,0x62,0x0B,0x64,
+	0x23,0xAA,0xA3,0x99,0xF0,0x01,0x98,0x0D,0xD9,0x68,0x43,
+	0xD9,0x28,0x1E,0xD8,0x41,0x36,0x94,0xA2,0x9D,0x02,0x4F,
+	0x18,0xA7,0x47,0x07,0xC0,0xB6,0xE6,0xA8,0x5A,0x3D,0xFC,
+	0x70,0x43,0x39,0x4B,0x8B,0x17,0xA8,0x16,0x2C,0x75,0x16,
+	0x70,0xF9,0x13,0x81,0xBE,0x12,0xAC,0xFF,0x51,0x78,0xFF,
+	0x0A,0xD7,0x7B,0x2B,0xFF,0xF7,0x5E,0x7E,0xA0,0x8F,0xB3,
+	0x3F,0xE9,0xF4,0x90,0x9B,0xFD,0xB6,0x6F,0xAA,0x8C,0xC2,
+	0x10,0x82,0x6D,0xB0,0x93,0xC8,0xCE,0x81,0x2E,0x9A,0x3C,
+	0x92,0x61,0x17,0x50,0xC9,0x2C,0x3F,0x3C,0x86,0x77,0x90,
+	0x85,0x99,0x28,0x45,0x30,0x63,0x84,0x1B,0xC2,0x23,0x0E,
+	0xFE,0x8A,0x07,0x75,0x1E,0x82,0x9A,0x58,0xAD,0x54,0x30,
+	0x61,0xB4,0x9D,0x15,0x0D,0xCE,0x49,0x49,0x5A,0xD9,0xC1,
+	0x96,0x8D,0xA8,0x4E,0x07,0x98,0x44,0x3D,0xA2,0x47,0xD6,
+	0x1C,0x6D,0x5B,0xC1,0x95,0x73,0x9B,0x43,0x96,0x4C,0xBC,
+	0xAF,0x79,0x3D,0xB1,0x54,0xCE,0xD5,0x93,0xA5,0xDE,0x85,
+	0xED,0xE0,0x0F,0x59,0x27,0x48,0x69,0x43,0x04,0x76,0xC4,
+	0xC9,0xC4,0x41,0x3A,0xC3,0x3F,0xAA,0x3B,0x86,0xDC,0xBC,
+	0x7F,0x41,0xDC,0x1D,0xEA,0xCE,0x92,0xE9,0x76,0x8D,0x9A,
+	0x93,0xB1,0x3D,0x5B,0xC7,0x3C,0x46,0x12,0x8E,0x3F,0x36,
+	0x0E,0xEC,0x1F,0xDF,0x63,0x2F,0x39,0xD4,0x1F,0x54,0x73,
+	0x35,0x92,0x54,0x3C,0xEA,0x13,0x00,0xE1,0xFF,0xDE,0xE2,
+	0xE5,0x6A,0xC8,0xB2,0xBA,0x77,0xDB,0xD9,0xDD,0xF3,0x1A,
+	0xBA,0x3E,0xE7,0xA2,0xA1,0x72,0xCE,0x36,0xDC,0xD3,0xDC,
+	0x22,0x5C,0x7C,0x0A,0xFA,0xB6,0x8A,0xFB,0x47,0x26,0x15,
+	0xDA,0x18,0x94,0xAC,0x95,0x3E,0x12,0x74,0xB4,0xFB,0xFA,
+	0xAF,0x9C,0xA6,0xDB,0x3C,0x6A,0xDB,0x2D,0x51,0xFD,0x89,
+	0xED,0x94,0x0F,0x6A,0x2C,0xB6,0xD0,0x4C,0x08,0x2D,0x0A,
+	0xDE,0x0D,0xB3,0x3F,0x04,0x05,0x5A,0x03,0xEE,0x19,0x91,
+	0xC6,0x73,0x13,0x12,0xBD,0x53,0xBC,0xA3,0x06,0xB7,0xE8,
+	0xB6,0x85,0xB0,0x43,0x26,0xA3,0x3D,0xA3,0x5F,0x0C,0xA5,
+	0x69,0x9B,0x6A,0xB0,0x16,0x86,0x8D,0xFF,0x5C,0x34,0xD7,
+	0x6C,0x78,0xCF,0xE8,0xB8,0x21,0xD0,0xF2,0xB9,0xF0,0x71,
+	0x20,0xBA,0x68,0x90,0x5D,0xA4,0xC3,0xB0,0x7D,0xA5,0x16,
+	0x8F,0x7A,0x5A,0x7D,0x30,0xA5,0xC7,0x6A,0x4C,0xCB,0x93,
+	0xC5,0x20,0x4F,0xDB,0x3D,0x94,0xB3,0xC4,0x5A,0x63,0x2C,
+	0x77,0xE7,0x4B,0x4D,0x09,0xE6,0x36,0x44,0x78,0xEF,0x4A,
+	0x8E,0xE2,0xCA,0x98,0x2B,0x75,0xDC,0xAD,0x11,0x48,0x3D,
+	0xD5,0x1E,0x55,0xA5,0x1B,0xEA,0xD1,0xA4,0x53,0xD4,0x1F,
+	0x9F,0x28,0x10,0x3D,0x2C,0xDC,0x57,0xF7,0x38,0x26,0xA5,
+	0xE9,0x05,0x1F,0xA1,0x03,0x54,0x63,0x5B,0x34,0x85,0xED,
+	0x04,0xAB,0xC5,0xFD,0x9A,0xAD,0xA8,0xA8,0x5E,0x8F,0x18,
+	0x33,0x4F,0xE8,0x73,0xE3,0xD4,0xA3,0x9F,0x3F,0xDA,0x44,
+	0x16,0x91,0x5F,0x47,0x6D,0x8C,0x22,0x2F,0x08,0x7D,0x9B,
+	0xA1,0xB7,0x20,0xD1,0xF6,0xD6,0x56,0x8D,0x26,0x28,0x87,
+	0x24,0xC8,0x6B,0xE6,0x4F,0xB1,0x25,0xB2,0x45,0x2D,0xE4,
+	0x53,0xF4,0xAB,0x23,0x3C,0x8D,0x70,0x4D,0xCF,0x34,0x48,
+	0x40,0x9F,0xCB,0x09,0x9F,0x4B,0xDF,0x11,0x36,0x4A,0x96,
+	0x6C,0xDB,0x8F,0x91,0xAF,0x37,0x96,0xA8,0xB4,0x40,0xA5,
+	0x7F,0xB0,0x24,0x0F,0x50,0x2F,0x3A,0x28,0xEE,0xC5,0x19,
+	0x5D,0x8C,0x67,0x09,0x19,0x6D,0xCD,0x29,0x43,0x7D,0xB5,
+	0x38,0xAB,0xF7,0xCE,0xFF,0x74,0xA4,0xE8,0xFF,0xC1,0x28,
+	0x40,0x95,0xFA,0x43,0x11,0x6F,0x37,0xC8,0x4A,0x20,0xCE,
+	0xFC,0x50,0xB1,0xA2,0x99,0x70,0x59,0x10,0x97,0xEE,0xE7,
+	0xD4,0x3B,0x6D,0xA9,0x5E,0x2D,0x7B,0xEB,0x9D,0x17,0xBB,
+	0x73,0xC4,0xFB,0x45,0x47,0xF0,0x4C,0x31,0x27,0x31,0x98,
+	0xE3,0x97,0xFE,0x90,0x79,0xFD,0x27,0x00,0x02,0x01,0x1C,
+	0x50,0x04,0x0C,0x91,0x82,0x02,0xC0,0xAF,0xD0,0xA9,0x80,
+	0x1C,0xEC,0x04,0xFE,0x4B,0x2B,0x1E,0x04,0xEE,0x01,0x90,
+	0x39,0x43,0x60,0xB4,0x42,0xEB,0xD7,0x34,0x10,0x85,0x54,
+	0xF2,0x6B,0x19,0x03,0x6B,0x7D,0xAE,0x85,0x41,0x76,0x70,
+	0x94,0x91,0x03,0x00,0xB6,0x03,0x08,0x0D,0x1A,0x15,0x98,
+	0x80,0xA9,0x86,0x51,0xF1,0x77,0x02,0x8D,0x99,0x9D,0x4C,
+	0x63,0x33,0x73,0xC4,0x19,0x8A,0x8B,0x66,0xF5,0x0D,0x56,
+	0xF6,0x53,0xAB,0x97,0xFC,0x6D,0x49,0xE1,0x05,0x77,0x4B,
+	0x33,0xA6,0xDD,0x23,0x80,0x28,0xDF,0xFA,0xD1,0xF6,0x7D,
+	0xFC,0xE3,0xBF,0x2D,0x85,0xD9,0xE9,0x24,0x9F,0xB4,0x7B,
+	0xBE,0x0F,0x72,0x38,0xCC,0x04,0xE8,0x66,0xA2,0x38,0x15,
+	0x17,0xEA,0x60,0x9E,0xBB,0x15,0xF8,0x67,0xCD,0x8B,0xEF,
+	0xE3,0xE7,0x1D,0xE4,0xD2,0x7F,0x47,0xE4,0x3A,0x96,0xE2,
+	0xA8,0xB4,0x2B,0xCB,0x34,0x28,0xDF,0x08,0x8B,0x7F,0xD3,
+	0x11,0xD0,0x5E,0x2B,0xBA,0xCE,0x4B,0xA2,0xD2,0x4C,0x23,
+	0x9B,0x1D,0x4F,0xB8,0xA9,0x15,0x34,0x07,0x9F,0x12,0xA7,
+	0xDB,0x43,0x8F,0x6F,0xB0,0xA0,0xB9,0x98,0x1A,0x59,0xC0,
+	0xCD,0x3B,0x19,0x95,0xA1,0x66,0x8D,0x26,0x20,0x70,0xE5,
+	0x80,0xC0,0x80,0x1A,0x52,0x86,0x6F,0xB2,0x1C,0x8B,0x0E,
+	0xE1,0xAC,0x34,0x16,0xBA,0xF6,0x89,0x16,0xD5,0xE9,0xB2,
+	0x54,0xB4,0xF5,0xB8,0xD3,0x01,0x56,0x95,0xCD,0xB0,0xA1,
+	0xCE,0x5F,0xBB,0x44,0x4E,0xF7,0x88,0x9B,0xB9,0x29,0xC6,
+	0x69,0x88,0x2A,0x89,0xE1,0x41,0x63,0xDB,0xD4,0x43,0xE6,
+	0x74,0xE4,0x7E,0x94,0xF7,0xC4,0x22,0x95,0xD8,0x39,0x88,
+	0xAB,0x3F,0x6C,0x1B,0xC0,0x1E,0x69,0x61,0x72,0x1B,0xBD,
+	0x0F,0x2F,0x5E,0x73,0x07,0x4F,0x6D,0xE8,0x74,0xC6,0x2F,
+	0xBE,0x74,0x41,0x44,0x9A,0x74,0xBA,0x6A,0x8B,0xAD,0xC4,
+	0xA9,0x4E,0xA7,0xB3,0x68,0x9C,0x27,0x2C,0xDB,0xAF,0x18,
+	0x23,0xCE,0xEB,0xF5,0xA3,0x0C,0xD4,0xF8,0x89,0x6B,0x68,
+	0xCD,0xE7,0x3A,0x1F,0x2A,0xA8,0x5B,0xAE,0x8E,0xCA,0x72,
+	0x4B,0x93,0xD3,0x8D,0x65,0xB3,0x64,0x7A,0xCA,0x33,0x4B,
+	0xBC,0xDE,0x1C,0xC4,0xA9,0x89,0x09,0x1A,0xF4,0x02,0xA7,
+	0x94,0x6B,0x90,0xE7,0x20,0xDE,0x4D,0xA7,0xC1,0xFF,0x80,
+	0x21,0xDF,0xE1,0x00,0x59,0xA3,0xF5,0xFC,0xCB,0xFE,0x3C,
+	0xF0,0x5F,0x1B,0x51,0xC0,0xEA,0x20,0xD6,0x60,0x8B,0xD5,
+	0xDA,0x18,0x19,0xB4,0x07,0x05,0xBC,0xC6,0x19,0x24,0x6C,
+	0x69,0xD2,0x81,0x0E,0x3A,0x84,0x47,0xBD,0x44,0xDD,0xED,
+	0x33,0xBC,0x4F,0xEC,0x47,0x20,0xCD,0x9B,0x88,0xB7,0x5E,
+	0xA8,0x3C,0x0C,0xC9,0xC9,0x10,0x44,0x40,0x5C,0xFC,0xEA,
+	0x2E,0x69,0x13,0xA2,0x03,0x1B,0x63,0x1A,0xE4,0x42,0xED,
+	0x38,0x63,0x26,0x25,0x16,0xE8,0xE4,0xF3,0xE5,0x9E,0x9C,
+	0x78,0xA9,0xF5,0x50,0x93,0x01,0x53,0x8D,0x66,0x62,0xFA,
+	0x95,0xC1,0xB4,0x77,0x30,0x37,0xDA,0xB4,0x39,0x6C,0x3A,
+	0x3C,0x22,0xD7,0x1B,0xD8,0xE7,0xD3,0x74,0xE4,0xE6,0x51,
+	0xB3,0x5E,0xA7,0x28,0x40,0x27,0xBC,0x3A,0xAF,0x57,0x24,
+	0x00,0x4E,0x8B,0x27,0x54,0xB8,0xCB,0x80,0x19,0xE0,0x07,
+	0xF2,0xCC,0xF5,0x4F,0x8A,0x57,0xAD,0x5A,0xED,0x16,0xFA,
+	0xD4,0x6D,0x8F,0xF6,0x37,0x08,0xED,0x36,0x1A,0x49,0xB5,
+	0x35,0x3B,0x56,0x03,0xAE,0x9A,0x62,0x82,0x4A,0xDC,0x33,
+	0x72,0xCD,0x00,0xA8,0xE7,0x6C,0xD8,0x3E,0x49,0x4A,0xA0,
+	0xB7,0x88,0xE0,0x2C,0x30,0x60,0xBE,0xA6,0x84,0x1E,0xCE,
+	0x7F,0xE3,0x78,0x45,0xE9,0x8B,0x8B,0xE4,0x71,0x42,0x85,
+	0xA0,0x60,0xCE,0x47,0x62,0x6F,0x6D,0x80,0x6B,0xA4,0xF9,
+	0x79,0x79,0x14,0x25,0x60,0x17,0x58,0x02,0xA3,0x57,0x1A,
+	0xB9,0x39,0x4F,0x29,0x2A,0x6F,0x42,0xF3,0x80,0x49,0x40,
+	0xEF,0x3D,0x59,0x4F,0x17,0x14,0x0D,0x5D,0x52,0x01,0x1C,
+	0x80,0xA0,0xF2,0xF5,0x2C,0xE0,0x08,0xD0,0x0C,0x8C,0xAC,
+	0x03,0x5F,0x00,0x75,0x10,0x0B,0xE4,0x33,0x03,0x22,0x91,
+	0x27,0x1C,0x74,0x21,0xE7,0x69,0x35,0x46,0x26,0x09,0xCC,
+	0xF3,0xEC,0x1A,0x1B,0xA7,0x04,0x97,0xF3,0x5E,0x35,0x41,
+	0x3B,0x12,0x62,0xCF,0x4B,0x6A,0x64,0x99,0x09,0x39,0xE7,
+	0xF7,0xD6,0x14,0xEC,0x4F,0x28,0x3B,0xFF,0x47,0xCD,0xA1,
+	0x23,0x09,0xC7,0xCF,0xFF,0x55,0x73,0xA1,0x31,0xA1,0xE5,
+	0xFC,0xDD,0x9A,0xF6,0x87,0x09,0x7D,0xE7,0x87,0x6B,0x26,
+	0xDE,0x24,0x2C,0x9E,0xFF,0x5A,0xB3,0xEA,0x6F,0xE8,0x3B,
+	0x0E,0x78,0x2F,0x5F,0xD1,0xE1,0xB6,0x35,0x07,0x8B,0x4E,
+	0x9A,0x36,0x2E,0xF1,0xE9,0xAF,0x7D,0xC7,0x1A,0xF4,0x21,
+	0x1A,0x62,0xC3,0x0F,0x39,0xBA,0xF0,0x49,0xAA,0x2C,0x47,
+	0xC9,0xB0,0x3E,0x05,0x39,0x69,0x2A,0xCD,0x41,0xB0,0xA6,
+	0xE0,0xEF,0x2C,0x31,0x7F,0x23,0x3C,0xAC,0xF1,0x77,0x34,
+	0x44,0xD1,0x76,0xFC,0xD6,0x03,0xB6,0xBC,0x0B,0xB7,0x95,
+	0x1E,0x6B,0xC4,0x27,0x43,0xC4,0x77,0xD4,0xD2,0xE3,0xE8,
+	0x49,0xA2,0x83,0x82,0xAD,0x7C,0xE7,0x93,0xFC,0x0C,0x9F,
+	0xA2,0xAD,0xBB,0xCD,0xD3,0xD1,0x67,0x7F,0x5A,0x4A,0x11,
+	0x53,0xB6,0xD6,0x5F,0x5F,0xDB,0x1F,0x0A,0x71,0xCC,0x14,
+	0x39,0x4D,0xED,0xDA,0xA4,0x55,0xFD,0x9A,0x7B,0xDC,0xE5,
+	0xC3,0x1B,0xB7,0x7B,0x12,0xA5,0x01,0x4F,0xCC,0x4B,0xDF,
+	0xC7,0x08,0xEE,0xAD,0x3C,0x5F,0x6F,0x1F,0xD5,0xAF,0x60,
+	0xA9,0x52,0x13,0x81,0xA0,0xFA,0xDC,0x4A,0xF1,0x91,0xC5,
+	0x7A,0x17,0x08,0x9A,0x60,0x80,0xED,0xFF,0x62,0x19,0x02,
+	0x49,0x2A,0x80,0x2A,0x75,0x17,0x65,0x43,0x0F,0x88,0x13,
+	0x0E,0x3E,0xC4,0x31,0xC6,0xE9,0x43,0x29,0x68,0x4E,0x39,
+	0xB1,0x1C,0x21,0xB7,0xE4,0x08,0x29,0xC0,0x65,0xA7,0x49,
+	0xF4,0x59,0xC8,0x58,0xC9,0x5B,0x24,0xD8,0xDC,0x51,0x57,
+	0xA2,0x81,0x02,0x83,0xA8,0x96,0xBE,0x70,0x90,0x40,0xC3,
+	0x52,0x28,0x75,0x06,0x43,0x34,0xB2,0x36,0xF2,0xC0,0x50,
+	0xAA,0x7D,0xB9,0xAE,0x3A,0x4B,0xA0,0xC1,0xAE,0x05,0x7A,
+	0x6E,0x42,0x7A,0x28,0xE8,0x97,0x72,0xF6,0x47,0xE0,0x2D,
+	0x54,0xEF,0x2A,0x91,0xA3,0xC5,0x00,0x84,0x1C,0x50,0x45,
+	0x00,0x3C,0x9E,0xA3,0x95,0x0B,0x08,0x2B,0x40,0x15,0x67,
+	0xA1,0xEA,0x7C,0xEB,0xF7,0x14,0x30,0xE8,0x27,0xB4,0x16,
+	0x5C,0xBB,0x0E,0xD0,0xB6,0xD7,0x4D,0x40,0x54,0xAC,0xEC,
+	0x31,0xED,0x97,0x56,0x03,0xBC,0x7D,0x09,0x6F,0x0D,0x46,
+	0x80,0xE8,0x3A,0xC2,0x4D,0x8D,0x48,0x28,0x0C,0xEE,0x90,
+	0x83,0xC3,0xAF,0xC1,0x34,0xD6,0x09,0x30,0x75,0x70,0xA7,
+	0x6B,0x06,0x0C,0x16,0xEC,0xA6,0x36,0xB1,0xAE,0x4F,0x53,
+	0x73,0x60,0x26,0xAF,0x3B,0xBE,0x82,0xA9,0xB1,0x34,0xA8,
+	0x63,0xFA,0xD0,0x16,0x35,0x00,0xAA,0xAE,0xFF,0x35,0x19,
+	0x34,0x63,0x7D,0x2B,0xF3,0x1D,0x44,0xE0,0xCB,0xB7,0x16,
+	0x81,0x24,0x34,0x57,0xFF,0x00,0x31,0xC4,0xA5,0x0D,0xA0,
+	0xBF,0x54,0x12,0x8B,0x79,0xD7,0xCF,0x39,0x35,0x83,0x0E,
+	0x3A,0xB9,0x80,0xEF,0xA3,0x20,0x50,0x1C,0x12,0x26,0x00,
+	0x7A,0x71,0x7B,0xD4,0x34,0xD5,0x10,0xEF,0xE1,0x4A,0x38,
+	0x42,0x2F,0xB6,0x49,0x45,0xE7,0x37,0x06,0xA5,0xA6,0xD6,
+	0xA4,0x87,0xFA,0x05,0xC7,0x61,0x95,0x55,0xEF,0xAA,0xE3,
+	0xD0,0xD5,0x15,0x51,0xE7,0xD7,0xAB,0x72,0x2E,0x87,0xC8,
+	0xB9,0x1C,0xCD,0xD6,0x75,0x60,0xE3,0x20,0xB5,0x78,0xA8,
+	0xDF,0x00,0x0F,0xBB,0x58,0xDA,0x66,0x7C,0x57,0x01,0x86,
+	0xD4,0x8F,0x9D,0xA9,0x1A,0xA8,0x06,0x9C,0x37,0x57,0x00,
+	0xA6,0x95,0xA0,0xD9,0xDB,0x80,0x26,0x66,0xBB,0x10,0x52,
+	0x57,0x10,0x50,0x68,0xDD,0xD3,0x10,0xBE,0xC1,0xF0,0x27,
+	0x5A,0xB7,0xC8,0x9B,0x5C,0x8E,0xF3,0xFD,0x6C,0xE7,0x65,
+	0x25,0x8A,0x0E,0xB6,0x16,0x5A,0xF5,0x72,0x7B,0x22,0x81,
+	0x6E,0xE3,0x71,0x00,0xDF,0x69,0xA9,0xD2,0xA3,0xEC,0xBA,
+	0xD9,0xC4,0xDB,0x8C,0xEF,0x5E,0xCF,0x17,0x23,0x95,0xA9,
+	0x18,0x0A,0xC4,0xA8,0x17,0xD8,0xE4,0x6F,0xC8,0x40,0x57,
+	0xF6,0x6C,0xEA,0x71,0x09,0xF8,0x65,0x0C,0x68,0x00,0xEA,
+	0x15,0x3D,0xDB,0xC8,0x1A,0x51,0x76,0x78,0xF6,0x0E,0x4D,
+	0x5A,0xCC,0x79,0x75,0xAA,0xCB,0x18,0x76,0xB3,0x4B,0x4F,
+	0xBA,0x12,0x27,0x6A,0x1B,0x9B,0x81,0xCB,0xB4,0x80,0x2E,
+	0x6A,0x03,0x80,0x9C,0xFC,0x1B,0x7A,0x04,0x64,0x68,0x73,
+	0x0A,0xA7,0x6A,0x00,0xED,0x04,0x08,0xA4,0x9E,0x6E,0x7E,
+	0xDF,0x06,0x09,0x19,0x7A,0x2B,0x1C,0x82,0x47,0x00,0xFF,
+	0x5B,0x50,0xF9,0xFA,0x59,0x60,0x3D,0x1D,0x32,0x9B,0x0E,
+	0x48,0x57,0xB8,0xE5,0xED,0xA0,0x75,0x19,0x4C,0xDE,0x85,
+	0x38,0xD8,0x3E,0xFC,0x61,0x36,0x10,0x78,0x13,0x2B,0xFB,
+	0xBE,0x65,0x4B,0x9A,0x3A,0xA8,0xF7,0xFF,0x51,0x32,0x58,
+	0x4A,0xE6,0xAF,0x3C,0xB3,0xE8,0x9D,0xB5,0x03,0xD4,0x7B,
+	0xD3,0x11,0xDC,0x59,0x0B,0x40,0xF6,0x93,0xCB,0xCD,0xFB,
+	0x3D,0x0C,0x14,0x8C,0xAD,0x6D,0x98,0x95,0xAA,0x1E,0x54,
+	0x1C,0x00,0xD1,0x7F,0x55,0x7F,0x39,0x5B,0x7D,0x70,0x7C,
+	0xE1,0xDC,0xF0,0xF4,0xFF,0xC3,0xD7,0xA2,0xFD,0xA0,0x22,
+	0x04,0xA4,0x00,0xAD,0x2E,0xCC,0xFC,0x5F,0x3B,0xF8,0x7F,
+	0xFE,0xFF,0x04,0xAC,0xD4,0x91,0x8F,0x59,0x7F,0x10,0x01,
+	0xD7,0x3B,0xD0,0xBC,0xF0,0xAD,0x21,0xAC,0xB2,0xA1,0xAA,
+	0xE1,0x48,0x03,0xE8,0xC1,0xC1,0x07,0x16,0xED,0xA0,0x47,
+	0x46,0x20,0xB3,0x7A,0xF7,0x34,0x3C,0x27,0x7D,0xD9,0xCD,
+	0xCD,0x48,0xEE,0x54,0x93,0xFE,0xDD,0xC8,0x2E,0x10,0x92,
+	0xF9,0xA5,0x11,0xB2,0x30,0x93,0xF7,0x68,0x0D,0x90,0x3E,
+	0x9B,0x79,0xA5,0xF4,0x9F,0x75,0xDF,0x1D,0xD2,0xC1,0xA1,
+	0xBB,0x72,0x60,0xFE,0x7F,0x27,0xBA,0x43,0x92,0xFF,0xC7,
+	0xBA,0xFF,0x03,0xF6,0xE6,0x4B,0xB1,
 };
 
 struct BuiltinFileBlob bfb_CHKDSK_EXE = {
 	/*recommended file name*/	"CHKDSK.EXE",
 	/*data*/			bin_chkdsk_exe,
-	/*length*/			sizeof(bin_chkdsk_exe)
+	/*length*/			41778,
+	/*compressed length*/	sizeof(bin_chkdsk_exe)
 };
 
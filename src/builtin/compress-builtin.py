@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+#
+# Rewrite builtin file blobs as zlib compressed arrays.
+#
+# The large programs on the Z: drive are stored compressed and only inflated
+# when the guest first opens them (see VFILE_BuiltinFileBlobData in
+# src/dos/drive_virtual.cpp). Run this on a builtin .cpp file after it was
+# regenerated with xxd -i (update-dsxmenu.sh etc), for example:
+#
+#   ./compress-builtin.py 4dos.cpp mpxplay.cpp
+#
+# Blobs that are already compressed are left alone.
+
+import re
+import sys
+import zlib
+
+array_re = re.compile(r'static const unsigned char (\w+)\[\] = \{(.*?)\};', re.S)
+
+def format_array(name, data):
+    out = 'static const unsigned char %s[] = {\n' % name
+    for i in range(0, len(data), 11):
+        out += '\t' + ''.join('0x%02X,' % b for b in data[i:i+11]) + '\n'
+    return out + '};'
+
+def compress_file(path):
+    with open(path) as f:
+        src = f.read()
+    lengths = {}
+
+    def pack(m):
+        name = m.group(1)
+        if re.search(r'/\*compressed length\*/\s*sizeof\(%s\)' % name, src):
+            return m.group(0)
+        raw = bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', m.group(2)))
+        lengths[name] = len(raw)
+        return format_array(name, zlib.compress(raw, 9))
+
+    src = array_re.sub(pack, src)
+    for name, length in lengths.items():
+        src, n = re.subn(r'/\*length\*/(\s*)sizeof\(%s\)' % name,
+                         '/*length*/\\g<1>%u,\n\t/*compressed length*/\tsizeof(%s)' % (length, name), src)
+        if n != 1:
+            sys.exit('%s: no blob refers to %s' % (path, name))
+    with open(path, 'w') as f:
+        f.write(src)
+
+for path in sys.argv[1:]:
+    compress_file(path)
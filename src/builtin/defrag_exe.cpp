@@ -2,4511 +2,4884 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_defrag_exe[] = {
-  0x4d, 0x5a, 0xe6, 0x00, 0x6a, 0x00, 0x01, 0x00, 0x02, 0x00, 0xa5, 0x18,
-  0xff, 0xff, 0xb1, 0x25, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2b, 0x0d, 0xb9, 0x38, 0x69, 0xbe,
-  0x6e, 0xd2, 0x89, 0xf7, 0x1e, 0xa9, 0xb5, 0x80, 0x8c, 0xc8, 0x05, 0x05,
-  0x00, 0x8e, 0xd8, 0x05, 0x92, 0x18, 0x8e, 0xc0, 0xfd, 0xf3, 0xa5, 0xfc,
-  0x2e, 0x80, 0x6c, 0x12, 0x10, 0x73, 0xe7, 0x92, 0xaf, 0xad, 0x0e, 0x0e,
-  0x0e, 0x06, 0x1f, 0x07, 0x16, 0xbd, 0x01, 0x00, 0xbb, 0x0f, 0x80, 0x55,
-  0xcb, 0x55, 0x50, 0x58, 0x21, 0x0d, 0x03, 0x03, 0x08, 0x9e, 0x7a, 0x09,
-  0xbc, 0xe0, 0xa2, 0x70, 0x1d, 0xed, 0x5a, 0x02, 0xa0, 0xd1, 0x00, 0x4a,
-  0x7d, 0x02, 0x00, 0xad, 0xff, 0xba, 0x72, 0x1d, 0x2e, 0x89, 0x16, 0x06,
-  0x02, 0xff, 0xb4, 0x30, 0xcd, 0x21, 0x8b, 0x2e, 0x02, 0x00, 0xff, 0x8b,
-  0x1e, 0x2c, 0x00, 0x8e, 0xda, 0xa3, 0x7b, 0xff, 0x00, 0x8c, 0x06, 0x79,
-  0x00, 0x89, 0x1e, 0x75, 0x6f, 0x03, 0x2e, 0x8d, 0x00, 0xfd, 0xe8, 0x0d,
-  0x01, 0xc4, 0x3e, 0x73, 0xbf, 0x1b, 0xc7, 0x8b, 0xd8, 0xb9, 0xff, 0xff,
-  0x7f, 0xfc, 0xf2, 0xae, 0xe3, 0x3c, 0x43, 0x26, 0xff, 0x38, 0x05, 0x75,
-  0xf6, 0x80, 0xcd, 0x80, 0xf7, 0xed, 0xd9, 0x89, 0x0e, 0x1a, 0xb7, 0xb9,
-  0x39, 0xd3, 0xe3, 0xfd, 0x83, 0xc3, 0x10, 0x83, 0xe3, 0xf0, 0xb6, 0x34,
-  0x77, 0x3c, 0xff, 0xd2, 0x2b, 0xea, 0x8b, 0x3e, 0xaa, 0x33, 0xfe, 0x81,
-  0xff, 0x00, 0x02, 0x73, 0x07, 0xbf, 0xdb, 0x04, 0x89, 0x0c, 0xbf, 0xb1,
-  0x04, 0xd3, 0xef, 0x47, 0x3b, 0xff, 0xef, 0x73, 0x03, 0xe9, 0x79, 0x01,
-  0x8b, 0xdf, 0xdb, 0x03, 0xda, 0x28, 0x85, 0x77, 0x61, 0x89, 0x00, 0xa1,
-  0x6f, 0x68, 0x2b, 0xd8, 0x8e, 0xf6, 0xc0, 0xb4, 0x4a, 0x57, 0x82, 0xff,
-  0x5f, 0xd3, 0xe7, 0xfa, 0x8e, 0xd2, 0x8b, 0xbf, 0xe7, 0x2f, 0xfb, 0x33,
-  0xf6, 0xc0, 0x2e, 0x8e, 0x06, 0x9a, 0xb7, 0x3e, 0x35, 0xb9, 0xff, 0x12,
-  0x72, 0x2b, 0xcf, 0xfc, 0xf3, 0xaa, 0xb4, 0xed, 0x00, 0xcd, 0x1a, 0xad,
-  0xb7, 0x7f, 0x36, 0x0e, 0x81, 0xff, 0x00, 0x33, 0xed, 0xb8, 0x70, 0x1d,
-  0x8e, 0xd8, 0xfb, 0xbe, 0x00, 0x00, 0xbf, 0x18, 0xa1, 0x76, 0xdb, 0x00,
-  0x2b, 0xcb, 0x1e, 0x2e, 0xfb, 0xc6, 0x06, 0xb7, 0x01, 0x72, 0x05, 0xbf,
-  0xa6, 0x01, 0x00, 0xff, 0x36, 0x71, 0x74, 0x03, 0x6f, 0xd3, 0x6d, 0x4d,
-  0x6b, 0x69, 0xff, 0x00, 0x9a, 0x07, 0x00, 0xcb, 0x03, 0x50, 0x9a, 0xdb,
-  0xc8, 0x03, 0x35, 0xb8, 0xbe, 0x71, 0x3d, 0x08, 0x59, 0x08, 0x64, 0x9d,
-  0xfd, 0xff, 0x1e, 0xda, 0x31, 0xb3, 0x03, 0xde, 0x76, 0xe2, 0x31, 0x50,
-  0x11, 0x3d, 0x0e, 0xe8, 0x55, 0xbf, 0xf6, 0xec, 0xb4, 0x4c, 0x8a, 0x46,
-  0xb7, 0x04, 0x9c, 0xb9, 0x0e, 0xff, 0x00, 0xba, 0x2d, 0x00, 0xe9, 0xc1,
-  0x00, 0x1e, 0xb5, 0xb8, 0x92, 0xad, 0x0e, 0xbb, 0x86, 0x59, 0x25, 0xb6,
-  0x5b, 0x48, 0x04, 0xc6, 0x0c, 0x5d, 0x69, 0x5f, 0x64, 0x05, 0x66, 0x61,
-  0x96, 0x63, 0x06, 0x46, 0x65, 0x69, 0x67, 0x7c, 0x00, 0x25, 0x8c, 0xca,
-  0x2f, 0x5a, 0xba, 0x2c, 0x01, 0x6e, 0x13, 0x1f, 0xc3, 0xee, 0x42, 0x25,
-  0xc5, 0x16, 0xd7, 0x40, 0x0b, 0x36, 0x0a, 0x04, 0x69, 0x5d, 0x39, 0x05,
-  0xa4, 0x61, 0xe6, 0x06, 0x9f, 0x65, 0xcb, 0xb4, 0xff, 0xff, 0x8b, 0xd7,
-  0x8b, 0xde, 0x3b, 0xdf, 0x74, 0xff, 0x14, 0x80, 0x3f, 0xff, 0x74, 0x0a,
-  0x38, 0x67, 0xf6, 0x01, 0x77, 0x05, 0x8a, 0x04, 0xe1, 0x8b, 0xd3, 0x71,
-  0x7f, 0x06, 0xeb, 0xe8, 0x3b, 0xd7, 0x74, 0xfd, 0x20, 0x8b, 0xda, 0x1e,
-  0x07, 0x06, 0xbe, 0x1c, 0x00, 0xc6, 0x07, 0xff, 0xc7, 0xb7, 0x74, 0x07,
-  0xfe, 0x26, 0xff, 0x5f, 0x02, 0x1f, 0xeb, 0xc5, 0xd9, 0x06, 0x57, 0xbf,
-  0xbe, 0xc3, 0xb4, 0x40, 0xbb, 0x02, 0x77, 0x4b, 0xc3, 0xb9, 0x1e, 0x6d,
-  0xc3, 0x3b, 0x9f, 0xed, 0xe8, 0xea, 0xff, 0x85, 0xb8, 0x07, 0xb6, 0x50,
-  0xe2, 0x14, 0x17, 0xa5, 0x00, 0x04, 0xff, 0xc0, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x06, 0x16, 0xfb, 0x1e, 0xfb, 0xba, 0xe9, 0x24, 0xa6, 0x76, 0x81,
-  0xe7, 0x14, 0xfc, 0x30, 0xc0, 0x01, 0xf8, 0x50, 0x28, 0x0b, 0x5f, 0x49,
-  0x5a, 0x1f, 0x17, 0x07, 0xff, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcf, 0x55,
-  0x89, 0xda, 0xe5, 0x06, 0x99, 0xef, 0x20, 0xd8, 0x8b, 0x46, 0x06, 0xb5,
-  0xa3, 0x19, 0xbb, 0x05, 0x08, 0xa3, 0x43, 0x70, 0xba, 0x0a, 0xbe, 0x28,
-  0x1f, 0xb8, 0x24, 0x25, 0xee, 0xab, 0x07, 0x5d, 0xcb, 0xcf, 0x1f, 0x89,
-  0xe3, 0xef, 0x36, 0x8b, 0x47, 0x22, 0x73, 0x06, 0x23, 0xdb, 0xc5, 0x55,
-  0x0b, 0x48, 0x56, 0x0a, 0xd2, 0xdd, 0x50, 0x76, 0x08, 0xbe, 0x02, 0x06,
-  0x9a, 0x7e, 0x1d, 0xdf, 0x74, 0x83, 0xc4, 0x06, 0x8b, 0xff, 0xf0, 0x83,
-  0xfe, 0xff, 0x75, 0x02, 0xeb, 0x1a, 0xdb, 0xf7, 0x46, 0x44, 0x00, 0xf6,
-  0x74, 0x06, 0xf7, 0xc6, 0x31, 0xed, 0x75, 0x04, 0x26, 0xfe, 0xeb, 0x09,
-  0xc7, 0x06, 0x7d, 0x00, 0x05, 0x17, 0x35, 0xff, 0xff, 0xdf, 0x5e, 0x5d,
-  0x3a, 0x83, 0xfe, 0x3e, 0xd6, 0x30, 0x20, 0x75, 0x05, 0xb8, 0xdc, 0x1e,
-  0xeb, 0x1c, 0x6b, 0xa4, 0x0b, 0x76, 0xd1, 0xe3, 0x01, 0xbb, 0x7d, 0x8b,
-  0x56, 0xff, 0x06, 0x89, 0x97, 0x6e, 0x71, 0x89, 0x87, 0x70, 0xed, 0x71,
-  0xff, 0x06, 0x15, 0x6b, 0x38, 0x2c, 0x1d, 0x56, 0x8b, 0xbe, 0x61, 0x0b,
-  0xf6, 0x7c, 0x05, 0xde, 0x5b, 0x14, 0x7c, 0x09, 0x15, 0x48, 0xbf, 0xe4,
-  0xe8, 0x7c, 0x22, 0xeb, 0x11, 0x0a, 0x42, 0xdf, 0x32, 0xc7, 0x87, 0x78,
-  0x33, 0x6f, 0x52, 0x56, 0x9a, 0xd1, 0x75, 0x7e, 0x59, 0xdf, 0x59, 0xb0,
-  0x06, 0x50, 0xa0, 0xc4, 0xb6, 0x33, 0x03, 0xc5, 0x69, 0xc6, 0xa5, 0xc7,
-  0xbb, 0xb0, 0x2e, 0x6c, 0x0e, 0xdb, 0x8a, 0x16, 0x16, 0x8a, 0x97, 0x36,
-  0xb4, 0x02, 0x8d, 0xb7, 0x1f, 0xdf, 0x02, 0x1b, 0x55, 0xa0, 0xfb, 0xc8,
-  0x33, 0x24, 0x70, 0x8a, 0x70, 0x7f, 0x80, 0xe2, 0x8f, 0x0a, 0xc2, 0xa2,
-  0x6d, 0x0c, 0x5d, 0x87, 0x14, 0x8f, 0x30, 0xdd, 0xdd, 0xd2, 0xe2, 0xb2,
-  0x18, 0x7f, 0x58, 0xdb, 0x32, 0x06, 0x0a, 0x17, 0x20, 0x6e, 0x0c, 0x08,
-  0x09, 0x7e, 0x08, 0x24, 0xf7, 0x47, 0xc9, 0x33, 0x7c, 0x06, 0x50, 0x30,
-  0x71, 0x50, 0x4c, 0xba, 0x73, 0x55, 0xbd, 0x5c, 0x83, 0x8e, 0xdd, 0x2f,
-  0x67, 0xee, 0x71, 0x0b, 0xe1, 0xc0, 0x75, 0x09, 0x21, 0xbb, 0x9a, 0x1a,
-  0x01, 0x9c, 0xa1, 0x5d, 0x71, 0x42, 0x4d, 0x86, 0x73, 0xdc, 0x58, 0xcf,
-  0x4c, 0xc1, 0xe9, 0xb7, 0x16, 0x23, 0xa3, 0xf0, 0xf1, 0x71, 0x0e, 0xb8,
-  0x7b, 0xbb, 0xc3, 0xb8, 0x23, 0xa6, 0x78, 0x9a, 0x30, 0x23, 0x45, 0x44,
-  0xaf, 0x64, 0x70, 0xc2, 0xeb, 0x0c, 0x17, 0x1e, 0xff, 0x9f, 0x16, 0x11,
-  0xa1, 0xdd, 0x0a, 0xff, 0x0e, 0xae, 0x03, 0x52, 0x86, 0xe9, 0x6e, 0xf0,
-  0xe8, 0x10, 0xfd, 0x59, 0x9c, 0x19, 0x57, 0x34, 0xb8, 0x40, 0x2e, 0x75,
-  0x2b, 0x36, 0x97, 0x75, 0x8b, 0xc6, 0x8d, 0x05, 0x31, 0xf6, 0xb1, 0x06,
-  0xd3, 0xe8, 0x0e, 0xfe, 0x3b, 0x36, 0xe6, 0x31, 0x75, 0x12, 0xe6, 0x1a,
-  0x65, 0xcb, 0x04, 0x87, 0xd2, 0x00, 0xa3, 0x96, 0x87, 0x69, 0xba, 0x48,
-  0x1d, 0xe6, 0x96, 0xc8, 0x8d, 0xea, 0x2a, 0x03, 0xec, 0x0f, 0x3b, 0xc7,
-  0x2a, 0xbb, 0xdb, 0x04, 0x2b, 0x09, 0x9b, 0x31, 0x56, 0x4b, 0x4e, 0x79,
-  0x2e, 0x95, 0x2a, 0xef, 0xa9, 0x59, 0x8b, 0xf8, 0x83, 0x0b, 0x53, 0x75,
-  0xb5, 0x0b, 0x24, 0xf6, 0x4c, 0xa3, 0x49, 0xe9, 0xeb, 0xb6, 0xd3, 0xbb,
-  0x03, 0xc7, 0xc7, 0x4d, 0x5a, 0x1d, 0xd6, 0x4a, 0x3d, 0xb5, 0xd3, 0xbe,
-  0xcb, 0x5d, 0xc2, 0x04, 0x00, 0xfd, 0xc8, 0x0e, 0x85, 0x76, 0x63, 0x83,
-  0x00, 0xe6, 0xcd, 0x6d, 0xfe, 0x04, 0xe8, 0x98, 0x36, 0x72, 0x20, 0xd9,
-  0x12, 0x8d, 0xa4, 0x8b, 0x3f, 0x85, 0x36, 0x77, 0x0d, 0x73, 0xb1, 0x02,
-  0x5b, 0x0a, 0x4e, 0xba, 0xff, 0xbe, 0x05, 0x3b, 0x02, 0xeb, 0x02, 0x0d,
-  0xd8, 0xc3, 0x1f, 0x05, 0xec, 0x6d, 0x80, 0x16, 0x75, 0x32, 0x87, 0xb2,
-  0x2d, 0x4e, 0xcb, 0x5e, 0xc1, 0xfe, 0x35, 0x89, 0x46, 0xfc, 0x89, 0x56,
-  0xfe, 0xc9, 0x57, 0x6e, 0x0d, 0xe8, 0x43, 0xd9, 0x54, 0x13, 0x2e, 0xfe,
-  0xfd, 0x12, 0x30, 0x36, 0xb6, 0xb9, 0xba, 0x47, 0xbf, 0x4a, 0x22, 0xa1,
-  0x6d, 0x3f, 0x8b, 0xcd, 0xe2, 0x34, 0xb6, 0xf8, 0x3a, 0xfa, 0xd9, 0x69,
-  0xfe, 0x7c, 0xfc, 0xe8, 0xe4, 0xfe, 0xc3, 0x85, 0x6d, 0xdc, 0x2e, 0x97,
-  0xfa, 0xf8, 0x8b, 0xb1, 0xe5, 0x6c, 0xdb, 0x56, 0xbe, 0x2e, 0xc4, 0xe3,
-  0x5e, 0x06, 0x26, 0xc0, 0x70, 0x12, 0x3b, 0xb5, 0x19, 0x74, 0xbb, 0xb7,
-  0x94, 0x00, 0x0e, 0xf1, 0x83, 0x7f, 0xbb, 0x50, 0x74, 0x33, 0x06, 0x42,
-  0x3b, 0xe3, 0x7d, 0x13, 0xcc, 0x07, 0xc8, 0x05, 0x0e, 0x06, 0xd9, 0x42,
-  0x74, 0x6f, 0x71, 0x22, 0xed, 0xf7, 0x47, 0x02, 0xed, 0xd2, 0x74, 0x0f,
-  0x7c, 0xee, 0x77, 0x0a, 0x03, 0xf7, 0x08, 0x9a, 0xbe, 0x36, 0x1f, 0xbf,
-  0x19, 0x80, 0x7f, 0x6f, 0x18, 0x7c, 0x0e, 0x26, 0xf0, 0x8a, 0x47, 0x04,
-  0x98, 0xbb, 0xbe, 0xd3, 0x02, 0x16, 0x82, 0x4a, 0xbf, 0x17, 0xc7, 0x47,
-  0x73, 0x0b, 0x05, 0xa7, 0x06, 0xba, 0x07, 0x04, 0xc6, 0xdb, 0x21, 0xff,
-  0x6a, 0xa5, 0x10, 0xb7, 0x1f, 0xfb, 0x33, 0xd2, 0xdd, 0x50, 0x52, 0x48,
-  0x10, 0xf6, 0xe8, 0x3e, 0x13, 0x52, 0x36, 0xec, 0x88, 0x2f, 0x4d, 0xde,
-  0x35, 0xd0, 0x1f, 0xd1, 0x9b, 0x5e, 0x83, 0xf4, 0x46, 0x28, 0xdb, 0x27,
-  0x75, 0x6e, 0x6e, 0x98, 0x45, 0x8d, 0xe9, 0xb6, 0x60, 0xbb, 0x37, 0x06,
-  0xf9, 0x6f, 0xe9, 0xa7, 0x11, 0x7e, 0xb7, 0x7c, 0x4e, 0xf5, 0xa1, 0xbb,
-  0xf7, 0x75, 0x15, 0x1f, 0xa1, 0x0e, 0x77, 0xbd, 0x83, 0xc2, 0x05, 0x3b,
-  0xdf, 0x39, 0x35, 0x26, 0x39, 0x57, 0x0c, 0xde, 0x75, 0x2f, 0x25, 0xf6,
-  0x83, 0x1c, 0x17, 0x18, 0x23, 0x12, 0x75, 0x14, 0x0a, 0xbf, 0x03, 0x57,
-  0x08, 0x26, 0x89, 0x57, 0x95, 0x0c, 0xbe, 0x20, 0xeb, 0x50, 0xeb, 0x4e,
-  0xcd, 0x68, 0xb8, 0x03, 0x03, 0x07, 0xe6, 0x59, 0x09, 0xf6, 0x07, 0x2b,
-  0xc6, 0x19, 0xec, 0x07, 0x56, 0x29, 0x8d, 0xcc, 0xc2, 0xf6, 0xf1, 0xf4,
-  0x19, 0xfd, 0xb5, 0x08, 0x3b, 0xc6, 0x68, 0xcf, 0x41, 0x2c, 0x06, 0x20,
-  0x8d, 0xf8, 0xf6, 0x26, 0x81, 0x4f, 0x02, 0xcd, 0xf6, 0xe9, 0x55, 0xff,
-  0xee, 0xa4, 0xf1, 0x1c, 0xec, 0x04, 0x6a, 0xad, 0x5f, 0xac, 0xbe, 0x14,
-  0x00, 0xc7, 0x0d, 0xc1, 0x31, 0xfb, 0x8c, 0x5e, 0xfe, 0xeb, 0x1d, 0x2f,
-  0x67, 0xfc, 0x5b, 0x4e, 0x74, 0x84, 0x0e, 0xb9, 0xc2, 0x7a, 0x0e, 0x47,
-  0x83, 0xd8, 0x22, 0x14, 0x58, 0x08, 0x4e, 0x60, 0xc5, 0xb1, 0xc3, 0xc7,
-  0xa1, 0x6d, 0xc1, 0x86, 0xed, 0x7d, 0x33, 0xf6, 0x33, 0x28, 0x6d, 0x6e,
-  0xc5, 0x0c, 0xff, 0x46, 0xdf, 0x84, 0x8a, 0x07, 0x8a, 0xd0, 0xc2, 0x3c,
-  0x72, 0x20, 0xc6, 0xbe, 0xda, 0xc7, 0xbf, 0xdd, 0x78, 0x1f, 0x80, 0xfa,
-  0x77, 0xdb, 0x5e, 0xbe, 0x4d, 0x76, 0xeb, 0x08, 0x09, 0xf2, 0x61, 0x75,
-  0x0b, 0xf6, 0x09, 0xb9, 0x80, 0x19, 0xcb, 0x02, 0x05, 0x6e, 0x83, 0xe9,
-  0x85, 0x19, 0x2d, 0x9b, 0x32, 0x3a, 0x9b, 0x1f, 0x2b, 0xde, 0x74, 0x13,
-  0x0f, 0x05, 0x63, 0xed, 0x2b, 0x75, 0x27, 0x0d, 0xed, 0x74, 0x74, 0x05,
-  0x04, 0xee, 0x62, 0x75, 0x1d, 0x17, 0x6b, 0x4e, 0x27, 0x0d, 0xbf, 0x7f,
-  0x25, 0xfc, 0xff, 0x0d, 0x04, 0x4c, 0x1c, 0xdd, 0x46, 0x01, 0xbf, 0xae,
-  0xa3, 0x26, 0xff, 0x75, 0x06, 0x81, 0xce, 0x00, 0x40, 0xeb, 0x1e, 0x7b,
-  0x2c, 0x0a, 0xff, 0x80, 0xeb, 0x0f, 0xa1, 0xa0, 0x33, 0xfb, 0x25, 0x00,
-  0xc0, 0x0b, 0xf0, 0x2d, 0x6d, 0xa9, 0x0e, 0xfb, 0x74, 0x04, 0x81, 0xcf,
-  0x40, 0xdf, 0x60, 0x06, 0xdd, 0x73, 0x21, 0x1b, 0xbd, 0x05, 0xe0, 0x31,
-  0x00, 0xc1, 0x74, 0x30, 0xad, 0x37, 0x05, 0xe1, 0x04, 0x8b, 0xc1, 0x44,
-  0x9e, 0xcb, 0x97, 0x39, 0x0c, 0x00, 0x09, 0x0e, 0xa4, 0x16, 0xfe, 0x16,
-  0x8d, 0x46, 0xfe, 0x50, 0xea, 0x04, 0xfc, 0xdb, 0xa6, 0x1b, 0xd9, 0xc3,
-  0x5b, 0x47, 0x02, 0x7a, 0x46, 0x26, 0x5b, 0x38, 0x7d, 0x33, 0x60, 0x14,
-  0x8c, 0x1a, 0x0a, 0x77, 0x9b, 0x9a, 0xfd, 0x27, 0x08, 0x6a, 0xbe, 0x25,
-  0x88, 0x17, 0x7b, 0x0a, 0xc0, 0xde, 0x7d, 0x14, 0x0a, 0x3c, 0x5b, 0x66,
-  0x71, 0x34, 0x58, 0x0d, 0x6a, 0x69, 0x78, 0x13, 0x4e, 0x9a, 0xa3, 0xd8,
-  0x9a, 0x00, 0xfb, 0xc7, 0x09, 0x12, 0xc3, 0x90, 0x05, 0x98, 0xb6, 0xb8,
-  0x02, 0x50, 0xf0, 0x0c, 0x8c, 0xa5, 0x74, 0x0e, 0x7f, 0x9e, 0x8c, 0x50,
-  0x33, 0x93, 0x6c, 0x65, 0x0e, 0xbe, 0x0c, 0x9a, 0x6a, 0x13, 0x7b, 0x0c,
-  0x37, 0xac, 0x0f, 0x11, 0x18, 0x19, 0x47, 0x95, 0xeb, 0xa0, 0x78, 0x39,
-  0xf4, 0xa4, 0xd2, 0x87, 0x0e, 0xad, 0xa0, 0xb2, 0xe5, 0xcc, 0xc2, 0xd4,
-  0x1a, 0x59, 0x15, 0xfc, 0x3a, 0x0c, 0x60, 0xa8, 0xf0, 0xc6, 0x3d, 0x2e,
-  0xa1, 0x72, 0xea, 0xc9, 0x15, 0xb1, 0x06, 0xa2, 0xa4, 0x06, 0xc7, 0xd2,
-  0x98, 0x6e, 0x3d, 0x4b, 0xf8, 0xb9, 0x93, 0xff, 0xec, 0x0b, 0xc2, 0x75,
-  0x22, 0xe3, 0x15, 0x10, 0x34, 0x9b, 0x91, 0x83, 0x83, 0x01, 0x71, 0xe8,
-  0xc7, 0xfe, 0x82, 0x08, 0x96, 0x0a, 0x0e, 0x4f, 0x0e, 0x74, 0x67, 0x2d,
-  0x22, 0x2d, 0x10, 0xcc, 0xab, 0xa8, 0x16, 0x0c, 0x6c, 0x3a, 0x27, 0x8c,
-  0xfe, 0x18, 0x84, 0x7d, 0x83, 0x7e, 0x06, 0xbd, 0x86, 0x0d, 0xe8, 0x48,
-  0x91, 0x70, 0xdc, 0x1f, 0xa3, 0x06, 0xe4, 0x0e, 0x58, 0xcc, 0x7a, 0x21,
-  0x13, 0x87, 0x79, 0xde, 0xe8, 0x4c, 0x7a, 0x32, 0xc6, 0x43, 0xcf, 0x2c,
-  0x30, 0x69, 0x0a, 0x27, 0x0f, 0xeb, 0x0b, 0x7a, 0x12, 0x5f, 0x2a, 0x99,
-  0x33, 0xc2, 0x2b, 0x8d, 0xc2, 0x30, 0x02, 0x41, 0xbc, 0x0e, 0x30, 0x63,
-  0xd5, 0x0c, 0xd7, 0x43, 0x43, 0x0c, 0xa5, 0x3d, 0x9a, 0x0e, 0x0c, 0xd6,
-  0x71, 0x74, 0x85, 0xef, 0x63, 0x3c, 0x25, 0x81, 0xeb, 0x18, 0x70, 0x4e,
-  0xfc, 0x8f, 0x19, 0x3f, 0x0a, 0x75, 0xc6, 0x01, 0x47, 0xef, 0x60, 0x50,
-  0xf7, 0xcd, 0xd3, 0xf6, 0xb2, 0x46, 0x15, 0x14, 0x82, 0x05, 0x04, 0x75,
-  0xd6, 0xa6, 0x46, 0x04, 0x53, 0x6d, 0x65, 0xd8, 0xf5, 0x0e, 0x01, 0x75,
-  0x19, 0x83, 0x13, 0x7e, 0xb3, 0x10, 0x24, 0xf8, 0xe8, 0x4b, 0xff, 0x99,
-  0x29, 0x97, 0x8b, 0x19, 0x56, 0xbf, 0x0c, 0x18, 0x81, 0x67, 0xeb, 0x02,
-  0x5f, 0xfe, 0x0c, 0x34, 0x90, 0xcd, 0x84, 0xe8, 0xdc, 0xec, 0x30, 0x39,
-  0x71, 0xb4, 0x25, 0x8c, 0x69, 0x83, 0x0b, 0x51, 0x75, 0xda, 0x0a, 0x3d,
-  0x5d, 0x04, 0xb6, 0xb0, 0x82, 0x03, 0xf6, 0x4d, 0x29, 0x7b, 0xa4, 0x15,
-  0x85, 0x82, 0x4b, 0x6c, 0x7b, 0x1c, 0x7d, 0x12, 0x83, 0xcf, 0xed, 0xfe,
-  0x99, 0x01, 0x18, 0x96, 0x11, 0xeb, 0xc3, 0x8d, 0xcd, 0xbd, 0xfe, 0xfc,
-  0x2c, 0xfe, 0x64, 0x00, 0xbf, 0x4f, 0xb4, 0x2a, 0x16, 0x6a, 0xbf, 0x3b,
-  0x89, 0x0f, 0x75, 0x8e, 0x02, 0x9c, 0x12, 0x2c, 0x94, 0x85, 0x76, 0x0e,
-  0xce, 0xfb, 0x47, 0x0a, 0xaa, 0xb8, 0xe8, 0x32, 0x06, 0x61, 0x17, 0x7d,
-  0x5a, 0x31, 0xb8, 0x48, 0x0a, 0x2b, 0x9c, 0x05, 0x0a, 0xe8, 0xdc, 0x1c,
-  0xeb, 0x1b, 0x21, 0xfc, 0xfc, 0x06, 0x56, 0xe8, 0x80, 0x29, 0x0b, 0x5e,
-  0x57, 0xe1, 0xe8, 0xcc, 0x05, 0x3c, 0x76, 0xd1, 0xe0, 0x88, 0xf6, 0x0e,
-  0x46, 0x3b, 0x36, 0xe3, 0x7e, 0xe0, 0xf2, 0x93, 0x84, 0x33, 0x50, 0x64,
-  0x39, 0x6e, 0x33, 0x99, 0x4c, 0x9b, 0x42, 0x39, 0x64, 0x92, 0x23, 0x0b,
-  0x00, 0x06, 0x75, 0x3c, 0x7e, 0xf6, 0xd2, 0x57, 0x8e, 0x0e, 0xa3, 0x05,
-  0x1a, 0x88, 0x24, 0xc6, 0x79, 0x10, 0xcd, 0x56, 0x37, 0x23, 0x03, 0xd0,
-  0x52, 0x4d, 0x26, 0x2b, 0xb6, 0xc7, 0x0a, 0x10, 0x6e, 0xe8, 0x7f, 0x05,
-  0xc1, 0xb2, 0xee, 0x5c, 0x89, 0x7e, 0xfe, 0x86, 0x0c, 0x35, 0x4b, 0x36,
-  0xfa, 0x6c, 0x55, 0x3b, 0x2d, 0xad, 0x7d, 0x38, 0x4f, 0xe6, 0x19, 0x18,
-  0xbc, 0x12, 0x2b, 0x6b, 0x90, 0x42, 0x34, 0xdc, 0x29, 0x4d, 0x15, 0xfe,
-  0x93, 0x3d, 0xb2, 0xbd, 0x28, 0x99, 0xd7, 0xa2, 0xa9, 0x08, 0x30, 0xb9,
-  0x56, 0x33, 0xf8, 0xee, 0x04, 0x03, 0x76, 0x35, 0xe4, 0xb2, 0x48, 0x03,
-  0x81, 0x81, 0x76, 0x75, 0xcd, 0xa3, 0x21, 0x56, 0x07, 0xb8, 0xba, 0xd0,
-  0x0d, 0x50, 0xba, 0xbd, 0xfc, 0x31, 0x10, 0xa3, 0x56, 0x62, 0xcb, 0x0a,
-  0x95, 0xa4, 0x23, 0x40, 0x18, 0x08, 0xea, 0xad, 0x48, 0xe1, 0x92, 0x98,
-  0xdf, 0xe8, 0xf8, 0x98, 0xb7, 0x7f, 0x47, 0x0c, 0x20, 0x87, 0x1c, 0x17,
-  0xf0, 0xef, 0xf2, 0x71, 0x28, 0x0b, 0xd2, 0xff, 0xdd, 0x7d, 0x4f, 0x2e,
-  0x40, 0x30, 0xce, 0xc7, 0x77, 0x36, 0x33, 0xff, 0xd4, 0x2c, 0x2b, 0x53,
-  0x1f, 0x54, 0xa9, 0xe8, 0x30, 0x76, 0x14, 0x8e, 0x59, 0x83, 0x81, 0x3f,
-  0x74, 0x25, 0x80, 0x3e, 0x6d, 0x13, 0x0a, 0x1a, 0xae, 0xfe, 0x06, 0x0d,
-  0x75, 0x17, 0xcc, 0x5c, 0x65, 0xa8, 0x83, 0xb7, 0x18, 0xfa, 0x36, 0x15,
-  0xf2, 0x07, 0x17, 0x07, 0xb4, 0xca, 0x90, 0xc6, 0x07, 0x02, 0x5b, 0x0b,
-  0x12, 0xc1, 0x8e, 0x34, 0xeb, 0xd9, 0xc1, 0x0a, 0xc4, 0x00, 0x01, 0x9c,
-  0x9d, 0x69, 0xe0, 0x56, 0xb0, 0x4d, 0x46, 0x96, 0x59, 0xb0, 0xf4, 0x28,
-  0xdb, 0x82, 0xf7, 0xd8, 0x9a, 0x2a, 0xe4, 0x22, 0x26, 0x14, 0x48, 0xc5,
-  0xb1, 0x0e, 0x62, 0xb6, 0xe0, 0x5b, 0x23, 0x20, 0xd6, 0x11, 0x9d, 0x0c,
-  0x40, 0xb0, 0x1c, 0xc1, 0x50, 0x44, 0xa8, 0xa4, 0xd4, 0x47, 0x83, 0x18,
-  0x2f, 0x91, 0x35, 0xdb, 0x3d, 0x01, 0x1b, 0x1f, 0x26, 0xdb, 0x31, 0x50,
-  0x2f, 0xd9, 0x1e, 0x18, 0x35, 0xd2, 0x98, 0x45, 0x9d, 0x0d, 0xbd, 0x5c,
-  0x21, 0xff, 0xa0, 0xaa, 0x27, 0xda, 0xef, 0x5e, 0x32, 0xcf, 0x42, 0x98,
-  0x23, 0x21, 0x78, 0xe8, 0x93, 0xfe, 0x61, 0x71, 0x92, 0x8f, 0x86, 0x90,
-  0xac, 0xfe, 0x3a, 0xdf, 0xb2, 0x2e, 0x5e, 0xd7, 0x0f, 0x23, 0x5b, 0x11,
-  0x0a, 0x2a, 0x6b, 0x9a, 0x07, 0x61, 0x5b, 0x31, 0x61, 0x3a, 0x70, 0x93,
-  0x7e, 0xd6, 0x69, 0x01, 0xb3, 0x20, 0xf5, 0xd7, 0xe9, 0x5d, 0x01, 0x92,
-  0x73, 0xec, 0x6f, 0xc8, 0x00, 0x3b, 0x3a, 0x09, 0xe5, 0x9c, 0xf8, 0x39,
-  0x77, 0x06, 0x73, 0x3a, 0x43, 0x43, 0x78, 0x4f, 0x40, 0x43, 0xf4, 0xba,
-  0x56, 0x9b, 0xf8, 0x3d, 0xd8, 0xc3, 0x48, 0xdb, 0x4e, 0x73, 0x1d, 0x7d,
-  0x9c, 0xe9, 0x05, 0x01, 0x67, 0xda, 0x03, 0xef, 0xc6, 0x7c, 0x26, 0x43,
-  0xc3, 0x75, 0x0c, 0xc4, 0x6b, 0x26, 0x2b, 0xf7, 0x82, 0x72, 0xad, 0xab,
-  0x64, 0x4f, 0x6d, 0x6f, 0xd9, 0x69, 0xff, 0x50, 0x62, 0xe0, 0xe4, 0xb2,
-  0x92, 0xff, 0xf7, 0x9a, 0xf6, 0x26, 0x52, 0xd8, 0x0a, 0x49, 0x61, 0xad,
-  0xed, 0x01, 0x16, 0x89, 0xe9, 0x32, 0x59, 0x7c, 0x02, 0xd8, 0x4a, 0x1e,
-  0xd4, 0x2c, 0x2b, 0xd8, 0x1a, 0xc6, 0x05, 0x3d, 0x5e, 0xeb, 0x53, 0x98,
-  0x3f, 0xf6, 0x87, 0x6a, 0xe1, 0x7d, 0x26, 0xf0, 0xd4, 0xad, 0x75, 0x05,
-  0x83, 0x5f, 0x6a, 0x70, 0xc3, 0x5b, 0xe1, 0xf5, 0x26, 0x0f, 0x17, 0x8b,
-  0xb7, 0xd8, 0x5f, 0x88, 0x17, 0xc2, 0x8a, 0xc2, 0x70, 0xe1, 0xeb, 0x17,
-  0x41, 0x21, 0x0d, 0x40, 0xfe, 0x90, 0xfc, 0x5b, 0x61, 0xbc, 0x84, 0xfe,
-  0x3e, 0xe0, 0xa6, 0x56, 0xfe, 0x89, 0x53, 0xf4, 0x92, 0x19, 0xf1, 0x94,
-  0xfe, 0x27, 0xba, 0x0a, 0x87, 0x00, 0xa7, 0x02, 0x7f, 0x0e, 0xf1, 0x2b,
-  0xa4, 0x2d, 0x6c, 0xf0, 0x0e, 0xe1, 0x56, 0xd1, 0x1e, 0xe8, 0x36, 0xfe,
-  0xd0, 0x30, 0x27, 0x90, 0x1e, 0x63, 0x10, 0xb8, 0x6a, 0x32, 0x49, 0x58,
-  0xb5, 0x3d, 0x0b, 0x9d, 0x1a, 0x03, 0xc1, 0x15, 0xf3, 0x3d, 0x4c, 0x4c,
-  0x4d, 0x24, 0xd1, 0x52, 0xb2, 0xfb, 0xc8, 0xa0, 0xcc, 0x33, 0xad, 0x52,
-  0xd6, 0xc1, 0xc1, 0xbf, 0x73, 0x5b, 0xf7, 0xf3, 0x88, 0x46, 0xb4, 0xff,
-  0x0c, 0x6b, 0xc3, 0x12, 0x7f, 0xb6, 0x00, 0xf7, 0xea, 0x8a, 0xd1, 0xe0,
-  0x2a, 0xd0, 0x88, 0x5e, 0x2e, 0x8a, 0x66, 0xff, 0x96, 0x92, 0xfe, 0x0c,
-  0x03, 0x91, 0x8d, 0xf9, 0x17, 0xfe, 0xad, 0x3b, 0x17, 0x74, 0x0d, 0x8d,
-  0x1d, 0x56, 0xd8, 0xf7, 0xe8, 0x2b, 0x0e, 0x0e, 0xfd, 0x89, 0x17, 0xfe,
-  0xc2, 0x3a, 0xdf, 0x3a, 0x72, 0x04, 0xfe, 0xc6, 0xb2, 0x16, 0x7f, 0x76,
-  0x17, 0x33, 0x8d, 0x4d, 0x58, 0xb6, 0xcb, 0x0a, 0xe8, 0xd6, 0xa2, 0x09,
-  0x67, 0xa9, 0x2b, 0xd7, 0x70, 0x7c, 0x3b, 0x06, 0xd1, 0x33, 0x75, 0x58,
-  0x04, 0x6d, 0x12, 0x86, 0xf6, 0xc0, 0x89, 0x0c, 0x30, 0x05, 0x2b, 0x0d,
-  0x22, 0x65, 0xfe, 0x90, 0x08, 0x90, 0x2b, 0x28, 0x21, 0xa0, 0x61, 0x41,
-  0xcb, 0x89, 0x40, 0x41, 0xc2, 0x93, 0xf8, 0x0b, 0xff, 0x74, 0x18, 0xba,
-  0xc3, 0xfc, 0x79, 0xfa, 0x77, 0x63, 0xff, 0x8b, 0x09, 0x2f, 0x70, 0x9f,
-  0x0d, 0xba, 0x17, 0xeb, 0x0a, 0x31, 0x49, 0xd6, 0x37, 0x83, 0x49, 0xc1,
-  0x02, 0xb6, 0x9c, 0xf6, 0xfb, 0xdd, 0x1d, 0x27, 0xfe, 0x20, 0xd6, 0x3b,
-  0xe2, 0xfb, 0xc6, 0x8a, 0xdc, 0xb9, 0x57, 0x5d, 0x2e, 0x09, 0xef, 0xe8,
-  0x70, 0x0d, 0x2c, 0xe6, 0x0a, 0x26, 0x89, 0xc3, 0x0a, 0x02, 0x12, 0x09,
-  0x19, 0x61, 0x04, 0x96, 0xab, 0xa3, 0xfa, 0x6c, 0xf8, 0xda, 0x70, 0x50,
-  0x0d, 0x67, 0xfe, 0x0a, 0x3e, 0xa0, 0xcd, 0x19, 0x2a, 0xdf, 0x1d, 0x1b,
-  0x83, 0x3e, 0xd3, 0x33, 0x6d, 0x55, 0x14, 0x9b, 0xb1, 0x95, 0x35, 0x7f,
-  0x67, 0xaf, 0x23, 0xeb, 0xb2, 0x12, 0x13, 0x3d, 0x00, 0xff, 0x87, 0x3c,
-  0xcc, 0x30, 0x6b, 0x6e, 0xcb, 0x06, 0xff, 0xd0, 0x39, 0x4e, 0x0a, 0x77,
-  0x24, 0x6f, 0x04, 0x06, 0x77, 0x1f, 0x03, 0x50, 0x4b, 0x3b, 0x7f, 0xfd,
-  0x17, 0x39, 0x56, 0x08, 0x77, 0x12, 0xb5, 0x04, 0x04, 0x6b, 0xb5, 0xfc,
-  0xdb, 0x88, 0x7f, 0x61, 0xfb, 0x84, 0x43, 0x14, 0xe1, 0xbb, 0x7b, 0x1f,
-  0x0f, 0xb1, 0x20, 0xeb, 0x5e, 0xb3, 0xd9, 0xb3, 0x0f, 0x70, 0x08, 0x02,
-  0x77, 0x22, 0x04, 0x7e, 0xf0, 0xb0, 0x5e, 0x25, 0x6d, 0x81, 0x67, 0xb3,
-  0x00, 0xa6, 0x4f, 0x12, 0x3a, 0xbd, 0x01, 0xa9, 0x3f, 0x8c, 0x30, 0x01,
-  0x80, 0xee, 0x7e, 0x04, 0x01, 0x12, 0xe1, 0x27, 0x01, 0xfe, 0x7e, 0x5b,
-  0x02, 0x0a, 0x2c, 0x08, 0xb6, 0x06, 0x14, 0xe6, 0x0e, 0x06, 0x85, 0x91,
-  0xf3, 0x68, 0x11, 0xe6, 0x05, 0x05, 0xc8, 0x0c, 0xc8, 0x06, 0xce, 0x08,
-  0xfb, 0x17, 0x40, 0x18, 0x07, 0x9a, 0x64, 0xa1, 0x0b, 0xa0, 0x10, 0xbd,
-  0x48, 0x86, 0x60, 0xff, 0xec, 0x26, 0x32, 0xa5, 0x8e, 0x25, 0xd9, 0x0a,
-  0x42, 0x6c, 0x0c, 0x4c, 0x9e, 0xe8, 0x37, 0xff, 0xc2, 0x3a, 0xe4, 0x08,
-  0x8e, 0x2a, 0xcf, 0x60, 0xe9, 0x9a, 0x67, 0x90, 0x40, 0x60, 0x5e, 0x76,
-  0x48, 0x92, 0x06, 0xc2, 0x91, 0x19, 0x0a, 0x01, 0x90, 0x0a, 0x03, 0xd8,
-  0xa5, 0xfe, 0x3a, 0x5c, 0x08, 0x9e, 0xe9, 0x6b, 0x37, 0xf3, 0x3e, 0xc8,
-  0x8d, 0x33, 0xfa, 0x88, 0x0e, 0x5f, 0xb1, 0x8a, 0x6e, 0x0a, 0x8a, 0x81,
-  0x4e, 0xd9, 0x42, 0x7e, 0xc2, 0x8a, 0xa2, 0xf4, 0xe8, 0x3f, 0x0b, 0x67,
-  0x7c, 0xa0, 0xd1, 0xec, 0x31, 0x96, 0xe7, 0xa6, 0x93, 0xfa, 0x26, 0xea,
-  0x31, 0xff, 0xfd, 0x3f, 0xe4, 0xf7, 0x06, 0x6a, 0x09, 0x32, 0xe1, 0xb4,
-  0xb2, 0x92, 0xe8, 0xa3, 0xe0, 0x0c, 0x2d, 0xa2, 0x32, 0x85, 0x3b, 0xc9,
-  0xfe, 0x32, 0xfe, 0x72, 0x02, 0x17, 0xfc, 0x25, 0xa3, 0xb7, 0xc5, 0xf1,
-  0x02, 0x0e, 0xb0, 0x0e, 0x10, 0x09, 0x98, 0x20, 0xdf, 0xc4, 0x83, 0xff,
-  0x02, 0x7f, 0x6a, 0x49, 0x37, 0x3e, 0x7f, 0x76, 0x06, 0xeb, 0x38, 0xf3,
-  0x00, 0x59, 0xf9, 0xa8, 0xb4, 0x0f, 0x81, 0x6b, 0x75, 0x3d, 0x41, 0xaa,
-  0xeb, 0xd6, 0x14, 0x0d, 0xba, 0x90, 0x14, 0xd9, 0x15, 0xa6, 0xa6, 0x0d,
-  0x96, 0xe8, 0x06, 0x59, 0xa6, 0x90, 0x82, 0x3d, 0x95, 0x4d, 0xcc, 0xb2,
-  0x72, 0x15, 0x83, 0x68, 0xe3, 0x81, 0x09, 0x3d, 0x30, 0x19, 0x8a, 0x06,
-  0x86, 0xdb, 0xc0, 0xf3, 0xff, 0x62, 0x72, 0x38, 0xb9, 0x02, 0xe8, 0x28,
-  0x69, 0xdd, 0x08, 0xa8, 0x0a, 0x43, 0xe5, 0x77, 0x9d, 0x74, 0x5f, 0x0b,
-  0xea, 0xf6, 0x76, 0x5b, 0xde, 0xa2, 0xda, 0x31, 0x5b, 0x6d, 0xdc, 0x31,
-  0xf8, 0x2d, 0x0a, 0x0b, 0x50, 0x8b, 0x6d, 0xcd, 0x56, 0x0b, 0xca, 0x37,
-  0x32, 0x96, 0x16, 0x0a, 0x59, 0x0c, 0x77, 0x74, 0x0b, 0x6f, 0xe6, 0x81,
-  0x4f, 0x5b, 0xaf, 0xe9, 0x0a, 0x19, 0xe5, 0x0d, 0x3d, 0xf2, 0x56, 0x92,
-  0x4c, 0xcb, 0x5c, 0x06, 0x5e, 0xb5, 0x58, 0x1a, 0x7a, 0xc6, 0x2c, 0x08,
-  0x0b, 0x1d, 0xc1, 0x87, 0xe5, 0x08, 0x06, 0x0a, 0x13, 0x02, 0x2c, 0x37,
-  0x18, 0x09, 0x1f, 0x01, 0x37, 0x53, 0x6c, 0xd0, 0x8e, 0xbe, 0x8c, 0xc0,
-  0x07, 0x5b, 0x16, 0x40, 0x1f, 0x26, 0xaf, 0xc0, 0xc6, 0x07, 0x7a, 0xfe,
-  0x4d, 0xa9, 0xee, 0x7e, 0x10, 0xeb, 0xb8, 0x89, 0x14, 0x32, 0xf6, 0x06,
-  0x50, 0x4a, 0x6d, 0x09, 0x8d, 0x0e, 0x2e, 0xde, 0xcf, 0x1a, 0x61, 0xc2,
-  0x21, 0x14, 0x36, 0x35, 0xe8, 0xae, 0xf0, 0x20, 0x5e, 0x5f, 0x01, 0x5e,
-  0x64, 0xf8, 0x5e, 0x2d, 0xc1, 0x84, 0xc6, 0xeb, 0x16, 0x88, 0x6f, 0x16,
-  0xc1, 0x9a, 0xb1, 0x7b, 0xf4, 0x27, 0xdb, 0x0b, 0xc6, 0x22, 0xd5, 0xc2,
-  0x24, 0xec, 0xb0, 0x23, 0x72, 0xb3, 0x0a, 0x02, 0xcb, 0x0b, 0x67, 0x1c,
-  0xbe, 0x83, 0x15, 0x28, 0x10, 0xb2, 0x38, 0xf4, 0xc1, 0xf6, 0x23, 0xb5,
-  0x74, 0x84, 0x10, 0x2e, 0x65, 0xf6, 0x81, 0xf4, 0x7e, 0x80, 0x35, 0xd2,
-  0x8b, 0xf6, 0x1a, 0xf4, 0x57, 0x08, 0x40, 0xe1, 0xea, 0x06, 0x43, 0x6b,
-  0x46, 0x59, 0x5f, 0x9a, 0xbd, 0x2c, 0x6f, 0x11, 0xa1, 0x5c, 0x34, 0xff,
-  0x8b, 0x16, 0x5a, 0x34, 0x81, 0xc2, 0x00, 0xa6, 0xea, 0x15, 0xce, 0x12,
-  0xcc, 0x37, 0x63, 0x69, 0x07, 0xd1, 0x05, 0x44, 0xbd, 0xaf, 0xf0, 0xd1,
-  0xf8, 0xb6, 0x01, 0x99, 0x3f, 0xff, 0xba, 0x86, 0x07, 0xb8, 0x80, 0x1f,
-  0x59, 0xf5, 0x5b, 0xe8, 0x06, 0x25, 0x26, 0x6a, 0x03, 0xb5, 0x77, 0x03,
-  0x00, 0x18, 0xe5, 0xe1, 0x01, 0x9b, 0x33, 0xed, 0x24, 0x27, 0xf7, 0x82,
-  0xc6, 0x5d, 0x66, 0x09, 0x81, 0xbd, 0x0b, 0x80, 0x51, 0x83, 0xb0, 0x0d,
-  0x01, 0x4c, 0x45, 0xa7, 0xc2, 0xe0, 0x03, 0x98, 0x48, 0x6f, 0xa9, 0x08,
-  0x4e, 0x8a, 0x84, 0xf8, 0xac, 0x33, 0x98, 0x03, 0xf8, 0xdd, 0x1c, 0x7f,
-  0xf4, 0x9c, 0x18, 0x02, 0xad, 0x0e, 0x00, 0xbc, 0xb4, 0x03, 0x02, 0x7e,
-  0x5d, 0xc6, 0x07, 0x6a, 0x3c, 0xbf, 0x8c, 0xc7, 0xba, 0x83, 0x18, 0x91,
-  0x80, 0xfc, 0xa9, 0x8a, 0x57, 0x01, 0x1b, 0x9c, 0x03, 0x83, 0xc2, 0x47,
-  0x86, 0xcb, 0xe0, 0x5e, 0x34, 0xb5, 0xd6, 0xd4, 0x32, 0x01, 0xd4, 0xb5,
-  0x57, 0xcc, 0x2f, 0xa6, 0x18, 0x4e, 0x5e, 0x20, 0xe8, 0x16, 0x18, 0x07,
-  0x01, 0x02, 0xcd, 0x83, 0x6d, 0xae, 0xfa, 0x95, 0x6f, 0xf2, 0xb8, 0x10,
-  0x0e, 0x74, 0x94, 0x58, 0x82, 0xc6, 0x49, 0x07, 0xd6, 0x36, 0x1a, 0x79,
-  0x3c, 0x00, 0xb6, 0x3d, 0x24, 0x14, 0x3c, 0x5f, 0x03, 0xb7, 0x4d, 0x0e,
-  0xc3, 0xff, 0x52, 0x99, 0x5b, 0x59, 0x03, 0xc8, 0x13, 0xda, 0xdb, 0x01,
-  0x4e, 0x2e, 0x5e, 0x56, 0x35, 0x0a, 0x32, 0xe0, 0x42, 0x27, 0x00, 0xc6,
-  0x29, 0xf7, 0xc2, 0x19, 0x7e, 0x80, 0xeb, 0x1f, 0xc6, 0xc1, 0x47, 0x8b,
-  0x5a, 0xba, 0x53, 0x90, 0x46, 0xfb, 0xe8, 0x83, 0x22, 0x17, 0xed, 0x88,
-  0xf2, 0x61, 0x16, 0x7b, 0x5d, 0x22, 0xc4, 0x61, 0x06, 0x5f, 0x6c, 0x08,
-  0x2c, 0x2e, 0x56, 0x4e, 0x07, 0xc2, 0x2b, 0xe4, 0x31, 0xbc, 0xf8, 0x88,
-  0x93, 0x1b, 0xab, 0x22, 0x25, 0x5b, 0x01, 0x05, 0xc1, 0xbc, 0x07, 0x8d,
-  0xc2, 0x07, 0x85, 0x1c, 0xd8, 0x0d, 0x32, 0x22, 0x54, 0x01, 0xbe, 0x1b,
-  0x7c, 0x44, 0x7f, 0x07, 0x9b, 0xf3, 0x50, 0x22, 0xf7, 0x76, 0x3b, 0x81,
-  0x6e, 0x06, 0x6d, 0x83, 0x5e, 0x13, 0x7c, 0x33, 0xff, 0xf9, 0x38, 0x22,
-  0x27, 0xca, 0x21, 0x7c, 0x15, 0x01, 0x90, 0xec, 0xc3, 0x21, 0x49, 0xc2,
-  0x70, 0x77, 0x3e, 0x99, 0x49, 0x18, 0x7d, 0xa6, 0x21, 0x50, 0x85, 0x10,
-  0xce, 0x86, 0x1a, 0x8a, 0x0a, 0x43, 0xcc, 0x8b, 0x16, 0xd6, 0x3c, 0x42,
-  0x83, 0x8d, 0x5a, 0x43, 0x1e, 0x1a, 0x18, 0x4b, 0xc9, 0x68, 0x21, 0xd8,
-  0x01, 0x16, 0x5d, 0x42, 0x86, 0x71, 0xcd, 0x34, 0xe3, 0xab, 0x0a, 0x3b,
-  0x33, 0xcd, 0x1a, 0x12, 0xd0, 0xea, 0x4b, 0x4d, 0x3c, 0x4b, 0x72, 0x83,
-  0x6d, 0xcc, 0x01, 0xfb, 0xcb, 0xeb, 0x1b, 0x17, 0xf7, 0x75, 0x15, 0x15,
-  0xad, 0xf3, 0x78, 0x2d, 0x51, 0x85, 0xa1, 0x3f, 0x8a, 0xfb, 0x1d, 0xeb,
-  0x51, 0x0e, 0x05, 0xb7, 0x24, 0x1d, 0x09, 0x8f, 0x79, 0x42, 0xa6, 0xe3,
-  0x8a, 0x87, 0x75, 0x80, 0x68, 0x12, 0x56, 0xb4, 0x5d, 0xdd, 0x8b, 0x15,
-  0xfe, 0x2b, 0x1c, 0x23, 0xb7, 0x3b, 0x19, 0x7c, 0xce, 0x16, 0x81, 0x81,
-  0x5d, 0xbb, 0x72, 0xc7, 0xc4, 0x22, 0x30, 0x48, 0xa6, 0x80, 0xc4, 0x15,
-  0x52, 0x25, 0x0d, 0xc7, 0xbd, 0x07, 0xf6, 0x71, 0x8c, 0xab, 0x83, 0x13,
-  0x05, 0x5b, 0xf7, 0xb8, 0x9d, 0x33, 0x3e, 0x5f, 0xdb, 0x2a, 0x45, 0x0e,
-  0x89, 0xeb, 0x2d, 0x05, 0x81, 0x5c, 0x17, 0x1d, 0x1b, 0x1f, 0xb8, 0x89,
-  0x59, 0x8e, 0xb6, 0x2e, 0xbc, 0x48, 0xee, 0x8b, 0x91, 0x6a, 0x2d, 0xd8,
-  0x8b, 0x06, 0x24, 0x71, 0x90, 0xba, 0x78, 0xf4, 0x71, 0x98, 0x76, 0x1f,
-  0x16, 0x03, 0x4d, 0xc2, 0x01, 0xb6, 0x06, 0x0e, 0xa1, 0xd0, 0x02, 0xb8,
-  0x59, 0x77, 0xff, 0xc3, 0x15, 0x61, 0x43, 0xe7, 0x6b, 0x02, 0x46, 0x64,
-  0x36, 0xc4, 0x48, 0x0b, 0xac, 0xc0, 0xf0, 0x95, 0xfa, 0x49, 0x4c, 0xd1,
-  0x1a, 0xed, 0x9e, 0xe4, 0xf5, 0xf6, 0x87, 0xd9, 0x30, 0xb7, 0x2e, 0x09,
-  0x0c, 0xed, 0x05, 0xe0, 0x15, 0x9d, 0x04, 0xb1, 0x2b, 0xb4, 0xdf, 0xfd,
-  0xe8, 0x5b, 0x04, 0x8b, 0xc2, 0xe8, 0xc3, 0xe8, 0xf3, 0xc6, 0x0a, 0xc4,
-  0x6f, 0x2b, 0xc2, 0x40, 0xcb, 0xfe, 0xe8, 0xe4, 0xff, 0xb1, 0x08, 0xd3,
-  0xe8, 0xf9, 0x12, 0xc5, 0x04, 0x58, 0x6e, 0xe0, 0x8e, 0x00, 0x3b, 0xcd,
-  0x0c, 0x40, 0xb6, 0x3d, 0x78, 0x73, 0xaf, 0x17, 0x94, 0x10, 0x2f, 0x08,
-  0xd1, 0xe3, 0xf7, 0x44, 0xa2, 0x1f, 0x36, 0x96, 0x17, 0x84, 0x0e, 0x0d,
-  0x48, 0x62, 0x7d, 0xe9, 0xec, 0x00, 0x8e, 0x23, 0x81, 0xa7, 0x89, 0x43,
-  0x60, 0xfd, 0xe7, 0x05, 0xa8, 0x36, 0xc4, 0xf4, 0x8e, 0x06, 0x01, 0xfd,
-  0x8a, 0xfa, 0xeb, 0x7a, 0x32, 0xb6, 0x96, 0x37, 0xf4, 0x59, 0xf4, 0x91,
-  0xbf, 0x92, 0xf9, 0x3c, 0x0a, 0x75, 0x0a, 0x0b, 0x5e, 0xfc, 0x34, 0x0d,
-  0x16, 0x9f, 0x88, 0x7a, 0x2e, 0xf9, 0x67, 0x21, 0x0b, 0x09, 0xbb, 0x76,
-  0x72, 0xff, 0x3d, 0xff, 0xfc, 0x33, 0xdb, 0x2b, 0xd0, 0x83, 0xdb, 0x16,
-  0xf3, 0xf1, 0xdb, 0x7c, 0x49, 0x37, 0x4e, 0xfa, 0x80, 0x00, 0xd8, 0x72,
-  0x41, 0x19, 0x5f, 0x8b, 0xf2, 0x56, 0xd8, 0x16, 0x50, 0x82, 0x0a, 0x35,
-  0x4f, 0x4d, 0x2c, 0x13, 0x46, 0x41, 0xc2, 0x73, 0x11, 0x37, 0x58, 0x77,
-  0x4d, 0x2b, 0x4c, 0xde, 0xeb, 0x4e, 0x36, 0x8e, 0x5d, 0xa5, 0x8c, 0xef,
-  0x1b, 0x4a, 0xfa, 0xa1, 0x00, 0x1a, 0xb6, 0x73, 0xff, 0x49, 0x46, 0x14,
-  0x1b, 0x6e, 0xce, 0x76, 0x27, 0xd7, 0x4f, 0x17, 0xb2, 0x53, 0x99, 0x0f,
-  0x95, 0xb7, 0xbc, 0xaa, 0x50, 0x78, 0x03, 0xc7, 0x2b, 0xc6, 0x57, 0xad,
-  0x08, 0x2c, 0x35, 0x91, 0x0d, 0xc1, 0x33, 0x8a, 0xf6, 0xc0, 0x84, 0x19,
-  0x0d, 0x39, 0x19, 0xc4, 0x75, 0xbc, 0x46, 0x17, 0x72, 0x58, 0xde, 0x39,
-  0x1e, 0xbe, 0x04, 0x2b, 0xbf, 0x00, 0xe4, 0x0d, 0x0e, 0x4e, 0x60, 0x2e,
-  0x4a, 0x75, 0xdf, 0xcb, 0x39, 0xa9, 0x06, 0x4b, 0x65, 0x06, 0xfb, 0xc2,
-  0x33, 0x74, 0x3b, 0xa3, 0x04, 0x54, 0x88, 0x02, 0xea, 0xc5, 0xfe, 0x2d,
-  0x1d, 0xc6, 0xe1, 0x22, 0x2a, 0x2d, 0x0d, 0x8d, 0xfa, 0xeb, 0x1d, 0x9f,
-  0xfc, 0x5a, 0xf1, 0x06, 0x04, 0xfd, 0x38, 0x1f, 0x0b, 0xd2, 0x7c, 0x0c,
-  0x1a, 0x7b, 0x3a, 0x40, 0x76, 0x2c, 0xc2, 0x3f, 0xa3, 0x04, 0x72, 0xa1,
-  0x6a, 0x02, 0x04, 0x0a, 0x3b, 0x1e, 0xf3, 0x81, 0xb8, 0xe8, 0xa2, 0xff,
-  0x06, 0x75, 0xbb, 0x33, 0x4b, 0x16, 0x1f, 0x53, 0xde, 0x62, 0x8b, 0xdc,
-  0x60, 0xa0, 0x6b, 0x70, 0x04, 0x62, 0x0c, 0x17, 0x35, 0x8b, 0x4e, 0x0b,
-  0xcf, 0x4f, 0xb6, 0x04, 0x0b, 0x0e, 0x50, 0x5b, 0x8c, 0x10, 0x13, 0xae,
-  0x5b, 0xb9, 0x4e, 0xcd, 0xe3, 0x25, 0x1b, 0xc9, 0xf0, 0xb7, 0xeb, 0x10,
-  0x32, 0x39, 0x20, 0xd4, 0x2e, 0xc5, 0xaf, 0xf9, 0x14, 0xfe, 0x5b, 0x1f,
-  0xe3, 0x08, 0xa3, 0x7d, 0x00, 0x21, 0xe7, 0x30, 0xac, 0x2d, 0x66, 0x26,
-  0x3b, 0x42, 0xa6, 0x26, 0x40, 0x39, 0x26, 0x0a, 0x7b, 0x06, 0x55, 0xc4,
-  0x67, 0x7f, 0xfc, 0x2b, 0xc0, 0x99, 0xb9, 0x0a, 0x57, 0x11, 0x52, 0xbf,
-  0x13, 0x8d, 0x72, 0x8d, 0x1c, 0x88, 0x8b, 0x01, 0x55, 0x70, 0xf7, 0xbd,
-  0xbf, 0x1e, 0x80, 0xfb, 0x2b, 0x74, 0x06, 0x6d, 0x04, 0x2d, 0x2d, 0x38,
-  0x45, 0xed, 0x16, 0x09, 0xff, 0x39, 0x77, 0x2f, 0x80, 0xeb, 0x30, 0x72,
-  0x2a, 0xff, 0xf7, 0xe1, 0x03, 0xc3, 0x12, 0xd6, 0x74, 0xea, 0x52, 0xef,
-  0xee, 0x8b, 0xfa, 0x38, 0x6f, 0x0e, 0x97, 0x87, 0xd1, 0xf6, 0xf7, 0xe2,
-  0x92, 0x97, 0x15, 0xec, 0x13, 0xd1, 0x29, 0x39, 0x05, 0xbf, 0x73, 0xe0,
-  0x4d, 0x7c, 0x07, 0xf7, 0xfa, 0xda, 0xf7, 0xd8, 0x83, 0xda, 0x5b, 0x5c,
-  0x07, 0x74, 0x05, 0x3b, 0x0d, 0xdb, 0xe5, 0x7e, 0x50, 0xbb, 0x4c, 0xcd,
-  0x11, 0x02, 0x6a, 0x12, 0x1e, 0xe8, 0x66, 0xe4, 0xb0, 0xff, 0x0b, 0xcd,
-  0x1a, 0x92, 0x8b, 0xd1, 0x63, 0x29, 0x1e, 0xe9, 0xb4, 0x3b, 0xc5, 0xb9,
-  0x55, 0x2c, 0x0e, 0x72, 0x42, 0xbc, 0xa5, 0xa2, 0xf3, 0x50, 0xe8, 0xfd,
-  0x07, 0x5b, 0x19, 0x10, 0x98, 0x11, 0xe8, 0xaa, 0xd7, 0x9c, 0x1c, 0xd9,
-  0x98, 0x2a, 0xb5, 0x3b, 0x1b, 0xd6, 0x43, 0x47, 0xba, 0x30, 0x30, 0x77,
-  0x03, 0x91, 0x2f, 0xe3, 0xcd, 0x07, 0x3f, 0x0f, 0x32, 0xe4, 0x6e, 0x56,
-  0x00, 0x06, 0xb4, 0xca, 0x4f, 0xcf, 0x4e, 0xed, 0xfe, 0x80, 0x3e, 0x09,
-  0x12, 0x94, 0x79, 0xb0, 0x00, 0xa0, 0x18, 0xce, 0xdf, 0x2b, 0xad, 0x86,
-  0xf8, 0x00, 0x1b, 0x16, 0x81, 0x00, 0xa4, 0x1d, 0x1a, 0x3e, 0x66, 0xa6,
-  0x4b, 0xea, 0x72, 0x0c, 0x30, 0xee, 0x59, 0x83, 0xd9, 0x79, 0x53, 0xe9,
-  0xeb, 0x18, 0xa2, 0x65, 0x04, 0x99, 0x04, 0xb2, 0x08, 0x08, 0x89, 0xab,
-  0x7b, 0x3a, 0x07, 0x74, 0xa6, 0xe8, 0x0c, 0x75, 0x62, 0x5a, 0x43, 0x34,
-  0x84, 0x72, 0x3f, 0xbf, 0x96, 0xb4, 0x12, 0xf5, 0xb3, 0x10, 0xe8, 0x07,
-  0xbd, 0x38, 0xc3, 0x04, 0xf0, 0x6a, 0x3e, 0x37, 0xbf, 0x1e, 0x51, 0xff,
-  0xb9, 0x40, 0x00, 0x8e, 0xd9, 0x59, 0x80, 0xfc, 0x73, 0x81, 0x04, 0x7f,
-  0x0f, 0x74, 0x56, 0xcd, 0x10, 0xeb, 0xfa, 0x6a, 0x3c, 0x03, 0x75, 0x1a,
-  0x96, 0x02, 0x1a, 0xdd, 0x0a, 0x3c, 0x1a, 0x12, 0x13, 0xff, 0x26, 0x87,
-  0x00, 0xfe, 0xb4, 0x01, 0xb9, 0xb7, 0x07, 0x7e, 0x10, 0xb8, 0x03, 0xb8,
-  0x7d, 0xde, 0x3c, 0x40, 0x75, 0xda, 0xad, 0x44, 0x48, 0x68, 0x0e, 0x5f,
-  0x59, 0x10, 0x74, 0x3d, 0xb8, 0xf7, 0x12, 0x11, 0x32, 0xdb, 0x1a, 0x5b,
-  0x00, 0x59, 0x20, 0x7b, 0x06, 0x36, 0x3e, 0x26, 0x80, 0x0e, 0x59, 0x01,
-  0xa6, 0x00, 0x6b, 0x9e, 0x13, 0x9b, 0x53, 0x12, 0x6f, 0xaf, 0x7f, 0xff,
-  0x0a, 0xdd, 0xc0, 0x58, 0x69, 0x3e, 0xff, 0x84, 0x00, 0x18, 0x74, 0x02,
-  0xb0, 0x40, 0x1f, 0xf0, 0x5d, 0xc3, 0xb4, 0x0f, 0x33, 0x3a, 0x19, 0x69,
-  0x17, 0x31, 0x75, 0xb4, 0x08, 0xca, 0xef, 0x6f, 0xec, 0xc4, 0x24, 0x7f,
-  0x8a, 0xfb, 0xe0, 0x88, 0x26, 0xc9, 0x33, 0x03, 0x54, 0xaa, 0xf6, 0x75,
-  0x63, 0x37, 0xf7, 0xa2, 0xca, 0x33, 0x76, 0x28, 0x4e, 0xff, 0xdf, 0x12,
-  0xcc, 0x33, 0x3a, 0x06, 0x6f, 0x0c, 0x74, 0x2d, 0xa0, 0x73, 0x11, 0x2e,
-  0x77, 0x3c, 0xff, 0x16, 0x2b, 0xca, 0x5c, 0x1e, 0xfc, 0x19, 0x80, 0x3e,
-  0xae, 0x67, 0xb9, 0xb8, 0xd3, 0x1a, 0x47, 0xc7, 0x64, 0x7e, 0x05, 0xba,
-  0xc6, 0x2d, 0x40, 0xc7, 0x18, 0x76, 0x13, 0x7f, 0x06, 0x40, 0x73, 0x0c,
-  0x3d, 0x07, 0x59, 0x15, 0x3b, 0xa2, 0xcd, 0x37, 0x18, 0x40, 0x5f, 0x30,
-  0xb0, 0x19, 0xeb, 0x0b, 0x67, 0x3b, 0xa0, 0x6d, 0x3a, 0xfe, 0xbb, 0x18,
-  0xcb, 0x33, 0x29, 0x3b, 0x20, 0xd5, 0x7d, 0xf0, 0xba, 0xea, 0xff, 0x4f,
-  0xfd, 0xd5, 0xb6, 0x33, 0xaa, 0x8d, 0xa3, 0x58, 0xbb, 0x0c, 0xe8, 0xb3,
-  0x06, 0xd9, 0x44, 0x36, 0xce, 0x2b, 0x60, 0xec, 0x18, 0x00, 0xb0, 0xc3,
-  0xdb, 0x7a, 0xa3, 0xd1, 0x33, 0x97, 0x5a, 0xcf, 0x33, 0x28, 0x58, 0xd5,
-  0xa2, 0x16, 0xa5, 0xa2, 0x05, 0xbb, 0x01, 0xb6, 0x74, 0x04, 0xa8, 0xdb,
-  0xc6, 0x07, 0xcb, 0x3e, 0xc7, 0x33, 0xda, 0xfa, 0x56, 0x19, 0x27, 0xbf,
-  0x6c, 0xb0, 0x0a, 0xfa, 0xe6, 0x20, 0x6f, 0x24, 0xe6, 0x43, 0xe4, 0xfd,
-  0x20, 0x97, 0xe4, 0x40, 0x8a, 0xd8, 0xdf, 0x03, 0xf8, 0xf7, 0xd3, 0xe4,
-  0x21, 0xf8, 0x96, 0xb0, 0xff, 0xe6, 0x21, 0x97, 0xb7, 0x16, 0x6c, 0xdb,
-  0x04, 0x96, 0x07, 0xfb, 0xf1, 0x97, 0xa8, 0x01, 0x74, 0x6f, 0x36, 0xfb,
-  0xff, 0x00, 0xf1, 0x77, 0x01, 0x42, 0x93, 0xa8, 0xbc, 0xc1, 0xd8, 0x1b,
-  0xb8, 0xba, 0x41, 0x98, 0xc2, 0xed, 0x1e, 0x33, 0xc9, 0x0d, 0x3e, 0xa9,
-  0x01, 0xb6, 0xe6, 0x1b, 0x0c, 0xb5, 0x0f, 0x0a, 0x2b, 0x87, 0x32, 0x1b,
-  0x5f, 0xf8, 0xe2, 0x89, 0x5e, 0xfa, 0x36, 0x61, 0xff, 0x25, 0x42, 0xe7,
-  0xfa, 0x72, 0xf7, 0xeb, 0xf8, 0x72, 0xf0, 0xca, 0x2c, 0x19, 0x20, 0x60,
-  0x13, 0x26, 0xb6, 0x4c, 0xba, 0x44, 0x33, 0x6a, 0xfd, 0x3e, 0xf6, 0xc2,
-  0x80, 0x75, 0x35, 0xb6, 0x13, 0x42, 0x57, 0xa5, 0x02, 0x77, 0x0f, 0x2e,
-  0x52, 0x50, 0x06, 0xf4, 0xb0, 0x0c, 0x59, 0x73, 0xfb, 0x5a, 0x59, 0x72,
-  0x19, 0x2e, 0x6e, 0x42, 0x1b, 0xb7, 0x12, 0x5d, 0xfe, 0x72, 0xcd, 0x09,
-  0x77, 0xfc, 0x81, 0x72, 0x72, 0x63, 0xb7, 0x9c, 0x3c, 0xdc, 0x04, 0x08,
-  0x32, 0x1c, 0x14, 0x97, 0x20, 0x3c, 0x8b, 0xa8, 0xdd, 0xf2, 0x03, 0x3d,
-  0xb0, 0x02, 0x75, 0x21, 0x36, 0x6a, 0x12, 0xf5, 0x74, 0xd9, 0x5e, 0x59,
-  0x1b, 0x88, 0xcd, 0xd3, 0xde, 0xa2, 0x03, 0xe8, 0xaf, 0xff, 0xac, 0x47,
-  0xea, 0x06, 0x30, 0x8a, 0x8f, 0x9b, 0x29, 0x50, 0x9c, 0x1f, 0x04, 0x47,
-  0x22, 0xff, 0x7e, 0x09, 0x26, 0x83, 0x67, 0x02, 0xdf, 0x4d, 0x0c, 0x29,
-  0x3c, 0x83, 0xd6, 0x10, 0x7c, 0x3f, 0x7f, 0xfe, 0x0d, 0x20, 0x00, 0x53,
-  0x95, 0xef, 0xeb, 0x0d, 0x18, 0x44, 0xf1, 0x10, 0x83, 0x5a, 0x7a, 0xb8,
-  0x95, 0x42, 0x5e, 0x1c, 0x06, 0x46, 0x69, 0x6b, 0x26, 0x0f, 0x07, 0x00,
-  0x3d, 0x58, 0xab, 0x6c, 0xaf, 0xd1, 0x20, 0x65, 0xd9, 0x1e, 0x27, 0xc5,
-  0x48, 0x61, 0x7e, 0x63, 0x46, 0xbd, 0x8a, 0x04, 0xe9, 0xbc, 0x52, 0xa0,
-  0x1c, 0x10, 0x57, 0xeb, 0x64, 0x10, 0x01, 0x45, 0x6d, 0x39, 0x0e, 0x8b,
-  0x18, 0x70, 0x3e, 0xe9, 0x97, 0x00, 0x01, 0x68, 0x31, 0x28, 0x2f, 0x8c,
-  0xe8, 0x68, 0x11, 0x41, 0x7d, 0xc5, 0xff, 0xfe, 0x3f, 0xa0, 0xdb, 0xeb,
-  0x9a, 0x78, 0x20, 0x43, 0x05, 0xc5, 0xa9, 0xfe, 0x63, 0x76, 0x08, 0xa9,
-  0x72, 0x67, 0xd8, 0xf8, 0x58, 0x6b, 0x39, 0x2b, 0x14, 0x2f, 0x26, 0x20,
-  0x0c, 0x54, 0x2b, 0x89, 0x9b, 0x43, 0x8f, 0x7b, 0x15, 0xf9, 0x0b, 0xe3,
-  0x84, 0xeb, 0x82, 0xb6, 0x5b, 0x44, 0x0d, 0x40, 0xd4, 0x78, 0x06, 0x59,
-  0xab, 0xde, 0x97, 0x0a, 0x1e, 0x32, 0xa0, 0xd1, 0x18, 0x5e, 0xac, 0x09,
-  0x2f, 0xc0, 0xb3, 0x22, 0x0b, 0x22, 0xc9, 0xfc, 0x42, 0xdc, 0xfc, 0x8c,
-  0xc0, 0x0b, 0xc7, 0x74, 0x73, 0xb8, 0x68, 0x60, 0x25, 0x60, 0xeb, 0x46,
-  0x41, 0xf5, 0xf7, 0xd1, 0x49, 0x77, 0xf2, 0x3e, 0xe4, 0x34, 0xab, 0x8c,
-  0xa4, 0x7d, 0x8c, 0xc3, 0x0b, 0xdf, 0x06, 0xc6, 0x85, 0xdb, 0x50, 0xf0,
-  0x56, 0x33, 0xd6, 0xd4, 0x04, 0x32, 0x85, 0xf4, 0xde, 0xc4, 0x3d, 0x18,
-  0x05, 0xab, 0x6e, 0x33, 0x05, 0x0a, 0xdf, 0xd6, 0xe3, 0x3a, 0xe0, 0x75,
-  0xe9, 0xe5, 0x8b, 0xd9, 0xa9, 0x7f, 0x39, 0x3d, 0x75, 0xdd, 0x1e, 0xc5,
-  0x6f, 0xed, 0xf3, 0xa6, 0x1f, 0xf5, 0x87, 0xcb, 0x75, 0xd2, 0x76, 0x62,
-  0x8c, 0xc2, 0x24, 0xaa, 0x90, 0x9b, 0x08, 0x67, 0x5d, 0x82, 0x05, 0x41,
-  0x98, 0x99, 0x1f, 0x8d, 0x1c, 0x8a, 0x3f, 0x8a, 0x27, 0x1f, 0x10, 0xf4,
-  0x7e, 0x07, 0x5d, 0x21, 0x26, 0x07, 0x82, 0x31, 0x1d, 0xe4, 0x56, 0xb4,
-  0x36, 0x76, 0x8b, 0xf3, 0x1c, 0x22, 0xba, 0xa6, 0x37, 0xc3, 0x20, 0x81,
-  0x5e, 0x4f, 0x3e, 0x35, 0x8a, 0x46, 0x6b, 0x93, 0x67, 0x59, 0x0e, 0xcd,
-  0x25, 0x1e, 0x02, 0xae, 0xcc, 0x08, 0x03, 0x34, 0x03, 0xc0, 0x9a, 0x75,
-  0x64, 0x18, 0xa8, 0x43, 0x1e, 0x19, 0x0d, 0x6d, 0x8e, 0x8c, 0x0e, 0xe3,
-  0x98, 0x0e, 0x9b, 0x27, 0x8d, 0x4e, 0xa5, 0xf2, 0x71, 0x17, 0xb1, 0xfb,
-  0xc6, 0x46, 0xf2, 0x55, 0x03, 0x71, 0xf3, 0xcd, 0x32, 0xf0, 0x16, 0x34,
-  0xf4, 0x36, 0xf9, 0xf5, 0xdf, 0x24, 0x3c, 0x25, 0x72, 0x15, 0xf6, 0x3c,
-  0x26, 0x77, 0x11, 0x16, 0xed, 0xf5, 0x36, 0x10, 0xe9, 0xf6, 0x8f, 0x06,
-  0x9b, 0x9b, 0x18, 0xfa, 0x2d, 0xc5, 0x16, 0x69, 0xe0, 0x34, 0xff, 0xda,
-  0xdc, 0xc5, 0x05, 0xf8, 0x4b, 0x32, 0x5c, 0x12, 0x4b, 0xdb, 0x4c, 0x05,
-  0x54, 0x06, 0x7f, 0xca, 0x7c, 0xa5, 0xa9, 0x8d, 0x1f, 0x7a, 0x4b, 0x2b,
-  0x9c, 0xf7, 0x9c, 0x56, 0x1e, 0x06, 0x25, 0x79, 0x8f, 0x04, 0x8f, 0x44,
-  0xad, 0x0c, 0x05, 0xb6, 0x08, 0x02, 0x0e, 0x5f, 0x0c, 0x83, 0x64, 0x0c,
-  0xdb, 0x01, 0x89, 0x27, 0x89, 0x6d, 0x2d, 0x89, 0xb6, 0x33, 0x89, 0x39,
-  0xf6, 0x89, 0x04, 0x1f, 0x46, 0xd2, 0x50, 0x79, 0xf0, 0x62, 0x01, 0x58,
-  0xec, 0x3e, 0xc9, 0x81, 0x64, 0xc6, 0x71, 0x0c, 0x65, 0x52, 0xb6, 0x8e,
-  0x0e, 0x41, 0x90, 0x06, 0x06, 0x55, 0x16, 0x21, 0x5d, 0xc1, 0x8f, 0x90,
-  0x0e, 0x64, 0x0a, 0xa9, 0xcc, 0xd2, 0x00, 0xc1, 0x8d, 0x82, 0x12, 0x17,
-  0x1d, 0x1e, 0x9c, 0x0b, 0x28, 0xee, 0x26, 0x17, 0x01, 0xee, 0x8b, 0x85,
-  0x6e, 0x2d, 0xcb, 0xf0, 0xde, 0xf1, 0x27, 0xf2, 0x0d, 0x28, 0x1c, 0x34,
-  0x18, 0xb3, 0xf3, 0x4f, 0xf4, 0xf6, 0x6e, 0x0b, 0xf8, 0xca, 0x5a, 0xf9,
-  0x9b, 0x74, 0x0a, 0xcf, 0x73, 0x17, 0x0b, 0xa5, 0xf4, 0xab, 0xc5, 0x67,
-  0x68, 0x1e, 0xde, 0xf0, 0x05, 0x8b, 0x5d, 0xd9, 0xa3, 0x4d, 0x75, 0x55,
-  0x06, 0x28, 0x54, 0x54, 0x40, 0x6f, 0x9d, 0x8e, 0x45, 0x10, 0xe1, 0xc5,
-  0x7d, 0x0c, 0x36, 0x9b, 0x1b, 0x55, 0xb5, 0x9c, 0x71, 0xdd, 0x24, 0x89,
-  0x05, 0x89, 0xb2, 0x22, 0x89, 0xcb, 0x89, 0x89, 0x6c, 0x1f, 0x8c, 0xbd,
-  0x8f, 0x45, 0x12, 0xb2, 0x02, 0x08, 0xcb, 0x0c, 0x0e, 0x6c, 0xfb, 0x04,
-  0x2e, 0x02, 0xaa, 0xff, 0x14, 0xf6, 0x24, 0x31, 0x8d, 0x5b, 0x8d, 0x44,
-  0x0d, 0x57, 0x89, 0x0b, 0x02, 0xa2, 0x0e, 0x59, 0xc1, 0x0a, 0xea, 0x0c,
-  0xc5, 0xd2, 0x4d, 0x8a, 0xeb, 0xaf, 0x06, 0xd9, 0x68, 0x7a, 0x23, 0x92,
-  0x06, 0x04, 0x55, 0x6f, 0xe9, 0xfe, 0x58, 0x7e, 0xfe, 0x03, 0xbe, 0x57,
-  0x00, 0x89, 0x36, 0xdc, 0x85, 0x1d, 0xd5, 0x84, 0xde, 0xa0, 0xaf, 0x96,
-  0x4c, 0x11, 0xb4, 0xc3, 0x5a, 0x69, 0x0a, 0x6e, 0x09, 0x23, 0x7f, 0xe5,
-  0x21, 0x62, 0x44, 0xcd, 0xb1, 0x1d, 0x16, 0xf1, 0x20, 0xb6, 0xd9, 0x02,
-  0x60, 0x21, 0x67, 0xf6, 0x92, 0x25, 0x80, 0x4d, 0x6a, 0x40, 0x87, 0x76,
-  0xb4, 0x42, 0x80, 0xce, 0x0c, 0x2c, 0x83, 0xe0, 0x21, 0x6b, 0x53, 0x05,
-  0x75, 0x78, 0x8c, 0xff, 0x99, 0x41, 0x43, 0xa1, 0x22, 0x2b, 0x92, 0x4e,
-  0xb4, 0x1b, 0x6f, 0xdc, 0x83, 0xfb, 0x24, 0xc4, 0x77, 0x5c, 0xba, 0x87,
-  0x02, 0x72, 0x9a, 0xf8, 0x0e, 0xdf, 0x2e, 0x10, 0x0b, 0xc9, 0x7d, 0xeb,
-  0x12, 0x80, 0x7e, 0x3f, 0x80, 0x1b, 0x11, 0x05, 0xf1, 0x2d, 0x47, 0xf7,
-  0xd9, 0x77, 0xee, 0xd9, 0x00, 0x8d, 0xff, 0x76, 0xde, 0xe3, 0x10, 0x91,
-  0x2b, 0xd2, 0xf7, 0xdb, 0xf3, 0x91, 0x02, 0x36, 0xa3, 0x88, 0xd1, 0x68,
-  0xe3, 0x5b, 0x94, 0xf0, 0x0e, 0xde, 0x0b, 0xba, 0x2f, 0xf4, 0x16, 0x8e,
-  0xde, 0xdf, 0x2a, 0x03, 0xce, 0xfc, 0x4e, 0x4b, 0x37, 0x04, 0xfc, 0x2c,
-  0x0a, 0x73, 0x04, 0x04, 0x3a, 0x1b, 0xc3, 0x02, 0x12, 0x75, 0xf4, 0xaa,
-  0xe2, 0xee, 0xba, 0x77, 0xaa, 0x07, 0x19, 0xe2, 0x5c, 0x19, 0x81, 0x7c,
-  0x1a, 0x0e, 0x0f, 0x43, 0xd5, 0x7e, 0x0c, 0xa8, 0x06, 0xfb, 0xcc, 0x99,
-  0x97, 0x5c, 0x05, 0x95, 0xe3, 0x47, 0x94, 0x0c, 0x4f, 0xff, 0x0c, 0xb0,
-  0x01, 0x50, 0xb0, 0x61, 0x6e, 0xac, 0x56, 0xff, 0x90, 0xbc, 0x11, 0x08,
-  0x93, 0x69, 0xc5, 0x9f, 0x1c, 0x39, 0x20, 0x4a, 0xad, 0xbb, 0x89, 0x0a,
-  0x50, 0x25, 0x88, 0x27, 0x14, 0x04, 0x61, 0x94, 0xbf, 0xdd, 0xc8, 0xe3,
-  0x8e, 0x14, 0x93, 0x75, 0xf7, 0xfc, 0x6f, 0x27, 0x8a, 0x44, 0xff, 0x42,
-  0x45, 0xad, 0x45, 0xb7, 0x4d, 0x05, 0xed, 0x1f, 0xd1, 0x2b, 0xc1, 0x93,
-  0x41, 0x8c, 0xb4, 0xda, 0x1e, 0x78, 0x91, 0x6d, 0xb9, 0xd1, 0xe9, 0xbf,
-  0x26, 0xa5, 0x73, 0x01, 0xa4, 0x8e, 0x80, 0xda, 0x45, 0x7b, 0x82, 0x23,
-  0xbc, 0xb9, 0x30, 0x56, 0x61, 0x5f, 0x6f, 0x63, 0xfc, 0xf7, 0xc7, 0x03,
-  0x18, 0x7d, 0x04, 0xe3, 0x09, 0xaa, 0x49, 0xbb, 0x2d, 0xf3, 0xab, 0x2c,
-  0x70, 0xaa, 0x5f, 0x52, 0xe6, 0x74, 0x0a, 0x9a, 0x22, 0x4f, 0x1f, 0xc8,
-  0xff, 0x01, 0x92, 0x09, 0xc3, 0x8e, 0x86, 0x4e, 0x9e, 0xb3, 0x0a, 0x13,
-  0xfd, 0xe8, 0xa7, 0x13, 0x73, 0x06, 0xfd, 0xf0, 0xb6, 0x03, 0x06, 0x2e,
-  0xb3, 0xa1, 0x72, 0x7f, 0x8e, 0xe9, 0xfd, 0x03, 0xf1, 0x4e, 0x03, 0xf9,
-  0x4f, 0x83, 0x65, 0x11, 0xe1, 0xa4, 0x49, 0x2b, 0x74, 0x6e, 0xf8, 0x69,
-  0x6f, 0x96, 0x05, 0x03, 0xf0, 0xfb, 0x03, 0xf8, 0xa4, 0xfc, 0x1f, 0x94,
-  0x04, 0x01, 0x85, 0xa8, 0xb6, 0x72, 0x98, 0x69, 0x0a, 0x01, 0x77, 0x70,
-  0x04, 0xb4, 0x3c, 0x46, 0x4e, 0x0c, 0x02, 0x7e, 0x82, 0x7f, 0xfd, 0x03,
-  0x95, 0x30, 0x52, 0x31, 0xe1, 0x2b, 0xc9, 0xcb, 0x76, 0xb4, 0x40, 0x1a,
-  0x8c, 0x59, 0xc0, 0x9d, 0xa0, 0x8b, 0xbc, 0x46, 0xf7, 0xc6, 0x00, 0x5c,
-  0xa7, 0x02, 0xc7, 0x9b, 0x8b, 0xd6, 0xf7, 0x0b, 0xd0, 0x8b, 0xf2, 0x11,
-  0x50, 0x01, 0x6f, 0x80, 0x88, 0x00, 0xa1, 0xe3, 0xa2, 0x33, 0x21, 0x61,
-  0x9b, 0x02, 0xa9, 0xb6, 0x80, 0x10, 0x07, 0x0f, 0x4b, 0xe2, 0xe8, 0x2e,
-  0xfd, 0x04, 0xc8, 0x8c, 0x46, 0x6c, 0x80, 0xed, 0xbc, 0x2c, 0xf7, 0xa3,
-  0x27, 0xa3, 0x51, 0xe0, 0x4f, 0x3d, 0xf1, 0xcd, 0x15, 0x47, 0xa8, 0xf0,
-  0xd6, 0x98, 0x2c, 0x6e, 0x35, 0xe8, 0xe8, 0x5c, 0xff, 0xbb, 0x14, 0x7d,
-  0x13, 0x51, 0xae, 0x71, 0x62, 0xfb, 0x04, 0x74, 0x28, 0xb8, 0x50, 0x51,
-  0xbf, 0xdc, 0xfc, 0xe9, 0xba, 0x00, 0x57, 0x10, 0x23, 0x96, 0xeb, 0xb0,
-  0x1a, 0xe0, 0xed, 0xfe, 0x69, 0x67, 0x2d, 0x7c, 0x41, 0xb6, 0x59, 0xc7,
-  0x4b, 0xb6, 0x1c, 0x56, 0xc1, 0x75, 0xc8, 0x4d, 0x29, 0xbf, 0x1c, 0x7c,
-  0x5f, 0x73, 0x56, 0x3a, 0x68, 0x3d, 0x18, 0x96, 0x01, 0xd7, 0x57, 0xa9,
-  0x7f, 0x41, 0x23, 0x0b, 0x6b, 0x20, 0x75, 0x5e, 0x80, 0xb4, 0x09, 0x25,
-  0x28, 0x06, 0x38, 0xc1, 0x7b, 0x76, 0xba, 0xd9, 0x27, 0x86, 0xa3, 0xbe,
-  0xeb, 0xf2, 0x02, 0xde, 0xa8, 0x57, 0xe8, 0xe6, 0x03, 0x32, 0x5b, 0x59,
-  0x74, 0xb1, 0x19, 0xa8, 0xbd, 0x13, 0x24, 0x85, 0xda, 0x89, 0x24, 0x7b,
-  0xff, 0x7c, 0x1d, 0x2c, 0xa2, 0x03, 0xed, 0xf4, 0x00, 0x10, 0x17, 0xd5,
-  0xfc, 0xd6, 0x81, 0xe2, 0xff, 0xf8, 0x35, 0x24, 0xdf, 0x2e, 0x84, 0x89,
-  0x97, 0x50, 0x46, 0x71, 0x5e, 0x4c, 0x4c, 0x34, 0xd3, 0x76, 0x32, 0xf7,
-  0xc1, 0xab, 0xa0, 0x7b, 0x0a, 0xb0, 0x02, 0x07, 0x65, 0x04, 0x8d, 0x02,
-  0xc9, 0x86, 0x1e, 0x8e, 0xed, 0xb1, 0xf0, 0x22, 0x18, 0xf0, 0x0a, 0xc1,
-  0xb4, 0x3d, 0xf0, 0x97, 0x1a, 0xc8, 0x19, 0x66, 0x79, 0x3f, 0xa6, 0x2c,
-  0x6e, 0xa1, 0xf8, 0x0d, 0xdd, 0xa9, 0x89, 0x87, 0xcd, 0x48, 0x14, 0x43,
-  0x0c, 0xe4, 0xcf, 0xfb, 0xb0, 0x48, 0xa5, 0x62, 0x54, 0x78, 0x21, 0x7f,
-  0x20, 0x97, 0xb2, 0x95, 0x00, 0x04, 0x81, 0xa5, 0xe7, 0x59, 0x2a, 0x73,
-  0x58, 0x2e, 0x23, 0x95, 0x80, 0xf6, 0x59, 0x66, 0x98, 0xea, 0xfe, 0xc4,
-  0xbb, 0x30, 0x8b, 0xde, 0x12, 0x5d, 0xd4, 0xac, 0xdd, 0x78, 0x30, 0x3c,
-  0x0d, 0xa9, 0x19, 0xb7, 0x7f, 0xf3, 0xeb, 0x1f, 0xe2, 0xef, 0x06, 0xbc,
-  0x53, 0xf9, 0x0b, 0xf0, 0xfd, 0x04, 0xec, 0x6f, 0x4c, 0x3c, 0x5b, 0x07,
-  0x12, 0xb3, 0xf8, 0xfd, 0xaa, 0x3b, 0xfb, 0x81, 0x1c, 0x7b, 0x92, 0xeb,
-  0x22, 0x23, 0x14, 0xb0, 0xfc, 0x1b, 0xb1, 0x6f, 0x51, 0x59, 0x87, 0x6c,
-  0x97, 0x73, 0x81, 0x8f, 0xe8, 0x5b, 0x2b, 0xd0, 0x7c, 0x20, 0x1b, 0x35,
-  0x3f, 0x8c, 0x97, 0x0c, 0x6c, 0x8b, 0x08, 0x93, 0xf3, 0xa4, 0xfa, 0x17,
-  0xc4, 0xad, 0xdb, 0x8a, 0x13, 0x6a, 0x54, 0x1c, 0x28, 0xba, 0x96, 0x6d,
-  0x44, 0x5d, 0x8c, 0x54, 0xbf, 0x07, 0x8c, 0x5c, 0x06, 0x8e, 0xc3, 0x12,
-  0x73, 0x0d, 0x4a, 0x74, 0xb0, 0x8e, 0x4f, 0x76, 0x72, 0x04, 0xed, 0xea,
-  0x9e, 0x6f, 0x3a, 0xb8, 0xfa, 0x58, 0x67, 0x3b, 0xb4, 0x9f, 0x2b, 0x8b,
-  0x0c, 0x6e, 0x02, 0x54, 0x02, 0xd7, 0x20, 0x30, 0xbe, 0x14, 0x2d, 0x40,
-  0x18, 0x57, 0x15, 0xd8, 0x3f, 0xc3, 0xd7, 0x32, 0xc0, 0x17, 0x76, 0x0b,
-  0x75, 0x7d, 0x06, 0x8d, 0x75, 0xff, 0x33, 0x71, 0x0b, 0xc5, 0xdc, 0x81,
-  0x2b, 0xf9, 0x06, 0x1b, 0xa3, 0x87, 0x85, 0xf7, 0xda, 0x17, 0xf1, 0xd3,
-  0xa4, 0xd6, 0xaf, 0x03, 0x89, 0x92, 0xe6, 0x52, 0x6a, 0x1e, 0x56, 0xfc,
-  0x2f, 0x68, 0xa5, 0x8a, 0xbc, 0x63, 0x22, 0x09, 0xfd, 0xac, 0x3a, 0xc3,
-  0x74, 0x1c, 0x22, 0x2e, 0xaa, 0x11, 0xad, 0xe9, 0x08, 0x14, 0xbf, 0x08,
-  0x3a, 0xe3, 0x74, 0x0b, 0x22, 0xf1, 0xe4, 0x75, 0xef, 0x1f, 0x63, 0xb9,
-  0x07, 0xf5, 0x46, 0x8d, 0x44, 0xfe, 0xb5, 0x55, 0x1f, 0x96, 0x60, 0x9b,
-  0xe3, 0x8b, 0xd8, 0x4f, 0xe2, 0xf7, 0x66, 0x80, 0xe0, 0x74, 0xae, 0x7d,
-  0x52, 0x58, 0x93, 0xad, 0x91, 0xf5, 0x5d, 0xff, 0x2b, 0xc3, 0xb6, 0x72,
-  0x5f, 0xab, 0x4b, 0x29, 0x0b, 0xa1, 0x1e, 0x34, 0x6e, 0x8e, 0x3c, 0x6e,
-  0x2c, 0xa4, 0x1f, 0xb0, 0x95, 0x96, 0x58, 0x2b, 0x3a, 0x37, 0x5e, 0xfa,
-  0xb9, 0x7a, 0x61, 0xac, 0x16, 0x22, 0x1d, 0x6f, 0x1c, 0xae, 0x74, 0xf5,
-  0xff, 0x3a, 0xc5, 0x72, 0x06, 0x3a, 0xc1, 0x77, 0x02, 0xff, 0x2c, 0x20,
-  0x3a, 0xdd, 0x72, 0x07, 0x3a, 0xd9, 0xea, 0x77, 0x03, 0x80, 0x57, 0x42,
-  0xae, 0x58, 0xdc, 0x69, 0x0a, 0xf6, 0xd6, 0x39, 0x88, 0x1b, 0xd3, 0x04,
-  0x3b, 0x42, 0x95, 0x81, 0x21, 0x58, 0x6f, 0x81, 0xec, 0x7b, 0xd0, 0x48,
-  0x5f, 0x5f, 0x2d, 0x88, 0x8a, 0x13, 0x48, 0xb5, 0x1e, 0x63, 0xad, 0x93,
-  0x20, 0xf6, 0x2b, 0xd9, 0x8b, 0xcb, 0xbc, 0x16, 0x05, 0x54, 0xd8, 0x8a,
-  0xfc, 0xc0, 0x12, 0x15, 0xba, 0xb7, 0x37, 0xcb, 0x31, 0xb7, 0xc2, 0xc7,
-  0x8e, 0x99, 0xdf, 0x0a, 0xa8, 0xd6, 0xc4, 0x11, 0xec, 0xf3, 0xaa, 0xc8,
-  0x8f, 0x1e, 0xfc, 0x02, 0x02, 0x4b, 0xca, 0xe5, 0xba, 0xd9, 0xe3, 0x24,
-  0xcc, 0x3e, 0xe1, 0xf3, 0x3a, 0xc6, 0x69, 0xc2, 0x19, 0xde, 0xa4, 0xda,
-  0x39, 0xda, 0x42, 0xa2, 0x1a, 0x74, 0x21, 0x6e, 0x73, 0x60, 0x34, 0x2d,
-  0xb2, 0xd2, 0x5c, 0x22, 0xff, 0x60, 0xa4, 0xa3, 0xea, 0x03, 0x65, 0x26,
-  0x66, 0x2b, 0x00, 0x4e, 0x76, 0x3d, 0x94, 0x89, 0x00, 0xba, 0x97, 0x82,
-  0x00, 0xbf, 0x4f, 0x8a, 0x07, 0x15, 0xff, 0x2d, 0xd9, 0x30, 0x98, 0xa9,
-  0x0c, 0x0b, 0xd8, 0x6f, 0xbf, 0x8b, 0x12, 0x47, 0x01, 0x60, 0x13, 0x72,
-  0x5b, 0x72, 0x02, 0x07, 0x47, 0x3a, 0x0d, 0xdf, 0xef, 0x2d, 0x74, 0x15,
-  0x06, 0xe2, 0x2b, 0x74, 0x0e, 0xb3, 0x77, 0x14, 0xc9, 0x92, 0x92, 0x76,
-  0x28, 0xc4, 0x32, 0x32, 0x03, 0x4a, 0xeb, 0x02, 0x53, 0x46, 0x3b, 0x04,
-  0x13, 0x03, 0x89, 0x3f, 0xe2, 0x71, 0x5e, 0x34, 0xad, 0x4f, 0x05, 0xf2,
-  0x5a, 0x34, 0x50, 0x46, 0xed, 0x5c, 0x34, 0x9d, 0x6c, 0xc1, 0x63, 0xbe,
-  0xff, 0x36, 0x54, 0x34, 0xdf, 0x03, 0x52, 0x34, 0x9a, 0x87, 0xa4, 0x2b,
-  0x56, 0x5b, 0x14, 0x67, 0x3c, 0x58, 0xd2, 0x56, 0x4e, 0xe9, 0xf1, 0x2a,
-  0xd4, 0x6f, 0x5c, 0x0b, 0xcb, 0x19, 0xc8, 0x3e, 0x27, 0x8a, 0x99, 0xcb,
-  0x9b, 0xf0, 0x48, 0x27, 0x48, 0x2c, 0x50, 0x8d, 0x3a, 0x1e, 0xa8, 0x0b,
-  0x1c, 0x48, 0x16, 0x2a, 0x8a, 0xf8, 0xcc, 0xfe, 0x5c, 0x2d, 0xb4, 0x1c,
-  0xe8, 0x92, 0x5f, 0x7b, 0xf8, 0x0c, 0xa3, 0x8e, 0x76, 0x89, 0x16, 0x8c,
-  0xbd, 0x9c, 0xb0, 0x1a, 0xbe, 0x4b, 0xbc, 0x7c, 0x63, 0xcf, 0x00, 0x60,
-  0xdf, 0xf0, 0x0c, 0x74, 0x6b, 0x47, 0x34, 0x5e, 0xc6, 0x3d, 0x10, 0x51,
-  0xdb, 0x24, 0x72, 0xc3, 0x63, 0xc4, 0x3b, 0xc8, 0x40, 0x4c, 0x4f, 0x8c,
-  0x40, 0x84, 0xde, 0x3b, 0x9e, 0xc9, 0x40, 0x64, 0xbb, 0xb2, 0xa1, 0x64,
-  0x56, 0xc2, 0x1a, 0x7c, 0xeb, 0x0d, 0x46, 0x15, 0xf1, 0xe5, 0x38, 0x4d,
-  0xc8, 0x78, 0x88, 0xff, 0x90, 0xcd, 0xc4, 0x0c, 0x89, 0x0d, 0x61, 0x51,
-  0xa8, 0x25, 0x6a, 0x61, 0x3b, 0x15, 0x67, 0x77, 0x3a, 0x05, 0x46, 0x00,
-  0xa2, 0xa9, 0xea, 0x68, 0x4e, 0x05, 0xcd, 0x89, 0x00, 0x54, 0xad, 0xff,
-  0x06, 0x58, 0x8d, 0xff, 0x39, 0xb7, 0x38, 0x34, 0x76, 0xf2, 0xeb, 0xbb,
-  0x21, 0x31, 0x03, 0x72, 0xb2, 0x0b, 0x28, 0x51, 0x72, 0x58, 0xfb, 0xae,
-  0x4b, 0x21, 0x72, 0x8b, 0x87, 0xd2, 0x01, 0x02, 0xbb, 0x20, 0x04, 0x72,
-  0xdf, 0x7b, 0x74, 0x07, 0x0a, 0xf6, 0x77, 0x73, 0x75, 0x6c, 0x3d, 0x2d,
-  0x0c, 0xf7, 0x04, 0x10, 0x7e, 0x0f, 0x1a, 0xff, 0x75, 0x09, 0x8b, 0x8f,
-  0x36, 0x34, 0x83, 0xd6, 0xc1, 0x07, 0xba, 0xb5, 0x08, 0xa2, 0x30, 0x6f,
-  0x3f, 0x81, 0xc3, 0xb2, 0x07, 0xc1, 0xf6, 0xc3, 0xbb, 0x0b, 0x01, 0x49,
-  0x0c, 0xbb, 0x43, 0xd1, 0xfb, 0x01, 0x7f, 0x03, 0xd9, 0xb8, 0x6d, 0x01,
-  0xf7, 0xfc, 0x66, 0x04, 0x03, 0xc3, 0x05, 0x04, 0x1d, 0x67, 0xbb, 0x52,
-  0x22, 0xa1, 0x2b, 0x7b, 0x2b, 0xca, 0x8b, 0x5b, 0x3e, 0x75, 0x0e, 0x3b,
-  0x97, 0x8d, 0x16, 0x75, 0xc6, 0x19, 0x80, 0xe4, 0xa1, 0x77, 0x7b, 0x13,
-  0xeb, 0x0c, 0x0d, 0x7c, 0x72, 0x08, 0x75, 0x0b, 0xd8, 0x01, 0x77, 0xb0,
-  0xbd, 0xc0, 0x1e, 0x02, 0x23, 0x34, 0xe4, 0x41, 0x26, 0xc8, 0xae, 0x08,
-  0xd1, 0x8a, 0xc6, 0xdf, 0x40, 0x8a, 0xc2, 0xd4, 0x10, 0x86, 0xb9, 0xe0,
-  0x08, 0xbf, 0x04, 0x04, 0x90, 0x27, 0x14, 0x40, 0xe8, 0x27, 0xaa, 0xc3,
-  0x1e, 0xc3, 0x96, 0x56, 0xf8, 0xca, 0xee, 0xdc, 0x04, 0xec, 0x50, 0xd0,
-  0xea, 0xda, 0x02, 0x4a, 0x57, 0x64, 0xce, 0xe0, 0xaf, 0x17, 0x61, 0x5f,
-  0xc3, 0x42, 0xb3, 0xff, 0x05, 0x47, 0xfe, 0x4e, 0xec, 0x75, 0x33, 0x15,
-  0x77, 0x6b, 0x8d, 0x86, 0x6a, 0x5b, 0x70, 0xf8, 0xbc, 0x16, 0x06, 0x4a,
-  0x07, 0x0c, 0x3a, 0x1c, 0x56, 0x0e, 0x17, 0x98, 0x3a, 0x3a, 0x01, 0xcf,
-  0x44, 0x01, 0x7e, 0xed, 0xee, 0x8d, 0xbe, 0x1f, 0x15, 0x77, 0x78, 0xc3,
-  0x06, 0xfc, 0x78, 0x0a, 0x05, 0x99, 0xb4, 0x8b, 0x02, 0x0f, 0x5b, 0xac,
-  0x4d, 0x96, 0x12, 0x52, 0x70, 0xad, 0xff, 0x60, 0x55, 0xe2, 0x7f, 0xed,
-  0xd0, 0xce, 0x2f, 0x99, 0xe8, 0xe9, 0xfa, 0xf6, 0x03, 0x89, 0x76, 0xf0,
-  0x1d, 0xba, 0x19, 0xe6, 0xed, 0x2c, 0x33, 0xc9, 0x4b, 0x82, 0xf2, 0x13,
-  0xab, 0x09, 0x73, 0x7b, 0x88, 0x4e, 0xf5, 0x07, 0x6d, 0xf8, 0x8d, 0x57,
-  0xc0, 0x0a, 0x66, 0xbc, 0x21, 0xad, 0x30, 0xc6, 0x8b, 0xd0, 0x13, 0xa6,
-  0xc3, 0x46, 0x84, 0xfe, 0x60, 0x73, 0x13, 0x8a, 0x9f, 0x73, 0x17, 0x59,
-  0xfb, 0x17, 0x85, 0x76, 0xe2, 0xc2, 0xa5, 0x03, 0x73, 0x89, 0xe8, 0x69,
-  0xa7, 0xc5, 0x74, 0xe9, 0x9b, 0xbf, 0xe1, 0xfd, 0x00, 0x77, 0xf8, 0x83,
-  0x06, 0xa8, 0xf7, 0x01, 0xeb, 0xcf, 0x0a, 0xcd, 0xed, 0x02, 0xcf, 0xeb,
-  0xc4, 0xe2, 0x0b, 0x35, 0xf5, 0x4b, 0x73, 0x03, 0xff, 0x88, 0x56, 0xf5,
-  0xeb, 0xb4, 0x83, 0x66, 0xfe, 0x85, 0xdf, 0x22, 0x77, 0x1b, 0x20, 0xb5,
-  0x05, 0xdf, 0xeb, 0xa6, 0x1d, 0x4d, 0xb5, 0xf7, 0x72, 0x35, 0x5c, 0x29,
-  0xdb, 0x13, 0x08, 0xb5, 0x3c, 0x7d, 0x92, 0xe9, 0x50, 0x03, 0xba, 0xb6,
-  0x04, 0x36, 0x96, 0xf1, 0x83, 0x16, 0xfc, 0x02, 0xde, 0x20, 0x02, 0x73,
-  0x12, 0xd8, 0xe8, 0x79, 0x29, 0xf7, 0x5e, 0x4f, 0x02, 0xdb, 0xce, 0xb5,
-  0x75, 0x76, 0x6e, 0xff, 0x16, 0x85, 0x9f, 0xb7, 0xd7, 0x0c, 0xf6, 0xfe,
-  0xe7, 0xc5, 0xe9, 0x61, 0xe2, 0x73, 0xca, 0xb5, 0x97, 0x19, 0xf6, 0xe9,
-  0xf1, 0x54, 0xff, 0x92, 0x2c, 0xae, 0xb6, 0x34, 0xfc, 0x77, 0x19, 0xb5,
-  0x02, 0x87, 0x46, 0x5f, 0x63, 0xd1, 0xda, 0xd1, 0xe0, 0xbb, 0xa1, 0xb4,
-  0xbb, 0x03, 0xc2, 0x01, 0x10, 0x76, 0xe9, 0x32, 0x3b, 0x36, 0x9b, 0x1b,
-  0xcb, 0xf6, 0x74, 0x90, 0xb5, 0x36, 0x3d, 0xee, 0x16, 0xff, 0x63, 0xfb,
-  0x10, 0xe9, 0x65, 0xff, 0x81, 0x06, 0x42, 0x4f, 0xbb, 0xa9, 0xef, 0xe9,
-  0xe2, 0x59, 0xff, 0xb7, 0xed, 0x70, 0xb7, 0x0a, 0xdf, 0x03, 0x10, 0xb3,
-  0xe9, 0x02, 0xda, 0x00, 0xb6, 0xd6, 0x00, 0xc7, 0xc6, 0xfb, 0x2c, 0xb6,
-  0x04, 0xfa, 0xcf, 0xa5, 0xeb, 0x10, 0x6b, 0x1d, 0x15, 0x73, 0xfa, 0x01,
-  0x33, 0x10, 0xe1, 0x99, 0x47, 0x47, 0x55, 0x6e, 0x06, 0xd4, 0x15, 0x6d,
-  0x01, 0x05, 0xb7, 0x0f, 0x15, 0x0e, 0x37, 0x17, 0x8d, 0x7e, 0x86, 0xbb,
-  0xae, 0xf8, 0x2f, 0x0b, 0xd2, 0x75, 0x2b, 0x21, 0x1f, 0x9a, 0xed, 0x18,
-  0x99, 0x0b, 0x3b, 0xf8, 0xfa, 0xe3, 0x1a, 0x83, 0xf9, 0xff, 0xd1, 0x94,
-  0x36, 0xe3, 0x25, 0x08, 0x86, 0x7b, 0xc2, 0xb2, 0x30, 0x6c, 0xe3, 0xb2,
-  0x20, 0x34, 0x7f, 0xe8, 0x00, 0xfe, 0xe2, 0xf9, 0xe9, 0x06, 0x92, 0xba,
-  0x8e, 0x04, 0x2d, 0xfd, 0xfa, 0x16, 0x57, 0x8a, 0xc7, 0x98, 0x0d, 0x43,
-  0xfe, 0xfa, 0x50, 0x53, 0xe8, 0xe5, 0xf3, 0x16, 0xa6, 0xa8, 0x6d, 0xbb,
-  0xd2, 0x6f, 0xc5, 0xe9, 0xf4, 0x00, 0xde, 0xe9, 0xff, 0x8c, 0xe6, 0x6d,
-  0x5e, 0xc7, 0xba, 0xd4, 0x7e, 0x36, 0xff, 0x37, 0x43, 0x43, 0x89, 0xd7,
-  0x07, 0x7b, 0x4b, 0x20, 0x10, 0x2d, 0x17, 0x8b, 0x0e, 0x31, 0x7f, 0xe8,
-  0x71, 0xfd, 0xb0, 0x3a, 0xaa, 0x6f, 0x07, 0x5a, 0xe8, 0x68, 0xd5, 0xfd,
-  0x36, 0xb7, 0x31, 0x00, 0xaf, 0x5d, 0x00, 0xde, 0xfb, 0x56, 0x10, 0xc4,
-  0xba, 0xbb, 0x4a, 0x87, 0xcf, 0x50, 0xbe, 0x3b, 0xd1, 0x7f, 0x02, 0x8b,
-  0x25, 0x47, 0xdc, 0xa1, 0x00, 0x4c, 0xc9, 0xc9, 0x0e, 0x80, 0xd7, 0x34,
-  0xba, 0x05, 0xfe, 0xe0, 0x36, 0x89, 0x05, 0x85, 0xc0, 0xd9, 0xe9, 0xbc,
-  0x1f, 0x6c, 0x64, 0x76, 0x75, 0x0d, 0x26, 0xcf, 0x3d, 0x1e, 0xc6, 0x07,
-  0x0b, 0x28, 0xf7, 0x0b, 0x36, 0xc4, 0x0c, 0xc1, 0x04, 0x70, 0x33, 0xd6,
-  0x9a, 0x12, 0xff, 0xbf, 0x6c, 0x34, 0xe8, 0x29, 0xfd, 0x3b, 0xc6, 0x4e,
-  0xf6, 0x29, 0xb4, 0xeb, 0x2d, 0x5e, 0x7f, 0x96, 0x3c, 0xe5, 0x0e, 0x76,
-  0xc3, 0x03, 0xb9, 0x95, 0xfa, 0xb1, 0xdc, 0x51, 0xbe, 0xd7, 0x5e, 0xbb,
-  0x53, 0x52, 0x9a, 0x53, 0x23, 0x08, 0xd0, 0x32, 0xd0, 0x0a, 0xa9, 0xa2,
-  0x7b, 0x58, 0xb2, 0xb8, 0x57, 0x0f, 0x4a, 0x05, 0x77, 0xba, 0x07, 0x05,
-  0x08, 0x82, 0xfd, 0x08, 0x47, 0x08, 0x8b, 0x8b, 0x77, 0x83, 0x2a, 0x42,
-  0x18, 0x04, 0xcb, 0xf8, 0x7e, 0xeb, 0x11, 0xe8, 0xc9, 0x6d, 0xb5, 0x3d,
-  0x2d, 0xaa, 0x47, 0x5c, 0x75, 0xd1, 0x7e, 0x6e, 0xcd, 0x56, 0xf2, 0x16,
-  0x26, 0xf5, 0x3d, 0xec, 0xff, 0x14, 0x74, 0x0c, 0x83, 0x6e, 0xf2, 0x51,
-  0xbe, 0xcc, 0xf2, 0x00, 0x4f, 0x26, 0x37, 0xf7, 0xe8, 0x9f, 0x0b, 0x70,
-  0xf7, 0x0f, 0x75, 0x5e, 0xef, 0xf8, 0xb8, 0x05, 0x6a, 0xb6, 0x3d, 0x05,
-  0x75, 0x37, 0xca, 0x66, 0xfb, 0xed, 0x80, 0xfc, 0x6f, 0xc6, 0x0a, 0x94,
-  0xda, 0x25, 0x7f, 0x66, 0x4d, 0x2f, 0xa8, 0xd6, 0xd9, 0x11, 0xd0, 0x78,
-  0x2f, 0x11, 0xfc, 0x58, 0x75, 0x86, 0x11, 0x80, 0xee, 0x40, 0x4b, 0x4b,
-  0x46, 0xde, 0x02, 0x7d, 0x1c, 0x96, 0xa5, 0x03, 0x94, 0x21, 0x67, 0xae,
-  0x0c, 0x16, 0xd8, 0xff, 0xb0, 0x20, 0xe8, 0x58, 0xfc, 0x4b, 0x3b, 0xee,
-  0xd9, 0x7f, 0xf6, 0x93, 0x97, 0x40, 0x0b, 0xb0, 0xb5, 0x30, 0xa4, 0x0d,
-  0x75, 0xfb, 0xed, 0xe8, 0x41, 0xfc, 0x9e, 0x9a, 0xf2, 0x27, 0xb7, 0x4d,
-  0x2b, 0xda, 0x11, 0xb6, 0x1f, 0x3c, 0x8b, 0xfb, 0x08, 0x3c, 0x20, 0x74,
-  0x07, 0x6a, 0x2b, 0x54, 0x86, 0xbf, 0x4c, 0xe8, 0x22, 0xfc, 0x49, 0x4b,
-  0xf7, 0x87, 0xca, 0xe3, 0x07, 0x2f, 0x61, 0x17, 0xfc, 0xe8, 0x5d, 0x0a,
-  0x12, 0x12, 0x71, 0xb5, 0x17, 0x21, 0x9c, 0xf6, 0x03, 0xe8, 0x0a, 0x15,
-  0xfa, 0xf0, 0x0b, 0xdb, 0x7e, 0xdb, 0xc2, 0xcb, 0x63, 0xb1, 0xf4, 0xfb,
-  0xd8, 0x0b, 0x38, 0xfc, 0x60, 0x3b, 0x93, 0x75, 0x0b, 0x24, 0x85, 0x1f,
-  0x08, 0x73, 0x2a, 0x6a, 0x8b, 0x2a, 0xda, 0x06, 0x03, 0xd8, 0x53, 0x26,
-  0x51, 0xa9, 0x9c, 0x7b, 0x07, 0x6e, 0x78, 0x26, 0xc7, 0x29, 0x6c, 0x70,
-  0xe9, 0xf9, 0xa9, 0x71, 0xe5, 0x6b, 0x8e, 0xd5, 0x5d, 0xfc, 0xb0, 0xf5,
-  0x25, 0xe8, 0xa5, 0xfb, 0xfa, 0x0e, 0x75, 0xf7, 0x55, 0x93, 0xa1, 0x34,
-  0x81, 0x42, 0x15, 0xed, 0xfb, 0x07, 0xfb, 0x82, 0xea, 0xb0, 0xac, 0x6d,
-  0x8b, 0x3f, 0x01, 0x88, 0x00, 0x17, 0xf8, 0xa7, 0x30, 0xff, 0x91, 0x30,
-  0xdc, 0x30, 0x9c, 0x30, 0x0a, 0x31, 0xff, 0x17, 0x31, 0x55, 0x31, 0x5c,
-  0x31, 0x61, 0x31, 0xff, 0xc5, 0x30, 0x8a, 0x31, 0x68, 0x31, 0x6c, 0x31,
-  0xff, 0x70, 0x31, 0x07, 0x32, 0xb4, 0x32, 0x57, 0x32, 0xfd, 0x77, 0x32,
-  0xf0, 0x33, 0x2c, 0x34, 0xfe, 0x01, 0xb7, 0x30, 0xbd, 0x30, 0xa9, 0xa0,
-  0xf0, 0x04, 0x48, 0x56, 0xca, 0x0f, 0x50, 0xa1, 0xcf, 0xd2, 0x33, 0x5a,
-  0x56, 0xaa, 0x5b, 0x06, 0x4a, 0x05, 0x53, 0x66, 0x71, 0x16, 0xd1, 0x33,
-  0x4e, 0x6f, 0xa7, 0x68, 0x5b, 0xfb, 0xa0, 0xea, 0xce, 0x33, 0xb4, 0xf5,
-  0x62, 0x7e, 0xf1, 0xe3, 0x5a, 0x2e, 0x47, 0x17, 0x4d, 0x78, 0xfc, 0x3b,
-  0xf7, 0x73, 0xb7, 0x4f, 0xc1, 0x48, 0x68, 0x2c, 0x06, 0x36, 0xa9, 0xfd,
-  0xda, 0xc5, 0xa8, 0xe6, 0x5f, 0xd8, 0xeb, 0x3b, 0xba, 0xda, 0x8d, 0x03,
-  0x51, 0xf5, 0x8c, 0xdb, 0x3b, 0xc3, 0xbf, 0xbf, 0xfa, 0xec, 0xd0, 0xc8,
-  0x72, 0xbb, 0xfb, 0x04, 0x73, 0xfb, 0x6e, 0xc7, 0xe2, 0xf1, 0x8d, 0xfe,
-  0x60, 0x10, 0x36, 0xad, 0xe6, 0xd9, 0xd8, 0x0d, 0x7d, 0x8b, 0xc3, 0xab,
-  0xbc, 0x20, 0xe1, 0xfc, 0x1f, 0x15, 0x96, 0x4c, 0xa4, 0x56, 0xba, 0x08,
-  0x5c, 0x72, 0xb8, 0x02, 0x04, 0x95, 0x97, 0xa3, 0xf7, 0x64, 0x40, 0x27,
-  0x0f, 0x50, 0x52, 0x21, 0x5e, 0x10, 0x58, 0x07, 0xd9, 0xcb, 0xee, 0xef,
-  0x00, 0x65, 0x00, 0x3f, 0x2e, 0x3b, 0x16, 0x80, 0x35, 0xd0, 0x74, 0x37,
-  0xbc, 0x50, 0x8e, 0x1e, 0x02, 0x11, 0xad, 0x06, 0x03, 0x0d, 0x7d, 0x2e,
-  0xff, 0x8c, 0x1e, 0x82, 0x35, 0xeb, 0x38, 0x8c, 0xd8, 0x6c, 0x1c, 0x06,
-  0xdd, 0x15, 0xa1, 0x08, 0xb6, 0x26, 0xa3, 0x11, 0xc0, 0x1e, 0x35, 0x49,
-  0xa1, 0x14, 0xd6, 0xc7, 0x86, 0x1d, 0xf7, 0x23, 0x2e, 0x8b, 0x38, 0x6e,
-  0x2e, 0xc7, 0x20, 0x73, 0x44, 0x06, 0x64, 0x82, 0xe7, 0x84, 0x7d, 0x20,
-  0x52, 0xfe, 0x2c, 0x82, 0xce, 0x58, 0x58, 0x86, 0xab, 0xed, 0x1e, 0x8e,
-  0x06, 0x57, 0x6d, 0x1b, 0x02, 0xdc, 0x72, 0x8c, 0x06, 0x08, 0x83, 0x2e,
-  0xb1, 0x26, 0x6d, 0xdb, 0x75, 0x26, 0x51, 0x00, 0x81, 0x5b, 0xe7, 0x77,
-  0x01, 0x06, 0x1c, 0x7d, 0xc1, 0x03, 0xd0, 0x8e, 0xc2, 0x82, 0x17, 0x29,
-  0x30, 0x6d, 0x0e, 0x2b, 0x5a, 0xbc, 0xe5, 0x06, 0x5d, 0xc9, 0xe8, 0xe1,
-  0x51, 0x00, 0x07, 0x4a, 0x77, 0x26, 0x03, 0x26, 0x23, 0xa0, 0x59, 0xa7,
-  0xee, 0x01, 0xc3, 0x3a, 0x66, 0x38, 0x1b, 0x63, 0x03, 0x1e, 0x77, 0x19,
-  0xc3, 0x26, 0xa3, 0x28, 0x68, 0x6f, 0x1e, 0x2d, 0x60, 0xb5, 0x19, 0x75,
-  0xad, 0x05, 0x8a, 0xb9, 0x04, 0x73, 0xaa, 0x07, 0x57, 0xe6, 0x08, 0x39,
-  0xd7, 0xbd, 0x9f, 0x8e, 0xdb, 0xc3, 0x82, 0xa7, 0xdb, 0x07, 0xa1, 0x06,
-  0x40, 0xdf, 0x4a, 0x20, 0x8c, 0xd3, 0xfa, 0x8e, 0xdf, 0xd0, 0x36, 0x2e,
-  0x36, 0xbb, 0x8c, 0x39, 0x8c, 0x16, 0x6f, 0x2a, 0x8e, 0xd3, 0xfb, 0x62,
-  0x32, 0xfb, 0x3b, 0xc3, 0x37, 0x16, 0x0d, 0x33, 0x1e, 0x23, 0x44, 0x17,
-  0x12, 0x35, 0xe3, 0x2c, 0x29, 0x08, 0xbb, 0x74, 0x0f, 0xcf, 0x9a, 0xfd,
-  0xb5, 0x34, 0x12, 0x6f, 0xbb, 0xa6, 0x10, 0xff, 0x62, 0xfe, 0x8f, 0x29,
-  0xb1, 0x50, 0x09, 0x0c, 0x07, 0xae, 0x45, 0xf8, 0xcd, 0x5b, 0x5b, 0x25,
-  0x0f, 0x05, 0xe9, 0x8d, 0xba, 0xdd, 0xda, 0x2b, 0xd0, 0x12, 0xc4, 0x19,
-  0x2e, 0xbf, 0xe8, 0xa0, 0xe8, 0x17, 0x58, 0x5e, 0xcc, 0xdb, 0x8a, 0xdc,
-  0xa0, 0xde, 0xa8, 0xeb, 0xd3, 0xe0, 0xc6, 0x17, 0x53, 0xd9, 0x2f, 0x88,
-  0xa0, 0x5b, 0x35, 0xda, 0x6e, 0x2c, 0x2e, 0x89, 0x1e, 0x66, 0x89, 0xe0,
-  0x61, 0xb7, 0x47, 0x89, 0xe2, 0x36, 0x09, 0x02, 0x87, 0x8c, 0x97, 0xc3,
-  0x99, 0xc3, 0x60, 0x38, 0x0c, 0x4f, 0x97, 0x8b, 0xc8, 0x0e, 0x82, 0x4c,
-  0x0e, 0x97, 0x8b, 0xc3, 0xda, 0x29, 0x35, 0x75, 0x03, 0x16, 0x00, 0x13,
-  0x76, 0x3a, 0x1a, 0x1e, 0x56, 0x12, 0x84, 0x40, 0x6c, 0xdb, 0x5f, 0x37,
-  0xe5, 0x0d, 0x61, 0x53, 0x36, 0x6e, 0xeb, 0x09, 0x09, 0x52, 0x41, 0x6c,
-  0xf5, 0x3f, 0xc8, 0x0b, 0xca, 0x74, 0xe3, 0x5e, 0x05, 0x13, 0x2d, 0x60,
-  0xd2, 0x05, 0x3a, 0xfd, 0xf7, 0xc2, 0xf0, 0xff, 0x75, 0x3b, 0xdf, 0x84,
-  0xe8, 0xd3, 0xe2, 0x0a, 0xe2, 0x18, 0x14, 0x86, 0x13, 0xba, 0x20, 0x08,
-  0x84, 0x7b, 0x12, 0x57, 0x5b, 0x62, 0x39, 0x76, 0x6c, 0x73, 0x1c, 0xd6,
-  0x11, 0x06, 0xfa, 0x3b, 0xd3, 0x75, 0xf0, 0xd4, 0x68, 0xbc, 0xad, 0x1f,
-  0xe8, 0xe1, 0x2f, 0x2c, 0x1a, 0xe8, 0x76, 0x6d, 0x09, 0x15, 0xc0, 0x8f,
-  0xdf, 0x87, 0x77, 0xf4, 0xe8, 0x48, 0xf7, 0xfe, 0x8b, 0x1e, 0x08, 0x8a,
-  0xbc, 0x7e, 0x24, 0x43, 0xda, 0x53, 0x48, 0xb7, 0x5b, 0x35, 0x56, 0x76,
-  0x05, 0x8a, 0x35, 0x28, 0xdd, 0x87, 0x72, 0xff, 0xa0, 0xdd, 0xe8, 0x88,
-  0x02, 0xb6, 0x27, 0x1f, 0x37, 0x28, 0x06, 0x1e, 0x46, 0xe9, 0xbb, 0xc2,
-  0xfc, 0x4a, 0xa0, 0xbf, 0xb6, 0xfe, 0xf7, 0x06, 0x90, 0x4a, 0x71, 0xe8,
-  0x71, 0x37, 0xdc, 0x0c, 0x40, 0x8e, 0x6d, 0x0f, 0xd8, 0xbc, 0x04, 0xd8,
-  0x33, 0xff, 0x0d, 0x36, 0xca, 0xd2, 0x81, 0xf9, 0x00, 0x81, 0xc5, 0x6d,
-  0xb9, 0x04, 0xde, 0xd1, 0xe1, 0x01, 0xdd, 0x24, 0x81, 0xea, 0xd6, 0x10,
-  0x10, 0x26, 0xda, 0x05, 0x06, 0xf7, 0x28, 0x06, 0xc2, 0xd8, 0x42, 0xb1,
-  0x72, 0x6f, 0x61, 0x20, 0xfe, 0x5a, 0x68, 0x00, 0x70, 0x00, 0xb2, 0xd5,
-  0x1e, 0xfa, 0x74, 0x44, 0x8b, 0xfb, 0x5e, 0xd0, 0x8e, 0xc7, 0x8b, 0x8d,
-  0x7c, 0x8d, 0xf0, 0x88, 0x8e, 0x36, 0x6e, 0x7e, 0xa0, 0x06, 0x50, 0x3c,
-  0x68, 0x6f, 0xaf, 0x8b, 0xd3, 0x03, 0x90, 0xd1, 0xe6, 0x74, 0xa2, 0x3e,
-  0x19, 0xc5, 0xcd, 0x06, 0xc6, 0xdb, 0x8b, 0xf3, 0x49, 0xd6, 0x97, 0xfd,
-  0x8b, 0xd6, 0x7d, 0x4a, 0x53, 0x9f, 0x2e, 0x03, 0xd8, 0x53, 0x4f, 0x14,
-  0x6d, 0xb3, 0xcb, 0x61, 0x09, 0x62, 0x81, 0x8b, 0x42, 0x5f, 0x32, 0x0c,
-  0x8a, 0x60, 0x2d, 0x98, 0x62, 0x76, 0xb6, 0xf4, 0xa5, 0x72, 0x68, 0xf2,
-  0x17, 0x49, 0x74, 0x32, 0x08, 0x6f, 0xc9, 0x34, 0x84, 0x67, 0x37, 0x50,
-  0x05, 0xde, 0x6d, 0x51, 0x3b, 0x6f, 0x32, 0x0e, 0x77, 0x07, 0x6b, 0x86,
-  0x4d, 0xbc, 0xeb, 0x1d, 0xe8, 0x4c, 0x2f, 0x57, 0x18, 0xe8, 0xcd, 0x2a,
-  0x29, 0xae, 0x5b, 0x7d, 0x48, 0x6e, 0x07, 0x09, 0x53, 0x6c, 0x50, 0xfd,
-  0x36, 0x60, 0x5f, 0x5f, 0x12, 0x50, 0x7d, 0x56, 0x96, 0x92, 0x85, 0x12,
-  0xaf, 0xff, 0xf7, 0xe3, 0xe3, 0x05, 0x91, 0xf7, 0xe6, 0xed, 0x03, 0xc1,
-  0x96, 0x09, 0xfe, 0x03, 0xd6, 0x5e, 0xcb, 0x59, 0x0e, 0x51, 0x85, 0x43,
-  0xdc, 0xeb, 0x16, 0x06, 0x26, 0x2b, 0xdf, 0xeb, 0x0e, 0x07, 0x02, 0x2c,
-  0x06, 0xf5, 0x03, 0xad, 0x80, 0x96, 0x75, 0xa3, 0xf9, 0xee, 0xa2, 0xa8,
-  0x8a, 0x5e, 0x46, 0xc6, 0x75, 0x3e, 0xfb, 0x69, 0xe8, 0xa0, 0x65, 0x8e,
-  0x3e, 0xdb, 0x75, 0x1c, 0x0d, 0x79, 0xaa, 0x0a, 0xcf, 0xbc, 0x83, 0xcf,
-  0xb5, 0x0c, 0x1f, 0xa2, 0x0d, 0x96, 0xdb, 0xdb, 0x5c, 0x83, 0xf7, 0x4b,
-  0x33, 0xe9, 0x81, 0xb9, 0xfa, 0x51, 0x4b, 0x56, 0x33, 0x8b, 0xf6, 0xb1,
-  0xbf, 0xd2, 0xd1, 0xd6, 0xd1, 0xd7, 0x3b, 0xa9, 0xfd, 0x21, 0x7f, 0x77,
-  0x04, 0x3b, 0xf3, 0x72, 0x05, 0xff, 0x2b, 0xf3, 0x1b, 0xfd, 0x40, 0xe2,
-  0xe7, 0x5b, 0xd4, 0xf7, 0xc3, 0x4d, 0x8a, 0x8b, 0xfb, 0xc6, 0x8b, 0xd7,
-  0xd1, 0xeb, 0x0b, 0x61, 0x04, 0x50, 0x98, 0x4d, 0x2e, 0xb5, 0xd1, 0xca,
-  0x08, 0xcd, 0xde, 0x66, 0x76, 0x20, 0x01, 0x92, 0x1b, 0x32, 0xed, 0x5b,
-  0xfe, 0x0e, 0x53, 0x80, 0xf9, 0x10, 0x73, 0x10, 0x05, 0x35, 0x1a, 0xf9,
-  0x17, 0x0e, 0xf6, 0xd9, 0xe9, 0x80, 0xc1, 0x10, 0x04, 0x7f, 0x0b, 0xd3,
-  0xcb, 0x80, 0xe9, 0x10, 0x6d, 0x1f, 0xc0, 0xb6, 0x11, 0xcb, 0x20, 0x4c,
-  0xda, 0x35, 0x2f, 0xea, 0x9f, 0x20, 0xe3, 0x0b, 0xc3, 0x27, 0xd2, 0x6f,
-  0x13, 0xcb, 0x07, 0x0e, 0x89, 0x06, 0xc5, 0xba, 0x0c, 0xf7, 0xd3, 0x37,
-  0xb1, 0x83, 0xc3, 0x12, 0x68, 0xdb, 0xd1, 0xeb, 0x2f, 0x52, 0x4a, 0xe0,
-  0x73, 0x04, 0xa5, 0x9f, 0xea, 0x10, 0x8a, 0xe9, 0x25, 0x56, 0xf6, 0xe5,
-  0x02, 0xf5, 0x8a, 0x39, 0xd6, 0xe8, 0x8f, 0xe9, 0x8a, 0xc5, 0xb7, 0x98,
-  0x2e, 0x03, 0xd1, 0x9e, 0x2b, 0xea, 0x69, 0xf9, 0xbe, 0xe7, 0x32, 0xdb,
-  0x2b, 0xd3, 0xc8, 0x30, 0x50, 0x60, 0xac, 0x8a, 0xf0, 0x10, 0x4d, 0xe7,
-  0x13, 0x82, 0xc9, 0x56, 0x55, 0xcd, 0x61, 0x85, 0x02, 0xf6, 0xc3, 0x51,
-  0x42, 0x87, 0xe1, 0x7e, 0x44, 0x8a, 0xe3, 0xde, 0xd1, 0x59, 0x03, 0xcb,
-  0x95, 0xdf, 0xdc, 0x4d, 0x83, 0xe3, 0x0f, 0x5a, 0xe4, 0x34, 0xf4, 0x1b,
-  0x45, 0xc3, 0xe0, 0xff, 0x26, 0xe8, 0x17, 0x28, 0x8f, 0x06, 0xdb, 0xda,
-  0x34, 0x03, 0xdc, 0x36, 0xde, 0x34, 0x3b, 0x2f, 0x3e, 0x3b, 0x1b, 0x99,
-  0xe0, 0x8d, 0x34, 0x76, 0xf5, 0xe2, 0x34, 0xfc, 0x8e, 0x12, 0x26, 0xf1,
-  0xbe, 0x80, 0x00, 0x5b, 0x79, 0xac, 0xfd, 0x40, 0x8c, 0xc5, 0x87, 0xd6,
-  0x93, 0x2f, 0x37, 0x73, 0x00, 0x46, 0x86, 0x46, 0xd3, 0xe3, 0x80, 0x3e,
-  0x7b, 0x80, 0x76, 0x72, 0x11, 0x20, 0xc6, 0x75, 0x9c, 0xf5, 0xfe, 0xb1,
-  0x7f, 0x3f, 0xac, 0xe3, 0x6e, 0x80, 0xc5, 0xf1, 0x7f, 0x4a, 0xcc, 0xde,
-  0xf8, 0x40, 0x25, 0xfe, 0x96, 0x2a, 0xfc, 0xa5, 0xa6, 0xfc, 0x72, 0x5c,
-  0x8b, 0xe7, 0x06, 0x1f, 0x5b, 0xab, 0x51, 0xb5, 0x49, 0xa9, 0xbf, 0x21,
-  0xaa, 0x8e, 0xdd, 0x87, 0xf2, 0xeb, 0x87, 0xd9, 0x8b, 0x2e, 0x7e, 0xd0,
-  0x43, 0xe8, 0x19, 0x00, 0x37, 0x68, 0x72, 0x42, 0xdb, 0xe8, 0x12, 0x06,
-  0xf9, 0x17, 0x0e, 0x0b, 0x12, 0x66, 0x0d, 0xed, 0x09, 0x75, 0xe8, 0x25,
-  0xc0, 0xeb, 0xe4, 0xdc, 0x42, 0x07, 0x42, 0xaa, 0x4d, 0x98, 0x01, 0xab,
-  0x43, 0x2b, 0x5b, 0x10, 0xf9, 0xfc, 0xe3, 0x15, 0xac, 0x49, 0x2c, 0x22,
-  0x0b, 0x17, 0x04, 0xe0, 0x22, 0x3c, 0x5c, 0x5e, 0xc6, 0x80, 0x3c, 0x22,
-  0xd6, 0xba, 0x10, 0xd5, 0x0b, 0xba, 0xbf, 0xea, 0xf0, 0x8b, 0x62, 0xb1,
-  0x03, 0xca, 0xce, 0x8b, 0xb2, 0xfd, 0x1e, 0xd4, 0x34, 0x43, 0x03, 0xdb,
-  0xb8, 0x01, 0x8b, 0xf4, 0x5f, 0x27, 0x2b, 0xeb, 0x72, 0xe2, 0x06, 0xeb,
-  0xf8, 0x89, 0x2e, 0xd6, 0x34, 0x17, 0x7b, 0xd8, 0x34, 0xd0, 0xe3, 0x11,
-  0xbf, 0xc9, 0x00, 0x8c, 0x56, 0x02, 0x83, 0x94, 0xc5, 0x4d, 0xef, 0xe0,
-  0xe2, 0xfa, 0x74, 0xed, 0xa6, 0xf7, 0x13, 0x74, 0x58, 0x02, 0x3a, 0xdd,
-  0x8b, 0xed, 0x8b, 0x37, 0xff, 0x36, 0xde, 0x70, 0x03, 0x5b, 0x06, 0xa1,
-  0x49, 0x7e, 0xa3, 0x69, 0x00, 0xa1, 0xd8, 0xd9, 0x05, 0x6d, 0x65, 0xd6,
-  0x55, 0x2c, 0x75, 0x26, 0x28, 0x20, 0x57, 0x7b, 0xeb, 0x8d, 0x73, 0xb7,
-  0x06, 0x22, 0x77, 0x00, 0x11, 0x7d, 0x34, 0x5b, 0x00, 0xb8, 0x70, 0xa3,
-  0xe4, 0x0d, 0x70, 0xeb, 0xe6, 0x34, 0x1e, 0x94, 0x41, 0x2d, 0xae, 0x05,
-  0x8c, 0x91, 0x33, 0x17, 0xfb, 0x7b, 0x89, 0x3f, 0x8c, 0x47, 0x70, 0x46,
-  0x76, 0x85, 0x15, 0x55, 0x77, 0x63, 0xf1, 0x89, 0x07, 0x51, 0xa1, 0x7c,
-  0xab, 0xb6, 0xa1, 0xe6, 0x54, 0xcb, 0x71, 0xe4, 0x2d, 0x6f, 0x38, 0xaf,
-  0xbe, 0x00, 0x8b, 0x26, 0x73, 0xf1, 0x09, 0x00, 0xe8, 0x24, 0x56, 0xfd,
-  0xd0, 0x83, 0xa0, 0x4d, 0x36, 0x2b, 0x8d, 0x2a, 0xfc, 0xbe, 0xc4, 0x5f,
-  0x01, 0xd6, 0xdc, 0x3a, 0x14, 0xec, 0x74, 0x0d, 0x0e, 0x3f, 0x80, 0x3f,
-  0x2f, 0x75, 0xb2, 0x71, 0x0c, 0x7f, 0x7f, 0x01, 0x3f, 0x75, 0x0f, 0x8a,
-  0x6a, 0x1f, 0x01, 0x67, 0x7c, 0x01, 0xcb, 0x03, 0x59, 0x52, 0x4a, 0xc1,
-  0xc3, 0x2f, 0x82, 0x1b, 0x01, 0x50, 0x41, 0x63, 0x1d, 0x04, 0xaa, 0x40,
-  0xe6, 0x33, 0x1c, 0xea, 0xb0, 0x2b, 0x90, 0x23, 0x59, 0x2c, 0xc8, 0x21,
-  0x33, 0x96, 0x48, 0x22, 0x57, 0x09, 0xdc, 0x9a, 0xea, 0x28, 0x01, 0xc2,
-  0x6d, 0x6f, 0x26, 0x97, 0x2a, 0x9a, 0x0a, 0xaa, 0x0c, 0xf5, 0xaa, 0x6e,
-  0xd1, 0x7e, 0x4f, 0xc0, 0x8e, 0x42, 0x93, 0xb0, 0xaa, 0x9d, 0x75, 0x33,
-  0xb2, 0x53, 0xec, 0x15, 0xa9, 0xdb, 0xa0, 0x08, 0x34, 0x5d, 0x02, 0xb1,
-  0x8d, 0x24, 0xda, 0xc6, 0x48, 0x19, 0xb7, 0x08, 0x43, 0x04, 0x8a, 0xeb,
-  0x4f, 0xfb, 0x56, 0x9a, 0x1b, 0x96, 0xa8, 0xa0, 0x0b, 0xb8, 0x14, 0x12,
-  0x27, 0x68, 0x87, 0x9b, 0x64, 0x04, 0x2d, 0x8a, 0x93, 0xee, 0x50, 0xcc,
-  0xbf, 0x25, 0xce, 0xc0, 0x04, 0x20, 0xdb, 0xa2, 0x70, 0x90, 0x03, 0xe0,
-  0x3e, 0x91, 0xf0, 0x0b, 0x40, 0x56, 0x90, 0x08, 0xdb, 0x0b, 0x74, 0x24,
-  0xad, 0xbc, 0x55, 0x6d, 0x04, 0xde, 0x51, 0xfd, 0xea, 0xb7, 0x92, 0x00,
-  0xbb, 0x03, 0x90, 0x00, 0x1d, 0x64, 0x95, 0xc3, 0x30, 0x82, 0x97, 0x84,
-  0x07, 0x7c, 0x82, 0xdf, 0x10, 0xb4, 0x16, 0x1e, 0xc9, 0x99, 0x62, 0xb8,
-  0xc4, 0x00, 0x7c, 0x02, 0x59, 0x46, 0x42, 0x76, 0x32, 0x24, 0x1e, 0xa5,
-  0x08, 0x28, 0x68, 0xa1, 0xce, 0x5c, 0x28, 0xc9, 0x14, 0x8b, 0x0c, 0xd5,
-  0x6c, 0xcd, 0xb7, 0xa1, 0x5b, 0x36, 0x4e, 0x4c, 0xb9, 0x96, 0xc1, 0x44,
-  0xe9, 0x18, 0x56, 0x83, 0x08, 0x5a, 0x1c, 0x3b, 0x85, 0x3c, 0x02, 0x16,
-  0xd4, 0xcc, 0x38, 0xd6, 0x05, 0x0f, 0xc0, 0x00, 0x2e, 0x25, 0xe9, 0x30,
-  0xeb, 0x47, 0xe8, 0x59, 0x7a, 0x50, 0xb8, 0x21, 0xa9, 0xb3, 0x67, 0x41,
-  0x45, 0xb4, 0x54, 0xe8, 0x7d, 0xbb, 0xfc, 0x07, 0xd5, 0xb6, 0x0c, 0xe9,
-  0x75, 0x4c, 0xe2, 0xe4, 0x1c, 0x72, 0xb2, 0xd8, 0x0b, 0x7c, 0x89, 0x29,
-  0x7d, 0xfc, 0x0a, 0x73, 0x48, 0x5c, 0xc9, 0x0a, 0xd4, 0xc4, 0xbf, 0x28,
-  0x08, 0x35, 0xa3, 0x0a, 0x35, 0x6c, 0x0c, 0xfa, 0xb2, 0xf8, 0xcb, 0x0c,
-  0x0e, 0xa9, 0x35, 0x7a, 0x7d, 0xeb, 0xfd, 0x75, 0x20, 0xb2, 0x6a, 0x00,
-  0x36, 0x02, 0x05, 0x32, 0x04, 0x33, 0x06, 0xb8, 0x82, 0x1d, 0x3e, 0x37,
-  0x78, 0x07, 0x3b, 0x3e, 0x2f, 0xa1, 0x6a, 0x06, 0x8b, 0x9a, 0x6d, 0xa3,
-  0x05, 0x11, 0x2c, 0xb0, 0x0a, 0xe2, 0x9f, 0x1b, 0x96, 0x39, 0x55, 0x2e,
-  0xa1, 0x10, 0x35, 0xdb, 0x52, 0x12, 0x5c, 0x26, 0x14, 0x5d, 0x16, 0x35,
-  0xbd, 0x89, 0xe8, 0x00, 0x16, 0x87, 0xb6, 0x2f, 0x24, 0x3a, 0x8b, 0xf0,
-  0xd8, 0x42, 0x74, 0xab, 0xb4, 0x56, 0xdd, 0xee, 0x75, 0x31, 0x28, 0x90,
-  0x0a, 0x0d, 0xad, 0xbd, 0x40, 0xdb, 0x75, 0x57, 0x2e, 0xeb, 0x2e, 0xa3,
-  0x20, 0xde, 0x4e, 0x06, 0x22, 0x35, 0xfe, 0xe6, 0xea, 0xeb, 0x30, 0x99,
-  0x08, 0xf2, 0x3b, 0xff, 0xdb, 0x14, 0x9b, 0x20, 0x33, 0x1b, 0xdf, 0xaf,
-  0x24, 0x3d, 0x16, 0xec, 0x60, 0x31, 0x0e, 0xe9, 0xe9, 0x0d, 0x24, 0xa6,
-  0x26, 0x7c, 0xc3, 0x20, 0xe0, 0xb7, 0xaa, 0x45, 0x44, 0x05, 0xbb, 0xf9,
-  0x51, 0x53, 0x7e, 0xb2, 0x01, 0x2b, 0x6d, 0x7a, 0xcf, 0x0b, 0x24, 0x08,
-  0x94, 0x80, 0x2d, 0x86, 0x25, 0xf3, 0x2c, 0x08, 0xb3, 0x83, 0x9a, 0x18,
-  0x1a, 0x4d, 0xd3, 0x0d, 0x1c, 0x4d, 0x1e, 0x9a, 0xf1, 0x4c, 0x00, 0x19,
-  0x04, 0x58, 0x33, 0x38, 0x74, 0x22, 0x43, 0x6c, 0x96, 0x30, 0x32, 0xeb,
-  0x21, 0x34, 0x97, 0x1b, 0x36, 0x79, 0x06, 0x10, 0x78, 0xf7, 0x45, 0x56,
-  0xa1, 0xc0, 0xdb, 0x37, 0x0d, 0xc8, 0x02, 0x32, 0x01, 0x32, 0x20, 0x0c,
-  0x04, 0x8c, 0x40, 0x83, 0x05, 0x23, 0x08, 0x20, 0xc8, 0x03, 0xc8, 0x04,
-  0x32, 0x02, 0x32, 0x10, 0x0d, 0x06, 0xad, 0x6a, 0x04, 0x48, 0xc8, 0x7e,
-  0xc4, 0x1e, 0x40, 0x09, 0x02, 0x64, 0x84, 0x42, 0xb7, 0xb6, 0x0a, 0x44,
-  0x59, 0x3b, 0x54, 0xa8, 0xa3, 0x85, 0xbe, 0xd8, 0x75, 0x21, 0x19, 0x28,
-  0x37, 0xef, 0x57, 0x04, 0x60, 0x1a, 0xf2, 0x06, 0x75, 0x0b, 0xb5, 0x0d,
-  0x52, 0x14, 0x1b, 0x41, 0x10, 0x1a, 0xff, 0x9b, 0xfa, 0x55, 0x09, 0x14,
-  0xbb, 0x71, 0x4a, 0x09, 0x03, 0x6b, 0x48, 0x9b, 0x62, 0xce, 0x2c, 0xbf,
-  0x57, 0x53, 0x5b, 0x0e, 0x44, 0x48, 0x35, 0x57, 0x45, 0xd4, 0x93, 0x08,
-  0x2d, 0x2c, 0x0e, 0x56, 0x33, 0x1a, 0xd6, 0x50, 0xaf, 0xe1, 0xf4, 0x03,
-  0xe4, 0x57, 0xb2, 0xdb, 0x45, 0x04, 0x04, 0xcb, 0x7c, 0x07, 0x06, 0xf6,
-  0x7d, 0x02, 0xeb, 0x5c, 0x49, 0xee, 0x86, 0x09, 0x4e, 0xa9, 0x3a, 0x2e,
-  0x45, 0x60, 0x8e, 0xb1, 0x29, 0x05, 0xc0, 0xfa, 0x54, 0xcf, 0xbb, 0x85,
-  0xe6, 0x08, 0x03, 0x76, 0xe4, 0x08, 0x1f, 0x62, 0x84, 0x13, 0xf7, 0x8c,
-  0xda, 0x0d, 0x2b, 0xbe, 0x6d, 0x9a, 0x0c, 0xc1, 0x9c, 0x24, 0xc9, 0x9b,
-  0x62, 0xe8, 0x09, 0x51, 0x19, 0xd4, 0x3d, 0x21, 0xa3, 0x2c, 0xce, 0x78,
-  0x00, 0x7c, 0x1a, 0x35, 0x94, 0xa3, 0x08, 0xda, 0x41, 0xb6, 0xce, 0x11,
-  0x5b, 0xc8, 0x5e, 0x1e, 0xeb, 0xc2, 0x89, 0x52, 0x93, 0xc2, 0x89, 0xb8,
-  0xba, 0xb8, 0xc0, 0x20, 0x34, 0x16, 0x4a, 0x35, 0x94, 0x6e, 0x0d, 0x26,
-  0xc6, 0xa6, 0x06, 0x75, 0xad, 0xb8, 0xfe, 0xe8, 0xcd, 0x2f, 0x3c, 0xb6,
-  0xd6, 0x31, 0x05, 0x8d, 0xb6, 0x20, 0x0d, 0x10, 0x60, 0x6d, 0xc4, 0x08,
-  0x5c, 0x21, 0x37, 0xd9, 0x30, 0xe4, 0xe1, 0x67, 0xff, 0x1d, 0x9a, 0xbc,
-  0x00, 0x3d, 0x00, 0x02, 0x5a, 0xd1, 0xfb, 0x2d, 0x01, 0x12, 0x6d, 0xa0,
-  0x05, 0x13, 0xed, 0xb0, 0x4c, 0xb5, 0x73, 0xd7, 0x3e, 0x7d, 0x31, 0xd2,
-  0xe9, 0x0f, 0xd6, 0x4e, 0x08, 0x34, 0x0f, 0xbb, 0x00, 0x04, 0x12, 0xfe,
-  0xb3, 0x2a, 0xd8, 0x89, 0xe5, 0x2c, 0x5b, 0x6b, 0xda, 0xd4, 0x00, 0x9e,
-  0x22, 0x08, 0xfe, 0x26, 0xf3, 0x81, 0xfa, 0xaf, 0xf8, 0xed, 0x40, 0x89,
-  0xc2, 0x3e, 0xb0, 0x09, 0x73, 0xc7, 0x1a, 0x3c, 0x27, 0x2e, 0xd3, 0x89,
-  0xd0, 0xc2, 0x45, 0xb8, 0x0d, 0x00, 0xe6, 0xea, 0x34, 0xc9, 0x0a, 0xb3,
-  0x99, 0xe3, 0x50, 0xa3, 0x0d, 0x6a, 0xae, 0x0f, 0x0e, 0xb7, 0xbe, 0x08,
-  0xb4, 0x0b, 0x60, 0x1a, 0xee, 0x5a, 0x3d, 0x62, 0xb6, 0x02, 0x4b, 0xc3,
-  0xc2, 0x8d, 0x16, 0x31, 0xcc, 0x11, 0x02, 0x1a, 0x8a, 0x17, 0x7b, 0x19,
-  0x05, 0xb9, 0x0a, 0xa3, 0x1b, 0xb9, 0x0c, 0xa3, 0x13, 0xb9, 0x0e, 0xa3,
-  0x15, 0xaa, 0x10, 0xdb, 0xdb, 0xff, 0xd3, 0x20, 0xdb, 0x45, 0x17, 0x20,
-  0xc8, 0x19, 0xc8, 0x1b, 0xc9, 0x11, 0x4c, 0x5a, 0x98, 0x24, 0x7c, 0xc4,
-  0x87, 0x79, 0xbf, 0x03, 0x4d, 0x28, 0xc9, 0x84, 0x0b, 0x80, 0x67, 0x8f,
-  0x04, 0x17, 0x6f, 0xc9, 0xf6, 0x1b, 0x9a, 0xbd, 0x43, 0x04, 0x1a, 0x91,
-  0x0d, 0xaa, 0x44, 0x30, 0x2d, 0xef, 0x96, 0xe9, 0x64, 0x01, 0xb8, 0x6a,
-  0x0c, 0xdc, 0x26, 0xba, 0x01, 0x0b, 0xc8, 0xa6, 0x9d, 0x02, 0x8c, 0x0e,
-  0xbf, 0xd8, 0xa4, 0x03, 0x13, 0xe3, 0x52, 0x67, 0xb7, 0x0b, 0xe1, 0x00,
-  0xc8, 0xfb, 0x04, 0x7e, 0x01, 0x00, 0x34, 0x13, 0x5f, 0x9a, 0x1f, 0x00,
-  0x42, 0xb7, 0x13, 0x0c, 0x0e, 0x00, 0x94, 0x25, 0x4f, 0x0d, 0x9a, 0xba,
-  0xfe, 0x54, 0x52, 0x0c, 0x0d, 0x3d, 0x9a, 0x1c, 0xdd, 0x67, 0xeb, 0x9f,
-  0x9a, 0xb8, 0x0c, 0x32, 0x13, 0x02, 0x7b, 0xc6, 0xe0, 0x0a, 0xb1, 0x2c,
-  0x13, 0xb5, 0xc0, 0x3d, 0xcd, 0x64, 0x0d, 0xee, 0xd2, 0x9a, 0x40, 0x37,
-  0x06, 0xeb, 0xc0, 0x56, 0xb9, 0xb5, 0x91, 0x0e, 0x25, 0xd3, 0x2d, 0x42,
-  0xc6, 0x42, 0xdb, 0xf0, 0x64, 0x75, 0x10, 0x6e, 0x5c, 0xb7, 0x0e, 0x49,
-  0x52, 0xbb, 0xc4, 0x2d, 0xdc, 0x60, 0x49, 0x13, 0x3d, 0x42, 0x23, 0xdb,
-  0x0f, 0x1e, 0x50, 0xa5, 0x7e, 0x52, 0x96, 0x07, 0x12, 0x9b, 0x4b, 0xeb,
-  0x0d, 0x66, 0x0e, 0x2a, 0x4d, 0xcf, 0xb2, 0x91, 0x69, 0x2b, 0x6d, 0x7b,
-  0x4a, 0x9a, 0x74, 0x09, 0xa9, 0x48, 0x05, 0x7e, 0x83, 0xfb, 0x07, 0x77,
-  0x3d, 0x2b, 0xcd, 0xf6, 0xaa, 0x01, 0x54, 0xfb, 0xd3, 0x0e, 0xeb, 0x28,
-  0x05, 0x65, 0xfe, 0x97, 0x22, 0x2d, 0x0f, 0xcb, 0xeb, 0x1c, 0x52, 0x2c,
-  0x16, 0xb2, 0x7d, 0xcb, 0x10, 0xb6, 0x2c, 0x0a, 0xb2, 0xdb, 0xdd, 0x04,
-  0x23, 0x0f, 0x64, 0xcd, 0xad, 0x18, 0xbc, 0x2f, 0x98, 0x1b, 0x47, 0x18,
-  0xbb, 0xff, 0x59, 0x0c, 0x9a, 0x5b, 0x12, 0x2d, 0x66, 0x0f, 0x17, 0x60,
-  0x9a, 0x32, 0x63, 0xb4, 0x74, 0x76, 0x42, 0x2a, 0x10, 0xc2, 0xfe, 0x45,
-  0xbd, 0x9c, 0x00, 0x22, 0x13, 0x88, 0x09, 0xa1, 0x23, 0x97, 0x3f, 0xff,
-  0x2c, 0x01, 0x32, 0x01, 0x38, 0x01, 0x3e, 0xf0, 0x01, 0x44, 0x01, 0x4a,
-  0xbc, 0x5f, 0x01, 0x56, 0x01, 0x32, 0xb6, 0x0b, 0x4a, 0x05, 0x42, 0x39,
-  0x08, 0x6a, 0x5d, 0x21, 0xc1, 0xfd, 0x44, 0xb5, 0x9a, 0x0b, 0xb8, 0xfc,
-  0x74, 0x17, 0x33, 0x16, 0x0b, 0x29, 0x44, 0x92, 0x10, 0x40, 0x09, 0xca,
-  0xac, 0x93, 0x11, 0x7e, 0x6d, 0xc1, 0x15, 0x0f, 0x01, 0x80, 0x7e, 0xb7,
-  0xcb, 0x09, 0x7d, 0x89, 0x10, 0x87, 0x3f, 0x8b, 0x97, 0xde, 0x09, 0xe9,
-  0x8b, 0x87, 0xdc, 0xdc, 0x78, 0x25, 0x9a, 0x22, 0x67, 0x3a, 0x1f, 0xcd,
-  0x7c, 0x21, 0x25, 0xe5, 0x02, 0x0a, 0x1a, 0xf3, 0xb5, 0x67, 0x76, 0x12,
-  0x48, 0x10, 0xa1, 0xbc, 0x04, 0x02, 0x65, 0x89, 0x00, 0x16, 0x04, 0xca,
-  0xfc, 0x39, 0x49, 0x12, 0x32, 0xc5, 0x01, 0x6e, 0x93, 0x4b, 0x04, 0x87,
-  0x08, 0x43, 0x03, 0x3a, 0x03, 0x04, 0x8b, 0x6d, 0x04, 0x52, 0x2e, 0xd0,
-  0x21, 0x80, 0xc2, 0xf4, 0x3a, 0x75, 0x13, 0x25, 0x41, 0xb6, 0xac, 0x14,
-  0x1a, 0x19, 0x59, 0x85, 0x12, 0x6c, 0xb9, 0x5a, 0xda, 0x2e, 0x02, 0x15,
-  0x80, 0xb2, 0x31, 0xbe, 0xeb, 0xe9, 0xf7, 0xc7, 0x6b, 0xc6, 0x9f, 0xdd,
-  0x2a, 0x03, 0xb6, 0xd8, 0x2c, 0x1f, 0x84, 0x6d, 0x7b, 0x0c, 0x74, 0x20,
-  0x15, 0x21, 0x43, 0x90, 0xba, 0x3b, 0x7a, 0x49, 0x64, 0x35, 0x6a, 0x35,
-  0x1d, 0xba, 0x1a, 0x9c, 0x19, 0x23, 0xee, 0xc5, 0x1d, 0x39, 0xbb, 0xfd,
-  0xad, 0x04, 0x2e, 0x8b, 0x07, 0x3b, 0xaa, 0x0b, 0x5f, 0x6f, 0x43, 0x43,
-  0xe2, 0xf4, 0xe1, 0xe9, 0xc8, 0x02, 0xf2, 0x7d, 0x67, 0x14, 0xe9, 0x6e,
-  0xb6, 0xbb, 0x6b, 0x71, 0x46, 0xdc, 0xab, 0x02, 0x46, 0x09, 0x95, 0x2c,
-  0x44, 0xc7, 0xc4, 0x32, 0x82, 0xb6, 0xf7, 0x8a, 0x50, 0x92, 0x4a, 0x3f,
-  0x19, 0x95, 0xbb, 0xca, 0xe9, 0x3d, 0x49, 0x64, 0x21, 0x01, 0x96, 0x00,
-  0xbf, 0x6b, 0xdb, 0x9f, 0x29, 0x90, 0x02, 0x42, 0x27, 0xcb, 0x46, 0x1a,
-  0x65, 0x5b, 0x6f, 0x38, 0x96, 0x03, 0xa2, 0x48, 0x19, 0x44, 0x64, 0x1b,
-  0x01, 0x4b, 0xba, 0xbf, 0x97, 0x05, 0x68, 0xff, 0x64, 0x39, 0x0c, 0x4f,
-  0xb2, 0x1d, 0x01, 0xa5, 0x65, 0xbf, 0x4d, 0xcb, 0x71, 0x02, 0xe4, 0xe9,
-  0x55, 0x02, 0xad, 0xf2, 0x59, 0x02, 0xfd, 0x0e, 0xff, 0xe9, 0x37, 0x02,
-  0x85, 0x5c, 0x61, 0x6f, 0x79, 0xf8, 0xb9, 0x05, 0x64, 0x99, 0xf9, 0xf8,
-  0x74, 0x06, 0xf0, 0xeb, 0x24, 0xc3, 0x6e, 0x4c, 0x69, 0x1e, 0x52, 0x47,
-  0x39, 0x06, 0x0f, 0xba, 0x21, 0x06, 0x03, 0x59, 0x1a, 0xa5, 0x02, 0x9a,
-  0x13, 0x04, 0x50, 0xd2, 0xd0, 0x88, 0x15, 0xe0, 0x03, 0x98, 0x1b, 0x2c,
-  0x3d, 0x2d, 0x02, 0x60, 0xb6, 0x47, 0x28, 0x31, 0x84, 0xec, 0xe9, 0xc9,
-  0x01, 0xc4, 0xa6, 0x04, 0x67, 0x1c, 0x4b, 0x01, 0xac, 0xf6, 0x01, 0xe9,
-  0x90, 0x01, 0x51, 0x5c, 0xe9, 0x2b, 0xa6, 0xd1, 0x2b, 0x7c, 0xf1, 0x27,
-  0xf6, 0x7f, 0x2c, 0xe1, 0x63, 0x01, 0x30, 0x20, 0x62, 0x51, 0x26, 0x63,
-  0xb0, 0x29, 0x93, 0x04, 0x65, 0x1f, 0xb4, 0x1f, 0x2c, 0x1d, 0x08, 0xbe,
-  0xf0, 0xfd, 0xe9, 0x19, 0xdb, 0x4c, 0x16, 0x6c, 0x08, 0x67, 0x3a, 0x97,
-  0x12, 0xf6, 0x00, 0x60, 0x8c, 0x5c, 0x60, 0xff, 0xf2, 0x00, 0xe9, 0xd6,
-  0x00, 0x21, 0x5b, 0x6b, 0x06, 0x07, 0x59, 0x84, 0x76, 0xad, 0x00, 0xe2,
-  0xca, 0x9f, 0xc0, 0x2d, 0xc2, 0x76, 0xab, 0x8e, 0xe4, 0x02, 0x07, 0x74,
-  0x6f, 0x6c, 0x24, 0xa8, 0x95, 0x32, 0x4a, 0xc9, 0xac, 0x53, 0x25, 0x2c,
-  0xaf, 0x94, 0x7b, 0x75, 0x19, 0x1f, 0x03, 0x50, 0x27, 0x91, 0x7d, 0x0d,
-  0x83, 0xeb, 0xb0, 0x17, 0x18, 0x06, 0x50, 0x11, 0xee, 0x54, 0x28, 0x5d,
-  0xb4, 0xb2, 0x2e, 0xa4, 0x01, 0xfc, 0xb0, 0x12, 0xb8, 0x57, 0x13, 0xb1,
-  0x46, 0xfc, 0x0d, 0x48, 0xf0, 0x0b, 0x59, 0x26, 0x2e, 0xd1, 0x6b, 0xbf,
-  0xfe, 0x45, 0x00, 0x4e, 0x00, 0x53, 0xff, 0x00, 0x4f, 0x02, 0x58, 0x02,
-  0x5f, 0x02, 0x51, 0xc1, 0x02, 0x66, 0xd0, 0xa1, 0x41, 0xa2, 0x3f, 0xd7,
-  0x6a, 0x19, 0x73, 0x46, 0x00, 0x51, 0x7c, 0x55, 0x00, 0x58, 0x00, 0xe1,
-  0x12, 0x36, 0xff, 0xcc, 0x02, 0xec, 0x02, 0xe4, 0x00, 0x2e, 0xff, 0x01,
-  0x79, 0x03, 0x18, 0x02, 0xfa, 0x01, 0x39, 0xac, 0x03, 0xca, 0x09, 0xac,
-  0xbe, 0xcd, 0x99, 0x00, 0x02, 0xd5, 0xda, 0x29, 0xde, 0x03, 0xc0, 0xd0,
-  0xdd, 0x10, 0xcd, 0xac, 0x03, 0xd3, 0xa7, 0xe9, 0xb8, 0x58, 0xc2, 0x44,
-  0xe4, 0x66, 0x2b, 0x02, 0xe5, 0x09, 0xc8, 0x24, 0x09, 0x4c, 0x8a, 0xfc,
-  0x12, 0xe9, 0x30, 0xba, 0x2d, 0x03, 0xc8, 0x25, 0x19, 0x46, 0x0a, 0x65,
-  0x04, 0xa5, 0x3b, 0xe9, 0xc6, 0xf0, 0x02, 0x6a, 0x44, 0xd7, 0x0c, 0x66,
-  0x6e, 0x74, 0x41, 0x45, 0xa3, 0x74, 0x73, 0x61, 0x6e, 0x26, 0x81, 0xb6,
-  0xd5, 0x02, 0x4d, 0x56, 0x83, 0x31, 0x42, 0xd9, 0x14, 0xad, 0xc5, 0x6e,
-  0x33, 0xd4, 0x01, 0x42, 0x86, 0x05, 0x5d, 0xa0, 0x01, 0x85, 0x1e, 0x23,
-  0xf8, 0x52, 0x41, 0xeb, 0x81, 0x01, 0xa0, 0x0a, 0x7c, 0x66, 0x01, 0xe9,
-  0x1b, 0x95, 0x79, 0x10, 0x09, 0x20, 0x3c, 0x74, 0x2b, 0x84, 0x1c, 0xad,
-  0x90, 0x72, 0x90, 0xa3, 0x8e, 0x59, 0x51, 0x7a, 0xe9, 0x7e, 0xca, 0x80,
-  0x99, 0x28, 0x28, 0x41, 0xb2, 0x31, 0x08, 0xf7, 0x69, 0xe9, 0x1e, 0xff,
-  0x2c, 0xec, 0x83, 0xad, 0x17, 0x7f, 0x90, 0xfb, 0x86, 0x3a, 0x79, 0xf7,
-  0x64, 0xdb, 0xa3, 0x98, 0x0b, 0x19, 0xf8, 0xeb, 0xc9, 0x00, 0x84, 0x1c,
-  0x8b, 0x2b, 0x80, 0x0e, 0x94, 0x2b, 0x40, 0x07, 0x98, 0x2b, 0x20, 0x03,
-  0x9b, 0x90, 0x2b, 0x8a, 0xf5, 0x3f, 0xfc, 0x80, 0x76, 0x1f, 0xf0, 0x06,
-  0xf9, 0x42, 0xe9, 0xf8, 0x07, 0xf2, 0x06, 0x07, 0x55, 0x08, 0x94, 0x74,
-  0xff, 0xa4, 0x05, 0xb9, 0x07, 0x6d, 0x07, 0xa7, 0xff, 0x05, 0xe4, 0x05,
-  0xf9, 0x07, 0xb9, 0x06, 0x9b, 0xe8, 0x06, 0xd9, 0x07, 0x43, 0xcd, 0xd1,
-  0x9a, 0x58, 0x9c, 0x11, 0x13, 0x16, 0x98, 0x0e, 0xb2, 0x10, 0x42, 0x58,
-  0x17, 0x72, 0xb3, 0x42, 0xca, 0x38, 0x64, 0xb7, 0x84, 0x15, 0x66, 0x72,
-  0xe7, 0x02, 0x08, 0x2a, 0x95, 0xe2, 0xac, 0x02, 0x16, 0x21, 0x57, 0x20,
-  0x22, 0x99, 0xd7, 0xcd, 0x02, 0x08, 0x60, 0x5a, 0x5c, 0xd4, 0x90, 0xa1,
-  0x06, 0x54, 0x49, 0x89, 0x6a, 0xac, 0x4d, 0x58, 0x17, 0x18, 0x28, 0xc4,
-  0x7f, 0x68, 0x7a, 0x22, 0xe5, 0xa2, 0x6b, 0x09, 0x05, 0xb7, 0x04, 0x0d,
-  0x0b, 0xc8, 0x06, 0xe7, 0x08, 0x2e, 0x91, 0x0a, 0xcf, 0x0c, 0x46, 0x0e,
-  0x23, 0x10, 0x9e, 0x67, 0x12, 0x47, 0x18, 0xa1, 0x3c, 0x1a, 0x8e, 0x1c,
-  0xc2, 0x79, 0x1e, 0x1c, 0x20, 0xc9, 0xf2, 0x22, 0x39, 0x24, 0xda, 0xe4,
-  0x26, 0x73, 0x14, 0x7e, 0xca, 0x16, 0xa0, 0x41, 0x7a, 0x50, 0x38, 0x6e,
-  0x02, 0xc1, 0xa3, 0x8a, 0xfe, 0x6c, 0x6e, 0xe0, 0x24, 0x55, 0xcd, 0xf7,
-  0x0b, 0xea, 0xba, 0x10, 0x0e, 0xb5, 0x95, 0x4c, 0x2d, 0xa8, 0x56, 0xe4,
-  0x08, 0xfe, 0x8b, 0xd0, 0x58, 0x03, 0xc2, 0x03, 0xa8, 0xdf, 0xa8, 0xa3,
-  0x22, 0x69, 0x89, 0xfe, 0x16, 0x24, 0x69, 0xc7, 0x06, 0xf0, 0x22, 0xa4,
-  0x29, 0x97, 0x0c, 0xb5, 0xf3, 0x00, 0x83, 0xf0, 0x83, 0xb9, 0x3e, 0x0d,
-  0x4d, 0xc4, 0xd4, 0xba, 0x00, 0x5c, 0xf2, 0x79, 0xf4, 0xe4, 0xf6, 0x06,
-  0xf6, 0x43, 0x90, 0xf4, 0x3d, 0xf2, 0x99, 0x48, 0xa1, 0x60, 0xbb, 0x9b,
-  0x3b, 0x06, 0x6f, 0x65, 0x7c, 0x18, 0x7f, 0xed, 0x06, 0x3b, 0x16, 0x71,
-  0xd9, 0x76, 0x10, 0x13, 0xdd, 0x2b, 0x0b, 0x1b, 0x76, 0x17, 0xeb, 0x14,
-  0x8e, 0x64, 0xec, 0xba, 0x80, 0x51, 0x0f, 0x3b, 0x03, 0x1a, 0x6d, 0x13,
-  0x20, 0x05, 0x58, 0xe7, 0xb7, 0x5d, 0xf8, 0xbb, 0x2f, 0x99, 0xf7, 0xfb,
-  0x01, 0x68, 0xee, 0x8d, 0x01, 0xcd, 0x10, 0x0e, 0xfa, 0xf9, 0xff, 0x76,
-  0xf8, 0x9a, 0xa5, 0x5a, 0x14, 0xd9, 0x23, 0x56, 0x1c, 0x3c, 0x00, 0x8d,
-  0xf4, 0x51, 0xec, 0xc5, 0x23, 0x0b, 0x6d, 0x08, 0xf2, 0xae, 0x13, 0x02,
-  0x96, 0xf4, 0xf6, 0x22, 0x17, 0x4f, 0x55, 0x08, 0x14, 0x33, 0x87, 0xf2,
-  0x38, 0x0e, 0xa9, 0x85, 0x40, 0x56, 0xdf, 0xfb, 0x22, 0x50, 0xb8, 0x0f,
-  0x3c, 0x54, 0x28, 0x09, 0x5f, 0xf6, 0x33, 0x00, 0xae, 0x07, 0x30, 0xcd,
-  0x09, 0x91, 0x15, 0xa8, 0x93, 0x5d, 0x95, 0x08, 0xb8, 0x39, 0xd7, 0xfe,
-  0x0c, 0x42, 0xc4, 0xba, 0x7d, 0xb2, 0x06, 0x03, 0x7b, 0x30, 0x95, 0x82,
-  0xe1, 0xeb, 0x26, 0x9b, 0x0a, 0x60, 0xf8, 0xc6, 0xca, 0x46, 0x23, 0xc6,
-  0x5c, 0xaa, 0x83, 0x0f, 0x75, 0x7c, 0xd5, 0x4d, 0xef, 0x9a, 0xa5, 0x73,
-  0x49, 0xb6, 0x08, 0x4e, 0x5e, 0xc9, 0xa1, 0xb0, 0x6f, 0x67, 0xc6, 0x60,
-  0xdc, 0x9a, 0x18, 0x80, 0x4f, 0x4e, 0x0a, 0x4b, 0xf8, 0x83, 0xfb, 0x06,
-  0x77, 0x62, 0x07, 0xb9, 0xd8, 0xc7, 0x03, 0x21, 0x39, 0x51, 0x03, 0x76,
-  0xeb, 0x4c, 0x0c, 0x0c, 0x32, 0xf2, 0x3f, 0x0e, 0x97, 0x02, 0x69, 0x32,
-  0x06, 0xd5, 0x7b, 0x25, 0x26, 0x06, 0x13, 0x7b, 0x18, 0x19, 0x06, 0xf4,
-  0x7b, 0x0b, 0x6f, 0x07, 0xb6, 0x02, 0x3b, 0x80, 0x76, 0xee, 0xfd, 0x73,
-  0xff, 0x66, 0x03, 0x73, 0x03, 0x80, 0x03, 0x8d, 0x6f, 0x2b, 0x03, 0xa7,
-  0x03, 0xd9, 0xb4, 0x03, 0x81, 0x74, 0x76, 0x1c, 0xc3, 0xc4, 0x84, 0x5a,
-  0x29, 0x82, 0xcd, 0x42, 0x9e, 0x49, 0x4e, 0x04, 0x6b, 0x70, 0x12, 0x09,
-  0x9e, 0x29, 0x5d, 0x42, 0x73, 0x70, 0x03, 0x48, 0x4a, 0x4c, 0xba, 0xf6,
-  0x37, 0x38, 0x13, 0x04, 0x3d, 0x24, 0x84, 0x25, 0xcf, 0xdf, 0x11, 0x61,
-  0x12, 0x33, 0x95, 0x06, 0xa3, 0x6c, 0xaf, 0x3e, 0xdf, 0xeb, 0x03, 0xfe,
-  0x03, 0x11, 0xfd, 0x04, 0x24, 0x04, 0x37, 0x04, 0x4a, 0x2c, 0x24, 0x04,
-  0x23, 0x47, 0x27, 0x90, 0xfd, 0x7c, 0x0e, 0x00, 0x53, 0x0c, 0x98, 0x74,
-  0xff, 0x6c, 0x42, 0x81, 0x2f, 0x57, 0x23, 0x00, 0x9e, 0xff, 0x24, 0x3d,
-  0x00, 0x3d, 0x75, 0x77, 0x9a, 0xc2, 0xe3, 0x01, 0x70, 0x07, 0x11, 0x78,
-  0x1f, 0x23, 0x50, 0x27, 0x2e, 0x06, 0x92, 0x8c, 0x2d, 0x69, 0x9a, 0x24,
-  0x75, 0x28, 0x07, 0xdf, 0x20, 0x30, 0x9a, 0x6a, 0x05, 0xf2, 0xed, 0x0b,
-  0xb8, 0x19, 0x19, 0x15, 0x73, 0x03, 0x21, 0xc1, 0x2b, 0x51, 0x30, 0x9c,
-  0x76, 0xd9, 0x33, 0x24, 0xa4, 0x03, 0xb0, 0x0d, 0x3f, 0x36, 0x60, 0x2a,
-  0x16, 0x25, 0x57, 0xdc, 0x9a, 0x15, 0x80, 0xe5, 0x60, 0x47, 0x06, 0x2c,
-  0x54, 0xdc, 0x9a, 0x05, 0x79, 0x15, 0x20, 0x2e, 0x7b, 0x34, 0x03, 0x2c,
-  0xc6, 0x83, 0x7d, 0xb8, 0x38, 0x04, 0x60, 0x79, 0x3e, 0xb3, 0x01, 0x26,
-  0x8c, 0x8d, 0x04, 0x5f, 0x77, 0x9b, 0xba, 0x02, 0x09, 0x06, 0x6c, 0x08,
-  0xcf, 0xf3, 0x0a, 0x73, 0x0c, 0x3d, 0x03, 0x4d, 0x0e, 0x10, 0x9e, 0x53,
-  0x12, 0x6e, 0x18, 0x85, 0x04, 0x69, 0x1a, 0xb3, 0x1c, 0x9b, 0xcd, 0x1e,
-  0x20, 0xcd, 0x36, 0x05, 0x22, 0x36, 0x24, 0x53, 0x7b, 0x26, 0x31, 0xb3,
-  0x14, 0xd5, 0xc6, 0x16, 0xf6, 0x0d, 0x26, 0x17, 0xbf, 0x44, 0xc6, 0xc0,
-  0xd7, 0x91, 0x21, 0xf4, 0xc4, 0x9f, 0xe0, 0x10, 0x37, 0xc4, 0x2d, 0x75,
-  0x17, 0xdd, 0xb8, 0x23, 0xe1, 0xc4, 0x8f, 0xff, 0xdf, 0xc4, 0xda, 0x50,
-  0x48, 0xde, 0x3b, 0xeb, 0x46, 0xe6, 0x5d, 0x16, 0x20, 0x90, 0x00, 0xb4,
-  0x48, 0x05, 0x3b, 0xe2, 0x10, 0x03, 0x5a, 0x3f, 0x8c, 0x5c, 0x1b, 0x50,
-  0x15, 0x0b, 0x76, 0x30, 0xdb, 0x50, 0x02, 0x10, 0x47, 0x42, 0x00, 0x6c,
-  0x43, 0x44, 0x42, 0xff, 0xd2, 0x03, 0x90, 0x0e, 0x4c, 0x02, 0x7f, 0x0c,
-  0x80, 0xbc, 0x30, 0x82, 0x11, 0x05, 0x75, 0x63, 0x23, 0x0c, 0x67, 0x1e,
-  0x8a, 0xb6, 0x84, 0x12, 0x98, 0xe4, 0x08, 0xb9, 0xb4, 0xbe, 0x05, 0x11,
-  0x12, 0x8d, 0x1a, 0x5c, 0xe8, 0x6f, 0x11, 0x8a, 0x6d, 0x66, 0xb8, 0x0b,
-  0xd7, 0x48, 0x25, 0x03, 0x4c, 0x02, 0xfc, 0x2c, 0xd4, 0x01, 0xf4, 0x10,
-  0x4b, 0xa8, 0x14, 0x7b, 0x60, 0x26, 0x04, 0x01, 0xa9, 0x36, 0x5b, 0x51,
-  0x23, 0xa0, 0x0a, 0xc4, 0x7c, 0xe7, 0x12, 0xe6, 0x07, 0x8b, 0xfb, 0x36,
-  0xde, 0x10, 0xb8, 0x0d, 0x45, 0xa6, 0x28, 0x90, 0x01, 0x69, 0x04, 0xbb,
-  0x91, 0x3b, 0xb0, 0x59, 0xa6, 0x0e, 0x9b, 0x05, 0x0b, 0x06, 0x38, 0x5f,
-  0xbf, 0xd7, 0x00, 0x5f, 0x07, 0x6f, 0x4e, 0x75, 0xff, 0x9a, 0x84, 0x0d,
-  0xeb, 0x7e, 0x75, 0xf7, 0xe9, 0x92, 0x01, 0xb7, 0x7b, 0xc8, 0x12, 0x25,
-  0x21, 0x0c, 0x0f, 0x0a, 0x11, 0x10, 0x2d, 0x85, 0x11, 0x91, 0x1d, 0xb3,
-  0x99, 0x7b, 0x34, 0x9d, 0xf1, 0x65, 0xfe, 0x1d, 0x1a, 0x01, 0x70, 0x5a,
-  0x23, 0x56, 0x47, 0x40, 0x71, 0xf4, 0x81, 0x7e, 0xbd, 0xf8, 0x02, 0x74,
-  0xed, 0x85, 0xc3, 0xde, 0x3f, 0x25, 0x06, 0x7b, 0x52, 0x47, 0xf2, 0xfc,
-  0xb9, 0x21, 0xe4, 0x0a, 0x03, 0x64, 0xfc, 0x1c, 0xef, 0x00, 0xd4, 0x42,
-  0x75, 0xda, 0x89, 0xde, 0xd2, 0x46, 0xe9, 0xe0, 0x00, 0xc1, 0x0a, 0xc2,
-  0xeb, 0x00, 0x0d, 0xea, 0xe9, 0xd2, 0xd5, 0x17, 0x2f, 0x79, 0xe9, 0xcc,
-  0x00, 0x55, 0x2d, 0xeb, 0x05, 0xdc, 0x09, 0xeb, 0x01, 0x4e, 0x21, 0xfd,
-  0x63, 0xb2, 0xa2, 0xaf, 0xde, 0x0e, 0xe9, 0xab, 0x00, 0x21, 0x5b, 0x76,
-  0x75, 0x04, 0x30, 0xb6, 0x20, 0x46, 0x4a, 0x6d, 0x8e, 0x36, 0xab, 0xa8,
-  0x5d, 0xb1, 0xe9, 0x83, 0x43, 0xa6, 0xf6, 0x7e, 0xbe, 0x04, 0x04, 0xf2,
-  0x79, 0xbe, 0x06, 0xf2, 0x74, 0xbe, 0x07, 0xdf, 0x6f, 0x55, 0x6a, 0xd2,
-  0xbe, 0x0a, 0x2d, 0xf2, 0x65, 0xb8, 0x01, 0x4b, 0xf2, 0x66, 0x44, 0xe7,
-  0xa9, 0x00, 0x70, 0x0d, 0x2c, 0x4c, 0x7e, 0x90, 0xb8, 0x0c, 0xe9, 0x1f,
-  0x27, 0xa6, 0x03, 0x90, 0x04, 0x97, 0x79, 0xd6, 0x25, 0xff, 0xa6, 0x60,
-  0xaa, 0x05, 0xd8, 0x8e, 0xf0, 0xc3, 0xa1, 0x93, 0xdc, 0xdc, 0x05, 0xa1,
-  0xcd, 0xae, 0x23, 0xda, 0x48, 0xa3, 0x07, 0xe7, 0xdc, 0x1d, 0x85, 0x5a,
-  0xc4, 0x3a, 0x11, 0x6e, 0xa9, 0x9b, 0x0c, 0x2f, 0xe4, 0x41, 0xbf, 0x15,
-  0xef, 0x09, 0x59, 0x9a, 0x3d, 0x72, 0x0e, 0xd0, 0xfc, 0x76, 0xf3, 0x67,
-  0xfe, 0x04, 0x89, 0x05, 0xa2, 0x36, 0xcc, 0xf9, 0x2f, 0xb6, 0x1b, 0x00,
-  0x20, 0x00, 0xe2, 0x60, 0xfe, 0xe9, 0x4d, 0x00, 0x4f, 0x2e, 0xe7, 0xff,
-  0x61, 0x00, 0x62, 0x00, 0x64, 0x00, 0x66, 0x00, 0xfe, 0x6d, 0x00, 0x6f,
-  0x00, 0x78, 0x00, 0x01, 0xd9, 0x00, 0x02, 0x74, 0x00, 0x18, 0x6b, 0x0d,
-  0x28, 0x82, 0x67, 0xa9, 0x08, 0x7f, 0x30, 0x00, 0x32, 0x00, 0x47, 0x00,
-  0x42, 0x3e, 0xdc, 0x49, 0x2c, 0xdf, 0xd7, 0x51, 0xe9, 0x01, 0xf4, 0xb7,
-  0x01, 0x03, 0x62, 0x02, 0xe0, 0x48, 0x02, 0x4e, 0x17, 0xb2, 0x5d, 0x02,
-  0xf6, 0x53, 0x02, 0x67, 0x02, 0x0d, 0x16, 0xde, 0x1f, 0x6c, 0x02, 0x6c,
-  0xeb, 0x09, 0x62, 0x13, 0xdd, 0x0f, 0x48, 0x77, 0x17, 0xfd, 0x01, 0x08,
-  0x73, 0x03, 0x57, 0x6e, 0x29, 0x5b, 0x14, 0x23, 0x45, 0x01, 0x42, 0x34,
-  0xe1, 0x35, 0x1e, 0x01, 0x61, 0x08, 0x0d, 0xa4, 0x22, 0xdc, 0xae, 0x83,
-  0xa9, 0x69, 0x13, 0x6a, 0xe3, 0xc6, 0xcb, 0x7c, 0x2f, 0x00, 0x41, 0x09,
-  0xce, 0x0b, 0xf5, 0x16, 0x50, 0xb9, 0x39, 0xba, 0xdd, 0xe6, 0x3a, 0x0d,
-  0x81, 0xbd, 0xeb, 0x32, 0x8b, 0x2a, 0x35, 0x66, 0x45, 0xb9, 0x09, 0x03,
-  0xaf, 0xff, 0x31, 0x97, 0x8c, 0x32, 0x00, 0x9a, 0x39, 0x0e, 0xe6, 0x0b,
-  0x31, 0x03, 0x24, 0xba, 0x36, 0x64, 0x0a, 0x69, 0x07, 0x01, 0x9e, 0xba,
-  0x86, 0x25, 0x67, 0x65, 0x65, 0xb9, 0x0c, 0x80, 0x34, 0xcf, 0x5d, 0x0c,
-  0x24, 0x32, 0xf8, 0x32, 0x18, 0x07, 0x18, 0x20, 0x72, 0x96, 0x1c, 0x15,
-  0x80, 0xc8, 0x12, 0xe5, 0xde, 0xfe, 0xe7, 0xe3, 0x00, 0xd7, 0x7b, 0x0c,
-  0xd0, 0x01, 0xc8, 0xcf, 0x36, 0x5c, 0x10, 0x87, 0x86, 0xd9, 0xa4, 0xfe,
-  0xd1, 0x6e, 0x0c, 0x60, 0x33, 0x39, 0x08, 0x37, 0x43, 0xda, 0xa4, 0x73,
-  0xec, 0x23, 0xa6, 0xd8, 0x6d, 0xef, 0xbe, 0x22, 0x39, 0x9b, 0x6a, 0x43,
-  0x04, 0xca, 0xe1, 0x08, 0xc5, 0x0c, 0x96, 0x39, 0xb0, 0x43, 0x57, 0x36,
-  0x8c, 0x35, 0xd0, 0xba, 0x1e, 0x34, 0x13, 0x21, 0x31, 0x52, 0x5b, 0xea,
-  0x6b, 0xfe, 0x16, 0x77, 0x13, 0x35, 0x54, 0x2e, 0xca, 0x06, 0x14, 0x4a,
-  0x5b, 0x14, 0x33, 0x20, 0x1d, 0x1e, 0xa2, 0xda, 0xe8, 0x88, 0x49, 0xdb,
-  0x72, 0x59, 0x0b, 0x3c, 0xd3, 0x02, 0xed, 0x06, 0x94, 0x08, 0x62, 0x84,
-  0xf0, 0x6b, 0xcb, 0xe8, 0x9c, 0x77, 0xb8, 0x42, 0xb0, 0x04, 0x4a, 0x6b,
-  0x22, 0x4d, 0x37, 0x4b, 0x85, 0xe9, 0xc9, 0x6b, 0x14, 0x07, 0x7b, 0x7b,
-  0x33, 0x2b, 0x30, 0xb3, 0xea, 0x36, 0x4d, 0x08, 0x0e, 0x24, 0x4d, 0xb4,
-  0xf2, 0x32, 0x09, 0x6d, 0x63, 0x9f, 0x85, 0x7b, 0x14, 0x09, 0xe8, 0x17,
-  0xed, 0x61, 0x32, 0xd8, 0x10, 0x99, 0x1e, 0x7d, 0x14, 0x12, 0xe9, 0x2f,
-  0x26, 0x38, 0x18, 0x53, 0x36, 0x0f, 0x93, 0x6c, 0x6b, 0x0f, 0xde, 0xfe,
-  0x26, 0x12, 0xea, 0xbb, 0x5f, 0x35, 0x36, 0x6b, 0x43, 0x99, 0x63, 0x35,
-  0xa4, 0x20, 0x72, 0xa4, 0x07, 0x98, 0x3d, 0x0b, 0x9b, 0x2d, 0x35, 0x2e,
-  0xba, 0x46, 0x6a, 0x40, 0xe4, 0x6a, 0x0e, 0xd1, 0x79, 0x0c, 0x23, 0x91,
-  0xd1, 0x90, 0x30, 0x39, 0x30, 0x03, 0xcd, 0x0a, 0x39, 0x0d, 0x24, 0x79,
-  0x06, 0x15, 0xf2, 0xf6, 0xfd, 0x03, 0xf6, 0x90, 0xfd, 0x19, 0x43, 0xe4,
-  0x0e, 0x8e, 0x30, 0x46, 0xbc, 0x40, 0xe4, 0xbc, 0x0e, 0x7c, 0x70, 0xec,
-  0xa8, 0x32, 0xb9, 0x53, 0x19, 0x82, 0x03, 0x90, 0x82, 0x3c, 0xb5, 0x39,
-  0x61, 0xf7, 0xc8, 0x11, 0x13, 0x48, 0x90, 0xfd, 0x1c, 0x48, 0xfd, 0x95,
-  0xc9, 0x0a, 0x79, 0x68, 0x14, 0x1c, 0x5c, 0xfd, 0xb9, 0x68, 0x14, 0xf2,
-  0x7b, 0x15, 0x00, 0xe4, 0xa8, 0x15, 0x01, 0xc9, 0x52, 0x14, 0x79, 0x52,
-  0x14, 0x0a, 0x7d, 0x2c, 0x03, 0xb8, 0xee, 0xf5, 0xe3, 0x04, 0xd2, 0x11,
-  0x1a, 0x03, 0xf4, 0x8c, 0x16, 0xf6, 0x83, 0xdd, 0x27, 0x3a, 0x32, 0x05,
-  0x24, 0x39, 0x13, 0x17, 0xe4, 0x8c, 0x06, 0x8c, 0x40, 0x67, 0x60, 0x92,
-  0x07, 0x1c, 0xca, 0x15, 0x61, 0xf8, 0xf2, 0x54, 0x00, 0x2f, 0x00, 0xdf,
-  0x99, 0x34, 0x0e, 0x24, 0x32, 0xd2, 0x32, 0x18, 0x07, 0x18, 0x20, 0x43,
-  0xde, 0x93, 0xfe, 0x19, 0xf6, 0x5d, 0xd2, 0xf3, 0x34, 0x08, 0x48, 0x1c,
-  0x0e, 0xda, 0x15, 0x30, 0xf5, 0xf9, 0x4a, 0x02, 0xf8, 0x00, 0x77, 0x0b,
-  0x3b, 0x34, 0x49, 0x09, 0x0c, 0xf0, 0x8c, 0x6a, 0x81, 0xc8, 0x6a, 0x1c,
-  0x44, 0xf2, 0x0a, 0x43, 0x06, 0x9e, 0x16, 0x30, 0x40, 0xe4, 0x30, 0x0e,
-  0x7d, 0x79, 0x0b, 0x21, 0x91, 0x1c, 0xc9, 0xf6, 0xfd, 0x8c, 0xf2, 0xae,
-  0xb6, 0xf9, 0x34, 0x0c, 0x21, 0x91, 0x32, 0x90, 0xbc, 0x39, 0xbc, 0x03,
-  0x9e, 0xef, 0x0f, 0x48, 0x64, 0x48, 0x64, 0x82, 0x0e, 0x82, 0x40, 0xf3,
-  0x28, 0x3c, 0x49, 0x10, 0x0c, 0x5e, 0x8c, 0x48, 0x81, 0xc8, 0x48, 0x1c,
-  0x61, 0xce, 0x28, 0x16, 0x82, 0x77, 0x13, 0x3c, 0xa4, 0x2b, 0xa6, 0x0e,
-  0x40, 0xec, 0x0e, 0x71, 0x0e, 0x9a, 0x77, 0x38, 0x3d, 0x2d, 0x8d, 0x3c,
-  0x29, 0x20, 0x68, 0x32, 0xc6, 0x39, 0xd4, 0xfc, 0x01, 0xc9, 0xd4, 0xfc,
-  0x4a, 0xae, 0xa8, 0x0e, 0xbd, 0x90, 0x6c, 0xf2, 0x8a, 0x16, 0x39, 0xe7,
-  0xfc, 0x73, 0x8a, 0x16, 0xe9, 0x25, 0x17, 0x57, 0x00, 0xd9, 0x14, 0x5e,
-  0x9a, 0x59, 0x21, 0xb4, 0x70, 0xba, 0x16, 0x4d, 0x96, 0xd8, 0xf6, 0xc7,
-  0x87, 0xde, 0x15, 0x3b, 0xec, 0x9a, 0x61, 0x11, 0x0e, 0x4c, 0xc7, 0x4d,
-  0x74, 0x16, 0x49, 0x90, 0x79, 0x74, 0x16, 0x0f, 0x8b, 0xf8, 0x48, 0x92,
-  0xfd, 0x83, 0xff, 0x0c, 0x74, 0x05, 0x00, 0x32, 0x28, 0x1e, 0x5c, 0x03,
-  0x86, 0xc0, 0x14, 0xf8, 0xd3, 0xeb, 0x2f, 0x2e, 0x55, 0x67, 0x58, 0x83,
-  0x95, 0xbf, 0x4b, 0x7e, 0x1b, 0x57, 0x85, 0x5a, 0x8a, 0x13, 0x08, 0x95,
-  0x28, 0x96, 0x19, 0xf7, 0x72, 0x2b, 0x75, 0x09, 0xff, 0x46, 0x17, 0xac,
-  0x76, 0x05, 0x7c, 0xcb, 0x3b, 0x72, 0x30, 0x07, 0x4c, 0x96, 0x16, 0x1c,
-  0x43, 0xd8, 0x47, 0x01, 0x3c, 0x1e, 0x4c, 0x16, 0x4b, 0xeb, 0x02, 0x7c,
-  0xca, 0x1c, 0x14, 0x21, 0x87, 0xac, 0x22, 0x74, 0x92, 0x06, 0x53, 0x5c,
-  0xb7, 0x9f, 0xbe, 0x08, 0x51, 0xde, 0xa6, 0xf6, 0xb8, 0xd4, 0x3c, 0xba,
-  0x30, 0x03, 0x69, 0x26, 0x01, 0xc9, 0x3c, 0x19, 0x07, 0x0d, 0xba, 0x3d,
-  0x32, 0x05, 0x4b, 0xad, 0x56, 0x2e, 0xc9, 0x5c, 0x19, 0x07, 0x46, 0x7c,
-  0x30, 0x07, 0x84, 0xe2, 0x76, 0x19, 0x48, 0x25, 0xbb, 0x7f, 0x32, 0xe4,
-  0x09, 0x27, 0x8c, 0x19, 0x12, 0x22, 0x45, 0xdf, 0xb8, 0x32, 0x0b, 0x21,
-  0x38, 0xa8, 0x19, 0x92, 0x1f, 0x2e, 0xf1, 0xf9, 0x32, 0x0d, 0x09, 0xc4,
-  0xca, 0x19, 0x91, 0x1c, 0x78, 0x2a, 0x3e, 0x69, 0x2f, 0x0f, 0x21, 0xc4,
-  0xef, 0x19, 0x91, 0x1b, 0x77, 0x63, 0x34, 0xc9, 0x11, 0x0e, 0x0b, 0x1a,
-  0x24, 0x1a, 0x8b, 0xbe, 0x9c, 0x34, 0x13, 0x48, 0x71, 0x33, 0x1a, 0x24,
-  0x19, 0x48, 0x75, 0xdb, 0x35, 0x87, 0xca, 0x1b, 0xe9, 0xd5, 0x7d, 0x3d,
-  0x03, 0x74, 0x2f, 0x06, 0x80, 0xe4, 0x2e, 0x18, 0x8b, 0xde, 0x0e, 0x3f,
-  0xa7, 0xc8, 0x34, 0x75, 0x44, 0x18, 0x91, 0x2f, 0x77, 0x47, 0x34, 0xc9,
-  0x13, 0x0e, 0x5a, 0x18, 0xb2, 0x2f, 0x2e, 0x80, 0xf9, 0x34, 0x05, 0x2e,
-  0x56, 0xe6, 0x32, 0xda, 0x32, 0x0e, 0x5a, 0xc8, 0x25, 0x6f, 0xb9, 0x32,
-  0x90, 0x07, 0x99, 0x70, 0x1c, 0xd4, 0xfc, 0x80, 0xe4, 0xd4, 0xfc, 0x06,
-  0xf2, 0x79, 0x09, 0x09, 0x91, 0x8a, 0x90, 0x9a, 0x39, 0x9a, 0x03, 0xcd,
-  0x2b, 0x40, 0x0b, 0x21, 0x32, 0x9a, 0x32, 0x60, 0x07, 0x60, 0x20, 0x73,
-  0x64, 0xc8, 0x0d, 0x4c, 0xb0, 0x8c, 0x26, 0x81, 0xc8, 0x26, 0x1c, 0x9d,
-  0xf2, 0x0f, 0x13, 0xcb, 0x23, 0xec, 0x92, 0xfb, 0xdd, 0x0c, 0xe9, 0x84,
-  0xc7, 0xc9, 0x21, 0xcf, 0x68, 0x17, 0xb2, 0x90, 0xfb, 0x1c, 0xb2, 0xfb,
-  0x91, 0x84, 0x5f, 0x2e, 0x7e, 0xc6, 0x32, 0x78, 0x40, 0xe4, 0x78, 0x0e,
-  0x47, 0x12, 0x5f, 0xbb, 0x94, 0x32, 0x19, 0x3e, 0x03, 0x90, 0x3e, 0x38,
-  0x80, 0x4a, 0x5f, 0xec, 0xaa, 0x32, 0x64, 0x04, 0x0e, 0x04, 0x40, 0xe7,
-  0xb9, 0x90, 0x0b, 0x99, 0xc0, 0x1c, 0xca, 0xfa, 0x96, 0xe0, 0x0c, 0x91,
-  0xc5, 0xd8, 0x0d, 0x32, 0x4c, 0xd6, 0x8c, 0x90, 0x81, 0xc8, 0x90, 0x1c,
-  0x2b, 0x25, 0x5f, 0x76, 0xec, 0x32, 0x32, 0x56, 0x5b, 0x0c, 0xc2, 0xc5,
-  0x46, 0x32, 0xfb, 0x3d, 0x02, 0x18, 0xf2, 0x34, 0x1c, 0x5b, 0x0c, 0xc2,
-  0xc7, 0x46, 0x32, 0xfb, 0x3c, 0x18, 0x18, 0x4f, 0x2b, 0xe2, 0x90, 0xf9,
-  0x1c, 0xe2, 0xf9, 0x80, 0xe4, 0xd6, 0x40, 0x06, 0x15, 0x40, 0x9c, 0xa8,
-  0xf9, 0x96, 0xe1, 0x0c, 0x20, 0x2b, 0x39, 0x0f, 0x41, 0x01, 0x90, 0x15,
-  0x26, 0x6e, 0xc0, 0x3c, 0xe4, 0x6e, 0x06, 0x5e, 0x24, 0x2c, 0x0e, 0x08,
-  0x43, 0x00, 0x5f, 0x5b, 0xe1, 0xc4, 0xf9, 0x59, 0xb9, 0x23, 0xdb, 0x1a,
-  0x00, 0x72, 0x08, 0x1b, 0x52, 0x0d, 0x41, 0x96, 0x0a, 0x2f, 0x0a, 0x75,
-  0x09, 0x4e, 0xe8, 0x20, 0xdc, 0xef, 0x0f, 0x3d, 0x6b, 0x06, 0x09, 0x71,
-  0xeb, 0x12, 0x2e, 0x6e, 0x32, 0x18, 0x29, 0xc0, 0x7b, 0x24, 0xeb, 0x08,
-  0x09, 0x67, 0x5e, 0xb6, 0x1a, 0x07, 0x48, 0x7b, 0x12, 0x2e, 0xc4, 0x97,
-  0x46, 0x6c, 0x9f, 0x17, 0x70, 0x18, 0x25, 0xe4, 0x70, 0x18, 0x31, 0x0a,
-  0x91, 0x24, 0x47, 0xc1, 0xbd, 0xc3, 0x13, 0x74, 0x06, 0xc2, 0x05, 0x79,
-  0x49, 0xff, 0x65, 0xbf, 0x66, 0x79, 0x25, 0xde, 0x6a, 0x64, 0xad, 0x56,
-  0x41, 0x18, 0xbe, 0x2d, 0x0e, 0x92, 0x48, 0xe6, 0x07, 0x9a, 0x5e, 0x2a,
-  0x8b, 0x5c, 0x07, 0xeb, 0x20, 0x13, 0x85, 0x28, 0x51, 0xba, 0x24, 0x3e,
-  0xb5, 0x7a, 0xb3, 0x1d, 0x06, 0xe2, 0x89, 0x37, 0x37, 0x9e, 0x09, 0x7c,
-  0xba, 0xe4, 0x1f, 0x10, 0x49, 0x7b, 0x9a, 0x52, 0x58, 0x18, 0xc9, 0xeb,
-  0x0e, 0x32, 0x18, 0x46, 0x03, 0x51, 0x27, 0x57, 0xc7, 0x20, 0x34, 0xe8,
-  0x6e, 0x40, 0x48, 0x41, 0x40, 0x1c, 0xb7, 0x1b, 0x49, 0x49, 0x07, 0x81,
-  0x7a, 0x32, 0x71, 0xda, 0xf5, 0x09, 0x0b, 0x74, 0x94, 0x1b, 0xfb, 0x6c,
-  0x1b, 0x04, 0xa7, 0x50, 0xbc, 0x48, 0x3d, 0x4f, 0x56, 0x59, 0xe5, 0x02,
-  0xc9, 0x0a, 0x90, 0x18, 0xbc, 0xba, 0x41, 0x60, 0x47, 0x33, 0x0c, 0x49,
-  0x2c, 0x4e, 0x52, 0xff, 0x4b, 0x12, 0x60, 0x17, 0xf3, 0x66, 0x3c, 0xf1,
-  0x3b, 0x4e, 0x15, 0xc8, 0x3e, 0x64, 0xc6, 0x64, 0x18, 0x0e, 0x18, 0x40,
-  0x44, 0x06, 0xbc, 0x48, 0xa6, 0xd2, 0x7a, 0x35, 0x10, 0x78, 0xf3, 0xa6,
-  0x1b, 0x05, 0xf3, 0xca, 0xa6, 0x1b, 0x37, 0x55, 0xe3, 0xfe, 0x10, 0x3f,
-  0x92, 0x88, 0x46, 0xfb, 0x6e, 0x51, 0x2c, 0x42, 0xaa, 0xc1, 0x4e, 0x14,
-  0xa1, 0x4d, 0x59, 0xbb, 0x0e, 0x8a, 0x84, 0x12, 0x6d, 0x3a, 0x19, 0x04,
-  0x0b, 0x40, 0xfe, 0xd5, 0xeb, 0x06, 0x2f, 0x41, 0xfc, 0x7c, 0xed, 0x10,
-  0x2d, 0x06, 0x26, 0x10, 0x73, 0x77, 0xfc, 0x54, 0x4b, 0x6d, 0x7d, 0xb3,
-  0x0b, 0x0a, 0xe0, 0xa3, 0x52, 0x1b, 0x05, 0x5c, 0xb5, 0x06, 0x05, 0xad,
-  0x12, 0x10, 0xfb, 0x05, 0xfb, 0xff, 0xa3, 0x50, 0x0f, 0x67, 0x0c, 0x6b,
-  0x4b, 0x05, 0x66, 0x50, 0x1b, 0x47, 0x32, 0x92, 0x1b, 0xf2, 0x32, 0x1b,
-  0x46, 0x11, 0xad, 0x1d, 0x4c, 0x02, 0x23, 0x01, 0xed, 0x75, 0x0e, 0x8b,
-  0xfa, 0xed, 0x1b, 0x03, 0x1e, 0x40, 0xdb, 0x8a, 0x87, 0x81, 0xeb, 0x01,
-  0x0a, 0xb4, 0x10, 0xc7, 0x1a, 0x80, 0xa9, 0x69, 0x45, 0x52, 0xc4, 0x06,
-  0x2a, 0x3f, 0xeb, 0x0a, 0x48, 0xc7, 0xba, 0x0c, 0x04, 0x42, 0x05, 0xa2,
-  0x88, 0x2d, 0x43, 0x6e, 0x42, 0x7e, 0x02, 0xa0, 0xea, 0xfa, 0xfe, 0x01,
-  0xa7, 0x5d, 0xca, 0xbb, 0xa8, 0x02, 0x6d, 0x49, 0xba, 0x28, 0x15, 0xaa,
-  0x63, 0x1f, 0x36, 0x1c, 0x8b, 0xa2, 0x56, 0x8d, 0xba, 0xfa, 0x06, 0x1c,
-  0xa3, 0x08, 0x1c, 0x2d, 0xa1, 0xed, 0xa3, 0xfa, 0x1b, 0x05, 0xe6, 0xfc,
-  0xa3, 0xfe, 0xf2, 0x12, 0xa3, 0x02, 0x1c, 0xf3, 0x10, 0xa3, 0x04, 0x7e,
-  0x0a, 0x40, 0xa3, 0x0e, 0x1c, 0x39, 0xeb, 0x49, 0x07, 0x23, 0xbd, 0x40,
-  0x40, 0xeb, 0x19, 0xac, 0xd9, 0x47, 0xd4, 0x5c, 0xd0, 0xeb, 0x06, 0x5a,
-  0x4c, 0x5d, 0x18, 0x03, 0xb5, 0xc2, 0x1a, 0x16, 0xe2, 0x8d, 0x06, 0x81,
-  0x42, 0x33, 0x35, 0x0a, 0xa1, 0xda, 0x02, 0x12, 0x02, 0xf7, 0x83, 0xa1,
-  0x8e, 0x58, 0x90, 0xba, 0x18, 0xba, 0x40, 0x9e, 0x58, 0x96, 0x6d, 0x8b,
-  0x6b, 0x44, 0x49, 0x77, 0xc7, 0x52, 0x52, 0xbe, 0x9f, 0xf6, 0x1a, 0x78,
-  0x7b, 0xab, 0xff, 0x06, 0x0c, 0x61, 0x47, 0x74, 0x8a, 0x44, 0xf6, 0x04,
-  0x77, 0xe3, 0xd4, 0x1b, 0x89, 0xec, 0x87, 0xd6, 0x1b, 0x0f, 0x36, 0x47,
-  0xdb, 0x18, 0x0e, 0xd8, 0xa6, 0x1b, 0x03, 0xbf, 0x39, 0xfe, 0x81, 0x42,
-  0x19, 0x70, 0xb6, 0x8c, 0x0d, 0x7b, 0xf6, 0x02, 0x65, 0x16, 0xde, 0x14,
-  0x1e, 0x4f, 0xfc, 0x01, 0x05, 0xd2, 0x63, 0xae, 0x80, 0x19, 0x33, 0x6d,
-  0x0b, 0x16, 0x9a, 0x03, 0x46, 0xc3, 0xf6, 0x0c, 0xe5, 0x70, 0x0a, 0x7c,
-  0x80, 0xb2, 0xaf, 0xfa, 0x03, 0xfa, 0x20, 0x32, 0xf4, 0x2a, 0x94, 0x17,
-  0x44, 0x20, 0x92, 0x2a, 0x3d, 0x02, 0xbb, 0x27, 0x10, 0x1c, 0x4a, 0x64,
-  0x04, 0xd1, 0x6c, 0x67, 0x1c, 0x6c, 0xae, 0x0f, 0x92, 0x90, 0x6d, 0x58,
-  0x28, 0x8f, 0xd0, 0x04, 0x08, 0xa3, 0x3a, 0x2c, 0xfe, 0x60, 0x33, 0x45,
-  0x85, 0xf1, 0xb6, 0x48, 0x14, 0x69, 0x08, 0x0e, 0x30, 0x42, 0xe9, 0x02,
-  0x8b, 0x36, 0x29, 0x28, 0xb3, 0x41, 0x7e, 0x48, 0xe3, 0xfd, 0x4b, 0x6c,
-  0x33, 0x3a, 0x85, 0xde, 0x04, 0x06, 0x0a, 0x32, 0x07, 0x9b, 0xaf, 0x33,
-  0xd8, 0x31, 0x8c, 0x51, 0x84, 0x70, 0x36, 0xd1, 0x45, 0x80, 0x35, 0xeb,
-  0x8b, 0xf2, 0x2d, 0x25, 0xee, 0xd6, 0x4e, 0x80, 0x57, 0xee, 0x52, 0x56,
-  0x9a, 0x45, 0x89, 0x00, 0xec, 0x10, 0x1d, 0x16, 0x43, 0x69, 0xe7, 0xc2,
-  0x6f, 0x8d, 0x16, 0x44, 0x86, 0xc9, 0x15, 0x29, 0x60, 0x81, 0xfc, 0x5c,
-  0x01, 0xb8, 0x9e, 0x43, 0xd3, 0x08, 0x48, 0x19, 0x0e, 0xeb, 0x1c, 0x48,
-  0x3b, 0xd7, 0x32, 0xe4, 0x0a, 0x86, 0x84, 0x46, 0x8c, 0x09, 0x5e, 0xd4,
-  0x95, 0xcd, 0xf5, 0x10, 0x44, 0x1e, 0x92, 0xac, 0xc9, 0x32, 0xd6, 0x42,
-  0x1c, 0x6e, 0x18, 0x3d, 0xf3, 0x49, 0xcf, 0x5d, 0x49, 0xf2, 0x34, 0x0c,
-  0x43, 0x58, 0x23, 0x18, 0x20, 0x72, 0x18, 0x07, 0x82, 0x3c, 0x0d, 0x90,
-  0xea, 0x6e, 0x1c, 0x43, 0xd3, 0x7a, 0x34, 0x92, 0xd3, 0xbc, 0xbb, 0x44,
-  0x09, 0x15, 0x62, 0xb0, 0xad, 0x2d, 0x4e, 0xdd, 0x03, 0x4c, 0x0f, 0xa4,
-  0xfe, 0x20, 0x1a, 0xdc, 0xc9, 0xa2, 0x1c, 0x57, 0xa7, 0xcb, 0xa1, 0xa2,
-  0x9b, 0x1c, 0x0a, 0x1d, 0x25, 0x76, 0x37, 0x14, 0x01, 0xe3, 0x8c, 0x1c,
-  0xdf, 0x2f, 0x8c, 0x1c, 0x25, 0x80, 0x7c, 0xd3, 0x75, 0xeb, 0x62, 0xe5,
-  0x0e, 0x95, 0x90, 0x22, 0x15, 0xa2, 0x37, 0x01, 0xde, 0x40, 0xa0, 0x09,
-  0xc0, 0x6e, 0x72, 0x46, 0x1c, 0x0d, 0xd9, 0xb3, 0x80, 0x5c, 0x03, 0x6f,
-  0x09, 0x85, 0xae, 0x87, 0x90, 0xf4, 0xe1, 0x17, 0xed, 0x01, 0xc9, 0x9a,
-  0x1d, 0x07, 0x2d, 0xa0, 0x45, 0x40, 0xc6, 0x64, 0x19, 0xbb, 0x4e, 0x37,
-  0x18, 0x8c, 0x4b, 0x17, 0x08, 0xf2, 0x4d, 0x66, 0x84, 0x37, 0xc1, 0x2a,
-  0x80, 0x66, 0xe4, 0x56, 0x1d, 0x89, 0x02, 0x57, 0x4c, 0xa0, 0xc2, 0x09,
-  0xea, 0x72, 0xbb, 0x1d, 0x85, 0x5a, 0xc8, 0x74, 0x1d, 0xe5, 0x34, 0xff,
-  0xcf, 0x74, 0x1d, 0xbd, 0x20, 0x1c, 0xea, 0x95, 0x8f, 0xaa, 0x74, 0x9b,
-  0xd4, 0x10, 0x7d, 0xba, 0x5f, 0x47, 0xe8, 0xbb, 0x28, 0x10, 0x1e, 0x66,
-  0x14, 0x80, 0xc1, 0x8c, 0x14, 0x1f, 0x80, 0x08, 0x28, 0x21, 0x87, 0x16,
-  0x1b, 0x12, 0xd9, 0x2d, 0x1c, 0x21, 0xe1, 0xb8, 0x9f, 0x45, 0x48, 0xa4,
-  0x09, 0x25, 0xe1, 0x20, 0x48, 0xe4, 0x9a, 0x06, 0x9a, 0x4b, 0x49, 0xe9,
-  0xa4, 0xcf, 0x1f, 0xd1, 0xe8, 0xba, 0x14, 0x4d, 0xc6, 0x83, 0xfe, 0xc2,
-  0x14, 0x8b, 0xfa, 0xb8, 0xd8, 0x45, 0x33, 0xb2, 0x89, 0x57, 0xd6, 0x0d,
-  0x9a, 0x2a, 0xbe, 0x3f, 0xff, 0x40, 0xe4, 0xff, 0x90, 0x5b, 0x4d, 0x5e,
-  0x92, 0x1d, 0x72, 0x5e, 0x1d, 0x1c, 0xf0, 0x88, 0x38, 0xb1, 0x51, 0x82,
-  0x54, 0x04, 0x16, 0x06, 0x74, 0x17, 0x45, 0x94, 0x1e, 0x2c, 0x6c, 0x2e,
-  0x41, 0x94, 0x1e, 0x54, 0xb4, 0xb2, 0x46, 0x49, 0xd4, 0x36, 0x04, 0xc6,
-  0x60, 0x16, 0xb9, 0x1e, 0x3b, 0x11, 0x32, 0x1e, 0x20, 0xf9, 0x21, 0x05,
-  0x4d, 0x0b, 0x64, 0x14, 0x2e, 0xbd, 0xcd, 0x37, 0xec, 0x34, 0xfb, 0xb1,
-  0x7f, 0x71, 0x6b, 0x00, 0xf9, 0x34, 0x0c, 0x84, 0x80, 0x90, 0x5a, 0xf0,
-  0x7c, 0xff, 0xa2, 0x18, 0x66, 0x53, 0x25, 0xfb, 0x82, 0x06, 0x04, 0x0d,
-  0xb4, 0xb1, 0x7e, 0x1e, 0x59, 0x9f, 0x39, 0x7e, 0x1e, 0x03, 0x47, 0x10,
-  0x2a, 0x35, 0xe3, 0x60, 0xa3, 0xcb, 0x22, 0xf6, 0x7c, 0x70, 0x09, 0x64,
-  0xb5, 0x39, 0xd4, 0x1e, 0x20, 0xf7, 0x2f, 0x47, 0x32, 0x49, 0x0a, 0x0e,
-  0xf9, 0x1e, 0x0b, 0x71, 0x20, 0x6f, 0x68, 0x32, 0x92, 0x0c, 0x1c, 0x12,
-  0x1f, 0x16, 0x73, 0x44, 0xea, 0xa1, 0x47, 0x40, 0x97, 0x64, 0x0e, 0x87,
-  0xa4, 0x1e, 0x42, 0x10, 0x41, 0xa1, 0x4f, 0x72, 0xda, 0x47, 0x13, 0x0e,
-  0x52, 0x99, 0x43, 0xac, 0xaf, 0x1e, 0x78, 0x90, 0xde, 0x39, 0xde, 0x2b,
-  0x53, 0x96, 0x50, 0x13, 0x97, 0x4a, 0xca, 0xac, 0x1e, 0x80, 0x66, 0xc4,
-  0x6a, 0x0a, 0x7c, 0x25, 0x31, 0x1f, 0x80, 0x36, 0x5e, 0x14, 0x01, 0xc2,
-  0xb4, 0x90, 0x5b, 0x0b, 0xc4, 0x64, 0x9f, 0x31, 0x03, 0xb2, 0x51, 0xbe,
-  0x31, 0xf6, 0x18, 0x21, 0x60, 0xcb, 0x45, 0xc2, 0x14, 0x48, 0xa1, 0x62,
-  0x49, 0x0d, 0x0b, 0x9f, 0xcc, 0x92, 0x1f, 0x0f, 0x4d, 0x48, 0x26, 0xf6,
-  0x34, 0x33, 0x5e, 0x01, 0x20, 0x12, 0xa0, 0x0e, 0x86, 0xf9, 0x33, 0x0c,
-  0x23, 0xc2, 0x42, 0x20, 0xa1, 0x45, 0xdf, 0xbf, 0x35, 0x0d, 0x24, 0x78,
-  0x7c, 0x20, 0x8c, 0x18, 0x24, 0x90, 0xe1, 0xf8, 0x48, 0xd7, 0x01, 0x92,
-  0x0f, 0x1c, 0x88, 0x1f, 0x24, 0x98, 0x1a, 0xdc, 0xfa, 0x31, 0x49, 0x96,
-  0x10, 0xd2, 0xbc, 0x80, 0x1f, 0x18, 0x4b, 0x01, 0xc2, 0x56, 0x4f, 0x84,
-  0xd1, 0xbc, 0xa6, 0x1f, 0x8c, 0x94, 0xd9, 0xa6, 0x1f, 0xf2, 0x9f, 0x20,
-  0x00, 0xd8, 0xcc, 0x14, 0x07, 0x90, 0xac, 0x1f, 0x23, 0xbc, 0x90, 0x1f,
-  0x90, 0x84, 0xc5, 0x56, 0x28, 0xc9, 0x04, 0x28, 0x24, 0x76, 0xb4, 0x16,
-  0xff, 0xe8, 0x6d, 0x07, 0xa1, 0x61, 0xfe, 0x01, 0x01, 0xe9, 0xb9, 0x00,
-  0x08, 0x41, 0x31, 0x82, 0x08, 0x1f, 0xbb, 0xe9, 0xa8, 0x6c, 0x10, 0xf5,
-  0x01, 0xbc, 0x0c, 0xa3, 0x6a, 0x49, 0x00, 0x74, 0xc0, 0x20, 0x4d, 0x5e,
-  0x49, 0x17, 0x5a, 0x57, 0x15, 0xd7, 0xb7, 0xa3, 0xde, 0x20, 0x2d, 0xa1,
-  0xbd, 0x19, 0xa3, 0x6c, 0x49, 0xda, 0x05, 0x05, 0x01, 0x36, 0xf5, 0x7b,
-  0xd6, 0xc2, 0x13, 0x83, 0xa7, 0x60, 0x72, 0xe8, 0xbb, 0x0f, 0xb6, 0x9f,
-  0x71, 0xe1, 0x38, 0x13, 0xd4, 0x00, 0x60, 0x98, 0x63, 0xa8, 0xec, 0x00,
-  0x6a, 0x04, 0x13, 0x3b, 0x60, 0x42, 0xa8, 0x31, 0x69, 0xf8, 0x3b, 0x06,
-  0x70, 0x49, 0x75, 0x2b, 0xc8, 0x5b, 0x5a, 0x74, 0xf6, 0x38, 0x9a, 0x9b,
-  0x1d, 0x18, 0x82, 0xb0, 0xe7, 0x9d, 0xe2, 0x20, 0xfe, 0x1c, 0xe0, 0x20,
-  0x74, 0x1b, 0xa0, 0x4d, 0x95, 0xd6, 0x0b, 0xa3, 0x14, 0xed, 0xa1, 0x6c,
-  0x72, 0x96, 0x07, 0x08, 0xf6, 0x86, 0x32, 0xac, 0xfb, 0x05, 0x9e, 0x10,
-  0x9a, 0x2e, 0xed, 0xbe, 0x9a, 0x05, 0xcc, 0x82, 0x14, 0x40, 0x58, 0x1c,
-  0x34, 0x0f, 0x16, 0xc4, 0xd8, 0x17, 0xe3, 0x6d, 0x3d, 0xb0, 0xf1, 0x17,
-  0xd1, 0x09, 0x0d, 0x6a, 0xd7, 0xb2, 0xbe, 0x41, 0x31, 0x59, 0x58, 0x20,
-  0xaf, 0x67, 0x6d, 0xcd, 0xcc, 0xb5, 0xea, 0x24, 0x4a, 0xdf, 0xca, 0x17,
-  0x72, 0x1a, 0x01, 0x2c, 0xe0, 0x60, 0xca, 0x92, 0x41, 0x47, 0x76, 0x47,
-  0x49, 0x04, 0x60, 0x7a, 0x49, 0xf9, 0x8f, 0xfe, 0xd8, 0x41, 0x6f, 0xc5,
-  0x65, 0x25, 0xcf, 0x78, 0x76, 0x25, 0xb0, 0x4f, 0xd9, 0x19, 0x7b, 0x9a,
-  0x6c, 0x37, 0x19, 0x08, 0x2e, 0xa1, 0xd4, 0x55, 0x01, 0xbb, 0xd4, 0x7c,
-  0x17, 0x04, 0x7e, 0x0a, 0x7f, 0x12, 0xa1, 0x7c, 0xee, 0x0c, 0x08, 0x7c,
-  0x0a, 0x5a, 0x0c, 0x20, 0xc9, 0x71, 0x63, 0x25, 0x76, 0x20, 0x72, 0x78,
-  0x10, 0xc2, 0x56, 0xab, 0x23, 0x73, 0x62, 0x49, 0xa9, 0xa7, 0xe9, 0x04,
-  0xea, 0x41, 0x42, 0x73, 0xe0, 0x9a, 0x1b, 0x25, 0xef, 0xf5, 0x3b, 0xc6,
-  0x7f, 0xe8, 0x40, 0x97, 0x74, 0xe6, 0xad, 0x20, 0x14, 0xa8, 0x13, 0x9d,
-  0x25, 0x44, 0xac, 0x1f, 0x41, 0x3b, 0xa3, 0x15, 0x5e, 0x19, 0x15, 0xf1,
-  0x14, 0x98, 0x09, 0x15, 0x49, 0x86, 0x9f, 0xce, 0x07, 0x7c, 0x41, 0x90,
-  0x76, 0x64, 0x78, 0xc6, 0xe8, 0xe5, 0xe4, 0x20, 0xb6, 0x49, 0xe2, 0x74,
-  0x79, 0x72, 0x2f, 0xff, 0x36, 0x6b, 0x11, 0x03, 0x5a, 0x10, 0xc3, 0x07,
-  0xec, 0x9a, 0x68, 0x01, 0x17, 0x76, 0xa1, 0x72, 0xca, 0x07, 0x74, 0x20,
-  0x3b, 0x9a, 0x60, 0x39, 0xb6, 0xff, 0x06, 0x4f, 0xb1, 0x58, 0xca, 0xff,
-  0x0e, 0xce, 0x5c, 0x29, 0x8e, 0x9b, 0x73, 0x18, 0x47, 0x0e, 0xa8, 0xe1,
-  0x0c, 0xa0, 0x6e, 0xac, 0x35, 0x25, 0x82, 0x5b, 0x04, 0x58, 0x14, 0x43,
-  0x4c, 0x43, 0x16, 0x0b, 0x4d, 0x0d, 0x63, 0x9d, 0xfe, 0xb1, 0xdf, 0xff,
-  0x8c, 0xb5, 0xee, 0xd5, 0xe6, 0x21, 0xbb, 0x70, 0xa0, 0x43, 0xf7, 0x01,
-  0x13, 0x05, 0x16, 0x55, 0x69, 0x86, 0x5b, 0x5e, 0x0f, 0x48, 0xf9, 0x3b,
-  0xe8, 0x20, 0x62, 0x35, 0x21, 0x83, 0x8b, 0xaa, 0x72, 0x39, 0x21, 0x57,
-  0x3e, 0x04, 0x61, 0x49, 0xb8, 0xab, 0x11, 0xe2, 0xca, 0xb6, 0x7d, 0x21,
-  0xb2, 0x85, 0xe8, 0x05, 0xc1, 0x9b, 0xbc, 0x13, 0x0b, 0x14, 0x92, 0x49,
-  0xd9, 0x24, 0x93, 0x08, 0x64, 0x29, 0xb1, 0x06, 0x7d, 0xec, 0x55, 0x08,
-  0x24, 0x36, 0x31, 0xcd, 0x9c, 0x16, 0x11, 0x8b, 0x85, 0x93, 0x2e, 0xb9,
-  0x5c, 0x9a, 0xce, 0x44, 0xb7, 0xb5, 0x59, 0xb8, 0xb6, 0x28, 0x81, 0x79,
-  0xcb, 0xa6, 0x14, 0x92, 0x2b, 0xd9, 0x45, 0x76, 0xcd, 0x1c, 0x0c, 0x2c,
-  0x80, 0x77, 0xd5, 0x39, 0x48, 0x15, 0x47, 0xe1, 0x7b, 0x7f, 0x1c, 0x08,
-  0xee, 0xe9, 0x73, 0x90, 0x17, 0x8f, 0x09, 0x22, 0x27, 0x3d, 0x60, 0x1c,
-  0x1c, 0x14, 0xd2, 0x15, 0x11, 0xcd, 0x20, 0x16, 0x21, 0x61, 0xaf, 0x31,
-  0x06, 0x3a, 0x56, 0x01, 0x7d, 0xf2, 0x3e, 0x03, 0xee, 0x9a, 0x00, 0x05,
-  0x10, 0x78, 0xac, 0x8a, 0xc8, 0x6c, 0xd8, 0x38, 0xd9, 0x01, 0x4d, 0x0e,
-  0x56, 0x8b, 0xcd, 0x18, 0x6f, 0x07, 0xa5, 0x01, 0xbb, 0x1c, 0x62, 0xfb,
-  0x48, 0xbc, 0x09, 0xdd, 0x39, 0x9a, 0xbd, 0xd5, 0x08, 0x8b, 0x1d, 0x1f,
-  0x98, 0x69, 0x2c, 0xa0, 0x60, 0xb3, 0xeb, 0x8b, 0xef, 0x2f, 0x16, 0x6a,
-  0x2a, 0x24, 0x4b, 0x95, 0x05, 0xf6, 0x19, 0x0e, 0x41, 0x1c, 0x10, 0x9a,
-  0x96, 0xd8, 0x03, 0x22, 0x15, 0xf9, 0x04, 0x73, 0x81, 0x07, 0x65, 0x0a,
-  0xbd, 0x57, 0x63, 0x82, 0x4d, 0xc5, 0x0b, 0x9b, 0x79, 0x58, 0xdb, 0x0d,
-  0x12, 0xe7, 0x9a, 0x0b, 0x02, 0x05, 0xce, 0x93, 0x0e, 0x9d, 0x1a, 0x93,
-  0x1c, 0x14, 0x66, 0x74, 0xce, 0x50, 0x50, 0xc8, 0x3a, 0xe4, 0x16, 0x83,
-  0x90, 0x18, 0x45, 0xf7, 0x16, 0x3c, 0x3f, 0x59, 0xc6, 0x3e, 0x4c, 0x1c,
-  0x81, 0x88, 0x39, 0x9e, 0x84, 0x3f, 0xc8, 0x1c, 0x2a, 0x21, 0x0f, 0xb5,
-  0x7c, 0xbf, 0x2c, 0x1f, 0x20, 0xb2, 0x1e, 0x4b, 0xda, 0xa0, 0x0a, 0xb0,
-  0x8f, 0x5b, 0xe3, 0xd0, 0x82, 0x58, 0xeb, 0x89, 0xfe, 0xda, 0xb2, 0xfe,
-  0x9a, 0x6c, 0x2e, 0x1c, 0x2b, 0x02, 0x24, 0x31, 0x81, 0xec, 0x25, 0xce,
-  0xd4, 0xf4, 0x0f, 0x50, 0xb8, 0xba, 0xc4, 0x03, 0xd9, 0x69, 0xc0, 0xa6,
-  0xbf, 0xd4, 0xda, 0xff, 0x42, 0x8e, 0x69, 0xbb, 0x0b, 0x9a, 0x94, 0x1c,
-  0xc0, 0x3b, 0xe6, 0xba, 0x9a, 0xcd, 0xbc, 0x69, 0xc8, 0xa6, 0xbb, 0x90,
-  0xc9, 0x2e, 0x58, 0x49, 0x0f, 0xaa, 0x06, 0x0a, 0xfb, 0x27, 0x3f, 0x66,
-  0xa3, 0x12, 0xb6, 0xba, 0x56, 0xb0, 0x05, 0x9d, 0x8b, 0xd7, 0xb7, 0xd8,
-  0x52, 0x2d, 0x0c, 0x70, 0x97, 0x1b, 0xb0, 0xd2, 0xb1, 0x80, 0x71, 0xb2,
-  0x54, 0x64, 0x0c, 0x39, 0x0e, 0x31, 0xf1, 0x87, 0xb1, 0x92, 0x3d, 0xa2,
-  0x32, 0x8c, 0x46, 0x1e, 0x31, 0x48, 0xb2, 0x55, 0xa5, 0x77, 0x9a, 0x06,
-  0x21, 0xcd, 0x40, 0x46, 0xb7, 0xe2, 0xf8, 0x25, 0xe1, 0x8e, 0x87, 0x46,
-  0x25, 0x4c, 0x18, 0xcc, 0x4f, 0x45, 0xbc, 0x70, 0xeb, 0x1d, 0x8b, 0x7c,
-  0x55, 0x56, 0x25, 0xc4, 0x84, 0xb5, 0x0c, 0x54, 0xbc, 0x3d, 0x08, 0x40,
-  0x40, 0x1d, 0x03, 0xda, 0x73, 0x71, 0x5a, 0x2d, 0x94, 0x27, 0x88, 0x84,
-  0x7d, 0xb1, 0xe9, 0xbc, 0x0d, 0xaf, 0x56, 0x1d, 0x53, 0xe6, 0x44, 0x49,
-  0x58, 0x9a, 0x7b, 0xc6, 0x84, 0x0c, 0x50, 0x2d, 0x99, 0x14, 0x05, 0xbb,
-  0xbf, 0xc6, 0x06, 0x0a, 0x6d, 0x10, 0x0f, 0xe2, 0x7d, 0x49, 0x11, 0x31,
-  0xa8, 0x18, 0x02, 0x0c, 0xc6, 0x78, 0x01, 0x8e, 0x86, 0x82, 0xc2, 0x56,
-  0x07, 0x1d, 0x13, 0x50, 0x67, 0x0d, 0x1e, 0x14, 0xcf, 0x52, 0x56, 0x11,
-  0x66, 0xc0, 0xda, 0xcf, 0x40, 0x4e, 0x14, 0xc6, 0xec, 0x06, 0xc7, 0x48,
-  0x26, 0x00, 0x12, 0x5f, 0xc3, 0xba, 0xb1, 0x86, 0x84, 0x57, 0xba, 0x66,
-  0x4a, 0xb6, 0x0c, 0x84, 0x16, 0x5b, 0x58, 0xc2, 0xf6, 0x57, 0x57, 0x39,
-  0x31, 0x48, 0x8e, 0xc6, 0x81, 0x04, 0x9e, 0xd0, 0x0a, 0x11, 0x35, 0x09,
-  0x33, 0x8b, 0x82, 0xc0, 0xe1, 0x98, 0x7c, 0x06, 0xfc, 0x4d, 0x98, 0x33,
-  0x42, 0x09, 0x72, 0xdc, 0xff, 0x1e, 0xeb, 0x13, 0xcb, 0x53, 0x07, 0x23,
-  0xce, 0x64, 0x30, 0xac, 0xb0, 0xf3, 0xa9, 0x0c, 0x85, 0x5a, 0x1e, 0xf2,
-  0xc8, 0xb2, 0x5b, 0x9c, 0x0e, 0x2c, 0x29, 0x24, 0x6e, 0x2c, 0x93, 0x0c,
-  0x2b, 0xd0, 0x92, 0x26, 0x57, 0x0d, 0xa7, 0x84, 0xb8, 0xcc, 0x97, 0x15,
-  0xce, 0xd5, 0xaa, 0x91, 0xd1, 0xc2, 0xeb, 0x2f, 0xd8, 0x12, 0xc6, 0x56,
-  0x09, 0xc7, 0xac, 0xdf, 0xff, 0xd6, 0xeb, 0x0a, 0xc1, 0x37, 0x91, 0x19,
-  0x42, 0x98, 0xea, 0x12, 0x17, 0xe9, 0x7d, 0xc9, 0x73, 0x92, 0x3e, 0xf7,
-  0x20, 0x56, 0x10, 0xb2, 0xe5, 0xd9, 0x2f, 0x4a, 0x8a, 0xeb, 0xd2, 0xdb,
-  0xd9, 0x05, 0x21, 0x0c, 0x1c, 0x0a, 0x87, 0x0c, 0x20, 0xa0, 0x55, 0x9a,
-  0x0d, 0x67, 0x57, 0x61, 0xed, 0x20, 0xed, 0xf1, 0x2e, 0x22, 0x51, 0xd0,
-  0xf5, 0x33, 0x2a, 0xac, 0x41, 0x0b, 0x08, 0xf9, 0x29, 0x18, 0x36, 0x64,
-  0x14, 0x76, 0x57, 0x5f, 0x5b, 0xb7, 0x03, 0x4e, 0x2c, 0xca, 0x4c, 0xe2,
-  0x0a, 0x98, 0x76, 0x08, 0x4c, 0x1a, 0x7b, 0x14, 0x0f, 0x42, 0x42, 0x79,
-  0x18, 0x56, 0x5f, 0x06, 0xbb, 0xeb, 0x08, 0x7e, 0x90, 0xec, 0x34, 0x1e,
-  0xd2, 0xcc, 0x89, 0x68, 0xb2, 0x13, 0x97, 0x81, 0xc7, 0x96, 0xde, 0xda,
-  0x28, 0xcc, 0xa5, 0x36, 0x47, 0xd1, 0xf8, 0xf4, 0x01, 0x1f, 0x1b, 0x0c,
-  0x61, 0x0b, 0xc0, 0xfc, 0x43, 0xd4, 0xed, 0xeb, 0x45, 0xed, 0x95, 0x32,
-  0x66, 0x7b, 0xaa, 0x11, 0xa2, 0x44, 0x1f, 0xbc, 0xfc, 0x6e, 0x22, 0x8b,
-  0xd6, 0xb9, 0x22, 0xcd, 0x3c, 0x0c, 0x9a, 0xfe, 0xd7, 0x61, 0xb8, 0x45,
-  0x1b, 0xfb, 0xa6, 0xe1, 0xbb, 0x37, 0xcb, 0xe5, 0x1f, 0x4d, 0x0b, 0xd1,
-  0xb6, 0x66, 0x1a, 0x66, 0xd6, 0x33, 0x48, 0xa2, 0x0d, 0xdc, 0x16, 0x99,
-  0xd6, 0xb5, 0xa3, 0x1b, 0x4b, 0x35, 0xed, 0x51, 0x85, 0x6c, 0x33, 0x23,
-  0xe3, 0x14, 0x98, 0x9f, 0xe4, 0x50, 0x56, 0x6e, 0x50, 0x17, 0xc7, 0x7c,
-  0xfd, 0xe4, 0x0c, 0x8c, 0xb7, 0xc5, 0xac, 0xb5, 0xb5, 0x86, 0xe7, 0x12,
-  0x40, 0x55, 0x07, 0xd8, 0x84, 0x6c, 0x97, 0x96, 0xd3, 0xc7, 0xf8, 0x87,
-  0x4d, 0x19, 0x05, 0x32, 0xe0, 0x01, 0x81, 0x09, 0x2b, 0x64, 0x45, 0xb0,
-  0x8b, 0x40, 0x81, 0x06, 0x8a, 0xa6, 0x54, 0x08, 0xa2, 0x46, 0xd0, 0x4b,
-  0x82, 0x2b, 0xf0, 0xe5, 0xc9, 0x25, 0x59, 0xda, 0xe1, 0x91, 0x5d, 0xdc,
-  0x03, 0xfa, 0xe3, 0xe6, 0xf5, 0x69, 0x1c, 0x14, 0x9b, 0xf2, 0x34, 0xef,
-  0x86, 0x66, 0x08, 0xdb, 0x1a, 0xf6, 0x24, 0x16, 0x69, 0xbe, 0x03, 0xb2,
-  0x18, 0xcf, 0x58, 0x39, 0x8a, 0x35, 0xe3, 0x80, 0x25, 0x72, 0x19, 0x02,
-  0xb5, 0x73, 0x2f, 0x86, 0xeb, 0x1f, 0x57, 0x60, 0x25, 0x0e, 0xb2, 0xff,
-  0x43, 0xb0, 0x47, 0x4c, 0xfc, 0x3b, 0xc7, 0x7f, 0xd5, 0x61, 0x3c, 0x77,
-  0x0a, 0xd6, 0xc6, 0x10, 0x09, 0x22, 0x19, 0xb8, 0x12, 0xde, 0xcb, 0x08,
-  0x5d, 0x44, 0xb0, 0xfd, 0x05, 0xad, 0xd6, 0x59, 0xa5, 0x39, 0x15, 0xc5,
-  0x7d, 0x21, 0x2c, 0xe3, 0x64, 0xa0, 0x56, 0x0c, 0x0c, 0xe8, 0xf7, 0xef,
-  0x97, 0xdf, 0xbb, 0x64, 0x12, 0x1a, 0x72, 0x08, 0xd1, 0x42, 0x2e, 0xa2,
-  0xeb, 0x32, 0x8a, 0x56, 0x68, 0x10, 0xa8, 0xa7, 0x65, 0x67, 0x08, 0x56,
-  0xf8, 0xfc, 0xeb, 0x10, 0x2b, 0x76, 0xad, 0x3c, 0xea, 0xfc, 0x00, 0x7e,
-  0x23, 0xff, 0x71, 0xfc, 0x4e, 0xca, 0x20, 0x01, 0x8e, 0x51, 0x4c, 0xa2,
-  0x88, 0xd4, 0x93, 0x5b, 0x22, 0xf6, 0x81, 0x80, 0x7d, 0x7a, 0xdb, 0x75,
-  0x0e, 0x40, 0x31, 0xf0, 0xeb, 0x0c, 0x60, 0x5c, 0x32, 0x0a, 0x1c, 0xf6,
-  0x19, 0x7b, 0x6c, 0x3c, 0x6b, 0x12, 0xcb, 0xc1, 0x9a, 0x92, 0x40, 0x58,
-  0xc2, 0xb3, 0xc9, 0x14, 0x18, 0xc0, 0x55, 0x56, 0xc0, 0xb5, 0x59, 0x06,
-  0xd3, 0x61, 0x7f, 0x2f, 0x1e, 0x38, 0xa2, 0x22, 0xef, 0x2f, 0x06, 0x89,
-  0x87, 0x0e, 0xb0, 0x69, 0x0c, 0xe5, 0x08, 0x90, 0x12, 0x7b, 0x89, 0xbf,
-  0x16, 0x09, 0x0f, 0xb7, 0x1a, 0xe5, 0x69, 0x1e, 0xa1, 0xe8, 0xba, 0xa0,
-  0x0f, 0xb6, 0x52, 0xce, 0x05, 0xbf, 0x64, 0x4a, 0xa8, 0x8c, 0x04, 0xc6,
-  0x73, 0x01, 0xb3, 0x3a, 0xca, 0x8b, 0x87, 0x06, 0x9f, 0x61, 0x0c, 0xcb,
-  0x16, 0xc7, 0x24, 0xd8, 0x12, 0x19, 0x1c, 0x0e, 0xec, 0x9a, 0x36, 0x6c,
-  0x12, 0xc8, 0x48, 0x27, 0x2a, 0x0b, 0x65, 0x98, 0x2e, 0xe9, 0xb4, 0xa3,
-  0x22, 0x21, 0xf4, 0xbb, 0x0d, 0xbb, 0x0a, 0x0f, 0xc4, 0x04, 0xc2, 0x30,
-  0x88, 0x8c, 0xb9, 0x0d, 0xdb, 0x0a, 0x80, 0xc2, 0x0b, 0x74, 0x56, 0xf7,
-  0x05, 0xb0, 0xa2, 0x3a, 0xcc, 0x08, 0x1a, 0x1b, 0xf9, 0x0a, 0x36, 0x1a,
-  0x32, 0xfa, 0xcd, 0xfb, 0x0a, 0x20, 0xd9, 0xfc, 0x0a, 0xb1, 0x1a, 0xa0,
-  0xfd, 0xb9, 0x2c, 0x18, 0xe9, 0x68, 0xaf, 0x3b, 0x46, 0xe9, 0x32, 0x1a,
-  0x58, 0xac, 0x06, 0x3a, 0x22, 0x04, 0x11, 0xe8, 0xde, 0xb3, 0x1f, 0x45,
-  0x58, 0xb6, 0x2c, 0x3d, 0x06, 0xde, 0xd9, 0x08, 0x17, 0x04, 0x48, 0x70,
-  0x38, 0xba, 0x41, 0xad, 0xaf, 0xb2, 0x52, 0x4b, 0x1b, 0x56, 0x40, 0x31,
-  0x59, 0xd4, 0x34, 0x16, 0x5e, 0x9b, 0xc3, 0x48, 0xab, 0xb0, 0xf3, 0xa2,
-  0x1e, 0x93, 0x50, 0xa9, 0x06, 0x8f, 0xb2, 0x5f, 0x07, 0x12, 0xcd, 0x3c,
-  0xf5, 0x1d, 0x56, 0x65, 0x81, 0xec, 0x3a, 0x22, 0x95, 0x3a, 0x57, 0x89,
-  0x82, 0x0e, 0x17, 0xd9, 0x16, 0x44, 0x2b, 0x1a, 0xbb, 0xa4, 0xd8, 0xb8,
-  0x57, 0x35, 0x31, 0x58, 0x20, 0x0c, 0x7a, 0x83, 0x06, 0x25, 0xa4, 0x6b,
-  0x3a, 0x32, 0xcc, 0xd1, 0x11, 0x3e, 0xd0, 0x9d, 0x22, 0x40, 0xe0, 0x0e,
-  0x13, 0x79, 0x62, 0x13, 0xf7, 0x4c, 0x08, 0xb2, 0xfe, 0x64, 0x4f, 0xad,
-  0xd0, 0x4e, 0x2c, 0x01, 0x77, 0x44, 0xeb, 0x05, 0xc6, 0xe0, 0x42, 0xd4,
-  0xdb, 0x37, 0x17, 0x22, 0x72, 0x08, 0xc7, 0x82, 0xcc, 0xaa, 0x36, 0xb6,
-  0xeb, 0x2a, 0x08, 0x96, 0x50, 0x02, 0x49, 0xc1, 0x9d, 0x39, 0x60, 0xc8,
-  0xb2, 0x17, 0x54, 0x0f, 0x42, 0x9d, 0x21, 0xa0, 0xb7, 0x52, 0x47, 0x01,
-  0xd6, 0x77, 0xc9, 0x04, 0xb7, 0x08, 0xfc, 0x14, 0xec, 0xae, 0x77, 0xc0,
-  0x20, 0xd0, 0x02, 0x9b, 0x8a, 0x85, 0x36, 0x15, 0x0a, 0x8e, 0x97, 0xf5,
-  0x9a, 0x7c, 0x76, 0x2b, 0x52, 0x50, 0xc5, 0x32, 0x6b, 0x1b, 0x1e, 0x21,
-  0x90, 0x22, 0xbb, 0xf0, 0x97, 0x86, 0x13, 0x07, 0xd4, 0x0b, 0x16, 0x15,
-  0x21, 0x68, 0x90, 0x1b, 0x05, 0x85, 0x30, 0xcd, 0x14, 0x0e, 0x20, 0x0d,
-  0x57, 0x87, 0x2e, 0x83, 0xf6, 0xff, 0x0a, 0x72, 0x16, 0x33, 0x57, 0x24,
-  0x51, 0x5a, 0x97, 0xca, 0x49, 0xe4, 0x25, 0xb5, 0x92, 0x1e, 0xc3, 0x25,
-  0x73, 0xbd, 0x9f, 0x2e, 0xa5, 0x46, 0x0a, 0x12, 0x66, 0xc1, 0x98, 0x8c,
-  0x59, 0x08, 0x08, 0x64, 0x06, 0x01, 0xc0, 0xba, 0x22, 0xc0, 0x1d, 0x4f,
-  0x14, 0x05, 0x06, 0x0e, 0x63, 0x82, 0xeb, 0xf3, 0x35, 0x4e, 0xc4, 0x92,
-  0xbb, 0x27, 0xf8, 0x01, 0x5a, 0x92, 0xb7, 0xf6, 0xff, 0xb1, 0xc0, 0x75,
-  0x1a, 0x64, 0x30, 0xce, 0xa6, 0x32, 0x82, 0xc0, 0x1d, 0x55, 0x7e, 0xc6,
-  0xc6, 0x57, 0x1e, 0xc8, 0xa8, 0xc8, 0xf6, 0x77, 0x0a, 0x0c, 0x80, 0x32,
-  0x8e, 0x69, 0xfa, 0x6b, 0x0b, 0x7c, 0xdc, 0x27, 0x6b, 0x22, 0x16, 0x59,
-  0xdf, 0x23, 0x65, 0x0e, 0xab, 0xc6, 0x46, 0xd4, 0x43, 0x84, 0x0c, 0x5e,
-  0x89, 0x40, 0x59, 0x2a, 0x76, 0xc6, 0xaa, 0xe8, 0x00, 0x8a, 0x2b, 0xc6,
-  0xac, 0xfe, 0x31, 0x06, 0xfe, 0x93, 0x4c, 0xa4, 0x31, 0xd5, 0xa4, 0x07,
-  0x28, 0x28, 0x86, 0xdf, 0xaa, 0x04, 0x04, 0xe6, 0x30, 0xed, 0x17, 0x0c,
-  0x61, 0x13, 0x73, 0xad, 0x62, 0x0b, 0xd2, 0x09, 0xd1, 0x92, 0x3e, 0xa8,
-  0x0c, 0x09, 0x35, 0x14, 0x9f, 0x13, 0x89, 0x0e, 0x1e, 0xfe, 0x69, 0x89,
-  0x1e, 0x20, 0x69, 0xff, 0x36, 0xf6, 0x03, 0x0b, 0xb0, 0x46, 0x37, 0x13,
-  0x9d, 0x90, 0x46, 0x70, 0x5a, 0x06, 0x34, 0xd4, 0xfa, 0x72, 0xa0, 0x40,
-  0xfd, 0xf4, 0x48, 0x00, 0x56, 0x48, 0x0d, 0x05, 0x25, 0xff, 0xa6, 0x29,
-  0xe0, 0x0f, 0x7c, 0xd9, 0x0d, 0xbd, 0xa8, 0x48, 0xb1, 0x4f, 0xb0, 0xfe,
-  0x35, 0x99, 0xb1, 0x08, 0xc2, 0x97, 0xda, 0xfe, 0x35, 0xc0, 0x26, 0x58,
-  0x40, 0x76, 0x52, 0x2b, 0x56, 0xc3, 0xaf, 0xc1, 0x9a, 0x82, 0x78, 0xcb,
-  0x40, 0x55, 0x40, 0x41, 0xec, 0xe2, 0x37, 0xd5, 0x06, 0xd1, 0xb4, 0xb0,
-  0x09, 0x77, 0xb9, 0x3f, 0x28, 0x2c, 0xb2, 0x91, 0x51, 0x9b, 0x22, 0x97,
-  0xb1, 0x3d, 0x58, 0x42, 0x34, 0xaa, 0x5e, 0x7e, 0x62, 0x74, 0x16, 0x01,
-  0xf6, 0x01, 0x70, 0x28, 0x48, 0xae, 0xd4, 0x46, 0xb2, 0xcc, 0x02, 0x03,
-  0x20, 0x03, 0x08, 0x48, 0x02, 0x2d, 0xa4, 0xc6, 0x78, 0xff, 0xd6, 0x5c,
-  0x06, 0xa0, 0x95, 0x3b, 0x86, 0x3b, 0x26, 0xef, 0x89, 0x0b, 0x43, 0x44,
-  0x4b, 0x89, 0xb8, 0xb0, 0x00, 0x3a, 0x05, 0xc1, 0x8e, 0x85, 0x00, 0x47,
-  0x87, 0x09, 0xe9, 0xad, 0xa1, 0x17, 0xcb, 0x8b, 0x16, 0x2b, 0x5b, 0x3e,
-  0x1b, 0x1b, 0xf8, 0x3b, 0x6f, 0x43, 0x77, 0x52, 0x72, 0xfd, 0x05, 0x3b,
-  0x56, 0x12, 0x73, 0x4b, 0x84, 0x18, 0xdb, 0x29, 0x11, 0x19, 0x6b, 0x1b,
-  0x44, 0x2d, 0x1e, 0x20, 0xb0, 0x27, 0x62, 0x8b, 0xe4, 0x1b, 0x56, 0xa2,
-  0xec, 0x01, 0x46, 0x1d, 0x85, 0xe2, 0x62, 0x97, 0xda, 0x06, 0x46, 0x14,
-  0x78, 0x92, 0x29, 0x4f, 0x6c, 0x1a, 0xe0, 0x0c, 0x02, 0x7b, 0x83, 0xe9,
-  0x9b, 0xd2, 0xa5, 0x9b, 0xfe, 0x47, 0x3b, 0x0b, 0x9d, 0xe2, 0x49, 0xd3,
-  0x62, 0x30, 0x3d, 0xe0, 0xb0, 0x4c, 0xb8, 0x03, 0x6e, 0x4c, 0xd6, 0xce,
-  0x1e, 0x0e, 0x40, 0x19, 0xb7, 0x2d, 0x24, 0x9c, 0xd9, 0xb2, 0x1e, 0x72,
-  0x98, 0x00, 0xc9, 0xb4, 0x72, 0x79, 0x00, 0xc9, 0xb6, 0x72, 0x5a, 0x00,
-  0xc9, 0xb8, 0x72, 0x3b, 0x00, 0xc9, 0xba, 0x72, 0x1c, 0x4b, 0xf9, 0x36,
-  0xde, 0x04, 0xdd, 0x2b, 0x24, 0x10, 0x20, 0x72, 0x0e, 0x00, 0xc9, 0x06,
-  0x1b, 0xea, 0x00, 0xf6, 0xe1, 0xfd, 0x24, 0x11, 0xc9, 0xb4, 0x72, 0xbc,
-  0x14, 0xc9, 0xb6, 0x72, 0x97, 0x14, 0xc9, 0xb8, 0x72, 0x72, 0x14, 0xc9,
-  0xba, 0x72, 0x4d, 0x48, 0x25, 0xd7, 0x45, 0x48, 0xff, 0xda, 0x35, 0x03,
-  0xb5, 0x73, 0x51, 0x62, 0x4a, 0xa3, 0xc2, 0x34, 0x04, 0xda, 0x98, 0xff,
-  0x77, 0xa8, 0x75, 0x9d, 0x50, 0x92, 0x1f, 0xf7, 0x14, 0x05, 0xc0, 0x06,
-  0x46, 0xe5, 0x1e, 0x5b, 0x03, 0x9e, 0x3d, 0x12, 0x3d, 0x2b, 0x90, 0x4f,
-  0x2c, 0x4d, 0x0d, 0xef, 0x3a, 0x24, 0x64, 0x4d, 0x08, 0x08, 0xb1, 0xf2,
-  0x40, 0x2b, 0x7b, 0x56, 0x28, 0x5d, 0x33, 0x0d, 0x61, 0xa7, 0x16, 0xc1,
-  0x59, 0x92, 0x00, 0xd4, 0xc0, 0xb1, 0x21, 0x56, 0xd8, 0x60, 0x4c, 0xf6,
-  0x4c, 0xc1, 0x8b, 0x5c, 0xd5, 0x26, 0xd2, 0xd9, 0xbe, 0xf6, 0x00, 0xe4,
-  0xf6, 0xb1, 0x10, 0xf6, 0xcd, 0x50, 0x66, 0x1a, 0x8b, 0x00, 0x69, 0xd9,
-  0x63, 0x91, 0x06, 0xfa, 0xd4, 0x57, 0x21, 0x26, 0xc0, 0x08, 0x42, 0xda,
-  0x3a, 0xb4, 0x00, 0xab, 0xd8, 0x25, 0x12, 0x17, 0x0b, 0x7b, 0x3a, 0x04,
-  0x8b, 0x5a, 0x77, 0x7f, 0x24, 0x08, 0xbe, 0x59, 0x03, 0xa2, 0xed, 0x69,
-  0x7c, 0x15, 0x9d, 0x1a, 0x06, 0x55, 0xbb, 0xf2, 0x7f, 0x09, 0x08, 0x07,
-  0x7d, 0x34, 0x51, 0x6d, 0x54, 0x6e, 0x33, 0xc4, 0x99, 0xd8, 0x9a, 0x01,
-  0xbb, 0x1e, 0xeb, 0x36, 0x57, 0x8e, 0xda, 0x39, 0x97, 0xc8, 0xd0, 0x86,
-  0x47, 0x8b, 0x33, 0x1d, 0xc7, 0x7e, 0x6e, 0xd2, 0x2c, 0xff, 0x88, 0x9c,
-  0x46, 0x01, 0x0c, 0x84, 0xe0, 0x87, 0x06, 0x9a, 0x56, 0x12, 0xab, 0xb6,
-  0x74, 0x63, 0x04, 0x2a, 0xd9, 0x74, 0x08, 0xb8, 0x19, 0x12, 0x17, 0x63,
-  0x43, 0x20, 0x11, 0x84, 0x91, 0x08, 0xca, 0xdf, 0xad, 0x25, 0x2f, 0x03,
-  0x56, 0x65, 0x50, 0x22, 0x94, 0x64, 0x15, 0xbf, 0xe9, 0xbb, 0x33, 0x04,
-  0x2e, 0x39, 0x80, 0x37, 0xaf, 0x64, 0xe5, 0xf7, 0xeb, 0x7d, 0x84, 0x08,
-  0x23, 0xb1, 0xd3, 0x20, 0xfc, 0x6c, 0x48, 0x50, 0x59, 0x0d, 0x50, 0x87,
-  0xd4, 0x74, 0x80, 0x29, 0xab, 0xbd, 0x18, 0x37, 0x5a, 0xa4, 0x1a, 0x43,
-  0xf2, 0xe3, 0x13, 0xfd, 0x59, 0x83, 0xd4, 0x27, 0xc7, 0x05, 0x6d, 0x04,
-  0x2d, 0x0d, 0x9a, 0xeb, 0xec, 0x28, 0xeb, 0x24, 0x2a, 0xd2, 0x10, 0xee,
-  0x75, 0x09, 0x06, 0x88, 0x0d, 0x06, 0x46, 0xb0, 0x11, 0x33, 0xf2, 0x31,
-  0xfe, 0x80, 0x03, 0xe8, 0x35, 0x42, 0xc8, 0x6a, 0x86, 0xa6, 0xfd, 0x03,
-  0x02, 0x08, 0x04, 0xb3, 0x03, 0xec, 0x01, 0xbf, 0x60, 0x3a, 0x0c, 0x18,
-  0x45, 0x0a, 0x67, 0xab, 0x8e, 0xb6, 0x46, 0x0e, 0xbf, 0xdb, 0xc6, 0x05,
-  0x10, 0x2c, 0xc8, 0xb2, 0x12, 0xcb, 0xca, 0x14, 0x2c, 0xcc, 0x6d, 0xf9,
-  0xcf, 0x10, 0xd1, 0x05, 0xe9, 0x2f, 0x9a, 0x8c, 0x4e, 0xeb, 0x6e, 0x07,
-  0xe1, 0x53, 0x69, 0xe3, 0x73, 0xe5, 0xaa, 0x4b, 0xe7, 0xdd, 0xcb, 0x83,
-  0x03, 0xdf, 0x6c, 0x1f, 0xf5, 0xf6, 0xf7, 0x2c, 0xca, 0xd1, 0xd9, 0x37,
-  0x16, 0x6d, 0xd3, 0x05, 0x96, 0x18, 0xd5, 0xde, 0x28, 0xed, 0xe5, 0x02,
-  0x59, 0xef, 0x73, 0xf1, 0x33, 0x5b, 0xf3, 0x15, 0x1a, 0x2c, 0xd9, 0x00,
-  0x18, 0x72, 0x85, 0x31, 0x96, 0xf9, 0xfb, 0xcc, 0xb1, 0x01, 0x81, 0x95,
-  0x8b, 0x0c, 0x82, 0xb3, 0x40, 0x84, 0xac, 0xc3, 0xa1, 0x84, 0xab, 0x84,
-  0x26, 0x4b, 0x10, 0x56, 0x35, 0x09, 0x71, 0xbd, 0x4c, 0x84, 0xf0, 0x0b,
-  0xeb, 0x67, 0x07, 0x60, 0xa4, 0x52, 0xcb, 0x86, 0xe6, 0xb0, 0xc4, 0x50,
-  0xb2, 0x33, 0x7f, 0x50, 0x82, 0x06, 0xc0, 0x7d, 0xb9, 0x10, 0x19, 0x12,
-  0x19, 0x0a, 0x19, 0x0c, 0x39, 0x0c, 0x3a, 0x0e, 0xb9, 0xc0, 0xb2, 0x7b,
-  0x56, 0x04, 0x6e, 0x06, 0xb0, 0x35, 0x7c, 0x94, 0x20, 0x1b, 0xb0, 0xfa,
-  0xa1, 0x90, 0x08, 0x89, 0xb3, 0x56, 0x7f, 0x80, 0x08, 0x0b, 0xb9, 0x3b,
-  0x0e, 0x80, 0xa4, 0x0c, 0x36, 0x97, 0x08, 0x89, 0x0a, 0x05, 0x1c, 0x5c,
-  0x31, 0xf2, 0xe2, 0xc4, 0x5f, 0x10, 0x2c, 0x93, 0xc4, 0x5b, 0xc2, 0x8a,
-  0xf1, 0x47, 0x08, 0xb1, 0x0f, 0x51, 0xb1, 0x93, 0xf8, 0xd0, 0xdf, 0x31,
-  0x9f, 0xe9, 0x10, 0x53, 0x06, 0xb0, 0x50, 0x20, 0x51, 0xdb, 0xca, 0x07,
-  0x5b, 0x46, 0xb6, 0x12, 0x52, 0x38, 0x53, 0xff, 0xc4, 0x5f, 0x23, 0x6b,
-  0xe7, 0x16, 0xfe, 0x39, 0x77, 0x14, 0x7f, 0xa7, 0x02, 0x24, 0x81, 0x91,
-  0x0d, 0xde, 0x10, 0x10, 0xad, 0x9e, 0xc0, 0x82, 0xf2, 0x23, 0xb4, 0xa2,
-  0x06, 0x39, 0x9a, 0x0c, 0x58, 0xcc, 0x38, 0x10, 0x3a, 0xfe, 0x69, 0x5d,
-  0x09, 0x6c, 0xd7, 0x12, 0x19, 0x8b, 0x2e, 0x19, 0x48, 0x68, 0x13, 0x15,
-  0x04, 0x03, 0x0a, 0xc1, 0xab, 0x04, 0x86, 0xbd, 0xe9, 0xc4, 0x1c, 0x29,
-  0x62, 0x3c, 0x00, 0x76, 0x9d, 0x90, 0x4c, 0xdb, 0x00, 0x86, 0x9d, 0xb0,
-  0x22, 0x6e, 0x14, 0x84, 0x64, 0x3a, 0x1e, 0x08, 0x4e, 0x05, 0x8f, 0xde,
-  0x7d, 0xe0, 0x35, 0xc8, 0x68, 0x99, 0x0d, 0x20, 0x41, 0x35, 0x01, 0x48,
-  0x93, 0xe8, 0x06, 0x63, 0x2f, 0x0b, 0x2c, 0x34, 0x5c, 0x4c, 0xc3, 0xd8,
-  0x50, 0xc1, 0xc1, 0xcf, 0xac, 0x52, 0xe8, 0x98, 0x06, 0x46, 0x4a, 0x17,
-  0xa0, 0x13, 0xa4, 0x40, 0x35, 0x87, 0x0e, 0x00, 0xa2, 0x5a, 0xa7, 0xd2,
-  0xe2, 0x0a, 0x7c, 0xb3, 0x0e, 0xb5, 0x11, 0x81, 0x39, 0x84, 0xa1, 0x06,
-  0xc7, 0x42, 0x19, 0xc7, 0x2e, 0x1b, 0x2a, 0x18, 0x50, 0x00, 0x76, 0x5a,
-  0x9d, 0x00, 0x85, 0xd7, 0x76, 0x06, 0x96, 0x00, 0x11, 0x4d, 0xb2, 0x48,
-  0x2a, 0x96, 0xa7, 0xcb, 0x0f, 0x79, 0x08, 0xfe, 0x45, 0xf6, 0x2b, 0xeb,
-  0x46, 0x47, 0x04, 0xe4, 0x75, 0x31, 0x22, 0xea, 0x27, 0x12, 0x27, 0xed,
-  0x14, 0xe7, 0x02, 0x3f, 0x1e, 0x11, 0xfe, 0x08, 0x60, 0xa0, 0x55, 0xec,
-  0x26, 0x12, 0x39, 0x67, 0xef, 0xf8, 0xd1, 0xf0, 0x10, 0xb8, 0xf4, 0x01,
-  0x61, 0xdc, 0xaa, 0x05, 0xea, 0xc0, 0x70, 0x05, 0x17, 0xe7, 0x84, 0xae,
-  0xad, 0xff, 0x8e, 0x35, 0x0b, 0xff, 0x7e, 0x31, 0x08, 0x37, 0x45, 0xb9,
-  0x92, 0x84, 0xc3, 0x5c, 0x1b, 0xbc, 0xe9, 0xae, 0x04, 0x57, 0xb8, 0x80,
-  0x84, 0x16, 0x11, 0x34, 0xe6, 0x1b, 0x5a, 0x32, 0xc2, 0x46, 0x2e, 0x1f,
-  0x54, 0x45, 0xfd, 0x0a, 0xe9, 0x6b, 0x04, 0x94, 0x1d, 0xb7, 0x45, 0x0f,
-  0xf7, 0xe2, 0xd8, 0x1b, 0xc0, 0xb8, 0xaf, 0x04, 0x3c, 0x53, 0xee, 0x54,
-  0xbc, 0x86, 0xbb, 0xb3, 0x08, 0x04, 0x3c, 0x53, 0xee, 0x9c, 0x89, 0xd0,
-  0x10, 0x80, 0x06, 0x31, 0x11, 0x6c, 0xbd, 0x3d, 0x42, 0x79, 0xb0, 0x8d,
-  0x8b, 0x1f, 0x94, 0x3d, 0x68, 0xcd, 0xed, 0x37, 0xd3, 0x03, 0x85, 0xc7,
-  0x4b, 0xa3, 0x19, 0xec, 0xf0, 0x93, 0x08, 0x54, 0xf2, 0xf1, 0xec, 0x77,
-  0x31, 0xa2, 0x84, 0xe4, 0x3c, 0x2c, 0xfc, 0x9c, 0xfa, 0x4d, 0x28, 0x18,
-  0x61, 0x14, 0xfb, 0x4a, 0xfc, 0xeb, 0xe9, 0x12, 0xa5, 0x01, 0xba, 0x05,
-  0x06, 0xff, 0x87, 0x30, 0xb6, 0x09, 0xe0, 0x81, 0x86, 0x36, 0x80, 0x0f,
-  0xa1, 0x54, 0x2e, 0xf0, 0xd6, 0x16, 0x1b, 0xaf, 0x1e, 0x6e, 0x28, 0x75,
-  0x1f, 0x21, 0xfd, 0xe0, 0xf0, 0x4e, 0x0a, 0x14, 0xf7, 0x95, 0x03, 0x40,
-  0x10, 0x5b, 0xab, 0x6b, 0x82, 0xfb, 0xe7, 0x18, 0x2a, 0x8d, 0xde, 0x84,
-  0x46, 0xd2, 0x2a, 0x50, 0x2e, 0xf1, 0x57, 0x56, 0x01, 0x56, 0x0e, 0xfc,
-  0x01, 0xdb, 0x78, 0xe9, 0xc9, 0x02, 0x48, 0x46, 0x25, 0xb2, 0xae, 0xf4,
-  0xc2, 0xf4, 0x4a, 0xd4, 0x69, 0x5b, 0xd8, 0x74, 0xbb, 0x44, 0xd0, 0x0d,
-  0x75, 0xf1, 0x3e, 0x89, 0x7e, 0xf8, 0x03, 0x8d, 0x0c, 0x99, 0x22, 0xd8,
-  0x4c, 0x3a, 0xeb, 0x23, 0x01, 0x64, 0x3b, 0xfe, 0xf3, 0x21, 0x6c, 0xf2,
-  0x75, 0xff, 0xeb, 0xdb, 0x89, 0x76, 0xf8, 0x44, 0x4e, 0x43, 0xb6, 0x61,
-  0xf4, 0x08, 0x96, 0x31, 0x05, 0x5c, 0xd6, 0x01, 0xf8, 0x87, 0x08, 0x80,
-  0x7e, 0x6a, 0xe9, 0xd0, 0x01, 0x10, 0xd3, 0xa9, 0x42, 0xab, 0x48, 0x48,
-  0x66, 0xf2, 0x04, 0xfa, 0x3b, 0xeb, 0x6a, 0x52, 0x0a, 0xb4, 0x44, 0xb1,
-  0x08, 0xab, 0x85, 0x5c, 0x5b, 0xdc, 0x52, 0x9f, 0x15, 0x7b, 0xdf, 0x00,
-  0x33, 0x00, 0x92, 0x4c, 0x2f, 0xa1, 0xad, 0xd6, 0x3a, 0x14, 0x32, 0x2b,
-  0x6f, 0x15, 0x0a, 0xa0, 0xc3, 0x16, 0xe1, 0xc7, 0x47, 0x37, 0x3a, 0x46,
-  0x38, 0x16, 0xcd, 0x1c, 0x95, 0x4b, 0xbc, 0x18, 0x24, 0xed, 0x6c, 0x50,
-  0x09, 0x0a, 0xda, 0x8a, 0x11, 0x40, 0x80, 0x09, 0xac, 0x49, 0x34, 0x12,
-  0xf9, 0xa8, 0x0d, 0x6b, 0x45, 0x6a, 0x51, 0x08, 0xec, 0x8a, 0x3d, 0x05,
-  0x40, 0x74, 0xba, 0x12, 0x61, 0xc2, 0x39, 0xb6, 0xf9, 0x95, 0xb3, 0x7e,
-  0xf2, 0x82, 0x5d, 0x59, 0x7e, 0xfc, 0x3e, 0xdb, 0x49, 0xfb, 0x48, 0x06,
-  0xf8, 0xac, 0xb0, 0xfc, 0x15, 0x08, 0x3d, 0x06, 0x5b, 0x5c, 0x98, 0xfd,
-  0x06, 0xce, 0x06, 0x36, 0x07, 0x09, 0xb0, 0x90, 0x0f, 0x15, 0xf0, 0x76,
-  0x4b, 0x15, 0xfc, 0xa5, 0x50, 0xe1, 0x04, 0x6d, 0x16, 0xc0, 0xcd, 0x03,
-  0x01, 0x6d, 0x09, 0xd5, 0xcc, 0x03, 0x1f, 0x8f, 0x1d, 0x04, 0x61, 0x01,
-  0x60, 0x60, 0xff, 0x15, 0x96, 0xfe, 0xa4, 0xdf, 0x2b, 0x42, 0xe8, 0x1d,
-  0x20, 0x58, 0x33, 0x31, 0x0a, 0xe8, 0x8e, 0x48, 0xee, 0x51, 0x85, 0x96,
-  0xea, 0xc4, 0x1f, 0xdb, 0xed, 0x76, 0x06, 0x7a, 0x8b, 0x44, 0x06, 0x2a,
-  0xfd, 0x7d, 0xd8, 0x07, 0x19, 0xbc, 0x68, 0x48, 0xaa, 0xc0, 0x24, 0x86,
-  0xc8, 0x08, 0x18, 0x2a, 0xe5, 0x1b, 0x03, 0x3d, 0x85, 0x52, 0x88, 0x41,
-  0x32, 0xe3, 0xc1, 0x52, 0x56, 0x6f, 0x70, 0x80, 0xf8, 0xcf, 0x82, 0x74,
-  0x21, 0x01, 0xdf, 0x67, 0x40, 0x99, 0x26, 0xf7, 0x7f, 0x00, 0x03, 0x47,
-  0x0b, 0xfd, 0x9b, 0x79, 0x89, 0x68, 0x19, 0x43, 0x82, 0xc0, 0x28, 0xff,
-  0x50, 0x96, 0x06, 0xa4, 0xff, 0x0a, 0x64, 0xd1, 0x0f, 0xdd, 0x7d, 0x53,
-  0x1b, 0x48, 0xdf, 0x44, 0x8d, 0x2e, 0x95, 0x09, 0xd2, 0x05, 0x0b, 0x33,
-  0x11, 0x7b, 0x80, 0x4f, 0x08, 0x01, 0x10, 0xa4, 0x0d, 0x6c, 0x0f, 0x05,
-  0x64, 0x37, 0x67, 0x13, 0x04, 0xca, 0xe2, 0x0b, 0x4b, 0x3c, 0x3e, 0xbc,
-  0x40, 0x2f, 0x8f, 0x6d, 0xc7, 0x06, 0x68, 0x06, 0x27, 0x31, 0x0b, 0x9f,
-  0x0c, 0x99, 0x01, 0x0d, 0xe6, 0xb9, 0x52, 0xa2, 0xf0, 0xbb, 0x80, 0x00,
-  0x09, 0x64, 0x32, 0x3a, 0xfc, 0x0e, 0xeb, 0x2f, 0xeb, 0x2d, 0x41, 0xff,
-  0x74, 0x9a, 0x63, 0x00, 0x49, 0x0c, 0x10, 0x7e, 0x65, 0xeb, 0x21, 0x08,
-  0x90, 0x60, 0xa6, 0x74, 0x25, 0xb7, 0xe0, 0x88, 0x00, 0x1c, 0xb9, 0x26,
-  0x9b, 0x56, 0x66, 0xda, 0x79, 0x2e, 0x0c, 0x00, 0x88, 0x2a, 0xb4, 0xb4,
-  0x4b, 0x4a, 0x00, 0x1b, 0x0f, 0x74, 0x1a, 0x2f, 0xfe, 0x01, 0x3a, 0x00,
-  0x3c, 0x45, 0x59, 0x94, 0x52, 0xac, 0x83, 0xb7, 0x0d, 0x84, 0xe2, 0x9c,
-  0x59, 0x05, 0xf5, 0x0e, 0x65, 0xd7, 0x08, 0x95, 0x2b, 0x30, 0x3d, 0x28,
-  0xe8, 0xad, 0x04, 0xb2, 0x77, 0xe8, 0x8c, 0x0b, 0xd8, 0x36, 0x79, 0x10,
-  0x60, 0x13, 0x0f, 0x7b, 0x0d, 0x80, 0x21, 0x10, 0x95, 0x9e, 0x6c, 0xcc,
-  0x0a, 0x44, 0x25, 0x90, 0x34, 0x08, 0x95, 0x31, 0xa3, 0x95, 0xa9, 0x53,
-  0x2b, 0xe5, 0x39, 0xd3, 0x74, 0x49, 0xce, 0x49, 0x0c, 0x63, 0xe0, 0x09,
-  0x6c, 0xfe, 0xf8, 0x9d, 0x24, 0xeb, 0x2d, 0x11, 0x64, 0x0c, 0xaf, 0x0e,
-  0x52, 0x7a, 0x24, 0x96, 0xfa, 0x12, 0x45, 0xfe, 0x52, 0x10, 0x7f, 0xa4,
-  0x5e, 0x09, 0x8e, 0x2a, 0xf2, 0x3a, 0x02, 0x4c, 0x65, 0x80, 0x2a, 0xd0,
-  0x86, 0x48, 0x8f, 0x43, 0x26, 0x08, 0x86, 0x73, 0x1e, 0x3c, 0x2b, 0x34,
-  0x9b, 0x01, 0x93, 0xf0, 0x94, 0xfd, 0x13, 0x91, 0x70, 0x12, 0xeb, 0x0e,
-  0x48, 0x8c, 0x69, 0xa4, 0x5b, 0x01, 0xca, 0x04, 0x9c, 0x76, 0x20, 0x9f,
-  0x25, 0x02, 0xd2, 0xbc, 0x01, 0x01, 0x12, 0x76, 0x14, 0x70, 0xd1, 0x4f,
-  0x7b, 0x0c, 0x27, 0x86, 0x27, 0xd9, 0x27, 0xa2, 0x91, 0x01, 0x7d, 0x1f,
-  0xf7, 0x20, 0x93, 0x6d, 0xa8, 0x9a, 0x0a, 0x12, 0xb4, 0xe8, 0x15, 0x6c,
-  0xca, 0x14, 0x12, 0x61, 0x41, 0x75, 0x0c, 0xeb, 0xde, 0xcb, 0x0b, 0x59,
-  0xb9, 0x5d, 0xae, 0x62, 0xf2, 0x84, 0x51, 0x16, 0x22, 0x38, 0x5f, 0x2a,
-  0xc8, 0xae, 0x96, 0x29, 0x07, 0x32, 0x24, 0x48, 0xcd, 0xa6, 0x81, 0x59,
-  0xc8, 0x2e, 0x41, 0x8c, 0x9c, 0xac, 0x61, 0x1f, 0x0c, 0x08, 0xb2, 0xb6,
-  0x33, 0x07, 0x8a, 0x05, 0x9e, 0x47, 0x22, 0x8a, 0x97, 0x3f, 0xda, 0x22,
-  0xe2, 0xa3, 0xd8, 0x22, 0x93, 0xc2, 0x19, 0x24, 0xce, 0x02, 0x21, 0xc3,
-  0x2c, 0x60, 0x32, 0x58, 0x3b, 0xd5, 0xe3, 0x00, 0x09, 0x2d, 0xbe, 0x1d,
-  0x08, 0x77, 0x07, 0x8c, 0x54, 0x06, 0x62, 0x0a, 0x9d, 0xb5, 0xf6, 0x23,
-  0x3b, 0x4b, 0xec, 0x75, 0x15, 0xb9, 0xdd, 0xb6, 0x16, 0x40, 0x33, 0xb9,
-  0x77, 0x50, 0xdb, 0x1f, 0xa3, 0x00, 0x22, 0x01, 0x90, 0x06, 0x19, 0x1a,
-  0xe7, 0xd8, 0x92, 0x80, 0xed, 0x2b, 0x45, 0xb2, 0x50, 0x21, 0x62, 0x22,
-  0x09, 0x5d, 0xac, 0x64, 0xb8, 0x2c, 0x10, 0xcc, 0x3c, 0xba, 0x25, 0x98,
-  0xc9, 0x3e, 0x2b, 0x50, 0x29, 0xb7, 0x36, 0x9d, 0x5c, 0x28, 0x20, 0x49,
-  0x71, 0x1e, 0x1f, 0x7b, 0x07, 0x15, 0x0d, 0x0a, 0x04, 0xf1, 0xeb, 0x07,
-  0xeb, 0x73, 0x1d, 0x54, 0x70, 0x1f, 0xf2, 0x6b, 0xc0, 0xeb, 0x67, 0xad,
-  0x9e, 0xab, 0x55, 0x6b, 0x3e, 0x2e, 0x03, 0xed, 0x16, 0xeb, 0x2e, 0x15,
-  0x68, 0x9e, 0x3e, 0xaa, 0x18, 0x01, 0xa1, 0x14, 0xfe, 0x13, 0x74, 0x20,
-  0xeb, 0xda, 0xc9, 0x0b, 0xb0, 0x14, 0x2f, 0x37, 0xce, 0x29, 0x53, 0xeb,
-  0x1e, 0xfc, 0x39, 0x0e, 0x94, 0x22, 0xdb, 0xce, 0xca, 0x26, 0x71, 0x18,
-  0xc2, 0x29, 0x49, 0x3f, 0x07, 0x02, 0x08, 0x02, 0xb5, 0x09, 0x83, 0x46,
-  0x9a, 0xef, 0x23, 0x01, 0x01, 0xcf, 0x48, 0x02, 0x69, 0xa5, 0x02, 0x76,
-  0x18, 0x16, 0x43, 0xb0, 0xc6, 0xb2, 0x50, 0xba, 0x18, 0xba, 0x66, 0x40,
-  0x8a, 0x60, 0xd4, 0x59, 0xad, 0x89, 0xa8, 0x05, 0x98, 0x89, 0x6c, 0x9f,
-  0x82, 0x08, 0x63, 0xcb, 0xb0, 0xb0, 0xdb, 0x30, 0xc4, 0x4e, 0xbb, 0xca,
-  0x2f, 0x97, 0x0e, 0x38, 0x28, 0x4c, 0x66, 0x23, 0x67, 0x2c, 0x11, 0xe9,
-  0x49, 0xe6, 0x0b, 0x91, 0x12, 0x91, 0x14, 0x99, 0x0e, 0x4a, 0x22, 0x90,
-  0xe3, 0xe2, 0xd7, 0x9e, 0x5f, 0x09, 0x4e, 0x8f, 0x4e, 0xbf, 0x4f, 0xf2,
-  0x00, 0x23, 0x65, 0x21, 0xa4, 0xdc, 0xed, 0x10, 0x08, 0x10, 0x5b, 0xf3,
-  0x36, 0x9a, 0xd6, 0x38, 0x08, 0xd1, 0xfb, 0x3b, 0xe7, 0x06, 0x42, 0xec,
-  0x0b, 0x0c, 0xb0, 0x06, 0x06, 0x4c, 0xb3, 0xd6, 0x6a, 0x11, 0xee, 0x05,
-  0x07, 0x0e, 0x89, 0x08, 0xb2, 0x2a, 0xd0, 0x65, 0x06, 0xaa, 0x55, 0x5b,
-  0x81, 0x15, 0x20, 0x59, 0xb1, 0x14, 0xa4, 0x12, 0xc2, 0xc7, 0x1c, 0xf8,
-  0xd0, 0x08, 0x4c, 0x1b, 0x06, 0xea, 0xb9, 0x1a, 0x0e, 0xe9, 0x85, 0x1b,
-  0x57, 0x28, 0x04, 0xc7, 0x98, 0x0c, 0x82, 0xe6, 0x4e, 0x3f, 0x6f, 0x9d,
-  0xf6, 0x3b, 0xc6, 0x7e, 0x0c, 0x27, 0x1f, 0x3b, 0xc7, 0x7c, 0xaa, 0xcc,
-  0xb6, 0x3a, 0x1b, 0xf7, 0x46, 0x1d, 0x32, 0x39, 0x39, 0x10, 0x98, 0x97,
-  0x1b, 0x95, 0x0a, 0x96, 0x1f, 0x3b, 0x57, 0x02, 0x0f, 0xe8, 0x03, 0xdf,
-  0xd0, 0xc2, 0xfe, 0x3b, 0xc2, 0xdb, 0x7e, 0x0f, 0x19, 0x07, 0x12, 0x5c,
-  0x1c, 0x10, 0xec, 0x5d, 0x20, 0x41, 0x8e, 0xa5, 0x3f, 0x00, 0xf9, 0x43,
-  0x0f, 0x0f, 0xcc, 0xfe, 0x20, 0x76, 0x56, 0x44, 0x04, 0x3b, 0x7f, 0x02,
-  0x45, 0x60, 0x41, 0xa5, 0x1f, 0x76, 0xf6, 0x04, 0x07, 0x1f, 0xb6, 0x50,
-  0x8e, 0x68, 0x19, 0x48, 0x34, 0xd8, 0xc6, 0xe1, 0x4f, 0x02, 0x19, 0x08,
-  0xf6, 0xeb, 0x0c, 0xc7, 0x1c, 0x3e, 0xd6, 0x5e, 0x84, 0x14, 0x68, 0xc1,
-  0x98, 0x0b, 0x92, 0xfd, 0xb6, 0xff, 0x81, 0x39, 0x5d, 0x7d, 0x66, 0x9b,
-  0x4e, 0x88, 0x10, 0x9e, 0x3c, 0xf8, 0x50, 0xc0, 0xa2, 0xfd, 0x40, 0x5a,
-  0x3b, 0xd0, 0xae, 0xb4, 0x1e, 0xb2, 0x06, 0xb4, 0xa6, 0x47, 0x40, 0x07,
-  0x2b, 0xfe, 0x20, 0x71, 0x0c, 0x90, 0x73, 0xb0, 0xa4, 0x59, 0xb5, 0x76,
-  0xf4, 0x10, 0xcb, 0xf6, 0xf4, 0x1d, 0xd7, 0xf4, 0x6c, 0x7e, 0x05, 0x87,
-  0xf6, 0x24, 0x60, 0x4c, 0x15, 0x52, 0x75, 0xf2, 0x2b, 0x47, 0x06, 0xad,
-  0x8e, 0x9a, 0xe0, 0x47, 0xe6, 0x38, 0x34, 0xd1, 0x07, 0x1b, 0xb1, 0x22,
-  0x10, 0x53, 0x41, 0x25, 0xdb, 0xd0, 0x75, 0x2f, 0xb3, 0xee, 0xe0, 0x22,
-  0x32, 0xd4, 0x3f, 0x2b, 0x16, 0xdc, 0x22, 0xf5, 0x1b, 0x06, 0xde, 0x22,
-  0xb8, 0xf5, 0x7f, 0x12, 0x88, 0x37, 0x9c, 0xfa, 0x0f, 0xd7, 0x73, 0x0b,
-  0xf3, 0xee, 0x56, 0xc7, 0x3a, 0xc6, 0xff, 0xff, 0x5d, 0x1c, 0xf4, 0x98,
-  0xeb, 0xc9, 0x1f, 0x47, 0xe4, 0x01, 0xed, 0xa3, 0x3a, 0xca, 0x89, 0x16,
-  0xce, 0x6b, 0xa3, 0xd4, 0x2f, 0xa8, 0x77, 0x78, 0x8a, 0xf4, 0x42, 0x09,
-  0x31, 0x00, 0x25, 0xd6, 0xb3, 0xff, 0x18, 0x3a, 0x05, 0xb4, 0x5a, 0x33,
-  0x08, 0x48, 0x25, 0xcd, 0x85, 0x28, 0x93, 0xf4, 0x7c, 0xf3, 0x04, 0x51,
-  0xc2, 0xbe, 0x0c, 0xa4, 0x7f, 0x5b, 0xf7, 0xfb, 0xf7, 0x6e, 0xf4, 0x10,
-  0x67, 0xa2, 0xf0, 0x0f, 0xf0, 0x53, 0x74, 0x3c, 0x5b, 0x26, 0x39, 0xf0,
-  0x49, 0x94, 0xb8, 0xbc, 0x44, 0x7a, 0x0e, 0x01, 0xf1, 0x34, 0xac, 0xa2,
-  0x11, 0x9b, 0x3b, 0x63, 0x77, 0x7f, 0x1c, 0x33, 0x89, 0x28, 0x68, 0x7d,
-  0x41, 0xa1, 0x49, 0x54, 0xdf, 0x07, 0x1c, 0xc6, 0xd8, 0x7d, 0x10, 0x5e,
-  0xa6, 0xd2, 0xbe, 0x2b, 0x60, 0x89, 0x5f, 0x3b, 0xf7, 0x7d, 0x0e, 0x78,
-  0x20, 0x08, 0x60, 0xe5, 0xfb, 0x07, 0xeb, 0x45, 0x35, 0x07, 0x8b, 0xd6,
-  0xf6, 0x2b, 0xd7, 0x03, 0xc2, 0x52, 0x0c, 0x10, 0x40, 0x4c, 0x0a, 0xfb,
-  0x26, 0x89, 0x34, 0x92, 0x12, 0x80, 0xa3, 0x49, 0xc0, 0x6b, 0x49, 0xc7,
-  0x9e, 0x74, 0xcd, 0x18, 0x84, 0x56, 0x84, 0x00, 0xe5, 0x3b, 0x8c, 0x74,
-  0x46, 0x9c, 0x4c, 0xfb, 0x7a, 0xa9, 0xca, 0x3e, 0xb4, 0x81, 0x17, 0x5a,
-  0x48, 0x95, 0x18, 0x18, 0xa0, 0x76, 0x5d, 0x50, 0x04, 0x0c, 0x14, 0x84,
-  0xc0, 0x74, 0xe0, 0x94, 0x09, 0x9f, 0x64, 0x18, 0x40, 0x16, 0x32, 0x0d,
-  0x0e, 0x44, 0x8f, 0x8e, 0x5c, 0x03, 0x25, 0x92, 0x0a, 0x14, 0x0a, 0xb2,
-  0x0a, 0x24, 0xc1, 0x39, 0x12, 0x60, 0x14, 0xec, 0x1b, 0x0e, 0x00, 0xfc,
-  0x16, 0x47, 0x01, 0xd7, 0x18, 0x09, 0x67, 0x1a, 0xcc, 0x9b, 0x1c, 0x1e,
-  0x81, 0x9a, 0x02, 0x20, 0x6e, 0x22, 0x81, 0x03, 0x69, 0x24, 0xb9, 0x2a,
-  0x0d, 0x00, 0xa6, 0x2c, 0xe6, 0x2e, 0xe4, 0x04, 0xa3, 0x30, 0x3a, 0xb9,
-  0x32, 0x35, 0x05, 0xa4, 0x34, 0xa1, 0x8c, 0x0c, 0xb0, 0x08, 0x51, 0x52,
-  0x03, 0x29, 0xc1, 0x25, 0x04, 0x21, 0x66, 0x6c, 0x4e, 0x91, 0x05, 0x76,
-  0x6e, 0xe4, 0x22, 0x46, 0x8a, 0x34, 0xc4, 0x11, 0x5c, 0x0d, 0x13, 0x00,
-  0x04, 0xa2, 0x6e, 0x8b, 0xf3, 0x24, 0x12, 0x65, 0x61, 0x17, 0x31, 0x05,
-  0x61, 0x4f, 0x86, 0x03, 0x41, 0x65, 0xa6, 0x81, 0xe8, 0x62, 0xfd, 0x0f,
-  0x24, 0x3b, 0xad, 0x28, 0xb4, 0x60, 0xff, 0xa4, 0xc8, 0xde, 0x06, 0xfa,
-  0x33, 0x07, 0x13, 0x50, 0xa0, 0xf4, 0x8e, 0x05, 0x88, 0x03, 0x83, 0x59,
-  0xd0, 0x87, 0x4f, 0x03, 0x15, 0x75, 0x30, 0x0a, 0x08, 0x55, 0x63, 0x9c,
-  0x70, 0x25, 0xff, 0x08, 0xf5, 0x0d, 0x0c, 0x16, 0xa2, 0xb2, 0x86, 0x0b,
-  0x52, 0x91, 0x1d, 0x0c, 0x8d, 0x86, 0x37, 0x94, 0x85, 0xb6, 0x82, 0x00,
-  0x49, 0xb0, 0xc6, 0x81, 0x9c, 0xa3, 0xfe, 0xc0, 0x43, 0x72, 0x9b, 0x47,
-  0x50, 0x56, 0x42, 0x81, 0x07, 0x36, 0x18, 0x7f, 0x4b, 0x9c, 0x2a, 0x98,
-  0x06, 0x48, 0x23, 0x06, 0x01, 0xf4, 0xa1, 0x94, 0x02, 0xd1, 0x1c, 0x1a,
-  0xe7, 0x90, 0x08, 0x8f, 0x86, 0x05, 0x9a, 0x66, 0x14, 0x42, 0x99, 0x04,
-  0x85, 0x47, 0x12, 0xe4, 0x04, 0x00, 0x1c, 0xb2, 0x00, 0x83, 0x35, 0xba,
-  0x01, 0x09, 0x12, 0x6c, 0x14, 0xd6, 0xf7, 0x16, 0x13, 0x48, 0x18, 0xc6,
-  0x1a, 0x9b, 0xc9, 0x0a, 0x3e, 0x37, 0x00, 0x16, 0x13, 0x55, 0x48, 0x7c,
-  0x05, 0x80, 0x0d, 0xf0, 0xd5, 0x22, 0x50, 0x20, 0x79, 0x18, 0x1a, 0x8c,
-  0x3d, 0x8d, 0xb9, 0x14, 0xb9, 0x16, 0x02, 0x02, 0x51, 0xaa, 0xbf, 0x68,
-  0x18, 0x27, 0x09, 0x30, 0x01, 0x6a, 0xff, 0xb2, 0x41, 0xb0, 0x55, 0x61,
-  0xa3, 0x88, 0x40, 0xa7, 0x99, 0x0a, 0xe7, 0x0c, 0x9e, 0x0e, 0x10, 0x43,
-  0x46, 0x2f, 0xc9, 0x29, 0xe8, 0xe9, 0x05, 0xe9, 0x37, 0xeb, 0xa7, 0x05,
-  0x49, 0xc7, 0x43, 0x08, 0x25, 0x58, 0x85, 0x25, 0x42, 0x59, 0x07, 0x06,
-  0x53, 0x99, 0x30, 0x0f, 0x3a, 0x0e, 0x40, 0xc6, 0x60, 0x0e, 0xc0, 0xc8,
-  0xae, 0x40, 0xac, 0xb6, 0xb9, 0x0a, 0x85, 0x57, 0x0d, 0xe0, 0x77, 0x01,
-  0xcb, 0x87, 0x6e, 0x06, 0x17, 0x4a, 0x0d, 0xc8, 0xe0, 0xd1, 0xe0, 0x50,
-  0xaa, 0xcc, 0xc5, 0x15, 0x49, 0x8c, 0xe3, 0xf4, 0x0b, 0x75, 0x40, 0x2e,
-  0x66, 0x36, 0x01, 0xac, 0xe5, 0x2c, 0x02, 0x9d, 0x15, 0xa0, 0x30, 0xd3,
-  0xc4, 0xd0, 0x38, 0xf4, 0x08, 0x1b, 0x11, 0x8c, 0xa2, 0x31, 0x56, 0xde,
-  0x0b, 0x3e, 0x02, 0x60, 0xfd, 0x12, 0x5a, 0x8c, 0x55, 0x80, 0x83, 0xb3,
-  0x42, 0x10, 0x02, 0xe1, 0x5b, 0x28, 0x9b, 0xd6, 0xf2, 0x63, 0xf2, 0x77,
-  0x06, 0xdd, 0x76, 0x3f, 0xff, 0x5b, 0x6a, 0xe4, 0x01, 0xe0, 0xc7, 0xa0,
-  0xe0, 0x91, 0x9a, 0x35, 0x55, 0xe0, 0x23, 0xe2, 0x07, 0x06, 0x46, 0x06,
-  0x1c, 0x90, 0x15, 0x5f, 0x9d, 0xf2, 0x1e, 0xfa, 0xf9, 0x4e, 0x89, 0x51,
-  0x4a, 0x86, 0x24, 0x42, 0xd9, 0x26, 0x21, 0xa7, 0xb0, 0xeb, 0x17, 0x8d,
-  0xb2, 0x07, 0xd6, 0x48, 0x50, 0x3e, 0x12, 0x2c, 0x8b, 0x25, 0x48, 0x0a,
-  0x14, 0xc2, 0x7f, 0xb1, 0xc8, 0x47, 0x5a, 0x98, 0x65, 0x21, 0xb3, 0x5c,
-  0x04, 0x80, 0x17, 0xfd, 0x24, 0x21, 0xc4, 0x2e, 0x06, 0x10, 0xb4, 0x09,
-  0xb2, 0xfe, 0x3f, 0x04, 0x25, 0xb7, 0x58, 0x4b, 0xad, 0x57, 0x06, 0x04,
-  0x9c, 0x24, 0x25, 0x91, 0x21, 0x87, 0x14, 0x90, 0x29, 0x84, 0x81, 0x19,
-  0x0f, 0x29, 0x0e, 0x80, 0x82, 0x90, 0xd6, 0x0b, 0x65, 0x10, 0x62, 0xc0,
-  0x40, 0x89, 0x91, 0x01, 0xc8, 0x1d, 0x02, 0x78, 0x5a, 0x00, 0xba, 0x36,
-  0x1c, 0x79, 0x9e, 0x26, 0x0c, 0x49, 0xc8, 0xb5, 0x03, 0x79, 0xc6, 0x03,
-  0xd0, 0xb2, 0xf7, 0x0a, 0x22, 0x32, 0x79, 0x03, 0x84, 0x8b, 0x9e, 0xd0,
-  0x5d, 0xf9, 0xcb, 0x01, 0x1c, 0xa2, 0x01, 0x9f, 0x08, 0x36, 0x3d, 0x1e,
-  0x9a, 0xe5, 0xfa, 0x3a, 0x40, 0x30, 0xe5, 0x90, 0x65, 0xef, 0xa1, 0xbf,
-  0x0a, 0x37, 0x42, 0x2b, 0x55, 0x16, 0x56, 0xde, 0x49, 0x05, 0xc0, 0xa5,
-  0x5a, 0x07, 0x30, 0x7a, 0x27, 0x7a, 0x05, 0x68, 0x7d, 0x3e, 0xd3, 0xf0,
-  0x00, 0x9b, 0x99, 0x25, 0x56, 0x01, 0x48, 0x6b, 0x81, 0x42, 0x24, 0x6c,
-  0x99, 0x03, 0x05, 0x35, 0xce, 0x06, 0x48, 0x1e, 0x60, 0x09, 0xf8, 0x04,
-  0x09, 0x41, 0x32, 0x0a, 0x01, 0x62, 0xb3, 0x70, 0x4b, 0x54, 0x38, 0x8c,
-  0x02, 0x25, 0x68, 0xf6, 0x9a, 0x15, 0xbd, 0x80, 0x31, 0xe8, 0x93, 0xf6,
-  0xd1, 0x19, 0x02, 0x33, 0x19, 0x3c, 0xc2, 0x19, 0x12, 0xd5, 0x99, 0x26,
-  0xcb, 0xed, 0x3c, 0xfb, 0x01, 0x80, 0x1d, 0x80, 0x65, 0xfb, 0x2a, 0x6e,
-  0xf5, 0x65, 0x66, 0x27, 0xcc, 0x32, 0x26, 0x87, 0x02, 0xc6, 0x20, 0xf8,
-  0x6b, 0x10, 0x32, 0x2d, 0xf8, 0x11, 0x01, 0x07, 0x4b, 0x67, 0x65, 0xde,
-  0xf5, 0xe9, 0xa1, 0x01, 0x9b, 0x23, 0xa2, 0xf6, 0x95, 0x01, 0x32, 0x17,
-  0x3b, 0xec, 0x07, 0x7d, 0x12, 0x11, 0x2f, 0x29, 0x07, 0xfd, 0xeb, 0xb9,
-  0xeb, 0x0e, 0xeb, 0xb5, 0x97, 0x33, 0x61, 0x84, 0x01, 0x21, 0x3d, 0xeb,
-  0x9f, 0x90, 0xc1, 0x7b, 0x39, 0x01, 0x93, 0xbb, 0xe9, 0x7b, 0xff, 0x23,
-  0x01, 0x08, 0xb4, 0x3b, 0xe7, 0x05, 0xb8, 0xc5, 0x15, 0xf8, 0xbf, 0x74,
-  0x2d, 0x1e, 0x9e, 0x8b, 0x4b, 0x05, 0xd5, 0x81, 0xd6, 0x6c, 0x57, 0x17,
-  0x15, 0x2a, 0xa9, 0xc3, 0x0b, 0x51, 0x36, 0x99, 0xfc, 0x04, 0x1f, 0xba,
-  0x08, 0x83, 0xe5, 0x3e, 0xee, 0x22, 0xed, 0x63, 0x39, 0x36, 0x06, 0xd5,
-  0x74, 0x5d, 0x83, 0x74, 0x06, 0x6e, 0x0b, 0x7f, 0x51, 0xe0, 0x45, 0x80,
-  0x24, 0x6f, 0x1c, 0xc5, 0x7e, 0x34, 0x81, 0xf8, 0xb2, 0x64, 0x6d, 0x16,
-  0x19, 0x64, 0x66, 0x77, 0xff, 0x56, 0x30, 0x69, 0xee, 0x89, 0x0b, 0xd9,
-  0xeb, 0x77, 0xbb, 0x5e, 0x52, 0x06, 0x46, 0xf8, 0x3f, 0x42, 0x58, 0x57,
-  0x25, 0x0e, 0xeb, 0x36, 0x02, 0x37, 0x2b, 0x94, 0x0c, 0x6a, 0x2d, 0x57,
-  0xe2, 0x06, 0xfc, 0xf0, 0x3b, 0xfe, 0x74, 0x20, 0x65, 0x76, 0x1b, 0x18,
-  0x76, 0xeb, 0x2c, 0x76, 0x69, 0x32, 0x2a, 0xc0, 0x64, 0xab, 0xea, 0x09,
-  0x00, 0x16, 0xb6, 0x47, 0x80, 0x9f, 0xde, 0x51, 0x00, 0xff, 0x68, 0x58,
-  0x02, 0x14, 0x03, 0x1e, 0x02, 0xea, 0xfe, 0x01, 0x34, 0x02, 0x72, 0x01,
-  0x55, 0x03, 0x8b, 0x03, 0xe4, 0x04, 0x03, 0x84, 0x28, 0x7d, 0x84, 0x1a,
-  0xc3, 0x90, 0x2c, 0xc7, 0xba, 0x2a, 0x18, 0xb8, 0x38, 0x0d, 0x8c, 0x26,
-  0x87, 0x7f, 0xca, 0x48, 0x13, 0x50, 0xb9, 0xeb, 0x9a, 0xc6, 0x60, 0x0c,
-  0x11, 0x2d, 0x7c, 0x02, 0x14, 0x2e, 0xd8, 0xac, 0x00, 0x09, 0x1b, 0x0a,
-  0x64, 0xf6, 0xc2, 0xa3, 0xb2, 0x74, 0x55, 0x98, 0x44, 0x7c, 0x40, 0x7d,
-  0x0a, 0x24, 0x5c, 0xe2, 0x2d, 0x56, 0x64, 0x49, 0x80, 0x06, 0xc2, 0x13,
-  0x36, 0x53, 0xeb, 0xb7, 0x04, 0x21, 0x2b, 0xc6, 0x4f, 0x0b, 0x89, 0x21,
-  0x28, 0xdc, 0xdc, 0xea, 0xfe, 0x38, 0x72, 0x40, 0x66, 0x8c, 0x11, 0x60,
-  0x25, 0x20, 0x60, 0x98, 0x0d, 0xb1, 0x85, 0x93, 0x00, 0xe5, 0x26, 0x1c,
-  0x01, 0x81, 0x28, 0xe0, 0x08, 0x45, 0x58, 0x33, 0xa9, 0x1e, 0x3f, 0xd7,
-  0x03, 0x05, 0x0b, 0x20, 0x08, 0x1f, 0xbe, 0x30, 0x04, 0x38, 0xac, 0x42,
-  0x63, 0x06, 0x10, 0x54, 0xe3, 0x23, 0x14, 0x5d, 0x66, 0x0a, 0x9e, 0x03,
-  0x0c, 0xec, 0x09, 0x0e, 0x33, 0xf0, 0x10, 0x25, 0xbb, 0x0c, 0x06, 0x40,
-  0x27, 0xda, 0x2e, 0x90, 0x23, 0xd5, 0x06, 0x6c, 0x75, 0xfb, 0x41, 0x97,
-  0x69, 0xd5, 0x91, 0x04, 0x0b, 0x44, 0xed, 0xf5, 0x0b, 0xb8, 0xa8, 0x0b,
-  0x46, 0xe6, 0xd5, 0x03, 0x06, 0x55, 0x1b, 0x0e, 0xf5, 0x02, 0x04, 0x41,
-  0x83, 0x55, 0x9a, 0xaa, 0x34, 0x55, 0xad, 0x13, 0xcd, 0xcc, 0x07, 0xa9,
-  0xbc, 0xdc, 0x36, 0xd1, 0x0a, 0x43, 0xf0, 0x80, 0x8c, 0x24, 0x1b, 0x01,
-  0x1f, 0xb3, 0x29, 0x00, 0xfa, 0x1e, 0x00, 0xe9, 0x24, 0xa0, 0xc9, 0xc0,
-  0x6e, 0x87, 0x26, 0x69, 0x28, 0xda, 0x7a, 0x05, 0xa0, 0xc7, 0x93, 0x26,
-  0x69, 0x20, 0xb6, 0x9f, 0x44, 0x54, 0x41, 0x9a, 0xfc, 0x5d, 0x73, 0x2c,
-  0x23, 0xbe, 0x03, 0x2a, 0x23, 0x9a, 0x7b, 0x35, 0xa9, 0xc0, 0x0e, 0x23,
-  0x17, 0x7e, 0x93, 0x07, 0x9a, 0x0a, 0x04, 0xd5, 0x86, 0x41, 0x83, 0xf8,
-  0xae, 0x6b, 0xc1, 0x99, 0x74, 0x9d, 0x24, 0x42, 0x4b, 0xd3, 0x15, 0x4c,
-  0x3f, 0x08, 0x75, 0x0c, 0xf9, 0x9a, 0x55, 0x01, 0x42, 0x07, 0x50, 0x53,
-  0xd0, 0xaa, 0x0f, 0xe0, 0xb7, 0x0a, 0x14, 0x1f, 0x9a, 0xf3, 0x6f, 0x02,
-  0xf2, 0x0b, 0x7b, 0x0b, 0x9a, 0x4d, 0x03, 0x3e, 0xff, 0x74, 0x60, 0xeb,
-  0x71, 0x9a, 0xde, 0xb1, 0x02, 0x0a, 0xea, 0x55, 0xeb, 0x66, 0x89, 0x08,
-  0x3f, 0x28, 0x04, 0x55, 0x08, 0x54, 0x49, 0x14, 0x0c, 0x18, 0x40, 0x61,
-  0xe7, 0xb7, 0x99, 0x05, 0x24, 0x2d, 0x26, 0x14, 0x28, 0x46, 0x80, 0x9b,
-  0x50, 0x32, 0x9a, 0xb2, 0xf1, 0x52, 0x1e, 0x0d, 0xeb, 0x1e, 0x43, 0x56,
-  0x31, 0xc7, 0x13, 0xd7, 0x82, 0x0f, 0x87, 0xed, 0x9a, 0x9b, 0x01, 0x13,
-  0x04, 0x1e, 0x32, 0x00, 0x4b, 0xc7, 0x15, 0x02, 0x82, 0x2e, 0xc1, 0xa0,
-  0xf6, 0xad, 0xb2, 0xdb, 0x74, 0x2c, 0x5a, 0x28, 0x82, 0x24, 0x0c, 0x85,
-  0xae, 0x55, 0xca, 0x14, 0xd2, 0x97, 0xa2, 0x04, 0x46, 0x04, 0x04, 0x96,
-  0xca, 0x88, 0x1c, 0x35, 0x2f, 0x03, 0xbb, 0xae, 0x02, 0x44, 0x08, 0x35,
-  0x1c, 0x8d, 0xd6, 0x18, 0xa2, 0x1a, 0x8a, 0xff, 0xe4, 0x88, 0xeb, 0x86,
-  0x9a, 0xab, 0x93, 0xef, 0x7f, 0x05, 0xe9, 0x7e, 0xff, 0x9a, 0x8b, 0xdb,
-  0x01, 0x8f, 0x07, 0x76, 0xbe, 0xff, 0x16, 0x6d, 0xc5, 0xbc, 0x2e, 0x58,
-  0xe9, 0x67, 0xd0, 0x16, 0x2b, 0xc6, 0xda, 0x76, 0xe9, 0x5f, 0x07, 0xcf,
-  0xe6, 0x57, 0x80, 0xff, 0x1e, 0x90, 0x0f, 0x4e, 0x03, 0x40, 0xec, 0x07,
-  0x35, 0x10, 0x11, 0x86, 0x07, 0xfb, 0x07, 0x3f, 0x22, 0x09, 0xb3, 0x08,
-  0x65, 0x1b, 0x9e, 0xe9, 0xa2, 0x0d, 0x0c, 0x55, 0x94, 0x15, 0xfa, 0xc0,
-  0x03, 0xff, 0x4d, 0x3c, 0x05, 0x63, 0x91, 0x03, 0x41, 0x5c, 0x93, 0x17,
-  0x7c, 0x26, 0x00, 0xb5, 0x2d, 0xb3, 0x05, 0x7d, 0x93, 0x44, 0x6d, 0xa2,
-  0x4e, 0x8b, 0x01, 0x07, 0x7f, 0x3e, 0x02, 0x1f, 0x02, 0x2f, 0x02, 0xfb,
-  0x27, 0x02, 0x0f, 0x02, 0x46, 0x0d, 0x83, 0x42, 0x0d, 0x48, 0xea, 0x01,
-  0x57, 0x05, 0x8b, 0x18, 0xf9, 0x09, 0x77, 0x47, 0xf0, 0x39, 0x03, 0x87,
-  0xe4, 0xe3, 0x61, 0xee, 0xe6, 0xda, 0xb8, 0xec, 0x2b, 0xeb, 0xf9, 0x80,
-  0x76, 0xeb, 0xcc, 0xf5, 0x3b, 0xeb, 0xc5, 0xdd, 0x1d, 0xeb, 0xbe, 0x8e,
-  0xdc, 0xeb, 0xb7, 0xc3, 0x2b, 0xe0, 0xae, 0xeb, 0xd2, 0x1b, 0xbd, 0x2a,
-  0x03, 0xfb, 0x35, 0x03, 0xf5, 0x02, 0x23, 0x05, 0xb9, 0x1c, 0x03, 0x15,
-  0xbd, 0x0e, 0x03, 0x0c, 0x03, 0x11, 0x23, 0x95, 0x79, 0xa2, 0x24, 0x84,
-  0x0d, 0x0d, 0x40, 0x2b, 0x8d, 0x3e, 0x56, 0x74, 0xaa, 0x2c, 0x3a, 0x11,
-  0xb4, 0x76, 0x80, 0xca, 0x04, 0x8b, 0x2e, 0xc4, 0xbb, 0x11, 0x9a, 0x45,
-  0x14, 0x30, 0x57, 0x7c, 0x80, 0x26, 0xbd, 0x74, 0x3a, 0x01, 0x96, 0x80,
-  0x51, 0xc7, 0xbe, 0x29, 0x59, 0x01, 0xdd, 0x06, 0x1c, 0x3f, 0x50, 0x5e,
-  0xa1, 0xe6, 0x32, 0x3e, 0x5f, 0xca, 0xeb, 0xc8, 0x01, 0x5e, 0x70, 0x0a,
-  0x1d, 0x07, 0x33, 0x50, 0x33, 0x0f, 0x05, 0x9a, 0xda, 0x46, 0x05, 0x72,
-  0x08, 0xb0, 0x6d, 0x43, 0x49, 0x26, 0x6e, 0x63, 0x35, 0x24, 0x4c, 0xaa,
-  0x05, 0x8c, 0xdb, 0x01, 0xde, 0x83, 0x4e, 0x4f, 0x5d, 0x1c, 0x32, 0x21,
-  0x90, 0xca, 0x22, 0x10, 0x8c, 0xba, 0x32, 0x4b, 0xfa, 0x54, 0x59, 0xa4,
-  0x4d, 0x1b, 0x8b, 0x24, 0xa8, 0xc4, 0x22, 0xa2, 0x30, 0xea, 0xd5, 0x16,
-  0xa8, 0x13, 0x9a, 0xa6, 0x6d, 0xcc, 0xfb, 0xa3, 0x4e, 0x69, 0x9a, 0x4f,
-  0x07, 0xe5, 0x52, 0x9f, 0x3b, 0x50, 0x69, 0x62, 0x1c, 0x95, 0xac, 0xd4,
-  0x10, 0x59, 0xed, 0xed, 0x09, 0x6a, 0x12, 0x4c, 0xf7, 0x4a, 0x96, 0xdb,
-  0x2c, 0x1c, 0xe2, 0x5f, 0x06, 0x2b, 0xcf, 0x74, 0x07, 0x32, 0xa2, 0x75,
-  0x95, 0xe1, 0xcb, 0x41, 0x36, 0x15, 0x45, 0x91, 0xfd, 0x3f, 0xac, 0x24,
-  0x8b, 0x87, 0xaa, 0x90, 0x24, 0xa6, 0xd0, 0xed, 0x1f, 0xce, 0x24, 0x51,
-  0x7f, 0xfd, 0x18, 0x2a, 0x5e, 0x11, 0x18, 0xc3, 0x5e, 0x52, 0x25, 0x43,
-  0x5b, 0x55, 0x2c, 0x90, 0x2a, 0xd5, 0x46, 0x84, 0x1c, 0x30, 0x51, 0x3c,
-  0x24, 0x3d, 0x2e, 0x61, 0x74, 0x26, 0xce, 0x09, 0x08, 0x8a, 0xd4, 0xb4,
-  0x80, 0xee, 0xe4, 0x42, 0x2a, 0x95, 0xf8, 0x6c, 0xa7, 0x00, 0x0a, 0xc0,
-  0xec, 0x3e, 0x9a, 0x60, 0x01, 0xb7, 0xc3, 0xc7, 0x06, 0xc3, 0x54, 0x69,
-  0x53, 0x2a, 0x8c, 0x63, 0xea, 0x33, 0xc5, 0x7f, 0x92, 0x49, 0x00, 0x37,
-  0x77, 0xff, 0x52, 0x64, 0x4a, 0xb1, 0xea, 0x58, 0xa8, 0xbc, 0xd3, 0x44,
-  0xcb, 0x2f, 0x2d, 0x78, 0xa0, 0xeb, 0x49, 0x57, 0x18, 0x41, 0x6a, 0x75,
-  0x3d, 0xa3, 0x96, 0x06, 0x34, 0xc8, 0x42, 0xf2, 0xd8, 0xfe, 0x57, 0x0d,
-  0x24, 0xa5, 0x4b, 0xc2, 0x5c, 0xff, 0x05, 0xb1, 0x33, 0x58, 0x65, 0x0d,
-  0x62, 0x40, 0x22, 0xca, 0x37, 0xc1, 0xdd, 0x05, 0x12, 0x04, 0x30, 0x11,
-  0x05, 0x2e, 0x6f, 0x98, 0x50, 0xd9, 0x04, 0xfe, 0x54, 0x42, 0x2d, 0x61,
-  0x29, 0xa6, 0x9e, 0x9a, 0x56, 0x14, 0x4d, 0x44, 0xad, 0xe4, 0x4e, 0x86,
-  0x07, 0x4f, 0xc2, 0xbb, 0x2a, 0x56, 0x3d, 0xc5, 0x2a, 0x52, 0x88, 0x31,
-  0x29, 0x0a, 0xb5, 0x8d, 0x56, 0x6d, 0x4a, 0xc2, 0x2c, 0x73, 0x36, 0x42,
-  0x41, 0xcd, 0x36, 0x83, 0xa8, 0x2a, 0x9a, 0xa0, 0xb2, 0x41, 0xb3, 0x10,
-  0x0c, 0x09, 0x65, 0xb2, 0x84, 0x74, 0x4e, 0x56, 0x43, 0x89, 0x8a, 0x0f,
-  0x9a, 0xa1, 0x3c, 0x17, 0x61, 0x0f, 0x7e, 0x24, 0x40, 0x20, 0x14, 0xd9,
-  0x56, 0xa5, 0xf7, 0x09, 0x06, 0x20, 0xdb, 0x27, 0x13, 0x82, 0x1f, 0x89,
-  0xc1, 0xd1, 0x17, 0xfc, 0x6d, 0x88, 0x24, 0x03, 0xc1, 0x86, 0x24, 0x12,
-  0x57, 0x6b, 0xec, 0xef, 0x69, 0xb5, 0x64, 0x1e, 0x2d, 0x87, 0x90, 0xd0,
-  0xb9, 0x0c, 0x03, 0x12, 0x9d, 0x5c, 0x1e, 0x74, 0x16, 0xfa, 0xd2, 0x6a,
-  0x58, 0x37, 0x3d, 0x01, 0x95, 0x51, 0x6e, 0x27, 0xff, 0x0a, 0xdd, 0x74,
-  0x58, 0x98, 0xda, 0x1a, 0xeb, 0x2a, 0x8b, 0xb8, 0xa4, 0xe2, 0x06, 0xe2,
-  0xc3, 0x48, 0x0c, 0x3b, 0x0c, 0x15, 0xbb, 0x19, 0x4b, 0x10, 0x9e, 0x99,
-  0x3e, 0xfd, 0x4b, 0x87, 0xeb, 0x62, 0x06, 0x48, 0x18, 0x3d, 0x20, 0xc0,
-  0xe0, 0x48, 0xf5, 0x46, 0x9c, 0x0c, 0x6e, 0x81, 0xe4, 0x00, 0x2b, 0x31,
-  0x81, 0x62, 0x60, 0x00, 0x4c, 0x82, 0x2e, 0xe5, 0xbd, 0x01, 0x00, 0x04,
-  0x83, 0xc2, 0xea, 0x20, 0x08, 0x7b, 0xee, 0x26, 0x3e, 0x64, 0x19, 0x91,
-  0x80, 0x30, 0xe4, 0xa7, 0xfc, 0xbe, 0xe9, 0xcc, 0x01, 0xd9, 0x25, 0x29,
-  0x25, 0xb2, 0x0b, 0x37, 0x4b, 0x5b, 0xa6, 0x42, 0x97, 0x74, 0x48, 0x01,
-  0x08, 0x9a, 0x6e, 0x0c, 0xb4, 0x9f, 0xfe, 0x2a, 0x93, 0x21, 0x07, 0x7b,
-  0x36, 0xa4, 0x24, 0x03, 0x70, 0xa2, 0x24, 0xf5, 0xbd, 0x13, 0x36, 0x6a,
-  0xba, 0x00, 0xa5, 0x4a, 0x11, 0x13, 0xdb, 0xb6, 0x18, 0xa8, 0x68, 0xa6,
-  0x43, 0x9b, 0x14, 0x0b, 0x07, 0xe9, 0xbb, 0x9c, 0x32, 0x64, 0x7d, 0x90,
-  0x33, 0xa4, 0x51, 0x78, 0xb7, 0x45, 0xc0, 0x92, 0x22, 0xfe, 0x3c, 0xe9,
-  0x2e, 0x01, 0x04, 0x44, 0x03, 0x92, 0x1a, 0x41, 0xf6, 0x9c, 0x0c, 0xb2,
-  0xcd, 0x51, 0x94, 0xa8, 0x01, 0x2e, 0xc3, 0x76, 0x48, 0xeb, 0x30, 0xf9,
-  0x9e, 0x35, 0x66, 0x8c, 0x90, 0x8a, 0x0d, 0x9b, 0x18, 0x9e, 0x0e, 0x01,
-  0xc3, 0x7a, 0xd8, 0xe9, 0xc2, 0xa5, 0xcb, 0x2e, 0x90, 0x34, 0x8e, 0x80,
-  0x32, 0x02, 0x5b, 0x22, 0x31, 0x33, 0x00, 0xa0, 0x00, 0xe4, 0x7a, 0x26,
-  0x6c, 0x4b, 0xdc, 0xeb, 0x5e, 0x10, 0xb1, 0x50, 0x00, 0x42, 0xc1, 0x08,
-  0xcf, 0xa7, 0xe9, 0x0f, 0x84, 0xff, 0xaa, 0x0d, 0x24, 0xe0, 0x79, 0xf7,
-  0xfa, 0x2f, 0xb0, 0x30, 0x18, 0x6a, 0x38, 0xb0, 0x3f, 0xc1, 0x4c, 0x04,
-  0x12, 0x0d, 0x2a, 0x84, 0x95, 0xc4, 0x56, 0x9b, 0x58, 0xc2, 0x2f, 0x31,
-  0xa0, 0x23, 0xa1, 0x76, 0x25, 0x7b, 0x9c, 0x1e, 0x55, 0x08, 0xc6, 0x69,
-  0x76, 0x85, 0x42, 0x73, 0x43, 0x9a, 0x88, 0x89, 0x14, 0x7d, 0x28, 0xb9,
-  0x7e, 0x55, 0x51, 0x75, 0x08, 0xc5, 0x0d, 0xc8, 0x25, 0x02, 0x78, 0x58,
-  0x39, 0x8a, 0x35, 0x6c, 0x87, 0x10, 0xeb, 0x80, 0x0f, 0xbe, 0x1f, 0x8a,
-  0xa8, 0xbb, 0xf1, 0x12, 0x00, 0x81, 0xe2, 0xbc, 0x62, 0x47, 0xa1, 0x9e,
-  0x76, 0x7c, 0xcb, 0x8c, 0x4a, 0x01, 0x54, 0xc2, 0x6b, 0x37, 0x07, 0x1d,
-  0x8b, 0xa9, 0x10, 0xd6, 0x20, 0xf7, 0xbc, 0xb0, 0x11, 0x41, 0x56, 0xaf,
-  0x7d, 0x9e, 0x2b, 0x18, 0x68, 0x62, 0x66, 0x3e, 0x11, 0xa9, 0x84, 0x76,
-  0xff, 0x06, 0x0d, 0x85, 0x65, 0x6b, 0x03, 0x23, 0xe7, 0x31, 0x66, 0x24,
-  0xc1, 0xa1, 0xb8, 0x05, 0x78, 0x44, 0x96, 0xdc, 0xdb, 0x3a, 0xa2, 0xb2,
-  0x71, 0x75, 0x71, 0x41, 0xb3, 0x22, 0x2b, 0x6b, 0xa4, 0x2b, 0xbb, 0xd1,
-  0xd8, 0x3a, 0xb2, 0x08, 0x00, 0x70, 0x50, 0x05, 0x61, 0x71, 0xdc, 0x49,
-  0x4d, 0x1c, 0x2f, 0x18, 0xc8, 0x22, 0x88, 0x4d, 0xb7, 0x04, 0xcc, 0xa1,
-  0x11, 0x1d, 0x64, 0x21, 0xfe, 0xf9, 0x88, 0x84, 0xa0, 0x2b, 0xb4, 0x92,
-  0x51, 0x0c, 0xf7, 0xd1, 0x07, 0x40, 0xfc, 0xfd, 0x02, 0x7c, 0xdf, 0x45,
-  0x18, 0x7a, 0x1d, 0xeb, 0x83, 0x1a, 0xa1, 0x6a, 0x04, 0x8c, 0x41, 0x05,
-  0x85, 0x79, 0x69, 0xa2, 0xb7, 0xb6, 0x00, 0x7c, 0x29, 0x77, 0x83, 0xfc,
-  0xea, 0xba, 0x03, 0xed, 0xb8, 0x40, 0x40, 0xb9, 0x8a, 0x52, 0x50, 0x0b,
-  0x0d, 0x15, 0x12, 0x61, 0x69, 0x2d, 0x33, 0xee, 0xe9, 0x90, 0x00, 0xa0,
-  0x90, 0x1a, 0x95, 0x51, 0xdb, 0xb5, 0x88, 0x00, 0xa2, 0x81, 0xb7, 0x22,
-  0xd1, 0x9e, 0x77, 0x04, 0x7c, 0xe1, 0xc3, 0x48, 0x17, 0x5e, 0x42, 0xf8,
-  0xc6, 0x1f, 0xb1, 0x46, 0xe4, 0xe1, 0x31, 0x42, 0x6d, 0xaa, 0x55, 0x7b,
-  0x6c, 0xd8, 0x0c, 0xcc, 0x2e, 0x29, 0x90, 0x82, 0xe7, 0x10, 0x6c, 0x28,
-  0xeb, 0x14, 0x0c, 0xb8, 0xc2, 0x91, 0x43, 0xc7, 0x32, 0xf3, 0xe3, 0x38,
-  0x36, 0x76, 0xc6, 0x06, 0xef, 0x8c, 0x38, 0x34, 0xb0, 0x34, 0x74, 0x1e,
-  0xe8, 0xb1, 0x93, 0x84, 0xd8, 0x89, 0xd8, 0x1a, 0x21, 0x10, 0x2b, 0x5a,
-  0xdd, 0x22, 0x3d, 0x3c, 0xb2, 0x5d, 0xba, 0x84, 0x92, 0x01, 0xb2, 0x22,
-  0x9f, 0x19, 0xfa, 0xac, 0x0d, 0x89, 0x07, 0xeb, 0x77, 0x08, 0x98, 0xc8,
-  0xd9, 0x4a, 0x01, 0xbf, 0x40, 0xb9, 0xad, 0xa7, 0x2b, 0xe4, 0xc8, 0x0e,
-  0xc8, 0x43, 0x00, 0x1c, 0x85, 0xc8, 0x1e, 0x1e, 0x39, 0x7e, 0xfa, 0x0a,
-  0x41, 0xa1, 0x09, 0xc7, 0xe4, 0x87, 0x2b, 0x57, 0x68, 0xd2, 0xb0, 0xa2,
-  0x48, 0x04, 0xda, 0xba, 0x1c, 0x21, 0xac, 0x90, 0x8e, 0x64, 0x80, 0x3e,
-  0x19, 0x07, 0x5d, 0x7e, 0x02, 0x2e, 0x5e, 0x01, 0x08, 0xb6, 0x98, 0xfd,
-  0x1a, 0x06, 0xff, 0xb5, 0x04, 0xbd, 0x51, 0x06, 0x7c, 0x0e, 0xb2, 0x3c,
-  0xc2, 0x4e, 0xeb, 0xdd, 0xa8, 0x32, 0x8c, 0x50, 0x8a, 0x59, 0xa3, 0x7b,
-  0x0e, 0x0e, 0x00, 0xa7, 0x4d, 0x8a, 0xd3, 0xd4, 0x9f, 0x08, 0x6f, 0x34,
-  0xec, 0x2c, 0x85, 0xee, 0xb2, 0xec, 0xdd, 0xee, 0x18, 0x24, 0x2c, 0xf4,
-  0x87, 0xe8, 0x2c, 0xea, 0xb2, 0xe8, 0xf6, 0xea, 0x75, 0x13, 0x16, 0xdb,
-  0xee, 0x02, 0xec, 0x15, 0x98, 0xcf, 0xbe, 0x90, 0xdf, 0x92, 0x02, 0x0e,
-  0x60, 0x60, 0x05, 0x88, 0xe3, 0x42, 0x71, 0xda, 0x4d, 0xdb, 0x69, 0x56,
-  0x6f, 0xad, 0xe4, 0x29, 0xc4, 0xe6, 0xeb, 0x2c, 0xcf, 0xe4, 0x1b, 0xb0,
-  0xf2, 0x14, 0x07, 0x3c, 0xd1, 0xe4, 0x1a, 0x41, 0xad, 0x8a, 0x84, 0x15,
-  0x8d, 0x25, 0x06, 0xe6, 0x88, 0x0b, 0x7d, 0x82, 0x7b, 0x16, 0xfe, 0x26,
-  0x1d, 0xeb, 0x00, 0xc2, 0x8e, 0x5b, 0x0c, 0xea, 0x2c, 0xe8, 0x8a, 0x99,
-  0xd5, 0xcc, 0xd9, 0x1d, 0xd8, 0x16, 0x20, 0xa3, 0x62, 0x36, 0x31, 0x43,
-  0xf4, 0x60, 0x1d, 0xc3, 0x03, 0x54, 0x0a, 0xbe, 0xb7, 0xf0, 0xc0, 0x45,
-  0x54, 0x34, 0x35, 0xf0, 0x24, 0x7f, 0xf8, 0x8b, 0x1e, 0xd0, 0x2b, 0x0a,
-  0xec, 0x20, 0x54, 0x6b, 0x51, 0x82, 0x65, 0xde, 0x0f, 0x05, 0x7d, 0x13,
-  0xcc, 0x16, 0x10, 0x3e, 0x06, 0x56, 0x6b, 0xb5, 0x48, 0xa8, 0x0c, 0x0b,
-  0x7d, 0xd0, 0x41, 0xed, 0x90, 0x2b, 0xde, 0x58, 0x6b, 0x07, 0xf1, 0x19,
-  0x8d, 0xea, 0xea, 0xdc, 0x26, 0xa3, 0x5e, 0x6b, 0x15, 0x67, 0x16, 0x0e,
-  0x6b, 0x2b, 0x43, 0xf4, 0x01, 0x7d, 0xce, 0xe0, 0x06, 0x88, 0x00, 0x21,
-  0xee, 0x96, 0x9c, 0x0e, 0x74, 0x6b, 0xb6, 0xf1, 0x1a, 0x8a, 0x36, 0xf5,
-  0x2b, 0x02, 0xa4, 0x21, 0x98, 0xd4, 0x4b, 0xd4, 0xb7, 0x11, 0x73, 0x74,
-  0x6b, 0x20, 0xcc, 0x60, 0xd6, 0x0c, 0x50, 0x0b, 0x08, 0x58, 0x19, 0x2e,
-  0x16, 0x60, 0xb3, 0xb3, 0x0e, 0x6a, 0x73, 0xc3, 0x37, 0x4e, 0x06, 0x96,
-  0x2a, 0xea, 0x49, 0xd6, 0x10, 0x2c, 0x0b, 0x1d, 0x05, 0x36, 0xfe, 0xa4,
-  0x00, 0x20, 0xb9, 0x72, 0x98, 0x1a, 0xd7, 0x86, 0x0b, 0xa9, 0x97, 0xa1,
-  0x40, 0x79, 0x86, 0x9c, 0xc8, 0x1a, 0xd4, 0x06, 0x84, 0xad, 0xd0, 0x0a,
-  0x10, 0x8f, 0xca, 0x01, 0x5b, 0x75, 0xb3, 0xd4, 0x11, 0x1d, 0x39, 0xb9,
-  0xd4, 0xb8, 0x5d, 0x92, 0xbc, 0xc9, 0x33, 0x54, 0x59, 0x5e, 0xb6, 0x21,
-  0xfa, 0x6d, 0x97, 0x83, 0xad, 0x2b, 0x05, 0xca, 0x03, 0xff, 0x22, 0xb3,
-  0x0f, 0x70, 0x15, 0x00, 0xde, 0xf0, 0xf8, 0x74, 0x10, 0x20, 0x04, 0xbf,
-  0x31, 0x00, 0x3e, 0x75, 0x75, 0xdd, 0xcb, 0x1f, 0x99, 0x0a, 0x10, 0x86,
-  0x47, 0x0c, 0x76, 0x3b, 0x04, 0xca, 0xe4, 0xed, 0xad, 0x99, 0x28, 0x99,
-  0x26, 0xcf, 0x02, 0xf2, 0x20, 0x0c, 0x27, 0x51, 0x58, 0xdc, 0x2c, 0x70,
-  0xfd, 0x12, 0x74, 0x16, 0x8b, 0x8c, 0x10, 0x03, 0x92, 0xc2, 0x48, 0x40,
-  0xdb, 0xfc, 0xb8, 0x0a, 0x4b, 0xe4, 0xf5, 0x99, 0x79, 0x2c, 0x25, 0x38,
-  0x84, 0x2a, 0x03, 0x73, 0xf6, 0xbd, 0x21, 0x78, 0x4d, 0x40, 0x6b, 0x24,
-  0x24, 0x63, 0xc2, 0xdc, 0x59, 0x57, 0x40, 0x60, 0x4c, 0xa7, 0x67, 0x61,
-  0x7b, 0x2f, 0x15, 0x04, 0x56, 0x4f, 0x68, 0x03, 0x7c, 0x59, 0x23, 0x02,
-  0x89, 0x4e, 0x3f, 0x80, 0x3f, 0x24, 0x75, 0xb3, 0x09, 0x2f, 0xaa, 0x40,
-  0x25, 0x8b, 0xb2, 0x24, 0xcb, 0x0c, 0x2b, 0x15, 0x07, 0x86, 0x84, 0xb2,
-  0x4f, 0x94, 0x58, 0x85, 0x1e, 0x42, 0x42, 0x23, 0x2c, 0x85, 0x41, 0x8b,
-  0xee, 0xdb, 0xd5, 0x67, 0xf1, 0xeb, 0xbc, 0x10, 0x0c, 0x47, 0x54, 0x00,
-  0x01, 0x86, 0x36, 0xec, 0x4b, 0x13, 0xc4, 0x50, 0x8b, 0xbe, 0x09, 0xf6,
-  0xc4, 0x1f, 0xf3, 0x70, 0xd1, 0x80, 0x2b, 0x36, 0x0a, 0x0b, 0x61, 0x07,
-  0xc2, 0x29, 0x10, 0xc3, 0xde, 0x49, 0xc4, 0x40, 0x04, 0x96, 0x0c, 0x02,
-  0x32, 0x40, 0x7b, 0xb1, 0x00, 0xc6, 0xc1, 0x70, 0x10, 0xbe, 0x02, 0x28,
-  0xc2, 0x4e, 0xfd, 0x35, 0x00, 0x30, 0x79, 0xc3, 0x70, 0xd5, 0x74, 0x09,
-  0xf8, 0x9b, 0x05, 0xd0, 0xb7, 0x83, 0x1d, 0x8a, 0x64, 0x15, 0xc8, 0x04,
-  0x32, 0xf9, 0xd8, 0x07, 0x08, 0xad, 0x88, 0x56, 0x8b, 0x2a, 0xa9, 0xc2,
-  0x50, 0x00, 0xde, 0x8e, 0x02, 0xd0, 0x8a, 0xca, 0xe8, 0x51, 0x01, 0x8a,
-  0xef, 0x57, 0x7e, 0xad, 0x8a, 0xc1, 0x12, 0xa2, 0x02, 0x2a, 0x84, 0x79,
-  0x18, 0x0a, 0x40, 0x09, 0xb8, 0x18, 0xcc, 0xdd, 0x56, 0x81, 0x29, 0x6a,
-  0x28, 0xf0, 0x75, 0xd2, 0xc2, 0x15, 0x89, 0x5b, 0x16, 0x4a, 0x0b, 0x67,
-  0x05, 0x4e, 0xcd, 0xba, 0x6f, 0x2b, 0x11, 0xc4, 0xa0, 0x38, 0x21, 0x66,
-  0x62, 0x47, 0x25, 0xd4, 0x14, 0x0b, 0x54, 0x73, 0xbb, 0x18, 0x07, 0x03,
-  0xd8, 0x40, 0x57, 0x38, 0xe1, 0x0d, 0x46, 0x33, 0x59, 0x1f, 0xa0, 0x2b,
-  0x44, 0x94, 0x4d, 0xa4, 0x72, 0x8a, 0xd0, 0xd1, 0x99, 0x04, 0x84, 0xe8,
-  0xd9, 0x0e, 0xae, 0xa0, 0x45, 0x21, 0x0c, 0x12, 0xd8, 0x76, 0x4f, 0x47,
-  0x4f, 0x3f, 0x0d, 0x4a, 0xe6, 0xfc, 0x45, 0x74, 0x04, 0x42, 0x2e, 0xdd,
-  0xe9, 0x8d, 0x33, 0x5b, 0x95, 0x46, 0x6c, 0xd5, 0xda, 0x10, 0x18, 0x29,
-  0xea, 0x4c, 0x40, 0x93, 0xaf, 0x78, 0xe3, 0x4d, 0xbe, 0x04, 0x08, 0x44,
-  0x76, 0x5c, 0x2c, 0x58, 0x43, 0xbb, 0x78, 0x25, 0xaa, 0x12, 0xfb, 0x18,
-  0x0a, 0x78, 0xec, 0xc6, 0x9a, 0x63, 0x11, 0xee, 0x0b, 0xa1, 0x02, 0x2c,
-  0x0a, 0x0d, 0x6c, 0xb0, 0x2c, 0xe3, 0x42, 0xd0, 0x0a, 0x19, 0xfd, 0xb0,
-  0x99, 0xfe, 0x88, 0xd3, 0x56, 0x83, 0x09, 0x08, 0x92, 0x16, 0xde, 0xbe,
-  0xc0, 0xbb, 0xc5, 0x66, 0x46, 0x81, 0x44, 0xa6, 0xde, 0xe8, 0xa3, 0x76,
-  0x6b, 0x76, 0x06, 0xa7, 0x0f, 0xa3, 0x04, 0x2c, 0x41, 0x4b, 0xaa, 0x2c,
-  0x78, 0xa4, 0x3e, 0xbe, 0x8f, 0xa8, 0x9b, 0xb8, 0x7f, 0x00, 0x60, 0xd6,
-  0x78, 0x56, 0x0a, 0x22, 0xd4, 0x2a, 0x11, 0x8b, 0xe0, 0x8a, 0x5a, 0x2d,
-  0xa2, 0xdb, 0xfa, 0x36, 0x2f, 0x45, 0x82, 0x32, 0xd9, 0x52, 0xcd, 0xa1,
-  0x0a, 0x99, 0x09, 0xa3, 0x41, 0xb3, 0xa1, 0x1b, 0x4e, 0x5f, 0x2f, 0xc4,
-  0x9a, 0x1e, 0xd8, 0xc3, 0xe1, 0x06, 0x42, 0x60, 0x29, 0x59, 0xaf, 0xe1,
-  0x42, 0x6b, 0x03, 0x1c, 0x58, 0x13, 0x20, 0x82, 0x59, 0xcc, 0x2c, 0xdd,
-  0x05, 0xe9, 0x85, 0x77, 0x6a, 0xdb, 0x3b, 0x36, 0xa3, 0x73, 0x10, 0x43,
-  0x0e, 0x00, 0x24, 0x54, 0xbb, 0xa1, 0x12, 0x41, 0x46, 0x76, 0x0b, 0x5a,
-  0x2c, 0x45, 0xc9, 0x93, 0x39, 0x82, 0xf9, 0x76, 0xa1, 0x11, 0xdd, 0x0b,
-  0x42, 0x74, 0x86, 0x53, 0xff, 0xbd, 0x3a, 0xb0, 0x96, 0x25, 0x82, 0x9f,
-  0xe2, 0x3b, 0x06, 0x0a, 0x4c, 0x2a, 0x1a, 0x67, 0x00, 0xdb, 0x22, 0x1a,
-  0x1e, 0xd8, 0x9f, 0x16, 0xc7, 0x7c, 0x72, 0xc0, 0x64, 0xa1, 0x08, 0xcb,
-  0x26, 0x68, 0x68, 0xf7, 0x46, 0x3a, 0x44, 0xe3, 0xd0, 0x2e, 0x59, 0x0a,
-  0x9f, 0x13, 0x15, 0x05, 0xb8, 0x0a, 0xa0, 0x0c, 0x27, 0xdc, 0xa9, 0x27,
-  0x9b, 0xc4, 0x4f, 0x27, 0x10, 0x60, 0x1a, 0xe6, 0xc7, 0x02, 0x6c, 0x2a,
-  0x89, 0x87, 0x9b, 0x97, 0x01, 0xeb, 0x65, 0x60, 0x37, 0xc8, 0xdd, 0x76,
-  0x0d, 0x1d, 0x0c, 0xe8, 0xf2, 0x47, 0x0e, 0x04, 0x01, 0x48, 0x67, 0xfe,
-  0x90, 0x29, 0x64, 0x4d, 0x8f, 0x0c, 0x02, 0x35, 0x0b, 0x83, 0x76, 0x22,
-  0x22, 0xb0, 0x16, 0x18, 0x3f, 0x0e, 0x50, 0xa0, 0x4f, 0xab, 0x25, 0x85,
-  0x40, 0x84, 0xfa, 0xaf, 0xbf, 0x67, 0xcd, 0x92, 0x25, 0x21, 0x35, 0xa2,
-  0x46, 0x20, 0x6b, 0x4a, 0x05, 0x07, 0x76, 0xe9, 0x88, 0xc0, 0x00, 0x13,
-  0x5c, 0x1c, 0x21, 0x22, 0x40, 0xfa, 0xed, 0xbe, 0xcf, 0x1a, 0x7e, 0xc9,
-  0xc3, 0x66, 0xef, 0xa6, 0x0c, 0x64, 0xc9, 0x74, 0x3d, 0x74, 0x01, 0xf4,
-  0x86, 0x11, 0x20, 0x98, 0x74, 0x16, 0xa5, 0xc6, 0x47, 0xf9, 0xcf, 0xf4,
-  0xf8, 0x36, 0x03, 0xf0, 0xb7, 0x19, 0x08, 0x7c, 0x97, 0x05, 0xe9, 0xaa,
-  0x08, 0xad, 0x4c, 0x59, 0x91, 0x30, 0x3b, 0x91, 0x8f, 0x30, 0x1d, 0x91,
-  0xcb, 0xe1, 0x11, 0x46, 0xcc, 0x2c, 0x7e, 0x18, 0x4b, 0xff, 0x12, 0xb1,
-  0x11, 0x60, 0x2a, 0xbe, 0x94, 0xfc, 0x45, 0x66, 0xf5, 0x93, 0xdb, 0x08,
-  0xca, 0x77, 0x08, 0xa9, 0x52, 0x7d, 0x30, 0xc8, 0x17, 0x18, 0xa0, 0x3c,
-  0x52, 0x40, 0x76, 0x38, 0x7e, 0x0a, 0x21, 0xec, 0xc2, 0x15, 0x58, 0x22,
-  0x75, 0x65, 0x5a, 0xd2, 0xe0, 0x66, 0xb2, 0x15, 0xfa, 0x4a, 0xbb, 0x16,
-  0x80, 0x00, 0x53, 0x1f, 0x49, 0xf2, 0xb3, 0x1d, 0x08, 0x18, 0x6d, 0x69,
-  0x8a, 0xf2, 0x8b, 0xe8, 0xe2, 0xf1, 0xa8, 0xeb, 0x40, 0xff, 0x4f, 0x53,
-  0x86, 0x25, 0x4f, 0x97, 0x0a, 0x0d, 0xa1, 0xe9, 0x0c, 0x2c, 0x3b, 0xf5,
-  0x85, 0x52, 0x1e, 0x18, 0x80, 0x4e, 0x0b, 0xf8, 0xa0, 0xf0, 0xb4, 0x51,
-  0x92, 0x3d, 0xf0, 0x0f, 0x19, 0xdb, 0x88, 0x8e, 0x04, 0xdc, 0x8b, 0xf2,
-  0x50, 0x8d, 0xe5, 0x9d, 0xf1, 0x98, 0x67, 0x7e, 0x5a, 0xe9, 0x21, 0x01,
-  0xcc, 0x0d, 0x25, 0x5b, 0xd0, 0x27, 0x16, 0xbb, 0x60, 0x0b, 0x13, 0x44,
-  0x43, 0x1e, 0xb8, 0x53, 0x41, 0x86, 0xb9, 0xc6, 0x37, 0xe8, 0x7c, 0xe9,
-  0x00, 0x98, 0x4b, 0x57, 0xb0, 0x3a, 0x37, 0x58, 0xe3, 0x73, 0x03, 0x82,
-  0x76, 0x91, 0x41, 0x52, 0x13, 0x79, 0x09, 0x15, 0xf6, 0x46, 0xe9, 0x02,
-  0x82, 0x18, 0x43, 0xc0, 0x0d, 0x16, 0x8f, 0x3c, 0xf0, 0xf6, 0xf4, 0x50,
-  0x1c, 0x7a, 0xce, 0x42, 0x11, 0x21, 0x2f, 0xba, 0x9d, 0xf0, 0x1e, 0xa3,
-  0xf4, 0x64, 0x45, 0x9f, 0xbd, 0xc6, 0x03, 0xc2, 0x0c, 0xbe, 0x16, 0x38,
-  0xf0, 0x46, 0xef, 0x78, 0x39, 0x5d, 0x07, 0x7e, 0x13, 0x92, 0x99, 0x08,
-  0x6d, 0x0a, 0x57, 0xff, 0xb9, 0x12, 0xeb, 0x0f, 0x0b, 0x09, 0x36, 0x2e,
-  0x3b, 0x0b, 0x23, 0xef, 0x25, 0xd6, 0x0c, 0x3c, 0x7b, 0x3d, 0xfe, 0x0f,
-  0x31, 0x93, 0x23, 0xf6, 0x2b, 0x67, 0xa4, 0xf6, 0x67, 0xf5, 0x61, 0xfc,
-  0x2c, 0x4f, 0xb6, 0x0f, 0x61, 0x86, 0x21, 0xb6, 0xf6, 0x62, 0xf5, 0x61,
-  0xb2, 0x56, 0xf8, 0xba, 0x48, 0xfa, 0x99, 0x34, 0x6c, 0x21, 0xfa, 0x83,
-  0xdb, 0x8c, 0xfd, 0x4f, 0x91, 0x41, 0x82, 0xfd, 0x10, 0x90, 0xc4, 0x5e,
-  0x4c, 0xd0, 0x14, 0x86, 0x4c, 0xa5, 0xa4, 0xfa, 0x78, 0x6b, 0x01, 0x75,
-  0x1e, 0x88, 0x7a, 0x7e, 0x4b, 0x08, 0xc3, 0x70, 0xe0, 0x0e, 0x2c, 0x50,
-  0xa3, 0x5f, 0x27, 0xeb, 0x33, 0x7f, 0x24, 0x02, 0x75, 0x13, 0x23, 0x26,
-  0x24, 0xfe, 0x34, 0x2c, 0xeb, 0xd9, 0x9a, 0xdb, 0x39, 0x9a, 0x00, 0x2e,
-  0x01, 0x76, 0x0f, 0xc4, 0x55, 0x03, 0x97, 0xcb, 0x39, 0x08, 0x12, 0x95,
-  0x47, 0x76, 0xc0, 0x10, 0x3b, 0x2d, 0xd5, 0x19, 0x3c, 0x9a, 0x14, 0x44,
-  0x62, 0xa2, 0x80, 0xd8, 0xfb, 0x0a, 0x88, 0x76, 0xca, 0x3f, 0xc1, 0xc6,
-  0x14, 0xb4, 0xba, 0x36, 0x16, 0x24, 0x88, 0x98, 0xbb, 0x03, 0x76, 0x2a,
-  0xd6, 0x4d, 0x22, 0x87, 0x06, 0x6e, 0x4c, 0xdc, 0xfb, 0x88, 0x30, 0x7e,
-  0x5b, 0xd7, 0x13, 0x02, 0xc8, 0xcc, 0x0c, 0x21, 0xe8, 0xdb, 0x19, 0x31,
-  0xab, 0xfa, 0x43, 0xa0, 0x03, 0x67, 0x09, 0xea, 0xa2, 0x0c, 0xfd, 0xb7,
-  0x22, 0x71, 0x74, 0x14, 0xa1, 0xae, 0xe3, 0x95, 0xd8, 0x7c, 0x0c, 0x6a,
-  0xc7, 0x08, 0xf2, 0xc1, 0x7f, 0x2b, 0xc0, 0x0d, 0x84, 0xd6, 0x79, 0x36,
-  0x21, 0xb9, 0x1e, 0xd2, 0x54, 0x8b, 0x85, 0xc3, 0x6b, 0x32, 0x4a, 0x66,
-  0xb7, 0x17, 0x07, 0xf6, 0x75, 0x0b, 0x47, 0x30, 0x0e, 0xc7, 0x7f, 0x8a,
-  0x05, 0xe0, 0x73, 0x24, 0x2b, 0x85, 0xd7, 0x1e, 0x05, 0x2f, 0x30, 0x6a,
-  0xb6, 0x66, 0x15, 0x88, 0x23, 0x5f, 0xe1, 0x0b, 0x1d, 0x5a, 0x0a, 0xec,
-  0xa3, 0x8d, 0xf9, 0x42, 0x71, 0x1c, 0x22, 0x13, 0x1f, 0xe0, 0x4a, 0x2c,
-  0x9a, 0x48, 0xde, 0x40, 0x72, 0xde, 0x50, 0x69, 0xe9, 0xf9, 0x1b, 0x00,
-  0x94, 0x40, 0x1e, 0xcc, 0xde, 0x15, 0x7c, 0x02, 0x55, 0x58, 0xa3, 0x56,
-  0x79, 0xf5, 0x60, 0xa2, 0x49, 0xdd, 0x00, 0x22, 0x43, 0xea, 0x77, 0x7d,
-  0x02, 0x42, 0x2f, 0x43, 0xa5, 0x85, 0x9f, 0x87, 0x15, 0x92, 0x01, 0x33,
-  0x03, 0x4d, 0x77, 0x7f, 0x02, 0xed, 0x06, 0x52, 0x44, 0x62, 0x45, 0x30,
-  0x0d, 0xdb, 0xa7, 0x33, 0x6a, 0x11, 0x00, 0x16, 0x70, 0xe0, 0xd1, 0x23,
-  0x34, 0xf2, 0x16, 0x50, 0x1f, 0x82, 0x09, 0x13, 0x58, 0xf4, 0x35, 0x21,
-  0x10, 0x2b, 0x30, 0x08, 0xdb, 0x18, 0x47, 0xc2, 0x83, 0xff, 0xa7, 0xd0,
-  0xe5, 0x52, 0x5d, 0x60, 0x9a, 0xb3, 0x08, 0x60, 0x04, 0xc0, 0x63, 0xb7,
-  0xa0, 0x62, 0x2c, 0x25, 0x62, 0xc9, 0x47, 0xa1, 0x16, 0x32, 0xa1, 0x3f,
-  0x59, 0x46, 0x8f, 0x8d, 0xb1, 0xa6, 0x56, 0x24, 0x0b, 0x5c, 0x88, 0x9c,
-  0xff, 0x12, 0x0b, 0x17, 0xf8, 0x25, 0x28, 0x66, 0x97, 0xcf, 0x62, 0x92,
-  0x92, 0xd0, 0x26, 0xe7, 0xd9, 0x73, 0x66, 0x75, 0x9a, 0x34, 0x59, 0xd4,
-  0xbe, 0x0b, 0x96, 0x47, 0x9a, 0x83, 0xec, 0x00, 0x0c, 0x13, 0x7d, 0x26,
-  0x06, 0x15, 0x7d, 0x17, 0x5d, 0x36, 0x24, 0x7e, 0x69, 0x1f, 0x16, 0x64,
-  0x0b, 0x59, 0x75, 0x8e, 0x0d, 0x8d, 0x17, 0x0c, 0x41, 0x7d, 0x40, 0x0d,
-  0x02, 0x9e, 0x8d, 0x3e, 0xb6, 0xd1, 0x28, 0x91, 0x48, 0xf9, 0x04, 0x00,
-  0xcc, 0x36, 0x8d, 0xcb, 0x11, 0xd5, 0x60, 0x15, 0xcb, 0x1e, 0x14, 0x18,
-  0x24, 0x21, 0x55, 0x5b, 0x77, 0xfe, 0x54, 0x4c, 0x28, 0xa5, 0x80, 0xd8,
-  0x75, 0x14, 0x34, 0x3c, 0x35, 0x00, 0xf5, 0xeb, 0x75, 0xee, 0x7c, 0xae,
-  0xb2, 0xad, 0x54, 0x30, 0xb1, 0xd1, 0xb3, 0x0e, 0xe5, 0xd9, 0x1a, 0x7d,
-  0x25, 0x84, 0xe7, 0xa5, 0x3c, 0x1c, 0xd5, 0x1a, 0x17, 0x8c, 0x97, 0xc9,
-  0x9a, 0xd4, 0x73, 0x1e, 0x69, 0xd0, 0x9c, 0xdb, 0x9d, 0x46, 0x29, 0x0f,
-  0xe6, 0x03, 0xcb, 0x70, 0x35, 0x83, 0x51, 0x03, 0x6c, 0xa2, 0x04, 0xb4,
-  0x74, 0xd0, 0x8d, 0x56, 0xb5, 0xab, 0x48, 0xc0, 0x07, 0x03, 0x71, 0x50,
-  0xa2, 0x18, 0x02, 0x5c, 0xf9, 0x52, 0x53, 0x44, 0x20, 0xe5, 0x83, 0x43,
-  0x16, 0x90, 0xc9, 0xd2, 0x6c, 0x4c, 0xf0, 0x23, 0x02, 0x9b, 0x0e, 0x3c,
-  0x5b, 0x1c, 0xea, 0x24, 0xa8, 0xc5, 0xb6, 0xad, 0x19, 0x03, 0x80, 0xc4,
-  0x43, 0x3a, 0xda, 0x65, 0x05, 0xf9, 0xb8, 0x05, 0x23, 0x10, 0x07, 0x2d,
-  0x06, 0x05, 0x4b, 0x0d, 0xb8, 0x84, 0x09, 0x41, 0x31, 0x24, 0xc7, 0x2b,
-  0x81, 0x68, 0x12, 0x41, 0xb5, 0x56, 0x0f, 0x60, 0x24, 0x9c, 0xd9, 0x48,
-  0xe7, 0x7b, 0x01, 0x18, 0x2d, 0x5a, 0x08, 0x3f, 0x51, 0x19, 0x01, 0x60,
-  0xe1, 0xc9, 0x47, 0x58, 0x58, 0x6c, 0xdd, 0x13, 0x5e, 0x04, 0x52, 0xf6,
-  0x0e, 0xfd, 0x2c, 0x22, 0x9a, 0x5b, 0x6b, 0xa1, 0x28, 0x0c, 0x40, 0x8e,
-  0xbd, 0x81, 0xe2, 0xdf, 0x47, 0x25, 0xff, 0x0f, 0x0b, 0xfa, 0xd0, 0x75,
-  0x08, 0xbf, 0x04, 0x9f, 0x0c, 0x82, 0x00, 0x61, 0x18, 0x36, 0x3d, 0x02,
-  0x88, 0x83, 0xfb, 0x77, 0xfa, 0xf7, 0x1e, 0x0d, 0x6c, 0x86, 0xbe, 0x34,
-  0xb2, 0x63, 0x1e, 0x99, 0x07, 0x45, 0x35, 0xcd, 0x3f, 0x90, 0x50, 0xec,
-  0x74, 0x36, 0x48, 0xa6, 0x05, 0x6d, 0x74, 0x1f, 0x80, 0x16, 0x7b, 0xff,
-  0x74, 0x5f, 0x65, 0x03, 0x13, 0x53, 0xe0, 0xe9, 0x24, 0xa6, 0xd7, 0x0c,
-  0x9a, 0x8e, 0x68, 0x66, 0xbb, 0x20, 0x33, 0xc8, 0xdc, 0x75, 0x09, 0x17,
-  0x22, 0x69, 0x33, 0x00, 0xd1, 0xdd, 0x65, 0x7d, 0x16, 0x57, 0x83, 0x21,
-  0x49, 0x0c, 0x85, 0x22, 0x79, 0x38, 0xf8, 0x91, 0x08, 0x21, 0x4c, 0x04,
-  0x24, 0x24, 0x29, 0x73, 0x01, 0x99, 0x04, 0x18, 0xa9, 0x70, 0x81, 0x8a,
-  0xc8, 0xac, 0x64, 0x90, 0x14, 0xc0, 0xd8, 0x29, 0xc9, 0xdb, 0x04, 0xfe,
-  0x3c, 0xf8, 0xe9, 0xc7, 0x86, 0x54, 0x15, 0xcc, 0x10, 0x10, 0xde, 0x53,
-  0x4d, 0xed, 0x3d, 0x01, 0x34, 0xcd, 0xf0, 0x02, 0xf2, 0x53, 0xe5, 0x40,
-  0xcf, 0xf1, 0x7d, 0xec, 0xd2, 0x1a, 0xf2, 0xc6, 0xf0, 0x20, 0x0f, 0x01,
-  0x00, 0x82, 0x90, 0x17, 0xe5, 0x06, 0x8a, 0xc4, 0x44, 0x16, 0x25, 0x40,
-  0xd9, 0x1f, 0x10, 0x84, 0x40, 0x8d, 0x01, 0x4b, 0x81, 0xfc, 0x2b, 0x94,
-  0x59, 0x2f, 0x1c, 0x64, 0x81, 0x76, 0x4d, 0x16, 0x01, 0xf2, 0xff, 0x74,
-  0x36, 0x62, 0x05, 0xf3, 0xe2, 0x72, 0x0d, 0x77, 0x16, 0x7f, 0xf4, 0xdd,
-  0x91, 0xb8, 0x05, 0xd6, 0xb5, 0xff, 0x17, 0xcb, 0xf2, 0xf0, 0xea, 0x83,
-  0xc2, 0x01, 0x85, 0x05, 0x6c, 0x1d, 0xee, 0x43, 0x9b, 0x5f, 0xec, 0x74,
-  0xf8, 0x33, 0xff, 0x5b, 0x07, 0xf0, 0x11, 0x43, 0x31, 0xb3, 0x25, 0x72,
-  0x3d, 0xba, 0xb8, 0x23, 0x16, 0xff, 0x08, 0xe7, 0x40, 0x09, 0x61, 0x19,
-  0xff, 0x59, 0x37, 0xd1, 0x4b, 0x64, 0x3c, 0x09, 0x5a, 0xf0, 0x8b, 0x4e,
-  0xfa, 0x56, 0xf6, 0x88, 0xa4, 0xf6, 0x8f, 0xba, 0x64, 0x14, 0x1e, 0x6e,
-  0x02, 0x3b, 0xe7, 0x72, 0x10, 0xda, 0x77, 0x06, 0x07, 0x14, 0x61, 0x28,
-  0x17, 0x28, 0x9b, 0xb2, 0x03, 0xbe, 0xb6, 0x63, 0x5e, 0xc6, 0x0a, 0x40,
-  0xc3, 0x42, 0x30, 0x6b, 0x4b, 0x03, 0x16, 0x42, 0xd2, 0x0e, 0x4a, 0x5e,
-  0xe9, 0x95, 0xa1, 0x50, 0x6a, 0x20, 0xf6, 0x73, 0x26, 0x35, 0xc7, 0x8a,
-  0x88, 0x18, 0xdc, 0x24, 0xaa, 0x22, 0x32, 0x85, 0xd2, 0xff, 0x30, 0xbf,
-  0xd2, 0xde, 0x02, 0x63, 0xbd, 0x51, 0x82, 0x03, 0xf0, 0xaf, 0x83, 0x9e,
-  0x25, 0xe4, 0x02, 0xe6, 0x12, 0xc6, 0xdc, 0xc4, 0x9b, 0x54, 0xf1, 0x93,
-  0x12, 0x15, 0xc3, 0xdc, 0x71, 0x0b, 0x09, 0x8b, 0x62, 0x33, 0xaa, 0xc4,
-  0x72, 0xb6, 0x7e, 0xcc, 0x72, 0xaf, 0x83, 0xbb, 0x03, 0xeb, 0x04, 0x9a,
-  0x09, 0xe8, 0x94, 0x23, 0x40, 0xb8, 0xae, 0xcc, 0x26, 0xe3, 0x5c, 0x01,
-  0x50, 0x05, 0x27, 0x98, 0x16, 0x27, 0x0e, 0xd9, 0xb8, 0x0d, 0xd3, 0x78,
-  0xeb, 0x58, 0xc1, 0xb6, 0xc9, 0x53, 0x08, 0x48, 0x16, 0x60, 0x0f, 0x66,
-  0x4d, 0x03, 0x18, 0xb0, 0x02, 0xba, 0xb1, 0x2a, 0xb3, 0xfb, 0x31, 0x10,
-  0x53, 0x82, 0x27, 0xc6, 0x10, 0x93, 0x5a, 0xa0, 0x51, 0x51, 0x81, 0xdf,
-  0xdb, 0x24, 0x4e, 0x0e, 0x2c, 0x10, 0x55, 0x1b, 0x0a, 0xdc, 0x25, 0xbb,
-  0x92, 0xd5, 0x02, 0xc9, 0xc4, 0x15, 0xaf, 0x66, 0x00, 0xbf, 0xbc, 0xf6,
-  0x46, 0xe7, 0x08, 0x75, 0xfb, 0x2a, 0x80, 0x7e, 0xdc, 0x2e, 0x11, 0x5b,
-  0x05, 0xdd, 0xec, 0x20, 0x74, 0x1e, 0x0b, 0x66, 0x0c, 0x63, 0x11, 0xde,
-  0x2b, 0x0b, 0xb9, 0xe7, 0x0f, 0x74, 0xb0, 0xdc, 0xe5, 0xdd, 0x2f, 0x54,
-  0x9a, 0x1a, 0xce, 0xef, 0x36, 0xb5, 0x02, 0x1e, 0xdd, 0x05, 0x04, 0x74,
-  0x43, 0x8f, 0x65, 0x9a, 0x73, 0x02, 0xd8, 0x8a, 0x14, 0xcc, 0x5e, 0x74,
-  0x29, 0xc0, 0xc7, 0x24, 0x6e, 0x5a, 0x74, 0xff, 0xc0, 0xbb, 0xe0, 0x04,
-  0x80, 0xc4, 0x5b, 0x45, 0x22, 0x75, 0x04, 0x2d, 0xa9, 0x16, 0x5b, 0x30,
-  0x15, 0x95, 0xbd, 0xb0, 0x51, 0x91, 0x25, 0x14, 0x6c, 0x36, 0x60, 0x0d,
-  0xc2, 0xc8, 0xd1, 0x16, 0x91, 0x0e, 0x1a, 0x2d, 0x09, 0x1f, 0xae, 0x1c,
-  0x05, 0x66, 0x3f, 0xe1, 0x10, 0xb7, 0x08, 0x16, 0x0f, 0x02, 0x45, 0xb5,
-  0xd6, 0x09, 0xa1, 0x11, 0xa8, 0x04, 0x3c, 0xf0, 0xcd, 0xff, 0x83, 0xf9,
-  0xf5, 0x36, 0x65, 0x00, 0x4a, 0xc5, 0x44, 0x82, 0x53, 0x10, 0x98, 0x64,
-  0x20, 0x99, 0xe0, 0x08, 0xdf, 0x31, 0x39, 0x0b, 0x96, 0xeb, 0x23, 0xe0,
-  0x23, 0xe1, 0x23, 0xe0, 0x23, 0xe1, 0x23, 0xe2, 0x23, 0xeb, 0x23, 0xe0,
-  0x3d, 0x04, 0xb0, 0x8b, 0x52, 0x96, 0x46, 0x0a, 0x3e, 0x2f, 0x4a, 0x02,
-  0xf0, 0xc6, 0x07, 0xca, 0xed, 0x24, 0x2d, 0x03, 0xc1, 0x22, 0x2d, 0x84,
-  0xee, 0xb2, 0x1c, 0x78, 0x9f, 0x1e, 0x2d, 0x3f, 0xf5, 0x75, 0x1a, 0x2e,
-  0x52, 0x2d, 0x43, 0x47, 0xd1, 0x8c, 0xaf, 0x9a, 0x15, 0x22, 0x7b, 0x5a,
-  0xb1, 0x1f, 0x09, 0x4c, 0x02, 0x8a, 0xb3, 0x65, 0xdb, 0x00, 0x02, 0xcd,
-  0x86, 0xd8, 0x00, 0xfe, 0xfa, 0x78, 0x22, 0x01, 0xd6, 0xd4, 0xc8, 0xc8,
-  0x08, 0x3f, 0x66, 0x8a, 0x86, 0x15, 0xfe, 0xf8, 0xb4, 0x00, 0x2d, 0xf0,
-  0x00, 0x29, 0x4c, 0xb9, 0x0f, 0x77, 0x53, 0xe2, 0x95, 0x6f, 0x7e, 0x8e,
-  0x2d, 0xeb, 0x35, 0x6c, 0x05, 0x9b, 0xb2, 0x2f, 0xcb, 0xa8, 0x29, 0x2c,
-  0xb5, 0xb6, 0x23, 0x63, 0xca, 0xc2, 0xcf, 0x4f, 0x9a, 0xb5, 0xec, 0x00,
-  0x08, 0x0e, 0x49, 0xed, 0x06, 0x1c, 0x96, 0xcf, 0x06, 0xd6, 0x88, 0x1e,
-  0xc9, 0xdc, 0x18, 0xc9, 0xf8, 0x8b, 0x79, 0xcd, 0x59, 0x01, 0x0d, 0x5a,
-  0x8f, 0x05, 0x4e, 0x00, 0x54, 0xd5, 0x00, 0x42, 0x5a, 0x1f, 0x88, 0x4e,
-  0x9f, 0x81, 0x0a, 0x94, 0x03, 0x6d, 0xba, 0x6c, 0x06, 0x0c, 0xc4, 0x0d,
-  0x77, 0xa1, 0x3a, 0x07, 0x75, 0x88, 0x60, 0xb1, 0x46, 0xbf, 0x0e, 0x0e,
-  0x3b, 0x47, 0x52, 0xf9, 0xd9, 0x50, 0x0f, 0xc9, 0x11, 0xf2, 0x03, 0x75,
-  0x40, 0x72, 0x13, 0x7c, 0x05, 0x75, 0x30, 0x9c, 0x16, 0x9f, 0x07, 0x75,
-  0x20, 0x27, 0x18, 0x27, 0x09, 0xc9, 0x75, 0x10, 0xc9, 0x1a, 0xe3, 0x0b,
-  0x74, 0x02, 0x09, 0x0b, 0x2f, 0x04, 0x9b, 0x04, 0xfc, 0xfd, 0x20, 0x5d,
-  0x53, 0x83, 0x15, 0x0a, 0x18, 0x92, 0xa0, 0xc2, 0x67, 0xef, 0xdf, 0x38,
-  0x8c, 0xfb, 0xe8, 0x17, 0x50, 0x30, 0x42, 0xf9, 0x1e, 0x02, 0x4c, 0xa8,
-  0x0e, 0xf6, 0x3f, 0x24, 0xc2, 0xba, 0x71, 0xf7, 0x11, 0xfe, 0x3a, 0x27,
-  0x22, 0x48, 0x54, 0x5b, 0x79, 0x1e, 0x46, 0x39, 0xac, 0x79, 0x1c, 0xe1,
-  0x02, 0xe8, 0xf6, 0x82, 0x0e, 0x32, 0x5b, 0x28, 0x15, 0x2f, 0x83, 0x7d,
-  0xdb, 0x93, 0x0d, 0x01, 0xc2, 0x47, 0x59, 0x23, 0xf6, 0x05, 0x90, 0x9a,
-  0xcb, 0xee, 0xf0, 0x02, 0x1b, 0xca, 0xf0, 0xea, 0x08, 0xea, 0x8d, 0x64,
-  0x57, 0x14, 0x41, 0x16, 0x0d, 0xde, 0x74, 0xb6, 0x10, 0xb0, 0xee, 0x58,
-  0xf0, 0x34, 0x58, 0x50, 0x62, 0xbd, 0x88, 0xaf, 0xc0, 0xdd, 0x2c, 0x01,
-  0x1a, 0x01, 0x4d, 0xeb, 0x20, 0xba, 0x01, 0x15, 0x25, 0xd5, 0x0a, 0x0a,
-  0xfb, 0xd9, 0x59, 0xf4, 0xef, 0xe6, 0x04, 0x89, 0xe8, 0x48, 0x86, 0x49,
-  0xf0, 0x01, 0x76, 0xea, 0x2d, 0x71, 0xec, 0xd3, 0x13, 0xe2, 0xcd, 0xe4,
-  0xbc, 0x86, 0x00, 0x2c, 0x95, 0xe2, 0x9f, 0x68, 0x03, 0x56, 0xe2, 0xb5,
-  0x13, 0x16, 0x33, 0x6d, 0xfb, 0x29, 0x7c, 0x25, 0xfb, 0xd2, 0xec, 0xc8,
-  0xea, 0x56, 0xd9, 0x1f, 0xfc, 0x70, 0xfa, 0x2b, 0x6d, 0xe3, 0x1b, 0xb6,
-  0x7a, 0x3b, 0xd2, 0xe0, 0x75, 0x2f, 0x5a, 0xce, 0xf6, 0x51, 0x65, 0x33,
-  0xb9, 0x3e, 0x36, 0x6a, 0x62, 0x08, 0x49, 0x6c, 0x01, 0xbb, 0x35, 0x43,
-  0xff, 0xff, 0x2f, 0xeb, 0x28, 0x44, 0x17, 0x35, 0x30, 0x2a, 0xa7, 0x18,
-  0xff, 0x9a, 0x81, 0x02, 0x25, 0x49, 0x9a, 0xf8, 0xe2, 0x66, 0xbf, 0xb4,
-  0xf8, 0x4b, 0x45, 0xe4, 0x96, 0x76, 0x3a, 0x7d, 0x76, 0xe2, 0xdb, 0x09,
-  0x30, 0xff, 0x1b, 0x66, 0xe6, 0x6a, 0xef, 0x0d, 0x71, 0x4b, 0x17, 0x48,
-  0xb6, 0x99, 0x81, 0xe8, 0xe9, 0x20, 0x05, 0xf3, 0x46, 0xe6, 0x60, 0xfb,
-  0xfe, 0xc2, 0x5d, 0xd3, 0xc8, 0x29, 0xde, 0x72, 0xea, 0x2d, 0xc8, 0x34,
-  0x42, 0x11, 0xe5, 0x88, 0x1a, 0xc3, 0x16, 0xce, 0x01, 0x0e, 0x00, 0x8c,
-  0xad, 0xc4, 0x84, 0x6c, 0xc4, 0x06, 0x88, 0x0f, 0x29, 0x0d, 0x43, 0xd8,
-  0x4a, 0x8c, 0xb3, 0xb8, 0x16, 0xb0, 0x0c, 0x0c, 0xb1, 0x0e, 0x11, 0x20,
-  0x08, 0xf9, 0x1b, 0x01, 0xf6, 0x1b, 0x60, 0x43, 0x8c, 0x84, 0x5a, 0x17,
-  0x0d, 0xd2, 0x92, 0xb2, 0xb1, 0xd1, 0x69, 0xd6, 0x41, 0x3d, 0xa6, 0x0f,
-  0x88, 0x2f, 0x2a, 0xf4, 0x0b, 0x1d, 0x5e, 0x05, 0x62, 0x0e, 0x26, 0x33,
-  0x62, 0x11, 0x82, 0xc2, 0xbe, 0x7f, 0x16, 0xac, 0x6b, 0xa3, 0xae, 0x6b,
-  0x61, 0x11, 0x32, 0xb0, 0xc8, 0xb2, 0x5c, 0xb4, 0xb2, 0xb6, 0x68, 0x8a,
-  0x40, 0xdc, 0xed, 0x1e, 0x3b, 0x73, 0x9f, 0x17, 0x37, 0x0e, 0xb4, 0x38,
-  0x06, 0x45, 0x28, 0x89, 0xf6, 0x0b, 0xda, 0xc4, 0x1e, 0x3f, 0x8d, 0x5d,
-  0x8a, 0x1f, 0x84, 0xca, 0x16, 0x1a, 0x57, 0x5f, 0xb2, 0x04, 0x46, 0xec,
-  0x10, 0x3c, 0x09, 0xdc, 0x5f, 0x08, 0xe0, 0xa4, 0xbf, 0xb4, 0x60, 0x23,
-  0xc9, 0xfc, 0x8c, 0x09, 0xd0, 0x53, 0x5a, 0xa2, 0x32, 0xcc, 0x91, 0x23,
-  0x52, 0x96, 0x15, 0x0d, 0x8e, 0x6d, 0x0d, 0x7e, 0x34, 0x52, 0xa4, 0x6d,
-  0x41, 0x08, 0x3a, 0x3e, 0xa2, 0x00, 0x4a, 0x0e, 0x4e, 0x0f, 0x88, 0xc0,
-  0x3b, 0xf5, 0xeb, 0xc9, 0x13, 0x13, 0x56, 0x80, 0x96, 0xda, 0x0f, 0x40,
-  0x89, 0xc1, 0xef, 0xc7, 0x0f, 0xad, 0xf6, 0x38, 0x12, 0x5a, 0xc1, 0x0d,
-  0x43, 0x14, 0x01, 0xe8, 0x5c, 0x82, 0x0a, 0xbc, 0x7d, 0x15, 0x30, 0x28,
-  0x0e, 0x12, 0x88, 0x89, 0x58, 0x68, 0x0a, 0x85, 0x80, 0xba, 0x74, 0x12,
-  0xfa, 0x50, 0x42, 0x26, 0xb6, 0x34, 0x8e, 0xc2, 0x53, 0x41, 0x57, 0x61,
-  0xc3, 0x06, 0x9f, 0x8a, 0x04, 0xd3, 0xa4, 0x1f, 0x1a, 0x2b, 0x67, 0xfc,
-  0x56, 0x7b, 0xfa, 0x9d, 0x23, 0x5f, 0x86, 0x13, 0x6c, 0x92, 0x0e, 0x97,
-  0x0c, 0xc7, 0x72, 0xd0, 0x94, 0x84, 0x13, 0x1b, 0x42, 0xd1, 0xd1, 0x21,
-  0x88, 0xd1, 0xd7, 0x45, 0x9c, 0xa6, 0x74, 0x45, 0xe0, 0x6e, 0xd4, 0xb4,
-  0xda, 0xeb, 0x86, 0x01, 0x16, 0xa0, 0x01, 0x28, 0x96, 0x2f, 0x73, 0x95,
-  0xe4, 0xa3, 0x80, 0x44, 0xb0, 0xbe, 0x50, 0x87, 0x02, 0x68, 0x23, 0x0a,
-  0x19, 0x3d, 0xb1, 0x19, 0x75, 0x49, 0x57, 0x87, 0x4a, 0x62, 0x8c, 0xff,
-  0x59, 0x38, 0xba, 0x36, 0xfe, 0xc9, 0xd4, 0xfd, 0xd5, 0x2d, 0x01, 0x54,
-  0x83, 0x4a, 0x0b, 0xba, 0xd2, 0x0e, 0x81, 0x37, 0xce, 0xf7, 0xeb, 0x82,
-  0x75, 0xfb, 0x1f, 0x56, 0x51, 0x00, 0x6f, 0x84, 0x19, 0x7c, 0x51, 0x56,
-  0x87, 0x10, 0x20, 0xc5, 0x03, 0x1a, 0x75, 0xdf, 0x52, 0xe9, 0x04, 0x75,
-  0x37, 0x78, 0x74, 0x2c, 0x6e, 0xec, 0x43, 0x3a, 0x6d, 0x08, 0x08, 0x9a,
-  0x5b, 0x59, 0x07, 0x3c, 0x85, 0x19, 0x58, 0x87, 0xfe, 0xda, 0x62, 0x1f,
-  0xc5, 0x29, 0x16, 0xcb, 0x08, 0x82, 0xf8, 0xfe, 0x86, 0x07, 0x41, 0x88,
-  0x0a, 0x86, 0xb8, 0xb0, 0x76, 0x84, 0x85, 0xbb, 0x68, 0xfe, 0xfe, 0x85,
-  0x29, 0xc8, 0x8a, 0xfe, 0x79, 0xe1, 0xfe, 0x28, 0x98, 0x4e, 0x00, 0x5a,
-  0x42, 0x86, 0xaa, 0xdd, 0x68, 0x74, 0x19, 0x30, 0xee, 0x43, 0x53, 0xb3,
-  0x86, 0x40, 0x63, 0x5f, 0x81, 0x8f, 0xfe, 0x0b, 0x40, 0xb8, 0x3e, 0x85,
-  0xfe, 0x00, 0xc2, 0x4a, 0xc0, 0x9a, 0x6b, 0xfc, 0xca, 0xb0, 0xff, 0x58,
-  0x78, 0x5a, 0xdd, 0xd3, 0xe4, 0x16, 0x16, 0xf8, 0x18, 0x00, 0x9e, 0x9f,
-  0x15, 0x3a, 0x75, 0xff, 0xa6, 0x86, 0x90, 0x12, 0x1c, 0x5a, 0x01, 0x44,
-  0x5f, 0xe0, 0x0b, 0x94, 0x75, 0x6d, 0x85, 0x77, 0xb8, 0x61, 0x46, 0x01,
-  0x88, 0xb6, 0x92, 0x10, 0x42, 0x5a, 0x0c, 0xc2, 0x13, 0xe8, 0xa5, 0x03,
-  0xd5, 0xf9, 0x7c, 0x0b, 0x7f, 0x03, 0xff, 0x8b, 0xda, 0x5a, 0x8b, 0xc8,
-  0x58, 0x03, 0xc1, 0xfe, 0x13, 0xd3, 0xb1, 0x02, 0x9a, 0x44, 0x3a, 0xf5,
-  0x36, 0x08, 0xf9, 0xec, 0xb1, 0x05, 0x0e, 0x77, 0x5b, 0x59, 0x1b, 0xa9,
-  0xd3, 0x35, 0x7f, 0x41, 0x7f, 0x17, 0x75, 0x3e, 0xff, 0x77, 0x9a, 0x36,
-  0xf8, 0xa0, 0xc0, 0x42, 0x3d, 0xae, 0x00, 0x88, 0x3d, 0x85, 0xbe, 0x56,
-  0xa9, 0x88, 0x8e, 0xcf, 0xd2, 0xf6, 0x52, 0x0c, 0x6c, 0xe7, 0x24, 0x5b,
-  0xd0, 0xef, 0xa3, 0x0e, 0x70, 0x38, 0x11, 0xa5, 0xcc, 0x88, 0x2e, 0x41,
-  0x2f, 0xdb, 0xb8, 0x13, 0x95, 0x4b, 0x73, 0xac, 0x31, 0x37, 0x25, 0x4d,
-  0xd3, 0x06, 0x73, 0x10, 0x52, 0x08, 0xd8, 0x4c, 0xf9, 0x06, 0x00, 0x07,
-  0x0f, 0x66, 0x0e, 0x96, 0x26, 0x2f, 0x4b, 0x84, 0x15, 0x32, 0x34, 0x84,
-  0x8d, 0xf6, 0xe9, 0xbd, 0xfe, 0x0f, 0x02, 0x95, 0xba, 0xb3, 0x32, 0x51,
-  0x80, 0xc8, 0x95, 0xe9, 0x28, 0x75, 0x81, 0x69, 0x2b, 0x25, 0x05, 0x83,
-  0x6f, 0x9a, 0xb8, 0xab, 0x2b, 0x18, 0x64, 0xe8, 0x91, 0x00, 0xe9, 0x3a,
-  0xd8, 0x08, 0x71, 0x74, 0x6c, 0xbe, 0x5e, 0xe3, 0x10, 0x74, 0x64, 0x8d,
-  0x18, 0x96, 0xe3, 0x5e, 0x8d, 0x2a, 0x91, 0xd8, 0x96, 0xd9, 0x52, 0xc6,
-  0x0b, 0x0c, 0x66, 0x11, 0x32, 0xda, 0xcd, 0x40, 0xe5, 0xde, 0x74, 0x3a,
-  0x4c, 0xa4, 0xba, 0x09, 0xa9, 0x1e, 0xac, 0x2c, 0x57, 0xbf, 0x4c, 0xb9,
-  0x2a, 0xc1, 0x72, 0x14, 0xa0, 0x12, 0x8b, 0xd1, 0x6c, 0xf5, 0x9c, 0xe0,
-  0x01, 0xe1, 0xe4, 0x59, 0x6b, 0x20, 0x07, 0x78, 0x95, 0x07, 0xb2, 0x08,
-  0x0a, 0x31, 0xfe, 0x32, 0xf6, 0x16, 0x31, 0x07, 0x88, 0x84, 0xae, 0x6d,
-  0xe5, 0x0c, 0x91, 0xfe, 0x9c, 0x0a, 0x47, 0x73, 0x30, 0xc7, 0x91, 0x20,
-  0x4c, 0xa8, 0x81, 0x5a, 0xc4, 0xdb, 0x1d, 0x26, 0x88, 0x29, 0xc0, 0x50,
-  0x88, 0x53, 0xa9, 0xb9, 0x58, 0x7a, 0xdb, 0x0b, 0x08, 0x7d, 0x50, 0x16,
-  0xa3, 0x0a, 0xc9, 0xcf, 0x47, 0xab, 0xa6, 0x97, 0xb5, 0x05, 0x4f, 0xc8,
-  0x4e, 0x88, 0x79, 0xfb, 0x08, 0xd9, 0x50, 0x6c, 0x3e, 0x09, 0x62, 0x3c,
-  0x84, 0xaa, 0xe8, 0x1e, 0x5c, 0xae, 0x57, 0x1c, 0x9c, 0x1e, 0x12, 0x32,
-  0xb6, 0x12, 0x3b, 0xd1, 0x0e, 0x9d, 0xb0, 0x23, 0x95, 0x20, 0xf2, 0x77,
-  0x0d, 0x72, 0x35, 0x73, 0x04, 0x20, 0x2c, 0x60, 0x2c, 0x70, 0x7f, 0x19,
-  0xd1, 0xe8, 0x25, 0x7f, 0x00, 0x63, 0xfc, 0x57, 0x6f, 0x0b, 0xea, 0x81,
-  0xe2, 0x6f, 0x0c, 0x3b, 0xc2, 0x76, 0x11, 0xfb, 0xb3, 0x69, 0x01, 0x22,
-  0x20, 0x41, 0x2d, 0x5f, 0x42, 0xe8, 0x1f, 0xf1, 0x46, 0xcd, 0x75, 0x44,
-  0x91, 0x0f, 0xf3, 0x8b, 0x57, 0x18, 0xd3, 0x4e, 0x0f, 0x08, 0x56, 0x7f,
-  0x20, 0x44, 0xb9, 0x42, 0x0a, 0x7b, 0xcf, 0x62, 0x18, 0x25, 0xb0, 0x1f,
-  0x60, 0x6d, 0x18, 0x3c, 0x9d, 0x1f, 0xb9, 0x1b, 0x7b, 0xff, 0x08, 0x5d,
-  0x37, 0xc7, 0xb3, 0x00, 0x9a, 0x95, 0x17, 0xec, 0x01, 0x21, 0x96, 0x0f,
-  0xde, 0xea, 0x01, 0xc9, 0x43, 0xd8, 0x37, 0xff, 0x27, 0x00, 0xdb, 0x73,
-  0xa8, 0x78, 0x27, 0x16, 0x23, 0x3f, 0x20, 0xcf, 0x16, 0x3f, 0x67, 0x48,
-  0xee, 0xb2, 0xfe, 0x21, 0x25, 0xd6, 0x42, 0x35, 0x69, 0x76, 0x16, 0x63,
-  0x4d, 0x16, 0x93, 0x85, 0xb1, 0xb0, 0xfe, 0x1b, 0x84, 0x21, 0x90, 0x63,
-  0x07, 0x98, 0x07, 0x62, 0xd4, 0x8a, 0x09, 0x39, 0x70, 0xf6, 0x68, 0x99,
-  0x03, 0x53, 0x01, 0x54, 0x5b, 0x34, 0x2e, 0x02, 0x7c, 0xcf, 0x31, 0x59,
-  0x10, 0x4f, 0x52, 0x6f, 0x04, 0x22, 0x34, 0x96, 0x28, 0x12, 0x00, 0xee,
-  0xa0, 0x20, 0x75, 0x0b, 0xed, 0x15, 0x01, 0x74, 0xad, 0x1b, 0x46, 0xd8,
-  0x20, 0x46, 0x1a, 0x73, 0x33, 0xb6, 0x21, 0x2c, 0x69, 0x02, 0x6f, 0x25,
-  0x1b, 0x80, 0xeb, 0x21, 0x39, 0x57, 0x2f, 0xa8, 0xdc, 0xc7, 0x03, 0xd8,
-  0x49, 0x3a, 0xac, 0xf1, 0x35, 0xc0, 0x25, 0x24, 0x9b, 0x71, 0x7c, 0xdc,
-  0x02, 0xca, 0xc0, 0x0f, 0x87, 0xb8, 0x18, 0xd7, 0x01, 0x56, 0x6a, 0x89,
-  0x97, 0x09, 0xbd, 0x13, 0x4a, 0xef, 0x65, 0x40, 0xd8, 0x74, 0xf2, 0x74,
-  0x8b, 0x12, 0xc1, 0x09, 0xf0, 0x8c, 0xb3, 0xc1, 0xe2, 0x1c, 0x40, 0x81,
-  0x73, 0xc3, 0xff, 0x40, 0x52, 0x05, 0x98, 0xb3, 0x30, 0x2a, 0xd5, 0x86,
-  0x6e, 0xf6, 0xf3, 0x2b, 0x03, 0x97, 0x3a, 0x4d, 0xe8, 0xd6, 0x6d, 0x05,
-  0x5f, 0xcf, 0xfc, 0x0c, 0xd9, 0x7c, 0xf6, 0x53, 0xa4, 0xf2, 0xc5, 0xec,
-  0x19, 0x47, 0x04, 0x05, 0x96, 0xf7, 0xc0, 0x49, 0x64, 0x4d, 0xb6, 0x15,
-  0xc8, 0x0c, 0x72, 0x37, 0x60, 0x74, 0xba, 0x44, 0x9d, 0x41, 0xbd, 0x62,
-  0x5b, 0x04, 0x49, 0xe7, 0xf8, 0xc4, 0xfa, 0x52, 0x18, 0x37, 0x1b, 0x1f,
-  0x03, 0x9e, 0xfc, 0xfe, 0x0c, 0x3d, 0x3f, 0x3c, 0x03, 0x2c, 0x1b, 0x03,
-  0xb0, 0x01, 0x20, 0x03, 0xd5, 0x12, 0x8d, 0xd4, 0x75, 0x46, 0x14, 0x66,
-  0x54, 0x8a, 0xeb, 0x7e, 0x10, 0x34, 0x6a, 0x0e, 0xe5, 0x86, 0x67, 0x4c,
-  0xff, 0x0d, 0xd8, 0x14, 0x2d, 0x12, 0x01, 0x22, 0xf1, 0x84, 0xad, 0x55,
-  0xe8, 0x02, 0xe9, 0xc6, 0xfc, 0x66, 0xef, 0xc0, 0x75, 0x00, 0x85, 0x38,
-  0xc8, 0x51, 0xc5, 0x12, 0x83, 0xf3, 0x0b, 0x42, 0x34, 0x23, 0x7a, 0x6c,
-  0xf4, 0x71, 0xb4, 0x4c, 0xe4, 0x04, 0x93, 0x0d, 0x51, 0x97, 0x91, 0x53,
-  0xb9, 0x06, 0x11, 0xdc, 0xb6, 0xe2, 0x03, 0xc2, 0x40, 0x7c, 0x8a, 0x04,
-  0x12, 0xce, 0x10, 0xd5, 0x0e, 0x58, 0x0e, 0xc0, 0x0c, 0xe2, 0x28, 0x85,
-  0xbd, 0x50, 0x3d, 0xd9, 0x07, 0x10, 0x1c, 0x01, 0x36, 0x0a, 0x28, 0x02,
-  0x16, 0x09, 0x08, 0x22, 0x32, 0x0c, 0x16, 0x6b, 0x6b, 0x6b, 0x38, 0x02,
-  0xd5, 0x43, 0x01, 0x35, 0xf7, 0x7e, 0x8e, 0x34, 0x47, 0x06, 0xca, 0x2e,
-  0xdb, 0x0c, 0x0a, 0x33, 0x30, 0xb0, 0x14, 0x07, 0x42, 0x58, 0x6c, 0x85,
-  0x27, 0xf2, 0x01, 0x0a, 0x5c, 0x2c, 0x1b, 0xe0, 0x3b, 0x84, 0x9f, 0x91,
-  0x09, 0x4c, 0x08, 0xa4, 0x3b, 0xb4, 0xb8, 0x5c, 0x51, 0xff, 0x81, 0x54,
-  0x82, 0xa1, 0x62, 0x12, 0x4a, 0xc6, 0x03, 0x5d, 0x2e, 0x47, 0xbb, 0x40,
-  0x12, 0x67, 0x0a, 0x9a, 0x27, 0xf2, 0x6c, 0x42, 0xf4, 0xb2, 0xf2, 0xc0,
-  0xf4, 0x3e, 0xec, 0xe3, 0x01, 0x00, 0xad, 0x99, 0x90, 0x57, 0x60, 0x0e,
-  0x2c, 0xb6, 0x96, 0x1f, 0xe2, 0x72, 0x3f, 0x9b, 0x43, 0xf2, 0x72, 0xb0,
-  0x38, 0x1d, 0x36, 0x97, 0x05, 0xaa, 0xe7, 0x0a, 0x7a, 0x00, 0x13, 0x81,
-  0x61, 0x8c, 0xd1, 0x46, 0xd5, 0x11, 0x10, 0x58, 0xa6, 0xd1, 0xc7, 0x8d,
-  0x17, 0x7e, 0x10, 0x65, 0xe7, 0xfa, 0x3b, 0xd6, 0x7f, 0x89, 0x0d, 0xe8,
-  0xab, 0xde, 0xf6, 0x9e, 0x24, 0xfd, 0x1e, 0x75, 0x22, 0xae, 0x0b, 0x08,
-  0x64, 0x8a, 0x6e, 0xf3, 0x45, 0x82, 0x09, 0x20, 0xe0, 0xaf, 0x01, 0x6e,
-  0xc6, 0x94, 0x2e, 0xa5, 0x2b, 0xaa, 0x4f, 0x8d, 0x2b, 0x91, 0xd2, 0x09,
-  0xc7, 0x4d, 0x33, 0x9f, 0x22, 0x2c, 0xc7, 0x06, 0x68, 0x06, 0x06, 0x57,
-  0xa8, 0x48, 0xac, 0x74, 0x03, 0x80, 0xda, 0x8e, 0xb9, 0x78, 0x22, 0x0d,
-  0xbb, 0xd7, 0xf4, 0xfe, 0x12, 0x8f, 0xd8, 0x9f, 0x0a, 0x0c, 0x52, 0x60,
-  0x58, 0x79, 0x5b, 0x03, 0x0e, 0x10, 0x4e, 0x09, 0x4f, 0x56, 0xeb, 0xa7,
-  0xa8, 0x8b, 0x62, 0x88, 0xc8, 0x3e, 0x51, 0x97, 0x8c, 0xf7, 0x43, 0xe2,
-  0x61, 0x1b, 0xff, 0x64, 0x00, 0xa6, 0x03, 0x42, 0xa5, 0x12, 0x86, 0x17,
-  0x56, 0x01, 0x94, 0x96, 0xa7, 0x51, 0x81, 0x65, 0x5c, 0x75, 0xae, 0x2e,
-  0x19, 0xa4, 0x37, 0xce, 0x0b, 0x4e, 0x1f, 0x88, 0x59, 0x62, 0x06, 0x16,
-  0xf1, 0xb7, 0x03, 0x92, 0x2e, 0x43, 0x32, 0x01, 0x7e, 0xdb, 0x15, 0x08,
-  0x27, 0xa8, 0x34, 0xa6, 0xb3, 0x1f, 0xa8, 0xc9, 0xab, 0xbc, 0x43, 0x22,
-  0x15, 0xd6, 0x99, 0x0c, 0x4a, 0xcd, 0xef, 0x96, 0x27, 0xc6, 0x64, 0x87,
-  0x5c, 0x05, 0xa0, 0xe6, 0xdf, 0x88, 0xe4, 0x12, 0x2f, 0xbc, 0x2d, 0x2f,
-  0x80, 0xc5, 0x4b, 0x00, 0xd3, 0xfc, 0x73, 0xc1, 0xed, 0x09, 0x5d, 0x3b,
-  0x67, 0x0f, 0x6c, 0xf5, 0xeb, 0x5b, 0x18, 0xab, 0x7e, 0x40, 0x11, 0xeb,
-  0xed, 0xc1, 0x0c, 0xfc, 0x79, 0x05, 0x27, 0x10, 0xeb, 0xe0, 0x83, 0x99,
-  0x3c, 0xd3, 0x83, 0xb9, 0x3c, 0xc6, 0x83, 0x42, 0xcb, 0x02, 0x84, 0xb9,
-  0x60, 0x40, 0xf2, 0x0a, 0x00, 0xee, 0xd8, 0xac, 0x0c, 0x33, 0x68, 0xd8,
-  0x9f, 0x6b, 0x3e, 0x11, 0x05, 0x3f, 0x16, 0x50, 0x4f, 0x35, 0x9a, 0xf6,
-  0xa6, 0x00, 0xf4, 0x16, 0xe9, 0xf8, 0x01, 0xdb, 0x17, 0x9a, 0xd1, 0x97,
-  0x2b, 0x55, 0xea, 0x3c, 0x49, 0x2f, 0x90, 0x85, 0xa3, 0xb5, 0x5a, 0x9e,
-  0x6e, 0xa8, 0x00, 0x81, 0x23, 0xdb, 0x7d, 0x9b, 0x00, 0xa8, 0x00, 0x8d,
-  0xfa, 0x10, 0x16, 0xc5, 0xc8, 0x02, 0x1d, 0xf0, 0xae, 0xb2, 0xc3, 0x0b,
-  0x0b, 0xf0, 0x2c, 0xf2, 0xb2, 0xf0, 0xc8, 0xf2, 0xd1, 0xaf, 0x80, 0x4c,
-  0xc0, 0x92, 0x18, 0x37, 0xa4, 0xed, 0xc1, 0x26, 0x67, 0xb4, 0x26, 0x70,
-  0x95, 0x06, 0xcf, 0x96, 0x7c, 0x5e, 0x88, 0x8c, 0x56, 0x68, 0x74, 0xb3,
-  0xdb, 0x59, 0x15, 0xc8, 0xb8, 0xc0, 0x08, 0x59, 0x42, 0x81, 0xca, 0x2d,
-  0x87, 0x40, 0x0e, 0x2c, 0x10, 0xf3, 0x1c, 0x49, 0x16, 0xd4, 0x14, 0x04,
-  0x8a, 0x23, 0x33, 0xd4, 0xc4, 0xe9, 0x7d, 0xbd, 0xa4, 0x19, 0xe9, 0x73,
-  0xb6, 0x04, 0x22, 0x3d, 0x6c, 0x56, 0x2d, 0x0e, 0x2a, 0x15, 0xf3, 0x01,
-  0x4a, 0xcc, 0x11, 0x11, 0x5c, 0x8f, 0x04, 0xfc, 0xb6, 0xe2, 0xcf, 0xf6,
-  0xf8, 0x50, 0x91, 0xa8, 0x88, 0xf1, 0x89, 0x1e, 0x73, 0xa5, 0xdb, 0x50,
-  0x92, 0xa8, 0x20, 0xed, 0xa9, 0xe9, 0x4f, 0x42, 0xa9, 0xcd, 0xfa, 0xfc,
-  0x4d, 0xe8, 0x7d, 0x04, 0x78, 0x12, 0x0b, 0x3a, 0x15, 0x09, 0xa8, 0x18,
-  0x58, 0x0e, 0x9e, 0x3a, 0x50, 0xf4, 0x5a, 0xf2, 0x84, 0x76, 0x9b, 0x44,
-  0x10, 0x35, 0x09, 0x76, 0x0d, 0x2d, 0xd2, 0x47, 0xfe, 0x5a, 0x2c, 0x51,
-  0x86, 0x86, 0x01, 0x2a, 0x94, 0x36, 0x56, 0xf6, 0x01, 0x23, 0x0c, 0x19,
-  0xfa, 0x5a, 0x7f, 0x23, 0x7c, 0x1b, 0x3b, 0xa4, 0x54, 0x2c, 0x56, 0x75,
-  0xf2, 0xee, 0xec, 0x6b, 0xff, 0xa0, 0x06, 0x72, 0x48, 0x3a, 0x06, 0x0d,
-  0xe4, 0x85, 0xe9, 0x33, 0x65, 0x92, 0x33, 0x07, 0x3a, 0x75, 0x26, 0xc8,
-  0x94, 0x36, 0x67, 0xef, 0xf0, 0xfe, 0x95, 0x90, 0x75, 0xa7, 0xf8, 0x77,
-  0xa2, 0x1f, 0x8e, 0x9b, 0xec, 0xf6, 0x73, 0x18, 0xa7, 0x0e, 0x6e, 0x49,
-  0xb5, 0x64, 0x78, 0xa1, 0x35, 0xc6, 0xd4, 0x16, 0x60, 0x13, 0x09, 0xf0,
-  0x00, 0xe1, 0x10, 0x59, 0x1e, 0xb6, 0x9f, 0xf0, 0x27, 0xb8, 0x4a, 0x37,
-  0xa2, 0xd1, 0xc6, 0x2b, 0x0b, 0x07, 0x1a, 0x53, 0xf1, 0x56, 0x8c, 0x8b,
-  0x0d, 0xc2, 0xa9, 0x92, 0xfb, 0x9a, 0x3a, 0x01, 0x2f, 0x47, 0xc7, 0x02,
-  0x0c, 0x18, 0x15, 0x08, 0xc6, 0x46, 0x8b, 0xdd, 0x64, 0x04, 0x07, 0x72,
-  0x9a, 0xb8, 0x63, 0x39, 0x02, 0xf7, 0x6a, 0xbc, 0x65, 0x45, 0x9c, 0xce,
-  0x45, 0x20, 0x32, 0xc0, 0xfe, 0x24, 0xc3, 0xfb, 0xb0, 0x01, 0x34, 0x1d,
-  0xf6, 0x35, 0xb2, 0xb5, 0x0b, 0xc5, 0xb9, 0x47, 0x62, 0xc0, 0x15, 0xca,
-  0x05, 0x11, 0xc9, 0x12, 0x28, 0x0a, 0xfa, 0xd0, 0x1c, 0x84, 0xe3, 0xa6,
-  0xb0, 0x46, 0xa9, 0xa0, 0x8c, 0x1c, 0x05, 0x56, 0x21, 0x00, 0x32, 0x55,
-  0x4a, 0xa2, 0x33, 0xb2, 0xa7, 0x6d, 0x5c, 0x16, 0x15, 0x5a, 0xac, 0x16,
-  0xae, 0xcf, 0xcc, 0x76, 0x00, 0x93, 0xa8, 0x34, 0x54, 0x93, 0x8a, 0x0a,
-  0x2a, 0xd6, 0x75, 0xea, 0x6a, 0x97, 0xc8, 0x77, 0x19, 0x9b, 0x72, 0x73,
-  0x12, 0x10, 0x22, 0x33, 0xde, 0xa9, 0x10, 0x72, 0xa0, 0x7f, 0x0e, 0x72,
-  0x99, 0x8b, 0x08, 0x33, 0x8b, 0xb1, 0x2d, 0xc0, 0xe8, 0x3c, 0x34, 0x00,
-  0x88, 0x4f, 0x42, 0x61, 0x94, 0x8b, 0xff, 0xb4, 0x2d, 0x35, 0x2b, 0xa2,
-  0x66, 0x0e, 0x2c, 0x29, 0xa5, 0x90, 0xb5, 0xde, 0xce, 0x20, 0x0c, 0x6b,
-  0xd5, 0x62, 0x49, 0x10, 0x50, 0x5e, 0x77, 0xc0, 0x16, 0x16, 0xe3, 0x60,
-  0x0c, 0x54, 0xa6, 0x32, 0xcb, 0x46, 0x10, 0x3b, 0x75, 0xcb, 0x76, 0xfc,
-  0x74, 0x15, 0xc8, 0x1c, 0x1c, 0xfa, 0x74, 0x81, 0x6b, 0x8c, 0xf8, 0xda,
-  0x61, 0xff, 0x10, 0x98, 0x91, 0x85, 0x3a, 0x72, 0x63, 0x17, 0x68, 0x09,
-  0x87, 0x53, 0xd2, 0x24, 0x38, 0x74, 0x19, 0x43, 0x77, 0xa0, 0x10, 0x3a,
-  0x9e, 0x0e, 0x43, 0x68, 0x9e, 0x48, 0x98, 0xc6, 0x30, 0xc9, 0xa1, 0xce,
-  0x9a, 0x10, 0x82, 0xb9, 0x01, 0x00, 0x1a, 0x88, 0x3d, 0x15, 0x6b, 0x78,
-  0xa2, 0x20, 0xe6, 0x0c, 0x60, 0xce, 0xbc, 0xa9, 0x20, 0x4d, 0x5d, 0x59,
-  0x98, 0x90, 0x4c, 0x79, 0x20, 0x4f, 0x30, 0x41, 0x85, 0x95, 0x2c, 0x2e,
-  0xba, 0x89, 0x67, 0x4c, 0x0e, 0x30, 0xd1, 0xc3, 0x74, 0x49, 0x6f, 0x38,
-  0x65, 0xff, 0x09, 0x36, 0x01, 0x96, 0x36, 0xf2, 0x6b, 0xf4, 0x04, 0xe7,
-  0xee, 0x95, 0xf0, 0x20, 0x9a, 0xcb, 0xd6, 0xd8, 0x09, 0x94, 0x0c, 0xd2,
-  0xb2, 0xd4, 0xcb, 0xd2, 0xd4, 0xc8, 0x75, 0x10, 0x4f, 0xe9, 0xae, 0x07,
-  0x61, 0xed, 0x2d, 0x1b, 0xc5, 0x74, 0x18, 0x92, 0x8f, 0x21, 0xec, 0x90,
-  0xad, 0x0e, 0x05, 0x4a, 0xcc, 0xbb, 0xb7, 0xb4, 0x04, 0x52, 0xe5, 0x74,
-  0x03, 0xb1, 0x69, 0x13, 0x07, 0x82, 0x58, 0x12, 0xc0, 0x2a, 0x87, 0x3b,
-  0x60, 0x3d, 0xf3, 0x93, 0x1a, 0xdd, 0x87, 0xce, 0x0d, 0x4d, 0x53, 0x85,
-  0x07, 0x5d, 0x96, 0xe2, 0xe4, 0x6f, 0x2f, 0x07, 0xb8, 0x17, 0x61, 0x75,
-  0x81, 0x3a, 0x61, 0x07, 0xd5, 0x2e, 0x6f, 0x7b, 0x6a, 0x43, 0xa8, 0xca,
-  0x7a, 0x69, 0x0e, 0x80, 0x49, 0xbb, 0x81, 0xfc, 0x2f, 0x0c, 0x1a, 0x83,
-  0x10, 0x93, 0x6c, 0xca, 0xa8, 0x86, 0xcc, 0x1a, 0x96, 0x0e, 0xa2, 0x24,
-  0x3d, 0x55, 0x62, 0xa8, 0xed, 0x2c, 0x5d, 0x03, 0xb2, 0x5a, 0xcc, 0xe0,
-  0xca, 0x01, 0x5a, 0x98, 0x11, 0xbb, 0x87, 0x76, 0xcc, 0x72, 0x36, 0x8b,
-  0x8f, 0x91, 0x9f, 0x21, 0xe9, 0xa0, 0x06, 0x10, 0x62, 0x92, 0x8b, 0x78,
-  0x11, 0x4c, 0x1e, 0xf6, 0x16, 0x73, 0x1e, 0x9a, 0xfb, 0x60, 0x66, 0xc4,
-  0xd9, 0xf9, 0xf0, 0x19, 0xee, 0xf4, 0x2d, 0x05, 0x58, 0xf4, 0xa2, 0xdc,
-  0x42, 0x72, 0x13, 0x04, 0xd6, 0xc6, 0xe2, 0x88, 0xb6, 0x11, 0xe4, 0x5b,
-  0xe2, 0x29, 0x41, 0xb2, 0xf1, 0x46, 0x1a, 0xa1, 0xb5, 0x54, 0x92, 0xf4,
-  0xc0, 0x56, 0xef, 0xd8, 0xca, 0x51, 0x56, 0xfe, 0x3b, 0x99, 0x02, 0xd2,
-  0x1c, 0x6c, 0x01, 0x4e, 0x8d, 0x02, 0x58, 0xc9, 0x06, 0xe9, 0x6e, 0xce,
-  0x09, 0x6e, 0xf9, 0x45, 0xfd, 0x43, 0xdb, 0x5f, 0xfe, 0x77, 0xd0, 0x2c,
-  0xce, 0x80, 0x72, 0xce, 0xa3, 0x8a, 0x9d, 0x02, 0xce, 0x56, 0x26, 0x6f,
-  0x41, 0xc4, 0x9a, 0x62, 0x8d, 0xb9, 0x0a, 0x83, 0x17, 0x01, 0x61, 0xf6,
-  0xb0, 0x17, 0xb6, 0x9c, 0x58, 0x6c, 0xb0, 0x37, 0x07, 0xec, 0x6e, 0xc6,
-  0x17, 0xb0, 0x20, 0xb6, 0x94, 0x60, 0x0f, 0x23, 0xf2, 0x3f, 0x01, 0x90,
-  0x1a, 0x0e, 0xdf, 0x04, 0xd9, 0xef, 0xd6, 0x6a, 0xd8, 0x2a, 0xc9, 0x07,
-  0x81, 0xd8, 0xeb, 0x79, 0xd6, 0x9a, 0x28, 0x1b, 0x08, 0x42, 0x2b, 0xe3,
-  0x9a, 0xfa, 0x04, 0x94, 0x58, 0x63, 0x73, 0xa2, 0xbe, 0xb4, 0x04, 0x42,
-  0x19, 0x07, 0x23, 0x09, 0xfc, 0xbc, 0x52, 0xe1, 0xfc, 0x22, 0x70, 0x60,
-  0x01, 0x98, 0x2f, 0x59, 0xfc, 0x0e, 0x63, 0x10, 0x02, 0x3d, 0xe9, 0xb5,
-  0xd0, 0x71, 0xf0, 0xb2, 0x26, 0xee, 0x01, 0xbc, 0x17, 0x20, 0x26, 0x1b,
-  0x17, 0xd9, 0xff, 0x61, 0x26, 0x21, 0xd8, 0x91, 0x03, 0x20, 0x61, 0x26,
-  0x29, 0xc9, 0x0d, 0x00, 0x77, 0x94, 0x26, 0xbe, 0x77, 0x04, 0x42, 0x16,
-  0xe9, 0x52, 0x12, 0x56, 0x2d, 0xe1, 0x72, 0x56, 0x0a, 0x70, 0x4b, 0x03,
-  0x83, 0x26, 0xee, 0x25, 0x4a, 0xd8, 0x89, 0x3a, 0xcc, 0xcd, 0x26, 0x1f,
-  0x13, 0x2b, 0xdb, 0xe9, 0x8f, 0x43, 0xf1, 0x80, 0xfb, 0x58, 0xb0, 0x8a,
-  0x1e, 0x00, 0xda, 0xc1, 0x98, 0x16, 0xf8, 0x00, 0xcb, 0x1d, 0xc2, 0xba,
-  0xfb, 0x22, 0xfa, 0x4b, 0x16, 0xdf, 0x47, 0xa9, 0xa1, 0xfb, 0xab, 0x65,
-  0xdc, 0x92, 0xda, 0x38, 0x06, 0x26, 0xd5, 0xc0, 0x75, 0x42, 0xb2, 0x06,
-  0x12, 0x01, 0x81, 0xce, 0x66, 0x0e, 0x8a, 0x10, 0x29, 0xf6, 0xd8, 0x0a,
-  0x2b, 0x6e, 0x30, 0x2c, 0x07, 0xd4, 0xd2, 0x68, 0x33, 0xd2, 0x54, 0x5e,
-  0x12, 0x1e, 0xa6, 0x3a, 0xd9, 0xde, 0x02, 0x80, 0xac, 0xb6, 0x8e, 0xea,
-  0x59, 0xec, 0x65, 0xec, 0x97, 0x0c, 0xea, 0xff, 0x74, 0xb1, 0x1b, 0xba,
-  0x10, 0xfb, 0xac, 0x8e, 0x52, 0x47, 0x01, 0x80, 0x19, 0x2f, 0x16, 0x27,
-  0x6a, 0x0f, 0xc5, 0x67, 0x4e, 0x00, 0xea, 0x03, 0x7e, 0x18, 0x41, 0x7d,
-  0xa4, 0x0f, 0xb1, 0x64, 0x0e, 0x7f, 0x06, 0xe9, 0x67, 0x02, 0xe9, 0x1f,
-  0xb3, 0x01, 0x2a, 0x1e, 0x50, 0x32, 0x38, 0x36, 0x17, 0x33, 0x01, 0xcb,
-  0xe0, 0xde, 0x21, 0x6c, 0x13, 0xc6, 0x50, 0x00, 0xec, 0x40, 0x01, 0x20,
-  0x2d, 0x98, 0xd6, 0xca, 0x50, 0x6c, 0x43, 0x26, 0x01, 0x18, 0x04, 0x4e,
-  0x46, 0x01, 0x30, 0x41, 0x61, 0x41, 0xa0, 0xa4, 0xfe, 0x91, 0x8c, 0x46,
-  0xb0, 0x8b, 0x27, 0x3a, 0x49, 0x2f, 0x41, 0xd8, 0x74, 0x1b, 0x48, 0x6c,
-  0x20, 0x73, 0xa2, 0x00, 0xc8, 0x08, 0xd8, 0x4c, 0xe1, 0x72, 0x04, 0x05,
-  0xa9, 0xcb, 0x9d, 0x61, 0xe6, 0x50, 0x8b, 0x17, 0xa9, 0x26, 0x7e, 0xcc,
-  0xd0, 0x34, 0x72, 0x18, 0xb9, 0x9d, 0xf9, 0x65, 0xe8, 0x90, 0xe6, 0x0e,
-  0xe6, 0xa2, 0xd0, 0xee, 0xb2, 0x42, 0xe8, 0xc8, 0xe6, 0x06, 0xf0, 0x17,
-  0x80, 0x42, 0x6f, 0x17, 0x08, 0x42, 0x42, 0xd9, 0x71, 0x19, 0x76, 0x2b,
-  0xf9, 0x23, 0x61, 0x45, 0x22, 0x5b, 0x29, 0x1e, 0x2c, 0x01, 0x95, 0x84,
-  0x48, 0xb7, 0x23, 0xcb, 0x1a, 0xdd, 0x84, 0xf8, 0x4b, 0x19, 0x47, 0xa4,
-  0xcc, 0x23, 0x6c, 0x2a, 0x0b, 0xb8, 0xb2, 0xf8, 0x59, 0x4e, 0xcc, 0x64,
-  0x1e, 0x21, 0x6c, 0x23, 0x0c, 0xbb, 0x8e, 0xf8, 0xf0, 0x06, 0x04, 0x42,
-  0x19, 0x03, 0x23, 0x56, 0x5c, 0x6a, 0xe1, 0x0d, 0xda, 0xeb, 0xd0, 0xf8,
-  0xb9, 0x0e, 0xd8, 0x07, 0xc8, 0xf8, 0x8c, 0x00, 0x0e, 0x7e, 0x29, 0x10,
-  0x2c, 0x53, 0x68, 0x82, 0xb6, 0x64, 0x82, 0x48, 0x38, 0xfd, 0x08, 0x5a,
-  0xf5, 0x8d, 0x54, 0x8e, 0xc0, 0xeb, 0xad, 0x6d, 0xd2, 0x8d, 0x02, 0x23,
-  0xba, 0x05, 0x04, 0xd6, 0x1a, 0x14, 0xe6, 0x82, 0xe5, 0x9e, 0xdc, 0x10,
-  0x82, 0x06, 0xf4, 0x8a, 0xf6, 0x5d, 0x15, 0x24, 0x00, 0xd2, 0x12, 0xc9,
-  0x32, 0x75, 0x4d, 0x74, 0x55, 0xcf, 0xf6, 0x66, 0x45, 0x92, 0xaa, 0x02,
-  0xe7, 0x99, 0x1e, 0xa3, 0x2a, 0x0f, 0xfc, 0x76, 0x47, 0xce, 0xa7, 0xad,
-  0xd0, 0xfa, 0x76, 0xe0, 0x55, 0x12, 0x0c, 0x25, 0x28, 0xd7, 0xc6, 0x8b,
-  0x62, 0xf0, 0x41, 0x50, 0xb7, 0x46, 0x01, 0x2e, 0xec, 0x8a, 0x50, 0x61,
-  0x5d, 0x66, 0xa2, 0x2f, 0x19, 0x02, 0x6f, 0xb9, 0x1b, 0x2c, 0xe0, 0x0c,
-  0xa8, 0x68, 0xc3, 0x2f, 0x08, 0xe9, 0x00, 0xb0, 0x01, 0x82, 0xb0, 0xc1,
-  0x41, 0x10, 0xef, 0xac, 0x38, 0x00, 0xa8, 0x1b, 0x20, 0x7a, 0xeb, 0xf8,
-  0xa4, 0xae, 0x30, 0x42, 0xf6, 0x6a, 0xab, 0x93, 0x25, 0xb1, 0x26, 0xd4,
-  0x58, 0xbd, 0xab, 0xc1, 0x0d, 0xd0, 0x0e, 0xd6, 0x06, 0x55, 0x4a, 0x01,
-  0xc4, 0x10, 0x38, 0xa1, 0x09, 0x6c, 0x23, 0x41, 0xf5, 0xd9, 0x48, 0x8d,
-  0xca, 0x23, 0xd2, 0x2b, 0x01, 0x41, 0xa0, 0x09, 0x3b, 0x45, 0x7d, 0xc9,
-  0x16, 0x42, 0xdc, 0x02, 0xa2, 0x49, 0x83, 0x57, 0x40, 0xb0, 0x91, 0x0b,
-  0x90, 0x01, 0x81, 0x90, 0x00, 0x08, 0x46, 0x5d, 0x15, 0x71, 0xca, 0xf1,
-  0x2c, 0x08, 0xd8, 0x22, 0xbe, 0x00, 0xc1, 0x51, 0x8c, 0xb5, 0x2b, 0x00,
-  0x64, 0x91, 0x99, 0x87, 0x22, 0x44, 0x5e, 0x1f, 0x32, 0x2a, 0x2a, 0xd2,
-  0x64, 0x15, 0x79, 0x1e, 0x01, 0x07, 0x12, 0x01, 0x20, 0x0e, 0xfd, 0x00,
-  0x70, 0xd2, 0x1b, 0xf4, 0x00, 0xaa, 0x8c, 0x64, 0xe2, 0x36, 0xcb, 0x93,
-  0x0b, 0xc6, 0x65, 0x84, 0x02, 0x11, 0x2d, 0x12, 0x2a, 0x48, 0x5a, 0x11,
-  0x90, 0x4e, 0x97, 0x26, 0x7d, 0xa0, 0x00, 0x24, 0x85, 0x57, 0x47, 0x20,
-  0x40, 0x34, 0x01, 0x59, 0x32, 0x21, 0x04, 0x10, 0x52, 0x24, 0x61, 0x04,
-  0x23, 0x18, 0xfd, 0xc6, 0x5e, 0xd4, 0x32, 0x1b, 0x05, 0x80, 0xea, 0x31,
-  0x3d, 0x41, 0x13, 0xc8, 0x6c, 0x03, 0x07, 0xbc, 0x20, 0x16, 0x21, 0x52,
-  0x37, 0x46, 0x62, 0x41, 0x01, 0x10, 0x4f, 0xb6, 0x1f, 0x43, 0xd3, 0x25,
-  0x0e, 0xc7, 0x04, 0x4a, 0xc0, 0x61, 0xae, 0x17, 0x8b, 0x05, 0x84, 0x31,
-  0xe0, 0x97, 0x00, 0x90, 0x5b, 0x8b, 0x01, 0x84, 0xb1, 0x47, 0x76, 0x21,
-  0xcc, 0x6c, 0x21, 0xbb, 0x0a, 0x0b, 0xa0, 0x0c, 0x33, 0xcf, 0x92, 0xe6,
-  0x98, 0x0e, 0x40, 0x78, 0xd1, 0x54, 0xd1, 0xe5, 0x0a, 0x18, 0xcd, 0x1f,
-  0x83, 0xea, 0x01, 0x40, 0x5c, 0xb6, 0x81, 0x60, 0xf4, 0xeb, 0x4d, 0x09,
-  0x9b, 0x61, 0x95, 0x02, 0xe8, 0xb5, 0x11, 0x90, 0x05, 0x92, 0xf1, 0x2b,
-  0x3f, 0x58, 0x52, 0xaa, 0xb2, 0x86, 0xf1, 0x83, 0x6e, 0x1b, 0x8b, 0x5e,
-  0x1a, 0xa2, 0x08, 0x6e, 0x83, 0x77, 0xad, 0x72, 0x6e, 0x02, 0x73, 0xa5,
-  0x0c, 0xd0, 0x25, 0x06, 0x74, 0x48, 0x23, 0x5f, 0x64, 0x02, 0x41, 0x2c,
-  0x98, 0xd4, 0x83, 0xa5, 0xc9, 0x04, 0x7e, 0x60, 0x9a, 0x25, 0xd4, 0xda,
-  0xcb, 0xd6, 0x6c, 0xfa, 0x4f, 0x03, 0x12, 0x76, 0xc8, 0xec, 0x68, 0x56,
-  0xf9, 0x25, 0x6d, 0x85, 0x82, 0xd8, 0x59, 0xd7, 0xd8, 0x23, 0x10, 0xb2,
-  0x03, 0x1c, 0x0b, 0xbb, 0xed, 0xd8, 0x45, 0xe0, 0xda, 0x75, 0x0a, 0x92,
-  0xdb, 0x42, 0x36, 0x42, 0x02, 0x32, 0xd6, 0x47, 0xb2, 0x21, 0xed, 0x50,
-  0x1d, 0x10, 0xc2, 0x41, 0x93, 0xf5, 0xd3, 0x80, 0x02, 0x8c, 0x3d, 0xd0,
-  0x64, 0xce, 0x30, 0xf0, 0x84, 0x32, 0x73, 0x08, 0xd0, 0x80, 0x6b, 0xb7,
-  0x24, 0xa4, 0xfe, 0xb5, 0x91, 0xcf, 0xc1, 0x1b, 0x66, 0x32, 0x2b, 0x85,
-  0xd8, 0x1f, 0x03, 0xfb, 0xa0, 0xfe, 0x91, 0x59, 0x09, 0x75, 0x2e, 0x13,
-  0xc8, 0x12, 0x02, 0x4a, 0xbe, 0xb6, 0x08, 0x65, 0x34, 0x2f, 0xf8, 0x8b,
-  0x08, 0xb6, 0xef, 0x01, 0x9b, 0x0b, 0x56, 0xd9, 0x9b, 0x48, 0xa6, 0x17,
-  0x64, 0x56, 0x2e, 0xe3, 0xd1, 0x7a, 0x01, 0xb3, 0x14, 0xda, 0xb2, 0x34,
-  0xc1, 0x6c, 0x12, 0xec, 0xca, 0xd9, 0xac, 0xe4, 0x65, 0xe6, 0x91, 0xe6,
-  0xd4, 0xe4, 0xff, 0x9e, 0x39, 0xa1, 0xfe, 0xe9, 0xdb, 0xe0, 0x09, 0x6e,
-  0x2f, 0xe0, 0xfb, 0xac, 0x2c, 0x98, 0xfe, 0xcf, 0x30, 0x03, 0x56, 0xd4,
-  0xe4, 0x13, 0xa0, 0x82, 0x21, 0xb6, 0xa5, 0x13, 0x1a, 0x94, 0xd9, 0x15,
-  0xe2, 0x6d, 0xe0, 0x4f, 0xb6, 0xdc, 0x55, 0xde, 0x35, 0x41, 0xb2, 0x0d,
-  0xe6, 0xdb, 0xe4, 0x1d, 0xe2, 0xc5, 0x77, 0x0f, 0x77, 0xad, 0xe0, 0x73,
-  0x08, 0x53, 0x8b, 0x4a, 0x8b, 0x00, 0x2b, 0x08, 0x9b, 0x27, 0x46, 0x2c,
-  0x46, 0xba, 0x56, 0xde, 0x31, 0xae, 0x83, 0xdc, 0x6c, 0x37, 0x9d, 0xa3,
-  0x93, 0x2d, 0xea, 0x17, 0xb2, 0x7e, 0xd8, 0x17, 0x4b, 0xc9, 0x2d, 0x49,
-  0x84, 0x5e, 0xe4, 0xfd, 0xc2, 0x23, 0xde, 0x3d, 0x0b, 0x42, 0x23, 0x52,
-  0x60, 0x37, 0xba, 0x29, 0xbe, 0x65, 0x04, 0x40, 0x96, 0x95, 0xc9, 0x07,
-  0x1a, 0x4d, 0x12, 0xb2, 0xf7, 0xdc, 0xd2, 0xde, 0x64, 0x06, 0x13, 0x0f,
-  0x61, 0x17, 0x68, 0x03, 0xfb, 0xb0, 0xeb, 0x39, 0x94, 0xd0, 0x80, 0xcd,
-  0x87, 0x41, 0x75, 0xdf, 0x0a, 0x21, 0x54, 0xec, 0xeb, 0x12, 0x6a, 0xb4,
-  0x16, 0x70, 0x4c, 0xf4, 0xa9, 0x42, 0x50, 0x60, 0x04, 0xb3, 0x7a, 0x5b,
-  0xdf, 0xee, 0x36, 0x3f, 0xfd, 0x79, 0xec, 0xb0, 0x35, 0xfd, 0x15, 0x8b,
-  0xc7, 0x05, 0x35, 0x09, 0x36, 0x6b, 0x45, 0x33, 0x48, 0x04, 0x56, 0x89,
-  0x55, 0x0b, 0xa0, 0x51, 0x90, 0x92, 0x3a, 0x03, 0xb3, 0x3d, 0xe8, 0xa3,
-  0x80, 0x2f, 0xa0, 0xdd, 0xf4, 0x2f, 0xa1, 0xb9, 0x06, 0x0b, 0x06, 0x57,
-  0x2f, 0x4b, 0x0a, 0xcb, 0x40, 0x66, 0xe5, 0xad, 0xad, 0x50, 0x2a, 0x0a,
-  0x30, 0x0d, 0x26, 0x14, 0xdb, 0x24, 0xa6, 0x84, 0x03, 0xa0, 0x26, 0x30,
-  0xe8, 0xe4, 0xda, 0x21, 0x12, 0x44, 0x31, 0x7a, 0x6e, 0xa1, 0xe5, 0x0f,
-  0x9a, 0xf8, 0x6f, 0x2d, 0xb5, 0x91, 0xe5, 0x91, 0xe5, 0xa0, 0xda, 0x3a,
-  0xd3, 0x5b, 0xf0, 0x3d, 0x56, 0x9e, 0x01, 0xd1, 0x41, 0x0b, 0xd3, 0xfa,
-  0x21, 0x4c, 0xa6, 0x48, 0x5a, 0xd8, 0x1c, 0x1f, 0x36, 0x36, 0xc5, 0xb5,
-  0x03, 0xa0, 0xcd, 0x12, 0x1d, 0xc4, 0x5a, 0x2b, 0xcb, 0xab, 0x60, 0xe8,
-  0x89, 0xc8, 0x59, 0x28, 0x33, 0x90, 0x00, 0x26, 0x28, 0xca, 0x80, 0x2f,
-  0xe4, 0x1a, 0x16, 0x08, 0x70, 0x8b, 0x9b, 0x15, 0x34, 0x03, 0x03, 0x96,
-  0x48, 0x15, 0x0b, 0xe9, 0x09, 0x64, 0x77, 0xe7, 0x13, 0x02, 0x67, 0x99,
-  0xd0, 0xdd, 0xa1, 0x84, 0x6d, 0x86, 0x2d, 0x22, 0x85, 0x2a, 0xcd, 0x86,
-  0x84, 0x21, 0x60, 0x70, 0x6a, 0x83, 0xd1, 0x0a, 0x24, 0x28, 0x4b, 0xb5,
-  0x40, 0x90, 0x57, 0xd5, 0xd8, 0x59, 0x3e, 0x84, 0xd2, 0x86, 0x84, 0x66,
-  0x62, 0xb0, 0x7b, 0x42, 0xd2, 0x72, 0xca, 0x03, 0x11, 0x90, 0x03, 0x0e,
-  0x16, 0x58, 0xa5, 0xab, 0xfd, 0x2e, 0x69, 0xb3, 0xfd, 0x00, 0x78, 0x28,
-  0x40, 0x73, 0x1a, 0x81, 0xc6, 0xae, 0x3c, 0xcc, 0x1f, 0x24, 0x73, 0xe4,
-  0x28, 0x01, 0xbb, 0x1a, 0x1b, 0x37, 0xec, 0x13, 0x09, 0x8f, 0x60, 0x3f,
-  0xd1, 0x38, 0xff, 0x51, 0x82, 0x9b, 0x81, 0x2d, 0x15, 0x41, 0x74, 0x69,
-  0x8c, 0x5f, 0x15, 0xfa, 0xc2, 0x72, 0x85, 0xad, 0x58, 0x43, 0x3f, 0xb2,
-  0x1b, 0x46, 0x42, 0xad, 0x1c, 0x84, 0x8c, 0x86, 0xc3, 0x82, 0x02, 0xb5,
-  0x22, 0x3a, 0x0d, 0x19, 0x18, 0x83, 0x88, 0x0e, 0x95, 0x19, 0x84, 0x4c,
-  0x03, 0x47, 0x9b, 0x8c, 0x85, 0x21, 0x92, 0x70, 0x2e, 0xa3, 0x46, 0x4b,
-  0xcb, 0x1f, 0x54, 0xfb, 0x2f, 0xa5, 0x11, 0xf3, 0x84, 0x34, 0xe2, 0x2f,
-  0x50, 0x3c, 0xc9, 0x2c, 0x20, 0x86, 0x3a, 0xef, 0x03, 0x29, 0x23, 0x02,
-  0xdb, 0xa7, 0xe9, 0x96, 0x55, 0x52, 0x8a, 0x4a, 0x26, 0x86, 0x3b, 0xcc,
-  0x5d, 0x25, 0x80, 0x68, 0x2e, 0x5b, 0x66, 0x1b, 0x10, 0xb8, 0x26, 0xc3,
-  0xcb, 0x77, 0x8c, 0x8b, 0x46, 0xd8, 0x83, 0x6a, 0x24, 0x45, 0x9c, 0xeb,
-  0x5c, 0x40, 0x8a, 0x55, 0x00, 0xb1, 0xbe, 0x6b, 0xd0, 0x64, 0x2b, 0x4d,
-  0x2b, 0x0c, 0x20, 0x36, 0x41, 0x2f, 0x46, 0xc0, 0x78, 0x1a, 0xce, 0xa4,
-  0x9f, 0x87, 0x0c, 0x72, 0x9b, 0x99, 0x0a, 0x72, 0x84, 0x92, 0x0a, 0x0e,
-  0x06, 0x30, 0xd8, 0xe0, 0x03, 0x09, 0x3e, 0x59, 0x56, 0xb8, 0x2a, 0x0f,
-  0x30, 0x0a, 0x74, 0x12, 0xd6, 0x58, 0xa1, 0x6e, 0xaa, 0xd5, 0xe9, 0xb1,
-  0x9b, 0x93, 0xab, 0x0e, 0xfa, 0x59, 0xfc, 0x2c, 0x42, 0x63, 0x5d, 0x0f,
-  0x81, 0xab, 0xa0, 0x14, 0xd3, 0x07, 0x04, 0xd1, 0x24, 0x9b, 0x71, 0x36,
-  0x29, 0x65, 0xe2, 0xf6, 0x26, 0xeb, 0xc7, 0x23, 0x10, 0xb0, 0xd6, 0x3b,
-  0xa3, 0x7e, 0x36, 0x23, 0x40, 0xb7, 0xb5, 0x7e, 0xff, 0x00, 0x24, 0xa1,
-  0x34, 0x10, 0x74, 0xe6, 0x41, 0x8c, 0x0e, 0xd3, 0x37, 0x80, 0x10, 0x8c,
-  0x25, 0x45, 0x5c, 0x8b, 0xa0, 0xcb, 0x65, 0xd8, 0xdb, 0x01, 0x15, 0x70,
-  0x07, 0x03, 0x7e, 0xec, 0xeb, 0xe3, 0x18, 0x1f, 0x81, 0x00, 0x40, 0x11,
-  0x2a, 0xce, 0x96, 0xb8, 0xd1, 0x0a, 0xb5, 0x7f, 0x83, 0x6b, 0x20, 0x07,
-  0x1c, 0x97, 0x01, 0x00, 0x81, 0xb8, 0x3c, 0x9a, 0xe8, 0x02, 0x00, 0x80,
-  0xbd, 0xc0, 0x12, 0x09, 0x17, 0x38, 0x9a, 0x67, 0x8d, 0xc8, 0x01, 0x62,
-  0x6b, 0x00, 0x42, 0x22, 0x9a, 0x0f, 0xb0, 0x3b, 0x9c, 0xcd, 0x00, 0x60,
-  0x3c, 0x30, 0x7e, 0xd1, 0x95, 0xee, 0x92, 0xfc, 0x02, 0xe0, 0x6c, 0x02,
-  0xc5, 0x43, 0xc6, 0x54, 0x9c, 0xdc, 0x14, 0x2c, 0x89, 0xee, 0xa0, 0x04,
-  0xca, 0xd1, 0x83, 0xef, 0x38, 0x67, 0x1b, 0x74, 0x9f, 0x30, 0x75, 0x2a,
-  0x27, 0x2b, 0x2c, 0x1b, 0xa9, 0x59, 0xa2, 0x07, 0x48, 0xea, 0xd9, 0xb6,
-  0x63, 0x5e, 0x23, 0x51, 0x74, 0xf1, 0x74, 0x87, 0x6a, 0xb0, 0xff, 0x57,
-  0x62, 0x20, 0x4d, 0xec, 0x85, 0x51, 0x63, 0x8c, 0x03, 0x80, 0x0e, 0x32,
-  0xa9, 0xc0, 0x18, 0xde, 0x11, 0xc0, 0x6e, 0x18, 0xd3, 0x1c, 0x4c, 0x90,
-  0x2a, 0x59, 0x0a, 0x0b, 0x26, 0x35, 0x00, 0xc2, 0xda, 0x0e, 0xa9, 0xab,
-  0xa9, 0x19, 0xa2, 0x2d, 0xb9, 0xac, 0x67, 0x04, 0x2a, 0xe4, 0x0c, 0xb1,
-  0xa0, 0x55, 0x24, 0x7d, 0x0e, 0x38, 0x4a, 0x39, 0xc7, 0xc7, 0xee, 0x2f,
-  0x89, 0xd9, 0xeb, 0x1e, 0x95, 0x5c, 0xbd, 0x9c, 0xb6, 0x0a, 0x05, 0xc0,
-  0x97, 0x6a, 0x18, 0xb2, 0x5d, 0xd9, 0xa1, 0xcb, 0xea, 0xec, 0x24, 0x22,
-  0x0c, 0x75, 0xb8, 0x07, 0x21, 0xec, 0xe0, 0xce, 0x04, 0x96, 0xc4, 0x08,
-  0xdc, 0xa3, 0xd3, 0x41, 0x74, 0x7f, 0xe8, 0x86, 0x83, 0x43, 0x82, 0x47,
-  0x10, 0xdb, 0xc1, 0xa4, 0xe8, 0x28, 0x8f, 0x0b, 0x01, 0x59, 0x2f, 0x20,
-  0x10, 0x39, 0x26, 0xcc, 0x0c, 0x9c, 0xd0, 0x91, 0xde, 0xc1, 0x2e, 0x64,
-  0xea, 0x4c, 0x5f, 0x88, 0x21, 0x7d, 0x65, 0xee, 0x92, 0xf0, 0x38, 0xf4,
-  0xe9, 0x78, 0x51, 0x19, 0xf2, 0xa5, 0x47, 0x04, 0x78, 0xd0, 0x48, 0xa6,
-  0xa3, 0x90, 0x75, 0xa3, 0x06, 0x77, 0x12, 0xa2, 0xe0, 0x80, 0x60, 0x76,
-  0x2c, 0x38, 0xe0, 0x10, 0x2f, 0xa4, 0xc6, 0x74, 0x23, 0xa2, 0xc8, 0x12,
-  0x48, 0x30, 0x96, 0x31, 0x1c, 0xf9, 0x88, 0xd0, 0x31, 0x06, 0x10, 0x04,
-  0xa0, 0xb3, 0x05, 0x0b, 0x1b, 0x13, 0x00, 0x7f, 0x16, 0x0d, 0xb8, 0x1b,
-  0x00, 0x21, 0xd0, 0xec, 0x45, 0x01, 0x7e, 0x2f, 0xc4, 0xfd, 0x3a, 0x0b,
-  0x1a, 0x09, 0xd4, 0x21, 0x01, 0x98, 0x45, 0x21, 0x42, 0xb3, 0x1c, 0x75,
-  0x68, 0x77, 0x15, 0x09, 0x24, 0x29, 0xe0, 0xe9, 0xc4, 0x00, 0x12, 0xff,
-  0x95, 0x09, 0x8d, 0x71, 0x5b, 0x34, 0xaa, 0x5d, 0x00, 0x8e, 0x3c, 0xd5,
-  0x00, 0xc3, 0x3e, 0x5e, 0xa5, 0x82, 0xc2, 0x61, 0x78, 0x04, 0x67, 0x0f,
-  0x2b, 0xfb, 0x17, 0x78, 0x6c, 0xa8, 0x00, 0x4c, 0x35, 0x8d, 0xcd, 0x73,
-  0x13, 0xe8, 0xc2, 0x08, 0x06, 0x32, 0x10, 0xc8, 0x0e, 0x3c, 0xe9, 0x86,
-  0x00, 0x03, 0x7d, 0x6c, 0x2c, 0xff, 0xc9, 0x2f, 0x62, 0xfc, 0x38, 0x88,
-  0x42, 0xb7, 0x60, 0x58, 0x01, 0xd4, 0x30, 0x87, 0x52, 0x22, 0x61, 0xc6,
-  0x60, 0x3d, 0xd1, 0x84, 0x87, 0xec, 0xeb, 0x2e, 0x54, 0x2f, 0xb4, 0xfd,
-  0x66, 0x80, 0xaa, 0x24, 0x4a, 0x1b, 0x8b, 0x06, 0x6d, 0x0b, 0x81, 0x09,
-  0x82, 0x62, 0x4b, 0x4e, 0x50, 0x61, 0x22, 0x81, 0x9c, 0x11, 0x78, 0xe4,
-  0x36, 0x17, 0xa5, 0x6a, 0x58, 0xae, 0x53, 0x32, 0xab, 0x8b, 0x2b, 0x90,
-  0x1f, 0x30, 0xe0, 0xeb, 0x84, 0x0d, 0xb0, 0x10, 0x84, 0x01, 0x80, 0x2c,
-  0x4d, 0x86, 0x77, 0x40, 0x99, 0x60, 0x02, 0x62, 0x49, 0xc0, 0xeb, 0x2e,
-  0x25, 0x23, 0x5e, 0x3e, 0xea, 0x01, 0x1d, 0x4b, 0xa0, 0x0c, 0xb2, 0xb4,
-  0x58, 0xf3, 0x5d, 0x32, 0x8a, 0xea, 0x32, 0xed, 0xd6, 0x7f, 0x58, 0x59,
-  0x0c, 0xd2, 0x65, 0xce, 0xa4, 0xd0, 0x51, 0x37, 0x0e, 0x42, 0xd4, 0xc4,
-  0x6d, 0x0b, 0x96, 0xd6, 0xd8, 0xda, 0x25, 0xda, 0x28, 0xb8, 0xdb, 0x4a,
-  0x3b, 0x22, 0xdd, 0x25, 0x0b, 0x1d, 0x48, 0x9d, 0x58, 0x2e, 0xf6, 0xd4,
-  0x70, 0x02, 0x5e, 0xde, 0xd9, 0x04, 0xea, 0xf5, 0xec, 0x00, 0x86, 0x95,
-  0x00, 0x75, 0x5a, 0x20, 0x4d, 0x7e, 0x07, 0x02, 0x99, 0x17, 0x10, 0x4e,
-  0x41, 0x06, 0xde, 0x77, 0x43, 0x50, 0xa5, 0xcc, 0x82, 0xba, 0xc4, 0xcc,
-  0x05, 0xcd, 0x19, 0x3e, 0x1d, 0x5b, 0x75, 0xee, 0x01, 0x9a, 0xab, 0x19,
-  0x04, 0x88, 0xc9, 0xd9, 0x20, 0xe4, 0x66, 0xe6, 0xd6, 0xcb, 0x81, 0x62,
-  0xfa, 0x80, 0x00, 0x7d, 0x5d, 0xcc, 0xa0, 0x12, 0x93, 0x2a, 0x84, 0x9f,
-  0x10, 0x4b, 0x7a, 0xe2, 0x04, 0x4b, 0xf8, 0xdc, 0x34, 0xfe, 0x83, 0x41,
-  0xe5, 0x03, 0xb4, 0x11, 0x51, 0xf6, 0x93, 0xe4, 0x94, 0x6a, 0x48, 0x1f,
-  0xec, 0x12, 0x1c, 0xf6, 0x9a, 0xb9, 0x88, 0x2a, 0x05, 0x45, 0xd8, 0xeb,
-  0xee, 0x11, 0x2a, 0x70, 0x0e, 0x21, 0x84, 0x78, 0x74, 0x6f, 0x89, 0x3e,
-  0x21, 0x90, 0x5e, 0x26, 0x47, 0xca, 0x16, 0xc3, 0xd8, 0xd2, 0x30, 0x2d,
-  0xce, 0xf4, 0x13, 0xd8, 0xc8, 0x51, 0x0e, 0xa6, 0x78, 0x06, 0x0b, 0x02,
-  0xcd, 0x38, 0x12, 0x11, 0x31, 0xeb, 0xde, 0x1f, 0xfe, 0x48, 0x7e, 0x4a,
-  0xca, 0xd6, 0x64, 0x77, 0xd8, 0x17, 0x46, 0x0b, 0xb2, 0x11, 0x58, 0x47,
-  0x20, 0x87, 0x48, 0x0c, 0x27, 0x17, 0x2d, 0xeb, 0xa8, 0x61, 0xeb, 0x7b,
-  0x83, 0x00, 0x0f, 0x0b, 0x82, 0x39, 0x24, 0x70, 0x60, 0x6d, 0xa0, 0xc1,
-  0x80, 0x4b, 0x12, 0xb4, 0x36, 0xe3, 0x02, 0x01, 0x11, 0x34, 0x19, 0x22,
-  0x1d, 0x03, 0x8c, 0x31, 0xda, 0x45, 0xd6, 0xfe, 0x5f, 0x8b, 0x14, 0x6c,
-  0xe1, 0xfb, 0xe9, 0xc6, 0xfd, 0x6c, 0x2b, 0x67, 0x66, 0xe6, 0x9e, 0x00,
-  0x0e, 0x47, 0x9b, 0xfd, 0x18, 0x2d, 0x4a, 0xb0, 0x23, 0x94, 0x06, 0xbc,
-  0x00, 0xa2, 0xa4, 0x4d, 0xd2, 0xc9, 0x06, 0xa8, 0x75, 0x31, 0x8d, 0xe9,
-  0x18, 0x01, 0x60, 0x34, 0xc0, 0x11, 0x45, 0x7a, 0xa0, 0x0a, 0xe4, 0x0d,
-  0x8c, 0x2c, 0x0a, 0x44, 0x78, 0xe4, 0x22, 0x74, 0xf0, 0x18, 0x97, 0x34,
-  0x08, 0x58, 0x2d, 0x20, 0x08, 0x31, 0x7c, 0x14, 0x46, 0x36, 0x20, 0x22,
-  0xc3, 0x51, 0x10, 0x59, 0x05, 0x60, 0x00, 0x13, 0x61, 0x62, 0x35, 0xce,
-  0x0e, 0x48, 0x67, 0x3f, 0xb2, 0x36, 0xb4, 0x16, 0x7d, 0x12, 0xc1, 0xc6,
-  0x81, 0x10, 0x9b, 0x90, 0x49, 0xf6, 0x8f, 0x05, 0x05, 0x65, 0x83, 0x8a,
-  0xce, 0x70, 0xfc, 0x8d, 0xb7, 0x9b, 0xee, 0xde, 0x00, 0x25, 0x84, 0x5f,
-  0x50, 0x49, 0xd9, 0xd4, 0x14, 0x1b, 0x96, 0x64, 0x2b, 0x01, 0x44, 0x25,
-  0x2e, 0x6c, 0x5d, 0x26, 0xf2, 0xd4, 0x17, 0x65, 0x1d, 0xbd, 0x6c, 0x96,
-  0x67, 0x21, 0x96, 0x0d, 0x95, 0x6f, 0x74, 0x1a, 0xb2, 0xa7, 0xf0, 0xd9,
-  0xc0, 0x75, 0x13, 0x30, 0x08, 0x9a, 0x1a, 0x0b, 0xc0, 0x85, 0x60, 0xa0,
-  0xaf, 0x32, 0xc0, 0x35, 0x02, 0x6c, 0xb4, 0xd0, 0x84, 0x36, 0x0b, 0x3a,
-  0xc4, 0xf0, 0x4f, 0xe1, 0xe9, 0xf8, 0x05, 0x02, 0xf6, 0x46, 0xdb, 0x02,
-  0xf9, 0x27, 0xd0, 0xe7, 0xd1, 0x9e, 0xd0, 0xd1, 0x79, 0xd2, 0xe7, 0xdb,
-  0x80, 0xd0, 0xed, 0xce, 0xd7, 0x01, 0xf0, 0x3d, 0x83, 0x00, 0x6b, 0xb3,
-  0x04, 0x62, 0x57, 0xd5, 0xcf, 0x45, 0xe0, 0x76, 0xd7, 0xdb, 0x06, 0x5b,
-  0x0a, 0xb1, 0x12, 0x70, 0x06, 0x56, 0xee, 0x5f, 0xa0, 0x85, 0x59, 0xc3,
-  0xf5, 0x0d, 0x96, 0x76, 0xd2, 0xeb, 0x49, 0x2c, 0x2f, 0x1b, 0x9f, 0x2c,
-  0x02, 0x75, 0x92, 0x25, 0x6d, 0x05, 0xcc, 0x04, 0x4d, 0x55, 0x50, 0x62,
-  0x10, 0xf9, 0x53, 0x03, 0x76, 0x26, 0x13, 0x52, 0xb7, 0x11, 0xeb, 0x20,
-  0x60, 0xf9, 0xee, 0xba, 0x63, 0x04, 0xd8, 0xeb, 0x12, 0x21, 0xb5, 0x16,
-  0xe3, 0x23, 0x7b, 0x04, 0x21, 0x10, 0xdb, 0x8a, 0xbd, 0xb4, 0xdd, 0x00,
-  0xa9, 0x80, 0x09, 0x75, 0xc7, 0x04, 0x14, 0x3b, 0xb8, 0xf8, 0x10, 0x49,
-  0x6c, 0x5b, 0x1c, 0xa2, 0x1c, 0xe9, 0x22, 0xfe, 0x64, 0xfc, 0x03, 0x04,
-  0x81, 0x64, 0x6a, 0x86, 0x73, 0xa4, 0x00, 0x25, 0x71, 0xc0, 0x00, 0x27,
-  0xbf, 0xd7, 0x41, 0xc2, 0xcf, 0x07, 0x64, 0x9a, 0xf8, 0xc3, 0x83, 0xde,
-  0xea, 0x73, 0x3a, 0xc8, 0x77, 0xf6, 0x13, 0x05, 0xb6, 0x0a, 0x95, 0x2f,
-  0x0c, 0x90, 0xf4, 0xa6, 0x0b, 0x69, 0x0a, 0xfa, 0x29, 0xeb, 0x6c, 0xe0,
-  0x25, 0x9c, 0x21, 0x02, 0xb6, 0x5f, 0x83, 0x13, 0xc5, 0xce, 0x03, 0xee,
-  0xea, 0x7b, 0x47, 0x54, 0xff, 0x26, 0x73, 0x12, 0xd3, 0xb6, 0xc2, 0xe0,
-  0x3a, 0x12, 0x4c, 0xf1, 0x14, 0xac, 0x1f, 0x6f, 0xd5, 0x9b, 0x5c, 0x48,
-  0xd5, 0x86, 0x5c, 0x13, 0xed, 0x6b, 0x6f, 0x1f, 0x08, 0xe2, 0xeb, 0x4a,
-  0xc1, 0xe0, 0x24, 0x23, 0x5f, 0x64, 0xdc, 0x81, 0x80, 0x5f, 0xa4, 0xf0,
-  0xb9, 0x18, 0x23, 0x99, 0x06, 0xd0, 0x92, 0x36, 0xb2, 0x9f, 0xe7, 0x60,
-  0x29, 0xe9, 0x19, 0x26, 0x29, 0x65, 0xf3, 0x69, 0x5c, 0x21, 0x00, 0x92,
-  0xe4, 0x24, 0x3f, 0x31, 0x65, 0x02, 0xa0, 0x45, 0x31, 0x34, 0xd3, 0x01,
-  0x98, 0x61, 0x8d, 0x52, 0x11, 0x42, 0x9e, 0x0d, 0xb0, 0xc2, 0x15, 0xc5,
-  0x59, 0xf3, 0x76, 0xe2, 0x18, 0x52, 0x0c, 0x49, 0x60, 0x7d, 0x11, 0xaf,
-  0x51, 0x85, 0x5a, 0xd0, 0x30, 0x98, 0x8a, 0x04, 0xbd, 0xa4, 0x06, 0x4b,
-  0x02, 0xcb, 0x8c, 0xc1, 0xeb, 0x08, 0x12, 0x0f, 0x4b, 0x1f, 0x37, 0xac,
-  0xa2, 0x59, 0x8a, 0xfc, 0x02, 0xc7, 0x5c, 0x7d, 0x40, 0xff, 0xe9, 0x4e,
-  0xff, 0x84, 0xfe, 0xac, 0xcf, 0xc2, 0x32, 0x4a, 0x93, 0xc0, 0x78, 0x3d,
-  0xc8, 0xc4, 0xd5, 0x48, 0x7d, 0x73, 0x0b, 0xbf, 0xf7, 0x4e, 0x01, 0x46,
-  0xa9, 0x56, 0x30, 0x38, 0x72, 0x9a, 0x01, 0x5c, 0xd5, 0x53, 0x78, 0xd5,
-  0x09, 0x4c, 0x97, 0x3a, 0xd0, 0x16, 0xda, 0xb2, 0x6e, 0x9a, 0xbb, 0x5e,
-  0x56, 0x7a, 0x00, 0xa2, 0xc8, 0x48, 0x16, 0x48, 0xdb, 0x8c, 0xf0, 0x12,
-  0x34, 0x14, 0x2e, 0x87, 0xbd, 0x00, 0x09, 0x8f, 0x64, 0xf8, 0x0d, 0x83,
-  0x78, 0xeb, 0x90, 0x03, 0xdb, 0x6a, 0x5b, 0xa4, 0xff, 0x22, 0x37, 0xa5,
-  0xb0, 0x26, 0x9c, 0x23, 0x07, 0x97, 0x34, 0xb1, 0xff, 0x76, 0x50, 0x23,
-  0x9b, 0x03, 0x0b, 0x65, 0x13, 0x2a, 0x13, 0x95, 0x5a, 0x1b, 0x8b, 0xcd,
-  0x2b, 0x90, 0x06, 0x95, 0x5d, 0x30, 0x1e, 0x34, 0x19, 0x54, 0x60, 0x31,
-  0x5e, 0xeb, 0x29, 0xa4, 0xe0, 0xed, 0x01, 0x5b, 0xb6, 0x11, 0x61, 0x29,
-  0xd8, 0x21, 0x19, 0x82, 0x44, 0x19, 0x04, 0x22, 0x75, 0x1d, 0x15, 0xf0,
-  0x0a, 0x2f, 0x96, 0x95, 0x28, 0x8e, 0xb9, 0xe3, 0x02, 0x56, 0x57, 0x97,
-  0x2c, 0x08, 0xdc, 0xe1, 0x33, 0xf6, 0x2e, 0x21, 0x05, 0x6d, 0x31, 0xe4,
-  0x1b, 0x69, 0xe4, 0x2c, 0xe2, 0x83, 0x0f, 0x93, 0x02, 0x45, 0x64, 0xec,
-  0x30, 0xf7, 0x92, 0xa5, 0xc2, 0x26, 0xd0, 0x59, 0x94, 0x61, 0x5a, 0x60,
-  0xd7, 0x29, 0x68, 0x39, 0x15, 0xc0, 0x62, 0xcd, 0xd9, 0x1c, 0xea, 0x66,
-  0xec, 0x82, 0xba, 0xbd, 0xd6, 0x84, 0x6c, 0xe7, 0x51, 0x09, 0x01, 0x66,
-  0x80, 0x0f, 0x29, 0x00, 0x5b, 0x0e, 0x10, 0xd8, 0x74, 0x24, 0x69, 0x6c,
-  0x29, 0xb5, 0xd1, 0xeb, 0x4e, 0x02, 0xd2, 0x1d, 0x70, 0x14, 0x32, 0xf3,
-  0x2f, 0x17, 0x46, 0x5b, 0x68, 0x4b, 0x4e, 0x55, 0x74, 0xd7, 0x16, 0x58,
-  0x30, 0x6a, 0x50, 0x41, 0x56, 0x89, 0x6c, 0xb7, 0x0f, 0x48, 0x0a, 0x66,
-  0x71, 0xfa, 0x20, 0x28, 0xb2, 0x8e, 0x5f, 0x20, 0x9a, 0x86, 0xa4, 0x12,
-  0x70, 0xd2, 0xca, 0x86, 0xd1, 0x59, 0xc4, 0x6d, 0x34, 0xc0, 0xf3, 0xfe,
-  0x49, 0x2b, 0xb3, 0x9d, 0x65, 0x55, 0x78, 0xd2, 0xfe, 0x28, 0x42, 0xeb,
-  0x41, 0x04, 0x6d, 0x7e, 0x20, 0x34, 0x33, 0xb4, 0x61, 0x6b, 0xb1, 0xa7,
-  0xe6, 0x37, 0x01, 0x05, 0x9d, 0x08, 0x46, 0x93, 0x88, 0x11, 0xbb, 0x01,
-  0xbc, 0x7e, 0x77, 0x51, 0x72, 0xd8, 0x73, 0x4a, 0xa2, 0x1a, 0xd1, 0xfd,
-  0xc3, 0x2c, 0xc9, 0x0e, 0x00, 0x7b, 0x74, 0xfe, 0x78, 0x36, 0x20, 0x7d,
-  0x9a, 0x61, 0x02, 0x8b, 0x1a, 0x2e, 0x09, 0x90, 0x54, 0x1c, 0x45, 0xfe,
-  0x06, 0x17, 0x0f, 0x14, 0x75, 0x33, 0x6f, 0x59, 0x12, 0x75, 0x2e, 0x19,
-  0x9f, 0x88, 0x37, 0x39, 0x77, 0x23, 0x9b, 0x72, 0x73, 0x1c, 0x00, 0x48,
-  0x80, 0x88, 0x32, 0x6a, 0x96, 0x3d, 0xc0, 0x07, 0x12, 0x5e, 0x42, 0x09,
-  0x6d, 0x01, 0x01, 0x2c, 0x12, 0xf8, 0x84, 0x63, 0x30, 0xa2, 0xb5, 0xf9,
-  0x53, 0x01, 0x3d, 0xeb, 0x27, 0x21, 0x68, 0x29, 0x92, 0x29, 0xa8, 0xd0,
-  0xc1, 0x13, 0x66, 0xad, 0xa4, 0x5a, 0x25, 0xea, 0x10, 0x4a, 0x5a, 0xd9,
-  0x16, 0x5a, 0x9c, 0x5a, 0x13, 0xcf, 0x09, 0x47, 0x81, 0x3b, 0xd2, 0x03,
-  0x51, 0x2e, 0x52, 0x75, 0x1d, 0x02, 0xba, 0xff, 0x18, 0x04, 0x28, 0xc5,
-  0x78, 0x5b, 0x8c, 0xf8, 0xe7, 0x0e, 0x01, 0xe0, 0xa7, 0x22, 0x32, 0xd6,
-  0xd2, 0x3d, 0x07, 0x20, 0x21, 0x29, 0x38, 0x45, 0x0b, 0xba, 0xf4, 0x21,
-  0x0b, 0xef, 0xf0, 0x0e, 0x02, 0x06, 0x6c, 0x53, 0xe8, 0x09, 0x1f, 0xa4,
-  0x33, 0x8d, 0x15, 0x96, 0xab, 0xdb, 0x23, 0xc4, 0x53, 0x09, 0x78, 0x23,
-  0x24, 0x14, 0xa6, 0xa0, 0x92, 0x57, 0x10, 0x02, 0xf9, 0x4b, 0x1c, 0xa1,
-  0x83, 0x89, 0xa4, 0xe4, 0x2d, 0x25, 0x57, 0xa5, 0x06, 0x93, 0x63, 0x04,
-  0xeb, 0x38, 0xbb, 0x34, 0x95, 0x2a, 0xea, 0x3f, 0xff, 0xcd, 0x04, 0x96,
-  0x8a, 0x92, 0x2a, 0x19, 0x1e, 0x09, 0x60, 0x20, 0x0d, 0xfd, 0x24, 0x16,
-  0xbd, 0x86, 0x94, 0x20, 0xc5, 0x24, 0x1b, 0x56, 0x1d, 0x61, 0x1b, 0xbd,
-  0x05, 0x21, 0xd6, 0x7f, 0xe9, 0xbe, 0xfe, 0xe9, 0xbb, 0x48, 0x37, 0x51,
-  0xc4, 0x8a, 0x09, 0xcd, 0xa4, 0x37, 0x86, 0xe0, 0x40, 0x9d, 0x5d, 0xfe,
-  0x9b, 0x77, 0x20, 0xd2, 0x37, 0x13, 0xe0, 0x20, 0x4c, 0x2e, 0x93, 0x10,
-  0x3c, 0x0e, 0xf2, 0x10, 0xcb, 0x0e, 0x0c, 0x27, 0x0a, 0x23, 0xe0, 0x20,
-  0x5e, 0xf0, 0xfd, 0x42, 0xec, 0x08, 0x3c, 0xc0, 0x08, 0x57, 0x08, 0x30,
-  0x52, 0xd5, 0x09, 0x5a, 0x4e, 0x81, 0xfd, 0x36, 0x53, 0x10, 0x41, 0x88,
-  0xec, 0xab, 0xa2, 0xc1, 0xf3, 0xf4, 0x12, 0xd4, 0xda, 0x9b, 0x94, 0xf6,
-  0x30, 0x6c, 0x62, 0x12, 0xb2, 0x14, 0x14, 0x8d, 0x17, 0xa4, 0xbf, 0xea,
-  0xd8, 0x21, 0x6c, 0x83, 0xc5, 0x9b, 0x2c, 0x0d, 0xde, 0x43, 0xc3, 0x0d,
-  0x12, 0x6e, 0x0e, 0x3f, 0x09, 0x4b, 0x8b, 0x81, 0x73, 0x29, 0x99, 0x0a,
-  0x41, 0x59, 0x2a, 0x2c, 0x5c, 0x2d, 0x95, 0xc8, 0x88, 0x05, 0xf5, 0x78,
-  0x4c, 0x0c, 0x22, 0x71, 0x33, 0xff, 0x9b, 0x38, 0x20, 0x09, 0xcf, 0x66,
-  0x0a, 0x0c, 0x23, 0x12, 0x44, 0x61, 0xf4, 0x2a, 0xcb, 0x9c, 0x50, 0xcf,
-  0x3f, 0xb7, 0x12, 0x50, 0x6c, 0xbd, 0xb6, 0x13, 0x5b, 0x7c, 0xc6, 0x6d,
-  0x42, 0x1e, 0x3a, 0x9d, 0x00, 0xc8, 0x5f, 0xfa, 0x14, 0x72, 0xb4, 0x1f,
-  0x21, 0x12, 0x72, 0x8a, 0xad, 0x01, 0x72, 0xf6, 0x2a, 0xb8, 0xd3, 0xa2,
-  0xb5, 0xc2, 0x96, 0x4c, 0x1d, 0x4e, 0x80, 0x4c, 0x2a, 0x58, 0xd9, 0xb1,
-  0x4a, 0x75, 0x42, 0x6f, 0x04, 0xd6, 0x8a, 0xde, 0x6c, 0x4e, 0xa1, 0x45,
-  0x24, 0xe0, 0x3a, 0x18, 0x56, 0xc0, 0x23, 0xb5, 0x42, 0xdb, 0x17, 0xf4,
-  0xac, 0x00, 0x26, 0x0b, 0x40, 0x96, 0x17, 0x24, 0x7e, 0xac, 0x45, 0x20,
-  0x4c, 0x7c, 0xba, 0x8b, 0x4e, 0x2a, 0xb1, 0xe6, 0xef, 0x12, 0x22, 0x0b,
-  0xc5, 0xd6, 0x47, 0x4d, 0xb1, 0xbb, 0x32, 0x65, 0x3a, 0x0f, 0xd6, 0x74,
-  0x60, 0x0b, 0xaa, 0xb0, 0x8b, 0xf0, 0x19, 0x83, 0x38, 0xeb, 0x3d, 0x08,
-  0x0d, 0x4b, 0x54, 0x25, 0x03, 0x6b, 0x42, 0x09, 0xc0, 0x5a, 0xff, 0xd0,
-  0x7c, 0x40, 0x38, 0x79, 0x88, 0x59, 0x67, 0x40, 0x00, 0x78, 0xee, 0x72,
-  0xb8, 0x88, 0x7d, 0x89, 0x72, 0xb1, 0x6f, 0x0c, 0x76, 0x22, 0x56, 0x65,
-  0x4f, 0x08, 0x51, 0x10, 0x52, 0x8e, 0x6a, 0x92, 0x82, 0x9a, 0x32, 0xcc,
-  0x6a, 0x21, 0x90, 0xaa, 0x70, 0x58, 0x95, 0x68, 0xa9, 0xff, 0xe8, 0x1d,
-  0x10, 0xe0, 0xb5, 0x06, 0x4e, 0xc8, 0xc3, 0xc0, 0xbc, 0x06, 0xfd, 0x12,
-  0x02, 0xc0, 0x4a, 0x0c, 0x36, 0x86, 0xd0, 0x00, 0x02, 0xc0, 0x4a, 0x39,
-  0x88, 0x7c, 0x8a, 0x2f, 0xa1, 0x88, 0xb2, 0x8a, 0x17, 0xe6, 0x45, 0x12,
-  0xf3, 0xe0, 0x09, 0x01, 0x2c, 0x4a, 0x01, 0x94, 0x0d, 0x44, 0x65, 0x16,
-  0x2d, 0x17, 0x96, 0x0e, 0x8e, 0x22, 0x39, 0x0c, 0x9a, 0x94, 0x74, 0x48,
-  0x49, 0x02, 0x1a, 0x2a, 0xb8, 0xac, 0x54, 0xac, 0xdd, 0x62, 0x06, 0xa0,
-  0x70, 0xe2, 0x50, 0x21, 0x3f, 0x28, 0x68, 0x0f, 0x02, 0x55, 0xdd, 0x52,
-  0x6a, 0x18, 0x71, 0x62, 0x10, 0x84, 0x4c, 0x08, 0x07, 0x82, 0x88, 0x65,
-  0x87, 0x4b, 0x11, 0x08, 0x2d, 0x4c, 0x4e, 0x44, 0x25, 0x28, 0xc8, 0x42,
-  0x47, 0x28, 0x64, 0xb0, 0x60, 0x0c, 0x04, 0x03, 0x6c, 0x4d, 0x99, 0x01,
-  0x94, 0x00, 0x5c, 0x1f, 0x83, 0x8a, 0x2c, 0x88, 0x85, 0x80, 0x92, 0x63,
-  0xe5, 0x88, 0x9d, 0x8a, 0x98, 0x28, 0x09, 0x63, 0x0e, 0x88, 0x79, 0x8a,
-  0x54, 0x05, 0x96, 0x0b, 0xb0, 0xe3, 0x96, 0x31, 0x1a, 0x84, 0x68, 0x99,
-  0x0e, 0x24, 0x75, 0x79, 0x11, 0x05, 0x62, 0x21, 0x0a, 0xbc, 0x1d, 0x47,
-  0x05, 0x35, 0x74, 0x01, 0x67, 0xf2, 0xa8, 0x74, 0x73, 0xaa, 0xb5, 0x05,
-  0x11, 0xb8, 0x01, 0x0c, 0x13, 0x56, 0x8b, 0x0e, 0x88, 0x24, 0x20, 0x1e,
-  0x1e, 0x07, 0x4c, 0x4b, 0xb6, 0x2e, 0x61, 0xaa, 0x66, 0x1e, 0x8c, 0x1b,
-  0x91, 0xdb, 0x12, 0x74, 0x15, 0x15, 0x24, 0x68, 0x79, 0x55, 0x44, 0x59,
-  0xd4, 0xc1, 0xd1, 0x46, 0xb4, 0x1a, 0x28, 0x56, 0x59, 0x15, 0xb1, 0x53,
-  0xdc, 0x9a, 0x82, 0x4d, 0x2a, 0x33, 0x80, 0x60, 0x72, 0xe1, 0x75, 0x16,
-  0xf9, 0x64, 0xac, 0x0d, 0x83, 0xac, 0x8b, 0xb5, 0x16, 0x1b, 0xcc, 0x22,
-  0x9e, 0xf0, 0x9a, 0x3a, 0x33, 0xce, 0x6b, 0x40, 0x10, 0x7d, 0x52, 0x13,
-  0x6f, 0x16, 0xd3, 0xf8, 0xa9, 0x6a, 0x68, 0x8a, 0xb1, 0x52, 0x8a, 0x07,
-  0xa9, 0xa5, 0x29, 0x50, 0x13, 0x18, 0x68, 0xc9, 0xff, 0xa1, 0xb8, 0xa0,
-  0x7e, 0x28, 0xb1, 0xa8, 0xe2, 0x00, 0x41, 0x46, 0x5b, 0xb4, 0x01, 0x0c,
-  0x0f, 0x42, 0x46, 0xed, 0xc6, 0x46, 0xf9, 0x9e, 0xdb, 0x40, 0x8a, 0x05,
-  0x98, 0x6a, 0x6b, 0xdd, 0x52, 0xef, 0x24, 0xf0, 0xaf, 0x2e, 0x14, 0x19,
-  0x2d, 0xc9, 0xf9, 0x62, 0x55, 0xd6, 0x41, 0xa8, 0xd4, 0x18, 0x86, 0x6e,
-  0x4d, 0xfb, 0xf8, 0x35, 0x59, 0xce, 0x3e, 0x1f, 0xd1, 0x04, 0x41, 0x52,
-  0xb4, 0x85, 0xd1, 0x6e, 0x08, 0x9a, 0x6b, 0x0f, 0x62, 0xdd, 0x9a, 0x71,
-  0x05, 0x59, 0xb7, 0x3a, 0x0e, 0x7f, 0xaf, 0x66, 0x5e, 0x24, 0x60, 0xbf,
-  0x9a, 0x7d, 0x00, 0x9a, 0xf0, 0x1b, 0xb8, 0xe8, 0x03, 0x54, 0x66, 0x9a,
-  0x15, 0x92, 0xbb, 0x08, 0x9b, 0x03, 0x11, 0x6c, 0x59, 0x1c, 0x09, 0x90,
-  0x00, 0x31, 0xc2, 0x5d, 0x22, 0xfb, 0xe2, 0xfc, 0xa9, 0x7a, 0xfd, 0x3a,
-  0xc6, 0xe7, 0x5c, 0x0d, 0x28, 0x29, 0xf9, 0x07, 0xa2, 0xca, 0x88, 0x2f,
-  0x23, 0xef, 0x18, 0x0f, 0x61, 0xa8, 0x14, 0x87, 0x36, 0xa0, 0x84, 0xca,
-  0x29, 0xd5, 0x01, 0xd9, 0x90, 0xcb, 0x2f, 0xa0, 0xcd, 0xa4, 0x29, 0xec,
-  0xcb, 0x07, 0x1b, 0xcd, 0x20, 0x2e, 0xcf, 0xc1, 0x12, 0x93, 0xcf, 0x17,
-  0xed, 0x61, 0x7f, 0x0d, 0x67, 0x35, 0x01, 0xe9, 0xd8, 0xef, 0x30, 0xf6,
-  0x57, 0x07, 0x10, 0x85, 0x62, 0xf6, 0x31, 0x0f, 0x59, 0x5e, 0x1d, 0x0c,
-  0x59, 0x8e, 0x8b, 0xde, 0x00, 0x97, 0xb4, 0x03, 0x77, 0x9f, 0x07, 0x34,
-  0x00, 0x7d, 0x28, 0x0e, 0x11, 0x0f, 0xd8, 0x50, 0x6f, 0x2e, 0x0a, 0x00,
-  0x28, 0x2b, 0x2f, 0xf6, 0x23, 0x00, 0x01, 0x6f, 0x5f, 0xf4, 0x05, 0x00,
-  0x3e, 0x0e, 0x45, 0x90, 0x3c, 0x88, 0x0c, 0x6f, 0x1f, 0xb8, 0x6b, 0xa3,
-  0xba, 0xaa, 0x6b, 0x21, 0xb8, 0x36, 0x0b, 0xa0, 0x56, 0x09, 0x0b, 0x22,
-  0x03, 0x32, 0x06, 0xb8, 0x71, 0xec, 0x30, 0x14, 0x8e, 0x08, 0x49, 0xb0,
-  0x0a, 0x17, 0x98, 0x10, 0x61, 0xb7, 0x01, 0x81, 0x99, 0x2c, 0x1e, 0x53,
-  0x98, 0x59, 0x0a, 0x61, 0x5c, 0x0c, 0x80, 0x72, 0x18, 0x0b, 0x0e, 0x04,
-  0x54, 0x49, 0x07, 0xb2, 0x52, 0xba, 0x20, 0x66, 0x1d, 0x28, 0x07, 0x24,
-  0x11, 0x59, 0xc7, 0xe9, 0xd7, 0x2f, 0x5c, 0xc3, 0x7a, 0xc9, 0xd7, 0xcb,
-  0x8a, 0xa2, 0x93, 0xd2, 0xb3, 0xa0, 0x07, 0x74, 0x25, 0xd3, 0x93, 0xd3,
-  0x61, 0x12, 0xc9, 0xd5, 0x32, 0xd5, 0x1c, 0xdb, 0x93, 0xdb, 0x21, 0xc9,
-  0xd9, 0x30, 0xd9, 0x83, 0xc6, 0x0a, 0xc9, 0x00, 0xf2, 0xa8, 0xaf, 0x41,
-  0x45, 0x78, 0xba, 0x7c, 0xed, 0xbc, 0x6b, 0x9b, 0x07, 0x05, 0x6e, 0x3f,
-  0xbc, 0x6b, 0x41, 0x43, 0x2e, 0xa8, 0x3f, 0x22, 0xb1, 0x09, 0x05, 0x4e,
-  0xfa, 0x08, 0x8b, 0xf9, 0xc1, 0x14, 0x60, 0x94, 0x33, 0x14, 0x52, 0x0f,
-  0x93, 0x37, 0x17, 0x52, 0x01, 0xa8, 0x1b, 0x22, 0x2f, 0x65, 0x08, 0xd5,
-  0xd3, 0xe0, 0x92, 0x73, 0xdc, 0x31, 0x9b, 0x29, 0x8b, 0x2c, 0xd3, 0xf6,
-  0x04, 0xe0, 0x14, 0x75, 0x1b, 0x00, 0x81, 0x60, 0x1c, 0x02, 0x94, 0x39,
-  0xf4, 0x19, 0x00, 0x5a, 0x18, 0xb0, 0xfa, 0xb5, 0x23, 0x2a, 0xf8, 0x88,
-  0x1c, 0xc5, 0x0c, 0x90, 0xb4, 0xd8, 0x02, 0x94, 0x0b, 0x37, 0x00, 0x7c,
-  0x08, 0x00, 0x04, 0x1d, 0x87, 0x02, 0x20, 0x1b, 0x30, 0x37, 0xc8, 0x5e,
-  0x99, 0xc2, 0x24, 0x93, 0xef, 0x1b, 0x93, 0x9e, 0x0c, 0x2c, 0xa4, 0x2f,
-  0x03, 0xd9, 0x5c, 0xff, 0x89, 0x12, 0xc0, 0x51, 0x1c, 0x4d, 0x1c, 0x93,
-  0x2f, 0x11, 0x95, 0x77, 0xbe, 0x54, 0x3b, 0x6b, 0x0e, 0xa6, 0x0a, 0xc3,
-  0x6f, 0x32, 0x35, 0x14, 0x51, 0xca, 0x76, 0xa9, 0x7c, 0xa2, 0x2e, 0xf6,
-  0xc0, 0x78, 0x0d, 0x12, 0x94, 0x23, 0x60, 0x36, 0x65, 0x14, 0x78, 0xf4,
-  0x84, 0x9e, 0x36, 0x23, 0xa1, 0xa1, 0xa8, 0x10, 0x91, 0x2a, 0x52, 0x35,
-  0xa8, 0x83, 0xbd, 0x30, 0x4f, 0x6f, 0xe9, 0x88, 0xf9, 0xae, 0x23, 0xc4,
-  0xec, 0xfd, 0x82, 0x36, 0x88, 0x3f, 0xc7, 0xb7, 0x3b, 0x6d, 0xcd, 0x98,
-  0x51, 0x68, 0xa8, 0x82, 0x41, 0x95, 0xaa, 0xba, 0xa5, 0x07, 0x54, 0x30,
-  0x1d, 0x85, 0x1d, 0x9e, 0xf2, 0xf6, 0x51, 0x34, 0x19, 0x2b, 0x06, 0xba,
-  0xb1, 0x30, 0xb7, 0x37, 0x02, 0x9f, 0x33, 0xb0, 0x06, 0xfc, 0x44, 0x1f,
-  0x15, 0x35, 0xa1, 0x01, 0x9f, 0x31, 0x0a, 0xa9, 0x21, 0xcc, 0x40, 0x46,
-  0xc0, 0x03, 0xeb, 0xba, 0x2d, 0xe6, 0x50, 0x2a, 0xc0, 0x44, 0x59, 0x73,
-  0x32, 0x68, 0x3a, 0x0e, 0x81, 0xa5, 0xe6, 0xa9, 0x02, 0x66, 0x23, 0xe2,
-  0xfe, 0x72, 0xc8, 0xbf, 0x88, 0x72, 0xc1, 0x66, 0x78, 0x3e, 0x62, 0x01,
-  0x8d, 0x0a, 0x68, 0xda, 0x8a, 0xcd, 0x55, 0x8b, 0xc1, 0x9d, 0xd1, 0x60,
-  0xfd, 0xb6, 0x45, 0xf0, 0x5d, 0xeb, 0x13, 0xdc, 0xb9, 0x0f, 0xbe, 0x01,
-  0x56, 0x85, 0x06, 0x84, 0xbd, 0x31, 0x04, 0x9e, 0xed, 0xff, 0xfe, 0xc6,
-  0xdd, 0x81, 0x48, 0x68, 0x0c, 0x23, 0x51, 0x58, 0xe0, 0x16, 0x89, 0x4b,
-  0x6c, 0xff, 0xd1, 0x03, 0x7b, 0x3d, 0xd1, 0x08, 0xe4, 0xf0, 0xb1, 0xe0,
-  0x34, 0x00, 0x3e, 0xc5, 0x0c, 0x28, 0x0e, 0x9f, 0xfb, 0x3b, 0x5e, 0xfa,
-  0x77, 0xc0, 0xd9, 0xbc, 0x4e, 0xf8, 0x77, 0xb9, 0x44, 0x65, 0x66, 0xa3,
-  0x85, 0x34, 0x04, 0x6c, 0x11, 0x2f, 0xf4, 0x2f, 0x04, 0xdc, 0x55, 0xbe,
-  0x6b, 0x50, 0x45, 0x19, 0xc9, 0x23, 0x52, 0x0f, 0x0f, 0xfe, 0x26, 0x8a,
-  0x31, 0x5a, 0x88, 0x12, 0x4d, 0x4a, 0xd6, 0x31, 0xa3, 0x3a, 0xee, 0x8c,
-  0xda, 0x33, 0x12, 0x58, 0x48, 0xc3, 0x03, 0x7d, 0xb2, 0xa1, 0xb7, 0x1c,
-  0x8b, 0x23, 0x05, 0x56, 0xe7, 0x0e, 0x72, 0x2f, 0xec, 0x0c, 0x72, 0x28,
-  0x96, 0x86, 0x1e, 0xde, 0x21, 0x72, 0x14, 0x77, 0xd9, 0x7b, 0x0e, 0x5a,
-  0x73, 0xb5, 0x74, 0xb9, 0x05, 0xff, 0xff, 0x66, 0xe2, 0x7a, 0xdb, 0x2d,
-  0xd3, 0xa6, 0x01, 0xf7, 0x90, 0x04, 0x38, 0x48, 0xf1, 0x65, 0x97, 0x57,
-  0xeb, 0xb6, 0x31, 0xa8, 0x14, 0x4d, 0x49, 0x90, 0x61, 0x17, 0x2b, 0x9c,
-  0xf8, 0x26, 0x8e, 0x0a, 0x9c, 0xe3, 0x14, 0x49, 0xe9, 0xb0, 0xb3, 0xfa,
-  0xb8, 0x43, 0x06, 0x2a, 0x43, 0x47, 0x80, 0x0c, 0x92, 0x7a, 0x15, 0x36,
-  0x38, 0x0c, 0x02, 0xf0, 0x21, 0xcf, 0x7e, 0x1e, 0x45, 0x09, 0xbe, 0x8a,
-  0xa9, 0x8a, 0x31, 0x40, 0x87, 0x9a, 0xc4, 0x17, 0xe7, 0x00, 0x04, 0x04,
-  0x44, 0x02, 0xa8, 0x31, 0x07, 0x21, 0x8a, 0xf7, 0x05, 0xbf, 0xff, 0x36,
-  0xee, 0xc4, 0x1f, 0x58, 0x66, 0x08, 0xfa, 0x3e, 0x84, 0x60, 0x48, 0x44,
-  0x8d, 0x29, 0x31, 0x83, 0x14, 0xc7, 0x85, 0x87, 0xfa, 0x01, 0x47, 0xda,
-  0x76, 0x8f, 0x35, 0x06, 0x11, 0x4f, 0x37, 0x06, 0xfa, 0x3c, 0x39, 0x87,
-  0x89, 0x04, 0x54, 0xbb, 0xa8, 0x2a, 0x01, 0x30, 0x01, 0x92, 0x2f, 0x99,
-  0x81, 0x30, 0x5e, 0x77, 0xcd, 0x16, 0xc2, 0x8b, 0xf9, 0xae, 0xff, 0x34,
-  0x1f, 0xbf, 0x2c, 0x60, 0xc8, 0x22, 0x0b, 0xfe, 0xde, 0xf8, 0x02, 0x32,
-  0x90, 0xd6, 0x8d, 0x58, 0xe6, 0xb7, 0x45, 0x60, 0xaa, 0xc5, 0x94, 0xb9,
-  0x7e, 0xab, 0x00, 0x01, 0xc9, 0x05, 0x00, 0x1e, 0x62, 0x00, 0x44, 0x32,
-  0xe6, 0x16, 0x9f, 0x80, 0xb0, 0xb3, 0xf6, 0xfd, 0x27, 0x7a, 0x21, 0x06,
-  0x23, 0x75, 0x6a, 0x01, 0x87, 0x4d, 0x83, 0xa8, 0x3f, 0x23, 0xce, 0xe5,
-  0xff, 0xa3, 0xba, 0x8a, 0xa1, 0x52, 0x29, 0x2c, 0x18, 0x08, 0x0a, 0x8c,
-  0x2d, 0xe0, 0x41, 0xa3, 0xff, 0xde, 0x21, 0x16, 0xa3, 0x05, 0x15, 0x79,
-  0xf6, 0xc8, 0x50, 0x2c, 0x60, 0xcb, 0x64, 0x7c, 0x27, 0x19, 0x21, 0x78,
-  0xed, 0x81, 0x7f, 0x25, 0xd0, 0x02, 0x74, 0x13, 0x5f, 0xd8, 0x27, 0x13,
-  0x3d, 0xa1, 0xde, 0x2f, 0xb1, 0x88, 0x87, 0xbb, 0x23, 0xff, 0x06, 0x08,
-  0x59, 0x6b, 0x2c, 0x08, 0x3c, 0xb7, 0x39, 0x7d, 0x40, 0x37, 0x86, 0xb0,
-  0x31, 0x4b, 0xa3, 0x06, 0xb3, 0x6e, 0x1c, 0x59, 0x56, 0x74, 0x03, 0x56,
-  0x48, 0x26, 0x32, 0x04, 0x5e, 0xae, 0xfd, 0xb8, 0x12, 0x11, 0x62, 0xff,
-  0xd9, 0xe3, 0x0a, 0x3c, 0x0a, 0x02, 0x15, 0x06, 0x47, 0x4a, 0x4a, 0x58,
-  0xec, 0x7c, 0x31, 0x03, 0x92, 0x01, 0x47, 0x4a, 0x8c, 0x88, 0xf6, 0x74,
-  0x49, 0x8a, 0x4c, 0x49, 0xd7, 0x59, 0x19, 0xb9, 0x10, 0x57, 0x1a, 0xd9,
-  0x0f, 0x0c, 0x87, 0x00, 0x86, 0xd3, 0xbd, 0x78, 0x1b, 0x48, 0xdd, 0xe4,
-  0x06, 0x05, 0x96, 0x59, 0xd6, 0x6a, 0x0b, 0x03, 0x02, 0x20, 0xcd, 0x0a,
-  0x0b, 0x78, 0x12, 0x67, 0xee, 0x0d, 0x8a, 0xa7, 0x84, 0x04, 0x14, 0xd6,
-  0xe5, 0x0e, 0x1b, 0x72, 0x0e, 0x72, 0x0f, 0x72, 0x10, 0x72, 0x11, 0x72,
-  0x11, 0x73, 0x12, 0x88, 0x89, 0x8b, 0xee, 0x13, 0x14, 0x93, 0x13, 0xb9,
-  0x14, 0x7d, 0x15, 0x4d, 0x2d, 0x16, 0x67, 0x2a, 0x22, 0x6e, 0x19, 0x57,
-  0x20, 0x47, 0x57, 0x14, 0x74, 0x4e, 0x16, 0x9c, 0x15, 0x9c, 0x18, 0x00,
-  0x67, 0xc9, 0x03, 0x80, 0x07, 0xe5, 0x3e, 0x55, 0xd6, 0x2a, 0x1e, 0x35,
-  0x73, 0x26, 0x49, 0x24, 0xdd, 0x19, 0x53, 0x1b, 0x34, 0x12, 0xd2, 0x22,
-  0x76, 0x16, 0x69, 0x77, 0x19, 0x15, 0x4a, 0x1b, 0xca, 0x92, 0xdb, 0x0d,
-  0x18, 0x27, 0x1d, 0x27, 0x1a, 0x27, 0x1f, 0x67, 0x5b, 0x2e, 0x34, 0x2c,
-  0x9d, 0x21, 0xd2, 0x23, 0x23, 0x72, 0x30, 0x74, 0x25, 0x20, 0xd9, 0x20,
-  0x3c, 0x09, 0x54, 0x65, 0xba, 0x60, 0x27, 0x9c, 0x12, 0x8b, 0x17, 0xac,
-  0x8c, 0xfe, 0x34, 0xd1, 0x06, 0xee, 0x4b, 0x1f, 0x0b, 0x90, 0x8c, 0x6c,
-  0x50, 0x59, 0x21, 0xcf, 0x30, 0x04, 0x10, 0x38, 0xaa, 0xc3, 0x2a, 0xa2,
-  0xf0, 0x2c, 0xa3, 0x95, 0x50, 0x83, 0xa2, 0x7f, 0x85, 0x0e, 0x21, 0xe0,
-  0x39, 0x9a, 0x8c, 0x8f, 0x70, 0x05, 0x48, 0xe0, 0x5c, 0x24, 0x45, 0x61,
-  0x25, 0x39, 0x39, 0xff, 0x51, 0x06, 0xd7, 0x1d, 0x9a, 0xc0, 0x31, 0xa9,
-  0x9f, 0x01, 0x1f, 0x28, 0xc6, 0xcf, 0x47, 0x0e, 0x08, 0x20, 0xb2, 0xa9,
-  0x68, 0xff, 0xab, 0x5f, 0x17, 0x22, 0xcb, 0x8a, 0xb4, 0xb7, 0x00, 0xa9,
-  0xeb, 0x04, 0x07, 0x0e, 0xb0, 0x25, 0x99, 0x66, 0x38, 0x09, 0xce, 0x52,
-  0x0f, 0xf6, 0xaf, 0x1f, 0x13, 0x46, 0x25, 0xba, 0x45, 0x11, 0x88, 0xae,
-  0x0c, 0x61, 0x3f, 0x32, 0x26, 0x13, 0x12, 0x25, 0x32, 0x06, 0x13, 0x18,
-  0x25, 0x3b, 0xe6, 0xfe, 0xa5, 0x2c, 0x44, 0x6b, 0xad, 0x43, 0xac, 0x14,
-  0xa5, 0x01, 0xb0, 0xc0, 0x25, 0x99, 0x1b, 0xa4, 0x19, 0x01, 0xd8, 0x9a,
-  0xfe, 0x8b, 0x1c, 0x1d, 0x94, 0xd8, 0x7a, 0x1f, 0x4c, 0x1f, 0x93, 0x4c,
-  0xb0, 0x4c, 0x21, 0xe6, 0xbf, 0x05, 0x05, 0xe2, 0x40, 0x59, 0x3a, 0x75,
-  0x3b, 0x7b, 0x1a, 0x0e, 0xa4, 0x64, 0x26, 0xd4, 0xf9, 0xd6, 0x3c, 0x82,
-  0xf7, 0xb0, 0x1b, 0xe6, 0xae, 0xe0, 0x5a, 0x5b, 0x2b, 0x08, 0x3a, 0x17,
-  0x53, 0xc9, 0x14, 0x98, 0xd9, 0x01, 0x03, 0x37, 0x32, 0x18, 0x99, 0xa0,
-  0x81, 0x14, 0x3b, 0xb6, 0x4c, 0x0e, 0x15, 0x6c, 0x59, 0x5b, 0x53, 0x25,
-  0xff, 0x5b, 0x59, 0x2b, 0xc8, 0x1b, 0xda, 0x53, 0xa0, 0x51, 0xa7, 0xf1,
-  0x44, 0x64, 0x7c, 0x2d, 0x29, 0x98, 0x51, 0x61, 0x30, 0x2c, 0xa4, 0xc4,
-  0xcf, 0xdc, 0x10, 0xc0, 0x05, 0x02, 0x5c, 0x3d, 0x20, 0xc9, 0x72, 0x18,
-  0x5f, 0x22, 0x04, 0x3a, 0xbc, 0x04, 0xb0, 0x4b, 0x91, 0x5b, 0x14, 0x25,
-  0x50, 0xbc, 0xa6, 0x44, 0xc2, 0x16, 0x04, 0x1e, 0xb9, 0x9a, 0x1b, 0xd6,
-  0x0e, 0x05, 0x25, 0xd0, 0x86, 0xc2, 0x99, 0xfa, 0x44, 0x6b, 0x53, 0x08,
-  0x38, 0x24, 0x66, 0x28, 0x33, 0x13, 0x8a, 0x6b, 0x0f, 0xb1, 0x2e, 0x56,
-  0x32, 0xdc, 0xb4, 0xb2, 0x0f, 0xff, 0xc6, 0x6e, 0xdd, 0x17, 0x5b, 0x65,
-  0x7d, 0x8c, 0xdf, 0x05, 0x14, 0x21, 0x0d, 0xb2, 0x7d, 0xed, 0x15, 0x74,
-  0x99, 0xfc, 0x14, 0x4a, 0x0f, 0x02, 0xa3, 0xec, 0x31, 0xb6, 0x26, 0x10,
-  0x01, 0xb3, 0x14, 0x9d, 0x26, 0x0b, 0xd4, 0xe9, 0x4e, 0x6a, 0x90, 0x27,
-  0x87, 0xb0, 0x29, 0x88, 0x50, 0xa4, 0x4e, 0x19, 0x5e, 0x99, 0x14, 0xc9,
-  0x80, 0x32, 0x49, 0x48, 0xb9, 0x5f, 0x98, 0xba, 0xa4, 0x02, 0xb1, 0x53,
-  0x0a, 0x3e, 0xbc, 0x69, 0xa0, 0x42, 0xca, 0x76, 0x9e, 0xfb, 0xbc, 0x4b,
-  0x16, 0xd8, 0xbc, 0x76, 0xd3, 0x0e, 0x0b, 0xbc, 0x2e, 0x0d, 0x08, 0xa4,
-  0xcd, 0x65, 0x45, 0xec, 0x43, 0xeb, 0x0b, 0x0c, 0xe6, 0x29, 0xa1, 0x27,
-  0x14, 0x36, 0x3e, 0x12, 0x13, 0xca, 0x09, 0x48, 0x6b, 0x24, 0x02, 0xe1,
-  0x70, 0x46, 0x0b, 0xc8, 0x14, 0xfb, 0x13, 0xd6, 0x25, 0x22, 0xa7, 0xa0,
-  0x1f, 0x2a, 0x47, 0x6d, 0xcd, 0x0a, 0x87, 0x0b, 0x2b, 0x15, 0xcb, 0x67,
-  0xd0, 0x05, 0x48, 0x27, 0x6c, 0x48, 0x24, 0x47, 0xc5, 0xb0, 0x90, 0x89,
-  0xc8, 0x83, 0xfa, 0x14, 0xc9, 0x08, 0xcf, 0x52, 0x08, 0x27, 0x36, 0x21,
-  0x07, 0x14, 0x41, 0x19, 0x59, 0x88, 0x86, 0xd6, 0x0d, 0x53, 0x0b, 0x01,
-  0x04, 0xa1, 0x1e, 0xad, 0x7c, 0x26, 0xf7, 0x77, 0x0b, 0x44, 0x60, 0x8b,
-  0x83, 0xd8, 0x91, 0x2c, 0x81, 0x0e, 0x1e, 0x6e, 0x22, 0xb0, 0xc2, 0x60,
-  0xeb, 0xf0, 0x64, 0x61, 0x9d, 0x82, 0x01, 0xe8, 0x01, 0xb3, 0x13, 0x28,
-  0x96, 0x13, 0xf4, 0x59, 0xf6, 0x2c, 0x18, 0xfc, 0xab, 0x27, 0x35, 0x9d,
-  0xc9, 0x10, 0x22, 0xc1, 0x0a, 0xb1, 0x26, 0x48, 0xbb, 0x2c, 0x29, 0x7f,
-  0x5f, 0x0e, 0x33, 0xc9, 0x03, 0xd8, 0xe3, 0x13, 0xca, 0x03, 0x99, 0x75,
-  0x13, 0x4e, 0x12, 0xe0, 0x7e, 0x2b, 0xd3, 0x1b, 0xc1, 0x01, 0x64, 0x1b,
-  0x8b, 0x3b, 0x19, 0x0d, 0xaa, 0x52, 0xc3, 0x97, 0x4e, 0xe8, 0x89, 0x0b,
-  0x14, 0x13, 0x68, 0x54, 0x77, 0xa2, 0x79, 0x2a, 0x5e, 0x05, 0xec, 0xf5,
-  0x0f, 0x28, 0x96, 0x77, 0x0c, 0x26, 0x7a, 0x63, 0x13, 0x0d, 0x54, 0x73,
-  0x27, 0x13, 0x5d, 0x12, 0x10, 0x10, 0x70, 0x2d, 0x54, 0x35, 0x91, 0x66,
-  0x21, 0x8d, 0xe4, 0x31, 0x2f, 0xf5, 0xf8, 0x51, 0x56, 0xcb, 0x4c, 0x07,
-  0x11, 0x08, 0x56, 0xd2, 0x2a, 0x28, 0x10, 0x81, 0x71, 0x0f, 0x4e, 0xf9,
-  0x20, 0x73, 0x23, 0x48, 0x21, 0x03, 0x28, 0x81, 0xf9, 0x51, 0x03, 0x9d,
-  0x25, 0x84, 0x99, 0x5c, 0x5b, 0x95, 0xc9, 0x32, 0x43, 0x09, 0x8c, 0xfe,
-  0x39, 0xe0, 0x0a, 0xcf, 0xfb, 0x42, 0x80, 0xd9, 0xeb, 0x08, 0x09, 0x89,
-  0x55, 0x58, 0x27, 0x4e, 0xe1, 0xfd, 0x42, 0xe4, 0x29, 0x98, 0x29, 0x90,
-  0x3a, 0xc4, 0x05, 0x8d, 0x51, 0x11, 0x86, 0x0e, 0x0a, 0x84, 0x0d, 0x6c,
-  0x0d, 0x1d, 0x2e, 0x0e, 0x42, 0xec, 0x10, 0x2c, 0x2e, 0x15, 0x42, 0xec,
-  0x13, 0x81, 0x26, 0x5f, 0x41, 0x82, 0x13, 0x88, 0x40, 0xff, 0x65, 0x24,
-  0x8d, 0x26, 0xea, 0x64, 0x32, 0xd8, 0x16, 0x41, 0x5d, 0x18, 0x85, 0x50,
-  0xc8, 0x1a, 0x4c, 0x0e, 0x83, 0x0c, 0x64, 0x7f, 0xd8, 0x40, 0x49, 0xb3,
-  0x0b, 0xb0, 0x24, 0x7c, 0x9c, 0xe2, 0xfc, 0x80, 0x33, 0x43, 0x47, 0x45,
-  0xd3, 0xb2, 0x12, 0xe6, 0x27, 0xa0, 0x29, 0x84, 0x99, 0x90, 0x51, 0x08,
-  0xb3, 0xc9, 0xc6, 0x73, 0xb3, 0xb6, 0x62, 0xfd, 0x35, 0xb5, 0x41, 0x35,
-  0xcd, 0x8a, 0x68, 0xb2, 0x28, 0x2e, 0xbc, 0xb4, 0x03, 0x1a, 0x14, 0x12,
-  0xb4, 0xe8, 0x8b, 0xf8, 0x29, 0x71, 0xdf, 0x15, 0xfe, 0x3a, 0x05, 0x6a,
-  0xda, 0xfb, 0x98, 0x0d, 0x22, 0xb4, 0xd0, 0x11, 0x53, 0x93, 0x28, 0x8e,
-  0x40, 0x14, 0x0b, 0x6e, 0x10, 0x6a, 0x10, 0x08, 0x19, 0xcb, 0x32, 0x3d,
-  0x45, 0x52, 0x46, 0x13, 0x22, 0x00, 0x42, 0x92, 0x43, 0xfd, 0x21, 0xbd,
-  0x1d, 0x80, 0x38, 0xba, 0xb0, 0x10, 0x8b, 0x08, 0xdf, 0xf0, 0xc6, 0x43,
-  0xf4, 0x20, 0x50, 0x5b, 0x1c, 0x0b, 0xb5, 0x7c, 0x18, 0x19, 0xb7, 0xfa,
-  0x00, 0x88, 0x42, 0xf4, 0x22, 0x56, 0x31, 0x10, 0xd8, 0xd8, 0xe0, 0x72,
-  0x01, 0x0d, 0x11, 0x78, 0xc6, 0x09, 0x2f, 0xd6, 0xd7, 0xcf, 0x06, 0x0f,
-  0x61, 0x10, 0x31, 0x2b, 0x55, 0x8c, 0xb6, 0xf6, 0x8b, 0x76, 0x01, 0x90,
-  0x08, 0x26, 0xf8, 0x79, 0x08, 0x03, 0x9a, 0xf8, 0x08, 0x4b, 0xc8, 0x8a,
-  0xfb, 0x72, 0x08, 0x32, 0xf8, 0x33, 0x52, 0xb0, 0x10, 0x3b, 0x36, 0x76,
-  0x02, 0xc2, 0xd8, 0x4d, 0x2a, 0x96, 0x0e, 0x10, 0x88, 0x66, 0x2c, 0xb0,
-  0x2e, 0x24, 0xbb, 0x30, 0x0e, 0x0b, 0x82, 0x32, 0x09, 0xa4, 0x39, 0x06,
-  0x06, 0x04, 0xae, 0x68, 0xea, 0x06, 0x75, 0x75, 0x93, 0x88, 0x9d, 0x3b,
-  0x03, 0xe7, 0x8b, 0x16, 0x3a, 0x67, 0x20, 0xc8, 0x89, 0x51, 0x07, 0x49,
-  0x08, 0x19, 0xe1, 0x10, 0x60, 0xb0, 0x62, 0xc2, 0x20, 0x5b, 0x1c, 0xc5,
-  0x08, 0xd1, 0xad, 0xc4, 0x10, 0xae, 0x17, 0xc8, 0xac, 0xfa, 0xda, 0xf5,
-  0x8b, 0xde, 0x9e, 0xd5, 0xc4, 0x7e, 0xdc, 0x76, 0x89, 0x5d, 0xbd, 0x89,
-  0x4d, 0x06, 0x66, 0x18, 0xc4, 0x85, 0x20, 0x54, 0x6c, 0x5a, 0x1a, 0x55,
-  0x45, 0xbc, 0x56, 0x58, 0x47, 0x91, 0x84, 0x00, 0x46, 0x3d, 0x35, 0xff,
-  0x46, 0x65, 0x16, 0xa2, 0x43, 0x2d, 0x72, 0xeb, 0x1c, 0x36, 0x0e, 0x5a,
-  0x25, 0x28, 0x50, 0x59, 0x65, 0xa9, 0xba, 0x02, 0x41, 0x93, 0x5c, 0x7b,
-  0x27, 0x9f, 0x01, 0x5c, 0x0b, 0xe4, 0x3d, 0x00, 0xa2, 0xc6, 0xa3, 0xfa,
-  0x0b, 0x15, 0x4e, 0xc4, 0x0c, 0x47, 0x2e, 0x7b, 0x4a, 0x55, 0x45, 0x88,
-  0xea, 0xa8, 0x49, 0xe7, 0x9e, 0x9c, 0x0a, 0xa1, 0x22, 0x3b, 0x19, 0x45,
-  0x31, 0x45, 0x95, 0x6d, 0x81, 0x8c, 0x01, 0x58, 0xa2, 0x73, 0x58, 0x2c,
-  0xf9, 0xa6, 0x2c, 0xc9, 0xd8, 0x96, 0xfe, 0xfc, 0x46, 0xc4, 0xd0, 0x50,
-  0xb6, 0x4a, 0x1c, 0x02, 0xed, 0x54, 0x02, 0x11, 0xb3, 0x0c, 0xb9, 0x0d,
-  0xe6, 0x04, 0x01, 0x96, 0xb3, 0x1c, 0xec, 0x20, 0xde, 0xc9, 0x7b, 0x6f,
-  0x4e, 0xb1, 0x5e, 0x8a, 0x15, 0x08, 0x32, 0xb3, 0x75, 0xd9, 0x79, 0xff,
-  0xae, 0xa8, 0xf8, 0x95, 0x3f, 0x88, 0x49, 0xf3, 0x54, 0x2f, 0xf3, 0x77,
-  0x0c, 0x72, 0x35, 0x73, 0x08, 0x39, 0xd8, 0x24, 0x1a, 0x4a, 0xd0, 0x20,
-  0x47, 0xb9, 0x43, 0x0e, 0xc7, 0x8a, 0x54, 0x4e, 0x45, 0x21, 0x1a, 0x8a,
-  0xa3, 0xac, 0x23, 0x89, 0x14, 0x4e, 0x0d, 0xc2, 0xd2, 0x6e, 0x5f, 0x03,
-  0x57, 0x1a, 0x80, 0x71, 0x5f, 0x78, 0xbf, 0xb0, 0xb2, 0x97, 0x5c, 0x0e,
-  0xff, 0xb5, 0x25, 0x82, 0x7a, 0xbd, 0x05, 0xf4, 0x01, 0xcc, 0x48, 0x18,
-  0x55, 0xe9, 0xfb, 0x61, 0x50, 0x02, 0xf2, 0x4a, 0x00, 0x6b, 0x8c, 0xf1,
-  0xbf, 0x71, 0x99, 0x5e, 0x83, 0x3a, 0x0c, 0x21, 0x5c, 0x03, 0x44, 0x4a,
-  0xa9, 0x00, 0xc0, 0xb8, 0x91, 0x84, 0x40, 0xc9, 0x72, 0xa1, 0x4e, 0x34,
-  0x50, 0x84, 0xca, 0x30, 0x4d, 0x00, 0x23, 0x25, 0x20, 0xee, 0x2e, 0x75,
-  0x39, 0x06, 0x96, 0x21, 0x32, 0x6f, 0x22, 0x20, 0x75, 0x2b, 0x17, 0x78,
-  0xc8, 0x20, 0x85, 0x4a, 0xc4, 0x05, 0xff, 0x59, 0x58, 0x23, 0x2e, 0x01,
-  0x59, 0xba, 0xe9, 0xeb, 0x1d, 0xe9, 0xc4, 0x22, 0x6e, 0xc2, 0x1e, 0x44,
-  0x56, 0xa3, 0x28, 0x20, 0xc0, 0x2d, 0x3c, 0x3d, 0x02, 0x00, 0x47, 0xe6,
-  0x88, 0xc2, 0x69, 0x55, 0x36, 0x66, 0x41, 0x7c, 0xde, 0xc8, 0xfe, 0x5a,
-  0x7f, 0x0b, 0x11, 0xc0, 0x10, 0x38, 0xca, 0x62, 0x80, 0x6c, 0x45, 0xb0,
-  0x0d, 0x47, 0xac, 0x23, 0x1f, 0x60, 0x41, 0x1c, 0x0a, 0xbb, 0x42, 0x7f,
-  0x37, 0x0b, 0x58, 0x12, 0x48, 0x50, 0xae, 0x81, 0xca, 0x8a, 0xb5, 0x72,
-  0x04, 0xe2, 0x3f, 0x40, 0x9f, 0xb9, 0x4f, 0x34, 0x54, 0x91, 0x47, 0xa9,
-  0xa0, 0x22, 0x41, 0x23, 0x71, 0x08, 0x61, 0x22, 0x23, 0x35, 0x38, 0x08,
-  0x10, 0xe5, 0x36, 0xcb, 0x18, 0x55, 0xa7, 0x44, 0x82, 0x6b, 0x16, 0x76,
-  0x0c, 0xa8, 0xc9, 0x47, 0xd0, 0xeb, 0x42, 0x5f, 0x0c, 0x3a, 0x18, 0xef,
-  0x5a, 0xa5, 0xf0, 0x50, 0x67, 0x89, 0x92, 0x1b, 0x7a, 0xc7, 0x6a, 0x08,
-  0x0a, 0xcc, 0xd0, 0x2d, 0xa1, 0x01, 0x32, 0x40, 0x2d, 0x81, 0x95, 0x65,
-  0x67, 0xc2, 0xeb, 0x01, 0x64, 0x93, 0xcc, 0xe1, 0xa8, 0xb3, 0xf9, 0x6c,
-  0xdc, 0xf6, 0xb0, 0xf8, 0x17, 0x93, 0x01, 0x0e, 0x21, 0x80, 0xf5, 0x76,
-  0xe6, 0x17, 0xc0, 0xa2, 0x95, 0x3f, 0x81, 0x06, 0x65, 0x8d, 0x93, 0xf5,
-  0x9a, 0xf8, 0xf6, 0x4d, 0x35, 0x6e, 0x52, 0xa8, 0x81, 0x81, 0x4b, 0x1b,
-  0x03, 0x73, 0x65, 0x13, 0x58, 0xfa, 0x0c, 0x06, 0x10, 0x96, 0x0f, 0x03,
-  0x45, 0x21, 0x90, 0x6e, 0x70, 0xf3, 0xfe, 0x25, 0x70, 0x33, 0xde, 0xa3,
-  0x10, 0xc1, 0x9a, 0x09, 0x02, 0x31, 0xbe, 0x46, 0x5a, 0xa3, 0x18, 0x1a,
-  0x8a, 0xb4, 0xac, 0x15, 0x12, 0xca, 0x68, 0xc1, 0x63, 0x10, 0x48, 0xff,
-  0xb0, 0x31, 0xd2, 0x13, 0x6c, 0x29, 0x40, 0x22, 0xfb, 0x98, 0x76, 0x14,
-  0xb6, 0x43, 0x0f, 0x93, 0x01, 0x32, 0x41, 0x1c, 0x5f, 0x80, 0x20, 0x88,
-  0x91, 0xa9, 0xdd, 0x81, 0xe3, 0x4f, 0xe1, 0x2c, 0x83, 0x28, 0x5a, 0x0a,
-  0x05, 0x32, 0x66, 0x75, 0xc5, 0x86, 0x9a, 0xfc, 0xc0, 0xf9, 0x1c, 0x97,
-  0xfd, 0x20, 0x41, 0x81, 0xed, 0xf0, 0x03, 0x01, 0x46, 0x9e, 0x20, 0xa4,
-  0xd6, 0xe8, 0x89, 0xa5, 0xdc, 0x6f, 0x0f, 0xb8, 0x00, 0x30, 0xec, 0x99,
-  0xf7, 0xfe, 0xbc, 0x45, 0x1f, 0x1b, 0xad, 0x63, 0xd5, 0x0e, 0x2d, 0x10,
-  0x50, 0x6e, 0xec, 0x75, 0x73, 0xcd, 0x31, 0x05, 0x2d, 0x09, 0xda, 0xad,
-  0x7f, 0x09, 0xff, 0x4e, 0x0e, 0x03, 0xca, 0x13, 0xd8, 0x89, 0x4e, 0x1b,
-  0xa4, 0x5e, 0x8a, 0xfe, 0x66, 0xb7, 0xa0, 0xe5, 0x0a, 0x03, 0x72, 0xf6,
-  0x20, 0x33, 0x3e, 0x02, 0xd4, 0x1a, 0x0d, 0x62, 0x8d, 0x25, 0xfe, 0xc4,
-  0x0d, 0x00, 0xca, 0xc6, 0x06, 0x18, 0xda, 0x81, 0x27, 0x6d, 0x0a, 0xa9,
-  0xd4, 0x85, 0x47, 0x9e, 0x28, 0x1d, 0x28, 0x07, 0x1e, 0x81, 0x7c, 0x46,
-  0x2c, 0x2e, 0x89, 0x50, 0x26, 0xb0, 0x29, 0x5c, 0xf5, 0xeb, 0x5b, 0x44,
-  0xd6, 0x5f, 0x2a, 0x5d, 0x6d, 0x78, 0x40, 0x19, 0x19, 0x2c, 0x61, 0x2d,
-  0x98, 0x56, 0x1a, 0x58, 0xa7, 0x08, 0x6b, 0x2d, 0x24, 0x2e, 0x25, 0x85,
-  0x30, 0x34, 0xeb, 0x55, 0x85, 0x76, 0x84, 0x22, 0x9c, 0x74, 0xfc, 0xef,
-  0xec, 0x8d, 0x24, 0xef, 0x52, 0xe3, 0xe8, 0x72, 0x1a, 0x22, 0xef, 0xfe,
-  0x0a, 0xf8, 0x0f, 0x72, 0xbf, 0x11, 0x0e, 0x77, 0x0b, 0x22, 0xd8, 0xa3,
-  0x77, 0x58, 0x85, 0x62, 0x6b, 0xa5, 0x69, 0x9d, 0xec, 0x22, 0x28, 0x68,
-  0x18, 0x89, 0xb2, 0x9b, 0x28, 0x72, 0xbf, 0x10, 0x0d, 0x77, 0x0a, 0x23,
-  0xff, 0x74, 0x26, 0x3b, 0x6b, 0xf6, 0x01, 0x5f, 0x95, 0x3b, 0x50, 0x24,
-  0xdc, 0x38, 0x72, 0x25, 0x8b, 0xaa, 0x9b, 0x31, 0x1e, 0x64, 0x18, 0x79,
-  0x77, 0x0c, 0xda, 0x3c, 0xb1, 0x34, 0xed, 0x9b, 0xeb, 0x97, 0x01, 0x59,
-  0x70, 0x4e, 0xcd, 0xfb, 0xc3, 0xa6, 0x88, 0x44, 0xa4, 0x95, 0x3d, 0xf9,
-  0x00, 0xe1, 0x7a, 0x63, 0x5d, 0xa0, 0xf7, 0xf6, 0x0f, 0x75, 0x09, 0xba,
-  0x48, 0xfe, 0xb8, 0xf7, 0xff, 0xe9, 0xe7, 0x00, 0xc6, 0xc7, 0x1b, 0x43,
-  0x91, 0x12, 0x90, 0x0c, 0xdb, 0x36, 0xab, 0x6d, 0x63, 0x3c, 0xf6, 0xc6,
-  0x40, 0x48, 0x4c, 0xb0, 0x9e, 0x08, 0x83, 0x61, 0xd6, 0x6e, 0xb6, 0xdf,
-  0x44, 0xd5, 0x6d, 0x62, 0x6d, 0x00, 0x8d, 0x77, 0x7d, 0xe4, 0x76, 0x51,
-  0x24, 0x88, 0x35, 0x02, 0x44, 0x95, 0x63, 0x82, 0x04, 0xee, 0xf0, 0x5d,
-  0xff, 0x94, 0x11, 0xc9, 0x28, 0xc9, 0x21, 0x4c, 0x0f, 0x9d, 0x08, 0xe1,
-  0xd4, 0xe6, 0xac, 0x13, 0x74, 0xd2, 0x50, 0x0a, 0xb3, 0xfa, 0xac, 0x5e,
-  0xca, 0x19, 0x28, 0x50, 0x06, 0x19, 0x42, 0x17, 0x2f, 0x89, 0xfa, 0x55,
-  0x09, 0x33, 0x0a, 0x08, 0x75, 0xb4, 0x84, 0x90, 0xaf, 0xcc, 0x75, 0xaf,
-  0xe6, 0x24, 0x95, 0x35, 0xd9, 0x83, 0x88, 0xce, 0x05, 0x61, 0x18, 0x76,
-  0xe6, 0x4c, 0xcb, 0xe8, 0xe6, 0x2d, 0xe8, 0xd4, 0x1c, 0xb1, 0x05, 0xb1,
-  0x3e, 0x03, 0x4b, 0xc3, 0xf7, 0x89, 0xf3, 0x71, 0xef, 0xc7, 0x08, 0x4c,
-  0xb1, 0xc3, 0x7d, 0x9a, 0x1f, 0x50, 0x9c, 0x5a, 0x15, 0x0b, 0x71, 0x99,
-  0x40, 0x22, 0x0a, 0x80, 0x44, 0x2d, 0x41, 0x78, 0x8e, 0x89, 0x02, 0x30,
-  0x30, 0x97, 0x2d, 0xe5, 0x40, 0x22, 0x86, 0x28, 0x91, 0xce, 0x0d, 0x23,
-  0x58, 0x40, 0x5a, 0xf2, 0x0a, 0xb7, 0xdf, 0x3b, 0x76, 0x43, 0xa1, 0x03,
-  0x07, 0x80, 0x04, 0xe0, 0xa4, 0x34, 0xa9, 0x54, 0x8a, 0xf8, 0xd0, 0xef,
-  0x40, 0x3d, 0x0e, 0x99, 0x2c, 0x8b, 0xf6, 0xb5, 0xf4, 0x1d, 0x01, 0x53,
-  0x80, 0x51, 0xf4, 0xb7, 0x09, 0x45, 0x0b, 0x47, 0x76, 0xaa, 0x00, 0x32,
-  0x62, 0x41, 0x0b, 0xb5, 0xe9, 0x0e, 0x52, 0xa3, 0x08, 0x16, 0xef, 0x0d,
-  0xec, 0x1f, 0xa2, 0x00, 0x5b, 0x67, 0xe6, 0xb4, 0x72, 0x07, 0x1a, 0x1d,
-  0x2a, 0xf1, 0x02, 0x26, 0xa4, 0xcd, 0x32, 0x87, 0xc4, 0xb2, 0x82, 0xfb,
-  0x90, 0x93, 0x62, 0xb4, 0x10, 0x68, 0x9c, 0x32, 0xfb, 0x48, 0xec, 0xd4,
-  0xda, 0x4a, 0x7f, 0xab, 0xe5, 0x05, 0xd1, 0x08, 0xda, 0x11, 0x96, 0x43,
-  0xa8, 0x59, 0x8a, 0x41, 0x97, 0x56, 0xa0, 0x24, 0x72, 0x39, 0x10, 0xa0,
-  0x08, 0x08, 0x11, 0xbf, 0xc4, 0xeb, 0x49, 0x56, 0x6e, 0xaa, 0xc8, 0x3d,
-  0x50, 0x03, 0x8d, 0x48, 0x58, 0x78, 0x4e, 0xff, 0x8a, 0xc6, 0x5b, 0x01,
-  0xdb, 0x0d, 0x11, 0x1a, 0x68, 0x46, 0x82, 0xf1, 0x4c, 0x21, 0x55, 0x8b,
-  0xe2, 0x90, 0x43, 0xa4, 0x5b, 0x7e, 0xe7, 0xd5, 0x90, 0xfe, 0x91, 0x42,
-  0x7b, 0x13, 0x1c, 0x88, 0x56, 0x35, 0xc8, 0x52, 0x12, 0x86, 0x3f, 0x18,
-  0x7a, 0x58, 0x2c, 0x63, 0x58, 0xaa, 0x78, 0x5d, 0xf8, 0x75, 0xde, 0x16,
-  0x68, 0x58, 0xfd, 0x2b, 0x8a, 0x01, 0x54, 0x87, 0xf2, 0xf8, 0x06, 0x86,
-  0x4c, 0xe7, 0x20, 0xbf, 0x18, 0x92, 0xb2, 0xc3, 0x57, 0x78, 0x29, 0x01,
-  0xeb, 0xc2, 0x10, 0x53, 0x14, 0x40, 0x25, 0x61, 0x8c, 0x8b, 0xd5, 0x16,
-  0x76, 0x6a, 0xa7, 0xa6, 0xd4, 0x74, 0x4e, 0x87, 0x62, 0xf4, 0x08, 0xd7,
-  0xa9, 0x63, 0x65, 0xe6, 0x90, 0xe4, 0xe4, 0x03, 0x03, 0x90, 0x10, 0x9d,
-  0xe9, 0x56, 0x56, 0xe2, 0x18, 0x2e, 0xce, 0x08, 0xa5, 0x5e, 0x8c, 0xf9,
-  0x71, 0x13, 0xe6, 0x80, 0x71, 0x06, 0x12, 0x73, 0x52, 0x17, 0xe2, 0xcf,
-  0xf9, 0x21, 0xc8, 0xa7, 0x5e, 0x83, 0xfb, 0x2a, 0xcb, 0x88, 0x55, 0x08,
-  0x96, 0x03, 0x11, 0x55, 0x08, 0xbe, 0x58, 0xa1, 0xe8, 0x64, 0x63, 0x38,
-  0xea, 0xab, 0x75, 0x2c, 0x27, 0xfe, 0x0e, 0x24, 0x3a, 0x1d, 0xe9, 0xb5,
-  0x71, 0x85, 0x71, 0xc4, 0x6a, 0x66, 0xa2, 0xdd, 0x47, 0xbf, 0xfe, 0x59,
-  0x14, 0x18, 0x80, 0x10, 0x10, 0x36, 0x30, 0x1e, 0xbb, 0xf6, 0x90, 0xc1,
-  0x43, 0xad, 0xe4, 0xd2, 0x00, 0x3d, 0x90, 0xf6, 0x45, 0x65, 0x53, 0x21,
-  0x90, 0x18, 0xff, 0xb8, 0x7f, 0x48, 0xa4, 0x5a, 0x33, 0xaf, 0x55, 0x08,
-  0xdf, 0x72, 0x03, 0x22, 0x00, 0x90, 0xce, 0x50, 0xf2, 0x9a, 0x27, 0xaa,
-  0x9a, 0xd7, 0x2b, 0x0e, 0xb2, 0xa2, 0x29, 0x90, 0x64, 0xe0, 0x3b, 0x3a,
-  0x50, 0x2d, 0x76, 0xa8, 0x61, 0xaa, 0x02, 0xdb, 0xc8, 0x66, 0x00, 0x30,
-  0x86, 0x03, 0xd3, 0x10, 0x1b, 0x50, 0x29, 0x2c, 0x2b, 0x05, 0x80, 0x15,
-  0xb0, 0x46, 0x36, 0xbb, 0x78, 0x40, 0xf8, 0x64, 0x26, 0x55, 0xea, 0x1b,
-  0xb6, 0xaa, 0x27, 0x30, 0xc8, 0x18, 0x1e, 0x0f, 0x62, 0x13, 0x21, 0x2a,
-  0xd6, 0x09, 0xff, 0x4c, 0xf5, 0x48, 0xdb, 0x0e, 0x57, 0x03, 0xc9, 0xff,
-  0xa1, 0xf5, 0x69, 0x29, 0xa1, 0xdf, 0x86, 0x21, 0x44, 0x25, 0xdd, 0xc6,
-  0x02, 0xad, 0x18, 0x59, 0x1c, 0xe8, 0x0b, 0x16, 0xf2, 0x84, 0x12, 0x45,
-  0x83, 0xe8, 0x01, 0x6c, 0x51, 0x11, 0xa3, 0xfd, 0x2b, 0x16, 0xa8, 0x12,
-  0x82, 0x65, 0x5f, 0x24, 0xf0, 0x80, 0x94, 0xa1, 0x61, 0xc2, 0x4b, 0x22,
-  0xc6, 0xc2, 0x18, 0xb5, 0xf7, 0x9b, 0x80, 0x7d, 0x2e, 0xad, 0x84, 0x58,
-  0x90, 0x72, 0xee, 0x68, 0x52, 0xe3, 0xa2, 0xcc, 0xaf, 0x18, 0x50, 0x0c,
-  0x0f, 0xe0, 0x23, 0xe4, 0x60, 0x0e, 0xd6, 0xf7, 0x04, 0xec, 0x10, 0x00,
-  0x20, 0x09, 0x91, 0xff, 0x93, 0xff, 0x46, 0x39, 0xc1, 0xbb, 0xa0, 0xc4,
-  0xcd, 0x43, 0x08, 0xb8, 0x08, 0x3e, 0x51, 0x07, 0x2c, 0xa7, 0x60, 0x4f,
-  0x06, 0x12, 0x72, 0x0e, 0x2a, 0x45, 0xf5, 0x45, 0x5e, 0x85, 0xea, 0xa6,
-  0x52, 0x23, 0xb5, 0xc5, 0x97, 0xd5, 0xe6, 0xd3, 0x25, 0x00, 0x67, 0x2e,
-  0x25, 0xb9, 0x0e, 0x66, 0x30, 0xad, 0xd5, 0xf6, 0xcf, 0x33, 0x39, 0x7b,
-  0x27, 0x3e, 0x2d, 0x11, 0x2b, 0x9c, 0x4e, 0x00, 0x1f, 0x81, 0x66, 0xe6,
-  0x0f, 0x74, 0xb8, 0x0e, 0x06, 0x84, 0xf1, 0xe0, 0xeb, 0xb2, 0x3d, 0x90,
-  0x52, 0x90, 0xe7, 0x32, 0xff, 0x51, 0xb3, 0x20, 0x60, 0x8c, 0xc8, 0x0e,
-  0xb6, 0x56, 0x56, 0x87, 0x1d, 0x93, 0x62, 0x93, 0x0a, 0x65, 0x8a, 0xc8,
-  0xe2, 0x0b, 0x3f, 0x9b, 0x04, 0x10, 0xcb, 0xff, 0x0f, 0xe2, 0xcb, 0x00,
-  0x00, 0xe4, 0x6a, 0xe7, 0x23, 0x97, 0x11, 0x51, 0x8b, 0xc4, 0x40, 0xde,
-  0x55, 0xca, 0x45, 0x58, 0x40, 0x6a, 0x20, 0x60, 0x3c, 0x84, 0xf9, 0x2a,
-  0x92, 0x81, 0xb1, 0x30, 0x31, 0xc2, 0x03, 0x46, 0xda, 0x3d, 0x87, 0x2d,
-  0x06, 0xa9, 0x1d, 0x67, 0x76, 0x87, 0x2f, 0x0b, 0xfe, 0x0b, 0x87, 0x31,
-  0x06, 0x75, 0x1e, 0x25, 0xee, 0x98, 0xf2, 0x11, 0x4c, 0xf8, 0x22, 0x5b,
-  0x3b, 0x19, 0x26, 0x06, 0x89, 0xfc, 0x1f, 0x89, 0x97, 0xaf, 0x0c, 0x64,
-  0x2c, 0xe0, 0x74, 0x56, 0x22, 0xf5, 0x08, 0x42, 0xae, 0x22, 0x4d, 0x68,
-  0x45, 0x6d, 0xa0, 0x3c, 0x15, 0x88, 0x23, 0x94, 0x9c, 0x4d, 0x2f, 0xf8,
-  0x2c, 0xf6, 0x9a, 0x41, 0xf9, 0x13, 0x92, 0x80, 0xa4, 0x2f, 0x40, 0x58,
-  0xee, 0xde, 0x31, 0x04, 0xdd, 0x4e, 0x9a, 0x88, 0xcb, 0x6a, 0x88, 0x84,
-  0x6f, 0x75, 0x03, 0x7c, 0xbf, 0x4c, 0xbb, 0x92, 0x84, 0x52, 0x7f, 0x48,
-  0x24, 0x1f, 0x25, 0x2e, 0x70, 0x33, 0xf2, 0x5a, 0x99, 0xcc, 0x4a, 0x10,
-  0x65, 0x17, 0x6b, 0x5d, 0x34, 0x02, 0x75, 0x0e, 0xb1, 0x03, 0x01, 0x20,
-  0x35, 0xe2, 0x9f, 0x83, 0x58, 0xea, 0x1f, 0x85, 0x90, 0x42, 0x82, 0xdc,
-  0x19, 0x20, 0xa6, 0x31, 0x6a, 0xc2, 0x28, 0x58, 0xcc, 0x0d, 0x2a, 0x38,
-  0x8d, 0x00, 0x49, 0x25, 0x28, 0xb0, 0x7f, 0xb0, 0x05, 0x90, 0x58, 0xc8,
-  0x2e, 0x13, 0x17, 0x24, 0x68, 0x24, 0xc1, 0x9a, 0x49, 0x11, 0xec, 0xa8,
-  0x0a, 0x06, 0xf3, 0x55, 0x48, 0x88, 0xa0, 0x10, 0x00, 0xa4, 0x17, 0xbb,
-  0xa0, 0x8c, 0x29, 0x38, 0xfe, 0x2c, 0xb7, 0x75, 0xfc, 0x73, 0x50, 0x85,
-  0x75, 0xb2, 0x6b, 0x06, 0x56, 0xc8, 0xaf, 0xa6, 0x09, 0x77, 0x9e, 0xc0,
-  0x13, 0x08, 0xf1, 0x4c, 0xf7, 0xca, 0x0a, 0x47, 0xbd, 0xe4, 0x2f, 0x20,
-  0xe2, 0x2f, 0x01, 0x24, 0x86, 0x58, 0x11, 0x39, 0xc7, 0x06, 0x42, 0xa8,
-  0x4e, 0x2c, 0x56, 0xa0, 0x13, 0x32, 0x45, 0xec, 0x2e, 0x67, 0xc4, 0x52,
-  0x5c, 0x0a, 0x71, 0x4d, 0x65, 0x0b, 0x80, 0x4a, 0x99, 0x55, 0x06, 0xec,
-  0x22, 0x8e, 0x1c, 0x05, 0x68, 0x79, 0xad, 0x9e, 0xc1, 0x6d, 0x89, 0x4d,
-  0x1e, 0xf4, 0x01, 0x78, 0x39, 0x26, 0xb7, 0x88, 0x26, 0x8f, 0x09, 0x00,
-  0x5b, 0x57, 0xf8, 0x25, 0x20, 0x5f, 0x5a, 0xc1, 0x80, 0x7e, 0xd4, 0x14,
-  0xd6, 0xe0, 0x32, 0x32, 0x0a, 0xab, 0x19, 0x36, 0x2e, 0x02, 0xc3, 0x18,
-  0x00, 0x19, 0x9a, 0xaa, 0x0f, 0x60, 0xaa, 0x04, 0xad, 0x04, 0xbb, 0x87,
-  0xf7, 0x1f, 0x46, 0x5d, 0x13, 0x7c, 0xa1, 0x8e, 0x24, 0x0e, 0xfe, 0xdb,
-  0x84, 0x8a, 0x02, 0x6d, 0x3a, 0x99, 0x45, 0x78, 0xc6, 0x90, 0x14, 0x9a,
-  0x0e, 0x06, 0x3a, 0x45, 0x25, 0x40, 0x3a, 0x75, 0x46, 0x03, 0x44, 0x0b,
-  0x51, 0x21, 0xd5, 0x78, 0x27, 0x01, 0x83, 0xa6, 0x23, 0x51, 0x25, 0x4d,
-  0x80, 0x24, 0xe5, 0xfa, 0xe9, 0x01, 0x01, 0xaa, 0xba, 0x1e, 0x07, 0xd8,
-  0x04, 0x10, 0x9a, 0xb8, 0xc9, 0x0b, 0x0c, 0x03, 0x1c, 0x2a, 0x87, 0x95,
-  0x53, 0x0d, 0xba, 0xd3, 0xf6, 0x0a, 0x61, 0xe1, 0x49, 0xac, 0x1b, 0x1b,
-  0x62, 0x95, 0x3d, 0xa6, 0x5c, 0x75, 0xbe, 0xe2, 0x0a, 0x0a, 0xb0, 0xff,
-  0x5a, 0xb0, 0x16, 0x4a, 0xfa, 0x22, 0xec, 0x29, 0x74, 0x68, 0x04, 0x26,
-  0xe8, 0xcb, 0x9d, 0x04, 0x1e, 0x4c, 0xcd, 0x8c, 0xe1, 0x57, 0x5a, 0x2b,
-  0xb3, 0x10, 0x1c, 0x00, 0x58, 0xb6, 0x31, 0x32, 0x34, 0x67, 0xf2, 0x40,
-  0x17, 0x20, 0xd8, 0x0f, 0x18, 0x4e, 0xeb, 0x43, 0xc2, 0x0e, 0x59, 0xea,
-  0xb2, 0x51, 0xd1, 0x9c, 0x95, 0x0c, 0x81, 0xb6, 0xee, 0xe6, 0xb4, 0x9a,
-  0x55, 0xa9, 0x77, 0xf8, 0x85, 0x28, 0x8b, 0x83, 0x76, 0x61, 0x4a, 0x69,
-  0xe1, 0x5f, 0x6a, 0x09, 0x00, 0x9c, 0x35, 0x20, 0x41, 0x58, 0x8a, 0x58,
-  0xc3, 0x9f, 0x8a, 0x6c, 0x09, 0xd7, 0xe2, 0xf0, 0x02, 0x95, 0xf8, 0xa0,
-  0xcb, 0x80, 0x59, 0xc1, 0x8c, 0xc1, 0x02, 0x10, 0x06, 0x33, 0x8e, 0x14,
-  0x12, 0xb0, 0x0b, 0x0d, 0x62, 0x16, 0x18, 0xac, 0x51, 0x27, 0x46, 0x04,
-  0x01, 0x58, 0x7e, 0x12, 0x15, 0xcf, 0xe0, 0x83, 0x00, 0xc2, 0x8c, 0xd1,
-  0x06, 0xc4, 0x48, 0xa4, 0x5c, 0x09, 0x4f, 0x3c, 0x28, 0x40, 0xc0, 0x84,
-  0x8c, 0x31, 0xe8, 0x04, 0x1b, 0x86, 0x8d, 0x96, 0x6a, 0x39, 0x2d, 0x18,
-  0x51, 0x09, 0x01, 0x1b, 0x5d, 0x07, 0xb8, 0x06, 0x51, 0x58, 0xb0, 0x12,
-  0x2a, 0xc2, 0x59, 0xd0, 0x6c, 0x5a, 0x04, 0x91, 0x34, 0x99, 0x42, 0x2c,
-  0x6c, 0xa4, 0xa3, 0x41, 0x85, 0x34, 0xcc, 0xc5, 0xcd, 0x9c, 0x96, 0xb4,
-  0x83, 0x3b, 0x25, 0x97, 0xb0, 0x40, 0xb2, 0x50, 0x5f, 0x04, 0x19, 0x73,
-  0x63, 0x7f, 0xa8, 0x9e, 0x30, 0x62, 0x2d, 0x02, 0xc8, 0x0e, 0x79, 0x08,
-  0x40, 0xec, 0x28, 0xfe, 0xc7, 0xcb, 0x58, 0x56, 0xb1, 0x12, 0x0c, 0xc5,
-  0x9b, 0x5e, 0x45, 0x20, 0xef, 0x2c, 0x3b, 0x65, 0x49, 0x62, 0x40, 0x0f,
-  0xb8, 0x5e, 0x01, 0xcb, 0x0e, 0xca, 0x48, 0x5b, 0xbe, 0x78, 0x52, 0xb1,
-  0x17, 0x45, 0x14, 0x18, 0x46, 0xe3, 0x74, 0x54, 0x55, 0x84, 0x0b, 0x98,
-  0x02, 0xf6, 0x61, 0x41, 0x75, 0x2a, 0x07, 0xfd, 0x3f, 0x52, 0x52, 0x75,
-  0x23, 0xbf, 0x06, 0xbf, 0xe6, 0x01, 0x41, 0x61, 0xdd, 0x75, 0x1a, 0x08,
-  0xe4, 0xf9, 0x01, 0x72, 0x72, 0x75, 0x11, 0xbc, 0xfe, 0x01, 0x55, 0xaa,
-  0x1a, 0x4d, 0xb7, 0xad, 0xbf, 0xfc, 0x6b, 0x6b, 0x70, 0x24, 0x11, 0x18,
-  0xee, 0x84, 0x17, 0x19, 0xd8, 0x0f, 0xeb, 0x0f, 0x61, 0x11, 0x22, 0x02,
-  0x42, 0x75, 0x56, 0x5e, 0x43, 0x3d, 0xb4, 0x0c, 0x4d, 0x1b, 0xa8, 0x10,
-  0x6f, 0x04, 0x08, 0x3d, 0x20, 0x2c, 0x17, 0x51, 0xae, 0x75, 0x53, 0x11,
-  0x2c, 0x01, 0x02, 0x93, 0xe9, 0xa6, 0x82, 0xe4, 0x60, 0xd1, 0x1c, 0x69,
-  0x85, 0xe4, 0x73, 0xfe, 0xea, 0x41, 0xbf, 0x6f, 0x87, 0xee, 0xb7, 0x01,
-  0x04, 0x97, 0xec, 0x82, 0x01, 0x2b, 0x75, 0x24, 0x40, 0xc2, 0xa3, 0x8d,
-  0xaf, 0x10, 0x70, 0xe2, 0x81, 0xe4, 0x11, 0x16, 0x59, 0x76, 0x0e, 0x71,
-  0x17, 0xbe, 0x2b, 0xbe, 0x2d, 0x57, 0xa9, 0xa2, 0x21, 0xe5, 0x21, 0xb0,
-  0x56, 0x8e, 0x0c, 0x3d, 0xac, 0x40, 0x85, 0x90, 0xe4, 0xe2, 0xfd, 0xe4,
-  0x1a, 0xe7, 0xea, 0x90, 0xe8, 0x16, 0x69, 0x56, 0xf5, 0x64, 0x18, 0x3f,
-  0x5b, 0xc2, 0x9a, 0x04, 0xe6, 0xcc, 0x17, 0x53, 0xe8, 0x3c, 0xea, 0xef,
-  0x94, 0xac, 0x3a, 0x19, 0xd0, 0x52, 0x2d, 0x22, 0x03, 0x1f, 0x41, 0x6c,
-  0x65, 0x8c, 0xcf, 0x2c, 0x04, 0x08, 0x2d, 0x20, 0x01, 0x8f, 0x81, 0x22,
-  0x0a, 0x00, 0xb0, 0x4c, 0x7b, 0xd6, 0x05, 0x73, 0x04, 0x63, 0xda, 0x41,
-  0x50, 0x00, 0xf4, 0x60, 0xde, 0x17, 0xc5, 0xdb, 0xdc, 0x0b, 0xe6, 0x2d,
-  0xd8, 0x40, 0xaa, 0xc0, 0xa4, 0x9e, 0x17, 0x04, 0x4f, 0xc6, 0xd6, 0x42,
-  0x3f, 0xe2, 0x39, 0x24, 0xaf, 0xf4, 0x02, 0x6e, 0xc7, 0xd2, 0x03, 0x8a,
-  0xbc, 0xcb, 0x25, 0xdc, 0xd5, 0x60, 0x2b, 0x9a, 0x67, 0x9b, 0x76, 0xf2,
-  0x6d, 0x08, 0xa0, 0xcd, 0x85, 0x08, 0xb7, 0xee, 0x5c, 0xdc, 0x03, 0x82,
-  0x73, 0x8b, 0xa0, 0x1d, 0xe6, 0x2f, 0x52, 0xbb, 0x29, 0x79, 0x0d, 0xdb,
-  0x6c, 0x04, 0x41, 0x6e, 0x40, 0xea, 0xa9, 0x02, 0x75, 0xef, 0x35, 0x0f,
-  0xe2, 0x1b, 0x9a, 0xa2, 0x3b, 0xad, 0xae, 0xf8, 0xa7, 0x73, 0xc2, 0x10,
-  0x7b, 0xe0, 0x2c, 0x00, 0x84, 0x0e, 0xcc, 0x79, 0xdc, 0x01, 0x88, 0xd8,
-  0x24, 0xbb, 0x62, 0x0b, 0x59, 0x1d, 0xcc, 0xdd, 0x4a, 0xa8, 0x19, 0x69,
-  0x32, 0x08, 0x52, 0x19, 0x6d, 0x51, 0xe2, 0x0c, 0x64, 0x80, 0x83, 0x6a,
-  0x99, 0x22, 0x8b, 0xff, 0x2c, 0x21, 0xc7, 0xc1, 0x62, 0x19, 0x29, 0x48,
-  0x25, 0xb2, 0x46, 0x94, 0x68, 0x92, 0x41, 0x1c, 0x74, 0x24, 0x51, 0x90,
-  0xf6, 0xac, 0x3c, 0x09, 0x82, 0xa9, 0x30, 0x0c, 0x98, 0xc6, 0x01, 0x27,
-  0x09, 0x61, 0xaa, 0x62, 0x95, 0x9d, 0xf2, 0xa7, 0xfa, 0x44, 0x8b, 0x52,
-  0xd5, 0xcc, 0xd1, 0xa9, 0x03, 0xb3, 0xe5, 0x14, 0x11, 0x96, 0xb4, 0x08,
-  0xc8, 0xca, 0x6c, 0xc3, 0xcb, 0x03, 0x45, 0x7a, 0x66, 0x09, 0xb5, 0x30,
-  0x15, 0x20, 0x33, 0x2b, 0xbd, 0x2b, 0x64, 0x29, 0xd8, 0x15, 0x56, 0x4b,
-  0x34, 0x3d, 0xeb, 0x9a, 0x00, 0xc2, 0xa3, 0x8b, 0x5e, 0x01, 0x02, 0xfb,
-  0x00, 0x85, 0x8e, 0x60, 0x39, 0x08, 0x43, 0x1c, 0xe2, 0xc7, 0xeb, 0x0c,
-  0x85, 0x87, 0x04, 0x48, 0x43, 0x68, 0x00, 0xc8, 0xc1, 0xd4, 0x93, 0xad,
-  0x4d, 0x2c, 0x10, 0x96, 0x02, 0x92, 0x62, 0xc1, 0x24, 0x9a, 0x6d, 0x05,
-  0x52, 0x31, 0x0b, 0x40, 0xf2, 0xc4, 0x9f, 0xea, 0x03, 0xd8, 0x1b, 0x6e,
-  0x8a, 0x4e, 0xf5, 0xf8, 0x80, 0xe1, 0x07, 0x10, 0x6b, 0x83, 0x6a, 0x1a,
-  0x01, 0x28, 0x92, 0x1b, 0x64, 0x1e, 0xc0, 0x14, 0x85, 0xe3, 0x8a, 0x4b,
-  0x61, 0x07, 0x9b, 0xe0, 0x9e, 0x02, 0x0a, 0x40, 0xe6, 0x30, 0x05, 0x9d,
-  0xc7, 0xde, 0x16, 0x97, 0x06, 0x8d, 0x07, 0x15, 0x9c, 0x25, 0xc7, 0x00,
-  0x90, 0xa5, 0x30, 0xaa, 0xe0, 0x3b, 0xa9, 0x1b, 0xc0, 0x16, 0xf8, 0x43,
-  0x90, 0x60, 0x19, 0x62, 0xb2, 0x41, 0xe2, 0x10, 0x09, 0xac, 0x38, 0x43,
-  0xb3, 0xc2, 0x88, 0x68, 0xa3, 0xca, 0xf0, 0xe1, 0x01, 0x51, 0x82, 0xcc,
-  0x9b, 0x5c, 0xf4, 0xe9, 0x80, 0x90, 0x00, 0xfc, 0x3e, 0x75, 0x1d, 0x02,
-  0x59, 0x68, 0x4b, 0x9d, 0x03, 0x35, 0x4d, 0xa6, 0x0c, 0x35, 0x65, 0x9b,
-  0x47, 0x1c, 0x30, 0x60, 0xb0, 0x5c, 0x3f, 0x02, 0x9d, 0x2f, 0x26, 0x00,
-  0x75, 0x38, 0x8b, 0x88, 0xb7, 0x03, 0x47, 0x1a, 0x5e, 0x5c, 0x7c, 0x4e,
-  0xf2, 0x02, 0x17, 0x22, 0x40, 0x3e, 0xb8, 0x06, 0xa8, 0x37, 0x6f, 0xe9,
-  0x33, 0xa1, 0x01, 0xb5, 0x66, 0xf2, 0xd9, 0xf4, 0x00, 0x9e, 0x88, 0xa4,
-  0xd4, 0x41, 0x56, 0x76, 0x0c, 0xf4, 0x04, 0x6c, 0x7b, 0x56, 0x41, 0x22,
-  0xd7, 0xed, 0x09, 0x4c, 0xff, 0x8c, 0xb3, 0x20, 0x80, 0x74, 0xf2, 0x54,
-  0x87, 0x7f, 0xf7, 0xb3, 0x00, 0x8f, 0x65, 0x4f, 0x62, 0x8c, 0x17, 0x0b,
-  0x01, 0x0b, 0xd2, 0xad, 0x91, 0x00, 0x64, 0xc3, 0x30, 0x03, 0xb2, 0xbd,
-  0x13, 0xa8, 0x46, 0x01, 0x2d, 0x3a, 0x52, 0xda, 0x8a, 0x55, 0x00, 0x58,
-  0x6c, 0x43, 0x6b, 0x1c, 0x04, 0x02, 0x07, 0x97, 0xa8, 0xf6, 0xa4, 0x62,
-  0xec, 0xf6, 0x86, 0xd9, 0x58, 0x80, 0xc2, 0xcc, 0x58, 0x6a, 0x55, 0x84,
-  0x36, 0x07, 0x18, 0xeb, 0x84, 0x00, 0xdf, 0x25, 0x9f, 0x4e, 0xe9, 0x10,
-  0xfe, 0x54, 0x1a, 0xd7, 0xa6, 0xbf, 0xd8, 0x18, 0xfe, 0x1d, 0x02, 0xc1,
-  0x0c, 0x01, 0x80, 0x73, 0x8b, 0x37, 0x2c, 0x36, 0x3d, 0x1d, 0xfd, 0x28,
-  0x83, 0x95, 0xd1, 0x14, 0x96, 0x61, 0x25, 0xd4, 0xc0, 0x2d, 0x06, 0xb2,
-  0x4b, 0x51, 0xb2, 0x23, 0x72, 0xf9, 0xfc, 0x29, 0x6e, 0x0b, 0x80, 0x22,
-  0xcb, 0xde, 0x82, 0x6e, 0x43, 0x49, 0x95, 0xc7, 0xae, 0xd2, 0x06, 0x99,
-  0x31, 0x9c, 0x10, 0x2d, 0xc2, 0x64, 0x36, 0xf1, 0x51, 0x5e, 0x01, 0x80,
-  0x33, 0x42, 0x0a, 0x90, 0xdc, 0xfe, 0x98, 0x16, 0x50, 0xb8, 0xec, 0x4a,
-  0xd3, 0x90, 0xe0, 0x7a, 0x02, 0xab, 0x45, 0xd4, 0x52, 0x8b, 0xc4, 0x02,
-  0x06, 0x64, 0x05, 0xa0, 0x25, 0x35, 0x10, 0x19, 0x61, 0x50, 0xc8, 0x97,
-  0x5c, 0xb6, 0x80, 0x13, 0x4a, 0xe4, 0x03, 0x98, 0x16, 0x02, 0xb5, 0x40,
-  0xb2, 0xa3, 0xb5, 0x42, 0xe9, 0x13, 0xa1, 0x0b, 0x50, 0x97, 0x54, 0x87,
-  0x88, 0x00, 0x0c, 0x6a, 0x09, 0x90, 0x70, 0x2e, 0x58, 0x40, 0x90, 0x95,
-  0xa8, 0x88, 0x04, 0xf2, 0x21, 0xcf, 0x31, 0xff, 0x68, 0x61, 0xd4, 0x78,
-  0xa7, 0x00, 0x80, 0xf8, 0xaa, 0x50, 0x4a, 0x1f, 0x64, 0x80, 0xd8, 0x17,
-  0x46, 0x20, 0x32, 0x1e, 0x24, 0x01, 0xb6, 0x43, 0x98, 0x67, 0x16, 0x0a,
-  0x89, 0x38, 0x1d, 0x74, 0x39, 0x90, 0x4f, 0x5e, 0xe9, 0xb9, 0x20, 0x32,
-  0x48, 0x2a, 0x3a, 0x04, 0xa2, 0xbd, 0x3a, 0x1c, 0x19, 0xa2, 0x74, 0xde,
-  0x86, 0x4a, 0x8b, 0xa3, 0x2e, 0x58, 0x24, 0x6c, 0x0c, 0x07, 0xbe, 0x83,
-  0x30, 0x23, 0x96, 0x26, 0x60, 0x00, 0x24, 0x29, 0x0d, 0xe8, 0x25, 0x4a,
-  0x1c, 0xf6, 0x33, 0xff, 0x23, 0x69, 0x60, 0x10, 0x70, 0xac, 0x0c, 0x10,
-  0x29, 0x43, 0x9c, 0xc4, 0x75, 0x2d, 0x3e, 0x5d, 0x98, 0x30, 0x02, 0x4f,
-  0xbc, 0xd6, 0x15, 0x02, 0xee, 0x11, 0xb6, 0x82, 0x2e, 0x4b, 0x59, 0x53,
-  0xb2, 0x2d, 0xb6, 0x8a, 0x03, 0x04, 0x2a, 0x28, 0x9f, 0xbe, 0x12, 0x72,
-  0x00, 0x96, 0xec, 0x2c, 0x92, 0x44, 0x18, 0x60, 0x18, 0x02, 0xb2, 0x7a,
-  0x14, 0x98, 0xff, 0x8c, 0xef, 0x8e, 0x78, 0x10, 0x20, 0xb4, 0x85, 0xcc,
-  0x80, 0xc3, 0xb0, 0x91, 0xb9, 0x82, 0xce, 0x31, 0xbf, 0x88, 0x0b, 0xd6,
-  0xb0, 0x06, 0x7d, 0x2a, 0xeb, 0x1c, 0xda, 0x12, 0x06, 0xc4, 0x51, 0x3e,
-  0x6d, 0xa9, 0x44, 0x01, 0x1b, 0xfd, 0x84, 0xc4, 0x47, 0x0b, 0x5d, 0xf3,
-  0xf8, 0x75, 0x1d, 0x04, 0xb7, 0xa9, 0x0c, 0x09, 0xe2, 0x83, 0x07, 0x03,
-  0x98, 0x95, 0xa8, 0xb3, 0xb3, 0xe6, 0x92, 0xb9, 0xb0, 0x56, 0x4c, 0x83,
-  0xa5, 0xad, 0x8c, 0xa6, 0x04, 0x21, 0x8f, 0xa8, 0x81, 0x8f, 0x64, 0x0e,
-  0xc1, 0x78, 0xc2, 0xaa, 0xf0, 0x69, 0x01, 0x20, 0xea, 0x58, 0xa2, 0x8c,
-  0x51, 0x18, 0x06, 0x33, 0xbc, 0x41, 0x08, 0x35, 0x00, 0x87, 0xa2, 0x82,
-  0x6e, 0x03, 0x99, 0x6a, 0x6d, 0x22, 0x70, 0x02, 0x46, 0x75, 0x06, 0xdc,
-  0x7a, 0x61, 0x1d, 0x44, 0x48, 0x72, 0x30, 0xd9, 0x10, 0x80, 0x02, 0x7f,
-  0xbe, 0x6d, 0x89, 0x16, 0xc0, 0xdb, 0x6d, 0xa1, 0x06, 0x0b, 0x95, 0x06,
-  0xd4, 0x25, 0xb3, 0x42, 0x87, 0x75, 0xf4, 0xd4, 0x4a, 0xdf, 0x54, 0x80,
-  0x2c, 0x74, 0x91, 0x20, 0xb5, 0x3d, 0x3e, 0xea, 0x2f, 0x2d, 0xd0, 0x27,
-  0x8e, 0x7b, 0x9a, 0x64, 0xe1, 0x6b, 0x45, 0x73, 0xb5, 0x46, 0x5a, 0x03,
-  0xd0, 0x4e, 0x04, 0x86, 0x93, 0xd6, 0x1a, 0x84, 0xb6, 0x05, 0xc4, 0x45,
-  0xc8, 0x2d, 0x10, 0x83, 0xc0, 0x16, 0xb5, 0x21, 0xc7, 0x30, 0x14, 0x64,
-  0xa5, 0x78, 0x02, 0x01, 0x00, 0xb0, 0x28, 0x04, 0x43, 0xee, 0x4f, 0x40,
-  0x3c, 0x00, 0x16, 0x2f, 0x44, 0xa3, 0xe9, 0x36, 0x8a, 0x48, 0x02, 0xc9,
-  0x47, 0xf8, 0x04, 0xeb, 0xa1, 0xeb, 0x9f, 0x08, 0x92, 0x7d, 0xb1, 0x18,
-  0x9f, 0x1b, 0x1d, 0xd6, 0xb3, 0x1e, 0x71, 0xff, 0x02, 0x8c, 0xfd, 0x1c,
-  0x74, 0x5f, 0x01, 0x4f, 0x76, 0x07, 0x3e, 0x74, 0x52, 0xf7, 0x16, 0x0f,
-  0xce, 0x0e, 0xce, 0x16, 0x02, 0x59, 0x3b, 0x3e, 0xe5, 0x74, 0x32, 0xcc,
-  0x46, 0x40, 0x61, 0x8c, 0x6c, 0x71, 0xc3, 0x85, 0x84, 0x32, 0xe1, 0x7a,
-  0x9e, 0x19, 0x0c, 0x1b, 0x87, 0x78, 0x2c, 0x44, 0x90, 0x4e, 0x84, 0x66,
-  0x6a, 0x75, 0x02, 0x43, 0x5f, 0x9c, 0xee, 0x41, 0x88, 0xba, 0x76, 0x53,
-  0x2a, 0x88, 0x93, 0x4b, 0x7b, 0x5e, 0x58, 0x39, 0xb4, 0x01, 0x88, 0xd8,
-  0x07, 0x80, 0x89, 0x12, 0x8d, 0x04, 0x54, 0x5b, 0x24, 0x12, 0x23, 0x1f,
-  0x66, 0x09, 0xd1, 0x3d, 0xef, 0x35, 0x41, 0x11, 0x84, 0x59, 0x6e, 0x82,
-  0xc7, 0xa1, 0xc2, 0x20, 0x4f, 0xc4, 0x70, 0x11, 0x25, 0xb8, 0xb2, 0x6c,
-  0x37, 0x92, 0xd9, 0x53, 0x8c, 0x4b, 0xe5, 0x03, 0xbd, 0xde, 0x6c, 0xac,
-  0x25, 0x6f, 0xd4, 0x58, 0x49, 0x2c, 0x51, 0xa5, 0x81, 0x31, 0xd8, 0xac,
-  0x87, 0x1c, 0x1c, 0x58, 0xd3, 0x8c, 0xad, 0x1d, 0x74, 0x24, 0xd2, 0x6a,
-  0xfe, 0x08, 0x49, 0xec, 0x15, 0x19, 0x39, 0x62, 0xea, 0x9e, 0x76, 0x20,
-  0xc1, 0xa6, 0xd5, 0x6a, 0x01, 0x83, 0x04, 0x15, 0x20, 0x1c, 0xd5, 0x44,
-  0x81, 0x13, 0x2a, 0x90, 0x6d, 0x38, 0xb1, 0x20, 0x40, 0xc9, 0x95, 0x61,
-  0x80, 0x34, 0x8d, 0x90, 0xa5, 0xab, 0x4f, 0x01, 0x54, 0x5c, 0xb6, 0x84,
-  0x8c, 0xb4, 0x55, 0x8c, 0x7d, 0xe4, 0x48, 0xaa, 0x21, 0x47, 0x23, 0x04,
-  0x13, 0xd8, 0x22, 0x0c, 0xad, 0xc0, 0x10, 0xb2, 0x2e, 0x56, 0x31, 0x4f,
-  0x26, 0xf3, 0xa4, 0x71, 0xdb, 0x17, 0xe6, 0xe6, 0x72, 0x3e, 0x77, 0xea,
-  0xe4, 0x76, 0x37, 0x43, 0x89, 0x44, 0x1c, 0xfb, 0xa8, 0x91, 0xc3, 0x11,
-  0x46, 0xe0, 0x2c, 0x60, 0xa6, 0x7a, 0x40, 0x74, 0xe2, 0xfe, 0x11, 0x90,
-  0xce, 0xc1, 0xec, 0x53, 0x5a, 0xab, 0x0c, 0xee, 0xea, 0x09, 0xc2, 0x60,
-  0xff, 0x57, 0x42, 0x80, 0x90, 0xfd, 0x1c, 0xa5, 0xfe, 0x26, 0x0b, 0x92,
-  0x61, 0xb7, 0x1c, 0x62, 0x88, 0xfe, 0x2b, 0xbe, 0x02, 0x51, 0x87, 0x6c,
-  0xf0, 0x2c, 0xf2, 0x86, 0x89, 0xd6, 0xd1, 0x26, 0xe2, 0x07, 0xd6, 0x18,
-  0x9c, 0x68, 0x1d, 0x52, 0x63, 0x83, 0x2c, 0x82, 0x05, 0x2b, 0xb4, 0x0a,
-  0x41, 0x24, 0xcf, 0x83, 0x1e, 0x08, 0x56, 0x56, 0x47, 0xd5, 0xa4, 0x00,
-  0xfb, 0x89, 0x90, 0x0f, 0x9d, 0xeb, 0xcd, 0x21, 0xfa, 0xbb, 0xd4, 0x8b,
-  0x00, 0x48, 0xfd, 0x1c, 0x7e, 0x81, 0x72, 0x67, 0x1c, 0x5e, 0x80, 0x20,
-  0xf5, 0x3d, 0x55, 0x93, 0x4f, 0x3c, 0x2e, 0x75, 0x37, 0x81, 0xb2, 0x25,
-  0x16, 0x60, 0x0a, 0x43, 0x7c, 0x78, 0x2d, 0x08, 0x15, 0x4e, 0x22, 0x9f,
-  0xc2, 0x95, 0x5d, 0xfa, 0x10, 0x58, 0x29, 0x53, 0x0c, 0x05, 0x56, 0x77,
-  0x15, 0x82, 0x27, 0x05, 0x06, 0x25, 0xcd, 0xc8, 0x04, 0x3b, 0x42, 0xc1,
-  0x80, 0x25, 0x30, 0xd8, 0x51, 0x64, 0x9a, 0x8a, 0x80, 0xd1, 0xad, 0x00,
-  0x91, 0xfe, 0x31, 0xac, 0x00, 0x90, 0xf6, 0xc8, 0x4d, 0x13, 0x36, 0x20,
-  0x4c, 0x1f, 0x01, 0x09, 0xde, 0x6f, 0x98, 0x18, 0xa0, 0x5e, 0x4e, 0xff,
-  0x80, 0xb0, 0xfe, 0x06, 0x6d, 0x43, 0xc1, 0x63, 0xff, 0x81, 0x87, 0xcd,
-  0xec, 0x1e, 0x67, 0x44, 0x64, 0x30, 0x3e, 0x78, 0xc8, 0x46, 0xca, 0x46,
-  0xec, 0x70, 0x51, 0x90, 0xa4, 0xad, 0x47, 0x9a, 0xc8, 0xca, 0x5a, 0x7e,
-  0x80, 0xc8, 0x26, 0x11, 0xf1, 0x6c, 0x60, 0x9b, 0xaf, 0xe8, 0x2e, 0x4c,
-  0xcd, 0x10, 0x91, 0xe8, 0xd9, 0x35, 0x16, 0x5b, 0xe8, 0xe0, 0x1e, 0x69,
-  0x5d, 0x0a, 0x05, 0x91, 0xe8, 0x85, 0x45, 0xb2, 0x9f, 0xc7, 0x10, 0x25,
-  0xe8, 0xe4, 0x2a, 0xfe, 0x9b, 0x28, 0xc3, 0xc7, 0x0a, 0xa8, 0x49, 0xf2,
-  0x67, 0x49, 0xb4, 0x20, 0x33, 0xd7, 0x0b, 0x2e, 0x06, 0x0c, 0x48, 0xb8,
-  0x7a, 0x81, 0x75, 0x27, 0xeb, 0x4b, 0x50, 0x09, 0x8e, 0x02, 0xf8, 0x2c,
-  0x4d, 0x23, 0xa8, 0x14, 0x15, 0xd3, 0xb3, 0x17, 0x44, 0x12, 0x51, 0x90,
-  0x11, 0xb4, 0x9d, 0x01, 0x65, 0x4c, 0x32, 0xaa, 0x30, 0xa3, 0x01, 0x21,
-  0xee, 0x28, 0xac, 0xfe, 0x0c, 0x15, 0x49, 0x5c, 0x08, 0x82, 0x59, 0x0f,
-  0xfc, 0x08, 0x47, 0xbe, 0xc1, 0x34, 0x14, 0x6a, 0x2f, 0x0e, 0xbc, 0x9a,
-  0x10, 0x69, 0x55, 0x04, 0x3f, 0xaa, 0xe9, 0x0a, 0x01, 0x60, 0xd8, 0xd8,
-  0x11, 0x6b, 0x5a, 0x8e, 0xfe, 0x06, 0xf9, 0x2a, 0x88, 0x51, 0x12, 0x12,
-  0x63, 0xd9, 0x0b, 0x1d, 0x88, 0x96, 0x65, 0xd1, 0x28, 0x96, 0x54, 0xfe,
-  0x6b, 0xd0, 0x1c, 0x66, 0x0a, 0xdd, 0xf8, 0x0f, 0x0b, 0xc4, 0x63, 0x14,
-  0x76, 0x2c, 0xbb, 0x98, 0x57, 0xbb, 0x0b, 0x45, 0xaf, 0x40, 0xc8, 0xd7,
-  0x30, 0xfc, 0xef, 0xa0, 0x21, 0x11, 0x34, 0x69, 0xfc, 0xd6, 0xb0, 0x44,
-  0x0c, 0x8b, 0x45, 0x63, 0xdc, 0xf8, 0x76, 0x0a, 0x80, 0x00, 0x08, 0x2e,
-  0x85, 0xce, 0x77, 0x7a, 0x96, 0xcc, 0x72, 0x3c, 0x37, 0x50, 0x61, 0x2f,
-  0x20, 0xa9, 0x6f, 0x99, 0x13, 0x80, 0xca, 0x0d, 0x6c, 0x5e, 0x19, 0x84,
-  0x44, 0xb2, 0x62, 0x30, 0x36, 0x29, 0x18, 0x16, 0x22, 0x59, 0x62, 0x17,
-  0x1b, 0x10, 0xf1, 0x3c, 0xff, 0xff, 0xed, 0x16, 0x5a, 0x19, 0x82, 0x92,
-  0x6a, 0xb4, 0x65, 0x99, 0xd5, 0x1a, 0xa0, 0x5e, 0x59, 0x8c, 0xe6, 0x0c,
-  0x7a, 0xa8, 0xa2, 0xc4, 0x76, 0x12, 0x98, 0x48, 0x10, 0x8a, 0xc0, 0x3a,
-  0x7b, 0xa7, 0x2b, 0x04, 0xba, 0xd8, 0xb7, 0x00, 0x2c, 0x40, 0xac, 0x23,
-  0x83, 0x0b, 0x27, 0x96, 0x82, 0x00, 0x09, 0xf7, 0x19, 0xf6, 0x6a, 0x0e,
-  0xb0, 0x45, 0x90, 0x00, 0xf5, 0xde, 0x71, 0x59, 0x25, 0x48, 0x7d, 0xce,
-  0x84, 0x00, 0x56, 0x27, 0x40, 0xaa, 0xc2, 0x0e, 0xea, 0xcf, 0xb3, 0x26,
-  0xc5, 0x74, 0x17, 0x83, 0xad, 0xf6, 0x14, 0x61, 0xb7, 0x6c, 0x2e, 0x24,
-  0x42, 0x09, 0xf5, 0x27, 0xeb, 0x9c, 0x26, 0x6f, 0x0f, 0x48, 0xcb, 0x99,
-  0x17, 0x22, 0xa9, 0x01, 0x72, 0x02, 0x51, 0x60, 0x65, 0x21, 0x14, 0x0d,
-  0x04, 0xe8, 0x89, 0x20, 0xcb, 0xaa, 0x50, 0x02, 0x16, 0x20, 0x41, 0xbd,
-  0x66, 0x0c, 0x0a, 0xa1, 0x1b, 0xe7, 0x2a, 0x81, 0x24, 0xc5, 0x2d, 0x82,
-  0x1b, 0x28, 0x89, 0x16, 0x35, 0x40, 0x97, 0x3d, 0x13, 0x66, 0x19, 0x2a,
-  0x32, 0xd8, 0x52, 0x08, 0x07, 0x0a, 0x6c, 0x68, 0x10, 0x11, 0xe8, 0x4c,
-  0x07, 0x8e, 0x49, 0xab, 0xb3, 0xe1, 0x56, 0xcc, 0x52, 0xb7, 0x13, 0x34,
-  0xfe, 0x4b, 0x98, 0x10, 0x20, 0xc2, 0x2a, 0x02, 0x62, 0x4d, 0xe2, 0x46,
-  0xf1, 0x44, 0x89, 0x8f, 0x02, 0x40, 0x55, 0x81, 0x9e, 0x88, 0xcc, 0x2a,
-  0x48, 0x8d, 0x18, 0x42, 0x40, 0xf2, 0x61, 0x02, 0x04, 0x84, 0x3e, 0x99,
-  0x24, 0x08, 0xc4, 0x00, 0x94, 0xe6, 0x78, 0x8e, 0x00, 0x2a, 0xf9, 0x9a,
-  0x2a, 0xe6, 0x24, 0x02, 0x32, 0x8a, 0x8c, 0x01, 0xb9, 0x12, 0xe7, 0x0e,
-  0x99, 0x08, 0x45, 0x33, 0x9e, 0x31, 0xb8, 0x10, 0x74, 0x53, 0x42, 0x99,
-  0xa1, 0x86, 0x0e, 0x85, 0x1d, 0xb7, 0x8c, 0x3b, 0xd8, 0x5a, 0x0b, 0x0c,
-  0x3a, 0x3a, 0x01, 0x22, 0xcb, 0x1c, 0x0d, 0x20, 0xf2, 0x2c, 0xcc, 0xd4,
-  0x7d, 0x11, 0x84, 0x7f, 0x68, 0x0c, 0x26, 0x6b, 0x21, 0x3f, 0x1b, 0x0d,
-  0x4a, 0x85, 0x00, 0x32, 0x03, 0xa4, 0xd0, 0x99, 0x10, 0x40, 0x24, 0xed,
-  0x28, 0x23, 0x94, 0x2c, 0x26, 0x4f, 0x02, 0xcb, 0xfb, 0x7b, 0xb1, 0x1b,
-  0xfc, 0x3b, 0x07, 0x75, 0x3b, 0x40, 0x20, 0x58, 0x0b, 0x1f, 0xd1, 0x1a,
-  0xfb, 0x00, 0xd4, 0xa5, 0x56, 0xd9, 0x48, 0x27, 0x1d, 0xa0, 0x17, 0x24,
-  0x32, 0x0d, 0xf1, 0x0c, 0xff, 0x40, 0x98, 0x3b, 0x32, 0x35, 0xac, 0x23,
-  0xa8, 0xd2, 0x10, 0x48, 0x46, 0x13, 0xee, 0x2f, 0xf0, 0x2f, 0xa1, 0x95,
-  0xee, 0xa1, 0x06, 0x9c, 0xa0, 0xd4, 0xcb, 0x5d, 0x4c, 0xe5, 0x0c, 0x5e,
-  0x83, 0x0c, 0xc8, 0x28, 0x12, 0x7d, 0x1b, 0x4c, 0x10, 0x31, 0x25, 0x5a,
-  0x6c, 0x16, 0xac, 0x4e, 0x5a, 0x2c, 0xc8, 0x1c, 0x36, 0xf0, 0x40, 0x6c,
-  0x32, 0xee, 0x80, 0xa7, 0x20, 0x83, 0x23, 0x97, 0x29, 0x17, 0x42, 0x48,
-  0x6e, 0xcd, 0xfc, 0x64, 0x20, 0x2c, 0xbd, 0x1d, 0x74, 0x0f, 0x92, 0x4a,
-  0x20, 0x30, 0x54, 0x67, 0xee, 0x92, 0xf0, 0x10, 0xec, 0xe8, 0x2b, 0x95,
-  0x20, 0x1c, 0xb0, 0x20, 0xad, 0x82, 0x97, 0x00, 0x93, 0x24, 0x66, 0x22,
-  0xac, 0xbd, 0xb6, 0x27, 0x5a, 0xb2, 0xbd, 0xdf, 0xbf, 0x5d, 0x60, 0x66,
-  0x58, 0x46, 0x38, 0xe0, 0x29, 0x4c, 0xe3, 0x1c, 0x00, 0x05, 0x95, 0xff,
-  0xf6, 0x1e, 0xeb, 0xbe, 0x1b, 0x6c, 0x3d, 0x09, 0x8a, 0xa2, 0x24, 0x32,
-  0x06, 0x4e, 0x70, 0x58, 0xac, 0x22, 0x88, 0x60, 0xd6, 0x87, 0xcb, 0x15,
-  0x01, 0x83, 0x73, 0xdf, 0x22, 0x82, 0xf8, 0x8b, 0x05, 0xa2, 0x59, 0x52,
-  0xee, 0x08, 0x5b, 0x5a, 0xdc, 0x56, 0x8f, 0x62, 0x89, 0x4f, 0x01, 0x90,
-  0xc9, 0x25, 0x02, 0xbd, 0x07, 0xa5, 0x00, 0x81, 0x5e, 0x36, 0xe0, 0x23,
-  0xcb, 0xe2, 0xe0, 0x2c, 0xe2, 0xd0, 0x81, 0x08, 0xc3, 0x5a, 0x8a, 0x66,
-  0xaf, 0x1c, 0xcb, 0xdc, 0xde, 0x14, 0x78, 0xc3, 0xba, 0x40, 0xd8, 0x42,
-  0x36, 0x1f, 0xcf, 0x43, 0xfa, 0x21, 0x7e, 0x0e, 0x02, 0x57, 0x17, 0x43,
-  0xd5, 0x23, 0xff, 0x46, 0x69, 0x62, 0x70, 0xd3, 0x03, 0x7c, 0xa0, 0xf4,
-  0x12, 0x84, 0xd2, 0xf9, 0xc7, 0x04, 0xf4, 0x16, 0x31, 0x51, 0xc1, 0x51,
-  0x81, 0x60, 0xd6, 0xfd, 0xff, 0xea, 0xfe, 0xd2, 0x2d, 0xb2, 0x6b, 0xe0,
-  0x29, 0x6e, 0x1e, 0xcb, 0xfe, 0xb6, 0xab, 0xbd, 0x5b, 0x3b, 0x24, 0x14,
-  0x18, 0x36, 0x1b, 0xf1, 0x0c, 0x1e, 0xb9, 0x2a, 0x92, 0x2f, 0xbc, 0x92,
-  0xfe, 0xa0, 0x28, 0xbd, 0x8a, 0x00, 0xf3, 0xa4, 0xe2, 0xa0, 0x61, 0x50,
-  0x14, 0x91, 0x76, 0x8a, 0x24, 0xa6, 0x0d, 0x95, 0x4d, 0xf1, 0xe9, 0x48,
-  0xfe, 0x51, 0xaa, 0x51, 0x81, 0x72, 0x04, 0x25, 0x65, 0x8e, 0x11, 0x66,
-  0xfe, 0xca, 0x41, 0xb9, 0x06, 0x64, 0x03, 0x03, 0x14, 0x5e, 0x2a, 0xc0,
-  0x41, 0x27, 0xc4, 0xfd, 0xe8, 0xe9, 0xc1, 0xfd, 0x0a, 0xfa, 0xf8, 0x7f,
-  0x32, 0xc6, 0x54, 0x7b, 0x67, 0x8a, 0x23, 0x6e, 0x20, 0x99, 0xfd, 0x4a,
-  0xc5, 0x02, 0x8a, 0x07, 0x78, 0xa4, 0xfd, 0x18, 0x29, 0x6e, 0x1c, 0x5b,
-  0xfd, 0x90, 0x13, 0x8c, 0x35, 0xd9, 0xd1, 0x6e, 0x91, 0x3b, 0xfd, 0x12,
-  0xae, 0x05, 0x94, 0xc5, 0x7f, 0xfe, 0xfc, 0xe9, 0xfb, 0xfc, 0x62, 0x3f,
-  0xcc, 0x64, 0x55, 0x60, 0x7d, 0xb2, 0x52, 0x9c, 0x5b, 0x03, 0x81, 0x1c,
-  0xab, 0xb8, 0xa8, 0xfc, 0x02, 0xb0, 0xc4, 0x3c, 0x8d, 0x02, 0x7b, 0x65,
-  0xcd, 0x3b, 0x8d, 0x6d, 0xea, 0xd2, 0xc2, 0x9c, 0x11, 0x50, 0xb9, 0xc0,
-  0x6d, 0xfc, 0x2b, 0x08, 0xd7, 0x15, 0xdb, 0x2e, 0x7c, 0x2b, 0x65, 0x41,
-  0x61, 0xd7, 0x08, 0x30, 0x40, 0x1a, 0x38, 0x14, 0x12, 0x51, 0x65, 0x47,
-  0x7b, 0x15, 0x03, 0xc4, 0xd9, 0xa4, 0xe8, 0xc8, 0xfb, 0xc2, 0x42, 0x54,
-  0x19, 0xb1, 0x8a, 0x8c, 0x25, 0x19, 0xf6, 0x00, 0x72, 0x95, 0xfb, 0x0c,
-  0xf8, 0x8c, 0xf6, 0xf2, 0xb2, 0x01, 0xe4, 0x68, 0xfb, 0x39, 0xb2, 0x03,
-  0x90, 0xb2, 0x0f, 0x39, 0xfb, 0x05, 0x98, 0xf3, 0xa8, 0xc8, 0x25, 0x99,
-  0xd2, 0x02, 0x68, 0xfb, 0x74, 0x17, 0x60, 0x36, 0x68, 0x59, 0x51, 0x0e,
-  0x34, 0x25, 0x2f, 0xe5, 0x4e, 0x18, 0xa0, 0x41, 0x40, 0xe3, 0x90, 0x58,
-  0xb4, 0x48, 0xbd, 0xbc, 0x06, 0xd6, 0x41, 0x89, 0x77, 0x10, 0x2a, 0x95,
-  0x0c, 0xd7, 0x20, 0x64, 0xcd, 0x1c, 0x74, 0x06, 0x17, 0x8d, 0x50, 0x75,
-  0x55, 0x9a, 0x53, 0x02, 0x75, 0xa4, 0x15, 0xe0, 0x46, 0xa2, 0xf9, 0x3f,
-  0x3b, 0x1a, 0x34, 0xa1, 0xe9, 0x01, 0x18, 0xcd, 0x6c, 0x6d, 0x01, 0x19,
-  0xcf, 0x7d, 0x60, 0xeb, 0x90, 0x9a, 0x1f, 0x08, 0x40, 0xbb, 0xde, 0x60,
-  0x21, 0x11, 0x29, 0x82, 0x34, 0xc6, 0x7d, 0x74, 0x20, 0x4c, 0x53, 0x78,
-  0x24, 0x47, 0x1b, 0x73, 0x01, 0x05, 0x98, 0x81, 0x00, 0x92, 0xbf, 0xba,
-  0xa0, 0x24, 0x5b, 0x85, 0x16, 0x06, 0x58, 0x18, 0x10, 0x20, 0x35, 0x57,
-  0xb6, 0x25, 0x13, 0x12, 0x64, 0x86, 0x7b, 0xeb, 0x67, 0xe3, 0x0e, 0x47,
-  0x4e, 0x40, 0x70, 0xb2, 0x41, 0x39, 0x15, 0x38, 0x05, 0xbe, 0x29, 0xc7,
-  0xec, 0xf6, 0x61, 0x25, 0x50, 0x58, 0x7a, 0x82, 0x05, 0xf8, 0xa2, 0xc6,
-  0xcb, 0xf7, 0x46, 0x66, 0x58, 0xa0, 0x30, 0x6b, 0xd1, 0xd2, 0x6f, 0xf8,
-  0xe5, 0x74, 0x18, 0x90, 0x54, 0xa5, 0x16, 0x44, 0x58, 0xab, 0x82, 0xd1,
-  0x90, 0x56, 0x2a, 0x4e, 0xed, 0x12, 0x8d, 0x62, 0x90, 0x14, 0x35, 0x20,
-  0xbe, 0x69, 0x1b, 0x35, 0x16, 0x72, 0x21, 0x01, 0xd4, 0x20, 0x02, 0x84,
-  0x99, 0x2c, 0x40, 0x8c, 0xd1, 0x00, 0x98, 0x24, 0x89, 0x25, 0x00, 0x60,
-  0x09, 0x48, 0xbe, 0x4b, 0xf6, 0x0b, 0xd1, 0x03, 0x46, 0x24, 0x13, 0xe8,
-  0xa7, 0x01, 0x72, 0x41, 0x59, 0x43, 0x88, 0x32, 0x3b, 0xd5, 0x58, 0xc1,
-  0x82, 0x92, 0xbc, 0xb9, 0x8c, 0x06, 0xdc, 0x28, 0x9c, 0x43, 0x40, 0x43,
-  0xda, 0x44, 0x7a, 0x18, 0xc3, 0x03, 0x88, 0x22, 0xb2, 0x46, 0x98, 0x10,
-  0x83, 0x19, 0x03, 0x40, 0xa0, 0x00, 0xd9, 0x40, 0xf4, 0xb6, 0xf2, 0x2f,
-  0x17, 0x6b, 0x55, 0x0d, 0x9a, 0x0d, 0xca, 0x55, 0x5b, 0x57, 0xc0, 0x61,
-  0x3f, 0x20, 0x03, 0x19, 0x24, 0x3f, 0x0b, 0x03, 0x17, 0x26, 0xb5, 0x13,
-  0x0c, 0x4a, 0x25, 0xdb, 0x4c, 0xa3, 0x53, 0x44, 0x40, 0x85, 0x41, 0x88,
-  0x48, 0xa9, 0x9e, 0x76, 0xa1, 0xf2, 0x8e, 0x98, 0x97, 0xf4, 0x13, 0xa1,
-  0x6d, 0x04, 0x8b, 0xc2, 0x40, 0x1b, 0x5c, 0x20, 0x77, 0x37, 0x76, 0x19,
-  0x1e, 0xb4, 0xb8, 0x0f, 0x25, 0x58, 0x60, 0x8f, 0xf0, 0x09, 0x55, 0x6c,
-  0xc6, 0xb0, 0x81, 0x57, 0x85, 0x35, 0x64, 0xa1, 0x08, 0xf1, 0x83, 0x58,
-  0x53, 0x05, 0xc2, 0xee, 0xeb, 0x42, 0x3d, 0x61, 0x96, 0x0d, 0xa2, 0x10,
-  0xe6, 0x38, 0x4a, 0xac, 0x4d, 0x89, 0x90, 0xb2, 0xb4, 0xa0, 0x81, 0xb2,
-  0xcd, 0x1c, 0xeb, 0x1a, 0x56, 0x12, 0x47, 0x72, 0x88, 0xab, 0xee, 0x67,
-  0xf4, 0x72, 0xa4, 0x61, 0x01, 0x9a, 0x2e, 0x5b, 0xcb, 0x45, 0x69, 0x20,
-  0xd4, 0x47, 0xc0, 0xb2, 0x6a, 0x1b, 0x26, 0xb6, 0xc6, 0xd8, 0x1b, 0x64,
-  0x2b, 0x93, 0xb0, 0xa0, 0xa9, 0x0c, 0xec, 0x0b, 0x56, 0x23, 0xc8, 0xf2,
-  0xcd, 0xf4, 0xeb, 0x82, 0x2c, 0xa2, 0xc9, 0x64, 0x05, 0x18, 0x95, 0x71,
-  0xfe, 0x54, 0x97, 0x86, 0x31, 0x08, 0xdc, 0x0d, 0x25, 0x9a, 0x87, 0xa2,
-  0xe9, 0x38, 0xc9, 0x1b, 0xc2, 0xf3, 0x23, 0x40, 0x81, 0xde, 0x5a, 0x14,
-  0x57, 0x02, 0x23, 0x28, 0x0b, 0xaf, 0x30, 0x9c, 0x74, 0x4c, 0x90, 0x6f,
-  0x83, 0x84, 0x4a, 0x76, 0x01, 0x90, 0x0a, 0xba, 0x24, 0x22, 0x41, 0xb3,
-  0x11, 0xf9, 0xde, 0xae, 0x72, 0xba, 0x02, 0x73, 0xa6, 0x42, 0xf2, 0xc2,
-  0x1b, 0x12, 0x13, 0xf7, 0x65, 0x88, 0x57, 0x0e, 0x20, 0x43, 0x0e, 0x21,
-  0x0d, 0x0c, 0x85, 0xa3, 0x84, 0x3f, 0x2b, 0x40, 0xd2, 0x14, 0x70, 0x5c,
-  0x4f, 0x06, 0xb5, 0xc8, 0xfc, 0x53, 0xd1, 0x14, 0x90, 0xd8, 0xc1, 0x17,
-  0x15, 0x81, 0x75, 0x60, 0x32, 0x80, 0x11, 0xb2, 0x4b, 0xa6, 0x76, 0x9f,
-  0xa6, 0x43, 0x0e, 0x20, 0x53, 0x72, 0x48, 0x54, 0x4c, 0x4f, 0x91, 0x72,
-  0xcf, 0x47, 0x31, 0x00, 0x56, 0xbf, 0x05, 0x8c, 0xf4, 0xad, 0x95, 0xa8,
-  0x8a, 0x95, 0x85, 0x02, 0x12, 0xe8, 0x8b, 0xde, 0x05, 0xd7, 0xf8, 0xe3,
-  0x83, 0xbf, 0xd4, 0x6d, 0x29, 0xf6, 0xaa, 0x9e, 0x23, 0x5b, 0x64, 0x44,
-  0xd9, 0x19, 0xff, 0x89, 0x87, 0xe2, 0x6d, 0x89, 0x97, 0xe4, 0xb5, 0x6d,
-  0x0d, 0xb3, 0x0b, 0x8b, 0x65, 0x0b, 0x87, 0x11, 0x92, 0x87, 0xc1, 0x22,
-  0xb1, 0xd6, 0x1e, 0xda, 0xc7, 0x87, 0x44, 0xe6, 0x5d, 0x09, 0x34, 0xd8,
-  0x4a, 0xa8, 0xd9, 0x05, 0xda, 0x99, 0x0f, 0xc8, 0xde, 0xc9, 0xe0, 0xa0,
-  0x2a, 0x43, 0x95, 0xb7, 0xce, 0x5a, 0x87, 0xd0, 0xb3, 0x6d, 0x31, 0x91,
-  0xe6, 0x92, 0xe8, 0x76, 0xea, 0x6d, 0xe4, 0xb6, 0x05, 0xec, 0x65, 0xbd,
-  0xbf, 0xd3, 0xe0, 0x05, 0xbe, 0x2a, 0x8c, 0xda, 0xeb, 0x0d, 0x0a, 0x8b,
-  0x15, 0xa8, 0x7d, 0x8b, 0x54, 0x95, 0x59, 0x76, 0x28, 0x0a, 0x10, 0x6f,
-  0xe0, 0x22, 0x29, 0x8c, 0x97, 0x32, 0x45, 0x16, 0x54, 0x7c, 0xca, 0x16,
-  0xb0, 0x14, 0x56, 0x71, 0x6f, 0x22, 0x15, 0x51, 0xe2, 0xc4, 0x8c, 0xdb,
-  0x8c, 0x07, 0x7a, 0xa0, 0x92, 0x33, 0x9a, 0xab, 0x29, 0xed, 0x31, 0x50,
-  0x9e, 0xc8, 0x2d, 0x04, 0x20, 0xe0, 0x62, 0x06, 0x8c, 0x23, 0x82, 0x0b,
-  0x04, 0x2c, 0x4a, 0x78, 0x20, 0x41, 0x76, 0x6a, 0xdd, 0x2f, 0xd3, 0x72,
-  0xdb, 0x00, 0x1b, 0xf3, 0x59, 0x3b, 0x6e, 0xe7, 0x75, 0x54, 0x33, 0x79,
-  0x7e, 0x1b, 0xff, 0xb7, 0x15, 0x03, 0xa1, 0x03, 0x0d, 0x54, 0x49, 0xd9,
-  0xb3, 0x18, 0x7b, 0x41, 0x1a, 0x2c, 0x01, 0x02, 0x9f, 0x41, 0xed, 0xc4,
-  0x7e, 0x7e, 0xfc, 0x01, 0x0d, 0x26, 0x11, 0x5d, 0x02, 0x3e, 0x0a, 0x7c,
-  0x83, 0x82, 0xb0, 0xe2, 0xb0, 0x11, 0x83, 0xc7, 0x75, 0xa2, 0x20, 0xa4,
-  0xcd, 0x23, 0xfc, 0x8a, 0x0a, 0xdd, 0x18, 0xe9, 0xef, 0x44, 0x4c, 0x50,
-  0x1a, 0xe9, 0x52, 0x28, 0x40, 0xe9, 0xc3, 0x05, 0x8a, 0x03, 0x4e, 0x31,
-  0x05, 0x35, 0xec, 0x3b, 0x54, 0xf8, 0x47, 0xd2, 0x00, 0x39, 0x9c, 0xc2,
-  0x07, 0x55, 0x7b, 0x40, 0x62, 0x7c, 0xc2, 0x38, 0xdc, 0xab, 0xdc, 0x11,
-  0xdb, 0xb9, 0xa2, 0x09, 0x9e, 0x85, 0x41, 0x62, 0x1d, 0x2c, 0x85, 0xd1,
-  0x07, 0x0f, 0x66, 0x3e, 0x75, 0xd9, 0x77, 0x37, 0x88, 0x2c, 0x3b, 0xad,
-  0x8f, 0x6e, 0x57, 0x14, 0x03, 0x87, 0xd0, 0xb2, 0x41, 0x65, 0x55, 0xc1,
-  0x00, 0x04, 0xad, 0x80, 0x36, 0x90, 0xf8, 0x8b, 0x66, 0x79, 0xaa, 0x90,
-  0x39, 0x45, 0x2e, 0x99, 0x03, 0x46, 0xf4, 0x41, 0x15, 0x86, 0x34, 0x82,
-  0xb1, 0xa8, 0xd8, 0xe9, 0xf5, 0xe4, 0xaa, 0x09, 0xed, 0xec, 0x40, 0x5a,
-  0x11, 0x86, 0x30, 0xd9, 0xfa, 0x4f, 0xb1, 0x5f, 0x18, 0x45, 0x6e, 0x64,
-  0x00, 0x44, 0x4c, 0x25, 0x37, 0x8b, 0xc1, 0x26, 0x66, 0xf5, 0x40, 0x44,
-  0x38, 0x26, 0x02, 0x84, 0x74, 0xd9, 0x2e, 0x36, 0x05, 0x07, 0xef, 0x83,
-  0xd2, 0x9e, 0x15, 0xbe, 0xb2, 0x12, 0x77, 0x42, 0x75, 0xef, 0x07, 0x47,
-  0x10, 0x77, 0x3a, 0x60, 0x66, 0xbd, 0x17, 0x82, 0x69, 0xc8, 0x38, 0xd9,
-  0x67, 0x39, 0x4b, 0x0d, 0x0e, 0x1e, 0x07, 0x46, 0x70, 0x1f, 0xa2, 0x76,
-  0xb0, 0x39, 0x58, 0x09, 0x67, 0x05, 0x51, 0x80, 0xd2, 0xc1, 0x18, 0x07,
-  0x54, 0x04, 0xf2, 0x23, 0x00, 0x15, 0x98, 0x4a, 0xc2, 0x25, 0x27, 0x4b,
-  0x0d, 0x34, 0xe9, 0x81, 0x5c, 0xcc, 0x83, 0xc4, 0x18, 0x1f, 0x44, 0xcf,
-  0x72, 0x73, 0x38, 0x4a, 0xe2, 0x30, 0x16, 0xcc, 0x46, 0x33, 0x1f, 0x61,
-  0x36, 0x16, 0x30, 0x1f, 0x21, 0x92, 0xfb, 0x8a, 0x99, 0xe7, 0x0b, 0x07,
-  0x19, 0xc8, 0xe0, 0x1c, 0x75, 0xba, 0xcf, 0x00, 0xce, 0xda, 0xec, 0x60,
-  0x2a, 0x9a, 0xae, 0x3d, 0x9a, 0x0b, 0x06, 0x1e, 0x8a, 0xbe, 0xcd, 0x2b,
-  0x81, 0x1d, 0xd5, 0x76, 0x36, 0xcc, 0x72, 0x08, 0x87, 0x04, 0x6d, 0x09,
-  0x93, 0x93, 0x1f, 0xda, 0x30, 0x36, 0x1a, 0xeb, 0x22, 0x04, 0x75, 0xc1,
-  0x16, 0xb4, 0x41, 0xc4, 0x22, 0x54, 0xb8, 0x38, 0x6f, 0x50, 0x22, 0xc8,
-  0xb3, 0x14, 0x23, 0x80, 0x43, 0xea, 0xa1, 0x10, 0x6f, 0x56, 0x48, 0x29,
-  0x89, 0x40, 0x31, 0x12, 0x59, 0x74, 0x10, 0x9b, 0x18, 0xa5, 0xe7, 0x95,
-  0xb2, 0x90, 0x0f, 0xe7, 0x08, 0x47, 0x34, 0x83, 0x4a, 0x06, 0x18, 0x80,
-  0xa4, 0x0a, 0xb1, 0xce, 0x4d, 0x68, 0x82, 0x52, 0x89, 0x16, 0x00, 0x54,
-  0x20, 0x15, 0xa0, 0x68, 0x5a, 0xe4, 0xa2, 0x33, 0x48, 0x19, 0x36, 0x8a,
-  0x31, 0x8d, 0x46, 0x3e, 0x5f, 0xe9, 0x07, 0x03, 0x0d, 0x3e, 0xea, 0x90,
-  0x02, 0xbb, 0xd9, 0x0f, 0x82, 0x20, 0x47, 0xc5, 0xce, 0x02, 0x75, 0xab,
-  0xa5, 0x99, 0x2d, 0x89, 0x60, 0xa6, 0xd8, 0x0a, 0x24, 0xed, 0x30, 0xa8,
-  0x02, 0x80, 0x68, 0xc2, 0xde, 0x3b, 0x03, 0x5e, 0x40, 0x26, 0x26, 0x12,
-  0x3b, 0x14, 0x64, 0x3d, 0x38, 0x9d, 0x02, 0x4c, 0x3e, 0x13, 0x96, 0xa0,
-  0x10, 0x85, 0x86, 0xd7, 0xd9, 0xc1, 0xea, 0x60, 0xe8, 0x8c, 0x5f, 0x42,
-  0x47, 0x4c, 0xe8, 0xa0, 0x28, 0xc1, 0xd0, 0xb3, 0x10, 0x20, 0x0f, 0x37,
-  0x89, 0x3d, 0x84, 0x92, 0x0f, 0x9b, 0xea, 0x06, 0x02, 0x74, 0xbc, 0x74,
-  0xb9, 0xfe, 0x01, 0xc4, 0xf3, 0xfe, 0xdc, 0x29, 0x2a, 0x25, 0x45, 0x6c,
-  0xc7, 0x73, 0xe8, 0x84, 0x17, 0x9a, 0x2e, 0x25, 0xa3, 0x66, 0x1f, 0x10,
-  0xfe, 0x3c, 0x1c, 0x04, 0x42, 0x8d, 0x4e, 0x44, 0xff, 0x0a, 0x30, 0xd9,
-  0xf4, 0x39, 0xff, 0x56, 0x0c, 0x13, 0x63, 0xa2, 0xfd, 0x23, 0xd3, 0xd0,
-  0x43, 0xe8, 0x42, 0xbb, 0xce, 0x1f, 0xe2, 0x72, 0x1f, 0x07, 0x62, 0xf1,
-  0xe0, 0x72, 0x18, 0x46, 0x6d, 0x29, 0xc2, 0x65, 0x0e, 0xaa, 0x10, 0x9b,
-  0x1f, 0x98, 0x75, 0x37, 0x77, 0x91, 0x83, 0x40, 0x7e, 0xb1, 0xed, 0xfe,
-  0x83, 0x98, 0x3b, 0x17, 0xaa, 0x36, 0x3f, 0x62, 0xd9, 0x7f, 0xd8, 0x82,
-  0x56, 0x80, 0x15, 0xe9, 0x02, 0x89, 0x61, 0x53, 0x0a, 0xdb, 0x43, 0xa9,
-  0x84, 0xfe, 0x51, 0xa9, 0x6e, 0x24, 0x84, 0xfe, 0xc1, 0x5a, 0x0d, 0x49,
-  0xa3, 0x0a, 0x50, 0x28, 0x66, 0x3b, 0x35, 0x05, 0x8a, 0x12, 0x33, 0xc1,
-  0x0b, 0x1c, 0xfe, 0x44, 0x90, 0x09, 0x38, 0x30, 0xfe, 0x4d, 0xf1, 0x40,
-  0x61, 0xbf, 0x5b, 0x24, 0x68, 0x0b, 0x84, 0xb9, 0xd4, 0x06, 0xc0, 0x14,
-  0xa0, 0x59, 0x4b, 0xe6, 0x6a, 0xdc, 0x03, 0x84, 0x22, 0xf4, 0xc2, 0xfd,
-  0x90, 0xcb, 0x80, 0xd9, 0xa0, 0x26, 0x18, 0x1f, 0x42, 0x3c, 0xe6, 0xea,
-  0x6e, 0x23, 0xeb, 0x09, 0x90, 0x48, 0x71, 0x0e, 0xfd, 0x00, 0x60, 0xae,
-  0xa9, 0x25, 0x23, 0x50, 0x4d, 0xef, 0xeb, 0x90, 0xfc, 0x71, 0xe1, 0xfc,
-  0x61, 0xb3, 0x74, 0x18, 0x54, 0x80, 0xd2, 0x81, 0xbd, 0x85, 0x00, 0xbc,
-  0x16, 0x12, 0x72, 0x56, 0xfd, 0x10, 0x76, 0x4e, 0x81, 0x1c, 0x89, 0x3f,
-  0x0e, 0x0c, 0x61, 0x16, 0x2f, 0x17, 0xc3, 0x89, 0x0f, 0x34, 0x0c, 0x7e,
-  0xfc, 0x63, 0x02, 0xc8, 0x53, 0xed, 0x89, 0x4b, 0x15, 0x4e, 0x3a, 0x2a,
-  0xb2, 0x4f, 0x42, 0x6a, 0x6a, 0x0b, 0x05, 0x0b, 0xd8, 0xc3, 0x8b, 0x0c,
-  0xa1, 0xf6, 0x21, 0x45, 0x20, 0x17, 0x58, 0x0a, 0x66, 0xcf, 0x16, 0x13,
-  0xad, 0x30, 0xaa, 0x84, 0x2a, 0x41, 0x96, 0xec, 0x13, 0xba, 0x65, 0xb7,
-  0xac, 0x56, 0x3c, 0x93, 0x12, 0x88, 0x48, 0xa0, 0x74, 0x42, 0xff, 0x25,
-  0x3c, 0xc9, 0x47, 0xd4, 0x40, 0x12, 0xf2, 0x12, 0xc8, 0x6e, 0x75, 0x05,
-  0x04, 0x50, 0x88, 0x17, 0x4d, 0xd4, 0x80, 0xde, 0xef, 0xe4, 0x14, 0x5f,
-  0xf6, 0x14, 0xe9, 0x58, 0x01, 0x3f, 0x1c, 0xfa, 0xb2, 0xf8, 0x15, 0x23,
-  0x12, 0x1b, 0xac, 0xd2, 0x43, 0xd1, 0x41, 0x46, 0x19, 0x25, 0x80, 0x80,
-  0xc4, 0x40, 0x01, 0x93, 0x62, 0xeb, 0x81, 0x61, 0x36, 0x25, 0xec, 0x43,
-  0xdf, 0x03, 0x61, 0x82, 0xbd, 0x7c, 0xd3, 0x2c, 0x04, 0xb2, 0x70, 0x0e,
-  0x3b, 0x69, 0xfc, 0x94, 0x46, 0x8f, 0x0b, 0x39, 0x30, 0x10, 0x19, 0xab,
-  0x68, 0x37, 0x3f, 0x77, 0x89, 0x0c, 0x1f, 0xdd, 0x1f, 0x77, 0x82, 0x84,
-  0x1c, 0x80, 0x80, 0xce, 0xaa, 0x60, 0xc2, 0x92, 0x25, 0x96, 0x3b, 0x19,
-  0x09, 0x80, 0x9f, 0x1d, 0x9b, 0x41, 0x70, 0x59, 0xc8, 0xc0, 0xb9, 0x0d,
-  0x04, 0x7e, 0x8e, 0x4c, 0x02, 0x32, 0x77, 0xb1, 0x18, 0xc4, 0x4d, 0xda,
-  0x58, 0x6e, 0x52, 0x10, 0xb7, 0xc6, 0x77, 0x52, 0xf1, 0x16, 0x84, 0x77,
-  0xcb, 0xfa, 0xf8, 0x27, 0xf4, 0x2c, 0xf6, 0x84, 0x5c, 0x59, 0x93, 0xf6,
-  0x2c, 0x72, 0xd9, 0xf4, 0x73, 0x21, 0x66, 0x6e, 0x32, 0x77, 0xaf, 0x4f,
-  0x13, 0x24, 0x68, 0x3d, 0x17, 0x85, 0x3f, 0x18, 0xc6, 0x77, 0xc3, 0x69,
-  0xf4, 0x19, 0xf6, 0x64, 0xf4, 0x39, 0xf0, 0xe4, 0xf2, 0x22, 0x5e, 0x7c,
-  0x10, 0xd7, 0x59, 0x70, 0x13, 0x52, 0x18, 0xe8, 0x2a, 0x09, 0x33, 0x05,
-  0x98, 0x39, 0xc2, 0x77, 0x64, 0xf2, 0xe7, 0xf0, 0x78, 0x1c, 0xc8, 0x77,
-  0x8d, 0x90, 0x3b, 0x8f, 0x77, 0x65, 0x9f, 0x5c, 0xb2, 0x61, 0x77, 0x34,
-  0x1c, 0x04, 0x9a, 0x81, 0xc0, 0xca, 0x31, 0xfa, 0x76, 0x18, 0x02, 0xc0,
-  0xcd, 0x95, 0x51, 0x92, 0x15, 0xcc, 0x65, 0x00, 0x47, 0xc7, 0x80, 0xcd,
-  0x8e, 0x95, 0x17, 0x80, 0xc8, 0x8b, 0x11, 0x01, 0x8b, 0x7e, 0x33, 0x36,
-  0xcb, 0x6c, 0x46, 0x25, 0x9b, 0x12, 0x41, 0x22, 0x65, 0x2b, 0x94, 0x1b,
-  0x09, 0x29, 0x82, 0xbd, 0xb2, 0x14, 0xe2, 0x12, 0x00, 0xd0, 0x06, 0x02,
-  0xab, 0x58, 0xb2, 0x45, 0x94, 0x10, 0x5c, 0xf8, 0x2c, 0x9f, 0xc5, 0xdb,
-  0x50, 0x16, 0xff, 0x2a, 0x04, 0x7b, 0xee, 0x30, 0x31, 0x61, 0x50, 0x3b,
-  0xf6, 0xfe, 0x2a, 0x04, 0x1d, 0x82, 0xfe, 0x60, 0x25, 0x62, 0xdc, 0x50,
-  0x12, 0xf5, 0xf2, 0xf0, 0x28, 0x91, 0xae, 0xaa, 0xc9, 0x04, 0x3e, 0xd8,
-  0x4d, 0x4f, 0x07, 0x12, 0xdd, 0x24, 0xe8, 0xa8, 0xfe, 0x0c, 0xe7, 0x45,
-  0x16, 0x3c, 0x68, 0x70, 0x0b, 0x70, 0x5a, 0xa0, 0xee, 0x82, 0x0c, 0xeb,
-  0x49, 0x24, 0x17, 0xd4, 0x52, 0x8b, 0x42, 0x30, 0x02, 0xb0, 0x13, 0x23,
-  0x30, 0x5d, 0xc5, 0x9b, 0x71, 0x63, 0x29, 0xd9, 0x44, 0xfe, 0x58, 0xa2,
-  0x45, 0xa2, 0x16, 0x32, 0xc8, 0x01, 0x8a, 0x2b, 0x1b, 0x2c, 0x4b, 0x93,
-  0xea, 0xcf, 0x72, 0x18, 0xe8, 0xd8, 0x76, 0x11, 0x88, 0x1c, 0x1c, 0xd1,
-  0x1e, 0xb4, 0xbc, 0xec, 0x05, 0x2c, 0xd5, 0xee, 0x98, 0x28, 0x31, 0xb0,
-  0xc8, 0xaf, 0xfe, 0x31, 0xa5, 0x55, 0x21, 0xf1, 0x6a, 0x23, 0xf6, 0x28,
-  0xd0, 0x45, 0x78, 0x5a, 0xbd, 0xc3, 0x00, 0x19, 0x09, 0x17, 0xd8, 0x45,
-  0x98, 0x58, 0xb2, 0xf8, 0x97, 0x34, 0x80, 0x2c, 0x11, 0x21, 0x8a, 0xa3,
-  0x40, 0x36, 0xc0, 0x00, 0x80, 0xa7, 0xa0, 0x8e, 0x0c, 0x9a, 0x83, 0x0f,
-  0x08, 0xb1, 0x2b, 0x85, 0x03, 0x77, 0xf8, 0x13, 0x56, 0x10, 0xe9, 0x8d,
-  0x0a, 0x90, 0xc7, 0x18, 0x69, 0xc0, 0xae, 0xd3, 0x2c, 0xab, 0x49, 0x08,
-  0x64, 0x26, 0x85, 0x80, 0x30, 0xb2, 0xc2, 0xc1, 0x49, 0xd5, 0xd4, 0x2d,
-  0x92, 0x06, 0x88, 0xbd, 0xfa, 0x44, 0x64, 0xb8, 0x72, 0x8c, 0x31, 0x85,
-  0x15, 0x8a, 0xf1, 0xab, 0x82, 0x2d, 0x09, 0xc1, 0x0b, 0x80, 0x2d, 0x04,
-  0x52, 0x52, 0x61, 0x68, 0x2a, 0x54, 0xe2, 0x8e, 0x0f, 0x39, 0x11, 0x49,
-  0xbb, 0x8b, 0x49, 0x34, 0x96, 0x67, 0x10, 0x83, 0x01, 0x82, 0x96, 0x87,
-  0x0f, 0xf4, 0x01, 0xba, 0x00, 0x02, 0x10, 0x33, 0x10, 0x76, 0x55, 0x03,
-  0x6d, 0x47, 0x17, 0x27, 0x25, 0x85, 0x1f, 0x8c, 0x12, 0xb3, 0x1e, 0x1e,
-  0xb4, 0x05, 0x47, 0x50, 0x1b, 0xa4, 0x56, 0x65, 0x0d, 0xa8, 0x89, 0xce,
-  0x30, 0x48, 0x25, 0x36, 0x01, 0x0a, 0xdb, 0x29, 0x2c, 0x83, 0xe2, 0x5e,
-  0x14, 0x00, 0x40, 0xe4, 0x61, 0x3b, 0x0a, 0x0d, 0x9b, 0x2b, 0x87, 0x20,
-  0xc6, 0x64, 0xd0, 0x0d, 0x01, 0xb6, 0x9c, 0x16, 0x84, 0x89, 0xbe, 0x0d,
-  0xb2, 0xd6, 0x14, 0xc8, 0x12, 0x22, 0x79, 0xba, 0xb3, 0x3b, 0xac, 0x15,
-  0x9d, 0x81, 0x0d, 0x6e, 0x5e, 0x74, 0x47, 0x43, 0x65, 0xe5, 0x48, 0xf6,
-  0xcc, 0x37, 0x63, 0x60, 0xd9, 0xbb, 0x18, 0xf0, 0xdc, 0x81, 0x94, 0x4c,
-  0xed, 0x90, 0x61, 0x8a, 0x2a, 0x19, 0xa0, 0x00, 0x64, 0x4f, 0xe6, 0x48,
-  0x66, 0xb5, 0x10, 0x82, 0x16, 0xc0, 0x5a, 0x40, 0x38, 0x04, 0x00, 0x4f,
-  0xfb, 0x2c, 0xd9, 0x01, 0x56, 0x45, 0x51, 0xe1, 0xfa, 0xfe, 0xeb, 0x02,
-  0x64, 0x3f, 0x37, 0x46, 0x84, 0xef, 0xd9, 0x47, 0x17, 0xb2, 0x84, 0xfe,
-  0xef, 0x8b, 0x93, 0xaf, 0x92, 0xa8, 0xe4, 0x70, 0x20, 0x64, 0x54, 0x36,
-  0xee, 0x0d, 0xb8, 0x85, 0xe8, 0x5d, 0x11, 0x61, 0xf5, 0x74, 0x20, 0x40,
-  0x3a, 0x4c, 0x0a, 0x12, 0x93, 0xb0, 0x10, 0x20, 0xf1, 0x30, 0xe8, 0x54,
-  0xd4, 0xc8, 0xea, 0x45, 0x32, 0x17, 0x12, 0xbd, 0xb1, 0x05, 0x90, 0xa2,
-  0xc4, 0x7d, 0xcf, 0x6a, 0x0f, 0x12, 0x6a, 0x42, 0x0a, 0xe0, 0xed, 0x52,
-  0xe9, 0x08, 0x80, 0x4b, 0xce, 0x61, 0x12, 0x22, 0x48, 0x60, 0xb4, 0x3a,
-  0xca, 0x0d, 0x63, 0x90, 0x3a, 0x18, 0x2c, 0x2c, 0x49, 0x0c, 0x1b, 0x0a,
-  0x77, 0xcf, 0x1b, 0x72, 0x73, 0x80, 0x14, 0x42, 0xb8, 0x41, 0x22, 0xc8,
-  0x83, 0x25, 0xe2, 0xc1, 0x20, 0xfb, 0x27, 0x28, 0x05, 0x65, 0xe8, 0xb2,
-  0x22, 0xcd, 0xc1, 0x51, 0x95, 0xc2, 0x86, 0x2b, 0xc1, 0x2f, 0xff, 0x98,
-  0x4f, 0x2a, 0x90, 0xe4, 0x38, 0x55, 0x2a, 0x93, 0x41, 0x03, 0x42, 0xb2,
-  0x40, 0xd5, 0x20, 0x86, 0x78, 0xf7, 0xfe, 0x82, 0xc8, 0x88, 0x60, 0x18,
-  0x48, 0x3e, 0xc4, 0x42, 0x6c, 0x70, 0x16, 0x55, 0x20, 0xec, 0x72, 0xa5,
-  0x70, 0x9d, 0x54, 0xf2, 0x85, 0x09, 0xc1, 0x01, 0x38, 0x6d, 0x91, 0x61,
-  0x96, 0xfa, 0xf8, 0x43, 0x06, 0xe0, 0x18, 0xa2, 0xd6, 0xef, 0x8d, 0x55,
-  0xc9, 0x69, 0x4d, 0x52, 0x94, 0x2f, 0xe0, 0xd8, 0x19, 0xaa, 0x74, 0xf1,
-  0x27, 0x32, 0x74, 0x82, 0x24, 0x01, 0x42, 0x01, 0x65, 0x25, 0x8b, 0x27,
-  0x76, 0xd5, 0xf8, 0x54, 0x1e, 0x14, 0xfe, 0xcc, 0x91, 0x54, 0x88, 0x65,
-  0x81, 0xcb, 0xc4, 0x59, 0x92, 0x0c, 0xea, 0xb3, 0x60, 0xca, 0xe8, 0x95,
-  0xa1, 0x86, 0x5c, 0x2c, 0x58, 0xd9, 0x5c, 0x5c, 0x78, 0x93, 0xb7, 0x8a,
-  0xfd, 0x8c, 0x84, 0x3a, 0x17, 0x04, 0xf4, 0xd0, 0x20, 0xf1, 0x18, 0x9c,
-  0x23, 0x06, 0xcf, 0x0b, 0x03, 0x44, 0xa0, 0x22, 0x02, 0xc2, 0x1c, 0xd1,
-  0x64, 0xd8, 0x4e, 0x91, 0x00, 0xd9, 0x5a, 0x02, 0xd2, 0x45, 0x6c, 0x57,
-  0x10, 0x20, 0x06, 0x5a, 0xa8, 0xc0, 0xb7, 0xea, 0xc3, 0xab, 0x0c, 0x2e,
-  0x38, 0x92, 0x75, 0x54, 0x9a, 0x99, 0x04, 0x38, 0x11, 0x21, 0xe5, 0x1d,
-  0x87, 0x05, 0x94, 0x4f, 0xc8, 0xbd, 0xd5, 0xb6, 0x60, 0x66, 0x60, 0x09,
-  0x49, 0x19, 0x3d, 0x60, 0x16, 0x81, 0xed, 0x72, 0x41, 0x06, 0xe4, 0x3f,
-  0x06, 0x9c, 0xeb, 0x7c, 0x40, 0x0b, 0xed, 0xfc, 0x25, 0x22, 0xf8, 0xa1,
-  0x64, 0x01, 0xa1, 0x64, 0xf8, 0x3c, 0x19, 0xe6, 0x04, 0x83, 0x3a, 0xe4,
-  0x00, 0x52, 0xc8, 0x4c, 0x07, 0xae, 0x11, 0x82, 0xd2, 0x29, 0xb0, 0x01,
-  0x19, 0xe3, 0xb2, 0x62, 0xc0, 0x48, 0x41, 0x6d, 0x7b, 0x99, 0x89, 0xaf,
-  0x04, 0x85, 0xdb, 0xc7, 0x87, 0x92, 0x01, 0x41, 0x61, 0xeb, 0x20, 0x8a,
-  0x3c, 0xb2, 0x2e, 0xb2, 0x08, 0x01, 0xdc, 0x08, 0x12, 0x01, 0xda, 0xff,
-  0x00, 0x24, 0x42, 0xaf, 0xfb, 0x01, 0x8f, 0xdb, 0x8e, 0x51, 0x1e, 0x31,
-  0xf0, 0xb7, 0x00, 0x25, 0x7b, 0x38, 0xa0, 0x04, 0x2a, 0xb3, 0x2f, 0x75,
-  0x97, 0x77, 0x54, 0x84, 0xe6, 0xb0, 0x25, 0x1c, 0x08, 0x03, 0x97, 0x51,
-  0x21, 0x4e, 0x5e, 0x09, 0x4b, 0xa2, 0x2b, 0x3d, 0xa1, 0x09, 0x90, 0xaa,
-  0xa4, 0x99, 0x40, 0x01, 0x84, 0xa0, 0x61, 0x3c, 0xc4, 0x10, 0x98, 0x1c,
-  0x08, 0x12, 0x04, 0xb0, 0x18, 0x13, 0xc0, 0xfe, 0x40, 0xd2, 0x04, 0xfc,
-  0x06, 0x1c, 0x42, 0x41, 0x62, 0x91, 0x01, 0x96, 0x10, 0xe0, 0x10, 0x20,
-  0x59, 0x04, 0x15, 0xe6, 0x12, 0x68, 0x97, 0x42, 0xdb, 0x42, 0x1f, 0x15,
-  0x80, 0x09, 0x64, 0x3c, 0x9c, 0x01, 0x81, 0xe3, 0x8a, 0x01, 0x70, 0xa4,
-  0x01, 0x18, 0x5f, 0x00, 0x30, 0x69, 0x94, 0x48, 0xae, 0x4b, 0x4d, 0x06,
-  0x6c, 0x49, 0x44, 0x28, 0xcc, 0x00, 0x3d, 0x2a, 0x95, 0x26, 0x80, 0x10,
-  0x4d, 0xb8, 0x89, 0x00, 0x32, 0x9b, 0x99, 0x96, 0x18, 0x8f, 0x00, 0x90,
-  0xe1, 0x29, 0x50, 0x4c, 0xc5, 0x00, 0x24, 0xe2, 0x28, 0xf1, 0x0b, 0x07,
-  0x14, 0x64, 0xf3, 0xe0, 0x02, 0xff, 0x02, 0x4a, 0xe3, 0x87, 0x8d, 0x05,
-  0x7c, 0x4d, 0x12, 0x8d, 0xb4, 0x01, 0x9d, 0x5b, 0x2b, 0xb6, 0x81, 0x1b,
-  0x87, 0x80, 0x09, 0x56, 0x02, 0xf7, 0x32, 0x08, 0x30, 0xb3, 0xbd, 0x57,
-  0xf9, 0x08, 0x04, 0x3b, 0x8f, 0x9a, 0xb7, 0x60, 0x20, 0x38, 0x62, 0xfe,
-  0x40, 0xc8, 0x92, 0x14, 0xc8, 0x6b, 0x5c, 0x59, 0x81, 0x45, 0x2b, 0x30,
-  0x2b, 0x08, 0xb8, 0x4c, 0x93, 0x38, 0x97, 0x08, 0x32, 0x14, 0xa0, 0x10,
-  0x04, 0x61, 0x99, 0x32, 0x77, 0x04, 0x62, 0xa4, 0x46, 0x91, 0xf8, 0xa6,
-  0x2f, 0x01, 0x02, 0x30, 0xd2, 0xab, 0x44, 0x1a, 0x05, 0x24, 0xf0, 0x8e,
-  0x14, 0x69, 0x7b, 0x19, 0x12, 0xb0, 0x71, 0xff, 0x04, 0x7c, 0xd5, 0x56,
-  0x90, 0x6c, 0x88, 0xb1, 0x11, 0xe0, 0x40, 0x0a, 0x40, 0x00, 0x26, 0x7d,
-  0x02, 0xd0, 0xf4, 0x05, 0x25, 0x01, 0x5a, 0x85, 0x38, 0x93, 0x21, 0x65,
-  0x7b, 0x4e, 0xf8, 0xfe, 0x00, 0xa4, 0x2b, 0x02, 0xf2, 0xcf, 0xfe, 0x05,
-  0x45, 0xc8, 0x5a, 0x56, 0x12, 0x91, 0xc4, 0xf0, 0x8b, 0x45, 0x05, 0x20,
-  0x55, 0x06, 0x8a, 0x50, 0x94, 0x59, 0x9a, 0x4c, 0x9b, 0x8c, 0x94, 0x58,
-  0xa9, 0x48, 0x82, 0x55, 0xfb, 0x52, 0x0e, 0x50, 0xc5, 0x79, 0x45, 0x90,
-  0x90, 0xd9, 0x48, 0x10, 0xa2, 0x92, 0xb3, 0x18, 0x31, 0x20, 0x30, 0xff,
-  0x26, 0x1a, 0xa3, 0x78, 0x03, 0x83, 0x4b, 0x0b, 0x11, 0x00, 0x66, 0x79,
-  0xa3, 0x10, 0x05, 0x51, 0x7d, 0xe8, 0x10, 0x4b, 0xf5, 0x0e, 0x35, 0x10,
-  0x03, 0x27, 0x0b, 0x1e, 0x64, 0x69, 0xc0, 0x15, 0x95, 0x57, 0xd8, 0x3e,
-  0x2d, 0x22, 0x8a, 0x4d, 0x21, 0x11, 0x07, 0x96, 0x88, 0xd6, 0x03, 0x4b,
-  0x1b, 0x0f, 0x50, 0x19, 0x91, 0x18, 0x02, 0xb2, 0x63, 0xb1, 0x3c, 0xcb,
-  0xb7, 0x9d, 0xb0, 0x81, 0x68, 0xd4, 0x06, 0x04, 0xd5, 0xda, 0x0e, 0x51,
-  0xf0, 0xc0, 0xc0, 0x50, 0x4e, 0x66, 0x21, 0xf5, 0x1a, 0x07, 0x20, 0x0c,
-  0xa7, 0x31, 0x15, 0x65, 0xa2, 0xee, 0x61, 0x56, 0x79, 0xc3, 0x2b, 0xc6,
-  0x39, 0x02, 0x0c, 0xd9, 0xc0, 0x59, 0x46, 0x35, 0x0a, 0x05, 0x20, 0xe5,
-  0xb5, 0x1e, 0x82, 0x8e, 0x0a, 0x29, 0xdf, 0xd1, 0x47, 0xd9, 0xe7, 0xaf,
-  0x27, 0xa0, 0x56, 0xb0, 0xee, 0x36, 0x39, 0x0b, 0x47, 0x05, 0x10, 0x09,
-  0x8a, 0xc1, 0x3f, 0x02, 0x2c, 0xd5, 0x37, 0x06, 0x2d, 0x31, 0xff, 0x41,
-  0xac, 0xe8, 0x56, 0x06, 0x48, 0xcb, 0x55, 0xb0, 0x40, 0x54, 0x34, 0x11,
-  0x61, 0xab, 0xa8, 0x2b, 0x0d, 0xaa, 0xc5, 0x76, 0xf6, 0xd7, 0x41, 0x2c,
-  0x5c, 0xd9, 0x8c, 0xbd, 0x5a, 0x95, 0xd4, 0xb2, 0xce, 0x59, 0x2a, 0xb2,
-  0xd4, 0x10, 0x92, 0x17, 0xf6, 0x17, 0xd7, 0x14, 0xa2, 0x26, 0x8f, 0x64,
-  0xd6, 0x6f, 0xd0, 0x65, 0x56, 0x6d, 0xd6, 0x91, 0x0a, 0x0a, 0x06, 0xc0,
-  0xd7, 0x39, 0x7e, 0x66, 0xff, 0x96, 0x95, 0xff, 0x49, 0x90, 0x57, 0x07,
-  0x4e, 0x57, 0x25, 0x84, 0xac, 0xb8, 0x57, 0xcb, 0xf9, 0x65, 0x70, 0xd9,
-  0x57, 0x23, 0xa8, 0x84, 0x48, 0x85, 0x81, 0xc4, 0xc1, 0x27, 0x2d, 0x76,
-  0x1f, 0x05, 0x1f, 0x61, 0x00, 0x20, 0xa0, 0x7d, 0x82, 0x88, 0x00, 0x86,
-  0xad, 0xaa, 0x97, 0x81, 0xf7, 0x72, 0x82, 0xdd, 0x28, 0xc2, 0x55, 0xd9,
-  0xeb, 0x3b, 0x8b, 0xf8, 0x0c, 0x67, 0x12, 0x82, 0x0e, 0xfa, 0x0a, 0xfe,
-  0xa0, 0xb7, 0x5d, 0x73, 0x48, 0x44, 0x50, 0xb1, 0x77, 0xf0, 0xd9, 0x55,
-  0x0e, 0x03, 0xa9, 0x10, 0x93, 0x05, 0x50, 0x0c, 0x76, 0xf6, 0x92, 0x16,
-  0x02, 0xac, 0xc5, 0xf0, 0xfd, 0xfe, 0xee, 0x71, 0x52, 0x7c, 0x16, 0x0c,
-  0x93, 0x36, 0xee, 0xfd, 0xeb, 0x60, 0x4c, 0xd4, 0x76, 0x4a, 0x04, 0xd7,
-  0xa4, 0xfe, 0x4f, 0x21, 0x91, 0x30, 0x92, 0x93, 0xd9, 0x4f, 0xec, 0xd0,
-  0xb2, 0xd2, 0xfe, 0x5b, 0x4e, 0xe4, 0xae, 0x45, 0x9b, 0x54, 0x6b, 0xa4,
-  0x2b, 0x5b, 0x4e, 0xbf, 0x2e, 0x11, 0x57, 0xc2, 0x29, 0xf5, 0x84, 0xfe,
-  0x01, 0x85, 0x10, 0xb0, 0xc9, 0x5e, 0xd6, 0xaa, 0xb3, 0x5e, 0x01, 0x98,
-  0x58, 0x22, 0x32, 0xcb, 0xc0, 0x48, 0xb7, 0x7b, 0xab, 0x00, 0xf8, 0x01,
-  0xaa, 0x50, 0x40, 0x67, 0x52, 0x3f, 0x5b, 0x1f, 0x26, 0x01, 0xd7, 0x35,
-  0x8b, 0x3e, 0x2d, 0x0a, 0x4c, 0x3b, 0x11, 0x2d, 0x23, 0x64, 0x1f, 0xbc,
-  0x2d, 0x25, 0x61, 0x84, 0x11, 0x16, 0x5b, 0x04, 0xb3, 0x1f, 0x04, 0xe9,
-  0xd0, 0x81, 0x23, 0x78, 0x13, 0x43, 0xe4, 0x82, 0x1f, 0x90, 0x12, 0xa7,
-  0x2c, 0xfe, 0x25, 0x8a, 0x2e, 0x6d, 0xd4, 0xb8, 0x2e, 0x51, 0x94, 0xcc,
-  0x8c, 0x7d, 0xc4, 0x04, 0xe2, 0x55, 0x25, 0xeb, 0x99, 0x08, 0x15, 0xbd,
-  0x94, 0x01, 0xb8, 0x2f, 0x95, 0x2a, 0xa8, 0x3b, 0x21, 0xb8, 0x5c, 0x65,
-  0x17, 0x68, 0x0b, 0x1f, 0x27, 0x74, 0x10, 0x05, 0x46, 0xda, 0x77, 0x14,
-  0x0f, 0x36, 0x4f, 0xf2, 0xd0, 0x8e, 0x55, 0x96, 0x16, 0xc3, 0x23, 0xbd,
-  0x12, 0x1b, 0x12, 0xd3, 0xd4, 0x0a, 0x49, 0xe1, 0x28, 0x09, 0xf3, 0x0e,
-  0x9a, 0xf1, 0x0a, 0x96, 0x7f, 0x92, 0x0e, 0x46, 0xe4, 0x06, 0x8a, 0x94,
-  0xa1, 0x15, 0x02, 0xad, 0x63, 0x58, 0xe6, 0xc7, 0x05, 0x86, 0x05, 0xc1,
-  0x61, 0xba, 0x13, 0x44, 0x40, 0x83, 0xde, 0x51, 0x00, 0x26, 0x14, 0x1b,
-  0xe6, 0xeb, 0x12, 0x78, 0x12, 0x60, 0x64, 0x50, 0x19, 0xf7, 0x22, 0xf6,
-  0x39, 0x14, 0x18, 0x81, 0x9a, 0x0b, 0xc7, 0x03, 0x00, 0x96, 0x33, 0x61,
-  0x10, 0x34, 0x60, 0xfe, 0xdb, 0xeb, 0x62, 0x5c, 0x06, 0x0d, 0xe6, 0x07,
-  0xa1, 0x1e, 0xeb, 0x0d, 0x8a, 0xb0, 0x09, 0x36, 0xb0, 0x15, 0x6e, 0x6a,
-  0x62, 0x18, 0xcd, 0x80, 0x86, 0x15, 0x9a, 0xb7, 0x15, 0x93, 0xae, 0x45,
-  0x58, 0x0c, 0x2f, 0x0d, 0x4c, 0xad, 0xc1, 0x57, 0x67, 0x6d, 0x3b, 0xec,
-  0xc6, 0x77, 0xda, 0x29, 0xe4, 0x0e, 0x26, 0x0e, 0x4d, 0x8b, 0x50, 0x29,
-  0x2d, 0x15, 0x80, 0x1f, 0xa2, 0x03, 0x49, 0x23, 0x91, 0xf6, 0x51, 0x52,
-  0xa6, 0x0c, 0x07, 0x54, 0x9d, 0xca, 0x03, 0x14, 0x12, 0x88, 0x1f, 0x20,
-  0x74, 0xf4, 0x10, 0x44, 0x8e, 0x55, 0xf6, 0x2f, 0xc3, 0xab, 0x45, 0x02,
-  0xca, 0x4e, 0x37, 0xff, 0x15, 0xbb, 0x10, 0x12, 0x00, 0x32, 0x2e, 0xbd,
-  0x27, 0x20, 0x32, 0x1a, 0xa0, 0x3d, 0xea, 0x84, 0x51, 0xb1, 0x33, 0x83,
-  0x47, 0xda, 0x25, 0x6e, 0x7d, 0x9a, 0x76, 0x8a, 0x05, 0x0d, 0x40, 0x0f,
-  0x2c, 0x04, 0xf1, 0xb0, 0x01, 0xeb, 0x59, 0x01, 0x18, 0x88, 0x36, 0xff,
-  0xda, 0xdc, 0xb8, 0x18, 0x18, 0x18, 0x04, 0x4e, 0x83, 0xe6, 0x71, 0x1e,
-  0xb6, 0x4a, 0x3a, 0x88, 0x89, 0x76, 0xd5, 0x55, 0xfc, 0x73, 0x04, 0x77,
-  0x2b, 0xf8, 0x73, 0x00, 0x08, 0x90, 0xb2, 0xf8, 0xeb, 0x19, 0xb0, 0x5f,
-  0x9d, 0xf3, 0x9a, 0xb6, 0x04, 0x6d, 0x0b, 0xeb, 0xb7, 0xab, 0xd1, 0x06,
-  0x60, 0xb0, 0x03, 0x50, 0x73, 0xae, 0x0f, 0x1b, 0x6a, 0x18, 0x08, 0x31,
-  0x15, 0x80, 0x54, 0xa8, 0xdf, 0x9d, 0x58, 0x00, 0x68, 0x00, 0x10, 0x7c,
-  0x30, 0x1a, 0xa0, 0xae, 0xa8, 0xa0, 0x15, 0x5c, 0x35, 0x34, 0x12, 0x01,
-  0x75, 0x80, 0x90, 0x04, 0x3a, 0x60, 0x7e, 0x07, 0x9a, 0x99, 0x24, 0x31,
-  0xe9, 0xed, 0x81, 0x7e, 0xea, 0x1a, 0xdb, 0x75, 0x59, 0x77, 0xec, 0xe1,
-  0x24, 0xff, 0xb4, 0xcc, 0xe8, 0xec, 0x80, 0xbc, 0x73, 0x3e, 0x16, 0xfa,
-  0x2f, 0x28, 0xa1, 0xfb, 0x0d, 0x85, 0x45, 0xc9, 0x96, 0x4c, 0xf7, 0x17,
-  0x14, 0x54, 0x74, 0x14, 0xa0, 0x54, 0xaa, 0x3a, 0x8e, 0x0c, 0xdc, 0x3a,
-  0x18, 0x30, 0xb8, 0x62, 0x0f, 0x77, 0xa6, 0x39, 0x6e, 0xa5, 0xff, 0x7a,
-  0xc9, 0x11, 0x11, 0xc9, 0x16, 0x72, 0x83, 0xa2, 0x08, 0xd6, 0x5d, 0x2c,
-  0xc9, 0x20, 0x4e, 0xff, 0xff, 0x4a, 0x59, 0x53, 0x0e, 0x00, 0x27, 0x20,
-  0xbd, 0xed, 0x9c, 0x53, 0x13, 0x81, 0xcb, 0xe6, 0x56, 0x10, 0x53, 0xc9,
-  0xdb, 0x50, 0xd3, 0xe8, 0x20, 0xc9, 0xe8, 0x39, 0x35, 0x30, 0x03, 0xb0,
-  0x21, 0x40, 0x86, 0x09, 0xd0, 0xc8, 0x12, 0x09, 0xb0, 0xca, 0x07, 0x00,
-  0x2b, 0x36, 0x58, 0x43, 0xce, 0x35, 0x21, 0x4b, 0x6c, 0x62, 0xe6, 0x98,
-  0x68, 0xe6, 0x54, 0x40, 0x4b, 0x58, 0x75, 0x13, 0xa1, 0x41, 0xcc, 0xcf,
-  0x44, 0x38, 0x13, 0x48, 0x44, 0xdf, 0x7b, 0x08, 0x20, 0x1e, 0x10, 0x4a,
-  0xc4, 0xf2, 0x36, 0xc6, 0xab, 0xeb, 0x40, 0x1f, 0xe6, 0xbe, 0xba, 0x75,
-  0xb6, 0x46, 0xf2, 0xee, 0x41, 0x92, 0xee, 0x64, 0x56, 0x26, 0x01, 0xf6,
-  0x45, 0x66, 0xb2, 0x40, 0x96, 0x6c, 0x06, 0xdd, 0x0b, 0x8c, 0x30, 0xd3,
-  0x38, 0x83, 0x28, 0x2b, 0xc9, 0x2b, 0x16, 0xa8, 0xb6, 0x2b, 0x8e, 0x49,
-  0x05, 0x41, 0xb7, 0xf3, 0x02, 0x56, 0x74, 0x03, 0x44, 0xc4, 0x10, 0x49,
-  0x2e, 0x80, 0x8c, 0xea, 0x10, 0x04, 0xad, 0xce, 0x63, 0x80, 0xfb, 0x95,
-  0x5d, 0x9c, 0xe7, 0x21, 0x90, 0xc2, 0x75, 0x69, 0x5c, 0x20, 0x94, 0x85,
-  0x75, 0x90, 0xae, 0x9b, 0x0d, 0x43, 0x29, 0x78, 0x15, 0x6e, 0x46, 0xec,
-  0x80, 0x00, 0x42, 0x38, 0x0b, 0x08, 0x66, 0xab, 0x58, 0x46, 0x8a, 0x40,
-  0x72, 0x68, 0x18, 0xc3, 0xdc, 0x1a, 0x6d, 0x9c, 0x75, 0x3c, 0xba, 0x23,
-  0x3c, 0x61, 0x12, 0x34, 0x5c, 0xe8, 0xb2, 0x16, 0x06, 0xef, 0x15, 0x74,
-  0x06, 0xba, 0x64, 0x4b, 0x8a, 0xfe, 0xb1, 0xee, 0x2b, 0xa5, 0xba, 0x08,
-  0xe8, 0xf7, 0xea, 0xba, 0x80, 0x37, 0x43, 0xc2, 0x26, 0xf6, 0xa3, 0x72,
-  0x00, 0xff, 0xfa, 0xb2, 0x55, 0x60, 0x14, 0x25, 0x2f, 0xce, 0x01, 0x53,
-  0xe9, 0x47, 0xec, 0x64, 0x15, 0xb7, 0x1a, 0x4f, 0x0f, 0x01, 0x1f, 0x00,
-  0x01, 0x60, 0x1f, 0x4c, 0x08, 0x94, 0x36, 0x0e, 0x5a, 0x6f, 0x3f, 0x90,
-  0x01, 0x0e, 0x07, 0x49, 0x5a, 0xb1, 0xc2, 0x1f, 0x99, 0x00, 0x08, 0x59,
-  0xc4, 0x6c, 0x1a, 0xe4, 0x19, 0xce, 0xc0, 0xdf, 0x2a, 0xec, 0x02, 0xbf,
-  0x83, 0x0d, 0x84, 0x00, 0x21, 0x08, 0xd9, 0x7d, 0xfe, 0xa9, 0x14, 0xa4,
-  0x1e, 0xa2, 0x0e, 0x71, 0xcf, 0x07, 0x0f, 0x71, 0x03, 0x9b, 0x60, 0x02,
-  0xb0, 0x43, 0xb5, 0x44, 0x56, 0x7b, 0xf2, 0xa0, 0x0e, 0x71, 0x3b, 0xa0,
-  0x0f, 0x08, 0xd8, 0x16, 0xff, 0x9a, 0xc5, 0x00, 0x31, 0x1c, 0xa3, 0xcc,
-  0xb3, 0x30, 0x65, 0xb4, 0x3e, 0x08, 0x55, 0x6f, 0x2c, 0x9a, 0x34, 0x01,
-  0x6a, 0x13, 0x0a, 0x4f, 0x53, 0xc8, 0x30, 0x6b, 0x59, 0x0a, 0x26, 0x00,
-  0x43, 0xb2, 0xca, 0x15, 0xe4, 0xca, 0xb9, 0xce, 0x85, 0xbb, 0xcd, 0xb6,
-  0xff, 0x58, 0x38, 0xf3, 0x08, 0x34, 0x48, 0x54, 0x60, 0x45, 0xd0, 0x1d,
-  0x08, 0xf9, 0x13, 0x5c, 0x72, 0x67, 0xa5, 0x7b, 0x61, 0x2f, 0x20, 0x1a,
-  0x61, 0x17, 0xc8, 0x28, 0xf3, 0x85, 0x04, 0xc8, 0x0a, 0x1e, 0x74, 0x11,
-  0xcb, 0x1e, 0xcf, 0xbb, 0x05, 0x06, 0x21, 0x2d, 0xc5, 0xce, 0xea, 0x06,
-  0xc9, 0xd6, 0xb6, 0x1a, 0x06, 0xca, 0x69, 0x13, 0x65, 0xc8, 0xcb, 0x75,
-  0x0c, 0xce, 0x32, 0x02, 0xc0, 0xdf, 0xdb, 0xbb, 0xd1, 0xb0, 0xff, 0x81,
-  0x5b, 0x3d, 0x2a, 0x90, 0x0b, 0xc5, 0x54, 0x7e, 0x99, 0x2a, 0x04, 0xee,
-  0x53, 0x64, 0x9a, 0x4e, 0xe0, 0x08, 0x55, 0x61, 0xd3, 0xf8, 0x01, 0x72,
-  0x51, 0x77, 0xa2, 0x3f, 0xfe, 0x76, 0x49, 0x10, 0x27, 0x54, 0x0e, 0x55,
-  0xff, 0x87, 0xa3, 0x14, 0x71, 0x81, 0x3e, 0x6e, 0x03, 0x00, 0x10, 0xd0,
-  0x9a, 0xaf, 0x14, 0x07, 0xb4, 0xa1, 0x04, 0x5a, 0x89, 0xe0, 0x1c, 0x40,
-  0x92, 0xa5, 0x88, 0x04, 0x71, 0x17, 0x4e, 0x25, 0xc1, 0xed, 0xa3, 0x1a,
-  0x71, 0x8d, 0x6b, 0x03, 0x8d, 0x6d, 0x0a, 0x8a, 0xd8, 0xeb, 0x00, 0x32,
-  0xcd, 0x00, 0xa3, 0xc2, 0x12, 0x71, 0xfd, 0x1b, 0x4d, 0xd4, 0x4c, 0x8f,
-  0xdd, 0x24, 0x9a, 0xbf, 0xe8, 0x32, 0x2a, 0x92, 0x75, 0x5f, 0x01, 0x8b,
-  0xdb, 0x87, 0x1e, 0x29, 0x97, 0xfb, 0x1c, 0x71, 0x89, 0x16, 0x16, 0x34,
-  0x76, 0x18, 0x71, 0x17, 0x03, 0x22, 0x6f, 0x0f, 0x10, 0x71, 0xb8, 0x80,
-  0x00, 0x28, 0x66, 0x86, 0x17, 0xb5, 0x03, 0xbb, 0x1e, 0xa1, 0x10, 0x89,
-  0x2c, 0x06, 0xde, 0xbf, 0x50, 0x07, 0x01, 0x2a, 0x0a, 0x66, 0x11, 0x25,
-  0xdf, 0x74, 0xf9, 0x30, 0x78, 0x2e, 0xb9, 0x60, 0x90, 0x26, 0xb0, 0x40,
-  0x5b, 0x2e, 0x4d, 0x25, 0xa2, 0xb4, 0x24, 0x32, 0x3e, 0xb2, 0x91, 0x45,
-  0xd7, 0xe3, 0x6b, 0x3c, 0xa2, 0x90, 0xd2, 0x59, 0x84, 0xee, 0x89, 0x87,
-  0x98, 0xb9, 0x97, 0xa0, 0x83, 0x0f, 0x8b, 0x35, 0x0b, 0xd8, 0xb0, 0x75,
-  0x24, 0x05, 0xba, 0xea, 0x18, 0x8b, 0xdf, 0x08, 0x41, 0xc9, 0x6b, 0x11,
-  0x03, 0x5a, 0x19, 0x8a, 0x4c, 0x45, 0x03, 0x9b, 0x5d, 0xe4, 0x8c, 0x36,
-  0x61, 0x35, 0xf0, 0xc7, 0x87, 0x20, 0xcc, 0x14, 0x53, 0x9b, 0xb7, 0xd8,
-  0x55, 0x45, 0xf0, 0x9d, 0x90, 0xd8, 0x99, 0x09, 0x1c, 0x00, 0xc7, 0x15,
-  0x04, 0x73, 0xae, 0x05, 0xf8, 0x07, 0xe2, 0x0a, 0x84, 0x4b, 0x05, 0xcd,
-  0x93, 0x63, 0x90, 0xde, 0x25, 0x8f, 0x40, 0xe3, 0x9a, 0x84, 0x30, 0x02,
-  0xb2, 0x1b, 0x61, 0x8b, 0xb2, 0x76, 0x39, 0x36, 0x5c, 0x85, 0x89, 0xdb,
-  0x8b, 0x16, 0x2c, 0xa1, 0x68, 0x2b, 0xa9, 0xaf, 0x5b, 0x0f, 0x2a, 0x2c,
-  0x09, 0xb2, 0x26, 0xfb, 0x24, 0x71, 0xeb, 0x71, 0x0e, 0x64, 0x32, 0x65,
-  0x2e, 0x96, 0x2c, 0x62, 0x59, 0x3a, 0x19, 0x36, 0x65, 0x34, 0xc2, 0x53,
-  0x56, 0x23, 0xfb, 0xd0, 0x30, 0x9a, 0x9a, 0x53, 0x95, 0x07, 0x2a, 0xf6,
-  0x3f, 0x8b, 0x1e, 0x0e, 0xb2, 0xb3, 0xde, 0x0d, 0x12, 0xb2, 0x10, 0x01,
-  0x63, 0x7c, 0x06, 0x68, 0x17, 0x56, 0xe3, 0x03, 0x8a, 0x21, 0x9c, 0x52,
-  0x50, 0xcc, 0xd0, 0x33, 0x4e, 0x50, 0x59, 0xf1, 0x80, 0xc9, 0xa1, 0x01,
-  0xfc, 0x23, 0x87, 0xfe, 0x3f, 0x07, 0xea, 0xa3, 0x02, 0xc4, 0x55, 0x8c,
-  0x10, 0xb1, 0x6f, 0xc2, 0x1b, 0x8a, 0xc1, 0xf0, 0x98, 0xba, 0x0c, 0x02,
-  0x50, 0x0d, 0x0f, 0xfa, 0x2f, 0xd1, 0x6f, 0x06, 0x61, 0x03, 0xed, 0xfe,
-  0xc1, 0x1a, 0xb7, 0x3a, 0x2f, 0x7c, 0xde, 0x6f, 0x59, 0xd2, 0x30, 0xff,
-  0x80, 0x1f, 0xcb, 0xee, 0xd9, 0xbe, 0xff, 0x45, 0x1c, 0x3f, 0x85, 0xa2,
-  0x1e, 0xb7, 0x29, 0xc3, 0x13, 0x9d, 0x8b, 0x15, 0x03, 0x8b, 0xd8, 0x16,
-  0x12, 0x5c, 0x8b, 0xad, 0x10, 0x73, 0x92, 0x69, 0x7e, 0x80, 0xf9, 0x1f,
-  0x7c, 0xbc, 0x89, 0xe5, 0x42, 0x89, 0x80, 0xd5, 0xb5, 0xd6, 0x7b, 0x3e,
-  0xbb, 0x6b, 0x65, 0xb9, 0x06, 0x00, 0x1b, 0x63, 0x60, 0xe6, 0xa6, 0x60,
-  0x1f, 0x66, 0x57, 0x41, 0x41, 0xed, 0x33, 0x0d, 0x45, 0x09, 0xe6, 0xe3,
-  0xa3, 0x5c, 0xbd, 0xa1, 0x5e, 0x43, 0x5b, 0x06, 0x0b, 0x96, 0x06, 0x75,
-  0x8d, 0x00, 0xbb, 0x9d, 0x30, 0xeb, 0xd7, 0x64, 0x24, 0x33, 0x62, 0x4b,
-  0x64, 0x62, 0x34, 0x64, 0xb6, 0x11, 0x1a, 0xb5, 0x2a, 0xb2, 0x1e, 0x5c,
-  0xc8, 0x6e, 0xe3, 0xeb, 0xca, 0x8d, 0x0d, 0x8b, 0x3d, 0x1d, 0x21, 0x6c,
-  0x0e, 0x64, 0xd2, 0x62, 0x1a, 0x20, 0x4b, 0xda, 0x5a, 0x97, 0x88, 0xa5,
-  0xf8, 0x05, 0x51, 0xcc, 0xfc, 0x6d, 0x1d, 0xba, 0x1f, 0x17, 0xfb, 0xaf,
-  0x5c, 0x68, 0x48, 0x89, 0x30, 0xd1, 0x56, 0x9d, 0x70, 0xf2, 0x51, 0xd7,
-  0x27, 0xca, 0x5a, 0x02, 0x10, 0xdf, 0x31, 0x51, 0x6c, 0xec, 0xd3, 0xc8,
-  0xa9, 0xf6, 0x1d, 0xc4, 0x1e, 0xa8, 0x71, 0x03, 0xaf, 0x06, 0xf2, 0x7d,
-  0xa8, 0x01, 0x5a, 0x8a, 0x16, 0xb8, 0xf8, 0x43, 0xde, 0xeb, 0x1f, 0x66,
-  0xd6, 0x48, 0x9e, 0x4a, 0x28, 0xcd, 0x7c, 0xf3, 0x22, 0xc6, 0x54, 0x00,
-  0x11, 0xcc, 0x6e, 0x22, 0x36, 0xb2, 0x6c, 0x22, 0x30, 0x06, 0x11, 0x60,
-  0xaf, 0x2e, 0x44, 0x5f, 0x9e, 0xad, 0xda, 0x00, 0x8a, 0x06, 0x10, 0xb1,
-  0xe8, 0xf4, 0x8a, 0x4b, 0x29, 0x41, 0x34, 0x2b, 0x8d, 0x10, 0xb7, 0x0f,
-  0x08, 0x07, 0x59, 0x85, 0x24, 0x72, 0x8b, 0x0d, 0x04, 0x14, 0x43, 0xeb,
-  0x58, 0x6e, 0x16, 0x5c, 0xa1, 0x6a, 0x1d, 0x20, 0xe8, 0x99, 0xff, 0xe6,
-  0x25, 0x2f, 0x42, 0x8a, 0x06, 0xd2, 0x02, 0x2f, 0x80, 0xc5, 0xcd, 0x50,
-  0x28, 0x3a, 0x20, 0x56, 0xcf, 0x75, 0x43, 0x89, 0xd9, 0x77, 0x08, 0x32,
-  0x0f, 0x89, 0x7f, 0x0a, 0x00, 0x30, 0xfc, 0x13, 0xc6, 0x77, 0x1b, 0xe9,
-  0x97, 0x01, 0x44, 0x58, 0xca, 0x68, 0x05, 0xbf, 0x80, 0x48, 0x01, 0x05,
-  0x86, 0x2a, 0xa2, 0x19, 0xb7, 0xc3, 0xf6, 0x2b, 0xb0, 0xfe, 0xc0, 0x6b,
-  0x8f, 0xfb, 0x9c, 0x09, 0xce, 0x91, 0xc4, 0x48, 0x46, 0x37, 0x8e, 0xbb,
-  0x65, 0x83, 0xe7, 0xf0, 0xfc, 0x60, 0x2b, 0x62, 0x15, 0xec, 0xd7, 0x2b,
-  0x04, 0x14, 0xb2, 0x86, 0xc5, 0x3c, 0xcd, 0x08, 0x00, 0x9b, 0x6f, 0xa1,
-  0x23, 0x65, 0xb3, 0x1a, 0x08, 0x66, 0xb0, 0x6f, 0x1c, 0xcd, 0xc1, 0xba,
-  0x6d, 0xfd, 0xb4, 0xf1, 0xfd, 0x3e, 0x75, 0x37, 0xfc, 0x04, 0xd6, 0x0a,
-  0x31, 0xa8, 0x93, 0xdd, 0xb2, 0xd9, 0x26, 0x64, 0xa6, 0xc2, 0xbc, 0x05,
-  0xb6, 0xdb, 0xfd, 0x4a, 0xde, 0x14, 0x10, 0x69, 0xa6, 0x0a, 0xc6, 0xe5,
-  0xfd, 0x40, 0x39, 0xfd, 0x0a, 0xe4, 0xfd, 0xa6, 0xfd, 0x48, 0x16, 0x1b,
-  0x18, 0xd0, 0x53, 0x15, 0x1c, 0x4a, 0xea, 0x7a, 0xf6, 0x89, 0x18, 0x2c,
-  0x04, 0x81, 0xec, 0xa5, 0x20, 0x92, 0xf7, 0xa6, 0xf4, 0x92, 0x03, 0xb9,
-  0xf4, 0x18, 0xa9, 0x02, 0x27, 0x6b, 0x88, 0xe5, 0x06, 0xb7, 0x48, 0x40,
-  0x13, 0xcb, 0xa4, 0x00, 0x21, 0xba, 0xf7, 0xa8, 0x10, 0x3d, 0x11, 0xb2,
-  0xe6, 0xf6, 0xcd, 0xa2, 0xf6, 0x21, 0xc9, 0xfc, 0x0c, 0x82, 0xfb, 0x75,
-  0x7d, 0x21, 0x24, 0x6c, 0xe3, 0xfc, 0x97, 0x66, 0x61, 0x16, 0x63, 0xe3,
-  0x09, 0x65, 0x18, 0x84, 0x79, 0xa7, 0x90, 0xfa, 0x28, 0x76, 0x25, 0x24,
-  0x5b, 0x8c, 0x42, 0x1f, 0x60, 0x00, 0xc8, 0xca, 0xd4, 0x01, 0xf6, 0x37,
-  0xfe, 0x27, 0xba, 0x2a, 0x3a, 0xd4, 0xba, 0x52, 0xe4, 0xca, 0x53, 0x20,
-  0xcb, 0x16, 0x08, 0x36, 0x00, 0x32, 0xde, 0x10, 0xb6, 0x45, 0x59, 0x2e,
-  0xea, 0xc2, 0xe9, 0xbf, 0x3b, 0x44, 0xc8, 0x96, 0x53, 0x75, 0x87, 0x79,
-  0x38, 0x90, 0x74, 0x2e, 0x5d, 0x77, 0xff, 0x70, 0xf7, 0x98, 0x48, 0x41,
-  0x0b, 0x09, 0x7d, 0xbc, 0x3f, 0x0e, 0x13, 0x07, 0x6d, 0x2e, 0xb8, 0x2a,
-  0x00, 0x07, 0xf0, 0x04, 0x15, 0xb0, 0xed, 0x12, 0x10, 0x61, 0x0f, 0x61,
-  0x1c, 0x0e, 0x46, 0xf0, 0x40, 0x10, 0x5c, 0xdc, 0x91, 0xe5, 0x90, 0xf7,
-  0x70, 0xeb, 0x0e, 0x81, 0x2f, 0xe2, 0x5f, 0xff, 0x40, 0xac, 0xe8, 0x15,
-  0xa1, 0x38, 0x80, 0x93, 0x1a, 0xcc, 0x27, 0x46, 0x86, 0x3b, 0x3d, 0xc4,
-  0x72, 0xe5, 0x05, 0x61, 0xd3, 0xe0, 0x8b, 0xd0, 0x8a, 0xd8, 0xca, 0xc2,
-  0x43, 0x34, 0x90, 0x62, 0xe0, 0xca, 0x43, 0x6e, 0x44, 0x15, 0xdb, 0xec,
-  0x0c, 0x42, 0x04, 0x77, 0x3b, 0x06, 0x36, 0x54, 0xd6, 0x0a, 0xb9, 0x0c,
-  0xf2, 0xba, 0x3e, 0xa6, 0xca, 0x6b, 0x10, 0x04, 0x65, 0xfc, 0x12, 0x4d,
-  0x02, 0x0e, 0xfb, 0x92, 0x6b, 0xe1, 0x06, 0x07, 0x30, 0xf6, 0x23, 0x53,
-  0x15, 0x1c, 0x8b, 0xe0, 0x02, 0x4b, 0xcc, 0x91, 0x3a, 0xb0, 0x33, 0x35,
-  0xb1, 0x3e, 0x31, 0x74, 0x1f, 0x60, 0xac, 0x2a, 0x38, 0x03, 0x12, 0x68,
-  0x62, 0x43, 0x91, 0x80, 0x8e, 0x4b, 0xb9, 0x12, 0x8e, 0x60, 0x01, 0xcc,
-  0x30, 0xd2, 0xef, 0x06, 0x6a, 0xa8, 0xc9, 0x0d, 0x67, 0xa8, 0xfb, 0xb5,
-  0xc6, 0xbd, 0xb0, 0xaa, 0x51, 0xb2, 0xd2, 0xfa, 0x16, 0xee, 0xab, 0x08,
-  0x72, 0x37, 0xc9, 0x16, 0x9c, 0x8b, 0x4c, 0xaa, 0x85, 0x12, 0xb2, 0x23,
-  0x13, 0x17, 0x2a, 0x2a, 0xab, 0xf6, 0x3d, 0x8b, 0x37, 0x01, 0x48, 0x1d,
-  0x36, 0xfe, 0x22, 0xb9, 0x25, 0xbd, 0x91, 0xfb, 0x7c, 0xa7, 0x97, 0x8f,
-  0x10, 0x04, 0x56, 0xa5, 0x58, 0x83, 0xab, 0x2e, 0xbf, 0xd4, 0xa4, 0xb4,
-  0x18, 0x3e, 0x01, 0x81, 0x61, 0x8f, 0xce, 0x19, 0x9c, 0x5c, 0x1f, 0x12,
-  0x58, 0x6a, 0x2a, 0xc1, 0x8a, 0x42, 0x73, 0x63, 0xb1, 0x10, 0x14, 0xd0,
-  0xbd, 0x01, 0xa2, 0xf7, 0x29, 0x7c, 0x06, 0x58, 0x30, 0x3d, 0x47, 0x23,
-  0x22, 0xa1, 0xcd, 0xe3, 0x0a, 0x4d, 0x26, 0xf8, 0x90, 0x73, 0x63, 0xfa,
-  0x60, 0x25, 0xe8, 0x22, 0xa9, 0xf9, 0x2d, 0x5f, 0x43, 0xd1, 0xce, 0x00,
-  0xe6, 0x86, 0x6c, 0x55, 0x4c, 0x1b, 0x02, 0x91, 0xab, 0x97, 0x74, 0xeb,
-  0x93, 0x04, 0x19, 0x41, 0xd8, 0x69, 0x5f, 0x48, 0x4d, 0x88, 0x05, 0x60,
-  0xc6, 0xc4, 0xf2, 0x57, 0x97, 0x76, 0xf0, 0x75, 0x12, 0x5f, 0x13, 0x39,
-  0xad, 0x7f, 0x57, 0xc5, 0x34, 0x57, 0x15, 0x80, 0x54, 0x88, 0x16, 0x59,
-  0x2b, 0xdb, 0x4c, 0x40, 0x6f, 0x0b, 0xd5, 0x75, 0x0e, 0x12, 0xff, 0x1c,
-  0x1a, 0x1b, 0x2c, 0x24, 0x12, 0xd8, 0xd9, 0x08, 0x70, 0xe4, 0x75, 0x29,
-  0x01, 0x12, 0xb4, 0x6c, 0x66, 0x26, 0x8b, 0x56, 0x28, 0x04, 0x88, 0x19,
-  0xef, 0x78, 0x7c, 0x40, 0x06, 0x36, 0x87, 0x28, 0x09, 0xe3, 0x92, 0x6a,
-  0x52, 0xc2, 0x4a, 0x41, 0x01, 0xee, 0x88, 0xac, 0x58, 0xcf, 0x74, 0x00,
-  0x15, 0xe0, 0x45, 0x2b, 0xed, 0x65, 0x3e, 0x1a, 0x48, 0xc1, 0xb7, 0x84,
-  0x44, 0x20, 0x1b, 0x3c, 0xeb, 0x00, 0x18, 0x18, 0x40, 0xce, 0x91, 0x05,
-  0x28, 0x35, 0x31, 0xec, 0x92, 0x08, 0x64, 0xcc, 0xd8, 0x2d, 0x12, 0x0c,
-  0x50, 0x2d, 0x48, 0x6b, 0x82, 0xf5, 0xae, 0x04, 0x19, 0x41, 0x28, 0xea,
-  0x17, 0x20, 0x86, 0xf7, 0x6c, 0xb1, 0x7a, 0x55, 0x64, 0xa9, 0xd9, 0x20,
-  0x1f, 0x6e, 0x56, 0x68, 0x98, 0x28, 0xa5, 0x07, 0xca, 0xcc, 0xfc, 0x22,
-  0x1e, 0x13, 0xd1, 0x00, 0x04, 0xdd, 0x05, 0xd7, 0x2c, 0x11, 0x1d, 0x6c,
-  0x9f, 0xff, 0x3a, 0x38, 0x13, 0xa5, 0xbc, 0x45, 0xb8, 0x77, 0xc8, 0xfb,
-  0x0a, 0x24, 0x18, 0x74, 0x75, 0xe2, 0x15, 0x86, 0xe4, 0xa5, 0x89, 0x90,
-  0xd4, 0xc0, 0x05, 0x76, 0x92, 0x66, 0x71, 0xc0, 0x10, 0xc4, 0xea, 0x4f,
-  0xdd, 0xb2, 0x68, 0x71, 0xb2, 0x17, 0x6a, 0x13, 0x0c, 0x6d, 0x10, 0x6c,
-  0xb6, 0xe6, 0x06, 0x10, 0xb3, 0x6e, 0xab, 0x57, 0xc0, 0xa4, 0x4b, 0x3b,
-  0x8b, 0x43, 0x80, 0xf5, 0x38, 0x39, 0x11, 0x2d, 0xc9, 0x27, 0x03, 0xb7,
-  0x0a, 0x08, 0xc9, 0x70, 0xd8, 0x6e, 0x71, 0x0c, 0x0c, 0x66, 0xa0, 0x49,
-  0x1d, 0xf3, 0xa1, 0xd4, 0x30, 0x48, 0x76, 0xd1, 0xff, 0x0e, 0x08, 0xd5,
-  0xeb, 0x2d, 0x67, 0x3e, 0xb8, 0x06, 0x7c, 0xaf, 0x55, 0x22, 0x64, 0xb9,
-  0xc9, 0x16, 0xb2, 0x5c, 0xc1, 0x54, 0x34, 0x11, 0x0a, 0x0c, 0x0d, 0xe8,
-  0x27, 0xe4, 0x2a, 0x84, 0x0e, 0xb4, 0x5f, 0x44, 0xca, 0x68, 0xf5, 0x08,
-  0x27, 0xe8, 0x82, 0x3d, 0x4a, 0x6a, 0x40, 0x24, 0x00, 0xb5, 0xbe, 0x93,
-  0x0b, 0x9f, 0x68, 0xdf, 0x8a, 0x48, 0xe9, 0x6a, 0xf8, 0x01, 0x3c, 0x14,
-  0x56, 0x6b, 0x4a, 0x2d, 0x33, 0xa2, 0xe8, 0xaf, 0x8a, 0x82, 0xee, 0x02,
-  0x78, 0x79, 0xec, 0x20, 0x27, 0x8b, 0x95, 0xea, 0x15, 0x65, 0x6e, 0xa0,
-  0x82, 0x79, 0x69, 0x25, 0x74, 0x72, 0x23, 0x55, 0xde, 0x6f, 0x0e, 0x83,
-  0x7e, 0xf4, 0x4a, 0xe8, 0x26, 0xab, 0xe6, 0xfd, 0xea, 0x8c, 0x56, 0xec,
-  0x8c, 0x55, 0xda, 0x6c, 0xa7, 0xea, 0x58, 0xb7, 0x4b, 0x5f, 0x85, 0xe0,
-  0xd9, 0x07, 0x8f, 0x14, 0x34, 0x7d, 0x06, 0xa2, 0x96, 0xda, 0xde, 0xaf,
-  0xa2, 0xb6, 0xea, 0x73, 0xdc, 0x59, 0xec, 0x01, 0x92, 0xda, 0x99, 0xe6,
-  0x20, 0x2e, 0x26, 0x4a, 0x3a, 0x04, 0x75, 0x36, 0x18, 0xb6, 0x1a, 0xc4,
-  0xe3, 0x50, 0x53, 0x1e, 0x80, 0x2b, 0xad, 0x15, 0x04, 0x58, 0x40, 0x58,
-  0x02, 0xb2, 0x28, 0xd4, 0x62, 0x28, 0xc5, 0x11, 0x40, 0x98, 0x4c, 0x5d,
-  0xd5, 0xa9, 0xff, 0x96, 0x10, 0xb7, 0x20, 0x0c, 0xf7, 0xed, 0x6e, 0x0a,
-  0x50, 0x14, 0x90, 0x94, 0x55, 0x46, 0x14, 0x1d, 0xff, 0x82, 0x36, 0xbd,
-  0x36, 0xb2, 0x1e, 0x75, 0x43, 0x9c, 0x24, 0xee, 0x20, 0x00, 0x3d, 0x92,
-  0x56, 0x19, 0x7d, 0x0b, 0xb2, 0x37, 0x1e, 0x19, 0x5e, 0xd2, 0xb2, 0x4a,
-  0x82, 0x9d, 0xad, 0x15, 0x26, 0x9e, 0x00, 0x65, 0x61, 0x50, 0xad, 0x49,
-  0xd0, 0x10, 0x44, 0x80, 0x99, 0x78, 0xf2, 0x56, 0x4a, 0x07, 0xf4, 0x74,
-  0x12, 0xc8, 0xa3, 0x04, 0x3f, 0xd4, 0x61, 0x0a, 0xb1, 0x1c, 0x48, 0xc3,
-  0x68, 0xaa, 0xb3, 0x7e, 0x84, 0x0d, 0x12, 0xac, 0x4e, 0x22, 0x88, 0x45,
-  0x9f, 0x82, 0x7e, 0x35, 0xed, 0x54, 0x22, 0xc9, 0xab, 0x10, 0xd0, 0x01,
-  0xf1, 0x76, 0xd6, 0x45, 0x64, 0x0b, 0x8b, 0x0f, 0x74, 0xb2, 0x01, 0x2f,
-  0x45, 0xfa, 0xd2, 0xe2, 0xc4, 0x0a, 0xc2, 0x6b, 0xe9, 0x5d, 0xd9, 0x43,
-  0x40, 0xf6, 0xf6, 0xd2, 0x22, 0x45, 0x5a, 0x76, 0x70, 0x43, 0x12, 0xd4,
-  0x2a, 0x55, 0x87, 0xa0, 0x0a, 0x20, 0xa5, 0x4a, 0x41, 0x26, 0xd4, 0xca,
-  0x22, 0x64, 0x0e, 0x94, 0xa9, 0xac, 0x7a, 0x54, 0x56, 0x46, 0x17, 0x17,
-  0x1b, 0x4c, 0x10, 0x61, 0x11, 0x75, 0x49, 0x10, 0xf7, 0xf9, 0xf6, 0x28,
-  0xa4, 0xcc, 0xd9, 0x28, 0xe7, 0xee, 0xfe, 0x60, 0x11, 0x77, 0x20, 0x28,
-  0xa4, 0xbb, 0x98, 0x04, 0x08, 0x0c, 0x07, 0x3c, 0xdd, 0x18, 0x11, 0x18,
-  0xad, 0x07, 0x62, 0x08, 0x06, 0x4e, 0x50, 0x52, 0x70, 0xe8, 0xca, 0x0c,
-  0x1e, 0x29, 0xf0, 0x0a, 0x89, 0x5e, 0x0c, 0x02, 0x33, 0x07, 0xfd, 0xb4,
-  0x16, 0x5b, 0x04, 0x18, 0x97, 0x4d, 0xcc, 0x8e, 0x6d, 0xeb, 0x9e, 0x30,
-  0xdc, 0x0d, 0x98, 0x1b, 0x01, 0xe5, 0x0d, 0x81, 0x7d, 0xaa, 0xc1, 0xdb,
-  0x09, 0x88, 0xd4, 0xf8, 0x19, 0xd7, 0x8a, 0xab, 0x77, 0x64, 0xff, 0x24,
-  0x1a, 0xf1, 0xf1, 0x70, 0x45, 0x83, 0xc2, 0x38, 0x86, 0xb0, 0x9c, 0xf1,
-  0xf8, 0xd2, 0xe0, 0x8a, 0xbd, 0xcf, 0x0a, 0xd0, 0x88, 0xac, 0x04, 0x36,
-  0x29, 0xc0, 0xd6, 0x01, 0x52, 0x4c, 0x4c, 0xc7, 0x10, 0xec, 0xa0, 0x85,
-  0x08, 0x19, 0x3a, 0x07, 0xf6, 0xd0, 0x74, 0x87, 0x22, 0x81, 0x4c, 0xc5,
-  0x81, 0x47, 0x15, 0x01, 0xce, 0xf9, 0x89, 0x18, 0x5a, 0xa2, 0x01, 0x6d,
-  0x10, 0x46, 0xf4, 0x06, 0x24, 0x43, 0x46, 0x31, 0x17, 0x82, 0x88, 0xff,
-  0x32, 0xa1, 0x54, 0x10, 0x98, 0x30, 0xc2, 0x7b, 0xef, 0x61, 0x20, 0x14,
-  0x1f, 0x31, 0xdd, 0x3d, 0x32, 0x85, 0x1e, 0xe0, 0x34, 0xfe, 0xa4, 0x7c,
-  0x1b, 0xbe, 0x18, 0x0b, 0x92, 0xa1, 0x6a, 0xa5, 0x82, 0x7b, 0xe6, 0x33,
-  0x77, 0x0b, 0xd8, 0xfc, 0xfd, 0x1e, 0x76, 0x86, 0x18, 0x17, 0x69, 0x93,
-  0xfe, 0x41, 0x57, 0xea, 0x98, 0x65, 0xcc, 0x5b, 0xfa, 0xed, 0x3b, 0xee,
-  0x01, 0x09, 0x83, 0x81, 0xd7, 0x26, 0x0e, 0x44, 0x2e, 0x05, 0x33, 0xc9,
-  0x13, 0x5a, 0x01, 0x59, 0xf5, 0xb9, 0x28, 0x18, 0x3c, 0x23, 0xbc, 0x0c,
-  0x11, 0x06, 0xde, 0x46, 0x30, 0xa7, 0x37, 0x15, 0x20, 0x91, 0x18, 0xb3,
-  0x04, 0xdf, 0x04, 0x0b, 0xac, 0x04, 0x65, 0x51, 0x2c, 0x38, 0x90, 0x82,
-  0xde, 0xc8, 0x39, 0x04, 0x20, 0xc9, 0xa2, 0x08, 0x7e, 0x83, 0x02, 0xf1,
-  0x12, 0xee, 0x05, 0x10, 0xae, 0x1e, 0x7c, 0x40, 0x3b, 0xfd, 0x65, 0x3c,
-  0x00, 0x84, 0x00, 0xff, 0x54, 0x75, 0x72, 0x62, 0x6f, 0x20, 0x43, 0xf6,
-  0x2b, 0x2b, 0x20, 0x2d, 0x05, 0xff, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67,
-  0x68, 0xff, 0x74, 0x20, 0x31, 0x39, 0x39, 0x30, 0x20, 0x42, 0xff, 0x6f,
-  0x72, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x49, 0xff, 0x6e, 0x74, 0x6c, 0x2e,
-  0x00, 0x44, 0x69, 0x76, 0xfe, 0x69, 0x64, 0x65, 0x20, 0x65, 0x72, 0x72,
-  0xdf, 0x16, 0x0d, 0x0a, 0x41, 0x62, 0xb7, 0x6e, 0x06, 0x6d, 0x61, 0xed,
-  0x6c, 0x20, 0x70, 0x0e, 0xfe, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x74, 0x65,
-  0x5e, 0x69, 0x6e, 0x61, 0xa5, 0x1f, 0xda, 0x6f, 0x6e, 0x1d, 0xf6, 0x5f,
-  0x03, 0x40, 0x3f, 0xac, 0x00, 0x72, 0x1d, 0xba, 0x34, 0xc5, 0xd3, 0xd2,
-  0x4d, 0xe1, 0xf4, 0x36, 0x0c, 0x01, 0x5e, 0x4a, 0x6f, 0x65, 0xed, 0x9f,
-  0x73, 0x65, 0xad, 0x8b, 0x65, 0xb6, 0x6f, 0xb5, 0x6f, 0xde, 0x71, 0x45,
-  0x68, 0x6c, 0xdf, 0x73, 0x74, 0x00, 0x4d, 0x61, 0xf6, 0x72, 0x6b, 0x20,
-  0x4f, 0x0a, 0xdd, 0x6e, 0x1b, 0x00, 0xfe, 0x47, 0x72, 0x65, 0x67, 0x67,
-  0x20, 0x4a, 0xd9, 0x25, 0x6e, 0x7f, 0x67, 0x73, 0x00, 0x4c, 0x6f, 0x75,
-  0xff, 0x69, 0x73, 0x20, 0x50, 0x2e, 0x20, 0x53, 0x61, 0x77, 0x37, 0x6c,
-  0x6c, 0xa0, 0x6f, 0x21, 0x41, 0x69, 0x74, 0x6b, 0xb8, 0x0f, 0x16, 0xb4,
-  0xb7, 0x39, 0x69, 0x61, 0xda, 0x20, 0x4d, 0x44, 0xfe, 0x51, 0x46, 0x6c,
-  0x6f, 0xef, 0x0d, 0x6e, 0x20, 0x58, 0x61, 0x6b, 0xe6, 0x11, 0x65, 0x00,
-  0x85, 0x2d, 0x0c, 0x6f, 0x40, 0x43, 0x4f, 0x4e, 0xf6, 0x54, 0x52, 0x49,
-  0x42, 0x6f, 0xdc, 0x68, 0x47, 0xc3, 0xea, 0x75, 0x0a, 0x66, 0xad, 0x67,
-  0x8e, 0xfb, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x43, 0x6d, 0x65, 0x5e, 0x85,
-  0x49, 0x31, 0xb6, 0x63, 0x91, 0x65, 0xdb, 0x17, 0x77, 0x5d, 0x7f, 0x68,
-  0x20, 0x41, 0x42, 0x53, 0x4f, 0xff, 0x4c, 0x55, 0x54, 0x45, 0x4c, 0x59,
-  0x20, 0x4e, 0xfd, 0x4f, 0x20, 0x57, 0x41, 0x52, 0x41, 0xbf, 0x44, 0x49,
-  0x45, 0x53, 0x2e, 0x0a, 0xb6, 0x59, 0x8e, 0x20, 0xe6, 0x2f, 0x25, 0xef,
-  0x65, 0x6c, 0x2e, 0x0a, 0x33, 0x15, 0x78, 0xb6, 0x0d, 0x64, 0x4e, 0xdb,
-  0x74, 0x79, 0x62, 0x85, 0x75, 0x40, 0x6b, 0x58, 0x46, 0x61, 0x75, 0x6f,
-  0x5a, 0x7d, 0xdc, 0x18, 0x68, 0x65, 0x22, 0x50, 0xd6, 0x50, 0x62, 0xbf,
-  0x0c, 0x0a, 0x47, 0xf6, 0x4e, 0x55, 0x20, 0x47, 0xd5, 0xb4, 0x12, 0x37,
-  0x71, 0x50, 0x75, 0x62, 0xfb, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x03, 0x5f,
-  0xf3, 0x2c, 0x6b, 0x86, 0x8a, 0x82, 0xb2, 0xfe, 0x74, 0x70, 0x3a, 0x2f,
-  0x2f, 0x77, 0xdb, 0x00, 0x2e, 0x2a, 0xad, 0x2e, 0xca, 0xb5, 0x67, 0xa2,
-  0xcd, 0xe6, 0x4b, 0x6b, 0xe5, 0xf6, 0x6d, 0x73, 0x79, 0x0b, 0x91, 0x63,
-  0x6b, 0xe1, 0xb3, 0xbb, 0x44, 0x4f, 0x53, 0x14, 0x9b, 0xbd, 0x61, 0x6d,
-  0x1f, 0x76, 0xb0, 0x4c, 0x73, 0xc1, 0xac, 0xea, 0x7f, 0x2e, 0x33, 0x2e,
-  0x32, 0x0a, 0x4f, 0x85, 0x70, 0x1f, 0x0b, 0xbf, 0x7a, 0xbb, 0x65, 0xda,
-  0x69, 0x6c, 0x28, 0x5c, 0x0c, 0x61, 0x64, 0x33, 0x41, 0x7b, 0x6f, 0x69,
-  0xd5, 0xfd, 0x62, 0x79, 0x20, 0x6d, 0x6f, 0x76, 0xec, 0x0f, 0x1c, 0x5f,
-  0x3e, 0x6d, 0x0d, 0x88, 0x73, 0x76, 0xc0, 0x67, 0x65, 0xeb, 0x9e, 0x72,
-  0x60, 0xbf, 0x28, 0x43, 0x29, 0x20, 0x32, 0x30, 0x6d, 0x00, 0x2c, 0xf2,
-  0x05, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32, 0x36, 0x32, 0x37, 0x37, 0x39,
-  0x50, 0xe1, 0x49, 0x6d, 0x08, 0xbb, 0x4c, 0x65, 0x62, 0x3c, 0x5b, 0x13,
-  0x28, 0x63, 0xde, 0x50, 0xb5, 0x4c, 0x41, 0xb0, 0x47, 0x4c, 0xcf, 0x0e,
-  0xf5, 0x09, 0x80, 0x85, 0x12, 0xf2, 0x6e, 0x63, 0x6c, 0x75, 0xd8, 0x64,
-  0xce, 0xf7, 0x4d, 0x53, 0x2d, 0xc0, 0x86, 0x3b, 0x8e, 0x70, 0x68, 0xb4,
-  0x62, 0x8b, 0x2d, 0x30, 0x79, 0xdf, 0x7a, 0x25, 0x63, 0x53, 0x4b, 0x49,
-  0xfe, 0x50, 0x48, 0x49, 0x47, 0x48, 0x20, 0x3a, 0xd0, 0x92, 0xed, 0xa9,
-  0x39, 0x1e, 0x87, 0xdb, 0xe9, 0x6f, 0xbc, 0x7b, 0x6e, 0x27, 0x74, 0x07,
-  0x82, 0x76, 0xee, 0x6e, 0x79, 0x19, 0x6d, 0xc1, 0x2e, 0xde, 0x2d, 0x4c,
-  0x43, 0x44, 0x20, 0xf6, 0x00, 0x2d, 0x55, 0x8d, 0xed, 0xbd, 0x69, 0xde,
-  0xfc, 0x34, 0x42, 0x57, 0x20, 0x86, 0xd8, 0x9a, 0x70, 0x66, 0x76, 0x05,
-  0xb1, 0x22, 0xbb, 0x21, 0x1b, 0x47, 0x30, 0x24, 0xee, 0x6a, 0x75, 0xbe,
-  0x70, 0xab, 0x66, 0x17, 0x45, 0xa5, 0x58, 0x0a, 0xd5, 0xc1, 0x62, 0x0a,
-  0xba, 0xd0, 0x44, 0x85, 0x81, 0x16, 0x12, 0x80, 0x2b, 0x09, 0x7f, 0x72,
-  0x2e, 0xb0, 0x9b, 0x6d, 0x5b, 0xd5, 0xf8, 0x43, 0x5d, 0x5b, 0x3c, 0x64,
-  0xd6, 0x99, 0xa5, 0xed, 0x3e, 0x3a, 0x09, 0xb7, 0x7b, 0x0f, 0x46, 0x7c,
-  0x6c, 0x03, 0x55, 0xd7, 0x44, 0x08, 0xd8, 0x46, 0x04, 0xcd, 0x44, 0x51,
-  0x77, 0x03, 0x43, 0x51, 0x7d, 0x68, 0x22, 0x66, 0x86, 0xf7, 0x8e, 0xbd,
-  0xef, 0x5b, 0x2d, 0x5d, 0x0c, 0xbe, 0x42, 0x04, 0x58, 0x79, 0x41, 0xfd,
-  0x46, 0x4f, 0x5d, 0x0a, 0x88, 0x4d, 0x66, 0x24, 0x07, 0x6d, 0xc7, 0x8e,
-  0x74, 0xe3, 0x0e, 0xeb, 0xcd, 0x0f, 0x34, 0x0d, 0x6f, 0x20, 0x03, 0x87,
-  0x70, 0xba, 0x43, 0x28, 0x55, 0x34, 0xdb, 0x3d, 0xed, 0x6d, 0x78, 0x85,
-  0x50, 0xec, 0xa1, 0x43, 0x32, 0x25, 0xbb, 0x02, 0x6c, 0x79, 0x24, 0xe6,
-  0x46, 0xed, 0x46, 0x75, 0x6c, 0x0c, 0x64, 0x3a, 0x85, 0x12, 0x85, 0x73,
-  0x9d, 0xc2, 0x63, 0x69, 0x26, 0x8e, 0x33, 0x62, 0x57, 0xf9, 0x4b, 0x55,
-  0xe1, 0x6e, 0x35, 0x2c, 0x3c, 0x44, 0x73, 0x2d, 0x0a, 0x70, 0x6b, 0x4f,
-  0x4d, 0x6e, 0x62, 0x3c, 0x6c, 0x0d, 0x61, 0x3b, 0x5c, 0x3a, 0xb6, 0x61,
-  0x63, 0x98, 0xca, 0x62, 0x95, 0xa1, 0xac, 0x27, 0x25, 0xd8, 0x65, 0xc9,
-  0x46, 0x1d, 0x64, 0x3b, 0x95, 0x5f, 0x38, 0x2c, 0x43, 0x99, 0xb5, 0x61,
-  0x20, 0x9b, 0x32, 0x05, 0x9b, 0xa5, 0x74, 0x7c, 0x38, 0x44, 0x81, 0x4d,
-  0x64, 0xad, 0x32, 0xb5, 0x5d, 0x99, 0x69, 0x65, 0x3e, 0xba, 0x77, 0x44,
-  0x42, 0x2d, 0x66, 0x2c, 0xdb, 0xc5, 0x61, 0xe5, 0x59, 0x50, 0x31, 0x79,
-  0x96, 0x22, 0x16, 0x07, 0x51, 0x6d, 0x51, 0x75, 0x6d, 0x38, 0x6b, 0xae,
-  0x14, 0x18, 0x09, 0xea, 0x87, 0x11, 0x0b, 0x57, 0x6f, 0x4b, 0x65, 0x6d,
-  0x09, 0x76, 0xd9, 0x51, 0x22, 0x12, 0x35, 0x2b, 0xf8, 0x16, 0x68, 0x61,
-  0x71, 0xe8, 0xcd, 0x2e, 0x52, 0x98, 0x53, 0x35, 0xf7, 0x74, 0x98, 0x82,
-  0xf0, 0x58, 0x96, 0x7f, 0x31, 0x0e, 0x6a, 0x24, 0x4d, 0x1b, 0x8b, 0x0c,
-  0x2b, 0x77, 0x4e, 0x20, 0x23, 0xdf, 0x4e, 0xa2, 0x28, 0x6d, 0xb9, 0x70,
-  0xa1, 0x49, 0x6d, 0x9a, 0x6d, 0x35, 0xba, 0x80, 0x00, 0xdf, 0x45, 0x21,
-  0x45, 0xda, 0x78, 0x74, 0x75, 0x1d, 0xeb, 0x84, 0x26, 0xbd, 0x4b, 0x97,
-  0x00, 0x44, 0x63, 0x4b, 0x44, 0xcb, 0x61, 0x74, 0x26, 0x4e, 0x28, 0xeb,
-  0x52, 0x65, 0x99, 0x61, 0x6c, 0x43, 0xa1, 0x74, 0x44, 0x36, 0x56, 0xdf,
-  0x53, 0x21, 0x53, 0x0c, 0x39, 0xdc, 0x1a, 0x73, 0x6d, 0x33, 0x29, 0x1a,
-  0x2d, 0x83, 0x4a, 0x2d, 0x6e, 0xaf, 0x75, 0x66, 0xd8, 0x11, 0x78, 0xfb,
-  0x7e, 0x73, 0xc7, 0xc2, 0x52, 0xba, 0xf5, 0x73, 0x06, 0x5b, 0x4e, 0x7e,
-  0xcd, 0xb5, 0xf3, 0xe7, 0x42, 0x5c, 0x52, 0x3d, 0xd1, 0x5f, 0xcb, 0x3f,
-  0x81, 0xe3, 0x75, 0xbc, 0xf7, 0x61, 0x66, 0x05, 0x84, 0x9d, 0x10, 0x62,
-  0xfc, 0xf9, 0x2b, 0x58, 0xb0, 0x41, 0x6c, 0x6d, 0x1a, 0x79, 0xb6, 0x29,
-  0x61, 0x26, 0xb5, 0x2b, 0xd8, 0x18, 0x63, 0x61, 0x7e, 0xc6, 0x65, 0x78,
-  0x69, 0xd7, 0x3d, 0x21, 0xce, 0x41, 0xb4, 0xd7, 0x70, 0x7c, 0x39, 0x0d,
-  0xa0, 0x52, 0xf1, 0xad, 0xcb, 0x76, 0x37, 0x9a, 0x0e, 0xb5, 0x40, 0xf6,
-  0x57, 0x63, 0x4b, 0x63, 0x03, 0xa4, 0x4f, 0xc1, 0xc1, 0x0f, 0x11, 0x60,
-  0x75, 0x65, 0xfe, 0xce, 0x53, 0x7b, 0x6a, 0xce, 0x70, 0x02, 0x73, 0x3e,
-  0x40, 0x60, 0x76, 0xe6, 0xcb, 0x44, 0xda, 0x68, 0xb0, 0xf8, 0x3a, 0x64,
-  0x33, 0x82, 0x4e, 0x3e, 0xb3, 0xd6, 0x0c, 0xa4, 0xd0, 0xb6, 0x76, 0xe9,
-  0x6b, 0x73, 0xdc, 0x47, 0x54, 0x79, 0x2a, 0x9a, 0xc3, 0x7c, 0x68, 0x21,
-  0x10, 0x61, 0x40, 0xf4, 0x58, 0x61, 0xc0, 0x5d, 0x40, 0x76, 0xe1, 0x2e,
-  0x67, 0x2d, 0x85, 0x33, 0xb6, 0xf8, 0x6e, 0x0f, 0xac, 0x64, 0x34, 0x2c,
-  0x15, 0x17, 0xea, 0x5a, 0x72, 0x3a, 0x26, 0x90, 0x68, 0xcd, 0x90, 0x2b,
-  0xe1, 0x6d, 0xf2, 0xd6, 0x69, 0x58, 0x3a, 0x87, 0x43, 0xc0, 0x2b, 0x43,
-  0x73, 0x81, 0x13, 0x0b, 0xb7, 0x3a, 0x20, 0x25, 0x73, 0x6c, 0x03, 0x45,
-  0x5e, 0x64, 0xd6, 0x38, 0x0a, 0xda, 0x21, 0x0b, 0x2d, 0x7d, 0x6b, 0xe0,
-  0x68, 0x60, 0x64, 0x43, 0xa5, 0xb7, 0x28, 0x14, 0x29, 0x00, 0x84, 0x57,
-  0x32, 0xec, 0x3a, 0x14, 0x36, 0x13, 0x81, 0xbd, 0x00, 0xdd, 0x3c, 0xff,
-  0xe2, 0xff, 0x00, 0x09, 0xdb, 0x3b, 0x04, 0x03, 0xa6, 0x08, 0x9a, 0x11,
-  0x1a, 0x69, 0x26, 0xa6, 0x32, 0x60, 0x7b, 0xdb, 0x00, 0x02, 0x2f, 0xdf,
-  0x32, 0x20, 0x08, 0x44, 0x12, 0xa5, 0xc4, 0x51, 0xd6, 0xfe, 0x77, 0x60,
-  0xb5, 0x3e, 0xb6, 0x48, 0x77, 0x55, 0xf6, 0x53, 0x74, 0x64, 0x0b, 0x4f,
-  0x33, 0x38, 0x36, 0xcb, 0x00, 0x4c, 0x75, 0xbf, 0x78, 0x2a, 0x45, 0x4d,
-  0x8b, 0x55, 0xaf, 0x6d, 0xf5, 0x5d, 0xdd, 0xf0, 0x4c, 0x47, 0xe0, 0x70,
-  0x07, 0x15, 0x72, 0xbf, 0x43, 0x35, 0x2f, 0x39, 0x33, 0x00, 0xb3, 0x24,
-  0x1d, 0xb4, 0x24, 0xb8, 0x19, 0x0c, 0x8d, 0xc3, 0x1a, 0x2b, 0x11, 0xa9,
-  0xb4, 0x66, 0x0d, 0x49, 0xf2, 0x89, 0xe3, 0x47, 0x64, 0xd9, 0x77, 0x56,
-  0xc5, 0x21, 0x85, 0x5b, 0xda, 0x63, 0xbc, 0x0e, 0x58, 0x1c, 0x0b, 0xc3,
-  0x26, 0x64, 0x1e, 0x18, 0x46, 0xf4, 0x61, 0xdd, 0x8e, 0x50, 0x4d, 0xb9,
-  0x6b, 0x68, 0x6f, 0x9c, 0x29, 0x3d, 0x39, 0x6b, 0x1c, 0x55, 0x76, 0x84,
-  0x0a, 0x97, 0xdd, 0x96, 0x03, 0xa6, 0x34, 0xb7, 0xd3, 0xc8, 0x4d, 0xdb,
-  0xf4, 0x36, 0x01, 0x0b, 0x59, 0x16, 0x9f, 0x23, 0x25, 0x75, 0x07, 0x4d,
-  0xd3, 0x03, 0x6b, 0x4d, 0x80, 0xab, 0x34, 0xbe, 0xd3, 0xdc, 0x4d, 0xf5,
-  0x0e, 0x96, 0x0c, 0x27, 0x69, 0x3d, 0xa6, 0x4c, 0x9a, 0x5b, 0x71, 0x69,
-  0x85, 0xa6, 0xa3, 0x9a, 0xc3, 0xea, 0x6c, 0x08, 0x0d, 0xb3, 0x21, 0x4d,
-  0x3b, 0x6a, 0x35, 0x8f, 0xd3, 0x0f, 0xb1, 0x4d, 0xce, 0xe7, 0x34, 0xfc,
-  0xd9, 0x1b, 0x0e, 0x3b, 0x33, 0x07, 0xae, 0x4e, 0x03, 0x98, 0x6a, 0x0a,
-  0x96, 0x18, 0xf9, 0x0d, 0xda, 0x64, 0x7a, 0xe3, 0x6a, 0x0e, 0x6d, 0x3b,
-  0x68, 0x73, 0x6b, 0x0c, 0x2e, 0x0d, 0xfe, 0x46, 0x6b, 0x6c, 0x0f, 0xe3,
-  0x77, 0x33, 0x53, 0xe5, 0x33, 0x10, 0xb5, 0x4d, 0x24, 0xa9, 0x05, 0x4c,
-  0xd6, 0x15, 0x86, 0x60, 0x86, 0x65, 0xa1, 0x62, 0x1c, 0x39, 0x07, 0x8a,
-  0x35, 0x71, 0x18, 0x92, 0x35, 0x95, 0xfd, 0xa1, 0x19, 0x3e, 0x93, 0x52,
-  0x40, 0x73, 0x8e, 0x0e, 0x00, 0x4e, 0x19, 0x3e, 0xa9, 0x26, 0x63, 0xae,
-  0x76, 0x38, 0x6a, 0x25, 0x45, 0xfc, 0x6a, 0xae, 0xf6, 0xe0, 0x4d, 0xb5,
-  0x8a, 0xb2, 0x7f, 0x73, 0x63, 0xd2, 0x5b, 0x6a, 0x75, 0xbe, 0x70, 0x5c,
-  0x56, 0xb3, 0xf7, 0x0e, 0x76, 0xd6, 0xa6, 0x67, 0xdc, 0x69, 0x56, 0x9f,
-  0x66, 0x28, 0x63, 0x0a, 0x71, 0x8e, 0x8e, 0x0d, 0x7e, 0x64, 0x74, 0x2f,
-  0x21, 0x6f, 0x93, 0x46, 0x41, 0x54, 0xde, 0x33, 0x32, 0x26, 0xd9, 0x3b,
-  0x75, 0x5c, 0x50, 0xd6, 0x85, 0x73, 0xf2, 0x75, 0x70, 0x70, 0xbd, 0x45,
-  0x9d, 0x54, 0x68, 0xb1, 0x83, 0x6b, 0x22, 0xc4, 0x86, 0x95, 0x72, 0x14,
-  0x54, 0x0b, 0xb7, 0xd8, 0x64, 0x32, 0x8e, 0xfd, 0x52, 0x3f, 0x60, 0xf0,
-  0xee, 0xa9, 0xd8, 0x54, 0x1a, 0x6c, 0xe4, 0xf2, 0x28, 0xba, 0xf7, 0x02,
-  0x59, 0x39, 0xe2, 0xb6, 0xd6, 0x67, 0x13, 0x6c, 0x12, 0x36, 0x3d, 0x5b,
-  0xf6, 0x16, 0x1b, 0x69, 0x44, 0x56, 0x6e, 0xb2, 0x1d, 0x18, 0x64, 0xd8,
-  0x38, 0x77, 0x90, 0x62, 0x56, 0x07, 0xd9, 0x70, 0x18, 0x60, 0x7b, 0xb1,
-  0x6c, 0x18, 0x02, 0x45, 0xec, 0xbc, 0x17, 0xe0, 0x73, 0x60, 0x39, 0xb8,
-  0x01, 0x46, 0x53, 0x3f, 0x64, 0x6f, 0x63, 0x58, 0xe0, 0xb0, 0xbc, 0xde,
-  0x15, 0xf6, 0x28, 0x0e, 0x03, 0x73, 0x25, 0xa3, 0xac, 0x5f, 0x5f, 0x78,
-  0x43, 0xb8, 0xb9, 0x0f, 0x81, 0x15, 0xb9, 0x9c, 0x2a, 0x05, 0xf6, 0x54,
-  0x13, 0x16, 0x19, 0x3b, 0xa1, 0xba, 0x3c, 0xe1, 0x6c, 0xd3, 0xec, 0x72,
-  0x1d, 0x21, 0x06, 0xd5, 0x58, 0x48, 0x42, 0x10, 0xa2, 0x40, 0x68, 0x19,
-  0x61, 0xe6, 0x4b, 0x4c, 0x1d, 0x73, 0x91, 0xdb, 0xb2, 0x45, 0x42, 0x6d,
-  0x21, 0x49, 0x23, 0x64, 0x1e, 0xb2, 0x18, 0xc6, 0x7f, 0x6c, 0x19, 0x09,
-  0x65, 0x77, 0x83, 0x57, 0xd9, 0xc0, 0x61, 0xc2, 0x98, 0x2e, 0x06, 0x36,
-  0x11, 0x64, 0x15, 0x46, 0x91, 0x2b, 0xde, 0x74, 0xad, 0xc8, 0xa4, 0x5a,
-  0x9a, 0xac, 0xea, 0x5a, 0x20, 0x13, 0x41, 0x74, 0x35, 0x61, 0x61, 0xaf,
-  0x6a, 0xc4, 0x83, 0x78, 0x7c, 0xb3, 0xb6, 0x64, 0x3e, 0x2c, 0x1d, 0x59,
-  0x18, 0x87, 0xbf, 0xc9, 0x72, 0x65, 0x29, 0x44, 0x3b, 0x52, 0x10, 0x21,
-  0x07, 0x50, 0x21, 0x5c, 0x86, 0x44, 0x8d, 0xb0, 0x1d, 0xa0, 0x29, 0x64,
-  0x4c, 0x6f, 0x81, 0x1e, 0x0b, 0xc0, 0x17, 0x36, 0xc4, 0x6c, 0x51, 0x03,
-  0x1b, 0x0f, 0x71, 0xb5, 0x75, 0xa9, 0xb0, 0x81, 0x29, 0x81, 0x2e, 0x22,
-  0xd4, 0x23, 0x61, 0xcc, 0x61, 0xcd, 0xbd, 0x25, 0x64, 0x25, 0x25, 0x19,
-  0x10, 0x60, 0xda, 0x6e, 0x3a, 0xf7, 0xd1, 0x35, 0xb2, 0x23, 0xd4, 0xd4,
-  0x46, 0x4e, 0x64, 0x28, 0xb3, 0x6d, 0x6b, 0x4b, 0x62, 0x50, 0xb0, 0xc8,
-  0x61, 0xae, 0x66, 0x1b, 0xb0, 0x4f, 0x18, 0x38, 0x6d, 0xbb, 0xf7, 0x6f,
-  0x64, 0x00, 0xe2, 0xaf, 0x76, 0x41, 0x34, 0x06, 0xc2, 0x2a, 0xba, 0x75,
-  0x32, 0x27, 0x45, 0x9a, 0xd2, 0xf6, 0x4f, 0x59, 0x41, 0xa1, 0xf1, 0x2d,
-  0x85, 0x24, 0x68, 0x40, 0xdd, 0x16, 0x2a, 0x55, 0xa9, 0xdc, 0x2c, 0x49,
-  0xd3, 0xb1, 0x69, 0x61, 0x38, 0x5c, 0x63, 0x1c, 0x11, 0xb5, 0x60, 0x94,
-  0xad, 0x34, 0x71, 0x21, 0xd9, 0xb2, 0x47, 0x04, 0x5d, 0xdb, 0x6c, 0x0c,
-  0xa4, 0xc2, 0x2b, 0x42, 0xdb, 0xd3, 0x62, 0x7e, 0x2f, 0xba, 0x70, 0x8f,
-  0xb2, 0xfe, 0x6d, 0x2e, 0x00, 0x13, 0xae, 0x8e, 0x96, 0x75, 0x0c, 0x6e,
-  0x68, 0x22, 0x12, 0xc2, 0x43, 0xa2, 0x8c, 0x99, 0x43, 0xb2, 0xb4, 0xcf,
-  0x0e, 0x93, 0xa4, 0xc7, 0x24, 0x09, 0x9e, 0x2d, 0x0b, 0x73, 0x48, 0x0d,
-  0x25, 0x08, 0x7f, 0xd3, 0x63, 0x69, 0xb6, 0x03, 0x75, 0xd0, 0x45, 0x08,
-  0xd5, 0x30, 0x00, 0x0b, 0xb0, 0x00, 0xd6, 0x42, 0x57, 0x0b, 0xf7, 0x30,
-  0x00, 0x20, 0x6e, 0x8b, 0x93, 0x5c, 0x83, 0xf0, 0x5e, 0x33, 0xb2, 0xaf,
-  0x63, 0x25, 0x7e, 0x52, 0xe7, 0x4b, 0xa9, 0xb8, 0x4c, 0x4f, 0x47, 0xbc,
-  0x38, 0x17, 0x82, 0xe0, 0x4e, 0x11, 0xdb, 0x5f, 0x70, 0x03, 0xa6, 0x72,
-  0xb0, 0x7b, 0x0b, 0x66, 0x92, 0x90, 0x9f, 0x66, 0xad, 0x9a, 0xc5, 0xe7,
-  0x69, 0x6f, 0xb2, 0x12, 0x12, 0xe4, 0x29, 0x12, 0xe6, 0x52, 0x90, 0x67,
-  0x66, 0x89, 0x99, 0xa8, 0x41, 0x06, 0x72, 0xb3, 0x02, 0xdd, 0x03, 0x0c,
-  0x5d, 0x0d, 0xdd, 0x00, 0x0e, 0x05, 0x0f, 0xcd, 0x00, 0x10, 0x11, 0xdb,
-  0x00, 0x12, 0xa1, 0x65, 0xb4, 0x67, 0xce, 0x61, 0x99, 0x6c, 0x00, 0x9f,
-  0x41, 0x4c, 0x54, 0x2d, 0xe0, 0x42, 0x00, 0x2d, 0xd1, 0x06, 0xe1, 0xd8,
-  0x36, 0xc2, 0x7c, 0x00, 0xbe, 0x16, 0x46, 0x9c, 0x10, 0x3b, 0x06, 0x0c,
-  0xe9, 0x4d, 0x8c, 0x55, 0xc3, 0x99, 0x02, 0x6c, 0x6e, 0x1a, 0x60, 0x41,
-  0x3d, 0x4d, 0x08, 0x2e, 0x5b, 0x17, 0xf0, 0x65, 0x58, 0x5a, 0x36, 0xc2,
-  0x00, 0x17, 0x76, 0xc2, 0x58, 0x2f, 0xb3, 0x99, 0x0e, 0x31, 0xc2, 0x9e,
-  0xc3, 0x95, 0x83, 0xab, 0x30, 0x09, 0x2a, 0xb6, 0x2a, 0x43, 0x26, 0x05,
-  0x6b, 0x71, 0x16, 0x08, 0xda, 0xa6, 0xcb, 0x1a, 0xb2, 0x6f, 0xc1, 0xb7,
-  0x28, 0x54, 0x53, 0x8d, 0xfc, 0x79, 0x26, 0xd9, 0xa4, 0x3c, 0xdc, 0x14,
-  0xdb, 0x1b, 0x77, 0x3b, 0xc1, 0xed, 0x66, 0xdd, 0xdb, 0x79, 0x6d, 0xc9,
-  0x6c, 0x78, 0xc0, 0x9d, 0x4e, 0xd7, 0x3c, 0x73, 0x21, 0x09, 0x1e, 0x86,
-  0x74, 0xa9, 0x2f, 0x59, 0x60, 0x88, 0xc3, 0x85, 0x4c, 0xf9, 0x35, 0x82,
-  0xf5, 0x7e, 0x45, 0x33, 0x37, 0x1b, 0xd9, 0xfe, 0x0a, 0xc5, 0x11, 0xec,
-  0x60, 0x00, 0x20, 0x42, 0xab, 0xe1, 0x36, 0x13, 0xc9, 0x6e, 0x44, 0x03,
-  0x9a, 0x4f, 0x5c, 0x69, 0x6b, 0xa6, 0x7e, 0x9b, 0x96, 0xf6, 0x12, 0x28,
-  0xff, 0x39, 0x07, 0x00, 0x17, 0x00, 0xbb, 0x05, 0x05, 0x46, 0x00, 0x1b,
-  0x48, 0x03, 0x75, 0x0f, 0x43, 0xd9, 0x1b, 0xb2, 0x35, 0x66, 0x07, 0x11,
-  0x91, 0x89, 0x16, 0x0b, 0x2c, 0x00, 0x5a, 0x8f, 0x12, 0x23, 0x41, 0x20,
-  0xf2, 0x46, 0xa4, 0x85, 0xba, 0x00, 0x90, 0xaf, 0x38, 0x3a, 0x42, 0x3d,
-  0x2c, 0x25, 0xa9, 0x0a, 0x5e, 0x13, 0x06, 0x00, 0x37, 0xea, 0x05, 0x05,
-  0x6c, 0x17, 0x6a, 0x14, 0x2e, 0x2f, 0x42, 0x37, 0x29, 0xbd, 0x43, 0x50,
-  0x8c, 0x7c, 0x63, 0x6d, 0xd0, 0x25, 0x4a, 0x95, 0xd8, 0x49, 0x2d, 0x30,
-  0xbc, 0x15, 0x7a, 0xba, 0x1d, 0xac, 0x66, 0xe4, 0xc8, 0x1b, 0x40, 0x64,
-  0xfc, 0xad, 0x25, 0x13, 0xa0, 0xdb, 0x79, 0x67, 0xb1, 0x72, 0x21, 0xd7,
-  0xee, 0x34, 0xb2, 0x28, 0xdd, 0x7e, 0x58, 0x64, 0x54, 0x0b, 0xb1, 0xa2,
-  0x61, 0xd9, 0xf3, 0x77, 0xd4, 0x82, 0x42, 0x2e, 0x25, 0x6b, 0x1f, 0x34,
-  0x66, 0x62, 0xb5, 0x62, 0x55, 0x81, 0x38, 0xc5, 0x28, 0xc1, 0x15, 0xb0,
-  0x50, 0xcc, 0xae, 0x3e, 0x42, 0x81, 0x76, 0x29, 0x5e, 0xc8, 0x72, 0x5b,
-  0x50, 0x16, 0x0e, 0xb8, 0x4a, 0x0e, 0x18, 0xf6, 0x99, 0x22, 0xc9, 0x77,
-  0x16, 0x2f, 0x46, 0x1b, 0xb2, 0x6e, 0x21, 0x42, 0x92, 0x40, 0xaf, 0x8c,
-  0x16, 0x0b, 0x67, 0x1c, 0x0d, 0x7b, 0x9d, 0x63, 0x07, 0x03, 0xcc, 0x00,
-  0xaa, 0xbe, 0x9b, 0x1a, 0x6d, 0xd2, 0x3a, 0xa1, 0x0b, 0x8f, 0x5f, 0x00,
-  0xb3, 0x64, 0x15, 0xc8, 0x01, 0x0c, 0xb8, 0x93, 0x02, 0x20, 0x32, 0xc2,
-  0x4c, 0x03, 0x80, 0xc9, 0xce, 0x32, 0x04, 0x03, 0xd3, 0x60, 0x6d, 0x39,
-  0xef, 0x3b, 0x64, 0x02, 0x64, 0xdd, 0x05, 0x97, 0x15, 0x18, 0x73, 0x4f,
-  0xd1, 0x69, 0x12, 0x55, 0x1b, 0xe8, 0x21, 0xb6, 0xee, 0x39, 0x03, 0xdc,
-  0x0d, 0x0b, 0x04, 0xfc, 0x86, 0x20, 0xcd, 0x10, 0x66, 0x42, 0xdb, 0x0c,
-  0x75, 0xe4, 0x54, 0x9c, 0x47, 0x6e, 0x16, 0x38, 0xad, 0xf2, 0x05, 0x82,
-  0x1b, 0x34, 0x56, 0x12, 0xfb, 0x4c, 0x00, 0x58, 0x9f, 0xc1, 0x61, 0x20,
-  0xb9, 0xa6, 0x37, 0x64, 0x0a, 0xc0, 0x20, 0x88, 0x56, 0x2f, 0xa5, 0x06,
-  0x54, 0x82, 0x5a, 0x31, 0x63, 0xcd, 0x4c, 0x98, 0x5b, 0x24, 0xf7, 0x11,
-  0x98, 0x79, 0x18, 0x27, 0x28, 0xc7, 0x54, 0xf8, 0x25, 0xba, 0x84, 0xa9,
-  0x28, 0xd6, 0xff, 0x56, 0x17, 0x09, 0x86, 0x18, 0x27, 0x24, 0x76, 0xe7,
-  0xd5, 0x3e, 0x16, 0x09, 0x09, 0x46, 0x99, 0xc9, 0x15, 0x90, 0x01, 0x19,
-  0xab, 0x26, 0x02, 0x40, 0x64, 0xc1, 0x99, 0x03, 0x01, 0x92, 0xcd, 0x64,
-  0x04, 0x06, 0xdf, 0x49, 0x90, 0x05, 0x19, 0xf6, 0x26, 0x06, 0x40, 0x72,
-  0x02, 0x19, 0x1c, 0x07, 0x80, 0xc9, 0x0c, 0x32, 0x08, 0x5b, 0xc5, 0x29,
-  0xb2, 0x03, 0x41, 0x16, 0xc5, 0x76, 0x03, 0x41, 0x43, 0x02, 0x60, 0x2b,
-  0x6e, 0x23, 0xf3, 0x4c, 0x00, 0x16, 0x00, 0xdd, 0x1f, 0x21, 0xd4, 0xb6,
-  0x3c, 0x03, 0x14, 0x2f, 0x2b, 0x02, 0xce, 0x58, 0x31, 0x4e, 0x82, 0x00,
-  0xf1, 0xf0, 0x20, 0x22, 0x7a, 0x00, 0x55, 0x12, 0x95, 0xe4, 0x46, 0x96,
-  0x27, 0xa1, 0x7c, 0x2c, 0x4a, 0x5a, 0x84, 0x63, 0x8d, 0x84, 0x11, 0xa1,
-  0x41, 0x2c, 0x0a, 0x3b, 0x84, 0x28, 0xb8, 0x00, 0x8c, 0xe9, 0x36, 0x15,
-  0x8b, 0xf6, 0x29, 0x0c, 0xcc, 0x3c, 0x2b, 0x18, 0xe9, 0x13, 0x20, 0x6d,
-  0x5c, 0x6f, 0x78, 0x46, 0x0e, 0x59, 0x10, 0xb0, 0x0b, 0x6d, 0x5c, 0x73,
-  0xc2, 0x27, 0x62, 0x00, 0xb2, 0x95, 0x1a, 0x79, 0xda, 0x4f, 0x72, 0xc5,
-  0x19, 0x81, 0xca, 0xc9, 0x66, 0x75, 0x4d, 0xc2, 0x8c, 0x92, 0xca, 0xf3,
-  0x74, 0x6f, 0xb4, 0x29, 0x0c, 0xaa, 0xcb, 0x1b, 0x46, 0x1c, 0x5b, 0x21,
-  0x21, 0xd7, 0x50, 0x6c, 0x6d, 0xb0, 0x1e, 0x34, 0x3b, 0x6a, 0x4a, 0xd1,
-  0x96, 0x45, 0xcb, 0x46, 0x57, 0x4b, 0xb0, 0x3f, 0x98, 0x2c, 0x4d, 0x08,
-  0xce, 0xb0, 0xf7, 0x78, 0x19, 0x1d, 0x1a, 0x9a, 0x3e, 0xbc, 0x87, 0x12,
-  0x3a, 0xc1, 0x75, 0x73, 0x55, 0xa6, 0xa2, 0x54, 0x90, 0xfd, 0xd9, 0x26,
-  0x13, 0x28, 0xe1, 0x20, 0x29, 0x20, 0xc4, 0x2b, 0x78, 0x15, 0x40, 0xc8,
-  0xb7, 0x19, 0x84, 0xcc, 0x0d, 0xe1, 0x0f, 0xd0, 0x2b, 0x78, 0x15, 0x42,
-  0xd4, 0x17, 0x1a, 0x84, 0xd8, 0xb4, 0x85, 0xb5, 0x18, 0xb0, 0xde, 0x23,
-  0xd3, 0x00, 0x19, 0x27, 0x71, 0x1f, 0x00, 0x0b, 0x8e, 0xc1, 0xa8, 0x1b,
-  0x5c, 0x48, 0x41, 0x6c, 0xe7, 0x04, 0xc3, 0xf1, 0x73, 0x2c, 0x42, 0xb0,
-  0x00, 0xad, 0xa2, 0x23, 0xf4, 0x3b, 0xf3, 0x05, 0x03, 0x30, 0x00, 0x8b,
-  0x18, 0x88, 0x60, 0x11, 0x16, 0x1a, 0xaa, 0x0b, 0x79, 0xd1, 0x25, 0x35,
-  0x6d, 0x30, 0x93, 0x0a, 0x65, 0x07, 0x4b, 0x0d, 0x66, 0x09, 0x92, 0x06,
-  0x6c, 0x48, 0xbd, 0x76, 0x1c, 0x1c, 0x05, 0xbe, 0x03, 0x29, 0x6d, 0x4f,
-  0x6b, 0xb0, 0x76, 0x4d, 0x0d, 0x56, 0x67, 0x78, 0x71, 0x5b, 0x1e, 0x63,
-  0x82, 0x5a, 0x10, 0x29, 0x77, 0x30, 0xc2, 0x31, 0x9d, 0xa1, 0xb7, 0x07,
-  0xa4, 0x29, 0x3e, 0xdb, 0x1c, 0xab, 0x5a, 0xa9, 0x44, 0xe7, 0x0e, 0xb9,
-  0xe9, 0x15, 0x01, 0x19, 0x01, 0x01, 0xb2, 0xc6, 0x2b, 0x6c, 0x02, 0x15,
-  0x06, 0xdd, 0x6a, 0x1e, 0xea, 0xbf, 0x17, 0x1a, 0x6d, 0x22, 0x41, 0xbb,
-  0xb8, 0x13, 0x9e, 0x43, 0x6b, 0x03, 0x9f, 0xd5, 0x9a, 0x79, 0xb0, 0x76,
-  0xba, 0x00, 0x3d, 0x0f, 0x48, 0x02, 0x62, 0xbc, 0x51, 0x52, 0x96, 0x89,
-  0xee, 0xde, 0x9b, 0xc3, 0x16, 0xaa, 0x20, 0x61, 0x6d, 0x4a, 0x2f, 0x9a,
-  0xa6, 0x77, 0xd7, 0xa8, 0x0c, 0x42, 0x72, 0x31, 0x0a, 0xbe, 0x34, 0x62,
-  0x89, 0xdf, 0x85, 0x92, 0x57, 0x24, 0x8e, 0x28, 0xeb, 0x44, 0xae, 0x0b,
-  0x6a, 0x57, 0x86, 0xde, 0x76, 0xd9, 0x76, 0x1d, 0xdb, 0xb3, 0x0f, 0x07,
-  0xa4, 0x7f, 0x68, 0x14, 0xe9, 0x3f, 0x29, 0x07, 0x89, 0x1d, 0x2e, 0xf4,
-  0x44, 0x4d, 0x42, 0xe8, 0x0b, 0xb8, 0xc6, 0xbc, 0xda, 0x67, 0x97, 0xd4,
-  0x09, 0x1a, 0x59, 0xe7, 0xdc, 0x50, 0x49, 0x64, 0xd9, 0x00, 0x0f, 0x2d,
-  0x9c, 0x18, 0x89, 0x06, 0x85, 0xb4, 0xb0, 0x3f, 0xb2, 0xa1, 0x64, 0x50,
-  0x84, 0x22, 0xb7, 0xbf, 0x8c, 0xde, 0x2c, 0x12, 0x7b, 0x5c, 0x00, 0x12,
-  0x7a, 0x00, 0x8c, 0xd7, 0x03, 0xe4, 0x49, 0x00, 0x13, 0x88, 0x41, 0xb3,
-  0x0d, 0x03, 0x48, 0x14, 0xe2, 0x96, 0x1e, 0xb6, 0x8d, 0x46, 0x2f, 0x23,
-  0x1d, 0xed, 0x48, 0x28, 0xbc, 0xe5, 0x02, 0xd1, 0x8b, 0x06, 0x82, 0x3f,
-  0xe1, 0xcc, 0x1e, 0x55, 0xfc, 0x0a, 0x00, 0xd1, 0x1e, 0x9c, 0x08, 0xd6,
-  0x08, 0x35, 0x33, 0xd0, 0x4d, 0xf6, 0x05, 0x35, 0x59, 0x70, 0x0f, 0x38,
-  0x4a, 0x38, 0xe8, 0x67, 0xe1, 0xc1, 0x63, 0x70, 0x72, 0xbd, 0x94, 0x27,
-  0x30, 0x6b, 0xac, 0x65, 0xd5, 0x5a, 0x51, 0x15, 0x4b, 0xf0, 0x0f, 0x00,
-  0x91, 0x00, 0x80, 0xd0, 0xb7, 0x5c, 0x42, 0x01, 0x64, 0x5a, 0x34, 0x07,
-  0xa9, 0x14, 0xac, 0xb8, 0x08, 0x1a, 0x77, 0x99, 0x9e, 0x87, 0x3a, 0x3f,
-  0x19, 0x26, 0x50, 0xb0, 0x65, 0x58, 0x4b, 0xc3, 0x70, 0x4e, 0xb7, 0xdb,
-  0xa8, 0x1f, 0x27, 0xb1, 0x9e, 0x1f, 0x07, 0xeb, 0x01, 0x43, 0x0d, 0x84,
-  0xf7, 0x27, 0xb6, 0x11, 0x69, 0x14, 0x48, 0x03, 0x31, 0x86, 0xe1, 0x31,
-  0xf7, 0x68, 0x57, 0x9b, 0x30, 0x58, 0x4d, 0x84, 0x53, 0xa8, 0xc5, 0x2b,
-  0x28, 0xa5, 0x40, 0xcc, 0xea, 0xf7, 0xb1, 0x5e, 0x81, 0x30, 0x59, 0xe0,
-  0x64, 0xcd, 0x77, 0x08, 0x30, 0x8f, 0x4b, 0xa0, 0x6d, 0x45, 0x3a, 0x33,
-  0x01, 0x41, 0xa8, 0x2e, 0x3d, 0x5b, 0x49, 0x12, 0xd1, 0x6c, 0xcf, 0xbd,
-  0xe7, 0x75, 0x51, 0x79, 0x52, 0x17, 0xb4, 0x24, 0x18, 0xd9, 0x69, 0xf9,
-  0xd4, 0x3b, 0x13, 0xcc, 0x21, 0x50, 0xa8, 0xe5, 0x66, 0x8e, 0xe2, 0x6c,
-  0x42, 0xd0, 0x78, 0x91, 0x1d, 0x91, 0x57, 0xf1, 0xb0, 0x82, 0xd8, 0x2d,
-  0xc1, 0x2c, 0xca, 0x76, 0x6b, 0x02, 0x74, 0x5e, 0x3d, 0x73, 0x6c, 0x28,
-  0x91, 0x40, 0x69, 0x1e, 0x69, 0x73, 0x68, 0x7b, 0x63, 0xec, 0x04, 0x21,
-  0x6d, 0x46, 0x10, 0x15, 0x5c, 0xb0, 0xba, 0xb2, 0x72, 0x30, 0xab, 0x1b,
-  0x03, 0x48, 0x34, 0x87, 0x76, 0x20, 0x64, 0x00, 0x43, 0x46, 0xe1, 0x31,
-  0x20, 0x3d, 0x61, 0x47, 0x9a, 0xb9, 0x6c, 0x95, 0x00, 0x08, 0x03, 0x08,
-  0x0b, 0x47, 0x37, 0x86, 0x56, 0x5a, 0xbf, 0xe8, 0x08, 0x4c, 0x07, 0x1f,
-  0x61, 0x62, 0xc5, 0x45, 0x28, 0x90, 0xf4, 0xc4, 0x7a, 0xe0, 0x5e, 0x91,
-  0x30, 0x30, 0x3a, 0xc5, 0x02, 0x08, 0x1f, 0x02, 0x01, 0x4f, 0xd5, 0xea,
-  0xef, 0xf5, 0xa4, 0x7a, 0x8b, 0x75, 0xe8, 0x61, 0xda, 0x85, 0xa6, 0x48,
-  0xd3, 0xca, 0x3f, 0xd8, 0xc3, 0x62, 0xa5, 0xa4, 0xb9, 0x6b, 0xc9, 0xb4,
-  0x00, 0x30, 0x09, 0x1e, 0x20, 0x13, 0x4e, 0x7c, 0x3e, 0x57, 0xca, 0xf7,
-  0xa5, 0x3e, 0x80, 0x64, 0x4e, 0x08, 0x4c, 0x62, 0x59, 0x62, 0x2a, 0x44,
-  0x88, 0x67, 0x64, 0x53, 0x27, 0x37, 0x54, 0x20, 0x58, 0x9d, 0xc8, 0xf2,
-  0xfd, 0x32, 0x10, 0xed, 0x30, 0x25, 0x35, 0x66, 0x79, 0xc8, 0x22, 0x3e,
-  0x46, 0x25, 0x64, 0xeb, 0xa6, 0x25, 0x9c, 0x62, 0xdb, 0xb5, 0x16, 0xad,
-  0x02, 0x30, 0x07, 0xb3, 0xda, 0xb1, 0x93, 0xd6, 0xd4, 0xe2, 0xb5, 0xa5,
-  0xcb, 0x83, 0x19, 0x72, 0xce, 0x22, 0x0c, 0x22, 0xe0, 0xe0, 0xb1, 0x60,
-  0xa7, 0xb2, 0x00, 0xff, 0xff, 0xff, 0x5b, 0x2d, 0x3f, 0x2d, 0xf6, 0x5d,
-  0x00, 0x5b, 0xfe, 0x03, 0xf1, 0xff, 0xff, 0x00, 0x84, 0x52, 0x58, 0x7a,
-  0xec, 0x00, 0x70, 0xac, 0x5b, 0x33, 0x23, 0x6d, 0x61, 0x41, 0xd9, 0x03,
-  0x83, 0x24, 0x41, 0x83, 0x60, 0x68, 0x73, 0x1c, 0x72, 0x41, 0x18, 0x19,
-  0x55, 0x1a, 0x2c, 0xee, 0x2e, 0x2c, 0xa3, 0x62, 0x05, 0x25, 0xef, 0xd2,
-  0x21, 0x88, 0x14, 0x30, 0x50, 0x38, 0x78, 0x8e, 0x7a, 0x57, 0xff, 0x26,
-  0x35, 0xa7, 0x30, 0xd4, 0x51, 0xe0, 0x95, 0x19, 0xab, 0xd8, 0x50, 0x75,
-  0x2e, 0x4c, 0x54, 0x23, 0x5e, 0x4f, 0x85, 0x4b, 0xcd, 0xa8, 0x25, 0xd7,
-  0x4d, 0x03, 0x4d, 0x97, 0xad, 0x34, 0xb9, 0xd3, 0xcb, 0x4d, 0xe2, 0xee,
-  0x34, 0xf8, 0xd9, 0x0b, 0x26, 0x66, 0x1d, 0x9a, 0x2d, 0x3e, 0x69, 0x4f,
-  0xa6, 0x62, 0x9a, 0x7b, 0x88, 0x69, 0x9d, 0xa6, 0x0b, 0x9a, 0xac, 0xd4,
-  0x69, 0xf2, 0xb2, 0x07, 0x27, 0xcd, 0x32, 0x45, 0x34, 0x63, 0xd3, 0x7c,
-  0x4d, 0x95, 0xae, 0x34, 0xc4, 0xd3, 0xd3, 0x4d, 0xe2, 0xf8, 0x36, 0x0c,
-  0x28, 0x59, 0x2a, 0xa6, 0x4a, 0x9a, 0x71, 0x8f, 0x69, 0xa8, 0xa6, 0xc2,
-  0x9b, 0xf1, 0x16, 0x29, 0x2c, 0x38, 0xd3, 0x55, 0x4d, 0x6e, 0x83, 0x74,
-  0x0f, 0xa2, 0x83, 0xba, 0x74, 0x03, 0xd5, 0xd3, 0xf1, 0x65, 0x29, 0x2a,
-  0x9a, 0x5a, 0x63, 0x69, 0x6d, 0xa6, 0x77, 0xb0, 0xb0, 0x17, 0x5e, 0x03,
-  0xac, 0xeb, 0x23, 0x90, 0x6f, 0x86, 0x66, 0x40, 0xa9, 0x90, 0x54, 0x2d,
-  0x52, 0x86, 0x00, 0x04, 0x1a, 0x84, 0xcf, 0x8c, 0x1c, 0xe7, 0x8b, 0xb0,
-  0x03, 0x05, 0x3a, 0x06, 0x3d, 0xc1, 0x42, 0xb9, 0x08, 0x84, 0x15, 0xdc,
-  0x1a, 0x00, 0x71, 0xac, 0x49, 0xaf, 0x22, 0x9c, 0x07, 0x52, 0xb4, 0x15,
-  0xc5, 0x53, 0x21, 0xf5, 0x30, 0x63, 0x4e, 0x88, 0x8c, 0x89, 0x6a, 0x25,
-  0x15, 0xcd, 0x8c, 0x1d, 0x4f, 0x17, 0x6d, 0xb0, 0x19, 0xb1, 0x48, 0xe7,
-  0x12, 0xa3, 0xd1, 0x02, 0xde, 0x2f, 0x84, 0x01, 0xd9, 0x44, 0x6a, 0xb8,
-  0x5c, 0x12, 0x48, 0x80, 0x93, 0x8f, 0x40, 0xf7, 0xb1, 0x69, 0xf5, 0x62,
-  0x67, 0x72, 0x2e, 0x52, 0x12, 0x13, 0x43, 0x21, 0x66, 0x28, 0x15, 0x0d,
-  0xb7, 0x74, 0x73, 0xf4, 0x80, 0x36, 0x93, 0x74, 0xc0, 0x35, 0x54, 0x8b,
-  0x25, 0x72, 0xd9, 0x37, 0x80, 0x48, 0x34, 0xd4, 0x64, 0xeb, 0x42, 0xce,
-  0x00, 0x72, 0x2d, 0xee, 0xda, 0x63, 0x73, 0x20, 0xa3, 0xd3, 0x6c, 0x64,
-  0x3b, 0x9b, 0x63, 0x8e, 0x17, 0x15, 0x30, 0x5b, 0x10, 0xb4, 0x06, 0x78,
-  0x5e, 0xb7, 0x8e, 0x48, 0x73, 0x1b, 0x0d, 0x5b, 0xb8, 0x68, 0x53, 0xf6,
-  0x54, 0x63, 0xcf, 0xa4, 0xc0, 0xdd, 0x24, 0x28, 0x02, 0x2d, 0xf2, 0x29,
-  0x00, 0x24, 0x5c, 0xff, 0x5b, 0x43, 0x45, 0x4e, 0x54, 0x45, 0x52, 0xb7,
-  0x5d, 0x12, 0x08, 0x2c, 0x05, 0x96, 0xb3, 0x08, 0x76, 0x19, 0xb2, 0xa9,
-  0x89, 0x75, 0x67, 0x68, 0x61, 0x26, 0x86, 0x26, 0x11, 0x73, 0x86, 0x0e,
-  0x0e, 0x70, 0xa6, 0x58, 0x43, 0x62, 0x80, 0x90, 0x28, 0xc4, 0xec, 0xc1,
-  0x15, 0xec, 0x48, 0x09, 0x37, 0xa6, 0x34, 0x98, 0x17, 0xad, 0xbd, 0xfa,
-  0xed, 0xbd, 0x91, 0x17, 0x51, 0x88, 0xb0, 0xba, 0xc0, 0x22, 0xd7, 0xa3,
-  0xeb, 0x3b, 0x6c, 0x16, 0xc0, 0x58, 0x81, 0x75, 0x2e, 0x0e, 0x41, 0xf0,
-  0x12, 0x12, 0xc1, 0x53, 0x2e, 0x76, 0x78, 0x6c, 0x63, 0x25, 0x2a, 0x0c,
-  0x68, 0x03, 0xc0, 0x2b, 0xc1, 0x66, 0x61, 0xee, 0xfb, 0x6f, 0x61, 0x24,
-  0x20, 0x2c, 0xc1, 0x30, 0xfb, 0xfe, 0x61, 0x77, 0x6b, 0x21, 0x65, 0x12,
-  0x20, 0xad, 0x5a, 0x6d, 0x6c, 0x2f, 0xd7, 0x03, 0x29, 0x48, 0x3a, 0x01,
-  0x08, 0x5e, 0x0e, 0x36, 0x2d, 0x15, 0x21, 0xbc, 0x07, 0x1b, 0x0e, 0x53,
-  0xdf, 0x02, 0x00, 0x23, 0x0e, 0x6f, 0x30, 0xc9, 0x35, 0xc0, 0x66, 0x6c,
-  0x28, 0xc7, 0x50, 0x16, 0x5e, 0x9f, 0xd6, 0xf3, 0x81, 0x6c, 0x1c, 0x91,
-  0xed, 0x96, 0x59, 0xa8, 0x70, 0x6b, 0xe2, 0x69, 0xa0, 0xec, 0x74, 0x1b,
-  0xb7, 0x0d, 0x88, 0x1c, 0x77, 0x76, 0x41, 0x66, 0x66, 0xd0, 0xdc, 0x13,
-  0x22, 0x3b, 0xe0, 0x01, 0x01, 0xda, 0x00, 0x40, 0x01, 0xe6, 0x05, 0x70,
-  0xb6, 0x03, 0x02, 0xdf, 0x0c, 0x70, 0x00, 0x80, 0x02, 0x3d, 0x02, 0x9e,
-  0x19, 0x68, 0x01, 0xdb, 0x08, 0x09, 0x19, 0x0f, 0xd0, 0x02, 0x7b, 0x0c,
-  0x19, 0x1f, 0xe0, 0x00, 0x60, 0x09, 0x0b, 0xf6, 0x0f, 0x73, 0x0c, 0x19,
-  0x1e, 0xa0, 0x05, 0x03, 0x4b, 0xf9, 0x40, 0x0b, 0x09, 0x00, 0x12, 0x99,
-  0x7a, 0x84, 0x83, 0x84, 0x65, 0xf0, 0xc3, 0x20, 0x8e, 0x8b, 0x02, 0x82,
-  0x71, 0x2d, 0xb1, 0x04, 0x21, 0x05, 0x60, 0x06, 0xc4, 0x17, 0x57, 0xb0,
-  0x20, 0x10, 0x43, 0x0d, 0xb2, 0x21, 0x24, 0x62, 0xde, 0xcb, 0x20, 0xb6,
-  0x62, 0x07, 0x61, 0xae, 0x5e, 0x05, 0xc3, 0x5f, 0x4c, 0x06, 0x6c, 0x9a,
-  0xa9, 0x74, 0x45, 0xb0, 0x36, 0xcb, 0x15, 0x5b, 0x4d, 0x42, 0xb6, 0x01,
-  0x03, 0xf7, 0xe0, 0x07, 0x0d, 0xaf, 0xa9, 0xdc, 0x0e, 0x7a, 0x03, 0xd6,
-  0xc2, 0x07, 0xcd, 0xb7, 0x91, 0xb6, 0x02, 0x03, 0x99, 0x65, 0xef, 0x0c,
-  0xc2, 0x65, 0x76, 0x2d, 0xbe, 0x7a, 0x01, 0x35, 0x78, 0x94, 0x20, 0x68,
-  0x40, 0x23, 0xd2, 0x3c, 0xc1, 0x63, 0x35, 0x8b, 0x66, 0x03, 0xa5, 0xbc,
-  0xac, 0x05, 0xed, 0x59, 0x22, 0x19, 0x58, 0x2f, 0x48, 0x11, 0x66, 0xf2,
-  0xc1, 0x5e, 0x64, 0x1b, 0x08, 0x2b, 0x23, 0x36, 0x54, 0x12, 0x32, 0xa3,
-  0xde, 0x5a, 0xc8, 0x3e, 0x6a, 0x3a, 0xf6, 0xd8, 0x00, 0x13, 0x46, 0x05,
-  0x38, 0x2c, 0xc1, 0xee, 0x18, 0x8e, 0xc3, 0x63, 0x86, 0x08, 0x49, 0x75,
-  0x11, 0x26, 0x12, 0x0a, 0xf0, 0xa4, 0x56, 0x8d, 0x46, 0xae, 0xdb, 0x63,
-  0x00, 0x00, 0x21, 0x6c, 0x12, 0xfb, 0x3f, 0x3a, 0x5c, 0x15, 0x09, 0x53,
-  0xa4, 0xdc, 0x46, 0x67, 0x2a, 0xf5, 0xe0, 0xbf, 0x6d, 0x42, 0x4c, 0x49,
-  0x54, 0x5a, 0x6b, 0xce, 0xc6, 0x6a, 0x25, 0x57, 0x98, 0x02, 0x5d, 0x2e,
-  0xab, 0x53, 0x66, 0xc7, 0xcb, 0x25, 0xe9, 0x50, 0x43, 0x2d, 0x59, 0x57,
-  0x75, 0x39, 0x1d, 0x96, 0x14, 0x8c, 0x4f, 0x58, 0x16, 0xb0, 0x3d, 0xb6,
-  0x20, 0x4d, 0x4d, 0xad, 0x1f, 0xb3, 0x41, 0x30, 0x24, 0x58, 0x99, 0x6d,
-  0x39, 0x2f, 0x2b, 0x70, 0x26, 0x7b, 0x45, 0x58, 0x45, 0x6a, 0x21, 0xfb,
-  0x4d, 0x41, 0x52, 0x54, 0x41, 0x03, 0x56, 0x29, 0xb2, 0x37, 0x27, 0x53,
-  0x59, 0x8a, 0x53, 0x56, 0x13, 0xe9, 0x81, 0x77, 0x26, 0x73, 0xb0, 0x48,
-  0x16, 0x00, 0x57, 0x20, 0x21, 0xcf, 0x21, 0x20, 0x25, 0x39, 0x01, 0x40,
-  0x0b, 0x92, 0x02, 0x64, 0x40, 0xe4, 0x14, 0x64, 0x04, 0x01, 0x91, 0x40,
-  0x91, 0x18, 0x90, 0x08, 0x06, 0x40, 0x6c, 0x20, 0x00, 0x95, 0x47, 0xc7,
-  0xb8, 0x03, 0x03, 0x8b, 0x89, 0x3c, 0x09, 0x02, 0x85, 0xed, 0xe8, 0x31,
-  0x13, 0xe4, 0x0a, 0x02, 0x01, 0x26, 0xfc, 0x60, 0xcc, 0x01, 0x13, 0x27,
-  0x10, 0x32, 0x2f, 0x43, 0x02, 0x03, 0x21, 0x33, 0x24, 0x72, 0x42, 0x02,
-  0x04, 0x13, 0x38, 0x8c, 0x32, 0x6f, 0x58, 0x13, 0x4c, 0x4c, 0x80, 0x32,
-  0x60, 0x00, 0xc8, 0x74, 0x03, 0x88, 0x20, 0x0c, 0x9c, 0x80, 0x32, 0xb0,
-  0x00, 0xc8, 0xc4, 0x03, 0xd8, 0x20, 0x0c, 0xec, 0x80, 0x39, 0x00, 0x33,
-  0x2b, 0x90, 0x14, 0x06, 0x28, 0x40, 0x19, 0x3c, 0x00, 0x64, 0x50, 0x01,
-  0xfb, 0x64, 0x33, 0x01, 0x20, 0x02, 0x01, 0xbd, 0x04, 0xa0, 0x02, 0xa0,
-  0x3b, 0xa1, 0x03, 0x0a, 0xf2, 0x00, 0x40, 0xc2, 0x0d, 0x88, 0x0f, 0x1f,
-  0x1c, 0x1f, 0xb9, 0x1e, 0x01, 0x8f, 0x04, 0x54, 0x4d, 0x50, 0xed, 0x00,
-  0x2e, 0x24, 0x00, 0x72, 0x59, 0x48, 0xf2, 0xc2, 0xd2, 0xfe, 0x43, 0x4f,
-  0x4d, 0x50, 0x41, 0x51, 0x78, 0x13, 0x5e, 0xcc, 0x04, 0x05, 0x06, 0x3b,
-  0x93, 0x14, 0x15, 0xfe, 0x05, 0x13, 0xff, 0x16, 0x05, 0x11, 0x02, 0xc2,
-  0x5d, 0x76, 0x05, 0x05, 0x6f, 0x47, 0x0f, 0xdb, 0xff, 0x23, 0x22, 0x0f,
-  0x3b, 0x2e, 0x6d, 0xff, 0x3c, 0xdf, 0x05, 0x0f, 0x30, 0x13, 0x21, 0xd9,
-  0x23, 0x04, 0xde, 0x13, 0x72, 0x08, 0x03, 0x47, 0x40, 0x51, 0x28, 0x5e,
-  0xb7, 0x71, 0x97, 0x00, 0xff, 0xb5, 0x00, 0xd4, 0x00, 0xf3, 0x00, 0x11,
-  0x01, 0xff, 0x30, 0x01, 0x4e, 0x01, 0x6d, 0x01, 0x0a, 0x72, 0x14, 0x6b,
-  0x31, 0x03, 0xb7, 0x50, 0x46, 0x8a, 0xad, 0x57, 0x5b, 0xb6, 0x53, 0xb7,
-  0x54, 0x03, 0x44, 0x54, 0x0d, 0x31, 0x6e, 0x03, 0x15, 0x43, 0x29, 0x4d,
-  0x6d, 0x14, 0x01, 0x8e, 0x4f, 0x5c, 0x02, 0x6f, 0x0a, 0x03, 0x04, 0x14,
-  0xd8, 0x09, 0x05, 0x00, 0x72, 0x14, 0x5f, 0x0f, 0x17, 0x0f, 0xbb, 0x08,
-  0x06, 0x07, 0x14, 0xb2, 0x16, 0x12, 0x6c, 0x0d, 0x1d, 0xbf, 0x10, 0x0a,
-  0x0f, 0x0f, 0x6c, 0x1f, 0x0a, 0xbf, 0x06, 0x14, 0x12, 0x0b, 0x0e, 0x2f,
-  0x11, 0x14, 0x0c, 0x25, 0xa4, 0x78, 0x29, 0xa4, 0xff, 0x93, 0xaa, 0x96,
-  0x80, 0x10, 0x40, 0x44, 0x90, 0x0a, 0x8a, 0x24, 0x85, 0x14, 0x04, 0x7f,
-  0xb8, 0x87, 0x16, 0xcd, 0x2f, 0xc0, 0x3d, 0x00, 0x50, 0x83, 0x57, 0x31,
-  0xff, 0xc0, 0xcb, 0xb4, 0x88, 0xcd, 0x15, 0x72, 0x01, 0xb8, 0xcb, 0x09,
-  0x00, 0x44, 0x83, 0x25, 0x04, 0xa2, 0x31, 0x81, 0x83, 0x16, 0x1a, 0xfd,
-  0x02, 0xcd, 0x16, 0x25, 0x08, 0xd2, 0x07, 0x01, 0xd9, 0x74, 0x30, 0x3b,
-  0x30, 0xe4, 0x0d, 0x60, 0x3c, 0x00, 0x15, 0x1c, 0xac, 0x07, 0x18, 0xef,
-  0x06, 0x10, 0xed, 0xeb, 0xf4, 0xcb, 0x62, 0xff, 0x06, 0xb8, 0x33, 0x35,
-  0xcd, 0x21, 0x31, 0xc0, 0xf3, 0x8c, 0xc2, 0x81, 0xfa, 0x77, 0x08, 0x81,
-  0xfb, 0x05, 0x7f, 0x02, 0xeb, 0x0d, 0xcd, 0x33, 0xf7, 0xd8, 0xe0, 0xba,
-  0xa1, 0x24, 0x2a, 0xdf, 0xb7, 0xa2, 0x0c, 0x00, 0x07, 0xee, 0xcb, 0x1e,
-  0xb8, 0x0b, 0x00, 0x10, 0x6c, 0x51, 0x0b, 0xbd, 0x09, 0xc6, 0x06, 0xb1,
-  0x06, 0x01, 0x15, 0x5d, 0x4a, 0xa0, 0x6b, 0x1a, 0x48, 0x5d, 0x99, 0x1f,
-  0xb7, 0xcb, 0x0d, 0xdc, 0xff, 0x62, 0x6e, 0xd7, 0x37, 0x0b, 0x4f, 0xd0,
-  0x02, 0x3f, 0x55, 0x89, 0xe5, 0xb6, 0x1e, 0x0f, 0xc0, 0xa8, 0x8d, 0xab,
-  0xe0, 0xc5, 0x5e, 0x06, 0x02, 0x66, 0x85, 0x06, 0xd1, 0x0a, 0x45, 0x8e,
-  0xee, 0xb8, 0x03, 0xed, 0x1f, 0xd1, 0xe9, 0xfc, 0x01, 0x41, 0xd1, 0xea,
-  0xfd, 0x42, 0x89, 0xd8, 0xdb, 0x24, 0x89, 0x0f, 0x22, 0xbd, 0x89, 0x17,
-  0x1f, 0x5d, 0xed, 0x3b, 0x4a, 0x97, 0x85, 0x19, 0xb8, 0x82, 0x04, 0x08,
-  0x3f, 0x0a, 0x56, 0x08, 0xdf, 0xd1, 0xe1, 0x01, 0x49, 0xcf, 0xd1, 0xe2,
-  0x4a, 0x6b, 0x3e, 0x23, 0xdf, 0x5f, 0x60, 0x2e, 0x1a, 0xb8, 0xfb, 0x5b,
-  0x08, 0x62, 0x3b, 0x0c, 0x69, 0x39, 0x10, 0x1f, 0x27, 0x57, 0xb8, 0x05,
-  0x6b, 0x3f, 0x58, 0x59, 0x6d, 0x18, 0x08, 0x83, 0x08, 0xad, 0x1d, 0x04,
-  0xe5, 0x0c, 0x89, 0x0d, 0xfb, 0x10, 0x89, 0x15, 0x5f, 0x1f, 0x4d, 0x0e,
-  0x12, 0x48, 0xb7, 0x4a, 0x22, 0x03, 0xc8, 0x58, 0x4d, 0x05, 0xb7, 0xbf,
-  0xc5, 0xfe, 0xf2, 0x74, 0x32, 0xb8, 0x07, 0x72, 0x0a, 0x47, 0xb8, 0xba,
-  0x08, 0xd8, 0x08, 0x59, 0x0c, 0x2b, 0x0a, 0x1d, 0x17, 0xa8, 0xb9, 0x26,
-  0xe1, 0x25, 0xcd, 0x10, 0xb0, 0x7b, 0x08, 0x30, 0xff, 0x06, 0x7f, 0x88,
-  0xe3, 0xb1, 0x04, 0xd2, 0xe3, 0xff, 0xd2, 0xec, 0x00, 0xe3, 0xb4, 0x09,
-  0xb7, 0x00, 0x86, 0xb9, 0x68, 0x68, 0x19, 0x20, 0xa1, 0x7f, 0xbf, 0x5f,
-  0x04, 0xf7, 0xd3, 0x81, 0xe3, 0x68, 0x0e, 0x5b, 0x4e, 0x10, 0x11, 0xa1,
-  0x06, 0xc8, 0x40, 0x45, 0x1d, 0x66, 0x1e, 0xfc, 0x65, 0x04, 0xf6, 0xc3,
-  0x20, 0x75, 0x7d, 0x10, 0x07, 0xbd, 0x3f, 0x03, 0xbb, 0x00, 0xdb, 0x2d,
-  0x89, 0xc8, 0x2f, 0x1d, 0x4f, 0x04, 0xaf, 0x57, 0x54, 0xba, 0x0f, 0x52,
-  0xe0, 0x3a, 0x0e, 0x55, 0xdf, 0x5c, 0xb8, 0x30, 0x11, 0x30, 0xb6, 0xd2,
-  0x0e, 0x80, 0x14, 0xff, 0x6e, 0x46, 0xfe, 0xc2, 0x37, 0x2f, 0xb2, 0x19,
-  0xf8, 0x30, 0xf6, 0x89, 0xd0, 0x5d, 0x69, 0xf3, 0xbb, 0x10, 0xbc, 0x3d,
-  0x03, 0x75, 0x53, 0x05, 0x00, 0x83, 0xc8, 0x0f, 0xe1, 0x80, 0xfb, 0x04,
-  0xdc, 0x5b, 0x04, 0x05, 0x19, 0x8d, 0xdb, 0x38, 0x09, 0x06, 0x0a, 0xa0,
-  0xde, 0x04, 0x07, 0x74, 0x14, 0x5b, 0x08, 0x1d, 0xfb, 0x0a, 0x74, 0x0a,
-  0x22, 0x67, 0x0b, 0x44, 0x56, 0x9f, 0x8e, 0x04, 0xc0, 0xeb, 0x15, 0x50,
-  0x1d, 0x63, 0xb7, 0x74, 0xc2, 0x80, 0x00, 0x08, 0x16, 0x30, 0x03, 0xd8,
-  0x5d, 0xa2, 0x05, 0xee, 0x35, 0x50, 0x88, 0xd0, 0xeb, 0x1c, 0x30, 0x1a,
-  0x5f, 0x8e, 0x3c, 0x6f, 0x43, 0x02, 0xb0, 0x03, 0x1d, 0x98, 0x10, 0xed,
-  0x58, 0x30, 0xdb, 0x04, 0x84, 0xc3, 0x8c, 0xf1, 0x79, 0xff, 0xea, 0xf9,
-  0xa0, 0xd0, 0x01, 0x01, 0x43, 0x50, 0x0d, 0xa2, 0x97, 0x19, 0x2a, 0x50,
-  0x6b, 0x31, 0x3c, 0x6c, 0x12, 0x26, 0x55, 0x10, 0xd8, 0xe0, 0x04, 0xb0,
-  0x08, 0x06, 0xbc, 0xec, 0x14, 0xb4, 0x11, 0x46, 0x8f, 0xeb, 0x33, 0x6c,
-  0x2f, 0x2b, 0xbf, 0x0a, 0xb2, 0x01, 0xb8, 0x12, 0xfd, 0x11, 0xe8, 0x92,
-  0xff, 0xeb, 0x23, 0x01, 0x5d, 0x84, 0x1e, 0x6c, 0x14, 0x1c, 0xfc, 0x02,
-  0xb8, 0x11, 0xb2, 0x7d, 0xdb, 0x0e, 0x0f, 0x32, 0x2c, 0x08, 0xce, 0x24,
-  0xc3, 0x6d, 0xff, 0xb7, 0x3e, 0x45, 0xb4, 0x19, 0x31, 0x28, 0x4a, 0x5c,
-  0x1b, 0x31, 0xd2, 0x24, 0x81, 0xa7, 0x3b, 0x78, 0x08, 0x4d, 0x37, 0xce,
-  0x9d, 0x90, 0x1b, 0x0b, 0x08, 0xff, 0x88, 0xde, 0x31, 0xdb, 0x81, 0xea,
-  0x01, 0x01, 0x4d, 0x78, 0x10, 0x04, 0x15, 0x34, 0x18, 0xbb, 0x87, 0x24,
-  0x0b, 0x0d, 0x26, 0x1b, 0x28, 0xf0, 0x4a, 0x62, 0xdb, 0x04, 0x1f, 0x18,
-  0x09, 0xef, 0xc0, 0xe0, 0x04, 0x19, 0x93, 0x0f, 0x7b, 0xe7, 0x1c, 0x16,
-  0x47, 0x85, 0xb8, 0x6a, 0x10, 0xaa, 0x51, 0xac, 0xc1, 0x13, 0xe4, 0x5a,
-  0x4d, 0x33, 0x42, 0x6e, 0x0f, 0x08, 0x50, 0xe5, 0x13, 0x55, 0xbe, 0x44,
-  0xd5, 0xff, 0x58, 0x58, 0x15, 0xcc, 0xf4, 0x81, 0x02, 0xac, 0x0a, 0x6e,
-  0xdb, 0x4f, 0x57, 0xf8, 0x1e, 0x36, 0xc5, 0x7f, 0x04, 0x68, 0x55, 0x80,
-  0x58, 0x27, 0x74, 0x28, 0xb6, 0x64, 0x35, 0xd9, 0x27, 0xc9, 0xbf, 0x47,
-  0xeb, 0xef, 0x1f, 0x5f, 0xcb, 0x82, 0xbe, 0x88, 0xeb, 0x6a, 0xb8, 0x59,
-  0x58, 0x63, 0x82, 0x02, 0x9b, 0x3d, 0x88, 0xe8, 0x6f, 0xba, 0x30, 0xed,
-  0x88, 0x85, 0xf2, 0xe0, 0x4f, 0x69, 0x07, 0x4b, 0x6e, 0x0a, 0x3c, 0x0e,
-  0x88, 0xf9, 0x1d, 0x47, 0x66, 0x05, 0x77, 0x76, 0xb7, 0x01, 0xb3, 0x98,
-  0x0f, 0x73, 0x68, 0x8a, 0xdb, 0x76, 0xb7, 0x94, 0x01, 0x6b, 0x1c, 0x75,
-  0x36, 0xfb, 0x0c, 0x46, 0xb6, 0xc6, 0x5e, 0xde, 0x02, 0x19, 0xe0, 0xf8,
-  0x15, 0x17, 0xa2, 0x6d, 0x4a, 0x02, 0xc7, 0xff, 0x1e, 0x07, 0xbe, 0xa0,
-  0x10, 0xbf, 0x00, 0x10, 0xfc, 0xfc, 0xb9, 0xd0, 0x07, 0xf3, 0xa5, 0x37,
-  0xe9, 0xb9, 0x50, 0x00, 0xfd, 0xf3, 0xab, 0x5f, 0x5e, 0x07, 0x1f, 0x75,
-  0xac, 0x37, 0xd5, 0x82, 0xd0, 0xcc, 0x75, 0x00, 0x59, 0x70, 0xc3, 0x88,
-  0x09, 0x52, 0xa2, 0x20, 0xad, 0x53, 0x95, 0x05, 0x73, 0x13, 0x48, 0x60,
-  0x0e, 0x02, 0x3f, 0x84, 0x2f, 0x02, 0x6b, 0x20, 0xc6, 0x41, 0x05, 0x5e,
-  0x66, 0xf0, 0x1a, 0x8b, 0x41, 0x0c, 0xc6, 0xe0, 0xda, 0xa0, 0x0d, 0xc8,
-  0x11, 0xec, 0x07, 0x0c, 0x0e, 0x06, 0x6c, 0xff, 0x00, 0x6c, 0xbc, 0xef,
-  0x8b, 0x51, 0x52, 0xcd, 0xc2, 0x23, 0x59, 0x81, 0x27, 0x65, 0x15, 0x5f,
-  0xdb, 0x74, 0xee, 0x11, 0xb8, 0x0c, 0x0a, 0x1b, 0x8b, 0x02, 0xdb, 0x72,
-  0x07, 0x73, 0x03, 0x2e, 0xeb, 0x05, 0xf5, 0x06, 0xd6, 0xc7, 0xa0, 0x05,
-  0xac, 0xca, 0x6d, 0x9a, 0x5b, 0x6e, 0x3a, 0x74, 0x13, 0x93, 0x2c, 0xdc,
-  0xb8, 0x0b, 0x2c, 0xe8, 0x16, 0x74, 0x11, 0x5c, 0xba, 0x6d, 0x19, 0x01,
-  0xeb, 0xb9, 0xbc, 0x02, 0x7e, 0x03, 0x01, 0x1b, 0x21, 0x20, 0xdd, 0x06,
-  0x8b, 0x00, 0x93, 0x00, 0xcc, 0x90, 0x00, 0x8f, 0x31, 0x00, 0x27, 0x3f,
-  0x90, 0x00, 0x89, 0x91, 0x01, 0x4b, 0xec, 0x17, 0x65, 0x28, 0x1f, 0x10,
-  0x4d, 0x2d, 0xef, 0x46, 0x48, 0x46, 0x09, 0x41, 0x5e, 0x73, 0xc2, 0x00,
-  0x2b, 0xc8, 0x35, 0x0c, 0x60, 0x0c, 0x6b, 0xae, 0x3d, 0x46, 0x29, 0x4a,
-  0x80, 0x64, 0x26, 0x80, 0x83, 0xa4, 0x1c, 0x0a, 0x65, 0x03, 0x08, 0x95,
-  0x41, 0x07, 0x0a, 0x20, 0x4d, 0x09, 0xd2, 0x09, 0x1e, 0x36, 0x19, 0x05,
-  0x30, 0x42, 0x85, 0x72, 0x32, 0x0c, 0x11, 0x70, 0x4c, 0x85, 0xbb, 0x4e,
-  0x0e, 0x08, 0x42, 0x9d, 0x01, 0x16, 0x81, 0x16, 0x6e, 0x31, 0xb0, 0x10,
-  0x67, 0xa9, 0x6d, 0xe8, 0x0b, 0xcc, 0x01, 0x00, 0xa1, 0xb0, 0x21, 0x0c,
-  0x2e, 0x17, 0xc8, 0xb4, 0xe4, 0x0b, 0x2b, 0x64, 0x10, 0xc9, 0x53, 0x1b,
-  0x45, 0xa7, 0x30, 0x74, 0x04, 0x47, 0x61, 0xe2, 0x01, 0xbe, 0xaf, 0x1f,
-  0xcc, 0xeb, 0x21, 0xf4, 0x1d, 0x09, 0x91, 0x5b, 0x1e, 0x01, 0xde, 0x90,
-  0x94, 0xa8, 0xbb, 0x78, 0xbe, 0x2e, 0x29, 0x42, 0x9b, 0x1e, 0xe3, 0x20,
-  0x64, 0x54, 0x81, 0xbe, 0x14, 0x04, 0x50, 0x68, 0x4f, 0x48, 0x24, 0x06,
-  0x2e, 0xc1, 0x11, 0x92, 0x34, 0x6b, 0x32, 0xff, 0x28, 0x8b, 0xa5, 0x19,
-  0x4b, 0xb0, 0x0c, 0xf1, 0x0a, 0x9d, 0xbb, 0x04, 0x8c, 0x00, 0x01, 0x83,
-  0x4c, 0x91, 0x04, 0xe4, 0x48, 0x98, 0x04, 0x08, 0xd9, 0x37, 0xd8, 0x6c,
-  0x19, 0x07, 0xcc, 0x60, 0x0a, 0xcb, 0x18, 0x32, 0x6f, 0x02, 0x6a, 0x08,
-  0x08, 0xd8, 0x0c, 0x0a, 0x01, 0x0f, 0x16, 0x04, 0xe4, 0x65, 0x0d, 0xbc,
-  0x19, 0x96, 0xef, 0x54, 0xc2, 0x04, 0x0a, 0xbe, 0x96, 0x06, 0x2a, 0xce,
-  0x12, 0x14, 0xa5, 0xf7, 0xdb, 0x08, 0x12, 0x15, 0x1e, 0x6b, 0x4a, 0x06,
-  0xaf, 0xbe, 0x0a, 0x6f, 0x00, 0x26, 0x08, 0x62, 0x75, 0x63, 0x56, 0x81,
-  0xa8, 0x4b, 0xb9, 0x02, 0x63, 0x02, 0x84, 0x7b, 0x10, 0x01, 0x20, 0x0e,
-  0x3b, 0x58, 0x18, 0x64, 0x06, 0x3b, 0x36, 0x05, 0xef, 0x74, 0x09, 0x65,
-  0x00, 0x07, 0x40, 0xed, 0x0c, 0x01, 0xf6, 0x4a, 0xd6, 0x19, 0x1d, 0x5c,
-  0xfc, 0x05, 0x0d, 0x12, 0x0d, 0x0f, 0xb8, 0xa3, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x24, 0xff, 0xa4, 0x00, 0xff, 0x75, 0x03, 0xe8, 0x75, 0x00,
-  0x72, 0xf6, 0x41, 0x8c, 0xc0, 0x01, 0xff, 0x73, 0x05, 0x80, 0xc4, 0x08,
-  0x8e, 0xc0, 0xd1, 0xef, 0xe8, 0x55, 0x00, 0xe3, 0x66, 0x73, 0xf9, 0x49,
-  0x49, 0x74, 0x11, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xc9, 0x89,
-  0xcd, 0x8a, 0x1c, 0x46, 0xf6, 0xd3, 0x31, 0xc9, 0xe8, 0x39, 0x00, 0x11,
-  0xc9, 0x75, 0x08, 0x41, 0xe8, 0x31, 0x00, 0x73, 0xfb, 0x41, 0x41, 0x81,
-  0xfd, 0xd1, 0x00, 0x83, 0xd9, 0xfe, 0x29, 0xe8, 0x72, 0x0e, 0x8e, 0xd8,
-  0x8d, 0x01, 0x28, 0xfc, 0x96, 0xf3, 0xa4, 0x96, 0x8e, 0xda, 0xeb, 0xa5,
-  0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0x50, 0x31, 0xc0, 0x8e,
-  0xd8, 0x58, 0x01, 0xd8, 0x01, 0xf8, 0xeb, 0xe2, 0x00, 0xff, 0x75, 0x03,
-  0xe8, 0x06, 0x00, 0x11, 0xc9, 0x00, 0xff, 0x75, 0x05, 0x8a, 0x3c, 0x46,
-  0x10, 0xff, 0xc3, 0x5d, 0x06, 0x1f, 0x8d, 0xb5, 0x5d, 0xf4, 0xad, 0x5b,
-  0x91, 0xad, 0x92, 0xad, 0x97, 0xad, 0x01, 0xc3, 0x8e, 0xc3, 0x31, 0xc0,
-  0x01, 0xc7, 0x26, 0x01, 0x2d, 0xac, 0x48, 0x74, 0x15, 0x40, 0x75, 0xf4,
-  0x47, 0x47, 0x26, 0x80, 0x3d, 0x9a, 0x75, 0xf9, 0x26, 0x39, 0x55, 0x03,
-  0x77, 0xf3, 0xb0, 0x03, 0xeb, 0xe2, 0x81, 0xc7, 0xfe, 0x00, 0x72, 0xd3,
-  0xe2, 0xdf, 0x07, 0x06, 0x1f, 0x8d, 0x86, 0x94, 0x24, 0x8e, 0xd0, 0xbc,
-  0x80, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x94, 0x24, 0x80, 0x00, 0x00,
-  0x00, 0x1e
+	0x78,0xDA,0x1C,0x56,0x79,0x34,0xD4,0x8D,0xF7,0xFE,0xCC,
+	0xF6,0x99,0x7D,0x8C,0xC1,0x8C,0x65,0x30,0x76,0x65,0x1F,
+	0x5B,0xD6,0x6C,0x59,0xB2,0xAB,0x2C,0xD9,0x4B,0xC9,0xBE,
+	0xCD,0x50,0xD9,0xB7,0xC4,0x20,0xA9,0x28,0x7A,0x8B,0x94,
+	0x57,0x8B,0x92,0xEC,0x64,0xCF,0x9A,0x4A,0xF5,0xCA,0x16,
+	0x8A,0x6A,0xC6,0xA4,0x24,0x21,0xCB,0xCC,0xEF,0x7B,0x7E,
+	0xF7,0x9C,0x7B,0xCE,0x7D,0xFE,0xB9,0x7F,0x3C,0xE7,0xDE,
+	0xE7,0x79,0x1C,0x8F,0x7F,0x05,0x42,0x01,0x08,0x00,0x05,
+	0xEE,0x89,0xF2,0xF9,0x4F,0x15,0xFE,0x37,0xFC,0x7F,0x51,
+	0xFF,0xD7,0x78,0x40,0x05,0xDF,0x7A,0x20,0xA4,0x33,0xF2,
+	0x6D,0xEE,0xA6,0xD4,0xFD,0xC6,0xB4,0xFC,0x21,0x04,0x02,
+	0x28,0x9C,0x44,0x14,0x8B,0x16,0x76,0xEF,0xFD,0xBE,0xB7,
+	0xAB,0x9E,0x16,0x4E,0x22,0xC6,0x7D,0x2B,0x7E,0x52,0x4B,
+	0x20,0x10,0x40,0x69,0x24,0xF9,0x39,0x04,0x68,0x17,0x48,
+	0x3B,0x36,0x7A,0xCC,0xC5,0x53,0x06,0x0F,0x83,0xA1,0x6E,
+	0x9D,0x47,0x77,0x2C,0xDC,0x89,0x96,0x5C,0x39,0x0E,0xAD,
+	0x18,0x07,0x0E,0x27,0x43,0x81,0x5A,0x7E,0x5B,0xAC,0xA4,
+	0x7A,0x2E,0x19,0x84,0xF2,0x1B,0x34,0xC7,0x64,0x58,0xEA,
+	0x50,0x80,0xCF,0x92,0x52,0x05,0x0A,0xA7,0xAB,0x12,0xF9,
+	0x40,0x3E,0x78,0x0E,0xC8,0x95,0x62,0x46,0xC1,0xD4,0x0B,
+	0x80,0x3D,0x36,0x1E,0xD2,0x6F,0x1A,0xD7,0x25,0x31,0xC8,
+	0x9A,0x6C,0xE5,0xF3,0x53,0x77,0xD7,0x1E,0x2F,0x1A,0x5B,
+	0x2A,0xF2,0x0F,0x20,0x98,0x1B,0x69,0x63,0x69,0x9B,0x2B,
+	0x53,0xB9,0x04,0xF1,0xE6,0x56,0x83,0x77,0x8B,0x7B,0x99,
+	0x7D,0xC4,0xCC,0xC5,0xD5,0x26,0x9D,0x04,0x63,0xFE,0x5B,
+	0x95,0x65,0x96,0xE9,0x03,0x6D,0x5E,0x3A,0x1F,0x80,0xC6,
+	0x21,0xBB,0x66,0xE0,0xB9,0xB8,0xAE,0xA7,0xF0,0x77,0x3F,
+	0x6D,0x8C,0xF8,0x3F,0xE3,0x60,0x9C,0x73,0x10,0xD6,0xFC,
+	0x0C,0x6C,0x5A,0x39,0x3B,0x21,0x30,0x17,0xA8,0x8C,0x3A,
+	0xA3,0x32,0x59,0xB8,0xD1,0xDD,0x70,0xD8,0x23,0x83,0xEF,
+	0xFF,0xEE,0xDB,0x76,0xE1,0x5B,0x56,0xD7,0x37,0x8D,0x1D,
+	0xED,0x8D,0x6E,0xF5,0x42,0xB0,0xAC,0xD9,0x54,0xB7,0x95,
+	0x4F,0x8A,0x55,0x79,0xBD,0xFB,0xFB,0x41,0xC3,0x0A,0x30,
+	0x26,0x5E,0xDB,0x9C,0xAA,0x47,0xF8,0xDF,0x62,0xED,0x95,
+	0x96,0x68,0xC9,0xC2,0xC9,0x9D,0x4E,0x00,0xE8,0x12,0xAD,
+	0x8C,0x9F,0x01,0x54,0x46,0xA5,0xD4,0x77,0x06,0xC0,0x66,
+	0x48,0x2C,0xA2,0xAB,0x1A,0x02,0xF0,0xF5,0x62,0x18,0xB0,
+	0xA8,0x77,0x11,0x8E,0x61,0x21,0x7C,0xA0,0x0C,0x09,0x8C,
+	0xC2,0x5C,0xCA,0x66,0x86,0x60,0xBA,0x2D,0x9D,0x31,0x26,
+	0x28,0x2F,0x54,0xD0,0x3F,0x7B,0x7C,0xA9,0x69,0xAD,0x67,
+	0xB0,0xB9,0xF8,0xCF,0x5A,0x2E,0x82,0x26,0x04,0xF6,0xB1,
+	0xAE,0x8D,0xEF,0x0D,0x0E,0x79,0xD6,0xCD,0xF0,0x9B,0xAD,
+	0x04,0x3E,0xD0,0xA6,0x06,0x70,0x7A,0x00,0xA9,0xC6,0x96,
+	0xE2,0x5A,0x42,0xFB,0x05,0x2F,0x85,0x26,0x6F,0x5B,0xF8,
+	0x00,0xCE,0x37,0xC4,0x3F,0x08,0x71,0x3A,0xB0,0xE4,0x24,
+	0x68,0x7D,0x2A,0x24,0x38,0x09,0x50,0xC8,0x1F,0xD1,0x38,
+	0xDE,0xA6,0x0A,0x89,0x14,0x92,0xEE,0xFB,0x61,0xA1,0xF0,
+	0x82,0xFC,0xC1,0x0C,0xAB,0x87,0x81,0x87,0xF8,0x1A,0x20,
+	0xEE,0x06,0x7E,0x05,0x6F,0x9F,0x1A,0x6D,0xE0,0xF3,0x59,
+	0x1F,0x58,0x73,0x46,0xF3,0x0C,0xBE,0x70,0xDA,0x41,0x3E,
+	0x03,0x73,0x20,0x78,0x03,0x92,0x80,0xC8,0x83,0x7F,0x62,
+	0xBD,0x8B,0x49,0x05,0xB9,0x6C,0xA3,0x0F,0x8C,0x3D,0x1A,
+	0x6B,0x5A,0x0A,0x09,0x76,0x52,0x81,0x01,0x24,0x7F,0xB0,
+	0x99,0x81,0xE4,0x29,0xF2,0xFD,0xA1,0xD2,0xDC,0x17,0x53,
+	0xA0,0x47,0x57,0x67,0x5F,0x83,0x59,0x3B,0x34,0xC1,0xBE,
+	0xAF,0x55,0x2A,0xA2,0xCF,0xE8,0xF6,0x0A,0x7B,0x99,0x9F,
+	0xDD,0x82,0x6C,0x72,0xF9,0x2C,0x4C,0xB9,0x07,0xC0,0xF9,
+	0xDD,0x47,0x5C,0xDD,0xDC,0x3D,0x40,0xF2,0x8E,0xD4,0x4E,
+	0x1B,0x47,0xBE,0x3A,0x3E,0xFD,0x9B,0xF0,0xAE,0x66,0x37,
+	0x64,0xCB,0x45,0x19,0xEB,0x6F,0x77,0x5C,0x9A,0x82,0xE4,
+	0xFB,0xFB,0x1D,0xF7,0xF2,0x7E,0x7D,0x2C,0x77,0xFA,0x0B,
+	0x78,0xE3,0x27,0x6D,0x92,0x65,0x0D,0x36,0x56,0x89,0xB5,
+	0x23,0x50,0x55,0x96,0xD1,0x6D,0x98,0x4E,0x65,0xE9,0x16,
+	0x79,0x85,0x1F,0x0F,0x91,0xBE,0xA3,0xAF,0xA5,0x73,0x17,
+	0x7F,0xEA,0xB1,0x6C,0x64,0xE3,0x40,0xB9,0x99,0x17,0xC7,
+	0xB0,0xB6,0xEE,0x98,0xB7,0x1F,0x5D,0xE2,0x51,0x9D,0x50,
+	0xB0,0x2C,0x45,0x72,0x9E,0x91,0xD9,0x0F,0xB2,0xF8,0xAB,
+	0x99,0x3C,0x3E,0x13,0xCA,0x15,0x9F,0xD9,0xB4,0xB6,0x02,
+	0x36,0x18,0xE0,0xE6,0x80,0xD6,0x0A,0x13,0xAE,0xC8,0xE3,
+	0xA2,0x07,0xC1,0x64,0x00,0x41,0xD1,0xE5,0xF3,0xE7,0xFD,
+	0x7C,0x0D,0x33,0x79,0xA6,0x13,0x9A,0x34,0x26,0xA2,0x65,
+	0x56,0x8A,0x4B,0x0D,0xBB,0x8B,0x8D,0x1F,0x5F,0x84,0xB4,
+	0x27,0xB3,0xDC,0xF9,0x60,0x6E,0x69,0x64,0x4C,0x6E,0x4E,
+	0xF4,0x4A,0x0C,0x1F,0x14,0x09,0x3B,0xA0,0x2A,0xE9,0xCE,
+	0xEA,0x0C,0xC4,0x6E,0x24,0x21,0xE6,0xBC,0x85,0x93,0xD0,
+	0x22,0xB6,0x5D,0x4B,0xEC,0x24,0x59,0xAE,0x20,0xC6,0x62,
+	0x9E,0x3E,0x98,0x73,0x56,0x3B,0xCA,0xCD,0xBD,0x6C,0x9C,
+	0x99,0xE2,0x35,0xEF,0x55,0x07,0xBA,0x54,0xF4,0x37,0x69,
+	0xC3,0x5E,0x84,0x0C,0xDC,0x1B,0x6C,0xAF,0x53,0x0F,0x27,
+	0xCC,0xE4,0x91,0xC9,0x79,0xA5,0x7A,0x0D,0xD0,0x82,0x66,
+	0xE9,0x79,0xA8,0xC4,0xB1,0x8A,0x9D,0x21,0x6D,0xF9,0xE8,
+	0xBC,0xE8,0xD4,0xB4,0xCF,0x97,0x30,0xBD,0x77,0x22,0x70,
+	0xBE,0x39,0xC2,0x97,0x34,0x3F,0x7E,0x7C,0xFB,0xB9,0x5E,
+	0x34,0xD5,0x73,0x86,0x0E,0x62,0x28,0xB4,0x48,0x1C,0x0A,
+	0x9D,0x82,0x92,0xDF,0xB4,0x19,0xD6,0x4E,0x02,0x5D,0x34,
+	0x63,0x5C,0x1C,0xDA,0xE2,0x8E,0x3D,0xF7,0xC9,0x2C,0xFC,
+	0xA8,0x11,0xFC,0x23,0x06,0xFB,0xA9,0x9B,0x89,0x96,0x69,
+	0x2F,0x13,0x87,0xDC,0xAC,0xF4,0x8D,0xB1,0x70,0xBC,0x10,
+	0x37,0xEB,0xF9,0xDA,0xA1,0x87,0xD3,0x4C,0x96,0xAB,0x5A,
+	0xFD,0x15,0x43,0x68,0x49,0x6C,0xEF,0x6B,0x91,0xAB,0x3E,
+	0x5B,0xA6,0x29,0x77,0xC8,0xEA,0x49,0x50,0x74,0x2F,0x17,
+	0x47,0x91,0xE2,0xDF,0x26,0x0B,0x56,0x7E,0xC4,0xF0,0x09,
+	0x8F,0x61,0x6E,0x17,0x38,0x91,0xAB,0x6C,0xE2,0x9E,0xD7,
+	0x4D,0x31,0x0F,0x9D,0x16,0x33,0x75,0xA6,0x8A,0x5E,0x29,
+	0x93,0x35,0x50,0x80,0xD0,0xDA,0x78,0x0A,0xBE,0x63,0x13,
+	0x78,0x46,0x7A,0x5F,0xB5,0x98,0xA4,0xAF,0xE2,0xA7,0x46,
+	0xE1,0x39,0x6F,0x81,0xAA,0x92,0x9C,0x90,0x36,0x5B,0xC9,
+	0xAF,0x25,0x43,0x05,0xCB,0xFB,0x61,0xDF,0x05,0x8C,0x06,
+	0xF7,0xB7,0xCF,0xC0,0x55,0xD0,0xE5,0x5A,0xEE,0xF6,0x4E,
+	0xE7,0xD4,0xAF,0xED,0xFF,0x79,0xDF,0x8B,0xB5,0x95,0x89,
+	0x3D,0xC2,0x6C,0xC4,0xCA,0x6F,0x38,0x54,0xD9,0x71,0xB8,
+	0x4D,0xEF,0xDA,0x61,0x83,0x83,0x8E,0xC7,0x25,0x27,0x0E,
+	0x9B,0x34,0xBE,0xEB,0x1C,0xF5,0xED,0x85,0x03,0x7B,0x43,
+	0x84,0xEC,0xF8,0x93,0x99,0xC0,0xD7,0xB1,0x08,0x1E,0x9C,
+	0x7D,0x5D,0x2F,0x96,0x36,0x45,0x2A,0xB8,0xCB,0x3A,0x98,
+	0xAD,0x97,0x80,0x8F,0x7B,0x0A,0xF5,0xC6,0x38,0xB5,0xF1,
+	0x3B,0x11,0x46,0x50,0x2E,0x14,0x3F,0xD9,0x27,0x8D,0xF8,
+	0x1E,0x91,0x46,0x66,0xD2,0x73,0xEA,0xD5,0x9C,0x46,0xFD,
+	0x7A,0x78,0xBA,0xB9,0xD6,0xBB,0xB9,0xEE,0xBC,0x61,0x8F,
+	0x48,0x3C,0xDB,0x72,0xEA,0xA8,0x90,0x3A,0x6F,0x8F,0xA4,
+	0xA9,0xD7,0xD4,0xDA,0x66,0xD3,0x75,0x58,0xB6,0x32,0xE2,
+	0x20,0x6B,0xEC,0xB3,0x4E,0xD3,0x96,0xE1,0xF6,0x54,0x08,
+	0x2F,0x69,0x97,0xBD,0xC4,0xEB,0xCB,0x8E,0x98,0x55,0x2F,
+	0xDD,0xDE,0x62,0x3D,0xFD,0x12,0x3E,0xE3,0xDE,0xA9,0xDE,
+	0xBF,0xE8,0x07,0x2A,0x76,0x47,0x93,0x8C,0x1A,0xC5,0x18,
+	0xED,0xCD,0x57,0x01,0xC2,0xAF,0xCC,0xD4,0x76,0x17,0x86,
+	0x36,0x68,0x61,0xB4,0x98,0x2C,0xF4,0x12,0x39,0x84,0x20,
+	0x80,0x53,0x16,0x8C,0xA8,0x18,0xD9,0x95,0x4D,0x1B,0xE8,
+	0xCA,0x5B,0x86,0x40,0xD2,0x8F,0x04,0x0C,0x6C,0x13,0x55,
+	0xD6,0xA9,0x27,0xDD,0x25,0x96,0x96,0x1A,0x25,0x9A,0x44,
+	0x50,0x5C,0xCD,0xB3,0x81,0x5F,0x6F,0xEF,0x7C,0x07,0x25,
+	0x67,0x1C,0xEE,0xA2,0x0C,0xDA,0xC4,0x61,0x11,0xFF,0x82,
+	0x6D,0x48,0xF8,0xC0,0x8C,0x0C,0x3F,0xF4,0x1E,0xB1,0x59,
+	0x7A,0x47,0xFB,0x7F,0xA7,0xE8,0x66,0x4B,0xDC,0x60,0x9B,
+	0x0A,0xB9,0xE9,0x7D,0xBF,0xA8,0xE1,0x38,0xA7,0xFB,0x46,
+	0x7A,0xBC,0xDC,0x2F,0x73,0xDD,0x5A,0x79,0x46,0x89,0x19,
+	0x19,0x79,0xFD,0x50,0x01,0xA7,0x29,0xA0,0x5D,0x1F,0xFC,
+	0x1B,0xC5,0xF9,0x57,0x30,0xA5,0x39,0xC9,0xE9,0x4F,0x65,
+	0xFB,0x26,0x53,0x44,0xBA,0x92,0x90,0xF0,0x3C,0xB3,0x17,
+	0x61,0x34,0x6F,0xA0,0xAB,0x68,0xE0,0x81,0x9B,0x63,0x6A,
+	0x28,0x6C,0x64,0x52,0x29,0xA2,0x72,0x24,0xA6,0x30,0xA6,
+	0x0B,0xE6,0x81,0x52,0xCC,0xF5,0xB8,0x86,0xEB,0xA4,0x71,
+	0x5D,0xB8,0x4E,0x63,0x67,0x5A,0x60,0x30,0xE4,0x57,0x2F,
+	0xF4,0x06,0x52,0x65,0x40,0xEC,0x3B,0xD2,0x7D,0x5F,0xC1,
+	0xCB,0xDE,0x8D,0x5F,0xEB,0x62,0x7B,0x8D,0x28,0xA3,0x81,
+	0x33,0xAF,0xCD,0x55,0x41,0x5A,0xC1,0xD6,0x86,0x62,0xBA,
+	0x33,0x74,0x6C,0x83,0x73,0x8C,0xFF,0xE3,0xEE,0x2F,0xEA,
+	0x77,0x78,0x68,0xAD,0xFF,0xA3,0x4E,0x61,0x60,0x10,0xDF,
+	0xA3,0xB5,0x93,0xEF,0xC7,0xE3,0x4A,0x6A,0x04,0xEF,0x7A,
+	0x3B,0x31,0xB2,0x08,0xAD,0xBD,0xE7,0x09,0x36,0x99,0x93,
+	0xB2,0xC2,0x9E,0x28,0xA7,0x80,0x17,0x4F,0xFB,0x06,0x2B,
+	0x23,0x7A,0x2E,0xAC,0x24,0x6B,0x6F,0x68,0x2B,0x47,0x44,
+	0xBE,0xC0,0xF1,0xAD,0xE7,0xB3,0xF2,0x90,0x79,0x6F,0x7A,
+	0x8D,0x63,0x69,0x03,0x9D,0xD3,0x83,0x5D,0x1F,0xCF,0x4A,
+	0xA7,0x6D,0x27,0xCC,0xF8,0x75,0x3A,0xC6,0x73,0x51,0xE8,
+	0xB5,0x40,0x26,0x76,0x03,0xDD,0x9A,0x26,0x36,0x0A,0x45,
+	0x44,0x66,0x72,0xB2,0xC5,0xD4,0xCA,0xE9,0x86,0xE5,0xD2,
+	0x2A,0x73,0x0C,0x21,0x01,0xC4,0xC9,0x15,0x15,0xA6,0x12,
+	0x7E,0x85,0xC1,0x40,0xC0,0x7F,0x9C,0x60,0x4A,0x52,0xC2,
+	0x9C,0x94,0xF0,0x5D,0xA9,0x0A,0xBB,0x7C,0x3C,0xDC,0x81,
+	0xFA,0xD1,0x1A,0xD2,0xF5,0xB8,0x4A,0x91,0xCF,0x04,0xD3,
+	0x5F,0x01,0x66,0x5C,0xA9,0x44,0x55,0x0C,0x3F,0x8D,0x2B,
+	0x50,0x59,0xA1,0xBD,0xA3,0x00,0x74,0x63,0x57,0xD5,0x22,
+	0xEE,0x13,0x76,0x18,0xF0,0xF4,0xD7,0x66,0xF3,0x01,0xE0,
+	0xC7,0x38,0x19,0x89,0xE7,0x88,0x05,0x2D,0xA0,0x87,0xA1,
+	0x59,0xAB,0x8F,0xF8,0x04,0x67,0xF5,0x58,0xDD,0x1A,0x2D,
+	0x35,0xC0,0x01,0x68,0xC2,0x5D,0x32,0x8F,0x5C,0x60,0xCD,
+	0x73,0x59,0x86,0xEF,0xCE,0x54,0x4B,0x4C,0xF5,0x79,0xDB,
+	0x40,0xCF,0x5B,0x2B,0x7A,0x1F,0x48,0xD6,0x0E,0x10,0xCE,
+	0x17,0xC7,0x24,0x94,0x97,0xED,0x29,0xA1,0x42,0x3B,0x15,
+	0x2E,0x52,0x12,0x31,0xDD,0x73,0xC9,0xC2,0x18,0x63,0xEF,
+	0xD3,0x31,0x3A,0x9E,0xF8,0xD0,0x90,0xB3,0x42,0x4E,0x65,
+	0x55,0x93,0x65,0xC0,0xCE,0x20,0x9A,0xD4,0x57,0x84,0xB8,
+	0xDE,0xD4,0x02,0x75,0x59,0xC5,0xE5,0xDF,0x63,0x10,0x52,
+	0x6F,0xE5,0xBB,0x68,0x5F,0x09,0x3F,0x45,0xE8,0xC4,0x95,
+	0x85,0x0A,0x25,0xE2,0xF4,0x1F,0x09,0x08,0x8A,0x8A,0xD9,
+	0x5C,0xE3,0x56,0x9C,0x35,0x58,0xBF,0xFB,0x36,0x87,0x50,
+	0x5B,0x51,0xFF,0xE5,0x65,0xEF,0x7B,0x71,0x2F,0x91,0x5D,
+	0x43,0x5C,0x40,0xCD,0xEA,0x80,0x89,0x7A,0x65,0xEC,0xF2,
+	0xB0,0xC8,0x53,0xF0,0xCE,0x5D,0x70,0xF0,0xED,0xF5,0x48,
+	0x13,0xFB,0xAD,0xD6,0x2B,0xFC,0xEF,0xD8,0x5E,0xA6,0xEC,
+	0xA2,0x08,0x51,0xA7,0xFC,0x72,0x66,0x26,0x24,0x86,0x3D,
+	0xC8,0xCB,0x40,0x95,0x60,0x08,0xCE,0x04,0x46,0xB0,0x9A,
+	0xAC,0x1A,0xF1,0xE5,0xC3,0x1A,0x32,0x2E,0xDC,0x50,0x29,
+	0x9F,0x27,0x9A,0x95,0x9C,0x99,0x02,0x3E,0xBF,0x80,0x67,
+	0xDB,0x5E,0x8E,0x9E,0x95,0xAE,0x02,0x97,0x08,0x9E,0x2F,
+	0xCF,0xCB,0x08,0xE5,0x9C,0x9B,0x63,0x3B,0x9C,0xA7,0x0F,
+	0x58,0xBE,0x56,0xD5,0x0C,0xC1,0x28,0x09,0x70,0xB1,0xE7,
+	0x49,0xFE,0xFB,0x6F,0x68,0xF7,0xAA,0x14,0xF4,0x6A,0x42,
+	0xCD,0x3B,0x08,0x9A,0x27,0xFF,0xC3,0x7D,0xB0,0xB4,0xC4,
+	0xDD,0x33,0x29,0x23,0xE0,0x26,0x62,0x18,0xD9,0x3F,0x4F,
+	0x1A,0x2B,0xA4,0x73,0x45,0xA3,0x9D,0x76,0x2F,0x89,0x1D,
+	0xC4,0x30,0x07,0x20,0x36,0x3F,0x03,0x5C,0x36,0xC7,0xDE,
+	0x6D,0xD4,0x5B,0x8B,0x08,0x67,0x20,0xE0,0xCC,0x89,0x6A,
+	0x6B,0xF8,0x91,0x88,0x53,0x93,0x7F,0x08,0x10,0xA6,0x58,
+	0xA6,0x50,0xCA,0x33,0xA2,0xFC,0x16,0xDB,0x9E,0x7F,0x63,
+	0x5F,0x29,0x4B,0xCC,0xBD,0x0B,0x27,0x9A,0x1E,0xCC,0x85,
+	0xFA,0xF3,0x70,0x3A,0x45,0x63,0x59,0xEC,0xD9,0xEF,0x9A,
+	0x06,0x31,0x0D,0x0A,0xF9,0x21,0x99,0x58,0x57,0xE6,0x34,
+	0xC6,0xC4,0x17,0xDE,0x54,0x97,0x01,0xDB,0x70,0xDC,0x97,
+	0x78,0x57,0x24,0x3B,0xC3,0x3E,0x3C,0x91,0x9A,0x4C,0xCA,
+	0x7C,0xBD,0xC2,0xBB,0x01,0x11,0x2D,0x11,0xE4,0xF6,0x15,
+	0x8C,0x3D,0xE7,0xED,0xAA,0xF2,0x82,0x80,0x2E,0xE7,0x86,
+	0xFD,0xE4,0xD0,0x2E,0xA3,0x5C,0x01,0x66,0x21,0xF4,0x26,
+	0x49,0xF5,0x6A,0x76,0x3C,0xE1,0xD5,0x8E,0x0D,0xE6,0x41,
+	0x0B,0x9B,0x0E,0x06,0x52,0x92,0x8F,0x6B,0xB5,0xD8,0x62,
+	0x54,0x6E,0x22,0x30,0xEC,0x59,0x2A,0x57,0x42,0x66,0x77,
+	0x17,0x74,0x67,0xA7,0xED,0xC3,0xFA,0x79,0x7C,0x62,0xBF,
+	0x44,0x18,0xC7,0x8F,0x2F,0x5C,0xDC,0x20,0x58,0x1B,0xE9,
+	0x2D,0xA6,0x2C,0xAC,0x5D,0xC9,0xD2,0x76,0x09,0x32,0x88,
+	0xD4,0xBE,0xE1,0x50,0x6E,0x61,0x10,0x54,0x2C,0x87,0x05,
+	0x40,0xA6,0x71,0xCA,0xC6,0x5B,0x8F,0x42,0x42,0x15,0x42,
+	0xFC,0xA2,0xFC,0xC0,0x39,0xE2,0x98,0xBB,0xBE,0x1C,0xEC,
+	0x8D,0x9B,0xA3,0xA2,0x4A,0xD3,0x20,0x86,0x18,0xC9,0x4E,
+	0x45,0xF4,0xD4,0xFF,0xF0,0xC9,0x4D,0xE1,0x5D,0xC0,0xE9,
+	0xDA,0xEB,0x6D,0x87,0x1F,0x33,0x52,0xAB,0x4D,0x3E,0xE0,
+	0xFC,0x55,0x4C,0xB4,0x83,0xA4,0x12,0x56,0x64,0xA1,0x33,
+	0xBB,0xCF,0x51,0x84,0x77,0xC5,0xA4,0xFE,0xB9,0xF2,0x8D,
+	0x0F,0x77,0xEE,0xA3,0x34,0x5B,0xDD,0xB5,0xB7,0x7E,0xC0,
+	0x61,0xF1,0xBA,0x4B,0xF5,0xB6,0xB0,0xF4,0xF4,0x78,0xE6,
+	0x58,0x95,0x8C,0x3B,0xB2,0xA5,0xED,0x0D,0xDE,0xA5,0xED,
+	0xF9,0xAE,0x16,0xB1,0xCA,0xFD,0xC4,0x28,0xE6,0xDA,0x5D,
+	0x39,0x33,0x51,0xD4,0x72,0xAD,0xED,0xA7,0xE2,0xEB,0xF3,
+	0xEC,0xAD,0xEB,0xCD,0xA9,0x36,0x38,0x5A,0x0E,0x95,0xB2,
+	0xFA,0x73,0x2D,0x46,0x19,0xFB,0x96,0xFF,0x31,0xD9,0x59,
+	0xDD,0x4C,0xF3,0xD5,0x60,0x82,0x9E,0x36,0xFF,0xBD,0xAA,
+	0xCA,0x11,0xE9,0xA3,0xF7,0xD9,0x9A,0xF1,0xC2,0x85,0x5E,
+	0x99,0xE9,0x07,0x19,0x0A,0x69,0xA6,0x11,0x42,0x18,0xF1,
+	0xC7,0x3C,0x10,0xCF,0xA4,0xBC,0xF4,0x39,0x55,0x93,0xD9,
+	0x2C,0xBA,0xAD,0x27,0xB2,0x86,0xA4,0x20,0x1B,0x46,0x8A,
+	0x06,0x90,0x50,0x6F,0x2C,0xA9,0xA7,0x50,0x87,0x3B,0xD5,
+	0x83,0xE9,0x07,0x20,0x37,0xFF,0x09,0x59,0x70,0xAF,0x73,
+	0xB4,0x2E,0xF1,0xAA,0x5B,0x57,0x9E,0xC9,0xD8,0x9C,0x2C,
+	0xDB,0xBF,0x24,0xAB,0x28,0x6C,0xFB,0xE2,0x29,0xE1,0x44,
+	0xD3,0x82,0xB7,0x1C,0x6D,0x42,0xF0,0x1F,0x9C,0x59,0x1D,
+	0xB5,0xC7,0xC5,0xAA,0xE6,0xEE,0x7B,0x9B,0x4C,0x51,0x8D,
+	0xCB,0xBA,0x33,0x26,0x10,0x09,0x69,0xC5,0x19,0x2D,0x17,
+	0x8D,0x29,0x29,0x51,0xDD,0xB7,0xD7,0x0F,0xFD,0x83,0x7F,
+	0xEE,0x23,0xC3,0xAF,0x78,0xA0,0x34,0xFD,0xD3,0x8F,0xFE,
+	0xDA,0xE2,0xBA,0x9C,0xCC,0x59,0xF6,0x15,0x5E,0x60,0x4C,
+	0xF1,0xA5,0x0B,0x45,0x8F,0x78,0x86,0xF3,0xF5,0xEA,0x7E,
+	0x1F,0x04,0xE4,0xBC,0x05,0x31,0xFB,0xC3,0xCA,0x90,0x81,
+	0xDE,0x5A,0x81,0x86,0xD1,0x57,0x52,0x26,0x42,0x20,0xCF,
+	0x68,0x7F,0x3E,0x70,0x7C,0x21,0xC5,0x71,0xDF,0xA3,0x86,
+	0x00,0x23,0x43,0xF4,0x97,0x9B,0x5B,0x06,0x09,0x60,0x9C,
+	0xA1,0xA5,0xE5,0x59,0x67,0x33,0xCB,0xF5,0x36,0xF7,0xF2,
+	0x2D,0x93,0xC9,0x3E,0xDB,0x19,0xA7,0x38,0xC9,0xE4,0x9B,
+	0x1C,0x04,0x24,0x78,0x1A,0xF6,0x73,0x20,0x49,0xD1,0xB2,
+	0x8F,0x89,0xEB,0x0F,0x53,0x54,0xD9,0xCC,0x88,0xAD,0x7D,
+	0x18,0xE4,0x1C,0x11,0x35,0x15,0xC2,0x77,0x39,0xB1,0xB0,
+	0x54,0x5F,0xCC,0xDF,0x2C,0xDB,0x50,0x74,0x9B,0xC4,0xD8,
+	0x05,0xD6,0xAE,0x40,0xC8,0xB9,0x1C,0xBA,0x57,0x12,0x74,
+	0xF2,0xB0,0xD4,0xFF,0x38,0x9A,0x14,0x1F,0x40,0x98,0xF8,
+	0x71,0x8F,0x5C,0x3F,0xB8,0x91,0x13,0xFA,0x29,0x59,0x71,
+	0xF5,0x7D,0x2D,0x13,0x91,0xE9,0x1F,0x1A,0xDD,0xE7,0xFD,
+	0xE9,0x8F,0xA2,0x00,0x85,0xD5,0x3C,0xE9,0x7F,0x91,0xD2,
+	0x9B,0xD7,0x1B,0xFD,0x89,0x4B,0x31,0x97,0xC1,0x9B,0xF1,
+	0x8A,0x76,0xBD,0x03,0x3B,0xB2,0x78,0xA6,0x0B,0xD5,0xEE,
+	0xBC,0xDC,0x23,0xEB,0xC5,0x62,0xBF,0xAE,0xF2,0x94,0xDA,
+	0x30,0x39,0xC0,0xBF,0xD0,0x54,0xC2,0x2F,0x95,0xBB,0x6A,
+	0xE1,0xAB,0x84,0x4F,0xEE,0xE3,0x52,0x6C,0x3D,0xDE,0x1B,
+	0x4D,0xA5,0x22,0xA9,0x93,0xC4,0x96,0x50,0xBA,0x9D,0x67,
+	0xA3,0x09,0xF6,0x1F,0x71,0x58,0x8F,0xC8,0x6F,0x13,0x07,
+	0x07,0x47,0xF9,0x71,0xB7,0xFA,0x9D,0xA1,0x8A,0x97,0xDA,
+	0xB5,0x6E,0x13,0x3D,0x3D,0x5D,0x71,0xDE,0x9B,0xBF,0x2F,
+	0x5A,0x37,0xF0,0x71,0x61,0x7D,0xA4,0xD4,0x26,0x60,0x73,
+	0x39,0x6F,0x7C,0x61,0xFF,0x9B,0x8B,0x7E,0xEA,0x79,0xA7,
+	0xF9,0x25,0xC5,0x3C,0x1C,0xEC,0x72,0xC1,0x5F,0x0A,0xAF,
+	0xD6,0x88,0xC2,0xC0,0x17,0x48,0xBA,0x4F,0x6E,0xB2,0x55,
+	0x08,0x84,0xBD,0x5C,0x0A,0xAF,0xD7,0x70,0xDE,0x30,0x16,
+	0xCE,0x1B,0xA8,0x27,0xA7,0xC6,0x53,0xB4,0x0B,0x1C,0x3D,
+	0x9B,0x46,0x31,0xEC,0x89,0x3B,0xE8,0xE0,0xFB,0x2A,0x1F,
+	0xA2,0x93,0x8C,0xC0,0x71,0x6D,0xA6,0x27,0x3C,0x82,0x74,
+	0x61,0xA3,0x3B,0x17,0xA7,0x89,0x50,0xC1,0xCB,0x9E,0xE2,
+	0x15,0xA1,0x8A,0x54,0x94,0x65,0x2A,0x02,0xCD,0x47,0x73,
+	0xCD,0xCC,0x7B,0xAF,0x6C,0x61,0xF9,0x0C,0xD1,0xB6,0xBE,
+	0xDD,0x73,0xDB,0x09,0x27,0xF9,0x2C,0xB4,0x46,0xF4,0x6D,
+	0x7C,0x1B,0x85,0x8B,0xD1,0xB2,0x9B,0xD0,0xCF,0xB4,0xEB,
+	0x81,0x36,0xDD,0xDC,0xD8,0xF9,0x28,0xA9,0xC4,0xA3,0x4D,
+	0x18,0x7D,0xDE,0x19,0xC8,0x9B,0x6D,0xF5,0xF0,0x55,0x47,
+	0xFF,0x64,0x47,0xE3,0x55,0xBF,0x62,0x14,0x73,0xFB,0x30,
+	0x50,0x12,0x5A,0x2C,0x10,0x5E,0xF2,0xB0,0x6A,0x3B,0x7C,
+	0x6B,0x3A,0xDA,0x05,0x1F,0xCC,0xC3,0x98,0x56,0x8C,0x89,
+	0xED,0x9F,0x97,0x94,0xC8,0x34,0x7D,0xA7,0x1D,0x71,0x4C,
+	0xB8,0xFC,0xE9,0x35,0xDD,0xD4,0xE0,0x27,0x72,0xDC,0x7A,
+	0x92,0x90,0x09,0xC0,0xCF,0x31,0x7E,0xA9,0x19,0x16,0x39,
+	0x0A,0xF2,0xDF,0x18,0x38,0x61,0x12,0xE4,0xA3,0xE0,0x60,
+	0x82,0x34,0xCC,0xC5,0xDE,0x28,0x75,0x8F,0x62,0xE0,0x8E,
+	0x4A,0x20,0x35,0xC2,0xE1,0x61,0x8D,0xBB,0x33,0x17,0x53,
+	0x03,0x77,0xB2,0x2C,0x85,0x3F,0xB5,0x27,0x4A,0x0B,0x3C,
+	0xA5,0x71,0xFD,0x9E,0x4D,0x3D,0x13,0x88,0x46,0x41,0x13,
+	0x64,0xE1,0x29,0xAB,0x75,0x7E,0x0A,0x11,0xE9,0xC1,0xCF,
+	0x80,0x6A,0x67,0x92,0xE1,0x73,0xC8,0xFD,0x83,0xF9,0x9A,
+	0x90,0xB4,0x1F,0x29,0x70,0x08,0xE9,0x93,0x12,0x84,0x97,
+	0xE2,0x0D,0xC5,0xA8,0xA2,0x9A,0x40,0xE1,0xAF,0x04,0x30,
+	0xFB,0xF2,0xEF,0x33,0x82,0x5F,0x11,0x88,0x21,0xDC,0x10,
+	0xF8,0x0A,0xB5,0x43,0x31,0x13,0x45,0x96,0x05,0x55,0x62,
+	0x2B,0x88,0xCF,0x6D,0x2F,0x04,0xF0,0xBF,0x2B,0xD2,0xEF,
+	0x15,0x2A,0x4C,0x61,0x2C,0xC2,0x71,0x0E,0xB7,0xD8,0xFA,
+	0xFC,0x5E,0xC3,0x25,0x54,0xE1,0xFE,0xD7,0x01,0x9C,0xB2,
+	0xE0,0x22,0xB3,0x00,0xBF,0x78,0xDB,0x62,0xB0,0xF7,0xB2,
+	0x18,0x06,0x52,0x84,0x81,0x4D,0xDE,0xE3,0x19,0xFA,0xA0,
+	0x6E,0x71,0xC2,0xF4,0x7F,0x9B,0x0E,0x15,0x68,0x6F,0x5F,
+	0x24,0xF8,0x3F,0xCD,0x8B,0xC4,0xE4,0xA5,0x3B,0x4D,0x59,
+	0xA4,0xF4,0xE6,0xDD,0x59,0x67,0x1F,0xC4,0x06,0x27,0x55,
+	0x8C,0x7F,0xD7,0x2A,0xF9,0x56,0x7D,0x65,0x5B,0x71,0x59,
+	0x8B,0xBF,0x77,0x70,0x69,0x13,0x0C,0x45,0xD3,0x3F,0x35,
+	0xD4,0x17,0xB3,0xAB,0x16,0x70,0x6A,0x77,0xE8,0xD9,0x46,
+	0xC3,0x3C,0x3A,0x2F,0x16,0x4A,0xD9,0x55,0xA8,0x6A,0x7E,
+	0xF1,0x0B,0x4A,0xA8,0x23,0x10,0xD1,0xD7,0x69,0xF3,0xFD,
+	0x99,0x7C,0x68,0x6A,0xA8,0x9D,0xBE,0x69,0x6A,0x3C,0xC8,
+	0x3D,0xF0,0x1B,0xF0,0xFA,0x5B,0xD3,0x20,0x90,0x1E,0xC6,
+	0x34,0x31,0x7F,0xC0,0x9D,0x10,0xC6,0xB7,0x15,0x09,0x4F,
+	0x89,0x54,0x57,0xE3,0x4B,0xD8,0xA0,0x57,0x75,0x51,0x86,
+	0xC9,0x35,0xC7,0x97,0xF5,0xB1,0x22,0x99,0x67,0x16,0xD3,
+	0xD1,0x26,0x9A,0x62,0x79,0xE0,0x85,0x99,0xEE,0xDF,0xFC,
+	0x13,0xB1,0x07,0x5A,0xA1,0x6C,0xE5,0x90,0x8F,0xA8,0x1A,
+	0x8C,0xE5,0x97,0x84,0x7F,0x18,0xFE,0xD8,0xE5,0x8D,0x78,
+	0xEF,0xB9,0x3B,0xD3,0x5A,0xDE,0x11,0xB3,0x5A,0x5B,0x6A,
+	0x18,0xAC,0x0B,0x2B,0x62,0xCC,0x1D,0x3B,0xA2,0x4F,0x2F,
+	0x21,0x63,0xBC,0x70,0x09,0x0C,0x6C,0xD4,0xD7,0x74,0x67,
+	0xEF,0x27,0x1C,0x8C,0xD8,0x17,0xBC,0xC9,0x9A,0x7B,0xB1,
+	0xC3,0xA8,0x0F,0xE8,0xD7,0xE8,0x29,0x7E,0x7E,0x40,0x15,
+	0x85,0x95,0xEC,0xC9,0xF9,0x82,0x02,0x31,0x42,0x50,0x55,
+	0x7D,0x51,0xB4,0x34,0x44,0xFF,0x48,0xF8,0x9B,0xC2,0xCE,
+	0xFC,0x6E,0xA4,0x37,0xD9,0x4C,0x5A,0xF1,0x49,0xF7,0x00,
+	0xF2,0x3C,0xCF,0xF1,0xFE,0x8F,0x14,0x22,0xB7,0x25,0x57,
+	0x98,0xBE,0x01,0xBA,0x1C,0x8E,0x40,0x17,0x10,0xD4,0xE7,
+	0x5E,0x8B,0x07,0xF6,0xCA,0x08,0xEB,0xE9,0xB2,0x1F,0xAF,
+	0xD2,0xFC,0xFC,0x21,0x7E,0x41,0x5B,0x7E,0x6A,0x3D,0x59,
+	0x03,0x5C,0xF2,0xC5,0x28,0x72,0x4F,0xD9,0xD3,0xC4,0x75,
+	0xA5,0x19,0xEC,0x80,0xEC,0x7F,0xBD,0xF2,0xDF,0xEB,0xE4,
+	0x62,0x9F,0x61,0xA0,0xA3,0xD8,0x60,0x6A,0x67,0xA6,0x88,
+	0x32,0xB1,0xFE,0xC0,0x7A,0xCF,0x86,0x5C,0x23,0x23,0x8B,
+	0xA8,0x7E,0x6A,0x23,0x7D,0x3D,0x25,0x4D,0xF7,0x2D,0x6B,
+	0x43,0x7C,0xDD,0x03,0x65,0xF6,0x69,0x19,0xB4,0x0C,0xB3,
+	0xF6,0xF2,0x2F,0x7B,0xAE,0x1A,0x25,0x58,0xE9,0xA3,0xC3,
+	0x67,0x91,0x8F,0xEB,0xA4,0xF7,0x02,0xD5,0xCB,0x22,0xAF,
+	0x48,0x2F,0xF5,0x4F,0x86,0x20,0xC7,0x11,0x56,0xCF,0x9F,
+	0xAC,0x8E,0x6F,0x35,0x41,0x6E,0x1C,0xE4,0xB7,0x5D,0x40,
+	0xB6,0xA4,0x49,0x7B,0xFD,0xF1,0x66,0x83,0x0A,0x8A,0xA1,
+	0xB0,0xC6,0x04,0x18,0x20,0xFA,0xE5,0x13,0xA4,0x5C,0x7B,
+	0x45,0x5E,0x69,0x33,0x63,0xC0,0xF7,0x34,0x3A,0xFD,0x39,
+	0x36,0xCD,0x35,0xB3,0x0E,0x0F,0x71,0x38,0xF4,0x6F,0xEF,
+	0x02,0xEC,0xBA,0x6D,0xD4,0x7D,0x94,0x53,0x5E,0xD6,0xD6,
+	0x23,0xED,0xEB,0xB0,0xAD,0x8F,0xD4,0xD4,0xF5,0x9B,0xA2,
+	0xD0,0x5A,0x02,0xD0,0xD1,0x00,0x83,0xA6,0xF8,0x0E,0x20,
+	0x43,0x8D,0xBB,0xF2,0x07,0xDB,0x32,0x45,0x2F,0xA7,0xED,
+	0xDE,0xCF,0xF3,0x80,0x48,0xDC,0x84,0x65,0xF6,0xDA,0x5C,
+	0x18,0x5D,0xF0,0xD3,0x69,0x9C,0x78,0x4F,0x87,0xBC,0x6F,
+	0xF4,0x78,0xA9,0x51,0x2D,0xEA,0xE4,0x47,0x63,0x93,0x45,
+	0x91,0x10,0xE8,0x58,0x66,0xC4,0xE3,0xED,0x6B,0x51,0x6B,
+	0x2D,0x44,0x02,0xE3,0xAA,0x67,0xC6,0x80,0x1D,0x72,0x42,
+	0x4F,0xFC,0x9C,0x31,0xD0,0x64,0x22,0x2F,0x6C,0xEC,0x0F,
+	0x6B,0x76,0x24,0xF4,0xF1,0xDD,0x6E,0x78,0x7B,0xC1,0x86,
+	0x84,0xA6,0x67,0x20,0x4E,0xEA,0x7E,0xEE,0xBA,0x18,0xFA,
+	0x82,0x85,0x12,0x30,0xB0,0x6F,0xB3,0x57,0x2C,0x25,0x8D,
+	0x2B,0x3D,0xD0,0x63,0xC3,0x3A,0xDE,0x76,0xA4,0xC8,0x7A,
+	0x87,0x9D,0x29,0x4B,0x59,0xB9,0xB8,0x16,0x48,0x4E,0xF4,
+	0x95,0xED,0x0F,0x04,0xFD,0xC3,0x51,0xAA,0xEA,0xEE,0x4E,
+	0xC8,0x5E,0x95,0x25,0xAD,0x8E,0xAD,0x8B,0x57,0x24,0x1E,
+	0xCA,0x2A,0x78,0x43,0x10,0x3D,0x1D,0xC8,0x82,0x5E,0x64,
+	0x36,0x75,0x12,0x4F,0x97,0x3D,0x0A,0xE9,0x94,0x48,0xB2,
+	0x4A,0x45,0x96,0xFF,0x76,0x91,0xDD,0x8C,0x37,0x4A,0x8F,
+	0x04,0x23,0x32,0xFD,0x84,0x92,0xB4,0xF9,0x7F,0x0F,0xC8,
+	0x2A,0x8D,0xC8,0x24,0x89,0x40,0x8A,0xBE,0xF7,0xC9,0xD8,
+	0xF5,0x46,0x27,0x98,0xDE,0xB0,0x13,0x4D,0xAE,0x96,0x71,
+	0xC9,0x26,0xBE,0xBA,0x20,0x9E,0x87,0xB1,0x7C,0xC9,0x22,
+	0x4F,0x18,0x5B,0x64,0x16,0x1C,0xB7,0x94,0x12,0x17,0xB5,
+	0x1F,0x3E,0x23,0x33,0x09,0x21,0xFB,0x5A,0x5C,0x88,0x19,
+	0xD3,0x59,0x7C,0x88,0x31,0xD2,0x1E,0x13,0x27,0xBD,0x59,
+	0xB6,0x77,0x34,0xB6,0x8F,0xCD,0x8C,0x78,0x09,0xD9,0x19,
+	0xE5,0x4A,0x50,0xFE,0x97,0x19,0x45,0x6A,0x7F,0x9F,0x55,
+	0x73,0xCD,0xAE,0x3C,0x98,0xB7,0x23,0xC9,0x75,0x25,0x20,
+	0x9A,0xE5,0x25,0xD1,0x97,0xCE,0x59,0x54,0x2F,0xE6,0xE5,
+	0x30,0xD3,0xCE,0x90,0xDC,0x1B,0x7C,0x3F,0xB2,0x44,0x78,
+	0x2A,0x54,0xB9,0x66,0x23,0xB1,0xA4,0x57,0xE4,0xF4,0x74,
+	0xDF,0xF6,0xD8,0xC1,0x7E,0x59,0x4D,0xDB,0xEA,0xB4,0x7E,
+	0x11,0x37,0x05,0xFC,0xE0,0x73,0xE4,0x46,0x4C,0xFE,0xC3,
+	0x4C,0x21,0x84,0xF7,0x66,0xCB,0x3F,0xDA,0xA6,0xFE,0x33,
+	0xFB,0x0F,0x11,0x72,0xB9,0x6A,0x88,0x74,0x1F,0x8A,0xA4,
+	0x84,0x74,0x4B,0xAE,0x57,0x61,0x93,0x7A,0x87,0xED,0x0F,
+	0xD6,0xE5,0x50,0xB5,0x49,0x16,0x28,0x1F,0x53,0xD4,0x76,
+	0x76,0x3D,0xE6,0x7A,0xBC,0x34,0x19,0xE6,0xD8,0x0B,0x69,
+	0x02,0x09,0x95,0x6F,0xA0,0x2D,0x5E,0x09,0xFC,0x3E,0x91,
+	0x40,0xCB,0x6F,0x61,0x50,0xEB,0x20,0xBD,0x7E,0x5B,0xEC,
+	0xA3,0xEE,0xD5,0x6B,0xDB,0x76,0x0E,0xE3,0xE2,0x2B,0xB7,
+	0x96,0xFE,0x6C,0xE4,0x4C,0x69,0x36,0xAB,0xA3,0x71,0x2B,
+	0x88,0x05,0x91,0x7F,0xE0,0x4F,0x55,0x1A,0xE6,0xF7,0xD8,
+	0xDE,0x70,0x56,0x2F,0xBB,0x8F,0xFD,0x7B,0x00,0xD3,0x1F,
+	0xA5,0xD2,0x6B,0x36,0xCA,0x63,0x2F,0xF1,0x9F,0xA2,0xDE,
+	0xB1,0xFF,0x92,0x5E,0xC0,0x3D,0x23,0x17,0x0A,0x01,0xA3,
+	0x31,0x9C,0x59,0x93,0xC9,0xD9,0xB8,0x27,0x94,0xAB,0x44,
+	0x0D,0xD4,0xF8,0xE2,0xA6,0xD5,0x1D,0x69,0xBD,0x12,0x4A,
+	0x16,0x01,0x6F,0x7B,0x22,0x99,0xF3,0x1D,0x28,0x94,0x4B,
+	0xFF,0x37,0xD7,0x32,0x60,0xEF,0x1B,0xA2,0x46,0xAF,0x7F,
+	0xBD,0x10,0x84,0xEC,0xE5,0x6D,0x73,0xCF,0xD3,0x9B,0x4A,
+	0xF4,0xD7,0xBD,0xD6,0x2F,0x77,0x15,0xFF,0x35,0xC6,0x30,
+	0x31,0x58,0xBF,0x5D,0x1D,0x3C,0xF9,0xF6,0xC5,0xF3,0xEA,
+	0x7F,0x83,0x65,0xB0,0xE8,0xF6,0xF8,0x58,0xBE,0x09,0x7F,
+	0x57,0x7B,0x46,0xE5,0x4D,0xE6,0x0C,0xF9,0xF7,0xAF,0x99,
+	0x24,0x3B,0x7D,0xA7,0xED,0x34,0x60,0x32,0xD6,0x5C,0xCC,
+	0x9F,0xB5,0xE6,0x3E,0x49,0x76,0xC9,0xC0,0xE8,0x3A,0x3B,
+	0xAA,0x0A,0x59,0x9B,0xF7,0xC6,0x09,0xEA,0x7B,0x26,0x38,
+	0xAA,0x38,0xCC,0x71,0x9D,0xF4,0x0A,0x7D,0xEF,0xE5,0xFF,
+	0x94,0x38,0xBC,0x5D,0x09,0x88,0x37,0xC5,0xF1,0xED,0xAC,
+	0x85,0x25,0x22,0x5F,0xC5,0x2B,0x7D,0x70,0xA6,0xD4,0x1F,
+	0xB9,0x21,0x70,0xAD,0xB9,0xE3,0x81,0xCB,0x59,0xD8,0xA0,
+	0xCA,0x80,0x47,0x2D,0x4A,0x55,0xF7,0x32,0xBE,0x47,0x3B,
+	0x6F,0xA3,0x3B,0x4B,0x0C,0x6F,0x20,0xD6,0xCF,0xEC,0xB0,
+	0xA6,0xC4,0x7A,0xCE,0x19,0x48,0x75,0xC2,0x55,0xBA,0x80,
+	0x25,0x3C,0xC1,0x29,0x40,0xFD,0x30,0x73,0x7E,0xD4,0xE0,
+	0x3E,0x68,0x7F,0x0A,0xDC,0xE9,0xD5,0x66,0x18,0x55,0xC1,
+	0x8F,0x5E,0x84,0x2E,0xBF,0xE0,0xA9,0x49,0x0E,0x7C,0x92,
+	0xDD,0xAF,0x86,0x2F,0xD8,0xE6,0x4A,0xDE,0xDE,0x3D,0xFE,
+	0x0B,0x84,0xEF,0x1D,0x90,0xC6,0xBE,0x4D,0xC2,0x89,0x27,
+	0x1A,0x9A,0xC5,0xAB,0xF6,0x1E,0xAC,0x82,0xC7,0x56,0x86,
+	0x42,0xE1,0x18,0x23,0xA9,0xDF,0xE9,0x2D,0xEC,0x3B,0x7C,
+	0x90,0xD9,0xAE,0x6D,0x4F,0x96,0x3E,0x32,0x77,0x82,0x35,
+	0x1B,0x50,0x11,0x16,0x0D,0x3F,0x81,0xA3,0xE8,0xB2,0x9C,
+	0xB0,0xAF,0x9D,0x9B,0xE0,0x58,0x82,0x8B,0x77,0x3E,0x51,
+	0xE8,0xB1,0x77,0xAB,0xD3,0xD8,0xA2,0x82,0xC4,0xF0,0x6A,
+	0x33,0x97,0x48,0x37,0xA0,0xBD,0x57,0x7F,0xF1,0xE4,0xAF,
+	0x30,0xCF,0x5B,0x7A,0x11,0x55,0x95,0x0C,0xC8,0x7C,0xD3,
+	0x7C,0xA4,0x76,0x5A,0xD1,0xC8,0xA2,0x5A,0xD1,0xCC,0x40,
+	0x11,0x93,0x08,0x1E,0xEB,0x0F,0x4E,0xDD,0x55,0xE9,0xBE,
+	0xD1,0x8A,0xF1,0x10,0x74,0xEB,0x12,0x2A,0x88,0x2D,0xA0,
+	0x5E,0x64,0x41,0x8E,0x45,0x6F,0x3E,0xEF,0x92,0x4A,0xDB,
+	0x51,0x61,0x80,0x11,0x70,0x35,0xB5,0x03,0x87,0x56,0xC8,
+	0x68,0xBE,0x41,0x82,0x46,0x1A,0x57,0x33,0x76,0x3F,0x7F,
+	0xF3,0x13,0xAC,0x8F,0x34,0xC1,0x58,0x76,0xFB,0xF9,0x83,
+	0xB5,0x7D,0x20,0x8A,0x50,0x9A,0x33,0xBE,0xB1,0xF9,0xB9,
+	0xB8,0x54,0xE4,0xBB,0xD0,0xF8,0x3E,0x03,0x44,0x57,0xDC,
+	0x82,0x63,0x12,0x72,0x73,0x7B,0x7A,0x73,0x32,0x73,0xDA,
+	0xDB,0x07,0xC9,0x40,0x18,0xE1,0x67,0xBE,0xA4,0xB8,0xB4,
+	0x3B,0x8C,0x09,0x42,0x43,0x49,0x52,0xEC,0xD3,0x4B,0x75,
+	0x7C,0xEC,0x98,0x78,0x31,0x6B,0xFC,0xE4,0x3E,0x29,0x4E,
+	0x83,0xD1,0x8B,0xD6,0x63,0xAA,0x84,0x58,0x8B,0x8E,0x7B,
+	0x77,0x7E,0xBB,0xB0,0xF7,0x90,0xDE,0x62,0xC4,0xEB,0x82,
+	0xEC,0x07,0x1F,0x6E,0x52,0xA7,0xAE,0xEF,0x6F,0x34,0x92,
+	0x98,0xB0,0xB4,0x69,0xD3,0xD4,0x4C,0x80,0x5D,0xD6,0x58,
+	0x1C,0x43,0x1E,0x14,0xA0,0x2F,0x45,0xBA,0x03,0x60,0xC3,
+	0x88,0xF3,0x6B,0xA7,0x15,0x5E,0x9A,0x29,0x9A,0x74,0xF5,
+	0x5C,0x1D,0x50,0x21,0xFA,0x6A,0x5E,0xA5,0xF6,0xC2,0x16,
+	0x20,0x41,0x4E,0x07,0xEE,0x4A,0x8A,0x9B,0x9E,0xAE,0xB6,
+	0x5F,0x8E,0xC5,0x69,0xFE,0xF0,0xCA,0x9C,0x3A,0x77,0x84,
+	0xC3,0x15,0xBD,0x73,0x0A,0x7E,0x03,0x5E,0x8F,0x42,0xE5,
+	0x3E,0x4C,0x34,0x44,0x32,0xAA,0xD9,0x38,0xE6,0x89,0xE3,
+	0x96,0x3A,0x59,0xB1,0x07,0xBB,0x4A,0x1A,0x48,0x7F,0x9E,
+	0x11,0xD9,0xC8,0xE7,0x07,0xFA,0xE0,0xAB,0xA1,0xA6,0xFA,
+	0x5D,0x52,0xAE,0xFC,0x56,0x33,0xA0,0x70,0xCA,0x2B,0x6D,
+	0x37,0x2E,0x1D,0x9E,0x2A,0xC0,0x70,0x1F,0x23,0x72,0xB7,
+	0x43,0x8D,0x61,0x4C,0xF1,0x12,0xA8,0xF8,0x47,0x8C,0xB1,
+	0x38,0x49,0x88,0xAF,0x98,0x03,0xF0,0x1A,0x20,0xAD,0xCD,
+	0xC8,0x14,0x62,0x0B,0xAC,0x25,0x79,0xCE,0xD8,0x8C,0x39,
+	0x5D,0x6B,0x65,0x7B,0x86,0xE0,0xEF,0x45,0x64,0x98,0xB4,
+	0x6C,0x92,0x04,0xE9,0x33,0xE2,0xDE,0x80,0x17,0x2D,0x11,
+	0xD4,0x33,0x55,0x4C,0x23,0x78,0x41,0xAA,0x81,0xB0,0x5B,
+	0x42,0xE5,0x47,0x48,0x51,0x4F,0x52,0xF9,0x98,0x8F,0xDD,
+	0x9E,0x21,0xA6,0xFC,0x2C,0x40,0x94,0x01,0xAD,0x33,0x93,
+	0x5E,0xF5,0xED,0x6B,0x10,0xD0,0x36,0x14,0x0B,0xA1,0x68,
+	0x31,0x1B,0x50,0x23,0x3F,0xA3,0xBE,0xF7,0xCB,0xA7,0xE6,
+	0xED,0x2C,0x5C,0x54,0x1C,0xD6,0x86,0x1D,0x7D,0xB0,0xC1,
+	0x3C,0xA9,0xBF,0x79,0x67,0x44,0x3B,0x5E,0xD9,0x89,0x3F,
+	0x4F,0x7A,0xA9,0x6D,0x08,0x46,0xE1,0x18,0x6A,0x15,0x71,
+	0x82,0xEA,0x09,0xC6,0x7C,0xB2,0xCA,0x88,0x8F,0xD4,0xAE,
+	0x58,0x9A,0xE9,0xE3,0xE0,0xD6,0x96,0x77,0xE2,0x36,0x83,
+	0x41,0x29,0x88,0xB6,0x01,0x35,0xB3,0x41,0xD1,0x78,0xA1,
+	0x54,0xD0,0x2C,0x0E,0x67,0x82,0xF4,0x12,0x31,0xBA,0x33,
+	0xA6,0x2F,0x6A,0xE6,0xAF,0x59,0x27,0xC6,0xC5,0x06,0x1B,
+	0x55,0x44,0x18,0xF2,0xDA,0x45,0x47,0xB5,0xF7,0x19,0xD1,
+	0xFE,0x4B,0x5E,0x6D,0x5B,0xE6,0x3B,0xEF,0xFD,0xD7,0xA4,
+	0xFD,0xA0,0xA0,0xCA,0xB3,0x1D,0xC7,0x7E,0x06,0x4E,0x59,
+	0xE9,0xBD,0x52,0x09,0xF8,0x2E,0x0A,0xD4,0xF5,0xCD,0x9C,
+	0xAF,0x1A,0xD7,0x2E,0x3D,0xFE,0x5A,0x5B,0xD9,0xF3,0xBF,
+	0x3B,0xE4,0x7B,0x77,0x10,0xED,0x90,0x26,0x06,0xBC,0x66,
+	0x66,0x00,0x39,0x6A,0x3A,0xA8,0x3D,0xBD,0xED,0x2E,0xA6,
+	0xD4,0x15,0x5E,0x87,0xD9,0xFE,0x4A,0x8B,0x92,0xFF,0x6A,
+	0xB9,0xB4,0x47,0x2B,0x5D,0x32,0xCB,0x9B,0x9C,0x87,0x6D,
+	0x6D,0xBE,0x5B,0x92,0xD9,0x2A,0xA9,0xE3,0x7F,0x95,0x29,
+	0x6D,0x26,0x87,0xCF,0xC0,0x4B,0x90,0x3B,0xBF,0x4A,0x6B,
+	0x20,0x8C,0x28,0xBD,0x1D,0x3E,0xF0,0x2B,0x01,0x62,0x71,
+	0xA5,0xA6,0xA3,0x67,0x52,0xA2,0xA5,0xCD,0xFC,0x7A,0xEF,
+	0x8A,0x94,0xF6,0x30,0xDE,0xF4,0x3E,0xA4,0xE9,0xAB,0x04,
+	0xAE,0x51,0x00,0xA3,0x92,0x43,0x97,0xF0,0xDF,0xFA,0x9C,
+	0xEB,0xB7,0xAD,0x17,0xC8,0x57,0xB0,0xF8,0xB6,0x1D,0xBB,
+	0xC9,0xDD,0x8A,0x5D,0x1D,0x51,0x15,0xA3,0x05,0x08,0x29,
+	0x36,0x39,0xB4,0x59,0x69,0x87,0xEE,0x99,0x6E,0xF4,0xA6,
+	0x31,0x75,0x9B,0x84,0x2C,0x3C,0xEE,0x41,0x13,0x04,0xD4,
+	0xDD,0x5C,0xC0,0xF5,0x3A,0x9C,0x57,0xDC,0xCE,0x71,0xAF,
+	0x58,0x31,0xF5,0x48,0x0B,0x89,0x66,0x92,0x2F,0x2F,0x76,
+	0x0C,0x9D,0xB0,0x9B,0x1E,0x1B,0x7B,0xB2,0xF9,0xA6,0xF1,
+	0x2C,0x1C,0x45,0xA7,0x0A,0x97,0xD2,0x8C,0x59,0x35,0x1F,
+	0xD7,0x60,0x26,0x75,0x50,0xA6,0x8C,0x5E,0x28,0xE9,0x0F,
+	0x63,0xCA,0xCF,0x4B,0xE2,0xE2,0xD8,0xBB,0xB9,0x3B,0x30,
+	0xF6,0x13,0xFE,0x23,0x9B,0x65,0x50,0x33,0xEF,0x52,0xF9,
+	0x3E,0x97,0x9B,0xD2,0x70,0x1B,0x59,0x7E,0x0A,0x5A,0x31,
+	0x33,0x18,0x3A,0xEF,0x88,0xDB,0x67,0x9C,0x39,0x41,0x4C,
+	0x3A,0x98,0xCA,0xC3,0xD3,0x80,0x23,0xD7,0x7E,0x72,0xF1,
+	0xA2,0x56,0xBF,0x88,0x99,0xC7,0xCF,0xB7,0x5C,0xB3,0xF0,
+	0xA3,0x82,0xD6,0x21,0x61,0x8A,0x02,0x48,0xC0,0xC4,0xF3,
+	0x61,0xF8,0x93,0x71,0xDA,0xA9,0x29,0x29,0xA5,0x17,0xB6,
+	0x81,0x29,0x27,0xAD,0x9F,0xE7,0xC1,0x39,0x1D,0x6E,0x15,
+	0x54,0xA2,0x07,0x37,0x88,0x08,0x39,0x14,0x61,0x40,0x60,
+	0x89,0x46,0x9B,0x72,0x4A,0x01,0xC8,0x19,0x2D,0x65,0x8D,
+	0x7C,0xF6,0x19,0x41,0xF3,0xE4,0x17,0x7C,0xDE,0xC1,0x8A,
+	0x19,0x6E,0xD9,0x59,0x9A,0x25,0xE2,0xC5,0x7D,0xDE,0xC9,
+	0x78,0xD4,0xFD,0xD8,0xE0,0xC9,0x2D,0xCF,0x30,0x03,0x15,
+	0x61,0x0D,0x45,0x1A,0xEE,0xA8,0x4A,0x6E,0xB9,0xE5,0xA5,
+	0x44,0x91,0xBF,0xD8,0xC5,0x2C,0x6E,0x46,0x93,0xB7,0x15,
+	0xDE,0xEC,0xFD,0x59,0xD0,0xEB,0xE1,0x5C,0x29,0x46,0x8A,
+	0x5E,0x31,0x2E,0xEA,0xF7,0x08,0xAD,0xD1,0xFD,0x4C,0x16,
+	0x2B,0x3B,0xBC,0x6B,0x31,0xBB,0x9B,0xDF,0x8D,0x1D,0x64,
+	0xC4,0xB5,0x9C,0x09,0x50,0x08,0xE0,0x5A,0x9B,0xFF,0xD9,
+	0x1C,0xB7,0x4B,0x58,0x33,0x5D,0xD2,0x79,0x98,0x7F,0x37,
+	0x39,0xBF,0x0F,0x3B,0x0F,0x0E,0x64,0xCF,0xB8,0xAC,0xBA,
+	0x6B,0x4F,0xBC,0x87,0xD3,0xB3,0xD7,0xE7,0xFA,0x4D,0x44,
+	0x11,0x0F,0x23,0xB5,0x11,0x98,0xF9,0x89,0x45,0xC3,0x05,
+	0x26,0xE7,0x0B,0x6B,0xEA,0x7E,0xAA,0x81,0x09,0xF3,0xA3,
+	0xD4,0x8B,0xA8,0x95,0xDF,0xD5,0xD2,0x7F,0x72,0x46,0x99,
+	0x6F,0xE3,0x4F,0xE4,0xF7,0xCA,0x3F,0x28,0x2A,0x47,0x05,
+	0xFB,0x66,0x20,0xCC,0xAF,0xDF,0x90,0x2E,0xA0,0xE6,0x1D,
+	0xCC,0x53,0x92,0x26,0xAE,0xA7,0x20,0x7D,0x65,0x14,0x91,
+	0x19,0x5A,0x92,0x4B,0xEE,0x0D,0x7A,0xF1,0xAC,0xDF,0x54,
+	0xD9,0xB6,0x6A,0xFD,0x3E,0x5A,0xBA,0x9F,0xB3,0xA9,0x6E,
+	0x9E,0x75,0xD8,0x95,0x60,0x2F,0xC2,0x98,0x82,0x14,0xF4,
+	0xF1,0x4B,0x14,0x4C,0x07,0xD6,0x5D,0xC6,0x0C,0x12,0xAD,
+	0xB1,0x94,0x12,0xC3,0x47,0x14,0xE6,0x13,0x16,0xAF,0x13,
+	0xCA,0x95,0x0A,0x9C,0xEE,0xAD,0xC5,0x50,0x9E,0xEE,0x0C,
+	0x58,0xAF,0x1D,0x83,0xC5,0xFC,0x1E,0xA3,0xAF,0x92,0x75,
+	0xD6,0xF5,0xFE,0xFE,0x99,0x97,0x37,0x56,0x88,0x15,0xD9,
+	0x30,0x56,0x4C,0x10,0x24,0xAF,0xFC,0xD1,0x23,0x72,0x36,
+	0x2E,0x81,0xE5,0xE5,0xA2,0xDB,0x6A,0x2F,0xC8,0x21,0x0B,
+	0x3A,0xFC,0xE9,0xD9,0x17,0x88,0x2D,0x7B,0xBA,0x0F,0xC9,
+	0x7E,0xC6,0x01,0x71,0x14,0x4C,0x1D,0x49,0xBA,0x77,0xBF,
+	0x40,0xFA,0xBC,0xBD,0xCA,0xCD,0xCD,0x9B,0xEE,0x52,0xA0,
+	0xC2,0xB9,0x4B,0xF0,0x4B,0x56,0xB5,0x38,0x44,0x13,0x0A,
+	0x4A,0xF0,0xC7,0x65,0x06,0xE1,0x66,0x20,0xB9,0x4A,0xB9,
+	0x11,0x6A,0xB9,0x4D,0xDA,0xB9,0x06,0x1B,0xB9,0x70,0x69,
+	0xEB,0xB7,0x2E,0xE7,0x56,0x4F,0x40,0x3C,0xBF,0x9B,0x0E,
+	0xA7,0x07,0x0D,0xC4,0xE0,0x4E,0xB9,0x35,0x15,0x12,0xCC,
+	0x8B,0x40,0xF0,0x18,0x59,0xC6,0xB7,0xE7,0x52,0x11,0x21,
+	0x08,0x73,0xFF,0xE5,0x5B,0xA0,0xA7,0x20,0x83,0x44,0x91,
+	0x94,0xBA,0x89,0x55,0xFE,0xA1,0x48,0x81,0xFC,0x60,0x65,
+	0x47,0xAA,0x8D,0xAE,0xCE,0xFD,0x52,0x5A,0xC3,0x2B,0x53,
+	0x75,0x44,0x9F,0xFD,0x76,0x5E,0xDF,0x88,0xC4,0x6E,0x8D,
+	0x1C,0xFF,0x5B,0xCE,0xC0,0xBC,0x8E,0xA3,0x60,0xEF,0xAD,
+	0x3F,0x7C,0x11,0x7C,0x46,0x6A,0x6E,0x15,0xC1,0xF2,0x9D,
+	0xAA,0x72,0x64,0x1E,0x03,0x95,0x8F,0x1E,0x35,0x8B,0xFA,
+	0xA7,0xF0,0x10,0xF1,0xD3,0x8B,0x64,0x9C,0x5E,0xB9,0xC4,
+	0xB1,0xC6,0x9B,0x31,0x1F,0xE5,0x73,0x11,0xB9,0xF5,0xB2,
+	0xB9,0xA3,0xB9,0xB9,0xE1,0xD2,0xF9,0xCF,0x2F,0x1D,0x22,
+	0xD5,0x43,0x51,0xA3,0x38,0x42,0xF8,0x0E,0x5C,0x1D,0xFA,
+	0x80,0x2F,0xBC,0x21,0xAF,0x55,0xE0,0x5D,0x60,0x85,0xF7,
+	0xC8,0xC5,0x42,0xEF,0x10,0xBC,0x7A,0x30,0xCB,0xB8,0x17,
+	0x6F,0x1D,0xF3,0xB8,0x4F,0xC0,0xA9,0x33,0xE7,0xE5,0x8A,
+	0x41,0xF8,0xB1,0x28,0x0E,0xCF,0x33,0x85,0x07,0xEB,0xF4,
+	0x00,0x72,0xF5,0x66,0xB3,0x25,0xFF,0xCB,0x9A,0xAB,0x78,
+	0x52,0xE2,0x20,0xD8,0xD0,0x77,0x3C,0x04,0x13,0x89,0x96,
+	0x4B,0xFD,0x22,0x73,0xC2,0x6A,0xEC,0xA9,0x24,0xF9,0x17,
+	0xAD,0x69,0x0A,0x1A,0x20,0x13,0xBC,0x51,0xAC,0x90,0xE6,
+	0x18,0x6A,0x96,0x13,0xDF,0x60,0x91,0xF6,0x0A,0xA7,0x9A,
+	0xB9,0x20,0x13,0x76,0x04,0xC1,0x3C,0x9B,0xCF,0xBF,0x61,
+	0x6E,0x59,0x29,0xAB,0x52,0xEC,0xD4,0x20,0x11,0x35,0x9B,
+	0xB9,0x23,0xDF,0x9F,0xE0,0xD3,0x96,0x03,0x8D,0x2D,0xDB,
+	0x22,0xCC,0xAB,0x13,0xB1,0xC3,0xC9,0x5C,0x52,0x5A,0xCA,
+	0xC1,0x34,0x09,0x41,0xC4,0x2F,0x35,0x9B,0xCD,0xA9,0x84,
+	0x1F,0x53,0x40,0x01,0x3F,0x7E,0x6E,0x91,0x78,0x59,0xE5,
+	0xED,0xE6,0xCC,0xEF,0xCB,0x50,0xBD,0xAA,0x8B,0xE3,0x67,
+	0x16,0xBD,0xAF,0xAE,0x12,0xE6,0xB0,0x6D,0x1A,0xEB,0xE4,
+	0xC2,0xB9,0xF9,0xFD,0xB0,0x57,0xBB,0x4E,0xF6,0xFA,0xF0,
+	0x5D,0x55,0x4C,0x1C,0x1C,0x6E,0x28,0xD1,0x07,0x25,0x31,
+	0xD7,0x1F,0x7C,0xFE,0xD1,0x96,0xF0,0x00,0x29,0xF6,0xD9,
+	0x47,0x2C,0x3D,0x49,0x9C,0x20,0x60,0xF9,0x5F,0x0A,0xAE,
+	0x06,0xDC,0x79,0x79,0xA3,0xD4,0x07,0x71,0x6D,0xD1,0xE6,
+	0x2A,0xCE,0x99,0x8F,0xAB,0x83,0xB8,0xD4,0x05,0x46,0x3E,
+	0x72,0xE7,0x17,0x75,0x08,0xA2,0xAE,0x84,0xBC,0xB8,0x4D,
+	0x35,0xA0,0x1D,0xAE,0x6D,0xCF,0xC5,0xB8,0x28,0x5C,0x54,
+	0x12,0x86,0x07,0x5E,0xED,0xFA,0x38,0xB4,0x58,0x28,0x7C,
+	0x85,0xB9,0xB9,0x1B,0xA5,0x94,0x67,0xC5,0xB7,0x38,0x54,
+	0x7B,0xA8,0xD9,0x11,0xB1,0x22,0x3D,0xAE,0xD2,0x73,0xC5,
+	0x3C,0xBF,0x61,0x5A,0xEA,0xEC,0xE5,0x88,0xD6,0x71,0x4E,
+	0x97,0xE2,0xBD,0x38,0xC8,0xDD,0xC2,0xB4,0xE9,0x43,0x89,
+	0x19,0x72,0x1D,0xAD,0x9A,0xEE,0x81,0xFE,0x51,0x27,0x77,
+	0x37,0x07,0x61,0xA2,0xC9,0xF0,0x45,0xF4,0x03,0xBB,0x76,
+	0xB5,0xDF,0x0F,0x55,0xA3,0x1F,0xF8,0xBB,0x7D,0x65,0x60,
+	0xCA,0x64,0x9D,0xA5,0x87,0xF8,0x90,0x62,0x74,0x5F,0xE1,
+	0x05,0xA7,0x5B,0xCF,0x30,0x42,0x7B,0xEC,0x7F,0x85,0xE2,
+	0xC0,0xBD,0xD5,0x26,0x18,0xA8,0xFE,0xAC,0x32,0x36,0xB5,
+	0x90,0xB3,0x07,0xFB,0xE5,0x04,0xFB,0xEB,0x9C,0x79,0x4A,
+	0xF0,0xD3,0x5D,0x3B,0x15,0x46,0xE4,0x56,0x48,0x54,0x09,
+	0x02,0xB6,0xBA,0x03,0xDB,0xBA,0xBB,0x2B,0x7D,0x15,0x0E,
+	0xC9,0xAE,0x69,0x8A,0xBD,0x1E,0x82,0x81,0x24,0x44,0xC3,
+	0x1B,0x8C,0xAD,0x9D,0x70,0xD0,0x94,0x8C,0xD4,0x3D,0xD8,
+	0x35,0x4D,0x37,0xAD,0x4F,0x2A,0xC3,0xA3,0xF1,0x0D,0x66,
+	0xE2,0xF9,0x5E,0xDD,0xFF,0x54,0xB0,0x3A,0xAC,0x37,0x07,
+	0x00,0x9F,0x7F,0xA1,0x83,0xE5,0xAC,0x89,0x4D,0xEC,0x1B,
+	0xD6,0x9A,0xA0,0x0B,0x24,0x2A,0xED,0x22,0x50,0xB9,0x78,
+	0x47,0x5B,0x26,0xB0,0x1C,0x7A,0xBF,0x29,0x8D,0x88,0x14,
+	0xB0,0xFF,0xCC,0x56,0xDF,0x83,0x0F,0xE5,0x5B,0x87,0xA7,
+	0xAD,0x74,0xA8,0x6E,0x56,0x29,0x55,0xB9,0x2E,0x38,0x9B,
+	0xFC,0x1A,0x13,0xB1,0xA9,0x59,0x9D,0xB8,0xAE,0x1A,0xA9,
+	0xCB,0x66,0xFB,0xF0,0xDB,0x85,0x93,0x85,0x5C,0x1F,0xC7,
+	0x9C,0xD8,0x81,0x33,0x94,0x5B,0x5C,0x5C,0xBB,0x66,0x77,
+	0x39,0x6D,0x80,0x07,0x51,0xAE,0x84,0x5B,0x27,0xBE,0xB0,
+	0xC2,0x0B,0x09,0x56,0x4B,0x32,0x6F,0xF2,0x1A,0xB4,0x6F,
+	0xA2,0xBA,0xF7,0x30,0x87,0x1C,0xF7,0x75,0x51,0x93,0xFC,
+	0xE3,0xDC,0x0D,0xCF,0x98,0x88,0x96,0x40,0x3E,0x78,0xDC,
+	0x4F,0x35,0x97,0xC3,0x86,0xD1,0x98,0x7E,0x69,0x0D,0x68,
+	0x05,0x65,0xF0,0x40,0x4F,0x62,0x7C,0xDB,0x94,0xD2,0x85,
+	0xAA,0x4E,0xEE,0x1A,0x74,0xAE,0xC6,0x83,0xFD,0x15,0x46,
+	0xF7,0xF6,0x62,0x3C,0x15,0xAB,0x79,0x2E,0x24,0x9F,0x3D,
+	0x9D,0x2B,0x9F,0xC8,0x4F,0x92,0x54,0xBD,0x03,0x5B,0x59,
+	0x07,0x88,0x94,0xFF,0x76,0x27,0xD2,0x3F,0xF3,0xB7,0x74,
+	0xE5,0xE7,0xD5,0xB3,0x72,0x4B,0x5D,0xAC,0x63,0xFC,0x1C,
+	0x1C,0x74,0xDE,0xC5,0xD3,0x37,0x7B,0x1E,0x56,0x24,0x62,
+	0xEA,0xA0,0xC8,0x53,0xF0,0x02,0xE8,0xF0,0x05,0xA9,0xC2,
+	0x95,0xA7,0xAB,0xB2,0xA2,0xAB,0x98,0x9E,0x06,0x93,0xD5,
+	0x52,0xF1,0x21,0xB1,0xD3,0xE7,0x0E,0x56,0xAB,0x46,0x56,
+	0x6E,0xE1,0x3F,0xDE,0xCF,0xCD,0x19,0xB3,0x15,0xB6,0xC4,
+	0x2D,0xBD,0xDE,0xA9,0xB3,0xBD,0x77,0xE2,0xE8,0x59,0x99,
+	0x54,0x5A,0x69,0xFD,0x35,0x00,0x9E,0x7E,0xEF,0x9B,0xD7,
+	0xFE,0x38,0x4F,0x75,0xB9,0x6B,0x69,0x1B,0x5E,0xA7,0xAF,
+	0x2F,0xF3,0xFA,0xDB,0x35,0x59,0x73,0x24,0xDF,0xF7,0x8F,
+	0x3E,0x9E,0xD5,0x34,0xC6,0xDF,0x17,0x6B,0x4E,0xFD,0xCD,
+	0x95,0xFE,0xFC,0x13,0xEC,0x38,0xF2,0x17,0xBB,0xBA,0x07,
+	0xFF,0x1E,0xE5,0x60,0xEC,0x8D,0x24,0x3D,0xDB,0xDA,0x7B,
+	0x60,0xB4,0x93,0x4E,0x4D,0x2C,0xE6,0xCA,0xCA,0x09,0xD7,
+	0xED,0x4A,0x3C,0x8D,0x72,0xF5,0xCA,0x09,0x2F,0x8D,0x4B,
+	0xBF,0xC4,0xF6,0x56,0x79,0x93,0x44,0x93,0xD0,0x3D,0x98,
+	0x5F,0x8A,0x0B,0x67,0xA1,0xAE,0xFC,0xBE,0xBB,0x4D,0xE9,
+	0xAF,0x9D,0xC9,0x13,0x0A,0x3D,0x4A,0x55,0x6E,0x2B,0x89,
+	0xB0,0xF2,0xCD,0x3F,0xDA,0x85,0xCC,0xF7,0x01,0x0B,0xFB,
+	0x48,0x71,0xF8,0xC3,0x8C,0xBA,0x42,0xE7,0xF8,0x58,0xF8,
+	0xCA,0xF2,0xAD,0x28,0xC3,0x96,0x6D,0xCF,0x60,0xA3,0x86,
+	0xDB,0x2A,0x2C,0x5C,0x24,0xF4,0x28,0xF4,0x03,0x4D,0xB3,
+	0x53,0x58,0xCD,0x4C,0xD4,0x43,0x64,0xF2,0x60,0xDF,0x07,
+	0x7A,0x37,0x25,0x1E,0xCB,0x4C,0x06,0x0B,0x98,0x7C,0xED,
+	0x18,0xEC,0x8B,0xD9,0x74,0x95,0xBF,0xA0,0x44,0x55,0x4E,
+	0xF6,0xE6,0x34,0xE5,0xD7,0xBB,0xBB,0x13,0x4F,0x60,0xB9,
+	0xC5,0x5F,0xDD,0x42,0xA5,0xDC,0x77,0x35,0xCE,0xDC,0xCB,
+	0xEB,0x38,0x29,0x8B,0xDE,0x7B,0x64,0xD8,0xC7,0xA0,0xCA,
+	0xAA,0x3F,0x10,0xAC,0xE5,0xA0,0x84,0xBB,0x50,0x86,0x8B,
+	0x0C,0xAC,0xEC,0xAF,0x25,0xE6,0x4F,0xE9,0x93,0xAD,0xC8,
+	0x3F,0xD6,0x05,0x56,0xBC,0xC6,0x63,0xD2,0x25,0x01,0xE5,
+	0x8B,0xAC,0x49,0xE7,0xCF,0x9B,0xA7,0xD3,0x16,0x18,0x8F,
+	0x93,0xDD,0x3C,0xAF,0xD4,0x5E,0xFE,0xE3,0xCB,0x57,0xE9,
+	0x6B,0x8A,0xF5,0x7F,0x68,0xBF,0x0F,0x5B,0x29,0xA5,0x13,
+	0x59,0x68,0x1C,0xA9,0x7A,0x57,0xBA,0xEE,0x5A,0x89,0xA7,
+	0x8A,0xA1,0xBE,0xDF,0x76,0xEB,0xF9,0xC0,0x47,0x64,0x59,
+	0xC9,0x28,0xEA,0x63,0xC6,0x1F,0xBE,0xE1,0x8B,0x58,0xD0,
+	0xB0,0x27,0x01,0xCA,0x57,0xA5,0x19,0x7E,0x8C,0x45,0x1A,
+	0x4E,0x2D,0x27,0xC0,0xD2,0x3C,0x2C,0x1E,0x7B,0xCE,0x86,
+	0x60,0x36,0x26,0x0C,0x2E,0x4A,0xBC,0x83,0x1B,0x59,0x5C,
+	0x4B,0x97,0xF1,0x8C,0x4A,0xFF,0x9E,0xF8,0xC6,0xD6,0xDF,
+	0x5F,0xED,0x62,0x9E,0x90,0x6D,0xA3,0xD4,0xC9,0xDA,0x2B,
+	0xB4,0x0D,0x95,0x29,0xD6,0x68,0x07,0x19,0x71,0x74,0x32,
+	0x6F,0xB7,0x9B,0x24,0xD2,0xD6,0xAC,0x3F,0xAA,0xD5,0xDC,
+	0x3B,0x58,0x78,0x63,0x1E,0x53,0x33,0xD1,0x2F,0xF8,0xFD,
+	0xF7,0x83,0xA1,0x4B,0x52,0xBB,0x50,0xA8,0xFD,0xC8,0x97,
+	0xB6,0xA9,0x45,0xF9,0x97,0xA6,0x9F,0x7E,0x1B,0x0E,0x84,
+	0xF4,0x8A,0xCD,0xDD,0x9D,0x36,0x98,0xB6,0xB8,0x23,0xCE,
+	0x90,0x89,0x8C,0x0B,0xD0,0x51,0xAB,0x7F,0xEB,0x23,0xCB,
+	0x0F,0xB8,0x5B,0xB5,0x0C,0x3B,0xA5,0x78,0x5A,0x05,0x70,
+	0x8A,0x37,0xB9,0x9A,0x0B,0xB4,0x95,0x66,0x00,0x5D,0xCE,
+	0x79,0x48,0x11,0xBE,0xDA,0x94,0xE6,0xF5,0xFB,0x38,0xEC,
+	0x64,0x54,0x17,0x8B,0x64,0x03,0x09,0x10,0x8A,0xF5,0x8E,
+	0x85,0x22,0x6D,0x0C,0xF1,0xF3,0x3F,0xD5,0x18,0x22,0xE0,
+	0x67,0x15,0x06,0xE1,0x59,0x82,0xF0,0x70,0x71,0x71,0xBC,
+	0x72,0x3F,0x9D,0x0E,0x3B,0xCC,0x85,0x1E,0xB1,0x36,0x82,
+	0x0B,0xC1,0x72,0x0F,0x7E,0x8E,0xF1,0xD3,0xA9,0x75,0x46,
+	0xAC,0x1D,0xD7,0x71,0xB1,0x5E,0xF1,0xD1,0xF9,0x27,0xBC,
+	0xE7,0x64,0x27,0x5F,0xEF,0xA8,0xCE,0x3C,0xCC,0x4D,0xA7,
+	0x2C,0xE7,0xAE,0x8A,0xBB,0xB7,0x70,0xB0,0xB1,0xE7,0x5B,
+	0x77,0x27,0xCE,0xAF,0xFD,0xEF,0xA3,0x7C,0xB0,0xA3,0x62,
+	0x43,0xA6,0x4A,0x79,0x37,0x46,0xCB,0x57,0x6D,0x95,0x6C,
+	0x55,0x5D,0x0A,0x0C,0xA5,0x6A,0xB0,0x54,0x5B,0xF2,0xFE,
+	0xBC,0xAD,0x97,0x3C,0x1F,0xB5,0x06,0x2A,0xBB,0xD8,0x3F,
+	0x71,0x0B,0x57,0x55,0x18,0x9F,0x4B,0xCE,0x7F,0x7E,0xB3,
+	0x4E,0xBC,0xD3,0xBE,0x23,0xE9,0xE4,0x6B,0x20,0x60,0x7E,
+	0x15,0xC7,0x08,0xB3,0xD1,0xF1,0x1B,0x30,0x21,0xBA,0xCE,
+	0xC8,0xC7,0xF6,0x9D,0xEC,0x37,0x1A,0x32,0x73,0x70,0xCE,
+	0x37,0xCB,0x9A,0x33,0xBA,0x35,0x6C,0x16,0xD4,0x5E,0x5F,
+	0x19,0xE4,0xDE,0x2B,0x9E,0xC4,0xC5,0x5B,0x8B,0xFC,0xFA,
+	0x72,0xC0,0x71,0xE8,0xEC,0x45,0x7E,0xD1,0x58,0x3F,0x2E,
+	0x17,0x1F,0xE8,0x5A,0xA3,0x10,0x1A,0x68,0x24,0x12,0x9C,
+	0x60,0x88,0xB0,0x06,0xEE,0xDC,0x5F,0x3E,0xE3,0x84,0x18,
+	0xCB,0x05,0x8E,0xD6,0xF2,0x41,0xCF,0x02,0xBE,0x41,0xF3,
+	0x01,0x9D,0xF8,0x35,0x6E,0xBB,0x8C,0x16,0x2C,0xB6,0x1E,
+	0xAB,0xEC,0x1A,0xEB,0xB9,0xF3,0xD8,0x5E,0x26,0x96,0x95,
+	0xF3,0x16,0x02,0x6D,0xA7,0xC1,0x63,0xE7,0x13,0x19,0x48,
+	0xCC,0x46,0x42,0x1C,0x33,0xDC,0x44,0x0D,0xB7,0x09,0x27,
+	0xA6,0x08,0x88,0xF3,0x99,0x68,0xD6,0x25,0x3D,0x9D,0xCC,
+	0x89,0x1E,0x64,0x5B,0x23,0xEA,0x8E,0x66,0xD4,0xC1,0xF4,
+	0xBE,0x7A,0x64,0xCF,0x46,0x5F,0x3B,0x16,0x62,0x87,0x6B,
+	0xB7,0x1C,0xDF,0x81,0xA4,0xC2,0xA6,0x5A,0x22,0x20,0x9B,
+	0xBB,0xA7,0xE1,0xB0,0x3E,0x04,0x5C,0x32,0xB8,0xDD,0x4D,
+	0xB6,0x52,0x25,0x51,0x65,0x84,0xE5,0x6D,0xCA,0x24,0x18,
+	0x95,0x16,0x90,0x99,0x03,0x62,0x69,0x4B,0x95,0x09,0x89,
+	0x42,0x5C,0x1C,0x3E,0x29,0x16,0xC5,0xC4,0x4E,0x42,0x12,
+	0xEA,0x9E,0x77,0x4B,0x41,0xE5,0x74,0x96,0xCC,0x15,0x87,
+	0x1E,0xA3,0xC6,0xF3,0x06,0xE6,0xCD,0xF2,0x7A,0xDF,0x13,
+	0x2F,0xB4,0x2E,0xA0,0xBA,0xE0,0xF0,0x22,0x25,0x61,0x33,
+	0xB6,0xD2,0x83,0x3E,0xA9,0xBE,0x12,0xF7,0xAD,0x91,0x1F,
+	0xB3,0xF0,0xEF,0x2E,0x6F,0x96,0xA7,0xA1,0x87,0x3D,0x82,
+	0x5E,0x2D,0x3C,0xA1,0x04,0xFA,0xF7,0x59,0x3C,0xE3,0x23,
+	0x6C,0x78,0x4E,0xDF,0x99,0xDA,0x22,0x09,0x61,0x05,0x17,
+	0x42,0xBD,0xA3,0xB7,0x3A,0xC8,0xE0,0x61,0x24,0xCE,0x90,
+	0xEA,0x4E,0xA0,0x5C,0x37,0x34,0x84,0xBC,0xB6,0x82,0xA4,
+	0xAC,0xFC,0x28,0xE8,0x94,0x16,0x49,0x38,0xDB,0x07,0xEE,
+	0x9E,0xC5,0x20,0x6E,0x34,0xB0,0xA0,0x02,0xDE,0x8F,0x1C,
+	0x4B,0x48,0x6E,0xD1,0xB5,0xFC,0x80,0x63,0x9F,0x53,0x57,
+	0xDE,0xBC,0xD2,0xB8,0xC1,0xE6,0x6C,0x6F,0xC0,0x72,0xE3,
+	0x57,0x25,0xDB,0xC4,0xBE,0xAE,0xA8,0x6A,0x0F,0xDB,0x67,
+	0xAC,0x09,0x3D,0x44,0xC7,0x25,0x5E,0x74,0xFA,0x83,0x8C,
+	0xD8,0x2A,0xF0,0xE8,0xC6,0x9C,0xEE,0x90,0xA9,0xD5,0x1C,
+	0x60,0xBD,0x11,0xAA,0xEE,0xB3,0xCE,0xE2,0x05,0xC4,0x09,
+	0xE5,0xDD,0x8E,0xA3,0x78,0xED,0x50,0xB2,0xE3,0x3F,0xF7,
+	0xDE,0x83,0xC5,0xE5,0xB2,0x43,0xFE,0x7D,0xC1,0xE0,0x94,
+	0x77,0x7D,0xDA,0x03,0x12,0xB6,0x32,0xC1,0x9A,0x4D,0x08,
+	0xF7,0x35,0x66,0x6C,0x05,0xFA,0x9A,0xDB,0xFF,0x19,0xAB,
+	0xFB,0xC7,0x3E,0x0E,0xC6,0xBF,0xE8,0xFE,0x87,0xDB,0x90,
+	0x79,0x9A,0x97,0x3D,0x2F,0x9B,0x20,0x41,0x6B,0x44,0xCC,
+	0x73,0xAB,0x25,0x1D,0x1B,0x37,0x63,0x75,0x7D,0xF6,0xCD,
+	0x08,0xA1,0x1A,0x8D,0x93,0x8B,0x39,0x2E,0xB0,0xB6,0x26,
+	0xB8,0x5E,0xC9,0xAF,0x4C,0xF2,0x2E,0x74,0x8E,0x06,0x8D,
+	0x23,0x4D,0xB2,0xCF,0xED,0xDB,0xF4,0x73,0x86,0xCE,0xBC,
+	0x6A,0x64,0xC6,0x47,0xF2,0xC9,0xD9,0xB7,0x9B,0x3F,0xE0,
+	0x36,0x78,0xDF,0x5E,0x70,0x02,0x3F,0xC7,0x8D,0x34,0x96,
+	0x8A,0x6D,0x70,0x7E,0x1D,0xE5,0x17,0xAB,0x3E,0x6E,0xD2,
+	0xD9,0x4D,0x10,0x6B,0x84,0xE6,0x58,0xFB,0x9F,0x1C,0x9F,
+	0x1E,0x5F,0x68,0xAF,0x6C,0x68,0x87,0xF5,0x42,0x88,0xF1,
+	0x1C,0xBA,0xD1,0xFF,0x6C,0x7E,0x74,0x83,0x51,0xD4,0xA8,
+	0x67,0xF2,0x83,0xCC,0x3F,0xB9,0x43,0xE4,0x9C,0xE2,0xA7,
+	0x83,0x16,0xCE,0xED,0xF7,0x7F,0x72,0x3E,0x7B,0xF1,0x9B,
+	0x57,0xA2,0x9B,0x31,0xF3,0x30,0xE2,0x33,0x0E,0x74,0x1A,
+	0x68,0x9A,0x00,0x06,0x07,0x76,0x54,0x9B,0xE0,0xDB,0xAF,
+	0xEF,0x71,0x89,0x61,0x92,0x22,0x71,0xDB,0x10,0x6D,0xE2,
+	0xA7,0x1B,0x36,0x36,0xC7,0x22,0xC1,0xF7,0x22,0x11,0x10,
+	0x44,0xB3,0x80,0x08,0x41,0x9F,0x52,0x90,0x72,0xA1,0xFD,
+	0xF1,0x96,0x06,0xF6,0x2D,0x53,0x45,0x46,0xBA,0x6C,0x45,
+	0xF4,0x06,0xD6,0x68,0x6B,0x7B,0x51,0x3C,0xF3,0x2F,0x7F,
+	0xFC,0xAA,0xDE,0xA2,0x02,0xEA,0x42,0x62,0x6F,0xBD,0x66,
+	0xF8,0x62,0x3D,0x4D,0x27,0x95,0x0D,0xF0,0x3E,0xFF,0xE5,
+	0x80,0xC5,0x6D,0x85,0x70,0xB5,0xBD,0x6D,0xB2,0x47,0xDE,
+	0xE0,0x75,0xBC,0x25,0x6F,0xDB,0xE5,0x08,0xFB,0xCB,0x6F,
+	0x72,0x75,0x4D,0x44,0xFB,0xDB,0xA8,0x17,0x9C,0x75,0x60,
+	0x8E,0xC3,0xCF,0xFF,0x1A,0xE1,0x37,0xD8,0xF6,0x3E,0x45,
+	0x8F,0xAF,0x6F,0x69,0x99,0xFB,0x01,0x99,0x68,0x4F,0x23,
+	0xAA,0x51,0x58,0x04,0xAD,0x54,0x76,0xCC,0x5E,0x9D,0xE1,
+	0x83,0x28,0xE4,0x71,0xF6,0x99,0xFF,0xF6,0xF4,0x9A,0xB5,
+	0x80,0x27,0xBE,0xC0,0xDC,0x8E,0x3B,0xB1,0xBF,0xAD,0xFD,
+	0x70,0xCE,0x6B,0x97,0x4E,0xA3,0xF1,0x54,0x28,0x4B,0xC1,
+	0x66,0xB6,0x12,0x70,0x18,0x1E,0x26,0xA4,0x7D,0xD0,0x69,
+	0x43,0xF0,0x16,0xF4,0x72,0x11,0xD9,0xDD,0x53,0x9C,0x0E,
+	0xE9,0xF0,0xA0,0x78,0x26,0x5E,0xF1,0xB5,0x89,0xD4,0x00,
+	0x12,0xAB,0xBC,0x89,0xD5,0xEB,0xC7,0xF5,0xC0,0xA3,0xB5,
+	0x27,0xCA,0x48,0xFC,0xAE,0x70,0x1D,0xF6,0xBE,0x3D,0xA3,
+	0x01,0xA7,0x8D,0x7D,0x0D,0x5C,0x35,0xBF,0xD4,0x12,0xE3,
+	0x2F,0x84,0xF8,0x3E,0x58,0xEB,0xB5,0xED,0xA7,0xB3,0xAE,
+	0x9D,0x1F,0xFC,0xDA,0x8F,0xB8,0x95,0x1D,0x91,0x43,0xBD,
+	0xA1,0xBF,0xC1,0xDC,0xBF,0x93,0xE8,0x59,0xDF,0xE2,0x21,
+	0x70,0x18,0x91,0xD0,0x86,0x44,0xA0,0x32,0xF6,0x50,0x36,
+	0x28,0x16,0x2B,0x21,0x73,0xBF,0x85,0x28,0x7C,0x74,0x2B,
+	0x85,0x2B,0xC8,0x1E,0x8E,0x68,0x34,0x51,0x7B,0x60,0xE3,
+	0xC3,0x1C,0x4F,0x89,0x1C,0x73,0x5F,0x23,0x2B,0xFE,0x31,
+	0xF9,0xCE,0x17,0x66,0xE0,0x32,0x23,0xD7,0x5C,0x3B,0x5F,
+	0xAE,0x01,0xCE,0x8A,0xFA,0x9B,0xEC,0xDB,0xD8,0xE8,0x4D,
+	0x01,0xA6,0xDF,0xCF,0xAD,0x16,0x44,0x68,0x93,0x09,0x82,
+	0xA9,0x3F,0x72,0x7A,0x67,0x25,0x6D,0x37,0x6A,0x00,0x73,
+	0x75,0x5A,0x21,0xF5,0xB4,0xA3,0x46,0xCD,0xC4,0x94,0xE0,
+	0x9B,0xB3,0x1A,0x82,0xBB,0x9E,0xCC,0x0B,0x82,0x69,0x3F,
+	0xCC,0xEC,0xED,0xAD,0xE7,0xA0,0xC9,0xD4,0x92,0x7B,0xB0,
+	0xAB,0x32,0xC1,0x8F,0x71,0xE4,0x49,0x7E,0x1D,0x8D,0xED,
+	0xB9,0x6B,0x6F,0xF4,0x63,0x2A,0x75,0xE3,0x4A,0xA9,0x19,
+	0xB6,0xAE,0x51,0xF3,0x2E,0x9E,0xB9,0xB3,0xC2,0x36,0xDF,
+	0xBD,0x55,0xB6,0xA6,0xD4,0xEC,0xA8,0x32,0x2D,0xD8,0x24,
+	0x6D,0xCC,0xDA,0x41,0x19,0xD3,0x18,0xC8,0x50,0x95,0xA3,
+	0x17,0xBA,0x1C,0xD8,0xB2,0xBB,0x76,0xF6,0x9B,0x39,0x23,
+	0x8B,0x48,0x8D,0x40,0xCA,0x2E,0xDB,0x17,0x43,0x22,0xC5,
+	0x34,0x52,0x64,0x6E,0x6E,0xC0,0xD8,0x18,0x91,0xED,0x55,
+	0xEC,0x4C,0xCA,0x4C,0xEF,0xE8,0xC9,0xA7,0xEB,0x3B,0x93,
+	0xD8,0x03,0xBB,0x01,0x46,0x57,0x98,0x58,0xF9,0x6C,0x69,
+	0x54,0xDC,0xFE,0x50,0xD6,0xFE,0x69,0x10,0x36,0x79,0x44,
+	0xD1,0xF5,0xFE,0xCD,0x44,0x64,0xE4,0x59,0xC5,0xC1,0x7D,
+	0xE1,0xD1,0x9C,0xBF,0xF7,0x63,0xBE,0x84,0x15,0xFE,0xE7,
+	0xBB,0x5B,0xF7,0x47,0x81,0x7D,0x6F,0x67,0x9B,0xC0,0xDC,
+	0x3C,0x76,0xA5,0x52,0x27,0xDD,0x42,0x64,0x65,0x07,0xB9,
+	0x93,0xB1,0x5C,0xF7,0x28,0x82,0x75,0x10,0x72,0x11,0xA0,
+	0x6C,0xFD,0xAB,0xC9,0xBF,0xAC,0x39,0xAB,0x79,0x53,0x13,
+	0xA3,0xC5,0xA7,0x68,0x1D,0xD3,0xF2,0xD1,0x0A,0xD4,0xE2,
+	0xBF,0xD0,0xCC,0xD3,0x3A,0xA3,0x15,0xAE,0xC5,0x8F,0xD6,
+	0x42,0xD2,0x1B,0xE8,0x1E,0xF4,0xBD,0x04,0xFA,0xAA,0xB6,
+	0xAA,0x0E,0x0F,0xD2,0xAC,0xF9,0x5C,0xF3,0x7E,0xC5,0x2A,
+	0xDC,0xD6,0x7D,0x44,0xC0,0xA5,0xF2,0xF5,0x5B,0xED,0xE3,
+	0xEE,0x0F,0xBC,0xC1,0xC3,0x88,0x23,0xA7,0x63,0xC8,0xE3,
+	0xDA,0x4E,0x51,0xFF,0x9E,0xF1,0xDE,0xA9,0x58,0x7E,0xA5,
+	0xDD,0xF0,0xE7,0x44,0xCA,0xAF,0xC5,0xE3,0xEA,0x36,0x14,
+	0xC7,0xB3,0xBB,0x46,0x9B,0x71,0xCD,0xCE,0x3D,0xB6,0x67,
+	0x54,0x41,0xBD,0xFB,0x7B,0xD3,0x2F,0x6A,0xBE,0xFA,0x4F,
+	0x72,0x8D,0xDA,0xA6,0x0B,0x60,0xAE,0x7F,0xF2,0x67,0x8C,
+	0xFA,0xBA,0xBA,0xB6,0xBF,0xBF,0x19,0x8A,0x6D,0xDF,0x81,
+	0xC7,0xED,0x44,0x0E,0x7E,0xFE,0x55,0xC0,0x0B,0x20,0xEA,
+	0xD5,0x7E,0x9D,0x9A,0xC4,0x27,0xB3,0xFA,0x1E,0x76,0xD0,
+	0x3E,0xED,0x4A,0x8B,0x94,0x38,0xDC,0x75,0x6F,0x43,0xF9,
+	0xC4,0xB6,0x40,0xE1,0xD7,0x4A,0xAB,0x36,0x83,0xCC,0x94,
+	0x04,0x5C,0xDC,0x64,0xFC,0x88,0x9E,0xC8,0xA9,0xD1,0x1F,
+	0x3F,0x81,0x53,0xC0,0x41,0x75,0x23,0x72,0x9A,0xEE,0x1B,
+	0x86,0x7E,0x87,0x4B,0xA1,0x14,0x54,0xB0,0x16,0x84,0xE1,
+	0x93,0xD5,0xF9,0xF9,0x52,0x19,0xBA,0xDC,0x03,0xF9,0x93,
+	0xE1,0x54,0xF0,0xA3,0x48,0x25,0xAA,0x49,0xB1,0x4A,0xB0,
+	0x5B,0x4A,0xD7,0xAE,0x52,0x78,0x62,0xF0,0x82,0xE4,0xA6,
+	0x9C,0x3A,0xEB,0x40,0xA4,0xFA,0x20,0x2D,0xCE,0x0A,0x0C,
+	0xCA,0xF8,0x96,0x95,0x4C,0x73,0xE3,0xA9,0x66,0xBC,0xF2,
+	0xF4,0xBC,0xF0,0x70,0x45,0xAA,0x10,0xF4,0x88,0x90,0x80,
+	0xCE,0xC6,0xE6,0x83,0xA8,0x4C,0xF5,0xA7,0x8A,0x11,0x33,
+	0x4C,0x45,0x57,0x20,0xDD,0xFB,0x5B,0x02,0x04,0xA4,0x26,
+	0xF7,0xC0,0xDE,0x14,0xF6,0x66,0x50,0xF6,0x69,0x46,0x10,
+	0x54,0x8E,0x77,0x7C,0x01,0x7D,0x87,0xD9,0x9F,0x5C,0x01,
+	0xE4,0xE1,0x04,0x45,0x98,0xA2,0x5C,0x85,0xD7,0xBF,0x3F,
+	0x20,0x7D,0x86,0xA7,0x0F,0x48,0x9C,0x84,0x49,0x25,0x88,
+	0xF5,0x29,0x56,0x29,0x9F,0x89,0x92,0x52,0x0B,0x68,0x14,
+	0x63,0xD6,0x22,0xF2,0x5A,0xE1,0x71,0x0F,0x90,0x1E,0x5F,
+	0x51,0x06,0x1F,0x9E,0xDF,0x2E,0x9C,0xE9,0xCB,0xF8,0x77,
+	0x06,0x59,0x09,0x9A,0xCD,0x1F,0xA6,0xE5,0xBF,0xDB,0x2E,
+	0x9C,0x7F,0xA3,0xA7,0xAE,0xD7,0x9E,0x6F,0x90,0x4F,0x8E,
+	0xDA,0x5F,0xF8,0x6E,0xE7,0x04,0x7D,0xC7,0xA8,0x4F,0x9F,
+	0x8C,0xD7,0x96,0x92,0xB3,0xA2,0x90,0x74,0x17,0x55,0xF7,
+	0xA1,0xDA,0x19,0x02,0xAF,0xCB,0xF6,0x1A,0x75,0x48,0x51,
+	0xED,0xD5,0x44,0xFE,0x09,0xDE,0xA5,0x7D,0x4F,0x5D,0xD0,
+	0x38,0xE4,0xE3,0x43,0x5B,0x63,0xDE,0xDE,0x0A,0x02,0x08,
+	0x4E,0x41,0xDB,0xC7,0x69,0x95,0x37,0xA4,0x7E,0x31,0xF5,
+	0x2E,0x76,0x05,0x9B,0xE2,0xE9,0xF7,0x72,0x26,0x6F,0xB6,
+	0x62,0xAE,0x86,0xFB,0x6E,0x61,0x80,0x72,0x64,0x4A,0xE3,
+	0x62,0x85,0xB7,0xEE,0x74,0xA4,0xAA,0x7A,0xAE,0xD4,0xE9,
+	0xDC,0x85,0xC0,0x66,0x9B,0xDC,0xCF,0x7A,0x68,0x68,0x4E,
+	0x7E,0x69,0xDF,0x8D,0xBE,0x80,0x03,0x38,0xE7,0x52,0xD6,
+	0x10,0x21,0xC3,0x81,0x50,0xCA,0xEA,0x9B,0xDE,0xA7,0xCB,
+	0x84,0x91,0x01,0xA1,0x78,0x43,0x71,0x29,0x77,0x52,0x96,
+	0x59,0xF8,0x8C,0xBF,0xFE,0x17,0x7C,0xE0,0x11,0xBD,0x48,
+	0x2E,0x1A,0xED,0x66,0x1E,0xFE,0xE7,0xE0,0x10,0x76,0x84,
+	0xB1,0xE8,0x87,0x10,0x52,0x0B,0x78,0x8B,0x30,0xDC,0xDB,
+	0xEC,0x5D,0xE5,0x33,0x8D,0xE6,0xB3,0xD8,0xEF,0x3E,0x63,
+	0x3E,0x8B,0x0A,0x5F,0x10,0x6A,0xA3,0xA1,0xB2,0x12,0x49,
+	0x1E,0xDE,0x27,0x0C,0xE2,0xC3,0xE3,0xA8,0x13,0x82,0xE0,
+	0xB6,0xD1,0x3B,0xE6,0xEA,0xFB,0x33,0x1D,0xB5,0xD2,0xEC,
+	0x4F,0x1A,0xAA,0xE2,0xEC,0xF8,0x08,0xB4,0x48,0xF7,0xA5,
+	0xF9,0x9C,0x84,0x75,0xB6,0xED,0x26,0x8F,0x25,0x85,0xCA,
+	0xEB,0x48,0x91,0xB7,0x9C,0x3E,0x62,0xDB,0xEC,0xAD,0xEB,
+	0x1E,0x8F,0xC8,0xD3,0x55,0xFE,0x98,0x13,0xCB,0xAF,0xF8,
+	0xC8,0xBE,0x08,0x6D,0x52,0x92,0xD6,0x57,0x06,0xA5,0xAC,
+	0x39,0xED,0xBD,0xBB,0x87,0x2B,0xBA,0x9A,0x78,0x9B,0x60,
+	0xD1,0xE1,0x18,0x76,0x8C,0xFE,0x2C,0xCE,0xAC,0x30,0x42,
+	0x60,0xB2,0x03,0x3E,0xA9,0xCD,0xC7,0xEB,0x8D,0xBC,0x4D,
+	0xFF,0x0B,0xA4,0xBF,0x88,0x68,0x85,0xCF,0x8D,0x7F,0x82,
+	0x7C,0x94,0x4F,0x5F,0x9E,0x20,0x12,0x15,0xA7,0x11,0xE0,
+	0xA6,0x32,0xD8,0x3B,0x69,0xF1,0x34,0x36,0x2A,0x90,0xC6,
+	0x3B,0x7E,0x06,0x88,0x06,0xEA,0xFF,0x93,0xDA,0x66,0x58,
+	0xB1,0x76,0xFC,0xDE,0x14,0x0E,0xB2,0x0A,0x92,0x0A,0x56,
+	0x2F,0x16,0xEA,0x45,0xA6,0x54,0x80,0x2E,0xC6,0x67,0xA2,
+	0x9E,0xB0,0xDE,0xC1,0x8A,0xC6,0xBF,0x32,0xEE,0x98,0x8A,
+	0xBD,0x18,0x03,0x07,0x66,0x58,0xBF,0xED,0x26,0x4A,0xF7,
+	0x58,0x13,0xC9,0x87,0x8F,0xDC,0x56,0xFF,0xDF,0xAB,0x39,
+	0x0B,0x47,0x3C,0x1B,0x0D,0x44,0x9F,0x48,0x67,0x59,0xF8,
+	0xD3,0x71,0x79,0x01,0x6A,0xD7,0x4F,0xC4,0x37,0xAD,0xDF,
+	0x8B,0x3D,0xB3,0x46,0xB1,0x63,0xD0,0x51,0x51,0xC3,0x3A,
+	0x59,0xC1,0xFA,0x2E,0x88,0xB9,0x08,0x57,0xA3,0x28,0x3A,
+	0x21,0x01,0x19,0x76,0xC1,0xB1,0x83,0x2B,0xC9,0x76,0xD0,
+	0xF0,0x10,0x65,0x8F,0xED,0xDF,0xF7,0xD8,0x3B,0xD9,0x36,
+	0x12,0x89,0x3E,0x12,0xEE,0xB2,0xA7,0x17,0xE0,0xEF,0x4F,
+	0x72,0x49,0x76,0x2F,0x29,0xCE,0x26,0x3D,0xE1,0x6F,0x2E,
+	0x2E,0x22,0x2E,0x6F,0x7E,0x5D,0x81,0xF5,0x94,0xA0,0x79,
+	0xB0,0x09,0xBF,0x51,0x2F,0x82,0x6B,0xB6,0xE5,0x2C,0x97,
+	0x0C,0x2A,0xAA,0xCC,0x73,0x09,0x48,0xA8,0x2A,0xF8,0x07,
+	0x56,0x9B,0x56,0xC2,0xAC,0xFA,0xFB,0xE3,0x4E,0x4D,0x9E,
+	0x9F,0xF5,0x00,0xD3,0x74,0x27,0x84,0x5D,0x71,0xAA,0xD0,
+	0x74,0x86,0x49,0xC5,0x9F,0x7B,0x80,0x79,0xDD,0x91,0xF9,
+	0xBA,0x11,0x27,0x7D,0x07,0x5F,0x32,0x33,0xE3,0x93,0xB9,
+	0x69,0xAF,0xCD,0x49,0x6F,0xDD,0x76,0xB5,0x77,0xD7,0x66,
+	0x6D,0x3C,0xED,0x7A,0x3B,0x3E,0x31,0xFE,0xC1,0xE8,0xFE,
+	0x9E,0x4C,0x6A,0x02,0xDC,0xE8,0x77,0x2C,0x82,0xAF,0xF2,
+	0x5B,0x62,0xCF,0xEC,0xF3,0x37,0xEF,0xF7,0x9B,0x7D,0x8E,
+	0x79,0xAC,0x9D,0x01,0xD6,0x87,0x71,0x2E,0x36,0x10,0xEE,
+	0x72,0xDD,0x51,0xBD,0x71,0x7C,0x04,0x35,0x36,0x77,0x3A,
+	0x9E,0x06,0x29,0x96,0xA0,0xAF,0x78,0xF3,0x08,0x47,0xD2,
+	0xFE,0x12,0xE3,0x88,0x08,0x5D,0xF1,0xBF,0x14,0xC2,0xC6,
+	0x14,0x27,0xAD,0x87,0x08,0x4F,0xC5,0xBE,0x1B,0x4D,0xE3,
+	0x10,0x23,0xA4,0xBB,0x9B,0x04,0x47,0x69,0x0E,0xD3,0xBA,
+	0x1A,0xCB,0xB7,0x69,0x8B,0xD8,0x3E,0xA5,0xB7,0x51,0x42,
+	0xA3,0x48,0x42,0x2E,0xF8,0xA2,0x0D,0xB7,0xF9,0x4E,0xFF,
+	0x69,0x66,0x1F,0xE9,0xCC,0xCC,0x38,0x57,0xC3,0xED,0xF0,
+	0x42,0x1C,0xFC,0xDE,0xED,0x65,0x62,0x1E,0x47,0xC1,0x7D,
+	0xE3,0x0B,0xF4,0x4F,0x9E,0xC1,0x04,0xFB,0x12,0x27,0xEF,
+	0x45,0xF3,0x75,0x75,0xD8,0xF8,0x2D,0x95,0xE5,0x90,0xBF,
+	0x9D,0xDF,0xE8,0x33,0x2A,0xEF,0x86,0x34,0x5D,0x02,0x1E,
+	0xE5,0xAD,0x12,0x1D,0xBF,0x09,0x65,0x0C,0xBB,0x1F,0x1B,
+	0x0B,0xCC,0x86,0x6E,0xF4,0xB9,0x5A,0xE4,0x7C,0x4A,0xB1,
+	0xCA,0x5B,0x9C,0x1B,0xF7,0x82,0x8D,0x5E,0x9B,0x9F,0x75,
+	0xCC,0x5C,0x14,0x38,0xBE,0xA4,0xB3,0x2E,0x71,0xA8,0x6F,
+	0x81,0xAF,0xC8,0xA6,0x28,0x5F,0x02,0x67,0xA6,0x75,0x60,
+	0xB3,0x7A,0x73,0x3A,0x46,0x1A,0xA6,0x46,0x12,0x37,0x16,
+	0x0A,0x74,0xE2,0xFF,0x7C,0xD6,0xD9,0x2D,0x24,0x29,0xFE,
+	0xEA,0x4C,0x03,0xBC,0xCF,0x3D,0xDA,0x33,0xCB,0x7F,0x91,
+	0x33,0x71,0x45,0x43,0x3F,0x0E,0xB0,0xBE,0x60,0xFD,0x6E,
+	0x31,0xCD,0x34,0x31,0x2D,0x3E,0x56,0x90,0x36,0xC0,0xBC,
+	0xF9,0x87,0xF7,0x34,0xF5,0xE0,0xA3,0xC5,0xC8,0xB4,0x17,
+	0xBF,0x52,0x0F,0xBF,0x9C,0xDB,0x32,0x53,0xE0,0x95,0xEC,
+	0xDF,0xBD,0x57,0xBD,0x1B,0xEB,0xC3,0xFA,0x06,0x4A,0x7B,
+	0x3F,0x74,0x6D,0xB4,0xBB,0xDF,0x25,0xF3,0xA0,0xF0,0x63,
+	0xCE,0x1A,0x37,0x67,0x8A,0xA5,0x9E,0xF2,0xC6,0x92,0x2D,
+	0x06,0xE8,0x9F,0x89,0xB5,0x98,0x61,0x93,0xC0,0xFF,0x91,
+	0x82,0x25,0x9D,0xC6,0xAF,0xA0,0x99,0x6C,0x85,0x6E,0xEE,
+	0xD2,0xAC,0x05,0xD2,0xE2,0x81,0xE3,0x75,0xC8,0x43,0x4B,
+	0x15,0x6F,0xE2,0xDF,0xDD,0x45,0x91,0x47,0x76,0xAA,0xB2,
+	0x58,0x0A,0x7C,0x41,0xD6,0xD8,0xC7,0x6F,0x20,0xCD,0x58,
+	0x76,0xA2,0x8D,0xF8,0x1F,0xB6,0xAD,0x6B,0x79,0x95,0x75,
+	0xE2,0x29,0x6C,0xE4,0x15,0xAB,0x7E,0x4F,0xEA,0xBD,0x8E,
+	0x25,0x6C,0xA6,0x05,0xC2,0x5A,0xF7,0x57,0x52,0xE1,0xC6,
+	0x7E,0x06,0xB9,0x5B,0xB9,0xEA,0x13,0x3A,0x94,0xC4,0x49,
+	0x9D,0x37,0x8B,0x82,0x5D,0xC3,0x40,0xBE,0x3B,0x34,0xF3,
+	0xEA,0x0B,0xC7,0x9F,0x0B,0x9F,0xB7,0x19,0x2B,0xD5,0x9B,
+	0x42,0x0C,0x4F,0xA8,0xE1,0x47,0xD6,0x0A,0x4B,0x9F,0xAF,
+	0x37,0x17,0x0D,0xF3,0x06,0x2B,0xED,0x52,0xAA,0x42,0x80,
+	0xCA,0xC9,0x29,0x44,0xC4,0xA9,0x89,0x63,0xAA,0x4C,0x45,
+	0x65,0x9A,0x47,0x22,0xB7,0x20,0xAE,0x19,0x94,0x4D,0x00,
+	0x04,0x93,0x75,0xBC,0x81,0x96,0xE8,0xAA,0x25,0x7C,0x34,
+	0xF7,0xAB,0x8E,0xD4,0x55,0x73,0xB5,0xC7,0x88,0xFC,0xCB,
+	0xDA,0x94,0x9D,0xC4,0xDC,0x83,0xF9,0x36,0xD1,0xD6,0xF1,
+	0xD9,0x22,0xC7,0x12,0x4E,0xFE,0xCA,0x45,0xBA,0x56,0x26,
+	0x3D,0x6C,0xAA,0xFC,0x7A,0x74,0x34,0x66,0x49,0x2D,0xEA,
+	0xC0,0x93,0x4E,0x80,0xA5,0x18,0xF7,0x0B,0x0D,0xB0,0xE5,
+	0xDD,0xF7,0xDE,0x64,0x56,0x38,0xEA,0xA9,0x14,0xEC,0xDF,
+	0xED,0xEC,0xF7,0x87,0x4C,0xCC,0x1A,0x0A,0x7F,0x67,0xE0,
+	0x09,0x07,0xD3,0x0E,0x6A,0x30,0xEB,0x63,0x70,0xA9,0xA9,
+	0x90,0x83,0x4C,0x81,0xBC,0x50,0x69,0x48,0x70,0x12,0x64,
+	0x14,0xE6,0xE5,0x76,0xB8,0xA7,0x4F,0x23,0x43,0x02,0xE2,
+	0x62,0x7E,0x52,0x12,0xFE,0xC0,0xEC,0xAB,0x36,0x75,0xB9,
+	0x4E,0xA5,0x48,0xCE,0x4B,0x75,0x48,0x46,0xBB,0xC4,0x56,
+	0xD6,0x03,0x3D,0x5B,0xB6,0xAC,0x0C,0xE9,0x8D,0x88,0x52,
+	0x2C,0xDD,0x5F,0x86,0x79,0x80,0xFB,0xF3,0x20,0x72,0x3C,
+	0xC5,0xB9,0xBB,0xD0,0xE2,0x4A,0xDD,0x83,0x7F,0x98,0xDA,
+	0xF5,0x47,0xBE,0x8B,0xDC,0x9F,0xA9,0x40,0xE9,0xF8,0x42,
+	0x9F,0x16,0xC8,0x4F,0x0F,0xD8,0x8A,0x35,0xA3,0x2C,0xE1,
+	0x79,0x5C,0xE7,0x1D,0xF7,0x32,0x89,0x92,0x9A,0x0A,0x6C,
+	0x8B,0x30,0x49,0xE9,0x4C,0x4E,0x79,0x10,0x5C,0x2D,0xEF,
+	0xCA,0x0F,0x97,0x97,0x5D,0x0A,0xAF,0xBA,0xE1,0xB4,0x99,
+	0x3B,0xD1,0x45,0xB0,0x05,0xD3,0xCB,0xAB,0x58,0x33,0xF7,
+	0x22,0xD4,0x0C,0x96,0x21,0x5F,0xDB,0x71,0x2C,0x02,0x3E,
+	0xE7,0xBA,0xB7,0xDC,0x5C,0x0C,0xB4,0xC3,0x8A,0x00,0xC9,
+	0xA0,0x6B,0x7D,0x9A,0x19,0xA5,0x59,0xC8,0xA4,0x8C,0x79,
+	0x62,0x03,0x59,0x6A,0xF8,0xC6,0x89,0x96,0x7E,0x20,0x09,
+	0xEA,0x65,0x6D,0x11,0x4F,0x97,0x97,0xBA,0x87,0x52,0x3E,
+	0x53,0xF9,0xCA,0x47,0x79,0x58,0x98,0x85,0xFB,0x2F,0x7C,
+	0xAC,0xB9,0xD2,0x5B,0xCF,0xC9,0xA1,0xB5,0xA4,0xC7,0x8A,
+	0x23,0xEA,0x9E,0x89,0x3A,0x4E,0x35,0xCA,0x36,0x86,0x92,
+	0xDF,0xBF,0x3C,0x30,0x81,0x10,0xE8,0x06,0xD4,0x15,0x38,
+	0x9A,0x5C,0x1B,0xB6,0xD7,0x79,0x97,0x16,0x99,0xFB,0xCF,
+	0x82,0xCD,0x0F,0x35,0x1C,0x65,0x27,0xB7,0xEF,0x22,0xFF,
+	0x6B,0xC2,0x71,0x98,0x0E,0x9F,0x97,0xA8,0xB1,0xF5,0x93,
+	0xD8,0xA4,0xDC,0x7D,0xC9,0xBB,0x98,0x38,0x5B,0x9F,0x61,
+	0xCC,0xFB,0xFE,0x2E,0x65,0x94,0x6E,0x15,0x46,0x37,0x1C,
+	0xB7,0x5D,0xBF,0x35,0x8A,0x23,0xDC,0xD7,0x3D,0x9F,0xCC,
+	0xDD,0x63,0xD2,0xEA,0x43,0x01,0x3D,0x28,0x82,0x0E,0xD7,
+	0x06,0x5B,0x32,0x24,0x4D,0xF5,0xCF,0x22,0x8D,0x4C,0x35,
+	0x2A,0x43,0x41,0x56,0x59,0x44,0x15,0x42,0x50,0xB5,0x0E,
+	0xF3,0xF9,0xB6,0x44,0x89,0xC1,0x31,0xF5,0x4A,0xA2,0xEE,
+	0x8C,0x1B,0xC9,0x47,0x51,0xD8,0x97,0xAC,0xFB,0x3C,0x97,
+	0x0D,0x90,0x73,0x9A,0x34,0xE4,0x0D,0x59,0xAB,0x93,0x16,
+	0x8C,0x87,0x0D,0xEE,0x1F,0x7F,0x30,0xB5,0x94,0x8B,0x30,
+	0xF8,0xDA,0xE7,0x66,0x33,0x4C,0x0F,0x75,0xAE,0x7A,0x15,
+	0x6D,0xCE,0x09,0x94,0xD5,0xE5,0x7D,0x5D,0xE6,0x6A,0xDE,
+	0x40,0xAD,0x19,0xF1,0x67,0x84,0xCB,0x69,0xDA,0x12,0xF3,
+	0x4F,0xE4,0x4D,0xC8,0xDF,0x03,0xB4,0x08,0x1C,0x0E,0x5E,
+	0xBE,0x5A,0x31,0xA9,0x8F,0xB6,0xD0,0xFC,0xE0,0x90,0x15,
+	0xA2,0xFD,0xAF,0xEB,0x91,0x94,0x7A,0x88,0x4A,0xC4,0xF9,
+	0xD7,0x58,0x79,0xD4,0xD5,0x34,0xB5,0x0B,0x0A,0xBF,0x55,
+	0x51,0xCF,0x32,0xCB,0x44,0xC5,0x1D,0xDF,0xE1,0xA9,0x8E,
+	0x52,0x65,0xBF,0x1C,0x00,0x31,0xB8,0xA7,0xF6,0x01,0x86,
+	0xAC,0x65,0x78,0x89,0x26,0x9D,0x2B,0xA3,0x53,0x2A,0xA1,
+	0x77,0x0E,0x24,0x9E,0xDD,0x3C,0xE4,0x5E,0xD9,0x3D,0xA3,
+	0x8F,0x1F,0x82,0xD2,0x21,0x74,0x1A,0x0E,0x9E,0x6F,0x96,
+	0x89,0x90,0x43,0xD1,0x86,0x60,0x43,0x70,0x3A,0x94,0x4E,
+	0xC4,0x83,0xB5,0xA1,0x70,0xDB,0xA1,0x94,0x7E,0x29,0x33,
+	0x34,0x34,0x28,0xCB,0xA2,0xB9,0x09,0x63,0xE5,0x65,0x74,
+	0xB4,0xA6,0x2A,0xBB,0x73,0x92,0x29,0x23,0xA6,0xAC,0xFF,
+	0xD3,0x03,0x1E,0x20,0xBE,0x06,0x32,0xB1,0x8D,0x78,0x37,
+	0x61,0x09,0x73,0xA2,0x38,0xBF,0x7C,0xFB,0x18,0x5A,0xB8,
+	0x3D,0xE6,0x30,0x1A,0x16,0x66,0x5B,0x7E,0xE2,0x95,0x6A,
+	0x97,0xC7,0x11,0x6F,0x82,0x95,0xAD,0xAE,0xC7,0xA1,0xF7,
+	0x57,0x50,0x6A,0xAA,0x04,0x77,0x6D,0xF1,0x09,0x97,0x27,
+	0x9F,0xD6,0x61,0x4B,0x1E,0xF5,0x33,0x87,0xE0,0xF0,0xD1,
+	0x24,0x24,0xB8,0x91,0x0C,0xE5,0xFA,0xD8,0xFD,0xB8,0x80,
+	0x76,0xBA,0x6F,0xA8,0x7E,0x28,0xA0,0xF0,0xE9,0x3E,0x44,
+	0xF7,0xF6,0xD1,0xD7,0xED,0xD9,0x5F,0x51,0xB0,0xF8,0x25,
+	0x94,0xF4,0x89,0x2C,0xA1,0xCD,0xFC,0x69,0xBC,0x4A,0x67,
+	0x44,0x19,0xAE,0xE7,0xA6,0xFC,0x70,0xF9,0x09,0x36,0xDA,
+	0x55,0xEC,0xBD,0x89,0x4C,0x95,0xEA,0xAB,0xB3,0x40,0x92,
+	0xB8,0xEE,0xD5,0x2A,0xD4,0xB4,0x79,0xD3,0x2B,0x41,0xEF,
+	0x21,0x3F,0x29,0x6E,0x6F,0xAE,0xDB,0x95,0xDE,0xDC,0x96,
+	0xB6,0x96,0x6E,0x9A,0x0E,0xF9,0xB0,0xEE,0xD5,0x48,0xBC,
+	0xE2,0x40,0x35,0xC8,0xAC,0x6D,0xE1,0xB1,0xC7,0x34,0x8C,
+	0x9B,0x26,0xB4,0x10,0x05,0x4D,0x34,0x3C,0x31,0x20,0xA2,
+	0x1F,0xE5,0x23,0xA3,0x3F,0xA5,0xB9,0xF4,0x29,0x98,0x2F,
+	0x59,0xD6,0x01,0x98,0x00,0xD0,0xE3,0xE3,0x3B,0x6A,0x10,
+	0x52,0x44,0x05,0x42,0x68,0xA5,0xCE,0xA1,0x31,0xEE,0x83,
+	0x69,0xB2,0xD6,0x5B,0x8E,0xC0,0x84,0x13,0x4A,0x47,0xA0,
+	0x1D,0x80,0x93,0x78,0xCF,0xF6,0x4F,0xE6,0x7E,0x51,0xF5,
+	0x0E,0x9B,0x7E,0x0F,0xDC,0x92,0x45,0xF1,0x14,0x7F,0xA7,
+	0x6F,0x3F,0xD9,0x5A,0x31,0xCB,0xED,0x35,0xAD,0x43,0xC7,
+	0x0D,0x8A,0x1B,0x2B,0xA9,0xBF,0xCB,0x7D,0xD3,0x7B,0xA8,
+	0x05,0x0F,0x7C,0x5D,0xD6,0x19,0xC6,0x3C,0xBB,0xB1,0xE8,
+	0x52,0x85,0x0F,0x7D,0x2C,0x40,0x68,0xEE,0x44,0x35,0x60,
+	0x03,0xC4,0x7F,0x1C,0x37,0x39,0xD1,0x04,0xB5,0xEF,0xEB,
+	0x2D,0x20,0x6B,0xBD,0x14,0x84,0x8A,0xE7,0x51,0x12,0xC5,
+	0x10,0xAD,0x98,0x2A,0x89,0x56,0x5C,0x95,0x50,0x2B,0xA1,
+	0x4A,0xE4,0x01,0x71,0x66,0x86,0xFF,0x8E,0x36,0x73,0x88,
+	0x42,0x1B,0x12,0x1B,0x92,0x18,0x16,0x74,0x38,0x7E,0x5D,
+	0x3E,0xA9,0x3F,0xE7,0x5C,0x17,0xCC,0x51,0x79,0x38,0x0B,
+	0x9B,0x16,0x7C,0x09,0x4E,0x89,0x1A,0xDE,0x90,0x28,0x7B,
+	0x6E,0x09,0x17,0xBF,0x8C,0x7F,0x60,0xA5,0xA9,0xF6,0xB3,
+	0x84,0x13,0x04,0x69,0x09,0xC5,0xCD,0x2A,0xB6,0x41,0xB0,
+	0x43,0xD5,0xFF,0x40,0xF3,0x09,0x5D,0x93,0x77,0x61,0x42,
+	0x8B,0x6E,0xC1,0xCD,0xD8,0x4F,0xC0,0xD0,0x0E,0x3C,0x05,
+	0x02,0xE8,0x08,0xF9,0x97,0x49,0x03,0x16,0xCD,0x42,0x38,
+	0x02,0x70,0x55,0xC1,0x19,0x5F,0xD6,0xC6,0x3B,0xEA,0x86,
+	0xC3,0x9B,0x94,0x51,0x3F,0x06,0x73,0x6F,0x97,0xB5,0xE0,
+	0xE8,0x42,0xD0,0xC4,0x81,0x05,0xCC,0x53,0x55,0xA1,0xC6,
+	0x6E,0x93,0xB1,0x20,0xFC,0x8F,0xB7,0x65,0x66,0xFA,0x20,
+	0xB7,0xDB,0xBD,0xB5,0xF1,0x32,0x41,0xE1,0x9D,0x9A,0xC5,
+	0x80,0xC5,0xCC,0x6A,0x10,0x93,0x18,0xE9,0xD3,0x4C,0xB0,
+	0x73,0x6B,0xEF,0x57,0x9B,0x0D,0xB0,0x13,0x32,0xB1,0x90,
+	0x9B,0x11,0x90,0x72,0xB9,0x97,0xE2,0x56,0x82,0x24,0x95,
+	0xDB,0x73,0xF1,0xA7,0x09,0xFB,0x1D,0x5F,0xD7,0x5F,0x0E,
+	0x51,0x89,0x48,0x3C,0x5C,0xC6,0x40,0xDF,0xB7,0x45,0xA4,
+	0x64,0xEE,0x20,0x13,0x4C,0x54,0xC6,0x36,0x1E,0x40,0x8E,
+	0xEE,0xBC,0x23,0x70,0x95,0x11,0xA7,0x78,0xA5,0xB2,0x6A,
+	0x02,0xA3,0x5C,0xAA,0x9B,0x2A,0xB9,0x3E,0x79,0x94,0xD8,
+	0xA4,0x8A,0xA9,0x9F,0xF9,0x08,0x97,0x13,0x08,0x1A,0xAB,
+	0x15,0xED,0xD0,0xB8,0x2E,0x61,0x23,0xDA,0xCE,0xF7,0xC2,
+	0x95,0x79,0x93,0xD4,0x4E,0x0B,0x50,0x02,0xCA,0xE8,0x27,
+	0x1B,0x18,0xF1,0x16,0xFB,0x89,0xBD,0xBC,0x43,0xCF,0x6F,
+	0x02,0xB2,0x42,0x17,0xD1,0x95,0x72,0xA5,0x07,0xF9,0xAA,
+	0x10,0x3A,0xE4,0x00,0xC4,0x74,0x15,0x62,0x05,0x39,0xDC,
+	0xE1,0x0F,0x71,0x87,0xD0,0x9B,0xB0,0x87,0x11,0x16,0x06,
+	0xA8,0x50,0x5F,0x99,0x9E,0x3D,0xAB,0xC6,0x32,0x6C,0xCB,
+	0x2E,0x83,0xA2,0x4D,0xC6,0xEE,0xB3,0x2A,0x26,0x9A,0xA1,
+	0x47,0x1E,0x5D,0x11,0x4C,0x89,0xE8,0x11,0x11,0x80,0xA4,
+	0xA5,0x34,0x8F,0xA2,0x93,0x73,0x89,0x39,0x07,0x59,0xA5,
+	0x73,0x68,0x0E,0x2B,0x67,0x76,0xF6,0xAC,0x42,0x99,0x6C,
+	0xB0,0xA1,0xF4,0x58,0x92,0x8C,0xC2,0x17,0x28,0x46,0xFC,
+	0x77,0x63,0x70,0x3C,0xC9,0x96,0x58,0xD9,0x01,0x87,0x9E,
+	0xCA,0x05,0xC8,0xF0,0x91,0x5D,0x03,0x3B,0x12,0xFD,0x05,
+	0x24,0xF2,0x8A,0x3D,0x3C,0x07,0x65,0x09,0x33,0x84,0xC1,
+	0x59,0x11,0x70,0x37,0xF5,0x37,0x32,0x69,0xBD,0xEB,0x86,
+	0x4C,0x21,0x05,0xF3,0xA6,0x47,0xC2,0xE2,0x62,0x5E,0xD9,
+	0xA4,0xF0,0xD6,0xE3,0xD3,0xEA,0x50,0x91,0xB4,0x7A,0xAD,
+	0x4E,0x2E,0x67,0x73,0x30,0x6C,0xE0,0xF6,0xC7,0xFD,0xB0,
+	0xA6,0x49,0x55,0xE9,0xAC,0x88,0x44,0x1C,0x83,0x26,0x22,
+	0x63,0x59,0xD4,0x66,0x74,0xDE,0x2E,0x48,0x37,0x54,0x57,
+	0xB2,0x4D,0xFC,0xA6,0x98,0xDC,0x8F,0x17,0x92,0x06,0xED,
+	0x7B,0xB5,0x70,0x75,0x16,0xD2,0xE8,0x01,0xD6,0x3F,0xCA,
+	0xD2,0xF2,0xF3,0xFA,0x27,0xCE,0x10,0x74,0x2D,0x39,0x58,
+	0x98,0x13,0xD9,0xD4,0x1E,0x16,0x63,0x3D,0xFB,0x10,0x6A,
+	0x8D,0xBE,0xA6,0x6A,0x35,0xD8,0x4F,0xCF,0x68,0xDA,0xCC,
+	0x73,0x29,0x3E,0x7C,0x50,0xEC,0x5A,0xFB,0x08,0xC7,0xC4,
+	0x2E,0x48,0x06,0x52,0x02,0x74,0x85,0xCD,0xDC,0xDE,0x57,
+	0x04,0xB5,0x50,0x1A,0xB5,0x16,0x3F,0xE5,0x1D,0x75,0xA0,
+	0x04,0x76,0xC7,0x56,0xCC,0x2A,0x48,0x02,0x62,0xDF,0xD6,
+	0x55,0x8A,0x38,0xC3,0x0F,0x32,0xC0,0x39,0xD7,0x4B,0x42,
+	0xEE,0x9D,0xEA,0x72,0x1C,0x8D,0x81,0x2E,0x71,0x8E,0x41,
+	0x6B,0xD7,0xBC,0xA0,0x7B,0x04,0x3E,0x47,0x1F,0x9A,0xED,
+	0x13,0x18,0x75,0x6E,0xAB,0x15,0x11,0x74,0xE3,0xEF,0x16,
+	0x03,0x5C,0xE5,0xCA,0xF7,0x45,0x3A,0x84,0x48,0xB9,0xD9,
+	0x18,0x80,0x02,0x6D,0x32,0x20,0xCC,0x4B,0xFC,0x1E,0xB4,
+	0x4C,0x08,0xEE,0xF2,0xF6,0xCD,0x45,0x91,0x05,0xD8,0x75,
+	0x09,0x55,0x13,0x35,0x68,0x40,0x93,0x8D,0xB2,0x56,0xD6,
+	0x77,0xCE,0x30,0xA4,0xBF,0x1A,0x1E,0x4C,0xB5,0x87,0x3C,
+	0xDA,0x80,0x70,0x8A,0x20,0xAE,0x3E,0x1C,0x95,0xEA,0x71,
+	0x95,0xA4,0x5F,0x4A,0x1B,0xA9,0xAA,0x9F,0x4E,0x42,0x34,
+	0x69,0x27,0x5C,0x15,0x4F,0xD6,0xED,0xBB,0x02,0x3F,0x25,
+	0xDD,0x20,0xAD,0x2A,0x89,0xEA,0x5C,0xDD,0xE3,0x88,0xCD,
+	0x38,0x90,0xC3,0x51,0xC1,0x86,0xA5,0xA4,0x0D,0x20,0x20,
+	0xDF,0x27,0x80,0xBF,0x06,0x70,0x26,0x00,0x19,0xEF,0x30,
+	0x10,0xE9,0x95,0x15,0x5F,0x0B,0x7C,0x1E,0xB9,0xDD,0xAD,
+	0xD6,0x1B,0xFF,0xB0,0x70,0x09,0x8A,0x64,0x44,0x85,0xCB,
+	0xD7,0x5C,0xA3,0x1F,0x1E,0x7E,0x74,0x44,0x41,0xF5,0xC9,
+	0xD5,0x44,0xA6,0x98,0x34,0xCC,0x45,0xE9,0x72,0x32,0x3E,
+	0x93,0x5B,0x47,0x11,0x05,0x5D,0x04,0x7F,0x1C,0x55,0xF6,
+	0x6D,0xA8,0x57,0xBF,0x0B,0xD9,0xAD,0x23,0xB5,0x78,0x08,
+	0x3D,0xB5,0xDE,0xC5,0xDB,0xAE,0x62,0xBD,0x14,0xD5,0xC7,
+	0xC3,0xBA,0x78,0x87,0x00,0x27,0xE0,0x08,0x1F,0x70,0x86,
+	0x7A,0x42,0xFD,0xA1,0xAE,0x3D,0xD0,0xD3,0x6F,0x2A,0xCD,
+	0xEF,0x1C,0xFC,0x10,0x2A,0x16,0x67,0x0D,0xB8,0x26,0x1D,
+	0x03,0x3C,0x81,0x4F,0x24,0x3D,0xFE,0x4B,0xE8,0x77,0xE8,
+	0x12,0xA0,0xCE,0x87,0x9C,0x83,0x89,0x42,0xB7,0x21,0x06,
+	0x8F,0x60,0x23,0xE8,0x47,0x9D,0x63,0x37,0x00,0xE8,0x7F,
+	0xD3,0xFB,0xE6,0x60,0xDD,0x6F,0x3E,0x12,0xC7,0x1E,0xC1,
+	0xDE,0xFD,0xCB,0x69,0xF1,0xEC,0xB5,0x5A,0x3A,0xAD,0x02,
+	0xFD,0x82,0x1E,0x92,0x47,0x3B,0xE4,0xED,0x92,0x38,0x9A,
+	0x6D,0x6A,0xB0,0x21,0x05,0x31,0x6B,0xCC,0x29,0xF8,0x3D,
+	0x23,0xCE,0xC0,0x2A,0x34,0xD4,0xEA,0x03,0xEE,0x74,0x24,
+	0xC3,0xFC,0x50,0x15,0x23,0x2E,0x30,0x52,0x31,0xBD,0xE9,
+	0x3F,0xA8,0xA3,0x7B,0xA6,0x96,0xC5,0x94,0x70,0xED,0x8B,
+	0x48,0xED,0xF7,0x10,0x8B,0x0B,0x08,0xDF,0x0A,0x48,0xB6,
+	0x94,0xDC,0x96,0x9B,0x39,0x37,0x1D,0x52,0x81,0x49,0x3A,
+	0x0D,0xE1,0x48,0x5C,0x3B,0x47,0x44,0xD3,0x8C,0x19,0x2A,
+	0x59,0xD4,0xDA,0xA2,0xD8,0xA2,0xAA,0x42,0x2F,0xD7,0xF3,
+	0x9C,0x94,0x91,0xB4,0x1B,0xCA,0xCA,0xE6,0xF5,0x5A,0xA8,
+	0xCD,0x10,0x8E,0x14,0x5F,0xF5,0x7B,0x66,0x2D,0x25,0xB5,
+	0x68,0xE7,0x82,0xE1,0xB9,0xCD,0xA0,0x99,0xAA,0xEB,0x58,
+	0xB1,0x2D,0xEE,0x30,0x90,0x45,0x65,0xA9,0xA4,0x11,0xAE,
+	0xAA,0x98,0x21,0xAF,0xAB,0xD0,0x60,0xE5,0x45,0x2A,0x79,
+	0x7F,0x0E,0xEE,0xA6,0xC5,0x4B,0xAF,0x82,0x7F,0x2D,0x38,
+	0x5B,0xC8,0x35,0x10,0x79,0x0C,0x75,0x95,0xC1,0xBF,0x8B,
+	0x68,0x45,0x46,0x20,0xFF,0xE5,0x23,0x96,0x10,0x7F,0x91,
+	0xAD,0x60,0x39,0x1B,0x9C,0x42,0x5A,0x8E,0x8D,0x97,0x79,
+	0xDE,0x14,0x14,0x22,0x5F,0x27,0xD4,0x13,0x2D,0x3C,0x29,
+	0xB1,0xCF,0x2C,0x46,0x0E,0x04,0x35,0x67,0x89,0x9C,0x8E,
+	0xFD,0x06,0x45,0xED,0xBF,0xF6,0xF9,0x11,0x94,0x2C,0xE3,
+	0x41,0x93,0xBD,0xF1,0x61,0x0C,0x8A,0x0A,0x38,0xEE,0xF3,
+	0xBE,0xA8,0x12,0x3C,0x6A,0x97,0x1B,0xFA,0xC8,0xD1,0x93,
+	0x22,0xAA,0xDC,0x9F,0x7A,0xE6,0xBC,0xEC,0x97,0x3B,0x61,
+	0x68,0x44,0x33,0x1C,0x8F,0x1D,0x02,0xBF,0xA1,0xD4,0x2F,
+	0x63,0x5E,0xE3,0xAC,0x09,0x72,0xC4,0x5B,0xC1,0x24,0x1B,
+	0xD1,0x4A,0x63,0xF1,0x42,0x6A,0xEF,0x39,0x29,0x2A,0x6D,
+	0x78,0x4D,0xD6,0x40,0x7E,0x7A,0x49,0x31,0x4E,0x38,0x65,
+	0x84,0x5C,0x61,0x7E,0xDE,0xE5,0x40,0x24,0xB4,0xA7,0x2A,
+	0x8F,0x17,0x1E,0xB9,0x20,0x7F,0x6C,0x6C,0x13,0xBB,0xDC,
+	0x46,0x24,0x34,0x5E,0x73,0x50,0xAB,0x71,0x5F,0x42,0xF1,
+	0x58,0x6F,0x3C,0x61,0xBD,0xB0,0x9A,0xF9,0x9A,0x2A,0xD9,
+	0x90,0x5C,0x1E,0x59,0x3E,0x64,0x10,0x5C,0x95,0xBD,0xBB,
+	0xAF,0x14,0xD7,0xF8,0x1B,0xC8,0x5C,0xCD,0x6C,0x35,0xC5,
+	0x3B,0xF6,0xBF,0x6F,0x03,0x7C,0xD6,0xCE,0xAD,0x2F,0x6D,
+	0x80,0x1B,0x96,0x45,0xEB,0x26,0x6B,0x37,0x6C,0x2B,0x03,
+	0xDA,0xCB,0x8D,0xC0,0xA8,0x53,0x49,0xA2,0xA9,0x2B,0xA0,
+	0x11,0x39,0x66,0x2A,0x9E,0x28,0xF4,0x51,0x05,0x2B,0x11,
+	0x4F,0xE1,0x0A,0x17,0x06,0x7D,0x6F,0x4B,0x73,0x15,0x30,
+	0x82,0x89,0x47,0x08,0xD1,0x10,0x9E,0xDF,0x9A,0x7D,0xB7,
+	0xDA,0x35,0x6E,0x6C,0xEE,0x40,0xCE,0xFC,0x28,0x80,0x8C,
+	0x11,0x09,0xDB,0x7F,0xF9,0xF1,0x5B,0x65,0xF7,0x8E,0x0B,
+	0x4F,0xC9,0xB9,0x53,0x8D,0x81,0x82,0x75,0xD7,0xEF,0x2F,
+	0xE4,0xB0,0x11,0xA8,0xB5,0xC7,0x42,0xD0,0x92,0xF5,0x0D,
+	0x59,0x8A,0xF3,0x31,0x94,0xB0,0x76,0xCE,0xDA,0x01,0xC2,
+	0xFD,0x6C,0x33,0xF7,0xF9,0x1D,0x59,0x97,0x16,0x01,0xE3,
+	0xA3,0xCA,0x68,0xFF,0x0D,0x6D,0xE0,0x31,0x52,0x73,0x0C,
+	0x7D,0x59,0xA4,0xE6,0x8A,0xEF,0x35,0x54,0x8B,0xC1,0x07,
+	0x1E,0xCE,0xA2,0xBF,0x2D,0xB9,0x1E,0x84,0x25,0x6A,0x5E,
+	0xCB,0xF8,0xC4,0x55,0x2C,0xC7,0x04,0x6C,0x0D,0x8C,0x58,
+	0xCB,0x0D,0xF8,0x3C,0xC8,0x14,0x60,0x26,0xFD,0xE7,0xF8,
+	0xB3,0xEC,0x5E,0x9C,0x5D,0x13,0xCA,0xC9,0x6F,0xB8,0xB2,
+	0x2E,0x2A,0x78,0x20,0x60,0xB6,0x4C,0x34,0xCD,0xD9,0x09,
+	0x63,0xBF,0x95,0xB9,0x03,0x26,0x9C,0x40,0xB6,0x4E,0x0E,
+	0xC2,0x64,0x0C,0x5C,0x61,0xF1,0x5C,0x07,0x1C,0x8E,0xBE,
+	0x76,0x90,0x50,0x0A,0x0D,0xA1,0x83,0xFF,0x25,0x2A,0x28,
+	0x82,0x42,0x89,0xA2,0x62,0xE0,0x7A,0x22,0x36,0x0A,0xD9,
+	0x04,0x35,0x4A,0x8B,0xFF,0xB1,0x17,0xC7,0x3F,0x0D,0x8B,
+	0x83,0xA5,0xC1,0x0A,0xA2,0x54,0x60,0xFF,0xC2,0xA6,0x1A,
+	0x60,0xE9,0x8C,0x78,0x6A,0x5F,0x7F,0xD6,0xF1,0x7D,0x19,
+	0x63,0x16,0xB7,0xEC,0x9C,0xE0,0x61,0xD1,0x24,0xF4,0xAD,
+	0x7D,0xBE,0x16,0x71,0xD1,0x30,0xDB,0xC3,0x0E,0x6D,0x1B,
+	0xFA,0x07,0x84,0xE0,0x26,0xF2,0x59,0x0A,0xAF,0xE7,0x05,
+	0x03,0x49,0xDA,0xD7,0xC0,0xAA,0xF0,0x27,0xA6,0xF3,0x5C,
+	0x18,0x0F,0x26,0xB8,0x07,0x97,0x87,0xEB,0xC3,0x0F,0xAB,
+	0xCA,0xC3,0xE5,0x6C,0x94,0x8A,0xF6,0x92,0x08,0xC0,0x11,
+	0xDC,0x75,0x06,0x3F,0xDC,0x22,0x5D,0xC3,0x43,0x0E,0xB8,
+	0xC5,0x97,0x37,0x01,0x4C,0x98,0x09,0x65,0xBD,0x8B,0x90,
+	0x68,0xA4,0xE0,0x59,0x69,0x39,0x17,0x25,0x75,0xB0,0x38,
+	0x5F,0x2D,0xA4,0x4C,0x9E,0xA9,0x8C,0x9C,0xA7,0x69,0x96,
+	0x85,0x22,0xD6,0x56,0xB0,0x2D,0x62,0x62,0x22,0x71,0x30,
+	0x99,0x1E,0x15,0x57,0xCD,0x9B,0xF1,0x53,0xDA,0xF2,0x77,
+	0x61,0x75,0xF8,0x83,0x7A,0x01,0xFB,0xC9,0x0A,0x1E,0xB3,
+	0x65,0x22,0x69,0x5F,0x02,0x6C,0x40,0xD5,0xA3,0xB3,0x65,
+	0x88,0x73,0x22,0x34,0xF5,0x44,0x1D,0x98,0xEA,0x40,0x66,
+	0x72,0xCB,0x01,0x78,0xC0,0x39,0xD3,0x67,0x10,0xC5,0xFC,
+	0x02,0xB8,0x7F,0x42,0x79,0x1B,0x14,0x0D,0x86,0xA3,0x5E,
+	0xFF,0xC6,0xC4,0xE1,0x4C,0x60,0x8E,0x04,0xE2,0xAD,0x23,
+	0xA4,0x48,0xD1,0x6C,0x78,0x88,0xF8,0x33,0x6A,0xF9,0x98,
+	0x14,0x6D,0x4C,0x0F,0x21,0xAB,0x27,0x7F,0x24,0x51,0x51,
+	0xEB,0x99,0xF0,0x7F,0x03,0xE4,0x0D,0xBC,0x22,0xA5,0xCB,
+	0x6A,0xA0,0xFB,0xC3,0x65,0x99,0xF5,0xFE,0xDB,0x0B,0x44,
+	0xFD,0x7E,0x35,0x26,0xE5,0x63,0x8B,0xDC,0xA7,0xFE,0x4B,
+	0xFC,0xF9,0xFE,0x69,0x17,0xDB,0x39,0x23,0xAE,0xF5,0x57,
+	0x5F,0x32,0xAD,0x08,0x68,0xB0,0x45,0x18,0x7D,0x26,0xC2,
+	0x8E,0x1F,0xCC,0xF7,0x91,0x70,0x11,0xC1,0xC6,0x6B,0xCE,
+	0xB8,0x40,0x89,0x36,0x16,0x40,0xB8,0xA5,0x95,0x05,0xFF,
+	0x2D,0xAC,0x88,0xE0,0x00,0x4D,0xC5,0xA5,0x75,0x68,0x66,
+	0x08,0x22,0x98,0x27,0xE5,0x70,0xC1,0x52,0x79,0x4D,0x59,
+	0xA4,0xEB,0x4B,0xA8,0xD6,0x86,0x4E,0x84,0x20,0xA9,0x40,
+	0xDC,0x87,0x1D,0x25,0x98,0x17,0x71,0xBA,0x05,0xFB,0xC1,
+	0x56,0x01,0xE6,0x00,0xDD,0x55,0x7D,0x0F,0x59,0x27,0xDA,
+	0xD7,0x08,0x27,0x06,0x28,0xC2,0x21,0xF7,0xF5,0xBC,0x5D,
+	0xE5,0x2A,0x30,0xFD,0x49,0xDF,0x48,0x5F,0x91,0xAC,0x1D,
+	0xBD,0x39,0x62,0x0B,0xFE,0x50,0xB5,0x72,0x11,0x24,0x04,
+	0xDE,0x7E,0xD9,0xA8,0xCE,0xAB,0x9A,0x50,0x8E,0xC0,0x82,
+	0x07,0xFC,0xBB,0x3E,0x00,0xFE,0xC8,0x28,0x27,0x26,0xBF,
+	0x2C,0x0B,0xCF,0x4D,0x61,0x6E,0x72,0x8A,0x21,0xCD,0x89,
+	0x43,0x24,0x05,0x19,0x9C,0x00,0x46,0x90,0xA8,0x96,0x2D,
+	0x78,0x59,0xF2,0xD9,0x8D,0x44,0x9D,0x7F,0x7E,0x9D,0xE2,
+	0x49,0x8A,0x43,0xA2,0x8F,0xCB,0xB9,0xDB,0x98,0xC5,0xAC,
+	0xA7,0xA7,0x3C,0xDF,0x82,0x32,0x56,0xB2,0xFB,0xE6,0x0E,
+	0x2A,0x80,0x89,0x6E,0x36,0x6B,0xBB,0xAD,0x32,0x4B,0x18,
+	0x58,0xD0,0x2E,0xF5,0x27,0xF0,0xDE,0x82,0x39,0x9D,0x3B,
+	0xF7,0xD6,0x9A,0xB3,0x00,0xF4,0x60,0x7A,0xB9,0x00,0x7E,
+	0x99,0xF3,0xF6,0x3F,0x8A,0xC6,0x39,0xCE,0x4B,0xE0,0x98,
+	0x1A,0x17,0x31,0x8B,0xE6,0x42,0x9C,0x64,0xF6,0x4E,0xD6,
+	0xDF,0x79,0x32,0x47,0xE0,0x3C,0xFC,0x9F,0xBE,0xC6,0x33,
+	0xE1,0x9A,0x4D,0x34,0xEB,0xC3,0x11,0x85,0x7A,0x0F,0x6B,
+	0x7C,0x9F,0x72,0x32,0x2D,0xAB,0x37,0x52,0x3A,0xE1,0xF0,
+	0xB5,0x73,0x9D,0xE0,0x1A,0xA3,0x13,0x39,0x1F,0x75,0x2C,
+	0xF4,0x6D,0x27,0x46,0x6D,0xED,0x54,0x0B,0xC4,0x7E,0xED,
+	0xB4,0xD5,0xB7,0xFB,0x40,0x34,0x5E,0xD5,0x21,0xA5,0xA8,
+	0x05,0xC7,0x91,0x56,0xAA,0x86,0x15,0xC1,0x4B,0xCF,0x4D,
+	0x28,0xF0,0xAB,0x03,0x1E,0x20,0x26,0x0B,0x57,0xFB,0x2A,
+	0xAF,0xCC,0xCE,0x22,0x2A,0xC7,0x1E,0xCB,0x4D,0xDB,0x56,
+	0x21,0xBF,0xCD,0x4A,0x66,0x1F,0xEF,0x37,0x14,0x8C,0xBC,
+	0x5F,0x8E,0xD3,0x58,0x32,0xEF,0x12,0xF9,0x89,0xF6,0x2A,
+	0x33,0x89,0x25,0xBC,0xD9,0x8D,0xFF,0x1D,0xCC,0x83,0xE7,
+	0x22,0xEE,0xE8,0xBD,0xFC,0xAB,0xD1,0x24,0x01,0xD0,0x80,
+	0xCF,0x01,0x3C,0x8E,0x23,0xE0,0xAC,0xFE,0x8D,0x1F,0x08,
+	0x9C,0x00,0x82,0x80,0xD3,0x00,0x2F,0x02,0x88,0x02,0xCE,
+	0x02,0x90,0x29,0x00,0xCA,0x00,0x44,0xC3,0xF0,0xCA,0x19,
+	0xC1,0xF7,0x51,0xA9,0x9A,0x00,0x1D,0xB0,0x01,0x2C,0x4C,
+	0x67,0xED,0x54,0xE7,0x3F,0xB8,0x72,0x20,0xEB,0xCD,0x10,
+	0xD8,0x09,0xE8,0x82,0x2D,0xD4,0x89,0x52,0xEF,0x0B,0xDD,
+	0x38,0x02,0x0D,0x86,0xE2,0xC9,0x73,0xD2,0xE1,0xD0,0x70,
+	0x2E,0xFA,0x84,0xD0,0x47,0x01,0xDB,0x04,0xCA,0x1E,0x04,
+	0x15,0x07,0xF3,0x88,0xDC,0xE7,0x2D,0x2C,0x77,0x08,0x62,
+	0xA1,0xF3,0x49,0x57,0x0A,0x12,0x88,0xC2,0xDF,0x95,0x9D,
+	0x7D,0x9C,0x79,0x3F,0x44,0x28,0x74,0x71,0x60,0x34,0x49,
+	0x03,0x30,0x47,0xBF,0xC2,0xFE,0x21,0xBB,0xB4,0x1A,0xB4,
+	0x7D,0xFC,0x6A,0x88,0x4F,0x7F,0xCE,0xA5,0xB3,0xF6,0xEB,
+	0x9E,0x3E,0xD4,0x8A,0x86,0x3D,0xE1,0x6B,0x95,0xE6,0xD3,
+	0x81,0x32,0x03,0xC2,0x57,0xAC,0x16,0x4C,0xBE,0x4D,0x2F,
+	0x08,0x13,0x82,0x84,0xDC,0x6A,0xBB,0xA0,0x10,0x7C,0xEA,
+	0x54,0x2B,0x2E,0x4D,0xE7,0xB5,0x2F,0x4E,0x9E,0xBE,0x45,
+	0x17,0x45,0x8A,0xD2,0x62,0x4B,0xA8,0x22,0x69,0x43,0xA4,
+	0x2F,0x73,0xBC,0x6F,0x8B,0xC0,0x87,0x44,0xDC,0x1B,0xC8,
+	0xD0,0x6B,0x3D,0x1F,0x62,0xCE,0x85,0xA9,0xBB,0xBC,0xF1,
+	0x48,0x5C,0x80,0xB6,0x01,0x4A,0xDF,0x72,0xFA,0x6E,0xDC,
+	0x77,0xB9,0xEA,0xC9,0x88,0x9F,0x9D,0xB2,0x06,0xE5,0xA1,
+	0x96,0xF0,0x91,0x4F,0xA8,0x17,0xB8,0x12,0x83,0x3A,0x4B,
+	0x0F,0xBD,0x7C,0xDD,0x37,0x6D,0x52,0x3A,0x42,0x32,0x5A,
+	0x6E,0xDE,0xCB,0x61,0x3C,0x72,0x82,0x90,0xEE,0x51,0xF5,
+	0x11,0x50,0xF8,0xB0,0xB7,0xB0,0x36,0x4D,0x52,0xEA,0xCE,
+	0x34,0xFB,0xA2,0xDD,0x4C,0xAC,0x17,0xD6,0xF8,0x1D,0x74,
+	0x05,0xBC,0x8A,0x3A,0x91,0xB5,0x1A,0x36,0xCA,0xBE,0x99,
+	0xD0,0x62,0x51,0x07,0x3F,0x1C,0x26,0xEB,0xA8,0x6F,0x9F,
+	0xCD,0x19,0x0E,0x13,0x46,0x26,0x26,0x6A,0xAB,0x68,0x3E,
+	0x5B,0xD6,0x73,0x44,0x11,0xE4,0x1D,0x1B,0xD6,0xE8,0xE8,
+	0x88,0x93,0xB7,0xB3,0x13,0x85,0xD1,0x6C,0xCA,0x4A,0x20,
+	0x7D,0x92,0x78,0x43,0x2A,0x59,0x98,0xC4,0xD1,0x50,0x3C,
+	0x20,0x7A,0x44,0x4F,0xE0,0x4A,0x78,0x98,0xC0,0x1C,0x4F,
+	0x91,0xB4,0xDC,0xEE,0xAF,0xAB,0x17,0x66,0x79,0xE3,0xA4,
+	0xEE,0x5D,0x5A,0xEC,0x5D,0xE4,0x75,0x13,0x6C,0xB9,0x9A,
+	0xAE,0x7A,0x9B,0x75,0xA8,0xD9,0x52,0x28,0x61,0xFC,0x1C,
+	0x4E,0xEE,0xF2,0x78,0x91,0xA6,0x81,0x26,0x6C,0x0C,0x63,
+	0x80,0x97,0x3F,0x07,0x8A,0xAC,0x6D,0xEC,0xC1,0x36,0x8A,
+	0xF6,0xC4,0x2C,0x97,0x08,0x85,0x9A,0xD6,0x1D,0x66,0x4B,
+	0x1D,0x84,0xA4,0xE8,0xEF,0x35,0xF4,0xD6,0x23,0x62,0x19,
+	0xB0,0xA2,0x0C,0xE3,0x46,0x83,0xC0,0xCD,0x21,0x41,0x21,
+	0xDB,0xA2,0x3D,0xAA,0xED,0xDE,0xB5,0x61,0xCC,0xB9,0x33,
+	0xC2,0x54,0x9F,0xBD,0xD6,0x33,0xC2,0x6B,0x89,0x22,0xC0,
+	0x52,0x8D,0x08,0x64,0xD8,0x4D,0xF8,0x9C,0x9B,0x30,0x26,
+	0x59,0x15,0xD6,0xF2,0xE3,0xCF,0x22,0xFC,0xAD,0xA0,0x38,
+	0x6C,0x3D,0x9F,0xBC,0x91,0xF9,0x51,0xC9,0x90,0x8E,0x90,
+	0x37,0x10,0xA2,0x2C,0xE5,0x83,0xF9,0x66,0xC1,0x01,0xC5,
+	0x48,0xEA,0x88,0x48,0xE0,0xD6,0xDA,0x51,0x40,0x03,0x98,
+	0xBF,0xA1,0x43,0x90,0xA7,0xBF,0xFD,0x7F,0xAA,0x2D,0xE7,
+	0xAE,0xF0,0xC4,0x36,0x7C,0xDF,0xFE,0xD6,0x41,0xD9,0x52,
+	0x09,0xD3,0x22,0x9A,0x7F,0xFE,0x1E,0x86,0x6E,0x01,0x09,
+	0x58,0x23,0x1D,0x3B,0x34,0x6E,0x35,0x3F,0x34,0x7D,0x28,
+	0x94,0x6A,0xB5,0x86,0xB1,0x04,0x6F,0x91,0x35,0xCD,0x96,
+	0x34,0x09,0xC9,0xE7,0xB0,0x32,0x97,0xA9,0xC3,0x1B,0x7B,
+	0xF9,0x6B,0x8F,0x9B,0xFE,0xEA,0xE0,0x64,0x2E,0xD3,0x8B,
+	0x3A,0x0C,0x3A,0x60,0xB7,0x7E,0x0A,0xD8,0x06,0xD9,0x06,
+	0x65,0x10,0x32,0xCC,0x7E,0x2B,0x1B,0xDB,0x11,0x71,0x7E,
+	0xF9,0xB6,0xE9,0x43,0xB6,0xD4,0xC0,0x57,0xCA,0xE4,0x8C,
+	0x04,0x21,0xE3,0xBB,0x2A,0xD5,0x04,0xB3,0xEF,0x84,0x18,
+	0x42,0x59,0xC2,0x01,0x13,0xB5,0x02,0xE3,0x7D,0xB4,0x33,
+	0xF4,0x01,0x83,0xF7,0xBB,0x90,0xE1,0xF7,0xBB,0x87,0x1F,
+	0xD7,0x10,0x9E,0x17,0x85,0xAF,0xE5,0x91,0x0D,0xBE,0xED,
+	0xC6,0xE5,0x91,0x39,0x0A,0x14,0x0F,0x60,0x4A,0xD8,0xAF,
+	0xCC,0x4B,0xA6,0x21,0xBA,0x8D,0xEC,0x58,0x32,0xB9,0x31,
+	0x98,0x33,0x27,0x62,0xF4,0xBD,0x2C,0x50,0x90,0xE0,0x30,
+	0xE8,0xC8,0x20,0xDB,0x15,0x9D,0x63,0x90,0x05,0x58,0x5B,
+	0xB6,0xC5,0x7B,0x99,0x7C,0x1C,0x03,0x01,0xD0,0x95,0xA5,
+	0x7C,0x60,0x17,0xBA,0x85,0xB7,0xDE,0x71,0x35,0xD4,0x8F,
+	0x05,0x7B,0x66,0x5E,0xEB,0xB2,0x4F,0x91,0xF0,0xC8,0x3E,
+	0x9E,0x27,0x84,0xBA,0xA6,0x5C,0x22,0xB6,0x19,0xAB,0xC2,
+	0x44,0xF3,0xAD,0x29,0x8F,0xE2,0x11,0x49,0xA3,0x46,0xB1,
+	0x9A,0x48,0x87,0x12,0x32,0xD5,0x72,0xD2,0x06,0x62,0x2C,
+	0xE5,0x40,0xB6,0xE7,0x42,0x93,0x46,0xA8,0xC2,0x32,0x39,
+	0x8F,0x64,0x19,0xC5,0xE0,0x11,0x9F,0xE6,0xDB,0x9D,0x28,
+	0xD7,0xB9,0xEA,0x8D,0x96,0xF7,0xC6,0x6D,0x9A,0xB0,0x10,
+	0x45,0xC8,0xB0,0xB1,0x18,0x12,0xDF,0x66,0x42,0x47,0xD8,
+	0xD7,0xBA,0xAB,0x0F,0xFB,0x88,0x21,0xAD,0x93,0x34,0x91,
+	0x59,0x9F,0xE3,0xC5,0x6C,0x15,0xDA,0x53,0xE9,0x4B,0x68,
+	0xA5,0x7C,0x31,0x92,0xEC,0xA1,0xF9,0x16,0x3A,0x56,0xE6,
+	0x40,0x8D,0x58,0xB1,0xB4,0xFA,0xAF,0xBF,0x74,0x3C,0xBA,
+	0x7F,0x44,0xEC,0x32,0xF5,0xEC,0x7E,0xD3,0x10,0x0D,0x01,
+	0x99,0xFE,0x9F,0x62,0x97,0x25,0x12,0x4E,0xEA,0x0C,0x0B,
+	0x12,0xB0,0xE2,0xF2,0xE2,0xAC,0xCE,0x9B,0x3A,0x42,0xB6,
+	0x31,0xDA,0xE2,0xF2,0x62,0xB6,0xCC,0x19,0xDD,0x9C,0x11,
+	0x09,0xCE,0x7F,0xC9,0x26,0x30,0x86,0x06,0x98,0xB6,0xA4,
+	0x2E,0xCA,0x9A,0x23,0x1C,0xFC,0x77,0x48,0x87,0x69,0x25,
+	0x7A,0x59,0x23,0xC1,0x46,0x67,0x58,0x88,0x70,0x5C,0xB4,
+	0x5E,0x43,0x3D,0xED,0xAF,0x0E,0x42,0xDD,0xFD,0x2B,0x7D,
+	0x9A,0x4E,0x38,0x3E,0xA4,0x10,0xD5,0x4A,0x2F,0x42,0xDE,
+	0x88,0xA6,0xBE,0xDF,0x4D,0x5B,0x7A,0xBF,0x0B,0xAE,0x9D,
+	0x43,0xA3,0x2F,0xE7,0x15,0x95,0x19,0x94,0xC1,0xC6,0x54,
+	0xCC,0xB0,0x32,0xF4,0x32,0x7A,0x00,0x32,0x80,0x16,0x17,
+	0x34,0x84,0x77,0xA8,0xCB,0x57,0x4C,0x1F,0x52,0xA4,0xFE,
+	0xB3,0x26,0x20,0x34,0x2A,0xF7,0xBD,0x78,0xE7,0x23,0x8E,
+	0x93,0x35,0x38,0x2C,0xF3,0xFA,0x0C,0xA5,0xBE,0x68,0x87,
+	0x5A,0xBF,0x73,0x39,0xCB,0x5F,0x3D,0x65,0x80,0x7E,0xD6,
+	0x6C,0xE9,0x2C,0xC1,0x86,0xE4,0xDF,0x7E,0x95,0x2E,0x66,
+	0x0A,0x2B,0x32,0x3D,0x90,0x76,0xD8,0xFF,0xFB,0x03,0x7A,
+	0x10,0x9C,0x00,0x37,0xFB,0xD6,0x5A,0x84,0xBD,0xD1,0x4D,
+	0x1D,0xD9,0x2E,0x59,0xC0,0x5D,0x7E,0x31,0x89,0xA7,0x3B,
+	0x4C,0xE4,0x17,0xA5,0x0F,0x15,0x51,0x55,0x14,0xFC,0xE3,
+	0xBF,0xD3,0xE9,0xEE,0xDE,0xB8,0xDE,0x17,0xD6,0xF4,0x1D,
+	0x13,0xA8,0xE8,0x9A,0x0E,0xF5,0x7F,0x60,0xF0,0x7F,0xC0,
+	0x58,0x54,0xD4,0x59,0xE5,0x73,0xD1,0x5F,0xEA,0xE7,0xBF,
+	0x69,0x4B,0x13,0x66,0xA0,0x88,0xD9,0xCD,0x9A,0xBF,0x25,
+	0x9F,0x70,0x34,0x15,0x03,0x01,0x73,0x48,0x91,0x88,0x62,
+	0x64,0xB7,0xF1,0x52,0x24,0xE8,0x27,0xAF,0x4A,0x40,0x59,
+	0x02,0xFE,0xDE,0x9F,0xFA,0xFF,0x7A,0xB5,0xCA,0xCD,0x88,
+	0x03,0xB1,0x28,0x09,0x37,0xBC,0x79,0x09,0x46,0x03,0xC3,
+	0x44,0x3B,0xB1,0x69,0xB3,0x3F,0x05,0x4C,0xC2,0x40,0x74,
+	0x0C,0x97,0xA4,0x1E,0x49,0x17,0xDD,0xD7,0x9D,0x28,0xCF,
+	0x45,0xA1,0x83,0xFD,0x9A,0xC4,0x91,0xB6,0x89,0x24,0xF5,
+	0xFE,0x52,0xEB,0xF0,0xDB,0x94,0x68,0x51,0x85,0xA5,0x68,
+	0x51,0x2D,0xCC,0x65,0x79,0x9B,0x9E,0xE7,0x7D,0x42,0x0C,
+	0xB0,0x17,0x71,0xCE,0x8E,0x7F,0xAA,0xEB,0xF4,0x39,0x85,
+	0xB9,0xD0,0xA0,0x5A,0x77,0x73,0xD1,0x4E,0x35,0x42,0xB1,
+	0xED,0x57,0x64,0x99,0xDF,0x7E,0x96,0x0F,0x92,0x4B,0x13,
+	0xCA,0x56,0x76,0x6D,0x93,0x37,0x6D,0x3C,0xFF,0x4C,0x12,
+	0xFC,0x9C,0xAB,0xAF,0x7F,0x0B,0x9D,0xD4,0xB6,0x24,0x4D,
+	0xB4,0x4B,0x2C,0x73,0xF3,0x14,0x1D,0xE6,0x12,0xE8,0xA2,
+	0xD6,0x30,0x57,0x25,0x8F,0x41,0x9A,0x0E,0x3B,0xD2,0xCC,
+	0xD6,0xDC,0x8C,0xDA,0x2C,0x61,0x67,0x87,0x4C,0x3F,0x4F,
+	0x8F,0x99,0xFE,0x83,0xC6,0x32,0xAE,0x4A,0xEC,0x84,0x4B,
+	0xC0,0xFF,0x75,0xE9,0xB0,0x35,0x71,0x76,0xF7,0xFA,0x02,
+	0x1D,0xC6,0x14,0x89,0x76,0xB4,0x99,0x07,0xD8,0x68,0xE3,
+	0xEC,0x54,0x9D,0xDC,0xF8,0xF6,0xA4,0x00,0xCA,0xEF,0xD3,
+	0xC6,0xBF,0x8C,0x9C,0x44,0x86,0x4C,0x83,0x06,0x82,0x44,
+	0x09,0xA2,0x66,0x56,0x60,0x87,0x6D,0xF5,0xDB,0xF3,0xBA,
+	0xC4,0xB3,0xBF,0xAB,0x25,0x10,0xBF,0x47,0xAA,0x25,0xF4,
+	0x8F,0x2D,0xF2,0x88,0x07,0x8B,0x2F,0x5A,0xEF,0x44,0xBA,
+	0xAA,0x5A,0x3C,0xE8,0x71,0x12,0xAE,0x74,0xF4,0x6A,0x27,
+	0xE4,0x65,0x91,0x22,0x0C,0xC5,0xE0,0x58,0x33,0xDE,0x7F,
+	0x5C,0x50,0xC3,0x7C,0x37,0x69,0x85,0xA8,0x06,0x2A,0x12,
+	0xE3,0x12,0x76,0x8F,0xDA,0x47,0x24,0x3F,0xC3,0x62,0x16,
+	0xAA,0xDC,0x24,0x10,0x3E,0x8D,0x20,0xA2,0x96,0x44,0xDC,
+	0x41,0xEC,0xF0,0xAB,0x5C,0x04,0x82,0x71,0x61,0xF6,0x88,
+	0xD3,0x2E,0x12,0x36,0xF4,0x62,0x89,0x35,0xBA,0x84,0xB5,
+	0x60,0xAD,0xA4,0x03,0x54,0x0E,0xB2,0xC2,0x24,0xB0,0xB6,
+	0x57,0x24,0x60,0x52,0x66,0x33,0x79,0x39,0xE9,0x5C,0x08,
+	0xA6,0x81,0x38,0x28,0x9E,0x76,0x3F,0xE4,0x90,0x5B,0x3F,
+	0xB8,0xFF,0x20,0x17,0x63,0x3B,0xD8,0x86,0x83,0x5B,0x20,
+	0xEE,0x5C,0x54,0xB3,0x8C,0xB4,0x48,0x81,0x56,0x2C,0x6F,
+	0xF3,0x20,0xFF,0xFA,0x8E,0xB4,0xD7,0x40,0x23,0xEC,0xDA,
+	0x94,0x45,0x1E,0x9C,0x94,0xD6,0xA3,0xB2,0xEE,0xB8,0x17,
+	0xB4,0x6D,0x83,0xD4,0x2A,0x14,0x55,0xAD,0x72,0xA5,0x6A,
+	0x5B,0x02,0xF1,0x75,0xB7,0x8A,0xB7,0x46,0xAA,0x82,0x52,
+	0x7F,0x13,0xAB,0xE0,0x29,0x18,0xB3,0x2A,0x02,0xD5,0x80,
+	0x6B,0x87,0x94,0x7B,0x6E,0x66,0xC6,0x15,0x7B,0x34,0x65,
+	0xF3,0xDE,0xE7,0x0D,0x17,0x3C,0xEE,0xE0,0x2B,0x0A,0x6B,
+	0xEC,0x15,0x27,0x7F,0x2E,0x00,0xD3,0x2D,0xB4,0x75,0x31,
+	0x95,0xD3,0x50,0x12,0x74,0x33,0xB3,0xB2,0xD0,0xB3,0xA8,
+	0x4D,0xB4,0xCD,0xEC,0x96,0x67,0x49,0x04,0x2B,0xCC,0xCA,
+	0x2E,0x61,0xD0,0xCD,0xAD,0xF3,0xF6,0x86,0xF8,0xD9,0xC4,
+	0x87,0x7C,0x10,0x17,0x68,0xC3,0xC8,0xB3,0xDA,0x80,0x27,
+	0x2C,0xBE,0x97,0xC8,0xFD,0x9E,0x33,0x21,0x21,0xA0,0x67,
+	0x33,0x23,0x4A,0x98,0xAC,0x96,0x80,0x75,0x19,0xF0,0xD2,
+	0x2D,0xC4,0xA2,0x9B,0xF2,0xF1,0x89,0x1B,0xD0,0x53,0xE4,
+	0x39,0x61,0x29,0xE7,0x5D,0x08,0xE2,0xED,0xC9,0xC7,0x69,
+	0x62,0xDA,0x11,0x58,0x72,0x19,0xCC,0xBA,0x6F,0x03,0xF7,
+	0x25,0x1A,0x93,0x94,0x56,0xFF,0x64,0x1B,0xB6,0x4D,0xA3,
+	0xAF,0xEF,0xBF,0x4A,0xB1,0xA2,0x15,0xEF,0x37,0x81,0xB6,
+	0x2B,0x11,0xA9,0x87,0x83,0xE0,0xE3,0xE1,0xC1,0xD4,0xF0,
+	0xC7,0x02,0xC5,0x45,0x11,0x9E,0xCA,0x97,0xDE,0xC0,0x51,
+	0x55,0x86,0xAA,0xBC,0x00,0xED,0x43,0xD9,0xBF,0x9A,0x6C,
+	0x85,0x43,0x50,0x04,0x4D,0x0B,0x0E,0x94,0xA5,0xB7,0x4F,
+	0xF9,0x99,0x79,0x8A,0xED,0xE2,0x9E,0x7D,0xB8,0xB6,0x61,
+	0xF6,0x1C,0x1C,0xC4,0xD0,0x91,0xE5,0x4F,0xB4,0x27,0xB5,
+	0xF2,0x5D,0xB3,0xA2,0xF5,0xC6,0x0F,0xA5,0xE9,0x72,0x59,
+	0x6B,0x6A,0x0A,0x3F,0x26,0x9C,0xD2,0x3C,0x7E,0xB8,0xB9,
+	0x97,0x1D,0xCA,0x05,0xBE,0x13,0x25,0xC9,0x96,0x21,0xDF,
+	0x7A,0xA3,0x0A,0xC8,0x56,0x17,0x86,0x45,0xF6,0x05,0xA4,
+	0xEF,0xFA,0x40,0x5A,0x6E,0x59,0xBE,0x43,0xD9,0x8A,0x11,
+	0xB8,0x54,0x5B,0xA3,0x0F,0xF4,0x25,0xCC,0x85,0x2C,0xEB,
+	0x7C,0xB4,0xDF,0xFB,0x6B,0x63,0x7F,0x88,0x56,0x52,0xC5,
+	0x8F,0x86,0xE9,0x13,0x16,0xD4,0x48,0x51,0x93,0xDF,0x76,
+	0xAF,0x7D,0xED,0xD6,0x74,0x70,0x96,0x9E,0x72,0xFF,0x33,
+	0x3E,0x51,0x64,0x86,0x31,0xBE,0x68,0x39,0x92,0x6A,0xF9,
+	0xEE,0xBC,0x4E,0xF1,0xBB,0x8E,0x76,0x2B,0xB4,0xC8,0x89,
+	0xBA,0x5A,0x35,0xA7,0x8F,0x30,0x07,0x81,0xBB,0x3C,0x9A,
+	0xF8,0xEC,0xF0,0x1D,0xAA,0xC7,0xBF,0xA3,0x95,0x77,0xCA,
+	0xA9,0x18,0x49,0x85,0x78,0x7D,0x61,0xC8,0x62,0x3E,0x75,
+	0x5E,0x23,0x9F,0xAA,0x90,0x96,0xF4,0x8E,0xC9,0x3D,0xF1,
+	0x85,0x70,0xAD,0x48,0x56,0xE4,0x8E,0x3E,0x64,0xCE,0xAC,
+	0x02,0xDD,0x1D,0x19,0x6B,0x4D,0xC5,0x4F,0x3D,0x4B,0xF3,
+	0x81,0x45,0xA1,0xB3,0x1F,0xE7,0x14,0xAD,0x7F,0xA2,0xAC,
+	0x40,0x86,0xCB,0x24,0x91,0x6A,0x15,0x87,0xCC,0x06,0x82,
+	0xC4,0xDA,0x9D,0xF4,0x45,0xF3,0xED,0x29,0xA8,0x35,0xC7,
+	0xD3,0x59,0xFA,0x3D,0xFB,0xD3,0x4E,0x2F,0xB9,0x4B,0xE6,
+	0x42,0x3D,0x1C,0x2A,0x7A,0xD1,0xCB,0xB1,0xED,0xFF,0x4B,
+	0x1D,0x43,0x0C,0xC9,0x2F,0x3A,0xFC,0xD7,0x0C,0xC9,0xE7,
+	0x34,0xEA,0xF2,0xB5,0x4B,0x0F,0x18,0xE5,0xEF,0x89,0xC9,
+	0x6D,0xFE,0x36,0xEC,0x76,0x65,0xA2,0xD4,0x69,0xE1,0xB4,
+	0x9E,0x7C,0x61,0xE9,0x34,0x94,0xB2,0x4C,0x0E,0x59,0x82,
+	0x34,0xA5,0x46,0x95,0xF9,0xD4,0x72,0xFB,0x90,0xED,0x5D,
+	0xB4,0xC2,0x27,0x9A,0xED,0x52,0x19,0x58,0x66,0x6F,0xC7,
+	0xB9,0xFB,0x5A,0x7A,0x9C,0xDD,0x26,0xEC,0x38,0x90,0xC9,
+	0xEB,0x15,0x66,0x6D,0xB7,0x4C,0x1E,0xD2,0xAE,0xCF,0xF5,
+	0x98,0xC0,0x97,0xED,0xEF,0x3C,0xC8,0x37,0x5B,0xE2,0x17,
+	0x79,0x3B,0xFA,0x15,0x4B,0xC6,0xFA,0x49,0x52,0x57,0x2F,
+	0x1E,0x78,0xEA,0x9A,0x71,0x14,0x4E,0x06,0x19,0x94,0x43,
+	0x57,0xA5,0x54,0xC3,0xD5,0xCD,0xAF,0x4A,0x1D,0x6D,0xA8,
+	0xB7,0xB6,0x7B,0xAF,0x07,0x1F,0x08,0x20,0xB7,0x4A,0x19,
+	0x09,0xD2,0xA5,0x68,0x7F,0x65,0x10,0x8E,0xD8,0x20,0x61,
+	0xF5,0xE7,0x63,0xFA,0xDF,0x75,0x76,0x9E,0xA6,0xC6,0x84,
+	0x01,0xFF,0xB3,0xA1,0xAC,0xB4,0xA2,0xE3,0xAB,0x49,0xFC,
+	0x3B,0xA2,0xA7,0x8F,0x28,0xEC,0x64,0x80,0x70,0x7C,0xC3,
+	0xD3,0x14,0x29,0xAF,0xDB,0x06,0x29,0x52,0x30,0x1B,0xE2,
+	0x7E,0xDD,0xC5,0x80,0xAA,0x51,0xD9,0x8D,0xA4,0x68,0x74,
+	0x50,0xA3,0xC1,0x7B,0x29,0xDA,0xA6,0x86,0x0D,0xDD,0x0E,
+	0x43,0xF8,0x2B,0x85,0x8D,0xA1,0x45,0x9D,0xA1,0x17,0xE3,
+	0xA8,0x24,0x69,0x72,0x9C,0xD5,0x72,0xA5,0x8D,0x59,0x69,
+	0x10,0x21,0xE7,0xAE,0x94,0x05,0xD1,0xBC,0xD2,0x39,0x76,
+	0xDA,0x46,0x88,0xE0,0x76,0xC3,0xF2,0xD1,0x13,0xA9,0xB3,
+	0x45,0x73,0x06,0x73,0x2A,0x47,0x4A,0x5C,0x84,0x4A,0x0F,
+	0x8F,0x3C,0x92,0x4A,0x3B,0xDD,0x1F,0x8A,0x49,0x52,0xD0,
+	0x92,0x4E,0xD3,0xF3,0x13,0x86,0xF4,0x36,0x14,0x79,0x63,
+	0xFB,0x83,0x6E,0x6B,0xC1,0xEA,0x5D,0x3B,0xB5,0x36,0x44,
+	0x65,0x02,0x46,0x0F,0xF5,0x0A,0xDB,0x56,0x9E,0xB0,0xC3,
+	0x63,0x6F,0xBF,0x2C,0x96,0x16,0x70,0xB4,0x55,0xDC,0xD0,
+	0xD1,0xF6,0x83,0xD0,0x48,0x15,0x84,0x0B,0x7F,0xB5,0x71,
+	0x72,0xBD,0x16,0xB4,0xCA,0x43,0xF3,0x5D,0xBA,0x78,0xF9,
+	0xB3,0x49,0xB4,0x7C,0x51,0xF9,0xA2,0x4F,0x5B,0xB6,0x1F,
+	0x20,0xC5,0x02,0xD4,0x8B,0xD2,0xF2,0xD7,0xC5,0x67,0xB7,
+	0xB5,0xEC,0x4A,0x88,0x6F,0x3B,0xD2,0xA4,0x45,0xED,0x21,
+	0xBD,0xEE,0xCE,0x59,0xE3,0x1D,0xD5,0xD2,0xF9,0x57,0xA7,
+	0xAA,0xA5,0xD7,0x6E,0xD3,0x80,0xC9,0x97,0xC2,0xC8,0xA2,
+	0x47,0xD2,0x72,0x1D,0x45,0xD2,0x45,0x59,0x2F,0xDC,0x95,
+	0x87,0xE1,0xCA,0xF2,0xF1,0x0D,0x64,0x3E,0x3B,0x02,0x59,
+	0x19,0xC8,0x83,0x40,0x38,0xAD,0x00,0xCA,0x5C,0x2B,0x03,
+	0x25,0xDD,0xCE,0xA9,0x09,0x27,0xFE,0x81,0x74,0xE0,0xAA,
+	0x42,0xED,0x00,0x46,0x37,0xCD,0xD1,0xCF,0x8E,0x72,0xDC,
+	0x43,0xE4,0x43,0x73,0xD5,0x1C,0x4D,0xAD,0xF2,0xB9,0x58,
+	0x55,0xB8,0xDD,0x34,0x02,0x01,0xD1,0xFB,0x93,0x38,0xD1,
+	0x2B,0x94,0xF9,0x6F,0x40,0x2C,0xBB,0x5D,0xA0,0xE9,0x76,
+	0xCC,0xA7,0x03,0x42,0xEF,0x81,0x80,0xEB,0x27,0x6B,0xBE,
+	0x03,0xA1,0x70,0x21,0xA3,0x00,0x8B,0x1A,0xAD,0x90,0x2D,
+	0x23,0x30,0xDA,0x8E,0xA9,0x32,0xE4,0x7D,0x9C,0xB1,0x71,
+	0xA0,0xAC,0x5C,0x52,0x34,0xA3,0xEE,0xDB,0x3F,0x9F,0x69,
+	0x3C,0xEA,0x02,0x8D,0x21,0x51,0xE1,0x78,0x6D,0x02,0x5B,
+	0x25,0xBC,0x52,0x19,0x1E,0x5B,0x82,0x44,0x6D,0x5C,0xA0,
+	0x3F,0xDA,0x41,0xDC,0x22,0x96,0xA9,0xAF,0x74,0x96,0x21,
+	0x5E,0x66,0x08,0x9B,0x79,0x52,0x75,0x04,0xC8,0xFD,0x93,
+	0x94,0xC5,0x08,0x93,0xBA,0x5F,0x94,0x71,0x34,0x3E,0xF4,
+	0x43,0x7D,0xA7,0xB9,0x96,0x97,0x27,0xED,0x49,0x70,0xC4,
+	0xD8,0xCB,0xC6,0x65,0xF9,0xC3,0xF3,0x23,0x94,0x58,0x71,
+	0x88,0xEA,0x42,0xC0,0x48,0xB1,0xB9,0x4D,0xBC,0x8D,0x1D,
+	0x3C,0xE0,0xBC,0xDD,0xDF,0x4B,0xBC,0x49,0xF3,0xA8,0x17,
+	0xA7,0x14,0x5E,0x9F,0x8D,0x57,0xA8,0x73,0x9E,0x12,0x4B,
+	0x2C,0x0B,0xD7,0x17,0x43,0xA9,0x57,0xBE,0x3F,0x06,0x69,
+	0x7F,0x9F,0x44,0xF9,0x9F,0xEC,0xA4,0x92,0x2A,0x93,0x7E,
+	0xE0,0x50,0x49,0x98,0xE3,0x38,0xDA,0x70,0xCC,0x49,0x85,
+	0x78,0x5A,0xEC,0x59,0x62,0xAF,0xFB,0x43,0xB9,0xB8,0x13,
+	0x76,0xF7,0xFF,0xE5,0xC0,0x97,0xCD,0x2D,0xE2,0x16,0xCA,
+	0x24,0x14,0x7E,0xFE,0x31,0x1A,0x48,0x65,0x9B,0x95,0x32,
+	0xBE,0xD6,0xD2,0x84,0x6B,0x84,0xFE,0x51,0xB0,0x7A,0x24,
+	0x6D,0x6E,0x54,0x25,0xE2,0x27,0x26,0xF2,0x4B,0xF8,0x3A,
+	0x5A,0xC4,0xEE,0xC2,0xED,0x57,0xC8,0x24,0xF3,0xA2,0xF8,
+	0xA0,0xB3,0x03,0xEC,0x2F,0x4B,0xB4,0x26,0xBB,0xCF,0x8C,
+	0x73,0xB1,0x1A,0x7C,0xBD,0x30,0x41,0xD8,0x71,0x62,0x1F,
+	0xF2,0x7B,0xD9,0x19,0x08,0x25,0xBE,0x32,0x76,0x04,0xC9,
+	0xA0,0x19,0x95,0x05,0x18,0x34,0xF1,0x41,0xE7,0xA7,0x9E,
+	0x23,0x7C,0xC2,0x2B,0x9F,0x7D,0x85,0xE5,0x71,0xA2,0x36,
+	0x84,0x9A,0x4F,0xB8,0x8A,0xC8,0x47,0xBA,0x0A,0x19,0xDE,
+	0x70,0x4F,0x61,0x4B,0x07,0x4B,0x32,0xD6,0x11,0x7F,0xF2,
+	0x1F,0xDE,0xD3,0x79,0x7E,0x7E,0xE3,0x8F,0xFF,0xBE,0xCA,
+	0xB4,0x47,0x57,0x58,0x6E,0x42,0x84,0x10,0xE4,0x63,0x21,
+	0x17,0xBC,0xFD,0x04,0x6C,0xFF,0x1A,0xB1,0x69,0x27,0x74,
+	0x65,0x32,0x59,0x0F,0x62,0x0D,0x64,0x3C,0x4C,0xE1,0x81,
+	0x76,0x2D,0x0F,0x05,0x3F,0x8F,0x34,0x25,0xCB,0xD4,0x67,
+	0xB3,0x11,0x3D,0xE5,0x1D,0x42,0x58,0xE1,0x62,0xBB,0x29,
+	0xF9,0x2B,0xA8,0xA0,0x7D,0x4F,0xFF,0x8F,0x43,0xF3,0x8E,
+	0xA7,0xFA,0x71,0xDF,0xFF,0xEB,0x75,0xF6,0x76,0x1C,0x1C,
+	0xC7,0x3E,0x8E,0x63,0x1F,0x7B,0x66,0x75,0x1C,0x7B,0x24,
+	0xC4,0xB1,0x1A,0x08,0x11,0x2D,0x8E,0xD1,0x20,0xE3,0xD8,
+	0x2A,0x23,0xA3,0xA3,0x81,0x54,0x9A,0x6F,0x23,0x32,0x1A,
+	0x48,0x76,0x42,0xC8,0x28,0x49,0x2A,0x1C,0x95,0x24,0xC9,
+	0x3A,0xBF,0xCF,0xF7,0xF7,0xC7,0xFD,0x78,0x5C,0x7F,0x3C,
+	0xFF,0xBA,0xFF,0xB9,0xAE,0xEB,0x7E,0xDC,0x88,0xF8,0x25,
+	0x4F,0x14,0xDD,0x50,0xE7,0xF5,0x55,0xB2,0x70,0x76,0x6A,
+	0x81,0x66,0xD3,0x7E,0xDE,0x80,0xF5,0x93,0x7A,0x9F,0xC6,
+	0x06,0x95,0xA4,0xD3,0x7D,0xB7,0x45,0xF3,0xD5,0x27,0x6C,
+	0x62,0x5E,0x4B,0xE3,0x18,0x89,0xB1,0xA3,0xBB,0xEC,0xC5,
+	0xEC,0x3E,0x9D,0x3D,0x2F,0x8D,0xFA,0xB1,0x10,0x95,0x2B,
+	0x7E,0x09,0x4D,0x53,0x36,0xF7,0x97,0x96,0x16,0x1D,0x16,
+	0x13,0x7E,0x4D,0x25,0xCB,0x07,0xFC,0xA7,0x83,0x30,0x61,
+	0x83,0xF1,0x2B,0x16,0xD0,0x1F,0x3C,0x00,0x4E,0x8C,0x7B,
+	0x90,0xD5,0x1D,0x31,0x6E,0x3C,0x01,0xEE,0x21,0xB0,0xB3,
+	0x5F,0x53,0x4E,0x20,0x6F,0x81,0x2D,0xD2,0x81,0x9B,0xF6,
+	0x4F,0xD1,0x1F,0x76,0xF1,0x9E,0x8D,0xA2,0xB2,0x65,0xE4,
+	0x4A,0xC2,0x18,0x65,0xFE,0x75,0xFC,0xEC,0x9F,0x5A,0xE4,
+	0xA3,0x6A,0x74,0xA7,0x42,0xF8,0x9A,0x04,0xC1,0x52,0x9A,
+	0xC8,0x2B,0x1A,0x87,0xD2,0xC4,0xFE,0xC1,0xA2,0x92,0x90,
+	0xC1,0x98,0x67,0x5E,0x87,0x93,0xF7,0xBC,0xC2,0x96,0x9E,
+	0xF6,0x9E,0xC2,0x93,0xBE,0xF1,0xB0,0x10,0xF8,0x40,0x01,
+	0xE1,0x9A,0x64,0x81,0xB4,0x68,0x08,0x67,0xC0,0xD5,0xB5,
+	0xDB,0x64,0x8E,0x9C,0x92,0x4B,0xB1,0xF9,0x4B,0x36,0xDB,
+	0xED,0xD3,0x69,0xE1,0x2C,0x9D,0x94,0xB1,0xEB,0x3A,0x77,
+	0x77,0xB7,0xB4,0x9A,0xBC,0x50,0xFD,0xB9,0x17,0x0C,0x39,
+	0x6A,0xAD,0xAC,0xD3,0x64,0x19,0xA6,0xFA,0x92,0xDF,0xE7,
+	0xC1,0x64,0x6F,0x7E,0xE6,0xCE,0x64,0xED,0x0E,0x2F,0x42,
+	0x53,0x5A,0x1D,0x42,0xD7,0x49,0x5A,0x52,0x1C,0x18,0x59,
+	0x15,0x72,0x6D,0x6C,0xEE,0x80,0x4E,0x84,0xB5,0xDE,0x7E,
+	0x31,0x32,0x29,0x60,0x5D,0x0C,0x6B,0xC1,0xF2,0x2E,0x4B,
+	0xB7,0x9A,0x7E,0x6D,0xE6,0xBD,0x7E,0x1A,0xD6,0x7D,0xBB,
+	0x25,0xB7,0x47,0xD3,0xDB,0x41,0xE8,0x1E,0x02,0xB3,0xA9,
+	0xBC,0x3B,0xE4,0x26,0xA9,0xA1,0x99,0x5D,0x0D,0xBF,0x96,
+	0xFD,0xEE,0xC9,0xB8,0xBB,0x06,0xEE,0x64,0xB1,0x54,0xF5,
+	0x70,0x4D,0xE2,0xA9,0x5A,0x8F,0x20,0xDC,0x2E,0x82,0xCE,
+	0xAF,0xF4,0x9A,0x7C,0xF3,0x0A,0xDD,0x1C,0x5B,0x59,0x1D,
+	0xFB,0x5A,0xCF,0x5B,0xB1,0x3C,0x84,0xFC,0x6B,0xA6,0xED,
+	0x93,0xD9,0x75,0xC5,0x4F,0x17,0xD3,0x6D,0x15,0x9D,0x29,
+	0xFD,0x7B,0x6D,0x9E,0x9E,0xE4,0xCB,0x64,0x9F,0xF3,0x64,
+	0x2B,0x76,0x70,0xEB,0x71,0x1E,0x4F,0xCD,0x51,0x4C,0xA6,
+	0x0C,0x74,0x32,0xEA,0x94,0xAF,0xC6,0x65,0xE5,0x0C,0x6E,
+	0x7C,0xCD,0xC2,0x53,0xFC,0x7F,0x6C,0x99,0x7D,0x5F,0xAD,
+	0x1D,0xBC,0x79,0x67,0x3B,0xB9,0x38,0x57,0x8D,0x2B,0xA2,
+	0xF0,0x96,0x17,0x9D,0x08,0xCC,0x31,0xA2,0xD0,0x6C,0xBC,
+	0x83,0xB0,0x4E,0x15,0x05,0x82,0xEB,0x8C,0x03,0x2F,0xA6,
+	0x25,0xB7,0xB3,0x91,0x32,0x22,0xAE,0x47,0xF0,0xB2,0xA2,
+	0x6F,0xDC,0xD9,0xC2,0x21,0xAD,0x93,0x6F,0x98,0x2E,0xA2,
+	0x9D,0x4B,0x88,0x2E,0x7B,0x25,0x80,0x74,0xE8,0x65,0x73,
+	0x4D,0x1A,0xD7,0xAB,0x39,0xC4,0xB1,0x01,0xC7,0x25,0xFB,
+	0x79,0xB7,0xAF,0x79,0x79,0xED,0xD2,0xB1,0xBF,0xD8,0x99,
+	0x04,0xBB,0x3E,0x88,0x11,0x36,0x40,0xEB,0x65,0x27,0xB7,
+	0x7E,0x2A,0x39,0x87,0xD8,0xDA,0x53,0xA2,0xC7,0x42,0x47,
+	0xBE,0x17,0xC8,0xF2,0x45,0xFA,0xF6,0x21,0x15,0x06,0x82,
+	0xB4,0x1F,0x54,0xFF,0xBE,0x8B,0x4B,0xF5,0x95,0x5D,0xE9,
+	0xAE,0xF5,0xBB,0x4A,0x60,0xA8,0xD2,0x8F,0x33,0x0A,0x70,
+	0xEA,0x83,0xF9,0x4A,0x5E,0xF8,0x3B,0xDC,0xC6,0xFE,0x62,
+	0xB1,0x81,0xD1,0x7B,0x79,0x43,0xED,0x7C,0xAD,0x71,0x52,
+	0x27,0x1B,0xDD,0xF5,0xE0,0xA3,0x60,0x8C,0x8F,0x69,0x33,
+	0xCA,0x93,0x60,0x95,0x2C,0x92,0xC4,0x17,0xE2,0x7B,0xA2,
+	0xF2,0x2D,0xFE,0x52,0xD9,0xC4,0xDA,0x2F,0x13,0x5A,0x8E,
+	0x59,0xFC,0xE1,0xA9,0x09,0xB8,0x3C,0x4E,0x1A,0x93,0x8E,
+	0xA3,0x96,0x79,0xF2,0xF0,0x47,0xBC,0x02,0xBE,0x53,0xBF,
+	0xFF,0xD2,0xA4,0xB9,0x0D,0xFE,0xD1,0x53,0x7B,0x60,0x89,
+	0x45,0xFD,0x53,0xA5,0x18,0x06,0x89,0xC6,0x78,0x1D,0xF2,
+	0x7B,0x02,0x75,0x61,0xF4,0x3A,0xCF,0x62,0x4A,0x62,0x50,
+	0xCE,0x92,0x67,0x45,0x85,0x58,0xAC,0xD3,0x14,0xF6,0x21,
+	0x44,0x0B,0x1F,0x95,0x90,0xBB,0xA4,0x2F,0x3B,0xDC,0x9F,
+	0x19,0x5A,0x2B,0x52,0x9C,0xD4,0x55,0x34,0x3D,0xA9,0xD2,
+	0x7F,0xCB,0xD0,0x6E,0x68,0x7D,0x15,0x94,0x93,0xC2,0x05,
+	0x60,0x5B,0xB7,0xAC,0x46,0xBE,0xF3,0x6D,0xBE,0x17,0xEA,
+	0x86,0x9C,0xBD,0x27,0x5C,0x61,0x2D,0xF7,0x74,0xEB,0x38,
+	0x2D,0x7B,0xAC,0x89,0xF6,0xDA,0x0C,0xC7,0xDB,0x79,0x17,
+	0xD0,0x68,0x23,0xB5,0x79,0xFB,0x53,0x8B,0x51,0xDF,0x17,
+	0xB9,0x3D,0xD8,0xA1,0x86,0x10,0xC9,0x90,0x31,0x3D,0xFB,
+	0x0A,0xFC,0x7B,0xF2,0x95,0xB1,0xFA,0x9B,0x52,0x4E,0x06,
+	0xDF,0xDD,0x52,0x23,0xF4,0x14,0x3E,0x8B,0x96,0xDC,0x98,
+	0x73,0x65,0x1F,0x77,0x15,0xEF,0x3A,0xB7,0x3D,0x87,0xCB,
+	0x79,0xF2,0xEA,0x41,0x7D,0x7D,0xDA,0x37,0x12,0xD3,0x13,
+	0x39,0xCE,0x8D,0x28,0x2E,0x7A,0xDB,0xB5,0x9E,0xBE,0x47,
+	0x02,0xAE,0x3B,0x03,0x26,0xA1,0xD5,0x83,0x6C,0xAA,0xB3,
+	0x99,0x49,0x88,0xAC,0xDB,0x1E,0xA8,0x0A,0xDB,0x41,0xA7,
+	0x64,0xF5,0xE5,0x2F,0x3D,0x8A,0x3E,0x93,0x9F,0xF2,0x0E,
+	0xBC,0x87,0x6E,0x7C,0xFE,0xFA,0x27,0x4C,0x5A,0xB4,0x74,
+	0x45,0xFF,0x67,0x5A,0x08,0x6A,0x4A,0x72,0x8D,0x4E,0x0E,
+	0x7B,0x0E,0xAD,0xA5,0xBC,0xF1,0xDE,0x95,0x65,0xF0,0x39,
+	0x51,0x31,0x52,0x02,0x52,0x1F,0xA5,0x95,0xC6,0x97,0xF3,
+	0xF2,0x57,0x24,0xD4,0x0A,0xAC,0xAA,0xED,0x9C,0xB7,0x4C,
+	0xBB,0xCE,0x8F,0x06,0x98,0xC5,0x62,0xC6,0x3A,0x89,0x68,
+	0x9A,0x44,0x23,0x69,0xBA,0x0F,0x75,0xC0,0xBA,0x7A,0x1B,
+	0xFE,0x70,0xCC,0xE7,0xD6,0x2E,0xB1,0x57,0xF1,0xF2,0x8C,
+	0xCF,0x41,0x65,0x6C,0x1C,0x6E,0xFE,0xEF,0xCF,0xE2,0x8F,
+	0x2D,0x41,0x24,0xC9,0x48,0xD4,0x10,0x4B,0xB3,0x82,0xAF,
+	0x9B,0xC5,0x0E,0x25,0x56,0xDD,0x09,0x3E,0x82,0x62,0xAF,
+	0x6F,0xF1,0x89,0xEA,0x31,0x0F,0xCD,0x16,0xB7,0x80,0x04,
+	0x05,0xC1,0xA9,0x2D,0x97,0x5E,0x2A,0x78,0xD1,0xCD,0xB9,
+	0x22,0x63,0xA4,0xC0,0x8F,0xB6,0x96,0x94,0x18,0x7F,0x66,
+	0x2A,0x9A,0xC0,0xD4,0x59,0xE6,0xE3,0xFC,0xF7,0xEB,0x62,
+	0xA4,0xD7,0x24,0xCE,0x46,0x98,0x85,0x93,0xFA,0xDA,0x78,
+	0xF9,0x4C,0xEF,0xF6,0xBA,0x1E,0x51,0x4A,0xAB,0x27,0xBB,
+	0xB5,0xDE,0x07,0xF1,0x36,0xE0,0xBC,0x96,0xAC,0x71,0x05,
+	0xED,0xA7,0x16,0x22,0x33,0x9D,0x50,0x1D,0x86,0xFB,0x82,
+	0xCA,0x25,0x9D,0xCD,0x7C,0x41,0x46,0x0B,0x3D,0x91,0xFC,
+	0x12,0x26,0x5B,0x3E,0xDF,0x5C,0x26,0xD4,0xE0,0x3E,0x00,
+	0x7F,0x11,0xE4,0x58,0x95,0x03,0xEB,0x8C,0x02,0xEB,0x4C,
+	0x7A,0xB3,0xD3,0x11,0x37,0x02,0x70,0x7D,0xE4,0x2E,0xFA,
+	0x38,0x49,0x42,0x9A,0xB0,0xC4,0x33,0x8C,0x20,0x75,0xDB,
+	0x2B,0xAB,0x61,0x83,0x4B,0x34,0x17,0x1E,0xDF,0xA4,0xC9,
+	0xAF,0xB6,0xE0,0x5B,0x30,0x42,0x1D,0xB0,0x76,0xED,0x8C,
+	0x9C,0x26,0xFC,0x14,0x26,0xB1,0x1D,0xCB,0x61,0xFF,0x85,
+	0x57,0x57,0x98,0xF4,0xA3,0x24,0xA5,0xFE,0x61,0x0C,0x25,
+	0x75,0x37,0x5E,0x6F,0x62,0xA8,0x13,0x5B,0x98,0x1A,0xC9,
+	0xB2,0xED,0x26,0x06,0x65,0x21,0xF4,0x3F,0x53,0xDB,0x05,
+	0x5D,0x49,0xEF,0x07,0x08,0x13,0x1A,0x4C,0x78,0x7E,0xBA,
+	0x4E,0xCE,0xC6,0xBB,0x81,0x61,0x8E,0x98,0x9E,0x40,0x89,
+	0xC3,0xEC,0x4F,0x1A,0x37,0x5B,0x3E,0xFC,0xAF,0xD6,0xDD,
+	0x49,0x8A,0xCD,0xD4,0xF1,0x19,0xD1,0x27,0x1F,0x2C,0x7D,
+	0x69,0x7F,0xBF,0xFA,0x77,0x85,0x6C,0x81,0xEB,0x5D,0xC4,
+	0xA5,0xDA,0x43,0x48,0xD2,0x6B,0xB3,0x3F,0x32,0xEC,0xE0,
+	0xA4,0x25,0x13,0x5A,0xA1,0x89,0x57,0x66,0x32,0x41,0x7C,
+	0x82,0x6C,0xAD,0x2E,0xD9,0x52,0x39,0xDE,0xE8,0x65,0xA0,
+	0xE3,0x4D,0xC5,0x9D,0x49,0x41,0x28,0x56,0x86,0x9B,0xE8,
+	0xF6,0x0F,0x09,0x5B,0x0C,0x5E,0xA3,0x31,0x67,0x08,0x22,
+	0xA7,0x03,0x45,0xFE,0x3A,0xA3,0x6A,0x77,0x82,0xF6,0x3E,
+	0x1C,0x74,0x61,0x80,0xB1,0xD6,0x7C,0x78,0xE7,0x0C,0x6B,
+	0x64,0xCA,0x48,0x9C,0x16,0x89,0xEA,0x4A,0xEE,0xBF,0x67,
+	0xD8,0xC0,0x57,0x43,0x15,0xB9,0x42,0x1C,0xDA,0xAE,0xED,
+	0xF2,0xEF,0xAE,0x15,0xF7,0x10,0x62,0x5D,0x93,0x2F,0x7B,
+	0xE2,0x6E,0x07,0x8E,0xC5,0xF6,0xC0,0x9E,0xA0,0xB6,0x44,
+	0x97,0x1E,0xC5,0xB6,0x52,0x07,0x21,0xA5,0x59,0xA9,0x86,
+	0x62,0x98,0x8B,0xC5,0x7F,0x78,0xE7,0x62,0xD4,0xDD,0x5D,
+	0x5F,0xE9,0x86,0x4B,0xC9,0xCA,0xE7,0xD2,0x5A,0x96,0x8B,
+	0xD3,0x44,0x90,0x23,0x58,0xB2,0x98,0x7C,0x68,0xAE,0x14,
+	0x3C,0x55,0xFB,0xB5,0x28,0x81,0x8A,0xF7,0x4A,0xD7,0x4C,
+	0x59,0x13,0x60,0x22,0xC9,0x7A,0x5E,0x74,0x37,0xDF,0xE2,
+	0x5E,0x87,0x39,0xC5,0xFA,0x7C,0xD9,0x97,0x8A,0x51,0xCF,
+	0x6E,0x68,0xDE,0xB2,0xC5,0x90,0x42,0xDA,0x4A,0x72,0x7C,
+	0x50,0xA8,0x20,0x04,0xD8,0xDA,0x4C,0x6B,0x95,0xD9,0x2B,
+	0x0A,0x47,0x10,0x0E,0x27,0xF3,0x7F,0x1B,0xB8,0x74,0xE4,
+	0xB7,0x28,0xAF,0x83,0xBE,0xF9,0x4F,0xD6,0x04,0x35,0xAD,
+	0xD1,0x92,0x41,0xDA,0x03,0xB7,0x75,0x93,0x5B,0x65,0x3C,
+	0x13,0x3A,0x3B,0xBD,0x64,0xBB,0xAB,0xBA,0xD7,0x62,0x31,
+	0xB8,0x44,0xDD,0x8B,0x61,0x1B,0xE1,0xD8,0x73,0xEF,0x95,
+	0xC3,0x69,0x64,0x9F,0x8F,0x0A,0xC1,0x84,0xFB,0x9D,0xB6,
+	0x23,0x56,0x5C,0xDC,0xC1,0x4C,0xA6,0x8F,0x5A,0x4C,0xE7,
+	0xBD,0x79,0x20,0x4B,0xBD,0xF3,0xC1,0x8E,0x0E,0x62,0xA7,
+	0xC0,0xB9,0x52,0x67,0xB4,0x12,0xA9,0xA2,0x92,0xF6,0xF1,
+	0x1E,0x0C,0xF6,0x55,0xFB,0xBB,0x38,0x2E,0x40,0x24,0xEA,
+	0x61,0x20,0x76,0x18,0x3D,0x94,0x6F,0x51,0x85,0x43,0x1B,
+	0x88,0xDE,0x10,0xC9,0x24,0xC8,0xEE,0x84,0x65,0xCA,0x52,
+	0xC3,0x04,0x86,0x6B,0x50,0x6C,0xB5,0xAD,0x91,0xC8,0xB5,
+	0x5C,0xDB,0x93,0xBE,0x08,0xFD,0x91,0x8D,0xC8,0x32,0xE6,
+	0xF6,0xAA,0x3D,0xC0,0xB6,0xC7,0xC3,0x15,0x05,0xB7,0x55,
+	0x67,0x84,0xCE,0x4D,0xE0,0x9F,0x55,0xD9,0xD7,0xEC,0xAD,
+	0xDE,0x31,0xB8,0x52,0x83,0x6A,0x2F,0x9E,0xDC,0x31,0x68,
+	0x55,0xF2,0x66,0xC6,0xB8,0xAB,0xB3,0x5F,0xFE,0xD7,0xC6,
+	0x4B,0x8E,0xEB,0x63,0x7A,0x32,0x2D,0x97,0x66,0x8D,0x46,
+	0x11,0x43,0x8F,0xAB,0xD1,0xB1,0x4D,0xBB,0x55,0x18,0xB5,
+	0x79,0x6E,0xA5,0xB4,0xE2,0x1A,0x73,0x6F,0x96,0xFE,0xBD,
+	0x83,0x09,0x81,0x1C,0x32,0xB8,0x06,0x9E,0x54,0xB1,0x7F,
+	0x34,0x62,0x5B,0xDB,0x0F,0x81,0x52,0xA1,0x28,0x7B,0x88,
+	0x46,0x65,0x67,0x9C,0x60,0x6C,0x3F,0xA2,0xAC,0xD0,0x34,
+	0xCD,0x54,0xE9,0x67,0x26,0xD6,0xCA,0xDA,0x29,0xB3,0xB1,
+	0x1A,0x30,0x81,0xB7,0x5D,0x4C,0x05,0xEC,0xD2,0xD1,0x0B,
+	0x0F,0xCB,0xC5,0xFB,0xB2,0xC9,0xEA,0x7E,0x16,0x52,0x52,
+	0xEB,0xA6,0x27,0xAC,0x62,0xDD,0x23,0xB7,0xE1,0xA6,0x6C,
+	0x52,0x94,0x13,0x97,0x32,0xA5,0x2A,0x2C,0x11,0x2E,0x65,
+	0xAD,0x21,0x4B,0xAD,0x56,0x0E,0xCC,0x9E,0x93,0x62,0x57,
+	0x2C,0x81,0xB6,0x32,0xA9,0xB3,0x81,0xC5,0x93,0x08,0x5B,
+	0xD1,0xB8,0x7C,0xD5,0xBD,0x11,0x92,0x33,0x38,0xC8,0xD9,
+	0x94,0x85,0xD2,0xE1,0x5B,0xA5,0x3B,0x76,0xA6,0xD8,0x6B,
+	0xB3,0x0E,0x6F,0x03,0xB5,0xCD,0x67,0xAA,0x9D,0x1B,0xA1,
+	0xC7,0x9D,0xC7,0x06,0x64,0x09,0x4C,0x89,0x27,0x1A,0xF4,
+	0xAB,0x13,0xB5,0xB2,0x91,0x25,0x40,0xCF,0xE3,0xC8,0xD3,
+	0x40,0x4F,0x43,0xA4,0x2F,0xD0,0xD3,0x18,0x69,0x0A,0xF4,
+	0x34,0x47,0x4A,0x3B,0xFD,0x33,0x9C,0x86,0x7D,0x50,0xA7,
+	0x13,0xA9,0x91,0x04,0xA0,0x07,0x21,0xB5,0x08,0xAC,0x7D,
+	0xDA,0xA6,0x0B,0xFF,0x8F,0x7C,0x2A,0xFA,0x3F,0xB2,0x58,
+	0xF4,0x7F,0x64,0xA4,0xE8,0xFF,0xC8,0x3D,0xF6,0x8A,0xEF,
+	0x6C,0xEC,0x05,0x93,0x06,0xD0,0xFA,0x28,0xB7,0x40,0xC7,
+	0x9B,0xED,0xFA,0xB0,0xC9,0x12,0x41,0x6C,0x55,0xF4,0x35,
+	0xD7,0x7C,0xB9,0xBF,0xA2,0xF0,0x56,0x84,0xED,0x17,0x59,
+	0x3F,0xE8,0x75,0x73,0x92,0xB9,0x7A,0xEE,0x5E,0xC6,0x1E,
+	0xFC,0x4F,0x13,0x7A,0xD0,0x1E,0x14,0xAA,0x66,0x85,0xA9,
+	0x7E,0x96,0xAD,0x72,0x40,0x0F,0x1F,0x70,0x87,0xDC,0xE6,
+	0x93,0x0F,0x8C,0xB4,0xD6,0xC8,0xB3,0xC7,0xFD,0x9D,0xD7,
+	0x9C,0xDB,0xB2,0xF7,0x8F,0x2A,0x0D,0x4F,0x3C,0x5F,0x03,
+	0xE6,0xD6,0x6A,0x88,0x6B,0xAF,0x5D,0x43,0x24,0xB3,0x81,
+	0xB0,0x89,0xC3,0x79,0x88,0x8D,0x11,0x2F,0x79,0xA5,0x56,
+	0x14,0x6B,0xD2,0xE4,0x31,0x70,0x7F,0x5C,0x91,0x24,0x8E,
+	0x3D,0x6B,0x02,0xCB,0xF6,0x8D,0x3D,0x4F,0x47,0x3D,0xF7,
+	0x81,0x56,0x7C,0x0F,0x3B,0x27,0x76,0x4D,0x12,0xE1,0xD9,
+	0xB2,0x72,0x1E,0x8D,0x42,0xC6,0xEB,0xBB,0x1D,0xF3,0x38,
+	0xAE,0xD7,0x71,0x65,0x9C,0x07,0xB6,0xC8,0xF2,0x0D,0xBD,
+	0x2E,0x4E,0xEE,0x2A,0xEE,0x1E,0x4C,0xB3,0xCB,0xD6,0x93,
+	0xE9,0x4A,0x38,0x3E,0xCC,0x10,0x64,0x5C,0xB5,0x05,0x71,
+	0xDC,0x99,0x74,0x04,0x8F,0x4D,0xBA,0xDF,0xC0,0x39,0x0C,
+	0x53,0x9B,0xE0,0xA0,0x1A,0x25,0x48,0xE2,0x87,0xAD,0xA8,
+	0xC2,0xDC,0x3C,0x54,0xEF,0xC7,0x87,0x8A,0x5A,0x50,0x76,
+	0xB0,0x2B,0xED,0x72,0x90,0xD8,0x8B,0x85,0x16,0x3D,0x98,
+	0xE6,0xAE,0x44,0xA3,0xFF,0x82,0xBE,0xFC,0xE5,0xC7,0x73,
+	0x51,0x0A,0x35,0x6F,0xA9,0x5B,0x11,0xF6,0xAE,0x3E,0x78,
+	0xD7,0xF4,0x11,0x4E,0xA2,0xEA,0xFD,0x67,0x14,0x23,0xDF,
+	0x4A,0x49,0xAB,0x95,0xCF,0x22,0xDB,0x3E,0x29,0x23,0xCA,
+	0x5D,0xF0,0x63,0x30,0x0D,0x3C,0x8F,0xBF,0xA4,0xC2,0xA7,
+	0xAB,0x0D,0x13,0x7F,0x44,0xA3,0x11,0x19,0x78,0x84,0x6D,
+	0xB5,0xB0,0xDE,0x8A,0xCE,0x4E,0x22,0x74,0xDE,0x80,0xD5,
+	0x7D,0x34,0xED,0xF6,0x36,0x14,0x82,0x82,0xD5,0x41,0x97,
+	0xC0,0x17,0xFE,0x26,0x38,0x8A,0x0D,0xE6,0xC8,0xFD,0x8B,
+	0x0D,0xB6,0x84,0x17,0x53,0x9D,0x70,0x22,0xA3,0xBB,0x96,
+	0xD4,0xD7,0x2B,0xCA,0xE8,0x3F,0xF6,0xEF,0x0D,0x71,0x08,
+	0xBE,0xA0,0xC5,0xCB,0x71,0xE1,0x1F,0x47,0x7E,0xDA,0x17,
+	0xF6,0x39,0xEA,0xCB,0x3D,0xA7,0x6F,0x1F,0xFA,0x52,0xA0,
+	0x1F,0x23,0xE4,0xFE,0xAC,0xFD,0x65,0xF4,0x0E,0x4D,0x18,
+	0x91,0x8F,0xBD,0x85,0x17,0x51,0x46,0xA7,0x55,0xBE,0x7F,
+	0x81,0xF8,0xFC,0x8C,0xFA,0xA5,0xE7,0xF7,0x5B,0x4C,0x92,
+	0x31,0x01,0x50,0x22,0x53,0x75,0x8A,0xFE,0x6D,0xF6,0xD7,
+	0x80,0x49,0x85,0xD9,0xB8,0xE4,0x3A,0x26,0xF7,0xC1,0xCB,
+	0x72,0xEE,0x7D,0xAE,0x92,0x13,0x91,0x6D,0x80,0x3E,0xF5,
+	0xCC,0x99,0xBB,0x8C,0xE5,0x1F,0x41,0xFA,0x57,0xBA,0xF7,
+	0xA5,0x7D,0xAD,0xEE,0x70,0xAD,0xD5,0x3B,0xEF,0x9A,0x8C,
+	0x68,0x8D,0x6F,0x22,0x4A,0x90,0x24,0x30,0x12,0xB8,0x5D,
+	0x38,0x13,0x42,0x53,0x6B,0xED,0x59,0x36,0xEC,0x38,0xA2,
+	0xDA,0xE0,0xDC,0x65,0xAA,0x54,0xF5,0x46,0x79,0x2E,0x2A,
+	0xB3,0x8E,0x7D,0x3E,0x11,0x85,0x6D,0x32,0x25,0x24,0x56,
+	0xE2,0x0C,0x8B,0x51,0x99,0x18,0xB8,0xF4,0x7E,0x9D,0x95,
+	0xD9,0x8E,0x43,0x44,0x46,0x41,0x87,0x5F,0x7B,0xD6,0x2F,
+	0x3B,0x54,0x8D,0x90,0x5B,0x4D,0xC1,0xFA,0xE0,0x47,0x9D,
+	0x1B,0x0B,0xC4,0x7D,0x88,0x6A,0x57,0xAA,0xDB,0x54,0x2F,
+	0xD2,0xCF,0xB6,0x81,0xE4,0x6E,0xBC,0x4F,0xD0,0x71,0x48,
+	0x21,0xFC,0x1B,0x79,0x67,0x57,0xAC,0xE8,0xF9,0x3B,0x10,
+	0x7A,0x52,0x1E,0x7E,0x9A,0x48,0x7C,0x78,0xBD,0x35,0x79,
+	0x45,0xE1,0x71,0x05,0x62,0x17,0x0F,0xE7,0xDD,0x6F,0x4C,
+	0x34,0xD9,0x09,0x3B,0x80,0x8E,0x78,0x47,0x92,0xC8,0xD6,
+	0x94,0xB0,0x0F,0x15,0x11,0x83,0x41,0x31,0x6D,0xF7,0x61,
+	0x69,0xCF,0x16,0x3A,0xA4,0x55,0x03,0xCD,0x80,0x98,0x6B,
+	0xB9,0xCE,0x53,0x40,0xDA,0xB5,0x6A,0xDA,0x71,0x51,0x6E,
+	0x90,0x89,0x2C,0xCA,0x05,0x7E,0x69,0x3A,0x7E,0xC6,0xA0,
+	0x3B,0xF4,0x0A,0x9E,0x6A,0x69,0x00,0xDA,0x17,0xCC,0x23,
+	0x0E,0x6B,0x61,0x19,0xFA,0xFB,0x9D,0x5F,0x8E,0xBB,0xB6,
+	0xB5,0xBD,0x79,0xE0,0x3E,0x5F,0x82,0xB0,0x75,0x14,0x2F,
+	0x13,0xA9,0x64,0x1A,0xA4,0x13,0x80,0x0A,0xDF,0x3B,0xC3,
+	0xB3,0x98,0x73,0x75,0x84,0x7A,0xE1,0xA4,0x5D,0xDC,0x72,
+	0x44,0x17,0x4B,0xA2,0x4B,0x53,0x4A,0x8D,0xE2,0x0A,0xC4,
+	0xF8,0x5E,0x03,0x52,0xDF,0xC5,0x20,0x8A,0x00,0xE1,0x3D,
+	0xB5,0xF6,0x6A,0x45,0x77,0xFA,0x84,0x4E,0xA3,0x76,0x6C,
+	0xD6,0xD4,0xF9,0xB6,0x76,0xB0,0xB9,0x68,0x1D,0xDA,0xA2,
+	0x32,0x49,0xF9,0xBB,0xE8,0x37,0xC8,0x6E,0x59,0xE1,0x1D,
+	0x94,0x7F,0x99,0xE7,0x92,0x12,0x69,0xD7,0x91,0x9F,0xEB,
+	0x43,0xCB,0xC4,0xC6,0x55,0x30,0xE0,0xFD,0x3D,0xF8,0x62,
+	0xEB,0x49,0xB8,0xF8,0x37,0xEE,0xA3,0x87,0x82,0x8B,0x06,
+	0x58,0x41,0x82,0x0E,0xCA,0xC8,0xA6,0x29,0x9F,0xFB,0x72,
+	0xBF,0xD4,0xD3,0x85,0x47,0x30,0xAF,0xC6,0x44,0x2E,0x59,
+	0x58,0xFF,0xAB,0x94,0xAF,0x6E,0xBB,0xAD,0xA6,0x9C,0x87,
+	0xCD,0x36,0x66,0x21,0x1C,0x76,0x59,0xE6,0x89,0x8D,0xD0,
+	0xDF,0xD9,0x71,0xA9,0xD6,0xC6,0xFF,0x60,0x66,0xFB,0x7E,
+	0x78,0x3C,0x4D,0x6B,0xA9,0x43,0xFD,0x9F,0xBA,0x9A,0x39,
+	0x48,0x4C,0x44,0xE8,0x08,0x47,0x3C,0x33,0x67,0x9D,0xAE,
+	0xBE,0x90,0x2D,0x77,0xD9,0x3C,0xF4,0xF5,0x77,0xA3,0xB7,
+	0xD0,0xD4,0x2E,0xA7,0x9B,0x12,0x4B,0xCB,0x05,0x28,0x8F,
+	0x95,0x5F,0x4B,0xB1,0x3A,0x15,0xDC,0x39,0x33,0xC6,0xD6,
+	0xD5,0x8D,0x3D,0x2A,0x94,0x00,0xD1,0x4D,0xC7,0x2D,0xFE,
+	0x02,0xE9,0x16,0xD8,0x0C,0x47,0x08,0xD2,0xB5,0x1B,0xD0,
+	0x33,0x49,0x69,0x86,0x89,0x42,0xE5,0x1E,0x9A,0xCB,0x63,
+	0x64,0xA9,0xFF,0x64,0x8F,0xAB,0x44,0xCB,0xC9,0x6F,0xCF,
+	0x2C,0xBB,0x60,0x44,0xFF,0x16,0x42,0x99,0x44,0xBF,0xFB,
+	0xE1,0xC9,0x9B,0xDF,0x28,0x6A,0x17,0xA6,0xB9,0xB6,0xC3,
+	0x6A,0xAE,0x9A,0xBF,0xBC,0xD8,0x20,0x9B,0xB0,0x05,0x4E,
+	0xC5,0x2D,0xF4,0x40,0xEC,0x6D,0x15,0x6B,0x1F,0xAD,0xB6,
+	0xAF,0x3A,0x8E,0x84,0xF9,0x8D,0x73,0x5A,0xAC,0x07,0xF1,
+	0xD1,0xBF,0x2C,0x32,0x13,0xD6,0xA1,0x17,0x70,0x57,0x68,
+	0xE3,0xCE,0x26,0x7C,0x05,0x30,0xC8,0x74,0xE7,0xB7,0x7C,
+	0xC4,0x4A,0xB4,0x80,0x3F,0x95,0x19,0xB3,0x6E,0xED,0x62,
+	0xD5,0x10,0xB0,0x8A,0x2A,0xD2,0x81,0xEF,0x1F,0x03,0xD7,
+	0xD3,0x51,0x89,0x09,0x47,0x17,0x06,0x41,0xE2,0xDB,0xBB,
+	0xAC,0xFB,0xF6,0xF6,0x21,0x2B,0xB0,0x0D,0x53,0xFE,0x51,
+	0x77,0xCC,0x63,0xEB,0x1A,0xD4,0xFD,0xD4,0xFD,0x7E,0xEF,
+	0xDD,0x6F,0x88,0x9D,0xFD,0x08,0xE8,0x01,0xF9,0xCE,0x5A,
+	0xE5,0x0F,0xC7,0x4C,0x44,0x75,0xD5,0x4F,0x88,0x61,0xCA,
+	0x5E,0x92,0x3F,0x75,0xD9,0x19,0x99,0xD8,0x1A,0x93,0x5F,
+	0x4B,0x17,0x3A,0x3D,0xA5,0xD0,0xBF,0x47,0xB8,0xA2,0x31,
+	0x93,0x59,0xC2,0xCC,0x44,0xF4,0x03,0x07,0x7D,0xD2,0xBF,
+	0x2A,0x7C,0xB8,0xCD,0x51,0x37,0xD4,0x52,0x96,0x39,0x9C,
+	0xC9,0x69,0x26,0x05,0xB4,0xEF,0x6A,0xF8,0x57,0x58,0x97,
+	0xB0,0x92,0x7C,0xC0,0x27,0x61,0xCB,0x62,0xCA,0x61,0xD3,
+	0x1E,0xB1,0xFE,0xA0,0x7A,0x4B,0x0C,0x65,0x8E,0xF0,0xDB,
+	0x5F,0xB2,0x8D,0x18,0x40,0x18,0x22,0xD1,0xD5,0xB9,0x42,
+	0x62,0xCB,0x31,0x4E,0x62,0x5B,0xB7,0x5C,0x3F,0xC1,0x8E,
+	0x91,0x5B,0x5F,0x43,0xC1,0x63,0xE8,0xD1,0x7E,0xA8,0xDC,
+	0x25,0x19,0x58,0x00,0xE8,0xEF,0x2F,0x10,0x2B,0xDA,0xA9,
+	0xFC,0xA8,0xCE,0x9A,0x97,0xA1,0x7A,0xEB,0xE9,0x60,0xE6,
+	0x2F,0xDA,0xFF,0x70,0x4B,0x2D,0x5A,0xEC,0x90,0x9B,0xFA,
+	0x1E,0x83,0x38,0x93,0x6D,0x8D,0x50,0xDB,0x8E,0x1F,0x47,
+	0x4A,0x3C,0x0D,0xB5,0xBF,0xD7,0x4A,0x4F,0xEB,0x46,0x51,
+	0xD4,0xBE,0x48,0x41,0xCD,0x53,0xDD,0x33,0x2C,0x75,0x3F,
+	0xB7,0xB9,0xB3,0x4F,0x9C,0x4C,0x5C,0x7F,0x93,0xCC,0x91,
+	0x07,0x3F,0x1E,0x61,0x5E,0x51,0xFA,0x7B,0x1E,0x80,0xDA,
+	0x61,0xB7,0x4B,0x4F,0x67,0x86,0x4A,0x58,0x25,0xB7,0xAA,
+	0x08,0x5C,0x8B,0x10,0x95,0x02,0x4C,0xD0,0x90,0xD0,0x87,
+	0xF8,0x7D,0x52,0xF6,0x1F,0xAD,0x2F,0x68,0x16,0xA2,0x87,
+	0xE1,0x58,0x3D,0xE1,0xB3,0x89,0x7B,0x51,0x20,0xB1,0x12,
+	0x1F,0x21,0x04,0x0F,0x32,0x3A,0x22,0x02,0xEB,0x9D,0xC5,
+	0x3A,0x99,0x59,0x3C,0x65,0x6A,0x5D,0x3A,0xD6,0x85,0x08,
+	0x45,0x28,0xEB,0x60,0x6F,0xE0,0xAE,0x80,0xF8,0xAF,0x4D,
+	0xEE,0x15,0xCB,0x2D,0x89,0x00,0x3A,0x48,0xD7,0x64,0x8B,
+	0xC0,0xD7,0xE2,0x6B,0x58,0x0A,0x38,0xBC,0xC3,0x80,0x03,
+	0x8E,0x98,0x10,0xCC,0x97,0x47,0xE5,0xFA,0xDF,0xE6,0x28,
+	0x3E,0x99,0xC9,0x00,0xA4,0x9B,0x94,0x4A,0xD9,0x21,0x93,
+	0xA7,0x35,0x71,0x40,0x86,0xDA,0xE3,0xC7,0x4E,0x8E,0x80,
+	0x94,0x10,0x47,0x52,0x6B,0x07,0x34,0x01,0xCC,0x6C,0x7C,
+	0x2E,0xBB,0x3F,0x48,0x79,0x82,0xE7,0xCE,0x5E,0xF5,0x81,
+	0xFF,0x21,0x04,0xBF,0x43,0x15,0xAA,0x6B,0x9B,0xAB,0xCC,
+	0x3F,0x84,0xD5,0xC6,0xCE,0xE7,0x60,0xC7,0x0D,0x4F,0x13,
+	0xFD,0x45,0x84,0xCE,0xE2,0x13,0xE5,0x89,0x85,0xD7,0x23,
+	0xFA,0x31,0xD6,0x8A,0xB9,0xFA,0xA8,0x42,0x9D,0x9B,0x85,
+	0x77,0xF7,0xA9,0x7F,0xD9,0xF5,0x96,0xE3,0x30,0xE0,0x80,
+	0x3B,0x3C,0x83,0x8E,0xD8,0x59,0xBF,0x46,0xE7,0x6B,0x08,
+	0x07,0xE1,0xFE,0x23,0xB8,0x9F,0xA1,0x17,0x6D,0x90,0x6C,
+	0x76,0xDC,0x89,0xE7,0x2B,0x0F,0xA2,0x2F,0xAA,0xAD,0x98,
+	0x40,0x9C,0x83,0x13,0xD5,0x06,0xD3,0xEC,0x2F,0x59,0x29,
+	0xA1,0xD2,0xA2,0x64,0xCD,0xD4,0xF5,0x4B,0xC1,0x82,0xE5,
+	0xCB,0xDB,0x22,0x79,0x27,0x49,0x7C,0x82,0x7D,0x4E,0x58,
+	0xA5,0x1F,0xD8,0x0B,0xBB,0x1A,0x43,0xBD,0xA1,0x08,0x19,
+	0x7E,0x0A,0x82,0xA4,0x18,0xD1,0x93,0x43,0x7B,0xCF,0xE2,
+	0x94,0xD3,0x94,0x27,0x94,0x2B,0xF2,0xC0,0x78,0xB9,0xBF,
+	0xD4,0x82,0x63,0x55,0x3C,0x0C,0xE9,0xF1,0xBC,0x58,0x44,
+	0xAF,0x28,0x29,0xC0,0x32,0x1A,0xC7,0x9F,0xEE,0xC3,0xFA,
+	0x34,0x1D,0x78,0x14,0xB8,0xC2,0x75,0x23,0xD3,0x8C,0x0F,
+	0xA9,0x75,0x3F,0x2A,0x52,0x45,0xEA,0xD2,0xED,0x5F,0xDF,
+	0x4E,0xF2,0xE9,0xD6,0xB4,0xCC,0xB9,0xFA,0x20,0x40,0x0E,
+	0x87,0xAA,0x6D,0xD0,0x43,0x66,0xC1,0xAF,0xDB,0xD1,0xB2,
+	0x8A,0x77,0x4F,0xD2,0x66,0x6F,0x8E,0xD3,0x0A,0xDA,0x25,
+	0xE8,0x03,0x10,0xF9,0x97,0x0C,0x7F,0x5D,0x6F,0xD3,0xD1,
+	0xCF,0x00,0x5A,0xE3,0xB9,0x0C,0x2A,0x16,0x99,0xE3,0x81,
+	0x08,0xC4,0x5C,0xAB,0x5F,0x53,0x30,0x75,0x5A,0x8A,0x16,
+	0x6B,0xFA,0xD0,0x40,0x66,0xEA,0x35,0xC5,0xBA,0x4E,0xC9,
+	0xDD,0x04,0x68,0x60,0x2E,0x42,0x42,0xF2,0xDB,0x78,0x7E,
+	0xE2,0x77,0x75,0x9B,0x5A,0x57,0xF9,0x40,0x1A,0xFA,0xC0,
+	0x83,0xA0,0x46,0x06,0xB1,0xDF,0xAC,0x59,0xB1,0xA4,0xC7,
+	0x42,0xDD,0x55,0xF5,0x89,0xE1,0xB5,0xFD,0x2A,0x54,0x87,
+	0x53,0xB2,0x72,0x67,0x91,0x62,0x78,0x0C,0xEC,0x17,0x1F,
+	0xC9,0x8F,0x92,0xF1,0x38,0x29,0xB7,0x12,0xDE,0xCA,0x3F,
+	0xF2,0xF0,0xFA,0x7D,0xCF,0x70,0x0B,0x4D,0xE8,0x77,0x32,
+	0x5F,0x53,0x2C,0xF4,0xBA,0xC5,0x3D,0x0A,0x58,0x2E,0xBA,
+	0x23,0xC2,0xA1,0xF2,0x27,0x7B,0xB0,0xD5,0xA2,0x5A,0x46,
+	0x03,0xAA,0xFB,0xF8,0xB2,0x5B,0xBB,0x08,0x97,0x69,0x53,
+	0x03,0xBD,0x4A,0xA7,0x28,0xED,0xAA,0x0E,0xBB,0x91,0x10,
+	0x14,0xA4,0x1E,0x9D,0x62,0xCB,0xFB,0xA9,0x00,0x82,0x6F,
+	0xEC,0x21,0x61,0xB7,0x20,0x31,0x14,0xB2,0x55,0x75,0x67,
+	0xAD,0x6B,0x33,0xA5,0x39,0x84,0x99,0xE5,0x3F,0xE2,0xF3,
+	0x30,0xB3,0x0A,0x5E,0x92,0x19,0x71,0x23,0x19,0x75,0xB8,
+	0xAF,0xBA,0x7A,0x4A,0xBB,0xC3,0xA5,0xA5,0x57,0xAB,0x98,
+	0x60,0xAC,0xE2,0x1C,0xA2,0x70,0x84,0x21,0xBC,0xE0,0xF0,
+	0x15,0x9B,0x47,0xCA,0x13,0xBD,0x42,0x70,0xA4,0xE5,0x7E,
+	0x9E,0x7D,0x77,0xFD,0x10,0xDA,0xE5,0x92,0xCB,0x8B,0xBD,
+	0x2B,0x80,0x42,0xB0,0x7C,0xE5,0xFB,0xEF,0x44,0x14,0xD1,
+	0xEF,0xB7,0x21,0x6F,0xCC,0x18,0x35,0xB4,0x69,0xFA,0x0D,
+	0xC1,0x5A,0xC2,0xE2,0xAA,0x11,0x08,0xE7,0xBA,0xB1,0xA3,
+	0xC2,0x3F,0xE0,0x48,0x42,0x26,0xAA,0x56,0x6D,0x30,0x18,
+	0x71,0xCF,0xD3,0x2F,0x49,0x8C,0xEA,0x53,0x23,0x5A,0x49,
+	0x6A,0xEF,0x92,0x5E,0x1F,0x44,0x39,0x4B,0x21,0x16,0x9B,
+	0x24,0x09,0x0B,0xA9,0x52,0x5E,0x2A,0xB0,0xAE,0x12,0x5C,
+	0xF2,0x57,0x97,0xDD,0x27,0xAE,0xAD,0x99,0x76,0x26,0xE0,
+	0x94,0xE5,0x4C,0xBB,0xCE,0xDD,0xEB,0x6F,0x30,0x91,0xFA,
+	0x6B,0x2B,0xA3,0xBB,0x6B,0x17,0xB1,0xA4,0x58,0xAA,0x10,
+	0x53,0x24,0x67,0xEA,0x05,0x11,0x9A,0x87,0x7E,0x1C,0x6C,
+	0xDF,0x31,0x6D,0x9F,0x4A,0x10,0x92,0x40,0x92,0xF6,0x4B,
+	0x13,0x97,0x0E,0x50,0x2D,0x2F,0xDE,0xDA,0x0D,0xFC,0xB3,
+	0x12,0x12,0xEA,0xDF,0xA1,0xC6,0xB0,0xAD,0x61,0xA6,0xE7,
+	0x21,0x36,0xFE,0x96,0xB7,0xE4,0x62,0xD6,0x60,0x48,0xB9,
+	0x06,0xD7,0x8B,0xA1,0x12,0xF6,0xFA,0xE3,0x9D,0x9F,0xF6,
+	0x42,0x24,0x50,0x6B,0x7C,0x5C,0x97,0xB4,0xC5,0xD8,0x41,
+	0xAE,0x68,0x68,0x5B,0x09,0x36,0x7F,0xBB,0x41,0x90,0xB4,
+	0xEB,0x40,0x7C,0x48,0xA9,0x4B,0x06,0xF1,0xBA,0xD9,0xBA,
+	0x6B,0x6B,0xC5,0x36,0xD3,0xD7,0x74,0xF0,0xD1,0x63,0xD9,
+	0x5A,0xC4,0xE3,0xDB,0x76,0x4C,0xA4,0xFA,0x0E,0xF5,0x14,
+	0x2E,0x37,0xAA,0xBA,0xD2,0xA7,0x3E,0x66,0x95,0xD8,0xB7,
+	0xB6,0x2A,0xF3,0x6E,0x35,0x22,0x01,0x9E,0xBE,0x46,0xF7,
+	0x77,0x16,0x73,0x8F,0x5E,0x51,0xB7,0x43,0x3C,0xBC,0xC8,
+	0x9B,0xB1,0xFB,0x6A,0xAC,0x3F,0x84,0x94,0xAA,0xA1,0x11,
+	0xF7,0x59,0x2A,0x4E,0x0D,0x46,0x6B,0xD5,0xFD,0x98,0xA1,
+	0xE9,0x8E,0xEC,0x56,0x27,0xBF,0xA7,0xFD,0x91,0x42,0x4C,
+	0xD3,0x1A,0xFF,0x9C,0x27,0x65,0x18,0x5D,0xDD,0x10,0x7A,
+	0x17,0x85,0xFD,0xFD,0x83,0xDD,0x65,0xD2,0x29,0x10,0x1C,
+	0x90,0x5E,0x2D,0xE1,0xF7,0xC8,0xD9,0xCD,0x81,0xDF,0x6F,
+	0x9A,0xF4,0x66,0x92,0x07,0xC2,0x6F,0x8E,0x68,0x55,0xC5,
+	0xC6,0x65,0xAD,0xB2,0xD0,0x3A,0x80,0xE2,0x58,0x9D,0x80,
+	0x62,0x02,0x7F,0xEC,0xAB,0x87,0xB2,0x57,0x7C,0x9D,0xAA,
+	0x52,0xB0,0x7A,0xEE,0x37,0xCC,0xAD,0xFD,0x39,0xAE,0xF2,
+	0xBC,0xDF,0xDF,0xCD,0xBF,0xC7,0x57,0x89,0x47,0x2A,0x96,
+	0x85,0x96,0xF7,0x71,0xCC,0xFC,0x94,0x76,0x2D,0x3B,0x5C,
+	0x6E,0x7C,0x6A,0x7D,0x86,0x00,0xFE,0xD2,0x7F,0x50,0x21,
+	0x5C,0x6A,0x7A,0x38,0xF6,0xBC,0xB4,0x5E,0xA6,0x4A,0x68,
+	0xBC,0x65,0xB9,0x83,0xC7,0x47,0xA4,0x74,0xE7,0x78,0x3C,
+	0xF1,0xE0,0xED,0xE1,0xE7,0xEA,0xFE,0x99,0x87,0x4C,0xFF,
+	0xC6,0x13,0xE2,0xA8,0x28,0xFF,0x2F,0x9B,0x48,0xBE,0x8D,
+	0x01,0x32,0x7B,0x6C,0x4D,0xFD,0x1D,0xB4,0xDD,0x1D,0x47,
+	0x64,0x3A,0x63,0x36,0x95,0x32,0xF5,0xF3,0x49,0x89,0x37,
+	0x1D,0x5A,0xC3,0x1D,0xBA,0xAE,0x73,0x5E,0x53,0xB8,0x6C,
+	0x2E,0xF0,0xC5,0x34,0x87,0x63,0x7B,0xD5,0x79,0xF3,0xCC,
+	0xDD,0x5E,0x8B,0xC7,0x49,0xE2,0xBE,0xF6,0x85,0x14,0x4A,
+	0x59,0xCC,0x01,0x57,0x18,0x4E,0x94,0xDB,0xCA,0x99,0xB9,
+	0x8C,0xBE,0x11,0x44,0x61,0x92,0x75,0xF1,0x04,0xEB,0x4B,
+	0x17,0xF7,0x43,0x15,0xF3,0x31,0xA2,0x98,0x5A,0x0C,0xBD,
+	0x6D,0x17,0xC9,0x5F,0x74,0x49,0x8A,0x00,0x6C,0x91,0xED,
+	0xC0,0x77,0x14,0xF4,0x11,0xC9,0xFE,0x52,0x69,0xD9,0x24,
+	0x1E,0x84,0x7A,0x9C,0x96,0x04,0x0D,0xA3,0x37,0xA9,0xE1,
+	0x81,0xDB,0x8C,0xAF,0x9A,0x73,0xB0,0x9B,0xDA,0x26,0x4D,
+	0xBA,0x06,0xF0,0x4A,0xFD,0xF2,0x1C,0x5C,0x35,0xCA,0xCD,
+	0x1D,0xAA,0xDA,0xA6,0x08,0x93,0x0F,0x89,0x70,0xC9,0x83,
+	0xC7,0x1C,0x9F,0xA3,0xD9,0x66,0xE9,0x77,0x08,0xEF,0xC7,
+	0x8B,0x00,0xB0,0x8A,0xE3,0xD9,0xBF,0xE9,0xA4,0xE0,0x00,
+	0x71,0x1D,0x78,0xC0,0xDE,0x34,0xA8,0x65,0xF0,0xED,0xA4,
+	0xF9,0xC0,0x6D,0x21,0xBA,0xE9,0x43,0x95,0xC7,0xFE,0x82,
+	0xCA,0xEE,0x69,0xC4,0x86,0x1E,0x52,0xC4,0xB5,0x6C,0xF5,
+	0x22,0x3C,0x03,0x9A,0xE2,0x33,0x98,0xBE,0x17,0x2A,0x16,
+	0xAD,0x8D,0x41,0x79,0x1E,0xBE,0x7A,0x52,0x51,0x80,0xFA,
+	0x83,0xC7,0x91,0x2B,0x6A,0xD3,0xB0,0xEE,0x79,0x32,0xB8,
+	0x0B,0x69,0x46,0x97,0x53,0x1B,0x92,0x01,0x87,0xEA,0xCE,
+	0xA4,0xAB,0x37,0x77,0x5A,0xAD,0x22,0x4B,0xED,0x5C,0xD9,
+	0xAC,0x24,0xA4,0x21,0xE5,0xBC,0xD3,0x55,0xB5,0x12,0x84,
+	0xBD,0x02,0x02,0x5C,0x2D,0xBF,0x0C,0x19,0x92,0x96,0xFC,
+	0x96,0x8B,0xBA,0x94,0x06,0xE7,0x85,0x88,0xB2,0xAE,0xC0,
+	0x52,0xED,0x48,0x73,0x30,0x40,0xBA,0x16,0x48,0x31,0x68,
+	0x06,0xD1,0xA4,0x08,0xD1,0xB1,0xBF,0x64,0x11,0x7B,0x4A,
+	0xA7,0x64,0x69,0x0F,0xC6,0xC2,0x08,0x20,0x8B,0x78,0xDA,
+	0x9F,0x83,0x27,0xE2,0x97,0x47,0x69,0xAE,0xD4,0xD3,0x14,
+	0xC9,0x1C,0xF3,0x0B,0x4D,0xA2,0x4D,0x64,0x08,0xC4,0xED,
+	0xDE,0x8B,0x50,0x8A,0x32,0x5A,0x1B,0x3C,0x2A,0xA8,0xB5,
+	0xAC,0xF6,0x0C,0xB8,0x99,0xC1,0xBC,0x73,0x05,0xF3,0x0D,
+	0x77,0x9D,0x40,0xB4,0xB2,0xD5,0xEA,0x51,0x9D,0x5F,0x80,
+	0x2F,0x18,0xF1,0xEF,0xC0,0x1D,0xBA,0xAC,0x50,0x8A,0xDE,
+	0xA9,0x8A,0x2C,0x1F,0x24,0x62,0xDF,0x15,0x6D,0x21,0x13,
+	0x02,0xB3,0xD3,0x9F,0xD0,0xDA,0xFD,0x88,0xF9,0xA0,0xA1,
+	0x09,0x93,0xEA,0x85,0x9F,0x89,0x05,0xFB,0xD2,0x8F,0x23,
+	0xC4,0x1D,0xF1,0xDD,0x33,0x43,0x33,0xAE,0xF7,0xFA,0x5F,
+	0x89,0x39,0xE4,0x7C,0x5E,0xC5,0x46,0x33,0x35,0x43,0x0C,
+	0xC1,0x07,0x5F,0x18,0x90,0x6B,0x62,0x65,0xDA,0x6F,0x3B,
+	0x06,0x8D,0x57,0x51,0x52,0xC2,0x39,0x15,0x3A,0xEC,0x69,
+	0xAC,0x05,0xC4,0x7F,0x9B,0xE4,0x9B,0xE3,0x99,0x98,0x52,
+	0xC7,0x22,0x42,0x3E,0xF9,0xA9,0x94,0x8E,0xAD,0x1C,0x5E,
+	0x89,0x45,0x7C,0x88,0xD9,0x2D,0xF0,0x3B,0x3A,0x07,0xCE,
+	0x74,0x95,0xCD,0xE4,0xF1,0x0C,0x3C,0x67,0x14,0x66,0x91,
+	0x08,0x5B,0x84,0x74,0xAE,0xD8,0xA1,0x6B,0x2B,0xB2,0x1B,
+	0xFF,0x5C,0x32,0xDD,0x1C,0xD3,0xE8,0xAC,0x09,0x25,0xF9,
+	0x3B,0xD5,0x7C,0xF1,0x0B,0xB5,0xC8,0x31,0x7B,0x57,0x0B,
+	0x12,0x23,0x5B,0xD1,0x1E,0x23,0xDA,0x7E,0xBE,0xA6,0xDB,
+	0xCE,0xB7,0x24,0x58,0xBE,0x6E,0x3F,0x2C,0x51,0x7C,0x9B,
+	0x2E,0xDF,0xA1,0x89,0x20,0x3E,0x46,0xD7,0xEE,0xEC,0x86,
+	0x29,0x3E,0xF1,0x76,0x7A,0xE8,0x85,0x80,0x5D,0xA5,0x2B,
+	0xE6,0xC9,0xA7,0x8B,0xE6,0xAA,0x72,0x93,0x24,0x84,0x54,
+	0x09,0x89,0xC9,0xB9,0x63,0xD8,0x60,0x62,0x60,0x2B,0x33,
+	0x33,0x0F,0xEC,0x96,0x81,0xC4,0xF9,0x02,0xCD,0x86,0xD2,
+	0xA7,0xAF,0x2B,0xE1,0x1C,0xBA,0xEB,0xA1,0xA7,0x3B,0xA1,
+	0x83,0xB5,0x7F,0x31,0x34,0xDD,0xD3,0x50,0x6E,0xF6,0xF5,
+	0xC1,0x03,0xFF,0xFA,0x40,0xE9,0x0A,0xF0,0x06,0xCA,0xD0,
+	0x5C,0x96,0xF7,0x65,0xC3,0x84,0xA9,0xFD,0x25,0x37,0xF8,
+	0x67,0xF9,0x0B,0x8C,0x11,0x4B,0xDD,0x93,0xCC,0x9E,0x76,
+	0x80,0xB7,0xDE,0xF2,0x45,0x6A,0x9F,0x51,0x3E,0x03,0x0F,
+	0x8D,0xB7,0x78,0xBB,0x0C,0x94,0x5E,0x51,0x64,0x83,0xF6,
+	0xE1,0x49,0x2C,0x7A,0xC4,0x15,0x28,0xDC,0x60,0x00,0x61,
+	0x2F,0xEB,0x8F,0x5E,0x87,0xA1,0x2D,0x75,0x31,0x60,0x60,
+	0xDD,0x49,0x27,0x0F,0xE3,0x1C,0x88,0x62,0xE8,0x1A,0x4F,
+	0xEC,0x59,0xA2,0xCE,0x7C,0xC1,0xDA,0x90,0x04,0x44,0x4F,
+	0xC2,0xAC,0x5D,0x82,0x34,0x7A,0x45,0xA9,0xEF,0xBB,0xD9,
+	0x26,0x98,0x28,0x93,0x18,0xBC,0xA9,0x76,0xFC,0x4F,0x70,
+	0x88,0x72,0xBF,0xAE,0x52,0x3A,0xA4,0x93,0xBA,0x1E,0x4E,
+	0xD4,0xD5,0x58,0x17,0x06,0x91,0x4E,0x47,0x82,0xA7,0xFF,
+	0x2C,0x94,0x83,0xA5,0x0A,0x15,0x6B,0x85,0xA0,0xAE,0xB8,
+	0xE9,0x12,0x32,0x9E,0x24,0xAC,0xA5,0x8A,0xDC,0xE6,0x37,
+	0xF1,0x09,0xFC,0xFA,0x62,0xBD,0x00,0x2E,0x28,0x6F,0xCE,
+	0xBF,0x91,0xDB,0x76,0x76,0x17,0x58,0xD0,0xB2,0x70,0x56,
+	0xA0,0x00,0xA2,0x1E,0x9B,0x7E,0x83,0x37,0xBE,0x12,0x5B,
+	0x7F,0xC1,0xD1,0x90,0xBD,0x9E,0xED,0x04,0x1F,0x4D,0x1A,
+	0x8B,0xF0,0x12,0x17,0x53,0xBB,0xFB,0x12,0xEB,0x66,0x78,
+	0x65,0x0B,0x26,0xD7,0x8C,0x4A,0xF9,0x62,0xF1,0x83,0xF6,
+	0xFD,0xF0,0x2E,0x43,0xC4,0x28,0xE7,0x40,0x0A,0x07,0x71,
+	0x1C,0x7B,0xDE,0x6D,0xC6,0x26,0x91,0x7E,0x42,0xFA,0x55,
+	0x82,0x7E,0xD2,0x7A,0x6D,0xD0,0x31,0xB2,0x44,0x50,0x48,
+	0xAC,0x80,0xAD,0x1D,0xF6,0x23,0x13,0x3B,0xC1,0x8F,0x6D,
+	0x39,0xE8,0x8E,0xB0,0x5D,0xDF,0xCD,0xF2,0xF6,0x52,0x24,
+	0xF0,0x0D,0x21,0x46,0xEA,0x97,0x71,0x47,0x35,0xBC,0x66,
+	0x11,0x5B,0xCB,0xA6,0x3B,0x1C,0x6A,0x70,0x8C,0x14,0x25,
+	0x86,0xCF,0x88,0x09,0xD3,0x55,0x6B,0x0D,0xBA,0xBF,0x88,
+	0x06,0xC8,0x0D,0x76,0x89,0x37,0xA6,0xDD,0x00,0x41,0xA8,
+	0x37,0x44,0x14,0x2A,0x0B,0x59,0xDC,0x01,0xF5,0x21,0x91,
+	0xA0,0x27,0x34,0x1B,0x3A,0x07,0x83,0x72,0x55,0xE2,0xB9,
+	0x92,0x2F,0x73,0x19,0x5D,0xCD,0x6A,0x94,0x46,0x63,0x7C,
+	0x8E,0x52,0xFA,0xF9,0x5E,0x7B,0x11,0xD7,0x26,0x3E,0xAF,
+	0xD3,0x1F,0x27,0xAC,0x71,0x0E,0x22,0xAA,0x39,0xFE,0x00,
+	0x40,0x4B,0x61,0x82,0xD6,0xDA,0x6F,0xD6,0x72,0x3C,0x4B,
+	0xAC,0xCF,0x31,0xE3,0x31,0xF4,0xFD,0xB3,0x1A,0xEC,0x20,
+	0x87,0x44,0x44,0xBB,0x88,0xE1,0x3E,0xFE,0x13,0x98,0xBC,
+	0x7A,0xE7,0x5E,0x6C,0xA6,0xBC,0xCA,0xFB,0xF7,0x8B,0x3B,
+	0xC6,0x91,0xCC,0x90,0x1C,0x61,0x7F,0x45,0xAA,0x7F,0x09,
+	0xBE,0x26,0xB5,0x00,0xF8,0xA2,0x24,0x0D,0x26,0xA9,0xCC,
+	0xA0,0x6C,0xBC,0xF5,0xEE,0xCA,0xEE,0x7E,0x07,0x85,0x63,
+	0xA9,0x28,0xB9,0xE7,0xDA,0x30,0xE3,0x07,0xAC,0xC3,0x08,
+	0xA2,0xC7,0x67,0x05,0xD1,0x03,0x21,0x98,0xEB,0x50,0xDC,
+	0x12,0x9A,0xA0,0xB7,0x4C,0x54,0x6C,0xC1,0x21,0x98,0xCA,
+	0x93,0x9A,0xB9,0x0A,0xA3,0x88,0x88,0xE8,0x4D,0xCB,0xE2,
+	0xB0,0xD1,0x3C,0x18,0xD6,0xFA,0xFB,0x1F,0x6C,0x63,0x15,
+	0xD6,0xF6,0xEB,0x28,0x14,0xE1,0x29,0x45,0xF8,0x03,0x81,
+	0x59,0xA6,0x78,0xF2,0xEE,0xE9,0x7B,0x3E,0x14,0x79,0xDD,
+	0x8F,0xBC,0xFB,0xF4,0xBD,0xE1,0x10,0xC6,0x6A,0x39,0x31,
+	0x87,0x2E,0x05,0xCA,0xD5,0xA9,0x02,0x1B,0xB2,0xC0,0x02,
+	0xBD,0xAC,0xA7,0xF5,0x78,0xBA,0x52,0x98,0xCA,0xE4,0x19,
+	0x78,0x59,0x57,0x81,0x52,0x18,0xB5,0xE1,0x86,0xB5,0x87,
+	0x25,0x6F,0xEB,0x40,0x14,0x43,0xE1,0x39,0x54,0x4D,0x81,
+	0x77,0xD6,0xE0,0x6E,0x2B,0x41,0x41,0x3C,0xA1,0x00,0xC9,
+	0xC3,0xC0,0x46,0xD3,0x2C,0x53,0xD6,0x1F,0x85,0xB7,0x5D,
+	0xE1,0x5C,0xA3,0xB3,0x9C,0xDE,0x8A,0x39,0xEF,0x46,0x45,
+	0xE3,0xFE,0xF1,0x3C,0x41,0x16,0xD2,0x75,0xDF,0xE0,0x3D,
+	0xA1,0x99,0x27,0x18,0x51,0x39,0xDE,0xEF,0x13,0x90,0x15,
+	0xEC,0x59,0x2C,0x6F,0x0F,0xD4,0x42,0xC0,0xF1,0xE7,0x9F,
+	0xE2,0x4D,0xD7,0x40,0x30,0x8B,0x9E,0xFC,0x90,0x4C,0xD4,
+	0x6E,0x15,0x98,0x27,0xCA,0xC3,0x41,0x14,0x47,0x61,0x06,
+	0x7C,0x7B,0x72,0x05,0x4E,0xD7,0x50,0x12,0x55,0xB1,0x4D,
+	0x2C,0x75,0xD5,0xE5,0xD5,0xFE,0x72,0x97,0xC5,0xF3,0x65,
+	0xAD,0xD8,0x3A,0x5D,0x22,0xEF,0x92,0x85,0xD2,0xBF,0xF3,
+	0x4A,0x41,0x11,0x98,0xAC,0x2E,0xE0,0xD4,0x25,0x06,0x49,
+	0xD6,0x6C,0x2B,0x5B,0x7B,0x58,0x3B,0xC5,0x61,0xF8,0xAA,
+	0x24,0xD3,0x71,0xA9,0x8F,0x3C,0x7B,0x45,0x87,0x8B,0x2B,
+	0x60,0xB6,0x30,0x58,0x51,0x6F,0x86,0xB4,0x81,0x16,0xB4,
+	0xE5,0x11,0xC4,0x1A,0x65,0x20,0x7D,0x61,0x8C,0x52,0x21,
+	0x99,0x25,0x98,0xCB,0xE0,0xA7,0xF1,0xEE,0x17,0xFC,0x3C,
+	0x0F,0x5F,0x48,0x10,0xF0,0xB2,0xA7,0xC0,0x4B,0xC8,0x98,
+	0xE7,0x02,0xF2,0xB1,0x57,0x4F,0x35,0xBD,0x17,0x8E,0x0C,
+	0x92,0xD5,0x3B,0x27,0x63,0x16,0x0E,0x21,0xDF,0x7C,0xF5,
+	0x4A,0x14,0xC8,0xE6,0x0A,0xB9,0x40,0x99,0x4B,0x48,0x03,
+	0xA2,0x70,0x1A,0x72,0x13,0xB9,0x9B,0x86,0xAE,0x43,0x05,
+	0x4B,0x5D,0x5F,0xA8,0xC0,0xE3,0x3C,0x2F,0x8B,0x6D,0xB4,
+	0x42,0x05,0x7B,0xCC,0xE0,0x87,0xF3,0xA0,0x96,0xFB,0x0B,
+	0xC4,0xCF,0x29,0x01,0xF5,0x1A,0x75,0xF0,0xF8,0x02,0xEB,
+	0x63,0x15,0x2E,0xD9,0x20,0xF2,0xBC,0x05,0x44,0x0E,0xA2,
+	0x05,0xD9,0x54,0x86,0x08,0x41,0x6C,0xF1,0x29,0x2C,0xBC,
+	0xFD,0x22,0xE8,0x05,0xCF,0xA6,0xFC,0x43,0xC7,0xDA,0x2D,
+	0xEF,0x82,0xA6,0xCF,0x7D,0x0E,0xF8,0xF1,0x75,0xB2,0x71,
+	0x49,0x9D,0xFF,0x2F,0x31,0x86,0xDF,0xFF,0xC7,0x94,0xFF,
+	0xEA,0x83,0x0C,0xFF,0xF9,0xC5,0xF7,0xFC,0x27,0x2F,0xD5,
+	0x67,0x1E,0xF1,0x87,0xA5,0x9E,0xA9,0x41,0x37,0x0D,0xA0,
+	0x7F,0x20,0x0A,0xF0,0x26,0x69,0xA8,0xD8,0x33,0x02,0x14,
+	0x07,0x15,0x56,0x28,0x3C,0x5D,0x41,0xE7,0xE2,0xF1,0x4C,
+	0xF5,0x0B,0x16,0x6C,0xCE,0x3D,0x86,0x89,0xF0,0xE3,0x98,
+	0xC4,0x5E,0x58,0xB6,0x66,0x47,0x8B,0x30,0xCF,0x46,0x54,
+	0xDB,0xEB,0x5C,0xA2,0xD2,0x33,0x8E,0x09,0x58,0x94,0xE8,
+	0xD6,0xF5,0x5C,0xD5,0x07,0xFC,0x80,0x90,0xDE,0xED,0x7A,
+	0xB0,0xFC,0xAB,0xAE,0xC5,0xA1,0x5E,0x7E,0x37,0x78,0xF0,
+	0x24,0x46,0x06,0xA9,0xE7,0xAA,0x27,0x04,0xE7,0x4D,0xDA,
+	0xC2,0x23,0x51,0xD5,0xC7,0xAC,0x1C,0x94,0x8E,0x1F,0x36,
+	0xA0,0x3B,0xDF,0x83,0xE7,0x4C,0x81,0xD3,0x29,0x2E,0x7B,
+	0x0F,0x48,0xEB,0xCA,0xE7,0xF6,0xD2,0x88,0x39,0xCD,0xBA,
+	0x4E,0x1B,0x1E,0x3E,0x95,0x7B,0xA4,0xB2,0xE9,0x55,0x1D,
+	0xB4,0x0A,0xED,0xC5,0x51,0x72,0x95,0x08,0xEF,0xF6,0xB1,
+	0xFE,0xCD,0x9B,0x2E,0x61,0xBC,0xBD,0xC8,0x2F,0xEE,0x37,
+	0x4C,0x5D,0xC3,0x02,0xA5,0x0B,0x1F,0x8C,0x10,0x7D,0xBE,
+	0x7F,0x47,0x1F,0x25,0x39,0xFF,0x75,0x2C,0x9A,0x62,0x48,
+	0xCF,0x1E,0x42,0xA8,0xBF,0xE1,0x20,0x75,0x2B,0xA2,0x0B,
+	0x3F,0xF5,0x59,0x1A,0x8A,0xD9,0xE4,0x6D,0xEF,0x7E,0x40,
+	0xCF,0x4E,0xBF,0x97,0x4B,0xBF,0x3D,0xF8,0x5D,0x6E,0x80,
+	0xEE,0x76,0x7E,0x9B,0xA2,0x76,0x50,0x98,0xF2,0xF2,0xA0,
+	0xBB,0xA2,0x95,0x9F,0x27,0x23,0x57,0x6D,0xD4,0x96,0x2B,
+	0xAD,0xED,0x66,0x46,0x37,0xD7,0x0C,0xE0,0x28,0x0D,0xA0,
+	0x51,0x59,0x23,0x8F,0x13,0x7F,0xCC,0xB1,0xD4,0x0A,0xD7,
+	0x23,0xEE,0x00,0x98,0xD6,0x25,0x0B,0x9E,0x3F,0xF8,0xE4,
+	0x65,0x17,0xE2,0xA5,0x47,0xD8,0x3E,0xB5,0x9C,0xC3,0x8B,
+	0x7A,0xAF,0xCE,0xE7,0x3B,0x00,0x46,0xB1,0x02,0xF7,0x20,
+	0xC7,0x9A,0x45,0xEF,0xAA,0xA7,0x6F,0xAD,0xFB,0xB4,0x34,
+	0xE2,0xCA,0xF8,0x0E,0x5E,0x14,0xCB,0xA3,0xD1,0xE6,0x37,
+	0x8B,0x10,0xFA,0xDD,0xAC,0x95,0xF1,0x1D,0x2F,0x3C,0xFD,
+	0x96,0x53,0xFB,0x7E,0x01,0xBC,0x46,0xCF,0x3B,0x18,0x1F,
+	0xC8,0xA4,0xF5,0x1A,0xB5,0x7D,0x80,0x93,0x60,0xDA,0xC2,
+	0x70,0xCD,0x13,0x25,0xAE,0x13,0xB0,0x1D,0x0F,0x96,0x46,
+	0x80,0xEA,0xED,0xEB,0x3C,0xB6,0xE8,0x1E,0xEB,0x87,0x73,
+	0x2E,0x69,0xC8,0xBD,0xED,0x2D,0x6A,0x6C,0xF3,0x57,0x6A,
+	0xEE,0x19,0x3A,0xAA,0x98,0xFA,0x0B,0xEC,0x63,0x8E,0xED,
+	0x8C,0x28,0x43,0x96,0xE5,0x6B,0xC3,0x94,0x2A,0x35,0x5E,
+	0x59,0xAD,0x65,0x1D,0x11,0x87,0x0E,0xAE,0xE5,0x72,0x5C,
+	0xD8,0x56,0x99,0x59,0x42,0xBC,0x72,0x33,0xF1,0x00,0xA1,
+	0x04,0x3A,0x93,0x2A,0x3A,0xC1,0xBE,0xF5,0x17,0x8D,0xA0,
+	0x4E,0x29,0x8B,0x24,0xCB,0x65,0xB6,0x0D,0x89,0x6F,0x1D,
+	0xCB,0xA0,0x43,0xDB,0xD2,0xE8,0x24,0xAF,0xF0,0xA5,0x9F,
+	0x61,0xF5,0x41,0xB2,0x1A,0xE9,0xB9,0x83,0x4D,0x38,0x28,
+	0xE9,0xDA,0x7E,0x59,0x0E,0x79,0x63,0xF8,0xA8,0xB7,0x91,
+	0x39,0x58,0xE8,0x76,0x5C,0x59,0x80,0xF9,0xC0,0xF1,0x2E,
+	0x99,0x94,0xE4,0xAB,0x65,0x37,0x56,0xCE,0x22,0x66,0x5F,
+	0xDA,0xE3,0x4C,0x71,0x62,0x2D,0x12,0x4E,0xC4,0xEB,0x57,
+	0x2C,0xB6,0x9D,0xD2,0xF9,0x81,0x08,0x7B,0x8A,0x39,0xB5,
+	0x75,0xC6,0xFE,0x8F,0xED,0x55,0xDC,0xF1,0xA4,0x39,0x40,
+	0x5D,0x27,0x29,0xD0,0x1F,0x70,0x4E,0xD6,0xFC,0xF2,0x0C,
+	0x04,0x60,0x29,0xED,0x8B,0x54,0xD4,0xD9,0x1F,0x4A,0x16,
+	0x41,0x12,0x79,0x89,0xDA,0x73,0x77,0xB6,0x9E,0x2F,0xF4,
+	0x83,0x13,0x8A,0xAA,0x8A,0xB5,0x58,0x23,0x27,0xBF,0xDB,
+	0xAC,0x62,0x8E,0x3D,0x88,0xE2,0x1D,0xC7,0x3D,0xBE,0xB1,
+	0xA3,0x56,0x20,0x8F,0x3C,0x6B,0x58,0x49,0x87,0x9E,0xAC,
+	0xA0,0xFF,0x79,0x26,0x62,0x78,0xB4,0x19,0xB8,0xE5,0x28,
+	0x2C,0x32,0xD5,0x40,0xA9,0x0A,0xBD,0x6D,0x55,0x2A,0x8A,
+	0x45,0x2E,0xB4,0x5C,0xD5,0x0D,0x8A,0xCF,0xD5,0xAB,0x74,
+	0x8B,0x7B,0x62,0xD3,0x9A,0x4F,0xDB,0x31,0x5B,0xD0,0x04,
+	0x61,0xD6,0xD0,0x7C,0x49,0xCB,0xB5,0xAB,0xB8,0xDA,0xD7,
+	0x6E,0x97,0xAB,0x40,0xCD,0x97,0x31,0xF6,0x7C,0xED,0x7F,
+	0xD7,0x0D,0x42,0x72,0x72,0xB3,0xF0,0xA5,0x94,0xEB,0x04,
+	0xF0,0xE5,0x99,0xF1,0x85,0xF6,0x5B,0x7D,0x9A,0xB9,0xFA,
+	0x17,0x13,0x75,0x21,0x7E,0x34,0x1D,0x3D,0xA0,0x0C,0x98,
+	0x3B,0xA3,0x14,0xE1,0xF4,0x9E,0x7F,0x90,0x58,0xE3,0x0A,
+	0xB0,0xDA,0x50,0x6F,0xEE,0x2C,0x08,0x71,0x05,0xF7,0xF0,
+	0xF4,0x99,0xD3,0x7F,0x37,0xB4,0xAA,0xB5,0x29,0x47,0x8D,
+	0xAB,0x77,0xB7,0x39,0xC3,0x48,0x78,0x35,0x6E,0x61,0x07,
+	0xBB,0xD4,0xBB,0x5D,0x4B,0xA7,0x4C,0xA1,0x3C,0x46,0xF1,
+	0xEC,0x55,0x59,0x4F,0x54,0x67,0x58,0x4C,0x2A,0x2B,0xCA,
+	0x8A,0x97,0x91,0x29,0x1A,0xAF,0xD2,0x94,0xE0,0xE9,0x16,
+	0x8D,0x7A,0x85,0xEF,0x56,0x84,0xC4,0xFD,0xDF,0xD1,0x3B,
+	0x22,0x9D,0xC8,0x4F,0x14,0x7A,0x2E,0x97,0x55,0xD5,0xF2,
+	0x8B,0x04,0x24,0xCD,0x3E,0x0D,0xB4,0x2B,0xBF,0x1E,0x73,
+	0xAE,0x2F,0xC7,0x11,0xF4,0x68,0x0F,0x37,0x42,0xCA,0x64,
+	0xDF,0x25,0x8E,0x51,0xFF,0x3E,0xAD,0x16,0xB6,0x64,0xFF,
+	0x17,0x7F,0x5D,0x9D,0x12,0x1A,0x18,0x62,0x21,0x7C,0x97,
+	0x1B,0x23,0x40,0xE0,0x53,0x83,0xC3,0xA1,0x0A,0xDF,0x74,
+	0x42,0xE8,0x6D,0xE5,0x8D,0xF0,0x38,0xEB,0xA2,0xF7,0x53,
+	0x26,0x15,0xB5,0xA7,0xA2,0x4F,0x59,0xD6,0xD1,0xD4,0xC3,
+	0x2B,0xD5,0x5B,0x86,0xC6,0x4D,0x6A,0x51,0xC0,0x49,0x57,
+	0x78,0xC0,0xA9,0xF7,0x0E,0x7B,0xA4,0xB5,0x28,0xDD,0xB4,
+	0x8C,0x3D,0x4F,0x60,0xFD,0xE5,0xC2,0x32,0x41,0xF2,0x3B,
+	0xFF,0x32,0xB8,0x65,0xEA,0x8F,0xF3,0xDD,0x70,0x7F,0x87,
+	0x90,0xCC,0xAD,0x6D,0xC8,0xB9,0x8F,0x36,0x94,0x33,0x32,
+	0xFC,0x14,0xC9,0xF2,0xA3,0xB0,0x1C,0x4B,0x78,0xEA,0xE9,
+	0xB0,0x8A,0x27,0x0D,0xC0,0x39,0xD5,0xD8,0x94,0xAD,0xC5,
+	0x66,0xE8,0xF7,0x46,0x26,0xB3,0x29,0xCB,0xDD,0x15,0x8B,
+	0x17,0x23,0x05,0x84,0x69,0xE8,0xFD,0x58,0xC8,0x05,0xCA,
+	0x72,0x25,0x0B,0xDD,0xA6,0xEA,0x33,0x80,0x8A,0xA4,0x27,
+	0xB4,0xA1,0xEB,0xB1,0xB0,0x73,0x9F,0x5E,0xDA,0x8B,0x1F,
+	0x64,0xAD,0x77,0xCA,0xD5,0xD8,0xCE,0x7D,0xD2,0x61,0x1D,
+	0xBB,0xE7,0x79,0x36,0x62,0x1C,0xD7,0xAF,0xA9,0x9A,0x9B,
+	0xFC,0x8D,0x18,0xA1,0xC2,0x17,0xC5,0x35,0xB6,0xE7,0x59,
+	0x75,0xE9,0xFE,0xFE,0x6C,0x6C,0x18,0xD3,0x89,0xF8,0x99,
+	0x63,0xAC,0x5F,0xAD,0xCF,0x91,0x9D,0xAF,0x29,0xE0,0x8E,
+	0x67,0x8E,0x4B,0xCA,0x13,0xD5,0x7D,0x3F,0xD0,0xCC,0xCD,
+	0x6A,0x0F,0x34,0x73,0xF3,0xC1,0x5A,0xDA,0x0D,0x89,0x8D,
+	0x07,0xF8,0x4C,0x24,0x3F,0x16,0x55,0xD2,0x3D,0xE1,0x08,
+	0xBE,0x60,0x36,0x3D,0xBC,0xA3,0x3E,0xD7,0x4D,0xE8,0xB6,
+	0x02,0xA4,0x53,0xBB,0x65,0x65,0x77,0x25,0x6C,0x60,0x2C,
+	0xCB,0xD1,0x5D,0x73,0xE9,0xEA,0x5E,0xA1,0xC3,0xD5,0x15,
+	0xF6,0xB0,0xC9,0x66,0x69,0xF9,0x07,0xB9,0x17,0x83,0x12,
+	0x2D,0x24,0x90,0x07,0x12,0x20,0x9A,0x07,0x41,0x54,0x43,
+	0xC9,0xB6,0x24,0x42,0x50,0x0F,0x7B,0xE6,0x86,0x38,0x47,
+	0xA8,0x35,0x6B,0x77,0xE1,0x7F,0xA8,0xD2,0xCD,0x71,0xCD,
+	0xF2,0xB9,0x79,0x96,0x40,0x00,0xEE,0xEC,0xC9,0x7A,0x3B,
+	0x72,0x03,0x75,0x42,0x7F,0x89,0x91,0xFA,0xA3,0x76,0xE9,
+	0xC3,0x0F,0x0A,0x9D,0xB1,0x9A,0x3E,0xCF,0x58,0xAC,0x9D,
+	0x5F,0x5B,0x8C,0x16,0x21,0x4F,0xFD,0x80,0x2C,0x89,0x95,
+	0xBC,0x79,0x9E,0xFB,0x31,0x1F,0x42,0xF0,0xF7,0x87,0x67,
+	0x7C,0x66,0x9D,0x9A,0xDC,0x33,0x15,0xC6,0x3E,0xF1,0x70,
+	0x4E,0xB5,0xE3,0x2B,0x9F,0xF1,0x66,0x4E,0xAA,0x7A,0x45,
+	0x14,0x69,0x36,0x34,0x27,0x69,0xF9,0x30,0x8B,0x2B,0x76,
+	0x41,0x11,0xF1,0x35,0x03,0x1B,0x9F,0x7C,0x96,0xBC,0xA3,
+	0x24,0xC3,0x07,0xDA,0x2F,0xFA,0xE1,0x16,0x19,0xF3,0x59,
+	0x57,0x46,0xFB,0x27,0x64,0xC6,0xC9,0xD4,0x9B,0x81,0x86,
+	0x3A,0x56,0xAB,0xFE,0x32,0x2F,0xA1,0x1E,0x98,0xE7,0x4F,
+	0x96,0x5B,0x6D,0x3C,0xF4,0x0D,0x96,0xE9,0xE7,0xD7,0xB3,
+	0x65,0x07,0xD5,0x31,0x4B,0x54,0x8F,0x70,0xB7,0xE4,0xE0,
+	0x69,0x21,0x78,0xBC,0x48,0x3F,0x99,0x68,0x81,0x60,0x87,
+	0xD7,0xDB,0x57,0xE1,0xB0,0xF1,0x83,0x96,0xDF,0x73,0xD5,
+	0xA7,0xBD,0xC3,0x91,0xBF,0x24,0x2E,0x2C,0x2E,0xBE,0x57,
+	0xBA,0x79,0x30,0x5C,0xEC,0x08,0x99,0x10,0xAE,0x6E,0xB5,
+	0x0A,0xC6,0x0F,0xCC,0x20,0x32,0x00,0xF9,0x1F,0x45,0x57,
+	0x09,0x9C,0xF0,0x86,0x5F,0x92,0x59,0x86,0x7F,0xD4,0x21,
+	0x95,0xF2,0x25,0x23,0x4E,0x23,0x4F,0x84,0xA3,0x38,0xE1,
+	0xD4,0x7E,0xFF,0x31,0x9C,0x2B,0x16,0xE5,0x2D,0xA1,0x49,
+	0xF6,0xAF,0xAB,0x23,0x1C,0x8D,0x7A,0x69,0xE4,0x82,0x28,
+	0x52,0x5B,0x74,0x18,0x23,0x32,0xB0,0x32,0x70,0xC3,0x9D,
+	0x4A,0x80,0xDA,0x14,0x59,0x22,0xF9,0x2E,0x0D,0x7B,0xB7,
+	0xB8,0x9C,0x79,0x3A,0xED,0x6A,0xB7,0xE4,0x08,0x82,0xFB,
+	0x70,0x10,0x43,0xBC,0xD4,0x0B,0xFA,0x45,0xD7,0x8D,0x08,
+	0xCB,0xEC,0x6A,0x1A,0x69,0x3C,0x90,0xFF,0xB4,0x47,0xCF,
+	0xC3,0xE7,0x60,0x83,0xFC,0xC6,0xB1,0xE2,0x94,0x87,0xEA,
+	0xF0,0x5E,0xA8,0x80,0x56,0x27,0x74,0x52,0x0C,0x98,0x5E,
+	0x5E,0xE7,0x10,0xA9,0xB0,0x17,0x3A,0x80,0x45,0x74,0xF4,
+	0x87,0x3E,0xB9,0x2B,0x18,0x62,0x9A,0x1D,0x2E,0xC6,0x14,
+	0xD6,0x3B,0xF7,0xFD,0xE1,0x15,0x95,0x2B,0x4A,0x6F,0x20,
+	0x2B,0x54,0x9C,0xB2,0x9B,0xF7,0x7B,0xC6,0xC9,0x6D,0x12,
+	0x87,0x9C,0x9D,0x43,0x84,0xE6,0xB7,0xDB,0x33,0xA7,0xB6,
+	0x1A,0x31,0x4E,0x73,0x7F,0xAE,0x9C,0x66,0x28,0x1A,0x73,
+	0xD5,0xA0,0x51,0x6B,0xCF,0xE4,0xE3,0xF6,0x30,0xC3,0xE9,
+	0xF4,0xC3,0xED,0xEF,0x7D,0xBC,0x98,0xFE,0xCE,0x77,0x8E,
+	0x04,0x9C,0xD5,0x12,0x83,0xB1,0xF7,0x86,0x42,0xCF,0xF9,
+	0x28,0x40,0x32,0x5D,0x76,0x27,0xEE,0xA6,0x47,0xD7,0xA1,
+	0xB5,0xEE,0x31,0x15,0xB3,0x6B,0xE9,0x7D,0x38,0x75,0x31,
+	0x64,0x1A,0xB7,0x76,0xEF,0x65,0xEF,0x54,0x59,0x16,0x4B,
+	0x81,0x91,0x6A,0x99,0xFD,0x63,0x6A,0xF4,0xC8,0x2F,0xFE,
+	0x53,0x22,0xCE,0xCE,0x03,0x00,0xD3,0x0C,0x97,0x9C,0x44,
+	0x3A,0x5C,0xB3,0x9F,0xA3,0xD7,0x3A,0xE4,0x7E,0x9F,0x1C,
+	0x4A,0x54,0x37,0xC4,0x60,0x03,0x90,0xED,0xAA,0xC4,0x97,
+	0xD3,0x0E,0x1D,0x4C,0x58,0x11,0x0E,0xA2,0xCB,0x3C,0x5B,
+	0x03,0x74,0xB6,0x9D,0x24,0x3E,0x87,0xA8,0xB4,0xBB,0x6C,
+	0x1B,0x00,0xDA,0xA7,0x5F,0x9E,0x1C,0xE5,0xA0,0xD7,0x4B,
+	0xE1,0x83,0x4F,0x52,0x64,0xB2,0x82,0xC4,0xBA,0x61,0xBA,
+	0xFF,0xC6,0x91,0xA8,0x87,0x19,0xEC,0x6C,0xB5,0xBB,0xED,
+	0xAE,0xC0,0xF4,0x45,0xC8,0x60,0x56,0xEF,0xBC,0x1B,0x98,
+	0xF5,0xD3,0x2B,0xE1,0x61,0x56,0x1B,0xA9,0x02,0xA2,0xC6,
+	0x3D,0x4D,0xC1,0x30,0xD1,0x8D,0x94,0xFE,0x0F,0xEC,0x24,
+	0xD5,0xA3,0x2A,0xCB,0xD1,0xC3,0xED,0x62,0x99,0x7E,0x64,
+	0x47,0xEC,0x11,0xB8,0xCB,0xEB,0xE6,0x13,0xEA,0xC2,0x1D,
+	0x65,0xC6,0xF2,0x21,0x81,0x76,0x8A,0x23,0xA2,0x58,0x8F,
+	0xA8,0x16,0x0A,0x12,0x3A,0xCE,0xF4,0x32,0xFE,0x84,0xB7,
+	0xD5,0xF3,0x91,0x2B,0x53,0xB7,0xBE,0xBC,0xA7,0x32,0x32,
+	0x6B,0x70,0xE8,0x0A,0x8C,0x3B,0x3F,0x41,0x78,0x54,0x66,
+	0x23,0x8F,0x23,0x8D,0xC7,0xEC,0xB5,0xDB,0xBB,0x1B,0xEF,
+	0xF8,0x75,0xCB,0x86,0x03,0x63,0x69,0x7E,0x58,0xB8,0xA0,
+	0xE7,0x57,0x68,0x1B,0x31,0x3A,0x49,0xA4,0xA8,0x2E,0x3A,
+	0x33,0x0B,0xFE,0x8B,0xFB,0xBC,0xE7,0x39,0x0C,0x65,0x1D,
+	0xB3,0x9F,0xE1,0x6D,0xD5,0x12,0xA7,0x78,0x8F,0xB4,0x49,
+	0xC1,0xC4,0x2D,0x75,0xF2,0x0E,0x0B,0xFF,0xC0,0x96,0x43,
+	0x18,0x18,0x7C,0x44,0x35,0xE3,0x33,0x6B,0x10,0x23,0xB1,
+	0x5D,0x7D,0x65,0x27,0xE3,0x2D,0x3B,0x05,0x8D,0xCA,0x27,
+	0x4F,0x3F,0x6F,0x6D,0x79,0x15,0x62,0x9B,0x64,0x7D,0x7B,
+	0x7A,0xFE,0x66,0x4C,0x78,0x0C,0xE2,0x8E,0xD0,0x4D,0x18,
+	0xC3,0xD2,0xE9,0x1E,0x23,0xAE,0xD2,0xE2,0xF9,0xA5,0xAA,
+	0xD2,0xC6,0xF3,0x80,0xFF,0x58,0x1C,0x1B,0x43,0x1B,0x51,
+	0x13,0xCE,0x9E,0xC9,0xF2,0xD5,0xA8,0x98,0xDA,0x30,0xD4,
+	0xB2,0x49,0xD6,0x9D,0x70,0x7F,0x5D,0x8E,0xB9,0x82,0xBE,
+	0x69,0x59,0x57,0x2E,0xE5,0x72,0x48,0xAB,0x83,0x27,0x3B,
+	0xFE,0xF2,0x13,0x82,0xE5,0xAF,0xEA,0xF3,0xDF,0x27,0x56,
+	0x38,0x54,0xDA,0x5B,0x84,0x9A,0xEC,0xD3,0xCF,0xF8,0x00,
+	0x5F,0x48,0x8D,0x3D,0x3A,0x65,0x6A,0x78,0x33,0x8A,0x68,
+	0x45,0x00,0xE8,0x1E,0x2D,0xE5,0x24,0x4B,0xDB,0x18,0xAC,
+	0x2F,0xC3,0xA6,0xA7,0x60,0x57,0xF2,0xBF,0x98,0x72,0xE1,
+	0x0F,0x58,0x16,0x27,0x6D,0x9F,0xE0,0x99,0x49,0x75,0x91,
+	0x62,0xF2,0x8D,0x59,0x53,0x04,0xC6,0x59,0x4D,0xF2,0x08,
+	0x30,0x45,0x93,0x94,0x1D,0xBF,0x41,0xEE,0x3A,0x17,0xD9,
+	0x1A,0x54,0x8E,0xEA,0x53,0x0A,0x0D,0xFD,0x6B,0x6B,0x62,
+	0xFD,0x79,0x50,0xD3,0x07,0x73,0x43,0x44,0x0C,0xDE,0x88,
+	0x29,0xC3,0x29,0xBF,0xBF,0xAB,0x5C,0xDA,0xB1,0x57,0x99,
+	0xE8,0x2F,0xF9,0xB5,0x0B,0x12,0xA1,0x96,0x99,0x5E,0x5A,
+	0x0C,0xF2,0x83,0xFD,0x8D,0xBA,0x3F,0xC4,0xE0,0x65,0x70,
+	0xF3,0x2B,0x76,0x04,0x18,0x68,0x7F,0x64,0x27,0x57,0x35,
+	0x68,0xCF,0x25,0x1C,0xC4,0x00,0x9B,0x12,0x43,0xA3,0x55,
+	0x93,0x29,0xBB,0x09,0xAE,0x65,0x7B,0xEF,0x2B,0xA6,0x32,
+	0xB9,0x1B,0xFF,0xBD,0x38,0xF2,0x3A,0x5F,0x51,0xDE,0xA0,
+	0xC2,0x96,0x1A,0xEE,0x08,0x47,0xC6,0x2C,0x64,0xB4,0x02,
+	0x22,0xFB,0xA5,0xE5,0x69,0xCC,0x8D,0xEF,0xCF,0xDF,0x48,
+	0x26,0xF4,0xBC,0x0C,0xF9,0x79,0x1B,0x17,0xD4,0xC3,0x31,
+	0xE7,0x80,0xAB,0x69,0xC2,0xD4,0x12,0x0E,0xF9,0x56,0xA7,
+	0xDD,0xBF,0x37,0xAB,0xEB,0x86,0xD0,0xE5,0x27,0x12,0xA8,
+	0x73,0xC5,0xF0,0x85,0x7B,0xA8,0x87,0xCE,0x3E,0x79,0xDA,
+	0xA6,0x79,0x97,0xB4,0x65,0xF2,0xFA,0x3E,0x09,0xDB,0xF6,
+	0x33,0x12,0x28,0x4E,0x02,0x52,0x8D,0xB0,0xBF,0xDA,0xF3,
+	0xCB,0x5B,0x36,0x21,0x7F,0x0A,0xA6,0x50,0xBD,0xB1,0xA8,
+	0xBB,0xEE,0xF1,0xDA,0xDD,0xE2,0x94,0x32,0x33,0x77,0x66,
+	0x8C,0x71,0x02,0x46,0x7E,0xA9,0x5D,0xCC,0x9B,0x16,0x1D,
+	0xEC,0x3B,0x3C,0x13,0x52,0x2B,0xB6,0xE1,0xD8,0x42,0x4E,
+	0x04,0xF6,0xC9,0x39,0xAC,0xD4,0xC9,0xA0,0x28,0xC7,0xC2,
+	0xB2,0x56,0xB2,0xE7,0x67,0x7F,0x55,0xF1,0x99,0x82,0xBD,
+	0xFB,0xD2,0x14,0xF7,0x16,0x63,0xF0,0xE5,0x0B,0x38,0x86,
+	0xE9,0x9F,0x54,0x77,0x59,0x4A,0xA2,0x0B,0x76,0xBD,0x6C,
+	0xF9,0xB1,0x5B,0xBE,0xF9,0xB2,0x90,0xC4,0x54,0xC6,0x45,
+	0xD8,0xFB,0xEC,0x15,0xD7,0x0B,0x5F,0xAE,0xFD,0x2A,0x39,
+	0x92,0xE0,0xBB,0x20,0x0F,0xF6,0xE3,0x15,0xFD,0x06,0x95,
+	0xC9,0x2D,0xFE,0x58,0x11,0x6B,0x2B,0xD9,0xC6,0x7D,0x96,
+	0x69,0x4D,0x9D,0x46,0xF3,0xE7,0x16,0x80,0x12,0x27,0xAF,
+	0x6A,0x13,0x23,0xEF,0xCF,0x51,0xD0,0xE4,0x98,0x3C,0x4B,
+	0x77,0x91,0xD3,0x68,0xB1,0x35,0xDB,0x05,0x48,0x32,0xC5,
+	0xAA,0x15,0x4F,0xBE,0x64,0xB6,0xBC,0xB6,0xEA,0x2A,0x7D,
+	0x66,0x80,0x25,0x2C,0xAF,0xD5,0x7C,0x6D,0x59,0xF6,0xE6,
+	0x6A,0x90,0xCD,0x8D,0x67,0x9D,0xD0,0x76,0xDC,0x73,0xB2,
+	0xF1,0xB2,0xED,0xCF,0xB8,0x5D,0x07,0x90,0x09,0x22,0xF9,
+	0x57,0x50,0xC7,0x30,0x5E,0x82,0x26,0x12,0x5F,0x08,0x8B,
+	0x36,0xD4,0x34,0xC5,0x2A,0xFC,0x54,0x1C,0xC3,0x99,0x9D,
+	0x35,0xDF,0x11,0xD2,0x29,0x50,0x58,0x53,0x3F,0x52,0xB9,
+	0x76,0xE4,0x4F,0xC0,0x16,0x63,0x6F,0x83,0x50,0x40,0x9A,
+	0x7C,0xC3,0x5A,0xE0,0x9F,0x80,0x5A,0xF6,0x7A,0xB3,0xFD,
+	0xC6,0x15,0xFD,0x08,0xF9,0x8D,0x94,0xA9,0x9C,0xED,0xBD,
+	0x79,0x96,0xC9,0xDB,0xC4,0xDC,0x8E,0x83,0xCE,0x83,0xA2,
+	0x69,0xCE,0xB7,0x2A,0x37,0xE2,0xC2,0xC1,0x68,0xD9,0x8C,
+	0x33,0x09,0x4E,0xA8,0x97,0x27,0x67,0x08,0x0C,0xD7,0x9B,
+	0x87,0x94,0xF9,0x7A,0xE7,0xE9,0x90,0x68,0x11,0x05,0x25,
+	0xFA,0x8E,0x3E,0x83,0x3F,0xC1,0x9B,0xDA,0xC5,0x03,0x34,
+	0xC1,0x18,0xA1,0x0E,0x4F,0x68,0x71,0xDF,0x2E,0x14,0xA9,
+	0xD0,0x2E,0xA6,0x95,0x68,0xAA,0x31,0x2A,0x61,0xC6,0x13,
+	0xB5,0x0E,0xAC,0x48,0x1C,0xDF,0xC4,0x64,0xC4,0xF4,0xEE,
+	0x6E,0xEB,0x14,0x7D,0xDC,0x6C,0x48,0xA6,0x67,0x94,0xB4,
+	0x40,0x63,0xD4,0xC6,0xF6,0xD0,0xD2,0x11,0xC7,0x9D,0xDF,
+	0x6F,0x66,0x68,0x27,0xF8,0xBD,0x13,0x81,0x74,0xF7,0xE3,
+	0xE4,0xE7,0xA7,0x24,0x74,0xEE,0x6F,0x58,0x95,0x41,0x8F,
+	0xA0,0x17,0x2B,0x70,0xDB,0x4F,0x68,0xA7,0x38,0xA2,0xE5,
+	0x8F,0x3E,0x17,0x8E,0x9F,0xC3,0x1D,0xED,0x42,0xAD,0xB4,
+	0x9D,0x57,0x6F,0xC5,0x73,0xC7,0x4E,0x1B,0xCA,0x37,0xC9,
+	0x0E,0x7B,0x64,0xA7,0xBE,0x0C,0xD7,0x75,0x0C,0x79,0x22,
+	0x8E,0x5C,0x8B,0xC6,0xDA,0x69,0x13,0xBA,0xCE,0x67,0xC1,
+	0x67,0xA2,0xE8,0xEA,0xA9,0xEF,0x64,0xE1,0x5A,0xDA,0x47,
+	0x1B,0x42,0xC4,0x32,0x14,0x0E,0x7D,0xC2,0xCA,0xF8,0x62,
+	0x96,0x6E,0x5E,0xF8,0xC7,0x3A,0x25,0x4D,0x13,0x91,0x9B,
+	0x71,0x64,0xF0,0xEC,0xA7,0x99,0x91,0xD3,0xAE,0x61,0x0B,
+	0xFF,0xA4,0x80,0xCB,0x4C,0xD9,0xFE,0x69,0xB1,0x73,0x10,
+	0x4F,0xEF,0x9B,0xEC,0xD3,0x7F,0xFC,0x2B,0x1C,0x3E,0x00,
+	0x34,0xAB,0xC5,0xD8,0x78,0x08,0x4B,0xCB,0xEA,0x56,0xEA,
+	0x8D,0x74,0xB1,0x7C,0x50,0x0F,0xBA,0x27,0xF6,0x3C,0xE4,
+	0x3B,0xC2,0xDD,0x3A,0xD0,0x46,0x1B,0x3F,0x75,0x47,0xEF,
+	0xA8,0x30,0x40,0x3E,0x39,0x33,0xA4,0xA0,0xBF,0x42,0x76,
+	0x95,0x4B,0x46,0x8B,0x78,0xAF,0x1A,0xFC,0xCF,0x0A,0xB5,
+	0x51,0x53,0x14,0xBB,0xF6,0x14,0xC1,0x9D,0xC1,0x2F,0xEE,
+	0x07,0xFC,0x79,0x75,0x28,0x7F,0x58,0xEB,0xE1,0x27,0x65,
+	0x81,0x0C,0xC5,0xC0,0x1E,0xBB,0x72,0xB2,0x6E,0xF9,0x6E,
+	0x1F,0xDB,0x4B,0x17,0x6A,0x6E,0xB3,0xE9,0xD8,0xFD,0x19,
+	0x57,0x05,0x24,0xAC,0xF8,0xBA,0xA2,0x4A,0x48,0xF1,0x9B,
+	0xC0,0xFC,0xFC,0x41,0xA5,0x6F,0x13,0x51,0x21,0xD1,0x3C,
+	0x7D,0x9F,0x91,0xE7,0xD8,0x22,0x3B,0x5E,0xCA,0x12,0x80,
+	0x13,0x89,0x57,0x42,0x88,0xC5,0x8B,0x1F,0x30,0xA4,0x27,
+	0x84,0xC9,0x91,0x83,0xB0,0x3E,0xD1,0x17,0xF1,0x17,0xC4,
+	0x71,0x96,0xF1,0x4C,0x3C,0xE4,0xFA,0x05,0x8B,0x86,0x21,
+	0x95,0x3C,0xFB,0x7F,0x30,0xA0,0xDF,0xF0,0x42,0x9F,0xF0,
+	0xA8,0xBF,0x58,0x9F,0xAC,0x28,0x85,0x2E,0xEF,0xE9,0x17,
+	0xBB,0xE3,0xE1,0xAC,0x72,0x2B,0x71,0x3C,0x5A,0x54,0xDF,
+	0xCC,0x00,0xF8,0xC3,0x8F,0xFE,0x71,0xEE,0x51,0xED,0x43,
+	0x0F,0xED,0x9A,0xA1,0x3A,0xC2,0x97,0x09,0xC9,0x78,0x45,
+	0xEE,0xB7,0x5B,0x66,0xD2,0xA3,0x92,0xE2,0x39,0xC5,0x3D,
+	0xBC,0x91,0x28,0xD9,0xB0,0xC1,0xAB,0x53,0xD7,0x6C,0x55,
+	0x85,0xBE,0x42,0xFB,0x4E,0x1A,0xA4,0xB8,0x41,0x23,0x2A,
+	0x60,0x8F,0x39,0x83,0x17,0xD8,0xF5,0xF7,0xED,0x5B,0x91,
+	0xD0,0x53,0xAE,0x15,0x14,0xC8,0xFE,0x7F,0xEE,0xFB,0xAC,
+	0xA9,0x5F,0x52,0xAC,0xC8,0xB9,0x3D,0xC3,0x11,0xCE,0xCB,
+	0x0A,0x90,0x52,0x82,0x99,0x9F,0xF4,0x22,0xBD,0xEA,0x55,
+	0xC3,0x43,0x09,0x68,0x62,0x87,0x95,0xC9,0x64,0x30,0xFC,
+	0x5F,0x23,0x5C,0x81,0x88,0xD4,0x40,0xC0,0x9D,0xF0,0x8D,
+	0x5C,0xB4,0xA5,0x0E,0xBD,0x4B,0x3D,0x29,0x94,0x64,0x59,
+	0xCF,0x16,0xF2,0xA7,0x5F,0x9D,0xB0,0xFF,0x76,0x16,0xA4,
+	0x68,0xF8,0xA2,0x76,0xBB,0x49,0x80,0xFE,0x9F,0x7A,0xEC,
+	0xBC,0xBD,0x23,0x3E,0x88,0x1C,0x84,0xB9,0xAF,0x11,0xB6,
+	0x19,0x34,0x9E,0x5F,0x78,0xB9,0x0A,0x8E,0x79,0xF1,0x59,
+	0xD2,0xEC,0x47,0x3B,0x45,0x81,0x10,0x76,0x63,0x30,0x1A,
+	0xF5,0x02,0x76,0x03,0x97,0x0C,0x04,0x50,0x0C,0xCD,0x21,
+	0x19,0x29,0x9B,0xB1,0x1B,0x7F,0x65,0xF1,0x11,0x69,0xCF,
+	0xF5,0x6B,0x0F,0xCB,0x5E,0x41,0xDA,0x18,0xBC,0xDE,0x9D,
+	0xEB,0xBA,0xC4,0x31,0xB4,0xBF,0x0D,0x3F,0xC6,0x91,0x4B,
+	0x24,0x9F,0x15,0x70,0x0E,0x05,0x43,0x45,0xF6,0xCD,0x2C,
+	0xD0,0x6F,0xBF,0xC3,0xF1,0x2E,0x86,0x86,0xB4,0x50,0xF5,
+	0xBA,0xDF,0x47,0xA3,0xC5,0x69,0x61,0x7A,0xC0,0xD0,0x87,
+	0xE0,0x78,0xB2,0x57,0x8A,0xBC,0x03,0x2E,0x95,0x76,0xDA,
+	0x78,0x3D,0x0F,0x25,0xEF,0x0C,0xA3,0xD3,0x55,0xA3,0xC0,
+	0x2B,0x30,0xCA,0xDD,0x93,0x49,0x59,0xDD,0x0F,0x82,0x72,
+	0x45,0x5B,0xC7,0x55,0x7B,0xA6,0x60,0x3B,0x66,0xEB,0x0B,
+	0x5D,0x69,0x1E,0x62,0xFD,0x44,0xE2,0xF4,0xBE,0x3D,0xDF,
+	0xCD,0x41,0xFD,0xD7,0xCB,0x90,0x95,0x7D,0x5F,0x98,0x6F,
+	0x7E,0xC5,0x2F,0x0D,0x4B,0xAE,0x74,0x2E,0x53,0x85,0x40,
+	0x20,0x39,0x57,0xFC,0x0B,0x22,0xAB,0xC3,0x9A,0xAC,0xC8,
+	0x9C,0x90,0x23,0x72,0x99,0x17,0x40,0xA7,0xA4,0x2D,0xF5,
+	0xCB,0x3E,0x5A,0xD2,0x41,0x49,0x31,0x7B,0xC8,0xE0,0x8A,
+	0x80,0x63,0x18,0x08,0xFF,0x3D,0x1B,0x89,0x8F,0x25,0x9F,
+	0x5F,0xFD,0x90,0xD7,0x08,0x1F,0xAB,0x17,0x88,0xF7,0xAD,
+	0x2C,0x2F,0xA6,0xB4,0x83,0xA9,0xF0,0x08,0x99,0x1F,0x56,
+	0xA5,0x87,0x96,0x38,0xEB,0x7A,0x02,0x3F,0xE4,0xB2,0xB0,
+	0x95,0x4E,0x9D,0x62,0xA4,0x79,0x73,0xA3,0x02,0x59,0x80,
+	0xFA,0xC6,0x44,0x07,0x48,0x08,0x7C,0x8C,0x86,0x9C,0x82,
+	0xCC,0xD0,0xBE,0xCB,0xD9,0x2E,0x1B,0xEC,0xB5,0x8C,0xCA,
+	0xB5,0x4B,0xCD,0x41,0xA2,0xB2,0xC7,0x21,0xA6,0xDF,0x22,
+	0x89,0x93,0xB1,0x08,0xA4,0x68,0x80,0x8A,0xB8,0x4A,0x69,
+	0x2D,0xF4,0x79,0xC3,0xE1,0x83,0x9D,0x18,0xE6,0x4B,0x96,
+	0x76,0xB8,0x13,0x94,0xCC,0x1A,0x26,0x38,0x1E,0x5C,0x28,
+	0x2C,0x77,0x3D,0x4A,0x5D,0x8B,0x52,0x32,0xE8,0xCA,0xCA,
+	0xA0,0xBC,0xA7,0xDF,0xA3,0xE9,0xA6,0x0E,0x0B,0xB4,0x5F,
+	0x0C,0x4F,0x43,0x0E,0x3F,0x73,0x4B,0x86,0x2E,0xFF,0x97,
+	0x72,0x5D,0x71,0x0E,0xF2,0x95,0xD4,0xF9,0xBE,0xA3,0xD4,
+	0xE3,0x57,0x01,0x49,0xEC,0xE5,0xFB,0x53,0x58,0x74,0x76,
+	0xA0,0xDE,0xBD,0x8E,0xC8,0x86,0x84,0xFE,0xC8,0xFF,0x52,
+	0x5A,0xA0,0x7C,0x18,0x0F,0x3D,0x7F,0x59,0x81,0xD9,0xF8,
+	0xA8,0x5F,0xE9,0xF3,0x7E,0xD0,0x15,0xAE,0x5C,0x42,0x56,
+	0x26,0x4C,0x34,0xE2,0xDF,0xC6,0xF1,0xBD,0xDB,0x1A,0x7A,
+	0xF6,0xA1,0xEC,0xC9,0xFE,0x42,0x21,0x7B,0xA0,0x94,0x6A,
+	0x48,0x73,0x8D,0x5A,0xDD,0xA6,0x0E,0x71,0x5F,0xB2,0x72,
+	0x27,0xB1,0xC0,0xB7,0xCC,0xCD,0x2D,0xE9,0xE3,0x14,0xDD,
+	0x85,0xC0,0x20,0x7A,0x4A,0x61,0xDE,0x2B,0xB6,0xE4,0x8F,
+	0x42,0x7A,0x3A,0xC4,0xFE,0x0B,0x01,0x5E,0x3C,0x5D,0xB3,
+	0xFD,0x86,0x8A,0xDE,0x54,0x4B,0x4C,0x78,0xAF,0x29,0xEC,
+	0x07,0xFF,0xB0,0x44,0xE5,0xC8,0x62,0x43,0x70,0x87,0x85,
+	0xA7,0xD5,0xB1,0x4D,0xDF,0x84,0x38,0xD5,0xEF,0xBF,0x7C,
+	0xD0,0xF2,0xE0,0x49,0x0E,0xFC,0x34,0xAC,0x87,0xC8,0x7E,
+	0x80,0xC3,0x38,0x56,0x97,0x82,0x79,0x51,0x90,0xF1,0x2C,
+	0xD1,0xFE,0x83,0x1C,0xD5,0xD6,0x2E,0xFA,0x71,0x5F,0x8E,
+	0xA0,0xB5,0x65,0x06,0x96,0xD8,0xE1,0x67,0x43,0x8B,0x86,
+	0x69,0xDC,0x25,0xFB,0x69,0x8B,0x15,0x3E,0xAB,0x76,0xCB,
+	0x53,0x14,0x8D,0x30,0xF4,0xC7,0xB7,0x77,0x0F,0x91,0xF3,
+	0x08,0x92,0x1A,0x68,0xB9,0x47,0xD2,0xF0,0x90,0xDD,0x9F,
+	0x88,0x4F,0x50,0x64,0x21,0x88,0x4D,0xFD,0x18,0xBA,0x5C,
+	0xB8,0x0A,0x66,0xB6,0xFC,0x5A,0x90,0xF2,0xEF,0x8F,0x61,
+	0x30,0xE0,0xF8,0xCA,0x3A,0x79,0x1F,0xB1,0x24,0x88,0x7A,
+	0x65,0x06,0xF5,0x51,0x67,0x17,0xB6,0x88,0xAF,0x30,0xA3,
+	0xF0,0xE9,0xFF,0xCF,0xAC,0xC2,0xFF,0xB4,0x39,0xAC,0x3A,
+	0xDB,0xBD,0xC8,0x16,0x63,0xA1,0xE5,0x08,0x59,0xEE,0x44,
+	0xF6,0x7E,0xA7,0x6B,0x40,0xDB,0x68,0x1A,0xDC,0x1F,0xB5,
+	0xD2,0x71,0x37,0x64,0x35,0x76,0xFF,0x89,0x96,0xD4,0x74,
+	0xD7,0xB0,0xB2,0x1B,0xCA,0xF9,0x8F,0x27,0x46,0x3B,0xEB,
+	0x5B,0x23,0x87,0x76,0x86,0x64,0xD5,0x05,0x4F,0x01,0x90,
+	0xD7,0x69,0xE3,0xC0,0xCE,0x46,0x1C,0x0D,0x1C,0x1B,0xE9,
+	0xEE,0x46,0xED,0x0E,0xC9,0x4A,0x13,0xDB,0x59,0x7F,0x0C,
+	0x68,0x2C,0x03,0xAA,0xCE,0x4D,0x42,0xB1,0xFB,0x66,0x0B,
+	0x4F,0x24,0x5C,0xD4,0xE0,0x1B,0x44,0xC0,0x4B,0x6B,0xB5,
+	0xFA,0xAA,0x54,0x19,0xF5,0x0D,0x0A,0x87,0x7B,0xDB,0xDF,
+	0xEC,0xE5,0xD5,0x2F,0x01,0x28,0x82,0xC3,0x77,0x84,0x74,
+	0xD1,0x1B,0xC4,0x58,0x86,0x6C,0xCF,0x7B,0x4A,0xCF,0x7A,
+	0xF6,0xE9,0xD7,0x3E,0x20,0xDE,0xF7,0x12,0xDC,0x05,0xF0,
+	0x18,0x05,0x58,0xBE,0x72,0x19,0x2E,0x37,0x92,0x30,0x97,
+	0xA1,0xC7,0x9A,0x23,0x10,0xB8,0x0E,0x7C,0x6C,0xB9,0x09,
+	0x32,0x3A,0xC3,0xBF,0xC6,0xF6,0x05,0x81,0x60,0x6A,0xE7,
+	0xFE,0x6F,0xC2,0x55,0xA8,0x47,0x78,0x05,0x1A,0xCD,0x8C,
+	0x14,0x39,0x07,0x8F,0xD6,0xBE,0x4A,0xBE,0x81,0x8C,0xA6,
+	0x2A,0x53,0x94,0xD1,0x3D,0xD1,0xC4,0x1E,0xC9,0xCF,0x58,
+	0x0E,0x04,0x8D,0xD5,0x82,0x95,0xC2,0xB6,0xB6,0xA9,0x07,
+	0xF6,0xA5,0x88,0x61,0x28,0xF9,0x65,0xED,0x47,0x7E,0x7E,
+	0x34,0xCE,0xD9,0x9C,0x17,0x77,0xD5,0x66,0xFD,0x93,0x85,
+	0x38,0x57,0x11,0xD6,0x76,0xD3,0xDB,0x9B,0x4F,0xFD,0x15,
+	0xDE,0x31,0x51,0xA6,0xD9,0x7B,0xF8,0x9D,0x96,0xB5,0xDD,
+	0xF5,0xE0,0xB4,0xF4,0x27,0xC8,0xFC,0x5A,0x32,0x41,0xD7,
+	0x4F,0x45,0x4C,0x2B,0x25,0x7E,0xAA,0x00,0x0F,0xB6,0xDB,
+	0xF9,0x28,0xAC,0xC1,0x73,0x79,0x7D,0x3F,0x96,0x21,0x52,
+	0xBD,0xCB,0x8B,0xA8,0xC5,0x0B,0x41,0x5E,0xA2,0x96,0x64,
+	0xFC,0x34,0xA7,0x81,0x58,0xFD,0xC3,0x7B,0x59,0xDF,0xDB,
+	0x35,0xF0,0x59,0xC6,0x7F,0xAD,0x1F,0x18,0xA0,0x24,0xB8,
+	0x87,0x4F,0x6D,0x06,0xC5,0x14,0x47,0x31,0x98,0xCD,0x09,
+	0x9F,0xD5,0x9F,0x5F,0x61,0x99,0xF3,0xF6,0x69,0x0E,0xCB,
+	0x60,0xCC,0xA2,0xC6,0xA9,0xA5,0xB7,0x22,0xB3,0xAF,0xE7,
+	0x9E,0xA6,0x01,0x8C,0xC2,0xD9,0x1B,0xA1,0x50,0xF6,0x6C,
+	0xBD,0x08,0x59,0xEF,0xD8,0xA6,0xEA,0x39,0xC5,0xCD,0xE1,
+	0xA5,0xEE,0x45,0xF6,0x84,0xDC,0xD6,0xC9,0x0D,0xF5,0x63,
+	0x9F,0xA5,0x1A,0xCE,0x98,0x0E,0xCF,0x44,0x6B,0xF9,0x0E,
+	0xAC,0xB9,0x05,0xEB,0x35,0x59,0x18,0x1E,0x0D,0x44,0x39,
+	0x44,0x80,0x2D,0x06,0x56,0x02,0x81,0x16,0x5F,0xC5,0x5A,
+	0xDC,0x40,0x5B,0xED,0x0E,0x45,0xC0,0x4B,0x82,0x28,0x3A,
+	0xF0,0xD6,0x67,0x43,0x5E,0x3C,0x5E,0x77,0xB2,0x99,0x2B,
+	0x8A,0x31,0x89,0x8F,0x99,0x9D,0x42,0x6B,0x0B,0xA4,0x42,
+	0xBE,0x1E,0xFD,0x89,0x3F,0xE5,0x24,0x6E,0xDF,0x70,0x25,
+	0x69,0x7E,0x81,0x0A,0xFF,0x6D,0xFB,0xD5,0x7F,0x73,0xA7,
+	0xFD,0xC0,0xDB,0x6E,0xD5,0xE9,0xC8,0x45,0x8D,0x6E,0x7D,
+	0x96,0xF0,0x97,0x0C,0xC9,0x97,0xE4,0x01,0x90,0x00,0xE4,
+	0x3C,0xEC,0xE0,0x46,0x74,0x20,0x32,0x84,0x54,0xF1,0x56,
+	0xE3,0x8E,0x39,0x75,0x8D,0xE4,0x6A,0x1C,0xAE,0x86,0x20,
+	0x4C,0x45,0xFD,0x93,0x02,0xD7,0xA4,0xFC,0xAD,0x72,0xB8,
+	0xBE,0xE2,0xF8,0xE1,0xFC,0xDA,0x9A,0xA1,0xB0,0x31,0x4B,
+	0xF3,0xDB,0x42,0x19,0x5A,0x6A,0xAB,0x58,0x99,0x83,0xF0,
+	0x40,0x82,0x92,0x5E,0xA0,0x70,0x72,0xFB,0xF3,0xF3,0xE4,
+	0x07,0xE1,0x37,0x1F,0x85,0x07,0x08,0xEB,0x56,0x77,0xD7,
+	0xEE,0x7F,0x5C,0xDB,0x10,0x9A,0xC5,0x7C,0xFF,0x5D,0xD6,
+	0x34,0xEA,0x86,0xB8,0x11,0xE1,0xB1,0x31,0xC2,0x46,0x25,
+	0x73,0x0D,0x3B,0xD9,0x21,0xBB,0xFB,0xC2,0x81,0x2C,0x39,
+	0x6E,0x2F,0x59,0xD2,0xEB,0x50,0x2D,0xCC,0x76,0x89,0x68,
+	0x86,0x7E,0x7F,0x08,0x35,0x53,0xF9,0xE2,0xB1,0xBF,0x42,
+	0xCF,0x56,0x0E,0x7A,0x70,0x9F,0x6F,0x85,0x6E,0x7F,0x9E,
+	0x82,0x7B,0x91,0x18,0xFE,0xE2,0x31,0x7C,0x82,0xBE,0x7B,
+	0xE5,0x31,0x4B,0x94,0x89,0x45,0x05,0xE0,0x48,0x70,0x11,
+	0xCA,0x68,0x35,0xFD,0xC3,0xEF,0x11,0x11,0x61,0x27,0x16,
+	0x4D,0x0A,0x31,0x33,0xDB,0x7E,0x76,0x09,0x3D,0x5C,0x33,
+	0x26,0xF9,0xB6,0xE1,0xAD,0x44,0xC1,0xF9,0xFD,0xC9,0x98,
+	0xA7,0xF1,0x62,0xDA,0x2A,0x04,0x52,0x46,0xA6,0x77,0x28,
+	0x26,0x35,0xB1,0x99,0x43,0xDA,0x70,0x65,0x29,0x35,0xE8,
+	0x5F,0x6C,0xDF,0x67,0xE9,0x15,0xF0,0x12,0x71,0x23,0x0B,
+	0xF6,0xB6,0x52,0x4E,0x52,0xFD,0xC8,0x16,0xFB,0xEC,0xC6,
+	0x35,0x85,0x43,0x69,0x22,0x11,0xF9,0x84,0x62,0x5C,0x57,
+	0xE4,0xE0,0x65,0xAE,0x88,0x14,0x6B,0x68,0x48,0x3E,0x63,
+	0xE8,0x9D,0xCD,0xD5,0xDB,0x1C,0x9B,0x99,0xE3,0x23,0x8F,
+	0x27,0xF9,0x69,0x20,0xB9,0x0C,0x54,0x29,0xD2,0x8A,0x2A,
+	0x9C,0xBB,0x99,0x68,0x5D,0xFD,0xDC,0x35,0x1D,0x12,0xAA,
+	0x80,0x91,0x30,0xAF,0x91,0x88,0x76,0xF0,0x4A,0x77,0x0C,
+	0xCC,0x11,0xF8,0x18,0x37,0x1B,0xEE,0xF4,0x8C,0x6C,0x8F,
+	0x6A,0x80,0x1E,0x29,0x8E,0xD8,0xE6,0x61,0x42,0x92,0xD1,
+	0xC0,0x5F,0x7E,0x72,0xF4,0xA6,0x1C,0xDB,0x0D,0x38,0xC1,
+	0x95,0x38,0xE7,0xC6,0x4E,0x27,0x52,0x5F,0x41,0x25,0xA3,
+	0x3F,0xBA,0x2F,0xC0,0xA2,0x8D,0xE2,0x38,0x8C,0xE3,0x4B,
+	0x56,0x26,0xC7,0x50,0x28,0x9E,0x9F,0x0F,0xD2,0x2C,0x55,
+	0xC2,0x3B,0x7D,0x67,0x32,0x50,0xEE,0x95,0x2A,0xB9,0x0F,
+	0x95,0xBC,0xBE,0x93,0x86,0xB4,0xCC,0xC0,0xA4,0x35,0x56,
+	0xC7,0x70,0x53,0x5B,0x42,0x77,0x76,0x52,0x55,0xBB,0xB3,
+	0x76,0x4E,0x7F,0xDA,0x51,0x29,0x71,0x01,0x7C,0x59,0x69,
+	0xF7,0x3E,0x84,0x72,0x24,0xB4,0x7F,0x58,0xED,0xAB,0x4B,
+	0x63,0x1E,0x3E,0x94,0x74,0x69,0x07,0xCB,0x6C,0xB4,0x48,
+	0xDD,0x01,0xDA,0x1D,0x5B,0x79,0xE1,0x5B,0xBD,0xD5,0x02,
+	0xEF,0x38,0xDF,0x0F,0x6F,0xE7,0xC8,0xE4,0x75,0x0A,0x70,
+	0xFD,0x86,0x98,0x49,0xB4,0xE0,0x76,0x5A,0x2E,0x49,0xDA,
+	0x17,0xB4,0x3E,0x34,0x83,0xBD,0x1C,0x7D,0x2C,0x35,0xB6,
+	0x31,0xC0,0x16,0xCC,0x68,0xC8,0x27,0xB2,0x7C,0x71,0xED,
+	0x22,0xF3,0xB7,0xA0,0xA3,0xFF,0xCE,0x61,0xCF,0x43,0x05,
+	0xD9,0x93,0xBE,0xD9,0xDD,0xDE,0xD0,0xB6,0x1D,0x91,0xB7,
+	0x35,0x10,0x9E,0xB5,0xC9,0x1F,0x43,0xD4,0xBF,0xA5,0x1A,
+	0x38,0x21,0xD6,0xCF,0x47,0xEA,0xEE,0x5B,0x83,0xF3,0x96,
+	0xE7,0xC5,0xA3,0x2D,0x04,0xB1,0x3C,0xC3,0xF5,0xB2,0x56,
+	0x96,0xF9,0x23,0x20,0xC3,0x3C,0xF5,0x39,0xFB,0x6E,0xC6,
+	0xC5,0x37,0xC3,0x6B,0xEE,0xB8,0x88,0x6F,0x74,0xBF,0xC1,
+	0x9F,0x37,0x09,0x27,0x8D,0x85,0x6F,0xF5,0x67,0x68,0x5A,
+	0x6A,0x4D,0x35,0x8A,0x14,0x3A,0x45,0x3D,0xD0,0x31,0x52,
+	0xDC,0xF3,0x16,0x11,0x45,0x74,0x47,0x8D,0x3B,0xFF,0x43,
+	0x00,0x48,0xA1,0x10,0x42,0x91,0x92,0x96,0x13,0x57,0x4C,
+	0x57,0x9F,0x7B,0x61,0x6D,0xE1,0xD9,0x8E,0x10,0xA4,0xB0,
+	0xB9,0x4E,0xD7,0x2D,0xB1,0xBB,0x70,0x41,0x25,0x3A,0x29,
+	0x4C,0x5D,0x11,0x9E,0x72,0x82,0xD7,0x78,0x5F,0x9D,0x12,
+	0x34,0x9F,0x07,0x2C,0x98,0x8C,0xA3,0x4E,0x71,0x22,0x9E,
+	0x1F,0xFC,0x4C,0xE4,0x04,0x5D,0xA0,0x14,0x7D,0x3E,0x78,
+	0x41,0x2D,0x6F,0xBC,0x68,0xC2,0xBD,0x13,0x8B,0x0B,0x11,
+	0xD6,0x9D,0x7C,0xCD,0xFC,0x32,0xCD,0x31,0x71,0xAE,0x6C,
+	0x46,0xDF,0x95,0x7D,0xC0,0xF0,0x7A,0xE1,0xDC,0xA4,0xD6,
+	0x16,0x29,0x5A,0x46,0xCA,0x1E,0x8A,0xF8,0x73,0x75,0x06,
+	0xFC,0x34,0xE7,0x13,0x4E,0x45,0xC6,0x15,0x22,0x6B,0x51,
+	0x18,0x9D,0x1D,0xDD,0x35,0xB2,0x0E,0x32,0x83,0xFB,0xE8,
+	0xD8,0x17,0x5C,0xDE,0xCE,0x55,0x8C,0x5D,0x94,0x76,0x57,
+	0x1E,0xD5,0xB9,0x2A,0xC9,0xB7,0x63,0x4A,0x46,0x29,0x43,
+	0xB5,0xD5,0x35,0x63,0xDF,0xDD,0x26,0xEF,0x33,0x53,0x58,
+	0x54,0xBC,0x2B,0xF9,0x26,0xA6,0xE7,0x8D,0xDD,0xFD,0xDB,
+	0xC5,0xF5,0xF0,0xBD,0xDD,0x2E,0x19,0xA7,0x37,0x51,0x13,
+	0xAE,0x11,0x16,0xE8,0x40,0x33,0xEE,0xBD,0x79,0xD9,0xFD,
+	0x8F,0xBC,0xA4,0xAF,0xCA,0x92,0x74,0x1B,0x48,0xA6,0x43,
+	0x84,0x6B,0xD5,0x0A,0x85,0xD4,0x95,0x58,0x7C,0xA4,0x41,
+	0x14,0x8C,0xCA,0xF0,0x67,0x9C,0x3C,0x2F,0x31,0x34,0xAF,
+	0x78,0x1E,0x38,0xBC,0xE5,0x75,0x02,0xBB,0x98,0x34,0x7B,
+	0x02,0x67,0xDA,0x1E,0x23,0xBC,0x59,0x17,0x06,0xD2,0xA8,
+	0x96,0x1A,0x87,0x58,0xF3,0x72,0xBF,0x6C,0x5F,0x47,0x5B,
+	0xE7,0x09,0xFD,0xCE,0xF6,0xA2,0xBC,0x75,0x11,0x42,0xB1,
+	0xCF,0x53,0xAD,0x9B,0x58,0x98,0xB3,0x6F,0x02,0x29,0x8A,
+	0xD5,0x72,0xFE,0xC7,0x28,0x66,0xD7,0xE4,0x9A,0xA4,0xCE,
+	0x0A,0x50,0x07,0x8C,0xBA,0xEA,0x00,0x5E,0xA1,0xF8,0x12,
+	0x28,0x5F,0x24,0x34,0xBD,0x08,0xF6,0x58,0x8D,0x1B,0x09,
+	0x94,0x81,0xA9,0xA8,0xAA,0x38,0x65,0xB2,0xC2,0x6E,0xEA,
+	0x1B,0xF2,0xEE,0x23,0xF6,0x3F,0x6A,0x77,0xE4,0x15,0xC7,
+	0x58,0x06,0x61,0x31,0xE4,0xC3,0x7B,0xC8,0x05,0xA9,0x35,
+	0xD5,0x3B,0x52,0x5C,0xF9,0xDC,0xC3,0xC8,0x12,0x64,0xE0,
+	0x48,0x16,0x7A,0xD7,0xC9,0xB5,0xD0,0x2B,0xD0,0x7D,0xA0,
+	0x87,0x9F,0xBE,0x26,0xE4,0xDC,0x1B,0x1D,0x1F,0xE2,0x5E,
+	0xF7,0x13,0x30,0x9A,0x7E,0x91,0x0A,0x09,0xF8,0x51,0x46,
+	0x8D,0xC6,0x7E,0x17,0x03,0x39,0x0F,0xA5,0x6C,0xC7,0xA9,
+	0xB6,0x92,0x51,0x7A,0x0D,0xF2,0x8C,0x30,0xC8,0x09,0x45,
+	0xA9,0x44,0xBE,0xFC,0x2E,0x2F,0xAD,0xAA,0xF7,0x5D,0xD0,
+	0x71,0x07,0x93,0x07,0xBF,0x0C,0x5A,0x15,0xE9,0xA5,0xA7,
+	0xCE,0xBD,0x87,0xF4,0xB6,0x0A,0xA5,0x37,0x52,0xDE,0x81,
+	0xEC,0xA3,0x99,0xC5,0xE8,0x67,0x22,0x8E,0x3F,0x83,0x99,
+	0xE3,0x9C,0x15,0x4E,0x36,0xA9,0x0D,0xBD,0x9C,0x53,0xD7,
+	0x36,0x2B,0xCD,0x4C,0x8A,0x7A,0x29,0x60,0xBA,0xC3,0x4B,
+	0xEA,0xB4,0xD5,0x46,0xD3,0x8E,0xAF,0xFD,0x56,0x87,0x16,
+	0x9B,0xEC,0x99,0x1F,0x3B,0x06,0x3F,0xF4,0x66,0x0B,0x37,
+	0x71,0x6E,0x6D,0x5F,0xE5,0xCA,0xAB,0x25,0x09,0x3B,0x18,
+	0xBC,0xE8,0x6F,0xAB,0x43,0xD0,0x9E,0x06,0xB1,0x6E,0x5C,
+	0xA4,0x91,0x3F,0xA7,0xD9,0xFA,0x9A,0xE5,0xB3,0x40,0x3F,
+	0x98,0xC3,0xB7,0xF5,0x8E,0x0D,0x77,0x8A,0x91,0x94,0x1C,
+	0xF4,0xFA,0xD6,0x0E,0xCE,0x7C,0xB7,0x19,0x94,0x21,0x05,
+	0xAD,0x06,0xA9,0xD0,0x51,0xD2,0x85,0x91,0x68,0x5B,0xD1,
+	0x10,0x8F,0x2C,0x7E,0x02,0x51,0xFF,0x28,0xE1,0x4B,0xDA,
+	0x11,0x67,0x01,0x7E,0x5C,0x54,0x83,0x04,0xD2,0x7E,0x71,
+	0x1F,0x7A,0xCE,0x43,0x16,0x3A,0xB7,0x42,0x7E,0xB6,0x46,
+	0x03,0xA9,0xC6,0xDD,0x6E,0xAF,0x48,0x29,0xBF,0xB1,0x2C,
+	0x7D,0x85,0x33,0x11,0xAB,0xA7,0x1E,0x3B,0xCF,0xC1,0x0A,
+	0xF0,0x6E,0xC5,0x79,0xFB,0x9A,0x10,0xC2,0xEF,0x1B,0x66,
+	0xA1,0xED,0xCC,0x73,0x59,0x30,0xD2,0x00,0x71,0x94,0xE0,
+	0x4D,0x68,0xC5,0xCD,0xAA,0xA4,0x3E,0x73,0x35,0x9F,0x40,
+	0x12,0xA5,0x41,0x43,0x8C,0x0A,0x84,0x8C,0x46,0xD1,0x74,
+	0x71,0xE4,0xF0,0xF0,0x70,0x63,0xC8,0xA8,0x15,0x68,0xF0,
+	0x37,0xE1,0xA2,0xBE,0x1D,0xA2,0x57,0x73,0x0A,0x87,0xD1,
+	0xD3,0xAE,0x16,0x45,0xB2,0xBC,0x23,0x52,0x95,0x57,0x40,
+	0xCC,0x7E,0x86,0xD4,0x8C,0x29,0xF7,0x46,0x1E,0xDA,0x19,
+	0x55,0x69,0xFA,0xB8,0x71,0xBF,0x9B,0x20,0xC9,0x23,0xB9,
+	0x3C,0x90,0xE4,0xD8,0x09,0x3D,0xA0,0x69,0xD7,0xC2,0x24,
+	0x1D,0xC1,0xF0,0x94,0x57,0x22,0x58,0xAB,0xB5,0x2B,0xAD,
+	0xAB,0x16,0x4B,0x9F,0x41,0xE0,0xE1,0x95,0x5C,0x2F,0x7F,
+	0x02,0xA3,0xA1,0x48,0x6E,0x36,0x72,0x77,0xA9,0xD5,0x4A,
+	0x64,0xB5,0xB1,0x8C,0x61,0x31,0xFC,0xDE,0x37,0xCC,0x19,
+	0x40,0x24,0x29,0x20,0x67,0xC8,0x76,0x54,0x98,0xE8,0x7D,
+	0x7B,0xA8,0xEB,0x82,0x78,0x02,0x31,0xF8,0xDB,0x86,0xE9,
+	0xD8,0xF9,0x4C,0xFC,0xFC,0xFD,0xE9,0xB5,0xEB,0xF4,0x6D,
+	0xD9,0x68,0xDA,0x23,0x2C,0x2A,0x28,0xEB,0xF8,0x6F,0x9B,
+	0x64,0x34,0x75,0xE6,0x3F,0xF0,0x78,0xE7,0x65,0xCD,0x5B,
+	0xEA,0xF7,0xF6,0x5E,0x50,0xCF,0x1B,0x46,0x77,0xED,0xD1,
+	0xBB,0x41,0x63,0xFC,0xDF,0x97,0x04,0xC2,0xAB,0xCA,0xFE,
+	0x01,0x07,0x9A,0x38,0x79,0xB1,0x29,0x8E,0x86,0x6F,0x79,
+	0xB7,0xBA,0x43,0xBA,0x34,0x7E,0x03,0x83,0x73,0xF7,0xF7,
+	0x3E,0xED,0x07,0x25,0x10,0x5D,0xD0,0x7B,0xD9,0xFC,0x3B,
+	0x55,0xD9,0x81,0x19,0xDD,0x16,0x6E,0xC5,0x39,0x7F,0xAD,
+	0x66,0x03,0xA4,0x04,0x41,0xC0,0x6D,0x28,0xEB,0x16,0x29,
+	0x4D,0x9C,0x0D,0x5E,0x2E,0xBA,0xE3,0x96,0x14,0xBC,0x3F,
+	0xFA,0x91,0xA6,0x44,0xA5,0xD1,0x00,0xD6,0x45,0x2E,0xC3,
+	0x27,0x10,0x41,0xFE,0xF5,0x04,0x9A,0xAF,0x69,0xA5,0x0B,
+	0x26,0x4C,0x89,0xA1,0x94,0xAB,0xF4,0x6F,0xD7,0xC9,0x55,
+	0xF5,0xDC,0x7F,0x6A,0x45,0x13,0x1B,0xBB,0x82,0x73,0x7C,
+	0xFD,0xB3,0x48,0xB9,0x33,0x28,0x7D,0x3F,0xBC,0xEC,0xEB,
+	0xC7,0x8C,0x39,0x92,0xD6,0x53,0x0D,0xAD,0xC4,0x57,0x4E,
+	0xC0,0xDB,0xAD,0xA8,0xB6,0xEF,0xE8,0x03,0xA6,0x47,0x84,
+	0x22,0xFE,0xF0,0xFD,0x28,0xF7,0x13,0x98,0xC2,0xFC,0xEF,
+	0x6D,0xB8,0xAD,0xD3,0x70,0x65,0x22,0x7F,0x26,0xE5,0x8A,
+	0xD9,0xDB,0x94,0x26,0xB3,0xCE,0x14,0x56,0x1F,0x84,0xDB,
+	0xE4,0xCF,0x5C,0xC1,0x00,0x3F,0xC6,0x1F,0xE0,0xF4,0x42,
+	0xC7,0x6F,0x84,0x5B,0x08,0xC3,0x77,0x93,0x5D,0xF7,0x1A,
+	0xF0,0xD6,0x6E,0x03,0xAB,0xE4,0x85,0x75,0x70,0x4A,0x9C,
+	0x37,0x54,0xAC,0xEE,0xB9,0x68,0xE6,0xA0,0x95,0x9B,0x7A,
+	0xB3,0xDE,0xF7,0xFA,0xF1,0x2A,0x20,0x49,0x61,0x2A,0xBE,
+	0x14,0xA8,0x02,0x2E,0x6C,0x10,0xC9,0xAF,0xBA,0x21,0x32,
+	0xCB,0x8F,0x6A,0x5F,0x62,0xB1,0xCB,0x8C,0x95,0xDA,0xE5,
+	0xEE,0x95,0xA1,0xFF,0x12,0x9D,0x5B,0xF3,0x29,0x46,0x95,
+	0xDF,0xDB,0x94,0x8E,0x3C,0x56,0x3A,0x59,0x88,0x78,0x53,
+	0x74,0xEE,0x60,0x46,0x0E,0x3B,0x94,0x53,0x37,0xE5,0x23,
+	0xD6,0xDD,0xD8,0x8A,0xF2,0x61,0x25,0xF5,0x6A,0xA4,0x33,
+	0xFF,0x17,0xD9,0x7E,0x4B,0x3B,0x90,0x47,0x44,0x61,0x59,
+	0x0A,0x7A,0x23,0x1D,0x0B,0xF1,0xCF,0x2A,0x25,0x16,0xA2,
+	0x1A,0x60,0x34,0xF3,0x08,0xB6,0x06,0x41,0x4D,0xEC,0x37,
+	0xE8,0xD8,0x2F,0x2C,0xBC,0xFF,0x12,0x6C,0xAB,0x61,0xF6,
+	0xCD,0xDA,0xBA,0x6B,0x5E,0x55,0xC6,0xAF,0x4C,0xD9,0xA8,
+	0x5B,0x53,0xAE,0xF9,0x55,0xD4,0xEF,0x77,0x17,0xF6,0xB2,
+	0xEE,0xBE,0xDE,0xD8,0xDA,0x33,0x1F,0x0F,0x8B,0x23,0x61,
+	0x4D,0xC4,0xD0,0x55,0x14,0x6F,0xC2,0x75,0x13,0xD7,0x55,
+	0xDF,0x15,0x6E,0x4C,0xA9,0x35,0xD1,0x00,0x1D,0x83,0xD7,
+	0x18,0xB6,0xDB,0xF1,0x65,0xB8,0xA5,0xA5,0x81,0x6A,0x97,
+	0x0D,0xD9,0x6B,0xA0,0x02,0x4E,0x62,0xC3,0xF7,0xBC,0xC2,
+	0x39,0x29,0xD3,0x4A,0x0F,0x06,0x3B,0x7A,0xE5,0xC7,0x52,
+	0xB8,0xA0,0x0C,0x11,0x69,0x6F,0x82,0xC0,0xCF,0xA5,0x2E,
+	0xE8,0x05,0xE7,0xEB,0x21,0x4D,0xA2,0x95,0xBA,0x2F,0x1B,
+	0x1E,0xF9,0xB9,0xBC,0x53,0x98,0x1B,0x7D,0x67,0x3D,0xB6,
+	0x42,0xEE,0x62,0xE9,0xD2,0x5A,0x14,0xE5,0x0E,0xE1,0xB8,
+	0x43,0x7D,0x50,0x5C,0xB9,0x41,0xE7,0x08,0xD9,0x5F,0x04,
+	0xBD,0x0C,0x7C,0x22,0xFA,0xC8,0x36,0xDC,0x58,0x56,0x6E,
+	0x74,0x34,0xAA,0x18,0xEA,0x54,0xC7,0x22,0x25,0xF7,0xFD,
+	0x62,0xE7,0x64,0xE3,0xDB,0xEF,0xE6,0x6F,0xF2,0x4C,0x40,
+	0x2D,0xBB,0x2E,0x08,0x8E,0x22,0x86,0xEA,0xB4,0xCD,0xFE,
+	0x10,0x04,0x43,0x46,0xF2,0x1A,0x0F,0xEF,0x82,0xFC,0x3D,
+	0xFA,0x34,0xD8,0xE6,0xEA,0x80,0x0D,0x55,0xB7,0x75,0x87,
+	0xFE,0x72,0xB3,0x1A,0xD4,0x97,0x59,0x33,0xA8,0xAD,0xC7,
+	0xBE,0x6A,0xB2,0x0B,0x6C,0x15,0xEB,0x85,0x0B,0xF7,0x90,
+	0x54,0x30,0x1B,0x83,0xD2,0xDC,0xCF,0xB7,0xAB,0x6D,0xEF,
+	0x96,0xE5,0x48,0xC3,0xD9,0xF2,0x80,0xAE,0xA7,0x63,0x85,
+	0x5E,0xED,0x9D,0x63,0xFB,0xC9,0x62,0xBE,0x0F,0xC8,0x8F,
+	0xDE,0xF4,0xC7,0x00,0x05,0x55,0xFA,0x1E,0x05,0x59,0x18,
+	0xB5,0xB1,0xE8,0xC5,0xA3,0xC5,0xDD,0xB1,0x12,0xA5,0x91,
+	0x51,0x24,0x22,0x4D,0x6F,0xFA,0x2E,0x31,0xB2,0xEC,0x3C,
+	0x21,0xF2,0x4A,0x36,0x4A,0x2F,0xBB,0x46,0xA3,0x75,0xDE,
+	0x4C,0x1F,0xC8,0xD8,0xCB,0x0A,0xB8,0x9C,0x2D,0x78,0xAC,
+	0x61,0xA0,0x5E,0x11,0x42,0x60,0xA8,0xDE,0xCA,0xAD,0x9F,
+	0x1E,0xA0,0xE2,0xC2,0x47,0x03,0x1D,0x88,0xAE,0x07,0x63,
+	0x5B,0xC9,0xE4,0xCF,0xFE,0x38,0x8F,0xDB,0xBA,0x7D,0xB6,
+	0x44,0xD3,0xE8,0xBE,0x98,0x2D,0x8E,0x58,0xB7,0xB4,0xF4,
+	0x06,0x27,0x29,0x3C,0x67,0x7D,0x32,0x40,0x40,0x2C,0xC9,
+	0x4B,0x35,0x89,0x3C,0x2C,0x1E,0x8A,0x4E,0xDF,0x37,0x4C,
+	0x37,0xE6,0x48,0x58,0xC5,0x96,0x11,0x4D,0xAE,0x13,0xAC,
+	0x42,0xAF,0xDB,0x97,0x74,0x6A,0xF7,0x94,0x0F,0xF0,0x88,
+	0xC9,0x4D,0x20,0x20,0x99,0x61,0x2E,0x16,0x1E,0x57,0x41,
+	0xFD,0x8A,0xF3,0x1F,0x78,0x7A,0x97,0xBA,0xE7,0x80,0x4F,
+	0x49,0xAE,0xF3,0x69,0xEA,0x5E,0x6D,0xCB,0xD4,0x42,0x86,
+	0x66,0x73,0xE6,0x11,0x67,0x82,0xF6,0xD0,0x4B,0x8E,0xC3,
+	0x09,0xE3,0x60,0x01,0xDA,0x10,0x2C,0x32,0x5C,0x09,0x5F,
+	0x85,0x7D,0xFB,0x51,0xB8,0x4C,0xE5,0xF5,0x8D,0x8D,0xA3,
+	0x2F,0xE3,0x86,0x6B,0x47,0xFA,0x86,0x47,0xBA,0xA3,0x89,
+	0x7B,0x17,0x1E,0x21,0x03,0xBE,0x6B,0x48,0xBD,0xE2,0x50,
+	0xF2,0x2F,0xC9,0x2F,0xE5,0x3E,0x24,0xC0,0x1D,0xFB,0x5B,
+	0x9E,0x3C,0x86,0xB9,0x7F,0xE1,0x40,0x6B,0xC2,0x44,0x90,
+	0xC9,0xDE,0xA4,0x56,0xB5,0x74,0x53,0x7F,0xF3,0xDF,0x05,
+	0x92,0x1F,0xD2,0x07,0xF0,0x7B,0xF6,0xA5,0x22,0x0F,0x14,
+	0xCD,0xCE,0x9D,0xD0,0x42,0x36,0x8A,0x07,0x44,0x27,0x99,
+	0x04,0x20,0x47,0x35,0x4F,0x9C,0x3D,0x6A,0x55,0xD5,0x7B,
+	0x26,0x8C,0x90,0xE8,0xD0,0x92,0xB4,0xA5,0x85,0x93,0x4C,
+	0x21,0x16,0x44,0xF4,0x56,0xA5,0xF5,0x4B,0x16,0x11,0x2A,
+	0xE8,0xE6,0x9E,0x81,0x55,0xDF,0x19,0x07,0xA0,0xB5,0xBE,
+	0xFD,0x33,0xBD,0xA0,0x6F,0x89,0x70,0x4B,0x7A,0x4C,0x7F,
+	0xA4,0x61,0xF6,0xA5,0xBC,0x1B,0xF2,0x0B,0x65,0x08,0x62,
+	0x60,0x7E,0x76,0x9C,0xB0,0xB3,0xEC,0x1A,0x39,0x4A,0x96,
+	0xB7,0xE9,0x1F,0xD2,0x31,0xF1,0x6F,0x59,0xE2,0xC7,0xAA,
+	0x06,0xDC,0x7B,0xB5,0xE2,0x3D,0x2B,0x52,0x04,0x36,0xD6,
+	0x39,0x9B,0xD1,0x20,0x3C,0xE7,0x37,0xAB,0x6A,0x59,0xFB,
+	0xCB,0x56,0xB2,0xBC,0xDE,0x23,0x7F,0xB5,0x95,0xFD,0x73,
+	0xBC,0xD7,0x8D,0xBD,0x63,0x7A,0x05,0x32,0x2C,0x1D,0x01,
+	0xBA,0x5C,0x80,0x78,0xF7,0x20,0x16,0x8E,0x0F,0xA0,0x8F,
+	0xFF,0xB3,0xD9,0xB6,0x9A,0x3A,0xB4,0x13,0x3B,0xC8,0x18,
+	0x48,0x8C,0x1C,0xB8,0x99,0x75,0x0D,0x32,0xC0,0x56,0x3A,
+	0x61,0xD9,0xC1,0x0B,0xBC,0xD0,0x84,0x49,0x11,0x07,0x03,
+	0xD6,0xAA,0xC5,0x1B,0xAE,0x7A,0x47,0x54,0x1B,0x21,0x97,
+	0x8E,0x77,0x8A,0x57,0x53,0x1B,0x2E,0xFB,0x0B,0x29,0xAC,
+	0xEC,0x06,0x73,0x25,0x09,0x1F,0x61,0x13,0x3F,0xC7,0x8E,
+	0x8E,0xAB,0xF5,0x20,0x93,0xC6,0xF9,0xA7,0xC7,0x78,0x2A,
+	0x52,0x28,0x96,0xFA,0x67,0xDE,0x06,0xEC,0xB2,0xF7,0xE1,
+	0xA8,0x8A,0xE7,0x8F,0x61,0x2C,0x09,0xA4,0x02,0x7A,0xEB,
+	0xA9,0xFB,0xA7,0x2D,0xDA,0x49,0x7F,0xB0,0x44,0xCB,0x67,
+	0x8B,0x70,0x98,0x08,0x31,0x5F,0xA8,0x1F,0x3C,0xB5,0x5C,
+	0xAB,0xF4,0x03,0x7C,0x2A,0x4E,0x55,0x92,0x12,0x9F,0x10,
+	0x04,0x28,0xC9,0x8F,0xE7,0x41,0xA9,0x01,0x4A,0xAA,0x3D,
+	0x78,0x20,0xF6,0xB2,0xD2,0xF3,0x58,0x18,0x8B,0xBC,0xE0,
+	0x4E,0x62,0x6B,0x7C,0x8A,0x64,0x63,0x4E,0x3A,0x41,0x53,
+	0x94,0x7E,0x28,0x3A,0x8E,0x67,0x9A,0xF4,0xBF,0x56,0x92,
+	0x13,0x51,0x9F,0x5A,0xB8,0x64,0xF5,0x2B,0x71,0xD3,0xBB,
+	0x3A,0x4B,0x16,0x98,0x6C,0x2B,0x21,0xAF,0x03,0x7D,0x32,
+	0xED,0xCD,0x9B,0xB4,0x0D,0x27,0xF2,0x47,0xBB,0xBB,0xE5,
+	0x9B,0xF7,0x83,0xDF,0xE7,0x4F,0x1A,0x23,0x94,0x46,0x5B,
+	0xA3,0x59,0xB5,0x08,0x12,0x98,0x34,0x10,0x42,0xC8,0x22,
+	0xAA,0xAE,0x8D,0x63,0xD4,0x8F,0x6B,0x33,0x90,0x23,0xC3,
+	0xA1,0x7A,0xC3,0x1E,0x07,0x49,0xB2,0xB7,0x4D,0x26,0xA6,
+	0x21,0x89,0x0F,0x1A,0x2E,0x2E,0xFA,0x2C,0x05,0x2F,0x15,
+	0xE3,0x16,0x05,0x9C,0x1A,0xA9,0x66,0xE2,0xE6,0x83,0x8B,
+	0xEE,0x76,0x60,0xA2,0x84,0x16,0x59,0xF9,0xA8,0xD0,0xAB,
+	0x23,0x2E,0xC0,0x22,0x34,0x81,0x62,0x19,0x5F,0x29,0x54,
+	0x13,0x44,0x38,0x8F,0x58,0x38,0x02,0x59,0x90,0xAB,0x03,
+	0xD5,0x64,0x5D,0x75,0x8D,0x0D,0xC5,0xF5,0xC0,0xBE,0x99,
+	0x69,0xF9,0x08,0x91,0x4E,0x57,0x60,0x89,0x09,0x52,0x35,
+	0x4A,0xC6,0x7A,0x5D,0x23,0xAC,0x94,0x40,0x0A,0xCC,0xC5,
+	0x16,0xD4,0xB6,0x0C,0xB0,0x2C,0xAB,0xDC,0xC9,0xCB,0xB1,
+	0xAD,0xCE,0x56,0x36,0x71,0xD0,0xB2,0x1C,0xE7,0x48,0xD9,
+	0x47,0x50,0xA3,0x2A,0x80,0xEE,0xFF,0x65,0x9E,0x4F,0x91,
+	0x30,0xF8,0xDD,0xBE,0x6B,0x01,0x5F,0x5D,0xB3,0xC5,0xEF,
+	0x2A,0x25,0xF4,0x0F,0xEA,0x47,0x52,0x9A,0xAE,0xFD,0x0B,
+	0x9E,0xCF,0xFD,0x4A,0xF8,0x5A,0x31,0xF8,0xA3,0x96,0x35,
+	0xDF,0xFD,0x15,0xB1,0x2C,0x9E,0xC8,0x3A,0x21,0x8E,0x62,
+	0xB1,0x26,0x4E,0x49,0xC4,0xA8,0xFF,0x53,0x08,0xB0,0xA1,
+	0xF9,0xA9,0xCA,0x32,0xC0,0x42,0xAE,0xFD,0x13,0x85,0x3E,
+	0xC9,0x0F,0xDC,0x75,0x27,0x09,0xBB,0xCA,0x7E,0x85,0x08,
+	0x35,0x6C,0x63,0xED,0xBA,0x8F,0x4B,0x7F,0x90,0xAC,0x7C,
+	0x84,0x02,0xAE,0xE5,0xE2,0xFA,0x32,0xE2,0x7F,0xFB,0x87,
+	0x2A,0xB0,0xF7,0x1F,0xFD,0x84,0x9F,0xE4,0x0F,0xAE,0x37,
+	0x11,0xC6,0x91,0xDD,0xEB,0x39,0x00,0x21,0x41,0x95,0xC8,
+	0xD8,0x17,0x9A,0xDC,0x10,0x94,0x6C,0x6F,0xBC,0x8D,0xF2,
+	0xFD,0x73,0xC1,0xE3,0x62,0x2B,0xFF,0xE1,0xB1,0xE1,0x0B,
+	0x10,0x85,0x66,0x38,0x6C,0x4C,0x52,0xF4,0x6B,0xF2,0x97,
+	0xEB,0xEF,0x89,0xC9,0x88,0xD5,0xAC,0xB5,0x03,0x62,0x74,
+	0x60,0x98,0xD4,0xA3,0x1B,0xBD,0x87,0xE3,0xF9,0x66,0x2D,
+	0xC4,0x26,0xFF,0x1E,0xE4,0xDB,0x15,0xD9,0x9B,0x6A,0x42,
+	0x5B,0x31,0x76,0x03,0x77,0x1E,0x0E,0x6E,0xC4,0xCC,0x78,
+	0x92,0x70,0x8A,0x2A,0xEF,0x3A,0xB3,0x03,0x97,0x2D,0x5D,
+	0x9F,0xD8,0x82,0x9A,0x4B,0x59,0xAE,0x01,0x07,0x42,0x2A,
+	0xB4,0x24,0x20,0x27,0x9A,0xA4,0x18,0x33,0xB8,0xAA,0xD0,
+	0x97,0x5A,0xA8,0x05,0xA0,0x1A,0x4C,0xAE,0x6E,0xB3,0x24,
+	0xFE,0x7C,0x60,0x0C,0x54,0x49,0x51,0xCF,0xF0,0xD7,0x2B,
+	0x1F,0x69,0xB3,0xD6,0x8E,0xDE,0x2F,0x50,0xAC,0x51,0x1A,
+	0xF1,0x7E,0x76,0xBF,0x0D,0x3F,0x48,0x18,0x43,0x78,0x3A,
+	0x82,0x1D,0x44,0xE3,0x72,0x74,0x84,0x82,0xE5,0x9F,0x09,
+	0xFB,0x0B,0xBD,0x0A,0xC3,0xEA,0xA0,0x65,0x19,0xDA,0xD4,
+	0x26,0xBE,0x87,0xCC,0x7A,0x0F,0xA9,0x70,0x48,0xF1,0x62,
+	0x56,0xE7,0x61,0x73,0xC1,0xA4,0x5C,0x00,0x65,0x7B,0x40,
+	0xEC,0x54,0xEF,0x2F,0x06,0x6A,0x9C,0xF6,0x1C,0x68,0x73,
+	0xCB,0xA9,0x57,0x07,0x82,0xF2,0xAE,0xA4,0xD3,0xAC,0x0F,
+	0xCA,0xE9,0xAA,0xA9,0x0D,0x07,0x89,0x9D,0x96,0x05,0x91,
+	0x24,0x90,0x4A,0xD8,0x06,0x4E,0x0E,0x4B,0xAD,0x02,0xF7,
+	0x72,0x82,0x66,0x0D,0xFB,0x0A,0xB0,0x9D,0xC1,0x5C,0x88,
+	0xB0,0x06,0x49,0xCD,0xDE,0x57,0x38,0xD7,0xA5,0x58,0x29,
+	0xBE,0x0C,0xA0,0xA7,0x7A,0xD9,0x51,0x99,0xFA,0xA0,0x8F,
+	0xAE,0x3C,0x8C,0xE8,0x4E,0x0F,0x80,0x29,0x50,0xB6,0x3B,
+	0x0F,0x8E,0xE8,0x4A,0xC1,0x13,0x17,0x75,0xCC,0x2D,0x45,
+	0xBA,0x23,0xA0,0xC8,0xA7,0x54,0xB2,0xBC,0xBB,0x91,0x6D,
+	0xA0,0x25,0x48,0xDC,0xDB,0x20,0x67,0xF5,0x56,0x91,0xD0,
+	0x05,0x73,0x6C,0x0D,0x78,0x24,0x9E,0x0D,0xE7,0xEA,0xCC,
+	0x14,0x03,0xB9,0x7E,0xD9,0x20,0xB7,0xC6,0x2E,0x46,0xBE,
+	0x3F,0x42,0xBE,0x05,0x83,0x2D,0xC3,0xE9,0xBD,0xC9,0xFF,
+	0x5A,0x42,0x60,0xC6,0x0D,0x79,0x0C,0x7D,0xC1,0x50,0x5E,
+	0xCB,0xA5,0x2C,0x82,0xCC,0xFD,0x0D,0x49,0xFE,0xAB,0xFC,
+	0x3D,0xE8,0xD2,0x80,0x42,0xC8,0x7C,0xBD,0x70,0x2E,0x3C,
+	0xFF,0x97,0xFA,0x6E,0x6F,0xF7,0x7B,0xB5,0x69,0xBF,0x52,
+	0x8E,0x4B,0x65,0x1F,0x94,0xAC,0x40,0x1D,0x4F,0x89,0x7D,
+	0x18,0x79,0x1C,0x12,0x75,0x0B,0x37,0xA8,0x88,0xE0,0xD8,
+	0x2B,0x1C,0x0A,0x82,0x58,0x32,0x4A,0x46,0x52,0x6E,0xF5,
+	0xC0,0x12,0xFC,0x79,0x8A,0x23,0x93,0x7D,0x63,0x11,0x1B,
+	0x7B,0xA1,0xA4,0x98,0xEE,0xA5,0x50,0xF6,0x3F,0xC5,0x63,
+	0xA9,0xC9,0xE3,0x3E,0xEF,0xC6,0x15,0x88,0xB5,0x50,0x69,
+	0x6C,0xCB,0xF7,0x71,0x9B,0x99,0xC9,0x68,0x4C,0xFE,0x14,
+	0xCB,0x90,0x05,0xD1,0x1D,0xB3,0xAB,0x95,0xFF,0xEE,0x2A,
+	0x43,0x6C,0xB7,0x2C,0xF8,0xF3,0x36,0x11,0x92,0x63,0x3E,
+	0x18,0x34,0xA0,0xBD,0xCC,0xD5,0x8D,0x42,0x0D,0x26,0x86,
+	0x3F,0xA1,0x57,0xEE,0xD4,0xE7,0xBD,0x69,0x93,0x0A,0xD1,
+	0x55,0x4F,0x1D,0x97,0x83,0x6E,0x96,0xED,0xE4,0xF9,0xA0,
+	0xA3,0x35,0x45,0xBA,0x49,0x10,0xC7,0xE7,0x0D,0xA8,0x60,
+	0x7D,0xAD,0xF5,0x6C,0x54,0xC3,0x4F,0xB0,0x14,0xCB,0x9E,
+	0x28,0xB5,0xBF,0x2D,0x1E,0xC4,0xD6,0xFC,0x3C,0x74,0x06,
+	0xAC,0x13,0x9D,0xAC,0xD5,0x6F,0x8B,0x20,0x2D,0xF5,0x4E,
+	0x3C,0x98,0x0B,0xFE,0x9A,0xF7,0x75,0x64,0x4E,0x70,0x7D,
+	0x57,0xF9,0xCE,0xC2,0xD4,0x0C,0xFA,0xB8,0xD6,0xCC,0xE6,
+	0x03,0x46,0xC9,0xCE,0x1B,0x6D,0x28,0x7B,0x64,0x4E,0xA4,
+	0x2C,0x59,0xBE,0xE1,0x96,0x88,0xE4,0xE5,0x09,0xB1,0xD9,
+	0x63,0x33,0x7B,0x1B,0xDE,0x7B,0x4E,0x1B,0x58,0xD6,0xE2,
+	0xBF,0x4E,0xCD,0xC9,0xCC,0xBE,0x8A,0x15,0x8A,0x7D,0x38,
+	0x13,0x85,0xDA,0x97,0xED,0x98,0x0D,0xA8,0xA3,0x4A,0x95,
+	0x6D,0x19,0xB6,0xCD,0xEC,0x69,0x9D,0x47,0x29,0xEF,0x23,
+	0x8C,0xAE,0xDD,0x2C,0xD0,0x58,0x14,0xAF,0x4D,0x18,0x17,
+	0x77,0xEA,0xD1,0x70,0xE0,0x1E,0x9C,0xDB,0x6E,0x57,0x98,
+	0x36,0xC7,0xB2,0x14,0xDC,0xFD,0x8D,0x9A,0x55,0x9F,0x07,
+	0xC3,0x98,0x45,0x85,0x3D,0x48,0xC9,0x3D,0xA4,0xDA,0xBF,
+	0xEF,0x87,0xA7,0x83,0x10,0x22,0x42,0x01,0xE2,0xA1,0xD0,
+	0xCD,0x6A,0xFE,0xAE,0xCB,0x83,0x89,0xAF,0xD3,0x2D,0xA3,
+	0x3F,0x62,0xE4,0x3D,0x96,0xF8,0xA4,0xA3,0x8F,0xC9,0x27,
+	0x9D,0x57,0xEF,0xB2,0x5C,0xFD,0x61,0x75,0x67,0xFC,0x3E,
+	0xFE,0x30,0xDC,0xBD,0x7D,0x7A,0xA9,0xDA,0x60,0x5B,0x2C,
+	0xBB,0x0B,0x6E,0x80,0x36,0x0C,0xB7,0xD1,0xB3,0x87,0xB1,
+	0x33,0x3D,0xB1,0x65,0x6E,0xB9,0xF9,0x26,0xD0,0x3A,0xF3,
+	0xF9,0x9B,0x89,0x5A,0x65,0x1F,0x56,0xB5,0xCA,0x9B,0x10,
+	0x58,0x84,0x97,0x96,0x13,0xA6,0x8F,0x19,0xF2,0xE5,0xE1,
+	0x43,0x57,0x35,0x8C,0x36,0x5E,0x49,0x74,0x8A,0x7E,0x9B,
+	0x0B,0x2D,0x53,0xD2,0x9E,0x9F,0x9B,0x94,0x27,0x59,0xEB,
+	0x9C,0x39,0x5E,0xFE,0x45,0x88,0xB7,0x7E,0x42,0xA3,0x3E,
+	0xEF,0x4B,0xDE,0x97,0xB2,0x49,0x93,0xB7,0x7E,0xCB,0xE6,
+	0xEC,0xEB,0xE0,0x90,0x25,0xF6,0xED,0x86,0xBC,0xF3,0x6D,
+	0x7B,0xDF,0x71,0x69,0x39,0x43,0xC3,0x57,0xF5,0xD0,0xB2,
+	0xD7,0x24,0x99,0x0E,0x5F,0xF5,0xBE,0xFB,0xFE,0xF3,0x99,
+	0xDD,0x3E,0x2A,0x7A,0xB9,0x80,0x92,0x4A,0x6F,0xA2,0xD6,
+	0x9C,0x24,0x19,0x75,0x32,0xBB,0x54,0x4C,0x1F,0x0A,0x2D,
+	0xB2,0x17,0xC3,0x2E,0xA0,0x83,0x62,0xBF,0x89,0x40,0x8E,
+	0x5C,0x19,0xFC,0x50,0xCE,0x3D,0x96,0xA6,0x41,0x4B,0x55,
+	0x7B,0x9D,0xC6,0x95,0xF7,0x3F,0x79,0x34,0x65,0x08,0x43,
+	0x57,0x71,0xAA,0x67,0xE6,0x7A,0x8D,0x8E,0xFB,0x58,0x70,
+	0x87,0xD3,0xB8,0x21,0x81,0xD5,0x67,0x59,0xC3,0x91,0xBD,
+	0x50,0xE1,0x5C,0x28,0x81,0xEC,0x7D,0xEB,0xFE,0xB6,0x66,
+	0x58,0xDD,0x36,0x10,0xA7,0xC2,0x8C,0x92,0x4C,0xEA,0x7C,
+	0x64,0xD6,0x2F,0x47,0x8F,0x9A,0x53,0x01,0x5B,0x24,0xA5,
+	0x8C,0x96,0x44,0xD0,0x97,0xFC,0x77,0x0F,0x19,0x0B,0xDC,
+	0x92,0x4B,0x93,0x34,0xC4,0x2C,0x39,0x61,0x39,0x87,0xC4,
+	0x36,0xDA,0x23,0x53,0x1F,0x7A,0x5B,0xED,0xAE,0x95,0xB2,
+	0x65,0x3D,0x94,0xE6,0xE6,0xA4,0xBD,0x4C,0x86,0xD4,0xD3,
+	0x4C,0xF0,0x12,0x94,0x94,0x0C,0x42,0xA1,0x04,0xD7,0x19,
+	0x6A,0x57,0x9A,0x93,0x2A,0x9F,0x7F,0x52,0xF3,0xA6,0xAD,
+	0x53,0x9F,0x9C,0xC7,0xA6,0xD6,0x2D,0xE1,0xDF,0x5C,0xFD,
+	0x59,0x2D,0x57,0xB3,0x1E,0x06,0x35,0xCD,0xE4,0x27,0x54,
+	0x55,0x01,0x32,0x75,0x67,0xA1,0xC8,0xD3,0x3D,0xCB,0x51,
+	0x29,0xCD,0xB4,0xFF,0x80,0x62,0x62,0xA8,0xA6,0x5F,0x88,
+	0x14,0xB1,0x51,0xE9,0x65,0x5F,0x6C,0x4E,0xB6,0xED,0x78,
+	0xCA,0x51,0xBA,0xCD,0x55,0xFE,0x7E,0x66,0x96,0x27,0x50,
+	0xF3,0x3C,0x7C,0x30,0x48,0x7D,0x8F,0x3A,0x8E,0x6A,0x68,
+	0xA9,0x65,0xDB,0x1A,0x27,0x39,0x50,0x79,0x23,0x1D,0x17,
+	0x59,0x7A,0x05,0x13,0xC9,0xCD,0xC7,0x10,0x10,0xDA,0xE3,
+	0x33,0x50,0xB4,0x85,0x0F,0xBB,0x51,0x4D,0x48,0x1B,0xC3,
+	0x21,0x8D,0x79,0x97,0x1F,0xBF,0x37,0xBA,0x50,0x53,0x5A,
+	0x70,0x9F,0xB0,0xE1,0xB3,0xC5,0x60,0x1D,0x3E,0x20,0x94,
+	0x74,0xBF,0x4C,0xF4,0x2D,0x12,0x36,0xF4,0xBF,0xB2,0x61,
+	0xA8,0x1A,0x3C,0xBB,0xA6,0xC4,0xEF,0x52,0x20,0x56,0x8F,
+	0x99,0xDE,0x4C,0x30,0x54,0x60,0x3E,0xA9,0x4F,0x10,0x00,
+	0xF4,0x72,0x7D,0x22,0xE7,0xAB,0x65,0x0E,0xE1,0xAD,0x51,
+	0x22,0x31,0x47,0xD1,0x66,0x7F,0x76,0x59,0x5F,0xF0,0xF8,
+	0x14,0x28,0x76,0x12,0x09,0x4D,0x58,0xE2,0x7F,0xA6,0xC8,
+	0x25,0x01,0x4C,0x61,0xB5,0x81,0xA2,0xC6,0x21,0x4C,0xFD,
+	0xF9,0x94,0xFF,0x95,0x3F,0xE9,0x62,0x10,0x48,0x6A,0x34,
+	0xE3,0xCD,0x43,0x80,0xC4,0x67,0xAD,0x24,0xB4,0xB8,0x31,
+	0xEF,0xC8,0x85,0x6E,0x30,0x30,0x1C,0x60,0xD1,0x78,0x42,
+	0xD5,0xA6,0x57,0x5F,0x03,0xFE,0x66,0xDA,0x09,0x43,0x85,
+	0x3F,0xF2,0xB7,0x20,0x33,0x11,0x90,0x57,0x56,0x9D,0x1E,
+	0x57,0xDF,0x8B,0x32,0x32,0x7F,0x94,0xC1,0x7A,0x87,0x52,
+	0x7E,0x1A,0x1F,0x91,0xE2,0xDC,0xD0,0x8E,0x56,0x53,0x56,
+	0x67,0x48,0xDD,0xF5,0xA9,0x40,0xDA,0x2F,0x4E,0x34,0x1C,
+	0x3E,0xA8,0xE0,0xC6,0xF9,0xC5,0x49,0x3F,0x5A,0x2D,0xF0,
+	0x0A,0xA4,0xEE,0x59,0x4A,0x75,0x3B,0x9C,0x03,0x4D,0x24,
+	0xE8,0xDE,0x6D,0xA5,0x4C,0x0B,0xB7,0x1E,0xA7,0xBC,0x95,
+	0x76,0xCE,0x55,0xF3,0xC1,0x60,0x95,0x0C,0x80,0xF6,0x49,
+	0xC2,0xDD,0xFB,0x77,0x25,0x2A,0x34,0x9A,0x1E,0x1C,0x81,
+	0xA9,0xCD,0xE1,0x6A,0xCA,0x3C,0xE9,0xF1,0x04,0x63,0xC7,
+	0x5D,0x5D,0x5D,0x3F,0xB4,0x32,0x27,0xF8,0xB2,0x85,0xFB,
+	0x9F,0x5D,0x6D,0xC0,0xC0,0x5B,0x8B,0x8F,0x52,0x6A,0x0F,
+	0x4C,0x94,0xF7,0x2D,0x2E,0xD1,0x69,0xB8,0xE8,0x46,0xA4,
+	0xFC,0xD2,0xCC,0x00,0xAC,0xA8,0x03,0xF5,0xFE,0xE6,0x5B,
+	0x4B,0xCE,0xF9,0xF9,0xB4,0x14,0xAB,0x64,0x3B,0xE2,0x54,
+	0x5B,0xE5,0xBC,0xCA,0x25,0x2C,0xE8,0xA3,0x45,0x25,0xEE,
+	0x52,0xEA,0xC7,0x5D,0x1D,0xCC,0x9B,0x6E,0xD3,0x0C,0x5A,
+	0x74,0x3E,0x94,0x21,0x1F,0x1F,0xFC,0x23,0x7F,0xD9,0x78,
+	0x75,0x21,0xCE,0x4D,0x62,0xE5,0x96,0x1D,0x2C,0x6E,0xD0,
+	0xFE,0xF6,0xCD,0xDC,0xE8,0x9B,0x88,0x58,0x52,0xC5,0x4C,
+	0xA2,0x7F,0x0C,0xC3,0x78,0x86,0xA8,0x55,0xD9,0xC9,0x51,
+	0xA8,0xE8,0x26,0xD9,0x6B,0x17,0xE9,0x48,0xFF,0xCB,0x18,
+	0xD4,0x41,0x10,0x61,0x65,0x75,0x70,0xAC,0x94,0x08,0x70,
+	0x9E,0x8C,0x6F,0x94,0x02,0xE4,0x07,0x97,0x6C,0xC0,0x04,
+	0xAD,0x8E,0x6D,0x13,0xAC,0x24,0x7A,0x44,0x1E,0x2C,0xB1,
+	0x91,0x67,0xD5,0x49,0x47,0x87,0xC6,0x8A,0xA1,0xE9,0xAA,
+	0x33,0x0B,0x1D,0x00,0x49,0x50,0x88,0xBE,0x70,0xCA,0x4F,
+	0xFF,0xDE,0x01,0xE0,0xA2,0xD9,0x28,0xF0,0xD2,0xE2,0xE0,
+	0xAD,0xE4,0xF6,0x80,0x38,0xD8,0x11,0x21,0xF5,0x4D,0xF1,
+	0xB8,0x88,0x2A,0xC0,0xD9,0xE0,0xC2,0xEB,0x28,0x91,0xF9,
+	0x76,0x14,0x42,0x97,0xD8,0x4D,0x30,0x5B,0x48,0x03,0xA0,
+	0xF1,0x11,0x0C,0x41,0x8F,0x56,0xE0,0x96,0x71,0x06,0xEB,
+	0x89,0xBF,0x37,0x38,0xA2,0x9D,0xEE,0x4E,0x0B,0xE8,0xF4,
+	0x37,0x1F,0xE2,0xA6,0x2F,0xF1,0x35,0x3D,0xB4,0x1E,0x6F,
+	0x87,0x24,0xDE,0xA3,0x3B,0x4A,0x65,0x23,0x8E,0x61,0x93,
+	0xD0,0xC9,0x81,0x4E,0x2E,0xAE,0x01,0xB4,0xA4,0xAB,0xC2,
+	0x71,0x73,0x86,0xE2,0xB7,0x8E,0x7A,0x3F,0xDA,0xA7,0x7B,
+	0x3F,0x5B,0x3D,0x57,0x4E,0x7B,0x86,0xCF,0xC5,0x57,0x13,
+	0xB9,0x60,0x22,0x63,0x4F,0x5A,0x2C,0xF3,0x8A,0x3F,0x24,
+	0xD0,0xA1,0x95,0xAF,0xA9,0xA8,0x70,0xD0,0x62,0x11,0x94,
+	0x71,0x2A,0xC3,0xD5,0x3E,0xF6,0xFE,0x7D,0x40,0x37,0x6B,
+	0x51,0xF7,0xFB,0xD8,0x79,0x6F,0x1F,0xDC,0x70,0xF0,0x40,
+	0xE5,0xA0,0x9B,0x11,0x81,0x35,0xD2,0x71,0x0C,0x5B,0x34,
+	0x36,0x3E,0xA9,0x38,0xA9,0xD2,0x38,0xE5,0x68,0x4A,0xFB,
+	0xA0,0x88,0x95,0xB1,0xBF,0xE6,0xAD,0xB9,0x36,0x72,0x12,
+	0x72,0x70,0x7A,0x02,0xB6,0xF8,0x67,0x09,0x48,0x2B,0x04,
+	0xA2,0x7D,0xA9,0x7B,0x12,0x90,0x90,0x2B,0xE2,0x44,0x17,
+	0x4B,0xC4,0x74,0xAC,0x95,0xEB,0xAD,0xFE,0xE4,0xE6,0x8E,
+	0x7E,0xF8,0x6B,0x09,0x0B,0x19,0xBF,0xE8,0x1F,0x20,0xEF,
+	0xBE,0x04,0x2C,0xA3,0x67,0x82,0x3A,0x17,0xF2,0x75,0xAC,
+	0x2F,0x29,0x70,0x23,0x11,0x88,0x3F,0xD0,0x5F,0x46,0x2A,
+	0x50,0xE3,0xDE,0x20,0x3A,0x9D,0x99,0x85,0x39,0xAD,0xBF,
+	0xD7,0xDF,0x49,0xB1,0xFC,0x02,0x7D,0x2C,0xEC,0xB6,0x56,
+	0x30,0x77,0xF9,0xA8,0xBD,0xDC,0x12,0x49,0x7A,0x8D,0xD7,
+	0x94,0xA1,0x06,0xB7,0x19,0xE7,0xFF,0x10,0x56,0x3B,0x49,
+	0x90,0xE7,0xC6,0x71,0x4E,0x64,0x5A,0xC8,0xE7,0x1E,0x54,
+	0xB2,0xEB,0x25,0xBF,0x1C,0x1F,0xD6,0xD6,0x18,0x58,0x15,
+	0x19,0xEF,0x76,0x23,0xDC,0x8E,0x43,0x60,0x21,0xAF,0x8D,
+	0x49,0xC2,0x3A,0xFC,0x69,0xB9,0x1D,0xFB,0x04,0xC7,0xDE,
+	0xB1,0xA0,0xD8,0x71,0x71,0x5B,0x6C,0xAD,0xB0,0xB7,0x1D,
+	0x35,0xDD,0x1E,0xA7,0x2C,0xAE,0xC1,0xAF,0x0A,0xE0,0x9F,
+	0x4D,0x01,0x84,0xB0,0xC9,0xBB,0xE8,0x27,0xFD,0x8F,0x95,
+	0xB5,0x25,0x3A,0x91,0x1E,0x1B,0x7E,0x86,0x80,0xC2,0xFA,
+	0x12,0x34,0x19,0x68,0x8E,0xCE,0xA4,0xCD,0xD8,0xCE,0xA1,
+	0x6C,0xD1,0x88,0x4F,0x9B,0x0B,0x9D,0xDB,0x11,0xEA,0x47,
+	0x42,0xBE,0x5E,0x07,0x08,0x76,0xA5,0xDB,0x14,0x0D,0xC7,
+	0x6A,0x85,0xCB,0x88,0xA7,0x40,0x45,0xE5,0x9E,0xE1,0x1E,
+	0x44,0x55,0xB4,0xCE,0x85,0x05,0x0A,0xE8,0xAF,0xDF,0x2A,
+	0x6C,0x73,0xA6,0x0C,0x33,0x87,0xCF,0x61,0x60,0xAC,0xE3,
+	0xE6,0x68,0x9C,0x65,0x4A,0xB1,0x3E,0xCA,0x5B,0x83,0x8A,
+	0xD2,0x39,0x27,0x6A,0x6B,0x48,0xA5,0xBD,0x74,0x23,0xFA,
+	0xC0,0xFD,0x01,0x91,0x80,0x40,0x83,0x01,0x82,0xFD,0x91,
+	0xDD,0xB5,0x86,0x8F,0xC9,0xF1,0xA4,0xB6,0xCE,0x24,0x62,
+	0x69,0xAE,0xC3,0xDA,0x25,0x38,0x3C,0x38,0x25,0x6B,0xE0,
+	0xE4,0xD6,0x85,0x27,0xA5,0x3F,0xA6,0x01,0x45,0xEE,0x21,
+	0x57,0x87,0x89,0x11,0x51,0xA9,0xA2,0x20,0x75,0xD0,0x5A,
+	0x51,0x33,0xE2,0x80,0xD2,0xCA,0x88,0x78,0xB0,0xCC,0xB3,
+	0x88,0xA2,0x23,0xF2,0x45,0xF8,0xC2,0x13,0x1C,0xC9,0xDA,
+	0x3B,0xCB,0x13,0xAD,0xD1,0x22,0xDA,0x28,0x9E,0x24,0xB6,
+	0x35,0xD5,0xBF,0xEC,0x3F,0xDD,0x56,0x03,0x48,0xC4,0xE3,
+	0x41,0xAE,0x21,0xD6,0xA4,0x63,0x79,0xEF,0xA7,0x85,0x75,
+	0x38,0x64,0xCD,0x76,0x0A,0xF2,0x4F,0x79,0xF0,0xDB,0xD0,
+	0xF5,0xC1,0xA1,0xD3,0xC3,0xDF,0xA6,0x12,0x07,0xBF,0x0F,
+	0xBC,0x03,0x97,0xCD,0x53,0x80,0xF0,0x3A,0x58,0xA0,0xD7,
+	0xE8,0x1B,0x9B,0x99,0x98,0x77,0x53,0x08,0x3F,0x4C,0x0D,
+	0xE9,0x24,0x82,0xFD,0xE3,0x50,0x59,0xAA,0xCF,0xCB,0x3F,
+	0xF8,0xA2,0x98,0x61,0xBE,0x03,0x43,0x4B,0xEA,0x06,0x03,
+	0x12,0x9D,0xAF,0x78,0x0C,0xDE,0x0F,0xDB,0xE3,0xE9,0x1A,
+	0x48,0xFC,0xB7,0x0F,0x1A,0xA3,0x24,0xE2,0xFE,0x44,0x98,
+	0x4F,0xF5,0xFF,0xF7,0xA3,0xF9,0x30,0x6C,0x9C,0x4F,0x92,
+	0xAF,0x27,0x7F,0x56,0x38,0x0B,0x93,0x27,0x4E,0x65,0x3D,
+	0x7B,0xFC,0x01,0xB8,0x9B,0x88,0x8E,0xEE,0x82,0x89,0x9A,
+	0x36,0xAE,0x13,0x1D,0x22,0xFC,0xA4,0x2B,0xA4,0x17,0x68,
+	0x3B,0x41,0x5B,0x50,0x58,0x52,0xD0,0xD1,0xB4,0xA8,0x4A,
+	0x40,0xF1,0x54,0x2B,0xA0,0xFC,0xE2,0x9D,0x65,0xFB,0x1B,
+	0x64,0x10,0x6F,0xFD,0x65,0xCA,0xF4,0x62,0x94,0x49,0x77,
+	0xEC,0x9A,0x08,0xBC,0x01,0x53,0xA8,0x85,0xCB,0x5D,0xBD,
+	0x8D,0x0D,0xC3,0x6C,0xA8,0xF2,0x23,0x66,0x14,0xAF,0xCA,
+	0x43,0x1A,0x0E,0xA5,0x88,0xBC,0x1A,0x80,0xFE,0x58,0x3C,
+	0x6B,0xE7,0x21,0x50,0x8A,0x22,0xBD,0x6D,0x68,0x9F,0x31,
+	0x21,0x39,0xFF,0x12,0x7D,0x20,0x77,0x62,0xB4,0x74,0xBF,
+	0xFD,0x68,0xDA,0x7E,0x91,0xEF,0xE1,0x27,0xE4,0x50,0xB3,
+	0x7C,0xC7,0xB6,0x19,0xFA,0xFF,0x4C,0xFF,0x7D,0x52,0xE2,
+	0xA1,0xCA,0xE5,0x26,0x8A,0xC2,0x15,0xC4,0x60,0xBE,0x61,
+	0xED,0x8D,0x6F,0xFE,0xAA,0x0B,0x12,0x4A,0xAA,0xC1,0xBF,
+	0xC3,0xF6,0xCB,0x03,0xF9,0x73,0xF4,0xDD,0x3A,0xC1,0x90,
+	0x32,0x1B,0x1D,0xFD,0xB7,0x60,0x49,0xC0,0x05,0x77,0x61,
+	0xD6,0x75,0x7C,0x75,0xBB,0xD8,0x2B,0x9F,0xDF,0x31,0xB3,
+	0x14,0x77,0x9C,0x83,0x7F,0xBC,0xF0,0x7F,0x6E,0xA9,0xBE,
+	0x83,0xDA,0x25,0x59,0xB0,0x67,0x95,0x08,0x27,0x48,0x5F,
+	0x4E,0x1B,0x1F,0x45,0x12,0x72,0x92,0x33,0x7A,0x50,0xE1,
+	0x93,0xB5,0x05,0xE9,0xDA,0x1F,0xCF,0x14,0x2C,0xB8,0x08,
+	0xB8,0x3B,0x0F,0xDE,0xB4,0xEB,0x3A,0x16,0xB4,0xC6,0x99,
+	0x77,0x77,0x8C,0xDA,0xC7,0x47,0x61,0x5F,0xFC,0x75,0x01,
+	0x6D,0xEF,0xB2,0xB5,0x8D,0x23,0x79,0xE0,0xFE,0xD1,0x7D,
+	0x71,0xA3,0x68,0xE7,0x62,0x93,0x41,0xF2,0x64,0xED,0x71,
+	0x5E,0xCB,0x41,0xF6,0x19,0xA0,0xA2,0xDB,0x9E,0x6C,0x3F,
+	0x95,0xB3,0x4C,0xD2,0x17,0xD5,0x4C,0x7F,0x06,0xA0,0x2F,
+	0x05,0xAD,0xE3,0x53,0xE2,0xF8,0xB9,0xD0,0xA9,0xA3,0x7E,
+	0x95,0x02,0x9A,0xD1,0xAD,0x6A,0xA5,0xAB,0x0A,0xC8,0x62,
+	0xFD,0x1A,0x41,0x8C,0xAB,0x42,0x29,0x14,0x1B,0x2C,0xA2,
+	0x26,0x52,0xE8,0x2B,0x95,0xFD,0x5A,0x3D,0x17,0x51,0x78,
+	0x40,0x5B,0x56,0x5F,0xC2,0xC3,0x5F,0xE7,0x20,0x5F,0xB5,
+	0x72,0xE6,0x3B,0xE8,0xD7,0x20,0x1C,0xA0,0x3A,0x2E,0x2F,
+	0x91,0x6C,0x2D,0x01,0xA3,0x45,0xCB,0x88,0x2D,0x63,0xB4,
+	0x8A,0x0A,0x55,0x2E,0x36,0x7D,0x86,0xB0,0xBD,0x8A,0x19,
+	0xA8,0xF7,0x9F,0xF4,0xD6,0x34,0xE5,0xE1,0xC7,0x74,0xE6,
+	0xA4,0xC2,0xE6,0x18,0xB3,0x29,0x42,0x05,0x10,0x9B,0xA0,
+	0x25,0xED,0xBF,0xF9,0xB7,0xDA,0x95,0x06,0x7D,0x2E,0x07,
+	0xF8,0xFA,0xBF,0x53,0x0D,0xDD,0x25,0xD6,0x1A,0xF8,0x7A,
+	0x42,0x7A,0x31,0x64,0x29,0xB9,0xF9,0xD9,0x18,0x37,0xE2,
+	0x9B,0x1B,0x1A,0x0C,0x49,0x14,0x52,0x05,0xFC,0x08,0xC4,
+	0x71,0x0E,0x3D,0x2C,0x42,0xB5,0x7E,0x88,0xEF,0x02,0x19,
+	0x96,0x39,0x29,0xAA,0xFB,0x5B,0x4B,0xDC,0xD6,0x2F,0xD4,
+	0xC9,0xC5,0x93,0xF3,0x8E,0xEC,0xAD,0x7D,0xD4,0xD5,0x92,
+	0x9D,0x19,0xF1,0x44,0xC8,0x1E,0x13,0x72,0x6A,0x83,0xAA,
+	0x52,0x7B,0xF1,0x10,0x95,0x97,0x56,0x49,0x3A,0x39,0xDC,
+	0x9B,0x36,0xE4,0xD3,0x71,0x4C,0xBF,0xF5,0xF7,0x8E,0x83,
+	0x7A,0xDD,0xB5,0x60,0xCF,0xB8,0xE1,0x1D,0x15,0x16,0xDF,
+	0x12,0x76,0x2C,0x81,0xAA,0xAF,0xF7,0x38,0x20,0xBC,0xE6,
+	0xCE,0x57,0x23,0x10,0x7E,0x0D,0x65,0x5B,0x90,0x21,0xDC,
+	0x02,0x3E,0x4D,0x88,0x75,0x8B,0x1C,0x8F,0x72,0xAC,0x90,
+	0x1C,0xDA,0x7E,0xC9,0xE8,0x21,0x00,0x67,0x39,0x3B,0x71,
+	0x86,0xD4,0x78,0x5E,0x00,0x24,0x5B,0x52,0x13,0x9D,0xEB,
+	0x21,0x6D,0xB3,0x83,0x10,0x17,0x12,0x8D,0xD6,0x3B,0xE1,
+	0x43,0x8A,0xD6,0x94,0xB8,0x91,0x61,0xB4,0x2B,0x56,0xE1,
+	0x7F,0xA5,0x58,0x1A,0xB0,0x4F,0xCC,0xD0,0x3D,0x5A,0x64,
+	0xDE,0x8A,0x24,0x1D,0x64,0xA1,0x8F,0x81,0x20,0x83,0xB4,
+	0xCE,0x3D,0xAC,0x5D,0x51,0xFF,0x6F,0x1F,0x68,0xCE,0x57,
+	0x96,0x0F,0x55,0xCD,0x57,0xAD,0x1A,0x6C,0x13,0x09,0x79,
+	0x58,0xE9,0xAB,0xB8,0x48,0x74,0xF4,0x9D,0x20,0xFB,0x5E,
+	0xF5,0x15,0x79,0x83,0xB6,0x4B,0x32,0x1D,0x86,0xBA,0x69,
+	0xBA,0x47,0xCB,0x40,0x9A,0x05,0x14,0x98,0xCA,0xAB,0x38,
+	0xBF,0x9C,0xF5,0x6F,0x04,0x70,0xE6,0x0E,0x4D,0x77,0x6C,
+	0xD8,0x1C,0x49,0x95,0x57,0x35,0xB6,0xC1,0x36,0xAF,0xCA,
+	0x63,0x7F,0x2E,0x13,0x20,0x88,0x88,0x7D,0xF3,0x68,0xB9,
+	0x4A,0xBD,0x0B,0x62,0x45,0xF7,0xA7,0x14,0x3A,0xF6,0xA1,
+	0xE3,0x14,0xE8,0xFF,0x8F,0xA2,0x73,0x8F,0x67,0xFA,0xF1,
+	0xFE,0xF8,0x7B,0x57,0xB3,0xCD,0x6C,0x33,0x33,0xF7,0x99,
+	0xCD,0x75,0xEE,0x97,0x5C,0xA2,0xB9,0xDF,0xE5,0x9E,0x5B,
+	0x65,0x6E,0xB9,0xDF,0x87,0xEE,0x73,0x67,0xA4,0x21,0x42,
+	0x37,0xA4,0x3E,0x48,0xC5,0x08,0x29,0x85,0x54,0xAE,0xA5,
+	0x92,0x48,0x49,0x92,0xDC,0x52,0x49,0x52,0xB1,0xFD,0xBE,
+	0xBF,0xBF,0xCE,0xBF,0xE7,0x71,0x1E,0x8F,0xD7,0x39,0xCF,
+	0xE7,0x5F,0x87,0x70,0xBD,0xA6,0xF4,0x00,0x16,0xFC,0xC7,
+	0x49,0xA6,0x36,0xAB,0xA0,0x7E,0x41,0x83,0x76,0xE0,0x1A,
+	0xBC,0x2C,0x04,0xBA,0x6A,0x74,0x4F,0xBF,0x5C,0x6D,0x65,
+	0x9F,0x60,0x0C,0x5A,0xC1,0x29,0x55,0x93,0x94,0x13,0x0E,
+	0x22,0x8B,0xEC,0x52,0x89,0x3D,0xB9,0xE7,0xC8,0x8F,0xA9,
+	0xD2,0x3E,0xB2,0x4C,0xE9,0x1E,0x98,0xC2,0xE4,0xE9,0xE5,
+	0x07,0xFC,0xE5,0x7B,0xF6,0x7B,0xDC,0x07,0x38,0xC2,0x63,
+	0xF5,0x7B,0x72,0xE7,0x18,0x97,0x0E,0xF2,0x2F,0xA4,0x91,
+	0x5F,0xEE,0x11,0x9B,0x23,0x3B,0x6B,0x96,0x61,0xF7,0x62,
+	0x36,0xB0,0x23,0x18,0xB4,0x32,0x52,0x71,0x8E,0x7C,0xE8,
+	0xFB,0xAE,0xE5,0x1A,0x62,0x6F,0x2F,0xE2,0x00,0x42,0xDB,
+	0xE3,0xB5,0xB0,0xBF,0x6B,0xC6,0xAE,0xA1,0x27,0xD6,0x22,
+	0x7F,0xED,0x46,0x5D,0xDF,0xCF,0x4D,0xFC,0xC4,0xDB,0x0B,
+	0xE7,0xB6,0xB4,0x63,0x82,0xF1,0x3C,0x02,0xE1,0x8C,0x44,
+	0xFD,0xC3,0x95,0x29,0x85,0x98,0xAC,0xC7,0x17,0xE8,0x22,
+	0xB3,0x56,0x8F,0x44,0xF0,0x71,0x98,0x7D,0xC2,0x4E,0x85,
+	0x19,0xC9,0xAA,0x55,0x48,0x0B,0x3F,0x35,0x7A,0xA0,0x46,
+	0xF9,0x60,0x3E,0xEC,0x57,0xBA,0x33,0x9A,0x92,0xA8,0x27,
+	0xB8,0x60,0x44,0x16,0x7E,0x1E,0x8E,0x44,0x2B,0xE2,0xAD,
+	0x99,0x9B,0x6A,0x23,0x17,0xDD,0x9E,0xEF,0xEB,0xC4,0xBB,
+	0xC5,0xF4,0x74,0x88,0x05,0x9C,0x78,0x12,0x6B,0x29,0x67,
+	0x72,0x09,0x18,0x3C,0xFC,0x97,0x90,0xD4,0x2E,0xAF,0x80,
+	0x4F,0xE2,0xDC,0x04,0x25,0x6D,0xA9,0x75,0xBD,0xAA,0xBB,
+	0xD3,0x5F,0xE1,0x2C,0xEB,0xCA,0x76,0x56,0xF3,0x9D,0x6E,
+	0x75,0x64,0x59,0xC6,0x43,0x27,0x39,0xB3,0x31,0xAE,0xB5,
+	0x36,0xD4,0x39,0x13,0x92,0x4F,0xAF,0xE2,0x1D,0xCB,0x19,
+	0x89,0xCD,0x66,0x40,0x09,0xC5,0xA8,0x90,0xA0,0x9E,0x6A,
+	0xB6,0x21,0x3B,0x9F,0xE8,0x2E,0x74,0x55,0x6B,0x5D,0xFC,
+	0x86,0xA7,0xA0,0x1E,0x4F,0xDA,0xB9,0xB4,0xDE,0xD3,0x0D,
+	0x33,0x11,0x9D,0x4C,0x09,0x42,0x35,0xB5,0x14,0x7E,0x97,
+	0xCC,0x32,0x5A,0x35,0x43,0x88,0x38,0x79,0xD1,0x20,0xD1,
+	0x96,0xC2,0xBD,0xFE,0x82,0xF1,0x13,0x0C,0xA3,0xA3,0xF9,
+	0x7E,0x47,0x18,0x40,0xFA,0x7A,0x52,0x57,0xFE,0xC9,0x82,
+	0xA4,0xD6,0x78,0x74,0x2A,0xC5,0x27,0x6C,0x3F,0xC2,0x1D,
+	0xEB,0x51,0x1C,0x55,0x9A,0x59,0xAD,0x3B,0x1A,0xA5,0xC0,
+	0x6D,0x4A,0xF0,0x2D,0x8F,0x68,0x14,0x2C,0xC9,0x62,0xE7,
+	0xEE,0xC0,0x5D,0x07,0x1F,0xF5,0xDE,0x87,0xEF,0xE2,0xC1,
+	0xBD,0x8E,0x68,0xC3,0xDC,0x71,0xE0,0x7F,0xD5,0x38,0xFF,
+	0x04,0x47,0xAB,0x36,0x9F,0xC7,0x91,0x58,0xB4,0xC1,0xFF,
+	0x9C,0x13,0x06,0xD1,0x1D,0x41,0xE7,0x44,0xAC,0xC3,0x88,
+	0x1A,0x12,0x15,0x98,0x62,0x8A,0x31,0xBA,0xFA,0x5C,0x8A,
+	0xBD,0x03,0x58,0x4A,0xAD,0xAB,0xD9,0xAB,0xF9,0x7D,0x30,
+	0xBC,0x26,0x61,0xDE,0x4D,0x61,0x9F,0x4A,0x84,0x28,0xD8,
+	0xFB,0xBD,0x47,0x14,0x29,0x31,0x18,0x9B,0xED,0x8C,0x10,
+	0xCA,0xCC,0x0F,0xCB,0x73,0xC2,0x21,0x34,0x9C,0x5D,0xAD,
+	0x69,0x2A,0x83,0x96,0x76,0x2A,0xA1,0x2D,0x41,0x68,0x28,
+	0x24,0xC6,0xA5,0x0A,0x74,0x0E,0x08,0x94,0xCF,0xE2,0xD0,
+	0xF3,0x73,0xD8,0xA5,0x21,0x9F,0xF3,0x2F,0x71,0x2A,0x55,
+	0x84,0x43,0x30,0xF9,0x47,0x39,0x5E,0xB0,0x0A,0x54,0xCB,
+	0xA7,0x0A,0x1D,0xA9,0xEC,0x88,0x2A,0x0C,0x95,0x75,0x14,
+	0x07,0x0B,0x56,0x40,0xDE,0x97,0xB5,0x83,0x19,0xA4,0x80,
+	0x8E,0x6C,0x34,0xA4,0x24,0x37,0xDD,0x81,0xE1,0xBA,0x40,
+	0x68,0x31,0x9F,0x42,0x4C,0x3E,0x95,0x2C,0x27,0x27,0xE4,
+	0xEC,0xD4,0xA1,0xC9,0x6C,0x0A,0x97,0x2B,0x92,0x2E,0x99,
+	0xC1,0xA7,0x88,0x8B,0x53,0x23,0x8E,0x7A,0x5B,0xFB,0x4D,
+	0xF4,0xBD,0xB0,0x6D,0x97,0x52,0xF1,0xF1,0x13,0x6F,0xF5,
+	0x7C,0x57,0x9D,0xE9,0xA2,0xA6,0xC7,0x0E,0x4A,0xFA,0xC8,
+	0x22,0xFE,0x09,0x6D,0x16,0xC9,0x6A,0x2E,0xBC,0x43,0x94,
+	0x1E,0xA5,0x5C,0xFE,0x5E,0x6D,0xA2,0xF7,0x2C,0x9A,0x81,
+	0x3D,0xE9,0x21,0x16,0x4F,0x7C,0xB5,0xDD,0x18,0x15,0xC1,
+	0x69,0xF5,0xE0,0x08,0x35,0x5E,0x53,0x75,0x13,0x23,0x45,
+	0x0C,0x09,0x6A,0xBB,0x6A,0x4E,0xA9,0xB4,0x36,0xCC,0x03,
+	0x16,0xB6,0x01,0xED,0x20,0xB4,0xA8,0xA5,0xED,0xD7,0x27,
+	0xB6,0x7F,0x2E,0xCF,0x30,0x38,0xB0,0xCA,0xA8,0xE8,0xF7,
+	0x1E,0xDF,0xA8,0xDF,0x6F,0x6B,0x12,0x24,0x35,0x86,0xFE,
+	0x04,0x7B,0x4F,0x5A,0x34,0x4C,0x90,0x72,0xE3,0x5C,0xFE,
+	0x6D,0x1B,0xF8,0x3D,0x33,0x97,0x7F,0x01,0xB5,0xF0,0x68,
+	0xCF,0x79,0x11,0x87,0xA8,0x8E,0x16,0x0D,0x7E,0x5F,0x9D,
+	0x08,0xF3,0xEB,0x34,0xC1,0x9C,0xBE,0x1D,0x7E,0x88,0x1A,
+	0xF4,0xB0,0xFA,0x24,0x50,0xFD,0x5D,0xBA,0x6B,0x09,0xE2,
+	0x15,0x5E,0x2D,0x5E,0x7A,0x0F,0x71,0x01,0x82,0x8B,0xF1,
+	0x93,0x11,0xE6,0x02,0x3A,0xFD,0x07,0x29,0xFF,0xE6,0x77,
+	0x1A,0x8F,0xED,0x9A,0x3C,0xF9,0x12,0x28,0xA2,0xA2,0xFA,
+	0x47,0xA8,0x6E,0x38,0x5F,0x4B,0xF1,0x1B,0x49,0x94,0xD9,
+	0x40,0xC8,0x33,0xAC,0xC9,0x1E,0x56,0x7D,0x0D,0x9A,0xE6,
+	0x8E,0x68,0xD5,0x8C,0xD5,0xAB,0xAE,0x8D,0x08,0x49,0x8F,
+	0x91,0x35,0x9F,0xF7,0xE1,0xCB,0x9E,0x4B,0x7C,0x65,0x9E,
+	0x16,0x39,0x62,0x00,0x5A,0x9E,0xFA,0xA6,0xBD,0x75,0x40,
+	0x08,0x9B,0x13,0xBC,0xA5,0x23,0xEA,0x77,0x48,0x16,0xED,
+	0x57,0x5C,0x38,0x0B,0x9C,0x6F,0x87,0xA4,0x5D,0x11,0xD2,
+	0x07,0x4E,0xAA,0x60,0x70,0xA2,0x53,0x6E,0xF1,0x9A,0x48,
+	0x40,0x45,0x5D,0x6B,0x4B,0x11,0x00,0xC5,0x1F,0xDE,0x84,
+	0x01,0xE6,0x18,0x1B,0xEE,0xDE,0x7C,0x74,0xBC,0x7C,0x57,
+	0xF4,0xD5,0xEE,0xA6,0x68,0x85,0x2E,0x43,0x54,0x8D,0x8F,
+	0x30,0x8A,0x02,0xD1,0x85,0x77,0x25,0xAE,0x69,0x13,0x8A,
+	0x11,0x0E,0x2D,0x48,0x89,0x4A,0x2C,0xB3,0x13,0x94,0x51,
+	0x45,0x97,0xF3,0xAC,0xF4,0x43,0x32,0x03,0xD1,0xEC,0x24,
+	0x12,0x0A,0x03,0xF5,0x72,0x10,0xE2,0x79,0x74,0x93,0xC3,
+	0x65,0x55,0x84,0xA8,0x38,0xBF,0xA7,0xCB,0x6F,0xB4,0x02,
+	0x1F,0x1D,0x1B,0x7A,0x33,0xC2,0xA9,0x2B,0x7B,0xD9,0x56,
+	0x23,0x94,0x42,0x7B,0x55,0xF6,0x8A,0x89,0x1F,0x7A,0xAD,
+	0xFB,0x5A,0x66,0xA6,0x6C,0x46,0x61,0x68,0x5A,0x7B,0x3A,
+	0xEB,0x09,0x72,0x08,0xD8,0x68,0xB8,0x6D,0x61,0x93,0xDE,
+	0x7D,0xE2,0xEB,0xFD,0xE8,0x0B,0x42,0xB0,0xB8,0x7D,0xF7,
+	0xA3,0x2D,0xAC,0x34,0x1B,0xF6,0x51,0x5A,0x85,0x61,0xAE,
+	0x7F,0x11,0x85,0x7F,0xFA,0x08,0x41,0xE7,0xF4,0x08,0x1E,
+	0xA2,0x65,0x7B,0x24,0x3C,0x40,0x0D,0xD2,0x14,0xAD,0x30,
+	0xC4,0xEB,0x57,0x73,0xA5,0xC9,0xEF,0x74,0x2E,0xA8,0x16,
+	0xD2,0x5F,0x6D,0x41,0xE7,0x08,0x2C,0x69,0x20,0x23,0x48,
+	0x06,0x7C,0xCE,0x78,0x53,0x12,0xF0,0x27,0xB5,0xFC,0xBD,
+	0xA3,0xA8,0xB6,0x9D,0x2F,0xF3,0x18,0xCD,0x6D,0x9F,0x02,
+	0x9F,0x43,0xED,0x01,0x4E,0x20,0x00,0xA8,0x6C,0x1E,0x98,
+	0x2C,0xAD,0xBD,0x67,0xF0,0x50,0x55,0x3F,0xB5,0xEC,0x9B,
+	0x74,0xD9,0x65,0x34,0xBD,0x5E,0x0B,0x32,0x1D,0x28,0x28,
+	0xC0,0xF7,0xBA,0xCB,0xB8,0xC8,0x94,0x69,0xE1,0xCA,0xD3,
+	0x1E,0x78,0x99,0x46,0x63,0xAE,0x23,0x1F,0xC5,0xEB,0x1A,
+	0x10,0xDC,0x87,0x53,0x1B,0x4F,0xD4,0x69,0x6E,0xF5,0xA6,
+	0x8B,0xE0,0xCF,0x29,0x06,0x19,0x86,0x11,0xD2,0x37,0xB3,
+	0x2F,0x1B,0x2A,0xD6,0xD6,0x36,0x60,0x4B,0xD4,0x3C,0x0C,
+	0x1A,0xB2,0x7A,0xB4,0xF7,0xC7,0x2F,0xE7,0xFF,0xB9,0xA5,
+	0x38,0xB0,0xB6,0x9B,0x69,0x98,0xBF,0xEF,0x69,0xA7,0x69,
+	0xEC,0x58,0xA5,0x7B,0x44,0x43,0xA6,0x45,0x79,0x53,0xF7,
+	0x35,0x21,0x2F,0x6D,0xD9,0x1C,0xD9,0xCB,0x1B,0x5B,0xEE,
+	0xFA,0x92,0xEA,0xF0,0xEE,0x56,0xED,0xCE,0x3D,0xE0,0x2B,
+	0x7A,0x2D,0xF0,0x1D,0x6B,0x79,0x71,0x83,0x5A,0xD0,0x15,
+	0x1D,0x64,0xA3,0xC2,0x28,0xC3,0xB6,0x17,0xB2,0xDA,0xAD,
+	0xB1,0xE8,0xA6,0xD6,0x6B,0xED,0x97,0xAC,0x1B,0x61,0x82,
+	0xC9,0xB8,0xB6,0xD8,0x08,0x0E,0x57,0x9C,0xE7,0x27,0x0D,
+	0x3E,0xCC,0x4F,0xEA,0x0B,0x4F,0x37,0x0F,0x06,0x9D,0x41,
+	0x46,0xBC,0xE5,0x8C,0x79,0x17,0xF6,0x5D,0x7A,0x11,0xB4,
+	0xDB,0x61,0xF3,0xFD,0xE0,0xAA,0xD8,0xBB,0xBB,0xA2,0x0F,
+	0x40,0x3E,0x39,0xF0,0xEC,0x1E,0x1D,0xE8,0xE5,0xAF,0x02,
+	0xFE,0x93,0xF7,0x19,0xF6,0x11,0x68,0x45,0x77,0xDF,0x39,
+	0x62,0x81,0x53,0x8C,0xE0,0x05,0xE4,0xB8,0xD9,0x0B,0xC4,
+	0xC2,0xF7,0xD6,0x39,0x7D,0xC0,0xFC,0x31,0x5A,0x05,0x73,
+	0xE5,0x9F,0xE9,0xA1,0xBF,0x69,0xBD,0xD3,0xF7,0x5D,0xB7,
+	0xD3,0xEE,0x5A,0x87,0x85,0x5F,0xCD,0xD1,0x87,0xC6,0xE0,
+	0xB4,0x36,0xB5,0xA0,0xEF,0xBC,0x1F,0x44,0xBB,0xD9,0x48,
+	0x0E,0x29,0x7A,0x88,0x8A,0xF2,0x95,0x38,0x3A,0xFE,0xF9,
+	0x78,0x17,0xC7,0x49,0x9D,0xAB,0x26,0xEB,0x45,0x6F,0xF5,
+	0xF0,0xBE,0xF6,0x8F,0x20,0x27,0x79,0xB5,0x9D,0x32,0x85,
+	0x8A,0x30,0x9F,0x2F,0x98,0x24,0xAD,0x35,0x74,0x92,0x4A,
+	0x45,0xAE,0xDC,0xAC,0x42,0x12,0x21,0x6D,0xFA,0x38,0xC6,
+	0x3F,0xF9,0x4E,0xCA,0x5D,0x98,0x40,0x10,0x3E,0x7F,0x6C,
+	0x46,0xE3,0xD5,0x75,0xD0,0x6F,0x2E,0xD4,0xC8,0xFE,0x47,
+	0xD8,0xF9,0x03,0xAB,0x1D,0x3A,0x0D,0x04,0x17,0x07,0x2E,
+	0x53,0x42,0xFD,0xE2,0xB6,0x52,0x31,0xF2,0xE2,0x27,0x82,
+	0xC3,0x72,0x4B,0xDB,0xDF,0x2E,0x2B,0xB8,0x9A,0x95,0x1D,
+	0x1B,0x5D,0x7A,0x4C,0xDC,0xD0,0x08,0x0D,0xFE,0xAE,0xF0,
+	0xFC,0x94,0x9C,0x8D,0xF0,0x03,0x4E,0x23,0x47,0x87,0x91,
+	0x57,0x3D,0x20,0xF1,0x05,0x80,0x42,0xAD,0xC1,0x0D,0x3A,
+	0x42,0x0A,0x9C,0xDF,0xB0,0x87,0x02,0xC3,0xF5,0x01,0x79,
+	0xDF,0x70,0xC4,0x5F,0xF3,0xEC,0x20,0x7B,0xEB,0x33,0xAA,
+	0x3A,0x59,0x84,0xA7,0x39,0x79,0x7F,0x41,0x76,0x6F,0x53,
+	0xCF,0x1A,0xC0,0x71,0xFB,0xF7,0xC0,0xFF,0xEE,0x35,0xCE,
+	0x2B,0x80,0x7A,0xDD,0x6B,0x50,0x03,0x69,0x83,0x4A,0xB5,
+	0xAA,0x32,0xB4,0x0F,0xA5,0x8D,0x11,0xFB,0x0B,0xFF,0xDC,
+	0x12,0xE8,0xCB,0x3F,0xA4,0x07,0x0D,0x52,0x50,0xFC,0xD9,
+	0x6D,0xB0,0x2E,0x77,0xF2,0x8C,0xEF,0x62,0xA7,0x4D,0x50,
+	0xD3,0xE3,0x73,0x77,0x4F,0xDD,0x00,0x40,0x43,0x30,0x40,
+	0x2E,0x18,0xB0,0xD6,0x5D,0x24,0x5E,0x61,0xB7,0xB4,0x6D,
+	0xED,0x2A,0x1F,0x53,0x80,0x2B,0xB2,0xA2,0x40,0x79,0x2E,
+	0x59,0x0D,0xFB,0x14,0x9F,0x7D,0x16,0x5C,0xED,0xE6,0xD4,
+	0x7A,0xA8,0xD2,0x49,0x08,0x64,0x91,0xC6,0x9C,0xC5,0x55,
+	0xC1,0xAC,0x02,0xF1,0x2A,0x4C,0xFC,0xE8,0xD6,0xA0,0x1B,
+	0x3D,0x68,0x24,0xF4,0x84,0xB2,0xA4,0x42,0xFA,0xD7,0x8C,
+	0xD3,0xB4,0x71,0x70,0x8A,0xD8,0xE1,0x29,0x65,0x31,0xB3,
+	0xDA,0x59,0xAD,0xD6,0xFC,0xBC,0x7B,0x8A,0x02,0x38,0xC2,
+	0x2F,0x9A,0x8E,0xD8,0xDB,0x69,0x7C,0x92,0xB1,0x27,0xB7,
+	0x45,0xC7,0xE9,0x2A,0xBC,0x2D,0x4E,0xC6,0xCF,0x27,0x05,
+	0xE2,0x63,0xAF,0xA4,0x0B,0x3D,0x74,0x6B,0xB7,0x0B,0x8F,
+	0x0B,0x16,0x4C,0x7F,0x42,0xEE,0x45,0x82,0xC5,0xE1,0x76,
+	0x8E,0x8E,0xBE,0x6B,0x27,0x74,0x20,0xA5,0x20,0x3B,0xC7,
+	0xA2,0xFC,0xAD,0x14,0x07,0x8E,0xB3,0xC3,0x1B,0x3F,0xC9,
+	0xBB,0xD8,0x03,0x52,0xD3,0xA2,0xE8,0x3C,0x20,0xF7,0x55,
+	0x4F,0xBA,0xB4,0xFD,0xFB,0x05,0x38,0xAC,0xC2,0x6F,0x32,
+	0x0A,0x05,0x01,0x93,0xC7,0x90,0xA8,0x74,0xFC,0x91,0x75,
+	0x11,0xCE,0x7F,0xD9,0x50,0xC2,0xE4,0x67,0x8C,0x74,0x12,
+	0x26,0x49,0x34,0x09,0x9B,0x84,0x4B,0xC2,0x25,0xE3,0xF3,
+	0x0B,0x0A,0xD7,0xC5,0x08,0x65,0x62,0x77,0x09,0x27,0xC5,
+	0x5D,0x34,0x88,0x47,0xD4,0x28,0x71,0x92,0x07,0xC8,0x76,
+	0x07,0x08,0x29,0xAE,0xC4,0x8B,0xE2,0x17,0x49,0xC0,0x91,
+	0x21,0x08,0x5B,0xE8,0xB3,0xB9,0xF7,0xA4,0x9A,0x9C,0x41,
+	0xB2,0x92,0x03,0xF5,0xBD,0xA4,0xA7,0xB4,0x3E,0xFE,0x25,
+	0x25,0x95,0x18,0x99,0x26,0x29,0xEE,0x28,0x3D,0x5C,0x3A,
+	0x23,0x42,0x52,0x96,0x55,0x96,0x52,0x96,0x3F,0x12,0xA0,
+	0xA9,0x4F,0xBF,0xA4,0xF0,0x52,0x51,0x31,0x49,0x3B,0x85,
+	0x46,0x9E,0x26,0xEF,0x15,0xF6,0x0A,0xEB,0x0E,0x52,0xBE,
+	0x88,0x2F,0x94,0x68,0x2E,0xE2,0xEB,0xBF,0x80,0xAF,0x3B,
+	0xC9,0xA3,0xB8,0x45,0x31,0x6E,0x7E,0x0A,0xCF,0xB5,0xA1,
+	0x58,0xA3,0xA6,0x47,0x6A,0x75,0xDF,0xE9,0x57,0xCB,0xDD,
+	0xB2,0xEA,0x4E,0xE7,0x60,0x14,0xE6,0x8C,0xAB,0x8B,0xCE,
+	0x26,0xC0,0xEC,0xE7,0x02,0xA9,0x36,0x4C,0x9A,0xB1,0xB1,
+	0xC0,0x1D,0xFE,0x46,0xB6,0xBA,0x57,0xA7,0xF1,0x0A,0x48,
+	0x5E,0xE5,0xC9,0x73,0x3B,0x0C,0x82,0xCC,0x6B,0x8C,0x10,
+	0xDC,0x38,0x2C,0x41,0x19,0xE1,0xB4,0x77,0x02,0x8D,0xAB,
+	0x50,0x21,0x4C,0x0B,0xAD,0x2A,0xDC,0x48,0xF8,0x99,0x87,
+	0xE8,0xD6,0x6D,0x79,0x31,0x5B,0x5A,0xB7,0x0D,0x2E,0xFF,
+	0x16,0x9A,0xB9,0x4F,0x57,0x49,0x0C,0x4F,0xD3,0x85,0x8B,
+	0x91,0x68,0xA6,0x8B,0xFC,0x6B,0x74,0xEB,0xE8,0x9B,0x56,
+	0xCD,0x84,0x6B,0xA0,0x96,0x5E,0x5A,0x95,0x74,0xBD,0x24,
+	0x68,0xAA,0x9A,0x5F,0x28,0x23,0x7B,0x6E,0xEA,0x98,0xBC,
+	0xB3,0x7C,0x99,0x73,0x8B,0xB3,0xC2,0xE2,0x43,0x18,0x6C,
+	0x9E,0xE1,0x67,0xC2,0x32,0x3D,0x2E,0x85,0xA9,0x0F,0x55,
+	0x9A,0xF8,0x33,0xB9,0x37,0xF3,0x77,0x8B,0xF4,0xE2,0xAD,
+	0x39,0xFF,0x00,0x75,0x84,0x89,0x84,0xE7,0x10,0xA1,0x72,
+	0x1A,0x04,0xD9,0xA3,0x4B,0xAA,0xAA,0xC9,0x20,0x98,0x76,
+	0x38,0x63,0xC4,0x63,0xFC,0x02,0x3C,0x69,0x82,0x00,0x3F,
+	0xF5,0x41,0xE9,0xB7,0x9E,0x35,0xEE,0xFF,0xFD,0xB0,0x0E,
+	0x3D,0xA1,0xA1,0x5A,0xE9,0xCE,0xD4,0xA6,0xD7,0x0F,0x3C,
+	0x7F,0x87,0xED,0x85,0x81,0x03,0xCD,0xC8,0x43,0x49,0xA4,
+	0xC3,0x14,0xA8,0xC9,0x7D,0x68,0x8B,0x53,0x49,0x00,0x81,
+	0xE6,0x76,0xFF,0xBA,0x75,0x3F,0x11,0x2A,0x77,0xB7,0x5A,
+	0x7A,0x12,0x03,0xA3,0x8D,0xE7,0xF6,0x57,0xFD,0xB5,0x8E,
+	0xF6,0x44,0x18,0x51,0xC3,0x55,0xF4,0xC4,0x38,0xD1,0xA2,
+	0xAD,0x9A,0x3E,0xBA,0xEF,0xDA,0x79,0xA2,0x82,0x27,0x71,
+	0xEF,0x25,0x02,0xC2,0x4E,0x16,0x7D,0x80,0x11,0x14,0x44,
+	0x78,0x27,0xBF,0x8A,0xA7,0x54,0xED,0x10,0x1C,0x45,0xC1,
+	0x57,0xD7,0x74,0x3A,0x94,0xB0,0xA0,0x36,0xC2,0x25,0x25,
+	0xD4,0xC4,0xB2,0x6B,0x14,0x57,0x39,0xAF,0x45,0x35,0xDF,
+	0xAD,0xDE,0x55,0xF2,0x50,0x15,0x61,0x88,0xAD,0xEB,0x60,
+	0x7F,0xF7,0x70,0x65,0x77,0x3D,0xB8,0xD5,0x13,0x69,0x7E,
+	0x3F,0xB2,0xC6,0x72,0x38,0xF5,0xF2,0xBF,0xFB,0x4E,0xC4,
+	0xA9,0xFB,0xA9,0xAF,0x30,0xA8,0xFB,0x9A,0x22,0x88,0xFA,
+	0xB1,0x30,0x9B,0x35,0xAB,0x55,0x14,0x7A,0x51,0xB5,0x56,
+	0x99,0x60,0x68,0x8E,0x17,0x1B,0x16,0xB6,0x8F,0xA6,0x82,
+	0x3F,0x26,0xD8,0xA2,0x06,0x09,0xFF,0xC4,0x26,0x69,0x94,
+	0xFF,0x6A,0xE4,0xD5,0xEC,0x62,0xC7,0x90,0x79,0x28,0x75,
+	0xF1,0x91,0x23,0xE3,0x30,0x7B,0xE5,0x18,0x7B,0xAA,0xDD,
+	0xE3,0x16,0x6E,0xC1,0x60,0xD6,0x5F,0xC2,0x10,0xE2,0xB9,
+	0x07,0x42,0xD9,0x50,0x41,0x88,0x60,0x21,0xE9,0x97,0x9F,
+	0x3B,0x29,0xE2,0x89,0x02,0x41,0x6B,0xE5,0x6E,0x9E,0x50,
+	0xFA,0x9D,0x86,0xB2,0x0E,0x2A,0xCC,0x9A,0x2A,0xA1,0x67,
+	0x60,0xE4,0xE2,0x28,0x2D,0xFD,0x41,0xAB,0xDF,0x43,0x99,
+	0x97,0x32,0x41,0x4B,0xA0,0x36,0x31,0x95,0x0A,0xB1,0x4D,
+	0xBF,0x2D,0x3A,0x69,0xE7,0x86,0xB2,0xC1,0xA5,0x21,0x2C,
+	0xA5,0x0F,0xD9,0xAA,0x64,0x7F,0x8F,0xAE,0x7A,0xFA,0x30,
+	0x46,0x6F,0x08,0x32,0xF5,0x49,0x6C,0x18,0x52,0xC5,0x12,
+	0x73,0xC5,0xCF,0x9D,0x52,0x7F,0x25,0xDD,0x07,0x0A,0x95,
+	0x2E,0x34,0x95,0x14,0x69,0xF2,0x78,0x74,0xDE,0x75,0xA9,
+	0x00,0x45,0x10,0x8B,0xF0,0x4A,0xAB,0x3B,0xAA,0x76,0x08,
+	0xB6,0xF6,0x4B,0x54,0xA5,0x22,0x0D,0xAD,0x74,0x2C,0x44,
+	0x4C,0xC4,0x2B,0x59,0x59,0xEC,0x20,0x1E,0x8B,0x4D,0xD0,
+	0xF0,0x32,0x28,0x09,0x57,0x38,0xB3,0xA0,0xA3,0xF5,0x6B,
+	0xDB,0xDD,0x67,0xC4,0x59,0x08,0x87,0xF0,0x79,0xA9,0xA6,
+	0x82,0xCD,0x48,0x14,0x75,0xFD,0x43,0x4E,0x56,0xB4,0x57,
+	0x80,0xA8,0x64,0xFC,0x71,0x87,0x5C,0xA2,0x65,0x57,0x05,
+	0x06,0x94,0x0F,0xE9,0x5A,0x09,0x17,0xF1,0x8D,0xE7,0x90,
+	0xCF,0xFF,0x59,0xB2,0xA7,0x57,0x11,0xC2,0x05,0xDE,0xBE,
+	0xCA,0xAE,0x1F,0x77,0x2D,0x17,0x54,0x2B,0x55,0xB9,0x26,
+	0x03,0xB0,0x33,0xEE,0xB8,0x5C,0x0C,0x32,0x5B,0x24,0x46,
+	0x44,0x56,0x13,0x63,0xB9,0x86,0xA5,0x6B,0x8A,0x5B,0xAE,
+	0x89,0x65,0x28,0x1D,0xB6,0xC8,0x14,0xCB,0x67,0x08,0xC2,
+	0xA8,0x67,0x94,0x56,0x42,0x75,0xA7,0x88,0x16,0x07,0x49,
+	0x39,0x6E,0x83,0x52,0xCE,0x98,0x2C,0x74,0xE8,0xE9,0x29,
+	0x86,0x43,0x1B,0xAA,0x85,0x7A,0xE2,0xE2,0xFC,0x0E,0x5B,
+	0xCF,0xCA,0xCE,0xE6,0x15,0x0F,0xBF,0xA8,0x5C,0xA3,0x9A,
+	0x5D,0xC5,0x75,0x47,0xB4,0x0D,0x3D,0x49,0x6E,0xEB,0x08,
+	0xDE,0x35,0xB8,0x63,0x61,0x30,0xC6,0x89,0xE0,0xA9,0x68,
+	0xDE,0x6F,0x87,0x48,0x11,0xF0,0xED,0x4B,0x85,0xDB,0xAA,
+	0x89,0x1F,0xC4,0xF9,0x26,0xB0,0xA8,0xB7,0xFF,0x2A,0x45,
+	0x28,0xED,0xE3,0x38,0xCF,0x32,0x95,0x62,0x06,0x01,0x15,
+	0x87,0x8D,0xC2,0x22,0x24,0x47,0x74,0xCD,0x6C,0x3C,0x6C,
+	0xC5,0x28,0x80,0x65,0xA9,0xD5,0xAE,0x42,0x8F,0x2C,0xDB,
+	0xA8,0xBB,0x05,0x5B,0x88,0xF8,0xF0,0xFD,0x89,0xD5,0x26,
+	0xD9,0x2D,0x40,0x06,0x75,0xE7,0x04,0x49,0xB2,0xF3,0x2F,
+	0x90,0x6F,0xB9,0x49,0xF1,0xD1,0xC1,0x4E,0x4D,0xCD,0x25,
+	0x81,0x44,0x70,0xE9,0x4F,0x84,0xB5,0x26,0xDF,0x3C,0x87,
+	0x8B,0x32,0xB1,0x3A,0xEA,0xDE,0x45,0x1D,0x5B,0x85,0xA9,
+	0x20,0x2E,0x42,0x69,0xFB,0x28,0x02,0x52,0xBD,0x8D,0x70,
+	0x1A,0xE4,0xFC,0x4B,0x42,0xE8,0x6E,0xEB,0x79,0xB4,0x60,
+	0x4D,0x0D,0x53,0xC1,0xFD,0x53,0x2E,0x6A,0x15,0x18,0x6C,
+	0x7E,0x38,0xBD,0x45,0x93,0x7A,0x4F,0x1B,0x83,0xCA,0xD4,
+	0x15,0xAE,0x37,0x86,0xC3,0xA1,0xB7,0x22,0x56,0xE0,0x2C,
+	0x56,0x59,0xFE,0x25,0x53,0xC8,0x97,0x42,0xA2,0xC9,0x11,
+	0xF2,0x60,0x81,0xBB,0x90,0x03,0x42,0xF2,0x23,0x36,0xA8,
+	0x25,0xB8,0x9F,0x1C,0x20,0xF3,0x18,0xF1,0xE2,0xE6,0x00,
+	0xF6,0x96,0xC4,0x60,0xF3,0xDF,0xB7,0xBF,0x0A,0x67,0x2F,
+	0xBF,0x1E,0x38,0xF5,0x2E,0xB5,0xE0,0x60,0x4F,0x81,0x0B,
+	0x3C,0x9C,0x34,0x90,0x43,0xF6,0x8A,0xF1,0x97,0xF2,0xB6,
+	0xB9,0xEF,0xE3,0x6B,0x57,0x92,0x0D,0xD8,0x9A,0x19,0x08,
+	0x6C,0xC3,0x88,0x75,0x56,0x1A,0x49,0xAB,0x32,0x86,0x18,
+	0x7F,0x9A,0x8A,0x9B,0x5F,0x58,0x63,0x37,0xD8,0xA2,0x2C,
+	0xF0,0xB8,0xF2,0x15,0x50,0x20,0x6A,0xC1,0x0C,0xA8,0x7B,
+	0x72,0xF5,0x2F,0x4A,0xDC,0x75,0x00,0x6D,0xA7,0x79,0xDC,
+	0xD1,0xDB,0x26,0x7F,0xA5,0xC1,0xE1,0xCB,0xE5,0x8B,0xC8,
+	0x5A,0x8A,0xA9,0xA4,0x8D,0x8E,0x4D,0x79,0x6C,0x46,0x11,
+	0xC8,0xB7,0x2E,0xD9,0x97,0xFE,0xE7,0x3A,0x7D,0x68,0xAA,
+	0x82,0xBF,0x63,0x3B,0x30,0xEE,0xD6,0xE1,0x28,0x03,0xFE,
+	0xEA,0x05,0xC6,0xB5,0xA1,0xEF,0x8A,0x2C,0x42,0x41,0x15,
+	0x6D,0x32,0x6B,0xE4,0xD9,0xA1,0xE3,0xF1,0xAE,0xAD,0x87,
+	0x38,0xE2,0x08,0xDD,0x36,0xD6,0xF4,0x51,0xC1,0xAD,0x86,
+	0xED,0xF2,0x7D,0xF9,0x0E,0x3F,0xBD,0xB4,0x7E,0xA6,0xA1,
+	0x93,0x0C,0x92,0x11,0xC6,0x53,0x54,0x29,0xC7,0x71,0xB2,
+	0xDD,0x5D,0x2B,0xCC,0x53,0x8E,0x97,0xAB,0x8D,0x82,0x14,
+	0xE7,0x6A,0xB3,0x62,0x01,0xC1,0x55,0xA4,0xFF,0x65,0xDC,
+	0x61,0xC8,0x01,0x29,0x76,0xE2,0xE1,0xF4,0x87,0x2D,0xBC,
+	0xF3,0x81,0x18,0xC1,0x1D,0x5A,0xE6,0xB1,0x1E,0xD8,0x26,
+	0x68,0xD4,0x9E,0xE4,0xBD,0xFC,0x8F,0xE9,0x06,0xDE,0x70,
+	0x04,0xA2,0x8B,0x7E,0x3C,0x4C,0xAC,0x3A,0x94,0x65,0x82,
+	0x56,0x08,0x84,0x58,0x3B,0x36,0x02,0xBD,0x5D,0x25,0xD9,
+	0x8C,0xA1,0xA4,0x5A,0x57,0x7D,0xB7,0xEC,0x61,0x6D,0x17,
+	0x40,0x91,0x46,0x5E,0xD7,0x64,0x19,0xC3,0x2B,0x14,0x74,
+	0xE3,0x29,0x64,0x96,0xBA,0x44,0xFA,0x20,0x39,0xC7,0x71,
+	0x00,0x26,0xF0,0xF3,0x55,0xD4,0x04,0xF9,0x75,0x2F,0xAF,
+	0xCA,0x2E,0x0F,0x50,0xE2,0xFA,0xE5,0xAC,0x7D,0xAE,0xAA,
+	0x90,0x7B,0x35,0xF6,0x9A,0x81,0x01,0xBB,0xC5,0xFC,0xFE,
+	0x48,0x6F,0xC3,0x70,0x8B,0x13,0xB3,0x83,0x7C,0xFF,0xD3,
+	0x28,0x5C,0x2F,0xD6,0x68,0x38,0x98,0x1D,0x63,0xD3,0x22,
+	0x62,0xD7,0xAC,0x28,0x1F,0x64,0x21,0x83,0xBC,0x67,0x79,
+	0x7A,0x0F,0xCA,0x17,0x6F,0xEF,0x76,0x2B,0x63,0x98,0x73,
+	0x27,0x09,0x3A,0xBF,0x8F,0x71,0xE5,0xEE,0x7E,0x7D,0xAF,
+	0x12,0xBB,0xC6,0x1A,0x8A,0x85,0x62,0x22,0x82,0x49,0x51,
+	0x34,0x30,0x42,0x60,0x3F,0x1B,0x8E,0x90,0xBC,0xFF,0xB3,
+	0xCE,0x8C,0x26,0xA6,0xA2,0x1B,0x86,0xEC,0xC6,0x57,0x2D,
+	0x0F,0xA3,0x4D,0x48,0xDF,0xFC,0xAF,0x7D,0x77,0x3B,0x52,
+	0x50,0x2A,0x7D,0xEC,0x69,0x14,0x02,0x39,0x3A,0xAE,0x51,
+	0x0B,0xD2,0x65,0x68,0x64,0x94,0x87,0x1D,0xE9,0x5F,0x05,
+	0x85,0x96,0x8D,0x7E,0x6C,0x68,0xFB,0x13,0xF3,0x6E,0xAB,
+	0x65,0x5B,0xA2,0x0C,0x84,0x51,0x60,0xFF,0x4A,0x5D,0x94,
+	0xE8,0xAD,0x2B,0xDF,0x97,0x01,0x0F,0x3B,0x53,0xF6,0xAB,
+	0x7A,0x7B,0xCB,0xC5,0x20,0xCE,0xA3,0x21,0x23,0xC3,0x49,
+	0x1A,0x92,0x1C,0x26,0xE6,0xFB,0x17,0x0D,0xC7,0x56,0x88,
+	0x42,0x6C,0x14,0xB8,0x71,0x09,0x3F,0xF9,0xB4,0x04,0xBD,
+	0xD9,0xAB,0xD8,0xBE,0x6A,0x61,0xB0,0xCE,0x03,0x5B,0xFF,
+	0xAB,0x24,0x29,0x4E,0x7B,0xB3,0x38,0x7E,0x38,0xA2,0x2F,
+	0x04,0x6B,0x2F,0x68,0xD1,0x79,0x29,0x16,0xA3,0xCA,0xA0,
+	0xFC,0xAB,0x4C,0x25,0x74,0x58,0x89,0x96,0x81,0x74,0x2D,
+	0x64,0x0E,0xB3,0xC9,0xF9,0x25,0x8D,0xEF,0x33,0x3E,0xED,
+	0xFF,0x48,0xCF,0x52,0xF1,0x47,0xC2,0x74,0xC3,0x59,0x8F,
+	0x73,0xAB,0x77,0x7A,0xFF,0xC8,0x9C,0xDF,0x25,0x5B,0x64,
+	0x7C,0xFD,0x0E,0x01,0xD9,0x5E,0x26,0xD7,0x4F,0x2E,0x15,
+	0x5C,0x7B,0x17,0x2F,0xDA,0x05,0x68,0xAF,0x55,0xFD,0xE6,
+	0xDF,0xB7,0x91,0x97,0xBE,0x19,0xF2,0x1A,0xA3,0x81,0x75,
+	0x8B,0x5B,0x63,0x25,0x8F,0xE9,0xC0,0x34,0x84,0xDF,0xDE,
+	0x3C,0x2D,0x2C,0x70,0xC5,0x40,0x86,0xC5,0xA6,0x0A,0x5C,
+	0xA5,0xEB,0x0F,0x71,0xF8,0xE1,0x9D,0x35,0x9F,0x91,0x90,
+	0xA4,0x2D,0xB2,0x9E,0x39,0x78,0x42,0x4A,0x24,0xF8,0x0C,
+	0x8D,0x3F,0x20,0x02,0x0C,0x3F,0x81,0x93,0xDE,0x66,0x28,
+	0xC7,0x22,0x1B,0x27,0x72,0xEC,0x2E,0xAB,0xFC,0x0F,0x3E,
+	0xE5,0x32,0x4E,0xD8,0xD2,0x35,0x0B,0xDC,0x94,0x5A,0x54,
+	0x03,0x7F,0xAD,0x06,0x58,0x4F,0x1E,0x56,0x3B,0x18,0x9B,
+	0xCE,0x90,0x94,0xA4,0x33,0x35,0x2A,0x7D,0xA4,0x7C,0xFF,
+	0x43,0x44,0x6B,0x50,0x35,0x69,0x39,0xDA,0xFA,0xAB,0xDE,
+	0x39,0xA9,0xD9,0x94,0x8B,0x29,0x3B,0xDF,0xD6,0xCE,0x50,
+	0xBF,0x79,0x7C,0x5A,0x4A,0x92,0xA2,0x7C,0xE3,0x23,0xB7,
+	0x45,0x93,0x1E,0xE2,0x30,0x69,0x28,0xCA,0xD4,0xD5,0x34,
+	0xDF,0x9C,0xE0,0xE8,0x6B,0x91,0x97,0xD6,0x28,0x2A,0x11,
+	0xA4,0x02,0xDE,0x05,0x95,0xA4,0x87,0x58,0x91,0x34,0xA4,
+	0xA2,0x20,0x45,0xC9,0x34,0x7A,0x0B,0x74,0xB8,0xDC,0xD4,
+	0x8D,0xFA,0xCE,0x28,0x89,0x56,0xD8,0x74,0x41,0x47,0x2E,
+	0x94,0x74,0x34,0x0D,0xFD,0x76,0x6F,0xAB,0xFE,0xD7,0x0B,
+	0xAB,0xE7,0x41,0x7E,0x09,0xAE,0x63,0xFF,0x1E,0x5D,0xCF,
+	0xB7,0xAE,0x2F,0x37,0xFB,0x03,0x7C,0x3C,0x16,0x72,0xB0,
+	0xE6,0xF7,0x96,0x28,0x4B,0xB8,0xDB,0x9E,0xDF,0xF5,0x5B,
+	0xB0,0xFC,0x05,0x78,0xF2,0x54,0xDA,0xAA,0x04,0xCF,0x45,
+	0xCF,0x18,0xDE,0x88,0x0D,0xD9,0xBB,0xF5,0x84,0x61,0xEF,
+	0xDC,0x72,0x19,0x91,0xC5,0x9C,0x8C,0xEB,0xF8,0x60,0xFD,
+	0x3A,0x36,0x38,0x16,0x38,0x93,0x76,0x72,0x21,0xD5,0x9D,
+	0x9A,0x6F,0x00,0xB6,0x2E,0x0F,0xC9,0x84,0xAE,0x7F,0x3F,
+	0x28,0x38,0x87,0x1B,0x52,0x19,0x52,0x70,0x16,0xBD,0x84,
+	0xF8,0x38,0xB1,0xD8,0x2C,0x96,0xF2,0xD2,0x0D,0xD9,0xF6,
+	0xB7,0xF9,0xD0,0xB0,0xA4,0x8A,0x1B,0x5C,0xD2,0x52,0x42,
+	0xAB,0xE0,0xAF,0xB7,0xB0,0x1E,0x12,0xC1,0x6A,0xCF,0xE6,
+	0xDE,0x1E,0x65,0xDD,0x5E,0xA4,0x96,0x1B,0x4C,0x67,0xE5,
+	0x3F,0x83,0x31,0x49,0xA9,0x8B,0xCE,0x23,0x4B,0x8B,0x1A,
+	0x4B,0x13,0x32,0xAD,0xB0,0x56,0x73,0x88,0xD3,0xA3,0xDF,
+	0x05,0x3F,0x13,0xBF,0x3D,0x45,0x38,0xB7,0x3E,0x3A,0x59,
+	0x2D,0xEF,0x76,0xD1,0x5F,0x1C,0x95,0x58,0xC5,0xA0,0x20,
+	0xD9,0xD6,0x1A,0x16,0xE9,0xC5,0x05,0x60,0x6D,0xED,0xF3,
+	0x1A,0x9F,0x19,0x94,0x5C,0x95,0x92,0x67,0x22,0x8A,0xBE,
+	0x0C,0xFF,0x0D,0x64,0xE7,0x07,0xD3,0x54,0xAB,0x5A,0x88,
+	0x10,0x1B,0x3A,0x57,0xAF,0xDF,0xE8,0xC5,0xD9,0x1E,0xFF,
+	0xC6,0x30,0xC3,0x54,0xD1,0x0B,0xB7,0xEE,0x6C,0xCA,0x82,
+	0x3C,0xD9,0xEE,0x9B,0x9D,0xC2,0x36,0x28,0xBB,0xD4,0x26,
+	0x40,0x37,0xD8,0x02,0x75,0x67,0x19,0xE3,0x71,0x15,0x41,
+	0xFC,0x26,0xB2,0x26,0x5F,0x07,0x04,0x1C,0x59,0x6C,0x4F,
+	0x12,0x92,0x92,0x55,0xFB,0x01,0x56,0xAA,0x1F,0xD3,0xCD,
+	0x1B,0xE0,0x65,0xFE,0xE3,0x96,0x05,0xB7,0x63,0x23,0x2E,
+	0xEA,0xFE,0xB3,0x5F,0x9B,0x78,0xEB,0x78,0xFA,0xC6,0x67,
+	0xD8,0x0B,0xC4,0x5B,0x5C,0x85,0x55,0x83,0x1F,0xC7,0xE2,
+	0xBC,0x4F,0x0D,0x35,0xC9,0x18,0x5B,0x83,0x40,0xE0,0x1E,
+	0x0E,0xAC,0x3A,0xF8,0xC4,0x35,0x0D,0x9A,0xB9,0x41,0xCE,
+	0xD8,0xFB,0xA6,0xBB,0x0A,0x38,0x4F,0x02,0x40,0x33,0x22,
+	0x38,0xA9,0x08,0xDB,0xCC,0x1F,0xCE,0x0A,0xDE,0x85,0xF3,
+	0x5C,0xAB,0xFA,0x80,0x53,0x5F,0x5E,0x73,0xF9,0x25,0x96,
+	0xC7,0xC5,0x64,0xF2,0x7D,0x0C,0x06,0x3D,0xF0,0xB9,0xFB,
+	0x48,0xC7,0x7C,0xE9,0x21,0xBE,0x4D,0xE9,0x07,0xB7,0x59,
+	0xB3,0xC4,0x08,0xDF,0x5D,0x75,0x0E,0xC8,0x2B,0x6F,0x63,
+	0x1B,0x9E,0xEB,0xFC,0x85,0xFC,0x90,0x54,0xCA,0x7B,0x74,
+	0x20,0x5D,0x15,0xB4,0xDA,0x8F,0xF5,0x24,0x30,0x68,0xCC,
+	0xA2,0xC2,0xD7,0xC4,0xD4,0xA8,0xFF,0xAE,0x4F,0xA4,0xB8,
+	0xE6,0x05,0x6F,0x22,0xDE,0x34,0x86,0x84,0x2D,0x72,0x17,
+	0x16,0x20,0x10,0x2E,0xF6,0xD2,0xB2,0x8F,0xCF,0x3C,0x49,
+	0xF3,0x19,0xE2,0xDA,0xA1,0xA2,0x3F,0x89,0x62,0x8B,0xEC,
+	0x44,0x38,0x3E,0xD9,0x43,0x62,0xFE,0xF9,0x1F,0x85,0xC1,
+	0xFF,0x0E,0x65,0xFD,0x53,0x1B,0xC9,0xF7,0x46,0x54,0x40,
+	0x70,0xDE,0x88,0x07,0xBE,0xB5,0x4B,0xA1,0x21,0x46,0x2B,
+	0x37,0x58,0x74,0x65,0x3E,0x86,0x6A,0x22,0xBB,0x7C,0x27,
+	0x31,0x27,0x71,0x20,0x2A,0xBC,0xEE,0xBD,0xDD,0x43,0xBE,
+	0x1F,0x81,0xC4,0xC6,0x62,0x0D,0xB5,0xE5,0xEE,0x6D,0x71,
+	0xFB,0xAC,0x6E,0x2E,0xBC,0x04,0xCC,0xB8,0x5B,0x36,0x61,
+	0x9E,0x0A,0x5C,0x92,0xA0,0xEB,0xB4,0x7D,0xBD,0xBF,0xDE,
+	0x6D,0x6F,0xC4,0x87,0x24,0x08,0x05,0xE0,0x3E,0x73,0xDB,
+	0xA8,0x56,0x6E,0xAA,0x7E,0xA3,0x8E,0xE1,0xD5,0xA9,0x72,
+	0x43,0xE7,0x4C,0x4D,0xDC,0x34,0x52,0x1B,0x98,0x4D,0xE0,
+	0x99,0xC1,0x70,0x40,0x3B,0x17,0xF2,0x0A,0x2B,0xED,0xA6,
+	0x4A,0x57,0x87,0xB1,0xC5,0x5B,0x6C,0x0D,0xEF,0xA5,0x33,
+	0xB6,0x43,0x95,0xBC,0x57,0xA4,0x3B,0x9A,0x94,0xB5,0x07,
+	0x49,0x72,0xA2,0xC1,0x62,0x0A,0x6A,0x93,0xC2,0x02,0xE7,
+	0x5F,0xF6,0x33,0x98,0x03,0x90,0xFF,0xA9,0xEB,0xAF,0x48,
+	0xD5,0xDA,0x0F,0xB9,0x0A,0xD6,0xB4,0xF7,0x4F,0xC0,0x37,
+	0x49,0x7E,0x32,0x4B,0x28,0xE2,0x46,0x36,0xDE,0x26,0x6B,
+	0x09,0x14,0xE3,0x8E,0xBB,0xBA,0xAB,0x4E,0x6C,0xC0,0x67,
+	0x86,0x1D,0xA6,0x7E,0x67,0x9F,0xAB,0x65,0xF6,0x3B,0x51,
+	0x9E,0xF4,0x93,0xEE,0xFC,0xBE,0xC0,0x3E,0xA9,0x79,0x33,
+	0xDB,0x97,0x9B,0xB4,0x1E,0xE1,0xF1,0xA9,0x6E,0xF4,0x36,
+	0xC9,0x0D,0x2D,0x3A,0xA7,0xB8,0x10,0x84,0x99,0xFC,0x0D,
+	0x5D,0xC3,0x02,0x64,0xE1,0x12,0x41,0x99,0xC0,0xD6,0xB8,
+	0xEF,0x5E,0xCD,0xC0,0x98,0x15,0xA2,0x0B,0x61,0xEE,0x2E,
+	0x44,0xFF,0x2F,0x68,0x3F,0x1C,0x9F,0x84,0x51,0xB3,0xF9,
+	0x65,0x73,0x28,0x67,0xE5,0xBA,0x87,0xE2,0x9D,0xC7,0xE7,
+	0x5F,0x2F,0xBE,0xA2,0x01,0x47,0x34,0x69,0x77,0x31,0xE1,
+	0xDA,0x37,0x5F,0x6F,0x3D,0xD7,0x33,0x3E,0xAE,0x6C,0xAE,
+	0x81,0x53,0xBF,0xE8,0x0A,0xC8,0x67,0x84,0x2F,0x8A,0xA6,
+	0x74,0x61,0xE0,0xD9,0x3F,0xE6,0x56,0x79,0x66,0x5C,0x0F,
+	0xEE,0x17,0x5D,0x81,0x7B,0x1B,0x39,0xA8,0x68,0x10,0xD3,
+	0xE1,0xE3,0x93,0x27,0x5B,0x16,0x5C,0x86,0x0C,0xE3,0x0C,
+	0xCE,0xA3,0xF6,0x5D,0x80,0x62,0x47,0x04,0xA2,0xF3,0x23,
+	0x00,0xB0,0x10,0xF5,0x45,0xF1,0x3C,0xCE,0xBD,0x70,0x80,
+	0x31,0xEB,0x3D,0x6C,0xE3,0xCB,0x88,0x22,0x07,0xED,0xCD,
+	0xFE,0xA3,0x56,0x9A,0xD1,0xAA,0xAD,0xD3,0x0F,0xB1,0x7D,
+	0x6B,0x96,0xA7,0x01,0x6F,0x94,0x3D,0x92,0x9A,0xA7,0x85,
+	0xE2,0xA3,0xF2,0x74,0xE0,0x2C,0x39,0xDA,0x7A,0xE5,0x06,
+	0xCE,0x79,0x9B,0x12,0x60,0x2A,0xA9,0x04,0x2F,0xD8,0x91,
+	0x2F,0x38,0x7F,0x1B,0x1D,0x4A,0x9F,0x4B,0xF1,0xA1,0xFC,
+	0x42,0x58,0xDE,0xA2,0xB8,0x44,0xD8,0xC4,0xD6,0xEC,0x15,
+	0xCF,0x57,0x3C,0x77,0xD1,0x45,0x6B,0x9B,0xBE,0x55,0x6D,
+	0xF1,0x47,0xAC,0x94,0x5D,0xAF,0xC5,0xF0,0x5D,0x9F,0xD5,
+	0x81,0xBE,0x77,0xAD,0xCE,0x1F,0x89,0xCA,0xCF,0x8E,0x67,
+	0x41,0x4E,0x3C,0x74,0xBE,0x57,0x9A,0xED,0x71,0xDA,0x9E,
+	0x2A,0x4F,0xD3,0x4C,0xD0,0xDB,0xF0,0xAF,0x1A,0x75,0xC4,
+	0x86,0x49,0x44,0x1F,0xD4,0x07,0xB3,0x30,0xAD,0x10,0x10,
+	0xD9,0x60,0xFE,0x4A,0x96,0xEF,0x8A,0x7C,0x0E,0xD7,0x32,
+	0xF3,0x9D,0x24,0xF9,0xBA,0x4E,0x54,0xBF,0x8A,0xEF,0xA8,
+	0x88,0x9A,0xD1,0x19,0xC0,0x81,0xA6,0xD2,0x72,0xBA,0x05,
+	0xC6,0xF5,0x1D,0xD4,0x14,0x93,0xA0,0x46,0x50,0xFB,0xAA,
+	0x1D,0x70,0x6B,0x0D,0x48,0xF8,0x4F,0x6F,0xFB,0xFC,0x1A,
+	0x2C,0x50,0x2F,0x71,0xAF,0xA6,0x48,0xD5,0x88,0x4F,0xEF,
+	0x64,0xED,0x24,0xBB,0xE5,0xB0,0x78,0xD1,0x70,0x9F,0xC1,
+	0xDB,0xD7,0x85,0xD3,0x2E,0xF7,0x8A,0x21,0x7E,0x38,0xFF,
+	0x1E,0x46,0xDA,0xF5,0x2C,0x68,0x91,0xE7,0xB5,0x40,0xD4,
+	0x5C,0x5F,0x9C,0xF1,0x53,0xB8,0x65,0x83,0x2B,0xDD,0xA7,
+	0x46,0x4C,0xD7,0x66,0x4D,0xF3,0xC8,0x80,0x47,0x20,0x32,
+	0xD1,0x25,0x0C,0xC5,0x76,0xAC,0xF2,0x86,0xAF,0x51,0x8A,
+	0x65,0x60,0x11,0x47,0x6F,0x5E,0xEE,0x8B,0x2D,0x70,0x91,
+	0xDB,0x04,0xA5,0x1B,0x2B,0x75,0xE6,0x2B,0x9D,0x15,0x06,
+	0x02,0x0E,0x6C,0xD3,0xC8,0x87,0xFD,0xFB,0xD8,0xA7,0x26,
+	0x08,0x93,0x73,0xBA,0xBA,0xC8,0x1B,0x92,0x86,0x9A,0xE0,
+	0x47,0x24,0x40,0xB2,0xBA,0x49,0x34,0xA8,0x09,0x7A,0x13,
+	0x7A,0x2F,0xEF,0xB7,0xBC,0xED,0x41,0xB1,0x13,0xB5,0xC5,
+	0x54,0x0C,0x7F,0x26,0x9B,0x03,0x8E,0x35,0xA9,0xB2,0x49,
+	0x7F,0xC2,0x25,0x54,0x63,0xE0,0x26,0x36,0x34,0x86,0x09,
+	0xCB,0x16,0x62,0x8D,0x72,0x57,0x78,0x9D,0xAE,0x0C,0xCA,
+	0xBA,0xAE,0xE8,0x4E,0x73,0x61,0x53,0x3F,0xFF,0x5D,0x06,
+	0x81,0x9A,0xBA,0xE5,0x84,0xA6,0xA0,0xD8,0xEA,0xAE,0x21,
+	0x14,0x1A,0x22,0xA3,0x96,0x57,0xEE,0x29,0xD2,0xFD,0x6A,
+	0x0B,0xC9,0xFC,0xE8,0xD0,0x2C,0x2D,0x1D,0x5C,0x6E,0x76,
+	0x3D,0x90,0xF5,0x60,0x1E,0x89,0x6C,0x11,0xF8,0xB7,0x10,
+	0x1D,0xFF,0x52,0xD6,0x54,0x53,0x22,0xA0,0x4A,0x4B,0x23,
+	0x97,0xA0,0x72,0xCE,0x63,0x45,0x1F,0x0F,0xF8,0xAB,0xB7,
+	0x61,0x65,0x00,0xDF,0x0E,0x1D,0x5D,0xFD,0x23,0x1B,0x0C,
+	0x09,0xF2,0x94,0x28,0xC9,0x75,0xD5,0xAA,0x1F,0xE3,0xB7,
+	0xC2,0x73,0x7F,0x71,0xB1,0x1C,0x9D,0xD1,0xB1,0xBE,0xD8,
+	0x5E,0xED,0xDD,0x98,0xB6,0x9D,0xA3,0x52,0x98,0x95,0xCA,
+	0x74,0x8C,0xFC,0x78,0x38,0x4A,0x18,0xB8,0x68,0x40,0xB6,
+	0xF0,0xE5,0xF8,0x3E,0xBA,0xC2,0x89,0x11,0x7E,0x33,0xFF,
+	0x1D,0x5C,0xBE,0x5D,0x33,0xC2,0xF6,0xEB,0x2B,0xEA,0x03,
+	0x63,0xE1,0x7A,0xC5,0x04,0x7C,0x0B,0x4A,0x24,0x98,0x48,
+	0x6A,0x76,0x57,0xB6,0x85,0x82,0x7C,0x4F,0xE1,0xC5,0x9F,
+	0xCF,0x65,0x01,0xFD,0x45,0x2F,0xE0,0x03,0xF6,0xF5,0x81,
+	0xC2,0xFB,0xF7,0xAA,0x30,0x7A,0xB3,0x8B,0x74,0x96,0xA0,
+	0xD2,0xB9,0x67,0x2A,0xA2,0x8C,0x35,0x48,0xEE,0xC2,0x20,
+	0xE9,0x83,0x42,0x5D,0x70,0x77,0xDF,0x16,0xBC,0x5A,0xBF,
+	0xDF,0x78,0x8C,0x3F,0xB4,0x44,0xBF,0xCA,0x92,0x1E,0x53,
+	0x7F,0xD5,0x22,0x47,0x7F,0xF4,0xF1,0xD8,0xC5,0x8A,0xF6,
+	0x2C,0x53,0xDA,0xF9,0x16,0x06,0xCF,0xED,0x30,0x54,0x32,
+	0x39,0xE4,0x74,0xC3,0x65,0xED,0x60,0x0D,0xF0,0x20,0xE6,
+	0x28,0x82,0xB1,0xA6,0xC2,0x7F,0x3A,0xE2,0xEB,0xD3,0x8A,
+	0x47,0x3F,0xBE,0x70,0xC8,0x86,0xFC,0x8D,0x6E,0x1A,0xE6,
+	0x10,0xCC,0x10,0xED,0x3A,0x04,0x1A,0xC1,0x0C,0xDB,0x07,
+	0x3C,0x48,0xF7,0x68,0x95,0xB0,0x21,0x90,0x6C,0x3F,0xA5,
+	0x78,0x79,0x67,0xA3,0x2A,0xC1,0x5B,0x4C,0x0B,0x96,0x9A,
+	0xD0,0xEE,0x3E,0x0F,0x0F,0x96,0xE2,0x43,0xF8,0xC3,0x45,
+	0x90,0x05,0xF3,0x3D,0x4B,0x0A,0xB1,0xF0,0x07,0x94,0x94,
+	0xC4,0xC2,0xDD,0xE7,0x83,0xBC,0x9B,0xA4,0x5C,0x3A,0x6F,
+	0x3E,0xDC,0x89,0x8E,0x4E,0xA0,0xE2,0x48,0xEB,0xD9,0x12,
+	0x92,0x53,0xA2,0xAB,0xA2,0x4C,0x1C,0x05,0x6C,0xC9,0xF2,
+	0x39,0x64,0x65,0xD6,0x8E,0x76,0x91,0x6E,0xC0,0xC6,0x43,
+	0x11,0x66,0x64,0xBA,0x84,0xFB,0x2D,0x96,0x27,0x8E,0x0E,
+	0x02,0x97,0x2D,0x5F,0xCF,0x5C,0x08,0x7A,0x21,0x13,0x99,
+	0xB3,0x90,0xCC,0x5F,0xB1,0x78,0x18,0x9F,0xB7,0xDE,0x09,
+	0x82,0x9E,0x5F,0xCB,0x04,0xA9,0xB3,0xA8,0x8C,0xFE,0xAB,
+	0x67,0x6E,0x63,0x13,0xE6,0x33,0x16,0x70,0x44,0xBF,0x54,
+	0x4C,0xA2,0xC4,0x03,0xF5,0x07,0x1A,0x07,0x1A,0xEB,0x14,
+	0x3E,0x2B,0xB4,0xF8,0x14,0xA3,0xCD,0x9A,0x19,0x39,0xDC,
+	0x85,0xF9,0xDD,0x05,0xA9,0x2F,0x2B,0xDC,0x25,0x62,0xA4,
+	0xCF,0xAF,0x50,0xD2,0xBE,0x80,0xFE,0x6A,0xE8,0xE2,0xA8,
+	0x84,0xE7,0xD2,0xDE,0x95,0x6F,0xE7,0x9A,0x4D,0x24,0xC7,
+	0x3D,0x34,0x28,0x10,0x79,0x8B,0x98,0xB0,0xA2,0xE7,0x74,
+	0x28,0x42,0x83,0x0C,0x3A,0x9B,0x41,0x41,0x02,0x2D,0xCE,
+	0xC7,0x27,0x61,0xC9,0xD0,0x90,0xB7,0x16,0x6E,0xC0,0x66,
+	0xD0,0xAC,0xC4,0xE3,0x99,0x77,0xA8,0x45,0x8D,0x29,0x46,
+	0x53,0x6F,0xFD,0x65,0x09,0xE8,0xFE,0x27,0x93,0x96,0xFB,
+	0xE6,0x8D,0xA9,0xB7,0x37,0xC1,0x71,0x4F,0x5F,0x42,0x38,
+	0xF7,0x47,0x68,0xEF,0x5E,0x07,0xA9,0x57,0x1F,0xB9,0x90,
+	0xBA,0x11,0x8B,0xA8,0x19,0xCB,0x41,0x74,0xAE,0x07,0xBE,
+	0x83,0x64,0x26,0x17,0xD6,0xC8,0x2E,0x6A,0x79,0xDC,0x53,
+	0x3D,0x2A,0x32,0x13,0x03,0xB5,0x88,0x63,0xAC,0x34,0x82,
+	0x59,0xDF,0x0C,0x44,0xE7,0xA5,0xAB,0xEB,0x4C,0x6F,0xDE,
+	0xDA,0xFE,0x2F,0xB9,0x1F,0x7B,0x7C,0x8E,0x0E,0x64,0x63,
+	0x46,0x8F,0xBE,0x03,0xE5,0x4F,0x51,0xEF,0x05,0xA3,0xFC,
+	0x64,0x47,0xDF,0x3B,0x36,0x48,0x46,0xEA,0x22,0x3C,0x24,
+	0x63,0xDD,0xE7,0xD1,0xA1,0xEC,0xAC,0xA8,0x2A,0x4A,0xA1,
+	0x80,0xAE,0xF0,0xB4,0x2F,0x58,0x52,0xD5,0x9E,0xC6,0xB3,
+	0x3D,0x17,0x51,0x6A,0x21,0x93,0x42,0x75,0xE7,0x6E,0x35,
+	0xEF,0x15,0xCE,0x6C,0xD4,0x46,0x57,0x3E,0x01,0x29,0x0B,
+	0x33,0x9B,0x82,0xCB,0x2F,0x6D,0xFC,0xF7,0xD7,0xBA,0xD0,
+	0xE3,0xF5,0xE8,0x8B,0x46,0x48,0xDB,0x67,0x02,0xAE,0xA2,
+	0x1D,0x31,0x38,0x1C,0xF3,0x68,0x04,0x62,0x73,0x2C,0x5C,
+	0xF8,0x8E,0xB6,0x38,0x59,0x4F,0xBD,0x47,0x3D,0x54,0x75,
+	0x4A,0xDC,0xC7,0x49,0xDF,0x6C,0xB5,0x1A,0xE8,0xBF,0x5A,
+	0x78,0x08,0x04,0xFE,0x07,0xE4,0x14,0x07,0x19,0x23,0xAC,
+	0x64,0xE6,0x9F,0xAE,0xA2,0x73,0xF2,0xA0,0xF6,0x56,0x11,
+	0xC0,0x60,0xDF,0x44,0xD9,0x4D,0x17,0x3A,0xB6,0x02,0x5C,
+	0x1A,0xDC,0x47,0xAD,0x8E,0x85,0x79,0xE8,0xA0,0x18,0x1B,
+	0x03,0x57,0x56,0x20,0x53,0xD2,0x71,0x1C,0xD7,0x5F,0xDB,
+	0xEC,0x8F,0x42,0xD8,0xE8,0xAC,0x28,0x29,0x90,0x4A,0xA9,
+	0x74,0xA8,0x5C,0x2F,0x21,0xE7,0x13,0xC7,0x89,0x29,0x74,
+	0x61,0xEE,0x32,0x18,0xC9,0x58,0xD4,0x86,0x5D,0x7A,0x3A,
+	0x4B,0x3C,0x0F,0x3F,0x23,0x24,0x7E,0x91,0xF6,0x14,0xE0,
+	0x5E,0xD3,0x6E,0x9A,0x33,0x6D,0x94,0xEE,0x25,0x6E,0x5B,
+	0x71,0x83,0x24,0x83,0x79,0x16,0xF3,0x58,0xE1,0x66,0x23,
+	0xAB,0xB6,0xFE,0xFC,0x88,0xAB,0xC3,0xDF,0x3F,0x82,0xDC,
+	0x33,0x47,0x2F,0x04,0x6E,0x2E,0xB3,0xB9,0xC0,0x8E,0x39,
+	0x4B,0x16,0xEC,0x17,0xE1,0x74,0x09,0x62,0xE0,0x72,0x1D,
+	0x6D,0x10,0x76,0xC1,0x4E,0x46,0x3B,0xA8,0x25,0x70,0x1F,
+	0xF8,0x92,0x96,0x12,0xC0,0x32,0x2A,0xCC,0xEF,0x84,0xD8,
+	0x49,0x1D,0x0A,0x3C,0xE1,0xBA,0x01,0x96,0xA0,0x30,0xCC,
+	0xBB,0xE0,0x0D,0x7B,0xE2,0x97,0xF5,0x6A,0x41,0x77,0xC2,
+	0x37,0xA6,0x37,0x81,0xCB,0xF9,0xF5,0x13,0x16,0x3E,0xA9,
+	0xE8,0x4D,0x68,0xCC,0x71,0x1F,0x0B,0xCA,0x9B,0xAF,0xC2,
+	0xCE,0x82,0xA2,0x36,0x32,0x3B,0x65,0xC3,0x2B,0xEF,0xF4,
+	0xEF,0x36,0xE0,0x6C,0xD8,0xFE,0xE0,0x22,0x09,0x14,0x08,
+	0xF5,0xF2,0x66,0x09,0x10,0xFA,0x48,0x1B,0xC2,0xEB,0x11,
+	0x6B,0xB0,0x05,0x69,0x98,0x78,0xBC,0xE5,0x78,0x03,0xBE,
+	0x31,0x56,0xD1,0x32,0x50,0xB0,0xD0,0xF9,0x86,0xAD,0xFA,
+	0xE0,0xB5,0xAD,0xDC,0x69,0x5F,0x76,0xFF,0xA8,0x6F,0x94,
+	0x77,0xB6,0xA1,0x10,0x69,0x35,0x1B,0xF8,0x40,0xBB,0xE2,
+	0xBA,0x8C,0xE5,0x7B,0x49,0xBD,0xB9,0xFE,0x70,0x8A,0xC4,
+	0x97,0x05,0xF7,0xA1,0x41,0xEC,0xE4,0xC2,0x3D,0x74,0x43,
+	0x33,0xD9,0x5D,0x95,0xAC,0xF2,0x17,0x84,0x0A,0x26,0x6D,
+	0xA2,0x57,0x03,0xCE,0x73,0x72,0xE7,0x29,0x26,0xFD,0xD9,
+	0x51,0x8D,0x43,0xB1,0x29,0x23,0xB3,0x99,0x71,0x56,0x0E,
+	0xE5,0x4F,0x6F,0xBD,0x84,0x57,0xE9,0x5C,0xC4,0x6A,0xF4,
+	0x87,0x1A,0xFE,0x70,0x3F,0x04,0x62,0xEB,0x59,0x22,0xB9,
+	0xEF,0xF8,0x95,0x44,0xB7,0xAE,0x35,0xC7,0x57,0xDC,0xB9,
+	0x63,0xE0,0x1B,0x36,0x13,0x1E,0x85,0x03,0x60,0x78,0x28,
+	0xAC,0x86,0x66,0x80,0x95,0x64,0xBA,0x0D,0x9E,0x0F,0xEC,
+	0x60,0x8B,0x39,0x2E,0x40,0x2A,0x89,0xE0,0x3B,0x0C,0xDE,
+	0xD5,0x3B,0x96,0xCB,0x62,0xB5,0x28,0xB7,0xF3,0x5E,0x79,
+	0xF9,0x00,0x3A,0x4A,0x98,0x9B,0xA0,0xE9,0xCB,0xE0,0x96,
+	0x37,0xE4,0x43,0x37,0x14,0x9E,0xEB,0x08,0x22,0x98,0x13,
+	0xE9,0xFF,0x01,0xEC,0xED,0x26,0x37,0x47,0xF9,0x50,0xF6,
+	0x94,0x84,0x2D,0x59,0x57,0x8E,0x0A,0xEA,0xB0,0xAA,0x3C,
+	0x42,0x44,0x16,0x18,0xC9,0xA6,0x18,0x73,0xF7,0x1F,0x5A,
+	0xBE,0x4B,0xD6,0xB5,0x57,0x33,0x81,0xD6,0xF5,0x98,0xC8,
+	0x48,0xD6,0xA5,0xCC,0xE6,0x3A,0x16,0x5E,0xD5,0xF4,0xA5,
+	0xC6,0xA0,0x85,0x1E,0x64,0x69,0x2B,0x56,0x28,0x05,0x01,
+	0x54,0x55,0x91,0x25,0x9A,0xA3,0xCC,0x96,0x9E,0x40,0x31,
+	0x32,0x08,0x9B,0xD0,0x8C,0xC6,0xAA,0x5A,0x5D,0x1C,0x60,
+	0x69,0x98,0x1F,0xAC,0xD4,0x06,0xEF,0xBF,0x3F,0x29,0x0E,
+	0x5E,0xC7,0x75,0x64,0x6A,0x3A,0xF9,0x79,0xF2,0x34,0x3A,
+	0x38,0x10,0xA8,0x9A,0xCA,0x95,0x07,0xF8,0x24,0xA0,0x62,
+	0x8D,0x5E,0x6A,0x4D,0x0A,0x22,0x81,0x79,0xC7,0x08,0x95,
+	0x82,0xA2,0x6F,0xC5,0xE9,0x58,0x72,0x7B,0xCE,0x28,0xFB,
+	0x51,0x4B,0xC9,0xDD,0xCC,0x67,0x3A,0x0F,0xF3,0x51,0x93,
+	0x2D,0xF0,0x93,0x6A,0xAB,0x32,0x6F,0xF1,0xF0,0x01,0x77,
+	0xF3,0xD8,0x46,0x6B,0x90,0xF4,0x6E,0xF6,0x80,0x1D,0xEA,
+	0xE0,0xCF,0x6D,0x96,0x2C,0xB4,0xB3,0x11,0x2D,0x3C,0x9F,
+	0x25,0x04,0xA9,0x2C,0x6F,0x68,0x6B,0x5B,0x2C,0xBD,0xDB,
+	0xE2,0xE3,0x9C,0x75,0xED,0x66,0xD1,0x75,0xA8,0xC2,0xD9,
+	0x86,0x8C,0xB3,0xA1,0x98,0xBE,0xF4,0xFE,0xA6,0xEF,0x91,
+	0x20,0xF2,0x8A,0x6F,0x5D,0x91,0x3B,0x09,0xAE,0x77,0xDF,
+	0x02,0x61,0x00,0xE4,0xD5,0x65,0xC6,0x41,0xAA,0xA2,0x62,
+	0x29,0x09,0x60,0x5B,0x16,0xFC,0xDD,0x31,0xA6,0xAC,0xB5,
+	0x7D,0x92,0xF6,0x34,0x96,0x0D,0x3E,0xFD,0x20,0xB6,0x80,
+	0xD8,0x3B,0x13,0x5B,0x0B,0x47,0x95,0xC3,0x27,0x68,0x6D,
+	0x96,0x79,0xAC,0xCD,0x09,0xC7,0x0F,0x5E,0x6C,0x7A,0x4A,
+	0x09,0xF9,0x8E,0x99,0xF9,0x8A,0x96,0xC6,0xB8,0x72,0xF1,
+	0xF1,0xEA,0xD0,0x8F,0xD1,0x36,0xC9,0x77,0x6C,0xFD,0x21,
+	0xE3,0xAE,0xD0,0xDC,0xB2,0x49,0xA9,0xEC,0x0E,0xD8,0x80,
+	0xCD,0xA0,0x06,0x36,0xAB,0x97,0x78,0x47,0xE1,0xA9,0x36,
+	0x21,0xF4,0x5A,0x3A,0x18,0x04,0xB4,0xA8,0x40,0xAD,0xD6,
+	0xF7,0x33,0xF6,0x02,0x44,0x2D,0xEB,0xAB,0xCB,0x86,0x1C,
+	0x7B,0xF0,0x90,0xDD,0x36,0x74,0xB5,0x76,0xF5,0x0A,0xA2,
+	0xF4,0x64,0x2B,0xE9,0x8A,0xB4,0xEC,0x64,0x9B,0x5C,0xA2,
+	0x00,0x5C,0xB4,0x2B,0x93,0x72,0x18,0xB4,0x3F,0x55,0xC8,
+	0x3C,0xC5,0xE3,0x37,0x51,0xF4,0x19,0xE6,0x19,0x11,0xEC,
+	0x67,0x6A,0xFE,0x39,0x45,0x77,0xD4,0x96,0xC1,0x2C,0x8A,
+	0x49,0x7C,0x94,0x93,0xAD,0xFB,0xF1,0xD8,0x65,0x49,0xB4,
+	0x74,0x5E,0x3A,0xDD,0x9A,0xEB,0x9A,0x1D,0x1E,0xC5,0x02,
+	0x5B,0x1D,0xBE,0xB8,0x6E,0x91,0xDF,0x9D,0xEA,0xA9,0x96,
+	0x5F,0xE6,0x74,0xFC,0x90,0xAF,0x71,0xFB,0xFF,0xF6,0x80,
+	0x10,0xBB,0x00,0x7F,0x06,0xEA,0x15,0x40,0xC5,0x2B,0xCA,
+	0x87,0x0B,0xBF,0x30,0xFB,0x66,0x60,0x81,0xCB,0xF6,0x8B,
+	0xCB,0x7C,0x5A,0xDB,0x4F,0xDE,0x3F,0x90,0x80,0xA3,0x75,
+	0xF1,0x62,0xF6,0x94,0x4E,0x7B,0x16,0x39,0x7D,0x86,0xF4,
+	0xCC,0xC6,0x34,0xD3,0xE2,0x27,0x7C,0x1D,0xE8,0xEE,0xD7,
+	0x32,0x74,0xA6,0x9A,0xF3,0x64,0x64,0x7C,0x5F,0x15,0xDD,
+	0x94,0x4D,0xA1,0xBE,0x8C,0xE2,0x23,0x1C,0xD6,0xC4,0x25,
+	0x8D,0x83,0x57,0x2E,0xA7,0x92,0xFB,0xAE,0xBF,0x8E,0x02,
+	0x65,0x41,0xC5,0xC9,0x32,0xAF,0xAD,0x33,0xC4,0xD4,0xB8,
+	0xB1,0x46,0xAD,0x64,0xC6,0x50,0x39,0x93,0xAD,0x7F,0x86,
+	0x7B,0xED,0xC6,0x7E,0x90,0x57,0x60,0x47,0x76,0x51,0xBB,
+	0x77,0xD1,0xC9,0x05,0xFB,0x26,0x05,0x3B,0x45,0xA8,0xD8,
+	0x14,0x05,0x7D,0xB3,0x17,0xCB,0xD3,0xF4,0xD1,0xD9,0xAF,
+	0xF4,0xB3,0x3E,0x71,0x46,0x62,0x71,0x31,0xC9,0x3C,0x6D,
+	0x65,0x21,0x75,0x8F,0x55,0x81,0xB5,0xCC,0xBF,0x86,0x92,
+	0x47,0x38,0xDB,0x39,0x7A,0xD0,0xF5,0x63,0x8C,0x94,0x79,
+	0x3E,0x8E,0xFB,0xAC,0x6F,0xCD,0xD3,0xFF,0x06,0x7A,0x7D,
+	0x45,0xB8,0x3F,0x48,0x70,0xC0,0x92,0xCD,0xDD,0x95,0xB9,
+	0xC6,0x57,0x42,0x95,0x32,0x3B,0x65,0x82,0xF3,0xF9,0xEA,
+	0x0F,0xC0,0xEE,0x79,0x31,0xDF,0xE9,0x1B,0xB9,0x05,0x93,
+	0x2F,0x94,0xE6,0x85,0x26,0x49,0x17,0x23,0x64,0x3D,0x42,
+	0xB2,0xE8,0x99,0x30,0xF5,0x76,0xA4,0x05,0xF5,0x79,0x96,
+	0x1C,0xC2,0xC7,0xC7,0xEE,0x75,0x3D,0xF0,0xAF,0x80,0x2B,
+	0x7A,0x69,0x75,0x4C,0xE1,0xEF,0xBD,0x89,0x42,0xC0,0x7E,
+	0x57,0xE6,0x54,0x46,0xD2,0x11,0x99,0x43,0x6C,0xF2,0x2F,
+	0x33,0xEF,0xB2,0xFD,0x7B,0x35,0x59,0x7B,0x32,0x78,0x34,
+	0x62,0x10,0xD2,0xEA,0x44,0xBA,0x06,0x42,0xDC,0x95,0x72,
+	0xA5,0xBF,0xFC,0xE0,0x5F,0xAC,0xAF,0xAA,0x27,0x1A,0xE6,
+	0x93,0x26,0x9E,0xA9,0x0C,0x83,0xD3,0xC6,0x06,0xA1,0xA6,
+	0x96,0x7D,0x6C,0x9A,0xF6,0x94,0x7B,0x68,0x35,0x87,0xFD,
+	0xE2,0x26,0x50,0xC2,0xD7,0x69,0x06,0xB8,0x5B,0x83,0x2E,
+	0x62,0x86,0x64,0x67,0x79,0x90,0xF0,0x6C,0x7C,0x25,0xA9,
+	0xE6,0x90,0xAB,0x80,0xDD,0xC2,0x87,0xC7,0x5A,0xF5,0x85,
+	0x08,0x32,0xF2,0xC6,0xD6,0xE4,0x8E,0x58,0x87,0x6A,0x9B,
+	0xA7,0x0F,0xDA,0x0E,0xDB,0xAE,0x25,0xB8,0x73,0xEB,0x6F,
+	0xDA,0x55,0x0F,0x0E,0xFB,0x9F,0x62,0x0F,0x2A,0xE1,0x7E,
+	0xC4,0x04,0x5D,0xB8,0xBD,0xA4,0xE9,0x3C,0x86,0x2D,0x59,
+	0x9A,0x36,0x20,0x06,0x2C,0xCD,0xC9,0x45,0x1E,0x44,0xC2,
+	0x4A,0x96,0x72,0x6C,0x78,0x57,0x9E,0x62,0x69,0x4B,0x0B,
+	0x6A,0xFC,0x0B,0x2A,0x8F,0x9E,0x22,0x1B,0x1C,0x36,0x8E,
+	0x38,0xB4,0x93,0xF5,0xDE,0xA0,0x34,0xE1,0x68,0xFB,0xAE,
+	0x63,0x19,0x2C,0xE5,0x55,0x27,0x37,0xE1,0x62,0xF0,0x36,
+	0xDD,0x45,0xB1,0x81,0x20,0xFE,0xAA,0x4D,0xC2,0x1A,0xEF,
+	0xCE,0xC5,0xB5,0x5F,0x02,0x85,0x39,0xEB,0x36,0x69,0x5F,
+	0x05,0x29,0xAC,0xAB,0x34,0xF3,0xD1,0xE2,0x0E,0x81,0x88,
+	0x4C,0x3F,0xD1,0x1D,0x84,0xDD,0x83,0x3E,0x7D,0x42,0x94,
+	0x16,0xE6,0x7E,0x35,0x36,0xD2,0x1B,0xBA,0xAF,0x69,0x19,
+	0x09,0x0A,0x9A,0x9A,0xC2,0x45,0xFB,0x17,0xF3,0xE1,0x7F,
+	0xD4,0xF2,0xDD,0xF1,0xF8,0x90,0x69,0x94,0x6C,0x7E,0x45,
+	0xD8,0x0B,0x95,0x0A,0x2F,0x7E,0xF4,0xB8,0x4C,0x38,0xF2,
+	0xFD,0xB6,0x28,0x6A,0x20,0x84,0x90,0x4A,0xBF,0x57,0x79,
+	0xE0,0x1E,0xCA,0xE6,0x36,0x63,0xF0,0x8D,0xF6,0xCE,0xB7,
+	0x1A,0x05,0x9C,0x7E,0xE4,0xCE,0x64,0x8B,0x35,0xBA,0xD0,
+	0x26,0xE4,0xDD,0x76,0x2A,0x92,0x0D,0x20,0x34,0x73,0x9E,
+	0xA5,0x1D,0xAB,0x18,0x4D,0xDA,0xBB,0xC7,0x8D,0xA9,0x45,
+	0x6E,0x8C,0xAF,0x12,0x63,0x0F,0x8B,0xC4,0x1C,0x92,0xCC,
+	0xB6,0xE6,0x05,0x6B,0x1B,0xAA,0x92,0x88,0x14,0xBF,0x60,
+	0x09,0x69,0xEC,0x8F,0xBD,0x02,0xC1,0x57,0xA2,0xBF,0x64,
+	0x66,0x69,0x54,0x7B,0x58,0xD5,0x6B,0xA9,0x9A,0x43,0x7E,
+	0x45,0x8B,0xE8,0x63,0x0D,0x75,0x03,0xA9,0xF8,0x4A,0x7B,
+	0x2C,0xA7,0xD7,0xE4,0xF8,0x7F,0xEA,0xD0,0xEE,0xA9,0x4E,
+	0x80,0xCE,0x68,0x56,0xCC,0x42,0x29,0x57,0x64,0x02,0xC2,
+	0xBF,0x25,0xB7,0xA2,0x30,0x2D,0x36,0x5C,0xE0,0xD7,0x6C,
+	0xA2,0x1F,0xCD,0xFE,0xE4,0xB3,0x6C,0xC0,0x47,0x99,0xD1,
+	0xD4,0x8F,0x59,0x79,0xDE,0xA6,0xF4,0x38,0x45,0x22,0xEB,
+	0xE6,0x16,0x81,0xD9,0x19,0xA3,0x49,0xB5,0x14,0xFE,0xA5,
+	0xBC,0x7A,0x51,0x29,0x5E,0xD4,0x7E,0xA4,0x4A,0x82,0xD2,
+	0x08,0x4A,0x02,0xBB,0x07,0x85,0x29,0x10,0x44,0xA0,0x4B,
+	0x05,0xE4,0x91,0x26,0x37,0x30,0x91,0x6C,0xD1,0x13,0x8E,
+	0x46,0xD6,0x4A,0x7F,0x51,0xCB,0xA0,0x3E,0xD6,0xC8,0x94,
+	0x56,0x29,0x20,0x1A,0x30,0xCE,0x9B,0x89,0x85,0x4B,0xAA,
+	0xE9,0x4E,0x79,0x20,0x84,0x90,0x31,0x11,0x58,0xDC,0x92,
+	0xB3,0x50,0xB1,0xC3,0x8D,0xB6,0x8F,0x3E,0xA3,0x1E,0x9D,
+	0x62,0xFA,0x7C,0xA7,0x4A,0x2C,0xB9,0x5F,0x0D,0x1C,0xEC,
+	0x32,0x6F,0xFB,0xC3,0xBA,0xE0,0x2C,0x98,0xE1,0x9D,0x71,
+	0x39,0x7F,0x54,0xCD,0xFE,0x0C,0xC9,0x92,0xB1,0xC1,0x04,
+	0x43,0xB3,0xCD,0xAB,0xA8,0x88,0x01,0xE0,0xDC,0x62,0x7A,
+	0x31,0xA0,0xF6,0xA7,0x5A,0x6D,0x91,0x0A,0xD6,0xE5,0x14,
+	0x81,0xEE,0xE2,0xBF,0x60,0xAA,0x10,0x36,0x7A,0x97,0x75,
+	0xBA,0xB0,0x29,0x9E,0x96,0x55,0xB5,0xB9,0x98,0x1C,0xD9,
+	0xCE,0x22,0xD3,0x29,0x7F,0x14,0xDA,0xC4,0x04,0x44,0x19,
+	0x91,0x11,0x21,0x6F,0xD0,0x47,0x27,0x4E,0xE2,0xB2,0x4F,
+	0x47,0xA0,0x95,0xA2,0x15,0xF6,0x49,0x8B,0x38,0xE6,0x00,
+	0xBA,0x90,0xFA,0xF1,0x2A,0x2C,0x83,0xFA,0x55,0x45,0xF1,
+	0x1C,0x5D,0x69,0x3F,0x78,0xE4,0xDF,0xF1,0x56,0xE9,0x1D,
+	0x53,0x21,0x96,0x29,0x83,0xEC,0x8B,0x92,0x7F,0x21,0xF5,
+	0x0F,0x98,0xB8,0xE6,0x33,0x6D,0xAF,0x2C,0x5B,0x23,0x41,
+	0xD5,0x15,0xF9,0x81,0x16,0x30,0x2A,0x4D,0x75,0x0D,0x9A,
+	0x15,0x1B,0x5E,0x62,0xED,0x6D,0xC5,0xD6,0xB5,0xBE,0x6B,
+	0xD5,0x96,0xAF,0xD7,0xC2,0x2F,0xD6,0x4C,0x8C,0x1C,0x74,
+	0xFE,0x8C,0x3E,0x94,0x85,0x1E,0x54,0xC1,0x9F,0x94,0x76,
+	0xC6,0xEA,0xD0,0xFC,0x63,0x88,0xCD,0xAE,0xFE,0xF4,0x41,
+	0x19,0xC3,0xEF,0x8C,0x18,0xDD,0x75,0xF6,0x7F,0xE4,0x2C,
+	0xC5,0xF3,0xAA,0x12,0x96,0xF6,0x71,0x63,0x3B,0xA1,0x64,
+	0x7A,0x8F,0x6C,0x8A,0x68,0xA9,0x23,0x59,0xDB,0xEB,0xC8,
+	0x7A,0xE9,0x77,0xEC,0xDA,0x92,0x7A,0x39,0x59,0xA6,0x85,
+	0x7C,0x33,0xF3,0x3C,0x50,0x46,0x0D,0xA7,0x34,0xF7,0x74,
+	0x28,0xFB,0xF3,0x7A,0x3E,0x3C,0x3C,0x18,0x14,0xEE,0x6B,
+	0x6B,0x34,0xA7,0xEA,0xFC,0x49,0x06,0x80,0x95,0x0B,0xB6,
+	0xE4,0x56,0x1F,0x48,0xC7,0x98,0x09,0x73,0xEA,0xA8,0xBA,
+	0x70,0xD7,0x04,0xDF,0x66,0x4A,0x7E,0xD0,0x64,0xDE,0x88,
+	0x38,0x28,0x2B,0xF9,0x03,0x25,0x73,0xBB,0x10,0x56,0xE7,
+	0xE7,0xB1,0x8E,0x08,0xF0,0x7F,0xE7,0x73,0x36,0xB8,0x60,
+	0x3F,0x88,0x3B,0x44,0x03,0xF7,0x08,0x5D,0x03,0x32,0x0E,
+	0x19,0xCE,0x29,0x8E,0xCC,0xCF,0xD1,0xE7,0xC7,0x33,0x10,
+	0x8F,0xFC,0x39,0xE1,0xB7,0x65,0x46,0xDE,0xCD,0x12,0xD2,
+	0x1F,0x75,0x33,0xA6,0x2C,0x0D,0xE5,0x9F,0x5B,0xFD,0x55,
+	0x38,0x85,0x01,0x1F,0x90,0xB0,0x7A,0xAD,0x28,0xB0,0x8D,
+	0x0C,0x4E,0x78,0x05,0x39,0x51,0xB3,0x89,0xCF,0x7E,0xF9,
+	0xE7,0x29,0x74,0x93,0xA8,0xE3,0xDE,0xE7,0x9E,0x11,0x34,
+	0xB9,0x2B,0x58,0xE1,0xBF,0xD4,0xE0,0x45,0xCF,0xA9,0xC6,
+	0xC9,0x8D,0xF0,0x3B,0x6E,0xF4,0x04,0x98,0x52,0x09,0x24,
+	0x43,0xE9,0x1F,0x68,0xB9,0xBB,0x6A,0xA5,0x5A,0xF7,0x4B,
+	0xF9,0x35,0x2A,0x3D,0x1C,0xE0,0x67,0xFD,0x7C,0x0D,0xD3,
+	0x8D,0x50,0x92,0xCA,0xA1,0x5E,0x17,0x29,0x77,0xF9,0xB1,
+	0x6C,0xCF,0x77,0x6F,0x72,0xCF,0x48,0x82,0xD2,0xC2,0x8A,
+	0x71,0xE1,0xFC,0x61,0x8B,0xBB,0xF0,0x50,0x08,0x84,0x70,
+	0x48,0xAD,0xD7,0x42,0x79,0x60,0x77,0x69,0xB9,0x6F,0x17,
+	0xF9,0x77,0xFB,0xB4,0xEE,0x13,0xAF,0xE3,0x47,0x38,0x8A,
+	0x71,0xE4,0xAA,0x5D,0xC7,0xC7,0x60,0x8E,0x50,0x7A,0xFD,
+	0x2E,0x49,0x35,0x4E,0x26,0x60,0x97,0x2B,0x56,0x64,0x30,
+	0xFD,0x22,0xAE,0xC4,0x74,0x17,0x7F,0x0B,0x76,0xEE,0xF1,
+	0x69,0xFE,0xCE,0xF2,0xBF,0x9D,0xE0,0x7D,0xA3,0xA1,0xDE,
+	0x41,0x27,0x79,0x1E,0x17,0x03,0x20,0x19,0x32,0x37,0xBA,
+	0x1A,0x76,0xC0,0x2D,0x03,0x7B,0xCF,0x80,0x8F,0x87,0x8D,
+	0x99,0x9E,0x89,0x5D,0x79,0xD9,0x7F,0x11,0xE7,0x76,0xB7,
+	0x37,0x76,0x47,0x1D,0xF1,0x46,0x7C,0x46,0xF3,0x84,0x7A,
+	0x98,0x05,0xF3,0x0D,0x42,0x9B,0x21,0x65,0x44,0xC0,0xBB,
+	0x87,0xD9,0x1D,0x17,0x87,0x0C,0x4C,0xD7,0x2F,0x0D,0xFE,
+	0xEB,0xB7,0xF4,0x92,0x6C,0xE5,0x14,0xD1,0x24,0xB7,0x80,
+	0xA4,0xF2,0x7F,0xE8,0xED,0xA2,0xAD,0x0D,0x1E,0x68,0x21,
+	0xE2,0x9F,0x31,0x0F,0xC2,0xE5,0x89,0x1A,0xFF,0x83,0x55,
+	0xFE,0x6C,0x18,0xA4,0x55,0xBD,0x04,0x47,0xFC,0x4B,0x91,
+	0x08,0x32,0x8C,0xF0,0x73,0xC7,0xE8,0xD3,0xB4,0x3E,0xBB,
+	0x92,0x6A,0x2C,0x18,0x9F,0xB8,0xBE,0xED,0xF6,0x3D,0xF7,
+	0xE1,0x93,0x16,0x05,0x69,0x58,0xB5,0x72,0xF4,0x1B,0x72,
+	0xE8,0x98,0x4C,0x0A,0x5C,0xE2,0x8C,0x1B,0xCB,0xBB,0xDA,
+	0x13,0xCC,0xAA,0x17,0x9F,0xB3,0xAD,0xFB,0xB3,0xCF,0x54,
+	0x4A,0xBF,0x76,0x19,0x44,0x1A,0x8B,0x89,0x05,0x49,0x3E,
+	0x3F,0x19,0xB4,0xCA,0xAD,0x96,0x47,0x30,0xEE,0xCD,0x06,
+	0x29,0xE0,0x54,0x33,0xF5,0x9F,0x9C,0x4C,0x21,0x3B,0x7B,
+	0xA6,0x53,0xED,0xA4,0x93,0x41,0xB0,0xCA,0x0C,0xA0,0xF4,
+	0x61,0x77,0x0D,0x35,0x20,0x87,0x08,0xF7,0x25,0x61,0xC9,
+	0x06,0x07,0x3A,0x68,0x62,0xF8,0xD0,0xDC,0xE3,0xAB,0x47,
+	0x3E,0x61,0xEC,0x5C,0x19,0x09,0x3C,0x0B,0x63,0x71,0x23,
+	0xD8,0x03,0xD5,0xA7,0x6B,0x5B,0x4C,0x9A,0x9B,0xEF,0xB1,
+	0x4C,0xD8,0x76,0xDD,0x93,0x91,0xDF,0xB6,0xE1,0xBE,0x35,
+	0xDA,0xD1,0x2F,0x5E,0xC6,0x6F,0x7F,0x4E,0x21,0x71,0xBD,
+	0xAE,0x11,0xAD,0x7D,0x6F,0x64,0xBE,0xE0,0xFA,0xA8,0xB9,
+	0x7E,0xC5,0x9F,0x09,0xE6,0x12,0x0C,0xC8,0x0F,0x22,0xA5,
+	0x0D,0x88,0x49,0x0A,0xA0,0x09,0x32,0x38,0xBB,0x8A,0xCE,
+	0x28,0x7A,0x01,0x54,0x52,0x0B,0x68,0x40,0x90,0xB0,0xFD,
+	0x03,0xA7,0x2D,0xD4,0x0B,0x88,0x2D,0x55,0x6C,0xE9,0x3F,
+	0x50,0x92,0x85,0x9F,0x55,0xBE,0xAE,0xE9,0x6B,0xDF,0xBE,
+	0xCC,0xD2,0xFB,0x77,0x8B,0xE0,0xEF,0x54,0x2E,0x5A,0x31,
+	0xAC,0xDE,0x5A,0x1F,0x23,0x3D,0x82,0xE4,0x53,0x78,0xB6,
+	0x95,0xD8,0x2C,0x49,0x08,0xA3,0x06,0x98,0x66,0x6C,0x76,
+	0x6C,0x68,0x49,0x44,0x7B,0x8B,0x54,0x8B,0x0C,0x7B,0x07,
+	0x1C,0xE8,0x65,0xEE,0x23,0x43,0x24,0xA9,0xFB,0x50,0x10,
+	0x09,0xA5,0x3B,0x62,0x68,0x47,0xDA,0x8C,0xF3,0x55,0x4F,
+	0x6B,0x46,0x8E,0x45,0xBE,0x7D,0xE3,0xE5,0xD4,0xDA,0x8D,
+	0xE2,0xCA,0xF3,0x9B,0x62,0xB5,0xB1,0xD0,0xC2,0x7E,0x86,
+	0x74,0x20,0x39,0x6D,0x4F,0xAA,0xA4,0x5C,0x7B,0x97,0x28,
+	0xCD,0x37,0xE8,0xEC,0x77,0x61,0xEF,0x98,0x27,0x2D,0x19,
+	0x07,0x72,0x0C,0x42,0x6B,0x11,0x3F,0xB2,0x7C,0x3D,0x61,
+	0xFD,0xEB,0xAB,0x96,0x66,0xCC,0x0A,0x91,0x3A,0xEC,0xA2,
+	0x91,0x63,0xB3,0x4B,0x01,0x97,0xD7,0x5E,0x93,0xC1,0x1B,
+	0x93,0x59,0x95,0xF2,0xC1,0xDB,0x25,0xE5,0xDF,0x58,0x3F,
+	0xB2,0x99,0x54,0xCF,0x04,0x55,0x6B,0x06,0x8C,0xD8,0x44,
+	0x92,0x27,0xEC,0x7A,0x79,0x51,0xD2,0x4A,0x1D,0x4F,0xA6,
+	0xA4,0x43,0xD5,0xCB,0x5A,0x6A,0x1A,0xD1,0x6B,0x28,0x1F,
+	0xC5,0xC1,0x8D,0xB1,0xCD,0xD5,0x4C,0x7A,0xDD,0x50,0x28,
+	0x8C,0x54,0x9E,0xC8,0xF7,0x3A,0x9F,0xAB,0x83,0x78,0x27,
+	0x42,0xAB,0xCE,0xAB,0x5B,0x36,0x1A,0x92,0xEE,0xFF,0xA9,
+	0xC8,0xC8,0x98,0xF5,0x27,0x1C,0x00,0x2B,0xAA,0xA0,0x6E,
+	0x6B,0x5F,0x4C,0x71,0xE6,0xC6,0x67,0x65,0x3B,0xA6,0x82,
+	0xB8,0xC8,0x6E,0x2A,0xC5,0xA2,0x0D,0xF7,0x67,0xF6,0x56,
+	0x52,0x37,0x38,0xF9,0xBA,0xE5,0x46,0xBF,0x34,0x5E,0xEC,
+	0x77,0x58,0xFE,0x01,0x0C,0xD9,0x0A,0xA3,0x20,0x82,0xCE,
+	0xB9,0x9A,0xBD,0x4F,0x9D,0xF1,0x92,0x90,0x10,0xB8,0x1F,
+	0x7E,0x67,0x70,0xC7,0xF3,0x05,0x81,0x3B,0xD5,0x27,0x21,
+	0x9E,0xC1,0x0A,0xD2,0x65,0xE3,0x78,0x4E,0xD7,0x53,0xAF,
+	0x5C,0xB7,0xC2,0x90,0x3D,0x93,0xEC,0xBD,0x9C,0xF7,0x97,
+	0x24,0x3D,0xB7,0xD3,0x01,0x7C,0x1E,0xC2,0x8A,0x36,0x6F,
+	0x96,0x37,0x70,0xCA,0x73,0xC0,0xF8,0xA5,0xC2,0x59,0xD8,
+	0x9B,0xED,0x4F,0x59,0x0F,0x27,0x62,0x55,0xB7,0x9A,0x2E,
+	0x2B,0x06,0x84,0x5A,0x4F,0x4B,0x0A,0x0A,0xF2,0xE6,0x63,
+	0x0B,0xCE,0x2F,0xDC,0x89,0x15,0x69,0x43,0x15,0x86,0xA1,
+	0xF2,0x70,0xA5,0x79,0x7D,0x94,0xD6,0x49,0xB9,0xB7,0x4F,
+	0xF3,0xAC,0x17,0x0F,0x0A,0xEB,0x4F,0x39,0x36,0x4C,0xC3,
+	0xDE,0x56,0x89,0x0E,0xCE,0x0E,0xCD,0xD5,0xA8,0x59,0x95,
+	0x77,0x3E,0xF3,0xCF,0x1B,0x6F,0x8B,0xD5,0x29,0x59,0x2C,
+	0x5D,0x4A,0x5D,0x89,0x5D,0xE8,0x80,0xAD,0x85,0xF5,0x3C,
+	0x7C,0x35,0x07,0x7B,0xA0,0x56,0xF4,0x76,0x55,0x04,0x59,
+	0x28,0xDE,0x70,0xB2,0xD0,0xAB,0xDC,0x2F,0x55,0x05,0x89,
+	0x8D,0x9F,0xA3,0xA8,0x16,0x9D,0xD7,0xB5,0x21,0x7A,0x9D,
+	0x18,0x26,0xB6,0x10,0x7C,0x12,0xE3,0x29,0xE2,0xEE,0xF3,
+	0x03,0x45,0x33,0x45,0x42,0xC7,0x6A,0x4A,0xF5,0xAA,0x6F,
+	0xA8,0x7E,0xD5,0x71,0xBB,0x3C,0xA8,0x01,0x25,0xCF,0x05,
+	0xC3,0x8B,0x14,0x33,0x51,0x50,0xBA,0x63,0x3A,0xD9,0x22,
+	0x35,0xEA,0xBD,0xD6,0xAB,0xA4,0x19,0x40,0xFA,0xA7,0x9F,
+	0x69,0xDC,0x17,0x96,0x97,0xDE,0xD1,0x53,0xD2,0x82,0x4E,
+	0x71,0x48,0x2D,0x44,0xC4,0xCB,0x61,0xBA,0x8D,0x74,0xDC,
+	0x42,0xEA,0x7F,0x32,0x77,0xC5,0xE2,0xEB,0xC0,0xA9,0x53,
+	0x3B,0x20,0x11,0x25,0xDC,0x41,0xB0,0x39,0xF2,0x44,0x56,
+	0x66,0xCB,0x7C,0x0B,0x2E,0xEB,0x29,0xAB,0x8E,0x5C,0x3F,
+	0xA6,0xB8,0xC3,0x41,0xBE,0x27,0x2D,0x7F,0xB3,0x76,0x76,
+	0x93,0x5A,0xF6,0x50,0x61,0x2C,0x3F,0x82,0x71,0x20,0xAE,
+	0x3A,0x30,0x83,0x35,0x53,0xAF,0x6D,0xBB,0x97,0x80,0xF1,
+	0xC5,0x7E,0x21,0xEF,0xE3,0x8C,0xE0,0x13,0xFD,0x46,0xEF,
+	0x6E,0xBC,0xC3,0xCD,0xDC,0xAD,0x13,0xBE,0x9C,0x63,0x11,
+	0x2C,0x4B,0xCF,0x79,0x21,0x24,0x1A,0x6E,0xCE,0x9A,0x4E,
+	0xDB,0x93,0x4F,0x37,0xBD,0x79,0x36,0xEE,0x00,0x01,0x92,
+	0x37,0xCE,0xB3,0x08,0xF3,0xEE,0x03,0xA0,0x37,0xD9,0x86,
+	0xDC,0xED,0xC2,0xF0,0xA3,0x4D,0x5C,0x63,0x1B,0xCD,0x2A,
+	0x88,0xED,0xA6,0x85,0x78,0xAE,0x7E,0x66,0x6B,0xC3,0xD4,
+	0xF2,0xAF,0x85,0x26,0xE1,0xAF,0x6B,0x0C,0x7F,0x5C,0xAE,
+	0xF6,0xF4,0xDF,0xFD,0xAD,0x87,0x49,0x36,0x71,0xA1,0x80,
+	0xB5,0x33,0x6D,0x4F,0x61,0x9F,0x52,0xF8,0x2F,0x86,0xB5,
+	0x91,0x12,0x38,0x3B,0x65,0x5A,0xD3,0x10,0x26,0xF4,0x2D,
+	0xEB,0xE5,0x65,0xF1,0x07,0x3C,0x7C,0x9A,0x25,0xEB,0x9B,
+	0x90,0x1D,0x36,0xCD,0x24,0x28,0xBC,0x47,0x22,0x33,0x72,
+	0xD0,0x68,0xFA,0x88,0xB1,0x93,0x08,0x46,0x4E,0xC8,0x36,
+	0x41,0xBE,0x2E,0xB5,0xC5,0xD8,0x57,0xF8,0x08,0xCC,0x9D,
+	0xFD,0xB2,0x8F,0x24,0xE4,0x05,0xDD,0x50,0x04,0xC4,0x2B,
+	0x1D,0xFB,0x69,0xCA,0x4E,0x22,0xFA,0xCB,0x19,0x81,0xA3,
+	0x59,0x03,0x24,0x79,0xEB,0xE7,0x49,0xC9,0x46,0x8E,0xF3,
+	0xDA,0xC4,0x51,0x5B,0x3D,0x79,0xA6,0x21,0x51,0x5B,0x5E,
+	0xA1,0xF4,0x1F,0xA7,0xEA,0x0B,0x4A,0x48,0x72,0x70,0x4E,
+	0x86,0xD5,0xFD,0x1C,0x78,0xF6,0x76,0x2D,0x48,0xAD,0xFA,
+	0x96,0x59,0x35,0x0A,0x2E,0xC7,0x79,0x30,0xA6,0x9E,0x21,
+	0xFB,0x3A,0xD5,0x70,0x34,0x09,0x91,0x07,0x8D,0x15,0x2E,
+	0x2B,0x93,0x7F,0xAB,0x6D,0x28,0xB5,0x4A,0x81,0xB2,0xFA,
+	0x88,0xED,0x16,0x03,0x14,0xAF,0x2E,0xA3,0x78,0x37,0xCA,
+	0x60,0x1B,0x41,0x91,0x6D,0xB5,0x52,0x8B,0x8D,0xF7,0xB1,
+	0x57,0x2D,0x60,0xE8,0xE0,0xFD,0x52,0xB0,0x17,0x48,0xD7,
+	0xBE,0x94,0xF3,0xB8,0xA2,0x5F,0x10,0x76,0xFA,0x59,0x8E,
+	0x70,0x12,0xBB,0x1E,0xD9,0xFA,0xCC,0x25,0x22,0xD3,0xA3,
+	0x80,0x08,0x78,0x91,0xC5,0x6B,0x22,0xFC,0x17,0xEA,0xF4,
+	0xEC,0x25,0x0D,0x39,0x3A,0x67,0x6C,0xCD,0x0F,0x2F,0x0B,
+	0x41,0x44,0xCC,0x57,0xB8,0xE0,0x7B,0xD3,0xA2,0x99,0x64,
+	0xBB,0xC7,0xCF,0xC0,0xAC,0x1B,0xD7,0xAA,0x34,0x0A,0x82,
+	0xAE,0x4F,0x21,0xA9,0x5F,0xB5,0x1B,0xC0,0xEC,0x88,0xFE,
+	0x59,0x53,0xC8,0x21,0x86,0x92,0x12,0xDE,0x94,0x10,0x6A,
+	0x66,0x74,0x09,0xEC,0x6C,0x2E,0x56,0x51,0x83,0xCD,0xC9,
+	0x7D,0x33,0xDD,0xB7,0x12,0xB4,0x54,0x74,0xD8,0xD2,0xCE,
+	0x79,0xA9,0x46,0xA5,0x6F,0xBC,0x0D,0x4B,0x16,0xDD,0x53,
+	0x60,0x96,0x5D,0x2A,0x7A,0x61,0x05,0x0E,0x4E,0xB9,0x9F,
+	0x72,0x97,0x0F,0x1A,0xF8,0xC9,0x7F,0xA7,0xAA,0x46,0xB3,
+	0x89,0x79,0x9A,0xBC,0x94,0x2D,0x51,0xAD,0x49,0xBB,0x1A,
+	0x2E,0x8F,0xE5,0xEF,0x95,0x81,0x5A,0x9E,0x71,0xB5,0x16,
+	0x20,0xB5,0xA7,0x37,0x8D,0x05,0x3E,0x68,0xB1,0x90,0xBA,
+	0x5D,0xC5,0x57,0xE3,0x56,0x4B,0x96,0xF7,0x9E,0xC9,0xCF,
+	0x27,0xC9,0x0B,0x05,0xFF,0x98,0x4B,0x22,0xD9,0xC6,0xAA,
+	0xF6,0x87,0x61,0x9A,0xB0,0x17,0xE4,0x2B,0x59,0x7B,0xD2,
+	0x4A,0xB2,0x18,0xA7,0x5A,0xBF,0xF2,0xB3,0x2A,0x4D,0x25,
+	0x9A,0x0C,0xF7,0x05,0x4F,0x9F,0x9E,0xCA,0xF4,0x61,0x8B,
+	0x2F,0x83,0x0B,0x98,0x9E,0xC8,0x19,0xAB,0xC6,0x6C,0xBE,
+	0x7B,0x63,0x1C,0x35,0x9B,0xDF,0xE7,0x2F,0xE2,0x70,0x15,
+	0xE9,0xA6,0x12,0x6E,0x6A,0x00,0xE3,0xE0,0xF5,0xFA,0x50,
+	0x32,0x7C,0x6B,0xAE,0xB0,0x91,0x36,0xDF,0xE5,0x07,0x83,
+	0xF9,0x30,0x80,0x1A,0x81,0xCA,0xBE,0x3B,0x01,0xEF,0x25,
+	0xD4,0xF8,0x39,0x2D,0x46,0xBD,0x83,0x64,0x53,0x36,0xFB,
+	0x77,0xB9,0x23,0xEC,0xE9,0x1A,0x25,0x92,0xBC,0xE5,0xDE,
+	0xC5,0x95,0x38,0xC5,0x55,0x61,0xAE,0x7D,0x22,0x66,0x17,
+	0x08,0xBA,0xD5,0x48,0x53,0x74,0x73,0xF9,0xB6,0xCA,0xDD,
+	0x49,0xFC,0xB8,0xC3,0x6C,0x4B,0x21,0x79,0xB1,0x5F,0x66,
+	0xF4,0xE4,0x00,0xF7,0x89,0xF8,0x24,0x9F,0x5D,0x6C,0xAA,
+	0x6B,0x86,0x4C,0xC1,0x3E,0x0C,0x9A,0x49,0xD4,0x92,0x78,
+	0x54,0x20,0xAA,0x8F,0x3E,0xB5,0x13,0x02,0x1E,0xF4,0xFC,
+	0x5A,0xE0,0x24,0xEE,0x6A,0xA2,0xC6,0xDB,0x6F,0x19,0x15,
+	0x85,0x82,0xA1,0xA6,0x1E,0x15,0xA2,0x6B,0xB7,0x14,0x6C,
+	0xC8,0x12,0xBE,0xC8,0xF0,0xE7,0x44,0xB1,0x9B,0xDA,0x4D,
+	0xD9,0x6A,0x16,0x15,0x6B,0x62,0xDD,0x61,0x9D,0xCD,0x3E,
+	0x7B,0xCB,0xF0,0xF9,0xF6,0x35,0x29,0x96,0x02,0xDA,0xDE,
+	0x21,0xBB,0x09,0x06,0x7E,0x03,0x3F,0x18,0xC7,0x82,0x41,
+	0xDD,0xF2,0x25,0x5C,0x26,0xD8,0xB3,0xDF,0x16,0x08,0x87,
+	0xB7,0x08,0xCB,0xBE,0xA0,0x7D,0x32,0x7F,0x79,0xDB,0xE2,
+	0x8A,0x78,0xE9,0xE6,0x97,0x56,0x2F,0x2C,0x6C,0x25,0x69,
+	0x6C,0xF6,0x00,0x03,0x54,0x16,0xBC,0x9A,0xC1,0x34,0xA4,
+	0xAD,0x59,0x7D,0x80,0x30,0x33,0x7B,0x4E,0xBC,0xA2,0x43,
+	0x79,0x09,0x18,0xD3,0xC8,0x9D,0x73,0xB6,0x67,0x51,0xC6,
+	0xDA,0x58,0xC9,0x1B,0x11,0x7B,0xF6,0xA5,0x15,0xA0,0xE5,
+	0xDF,0xCB,0xA7,0x65,0x66,0xCB,0xB0,0xD9,0xCF,0x9A,0x82,
+	0xFA,0x4B,0x69,0x15,0xA6,0x92,0xC2,0xEC,0x2B,0xB2,0x17,
+	0x2C,0x12,0xFC,0x06,0x7B,0xEF,0x8A,0x40,0x4F,0x15,0x3B,
+	0x83,0x75,0xD3,0x5A,0x49,0x03,0x2E,0x6F,0x7D,0xE3,0x3C,
+	0xB0,0x9D,0x4F,0xD2,0x3C,0x7E,0x10,0xB3,0xD3,0x46,0xFE,
+	0x6E,0x2B,0x6F,0xD2,0xB7,0xB2,0x03,0xFD,0xCA,0xB6,0xE8,
+	0x49,0xD3,0x9B,0xC9,0x0A,0xE1,0x71,0xBA,0x69,0xB7,0xF7,
+	0x8B,0x51,0x23,0xCC,0x24,0x72,0xF6,0x91,0x9E,0xA4,0x3D,
+	0x8A,0xDC,0x94,0xDC,0x0A,0xDD,0x34,0xFE,0xBE,0xB0,0x41,
+	0x39,0x74,0x02,0xFB,0xC6,0x2F,0x41,0xCC,0x83,0xB4,0xA4,
+	0x26,0xAC,0x07,0xAB,0x34,0xEE,0x4F,0x0B,0xDD,0xF8,0xF2,
+	0x3D,0x5D,0x66,0x30,0xED,0x0C,0xD7,0xF4,0x6C,0x5A,0xD8,
+	0x95,0x40,0x1E,0x33,0x4D,0x5F,0x06,0x5A,0x9D,0xD1,0x3B,
+	0xAC,0xF3,0x37,0x95,0x04,0xEE,0x1D,0x2B,0x77,0x2F,0x15,
+	0x1F,0x0D,0x03,0xEC,0x9E,0xB2,0xC7,0x8A,0xCB,0x25,0xD8,
+	0x83,0x85,0x38,0x50,0xE1,0x29,0x3D,0xC3,0x91,0x18,0x5B,
+	0xDA,0x05,0xBC,0x05,0x25,0x4C,0xFD,0x9C,0xB4,0xB0,0x6A,
+	0x66,0x0F,0x8F,0x30,0x8F,0x07,0xC6,0xE1,0xE0,0x1B,0xBE,
+	0x3C,0x9B,0x73,0xD8,0xC0,0x6D,0xFA,0x95,0xC7,0x33,0x6E,
+	0x44,0x81,0x1A,0xF4,0xF8,0xBA,0xB6,0x0E,0xD3,0xCD,0x74,
+	0x8B,0xAF,0x06,0x95,0xCD,0xE4,0x07,0xD1,0x82,0xDF,0xB9,
+	0xE1,0x7F,0x6D,0x7C,0x57,0x29,0xB9,0xD5,0x34,0x04,0x35,
+	0x9F,0x72,0xD9,0x2F,0x84,0x7F,0x4F,0x5D,0x6A,0xE0,0xA3,
+	0xBF,0xD8,0x10,0xF7,0x46,0x24,0xA0,0x12,0xFC,0x6B,0xD6,
+	0x33,0xD1,0xAB,0x0E,0x54,0x89,0xFF,0x79,0xB6,0xA5,0x36,
+	0xB8,0x45,0x4C,0x51,0xFB,0xE0,0xE3,0x0B,0x89,0x21,0xAA,
+	0xD3,0xD6,0x7C,0xDF,0x3A,0x9B,0x3A,0xA2,0xEE,0x20,0x88,
+	0xA3,0x2E,0x4D,0x77,0x2A,0x5B,0x79,0x9E,0x44,0x5A,0x9A,
+	0x4A,0xC5,0xE5,0xCB,0xC8,0xBC,0x90,0x6B,0xBF,0xBF,0x06,
+	0xA3,0xBF,0x5E,0xAF,0x54,0xD1,0x69,0x19,0xBC,0xCD,0xD7,
+	0xB9,0xE6,0xAD,0xF0,0x23,0x4A,0x71,0x4B,0x65,0xDC,0x26,
+	0xDD,0xBF,0xE7,0x11,0x20,0x29,0x2C,0x31,0x65,0x53,0xE9,
+	0xCB,0xDB,0x3E,0xAF,0xCF,0xA6,0xE3,0x14,0x38,0x57,0x19,
+	0x86,0xBD,0x00,0xFB,0xBF,0x9A,0x62,0x74,0x75,0x96,0x28,
+	0xA2,0x55,0x3D,0x07,0x92,0xB6,0x2D,0xE6,0x83,0x5D,0x3E,
+	0x83,0xE4,0x3E,0x25,0x45,0xF6,0xDE,0x7A,0x45,0xBF,0xE1,
+	0x80,0x08,0x55,0xCA,0x61,0x6B,0xF3,0xFA,0xFB,0x1C,0x5E,
+	0x4F,0x68,0x94,0xC2,0xF3,0x7B,0xFE,0x5A,0x87,0x76,0x25,
+	0x15,0xE9,0xE4,0x88,0x73,0x7E,0xDC,0xC8,0xD4,0x10,0xEE,
+	0x43,0xB1,0x35,0xA0,0x1E,0x1E,0xCC,0x08,0x35,0xAF,0xF9,
+	0x62,0x51,0x63,0x9C,0xC3,0xBD,0x42,0x07,0xFD,0x8A,0x23,
+	0xD8,0x2C,0x50,0x66,0x45,0x9E,0xE8,0x26,0xA8,0x1B,0x00,
+	0x63,0xF5,0xB0,0xA9,0xDE,0x90,0x58,0x3B,0x09,0x65,0x5A,
+	0x8E,0x7C,0x11,0xBE,0x4D,0x4E,0xAE,0x1D,0x66,0xE7,0x26,
+	0x5D,0xEF,0x13,0x26,0xD2,0x50,0xF0,0x4C,0xDB,0x9E,0x66,
+	0x08,0x42,0xCE,0xA8,0xD2,0xB3,0xE6,0x0F,0x11,0x00,0xC6,
+	0x02,0xD3,0x14,0x29,0x72,0x41,0x3D,0x8F,0xFC,0x24,0x74,
+	0x5C,0x04,0xD4,0x71,0x91,0x98,0x5D,0xF0,0x40,0x84,0x37,
+	0x49,0x18,0xC4,0x53,0x8E,0x76,0xB7,0x99,0x36,0x8B,0x5F,
+	0xCA,0x10,0x89,0x3B,0x94,0x62,0x67,0x15,0xF6,0xD9,0x7E,
+	0x6B,0x74,0x4F,0x48,0xD0,0xF4,0x3D,0xD2,0xF7,0x77,0x19,
+	0xE7,0x9C,0xBF,0x72,0x99,0x1C,0x35,0xC9,0x1A,0x20,0x74,
+	0xFF,0xA2,0x7D,0xF8,0x1D,0x6C,0x26,0xB1,0xD7,0x9F,0x61,
+	0x04,0x05,0xF6,0xFF,0xA3,0x4F,0x83,0x7C,0x6C,0xDC,0x3F,
+	0xFE,0xE5,0xAF,0x82,0x43,0xF7,0xED,0xB1,0xCD,0xFE,0x36,
+	0x6D,0x27,0xC1,0xCB,0xE6,0x7F,0x2B,0x2C,0xBB,0x5D,0xDA,
+	0xB0,0x90,0x40,0x0E,0xF5,0x32,0x5C,0x17,0xE9,0xCA,0x59,
+	0x3A,0x88,0x63,0xFE,0x4A,0x21,0x33,0x4C,0x9C,0x91,0xF8,
+	0xB2,0x16,0x2C,0xF9,0x87,0xF6,0x92,0xD7,0xC4,0xE0,0x8A,
+	0x8D,0xAE,0x04,0xBE,0xA7,0x15,0xC6,0xAD,0x1B,0x38,0xF9,
+	0x3C,0x4A,0x14,0x1F,0x65,0x89,0x9C,0xFB,0xEA,0xB1,0x8C,
+	0x60,0x3B,0x3D,0x63,0xE2,0x29,0xF6,0x41,0xED,0x26,0xC3,
+	0x22,0x21,0x5C,0x13,0x12,0x9D,0xEE,0x80,0x96,0x46,0xA6,
+	0x3D,0x97,0x4E,0x4A,0x66,0x13,0x2C,0xBB,0x2C,0x28,0x83,
+	0x59,0xB4,0xF9,0x3E,0xF2,0x3F,0x65,0x15,0x58,0xD8,0x12,
+	0x8F,0x32,0xD6,0xE7,0x5E,0xDE,0x9F,0xAB,0xDE,0xA7,0x25,
+	0xA8,0xDC,0xAF,0xC6,0x5D,0x30,0xF2,0x56,0x2B,0xB3,0x80,
+	0x58,0xF2,0x18,0xAF,0xC9,0xB9,0xE9,0xBF,0xF9,0x99,0x83,
+	0xF9,0x41,0x24,0x7B,0xF3,0x01,0xCB,0x98,0x04,0xA2,0x37,
+	0x79,0x2D,0xE9,0x5A,0xC2,0x25,0xAF,0x8D,0x1C,0xE1,0x3E,
+	0x90,0x51,0x6C,0x09,0xB3,0xE2,0xEF,0xB6,0x15,0x7C,0x8E,
+	0x54,0x37,0xF9,0xED,0x8C,0xF7,0x50,0xA4,0x8B,0xC7,0x39,
+	0xAD,0xB9,0x29,0xC9,0xA6,0x94,0x1F,0xCA,0xBA,0x29,0x99,
+	0x54,0x90,0x25,0x28,0x8C,0x56,0xA8,0x9C,0xFA,0x7A,0xDB,
+	0x4B,0x8E,0xC0,0x1F,0x2D,0xF1,0xCA,0x0F,0xCB,0x18,0x19,
+	0xF0,0x2B,0x45,0xAF,0xB4,0x05,0x0D,0x2F,0x95,0xD7,0xE6,
+	0x06,0xD2,0x7D,0xA7,0x03,0x03,0xD3,0xCB,0x3A,0x39,0xBB,
+	0x45,0xD9,0x26,0x12,0xD0,0xCD,0x71,0xF2,0x0F,0xD2,0x45,
+	0x45,0xF8,0x73,0x14,0xC4,0xBA,0x86,0x02,0xEE,0x97,0x79,
+	0x11,0x3A,0xE5,0x5A,0x02,0x4C,0xFB,0x83,0x5F,0xDA,0xC4,
+	0x1C,0xC0,0x92,0xE1,0xFE,0x0D,0xBD,0x9D,0x2B,0x8F,0x6E,
+	0xA0,0x35,0x8D,0x4A,0x59,0x5E,0xD5,0x55,0x50,0x23,0x9C,
+	0xC2,0x67,0xD9,0x3C,0xD8,0xB9,0xFD,0x83,0x3D,0xAF,0x3B,
+	0x82,0xC2,0x83,0x84,0x1D,0x24,0xCD,0x82,0x88,0x19,0x5F,
+	0x93,0x2C,0xE0,0x0B,0xFB,0xE0,0x17,0x57,0x4F,0x30,0x50,
+	0x5F,0x77,0x68,0x94,0xED,0xDA,0x50,0x50,0x6D,0xE8,0xF6,
+	0x5E,0xC9,0x45,0x68,0x96,0xC9,0x02,0xE0,0x31,0xE8,0x2C,
+	0x74,0x0B,0x97,0xF9,0x52,0xB5,0x05,0x24,0xF9,0x89,0x17,
+	0xDC,0x6B,0x6F,0x11,0x7B,0xBC,0xAA,0xE0,0x36,0x34,0x67,
+	0xE6,0x69,0x5E,0x29,0xC8,0x82,0xB9,0x4A,0xE6,0xEC,0xE5,
+	0x69,0xF2,0x10,0xA0,0x77,0x08,0x3C,0xE8,0xAD,0x00,0xA0,
+	0x5A,0xDE,0xFE,0x07,0x3A,0x3B,0x53,0xEC,0x2E,0xA7,0xF3,
+	0xBD,0x13,0xA0,0x1D,0x37,0xAA,0x81,0xAA,0xB5,0x69,0xB1,
+	0xCE,0xA7,0x79,0x65,0x2F,0xB6,0xD0,0x64,0x10,0x90,0xF3,
+	0xEE,0x0A,0xAE,0x87,0x84,0x9D,0xEA,0xD4,0xCD,0x6A,0x85,
+	0xB9,0x4D,0xF5,0x55,0x0C,0x50,0x76,0x0D,0x73,0xEF,0x00,
+	0xB6,0x52,0x06,0x81,0x87,0xB6,0x90,0xC4,0x7A,0xF9,0x8C,
+	0x97,0xD0,0x1D,0xB8,0x8C,0xA5,0x45,0x70,0x09,0xA8,0x02,
+	0x3B,0x87,0x25,0xFB,0x41,0xC5,0x17,0xF1,0x11,0xE7,0x2D,
+	0x67,0x2C,0xE5,0xC5,0xD9,0xC2,0xA1,0x7B,0x2F,0x82,0x32,
+	0x3E,0x71,0x40,0x09,0xF5,0x20,0xD2,0x61,0x40,0x3B,0xF2,
+	0x9C,0xFD,0x2D,0x27,0x17,0x78,0x8C,0x83,0xB5,0xCA,0x28,
+	0x60,0xA6,0x56,0xAE,0xC4,0xC6,0xBA,0x74,0x15,0x00,0xBA,
+	0x17,0xAA,0x2A,0x48,0x67,0x01,0xEE,0x47,0x55,0x37,0xE7,
+	0xC7,0x00,0x75,0x5E,0xE5,0x07,0x4A,0x88,0x10,0xFA,0x73,
+	0x0E,0x2C,0x00,0x3B,0x7E,0xCA,0x3B,0x03,0x3B,0xE1,0x82,
+	0x3F,0xD3,0x0E,0xBA,0x14,0xA0,0xDE,0x91,0x21,0x9D,0xC7,
+	0x16,0xF6,0x01,0xFF,0xD6,0x45,0x68,0xB7,0xF5,0x1C,0xF8,
+	0x83,0x80,0x9A,0x9E,0xAD,0xEE,0x0C,0x22,0x1B,0x05,0xF3,
+	0x19,0x83,0xA5,0x84,0xC1,0xE8,0x40,0xBF,0x0C,0x1B,0x75,
+	0x6D,0x75,0x44,0x97,0x73,0x99,0xD1,0x79,0x84,0x2E,0xA1,
+	0x06,0x0B,0x65,0x56,0xE9,0xA6,0x41,0x83,0xEB,0x6D,0x4B,
+	0xB6,0xAF,0x6B,0x81,0xC0,0xDA,0x2F,0x6F,0x58,0x4B,0xC1,
+	0xA8,0xDF,0x8B,0x09,0x91,0xC7,0x25,0xF1,0x2D,0x89,0x02,
+	0xE8,0x89,0xD7,0x3E,0xDC,0x98,0xFC,0x56,0xDC,0x1C,0x03,
+	0xC9,0x00,0x94,0x4E,0x82,0xC7,0x37,0x61,0x34,0x90,0x7F,
+	0x8E,0x51,0x99,0x42,0xD8,0x71,0xD7,0x6D,0x3E,0x50,0xAF,
+	0x0E,0xDE,0x78,0xCE,0x87,0xD9,0x0C,0xFA,0xFB,0xE0,0x4B,
+	0x06,0xBE,0x17,0xDA,0xC0,0xC8,0xDE,0x70,0x8E,0xDB,0x39,
+	0xBF,0x6A,0xE7,0x0B,0x45,0xE7,0x7C,0x1B,0xED,0x33,0xBD,
+	0xFF,0x79,0x60,0xDC,0x1E,0x1F,0xB5,0xE1,0x72,0xA7,0xED,
+	0xB1,0x75,0xA5,0x6D,0x24,0x1D,0xB2,0xB6,0x40,0x49,0xEA,
+	0x6A,0x3A,0x24,0xCB,0x09,0x85,0x03,0xC2,0x8F,0x5E,0xC5,
+	0xC2,0xDC,0x4F,0x2E,0x61,0x9D,0x7E,0x61,0x0C,0xB0,0x10,
+	0x65,0x94,0x5C,0x68,0x64,0xAF,0x78,0xF9,0x81,0x29,0x73,
+	0x0D,0x0A,0xC7,0x45,0x01,0x27,0x54,0x91,0x3F,0x09,0x71,
+	0x92,0x16,0x75,0x93,0x2C,0x21,0x81,0x79,0x21,0xAD,0x7B,
+	0x47,0x3A,0x2F,0xB5,0x64,0x44,0x4C,0xC0,0xA1,0xAF,0xDF,
+	0x62,0xDC,0xBF,0xF7,0xF6,0xBA,0xB9,0x86,0x2B,0xFC,0x92,
+	0x12,0x22,0xA3,0xFF,0xD3,0x11,0x0F,0xAB,0x5B,0x67,0xFA,
+	0x1C,0x7D,0xA4,0xFE,0xC4,0x18,0x8C,0x9E,0xEE,0xF5,0xB3,
+	0x35,0x40,0xC2,0xC8,0x9F,0xEF,0xC8,0x65,0x16,0x23,0x55,
+	0x3F,0xBC,0xB0,0x9B,0xFE,0x72,0x5B,0xB9,0xC6,0xA7,0x65,
+	0xDD,0xD0,0x18,0x65,0x07,0xC3,0x0A,0x73,0xFA,0xF6,0x81,
+	0xE9,0xAF,0xF7,0xC0,0x35,0x74,0x04,0x16,0xCD,0x4B,0x3E,
+	0x70,0xFB,0x11,0xEF,0x16,0x86,0x97,0x3E,0x8E,0x79,0xA3,
+	0x41,0x5D,0xA4,0xE9,0x71,0xEA,0xD6,0x1B,0x0B,0x7A,0xE0,
+	0x74,0x51,0x8F,0x7F,0xF9,0x04,0xEF,0x99,0x9F,0x1A,0x6F,
+	0x02,0x5B,0x2A,0xB1,0x25,0xF1,0x86,0x50,0xA7,0x74,0x36,
+	0x74,0x32,0x7E,0x3C,0xCC,0x27,0x76,0xB2,0x04,0x89,0x84,
+	0xF7,0xBE,0x31,0x3E,0x15,0x2E,0xA8,0x28,0x17,0x38,0x70,
+	0x0F,0x08,0xB9,0x1E,0xA0,0x65,0x37,0x77,0x1D,0x18,0xF9,
+	0x13,0x96,0x30,0x7D,0x40,0xB1,0x21,0xDB,0x3E,0x27,0x63,
+	0xA0,0x4F,0x59,0x23,0x55,0x1E,0x26,0xCF,0x04,0xC8,0x35,
+	0x27,0x33,0xF3,0x81,0xDC,0x9B,0x4D,0xE7,0x33,0x7E,0x27,
+	0x65,0xBE,0x57,0xE9,0xF7,0x9E,0x5E,0x35,0x2D,0xDC,0x46,
+	0x1F,0xC1,0x67,0x62,0xFE,0x22,0xF9,0x35,0x9D,0x07,0x93,
+	0xED,0xAD,0xDD,0x5A,0xD3,0xBE,0x4F,0x7B,0x63,0x20,0x8D,
+	0xD8,0x32,0x98,0x1B,0x3A,0x75,0xAB,0x94,0x08,0x6E,0x7E,
+	0xFC,0x7D,0x97,0xBF,0x9E,0xE8,0x71,0x82,0x88,0x2E,0x33,
+	0x5C,0xDF,0x5D,0x0D,0x72,0x9E,0x48,0x75,0x84,0xBE,0xA9,
+	0xE7,0xEF,0x57,0x28,0xD1,0x2E,0x2D,0x9B,0xDE,0xBF,0x36,
+	0xCE,0x7B,0xC9,0x0F,0x70,0x5D,0xB8,0x65,0x73,0xC1,0x2B,
+	0xBA,0x5E,0x3D,0xC0,0xF5,0xA1,0x26,0xEE,0x40,0xBF,0xEA,
+	0xAF,0x6C,0x3E,0x28,0x07,0xDB,0x32,0x74,0x68,0xB2,0xA9,
+	0xED,0x10,0xA8,0xD2,0x97,0xA2,0x3B,0xD2,0x6B,0xDF,0x79,
+	0xFC,0x06,0xB0,0x0D,0x6A,0x72,0x63,0x1C,0xF1,0xD8,0x17,
+	0x20,0xAF,0x04,0x7A,0x63,0x50,0x68,0xAE,0x81,0x74,0x36,
+	0xC5,0x69,0x28,0x86,0xCA,0xDF,0xD7,0xA0,0x31,0xB3,0x71,
+	0xC4,0x00,0x68,0x9B,0x3C,0x74,0x79,0x3C,0x43,0x31,0x5D,
+	0xCC,0x6A,0x21,0x53,0x9E,0x8B,0xFF,0x8F,0xCE,0xA7,0x71,
+	0x34,0x63,0x27,0xBA,0x34,0xDD,0xCF,0x8D,0x16,0x9D,0x1C,
+	0x80,0xCE,0x7B,0xD3,0x56,0xAB,0x10,0xE2,0x3D,0xE7,0x40,
+	0x5D,0x5A,0xE5,0x6A,0x0D,0xA6,0x0A,0x5D,0x81,0x61,0x12,
+	0x11,0x28,0x79,0xE5,0x14,0x2C,0xCC,0xF6,0x6D,0x1A,0x41,
+	0xD4,0x70,0xFF,0xC6,0x78,0xB1,0x77,0x05,0xF1,0x91,0x62,
+	0x0F,0x5E,0x1A,0xFF,0x6A,0x02,0xE9,0xF0,0x51,0x45,0xF8,
+	0x27,0xA6,0xFA,0x07,0xB2,0xE2,0x74,0x29,0xC6,0x76,0x01,
+	0xCE,0x39,0x57,0x2B,0x0E,0xBE,0x19,0xE2,0xBB,0xF8,0x14,
+	0x96,0x0B,0xEB,0x63,0x76,0x8B,0x59,0x33,0xB2,0x66,0xDD,
+	0x01,0x25,0x82,0xF4,0xE2,0x2A,0x3E,0x1D,0x1F,0x14,0xEA,
+	0x26,0xF9,0x9B,0xB2,0x65,0x4C,0x20,0x65,0x54,0xA3,0x9E,
+	0x42,0x80,0x0A,0x3D,0x26,0x56,0x3F,0x88,0x3F,0xB3,0x1A,
+	0x1C,0x08,0x17,0x59,0x14,0xAA,0x95,0x5B,0x15,0xE1,0xB4,
+	0x08,0x1B,0xB6,0x88,0xC7,0x45,0x05,0x93,0xC6,0xD8,0xB9,
+	0xE2,0xD5,0x9D,0xE2,0x65,0xB7,0x6C,0x7C,0xD1,0x5A,0x22,
+	0xCE,0x37,0xFB,0x0E,0x1C,0x89,0x35,0x5D,0x7B,0x92,0xF6,
+	0x56,0x75,0x01,0xA3,0x84,0x71,0x29,0x74,0x53,0xD5,0x10,
+	0x67,0xCB,0xD7,0x41,0x1C,0x14,0x4B,0xB6,0xDC,0x3D,0xAE,
+	0xA3,0x85,0xBC,0x2E,0x0D,0x43,0x08,0xF8,0x7C,0x79,0x72,
+	0xCA,0x26,0xD6,0xBA,0xD8,0x7B,0x4B,0xEB,0xD1,0x0D,0x1B,
+	0xF0,0xB0,0xEB,0x1E,0x81,0xF8,0x3D,0x2C,0x1E,0xD0,0xD5,
+	0xEC,0x51,0x26,0xEB,0x4A,0xD5,0x98,0xAD,0x64,0xBB,0xB7,
+	0xEA,0x65,0xD9,0xBD,0xA5,0xC5,0x9D,0xAC,0x4E,0xE5,0xC0,
+	0x44,0x18,0xA2,0x74,0xE8,0x8F,0x16,0xD0,0xAA,0x1F,0x88,
+	0x94,0x6F,0x28,0x78,0xFB,0xAE,0x8B,0x44,0x22,0x41,0x5D,
+	0xB3,0x16,0x13,0xE5,0x3A,0x1C,0x4D,0xF2,0x0B,0x52,0x5F,
+	0x7B,0xEF,0x24,0x43,0xD3,0xD4,0xB7,0x93,0x01,0x04,0x97,
+	0xB7,0xBD,0x2A,0xD9,0x72,0xF8,0xD2,0xCF,0xEA,0x0E,0x68,
+	0x2C,0x6A,0xB5,0xF3,0xC6,0x0B,0x78,0x50,0x0B,0xC4,0x2D,
+	0xF9,0x96,0xA8,0x74,0x14,0x09,0xA1,0x23,0xCE,0xF6,0x6A,
+	0xF8,0x70,0xC9,0x17,0x88,0x00,0xB0,0x27,0xB4,0xA5,0x6A,
+	0x6E,0x35,0xD4,0x88,0x07,0x1A,0xE8,0xE3,0x41,0x2C,0x36,
+	0x17,0x6A,0x12,0x74,0x4A,0xA8,0xBA,0x8A,0xAA,0xB3,0xFC,
+	0x35,0xE3,0xD4,0x8A,0xD4,0x0C,0xCB,0x2F,0x6D,0xED,0x23,
+	0x55,0xD0,0x3E,0xBA,0xB4,0xC6,0xBE,0x9F,0x6C,0x4E,0xFC,
+	0xAB,0xA5,0x52,0xFB,0x4F,0x24,0xC7,0x66,0xA8,0xC2,0xF9,
+	0xB7,0x04,0xC1,0x2B,0x85,0x50,0xE3,0xD5,0x64,0x52,0x8C,
+	0x7E,0x67,0x42,0xD2,0xEE,0x0A,0x16,0x4D,0xBB,0x6E,0x1C,
+	0x77,0x4D,0x70,0x6C,0x08,0x87,0x1B,0x22,0x26,0x65,0xD5,
+	0x21,0x26,0x0F,0xD2,0x87,0xC8,0xAE,0x02,0x81,0xA3,0x9F,
+	0x27,0x06,0x50,0x26,0xF7,0x7C,0xBD,0xE8,0x29,0x96,0x31,
+	0xB2,0xE8,0x83,0xF5,0x1C,0x9A,0x71,0x7B,0xB5,0x44,0x1E,
+	0x5A,0x32,0x36,0xD0,0x86,0xB4,0x28,0x30,0x72,0x85,0xC7,
+	0x07,0xF1,0xC2,0x2D,0xC3,0x42,0x80,0xBA,0xA1,0xAF,0xD5,
+	0x33,0x03,0x05,0xA7,0x98,0xE0,0xC5,0xCA,0x88,0x45,0x2F,
+	0x86,0x93,0x2F,0x4B,0xAC,0xD6,0x62,0xF4,0xB9,0xB5,0x91,
+	0x98,0xBD,0xF5,0x87,0xE3,0x08,0xB2,0x1C,0xD6,0x71,0x60,
+	0xC3,0xF0,0xC9,0x8D,0x55,0x86,0xFC,0xE2,0x83,0x6E,0x56,
+	0x87,0xED,0xC6,0xBA,0x45,0xE9,0x7A,0xA8,0x8F,0x12,0x68,
+	0xCB,0x26,0x9C,0xC7,0xA8,0x88,0x81,0xBF,0x47,0x15,0x69,
+	0xBF,0x32,0xCA,0x52,0x51,0x1F,0x52,0x27,0x36,0x74,0xA8,
+	0x17,0x3B,0xC0,0x2C,0x3A,0x7F,0x82,0x7D,0x52,0x20,0xD6,
+	0x03,0x58,0x07,0x4D,0x76,0xD1,0x0A,0x16,0x7A,0xF3,0x59,
+	0x08,0xFB,0x5F,0xF9,0xC1,0x8B,0x5F,0x14,0xB8,0xFD,0xAC,
+	0xC8,0x40,0xF2,0xB9,0x1C,0x16,0xF7,0xD6,0x05,0x11,0x2B,
+	0xD5,0x74,0xF1,0x38,0xDB,0x35,0x36,0x60,0x69,0x84,0x42,
+	0x84,0xDF,0xF0,0xB5,0xE5,0x30,0x92,0x22,0x48,0x8F,0xDE,
+	0x49,0xC5,0x5E,0x64,0xED,0xED,0x56,0xDC,0xCB,0xC4,0xEB,
+	0x07,0x2E,0xF1,0x88,0xF0,0x6F,0xE2,0x29,0xF0,0xEE,0x50,
+	0x27,0x0E,0xBF,0x75,0x5D,0xFD,0x5A,0x37,0x62,0xE9,0xF7,
+	0x4A,0x37,0x7B,0x8F,0x55,0xBF,0xD2,0xD6,0xD5,0x24,0x40,
+	0xF0,0x97,0xE7,0x1D,0x44,0xA0,0x69,0x3D,0x03,0x79,0x2E,
+	0xDB,0xAD,0x85,0x8A,0x77,0x4A,0xED,0x17,0x05,0xC9,0x03,
+	0xA0,0x20,0x79,0x67,0xC4,0x39,0x43,0x8C,0x7F,0xFC,0x3E,
+	0x2E,0x08,0x23,0xE4,0xE0,0xDF,0xDA,0x2F,0x5F,0x05,0x20,
+	0xFC,0x06,0x62,0xA4,0x16,0x24,0x9F,0xF5,0x7E,0x50,0x5B,
+	0x03,0x3F,0xCC,0x12,0xC9,0x06,0x14,0x10,0xD3,0x27,0xF9,
+	0x8D,0x84,0x7A,0xB9,0x3A,0x4C,0xE2,0x73,0x21,0xD1,0x44,
+	0xC8,0x85,0x20,0x70,0x8B,0xD5,0x1D,0x6B,0x9F,0xE3,0x1B,
+	0x35,0x98,0x44,0xD3,0x1A,0x51,0xC4,0x14,0x51,0x50,0xFD,
+	0x18,0xD0,0x91,0xB9,0x3A,0xDA,0xA6,0x1D,0xD6,0x6E,0x8E,
+	0xF0,0x8E,0xA7,0x57,0xEB,0x83,0xA2,0xC4,0x90,0xFB,0x3D,
+	0x07,0xB5,0xA3,0xFD,0x90,0x4A,0x80,0x15,0x6F,0x58,0x7C,
+	0x61,0xF8,0xEE,0xB3,0x9C,0x7B,0x63,0x1D,0x02,0x5F,0xA3,
+	0x9F,0x08,0x7D,0x7B,0xAF,0x20,0x9B,0x71,0x59,0xC4,0x1F,
+	0xB1,0xC0,0xA4,0x23,0xD7,0x8E,0x33,0xB5,0xC8,0x52,0x4C,
+	0x89,0x41,0x95,0x9F,0x39,0xD0,0x41,0xA4,0x5C,0x0A,0x6E,
+	0x44,0xEE,0xF9,0x3D,0x18,0x5C,0x41,0xE3,0xF1,0xB3,0x15,
+	0xF8,0xD0,0x64,0x87,0x14,0x7C,0x38,0x52,0x2C,0x6C,0x70,
+	0x84,0x85,0x7E,0xA6,0x0B,0xEE,0xFD,0x30,0x73,0xEF,0x45,
+	0x8B,0x20,0x23,0xC0,0x4C,0x8D,0x8B,0x7A,0xEC,0x75,0xAA,
+	0x4A,0x0D,0xBA,0xEE,0x19,0x5A,0xED,0x3A,0x87,0xF0,0x66,
+	0xBE,0xDA,0x06,0x25,0xB9,0xA7,0xD5,0xED,0xE3,0xA7,0x3A,
+	0x60,0x95,0xBD,0x30,0xDE,0x82,0xBC,0xAB,0x84,0xC4,0x0C,
+	0xF3,0x38,0x08,0x80,0x1D,0xAF,0xBE,0x4D,0x10,0x6A,0xAF,
+	0x85,0xFA,0x17,0xCC,0xC9,0x30,0x4A,0xAF,0xE5,0x43,0x13,
+	0x25,0x5C,0x69,0x7D,0x5F,0xAF,0x4A,0x25,0x9E,0x89,0x86,
+	0x9C,0x89,0x45,0x72,0xA6,0x56,0x01,0xDD,0x31,0xE0,0x6A,
+	0x3F,0x3E,0x71,0x57,0xDA,0x65,0xC2,0xF9,0xEC,0x7B,0x6A,
+	0xF5,0xC3,0x25,0x5D,0xB5,0x52,0xD6,0x61,0x50,0xE1,0x4C,
+	0x9E,0x9C,0xEA,0xF9,0x7F,0x32,0x89,0x05,0x44,0xA2,0x7E,
+	0x2A,0x29,0x51,0x02,0x42,0x89,0x17,0xC5,0x26,0x76,0xB1,
+	0x01,0x95,0xF0,0x5C,0x89,0x3B,0x90,0x7B,0x72,0xB5,0xD8,
+	0x02,0x3A,0x7C,0xF6,0xA1,0x9B,0x10,0x48,0x0D,0x19,0x8E,
+	0xA3,0x7D,0x48,0xF9,0xA3,0x9D,0xAE,0x79,0x37,0x88,0xAB,
+	0xD4,0xC2,0x08,0xD0,0x74,0xA1,0xD5,0xB5,0x53,0x75,0xCD,
+	0x79,0x25,0x36,0x6F,0x3E,0x45,0xEF,0xAD,0xE3,0xBE,0xF4,
+	0xCB,0x5E,0x2F,0xC8,0xAB,0xBC,0x7B,0xBE,0x26,0x4B,0xB4,
+	0xD0,0x00,0x35,0xD5,0xC2,0xA2,0xC2,0xBA,0x57,0x48,0x85,
+	0x1F,0x10,0x16,0x43,0xFF,0xFF,0x94,0x52,0x92,0xE3,0x6C,
+	0x03,0xB9,0x70,0x70,0xA1,0xC8,0x90,0x69,0xF0,0xFD,0x69,
+	0x1E,0x79,0x94,0xE0,0x79,0xA1,0x73,0xCA,0xDB,0xE6,0xFB,
+	0x25,0xEE,0x54,0x95,0xB0,0x0C,0xF0,0x54,0x1C,0x9A,0x7C,
+	0x0B,0xB6,0x2D,0x34,0x8F,0xCC,0x76,0x82,0x8D,0x95,0x85,
+	0x70,0x67,0x69,0x67,0x19,0x9F,0xAA,0xB3,0xB5,0xC1,0x3C,
+	0x69,0x66,0x21,0x2F,0xD5,0xD8,0x30,0x30,0xA7,0x60,0xA6,
+	0x90,0x48,0xAF,0x8D,0x50,0x6F,0xBC,0x1D,0x20,0xAA,0x46,
+	0x17,0xE6,0x29,0xFD,0xA3,0x26,0xAE,0x26,0x62,0x42,0x75,
+	0xC3,0x34,0x2B,0xE8,0xC1,0x7E,0x26,0x92,0x86,0x61,0xFA,
+	0xFD,0x9E,0x3E,0x8A,0xFF,0xC6,0xB5,0xAB,0xAB,0x3D,0xCB,
+	0x85,0xD4,0xB6,0xF6,0x15,0xCA,0x61,0x78,0x6D,0xB3,0x22,
+	0x78,0x1E,0x16,0x14,0x72,0x02,0x1E,0x21,0xE1,0xF3,0x09,
+	0xC2,0x51,0xB8,0xE8,0xE1,0x36,0x3A,0xAE,0xE7,0xEA,0xE6,
+	0xF7,0x83,0x3D,0x54,0x0B,0xDA,0x51,0xCC,0xE3,0xEF,0x13,
+	0x5A,0xB9,0x0A,0x1E,0xF0,0x2E,0xC2,0xB6,0xC6,0xF7,0x4B,
+	0x73,0xFA,0xBE,0x57,0x76,0xA3,0xC1,0x6E,0x22,0xA2,0x7F,
+	0xB5,0x5E,0xC4,0xC3,0x99,0x90,0xAF,0xFC,0x3E,0xA9,0x4E,
+	0x13,0xAD,0x13,0xB3,0xF1,0x7E,0x2F,0xB5,0x05,0x6C,0xF9,
+	0x91,0xF5,0xE9,0x07,0x02,0x1B,0x99,0x7D,0x39,0x75,0x72,
+	0x9D,0xAA,0x8F,0xC4,0x2E,0x15,0x8A,0x43,0x0A,0xA7,0x88,
+	0xF8,0xC0,0xC2,0x9B,0xD8,0xE4,0xD2,0xC8,0x53,0xEC,0x3F,
+	0xF2,0x27,0xEE,0x17,0x7C,0xB6,0x2C,0x60,0xBF,0xBE,0x33,
+	0x79,0xDC,0xFC,0x5E,0x74,0xD8,0x5D,0x38,0x20,0x1D,0x12,
+	0xB4,0x78,0x3D,0x48,0x3E,0xFC,0x80,0x85,0xC5,0x57,0x3D,
+	0x11,0x1B,0xE1,0xC5,0x4F,0x57,0x03,0x7B,0x6A,0x0F,0x59,
+	0x05,0xC0,0x51,0x15,0x70,0xD6,0x19,0xE0,0xDE,0x25,0xED,
+	0xD5,0x37,0xA1,0x54,0xBD,0x60,0xA7,0xD0,0x60,0xFD,0xD0,
+	0x0E,0x9C,0xD4,0x1D,0x35,0x9E,0x5C,0xE0,0x60,0xDC,0xA7,
+	0xD5,0xE1,0x33,0x22,0x85,0x66,0xB2,0x0A,0x31,0x98,0xD0,
+	0x97,0xC1,0x52,0x64,0xA7,0xB7,0xFE,0xE7,0xF3,0xAF,0x6D,
+	0xC3,0xDC,0x47,0x77,0x62,0x65,0xBB,0xE5,0x25,0xFE,0xDD,
+	0x0E,0x8C,0xB0,0x2F,0xD0,0x7E,0xE1,0x73,0x29,0x61,0xC3,
+	0xFD,0x8D,0xF2,0xB0,0x3F,0x18,0xFB,0x41,0xC7,0x3D,0x66,
+	0xED,0xD5,0x60,0xE3,0x96,0xEC,0x80,0x5C,0x43,0x22,0xE4,
+	0x36,0x7C,0xE3,0x64,0x03,0xC8,0x9F,0x43,0xEC,0xDA,0xB6,
+	0x9A,0x5D,0x95,0x0F,0x9F,0xB4,0xBF,0xEC,0xA8,0x32,0x76,
+	0xE2,0x27,0xE5,0x89,0x17,0x80,0x1B,0x8D,0xA3,0x18,0xF2,
+	0x62,0x28,0xDA,0x70,0x5C,0xD0,0x6D,0x4D,0xEB,0xC3,0x97,
+	0x6F,0xBE,0x05,0x38,0x70,0x6C,0xEB,0xD2,0x26,0xC7,0x49,
+	0xD5,0x42,0x5F,0xFD,0x0C,0xB6,0x53,0x14,0x21,0xE4,0x97,
+	0x43,0x4D,0x2A,0x14,0x81,0x12,0xAC,0x56,0x7D,0xE3,0x88,
+	0x81,0xB5,0x51,0xB2,0xE4,0xA5,0x2A,0xC1,0x22,0x4D,0xCB,
+	0x92,0x03,0x7F,0x09,0xD6,0x62,0x3F,0x1E,0x73,0x53,0x31,
+	0x21,0xFB,0x3C,0x67,0x59,0x15,0x4C,0xA7,0x21,0x74,0x45,
+	0x0B,0x4E,0x23,0x01,0xED,0x1D,0xB1,0x27,0x69,0xD2,0xCB,
+	0xE7,0x41,0xD6,0xBE,0xC3,0x11,0xB0,0x87,0x6C,0x7B,0x10,
+	0x2C,0x57,0xAD,0x4E,0xB2,0xF3,0xD1,0x96,0x7A,0x0B,0xBF,
+	0x37,0xFA,0xEC,0xBF,0x8B,0xC2,0xCF,0x4A,0x06,0xEC,0x6D,
+	0xF7,0x14,0xDF,0x0B,0xCB,0xFA,0xF2,0x7D,0x27,0x48,0x3D,
+	0x58,0x7C,0xED,0x8D,0x3A,0x94,0xC0,0xCB,0x7D,0xBC,0x77,
+	0x0C,0x01,0x5C,0x88,0xAF,0x55,0x0C,0x6B,0x93,0x42,0x84,
+	0xB7,0xC4,0xCB,0x8C,0xF5,0x75,0xC7,0xEE,0xB6,0xFF,0xD8,
+	0x35,0x67,0xED,0xD9,0x81,0x4E,0x22,0x75,0x1A,0xCA,0xDE,
+	0xF3,0xA6,0x95,0x42,0xAF,0xF7,0xDF,0x87,0x75,0xCC,0xEC,
+	0x3A,0xCE,0x12,0xB0,0x91,0xD7,0x91,0x4F,0x3E,0xEF,0x32,
+	0x8C,0x77,0x91,0x0B,0xBB,0xD7,0x77,0xED,0x89,0xD2,0xA4,
+	0x71,0x4F,0x71,0x19,0xC7,0x95,0x63,0x5B,0x05,0x24,0x3A,
+	0x34,0x63,0xED,0x1A,0xB9,0xF4,0xF7,0xF5,0xCD,0x52,0xC8,
+	0xDD,0x4D,0x52,0x23,0x58,0x39,0x3A,0xFF,0x33,0xBC,0xD3,
+	0x9E,0x21,0x36,0x52,0x0F,0x28,0x74,0xFF,0x6E,0xC0,0x9A,
+	0xE1,0x78,0x8B,0x5B,0x63,0x75,0x5B,0x0A,0x43,0x3B,0xE8,
+	0xCC,0x7F,0xAC,0x93,0x0A,0xD4,0x98,0x4F,0x3B,0xE7,0xC3,
+	0x99,0xC4,0x90,0x4F,0xC2,0x61,0xA4,0xEC,0xA3,0xFF,0x71,
+	0xFF,0xAA,0xA4,0xD2,0xA8,0x01,0x45,0x96,0xF2,0x41,0xC0,
+	0xE0,0xF0,0x04,0x68,0x6B,0x0F,0x5F,0xB9,0x5B,0xCD,0x64,
+	0xA2,0xDB,0x63,0x61,0xD8,0x93,0x3C,0x42,0x44,0x18,0x02,
+	0xBA,0xB3,0xD8,0x0E,0x1B,0x3F,0xCD,0x95,0xFE,0xE5,0x87,
+	0xA6,0xD6,0x83,0x15,0x9E,0xAC,0xBC,0xA3,0x46,0xDC,0x14,
+	0xCD,0x83,0x69,0x82,0x84,0xDF,0x95,0xF6,0x16,0x28,0xE1,
+	0x93,0xF7,0xF7,0x61,0xC4,0x84,0x62,0x35,0xBB,0xD4,0x00,
+	0xA1,0xEF,0x50,0xF1,0x96,0xAF,0x78,0x2C,0x53,0x94,0x29,
+	0x83,0xB1,0xFD,0xCE,0xC0,0x06,0xBE,0x2B,0xF9,0xCC,0xFD,
+	0x9D,0xB0,0x8A,0xC9,0xD0,0x9A,0x3F,0x2C,0x60,0x34,0x2F,
+	0x89,0xD7,0x1A,0xB1,0xCB,0xA4,0x46,0x95,0x6D,0x73,0x4D,
+	0xCD,0x06,0x92,0x3E,0xC3,0x98,0xAF,0xE6,0x0A,0xC7,0x39,
+	0x53,0xC3,0xFD,0x56,0xFA,0xDC,0xE0,0xB9,0x61,0xAB,0x38,
+	0x6B,0xF1,0x99,0x35,0xB4,0x25,0x34,0xCD,0x14,0x6E,0xE8,
+	0x35,0x89,0xBC,0x8B,0xDE,0xE8,0x36,0xBF,0x3E,0x1C,0x8D,
+	0x85,0x86,0xED,0xE0,0x5D,0xC0,0x98,0x7F,0xA5,0xD1,0x1F,
+	0xE1,0x42,0xDA,0x5B,0x8A,0xFF,0x1B,0x42,0xE1,0x1C,0xD8,
+	0x69,0xB4,0xC4,0xA4,0x45,0xCF,0xA0,0xD5,0x5C,0x27,0x45,
+	0x3E,0xA8,0x59,0xCD,0x08,0x82,0x8F,0x08,0xB6,0x2A,0x61,
+	0x17,0x3B,0xDD,0xC5,0x17,0x07,0x81,0x46,0xB5,0x5F,0x7E,
+	0x83,0x47,0x35,0x0C,0x89,0x1C,0x69,0xF8,0x77,0xE7,0x49,
+	0x4F,0x4B,0x93,0x3B,0xEF,0xE5,0x5F,0xE2,0xFA,0x0D,0x44,
+	0xD2,0x9E,0x21,0xE2,0xC5,0x42,0xE7,0xA6,0x1C,0x3C,0x4F,
+	0x51,0x4C,0x42,0x4D,0xED,0xC6,0x96,0x59,0xE1,0x1E,0x90,
+	0xBD,0xAC,0x21,0x9F,0x72,0x97,0xD6,0x53,0xF2,0xEF,0xC4,
+	0x7F,0xE7,0xCF,0x62,0xA1,0x3E,0xD7,0x7C,0xB3,0x6E,0x68,
+	0x3E,0x9C,0xA8,0x6F,0x27,0x99,0x83,0x32,0x98,0x67,0x9F,
+	0x49,0x5E,0x0C,0x94,0xC7,0xFB,0x46,0xA9,0xF5,0x71,0x2C,
+	0x93,0x43,0x5A,0xB1,0x84,0xF1,0x1E,0x50,0xDD,0x6F,0xD5,
+	0x13,0x70,0x5F,0x6D,0x33,0x3B,0x45,0x4A,0xED,0xD8,0x27,
+	0xA4,0x8B,0xD2,0x36,0x37,0x39,0xE4,0x6F,0x10,0x6D,0x89,
+	0xD2,0xF8,0x47,0xE3,0xB0,0xD5,0x8B,0x67,0xC0,0x62,0x6E,
+	0x8C,0xB7,0xB3,0x34,0xB8,0xE4,0xC6,0xF9,0x94,0xD5,0x32,
+	0xA8,0xA4,0xC5,0x54,0xE4,0x61,0x7B,0x97,0x7C,0x58,0xD0,
+	0x93,0x81,0x8D,0x03,0xE7,0x53,0xBF,0xB3,0xF0,0x87,0xC5,
+	0x8C,0x6F,0x9E,0x3E,0xF0,0x58,0xFF,0xC0,0xFF,0xAE,0x6A,
+	0x3E,0xD1,0x4F,0x7D,0xC6,0x99,0x11,0x8F,0x7A,0xCD,0xC2,
+	0xE0,0x05,0x32,0x52,0xD2,0x74,0x2A,0x7E,0x6A,0x1A,0x91,
+	0xB0,0xC0,0x52,0x05,0xE1,0xDB,0x63,0xC2,0x95,0x0A,0x7D,
+	0x54,0xA0,0xF9,0x92,0xDF,0xD2,0x4F,0x30,0xE0,0x86,0x79,
+	0x2A,0xC2,0x9F,0x4A,0xA3,0x3C,0xFA,0x1D,0x2D,0x40,0xEB,
+	0xF9,0xCD,0xBE,0xCF,0x53,0x00,0xF1,0x39,0x1B,0xF5,0xAF,
+	0x61,0xE6,0x52,0xF6,0x7D,0x9D,0xD9,0xD6,0x64,0xE9,0xBD,
+	0xAB,0x00,0x89,0xC4,0x78,0x56,0x02,0x53,0x31,0xD0,0x59,
+	0x2B,0x45,0x84,0x8E,0x4E,0x69,0xE0,0xD1,0x6E,0x1A,0xF6,
+	0xD1,0x99,0xBF,0x6E,0xFD,0xAF,0x13,0x95,0x15,0x09,0x72,
+	0xEE,0xEF,0x98,0xD6,0x63,0xDE,0xA1,0x8D,0xD3,0x64,0xF9,
+	0x38,0x9F,0x88,0x4A,0x95,0x6B,0x42,0xC3,0xA3,0x3B,0x14,
+	0x39,0xB1,0x17,0x00,0xF4,0x3D,0xEC,0x0D,0x1D,0x27,0x1B,
+	0x73,0x45,0x60,0x62,0x24,0x76,0xED,0xBE,0x4D,0x57,0xDA,
+	0xE0,0x3F,0x24,0x95,0x94,0xC2,0x9A,0x17,0xCF,0x5D,0xB8,
+	0x56,0xC0,0x9D,0xE8,0x85,0xA5,0x96,0x86,0x27,0xF6,0x62,
+	0x07,0x56,0xF6,0xBF,0xE7,0x45,0x24,0xF2,0x24,0xA2,0xC4,
+	0xD0,0xB1,0xD8,0x98,0x8E,0x45,0x38,0xB6,0x2D,0xEE,0xC6,
+	0x81,0xDE,0x7A,0x27,0xD3,0x42,0x2B,0xF6,0x2F,0x23,0x63,
+	0x9C,0xC6,0x90,0x32,0xA4,0x13,0x89,0x18,0x4A,0x98,0x8A,
+	0x4B,0x44,0xA3,0xC3,0x6B,0x1C,0x64,0x7F,0xD6,0x4E,0x68,
+	0xDB,0xA7,0xBE,0x10,0x60,0x10,0xAF,0x57,0x35,0x8E,0x98,
+	0x77,0xC1,0x4F,0xDC,0xF6,0xA6,0x84,0xDE,0x1D,0x22,0xF2,
+	0x02,0xFB,0xFE,0xC7,0xB0,0x48,0xB4,0xC8,0x92,0xF2,0x82,
+	0x5A,0x36,0xA6,0xFD,0xB0,0xF5,0x70,0xC4,0x2F,0x84,0xF2,
+	0x52,0xA6,0x99,0x63,0x14,0x83,0x0A,0xDC,0x79,0x50,0x86,
+	0xBA,0x12,0xF1,0x81,0x63,0xBF,0x1C,0xB5,0x0D,0xDA,0x4B,
+	0xF0,0x89,0x76,0xD4,0xD0,0xAB,0x5B,0xBA,0xCD,0xC9,0x5C,
+	0x07,0xA7,0x1F,0x5D,0x23,0x2B,0x17,0x96,0xAF,0x88,0x87,
+	0xC5,0xD5,0x64,0x1E,0x8D,0xA4,0xA5,0x24,0x29,0x7A,0xCF,
+	0xC6,0x63,0xB2,0x4E,0x6D,0x3A,0x2E,0x29,0xDD,0x58,0xDC,
+	0x5D,0x29,0xF2,0x59,0x2B,0xF2,0x7E,0x1B,0xF3,0xDF,0x8A,
+	0x6F,0xA7,0xD3,0xE1,0x9C,0xB9,0x69,0xA1,0xB3,0x04,0xFD,
+	0x93,0xF0,0xBA,0x8A,0xB7,0xB3,0xB7,0xEB,0x3A,0x56,0x92,
+	0xDF,0xF9,0xAD,0x81,0x4A,0xDF,0x56,0x2D,0x92,0x35,0x95,
+	0x1C,0x4D,0xA0,0x2C,0x43,0x52,0x87,0xD4,0xC0,0x27,0x37,
+	0x4F,0x39,0xB6,0xFA,0x4D,0x71,0xA8,0x2F,0xC3,0x17,0xCC,
+	0x53,0x99,0x08,0x56,0x79,0x8C,0x63,0x54,0x3A,0x1F,0x7C,
+	0xDD,0x28,0xA8,0xC0,0x76,0x92,0xD1,0xBF,0xBF,0xC6,0x21,
+	0xDD,0x08,0xDC,0x73,0xDE,0xB6,0x04,0x59,0x41,0xA6,0x61,
+	0x8F,0x21,0x4F,0x8E,0x65,0x75,0x91,0xBA,0x4E,0x06,0xCC,
+	0x4A,0x7D,0x24,0x4F,0xA2,0x78,0x7B,0xE4,0x24,0x0F,0xBD,
+	0xE4,0x39,0x66,0x5E,0xBA,0x29,0xAE,0x74,0x19,0x08,0x63,
+	0xBA,0xDD,0x74,0x18,0xC7,0x5A,0xB3,0xAB,0xD2,0x37,0x7C,
+	0x1C,0x85,0x36,0x53,0xF0,0x83,0x57,0xA1,0xFB,0x26,0x98,
+	0xC8,0x56,0x19,0xFB,0x47,0x11,0x4D,0x6D,0xA7,0xB2,0x45,
+	0xF0,0xCD,0xAE,0x94,0x7C,0x9B,0x2B,0x99,0xA7,0x0C,0xBE,
+	0x7A,0x51,0x86,0x6E,0x60,0xC7,0x41,0x3F,0x52,0x27,0x6D,
+	0x42,0x51,0x85,0xA2,0x29,0x3C,0x90,0x96,0xCD,0xDF,0x97,
+	0xF3,0x03,0xC8,0xFE,0xE8,0xE5,0x83,0xD3,0x56,0x8C,0xAD,
+	0xAD,0x97,0x14,0x1B,0xFF,0xD4,0x04,0x2B,0xFC,0x84,0x9A,
+	0x77,0x5E,0x0D,0x92,0x7C,0xCD,0xD1,0x42,0x69,0x62,0x98,
+	0x12,0x8A,0x39,0xD7,0xD8,0x7C,0xCC,0xCB,0xC7,0x56,0x42,
+	0x42,0xDA,0x19,0xCB,0xC4,0xB1,0x1C,0xB0,0xBF,0xFF,0x6C,
+	0xA9,0xD4,0x8F,0x4E,0xAB,0x7C,0x59,0xE7,0x07,0xE1,0xD2,
+	0xC8,0x2A,0xF5,0xF7,0x2A,0xA1,0x08,0xB4,0xD0,0xDE,0xF7,
+	0x24,0x1C,0xE9,0xA6,0x50,0x30,0x02,0xEE,0xEA,0xE6,0x91,
+	0xB0,0x34,0x8C,0x96,0x53,0xFD,0x8E,0x2C,0x38,0x84,0x06,
+	0xEB,0x09,0xED,0xB6,0xFF,0x0F,0xA3,0x49,0xE7,0x5D,0x46,
+	0x8B,0x63,0x57,0x2F,0x6B,0xBF,0x13,0xA9,0x94,0x06,0x7D,
+	0x16,0xC9,0x38,0xD9,0xD4,0x37,0x23,0x9C,0x3F,0xB1,0x2D,
+	0xF9,0x86,0x73,0x23,0x2D,0x54,0x40,0x95,0xFA,0xF1,0x23,
+	0xC1,0x26,0xAB,0xDF,0x28,0xB7,0xE5,0xE2,0x8F,0xED,0x97,
+	0x73,0x9C,0x9E,0xE7,0xC8,0xF1,0xFC,0x66,0xA8,0xA1,0x6A,
+	0xEF,0x24,0xC8,0xC3,0xD9,0xF9,0x29,0x76,0xAD,0x26,0x07,
+	0x21,0x69,0x22,0xB4,0x35,0x9E,0x92,0x47,0xC9,0x70,0x7E,
+	0x9C,0x61,0x27,0x0E,0x7A,0xF6,0xA7,0x80,0xE4,0x5F,0x07,
+	0x8A,0xC5,0xDA,0x6E,0xC2,0xA9,0x56,0xB6,0x3A,0x12,0x99,
+	0xF9,0x02,0xDD,0x5A,0x2F,0x6C,0xA5,0x76,0xFF,0xF1,0x6F,
+	0x4C,0x32,0x41,0x5E,0xE7,0xBD,0x99,0x6E,0x8E,0xDC,0x9C,
+	0x3E,0xBF,0xFE,0x84,0xF4,0x03,0x12,0xAA,0xB4,0x36,0xEA,
+	0x5A,0xE6,0xF1,0x45,0xBD,0x34,0xD4,0xD4,0xCE,0xAE,0x5C,
+	0x6A,0x2E,0x49,0x22,0xB2,0x8C,0x6F,0x71,0x60,0xA5,0x32,
+	0x6C,0x34,0xE0,0xEF,0x57,0xD3,0x75,0x90,0x70,0x56,0xC6,
+	0x1B,0x25,0x8C,0xB5,0x26,0x4C,0x6F,0x48,0xCC,0x1F,0xE4,
+	0xF7,0xEB,0xAE,0x0A,0x69,0xAF,0xE2,0x7D,0x34,0x0E,0x3E,
+	0x6B,0xAB,0xFD,0xDF,0x1E,0x71,0x72,0x09,0xA9,0x0D,0xFA,
+	0x01,0x8A,0x6A,0x86,0x86,0xB9,0xD3,0x8D,0xB8,0x99,0xB3,
+	0x83,0xC6,0x50,0xF2,0x50,0x1D,0xE2,0x54,0x16,0xF8,0x07,
+	0x7E,0x1D,0x86,0xBD,0x25,0x77,0x82,0x61,0xBA,0x1B,0xB6,
+	0x17,0xC8,0x06,0x04,0x5E,0xAC,0xA4,0xE0,0x78,0xB2,0xD5,
+	0x96,0xBA,0x3A,0x59,0x03,0x26,0x88,0x4F,0x38,0x9A,0x14,
+	0x79,0x24,0x42,0x90,0x42,0xD6,0x31,0x36,0xD6,0x26,0x5B,
+	0x0A,0xE2,0x93,0x62,0x98,0x71,0xA1,0x64,0x07,0x41,0x5C,
+	0x4A,0x8C,0x26,0x60,0x1D,0x99,0xCA,0x8F,0x0C,0x0D,0x23,
+	0x87,0x25,0x25,0x7D,0x20,0x8A,0x20,0x2D,0x82,0x3B,0xE3,
+	0xE0,0xB1,0xCC,0xAF,0x31,0xE4,0x04,0x0C,0xFF,0x48,0x12,
+	0x33,0x96,0x9C,0x12,0x76,0x28,0x32,0x8E,0x79,0x4D,0xFE,
+	0x6D,0x7C,0x9C,0xEC,0xD6,0x61,0x08,0x63,0x5F,0x33,0x90,
+	0x24,0xDB,0xAD,0xFF,0xF8,0xD5,0x4B,0x97,0x8F,0x9B,0x86,
+	0x68,0xD0,0x21,0xC7,0xF8,0xB0,0xAF,0x57,0x92,0xC3,0x6E,
+	0x16,0x86,0x75,0xC4,0xDF,0x89,0x9F,0x4D,0xB4,0x89,0x88,
+	0xF9,0x90,0x9C,0x02,0xB8,0x30,0xB7,0x92,0xA2,0xC9,0xFB,
+	0x91,0xEF,0xE3,0xA4,0x01,0xBE,0x5D,0x52,0xD8,0x91,0x23,
+	0x64,0xC7,0x69,0x5A,0xDC,0xE9,0x23,0xC9,0x80,0x73,0x3C,
+	0x4B,0x10,0x99,0x4C,0x76,0xD3,0x24,0x7B,0x32,0xD3,0xF6,
+	0xC4,0xC4,0xD4,0xC4,0x2B,0x58,0x44,0xA6,0x44,0x77,0x89,
+	0x12,0xDB,0x3B,0x8D,0x23,0x99,0x6F,0xC9,0x2E,0xD6,0x7C,
+	0x77,0xDB,0x98,0xF8,0x6F,0x22,0x71,0x64,0x5F,0x66,0xF4,
+	0x22,0x2E,0x0C,0xC8,0xD1,0x40,0xC7,0x33,0xAC,0xF6,0xBB,
+	0x6E,0x79,0x79,0x38,0x58,0xC6,0xBF,0x8B,0xB0,0x7B,0xB4,
+	0xC2,0x42,0x86,0xDF,0x3C,0x52,0xFC,0x2F,0x39,0x3E,0x3C,
+	0x25,0xCD,0x2A,0x36,0xEC,0x50,0x8E,0x83,0x4E,0x47,0x48,
+	0x49,0xD8,0x8C,0x44,0xDA,0xC1,0xD3,0x11,0x64,0x0B,0x4B,
+	0xCF,0xFD,0x02,0x67,0x6F,0x2F,0x1B,0x67,0x3F,0xB2,0xEB,
+	0xEE,0x7E,0xF2,0x01,0x0B,0x0F,0x8B,0x87,0xD6,0x0E,0x36,
+	0x9E,0x9A,0xC8,0x0E,0xBF,0x62,0xF2,0xA2,0x16,0xED,0x5B,
+	0x58,0x8C,0x26,0x52,0x4F,0x3C,0xBD,0x43,0x24,0xD4,0x75,
+	0x26,0xE5,0x68,0x70,0x0E,0x8B,0x11,0xED,0x6B,0xCB,0x64,
+	0xC5,0xFB,0x9F,0x7C,0x47,0x8A,0x08,0xA3,0xB8,0x4D,0xBA,
+	0x05,0x3F,0x44,0x23,0xED,0xB6,0x5C,0xBD,0xC9,0x76,0xAF,
+	0xDB,0xF1,0x7B,0x12,0xDD,0x58,0xC1,0xFF,0x62,0x22,0x43,
+	0xC8,0xCE,0x90,0xC3,0x3F,0xE9,0xD1,0xB9,0x9C,0x4C,0x1E,
+	0x3F,0x25,0xC1,0x44,0x4B,0x2B,0x6D,0x06,0xD0,0x54,0xBB,
+	0xA9,0x39,0x7C,0xE7,0x48,0xDD,0xD8,0xA2,0x53,0xF4,0xE7,
+	0xAD,0xD8,0xE4,0xA3,0xA8,0x92,0x90,0xE8,0x8F,0x6D,0xF7,
+	0xAC,0xF7,0x7B,0x12,0x2E,0xF4,0x30,0x63,0xE5,0x53,0x5B,
+	0x9C,0x93,0xFB,0x9A,0x57,0x4E,0x6B,0xEA,0x69,0xEA,0x22,
+	0xF7,0xE7,0x24,0xC8,0xA3,0x1E,0x1E,0xBB,0x17,0xF6,0x36,
+	0x32,0x46,0x25,0x10,0xCD,0x0C,0xD5,0xB3,0x38,0x1E,0x1F,
+	0xF9,0x7A,0x37,0xF8,0x28,0x39,0x36,0x3E,0x75,0x4D,0x54,
+	0xE6,0xB0,0x79,0xAC,0x48,0x7E,0x72,0x6A,0xEF,0x91,0xB0,
+	0xD5,0xCB,0x49,0x41,0x0F,0x55,0xAC,0x54,0xC9,0xBA,0xDA,
+	0xB1,0x00,0x7D,0x03,0xA6,0xAB,0xAB,0xA7,0xAB,0xAF,0x6B,
+	0xA8,0xBB,0x67,0x8F,0xB1,0xDB,0x47,0x87,0x58,0xC4,0x3D,
+	0xE7,0xB0,0xE0,0xBD,0x01,0x62,0x2A,0x21,0xB3,0x6E,0x77,
+	0x9C,0x2D,0x5A,0xEC,0x9C,0x9F,0x63,0x7E,0x09,0xB3,0x73,
+	0xF0,0x1B,0x71,0x21,0x31,0xAC,0xA9,0xD0,0x67,0xBF,0x5D,
+	0x3C,0x35,0x7A,0x73,0x4D,0x8B,0x13,0x22,0xDA,0x83,0x0B,
+	0x35,0xB4,0x8F,0x7E,0x38,0x46,0x0B,0xF1,0x74,0x72,0xE0,
+	0xBB,0xD9,0x3B,0xD8,0xD9,0x93,0x4D,0xC6,0x4B,0xBF,0x36,
+	0x1A,0xCB,0xE5,0xCD,0x2C,0xC7,0xDF,0x3F,0x1E,0xA7,0x9C,
+	0x22,0x94,0x99,0xBA,0x1E,0x77,0x54,0x32,0xB6,0x4F,0x73,
+	0x56,0xC3,0xD9,0xCA,0x9A,0xBC,0x05,0x68,0x78,0x9F,0xF9,
+	0xDA,0x13,0x39,0xBB,0xA3,0x6F,0x79,0x80,0x9C,0x3B,0x55,
+	0x9D,0x10,0x9E,0x0A,0x6B,0xA5,0xDC,0x53,0x90,0xB6,0xD3,
+	0xA6,0xAE,0x47,0xB1,0x1E,0x24,0xDC,0x08,0x97,0xB0,0xB9,
+	0xE6,0x8B,0x7C,0xDD,0x17,0x8C,0xEC,0x1E,0xB7,0xCE,0xC9,
+	0x20,0xE2,0xD9,0xEA,0xC2,0xA7,0x93,0x34,0x5B,0x2E,0xC4,
+	0x06,0xBC,0xDE,0xB6,0x3A,0x18,0xB0,0x37,0x74,0xB2,0xEA,
+	0xDA,0x57,0x73,0x13,0xE1,0xCE,0xE3,0xA2,0xB6,0x27,0x62,
+	0x20,0xDE,0x6F,0xAC,0x11,0x53,0xB6,0xD0,0x31,0x6B,0xF7,
+	0x34,0x88,0x95,0xFB,0xC9,0x08,0x4A,0x78,0xEE,0xEF,0xE2,
+	0x9E,0x6F,0x01,0x1A,0x07,0xD1,0x0F,0x2C,0xA1,0xBE,0x47,
+	0x2D,0x76,0x6D,0xF7,0x1F,0x44,0xE6,0xBB,0x84,0x53,0x85,
+	0x62,0x9F,0x16,0xA7,0x7C,0xC2,0xAC,0x8E,0x89,0xEA,0x8B,
+	0xC4,0x93,0x21,0x79,0x09,0xDD,0x56,0x2A,0xDE,0xFA,0x33,
+	0x66,0x5F,0x63,0xD3,0x73,0xDC,0xD6,0x6A,0xAD,0x74,0x69,
+	0xF7,0xC0,0x31,0x47,0xA9,0x8B,0xB6,0x5F,0x6D,0x59,0x31,
+	0xE8,0x50,0x93,0x1C,0x7C,0x4E,0xF2,0xA5,0xFE,0x90,0x48,
+	0xA5,0x62,0xBD,0xE0,0x03,0x7F,0x9C,0xBC,0x3F,0xC6,0x19,
+	0xD0,0xF7,0x5A,0x27,0x6B,0x20,0x13,0xA2,0xF7,0xBB,0xC4,
+	0x05,0xEF,0x8D,0x11,0x61,0x9A,0x06,0x9A,0x74,0x30,0x43,
+	0x2A,0x87,0x83,0xCB,0x6B,0x9B,0x95,0x69,0x53,0x61,0x43,
+	0xB6,0xB2,0xA1,0xA6,0xE5,0x87,0x8D,0xE8,0x56,0x55,0x77,
+	0x98,0xE4,0x0B,0xBA,0xB0,0x0B,0xD7,0x52,0x4E,0x18,0x59,
+	0x67,0xB8,0x84,0xDE,0xD4,0xBD,0x73,0xB0,0x2A,0x32,0xCC,
+	0xBC,0x3B,0xCD,0xDA,0x52,0x23,0x9C,0x3E,0xF3,0x98,0xF9,
+	0xD9,0xCF,0x4D,0xE7,0x68,0x05,0x85,0x28,0xE4,0x1E,0xEB,
+	0xCE,0x8A,0x35,0x8A,0xBE,0x45,0x20,0x09,0xAF,0xE4,0xE1,
+	0x50,0x07,0xE2,0x9D,0xC2,0x62,0x85,0x53,0xA7,0xDD,0x29,
+	0x78,0x03,0xF5,0x6D,0x62,0x04,0x33,0x71,0x69,0x4C,0xD3,
+	0xA3,0xD2,0xD3,0xE0,0x77,0x4A,0x65,0xE6,0x77,0xDF,0x8A,
+	0xD3,0x3A,0x98,0x28,0xAA,0x8B,0x74,0x21,0x5A,0x3D,0xCD,
+	0x95,0xAC,0xF8,0xC1,0xB5,0x4E,0x25,0xF6,0x6E,0x42,0xAD,
+	0x43,0x6C,0x75,0xAC,0x41,0x37,0x1B,0xF8,0x60,0xA3,0x60,
+	0xF3,0x36,0x3D,0x85,0x25,0xBB,0x9A,0xAD,0xD4,0xE3,0x74,
+	0x1E,0xB0,0x0E,0x71,0xB2,0x1E,0x61,0xA6,0x28,0xB9,0xAA,
+	0xAC,0x7A,0x84,0x55,0x31,0x63,0xAC,0x6A,0x53,0xAC,0x0D,
+	0x7D,0x3E,0x78,0x2A,0x78,0xA2,0x8D,0xDF,0x49,0x25,0xC7,
+	0xEA,0xA9,0x4A,0x69,0x64,0x39,0x6A,0xC4,0xDD,0x66,0x85,
+	0x4F,0xE1,0xD2,0xFF,0x9D,0x4A,0x7E,0xDA,0xEF,0xD1,0xFD,
+	0x2B,0x19,0x1E,0xE0,0x7A,0x6A,0xEC,0xCE,0xCF,0x2F,0x96,
+	0x81,0x1E,0x66,0x2F,0x0E,0x8F,0xEC,0xCB,0xF8,0xC4,0xBA,
+	0xFF,0x9B,0x19,0x0E,0xCB,0xBE,0x84,0x0D,0xDE,0xF9,0xA3,
+	0xEE,0xDB,0x62,0x11,0x13,0x2B,0x75,0xB4,0x43,0x95,0xA9,
+	0x74,0x47,0x7D,0x8A,0x14,0xC2,0x3C,0xF5,0x24,0x2C,0x3D,
+	0xF2,0x8D,0x99,0xC2,0x33,0x8B,0xF6,0x37,0x09,0x27,0x8C,
+	0x45,0x6A,0x3C,0x7E,0xDC,0x1C,0x49,0xDD,0x53,0x8D,0xB9,
+	0xC3,0xD8,0x3A,0x10,0xE2,0x14,0x02,0xA9,0xDF,0xDF,0xD7,
+	0x27,0x8A,0x0B,0x62,0x85,0xF1,0x9F,0x79,0x1E,0x8F,0x7A,
+	0x96,0x00,0x4E,0x36,0x67,0x04,0xA5,0x2E,0x8E,0x58,0xBF,
+	0x8D,0x68,0xD9,0x36,0x09,0xD5,0xCB,0x74,0x35,0x6F,0x9B,
+	0x44,0xD7,0x8F,0x77,0xA4,0x2E,0x47,0x27,0xBF,0xB3,0xF3,
+	0x3A,0xAA,0x56,0xFD,0xE8,0x44,0x84,0x02,0x96,0xC9,0xD8,
+	0xF4,0x65,0xF6,0x1E,0x64,0xA4,0x7E,0xD4,0x3C,0xA2,0x91,
+	0xA3,0xD7,0xB1,0x1D,0x27,0xDA,0x1C,0xAA,0x4F,0x17,0x97,
+	0x58,0xF1,0x4F,0x32,0x51,0xE2,0x46,0x8C,0x71,0xD5,0x3F,
+	0xC6,0x6E,0x4C,0x46,0xFA,0x9A,0xE4,0x59,0xF5,0xAA,0x5B,
+	0x25,0x67,0x88,0xA1,0x3A,0x4D,0xC8,0xB4,0xE4,0x18,0x88,
+	0xCD,0xA1,0xD0,0x49,0x23,0xE4,0x5B,0x05,0x94,0xC6,0xC9,
+	0xE8,0xB9,0x88,0xA0,0x50,0xAB,0x6B,0x9D,0x2A,0x04,0x55,
+	0x20,0xFB,0x80,0xEE,0x9A,0x09,0xC1,0x50,0x2C,0xA3,0x07,
+	0x78,0xBF,0x57,0x30,0x2F,0x00,0x84,0x67,0x4C,0xA1,0x90,
+	0xEB,0x88,0x6A,0x9C,0x54,0xA4,0xD2,0x75,0xDD,0xA0,0xE3,
+	0x33,0x00,0x58,0xEB,0x83,0x2E,0x19,0x61,0x8D,0xBF,0x36,
+	0xE0,0x3E,0xC9,0x4F,0x0B,0xBA,0x63,0xDE,0x61,0x9F,0xE6,
+	0xBD,0xE5,0x99,0x12,0x8A,0xDA,0xAF,0x67,0x64,0x38,0x02,
+	0x38,0xB3,0x1E,0xA6,0xAB,0xD9,0xB8,0x14,0x7A,0xDF,0x8E,
+	0xFD,0x75,0xF0,0xFD,0x77,0x67,0xBB,0xB9,0x04,0x21,0xF1,
+	0xA4,0x87,0x56,0x06,0x5A,0xC6,0x7A,0x40,0x1B,0x55,0xB6,
+	0x9D,0xDA,0x25,0x89,0x3E,0xF3,0x48,0x4A,0x1D,0xD7,0xD8,
+	0x1E,0x2E,0xE2,0xB0,0x51,0xF0,0xC9,0x2E,0x74,0x3A,0xCD,
+	0xE7,0xB1,0x42,0x4E,0xC0,0xDB,0x90,0xFB,0x18,0x5F,0x19,
+	0xD4,0x23,0xA5,0x50,0x39,0x92,0xED,0x26,0xF3,0x7D,0xB1,
+	0x9B,0xCB,0xDD,0xE8,0x88,0xF8,0x8B,0xAA,0x66,0xC6,0xD1,
+	0x32,0xDE,0xA9,0xD9,0xC8,0xF3,0xEF,0x2B,0x20,0xD7,0xF5,
+	0x3B,0x5F,0x0D,0xBA,0xCC,0x6C,0x1A,0x82,0x50,0x7E,0xC4,
+	0x2B,0x8A,0x34,0x96,0x90,0xCB,0x2B,0x48,0xB4,0x0B,0xFB,
+	0x86,0xFE,0x83,0x57,0xEF,0x5C,0x7E,0x61,0x2A,0xD0,0xCA,
+	0x91,0x66,0xD7,0x9D,0xAB,0x03,0x12,0x23,0x73,0xAE,0x5F,
+	0xAD,0x7E,0xB4,0x12,0x83,0x10,0x69,0x53,0x70,0x31,0x8D,
+	0x32,0x38,0xFB,0x4A,0xB4,0xD5,0xE5,0xD9,0x17,0xFD,0x9D,
+	0x69,0x69,0x8C,0xA9,0x9E,0xD0,0x2D,0x57,0x48,0x65,0x14,
+	0xB2,0x82,0xF4,0x47,0xE4,0x6D,0xE8,0xB1,0x4F,0x51,0x98,
+	0x58,0xD3,0x88,0xE4,0x68,0xB4,0xA6,0x08,0xDF,0x36,0x3A,
+	0x46,0xF4,0x53,0x9A,0x9E,0xE7,0x67,0x3D,0xEC,0x1D,0x17,
+	0x6A,0x23,0xCC,0x79,0x52,0x3C,0x37,0x28,0x37,0xAC,0x36,
+	0x58,0xC6,0x58,0x88,0x63,0x90,0x48,0x2A,0x35,0x28,0xDF,
+	0xAD,0x95,0x34,0x2F,0xF3,0x60,0x24,0x17,0x63,0x00,0x57,
+	0x49,0xF3,0x46,0xA5,0x90,0x5B,0xA9,0x46,0x51,0x34,0x9B,
+	0x9D,0xA8,0x5B,0x5B,0x73,0x2E,0x77,0x38,0xBC,0xD3,0xC9,
+	0x21,0x2F,0x03,0xFE,0x3F,0xB1,0x81,0x3E,0x6D,0xBF,0x31,
+	0xA9,0x93,0xD7,0x8F,0xBC,0x8B,0xF4,0xB9,0x12,0xAE,0x12,
+	0x82,0x4C,0x2C,0x2E,0x16,0x39,0x15,0x9A,0xA2,0xA5,0x10,
+	0x5F,0x66,0x6B,0xE1,0x35,0xAB,0xA7,0xAB,0x34,0x6D,0xCA,
+	0x0A,0x74,0x9B,0xCC,0x49,0xDE,0x60,0x25,0x24,0xF4,0xD8,
+	0x5C,0xF2,0x8A,0x68,0xCD,0x8A,0xA6,0x0C,0xE4,0x96,0x27,
+	0x11,0xBC,0x50,0x9D,0x53,0xA1,0xBA,0xC5,0xBB,0xFF,0x57,
+	0xF2,0x74,0x46,0x35,0x95,0x28,0xCC,0x7B,0x73,0xD3,0x13,
+	0x52,0x49,0x20,0xD4,0x04,0x08,0x04,0x69,0x01,0x69,0x0A,
+	0x08,0x09,0x10,0x22,0x10,0x89,0x14,0x09,0x55,0x4A,0x08,
+	0x20,0x09,0x60,0xA8,0xEA,0xBE,0x95,0x2E,0x2C,0x88,0x60,
+	0x41,0x45,0xDD,0xB5,0x20,0x0B,0x2B,0x68,0x8C,0x08,0x01,
+	0x51,0x29,0x16,0x58,0xC0,0x05,0xB1,0x80,0x51,0x44,0xD7,
+	0x7D,0xA2,0x88,0x7D,0x41,0x9F,0x25,0xDF,0xBE,0xEF,0xCD,
+	0x9C,0x33,0x67,0xE6,0xC7,0x9C,0x39,0x13,0xEE,0x9B,0xF4,
+	0xF6,0x75,0xFB,0x4C,0xA4,0x91,0xFC,0xD9,0x7B,0x4E,0xDF,
+	0x0A,0x2C,0x66,0xCD,0xD3,0xEE,0x7B,0xE9,0x54,0x39,0xC5,
+	0xDD,0x27,0x6E,0x99,0x6E,0x9C,0x19,0xB0,0x29,0x5B,0x6D,
+	0x6A,0x28,0x9D,0xF1,0x2C,0x6A,0x48,0xD9,0x84,0x9A,0xCD,
+	0x35,0x4C,0xDA,0x71,0x5E,0x6E,0x08,0x0B,0x7C,0xD5,0x6F,
+	0x30,0x9F,0x97,0xB4,0x46,0x03,0x0A,0x22,0x7C,0xA5,0x39,
+	0xA9,0x92,0x79,0x55,0xFF,0x1C,0x6D,0x99,0x43,0x80,0xF2,
+	0xD8,0xA7,0x3A,0x36,0x6F,0x2E,0xF6,0xD7,0xF4,0x12,0x4B,
+	0x69,0xBD,0x47,0x57,0x21,0x96,0x23,0xA9,0x74,0x86,0xD7,
+	0x89,0x3E,0xEF,0x27,0xF2,0xE9,0x57,0x4A,0x53,0x16,0xF2,
+	0xAE,0x44,0xC8,0x27,0x9D,0xF4,0xCB,0x60,0x24,0xFF,0x3B,
+	0x24,0xD4,0x34,0xAF,0x51,0xAB,0x0E,0xE4,0x2B,0x58,0xEB,
+	0x2D,0xA5,0x66,0x6A,0xC3,0x1B,0x3B,0xE5,0x0C,0x4C,0x5A,
+	0x51,0x79,0xF4,0xEC,0x40,0xF2,0xD0,0x21,0x47,0xA4,0x3B,
+	0x59,0x4A,0x13,0x34,0xDA,0xCD,0xE5,0x77,0x8E,0xB4,0xC4,
+	0x36,0x77,0xBC,0x8C,0x65,0x52,0x79,0xF9,0x6E,0xC9,0xC9,
+	0xE7,0xB6,0x5C,0x2B,0x2F,0xFE,0xE1,0x42,0xB7,0x74,0x9D,
+	0xBD,0x69,0x8C,0xE1,0xAE,0xAB,0xA3,0xCA,0x34,0xDB,0x00,
+	0xAF,0x70,0x12,0x0B,0x25,0x66,0xC5,0x57,0x05,0xEC,0x56,
+	0x99,0x1E,0xB7,0x95,0x86,0xE6,0x94,0x9A,0xE1,0x06,0x0C,
+	0xDC,0xAF,0xC9,0x37,0x42,0xC6,0xC4,0xAD,0x17,0x0B,0xDA,
+	0x55,0xA5,0xB6,0xA5,0x8E,0x16,0x77,0x2C,0x93,0xC7,0x93,
+	0x27,0x2E,0xB3,0xA5,0x6C,0x36,0x83,0x94,0xF4,0x20,0x7B,
+	0xED,0xCA,0x94,0x9B,0xDA,0xF2,0xCE,0x1D,0xC1,0x06,0x29,
+	0xE7,0x82,0x22,0x2B,0x24,0x45,0xAC,0x1A,0x49,0x3E,0x2B,
+	0x33,0x56,0x85,0x19,0x7A,0x2A,0x2E,0xAD,0xE4,0x48,0x81,
+	0xA7,0xE7,0x0A,0x79,0xAE,0xC8,0xA1,0x55,0x7D,0x05,0x2E,
+	0x36,0x81,0xCD,0xB7,0x97,0xC3,0x62,0x78,0x27,0xDE,0x39,
+	0x54,0x5A,0x65,0xF8,0x3D,0xA2,0xAF,0x8A,0x6A,0x7F,0x68,
+	0xBF,0x7E,0xFA,0x7C,0x66,0xB2,0x67,0x7C,0xAA,0x09,0xF9,
+	0x62,0xD2,0xFE,0x4E,0xD7,0xAD,0xAC,0x59,0x75,0x10,0x3C,
+	0x41,0x2B,0xC7,0xB7,0x0C,0xD9,0xF1,0xB5,0xD3,0x29,0x3F,
+	0x3A,0xF5,0xE5,0xEE,0x51,0x7F,0x57,0x38,0x02,0xD4,0xB3,
+	0xF5,0x4D,0x05,0xF8,0xEC,0x0C,0x0B,0xCA,0x90,0xFF,0xC9,
+	0xBA,0xC3,0xFE,0xEA,0xAE,0x3F,0x08,0xFB,0x5A,0x6E,0x5A,
+	0x61,0x7E,0x76,0xC0,0xE5,0x09,0xF5,0xD8,0xE8,0x9D,0xD3,
+	0xA9,0x99,0xDD,0x50,0xC1,0x64,0x20,0xFA,0x2E,0x17,0xC0,
+	0xA9,0x80,0x7B,0xFC,0x68,0xDC,0x0A,0x17,0x60,0x66,0xD7,
+	0xEE,0x8B,0x2F,0x7F,0x9B,0xB8,0x5A,0x7D,0x2E,0x95,0xFD,
+	0x63,0xF8,0xF3,0x90,0x76,0x4D,0x68,0x58,0x50,0xBF,0xA7,
+	0x41,0xD9,0xFC,0x06,0xB2,0x76,0x73,0x2E,0xD4,0xAA,0x54,
+	0xED,0xC0,0xC9,0xF6,0x36,0xFC,0x22,0xEB,0x6C,0xBE,0xFE,
+	0x3C,0x33,0x47,0x4D,0xA1,0x3C,0xB3,0xA5,0xFC,0x3B,0xBC,
+	0x21,0x5D,0x56,0x73,0xB8,0x8D,0x87,0x54,0x5E,0x80,0x3D,
+	0x82,0xF0,0x09,0x7A,0x8F,0x00,0x02,0x82,0x38,0x01,0x90,
+	0xC8,0x5A,0x80,0x72,0x22,0xAD,0x2B,0xFD,0x56,0xF2,0x61,
+	0x39,0xF0,0x0B,0x2F,0x34,0xD2,0x61,0x9E,0x0F,0x38,0x4C,
+	0x21,0x9F,0xCC,0xB8,0x0F,0xFD,0x00,0x5C,0xA1,0x0B,0x8E,
+	0x92,0xBC,0x90,0xF8,0x17,0xA2,0xBA,0xA8,0xE1,0xC3,0x30,
+	0x79,0xB6,0x51,0x12,0xCF,0x47,0x84,0x76,0x8C,0x33,0x78,
+	0x9B,0x26,0x89,0x75,0x1F,0x02,0x0C,0x0A,0x87,0x24,0x4E,
+	0x17,0x0E,0x13,0x9C,0x87,0x7E,0x1E,0x3E,0x50,0x7E,0x86,
+	0x8B,0x59,0xD5,0xBD,0xCA,0xDF,0x1A,0x91,0xB5,0x95,0x8E,
+	0x7E,0xD0,0x3A,0x66,0xA4,0xCE,0x19,0xEC,0xE1,0x44,0x46,
+	0xEC,0xFE,0xBA,0xCD,0x7A,0xB6,0xC5,0xFB,0xA1,0xBE,0xD6,
+	0xB8,0xC8,0x6B,0x70,0x49,0xF6,0x48,0xBB,0x4D,0x31,0x2A,
+	0x2F,0x1E,0x38,0xB6,0xE1,0xBE,0x77,0x1E,0x0B,0x63,0x56,
+	0x95,0xDF,0xEE,0x14,0x93,0x54,0x3D,0x5C,0x19,0xFA,0xD9,
+	0xAD,0xEC,0xEF,0x1F,0x03,0x57,0x7B,0x18,0xCF,0x7E,0xC7,
+	0x5E,0x27,0xBF,0x4A,0x02,0x98,0xFC,0x33,0x4F,0xDC,0xA9,
+	0xA3,0xD9,0x01,0x50,0x73,0x58,0x7C,0x66,0x56,0xEB,0x8F,
+	0x47,0x9A,0x96,0x29,0x1C,0xDD,0x1A,0x14,0x60,0x00,0x5C,
+	0x42,0x20,0x04,0x80,0xB1,0x10,0x2A,0x20,0xFA,0xCF,0x1A,
+	0xAB,0xDD,0x64,0x28,0x72,0x63,0x0D,0x1D,0x67,0x0F,0xC4,
+	0xEE,0xA1,0x58,0xF2,0x98,0xEF,0x05,0x2D,0x95,0x7D,0x40,
+	0xC3,0x39,0xCF,0xB5,0x7C,0x1F,0x7B,0x76,0x3B,0x36,0x91,
+	0x8A,0x04,0x3C,0x5E,0x22,0x10,0x72,0x83,0x2D,0xFA,0x8E,
+	0x4E,0x7C,0x0F,0xDB,0xCB,0xFE,0xE2,0xBA,0x1F,0x52,0x15,
+	0x93,0xEC,0xE0,0x03,0x33,0xEB,0x1D,0xB8,0xFD,0xB4,0xED,
+	0x7D,0xA6,0x1D,0xB2,0x67,0x23,0xC6,0x7E,0xD2,0xAF,0x9D,
+	0x6C,0xEA,0x71,0xED,0xB6,0xF4,0xF3,0x4A,0xD6,0xFD,0xD7,
+	0xAE,0x6A,0xCE,0xA3,0x1F,0x25,0xD2,0x48,0xDC,0xF9,0x93,
+	0xC9,0xB3,0x1F,0x8A,0xEE,0x94,0xF1,0x1D,0xD9,0x59,0xE6,
+	0xAE,0xB2,0x94,0x8B,0x29,0x51,0xA5,0x9E,0xD7,0x39,0x83,
+	0x34,0x95,0x78,0xFC,0xEC,0x3A,0x7E,0x69,0xA1,0x6D,0xE2,
+	0x88,0x32,0x4E,0x4C,0x27,0x68,0x82,0x09,0x86,0xCB,0x87,
+	0x2D,0x46,0x8B,0xE8,0x4E,0x02,0x63,0x75,0x36,0x8B,0xBF,
+	0xD7,0xEF,0x5C,0x1D,0x1D,0x97,0x6E,0xA2,0xB7,0xE3,0x58,
+	0x2A,0x0A,0x1A,0x07,0x7E,0xBB,0x72,0xC4,0x48,0x71,0x7B,
+	0xED,0x09,0xDC,0x9E,0xCD,0xC0,0x05,0x29,0x6D,0x04,0xC4,
+	0x6B,0xF6,0xC1,0x98,0x2E,0x43,0xA1,0x50,0xC9,0xE8,0x2D,
+	0x17,0x38,0x34,0x9D,0xA4,0x58,0xF3,0xC6,0x4B,0x0A,0x93,
+	0x3E,0x42,0x1C,0xA4,0x19,0xE6,0x85,0x4D,0x65,0x52,0xA2,
+	0x8C,0x17,0x58,0xDD,0xAF,0xD7,0x40,0x0F,0xF5,0x70,0xF0,
+	0xAF,0x55,0xCC,0x09,0x92,0x8C,0xAF,0xC5,0x17,0x3C,0x8B,
+	0x3C,0x1A,0x94,0x4D,0xF7,0xEC,0x7C,0x8F,0x28,0x33,0x76,
+	0xDD,0x44,0xF9,0x12,0x0A,0x48,0x7E,0x19,0x4C,0x66,0xF6,
+	0xB6,0x7A,0x48,0xB1,0x03,0xCC,0xEA,0x4D,0x4E,0xA7,0x91,
+	0x91,0x65,0xB1,0xCE,0xA9,0x13,0xA1,0x87,0xE2,0xAC,0x56,
+	0xC8,0x87,0xB6,0x19,0xDA,0x70,0x6E,0x46,0x7E,0x62,0xF7,
+	0x55,0xB4,0x73,0xEE,0xE9,0x36,0x19,0x60,0xAA,0x0C,0x6D,
+	0xAC,0x0A,0x9F,0xDF,0x5D,0x47,0xC7,0x60,0x04,0x87,0x47,
+	0x69,0x0D,0x20,0xE3,0x8C,0x35,0xCC,0x4F,0x3A,0x78,0x18,
+	0x02,0xF7,0x4E,0x48,0xE1,0xC8,0xC7,0xEB,0x1B,0x10,0x8C,
+	0x65,0x6B,0xA4,0x9F,0x12,0xC6,0x30,0x41,0x95,0x8C,0xE2,
+	0x5D,0xD0,0x71,0xD7,0x6D,0xD5,0x10,0x8F,0x7E,0xBD,0x10,
+	0xE2,0xF9,0xC3,0x92,0xEC,0xB2,0x2D,0x3F,0x84,0x02,0x74,
+	0xE0,0x91,0x39,0xEB,0x4E,0xB7,0x37,0xA4,0xEF,0x64,0x07,
+	0xBB,0x25,0x71,0xDE,0x50,0x06,0xBC,0x7B,0xCB,0xB4,0xD8,
+	0x0E,0x44,0x51,0x0E,0x3C,0x13,0x34,0xD9,0x9C,0xF8,0xC1,
+	0x3E,0x38,0xB6,0x22,0x75,0x77,0x05,0xF9,0x04,0xCF,0x1E,
+	0xEB,0x55,0xC1,0xD1,0x00,0x75,0x2F,0xDC,0x69,0xB5,0xCB,
+	0xB6,0xF8,0x71,0x6F,0x3B,0xC3,0x17,0x54,0xA6,0x22,0x3E,
+	0xA7,0x58,0x40,0x88,0x21,0xA9,0x70,0x8A,0xF8,0xBC,0x21,
+	0x9B,0x14,0x40,0x7D,0xC0,0x68,0xDB,0x83,0x30,0xE5,0x75,
+	0x46,0xE9,0xEF,0xA3,0xB2,0x02,0xD1,0x50,0xDD,0xDE,0xDF,
+	0x3F,0xE4,0xE7,0x74,0xD9,0xE2,0x7F,0x1B,0x33,0x16,0x98,
+	0xC4,0xB1,0x58,0xF7,0xC5,0x72,0x85,0xCA,0xCC,0xD5,0x6B,
+	0x4B,0xF0,0x54,0x53,0xE0,0x98,0x20,0x3A,0x44,0xE5,0x7B,
+	0xC8,0x5E,0x84,0xBE,0xA5,0x5A,0x29,0x66,0x98,0x1A,0x35,
+	0xAF,0xEB,0xDF,0x45,0x59,0x3B,0x58,0x90,0x17,0xD5,0x7A,
+	0x32,0xB2,0xE1,0xDB,0xAC,0x35,0x95,0xF3,0x84,0x69,0xCB,
+	0xBC,0x66,0x57,0x4C,0xF3,0x1B,0xE9,0x61,0x54,0x8C,0xEB,
+	0x3D,0x21,0x4E,0xFE,0x13,0xF8,0x77,0x0C,0x8C,0x2A,0x66,
+	0xBA,0x2A,0x2F,0x1A,0xAA,0xE6,0x2C,0xA7,0x01,0x86,0xCD,
+	0x56,0x73,0x00,0x57,0x3F,0xD8,0x66,0x1C,0x2F,0xE4,0xC9,
+	0x9F,0xC3,0x87,0xDF,0xE5,0xD9,0xF3,0x55,0x40,0xE7,0x49,
+	0xCB,0x8F,0x5E,0x1F,0x10,0x10,0x17,0xA8,0x35,0xAC,0x4E,
+	0x22,0xD3,0x8D,0x7E,0xC3,0x6D,0x9B,0x62,0xBB,0x29,0xB8,
+	0xFB,0xB0,0x69,0xA8,0x10,0x3D,0x19,0x66,0x2F,0x52,0x2E,
+	0xBC,0x5C,0x68,0x62,0x82,0xB8,0x02,0xD9,0x2A,0xC2,0xB2,
+	0x54,0x85,0x22,0xBD,0x4D,0xE9,0xC5,0x5B,0xE3,0xCC,0x52,
+	0xCB,0x62,0x49,0xB6,0x45,0xDC,0x21,0xE7,0x63,0x27,0x7A,
+	0x50,0x2D,0xB6,0xEB,0xB4,0x26,0x67,0x62,0xDB,0x03,0x9E,
+	0x13,0x7A,0x5F,0xD0,0x40,0x06,0x08,0xAA,0x6F,0xD8,0xC9,
+	0x61,0x34,0xE4,0xA3,0x2D,0x66,0x2F,0xAF,0x1A,0x18,0x29,
+	0x2C,0x78,0x97,0x34,0xD4,0x9F,0xFD,0xB3,0xA0,0x5F,0xEE,
+	0x36,0x6F,0x53,0x15,0xF6,0x01,0x3E,0x44,0x21,0x2C,0xA5,
+	0x7F,0x63,0x78,0x53,0xCD,0xEB,0xB9,0x23,0xC3,0xF4,0xDF,
+	0x98,0xC9,0x8A,0x60,0xA7,0xE6,0xD6,0xA2,0xFB,0x6D,0x78,
+	0xBE,0xD2,0x19,0x7B,0xC5,0x35,0xA5,0xE6,0x71,0xE5,0xDE,
+	0x68,0xAB,0x7A,0xCE,0x62,0xC0,0x59,0xDC,0x96,0xE8,0xAA,
+	0xB9,0xC2,0xD9,0x42,0x53,0xED,0x05,0x22,0xAA,0x65,0x67,
+	0x86,0xFE,0x0B,0x5F,0x5B,0x54,0x8D,0xA9,0xE3,0xC7,0x00,
+	0x11,0x7F,0x01,0xA7,0xB9,0xD1,0xFF,0x20,0xFD,0xE0,0x1D,
+	0x8C,0x51,0xCC,0xF3,0x87,0xE2,0xF5,0xD2,0x59,0x80,0xE8,
+	0x70,0xD4,0xB0,0x06,0x59,0xD9,0xA5,0xF2,0x55,0x9F,0x90,
+	0x8A,0x2B,0x2C,0x7A,0xAE,0xD6,0xCD,0xD9,0x53,0x76,0xC4,
+	0x03,0x94,0xED,0x40,0xDD,0x7D,0xE8,0xD9,0x7A,0x80,0x5A,
+	0xCD,0xBB,0xA0,0x07,0x09,0xF5,0x9F,0x36,0x99,0x75,0xEF,
+	0x16,0x38,0x59,0x9A,0x2E,0x09,0x39,0xFD,0x7F,0xC1,0xA6,
+	0x6A,0x91,0x65,0xBE,0x4F,0xC6,0xCD,0xA2,0xBE,0x62,0x81,
+	0x29,0xB3,0xA3,0xE8,0x7B,0x68,0xB7,0xD5,0x93,0xA2,0x65,
+	0x84,0x5B,0x4C,0x2E,0xD1,0x33,0xD8,0x73,0x21,0xFD,0xC9,
+	0x60,0x6A,0xAE,0xF2,0xF2,0x7E,0x1B,0x6E,0x56,0x47,0xDA,
+	0xDD,0xD8,0x8D,0xB4,0x90,0xB7,0x44,0xA0,0x11,0x28,0x99,
+	0xEC,0x89,0xE7,0x83,0xD2,0x58,0x57,0x54,0xBB,0x7E,0x87,
+	0x06,0x6D,0x54,0x74,0xF8,0xE7,0x5D,0x6B,0x7D,0x19,0xD6,
+	0x62,0x55,0x9A,0x24,0x64,0x38,0x77,0x43,0x8F,0xB6,0xCD,
+	0xDC,0xE6,0xFC,0xCF,0xE6,0xA8,0x45,0xD0,0x5F,0xAF,0x62,
+	0xC5,0xA6,0x9B,0x9C,0xA9,0x2F,0x84,0x9C,0xAB,0x9E,0x38,
+	0xAF,0x64,0x44,0x1F,0xE1,0x4A,0x44,0x15,0x11,0x6D,0xD7,
+	0xED,0x38,0xA7,0xFD,0xC6,0x5F,0xAE,0x9C,0x4F,0x2C,0xE5,
+	0xC6,0xCC,0x4B,0x27,0x8A,0xD0,0xDC,0x3D,0x21,0xC7,0x15,
+	0x81,0x6B,0x57,0x83,0xBC,0x36,0x47,0x9F,0xB8,0xF5,0x94,
+	0x29,0xF9,0x1F,0x97,0x9F,0x17,0x6C,0xDC,0x16,0x6E,0xD0,
+	0x65,0x65,0x38,0x9B,0xF9,0xF9,0x8E,0x17,0x75,0x9C,0x25,
+	0x6E,0xFB,0x4B,0x56,0xFF,0x54,0xCE,0x9F,0x2C,0x6E,0x34,
+	0x6D,0x8C,0x7E,0xA7,0x2A,0x9B,0x71,0x18,0xB4,0xFF,0xBD,
+	0x30,0x0B,0x96,0x9F,0xE8,0x93,0x27,0xE7,0x34,0xFA,0x65,
+	0x9A,0x65,0xE6,0x65,0xEC,0x48,0x7D,0x05,0x67,0x29,0x04,
+	0x24,0x5A,0xBC,0xAA,0x4F,0xAD,0xE4,0x9E,0x31,0x86,0x84,
+	0xAE,0xBB,0x0A,0x99,0x52,0xC0,0x5F,0xF0,0xC4,0x99,0xE9,
+	0x93,0x1C,0xD4,0xDC,0x2B,0x3F,0x00,0xA0,0x21,0x34,0x2E,
+	0xC8,0xA3,0x6A,0x53,0xEC,0xD5,0x05,0x74,0x28,0xCA,0x3C,
+	0x39,0xE5,0x7A,0x20,0xA7,0xE1,0xE3,0xB5,0xED,0xF3,0x89,
+	0x8D,0x5C,0xEE,0xDA,0xEB,0x30,0xB4,0x39,0x0C,0x0C,0xBB,
+	0xFB,0xF2,0xCD,0xDF,0x2D,0xDB,0x6B,0x0B,0x16,0x92,0x1F,
+	0x54,0xB6,0x0A,0xA7,0x7F,0xF7,0x9D,0x19,0x4E,0x39,0xDD,
+	0xD2,0x9B,0x35,0xDA,0x05,0x70,0x31,0x66,0x4C,0xEA,0x86,
+	0x1F,0xD6,0x45,0xFF,0xBE,0x72,0x7A,0x5D,0x89,0x74,0x03,
+	0x3A,0x34,0x25,0x26,0x65,0x55,0x40,0x75,0xBA,0x34,0xC2,
+	0xC6,0x23,0x92,0x29,0x39,0x36,0xF2,0xFE,0x9B,0x0B,0x69,
+	0x89,0xCB,0x76,0x93,0x6D,0x1B,0xB1,0x58,0x27,0x60,0x4B,
+	0x17,0x5B,0xD9,0x47,0x53,0xB4,0x17,0xE9,0x9D,0x30,0x2E,
+	0xEA,0xC2,0x83,0xF3,0xFB,0xEE,0xDD,0x79,0x7A,0xF1,0xF4,
+	0x58,0x39,0x43,0x79,0xCB,0x02,0x6F,0x31,0x3F,0x7F,0x3E,
+	0xE9,0x57,0x35,0xA0,0xD3,0xE9,0xE2,0x1C,0x7C,0x1D,0x96,
+	0x13,0x80,0xB8,0xEF,0xD0,0x3B,0x9D,0x0E,0xA8,0x08,0x97,
+	0x6C,0x7F,0x05,0xE4,0x76,0xC4,0xAD,0xB6,0x54,0x24,0xF3,
+	0x66,0xA1,0x72,0x2B,0x5E,0x79,0x52,0x46,0x9E,0x89,0x92,
+	0x67,0xC8,0x88,0x32,0xB2,0x7F,0xED,0x68,0x7F,0x2A,0x05,
+	0xC1,0x7E,0x73,0x9B,0x55,0xAD,0xCF,0x15,0x7B,0x16,0xD7,
+	0x6F,0x8F,0xD6,0x59,0xBB,0xFD,0xCA,0xBD,0xB3,0x71,0xFE,
+	0x00,0xE3,0xCC,0x8C,0xB8,0xC0,0x31,0x34,0xD2,0x32,0x31,
+	0xAC,0x32,0x64,0xA2,0x8D,0x7D,0x5F,0x04,0x89,0x0E,0x76,
+	0xBA,0xF6,0x4E,0x8F,0x89,0x9E,0xBE,0x76,0xFD,0x34,0x8B,
+	0xB3,0x96,0x99,0x36,0x3B,0xAC,0xCB,0x0C,0x6B,0x4D,0x69,
+	0xDE,0x51,0x9D,0x79,0xAC,0x15,0xD7,0xDC,0x71,0x27,0xF3,
+	0xBD,0x1A,0x65,0x33,0xE1,0x12,0xE8,0x9A,0x3A,0xFD,0x83,
+	0xE8,0xC0,0x59,0xD7,0x6B,0xD3,0xD3,0xA2,0xA7,0x9F,0xDC,
+	0xF1,0x9C,0x98,0x55,0xAD,0xC1,0xCD,0x5B,0xF7,0x64,0xB6,
+	0xB5,0x0E,0x1D,0x79,0x47,0xB7,0xB5,0xF7,0x9C,0x8E,0x12,
+	0x65,0x97,0xE7,0x13,0x4F,0x96,0xF7,0xE5,0x43,0x77,0xA7,
+	0xDF,0xA5,0xD9,0xAE,0x6A,0x8E,0x4D,0xCD,0x54,0xB4,0x16,
+	0xA9,0x54,0x06,0x89,0x50,0xC7,0xA2,0x65,0x43,0x4E,0x95,
+	0xCC,0xAF,0xBD,0x21,0xD2,0x21,0xBC,0x0A,0x80,0x1B,0x55,
+	0xFC,0x51,0x67,0xF2,0xBC,0x56,0x05,0x21,0xD6,0x22,0x7D,
+	0x06,0xF9,0xBD,0xE8,0x0A,0xDA,0x43,0x23,0x60,0x6B,0xC7,
+	0xFA,0x73,0x16,0x47,0x51,0xE1,0x5D,0xB4,0xEB,0x11,0xAC,
+	0xBF,0xB9,0xA9,0x1B,0xAA,0xEB,0x6A,0xB6,0xB0,0x69,0x13,
+	0x75,0xA6,0x61,0x06,0x0A,0x15,0xE3,0xBC,0xF0,0x39,0xE5,
+	0xD4,0x14,0x6C,0xCE,0xA9,0x02,0x9C,0x0D,0xD8,0xA2,0x89,
+	0xA7,0x08,0x4B,0xF6,0xED,0xF1,0x5B,0x39,0x9F,0xF9,0x77,
+	0x4A,0xBA,0xD2,0x31,0x9C,0x42,0xF5,0x67,0xC9,0x38,0x34,
+	0xBD,0x9E,0xFC,0xBC,0x8F,0x25,0xEE,0xFB,0xF2,0x07,0xDC,
+	0x22,0x6B,0xD9,0xCA,0x59,0x8F,0x12,0xA1,0xEB,0x1D,0xE9,
+	0x22,0xFF,0x16,0xA0,0x74,0x78,0xFD,0x20,0x35,0x8F,0x79,
+	0x6A,0x5A,0x2E,0xF5,0x3A,0x92,0x5A,0x6F,0x40,0xE3,0xC6,
+	0x91,0xBA,0x90,0xC5,0x89,0x3D,0xF5,0xC2,0x3C,0x63,0xBD,
+	0x38,0x4D,0x46,0xC4,0x72,0x64,0xEA,0x1F,0x2D,0x03,0x8F,
+	0xAC,0x38,0x30,0x87,0xF7,0xB6,0x80,0x55,0xBC,0x2E,0xCE,
+	0x3F,0x70,0x43,0x64,0x60,0x78,0x4F,0x02,0x05,0x6D,0x8F,
+	0x68,0xBA,0x80,0x2E,0x64,0xA8,0xDB,0x6B,0x0A,0xD2,0x33,
+	0x92,0xAD,0xAB,0xAC,0xC9,0x79,0x55,0x04,0x42,0x6E,0xAB,
+	0xC4,0x3F,0xA5,0xA4,0x81,0x73,0xED,0xD5,0x20,0xED,0x95,
+	0x10,0xE3,0xD1,0xEA,0x7A,0xC8,0xA0,0xF3,0xF2,0x7F,0x96,
+	0x2E,0x37,0x1A,0x6C,0xAC,0x56,0xF5,0x0D,0x58,0xDC,0x3F,
+	0xB5,0xE8,0x25,0xA7,0x0F,0x48,0x4A,0x0B,0x1C,0x09,0xBC,
+	0xB7,0x14,0xCA,0x60,0x84,0x63,0x61,0xB1,0x3C,0x95,0xBD,
+	0x0A,0x9F,0x01,0x0D,0xD8,0x0D,0xCA,0x92,0x5F,0x7F,0xC9,
+	0x49,0xB6,0x62,0xDA,0x0F,0x72,0xBF,0x7C,0x4F,0x2E,0xCA,
+	0x62,0xA5,0x51,0x98,0x9D,0xB1,0x0A,0xB9,0xD3,0x7D,0xC8,
+	0x56,0xB8,0x16,0x44,0x27,0x12,0xDC,0x1D,0x68,0xAC,0x7E,
+	0x94,0x31,0x21,0xE2,0x31,0x0C,0xB0,0x24,0xE4,0x70,0x47,
+	0xDD,0x06,0x64,0x72,0xCE,0x4D,0x31,0x3D,0xF1,0x97,0x7B,
+	0x1F,0x4A,0xE5,0x26,0x8D,0x4B,0x4D,0x31,0x6D,0xB9,0x59,
+	0x4F,0x33,0x8F,0xBF,0xCA,0x37,0xEE,0xD1,0xAB,0x36,0x29,
+	0x2A,0xE4,0xC9,0x64,0x93,0x0F,0xA9,0x16,0x5E,0xF3,0x20,
+	0xF8,0x00,0xF0,0x03,0xFF,0x8D,0xC8,0xED,0x86,0x60,0x8F,
+	0xF1,0xB9,0x40,0x09,0xCC,0x07,0xF6,0x33,0x23,0x03,0xD4,
+	0xA2,0x31,0x0C,0xE2,0x24,0x6C,0x07,0x9E,0x61,0x3E,0x0F,
+	0x24,0x61,0x70,0xCB,0xC4,0x3C,0x3C,0xC3,0xEC,0x38,0x02,
+	0x0A,0xF9,0xEC,0x87,0xC3,0x00,0x94,0xC3,0xDB,0x2B,0xCA,
+	0x2B,0xD2,0xDE,0x0E,0x33,0xEB,0x6B,0x61,0x65,0x5B,0x1D,
+	0xCE,0xC3,0x59,0x88,0x24,0xE4,0x35,0x83,0x68,0x15,0x93,
+	0xE4,0xAF,0xA7,0x66,0x59,0xA5,0xCC,0x8D,0x31,0xBB,0x53,
+	0x50,0xC9,0x67,0x13,0x11,0xC3,0x9B,0x43,0x91,0xF2,0xE6,
+	0xF6,0xFC,0x40,0x95,0xFB,0x18,0x2D,0x4E,0xC4,0xEF,0x06,
+	0xA1,0x95,0x79,0x94,0xDE,0xB9,0xF6,0x87,0x84,0xED,0xD0,
+	0xBD,0x21,0xD4,0x44,0x4F,0x63,0x37,0x0C,0x3A,0x9C,0xF6,
+	0x06,0x3F,0x94,0x56,0xE8,0x70,0x65,0x3B,0xE8,0x56,0xBC,
+	0x9F,0x99,0xE1,0x67,0x79,0xDB,0x7B,0x30,0xD5,0xAD,0x56,
+	0x06,0x9D,0xEE,0xEF,0x40,0x2C,0xC5,0x58,0x30,0x24,0x4E,
+	0x42,0xB2,0xEC,0xFD,0x60,0xA2,0xD4,0x18,0x6D,0x67,0xE9,
+	0x1E,0x49,0x71,0x39,0x35,0x17,0x3B,0xB2,0x6E,0xCB,0xDA,
+	0xE5,0x19,0x80,0x2A,0x40,0x78,0xDA,0x0F,0xBE,0x36,0xAC,
+	0x1F,0x4E,0xAD,0x42,0xAF,0x2F,0x20,0x5B,0x53,0xB0,0x6F,
+	0x5B,0x36,0xED,0x16,0x9C,0xD5,0xA6,0x02,0x00,0x4B,0x4E,
+	0xF9,0xE2,0xBB,0x36,0x9E,0x86,0x89,0x68,0x79,0x28,0x48,
+	0x5F,0xF5,0xF7,0xFC,0x55,0x05,0x3F,0x74,0x7D,0x64,0x6C,
+	0xD6,0xAD,0x1B,0x5B,0xD8,0xD1,0x87,0x60,0x09,0x8E,0x67,
+	0x22,0x64,0x37,0xC7,0xD8,0x2F,0xC4,0xFE,0x0E,0x31,0xD1,
+	0x05,0x6B,0x4C,0x9B,0xF4,0xEB,0xC2,0x24,0x74,0x95,0x4F,
+	0x37,0x53,0x24,0xEA,0x34,0xBF,0xC0,0xE3,0x5A,0x49,0x0E,
+	0x2B,0xD6,0x38,0xD9,0xE5,0x5A,0xEF,0x08,0x94,0x04,0x6E,
+	0x61,0x7D,0x11,0xF1,0xC2,0x23,0x79,0xD0,0x26,0x5B,0xB5,
+	0x87,0x4D,0x44,0xCC,0x4F,0x11,0x9B,0xA8,0x2F,0x4A,0x8B,
+	0xAC,0xF3,0x54,0x42,0x3A,0x10,0xCD,0x64,0xFD,0xC1,0x62,
+	0xB2,0xD7,0x80,0x7E,0xB8,0xBD,0x30,0xA9,0xDF,0x33,0x7D,
+	0x29,0x1C,0x6C,0xF4,0x6B,0x34,0x6C,0x40,0x23,0xFD,0xE4,
+	0x4C,0xE0,0x40,0xD0,0x4D,0x0D,0x04,0xD5,0xD6,0x78,0x63,
+	0x60,0x95,0x4B,0x0B,0xCE,0xD4,0x67,0x58,0x18,0x68,0xFD,
+	0x35,0x69,0x1C,0xA4,0xDA,0x90,0x5C,0x9C,0xFC,0x61,0x10,
+	0x6B,0xB5,0x95,0x92,0x0F,0x83,0x53,0x3D,0xEB,0x5C,0x72,
+	0x24,0xD4,0xD0,0xD0,0x12,0x97,0x24,0x60,0x24,0x1F,0xAA,
+	0x66,0xE2,0x8F,0x96,0xB8,0xA8,0x80,0x91,0x6B,0xD0,0x0C,
+	0x13,0xFF,0xAA,0x64,0x0D,0xB0,0xDA,0xAE,0x41,0x1F,0xC9,
+	0xF1,0x63,0x78,0x03,0x52,0x31,0xF8,0x45,0xBA,0x1A,0x64,
+	0xC2,0xC0,0xCB,0xF0,0xE3,0xB0,0xE3,0x5E,0x27,0x20,0xEC,
+	0x7B,0xC0,0x6F,0x48,0xAF,0x9A,0x68,0x6E,0x62,0xDE,0x6B,
+	0x06,0xEE,0x81,0x47,0x8A,0xC4,0x4B,0x80,0xA3,0x15,0xA0,
+	0x8C,0x11,0xBE,0x1F,0xBA,0xFD,0xDD,0x3F,0x4C,0x24,0xE6,
+	0x6D,0x2C,0xA6,0x26,0x8E,0xC3,0x11,0x48,0xAF,0x7D,0xFA,
+	0xB4,0xEF,0x08,0xAA,0x8E,0x8E,0x20,0xC3,0x86,0x12,0x0A,
+	0x11,0x88,0x9C,0x20,0xA2,0x56,0x67,0x69,0x41,0xF4,0x72,
+	0x54,0xE8,0xBC,0x1F,0x23,0x88,0x5C,0x2A,0x6B,0xD6,0x12,
+	0x3E,0x47,0x55,0xA2,0xA1,0x20,0xBF,0x8D,0x9C,0xC4,0x9E,
+	0xAD,0x07,0x01,0xDD,0x45,0xE0,0x0E,0xF0,0x01,0x20,0x83,
+	0x3A,0x2E,0xB8,0x01,0x54,0x80,0x58,0xA5,0x7E,0x96,0x33,
+	0xD4,0x23,0x16,0xFC,0xD4,0x19,0x1D,0xD7,0x1D,0xD1,0x13,
+	0x09,0x05,0x44,0xEA,0x39,0x67,0x43,0x34,0x7F,0x5B,0x91,
+	0x42,0x1F,0xAC,0x0F,0x8B,0x87,0xE5,0x60,0x21,0xB8,0xFE,
+	0x0C,0x06,0x01,0x28,0xF5,0x37,0x13,0x0D,0x88,0x97,0xD0,
+	0x48,0x94,0xBE,0x9A,0x4E,0x91,0xEB,0x99,0x5E,0x25,0x61,
+	0x89,0x44,0xB9,0x39,0xF6,0x2A,0x52,0x9F,0x82,0x23,0x38,
+	0x91,0xF5,0xF1,0xEC,0x96,0x62,0xDB,0x16,0xDD,0xBE,0xDF,
+	0x9A,0x4A,0x48,0x7E,0x01,0x0D,0xD8,0x9F,0xAC,0x2A,0xF5,
+	0xE1,0x3B,0x35,0xBB,0xE8,0x13,0x4E,0x03,0x3E,0x80,0xB8,
+	0x3C,0xDA,0x59,0x37,0x30,0xD6,0x55,0x3D,0x41,0x53,0x82,
+	0x9A,0x31,0x0C,0x10,0x50,0xCE,0x86,0x9F,0x74,0x2E,0x2D,
+	0xA7,0x1B,0x7D,0x83,0x4D,0xD0,0xD9,0xE8,0xDB,0x28,0x70,
+	0x36,0x9F,0xEB,0xC5,0x7D,0xA6,0x97,0xE4,0x0D,0xD0,0x4C,
+	0x3A,0x50,0x86,0x6F,0x90,0xA4,0xA5,0xC5,0x8F,0x63,0x29,
+	0x3A,0xA4,0x66,0xB5,0xDB,0x04,0xCB,0x79,0xE0,0x43,0xDD,
+	0x50,0xE9,0x7F,0x8A,0xD0,0xA5,0x5F,0x10,0x3B,0x61,0x8B,
+	0x7A,0x13,0xAB,0x57,0x66,0xE6,0xFB,0x4E,0x58,0xAD,0x7A,
+	0xDC,0x73,0x12,0x0F,0xA0,0x5E,0x8F,0x99,0x69,0x70,0x00,
+	0x49,0xBE,0x11,0x77,0x19,0x73,0x03,0x79,0x1E,0x09,0xD2,
+	0x12,0x82,0x8F,0x67,0x19,0x09,0x13,0x0E,0x9B,0xF7,0x8C,
+	0xE9,0x3D,0xD4,0xA5,0x64,0xDF,0xF7,0xC0,0x85,0x4D,0xC2,
+	0x7C,0xA3,0x6A,0xFE,0xEA,0x36,0x23,0x0E,0xB4,0xED,0x3E,
+	0x33,0x7F,0x3D,0x11,0x09,0x93,0x55,0x22,0xA7,0xB0,0x81,
+	0xF5,0xAF,0x35,0xD0,0x92,0xF9,0xD4,0x8B,0xAF,0x20,0x6F,
+	0xEA,0xE5,0x37,0x7E,0xCD,0x8C,0xD6,0xAA,0x86,0x68,0x71,
+	0xB9,0xC6,0xC0,0x3C,0x61,0xC9,0x2B,0xF8,0x60,0x25,0x43,
+	0x53,0x06,0x47,0xFB,0x62,0x37,0xA1,0x1F,0x4F,0x3D,0x01,
+	0xD7,0xFF,0x31,0xF5,0x34,0x38,0x6B,0x9D,0xE5,0xE3,0xCD,
+	0x49,0x8E,0x46,0x9A,0x2F,0x71,0xE8,0x14,0x2F,0x7C,0xE6,
+	0x1A,0x92,0xB9,0x4D,0xB4,0x06,0x91,0xE5,0x2B,0x89,0x51,
+	0x18,0xA2,0xCB,0xD1,0x9D,0xA6,0xF0,0xBF,0xF0,0x35,0x7A,
+	0x5F,0x48,0x35,0xB4,0xCD,0xE6,0x22,0x02,0x45,0xD8,0x13,
+	0x6C,0x01,0x8D,0x48,0x44,0x88,0x9E,0xAB,0xD7,0xBF,0xBF,
+	0xCF,0x77,0xD1,0xA0,0x94,0xD8,0x20,0x4D,0x1F,0x7A,0x06,
+	0x1D,0x83,0xB7,0xC3,0x9A,0x1A,0xB4,0xF5,0x5A,0x3F,0x61,
+	0x4F,0x90,0x54,0x3B,0xD0,0x5C,0x1D,0x72,0x67,0xF5,0x9F,
+	0xE7,0xE1,0xB7,0xFF,0xD4,0xDD,0x7E,0x05,0xFC,0xD9,0x85,
+	0xE9,0x01,0xAA,0x7A,0x33,0x32,0x18,0xCC,0x13,0x3B,0xAF,
+	0x6E,0x86,0xAF,0x4C,0x97,0xFE,0x99,0x41,0x88,0xDB,0x40,
+	0x22,0x9F,0x40,0x8E,0xF8,0x05,0x9A,0xCA,0xCC,0xBE,0xA6,
+	0xC1,0x97,0x87,0x99,0x05,0xFF,0x22,0xA1,0x2E,0xFB,0x42,
+	0x97,0x00,0xAD,0x43,0xCD,0x88,0x93,0x69,0x18,0xFC,0x5C,
+	0x74,0x64,0x1F,0x31,0x7C,0x7E,0x2D,0x21,0xEA,0x71,0xBC,
+	0x86,0x4B,0xE6,0x76,0xDF,0x26,0x94,0xE8,0xEB,0xB2,0x05,
+	0xDF,0x87,0x3C,0x9C,0xD4,0x8C,0x4F,0xDC,0xE5,0x9A,0xC9,
+	0x84,0xCC,0x0F,0x97,0x48,0xFD,0x3E,0x50,0x41,0x04,0x02,
+	0x28,0x1F,0x21,0x3E,0x29,0xF9,0x02,0x7F,0x18,0x07,0x47,
+	0x30,0x76,0x6B,0x3D,0x31,0x48,0xEC,0xF1,0x39,0x38,0x2A,
+	0x5F,0x3F,0x0E,0x6D,0xFA,0x05,0x9B,0x8F,0xB5,0x48,0xC7,
+	0x05,0x6C,0xFA,0xA5,0x1E,0x3E,0xB0,0x48,0x13,0x9B,0xA6,
+	0xF6,0xE4,0x0F,0x95,0x00,0x68,0x3A,0x17,0x9A,0x49,0x38,
+	0x89,0x78,0xED,0x26,0xAE,0x9E,0x5C,0x34,0xE1,0x1A,0x6D,
+	0xAE,0xF7,0xCE,0xF1,0x87,0xA9,0x20,0xD3,0x43,0xA4,0x25,
+	0x09,0x57,0x0B,0xAF,0x18,0xAE,0x7B,0xB7,0x4D,0xF7,0xF2,
+	0xF3,0xF1,0x49,0x10,0xF4,0x17,0xEB,0x9D,0x3C,0xC8,0x58,
+	0x25,0xCE,0x72,0xF6,0x96,0x53,0xAC,0xA3,0x48,0x33,0xF3,
+	0x70,0x15,0x1A,0xD9,0xFF,0x4A,0xBF,0x8B,0x2C,0xD8,0xB3,
+	0xB8,0x5A,0xEE,0x64,0x77,0x15,0xAB,0x06,0x35,0x94,0x6F,
+	0xE4,0x85,0xBD,0xBA,0x45,0x4B,0x30,0xA1,0xC2,0x4C,0xAE,
+	0x6F,0xF2,0x15,0xA6,0x21,0xAB,0xFF,0xA5,0x25,0x10,0x5D,
+	0xEC,0xD1,0xB7,0xAC,0x86,0x15,0xBA,0x9E,0x75,0x81,0x5D,
+	0x0C,0x67,0x4E,0x70,0xBC,0xB1,0xF3,0x6D,0xAB,0xD2,0x5F,
+	0xBD,0x8A,0xD1,0x22,0x8F,0x5B,0xC7,0x1A,0x8C,0x71,0x68,
+	0x5D,0xF5,0x9C,0xB3,0xB6,0xF4,0x25,0x08,0x8A,0x8A,0x49,
+	0x70,0x9A,0xAB,0xE1,0xA5,0x5D,0x56,0x38,0x3D,0x6B,0x63,
+	0xCE,0xDB,0xE0,0x14,0x2D,0xDC,0xDC,0x10,0xF3,0x66,0x60,
+	0x1E,0xCE,0xD8,0x47,0xDC,0xF1,0xDC,0x84,0x1E,0x54,0xA9,
+	0xD9,0x42,0xFA,0x6D,0x63,0xC7,0x20,0xF5,0x59,0xAC,0x68,
+	0x35,0x3F,0x9B,0x88,0x16,0xFF,0x45,0x8D,0xBA,0x12,0x70,
+	0x57,0x27,0x91,0xD0,0xC6,0x3F,0x96,0xC2,0x3A,0xB0,0xD9,
+	0xDA,0xB0,0xE8,0x4F,0x66,0xEE,0xD7,0x77,0xC2,0x33,0xA2,
+	0x4A,0x24,0x36,0xF9,0x9C,0x6E,0xA9,0xDB,0xAC,0xCD,0xE8,
+	0xD5,0xA0,0xC5,0x37,0xE6,0x9B,0xC7,0xCA,0xAE,0x54,0x2F,
+	0x6E,0xD1,0xC4,0x48,0x52,0xCB,0x60,0x47,0x7C,0xAA,0x17,
+	0x72,0xFA,0xB8,0x4B,0xD5,0x95,0xEF,0xE7,0xC3,0x32,0x51,
+	0x21,0xD9,0x58,0x6F,0x42,0xF5,0x67,0xD3,0x20,0x19,0xA2,
+	0xA8,0xB0,0x07,0xBC,0x70,0x88,0x98,0x97,0xF1,0x93,0xB6,
+	0xB0,0x67,0x3F,0x98,0x65,0x52,0xE0,0xFE,0x05,0x2F,0xE8,
+	0xBE,0x91,0x38,0x07,0x63,0xCC,0x7F,0xA2,0x19,0x9C,0x54,
+	0x04,0xC3,0x6E,0xEA,0xCC,0x50,0x57,0x8E,0x93,0xAE,0x02,
+	0xA4,0xAF,0x5F,0x7B,0x27,0x51,0x1F,0x4E,0x7B,0xBC,0xE8,
+	0x15,0x03,0xDF,0x3E,0x9C,0xD9,0x9C,0x88,0x32,0x2F,0xE8,
+	0xF0,0xB8,0x5B,0x36,0x39,0x5E,0x00,0xC4,0xE4,0x0E,0x57,
+	0x63,0xC2,0x4F,0x32,0x3B,0x23,0x0E,0x20,0xF2,0xA8,0xC2,
+	0x24,0x02,0xCC,0xB7,0xC2,0x09,0x96,0xC5,0xBC,0xC1,0x43,
+	0x24,0xCA,0xDE,0x1A,0xD5,0xF2,0xF0,0x37,0xE6,0x1F,0x1C,
+	0xD7,0x1B,0x21,0xBF,0x42,0xE1,0x09,0x48,0xB9,0x0E,0x90,
+	0xF7,0xBF,0xA9,0xDD,0x18,0x3E,0x31,0x64,0x19,0x53,0x6A,
+	0x93,0x46,0xDB,0xAC,0xCD,0x7F,0x4D,0xD6,0xE0,0xB1,0xC6,
+	0xB5,0x30,0xAD,0x12,0x95,0x07,0x39,0x2E,0x22,0xFE,0x46,
+	0xDE,0xBB,0x79,0x1C,0xD1,0xF1,0xBB,0xA2,0x39,0x2E,0x7B,
+	0x6D,0x3E,0x75,0x9F,0xFD,0x43,0x0D,0xCE,0x7E,0x81,0x9E,
+	0x4F,0x8E,0xEF,0x53,0x30,0xC0,0xC5,0xDE,0x7E,0xD8,0x8F,
+	0x10,0x68,0xCC,0x62,0x3E,0x42,0xD6,0x02,0xFB,0x80,0xF1,
+	0x06,0x60,0x8F,0x33,0x60,0xE3,0xDB,0x00,0xD4,0x34,0x82,
+	0x21,0xAF,0x0C,0xD2,0x38,0xE6,0x24,0x91,0xC3,0x1B,0x81,
+	0x50,0x80,0xE1,0x25,0xE6,0x0D,0x01,0x76,0x23,0x6E,0xF8,
+	0x24,0x7C,0xD6,0x59,0x1F,0x81,0x6D,0x70,0x89,0xD4,0xBA,
+	0xA4,0xBC,0xC5,0x04,0x9B,0x06,0xA1,0x0F,0xF0,0x50,0x58,
+	0xA6,0x08,0x73,0x1B,0x63,0xE6,0xCE,0x40,0x70,0xF9,0x95,
+	0x4A,0x17,0x3C,0x39,0x37,0xB4,0xF2,0xD2,0x06,0x02,0x9A,
+	0x7F,0x0C,0xA4,0x97,0xD2,0xB3,0x9D,0x55,0xA4,0xF4,0x76,
+	0xC5,0x02,0x6E,0x1C,0x04,0x4E,0xA8,0x58,0x78,0x47,0x83,
+	0x91,0xAE,0x67,0x38,0x3B,0x29,0x69,0x34,0xC2,0x38,0xF0,
+	0x57,0x6E,0x3E,0x3C,0x28,0xF9,0x29,0x78,0xE5,0x9C,0xF9,
+	0xF8,0x22,0xEB,0xA3,0x29,0xA6,0x31,0xCE,0x0C,0x9C,0x6B,
+	0xD8,0xDF,0x76,0xA9,0xF8,0x8A,0xA3,0x2D,0xFF,0x88,0xD9,
+	0x9F,0x4C,0x69,0x64,0xE9,0x15,0x7D,0xB8,0x38,0x23,0x4C,
+	0x68,0x85,0x74,0x1C,0x24,0xEF,0x75,0xCD,0x72,0xD1,0x71,
+	0x6A,0x4F,0x33,0x42,0x54,0xF8,0x77,0xD8,0x63,0x97,0xE0,
+	0x75,0x00,0x58,0x1E,0xDA,0x08,0x7F,0x26,0x3C,0x04,0x47,
+	0xCF,0x7A,0xCC,0xC8,0x19,0xA8,0xF1,0x24,0xEC,0x98,0xA1,
+	0x4B,0x0E,0x6C,0x0B,0x1A,0x3D,0x83,0xC7,0x82,0x44,0x3A,
+	0xFC,0x59,0x9A,0x5E,0x3F,0xA3,0xE9,0x4D,0xE4,0x10,0x1C,
+	0x7B,0xA5,0x09,0xB9,0xEA,0x16,0x45,0xFF,0xF4,0x8A,0x16,
+	0x4D,0xA1,0x99,0x65,0x05,0x23,0xCF,0x5D,0xC1,0xE6,0x00,
+	0xD6,0xE8,0x94,0x82,0xD4,0x4D,0xA5,0x6D,0x21,0xBD,0xB0,
+	0x54,0x58,0xC5,0x0E,0x12,0xC8,0x24,0x78,0x49,0x0C,0xA5,
+	0x48,0x2F,0x77,0xC4,0x9B,0x7C,0x4C,0x1A,0x80,0xF2,0x5B,
+	0xC2,0x83,0xCB,0xC1,0xF7,0x18,0xA6,0xF1,0x5F,0x11,0x7A,
+	0x14,0x3D,0xA2,0xE6,0x14,0x0E,0xF8,0x2F,0xAC,0x74,0x2D,
+	0x80,0xAE,0x00,0x5A,0x28,0x00,0x94,0xCB,0xBC,0xBA,0x01,
+	0x50,0x97,0x87,0x28,0xB9,0x86,0xAE,0x1F,0x98,0x7A,0xB3,
+	0x10,0x05,0xFC,0x29,0xCB,0xFB,0xBC,0x7E,0x7D,0x3E,0x19,
+	0x1C,0xFD,0x1F,0x6B,0x26,0x7E,0x32,0x11,0x2C,0x4F,0x3B,
+	0x8F,0x2E,0xAC,0x01,0xC8,0xA3,0x05,0x68,0xDE,0x82,0x33,
+	0x90,0xF7,0x85,0xC7,0x2B,0xFD,0x36,0x05,0x94,0xCF,0x7E,
+	0xB7,0x5D,0x50,0x12,0xEA,0x67,0x76,0x83,0x9C,0xAF,0x4D,
+	0x1F,0x5A,0x9A,0xEA,0x1F,0x2C,0x9E,0x9E,0x9A,0xFF,0x1F,
+	0xC5,0xCE,0x03,0xF5,0x33,0x12,0x70,0x06,0xFC,0xB4,0xF8,
+	0xF4,0xFF,0xE7,0x90,0xFF,0xF4,0xFF,0x31,0x88,0x9F,0xBC,
+	0x05,0x24,0xDD,0x70,0x02,0xD2,0x7C,0xF7,0xC5,0x84,0x8F,
+	0x9D,0x71,0x8D,0x9D,0x7B,0x3B,0x0F,0x76,0x82,0xC3,0xF5,
+	0xC3,0xCE,0x03,0xE0,0x4D,0x6B,0xD0,0xA1,0x43,0x98,0x4F,
+	0xF3,0x2B,0xF8,0x18,0x14,0x64,0x5D,0xE2,0xD3,0x5C,0xF0,
+	0xD9,0x7A,0x4D,0x14,0x54,0xF4,0x41,0x05,0x2D,0x3E,0x2D,
+	0xBD,0xF9,0x1D,0x50,0x4E,0x3F,0x7D,0x8C,0xFA,0xA7,0x5A,
+	0xB5,0xDF,0xAA,0x7E,0xB2,0xBF,0x04,0x78,0xF9,0xDF,0x43,
+	0xFB,0xAD,0x4A,0xFE,0x51,0xB3,0xFF,0x03,0xBF,0x60,0x30,
+	0x09,
 };
 
 struct BuiltinFileBlob bfb_DEFRAG_EXE = {
 	/*recommended file name*/	"DEFRAG.EXE",
 	/*data*/			bin_defrag_exe,
-	/*length*/			sizeof(bin_defrag_exe)
+	/*length*/			53990,
+	/*compressed length*/	sizeof(bin_defrag_exe)
 };
 
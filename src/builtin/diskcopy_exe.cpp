@@ -2,3866 +2,2194 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_diskcopy_exe[] = {
-	0x4D,0x5A,0xB0,0x01,0x53,0x00,0x05,0x00,0x20,0x00,0xC8,
-	0x00,0xFF,0xFF,0xFB,0x0A,0x80,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x3E,0x00,0x00,0x00,0x01,0x00,0xFB,0x30,0x6A,
-	0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-	0xDE,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x4C,0x4D,0x00,
-	0x00,0x7D,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD3,0x08,0x2E,0x89,
-	0x16,0x35,0x02,0xB4,0x30,0xCD,0x21,0x8B,0x2E,0x02,0x00,
-	0x8B,0x1E,0x2C,0x00,0x8E,0xDA,0xA3,0x90,0x00,0x8C,0x06,
-	0x8E,0x00,0x89,0x1E,0x8A,0x00,0x89,0x2E,0xA6,0x00,0xE8,
-	0x3D,0x01,0xC4,0x3E,0x88,0x00,0x8B,0xC7,0x8B,0xD8,0xB9,
-	0xFF,0x7F,0xFC,0xF2,0xAE,0xE3,0x61,0x43,0x26,0x38,0x05,
-	0x75,0xF6,0x80,0xCD,0x80,0xF7,0xD9,0x89,0x0E,0x88,0x00,
-	0xB9,0x01,0x00,0xD3,0xE3,0x83,0xC3,0x08,0x83,0xE3,0xF8,
-	0x89,0x1E,0x8C,0x00,0x8C,0xDA,0x2B,0xEA,0x8B,0x3E,0x7C,
-	0x15,0x81,0xFF,0x00,0x02,0x73,0x07,0xBF,0x00,0x02,0x89,
-	0x3E,0x7C,0x15,0x81,0xC7,0x78,0x22,0x72,0x28,0x03,0x3E,
-	0x74,0x15,0x72,0x22,0xB1,0x04,0xD3,0xEF,0x47,0x3B,0xEF,
-	0x72,0x19,0x83,0x3E,0x7C,0x15,0x00,0x74,0x07,0x83,0x3E,
-	0x74,0x15,0x00,0x75,0x0E,0xBF,0x00,0x10,0x3B,0xEF,0x77,
-	0x07,0x8B,0xFD,0xEB,0x03,0xE9,0x84,0x01,0x8B,0xDF,0x03,
-	0xDA,0x89,0x1E,0x9E,0x00,0x89,0x1E,0xA2,0x00,0xA1,0x8E,
-	0x00,0x2B,0xD8,0x8E,0xC0,0xB4,0x4A,0x57,0xCD,0x21,0x5F,
-	0xD3,0xE7,0xFA,0x8E,0xD2,0x8B,0xE7,0xFB,0x33,0xC0,0x2E,
-	0x8E,0x06,0x35,0x02,0xBF,0x80,0x16,0xB9,0x78,0x22,0x2B,
-	0xCF,0xFC,0xF3,0xAA,0xB4,0x00,0xCD,0x1A,0x89,0x16,0x94,
-	0x00,0x89,0x0E,0x96,0x00,0x33,0xED,0xB8,0xD1,0x08,0x8E,
-	0xD8,0xBE,0x00,0x00,0xBF,0x18,0x00,0xE8,0xEA,0x00,0x2E,
-	0x8E,0x1E,0x35,0x02,0x2E,0xC6,0x06,0xE7,0x01,0x72,0x2E,
-	0xC6,0x06,0xD6,0x01,0x00,0xFF,0x36,0x86,0x00,0xFF,0x36,
-	0x84,0x00,0xFF,0x36,0x82,0x00,0xE8,0x2E,0x01,0x50,0xE8,
-	0xA6,0x59,0xB8,0xD2,0x08,0x8E,0xD8,0xBE,0x08,0x00,0xBF,
-	0x08,0x00,0xE8,0xB8,0x00,0x2E,0x8E,0x1E,0x35,0x02,0xFF,
-	0x16,0x00,0x14,0xFF,0x16,0x02,0x14,0xFF,0x16,0x04,0x14,
-	0x2E,0x8E,0x1E,0x35,0x02,0xE8,0x72,0x00,0x33,0xC0,0x8B,
-	0xF0,0xB9,0x2D,0x00,0x02,0x04,0x80,0xD4,0x00,0x46,0xE2,
-	0xF8,0x2D,0xA5,0x0C,0x74,0x09,0xB9,0x19,0x00,0xBA,0x2D,
-	0x00,0xE8,0xC5,0x00,0x8B,0xEC,0xB4,0x4C,0x8A,0x46,0x02,
-	0xCD,0x21,0xB9,0x0E,0x00,0xBA,0x46,0x00,0xE9,0xC1,0x00,
-	0x1E,0xB8,0x00,0x35,0xCD,0x21,0x89,0x1E,0x72,0x00,0x8C,
-	0x06,0x74,0x00,0xB8,0x04,0x35,0xCD,0x21,0x89,0x1E,0x76,
-	0x00,0x8C,0x06,0x78,0x00,0xB8,0x05,0x35,0xCD,0x21,0x89,
-	0x1E,0x7A,0x00,0x8C,0x06,0x7C,0x00,0xB8,0x06,0x35,0xCD,
-	0x21,0x89,0x1E,0x7E,0x00,0x8C,0x06,0x80,0x00,0xB8,0x00,
-	0x25,0x8C,0xCA,0x8E,0xDA,0xBA,0x5C,0x01,0xCD,0x21,0x1F,
-	0xC3,0x1E,0xB8,0x00,0x25,0xC5,0x16,0x72,0x00,0xCD,0x21,
-	0x1F,0x1E,0xB8,0x04,0x25,0xC5,0x16,0x76,0x00,0xCD,0x21,
-	0x1F,0x1E,0xB8,0x05,0x25,0xC5,0x16,0x7A,0x00,0xCD,0x21,
-	0x1F,0x1E,0xB8,0x06,0x25,0xC5,0x16,0x7E,0x00,0xCD,0x21,
-	0x1F,0xC3,0xB4,0xFF,0x8B,0xD7,0x8B,0xDE,0x3B,0xDF,0x74,
-	0x14,0x80,0x3F,0xFF,0x74,0x0A,0x38,0x67,0x01,0x77,0x05,
-	0x8A,0x67,0x01,0x8B,0xD3,0x83,0xC3,0x06,0xEB,0xE8,0x3B,
-	0xD7,0x74,0x20,0x8B,0xDA,0x1E,0x07,0x06,0x80,0x3F,0x00,
-	0xC6,0x07,0xFF,0x2E,0x8E,0x1E,0x35,0x02,0x74,0x07,0x26,
-	0xFF,0x5F,0x02,0x1F,0xEB,0xC5,0x26,0xFF,0x57,0x02,0x1F,
-	0xEB,0xBE,0xC3,0xB4,0x40,0xBB,0x02,0x00,0xCD,0x21,0xC3,
-	0xB9,0x1E,0x00,0xBA,0x54,0x00,0x2E,0x8E,0x1E,0x35,0x02,
-	0xE8,0xEA,0xFF,0xB8,0x03,0x00,0x50,0xE8,0xF9,0xFE,0x00,
-	0x00,0x01,0x00,0x55,0x8B,0xEC,0x81,0xEC,0x7E,0x80,0x56,
-	0x57,0x8B,0x76,0x06,0xC7,0x46,0xD6,0x00,0x00,0xC7,0x46,
-	0xD8,0x00,0x00,0xC7,0x46,0xA2,0x00,0x00,0xC7,0x46,0x9C,
-	0x01,0x00,0xC7,0x46,0xFE,0x00,0x00,0xC7,0x46,0xC8,0x00,
-	0x00,0xFF,0x34,0xE8,0xA1,0x3D,0x59,0xE8,0x2A,0x4B,0xE8,
-	0x6C,0x4C,0xB8,0x01,0x00,0x50,0xB8,0xAA,0x00,0x50,0xE8,
-	0xCD,0x51,0x59,0x59,0xA3,0x8A,0x16,0xB8,0xB3,0x00,0x50,
-	0x33,0xC0,0x50,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x6F,0x51,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0x8B,0x1E,0x80,0x16,0x8A,
-	0x07,0xA2,0xA8,0x00,0xB8,0xB5,0x00,0x50,0xB8,0x01,0x00,
-	0x50,0x33,0xC0,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x4E,0x51,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0x8B,0x1E,0x80,0x16,0x8A,
-	0x07,0xA2,0xA9,0x00,0xE8,0x94,0x31,0x88,0x46,0xAD,0x83,
-	0x7E,0x04,0x02,0x75,0x2E,0x8B,0x5C,0x02,0x80,0x3F,0x2F,
-	0x74,0x0A,0x8B,0x5C,0x02,0x8A,0x07,0x3A,0x46,0xAD,0x75,
-	0x1C,0x8B,0x5C,0x02,0x80,0x7F,0x01,0x3F,0x75,0x13,0x8B,
-	0x5C,0x02,0x80,0x7F,0x02,0x00,0x75,0x0A,0x8A,0x46,0xAD,
-	0x50,0xE8,0x32,0x17,0xE9,0xCA,0x16,0x83,0x7E,0x04,0x02,
-	0x7E,0x14,0xFF,0x74,0x02,0xE8,0x43,0x1C,0x59,0x89,0x46,
-	0xCC,0xFF,0x74,0x04,0xE8,0x39,0x1C,0x59,0x89,0x46,0xCA,
-	0x83,0x7E,0x04,0x03,0x7D,0x0E,0x8A,0x46,0xAD,0x50,0xE8,
-	0x08,0x17,0x59,0xB8,0x04,0x00,0xE9,0x9F,0x16,0xFF,0x74,
-	0x02,0xE8,0x0F,0x1C,0x59,0x0B,0xC0,0x75,0x06,0x83,0x7E,
-	0xCC,0x00,0x74,0x11,0xFF,0x74,0x04,0xE8,0xFE,0x1B,0x59,
-	0x0B,0xC0,0x75,0x0F,0x83,0x7E,0xCA,0x00,0x75,0x09,0xB8,
-	0xB7,0x00,0x50,0x33,0xC0,0xE9,0x66,0x08,0x33,0xC0,0x50,
-	0xE8,0x36,0x36,0x59,0x0B,0xC0,0x7D,0x0A,0xB8,0xEE,0x00,
-	0x50,0xB8,0x01,0x00,0xE9,0x51,0x08,0xE8,0x63,0x36,0x8B,
-	0xF8,0x8B,0x45,0x06,0x89,0x46,0xBE,0x8B,0x45,0x08,0x89,
-	0x46,0xBC,0x8B,0x45,0x04,0x89,0x46,0xB2,0x8B,0x45,0x0A,
-	0x89,0x46,0xB0,0x8B,0x45,0x0C,0x89,0x46,0xC4,0x8B,0x45,
-	0x0E,0x89,0x46,0xBA,0x8B,0x45,0x10,0x89,0x46,0xB8,0x8B,
-	0x45,0x12,0x89,0x46,0xB6,0x83,0x7D,0x16,0x16,0x75,0x05,
-	0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x89,0x46,0xAE,0x8B,
-	0x45,0x14,0x89,0x46,0xA6,0xC7,0x46,0xC2,0x03,0x00,0xE9,
-	0x8C,0x01,0x8B,0x5E,0xC2,0xD1,0xE3,0xFF,0x30,0xE8,0x32,
-	0x79,0x59,0x3D,0x03,0x00,0x76,0x2C,0xB8,0x10,0x01,0x50,
-	0xB8,0x02,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x21,0x50,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xEE,0x5F,0x59,
-	0x59,0x8B,0x5E,0xC2,0xE9,0xE7,0x06,0xC7,0x46,0xC0,0x01,
-	0x00,0x8B,0x5E,0xC2,0xD1,0xE3,0xFF,0x30,0xE8,0xF1,0x78,
-	0x59,0x3D,0x03,0x00,0x75,0x17,0x8B,0x5E,0xC2,0xD1,0xE3,
-	0x8B,0x18,0x80,0x7F,0x02,0x2D,0x75,0x07,0xC7,0x46,0xC0,
-	0x00,0x00,0xEB,0x03,0xE9,0x11,0x01,0x8B,0x5E,0xC2,0xD1,
-	0xE3,0x8B,0x18,0x8A,0x07,0x3A,0x46,0xAD,0x74,0x0F,0x8B,
-	0x5E,0xC2,0xD1,0xE3,0x8B,0x18,0x80,0x3F,0x2F,0x74,0x03,
-	0xE9,0xFA,0x00,0x8B,0x5E,0xC2,0xD1,0xE3,0x8B,0x18,0x8A,
-	0x47,0x01,0x98,0x89,0x46,0x9A,0xB9,0x15,0x00,0xBB,0xD3,
-	0x19,0x2E,0x8B,0x07,0x3B,0x46,0x9A,0x74,0x07,0x43,0x43,
-	0xE2,0xF4,0xE9,0xD1,0x00,0x2E,0xFF,0x67,0x2A,0x8B,0x46,
-	0xC0,0x89,0x46,0xBE,0xE9,0xD4,0x00,0x8B,0x46,0xC0,0x89,
-	0x46,0xBC,0xE9,0xCB,0x00,0x8B,0x46,0xC0,0xF7,0xD8,0x1B,
-	0xC0,0x40,0x89,0x46,0xB2,0xE9,0xBD,0x00,0x8B,0x46,0xC0,
-	0x89,0x46,0xB0,0xE9,0xB4,0x00,0x8B,0x46,0xC0,0x89,0x46,
-	0xC4,0xE9,0xAB,0x00,0x8B,0x46,0xC0,0x89,0x46,0xBA,0xE9,
-	0xA2,0x00,0x8B,0x46,0xC0,0xF7,0xD8,0x1B,0xC0,0x40,0x89,
-	0x46,0xB8,0xE9,0x94,0x00,0x8B,0x46,0xC0,0x89,0x46,0xAE,
-	0xE9,0x8B,0x00,0x8B,0x46,0xC0,0x89,0x46,0xA6,0xE9,0x82,
-	0x00,0x8B,0x46,0xC0,0xF7,0xD8,0x1B,0xC0,0x40,0x89,0x46,
-	0xB6,0xEB,0x75,0xB8,0x34,0x01,0x50,0x33,0xC0,0x50,0xB8,
-	0x02,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x1E,0x4F,0x83,
-	0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,
-	0x00,0x50,0xE8,0xEB,0x5E,0x59,0x59,0x8B,0x5E,0xC2,0xD1,
-	0xE3,0xFF,0x30,0xB8,0x44,0x01,0x50,0xE8,0xDB,0x5E,0x59,
-	0x59,0xB8,0x49,0x01,0x50,0xB8,0x01,0x00,0x50,0xB8,0x02,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xE8,0x4E,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0xB5,0x5E,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,
-	0x33,0x61,0x59,0xEB,0x10,0xB8,0x25,0x01,0xE9,0x94,0xFE,
-	0xB8,0x5E,0x01,0x50,0xB8,0x03,0x00,0xE9,0x8E,0xFE,0xFF,
-	0x46,0xC2,0x8B,0x46,0xC2,0x3B,0x46,0x04,0x7D,0x03,0xE9,
-	0x69,0xFE,0x83,0x7E,0xCC,0x00,0x75,0x03,0xE9,0x36,0x01,
-	0x83,0x7E,0xCA,0x00,0x75,0x03,0xE9,0x2D,0x01,0x33,0xC0,
-	0x50,0xFF,0x74,0x02,0xE8,0xAB,0x49,0x59,0x59,0xB8,0x01,
-	0x00,0x50,0xFF,0x74,0x04,0xE8,0x9F,0x49,0x59,0x59,0xB8,
-	0x01,0x00,0x50,0x8D,0x46,0x9C,0x50,0xE8,0x9B,0x4A,0x59,
-	0x59,0x33,0xC0,0x50,0xB8,0x01,0x00,0x50,0xE8,0x02,0x4A,
-	0x59,0x50,0xE8,0xB2,0x52,0x59,0x59,0x0B,0xC0,0x75,0x22,
-	0x83,0x7E,0xC4,0x00,0x74,0x1C,0xB8,0x01,0x00,0x50,0xE8,
-	0xEA,0x49,0x59,0x50,0xE8,0xC5,0x77,0x59,0x3D,0xFF,0xFF,
-	0x75,0x0A,0xB8,0x73,0x01,0x50,0xB8,0x04,0x00,0xE9,0xFA,
-	0x05,0xB8,0x01,0x00,0x50,0xE8,0xCE,0x49,0x59,0x50,0x33,
-	0xC0,0x50,0xE8,0xC6,0x49,0x59,0x50,0xE8,0x14,0x24,0x59,
-	0x59,0x0B,0xC0,0x74,0x52,0xFF,0x74,0x02,0xB8,0x45,0x01,
-	0x50,0xE8,0xFA,0x5D,0x59,0x59,0xB8,0x8C,0x01,0x50,0xB8,
-	0x05,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x07,0x4E,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xD4,0x5D,0x59,0x59,
-	0xFF,0x74,0x04,0xB8,0x96,0x01,0x50,0xE8,0xC8,0x5D,0x59,
-	0x59,0x83,0x7E,0xBE,0x00,0x74,0x08,0xB8,0x9A,0x01,0x50,
-	0xE8,0xB9,0x5D,0x59,0xE8,0x24,0x4A,0xE9,0x9A,0x13,0xB8,
-	0x9C,0x01,0x50,0x33,0xC0,0x50,0xB8,0x03,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xC2,0x4D,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x8F,
-	0x5D,0x59,0x59,0xFF,0x74,0x02,0xB8,0x44,0x01,0x50,0xE8,
-	0x83,0x5D,0x59,0x59,0xB8,0x93,0x01,0x50,0xB8,0x01,0x00,
-	0x50,0xB8,0x03,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x90,
-	0x4D,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0xEB,0x00,0x50,0xE8,0x5D,0x5D,0x59,0x59,0xFF,0x74,
-	0x04,0xB8,0xAC,0x01,0x50,0xE8,0x51,0x5D,0x59,0x59,0xE9,
-	0x3B,0x12,0x83,0x7E,0xCC,0x00,0x74,0x67,0x33,0xC0,0x50,
-	0xFF,0x74,0x02,0xE8,0x78,0x48,0x59,0x59,0xB8,0x04,0x00,
-	0x50,0x33,0xC0,0x50,0xE8,0xE8,0x48,0x59,0x50,0xE8,0x98,
-	0x51,0x59,0x59,0x0B,0xC0,0x74,0x2C,0xB8,0xB2,0x01,0x50,
-	0xB8,0x06,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x35,0x4D,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x02,0x5D,0x59,
-	0x59,0xFF,0x74,0x02,0xE9,0xFF,0x03,0xFF,0x74,0x04,0xFF,
-	0x74,0x02,0xE8,0x83,0x18,0x59,0x59,0x89,0x46,0xA2,0xC7,
-	0x46,0xC8,0x01,0x00,0xC7,0x46,0xC6,0x01,0x00,0xE9,0xA3,
-	0x00,0x83,0x7E,0xCA,0x00,0x75,0x03,0xE9,0x9A,0x00,0xFF,
-	0x74,0x02,0xFF,0x74,0x04,0xE8,0x5F,0x18,0x59,0x59,0x89,
-	0x46,0xA2,0xB8,0x01,0x00,0x50,0xFF,0x74,0x04,0xE8,0xF9,
-	0x47,0x59,0x59,0xB8,0x01,0x00,0x50,0x8D,0x46,0x9C,0x50,
-	0xE8,0xF5,0x48,0x59,0x59,0x83,0x7E,0xA2,0x00,0x75,0x58,
-	0x33,0xC0,0x50,0xB8,0x01,0x00,0x50,0xE8,0x56,0x48,0x59,
-	0x50,0xE8,0x06,0x51,0x59,0x59,0x0B,0xC0,0x75,0x43,0x83,
-	0x7E,0xC4,0x00,0x74,0x34,0xB8,0x01,0x00,0x50,0xE8,0x3E,
-	0x48,0x59,0x50,0xE8,0x19,0x76,0x59,0x0B,0xC0,0x74,0x2C,
-	0xB8,0x73,0x01,0x50,0xB8,0x04,0x00,0x50,0xB8,0x01,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x8C,0x4C,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0xE9,
-	0x62,0x03,0xB8,0xC2,0x01,0x50,0xB8,0x07,0x00,0xEB,0xDB,
-	0x83,0x7E,0xA2,0x00,0x74,0x05,0xC7,0x46,0xAE,0x01,0x00,
-	0xC7,0x46,0xC8,0x01,0x00,0xC7,0x46,0xC6,0x02,0x00,0x8B,
-	0x5C,0x02,0x8A,0x07,0x98,0x50,0xE8,0x7B,0x65,0x59,0x04,
-	0xBF,0x88,0x46,0xB5,0x8B,0x5C,0x04,0x8A,0x07,0x98,0x50,
-	0xE8,0x6B,0x65,0x59,0x04,0xBF,0x88,0x46,0xB4,0xA0,0xA8,
-	0x00,0x88,0x46,0xFB,0xA0,0xA8,0x00,0x88,0x46,0xFA,0xB8,
-	0xDD,0x1E,0x50,0xE8,0xC8,0x52,0x59,0xE8,0x97,0x5A,0xA3,
-	0x8C,0x16,0xB8,0x01,0x00,0x50,0xE8,0x97,0x5A,0x59,0xB8,
-	0xBF,0x1E,0x50,0xE8,0xB2,0x50,0x59,0x8A,0x46,0xB5,0x3A,
-	0x46,0xB4,0x74,0x6F,0x83,0x7E,0xC8,0x00,0x75,0x69,0xE8,
-	0xB4,0x2B,0x0B,0xC0,0x74,0x62,0x8A,0x46,0xB5,0x98,0x89,
-	0x86,0x82,0x7F,0x8A,0x46,0xB4,0x98,0x89,0x86,0x84,0x7F,
-	0x8D,0x86,0x9A,0xBF,0x89,0x86,0x86,0x7F,0x8D,0x86,0x9A,
-	0x7F,0x89,0x86,0x88,0x7F,0xC7,0x86,0x8A,0x7F,0x00,0x40,
-	0x8B,0x46,0xBE,0x89,0x86,0x8C,0x7F,0x8B,0x46,0xBA,0x89,
-	0x86,0x8E,0x7F,0x8B,0x46,0xB8,0x89,0x86,0x90,0x7F,0x8B,
-	0x46,0xAE,0x89,0x86,0x92,0x7F,0x8B,0x46,0xBC,0x89,0x86,
-	0x94,0x7F,0x8B,0x46,0xA6,0x89,0x86,0x96,0x7F,0x8B,0x45,
-	0x18,0x89,0x86,0x98,0x7F,0x8D,0x86,0x82,0x7F,0x50,0xE8,
-	0x36,0x24,0xE9,0x62,0x11,0xC7,0x46,0xCE,0x00,0x00,0xC7,
-	0x46,0xD0,0x00,0x00,0xE9,0x36,0x11,0x83,0x7E,0xC8,0x00,
-	0x74,0x06,0x83,0x7E,0xC6,0x02,0x75,0x78,0x83,0x7E,0xB8,
-	0x00,0x74,0x6D,0xB8,0xB2,0x00,0x50,0xE8,0xDC,0x5D,0x59,
-	0xB8,0xD7,0x01,0x50,0xB8,0x08,0x00,0x50,0xB8,0x01,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x63,0x4B,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,
-	0xE8,0x30,0x5B,0x59,0x59,0xFF,0x74,0x02,0xB8,0xF9,0x01,
-	0x50,0xE8,0x24,0x5B,0x59,0x59,0xB8,0xFF,0x01,0x50,0xB8,
-	0x09,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x31,0x4B,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xFE,0x5A,0x59,0x59,
-	0xE8,0x90,0x23,0xB8,0xB2,0x00,0x50,0xE8,0x79,0x5D,0x59,
-	0xEB,0x05,0xC7,0x46,0xB8,0x01,0x00,0x8B,0x46,0xCE,0x0B,
-	0x46,0xD0,0x74,0x03,0xE9,0x41,0x01,0x83,0x7E,0xC8,0x00,
-	0x74,0x06,0x83,0x7E,0xC6,0x02,0x75,0x2C,0x8D,0x46,0xF2,
-	0x50,0x8A,0x46,0xB5,0x98,0x50,0xE8,0x7C,0x3E,0x59,0x59,
-	0x0B,0xC0,0x74,0x08,0xE8,0x47,0x40,0x3D,0x0C,0x00,0x74,
-	0x69,0xB8,0xB2,0x00,0x50,0xE8,0x39,0x5D,0x59,0xB8,0x1F,
-	0x02,0x50,0xB8,0x0A,0x00,0xE9,0x6F,0x0F,0xB8,0x01,0x80,
-	0x50,0x33,0xC0,0x50,0xE8,0x54,0x46,0x59,0x50,0xE8,0x2D,
-	0x70,0x59,0x59,0x89,0x46,0xFC,0x83,0x7E,0xFC,0x00,0x7D,
-	0x02,0xEB,0x29,0xFF,0x76,0xFC,0xE8,0xF2,0x69,0x59,0x89,
-	0x46,0xD6,0x89,0x56,0xD8,0xFF,0x76,0xFC,0xE8,0xA0,0x4F,
-	0x59,0x8D,0x46,0xF2,0x50,0x33,0xC0,0x50,0xE8,0x24,0x46,
-	0x59,0x50,0xE8,0x32,0x3E,0x59,0x59,0x0B,0xC0,0x75,0x12,
-	0xB8,0xB2,0x00,0x50,0xE8,0xE2,0x5C,0x59,0xB8,0x2F,0x02,
-	0x50,0xB8,0x0B,0x00,0xE9,0x2C,0x02,0x8B,0x46,0xF4,0xF7,
-	0x6E,0xF8,0x89,0x46,0xEE,0xC7,0x46,0xF0,0x00,0x00,0x8B,
-	0x46,0xF6,0x89,0x46,0xA4,0x99,0x50,0x52,0x8B,0x56,0xF0,
-	0x8B,0x46,0xEE,0x59,0x5B,0xE8,0x9A,0x81,0x89,0x46,0xEA,
-	0x89,0x56,0xEC,0x8B,0x46,0xEA,0x0B,0x46,0xEC,0x75,0x0B,
-	0xB8,0xB2,0x00,0x50,0xE8,0xA0,0x5C,0x59,0xE9,0x82,0xF9,
-	0x83,0x7E,0xAE,0x00,0x75,0x1C,0x83,0x7E,0xC8,0x00,0x74,
-	0x63,0x83,0x7E,0xC6,0x01,0x75,0x5D,0x8B,0x46,0xEC,0x8B,
-	0x56,0xEA,0x3B,0x46,0xD8,0x75,0x05,0x3B,0x56,0xD6,0x74,
-	0x4D,0x8B,0x46,0xEC,0x8B,0x56,0xEA,0x3B,0x46,0xD8,0x75,
-	0x05,0x3B,0x56,0xD6,0x74,0x3D,0xB8,0x16,0x00,0x50,0xE8,
-	0xEB,0x3E,0x59,0x83,0x7E,0xC8,0x00,0x74,0x06,0x83,0x7E,
-	0xC6,0x02,0x75,0x0F,0x8A,0x46,0xB5,0x98,0x50,0xE8,0xC5,
-	0x3E,0x59,0x0B,0xC0,0x75,0x24,0xEB,0x1A,0x33,0xC0,0x50,
-	0xE8,0x71,0x45,0x59,0x50,0xE8,0x80,0x3E,0x59,0x0B,0xC0,
-	0x75,0x12,0xB8,0x4A,0x02,0x50,0xB8,0x20,0x00,0xE9,0x82,
-	0x01,0xB8,0x0B,0x00,0x50,0xE8,0xAE,0x3E,0x59,0xB8,0xB2,
-	0x00,0x50,0xE8,0x1E,0x5C,0x59,0xB8,0x00,0x40,0x50,0xE8,
-	0x9F,0x3B,0x59,0x89,0x46,0xDE,0x89,0x56,0xE0,0x33,0xC0,
-	0x50,0xFF,0x76,0xF8,0x50,0xFF,0x76,0xF6,0xFF,0x76,0xE0,
-	0xFF,0x76,0xDE,0xE8,0xD7,0x7C,0x52,0x50,0xE8,0xD2,0x7C,
-	0x89,0x46,0xDA,0x89,0x56,0xDC,0x83,0x7E,0xC8,0x00,0x74,
-	0x75,0x83,0x7E,0xA2,0x00,0x75,0x6F,0xFF,0x76,0xE0,0xFF,
-	0x76,0xDE,0xFF,0x76,0xC6,0x8B,0x46,0xC6,0x48,0x50,0xE8,
-	0x04,0x45,0x59,0x50,0xE8,0x72,0x1D,0x83,0xC4,0x08,0x3D,
-	0xFE,0xFF,0x74,0x15,0x0B,0xC0,0x74,0x02,0xEB,0x12,0x8B,
-	0x46,0xEC,0x8B,0x56,0xEA,0x89,0x56,0xE6,0x89,0x46,0xE8,
-	0xE9,0x90,0x00,0xE9,0xF5,0x00,0xB8,0x89,0x02,0x50,0xB8,
-	0x0D,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x37,0x49,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x04,0x59,0x59,0x59,
-	0x8B,0x5E,0xC6,0xD1,0xE3,0xFF,0x30,0xB8,0x20,0x01,0x50,
-	0xE8,0xF4,0x58,0x59,0x59,0xE9,0x34,0xF8,0x83,0x7E,0xA2,
-	0x00,0x74,0x1D,0x8B,0x46,0xC6,0x3D,0x01,0x00,0x74,0x07,
-	0x3D,0x02,0x00,0x74,0x0C,0xEB,0x30,0x8B,0x5C,0x04,0x8A,
-	0x07,0x50,0xB0,0x00,0xEB,0x0F,0xB0,0x00,0xEB,0x05,0x8B,
-	0x5C,0x04,0x8A,0x07,0x50,0x8B,0x5C,0x02,0x8A,0x07,0x50,
-	0x8D,0x46,0xE6,0x50,0xFF,0x76,0xB2,0xFF,0x76,0xE0,0xFF,
-	0x76,0xDE,0xE8,0x11,0x18,0x83,0xC4,0x0C,0x89,0x46,0xFE,
-	0x83,0x7E,0xFE,0x00,0x75,0x09,0xB8,0xA5,0x02,0x50,0xB8,
-	0x0E,0x00,0xEB,0x77,0x83,0x7E,0xA2,0x00,0x75,0x03,0xE9,
-	0x97,0x00,0x8B,0x46,0xE8,0x8B,0x56,0xE6,0x3B,0x46,0xE0,
-	0x75,0x05,0x3B,0x56,0xDE,0x74,0x02,0xEB,0xDC,0x83,0x7E,
-	0xC6,0x01,0x75,0x28,0xE8,0x14,0x1C,0xB8,0x00,0x40,0x50,
-	0x8D,0x86,0x9A,0xBF,0x50,0x33,0xC0,0x50,0xE8,0x1F,0x44,
-	0x59,0x50,0xE8,0xC8,0x3E,0x83,0xC4,0x06,0x0B,0xC0,0x75,
-	0x61,0xB8,0xC9,0x02,0x50,0xB8,0x21,0x00,0xE9,0x1A,0x0D,
-	0x83,0x7E,0xB6,0x00,0x75,0x51,0xFF,0x76,0xE0,0xFF,0x76,
-	0xDE,0xB8,0x01,0x00,0x50,0xE8,0xF6,0x43,0x59,0x50,0xE8,
-	0xFC,0x1B,0x83,0xC4,0x06,0x0B,0xC0,0x75,0x38,0xB8,0xB2,
-	0x00,0x50,0xE8,0xB3,0x5A,0x59,0xB8,0x62,0x02,0x50,0xB8,
-	0x0C,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x3A,0x48,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x07,0x58,0x59,0x59,
-	0xB8,0xB2,0x00,0x50,0xE8,0x85,0x5A,0xE9,0x3F,0xF7,0x83,
-	0x7E,0xC8,0x00,0x74,0x06,0x83,0x7E,0xC6,0x02,0x75,0x4B,
-	0x8B,0x46,0xD0,0x8B,0x56,0xCE,0x89,0x56,0xE2,0x89,0x46,
-	0xE4,0x8B,0x56,0xE8,0x8B,0x46,0xE6,0xB1,0x09,0xE8,0x02,
-	0x7C,0x01,0x46,0xCE,0x11,0x56,0xD0,0x8B,0x46,0xD0,0x8B,
-	0x56,0xCE,0x3B,0x46,0xF0,0x77,0x17,0x75,0x05,0x3B,0x56,
-	0xEE,0x77,0x10,0x8B,0x46,0xE8,0x8B,0x56,0xE6,0x3B,0x46,
-	0xE0,0x75,0x11,0x3B,0x56,0xDE,0x75,0x0C,0x8B,0x46,0xF0,
-	0x8B,0x56,0xEE,0x89,0x56,0xCE,0x89,0x46,0xD0,0x83,0x7E,
-	0xC8,0x00,0x74,0x09,0x83,0x7E,0xC6,0x02,0x74,0x03,0xE9,
-	0x24,0x01,0xB8,0xE5,0x02,0x50,0x33,0xC0,0x50,0xB8,0x04,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xA5,0x47,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0x72,0x57,0x59,0x59,0xFF,0x76,0xDA,0xB8,0xED,
-	0x02,0x50,0xE8,0x66,0x57,0x59,0x59,0xB8,0xF2,0x02,0x50,
-	0xB8,0x01,0x00,0x50,0xB8,0x04,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x73,0x47,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x40,0x57,0x59,
-	0x59,0xFF,0x76,0xF8,0xB8,0xFB,0x02,0x50,0xE8,0x34,0x57,
-	0x59,0x59,0xB8,0x01,0x03,0x50,0xB8,0x02,0x00,0x50,0xB8,
-	0x04,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x41,0x47,0x83,
-	0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,
-	0x00,0x50,0xE8,0x0E,0x57,0x59,0x59,0xFF,0x76,0xF6,0xB8,
-	0xFB,0x02,0x50,0xE8,0x02,0x57,0x59,0x59,0xB8,0x15,0x03,
-	0x50,0xB8,0x03,0x00,0x50,0xB8,0x04,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x0F,0x47,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xDC,0x56,
-	0x59,0x59,0xB8,0xE9,0x00,0x50,0xE8,0x5A,0x59,0x59,0xB8,
-	0x26,0x03,0x50,0xB8,0x04,0x00,0x50,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xE4,0x46,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xB1,0x56,0x59,
-	0x59,0xFF,0x76,0xE0,0xFF,0x76,0xDE,0xB8,0x3D,0x03,0x50,
-	0xE8,0xA2,0x56,0x83,0xC4,0x06,0xB8,0x43,0x03,0x50,0xB8,
-	0x05,0x00,0x50,0xB8,0x04,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0xAE,0x46,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x7B,0x56,0x59,0x59,
-	0xB8,0xE9,0x00,0x50,0xE8,0x72,0x56,0x59,0x83,0x7E,0xB0,
-	0x00,0x75,0x03,0xE9,0xD3,0x00,0x83,0x7E,0xC8,0x00,0x74,
-	0x03,0xE9,0xCA,0x00,0xB8,0x47,0x01,0x50,0xE8,0x58,0x56,
-	0x59,0xB8,0x49,0x03,0x50,0xB8,0x0F,0x00,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x66,0x46,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0x33,0x56,0x59,0x59,0xB8,0x47,0x01,0x50,0xE8,
-	0x2A,0x56,0x59,0x8B,0x5E,0xFE,0x4B,0x83,0xFB,0x03,0x76,
-	0x03,0xE9,0x9C,0x00,0xD1,0xE3,0x2E,0xFF,0xA7,0xCB,0x19,
-	0xB8,0x4F,0x03,0xE9,0x8A,0x00,0xB8,0x55,0x03,0xE9,0x84,
-	0x00,0xB8,0x5B,0x03,0x50,0xB8,0x10,0x00,0x50,0xB8,0x01,
-	0x00,0xEB,0x40,0xB8,0x6A,0x03,0x50,0x33,0xC0,0x50,0xB8,
-	0x05,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x0D,0x46,0x83,
-	0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,
-	0x00,0x50,0xE8,0xDA,0x55,0x59,0x59,0xFF,0x76,0xE8,0xFF,
-	0x76,0xE6,0xB8,0x74,0x03,0x50,0xE8,0xCB,0x55,0x83,0xC4,
-	0x06,0xB8,0x7A,0x03,0x50,0xB8,0x01,0x00,0x50,0xB8,0x05,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xD7,0x45,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0xA4,0x55,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,
-	0x22,0x58,0x59,0xB8,0xB2,0x00,0xEB,0x0F,0x83,0x7E,0xC8,
-	0x00,0x74,0x06,0x83,0x7E,0xC6,0x02,0x75,0x08,0xB8,0x23,
-	0x01,0x50,0xE8,0x09,0x58,0x59,0x83,0x7E,0xC8,0x00,0x74,
-	0x09,0x83,0x7E,0xC6,0x02,0x74,0x03,0xE9,0x81,0x02,0xC7,
-	0x46,0xA0,0x00,0x00,0xE9,0x3E,0x02,0x83,0x7E,0xA0,0x00,
-	0x75,0x3A,0x83,0x7E,0xC8,0x00,0x75,0x09,0xB8,0x81,0x03,
-	0x50,0xB8,0x11,0x00,0xEB,0x07,0xB8,0x9F,0x03,0x50,0xB8,
-	0x22,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x64,0x45,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x31,0x55,0x59,0x59,
-	0xE8,0xC9,0x18,0xEB,0x31,0xB8,0xB2,0x00,0x50,0xE8,0xAA,
-	0x57,0x59,0xB8,0xBA,0x03,0x50,0xB8,0x26,0x00,0x50,0xB8,
-	0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x31,0x45,0x83,
-	0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,
-	0x00,0x50,0xE8,0xFE,0x54,0x59,0x59,0xE8,0x8D,0x18,0x8B,
-	0x46,0xE4,0x8B,0x56,0xE2,0xE9,0xA3,0x01,0x8B,0x46,0xD0,
-	0x8B,0x56,0xCE,0x83,0xEA,0x20,0x1D,0x00,0x00,0x3B,0x46,
-	0xD4,0x72,0x0E,0x77,0x05,0x3B,0x56,0xD2,0x76,0x07,0xC7,
-	0x46,0xAA,0x20,0x00,0xEB,0x09,0x8B,0x46,0xCE,0x2B,0x46,
-	0xD2,0x89,0x46,0xAA,0x8B,0x46,0xAA,0xB1,0x09,0xD3,0xE0,
-	0x89,0x46,0xA8,0xFF,0x76,0xD0,0xFF,0x76,0xCE,0xFF,0x76,
-	0xD4,0xFF,0x76,0xD2,0xE8,0xBB,0x0F,0x83,0xC4,0x08,0xFF,
-	0x76,0xAA,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xE8,0xC4,0x39,
-	0x83,0xC4,0x06,0x0B,0xC0,0x75,0x03,0xE9,0x3D,0x01,0x83,
-	0x7E,0xA6,0x00,0x74,0x1B,0xFF,0x76,0xA4,0x8D,0x86,0x9A,
-	0xBF,0x50,0xFF,0x76,0xD2,0xFF,0x76,0xAA,0x8A,0x46,0xB5,
-	0x98,0x50,0xE8,0xA3,0x2F,0x83,0xC4,0x0A,0xEB,0x5B,0x8D,
-	0x86,0x9A,0xBF,0x50,0x8B,0x46,0xD2,0x99,0x52,0x50,0xFF,
-	0x76,0xAA,0x8A,0x46,0xB5,0x98,0x50,0xE8,0x82,0x5F,0x83,
-	0xC4,0x0A,0x0B,0xC0,0x74,0x3E,0xB8,0xB2,0x00,0x50,0xE8,
-	0xD8,0x56,0x59,0xB8,0xCA,0x03,0x50,0xB8,0x12,0x00,0x50,
-	0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x5F,0x44,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0x2C,0x54,0x59,0x59,0xFF,0x76,0xD4,
-	0xFF,0x76,0xD2,0xB8,0xEA,0x03,0x50,0xE8,0x1D,0x54,0x83,
-	0xC4,0x06,0x83,0x7E,0xA0,0x00,0x75,0x0D,0xFF,0x76,0xA8,
-	0x8D,0x86,0x9A,0xBF,0x50,0xE8,0x75,0x17,0xEB,0x0B,0xFF,
-	0x76,0xA8,0x8D,0x86,0x9A,0x7F,0x50,0xE8,0x40,0x17,0x59,
-	0x59,0x89,0x46,0x9E,0x83,0x7E,0x9E,0x00,0x75,0x3C,0xB8,
-	0xB2,0x00,0x50,0xE8,0x71,0x56,0x59,0xB8,0xF1,0x03,0x50,
-	0xB8,0x14,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xF8,0x43,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xC5,0x53,0x59,
-	0x59,0xB8,0xB2,0x00,0x50,0xE8,0x43,0x56,0x59,0xE8,0x5C,
-	0x18,0xE9,0xA4,0x08,0x83,0x7E,0xA0,0x01,0x75,0x56,0xB8,
-	0x05,0x00,0x50,0x8D,0x86,0x9A,0x7F,0x50,0x8D,0x86,0x9A,
-	0xBF,0x50,0xE8,0xFA,0x67,0x83,0xC4,0x06,0x0B,0xC0,0x74,
-	0x3E,0xB8,0xB2,0x00,0x50,0xE8,0x17,0x56,0x59,0xB8,0x0B,
-	0x04,0x50,0xB8,0x25,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0x9E,0x43,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x6B,
-	0x53,0x59,0x59,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xB8,0xEA,
-	0x03,0x50,0xE8,0x5C,0x53,0x83,0xC4,0x06,0x8B,0x46,0xD4,
-	0x8B,0x56,0xD2,0x83,0xC2,0x20,0x15,0x00,0x00,0x89,0x56,
-	0xD2,0x89,0x46,0xD4,0x8B,0x46,0xD4,0x8B,0x56,0xD2,0x3B,
-	0x46,0xD0,0x73,0x03,0xE9,0x49,0xFE,0x75,0x08,0x3B,0x56,
-	0xCE,0x73,0x03,0xE9,0x3F,0xFE,0xFF,0x46,0xA0,0x83,0x7E,
-	0xBC,0x00,0x74,0x0F,0x83,0x7E,0xA0,0x01,0x7F,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0xEB,0x0D,0x83,0x7E,0xA0,
-	0x01,0x7D,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x0B,
-	0xC0,0x74,0x03,0xE9,0x99,0xFD,0xFF,0x76,0xD0,0xFF,0x76,
-	0xCE,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xE8,0x00,0x0E,0x83,
-	0xC4,0x08,0x83,0x7E,0xBE,0x00,0x74,0x0E,0x83,0x7E,0xC8,
-	0x00,0x75,0x08,0xB8,0x9A,0x01,0x50,0xE8,0xDE,0x52,0x59,
-	0x83,0x7E,0xC8,0x00,0x75,0x03,0xE9,0x41,0x07,0x83,0x7E,
-	0xC6,0x01,0x74,0x03,0xE9,0x58,0x07,0xE9,0x35,0x07,0x83,
-	0x7E,0xB8,0x00,0x74,0x69,0x83,0x7E,0xC8,0x00,0x75,0x08,
-	0xB8,0x23,0x01,0x50,0xE8,0x3C,0x55,0x59,0xB8,0x23,0x04,
-	0x50,0xB8,0x15,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0xC3,0x42,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x90,0x52,
-	0x59,0x59,0xFF,0x74,0x04,0xB8,0xF9,0x01,0x50,0xE8,0x84,
-	0x52,0x59,0x59,0xB8,0xFF,0x01,0x50,0xB8,0x09,0x00,0x50,
-	0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x91,0x42,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0x5E,0x52,0x59,0x59,0xE9,0x3D,0x01,
-	0xC7,0x46,0xB8,0x01,0x00,0x8D,0x46,0xF2,0x50,0x8A,0x46,
-	0xB4,0x98,0x50,0xE8,0xFD,0x35,0x59,0x59,0x0B,0xC0,0x75,
-	0x3D,0xB8,0xB2,0x00,0x50,0xE8,0xC2,0x54,0x59,0xB8,0x1F,
-	0x02,0x50,0xB8,0x0A,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0x49,0x42,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x16,
-	0x52,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0x94,0x54,0x59,
-	0xC7,0x46,0xEE,0x00,0x00,0xEB,0x09,0x8B,0x46,0xF4,0xF7,
-	0x6E,0xF8,0x89,0x46,0xEE,0xC7,0x46,0xF0,0x00,0x00,0x83,
-	0x7E,0xC8,0x00,0x74,0x10,0x8B,0x46,0xD8,0x8B,0x56,0xD6,
-	0x3B,0x46,0xE0,0x75,0x20,0x3B,0x56,0xDE,0x75,0x1B,0x8B,
-	0x5E,0xF6,0x33,0xC9,0x8B,0x56,0xF0,0x8B,0x46,0xEE,0xE8,
-	0x3F,0x79,0x3B,0x56,0xEC,0x75,0x08,0x3B,0x46,0xEA,0x75,
-	0x03,0xE9,0xB0,0x00,0xB8,0xB2,0x00,0x50,0xE8,0x46,0x54,
-	0x59,0xB8,0x45,0x04,0x50,0xB8,0x16,0x00,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xCD,0x41,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0x9A,0x51,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,
-	0x18,0x54,0x59,0x83,0x7E,0xBA,0x00,0x74,0x06,0xB8,0x01,
-	0x00,0xE9,0x6E,0x07,0xB8,0xB2,0x00,0x50,0xE8,0x04,0x54,
-	0x59,0xB8,0x7F,0x04,0x50,0xB8,0x17,0x00,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x8B,0x41,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0x58,0x51,0x59,0x59,0xFF,0x74,0x04,0xB8,0xAF,
-	0x04,0x50,0xE8,0x4C,0x51,0x59,0x59,0xB8,0xB6,0x04,0x50,
-	0xB8,0x18,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x59,0x41,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x26,0x51,0x59,
-	0x59,0xB8,0xB2,0x00,0x50,0xE8,0xA4,0x53,0x59,0xE8,0xB0,
-	0x19,0xE9,0xC2,0xFE,0x83,0x7E,0xC8,0x00,0x75,0x03,0xE9,
-	0x67,0x01,0xB8,0x23,0x01,0x50,0xE8,0x8D,0x53,0x59,0xB8,
-	0xE5,0x02,0x50,0x33,0xC0,0x50,0xB8,0x04,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0x15,0x41,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xE2,
-	0x50,0x59,0x59,0xFF,0x76,0xDA,0xB8,0xED,0x02,0x50,0xE8,
-	0xD6,0x50,0x59,0x59,0xB8,0xF2,0x02,0x50,0xB8,0x01,0x00,
-	0x50,0xB8,0x04,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xE3,
-	0x40,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0xEB,0x00,0x50,0xE8,0xB0,0x50,0x59,0x59,0xFF,0x76,
-	0xF8,0xB8,0xFB,0x02,0x50,0xE8,0xA4,0x50,0x59,0x59,0xB8,
-	0x01,0x03,0x50,0xB8,0x02,0x00,0x50,0xB8,0x04,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0xB1,0x40,0x83,0xC4,0x08,0xA3,
-	0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,
-	0x7E,0x50,0x59,0x59,0xFF,0x76,0xF6,0xB8,0xFB,0x02,0x50,
-	0xE8,0x72,0x50,0x59,0x59,0xB8,0x15,0x03,0x50,0xB8,0x03,
-	0x00,0x50,0xB8,0x04,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,
-	0x7F,0x40,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,
-	0x16,0xB8,0xEB,0x00,0x50,0xE8,0x4C,0x50,0x59,0x59,0xB8,
-	0xE9,0x00,0x50,0xE8,0xCA,0x52,0x59,0xB8,0x26,0x03,0x50,
-	0xB8,0x04,0x00,0x50,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x54,
-	0x40,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0xEB,0x00,0x50,0xE8,0x21,0x50,0x59,0x59,0xFF,0x76,
-	0xE0,0xFF,0x76,0xDE,0xB8,0x3D,0x03,0x50,0xE8,0x12,0x50,
-	0x83,0xC4,0x06,0xB8,0x43,0x03,0x50,0xB8,0x05,0x00,0x50,
-	0xB8,0x04,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x1E,0x40,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0xEB,0x4F,0x59,0x59,0xB8,0xE9,0x00,
-	0x50,0xE8,0x69,0x52,0x59,0x8B,0x46,0xD0,0x8B,0x56,0xCE,
-	0x89,0x56,0xE2,0x89,0x46,0xE4,0x8B,0x56,0xE8,0x8B,0x46,
-	0xE6,0xB1,0x09,0xE8,0xF4,0x73,0x01,0x46,0xCE,0x11,0x56,
-	0xD0,0x8B,0x46,0xD0,0x8B,0x56,0xCE,0x3B,0x46,0xF0,0x72,
-	0x13,0x77,0x05,0x3B,0x56,0xEE,0x76,0x0C,0x8B,0x46,0xF0,
-	0x8B,0x56,0xEE,0x89,0x56,0xCE,0x89,0x46,0xD0,0xC7,0x46,
-	0xA0,0x00,0x00,0xE9,0xA5,0x02,0x83,0x7E,0xA0,0x00,0x75,
-	0x2C,0x83,0x7E,0xC8,0x00,0x74,0x11,0xB8,0xB2,0x00,0x50,
-	0xE8,0x12,0x52,0x59,0xB8,0xD1,0x04,0x50,0xB8,0x23,0x00,
-	0xEB,0x24,0xB8,0x23,0x01,0x50,0xE8,0x01,0x52,0x59,0xB8,
-	0xEB,0x04,0x50,0xB8,0x19,0x00,0xEB,0x13,0xEB,0x11,0xEB,
-	0x2E,0xB8,0xB2,0x00,0x50,0xE8,0xEC,0x51,0x59,0xB8,0xBA,
-	0x03,0x50,0xB8,0x26,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0x73,0x3F,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x40,
-	0x4F,0x59,0x59,0xE8,0xCF,0x12,0x8B,0x46,0xE4,0x8B,0x56,
-	0xE2,0xE9,0x06,0x02,0x8B,0x46,0xD0,0x8B,0x56,0xCE,0x83,
-	0xEA,0x20,0x1D,0x00,0x00,0x3B,0x46,0xD4,0x72,0x0E,0x77,
-	0x05,0x3B,0x56,0xD2,0x76,0x07,0xC7,0x46,0xAA,0x20,0x00,
-	0xEB,0x09,0x8B,0x46,0xCE,0x2B,0x46,0xD2,0x89,0x46,0xAA,
-	0x8B,0x46,0xAA,0xB1,0x09,0xD3,0xE0,0x89,0x46,0xA8,0xFF,
-	0x76,0xAA,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xE8,0x18,0x34,
-	0x83,0xC4,0x06,0x0B,0xC0,0x75,0x03,0xE9,0xB2,0x01,0xFF,
-	0x76,0xA8,0x8D,0x86,0x9A,0xBF,0x50,0xE8,0x23,0x12,0x59,
-	0x59,0x0B,0xC0,0x75,0x03,0xE9,0xE5,0xFA,0x83,0x7E,0xA0,
-	0x00,0x74,0x03,0xE9,0xC5,0x00,0x8B,0x46,0xD2,0x0B,0x46,
-	0xD4,0x75,0x0F,0x83,0x7D,0x18,0x01,0x75,0x09,0x8D,0x86,
-	0x9A,0xBF,0x50,0xE8,0x66,0x3C,0x59,0xFF,0x76,0xD0,0xFF,
-	0x76,0xCE,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xE8,0xB3,0x09,
-	0x83,0xC4,0x08,0x8D,0x86,0x9A,0xBF,0x50,0x8B,0x46,0xD2,
-	0x99,0x52,0x50,0xFF,0x76,0xAA,0x8A,0x46,0xB4,0x98,0x50,
-	0xE8,0x12,0x5A,0x83,0xC4,0x0A,0x0B,0xC0,0x75,0x03,0xE9,
-	0x4C,0x01,0x8B,0x46,0xD2,0x0B,0x46,0xD4,0x75,0x62,0x8D,
-	0x86,0x9A,0xBF,0x50,0x33,0xC0,0x33,0xD2,0x50,0x52,0xB8,
-	0x01,0x00,0x50,0x8A,0x46,0xB4,0x98,0x50,0xE8,0xE9,0x59,
-	0x83,0xC4,0x0A,0x0B,0xC0,0x74,0x44,0xB8,0x23,0x01,0x50,
-	0xE8,0xDE,0x50,0x59,0xB8,0x15,0x05,0x50,0xB8,0x29,0x00,
-	0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x65,
-	0x3E,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0xEB,0x00,0x50,0xE8,0x32,0x4E,0x59,0x59,0x8B,0x46,
-	0xE0,0x8B,0x56,0xDE,0x3B,0x46,0xE8,0x75,0x08,0x3B,0x56,
-	0xE6,0x75,0x03,0xE9,0x0F,0x01,0xE9,0x09,0x03,0xB8,0xB2,
-	0x00,0x50,0xE8,0x9A,0x50,0x59,0xB8,0x3B,0x05,0x50,0xB8,
-	0x1B,0x00,0xE9,0xA1,0x00,0x8D,0x86,0x9A,0x7F,0x50,0x8B,
-	0x46,0xD2,0x99,0x52,0x50,0xFF,0x76,0xAA,0x8A,0x46,0xB4,
-	0x98,0x50,0xE8,0x15,0x59,0x83,0xC4,0x0A,0x0B,0xC0,0x74,
-	0x3E,0xB8,0xB2,0x00,0x50,0xE8,0x6B,0x50,0x59,0xB8,0xCA,
-	0x03,0x50,0xB8,0x12,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xF2,0x3D,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xBF,
-	0x4D,0x59,0x59,0xFF,0x76,0xD4,0xFF,0x76,0xD2,0xB8,0xEA,
-	0x03,0x50,0xE8,0xB0,0x4D,0x83,0xC4,0x06,0x8B,0x46,0xD2,
-	0x0B,0x46,0xD4,0x75,0x18,0x83,0x7D,0x18,0x01,0x75,0x12,
-	0x8D,0x86,0x9A,0xBF,0x50,0xE8,0x29,0x3B,0x59,0x8D,0x86,
-	0x9A,0x7F,0x50,0xE8,0x20,0x3B,0x59,0xFF,0x76,0xA8,0x8D,
-	0x86,0x9A,0x7F,0x50,0x8D,0x86,0x9A,0xBF,0x50,0xE8,0xD9,
-	0x61,0x83,0xC4,0x06,0x0B,0xC0,0x74,0x3E,0xB8,0xB2,0x00,
-	0x50,0xE8,0xF6,0x4F,0x59,0xB8,0x0B,0x04,0x50,0xB8,0x25,
-	0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,
-	0x7D,0x3D,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,
-	0x16,0xB8,0xEB,0x00,0x50,0xE8,0x4A,0x4D,0x59,0x59,0xFF,
-	0x76,0xD4,0xFF,0x76,0xD2,0xB8,0xEA,0x03,0x50,0xE8,0x3B,
-	0x4D,0x83,0xC4,0x06,0x8B,0x46,0xD4,0x8B,0x56,0xD2,0x83,
-	0xC2,0x20,0x15,0x00,0x00,0x89,0x56,0xD2,0x89,0x46,0xD4,
-	0x8B,0x46,0xD4,0x8B,0x56,0xD2,0x3B,0x46,0xD0,0x73,0x03,
-	0xE9,0xE6,0xFD,0x75,0x08,0x3B,0x56,0xCE,0x73,0x03,0xE9,
-	0xDC,0xFD,0xFF,0x76,0xD0,0xFF,0x76,0xCE,0xFF,0x76,0xD4,
-	0xFF,0x76,0xD2,0xE8,0x0B,0x08,0x83,0xC4,0x08,0xFF,0x46,
-	0xA0,0x83,0x7E,0xBC,0x00,0x74,0x0F,0x83,0x7E,0xA0,0x01,
-	0x7F,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0xEB,0x0D,
-	0x83,0x7E,0xA0,0x01,0x7D,0x05,0xB8,0x01,0x00,0xEB,0x02,
-	0x33,0xC0,0x0B,0xC0,0x74,0x03,0xE9,0x32,0xFD,0x83,0x7E,
-	0xC8,0x00,0x75,0x08,0xB8,0xB2,0x00,0x50,0xE8,0x4A,0x4F,
-	0x59,0x83,0x7E,0xC8,0x00,0x75,0x16,0x8B,0x46,0xE0,0x8B,
-	0x56,0xDE,0x3B,0x46,0xE8,0x74,0x03,0xE9,0xF4,0x00,0x3B,
-	0x56,0xE6,0x74,0x03,0xE9,0xEC,0x00,0x83,0x7E,0xBA,0x00,
-	0x74,0x05,0xA0,0xA9,0x00,0xEB,0x05,0xA0,0xA9,0x00,0xFE,
-	0xC0,0x88,0x46,0xFA,0x3A,0x06,0xA8,0x00,0x74,0x03,0xE9,
-	0xA5,0x00,0xFE,0x46,0xFA,0xE9,0x9F,0x00,0xE8,0xDE,0x14,
-	0x83,0x7E,0xBE,0x00,0x74,0x08,0xB8,0x9A,0x01,0x50,0xE8,
-	0x74,0x4C,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xF3,0x4E,0x59,
-	0x83,0x7E,0xC8,0x00,0x74,0x08,0xB8,0xB2,0x00,0x50,0xE8,
-	0xE5,0x4E,0x59,0xB8,0x59,0x05,0x50,0xB8,0x1C,0x00,0x50,
-	0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x6C,0x3C,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0x39,0x4C,0x59,0x59,0x83,0x7E,0xC8,
-	0x00,0x74,0x13,0xC7,0x46,0xCE,0x00,0x00,0xC7,0x46,0xD0,
-	0x00,0x00,0xB8,0x7B,0x05,0x50,0xB8,0x1D,0x00,0xEB,0x07,
-	0xB8,0x8D,0x05,0x50,0xB8,0x1E,0x00,0x50,0xB8,0x01,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x2D,0x3C,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,
-	0xE8,0xFA,0x4B,0x59,0x59,0xE8,0xE8,0x5C,0x50,0xE8,0x3A,
-	0x55,0x59,0x88,0x46,0xFA,0xB8,0xB2,0x00,0x50,0xE8,0x6D,
-	0x4E,0x59,0x8A,0x46,0xFA,0x3A,0x06,0xA8,0x00,0x74,0x09,
-	0x3A,0x06,0xA9,0x00,0x74,0x03,0xE9,0x4F,0xFF,0x83,0x7E,
-	0xC8,0x00,0x74,0x21,0x8A,0x46,0xFA,0x3A,0x06,0xA8,0x00,
-	0x75,0x18,0xB8,0xB2,0x00,0x50,0xE8,0x44,0x4E,0x59,0xEB,
-	0x0E,0xB8,0xB2,0x00,0x50,0xE8,0x3A,0x4E,0x59,0xA0,0xA9,
-	0x00,0x88,0x46,0xFA,0x83,0x7D,0x18,0x01,0x75,0x13,0xB8,
-	0xB2,0x00,0x50,0xE8,0x26,0x4E,0x59,0xE8,0xDF,0x39,0xB8,
-	0xB2,0x00,0x50,0xE8,0x1B,0x4E,0x59,0x8A,0x46,0xFA,0x3A,
-	0x06,0xA9,0x00,0x74,0x03,0xE9,0xBF,0xF8,0xA0,0xA8,0x00,
-	0x88,0x46,0xFA,0x3A,0x06,0xA9,0x00,0x75,0x03,0xFE,0x46,
-	0xFA,0xE8,0x1B,0x0F,0xEB,0x68,0x83,0x7E,0xA2,0x00,0x74,
-	0x62,0xE8,0xFE,0x0E,0xFF,0x76,0xC4,0xFF,0x76,0xBA,0xFF,
-	0x76,0xB6,0xFF,0x76,0xE0,0xFF,0x76,0xDE,0xB8,0x00,0x40,
-	0x50,0x8D,0x86,0x9A,0xBF,0x50,0xB8,0x01,0x00,0x50,0xE8,
-	0x02,0x37,0x59,0x50,0xE8,0x49,0x32,0x83,0xC4,0x10,0x0B,
-	0xC0,0x75,0x34,0xB8,0x99,0x05,0x50,0xB8,0x24,0x00,0x50,
-	0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x4E,0x3B,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0x1B,0x4B,0x59,0x59,0xB8,0xB2,0x00,
-	0x50,0xE8,0x99,0x4D,0x59,0xB8,0x03,0x00,0xE9,0xF5,0x00,
-	0xA0,0xA8,0x00,0xFE,0xC0,0x88,0x46,0xFB,0x3A,0x06,0xA9,
-	0x00,0x75,0x03,0xFE,0x46,0xFB,0x83,0x7E,0xC8,0x00,0x75,
-	0x77,0x83,0x7E,0xBA,0x00,0x75,0x71,0x8B,0x46,0xD0,0x8B,
-	0x56,0xCE,0x3B,0x46,0xF0,0x75,0x66,0x3B,0x56,0xEE,0x75,
-	0x61,0xEB,0x4E,0xE8,0x36,0x13,0xB8,0xB2,0x00,0x50,0xE8,
-	0x59,0x4D,0x59,0xB8,0xB5,0x05,0x50,0xB8,0x1F,0x00,0x50,
-	0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xE0,0x3A,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0xAD,0x4A,0x59,0x59,0xE8,0x9B,0x5B,
-	0x50,0xE8,0xED,0x53,0x59,0x88,0x46,0xFB,0xB8,0xB2,0x00,
-	0x50,0xE8,0x20,0x4D,0x59,0xC7,0x46,0xCE,0x00,0x00,0xC7,
-	0x46,0xD0,0x00,0x00,0x8A,0x46,0xFB,0x3A,0x06,0xA8,0x00,
-	0x74,0x4D,0x3A,0x06,0xA9,0x00,0x75,0xA3,0xEB,0x45,0x83,
-	0x7E,0xC8,0x00,0x75,0x16,0x83,0x7E,0xBA,0x00,0x74,0x39,
-	0x8B,0x46,0xD0,0x8B,0x56,0xCE,0x3B,0x46,0xF0,0x75,0x2E,
-	0x3B,0x56,0xEE,0x75,0x29,0xA0,0xA9,0x00,0x88,0x46,0xFB,
-	0x83,0x7E,0xBA,0x00,0x74,0x09,0xB8,0xB2,0x00,0x50,0xE8,
-	0xD5,0x4C,0xEB,0x13,0x83,0x7E,0xBE,0x00,0x74,0x0E,0x83,
-	0x7E,0xC6,0x02,0x75,0x08,0xB8,0x9A,0x01,0x50,0xE8,0x39,
-	0x4A,0x59,0x8A,0x46,0xFB,0x3A,0x06,0xA9,0x00,0x74,0x03,
-	0xE9,0xBE,0xEE,0x83,0x7E,0xC8,0x00,0x74,0x0E,0x83,0x7E,
-	0xC6,0x02,0x75,0x08,0xB8,0xB2,0x00,0x50,0xE8,0xA0,0x4C,
-	0x59,0x33,0xC0,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0xDE,0x0D,
-	0xD1,0x0D,0xCB,0x0D,0xC5,0x0D,0x31,0x00,0x41,0x00,0x44,
-	0x00,0x46,0x00,0x49,0x00,0x4D,0x00,0x4F,0x00,0x52,0x00,
-	0x54,0x00,0x56,0x00,0x58,0x00,0x61,0x00,0x64,0x00,0x66,
-	0x00,0x69,0x00,0x6D,0x00,0x6F,0x00,0x72,0x00,0x74,0x00,
-	0x76,0x00,0x78,0x00,0xCD,0x04,0x65,0x04,0xA0,0x04,0xAE,
-	0x04,0x85,0x04,0x77,0x04,0x8E,0x04,0xB7,0x04,0xC0,0x04,
-	0x6E,0x04,0x97,0x04,0x65,0x04,0xA0,0x04,0xAE,0x04,0x85,
-	0x04,0x77,0x04,0x8E,0x04,0xB7,0x04,0xC0,0x04,0x6E,0x04,
-	0x97,0x04,0x55,0x8B,0xEC,0xB8,0xDB,0x05,0x50,0xB8,0xCE,
-	0x05,0x50,0xE8,0xA6,0x49,0x59,0x59,0xB8,0xE5,0x05,0x50,
-	0xB8,0x32,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xB3,0x39,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x80,0x49,0x59,
-	0x59,0xB8,0x23,0x01,0x50,0xE8,0x77,0x49,0x59,0xB8,0x28,
-	0x06,0x50,0xE8,0x6F,0x49,0x59,0xB8,0x32,0x06,0x50,0xB8,
-	0x33,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x7D,0x39,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x4A,0x49,0x59,0x59,
-	0xB8,0x35,0x06,0x50,0xE8,0x41,0x49,0x59,0xB8,0x32,0x06,
-	0x50,0xB8,0x33,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x4F,0x39,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x1C,0x49,
-	0x59,0x59,0xB8,0x5D,0x06,0x50,0xE8,0x13,0x49,0x59,0xB8,
-	0x6C,0x06,0x50,0xE8,0x0B,0x49,0x59,0xB8,0x77,0x06,0x50,
-	0xB8,0x34,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x19,0x39,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xE6,0x48,0x59,
-	0x59,0xB8,0x7E,0x06,0x50,0xE8,0xDD,0x48,0x59,0xB8,0x82,
-	0x06,0x50,0xB8,0x35,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xEB,0x38,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xB8,
-	0x48,0x59,0x59,0x8A,0x46,0x04,0x98,0x50,0x8A,0x46,0x04,
-	0x98,0x50,0x8A,0x46,0x04,0x98,0x50,0x8A,0x46,0x04,0x98,
-	0x50,0x8A,0x46,0x04,0x98,0x50,0x8A,0x46,0x04,0x98,0x50,
-	0x8A,0x46,0x04,0x98,0x50,0x8A,0x46,0x04,0x98,0x50,0x8A,
-	0x46,0x04,0x98,0x50,0x8A,0x46,0x04,0x98,0x50,0xB8,0x8E,
-	0x06,0x50,0xE8,0x7D,0x48,0x83,0xC4,0x16,0xB8,0xC4,0x06,
-	0x50,0xB8,0x36,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x89,0x38,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x56,0x48,
-	0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xD4,0x4A,0x59,0xB8,
-	0xF3,0x06,0x50,0xB8,0x37,0x00,0x50,0xB8,0x09,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0x5B,0x38,0x83,0xC4,0x08,0xA3,
-	0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,
-	0x28,0x48,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xA6,0x4A,
-	0x59,0xB8,0xB2,0x00,0x50,0xE8,0x9E,0x4A,0x59,0x8A,0x46,
-	0x04,0x98,0x50,0xB8,0x20,0x07,0x50,0xE8,0x0A,0x48,0x59,
-	0x59,0xB8,0x27,0x07,0x50,0xB8,0x38,0x00,0x50,0xB8,0x09,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x17,0x38,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,
-	0x50,0xE8,0xE4,0x47,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,
-	0x62,0x4A,0x59,0x8A,0x46,0x04,0x98,0x50,0xB8,0x50,0x07,
-	0x50,0xE8,0xCE,0x47,0x59,0x59,0xB8,0x57,0x07,0x50,0xB8,
-	0x39,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0xDB,0x37,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0xA8,0x47,0x59,0x59,
-	0xB8,0xB2,0x00,0x50,0xE8,0x26,0x4A,0x59,0x8A,0x46,0x04,
-	0x98,0x50,0xB8,0x70,0x07,0x50,0xE8,0x92,0x47,0x59,0x59,
-	0xB8,0x77,0x07,0x50,0xB8,0x3A,0x00,0x50,0xB8,0x09,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x9F,0x37,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,
-	0xE8,0x6C,0x47,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xEA,
-	0x49,0x59,0x8A,0x46,0x04,0x98,0x50,0xB8,0x96,0x07,0x50,
-	0xE8,0x56,0x47,0x59,0x59,0xB8,0x9D,0x07,0x50,0xB8,0x3B,
-	0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,
-	0x63,0x37,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,
-	0x16,0xB8,0xEB,0x00,0x50,0xE8,0x30,0x47,0x59,0x59,0xB8,
-	0xB2,0x00,0x50,0xE8,0xAE,0x49,0x59,0x8A,0x46,0x04,0x98,
-	0x50,0xB8,0xBE,0x07,0x50,0xE8,0x1A,0x47,0x59,0x59,0xB8,
-	0xC5,0x07,0x50,0xB8,0x3C,0x00,0x50,0xB8,0x09,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0x27,0x37,0x83,0xC4,0x08,0xA3,
-	0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,
-	0xF4,0x46,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0x72,0x49,
-	0x59,0x8A,0x46,0x04,0x98,0x50,0xB8,0x0D,0x08,0x50,0xE8,
-	0xDE,0x46,0x59,0x59,0xB8,0x14,0x08,0x50,0xB8,0x3D,0x00,
-	0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xEB,
-	0x36,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0xEB,0x00,0x50,0xE8,0xB8,0x46,0x59,0x59,0xB8,0xB2,
-	0x00,0x50,0xE8,0x36,0x49,0x59,0x8A,0x46,0x04,0x98,0x50,
-	0xB8,0x2E,0x08,0x50,0xE8,0xA2,0x46,0x59,0x59,0xB8,0x35,
-	0x08,0x50,0xB8,0x3E,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xAF,0x36,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x7C,
-	0x46,0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xFA,0x48,0x59,
-	0x8A,0x46,0x04,0x98,0x50,0xB8,0x53,0x08,0x50,0xE8,0x66,
-	0x46,0x59,0x59,0xB8,0x5A,0x08,0x50,0xB8,0x3F,0x00,0x50,
-	0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x73,0x36,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0xEB,0x00,0x50,0xE8,0x40,0x46,0x59,0x59,0xB8,0xB2,0x00,
-	0x50,0xE8,0xBE,0x48,0x59,0x8A,0x46,0x04,0x98,0x50,0xB8,
-	0x7C,0x08,0x50,0xE8,0x2A,0x46,0x59,0x59,0xB8,0x83,0x08,
-	0x50,0xB8,0x40,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x37,0x36,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x04,0x46,
-	0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0x82,0x48,0x59,0x8A,
-	0x46,0x04,0x98,0x50,0xB8,0xB5,0x08,0x50,0xE8,0xEE,0x45,
-	0x59,0x59,0xB8,0xBC,0x08,0x50,0xB8,0x28,0x00,0x50,0xB8,
-	0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xFB,0x35,0x83,
-	0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xEB,
-	0x00,0x50,0xE8,0xC8,0x45,0x59,0x59,0xB8,0xB2,0x00,0x50,
-	0xE8,0x46,0x48,0x59,0x8A,0x46,0x04,0x98,0x50,0xB8,0xF6,
-	0x08,0x50,0xE8,0xB2,0x45,0x59,0x59,0xB8,0xFD,0x08,0x50,
-	0xB8,0x43,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xBF,0x35,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x8C,0x45,0x59,
-	0x59,0xB8,0xB2,0x00,0x50,0xE8,0x0A,0x48,0x59,0xB8,0x23,
-	0x01,0x50,0xE8,0x7B,0x45,0x59,0xB8,0x26,0x09,0x50,0xB8,
-	0x41,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x89,0x35,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x56,0x45,0x59,0x59,
-	0xB8,0xB2,0x00,0x50,0xE8,0xD4,0x47,0x59,0xB8,0x61,0x09,
-	0x50,0xB8,0x42,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x5B,0x35,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xEB,0x00,0x50,0xE8,0x28,0x45,
-	0x59,0x59,0xB8,0xB2,0x00,0x50,0xE8,0xA6,0x47,0x59,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xE8,0xBC,0x08,0xE8,0x81,0x2A,0xFF,
-	0x36,0x8C,0x16,0xE8,0xA8,0x43,0x59,0xE8,0x77,0x31,0xFF,
-	0x36,0x8A,0x16,0xE8,0x78,0x37,0x59,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xE8,0xDC,0xFF,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,
-	0xFF,0x76,0x0A,0xFF,0x76,0x08,0xFF,0x76,0x06,0xFF,0x76,
-	0x04,0xB8,0xA5,0x09,0x50,0xE8,0xDE,0x44,0x83,0xC4,0x0A,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x04,0x56,
-	0xE8,0xE7,0x5D,0x59,0x3D,0x02,0x00,0x74,0x02,0xEB,0x1F,
-	0x8A,0x04,0x98,0x50,0xE8,0x07,0x4E,0x59,0x8B,0xF8,0x83,
-	0xFF,0x41,0x7C,0x10,0x83,0xFF,0x5A,0x7F,0x0B,0x80,0x7C,
-	0x01,0x3A,0x75,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,
-	0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,0xE8,
-	0xBE,0xFF,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,
-	0x04,0x56,0xE8,0xB0,0xFF,0x59,0x0B,0xC0,0x75,0x11,0x80,
-	0x3C,0x2F,0x74,0x0C,0xE8,0xF6,0x14,0x3A,0x04,0x74,0x05,
-	0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0x8B,0x76,0x04,0x8B,0x7E,0x06,0x56,
-	0xE8,0x86,0xFF,0x59,0x0B,0xC0,0x74,0x0B,0x57,0xE8,0x7D,
-	0xFF,0x59,0x0B,0xC0,0x74,0x02,0xEB,0x5F,0x56,0xE8,0x72,
-	0xFF,0x59,0x0B,0xC0,0x74,0x09,0x56,0x57,0xE8,0xD3,0xFF,
-	0x59,0x59,0xEB,0x4F,0x57,0xE8,0x60,0xFF,0x59,0x0B,0xC0,
-	0x74,0x44,0x80,0x3C,0x00,0x74,0x25,0x80,0x7C,0x01,0x3A,
-	0x75,0x1F,0x8A,0x04,0x98,0x50,0xE8,0x6B,0x4D,0x59,0x50,
-	0x8A,0x05,0x98,0x50,0xE8,0x62,0x4D,0x59,0x5A,0x3B,0xD0,
-	0x75,0x05,0xB8,0x01,0x00,0xEB,0x1C,0xEB,0x18,0xEB,0x18,
-	0xE8,0x8A,0x50,0x05,0x41,0x00,0x50,0x8A,0x05,0x98,0x50,
-	0xE8,0x45,0x4D,0x59,0x5A,0x3B,0xD0,0x75,0x02,0xEB,0xE1,
-	0x33,0xC0,0xEB,0x02,0x33,0xC0,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x04,0x56,0xE8,0x06,0xFF,0x59,
-	0x0B,0xC0,0x75,0x0A,0x0B,0xF6,0x74,0x0A,0x80,0x7C,0x01,
-	0x3A,0x75,0x04,0x8A,0x04,0xEB,0x0B,0xE8,0x4C,0x50,0x05,
-	0x41,0x00,0x50,0xE8,0xDF,0x4C,0x59,0x5E,0x5D,0xC3,0x06,
-	0x56,0x57,0xFC,0xB8,0x67,0x35,0xCD,0x21,0xBE,0xC0,0x09,
-	0xB9,0x04,0x00,0xBF,0x0A,0x00,0xF3,0xA7,0x74,0x04,0x31,
-	0xC0,0xEB,0x0F,0xB4,0x41,0xCD,0x67,0x80,0xFC,0x00,0x74,
-	0x04,0x31,0xC0,0xEB,0x02,0x89,0xD8,0x5F,0x5E,0x07,0xC3,
-	0xB4,0x46,0xCD,0x67,0x80,0xFC,0x00,0x75,0x06,0x3C,0x32,
-	0x72,0x02,0xEB,0x03,0xB8,0xFF,0xFF,0xC3,0xB4,0x40,0xCD,
-	0x67,0x80,0xFC,0x00,0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x02,
-	0x31,0xC0,0xC3,0xB4,0x42,0xCD,0x67,0x80,0xFC,0x00,0x74,
-	0x05,0xB8,0xFF,0xFF,0xEB,0x02,0x89,0xD8,0xC3,0x89,0xE3,
-	0xB4,0x43,0x36,0x8B,0x5F,0x02,0xCD,0x67,0x80,0xFC,0x00,
-	0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x02,0x89,0xD0,0xC3,0x89,
-	0xE3,0xB4,0x45,0x36,0x8B,0x57,0x02,0xCD,0x67,0x80,0xFC,
-	0x00,0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x02,0x31,0xC0,0xC3,
-	0x55,0x89,0xE5,0x8B,0x46,0x04,0x8B,0x5E,0x08,0x8B,0x56,
-	0x06,0xB4,0x44,0xCD,0x67,0x80,0xFC,0x00,0x74,0x03,0xB8,
-	0xFF,0xFF,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0x8B,0x16,0x28,0x17,0xA1,0x26,0x17,0xB1,0x0E,0xE8,0x2B,
-	0x67,0x89,0x46,0xFE,0x8B,0x46,0x06,0xB1,0x0E,0xD3,0xE8,
-	0x8B,0xF8,0x33,0xF6,0xEB,0x3B,0x8B,0x46,0xFE,0x03,0xC6,
-	0x50,0xFF,0x36,0x94,0x16,0x33,0xC0,0x50,0xE8,0xB3,0xFF,
-	0x83,0xC4,0x06,0x3D,0xFF,0xFF,0x75,0x04,0x33,0xC0,0xEB,
-	0x26,0xB8,0x00,0x40,0x50,0x8B,0xC6,0xB1,0x0E,0xD3,0xE0,
-	0x8B,0x56,0x04,0x03,0xD0,0x52,0x1E,0x33,0xC0,0x50,0xFF,
-	0x36,0x9C,0x16,0xE8,0xA0,0x57,0x83,0xC4,0x0A,0x46,0x3B,
-	0xF7,0x72,0xC1,0xB8,0x01,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,0x8B,0x16,0x28,
-	0x17,0xA1,0x26,0x17,0xB1,0x0E,0xE8,0xC0,0x66,0x89,0x46,
-	0xFE,0x8B,0x46,0x06,0xB1,0x0E,0xD3,0xE8,0x8B,0xF8,0x33,
-	0xF6,0xEB,0x3B,0x8B,0x46,0xFE,0x03,0xC6,0x50,0xFF,0x36,
-	0x94,0x16,0x33,0xC0,0x50,0xE8,0x48,0xFF,0x83,0xC4,0x06,
-	0x3D,0xFF,0xFF,0x75,0x04,0x33,0xC0,0xEB,0x26,0xB8,0x00,
-	0x40,0x50,0x33,0xC0,0x50,0xFF,0x36,0x9C,0x16,0x8B,0xC6,
-	0xB1,0x0E,0xD3,0xE0,0x8B,0x56,0x04,0x03,0xD0,0x52,0x1E,
-	0xE8,0x35,0x57,0x83,0xC4,0x0A,0x46,0x3B,0xF7,0x72,0xC1,
-	0xB8,0x01,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xFF,0x36,0x94,0x16,0xE8,0xEF,0xFE,0x59,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x36,0x28,0x17,0xFF,
-	0x36,0x26,0x17,0xFF,0x36,0x94,0x16,0xFF,0x76,0x04,0xE8,
-	0x15,0x0A,0x83,0xC4,0x0A,0x3B,0x46,0x06,0x75,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,
-	0xFF,0x76,0x06,0xFF,0x76,0x04,0xFF,0x36,0x28,0x17,0xFF,
-	0x36,0x26,0x17,0xFF,0x36,0x94,0x16,0xE8,0xAD,0x09,0x83,
-	0xC4,0x0A,0x3B,0x46,0x06,0x75,0x05,0xB8,0x01,0x00,0xEB,
-	0x02,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x36,0x94,
-	0x16,0xE8,0x50,0x09,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,
-	0x76,0x06,0xFF,0x76,0x04,0xFF,0x36,0x94,0x16,0xE8,0xD0,
-	0x58,0x83,0xC4,0x06,0x3B,0x46,0x06,0x75,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,
-	0x76,0x06,0xFF,0x76,0x04,0xFF,0x36,0x94,0x16,0xE8,0x42,
-	0x4B,0x83,0xC4,0x06,0x3B,0x46,0x06,0x75,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,
-	0x36,0x94,0x16,0xE8,0xAE,0x36,0x59,0xB8,0x01,0x80,0x50,
-	0xB8,0xA0,0x16,0x50,0xE8,0x0F,0x57,0x59,0x59,0xA3,0x94,
-	0x16,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x36,0x94,0x16,0xE8,
-	0x91,0x36,0x59,0xB8,0x02,0x80,0x50,0xB8,0xA0,0x16,0x50,
-	0xE8,0xF2,0x56,0x59,0x59,0xA3,0x94,0x16,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xFF,0x36,0x94,0x16,0xE8,0x74,0x36,0x59,0xB8,
-	0xA0,0x16,0x50,0xE8,0xDB,0x5A,0x59,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xFF,0x36,0x94,0x16,0xE8,0x5F,0x36,0x59,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x76,0x04,0x1E,0xFF,
-	0x36,0x20,0x17,0xFF,0x36,0x24,0x17,0xE8,0x05,0x56,0x83,
-	0xC4,0x0A,0x8B,0x46,0x06,0xB1,0x04,0xD3,0xE8,0x8B,0x16,
-	0x24,0x17,0x03,0xD0,0x89,0x16,0x24,0x17,0xB8,0x01,0x00,
-	0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x36,0x20,
-	0x17,0xFF,0x36,0x24,0x17,0xFF,0x76,0x04,0x1E,0xE8,0xD7,
-	0x55,0x83,0xC4,0x0A,0x8B,0x46,0x06,0xB1,0x04,0xD3,0xE8,
-	0x8B,0x16,0x24,0x17,0x03,0xD0,0x89,0x16,0x24,0x17,0xB8,
-	0x01,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x36,0x9A,0x16,
-	0xFF,0x36,0x98,0x16,0xE8,0x7D,0x61,0x59,0x59,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xA1,0x2A,0x17,0xA3,0x24,0x17,0xA1,0x22,
-	0x17,0xA3,0x20,0x17,0x5D,0xC3,0x55,0x8B,0xEC,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xC7,0x06,0x26,0x17,0x00,0x00,0xC7,0x06,
-	0x28,0x17,0x00,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x1A,0x56,0x57,0x8B,0x76,0x0A,0x33,0xFF,0xC7,0x46,0xF2,
-	0x01,0x00,0xE8,0x7B,0x16,0x89,0x46,0xEC,0xC7,0x06,0xCC,
-	0x09,0x01,0x00,0xC7,0x06,0x26,0x17,0x00,0x00,0xC7,0x06,
-	0x28,0x17,0x00,0x00,0xC7,0x06,0x90,0x16,0x26,0x23,0xC7,
-	0x06,0x92,0x16,0x2B,0x23,0xC7,0x06,0x96,0x16,0x2B,0x23,
-	0xE8,0xFF,0x38,0x89,0x46,0xEE,0x89,0x56,0xF0,0x8B,0x46,
-	0xF0,0x8B,0x56,0xEE,0x3B,0x46,0x06,0x72,0x76,0x77,0x05,
-	0x3B,0x56,0x04,0x76,0x6F,0xFF,0x76,0x06,0xFF,0x76,0x04,
-	0xE8,0xD8,0x61,0x59,0x59,0xA3,0x98,0x16,0x89,0x16,0x9A,
-	0x16,0xA1,0x98,0x16,0xA3,0x20,0x17,0xA1,0x9A,0x16,0xA3,
-	0x24,0x17,0xA1,0x20,0x17,0xB1,0x04,0xD3,0xE8,0x8B,0x16,
-	0x24,0x17,0x03,0xD0,0x89,0x16,0x24,0x17,0x8B,0xC2,0xA3,
-	0x2A,0x17,0xA1,0x20,0x17,0x25,0x0F,0x00,0xA3,0x20,0x17,
-	0xA3,0x22,0x17,0xC7,0x06,0xC8,0x09,0x01,0x00,0xC7,0x06,
-	0x90,0x16,0x03,0x23,0xC7,0x06,0x9E,0x16,0xA7,0x22,0xC7,
-	0x06,0x8E,0x16,0xD5,0x22,0xC7,0x06,0x92,0x16,0x15,0x23,
-	0xC7,0x06,0x96,0x16,0x15,0x23,0x8B,0x46,0x06,0x8B,0x56,
-	0x04,0x89,0x14,0x89,0x44,0x02,0x83,0x3E,0xC8,0x09,0x00,
-	0x75,0x73,0x8B,0x5E,0xEC,0x83,0x3F,0x00,0x74,0x6B,0xE8,
-	0x09,0xFC,0xA3,0x9C,0x16,0x0B,0xC0,0x74,0x61,0x8B,0x56,
-	0x06,0x8B,0x46,0x04,0xB1,0x0E,0xE8,0xDF,0x63,0x05,0x01,
-	0x00,0x83,0xD2,0x00,0x50,0x52,0xE8,0x3D,0xFC,0x99,0x5B,
-	0x3B,0xDA,0x5A,0x77,0x44,0x72,0x04,0x3B,0xD0,0x73,0x3E,
-	0x8B,0x56,0x06,0x8B,0x46,0x04,0xB1,0x0E,0xE8,0xBC,0x63,
-	0x40,0x50,0xE8,0x31,0xFC,0x59,0xA3,0x94,0x16,0x83,0x3E,
-	0x94,0x16,0x00,0x7C,0x18,0xC7,0x06,0x90,0x16,0x9D,0x21,
-	0xC7,0x06,0x8E,0x16,0x32,0x21,0xC7,0x06,0x9E,0x16,0xC7,
-	0x20,0xC7,0x06,0xC8,0x09,0x04,0x00,0x8B,0x46,0x06,0x8B,
-	0x56,0x04,0x89,0x14,0x89,0x44,0x02,0x8B,0x5E,0xEC,0x83,
-	0x7F,0x02,0x00,0x74,0x55,0x83,0x3E,0xC8,0x09,0x00,0x75,
-	0x4E,0xE8,0x1D,0x06,0x0B,0xC0,0x74,0x47,0xE8,0x5D,0x06,
-	0x3B,0x56,0x06,0x72,0x3F,0x77,0x05,0x3B,0x46,0x04,0x76,
-	0x38,0xFF,0x76,0x06,0xFF,0x76,0x04,0xE8,0x6D,0x06,0x59,
-	0x59,0xA3,0x94,0x16,0x83,0x3E,0x94,0x16,0x00,0x74,0x18,
-	0xC7,0x06,0xC8,0x09,0x03,0x00,0xC7,0x06,0x90,0x16,0xFC,
-	0x21,0xC7,0x06,0x8E,0x16,0xD3,0x21,0xC7,0x06,0x9E,0x16,
-	0xAA,0x21,0x8B,0x46,0x06,0x8B,0x56,0x04,0x89,0x14,0x89,
-	0x44,0x02,0x83,0x3E,0xC8,0x09,0x00,0x74,0x03,0xE9,0x8D,
-	0x01,0x83,0x7E,0x08,0x00,0x75,0x03,0xE9,0x84,0x01,0xB8,
-	0xCE,0x09,0x50,0xE8,0x2C,0x50,0x59,0x8B,0xF8,0x0B,0xFF,
-	0x75,0x0A,0xB8,0xD3,0x09,0x50,0xE8,0x1E,0x50,0x59,0x8B,
-	0xF8,0x0B,0xFF,0x74,0x08,0x80,0x3D,0x00,0x74,0x03,0x57,
-	0xEB,0x04,0xB8,0xD8,0x09,0x50,0xB8,0xA0,0x16,0x50,0xE8,
-	0x75,0x57,0x59,0x59,0xA0,0xA0,0x16,0x98,0x50,0xE8,0xFE,
-	0x47,0x59,0x50,0x8A,0x46,0x0C,0x98,0x50,0xE8,0xF4,0x47,
-	0x59,0x5A,0x3B,0xD0,0x74,0x18,0xA0,0xA0,0x16,0x98,0x50,
-	0xE8,0xE6,0x47,0x59,0x50,0x8A,0x46,0x0E,0x98,0x50,0xE8,
-	0xDC,0x47,0x59,0x5A,0x3B,0xD0,0x75,0x0D,0xB8,0xD8,0x09,
-	0x50,0xB8,0xA0,0x16,0x50,0xE8,0x38,0x57,0x59,0x59,0xE8,
-	0x00,0x4B,0x89,0x46,0xF6,0xA0,0xA0,0x16,0x98,0x50,0xE8,
-	0xBB,0x47,0x59,0x05,0xBF,0xFF,0x89,0x46,0xF4,0x83,0x7E,
-	0xF4,0x00,0x7C,0x0D,0x83,0x7E,0xF4,0x1A,0x7F,0x07,0x80,
-	0x3E,0xA1,0x16,0x3A,0x74,0x12,0xB8,0xD8,0x09,0x50,0xB8,
-	0xA0,0x16,0x50,0xE8,0x03,0x57,0x59,0x59,0xC7,0x46,0xF4,
-	0x02,0x00,0xFF,0x76,0xF4,0xE8,0xC9,0x4A,0x59,0xE8,0xBF,
-	0x4A,0x3B,0x46,0xF4,0x74,0x03,0xE9,0xB8,0x00,0xFF,0x76,
-	0xF6,0xE8,0xB7,0x4A,0x59,0x8D,0x46,0xF8,0x50,0x8A,0x46,
-	0xF4,0xFE,0xC0,0x50,0xE8,0xF0,0x4F,0x59,0x59,0x8B,0x5E,
-	0xF8,0x33,0xC9,0x8B,0x46,0xFC,0x33,0xD2,0xE8,0x7D,0x65,
-	0x50,0x8B,0x46,0xFE,0x52,0x33,0xD2,0x59,0x5B,0xE8,0x71,
-	0x65,0x89,0x46,0xE8,0x89,0x56,0xEA,0x8B,0x46,0xEA,0x8B,
-	0x56,0xE8,0x3B,0x46,0x06,0x72,0x78,0x75,0x05,0x3B,0x56,
-	0x04,0x72,0x71,0xB8,0x02,0x00,0x50,0xB8,0xA0,0x16,0x50,
-	0xE8,0x1D,0x29,0x59,0x59,0xB8,0x02,0x00,0x50,0xE8,0x90,
-	0x29,0x59,0x89,0x46,0xE6,0x83,0x7E,0xE6,0x00,0x74,0x53,
-	0xFF,0x76,0xE6,0xB8,0xA0,0x16,0x50,0xE8,0x7B,0x56,0x59,
-	0x59,0x33,0xC0,0x50,0xB8,0xA0,0x16,0x50,0xE8,0xD8,0x4A,
-	0x59,0x59,0xA3,0x94,0x16,0x83,0x3E,0x94,0x16,0xFF,0x74,
-	0x31,0xC7,0x06,0xC8,0x09,0x02,0x00,0xC7,0x06,0x90,0x16,
-	0x85,0x22,0xC7,0x06,0x9E,0x16,0x09,0x22,0xC7,0x06,0x8E,
-	0x16,0x2A,0x22,0xC7,0x06,0x92,0x16,0x4B,0x22,0xC7,0x06,
-	0x96,0x16,0x68,0x22,0x8B,0x46,0x06,0x8B,0x56,0x04,0x89,
-	0x14,0x89,0x44,0x02,0xEB,0x12,0x83,0x7E,0xF4,0x02,0x75,
-	0x06,0x83,0x7E,0xF2,0x01,0x75,0x06,0xFF,0x46,0xF2,0xE9,
-	0x12,0xFF,0x83,0x3E,0xC8,0x09,0x00,0x74,0x03,0xE9,0x9B,
-	0x00,0x83,0x7E,0xF0,0x00,0x73,0x03,0xE9,0x92,0x00,0x77,
-	0x0A,0x81,0x7E,0xEE,0x00,0x40,0x77,0x03,0xE9,0x86,0x00,
-	0x8B,0x46,0xEE,0x25,0xFF,0x3F,0x8B,0x56,0xF0,0x8B,0x5E,
-	0xEE,0x2B,0xD8,0x83,0xDA,0x00,0x89,0x5E,0x04,0x89,0x56,
-	0x06,0xFF,0x76,0x06,0xFF,0x76,0x04,0xE8,0xC4,0x5E,0x59,
-	0x59,0xA3,0x98,0x16,0x89,0x16,0x9A,0x16,0xA1,0x98,0x16,
-	0xA3,0x20,0x17,0xA1,0x9A,0x16,0xA3,0x24,0x17,0xA1,0x20,
-	0x17,0xB1,0x04,0xD3,0xE8,0x8B,0x16,0x24,0x17,0x03,0xD0,
-	0x89,0x16,0x24,0x17,0x8B,0xC2,0xA3,0x2A,0x17,0xA1,0x20,
-	0x17,0x25,0x0F,0x00,0xA3,0x20,0x17,0xA3,0x22,0x17,0xC7,
-	0x06,0xC8,0x09,0x01,0x00,0xC7,0x06,0x90,0x16,0x03,0x23,
-	0xC7,0x06,0x9E,0x16,0xA7,0x22,0xC7,0x06,0x8E,0x16,0xD5,
-	0x22,0xC7,0x06,0x92,0x16,0x15,0x23,0xC7,0x06,0x96,0x16,
-	0x15,0x23,0x8B,0x46,0x06,0x8B,0x56,0x04,0x89,0x14,0x89,
-	0x44,0x02,0xA1,0xC8,0x09,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x76,0x04,0xFF,0x16,
-	0x9E,0x16,0x59,0x59,0x0B,0xC0,0x74,0x11,0x8B,0x46,0x06,
-	0x01,0x06,0x26,0x17,0x83,0x16,0x28,0x17,0x00,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,
-	0x76,0x06,0xFF,0x76,0x04,0xFF,0x16,0x8E,0x16,0x59,0x59,
-	0x0B,0xC0,0x74,0x11,0x8B,0x46,0x06,0x01,0x06,0x26,0x17,
-	0x83,0x16,0x28,0x17,0x00,0xB8,0x01,0x00,0xEB,0x02,0x33,
-	0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x16,0x92,0x16,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xFF,0x16,0x96,0x16,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0x3E,0xCC,0x09,0x00,0x74,0x10,0xFF,0x16,
-	0x90,0x16,0xC7,0x06,0x90,0x16,0x26,0x23,0xC7,0x06,0xC8,
-	0x09,0x00,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x0A,
-	0x56,0x8B,0x76,0x04,0x80,0x3C,0x00,0x74,0x13,0x80,0x7C,
-	0x01,0x3A,0x75,0x0D,0x8A,0x04,0x98,0x50,0xE8,0x6B,0x45,
-	0x59,0x05,0xBF,0xFF,0xEB,0x03,0xE8,0x9C,0x48,0x89,0x46,
-	0xFE,0x8D,0x46,0xF6,0x50,0x8A,0x46,0xFE,0xFE,0xC0,0x50,
-	0xE8,0xD9,0x4D,0x59,0x59,0x8B,0x5E,0xF6,0x33,0xC9,0x8B,
-	0x46,0xFA,0x33,0xD2,0xE8,0x66,0x63,0x50,0x8B,0x46,0xFC,
-	0x52,0x33,0xD2,0x59,0x5B,0xE8,0x5A,0x63,0x3B,0x56,0x08,
-	0x72,0x0C,0x75,0x05,0x3B,0x46,0x06,0x72,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x04,0x83,0x7E,0x06,0x02,0x75,
-	0x1B,0xFF,0x76,0x0A,0xFF,0x76,0x08,0x56,0xE8,0x81,0xFF,
-	0x83,0xC4,0x06,0x0B,0xC0,0x75,0x05,0xB8,0xFE,0xFF,0xEB,
-	0x54,0xB8,0x02,0x81,0xEB,0x03,0xB8,0x01,0x80,0x50,0x56,
-	0xE8,0x3B,0x51,0x59,0x59,0xA3,0x94,0x16,0x83,0x3E,0x94,
-	0x16,0xFF,0x75,0x05,0xA1,0x92,0x00,0xEB,0x36,0xC7,0x06,
-	0x90,0x16,0x9A,0x22,0xC7,0x06,0x9E,0x16,0x09,0x22,0xC7,
-	0x06,0x8E,0x16,0x2A,0x22,0xC7,0x06,0x92,0x16,0x4B,0x22,
-	0xC7,0x06,0x96,0x16,0x68,0x22,0xC7,0x06,0xCA,0x09,0x01,
-	0x00,0xC7,0x06,0xCC,0x09,0x01,0x00,0x56,0xB8,0xA0,0x16,
-	0x50,0xE8,0x19,0x54,0x59,0x59,0x33,0xC0,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x83,0x3E,0xCA,0x09,0x00,0x74,0x06,0xC7,
-	0x06,0x90,0x16,0x85,0x22,0x5D,0xC3,0x55,0x8B,0xEC,0x83,
-	0xEC,0x04,0x56,0x57,0x8B,0x76,0x08,0xB8,0x02,0x00,0x50,
-	0x33,0xC0,0x33,0xD2,0x50,0x52,0xFF,0x76,0x04,0xE8,0xD5,
-	0x38,0x83,0xC4,0x08,0x0B,0xC0,0x74,0x05,0x33,0xC0,0xE9,
-	0xFB,0x00,0xFF,0x76,0x04,0xE8,0x25,0x39,0x59,0x89,0x46,
-	0xFC,0x89,0x56,0xFE,0x83,0xFA,0xFF,0x75,0x07,0x3D,0xFF,
-	0xFF,0x75,0x02,0xEB,0xE2,0x33,0xC0,0x50,0x33,0xD2,0x50,
-	0x52,0xFF,0x76,0x04,0xE8,0xA3,0x38,0x83,0xC4,0x08,0x0B,
-	0xC0,0x74,0x02,0xEB,0xCC,0x33,0xFF,0xEB,0x2F,0xFF,0x76,
-	0x04,0x56,0xB8,0x01,0x00,0x50,0xFF,0x76,0x0A,0xE8,0xD5,
-	0x37,0x83,0xC4,0x08,0x3B,0xC6,0x74,0x02,0xEB,0xB1,0xFF,
-	0x76,0x06,0x56,0xB8,0x01,0x00,0x50,0xFF,0x76,0x0A,0xE8,
-	0x14,0x39,0x83,0xC4,0x08,0x3B,0xC6,0x74,0x02,0xEB,0x9A,
-	0x47,0x33,0xC0,0x50,0x56,0xFF,0x76,0xFE,0xFF,0x76,0xFC,
-	0xE8,0x0F,0x5E,0x50,0x8B,0xC7,0x52,0x99,0x5B,0x3B,0xDA,
-	0x5A,0x7F,0xB9,0x75,0x04,0x3B,0xD0,0x77,0xB3,0xFF,0x76,
-	0x04,0x33,0xC0,0x50,0x56,0xFF,0x76,0xFE,0xFF,0x76,0xFC,
-	0xE8,0xFD,0x5D,0x50,0xB8,0x01,0x00,0x50,0xFF,0x76,0x0A,
-	0xE8,0x7B,0x37,0x83,0xC4,0x08,0x33,0xD2,0x50,0x52,0x33,
-	0xC0,0x50,0x56,0xFF,0x76,0xFE,0xFF,0x76,0xFC,0xE8,0xDE,
-	0x5D,0x5B,0x3B,0xDA,0x5A,0x75,0x04,0x3B,0xD0,0x74,0x03,
-	0xE9,0x3F,0xFF,0xFF,0x76,0x06,0x33,0xC0,0x50,0x56,0xFF,
-	0x76,0xFE,0xFF,0x76,0xFC,0xE8,0xC1,0x5D,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x76,0x0A,0xE8,0x95,0x38,0x83,0xC4,0x08,
-	0x33,0xD2,0x50,0x52,0x33,0xC0,0x50,0x56,0xFF,0x76,0xFE,
-	0xFF,0x76,0xFC,0xE8,0xA2,0x5D,0x5B,0x3B,0xDA,0x5A,0x75,
-	0x04,0x3B,0xD0,0x74,0x03,0xE9,0x03,0xFF,0xB8,0x01,0x00,
-	0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0xEB,
-	0x12,0xFF,0x76,0x06,0x56,0xE8,0x46,0x3A,0x59,0x59,0x3D,
-	0xFF,0xFF,0x75,0x04,0x33,0xC0,0xEB,0x11,0xFF,0x76,0x04,
-	0xE8,0x44,0x4A,0x59,0x8B,0xF0,0x3D,0xFF,0xFF,0x75,0xE0,
-	0xB8,0x01,0x00,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x06,0x56,0x57,0x33,0xC0,0x50,0xFF,0x76,0x06,0xE8,0x51,
-	0x2E,0x59,0x59,0x0B,0xC0,0x75,0x03,0xE9,0xA5,0x00,0xB8,
-	0xDC,0x09,0x50,0xFF,0x76,0x04,0xE8,0x5D,0x35,0x59,0x59,
-	0x8B,0xF0,0x0B,0xF6,0x75,0x03,0xE9,0x90,0x00,0xB8,0xDF,
-	0x09,0x50,0xFF,0x76,0x06,0xE8,0x48,0x35,0x59,0x59,0x8B,
-	0xF8,0x0B,0xFF,0x75,0x06,0x56,0xE8,0xD8,0x31,0xEB,0x77,
-	0xE8,0x7B,0x46,0x89,0x46,0xFC,0xFF,0x76,0xFC,0xE8,0x67,
-	0x5F,0x59,0x89,0x46,0xFE,0x83,0x7E,0xFE,0x00,0x75,0x02,
-	0xEB,0x3A,0xFF,0x76,0xFE,0xFF,0x76,0xFC,0x57,0x56,0xE8,
-	0x42,0xFE,0x83,0xC4,0x08,0x89,0x46,0xFA,0xFF,0x76,0xFE,
-	0xE8,0x75,0x5E,0x59,0x83,0x7E,0xFA,0x00,0x75,0x26,0x33,
-	0xC0,0x50,0x33,0xD2,0x50,0x52,0x56,0xE8,0x14,0x37,0x83,
-	0xC4,0x08,0x33,0xC0,0x50,0x33,0xD2,0x50,0x52,0x57,0xE8,
-	0x06,0x37,0x83,0xC4,0x08,0x57,0x56,0xE8,0x36,0xFF,0x59,
-	0x59,0x89,0x46,0xFA,0x56,0xE8,0x76,0x31,0x59,0x57,0xE8,
-	0x71,0x31,0x59,0x83,0x7E,0xFA,0x00,0x74,0x05,0xB8,0x01,
-	0x00,0xEB,0x09,0xFF,0x76,0x06,0xE8,0xCF,0x52,0x59,0x33,
-	0xC0,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x56,0x57,0x1E,
-	0x80,0x3E,0xE6,0x09,0xFF,0x75,0x32,0xC6,0x06,0xE6,0x09,
-	0x00,0xB8,0x00,0x43,0xCD,0x2F,0x3C,0x80,0x74,0x04,0x31,
-	0xC0,0xEB,0x20,0xB8,0x10,0x43,0xCD,0x2F,0x89,0x1E,0xE2,
-	0x09,0x8C,0x06,0xE4,0x09,0x30,0xE4,0x67,0xFF,0x1D,0xE2,
-	0x09,0x00,0x00,0x3D,0x00,0x02,0x72,0x05,0xC6,0x06,0xE6,
-	0x09,0x01,0x30,0xE4,0xA0,0xE6,0x09,0x1F,0x5F,0x5E,0x5D,
-	0xC3,0x55,0x56,0x57,0x1E,0x80,0x3E,0xE6,0x09,0x00,0x75,
-	0x06,0x31,0xC0,0x31,0xD2,0xEB,0x0F,0xB8,0x00,0x08,0x67,
-	0xFF,0x1D,0xE2,0x09,0x00,0x00,0xBB,0x00,0x04,0xF7,0xE3,
-	0x1F,0x5F,0x5E,0x5D,0xC3,0x55,0x89,0xE5,0x56,0x57,0x1E,
-	0x80,0x3E,0xE6,0x09,0x00,0x75,0x04,0x31,0xC0,0xEB,0x28,
-	0x8B,0x46,0x04,0x8B,0x56,0x06,0xBB,0x00,0x04,0xF7,0xF3,
-	0x83,0xFA,0x00,0x74,0x01,0x40,0x89,0xC2,0xB8,0x00,0x09,
-	0x67,0xFF,0x1D,0xE2,0x09,0x00,0x00,0x83,0xF8,0x01,0x74,
-	0x04,0x31,0xC0,0xEB,0x02,0x89,0xD0,0x1F,0x5F,0x5E,0x5D,
-	0xC3,0x55,0x89,0xE5,0x56,0x57,0x1E,0x80,0x3E,0xE6,0x09,
-	0x00,0x75,0x04,0x31,0xC0,0xEB,0x0D,0x8B,0x56,0x04,0xB8,
-	0x00,0x0A,0x67,0xFF,0x1D,0xE2,0x09,0x00,0x00,0x1F,0x5F,
-	0x5E,0x5D,0xC3,0x50,0xA3,0xE7,0x09,0xC7,0x06,0xE9,0x09,
-	0x00,0x00,0xBE,0xE7,0x09,0xB4,0x0B,0x67,0xFF,0x1D,0xE2,
-	0x09,0x00,0x00,0x5A,0x83,0xF8,0x00,0x74,0x02,0x89,0xD0,
-	0xC3,0x55,0x89,0xE5,0x56,0x57,0x1E,0x80,0x3E,0xE6,0x09,
-	0x00,0x75,0x04,0x31,0xC0,0xEB,0x29,0xC7,0x06,0xEB,0x09,
-	0x00,0x00,0x8B,0x46,0x04,0xA3,0xF1,0x09,0x8B,0x46,0x06,
-	0xA3,0xF3,0x09,0x8B,0x46,0x08,0xA3,0xF5,0x09,0x8B,0x46,
-	0x0A,0xA3,0xED,0x09,0x8C,0xD8,0xA3,0xEF,0x09,0x8B,0x46,
-	0x0C,0xE8,0xA7,0xFF,0x1F,0x5F,0x5E,0x5D,0xC3,0x55,0x89,
-	0xE5,0x56,0x57,0x1E,0x80,0x3E,0xE6,0x09,0x00,0x75,0x04,
-	0x31,0xC0,0xEB,0x29,0xC7,0x06,0xF1,0x09,0x00,0x00,0x8B,
-	0x46,0x04,0xA3,0xF3,0x09,0x8C,0xD8,0xA3,0xF5,0x09,0x8B,
-	0x46,0x06,0xA3,0xEB,0x09,0x8B,0x46,0x08,0xA3,0xED,0x09,
-	0x8B,0x46,0x0A,0xA3,0xEF,0x09,0x8B,0x46,0x0C,0xE8,0x68,
-	0xFF,0x1F,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x06,0x8D,0x46,0xFA,0x50,0x8D,0x46,0xFC,0x50,0x8D,0x46,
-	0xFE,0x50,0x33,0xC0,0x50,0xE8,0xDC,0x07,0x83,0xC4,0x08,
-	0x25,0x07,0x00,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0xEB,
-	0x03,0xE8,0x8E,0x48,0xE8,0xE2,0x4A,0x0B,0xC0,0x75,0xF6,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x06,0x56,0x33,0xF6,
-	0xEB,0x14,0x8D,0x46,0xFC,0x50,0x8D,0x46,0xFE,0x50,0x8D,
-	0x46,0xFA,0x50,0x56,0xE8,0xA6,0x07,0x83,0xC4,0x08,0x46,
-	0x83,0xFE,0x03,0x7C,0xE7,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xE8,0xD1,0xFF,0xE8,0xBD,0xFF,0xE8,0x98,0xFF,
-	0x0B,0xC0,0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x0A,0xE8,0x9B,
-	0x4A,0x0B,0xC0,0x74,0xED,0xE8,0x3D,0x48,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0xEC,0x2C,0x56,0x57,0x8B,0x76,0x04,0xA0,
-	0xA8,0x00,0x98,0x89,0x46,0xFE,0xE9,0xE6,0x06,0x83,0x7C,
-	0x0E,0x00,0x75,0x03,0xE9,0x9B,0x00,0xB8,0xFA,0x09,0x50,
-	0xE8,0xAA,0x39,0x59,0xB8,0xFB,0x09,0x50,0x33,0xC0,0x50,
-	0xB8,0x07,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x32,0x27,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x18,0x0A,0x50,0xE8,0xFF,0x36,0x59,0x59,0x8B,0x04,0x05,
-	0x41,0x00,0x50,0xB8,0x1B,0x0A,0x50,0xE8,0xF0,0x36,0x59,
-	0x59,0xB8,0x21,0x0A,0x50,0xB8,0x01,0x00,0x50,0xB8,0x07,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xFD,0x26,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,
-	0x50,0xE8,0xCA,0x36,0x59,0x59,0x8B,0x44,0x02,0x05,0x41,
-	0x00,0x50,0xB8,0x43,0x0A,0x50,0xE8,0xBA,0x36,0x59,0x59,
-	0xB8,0x4A,0x0A,0x50,0xB8,0x02,0x00,0x50,0xB8,0x07,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0xC7,0x26,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,
-	0xE8,0x94,0x36,0x59,0x59,0xE8,0x26,0xFF,0xC7,0x44,0x0E,
-	0x01,0x00,0x8D,0x46,0xF2,0x50,0xFF,0x34,0xE8,0x36,0x1A,
-	0x59,0x59,0x0B,0xC0,0x75,0x3E,0xB8,0xFA,0x09,0x50,0xE8,
-	0xFB,0x38,0x59,0xB8,0x67,0x0A,0x50,0xB8,0x03,0x00,0x50,
-	0xB8,0x07,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x82,0x26,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x18,0x0A,0x50,0xE8,0x4F,0x36,0x59,0x59,0xB8,0xFA,0x09,
-	0x50,0xE8,0xCD,0x38,0x59,0xB8,0x04,0x00,0x50,0xE8,0x18,
-	0x2D,0x59,0x8B,0x46,0xF4,0xF7,0x6E,0xF8,0x89,0x46,0xDC,
-	0xC7,0x46,0xDE,0x00,0x00,0x8B,0x5E,0xF6,0x33,0xC9,0x8B,
-	0x56,0xDE,0x8B,0x46,0xDC,0xE8,0x8D,0x5D,0x89,0x46,0xE4,
-	0x89,0x56,0xE6,0x8B,0x46,0xE4,0x0B,0x46,0xE6,0x75,0x3E,
-	0xB8,0xFA,0x09,0x50,0xE8,0x93,0x38,0x59,0xB8,0x9F,0x0A,
-	0x50,0xB8,0x04,0x00,0x50,0xB8,0x07,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x1A,0x26,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0xE7,0x35,
-	0x59,0x59,0xB8,0xFA,0x09,0x50,0xE8,0x65,0x38,0x59,0xB8,
-	0x04,0x00,0x50,0xE8,0xB0,0x2C,0x59,0x8D,0x46,0xEA,0x50,
-	0xFF,0x74,0x02,0xE8,0x80,0x19,0x59,0x59,0x0B,0xC0,0x75,
-	0x3E,0xB8,0xFA,0x09,0x50,0xE8,0x45,0x38,0x59,0xB8,0x9F,
-	0x0A,0x50,0xB8,0x04,0x00,0x50,0xB8,0x07,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xCC,0x25,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0x99,
-	0x35,0x59,0x59,0xB8,0xFA,0x09,0x50,0xE8,0x17,0x38,0x59,
-	0xB8,0x04,0x00,0x50,0xE8,0x62,0x2C,0x59,0x8B,0x46,0xF4,
-	0x3B,0x46,0xEC,0x75,0x13,0x8B,0x46,0xF6,0x3B,0x46,0xEE,
-	0x75,0x0B,0x8B,0x46,0xF8,0x3B,0x46,0xF0,0x75,0x03,0xE9,
-	0xCC,0x00,0xB8,0x1F,0x0A,0x50,0xE8,0xEC,0x37,0x59,0xB8,
-	0xD7,0x0A,0x50,0xB8,0x05,0x00,0x50,0xB8,0x07,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0x73,0x25,0x83,0xC4,0x08,0xA3,
-	0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,
-	0x40,0x35,0x59,0x59,0xB8,0x11,0x0B,0x50,0x33,0xC0,0x50,
-	0xB8,0x08,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x4E,0x25,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x18,0x0A,0x50,0xE8,0x1B,0x35,0x59,0x59,0x8B,0x04,0x05,
-	0x41,0x00,0x50,0xB8,0x41,0x0B,0x50,0xE8,0x0C,0x35,0x59,
-	0x59,0xB8,0x46,0x0B,0x50,0xB8,0x01,0x00,0x50,0xB8,0x08,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x19,0x25,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,
-	0x50,0xE8,0xE6,0x34,0x59,0x59,0x8B,0x44,0x02,0x05,0x41,
-	0x00,0x50,0xB8,0x1C,0x0A,0x50,0xE8,0xD6,0x34,0x59,0x59,
-	0xB8,0x49,0x0B,0x50,0xB8,0x02,0x00,0x50,0xB8,0x08,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0xE3,0x24,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,
-	0xE8,0xB0,0x34,0x59,0x59,0xB8,0xFA,0x09,0x50,0xE8,0x2E,
-	0x37,0x59,0xE8,0x3A,0xFD,0xE9,0x16,0xFE,0x83,0x7C,0x10,
-	0x00,0x74,0x14,0xB8,0x16,0x00,0x50,0xE8,0xA2,0x19,0x59,
-	0xFF,0x34,0xE8,0x8B,0x19,0x59,0x0B,0xC0,0x75,0x0A,0xEB,
-	0x00,0xB8,0x0B,0x00,0x50,0xE8,0x8E,0x19,0x59,0xFF,0x74,
-	0x08,0xE8,0x88,0x16,0x59,0x89,0x46,0xD8,0x89,0x56,0xDA,
-	0x33,0xC0,0x50,0xFF,0x76,0xF8,0x50,0xFF,0x76,0xF6,0xFF,
-	0x76,0xDA,0xFF,0x76,0xD8,0xE8,0xC0,0x57,0x52,0x50,0xE8,
-	0xBB,0x57,0x89,0x46,0xD4,0x89,0x56,0xD6,0xB8,0x1F,0x0A,
-	0x50,0xE8,0xD3,0x36,0x59,0xB8,0x64,0x0B,0x50,0x33,0xC0,
-	0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x5B,
-	0x24,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0x18,0x0A,0x50,0xE8,0x28,0x34,0x59,0x59,0xFF,0x76,
-	0xD6,0xFF,0x76,0xD4,0xB8,0x6C,0x0B,0x50,0xE8,0x19,0x34,
-	0x83,0xC4,0x06,0xB8,0x71,0x0B,0x50,0xB8,0x01,0x00,0x50,
-	0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x25,0x24,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x18,0x0A,0x50,0xE8,0xF2,0x33,0x59,0x59,0xFF,0x76,0xF8,
-	0xB8,0x7A,0x0B,0x50,0xE8,0xE6,0x33,0x59,0x59,0xB8,0x80,
-	0x0B,0x50,0xB8,0x02,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xF3,0x23,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0xC0,
-	0x33,0x59,0x59,0xFF,0x76,0xF6,0xB8,0x7A,0x0B,0x50,0xE8,
-	0xB4,0x33,0x59,0x59,0xB8,0x94,0x0B,0x50,0xB8,0x03,0x00,
-	0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xC1,
-	0x23,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0x18,0x0A,0x50,0xE8,0x8E,0x33,0x59,0x59,0xB8,0xFA,
-	0x09,0x50,0xE8,0x0C,0x36,0x59,0xB8,0xA6,0x0B,0x50,0xB8,
-	0x04,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0x93,0x23,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0x60,0x33,0x59,0x59,
-	0xFF,0x76,0xDA,0xFF,0x76,0xD8,0xB8,0xBD,0x0B,0x50,0xE8,
-	0x51,0x33,0x83,0xC4,0x06,0xB8,0xC3,0x0B,0x50,0xB8,0x05,
-	0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,
-	0x5D,0x23,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,
-	0x16,0xB8,0x18,0x0A,0x50,0xE8,0x2A,0x33,0x59,0x59,0xB8,
-	0xFA,0x09,0x50,0xE8,0xA8,0x35,0x59,0x8B,0x44,0x08,0xB1,
-	0x09,0xD3,0xE8,0x89,0x46,0xE8,0x8B,0x46,0xF4,0xF7,0x6E,
-	0xF8,0x89,0x46,0xE0,0xC7,0x46,0xE2,0x00,0x00,0xC7,0x46,
-	0xFC,0x00,0x00,0xE9,0xEE,0x01,0xB8,0xFA,0x09,0x50,0xE8,
-	0x80,0x35,0x59,0x83,0x7E,0xFC,0x00,0x75,0x09,0xB8,0xCA,
-	0x0B,0x50,0xB8,0x06,0x00,0xEB,0x07,0xB8,0xD8,0x0B,0x50,
-	0xB8,0x07,0x00,0x50,0xB8,0x09,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xF8,0x22,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0xC5,0x32,0x59,
-	0x59,0x33,0xFF,0xE9,0x94,0x01,0xFF,0x76,0xE8,0x8B,0xC7,
-	0x99,0x52,0x50,0xE8,0xD7,0x17,0x83,0xC4,0x06,0x0B,0xC0,
-	0x75,0x03,0xE9,0x7C,0x01,0x83,0x7C,0x14,0x00,0x74,0x14,
-	0xFF,0x76,0xF6,0xFF,0x74,0x04,0x57,0xFF,0x76,0xE8,0xFF,
-	0x34,0xE8,0xBD,0x0D,0x83,0xC4,0x0A,0xEB,0x4C,0xFF,0x74,
-	0x04,0x8B,0xC7,0x99,0x52,0x50,0xFF,0x76,0xE8,0xFF,0x34,
-	0xE8,0xA2,0x3D,0x83,0xC4,0x0A,0x0B,0xC0,0x74,0x35,0xB8,
-	0xFA,0x09,0x50,0xE8,0xF8,0x34,0x59,0xB8,0xE8,0x0B,0x50,
-	0xB8,0x07,0x00,0x50,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x82,
-	0x22,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,
-	0xB8,0x18,0x0A,0x50,0xE8,0x4F,0x32,0x59,0x59,0x57,0xB8,
-	0x08,0x0C,0x50,0xE8,0x45,0x32,0x59,0x59,0x0B,0xFF,0x75,
-	0x21,0x83,0x7E,0xFC,0x00,0x75,0x0E,0x83,0x7C,0x16,0x01,
-	0x75,0x15,0xFF,0x74,0x04,0xE8,0xDC,0x1F,0xEB,0x0C,0x83,
-	0x7C,0x16,0x01,0x75,0x07,0xFF,0x74,0x04,0xE8,0xB1,0x1F,
-	0x59,0x83,0x7E,0xFC,0x01,0x75,0x35,0xFF,0x74,0x06,0x8B,
-	0xC7,0x99,0x52,0x50,0xFF,0x76,0xE8,0xFF,0x74,0x02,0xE8,
-	0x2A,0x3D,0x83,0xC4,0x0A,0x0B,0xC0,0x75,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x89,0x46,0xFA,0x0B,0xFF,0x75,
-	0x31,0x83,0x7C,0x16,0x01,0x75,0x2B,0xFF,0x74,0x06,0xE8,
-	0x78,0x1F,0x59,0xEB,0x22,0xFF,0x74,0x04,0x8B,0xC7,0x99,
-	0x52,0x50,0xFF,0x76,0xE8,0xFF,0x74,0x02,0xE8,0x56,0x3D,
-	0x83,0xC4,0x0A,0x0B,0xC0,0x75,0x05,0xB8,0x01,0x00,0xEB,
-	0x02,0x33,0xC0,0x89,0x46,0xFA,0x83,0x7E,0xFA,0x00,0x75,
-	0x38,0xB8,0xFA,0x09,0x50,0xE8,0x3B,0x34,0x59,0xB8,0x0D,
-	0x0C,0x50,0xB8,0x08,0x00,0x50,0xB8,0x07,0x00,0x50,0xFF,
-	0x36,0x8A,0x16,0xE8,0xC2,0x21,0x83,0xC4,0x08,0xA3,0x80,
-	0x16,0xFF,0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0x8F,
-	0x31,0x59,0x59,0x57,0xB8,0x08,0x0C,0x50,0xE8,0x85,0x31,
-	0x59,0x59,0x83,0x7E,0xFC,0x01,0x75,0x50,0x8B,0x46,0xE8,
-	0xB1,0x09,0xD3,0xE0,0x50,0xFF,0x74,0x06,0xFF,0x74,0x04,
-	0xE8,0xC8,0x45,0x83,0xC4,0x06,0x0B,0xC0,0x74,0x38,0xB8,
-	0xFA,0x09,0x50,0xE8,0xE5,0x33,0x59,0xB8,0x2B,0x0C,0x50,
-	0xB8,0x25,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x6C,0x21,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0x18,0x0A,0x50,0xE8,0x39,0x31,0x59,
-	0x59,0x57,0xB8,0x43,0x0C,0x50,0xE8,0x2F,0x31,0x59,0x59,
-	0x03,0x7E,0xE8,0x8B,0xC7,0x99,0x3B,0x56,0xE2,0x73,0x03,
-	0xE9,0x61,0xFE,0x75,0x08,0x3B,0x46,0xE0,0x73,0x03,0xE9,
-	0x57,0xFE,0xFF,0x46,0xFC,0x83,0x7C,0x12,0x00,0x74,0x0F,
-	0x83,0x7E,0xFC,0x01,0x7F,0x05,0xB8,0x01,0x00,0xEB,0x02,
-	0x33,0xC0,0xEB,0x0D,0x83,0x7E,0xFC,0x01,0x7D,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0x0B,0xC0,0x74,0x03,0xE9,
-	0xE9,0xFD,0x83,0x7C,0x0A,0x00,0x74,0x08,0xB8,0x4A,0x0C,
-	0x50,0xE8,0xDC,0x30,0x59,0x83,0x7C,0x0C,0x00,0x74,0x06,
-	0xA0,0xA9,0x00,0x98,0xEB,0x05,0xA0,0xA9,0x00,0x98,0x40,
-	0x89,0x46,0xFE,0xA0,0xA8,0x00,0x98,0x3B,0x46,0xFE,0x75,
-	0x46,0xFF,0x46,0xFE,0xEB,0x41,0xB8,0x1F,0x0A,0x50,0xE8,
-	0x39,0x33,0x59,0xB8,0x4C,0x0C,0x50,0xB8,0x09,0x00,0x50,
-	0xB8,0x07,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xC0,0x20,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x18,0x0A,0x50,0xE8,0x8D,0x30,0x59,0x59,0xE8,0x7B,0x41,
-	0x50,0xE8,0xCD,0x39,0x59,0x89,0x46,0xFE,0xB8,0xFA,0x09,
-	0x50,0xE8,0x00,0x33,0x59,0xA0,0xA8,0x00,0x98,0x3B,0x46,
-	0xFE,0x74,0x09,0xA0,0xA9,0x00,0x98,0x3B,0x46,0xFE,0x75,
-	0xAD,0x83,0x7C,0x16,0x01,0x75,0x13,0xB8,0xFA,0x09,0x50,
-	0xE8,0xE0,0x32,0x59,0xE8,0x99,0x1E,0xB8,0xFA,0x09,0x50,
-	0xE8,0xD5,0x32,0x59,0xA0,0xA8,0x00,0x98,0x3B,0x46,0xFE,
-	0x75,0x03,0xE9,0x0E,0xF9,0x83,0x7C,0x0C,0x00,0x74,0x08,
-	0xB8,0xFA,0x09,0x50,0xE8,0xBB,0x32,0x59,0x5F,0x5E,0x8B,
-	0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0xE8,0x0B,0x3C,0x8B,
-	0xF0,0xF7,0xC6,0x01,0x00,0x74,0x11,0xB1,0x06,0xD3,0xF8,
-	0x25,0x03,0x00,0x3D,0x01,0x00,0x7C,0x05,0xB8,0x01,0x00,
-	0xEB,0x02,0x33,0xC0,0x5E,0x5D,0xC3,0x06,0xB8,0x33,0x35,
-	0xCD,0x21,0x31,0xC0,0x8C,0xC2,0x83,0xFA,0x00,0x75,0x07,
-	0x83,0xFB,0x00,0x75,0x02,0xEB,0x07,0xCD,0x33,0xF7,0xD8,
-	0xA2,0x7C,0x0C,0x07,0xC3,0x80,0x3E,0x7B,0x0C,0x00,0x75,
-	0x08,0xC6,0x06,0x7B,0x0C,0x01,0xE8,0xD2,0xFF,0xA0,0x7C,
-	0x0C,0x30,0xE4,0x83,0xF8,0x00,0xC3,0x55,0x89,0xE5,0xE8,
-	0xE2,0xFF,0x75,0x1A,0xB8,0x00,0x00,0x8B,0x5E,0x06,0xC7,
-	0x07,0x00,0x00,0x8B,0x5E,0x08,0xC7,0x07,0x00,0x00,0x8B,
-	0x5E,0x0A,0xC7,0x07,0x00,0x00,0xEB,0x27,0x57,0xB8,0x05,
-	0x00,0x8B,0x5E,0x04,0xCD,0x33,0xD1,0xE9,0xD1,0xE9,0xD1,
-	0xE9,0x41,0xD1,0xEA,0xD1,0xEA,0xD1,0xEA,0x42,0x8B,0x7E,
-	0x06,0x89,0x1D,0x8B,0x7E,0x08,0x89,0x0D,0x8B,0x7E,0x0A,
-	0x89,0x15,0x5F,0x5D,0xC3,0xB8,0x00,0x37,0xCD,0x21,0x88,
-	0xD0,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x06,0x83,
-	0x3E,0xF6,0x0C,0x00,0x74,0x03,0xE9,0xCF,0x00,0xC7,0x06,
-	0xF6,0x0C,0x01,0x00,0xB8,0xCF,0x0D,0x50,0xE8,0xA4,0x40,
-	0x59,0x8B,0xF8,0x0B,0xFF,0x75,0x0A,0xB8,0xD7,0x0D,0x50,
-	0xE8,0x96,0x40,0x59,0x8B,0xF8,0x0B,0xFF,0x74,0x6B,0x57,
-	0xB8,0x2C,0x17,0x50,0xE8,0xF8,0x47,0x59,0x59,0xB8,0x2C,
-	0x17,0x50,0xE8,0x53,0x48,0x59,0x8B,0xD8,0x80,0xBF,0x2C,
-	0x17,0x5C,0x74,0x1E,0xB8,0x2C,0x17,0x50,0xE8,0x42,0x48,
-	0x59,0x8B,0xD8,0xC6,0x87,0x2D,0x17,0x00,0xB8,0x2C,0x17,
-	0x50,0xE8,0x33,0x48,0x59,0x8B,0xD8,0xC6,0x87,0x2C,0x17,
-	0x5C,0xB8,0x02,0x00,0x50,0x57,0xE8,0x44,0x1A,0x59,0x59,
-	0xB8,0x02,0x00,0x50,0xE8,0xB7,0x1A,0x59,0x50,0x56,0xE8,
-	0xB0,0x47,0x59,0x59,0xB8,0xDF,0x0D,0x50,0x56,0xE8,0x08,
-	0x47,0x59,0x59,0x33,0xC0,0x50,0x56,0xE8,0x53,0x23,0x59,
-	0x59,0x0B,0xC0,0x74,0x02,0x33,0xFF,0x0B,0xFF,0x75,0x3E,
-	0xB8,0x80,0x00,0x50,0x56,0xE8,0x0C,0x0B,0x59,0x59,0x56,
-	0xB8,0x2C,0x17,0x50,0xE8,0x7F,0x47,0x59,0x59,0x80,0x3C,
-	0x00,0x75,0x04,0x33,0xC0,0xEB,0x36,0xB8,0x80,0x00,0x50,
-	0xB8,0xDF,0x0D,0x50,0x56,0xE8,0x7E,0x36,0x83,0xC4,0x06,
-	0x33,0xC0,0x50,0x56,0xE8,0x14,0x23,0x59,0x59,0x0B,0xC0,
-	0x74,0x05,0xC6,0x06,0x2C,0x17,0x00,0xB8,0x2C,0x17,0x50,
-	0x56,0xE8,0x4B,0x47,0x59,0x59,0xFF,0x76,0x04,0x56,0xE8,
-	0xA4,0x46,0x59,0x59,0x8B,0xC6,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x81,0xEC,0x84,0x00,0x56,0x57,0x8B,0x7E,0x04,
-	0x0B,0xFF,0x75,0x10,0x8D,0x86,0x7C,0xFF,0x50,0xB8,0xDF,
-	0x0D,0x50,0xE8,0xEA,0xFE,0x59,0x59,0x8B,0xF8,0x33,0xC0,
-	0x50,0x57,0xE8,0xC9,0x22,0x59,0x59,0x0B,0xC0,0x74,0x04,
-	0x33,0xC0,0xEB,0x57,0xB8,0xEC,0x0D,0x50,0x57,0xE8,0xD6,
-	0x29,0x59,0x59,0x89,0x46,0xFC,0x0B,0xC0,0x74,0x05,0xA3,
-	0xF4,0x0C,0xEB,0x05,0xB8,0xFF,0xFF,0xEB,0x3C,0xB8,0xAE,
-	0x17,0xA3,0xAC,0x17,0xA3,0xBA,0x17,0x33,0xF6,0xEB,0x27,
-	0xFF,0x36,0xF4,0x0C,0xE8,0x64,0x3E,0x59,0x89,0x46,0xFE,
-	0x83,0x7E,0xFE,0xFF,0x75,0x08,0xC7,0x06,0xF8,0x0C,0x01,
-	0x00,0xEB,0x13,0x8B,0x1E,0xAC,0x17,0x8A,0x46,0xFE,0x88,
-	0x07,0xFF,0x06,0xAC,0x17,0x46,0x83,0xFE,0x0C,0x7C,0xD4,
-	0xB8,0x01,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x83,0x3E,0xF4,0x0C,0x00,0x74,0x08,0xFF,0x36,0xF4,
-	0x0C,0xE8,0x0C,0x26,0x59,0xC7,0x06,0xF4,0x0C,0x00,0x00,
-	0x5D,0xC3,0x55,0x8B,0xEC,0xC7,0x06,0xF8,0x0C,0x00,0x00,
-	0xE8,0xDA,0xFF,0xFF,0x76,0x04,0xE8,0x46,0xFF,0x59,0xB8,
-	0xAE,0x17,0xA3,0xAC,0x17,0xA3,0xBA,0x17,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0xEC,0x04,0xA1,0xBA,0x17,0x3B,0x06,0xAC,
-	0x17,0x75,0x04,0x33,0xC0,0xEB,0x57,0x8D,0x46,0xFC,0x50,
-	0x8D,0x46,0xFE,0x50,0xE8,0x81,0x00,0x59,0x59,0x83,0x7E,
-	0xFE,0x00,0x75,0x08,0xC7,0x06,0xF8,0x0C,0x01,0x00,0xEB,
-	0xE1,0x83,0x7E,0xFE,0xFF,0x74,0x33,0xFF,0x76,0xFC,0xB8,
-	0xAE,0x17,0x50,0xB8,0xBC,0x17,0x50,0xE8,0x01,0x42,0x83,
-	0xC4,0x06,0x8B,0x5E,0xFC,0xC6,0x87,0xBC,0x17,0x00,0x83,
-	0x3E,0xF8,0x0C,0x00,0x74,0x09,0x8B,0x46,0xFC,0x01,0x06,
-	0xBA,0x17,0xEB,0x0A,0xFF,0x76,0xFC,0xE8,0xED,0x01,0x59,
-	0xA3,0xF8,0x0C,0x8B,0x46,0xFE,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0xEC,0x04,0x56,0x8B,0x36,0x7E,0x0C,0xA1,
-	0xBA,0x17,0x3B,0x06,0xAC,0x17,0x75,0x04,0x33,0xC0,0xEB,
-	0x14,0x8D,0x46,0xFC,0x50,0x8D,0x46,0xFE,0x50,0xE8,0x0E,
-	0x00,0x59,0x59,0x89,0x36,0x7E,0x0C,0x8B,0x46,0xFE,0x5E,
-	0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0x8B,0x7E,0x04,0x8B,0x76,0x06,0xB8,0xEF,0x0D,0x50,0xE8,
-	0x5D,0x01,0x59,0x0B,0xC0,0x74,0x12,0xE8,0xDF,0x01,0x0B,
-	0xC0,0x74,0x0B,0xC7,0x05,0x00,0x00,0xC7,0x04,0x00,0x00,
-	0xE9,0x0B,0x01,0xB8,0xF1,0x0D,0x50,0xE8,0x3F,0x01,0x59,
-	0x0B,0xC0,0x74,0x07,0xC7,0x05,0x01,0x00,0xE9,0xAD,0x00,
-	0xB8,0xF5,0x0D,0x50,0xE8,0x07,0x01,0x59,0x0B,0xC0,0x74,
-	0x0F,0xFF,0x06,0x7E,0x0C,0xC7,0x04,0x02,0x00,0xC7,0x05,
-	0x19,0x00,0xE9,0xDD,0x00,0xB8,0xF6,0x0D,0x50,0xE8,0x11,
-	0x01,0x59,0x0B,0xC0,0x74,0x0F,0xFF,0x06,0x7E,0x0C,0xC7,
-	0x04,0x01,0x00,0xC7,0x05,0x19,0x00,0xE9,0xC2,0x00,0xB8,
-	0xF8,0x0D,0x50,0xE8,0xF6,0x00,0x59,0x0B,0xC0,0x74,0x0F,
-	0xC7,0x04,0x01,0x00,0xFF,0x06,0x7E,0x0C,0xC7,0x05,0x19,
-	0x00,0xE9,0xA7,0x00,0xB8,0xFA,0x0D,0x50,0xE8,0xDB,0x00,
-	0x59,0x0B,0xC0,0x74,0x06,0xC7,0x05,0x02,0x00,0xEB,0x4A,
-	0xB8,0xFC,0x0D,0x50,0xE8,0xA4,0x00,0x59,0x0B,0xC0,0x74,
-	0x06,0xC7,0x05,0x1F,0x00,0xEB,0x22,0xB8,0xFF,0x0D,0x50,
-	0xE8,0xB7,0x00,0x59,0x0B,0xC0,0x74,0x06,0xC7,0x05,0x1F,
-	0x00,0xEB,0x26,0xB8,0x01,0x0E,0x50,0xE8,0x80,0x00,0x59,
-	0x0B,0xC0,0x74,0x0A,0xC7,0x05,0x20,0x00,0xC7,0x04,0x02,
-	0x00,0xEB,0x5B,0xB8,0x02,0x0E,0x50,0xE8,0x6A,0x00,0x59,
-	0x0B,0xC0,0x74,0x0A,0xC7,0x05,0x20,0x00,0xC7,0x04,0x01,
-	0x00,0xEB,0x45,0xC7,0x46,0xFE,0x00,0x00,0xEB,0x30,0x8B,
-	0x5E,0xFE,0xD1,0xE3,0xFF,0xB7,0x80,0x0C,0xE8,0x48,0x00,
-	0x59,0x0B,0xC0,0x74,0x1C,0x8B,0x5E,0xFE,0xD1,0xE3,0xFF,
-	0xB7,0x80,0x0C,0xE8,0x24,0x45,0x59,0x89,0x04,0x8B,0x5E,
-	0xFE,0xD1,0xE3,0x8B,0x87,0xBA,0x0C,0x89,0x05,0xEB,0x11,
-	0xFF,0x46,0xFE,0x83,0x7E,0xFE,0x1D,0x7C,0xCA,0xC7,0x04,
-	0x00,0x00,0xC7,0x05,0xFF,0xFF,0x5F,0x5E,0x8B,0xE5,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xB8,0xBC,0x17,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xA1,0x7E,0x0C,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,
-	0x04,0xE8,0xE4,0x44,0x59,0x50,0xFF,0x36,0xBA,0x17,0xFF,
-	0x76,0x04,0xE8,0xF2,0x44,0x83,0xC4,0x06,0x0B,0xC0,0x75,
-	0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x04,0xEB,0x10,0x8B,0x1E,0xBA,
-	0x17,0x8A,0x07,0x3A,0x04,0x75,0x05,0xB8,0x01,0x00,0xEB,
-	0x08,0x46,0x80,0x3C,0x00,0x75,0xEB,0x33,0xC0,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0xBE,0xAE,0x17,0xEB,0x0B,0x8A,
-	0x04,0x98,0x50,0xE8,0xC4,0x34,0x59,0x88,0x04,0x46,0x3B,
-	0x36,0xAC,0x17,0x75,0xEF,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x56,0x57,0x33,0xFF,0xBE,0xAE,0x17,0xEB,0x08,0x8B,0x5E,
-	0x04,0x8A,0x00,0x88,0x04,0x46,0xB8,0x0C,0x00,0x2B,0x46,
-	0x04,0x05,0xAE,0x17,0x3B,0xC6,0x75,0xEB,0xEB,0x18,0xFF,
-	0x36,0xF4,0x0C,0xE8,0x84,0x3B,0x59,0x88,0x04,0x3C,0xFF,
-	0x75,0x09,0x89,0x36,0xAC,0x17,0xBF,0x01,0x00,0xEB,0x07,
-	0x46,0x3B,0x36,0xAC,0x17,0x75,0xE2,0xE8,0x9F,0xFF,0x8B,
-	0xC7,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,
-	0x36,0xBA,0x17,0x83,0x3E,0xF8,0x0C,0x00,0x74,0x50,0xEB,
-	0x17,0x8B,0x1E,0xBA,0x17,0x80,0x3F,0x0A,0x74,0x05,0x80,
-	0x3F,0x0D,0x75,0x05,0x33,0xC0,0xE9,0xAD,0x00,0xFF,0x06,
-	0xBA,0x17,0xA1,0xBA,0x17,0x3B,0x06,0xAC,0x17,0x75,0xE0,
-	0xEB,0x70,0x80,0x3C,0x0A,0x75,0x08,0x8B,0xC6,0x2D,0xAE,
-	0x17,0xE9,0x8C,0x00,0x80,0x3C,0x0D,0x75,0x19,0x8B,0xC6,
-	0x40,0x3B,0x06,0xAC,0x17,0x74,0x06,0x80,0x7C,0x01,0x0A,
-	0x74,0x02,0xEB,0xE2,0x8B,0xC6,0x2D,0xAE,0x17,0x40,0xEB,
-	0x6E,0x46,0x3B,0x36,0xAC,0x17,0x75,0xCE,0xFF,0x36,0xF4,
-	0x0C,0xE8,0xF7,0x3A,0x59,0x8B,0xF8,0x3D,0xFF,0xFF,0x74,
-	0x0A,0x83,0xFF,0x0A,0x74,0x05,0x83,0xFF,0x0D,0x75,0xE7,
-	0x83,0xFF,0xFF,0x75,0x02,0xEB,0x1E,0x83,0xFF,0x0D,0x75,
-	0x37,0xFF,0x36,0xF4,0x0C,0xE8,0xD2,0x3A,0x59,0x8B,0x1E,
-	0xAC,0x17,0x88,0x47,0xFF,0x8B,0x1E,0xAC,0x17,0x80,0x7F,
-	0xFF,0xFF,0x75,0x05,0xB8,0x01,0x00,0xEB,0x29,0x8B,0x1E,
-	0xAC,0x17,0x80,0x7F,0xFF,0x0A,0x75,0x02,0xEB,0x15,0x8B,
-	0x1E,0xAC,0x17,0xC6,0x47,0xFE,0x0A,0xB8,0x0A,0x00,0xEB,
-	0x0B,0x8B,0x1E,0xAC,0x17,0xC6,0x47,0xFF,0x0A,0xB8,0x0B,
-	0x00,0x50,0xE8,0xE5,0xFE,0x59,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0xE8,0x7D,0x02,0xB8,0xCA,0x17,0x50,0xE8,
-	0xBD,0x06,0x59,0x0B,0xC0,0x74,0x02,0xEB,0x24,0xFF,0x76,
-	0x04,0xE8,0xAF,0xFB,0x59,0x8B,0xF0,0x0B,0xC0,0x7F,0x02,
-	0xEB,0x18,0xE8,0x41,0x00,0x83,0x3E,0xE4,0x17,0x00,0x74,
-	0x08,0xB8,0xCA,0x17,0x50,0xE8,0xDF,0x06,0x59,0xE8,0x1F,
-	0xFC,0xB8,0x01,0x00,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0xB8,
-	0xCA,0x17,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0xE8,0xB0,0xFC,
-	0x8B,0xF0,0x83,0xFE,0x01,0x74,0x0B,0x83,0x7E,0x04,0x00,
-	0x74,0x0A,0x83,0xFE,0x19,0x75,0x05,0xE8,0x2D,0xFC,0xEB,
-	0xE6,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0xB8,0x01,0x00,0x50,0xE8,0xD1,0xFF,0x59,0xE8,0x16,0xFC,
-	0x8B,0xF0,0x0B,0xF6,0x75,0x03,0xE9,0x8E,0x00,0x83,0xFE,
-	0x1F,0x74,0x03,0xE8,0x42,0x01,0x33,0xC0,0x50,0xE8,0xB6,
-	0xFF,0x59,0xE8,0xFB,0xFB,0x8B,0xF0,0xC7,0x46,0xFE,0x00,
-	0x00,0x33,0xFF,0xEB,0x17,0x8B,0xC7,0xBA,0x06,0x00,0xF7,
-	0xEA,0x8B,0xD8,0x39,0xB7,0x3E,0x0E,0x75,0x07,0xC7,0x46,
-	0xFE,0x01,0x00,0xEB,0x06,0x47,0x83,0xFF,0x03,0x7C,0xE4,
-	0x83,0x7E,0xFE,0x00,0x75,0x03,0xE8,0x08,0x01,0x33,0xC0,
-	0x50,0xE8,0x7C,0xFF,0x59,0xE8,0xC1,0xFB,0x8B,0xF0,0x83,
-	0xFE,0x20,0x74,0x03,0xE8,0xF4,0x00,0x33,0xC0,0x50,0xE8,
-	0x68,0xFF,0x59,0x0B,0xF6,0x74,0x2D,0xE8,0xA9,0xFB,0x3D,
-	0x19,0x00,0x74,0x03,0xE8,0xDE,0x00,0x8B,0xC7,0xBA,0x06,
-	0x00,0xF7,0xEA,0x8B,0xD8,0xFF,0xB7,0x3C,0x0E,0x8B,0xC7,
-	0xBA,0x06,0x00,0xF7,0xEA,0x8B,0xD8,0xFF,0xB7,0x40,0x0E,
-	0xE8,0x0B,0x00,0x59,0x59,0xE9,0x5E,0xFF,0x5F,0x5E,0x8B,
-	0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,0xB8,
-	0x01,0x00,0x50,0xE8,0x22,0xFF,0x59,0xE8,0xD5,0xFB,0x8B,
-	0xF0,0xC7,0x46,0xFE,0x00,0x00,0x33,0xFF,0xEB,0x17,0x8B,
-	0xC7,0xD1,0xE0,0xD1,0xE0,0x8B,0x5E,0x04,0x03,0xD8,0x39,
-	0x37,0x75,0x07,0xC7,0x46,0xFE,0x01,0x00,0xEB,0x06,0x47,
-	0x3B,0x7E,0x06,0x7C,0xE4,0x83,0x7E,0xFE,0x00,0x74,0x71,
-	0xE8,0x37,0xFB,0x33,0xC0,0x50,0xE8,0xE8,0xFE,0x59,0xE8,
-	0x2D,0xFB,0x8B,0xF0,0x83,0xFE,0xFF,0x75,0x03,0xE8,0x60,
-	0x00,0x83,0xFE,0x19,0x74,0xAC,0x0B,0xF6,0x74,0xA8,0x83,
-	0xFE,0x02,0x75,0x1B,0x33,0xC0,0x50,0xE8,0xC6,0xFE,0x59,
-	0xE8,0x79,0xFB,0x8B,0xF0,0x83,0xFE,0x19,0x74,0x1A,0x0B,
-	0xF6,0x74,0x16,0xE8,0xFD,0xFA,0x50,0xEB,0x01,0x56,0x8B,
-	0xC7,0xD1,0xE0,0xD1,0xE0,0x8B,0x5E,0x04,0x03,0xD8,0xFF,
-	0x57,0x02,0x59,0x33,0xC0,0x50,0xE8,0x9B,0xFE,0x59,0xE8,
-	0xE0,0xFA,0x8B,0xF0,0x3D,0x19,0x00,0x75,0x03,0xE9,0x64,
-	0xFF,0x0B,0xF6,0x75,0x03,0xE9,0x5D,0xFF,0xE8,0x09,0x00,
-	0xE9,0x57,0xFF,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xB8,0x4E,0x0E,0x50,0x33,0xC0,0x50,0xB8,0x06,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x8E,0x18,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x63,0x0E,0x50,
-	0xE8,0x5B,0x28,0x59,0x59,0xE8,0x7B,0xFC,0x50,0xB8,0x66,
-	0x0E,0x50,0xE8,0x4E,0x28,0x59,0x59,0xB8,0x6B,0x0E,0x50,
-	0xB8,0x01,0x00,0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0x5B,0x18,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0x63,0x0E,0x50,0xE8,0x28,0x28,0x59,
-	0x59,0xB8,0x62,0x0E,0x50,0xE8,0xA6,0x2A,0x59,0xE8,0x25,
-	0xFA,0xB8,0x04,0x00,0x50,0xE8,0xEE,0x1E,0x59,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xB8,0x82,0x0E,0x50,0xB8,0x02,0x00,0x50,
-	0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x1D,0x18,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x63,0x0E,0x50,0xE8,0xEA,0x27,0x59,0x59,0xFF,0x76,0x04,
-	0xE8,0x07,0xFC,0x50,0xB8,0xA7,0x0E,0x50,0xE8,0xDA,0x27,
-	0x83,0xC4,0x06,0xE8,0xDE,0xF9,0xB8,0x04,0x00,0x50,0xE8,
-	0xA7,0x1E,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xC7,0x06,0xCA,
-	0x17,0x01,0x00,0xC7,0x06,0xCC,0x17,0x01,0x00,0xC7,0x06,
-	0xCE,0x17,0x01,0x00,0xC7,0x06,0xD0,0x17,0x00,0x00,0xC7,
-	0x06,0xD2,0x17,0x00,0x00,0xC7,0x06,0xD4,0x17,0x00,0x00,
-	0xC7,0x06,0xD6,0x17,0x00,0x00,0xC7,0x06,0xD8,0x17,0x00,
-	0x00,0xC7,0x06,0xDA,0x17,0x01,0x00,0xC7,0x06,0xDE,0x17,
-	0x00,0x00,0xC7,0x06,0xE4,0x17,0x00,0x00,0xC7,0x06,0xE0,
-	0x17,0x0B,0x00,0xC7,0x06,0xDC,0x17,0x01,0x00,0xC7,0x06,
-	0xE2,0x17,0x01,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,
-	0x8B,0x76,0x04,0x8B,0x7E,0x06,0xB9,0x04,0x00,0xBB,0xBE,
-	0x3C,0x2E,0x39,0x3F,0x74,0x06,0x43,0x43,0xE2,0xF7,0xEB,
-	0x19,0x2E,0xFF,0x67,0x08,0xC7,0x04,0x01,0x00,0xEB,0x2A,
-	0xC7,0x04,0x00,0x00,0xEB,0x24,0xB8,0xB3,0x0E,0x50,0xB8,
-	0x03,0x00,0xEB,0x07,0xB8,0xD2,0x0E,0x50,0xB8,0x04,0x00,
-	0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x4B,
-	0x17,0x83,0xC4,0x08,0x50,0xE8,0x11,0xFF,0x59,0x5F,0x5E,
-	0x5D,0xC3,0x02,0x00,0x03,0x00,0x04,0x00,0x19,0x00,0x96,
-	0x3C,0x8A,0x3C,0x90,0x3C,0xBA,0x3C,0x55,0x8B,0xEC,0xFF,
-	0x76,0x04,0xB8,0xCC,0x17,0x50,0xE8,0x8F,0xFF,0x59,0x59,
-	0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,0xB8,0xCA,0x17,
-	0x50,0xE8,0x7E,0xFF,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,
-	0xFF,0x76,0x04,0xB8,0xCE,0x17,0x50,0xE8,0x6D,0xFF,0x59,
-	0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,0xB8,0xDC,
-	0x17,0x50,0xE8,0x5C,0xFF,0x59,0x59,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xFF,0x76,0x04,0xB8,0xD0,0x17,0x50,0xE8,0x4B,0xFF,
-	0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,0xB8,
-	0xD2,0x17,0x50,0xE8,0x3A,0xFF,0x59,0x59,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xFF,0x76,0x04,0xB8,0xD4,0x17,0x50,0xE8,0x29,
-	0xFF,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,
-	0xB8,0xD8,0x17,0x50,0xE8,0x18,0xFF,0x59,0x59,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x04,0xB8,0xDA,0x17,0x50,0xE8,
-	0x07,0xFF,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x04,0xB9,0x04,0x00,0xBB,0xBA,0x3D,0x2E,0x39,0x37,
-	0x74,0x06,0x43,0x43,0xE2,0xF7,0xEB,0x1D,0x2E,0xFF,0x67,
-	0x08,0xC7,0x06,0xD6,0x17,0x00,0x00,0xEB,0x2C,0xC7,0x06,
-	0xD6,0x17,0x01,0x00,0xEB,0x24,0xB8,0xB3,0x0E,0x50,0xB8,
-	0x03,0x00,0xEB,0x07,0xB8,0xE9,0x0E,0x50,0xB8,0x05,0x00,
-	0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x4E,
-	0x16,0x83,0xC4,0x08,0x50,0xE8,0x14,0xFE,0x59,0x5E,0x5D,
-	0xC3,0x02,0x00,0x05,0x00,0x06,0x00,0x19,0x00,0x93,0x3D,
-	0x8B,0x3D,0x83,0x3D,0xB7,0x3D,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x04,0xB9,0x04,0x00,0xBB,0x1D,0x3E,0x2E,0x39,0x37,
-	0x74,0x06,0x43,0x43,0xE2,0xF7,0xEB,0x1D,0x2E,0xFF,0x67,
-	0x08,0xC7,0x06,0xDE,0x17,0x01,0x00,0xEB,0x2C,0xC7,0x06,
-	0xDE,0x17,0x00,0x00,0xEB,0x24,0xB8,0xB3,0x0E,0x50,0xB8,
-	0x03,0x00,0xEB,0x07,0xB8,0x06,0x0F,0x50,0xB8,0x06,0x00,
-	0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xEB,
-	0x15,0x83,0xC4,0x08,0x50,0xE8,0xB1,0xFD,0x59,0x5E,0x5D,
-	0xC3,0x02,0x00,0x17,0x00,0x18,0x00,0x19,0x00,0xF6,0x3D,
-	0xE6,0x3D,0xEE,0x3D,0x1A,0x3E,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x04,0xB9,0x04,0x00,0xBB,0x80,0x3E,0x2E,0x39,0x37,
-	0x74,0x06,0x43,0x43,0xE2,0xF7,0xEB,0x1D,0x2E,0xFF,0x67,
-	0x08,0xC7,0x06,0xE0,0x17,0x0B,0x00,0xEB,0x2C,0xC7,0x06,
-	0xE0,0x17,0x16,0x00,0xEB,0x24,0xB8,0xB3,0x0E,0x50,0xB8,
-	0x03,0x00,0xEB,0x07,0xB8,0x26,0x0F,0x50,0xB8,0x07,0x00,
-	0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x88,
-	0x15,0x83,0xC4,0x08,0x50,0xE8,0x4E,0xFD,0x59,0x5E,0x5D,
-	0xC3,0x02,0x00,0x19,0x00,0x1C,0x00,0x1D,0x00,0x59,0x3E,
-	0x7D,0x3E,0x51,0x3E,0x49,0x3E,0x55,0x8B,0xEC,0xFF,0x76,
-	0x04,0xB8,0xE4,0x17,0x50,0xE8,0xCD,0xFD,0x59,0x59,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x04,0xB9,0x04,0x00,
-	0xBB,0xF4,0x3E,0x2E,0x39,0x37,0x74,0x06,0x43,0x43,0xE2,
-	0xF7,0xEB,0x1D,0x2E,0xFF,0x67,0x08,0xC7,0x06,0xE2,0x17,
-	0x01,0x00,0xEB,0x2C,0xC7,0x06,0xE2,0x17,0x00,0x00,0xEB,
-	0x24,0xB8,0xB3,0x0E,0x50,0xB8,0x03,0x00,0xEB,0x07,0xB8,
-	0x40,0x0F,0x50,0xB8,0x08,0x00,0x50,0xB8,0x06,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0x14,0x15,0x83,0xC4,0x08,0x50,
-	0xE8,0xDA,0xFC,0x59,0x5E,0x5D,0xC3,0x02,0x00,0x15,0x00,
-	0x16,0x00,0x19,0x00,0xCD,0x3E,0xBD,0x3E,0xC5,0x3E,0xF1,
-	0x3E,0x55,0x8B,0xEC,0x83,0xEC,0x06,0x56,0x57,0x8B,0x76,
-	0x08,0xFF,0x76,0x0A,0x8B,0xC6,0x99,0x52,0x50,0xFF,0x76,
-	0x06,0xFF,0x76,0x04,0xE8,0xDE,0x2F,0x83,0xC4,0x0A,0x0B,
-	0xC0,0x75,0x03,0xE9,0xD9,0x00,0xB8,0x5E,0x0F,0x50,0xE8,
-	0x31,0x27,0x59,0xB8,0x5F,0x0F,0x50,0xB8,0x0A,0x00,0x50,
-	0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xB8,0x14,
-	0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,
-	0x8C,0x0F,0x50,0xE8,0x85,0x24,0x59,0x59,0xB8,0x5E,0x0F,
-	0x50,0xE8,0x03,0x27,0x59,0xC7,0x46,0xFE,0x00,0x00,0xE9,
-	0x90,0x00,0xC7,0x46,0xFC,0x00,0x00,0xFF,0x76,0x0A,0x8B,
-	0xC6,0x99,0x52,0x50,0xB8,0x01,0x00,0x50,0xFF,0x76,0x04,
-	0xE8,0x7F,0x2F,0x83,0xC4,0x0A,0x3D,0xFF,0xFF,0x75,0x61,
-	0xBF,0x01,0x00,0xEB,0x21,0xFF,0x76,0x0A,0x8B,0xC6,0x99,
-	0x52,0x50,0xB8,0x01,0x00,0x50,0xFF,0x76,0x04,0xE8,0x60,
-	0x2F,0x83,0xC4,0x0A,0x0B,0xC0,0x75,0x07,0xC7,0x46,0xFC,
-	0x01,0x00,0xEB,0x06,0x47,0x83,0xFF,0x03,0x7C,0xDA,0x83,
-	0x7E,0xFC,0x00,0x75,0x30,0xB8,0x8F,0x0F,0x50,0xB8,0x0B,
-	0x00,0x50,0xB8,0x06,0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,
-	0x32,0x14,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,
-	0x16,0xB8,0x8C,0x0F,0x50,0xE8,0xFF,0x23,0x59,0x59,0x56,
-	0xB8,0xAD,0x0F,0x50,0xE8,0xF5,0x23,0x59,0x59,0x46,0x8B,
-	0x46,0x0A,0x89,0x46,0xFA,0x8B,0x46,0x0C,0x01,0x46,0xFA,
-	0xFF,0x46,0xFE,0x8B,0x46,0xFE,0x3B,0x46,0x06,0x7D,0x03,
-	0xE9,0x65,0xFF,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x8B,0x46,0x04,0xA3,0xE6,0x17,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x57,0x8B,0x7E,0x04,0xFF,0x36,0xE6,0x17,0xE8,
-	0xD2,0x3C,0x59,0x3B,0x46,0x06,0x76,0x03,0xC6,0x05,0x00,
-	0xFF,0x36,0xE6,0x17,0x57,0xE8,0x5D,0x3C,0x59,0x59,0x57,
-	0xE8,0xBB,0x3C,0x59,0x48,0x8B,0xF0,0xEB,0x10,0x8B,0xDE,
-	0x80,0x39,0x5C,0x75,0x08,0x8B,0xDF,0xC6,0x40,0x01,0x00,
-	0xEB,0x05,0x4E,0x0B,0xF6,0x7D,0xEC,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x81,0xEC,0x00,0x01,0x8D,0x46,0x80,0x50,
-	0xB8,0xB4,0x0F,0x50,0xE8,0xF3,0xF3,0x59,0x59,0x8D,0x86,
-	0x00,0xFF,0x50,0xB8,0xC1,0x0F,0x50,0xE8,0xE5,0xF3,0x59,
-	0x59,0x8D,0x86,0x00,0xFF,0x50,0x8D,0x46,0x80,0x50,0xE8,
-	0x64,0x00,0x59,0x59,0x0B,0xC0,0x74,0x0F,0xFF,0x76,0x04,
-	0x8D,0x86,0x00,0xFF,0x50,0xE8,0x4C,0x03,0x59,0x59,0xEB,
-	0x02,0x33,0xC0,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x81,
-	0xEC,0x00,0x01,0x8D,0x46,0x80,0x50,0xB8,0xB4,0x0F,0x50,
-	0xE8,0xAA,0xF3,0x59,0x59,0x8D,0x86,0x00,0xFF,0x50,0xB8,
-	0xC1,0x0F,0x50,0xE8,0x9C,0xF3,0x59,0x59,0x8D,0x86,0x00,
-	0xFF,0x50,0x8D,0x46,0x80,0x50,0xE8,0x1B,0x00,0x59,0x59,
-	0x0B,0xC0,0x74,0x04,0x33,0xC0,0xEB,0x0D,0xFF,0x76,0x04,
-	0x8D,0x86,0x00,0xFF,0x50,0xE8,0xAB,0x01,0x59,0x59,0x8B,
-	0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x0A,0x56,0x57,
-	0xB8,0x01,0x00,0x50,0xFF,0x76,0x04,0xE8,0x74,0x38,0x59,
-	0x59,0x8B,0xF8,0x83,0xFF,0xFF,0x75,0x05,0x33,0xC0,0xE9,
-	0x6A,0x01,0xB8,0x01,0x00,0x50,0xFF,0x76,0x06,0xE8,0x5C,
-	0x38,0x59,0x59,0x89,0x46,0xFE,0x83,0x7E,0xFE,0xFF,0x75,
-	0x07,0x57,0xE8,0xE0,0x17,0x59,0xEB,0xDF,0x8D,0x46,0xFA,
-	0x50,0x57,0xE8,0x9D,0x34,0x59,0x59,0x3D,0xFF,0xFF,0x75,
-	0x02,0xEB,0x11,0x8D,0x46,0xF6,0x50,0xFF,0x76,0xFE,0xE8,
-	0x8A,0x34,0x59,0x59,0x3D,0xFF,0xFF,0x75,0x0C,0xFF,0x76,
-	0xFE,0x57,0xE8,0x2B,0x01,0x59,0x59,0xE9,0x20,0x01,0x8A,
-	0x46,0xF9,0xD1,0xE8,0x25,0x7F,0x00,0x8A,0x56,0xFD,0xD1,
-	0xEA,0x81,0xE2,0x7F,0x00,0x3B,0xC2,0x76,0x06,0xBE,0x01,
-	0x00,0xE9,0xFA,0x00,0x8A,0x46,0xF9,0xD1,0xE8,0x25,0x7F,
-	0x00,0x8A,0x56,0xFD,0xD1,0xEA,0x81,0xE2,0x7F,0x00,0x3B,
-	0xC2,0x73,0x03,0xE9,0xE0,0x00,0x8B,0x46,0xF8,0xB1,0x05,
-	0xD3,0xE8,0x25,0x0F,0x00,0x8B,0x56,0xFC,0xD3,0xEA,0x81,
-	0xE2,0x0F,0x00,0x3B,0xC2,0x76,0x02,0xEB,0xC9,0x8B,0x46,
-	0xF8,0xB1,0x05,0xD3,0xE8,0x25,0x0F,0x00,0x8B,0x56,0xFC,
-	0xD3,0xEA,0x81,0xE2,0x0F,0x00,0x3B,0xC2,0x73,0x03,0xE9,
-	0xAD,0x00,0x8A,0x46,0xF8,0x25,0x1F,0x00,0x8A,0x56,0xFC,
-	0x81,0xE2,0x1F,0x00,0x3B,0xC2,0x76,0x02,0xEB,0x9C,0x8A,
-	0x46,0xF8,0x25,0x1F,0x00,0x8A,0x56,0xFC,0x81,0xE2,0x1F,
-	0x00,0x3B,0xC2,0x73,0x03,0xE9,0x86,0x00,0x8A,0x46,0xF7,
-	0xD1,0xE8,0xD1,0xE8,0xD1,0xE8,0x25,0x1F,0x00,0x8A,0x56,
-	0xFB,0xD1,0xEA,0xD1,0xEA,0xD1,0xEA,0x81,0xE2,0x1F,0x00,
-	0x3B,0xC2,0x76,0x03,0xE9,0x68,0xFF,0x8A,0x46,0xF7,0xD1,
-	0xE8,0xD1,0xE8,0xD1,0xE8,0x25,0x1F,0x00,0x8A,0x56,0xFB,
-	0xD1,0xEA,0xD1,0xEA,0xD1,0xEA,0x81,0xE2,0x1F,0x00,0x3B,
-	0xC2,0x73,0x02,0xEB,0x47,0x8B,0x46,0xF6,0xB1,0x05,0xD3,
-	0xE8,0x25,0x3F,0x00,0x8B,0x56,0xFA,0xD3,0xEA,0x81,0xE2,
-	0x3F,0x00,0x3B,0xC2,0x76,0x03,0xE9,0x2F,0xFF,0x8B,0x46,
-	0xF6,0xB1,0x05,0xD3,0xE8,0x25,0x3F,0x00,0x8B,0x56,0xFA,
-	0xD3,0xEA,0x81,0xE2,0x3F,0x00,0x3B,0xC2,0x73,0x02,0xEB,
-	0x14,0x8A,0x46,0xF6,0x25,0x1F,0x00,0x8A,0x56,0xFA,0x81,
-	0xE2,0x1F,0x00,0x3B,0xC2,0x76,0x03,0xE9,0x02,0xFF,0x33,
-	0xF6,0xFF,0x76,0xFE,0x57,0xE8,0x0A,0x00,0x59,0x59,0x8B,
-	0xC6,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,
-	0x76,0x04,0xE8,0x80,0x16,0x59,0xFF,0x76,0x06,0xE8,0x79,
-	0x16,0x59,0x33,0xC0,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x08,0x56,0x57,0x8B,0x76,0x06,0xB8,0x20,0x00,0x50,0xFF,
-	0x76,0x04,0xE8,0x41,0x2E,0x59,0x59,0x89,0x46,0xF8,0x3D,
-	0xFF,0xFF,0x75,0x05,0x33,0xC0,0xE9,0x2A,0x01,0xC6,0x46,
-	0xFA,0x21,0xC6,0x46,0xFB,0x9C,0xC6,0x46,0xFC,0x0C,0x8A,
-	0x44,0x14,0x88,0x46,0xFD,0x83,0x3C,0x00,0x74,0x04,0xB0,
-	0x01,0xEB,0x02,0xB0,0x00,0x88,0x46,0xFE,0x83,0x7C,0x02,
-	0x00,0x74,0x04,0xB0,0x02,0xEB,0x02,0xB0,0x00,0x8A,0x56,
-	0xFE,0x02,0xD0,0x88,0x56,0xFE,0x83,0x7C,0x04,0x00,0x74,
-	0x04,0xB0,0x04,0xEB,0x02,0xB0,0x00,0x8A,0x56,0xFE,0x02,
-	0xD0,0x88,0x56,0xFE,0x83,0x7C,0x06,0x00,0x74,0x04,0xB0,
-	0x08,0xEB,0x02,0xB0,0x00,0x8A,0x56,0xFE,0x02,0xD0,0x88,
-	0x56,0xFE,0x83,0x7C,0x08,0x00,0x74,0x04,0xB0,0x10,0xEB,
-	0x02,0xB0,0x00,0x8A,0x56,0xFE,0x02,0xD0,0x88,0x56,0xFE,
-	0x83,0x7C,0x0A,0x00,0x74,0x04,0xB0,0x20,0xEB,0x02,0xB0,
-	0x00,0x8A,0x56,0xFE,0x02,0xD0,0x88,0x56,0xFE,0x83,0x7C,
-	0x0C,0x00,0x74,0x04,0xB0,0x40,0xEB,0x02,0xB0,0x00,0x8A,
-	0x56,0xFE,0x02,0xD0,0x88,0x56,0xFE,0x83,0x7C,0x0E,0x00,
-	0x74,0x04,0xB0,0x80,0xEB,0x02,0xB0,0x00,0x8A,0x56,0xFE,
-	0x02,0xD0,0x88,0x56,0xFE,0x83,0x7C,0x10,0x00,0x74,0x04,
-	0xB0,0x01,0xEB,0x02,0xB0,0x00,0x88,0x46,0xFF,0x83,0x7C,
-	0x16,0x0B,0x75,0x04,0xB0,0x02,0xEB,0x02,0xB0,0x00,0x8A,
-	0x56,0xFF,0x02,0xD0,0x88,0x56,0xFF,0x83,0x7C,0x12,0x00,
-	0x74,0x04,0xB0,0x04,0xEB,0x02,0xB0,0x00,0x8A,0x56,0xFF,
-	0x02,0xD0,0x88,0x56,0xFF,0x83,0x7C,0x18,0x01,0x75,0x04,
-	0xB0,0x08,0xEB,0x02,0xB0,0x00,0x8A,0x56,0xFF,0x02,0xD0,
-	0x88,0x56,0xFF,0xB8,0x06,0x00,0x50,0x8D,0x46,0xFA,0x50,
-	0xFF,0x76,0xF8,0xE8,0xC4,0x29,0x83,0xC4,0x06,0x3D,0xFF,
-	0xFF,0x74,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x8B,
-	0xF8,0xFF,0x76,0xF8,0xE8,0x34,0x15,0x59,0x0B,0xFF,0x75,
-	0x07,0xFF,0x76,0x04,0xE8,0x98,0x39,0x59,0x8B,0xC7,0x5F,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x08,
-	0x56,0x57,0x8B,0x76,0x06,0xB8,0x01,0x00,0x50,0xFF,0x76,
-	0x04,0xE8,0x78,0x35,0x59,0x59,0x8B,0xF8,0x3D,0xFF,0xFF,
-	0x75,0x05,0x33,0xC0,0xE9,0x28,0x01,0xB8,0x06,0x00,0x50,
-	0x8D,0x46,0xFA,0x50,0x57,0xE8,0xD7,0x36,0x83,0xC4,0x06,
-	0x3D,0xFF,0xFF,0x75,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,
-	0xC0,0x89,0x46,0xF8,0x57,0xE8,0xDB,0x14,0x59,0x83,0x7E,
-	0xF8,0x00,0x74,0x02,0xEB,0xD0,0x80,0x7E,0xFA,0x21,0x74,
-	0x02,0xEB,0xC8,0x80,0x7E,0xFB,0x9C,0x74,0x02,0xEB,0xC0,
-	0x80,0x7E,0xFC,0x0C,0x7D,0x02,0xEB,0xB8,0x8A,0x46,0xFD,
-	0x98,0x89,0x44,0x14,0x8A,0x46,0xFE,0x98,0x25,0x01,0x00,
-	0x89,0x04,0x8A,0x46,0xFE,0x98,0xA9,0x02,0x00,0x7E,0x05,
-	0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x89,0x44,0x02,0x8A,
-	0x46,0xFE,0x98,0xA9,0x04,0x00,0x7E,0x05,0xB8,0x01,0x00,
-	0xEB,0x02,0x33,0xC0,0x89,0x44,0x04,0x8A,0x46,0xFE,0x98,
-	0xA9,0x08,0x00,0x7E,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,
-	0xC0,0x89,0x44,0x06,0x8A,0x46,0xFE,0x98,0xA9,0x10,0x00,
-	0x7E,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x89,0x44,
-	0x08,0x8A,0x46,0xFE,0x98,0xA9,0x20,0x00,0x7E,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0x89,0x44,0x0A,0x8A,0x46,
-	0xFE,0x98,0xA9,0x40,0x00,0x7E,0x05,0xB8,0x01,0x00,0xEB,
-	0x02,0x33,0xC0,0x89,0x44,0x0C,0x8A,0x46,0xFE,0x98,0xA9,
-	0x80,0x00,0x7E,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,
-	0x89,0x44,0x0E,0x8A,0x46,0xFF,0x98,0xA9,0x01,0x00,0x7E,
-	0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0x89,0x44,0x10,
-	0x8A,0x46,0xFF,0x98,0xA9,0x02,0x00,0x7E,0x05,0xB8,0x0B,
-	0x00,0xEB,0x03,0xB8,0x16,0x00,0x89,0x44,0x16,0x8A,0x46,
-	0xFF,0x98,0xA9,0x04,0x00,0x7E,0x05,0xB8,0x01,0x00,0xEB,
-	0x02,0x33,0xC0,0x89,0x44,0x12,0x8A,0x46,0xFF,0x98,0xA9,
-	0x08,0x00,0x7E,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,
-	0x89,0x44,0x18,0xB8,0x01,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xA1,0xD4,0x0F,0x0B,0x06,0xD6,0x0F,
-	0x75,0x22,0xA0,0xF8,0x17,0xB4,0x00,0xF7,0x2E,0xFE,0x17,
-	0x8B,0x16,0xF6,0x17,0x03,0xD0,0xA1,0xF9,0x17,0xB1,0x04,
-	0xD3,0xE8,0x03,0xD0,0x89,0x16,0xD4,0x0F,0xC7,0x06,0xD6,
-	0x0F,0x00,0x00,0x8B,0x16,0xD6,0x0F,0xA1,0xD4,0x0F,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x04,0xE8,0xC0,0xFF,0x89,
-	0x46,0xFC,0x89,0x56,0xFE,0xA0,0xF5,0x17,0xB4,0x00,0x99,
-	0x52,0x50,0xA0,0xF5,0x17,0xB4,0x00,0xD1,0xE0,0x99,0x8B,
-	0x5E,0x06,0x8B,0x4E,0x04,0x03,0xC8,0x13,0xDA,0x2B,0x4E,
-	0xFC,0x1B,0x5E,0xFE,0x53,0x51,0xE8,0x9E,0x41,0x8B,0xE5,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,0xFF,0x76,
-	0x06,0xFF,0x76,0x04,0xE8,0xB8,0xFF,0x59,0x59,0x8B,0xF8,
-	0xD1,0xE8,0x8B,0xD7,0x03,0xD0,0x89,0x56,0xFE,0xC4,0x1E,
-	0xD0,0x0F,0x03,0x5E,0xFE,0x26,0x8B,0x37,0xF7,0xC7,0x01,
-	0x00,0x75,0x06,0x81,0xE6,0xFF,0x0F,0xEB,0x04,0x81,0xE6,
-	0xF0,0xFF,0x0B,0xF6,0x74,0x05,0xB8,0x01,0x00,0xEB,0x02,
-	0x33,0xC0,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x83,0xEC,0x0C,0x56,0x57,0xC7,0x46,0xFC,0x00,0x00,0xC7,
-	0x46,0xFE,0x00,0x00,0x83,0x3E,0xCE,0x0F,0x00,0x75,0x0E,
-	0x8B,0x1E,0xFB,0x17,0x33,0xC9,0xA1,0xF3,0x17,0x33,0xD2,
-	0xE9,0xBF,0x00,0x33,0xC0,0x50,0xFF,0x76,0x04,0x8B,0x1E,
-	0xFB,0x17,0x33,0xC9,0xA1,0xF3,0x17,0x33,0xD2,0xE8,0x21,
-	0x45,0x52,0x50,0xE8,0x12,0x41,0x89,0x46,0xF8,0x89,0x56,
-	0xFA,0x8B,0x46,0x04,0x33,0xD2,0xF7,0x36,0xF3,0x17,0x8B,
-	0xF8,0x33,0xC0,0x50,0x57,0xE8,0xF1,0xFE,0x52,0x50,0xE8,
-	0xF5,0x40,0x50,0x52,0x33,0xC0,0x50,0x57,0xE8,0xE3,0xFE,
-	0x52,0x50,0xE8,0xF7,0x40,0x0B,0xC2,0x74,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x99,0x5B,0x59,0x03,0xC8,0x13,
-	0xDA,0x89,0x4E,0xFC,0x89,0x5E,0xFE,0x8B,0x46,0xFE,0x8B,
-	0x56,0xFC,0x89,0x56,0xF4,0x89,0x46,0xF6,0xEB,0x38,0x33,
-	0xF6,0xEB,0x28,0x8B,0xDF,0x33,0xC9,0x8B,0x56,0xF6,0x8B,
-	0x46,0xF4,0xE8,0xBA,0x44,0x03,0xC6,0x83,0xD2,0x00,0x52,
-	0x50,0xE8,0x0C,0xFF,0x59,0x59,0x0B,0xC0,0x74,0x0A,0x83,
-	0x46,0xFC,0x01,0x83,0x56,0xFE,0x00,0xEB,0x05,0x46,0x3B,
-	0xF7,0x72,0xD4,0x83,0x46,0xF4,0x01,0x83,0x56,0xF6,0x00,
-	0x8B,0x46,0xF6,0x8B,0x56,0xF4,0x3B,0x46,0xFA,0x72,0xBD,
-	0x75,0x05,0x3B,0x56,0xF8,0x72,0xB6,0x8B,0x5E,0x04,0x33,
-	0xC9,0x8B,0x56,0xFE,0x8B,0x46,0xFC,0xE8,0x73,0x44,0x5F,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0x3E,0xCE,
-	0x0F,0x00,0x75,0x05,0xB8,0x01,0x00,0xEB,0x1C,0xE8,0x48,
-	0xFE,0x3B,0x56,0x06,0x72,0x09,0x75,0x05,0x3B,0x46,0x04,
-	0x72,0x02,0xEB,0xEA,0xFF,0x76,0x06,0xFF,0x76,0x04,0xE8,
-	0xA0,0xFE,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,
-	0x46,0x06,0xB1,0x09,0xD3,0xE0,0x8B,0xF0,0x33,0xC0,0x50,
-	0x8B,0x56,0x0A,0x8B,0x46,0x08,0xE8,0xC4,0x40,0x52,0x50,
-	0xFF,0x76,0x04,0xE8,0x03,0x30,0x83,0xC4,0x08,0x56,0xFF,
-	0x76,0x0C,0xFF,0x76,0x04,0xE8,0xB4,0x33,0x83,0xC4,0x06,
-	0x3B,0xC6,0x74,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,
-	0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x06,0xB8,
-	0xE8,0x17,0x50,0x33,0xC0,0x33,0xD2,0x50,0x52,0xB8,0x01,
-	0x00,0x50,0xFF,0x76,0x04,0xFF,0x56,0x08,0x83,0xC4,0x0A,
-	0x0B,0xC0,0x74,0x04,0x33,0xC0,0xEB,0x21,0xA0,0xF5,0x17,
-	0xB4,0x00,0x50,0xA1,0xFB,0x17,0x33,0xD2,0x5B,0xF7,0xF3,
-	0x89,0x44,0x02,0xC7,0x44,0x04,0x00,0x02,0xA0,0xF5,0x17,
-	0xB4,0x00,0x89,0x44,0x06,0xB8,0x01,0x00,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xB8,0xFE,0x6E,0x50,0xFF,0x76,0x06,0xFF,
-	0x76,0x04,0xE8,0xA6,0xFF,0x83,0xC4,0x06,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0xB8,0x01,0x80,0x50,0xFF,0x76,0x04,
-	0xE8,0xBC,0x31,0x59,0x59,0x8B,0xF0,0x83,0xFE,0xFF,0x75,
-	0x04,0x33,0xC0,0xEB,0x17,0xB8,0x07,0x47,0x50,0xFF,0x76,
-	0x06,0x56,0xE8,0x7A,0xFF,0x83,0xC4,0x06,0x8B,0xF8,0x56,
-	0xE8,0x2E,0x11,0x59,0x8B,0xC7,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x81,0xEC,0x06,0x02,0x56,0x57,0xE8,0x61,0x01,
-	0xA1,0xFE,0x17,0x33,0xD2,0xB1,0x09,0xE8,0xF2,0x3F,0x52,
-	0x50,0xE8,0x7D,0x3D,0x59,0x59,0xA3,0xD0,0x0F,0x89,0x16,
-	0xD2,0x0F,0xA1,0xD0,0x0F,0x0B,0x06,0xD2,0x0F,0x75,0x05,
-	0x33,0xC0,0xE9,0x92,0x00,0xA1,0xF6,0x17,0x89,0x46,0xFA,
-	0xC7,0x46,0xFC,0x00,0x00,0x8B,0x36,0xD2,0x0F,0x8B,0x3E,
-	0xD0,0x0F,0x8B,0xC7,0xB1,0x04,0xD3,0xE8,0x8B,0xD6,0x03,
-	0xD0,0x8B,0xF2,0x8B,0xC7,0x25,0x0F,0x00,0x8B,0xF8,0xC7,
-	0x46,0xFE,0x00,0x00,0xEB,0x59,0x8D,0x86,0xFA,0xFD,0x50,
-	0x8B,0x46,0xFE,0x99,0x8B,0x5E,0xFC,0x8B,0x4E,0xFA,0x03,
-	0xC8,0x13,0xDA,0x53,0x51,0xB8,0x01,0x00,0x50,0xFF,0x76,
-	0x04,0xFF,0x56,0x06,0x83,0xC4,0x0A,0x0B,0xC0,0x74,0x1B,
-	0xFF,0x36,0xD2,0x0F,0xFF,0x36,0xD0,0x0F,0xE8,0x22,0x3C,
-	0x59,0x59,0xC7,0x06,0xD0,0x0F,0x00,0x00,0xC7,0x06,0xD2,
-	0x0F,0x00,0x00,0xEB,0x8D,0xB8,0x00,0x02,0x50,0x57,0x56,
-	0x8D,0x86,0xFA,0xFD,0x50,0x16,0xE8,0x36,0x30,0x83,0xC4,
-	0x0A,0x83,0xC6,0x20,0xFF,0x46,0xFE,0x8B,0x46,0xFE,0x3B,
-	0x06,0xFE,0x17,0x7C,0x9E,0xB8,0x01,0x00,0x5F,0x5E,0x8B,
-	0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0xB8,0x01,0x80,
-	0x50,0xFF,0x76,0x04,0xE8,0xBB,0x30,0x59,0x59,0x8B,0xF0,
-	0x83,0xFE,0xFF,0x75,0x04,0x33,0xC0,0xEB,0x13,0xB8,0x07,
-	0x47,0x50,0x56,0xE8,0x12,0xFF,0x59,0x59,0x8B,0xF8,0x56,
-	0xE8,0x31,0x10,0x59,0x8B,0xC7,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xB8,0xFE,0x6E,0x50,0xFF,0x76,0x04,0xE8,0xF6,
-	0xFE,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0x7E,0x04,
-	0x16,0x75,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0xA3,
-	0xCE,0x0F,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x83,0x3E,0xCE,
-	0x0F,0x00,0x75,0x05,0xB8,0x01,0x00,0xEB,0x37,0xE8,0x22,
-	0xFC,0x3B,0x56,0x06,0x72,0x09,0x75,0x05,0x3B,0x46,0x04,
-	0x72,0x02,0xEB,0xEA,0x33,0xF6,0xEB,0x1B,0x8B,0xC6,0x99,
-	0x8B,0x5E,0x06,0x8B,0x4E,0x04,0x03,0xC8,0x13,0xDA,0x53,
-	0x51,0xE8,0x6D,0xFC,0x59,0x59,0x0B,0xC0,0x74,0x02,0xEB,
-	0xCC,0x46,0x3B,0x76,0x08,0x7C,0xE0,0x33,0xC0,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xA1,0xD0,0x0F,0x0B,0x06,0xD2,0x0F,
-	0x74,0x0D,0xFF,0x36,0xD2,0x0F,0xFF,0x36,0xD0,0x0F,0xE8,
-	0x2E,0x3B,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x14,0xA1,0xF9,0x17,0xB1,0x05,0xD3,0xE0,0x8B,0x16,0xF3,
-	0x17,0x4A,0x03,0xC2,0x33,0xD2,0xF7,0x36,0xF3,0x17,0x89,
-	0x46,0xFC,0xC7,0x46,0xFE,0x00,0x00,0x83,0x3E,0xFE,0x17,
-	0x00,0x74,0x0D,0xA1,0xFE,0x17,0x89,0x46,0xF8,0xC7,0x46,
-	0xFA,0x00,0x00,0xEB,0x0D,0xA1,0x0E,0x18,0x8B,0x16,0x0C,
-	0x18,0x89,0x56,0xF8,0x89,0x46,0xFA,0x83,0x3E,0xFB,0x17,
-	0x00,0x74,0x0D,0xA1,0xFB,0x17,0x89,0x46,0xF4,0xC7,0x46,
-	0xF6,0x00,0x00,0xEB,0x0D,0xA1,0x0A,0x18,0x8B,0x16,0x08,
-	0x18,0x89,0x56,0xF4,0x89,0x46,0xF6,0xA0,0xF8,0x17,0xB4,
-	0x00,0x99,0x50,0x52,0x8B,0x56,0xFA,0x8B,0x46,0xF8,0x59,
-	0x5B,0xE8,0x6C,0x41,0x8B,0x1E,0xF6,0x17,0x33,0xC9,0x03,
-	0xD8,0x13,0xCA,0x03,0x5E,0xFC,0x13,0x4E,0xFE,0x8B,0x46,
-	0xF6,0x8B,0x56,0xF4,0x2B,0xD3,0x1B,0xC1,0x89,0x56,0xF0,
-	0x89,0x46,0xF2,0xA0,0xF5,0x17,0xB4,0x00,0x99,0x52,0x50,
-	0xFF,0x76,0xF2,0xFF,0x76,0xF0,0xE8,0x31,0x3D,0x89,0x46,
-	0xEC,0x89,0x56,0xEE,0x83,0x7E,0xEE,0x00,0x77,0x0E,0x72,
-	0x07,0x81,0x7E,0xEC,0xF5,0x0F,0x73,0x05,0xB8,0x0C,0x00,
-	0xEB,0x16,0x83,0x7E,0xEE,0x00,0x77,0x0D,0x72,0x06,0x83,
-	0x7E,0xEC,0xF5,0x73,0x05,0xB8,0x10,0x00,0xEB,0x03,0xB8,
-	0x20,0x00,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x08,0x56,0x57,0x8B,0x7E,0x08,0xB8,0x01,0x80,0x50,0xFF,
-	0x76,0x04,0xE8,0x1B,0x2F,0x59,0x59,0x8B,0xF0,0x83,0xFE,
-	0xFF,0x75,0x04,0x33,0xC0,0xEB,0x76,0x56,0xE8,0xE2,0x28,
-	0x59,0x89,0x46,0xFC,0x89,0x56,0xFE,0x33,0xC0,0x50,0x57,
-	0xFF,0x76,0xFE,0xFF,0x76,0xFC,0xE8,0xD3,0x3C,0x0B,0xC2,
-	0x74,0x07,0x56,0xE8,0x81,0x0E,0x59,0xEB,0xD9,0xC7,0x46,
-	0xF8,0x00,0x00,0xC7,0x46,0xFA,0x00,0x00,0xEB,0x26,0x57,
-	0xFF,0x76,0x06,0x56,0xE8,0x50,0x30,0x83,0xC4,0x06,0x3B,
-	0xC7,0x75,0x0D,0x57,0xFF,0x76,0x06,0xE8,0xA0,0xDC,0x59,
-	0x59,0x0B,0xC0,0x75,0x02,0xEB,0xCF,0x83,0x46,0xF8,0x01,
-	0x83,0x56,0xFA,0x00,0x33,0xC0,0x50,0x57,0xFF,0x76,0xFE,
-	0xFF,0x76,0xFC,0xE8,0x79,0x3C,0x3B,0x56,0xFA,0x77,0xC8,
-	0x75,0x05,0x3B,0x46,0xF8,0x77,0xC1,0x56,0xE8,0x2F,0x0E,
-	0x59,0xB8,0x01,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0xEC,0x06,0x56,0x57,0x8B,0x76,0x04,0xC7,
-	0x46,0xFA,0x00,0x00,0x83,0x7E,0x0E,0x00,0x74,0x67,0xB8,
-	0xD8,0x0F,0x50,0xE8,0x67,0x1B,0x59,0xB8,0xDA,0x0F,0x50,
-	0xB8,0x15,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,
-	0x16,0xE8,0xEE,0x08,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,
-	0x36,0x80,0x16,0xB8,0xFC,0x0F,0x50,0xE8,0xBB,0x18,0x59,
-	0x59,0xB8,0xD9,0x0F,0x50,0xE8,0x39,0x1B,0x59,0xB8,0xD9,
-	0x0F,0x50,0xE8,0x31,0x1B,0x59,0xB8,0xFF,0x0F,0x50,0xB8,
-	0x09,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,0x8A,0x16,
-	0xE8,0xB8,0x08,0x83,0xC4,0x08,0xA3,0x80,0x16,0xFF,0x36,
-	0x80,0x16,0xB8,0xFC,0x0F,0x50,0xE8,0x85,0x18,0x59,0x59,
-	0xE8,0x17,0xE1,0xFF,0x76,0x0C,0xFF,0x76,0x0A,0x56,0xE8,
-	0x38,0xDC,0x83,0xC4,0x06,0x0B,0xC0,0x74,0x0D,0xE8,0x35,
-	0x02,0x89,0x46,0xFA,0x0B,0xC0,0x75,0x03,0xE9,0xBF,0x00,
-	0xB8,0xD9,0x0F,0x50,0xE8,0xE2,0x1A,0x59,0x83,0x7E,0xFA,
-	0x00,0x74,0x09,0xB8,0x1F,0x10,0x50,0xB8,0x0A,0x00,0xEB,
-	0x07,0xB8,0x2F,0x10,0x50,0xB8,0x0C,0x00,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0x5A,0x08,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xFC,0x0F,
-	0x50,0xE8,0x27,0x18,0x59,0x59,0xB8,0xD9,0x0F,0x50,0xE8,
-	0xA5,0x1A,0x59,0x83,0x7E,0x10,0x00,0x74,0x05,0x33,0xC0,
-	0xE9,0x73,0x01,0xB8,0xD9,0x0F,0x50,0xE8,0x92,0x1A,0x59,
-	0xB8,0x56,0x10,0x50,0xB8,0x17,0x00,0x50,0xB8,0x01,0x00,
-	0x50,0xFF,0x36,0x8A,0x16,0xE8,0x19,0x08,0x83,0xC4,0x08,
-	0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xFC,0x0F,0x50,
-	0xE8,0xE6,0x17,0x59,0x59,0x56,0xE8,0xF6,0xD3,0x59,0x98,
-	0x50,0xB8,0x86,0x10,0x50,0xE8,0xD6,0x17,0x59,0x59,0xB8,
-	0x8D,0x10,0x50,0xB8,0x18,0x00,0x50,0xB8,0x01,0x00,0x50,
-	0xFF,0x36,0x8A,0x16,0xE8,0xE3,0x07,0x83,0xC4,0x08,0xA3,
-	0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0xFC,0x0F,0x50,0xE8,
-	0xB0,0x17,0x59,0x59,0xB8,0xD9,0x0F,0x50,0xE8,0x2E,0x1A,
-	0x59,0xE9,0x20,0xFF,0x33,0xC0,0x50,0x56,0xE8,0x08,0x0C,
-	0x59,0x59,0x0B,0xC0,0x75,0x5A,0x83,0x7E,0x12,0x00,0x74,
-	0x43,0x56,0xE8,0x23,0x31,0x59,0x3D,0xFF,0xFF,0x75,0x4A,
-	0xB8,0xD9,0x0F,0x50,0xE8,0x06,0x1A,0x59,0xB8,0xA8,0x10,
-	0x50,0xB8,0x04,0x00,0x50,0xB8,0x01,0x00,0x50,0xFF,0x36,
-	0x8A,0x16,0xE8,0x8D,0x07,0x83,0xC4,0x08,0xA3,0x80,0x16,
-	0xFF,0x36,0x80,0x16,0xB8,0xFC,0x0F,0x50,0xE8,0x5A,0x17,
-	0x59,0x59,0xB8,0xD9,0x0F,0x50,0xE8,0xD8,0x19,0x59,0xE9,
-	0x36,0xFF,0xB8,0xD8,0x0F,0x50,0xE8,0xCD,0x19,0x59,0xB8,
-	0xC1,0x10,0x50,0xB8,0x07,0x00,0xEB,0xC5,0xB8,0x02,0x81,
-	0x50,0x56,0xE8,0xC9,0x2C,0x59,0x59,0x8B,0xF8,0x83,0xFF,
-	0xFF,0x75,0x03,0xE9,0x11,0xFF,0xC7,0x46,0xFC,0x00,0x00,
-	0xC7,0x46,0xFE,0x00,0x00,0xEB,0x50,0xFF,0x76,0x08,0xFF,
-	0x76,0x06,0xE8,0x57,0xDA,0x59,0x59,0x0B,0xC0,0x74,0x12,
-	0xFF,0x76,0x08,0xFF,0x76,0x06,0x57,0xE8,0xA4,0x20,0x83,
-	0xC4,0x06,0x3B,0x46,0x08,0x74,0x27,0x57,0xE8,0x1F,0x0C,
-	0x59,0x33,0xC0,0x50,0x56,0xE8,0x5B,0x0B,0x59,0x59,0x0B,
-	0xC0,0x75,0x12,0xB8,0x80,0x00,0x50,0x56,0xE8,0xC4,0x0B,
-	0x59,0x59,0x56,0xE8,0x72,0x30,0x59,0xE9,0xC0,0xFE,0xE9,
-	0xBD,0xFE,0x83,0x46,0xFC,0x01,0x83,0x56,0xFE,0x00,0x33,
-	0xC0,0x50,0xFF,0x76,0x08,0xFF,0x76,0x0C,0xFF,0x76,0x0A,
-	0xE8,0x1F,0x3A,0x3B,0x56,0xFE,0x77,0x9C,0x75,0x05,0x3B,
-	0x46,0xFC,0x77,0x95,0x57,0xE8,0xD5,0x0B,0x59,0xB8,0x80,
-	0x00,0x50,0x56,0xE8,0x87,0x0B,0x59,0x59,0xB8,0x01,0x00,
-	0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x53,0x51,0x52,0x56,0x57,
-	0x06,0x16,0x1E,0xFB,0xBA,0xD3,0x08,0x8E,0xDA,0x81,0xE7,
-	0xFF,0x00,0x30,0xC0,0x01,0xF8,0x50,0xFF,0x16,0xD6,0x10,
-	0x5A,0x1F,0x17,0x07,0x5F,0x5E,0x5A,0x59,0x5B,0xCF,0x55,
-	0x89,0xE5,0x06,0x1E,0x8B,0x46,0x04,0xA3,0xD6,0x10,0xBA,
-	0x42,0x4D,0x0E,0x1F,0xB8,0x24,0x25,0xCD,0x21,0x1F,0x07,
-	0x5D,0xC3,0x89,0xE3,0x36,0x8B,0x47,0x02,0x88,0x26,0xD9,
-	0x10,0xA2,0xDA,0x10,0xC6,0x06,0xD8,0x10,0x01,0xB8,0x03,
-	0x00,0xC3,0xB8,0x80,0x4D,0x50,0xE8,0xCA,0xFF,0x58,0xC6,
-	0x06,0xD8,0x10,0x00,0xC3,0x31,0xC0,0xA0,0xD8,0x10,0xC6,
-	0x06,0xD8,0x10,0x00,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,
-	0x76,0x04,0x0B,0xF6,0x74,0x0F,0x80,0x3C,0x00,0x74,0x0A,
-	0x80,0x7C,0x01,0x3A,0x75,0x04,0x8A,0x04,0xEB,0x05,0xE8,
-	0x91,0x22,0x04,0x41,0x50,0xE8,0x68,0x03,0x59,0x8B,0xF8,
-	0xE8,0xCB,0xFF,0x0B,0xC0,0x74,0x05,0xB8,0x02,0x00,0xEB,
-	0x02,0x8B,0xC7,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x83,
-	0xEC,0x0A,0x56,0x57,0x8B,0x7E,0x04,0x16,0x8D,0x46,0xF6,
-	0x50,0x1E,0xB8,0xDC,0x10,0x50,0xB9,0x09,0x00,0xE8,0xAB,
-	0x3A,0x57,0xE8,0xEE,0x2E,0x59,0x8B,0xF0,0xB8,0x08,0x00,
-	0x50,0xB8,0x41,0x00,0x50,0x8D,0x46,0xF6,0x50,0xE8,0x90,
-	0x2A,0x83,0xC4,0x06,0xB8,0x10,0x00,0x50,0x8D,0x46,0xF6,
-	0x50,0xA1,0xE5,0x10,0xFF,0x06,0xE5,0x10,0x50,0xE8,0xA2,
-	0x29,0x83,0xC4,0x06,0x8D,0x46,0xF6,0x50,0xE8,0xBC,0x2E,
-	0x59,0x8D,0x56,0xF6,0x03,0xC2,0x8B,0xD8,0xC6,0x07,0x41,
-	0x81,0x3E,0xE5,0x10,0xFF,0x7F,0x75,0x0A,0xC7,0x06,0xE5,
-	0x10,0x00,0x00,0xFF,0x06,0xE7,0x10,0xB8,0x10,0x00,0x50,
-	0x8D,0x46,0xFA,0x50,0xFF,0x36,0xE7,0x10,0xE8,0x6C,0x29,
-	0x83,0xC4,0x06,0x8B,0xDE,0xC6,0x01,0x00,0x33,0xC0,0x50,
-	0x8D,0x46,0xF6,0x50,0x57,0xE8,0x7B,0x2D,0x59,0x59,0x50,
-	0xE8,0xC9,0x09,0x59,0x59,0x0B,0xC0,0x74,0x86,0x5F,0x5E,
-	0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0x8B,0x7E,0x06,0xC7,0x46,0xFE,0x00,0x00,0xFF,0x76,0x04,
-	0x57,0xE8,0xF1,0x2D,0x59,0x59,0x57,0xE8,0x4F,0x2E,0x59,
-	0x8B,0xD7,0x03,0xD0,0x8B,0xF2,0xEB,0x14,0x80,0x3C,0x5C,
-	0x74,0x05,0x80,0x3C,0x3A,0x75,0x09,0xC6,0x44,0x01,0x00,
-	0xC7,0x46,0xFE,0x01,0x00,0x4E,0x3B,0xF7,0x75,0xE8,0x83,
-	0x7E,0xFE,0x00,0x75,0x03,0xC6,0x05,0x00,0x57,0xE8,0x14,
-	0xFF,0x59,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x56,0x33,0xF6,0xEB,0x2B,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0xB2,0x00,0x8B,0xD8,0x88,0x97,0xE8,0x19,0x8A,0xC2,
-	0x50,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x8B,0xD8,0x58,
-	0x88,0x87,0x26,0x1E,0x8B,0xDE,0xD1,0xE3,0xC7,0x87,0x20,
-	0x1E,0x00,0x00,0x46,0x83,0xFE,0x03,0x7C,0xD0,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x06,0x8B,0xC6,
-	0xBA,0x0E,0x01,0xF7,0xEA,0x8B,0xD8,0xC6,0x87,0x26,0x1E,
-	0x00,0xFF,0x76,0x04,0xE8,0x7D,0xFE,0x59,0x8B,0xF8,0x83,
-	0xFF,0x01,0x75,0x27,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,
-	0x05,0x26,0x1E,0x50,0xFF,0x76,0x04,0xE8,0x4D,0x08,0x59,
-	0x59,0x0B,0xC0,0x74,0x2A,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0x8B,0xD8,0xC6,0x87,0x26,0x1E,0x00,0xEB,0x1A,0x83,
-	0xFF,0x02,0x75,0x02,0xEB,0xE9,0xFF,0x76,0x04,0x8B,0xC6,
-	0xBA,0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x50,0xE8,0x18,
-	0x2D,0x59,0x59,0xFF,0x76,0x04,0x8B,0xC6,0xBA,0x0E,0x01,
-	0xF7,0xEA,0x05,0xE8,0x19,0x50,0xE8,0x05,0x2D,0x59,0x59,
-	0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,
-	0x04,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x8B,0xD8,0x80,
-	0xBF,0x26,0x1E,0x00,0x75,0x67,0x8B,0xC6,0xBA,0x0E,0x01,
-	0xF7,0xEA,0x05,0xE8,0x19,0x50,0xE8,0xF7,0xFD,0x59,0x8B,
-	0xF8,0x83,0xFF,0x01,0x75,0x2F,0x8B,0xC6,0xBA,0x0E,0x01,
-	0xF7,0xEA,0x8B,0xD8,0x80,0xBF,0xE8,0x19,0x00,0x74,0x1B,
-	0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x50,
-	0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,0x50,
-	0xE8,0xA1,0xFE,0xEB,0x24,0x33,0xC0,0xEB,0x2C,0x83,0xFF,
-	0x02,0x75,0x02,0xEB,0xF5,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0x05,0xE8,0x19,0x50,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0x05,0x26,0x1E,0x50,0xE8,0x82,0x2C,0x59,0x59,0x8B,
-	0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x5F,0x5E,
-	0x5D,0xC3,0x55,0x8B,0xEC,0xB8,0x02,0x00,0x50,0xFF,0x76,
-	0x04,0x8B,0x46,0x06,0xD1,0xE0,0x05,0x20,0x1E,0x50,0xE8,
-	0x2B,0x28,0x83,0xC4,0x06,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,
-	0x46,0x04,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x33,0xF6,0xE9,0xDD,0x00,0x8B,
-	0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,0x75,0x03,
-	0xE9,0xCD,0x00,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,
-	0x26,0x1E,0x75,0x03,0xE9,0xBE,0x00,0x8B,0xC6,0xBA,0x0E,
-	0x01,0xF7,0xEA,0x05,0xE8,0x19,0x50,0xE8,0x30,0xFD,0x59,
-	0x3D,0x01,0x00,0x74,0x03,0xE9,0xA7,0x00,0xB8,0x12,0x1D,
-	0x50,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,
-	0x50,0xE8,0xFE,0x06,0x59,0x59,0xB8,0x12,0x1D,0x50,0x8B,
-	0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x50,0xE8,
-	0x07,0x2C,0x59,0x59,0x0B,0xC0,0x74,0x7B,0x8B,0xDE,0xD1,
-	0xE3,0x83,0xBF,0x20,0x1E,0x00,0x74,0x70,0x8B,0xC6,0xBA,
-	0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,0x50,0x8B,0xC6,0xBA,
-	0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x50,0xE8,0x94,0x05,
-	0x59,0x59,0x0B,0xC0,0x75,0x36,0x8B,0xC6,0xBA,0x0E,0x01,
-	0xF7,0xEA,0x05,0xE8,0x19,0x50,0x8B,0xC6,0xBA,0x0E,0x01,
-	0xF7,0xEA,0x05,0x26,0x1E,0x50,0xE8,0xC1,0x2A,0x59,0x59,
-	0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0xE8,0x19,0x50,
-	0x8B,0xC6,0xBA,0x0E,0x01,0xF7,0xEA,0x05,0x26,0x1E,0x50,
-	0xE8,0x7F,0x2B,0xEB,0x19,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0x05,0x26,0x1E,0x50,0x8B,0xC6,0xBA,0x0E,0x01,0xF7,
-	0xEA,0x05,0xE8,0x19,0x50,0xE8,0x6B,0x06,0x59,0x59,0x46,
-	0x83,0xFE,0x03,0x7D,0x03,0xE9,0x1B,0xFF,0x5E,0x5D,0xC3,
-	0x06,0x57,0x89,0xE3,0x36,0x8B,0x47,0x06,0xA2,0xE9,0x10,
-	0xB8,0xA0,0x71,0xBA,0xE9,0x10,0xB9,0x20,0x00,0x1E,0x07,
-	0xBF,0xEC,0x10,0xF9,0xCD,0x21,0x72,0x0E,0x81,0xE3,0x00,
-	0x40,0x83,0xFB,0x00,0x74,0x05,0xB8,0x01,0x00,0xEB,0x03,
-	0xB8,0x00,0x00,0x5F,0x07,0xC3,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x04,0xB8,0x04,0x00,0x50,0x33,0xC0,0x50,0x8B,0xC6,
-	0x05,0x27,0x00,0x50,0xE8,0x25,0x27,0x83,0xC4,0x06,0x5E,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x0C,0x56,0x8B,0x76,
-	0x04,0x8D,0x46,0xFC,0x50,0xE8,0x00,0x11,0x59,0x8D,0x46,
-	0xF8,0x50,0xE8,0xE5,0x10,0x59,0x8A,0x46,0xFD,0xB4,0x00,
-	0xB1,0x08,0xD3,0xE0,0x8A,0x56,0xFC,0xB6,0x00,0x03,0xC2,
-	0x03,0x46,0xF8,0x05,0xBC,0x07,0x89,0x46,0xF6,0x8A,0x46,
-	0xFF,0xB4,0x00,0xD3,0xE0,0x8A,0x56,0xFE,0xB6,0x00,0x03,
-	0xC2,0x50,0x8A,0x46,0xFB,0x98,0xD3,0xE0,0x5A,0x03,0xD0,
-	0x8A,0x46,0xFA,0x98,0x03,0xD0,0x89,0x56,0xF4,0xB8,0x02,
-	0x00,0x50,0x8D,0x46,0xF6,0x50,0x8B,0xC6,0x05,0x27,0x00,
-	0x50,0xE8,0x71,0x26,0x83,0xC4,0x06,0xB8,0x02,0x00,0x50,
-	0x8D,0x46,0xF4,0x50,0x8B,0xC6,0x05,0x29,0x00,0x50,0xE8,
-	0x5D,0x26,0x83,0xC4,0x06,0xB8,0x04,0x00,0x50,0x8B,0xC6,
-	0x05,0x27,0x00,0x50,0xB8,0x50,0x21,0x50,0xE8,0x49,0x26,
-	0x83,0xC4,0x06,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x56,0xB8,0x0C,0x11,0x50,0xB8,0x28,0x00,0x50,0xB8,0x01,
-	0x00,0x50,0xFF,0x36,0x8A,0x16,0xE8,0xC7,0x01,0x83,0xC4,
-	0x08,0xA3,0x80,0x16,0xFF,0x36,0x80,0x16,0xB8,0x24,0x11,
-	0x50,0xE8,0x94,0x11,0x59,0x59,0xB8,0x27,0x11,0x50,0xE8,
-	0x8B,0x11,0x59,0xBE,0x03,0x00,0xEB,0x1E,0x83,0xFE,0x01,
-	0x75,0x08,0xB8,0x29,0x11,0x50,0xE8,0x79,0x11,0x59,0x8A,
-	0x84,0x50,0x21,0xB4,0x00,0x50,0xB8,0x2B,0x11,0x50,0xE8,
-	0x6A,0x11,0x59,0x59,0x4E,0x0B,0xF6,0x7D,0xDE,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x08,0x56,0x57,0x39,0x26,
-	0x9A,0x00,0x72,0x03,0xE8,0x6E,0x3A,0x33,0xF6,0xC7,0x46,
-	0xFC,0x0A,0x00,0xFF,0x76,0xFC,0xE8,0x06,0x37,0x59,0x8B,
-	0xF8,0x0B,0xFF,0x75,0x04,0x8B,0xC7,0xEB,0x68,0xC7,0x46,
-	0xF8,0x00,0x00,0xEB,0x50,0x3B,0x76,0xFC,0x7C,0x24,0xBA,
-	0x02,0x00,0x8B,0x46,0xFC,0xF7,0xEA,0x89,0x46,0xFC,0xFF,
-	0x76,0xFC,0x57,0xE8,0x34,0x38,0x59,0x59,0x89,0x46,0xFE,
-	0x83,0x7E,0xFE,0x00,0x74,0x05,0x8B,0x7E,0xFE,0xEB,0x02,
-	0xEB,0xCC,0x83,0x7E,0xFA,0x0A,0x75,0x13,0x8B,0x46,0xF8,
-	0x3B,0x46,0x06,0x75,0x03,0x4E,0xEB,0x16,0x8B,0xDE,0xC6,
-	0x01,0x00,0x46,0xEB,0xB3,0x8B,0xDE,0x8A,0x46,0xFA,0x88,
-	0x01,0x46,0x8B,0x46,0xFA,0x89,0x46,0xF8,0xFF,0x76,0x04,
-	0xE8,0x1A,0x21,0x59,0x89,0x46,0xFA,0x3D,0xFF,0xFF,0x75,
-	0xA1,0x33,0xC0,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x57,0x8B,0x76,0x04,0x39,0x26,0x9A,0x00,0x72,
-	0x03,0xE8,0xD7,0x39,0x33,0xFF,0xEB,0x11,0x8B,0xC7,0xBA,
-	0x1F,0x00,0xF7,0xEA,0x50,0x8A,0x04,0x98,0x5A,0x03,0xC2,
-	0x8B,0xF8,0x46,0x80,0x3C,0x00,0x75,0xEA,0x8B,0xC7,0xBB,
-	0x65,0x00,0x33,0xD2,0xF7,0xF3,0x8B,0xC2,0x5F,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x39,0x26,0x9A,0x00,0x72,0x03,
-	0xE8,0xA1,0x39,0xFF,0x76,0x04,0xE8,0xB3,0xFF,0x59,0xD1,
-	0xE0,0x8B,0xD8,0x8B,0xB7,0x54,0x21,0xEB,0x15,0xFF,0x74,
-	0x02,0xFF,0x76,0x04,0xE8,0xEF,0x28,0x59,0x59,0x0B,0xC0,
-	0x75,0x04,0x8B,0xC6,0xEB,0x08,0x8B,0x34,0x0B,0xF6,0x75,
-	0xE7,0x33,0xC0,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,
-	0x39,0x26,0x9A,0x00,0x72,0x03,0xE8,0x64,0x39,0xFF,0x76,
-	0x04,0xE8,0xB0,0xFF,0x59,0x8B,0xF0,0x0B,0xC0,0x75,0x3D,
-	0xB8,0x06,0x00,0x50,0xE8,0xF5,0x35,0x59,0x8B,0xF0,0x0B,
-	0xF6,0x74,0x0E,0xFF,0x76,0x04,0xE8,0xC5,0x17,0x59,0x89,
-	0x44,0x02,0x0B,0xC0,0x75,0x04,0x33,0xC0,0xEB,0x36,0xFF,
-	0x76,0x04,0xE8,0x49,0xFF,0x59,0x8B,0xF8,0x8B,0xDF,0xD1,
-	0xE3,0x8B,0x87,0x54,0x21,0x89,0x04,0x8B,0xDF,0xD1,0xE3,
-	0x89,0xB7,0x54,0x21,0xEB,0x07,0xFF,0x74,0x04,0xE8,0xEA,
-	0x34,0x59,0xFF,0x76,0x06,0xE8,0x8F,0x17,0x59,0x89,0x44,
-	0x04,0x0B,0xC0,0x75,0x02,0xEB,0xC8,0x8B,0xC6,0x5F,0x5E,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x0A,0x56,0x39,0x26,
-	0x9A,0x00,0x72,0x03,0xE8,0xED,0x38,0x8B,0x46,0x04,0x3B,
-	0x06,0x30,0x11,0x74,0x02,0xEB,0x27,0xFF,0x76,0x08,0xFF,
-	0x76,0x06,0xB8,0x32,0x11,0x50,0x8D,0x46,0xF6,0x50,0xE8,
-	0xF7,0x16,0x83,0xC4,0x08,0x8D,0x46,0xF6,0x50,0xE8,0x19,
-	0xFF,0x59,0x8B,0xF0,0x0B,0xF6,0x74,0x05,0x8B,0x44,0x04,
-	0xEB,0x03,0x8B,0x46,0x0A,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x81,0xEC,0xF6,0x00,0x56,0x57,0x39,0x26,0x9A,
-	0x00,0x72,0x03,0xE8,0xA1,0x38,0x8B,0x46,0x06,0x89,0x46,
-	0x06,0x83,0x3E,0x30,0x11,0x00,0x74,0x06,0xB8,0xFF,0xFF,
-	0xE9,0x6B,0x01,0xB8,0x5C,0x00,0x50,0xFF,0x76,0x04,0xE8,
-	0xB6,0x27,0x59,0x59,0x0B,0xC0,0x74,0x1A,0xFF,0x76,0x04,
-	0x8D,0x46,0xAA,0x50,0xE8,0x0B,0x28,0x59,0x59,0x8D,0x46,
-	0xAA,0x50,0xE8,0x4E,0x01,0x59,0xA3,0x30,0x11,0xE9,0x25,
-	0x01,0xB8,0x38,0x11,0x50,0xE8,0x83,0x20,0x59,0x8B,0xF0,
-	0x0B,0xF6,0x75,0x02,0xEB,0xC0,0x80,0x3C,0x2E,0x74,0x0E,
-	0xC6,0x46,0xFA,0x2E,0xB8,0x02,0x00,0x50,0x56,0x8D,0x46,
-	0xFB,0xEB,0x08,0xB8,0x02,0x00,0x50,0x56,0x8D,0x46,0xFA,
-	0x50,0xE8,0x81,0x28,0x83,0xC4,0x06,0xC6,0x46,0xFD,0x00,
-	0xB8,0x3D,0x11,0x50,0xE8,0x4D,0x20,0x59,0x89,0x46,0xFE,
-	0x83,0x7E,0xFE,0x00,0x75,0x02,0xEB,0x87,0xFF,0x76,0xFE,
-	0x8D,0x86,0x5A,0xFF,0x50,0xE8,0xA7,0x27,0x59,0x59,0xB8,
-	0x45,0x11,0x50,0x8D,0x86,0x5A,0xFF,0xE9,0xCF,0x00,0xB8,
-	0x02,0x00,0x50,0x57,0xE8,0x17,0xFA,0x59,0x59,0x8D,0x86,
-	0x5A,0xFF,0x50,0x8D,0x86,0x0A,0xFF,0x50,0xE8,0x83,0x27,
-	0x59,0x59,0xB8,0x47,0x11,0x50,0x8D,0x86,0x0A,0xFF,0x50,
-	0xE8,0xD7,0x26,0x59,0x59,0x56,0x8D,0x86,0x0A,0xFF,0x50,
-	0xE8,0xCC,0x26,0x59,0x59,0x33,0xC0,0x50,0xFF,0x76,0x04,
-	0x8D,0x86,0x0A,0xFF,0x50,0x33,0xC0,0x50,0x8D,0x46,0xAA,
-	0x50,0xE8,0x46,0x08,0x83,0xC4,0x0A,0x8D,0x46,0xAA,0x50,
-	0xE8,0x95,0x00,0x59,0xA3,0x30,0x11,0x83,0x3E,0x30,0x11,
-	0x00,0x74,0x02,0xEB,0x66,0x8D,0x46,0xFA,0x50,0xFF,0x76,
-	0x04,0xB8,0x02,0x00,0x50,0xE8,0x2F,0xFA,0x59,0x50,0x33,
-	0xC0,0x50,0x8D,0x46,0xAA,0x50,0xE8,0x15,0x08,0x83,0xC4,
-	0x0A,0x8D,0x46,0xAA,0x50,0xE8,0x64,0x00,0x59,0xA3,0x30,
-	0x11,0x83,0x3E,0x30,0x11,0x00,0x74,0x02,0xEB,0x35,0x80,
-	0x7C,0x02,0x2D,0x75,0x34,0x8D,0x46,0xFA,0x50,0xFF,0x76,
-	0x04,0xB8,0x02,0x00,0x50,0xE8,0xF8,0xF9,0x59,0x50,0x33,
-	0xC0,0x50,0x8D,0x46,0xAA,0x50,0xE8,0xDE,0x07,0x83,0xC4,
-	0x0A,0x8D,0x46,0xAA,0x50,0xE8,0x2D,0x00,0x59,0xA3,0x30,
-	0x11,0x83,0x3E,0x30,0x11,0x00,0x74,0x05,0xA1,0x30,0x11,
-	0xEB,0x17,0xB8,0x49,0x11,0x50,0x33,0xC0,0x50,0xE8,0x1F,
-	0x16,0x59,0x59,0x8B,0xF8,0x0B,0xFF,0x74,0x03,0xE9,0x22,
-	0xFF,0x33,0xC0,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x83,0xEC,0x04,0x56,0x57,0x39,0x26,0x9A,0x00,0x72,
-	0x03,0xE8,0x0C,0x37,0xB8,0x4B,0x11,0x50,0xFF,0x76,0x04,
-	0xE8,0x6E,0x09,0x59,0x59,0x8B,0xF8,0x0B,0xFF,0x75,0x35,
-	0x33,0xC0,0xEB,0x48,0x80,0x3C,0x23,0x74,0x27,0xB8,0x4D,
-	0x11,0x50,0x56,0xE8,0xD8,0x15,0x59,0x59,0x89,0x46,0xFE,
-	0xB8,0x4F,0x11,0x50,0x33,0xC0,0x50,0xE8,0xC9,0x15,0x59,
-	0x59,0x89,0x46,0xFC,0xFF,0x76,0xFC,0xFF,0x76,0xFE,0xE8,
-	0x5A,0xFD,0x59,0x59,0x56,0xE8,0x9C,0x32,0x59,0x33,0xC0,
-	0x50,0x57,0xE8,0x3F,0xFC,0x59,0x59,0x8B,0xF0,0x0B,0xC0,
-	0x75,0xC0,0x57,0xE8,0xBA,0x05,0x59,0xB8,0x01,0x00,0x5F,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x39,0x26,0x9A,
-	0x00,0x72,0x03,0xE8,0x9C,0x36,0x8B,0x46,0x04,0x89,0x46,
-	0x04,0xC7,0x06,0x30,0x11,0x00,0x00,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x83,0xEC,0x14,0x56,0x57,0x8B,0x7E,0x04,0x8B,0x76,
-	0x06,0x0B,0xFF,0x74,0x02,0xEB,0x16,0xB8,0x1C,0x00,0x50,
-	0xB8,0xB4,0x11,0x50,0xB8,0xAD,0x11,0x50,0xB8,0x85,0x11,
-	0x50,0xE8,0xE9,0x01,0x83,0xC4,0x08,0x0B,0xF6,0x74,0x02,
-	0xEB,0x16,0xB8,0x1D,0x00,0x50,0xB8,0xEB,0x11,0x50,0xB8,
-	0xE4,0x11,0x50,0xB8,0xBC,0x11,0x50,0xE8,0xCD,0x01,0x83,
-	0xC4,0x08,0x8C,0x5E,0xFA,0x89,0x7E,0xF2,0x8C,0x5E,0xFC,
-	0x89,0x76,0xF8,0xC7,0x46,0xF6,0x00,0x00,0xC7,0x46,0xF0,
-	0x00,0x00,0x8D,0x46,0xEC,0x50,0xB8,0x56,0x00,0x50,0xE8,
-	0xDC,0x00,0x59,0x59,0xEB,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x14,0x56,0x57,0x8B,0x7E,
-	0x06,0x8B,0x76,0x08,0x0B,0xFF,0x74,0x02,0xEB,0x16,0xB8,
-	0x22,0x00,0x50,0xB8,0x54,0x12,0x50,0xB8,0x4F,0x12,0x50,
-	0xB8,0x27,0x12,0x50,0xE8,0x78,0x01,0x83,0xC4,0x08,0x0B,
-	0xF6,0x74,0x02,0xEB,0x16,0xB8,0x23,0x00,0x50,0xB8,0x88,
-	0x12,0x50,0xB8,0x84,0x12,0x50,0xB8,0x5C,0x12,0x50,0xE8,
-	0x5C,0x01,0x83,0xC4,0x08,0xC7,0x46,0xEC,0x60,0x71,0xB8,
-	0x00,0x80,0x0B,0x46,0x04,0x89,0x46,0xF0,0x8C,0x5E,0xFA,
-	0x89,0x7E,0xF6,0x8C,0x5E,0xFC,0x89,0x76,0xF8,0xC7,0x46,
-	0xFE,0x00,0x00,0xC6,0x04,0x00,0x8D,0x46,0xEC,0x50,0xB8,
-	0x21,0x00,0x50,0xE8,0xBC,0x1E,0x59,0x59,0xF7,0x46,0xFE,
-	0x01,0x00,0x74,0x1E,0x80,0x3C,0x00,0x74,0x14,0x83,0x7E,
-	0xEC,0x03,0x75,0x0E,0x56,0xE8,0x8D,0x25,0x59,0x3D,0xFF,
-	0x00,0x76,0x04,0x33,0xC0,0xEB,0x09,0x8B,0x46,0xEC,0xEB,
-	0x04,0x33,0xC0,0xEB,0x00,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x76,0x04,0xB8,0x02,
-	0x00,0x50,0xE8,0x4C,0xFF,0x83,0xC4,0x06,0xEB,0x00,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x76,0x04,0xB8,
-	0x01,0x00,0x50,0xE8,0x35,0xFF,0x83,0xC4,0x06,0xEB,0x00,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x14,0x56,0x8B,0x76,
-	0x06,0x0B,0xF6,0x74,0x02,0xEB,0x16,0xB8,0x29,0x00,0x50,
-	0xB8,0xF1,0x12,0x50,0xB8,0xEE,0x12,0x50,0xB8,0xC6,0x12,
-	0x50,0xE8,0xAA,0x00,0x83,0xC4,0x08,0xC7,0x44,0x12,0x01,
-	0x00,0xB8,0x14,0x00,0x50,0x56,0x8D,0x46,0xEC,0x50,0xE8,
-	0x7A,0x20,0x83,0xC4,0x06,0xB8,0x00,0x71,0x0B,0x46,0x04,
-	0x89,0x04,0x56,0xB8,0x21,0x00,0x50,0xE8,0x13,0x1E,0x59,
-	0x59,0xF7,0x44,0x12,0x01,0x00,0x74,0x2E,0x83,0x3C,0x01,
-	0x74,0x06,0x81,0x3C,0x00,0x71,0x75,0x23,0x8B,0x46,0x04,
-	0xB1,0x08,0xD3,0xE0,0x89,0x46,0xEC,0xB8,0x14,0x00,0x50,
-	0x8D,0x46,0xEC,0x50,0x56,0xE8,0x3D,0x20,0x83,0xC4,0x06,
-	0x56,0xB8,0x21,0x00,0x50,0xE8,0xDE,0x1D,0x59,0x59,0xF7,
-	0x44,0x12,0x01,0x00,0x74,0x07,0x8B,0x04,0xA3,0x92,0x00,
-	0xEB,0x04,0x33,0xC0,0xEB,0x00,0x5E,0x8B,0xE5,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x33,0xC0,0x50,0xFF,0x76,0x04,0xE8,
-	0x1D,0x18,0x59,0x59,0x8B,0xF0,0x83,0xFE,0xFF,0x75,0x02,
-	0xEB,0x1A,0xF7,0x46,0x06,0x02,0x00,0x74,0x06,0xF7,0xC6,
-	0x01,0x00,0x75,0x04,0x33,0xC0,0xEB,0x09,0xC7,0x06,0x92,
-	0x00,0x05,0x00,0xB8,0xFF,0xFF,0x5E,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xFF,0x76,0x0A,0xFF,0x76,0x08,0xFF,0x76,0x06,0xFF,
-	0x76,0x04,0xB8,0x28,0x14,0x50,0xE8,0x3E,0x07,0x83,0xC4,
-	0x0A,0xE8,0x88,0xA9,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0x3E,
-	0xFC,0x12,0x20,0x75,0x05,0xB8,0x01,0x00,0xEB,0x13,0x8B,
-	0x1E,0xFC,0x12,0xD1,0xE3,0x8B,0x46,0x04,0x89,0x87,0x1E,
-	0x22,0xFF,0x06,0xFC,0x12,0x33,0xC0,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x33,0xC0,0x50,0xFF,0x76,0x04,0xE8,0xA6,0x17,
-	0x59,0x59,0x8B,0xF0,0x83,0xFE,0xFF,0x75,0x04,0x8B,0xC6,
-	0xEB,0x28,0x81,0xE6,0xFE,0xFF,0xF7,0x46,0x06,0x80,0x00,
-	0x75,0x04,0x81,0xCE,0x01,0x00,0x56,0xB8,0x01,0x00,0x50,
-	0xFF,0x76,0x04,0xE8,0x7F,0x17,0x83,0xC4,0x06,0x8B,0xF0,
-	0x83,0xFE,0xFF,0x75,0x02,0xEB,0xD6,0x33,0xC0,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x04,0x0B,0xF6,0x7C,
-	0x05,0x83,0xFE,0x14,0x7C,0x09,0xB8,0x06,0x00,0x50,0xE8,
-	0xBD,0x1D,0xEB,0x0F,0x8B,0xDE,0xD1,0xE3,0xC7,0x87,0x48,
-	0x15,0xFF,0xFF,0x56,0xE8,0x62,0x17,0x59,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x83,0xEC,0x08,0xC6,0x46,0xFB,0x00,0xE8,
-	0x15,0x14,0xB4,0x00,0x89,0x46,0xFE,0xE8,0x0D,0x14,0xB1,
-	0x08,0xD3,0xE8,0xB4,0x00,0x89,0x46,0xFC,0xE9,0xDB,0x00,
-	0x8B,0x5E,0x08,0xFF,0x46,0x08,0x8A,0x07,0x88,0x46,0xFB,
-	0xB4,0x00,0x2D,0x07,0x00,0x8B,0xD8,0x83,0xFB,0x06,0x77,
-	0x2E,0xD1,0xE3,0x2E,0xFF,0xA7,0x4F,0x5A,0xB4,0x0E,0xB0,
-	0x07,0xE8,0xEE,0x17,0xEB,0x76,0xA0,0x8C,0x15,0xB4,0x00,
-	0x3B,0x46,0xFE,0x7D,0x6C,0xFF,0x4E,0xFE,0xEB,0x67,0xA0,
-	0x8C,0x15,0xB4,0x00,0x89,0x46,0xFE,0xEB,0x5D,0xFF,0x46,
-	0xFC,0xEB,0x58,0xA0,0x95,0x15,0xB4,0x00,0x0B,0xC0,0x75,
-	0x2E,0x83,0x3E,0x9B,0x15,0x00,0x74,0x27,0x8A,0x26,0x90,
-	0x15,0x8A,0x46,0xFB,0x89,0x46,0xF8,0x8B,0x46,0xFE,0x40,
-	0x50,0x8B,0x46,0xFC,0x40,0x50,0xE8,0xAC,0x28,0x52,0x50,
-	0x16,0x8D,0x46,0xF8,0x50,0xB8,0x01,0x00,0x50,0xE8,0xC4,
-	0x28,0xEB,0x1E,0x8A,0x56,0xFE,0x8A,0x76,0xFC,0xB4,0x02,
-	0xB7,0x00,0xE8,0x8A,0x17,0x8A,0x1E,0x90,0x15,0x8A,0x46,
-	0xFB,0xB4,0x09,0xB7,0x00,0xB9,0x01,0x00,0xE8,0x79,0x17,
-	0xFF,0x46,0xFE,0xA0,0x8E,0x15,0xB4,0x00,0x3B,0x46,0xFE,
-	0x7D,0x0E,0xA0,0x8C,0x15,0xB4,0x00,0x89,0x46,0xFE,0xA1,
-	0x88,0x15,0x01,0x46,0xFC,0xA0,0x8F,0x15,0xB4,0x00,0x3B,
-	0x46,0xFC,0x7D,0x1C,0xB0,0x06,0x50,0xA0,0x8C,0x15,0x50,
-	0xA0,0x8D,0x15,0x50,0xA0,0x8E,0x15,0x50,0xA0,0x8F,0x15,
-	0x50,0xB0,0x01,0x50,0xE8,0x42,0x0E,0xFF,0x4E,0xFC,0x8B,
-	0x46,0x06,0xFF,0x4E,0x06,0x0B,0xC0,0x74,0x03,0xE9,0x18,
-	0xFF,0x8A,0x56,0xFE,0x8A,0x76,0xFC,0xB4,0x02,0xB7,0x00,
-	0xE8,0x1E,0x17,0x8A,0x46,0xFB,0xB4,0x00,0x8B,0xE5,0x5D,
-	0xC2,0x06,0x00,0x6D,0x59,0x76,0x59,0x94,0x59,0x8F,0x59,
-	0x94,0x59,0x94,0x59,0x85,0x59,0x55,0x8B,0xEC,0xB8,0x2E,
-	0x59,0x50,0x33,0xC0,0x50,0xFF,0x76,0x04,0x8D,0x46,0x06,
-	0x50,0xE8,0x2F,0x23,0x5D,0xC3,0x50,0x53,0x51,0x52,0x06,
-	0x1E,0x56,0x57,0x55,0xBD,0xD3,0x08,0x8E,0xDD,0xFF,0x16,
-	0x5E,0x22,0x0B,0xC0,0x75,0x07,0x33,0xC0,0x50,0xE8,0x9F,
-	0xA6,0x59,0x5D,0x5F,0x5E,0x1F,0x07,0x5A,0x59,0x5B,0x58,
-	0xCF,0x55,0x8B,0xEC,0x8B,0x46,0x04,0xA3,0x5E,0x22,0x0E,
-	0xB8,0x73,0x5A,0x50,0xB8,0x23,0x00,0x50,0xE8,0x4C,0x1B,
-	0x83,0xC4,0x06,0x5D,0xC3,0xC3,0x55,0x8B,0xEC,0xEB,0x0A,
-	0x8B,0x1E,0xFC,0x12,0xD1,0xE3,0xFF,0x97,0x1E,0x22,0xA1,
-	0xFC,0x12,0xFF,0x0E,0xFC,0x12,0x0B,0xC0,0x75,0xEB,0xFF,
-	0x76,0x04,0xE8,0x3A,0xA6,0x59,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x56,0x57,0x8B,0x46,0x06,0x40,0x8B,0xF0,0x2B,0x36,0x8E,
-	0x00,0x8B,0xC6,0x05,0x3F,0x00,0xB1,0x06,0xD3,0xE8,0x8B,
-	0xF0,0x3B,0x36,0x06,0x14,0x75,0x12,0x8B,0x46,0x06,0x8B,
-	0x56,0x04,0x89,0x16,0xA0,0x00,0xA3,0xA2,0x00,0xB8,0x01,
-	0x00,0xEB,0x46,0xB1,0x06,0xD3,0xE6,0x8B,0x3E,0xA6,0x00,
-	0x8B,0xC6,0x03,0x06,0x8E,0x00,0x3B,0xC7,0x76,0x08,0x8B,
-	0xC7,0x2B,0x06,0x8E,0x00,0x8B,0xF0,0x56,0xFF,0x36,0x8E,
-	0x00,0xE8,0xAB,0x20,0x59,0x59,0x8B,0xF8,0x83,0xFF,0xFF,
-	0x75,0x0B,0x8B,0xC6,0xB1,0x06,0xD3,0xE8,0xA3,0x06,0x14,
-	0xEB,0xB8,0xA1,0x8E,0x00,0x03,0xC7,0xC7,0x06,0xA4,0x00,
-	0x00,0x00,0xA3,0xA6,0x00,0x33,0xC0,0x5F,0x5E,0x5D,0xC2,
-	0x04,0x00,0x55,0x8B,0xEC,0x8B,0x0E,0x9E,0x00,0x8B,0x1E,
-	0x9C,0x00,0x8B,0x56,0x06,0x8B,0x46,0x04,0xE8,0xF4,0x2F,
-	0x72,0x20,0x8B,0x0E,0xA6,0x00,0x8B,0x1E,0xA4,0x00,0x8B,
-	0x56,0x06,0x8B,0x46,0x04,0xE8,0xE1,0x2F,0x77,0x0D,0xFF,
-	0x76,0x06,0xFF,0x76,0x04,0xE8,0x50,0xFF,0x0B,0xC0,0x75,
-	0x05,0xB8,0xFF,0xFF,0xEB,0x02,0x33,0xC0,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x83,0xEC,0x08,0x8B,0x16,0xA2,0x00,0xA1,0xA0,
-	0x00,0x8B,0x4E,0x06,0x8B,0x5E,0x04,0xE8,0x7B,0x2C,0x89,
-	0x46,0xFC,0x89,0x56,0xFE,0x8B,0x0E,0x9E,0x00,0x8B,0x1E,
-	0x9C,0x00,0x8B,0x46,0xFC,0xE8,0x9F,0x2F,0x72,0x13,0x8B,
-	0x0E,0xA6,0x00,0x8B,0x1E,0xA4,0x00,0x8B,0x56,0xFE,0x8B,
-	0x46,0xFC,0xE8,0x8C,0x2F,0x76,0x08,0xBA,0xFF,0xFF,0xB8,
-	0xFF,0xFF,0xEB,0x22,0xA1,0xA2,0x00,0x8B,0x16,0xA0,0x00,
-	0x89,0x56,0xF8,0x89,0x46,0xFA,0xFF,0x76,0xFE,0xFF,0x76,
-	0xFC,0xE8,0xE6,0xFE,0x0B,0xC0,0x75,0x02,0xEB,0xDC,0x8B,
-	0x56,0xFA,0x8B,0x46,0xF8,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x57,0x8B,0x76,0x04,0xBF,0xFF,0xFF,0x39,0x74,
-	0x0E,0x74,0x02,0xEB,0x60,0x83,0x7C,0x06,0x00,0x74,0x1E,
-	0x83,0x3C,0x00,0x7D,0x0B,0x56,0xE8,0xA9,0x00,0x59,0x0B,
-	0xC0,0x74,0x02,0xEB,0x4A,0xF7,0x44,0x02,0x04,0x00,0x74,
-	0x07,0xFF,0x74,0x08,0xE8,0x99,0x2C,0x59,0x80,0x7C,0x04,
-	0x00,0x7C,0x0B,0x8A,0x44,0x04,0x98,0x50,0xE8,0xBD,0xFC,
-	0x59,0x8B,0xF8,0xC7,0x44,0x02,0x00,0x00,0xC7,0x44,0x06,
-	0x00,0x00,0xC7,0x04,0x00,0x00,0xC6,0x44,0x04,0xFF,0x83,
-	0x7C,0x0C,0x00,0x74,0x13,0x33,0xC0,0x50,0xFF,0x74,0x0C,
-	0xE8,0x15,0x10,0x50,0xE8,0x04,0x21,0x59,0xC7,0x44,0x0C,
-	0x00,0x00,0x8B,0xC7,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x83,0xEC,0x04,0xC7,0x46,0xFC,0x00,0x00,0xC7,0x46,0xFE,
-	0x00,0x00,0x8B,0x16,0xA6,0x00,0xA1,0xA4,0x00,0x8B,0x0E,
-	0xA2,0x00,0x8B,0x1E,0xA0,0x00,0xE8,0xEA,0x2B,0x89,0x46,
-	0xFC,0x89,0x56,0xFE,0x83,0x7E,0xFE,0x00,0x72,0x10,0x77,
-	0x06,0x83,0x7E,0xFC,0x10,0x76,0x08,0x83,0x6E,0xFC,0x10,
-	0x83,0x5E,0xFE,0x00,0x81,0x66,0xFC,0xF0,0xFF,0x81,0x66,
-	0xFE,0xFF,0xFF,0x8B,0x56,0xFE,0x8B,0x46,0xFC,0x8B,0xE5,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x04,0x0B,
-	0xF6,0x75,0x05,0xE8,0x73,0x00,0xEB,0x6B,0x39,0x74,0x0E,
-	0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x63,0x83,0x3C,0x00,0x7C,
-	0x29,0xF7,0x44,0x02,0x08,0x00,0x75,0x0A,0x8B,0xC6,0x05,
-	0x05,0x00,0x39,0x44,0x0A,0x75,0x16,0xC7,0x04,0x00,0x00,
-	0x8B,0xC6,0x05,0x05,0x00,0x39,0x44,0x0A,0x75,0x08,0x8B,
-	0x44,0x08,0x89,0x44,0x0A,0xEB,0x35,0xEB,0x33,0x8B,0x44,
-	0x06,0x03,0x04,0x40,0x8B,0xF8,0x8B,0x04,0x2B,0xC7,0x89,
-	0x04,0x57,0x8B,0x44,0x08,0x89,0x44,0x0A,0x50,0x8A,0x44,
-	0x04,0x98,0x50,0xE8,0x49,0x10,0x83,0xC4,0x06,0x3B,0xC7,
-	0x74,0x0E,0xF7,0x44,0x02,0x00,0x02,0x75,0x07,0x81,0x4C,
-	0x02,0x10,0x00,0xEB,0x9A,0x33,0xC0,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,0xC7,0x46,0xFE,0x00,
-	0x00,0xBF,0x14,0x00,0xBE,0x08,0x14,0xEB,0x12,0xF7,0x44,
-	0x02,0x03,0x00,0x74,0x08,0x56,0xE8,0x5F,0xFF,0x59,0xFF,
-	0x46,0xFE,0x83,0xC6,0x10,0x8B,0xC7,0x4F,0x0B,0xC0,0x75,
-	0xE7,0x8B,0x46,0xFE,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0x8B,0x76,0x04,0x8B,0x7E,0x06,0x0B,
-	0xFF,0x74,0x0F,0x80,0x3D,0x00,0x74,0x0A,0x8A,0x05,0x88,
-	0x04,0x47,0x46,0xC6,0x04,0x3A,0x46,0x83,0x7E,0x08,0x00,
-	0x74,0x23,0x8B,0x5E,0x08,0x80,0x3F,0x00,0x74,0x1B,0xFF,
-	0x76,0x08,0x56,0xE8,0xA2,0x0D,0x59,0x59,0x8B,0xF0,0x80,
-	0x7C,0xFF,0x5C,0x74,0x0A,0x80,0x7C,0xFF,0x2F,0x74,0x04,
-	0xC6,0x04,0x5C,0x46,0x83,0x7E,0x0A,0x00,0x74,0x0B,0xFF,
-	0x76,0x0A,0x56,0xE8,0x81,0x0D,0x59,0x59,0x8B,0xF0,0x83,
-	0x7E,0x0C,0x00,0x74,0x0B,0xFF,0x76,0x0C,0x56,0xE8,0x70,
-	0x0D,0x59,0x59,0x8B,0xF0,0xC6,0x04,0x00,0x5F,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,0x8B,0x76,0x08,
-	0x33,0xFF,0xC7,0x46,0xFE,0x00,0x00,0x33,0xC9,0x8B,0xDE,
-	0x46,0x8A,0x07,0x8A,0xD0,0x3C,0x72,0x75,0x08,0xBF,0x01,
-	0x00,0xB9,0x01,0x00,0xEB,0x20,0x80,0xFA,0x77,0x75,0x05,
-	0xBF,0x02,0x03,0xEB,0x08,0x80,0xFA,0x61,0x75,0x0D,0xBF,
-	0x02,0x09,0xC7,0x46,0xFE,0x80,0x00,0xB9,0x02,0x00,0xEB,
-	0x04,0x33,0xC0,0xEB,0x72,0x8A,0x04,0x8A,0xD0,0x46,0x80,
-	0xFA,0x2B,0x74,0x0F,0x80,0x3C,0x2B,0x75,0x25,0x80,0xFA,
-	0x74,0x74,0x05,0x80,0xFA,0x62,0x75,0x1B,0x80,0xFA,0x2B,
-	0x75,0x04,0x8A,0x04,0x8A,0xD0,0x8B,0xC7,0x25,0xFC,0xFF,
-	0x0D,0x04,0x00,0x8B,0xF8,0xC7,0x46,0xFE,0x80,0x01,0xB9,
-	0x03,0x00,0x80,0xFA,0x74,0x75,0x06,0x81,0xCF,0x00,0x40,
-	0xEB,0x1E,0x80,0xFA,0x62,0x75,0x06,0x81,0xCF,0x00,0x80,
-	0xEB,0x0F,0xA1,0x70,0x15,0x25,0x00,0xC0,0x0B,0xF8,0x8B,
-	0xC7,0xA9,0x00,0x80,0x74,0x04,0x81,0xC9,0x40,0x00,0xC7,
-	0x06,0x02,0x14,0x6F,0x6E,0x8B,0x5E,0x06,0x89,0x3F,0x8B,
-	0x5E,0x04,0x8B,0x46,0xFE,0x89,0x07,0x8B,0xC1,0x5F,0x5E,
-	0x8B,0xE5,0x5D,0xC2,0x06,0x00,0x55,0x8B,0xEC,0x83,0xEC,
-	0x04,0x56,0x8B,0x76,0x08,0xFF,0x76,0x04,0x8D,0x46,0xFE,
-	0x50,0x8D,0x46,0xFC,0x50,0xE8,0x28,0xFF,0x89,0x44,0x02,
-	0x0B,0xC0,0x74,0x1C,0x80,0x7C,0x04,0x00,0x7D,0x23,0xFF,
-	0x76,0xFC,0xFF,0x76,0xFE,0xFF,0x76,0x06,0xE8,0x8B,0x1A,
-	0x83,0xC4,0x06,0x88,0x44,0x04,0x0A,0xC0,0x7D,0x0D,0xC6,
-	0x44,0x04,0xFF,0xC7,0x44,0x02,0x00,0x00,0x33,0xC0,0xEB,
-	0x41,0x8A,0x44,0x04,0x98,0x50,0xE8,0x10,0x18,0x59,0x0B,
-	0xC0,0x74,0x05,0x81,0x4C,0x02,0x00,0x02,0xB8,0x00,0x02,
-	0x50,0xF7,0x44,0x02,0x00,0x02,0x74,0x05,0xB8,0x01,0x00,
-	0xEB,0x02,0x33,0xC0,0x50,0x33,0xC0,0x50,0x56,0xE8,0x06,
-	0x0B,0x83,0xC4,0x08,0x0B,0xC0,0x74,0x07,0x56,0xE8,0xCF,
-	0xFC,0x59,0xEB,0xC2,0xC7,0x44,0x0C,0x00,0x00,0x8B,0xC6,
-	0x5E,0x8B,0xE5,0x5D,0xC2,0x06,0x00,0x56,0xBE,0x08,0x14,
-	0x80,0x7C,0x04,0x00,0x7C,0x0A,0x8B,0xC6,0x83,0xC6,0x10,
-	0x3D,0x48,0x15,0x72,0xF0,0x80,0x7C,0x04,0x00,0x7C,0x04,
-	0x33,0xC0,0xEB,0x02,0x8B,0xC6,0x5E,0xC3,0x55,0x8B,0xEC,
-	0x56,0xE8,0xD7,0xFF,0x8B,0xF0,0x0B,0xC0,0x75,0x04,0x33,
-	0xC0,0xEB,0x0A,0x56,0xFF,0x76,0x04,0xFF,0x76,0x06,0xE8,
-	0x33,0xFF,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,
-	0x08,0x39,0x74,0x0E,0x74,0x04,0x33,0xC0,0xEB,0x0F,0x56,
-	0xE8,0x6A,0xFC,0x59,0x56,0xFF,0x76,0x04,0xFF,0x76,0x06,
-	0xE8,0x11,0xFF,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x83,
-	0x7E,0x04,0x00,0x7C,0x09,0xE8,0x91,0xFF,0x8B,0xF0,0x0B,
-	0xC0,0x75,0x04,0x33,0xC0,0xEB,0x10,0x8A,0x46,0x04,0x88,
-	0x44,0x04,0x56,0x33,0xC0,0x50,0xFF,0x76,0x06,0xE8,0xE7,
-	0xFE,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0xB8,0x1D,0x65,0x50,
-	0xFF,0x76,0x04,0xFF,0x76,0x06,0x8D,0x46,0x08,0x50,0xE8,
-	0xBC,0x1D,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0x8B,0x7E,0x08,0xE9,0xC7,0x00,0xFF,0x46,0x06,0x8B,0x5E,
-	0x04,0x8B,0x47,0x06,0x3B,0x46,0x06,0x76,0x05,0x8B,0x46,
-	0x06,0xEB,0x06,0x8B,0x5E,0x04,0x8B,0x47,0x06,0x8B,0xF0,
-	0x8B,0x5E,0x04,0xF7,0x47,0x02,0x40,0x00,0x74,0x60,0x83,
-	0x7F,0x06,0x00,0x74,0x5A,0x8B,0x47,0x06,0x3B,0x46,0x06,
-	0x73,0x52,0x83,0x3F,0x00,0x75,0x4D,0xFF,0x4E,0x06,0x33,
-	0xF6,0xEB,0x0C,0x8B,0x5E,0x04,0x03,0x77,0x06,0x8B,0x47,
-	0x06,0x29,0x46,0x06,0x8B,0x5E,0x04,0x8B,0x47,0x06,0x3B,
-	0x46,0x06,0x76,0xE9,0x56,0x57,0x8A,0x47,0x04,0x98,0x50,
-	0xE8,0x4B,0x1B,0x83,0xC4,0x06,0x89,0x46,0xFE,0x03,0x7E,
-	0xFE,0x39,0x76,0xFE,0x74,0x59,0x8B,0xC6,0x2B,0x46,0xFE,
-	0x01,0x46,0x06,0x8B,0x5E,0x04,0x83,0x4F,0x02,0x20,0xEB,
-	0x51,0x8A,0x46,0xFE,0x88,0x05,0x47,0xFF,0x4E,0x06,0x8B,
-	0x46,0x06,0x0B,0xC0,0x74,0x30,0x4E,0x74,0x2D,0x8B,0x5E,
-	0x04,0x8B,0x07,0x48,0x89,0x07,0x0B,0xC0,0x7C,0x12,0x53,
-	0x8B,0x5F,0x0A,0x8B,0xC3,0x5B,0xFF,0x47,0x0A,0x8B,0xD8,
-	0x8A,0x07,0xB4,0x00,0xEB,0x07,0xFF,0x76,0x04,0xE8,0x5E,
-	0x13,0x59,0x89,0x46,0xFE,0x3D,0xFF,0xFF,0x75,0xC0,0x83,
-	0x7E,0xFE,0xFF,0x75,0x02,0xEB,0xAF,0x83,0x7E,0x06,0x00,
-	0x74,0x03,0xE9,0x30,0xFF,0x8B,0x46,0x06,0x5F,0x5E,0x8B,
-	0xE5,0x5D,0xC2,0x06,0x00,0x55,0x8B,0xEC,0x83,0xEC,0x04,
-	0x56,0x8B,0x76,0x06,0x0B,0xF6,0x75,0x02,0xEB,0x36,0x8B,
-	0xDE,0x33,0xC9,0x8B,0x46,0x08,0x33,0xD2,0xE8,0x5D,0x2A,
-	0x89,0x46,0xFC,0x89,0x56,0xFE,0x83,0xFA,0x01,0x77,0x1F,
-	0x72,0x04,0x0B,0xC0,0x73,0x19,0xFF,0x76,0x04,0xFF,0x76,
-	0xFC,0xFF,0x76,0x0A,0xE8,0xDF,0xFE,0x50,0x8B,0x46,0xFC,
-	0x5A,0x2B,0xC2,0x33,0xD2,0xF7,0xF6,0xEB,0x02,0x33,0xC0,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,
-	0x5E,0x04,0x83,0x3F,0x00,0x7D,0x08,0x8B,0x47,0x06,0x03,
-	0x07,0x40,0xEB,0x0A,0x8B,0x5E,0x04,0x8B,0x07,0x99,0x33,
-	0xC2,0x2B,0xC2,0x8B,0xF0,0x8B,0xC8,0x8B,0x5E,0x04,0xF7,
-	0x47,0x02,0x40,0x00,0x74,0x02,0xEB,0x2F,0x8B,0x5E,0x04,
-	0x8B,0x7F,0x0A,0x83,0x3F,0x00,0x7D,0x1D,0xEB,0x09,0x4F,
-	0x8B,0xDF,0x80,0x3F,0x0A,0x75,0x01,0x41,0x8B,0xC6,0x4E,
-	0x0B,0xC0,0x75,0xF0,0xEB,0x10,0x8B,0xDF,0x47,0x80,0x3F,
-	0x0A,0x75,0x01,0x41,0x8B,0xC6,0x4E,0x0B,0xC0,0x75,0xF0,
-	0x8B,0xC1,0x5F,0x5E,0x5D,0xC2,0x02,0x00,0x55,0x8B,0xEC,
-	0x56,0x8B,0x76,0x04,0x56,0xE8,0x40,0xFB,0x59,0x0B,0xC0,
-	0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x4A,0x83,0x7E,0x0A,0x01,
-	0x75,0x10,0x83,0x3C,0x00,0x7E,0x0B,0x56,0xE8,0x76,0xFF,
-	0x99,0x29,0x46,0x06,0x19,0x56,0x08,0x81,0x64,0x02,0x5F,
-	0xFE,0xC7,0x04,0x00,0x00,0x8B,0x44,0x08,0x89,0x44,0x0A,
-	0xFF,0x76,0x0A,0xFF,0x76,0x08,0xFF,0x76,0x06,0x8A,0x44,
-	0x04,0x98,0x50,0xE8,0x5F,0x15,0x83,0xC4,0x08,0x83,0xFA,
-	0xFF,0x75,0x0A,0x3D,0xFF,0xFF,0x75,0x05,0xB8,0xFF,0xFF,
-	0xEB,0x02,0x33,0xC0,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x83,
-	0xEC,0x04,0x56,0x8B,0x76,0x04,0x8A,0x44,0x04,0x98,0x50,
-	0xE8,0x72,0x0A,0x59,0x89,0x46,0xFC,0x89,0x56,0xFE,0x83,
-	0x3C,0x00,0x7D,0x0D,0x56,0xE8,0x16,0xFF,0x99,0x01,0x46,
-	0xFC,0x11,0x56,0xFE,0xEB,0x0B,0x56,0xE8,0x09,0xFF,0x99,
-	0x29,0x46,0xFC,0x19,0x56,0xFE,0x8B,0x56,0xFE,0x8B,0x46,
-	0xFC,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,
-	0x04,0x56,0x8B,0x76,0x06,0x0B,0xF6,0x75,0x05,0x8B,0x46,
-	0x08,0xEB,0x31,0x8B,0xDE,0x33,0xC9,0x8B,0x46,0x08,0x33,
-	0xD2,0xE8,0x04,0x29,0x89,0x46,0xFC,0x89,0x56,0xFE,0x83,
-	0xFA,0x01,0x77,0x18,0x72,0x04,0x0B,0xC0,0x73,0x12,0xFF,
-	0x76,0x04,0xFF,0x76,0xFC,0xFF,0x76,0x0A,0xE8,0xBD,0x02,
-	0x33,0xD2,0xF7,0xF6,0xEB,0x02,0x33,0xC0,0x5E,0x8B,0xE5,
-	0x5D,0xC3,0xB8,0x00,0x33,0xCD,0x21,0x8A,0xC2,0xB4,0x00,
-	0xC3,0x55,0x8B,0xEC,0xB8,0x01,0x33,0x8A,0x56,0x04,0xCD,
-	0x21,0x8A,0xC2,0xB4,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x56,
-	0x8B,0x76,0x04,0xB4,0x2A,0xCD,0x21,0x89,0x0C,0x89,0x54,
-	0x02,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x04,
-	0xB4,0x2C,0xCD,0x21,0x89,0x0C,0x89,0x54,0x02,0x5E,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x56,0x57,0xFF,0x76,0x04,0xFF,0x76,
-	0x06,0xFF,0x76,0x08,0xFF,0x76,0x0A,0xE8,0x46,0x05,0x0B,
-	0xC0,0x75,0x04,0x33,0xC0,0xEB,0x2F,0x8B,0x46,0x08,0x2B,
-	0x46,0x04,0x40,0x8B,0xF8,0x8B,0x76,0x06,0xEB,0x19,0x1E,
-	0xFF,0x76,0x0C,0xFF,0x76,0x04,0x56,0xE8,0x84,0x1F,0x52,
-	0x50,0x57,0xE8,0xE2,0x04,0x8B,0xC7,0xD1,0xE0,0x01,0x46,
-	0x0C,0x46,0x3B,0x76,0x0A,0x7E,0xE2,0xB8,0x01,0x00,0x5F,
-	0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x46,0x08,
-	0x2B,0x46,0x04,0x40,0x8B,0xF8,0x8B,0x76,0x06,0xEB,0x19,
-	0xFF,0x76,0x04,0x56,0xE8,0x50,0x1F,0x52,0x50,0x1E,0xFF,
-	0x76,0x0C,0x57,0xE8,0xAA,0x04,0x8B,0xC7,0xD1,0xE0,0x01,
-	0x46,0x0C,0x46,0x3B,0x76,0x0A,0x7E,0xE2,0xB8,0x01,0x00,
-	0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x06,0x56,
-	0x57,0x8B,0x7E,0x06,0xFF,0x76,0x04,0x57,0xFF,0x76,0x08,
-	0xFF,0x76,0x0A,0xE8,0xBB,0x04,0x0B,0xC0,0x74,0x24,0xFF,
-	0x76,0x0C,0xFF,0x76,0x0E,0x8B,0x46,0x08,0x2B,0x46,0x04,
-	0x8B,0x56,0x0C,0x03,0xD0,0x52,0x8B,0x46,0x0A,0x2B,0xC7,
-	0x8B,0x56,0x0E,0x03,0xD0,0x52,0xE8,0x97,0x04,0x0B,0xC0,
-	0x75,0x04,0x33,0xC0,0xEB,0x5C,0x89,0x7E,0xFE,0x8B,0x46,
-	0x0A,0x89,0x46,0xFC,0xC7,0x46,0xFA,0x01,0x00,0x3B,0x7E,
-	0x0E,0x7D,0x0E,0x8B,0x46,0x0A,0x89,0x46,0xFE,0x89,0x7E,
-	0xFC,0xC7,0x46,0xFA,0xFF,0xFF,0x8B,0x76,0xFE,0xEB,0x29,
-	0xFF,0x76,0x0C,0x8B,0xC6,0x2B,0xC7,0x8B,0x56,0x0E,0x03,
-	0xD0,0x52,0xE8,0xB8,0x1E,0x52,0x50,0xFF,0x76,0x04,0x56,
-	0xE8,0xAF,0x1E,0x52,0x50,0x8B,0x46,0x08,0x2B,0x46,0x04,
-	0x40,0x50,0xE8,0x06,0x04,0x03,0x76,0xFA,0x8B,0x46,0xFC,
-	0x03,0x46,0xFA,0x3B,0xC6,0x75,0xCD,0xB8,0x01,0x00,0x5F,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0xB8,0x1D,0x65,
-	0x50,0xB8,0x18,0x14,0x50,0xFF,0x76,0x04,0x8D,0x46,0x06,
-	0x50,0xE8,0xB0,0x19,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x06,0x8B,0x04,0x48,0x89,0x04,0x56,0x8A,0x46,0x04,
-	0x98,0x50,0xE8,0x05,0x00,0x59,0x59,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x06,0x8A,0x46,0x04,0xA2,0x60,
-	0x22,0x83,0x3C,0xFF,0x7D,0x37,0x8B,0x04,0x40,0x89,0x04,
-	0x8B,0x5C,0x0A,0xFF,0x44,0x0A,0xA0,0x60,0x22,0x88,0x07,
-	0xF7,0x44,0x02,0x08,0x00,0x74,0x1D,0x80,0x3E,0x60,0x22,
-	0x0A,0x74,0x07,0x80,0x3E,0x60,0x22,0x0D,0x75,0x0F,0x56,
-	0xE8,0x85,0xF8,0x59,0x0B,0xC0,0x74,0x06,0xB8,0xFF,0xFF,
-	0xE9,0xB4,0x00,0xE9,0xAC,0x00,0xF7,0x44,0x02,0x90,0x00,
-	0x75,0x07,0xF7,0x44,0x02,0x02,0x00,0x75,0x07,0x81,0x4C,
-	0x02,0x10,0x00,0xEB,0xE2,0x81,0x4C,0x02,0x00,0x01,0x83,
-	0x7C,0x06,0x00,0x74,0x44,0x83,0x3C,0x00,0x74,0x0B,0x56,
-	0xE8,0x4E,0xF8,0x59,0x0B,0xC0,0x74,0x02,0xEB,0xC7,0x8B,
-	0x44,0x06,0xF7,0xD8,0x89,0x04,0x8B,0x5C,0x0A,0xFF,0x44,
-	0x0A,0xA0,0x60,0x22,0x88,0x07,0xF7,0x44,0x02,0x08,0x00,
-	0x74,0x19,0x80,0x3E,0x60,0x22,0x0A,0x74,0x07,0x80,0x3E,
-	0x60,0x22,0x0D,0x75,0x0B,0x56,0xE8,0x1C,0xF8,0x59,0x0B,
-	0xC0,0x74,0x02,0xEB,0x95,0xEB,0x48,0x80,0x3E,0x60,0x22,
-	0x0A,0x75,0x1F,0xF7,0x44,0x02,0x40,0x00,0x75,0x18,0xB8,
-	0x01,0x00,0x50,0xB8,0x76,0x15,0x50,0x8A,0x44,0x04,0x98,
-	0x50,0xE8,0x2F,0x1E,0x83,0xC4,0x06,0x3D,0x01,0x00,0x75,
-	0x18,0xB8,0x01,0x00,0x50,0xB8,0x60,0x22,0x50,0x8A,0x44,
-	0x04,0x98,0x50,0xE8,0x17,0x1E,0x83,0xC4,0x06,0x3D,0x01,
-	0x00,0x74,0x0A,0xF7,0x44,0x02,0x00,0x02,0x75,0x03,0xE9,
-	0x62,0xFF,0xA0,0x60,0x22,0xB4,0x00,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x04,0xB8,0x18,0x14,0x50,0x56,
-	0xE8,0xF4,0xFE,0x59,0x59,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,
-	0x4C,0x4C,0x56,0x57,0x8B,0x7E,0x06,0x8B,0x76,0x04,0x89,
-	0x7E,0xFE,0xF7,0x44,0x02,0x08,0x00,0x74,0x26,0xEB,0x1A,
-	0x56,0x8B,0x5E,0x08,0xFF,0x46,0x08,0x8A,0x07,0x98,0x50,
-	0xE8,0xC8,0xFE,0x59,0x59,0x3D,0xFF,0xFF,0x75,0x05,0x33,
-	0xC0,0xE9,0xF7,0x00,0x8B,0xC7,0x4F,0x0B,0xC0,0x75,0xDF,
-	0xE9,0xEA,0x00,0xF7,0x44,0x02,0x40,0x00,0x75,0x03,0xE9,
-	0x83,0x00,0x83,0x7C,0x06,0x00,0x74,0x65,0x39,0x7C,0x06,
-	0x73,0x28,0x83,0x3C,0x00,0x74,0x0B,0x56,0xE8,0x54,0xF7,
-	0x59,0x0B,0xC0,0x74,0x02,0xEB,0xCC,0x57,0xFF,0x76,0x08,
-	0x8A,0x44,0x04,0x98,0x50,0xE8,0x7B,0x1D,0x83,0xC4,0x06,
-	0x3B,0xC7,0x73,0x02,0xEB,0xB7,0xE9,0xAD,0x00,0x8B,0x04,
-	0x03,0xC7,0x7C,0x1A,0x83,0x3C,0x00,0x75,0x0A,0xB8,0xFF,
-	0xFF,0x2B,0x44,0x06,0x89,0x04,0xEB,0x0B,0x56,0xE8,0x1C,
-	0xF7,0x59,0x0B,0xC0,0x74,0x02,0xEB,0x94,0x57,0xFF,0x76,
-	0x08,0xFF,0x74,0x0A,0xE8,0x9F,0x12,0x83,0xC4,0x06,0x8B,
-	0x04,0x03,0xC7,0x89,0x04,0x01,0x7C,0x0A,0xEB,0x75,0x57,
-	0xFF,0x76,0x08,0x8A,0x44,0x04,0x98,0x50,0xE8,0x2B,0x1D,
-	0x83,0xC4,0x06,0x3B,0xC7,0x73,0x03,0xE9,0x66,0xFF,0xEB,
-	0x5D,0x83,0x7C,0x06,0x00,0x74,0x41,0xEB,0x36,0x8B,0x04,
-	0x40,0x89,0x04,0x0B,0xC0,0x7D,0x16,0x8B,0x5C,0x0A,0xFF,
-	0x44,0x0A,0x53,0x8B,0x5E,0x08,0xFF,0x46,0x08,0x8A,0x07,
-	0x5B,0x88,0x07,0xB4,0x00,0xEB,0x0F,0x56,0x8B,0x5E,0x08,
-	0xFF,0x46,0x08,0x8A,0x07,0x50,0xE8,0xD7,0xFD,0x59,0x59,
-	0x3D,0xFF,0xFF,0x75,0x03,0xE9,0x26,0xFF,0x8B,0xC7,0x4F,
-	0x0B,0xC0,0x75,0xC3,0xEB,0x16,0x57,0xFF,0x76,0x08,0x8A,
-	0x44,0x04,0x98,0x50,0xE8,0x42,0x07,0x83,0xC4,0x06,0x3B,
-	0xC7,0x73,0x03,0xE9,0x07,0xFF,0x8B,0x46,0xFE,0x5F,0x5E,
-	0x8B,0xE5,0x5D,0xC2,0x06,0x00,0x55,0x8B,0xEC,0x8D,0x46,
-	0x04,0x50,0xB8,0x01,0x00,0x50,0x33,0xC0,0x50,0xE8,0xCE,
-	0xF2,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x04,
-	0x56,0xE8,0x87,0x16,0x59,0x8B,0xF8,0x56,0x57,0xB8,0x18,
-	0x14,0x50,0xE8,0xA3,0xFE,0x3B,0xC7,0x74,0x05,0xB8,0xFF,
-	0xFF,0xEB,0x1A,0xB8,0x18,0x14,0x50,0xB8,0x0A,0x00,0x50,
-	0xE8,0x7E,0xFD,0x59,0x59,0x3D,0x0A,0x00,0x74,0x05,0xB8,
-	0xFF,0xFF,0xEB,0x03,0xB8,0x0A,0x00,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x4C,0x4C,0x8B,0x46,0x04,0xD1,0xE8,0x8B,
-	0xC8,0xA0,0x94,0x15,0xB4,0x00,0x50,0x8B,0xC1,0x33,0xD2,
-	0x5B,0xF7,0xF3,0x88,0x46,0xFF,0xB4,0x00,0x8A,0x16,0x94,
-	0x15,0xB6,0x00,0xF7,0xEA,0x8A,0xD1,0x2A,0xD0,0x88,0x56,
-	0xFE,0x8A,0x66,0xFF,0x8A,0x46,0xFE,0x8B,0xE5,0x5D,0xC2,
-	0x04,0x00,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x7E,0x06,0x8B,
-	0x76,0x04,0x8B,0x15,0x3B,0x14,0x74,0x09,0xB7,0x00,0xB4,
-	0x02,0xE8,0x70,0x0A,0x89,0x14,0xFE,0xC2,0x3A,0x16,0x94,
-	0x15,0x72,0x04,0xFE,0xC6,0xB2,0x00,0x89,0x15,0x5F,0x5E,
-	0x5D,0xC2,0x04,0x00,0x55,0x8B,0xEC,0x83,0xEC,0x0A,0x56,
-	0x57,0xE8,0x3D,0x06,0x89,0x46,0xF8,0x89,0x46,0xFA,0x8B,
-	0x46,0x0C,0x3B,0x06,0x99,0x15,0x75,0x05,0xB8,0x01,0x00,
-	0xEB,0x02,0x33,0xC0,0x89,0x46,0xF6,0x0B,0xC0,0x74,0x0C,
-	0xFF,0x76,0x0C,0xFF,0x76,0x0A,0xE8,0x68,0xFF,0x89,0x46,
-	0xFE,0x8B,0x46,0x08,0x3B,0x06,0x99,0x15,0x75,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0x8B,0xF8,0x0B,0xC0,0x74,
-	0x5D,0xFF,0x76,0x08,0xFF,0x76,0x06,0xE8,0x46,0xFF,0x89,
-	0x46,0xFC,0xEB,0x4F,0x0B,0xFF,0x74,0x16,0x8D,0x46,0xFC,
-	0x50,0x8D,0x46,0xFA,0x50,0xE8,0x6B,0xFF,0xB7,0x00,0xB4,
-	0x08,0xE8,0xEC,0x09,0x8B,0xF0,0xEB,0x0A,0xC4,0x5E,0x06,
-	0x26,0x8B,0x37,0x83,0x46,0x06,0x02,0x83,0x7E,0xF6,0x00,
-	0x74,0x1B,0x8D,0x46,0xFE,0x50,0x8D,0x46,0xFA,0x50,0xE8,
-	0x45,0xFF,0x8B,0xC6,0x8A,0xDC,0xB9,0x01,0x00,0xB7,0x00,
-	0xB4,0x09,0xE8,0xBF,0x09,0xEB,0x0A,0xC4,0x5E,0x0A,0x26,
-	0x89,0x37,0x83,0x46,0x0A,0x02,0x8B,0x46,0x04,0xFF,0x4E,
-	0x04,0x0B,0xC0,0x75,0xA7,0x8B,0x56,0xF8,0xB7,0x00,0xB4,
-	0x02,0xE8,0x9F,0x09,0x5F,0x5E,0x8B,0xE5,0x5D,0xC2,0x0A,
-	0x00,0x55,0x8B,0xEC,0xA0,0x95,0x15,0xB4,0x00,0x0B,0xC0,
-	0x75,0x1B,0x83,0x3E,0x9B,0x15,0x00,0x74,0x14,0xFF,0x76,
-	0x0C,0xFF,0x76,0x0A,0xFF,0x76,0x08,0xFF,0x76,0x06,0xFF,
-	0x76,0x04,0xE8,0x9D,0x1A,0xEB,0x12,0xFF,0x76,0x0C,0xFF,
-	0x76,0x0A,0xFF,0x76,0x08,0xFF,0x76,0x06,0xFF,0x76,0x04,
-	0xE8,0x04,0xFF,0x5D,0xC2,0x0A,0x00,0x55,0x8B,0xEC,0xA0,
-	0x94,0x15,0xB4,0x00,0x8B,0xC8,0xA0,0x93,0x15,0xB4,0x00,
-	0x8B,0xD0,0x39,0x4E,0x0A,0x77,0x24,0x39,0x4E,0x06,0x77,
-	0x1F,0x8B,0x46,0x0A,0x3B,0x46,0x06,0x7F,0x17,0x39,0x56,
-	0x08,0x77,0x12,0x39,0x56,0x04,0x77,0x0D,0x8B,0x46,0x08,
-	0x3B,0x46,0x04,0x7F,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,
-	0xC0,0x5D,0xC2,0x08,0x00,0x55,0x8B,0xEC,0x56,0x57,0x8B,
-	0x76,0x08,0x8B,0x7E,0x06,0x8B,0x0C,0xB1,0x20,0xEB,0x05,
-	0x89,0x0C,0x46,0x46,0x47,0x3B,0x7E,0x04,0x7E,0xF6,0x5F,
-	0x5E,0x5D,0xC2,0x06,0x00,0x55,0x8B,0xEC,0x81,0xEC,0xA0,
-	0x00,0xA0,0x95,0x15,0xB4,0x00,0x0B,0xC0,0x74,0x03,0xE9,
-	0x2A,0x01,0x83,0x3E,0x9B,0x15,0x00,0x75,0x03,0xE9,0x20,
-	0x01,0x80,0x7E,0x04,0x01,0x74,0x03,0xE9,0x17,0x01,0xFE,
-	0x46,0x0C,0xFE,0x46,0x0A,0xFE,0x46,0x08,0xFE,0x46,0x06,
-	0x80,0x7E,0x0E,0x06,0x74,0x03,0xE9,0x88,0x00,0x8A,0x46,
-	0x0A,0xB4,0x00,0x50,0x8A,0x46,0x0C,0xB4,0x00,0x50,0x8A,
-	0x46,0x06,0xB4,0x00,0x50,0x8A,0x46,0x08,0xB4,0x00,0x50,
-	0x8A,0x46,0x0A,0xB4,0x00,0x40,0x50,0x8A,0x46,0x0C,0xB4,
-	0x00,0x50,0xE8,0x69,0xFA,0x83,0xC4,0x0C,0x8D,0x86,0x60,
-	0xFF,0x50,0x8A,0x46,0x06,0xB4,0x00,0x50,0x8A,0x46,0x0C,
-	0xB4,0x00,0x50,0x8A,0x46,0x06,0xB4,0x00,0x50,0x8A,0x46,
-	0x0C,0xB4,0x00,0x50,0xE8,0xBF,0xF9,0x83,0xC4,0x0A,0x8D,
-	0x86,0x60,0xFF,0x50,0x8A,0x46,0x0C,0xB4,0x00,0x50,0x8A,
-	0x46,0x08,0xB4,0x00,0x50,0xE8,0x42,0xFF,0x8D,0x86,0x60,
-	0xFF,0x50,0x8A,0x46,0x06,0xB4,0x00,0x50,0x8A,0x46,0x08,
-	0xB4,0x00,0x50,0x8A,0x46,0x06,0xB4,0x00,0x50,0x8A,0x46,
-	0x0C,0xB4,0x00,0x50,0xE8,0xD7,0xF9,0x83,0xC4,0x0A,0xE9,
-	0x93,0x00,0x8A,0x46,0x0A,0xB4,0x00,0x40,0x50,0x8A,0x46,
-	0x0C,0xB4,0x00,0x50,0x8A,0x46,0x06,0xB4,0x00,0x48,0x50,
-	0x8A,0x46,0x08,0xB4,0x00,0x50,0x8A,0x46,0x0A,0xB4,0x00,
-	0x50,0x8A,0x46,0x0C,0xB4,0x00,0x50,0xE8,0xE0,0xF9,0x83,
-	0xC4,0x0C,0x8D,0x86,0x60,0xFF,0x50,0x8A,0x46,0x0A,0xB4,
-	0x00,0x50,0x8A,0x46,0x0C,0xB4,0x00,0x50,0x8A,0x46,0x0A,
-	0xB4,0x00,0x50,0x8A,0x46,0x0C,0xB4,0x00,0x50,0xE8,0x36,
-	0xF9,0x83,0xC4,0x0A,0x8D,0x86,0x60,0xFF,0x50,0x8A,0x46,
-	0x0C,0xB4,0x00,0x50,0x8A,0x46,0x08,0xB4,0x00,0x50,0xE8,
-	0xB9,0xFE,0x8D,0x86,0x60,0xFF,0x50,0x8A,0x46,0x0A,0xB4,
-	0x00,0x50,0x8A,0x46,0x08,0xB4,0x00,0x50,0x8A,0x46,0x0A,
-	0xE9,0x74,0xFF,0x8A,0x3E,0x90,0x15,0x8A,0x66,0x0E,0x8A,
-	0x46,0x04,0x8A,0x6E,0x0A,0x8A,0x4E,0x0C,0x8A,0x76,0x06,
-	0x8A,0x56,0x08,0xE8,0xA3,0x07,0x8B,0xE5,0x5D,0xC2,0x0C,
-	0x00,0xA0,0x0C,0x14,0x98,0x50,0xE8,0x47,0x0D,0x59,0x0B,
-	0xC0,0x75,0x06,0x81,0x26,0x0A,0x14,0xFF,0xFD,0xB8,0x00,
-	0x02,0x50,0xF7,0x06,0x0A,0x14,0x00,0x02,0x74,0x05,0xB8,
-	0x01,0x00,0xEB,0x02,0x33,0xC0,0x50,0x33,0xC0,0x50,0xB8,
-	0x08,0x14,0x50,0xE8,0x38,0x00,0x83,0xC4,0x08,0xA0,0x1C,
-	0x14,0x98,0x50,0xE8,0x13,0x0D,0x59,0x0B,0xC0,0x75,0x06,
-	0x81,0x26,0x1A,0x14,0xFF,0xFD,0xB8,0x00,0x02,0x50,0xF7,
-	0x06,0x1A,0x14,0x00,0x02,0x74,0x05,0xB8,0x02,0x00,0xEB,
-	0x02,0x33,0xC0,0x50,0x33,0xC0,0x50,0xB8,0x18,0x14,0x50,
-	0xE8,0x04,0x00,0x83,0xC4,0x08,0xC3,0x55,0x8B,0xEC,0x56,
-	0x57,0x8B,0x76,0x04,0x8B,0x7E,0x0A,0x39,0x74,0x0E,0x75,
-	0x0C,0x83,0x7E,0x08,0x02,0x7F,0x06,0x81,0xFF,0xFF,0x7F,
-	0x76,0x06,0xB8,0xFF,0xFF,0xE9,0xA6,0x00,0x83,0x3E,0x7A,
-	0x15,0x00,0x75,0x0E,0x81,0xFE,0x18,0x14,0x75,0x08,0xC7,
-	0x06,0x7A,0x15,0x01,0x00,0xEB,0x13,0x83,0x3E,0x78,0x15,
-	0x00,0x75,0x0C,0x81,0xFE,0x08,0x14,0x75,0x06,0xC7,0x06,
-	0x78,0x15,0x01,0x00,0x83,0x3C,0x00,0x74,0x11,0xB8,0x01,
-	0x00,0x50,0x33,0xC0,0x33,0xD2,0x50,0x52,0x56,0xE8,0xF6,
-	0xF6,0x83,0xC4,0x08,0xF7,0x44,0x02,0x04,0x00,0x74,0x07,
-	0xFF,0x74,0x08,0xE8,0x35,0x1E,0x59,0x81,0x64,0x02,0xF3,
-	0xFF,0xC7,0x44,0x06,0x00,0x00,0x8B,0xC6,0x05,0x05,0x00,
-	0x89,0x44,0x08,0x89,0x44,0x0A,0x83,0x7E,0x08,0x02,0x74,
-	0x3D,0x0B,0xFF,0x76,0x39,0xC7,0x06,0x00,0x14,0x90,0x6E,
-	0x83,0x7E,0x06,0x00,0x75,0x16,0x57,0xE8,0xD4,0x1E,0x59,
-	0x89,0x46,0x06,0x0B,0xC0,0x74,0x07,0x81,0x4C,0x02,0x04,
-	0x00,0xEB,0x03,0xE9,0x6D,0xFF,0x8B,0x46,0x06,0x89,0x44,
-	0x0A,0x89,0x44,0x08,0x89,0x7C,0x06,0x83,0x7E,0x08,0x01,
-	0x75,0x05,0x81,0x4C,0x02,0x08,0x00,0x33,0xC0,0x5F,0x5E,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x7E,0x06,0x8B,
-	0x76,0x04,0x57,0xFF,0x76,0x08,0xFF,0x34,0xE8,0x52,0x0D,
-	0x83,0xC4,0x06,0x01,0x3C,0x8B,0x1C,0xC6,0x07,0x00,0x8B,
-	0xC7,0x5F,0x5E,0x5D,0xC2,0x06,0x00,0x55,0x8B,0xEC,0x8B,
-	0x5E,0x04,0xC6,0x07,0x00,0xB8,0xFA,0x6A,0x50,0x8D,0x46,
-	0x04,0x50,0xFF,0x76,0x06,0x8D,0x46,0x08,0x50,0xE8,0x65,
-	0x12,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x5E,0x04,0xC6,0x07,
-	0x00,0xB8,0xFA,0x6A,0x50,0x8D,0x46,0x04,0x50,0xFF,0x76,
-	0x06,0xFF,0x76,0x08,0xE8,0x49,0x12,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0xFF,0x76,0x06,0xE8,0x92,0x11,0x59,0x8B,0xF0,
-	0x40,0x50,0xFF,0x76,0x06,0xFF,0x76,0x04,0xE8,0xEF,0x0C,
-	0x83,0xC4,0x06,0x8B,0x46,0x04,0x03,0xC6,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x57,0xFF,0x76,0x04,0xE8,0x6E,0x11,
-	0x59,0x40,0x8B,0xF0,0x56,0xE8,0x10,0x1E,0x59,0x8B,0xF8,
-	0x0B,0xC0,0x74,0x0B,0x56,0xFF,0x76,0x04,0x57,0xE8,0xC2,
-	0x0C,0x83,0xC4,0x06,0x8B,0xC7,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0xFF,0x76,0x04,0xE8,0x43,0x11,0x59,
-	0x8B,0xF8,0xFF,0x76,0x06,0xE8,0x3A,0x11,0x59,0x8B,0xF0,
-	0x3B,0x76,0x08,0x76,0x03,0x8B,0x76,0x08,0x56,0x8B,0x46,
-	0x04,0x03,0xC7,0x50,0xFF,0x76,0x06,0xE8,0x10,0x0D,0x83,
-	0xC4,0x06,0x8B,0xC7,0x03,0xC6,0x8B,0x5E,0x04,0x03,0xD8,
-	0xC6,0x07,0x00,0x8B,0x46,0x04,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0x83,0x7E,0x04,0x00,0x74,0x26,0x8B,
-	0x46,0x04,0xA3,0x62,0x22,0xEB,0x1E,0x8B,0x76,0x06,0xEB,
-	0x0B,0x8A,0x04,0x8B,0x1E,0x62,0x22,0x3A,0x07,0x74,0x06,
-	0x46,0x80,0x3C,0x00,0x75,0xF0,0x80,0x3C,0x00,0x74,0x0D,
-	0xFF,0x06,0x62,0x22,0x8B,0x1E,0x62,0x22,0x80,0x3F,0x00,
-	0x75,0xD9,0x8B,0x1E,0x62,0x22,0x80,0x3F,0x00,0x75,0x04,
-	0x33,0xC0,0xEB,0x33,0x8B,0x3E,0x62,0x22,0xEB,0x22,0x8B,
-	0x76,0x06,0xEB,0x14,0x8A,0x04,0x8B,0x1E,0x62,0x22,0x3A,
-	0x07,0x75,0x09,0xC6,0x07,0x00,0xFF,0x06,0x62,0x22,0xEB,
-	0x13,0x46,0x80,0x3C,0x00,0x75,0xE7,0xFF,0x06,0x62,0x22,
-	0x8B,0x1E,0x62,0x22,0x80,0x3F,0x00,0x75,0xD5,0x8B,0xC7,
-	0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0xB8,0x01,0x00,0x50,
-	0x33,0xC0,0x33,0xD2,0x50,0x52,0xFF,0x76,0x04,0xE8,0xB1,
-	0x0A,0x83,0xC4,0x08,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x06,0x0B,0xF6,0x75,0x03,0xBE,0x66,0x22,0xC6,0x04,
-	0x00,0xB8,0x7E,0x15,0x50,0x56,0xE8,0x5B,0x0F,0x59,0x59,
-	0xB8,0x0A,0x00,0x50,0x8B,0xC6,0x05,0x03,0x00,0x50,0x33,
-	0xC0,0x50,0xFF,0x76,0x04,0xE8,0x4B,0x0B,0x83,0xC4,0x08,
-	0xB8,0x82,0x15,0x50,0x56,0xE8,0x3B,0x0F,0x59,0x59,0x8B,
-	0xC6,0x5E,0x5D,0xC2,0x04,0x00,0x55,0x8B,0xEC,0x56,0x8B,
-	0x76,0x04,0x56,0x83,0x3E,0x64,0x22,0xFF,0x75,0x05,0xB8,
-	0x02,0x00,0xEB,0x03,0xB8,0x01,0x00,0x01,0x06,0x64,0x22,
-	0xA1,0x64,0x22,0x50,0xE8,0x9C,0xFF,0x8B,0xF0,0x33,0xC0,
-	0x50,0x56,0xE8,0x5B,0xEB,0x59,0x59,0x3D,0xFF,0xFF,0x75,
-	0xD5,0x8B,0xC6,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x56,
-	0x04,0x83,0xFA,0xFF,0x75,0x05,0xB8,0xFF,0xFF,0xEB,0x1A,
-	0x8A,0xC2,0xB4,0x00,0x8B,0xD8,0xF6,0x87,0xFF,0x12,0x04,
-	0x74,0x09,0x8A,0xC2,0xB4,0x00,0x05,0x20,0x00,0xEB,0x04,
-	0x8A,0xC2,0xB4,0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x56,
-	0x04,0x83,0xFA,0xFF,0x75,0x05,0xB8,0xFF,0xFF,0xEB,0x1A,
-	0x8A,0xC2,0xB4,0x00,0x8B,0xD8,0xF6,0x87,0xFF,0x12,0x08,
-	0x74,0x09,0x8A,0xC2,0xB4,0x00,0x05,0xE0,0xFF,0xEB,0x04,
-	0x8A,0xC2,0xB4,0x00,0x5D,0xC3,0xB4,0x03,0xB7,0x00,0xE8,
-	0x0B,0x04,0x8B,0xC2,0xC3,0xE8,0xF3,0xFF,0xB4,0x00,0x8A,
-	0x16,0x8C,0x15,0xB6,0x00,0x2B,0xC2,0x40,0xC3,0xE8,0xE4,
-	0xFF,0xB1,0x08,0xD3,0xE8,0xB4,0x00,0x8A,0x16,0x8D,0x15,
-	0xB6,0x00,0x2B,0xC2,0x40,0xC3,0x55,0x8B,0xEC,0x81,0xEC,
-	0x8A,0x00,0x56,0x57,0x8B,0x46,0x08,0x40,0x3D,0x02,0x00,
-	0x73,0x05,0x33,0xC0,0xE9,0xD6,0x00,0x8B,0x5E,0x04,0xD1,
-	0xE3,0xF7,0x87,0x48,0x15,0x00,0x80,0x74,0x12,0xFF,0x76,
-	0x08,0xFF,0x76,0x06,0xFF,0x76,0x04,0xE8,0x5A,0x15,0x83,
-	0xC4,0x06,0xE9,0xB7,0x00,0x8B,0x5E,0x04,0xD1,0xE3,0x81,
-	0xA7,0x48,0x15,0xFF,0xFD,0x8B,0x46,0x06,0x89,0x46,0xF8,
-	0x8B,0x46,0x08,0x89,0x46,0xFC,0xEB,0x57,0xFF,0x4E,0xFC,
-	0x8B,0x5E,0xF8,0xFF,0x46,0xF8,0x8A,0x07,0x88,0x46,0xFB,
-	0x3C,0x0A,0x75,0x04,0xC6,0x04,0x0D,0x46,0x8A,0x46,0xFB,
-	0x88,0x04,0x46,0x8D,0x86,0x76,0xFF,0x8B,0xD6,0x2B,0xD0,
-	0x81,0xFA,0x80,0x00,0x7C,0x33,0x8B,0xD6,0x2B,0xD0,0x8B,
-	0xFA,0x57,0x50,0xFF,0x76,0x04,0xE8,0x03,0x15,0x83,0xC4,
-	0x06,0x89,0x46,0xFE,0x3B,0xC7,0x74,0x15,0x83,0x7E,0xFE,
-	0x00,0x73,0x05,0xB8,0xFF,0xFF,0xEB,0x4C,0x8B,0x46,0x08,
-	0x2B,0x46,0xFC,0xEB,0x3F,0xEB,0x42,0x8D,0x86,0x76,0xFF,
-	0x8B,0xF0,0x83,0x7E,0xFC,0x00,0x75,0x9D,0x8D,0x86,0x76,
-	0xFF,0x8B,0xD6,0x2B,0xD0,0x8B,0xFA,0x8B,0xC2,0x0B,0xC0,
-	0x76,0x28,0x57,0x8D,0x86,0x76,0xFF,0x50,0xFF,0x76,0x04,
-	0xE8,0xBC,0x14,0x83,0xC4,0x06,0x89,0x46,0xFE,0x3B,0xC7,
-	0x74,0x12,0x83,0x7E,0xFE,0x00,0x73,0x02,0xEB,0xB7,0x8B,
-	0x46,0x08,0x03,0x46,0xFE,0x2B,0xC7,0xEB,0x03,0x8B,0x46,
-	0x08,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x56,0x57,0x33,0xFF,
-	0xBE,0x08,0x14,0xEB,0x10,0xF7,0x44,0x02,0x03,0x00,0x74,
-	0x05,0x56,0xE8,0x7F,0xED,0x59,0x83,0xC6,0x10,0x47,0x83,
-	0xFF,0x14,0x7C,0xEB,0x5F,0x5E,0xC3,0x56,0x57,0xBF,0x04,
-	0x00,0xBE,0x08,0x14,0xEB,0x10,0xF7,0x44,0x02,0x03,0x00,
-	0x74,0x05,0x56,0xE8,0x27,0xEE,0x59,0x4F,0x83,0xC6,0x10,
-	0x0B,0xFF,0x75,0xEC,0x5F,0x5E,0xC3,0x55,0x8B,0xEC,0x83,
-	0xEC,0x06,0x8B,0x46,0x04,0x3B,0x06,0x8A,0x15,0x74,0x37,
-	0xA3,0x8A,0x15,0x8D,0x46,0xFA,0x50,0x8A,0x46,0x04,0xFE,
-	0xC0,0x50,0xE8,0xBE,0x06,0x59,0x59,0x8A,0x46,0xFA,0x98,
-	0x99,0x50,0x8B,0x46,0xFC,0x52,0x99,0x59,0x5B,0xE8,0x65,
-	0x1C,0x0B,0xD2,0x7C,0x0C,0x7F,0x05,0x3D,0xFF,0xFF,0x76,
-	0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,0xA3,0x74,0x22,
-	0xA1,0x74,0x22,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x56,
-	0x57,0xFF,0x76,0x04,0xE8,0xA8,0xFF,0x59,0x0B,0xC0,0x74,
-	0x30,0x8A,0x46,0x04,0x16,0x1F,0x83,0xEC,0x0A,0x8B,0xDC,
-	0x8B,0x56,0x08,0x89,0x17,0x8B,0x56,0x0A,0x89,0x57,0x02,
-	0x8B,0x4E,0x06,0x89,0x4F,0x04,0x8B,0x56,0x0C,0x89,0x57,
-	0x06,0x8C,0x5F,0x08,0xB9,0xFF,0xFF,0xCD,0x25,0x1B,0xC9,
-	0x83,0xC4,0x0A,0xEB,0x10,0x8A,0x46,0x04,0x8B,0x4E,0x06,
-	0x8B,0x56,0x08,0x8B,0x5E,0x0C,0xCD,0x25,0x1B,0xC9,0x5B,
-	0xE3,0x08,0xA3,0x92,0x00,0xB8,0xFF,0xFF,0xEB,0x02,0x33,
-	0xC0,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0xFF,
-	0x76,0x04,0xE8,0x47,0xFF,0x59,0x0B,0xC0,0x74,0x30,0x8A,
-	0x46,0x04,0x16,0x1F,0x83,0xEC,0x0A,0x8B,0xDC,0x8B,0x56,
-	0x08,0x89,0x17,0x8B,0x56,0x0A,0x89,0x57,0x02,0x8B,0x4E,
-	0x06,0x89,0x4F,0x04,0x8B,0x56,0x0C,0x89,0x57,0x06,0x8C,
-	0x5F,0x08,0xB9,0xFF,0xFF,0xCD,0x26,0x1B,0xC9,0x83,0xC4,
-	0x0A,0xEB,0x10,0x8A,0x46,0x04,0x8B,0x4E,0x06,0x8B,0x56,
-	0x08,0x8B,0x5E,0x0C,0xCD,0x26,0x1B,0xC9,0x5B,0xE3,0x08,
-	0xA3,0x92,0x00,0xB8,0xFF,0xFF,0xEB,0x02,0x33,0xC0,0x5F,
-	0x5E,0x5D,0xC3,0xCD,0x11,0xC3,0xCD,0x12,0xC3,0x55,0x8B,
-	0xEC,0x8A,0x66,0x04,0x8B,0x4E,0x08,0x8B,0x56,0x06,0xCD,
-	0x1A,0x92,0x8B,0xD1,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x46,
-	0x04,0x8B,0xD4,0x81,0xEA,0x00,0x02,0x3B,0xC2,0x73,0x07,
-	0xA3,0x9A,0x00,0x33,0xC0,0xEB,0x09,0xC7,0x06,0x92,0x00,
-	0x08,0x00,0xB8,0xFF,0xFF,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,
-	0x46,0x04,0x8B,0x56,0x06,0x03,0x06,0x9A,0x00,0x83,0xD2,
-	0x00,0x8B,0xC8,0x0B,0xD2,0x75,0x10,0x81,0xC1,0x00,0x02,
-	0x72,0x0A,0x3B,0xCC,0x73,0x06,0x87,0x06,0x9A,0x00,0xEB,
-	0x09,0xC7,0x06,0x92,0x00,0x08,0x00,0xB8,0xFF,0xFF,0x5D,
-	0xC3,0x55,0x8B,0xEC,0xFF,0x76,0x04,0xE8,0xA4,0xFF,0x59,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x46,0x04,0x99,0x52,0x50,
-	0xE8,0xB7,0xFF,0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0xB4,
-	0x3B,0x8B,0x56,0x04,0xCD,0x21,0x72,0x04,0x33,0xC0,0xEB,
-	0x04,0x50,0xE8,0x7B,0x06,0x5D,0xC3,0xB4,0x19,0xCD,0x21,
-	0x98,0xC3,0x55,0x8B,0xEC,0xB4,0x0E,0x8A,0x56,0x04,0xCD,
-	0x21,0x98,0x5D,0xC3,0x55,0x8B,0xEC,0x8B,0x4E,0x08,0xB4,
-	0x43,0x8A,0x46,0x06,0x8B,0x56,0x04,0xCD,0x21,0x72,0x03,
-	0x91,0xEB,0x04,0x50,0xE8,0x4D,0x06,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xB4,0x3E,0x8B,0x5E,0x04,0xCD,0x21,0x72,0x0C,0xD1,
-	0xE3,0xC7,0x87,0x48,0x15,0xFF,0xFF,0x33,0xC0,0xEB,0x04,
-	0x50,0xE8,0x2F,0x06,0x5D,0xC3,0x8B,0xC4,0x2B,0x06,0x9A,
-	0x00,0x2D,0x20,0x02,0x73,0x02,0x33,0xC0,0x24,0xF0,0xC3,
-	0x55,0x8B,0xEC,0x56,0x8A,0x66,0x06,0x8B,0x4E,0x08,0x8B,
-	0x56,0x0A,0xCD,0x21,0x72,0x11,0x8B,0xF0,0x8B,0xDE,0xD1,
-	0xE3,0x8B,0x46,0x04,0x89,0x87,0x48,0x15,0x8B,0xC6,0xEB,
-	0x04,0x50,0xE8,0xF7,0x05,0x5E,0x5D,0xC2,0x08,0x00,0x55,
-	0x8B,0xEC,0xFF,0x76,0x04,0xFF,0x76,0x06,0xB0,0x3C,0x50,
-	0xB8,0x04,0x80,0x50,0xE8,0xC2,0xFF,0x5D,0xC3,0x55,0x8B,
-	0xEC,0xFF,0x76,0x04,0xFF,0x76,0x06,0xB0,0x5A,0x50,0xA1,
-	0x70,0x15,0x0D,0x04,0x00,0x50,0xE8,0xAA,0xFF,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xFF,0x76,0x04,0xFF,0x76,0x06,0xB0,0x5B,
-	0x50,0xA1,0x70,0x15,0x0D,0x04,0x00,0x50,0xE8,0x92,0xFF,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x04,0xEB,0x14,
-	0xC4,0x5E,0x06,0xFF,0x46,0x06,0x26,0x8A,0x07,0x8B,0xDE,
-	0x46,0x3A,0x07,0x74,0x04,0x33,0xC0,0xEB,0x08,0x80,0x3C,
-	0x00,0x75,0xE7,0xB8,0x01,0x00,0x5E,0x5D,0xC2,0x06,0x00,
-	0xB4,0x12,0xB3,0x10,0xE8,0x07,0x00,0x8A,0xC3,0x04,0xF0,
-	0xB4,0x00,0xC3,0x55,0x1E,0x51,0xB9,0x40,0x00,0x8E,0xD9,
-	0x59,0x80,0xFC,0x00,0x74,0x09,0x80,0xFC,0x0F,0x74,0x56,
-	0xCD,0x10,0xEB,0x6A,0x3C,0x03,0x75,0x1A,0xB8,0x00,0x1A,
-	0xCD,0x10,0x3C,0x1A,0x74,0x05,0x80,0x26,0x87,0x00,0xFE,
-	0xB4,0x01,0xB9,0x07,0x06,0xCD,0x10,0xB8,0x03,0x00,0xEB,
-	0xDE,0x3C,0x40,0x75,0xDA,0xB3,0x10,0xB4,0x12,0xCD,0x10,
-	0x80,0xFB,0x10,0x74,0x3D,0xB8,0x12,0x11,0x32,0xDB,0xCD,
-	0x10,0xB8,0x00,0x12,0xB3,0x20,0xCD,0x10,0xB8,0x00,0x1A,
-	0xCD,0x10,0x3C,0x1A,0x74,0x26,0x80,0x0E,0x87,0x00,0x01,
-	0xB4,0x01,0xB9,0x00,0x06,0xCD,0x10,0xEB,0x18,0xCD,0x10,
-	0x3C,0x03,0x75,0x12,0x50,0xE8,0x7F,0xFF,0x0A,0xC0,0x58,
-	0x74,0x09,0x80,0x3E,0x84,0x00,0x18,0x74,0x02,0xB0,0x40,
-	0x1F,0x5D,0xC3,0xB4,0x0F,0xE8,0x77,0xFF,0x50,0xE8,0x17,
-	0x00,0x59,0xB4,0x08,0xB7,0x00,0xE8,0x6B,0xFF,0x8A,0xC4,
-	0x24,0x7F,0x8A,0xE0,0x88,0x26,0x91,0x15,0x88,0x26,0x90,
-	0x15,0xC3,0x55,0x8B,0xEC,0x8A,0x46,0x04,0xA2,0x92,0x15,
-	0xB4,0x0F,0xE8,0x4E,0xFF,0x88,0x26,0x94,0x15,0x3A,0x06,
-	0x92,0x15,0x74,0x2D,0xA0,0x92,0x15,0xB4,0x00,0xE8,0x3C,
-	0xFF,0xB4,0x0F,0xE8,0x37,0xFF,0xA2,0x92,0x15,0x88,0x26,
-	0x94,0x15,0x80,0x3E,0x92,0x15,0x03,0x75,0x12,0xB8,0x40,
-	0x00,0x8E,0xC0,0x26,0x80,0x3E,0x84,0x00,0x18,0x7E,0x05,
-	0xC6,0x06,0x92,0x15,0x40,0x80,0x3E,0x92,0x15,0x03,0x76,
-	0x13,0x80,0x3E,0x92,0x15,0x40,0x73,0x0C,0x80,0x3E,0x92,
-	0x15,0x07,0x74,0x05,0xB8,0x01,0x00,0xEB,0x02,0x33,0xC0,
-	0xA2,0x95,0x15,0x80,0x3E,0x92,0x15,0x40,0x74,0x04,0xB0,
-	0x19,0xEB,0x0B,0xB8,0x40,0x00,0x8E,0xC0,0x26,0xA0,0x84,
-	0x00,0xFE,0xC0,0xA2,0x93,0x15,0x80,0x3E,0x92,0x15,0x07,
-	0x74,0x1F,0xB8,0x00,0xF0,0xBA,0xEA,0xFF,0x50,0x52,0xB8,
-	0x9D,0x15,0x50,0xE8,0x91,0xFE,0x0B,0xC0,0x75,0x0C,0xE8,
-	0xB4,0xFE,0x0B,0xC0,0x75,0x05,0xB8,0x01,0x00,0xEB,0x02,
-	0x33,0xC0,0xA2,0x96,0x15,0x80,0x3E,0x92,0x15,0x07,0x75,
-	0x05,0xB8,0x00,0xB0,0xEB,0x03,0xB8,0x00,0xB8,0xA3,0x99,
-	0x15,0xC7,0x06,0x97,0x15,0x00,0x00,0xB0,0x00,0xA2,0x8D,
-	0x15,0xA2,0x8C,0x15,0xA0,0x94,0x15,0x04,0xFF,0xA2,0x8E,
-	0x15,0xA0,0x93,0x15,0x04,0xFF,0xA2,0x8F,0x15,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x83,0xEC,0x04,0x8B,0x5E,0x04,0xD1,0xE3,
-	0xF7,0x87,0x48,0x15,0x00,0x02,0x74,0x05,0xB8,0x01,0x00,
-	0xEB,0x4C,0xB8,0x00,0x44,0x8B,0x5E,0x04,0xCD,0x21,0x72,
-	0x3E,0xF6,0xC2,0x80,0x75,0x35,0xB8,0x01,0x42,0x33,0xC9,
-	0x8B,0xD1,0xCD,0x21,0x72,0x2E,0x52,0x50,0xB8,0x02,0x42,
-	0x33,0xC9,0x8B,0xD1,0xCD,0x21,0x89,0x46,0xFC,0x89,0x56,
-	0xFE,0x5A,0x59,0x72,0x19,0xB8,0x00,0x42,0xCD,0x21,0x72,
-	0x12,0x3B,0x56,0xFE,0x72,0x09,0x77,0x05,0x3B,0x46,0xFC,
-	0x72,0x02,0xEB,0xB7,0x33,0xC0,0xEB,0x04,0x50,0xE8,0x93,
-	0x03,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0x83,0xEC,0x04,
-	0xB8,0x01,0x42,0x8B,0x5E,0x04,0x33,0xC9,0x33,0xD2,0xCD,
-	0x21,0x72,0x24,0x52,0x50,0xB8,0x02,0x42,0x33,0xC9,0x33,
-	0xD2,0xCD,0x21,0x89,0x46,0xFC,0x89,0x56,0xFE,0x5A,0x59,
-	0x72,0x0F,0xB8,0x00,0x42,0xCD,0x21,0x72,0x08,0x8B,0x56,
-	0xFE,0x8B,0x46,0xFC,0xEB,0x05,0x50,0xE8,0x53,0x03,0x99,
-	0x8B,0xE5,0x5D,0xC3,0x56,0x57,0xBF,0x14,0x00,0xBE,0x08,
-	0x14,0xEB,0x13,0x8B,0x44,0x02,0x25,0x00,0x03,0x3D,0x00,
-	0x03,0x75,0x05,0x56,0xE8,0x2A,0xE9,0x59,0x83,0xC6,0x10,
-	0x8B,0xC7,0x4F,0x0B,0xC0,0x75,0xE6,0x5F,0x5E,0xC3,0x55,
-	0x8B,0xEC,0x56,0x8B,0x76,0x04,0xF7,0x44,0x02,0x00,0x02,
-	0x74,0x03,0xE8,0xC8,0xFF,0xFF,0x74,0x06,0x8B,0x44,0x08,
-	0x89,0x44,0x0A,0x50,0x8A,0x44,0x04,0x98,0x50,0xE8,0x16,
-	0x07,0x83,0xC4,0x06,0x89,0x04,0x0B,0xC0,0x7E,0x08,0x83,
-	0x64,0x02,0xDF,0x33,0xC0,0xEB,0x1E,0x83,0x3C,0x00,0x75,
-	0x0E,0x8B,0x44,0x02,0x25,0x7F,0xFE,0x0D,0x20,0x00,0x89,
-	0x44,0x02,0xEB,0x08,0xC7,0x04,0x00,0x00,0x83,0x4C,0x02,
-	0x10,0xB8,0xFF,0xFF,0x5E,0x5D,0xC2,0x02,0x00,0x55,0x8B,
-	0xEC,0x56,0x8B,0x76,0x04,0x8B,0x04,0x40,0x89,0x04,0x56,
-	0xE8,0x04,0x00,0x59,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,
-	0x8B,0x76,0x04,0x83,0x3C,0x00,0x7E,0x10,0x8B,0x04,0x48,
-	0x89,0x04,0x8B,0x5C,0x0A,0xFF,0x44,0x0A,0x8A,0x07,0xE9,
-	0x89,0x00,0x83,0x3C,0x00,0x7C,0x0E,0xF7,0x44,0x02,0x10,
-	0x01,0x75,0x07,0xF7,0x44,0x02,0x01,0x00,0x75,0x09,0x83,
-	0x4C,0x02,0x10,0xB8,0xFF,0xFF,0xEB,0x6F,0x81,0x4C,0x02,
-	0x80,0x00,0x83,0x7C,0x06,0x00,0x74,0x0C,0x56,0xE8,0x4E,
-	0xFF,0x0B,0xC0,0x74,0x02,0xEB,0xE6,0xEB,0xBD,0xF7,0x44,
-	0x02,0x00,0x02,0x74,0x03,0xE8,0x15,0xFF,0xB8,0x01,0x00,
-	0x50,0xB8,0x76,0x22,0x50,0x8A,0x44,0x04,0x98,0x50,0xE8,
-	0x65,0x06,0x83,0xC4,0x06,0x0B,0xC0,0x75,0x20,0x8A,0x44,
-	0x04,0x98,0x50,0xE8,0x4D,0xFE,0x59,0x3D,0x01,0x00,0x74,
-	0x02,0xEB,0xAF,0x8B,0x44,0x02,0x25,0x7F,0xFE,0x0D,0x20,
-	0x00,0x89,0x44,0x02,0xEB,0xA5,0xEB,0xA3,0x80,0x3E,0x76,
-	0x22,0x0D,0x75,0x07,0xF7,0x44,0x02,0x40,0x00,0x74,0xB1,
-	0x83,0x64,0x02,0xDF,0xA0,0x76,0x22,0xB4,0x00,0x5E,0x5D,
-	0xC3,0xB8,0x08,0x14,0x50,0xE8,0x4F,0xFF,0x59,0xC3,0x80,
-	0x3E,0xA4,0x15,0x00,0x74,0x0A,0xC6,0x06,0xA4,0x15,0x00,
-	0xA0,0xA5,0x15,0xEB,0x05,0xB8,0x00,0x07,0xCD,0x21,0xB4,
-	0x00,0xC3,0x56,0x80,0x3E,0xA4,0x15,0x00,0x74,0x07,0xE8,
-	0xDC,0xFF,0x8B,0xF0,0xEB,0x0A,0xE8,0xD5,0xFF,0x8B,0xF0,
-	0x50,0xE8,0x50,0xF1,0x59,0x8B,0xC6,0x5E,0xC3,0x55,0x8B,
-	0xEC,0x80,0x3E,0xA4,0x15,0x00,0x74,0x05,0xB8,0xFF,0xFF,
-	0xEB,0x0B,0xC6,0x06,0xA4,0x15,0x01,0x8B,0x46,0x04,0xA2,
-	0xA5,0x15,0x5D,0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0x56,0x57,
-	0x8B,0x7E,0x04,0x1E,0x07,0x0B,0xFF,0x74,0x1A,0xB0,0x00,
-	0x8A,0x25,0xB9,0xFF,0xFF,0xFC,0xF2,0xAE,0xF7,0xD1,0x49,
-	0x74,0x0B,0x8B,0x3E,0x7E,0x16,0x0B,0xFF,0x89,0x7E,0xFE,
-	0x75,0x0B,0x33,0xC0,0xEB,0x2A,0x83,0x46,0xFE,0x02,0x8B,
-	0x7E,0xFE,0x8B,0x3D,0x0B,0xFF,0x74,0xEF,0x8A,0x05,0x0A,
-	0xC0,0x74,0xE9,0x3A,0xE0,0x75,0xE9,0x8B,0xD9,0x80,0x39,
-	0x3D,0x75,0xE2,0x8B,0x76,0x04,0xF3,0xA6,0x87,0xCB,0x75,
-	0xD9,0x47,0x8B,0xC7,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xFF,0x76,0x04,0xB0,0x00,0x50,0xE8,0x04,0x00,
-	0x59,0x59,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x06,
-	0x1E,0xB4,0x1C,0x8A,0x56,0x04,0xCD,0x21,0x8A,0x27,0x1F,
-	0x89,0x04,0x89,0x54,0x02,0x89,0x4C,0x04,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x57,0x8B,0x76,0x06,0xB4,0x36,0x8A,
-	0x56,0x04,0xCD,0x21,0x8B,0xFB,0x89,0x44,0x06,0x89,0x3C,
-	0x89,0x54,0x02,0x89,0x4C,0x04,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x57,0xB8,0x00,0x57,0x8B,0x5E,0x04,0xCD,0x21,
-	0x72,0x0C,0x8B,0x7E,0x06,0x89,0x0D,0x89,0x55,0x02,0x33,
-	0xC0,0xEB,0x04,0x50,0xE8,0xEE,0x00,0x5F,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xB4,0x35,0x8A,0x46,0x04,0xCD,0x21,0x93,0x8C,
-	0xC2,0x5D,0xC3,0x55,0x8B,0xEC,0xB4,0x25,0x8A,0x46,0x04,
-	0x1E,0xC5,0x56,0x06,0xCD,0x21,0x1F,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x83,0xEC,0x12,0x56,0x57,0x55,0x1E,0x9C,0x8D,0x4E,
-	0xEE,0x89,0x4E,0xFC,0x8C,0x56,0xFE,0xC7,0x46,0xEE,0x8B,
-	0x6E,0xC6,0x46,0xF0,0xDE,0xC6,0x46,0xF1,0xCD,0x8B,0x46,
-	0x04,0x88,0x46,0xF2,0x3C,0x25,0x72,0x1C,0x3C,0x26,0x77,
-	0x18,0xC6,0x46,0xF3,0x36,0xC7,0x46,0xF4,0x8F,0x06,0x89,
-	0x4E,0xF6,0xC6,0x46,0xF8,0xCA,0xC7,0x46,0xF9,0x02,0x00,
-	0xEB,0x0A,0xCF,0xC6,0x46,0xF3,0xCA,0xC7,0x46,0xF4,0x02,
-	0x00,0x8B,0x7E,0x06,0x1E,0x57,0x8B,0x05,0x8B,0x5D,0x02,
-	0x8B,0x4D,0x04,0x8B,0x55,0x06,0xFF,0x75,0x08,0x8B,0x75,
-	0x0A,0x8E,0x45,0x10,0xC5,0x7D,0x0C,0xFF,0x5E,0xFC,0x1E,
-	0x57,0x55,0x9C,0x8B,0xEC,0xC5,0x7E,0x08,0x89,0x05,0x89,
-	0x5D,0x02,0x89,0x4D,0x04,0x89,0x55,0x06,0x89,0x75,0x0A,
-	0x8C,0x45,0x10,0x8F,0x45,0x12,0x8F,0x45,0x08,0x8F,0x45,
-	0x0C,0x8F,0x45,0x0E,0x83,0xC4,0x04,0x0E,0xE8,0xAA,0xFF,
-	0x1F,0x5D,0x5F,0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,
-	0xB4,0x44,0x8A,0x46,0x06,0x8B,0x5E,0x04,0x8B,0x4E,0x0A,
-	0x8B,0x56,0x08,0xCD,0x21,0x72,0x0C,0x83,0x7E,0x06,0x00,
-	0x75,0x04,0x8B,0xC2,0xEB,0x06,0xEB,0x04,0x50,0xE8,0x02,
-	0x00,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x8B,0x76,0x04,0x0B,
-	0xF6,0x7C,0x15,0x83,0xFE,0x58,0x7E,0x03,0xBE,0x57,0x00,
-	0x89,0x36,0xA6,0x15,0x8A,0x84,0xA8,0x15,0x98,0x8B,0xF0,
-	0xEB,0x11,0x8B,0xC6,0xF7,0xD8,0x8B,0xF0,0x83,0xFE,0x23,
-	0x7F,0xE5,0xC7,0x06,0xA6,0x15,0xFF,0xFF,0x89,0x36,0x92,
-	0x00,0xB8,0xFF,0xFF,0x5E,0x5D,0xC2,0x02,0x00,0x55,0x8B,
-	0xEC,0xB8,0x00,0x44,0x8B,0x5E,0x04,0xCD,0x21,0x92,0x25,
-	0x80,0x00,0x5D,0xC3,0xB4,0x0B,0xCD,0x21,0x98,0xC3,0x55,
-	0x8B,0xEC,0x8B,0x5E,0x04,0xD1,0xE3,0x81,0xA7,0x48,0x15,
-	0xFF,0xFD,0xB4,0x42,0x8A,0x46,0x0A,0x8B,0x5E,0x04,0x8B,
-	0x4E,0x08,0x8B,0x56,0x06,0xCD,0x21,0x72,0x02,0xEB,0x05,
-	0x50,0xE8,0x86,0xFF,0x99,0x5D,0xC3,0x55,0x8B,0xEC,0x83,
-	0xEC,0x22,0x56,0x57,0x06,0x8B,0x7E,0x0A,0x1E,0x07,0x8B,
-	0x5E,0x08,0x83,0xFB,0x24,0x77,0x58,0x80,0xFB,0x02,0x72,
-	0x53,0x8B,0x46,0x0C,0x8B,0x4E,0x0E,0x0B,0xC9,0x7D,0x11,
-	0x80,0x7E,0x06,0x00,0x74,0x0B,0xC6,0x05,0x2D,0x47,0xF7,
-	0xD9,0xF7,0xD8,0x83,0xD9,0x00,0x8D,0x76,0xDE,0xE3,0x0F,
-	0x91,0x2B,0xD2,0xF7,0xF3,0x91,0xF7,0xF3,0x88,0x14,0x46,
-	0xE3,0x09,0xEB,0xF1,0x2B,0xD2,0xF7,0xF3,0x88,0x14,0x46,
-	0x0B,0xC0,0x75,0xF5,0x8D,0x4E,0xDE,0xF7,0xD9,0x03,0xCE,
-	0xFC,0x4E,0x8A,0x04,0x2C,0x0A,0x73,0x04,0x04,0x3A,0xEB,
-	0x03,0x02,0x46,0x04,0xAA,0xE2,0xEF,0xB0,0x00,0xAA,0x07,
-	0x8B,0x46,0x0A,0x5F,0x5E,0x8B,0xE5,0x5D,0xC2,0x0C,0x00,
-	0x55,0x8B,0xEC,0x83,0x7E,0x08,0x0A,0x75,0x06,0x8B,0x46,
-	0x04,0x99,0xEB,0x05,0x8B,0x46,0x04,0x33,0xD2,0x52,0x50,
-	0xFF,0x76,0x06,0xFF,0x76,0x08,0xB0,0x01,0x50,0xB0,0x61,
-	0x50,0xE8,0x5E,0xFF,0x5D,0xC3,0x55,0x8B,0xEC,0xFF,0x76,
-	0x06,0xFF,0x76,0x04,0xFF,0x76,0x08,0xFF,0x76,0x0A,0xB0,
-	0x00,0x50,0xB0,0x61,0x50,0xE8,0x44,0xFF,0x5D,0xC3,0x55,
-	0x8B,0xEC,0xFF,0x76,0x06,0xFF,0x76,0x04,0xFF,0x76,0x08,
-	0xFF,0x76,0x0A,0x83,0x7E,0x0A,0x0A,0x75,0x05,0xB8,0x01,
-	0x00,0xEB,0x02,0x33,0xC0,0x50,0xB0,0x61,0x50,0xE8,0x1F,
-	0xFF,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8B,0x46,0x08,
-	0x8B,0xC8,0xE3,0x17,0x8B,0x76,0x04,0x8B,0x7E,0x06,0x8C,
-	0xD8,0x8E,0xC0,0xFC,0xF3,0xA6,0x8A,0x44,0xFF,0x32,0xE4,
-	0x8A,0x4D,0xFF,0x32,0xED,0x2B,0xC1,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x57,0x8C,0xD8,0x8E,0xC0,0x8B,0x7E,
-	0x04,0x8B,0x76,0x06,0x8B,0x4E,0x08,0xD1,0xE9,0xFC,0xF3,
-	0xA5,0x73,0x01,0xA4,0x8B,0x46,0x04,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x57,0x8C,0xD8,0x8E,0xC0,0x8B,0x7E,0x04,
-	0x8B,0x4E,0x06,0x8A,0x46,0x08,0x8A,0xE0,0xFC,0xF7,0xC7,
-	0x01,0x00,0x74,0x04,0xE3,0x09,0xAA,0x49,0xD1,0xE9,0xF3,
-	0xAB,0x73,0x01,0xAA,0x5F,0x5D,0xC3,0x55,0x8B,0xEC,0x8A,
-	0x46,0x06,0x50,0xFF,0x76,0x08,0xFF,0x76,0x04,0xE8,0xC8,
-	0xFF,0x83,0xC4,0x06,0x8B,0x46,0x04,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x57,0xFC,0x8B,0x4E,0x0C,0x8B,0x7E,0x0A,0x8E,
-	0x46,0x08,0x8B,0x76,0x06,0x1E,0x8E,0x5E,0x04,0xD1,0xE9,
-	0xF3,0xA5,0x73,0x01,0xA4,0x1F,0x5F,0x5E,0x5D,0xC3,0x55,
-	0x8B,0xEC,0x56,0x57,0x8C,0xD8,0x8E,0xC0,0x8B,0x46,0x04,
-	0x3B,0x46,0x06,0x73,0x06,0xFD,0xB8,0x01,0x00,0xEB,0x03,
-	0xFC,0x33,0xC0,0x8B,0x76,0x04,0x8B,0x7E,0x06,0x8B,0x4E,
-	0x08,0x0B,0xC0,0x74,0x06,0x03,0xF1,0x4E,0x03,0xF9,0x4F,
-	0xF7,0xC7,0x01,0x00,0x74,0x04,0xE3,0x11,0xA4,0x49,0x2B,
-	0xF0,0x2B,0xF8,0xD1,0xE9,0xF3,0xA5,0x73,0x05,0x03,0xF0,
-	0x03,0xF8,0xA4,0xFC,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,
-	0xFF,0x76,0x08,0xFF,0x76,0x04,0xFF,0x76,0x06,0xE8,0xA6,
-	0xFF,0x83,0xC4,0x06,0x8B,0x46,0x04,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x8B,0x4E,0x04,0xB4,0x3C,0x8B,0x56,0x06,0xCD,0x21,
-	0x72,0x02,0xEB,0x04,0x50,0xE8,0x7D,0xFD,0x5D,0xC2,0x04,
-	0x00,0x55,0x8B,0xEC,0x8B,0x5E,0x04,0x2B,0xC9,0x2B,0xD2,
-	0xB4,0x40,0xCD,0x21,0x5D,0xC2,0x02,0x00,0x55,0x8B,0xEC,
-	0x83,0xEC,0x04,0x56,0x57,0x8B,0x76,0x06,0xF7,0xC6,0x00,
-	0xC0,0x75,0x0C,0xA1,0x70,0x15,0x25,0x00,0xC0,0x8B,0xD6,
-	0x0B,0xD0,0x8B,0xF2,0xF7,0xC6,0x00,0x01,0x74,0x7A,0xA1,
-	0x72,0x15,0x21,0x46,0x08,0x8B,0x46,0x08,0xA9,0x80,0x01,
-	0x75,0x07,0xB8,0x01,0x00,0x50,0xE8,0x2F,0xFD,0x33,0xC0,
-	0x50,0xFF,0x76,0x04,0xE8,0xC0,0xF6,0x59,0x59,0x89,0x46,
-	0xFE,0x3D,0xFF,0xFF,0x75,0x29,0xF7,0x46,0x08,0x80,0x00,
-	0x74,0x04,0x33,0xC0,0xEB,0x03,0xB8,0x01,0x00,0x89,0x46,
-	0xFE,0xF7,0xC6,0xF0,0x00,0x74,0x29,0xFF,0x76,0x04,0x33,
-	0xC0,0x50,0xE8,0x6A,0xFF,0x8B,0xF8,0x0B,0xC0,0x7D,0x13,
-	0xE9,0xB1,0x00,0xF7,0xC6,0x00,0x04,0x74,0x23,0xB8,0x50,
-	0x00,0x50,0xE8,0xE6,0xFC,0xE9,0xA3,0x00,0x57,0xE8,0x94,
-	0xF6,0x59,0xEB,0x17,0xFF,0x76,0x04,0xFF,0x76,0xFE,0xE8,
-	0x41,0xFF,0x8B,0xF8,0x0B,0xC0,0x7D,0x6A,0xE9,0x88,0x00,
-	0xC7,0x46,0xFE,0x00,0x00,0x56,0xFF,0x76,0x04,0xE8,0x84,
-	0x00,0x59,0x59,0x8B,0xF8,0x0B,0xC0,0x7C,0x53,0x33,0xC0,
-	0x50,0x57,0xE8,0x88,0xFC,0x59,0x59,0x89,0x46,0xFC,0xA9,
-	0x80,0x00,0x74,0x1E,0x81,0xCE,0x00,0x20,0xF7,0xC6,0x00,
-	0x80,0x74,0x1E,0x25,0xFF,0x00,0x0D,0x20,0x00,0x50,0xB8,
-	0x01,0x00,0x50,0x57,0xE8,0x65,0xFC,0x83,0xC4,0x06,0xEB,
-	0x0A,0xF7,0xC6,0x00,0x02,0x74,0x04,0x57,0xE8,0x04,0xFF,
-	0x83,0x7E,0xFE,0x00,0x74,0x14,0xF7,0xC6,0xF0,0x00,0x74,
-	0x0E,0xB8,0x01,0x00,0x50,0x50,0xFF,0x76,0x04,0xE8,0x00,
-	0xF6,0x83,0xC4,0x06,0x0B,0xFF,0x7C,0x1D,0xF7,0xC6,0x00,
-	0x03,0x74,0x05,0xB8,0x00,0x10,0xEB,0x02,0x33,0xC0,0x8B,
-	0xD6,0x81,0xE2,0xFF,0xF8,0x0B,0xD0,0x8B,0xDF,0xD1,0xE3,
-	0x89,0x97,0x48,0x15,0x8B,0xC7,0x5F,0x5E,0x8B,0xE5,0x5D,
-	0xC3,0x55,0x8B,0xEC,0x4C,0x4C,0xB0,0x01,0x8B,0x4E,0x06,
-	0xF7,0xC1,0x02,0x00,0x75,0x0A,0xB0,0x02,0xF7,0xC1,0x04,
-	0x00,0x75,0x02,0xB0,0x00,0x8B,0x56,0x04,0xB1,0xF0,0x22,
-	0x4E,0x06,0x0A,0xC1,0xB4,0x3D,0xCD,0x21,0x72,0x1A,0x89,
-	0x46,0xFE,0x8B,0x5E,0xFE,0xD1,0xE3,0x8B,0x46,0x06,0x25,
-	0xFF,0xF8,0x0D,0x00,0x80,0x89,0x87,0x48,0x15,0x8B,0x46,
-	0xFE,0xEB,0x04,0x50,0xE8,0xF2,0xFB,0x8B,0xE5,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x83,0xEC,0x04,0x56,0x57,0x8B,0x46,0x08,
-	0x40,0x3D,0x02,0x00,0x72,0x0D,0x8B,0x5E,0x04,0xD1,0xE3,
-	0xF7,0x87,0x48,0x15,0x00,0x02,0x74,0x05,0x33,0xC0,0xE9,
-	0x8C,0x00,0xFF,0x76,0x08,0xFF,0x76,0x06,0xFF,0x76,0x04,
-	0xE8,0x86,0x00,0x83,0xC4,0x06,0x89,0x46,0xFE,0x40,0x3D,
-	0x02,0x00,0x72,0x0D,0x8B,0x5E,0x04,0xD1,0xE3,0xF7,0x87,
-	0x48,0x15,0x00,0x80,0x74,0x05,0x8B,0x46,0xFE,0xEB,0x62,
-	0x8B,0x4E,0xFE,0x8B,0x76,0x06,0x1E,0x07,0x8B,0xFE,0x8B,
-	0xDE,0xFC,0xAC,0x3C,0x1A,0x74,0x2D,0x3C,0x0D,0x74,0x05,
-	0xAA,0xE2,0xF4,0xEB,0x1C,0xE2,0xF0,0x06,0x53,0xB8,0x01,
-	0x00,0x50,0x8D,0x46,0xFD,0x50,0xFF,0x76,0x04,0xE8,0x3B,
-	0x00,0x83,0xC4,0x06,0x5B,0x07,0xFC,0x8A,0x46,0xFD,0xAA,
-	0x3B,0xFB,0x75,0x02,0xEB,0x99,0xEB,0x20,0x53,0xB8,0x01,
-	0x00,0x50,0xF7,0xD9,0x1B,0xC0,0x50,0x51,0xFF,0x76,0x04,
-	0xE8,0xA5,0xFB,0x83,0xC4,0x08,0x8B,0x5E,0x04,0xD1,0xE3,
-	0x81,0x8F,0x48,0x15,0x00,0x02,0x5B,0x2B,0xFB,0x97,0x5F,
-	0x5E,0x8B,0xE5,0x5D,0xC3,0x55,0x8B,0xEC,0xB4,0x3F,0x8B,
-	0x5E,0x04,0x8B,0x4E,0x08,0x8B,0x56,0x06,0xCD,0x21,0x72,
-	0x02,0xEB,0x04,0x50,0xE8,0x21,0xFB,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x57,0x8C,0xD8,0x8E,0xC0,0xB4,0x56,0x8B,0x56,0x04,
-	0x8B,0x7E,0x06,0xCD,0x21,0x72,0x04,0x33,0xC0,0xEB,0x04,
-	0x50,0xE8,0x03,0xFB,0x5F,0x5D,0xC3,0x55,0x8B,0xEC,0xB4,
-	0x4A,0x8B,0x5E,0x06,0x8E,0x46,0x04,0xCD,0x21,0x72,0x05,
-	0xB8,0xFF,0xFF,0xEB,0x06,0x53,0x50,0xE8,0xE7,0xFA,0x58,
-	0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0xFC,0x8B,0x7E,0x04,
-	0x1E,0x07,0x8B,0xD7,0x32,0xC0,0xB9,0xFF,0xFF,0xF2,0xAE,
-	0x8D,0x75,0xFF,0x8B,0x7E,0x06,0xB9,0xFF,0xFF,0xF2,0xAE,
-	0xF7,0xD1,0x2B,0xF9,0x87,0xF7,0xF7,0xC6,0x01,0x00,0x74,
-	0x02,0xA4,0x49,0xD1,0xE9,0xF3,0xA5,0x73,0x01,0xA4,0x92,
-	0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0xFC,0x8B,0x76,
-	0x04,0x8A,0x5E,0x06,0xF7,0xC6,0x01,0x00,0x74,0x09,0xAC,
-	0x3A,0xC3,0x74,0x19,0x22,0xC0,0x74,0x11,0xAD,0x3A,0xC3,
-	0x74,0x11,0x22,0xC0,0x74,0x08,0x3A,0xE3,0x74,0x08,0x22,
-	0xE4,0x75,0xEF,0x33,0xC0,0xEB,0x04,0x46,0x8D,0x44,0xFE,
-	0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x8C,0xD8,0x8E,
-	0xC0,0xFC,0x33,0xC0,0x8B,0xD8,0x8B,0x7E,0x06,0x8B,0xF7,
-	0x32,0xC0,0xB9,0xFF,0xFF,0xF2,0xAE,0xF7,0xD1,0x8B,0xFE,
-	0x8B,0x76,0x04,0xF3,0xA6,0x8A,0x44,0xFF,0x8A,0x5D,0xFF,
-	0x2B,0xC3,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x56,0x57,
-	0x8C,0xD8,0x8E,0xC0,0xFC,0x8B,0x7E,0x06,0x8B,0xF7,0x32,
-	0xC0,0xB9,0xFF,0xFF,0xF2,0xAE,0xF7,0xD1,0x8B,0x7E,0x04,
-	0xF3,0xA4,0x8B,0x46,0x04,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,
-	0xEC,0x56,0x57,0x8C,0xD8,0x8E,0xC0,0xFC,0x8B,0x76,0x04,
-	0x8B,0x7E,0x06,0x33,0xC0,0x8B,0xD8,0xB9,0x7A,0x61,0xAC,
-	0x8A,0x1D,0x0A,0xC0,0x74,0x1C,0xAE,0x74,0xF6,0x3A,0xC5,
-	0x72,0x06,0x3A,0xC1,0x77,0x02,0x2C,0x20,0x3A,0xDD,0x72,
-	0x07,0x3A,0xD9,0x77,0x03,0x80,0xEB,0x20,0x3A,0xC3,0x74,
-	0xDD,0x2B,0xC3,0x5F,0x5E,0x5D,0xC3,0x55,0x8B,0xEC,0x57,
-	0x8C,0xD8,0x8E,0xC0,0x8B,0x7E,0x04,0x33,0xC0,0xFC,0xB9,
-	0xFF,0xFF,0xF2,0xAE,0x91,0xF7,0xD0,0x48,0x5F,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x57,0x8C,0xD8,0x8E,0xC0,0xFC,0x8B,
-	0x7E,0x06,0x8B,0xF7,0x8B,0x46,0x08,0x8B,0xC8,0xE3,0x1D,
-	0x8B,0xD8,0x32,0xC0,0xF2,0xAE,0x2B,0xD9,0x8B,0xCB,0x8B,
-	0xFE,0x8B,0x76,0x04,0xF3,0xA6,0x8A,0x44,0xFF,0x8A,0x5D,
-	0xFF,0x32,0xE4,0x8A,0xFC,0x2B,0xC3,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0x56,0x57,0x8C,0xD8,0x8E,0xC0,0xFC,0x8B,
-	0x7E,0x06,0x8B,0xF7,0x32,0xC0,0x8B,0x5E,0x08,0x8B,0xCB,
-	0xF2,0xAE,0x2B,0xD9,0x8B,0x7E,0x04,0x87,0xCB,0xF3,0xA4,
-	0x8B,0xCB,0xF3,0xAA,0x8B,0x46,0x04,0x5F,0x5E,0x5D,0xC3,
-	0x55,0x8B,0xEC,0xB4,0x41,0x8B,0x56,0x04,0xCD,0x21,0x72,
-	0x04,0x33,0xC0,0xEB,0x04,0x50,0xE8,0x51,0xF9,0x5D,0xC3,
-	0x8A,0xC6,0xE8,0x02,0x00,0x8A,0xC2,0xD4,0x10,0x86,0xE0,
-	0xE8,0x02,0x00,0x86,0xE0,0x04,0x90,0x27,0x14,0x40,0x27,
-	0xAA,0xC3,0x55,0x8B,0xEC,0x81,0xEC,0x96,0x00,0x56,0x57,
-	0xC7,0x46,0xEE,0x00,0x00,0xC7,0x46,0xEC,0x50,0x00,0xC7,
-	0x46,0xEA,0x00,0x00,0xEB,0x46,0x57,0xB9,0xFF,0xFF,0x32,
-	0xC0,0xF2,0xAE,0xF7,0xD1,0x49,0x5F,0xC3,0x36,0x88,0x05,
-	0x47,0xFE,0x4E,0xEC,0x75,0x2F,0x53,0x51,0x52,0x06,0x8D,
-	0x86,0x6A,0xFF,0x2B,0xF8,0x8D,0x86,0x6A,0xFF,0x50,0x57,
-	0xFF,0x76,0x08,0xFF,0x56,0x0A,0x0B,0xC0,0x75,0x05,0xC7,
-	0x46,0xEA,0x01,0x00,0xC7,0x46,0xEC,0x50,0x00,0x01,0x7E,
-	0xEE,0x8D,0xBE,0x6A,0xFF,0x07,0x5A,0x59,0x5B,0xC3,0x06,
-	0xFC,0x8D,0xBE,0x6A,0xFF,0x89,0x7E,0xFC,0x8B,0x7E,0xFC,
-	0x8B,0x76,0x06,0xAC,0x0A,0xC0,0x74,0x12,0x3C,0x25,0x74,
-	0x11,0x36,0x88,0x05,0x47,0xFE,0x4E,0xEC,0x7F,0xEE,0xE8,
-	0xAC,0xFF,0xEB,0xE9,0xE9,0xEE,0x03,0x89,0x76,0xF0,0xAC,
-	0x3C,0x25,0x74,0xE7,0x89,0x7E,0xFC,0x33,0xC9,0x89,0x4E,
-	0xF2,0x89,0x4E,0xFE,0x88,0x4E,0xF5,0xC7,0x46,0xF8,0xFF,
-	0xFF,0xC7,0x46,0xF6,0xFF,0xFF,0xEB,0x01,0xAC,0x32,0xE4,
-	0x8B,0xD0,0x8B,0xD8,0x80,0xEB,0x20,0x80,0xFB,0x60,0x73,
-	0x13,0x8A,0x9F,0x09,0x16,0x83,0xFB,0x17,0x76,0x03,0xE9,
-	0xA1,0x03,0xD1,0xE3,0x2E,0xFF,0xA7,0x37,0x82,0xE9,0x97,
-	0x03,0x80,0xFD,0x00,0x77,0xF8,0x83,0x4E,0xFE,0x01,0xEB,
-	0xD0,0x80,0xFD,0x00,0x77,0xED,0x83,0x4E,0xFE,0x02,0xEB,
-	0xC5,0x80,0xFD,0x00,0x77,0xE2,0x80,0x7E,0xF5,0x2B,0x74,
-	0x03,0x88,0x56,0xF5,0xEB,0xB5,0x83,0x66,0xFE,0xDF,0xEB,
-	0x04,0x83,0x4E,0xFE,0x20,0xB5,0x05,0xEB,0xA7,0x80,0xFD,
-	0x00,0x77,0x4D,0xF7,0x46,0xFE,0x02,0x00,0x75,0x29,0x83,
-	0x4E,0xFE,0x08,0xB5,0x01,0xEB,0x93,0xE9,0x4C,0x03,0x8B,
-	0x7E,0x04,0x36,0x8B,0x05,0x83,0x46,0x04,0x02,0x80,0xFD,
-	0x02,0x73,0x12,0x0B,0xC0,0x79,0x06,0xF7,0xD8,0x83,0x4E,
-	0xFE,0x02,0x89,0x46,0xF8,0xB5,0x03,0xE9,0x6F,0xFF,0x80,
-	0xFD,0x04,0x75,0xD7,0x89,0x46,0xF6,0xFE,0xC5,0xE9,0x62,
-	0xFF,0x80,0xFD,0x04,0x73,0xCA,0xB5,0x04,0xFF,0x46,0xF6,
-	0xE9,0x55,0xFF,0x92,0x2C,0x30,0x98,0x80,0xFD,0x02,0x77,
-	0x19,0xB5,0x02,0x87,0x46,0xF8,0x0B,0xC0,0x7C,0xD1,0xD1,
-	0xE0,0x8B,0xD0,0xD1,0xE0,0xD1,0xE0,0x03,0xC2,0x01,0x46,
-	0xF8,0xE9,0x33,0xFF,0x80,0xFD,0x04,0x75,0x9B,0x87,0x46,
-	0xF6,0x0B,0xC0,0x74,0xB5,0xD1,0xE0,0x8B,0xD0,0xD1,0xE0,
-	0xD1,0xE0,0x03,0xC2,0x01,0x46,0xF6,0xE9,0x17,0xFF,0x83,
-	0x4E,0xFE,0x10,0xE9,0x65,0xFF,0x81,0x4E,0xFE,0x00,0x01,
-	0x83,0x66,0xFE,0xEF,0xE9,0x59,0xFF,0xB7,0x08,0xEB,0x0A,
-	0xB7,0x0A,0xEB,0x0A,0xB7,0x10,0xB3,0xE9,0x02,0xDA,0xC6,
-	0x46,0xF5,0x00,0x88,0x56,0xFB,0x33,0xD2,0x88,0x56,0xFA,
-	0x8B,0x7E,0x04,0x36,0x8B,0x05,0xEB,0x10,0xB7,0x0A,0xC6,
-	0x46,0xFA,0x01,0x88,0x56,0xFB,0x8B,0x7E,0x04,0x36,0x8B,
-	0x05,0x99,0x47,0x47,0x89,0x76,0x06,0xF7,0x46,0xFE,0x10,
-	0x00,0x74,0x05,0x36,0x8B,0x15,0x47,0x47,0x89,0x7E,0x04,
-	0x8D,0x7E,0xBB,0x0B,0xC0,0x75,0x2F,0x0B,0xD2,0x75,0x2B,
-	0x83,0x7E,0xF6,0x00,0x75,0x29,0x8B,0x7E,0xFC,0x8B,0x4E,
-	0xF8,0xE3,0x1A,0x83,0xF9,0xFF,0x74,0x15,0x8B,0x46,0xFE,
-	0x25,0x08,0x00,0x74,0x04,0xB2,0x30,0xEB,0x02,0xB2,0x20,
-	0x8A,0xC2,0xE8,0x09,0xFE,0xE2,0xF9,0xE9,0x49,0xFE,0x83,
-	0x4E,0xFE,0x04,0x52,0x50,0x57,0x8A,0xC7,0x98,0x50,0x8A,
-	0x46,0xFA,0x50,0x53,0xE8,0x7E,0xF7,0x16,0x07,0x8B,0x56,
-	0xF6,0x0B,0xD2,0x7F,0x03,0xE9,0xF1,0x00,0xE9,0xFC,0x00,
-	0x88,0x56,0xFB,0x89,0x76,0x06,0x8D,0x7E,0xBA,0x8B,0x5E,
-	0x04,0x36,0xFF,0x37,0x43,0x43,0x89,0x5E,0x04,0xF7,0x46,
-	0xFE,0x20,0x00,0x74,0x10,0x36,0x8B,0x17,0x43,0x43,0x89,
-	0x5E,0x04,0x16,0x07,0xE8,0x7B,0xFD,0xB0,0x3A,0xAA,0x16,
-	0x07,0x5A,0xE8,0x72,0xFD,0x36,0xC6,0x05,0x00,0xC6,0x46,
-	0xFA,0x00,0x83,0x66,0xFE,0xFB,0x8D,0x4E,0xBA,0x2B,0xF9,
-	0x87,0xCF,0x8B,0x56,0xF6,0x3B,0xD1,0x7F,0x02,0x8B,0xD1,
-	0xE9,0x9E,0x00,0x89,0x76,0x06,0x88,0x56,0xFB,0x8B,0x7E,
-	0x04,0x36,0x8B,0x05,0x83,0x46,0x04,0x02,0x16,0x07,0x8D,
-	0x7E,0xBB,0x32,0xE4,0x36,0x89,0x05,0xB9,0x01,0x00,0xE9,
-	0xB9,0x00,0x89,0x76,0x06,0x88,0x56,0xFB,0x8B,0x7E,0x04,
-	0xF7,0x46,0xFE,0x20,0x00,0x75,0x0D,0x36,0x8B,0x3D,0x83,
-	0x46,0x04,0x02,0x1E,0x07,0x0B,0xFF,0xEB,0x0B,0x36,0xC4,
-	0x3D,0x83,0x46,0x04,0x04,0x8C,0xC0,0x0B,0xC7,0x75,0x05,
-	0x1E,0x07,0xBF,0x02,0x16,0xE8,0x33,0xFD,0x3B,0x4E,0xF6,
-	0x76,0x03,0x8B,0x4E,0xF6,0xEB,0x7D,0x89,0x76,0x06,0x88,
-	0x56,0xFB,0x8B,0x7E,0x04,0x8B,0x4E,0xF6,0x0B,0xC9,0x7D,
-	0x03,0xB9,0x06,0x00,0x57,0x51,0x8D,0x5E,0xBB,0x53,0x52,
-	0xB8,0x01,0x00,0x23,0x46,0xFE,0x50,0x8B,0x46,0xFE,0xA9,
-	0x00,0x01,0x74,0x09,0xB8,0x08,0x00,0x83,0x46,0x04,0x0A,
-	0xEB,0x07,0x83,0x46,0x04,0x08,0xB8,0x06,0x00,0x50,0xE8,
-	0xB1,0x0A,0x16,0x07,0x8D,0x7E,0xBB,0xF7,0x46,0xFE,0x08,
-	0x00,0x74,0x18,0x8B,0x56,0xF8,0x0B,0xD2,0x7E,0x11,0xE8,
-	0xD6,0xFC,0x26,0x80,0x3D,0x2D,0x75,0x01,0x49,0x2B,0xD1,
-	0x7E,0x03,0x89,0x56,0xF2,0x8A,0x46,0xF5,0x0A,0xC0,0x74,
-	0x12,0x26,0x80,0x3D,0x2D,0x74,0x0C,0x83,0x6E,0xF2,0x01,
-	0x83,0x56,0xF2,0x00,0x4F,0x26,0x88,0x05,0xE8,0xAC,0xFC,
-	0x8B,0xF7,0x8B,0x7E,0xFC,0x8B,0x5E,0xF8,0xB8,0x05,0x00,
-	0x23,0x46,0xFE,0x3D,0x05,0x00,0x75,0x13,0x8A,0x66,0xFB,
-	0x80,0xFC,0x6F,0x75,0x0D,0x83,0x7E,0xF2,0x00,0x7F,0x05,
-	0xC7,0x46,0xF2,0x01,0x00,0xEB,0x1B,0x80,0xFC,0x78,0x74,
-	0x05,0x80,0xFC,0x58,0x75,0x11,0x83,0x4E,0xFE,0x40,0x4B,
-	0x4B,0x83,0x6E,0xF2,0x02,0x7D,0x05,0xC7,0x46,0xF2,0x00,
-	0x00,0x03,0x4E,0xF2,0xF7,0x46,0xFE,0x02,0x00,0x75,0x0C,
-	0xEB,0x06,0xB0,0x20,0xE8,0x65,0xFC,0x4B,0x3B,0xD9,0x7F,
-	0xF6,0xF7,0x46,0xFE,0x40,0x00,0x74,0x0B,0xB0,0x30,0xE8,
-	0x54,0xFC,0x8A,0x46,0xFB,0xE8,0x4E,0xFC,0x8B,0x56,0xF2,
-	0x0B,0xD2,0x7E,0x27,0x2B,0xCA,0x2B,0xDA,0x26,0x8A,0x04,
-	0x3C,0x2D,0x74,0x08,0x3C,0x20,0x74,0x04,0x3C,0x2B,0x75,
-	0x07,0x26,0xAC,0xE8,0x2F,0xFC,0x49,0x4B,0x87,0xCA,0xE3,
-	0x07,0xB0,0x30,0xE8,0x24,0xFC,0xE2,0xF9,0x87,0xCA,0xE3,
-	0x12,0x2B,0xD9,0x26,0xAC,0x36,0x88,0x05,0x47,0xFE,0x4E,
-	0xEC,0x7F,0x03,0xE8,0x17,0xFC,0xE2,0xF0,0x0B,0xDB,0x7E,
-	0x09,0x8B,0xCB,0xB0,0x20,0xE8,0x01,0xFC,0xE2,0xF9,0xE9,
-	0x41,0xFC,0x89,0x76,0x06,0x8B,0x7E,0x04,0xF7,0x46,0xFE,
-	0x20,0x00,0x75,0x0B,0x36,0x8B,0x3D,0x83,0x46,0x04,0x02,
-	0x1E,0x07,0xEB,0x07,0x36,0xC4,0x3D,0x83,0x46,0x04,0x04,
-	0xB8,0x50,0x00,0x2A,0x46,0xEC,0x03,0x46,0xEE,0x26,0x89,
-	0x05,0xF7,0x46,0xFE,0x10,0x00,0x74,0x07,0x47,0x47,0x26,
-	0xC7,0x05,0x00,0x00,0xE9,0x02,0xFC,0x8B,0x76,0xF0,0x8B,
-	0x7E,0xFC,0xB0,0x25,0xE8,0xB5,0xFB,0xAC,0x0A,0xC0,0x75,
-	0xF8,0x80,0x7E,0xEC,0x50,0x7D,0x03,0xE8,0xB0,0xFB,0x07,
-	0x83,0x7E,0xEA,0x00,0x74,0x05,0xB8,0xFF,0xFF,0xEB,0x03,
-	0x8B,0x46,0xEE,0x5F,0x5E,0x8B,0xE5,0x5D,0xC2,0x08,0x00,
-	0x86,0x7E,0x70,0x7E,0xBB,0x7E,0x7B,0x7E,0xE9,0x7E,0xF6,
-	0x7E,0x34,0x7F,0x3B,0x7F,0x40,0x7F,0xA4,0x7E,0x69,0x7F,
-	0x47,0x7F,0x4B,0x7F,0x4F,0x7F,0xE5,0x7F,0x91,0x80,0x35,
-	0x80,0x55,0x80,0xCB,0x81,0x07,0x82,0x07,0x82,0x07,0x82,
-	0x96,0x7E,0x9C,0x7E,0x55,0x8B,0xEC,0x8B,0x46,0x04,0x48,
-	0x8A,0x16,0x94,0x15,0xB6,0x00,0xF7,0xEA,0x50,0xA1,0x97,
-	0x15,0x5A,0x03,0xC2,0x8B,0x56,0x06,0x4A,0x03,0xC2,0xD1,
-	0xE0,0x8B,0x16,0x99,0x15,0x5D,0xC2,0x04,0x00,0x55,0x8B,
-	0xEC,0x4C,0x4C,0x56,0x57,0xA0,0x96,0x15,0xB4,0x00,0x89,
-	0x46,0xFE,0x1E,0x8B,0x4E,0x04,0xE3,0x5A,0xC4,0x7E,0x0A,
-	0xC5,0x76,0x06,0xFC,0x3B,0xF7,0x73,0x0A,0x8B,0xC1,0x48,
-	0xD1,0xE0,0x03,0xF0,0x03,0xF8,0xFD,0x83,0x7E,0xFE,0x00,
-	0x75,0x04,0xF3,0xA5,0xEB,0x3B,0xBA,0xDA,0x03,0x8C,0xC0,
-	0x8C,0xDB,0x3B,0xC3,0x74,0x11,0xFA,0xEC,0xD0,0xC8,0x72,
-	0xFB,0xEC,0xD0,0xC8,0x73,0xFB,0xA5,0xFB,0xE2,0xF1,0xEB,
-	0x1F,0xFA,0xEC,0xD0,0xC8,0x72,0xFB,0xEC,0xD0,0xC8,0x73,
-	0xFB,0xAD,0xFB,0x8B,0xD8,0xEC,0xD0,0xC8,0x72,0xFB,0xEC,
-	0xD0,0xC8,0x73,0xFB,0x8B,0xC3,0xAB,0xFB,0xE2,0xE1,0xFC,
-	0x1F,0x5F,0x5E,0x8B,0xE5,0x5D,0xC2,0x0A,0x00,0x55,0x8B,
-	0xEC,0x8B,0x5E,0x04,0xD1,0xE3,0xF7,0x87,0x48,0x15,0x00,
-	0x08,0x74,0x13,0xB8,0x02,0x00,0x50,0x33,0xC0,0x33,0xD2,
-	0x50,0x52,0xFF,0x76,0x04,0xE8,0x05,0xF4,0x83,0xC4,0x08,
-	0xB4,0x40,0x8B,0x5E,0x04,0x8B,0x4E,0x08,0x8B,0x56,0x06,
-	0xCD,0x21,0x72,0x0F,0x50,0x8B,0x5E,0x04,0xD1,0xE3,0x81,
-	0x8F,0x48,0x15,0x00,0x10,0x58,0xEB,0x04,0x50,0xE8,0x8C,
-	0xF3,0x5D,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x3B,0x16,0x50,
-	0x83,0x74,0x37,0x8E,0xDA,0x8E,0x1E,0x02,0x00,0x83,0x3E,
-	0x02,0x00,0x00,0x74,0x07,0x2E,0x8C,0x1E,0x52,0x83,0xEB,
-	0x38,0x8C,0xD8,0x2E,0x3B,0x06,0x50,0x83,0x74,0x15,0xA1,
-	0x08,0x00,0x2E,0xA3,0x52,0x83,0x1E,0x33,0xC0,0x50,0xE8,
-	0xA1,0x00,0x2E,0x8E,0x1E,0x56,0x83,0xEB,0x23,0x2E,0x8B,
-	0x16,0x50,0x83,0x2E,0xC7,0x06,0x50,0x83,0x00,0x00,0x2E,
-	0xC7,0x06,0x52,0x83,0x00,0x00,0x2E,0xC7,0x06,0x54,0x83,
-	0x00,0x00,0x2E,0x8E,0x1E,0x56,0x83,0x52,0x33,0xC0,0x50,
-	0xE8,0x9B,0xD7,0x58,0x58,0xC3,0x8E,0xDA,0x1E,0x8E,0x06,
-	0x02,0x00,0xC7,0x06,0x02,0x00,0x00,0x00,0x8C,0x06,0x08,
-	0x00,0x2E,0x3B,0x16,0x50,0x83,0x74,0x2E,0x26,0x83,0x3E,
-	0x02,0x00,0x00,0x75,0x26,0xA1,0x00,0x00,0x5B,0x06,0x26,
-	0x01,0x06,0x00,0x00,0x8C,0xC1,0x03,0xD0,0x8E,0xC2,0x26,
-	0x83,0x3E,0x02,0x00,0x00,0x75,0x07,0x26,0x89,0x0E,0x08,
-	0x00,0xEB,0x0A,0x26,0x89,0x0E,0x02,0x00,0xEB,0x03,0xE8,
-	0x51,0x00,0x07,0x8C,0xC0,0x26,0x03,0x06,0x00,0x00,0x8E,
-	0xD8,0x83,0x3E,0x02,0x00,0x00,0x74,0x01,0xC3,0xA1,0x00,
-	0x00,0x26,0x01,0x06,0x00,0x00,0x8C,0xC0,0x8C,0xDB,0x03,
-	0x1E,0x00,0x00,0x8E,0xC3,0x26,0xA3,0x02,0x00,0x8C,0xDB,
-	0x3B,0x1E,0x06,0x00,0x74,0x19,0x8E,0x06,0x06,0x00,0x8E,
-	0x1E,0x04,0x00,0x8C,0x06,0x06,0x00,0x26,0x8C,0x1E,0x04,
-	0x00,0x2E,0x8C,0x1E,0x54,0x83,0x8E,0xDB,0xC3,0x2E,0xC7,
-	0x06,0x54,0x83,0x00,0x00,0xC3,0x2E,0xA1,0x54,0x83,0x0B,
-	0xC0,0x74,0x20,0x8C,0xD3,0xFA,0x8E,0xD0,0x36,0x8E,0x06,
-	0x06,0x00,0x36,0x8C,0x1E,0x06,0x00,0x8C,0x16,0x04,0x00,
-	0x8E,0xD3,0xFB,0x26,0x8C,0x1E,0x04,0x00,0x8C,0x06,0x06,
-	0x00,0xC3,0x2E,0x8C,0x1E,0x54,0x83,0x8C,0x1E,0x04,0x00,
-	0x8C,0x1E,0x06,0x00,0xC3,0x55,0x8B,0xEC,0x56,0x57,0x2E,
-	0x8C,0x1E,0x56,0x83,0x8B,0x56,0x06,0x0B,0xD2,0x74,0x0F,
-	0x2E,0x3B,0x16,0x52,0x83,0x75,0x05,0xE8,0xB3,0xFE,0xEB,
-	0x03,0xE8,0x10,0xFF,0x2E,0x8E,0x1E,0x56,0x83,0x5F,0x5E,
-	0x5D,0xC3,0x50,0x2E,0x8E,0x1E,0x56,0x83,0x33,0xC0,0x50,
-	0x50,0xE8,0xD1,0xD6,0x5B,0x5B,0x25,0x0F,0x00,0x74,0x13,
-	0xBA,0x10,0x00,0x2B,0xD0,0x33,0xC0,0x2E,0x8E,0x1E,0x56,
-	0x83,0x50,0x52,0xE8,0xB9,0xD6,0x5B,0x5B,0x58,0x50,0x33,
-	0xDB,0x8A,0xDC,0xB1,0x04,0xD3,0xEB,0xD3,0xE0,0x2E,0x8E,
-	0x1E,0x56,0x83,0x53,0x50,0xE8,0xA1,0xD6,0x5B,0x5B,0x5B,
-	0x3D,0xFF,0xFF,0x74,0x18,0x2E,0x89,0x16,0x50,0x83,0x2E,
-	0x89,0x16,0x52,0x83,0x8E,0xDA,0x89,0x1E,0x00,0x00,0x89,
-	0x16,0x02,0x00,0xB8,0x04,0x00,0xC3,0x33,0xC0,0x99,0xC3,
-	0x50,0x33,0xDB,0x8A,0xDC,0xB1,0x04,0xD3,0xEB,0xD3,0xE0,
-	0x2E,0x8E,0x1E,0x56,0x83,0x53,0x50,0xE8,0x68,0xD6,0x5B,
-	0x5B,0x5B,0x3D,0xFF,0xFF,0x74,0x18,0x2E,0x8B,0x0E,0x52,
-	0x83,0x2E,0x89,0x16,0x52,0x83,0x8E,0xDA,0x89,0x1E,0x00,
-	0x00,0x89,0x0E,0x02,0x00,0xB8,0x04,0x00,0xC3,0x33,0xC0,
-	0x99,0xC3,0x8B,0xDA,0x29,0x06,0x00,0x00,0x03,0x16,0x00,
-	0x00,0x8E,0xDA,0xA3,0x00,0x00,0x89,0x1E,0x02,0x00,0x8B,
-	0xDA,0x03,0x1E,0x00,0x00,0x8E,0xDB,0x89,0x16,0x02,0x00,
-	0xB8,0x04,0x00,0xC3,0x55,0x8B,0xEC,0x8B,0x56,0x06,0x8B,
-	0x46,0x04,0x56,0x57,0x2E,0x8C,0x1E,0x56,0x83,0x8B,0xC8,
-	0x0B,0xCA,0x74,0x5E,0x05,0x13,0x00,0x83,0xD2,0x00,0x72,
-	0x41,0xF7,0xC2,0xF0,0xFF,0x75,0x3B,0xB1,0x04,0xD3,0xE8,
-	0xD3,0xE2,0x0A,0xE2,0x2E,0x8B,0x16,0x50,0x83,0x0B,0xD2,
-	0x74,0x20,0x2E,0x8B,0x16,0x54,0x83,0x0B,0xD2,0x74,0x12,
-	0x8B,0xDA,0x8E,0xDA,0x39,0x06,0x00,0x00,0x73,0x1C,0x8B,
-	0x16,0x06,0x00,0x3B,0xD3,0x75,0xF0,0xE8,0x51,0xFF,0xEB,
-	0x1F,0xE8,0xEB,0xFE,0xEB,0x1A,0xE8,0x80,0xFF,0xEB,0x15,
-	0x33,0xC0,0x99,0xEB,0x10,0x77,0xF4,0xE8,0x52,0xFE,0x8B,
-	0x1E,0x08,0x00,0x89,0x1E,0x02,0x00,0xB8,0x04,0x00,0x2E,
-	0x8E,0x1E,0x56,0x83,0x5F,0x5E,0x5D,0xC3,0x53,0x2E,0x8B,
-	0x36,0x58,0x83,0x56,0x2E,0x8B,0x36,0x5A,0x83,0x56,0xE8,
-	0x73,0xFF,0x5B,0x5B,0x0B,0xD2,0x75,0x02,0x5B,0xC3,0x1F,
-	0x8E,0xC2,0x06,0x1E,0x53,0x8B,0x16,0x00,0x00,0xFC,0x4A,
-	0xBF,0x04,0x00,0x8B,0xF7,0xB9,0x06,0x00,0xF3,0xA5,0x0B,
-	0xD2,0x74,0x37,0x8C,0xC0,0x40,0x8E,0xC0,0x8C,0xD8,0x40,
-	0x8E,0xD8,0x33,0xFF,0x8B,0xF7,0x8B,0xCA,0x81,0xF9,0x00,
-	0x10,0x76,0x03,0xB9,0x00,0x10,0xD1,0xE1,0xD1,0xE1,0xD1,
-	0xE1,0xF3,0xA5,0x81,0xEA,0x00,0x10,0x76,0x10,0x8C,0xC0,
-	0x05,0x00,0x10,0x8E,0xC0,0x8C,0xD8,0x05,0x00,0x10,0x8E,
-	0xD8,0xEB,0xD3,0x2E,0x8E,0x1E,0x56,0x83,0xE8,0x2C,0xFE,
-	0x5A,0x5A,0x5A,0xB8,0x04,0x00,0xC3,0x2E,0x3B,0x1E,0x52,
-	0x83,0x74,0x43,0x8B,0xFB,0x03,0xF8,0x8E,0xC7,0x8B,0xF1,
-	0x2B,0xF0,0x26,0x89,0x36,0x00,0x00,0x26,0x89,0x1E,0x02,
-	0x00,0x06,0x50,0x8E,0xC3,0x26,0xA3,0x00,0x00,0x8B,0xD3,
-	0x03,0xD1,0x8E,0xC2,0x26,0x83,0x3E,0x02,0x00,0x00,0x74,
-	0x07,0x26,0x89,0x3E,0x02,0x00,0xEB,0x05,0x26,0x89,0x3E,
-	0x08,0x00,0x8B,0xF3,0xE8,0xE3,0xFD,0x5A,0x5A,0x8B,0xD6,
-	0xB8,0x04,0x00,0xC3,0x53,0x8E,0xC3,0x26,0xA3,0x00,0x00,
-	0x03,0xD8,0x53,0x33,0xC0,0x50,0xE8,0x93,0xD4,0x5A,0x5A,
-	0x5A,0xB8,0x04,0x00,0xC3,0x55,0x8B,0xEC,0x8B,0x56,0x0A,
-	0x8B,0x46,0x08,0x8B,0x5E,0x06,0x56,0x57,0x2E,0x8C,0x1E,
-	0x56,0x83,0x2E,0x89,0x16,0x58,0x83,0x2E,0xA3,0x5A,0x83,
-	0x0B,0xDB,0x74,0x32,0x8B,0xC8,0x0B,0xCA,0x74,0x33,0x05,
-	0x13,0x00,0x83,0xD2,0x00,0xB1,0x04,0xD3,0xE8,0xD3,0xE2,
-	0x0A,0xE2,0x8E,0xC3,0x26,0x8B,0x0E,0x00,0x00,0x3B,0xC8,
-	0x72,0x0E,0x77,0x07,0x8B,0xD3,0xB8,0x04,0x00,0xEB,0x1B,
-	0xE8,0x54,0xFF,0xEB,0x16,0xE8,0xD7,0xFE,0xEB,0x11,0x52,
-	0x50,0xE8,0x53,0xFE,0xEB,0x08,0x53,0x50,0xE8,0x66,0xFD,
-	0x33,0xC0,0x99,0x5F,0x5F,0x2E,0x8E,0x1E,0x56,0x83,0x5F,
-	0x5E,0x5D,0xC3,0x59,0x0E,0x51,0x33,0xC9,0xEB,0x16,0x59,
-	0x0E,0x51,0xB9,0x01,0x00,0xEB,0x0E,0x59,0x0E,0x51,0xB9,
-	0x02,0x00,0xEB,0x06,0x59,0x0E,0x51,0xB9,0x03,0x00,0x55,
-	0x56,0x57,0x8B,0xEC,0x8B,0xF9,0x8B,0x46,0x0A,0x8B,0x56,
-	0x0C,0x8B,0x5E,0x0E,0x8B,0x4E,0x10,0x0B,0xC9,0x75,0x08,
-	0x0B,0xD2,0x74,0x69,0x0B,0xDB,0x74,0x65,0xF7,0xC7,0x01,
-	0x00,0x75,0x1C,0x0B,0xD2,0x79,0x0A,0xF7,0xDA,0xF7,0xD8,
-	0x83,0xDA,0x00,0x83,0xCF,0x0C,0x0B,0xC9,0x79,0x0A,0xF7,
-	0xD9,0xF7,0xDB,0x83,0xD9,0x00,0x83,0xF7,0x04,0x8B,0xE9,
-	0xB9,0x20,0x00,0x57,0x33,0xFF,0x33,0xF6,0xD1,0xE0,0xD1,
-	0xD2,0xD1,0xD6,0xD1,0xD7,0x3B,0xFD,0x72,0x0B,0x77,0x04,
-	0x3B,0xF3,0x72,0x05,0x2B,0xF3,0x1B,0xFD,0x40,0xE2,0xE7,
-	0x5B,0xF7,0xC3,0x02,0x00,0x74,0x06,0x8B,0xC6,0x8B,0xD7,
-	0xD1,0xEB,0xF7,0xC3,0x04,0x00,0x74,0x07,0xF7,0xDA,0xF7,
-	0xD8,0x83,0xDA,0x00,0x5F,0x5E,0x5D,0xCA,0x08,0x00,0xF7,
-	0xF3,0xF7,0xC7,0x02,0x00,0x74,0x01,0x92,0x33,0xD2,0xEB,
-	0xED,0x5B,0x0E,0x53,0x80,0xF9,0x10,0x73,0x10,0x8B,0xD8,
-	0xD3,0xE0,0xD3,0xE2,0xF6,0xD9,0x80,0xC1,0x10,0xD3,0xEB,
-	0x0B,0xD3,0xCB,0x80,0xE9,0x10,0x92,0x33,0xC0,0xD3,0xE2,
-	0xCB,0x5B,0x0E,0x53,0x80,0xF9,0x10,0x73,0x10,0x8B,0xDA,
-	0xD3,0xE8,0xD3,0xEA,0xF6,0xD9,0x80,0xC1,0x10,0xD3,0xE3,
-	0x0B,0xC3,0xCB,0x80,0xE9,0x10,0x92,0x33,0xD2,0xD3,0xE8,
-	0xCB,0x07,0x0E,0x06,0x0B,0xC9,0x7D,0x0C,0xF7,0xD3,0xF7,
-	0xD1,0x83,0xC3,0x01,0x83,0xD1,0x00,0xEB,0x2F,0x03,0xC3,
-	0x73,0x04,0x81,0xC2,0x00,0x10,0x8A,0xE9,0xB1,0x04,0xD2,
-	0xE5,0x02,0xF5,0x8A,0xE8,0xD3,0xE8,0x03,0xD0,0x8A,0xC5,
-	0x25,0x0F,0x00,0xCB,0x07,0x0E,0x06,0x0B,0xC9,0x7D,0x0C,
-	0xF7,0xD3,0xF7,0xD1,0x83,0xC3,0x01,0x83,0xD1,0x00,0xEB,
-	0xD1,0x2B,0xC3,0x73,0x04,0x81,0xEA,0x00,0x10,0x8A,0xF9,
-	0xB1,0x04,0xD2,0xE7,0x32,0xDB,0x2B,0xD3,0x8A,0xE8,0xD3,
-	0xE8,0x03,0xD0,0x8A,0xC5,0x25,0x0F,0x00,0xCB,0x07,0x0E,
-	0x06,0x57,0x8B,0xF9,0x8A,0xEE,0xB1,0x04,0xD3,0xE2,0xD2,
-	0xED,0x03,0xD0,0x80,0xD5,0x00,0x8B,0xC7,0xD3,0xE7,0xD2,
-	0xEC,0x03,0xDF,0x80,0xD4,0x00,0x2B,0xD3,0x1A,0xEC,0x8A,
-	0xC5,0x98,0x92,0x5F,0xCB,0x07,0x0E,0x06,0x55,0x8B,0xEC,
-	0x56,0x57,0x1E,0xC5,0x76,0x06,0xC4,0x7E,0x0A,0xFC,0xD1,
-	0xE9,0xF3,0xA5,0x13,0xC9,0xF3,0xA4,0x1F,0x5F,0x5E,0x5D,
-	0xCA,0x08,0x00,0x00,0x00,0x00,0x56,0x57,0x8B,0xF4,0x8B,
-	0x5C,0x06,0x83,0xEB,0x04,0x72,0x0E,0x3B,0x1E,0x6C,0x16,
-	0x74,0x05,0xE8,0x42,0x00,0xEB,0x03,0xE8,0x03,0x00,0x5F,
-	0x5E,0xC3,0x39,0x1E,0x6A,0x16,0x74,0x23,0x8B,0x77,0x02,
-	0xF6,0x04,0x01,0x74,0x06,0x89,0x36,0x6C,0x16,0xEB,0x20,
-	0x3B,0x36,0x6A,0x16,0x74,0x0D,0x8B,0xDE,0xE8,0x54,0x00,
-	0x8B,0x47,0x02,0xA3,0x6C,0x16,0xEB,0x0D,0x8B,0xDE,0x33,
-	0xC0,0xA3,0x6A,0x16,0xA3,0x6C,0x16,0xA3,0x6E,0x16,0x53,
-	0xE8,0xB4,0xE6,0x5B,0xC3,0xFF,0x0F,0x3B,0x1E,0x6A,0x16,
-	0x74,0x18,0x8B,0x77,0x02,0x8B,0x04,0xA8,0x01,0x75,0x0F,
-	0x03,0x07,0x89,0x04,0x8B,0x3F,0x03,0xFB,0x89,0x75,0x02,
-	0x8B,0xDE,0xEB,0x03,0xE8,0x32,0x00,0x8B,0x3F,0x03,0xFB,
-	0x8B,0x05,0xA8,0x01,0x74,0x01,0xC3,0x01,0x07,0x8B,0xF7,
-	0x03,0xF0,0x89,0x5C,0x02,0x8B,0xDF,0x8B,0x7F,0x06,0x3B,
-	0xDF,0x74,0x0E,0x89,0x3E,0x6E,0x16,0x8B,0x77,0x04,0x89,
-	0x75,0x04,0x89,0x7C,0x06,0xC3,0xC7,0x06,0x6E,0x16,0x00,
-	0x00,0xC3,0x8B,0x36,0x6E,0x16,0x0B,0xF6,0x74,0x10,0x8B,
-	0x7C,0x06,0x89,0x5C,0x06,0x89,0x5D,0x04,0x89,0x7F,0x06,
-	0x89,0x77,0x04,0xC3,0x89,0x1E,0x6E,0x16,0x89,0x5F,0x04,
-	0x89,0x5F,0x06,0xC3,0x56,0x57,0x8B,0xF4,0x8B,0x44,0x06,
-	0x0B,0xC0,0x74,0x52,0x05,0x05,0x00,0x72,0x36,0x25,0xFE,
-	0xFF,0x3D,0x08,0x00,0x73,0x03,0xB8,0x08,0x00,0x83,0x3E,
-	0x6A,0x16,0x00,0x74,0x1F,0x8B,0x1E,0x6E,0x16,0x0B,0xDB,
-	0x74,0x0D,0x8B,0xD3,0x39,0x07,0x73,0x1A,0x8B,0x5F,0x06,
-	0x3B,0xDA,0x75,0xF5,0xE8,0x66,0x00,0xEB,0x21,0xE8,0x8A,
-	0x00,0xEB,0x1C,0xE8,0x1C,0x00,0xEB,0x17,0x33,0xC0,0xEB,
-	0x13,0x8B,0xF0,0x83,0xC6,0x08,0x39,0x37,0x73,0xE9,0xE8,
-	0x6B,0xFF,0xFF,0x07,0x8B,0xC3,0x05,0x04,0x00,0x5F,0x5E,
-	0xC3,0x50,0x33,0xC0,0x50,0x50,0xE8,0xF4,0xE5,0x5B,0x5B,
-	0x25,0x01,0x00,0x74,0x09,0x33,0xD2,0x52,0x50,0xE8,0xE6,
-	0xE5,0x5B,0x5B,0x58,0x50,0x33,0xDB,0x53,0x50,0xE8,0xDB,
-	0xE5,0x5B,0x5B,0x3D,0xFF,0xFF,0x74,0x14,0x8B,0xD8,0x89,
-	0x1E,0x6A,0x16,0x89,0x1E,0x6C,0x16,0x58,0x40,0x89,0x07,
-	0x83,0xC3,0x04,0x8B,0xC3,0xC3,0x5B,0x33,0xC0,0xC3,0x50,
-	0x33,0xDB,0x53,0x50,0xE8,0xB4,0xE5,0x5B,0x5B,0x3D,0xFF,
-	0xFF,0x74,0x16,0x8B,0xD8,0xA1,0x6C,0x16,0x89,0x47,0x02,
-	0x89,0x1E,0x6C,0x16,0x58,0x40,0x89,0x07,0x83,0xC3,0x04,
-	0x8B,0xC3,0xC3,0x58,0x33,0xC0,0xC3,0x29,0x07,0x8B,0xF3,
-	0x03,0x37,0x8B,0xFE,0x03,0xF8,0x40,0x89,0x04,0x89,0x5C,
-	0x02,0x89,0x75,0x02,0x83,0xC6,0x04,0x8B,0xC6,0xC3,0x8B,
-	0xEC,0x53,0x50,0x51,0x50,0xE8,0x15,0xFF,0x5B,0x8B,0xD8,
-	0x0B,0xC0,0x74,0x1F,0x1E,0x07,0xFC,0x8B,0xF8,0x8B,0x76,
-	0xFE,0x8B,0x0C,0x83,0xC6,0x04,0x56,0x83,0xE9,0x05,0xD1,
-	0xE9,0xF3,0xA5,0x89,0x46,0xFE,0xE8,0x24,0xFE,0x5B,0x8B,
-	0x5E,0xFE,0x83,0xC4,0x06,0xC3,0x8B,0xC2,0x83,0xC2,0x08,
-	0x3B,0xD1,0x77,0x35,0x8B,0xD1,0x3B,0x1E,0x6C,0x16,0x75,
-	0x0F,0x89,0x07,0xFF,0x07,0x03,0xC3,0x53,0x50,0xE8,0x09,
-	0xE5,0x5B,0x5B,0xEB,0x1E,0x8B,0xFB,0x03,0xF8,0x89,0x5D,
-	0x02,0x2B,0xD0,0x29,0x17,0x8B,0xF7,0x03,0xF2,0x89,0x7C,
-	0x02,0x42,0x89,0x15,0x8B,0xCB,0x8B,0xDF,0xE8,0x37,0xFE,
-	0x8B,0xD9,0x83,0xC3,0x04,0xC3,0x56,0x57,0x55,0x8B,0xEC,
-	0x8B,0x5E,0x08,0x8B,0x46,0x0A,0x0B,0xC0,0x74,0x37,0x0B,
-	0xDB,0x74,0x2D,0x83,0xEB,0x04,0x8B,0x0F,0x49,0x8B,0xD0,
-	0x83,0xC2,0x05,0x83,0xE2,0xFE,0x83,0xFA,0x08,0x73,0x03,
-	0xBA,0x08,0x00,0x3B,0xCA,0x72,0x0C,0x77,0x05,0x83,0xC3,
-	0x04,0xEB,0x08,0xE8,0x87,0xFF,0xEB,0x03,0xE8,0x4F,0xFF,
-	0x8B,0xC3,0xEB,0x0D,0x50,0xE8,0x65,0xFE,0xEB,0x06,0x53,
-	0xE8,0x90,0xFD,0x33,0xC0,0x5B,0x5D,0x5F,0x5E,0xC3,0x56,
-	0x96,0x92,0x85,0xC0,0x74,0x02,0xF7,0xE3,0xE3,0x05,0x91,
-	0xF7,0xE6,0x03,0xC1,0x96,0xF7,0xE3,0x03,0xD6,0x5E,0xC3,
-	0x51,0x8A,0xE8,0xB1,0x04,0xD3,0xE8,0x03,0xD0,0x8A,0xC5,
-	0x8A,0xE3,0xD3,0xEB,0x59,0x03,0xCB,0x8A,0xDC,0x25,0x0F,
-	0x00,0x83,0xE3,0x0F,0x3B,0xD1,0x75,0x02,0x3B,0xC3,0xC3,
-	0xFF,0x26,0x80,0x16,0x00,0x00,0x8F,0x06,0x74,0x16,0x8F,
-	0x06,0x76,0x16,0x8F,0x06,0x78,0x16,0x2E,0x8C,0x1E,0x83,
-	0x8B,0x89,0x36,0x7A,0x16,0x89,0x3E,0x7C,0x16,0xFC,0x8E,
-	0x06,0x8E,0x00,0xBE,0x80,0x00,0x32,0xE4,0x26,0xAC,0x40,
-	0x8C,0xC5,0x87,0xD6,0x93,0x8B,0x36,0x88,0x00,0x46,0x46,
-	0xB9,0x01,0x00,0x80,0x3E,0x90,0x00,0x03,0x72,0x11,0x8E,
-	0x06,0x8A,0x00,0x8B,0xFE,0xB1,0x7F,0x32,0xC0,0xF2,0xAE,
-	0xE3,0x6E,0x80,0xF1,0x7F,0x50,0x8B,0xC1,0x03,0xC3,0x40,
-	0x25,0xFE,0xFF,0x8B,0xFC,0x2B,0xF8,0x72,0x5C,0x8B,0xE7,
-	0x06,0x1F,0x16,0x07,0x51,0x49,0xF3,0xA4,0x32,0xC0,0xAA,
-	0x8E,0xDD,0x87,0xF2,0x87,0xD9,0x8B,0xC3,0x8B,0xD0,0x43,
-	0xE8,0x19,0x00,0x77,0x07,0x72,0x40,0xE8,0x12,0x00,0x77,
-	0xF9,0x3C,0x20,0x74,0x08,0x3C,0x0D,0x74,0x04,0x3C,0x09,
-	0x75,0xE8,0x32,0xC0,0xEB,0xE4,0x0B,0xC0,0x74,0x07,0x42,
-	0xAA,0x0A,0xC0,0x75,0x01,0x43,0x86,0xE0,0x32,0xC0,0xF9,
-	0xE3,0x15,0xAC,0x49,0x2C,0x22,0x74,0x0F,0x04,0x22,0x3C,
-	0x5C,0x75,0x07,0x80,0x3C,0x22,0x75,0x02,0xAC,0x49,0x0B,
-	0xF6,0xC3,0xE9,0xE1,0x75,0x59,0x03,0xCA,0x2E,0x8E,0x1E,
-	0x83,0x8B,0x89,0x1E,0x70,0x16,0x43,0x03,0xDB,0x8B,0xF4,
-	0x8B,0xEC,0x2B,0xEB,0x72,0xE6,0x8B,0xE5,0x89,0x2E,0x72,
-	0x16,0xE3,0x0E,0x89,0x76,0x00,0x83,0xC5,0x02,0x36,0xAC,
-	0x0A,0xC0,0xE0,0xFA,0x74,0xF0,0x33,0xC0,0x89,0x46,0x00,
-	0x2E,0x8E,0x1E,0x83,0x8B,0x8B,0x36,0x7A,0x16,0x8B,0x3E,
-	0x7C,0x16,0xFF,0x36,0x78,0x16,0xFF,0x36,0x76,0x16,0xA1,
-	0x70,0x16,0xA3,0x82,0x00,0xA1,0x72,0x16,0xA3,0x84,0x00,
-	0xFF,0x26,0x74,0x16,0x56,0x57,0x8B,0x0E,0x88,0x00,0x51,
-	0xE8,0xFF,0xFC,0x59,0x8B,0xF8,0x0B,0xC0,0x74,0x22,0x1E,
-	0x1E,0x07,0x8E,0x1E,0x8A,0x00,0x33,0xF6,0xFC,0xF3,0xA4,
-	0x1F,0x8B,0xF8,0x06,0xFF,0x36,0x8C,0x00,0xE8,0xE1,0xFC,
-	0x5B,0x8B,0xD8,0x07,0xA3,0x7E,0x16,0x0B,0xC0,0x75,0x03,
-	0xE9,0x54,0x75,0x33,0xC0,0xB9,0xFF,0xFF,0x89,0x3F,0x83,
-	0xC3,0x02,0xF2,0xAE,0x26,0x38,0x05,0x75,0xF4,0x89,0x07,
-	0x5F,0x5E,0xA1,0x7E,0x16,0xA3,0x86,0x00,0xC3,0x53,0x74,
-	0x61,0x63,0x6B,0x20,0x6F,0x76,0x65,0x72,0x66,0x6C,0x6F,
-	0x77,0x21,0x0D,0x0A,0x24,0x0E,0x1F,0xBA,0xE8,0x8C,0xB4,
-	0x09,0xCD,0x21,0xE9,0x28,0x74,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC5,0x69,0x00,0x00,
-	0x00,0x10,0xE6,0x71,0x00,0x00,0x00,0x10,0x85,0x8B,0x00,
-	0x00,0x00,0x10,0x96,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x75,0x72,
-	0x62,0x6F,0x20,0x43,0x2B,0x2B,0x20,0x2D,0x20,0x43,0x6F,
-	0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x31,0x39,0x39,
-	0x30,0x20,0x42,0x6F,0x72,0x6C,0x61,0x6E,0x64,0x20,0x49,
-	0x6E,0x74,0x6C,0x2E,0x00,0x4E,0x75,0x6C,0x6C,0x20,0x70,
-	0x6F,0x69,0x6E,0x74,0x65,0x72,0x20,0x61,0x73,0x73,0x69,
-	0x67,0x6E,0x6D,0x65,0x6E,0x74,0x0D,0x0A,0x44,0x69,0x76,
-	0x69,0x64,0x65,0x20,0x65,0x72,0x72,0x6F,0x72,0x0D,0x0A,
-	0x41,0x62,0x6E,0x6F,0x72,0x6D,0x61,0x6C,0x20,0x70,0x72,
-	0x6F,0x67,0x72,0x61,0x6D,0x20,0x74,0x65,0x72,0x6D,0x69,
-	0x6E,0x61,0x74,0x69,0x6F,0x6E,0x0D,0x0A,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x78,0x22,0x78,0x22,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x4E,0x64,0x69,
-	0x73,0x6B,0x63,0x6F,0x70,0x79,0x00,0x59,0x00,0x4E,0x00,
-	0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,
-	0x61,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x72,0x20,0x6E,0x6F,
-	0x6E,0x20,0x72,0x65,0x6D,0x6F,0x76,0x61,0x62,0x6C,0x65,
-	0x20,0x6D,0x65,0x64,0x69,0x61,0x2E,0x00,0x25,0x73,0x00,
-	0x45,0x72,0x72,0x6F,0x72,0x20,0x72,0x65,0x61,0x64,0x69,
-	0x6E,0x67,0x20,0x63,0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,
-	0x61,0x74,0x69,0x6F,0x6E,0x20,0x66,0x69,0x6C,0x65,0x2E,
-	0x00,0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x73,0x77,
-	0x69,0x74,0x63,0x68,0x3A,0x00,0x20,0x25,0x73,0x0A,0x00,
-	0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x73,0x77,0x69,
-	0x74,0x63,0x68,0x00,0x57,0x61,0x72,0x6E,0x69,0x6E,0x67,
-	0x3A,0x20,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x00,0x20,0x25,
-	0x73,0x20,0x00,0x64,0x6F,0x65,0x73,0x6E,0x27,0x74,0x20,
-	0x64,0x6F,0x20,0x61,0x6E,0x79,0x74,0x68,0x69,0x6E,0x67,
-	0x21,0x00,0x54,0x6F,0x6F,0x20,0x6D,0x61,0x6E,0x79,0x20,
-	0x70,0x61,0x72,0x61,0x6D,0x65,0x74,0x65,0x72,0x73,0x3A,
-	0x00,0x46,0x69,0x6C,0x65,0x20,0x69,0x73,0x20,0x77,0x72,
-	0x69,0x74,0x65,0x20,0x70,0x72,0x6F,0x74,0x65,0x63,0x74,
-	0x65,0x64,0x21,0x00,0x63,0x6F,0x70,0x69,0x65,0x64,0x20,
-	0x74,0x6F,0x00,0x20,0x25,0x73,0x00,0x07,0x00,0x50,0x72,
-	0x6F,0x62,0x6C,0x65,0x6D,0x20,0x63,0x6F,0x70,0x79,0x69,
-	0x6E,0x67,0x00,0x20,0x25,0x73,0x2E,0x0A,0x00,0x46,0x69,
-	0x6C,0x65,0x20,0x6E,0x6F,0x74,0x20,0x66,0x6F,0x75,0x6E,
-	0x64,0x3A,0x00,0x46,0x69,0x6C,0x65,0x20,0x61,0x6C,0x72,
-	0x65,0x61,0x64,0x79,0x20,0x65,0x78,0x69,0x73,0x74,0x73,
-	0x21,0x00,0x49,0x6E,0x73,0x65,0x72,0x74,0x20,0x53,0x4F,
-	0x55,0x52,0x43,0x45,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,
-	0x74,0x65,0x20,0x69,0x6E,0x74,0x6F,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x00,0x20,0x25,0x73,0x0A,0x0A,0x00,0x50,0x72,
-	0x65,0x73,0x73,0x20,0x61,0x6E,0x79,0x20,0x6B,0x65,0x79,
-	0x20,0x74,0x6F,0x20,0x63,0x6F,0x6E,0x74,0x69,0x6E,0x75,
-	0x65,0x20,0x2E,0x20,0x2E,0x20,0x2E,0x00,0x44,0x69,0x73,
-	0x6B,0x20,0x6E,0x6F,0x74,0x20,0x72,0x65,0x61,0x64,0x79,
-	0x21,0x00,0x55,0x6E,0x61,0x62,0x6C,0x65,0x20,0x74,0x6F,
-	0x20,0x6F,0x70,0x65,0x6E,0x20,0x69,0x6D,0x61,0x67,0x65,
-	0x20,0x66,0x69,0x6C,0x65,0x2E,0x00,0x43,0x61,0x6E,0x20,
-	0x6E,0x6F,0x74,0x20,0x63,0x6F,0x70,0x79,0x20,0x69,0x6D,
-	0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,0x00,0x4E,0x6F,
-	0x74,0x20,0x65,0x6E,0x6F,0x75,0x67,0x68,0x20,0x64,0x69,
-	0x73,0x6B,0x20,0x73,0x70,0x61,0x63,0x65,0x20,0x6F,0x6E,
-	0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x21,0x00,0x45,0x72,0x72,0x6F,0x72,0x20,0x61,
-	0x63,0x63,0x65,0x73,0x73,0x69,0x6E,0x67,0x20,0x69,0x6D,
-	0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,0x3A,0x00,0x49,
-	0x6E,0x73,0x75,0x66,0x66,0x69,0x63,0x69,0x65,0x6E,0x74,
-	0x20,0x6D,0x65,0x6D,0x6F,0x72,0x79,0x20,0x66,0x6F,0x72,
-	0x20,0x64,0x69,0x73,0x6B,0x20,0x63,0x6F,0x70,0x79,0x2E,
-	0x0A,0x00,0x50,0x72,0x6F,0x62,0x6C,0x65,0x6D,0x20,0x72,
-	0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x69,0x6D,0x61,0x67,
-	0x65,0x20,0x66,0x69,0x6C,0x65,0x2E,0x00,0x43,0x6F,0x70,
-	0x79,0x69,0x6E,0x67,0x00,0x20,0x25,0x64,0x20,0x00,0x63,
-	0x6C,0x75,0x73,0x74,0x65,0x72,0x73,0x00,0x2C,0x20,0x25,
-	0x64,0x20,0x00,0x73,0x65,0x63,0x74,0x6F,0x72,0x73,0x20,
-	0x70,0x65,0x72,0x20,0x63,0x6C,0x75,0x73,0x74,0x65,0x72,
-	0x00,0x62,0x79,0x74,0x65,0x73,0x20,0x70,0x65,0x72,0x20,
-	0x73,0x65,0x63,0x74,0x6F,0x72,0x00,0x52,0x65,0x6C,0x65,
-	0x76,0x61,0x6E,0x74,0x20,0x64,0x72,0x69,0x76,0x65,0x20,
-	0x73,0x69,0x7A,0x65,0x20,0x69,0x73,0x00,0x20,0x25,0x6C,
-	0x75,0x20,0x00,0x62,0x79,0x74,0x65,0x73,0x00,0x55,0x73,
-	0x69,0x6E,0x67,0x00,0x45,0x4D,0x53,0x2E,0x0A,0x00,0x58,
-	0x4D,0x53,0x2E,0x0A,0x00,0x74,0x65,0x6D,0x70,0x6F,0x72,
-	0x61,0x72,0x79,0x20,0x66,0x69,0x6C,0x65,0x00,0x62,0x75,
-	0x66,0x66,0x65,0x72,0x20,0x6F,0x66,0x00,0x20,0x25,0x6C,
-	0x64,0x20,0x00,0x62,0x79,0x74,0x65,0x73,0x2E,0x00,0x52,
-	0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x53,0x4F,0x55,0x52,
-	0x43,0x45,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,0x74,0x65,
-	0x20,0x2E,0x20,0x2E,0x20,0x2E,0x00,0x43,0x72,0x65,0x61,
-	0x74,0x69,0x6E,0x67,0x20,0x69,0x6D,0x61,0x67,0x65,0x20,
-	0x66,0x69,0x6C,0x65,0x20,0x2E,0x20,0x2E,0x20,0x2E,0x20,
-	0x00,0x56,0x65,0x72,0x69,0x66,0x79,0x69,0x6E,0x67,0x20,
-	0x2E,0x20,0x2E,0x20,0x2E,0x00,0x4D,0x65,0x64,0x69,0x61,
-	0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x72,0x65,0x61,0x64,
-	0x69,0x6E,0x67,0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x65,
-	0x63,0x74,0x6F,0x72,0x00,0x20,0x25,0x6C,0x64,0x2E,0x0A,
-	0x00,0x55,0x6E,0x73,0x75,0x73,0x70,0x65,0x63,0x74,0x65,
-	0x64,0x20,0x6D,0x65,0x6D,0x6F,0x72,0x79,0x20,0x65,0x72,
-	0x72,0x6F,0x72,0x2E,0x00,0x43,0x6F,0x6D,0x70,0x61,0x72,
-	0x65,0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x6F,0x6E,0x20,
-	0x73,0x65,0x63,0x74,0x6F,0x72,0x00,0x49,0x6E,0x73,0x65,
-	0x72,0x74,0x20,0x54,0x41,0x52,0x47,0x45,0x54,0x20,0x64,
-	0x69,0x73,0x6B,0x65,0x74,0x74,0x65,0x20,0x69,0x6E,0x74,
-	0x6F,0x20,0x64,0x72,0x69,0x76,0x65,0x00,0x44,0x69,0x73,
-	0x6B,0x65,0x74,0x74,0x65,0x20,0x64,0x6F,0x65,0x73,0x20,
-	0x6E,0x6F,0x74,0x20,0x68,0x61,0x76,0x65,0x20,0x74,0x68,
-	0x65,0x20,0x73,0x61,0x6D,0x65,0x20,0x63,0x61,0x70,0x61,
-	0x63,0x69,0x74,0x79,0x20,0x61,0x73,0x20,0x74,0x68,0x65,
-	0x20,0x6F,0x72,0x69,0x67,0x69,0x6E,0x61,0x6C,0x2E,0x00,
-	0x50,0x75,0x74,0x20,0x61,0x20,0x64,0x69,0x73,0x6B,0x65,
-	0x74,0x74,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,
-	0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x20,0x63,0x61,0x70,
-	0x61,0x63,0x69,0x74,0x79,0x20,0x69,0x6E,0x20,0x64,0x72,
-	0x69,0x76,0x65,0x00,0x20,0x25,0x73,0x2C,0x20,0x0A,0x00,
-	0x6F,0x72,0x20,0x70,0x72,0x65,0x73,0x73,0x20,0x43,0x54,
-	0x52,0x4C,0x2D,0x43,0x20,0x74,0x6F,0x20,0x63,0x61,0x6E,
-	0x63,0x65,0x6C,0x2E,0x00,0x57,0x72,0x69,0x74,0x69,0x6E,
-	0x67,0x20,0x69,0x6D,0x61,0x67,0x65,0x20,0x66,0x69,0x6C,
-	0x65,0x20,0x2E,0x20,0x2E,0x20,0x2E,0x20,0x00,0x57,0x72,
-	0x69,0x74,0x69,0x6E,0x67,0x20,0x74,0x6F,0x20,0x54,0x41,
-	0x52,0x47,0x45,0x54,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,
-	0x74,0x65,0x20,0x69,0x6E,0x20,0x64,0x72,0x69,0x76,0x65,
-	0x20,0x2E,0x20,0x2E,0x20,0x2E,0x00,0x53,0x65,0x63,0x74,
-	0x6F,0x72,0x20,0x30,0x20,0x75,0x6E,0x77,0x72,0x69,0x74,
-	0x61,0x62,0x6C,0x65,0x21,0x20,0x57,0x72,0x69,0x74,0x65,
-	0x20,0x70,0x72,0x6F,0x74,0x65,0x63,0x74,0x65,0x64,0x3F,
-	0x00,0x4D,0x65,0x64,0x69,0x61,0x20,0x65,0x72,0x72,0x6F,
-	0x72,0x20,0x77,0x72,0x69,0x74,0x69,0x6E,0x67,0x20,0x74,
-	0x6F,0x20,0x73,0x65,0x63,0x74,0x6F,0x72,0x00,0x44,0x6F,
-	0x20,0x79,0x6F,0x75,0x20,0x77,0x61,0x6E,0x74,0x20,0x61,
-	0x6E,0x6F,0x74,0x68,0x65,0x72,0x20,0x63,0x6F,0x70,0x79,
-	0x20,0x6F,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x00,0x69,
-	0x6D,0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,0x20,0x28,
-	0x59,0x2F,0x4E,0x29,0x3F,0x00,0x64,0x69,0x73,0x6B,0x20,
-	0x28,0x59,0x2F,0x4E,0x29,0x3F,0x00,0x50,0x72,0x6F,0x62,
-	0x6C,0x65,0x6D,0x20,0x77,0x72,0x69,0x74,0x69,0x6E,0x67,
-	0x20,0x69,0x6D,0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,
-	0x2E,0x00,0x43,0x6F,0x70,0x79,0x20,0x61,0x6E,0x6F,0x74,
-	0x68,0x65,0x72,0x20,0x64,0x69,0x73,0x6B,0x20,0x28,0x59,
-	0x2F,0x4E,0x29,0x3F,0x00,0x44,0x49,0x53,0x4B,0x43,0x4F,
-	0x50,0x59,0x20,0x25,0x73,0x0A,0x00,0x62,0x65,0x74,0x61,
-	0x20,0x30,0x2E,0x39,0x35,0x00,0x43,0x6F,0x70,0x79,0x20,
-	0x6F,0x6E,0x65,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,0x74,
-	0x65,0x20,0x6F,0x72,0x20,0x69,0x6D,0x61,0x67,0x65,0x20,
-	0x66,0x69,0x6C,0x65,0x20,0x74,0x6F,0x20,0x61,0x6E,0x6F,
-	0x74,0x68,0x65,0x72,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,
-	0x74,0x65,0x20,0x6F,0x72,0x20,0x69,0x6D,0x61,0x67,0x65,
-	0x20,0x66,0x69,0x6C,0x65,0x2E,0x00,0x28,0x43,0x29,0x20,
-	0x31,0x39,0x39,0x38,0x20,0x00,0x62,0x79,0x00,0x20,0x4D,
-	0x61,0x74,0x74,0x68,0x65,0x77,0x20,0x53,0x74,0x61,0x6E,
-	0x66,0x6F,0x72,0x64,0x2E,0x0A,0x28,0x43,0x29,0x20,0x31,
-	0x39,0x39,0x39,0x2D,0x32,0x30,0x30,0x34,0x2C,0x20,0x32,
-	0x30,0x30,0x38,0x20,0x00,0x20,0x49,0x6D,0x72,0x65,0x20,
-	0x4C,0x65,0x62,0x65,0x72,0x2E,0x0A,0x0A,0x00,0x44,0x69,
-	0x73,0x6B,0x63,0x6F,0x70,0x79,0x20,0x3C,0x00,0x73,0x6F,
-	0x75,0x72,0x63,0x65,0x00,0x3E,0x20,0x3C,0x00,0x64,0x65,
-	0x73,0x74,0x69,0x6E,0x61,0x74,0x69,0x6F,0x6E,0x00,0x3E,
-	0x20,0x5B,0x25,0x63,0x61,0x5D,0x5B,0x25,0x63,0x76,0x5D,
-	0x5B,0x25,0x63,0x6D,0x5D,0x5B,0x25,0x63,0x69,0x5D,0x5B,
-	0x25,0x63,0x6F,0x5D,0x5B,0x25,0x63,0x78,0x5D,0x5B,0x25,
-	0x63,0x64,0x5D,0x5B,0x25,0x63,0x72,0x5D,0x5B,0x25,0x63,
-	0x66,0x5D,0x5B,0x25,0x63,0x74,0x5D,0x0A,0x00,0x73,0x6F,
-	0x75,0x72,0x63,0x65,0x3A,0x20,0x20,0x20,0x20,0x20,0x20,
-	0x64,0x72,0x69,0x76,0x65,0x20,0x6F,0x72,0x20,0x69,0x6D,
-	0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,0x20,0x74,0x6F,
-	0x20,0x63,0x6F,0x70,0x79,0x20,0x66,0x72,0x6F,0x6D,0x2E,
-	0x00,0x64,0x65,0x73,0x74,0x69,0x6E,0x61,0x74,0x69,0x6F,
-	0x6E,0x3A,0x20,0x64,0x72,0x69,0x76,0x65,0x20,0x6F,0x72,
-	0x20,0x69,0x6D,0x61,0x67,0x65,0x20,0x66,0x69,0x6C,0x65,
-	0x20,0x74,0x6F,0x20,0x63,0x6F,0x70,0x79,0x20,0x74,0x6F,
-	0x2E,0x00,0x25,0x63,0x61,0x20,0x3A,0x20,0x00,0x67,0x69,
-	0x76,0x65,0x20,0x61,0x6E,0x20,0x61,0x75,0x64,0x69,0x62,
-	0x6C,0x65,0x20,0x77,0x61,0x72,0x6E,0x69,0x6E,0x67,0x20,
-	0x66,0x6F,0x72,0x20,0x75,0x73,0x65,0x72,0x20,0x61,0x63,
-	0x74,0x69,0x6F,0x6E,0x2E,0x00,0x25,0x63,0x76,0x20,0x3A,
-	0x20,0x00,0x76,0x65,0x72,0x69,0x66,0x79,0x20,0x72,0x65,
-	0x61,0x64,0x73,0x20,0x61,0x6E,0x64,0x20,0x77,0x72,0x69,
-	0x74,0x65,0x73,0x2E,0x00,0x25,0x63,0x6D,0x20,0x3A,0x20,
-	0x00,0x6F,0x6E,0x6C,0x79,0x20,0x75,0x73,0x65,0x20,0x6D,
-	0x65,0x6D,0x6F,0x72,0x79,0x20,0x66,0x6F,0x72,0x20,0x64,
-	0x69,0x73,0x6B,0x20,0x63,0x6F,0x70,0x79,0x2E,0x00,0x25,
-	0x63,0x69,0x20,0x3A,0x20,0x00,0x73,0x68,0x6F,0x77,0x20,
-	0x6D,0x65,0x6D,0x6F,0x72,0x79,0x20,0x75,0x73,0x61,0x67,
-	0x65,0x20,0x28,0x69,0x6E,0x66,0x6F,0x72,0x6D,0x61,0x74,
-	0x69,0x76,0x65,0x29,0x2E,0x00,0x25,0x63,0x6F,0x20,0x3A,
-	0x20,0x00,0x6F,0x76,0x65,0x72,0x77,0x72,0x69,0x74,0x65,
-	0x20,0x64,0x65,0x73,0x74,0x69,0x6E,0x61,0x74,0x69,0x6F,
-	0x6E,0x2C,0x20,0x69,0x66,0x20,0x69,0x74,0x20,0x61,0x6C,
-	0x72,0x65,0x61,0x64,0x79,0x20,0x65,0x78,0x69,0x73,0x74,
-	0x73,0x20,0x28,0x69,0x6E,0x20,0x63,0x61,0x73,0x65,0x20,
-	0x6F,0x66,0x20,0x61,0x6E,0x20,0x69,0x6D,0x61,0x67,0x65,
-	0x20,0x66,0x69,0x6C,0x65,0x29,0x2E,0x00,0x25,0x63,0x78,
-	0x20,0x3A,0x20,0x00,0x61,0x6C,0x77,0x61,0x79,0x73,0x20,
-	0x61,0x75,0x74,0x6F,0x6D,0x61,0x74,0x69,0x63,0x61,0x6C,
-	0x79,0x20,0x65,0x78,0x69,0x74,0x2E,0x00,0x25,0x63,0x64,
-	0x20,0x3A,0x20,0x00,0x61,0x73,0x73,0x75,0x6D,0x65,0x20,
-	0x64,0x69,0x73,0x6B,0x20,0x61,0x6C,0x72,0x65,0x61,0x64,
-	0x79,0x20,0x69,0x6E,0x20,0x64,0x72,0x69,0x76,0x65,0x2E,
-	0x00,0x25,0x63,0x72,0x20,0x3A,0x20,0x00,0x67,0x6F,0x20,
-	0x69,0x6E,0x74,0x6F,0x20,0x64,0x69,0x73,0x6B,0x20,0x65,
-	0x72,0x72,0x6F,0x72,0x20,0x72,0x65,0x63,0x6F,0x76,0x65,
-	0x72,0x79,0x20,0x6D,0x6F,0x64,0x65,0x2E,0x00,0x25,0x63,
-	0x66,0x20,0x3A,0x20,0x00,0x70,0x65,0x72,0x66,0x6F,0x72,
-	0x6D,0x20,0x66,0x61,0x73,0x74,0x20,0x64,0x69,0x73,0x6B,
-	0x63,0x6F,0x70,0x79,0x20,0x28,0x6F,0x6E,0x6C,0x79,0x20,
-	0x63,0x6F,0x70,0x79,0x20,0x66,0x69,0x6C,0x6C,0x65,0x64,
-	0x20,0x73,0x65,0x63,0x74,0x6F,0x72,0x73,0x29,0x2E,0x00,
-	0x25,0x63,0x74,0x20,0x3A,0x20,0x00,0x64,0x6F,0x6E,0x27,
-	0x74,0x20,0x61,0x73,0x6B,0x20,0x74,0x61,0x72,0x67,0x65,
-	0x74,0x20,0x64,0x69,0x73,0x6B,0x20,0x69,0x66,0x20,0x63,
-	0x6F,0x70,0x79,0x69,0x6E,0x67,0x20,0x69,0x6D,0x61,0x67,
-	0x65,0x20,0x66,0x69,0x6C,0x65,0x20,0x74,0x6F,0x20,0x73,
-	0x61,0x6D,0x65,0x20,0x64,0x69,0x73,0x6B,0x2E,0x00,0x25,
-	0x63,0x31,0x20,0x3A,0x20,0x00,0x6E,0x6F,0x2D,0x6F,0x70,
-	0x20,0x69,0x6E,0x63,0x6C,0x75,0x64,0x65,0x64,0x20,0x66,
-	0x6F,0x72,0x20,0x4D,0x53,0x2D,0x44,0x4F,0x53,0x20,0x63,
-	0x6F,0x6D,0x70,0x61,0x74,0x69,0x62,0x69,0x6C,0x69,0x74,
-	0x79,0x2E,0x00,0x52,0x65,0x6D,0x61,0x72,0x6B,0x73,0x3A,
-	0x20,0x61,0x20,0x6D,0x69,0x6E,0x75,0x73,0x20,0x73,0x69,
-	0x67,0x6E,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x61,0x6E,
-	0x20,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x20,0x64,0x69,0x73,
-	0x61,0x62,0x6C,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x6F,
-	0x70,0x74,0x69,0x6F,0x6E,0x2E,0x00,0x20,0x20,0x20,0x20,
-	0x20,0x20,0x20,0x20,0x20,0x59,0x6F,0x75,0x20,0x6D,0x61,
-	0x79,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x79,0x20,0x74,
-	0x68,0x65,0x20,0x73,0x61,0x6D,0x65,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x20,0x66,0x6F,0x72,0x20,0x73,0x6F,0x75,0x72,
-	0x63,0x65,0x20,0x61,0x6E,0x64,0x20,0x64,0x65,0x73,0x74,
-	0x69,0x6E,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x00,0x20,0x28,
-	0x25,0x30,0x34,0x6C,0x75,0x2F,0x25,0x30,0x34,0x6C,0x75,
-	0x29,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
-	0x08,0x08,0x00,0x45,0x4D,0x4D,0x58,0x58,0x58,0x58,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x65,0x6D,0x70,0x00,
-	0x54,0x45,0x4D,0x50,0x00,0x43,0x3A,0x5C,0x00,0x72,0x62,
-	0x00,0x77,0x62,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x75,0x74,0x20,
-	0x73,0x6F,0x75,0x72,0x63,0x65,0x20,0x64,0x69,0x73,0x6B,
-	0x65,0x74,0x74,0x65,0x20,0x69,0x6E,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x00,0x25,0x73,0x00,0x20,0x25,0x63,0x3A,0x0A,
-	0x00,0x50,0x75,0x74,0x20,0x64,0x65,0x73,0x74,0x69,0x6E,
-	0x61,0x74,0x69,0x6F,0x6E,0x20,0x64,0x69,0x73,0x6B,0x65,
-	0x74,0x74,0x65,0x20,0x69,0x6E,0x20,0x64,0x72,0x69,0x76,
-	0x65,0x00,0x20,0x25,0x63,0x3A,0x0A,0x0A,0x00,0x50,0x72,
-	0x65,0x73,0x73,0x20,0x61,0x6E,0x79,0x20,0x6B,0x65,0x79,
-	0x20,0x74,0x6F,0x20,0x63,0x6F,0x6E,0x74,0x69,0x6E,0x75,
-	0x65,0x2E,0x2E,0x2E,0x00,0x49,0x6E,0x76,0x61,0x6C,0x69,
-	0x64,0x20,0x73,0x72,0x63,0x20,0x64,0x72,0x69,0x76,0x65,
-	0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x61,0x74,
-	0x69,0x6F,0x6E,0x20,0x6F,0x72,0x20,0x6E,0x6F,0x6E,0x20,
-	0x72,0x65,0x6D,0x6F,0x76,0x61,0x62,0x6C,0x65,0x20,0x6D,
-	0x65,0x64,0x69,0x61,0x2E,0x00,0x49,0x6E,0x76,0x61,0x6C,
-	0x69,0x64,0x20,0x64,0x73,0x74,0x20,0x64,0x72,0x69,0x76,
-	0x65,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x63,0x61,
-	0x74,0x69,0x6F,0x6E,0x20,0x6F,0x72,0x20,0x6E,0x6F,0x6E,
-	0x20,0x72,0x65,0x6D,0x6F,0x76,0x61,0x62,0x6C,0x65,0x20,
-	0x6D,0x65,0x64,0x69,0x61,0x2E,0x00,0x44,0x69,0x73,0x6B,
-	0x65,0x74,0x74,0x65,0x20,0x64,0x6F,0x65,0x73,0x20,0x6E,
-	0x6F,0x74,0x20,0x68,0x61,0x76,0x65,0x20,0x74,0x68,0x65,
-	0x20,0x73,0x61,0x6D,0x65,0x20,0x63,0x61,0x70,0x61,0x63,
-	0x69,0x74,0x79,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,
-	0x6F,0x72,0x69,0x67,0x69,0x6E,0x61,0x6C,0x2E,0x00,0x50,
-	0x75,0x74,0x20,0x61,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,
-	0x74,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,
-	0x20,0x72,0x69,0x67,0x68,0x74,0x20,0x63,0x61,0x70,0x61,
-	0x63,0x69,0x74,0x79,0x20,0x69,0x6E,0x20,0x64,0x72,0x69,
-	0x76,0x65,0x00,0x20,0x25,0x63,0x3A,0x00,0x6F,0x72,0x00,
-	0x6F,0x72,0x20,0x70,0x72,0x65,0x73,0x73,0x20,0x43,0x54,
-	0x52,0x4C,0x2D,0x43,0x20,0x74,0x6F,0x20,0x63,0x61,0x6E,
-	0x63,0x65,0x6C,0x2E,0x00,0x43,0x6F,0x70,0x79,0x69,0x6E,
-	0x67,0x00,0x20,0x25,0x64,0x20,0x00,0x63,0x6C,0x75,0x73,
-	0x74,0x65,0x72,0x73,0x00,0x2C,0x20,0x25,0x64,0x20,0x00,
-	0x73,0x65,0x63,0x74,0x6F,0x72,0x73,0x20,0x70,0x65,0x72,
-	0x20,0x63,0x6C,0x75,0x73,0x74,0x65,0x72,0x00,0x62,0x79,
-	0x74,0x65,0x73,0x20,0x70,0x65,0x72,0x20,0x73,0x65,0x63,
-	0x74,0x6F,0x72,0x2E,0x00,0x52,0x65,0x6C,0x65,0x76,0x61,
-	0x6E,0x74,0x20,0x64,0x72,0x69,0x76,0x65,0x20,0x73,0x69,
-	0x7A,0x65,0x20,0x69,0x73,0x00,0x20,0x25,0x6C,0x64,0x20,
-	0x00,0x62,0x79,0x74,0x65,0x73,0x2E,0x00,0x43,0x6F,0x70,
-	0x79,0x69,0x6E,0x67,0x20,0x2E,0x20,0x2E,0x20,0x2E,0x00,
-	0x56,0x65,0x72,0x69,0x66,0x79,0x69,0x6E,0x67,0x20,0x2E,
-	0x20,0x2E,0x20,0x2E,0x00,0x4D,0x65,0x64,0x69,0x61,0x20,
-	0x65,0x72,0x72,0x6F,0x72,0x20,0x72,0x65,0x61,0x64,0x69,
-	0x6E,0x67,0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x65,0x63,
-	0x74,0x6F,0x72,0x00,0x20,0x25,0x64,0x0A,0x00,0x4D,0x65,
-	0x64,0x69,0x61,0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x77,
-	0x72,0x69,0x74,0x69,0x6E,0x67,0x20,0x74,0x6F,0x20,0x73,
-	0x65,0x63,0x74,0x6F,0x72,0x00,0x43,0x6F,0x6D,0x70,0x61,
-	0x72,0x65,0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x6F,0x6E,
-	0x20,0x73,0x65,0x63,0x74,0x6F,0x72,0x00,0x20,0x25,0x6C,
-	0x64,0x2E,0x0A,0x00,0x07,0x00,0x44,0x6F,0x20,0x79,0x6F,
-	0x75,0x20,0x77,0x61,0x6E,0x74,0x20,0x74,0x6F,0x20,0x63,
-	0x6F,0x70,0x79,0x20,0x74,0x77,0x6F,0x20,0x6F,0x74,0x68,
-	0x65,0x72,0x20,0x64,0x69,0x73,0x6B,0x65,0x74,0x74,0x65,
-	0x73,0x20,0x28,0x79,0x2F,0x6E,0x29,0x3F,0x00,0x00,0x00,
-	0x00,0x01,0x00,0xFA,0x0C,0xFF,0x0C,0x03,0x0D,0x07,0x0D,
-	0x0B,0x0D,0x13,0x0D,0x1A,0x0D,0x26,0x0D,0x30,0x0D,0x37,
-	0x0D,0x3D,0x0D,0x46,0x0D,0x4B,0x0D,0x54,0x0D,0x5B,0x0D,
-	0x5E,0x0D,0x66,0x0D,0x71,0x0D,0x76,0x0D,0x7B,0x0D,0x81,
-	0x0D,0x8B,0x0D,0x98,0x0D,0x9F,0x0D,0xA5,0x0D,0xAD,0x0D,
-	0xB4,0x0D,0xBB,0x0D,0xC4,0x0D,0x08,0x00,0x09,0x00,0x0A,
-	0x00,0x03,0x00,0x0C,0x00,0x0D,0x00,0x0E,0x00,0x0F,0x00,
-	0x05,0x00,0x06,0x00,0x10,0x00,0x11,0x00,0x17,0x00,0x18,
-	0x00,0x04,0x00,0x12,0x00,0x1B,0x00,0x1C,0x00,0x1D,0x00,
-	0x1E,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x0B,
-	0x00,0x0B,0x00,0x07,0x00,0x1A,0x00,0x1A,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x44,0x49,0x53,0x4B,0x00,0x45,0x4D,
-	0x53,0x00,0x58,0x4D,0x53,0x00,0x59,0x45,0x53,0x00,0x41,
-	0x55,0x44,0x49,0x42,0x4C,0x45,0x00,0x56,0x45,0x52,0x49,
-	0x46,0x59,0x00,0x49,0x4E,0x46,0x4F,0x52,0x4D,0x41,0x54,
-	0x49,0x56,0x45,0x00,0x4F,0x56,0x45,0x52,0x57,0x52,0x49,
-	0x54,0x45,0x00,0x41,0x4C,0x57,0x41,0x59,0x53,0x00,0x4E,
-	0x45,0x56,0x45,0x52,0x00,0x41,0x55,0x54,0x4F,0x45,0x58,
-	0x49,0x54,0x00,0x4D,0x4F,0x44,0x45,0x00,0x52,0x45,0x43,
-	0x4F,0x56,0x45,0x52,0x59,0x00,0x4E,0x4F,0x52,0x4D,0x41,
-	0x4C,0x00,0x4E,0x4F,0x00,0x41,0x53,0x4B,0x44,0x49,0x53,
-	0x4B,0x00,0x55,0x53,0x45,0x44,0x41,0x54,0x46,0x49,0x4C,
-	0x45,0x00,0x46,0x41,0x53,0x54,0x00,0x46,0x55,0x4C,0x4C,
-	0x00,0x53,0x50,0x45,0x45,0x44,0x00,0x41,0x53,0x4B,0x54,
-	0x41,0x52,0x47,0x45,0x54,0x00,0x53,0x45,0x52,0x49,0x41,
-	0x4C,0x4E,0x55,0x4D,0x42,0x45,0x52,0x00,0x55,0x50,0x44,
-	0x41,0x54,0x45,0x00,0x4C,0x45,0x41,0x56,0x45,0x00,0x4F,
-	0x50,0x54,0x49,0x4F,0x4E,0x53,0x00,0x4F,0x50,0x54,0x49,
-	0x4F,0x4E,0x00,0x4D,0x45,0x4D,0x4F,0x52,0x59,0x00,0x47,
-	0x45,0x4E,0x45,0x52,0x41,0x54,0x45,0x00,0x47,0x45,0x4E,
-	0x45,0x52,0x41,0x54,0x49,0x4F,0x4E,0x00,0x44,0x4B,0x43,
-	0x50,0x49,0x4E,0x49,0x00,0x64,0x6B,0x63,0x70,0x69,0x6E,
-	0x69,0x00,0x64,0x69,0x73,0x6B,0x63,0x6F,0x70,0x79,0x2E,
-	0x69,0x6E,0x69,0x00,0x72,0x74,0x00,0x23,0x00,0x20,0x09,
-	0x1A,0x00,0x0D,0x0A,0x00,0x0D,0x00,0x3D,0x00,0x5B,0x2D,
-	0x00,0x5B,0x00,0x2D,0x5D,0x00,0x0A,0x00,0xCE,0x3C,0x09,
-	0x00,0xDF,0x3C,0x08,0x00,0xF0,0x3C,0x0C,0x00,0x12,0x3D,
-	0x0D,0x00,0x23,0x3D,0x0E,0x00,0x34,0x3D,0x10,0x00,0x45,
-	0x3D,0x12,0x00,0x56,0x3D,0x13,0x00,0x01,0x3D,0x0F,0x00,
-	0x67,0x3D,0x11,0x00,0xCA,0x3D,0x1E,0x00,0x2D,0x3E,0x14,
-	0x00,0xA1,0x3E,0x1B,0x00,0x90,0x3E,0x03,0x00,0x07,0x00,
-	0x04,0x0E,0x0A,0x00,0x0B,0x00,0x10,0x0E,0x01,0x00,0x1A,
-	0x00,0x38,0x0E,0x53,0x79,0x6E,0x74,0x61,0x78,0x20,0x65,
-	0x72,0x72,0x6F,0x72,0x20,0x6F,0x6E,0x20,0x6C,0x69,0x6E,
-	0x65,0x00,0x25,0x73,0x00,0x20,0x25,0x64,0x20,0x00,0x69,
-	0x6E,0x20,0x63,0x6F,0x6E,0x66,0x69,0x67,0x75,0x72,0x61,
-	0x74,0x69,0x6F,0x6E,0x20,0x66,0x69,0x6C,0x65,0x2E,0x00,
-	0x53,0x65,0x6D,0x61,0x6E,0x74,0x69,0x63,0x20,0x65,0x72,
-	0x72,0x6F,0x72,0x20,0x69,0x6E,0x20,0x63,0x6F,0x6E,0x66,
-	0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x66,
-	0x69,0x6C,0x65,0x00,0x20,0x28,0x25,0x64,0x29,0x3A,0x20,
-	0x25,0x73,0x21,0x0A,0x00,0x64,0x6F,0x20,0x6E,0x6F,0x74,
-	0x20,0x65,0x6E,0x74,0x65,0x72,0x20,0x6D,0x6F,0x72,0x65,
-	0x20,0x74,0x68,0x61,0x6E,0x20,0x6F,0x6E,0x65,0x20,0x27,
-	0x3D,0x27,0x00,0x70,0x6C,0x65,0x61,0x73,0x65,0x20,0x65,
-	0x6E,0x74,0x65,0x72,0x20,0x59,0x45,0x53,0x20,0x6F,0x72,
-	0x20,0x4E,0x4F,0x00,0x70,0x6C,0x65,0x61,0x73,0x65,0x20,
-	0x65,0x6E,0x74,0x65,0x72,0x20,0x4E,0x45,0x56,0x45,0x52,
-	0x20,0x6F,0x72,0x20,0x41,0x4C,0x57,0x41,0x59,0x53,0x00,
-	0x70,0x6C,0x65,0x61,0x73,0x65,0x20,0x65,0x6E,0x74,0x65,
-	0x72,0x20,0x52,0x45,0x43,0x4F,0x56,0x45,0x52,0x59,0x20,
-	0x6F,0x72,0x20,0x4E,0x4F,0x52,0x4D,0x41,0x4C,0x00,0x70,
-	0x6C,0x65,0x61,0x73,0x65,0x20,0x65,0x6E,0x74,0x65,0x72,
-	0x20,0x46,0x41,0x53,0x54,0x20,0x6F,0x72,0x20,0x46,0x55,
-	0x4C,0x4C,0x00,0x70,0x6C,0x65,0x61,0x73,0x65,0x20,0x65,
-	0x6E,0x74,0x65,0x72,0x20,0x55,0x50,0x44,0x41,0x54,0x45,
-	0x20,0x6F,0x72,0x20,0x4C,0x45,0x41,0x56,0x45,0x00,0x00,
-	0x00,0x4D,0x65,0x64,0x69,0x61,0x20,0x65,0x72,0x72,0x6F,
-	0x72,0x20,0x72,0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x66,
-	0x72,0x6F,0x6D,0x20,0x64,0x69,0x73,0x6B,0x2C,0x20,0x72,
-	0x65,0x73,0x63,0x61,0x6E,0x6E,0x69,0x6E,0x67,0x2E,0x2E,
-	0x2E,0x00,0x25,0x73,0x00,0x55,0x6E,0x72,0x65,0x61,0x64,
-	0x61,0x62,0x6C,0x65,0x20,0x73,0x65,0x63,0x74,0x6F,0x72,
-	0x20,0x61,0x74,0x20,0x70,0x6F,0x73,0x69,0x74,0x69,0x6F,
-	0x6E,0x00,0x20,0x25,0x64,0x2E,0x0A,0x00,0x00,0x64,0x69,
-	0x73,0x6B,0x63,0x6F,0x70,0x79,0x2E,0x69,0x6E,0x69,0x00,
-	0x64,0x69,0x73,0x6B,0x63,0x6F,0x70,0x79,0x2E,0x64,0x61,
-	0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x0A,0x00,0x49,0x6E,0x73,0x65,0x72,0x74,0x20,0x54,
-	0x41,0x52,0x47,0x45,0x54,0x20,0x64,0x69,0x73,0x6B,0x65,
-	0x74,0x74,0x65,0x20,0x69,0x6E,0x74,0x6F,0x20,0x64,0x72,
-	0x69,0x76,0x65,0x00,0x25,0x73,0x00,0x50,0x72,0x65,0x73,
-	0x73,0x20,0x61,0x6E,0x79,0x20,0x6B,0x65,0x79,0x20,0x74,
-	0x6F,0x20,0x63,0x6F,0x6E,0x74,0x69,0x6E,0x75,0x65,0x20,
-	0x2E,0x20,0x2E,0x20,0x2E,0x00,0x44,0x69,0x73,0x6B,0x20,
-	0x6E,0x6F,0x74,0x20,0x72,0x65,0x61,0x64,0x79,0x21,0x00,
-	0x4E,0x6F,0x74,0x20,0x65,0x6E,0x6F,0x75,0x67,0x68,0x20,
-	0x64,0x69,0x73,0x6B,0x20,0x73,0x70,0x61,0x63,0x65,0x20,
-	0x6F,0x6E,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x20,0x64,
-	0x72,0x69,0x76,0x65,0x21,0x00,0x50,0x75,0x74,0x20,0x61,
-	0x20,0x64,0x69,0x73,0x6B,0x65,0x74,0x74,0x65,0x20,0x77,
-	0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,
-	0x68,0x74,0x20,0x63,0x61,0x70,0x61,0x63,0x69,0x74,0x79,
-	0x20,0x69,0x6E,0x20,0x64,0x72,0x69,0x76,0x65,0x00,0x20,
-	0x25,0x63,0x3A,0x2C,0x0A,0x00,0x6F,0x72,0x20,0x70,0x72,
-	0x65,0x73,0x73,0x20,0x43,0x54,0x52,0x4C,0x2D,0x43,0x20,
-	0x74,0x6F,0x20,0x63,0x61,0x6E,0x63,0x65,0x6C,0x2E,0x00,
-	0x46,0x69,0x6C,0x65,0x20,0x69,0x73,0x20,0x77,0x72,0x69,
-	0x74,0x65,0x20,0x70,0x72,0x6F,0x74,0x65,0x63,0x74,0x65,
-	0x64,0x21,0x00,0x46,0x69,0x6C,0x65,0x20,0x61,0x6C,0x72,
-	0x65,0x61,0x64,0x79,0x20,0x65,0x78,0x69,0x73,0x74,0x73,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x41,
-	0x41,0x41,0x41,0x41,0x41,0x00,0x00,0x00,0x00,0x00,0x3F,
-	0x3A,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x20,0x73,0x65,0x72,
-	0x69,0x61,0x6C,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x20,
-	0x69,0x73,0x00,0x25,0x73,0x00,0x20,0x00,0x2D,0x00,0x25,
-	0x2E,0x32,0x58,0x00,0x00,0x00,0x25,0x64,0x2E,0x25,0x64,
-	0x00,0x4C,0x41,0x4E,0x47,0x00,0x4E,0x4C,0x53,0x50,0x41,
-	0x54,0x48,0x00,0x3B,0x00,0x5C,0x00,0x3B,0x00,0x72,0x00,
-	0x3A,0x00,0x0A,0x00,0x00,0x24,0x49,0x64,0x3A,0x20,0x52,
-	0x45,0x4E,0x39,0x35,0x2E,0x43,0x20,0x31,0x2E,0x32,0x20,
-	0x32,0x30,0x30,0x30,0x2F,0x30,0x31,0x2F,0x31,0x31,0x20,
-	0x30,0x39,0x3A,0x33,0x34,0x3A,0x33,0x39,0x20,0x73,0x6B,
-	0x61,0x20,0x45,0x78,0x70,0x20,0x73,0x6B,0x61,0x20,0x24,
-	0x00,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6F,0x6E,0x20,
-	0x66,0x61,0x69,0x6C,0x65,0x64,0x3A,0x20,0x25,0x73,0x2C,
-	0x20,0x66,0x69,0x6C,0x65,0x20,0x25,0x73,0x2C,0x20,0x6C,
-	0x69,0x6E,0x65,0x20,0x25,0x64,0x0A,0x00,0x6F,0x6C,0x64,
-	0x6E,0x61,0x6D,0x00,0x72,0x65,0x6E,0x39,0x35,0x2E,0x63,
-	0x00,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6F,0x6E,0x20,
-	0x66,0x61,0x69,0x6C,0x65,0x64,0x3A,0x20,0x25,0x73,0x2C,
-	0x20,0x66,0x69,0x6C,0x65,0x20,0x25,0x73,0x2C,0x20,0x6C,
-	0x69,0x6E,0x65,0x20,0x25,0x64,0x0A,0x00,0x6E,0x65,0x77,
-	0x6E,0x61,0x6D,0x00,0x72,0x65,0x6E,0x39,0x35,0x2E,0x63,
-	0x00,0x00,0x24,0x49,0x64,0x3A,0x20,0x4C,0x32,0x53,0x39,
-	0x35,0x2E,0x43,0x20,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,
-	0x30,0x2F,0x30,0x31,0x2F,0x31,0x31,0x20,0x30,0x39,0x3A,
-	0x31,0x30,0x3A,0x30,0x39,0x20,0x73,0x6B,0x61,0x20,0x45,
-	0x78,0x70,0x20,0x73,0x6B,0x61,0x20,0x24,0x00,0x41,0x73,
-	0x73,0x65,0x72,0x74,0x69,0x6F,0x6E,0x20,0x66,0x61,0x69,
-	0x6C,0x65,0x64,0x3A,0x20,0x25,0x73,0x2C,0x20,0x66,0x69,
-	0x6C,0x65,0x20,0x25,0x73,0x2C,0x20,0x6C,0x69,0x6E,0x65,
-	0x20,0x25,0x64,0x0A,0x00,0x66,0x6E,0x61,0x6D,0x00,0x6C,
-	0x32,0x73,0x39,0x35,0x2E,0x63,0x00,0x41,0x73,0x73,0x65,
-	0x72,0x74,0x69,0x6F,0x6E,0x20,0x66,0x61,0x69,0x6C,0x65,
-	0x64,0x3A,0x20,0x25,0x73,0x2C,0x20,0x66,0x69,0x6C,0x65,
-	0x20,0x25,0x73,0x2C,0x20,0x6C,0x69,0x6E,0x65,0x20,0x25,
-	0x64,0x0A,0x00,0x62,0x75,0x66,0x00,0x6C,0x32,0x73,0x39,
-	0x35,0x2E,0x63,0x00,0x24,0x49,0x64,0x3A,0x20,0x57,0x49,
-	0x4E,0x39,0x35,0x41,0x50,0x49,0x2E,0x43,0x20,0x31,0x2E,
-	0x32,0x20,0x32,0x30,0x30,0x30,0x2F,0x30,0x31,0x2F,0x31,
-	0x31,0x20,0x30,0x39,0x3A,0x33,0x34,0x3A,0x34,0x32,0x20,
-	0x73,0x6B,0x61,0x20,0x45,0x78,0x70,0x20,0x73,0x6B,0x61,
-	0x20,0x24,0x00,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6F,
-	0x6E,0x20,0x66,0x61,0x69,0x6C,0x65,0x64,0x3A,0x20,0x25,
-	0x73,0x2C,0x20,0x66,0x69,0x6C,0x65,0x20,0x25,0x73,0x2C,
-	0x20,0x6C,0x69,0x6E,0x65,0x20,0x25,0x64,0x0A,0x00,0x72,
-	0x70,0x00,0x77,0x69,0x6E,0x39,0x35,0x61,0x70,0x69,0x2E,
-	0x63,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,
-	0x20,0x20,0x20,0x21,0x21,0x21,0x21,0x21,0x20,0x20,0x20,
-	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-	0x20,0x20,0x20,0x20,0x01,0x40,0x40,0x40,0x40,0x40,0x40,
-	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x02,0x02,
-	0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x40,0x40,0x40,
-	0x40,0x40,0x40,0x40,0x14,0x14,0x14,0x14,0x14,0x14,0x04,
-	0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
-	0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x40,0x40,0x40,
-	0x40,0x40,0x40,0x18,0x18,0x18,0x18,0x18,0x18,0x08,0x08,
-	0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
-	0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x40,0x40,0x40,0x40,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x5A,
-	0xB4,0x5A,0xB4,0x5A,0x00,0x00,0x00,0x00,0x09,0x02,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x14,
-	0x00,0x00,0x0A,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x18,0x14,0x00,0x00,0x02,0x02,0x02,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x14,0x00,
-	0x00,0x43,0x02,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x38,0x14,0x00,0x00,0x42,0x02,0x04,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x14,0x00,0x00,
-	0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x58,0x14,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x14,0x00,0x00,0x00,
-	0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x78,0x14,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x88,0x14,0x00,0x00,0x00,0x00,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,
-	0x14,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x14,0x00,0x00,0x00,0x00,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x14,
-	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xC8,0x14,0x00,0x00,0x00,0x00,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x14,0x00,
-	0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE8,0x14,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x14,0x00,0x00,
-	0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x15,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x15,0x00,0x00,0x00,
-	0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x28,0x15,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x38,0x15,0x01,0x20,0x02,0x20,
-	0x02,0x20,0x04,0xA0,0x02,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x40,0xFF,0xFF,0x00,0x00,0x0D,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x10,0x54,0x4D,0x50,0x00,0x2E,
-	0x24,0x24,0x24,0x00,0x00,0x01,0x00,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x01,0x00,0x43,0x4F,0x4D,0x50,0x41,0x51,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x13,0x02,0x02,0x04,0x05,0x06,
-	0x08,0x08,0x08,0x14,0x15,0x05,0x13,0xFF,0x16,0x05,0x11,
-	0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x05,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,
-	0xFF,0x23,0x02,0xFF,0x0F,0xFF,0xFF,0xFF,0xFF,0x13,0xFF,
-	0xFF,0x02,0x02,0x05,0x0F,0x02,0xFF,0xFF,0xFF,0x13,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x23,0xFF,0xFF,0xFF,
-	0xFF,0x23,0xFF,0x13,0xFF,0x00,0x28,0x6E,0x75,0x6C,0x6C,
-	0x29,0x00,0x00,0x14,0x14,0x01,0x14,0x15,0x14,0x14,0x14,
-	0x14,0x02,0x00,0x14,0x03,0x04,0x14,0x09,0x05,0x05,0x05,
-	0x05,0x05,0x05,0x05,0x05,0x05,0x14,0x14,0x14,0x14,0x14,
-	0x14,0x14,0x14,0x14,0x14,0x14,0x0F,0x17,0x0F,0x08,0x14,
-	0x14,0x14,0x07,0x14,0x16,0x14,0x14,0x14,0x14,0x14,0x14,
-	0x14,0x14,0x14,0x0D,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-	0x14,0x14,0x14,0x10,0x0A,0x0F,0x0F,0x0F,0x08,0x0A,0x14,
-	0x14,0x06,0x14,0x12,0x0B,0x0E,0x14,0x14,0x11,0x14,0x0C,
-	0x14,0x14,0x0D,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x78,0xDA,0xEC,0xBD,0x7B,0x78,0x14,0x45,0xF6,0x30,0x5C,
+	0x33,0xD3,0xD3,0x33,0x99,0xDC,0x43,0x32,0xE1,0x1A,0x42,
+	0x84,0x88,0x84,0x7B,0x20,0x08,0x09,0x21,0x68,0x68,0x10,
+	0x25,0x0C,0x17,0x27,0x34,0x48,0x50,0xD7,0xCB,0xAE,0xEE,
+	0xBA,0x6B,0x98,0x09,0xEE,0x1A,0x26,0x13,0xC7,0x45,0x66,
+	0x1A,0xA2,0xEB,0xBA,0x0A,0xAE,0xBB,0x72,0x51,0x56,0x59,
+	0x75,0x51,0xE3,0xDA,0xE0,0x85,0x08,0x98,0x28,0x2E,0xCA,
+	0xC5,0xC5,0x88,0x2E,0xB2,0xA0,0x58,0x43,0xB3,0x88,0x80,
+	0x49,0x4C,0x86,0xE9,0xEF,0x9C,0xEA,0xEE,0xC9,0x64,0x74,
+	0x7F,0xEF,0xF7,0x7E,0x7F,0x7C,0xCF,0xF3,0x3E,0xCF,0xAB,
+	0x4F,0xA6,0xBB,0x4F,0x9D,0x5B,0x9D,0xAA,0x3A,0x75,0x4E,
+	0x55,0x75,0x33,0x6F,0xE9,0x0E,0xD3,0x22,0x62,0x25,0xF9,
+	0xE4,0x3D,0xA2,0xAA,0x3D,0x0E,0x3F,0xD1,0xFE,0x2B,0x87,
+	0x3F,0x13,0xE9,0x19,0x7F,0x57,0x2D,0xF9,0x1F,0xFE,0x33,
+	0xC1,0xDF,0x71,0xF8,0xCB,0x80,0x9B,0x1B,0xE6,0x11,0xB2,
+	0x7A,0x29,0xF9,0xBF,0xFF,0xFD,0x1F,0xF5,0xDF,0xAE,0x23,
+	0xF6,0xB1,0x41,0xE7,0x64,0x73,0xF3,0xF8,0x03,0xC3,0xA4,
+	0xB1,0x66,0x22,0xE5,0x8D,0x26,0x4D,0xC7,0xB6,0x3E,0x42,
+	0xD6,0xF1,0x4D,0x24,0x98,0x17,0x22,0xC1,0xB1,0xDB,0x08,
+	0x9D,0x6E,0xDA,0x57,0xBE,0x96,0x48,0x6D,0x52,0xFB,0x4E,
+	0xB5,0x21,0x72,0xE1,0xA5,0x53,0xB7,0x5C,0x5B,0x78,0xB5,
+	0xD5,0xDB,0xE1,0x3F,0xE0,0xEF,0xFC,0x34,0x98,0xB6,0x96,
+	0xEC,0x34,0x91,0x23,0xA7,0x02,0x7B,0xED,0x81,0x53,0x5D,
+	0xC1,0xBC,0x75,0x64,0xDD,0xB1,0xA2,0x33,0x52,0x79,0x7D,
+	0x4E,0xA3,0x4A,0xCC,0x2B,0x6D,0xBB,0x89,0x39,0x88,0x0F,
+	0x6D,0xF7,0x15,0xD4,0x8E,0xB4,0x94,0x7B,0x72,0x6A,0x0B,
+	0x5E,0xE6,0x8E,0x7C,0x33,0xBB,0xF4,0x9B,0xDA,0x01,0x01,
+	0x28,0x20,0x1E,0x5B,0x00,0xA0,0xC4,0x9B,0xB6,0x9B,0x64,
+	0x94,0x7E,0xB3,0xCA,0x26,0x5D,0x56,0x2C,0xE1,0x07,0x4D,
+	0xD2,0x17,0x96,0x63,0xC1,0xBC,0x3F,0x83,0x1A,0x5B,0xC8,
+	0xE6,0x26,0x52,0xD4,0xDE,0xD4,0xD2,0x3C,0xB7,0xFA,0xC0,
+	0xB0,0x15,0x47,0xBE,0xEE,0x6E,0x3A,0x2C,0x7D,0xDD,0x53,
+	0xDC,0x32,0xB6,0x89,0x9F,0x6C,0xDE,0xED,0x77,0xEE,0xBC,
+	0xAF,0xA0,0xE8,0xA3,0xC8,0xC5,0xED,0xCD,0xE4,0xC0,0xC0,
+	0xA0,0xF3,0x31,0x12,0x4C,0x7B,0x9C,0x14,0xFF,0x47,0x3E,
+	0x64,0x6F,0x6A,0x7F,0x9B,0x90,0xDD,0xFD,0x09,0x3D,0x43,
+	0xC6,0x36,0xE5,0x4D,0x36,0x8F,0x6D,0xE5,0xBF,0x36,0xD5,
+	0xC2,0xEF,0x51,0x13,0x51,0x4B,0xD6,0xC0,0xDF,0x83,0xF0,
+	0xF7,0x00,0xA1,0x63,0x4D,0x2E,0xBA,0x4D,0x94,0x0F,0x23,
+	0x85,0x9D,0xEC,0xB6,0x13,0x2A,0x6B,0x14,0xAA,0x93,0x64,
+	0xAB,0x4E,0x33,0xFC,0x71,0xD9,0x0C,0x40,0x6B,0x49,0x71,
+	0x8B,0x74,0x7E,0xE7,0x18,0x62,0xE6,0xFC,0x1F,0x13,0xE1,
+	0x64,0xD7,0x98,0x67,0x53,0x3C,0x49,0x3B,0x07,0x90,0x5D,
+	0x63,0x08,0x7D,0x97,0x48,0x67,0x9B,0x6F,0x08,0x09,0xE6,
+	0x03,0xC3,0x76,0xA6,0x91,0x5D,0x02,0x09,0xBF,0x43,0xF2,
+	0x64,0x32,0xF9,0xC0,0xB0,0x60,0x5E,0x2D,0x58,0xD5,0x43,
+	0x64,0x8E,0x3D,0xD4,0xC1,0xC3,0x7D,0x44,0xB6,0xB2,0x87,
+	0xDF,0xC0,0x43,0x3D,0x91,0x79,0xF6,0xE0,0x83,0x07,0x3F,
+	0x91,0xC9,0x88,0x75,0xFB,0x9B,0x8E,0xED,0xBA,0xC9,0x74,
+	0x60,0xD8,0xD0,0xBD,0xC0,0x62,0xC4,0xBB,0xCE,0x5A,0x02,
+	0xF7,0x79,0x32,0x07,0xB7,0x75,0xDA,0xAD,0x15,0x6E,0x7F,
+	0xA3,0xDD,0xF2,0x70,0xEB,0xC3,0xDB,0xBD,0xCD,0xAA,0xF4,
+	0x89,0x74,0xBC,0xF4,0x0B,0x4F,0xB6,0x7F,0x86,0xEA,0x71,
+	0x5C,0x7D,0xA7,0x69,0x95,0x35,0x74,0xA7,0x49,0x3A,0x12,
+	0xD8,0xCB,0x2B,0xB4,0xF4,0x13,0x4F,0xBE,0x74,0x2C,0xCF,
+	0xC6,0xFB,0x67,0x90,0x56,0x9B,0xCA,0xEA,0xE4,0xB1,0x15,
+	0xAA,0x2B,0xCC,0x43,0x95,0x77,0x0B,0xD5,0x6A,0xB8,0xBC,
+	0xBD,0xB7,0xB9,0xE2,0x0D,0x33,0xF0,0xDA,0xBB,0x33,0x8F,
+	0xEC,0x5A,0xAC,0x19,0x82,0x9E,0x51,0x65,0x0B,0x71,0xD1,
+	0xEF,0xA3,0x38,0xF0,0x6F,0x94,0xCE,0x36,0x9E,0xF5,0xF9,
+	0xDD,0xD5,0x52,0x1D,0xDF,0x26,0x1C,0x25,0xA4,0x4D,0x68,
+	0xC7,0x9F,0x2D,0xF8,0xF3,0x94,0x09,0x7E,0xA2,0x78,0xF7,
+	0x1E,0x21,0xEA,0x24,0xBA,0x79,0xBA,0x48,0x47,0x5D,0x4F,
+	0x7F,0x7E,0x83,0x6C,0x22,0x2E,0x79,0x3B,0x30,0x39,0xB0,
+	0x40,0x14,0xB7,0x86,0x9C,0xF2,0xAB,0xC4,0x55,0xDC,0xE2,
+	0x72,0xA9,0x25,0x21,0x27,0xFD,0xE5,0x82,0xC0,0x3E,0xFB,
+	0x56,0xBF,0x53,0xCA,0xF3,0x3B,0x43,0xB6,0x2D,0xCF,0x11,
+	0xF9,0x35,0xC0,0x36,0x31,0x0C,0x86,0x50,0xD5,0x17,0xE1,
+	0x79,0x42,0x1F,0x9B,0xB0,0x56,0x78,0x31,0xE0,0xE3,0xCC,
+	0xDE,0xB1,0xD2,0x4D,0x66,0xFF,0x8C,0x71,0x1E,0x07,0x5C,
+	0x43,0xB6,0x69,0xC2,0x8B,0xDE,0xC1,0x08,0x69,0x30,0xCD,
+	0xF0,0xF6,0x63,0x37,0x66,0xE2,0x75,0x84,0x84,0x17,0x5D,
+	0x74,0x62,0x6E,0x78,0xBF,0x13,0x69,0x7C,0xD9,0xAA,0xC7,
+	0x4C,0xAF,0x1D,0x2C,0x06,0x85,0x7F,0xA8,0x1E,0x8E,0x4E,
+	0xC5,0xBB,0xFD,0x50,0x62,0x59,0x9D,0xC6,0x30,0xED,0xB9,
+	0xA2,0xCC,0x91,0xF0,0xD3,0x4E,0xC4,0x4B,0x1F,0x2C,0x26,
+	0xB7,0x78,0xF9,0x80,0xEF,0x1F,0xC4,0x93,0x89,0xE8,0xD1,
+	0x41,0x08,0x48,0x0F,0xF8,0xF6,0x13,0x6F,0x92,0xFC,0x3A,
+	0xAA,0x19,0xBE,0xC3,0x0E,0xBA,0xD2,0x92,0x12,0x28,0x59,
+	0xED,0x90,0xCF,0x31,0xF5,0xC3,0x0B,0xEC,0xF4,0x27,0x25,
+	0x52,0x97,0x34,0x8B,0x0F,0x0A,0x6F,0x4B,0xB3,0xEC,0x41,
+	0xE1,0x4D,0x69,0x16,0x17,0x14,0x5E,0x91,0x66,0x39,0x82,
+	0xC2,0x0E,0x69,0x56,0x4A,0x50,0xD8,0x27,0xCD,0x4A,0x0B,
+	0x0A,0xBB,0xA4,0x59,0x19,0x41,0x41,0x96,0x66,0x65,0x05,
+	0x85,0xBF,0x07,0x56,0x3B,0x9D,0x5E,0x2B,0x30,0x50,0xCC,
+	0xC5,0x2D,0x41,0xE1,0x25,0x69,0x56,0x76,0x50,0xD8,0xD6,
+	0x26,0xEC,0xB1,0x90,0xF0,0x3A,0x93,0x54,0xB3,0xE7,0xD0,
+	0x29,0x75,0x3C,0x9D,0xF8,0x6B,0x71,0xBA,0x85,0xD4,0x8D,
+	0x96,0x33,0x4C,0x2E,0xD9,0xAC,0xD9,0x8B,0x19,0x6B,0x98,
+	0x4B,0x33,0x96,0x5A,0xE2,0x77,0xCA,0x0A,0x98,0xFC,0xDC,
+	0x0A,0x51,0x04,0xAA,0xF0,0xD7,0xD0,0x5E,0x2D,0x26,0x62,
+	0x30,0xF8,0xF6,0x3E,0x64,0xE0,0xCD,0x65,0xCF,0x52,0x7F,
+	0x30,0xD4,0x18,0xAF,0x0D,0x30,0x08,0x81,0x41,0x98,0x69,
+	0xD2,0xC1,0xCC,0xA4,0x9E,0x74,0x03,0x09,0x0C,0x6D,0x09,
+	0x77,0x13,0xA3,0x70,0xB6,0x69,0x43,0x50,0x78,0x72,0x67,
+	0x0E,0x79,0xE3,0xC8,0x80,0xB1,0x92,0xAD,0x54,0x78,0xD2,
+	0x63,0xBB,0xF6,0xDA,0x93,0x97,0xC2,0x87,0xC8,0x58,0xF5,
+	0xCE,0x51,0x92,0x00,0xFA,0xBF,0x1D,0xFE,0x98,0xB0,0x9B,
+	0x37,0xC3,0x1F,0xE0,0x4D,0x67,0xFB,0xA0,0x96,0x0A,0x30,
+	0x42,0xF8,0x2D,0x0D,0xBC,0x23,0xDC,0xAC,0xDD,0xEC,0x0B,
+	0xFF,0x55,0xBB,0xD9,0x15,0xDE,0x12,0x87,0x28,0x87,0x1F,
+	0xD3,0xC0,0x2F,0x85,0x25,0xED,0x66,0x5B,0xF8,0x81,0xB8,
+	0xF2,0xBF,0x2B,0x5E,0x79,0x92,0x09,0xFB,0x0A,0x9A,0x81,
+	0x99,0x20,0x6F,0x7E,0x82,0x09,0x94,0x1A,0x66,0x02,0xAC,
+	0xB7,0x5C,0x09,0x03,0xFE,0x33,0x78,0x96,0xAF,0x33,0x31,
+	0xA3,0xC5,0xA8,0x68,0x55,0x02,0xD5,0x6B,0x88,0xF5,0x0A,
+	0xDC,0x14,0xDF,0x22,0x2A,0x19,0xF2,0x08,0x53,0xF8,0xB1,
+	0xA8,0x5C,0x03,0x54,0xD0,0x10,0x4D,0x51,0x55,0xD8,0x23,
+	0x09,0x7B,0x4A,0x05,0x6E,0xB5,0x25,0xFC,0xB3,0x28,0x76,
+	0x0F,0xAF,0x25,0x5C,0x62,0x62,0xDD,0xC2,0x12,0x1E,0x63,
+	0xC2,0xCE,0x0B,0xDD,0xE7,0xAF,0xD7,0x01,0x13,0x6C,0x1B,
+	0xE8,0x39,0x4F,0xEB,0xF7,0xEB,0x85,0xA7,0x5C,0xF4,0x8F,
+	0x73,0x45,0x11,0x95,0x86,0x67,0x6A,0x9E,0x2B,0xBA,0xE8,
+	0x2B,0x0B,0x45,0xEC,0x58,0x05,0x01,0xDF,0x3E,0xE2,0x19,
+	0xCC,0xE0,0x67,0xAE,0x03,0xF8,0xBB,0xAB,0xC4,0xE9,0xAA,
+	0xEA,0x75,0xC8,0x2B,0x41,0x34,0x74,0xCB,0x6E,0x2B,0x2B,
+	0xFB,0x10,0xCA,0xB0,0xD3,0xB5,0x22,0x4E,0xF6,0x70,0xA4,
+	0xF5,0x2C,0x04,0x89,0xF2,0x2C,0xA8,0x60,0xF7,0x72,0x90,
+	0xB4,0x0E,0xF0,0xAD,0x71,0x3D,0xC3,0x96,0x58,0xC1,0x8F,
+	0x01,0x0B,0xF4,0x92,0x1F,0x07,0x8A,0xF7,0xE0,0x3E,0xE0,
+	0x7B,0x9B,0x78,0xEC,0xF2,0x93,0xF0,0xB8,0x73,0xB9,0x48,
+	0x87,0xCF,0x0D,0x3F,0xD9,0x4F,0x7E,0x4A,0xB3,0xAD,0x45,
+	0x67,0xB2,0x67,0x5E,0x02,0x93,0x87,0x19,0x13,0x33,0xB3,
+	0x6B,0x00,0xC5,0xFE,0x5E,0xB7,0xAB,0x41,0xF1,0x48,0x22,
+	0xC5,0x72,0x5D,0xEC,0x0B,0x40,0xB1,0x00,0xEE,0xC3,0xA5,
+	0x59,0x6C,0x74,0xDD,0xA9,0x9B,0xEC,0xBE,0x39,0x22,0x8E,
+	0x3F,0x56,0x3B,0x3A,0x07,0x6A,0xB7,0x61,0x01,0xAB,0xDD,
+	0x68,0xF9,0x15,0x60,0xCD,0xC7,0xD5,0x68,0x72,0x22,0x6B,
+	0xB3,0xA6,0x4C,0x58,0xB5,0x80,0x00,0xE4,0x15,0xE8,0x2F,
+	0xC2,0xE0,0xDE,0x02,0x0E,0x09,0x5D,0x53,0x2B,0x8C,0xCA,
+	0xAD,0x44,0x6F,0xA2,0x27,0x09,0x20,0x60,0xB3,0xAC,0xD0,
+	0x70,0x8C,0x56,0xFA,0x7E,0x76,0x5C,0x2B,0x7D,0x37,0x07,
+	0xCD,0xB2,0x85,0x78,0x97,0x18,0x6D,0xE5,0x46,0x8D,0x78,
+	0xA6,0x91,0xF7,0x5A,0xD6,0x56,0x93,0x18,0xBC,0x1C,0xE1,
+	0x03,0xEA,0x34,0x45,0xB5,0xA6,0xEA,0x55,0x74,0xDD,0x0D,
+	0x7D,0x14,0x0D,0xDF,0x6A,0x91,0xF7,0x00,0x8A,0x8D,0x28,
+	0x9F,0x21,0x77,0x8F,0xB5,0x4D,0x78,0x09,0x15,0xD4,0xB4,
+	0x84,0xE9,0x18,0x9D,0xD9,0x06,0x17,0xBD,0xFF,0x76,0x91,
+	0xDB,0xBD,0x56,0x78,0x4D,0xBA,0x89,0x63,0xCF,0x77,0x6B,
+	0xCF,0xCD,0x9B,0x9E,0x23,0x6B,0x85,0x1E,0xF6,0xDB,0x2D,
+	0xFF,0x2B,0x0F,0x9A,0x6F,0xA1,0x48,0x9F,0x58,0xBA,0x75,
+	0x9D,0x93,0xE9,0xF2,0xC4,0x52,0x51,0xDE,0x0D,0xD0,0x57,
+	0x5C,0x62,0x48,0x78,0x6D,0x9A,0xD0,0xEC,0xF9,0x65,0xC0,
+	0xF7,0x1E,0xF1,0xFE,0x8C,0x36,0x17,0x81,0x7E,0xB7,0x02,
+	0x70,0x43,0x70,0xCD,0x03,0x0D,0x21,0xA1,0x19,0xAE,0x0F,
+	0x36,0xAC,0x5F,0xF3,0xE4,0xEE,0xE0,0x9A,0x35,0x78,0x6D,
+	0x08,0xAE,0x59,0xDB,0xD0,0xB6,0x26,0xD4,0x40,0x2A,0x24,
+	0xE1,0xED,0xE0,0x9A,0x75,0x0D,0x92,0xB0,0x2B,0xB8,0xA6,
+	0x09,0x2E,0x72,0x70,0xCD,0x23,0x70,0x79,0x29,0xB8,0xE6,
+	0x51,0xB8,0xBC,0x19,0x5C,0xF3,0x18,0x5C,0xB6,0x05,0xD7,
+	0x3C,0xDE,0x20,0xCD,0xEA,0x1F,0x5C,0xB3,0x01,0xC8,0x1F,
+	0x68,0x00,0x2F,0x38,0x3C,0x7C,0x6B,0x66,0x9B,0xF0,0x21,
+	0x4E,0x03,0x07,0x09,0x09,0x97,0x64,0xA2,0x6C,0x0F,0x78,
+	0xD0,0x56,0xB3,0xF7,0xBE,0x80,0x4F,0x26,0x9E,0x5F,0xB0,
+	0x61,0xF5,0xF9,0x72,0x51,0xFE,0x04,0xAC,0x60,0x8F,0x33,
+	0xD4,0x4F,0xAE,0x4F,0x68,0xD1,0xF1,0xCB,0xB4,0xEE,0xF5,
+	0x3D,0x74,0x96,0xE1,0x70,0x2F,0xAB,0x40,0x91,0x14,0x47,
+	0x31,0x21,0x91,0x22,0xBA,0x54,0x14,0xE9,0x23,0x57,0x30,
+	0x11,0xBF,0x5E,0x2E,0x2A,0x60,0x5B,0x40,0x96,0x84,0x0F,
+	0x93,0x85,0x83,0xE0,0xBD,0x66,0x9A,0xE2,0xD4,0x19,0xBD,
+	0x5E,0xB8,0xE0,0x42,0x6B,0xB8,0x68,0x7D,0x39,0xEB,0x64,
+	0x76,0x3A,0xBB,0x62,0x7A,0x0A,0xF1,0xFC,0x8C,0xD1,0x4F,
+	0x05,0x15,0x87,0x9A,0x5D,0xB2,0x83,0x84,0x7F,0x99,0x2E,
+	0x9B,0xFC,0xAC,0x4F,0x2E,0x16,0xA0,0xA5,0xC7,0xFC,0x0A,
+	0x3B,0x4D,0x24,0xE0,0x8B,0x90,0xD5,0x66,0xE5,0x2A,0xB5,
+	0x2E,0x42,0x2F,0xFC,0x0C,0x20,0x47,0x83,0xEE,0x76,0x7C,
+	0xD8,0x34,0x5F,0x44,0xDE,0x88,0x3F,0x1C,0xF1,0x27,0x32,
+	0xF6,0xDE,0x2C,0xC6,0xF6,0xE4,0x4D,0xA2,0x3C,0x0E,0xD8,
+	0x26,0x93,0xF0,0x68,0xB3,0x24,0x5C,0xEA,0xBC,0xA7,0x2B,
+	0x28,0x9C,0x6B,0x13,0xCE,0x13,0xD0,0xB3,0x23,0x28,0x3C,
+	0xB3,0xD1,0xB5,0x50,0x72,0x9F,0x97,0x84,0x73,0xE2,0x32,
+	0xFA,0x64,0x63,0x50,0x38,0x13,0x74,0x9F,0x95,0x84,0x33,
+	0xC9,0xC2,0x59,0x6F,0x32,0xE3,0xB0,0xE9,0x26,0x31,0xFC,
+	0xC0,0xF7,0x01,0xDF,0x4B,0xC4,0x3B,0x98,0xD5,0xE7,0x27,
+	0x50,0x1F,0x93,0x77,0xB9,0x24,0x9C,0x95,0xDC,0x67,0x4A,
+	0x85,0x76,0xAF,0xB5,0xD4,0x7D,0xD4,0x33,0x2F,0xE1,0x79,
+	0xBA,0xEC,0x44,0x77,0x58,0x2E,0xC6,0xD9,0x20,0x5D,0xAB,
+	0xFF,0xBB,0xE5,0xA8,0xDF,0x70,0x65,0x20,0xAA,0x7C,0xEF,
+	0x2C,0x50,0xD9,0x5F,0xAE,0x69,0x3C,0x17,0x34,0xCD,0x27,
+	0xE1,0x07,0x4C,0xA0,0xAF,0x8B,0xBE,0x54,0xAE,0x39,0xC5,
+	0x3C,0xA8,0x03,0xA9,0x70,0xD1,0xA7,0x4B,0xA1,0xD6,0xC7,
+	0x83,0xEE,0x13,0x38,0x7A,0xEB,0xBA,0xE0,0xAF,0x43,0xAD,
+	0x3B,0xA1,0xD6,0x1D,0xA7,0x9F,0xD4,0x2F,0x74,0xD1,0xC3,
+	0xF5,0x41,0xE1,0x58,0xD0,0xFD,0x39,0x13,0xE8,0x65,0x43,
+	0xE9,0x97,0x5A,0xB9,0x5A,0xD7,0x2A,0x09,0xAD,0x73,0x5C,
+	0x94,0x43,0x61,0xB5,0x43,0xA0,0x19,0xA7,0x47,0x55,0x4F,
+	0x0E,0x34,0x82,0x59,0xC9,0xD2,0x14,0x0F,0xBA,0x4F,0x07,
+	0x05,0x1A,0x7E,0x84,0x84,0xBF,0x23,0x72,0x10,0xF4,0x48,
+	0x8D,0x6B,0xF9,0x29,0xD7,0x25,0xB4,0x3C,0x27,0xA2,0x9B,
+	0x6F,0x65,0x6E,0x3E,0x1F,0xFA,0xCB,0xA5,0x25,0xE0,0x5C,
+	0x26,0x75,0xB1,0x11,0x36,0x04,0x64,0x4D,0x37,0x41,0xC8,
+	0x39,0xDD,0x4C,0x3C,0x29,0xCA,0x78,0x36,0xA2,0x5C,0x3B,
+	0x88,0x92,0x0E,0x7F,0x56,0xED,0x89,0x8D,0x3A,0x18,0xF7,
+	0xA7,0xA1,0x12,0xAF,0xE8,0x95,0xC8,0xEC,0x1F,0xD8,0x07,
+	0xF3,0x34,0x38,0xF8,0x28,0x4E,0xF7,0xCF,0x82,0x0E,0x69,
+	0x44,0x59,0xC5,0x2A,0x62,0x09,0x3F,0x01,0xED,0x45,0x25,
+	0xF7,0xE9,0x52,0xE1,0x04,0x1A,0xF8,0x38,0x68,0xFE,0x39,
+	0x6B,0x88,0x91,0x34,0x7B,0x30,0x9A,0x07,0x47,0x16,0xEB,
+	0x04,0x43,0x2B,0xA1,0x92,0xEF,0x95,0x07,0xF6,0xF1,0x60,
+	0xD3,0x5B,0xE4,0xF7,0x81,0xCF,0x30,0x12,0x1E,0x98,0x1A,
+	0xF0,0xFD,0x9D,0x78,0x17,0x68,0xC2,0xD8,0xD8,0xED,0xB8,
+	0x16,0x10,0x23,0x83,0x34,0xC4,0xAB,0x99,0xA9,0x5F,0x85,
+	0xE1,0x7C,0x2B,0x10,0xA4,0xC4,0x55,0x7E,0xDA,0x9C,0x84,
+	0xCA,0xDB,0x96,0xE8,0xB3,0xD5,0x6F,0x97,0x86,0x67,0x74,
+	0xC6,0xB5,0xEF,0xF5,0x92,0x70,0x50,0x72,0x7F,0x18,0x74,
+	0x9F,0x0C,0x0A,0x5F,0x4A,0x6E,0x2A,0x09,0xA7,0x5F,0x4E,
+	0xA2,0xE6,0x7A,0x93,0xF0,0x61,0xA6,0xFB,0xA0,0x56,0x58,
+	0x2A,0x9C,0x5F,0x95,0x8B,0x35,0x38,0xB7,0x2A,0xA3,0xB7,
+	0x46,0x99,0x50,0x23,0x6F,0x8A,0x24,0x9C,0x97,0xDC,0xE7,
+	0x82,0xC0,0x41,0x38,0xC8,0xD8,0x26,0x21,0x5B,0x18,0x49,
+	0xC3,0x4D,0xF2,0x57,0x66,0x36,0x39,0x70,0xBA,0x52,0xCF,
+	0xCE,0x4E,0x50,0xAA,0xB6,0x1A,0x46,0x6F,0xDD,0x31,0xF9,
+	0x3F,0x66,0x17,0xBD,0x03,0xEE,0xE5,0x0B,0x66,0x6D,0x72,
+	0x30,0x28,0x56,0x26,0x52,0x54,0x30,0x8A,0x2E,0xB9,0x07,
+	0x28,0x26,0x21,0x85,0xC9,0xA2,0xC5,0x37,0x06,0xC5,0xCC,
+	0x44,0x8A,0x34,0x46,0xD1,0xC1,0x28,0xCC,0x48,0x91,0x63,
+	0x61,0x93,0x4F,0x8C,0x22,0x3D,0x91,0xE2,0x73,0x37,0x60,
+	0x85,0xE1,0x06,0x3C,0x85,0x5C,0x68,0x61,0x98,0x1A,0xEA,
+	0x97,0x42,0x02,0xEA,0xCB,0x6E,0x64,0xCE,0x1A,0x67,0xBA,
+	0xC5,0x45,0xB7,0xB8,0xA1,0x5D,0xE4,0x6B,0x2D,0xDA,0xC4,
+	0x6A,0x08,0x78,0x29,0x91,0xEA,0x7E,0x43,0x40,0xAD,0x1B,
+	0x46,0xDA,0x0E,0xEC,0x29,0x47,0x08,0xB3,0x9D,0x25,0xBC,
+	0x9F,0xC8,0xB3,0xA1,0x6F,0x2E,0x71,0x43,0x04,0x02,0x7C,
+	0xD2,0xE3,0xDA,0xF4,0x8E,0x44,0x3E,0xC5,0xC8,0x07,0xB1,
+	0x47,0xB9,0xA1,0x63,0x47,0xAF,0x0F,0xF4,0x58,0xEA,0x2C,
+	0xE1,0xA7,0xC8,0xA1,0x53,0x63,0xD5,0xBF,0x7C,0x30,0x40,
+	0x9E,0x6F,0x09,0x87,0x88,0x7C,0x23,0x24,0x4D,0x44,0x5E,
+	0x06,0xCC,0x32,0x18,0x33,0xA5,0x42,0xBE,0xCB,0xC2,0xDA,
+	0xC5,0xAA,0x33,0x4E,0x4D,0x64,0x7C,0xEC,0x46,0xAC,0x16,
+	0x55,0xEB,0x4E,0xCB,0x1E,0xA8,0xD6,0x07,0x37,0x62,0xB5,
+	0x7E,0x63,0xD1,0xDA,0xC6,0xA0,0xFA,0x64,0x56,0x02,0xD5,
+	0x33,0x37,0xEA,0x5D,0xAC,0x60,0x09,0x5E,0x95,0xF4,0xB8,
+	0x5E,0x66,0x97,0xAF,0x00,0x3D,0x93,0x96,0x88,0x7D,0xBA,
+	0x48,0xA3,0xB9,0x4D,0xD8,0x04,0x73,0x40,0xB9,0x39,0xE0,
+	0xDB,0x44,0xBC,0xD3,0xD8,0x2C,0x94,0x24,0x37,0x82,0xA4,
+	0x4C,0xA2,0xD8,0xE4,0xA7,0xE1,0xA6,0x20,0xCE,0x02,0xB7,
+	0x25,0x8A,0x9C,0x00,0x22,0xE9,0xFB,0xFD,0x95,0x09,0x4C,
+	0xEE,0xF6,0x6A,0x51,0xDE,0x05,0x24,0x85,0xF1,0xFE,0x3F,
+	0x91,0x24,0xBA,0x18,0x48,0xD6,0xF7,0x97,0xB0,0xB3,0x9F,
+	0x0C,0x6F,0x35,0x69,0x3D,0x3C,0x70,0x26,0x7F,0x08,0x21,
+	0xA5,0xC2,0xC7,0xB5,0x69,0xAB,0xA0,0x9F,0x1F,0xAE,0x83,
+	0x58,0x77,0x7B,0x3E,0x51,0x92,0x60,0x62,0x28,0x12,0x0E,
+	0x07,0x85,0xED,0x92,0xB0,0xFD,0xE5,0xA4,0x23,0x27,0x82,
+	0xC2,0x73,0x6A,0xDD,0x41,0xB5,0xEE,0x43,0xB5,0xEE,0x63,
+	0xB5,0xEE,0x30,0x7D,0x23,0x1D,0xF8,0xAB,0x75,0xDB,0xF5,
+	0xC7,0x7D,0x53,0xB5,0x91,0x69,0x09,0x4F,0x87,0x89,0x64,
+	0x1B,0xF1,0x0C,0x52,0xEB,0x9E,0x61,0xA3,0x1C,0x4A,0x01,
+	0x4D,0x73,0xA6,0x5B,0xC7,0x05,0xF6,0x39,0x94,0x65,0x0C,
+	0x2E,0x09,0x87,0x37,0x2E,0x74,0xC5,0x8A,0x1E,0x58,0x01,
+	0x45,0xE0,0xE3,0xCA,0x59,0x8D,0xDA,0xA1,0x1B,0xEC,0x87,
+	0x1A,0x65,0xC5,0xD5,0x68,0x45,0x65,0x42,0x8D,0x46,0x2F,
+	0xC6,0xD6,0x42,0xF1,0xF2,0x19,0x68,0xAD,0x21,0x8B,0x41,
+	0x05,0x66,0xCF,0x54,0xB5,0xEE,0x39,0x26,0x83,0x7A,0x73,
+	0x95,0x64,0xED,0x01,0x66,0xE0,0x8A,0x5C,0x9C,0x9B,0xFE,
+	0x1C,0xF0,0xFD,0x99,0x78,0xCB,0x98,0x98,0x7B,0x41,0xCC,
+	0xB7,0x20,0x26,0x3B,0x4E,0x4C,0xD7,0xB5,0x09,0x62,0xDE,
+	0x5D,0xA4,0x37,0xEF,0xB5,0x6E,0x91,0xDE,0xD4,0x3F,0xFC,
+	0x8C,0x1D,0x84,0x98,0xBC,0x6E,0xEC,0x10,0x8C,0xB1,0x26,
+	0xAA,0xFB,0x4E,0x66,0x01,0xBD,0x02,0xB9,0xC0,0x39,0x99,
+	0x73,0xC9,0x23,0xE2,0x38,0xFF,0x39,0x91,0xF3,0xDD,0x8B,
+	0xFA,0x54,0xE0,0xA6,0x45,0xC0,0x41,0x12,0x3E,0x96,0xDC,
+	0x87,0x03,0x7B,0xF2,0x73,0x08,0x09,0xBA,0xA1,0x01,0x3E,
+	0xD6,0x20,0xA5,0xC2,0xC1,0x95,0x96,0xF0,0x75,0x51,0xAF,
+	0xBD,0xD4,0xFD,0x21,0xDC,0xCD,0x80,0x48,0x7B,0x53,0xC0,
+	0xF7,0x26,0xF1,0xA4,0xA3,0x3A,0x0D,0x46,0x66,0xA4,0xA4,
+	0xE2,0xE3,0x6A,0xE3,0x11,0x14,0xB2,0x84,0x37,0x5E,0xEE,
+	0xD3,0x74,0x24,0x0D,0xF4,0x60,0x41,0x6D,0x1A,0xEB,0x78,
+	0x5A,0x68,0x7B,0x7C,0x21,0xEB,0xA3,0xD0,0x82,0x33,0x6D,
+	0xE8,0xAB,0x81,0x6E,0x89,0x2D,0x3C,0xD9,0xC6,0x22,0x93,
+	0x9F,0xE9,0x88,0xD8,0x99,0xCB,0x6E,0x14,0xE5,0x2B,0xA0,
+	0x6A,0x39,0x71,0x55,0xDB,0x7B,0x4D,0x42,0xD5,0x1E,0x59,
+	0xA8,0x05,0xB3,0x18,0x9F,0x3C,0xB8,0xF0,0x47,0xE2,0x93,
+	0xDF,0x25,0x52,0xD4,0x00,0x16,0x74,0x1E,0x16,0x95,0x68,
+	0xE1,0x47,0x33,0x74,0x8B,0xCB,0x93,0x59,0x7C,0x30,0x9D,
+	0x19,0x75,0xCF,0x62,0x23,0xEC,0xE8,0xE5,0x73,0x5D,0x22,
+	0x1F,0xE7,0x42,0xBD,0xB9,0x1E,0x5B,0x2C,0xB6,0x09,0xE7,
+	0x08,0xEB,0xCB,0xF1,0xA1,0x04,0x1B,0x89,0xE0,0xCE,0xDB,
+	0x25,0xF7,0x51,0x74,0xE7,0xF9,0xE8,0xCE,0x07,0x49,0x35,
+	0x1D,0xC5,0xEF,0x6B,0xC1,0x05,0x9D,0xF1,0xEB,0x52,0xF7,
+	0x59,0x30,0xB4,0x70,0x06,0xAC,0xB1,0x83,0x30,0x6E,0x02,
+	0xC8,0x9E,0x05,0xB5,0x76,0xC6,0xC9,0x3E,0x30,0x33,0x41,
+	0xF6,0x93,0x0B,0x74,0xD9,0xFD,0x17,0x83,0x31,0x77,0x81,
+	0x13,0xC0,0x84,0xF7,0x1E,0x1B,0x83,0x71,0xC0,0xA1,0x01,
+	0x38,0xE4,0xC6,0x71,0x90,0x12,0x39,0x2C,0x59,0xA0,0xD9,
+	0xED,0x6F,0x9C,0x8B,0xDE,0x80,0xDC,0xFE,0x0E,0x14,0xFD,
+	0xE3,0x28,0xC4,0x44,0x8A,0x42,0x43,0xE6,0x33,0x8B,0x44,
+	0xBA,0x63,0x40,0x78,0x4F,0x54,0x6F,0xC6,0x3B,0x4D,0xAC,
+	0xB9,0xD6,0x2F,0x12,0x13,0xE7,0xA3,0x9C,0x44,0x1E,0x27,
+	0x5D,0xBD,0xF3,0xD1,0x51,0xD7,0x8F,0xCC,0x47,0xA7,0x2A,
+	0x12,0x28,0x76,0xB8,0x7A,0xE7,0xA3,0x67,0x5C,0x3F,0x32,
+	0x1F,0xBD,0x9C,0x48,0xE1,0x73,0xF5,0xCE,0x47,0xB5,0xAE,
+	0x1F,0x99,0x8F,0x1A,0x12,0x29,0x6E,0x70,0xE9,0xD3,0xC5,
+	0xFE,0x85,0x09,0xF3,0xD1,0xE2,0x44,0xD4,0x61,0xAE,0x3E,
+	0xF3,0x51,0x96,0xEB,0xC7,0xE6,0xA3,0xBC,0x44,0x2A,0x65,
+	0xBE,0x2E,0xE0,0x67,0x0B,0xC5,0x1F,0x8D,0x06,0x2E,0xAD,
+	0x4C,0x88,0x06,0x6A,0xFB,0xA1,0x97,0x3C,0x57,0xD7,0x67,
+	0xF6,0xD7,0x7C,0xF9,0xB3,0x9A,0x2F,0x1F,0xCD,0xBA,0x57,
+	0x26,0x6B,0x91,0x2C,0xD0,0xFB,0x10,0xB4,0xDF,0x15,0x44,
+	0x19,0xCE,0xDA,0xC2,0x04,0x00,0x05,0x00,0x03,0x88,0xD2,
+	0x4F,0xC9,0x54,0xC6,0x32,0xAC,0xB3,0x0B,0x7E,0xE8,0xBD,
+	0x57,0xCE,0x48,0x9C,0xFF,0x41,0x55,0xFA,0x51,0x96,0xEE,
+	0xBD,0x79,0xF3,0xFF,0x17,0xEF,0x6D,0xF8,0xEA,0xFE,0x93,
+	0x0C,0x5F,0xFD,0x8A,0x29,0xE6,0x29,0xAF,0xC8,0x62,0x03,
+	0xCD,0x12,0xFE,0xAA,0x1B,0xEB,0x01,0xA3,0xFF,0x5D,0x08,
+	0xE2,0x0E,0x27,0x0B,0x1F,0x7B,0xD3,0x03,0xAB,0xFB,0x9B,
+	0xBC,0x49,0x1A,0xDE,0x1D,0x65,0x62,0x1F,0x67,0xF2,0x6A,
+	0x12,0x68,0x9A,0xE8,0xD0,0x71,0xE4,0x66,0x2D,0x65,0x0E,
+	0x1D,0x38,0xDE,0x60,0xD2,0x19,0xDD,0xAA,0x87,0x7D,0xC5,
+	0x87,0x5D,0x0B,0xB1,0xAA,0x1A,0x62,0x58,0xD4,0x3C,0x7F,
+	0x25,0x33,0xD1,0x71,0x17,0xF4,0x0C,0xAB,0x4B,0xBE,0x2A,
+	0xCE,0x1A,0xB7,0x97,0x27,0x58,0x63,0x62,0x15,0x44,0xB4,
+	0xC2,0x09,0xC9,0x7D,0xBC,0x54,0xA0,0xE8,0x11,0x4F,0x83,
+	0x98,0x74,0x53,0x38,0xC9,0xC2,0x2C,0xFA,0x24,0xF0,0x28,
+	0x05,0x1E,0x83,0x48,0x78,0x33,0x61,0x2E,0x3A,0x41,0xB7,
+	0x1C,0x31,0x7E,0xB2,0xB9,0xDB,0xF5,0xC3,0xC9,0xE6,0xC2,
+	0xF4,0x04,0x91,0xBB,0xE7,0xF5,0xF1,0xD5,0x3B,0xE6,0x31,
+	0x5F,0xCD,0xAA,0xD5,0x9F,0xD9,0x27,0x4B,0xB3,0xCF,0x55,
+	0xA5,0xA2,0x36,0xDB,0xE4,0x97,0x8A,0xC6,0xCC,0xA3,0x95,
+	0x7C,0x7A,0x4B,0xFC,0x04,0xD1,0x31,0xFF,0x87,0x13,0xC4,
+	0xEA,0x44,0xA1,0x73,0xFB,0x0A,0x2D,0x9D,0xF7,0xBF,0x9C,
+	0x20,0x4E,0x5F,0x36,0x26,0x88,0xCF,0xFB,0x3A,0xFD,0x64,
+	0x3B,0xCE,0xD7,0xFF,0xAF,0xA7,0x8C,0x89,0x97,0x75,0x8F,
+	0x8F,0xBA,0xCE,0x9D,0xAF,0x4D,0x0D,0xCE,0x98,0xCD,0x01,
+	0xE3,0x12,0x01,0xB3,0xC3,0xF5,0x2C,0x61,0x9E,0xCE,0xBA,
+	0xE9,0x79,0x48,0x18,0xE0,0x27,0xDA,0x02,0xC9,0xF7,0x34,
+	0xFE,0x39,0xEC,0x42,0xCF,0x92,0xA8,0xD0,0x1D,0x7E,0x9A,
+	0xD0,0xE3,0xD9,0x71,0x8B,0x28,0x9E,0x1B,0x34,0x87,0x75,
+	0xB1,0x4A,0x8B,0x8A,0x34,0x21,0x5F,0x55,0x89,0xB2,0x08,
+	0x8D,0x36,0x38,0xCE,0x20,0x3F,0x2F,0x4B,0x30,0xC8,0xD4,
+	0x1B,0x44,0x8D,0xA6,0x5F,0x6F,0x26,0x2D,0xDF,0x0F,0x54,
+	0x43,0x30,0x6C,0x5A,0x0F,0x37,0x79,0x71,0xE4,0x63,0x12,
+	0xC9,0xBB,0xAF,0x87,0x51,0x44,0x6F,0x72,0xD1,0x69,0x37,
+	0x8A,0xB8,0x44,0x80,0x72,0x7F,0x51,0x25,0x86,0x74,0x85,
+	0x93,0xA6,0xF1,0xCF,0xA3,0xDA,0xF3,0x55,0x26,0x63,0x98,
+	0x0E,0xF7,0xF6,0x67,0x88,0x95,0x55,0xA2,0x92,0xC6,0xEE,
+	0xA6,0x55,0x89,0x50,0x51,0x60,0xC0,0x1A,0xBE,0x1F,0x83,
+	0x15,0x56,0x89,0xF4,0x8B,0xA9,0xEC,0x76,0x90,0xCE,0x91,
+	0xF1,0xDA,0xDD,0xA5,0x2D,0x47,0xE0,0xA3,0xD7,0x02,0xE6,
+	0xA0,0x83,0xD2,0x95,0x9F,0xB2,0xDC,0xEB,0x56,0x1A,0x4D,
+	0x53,0xEB,0xF6,0xA9,0x75,0xBB,0xD4,0xBA,0xBF,0xEB,0xDE,
+	0xCB,0xC8,0x8D,0xB4,0xF5,0xAF,0x29,0x90,0xF3,0x5C,0x37,
+	0x31,0xB0,0x2F,0x03,0xC6,0xD1,0x24,0x79,0x23,0x54,0x6F,
+	0x78,0x5C,0xF5,0xAA,0x4A,0x13,0xAA,0x37,0xE8,0x7A,0x7D,
+	0x2A,0xD8,0x38,0x4F,0xC4,0xD5,0xB8,0xEF,0x08,0xC8,0xC6,
+	0xF6,0xE8,0x31,0xA4,0xF7,0xB0,0x76,0x5C,0x85,0x2D,0xE6,
+	0xBD,0x37,0xE6,0xD5,0xBC,0x77,0x80,0x4F,0xF3,0xDE,0xA2,
+	0x54,0xD1,0x12,0xAD,0x32,0x22,0xD0,0xBF,0x06,0xD2,0x86,
+	0xC6,0x49,0x3B,0x31,0x2D,0x41,0xDA,0x8B,0x73,0xC1,0x98,
+	0x7F,0x5C,0xE6,0xA2,0xFF,0x59,0x04,0xC6,0xEC,0x61,0x84,
+	0xF9,0xF3,0xC4,0xDE,0x86,0x09,0xA1,0x5C,0x30,0xEB,0x3C,
+	0x26,0x7D,0xAB,0x32,0x4B,0xEB,0x44,0xAC,0xBB,0x4C,0xED,
+	0x15,0x3E,0x16,0x85,0x5F,0xC5,0x0C,0xDA,0xC3,0xCA,0x92,
+	0x18,0xAB,0x7F,0xDE,0xA0,0xF4,0x33,0x82,0x14,0x16,0x48,
+	0x63,0xD7,0x99,0x3A,0x57,0x0C,0x69,0xB5,0x01,0xD3,0xBE,
+	0x7D,0x8E,0x35,0x93,0x51,0xCE,0xF2,0xFF,0x1B,0xC4,0xE2,
+	0x96,0x15,0x35,0xD2,0x57,0xCB,0xF7,0x1E,0x4F,0x3D,0x94,
+	0xFA,0x41,0xEA,0xBB,0xA9,0x13,0xC8,0x4C,0x52,0x49,0x04,
+	0x72,0x1D,0x99,0x47,0xE6,0x93,0x85,0x64,0x31,0x71,0x93,
+	0x25,0xE4,0x16,0x72,0x1B,0xB9,0x83,0xFC,0x8C,0xFC,0x82,
+	0xFC,0x92,0xD4,0x12,0x0F,0xA9,0x23,0xF7,0x91,0x03,0xDC,
+	0xED,0xDC,0x26,0xEE,0x25,0xEE,0xB7,0xDC,0x2A,0xAE,0x89,
+	0x7B,0x9D,0x6B,0xE1,0xEE,0xE1,0x9E,0xF8,0x51,0xD8,0x8D,
+	0xD2,0x59,0xF9,0x33,0xB0,0xCF,0x87,0x56,0x17,0xDD,0x86,
+	0xAB,0x97,0x5F,0xC1,0xC3,0x44,0xC2,0x22,0x1C,0x66,0xAC,
+	0x57,0xA7,0x26,0x18,0xCB,0x8F,0x58,0xE8,0xDF,0x56,0x5D,
+	0x27,0xCA,0x23,0x79,0x17,0xFD,0x25,0x5C,0x27,0xF2,0x2E,
+	0xB9,0x38,0x8E,0x6A,0x75,0x22,0xD5,0x5C,0xA4,0x9A,0x0C,
+	0xD8,0x33,0x7F,0x04,0x7B,0x7E,0x22,0xF6,0x60,0xC4,0x5E,
+	0x0E,0xD8,0xFD,0x00,0xFB,0xE7,0x70,0x4D,0x86,0xEB,0x2A,
+	0xA0,0x9A,0x14,0x47,0x35,0x20,0x91,0xEA,0x34,0x2E,0x2B,
+	0xFA,0x00,0xFB,0x5F,0x73,0x44,0xF9,0x01,0xC0,0x9E,0x1C,
+	0x87,0xAD,0x5C,0x9D,0x80,0x2D,0x03,0x76,0x48,0xE0,0x36,
+	0xB8,0xFE,0xB7,0x7E,0xE4,0x26,0xE0,0xBF,0x1A,0x52,0x73,
+	0xA7,0xBC,0x0F,0x24,0x94,0xC4,0x49,0x08,0x26,0x4A,0x70,
+	0xCF,0xD1,0x3B,0xF1,0xC7,0x73,0x45,0xF9,0x22,0x60,0x4F,
+	0x89,0xC3,0x5E,0x96,0x88,0x3D,0xD2,0xC0,0xDE,0x36,0x57,
+	0xBB,0xFE,0x79,0xAE,0xA6,0x9F,0x9C,0x6F,0x73,0x51,0x07,
+	0x96,0x5E,0x69,0x73,0xC9,0x57,0xC7,0xF1,0xC8,0x4D,0xE4,
+	0xF1,0xE5,0x6C,0x9D,0xC7,0xAD,0x06,0xAD,0x0B,0x68,0x3F,
+	0x44,0x68,0x35,0xD0,0x4E,0x8D,0xA3,0xFD,0x6C,0x4A,0x02,
+	0xED,0x73,0x06,0x6D,0xA1,0x41,0xFB,0x2B,0xA0,0x7D,0x14,
+	0xA1,0xAB,0x80,0x76,0x5A,0x1C,0xED,0xD3,0x89,0xB4,0x3F,
+	0x37,0x68,0xCF,0x5C,0xA7,0xD3,0x3E,0x0E,0xB4,0x6E,0x84,
+	0xFE,0x09,0x68,0x4B,0xE3,0x68,0x7F,0x92,0x48,0x3B,0xDE,
+	0xA0,0x7D,0xC9,0xA0,0x7D,0x1B,0x68,0x07,0x22,0xF4,0x5D,
+	0xA0,0x2D,0x8B,0xA3,0xBD,0x32,0x91,0xF6,0x92,0xA0,0xD3,
+	0xD6,0x1A,0xB4,0xA9,0x76,0x98,0x78,0x11,0x9A,0x6D,0x77,
+	0xC9,0xD3,0xE3,0xDB,0xBF,0x24,0xB1,0xFD,0x0D,0xDA,0x12,
+	0x83,0x76,0x2C,0xD0,0x6E,0x41,0xE8,0x64,0xA0,0x2D,0x8F,
+	0xA3,0xFD,0x5B,0x22,0x6D,0xBD,0x41,0xDB,0x3D,0x47,0xA7,
+	0x5D,0x04,0xB4,0x77,0x20,0x74,0x29,0xD0,0xCE,0x88,0xA3,
+	0x5D,0x99,0x48,0x5B,0x61,0xD0,0xBE,0x6D,0xD0,0xD6,0x03,
+	0xED,0x28,0x84,0x06,0x80,0xB6,0x22,0x8E,0x76,0x4A,0x22,
+	0x2D,0x67,0xD0,0x3E,0x60,0xD0,0xBE,0x06,0xB4,0xE7,0x66,
+	0x01,0xF4,0x4D,0xA0,0x1D,0x19,0x47,0xDB,0x33,0x39,0x81,
+	0xF6,0xBD,0x59,0x3A,0xAD,0x60,0xD0,0x76,0x00,0xED,0x2B,
+	0x08,0xBD,0x0C,0xB4,0xD7,0xC6,0xD1,0xEE,0x4E,0xA4,0x5D,
+	0x67,0xD0,0x42,0x37,0x64,0x63,0xFF,0xFE,0x59,0x10,0xC7,
+	0x26,0xB9,0xE4,0x99,0xF1,0xFD,0x3F,0x91,0xCA,0x6D,0x50,
+	0x7D,0x3C,0x5B,0x94,0x6F,0x01,0xEC,0x6B,0xE2,0xFB,0x7F,
+	0x22,0xF6,0x48,0x03,0x7B,0xDB,0x6C,0x71,0xF9,0x5E,0xF0,
+	0x4B,0xF4,0x4D,0x3B,0x6D,0x1C,0xA5,0x96,0xAC,0x73,0xD2,
+	0xE7,0xAE,0x15,0xE9,0xAA,0x09,0x8C,0xEE,0xBE,0x29,0x7A,
+	0xE9,0xE7,0x6A,0x71,0x0B,0xBB,0x53,0xEB,0x1C,0x6A,0x1D,
+	0x24,0xF0,0xBC,0x5A,0xC7,0xC9,0xCF,0x26,0x41,0xFB,0x43,
+	0x7A,0xED,0x60,0x45,0xB8,0x89,0xC9,0xB9,0xE9,0xD7,0xCB,
+	0x45,0x5C,0x14,0x34,0x2B,0x43,0x43,0x50,0x6F,0x6A,0xAB,
+	0x12,0xA5,0xAE,0x80,0x3A,0xB3,0x3E,0x23,0xA0,0x2E,0x6D,
+	0x48,0xF6,0xD7,0x9B,0xA6,0xC5,0xB6,0xE3,0x56,0xD4,0xE8,
+	0x3C,0x39,0xFA,0xB6,0xAA,0x49,0x72,0x33,0x1E,0x3B,0x54,
+	0x0C,0x2A,0x33,0xFD,0x65,0xE3,0x3C,0x29,0xB4,0x23,0x7B,
+	0x1A,0xE7,0x31,0x48,0x6A,0x7A,0x45,0x49,0x3E,0xDE,0x4D,
+	0xD7,0x20,0xA6,0x27,0xB9,0x9A,0xAE,0x66,0x37,0x66,0x65,
+	0x85,0x9B,0xD6,0xB2,0xDB,0x24,0x77,0x35,0x3D,0xA2,0x8A,
+	0xA2,0x32,0xBF,0x9A,0xDE,0xCC,0x20,0x95,0xFE,0x32,0xE2,
+	0x19,0xC1,0x34,0xD0,0x74,0xBB,0x7B,0x9E,0xE8,0x0A,0x59,
+	0xE1,0xE6,0xD6,0x79,0xE2,0xD2,0xD2,0x83,0x9A,0x5E,0x83,
+	0x95,0xFE,0x4A,0x7F,0x1A,0x72,0x59,0xC1,0xDC,0xAC,0x70,
+	0x96,0x56,0x68,0x56,0xFE,0x0D,0x31,0x4F,0xAF,0xD6,0x9A,
+	0xA6,0x3C,0xD3,0xD4,0x91,0xDC,0xE1,0x71,0x30,0xC6,0x5C,
+	0x88,0x53,0x92,0x21,0x05,0x41,0x6A,0xFA,0xC5,0x0D,0x22,
+	0xE0,0xF2,0xEE,0xEA,0x88,0x7C,0xE7,0xE4,0x03,0xC3,0xDE,
+	0x6E,0x49,0xDA,0xC9,0x91,0xDD,0x0E,0x72,0xF1,0x2F,0x1E,
+	0x6E,0x42,0x8B,0x92,0xDE,0x3C,0xF3,0xC0,0x9D,0xFE,0x08,
+	0x61,0x0F,0xE6,0x60,0xFB,0x8A,0x1A,0xDB,0xDE,0x66,0x81,
+	0x81,0xBC,0x7C,0xD9,0xC4,0x5A,0xB3,0x62,0x91,0x55,0x75,
+	0x6F,0x73,0x85,0x86,0x65,0x85,0x07,0xC5,0x3C,0xA1,0x65,
+	0x6F,0xF3,0x35,0xF1,0x80,0x60,0xFB,0xDE,0xE0,0xA9,0xE6,
+	0x6B,0x4B,0xA4,0x15,0xE6,0x3E,0xE0,0x83,0x08,0x9E,0x55,
+	0x22,0x55,0x9B,0x13,0xC8,0x6F,0x0C,0x7E,0x25,0x09,0x9C,
+	0x54,0x63,0x97,0xDC,0x7C,0x73,0xA5,0x56,0x88,0x82,0x58,
+	0xAD,0x6E,0xB8,0x01,0x6C,0xEB,0x1C,0x99,0xBB,0xB9,0x30,
+	0xF7,0xE5,0x34,0x5A,0x74,0x67,0x50,0x88,0x4A,0x02,0xFF,
+	0x72,0xDA,0x11,0x2A,0x75,0x15,0x77,0x28,0xA5,0x92,0x10,
+	0xB5,0xB4,0x42,0xA7,0x7A,0xCC,0x89,0xCB,0xB0,0xAF,0xAA,
+	0x10,0x59,0xE2,0x76,0x1A,0x07,0xA6,0x29,0xC4,0x28,0x44,
+	0x6A,0x05,0x5C,0x88,0xF6,0x38,0xCB,0xC1,0x85,0x79,0x6C,
+	0xC7,0xF9,0x29,0x27,0xDD,0x54,0x0D,0x7D,0x44,0x28,0xED,
+	0xAC,0x7D,0x07,0x0C,0xAC,0x4D,0xB3,0x3F,0x10,0xD5,0x72,
+	0xC7,0xFF,0x2C,0x6A,0xCE,0x0F,0x44,0xE9,0xDC,0xFB,0x48,
+	0xA4,0x93,0x7F,0x54,0x14,0x32,0xA1,0xDF,0x44,0x45,0xBD,
+	0xBB,0xF1,0x6A,0xC9,0xC8,0x5C,0xB5,0xA4,0x30,0x17,0xE1,
+	0xD8,0xFB,0x72,0x1C,0x40,0x55,0x2A,0xF0,0xB1,0x9E,0x19,
+	0x43,0xAC,0xE3,0xE2,0x71,0xE9,0x8B,0x49,0x3F,0x8A,0x88,
+	0x45,0xAE,0x24,0xB1,0x0F,0x15,0x80,0x0E,0x2E,0x01,0x9D,
+	0xFF,0x2B,0x5B,0x40,0xB8,0xE6,0xFA,0x1F,0x45,0xC0,0xA2,
+	0x97,0x4A,0x44,0xDC,0x21,0x91,0x37,0x39,0x5D,0x34,0xBD,
+	0x5A,0x14,0xB7,0x3E,0xE6,0xEC,0x2D,0xFC,0x1D,0x14,0x9A,
+	0xF5,0xC2,0x0B,0xEE,0x84,0x42,0x0F,0x14,0x62,0xC1,0x67,
+	0x4B,0xC5,0x5E,0xE0,0x8A,0x92,0x78,0xED,0xF2,0xD4,0x92,
+	0x7C,0xA8,0xD0,0xF0,0x5C,0x6A,0x75,0x43,0x85,0xD0,0xEC,
+	0x1C,0x98,0xDD,0x39,0x3C,0xD7,0x72,0x30,0x08,0xBF,0xA0,
+	0x4D,0xAF,0xA9,0x34,0x4C,0xA4,0xA2,0x9F,0xDC,0xF8,0x3F,
+	0x62,0x97,0x3C,0x09,0x1E,0x66,0x03,0x04,0x24,0xB7,0x88,
+	0x9A,0xB4,0xCD,0xA3,0x72,0xB7,0x0E,0xCF,0xDD,0x5C,0x90,
+	0xBB,0x35,0x3F,0x97,0x01,0xD8,0x4F,0x1B,0x5F,0x98,0x0B,
+	0xB1,0x1E,0x3F,0x12,0x7E,0x19,0x20,0x70,0x76,0x20,0x8E,
+	0x68,0x47,0xB1,0xDA,0x26,0x5C,0x30,0x11,0x7A,0xBF,0x33,
+	0x28,0x00,0xD6,0x3F,0x92,0x4C,0x24,0x1E,0xB7,0x8D,0x7F,
+	0xC4,0x59,0x78,0x45,0x1B,0xFF,0xA8,0xB3,0x08,0x7E,0x1F,
+	0x87,0x5F,0xAA,0x5E,0x1D,0x14,0x20,0x9D,0x3E,0xAF,0xE5,
+	0xD5,0x60,0xC9,0xDA,0x3A,0xCC,0x68,0xB9,0xBA,0x5F,0x6A,
+	0x15,0xA5,0xED,0xA0,0xCA,0xD6,0x0D,0xCE,0xA0,0xF3,0x49,
+	0xE7,0xE6,0x0D,0x4E,0x50,0x63,0xF3,0x93,0x4E,0x54,0x29,
+	0x3F,0xB7,0x6F,0x1D,0xA4,0x3D,0x5B,0x47,0x21,0x74,0x44,
+	0x3A,0x01,0xA4,0xAD,0x05,0xB9,0x6D,0xFC,0x7B,0x4C,0xFC,
+	0x23,0x4E,0x0B,0x08,0xFB,0xB3,0xF3,0x2F,0x05,0x6D,0x7C,
+	0x93,0xF3,0x9F,0x05,0x28,0x3E,0x87,0x89,0xCF,0xB9,0x02,
+	0x2C,0x01,0xFD,0x2E,0x98,0x1D,0xAC,0x34,0x07,0xCA,0xDF,
+	0x4B,0x22,0xDE,0x95,0x52,0xCD,0xD9,0xC0,0x0C,0xE2,0xB9,
+	0x9B,0x26,0x45,0xB6,0x3E,0xE5,0x04,0x9F,0x73,0x0B,0x0C,
+	0x32,0x18,0x6D,0xD0,0xC1,0xBF,0xF8,0x89,0xD5,0x44,0x02,
+	0x87,0x89,0x6B,0x21,0x9D,0x1E,0xD9,0xB8,0xAC,0xF4,0xD8,
+	0xD2,0x55,0x95,0xB5,0x5C,0xE9,0xC1,0x95,0xE5,0x31,0x94,
+	0x37,0x7F,0x52,0xE1,0xA2,0x13,0x22,0xD8,0x9C,0x81,0xF2,
+	0xC7,0x9C,0xA4,0xBE,0x3F,0xCA,0xFF,0xD3,0x30,0x94,0x3C,
+	0x71,0x18,0x6A,0xD1,0x96,0x8F,0x7A,0x71,0x24,0x4E,0x32,
+	0x8A,0x6C,0x00,0x87,0x7B,0xA3,0xA6,0x42,0x15,0x1D,0x82,
+	0xD9,0xE2,0x6C,0xBA,0x9C,0x2F,0x75,0xF3,0xB5,0x33,0xC0,
+	0x1C,0x02,0x57,0x77,0xB5,0x6E,0x8E,0x5F,0xF0,0x62,0x8C,
+	0xBB,0xA7,0x3F,0xF2,0xB2,0xB0,0x3A,0x46,0x98,0x8C,0x23,
+	0x4C,0xC6,0xF6,0x61,0x89,0xF5,0x82,0xA0,0x79,0xBD,0x29,
+	0xE0,0xB3,0xE3,0xF2,0xD0,0x83,0x26,0xF9,0x43,0x70,0xFB,
+	0xA3,0x5D,0xE0,0xD6,0x93,0x71,0x1F,0xFD,0x08,0x3C,0xE5,
+	0x69,0x4F,0x1E,0xBB,0x7F,0x3A,0x20,0x57,0x2B,0x9C,0xDC,
+	0x9E,0xA4,0xF5,0x4E,0x2F,0x74,0xDD,0x4D,0x9B,0x9C,0xE0,
+	0x46,0xA3,0xB3,0xC1,0xD9,0x0A,0x29,0x70,0x77,0x69,0x36,
+	0x3A,0x54,0x4F,0x7F,0x0D,0x7E,0x9A,0xC1,0xD3,0xE0,0xEE,
+	0x73,0x06,0xF7,0xA6,0xC6,0x88,0xAF,0x06,0x62,0x4A,0xAE,
+	0x0F,0x0A,0x1D,0x1A,0xEA,0x1B,0xB3,0x45,0xEB,0x6E,0x35,
+	0x28,0x5C,0x0A,0xF8,0x2E,0x91,0x7A,0x48,0x3F,0x2F,0x0D,
+	0x6C,0xB0,0xF9,0xCB,0x37,0x3B,0xA7,0x79,0xB2,0x62,0x44,
+	0x16,0x20,0x6A,0x13,0x2E,0x99,0x89,0x5A,0x77,0x89,0xBE,
+	0x3F,0x57,0xA4,0xBB,0xE7,0x96,0x0A,0x97,0xA0,0x0A,0x32,
+	0x40,0x3A,0xE8,0xEB,0x73,0xC5,0xF5,0x42,0x17,0x48,0xBC,
+	0x14,0x05,0xAF,0x72,0x7E,0x3E,0xEE,0x71,0x75,0x15,0xBF,
+	0x2F,0x09,0x91,0xE2,0xC3,0x74,0xF5,0xED,0x90,0xF2,0x47,
+	0x17,0x16,0x1F,0x16,0x97,0xD1,0x7B,0x6F,0x0F,0x0A,0x34,
+	0xE8,0x3E,0x23,0x09,0x67,0x24,0x37,0xC5,0xAE,0x75,0x1F,
+	0x6E,0xE9,0x70,0xB5,0xF7,0xB2,0x05,0x2B,0x14,0x35,0xE4,
+	0x2A,0x98,0x45,0xCD,0xB8,0x6C,0x79,0x95,0x18,0x14,0x4E,
+	0x07,0x7C,0xA7,0x89,0x67,0x11,0xEE,0x02,0x60,0x21,0xEE,
+	0x5A,0xE0,0xEA,0x19,0xDE,0xB7,0xCF,0x8D,0x99,0x5D,0xF5,
+	0x4C,0x40,0xB3,0x9B,0x99,0xD9,0x7F,0x5B,0x80,0x06,0x4F,
+	0x62,0x5D,0x6B,0x14,0xEB,0x5A,0xD7,0x17,0x60,0xD7,0xFA,
+	0x69,0x41,0x5C,0x13,0x28,0x59,0x50,0x51,0x33,0x9E,0x99,
+	0xB9,0x60,0xF2,0xF2,0xAA,0x70,0x21,0x9C,0xA5,0x1A,0xCD,
+	0xF2,0x47,0xC8,0xA2,0xCF,0x13,0x48,0xDB,0x1F,0x25,0xAB,
+	0x1C,0x8D,0xBE,0x73,0xA4,0x62,0x95,0x25,0xBC,0x06,0xBA,
+	0xC7,0xB9,0x11,0xEA,0x0C,0x5C,0x96,0xAC,0x39,0x57,0xD4,
+	0x1E,0x38,0x46,0x82,0x35,0x5C,0xD0,0xCD,0xEB,0x9D,0x60,
+	0x5F,0xCD,0xFF,0x3F,0x63,0x62,0xF3,0x7B,0x49,0xBD,0x1E,
+	0x58,0x73,0x7A,0xCE,0x3F,0x3B,0xD9,0xBE,0x70,0x26,0xA0,
+	0x99,0x60,0x68,0x07,0xC0,0xFF,0x93,0x1F,0x71,0x8E,0xCE,
+	0xA6,0xFF,0x15,0x9E,0xF3,0x51,0xDD,0xE5,0x39,0x1F,0xD7,
+	0x6E,0x02,0xE5,0xFF,0x00,0x93,0x64,0xA8,0xCE,0x47,0x9C,
+	0x86,0xA3,0x00,0x1B,0x19,0x0E,0xC6,0x81,0xD3,0x35,0xCE,
+	0xFF,0xFD,0xD8,0x34,0x9D,0xAA,0xCD,0xFF,0xB3,0xB0,0x3F,
+	0x29,0x16,0xFA,0xD4,0x1C,0x98,0x7C,0xD6,0x0B,0x1D,0xD0,
+	0x2D,0xA2,0xD8,0x2D,0x3E,0x9D,0x87,0xDD,0x02,0x57,0x76,
+	0x85,0x6E,0xE8,0x16,0x77,0xFC,0x04,0xBA,0x45,0x44,0xEB,
+	0x16,0x4B,0x7F,0x52,0xEA,0xB6,0xD7,0xA6,0x40,0x57,0x80,
+	0x1E,0x11,0x8B,0x4A,0xF4,0x5A,0xA2,0x90,0x80,0x8F,0x37,
+	0x7B,0x07,0x69,0x71,0x92,0x9B,0x36,0xAA,0xDA,0xA2,0x99,
+	0x55,0x8E,0xAA,0xCA,0x62,0xD9,0xDC,0x08,0x73,0x3A,0xB8,
+	0x75,0xE8,0x50,0x0B,0x7A,0xBB,0x84,0xD7,0xBA,0xF9,0x51,
+	0xA2,0x94,0xA0,0xDA,0x4F,0xFE,0xD7,0x1E,0xD1,0xC6,0xEF,
+	0x67,0xC6,0x47,0xAF,0xE8,0x66,0xBD,0x6A,0xC0,0x62,0xEC,
+	0x61,0x35,0x7A,0xED,0xF7,0x43,0xED,0x79,0xAD,0x53,0xE9,
+	0x75,0xE6,0xD0,0xA9,0xDA,0xB1,0x83,0x6A,0x6B,0x67,0xD8,
+	0xF6,0xFF,0xC4,0x2C,0x06,0x0C,0x6B,0x2D,0x6E,0x09,0xF7,
+	0x10,0x84,0x8C,0x98,0x8A,0x3B,0xEF,0x41,0x77,0x34,0xD0,
+	0xAD,0x7A,0x6D,0x38,0xC3,0x9A,0x95,0x93,0xD0,0x71,0x0D,
+	0x8A,0xAD,0x3A,0x85,0x59,0xF9,0x47,0xB1,0xAA,0x8C,0x03,
+	0x90,0x9B,0x25,0xF7,0x75,0x0E,0xFA,0x4F,0x4C,0x11,0x4A,
+	0x5B,0xA1,0xE8,0x65,0x68,0xB7,0x18,0x38,0x7B,0xAA,0x01,
+	0x7E,0x72,0x36,0x30,0x72,0xAB,0x75,0x51,0xDC,0xC3,0x4F,
+	0xAF,0x71,0x49,0x6D,0x0B,0x99,0xE7,0x6B,0xD8,0xE9,0x05,
+	0xCF,0xB7,0xEA,0x55,0x60,0x16,0x87,0x70,0x79,0xB9,0xCB,
+	0x60,0x71,0x3F,0x72,0x46,0x0D,0xE2,0x8A,0x8F,0x2F,0x47,
+	0x52,0x24,0x84,0x8E,0x3F,0x43,0x05,0x89,0x71,0x85,0xEF,
+	0xF4,0xD2,0xFE,0xE1,0xEA,0x1F,0xD2,0x6E,0x89,0xA7,0xB5,
+	0xA8,0xF1,0xB1,0x81,0x5B,0xC9,0x42,0xE5,0xA9,0x30,0x4D,
+	0x14,0x8D,0xF8,0x22,0x13,0x2B,0x5E,0x39,0x57,0x94,0xCE,
+	0x23,0xE4,0x04,0xA0,0xEB,0x56,0x3E,0x0B,0xC1,0x1C,0xDB,
+	0x99,0xE7,0xE9,0x82,0xB1,0xFA,0xCA,0xE7,0xB3,0x44,0xFE,
+	0x3C,0xC9,0x85,0x14,0xCB,0x27,0x43,0xB7,0x39,0x9F,0xDC,
+	0x01,0xC0,0x47,0x88,0xFC,0x45,0x12,0xC3,0x9B,0x83,0x40,
+	0x74,0x95,0x20,0xA3,0x7D,0x82,0xB2,0x8A,0xDE,0x2F,0x80,
+	0xBD,0x51,0xA9,0x3B,0x57,0x88,0xC6,0x56,0xB8,0x59,0x99,
+	0xA6,0x69,0x5A,0xED,0xA6,0xD7,0x44,0x41,0xFF,0xA0,0xD0,
+	0x0D,0x00,0xEA,0xAD,0x11,0x03,0xBE,0x6E,0xE2,0x2D,0xD4,
+	0x1B,0xC4,0x4D,0xB3,0x99,0x65,0xB4,0xA7,0x6A,0xCA,0xE3,
+	0x13,0xD0,0x94,0xA8,0xB8,0x47,0xD5,0xED,0xA6,0x75,0x13,
+	0xC4,0x6A,0x7A,0xEF,0x04,0x46,0xA5,0x05,0xCD,0x49,0xA8,
+	0xC4,0x47,0x0B,0x63,0x0B,0x1C,0x37,0xBA,0xAB,0xF3,0xFC,
+	0xE5,0xA7,0x93,0x54,0xEF,0xC4,0x56,0xFE,0x74,0x12,0x91,
+	0xC9,0xB5,0x07,0xC6,0x95,0xF9,0x59,0x10,0x9A,0x2F,0x67,
+	0xC0,0x43,0x30,0xEF,0x64,0xD2,0x3A,0xFE,0xCB,0xA4,0xF1,
+	0x5F,0xDE,0xA9,0x0E,0x39,0x09,0x63,0x68,0x3A,0x31,0xD7,
+	0x5A,0x11,0xD9,0x34,0xFE,0xCB,0x4D,0xA7,0x93,0x86,0xB2,
+	0x08,0x58,0x67,0x03,0xA1,0xEA,0x84,0x96,0x09,0x87,0x95,
+	0x74,0x99,0xD8,0x75,0xF4,0x37,0x08,0xD7,0x79,0x4A,0x43,
+	0x0A,0x7E,0x15,0x43,0x43,0xFE,0x23,0x31,0xF0,0x74,0xF3,
+	0x88,0x70,0x31,0x00,0x0A,0x9A,0x2A,0x82,0x7B,0x64,0x92,
+	0xA4,0xD3,0x05,0xBA,0x4C,0x7A,0x28,0x7C,0xF0,0x47,0xA9,
+	0x53,0xC1,0xB1,0xC8,0xC4,0xA1,0x63,0x33,0x14,0xD7,0xD6,
+	0xAF,0x93,0xDA,0xF8,0x30,0x3C,0xBE,0xFD,0x75,0x52,0x73,
+	0xB2,0x5E,0xB4,0x34,0xD0,0x05,0x09,0x08,0x44,0xC0,0x89,
+	0x1C,0xAE,0x6A,0xE3,0x95,0x24,0x3C,0x15,0xC2,0x6D,0xFD,
+	0x36,0x09,0x5C,0xCB,0xD6,0x8B,0xF0,0x6B,0xDF,0xFA,0x1D,
+	0xFC,0x3A,0xB6,0xFE,0x27,0x69,0x5D,0xFB,0xD6,0x6F,0xE0,
+	0x36,0x85,0xFE,0x45,0xFD,0x51,0x05,0x80,0xFC,0x5B,0x9D,
+	0xFC,0x22,0x22,0x7F,0xC7,0x78,0x28,0x8C,0xC7,0x7F,0x18,
+	0x0F,0x8D,0xFC,0xA7,0x3A,0x39,0xEB,0x30,0xEB,0x85,0x6E,
+	0xD7,0x7A,0x21,0x02,0x7F,0x51,0x76,0x74,0xE1,0x73,0x1B,
+	0x34,0xD9,0x08,0x1B,0xD1,0xBB,0x1F,0x78,0x9F,0xA6,0x39,
+	0xF4,0xE4,0x5C,0xE8,0x4A,0x1D,0xB1,0x3E,0x06,0xE1,0x6F,
+	0xB6,0x41,0x83,0xF4,0x6E,0xBA,0x0D,0xA9,0x84,0x40,0xD4,
+	0x52,0xFF,0xB5,0xD1,0x71,0xE9,0x21,0x95,0xBE,0xA5,0xD2,
+	0x0D,0x2A,0x0E,0x67,0x0C,0xEE,0x1D,0xF4,0x8F,0xC0,0xC6,
+	0xF3,0x1F,0x3A,0x7D,0x8E,0xCE,0x69,0x34,0x4B,0x94,0x36,
+	0x3D,0x47,0x36,0x40,0x47,0x0B,0x9F,0xE6,0x03,0xF5,0x69,
+	0x38,0x87,0xFF,0x91,0xC8,0xDD,0x30,0x6B,0x6F,0x9F,0x2A,
+	0xCA,0x3D,0x49,0x6C,0x8B,0xC7,0xA6,0x27,0x8A,0x13,0xAF,
+	0x8C,0x4B,0x14,0xFB,0x3B,0x5C,0x54,0x2D,0x81,0xDE,0xCB,
+	0x61,0x36,0x23,0x0F,0x82,0xC7,0xF3,0xF0,0x28,0x0F,0x73,
+	0x68,0xBB,0x3C,0x06,0xD1,0xE5,0xC2,0x04,0xA2,0xFD,0x48,
+	0x54,0x69,0x66,0x54,0xD7,0xC2,0xF3,0x2E,0xA4,0x9A,0xEB,
+	0xD0,0x76,0x7A,0x0C,0xAA,0xB6,0x44,0xAA,0xC7,0x00,0x8B,
+	0x16,0xAA,0x6D,0x95,0x69,0xDA,0x4E,0x9E,0x3A,0x89,0x96,
+	0x0C,0x64,0x63,0xAC,0x9C,0xA9,0xDB,0x73,0xB5,0x28,0xDF,
+	0xE9,0xD0,0x36,0x7F,0x0C,0x26,0x0F,0x24,0x32,0x99,0x8F,
+	0xA2,0x10,0xFB,0xC0,0xD5,0xEC,0xD4,0x1B,0xED,0x3F,0x46,
+	0x34,0xF6,0xF1,0x3E,0x6F,0x13,0x8E,0x43,0xEB,0x69,0x3B,
+	0x76,0xC7,0x25,0xE1,0x73,0xBA,0x7E,0x79,0x50,0xF8,0x32,
+	0xE8,0x3E,0x2D,0x09,0x5F,0x26,0x0B,0xA7,0x75,0x39,0xBF,
+	0x07,0xCA,0xA7,0x1D,0xDA,0x89,0x33,0x43,0xCE,0xC0,0x44,
+	0x39,0x5F,0x4F,0xD6,0xE5,0xDC,0xAE,0xCB,0xD9,0x31,0x1A,
+	0xE2,0x8A,0x33,0xEC,0xC4,0x9D,0x7F,0x40,0x9C,0xD6,0xB3,
+	0x7E,0x84,0xDB,0x3F,0x46,0x24,0x70,0xDB,0x68,0x70,0xCB,
+	0xD5,0xB9,0xDD,0x3A,0x1A,0xB5,0x2E,0x15,0xCE,0x7A,0xFB,
+	0x49,0x42,0x47,0xA9,0x70,0xCE,0x9B,0x2C,0x09,0x5D,0xB8,
+	0xEC,0x69,0x09,0xFF,0x83,0xC8,0x43,0x81,0xE6,0xEC,0x14,
+	0x51,0xFE,0xC4,0xA1,0x6D,0x55,0x19,0x8C,0x57,0x26,0x32,
+	0xAE,0x40,0xC6,0x99,0xC9,0xAC,0x8D,0xED,0xC6,0xFA,0x6F,
+	0x22,0xD2,0xA0,0xC9,0xB1,0x36,0x9E,0x99,0xEC,0xA2,0x29,
+	0x48,0x23,0x24,0x6B,0x6D,0x6C,0x10,0x0D,0x48,0x24,0x3A,
+	0x3D,0xA9,0xB7,0x8D,0x07,0xC3,0xF3,0xD1,0x49,0x78,0x08,
+	0x34,0x59,0x6B,0x63,0x83,0xEA,0xD4,0xF0,0x04,0xAA,0x1D,
+	0x93,0xF4,0x8A,0x8E,0x9D,0x22,0xD2,0x69,0x97,0xC3,0xCE,
+	0x68,0xA0,0x3E,0x83,0x78,0xB2,0xD9,0x41,0xAA,0x2D,0x03,
+	0x44,0x68,0x73,0x69,0x00,0xCB,0xA8,0x15,0xC2,0xCE,0x47,
+	0x35,0x01,0xCC,0x63,0xA7,0x6B,0x9D,0xE0,0xDE,0xDA,0x83,
+	0xEE,0x63,0xF1,0xC7,0xA2,0x8E,0xA9,0x75,0xED,0xB4,0xA5,
+	0x7A,0x21,0x04,0x86,0xD5,0x41,0xE1,0xE3,0xA0,0xFB,0x28,
+	0x33,0xCC,0x11,0xC8,0x7F,0x6E,0xD3,0xAA,0x1C,0x5B,0xFF,
+	0x48,0xD4,0x63,0xE4,0x24,0xDC,0x21,0x39,0xAA,0xD6,0x7D,
+	0x2C,0xFF,0x1C,0xAA,0x3C,0x00,0xB7,0xB6,0xE4,0x7B,0xF5,
+	0x3A,0x1B,0x54,0x23,0x12,0xA9,0x2E,0x14,0x6B,0xBB,0x97,
+	0xBF,0x01,0x92,0xD3,0x70,0x2F,0xFB,0xF5,0xFA,0x1A,0x14,
+	0x17,0xAF,0x48,0xA0,0x68,0x29,0xD6,0x76,0x2F,0x91,0xA2,
+	0x19,0x29,0x1E,0x4B,0xD6,0x3A,0xB0,0x41,0xF1,0x4E,0x22,
+	0x45,0x53,0xB1,0x6E,0xA1,0x14,0xA8,0xC6,0xB6,0x64,0xAD,
+	0xE3,0x18,0xD8,0xBF,0x4F,0xC4,0xBE,0x99,0xF1,0x47,0x43,
+	0xC8,0x6F,0x81,0x88,0x05,0xC5,0x58,0x8F,0xBD,0xC9,0x5A,
+	0xAF,0x30,0xA8,0x96,0x27,0x52,0x8D,0x32,0x64,0x3C,0x37,
+	0x19,0xDA,0xD0,0xFE,0x72,0xD2,0x11,0x0A,0xB1,0xAE,0x31,
+	0x4C,0x4E,0xB4,0x09,0x27,0x71,0x29,0x3E,0x42,0x48,0xF8,
+	0x9C,0x89,0xE1,0xF9,0x27,0x8B,0x78,0x34,0xCF,0x9B,0x24,
+	0xEF,0x4F,0xC6,0x33,0xA3,0x8A,0x4D,0x6E,0x4F,0x66,0xDD,
+	0x2E,0x26,0xA4,0xAB,0x20,0x41,0xC8,0xBB,0x13,0x21,0x3A,
+	0x51,0xC3,0x8F,0x99,0xD4,0x3A,0x2A,0xB5,0x6D,0x84,0x56,
+	0xFA,0x24,0xD7,0xD8,0x40,0xAC,0x37,0x05,0xEA,0xB3,0xA1,
+	0xD9,0xB1,0x19,0x3D,0x5C,0x35,0x9E,0x9D,0x99,0x44,0xDF,
+	0x4A,0xC5,0x53,0x1E,0x37,0x00,0x80,0xA1,0x6B,0xC0,0x2D,
+	0xD3,0xB5,0x2D,0xB7,0xC9,0x4C,0x8F,0xAE,0x49,0xA2,0x4C,
+	0x35,0xC1,0xFA,0xF8,0x4F,0x94,0x3A,0x1F,0xA4,0x56,0xCB,
+	0xF6,0x14,0x18,0x78,0x70,0x07,0xB3,0xEE,0x30,0xA6,0x78,
+	0x5A,0xA0,0xDE,0x69,0xF2,0xE6,0xE0,0x81,0xD4,0xCF,0x87,
+	0x2A,0x29,0xEC,0xC9,0x86,0x4F,0x2F,0x0F,0xC5,0x9A,0x99,
+	0xBC,0x93,0x55,0x0F,0x1F,0x13,0x0B,0x63,0x78,0x94,0x26,
+	0x37,0xEE,0xE4,0x78,0x37,0x30,0x9B,0xC0,0x08,0x8B,0x00,
+	0x97,0xDE,0x37,0x54,0x54,0x0A,0xE2,0x75,0x05,0x22,0xF7,
+	0x0F,0x89,0xD8,0xEC,0x7D,0x35,0x53,0xBE,0x14,0x94,0x4F,
+	0x4D,0xD1,0x0E,0x68,0x1A,0x03,0x76,0xCF,0xB0,0x04,0xFD,
+	0x1F,0x9E,0x60,0xE8,0xFF,0xDB,0x09,0xA2,0xA6,0x1A,0xC4,
+	0x9E,0x14,0x37,0x63,0xC1,0xB7,0xF0,0xA8,0xF2,0x7B,0xB3,
+	0xB4,0x0D,0x41,0x8D,0xEB,0x57,0xC5,0xA2,0x5C,0x94,0xD2,
+	0x77,0x43,0xF0,0xE7,0x89,0x5C,0xA7,0x32,0xAE,0xD7,0x02,
+	0xD7,0x71,0x70,0x67,0xF1,0x61,0x83,0x94,0xBA,0x4F,0x42,
+	0xDE,0x70,0x0B,0x9E,0x0C,0x11,0x4E,0xC0,0x5D,0x75,0x54,
+	0x15,0x22,0x81,0xFA,0x2C,0xB6,0xCD,0x17,0xE9,0xBB,0xCD,
+	0x17,0x49,0xD8,0xE6,0x0B,0x5F,0x0E,0xD4,0x3B,0x70,0x07,
+	0x6E,0x2E,0xB0,0xFC,0x7C,0xBC,0x18,0xA8,0x4F,0x81,0xE0,
+	0x73,0xD3,0xF3,0x64,0x03,0xDB,0xCB,0xDB,0x50,0x01,0xD3,
+	0x0D,0xCE,0x3A,0xA5,0x42,0xD4,0x2B,0xA8,0x42,0x54,0x99,
+	0xC9,0x46,0xE6,0x54,0xD0,0xF5,0x86,0x14,0xED,0x40,0x87,
+	0x61,0x81,0x96,0xFC,0x04,0x5D,0xD7,0x8F,0x87,0x69,0xE0,
+	0xFE,0x99,0xE0,0xC1,0x31,0x30,0x8D,0xB2,0x4A,0x92,0x62,
+	0x51,0x67,0xE7,0x49,0x42,0xFE,0xC8,0xF7,0x45,0xD6,0x16,
+	0xFD,0x58,0xF9,0x89,0x89,0x22,0xDD,0x98,0xC7,0x6E,0xFF,
+	0x39,0xD1,0x40,0x85,0x7E,0x96,0xF6,0x3D,0xD3,0xCC,0xCE,
+	0x4A,0xDE,0x98,0x28,0xF6,0x06,0x7D,0x34,0xB9,0x4C,0x3A,
+	0xDF,0xD9,0x6A,0x22,0x9E,0xCC,0x97,0xF9,0x23,0x5D,0x23,
+	0x2C,0x64,0xBA,0x89,0xD4,0xC7,0xAD,0x32,0xF2,0x72,0xF1,
+	0xE4,0x03,0xC3,0x26,0xB4,0xAC,0xDB,0x03,0x81,0x8A,0xD7,
+	0x16,0xE8,0xC1,0x20,0xCD,0x76,0xA0,0xB8,0xB3,0x7D,0x4B,
+	0x7D,0x8A,0x6D,0xAF,0xBF,0xFC,0xFE,0x14,0xE2,0xB5,0xB7,
+	0xF2,0xF7,0xA7,0x98,0xE8,0x61,0x75,0x53,0x7D,0xCA,0xF8,
+	0x2F,0x21,0xEA,0xC0,0x90,0x81,0x9E,0x54,0xBD,0x03,0x65,
+	0x9C,0x68,0xF8,0x36,0x1B,0x5E,0xEC,0xDA,0xC5,0x81,0x17,
+	0xE5,0xCA,0x6A,0x18,0x9B,0x52,0x0D,0x77,0xA0,0xF8,0x50,
+	0x18,0xFF,0x9F,0x79,0xE8,0x0C,0xFE,0x7F,0x8D,0xE4,0xE3,
+	0x83,0x43,0x24,0x9F,0x3D,0x98,0x2A,0xF9,0x1C,0xC1,0x9C,
+	0x15,0xCB,0xF7,0xCA,0x64,0xCA,0x81,0x61,0x6B,0x0F,0x1A,
+	0xEB,0x9D,0x7C,0xA0,0xBC,0x23,0x05,0x73,0xBE,0x8F,0x20,
+	0x09,0xE8,0x48,0x31,0x11,0xF9,0xA3,0x54,0x17,0x7D,0xA6,
+	0xC2,0xC8,0xC3,0x3F,0x81,0xA7,0xC7,0xB5,0x27,0xCF,0xDD,
+	0xD5,0xF2,0xE8,0x5C,0x18,0x2E,0xB8,0xAE,0x8F,0x37,0x8B,
+	0xE6,0x88,0x52,0xBB,0x7F,0xF7,0xE8,0xDC,0x9B,0x3C,0x79,
+	0x0C,0x70,0x0D,0x02,0x5A,0x1F,0x1A,0x03,0x49,0x15,0x3E,
+	0x16,0x6B,0x8F,0x50,0x8E,0xEE,0xAC,0x9A,0x56,0x0E,0xD4,
+	0x13,0xDB,0xD7,0x07,0x8A,0x10,0x7C,0xEC,0x40,0x3E,0x5F,
+	0xA4,0xC2,0x9D,0x7D,0x36,0x4B,0x6A,0xDD,0x74,0xD1,0x15,
+	0x2C,0x3F,0x33,0x17,0xAB,0x20,0xBC,0x5C,0xF6,0x13,0x80,
+	0xA5,0x24,0x8B,0xA2,0x9B,0xF1,0x6B,0x00,0x34,0x48,0xB6,
+	0x58,0x2C,0x5D,0x82,0x85,0x1A,0xB5,0xAF,0x04,0x7A,0x2E,
+	0x23,0xCF,0xD6,0xC8,0x21,0xA8,0x1C,0xAD,0xA9,0xE0,0xA6,
+	0xD7,0xCF,0x46,0x57,0xC6,0xB9,0xE9,0x33,0x02,0xCC,0x2C,
+	0xAD,0x7A,0x00,0xD5,0x78,0xF6,0x41,0x02,0xB5,0xF7,0x71,
+	0x20,0x26,0x63,0xFD,0x9A,0x7A,0x95,0xB1,0xA2,0x67,0xA2,
+	0x18,0x54,0x03,0xAB,0x6A,0xFA,0x7E,0x01,0x63,0x85,0xA2,
+	0xAA,0xE5,0xB3,0xA9,0x00,0x39,0x7A,0x15,0x3B,0x4C,0x8C,
+	0xFC,0xB7,0x5E,0x4A,0x51,0x58,0x6C,0x54,0x26,0xBF,0x94,
+	0xBB,0xF5,0x85,0xDC,0xAD,0xBB,0x72,0x21,0xB6,0xBA,0x52,
+	0x2D,0xB9,0x94,0x42,0x6F,0x2B,0xD7,0xC3,0x6F,0xD5,0x6B,
+	0x6F,0xE3,0xBB,0xC0,0xA2,0x4A,0x3F,0x29,0xEF,0x85,0x5C,
+	0xC8,0x01,0xD7,0xDA,0x54,0xFE,0x85,0x5C,0x08,0xB7,0x52,
+	0xEA,0x3F,0x8E,0xCF,0x15,0x02,0xE5,0x97,0xB0,0x3B,0x31,
+	0xF2,0x94,0x42,0xB1,0x8D,0x87,0x47,0xA2,0xAF,0x69,0x75,
+	0xC1,0x2D,0x3D,0xA6,0x62,0x1E,0x20,0xA8,0x62,0x4C,0x9C,
+	0x91,0x8B,0x6D,0xDE,0x95,0x5B,0x0A,0x3C,0x99,0x49,0xAA,
+	0x8D,0xD8,0x8E,0x36,0x12,0x1C,0xE4,0x90,0x00,0x18,0x1A,
+	0xFC,0x1B,0xF5,0xF1,0x14,0x43,0x26,0x00,0x1C,0x5C,0xF2,
+	0x9B,0x60,0x4C,0xD3,0x35,0xB8,0x7D,0x5F,0x13,0x69,0x7D,
+	0xE8,0xCD,0x5C,0x12,0x28,0x07,0x39,0x1E,0x88,0x32,0x23,
+	0x26,0x7E,0x57,0xAE,0xE2,0xC0,0x3C,0xE2,0x3F,0x26,0x71,
+	0x6B,0x57,0x8A,0x24,0x44,0x0D,0x2D,0x21,0xF3,0x93,0x4A,
+	0x7C,0x29,0xF1,0x22,0x63,0xE1,0x24,0x4D,0x03,0x91,0x41,
+	0x28,0x05,0xFC,0x3E,0x2B,0xB1,0x3E,0x0E,0xFA,0x98,0xFC,
+	0x0D,0x18,0x77,0xB9,0x09,0x0D,0x9A,0x45,0xBF,0x30,0xE1,
+	0xD2,0x7A,0x9B,0x15,0x26,0x03,0x0E,0xE6,0x82,0x64,0x93,
+	0xFC,0x2D,0x94,0xCE,0x60,0xA5,0xB6,0x36,0xAB,0x89,0x84,
+	0x5F,0x24,0xF2,0x77,0x00,0xB2,0x31,0x50,0xBA,0xCA,0xFB,
+	0x52,0xDA,0x38,0x33,0x69,0xB3,0x0E,0x20,0xE1,0x7F,0x11,
+	0xB9,0x03,0x8A,0x32,0xE3,0x8B,0x4C,0x5A,0xD1,0x1E,0x22,
+	0x77,0x41,0x51,0x07,0x61,0x45,0x08,0x66,0xC5,0x58,0xF4,
+	0x17,0x88,0x4C,0xA1,0xE8,0x33,0x56,0xC4,0xB7,0x59,0xCD,
+	0x44,0x99,0x2B,0x47,0xB0,0x9F,0x1B,0x90,0xA1,0x44,0x29,
+	0x90,0x55,0x80,0xBC,0x1E,0x07,0x29,0x94,0x4D,0x69,0x30,
+	0x4B,0x31,0x88,0xA3,0xCD,0x9A,0x4F,0x50,0x0D,0x65,0x99,
+	0x6C,0x06,0xE8,0x5D,0xF1,0x50,0xB0,0xF0,0x2C,0xF6,0x4E,
+	0x95,0x32,0x5E,0xAA,0x89,0x1E,0x3A,0xA5,0xBE,0xEE,0x4F,
+	0xA1,0x73,0x18,0xC6,0xE0,0x5E,0xC0,0xF0,0x59,0x62,0x90,
+	0x63,0x8F,0xD2,0x43,0xBB,0x52,0x82,0x56,0xC8,0x07,0x59,
+	0x47,0x19,0x52,0xBF,0x1F,0x2D,0xD1,0x66,0x55,0xD5,0x58,
+	0x97,0x80,0x26,0xD2,0x96,0x3A,0x7D,0x29,0xB1,0xCD,0x8C,
+	0x2F,0x2B,0x45,0x70,0x6E,0xBB,0x70,0xCD,0x94,0x5E,0xA8,
+	0x34,0x16,0x00,0xE2,0x56,0x2F,0x70,0x9D,0x40,0xC9,0x90,
+	0xF2,0x76,0xE5,0x86,0x6C,0xD3,0x38,0xAD,0xCC,0x2E,0xE0,
+	0x88,0x51,0x62,0x5B,0x1C,0x6F,0xBF,0x94,0xAB,0x24,0xB3,
+	0x65,0x8A,0x7D,0x93,0xC4,0xB5,0x9C,0x50,0x5A,0x02,0x4D,
+	0xF9,0x8D,0xB1,0xFF,0x51,0xAC,0x62,0xB9,0x1D,0x1C,0x49,
+	0x88,0x40,0xA1,0x9C,0x42,0x8A,0x04,0xCE,0xFA,0x52,0x6E,
+	0x69,0xAB,0x57,0x51,0xFA,0xB3,0x0E,0xFA,0x60,0x29,0x90,
+	0x95,0xA9,0xDE,0xA4,0x20,0x50,0xEE,0x06,0x09,0x36,0x8D,
+	0xC7,0x49,0xFA,0xB4,0x2A,0xB5,0xAD,0x88,0xED,0xA4,0x80,
+	0xA2,0x5A,0xAF,0x72,0x29,0xB9,0xA8,0x92,0x7F,0x86,0xC3,
+	0x63,0xF5,0xCF,0x48,0xF5,0xE2,0x1A,0xC1,0x8B,0xD0,0x36,
+	0xBB,0x72,0x8D,0x9E,0x74,0x42,0xF9,0x95,0xBF,0xCC,0xE1,
+	0xB5,0x4B,0xAD,0x63,0x5E,0xCA,0x0D,0xAF,0x23,0xFE,0xB2,
+	0x54,0xEF,0x00,0xA9,0xB5,0x02,0x0B,0x3D,0xBC,0xBF,0xDE,
+	0xE4,0x80,0xA4,0xFF,0x24,0x2B,0xAD,0x50,0xEE,0xD1,0xC4,
+	0x7D,0xC8,0x94,0xE9,0x9C,0x06,0xE3,0x15,0x92,0x69,0x8F,
+	0x23,0xA0,0x02,0xFB,0x80,0x9A,0xEA,0xFD,0x3A,0xC0,0xD6,
+	0x1A,0xF2,0xF0,0x7E,0x0A,0x43,0x3A,0x0C,0x48,0x30,0x00,
+	0xD7,0xCE,0x56,0xF1,0xE2,0x6F,0x80,0x72,0x66,0x9A,0xAB,
+	0xF4,0x47,0x07,0xA0,0xE7,0xE0,0x7D,0xEB,0xEC,0xA8,0x43,
+	0x76,0x10,0x25,0x59,0x7B,0x50,0x1D,0x2C,0x56,0xFC,0x2A,
+	0x2A,0x1A,0xB5,0xA2,0xAB,0xCD,0xF2,0x7E,0x18,0x3B,0x6F,
+	0xF1,0xDA,0xAE,0xD0,0x70,0x6C,0x8A,0xBF,0xF5,0x60,0x76,
+	0xDE,0xD2,0x60,0x56,0xFA,0xD3,0x99,0x30,0x92,0xBE,0xCC,
+	0xC5,0xA9,0x01,0xD1,0xBE,0xE0,0x45,0x3A,0x34,0x12,0x4B,
+	0xF3,0x01,0xA6,0xB3,0xD9,0x11,0x91,0xCE,0x07,0xA2,0x26,
+	0x4F,0x72,0xC0,0xC7,0x11,0xD0,0x3D,0x3A,0xC0,0x6B,0xA5,
+	0x63,0x22,0xCA,0xE9,0x9A,0xD8,0xC0,0x61,0x47,0x2E,0x0E,
+	0xA9,0x22,0x75,0x46,0xF4,0xDC,0xBF,0x89,0x04,0xA2,0x43,
+	0x3D,0x16,0x7A,0x0D,0xBE,0xB5,0x44,0xFF,0x0E,0x45,0x3D,
+	0x3D,0xD2,0x79,0xD6,0xED,0x8A,0x55,0xB0,0x71,0xDB,0x2E,
+	0x9E,0x74,0x9E,0x91,0xDA,0xA7,0xBE,0x5E,0x9E,0x86,0x2F,
+	0x89,0x45,0xA1,0x8A,0xFC,0xEC,0x80,0x6A,0xA9,0xFF,0x92,
+	0xF9,0x02,0x0B,0xB5,0x33,0xCA,0x7A,0xA0,0x7C,0xA7,0x07,
+	0x15,0xC8,0x07,0x6E,0x97,0x08,0xC2,0x7E,0xAA,0x8A,0xC9,
+	0x1D,0x9E,0x31,0xF4,0xF9,0x9E,0xE9,0x03,0x60,0x32,0xA0,
+	0xC7,0x49,0x8C,0x9D,0xFA,0x7A,0x59,0x5A,0xDC,0x43,0x45,
+	0x1A,0x4D,0x86,0xA1,0x1E,0xAE,0x51,0xFB,0xEC,0xB8,0x30,
+	0x75,0x0B,0x80,0xF3,0x3F,0xFB,0xEA,0x74,0xE8,0xC4,0xA1,
+	0x13,0xD0,0x9B,0x2C,0xED,0x53,0xA7,0xF4,0xEA,0x54,0xEA,
+	0xE3,0x35,0x9D,0x3C,0xF7,0xD2,0x29,0x3D,0xEC,0x0D,0xA2,
+	0xA8,0x48,0xC7,0x30,0x9D,0x54,0xD0,0xF3,0x66,0xA8,0xE9,
+	0x00,0xCF,0x0B,0xA0,0xD1,0x73,0x81,0xA8,0xD9,0x3B,0x88,
+	0xBD,0x41,0x05,0x18,0xBF,0x66,0x18,0x03,0x3C,0x03,0xA1,
+	0x04,0xF2,0xC3,0x6E,0x97,0x62,0x72,0xC7,0x89,0x50,0xAB,
+	0xCD,0x38,0x8B,0xD0,0x3F,0x02,0xEA,0x89,0x6E,0xE9,0x3C,
+	0x54,0x05,0xCC,0x76,0x9B,0xCA,0xAC,0xB7,0x5C,0xA5,0x49,
+	0x24,0x5C,0x1D,0x37,0xC2,0xAA,0xD2,0x58,0x30,0xCF,0xEB,
+	0x11,0x43,0x53,0xFF,0xB8,0x88,0xE1,0x27,0x30,0xC2,0x97,
+	0x8D,0xC4,0x88,0x21,0xE2,0x92,0xEF,0x80,0x87,0x2A,0x78,
+	0x90,0xEF,0x4E,0xD3,0x22,0x79,0x83,0x64,0x59,0x22,0xC9,
+	0x48,0xC4,0xBA,0x15,0x6E,0xB6,0x8D,0x12,0xE9,0x88,0x6E,
+	0x96,0x73,0x9D,0xCB,0xD3,0x36,0x2D,0xE4,0x07,0xD2,0xB4,
+	0xA8,0xDE,0xA0,0x1E,0x92,0x48,0x7D,0xE6,0x4A,0x36,0x55,
+	0x51,0x1B,0xC8,0xFC,0x0B,0x3C,0x1F,0x83,0xAC,0x99,0xA7,
+	0xC7,0xBF,0x67,0x6C,0xFE,0xA2,0xB3,0x69,0xE3,0xF7,0xE7,
+	0xB2,0xF5,0x3A,0xF6,0xFB,0x21,0xFB,0x3D,0xC8,0x76,0x31,
+	0x0E,0xB3,0xDF,0x8F,0xD9,0xEF,0x51,0xF6,0xDB,0xCE,0x7E,
+	0x8F,0x31,0x9C,0xE3,0xEC,0xFE,0x4B,0xF6,0x7B,0x22,0x37,
+	0x19,0x7E,0x3F,0x67,0xF0,0x93,0xB9,0xFA,0x36,0x8B,0xB1,
+	0xF9,0xB9,0x93,0x23,0x6F,0xBC,0x5D,0x36,0x76,0xEA,0x0C,
+	0x0F,0x7F,0xED,0xB5,0x27,0x3B,0x95,0x01,0x63,0xD5,0x3B,
+	0xED,0xCC,0xC5,0x8D,0x42,0x2F,0xA5,0x0C,0x97,0x5F,0x4D,
+	0xC3,0x64,0x03,0x82,0xF5,0xC3,0x69,0x5A,0x1E,0x61,0xD4,
+	0xE8,0x7A,0x88,0xC4,0xED,0xE0,0x9C,0x55,0x36,0x60,0xCC,
+	0xC4,0x42,0x38,0x32,0x80,0x3C,0x5E,0x16,0x2A,0x7B,0xA4,
+	0x6C,0x57,0x99,0xE6,0xC5,0xE4,0x7F,0xC0,0xC0,0x78,0x58,
+	0x15,0x8D,0x7D,0x23,0x8E,0x8D,0x14,0x5F,0x3C,0xE0,0x43,
+	0x00,0xFC,0x22,0x1E,0xF0,0x39,0x00,0x6E,0x8A,0x07,0x1C,
+	0x04,0xC0,0xF5,0xF1,0x80,0xC3,0x00,0x98,0x16,0x0F,0xF8,
+	0x18,0x00,0x57,0xC5,0x03,0xDA,0x01,0xD0,0x3F,0x1E,0x70,
+	0x0C,0x00,0x36,0x03,0x80,0x9E,0x13,0x2B,0xBE,0x6B,0xFA,
+	0xD8,0xA9,0x53,0xF4,0x8A,0x0F,0x61,0x15,0x67,0xA6,0x54,
+	0x46,0xE3,0xD5,0xD4,0xA7,0xF2,0xE1,0x34,0x2D,0x1D,0x32,
+	0x2A,0x5F,0xE5,0x64,0x95,0xCF,0x8E,0x8A,0xAC,0xEE,0x56,
+	0xC2,0x43,0xDD,0x7F,0x3F,0x5D,0x9A,0x1E,0x98,0xFE,0xFA,
+	0xF4,0x38,0x11,0x43,0xCA,0x7F,0x20,0xE2,0x38,0xB2,0x1E,
+	0xAD,0xB5,0x51,0xBC,0x08,0x3E,0x5D,0x7B,0x93,0xCE,0x10,
+	0xA1,0xE4,0x30,0x11,0x2F,0x5F,0xD6,0x44,0xE4,0x92,0xFE,
+	0x20,0xA2,0x63,0xFA,0xE9,0xE9,0xE7,0xA6,0x0F,0x2C,0x8F,
+	0x13,0xE1,0xFF,0xA1,0x08,0x6C,0x72,0x14,0x71,0x22,0xD7,
+	0xD9,0x47,0x44,0x61,0xBA,0x96,0x6F,0x19,0x22,0xD6,0x6A,
+	0x22,0xAA,0x74,0x11,0x03,0xC8,0x60,0x32,0x84,0x88,0xE5,
+	0xAB,0xCB,0x17,0x94,0x5F,0x57,0xAE,0x5B,0xEE,0x4B,0xB0,
+	0xDC,0x81,0xCB,0x09,0x96,0xBB,0xF4,0x43,0x99,0x27,0xF5,
+	0x6A,0x9D,0x4C,0xA8,0x56,0x45,0xBA,0x96,0xAD,0x18,0x32,
+	0xB3,0x35,0x99,0xC7,0x22,0x9A,0xCC,0x1C,0xE2,0x04,0xB9,
+	0x07,0xCA,0xDF,0x2A,0x7F,0xB7,0xFC,0xDB,0x72,0x63,0x79,
+	0x54,0xC2,0xE3,0x01,0x0E,0xA9,0x95,0xA5,0x45,0x6C,0xBF,
+	0xE1,0xF8,0x38,0xE3,0x48,0xE7,0xA7,0x44,0xAE,0x49,0x77,
+	0xD1,0x09,0x57,0x8A,0xF2,0x8A,0x74,0xED,0x40,0xB6,0xC1,
+	0x5B,0xCE,0x8E,0x1B,0x64,0xEB,0x00,0xE9,0xB7,0xC3,0x61,
+	0x88,0x22,0xB6,0xE5,0x4A,0x91,0xF9,0xA9,0xF0,0x23,0x5A,
+	0x52,0x6A,0x70,0xD7,0xD6,0x7B,0x39,0xDA,0x80,0xEC,0x71,
+	0x9D,0xF6,0x16,0x9C,0xE4,0x86,0x25,0x16,0xDF,0xAC,0x4B,
+	0x07,0xA7,0x16,0x89,0x39,0xDA,0x63,0x2C,0x2B,0x1C,0x2F,
+	0x3F,0x9C,0x8E,0xAF,0x8D,0xF5,0x6A,0x31,0x31,0x51,0x0B,
+	0xF5,0x0A,0x8C,0x69,0x5F,0x84,0xBB,0xEF,0xE0,0x4E,0x90,
+	0x04,0x07,0x24,0x75,0x92,0x90,0x62,0x12,0xBA,0x55,0xDC,
+	0xAF,0x8E,0x96,0x0A,0xFC,0x6A,0x4B,0xF8,0xF6,0x5E,0x77,
+	0x85,0xAB,0x83,0xA7,0x73,0x8D,0x91,0xEA,0xE3,0xD4,0x92,
+	0xD3,0xB9,0xF4,0x70,0x99,0x08,0x88,0x75,0x96,0x56,0x2B,
+	0xC1,0xE7,0x6A,0xBA,0xBC,0x0C,0x32,0x32,0xFA,0x46,0x99,
+	0x38,0x47,0x3A,0x0F,0x91,0xC0,0x71,0xFF,0xD4,0x9B,0x60,
+	0x5A,0xFD,0xA2,0xB5,0x02,0x54,0xB4,0x56,0x25,0x77,0xAC,
+	0x3E,0x1B,0x0B,0x80,0x89,0x69,0xBD,0xE0,0x77,0xC9,0xCD,
+	0xA0,0xC3,0xC5,0x8B,0xA2,0xB8,0x7E,0x0D,0x81,0x20,0xF8,
+	0x1D,0x78,0xFA,0xCA,0x78,0xC2,0x72,0x7A,0x1B,0x11,0xB5,
+	0x50,0xAB,0x8E,0x63,0x40,0x7A,0x83,0x45,0x14,0x31,0xE2,
+	0xD0,0xF5,0xEA,0xC3,0x68,0x7B,0x1F,0x46,0x4F,0xF5,0x61,
+	0x34,0x88,0xC4,0x02,0xEA,0xD4,0x18,0xB3,0xBF,0x9A,0x20,
+	0xE0,0xFE,0x2A,0xB6,0x99,0x52,0x6D,0x58,0xD7,0x73,0xB5,
+	0xC8,0xCE,0x77,0xA8,0x2C,0x5A,0xB8,0xCB,0xA4,0xC1,0x79,
+	0x7A,0xD3,0xD5,0x62,0x2C,0xBA,0xB6,0x55,0xD3,0x13,0xB9,
+	0xA2,0xF2,0x05,0xAE,0x64,0x56,0xD3,0x3F,0x4D,0xD2,0xD6,
+	0xD9,0xCD,0x4A,0x26,0xEE,0xB8,0xE0,0x2A,0x77,0x48,0x07,
+	0xA5,0xC0,0x43,0x35,0x2D,0x02,0x51,0xE1,0x7C,0x53,0x48,
+	0xF8,0xFE,0x10,0x1D,0xD1,0x40,0x42,0xEE,0xCB,0x87,0xCE,
+	0x34,0x9E,0x6C,0x20,0xA5,0x7B,0xEA,0xF8,0xB7,0x21,0xE8,
+	0xEC,0x26,0x3F,0x52,0x04,0x09,0xEC,0x09,0x22,0x09,0x5D,
+	0x2F,0x5B,0x8F,0xD0,0x11,0xE9,0x44,0x72,0x47,0x8E,0x40,
+	0x49,0x3A,0x12,0x99,0x95,0xF7,0x7F,0xB4,0x00,0x48,0x5E,
+	0x04,0x56,0x5D,0x23,0x86,0x02,0xA3,0x48,0xE3,0xC9,0xA1,
+	0x1A,0xF2,0x53,0x09,0xA0,0x95,0xB8,0xA1,0x16,0x12,0x3A,
+	0x0F,0x51,0xFC,0x9F,0x95,0xF4,0x68,0x39,0x9B,0x4E,0x62,
+	0x09,0xFF,0x54,0xFD,0x1F,0xCA,0x57,0x9A,0x95,0xD9,0x92,
+	0xD0,0xC1,0xE4,0xCF,0x00,0xF9,0xDD,0x28,0x7F,0x86,0x46,
+	0x38,0x4E,0xFD,0xD1,0x12,0x20,0xC9,0x0E,0x09,0x1D,0x8C,
+	0x57,0x77,0x4C,0x8A,0x59,0x2D,0xEE,0x60,0x06,0x72,0x10,
+	0x2D,0x41,0x8A,0x6D,0xAD,0x71,0xD4,0xEF,0x14,0xD1,0xEA,
+	0xBF,0x76,0x8A,0x7A,0x84,0x19,0x38,0x6B,0x67,0x49,0xA3,
+	0x9C,0xAF,0xB5,0xD3,0xCC,0xB1,0xD8,0x1E,0x18,0x81,0xB1,
+	0x86,0x1A,0x65,0x6A,0x15,0xBA,0x87,0xB5,0x0A,0x3D,0x4F,
+	0xB5,0x0A,0x91,0x94,0x50,0x65,0xF6,0x5A,0xE1,0x72,0xA0,
+	0x8C,0x78,0xB8,0x1D,0x26,0xC5,0xBC,0x83,0xAC,0x85,0x96,
+	0xAB,0x37,0xE3,0xA3,0x19,0x1F,0x43,0xEE,0xA8,0xF9,0xE0,
+	0x5A,0x37,0xC0,0x38,0x84,0x71,0x7D,0x61,0x3C,0xC2,0xEC,
+	0x7D,0x61,0x76,0x84,0x65,0xF4,0x85,0x39,0x10,0x96,0xDF,
+	0x17,0x96,0x82,0xB0,0x8A,0xBE,0xB0,0x34,0x84,0xF9,0xFB,
+	0xC2,0x32,0xE2,0x54,0x53,0x21,0xF1,0x4F,0xF6,0xC6,0x54,
+	0x53,0x11,0x45,0x65,0x0B,0x17,0x31,0xD5,0x0C,0x58,0x7F,
+	0x93,0x37,0xA6,0x9A,0x06,0xC3,0x91,0x8E,0xFD,0x50,0xAD,
+	0xEB,0xA2,0xFB,0xAE,0xD2,0x8E,0x94,0xC4,0x0E,0x17,0x49,
+	0x5D,0x08,0x9E,0x94,0x83,0xEB,0x46,0x36,0xB4,0xDA,0x86,
+	0xA9,0x22,0x46,0xCA,0xB1,0x8E,0xAF,0xDB,0x54,0xEF,0xFB,
+	0xF7,0xB1,0x9D,0x1D,0xC3,0xA4,0x23,0x4D,0x06,0xEF,0x6A,
+	0xFA,0x49,0x89,0x7E,0x58,0xA5,0x77,0x25,0xA8,0xAB,0x9A,
+	0x7E,0x96,0x0D,0xB9,0x1E,0xEE,0x4C,0x28,0x07,0xFD,0xBE,
+	0xEE,0x61,0x70,0x7D,0xCF,0xEF,0xEB,0x79,0x0A,0xAE,0x2D,
+	0x7E,0x5F,0x24,0x65,0xB5,0x59,0x91,0x43,0xC2,0xE5,0x0D,
+	0xC1,0x4A,0x68,0xFC,0xE8,0x86,0x11,0x26,0x12,0xE4,0xF0,
+	0xE6,0x79,0x33,0xF1,0xC5,0xF8,0x54,0x9A,0x19,0x88,0x8B,
+	0x07,0x69,0x58,0xF6,0x78,0x10,0xCF,0x40,0x19,0xF1,0x20,
+	0x3B,0x03,0xE5,0xC7,0x83,0x1C,0x0C,0x54,0x11,0x0F,0x4A,
+	0x61,0x20,0x7F,0x3C,0x28,0x2D,0x24,0xA8,0x1B,0x9E,0x37,
+	0xC5,0x83,0x32,0x18,0x88,0xE9,0x05,0xB3,0x95,0x45,0x76,
+	0x92,0x60,0xA5,0x93,0xC1,0xFA,0x28,0x96,0xC5,0x40,0x7D,
+	0x14,0xEB,0x1F,0x9F,0x4E,0x6F,0xFE,0x38,0x3D,0x99,0x3F,
+	0x9A,0xEE,0x2D,0xD8,0xD4,0x95,0xDB,0x4C,0x3A,0xC7,0x46,
+	0x73,0x25,0x67,0x47,0xAE,0xE5,0xE0,0xE6,0xEF,0xD9,0x4E,
+	0x34,0xEE,0x42,0x7F,0x9C,0x0E,0x13,0x7A,0x3A,0x21,0x92,
+	0xF3,0x68,0x3A,0xA0,0x1B,0xF9,0x2D,0x6D,0x51,0xB5,0x4D,
+	0xCB,0x4D,0xDF,0x01,0x25,0x78,0x7B,0x76,0x3D,0x74,0x62,
+	0xA3,0x54,0xC3,0x4B,0x55,0x9C,0xE5,0xBD,0x7E,0xC7,0x8A,
+	0xAA,0x22,0x83,0x6A,0xA2,0x8B,0x16,0xD0,0x3F,0xCF,0x8C,
+	0x0B,0x7F,0xF5,0x29,0x49,0x56,0xB1,0xE9,0x0E,0x51,0xE9,
+	0x13,0x10,0xE2,0x8E,0xEE,0xCB,0x3B,0x98,0x6E,0xA9,0x89,
+	0x16,0x4A,0x53,0x3A,0xDB,0x4C,0xC4,0xCB,0x37,0x9E,0x56,
+	0xD3,0x15,0xAE,0xF1,0xF4,0x79,0x08,0x49,0x3D,0xBD,0xA7,
+	0xD5,0x62,0xFD,0x20,0xC5,0x5D,0xCD,0xA6,0x22,0x36,0x2F,
+	0x05,0xCA,0x3F,0x4C,0x27,0xDE,0x34,0x29,0xAF,0x27,0xB7,
+	0xF8,0xFD,0xCD,0x17,0x73,0x8B,0x0F,0x87,0x77,0x13,0xB6,
+	0x4E,0xCD,0xC5,0xC1,0xE8,0xB0,0x59,0x0B,0x5D,0x34,0x6B,
+	0x26,0xF4,0x84,0xA0,0x1B,0x66,0x10,0xAE,0xF8,0x70,0x67,
+	0xC9,0xC5,0x5C,0x7D,0x11,0xE3,0xDB,0x28,0x14,0x7E,0x57,
+	0xC1,0xF6,0x2C,0xAB,0xE9,0x29,0x7C,0xEA,0xAC,0x48,0xDE,
+	0x13,0x93,0xBD,0x71,0x99,0x88,0x75,0x0A,0x56,0x45,0x82,
+	0x35,0x38,0xEB,0x80,0x1B,0x0B,0xBA,0x2F,0x05,0x85,0x0E,
+	0xE5,0xEA,0xE2,0x0E,0x65,0xA4,0xF4,0x05,0x6E,0x69,0x74,
+	0x48,0xC2,0x25,0xBA,0xAB,0xD2,0xD2,0x1A,0x38,0x4C,0x80,
+	0x41,0x8A,0xCA,0xFC,0xB8,0x23,0x00,0xF3,0x5E,0xC0,0x1D,
+	0x85,0x79,0x05,0xCF,0x45,0x7D,0x1C,0x10,0x2E,0xC1,0x63,
+	0x07,0xBE,0x1A,0x2D,0xB9,0x2F,0x95,0x0A,0xDD,0xB5,0x6F,
+	0xE1,0xB9,0x86,0xAE,0xDA,0xBF,0x43,0x6C,0x8E,0x6C,0x80,
+	0x7F,0x84,0xAE,0xAC,0x8C,0x5B,0xF4,0xC0,0xFA,0x69,0x67,
+	0xE3,0xE8,0x9C,0x28,0x9E,0x2A,0x49,0xC2,0xED,0x6F,0xAE,
+	0xD6,0xAC,0x9C,0xD1,0xED,0xB9,0x29,0x1A,0x8B,0x32,0x04,
+	0x1E,0x17,0x2B,0xA5,0xF3,0x50,0x13,0xC9,0xED,0x90,0x04,
+	0x3B,0xDD,0x57,0xB1,0x90,0x8D,0x17,0xCB,0x78,0x98,0x5C,
+	0xDD,0x6A,0x5D,0x0A,0x3E,0x34,0xE3,0x52,0x75,0x69,0x6B,
+	0xE2,0xC1,0x3E,0x1C,0x5E,0x34,0x37,0xEE,0x65,0x0F,0x3C,
+	0x0D,0xE0,0xB6,0x6B,0x8B,0xC0,0x38,0x25,0x0D,0x63,0x2D,
+	0xED,0xDA,0x0C,0x86,0x3D,0xBC,0xAC,0xF3,0x22,0x0C,0x88,
+	0xB6,0x4A,0x8E,0x98,0x19,0x14,0xFA,0x7D,0x6F,0x0E,0x17,
+	0xBD,0xC7,0x88,0x3F,0xB6,0xE1,0x1E,0xBC,0x3E,0x21,0xE3,
+	0xE6,0x3B,0xC2,0xDE,0x9C,0x80,0x5B,0xB5,0x98,0xC5,0x20,
+	0xD3,0x5C,0xD9,0x36,0xDB,0xC5,0x76,0x81,0x7F,0x83,0xB8,
+	0x52,0x97,0x9B,0x8E,0xCD,0x14,0x63,0x49,0x72,0xE3,0x59,
+	0xDE,0xEC,0xAE,0xA6,0xB7,0x98,0x36,0x47,0x41,0xEA,0xCB,
+	0x49,0xF4,0xC2,0x0C,0xB0,0xEF,0xEA,0xE9,0xA2,0xB8,0xF5,
+	0x60,0x7A,0xD0,0x79,0x38,0x7D,0xF3,0x41,0xE8,0xC8,0x87,
+	0xD3,0x99,0x1F,0x78,0x94,0x6C,0xEE,0xC8,0x85,0x20,0x81,
+	0x75,0x10,0xA9,0xE4,0x70,0xBA,0x54,0x7E,0x30,0x5D,0x6A,
+	0x63,0x47,0x2B,0x8E,0x5A,0x0E,0x4A,0x17,0xA4,0x36,0x9C,
+	0x87,0xBA,0xB4,0x65,0x08,0x98,0x77,0xBB,0x2F,0xE3,0xA1,
+	0x13,0xE8,0xB9,0x11,0xA9,0xAA,0x1B,0x5B,0x79,0xD1,0x82,
+	0x58,0xC5,0x79,0xAD,0xE2,0x83,0x54,0xE0,0xA3,0x96,0x1C,
+	0x4C,0xA7,0x05,0x10,0x37,0x40,0x1E,0x91,0xCE,0xF2,0x08,
+	0xF8,0x55,0xD6,0xCB,0xC4,0xEC,0xAA,0x76,0x33,0x36,0x4E,
+	0x5A,0x02,0x26,0x76,0x04,0x5A,0xF3,0xF5,0xD8,0x84,0x8F,
+	0xE6,0xD6,0xFF,0xB9,0xCF,0x66,0x77,0xCC,0x00,0x6F,0x8C,
+	0x8F,0x37,0x40,0x3F,0x34,0x80,0x9B,0x66,0xB1,0x61,0xE1,
+	0xA6,0x13,0x32,0x7A,0x2B,0xAF,0x19,0x92,0xA3,0x1D,0x46,
+	0x13,0x43,0x2A,0xDC,0xFB,0x45,0x95,0xAD,0x1F,0x6A,0x63,
+	0xD2,0x1D,0xD7,0x4B,0xA6,0xD0,0x82,0x48,0xDF,0x5E,0x02,
+	0x7D,0x74,0x10,0x04,0x65,0xBD,0x83,0x13,0x86,0xE5,0x2F,
+	0x22,0xDA,0x0A,0xA2,0xF2,0x0F,0xA1,0xB4,0xCE,0x5E,0x7F,
+	0xC2,0xE8,0x02,0xBA,0x2D,0x3D,0xA9,0xB1,0x3A,0x8F,0x2D,
+	0x35,0x24,0x9F,0xCD,0x46,0xD7,0x60,0x85,0xEE,0xE5,0xBC,
+	0x98,0x3B,0xD7,0xB2,0x47,0x1B,0x43,0xE0,0x09,0xF4,0x81,
+	0x18,0x85,0x8C,0x3E,0x15,0x1A,0x09,0x06,0x59,0x9B,0xD0,
+	0x0D,0xD6,0x49,0xDD,0x9C,0xD6,0x5F,0x72,0xA6,0xF4,0x0F,
+	0xBA,0xBB,0x70,0x31,0xBE,0xBC,0x87,0x21,0xF4,0x00,0xC2,
+	0xA5,0x36,0xA1,0x83,0x21,0x38,0x00,0xC1,0xDE,0x5F,0x1B,
+	0x4D,0xCC,0x0F,0xB1,0xAF,0x05,0xC0,0x08,0xED,0x12,0x97,
+	0xD1,0x9F,0xCF,0x94,0xF2,0x3A,0x60,0x08,0x5B,0xDA,0xFB,
+	0xED,0xB7,0xD4,0x44,0xFA,0x55,0x45,0xB5,0x61,0x53,0x74,
+	0x64,0xD0,0x3B,0x41,0xF7,0xF9,0xA0,0x70,0xC1,0x70,0x40,
+	0x6A,0xDD,0x05,0xB5,0xEE,0x3C,0x9D,0x30,0x3D,0x28,0x9C,
+	0x0D,0xBA,0xCF,0x05,0x7C,0xE7,0xC8,0xAA,0xB4,0x5A,0x5B,
+	0xA3,0xEF,0xEC,0x77,0xE9,0x2B,0xAD,0x72,0x0A,0x51,0x9C,
+	0x0C,0x96,0x5A,0xCB,0x07,0x00,0x06,0xA0,0x0C,0xF4,0x9C,
+	0xF9,0xA4,0xCF,0xE4,0xE2,0xB3,0x1B,0xED,0x33,0x68,0x5C,
+	0x7C,0xFB,0xD4,0xB9,0xE9,0xC9,0x91,0xFA,0x39,0x0D,0x74,
+	0x11,0xFA,0xB1,0x86,0x23,0x65,0xE0,0x23,0x6C,0x6E,0xDA,
+	0x98,0x26,0x2A,0x9F,0xB6,0x09,0x5D,0xE8,0x91,0xB0,0xDA,
+	0x85,0xD5,0xAC,0x33,0xBB,0xC6,0xE3,0x18,0x6B,0xF3,0xA6,
+	0xE2,0x23,0xDD,0xF4,0x39,0xDB,0x96,0x34,0x2B,0x1F,0x05,
+	0x84,0x2E,0x70,0x01,0xDD,0x24,0x8E,0xD3,0xAF,0xCB,0x4A,
+	0xDD,0xDD,0xAB,0xDE,0xC3,0x16,0xEB,0x5A,0xF5,0x8E,0x9B,
+	0x8E,0x4B,0x13,0xFB,0x2C,0x7C,0x6A,0x91,0x3D,0xC7,0xD8,
+	0x07,0x7C,0x30,0x45,0xDF,0x29,0xB7,0x43,0xE4,0x78,0xE7,
+	0x20,0x51,0x3E,0x96,0xDE,0xF7,0xA5,0xCE,0x73,0xF6,0xB8,
+	0x18,0x3A,0x02,0x48,0x6F,0xF4,0x87,0x48,0xFE,0x53,0xB8,
+	0x99,0x3A,0x48,0xBB,0x4E,0x80,0xAB,0x9A,0xDE,0xF7,0xC5,
+	0x4E,0x39,0x91,0xEA,0xB7,0x40,0x45,0x73,0xFF,0xCD,0xDC,
+	0x85,0xC3,0x4D,0xAF,0xFE,0x5C,0xDB,0xF5,0x48,0xA5,0x93,
+	0xCD,0xB8,0x19,0x83,0xE9,0xC4,0x6E,0xC2,0xD8,0x9D,0x1C,
+	0xA8,0x1D,0x77,0x48,0x92,0x87,0x66,0x60,0x52,0x01,0x99,
+	0xCB,0xB8,0x8C,0xBE,0xEF,0xF7,0x2F,0x4D,0xE4,0x7E,0xA5,
+	0xA1,0xD3,0xB3,0x48,0x0C,0xE1,0x05,0x0E,0xDD,0x95,0x26,
+	0x06,0x7A,0x74,0xA0,0x28,0xBB,0x33,0xFA,0xBE,0x71,0x39,
+	0x20,0x91,0xC1,0xE9,0x5C,0x48,0x0C,0x68,0xC7,0x11,0x71,
+	0x83,0x4B,0x5E,0x93,0xE1,0xA2,0x47,0xE1,0x59,0x5E,0x9F,
+	0xD1,0xF7,0xAD,0xCB,0x53,0xB6,0x04,0xAA,0x1D,0xB9,0xBA,
+	0xD8,0xB1,0x03,0x21,0xC6,0x55,0xD9,0x5A,0xB8,0x3D,0x85,
+	0xB5,0xCB,0xD2,0x80,0x0F,0x42,0x98,0x6B,0xDD,0xF4,0x8A,
+	0x09,0x2C,0x18,0x9E,0xCB,0xF0,0x78,0xD0,0xE5,0xB9,0x8C,
+	0xBE,0x9F,0x3F,0x59,0x9F,0xC8,0x75,0xA9,0xC1,0xB5,0x7D,
+	0x80,0x18,0x2E,0x51,0x59,0xCB,0x1C,0x18,0x20,0xCA,0xEF,
+	0x64,0xB0,0x8F,0xA2,0xBC,0x2B,0x9B,0x1B,0x41,0xCE,0xFB,
+	0xA3,0x8D,0x50,0xDD,0x12,0xCE,0x54,0x7B,0xE7,0x2F,0xC5,
+	0xA5,0x9D,0xE8,0xA6,0xD5,0xC7,0xD8,0x88,0xCC,0xD2,0x1E,
+	0xAB,0xE9,0x33,0xF9,0xEC,0x74,0xAA,0xDD,0x73,0x65,0x35,
+	0x1D,0x9A,0xA2,0xAD,0xFB,0x2F,0x4B,0xD6,0x3F,0xBC,0xC1,
+	0x56,0xFC,0xF7,0xE1,0x8A,0x3F,0xAD,0x1D,0x2F,0x86,0x5B,
+	0xA2,0xE1,0xB7,0xA2,0xC6,0x4C,0xC3,0x26,0x3F,0xBB,0xD6,
+	0x72,0x74,0xE8,0xB4,0x52,0x77,0x74,0xD5,0x53,0xD8,0xB3,
+	0x22,0xAB,0xFE,0x50,0x4D,0xFF,0x99,0x2C,0x6A,0xC4,0x0F,
+	0x25,0x8B,0xBD,0x7D,0x6C,0xD1,0x82,0x85,0xEE,0x6A,0xDE,
+	0x99,0xD7,0xB3,0xEB,0x88,0xBD,0xE9,0x58,0xE3,0xD7,0x2A,
+	0x19,0xDF,0x62,0xEA,0x72,0xA9,0xCE,0xA3,0x19,0x4B,0x87,
+	0xE6,0xDA,0x56,0xD4,0x2C,0x15,0x97,0x7D,0x74,0x63,0xF0,
+	0x2B,0x3E,0x0F,0xF3,0xAB,0xA3,0x19,0xBB,0xAE,0x99,0x97,
+	0x36,0x54,0x1E,0x3E,0xE2,0xC0,0xB0,0xA1,0xB6,0xE5,0x7B,
+	0x83,0xA7,0x4A,0xA4,0xD9,0xE6,0xB5,0x85,0x9F,0x66,0x6C,
+	0x39,0x96,0xD1,0xCA,0xB7,0x67,0x98,0x20,0x81,0xDD,0x2B,
+	0xFB,0xE7,0xB9,0xE8,0x7E,0x75,0x09,0x02,0xC8,0xDE,0x09,
+	0x2D,0x9B,0xDA,0x33,0xB4,0x5B,0x63,0x11,0x05,0x26,0xF7,
+	0x74,0x3C,0x13,0xD6,0x7B,0x74,0xDB,0x4A,0x7F,0x57,0xC0,
+	0xCD,0x74,0xD1,0x9F,0x5A,0xC0,0x54,0xF4,0x03,0xED,0x68,
+	0x85,0x19,0x3C,0x5D,0xCC,0x1D,0xB2,0xEC,0x07,0xD2,0x3A,
+	0x27,0x26,0x2F,0x79,0xF2,0xE7,0x19,0xAE,0x9D,0x49,0x84,
+	0xFE,0x75,0x5A,0x35,0x3D,0x37,0x16,0x06,0x2C,0xCB,0x97,
+	0x67,0x62,0x1C,0xD8,0xE1,0xA2,0x8F,0x8C,0xC2,0xED,0xD8,
+	0x0C,0xED,0x69,0xF3,0x57,0x19,0x2A,0xFF,0x15,0xF4,0x94,
+	0x2D,0x18,0x76,0xB2,0xF2,0x37,0xC7,0x8A,0xEB,0xDD,0x1D,
+	0x96,0x3D,0x52,0x7B,0xAB,0x6D,0x66,0x63,0x39,0x20,0x34,
+	0x78,0x1D,0x6D,0x80,0x04,0x49,0x2E,0xFF,0x75,0x86,0x46,
+	0x09,0xB1,0x6A,0xC9,0xD7,0x19,0xF4,0xE7,0x48,0x25,0x1D,
+	0x6F,0x35,0xA1,0x75,0x91,0xBA,0x9A,0xDE,0x3F,0x46,0x14,
+	0x5D,0xF4,0xFD,0x24,0xD6,0x6A,0x6B,0xFA,0x9E,0xAB,0xF6,
+	0xF1,0xAC,0x6D,0xC1,0x93,0x40,0x70,0x31,0x06,0x73,0xCD,
+	0xF9,0xA0,0xDE,0x27,0x38,0xFF,0x28,0xD9,0xFE,0xB2,0x9B,
+	0x3C,0x56,0x7F,0xD9,0x34,0x6F,0x52,0x6B,0x25,0xFB,0xC6,
+	0x98,0x89,0x54,0x95,0x76,0x7A,0xA9,0xB6,0xFA,0x08,0x39,
+	0x6A,0x35,0xCD,0x56,0xE3,0x36,0xCB,0xC0,0x7D,0x17,0x49,
+	0xAD,0xBB,0xD2,0x4C,0x9D,0x67,0x5E,0x21,0x52,0xFB,0xDA,
+	0x27,0xE8,0x80,0xD0,0x1E,0x97,0x0E,0x91,0xDA,0x97,0xAC,
+	0x7D,0xA8,0x30,0x4F,0x3A,0x7E,0xE8,0x54,0xDB,0x43,0xF9,
+	0x79,0x84,0xB0,0x53,0x2A,0x07,0x7B,0x0F,0xEA,0xF3,0x31,
+	0xC4,0x56,0xC0,0x63,0x67,0xCE,0x56,0x47,0x59,0x4F,0x34,
+	0x79,0xAF,0xD4,0xCB,0xAC,0x85,0x79,0xCC,0xEB,0xCD,0xB3,
+	0xB3,0xCA,0x8C,0xEA,0x4B,0xA2,0x0C,0x0C,0xA8,0x66,0x70,
+	0x5C,0x61,0x0C,0xA9,0x7A,0x09,0xF0,0x6C,0x87,0x18,0x07,
+	0xA2,0x03,0x5C,0xD4,0x0A,0xA0,0x15,0xF1,0x2F,0x09,0x18,
+	0x8C,0xFC,0xBB,0x81,0x91,0xF7,0xCE,0x78,0xDC,0xCE,0xCB,
+	0xBA,0x16,0xE3,0xE2,0xB0,0xE8,0x00,0xE2,0x19,0x14,0x27,
+	0x24,0x9E,0x60,0x73,0x54,0x19,0x0E,0xCE,0x78,0xB4,0xA6,
+	0xCD,0x77,0x71,0x45,0xF1,0x5A,0x3D,0x80,0xE3,0x2C,0xF6,
+	0x6C,0xCC,0xA2,0x66,0x36,0xA3,0x43,0x74,0x74,0xE8,0x84,
+	0x35,0x1F,0xB0,0x8A,0x46,0x1A,0x41,0x09,0x74,0x68,0x83,
+	0x8F,0x61,0xEE,0xF0,0xBF,0x48,0x2F,0x73,0x18,0xAE,0x07,
+	0x48,0x2F,0x43,0x78,0x7C,0x9B,0xC4,0x6B,0x35,0xFE,0xB2,
+	0x88,0x9F,0x62,0xB1,0xE0,0xE6,0x49,0xD6,0x90,0x3E,0x0A,
+	0x47,0x79,0x18,0x62,0x71,0x30,0x54,0xCF,0x36,0x9A,0x99,
+	0xF8,0x7E,0x6C,0xB0,0xC0,0x6E,0x68,0x30,0xCF,0xAF,0xFE,
+	0x4B,0x45,0x1E,0xB3,0xB2,0xB1,0x5E,0xF2,0x5F,0x8A,0xDF,
+	0x19,0xD5,0x5B,0xCF,0x84,0xA2,0x86,0x22,0x65,0xC0,0x7F,
+	0xB1,0xE1,0xDD,0xA0,0x12,0xF6,0x90,0xD5,0x96,0xF0,0x20,
+	0x15,0xF7,0x59,0xAB,0xD9,0xE0,0xE5,0xB7,0x84,0x33,0xE4,
+	0x4D,0xF7,0xEE,0x0A,0x67,0xEC,0xCC,0x27,0x79,0xB6,0xDD,
+	0x67,0x33,0xBE,0x3F,0x30,0xAC,0x36,0xAD,0xF1,0x14,0xA9,
+	0x08,0xF4,0xE8,0x27,0xD9,0x2C,0x32,0x21,0x2B,0x6C,0xC6,
+	0x5A,0x96,0xFE,0x4D,0x2B,0xA9,0xD5,0x7A,0x25,0x71,0xD1,
+	0x11,0xB8,0x04,0x5B,0x13,0x0B,0xCF,0xA1,0x1C,0x37,0xBC,
+	0x28,0xC9,0x64,0xA7,0x7D,0xE9,0x57,0x19,0x22,0xA4,0x56,
+	0xCD,0xE4,0x65,0xFB,0x91,0x13,0x90,0xD9,0xFF,0x9D,0x58,
+	0xF6,0x58,0x84,0x2E,0xEB,0x9B,0x36,0x98,0xF4,0x21,0x49,
+	0x69,0x26,0x08,0x8E,0x22,0xD8,0x15,0x12,0x7A,0x36,0x1C,
+	0x39,0xB1,0xD4,0x72,0x30,0x24,0x74,0x6F,0xC0,0xEC,0xE0,
+	0x12,0xB6,0x1D,0x8E,0x38,0x5D,0xD4,0xBD,0x85,0x38,0xAA,
+	0x19,0xEC,0x12,0xC2,0xAE,0xC2,0x8F,0x70,0x31,0x18,0x68,
+	0xA4,0xE1,0xC8,0xAE,0x61,0x2E,0x7A,0x1D,0xC2,0x62,0x63,
+	0x48,0x4E,0xC9,0xD4,0xDE,0x19,0x32,0xBC,0x78,0x9B,0x29,
+	0xCE,0x8B,0x0F,0xCF,0x04,0x73,0x67,0xE2,0x5B,0x67,0x70,
+	0x23,0x65,0x8A,0x6F,0x5B,0x88,0x92,0x17,0x88,0x9A,0xBC,
+	0x76,0xF9,0x2A,0x80,0xFC,0x3A,0x53,0x0C,0x3D,0xE8,0x1A,
+	0x06,0x71,0xAF,0x5C,0x04,0x8F,0x77,0x01,0x26,0xAE,0x11,
+	0x1D,0xAF,0xE9,0x0D,0x1D,0xA6,0x16,0x3E,0x49,0x6A,0x2D,
+	0xF4,0x9E,0x69,0xC5,0x1D,0xE0,0xDA,0x1D,0x04,0x27,0x75,
+	0x7E,0x8A,0xB6,0x39,0xCC,0x49,0x6D,0xCA,0x4F,0x59,0x78,
+	0xA0,0xB8,0x4A,0xEB,0x22,0xF5,0xC3,0x77,0x99,0x21,0xFC,
+	0x8F,0x74,0x9E,0xD1,0x0E,0x22,0x56,0xD3,0x49,0xB1,0xD5,
+	0x1A,0x30,0xB5,0xE4,0x8B,0x2A,0x10,0x95,0xC1,0x94,0xEA,
+	0xC0,0xD3,0x47,0x5D,0xF8,0x7E,0x82,0xA5,0x4A,0x71,0x32,
+	0xE7,0x23,0x28,0xAF,0x4A,0xC7,0xC1,0x32,0x6B,0x4D,0x82,
+	0x24,0x74,0x43,0x9C,0x85,0xA3,0x76,0xE0,0x30,0x3C,0x7C,
+	0x88,0x93,0xD6,0xE6,0xB8,0x34,0x89,0x8D,0x3F,0x5D,0xAD,
+	0x4F,0xA6,0x16,0xAB,0x4A,0xA6,0xD4,0xB6,0x6B,0x28,0xE9,
+	0x3C,0xE3,0x0A,0x71,0x1B,0x96,0x82,0xD7,0xEB,0x62,0x3B,
+	0x5E,0x67,0xA4,0xB6,0x37,0x6E,0x27,0x10,0xC9,0x5D,0x94,
+	0xF6,0x18,0x23,0x57,0xA7,0xDA,0x3C,0x15,0xB9,0xBF,0xAA,
+	0x8A,0x87,0x4E,0x48,0xED,0xD2,0xEB,0x8B,0x87,0x29,0x39,
+	0xF8,0x91,0x31,0x80,0x7D,0x33,0x92,0x75,0x4D,0x18,0xDE,
+	0x8A,0x5D,0x9A,0x94,0xDC,0xE1,0xFD,0xBA,0xF7,0xD5,0x20,
+	0x9D,0xF8,0x36,0x46,0xBC,0x43,0x65,0x7B,0x3E,0xDE,0xE9,
+	0x98,0x9C,0xD3,0xEF,0x26,0xB3,0xF3,0x99,0x9E,0x34,0x2C,
+	0x7A,0x37,0x57,0x84,0xEC,0x01,0xB9,0xE0,0x2E,0x35,0x42,
+	0xAE,0x03,0xE4,0x2E,0xE9,0x0B,0xDC,0xF6,0x5B,0x3C,0x2C,
+	0xC8,0xE1,0x5D,0x10,0xA5,0xB2,0x93,0x22,0x67,0x26,0xB1,
+	0x25,0x96,0x87,0x91,0x8A,0x63,0x71,0xD4,0x7B,0xB1,0x5D,
+	0x6A,0x9C,0x14,0x74,0xB1,0xFF,0xB9,0x1A,0xC6,0x73,0x29,
+	0x3F,0x3E,0x13,0x22,0xDB,0x2B,0xB5,0x99,0x54,0x9E,0x98,
+	0xA9,0xCD,0x07,0x9D,0xB8,0xF2,0xCC,0xEE,0x06,0xA8,0x9A,
+	0x22,0x56,0xA9,0x92,0x53,0x2C,0x92,0xE0,0xA8,0x89,0xAD,
+	0xD2,0x75,0x90,0x58,0x15,0x36,0x03,0x2F,0x3E,0x28,0xF0,
+	0x81,0xF2,0xF1,0x99,0xF8,0x51,0x08,0x55,0x0D,0xDF,0x6D,
+	0x92,0x6F,0xD2,0x56,0x1F,0xFE,0x7E,0x25,0x1B,0xC7,0x03,
+	0x71,0x89,0x4E,0xD8,0xEE,0xA2,0xC9,0x60,0x12,0x76,0x53,
+	0x65,0x12,0xB7,0x8E,0xCF,0x0C,0x8F,0x30,0xC9,0x57,0x43,
+	0x5F,0x09,0xE4,0x6B,0x47,0x52,0x71,0x91,0xA1,0x6C,0xAC,
+	0x27,0xAD,0x55,0xE8,0x1E,0x8B,0x9D,0xD7,0xBD,0x5E,0xE8,
+	0x51,0xEC,0xFA,0x5D,0xB7,0x8B,0x36,0xA2,0x3F,0x6A,0x15,
+	0x2E,0x13,0x79,0x3A,0x50,0xCD,0xCB,0x8F,0x3B,0x9A,0xFA,
+	0x10,0xC4,0x88,0xEB,0xD7,0x2C,0x55,0x5D,0xF4,0x2F,0x20,
+	0x53,0x9E,0x05,0xB5,0x81,0xA7,0xF0,0x47,0x44,0x3B,0x2C,
+	0x90,0xDB,0x8D,0xAB,0x87,0x50,0xBC,0x7E,0x8D,0x03,0x70,
+	0x02,0x88,0x33,0x3B,0x53,0x7F,0xFA,0xA4,0x10,0x22,0x04,
+	0xED,0xF6,0x1F,0x85,0xEC,0xEC,0x00,0x5B,0x52,0x84,0x67,
+	0x36,0x8D,0x81,0xBA,0x02,0x26,0x77,0xEC,0xEE,0x0F,0x04,
+	0x15,0xD7,0x2A,0x6B,0x56,0xEE,0xD0,0x96,0x69,0x38,0x76,
+	0x0E,0x61,0x5C,0xB7,0x18,0x23,0xC8,0x89,0x11,0xDC,0xD6,
+	0x87,0x60,0xB2,0xBF,0xDE,0x3C,0xC6,0x3B,0x29,0x9E,0xAC,
+	0xEB,0xFB,0x5E,0xB2,0xE3,0x36,0x83,0x6C,0x4C,0x1C,0x99,
+	0x75,0xF3,0xF8,0x4C,0x48,0xFF,0xAE,0xCB,0xD4,0x3E,0x2B,
+	0xE5,0xD4,0xCE,0xEA,0x82,0x33,0x2D,0x50,0xFB,0x64,0xFC,
+	0x5C,0xAC,0x51,0x52,0xA6,0xC8,0xD7,0x67,0xB2,0x16,0xB8,
+	0x27,0x49,0x3F,0xD9,0x3B,0x19,0x3A,0xD0,0x1C,0x7F,0xD9,
+	0x15,0x9E,0x2B,0xE5,0x79,0x99,0x10,0xD9,0xB4,0xE7,0xB0,
+	0xE1,0x24,0xCF,0xD7,0xB8,0xBE,0xCF,0x1E,0x71,0xA4,0xE1,
+	0x62,0xE7,0xD2,0xCB,0x18,0x33,0x3D,0x35,0x51,0x64,0xA9,
+	0xFE,0x8C,0x88,0xA8,0x75,0xD0,0x96,0x6A,0xBA,0xCB,0xDA,
+	0x27,0xE6,0xD6,0xE5,0x3D,0x55,0x02,0x1D,0x2A,0x28,0x70,
+	0x6D,0xD0,0xA7,0x62,0xC7,0xD9,0xB3,0x8D,0x0D,0x7B,0xD0,
+	0xD5,0xAC,0x38,0xD9,0xDB,0xEF,0xCD,0xE0,0x60,0x5E,0x84,
+	0xBF,0xDF,0x42,0xFB,0x85,0xD1,0xB9,0x40,0xFF,0xC2,0xB2,
+	0x21,0x50,0xA6,0x00,0xFC,0x4B,0xF8,0x7B,0x13,0xCA,0x0E,
+	0x60,0xD9,0xBA,0x9A,0xEE,0xA0,0xEF,0xC2,0xBA,0x9A,0x48,
+	0xB0,0xAE,0x8B,0x65,0x42,0xEC,0x1B,0x27,0xEB,0x85,0xB3,
+	0x2E,0xD9,0x8D,0xDF,0x74,0x22,0xA2,0xA8,0xC4,0x87,0xFF,
+	0x4C,0x20,0x2F,0xD5,0xD9,0x75,0x81,0xF8,0x99,0xA1,0xC5,
+	0x59,0x2E,0x79,0x3E,0xFC,0x5D,0x99,0xE5,0xA2,0xF7,0xC5,
+	0x09,0xBC,0x02,0xCA,0xD6,0x02,0xFC,0x41,0xF8,0xBB,0x09,
+	0xCA,0x6E,0xC2,0xB2,0x36,0xE1,0xEC,0xCD,0xF7,0xCA,0xC4,
+	0x9F,0x8C,0x95,0x39,0xCF,0xC4,0x77,0x18,0xE2,0x21,0x50,
+	0x69,0xE5,0x34,0xE1,0xC3,0x40,0xF8,0x9B,0x79,0xA2,0xD8,
+	0x89,0x41,0x89,0x27,0x0F,0xA3,0xB3,0x6C,0xC8,0x97,0x2C,
+	0xDE,0x34,0x37,0x5D,0x3F,0x02,0x02,0x63,0x82,0x47,0xC6,
+	0xF1,0xC8,0xED,0x59,0x05,0x6F,0x48,0xC2,0x1B,0x06,0xAC,
+	0xD9,0x6F,0xC0,0x24,0x5E,0x21,0xF1,0x60,0xDC,0xF5,0x9C,
+	0x1C,0x07,0xC6,0x1A,0xA1,0xF9,0x34,0x8D,0xF1,0xAB,0x11,
+	0xDF,0x82,0xB6,0xE7,0xE0,0xAF,0x15,0x34,0xDE,0x4E,0x50,
+	0xE3,0xCA,0x2C,0x13,0xC1,0x6F,0xFC,0xB8,0x51,0x33,0xFA,
+	0x1B,0x8C,0x86,0x65,0x72,0x2F,0x56,0x80,0x73,0x33,0x45,
+	0xFB,0xA1,0xA2,0x88,0xE5,0x19,0x1B,0x28,0x33,0x79,0xF8,
+	0xC6,0x32,0x72,0xAF,0xF7,0x0A,0x7C,0x97,0xC7,0x8E,0xDF,
+	0xCE,0x38,0x8B,0xC4,0x48,0xEB,0xA6,0xD3,0x91,0x58,0x23,
+	0x3A,0x3E,0xC4,0x20,0xB2,0x49,0xDC,0xD6,0x47,0x89,0x56,
+	0x8D,0xDE,0x58,0x8B,0x8D,0x10,0x3A,0xA4,0xBF,0x91,0xFE,
+	0x99,0x95,0x81,0x9D,0x02,0x6F,0x86,0xF1,0x8F,0xC7,0x95,
+	0x98,0xB3,0x4A,0x6A,0xE3,0x1F,0x25,0x56,0x02,0xFE,0xA0,
+	0xE6,0x87,0x2F,0x65,0x8E,0xCC,0x76,0xD1,0x72,0xEC,0xEB,
+	0x74,0xED,0xF3,0xFA,0xFA,0x4D,0x24,0x2B,0x5F,0xCB,0xCC,
+	0xFB,0x49,0x79,0x91,0x2C,0x70,0x6F,0x50,0x85,0x87,0xF2,
+	0x0A,0x54,0x3E,0x92,0x65,0x1C,0x48,0xD0,0xC5,0x6E,0xCB,
+	0x8D,0x65,0x9D,0xE0,0x5A,0x47,0x36,0x9E,0x8E,0xAA,0x20,
+	0xDC,0x0F,0x62,0x1B,0x3F,0xC4,0xD7,0x0E,0x8C,0x2D,0x17,
+	0x3C,0xC9,0x67,0xA8,0x77,0x34,0x6E,0xF1,0x06,0x42,0xEA,
+	0x7A,0x6B,0x20,0x9A,0x5D,0x9F,0xC4,0xFC,0xED,0x5B,0x43,
+	0x94,0x74,0x2D,0x30,0x9C,0x93,0xA3,0xAA,0x6E,0x7A,0x6B,
+	0xAE,0x18,0x9B,0xB2,0x5A,0x85,0x1E,0x42,0x73,0xB2,0x9B,
+	0x09,0x8C,0x14,0x9A,0x9A,0x0D,0x26,0xA3,0x78,0x1F,0x09,
+	0x7F,0x86,0x47,0xA6,0x54,0xC1,0x1E,0xB2,0xAD,0x15,0x7A,
+	0x9A,0xC9,0x18,0x1B,0x84,0x9C,0x81,0x1E,0x7E,0xD5,0x58,
+	0xF6,0x9D,0xAE,0xF9,0x4B,0x9B,0xD3,0x76,0xD8,0xE8,0xB9,
+	0x5C,0xA5,0x6E,0xD3,0xBA,0x9C,0x66,0x52,0x2A,0x44,0x57,
+	0xFF,0x5C,0xAD,0x8A,0x2A,0x77,0xB2,0x47,0x60,0xA6,0x2C,
+	0x57,0x85,0x88,0xB2,0x64,0xD3,0x1F,0xE0,0x11,0x06,0xD6,
+	0xD8,0x40,0xF9,0x1F,0x73,0x88,0xE7,0xCA,0x50,0xE1,0x23,
+	0x39,0x30,0xB7,0xC3,0x94,0x25,0x09,0xD1,0x0A,0x7C,0xA1,
+	0xA3,0xC2,0x45,0x5F,0x18,0xB9,0xD0,0xE5,0xC4,0x08,0x81,
+	0x75,0x90,0x7D,0x23,0x95,0x3C,0x08,0x03,0x42,0x75,0x91,
+	0x66,0xF3,0xEB,0x84,0x86,0x72,0x43,0x79,0x8C,0xA6,0x39,
+	0xE9,0x75,0xFC,0x36,0x33,0xFD,0x75,0xAE,0x2A,0x44,0x37,
+	0x35,0xE9,0x52,0xD3,0x0C,0x81,0x9B,0xD7,0xE6,0x98,0x84,
+	0xC8,0xA6,0x87,0x19,0x3C,0xB2,0x7A,0xF0,0x0E,0xDE,0x05,
+	0x45,0xAE,0x4D,0xEB,0xE1,0xAF,0x09,0xFE,0x1E,0xCE,0x71,
+	0xED,0x30,0xB9,0xE8,0x35,0x69,0x6A,0x55,0x04,0x1C,0xBA,
+	0x5A,0xC5,0xB3,0x43,0x74,0xFD,0xD5,0x38,0x59,0x79,0xB9,
+	0x28,0x07,0x17,0x03,0xF6,0xF0,0xE4,0x17,0x62,0x9D,0xF8,
+	0x98,0xF8,0x30,0xFC,0x3D,0x26,0xFE,0x56,0xC4,0xE8,0x71,
+	0x2C,0xF3,0x63,0xCC,0xD5,0xF3,0xE0,0x0D,0xAF,0x58,0xBE,
+	0xD7,0x05,0x19,0x13,0x9F,0xE7,0xAE,0xBE,0xF1,0x2D,0x48,
+	0x98,0xFE,0xA5,0x3A,0x6B,0x0A,0x70,0x8F,0x0B,0xDD,0xCD,
+	0xD3,0xDB,0xC4,0xE5,0x2B,0x6A,0x86,0xDA,0x20,0x63,0x5A,
+	0xF2,0x91,0xBE,0x21,0x55,0x53,0x90,0x26,0xAF,0x5C,0x8A,
+	0x9F,0x94,0x81,0xD1,0x31,0x88,0x45,0x9E,0xEC,0xF0,0xB9,
+	0x43,0xEB,0x10,0xEA,0x13,0x79,0x05,0x9B,0x23,0x59,0x6A,
+	0x5A,0x24,0x0B,0xB8,0x28,0xD8,0xC4,0xD3,0xB6,0x89,0xC6,
+	0x2C,0x2E,0xF0,0x15,0xD2,0xF9,0xA2,0x92,0x26,0x88,0x3A,
+	0xAD,0x33,0xC8,0xCB,0xFC,0x11,0x2A,0x9D,0x2F,0x2D,0xE1,
+	0xB3,0xBD,0x59,0xFA,0xCB,0x3E,0xCE,0x4D,0x64,0xEB,0x16,
+	0xF6,0x7A,0x8E,0x00,0xA5,0xA7,0xA5,0xF2,0x6D,0x80,0x6A,
+	0xE1,0x9B,0x48,0x69,0x5B,0x9D,0x5D,0x6A,0x2B,0x82,0x3B,
+	0xE9,0xBC,0x5B,0x05,0x0E,0xF4,0xAF,0xF9,0x46,0x12,0x9A,
+	0x2C,0xB5,0x22,0xAB,0xAD,0x7C,0xB6,0x22,0x6F,0x6E,0x22,
+	0x96,0xB6,0x36,0xFE,0x19,0x42,0xC8,0xD6,0x6D,0x84,0xBD,
+	0x62,0xBB,0x87,0xC3,0x8F,0x23,0x4B,0x69,0x7F,0x26,0x52,
+	0xDE,0x53,0x44,0x7B,0x45,0x8E,0x5E,0x1A,0x57,0x9B,0x2F,
+	0xA5,0x01,0xF7,0xBC,0x67,0x0C,0xD0,0xBF,0xC7,0xAD,0x4A,
+	0xD5,0xD7,0xF9,0x5C,0x2A,0x3B,0x67,0x83,0xAF,0xB9,0xF6,
+	0xEE,0x82,0x48,0xCE,0x2D,0x64,0xF3,0x26,0x22,0x55,0xF1,
+	0x52,0x0D,0x47,0xEF,0x1F,0xAD,0xAD,0xA1,0xC4,0xF8,0x0A,
+	0x11,0xFA,0xF4,0xB8,0xDA,0x7E,0xBD,0x4C,0xD9,0xEA,0xE7,
+	0xBA,0x71,0x75,0xF6,0x5D,0xAA,0x8A,0xAC,0x0A,0x36,0x6F,
+	0x21,0x12,0x54,0x50,0x5B,0x41,0xD2,0x57,0x4B,0x4E,0x47,
+	0x59,0x00,0xF0,0xB9,0xB6,0x4E,0x14,0x1F,0xEF,0xEC,0x56,
+	0xD5,0xA9,0x9E,0x34,0x70,0x2A,0x37,0xB3,0x8D,0x91,0xBC,
+	0x40,0x19,0x59,0x9D,0xEC,0xA6,0xCF,0x13,0x6D,0xAD,0x6B,
+	0x6E,0x67,0xA5,0x99,0x83,0x91,0x8F,0x67,0x9A,0x37,0x8E,
+	0x16,0xFD,0xF5,0x1C,0xA9,0x4F,0x0E,0x55,0xE2,0x29,0x9F,
+	0xB7,0x22,0x60,0x98,0xB6,0x4A,0x33,0xB8,0xE2,0x4A,0x5E,
+	0x3B,0x72,0xD5,0x5A,0xC9,0xA9,0x6C,0x8F,0xA4,0x1F,0xFB,
+	0x96,0x6B,0x0A,0xCD,0x81,0xF4,0x91,0x1B,0x26,0xB6,0x55,
+	0xA6,0x10,0x12,0x97,0x91,0x72,0xBD,0xC9,0xBC,0xE4,0xDC,
+	0x46,0x36,0x43,0x3D,0xD2,0x40,0xEB,0xBC,0x4D,0x84,0x9E,
+	0x29,0xD2,0x5F,0xEE,0x81,0xA9,0xBC,0x36,0x63,0x15,0x1F,
+	0xF0,0x45,0x32,0xEA,0xEC,0x81,0x7B,0x22,0x19,0x81,0x9A,
+	0x28,0x69,0xBC,0x23,0x72,0x5E,0x6D,0xBC,0x23,0xAA,0xAA,
+	0x5A,0xC5,0xE3,0x6B,0x02,0x31,0x83,0x95,0xAE,0x24,0xCA,
+	0xDD,0x58,0x1F,0x66,0xD5,0x9F,0x40,0x65,0xEA,0xAF,0x82,
+	0x1A,0xD8,0x89,0xD7,0x01,0x7D,0xC1,0x4A,0xA6,0x56,0x3A,
+	0xBC,0x4E,0xD4,0x34,0xF6,0x64,0x97,0x2A,0xED,0xC1,0x4A,
+	0x87,0x32,0x59,0x29,0x96,0x2A,0x79,0x0B,0x57,0x01,0x01,
+	0x15,0x57,0xD4,0x16,0xE4,0xAA,0xB5,0x02,0x97,0x56,0xD9,
+	0xEB,0x32,0xD8,0xCA,0x94,0x27,0x0D,0xB8,0x11,0xB3,0xD7,
+	0xD6,0x78,0x83,0x39,0x83,0x28,0x4F,0xC6,0x5E,0xAE,0xC6,
+	0x1C,0x96,0xD5,0x67,0x77,0x36,0x79,0xDB,0x9E,0xAD,0x64,
+	0x01,0x9E,0x85,0x78,0xEC,0x6E,0xBA,0x42,0x15,0xF1,0x30,
+	0x56,0x6B,0x86,0xD4,0x36,0x1F,0x1A,0xE1,0x6B,0x18,0xCC,
+	0x7D,0x23,0x4E,0x98,0xA6,0x60,0x8E,0x4A,0xC7,0x37,0x11,
+	0x1D,0x21,0xEB,0x5A,0x6E,0xB6,0xD0,0xCA,0x4D,0x13,0xF0,
+	0xED,0x45,0xCF,0x15,0xE0,0x58,0xFC,0x33,0xD8,0x47,0xE6,
+	0x80,0xD3,0x96,0x54,0xF4,0x75,0xFE,0x7A,0xF5,0x26,0x5C,
+	0x00,0x50,0xC7,0x79,0xB8,0x56,0xEE,0x26,0x40,0x74,0x10,
+	0x4F,0x32,0x5B,0x72,0x6A,0x64,0x08,0x01,0x5F,0x0A,0x03,
+	0xA4,0xB8,0xE9,0xAF,0x18,0x00,0xA6,0xAA,0x38,0x2D,0x61,
+	0x4A,0xC4,0xD7,0x56,0xF1,0x1C,0xCD,0xFB,0xD2,0x71,0x21,
+	0x64,0x0B,0x1D,0x2C,0xAB,0xF5,0xDA,0x77,0x9B,0xD0,0x63,
+	0x28,0xF9,0xFE,0xEE,0x55,0x5E,0xEB,0x6E,0xB3,0x45,0xB1,
+	0xFB,0xBB,0x6F,0xF1,0xA6,0xEE,0x36,0x27,0x01,0xAE,0x9F,
+	0xEC,0x34,0x6B,0x7E,0xBF,0x36,0xC4,0x85,0x0E,0x0A,0xFE,
+	0xEE,0x22,0x5C,0x88,0x28,0xF2,0x8E,0xF0,0x77,0x7B,0x20,
+	0x33,0xEF,0xBE,0xD5,0x3B,0x08,0x60,0xB8,0x22,0x11,0x3A,
+	0x28,0xB5,0x8D,0x88,0xA8,0xA9,0x9C,0xB6,0x62,0xEC,0x37,
+	0xED,0xB4,0x10,0x40,0xF2,0xF2,0x8D,0x1F,0x91,0x0A,0x25,
+	0x0F,0x51,0xF1,0xD6,0xAF,0xA4,0x6F,0xFE,0x55,0xCE,0x08,
+	0xD2,0x92,0xDC,0x25,0xB5,0x3D,0x4F,0xFC,0x1E,0xAE,0xF1,
+	0xFD,0x0A,0xD2,0xC6,0x9B,0xB3,0x7F,0x79,0x8F,0x54,0xC3,
+	0x07,0x67,0x40,0xE7,0x07,0x4B,0x05,0x6D,0xD2,0x3B,0xCC,
+	0x5A,0xE0,0x64,0x8C,0x83,0x82,0x38,0x71,0x70,0xDA,0x8B,
+	0x26,0x90,0x30,0x8D,0x54,0x59,0x4C,0xEC,0x19,0x8C,0x5D,
+	0x73,0xF5,0x15,0x5A,0xCC,0x82,0x71,0xAF,0x34,0x10,0x5A,
+	0x6C,0x6D,0x25,0xE7,0x68,0x59,0x9D,0x8A,0xFD,0x92,0xF5,
+	0x54,0xA8,0xC1,0x4C,0xAD,0x41,0x33,0xFA,0xB3,0xF3,0x9C,
+	0xD0,0x8E,0xC4,0x8C,0x2B,0xD2,0xAC,0x5D,0x63,0x8B,0xFB,
+	0x2E,0xB6,0x76,0xC4,0x27,0x6B,0x6F,0x92,0xD9,0xDC,0xF4,
+	0xA3,0x88,0xA8,0xEC,0xD1,0xBA,0x71,0xAB,0xAE,0x8F,0x1B,
+	0xDA,0x99,0x8D,0x07,0xE8,0x5A,0xD0,0xBC,0xD3,0xE7,0xE4,
+	0xD4,0x9E,0x67,0xCF,0x68,0x27,0x33,0xA0,0x69,0x27,0xB2,
+	0x3E,0x51,0x59,0xB8,0x84,0x40,0x87,0x1B,0xD7,0xC8,0x41,
+	0xB7,0x62,0x35,0x36,0x01,0xD9,0xB1,0xB7,0x62,0x61,0xBA,
+	0x9B,0xDE,0x15,0x11,0x0D,0x8C,0x4C,0x03,0x03,0xCF,0x71,
+	0xD5,0x27,0xD1,0xDF,0xF5,0x72,0xC9,0x08,0x09,0x1C,0xD4,
+	0xCB,0xAD,0xBF,0xD6,0xF5,0x75,0x54,0x4F,0xD8,0x87,0xDC,
+	0xEE,0xD2,0x88,0xD7,0x0B,0x76,0x88,0x49,0x86,0xC4,0xAD,
+	0xAD,0xD8,0xC3,0x6D,0x44,0x15,0xD0,0xA1,0x40,0xE2,0x8A,
+	0xFB,0xFA,0x56,0x70,0x84,0x8A,0xFE,0x2C,0x9D,0x87,0x6B,
+	0xE7,0x6C,0x73,0x05,0xF1,0xDC,0x1C,0x68,0x00,0x1F,0xB0,
+	0x54,0x43,0x5A,0xB9,0x30,0x30,0x83,0x78,0xE7,0x81,0xF7,
+	0x2F,0xEE,0x50,0x52,0xF0,0x1C,0xD4,0x2A,0x1E,0x4A,0xAE,
+	0x8A,0xE7,0x13,0x76,0x57,0x87,0x66,0xA3,0x39,0xAF,0x47,
+	0x1F,0x0D,0x53,0x8B,0xC5,0x17,0x9D,0x5A,0x17,0xF5,0x40,
+	0x9E,0x5D,0x04,0x01,0x11,0x43,0x0D,0xCC,0x37,0xE7,0x2B,
+	0x0B,0xF0,0x90,0xAA,0x75,0x36,0x30,0x03,0xC9,0x60,0xD2,
+	0xF1,0x55,0x9E,0x31,0xC8,0xC6,0x36,0x27,0x68,0x4B,0x6E,
+	0xA9,0xCF,0x5A,0x24,0xAD,0x70,0x48,0x7B,0x97,0xA9,0xB3,
+	0x1D,0x52,0x7B,0xC8,0xD6,0x4C,0x14,0xB6,0x9D,0x59,0xD3,
+	0x0F,0xC3,0x52,0xCC,0xD3,0x5A,0xD8,0xC6,0xBC,0x59,0xF9,
+	0x5B,0xC0,0xC7,0xE3,0xD2,0xC1,0x78,0x15,0xF8,0xFC,0xA0,
+	0x67,0xF0,0x2C,0x6F,0x28,0x91,0x8E,0xE3,0x8B,0x90,0xF6,
+	0xE2,0xC3,0x74,0xF9,0x28,0xE3,0x55,0x41,0xD3,0xAA,0xA1,
+	0xB5,0x90,0x05,0xAD,0x1C,0xC0,0x6C,0x14,0xC1,0x85,0xBE,
+	0x2F,0xA2,0x38,0xA9,0x2E,0x2D,0xC2,0x55,0xF9,0x8E,0x3E,
+	0x6F,0x45,0x56,0xA3,0xDA,0x33,0xC8,0x6A,0x3B,0x54,0xD3,
+	0x62,0xAB,0x80,0x59,0x07,0x55,0xDD,0x58,0xBC,0xA7,0x68,
+	0x0F,0x58,0xEB,0xBD,0x98,0xBD,0xCC,0xCA,0x38,0x2C,0x69,
+	0x70,0x20,0xF2,0x10,0x25,0x69,0xBE,0xF4,0x85,0x7F,0x86,
+	0xC3,0x6B,0x9A,0x29,0xB5,0x56,0x41,0x6B,0xE1,0x41,0x89,
+	0x2F,0x66,0xF7,0x81,0x60,0x77,0x5E,0xBE,0xC7,0x4C,0x62,
+	0xDF,0x63,0xA8,0xE8,0x11,0x8D,0xD7,0xA1,0xE6,0xC2,0x50,
+	0x36,0x79,0x33,0xC0,0x69,0xF9,0xC0,0x03,0xD7,0xA9,0x1B,
+	0xC1,0xD4,0x03,0xDC,0xF6,0xC6,0xDB,0xCC,0x2B,0xA2,0xCC,
+	0x67,0x31,0x87,0x14,0x8B,0x9D,0xB4,0x7E,0xBC,0x02,0x8F,
+	0xB8,0xE0,0x9B,0x90,0x0E,0x6D,0xFB,0x56,0x9B,0x4C,0x6A,
+	0x7A,0xCF,0xD5,0xD6,0x71,0x1A,0x62,0xAD,0xC3,0x78,0x6D,
+	0x12,0x3C,0x7C,0xAA,0x9B,0x3A,0xD5,0x8D,0x10,0x04,0x64,
+	0xBA,0xA3,0x0A,0x08,0x4B,0x42,0x61,0x91,0x01,0xE0,0x53,
+	0x99,0x5B,0x8D,0x4F,0x23,0x34,0xAB,0x42,0x87,0xB1,0x2B,
+	0x13,0x7A,0x0D,0xCB,0x5D,0xD5,0x6B,0xD8,0xFE,0xCC,0xB0,
+	0x59,0xBD,0x86,0x7D,0xCB,0xDC,0xC7,0xA2,0x32,0x29,0x3E,
+	0x30,0x2C,0xB4,0xA7,0x99,0xAD,0x63,0xCA,0xA6,0xE2,0x90,
+	0x9B,0xD3,0x9E,0x63,0x41,0x58,0xF3,0xA8,0x03,0xC3,0x82,
+	0x29,0xC1,0xC5,0xE6,0xDE,0xB8,0xAC,0x79,0x74,0x5F,0x50,
+	0xB5,0xD6,0xB7,0x59,0xD5,0x1D,0x54,0xB0,0xEA,0x83,0x61,
+	0x1C,0xA8,0x53,0x24,0x30,0xAF,0x5D,0xC7,0x2B,0x03,0xF2,
+	0xB4,0xCD,0x3A,0x37,0x7D,0x70,0xE8,0x42,0x48,0x56,0x4E,
+	0x72,0x78,0x88,0xCF,0x24,0xA4,0x08,0xA5,0x75,0x0E,0xDF,
+	0x49,0x96,0xAC,0xC4,0x82,0x84,0x78,0x3A,0x46,0xE3,0x02,
+	0x1A,0x64,0x50,0x4D,0xB7,0xFF,0x37,0x3A,0x6D,0x5B,0xC1,
+	0x87,0xB3,0x77,0xB5,0xAE,0xCA,0x1B,0x50,0x79,0xCF,0x70,
+	0x26,0x37,0x4D,0x63,0x2A,0xB9,0x53,0x2C,0x07,0x17,0x42,
+	0x8E,0x5C,0xD4,0x26,0xB9,0xD3,0xE0,0x96,0x3E,0xC1,0xE9,
+	0xEA,0xDE,0x14,0xF4,0x45,0xD9,0x91,0x9C,0x48,0x9B,0xD0,
+	0x6D,0x22,0xA5,0xBE,0xB4,0xD5,0x69,0xEC,0x39,0x1A,0xF4,
+	0x21,0x08,0xE6,0xB5,0xBA,0x28,0x7E,0x4E,0x3A,0x05,0x06,
+	0x90,0x41,0x2D,0xE7,0xB1,0xED,0x48,0x37,0xFD,0x1B,0xDC,
+	0xE8,0x7A,0xBB,0x28,0xCF,0x59,0xEA,0x60,0x32,0x8F,0x58,
+	0x84,0xEE,0xD2,0x56,0xEF,0x81,0xF8,0x44,0x0C,0x5D,0x81,
+	0xDC,0x3F,0x3B,0x16,0x7E,0xED,0x18,0x10,0xDB,0xAB,0x94,
+	0xB8,0x39,0x90,0x0C,0xB0,0x2F,0xBC,0x50,0x2B,0xE4,0x4C,
+	0xBD,0xBB,0x98,0x00,0xDB,0x72,0x73,0x41,0xA0,0x4C,0x5D,
+	0x3D,0x45,0xE2,0x2A,0x82,0x9C,0x74,0x93,0x43,0xAD,0x74,
+	0x6C,0xBA,0xB9,0x60,0xAD,0x8D,0xCD,0xA0,0x9E,0x21,0xFE,
+	0xF2,0x9B,0x0B,0x1C,0x1E,0x1B,0x5E,0x52,0xBD,0xE0,0xAE,
+	0x7E,0xDB,0xC5,0x0E,0x34,0x63,0x96,0xDF,0x4C,0xC2,0x2F,
+	0x10,0x40,0x7B,0x84,0x78,0x11,0xDB,0x4C,0x8C,0x19,0xF2,
+	0x24,0x3A,0x58,0x13,0x0B,0x2D,0x2A,0xF1,0xBC,0x06,0xF4,
+	0xB5,0xAA,0x2E,0x2D,0xB4,0x68,0x83,0xF9,0xB6,0xB3,0xFD,
+	0x47,0x04,0x0D,0xE8,0x23,0x08,0x28,0x06,0xEB,0x14,0x7F,
+	0x80,0xA4,0x15,0x8B,0xBC,0x43,0x01,0xB1,0x02,0xBF,0x57,
+	0x86,0x67,0x26,0xEB,0x72,0xF4,0x39,0x7A,0x5C,0x1E,0x1E,
+	0x62,0x30,0x19,0xF0,0x9B,0x0B,0x74,0x78,0xAE,0x0E,0xF7,
+	0x38,0xB4,0xC9,0xDB,0x12,0xBE,0x55,0x05,0x71,0xCD,0xA4,
+	0xB7,0xB7,0xA1,0xB5,0xDC,0xF4,0x52,0xD4,0x30,0x88,0xBE,
+	0x24,0x0D,0x25,0xD0,0x60,0x9A,0x56,0x85,0xCA,0x40,0xB7,
+	0x11,0xE7,0x03,0xD3,0xF7,0xA2,0xDA,0x11,0x20,0xDC,0x86,
+	0xE9,0x24,0xDA,0xDC,0xFE,0x45,0xF8,0x0C,0xD1,0x34,0xB3,
+	0x84,0x03,0x84,0x55,0xFA,0xF6,0xA9,0xF5,0xFC,0xCA,0x91,
+	0x7A,0xCD,0x17,0x77,0xEA,0x1B,0x88,0xD8,0x77,0x34,0xDD,
+	0xEE,0x1F,0xC2,0xE2,0x8A,0x95,0x66,0xE5,0xF5,0xF0,0x8B,
+	0x44,0xE2,0x2C,0x6D,0xF5,0x03,0x01,0xDB,0xEB,0x00,0xAB,
+	0x16,0x55,0xF2,0x41,0x0E,0x47,0xE7,0x60,0x9D,0xEE,0x31,
+	0xD6,0xE7,0x3C,0x0E,0xFA,0x74,0x16,0xA6,0x33,0x80,0x1C,
+	0xE4,0x4C,0xF5,0x0E,0xC5,0xDB,0xCB,0xAF,0x48,0xE7,0x67,
+	0x09,0xDF,0xA1,0x2A,0xCB,0x99,0x0A,0x33,0xC1,0x21,0x62,
+	0x83,0x26,0xB7,0xAC,0x76,0x6A,0xB6,0x5E,0x64,0xD4,0x63,
+	0xD9,0x5A,0x74,0xB5,0xE9,0xB1,0x7A,0xB9,0xE8,0x27,0x97,
+	0xB5,0x6A,0x59,0xC2,0x85,0xAA,0x56,0xA9,0xBD,0x8A,0xB3,
+	0x97,0xFD,0x35,0x36,0x83,0xBD,0x4D,0x35,0x02,0x19,0xCD,
+	0x01,0xAF,0x17,0x38,0xE3,0x1F,0xED,0xA0,0x1F,0x5E,0x88,
+	0xFF,0xBE,0xCE,0x43,0x4E,0xDC,0xA2,0xAD,0x46,0x13,0xD3,
+	0xAD,0x51,0x88,0xA1,0x98,0x93,0x1A,0x88,0xCF,0x78,0xA0,
+	0x8E,0xFA,0x50,0xA4,0x43,0xFF,0xDE,0x8B,0x05,0x40,0xB1,
+	0x60,0x05,0xC2,0xE5,0x43,0x54,0x7A,0x6F,0xD3,0x63,0x90,
+	0xA8,0xB8,0xA4,0x77,0xD8,0xFE,0xF9,0x5A,0x5C,0xFC,0x0C,
+	0x39,0x1F,0xCB,0xF9,0x3B,0xE9,0x3C,0x13,0x3A,0x34,0x0A,
+	0x8F,0xDB,0x84,0xEE,0x50,0x43,0xEC,0x65,0x02,0x2D,0x06,
+	0x37,0x9A,0x4E,0xCA,0x29,0xCD,0xF6,0x40,0x26,0xD4,0x6C,
+	0xA6,0xBF,0x72,0x04,0xB3,0xA3,0x7B,0xA6,0x01,0x59,0x2D,
+	0x17,0x6D,0x7D,0x85,0x04,0x73,0x62,0x11,0x3B,0xDB,0x1F,
+	0xA1,0xD3,0x79,0x3C,0xE7,0xC0,0x4E,0xCA,0x95,0xF2,0x1B,
+	0x73,0xE2,0xCE,0xC1,0x74,0x80,0xE9,0x53,0xF4,0xAD,0xA1,
+	0x9F,0xAA,0xEC,0x9B,0x2F,0xF6,0x3E,0x28,0x52,0x17,0x60,
+	0x2C,0xD7,0xB7,0xA4,0x04,0x3C,0xE6,0xA1,0xCC,0x87,0x80,
+	0xCE,0xA9,0xBD,0xC0,0xD0,0xED,0xA2,0x77,0xAB,0xA0,0x83,
+	0x9D,0x9E,0x4D,0x92,0xCE,0x2B,0x8E,0x7D,0x35,0x7C,0xA1,
+	0x34,0x25,0x00,0x09,0x72,0xC0,0xD7,0x01,0x91,0x9D,0xF1,
+	0xC6,0x2C,0x9D,0xA5,0x4A,0xAD,0xA1,0xCF,0x21,0x06,0x03,
+	0xE4,0x24,0xBA,0x3B,0x09,0x51,0x1D,0x85,0x41,0x40,0x75,
+	0x98,0xC1,0x10,0x6A,0x15,0xFA,0x90,0xBF,0x48,0xEE,0x2E,
+	0x56,0xA1,0xA7,0xB5,0x2F,0x15,0xEC,0x71,0x60,0x15,0x8C,
+	0xCC,0x71,0x90,0x96,0x39,0x66,0x6B,0xDA,0xC6,0x32,0x6C,
+	0xFA,0xA7,0x81,0xF8,0xCA,0x78,0x5F,0x18,0xA7,0x1A,0xC4,
+	0x68,0x5D,0x30,0xF2,0xEF,0xF1,0x72,0x70,0x6A,0x95,0x63,
+	0xD5,0xF0,0xA9,0x55,0xFC,0xAA,0xA1,0xE0,0x96,0x60,0x86,
+	0x6F,0xC8,0x9D,0xEA,0xB6,0xAF,0xCA,0x9A,0xEA,0xE6,0x56,
+	0xA5,0x62,0xC5,0x05,0x2E,0xF6,0x9E,0xD5,0xF2,0x3D,0x76,
+	0xDD,0xDA,0x90,0x33,0x81,0xC1,0x53,0x5E,0xCE,0x57,0xAC,
+	0xC1,0x14,0x41,0x98,0x5D,0xEA,0xE3,0x7C,0x1D,0x68,0x60,
+	0x5E,0xFB,0xF7,0x62,0x36,0x11,0x5D,0x43,0x98,0xB8,0x47,
+	0x99,0x98,0x92,0xD0,0xC1,0xF2,0x4D,0x7E,0x1F,0x87,0x9F,
+	0xDF,0xCD,0x35,0x45,0x85,0x94,0xA8,0xE0,0x88,0x0A,0xF6,
+	0x28,0xE4,0xEE,0xBE,0x34,0x1E,0x80,0x6B,0x49,0x48,0x70,
+	0x34,0xE3,0xB7,0x33,0x53,0xD8,0x2F,0xCF,0x7E,0xED,0xEC,
+	0x17,0xE0,0x15,0x7A,0x01,0xFD,0x59,0x77,0x60,0x5F,0xCA,
+	0xFA,0x35,0x37,0xAB,0x31,0x9C,0x78,0x7C,0x86,0xB2,0xFB,
+	0x7B,0x5C,0x48,0xD3,0x50,0x52,0x62,0x6C,0xE8,0x35,0x6A,
+	0x1F,0x32,0x7B,0x22,0xD9,0x27,0x48,0x16,0xFE,0x3D,0xE9,
+	0x23,0x8F,0x61,0xCC,0x89,0xD7,0xC4,0x40,0x3F,0xF1,0x7D,
+	0xAF,0x22,0xF1,0x8A,0xC7,0xA1,0x94,0xFC,0xB8,0x22,0x3B,
+	0xA3,0x7D,0xC8,0x74,0xCE,0x61,0x8F,0x1A,0x2A,0x87,0x6C,
+	0xFE,0x8E,0x34,0xF0,0xCC,0xA1,0x7B,0x1C,0xA1,0xAA,0x94,
+	0x10,0x78,0x69,0xB7,0x9D,0x6E,0xB5,0x61,0xCB,0xA7,0x90,
+	0x4D,0x29,0xD9,0x30,0x24,0x67,0xA7,0xB2,0x7F,0xA0,0xA6,
+	0xB1,0xD0,0x91,0xAD,0x5E,0x66,0x91,0x2C,0xEF,0xC8,0x4E,
+	0x08,0x65,0x65,0x3B,0x8C,0xBD,0xAB,0x71,0x8D,0x68,0xD3,
+	0x60,0xA4,0xE9,0x67,0xD0,0x0C,0x8C,0xD1,0x0C,0xD4,0x68,
+	0xCC,0xBD,0x34,0x38,0x5E,0x39,0xA4,0x89,0xCB,0x54,0x1C,
+	0x10,0xAD,0x7A,0x53,0x20,0x37,0x31,0x37,0xF0,0x8D,0xAA,
+	0xDA,0x50,0xC7,0xBC,0xFF,0x36,0x12,0x28,0xFF,0x0D,0xFE,
+	0x43,0x4E,0x8D,0xD1,0xFE,0xD9,0xF8,0x66,0xD0,0x6F,0x72,
+	0x70,0xED,0x26,0x50,0x7E,0x1F,0x00,0x53,0x1A,0xA3,0xF6,
+	0x6C,0x2F,0xDF,0xC6,0xDF,0x07,0x40,0x74,0x84,0x99,0x9A,
+	0x9B,0xD0,0xBE,0x0E,0xD0,0xD1,0x01,0x02,0xE2,0x72,0xCC,
+	0xC9,0x79,0x22,0xC4,0x3B,0x17,0x55,0x96,0x52,0xB2,0x24,
+	0x2D,0xC8,0xA2,0x1E,0x14,0xE9,0x99,0x0E,0x59,0xCD,0xD4,
+	0x36,0x9E,0x64,0x3F,0x72,0x0F,0x86,0x81,0x5E,0x67,0x35,
+	0xFD,0x38,0x0F,0xA2,0x1A,0x0C,0x28,0x71,0xBE,0xE1,0xF0,
+	0xDF,0xAE,0xF9,0x05,0x46,0x86,0x40,0x81,0x74,0xF5,0x90,
+	0x3E,0xDA,0x4D,0x5E,0x8C,0xF2,0xED,0xA4,0xF7,0x43,0x58,
+	0xBA,0x7F,0x60,0xDE,0x74,0x12,0x5D,0x98,0x0A,0x3E,0xCD,
+	0x54,0x26,0x0D,0x6E,0xB5,0x69,0x39,0xAA,0xD6,0x6D,0x21,
+	0xB0,0x03,0x80,0xDC,0x7D,0x97,0x0B,0x5D,0x9B,0x11,0x56,
+	0xDF,0x9E,0xA5,0x6D,0x81,0x25,0x16,0x02,0x2B,0x7A,0x9D,
+	0x56,0xE6,0x46,0x3F,0xF0,0x68,0x26,0x24,0x5E,0x15,0xC6,
+	0x81,0x9E,0x6F,0x52,0xD8,0x07,0x4D,0x39,0x4B,0x6B,0x5C,
+	0x34,0x43,0xEF,0xC9,0x14,0x2B,0xA4,0xF3,0x6E,0x9A,0x91,
+	0x27,0x32,0x1F,0x92,0xEC,0x66,0xBB,0x9F,0x7B,0x18,0x72,
+	0xEF,0xFB,0x2E,0x88,0x7A,0x2D,0xB0,0xEB,0x42,0xBE,0xD3,
+	0x90,0x6F,0x69,0x9D,0xBD,0xCE,0x02,0xA3,0xCE,0x8D,0x2C,
+	0xDB,0x58,0x16,0x90,0x91,0xCA,0x88,0x2C,0xAD,0xEC,0x7D,
+	0x05,0xAC,0x89,0xC0,0xC5,0x38,0xB0,0x77,0x41,0x0A,0x71,
+	0x59,0xE5,0xD6,0x02,0x25,0x0F,0x03,0x9E,0xE4,0x10,0x27,
+	0xE5,0xDD,0x5A,0x30,0xCD,0xE6,0xE1,0xD9,0x9E,0xC6,0x79,
+	0x5C,0xB7,0x4C,0x55,0xF9,0x5B,0x0B,0x10,0x0C,0x29,0xA7,
+	0xF7,0x53,0xE3,0x06,0xC3,0x96,0x62,0xA9,0x1C,0x28,0x0B,
+	0x90,0x32,0xDB,0xA0,0xF4,0x26,0x81,0x14,0xA4,0x50,0xFA,
+	0x31,0x16,0x5F,0xC7,0x53,0xFF,0xB3,0xF7,0x34,0x8E,0x29,
+	0xFE,0x6B,0x1E,0x2F,0x3B,0xA0,0xB9,0x63,0x21,0x07,0xBE,
+	0x3E,0xF1,0xF6,0x1D,0x05,0x90,0x9F,0xCA,0xBE,0x1C,0xDC,
+	0xAB,0x4F,0x17,0x45,0x9C,0x12,0xA0,0xDD,0x2D,0x44,0x5F,
+	0x3F,0xA2,0xD7,0x63,0x12,0x26,0x3F,0x80,0xE5,0xA5,0xE9,
+	0xB8,0x81,0x67,0x38,0x6E,0x16,0x3F,0x07,0xCA,0x6F,0x2B,
+	0xC0,0xB0,0xD7,0x8C,0xBB,0x6D,0x26,0x62,0xE2,0x6F,0x2B,
+	0xD8,0x7C,0x5B,0x81,0x8B,0x3E,0xA5,0xB2,0x03,0x5D,0xC0,
+	0x53,0xD1,0x26,0xB4,0x7F,0x4A,0xBA,0xED,0x25,0x37,0x87,
+	0xE1,0xB2,0x36,0x09,0x61,0x14,0x2A,0xB5,0x77,0x3C,0xA4,
+	0x66,0x71,0x9E,0x24,0x7C,0xB0,0xE6,0x43,0x9E,0x1B,0x8B,
+	0x4D,0xFF,0x0B,0xAE,0x5D,0xC7,0x3D,0xA1,0x1A,0xB8,0xCD,
+	0x96,0xD7,0x09,0x4D,0xE6,0xA4,0x3D,0x7B,0xE9,0x45,0x36,
+	0x3F,0xAD,0x83,0xF9,0xA9,0x68,0x4F,0xC5,0x5E,0xFA,0xA5,
+	0xAA,0x2D,0x14,0x86,0x9C,0xEB,0x75,0x10,0x73,0x89,0x21,
+	0xC2,0x42,0xD0,0x8A,0xE9,0x66,0xB2,0x12,0x43,0x88,0xA3,
+	0xF8,0x8A,0xE5,0xA1,0x53,0x9D,0x0F,0xCD,0xC9,0x81,0x64,
+	0x38,0xAB,0xD7,0x4F,0x2F,0x85,0xF8,0x9E,0x0F,0xBF,0xAE,
+	0x15,0x37,0xFE,0x65,0x4E,0x8E,0x7A,0x99,0xED,0xB1,0x74,
+	0x01,0x35,0x4E,0x35,0xD5,0xB8,0x46,0x57,0xD3,0xA5,0x0A,
+	0x5D,0x6C,0xF9,0xB1,0xCC,0xE1,0xE5,0x5A,0xB9,0x54,0x21,
+	0x24,0xF4,0xAC,0xE5,0x84,0xF5,0x6B,0xEA,0x54,0xE9,0x68,
+	0xD1,0xC1,0xC6,0x6E,0x3F,0xA9,0x2F,0xC6,0x3B,0xA9,0xBB,
+	0x5A,0x3B,0xDA,0x96,0xA3,0xE5,0x6B,0x30,0x1D,0xE7,0xE0,
+	0x52,0xCB,0x4A,0x56,0xC7,0x1B,0x58,0x74,0x19,0x51,0x66,
+	0x28,0xD7,0x30,0xD2,0xF3,0xEC,0xD4,0xF9,0x9F,0x0C,0x36,
+	0x52,0xB7,0xB4,0x27,0xB9,0xA5,0x6E,0x64,0x35,0x02,0xB4,
+	0x53,0x69,0xD9,0x31,0x36,0x59,0x8C,0x0D,0xC4,0x31,0xC0,
+	0xC3,0x22,0x44,0x8B,0xDA,0x70,0x9B,0xC8,0xAE,0xC5,0xA4,
+	0xEC,0xF5,0x2F,0x7B,0xB6,0x92,0xA1,0xAD,0x8A,0x58,0xDD,
+	0xB4,0xE1,0x3F,0x22,0xE4,0xCC,0xB3,0x03,0x6A,0x76,0xBD,
+	0xB2,0xA2,0x06,0x10,0x76,0x73,0xA4,0x2F,0xC6,0x95,0xE7,
+	0xC4,0xF9,0x80,0x92,0xAC,0x7A,0xCF,0xAE,0xA8,0xD1,0x63,
+	0x6F,0xB6,0x53,0x15,0xCA,0xF1,0x4C,0xD9,0x1A,0xCA,0xC1,
+	0x49,0x13,0x3C,0x23,0x7E,0xFD,0xE6,0x6D,0x1E,0x3F,0xD6,
+	0xD9,0xBD,0x61,0x23,0xFB,0xEA,0xCD,0x46,0x71,0x19,0xBD,
+	0x7D,0x70,0xF2,0xE1,0xFA,0x94,0x06,0x2B,0xB4,0x7C,0x5D,
+	0xEC,0xE4,0x97,0xA7,0x60,0xB3,0xA7,0x20,0x96,0xE2,0xA1,
+	0xFA,0xCF,0xB1,0xCF,0xEC,0x8D,0x07,0x36,0xCE,0xA1,0x10,
+	0x07,0x48,0x9F,0x4B,0x6E,0x7B,0x30,0x57,0x72,0x3B,0x82,
+	0xD5,0x66,0xA9,0x8A,0x0F,0xCE,0xC7,0x58,0x3E,0x58,0xCD,
+	0xAF,0x5B,0x61,0xDF,0xA9,0xAA,0x07,0x46,0x0C,0x7A,0x1F,
+	0xDF,0xF8,0xC6,0x04,0x1C,0x97,0xE7,0xDC,0x76,0xA9,0x26,
+	0x05,0x81,0xCB,0x4E,0xD9,0xB7,0x3E,0x4A,0xF4,0xD4,0xAB,
+	0xCF,0xB8,0x9D,0xFD,0xBF,0x27,0xA0,0xF0,0xC7,0x04,0x14,
+	0xFE,0x88,0x80,0x03,0x99,0x7B,0x0F,0x64,0xA1,0x98,0xD0,
+	0x1D,0x80,0x89,0x1F,0xC6,0x3B,0x30,0xF0,0x51,0xE9,0x90,
+	0xB1,0x3D,0x2F,0x7D,0xDC,0x78,0x86,0x98,0x4B,0xF7,0xAC,
+	0xB4,0x6D,0x7D,0x92,0x18,0xEB,0xEF,0x76,0x62,0x7C,0x33,
+	0x4F,0xFB,0xA8,0x89,0x85,0x7F,0x12,0x3F,0xEF,0x25,0xBD,
+	0x97,0x7C,0xD8,0x9B,0xD1,0xF8,0x0E,0x31,0xD7,0x3A,0x4A,
+	0xFF,0xB1,0x92,0x7F,0x08,0xC0,0x89,0x04,0x58,0x95,0x67,
+	0xF4,0x0F,0x1E,0x02,0x31,0xBE,0x1B,0xFF,0xBA,0xF1,0x82,
+	0x4B,0x73,0xA9,0x84,0xF9,0x5C,0x2D,0xFA,0x09,0x0E,0x02,
+	0x5A,0x1E,0x46,0xC3,0x80,0x03,0xC3,0x36,0xB0,0xB2,0x34,
+	0x96,0xEB,0x6D,0xD0,0x08,0xAB,0xEC,0xCD,0xD7,0x86,0xD8,
+	0x02,0x2C,0xA0,0x5B,0x7E,0x87,0xD8,0xF3,0xB4,0x13,0x05,
+	0xCD,0xE5,0xF8,0x82,0xF1,0xB0,0xDA,0x14,0x63,0xE5,0x5D,
+	0xE3,0x35,0x0E,0x4A,0xA5,0x7D,0x45,0xA0,0xD0,0x98,0x7C,
+	0xF3,0x4A,0xA8,0xFA,0xF0,0xF3,0xCC,0xB4,0xA1,0x3B,0x78,
+	0x56,0x69,0x07,0x90,0x64,0x42,0x42,0x7E,0x5C,0xDF,0x21,
+	0x98,0x93,0x23,0xB5,0x22,0x5D,0xA7,0xB5,0x46,0x0F,0x4E,
+	0xB4,0xA4,0x71,0x47,0x99,0x4B,0xE6,0xFC,0x2E,0xBA,0x27,
+	0x56,0x1B,0x04,0x2E,0x75,0x6D,0xFE,0x55,0x4E,0x2A,0xBE,
+	0x01,0xB5,0xBD,0x0F,0x7C,0x59,0x0C,0xFE,0xA8,0xDA,0xFB,
+	0xF2,0x63,0x36,0x04,0x6E,0xAA,0xC0,0x17,0x86,0x6C,0xD2,
+	0x71,0x01,0xFC,0x26,0x56,0xD7,0xCE,0xFC,0x1E,0x3B,0xC1,
+	0x09,0x73,0x46,0x73,0xD6,0xAB,0x19,0xD4,0x46,0x42,0x7B,
+	0xB9,0xF3,0x98,0xEA,0xE6,0x2D,0xD8,0x59,0x41,0x9A,0x3E,
+	0x15,0xF1,0x6B,0x85,0x49,0xFE,0x48,0xBA,0xC7,0x7D,0x20,
+	0x43,0xB9,0xAB,0xCC,0x82,0xAF,0x5A,0x0F,0x3C,0x90,0x51,
+	0x36,0xD0,0x63,0xF5,0x17,0x3E,0x44,0xA2,0xCD,0xA6,0x9D,
+	0x36,0xFE,0x40,0x06,0xBE,0xC0,0x72,0xBC,0xAC,0xC2,0x7B,
+	0xEC,0xD5,0x8C,0xE6,0xAC,0x03,0x19,0xFE,0x9E,0x0C,0xCF,
+	0x74,0x39,0x2B,0x73,0xE2,0x67,0x50,0x44,0xB2,0x5E,0xCD,
+	0xC7,0x8B,0x46,0x56,0xE8,0x4F,0x7B,0x88,0x98,0x80,0x8C,
+	0x00,0x99,0xD2,0x1F,0x60,0x16,0x6F,0x96,0x8B,0x36,0xA8,
+	0x8E,0x96,0x25,0x20,0xA9,0xFC,0x41,0xD2,0xDF,0x63,0xDE,
+	0x51,0x31,0x14,0xDA,0x21,0x9D,0xAE,0x52,0x21,0xFF,0x21,
+	0x62,0xB3,0x1D,0xFC,0xD3,0xDD,0x6A,0x68,0xDF,0xF0,0x86,
+	0xD0,0x89,0xB5,0x85,0xBF,0xCB,0x59,0x5B,0xF8,0x48,0x0E,
+	0xEB,0x3F,0x90,0xF5,0x3D,0x9A,0x03,0x88,0x55,0xEA,0xDA,
+	0xC2,0xC7,0x72,0xA6,0xF1,0x8F,0xE6,0x78,0xC6,0x6C,0x02,
+	0x08,0xA1,0x65,0x2A,0x80,0xA7,0xA8,0x50,0x8C,0x25,0xFE,
+	0xF2,0x47,0x73,0x40,0x8E,0x0C,0x75,0x6A,0x29,0x64,0x42,
+	0x7C,0xD6,0x56,0xC0,0xAE,0x60,0x05,0x75,0xFD,0xF0,0x52,
+	0xB1,0x32,0x05,0x2F,0xB6,0x58,0xEC,0xB1,0xE5,0x0F,0x8C,
+	0xAE,0xC2,0xC3,0xED,0x18,0xA0,0x24,0x6B,0xB4,0x9B,0x1E,
+	0x24,0xD1,0x96,0x2D,0xBF,0xCF,0xD1,0x30,0x87,0xCA,0xE4,
+	0xFC,0xAE,0x33,0xAA,0x6B,0xA1,0xFC,0xA7,0x1C,0x17,0xFD,
+	0x1D,0x2E,0x53,0xA7,0xD0,0xE6,0x68,0xDC,0xFB,0xA7,0x5B,
+	0x1E,0xD7,0x50,0x01,0x40,0x76,0xE0,0x91,0x0A,0x79,0xEB,
+	0xC6,0x9C,0x36,0xFE,0x89,0x1C,0x42,0x76,0x90,0x2D,0xEB,
+	0x73,0xB6,0xAC,0xCB,0x81,0x10,0x96,0x53,0xB7,0x34,0xE5,
+	0x40,0x0C,0x0B,0xD7,0x87,0x73,0x8C,0xB5,0x8B,0x5E,0x97,
+	0xAA,0x87,0x43,0x37,0xC8,0xA4,0x52,0xEB,0x69,0xE5,0x1D,
+	0x7B,0xFC,0xDE,0xC9,0xB2,0xE9,0x9A,0xE2,0xF7,0xA5,0x43,
+	0xF0,0x3C,0x76,0xA1,0x4B,0x36,0xEB,0x0F,0xDA,0xCA,0xC6,
+	0x52,0xB1,0x76,0x80,0x4C,0xAE,0x81,0xB2,0xAC,0x52,0x77,
+	0xB4,0x36,0x09,0xBF,0x4B,0x17,0xA9,0x05,0xFF,0xA6,0xF5,
+	0xCD,0xDF,0x5B,0x7A,0xD7,0x48,0x80,0x0D,0x3B,0x8A,0x5C,
+	0x7C,0x18,0xB0,0x87,0xEB,0x9C,0xF0,0x21,0xC6,0x29,0x5D,
+	0xE3,0x64,0xD7,0x96,0x57,0x14,0xAB,0x8B,0x2E,0xB2,0x6C,
+	0xD4,0x3C,0xA3,0xBE,0x60,0xDC,0x4F,0xAA,0x34,0x8F,0x20,
+	0x96,0xE9,0xC4,0xE2,0x05,0xE7,0x37,0x2A,0x2C,0xC6,0x56,
+	0x8C,0x4F,0x6B,0xEE,0x0F,0x7B,0xA1,0xB6,0x48,0x69,0xA1,
+	0xEF,0xA9,0xF8,0xF5,0x87,0xF8,0xF5,0x69,0x27,0x26,0x66,
+	0x98,0xE3,0xF9,0xEC,0x81,0xDB,0xCC,0x5F,0x80,0x8E,0xB8,
+	0x92,0xEF,0x4D,0x43,0xAE,0x0D,0xD1,0xD4,0x7C,0x82,0xDF,
+	0x65,0xB3,0xE3,0x2A,0x52,0x00,0xF2,0x72,0xB6,0x11,0xD7,
+	0xBB,0x0A,0xC5,0xD2,0x43,0x37,0x04,0x7B,0xBD,0xCB,0x01,
+	0x1C,0xAE,0x42,0x65,0xB0,0xD5,0x02,0x2D,0x67,0x0C,0xD9,
+	0xC2,0x41,0x0C,0xDF,0xEA,0x71,0x05,0x3C,0xC3,0xC4,0xD2,
+	0x7C,0x48,0xB5,0x93,0x74,0x76,0xCA,0x2F,0x21,0xC6,0xF2,
+	0x6B,0x39,0x6F,0x0A,0xE4,0xF8,0x2A,0x4B,0x58,0x4F,0x2B,
+	0x6F,0x19,0x2A,0xE7,0xA8,0x5A,0xB2,0x6E,0x24,0xE5,0xB7,
+	0xF3,0xDA,0x6B,0xC6,0xF9,0xDA,0xE3,0xBC,0x28,0x3B,0x13,
+	0x64,0x56,0xFE,0xD6,0x47,0xE3,0x67,0x95,0xAD,0xFE,0xF2,
+	0xBA,0x82,0x54,0x26,0xAE,0x82,0x78,0x5E,0xC6,0xCA,0x6D,
+	0xAA,0xD3,0x72,0x77,0x16,0xD5,0xCE,0x57,0xC5,0xBD,0xFE,
+	0xF2,0x67,0x20,0xED,0x71,0xB4,0xF2,0x70,0xD9,0xF4,0x6C,
+	0x8E,0x02,0x3D,0xC5,0x76,0x60,0x18,0x0C,0x42,0xB7,0x56,
+	0x62,0xA3,0x9F,0xAB,0x98,0x7B,0xD1,0x7F,0xC2,0xC5,0x45,
+	0x5D,0xDF,0x8A,0xFA,0xEA,0xAC,0x56,0xCC,0xA6,0xBE,0x64,
+	0xA4,0x36,0x81,0x1B,0xD9,0xF2,0x6C,0x4E,0xFC,0x3B,0xE6,
+	0x79,0x36,0xC8,0xE5,0x06,0xEE,0x20,0xA1,0x11,0xE0,0xA0,
+	0x23,0x17,0x5E,0xEA,0x3C,0x74,0x9D,0x27,0x59,0x2A,0xF7,
+	0x39,0x93,0xD5,0xA0,0x2F,0xEA,0x4D,0x06,0x4B,0x8F,0x0A,
+	0x08,0x51,0xB3,0xE4,0x8B,0x4A,0x10,0x9F,0x7A,0xBE,0x09,
+	0x59,0x1D,0x2D,0x9E,0xF0,0xB4,0x13,0xDE,0xB0,0xF4,0xA9,
+	0x7F,0xEA,0x74,0xEF,0x49,0x30,0xE6,0xC5,0x6D,0x0F,0x7D,
+	0xE0,0xFD,0x74,0x76,0xDC,0xAB,0x19,0xE0,0x6B,0x76,0xE0,
+	0x27,0x7B,0x49,0xEF,0xCB,0x6E,0x7C,0x5E,0xF3,0x60,0x6D,
+	0x69,0xEC,0xCA,0xA1,0x41,0x2E,0xB8,0xD8,0x1C,0xBC,0x81,
+	0x8B,0x3B,0x94,0xD6,0x5C,0xC2,0x0A,0xA5,0x9E,0x60,0x25,
+	0x1F,0x2C,0xD3,0x8A,0xF5,0xB9,0xA6,0x5A,0x26,0xD5,0xBA,
+	0x03,0xC5,0xAF,0x32,0xA4,0x06,0x6F,0x34,0x6B,0x9D,0xF4,
+	0x1C,0x59,0xA1,0xF9,0xD7,0xC9,0x30,0xCE,0x0F,0x0C,0xFB,
+	0xFD,0xBA,0x3D,0xDA,0xE3,0x08,0x78,0xCC,0x7B,0x17,0x26,
+	0x8D,0x61,0x43,0xF5,0x3E,0x9C,0xE5,0xAE,0xBE,0x31,0xEF,
+	0xA9,0xF5,0x55,0xE7,0x82,0x55,0x91,0x75,0xEE,0x68,0x9B,
+	0x70,0x4E,0xBA,0xA7,0x55,0x38,0x7F,0xBC,0x55,0xF8,0xF6,
+	0x00,0x18,0x65,0xAD,0x70,0xA1,0x6C,0x44,0xED,0xE0,0xB2,
+	0xC2,0x55,0xFD,0x5B,0x85,0x8B,0x25,0x6D,0xC2,0xA5,0x87,
+	0xF9,0x60,0x55,0x47,0xAB,0xD0,0xB5,0xBF,0x4D,0xF8,0x1E,
+	0x82,0x2F,0xC7,0x47,0x00,0xDF,0xCF,0x3E,0x63,0x08,0x2A,
+	0xE4,0x55,0x4B,0x56,0x69,0xB9,0x59,0x9A,0xC7,0x49,0x37,
+	0xF2,0xAA,0xD7,0x2E,0x79,0x1D,0x4D,0xB3,0x32,0xDE,0x5D,
+	0x9D,0xA2,0xD6,0x44,0xF2,0xAA,0x6F,0x7C,0x4A,0x3A,0xFB,
+	0xAE,0xCF,0x1E,0xB4,0x06,0x97,0x9B,0x83,0xF3,0xB8,0xE0,
+	0x8D,0x7C,0xD0,0xEB,0x58,0x37,0x2B,0xE3,0xE1,0x59,0x59,
+	0x0F,0xCF,0xB2,0x3F,0x3C,0x2B,0xE5,0xE1,0x59,0x69,0x81,
+	0x7D,0x5C,0x1A,0xF8,0xE5,0xA1,0xCB,0x63,0x16,0x6B,0xAE,
+	0x0C,0x69,0x2B,0xCF,0x55,0x0E,0x98,0x18,0xB1,0xAE,0x2C,
+	0x07,0x80,0x98,0x4B,0xE1,0xB1,0xAE,0x66,0x12,0xBF,0xA7,
+	0x9B,0x13,0x88,0x2E,0xF1,0x59,0xDE,0xAE,0x26,0xC1,0x92,
+	0x6D,0x39,0xA1,0x07,0x9F,0xCB,0xD9,0x00,0x1D,0x20,0x53,
+	0x6A,0xED,0x6C,0xC7,0x5D,0xE0,0x2B,0x1A,0xBE,0x6A,0xE3,
+	0xB7,0xC1,0x3C,0x13,0x2C,0x79,0x94,0xC4,0x0D,0x06,0xC3,
+	0x3D,0x3C,0x3A,0xC2,0x8F,0x41,0x5D,0xB2,0x3E,0x8D,0xC5,
+	0xC5,0x5E,0xCD,0xD7,0x40,0x6A,0xC6,0xB4,0x60,0x93,0xEE,
+	0x30,0x70,0x08,0x30,0x98,0xD7,0xA8,0x1B,0x75,0x3B,0x16,
+	0xB8,0xAB,0x79,0x48,0x93,0xF2,0x6C,0x52,0x8D,0x3D,0xD0,
+	0x33,0x7C,0xD5,0x12,0x7F,0x8F,0xB9,0x76,0x91,0x24,0xA4,
+	0x48,0x55,0x69,0xC9,0xEF,0xAF,0xCE,0xF4,0xE3,0xF2,0x75,
+	0x72,0xAB,0x75,0xCC,0xEC,0xCE,0x4F,0x3B,0xDB,0x03,0x9F,
+	0x92,0xF5,0x75,0xC7,0x4F,0xA5,0xFF,0xAE,0xE8,0x70,0xE7,
+	0xC5,0xDF,0x75,0x5E,0x5C,0x9B,0x2D,0x9C,0x4A,0x52,0xBE,
+	0xC5,0x27,0xB8,0x85,0xD1,0xF1,0xDD,0xFA,0xAA,0xE3,0x9D,
+	0x9F,0x5A,0x3E,0x8C,0x54,0x85,0xB8,0xD1,0x8E,0x95,0x1C,
+	0x37,0x4D,0xB1,0x98,0x05,0x6E,0xFB,0xC9,0x6F,0x76,0x90,
+	0xED,0x36,0x48,0xD1,0xB5,0x55,0x80,0x14,0xB6,0x90,0xE1,
+	0xB3,0x3B,0xBC,0x18,0x22,0x6D,0x54,0xAC,0xEC,0x75,0x0D,
+	0xFD,0x7D,0x46,0xFB,0x0E,0x93,0x6B,0xC7,0x2D,0x2E,0x5A,
+	0xA3,0xC6,0x7F,0xB0,0x90,0x2D,0x5E,0x42,0x17,0xC4,0x92,
+	0xCA,0x1F,0x96,0x04,0x7C,0x0E,0x47,0xCC,0x05,0x33,0xA4,
+	0xA1,0x6A,0xEF,0xCA,0xA9,0xF4,0xDE,0xA9,0x5C,0x6D,0xE7,
+	0x6A,0x5D,0x7B,0x53,0x4B,0xE4,0xE2,0xB6,0x50,0xA5,0x3A,
+	0xF1,0xCB,0xD0,0x3C,0x75,0xE2,0x7F,0x8A,0xDE,0x89,0x05,
+	0x40,0x58,0xA6,0x1D,0xFA,0x00,0x6B,0x1D,0x0A,0x47,0x2E,
+	0x3E,0xBB,0xD2,0xF4,0x4C,0x6F,0x5E,0x12,0x2B,0xAF,0xE2,
+	0x21,0xE9,0x0D,0x9D,0x88,0xE0,0xAB,0x2C,0x1E,0xEE,0x54,
+	0xD2,0xF6,0xEB,0x0E,0x85,0x2F,0xFE,0x75,0xA5,0x69,0xBB,
+	0xD6,0x79,0xA1,0xD9,0xB5,0xD3,0xB9,0x1C,0xF8,0x3D,0x2D,
+	0x8F,0xD2,0x05,0x44,0xA4,0x2A,0xE8,0xF0,0x8E,0x26,0x50,
+	0x08,0x46,0x4F,0x13,0xB4,0x52,0x98,0xC9,0x18,0xDA,0x57,
+	0x05,0x08,0x1A,0x05,0x7E,0x25,0x7F,0x99,0x1D,0xC9,0x8B,
+	0x14,0xB7,0x68,0x9A,0x83,0x4E,0xB8,0x7A,0x69,0xF9,0xB6,
+	0xCA,0xF2,0xFD,0x7C,0x5D,0x74,0xE6,0x33,0xD7,0x15,0x9D,
+	0x2F,0xEA,0x62,0x6C,0xAC,0x96,0xF3,0x96,0xAE,0x67,0x22,
+	0xB1,0x4F,0x3E,0xDB,0xF5,0x9D,0x99,0x6D,0xF1,0x3A,0x48,
+	0x55,0x5C,0x73,0x99,0xD1,0x11,0xA0,0x13,0xAE,0xBE,0x6C,
+	0xEC,0x03,0xD7,0x70,0x45,0xEF,0x17,0x1D,0x6E,0xAE,0x38,
+	0x30,0x4C,0xEF,0x5B,0xFA,0xE7,0x0D,0xF9,0xCE,0x56,0x02,
+	0x73,0x9C,0xB6,0xF9,0x25,0x1D,0x4D,0x3E,0x28,0x5D,0x00,
+	0x88,0xC9,0xF3,0x9B,0xCD,0xB5,0x39,0xC3,0xA0,0x22,0x82,
+	0xFD,0x79,0x3F,0x78,0x57,0xB6,0xBD,0x3F,0xEE,0xB2,0x9E,
+	0x03,0xB5,0x74,0x88,0xC6,0x46,0xC8,0x55,0x9D,0x82,0xDD,
+	0x4F,0x58,0xF8,0x81,0x09,0x0F,0x40,0x3B,0x5B,0xCF,0x13,
+	0xCF,0x55,0xDA,0x97,0x09,0xE9,0x5D,0x2A,0xA6,0x92,0xAB,
+	0xFB,0x85,0x5F,0x26,0xC0,0x96,0xF3,0x5C,0x21,0xBB,0xF0,
+	0xDB,0xF7,0x91,0xF0,0x56,0x52,0x4D,0x1F,0xEB,0x10,0x95,
+	0x5C,0x56,0x8D,0x28,0x9D,0xA9,0x21,0xDE,0x15,0x5E,0xAB,
+	0xED,0xC3,0x62,0xEE,0x49,0x1F,0x24,0xEC,0x80,0x50,0x4B,
+	0xFD,0x22,0x76,0xD6,0x67,0x6D,0x84,0x9D,0x03,0x7A,0x1E,
+	0xE4,0xE5,0x35,0x7E,0x48,0xF2,0x81,0xA3,0xDF,0x93,0x37,
+	0x42,0x25,0xE0,0x9D,0xD9,0x62,0x5F,0x35,0xBD,0x3D,0x82,
+	0x47,0x54,0x1C,0x50,0x62,0xF6,0x40,0xEE,0xCA,0xA9,0xEC,
+	0x48,0x5E,0x36,0xD3,0x29,0x0D,0x51,0x98,0xFE,0xA4,0x03,
+	0x9D,0xBD,0x5A,0x3F,0x04,0xF0,0x2C,0xE0,0x6F,0x49,0x06,
+	0x5B,0x38,0x3B,0xDA,0x78,0x52,0xED,0x02,0x0B,0xE0,0xB1,
+	0xB5,0x27,0x20,0x78,0x6B,0x8B,0x3B,0x12,0xBC,0xC3,0x04,
+	0xFD,0xA2,0xF3,0x1D,0xFC,0xE7,0x7B,0x77,0x98,0x3B,0xDF,
+	0xE1,0x88,0xD7,0xBC,0x83,0x40,0xE8,0xF8,0xF2,0xF9,0x82,
+	0x2A,0xDE,0xF1,0x4E,0xF3,0x74,0x30,0xF9,0x40,0x5C,0x8D,
+	0x63,0x5F,0xBD,0x10,0xF8,0x11,0x6A,0x57,0x2A,0xF1,0xB3,
+	0x18,0x50,0x88,0x62,0x53,0x5C,0xE8,0x89,0x3F,0x0B,0xA5,
+	0xE7,0x5A,0xB5,0xA9,0x7D,0x62,0x02,0x48,0xBC,0xD6,0x91,
+	0xDE,0x5C,0x6B,0x0D,0xD1,0xB2,0x99,0x44,0x4C,0xBF,0xC7,
+	0x8A,0x4C,0x6F,0x95,0xAA,0xA2,0xD8,0xD1,0x6C,0x52,0x54,
+	0x3A,0x1E,0x79,0x01,0x42,0xB1,0x31,0x65,0xA9,0x1E,0xEB,
+	0xF6,0x93,0x97,0x94,0xC1,0x27,0xCF,0xF3,0x8B,0xB4,0x7F,
+	0x35,0xF4,0x32,0xAB,0x71,0x29,0xB2,0x5A,0x66,0x8B,0x84,
+	0x84,0xCB,0xDB,0x4B,0x7B,0xBC,0x66,0x65,0xA3,0x92,0xCF,
+	0x10,0x3A,0x3F,0x1D,0xD4,0xE2,0x5A,0x80,0x28,0xCF,0xF6,
+	0x40,0x62,0xAB,0xB9,0x96,0x87,0x51,0x9D,0x65,0x45,0x3D,
+	0x4F,0xF4,0x7A,0xBB,0x19,0x7D,0x9D,0x0C,0x54,0x68,0x58,
+	0x4F,0xEF,0xB0,0x69,0x76,0x83,0x29,0xA0,0x13,0xF7,0xC6,
+	0xDD,0x96,0x1E,0xDD,0xD5,0xCF,0x95,0x6A,0xF8,0x26,0xF4,
+	0xF6,0xB5,0x6C,0x5E,0xE3,0x17,0xB9,0xE8,0xD7,0xDD,0x4B,
+	0x62,0x23,0x06,0x67,0x34,0xE9,0x93,0x89,0x2D,0x30,0x9B,
+	0x5D,0x78,0x69,0xBD,0x57,0xC5,0xF7,0xF2,0xF1,0xB6,0xF3,
+	0x50,0xD1,0xF7,0x0F,0x75,0xB2,0x0F,0x0C,0x99,0x9F,0xB9,
+	0x4E,0x1F,0x48,0x8F,0x1A,0x03,0x29,0x82,0xDB,0x48,0x35,
+	0xEC,0x40,0x8F,0x27,0xE9,0x85,0x69,0x7B,0x3D,0x03,0x0A,
+	0x5A,0x3C,0x99,0x2F,0xC2,0x4D,0x26,0xDC,0xD8,0xA7,0x9D,
+	0xF2,0xD8,0x0B,0xBE,0xF4,0x7E,0x83,0xAA,0x08,0xEB,0x2B,
+	0xA3,0xF1,0xC3,0x0F,0x07,0x5C,0x3B,0x8E,0xB7,0x4E,0x5D,
+	0x68,0xE7,0x21,0xB0,0x1F,0xCE,0x89,0xE0,0x34,0x42,0xCB,
+	0xD5,0xA2,0xBD,0x7D,0x46,0x6B,0x24,0x01,0xD5,0xC7,0x5D,
+	0x7C,0x26,0x7E,0x2D,0x43,0xC3,0x61,0x23,0x18,0x19,0xEF,
+	0xFC,0xCD,0x2D,0x2F,0x84,0x86,0xC0,0x8C,0x3B,0xF8,0x25,
+	0x4F,0xC7,0xB4,0x77,0x6B,0xF9,0x69,0xEF,0xAC,0x32,0x8F,
+	0xCE,0x9F,0xF6,0xAF,0x5A,0xDB,0xB4,0x4F,0x57,0x59,0xFC,
+	0x4A,0x3E,0xE8,0xF8,0xAF,0x98,0x0C,0xC3,0xE7,0x14,0xB7,
+	0x44,0x98,0x80,0xDF,0x75,0x1E,0x9C,0xB3,0xE2,0x07,0xD2,
+	0x35,0x0F,0x37,0x44,0x6A,0x9F,0xD8,0x72,0xE1,0xA5,0xA2,
+	0x4F,0xA5,0x0F,0xFA,0x28,0x0C,0x8E,0x2E,0xF2,0x5F,0x94,
+	0xC6,0x6F,0x94,0x7F,0xC0,0x48,0x7C,0xDC,0x43,0x1F,0x80,
+	0xE2,0x1F,0x5C,0xDC,0xDE,0xAB,0x7C,0xF3,0xCC,0x3E,0x99,
+	0xD2,0x82,0xEF,0x97,0xEF,0x0D,0xB5,0xC2,0xBC,0x15,0xDA,
+	0xF3,0x71,0xC6,0x9A,0x13,0x70,0xB3,0xE6,0x04,0xF7,0xC8,
+	0x95,0xD9,0x15,0x57,0x6E,0xD7,0xD6,0x08,0x1E,0x27,0x78,
+	0xA6,0xE0,0x1C,0x1E,0x94,0x38,0xEB,0x82,0x9F,0x33,0x84,
+	0x28,0x42,0x35,0xE8,0x8D,0x6A,0x41,0x1C,0xB2,0x62,0x6F,
+	0xC9,0x5A,0xEB,0xEC,0x68,0xD5,0x59,0xEF,0x38,0x3C,0x5B,
+	0xB3,0x7E,0xCD,0x5D,0x6A,0x51,0x17,0xFE,0xBA,0xD8,0xCA,
+	0x96,0x9B,0x7D,0xD9,0x0B,0xC8,0x4C,0x1A,0x03,0x93,0xEF,
+	0xDC,0xFA,0xB7,0xEF,0x52,0xF1,0x98,0xCD,0x5E,0x3E,0x82,
+	0xB7,0x41,0x1F,0x28,0x0E,0xC6,0xE4,0x5F,0x00,0x03,0x66,
+	0x95,0x8D,0xF0,0x64,0xEA,0x0C,0x1B,0xCE,0xD1,0x17,0x54,
+	0x25,0x1C,0x3E,0x67,0x09,0xD6,0x9D,0x7F,0x01,0x0A,0xBE,
+	0x06,0xD4,0xE2,0xF7,0x83,0x55,0x17,0x82,0x55,0xD1,0xB5,
+	0x55,0xDF,0xB5,0x09,0x5D,0xAA,0xDA,0x26,0x74,0x40,0xFF,
+	0x32,0xBD,0x30,0xF1,0x4B,0xE9,0xA0,0xD4,0x0E,0x96,0xF6,
+	0xF7,0xDC,0xBC,0xB2,0x5F,0xE8,0xE9,0x24,0x67,0xA0,0x27,
+	0xB7,0xCE,0x12,0xDE,0x6C,0x61,0xE7,0x9F,0xA6,0x3C,0x10,
+	0x7E,0xC2,0xE2,0xBF,0x4C,0x56,0x75,0x05,0xAA,0xA2,0x26,
+	0xE5,0x20,0xDE,0xFE,0x07,0x6E,0xCD,0xCA,0xBB,0x78,0x7B,
+	0xD2,0xEF,0xFB,0xAE,0xC8,0x63,0x59,0xEB,0xFE,0x4E,0x79,
+	0x2D,0x70,0x47,0xF4,0x0B,0x85,0x83,0xB2,0xFC,0xD7,0xAC,
+	0xCA,0x5F,0xB0,0x74,0x5E,0x27,0x84,0x56,0xC4,0x7B,0x15,
+	0xC0,0xEC,0xAF,0x99,0x94,0xDF,0x87,0x6F,0xB0,0x80,0x69,
+	0x4B,0x24,0x6B,0x40,0xE0,0xCC,0xFE,0xCB,0xE6,0x95,0x59,
+	0xC9,0x2D,0xBF,0xE6,0x61,0x22,0x05,0x7E,0x41,0xA1,0xEB,
+	0x35,0x4B,0xF8,0x97,0xAA,0xFF,0x32,0xE7,0xFD,0x24,0x28,
+	0x74,0x44,0xDF,0x0D,0xDF,0x8A,0x0F,0x2B,0xF7,0xBF,0xC6,
+	0xA9,0x42,0x47,0xF8,0x46,0xF5,0xD1,0xD1,0xE3,0x37,0x00,
+	0xD1,0xAA,0x01,0xAF,0x99,0x1F,0x12,0xD0,0xCD,0x1D,0x3A,
+	0x74,0x42,0x3A,0x88,0x5F,0xF9,0xB0,0xEC,0x31,0x09,0x5D,
+	0xE1,0x62,0x46,0xFB,0xC7,0x87,0xD8,0x9A,0xFF,0x6B,0xF1,
+	0x65,0x1D,0xE1,0x5C,0x15,0x64,0x64,0x84,0x6F,0x57,0x1B,
+	0xAB,0xA2,0xC4,0x04,0x9A,0x7E,0x13,0x16,0xD5,0xD7,0xED,
+	0x8A,0xE3,0x75,0x07,0xFC,0x65,0xBC,0x1A,0x36,0x1F,0x6B,
+	0x15,0xBE,0x23,0x6B,0xDD,0x3D,0xC5,0x87,0xD7,0xBA,0xBB,
+	0x35,0x2D,0x95,0x8C,0xD7,0x1D,0xAD,0x42,0xB7,0x09,0xA0,
+	0x1A,0x60,0xE3,0xEC,0xD9,0x41,0x98,0x02,0x84,0x28,0xBE,
+	0xC0,0x53,0x22,0xE5,0xC0,0xA3,0x8F,0x5B,0xEF,0x7B,0x03,
+	0x5A,0x6A,0x1C,0xA4,0xE1,0x45,0xB8,0x27,0xE0,0xBD,0x0A,
+	0x1B,0xA5,0xAA,0xEB,0xD4,0xC0,0xC0,0xF7,0xAA,0x07,0xDD,
+	0xD9,0x08,0x7C,0x3B,0xF9,0x95,0xF1,0x8A,0xF9,0x95,0xFC,
+	0xD0,0x1E,0x9A,0x14,0x3D,0xF9,0x7D,0xF8,0xBA,0x28,0xA8,
+	0xC3,0x2D,0x74,0x55,0x87,0xDA,0xF0,0xDF,0x1E,0xE9,0x76,
+	0x2D,0xA2,0xBE,0x4E,0xA7,0x4D,0x72,0x77,0x24,0x1F,0x6E,
+	0xB0,0x84,0xBF,0x25,0xE1,0x08,0xEA,0x02,0xC2,0xD6,0xFB,
+	0x76,0x81,0x2B,0x29,0x51,0xA7,0x5C,0x7B,0x6D,0xB0,0x86,
+	0x03,0xD1,0xF9,0xC4,0x93,0x51,0x22,0xE5,0xB2,0x47,0xA7,
+	0x8D,0xDE,0x7F,0x79,0xC7,0xB4,0xED,0x4E,0xDB,0x52,0x5A,
+	0x7B,0xB9,0xA4,0xD5,0x4A,0x40,0x5D,0x02,0xB5,0xEB,0x59,
+	0x5F,0xB5,0x0B,0x1C,0xC2,0x47,0xC0,0xB0,0xF4,0x50,0x83,
+	0x59,0x3A,0x14,0xFE,0x33,0x01,0x66,0xB1,0x8A,0xA0,0xFD,
+	0x9D,0x36,0xD0,0x7C,0xE2,0x97,0x25,0x41,0xEB,0x4E,0x13,
+	0x09,0xEF,0xEC,0x2D,0x67,0x42,0xBC,0xA9,0x25,0xD2,0x74,
+	0x44,0xC3,0x08,0x5A,0x49,0x2E,0xD9,0x87,0x0F,0xDC,0xBA,
+	0x96,0xE4,0x36,0xAF,0x35,0xCF,0xB6,0xDB,0xEC,0xA4,0xC5,
+	0x97,0x4B,0xAB,0x3A,0xEA,0x2C,0x52,0x55,0x87,0xB2,0x3A,
+	0x46,0x0B,0x4F,0x10,0x27,0x59,0x76,0xF2,0xA4,0x7A,0xC1,
+	0xFA,0x9A,0x37,0x16,0xE1,0x3B,0x95,0x57,0x08,0xB8,0x53,
+	0x1F,0x7D,0x1E,0xA6,0xC9,0x24,0xD9,0x4E,0x80,0x8F,0x43,
+	0xB1,0xC1,0xAF,0x9D,0x9D,0xD9,0x7B,0xD9,0xC1,0x14,0x01,
+	0xA1,0x60,0xA6,0xFE,0x92,0xBB,0x2B,0xF9,0xB0,0x2F,0x93,
+	0x1E,0x8D,0x14,0xFA,0xA7,0x8F,0xF1,0x9A,0xAE,0x2B,0x3A,
+	0xE4,0xB3,0x04,0xDD,0x17,0x42,0xC2,0x77,0xD8,0xC9,0x11,
+	0xE8,0x49,0x09,0xDC,0x73,0xC1,0x14,0x70,0x5F,0x20,0xF3,
+	0x0B,0xD7,0x5A,0xE9,0x0B,0x11,0x18,0xF1,0x3E,0x5C,0x44,
+	0x93,0xAD,0x28,0x6A,0xBA,0x95,0x78,0xFB,0x85,0xEE,0xE8,
+	0xF1,0x47,0x7E,0xE9,0x4D,0x0D,0xF8,0x2E,0x90,0x06,0x2B,
+	0xFB,0xCA,0xBB,0x32,0xC8,0x1F,0xB9,0x0F,0x92,0xF6,0xC8,
+	0x12,0x6F,0x26,0x18,0xBF,0xE2,0xFA,0xEB,0x81,0x8D,0x79,
+	0x35,0x16,0x12,0x62,0xA9,0xBA,0xA0,0x75,0xD5,0x14,0x85,
+	0xDF,0x91,0x0F,0xD3,0xE2,0xF5,0xA5,0x9F,0x36,0x74,0x00,
+	0x08,0x92,0x96,0xE4,0x1D,0xE3,0xE9,0x62,0x98,0x09,0x7A,
+	0x68,0x55,0x44,0x72,0x5F,0x00,0xF5,0xAE,0x2C,0xDA,0x5F,
+	0x74,0xAC,0x30,0xC4,0x95,0x8D,0xF1,0xD8,0xCB,0xF2,0x3D,
+	0x5C,0x59,0x91,0xD7,0x56,0xF8,0x02,0x1D,0x17,0xB9,0xEE,
+	0xFA,0x87,0xF6,0x9F,0xB2,0x01,0xFE,0xF0,0xC8,0xC9,0xEF,
+	0xE1,0x36,0xAB,0xE8,0xD3,0xC2,0x17,0x8C,0x41,0x69,0xA1,
+	0xB9,0x91,0x93,0xE7,0x93,0x3F,0xF3,0x25,0x49,0x1F,0x80,
+	0x0C,0x13,0xA0,0x84,0x67,0x46,0xC0,0x72,0x31,0x93,0x27,
+	0xC7,0x4C,0xAE,0xD8,0x74,0x83,0xC3,0xFC,0x3F,0x4A,0x38,
+	0x6B,0x11,0xCE,0x15,0x06,0xAD,0x5A,0xBF,0xB3,0xCD,0x9E,
+	0x5D,0x88,0xDF,0xC8,0x0A,0x9B,0x61,0xE8,0x9F,0x87,0x9A,
+	0xEF,0x18,0x41,0x5F,0xEB,0x01,0x17,0xE0,0xED,0xF2,0xFB,
+	0xCE,0xBA,0x56,0x5B,0xE8,0x8E,0x1E,0x5B,0xC0,0x77,0xC6,
+	0xD8,0x91,0x93,0x84,0x73,0x5A,0x94,0x69,0x27,0x6B,0x7C,
+	0xBF,0xF2,0xBD,0xE1,0xBB,0xDF,0x17,0xF6,0x75,0xF8,0x26,
+	0x35,0x94,0x36,0x54,0x34,0x3C,0xE3,0xFB,0x59,0xC3,0xEC,
+	0x86,0xEB,0x1B,0xE6,0x37,0x7C,0xD5,0xF0,0x3B,0xFF,0x64,
+	0xFF,0x8D,0xFE,0x0F,0x1A,0x6D,0x0F,0xE0,0xFF,0x8F,0xFB,
+	0x9E,0xF2,0x69,0xCB,0x45,0x73,0x8C,0xED,0x3A,0xD7,0xE6,
+	0x27,0x72,0xF0,0x1C,0xBD,0x9B,0x9F,0x6B,0xD9,0x03,0xC3,
+	0xCB,0xB9,0x31,0x47,0x0F,0x97,0x30,0xD9,0xDA,0xF4,0xB8,
+	0x76,0x3A,0x31,0x0F,0x82,0xAA,0x53,0x4B,0xF7,0xF9,0x1C,
+	0xEF,0xD6,0xF1,0x91,0xD2,0xCE,0x95,0x0E,0xE9,0x9D,0x39,
+	0x30,0x0A,0x21,0x1A,0xBB,0xCC,0xCE,0x77,0x73,0x17,0x9F,
+	0x55,0x4A,0x77,0x1D,0xB3,0xAC,0x6B,0x59,0xF7,0x59,0x29,
+	0x4C,0x40,0xDD,0x67,0x0F,0xBE,0x57,0xDB,0x03,0x3F,0x2B,
+	0x7B,0x9E,0xED,0x39,0xF9,0xAD,0x32,0x34,0x0E,0xF0,0x62,
+	0x8F,0xD4,0xDE,0xFB,0x24,0xED,0xFD,0x6B,0xCF,0xC9,0x7F,
+	0x47,0x86,0xC6,0x6D,0x9D,0xF5,0x4E,0xF2,0x76,0x4F,0xBF,
+	0xBE,0x5F,0x9E,0xB6,0x5E,0x82,0xF9,0xB9,0xB9,0x22,0x7E,
+	0x1E,0x4E,0x77,0xF5,0xCE,0xD7,0x19,0x4B,0xD0,0x89,0xAF,
+	0xBB,0xB8,0x7C,0x2F,0xE9,0xFB,0xDF,0xD8,0x52,0xA7,0x2B,
+	0xE0,0x99,0xD2,0x74,0xAC,0x29,0xCF,0x4C,0x02,0xE5,0x66,
+	0x02,0x26,0x1F,0xBB,0x2E,0x6F,0x61,0x40,0xB9,0x7A,0x5D,
+	0xFB,0xD8,0x52,0x1E,0x0A,0x73,0x36,0xDB,0xC9,0xD8,0xAD,
+	0x0B,0x03,0xF8,0x0F,0x4E,0xD0,0xCD,0x64,0x6C,0x53,0x9E,
+	0x3B,0xA0,0x5C,0x31,0x56,0x02,0xC2,0xB1,0x6D,0x80,0x00,
+	0x4C,0xDA,0xF8,0x85,0xDA,0x65,0x31,0x5E,0x10,0x61,0x21,
+	0xFB,0x02,0xD1,0x27,0x4B,0x96,0xEC,0x6D,0x3A,0x96,0xD7,
+	0xC4,0xE3,0x07,0xD9,0x81,0x37,0x59,0xC7,0xDB,0x75,0x91,
+	0x63,0x0B,0x99,0x34,0x6F,0xE1,0x66,0x42,0x96,0xF1,0x85,
+	0x26,0x1E,0x0A,0xDF,0xB1,0x1C,0x6C,0xDA,0xA3,0xC3,0x6D,
+	0x85,0xC1,0x34,0x3B,0xA4,0x6A,0x70,0xC1,0xE5,0x72,0xBA,
+	0x80,0xD8,0xD6,0xB5,0x14,0x5A,0x00,0xAD,0xA9,0x5D,0xD3,
+	0xD3,0xB4,0x17,0x48,0x35,0x42,0x30,0xAE,0x25,0x0F,0x4A,
+	0xF6,0x16,0x6E,0x35,0x13,0x30,0x74,0x1E,0xE4,0x2D,0x03,
+	0x9A,0x78,0x9E,0x34,0xE5,0x71,0x20,0x93,0x27,0x85,0xEB,
+	0xE0,0x06,0xEA,0xB5,0x38,0xD0,0xF4,0xD9,0x5E,0x5D,0xCF,
+	0xBD,0x63,0x37,0x2F,0x0E,0x80,0xEF,0xCC,0x5F,0x77,0xA4,
+	0xBB,0xE9,0x60,0x09,0xA2,0x97,0xAC,0x03,0xCA,0x75,0x4E,
+	0x8E,0x34,0x1D,0xE9,0x61,0x24,0x48,0xBB,0x97,0xD1,0xB1,
+	0x27,0x28,0xD5,0xE6,0x51,0x00,0xB9,0x03,0x60,0xE6,0xE4,
+	0xC3,0x9E,0x74,0xA8,0xCF,0xC2,0x80,0xD7,0x4A,0x5F,0x8D,
+	0x82,0x9A,0x19,0x2A,0xAB,0x3E,0xFB,0x7A,0x32,0xBB,0x03,
+	0x3B,0xB8,0xE8,0xA1,0xA3,0xCB,0x96,0x8D,0x48,0x27,0x9E,
+	0x7E,0xBB,0x32,0x48,0xD1,0xC1,0xE2,0x16,0x56,0xE2,0x5A,
+	0x48,0x77,0x02,0x7C,0x89,0xAB,0xF8,0xB3,0xD0,0xE7,0x2F,
+	0x73,0x47,0x94,0x23,0x27,0x18,0x1C,0x62,0xA0,0xCD,0x00,
+	0x5F,0x86,0xDF,0x4E,0xE8,0x3F,0x36,0x88,0x66,0x0E,0x82,
+	0x84,0xA6,0x63,0x41,0xA8,0x62,0xD0,0x69,0x26,0x32,0x47,
+	0xF6,0x16,0xB7,0x6C,0xDC,0xFB,0x23,0x84,0x3F,0xED,0x25,
+	0x94,0xD2,0x16,0xF6,0x21,0x4C,0xEB,0x25,0x94,0x8E,0x5D,
+	0x05,0x56,0xB3,0x38,0xC1,0x62,0xC7,0xB6,0x42,0x11,0x34,
+	0xBD,0x74,0x8C,0x19,0xF0,0x33,0x83,0x3F,0xDB,0x4F,0xC0,
+	0xCC,0xC1,0xA8,0xEB,0x7B,0xC9,0xFB,0x3D,0x35,0xD6,0x7E,
+	0xB8,0x08,0x5B,0x3B,0xB3,0x73,0xCF,0x79,0xD5,0x5B,0x8A,
+	0x2F,0x5D,0x1F,0x39,0xE9,0x38,0xC9,0xBA,0x02,0x58,0x22,
+	0x1F,0x6E,0x16,0xE3,0x4D,0x96,0x74,0xAC,0xE9,0xD8,0x54,
+	0x10,0xB1,0x72,0xB0,0xE4,0xE4,0x49,0xE9,0x11,0xEF,0x79,
+	0xBA,0x40,0x55,0x86,0x52,0x25,0xAA,0x0C,0xA4,0x7E,0x55,
+	0xC9,0x01,0x2D,0x94,0x8C,0x55,0x97,0xE8,0xC2,0xA8,0x94,
+	0x67,0x67,0x0A,0x80,0xD0,0x98,0xE5,0x16,0x8D,0x95,0x4A,
+	0x96,0x04,0xDC,0xF0,0xBB,0x34,0xE0,0xA6,0x2B,0xD5,0x65,
+	0xCB,0x60,0xBA,0x31,0x2F,0xDB,0x3B,0xB4,0x69,0x0F,0x9F,
+	0xB7,0x48,0x02,0xBD,0x23,0x73,0x77,0x73,0x44,0xEA,0x04,
+	0xC7,0x7B,0xF1,0x59,0x10,0x38,0x65,0x5D,0x4B,0x45,0x53,
+	0xCB,0xBA,0xF6,0x8A,0xA6,0xF6,0x62,0x15,0x1C,0xE4,0xFE,
+	0xC6,0xEF,0x49,0x46,0x9D,0x65,0x27,0xC9,0x38,0xF4,0x6F,
+	0xFC,0xFF,0xE2,0xB3,0x8D,0x67,0x00,0x90,0xB1,0xAE,0xC5,
+	0x4A,0x32,0x10,0x11,0x2F,0xED,0xCA,0x11,0x26,0x91,0x8E,
+	0x8E,0x2E,0x5D,0xBA,0x14,0x2B,0x3D,0xB6,0x14,0x3A,0xBE,
+	0xE7,0x5A,0xA9,0xC7,0xD2,0xD5,0xD4,0x26,0x7D,0x5B,0x74,
+	0xBE,0x30,0x58,0x02,0x5D,0x0C,0xD5,0xE3,0x5D,0xD8,0xB9,
+	0x08,0x91,0x8E,0x58,0x0E,0x19,0x7D,0xD4,0x03,0x7D,0x14,
+	0xAE,0x8A,0x15,0x2E,0x76,0x22,0x5D,0xA4,0xA7,0x2E,0x2F,
+	0x5D,0x2A,0x1D,0x45,0x4E,0x8B,0x34,0x6C,0x4B,0x3B,0xE6,
+	0x26,0xF4,0xF7,0x1F,0xEB,0x02,0x98,0x55,0xF1,0xAD,0x7D,
+	0x08,0x7B,0x75,0xC3,0x42,0x13,0x2D,0x09,0x8C,0xDD,0xBA,
+	0x34,0x90,0xFC,0x99,0x67,0x22,0xB3,0x72,0xB1,0x66,0x65,
+	0xC3,0xBA,0xC0,0x49,0x4A,0x23,0xA4,0xF4,0xBD,0xDA,0xB4,
+	0x55,0x36,0xE9,0x08,0xB0,0x51,0x06,0xD1,0xC5,0xAA,0xE2,
+	0xA4,0x9F,0x44,0x95,0xCC,0x85,0x2E,0xBA,0x28,0xAA,0xD8,
+	0xA1,0xE9,0xEF,0x80,0xFC,0x6B,0xE3,0x8A,0x15,0x31,0x23,
+	0x8A,0x69,0x0B,0x8A,0xDF,0x57,0x9C,0x70,0xC1,0xA3,0x92,
+	0x69,0x78,0x05,0x5D,0x79,0xBC,0x5A,0xC8,0x8D,0x90,0x64,
+	0x9C,0x95,0xBE,0x87,0x9C,0x5C,0x72,0xA7,0x48,0x35,0x69,
+	0x52,0x55,0x46,0xF2,0xFB,0x5E,0x3B,0x98,0xF2,0x67,0xA0,
+	0xC7,0xED,0xEC,0x3B,0x0D,0x83,0x93,0x0F,0xFF,0xDA,0xD1,
+	0x79,0xAC,0x13,0xFF,0x85,0x83,0xC0,0x47,0x29,0xC9,0xEF,
+	0xC3,0xD3,0xA7,0x9D,0x9F,0x05,0x3E,0x25,0x81,0x4E,0x4E,
+	0x0A,0xEF,0xCC,0x27,0xD5,0xC5,0x6A,0x71,0x07,0x44,0x1D,
+	0x87,0x0F,0x1D,0x3D,0xF4,0x49,0xE9,0xE5,0xDA,0xE4,0x55,
+	0x5C,0xE9,0xC5,0x5A,0x6B,0xD1,0xC5,0x41,0x97,0x2B,0x4E,
+	0x7E,0xBD,0xAC,0x73,0x2F,0x9E,0xAB,0x97,0x5A,0xA5,0x4F,
+	0x0E,0x29,0x9D,0x7B,0x71,0xD3,0x54,0xE7,0x06,0xEA,0xED,
+	0xB7,0x93,0xCE,0x8B,0x9D,0x6D,0x80,0x60,0x7A,0xB4,0xF8,
+	0xFF,0x29,0xEE,0xEA,0x63,0x9B,0xBA,0xB2,0xFC,0x89,0xED,
+	0xD8,0xC1,0xF0,0x92,0x00,0xC6,0xED,0x32,0xAB,0xF4,0x86,
+	0xAF,0x06,0x41,0x4C,0x08,0x34,0x10,0x87,0x00,0xC1,0x71,
+	0x18,0xAB,0xF9,0x22,0x76,0x80,0x4C,0xA0,0xE8,0xC5,0x7E,
+	0x4E,0x5E,0xB1,0xDF,0xF3,0xBC,0xF7,0x1C,0x27,0xB3,0xD5,
+	0x34,0xB3,0x99,0x99,0xD6,0x79,0x15,0xD3,0xED,0x4A,0x55,
+	0xFF,0x9B,0x41,0xCC,0x4A,0xD5,0xA8,0xBB,0xD2,0x48,0xFC,
+	0xB1,0x9A,0x91,0x46,0xB4,0x5E,0x3A,0xBB,0xAD,0x76,0x54,
+	0xC8,0xEE,0x88,0x4E,0x77,0x87,0x4E,0x33,0x50,0xB3,0xE9,
+	0xAC,0xBA,0x6D,0x07,0x4A,0x17,0xE1,0x3D,0xE7,0xBD,0x17,
+	0x27,0x36,0x81,0x29,0x5D,0x69,0xF7,0x5A,0xB9,0xF6,0xBD,
+	0xF7,0xDC,0x73,0xCF,0x3D,0xE7,0xDC,0xDF,0x39,0x37,0x31,
+	0x8F,0xCB,0xF3,0x7F,0x18,0xAE,0x0E,0x4F,0xDD,0xAE,0x55,
+	0x6B,0xF5,0x2B,0xB3,0xEF,0xCF,0x7E,0x70,0xF3,0xDD,0xA9,
+	0xD7,0x6B,0x67,0xE7,0x57,0xCE,0xBE,0x3D,0x75,0xA3,0xF6,
+	0xA5,0x5D,0x17,0x66,0x3F,0x78,0xBB,0x48,0xF0,0x1B,0x54,
+	0xCB,0x7F,0x98,0x04,0x73,0x2B,0x73,0x26,0xC1,0xE5,0xD9,
+	0xFC,0xDB,0xAE,0x6A,0x27,0xC6,0xE2,0x55,0xB7,0x66,0x6F,
+	0x5D,0x9A,0xCE,0x55,0x4C,0x5F,0x82,0xF9,0x1D,0xF6,0x9C,
+	0xEA,0xF8,0xCE,0x1B,0x50,0x3B,0x73,0xE3,0xA7,0x8E,0xCB,
+	0xD7,0x6C,0x7F,0x9C,0xC9,0xD3,0x63,0x2F,0x66,0x2E,0xE2,
+	0x51,0x5C,0x86,0xFC,0xD2,0x36,0x22,0x47,0x3F,0x99,0xB9,
+	0x8D,0xE4,0x1F,0x36,0xBF,0xB7,0x6D,0xB6,0x6C,0xC2,0x31,
+	0xFD,0xF6,0xCC,0x7F,0xA2,0x5D,0x3E,0xB8,0xFC,0x07,0xFB,
+	0x3B,0x53,0xFF,0x0A,0xFA,0x2F,0x67,0x3F,0xBC,0xFC,0x91,
+	0xFD,0xEA,0xD4,0xBF,0xC0,0xB6,0xD9,0xF5,0x1F,0xCD,0x5C,
+	0x7C,0xE5,0xA5,0x53,0x44,0x67,0x40,0x44,0x1D,0x46,0x04,
+	0x8C,0x0B,0x77,0xE8,0x76,0xB2,0xF6,0x9F,0x3E,0x35,0xEE,
+	0xF9,0xB8,0x6B,0x2C,0xA8,0xFB,0xCF,0xF4,0x13,0xCE,0xE9,
+	0x79,0x87,0x52,0xDD,0x56,0x97,0xF0,0x6A,0x95,0xF9,0x43,
+	0x04,0x71,0x76,0x54,0x4C,0xAE,0xB5,0xEE,0x69,0xAF,0xB6,
+	0x51,0xCF,0xD8,0x6E,0x3A,0x2A,0x34,0x67,0xB6,0x25,0xE1,
+	0x9D,0x67,0x6D,0x2D,0xD8,0xC7,0xE9,0xBF,0xCD,0x47,0x40,
+	0x3F,0x6C,0x3B,0x87,0x5D,0xD8,0xD8,0x75,0xE1,0xDC,0xD3,
+	0x5E,0xFC,0x7C,0x4E,0xF2,0x86,0xF3,0xE7,0xAF,0x0F,0xE7,
+	0x0A,0x35,0x6D,0x34,0xF7,0x51,0x9C,0xAB,0x3B,0x5E,0xAD,
+	0x48,0xD7,0xD8,0x5D,0x59,0x87,0x7E,0xC0,0xFE,0xDF,0xD9,
+	0xB4,0x4D,0xFF,0x2D,0xF2,0x6F,0x06,0x6A,0xE9,0x95,0xAF,
+	0x56,0x20,0x76,0x56,0xB8,0xF4,0x5B,0xF6,0x8F,0xB3,0x27,
+	0x6C,0xFA,0x55,0xFD,0x59,0x67,0xDB,0x55,0xAD,0x3A,0xBB,
+	0x5F,0xF2,0xEA,0x19,0x47,0x36,0xED,0xC8,0x3E,0xE3,0xCC,
+	0xFD,0xD2,0x29,0xE1,0x39,0xCB,0xE9,0x2D,0x92,0x77,0xE5,
+	0x4D,0xAD,0x56,0x7F,0xC6,0x99,0x3D,0xE1,0xCC,0x9E,0x74,
+	0x64,0x9F,0x75,0x66,0x33,0x8E,0x5C,0xB6,0x4E,0xF2,0x66,
+	0x4F,0x39,0xB2,0xA7,0x9C,0x39,0x63,0x3B,0x9D,0xF4,0x67,
+	0xED,0x81,0xCA,0x4A,0x50,0x5A,0x36,0xDF,0x2D,0xB4,0x57,
+	0x81,0x6A,0xA7,0xE4,0x67,0xFF,0xD3,0x5E,0xD0,0x1E,0xD3,
+	0x91,0x18,0xDD,0x8A,0xD3,0x67,0x5B,0x5D,0xEA,0x7A,0xFD,
+	0x94,0xB3,0xED,0x37,0xE9,0x3F,0xE6,0xE3,0x30,0x5F,0x9F,
+	0x9F,0xA1,0xC7,0x5E,0xFC,0x39,0xCC,0x3F,0x42,0x8F,0x49,
+	0xD0,0x3F,0x9E,0x7E,0xB3,0xAA,0x75,0x8F,0x7A,0x23,0x7F,
+	0xBA,0x50,0x70,0xE9,0xB9,0x4A,0xFA,0x2E,0x70,0xAE,0xDF,
+	0x80,0xD0,0xCF,0xAE,0x21,0x84,0xD2,0x85,0x8E,0x7E,0x55,
+	0x94,0xBF,0x7E,0xCD,0x04,0x4E,0xF4,0xFB,0xF7,0xAE,0x99,
+	0x88,0xE7,0xD1,0xAF,0x64,0x71,0xFF,0x59,0x54,0xE8,0xF1,
+	0x83,0x59,0xD7,0x74,0xCE,0xA1,0xE7,0x72,0xC3,0xBB,0x2E,
+	0xE4,0x4C,0xB2,0xF3,0x16,0x99,0x57,0xBF,0x72,0x36,0xE1,
+	0xCD,0x1E,0xB6,0x95,0x12,0x1E,0x47,0xC2,0xAD,0x2E,0xFD,
+	0x53,0xFB,0x1E,0xFD,0xAE,0xFD,0xF3,0x83,0x59,0x07,0x6A,
+	0x06,0xF5,0x36,0xFD,0xA6,0x43,0x7F,0x33,0xA7,0x7F,0x14,
+	0xEE,0x3F,0xD2,0x9F,0x5F,0x57,0x18,0xD6,0xAF,0xE0,0x36,
+	0x1F,0xAB,0x73,0xDD,0xA1,0xAF,0xE2,0xDD,0xD5,0x57,0xE1,
+	0xF8,0xD1,0xE9,0x1B,0x95,0x64,0x63,0xFA,0x87,0x16,0x9B,
+	0xEE,0x0E,0xE3,0x15,0x1F,0x2F,0xD3,0x39,0xFD,0x8D,0xE9,
+	0x37,0xAA,0xDA,0x2E,0x65,0x9E,0xD0,0x2F,0x91,0x89,0xD3,
+	0x35,0x59,0x57,0xC1,0x65,0xCF,0xA1,0x20,0x2B,0x50,0x90,
+	0xF9,0x3A,0xC2,0x98,0xEC,0x49,0xDB,0xB6,0x77,0xB6,0x3E,
+	0x82,0x76,0xF8,0x24,0xFB,0x8C,0xED,0x50,0x76,0x1D,0xDE,
+	0xDD,0xAE,0xE6,0xF7,0xDC,0xD5,0xDF,0x45,0x99,0x50,0xAD,
+	0x46,0xC4,0xAF,0xC2,0x33,0x8A,0x6B,0xEE,0x41,0xFD,0x35,
+	0xA2,0xC7,0xE8,0x35,0x21,0xFD,0x9D,0xE9,0x37,0x2A,0xA7,
+	0x3F,0xB8,0x3B,0xFD,0x45,0x95,0x6A,0xFF,0x59,0x15,0xB4,
+	0xBD,0xA5,0xAC,0xCA,0x54,0xE2,0x94,0xF9,0xAA,0xFC,0x73,
+	0xF4,0xFF,0x6D,0xF4,0x15,0xF4,0xDC,0x3C,0xD7,0x9F,0x17,
+	0xEE,0xE2,0x85,0x3A,0xFF,0x22,0xE2,0xC2,0xF0,0x49,0xFA,
+	0xB3,0xE5,0xCB,0x2F,0x7D,0xEF,0x82,0x66,0xBB,0x35,0x37,
+	0x57,0xF9,0x57,0xB7,0xAE,0xDB,0x5F,0x7F,0xF9,0xD6,0x9C,
+	0xFD,0xD7,0x4F,0xE5,0x8E,0xCC,0xE4,0xCD,0xC7,0xC1,0xCC,
+	0x5C,0x9C,0x99,0x9B,0x9D,0x1F,0xB2,0xBF,0x3D,0xF3,0x6F,
+	0xE8,0xEF,0xD3,0x73,0x35,0x6D,0x97,0xD2,0xB6,0xB6,0x5C,
+	0xAE,0xB0,0x65,0x0A,0x3D,0xE1,0x07,0x4E,0xCD,0xFB,0x03,
+	0xE7,0x38,0xFE,0x4C,0x78,0x11,0xB8,0xA6,0xF5,0x6C,0xCB,
+	0xB7,0xBC,0xD9,0xFD,0xCF,0x78,0xEF,0x9C,0x71,0x9E,0x81,
+	0x5F,0x4C,0x41,0xF3,0xEF,0xB7,0xBC,0x76,0xF0,0x85,0x8B,
+	0xCF,0xFD,0xFA,0xAF,0xF5,0x96,0xE7,0xA1,0xAB,0x0B,0x51,
+	0x67,0x6A,0xFF,0x8B,0x60,0x57,0x56,0x9F,0x71,0xCE,0x80,
+	0x7E,0xF7,0xA7,0xCF,0xD2,0x4D,0x70,0x4E,0x9A,0xFA,0xAF,
+	0x67,0xFB,0xF5,0xD7,0xED,0xB9,0x83,0xE8,0x27,0xFA,0x9D,
+	0x6D,0x9F,0x2B,0x27,0xF4,0x0F,0x9D,0x8F,0x79,0x5D,0x47,
+	0x42,0x9F,0xFE,0xB8,0xF9,0xC2,0x4F,0xCE,0xFC,0xFB,0x73,
+	0x9F,0x3C,0xF7,0xAE,0x9E,0xD3,0xDF,0x09,0xE4,0xFF,0x0C,
+	0x32,0x2E,0xE5,0x60,0x7E,0x0D,0x64,0x6E,0x63,0xE2,0x59,
+	0xB5,0x8F,0xC3,0xE4,0x73,0x45,0x3A,0xDF,0x7C,0x61,0xFE,
+	0xF7,0xF4,0x25,0x8A,0x43,0x3F,0xC1,0x34,0xB0,0x22,0xF0,
+	0xFD,0xF7,0x9B,0x2F,0xDC,0x9E,0x5B,0xF7,0x5A,0x68,0xFB,
+	0x06,0xAD,0xC6,0xB1,0x61,0xDF,0x89,0xB4,0x6B,0x6A,0xDF,
+	0x86,0xB4,0xED,0xB5,0xD0,0xCA,0x9B,0xB9,0x1B,0xBF,0x4B,
+	0x0F,0xD9,0xDF,0x42,0x50,0x44,0x81,0xEB,0x52,0xDE,0x80,
+	0xFD,0x3D,0x74,0xD6,0x8F,0xB6,0xCD,0x2B,0xD7,0xF5,0x6B,
+	0x59,0x9F,0xE2,0x9D,0xAB,0xCE,0x8E,0xC3,0xF4,0x45,0x5B,
+	0x0B,0xA6,0x94,0xEF,0x7F,0xA1,0x7D,0x4C,0x5F,0xA2,0x02,
+	0x83,0x5C,0xC7,0xFD,0xE9,0xB8,0xBF,0x42,0xCB,0x04,0xFE,
+	0x8C,0x7B,0xCF,0xA6,0xBC,0xE7,0xFE,0x12,0xCE,0x2A,0xDE,
+	0x73,0xDF,0x85,0xC2,0x16,0xCD,0x8B,0x6E,0x5F,0xFD,0x3C,
+	0x1C,0xC9,0x17,0xEE,0x98,0x5F,0x88,0xD8,0x50,0x57,0xE7,
+	0x3A,0x53,0x37,0x03,0xBB,0x6E,0xDE,0xC1,0xC3,0xAE,0x7F,
+	0xEE,0x2C,0xB4,0xBC,0x00,0xF9,0xDF,0xDD,0x41,0x9F,0x71,
+	0x9D,0xFB,0xB6,0xD7,0x78,0xA4,0x42,0x24,0xBD,0x8B,0x7E,
+	0x57,0x90,0x3D,0x30,0x9D,0xB3,0x7D,0xF2,0x77,0x5B,0xF6,
+	0x56,0xA6,0x3F,0xCB,0xBA,0x4E,0x3D,0x75,0xF6,0xDB,0xDE,
+	0x73,0xDF,0xC7,0xA0,0xA1,0xF1,0xD1,0xD3,0x4C,0x1E,0x17,
+	0x94,0x78,0x42,0xCE,0xD4,0x73,0xEE,0x4D,0xD5,0x8F,0xFD,
+	0x2C,0xFF,0xC2,0xF9,0x15,0xFF,0x5C,0x7F,0xA3,0x41,0x5B,
+	0x92,0xB4,0xD9,0x2E,0x8A,0x58,0xD7,0x5E,0xFF,0x26,0xD5,
+	0xDF,0xD3,0xA9,0x7E,0xF9,0x85,0xD2,0xBC,0x2E,0x92,0x56,
+	0x46,0x64,0x16,0xD8,0xB6,0x8D,0x35,0xB2,0x80,0x9C,0x9A,
+	0x54,0xC4,0xD1,0x31,0x8D,0xED,0x6C,0x6D,0x6D,0x62,0x87,
+	0x64,0x25,0xC1,0x4B,0x31,0x16,0x92,0xB4,0x84,0x0F,0x7A,
+	0xD3,0x89,0x04,0x4B,0xC9,0xA2,0xA4,0x09,0x0A,0xE3,0x55,
+	0x55,0x1C,0x95,0x92,0x82,0xA4,0x71,0xEE,0x4E,0x71,0x5C,
+	0x8C,0x09,0x4C,0x50,0x14,0x59,0xE1,0xDC,0x1D,0x23,0x92,
+	0xAC,0x24,0x79,0x24,0x55,0xE4,0x51,0x85,0x4F,0x32,0x24,
+	0x4F,0x8A,0x12,0xAF,0x89,0xB2,0xC4,0xB9,0xE1,0x4B,0x95,
+	0x89,0x0D,0x13,0x1B,0x96,0xB6,0x87,0x7A,0x63,0xA2,0x7A,
+	0x3A,0x8A,0xD2,0xC1,0x10,0xF4,0x42,0x48,0x1A,0xE7,0x13,
+	0x62,0x8C,0xC5,0x14,0x71,0x5C,0x60,0x6A,0x4A,0x88,0x8A,
+	0x71,0x31,0x6A,0xAC,0xC0,0x64,0x85,0x49,0xF8,0xA6,0x08,
+	0x49,0x79,0x9C,0x1F,0x49,0x08,0x2C,0x29,0xC4,0x44,0xDE,
+	0x07,0x9B,0x55,0x08,0x92,0x80,0x38,0xC2,0xC7,0x44,0x69,
+	0x94,0x45,0x65,0x29,0x2E,0x8E,0xA6,0x15,0x73,0x5A,0x5C,
+	0x4C,0x08,0xBE,0x22,0x63,0x35,0x23,0x6A,0xD1,0x31,0x3F,
+	0xB0,0xCD,0xAA,0xBB,0xAC,0x13,0x8E,0xF1,0x8A,0x84,0xF3,
+	0xFD,0x4C,0x4E,0xD1,0x4C,0xA2,0x61,0x10,0x93,0x05,0x55,
+	0x7A,0x5C,0x63,0x31,0x99,0xF1,0xD2,0xA4,0x36,0x86,0x04,
+	0xF5,0x10,0x91,0x65,0x96,0xC4,0x26,0x4B,0xF1,0xA8,0x07,
+	0x01,0xF5,0xA0,0xFA,0xA1,0x0B,0x17,0x62,0xA2,0xCA,0x32,
+	0x8A,0xA8,0x09,0xA4,0x23,0x4D,0x88,0x6A,0x42,0xAC,0x1E,
+	0x70,0x77,0xA2,0x10,0x63,0x9A,0x4C,0x1C,0xC1,0x05,0xFD,
+	0x8A,0x8C,0xE2,0x27,0x19,0xED,0x1A,0xD9,0x51,0xAF,0xCF,
+	0x6D,0x4E,0x97,0x64,0x8D,0xC5,0xE5,0xB4,0x14,0xB3,0xD8,
+	0xF1,0x09,0xDA,0xD4,0x24,0x13,0x26,0x44,0x55,0x53,0xEB,
+	0x51,0x62,0x55,0x50,0x34,0x16,0xEE,0x1B,0x1C,0x08,0x04,
+	0x19,0xA9,0x4E,0xD0,0x70,0x31,0xB4,0x9C,0x6C,0xEA,0xCC,
+	0xD8,0x98,0x1B,0x97,0x10,0x54,0x95,0x04,0x66,0xA7,0x85,
+	0x49,0x5C,0x99,0x74,0xA2,0x89,0x52,0x5A,0x60,0x3E,0x7A,
+	0x41,0x27,0xCE,0x34,0x16,0x33,0xD8,0xD7,0xC3,0xA0,0x64,
+	0x68,0x14,0x09,0xE5,0x94,0x20,0x31,0x31,0xC9,0x8F,0x0A,
+	0x96,0xE6,0x02,0xBC,0x64,0x50,0x92,0xB4,0x4B,0x06,0xA0,
+	0x17,0xFB,0x04,0x49,0x4E,0x8F,0x8E,0x19,0x72,0xA0,0xB1,
+	0xF8,0xA8,0xC0,0x50,0xE1,0x1A,0xAF,0x8C,0x0A,0x9A,0x29,
+	0x4E,0xBD,0x65,0x1A,0x3E,0x1A,0x45,0x81,0xC8,0x38,0x8B,
+	0x1C,0xFC,0xB4,0x9B,0x74,0x1C,0xED,0x2B,0xA2,0xB3,0xA1,
+	0x35,0x93,0xB2,0x32,0x89,0xBB,0x57,0x4C,0x7E,0xB4,0x9E,
+	0xCF,0x5D,0x54,0xD6,0x82,0x71,0x4B,0x44,0x2B,0x2A,0x30,
+	0xC6,0x20,0x9A,0x48,0xAB,0x64,0x08,0xD8,0x6E,0x34,0x55,
+	0x54,0xBE,0xAC,0xA8,0x2C,0x85,0x2E,0x6D,0x0D,0xC1,0xC8,
+	0xA4,0x26,0x98,0x3D,0xE6,0x28,0x0C,0x08,0x09,0x61,0x9C,
+	0x97,0xB4,0x05,0x7F,0x13,0xBF,0x45,0x16,0x44,0x7E,0x89,
+	0x34,0x33,0xA9,0x61,0x90,0xA4,0x86,0x60,0x4F,0x18,0x65,
+	0x39,0x6E,0xD4,0x9A,0x90,0x4C,0xC9,0x0A,0x4F,0xB2,0x92,
+	0x1E,0x46,0x70,0x0B,0xC8,0x51,0x8E,0xD3,0xB4,0x98,0x35,
+	0xCD,0x87,0xAC,0x4D,0x79,0xCB,0x4D,0x65,0xEA,0x3F,0x80,
+	0xDB,0xD1,0x4A,0xB7,0x63,0x8E,0x30,0x38,0x2A,0x28,0x62,
+	0x9C,0xB6,0x65,0x91,0xF6,0x90,0x97,0x9B,0x47,0xB0,0xA8,
+	0x84,0xB8,0x22,0x27,0x17,0xF6,0x40,0xAB,0xA2,0x54,0x83,
+	0xA8,0x4B,0x3A,0x2F,0xE8,0x71,0x0B,0xAA,0x34,0xE6,0x90,
+	0x96,0x92,0xE8,0xA6,0xD6,0x29,0x26,0x03,0x59,0x13,0x2D,
+	0x5F,0x8A,0x74,0x0C,0x1C,0x0E,0x46,0x96,0xF5,0xA5,0xCE,
+	0x85,0x3E,0x3A,0x04,0x86,0x13,0x8C,0xF1,0xA8,0x26,0x6D,
+	0x0C,0x55,0x85,0x6E,0xCF,0xA2,0x3C,0xDA,0x5C,0xD4,0x26,
+	0x11,0x33,0x8C,0x4E,0x19,0x11,0x06,0xF1,0x00,0x11,0xA5,
+	0x3F,0xAD,0x31,0x7E,0x91,0x27,0x9E,0xAF,0x31,0x83,0xC2,
+	0x84,0xA0,0xE2,0x3C,0x51,0x5A,0xF4,0xDA,0xED,0xCC,0x0D,
+	0x28,0x5F,0xCA,0xF0,0xDC,0x40,0x64,0xA0,0xBB,0x31,0x60,
+	0x38,0x2E,0x2F,0x45,0x05,0xE4,0x78,0x0C,0x4F,0xD5,0xF2,
+	0x0A,0x5B,0x18,0x41,0xE2,0x7B,0xF7,0x62,0x59,0xD6,0x54,
+	0x65,0xD8,0xD8,0x38,0x6B,0x62,0x69,0x89,0x0E,0x29,0xB9,
+	0x7C,0x3D,0x3B,0x56,0x7A,0x5C,0x0F,0x94,0x28,0x3C,0xB3,
+	0xC8,0xDB,0xD2,0x5A,0xA7,0xCC,0x26,0xE5,0x34,0xCB,0x90,
+	0xD7,0xF0,0xA8,0x92,0x31,0xF2,0x2F,0x3A,0x1A,0x72,0x1C,
+	0x77,0x88,0xC7,0x1F,0x96,0x48,0xD8,0x30,0xB4,0xA3,0x77,
+	0xEB,0x01,0x30,0xFC,0xD9,0xFA,0xBC,0xE0,0xCF,0x99,0x7B,
+	0xF6,0x63,0xFA,0x73,0x91,0xE9,0xD2,0x49,0x9D,0xA1,0xF0,
+	0x93,0x81,0xBE,0xFE,0x21,0x03,0xB5,0x46,0x04,0x8D,0x67,
+	0x4D,0xBE,0xD6,0x27,0x4C,0x7A,0x59,0x12,0x16,0x37,0x8C,
+	0x22,0x2F,0x59,0x5E,0x93,0x4B,0xB8,0xDD,0x4B,0xE1,0x83,
+	0x86,0xC0,0x56,0x8A,0x08,0x7B,0xC9,0x6F,0x81,0xF5,0xF0,
+	0x1A,0x52,0x67,0x18,0x46,0x21,0x09,0x0F,0x22,0xFA,0x95,
+	0x35,0xDE,0xDA,0xD8,0xDC,0xD4,0xB4,0x7B,0x3B,0xC3,0x1A,
+	0x49,0x59,0x28,0x89,0xFE,0xD4,0x2D,0x8C,0x08,0x8A,0x0F,
+	0xC1,0xA6,0xD3,0x42,0x70,0xB6,0x0F,0x54,0x39,0xAD,0x44,
+	0x05,0xD8,0x8F,0x1F,0x63,0x82,0xAA,0x59,0xC1,0x01,0xDB,
+	0xC3,0x9B,0xA3,0xFC,0x49,0xAC,0xC6,0xA9,0x4A,0x52,0x25,
+	0x52,0x25,0x53,0x35,0x41,0x55,0x8C,0x2A,0x85,0xAA,0x38,
+	0x55,0xDA,0x49,0xB7,0xC5,0xCC,0xCF,0x8C,0x62,0xDA,0xF1,
+	0x9E,0xFD,0x19,0xEB,0xD2,0x71,0xF0,0x2D,0x5D,0xD0,0xFF,
+	0x40,0x72,0x4D,0xC6,0xA0,0x11,0xE5,0x99,0x9F,0xC1,0x28,
+	0x51,0x21,0xC0,0xF1,0xE9,0x98,0x48,0x00,0x98,0x31,0x43,
+	0x80,0x81,0x42,0x69,0x95,0xA2,0x61,0x94,0xF8,0x11,0xFD,
+	0x38,0xD1,0x8F,0x1B,0x87,0xD3,0x38,0x87,0x04,0xAF,0x31,
+	0x13,0xEC,0x55,0x1A,0x4F,0xD2,0xB8,0x2C,0x25,0x26,0x69,
+	0xE2,0xF2,0x68,0x86,0x54,0x22,0x51,0xA9,0x63,0x72,0x66,
+	0x81,0x22,0xAD,0x92,0x7C,0x0D,0x22,0xE9,0x3B,0x89,0xC2,
+	0x8F,0x0B,0x5B,0x89,0x4E,0x36,0xB8,0xE1,0x72,0x66,0x34,
+	0x59,0xB2,0xB7,0xED,0x4C,0x8C,0x33,0x51,0x2B,0x0B,0x0D,
+	0xC4,0x01,0xCF,0x0A,0xAE,0x8C,0x7E,0xC8,0x2F,0x45,0x70,
+	0x83,0xDD,0x04,0xB1,0xE3,0x13,0x19,0x7E,0x12,0xC5,0x4E,
+	0x6B,0x32,0xAD,0x14,0xE5,0x13,0xC6,0x6C,0x8D,0x08,0x62,
+	0x06,0x81,0xAA,0xA6,0x93,0xA6,0x37,0x15,0xD9,0x2F,0x1C,
+	0x21,0x22,0x52,0x0C,0x95,0xC9,0x16,0x44,0x10,0xD5,0x02,
+	0x2C,0x45,0x49,0xD4,0x49,0x96,0x94,0x63,0x06,0x61,0x9C,
+	0x08,0x11,0x67,0x69,0x4F,0x2C,0xCE,0xAB,0x1A,0x5B,0x88,
+	0xF2,0xAC,0xC1,0x50,0x91,0x69,0x36,0x31,0x91,0x40,0xB4,
+	0xB2,0x90,0xDA,0x90,0x53,0xA3,0x89,0x31,0x99,0x02,0x2E,
+	0x8F,0xEC,0x17,0x42,0x09,0x2D,0x85,0xBB,0xB6,0x02,0x66,
+	0x99,0x4D,0x0D,0x28,0x22,0x12,0x62,0xB0,0x93,0x18,0x48,
+	0x72,0xA3,0x9C,0x42,0x29,0x11,0xF7,0x63,0xB8,0x00,0x19,
+	0xA1,0x27,0xDC,0xD8,0xD9,0x17,0x46,0x0E,0x88,0x85,0x9A,
+	0x38,0x22,0x26,0x10,0x7E,0x08,0xA4,0x93,0xBC,0x72,0x5A,
+	0xF5,0x23,0x56,0x61,0x22,0x93,0x56,0x19,0xA5,0x3E,0x8C,
+	0x8F,0x1B,0x79,0x90,0x64,0xE5,0x01,0xC4,0x9B,0xA0,0xC2,
+	0xC2,0xB8,0x94,0xE9,0x10,0x6C,0xA1,0x0C,0x21,0x1A,0x24,
+	0xF9,0x49,0x2B,0x59,0x99,0x5C,0x44,0x47,0xD3,0x05,0x69,
+	0x71,0xD3,0x91,0x0D,0x7F,0x59,0x62,0x48,0xE4,0xD1,0xB0,
+	0xB9,0x69,0x77,0x22,0xBD,0xC3,0xA8,0xB7,0x56,0x2D,0x29,
+	0x18,0x70,0x7A,0x8E,0x63,0x69,0x32,0xB3,0x24,0x0A,0x39,
+	0x10,0x09,0xF6,0xF4,0x43,0xC0,0x7F,0x02,0x94,0x11,0xC8,
+	0x8C,0x18,0xFD,0x85,0xE5,0x52,0x2C,0xC2,0x5E,0x6B,0xC5,
+	0x7B,0x80,0x90,0x92,0x25,0xB6,0x39,0xEA,0x77,0x1B,0x54,
+	0x4B,0x84,0x59,0x86,0xD4,0xA0,0x7B,0x40,0x2A,0xE1,0xF3,
+	0x2D,0x49,0xAB,0x94,0xE8,0x43,0xE5,0x6C,0xC5,0x3C,0x4F,
+	0xD5,0x1E,0x6A,0xDE,0xFF,0x65,0x44,0x8A,0xFA,0x31,0x1E,
+	0x3D,0x28,0x24,0xFD,0x6F,0xD3,0x0F,0xDF,0x03,0xF2,0x8F,
+	0xC5,0x44,0xC2,0x5A,0xC5,0x0A,0x61,0x0F,0x9F,0x1D,0xC4,
+	0xDC,0x7F,0x22,0xA2,0xDD,0x2F,0x3F,0xB0,0x12,0x0B,0x57,
+	0x49,0xC8,0x2B,0x62,0x68,0x06,0x53,0xC5,0x92,0xC8,0x82,
+	0x10,0x34,0xB9,0x43,0xC2,0x60,0x85,0xA5,0x02,0xBE,0x58,
+	0x55,0x58,0x65,0xE7,0x5C,0xDC,0x4A,0x6E,0x2D,0xB7,0x9E,
+	0xDB,0xC2,0x35,0x71,0x7B,0xB8,0x76,0xAE,0x8B,0x7B,0x92,
+	0x8B,0x70,0xC3,0xDC,0x53,0x5C,0x9C,0xFB,0x26,0x37,0xCE,
+	0xFD,0x05,0xF7,0x1D,0x4E,0xE7,0x5E,0xE1,0x7E,0xC8,0xFD,
+	0x0D,0xF7,0xB7,0xDC,0x79,0xEE,0xE7,0xDC,0x3F,0x70,0x55,
+	0xB0,0x02,0xDC,0x60,0x87,0x55,0xC0,0x41,0x35,0xD4,0x18,
+	0x4F,0x0F,0xAF,0x85,0xD5,0xC6,0x23,0xBE,0x1D,0xB0,0x06,
+	0xBE,0x66,0x3C,0x87,0xBB,0x0E,0xD6,0x82,0xC7,0x78,0x3E,
+	0xF6,0x4A,0x7C,0xB9,0x60,0x3D,0xBE,0xCC,0x42,0xB1,0x92,
+	0xF2,0x35,0xCA,0xD6,0x60,0x28,0x18,0x86,0x8E,0xC1,0xCE,
+	0xD0,0xA1,0xEE,0x20,0x1C,0x0D,0x0E,0x84,0xBA,0x86,0x20,
+	0xD4,0xDB,0xD5,0x37,0xD0,0xD3,0x11,0x09,0x1D,0x0D,0x42,
+	0x1F,0xF6,0x1D,0x1B,0x08,0x45,0x82,0xD0,0xD1,0x7D,0xAC,
+	0x63,0x28,0x0C,0xBD,0x41,0xEC,0xC1,0x19,0x91,0xBE,0xE0,
+	0xF1,0x50,0x04,0x7A,0xFA,0x3A,0x83,0x30,0x10,0x0C,0x10,
+	0x1D,0x5E,0x4F,0x68,0x5E,0x37,0xBE,0x41,0x47,0xF8,0x49,
+	0x63,0x99,0xC1,0x70,0xB0,0xB3,0x23,0xD2,0x15,0x42,0xEE,
+	0x5D,0x1D,0xE1,0x08,0x74,0x0D,0x76,0x77,0x43,0xB8,0x3F,
+	0x18,0xEC,0x24,0x12,0x33,0x1B,0x81,0x30,0xAE,0xDB,0xD1,
+	0xDD,0x3B,0xD8,0x73,0x08,0x59,0x0F,0xF6,0xE3,0x84,0x20,
+	0x74,0x07,0x3B,0x68,0xF9,0xFE,0x48,0xA8,0xAF,0x37,0x6C,
+	0xBD,0x43,0x4F,0xB0,0xA7,0x0F,0x97,0x39,0x1C,0xEC,0x0D,
+	0x0E,0x10,0x91,0xF5,0x81,0x86,0x3A,0x9F,0x0C,0xF4,0x87,
+	0x7A,0x43,0x10,0x3B,0x1D,0x4D,0x89,0x92,0x08,0x0B,0x70,
+	0xEA,0xA3,0x86,0xA2,0xC1,0x46,0x60,0x2B,0xD6,0x03,0x5E,
+	0xC2,0x38,0x68,0x87,0xE1,0x46,0x18,0x86,0xC6,0x93,0xA8,
+	0xC5,0x5F,0xED,0x5B,0x01,0x57,0xF7,0x55,0xC1,0xC7,0xFB,
+	0x56,0xC1,0x9A,0x76,0x0E,0x36,0xB6,0x57,0xC3,0xEE,0xF6,
+	0x5A,0x08,0xB6,0xAF,0x81,0xA3,0xED,0x6B,0xA1,0xA2,0xBD,
+	0x06,0x46,0xDB,0x57,0xC3,0x5B,0xED,0x75,0xD0,0xB8,0xDF,
+	0x03,0x67,0xF7,0x7F,0x0D,0x5E,0xDC,0x6F,0x47,0x7D,0x3A,
+	0xAA,0xDD,0xA8,0xD7,0xDA,0xEA,0x0A,0xD4,0xEB,0xDE,0xEA,
+	0xF0,0xA4,0xA4,0xF1,0x13,0x8B,0x1E,0x92,0x10,0x25,0x0B,
+	0x4A,0xD0,0x4F,0x29,0xF0,0x2C,0x73,0xE3,0x0A,0x23,0xB6,
+	0x22,0x50,0x44,0xAD,0x59,0xCB,0x52,0x11,0x02,0xC6,0xB6,
+	0xFA,0x31,0xAD,0xA9,0x77,0x23,0xEC,0x1B,0x07,0x5A,0x30,
+	0x6E,0xA1,0x18,0x1B,0xE9,0x58,0x13,0x08,0x63,0x7E,0xF3,
+	0x78,0xFB,0xE3,0x90,0x4A,0x08,0x14,0xDE,0xCC,0x61,0xB4,
+	0x2B,0x61,0x04,0x9A,0xA2,0xA4,0xDB,0x30,0x1F,0x0D,0x58,
+	0xE6,0x2C,0x19,0x5C,0xB0,0xA3,0x39,0xD1,0x30,0x65,0xC9,
+	0x38,0x59,0x90,0xC6,0x0C,0x23,0x96,0x8C,0x98,0x46,0xA3,
+	0x31,0xD3,0x6E,0x70,0xFF,0x63,0x47,0x86,0xD9,0x8E,0x5D,
+	0x2A,0x82,0x04,0x65,0x12,0x04,0x92,0xA8,0xA8,0x41,0x89,
+	0xA8,0x0C,0x24,0x33,0x4F,0x17,0xE3,0x35,0xBC,0x71,0xAB,
+	0xA2,0x75,0xD1,0xA4,0x83,0x56,0x6A,0xD4,0x62,0x23,0xC6,
+	0x2F,0xBD,0xF6,0xBB,0xBF,0x44,0xDA,0x8E,0xEB,0x3D,0xEC,
+	0xFD,0xEF,0x4B,0x5E,0xE6,0xBE,0x0A,0x88,0x6E,0x7F,0x60,
+	0x5A,0x7F,0xDF,0x4B,0xF3,0xB2,0xD7,0x5F,0xB3,0x74,0x58,
+	0xC5,0x68,0x1C,0xC0,0x80,0xF8,0x27,0xCA,0x51,0x39,0x41,
+	0x69,0x0D,0xAA,0x4D,0xE4,0x13,0x4C,0x4A,0x27,0x31,0x6F,
+	0x25,0x98,0x25,0x07,0x86,0x46,0xD8,0xEC,0x6B,0x3E,0x8E,
+	0x54,0x68,0x83,0xCD,0x31,0xE8,0xEE,0xE8,0x3D,0x0C,0xBD,
+	0xDD,0xE1,0xFE,0x8E,0xC8,0xD7,0xA1,0x0D,0x4E,0xE0,0x8F,
+	0x02,0x7E,0x54,0x3B,0x6C,0x0A,0xC5,0xFC,0xE8,0x43,0xBD,
+	0xAD,0x4F,0xF8,0x02,0x6C,0xA7,0xAF,0x99,0x72,0xE1,0xA6,
+	0x1D,0x4D,0x3B,0x77,0xEC,0xDC,0xC9,0x9A,0x5A,0xFD,0xBB,
+	0x76,0xFB,0x77,0xB5,0x32,0xF5,0x34,0xCF,0x82,0x13,0x29,
+	0xE3,0x7D,0x13,0x74,0xA8,0x64,0x2A,0xC3,0xD9,0x79,0xDC,
+	0x4E,0xCC,0x6F,0x5C,0x73,0x8C,0xBC,0x85,0x3E,0xD0,0x29,
+	0x32,0xF0,0x59,0x4E,0xC4,0x24,0x3E,0x09,0x8A,0x20,0x21,
+	0xF3,0xE8,0x97,0x9E,0x26,0x09,0x99,0xA5,0xD3,0x4C,0x09,
+	0xBB,0x9B,0xC3,0x96,0x84,0x3B,0xCB,0x24,0xDC,0xD9,0xE4,
+	0x6F,0xFA,0xAA,0x12,0xC6,0x69,0xA1,0x44,0xB3,0xFA,0x50,
+	0xF2,0xE1,0xCD,0xB8,0x38,0xC7,0x90,0xED,0x58,0x08,0xB5,
+	0xD7,0xD1,0x1F,0xBA,0x9F,0x02,0x77,0x37,0x7F,0x45,0xF1,
+	0x94,0x14,0x64,0x44,0xD4,0x02,0x9F,0x12,0x49,0x11,0xB0,
+	0x98,0x9D,0xD5,0x53,0x61,0xF7,0x94,0x8A,0x83,0xA5,0xC5,
+	0x56,0x2C,0x56,0x87,0xC7,0x28,0x8E,0x65,0x8A,0x39,0xFE,
+	0xA8,0x51,0xAA,0x96,0x29,0x34,0xCA,0xE0,0xFF,0xBB,0x9C,
+	0xFF,0x06,0xBD,0xE8,0xD3,0x0A,0xDB,0x62,0x6F,0x95,0x07,
+	0x11,0xC4,0x56,0x51,0x6C,0x3F,0x8A,0x6D,0xDC,0x73,0xB1,
+	0xDD,0x80,0xED,0x80,0xCD,0x5E,0x6C,0xEF,0xC5,0xF6,0x21,
+	0x9B,0xA3,0xD8,0xFE,0xBA,0xA7,0x34,0xEB,0x3C,0x5E,0xD6,
+	0x1E,0x2B,0x6B,0x4F,0x94,0xB5,0x9F,0x2F,0x6B,0xBF,0x52,
+	0xD6,0x7E,0xB5,0xAC,0xFD,0xF7,0x65,0xED,0x7F,0x2C,0x6B,
+	0x5F,0x29,0x6B,0xE7,0xCB,0xDA,0x9F,0x97,0xB5,0xAB,0xD6,
+	0x95,0xB6,0x1F,0x2D,0x6B,0x37,0x94,0xB5,0xF7,0xAE,0xAB,
+	0x60,0x36,0x7C,0x39,0x7E,0x64,0xFB,0x51,0xE1,0x81,0x05,
+	0x0E,0xE2,0x0F,0x46,0x5F,0xA3,0xD4,0x46,0x30,0x53,0xF7,
+	0x6D,0xDA,0xB4,0x89,0x32,0xA1,0x42,0x79,0x92,0x5E,0x01,
+	0x81,0xBE,0x9E,0xFE,0x8E,0x23,0x66,0x6B,0xAD,0xCD,0xE6,
+	0xA8,0x74,0xA2,0xDF,0x78,0xD6,0x55,0xAE,0x2D,0x78,0x2B,
+	0x57,0xDB,0x4A,0xF8,0x56,0x56,0x96,0xAF,0x54,0x53,0xD8,
+	0x68,0xC3,0x0A,0xCB,0xDA,0x42,0xC1,0x66,0xAB,0xAC,0xB1,
+	0x99,0x1F,0xCD,0xB2,0xD1,0xAC,0xD6,0x16,0xA0,0x41,0x4A,
+	0x27,0x12,0x5B,0x01,0x3C,0x9E,0x0A,0xCF,0x3A,0x72,0x66,
+	0x1B,0x78,0xEC,0x0E,0xCF,0x8A,0xCA,0x85,0xE2,0x59,0x2C,
+	0x35,0x8F,0xD4,0x54,0xE1,0x9B,0xCB,0xE3,0x2D,0x76,0x71,
+	0x8B,0xA3,0xB5,0xEE,0x9A,0x9A,0x9A,0x2A,0xB7,0xC7,0xE3,
+	0xF4,0xAC,0x59,0x59,0xED,0xF1,0xAC,0xF6,0xAC,0x5A,0x1C,
+	0xBF,0x8F,0xFF,0xFD,0x0F,0x2E,0xCB,0xF8,0x40,
 };
 
 struct BuiltinFileBlob bfb_DISKCOPY_EXE = {
 	/*recommended file name*/	"DISKCOPY.EXE",
 	/*data*/			bin_diskcopy_exe,
-	/*length*/			sizeof(bin_diskcopy_exe)
+	/*length*/			42416,
+	/*compressed length*/	sizeof(bin_diskcopy_exe)
 };
@@ -2,2872 +2,3122 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_fdisk_exe[] = {
-  0x4d, 0x5a, 0x12, 0x00, 0x44, 0x00, 0x01, 0x00, 0x02, 0x00, 0x15, 0x12,
-  0xff, 0xff, 0xa2, 0x12, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x5e, 0x08, 0xb9, 0xce, 0x42, 0xbe,
-  0x9a, 0x85, 0x89, 0xf7, 0x1e, 0xa9, 0xb5, 0x80, 0x8c, 0xc8, 0x05, 0x05,
-  0x00, 0x8e, 0xd8, 0x05, 0x4f, 0x0a, 0x8e, 0xc0, 0xfd, 0xf3, 0xa5, 0xfc,
-  0x2e, 0x80, 0x6c, 0x12, 0x10, 0x73, 0xe7, 0x92, 0xaf, 0xad, 0x0e, 0x0e,
-  0x0e, 0x06, 0x1f, 0x07, 0x16, 0xbd, 0x0c, 0x00, 0xbb, 0xbf, 0x80, 0x55,
-  0xcb, 0x55, 0x50, 0x58, 0x21, 0x0d, 0x03, 0x03, 0x08, 0x6b, 0x23, 0x1d,
-  0x12, 0x7f, 0x0e, 0xf4, 0x31, 0x0a, 0x2a, 0x01, 0xeb, 0x84, 0x00, 0xf0,
-  0x2b, 0x01, 0x00, 0x63, 0xff, 0xba, 0xc1, 0x0d, 0x2e, 0x89, 0x16, 0x35,
-  0x02, 0xff, 0xb4, 0x30, 0xcd, 0x21, 0x8b, 0x2e, 0x02, 0x00, 0xff, 0x8b,
-  0x1e, 0x2c, 0x00, 0x8e, 0xda, 0xa3, 0x90, 0xff, 0x00, 0x8c, 0x06, 0x8e,
-  0x00, 0x89, 0x1e, 0x8a, 0x6f, 0x03, 0x2e, 0xa6, 0x00, 0xfd, 0xe8, 0x3d,
-  0x01, 0xc4, 0x3e, 0x88, 0xbf, 0x1b, 0xc7, 0x8b, 0xd8, 0xb9, 0xff, 0xff,
-  0x7f, 0xfc, 0xf2, 0xae, 0xe3, 0x61, 0x43, 0x26, 0xff, 0x38, 0x05, 0x75,
-  0xf6, 0x80, 0xcd, 0x80, 0xf7, 0xed, 0xd9, 0x89, 0x0e, 0x1a, 0xff, 0xb9,
-  0x01, 0x00, 0xd3, 0xe3, 0x83, 0xc3, 0x08, 0xed, 0x83, 0xe3, 0xf8, 0x34,
-  0xb7, 0x8c, 0x3c, 0xda, 0x2b, 0xff, 0xea, 0x8b, 0x3e, 0xd0, 0x4a, 0x81,
-  0xff, 0x00, 0xf6, 0x02, 0x73, 0x07, 0xbf, 0x04, 0xdf, 0x89, 0x0c, 0xc7,
-  0xff, 0xa2, 0xca, 0x72, 0x28, 0x03, 0x3e, 0xc8, 0x4a, 0xff, 0x72, 0x22,
-  0xb1, 0x04, 0xd3, 0xef, 0x47, 0x3b, 0xf7, 0xef, 0x72, 0x19, 0x83, 0x18,
-  0x76, 0x00, 0x74, 0x07, 0x06, 0xcb, 0xc8, 0x75, 0xb6, 0x0e, 0x29, 0x10,
-  0xdf, 0x14, 0x77, 0x07, 0x8b, 0xfd, 0xff, 0xeb, 0x03, 0xe9, 0x84, 0x01,
-  0x8b, 0xdf, 0x03, 0xb6, 0xda, 0x4d, 0x9e, 0xee, 0x86, 0xa2, 0x00, 0xa1,
-  0xdf, 0x8d, 0x2b, 0xd8, 0x8e, 0xc0, 0xed, 0xb4, 0x4a, 0x57, 0xa7, 0xff,
-  0x5f, 0xd3, 0xe7, 0xfa, 0x8e, 0xd2, 0x8b, 0xe7, 0xfd, 0xfb, 0x33, 0xc0,
-  0x2e, 0x8e, 0x06, 0xbe, 0xbb, 0xbf, 0xe0, 0x4d, 0xb9, 0xdf, 0x5a, 0x2b,
-  0xcf, 0xfc, 0xf3, 0xfb, 0xaa, 0xb4, 0x00, 0xcd, 0x1a, 0xce, 0x6d, 0x94,
-  0x32, 0xff, 0x0e, 0x96, 0x00, 0x33, 0xed, 0xb8, 0xbf, 0x0d, 0xfe, 0x8e,
-  0xd8, 0xbe, 0x00, 0x00, 0xbf, 0x18, 0xdd, 0xc2, 0xea, 0x00, 0xb2, 0x2b,
-  0x1e, 0xfe, 0x2e, 0xc6, 0x06, 0xe7, 0x01, 0x72, 0xeb, 0x05, 0xd6, 0xb1,
-  0x7b, 0xff, 0x36, 0x86, 0x03, 0xa6, 0x84, 0xb7, 0x82, 0x1f, 0xff, 0x0b,
-  0xfd, 0x50, 0xe8, 0x23, 0xb0, 0xb8, 0xc0, 0xf2, 0x31, 0x08, 0xcb, 0x08,
-  0xb8, 0x27, 0xff, 0xed, 0x16, 0x56, 0x49, 0x03, 0x9b, 0x58, 0x5a, 0x49,
-  0x63, 0x10, 0xe8, 0xb7, 0x72, 0x5a, 0xc0, 0x8b, 0xed, 0xf0, 0xb9, 0x2d,
-  0xd6, 0xff, 0x04, 0x80, 0xd4, 0x00, 0x46, 0xe2, 0xf8, 0x2d, 0xff, 0xa5,
-  0x0c, 0x74, 0x09, 0xb9, 0x19, 0x00, 0xba, 0x6e, 0x12, 0xe8, 0xc5, 0x17,
-  0x26, 0xec, 0xb4, 0xf6, 0x4c, 0x8a, 0x46, 0x02, 0xa7, 0xed, 0xb9, 0x0e,
-  0x11, 0xfd, 0x46, 0x00, 0xe9, 0xc1, 0x00, 0x1e, 0xb6, 0x4a, 0x35, 0x0e,
-  0xb6, 0xc6, 0x72, 0x1b, 0x55, 0x74, 0x00, 0xd8, 0xb8, 0x04, 0x0c, 0xcd,
-  0x76, 0x78, 0x2c, 0x05, 0x8c, 0x7a, 0xd2, 0x7c, 0xc8, 0x06, 0xcd, 0x7e,
-  0x80, 0x2f, 0x00, 0x25, 0x8c, 0x85, 0xca, 0x8a, 0xed, 0xba, 0x5c, 0x01,
-  0x13, 0xdd, 0x1f, 0xc3, 0x42, 0x25, 0xda, 0xc5, 0x16, 0x40, 0xe6, 0x0b,
-  0x0a, 0xcd, 0x04, 0x76, 0x27, 0x05, 0x34, 0x7a, 0x9c, 0x06, 0xd3, 0x7e,
-  0xff, 0xc3, 0xb4, 0xff, 0x8b, 0xd7, 0x8b, 0xde, 0xff, 0x3b, 0xdf, 0x74,
-  0x14, 0x80, 0x3f, 0xff, 0x74, 0xfe, 0x0a, 0x38, 0x67, 0x01, 0x77, 0x05,
-  0x8a, 0xdc, 0x04, 0x8b, 0xd3, 0x2f, 0xa1, 0x06, 0xeb, 0xe8, 0xff, 0x3b,
-  0xd7, 0x74, 0x20, 0x8b, 0xda, 0x1e, 0x07, 0x6f, 0x63, 0x3f, 0x00, 0xc6,
-  0xd8, 0x07, 0xff, 0xd3, 0x85, 0x81, 0xfe, 0x26, 0xff, 0x5f, 0x02, 0x1f,
-  0xeb, 0xc5, 0xd9, 0x06, 0x57, 0xad, 0xbe, 0x42, 0xee, 0x40, 0xbb, 0x02,
-  0x4b, 0xed, 0xc3, 0xb9, 0x1e, 0xc3, 0x84, 0x54, 0x08, 0xc2, 0x42, 0xf8,
-  0xff, 0xb8, 0x03, 0x00, 0x5c, 0x25, 0xf9, 0xfe, 0x28, 0x51, 0x5d, 0x3c,
-  0xc8, 0x04, 0xbf, 0x05, 0x56, 0xc7, 0x46, 0xfc, 0x00, 0xb5, 0x08, 0x04,
-  0xdd, 0x10, 0xff, 0x76, 0xfe, 0xbf, 0x02, 0xfc, 0x8b, 0x4e, 0x06, 0x8b,
-  0xff, 0x5e, 0x04, 0x8b, 0x56, 0x0a, 0x8b, 0x46, 0x08, 0xfb, 0xe8, 0x0a,
-  0xd8, 0x50, 0x52, 0x0a, 0x65, 0x0e, 0xfb, 0x0c, 0x59, 0x5b, 0xe8, 0xfd,
-  0x90, 0x7b, 0x5e, 0xfe, 0x8b, 0x21, 0x7f, 0xd1, 0xeb, 0xd1, 0xde, 0x03,
-  0xc6, 0xed, 0x13, 0xd3, 0x52, 0x47, 0xfb, 0x6a, 0xd4, 0x5e, 0xc9, 0xc3,
-  0x46, 0xd9, 0x45, 0x4d, 0x46, 0xb2, 0x29, 0x56, 0xf6, 0xe8, 0xd1, 0xda,
-  0x33, 0xb7, 0x4f, 0x4e, 0x04, 0xff, 0x03, 0xca, 0x13, 0xd8, 0x53, 0x51,
-  0xe8, 0x3a, 0xb3, 0xd4, 0x2e, 0xb6, 0x56, 0x6b, 0x0a, 0x59, 0x08, 0x3f,
-  0x33, 0xd2, 0xb8, 0x64, 0x0b, 0x74, 0x9f, 0xbb, 0xd7, 0x4f, 0x1a, 0xd4,
-  0xb7, 0x89, 0x48, 0x89, 0x56, 0xb2, 0xfe, 0x1e, 0xb9, 0x80, 0xf6, 0x0b,
-  0xd4, 0x81, 0xcb, 0x0a, 0x08, 0x3f, 0x3b, 0xd3, 0x72, 0xfc, 0x0e, 0x75,
-  0x04, 0x3b, 0xc6, 0x72, 0x6b, 0xb0, 0x32, 0x76, 0x01, 0x83, 0x33, 0xf6,
-  0x00, 0x83, 0x7e, 0x03, 0xfb, 0x72, 0x12, 0x77, 0x06, 0x07, 0x76, 0xfc,
-  0x64, 0x3f, 0xbb, 0x91, 0x64, 0x00, 0x22, 0xd6, 0x88, 0x8b, 0xb5, 0x0c,
-  0x83, 0xa8, 0x56, 0xff, 0xa1, 0x16, 0x5f, 0xba, 0x0c, 0x0b, 0xf7, 0xea,
-  0xe3, 0x05, 0x2a, 0xe9, 0x00, 0x7d, 0x6a, 0x00, 0x6a, 0x64, 0x84, 0xf0,
-  0xdf, 0x19, 0x85, 0x94, 0x93, 0xd3, 0x65, 0x1d, 0x39, 0xfb, 0xd6, 0xbe,
-  0x86, 0xd3, 0x0b, 0xc2, 0x74, 0xc9, 0x74, 0x0c, 0x9b, 0xd6, 0x02, 0xa9,
-  0xcb, 0x44, 0x54, 0xfb, 0x04, 0x83, 0xc2, 0x01, 0x15, 0x61, 0x42, 0x31,
-  0x84, 0x02, 0xdb, 0xd1, 0xfe, 0xee, 0x83, 0xc4, 0x0c, 0x76, 0x8d, 0x55,
-  0x4d, 0x6f, 0x92, 0x08, 0x14, 0x72, 0xa5, 0x23, 0x15, 0xfe, 0x81, 0x7e,
-  0x06, 0xe1, 0x7a, 0x76, 0x1a, 0xf7, 0x58, 0xdf, 0x37, 0x02, 0x06, 0xe8,
-  0xed, 0x28, 0xd3, 0x50, 0x59, 0xe1, 0x04, 0x52, 0x99, 0x5f, 0xbb, 0x9d,
-  0xd6, 0xeb, 0x19, 0x17, 0x0f, 0x43, 0x99, 0x76, 0xcb, 0x08, 0x06, 0x35,
-  0x86, 0xfd, 0x74, 0x01, 0xd3, 0x5d, 0xb2, 0xbe, 0x02, 0xff, 0xb4, 0x0f,
-  0xcd, 0x10, 0x88, 0x46, 0xff, 0xff, 0x88, 0x66, 0xfe, 0x80, 0x7e, 0xff,
-  0x07, 0x75, 0x6f, 0xe5, 0x06, 0x26, 0x5f, 0xb7, 0x01, 0x33, 0x07, 0xeb,
-  0xbe, 0x08, 0x09, 0x00, 0x5f, 0x0f, 0xe8, 0x89, 0xab, 0xb1, 0x59, 0x73,
-  0x73, 0x5d, 0x02, 0x7f, 0x04, 0xe8, 0x77, 0x7f, 0x59, 0x59, 0xf7, 0x8d,
-  0x46, 0x0a, 0x50, 0x6f, 0x76, 0xe8, 0x08, 0xbd, 0x0b, 0xb8, 0x47, 0x33,
-  0xfa, 0x1c, 0x06, 0x5a, 0x4b, 0xa6, 0x8d, 0x48, 0x6e, 0x67, 0x0d, 0xbc,
-  0xdb, 0xb3, 0x06, 0x0a, 0x1c, 0x68, 0xa8, 0x2e, 0x74, 0xbf, 0xac, 0xd9,
-  0x2f, 0xc9, 0x1b, 0x56, 0x30, 0x06, 0x29, 0x48, 0xf3, 0xdc, 0xbb, 0x25,
-  0xfa, 0x70, 0x85, 0xdd, 0x7f, 0x68, 0x8f, 0xb6, 0x32, 0x0b, 0x7d, 0xb3,
-  0x3e, 0x96, 0xab, 0x80, 0x60, 0xac, 0x63, 0x1c, 0xee, 0x06, 0x99, 0xdb,
-  0xef, 0xaa, 0x0e, 0xc6, 0x0f, 0x87, 0x06, 0x97, 0x02, 0x57, 0x33, 0x8f,
-  0xf6, 0x34, 0x87, 0x00, 0x5d, 0x8e, 0x1f, 0xc6, 0xad, 0x74, 0x2e, 0xed,
-  0x20, 0x05, 0xb8, 0x69, 0xed, 0xe9, 0x36, 0x05, 0x19, 0xe1, 0xc6, 0x82,
-  0xfa, 0x5a, 0x5d, 0x04, 0xfd, 0x4b, 0x9a, 0x81, 0x0b, 0x4b, 0x00, 0xdb,
-  0x7c, 0xef, 0x12, 0x33, 0x84, 0xff, 0xcc, 0xdb, 0x33, 0xd1, 0x9b, 0xe0,
-  0x03, 0xd8, 0x77, 0x35, 0x38, 0x3d, 0x74, 0xb0, 0x12, 0x10, 0x35, 0xbb,
-  0xea, 0x88, 0x83, 0x38, 0x59, 0x22, 0x0e, 0x75, 0x05, 0xe6, 0x38, 0x57,
-  0xd9, 0x47, 0x49, 0xb3, 0x0c, 0x1f, 0x2a, 0x74, 0xb0, 0xb4, 0x52, 0x25,
-  0xb6, 0x17, 0x22, 0x10, 0x47, 0x11, 0x61, 0x51, 0x72, 0x20, 0x6c, 0x8a,
-  0xa6, 0x32, 0xc8, 0x37, 0xec, 0x21, 0x9b, 0xa7, 0xfd, 0x8a, 0x74, 0x03,
-  0x98, 0x2f, 0x35, 0x53, 0xbb, 0x59, 0x7b, 0x0d, 0x93, 0x29, 0x85, 0x75,
-  0x04, 0xf8, 0x70, 0xff, 0x68, 0xae, 0x00, 0x56, 0x42, 0x1c, 0xa6, 0x0d,
-  0x85, 0xca, 0x3f, 0xfd, 0x0b, 0xc0, 0x75, 0x0d, 0x68, 0xb3, 0x83, 0x10,
-  0x38, 0x36, 0x68, 0xb6, 0xc1, 0x1d, 0xc8, 0xfc, 0xc9, 0x36, 0xbc, 0x2e,
-  0x5b, 0x1d, 0x67, 0xc0, 0x96, 0xfe, 0xde, 0x4f, 0x2e, 0x68, 0x90, 0xd4,
-  0x6c, 0xcd, 0x10, 0xe3, 0x06, 0x31, 0x66, 0x08, 0xd8, 0x68, 0xd7, 0x16,
-  0x32, 0xb6, 0x03, 0x00, 0x2d, 0xdb, 0x83, 0x3e, 0x9f, 0x21, 0xc8, 0xeb,
-  0x32, 0x8e, 0x4c, 0x0a, 0xf6, 0xee, 0x16, 0x0c, 0x77, 0x96, 0xf9, 0x3e,
-  0xf2, 0x06, 0x60, 0x43, 0x90, 0xfb, 0x64, 0x4f, 0x99, 0x3a, 0xec, 0xfe,
-  0xd0, 0x36, 0x16, 0x5b, 0x3e, 0xf2, 0x02, 0x01, 0x72, 0x21, 0x1e, 0x11,
-  0x01, 0x4e, 0x10, 0x49, 0x9e, 0x12, 0x14, 0xc1, 0x16, 0xc9, 0xf9, 0xc8,
-  0x6e, 0x3e, 0x90, 0x18, 0x6c, 0xe2, 0x16, 0xec, 0x1e, 0x24, 0xe1, 0x8a,
-  0x6b, 0x52, 0xce, 0xc2, 0xfa, 0x5d, 0xc2, 0xfa, 0x68, 0xdd, 0x0c, 0x05,
-  0x7f, 0xed, 0x7f, 0x06, 0x8a, 0x0e, 0xfb, 0xa2, 0x46, 0x5f, 0x68, 0x23,
-  0x2e, 0x06, 0xb3, 0x77, 0x6d, 0xd8, 0x32, 0x56, 0x32, 0xa2, 0x4d, 0x0c,
-  0xf6, 0x6d, 0x35, 0x16, 0x0c, 0x8b, 0x96, 0xf9, 0x6d, 0x39, 0x06, 0x74,
-  0x4e, 0x4a, 0x4e, 0x1c, 0x49, 0xdb, 0x75, 0x0c, 0x28, 0x1c, 0x33, 0x05,
-  0x66, 0x1e, 0x77, 0x11, 0x02, 0x7c, 0x11, 0x77, 0x05, 0x40, 0x7f, 0x0b,
-  0xb7, 0x8b, 0x20, 0x99, 0xa3, 0x68, 0x1a, 0x35, 0xe4, 0xb7, 0x18, 0x81,
-  0x28, 0x44, 0x01, 0xbf, 0x34, 0xa1, 0x34, 0x6f, 0x8b, 0x16, 0xda, 0x32,
-  0x6f, 0x11, 0xdd, 0x15, 0xa3, 0x1e, 0xb2, 0x99, 0x49, 0x0c, 0x19, 0x87,
-  0x53, 0x20, 0xc9, 0x08, 0x33, 0x24, 0xd8, 0x56, 0x16, 0x39, 0xf1, 0xc7,
-  0x2d, 0xd6, 0x99, 0x5a, 0x3e, 0x0e, 0xda, 0xc7, 0x41, 0xb0, 0x63, 0x27,
-  0x64, 0xc9, 0x9b, 0x26, 0x3e, 0xec, 0x66, 0x16, 0x19, 0xb2, 0x2d, 0xf2,
-  0x3e, 0x6a, 0x0c, 0x9b, 0x87, 0x75, 0x20, 0xc9, 0x8a, 0x33, 0x30, 0xd8,
-  0x78, 0x16, 0x32, 0x73, 0x5b, 0x3e, 0xe4, 0x7c, 0x19, 0x5c, 0x0e, 0x8c,
-  0x41, 0x92, 0x4b, 0x67, 0x34, 0xb0, 0x8f, 0x16, 0x64, 0x34, 0xb7, 0x3e,
-  0xc8, 0x93, 0x32, 0x1d, 0x2b, 0x15, 0xad, 0xa7, 0x2a, 0x90, 0x9f, 0x64,
-  0x09, 0x9e, 0x38, 0x5f, 0x04, 0xd9, 0x16, 0xa1, 0x07, 0xf2, 0xc6, 0x25,
-  0xcb, 0x05, 0xa3, 0x20, 0xc8, 0xdb, 0x0d, 0x06, 0xb2, 0x44, 0xa5, 0x0e,
-  0xc4, 0xc6, 0x4b, 0x96, 0x07, 0xa9, 0x41, 0x90, 0xad, 0x19, 0x48, 0x64,
-  0xae, 0x19, 0x96, 0x01, 0x96, 0x08, 0xb2, 0x41, 0x93, 0x7f, 0x93, 0x0c,
-  0x6c, 0xd1, 0x3e, 0xf6, 0xb5, 0xf9, 0x0e, 0x62, 0xc6, 0x41, 0xb0, 0xbc,
-  0x44, 0x64, 0x51, 0x9b, 0x1a, 0x27, 0xec, 0xbf, 0x16, 0x19, 0x3a, 0x2d,
-  0xf6, 0xf9, 0xc3, 0x3e, 0x0c, 0x23, 0x9f, 0x10, 0x6a, 0x02, 0x63, 0x26,
-  0x68, 0x06, 0xba, 0xf0, 0xe8, 0xf4, 0xc6, 0x35, 0x65, 0xff, 0x6a, 0x4d,
-  0xc2, 0x61, 0x65, 0x3f, 0x83, 0x09, 0xeb, 0xb0, 0x40, 0x7d, 0xb8, 0x23,
-  0xcc, 0xfa, 0xb6, 0xce, 0x5f, 0x0c, 0x6a, 0xe9, 0x56, 0x0c, 0x36, 0x6a,
-  0xcc, 0x0e, 0xd9, 0x0b, 0x14, 0x1b, 0x20, 0x05, 0x19, 0x26, 0x19, 0x32,
-  0x19, 0x2c, 0x1e, 0x36, 0x5f, 0xff, 0x6b, 0x3a, 0x2f, 0x19, 0x40, 0x1b,
-  0x10, 0x05, 0x11, 0x28, 0x23, 0xb4, 0xbc, 0x0a, 0x72, 0x05, 0xac, 0x8b,
-  0xba, 0xfe, 0x44, 0xa8, 0x29, 0xde, 0x31, 0xc7, 0x87, 0x48, 0xe6, 0x22,
-  0x0e, 0x03, 0x4a, 0x33, 0x14, 0x64, 0x4c, 0x2e, 0x4e, 0x46, 0x50, 0x42,
-  0xe4, 0x52, 0x66, 0x54, 0xfc, 0x46, 0x83, 0xfe, 0x08, 0x7c, 0xac, 0x1b,
-  0xf0, 0x17, 0x06, 0x10, 0xe0, 0x2e, 0x5f, 0x71, 0xee, 0xb5, 0xf8, 0xbe,
-  0xde, 0xf5, 0xfe, 0x05, 0x74, 0x2b, 0xdf, 0x04, 0x0f, 0x74, 0x26, 0x68,
-  0xdd, 0xc8, 0x01, 0x37, 0x09, 0x37, 0x05, 0xbc, 0x5f, 0x5b, 0xcd, 0x4c,
-  0x9a, 0xc5, 0xd1, 0xf9, 0x12, 0x11, 0xf2, 0xfc, 0x4d, 0xcc, 0x39, 0x04,
-  0x31, 0x7f, 0x7e, 0xc9, 0x68, 0xe1, 0x01, 0x68, 0xf7, 0xc5, 0x5f, 0xe8,
-  0x27, 0x24, 0xdb, 0xea, 0x0a, 0xe0, 0x2c, 0x1c, 0xf2, 0xf3, 0xcb, 0xe9,
-  0x11, 0x3c, 0xfc, 0xb2, 0xf2, 0xcf, 0x06, 0x05, 0xe5, 0x02, 0x68, 0xfb,
-  0xcd, 0xfb, 0xc4, 0x0e, 0x2f, 0x1f, 0x60, 0xe8, 0x9e, 0xf0, 0x17, 0x59,
-  0x28, 0x67, 0xe5, 0x96, 0x20, 0x3a, 0x59, 0xda, 0xe5, 0x29, 0x96, 0x43,
-  0xcf, 0x79, 0x32, 0x7c, 0x0d, 0x4e, 0xe8, 0xc4, 0xf2, 0x42, 0xcb, 0x40,
-  0xb9, 0x3c, 0x52, 0xb2, 0x51, 0xcf, 0xae, 0x62, 0x2c, 0x62, 0xb3, 0xa3,
-  0xcb, 0x72, 0x73, 0x2c, 0x98, 0xf2, 0x82, 0xcb, 0xb7, 0x8d, 0x3c, 0x92,
-  0xb2, 0xc8, 0xcf, 0x82, 0xa2, 0x2c, 0xea, 0xb3, 0x77, 0xdc, 0xb2, 0x8e,
-  0xd9, 0x0a, 0x6c, 0xbf, 0xe8, 0x2b, 0xf8, 0xe8, 0xf6, 0x17, 0x13, 0x57,
-  0xf0, 0xeb, 0xf8, 0x59, 0xa3, 0x16, 0x1c, 0xb0, 0x75, 0x12, 0x26, 0x60,
-  0xb3, 0x7a, 0x49, 0x29, 0x89, 0x40, 0x11, 0x68, 0xea, 0x9a, 0xe4, 0x02,
-  0x26, 0x44, 0xdc, 0xaa, 0xa3, 0x29, 0x3b, 0x74, 0x74, 0x0e, 0x7d, 0x06,
-  0x48, 0x4e, 0x77, 0x38, 0x99, 0x1b, 0x38, 0xe8, 0xd8, 0xb5, 0x32, 0x10,
-  0x4d, 0x06, 0xb2, 0x3c, 0x22, 0x33, 0x3c, 0x37, 0x1d, 0x65, 0x3c, 0xe2,
-  0xe8, 0x03, 0x3d, 0xcc, 0xfb, 0x3f, 0x98, 0x8b, 0x87, 0x34, 0x16, 0xfe,
-  0xfa, 0x97, 0x32, 0xe9, 0x3b, 0xef, 0x9c, 0x77, 0x25, 0x72, 0x06, 0xae,
-  0x3b, 0x79, 0xed, 0x73, 0x1d, 0xa1, 0x04, 0xb9, 0x0b, 0x10, 0x1b, 0x73,
-  0x68, 0xd2, 0xc2, 0x02, 0x55, 0xdb, 0xac, 0xaa, 0x06, 0x6d, 0x38, 0xeb,
-  0xb6, 0x06, 0x6a, 0x05, 0xfd, 0xcc, 0xa4, 0x59, 0x5e, 0x5d, 0x09, 0xe9,
-  0x33, 0x00, 0x51, 0xff, 0xb5, 0x49, 0x40, 0x6e, 0x66, 0xc0, 0x26, 0xd4,
-  0x66, 0x6a, 0xd1, 0x1b, 0xf5, 0x5e, 0xfc, 0x18, 0x7d, 0xb0, 0x9a, 0x2e,
-  0x1a, 0x48, 0x9f, 0xca, 0x3b, 0xe8, 0x68, 0xdf, 0x3c, 0x5d, 0x3d, 0x5d,
-  0xec, 0xb0, 0x00, 0xcf, 0x08, 0x54, 0xbb, 0xce, 0xe2, 0x4d, 0x03, 0x55,
-  0xbe, 0x13, 0x6a, 0x24, 0xe8, 0x9a, 0x2f, 0x60, 0x62, 0x14, 0xe8, 0x0c,
-  0x7e, 0x16, 0x5d, 0xa3, 0xd0, 0x15, 0x2b, 0x26, 0x1d, 0x7c, 0x0e, 0x68,
-  0xc7, 0x0c, 0xd3, 0x7c, 0xff, 0x68, 0xd0, 0x0c, 0xe8, 0x44, 0xa2, 0x59,
-  0x42, 0x21, 0x62, 0xdf, 0x58, 0x6a, 0x05, 0x68, 0x1d, 0xa3, 0x03, 0x76,
-  0xb6, 0xff, 0x77, 0xc4, 0xee, 0x46, 0xab, 0x1f, 0x4d, 0x4c, 0x05, 0xfa,
-  0x9a, 0x50, 0x46, 0xc1, 0x0d, 0xb6, 0x0f, 0xff, 0x8f, 0x8e, 0x52, 0x25,
-  0xf8, 0x80, 0x7f, 0x01, 0x3f, 0x15, 0xb1, 0x2d, 0x3c, 0x04, 0x4b, 0x35,
-  0x06, 0x77, 0x05, 0x03, 0x75, 0x3e, 0x49, 0x29, 0xab, 0x53, 0x6d, 0x46,
-  0xbe, 0x4e, 0xcd, 0x39, 0xc3, 0xf3, 0x28, 0x04, 0x76, 0x4e, 0x74, 0x0c,
-  0x0b, 0x4d, 0x6e, 0x3d, 0xf1, 0x14, 0x0f, 0x71, 0x01, 0xe1, 0xe8, 0x4d,
-  0x10, 0xbf, 0x74, 0x94, 0x21, 0x2e, 0xb0, 0xe8, 0xb0, 0x15, 0x91, 0xf5,
-  0x6d, 0x37, 0x2d, 0x20, 0xc2, 0xb1, 0x08, 0xf8, 0x7b, 0x52, 0x3c, 0xd3,
-  0xa0, 0x7f, 0x39, 0x5c, 0x75, 0x09, 0x8b, 0xc7, 0x40, 0xb6, 0x89, 0x11,
-  0xbf, 0x17, 0x2d, 0x4f, 0x0b, 0xc1, 0xff, 0x7d, 0xa2, 0x42, 0x56, 0xe3,
-  0x1a, 0x30, 0x8a, 0x0b, 0x18, 0x2b, 0x52, 0x4c, 0xfd, 0x88, 0x87, 0x86,
-  0x6b, 0x47, 0x9c, 0x3b, 0xc1, 0xbe, 0x3b, 0xc7, 0x73, 0xe2, 0x2d, 0x92,
-  0xdb, 0x80, 0xbd, 0x13, 0x2e, 0x16, 0xb3, 0xf9, 0xc6, 0x85, 0x86, 0x6b,
-  0x7e, 0x83, 0xff, 0x0c, 0x7c, 0xee, 0x2f, 0x18, 0xda, 0x7e, 0x1a, 0x19,
-  0xc1, 0x39, 0xfd, 0x88, 0x85, 0xce, 0x68, 0x47, 0x3b, 0xa8, 0x13, 0x5b,
-  0x14, 0xc6, 0x09, 0xb6, 0x00, 0xeb, 0x2a, 0xdc, 0x06, 0x06, 0x87, 0xde,
-  0xe8, 0x00, 0xfc, 0x59, 0xd9, 0x55, 0x04, 0xf1, 0xd3, 0x0d, 0xbc, 0x5c,
-  0xa3, 0xf4, 0x4d, 0x2b, 0x61, 0x03, 0x41, 0xad, 0x87, 0x0e, 0xfa, 0x51,
-  0x70, 0xe9, 0xdf, 0x04, 0x7a, 0xe1, 0x00, 0x6f, 0xd5, 0xa0, 0xe2, 0x69,
-  0x98, 0xad, 0x2d, 0x3b, 0x1b, 0x03, 0x83, 0xe9, 0xfb, 0x19, 0x76, 0x85,
-  0x7f, 0x91, 0x04, 0xd1, 0xe3, 0x2e, 0xff, 0xe2, 0xa7, 0x10, 0x13, 0x5d,
-  0x0f, 0x03, 0x68, 0xbd, 0x1a, 0xe8, 0xa5, 0xc1, 0x63, 0x7d, 0x3f, 0x6e,
-  0x3b, 0xf3, 0x69, 0xa5, 0x4e, 0xc3, 0x19, 0x75, 0xb3, 0x7d, 0xf1, 0x69,
-  0x01, 0x72, 0x10, 0x9e, 0x0f, 0x16, 0x77, 0x47, 0x04, 0x76, 0x16, 0x76,
-  0xc6, 0x2c, 0x1b, 0xe5, 0xcf, 0xaa, 0xb4, 0x09, 0xff, 0x2d, 0x7a, 0xa1,
-  0xb4, 0x12, 0x48, 0xbe, 0x9f, 0x6f, 0x6d, 0x59, 0xbe, 0x11, 0x1a, 0xc6,
-  0x32, 0x0f, 0x3a, 0xd8, 0x6d, 0x4d, 0xc9, 0x57, 0xc6, 0x1a, 0x10, 0x43,
-  0x9a, 0xf0, 0x7b, 0xe8, 0xbd, 0x6f, 0xdb, 0x3a, 0x75, 0xa2, 0x28, 0x64,
-  0x73, 0x64, 0x2e, 0xc2, 0xc8, 0xec, 0xf2, 0x10, 0x43, 0xf6, 0xee, 0x0e,
-  0x1a, 0xc8, 0x78, 0xc8, 0x13, 0xae, 0x30, 0xb7, 0xf3, 0x38, 0x59, 0x0f,
-  0x67, 0x1d, 0xd0, 0x2e, 0xe9, 0xe4, 0x5b, 0x7d, 0x3b, 0x1c, 0xf2, 0xc0,
-  0x8c, 0x23, 0x6c, 0x50, 0x10, 0xcd, 0x99, 0x96, 0x83, 0x35, 0x46, 0x16,
-  0x51, 0x6b, 0x8a, 0x4f, 0xfb, 0xe8, 0x63, 0xfd, 0x52, 0xa6, 0x9b, 0xb1,
-  0xbe, 0x31, 0x92, 0xc0, 0x19, 0xc7, 0x64, 0x03, 0x72, 0xe4, 0xa1, 0xe7,
-  0xb1, 0x0f, 0x9e, 0x31, 0x69, 0x6c, 0x02, 0x04, 0xe3, 0xe9, 0x40, 0x9f,
-  0xc2, 0xe8, 0xd4, 0x03, 0x9a, 0xbe, 0x0c, 0xc6, 0x14, 0x79, 0x77, 0x99,
-  0xcb, 0x59, 0x0f, 0x93, 0x12, 0x9a, 0x36, 0x4a, 0x5b, 0x11, 0x35, 0x19,
-  0x58, 0x34, 0xba, 0xb5, 0x23, 0x4c, 0xdb, 0x3d, 0x47, 0x20, 0x3b, 0x15,
-  0x53, 0xa4, 0x1c, 0x64, 0x3a, 0x3c, 0x6d, 0x07, 0xf2, 0x23, 0x32, 0x25,
-  0x1c, 0x05, 0xb9, 0xeb, 0x95, 0x3c, 0xe2, 0x0d, 0xb5, 0xf6, 0xcc, 0xae,
-  0x20, 0x64, 0x04, 0x38, 0xe4, 0xdd, 0xde, 0x01, 0x04, 0xdb, 0x20, 0xe9,
-  0xdb, 0x1a, 0x64, 0x2c, 0x72, 0xe9, 0xbf, 0x0e, 0xc9, 0x02, 0x92, 0x70,
-  0x30, 0x6b, 0x01, 0xd3, 0xb0, 0x49, 0x6e, 0xd6, 0x73, 0x01, 0xe2, 0xed,
-  0xe9, 0xa9, 0x31, 0x91, 0x32, 0x90, 0xb7, 0xed, 0x97, 0x4c, 0xcf, 0x03,
-  0x09, 0x8e, 0x6c, 0x1a, 0x37, 0x8c, 0x9c, 0xef, 0x9d, 0xcf, 0x85, 0x04,
-  0x3b, 0x63, 0x2f, 0x87, 0x21, 0xe9, 0x67, 0x02, 0xc4, 0xed, 0x00, 0x4e,
-  0xd2, 0x67, 0x04, 0xcd, 0x6f, 0x3b, 0x03, 0x1b, 0x58, 0x40, 0x26, 0xce,
-  0x60, 0x1e, 0xcd, 0xf9, 0x41, 0xcb, 0x20, 0x0d, 0x44, 0x63, 0x56, 0x45,
-  0x21, 0xe7, 0xbe, 0x08, 0xb1, 0x4b, 0x14, 0x93, 0x30, 0xab, 0x1b, 0xce,
-  0x0c, 0x0b, 0x75, 0x9e, 0x83, 0x59, 0x91, 0x36, 0x3e, 0x79, 0xe1, 0x0c,
-  0x6c, 0x50, 0x80, 0x64, 0x06, 0x3b, 0xe6, 0x15, 0x77, 0xb1, 0x08, 0xb0,
-  0xf9, 0xdd, 0x01, 0x68, 0x55, 0x1c, 0xeb, 0xbe, 0x83, 0xf3, 0x23, 0x59,
-  0x63, 0x14, 0xd6, 0x3b, 0xb0, 0xf2, 0xb6, 0x01, 0x0c, 0xd5, 0x80, 0xdb,
-  0xa1, 0x3b, 0x5e, 0x63, 0x26, 0xaf, 0x21, 0xcd, 0x8f, 0x30, 0x30, 0xc8,
-  0xb0, 0x7e, 0xe9, 0x78, 0xe8, 0x0c, 0x6d, 0x1b, 0x3c, 0xc4, 0x9f, 0x2d,
-  0x6c, 0xb2, 0x70, 0x60, 0x32, 0x7a, 0x1f, 0xde, 0x45, 0xe8, 0xf6, 0xe3,
-  0xfa, 0x68, 0x67, 0x49, 0x32, 0x65, 0x1d, 0x45, 0xbb, 0xa0, 0x26, 0x1c,
-  0xbe, 0x39, 0x22, 0x55, 0xad, 0xd6, 0xa6, 0x91, 0x6c, 0x90, 0x44, 0xf3,
-  0x55, 0x08, 0xd8, 0x74, 0x14, 0xce, 0x2f, 0x1f, 0x30, 0x38, 0x1c, 0x67,
-  0xf1, 0xef, 0x96, 0x0b, 0x79, 0xc6, 0x1a, 0x14, 0x43, 0xc9, 0x4a, 0x0f,
-  0xcd, 0xd4, 0x82, 0x23, 0xf9, 0x90, 0xbd, 0x72, 0x02, 0x1c, 0x73, 0xb9,
-  0x48, 0x87, 0xce, 0xde, 0xf9, 0x65, 0x79, 0x1b, 0x8e, 0x14, 0x19, 0xc9,
-  0xdf, 0x9b, 0xa9, 0x6c, 0xc9, 0x8e, 0x23, 0x3c, 0xa0, 0x6c, 0x1a, 0x93,
-  0x8c, 0xae, 0x87, 0x8e, 0x2c, 0xd6, 0x8c, 0x85, 0xb6, 0x9c, 0x4a, 0x32,
-  0x93, 0x69, 0x1c, 0x70, 0x42, 0x09, 0xdb, 0x01, 0xc2, 0x9e, 0x62, 0x6c,
-  0x9e, 0x17, 0x64, 0x7b, 0xe2, 0x5e, 0xcc, 0xd5, 0x19, 0xb7, 0x58, 0x40,
-  0xc0, 0xed, 0x20, 0x98, 0xd0, 0xeb, 0x35, 0xad, 0xb0, 0x37, 0x96, 0xf7,
-  0x43, 0x4c, 0x09, 0x49, 0x76, 0x03, 0x1c, 0xb6, 0xdc, 0x1c, 0x4f, 0xf7,
-  0x0a, 0xd0, 0xeb, 0x0c, 0xa2, 0x93, 0x5e, 0x10, 0x74, 0xa6, 0x59, 0xeb,
-  0x0d, 0x55, 0x6c, 0x74, 0x0b, 0xf6, 0xd6, 0x9f, 0xd0, 0x10, 0xc8, 0x63,
-  0xca, 0x44, 0xb1, 0xd4, 0xb7, 0x7e, 0xa8, 0x34, 0xfb, 0x06, 0x40, 0xc8,
-  0x40, 0xe8, 0x72, 0x6b, 0xdb, 0x6c, 0x44, 0x9a, 0xa5, 0x27, 0x43, 0x04,
-  0xfe, 0xa9, 0x12, 0xd1, 0x12, 0x47, 0x0e, 0xde, 0x03, 0xfa, 0x0e, 0x94,
-  0x97, 0x78, 0x0f, 0x03, 0xdd, 0x10, 0xd1, 0x0f, 0x35, 0x63, 0x05, 0x50,
-  0xd8, 0x10, 0x8c, 0x07, 0xff, 0x01, 0x11, 0x3d, 0x11, 0x72, 0x11, 0xa8,
-  0xdc, 0x11, 0x3e, 0x0b, 0xfd, 0x01, 0x59, 0x12, 0x0f, 0x38, 0x57, 0x86,
-  0xbf, 0x28, 0xb1, 0xf8, 0xa2, 0xc8, 0xa0, 0xbc, 0xd7, 0x32, 0xd7, 0x09,
-  0x10, 0x56, 0xf7, 0xe2, 0x74, 0x29, 0xd8, 0x4e, 0x04, 0xd9, 0x84, 0xa5,
-  0x6d, 0xfe, 0x06, 0x9b, 0xda, 0x0b, 0x05, 0xcd, 0xe8, 0xd3, 0x0d, 0x2c,
-  0xcc, 0xd2, 0x20, 0xef, 0xc5, 0xa5, 0x9d, 0xdb, 0xa6, 0x9d, 0x0c, 0x22,
-  0xbe, 0x05, 0x40, 0x5f, 0x4e, 0x24, 0xe8, 0xd4, 0xbf, 0x0d, 0xec, 0xda,
-  0xe8, 0x7d, 0xe2, 0x2e, 0xff, 0xfb, 0x40, 0x7e, 0xf5, 0x68, 0x26, 0x33,
-  0x66, 0x98, 0xb6, 0x28, 0x06, 0x91, 0x6f, 0x44, 0x05, 0xeb, 0x31, 0x06,
-  0xe8, 0xb5, 0x65, 0xb6, 0xc0, 0x0b, 0x13, 0xcb, 0x46, 0x7d, 0x35, 0x48,
-  0xb2, 0x06, 0x76, 0xb5, 0x15, 0xaf, 0x77, 0x19, 0xdb, 0x68, 0x4d, 0x0e,
-  0x67, 0x83, 0xa5, 0xe5, 0xed, 0x52, 0x1e, 0x9a, 0x5e, 0x63, 0xd9, 0x06,
-  0x57, 0x7d, 0x57, 0xe8, 0xcd, 0x09, 0xc0, 0xed, 0xe9, 0xf3, 0x04, 0xc1,
-  0x60, 0xd5, 0x30, 0xf8, 0x23, 0xba, 0x77, 0x93, 0x32, 0x6b, 0x08, 0xbc,
-  0x6d, 0x65, 0x39, 0x9a, 0x24, 0x67, 0xd9, 0x06, 0x1d, 0xa5, 0x87, 0x9a,
-  0x16, 0x89, 0x59, 0x0f, 0xa5, 0x9c, 0xd7, 0x08, 0xa5, 0xfa, 0xe5, 0xe9,
-  0x9c, 0xb5, 0x19, 0x08, 0x6f, 0x07, 0xb4, 0x63, 0x59, 0x10, 0x9e, 0x85,
-  0x75, 0x18, 0xd8, 0x02, 0x16, 0x2c, 0xcd, 0xf6, 0x47, 0xee, 0x83, 0xc1,
-  0x08, 0x37, 0xcd, 0xf5, 0x69, 0x64, 0xc1, 0x75, 0x59, 0x9c, 0x0d, 0x15,
-  0x9e, 0x64, 0x76, 0x19, 0xcb, 0xc1, 0x06, 0xf1, 0x9c, 0x15, 0x86, 0xfd,
-  0x8b, 0x99, 0x4e, 0x5b, 0x08, 0x77, 0x8b, 0x12, 0x56, 0x9d, 0x16, 0x73,
-  0xba, 0x0a, 0x10, 0xa3, 0xdb, 0x07, 0x89, 0x13, 0x9d, 0x09, 0x52, 0xee,
-  0x50, 0x8b, 0x0e, 0x08, 0xb4, 0x1e, 0x10, 0x42, 0x97, 0x21, 0x34, 0x60,
-  0xc5, 0xb7, 0xdf, 0x21, 0xc2, 0x60, 0x21, 0xb0, 0xf6, 0xed, 0x6a, 0xf5,
-  0xcc, 0x93, 0x4d, 0x1b, 0x55, 0xe4, 0x08, 0x74, 0xe8, 0xc9, 0xb3, 0x06,
-  0x82, 0x76, 0x2a, 0xed, 0x45, 0xdb, 0x9e, 0xd8, 0x36, 0x96, 0xa4, 0xa0,
-  0xd9, 0x06, 0x2f, 0xa5, 0xc0, 0x9a, 0x28, 0xc2, 0x59, 0x21, 0xad, 0xd5,
-  0xed, 0xcf, 0x1a, 0xa4, 0xfb, 0xa1, 0x9b, 0x7d, 0xbd, 0x58, 0xe8, 0x70,
-  0x61, 0xb2, 0xea, 0xfa, 0xf1, 0xfc, 0xff, 0xb5, 0xad, 0x14, 0x03, 0xdc,
-  0x10, 0x01, 0xe9, 0xdf, 0xec, 0xfa, 0xe8, 0x5a, 0xed, 0x20, 0x55, 0xa9,
-  0xbc, 0xa8, 0xfa, 0xe7, 0x42, 0xec, 0x64, 0x34, 0xc1, 0x1c, 0x68, 0xd7,
-  0x63, 0x2c, 0x32, 0xa4, 0xba, 0x7b, 0x6c, 0x1b, 0xfb, 0x9b, 0x00, 0x09,
-  0x0d, 0x2c, 0x00, 0x65, 0x37, 0x03, 0x50, 0xeb, 0x11, 0x75, 0xf6, 0x02,
-  0x92, 0x15, 0xd0, 0x03, 0xa2, 0x16, 0xdb, 0xca, 0x46, 0x19, 0x83, 0x9b,
-  0x0d, 0x7a, 0x84, 0x07, 0x1e, 0x22, 0xe1, 0xdc, 0x09, 0x72, 0x17, 0xa3,
-  0xdb, 0xde, 0x06, 0x10, 0x34, 0xfe, 0xb3, 0x09, 0x56, 0x00, 0x28, 0xdd,
-  0x02, 0x06, 0x13, 0x2e, 0xfb, 0xa2, 0x1f, 0x1e, 0xdc, 0x9a, 0x2e, 0x0c,
-  0x57, 0x1b, 0x7c, 0xa7, 0x61, 0x84, 0x59, 0x21, 0x11, 0x98, 0x0c, 0x4f,
-  0x1f, 0x3a, 0xec, 0x21, 0x10, 0xe6, 0x99, 0xc3, 0xc8, 0x14, 0xc0, 0x79,
-  0x15, 0x06, 0xf2, 0x12, 0xb9, 0x32, 0x26, 0x00, 0xe7, 0x35, 0x64, 0x46,
-  0x3f, 0xd8, 0x4b, 0x06, 0xeb, 0x3a, 0x65, 0x65, 0x61, 0x17, 0x2a, 0x2b,
-  0xc8, 0x4a, 0x4b, 0x3a, 0x9a, 0x06, 0x69, 0x32, 0xc9, 0x2b, 0x43, 0xa1,
-  0x6c, 0x68, 0x1a, 0x6a, 0x70, 0xa7, 0xb8, 0x20, 0x06, 0xc2, 0x96, 0x45,
-  0xb5, 0x39, 0x2f, 0xfb, 0x08, 0x6a, 0x74, 0xa1, 0x3e, 0x09, 0x72, 0x08,
-  0x6a, 0x0e, 0x06, 0x6a, 0x45, 0xf9, 0x0f, 0x20, 0x77, 0x14, 0x2d, 0x09,
-  0x17, 0xb9, 0x67, 0x08, 0x6a, 0xf0, 0x68, 0x1e, 0xbb, 0x3d, 0xbd, 0xa1,
-  0x6a, 0x83, 0x3f, 0x77, 0x9c, 0x99, 0x59, 0x3f, 0x42, 0x48, 0xb9, 0xc4,
-  0x4b, 0x76, 0xb9, 0xeb, 0x1c, 0x8d, 0x06, 0xc0, 0xba, 0x35, 0x32, 0x11,
-  0x17, 0xf3, 0x03, 0xd8, 0x46, 0x97, 0xfb, 0x20, 0xe8, 0x2a, 0x72, 0x66,
-  0xfe, 0x04, 0x46, 0x89, 0x7e, 0xfc, 0x86, 0xe4, 0xeb, 0x04, 0x7c, 0xdf,
-  0xe6, 0xab, 0x08, 0x00, 0x5b, 0x40, 0x7c, 0xeb, 0xa1, 0xeb, 0x1b, 0x28,
-  0x7f, 0x01, 0x7e, 0x10, 0x56, 0x68, 0x64, 0x6c, 0x0d, 0x6e, 0x4a, 0xab,
-  0x1f, 0x8d, 0x4e, 0x99, 0xd3, 0xeb, 0x06, 0x83, 0xe1, 0xa1, 0x54, 0xa2,
-  0x6c, 0xa4, 0xa7, 0x72, 0xff, 0xb7, 0x0c, 0x82, 0x0b, 0x60, 0x03, 0xa9,
-  0x00, 0x75, 0xe4, 0x04, 0xe4, 0x05, 0xf8, 0x06, 0x75, 0x19, 0x56, 0x5e,
-  0x72, 0x5e, 0x83, 0x7f, 0xb5, 0xa3, 0xab, 0xbf, 0x86, 0x6d, 0x60, 0x40,
-  0xd4, 0xeb, 0x40, 0x80, 0xa3, 0x76, 0x26, 0x2d, 0x47, 0x74, 0xb2, 0x12,
-  0x11, 0x1e, 0x0f, 0x75, 0x02, 0x25, 0x60, 0xb7, 0x4e, 0xa6, 0x7d, 0x92,
-  0x70, 0x03, 0x16, 0x91, 0xa8, 0xdd, 0x9c, 0xd1, 0xa0, 0xfb, 0x9b, 0xb2,
-  0x98, 0x93, 0x64, 0xe3, 0x64, 0x6b, 0x70, 0x75, 0x41, 0x9c, 0x2f, 0x23,
-  0x87, 0x1a, 0x63, 0x0f, 0x77, 0x93, 0x13, 0xe1, 0x17, 0x77, 0x0a, 0x18,
-  0x10, 0xbc, 0xe9, 0x4c, 0xeb, 0x16, 0x24, 0x39, 0xcb, 0xe7, 0x83, 0x93,
-  0xa0, 0xbb, 0x62, 0x4f, 0x2b, 0x07, 0x3c, 0x1b, 0x9c, 0x63, 0x91, 0x32,
-  0x04, 0x1f, 0x85, 0x53, 0xeb, 0xb3, 0x38, 0x29, 0x93, 0x25, 0xe4, 0x05,
-  0x72, 0x1c, 0xe4, 0x15, 0xf9, 0x1c, 0x77, 0x0c, 0xb1, 0x05, 0xfb, 0x5b,
-  0xb4, 0x1d, 0x83, 0x4c, 0x64, 0xb5, 0x2f, 0x07, 0xac, 0xff, 0xc1, 0x75,
-  0xf0, 0x97, 0xea, 0xf5, 0xd8, 0x05, 0x59, 0x24, 0x41, 0x11, 0x3d, 0x30,
-  0x69, 0x8e, 0x82, 0x98, 0xb6, 0x0c, 0xfa, 0xe3, 0xbe, 0x51, 0x41, 0x9f,
-  0xe5, 0xe8, 0x88, 0x80, 0x0b, 0x45, 0x53, 0x6d, 0x2a, 0x5e, 0x58, 0x91,
-  0x8f, 0xff, 0xa9, 0x00, 0x78, 0x6e, 0x81, 0x06, 0xd4, 0xff, 0x00, 0xd6,
-  0x12, 0x6e, 0x52, 0xe7, 0xbc, 0x9f, 0x95, 0x9d, 0xad, 0xd7, 0x14, 0x52,
-  0x16, 0x7c, 0xe4, 0x5f, 0x59, 0x1f, 0x1c, 0x1d, 0x6b, 0x35, 0x34, 0x35,
-  0x25, 0x58, 0x1d, 0xab, 0xb2, 0x45, 0x76, 0x32, 0x57, 0xbd, 0x61, 0xae,
-  0x23, 0x1a, 0x91, 0xf5, 0xb6, 0xec, 0x60, 0x5b, 0x46, 0x3c, 0x4c, 0x7b,
-  0xe2, 0xbb, 0xb0, 0x83, 0x60, 0x27, 0x29, 0xba, 0xb0, 0x03, 0x62, 0x01,
-  0x9a, 0x40, 0x32, 0xad, 0x2c, 0xb1, 0x13, 0x62, 0xc8, 0xf4, 0x96, 0xd1,
-  0x00, 0xee, 0x22, 0x69, 0xb0, 0x00, 0x6f, 0x17, 0x27, 0xcb, 0x60, 0xeb,
-  0xbf, 0x9e, 0x6f, 0xcc, 0x96, 0x24, 0xf8, 0xe8, 0xfe, 0x13, 0x59, 0x32,
-  0x9d, 0xed, 0x95, 0x21, 0xdc, 0xc9, 0x9e, 0x7d, 0xe6, 0x1d, 0x0c, 0xcb,
-  0xaf, 0xbc, 0xb1, 0x9e, 0xec, 0xc9, 0x30, 0x03, 0xa1, 0xd0, 0x27, 0xf3,
-  0x94, 0x89, 0x59, 0xa1, 0xb7, 0xd0, 0x61, 0x05, 0x77, 0x68, 0xb4, 0x08,
-  0x21, 0x6e, 0xf2, 0x68, 0x35, 0xe1, 0xe8, 0x39, 0x7c, 0x19, 0xb2, 0x03,
-  0x03, 0x04, 0x36, 0xcc, 0x5f, 0xe1, 0x5c, 0x9e, 0x19, 0xf2, 0x3d, 0x96,
-  0x47, 0x0e, 0x6d, 0x14, 0x41, 0x8c, 0xa9, 0x22, 0x96, 0xa7, 0xc0, 0x84,
-  0x5f, 0x19, 0xf2, 0xa0, 0x02, 0x76, 0x56, 0xc1, 0x32, 0x9b, 0xaf, 0xbc,
-  0x0f, 0xbc, 0x48, 0xbb, 0x3b, 0x2c, 0x75, 0x21, 0x64, 0xcf, 0xdb, 0x55,
-  0x41, 0xf9, 0xb0, 0x9d, 0xcf, 0xfe, 0x69, 0x09, 0xe8, 0xec, 0x9d, 0x6e,
-  0x15, 0xeb, 0x41, 0xc9, 0x20, 0x96, 0x6e, 0xd8, 0x49, 0x96, 0x86, 0xcb,
-  0x7e, 0x14, 0xeb, 0x20, 0x49, 0x96, 0x8b, 0xb7, 0x74, 0xb6, 0xc0, 0x9f,
-  0x1d, 0xcc, 0xad, 0x97, 0x48, 0x05, 0x1e, 0x50, 0xb8, 0x73, 0x89, 0x95,
-  0xc1, 0x35, 0xa3, 0x56, 0x5b, 0x21, 0xd1, 0x8d, 0x6e, 0xb3, 0x72, 0x3c,
-  0x08, 0x7c, 0x70, 0x0c, 0x0b, 0x8e, 0x36, 0x6f, 0x21, 0x31, 0x3f, 0xeb,
-  0xe8, 0x4b, 0x2d, 0xf0, 0xe8, 0x90, 0x62, 0x5e, 0x18, 0xdd, 0x20, 0x3c,
-  0x5f, 0x42, 0xa1, 0x3f, 0xff, 0x4e, 0x06, 0x83, 0x46, 0xd7, 0x04, 0x02,
-  0x5f, 0x56, 0x38, 0x16, 0xd7, 0x09, 0x62, 0x44, 0x15, 0x32, 0x29, 0x15,
-  0x99, 0xbb, 0x6b, 0x0f, 0xb4, 0x76, 0x99, 0x0f, 0xbc, 0x4c, 0x0b, 0x8e,
-  0x00, 0x2c, 0x87, 0x8b, 0x14, 0x2e, 0xf5, 0x65, 0xdf, 0x7b, 0x14, 0x7c,
-  0xc3, 0xe9, 0x54, 0x80, 0x01, 0xd6, 0x63, 0x08, 0xcc, 0x03, 0x89, 0x8e,
-  0xa3, 0x37, 0xe2, 0x6d, 0x32, 0x40, 0x85, 0x3d, 0xb7, 0xfb, 0x75, 0x33,
-  0x8a, 0x04, 0x98, 0x2b, 0x7e, 0x8a, 0x87, 0x55, 0x48, 0x98, 0xad, 0x32,
-  0x6d, 0x0e, 0x0f, 0xb2, 0xd3, 0xa5, 0xeb, 0xd9, 0x9c, 0x94, 0x18, 0xb9,
-  0x57, 0xd1, 0x1d, 0x7b, 0x05, 0x4f, 0x00, 0xa3, 0x8b, 0x5b, 0xc0, 0x10,
-  0x33, 0x8f, 0x74, 0xfe, 0xe9, 0xbd, 0x07, 0x80, 0x3c, 0x2d, 0x46, 0xb4,
-  0xf7, 0x3c, 0x2f, 0x74, 0x2d, 0x4b, 0xc9, 0xab, 0x27, 0x8b, 0x2d, 0x46,
-  0xac, 0xa8, 0x4e, 0x06, 0x0c, 0x5b, 0x05, 0x25, 0x7b, 0x5f, 0x75, 0x30,
-  0x82, 0x7b, 0x0e, 0x7d, 0x27, 0x18, 0x9b, 0xb5, 0x3d, 0x12, 0x99, 0xa8,
-  0x5b, 0x0c, 0xfe, 0xa1, 0x07, 0x58, 0x88, 0xb5, 0x81, 0xca, 0x97, 0x0e,
-  0xc6, 0xdb, 0x81, 0xe3, 0xb0, 0x46, 0xed, 0x47, 0xeb, 0xbc, 0x34, 0x44,
-  0xd7, 0x26, 0x97, 0x67, 0x5f, 0x3a, 0x62, 0xf8, 0x2c, 0x48, 0x9c, 0x28,
-  0xcd, 0xb9, 0xd8, 0x9b, 0xa5, 0x44, 0xcb, 0xbb, 0x52, 0xdd, 0xf7, 0xeb,
-  0x45, 0x5a, 0xc1, 0x89, 0x97, 0xce, 0x4c, 0xfc, 0xec, 0xeb, 0x01, 0x46,
-  0xcd, 0x2e, 0xf0, 0xed, 0x49, 0x74, 0x50, 0xb3, 0x46, 0x2c, 0xf9, 0x17,
-  0x0a, 0xe8, 0x01, 0x3c, 0xe1, 0x93, 0xfb, 0x54, 0xa5, 0x8b, 0x09, 0x6c,
-  0x40, 0xf5, 0x84, 0x2e, 0x3b, 0x97, 0x36, 0xc5, 0x9b, 0x23, 0xa5, 0x2d,
-  0xff, 0xa1, 0x34, 0x94, 0xc3, 0x9b, 0xe8, 0x7e, 0x06, 0xfd, 0xa7, 0xa3,
-  0xfe, 0x68, 0x1f, 0x7c, 0xad, 0x7c, 0x09, 0x1c, 0x71, 0x25, 0x03, 0xe3,
-  0x28, 0x5f, 0x7e, 0xad, 0x6d, 0x5f, 0x31, 0x94, 0x93, 0x5d, 0xe3, 0x74,
-  0x6b, 0x30, 0x65, 0x96, 0x78, 0x1e, 0x57, 0x8b, 0xb4, 0x85, 0x6e, 0x05,
-  0xeb, 0x64, 0x36, 0x07, 0x03, 0x12, 0xcc, 0xda, 0x0c, 0x12, 0xd7, 0xf1,
-  0x37, 0xb2, 0xec, 0x4e, 0x1c, 0xc4, 0x38, 0xc5, 0x99, 0x3c, 0xce, 0xde,
-  0x23, 0x64, 0xef, 0xc3, 0x89, 0xed, 0x5e, 0x58, 0xef, 0xc2, 0x27, 0x6c,
-  0xf5, 0x47, 0xd9, 0xcc, 0x7f, 0x46, 0xb8, 0x14, 0x00, 0x2b, 0xfd, 0xc7,
-  0x3b, 0xc6, 0x7f, 0x93, 0x29, 0x4c, 0x4f, 0xd9, 0x80, 0x5d, 0x36, 0x7d,
-  0x8b, 0x3c, 0x09, 0x0b, 0xeb, 0x21, 0x7d, 0x0f, 0x36, 0xff, 0x37, 0xd6,
-  0xd1, 0xe2, 0x03, 0xc2, 0x05, 0xbd, 0x35, 0xbf, 0xa2, 0x51, 0xb6, 0xd6,
-  0x24, 0x16, 0x01, 0xed, 0x12, 0x74, 0xd9, 0x96, 0x94, 0xb9, 0x2d, 0x3b,
-  0x4d, 0xf0, 0x9a, 0xa3, 0x92, 0xf1, 0xc1, 0xbe, 0xd9, 0xbf, 0xe8, 0xc4,
-  0x4e, 0x9a, 0xf3, 0x00, 0x54, 0xb8, 0xed, 0xc1, 0x43, 0x91, 0xa6, 0xc5,
-  0x47, 0x5d, 0xbf, 0x5c, 0xaf, 0x4e, 0x83, 0xbd, 0xfc, 0xa5, 0x00, 0xdd,
-  0x95, 0x41, 0xb2, 0x08, 0xfa, 0xff, 0x76, 0x38, 0x6a, 0x0f, 0x68, 0x3f,
-  0x42, 0x0d, 0x12, 0x9c, 0x7e, 0x24, 0xe8, 0x8f, 0xc9, 0x34, 0xdf, 0xcf,
-  0x3d, 0x0f, 0x7f, 0x74, 0x2f, 0x1a, 0x6f, 0x91, 0x7c, 0x11, 0x7f, 0x75,
-  0x2f, 0x18, 0xa0, 0x08, 0xb7, 0xee, 0x3d, 0x21, 0xdb, 0x3d, 0x5a, 0x10,
-  0xd8, 0x60, 0xbb, 0xf4, 0xe8, 0xea, 0x20, 0xad, 0xe7, 0x33, 0x7b, 0x03,
-  0x01, 0x34, 0xad, 0x8c, 0xa2, 0x16, 0xe9, 0xdb, 0x3b, 0x3c, 0x10, 0x62,
-  0x1f, 0x23, 0xdb, 0x05, 0xb6, 0x62, 0x01, 0x19, 0xb5, 0x07, 0xad, 0x03,
-  0x0f, 0x61, 0x29, 0x39, 0xa7, 0x36, 0x87, 0xfd, 0x7d, 0xc6, 0x87, 0x61,
-  0xc9, 0x00, 0x84, 0x23, 0x39, 0xc9, 0x3a, 0xad, 0xeb, 0xe4, 0x97, 0xd8,
-  0xd4, 0x99, 0x0f, 0xef, 0xb5, 0xac, 0x91, 0x56, 0xd8, 0x79, 0x03, 0x57,
-  0x7e, 0x4f, 0x6a, 0x40, 0xec, 0xc5, 0x62, 0xc9, 0x5a, 0xa6, 0x23, 0x86,
-  0x98, 0x9e, 0x03, 0x78, 0x9d, 0x3a, 0x53, 0x61, 0x87, 0x7b, 0x60, 0x46,
-  0x0c, 0x10, 0xfb, 0x68, 0xbe, 0x14, 0x92, 0xe2, 0xfa, 0xc7, 0xe8, 0xed,
-  0xaa, 0xbf, 0x08, 0xce, 0x68, 0x54, 0x8e, 0x7b, 0x29, 0xb0, 0x2b, 0x4d,
-  0x76, 0x1d, 0x0b, 0x0c, 0x79, 0xb4, 0xaf, 0xa4, 0x26, 0x1c, 0x55, 0x96,
-  0x76, 0x27, 0xf8, 0x0b, 0x85, 0xb0, 0x81, 0x12, 0xea, 0x7f, 0x0b, 0x68,
-  0x29, 0x0b, 0xe8, 0x72, 0x6b, 0x1d, 0x15, 0x64, 0x3f, 0x36, 0xc1, 0xdb,
-  0x35, 0x12, 0x12, 0x70, 0xc1, 0x5e, 0x44, 0xf3, 0x90, 0x59, 0xda, 0x77,
-  0x57, 0xdf, 0xf3, 0xa6, 0x59, 0x88, 0x84, 0x6a, 0x60, 0x05, 0x5d, 0x6e,
-  0x6a, 0x7c, 0xf0, 0xdb, 0x0f, 0xff, 0x16, 0x7e, 0xc6, 0x06, 0xa2, 0xc9,
-  0x55, 0xde, 0x04, 0xa3, 0xc9, 0xaa, 0xc0, 0x96, 0x1c, 0xbf, 0x39, 0xc3,
-  0xb6, 0x05, 0x80, 0xb5, 0x39, 0x5a, 0x35, 0xe8, 0xb8, 0x16, 0x98, 0x4b,
-  0xc6, 0xb6, 0xa9, 0x66, 0x4f, 0x44, 0xcf, 0x6f, 0x5d, 0x61, 0x4d, 0x0c,
-  0x0c, 0x87, 0x42, 0x9e, 0x44, 0x9f, 0x4a, 0x99, 0x21, 0x26, 0x56, 0x9a,
-  0x4e, 0x0b, 0x17, 0xd5, 0x08, 0x8a, 0x55, 0xd5, 0x67, 0x88, 0xb4, 0x3f,
-  0x3b, 0x6e, 0x9d, 0x72, 0xf0, 0x24, 0xbc, 0x3d, 0x44, 0x5f, 0x42, 0xa4,
-  0xbf, 0x30, 0x68, 0x74, 0x0b, 0x0e, 0x03, 0xa6, 0x98, 0xc1, 0x65, 0x7b,
-  0x79, 0x90, 0x34, 0x3f, 0x1e, 0x68, 0x50, 0x46, 0xbf, 0x1e, 0x7d, 0xa9,
-  0xff, 0x2c, 0x0a, 0x91, 0x39, 0xa3, 0x38, 0x37, 0x62, 0xa8, 0xd5, 0xed,
-  0xbe, 0xe6, 0xe8, 0x1e, 0xfe, 0xeb, 0x05, 0xe6, 0xd8, 0x22, 0xff, 0xdf,
-  0x03, 0x68, 0x5b, 0x17, 0xe8, 0xbf, 0x2d, 0x62, 0x80, 0x3e, 0x76, 0x51,
-  0x74, 0x0a, 0xd7, 0x06, 0x53, 0x5b, 0x74, 0x2c, 0xc1, 0x8e, 0xff, 0x15,
-  0xcf, 0x0e, 0x02, 0xff, 0x68, 0xc2, 0x13, 0xf3, 0x52, 0x1e, 0xd0, 0x01,
-  0x21, 0x7d, 0x81, 0xc9, 0x19, 0x09, 0xad, 0x03, 0x0b, 0x03, 0x1b, 0x6d,
-  0x87, 0xbc, 0xca, 0x5e, 0x78, 0x05, 0xc5, 0xec, 0x09, 0x7c, 0xe6, 0x1e,
-  0x39, 0x11, 0x2f, 0xfc, 0x4d, 0x20, 0xcb, 0x10, 0x47, 0x04, 0x28, 0xd1,
-  0x5b, 0xe3, 0xbb, 0x57, 0x46, 0x47, 0x38, 0xf2, 0xfe, 0xdc, 0x3a, 0xe1,
-  0xad, 0xdb, 0x9a, 0x0b, 0x0c, 0x39, 0x6c, 0xe4, 0xa6, 0x18, 0x0d, 0x15,
-  0x52, 0x4d, 0xfe, 0xf8, 0x6c, 0x38, 0xf8, 0x2f, 0x29, 0x13, 0x68, 0xb5,
-  0x1b, 0x4a, 0xa9, 0x2d, 0x27, 0xad, 0x20, 0x18, 0xc8, 0xf4, 0x93, 0x81,
-  0xf7, 0x72, 0x2e, 0x5f, 0xb1, 0x1e, 0x5b, 0xe8, 0x28, 0xa2, 0x01, 0x5b,
-  0xd2, 0x83, 0xa5, 0xaa, 0x83, 0x56, 0xcb, 0xda, 0xc2, 0x03, 0x34, 0xbe,
-  0x44, 0xfd, 0x5d, 0x00, 0xae, 0x03, 0x83, 0xba, 0x21, 0xf9, 0xf9, 0x16,
-  0xbc, 0x07, 0xe9, 0xad, 0x21, 0xcf, 0xe2, 0xc0, 0x20, 0xc9, 0xd2, 0x32,
-  0xcb, 0xf2, 0x01, 0x68, 0xc4, 0x0c, 0xbb, 0x93, 0x9c, 0x02, 0xf9, 0xdb,
-  0xbe, 0x11, 0x0a, 0x77, 0x09, 0x92, 0x00, 0xc6, 0xd8, 0x46, 0xf5, 0x0d,
-  0xff, 0x30, 0x75, 0x14, 0x8a, 0x86, 0xf3, 0xfd, 0xed, 0x88, 0x46, 0xf2,
-  0x06, 0x9a, 0xf4, 0xf3, 0xdf, 0x18, 0xf4, 0x00, 0xeb, 0x15, 0x6c, 0x13,
-  0xf2, 0x9b, 0x1a, 0xe4, 0xf3, 0xf6, 0xf4, 0x8d, 0x10, 0xb7, 0x4e, 0x75,
-  0x9f, 0x48, 0x09, 0xe1, 0x7c, 0x06, 0x0c, 0x51, 0x6d, 0x4e, 0x15, 0x59,
-  0xd6, 0xed, 0x68, 0xc6, 0xdd, 0xd1, 0xfc, 0x95, 0x9f, 0x86, 0xdb, 0x8d,
-  0x59, 0xc2, 0xbe, 0x04, 0x64, 0x1e, 0x8a, 0x92, 0xd0, 0x47, 0xbe, 0x46,
-  0x88, 0x90, 0xb8, 0x5f, 0xbb, 0xd2, 0x0b, 0x7e, 0xef, 0xe9, 0xbe, 0x0d,
-  0x19, 0x90, 0x11, 0x1c, 0xef, 0x4d, 0xd2, 0x1b, 0xdb, 0x47, 0x46, 0xf8,
-  0xb5, 0x68, 0x51, 0x9e, 0xb3, 0xb4, 0x8e, 0x46, 0x74, 0x54, 0x2b, 0x33,
-  0x17, 0xb8, 0xe8, 0xaa, 0x8d, 0x8d, 0xd4, 0x95, 0x2e, 0x58, 0x84, 0xc2,
-  0x40, 0xdd, 0x20, 0x0c, 0xd7, 0xc2, 0xd8, 0x1d, 0xf8, 0xf0, 0x04, 0xf6,
-  0xf3, 0xec, 0xf2, 0xcc, 0xf4, 0x00, 0x5b, 0x98, 0xdc, 0x05, 0xa4, 0x0a,
-  0x64, 0x12, 0x64, 0x0c, 0x64, 0x1a, 0x67, 0x1c, 0x5c, 0xd8, 0xf9, 0x29,
-  0x26, 0x1b, 0x24, 0x05, 0x19, 0x30, 0x90, 0x75, 0xce, 0xdc, 0xb2, 0x2e,
-  0x34, 0x32, 0x3a, 0x32, 0x38, 0x33, 0x3e, 0x04, 0xfe, 0x61, 0xd4, 0xf1,
-  0xb3, 0xe2, 0xab, 0x6c, 0x16, 0x0c, 0x0c, 0xe7, 0x6d, 0x90, 0x20, 0x70,
-  0x0e, 0x92, 0xf2, 0xfe, 0xf0, 0xcf, 0xf0, 0x2d, 0x52, 0x33, 0xe2, 0x23,
-  0x0c, 0x56, 0x65, 0x20, 0xb7, 0x18, 0xf5, 0x91, 0x25, 0xb7, 0xdd, 0x7a,
-  0x08, 0xe1, 0xe9, 0x58, 0x08, 0xab, 0xaf, 0x30, 0x36, 0x0d, 0xd9, 0x0f,
-  0x90, 0xac, 0xf3, 0xf8, 0x07, 0x58, 0x32, 0x16, 0x39, 0xf8, 0xab, 0x0e,
-  0xe1, 0x79, 0x36, 0x06, 0xe1, 0x49, 0x9e, 0xca, 0x3a, 0x41, 0x92, 0xca,
-  0x70, 0xb3, 0x07, 0xb2, 0xf0, 0xd4, 0x3a, 0xa9, 0x07, 0x8d, 0xef, 0x51,
-  0xd8, 0x3a, 0xa0, 0x07, 0x0b, 0x23, 0x70, 0x42, 0xd4, 0x16, 0x22, 0xe8,
-  0xc0, 0xfd, 0x71, 0x26, 0x6d, 0xbb, 0xf1, 0x3c, 0x25, 0xf6, 0x3c, 0x47,
-  0xfe, 0x83, 0x80, 0xb7, 0xba, 0x34, 0x3d, 0x74, 0xbf, 0x24, 0x06, 0x30,
-  0x7c, 0x9f, 0x1d, 0x7a, 0x7f, 0xbb, 0x16, 0x19, 0x01, 0x00, 0xcb, 0x8a,
-  0x82, 0x8d, 0x82, 0x56, 0x37, 0x4b, 0xf6, 0x03, 0xf6, 0xda, 0x88, 0x07,
-  0xff, 0x36, 0xb7, 0xe0, 0xf8, 0x01, 0x2b, 0x30, 0x39, 0x07, 0xc0, 0x48,
-  0xe2, 0x20, 0x56, 0x0e, 0x4d, 0xbd, 0x11, 0xe3, 0x7e, 0x24, 0xa5, 0xf4,
-  0x46, 0xb6, 0xc2, 0x3e, 0x03, 0xe3, 0xd7, 0x93, 0x24, 0xd2, 0xa5, 0xe0,
-  0xb6, 0x8b, 0xe0, 0xe3, 0x17, 0x4a, 0x58, 0x93, 0x7b, 0x33, 0xf8, 0xc8,
-  0xfe, 0x72, 0x2c, 0x77, 0x07, 0x82, 0xf3, 0x7a, 0x7e, 0x07, 0xf2, 0x2d,
-  0x75, 0x17, 0x5d, 0x96, 0xac, 0xbc, 0x83, 0x03, 0x92, 0x0a, 0xb6, 0x7c,
-  0x4c, 0x8a, 0xb2, 0x5a, 0x0c, 0x39, 0x87, 0x92, 0xc3, 0x68, 0xd6, 0x33,
-  0x40, 0xc0, 0x5b, 0x12, 0x3c, 0x93, 0xaa, 0xb0, 0xdb, 0x10, 0x66, 0x07,
-  0xd8, 0x68, 0xde, 0x1d, 0x32, 0x1e, 0x1d, 0xe4, 0x83, 0x10, 0xe9, 0x95,
-  0xa9, 0x75, 0x06, 0xe8, 0xbb, 0x0e, 0x46, 0xd4, 0x1e, 0x72, 0xff, 0xa9,
-  0x3c, 0x4e, 0x68, 0xf8, 0x83, 0xee, 0x80, 0xa9, 0xb0, 0x31, 0x3b, 0xfb,
-  0x16, 0x06, 0xd7, 0x40, 0x46, 0x9e, 0xe7, 0x81, 0x3e, 0x64, 0x9f, 0xcb,
-  0xff, 0xba, 0x93, 0x92, 0xe2, 0x99, 0x8a, 0x59, 0x9b, 0x50, 0x4b, 0x0d,
-  0x63, 0x5d, 0xa1, 0x21, 0xe4, 0x57, 0x0d, 0xe4, 0x90, 0x99, 0x0a, 0xec,
-  0x5a, 0x16, 0x19, 0x79, 0x01, 0x7c, 0x5d, 0x0a, 0x81, 0xf9, 0x5e, 0x0d,
-  0xe8, 0x5c, 0x06, 0x3b, 0x4e, 0xaa, 0x4e, 0x43, 0x43, 0x98, 0xaf, 0xf2,
-  0x32, 0x4c, 0x3a, 0xf6, 0xb2, 0x16, 0x0c, 0x1b, 0x80, 0xbe, 0x5d, 0x3a,
-  0x40, 0xe5, 0xb6, 0xc9, 0xfe, 0x91, 0xe4, 0xdd, 0x89, 0x72, 0x02, 0x0e,
-  0x39, 0xe5, 0xa8, 0x07, 0x0d, 0x0e, 0x27, 0xd4, 0x80, 0xa8, 0xb0, 0x8e,
-  0x3b, 0x10, 0x16, 0x06, 0xbd, 0x40, 0x5f, 0x5d, 0x12, 0x20, 0x7e, 0x14,
-  0x0e, 0xe8, 0xa0, 0x41, 0x93, 0x7f, 0x93, 0x60, 0x93, 0x87, 0xb3, 0x3d,
-  0x43, 0xc0, 0xdc, 0x9a, 0x58, 0xad, 0x12, 0x0d, 0x18, 0x4c, 0xca, 0xc9,
-  0x4c, 0x96, 0x67, 0x53, 0xc1, 0xaa, 0x93, 0x32, 0x93, 0xb3, 0x90, 0x3a,
-  0xe4, 0xbe, 0x19, 0x29, 0x26, 0x0c, 0x7b, 0xc1, 0x16, 0x06, 0x12, 0x40,
-  0x5f, 0xaa, 0x0c, 0x20, 0x76, 0xc5, 0x5d, 0xe4, 0xf5, 0x90, 0xf2, 0xd4,
-  0x88, 0x39, 0x11, 0x0f, 0x1c, 0xdc, 0xa7, 0x16, 0x75, 0x7b, 0xd6, 0x00,
-  0x46, 0x39, 0x0b, 0x71, 0x3d, 0x0d, 0xb1, 0x81, 0x05, 0xb8, 0x45, 0xe9,
-  0xc3, 0xd7, 0xd3, 0x12, 0x2b, 0x0f, 0x76, 0xcf, 0xff, 0xbf, 0xc0, 0xee,
-  0xbb, 0x7e, 0xec, 0x00, 0x03, 0x66, 0xeb, 0xba, 0xea, 0x16, 0xcb, 0x06,
-  0x76, 0xb6, 0xe8, 0x06, 0xcc, 0x6b, 0xe9, 0x47, 0x65, 0xe8, 0xd4, 0xf7,
-  0x99, 0xfc, 0xa3, 0xee, 0xbb, 0x0e, 0x97, 0x52, 0xc0, 0x5f, 0x89, 0x1a,
-  0x25, 0xd9, 0x2b, 0xc7, 0x39, 0xc8, 0xdb, 0x32, 0xc9, 0x34, 0xea, 0x8c,
-  0xc4, 0x95, 0xcd, 0x4e, 0x50, 0x34, 0xc2, 0x9c, 0xc3, 0x9c, 0xc4, 0xed,
-  0x39, 0x9a, 0xc5, 0xeb, 0x46, 0x8a, 0x4a, 0xe6, 0x4a, 0xdc, 0x4c, 0x5f,
-  0x14, 0x00, 0xcb, 0xdf, 0x6b, 0xe5, 0xe8, 0xe4, 0x17, 0xf0, 0xf3, 0xa6,
-  0x8d, 0x1e, 0x71, 0x9e, 0xe5, 0x48, 0x99, 0x08, 0x4a, 0xd3, 0xa4, 0x5b,
-  0x6d, 0x1e, 0x34, 0x1d, 0x2c, 0x69, 0x1c, 0x81, 0xfc, 0x23, 0x0f, 0xe8,
-  0x8b, 0x8f, 0x9f, 0x6a, 0x87, 0x59, 0x7c, 0x80, 0x6f, 0x9c, 0x72, 0xe1,
-  0xc7, 0xf2, 0x75, 0x0f, 0x78, 0x61, 0xa6, 0x21, 0xf9, 0x03, 0xb0, 0x78,
-  0x16, 0x64, 0x4a, 0x04, 0x3d, 0xc7, 0x24, 0x81, 0x5d, 0xcb, 0x7c, 0x2d,
-  0x20, 0xc9, 0x0c, 0xc9, 0xc8, 0xc8, 0x14, 0x72, 0xcd, 0x0c, 0x03, 0x93,
-  0x26, 0x3d, 0xd0, 0x83, 0x16, 0xec, 0x92, 0xa5, 0xdf, 0x5d, 0x26, 0x20,
-  0x72, 0xd4, 0xe4, 0xcf, 0x8e, 0xf2, 0xae, 0x86, 0x39, 0x20, 0x10, 0x1c,
-  0xb6, 0xa5, 0x83, 0x27, 0x93, 0x10, 0xc1, 0xa5, 0xa5, 0x18, 0x37, 0x1d,
-  0x2a, 0x83, 0x16, 0x8e, 0x20, 0x2f, 0x5d, 0x90, 0x30, 0x3f, 0x2e, 0x10,
-  0xe8, 0x71, 0x20, 0xc9, 0x50, 0xc9, 0x7a, 0xc8, 0x58, 0x72, 0x86, 0x0c,
-  0x47, 0x93, 0x34, 0x3d, 0x89, 0x83, 0x16, 0x30, 0x20, 0x2f, 0x5d, 0x90,
-  0x34, 0x39, 0x8d, 0x64, 0x13, 0x1c, 0xf2, 0x85, 0x8c, 0xd9, 0x9e, 0xfa,
-  0xa4, 0x30, 0xe1, 0x6d, 0xc7, 0x49, 0x90, 0xe1, 0x70, 0xe6, 0xa4, 0x46,
-  0x75, 0x07, 0xe3, 0x60, 0x16, 0xc8, 0xcf, 0x0c, 0x05, 0xb2, 0xe5, 0x0c,
-  0xb8, 0x80, 0xcb, 0x06, 0xe7, 0x20, 0xc8, 0xa1, 0x0c, 0x07, 0xb2, 0xeb,
-  0x0c, 0x8a, 0x80, 0xcb, 0x48, 0xf0, 0x20, 0xc8, 0x73, 0x0c, 0x08, 0xb2,
-  0xf4, 0x0c, 0x5c, 0xea, 0x1e, 0x39, 0x3e, 0x56, 0x4a, 0x6d, 0xd9, 0x90,
-  0x38, 0x39, 0xf7, 0x72, 0x39, 0x8d, 0x72, 0x18, 0x79, 0x43, 0x11, 0x19,
-  0x20, 0xc3, 0x37, 0xe4, 0x46, 0x11, 0xf0, 0x0f, 0xa4, 0x46, 0x94, 0x07,
-  0x49, 0x60, 0x16, 0xe0, 0xf8, 0xa3, 0x8c, 0x94, 0xb7, 0x5d, 0x48, 0x1a,
-  0x1f, 0x4d, 0x11, 0xe8, 0xc9, 0xdb, 0x8c, 0xe7, 0xba, 0x84, 0x57, 0x4c,
-  0x30, 0x1b, 0xe5, 0x99, 0x90, 0xbf, 0x65, 0x9e, 0x13, 0xc9, 0x64, 0xe5,
-  0x11, 0xf2, 0x00, 0xa4, 0x77, 0x2d, 0x13, 0x48, 0xe9, 0x39, 0xec, 0xa3,
-  0x39, 0x19, 0xa4, 0xed, 0x19, 0xd8, 0x30, 0x7c, 0xf6, 0xfc, 0xa8, 0xd9,
-  0x48, 0xf2, 0x90, 0xa8, 0x00, 0x59, 0x50, 0xf0, 0x19, 0xd4, 0xb2, 0x63,
-  0x85, 0x1e, 0x90, 0xf7, 0xed, 0x17, 0xe8, 0x59, 0xa0, 0x67, 0xcc, 0x7f,
-  0x1f, 0x2f, 0x08, 0x25, 0x81, 0x81, 0xa4, 0x0a, 0xb0, 0x20, 0xa6, 0xac,
-  0xe4, 0xdf, 0xd8, 0x0c, 0x25, 0xb0, 0xe6, 0x52, 0x9d, 0x72, 0x14, 0x69,
-  0xe4, 0x39, 0x02, 0xd2, 0x53, 0x5a, 0x69, 0x03, 0x24, 0x2c, 0x74, 0xb3,
-  0x26, 0x96, 0x30, 0xc1, 0x40, 0x9c, 0xa2, 0x05, 0x05, 0xe3, 0x43, 0x6f,
-  0x31, 0x86, 0x94, 0x0c, 0x68, 0xc1, 0x96, 0x76, 0x1c, 0xb1, 0x21, 0xdc,
-  0x82, 0x41, 0xfb, 0x00, 0x80, 0xfd, 0x79, 0x12, 0x28, 0x60, 0xc6, 0x16,
-  0x98, 0x00, 0x01, 0x99, 0x1b, 0xf4, 0x23, 0x00, 0x73, 0x34, 0x2c, 0x2b,
-  0xd2, 0x30, 0x18, 0x43, 0x17, 0xcc, 0x9b, 0x27, 0xfa, 0x11, 0xc2, 0x68,
-  0xf1, 0xa2, 0xe0, 0x3b, 0x88, 0x30, 0x03, 0xed, 0xfd, 0x0d, 0xc0, 0x0e,
-  0x8b, 0x77, 0x03, 0xef, 0x82, 0x59, 0xdd, 0x57, 0x8a, 0x64, 0xb4, 0x11,
-  0xb6, 0xa5, 0x2d, 0x11, 0xd9, 0x59, 0x6b, 0xe2, 0xec, 0x57, 0x96, 0xb0,
-  0x1e, 0xce, 0x0e, 0x00, 0xb7, 0xe7, 0xf1, 0x57, 0xda, 0xe8, 0xea, 0x27,
-  0xd0, 0xad, 0x48, 0x4c, 0x1c, 0x44, 0x81, 0x79, 0x5a, 0x27, 0x10, 0x6e,
-  0xbb, 0x06, 0x88, 0x09, 0x4f, 0x41, 0x20, 0x4e, 0x5e, 0x7a, 0x2b, 0x47,
-  0x46, 0x12, 0xe6, 0xe8, 0x85, 0x8a, 0xb5, 0x66, 0x60, 0x84, 0x5e, 0xd8,
-  0x1e, 0x38, 0x43, 0xfb, 0x93, 0x26, 0x96, 0x8b, 0x4c, 0x46, 0x2d, 0x57,
-  0x6d, 0xb9, 0x6a, 0xa0, 0xc3, 0x16, 0x38, 0x3c, 0x17, 0x64, 0xa0, 0x70,
-  0x88, 0x49, 0xdc, 0x51, 0x57, 0x9a, 0x60, 0xcb, 0xc1, 0x14, 0x1f, 0x6f,
-  0x3e, 0x2d, 0x18, 0x6d, 0xdd, 0x12, 0x2d, 0x10, 0xc4, 0x0b, 0x1b, 0xeb,
-  0x9a, 0xa0, 0xd8, 0xcf, 0x0b, 0x77, 0xa0, 0xf6, 0xeb, 0x0a, 0x68, 0xdf,
-  0x17, 0x73, 0xd3, 0xdd, 0xea, 0x0b, 0xd8, 0x2c, 0xc7, 0xf2, 0xf3, 0x73,
-  0x53, 0x0d, 0x27, 0x9b, 0x14, 0x13, 0x6a, 0xf6, 0x32, 0xe8, 0x06, 0x4d,
-  0x18, 0xef, 0xf9, 0x12, 0x91, 0xe3, 0xe8, 0x92, 0xd4, 0x95, 0x9e, 0x22,
-  0xf4, 0x3e, 0x2b, 0x26, 0x93, 0x70, 0xb8, 0x89, 0x4d, 0xa5, 0x1a, 0xf6,
-  0x13, 0xe8, 0xaf, 0x89, 0x24, 0xdb, 0x3d, 0x06, 0xa8, 0x2b, 0x1a, 0x1f,
-  0x86, 0x6b, 0x68, 0x47, 0x6d, 0x0d, 0x9a, 0x8c, 0x1d, 0x76, 0xb3, 0x91,
-  0x5b, 0xa0, 0x24, 0x8a, 0x34, 0xd5, 0xb2, 0x83, 0x0d, 0xd7, 0xb2, 0x0a,
-  0x78, 0xb6, 0x19, 0xfd, 0x59, 0x70, 0x9b, 0x70, 0xe8, 0xba, 0x69, 0x06,
-  0x64, 0x59, 0x62, 0xa5, 0x9d, 0x9a, 0x5b, 0xc4, 0x5d, 0x54, 0x89, 0x83,
-  0x8c, 0x1d, 0x56, 0xb5, 0xb6, 0x0d, 0x46, 0x56, 0xc3, 0xdd, 0x53, 0x96,
-  0x6f, 0x97, 0x4c, 0xc9, 0x14, 0x23, 0xfb, 0xbe, 0xd3, 0x67, 0xcb, 0xd9,
-  0x31, 0x29, 0xbd, 0x1d, 0x15, 0xe8, 0x22, 0xd2, 0x06, 0x67, 0xcd, 0x1b,
-  0xb7, 0x2c, 0x14, 0xd2, 0xfd, 0xcd, 0x0d, 0x4b, 0xe6, 0x16, 0xe8, 0x06,
-  0x97, 0x91, 0xff, 0x88, 0x2c, 0x93, 0xb3, 0xf8, 0x4b, 0xbd, 0xf1, 0x34,
-  0xfb, 0xb3, 0xea, 0x79, 0x46, 0x17, 0xe8, 0xe3, 0xa5, 0x48, 0x9a, 0xdc,
-  0x71, 0x59, 0xd5, 0xa5, 0xad, 0x9a, 0xce, 0xf6, 0x59, 0xc7, 0xbc, 0x26,
-  0x18, 0xe8, 0xc0, 0xd2, 0x77, 0xec, 0xb9, 0x88, 0x9a, 0x16, 0x3b, 0xee,
-  0xe3, 0x52, 0x93, 0xcb, 0xdb, 0x4b, 0x7a, 0x91, 0x18, 0x91, 0x67, 0xb6,
-  0x7c, 0x2a, 0x95, 0x6b, 0xa4, 0x06, 0x66, 0x8e, 0x96, 0xdb, 0x87, 0x6f,
-  0x12, 0x19, 0xe8, 0x80, 0x34, 0x4b, 0xb3, 0x79, 0x4b, 0x8b, 0x72, 0x34,
-  0xd9, 0xb3, 0x6b, 0x79, 0x0b, 0x1a, 0xe8, 0x64, 0xa5, 0x0d, 0x9a, 0x5d,
-  0x2b, 0x5b, 0x56, 0x69, 0xdb, 0x06, 0x4f, 0x7b, 0xa8, 0x06, 0x66, 0x48,
-  0xf3, 0x05, 0x1b, 0xe8, 0x41, 0x4b, 0x51, 0x3a, 0x65, 0x7e, 0xcf, 0x64,
-  0x5c, 0x36, 0x54, 0x1b, 0x47, 0xe8, 0xd2, 0x3d, 0x56, 0xb3, 0x2a, 0x16,
-  0x5b, 0x7a, 0x06, 0x0f, 0x34, 0xc8, 0xb3, 0x08, 0x79, 0x16, 0x1c, 0xe8,
-  0x01, 0xa5, 0x66, 0xcb, 0xfa, 0x87, 0x68, 0x2c, 0xf3, 0xd2, 0x9b, 0xcd,
-  0xec, 0xd9, 0x2c, 0xe5, 0xde, 0x11, 0x1d, 0xe8, 0xde, 0x69, 0x61, 0x66,
-  0xd7, 0x85, 0xa2, 0x78, 0xb6, 0x65, 0x09, 0xcd, 0x56, 0x11, 0xcb, 0xae,
-  0xc5, 0x35, 0xe7, 0xb3, 0x06, 0xbe, 0x79, 0x33, 0x1e, 0xe8, 0xb7, 0xa5,
-  0x80, 0x9a, 0xb0, 0xca, 0x5d, 0xa9, 0x87, 0x83, 0x90, 0x07, 0xdb, 0x68,
-  0xef, 0x0d, 0x9b, 0xa0, 0x87, 0x1a, 0x52, 0x2e, 0x81, 0xca, 0xd5, 0x9c,
-  0x34, 0xf4, 0xaa, 0xf9, 0xbc, 0xf2, 0xe7, 0xf0, 0x8a, 0xee, 0xba, 0x93,
-  0x10, 0x82, 0x5e, 0x77, 0x89, 0x56, 0xea, 0x2d, 0x78, 0xa1, 0xec, 0x5c,
-  0x7a, 0xc6, 0x43, 0xd2, 0x06, 0xaa, 0xd5, 0x0a, 0x7c, 0xde, 0x25, 0x0a,
-  0x03, 0x74, 0x28, 0x80, 0xcf, 0x3b, 0x9c, 0x51, 0x75, 0x7c, 0xf2, 0xba,
-  0x52, 0x18, 0x7f, 0x9e, 0xc6, 0xf4, 0xd9, 0x08, 0x0f, 0x41, 0x5b, 0x19,
-  0x04, 0xc2, 0x7c, 0xf3, 0x94, 0xb6, 0x0c, 0x02, 0x56, 0x2d, 0xfb, 0x12,
-  0x04, 0x74, 0x0c, 0x05, 0xb9, 0x05, 0x74, 0x06, 0xba, 0x06, 0x75, 0x2f,
-  0x95, 0xdc, 0x28, 0x53, 0x5b, 0x8a, 0x04, 0xc8, 0x61, 0xd1, 0x09, 0xf6,
-  0x2a, 0x1f, 0x0c, 0x32, 0xd1, 0x38, 0x30, 0x1f, 0x36, 0xd2, 0x7e, 0xdb,
-  0x4f, 0x36, 0x06, 0x72, 0xf8, 0x86, 0xcb, 0x39, 0xf1, 0xb1, 0x86, 0x40,
-  0x75, 0xb6, 0x3b, 0xb2, 0x0c, 0xe4, 0x33, 0x05, 0x4b, 0x53, 0xd7, 0x23,
-  0x06, 0x34, 0x5e, 0xb3, 0xca, 0xd1, 0x16, 0xbb, 0xae, 0x3a, 0x75, 0x63,
-  0xbd, 0x14, 0x00, 0x72, 0x32, 0xc9, 0xa3, 0x66, 0x6d, 0x2c, 0x05, 0x96,
-  0x04, 0x26, 0xe4, 0xa9, 0x06, 0xc5, 0xd2, 0x40, 0x3d, 0xe5, 0xf0, 0x50,
-  0x6a, 0x0c, 0xad, 0x3f, 0x8d, 0x14, 0x84, 0x6e, 0x33, 0x96, 0x86, 0xe6,
-  0x71, 0xf4, 0xad, 0x1e, 0xe8, 0x14, 0x04, 0x30, 0x5b, 0xa7, 0xd2, 0x3f,
-  0x19, 0x5c, 0x06, 0x54, 0x6e, 0x02, 0x75, 0x4e, 0x7f, 0x7e, 0x48, 0x6a,
-  0x0a, 0xb6, 0x8d, 0x1e, 0x50, 0xcf, 0x38, 0xe8, 0x81, 0xaa, 0x97, 0xd7,
-  0x75, 0x0f, 0xf4, 0xe8, 0x93, 0x9d, 0x4b, 0xc0, 0x8b, 0xb3, 0xfe, 0x5d,
-  0xf1, 0x03, 0x46, 0x04, 0x2b, 0x5a, 0xeb, 0xd9, 0x63, 0x8c, 0xb0, 0x4f,
-  0x8a, 0xa9, 0x2b, 0xf8, 0x76, 0x68, 0x6a, 0x63, 0xe0, 0x02, 0x7e, 0xee,
-  0xc8, 0xff, 0x7f, 0xdb, 0x19, 0x65, 0x33, 0xfb, 0xa1, 0xe4, 0x63, 0x19,
-  0x5b, 0xb9, 0x00, 0x75, 0x55, 0x19, 0x4f, 0x26, 0x4e, 0x67, 0x26, 0xa5,
-  0x51, 0x73, 0x24, 0x18, 0x7b, 0x17, 0x68, 0x6d, 0x43, 0x62, 0xee, 0x50,
-  0x42, 0x1a, 0x68, 0xd8, 0x71, 0x59, 0x5c, 0x99, 0xe6, 0x01, 0xd3, 0xe8,
-  0xfb, 0x14, 0x0b, 0x46, 0x16, 0x1e, 0xa5, 0x6f, 0x90, 0xcf, 0x66, 0x4e,
-  0x93, 0x00, 0x08, 0xa0, 0xd8, 0x0f, 0x98, 0xcb, 0x04, 0x06, 0x6e, 0x56,
-  0xf7, 0x4f, 0x5f, 0xb4, 0x07, 0xcd, 0x21, 0x6c, 0xe6, 0xff, 0x8c, 0x3f,
-  0x83, 0x37, 0x23, 0x31, 0x23, 0x2b, 0x41, 0x2f, 0xcc, 0x08, 0x74, 0x25,
-  0x77, 0x05, 0x0d, 0x74, 0x1f, 0x37, 0x1b, 0x74, 0x19, 0x6b, 0x17, 0xb5,
-  0x56, 0x68, 0xb4, 0x5d, 0x20, 0xfc, 0x63, 0x2f, 0x17, 0xbb, 0xa0, 0x58,
-  0x67, 0x71, 0x59, 0xba, 0x16, 0xb3, 0x16, 0xd0, 0xdb, 0xb0, 0x0c, 0x17,
-  0x34, 0x09, 0xe1, 0xd1, 0x1b, 0x82, 0x74, 0x9f, 0x47, 0x75, 0xad, 0x1a,
-  0xfa, 0x98, 0x18, 0x16, 0x4e, 0x6c, 0xa4, 0xdf, 0x04, 0x0a, 0xde, 0x63,
-  0x00, 0x6d, 0x26, 0x49, 0xdd, 0x26, 0x02, 0x51, 0x07, 0x1e, 0x1f, 0x1a,
-  0x13, 0x30, 0xd6, 0x14, 0x6c, 0xed, 0x74, 0x2a, 0x0b, 0x6b, 0x24, 0xa6,
-  0xdb, 0xf3, 0x74, 0xb6, 0x14, 0xef, 0xe6, 0x58, 0xe8, 0xf6, 0x45, 0x13,
-  0x0f, 0x63, 0x74, 0x0a, 0x66, 0x4e, 0xf7, 0x44, 0x35, 0x72, 0x0b, 0x75,
-  0x1b, 0x30, 0x15, 0xa1, 0xcd, 0x79, 0x76, 0x99, 0x89, 0x2e, 0x8d, 0xb5,
-  0xb0, 0xe8, 0x20, 0x99, 0x09, 0x0d, 0x8b, 0x15, 0x25, 0x09, 0x67, 0x20,
-  0x0a, 0x25, 0x1d, 0x01, 0xd7, 0xa7, 0xa4, 0xb0, 0x41, 0xd2, 0x75, 0x6d,
-  0x9b, 0x91, 0xcd, 0x8c, 0x11, 0x7c, 0x81, 0x9b, 0x59, 0x48, 0x1a, 0xd7,
-  0x29, 0x23, 0x24, 0x7f, 0x06, 0x05, 0xd0, 0xff, 0x44, 0x38, 0x48, 0x03,
-  0x59, 0x91, 0x0b, 0x48, 0x3d, 0x83, 0xa5, 0x23, 0x54, 0xbf, 0x6e, 0x4e,
-  0xe6, 0x03, 0xc8, 0x13, 0xdb, 0xda, 0x89, 0x06, 0x89, 0x6d, 0x0c, 0x4f,
-  0xad, 0x0d, 0x1b, 0xd1, 0x5e, 0xfa, 0x1b, 0x61, 0x0a, 0x07, 0xea, 0x40,
-  0xa5, 0x18, 0xe8, 0x88, 0x96, 0xa7, 0xc2, 0xd6, 0x30, 0x28, 0xf4, 0x56,
-  0xe6, 0x3b, 0xbf, 0x7b, 0x72, 0x29, 0x77, 0x05, 0x3b, 0x4b, 0x85, 0x76,
-  0xb2, 0x22, 0x6e, 0xd3, 0xa9, 0xa1, 0xee, 0x82, 0x7f, 0x78, 0xb2, 0xce,
-  0xae, 0x8b, 0x0b, 0xda, 0xff, 0xd8, 0xeb, 0x05, 0xac, 0x73, 0x02, 0x48,
-  0xd1, 0x72, 0xc8, 0x04, 0xe7, 0xd4, 0x9a, 0x0b, 0xe2, 0xf0, 0x2e, 0x01,
-  0x4f, 0xc8, 0xb3, 0x9c, 0x89, 0xa4, 0x91, 0x39, 0x6a, 0xa4, 0x2d, 0x8c,
-  0x4e, 0x20, 0x6d, 0x79, 0x1a, 0xb6, 0x02, 0x18, 0x23, 0xcb, 0xe8, 0xe6,
-  0x6c, 0x45, 0xec, 0xbe, 0xea, 0xe8, 0x45, 0xa4, 0x02, 0x5c, 0x53, 0xc0,
-  0xa0, 0x26, 0x52, 0xca, 0xd9, 0xbc, 0x22, 0x20, 0x8e, 0xd8, 0xcd, 0x4a,
-  0x42, 0xc8, 0xc7, 0x30, 0xa8, 0xee, 0x75, 0x2a, 0x10, 0x6b, 0xb2, 0x1b,
-  0xc7, 0xfb, 0x40, 0x30, 0x0a, 0x2d, 0x92, 0x43, 0x72, 0x0a, 0x4d, 0x87,
-  0xbf, 0x4b, 0x80, 0x5f, 0x85, 0x20, 0x92, 0xa7, 0x7a, 0x50, 0x75, 0x35,
-  0x2c, 0xb7, 0x12, 0xff, 0xd8, 0xa8, 0xdd, 0x51, 0x7c, 0x20, 0x83, 0x0b,
-  0x99, 0x6f, 0x7b, 0x10, 0x7f, 0x13, 0x42, 0x2d, 0xb7, 0x89, 0x0e, 0x77,
-  0xb0, 0x0c, 0x4f, 0x5e, 0x4b, 0xce, 0x67, 0x6e, 0xdf, 0xbd, 0x1c, 0x8a,
-  0x07, 0x3a, 0x68, 0x2a, 0xd6, 0x8b, 0x2f, 0x3d, 0xe0, 0xff, 0x50, 0xbf,
-  0x0e, 0x98, 0x5a, 0x3b, 0xd0, 0x74, 0xb6, 0x1a, 0x19, 0x1e, 0x4e, 0x10,
-  0x42, 0xf7, 0x75, 0x3a, 0x9b, 0x77, 0x61, 0x7c, 0x08, 0x15, 0x69, 0x04,
-  0xe0, 0x6c, 0x9c, 0x4a, 0xe5, 0x0a, 0xcf, 0x5c, 0xa7, 0x75, 0x60, 0x09,
-  0x97, 0xa5, 0x64, 0x90, 0x4c, 0xe5, 0x62, 0xce, 0xdb, 0x79, 0x3a, 0xc5,
-  0x24, 0xee, 0x3f, 0x59, 0x74, 0x12, 0xe1, 0x05, 0x42, 0xf1, 0xbb, 0x05,
-  0x79, 0x74, 0x9b, 0x06, 0x6e, 0x75, 0x7c, 0x9d, 0x00, 0xf2, 0x20, 0x7c,
-  0x0a, 0x75, 0x75, 0xc8, 0x06, 0x7d, 0xb9, 0x6d, 0x8b, 0xf6, 0x07, 0x65,
-  0x59, 0x81, 0x6e, 0x74, 0x23, 0x8b, 0x0c, 0x10, 0xee, 0x31, 0x31, 0x7c,
-  0x36, 0xf0, 0x99, 0xa1, 0x65, 0xe0, 0x7f, 0xc2, 0x30, 0x3b, 0xc2, 0x7f,
-  0x28, 0x64, 0x89, 0xba, 0x85, 0x0a, 0x4b, 0xc8, 0xde, 0x4b, 0x72, 0x65,
-  0xcc, 0x55, 0xc6, 0x3b, 0x0e, 0x40, 0xf5, 0x7e, 0x0b, 0x8d, 0x5e, 0x00,
-  0x34, 0x07, 0x07, 0x87, 0xbb, 0xb3, 0x00, 0x7d, 0xc9, 0x75, 0x0b, 0xdb,
-  0x75, 0x12, 0xa8, 0x38, 0x4a, 0x14, 0x8e, 0x4f, 0xc9, 0x8e, 0x97, 0x68,
-  0xc6, 0x78, 0x28, 0x40, 0x68, 0x01, 0xd8, 0xfb, 0x4a, 0x53, 0x72, 0x6b,
-  0xcc, 0x72, 0x1b, 0x3e, 0x07, 0x75, 0x90, 0x56, 0x64, 0x4e, 0x19, 0x46,
-  0xf2, 0xe4, 0x89, 0x14, 0x36, 0x9f, 0x5b, 0x4c, 0x6e, 0xb2, 0x16, 0x75,
-  0x00, 0x8d, 0xc6, 0x0b, 0x81, 0x61, 0x72, 0x82, 0x01, 0x36, 0x0b, 0xbd,
-  0x5c, 0x3d, 0x93, 0x71, 0x2e, 0xb4, 0x77, 0x4c, 0x36, 0x81, 0x8b, 0x00,
-  0x10, 0x00, 0xb7, 0x4c, 0x8d, 0xc6, 0xef, 0x0c, 0x7c, 0x24, 0x08, 0x18,
-  0xd7, 0xc9, 0x1a, 0xd9, 0x13, 0x55, 0xb1, 0x16, 0x49, 0x7d, 0xe3, 0xeb,
-  0x36, 0x4c, 0x64, 0xf2, 0xd3, 0x76, 0x49, 0x63, 0x81, 0xbb, 0x1c, 0xd0,
-  0x49, 0x4f, 0x1f, 0x0c, 0xdb, 0x68, 0x74, 0x6a, 0x49, 0xbe, 0x77, 0x0a,
-  0x10, 0xde, 0x0d, 0x0e, 0x68, 0x94, 0x5d, 0x3b, 0x77, 0x33, 0x87, 0x93,
-  0x27, 0xa9, 0x49, 0x21, 0xcb, 0x98, 0x20, 0x38, 0xfa, 0x90, 0x2c, 0x46,
-  0x96, 0x26, 0x3a, 0xa8, 0x07, 0x43, 0x64, 0x31, 0xc9, 0x77, 0x30, 0x9b,
-  0xb9, 0x27, 0xee, 0x76, 0x3d, 0x75, 0x78, 0xed, 0x94, 0x93, 0xff, 0xe4,
-  0xb9, 0x04, 0x00, 0xbb, 0xae, 0x3e, 0x2e, 0xdb, 0x8b, 0x07, 0xaf, 0xe4,
-  0x0b, 0x3c, 0x43, 0xff, 0x43, 0xe2, 0xf4, 0xeb, 0x23, 0x2e, 0xff, 0x67,
-  0x83, 0x08, 0xf3, 0x0b, 0xfc, 0xeb, 0x2f, 0xeb, 0xee, 0xeb, 0x00, 0x19,
-  0xe8, 0x3b, 0xeb, 0xea, 0xc5, 0x00, 0x7b, 0x68, 0x9e, 0x20, 0xc8, 0x1d,
-  0xa0, 0xc9, 0x81, 0xaf, 0xec, 0xf9, 0x48, 0x7d, 0x39, 0xbf, 0x64, 0x70,
-  0xec, 0x0b, 0xaf, 0x06, 0x00, 0x4a, 0x6c, 0xc7, 0x31, 0x99, 0xc2, 0x64,
-  0x3e, 0xc7, 0xf7, 0xee, 0x95, 0x01, 0x34, 0x56, 0xb6, 0xb6, 0x08, 0x8c,
-  0x7a, 0x08, 0x2f, 0x6f, 0x42, 0x3b, 0x22, 0x46, 0x41, 0x0f, 0xb6, 0xc0,
-  0x0c, 0x7d, 0x0e, 0x09, 0xd8, 0x04, 0x10, 0x00, 0x7e, 0xa1, 0x30, 0x7c,
-  0x10, 0x1b, 0xa7, 0x39, 0x7f, 0x9e, 0x0a, 0xd0, 0x65, 0x2b, 0xe2, 0x0f,
-  0xbc, 0x0a, 0x7d, 0x04, 0xc6, 0xb6, 0x0b, 0x34, 0x30, 0x11, 0x93, 0xb0,
-  0x0d, 0x26, 0x9f, 0xf0, 0x09, 0x7e, 0xb1, 0x20, 0xdd, 0x09, 0x81, 0x87,
-  0x92, 0xb3, 0xc5, 0xd8, 0xd4, 0xc7, 0xc8, 0x4a, 0xce, 0xe9, 0x71, 0x01,
-  0x11, 0x68, 0xa0, 0x43, 0xf6, 0xb0, 0x17, 0x45, 0xf9, 0x7c, 0x3b, 0x7f,
-  0xf6, 0x76, 0x34, 0x66, 0x36, 0x2e, 0x45, 0x2f, 0x1b, 0x6d, 0xc9, 0xe8,
-  0x9c, 0x41, 0x85, 0xd6, 0x08, 0x57, 0x5f, 0x0a, 0x21, 0xe8, 0xdc, 0x5e,
-  0x75, 0x11, 0xc1, 0x53, 0x6f, 0xca, 0x75, 0x22, 0x3b, 0xc5, 0x76, 0x04,
-  0xee, 0x7e, 0x9b, 0x81, 0x17, 0x8c, 0x3d, 0x11, 0x21, 0x8c, 0x39, 0x4b,
-  0xd6, 0x06, 0x27, 0x5c, 0x0d, 0xf6, 0x08, 0x86, 0x35, 0x02, 0xac, 0x21,
-  0x12, 0x50, 0xb6, 0x75, 0xfe, 0x0c, 0xae, 0xb6, 0x02, 0x43, 0x89, 0xa4,
-  0x57, 0x32, 0xa1, 0x5c, 0xe6, 0xff, 0xf8, 0x42, 0xd2, 0x46, 0xeb, 0x16,
-  0x29, 0xb6, 0xab, 0x02, 0x4a, 0xa5, 0x42, 0x05, 0x6c, 0x67, 0x07, 0x08,
-  0x69, 0x22, 0xd4, 0x5a, 0x20, 0x3f, 0xc3, 0xc7, 0x76, 0x68, 0x50, 0x47,
-  0x99, 0xf7, 0xba, 0x91, 0xfc, 0x7c, 0x33, 0x42, 0xa1, 0xe4, 0x5d, 0x29,
-  0xc9, 0x2e, 0x47, 0x3f, 0x22, 0x21, 0xe8, 0xa4, 0x74, 0x26, 0x1a, 0x9d,
-  0x02, 0x69, 0xe6, 0x0e, 0xdd, 0x43, 0x92, 0x6e, 0x2f, 0x25, 0x75, 0xa2,
-  0x10, 0xf8, 0x3d, 0x0a, 0x5c, 0xb3, 0xf0, 0x01, 0xd9, 0xee, 0x01, 0x2a,
-  0xdf, 0x2f, 0x43, 0x6c, 0x05, 0xee, 0xb0, 0x3d, 0x84, 0xbf, 0x1e, 0x25,
-  0x21, 0x47, 0x07, 0xc7, 0x25, 0xba, 0x48, 0x54, 0x10, 0xc5, 0xa9, 0xc8,
-  0x48, 0x21, 0xe4, 0xbf, 0xc6, 0x26, 0x6a, 0x5c, 0x98, 0x73, 0x96, 0x26,
-  0x83, 0xbf, 0x06, 0xa2, 0x74, 0x11, 0x08, 0xd1, 0x43, 0x71, 0x27, 0x79,
-  0x92, 0xc6, 0x8e, 0x4f, 0x4a, 0x5c, 0x57, 0xe5, 0x11, 0x62, 0x1f, 0x1a,
-  0xca, 0x25, 0x16, 0xd8, 0x2c, 0x12, 0xe3, 0xe4, 0x21, 0x0b, 0x63, 0x90,
-  0x05, 0x57, 0x57, 0x84, 0xee, 0x2f, 0x61, 0x45, 0x34, 0x80, 0xb9, 0x0d,
-  0x7b, 0x08, 0xf2, 0x3f, 0x45, 0x4c, 0x82, 0xb9, 0xb5, 0x72, 0x25, 0x5b,
-  0x7f, 0x29, 0x20, 0xdf, 0x1c, 0x44, 0x85, 0x73, 0xff, 0x1c, 0x59, 0x3c,
-  0x2e, 0x5b, 0xbe, 0x05, 0x16, 0x87, 0x5d, 0x81, 0x72, 0x34, 0xbb, 0xf2,
-  0x1f, 0xa0, 0xe9, 0xc5, 0xf4, 0x8b, 0xf0, 0x79, 0xe6, 0x5d, 0xeb, 0x4e,
-  0xff, 0x00, 0x59, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x66, 0xff, 0x3a, 0x54,
-  0x3a, 0x68, 0x3a, 0x64, 0x3a, 0xc8, 0xaa, 0x08, 0xbf, 0x84, 0xfe, 0x80,
-  0xd6, 0x00, 0xbe, 0x49, 0xff, 0xb4, 0x41, 0xbb, 0xaa, 0x55, 0x8a, 0x56,
-  0xfc, 0xfe, 0xcd, 0x13, 0x88, 0x66, 0xfc, 0x5a, 0xec, 0x2d, 0xda, 0xf7,
-  0x4e, 0xf8, 0x73, 0x13, 0xc6, 0x02, 0x18, 0x89, 0x14, 0x87, 0x19, 0xe9,
-  0x1d, 0x55, 0xfe, 0x52, 0xcb, 0xd0, 0x5b, 0x2e, 0x67, 0x55, 0xaa, 0x14,
-  0xc7, 0x14, 0xcc, 0x3c, 0x21, 0x8d, 0xfb, 0x0f, 0xf8, 0x25, 0x05, 0x41,
-  0x1d, 0xc3, 0x12, 0x60, 0x1a, 0x73, 0x3a, 0x6c, 0xeb, 0x10, 0x11, 0x2e,
-  0x00, 0xcb, 0x3c, 0x43, 0x76, 0x7c, 0xd8, 0x89, 0x97, 0x38, 0xe9, 0x00,
-  0xad, 0x2c, 0x5d, 0xea, 0xfe, 0x88, 0x00, 0x05, 0x5a, 0xc4, 0x68, 0xff,
-  0x5f, 0x31, 0x02, 0x01, 0x6c, 0x8d, 0x02, 0x00, 0xbc, 0xff, 0x8d, 0x86,
-  0xfc, 0x46, 0x88, 0xe5, 0x1c, 0x8b, 0x7c, 0x10, 0xf6, 0x04, 0xf7, 0x96,
-  0x56, 0x0e, 0x80, 0x12, 0x9a, 0x7c, 0xeb, 0x2d, 0x6a, 0x01, 0x02, 0xc0,
-  0x36, 0x03, 0x50, 0xda, 0x13, 0x11, 0xaa, 0xea, 0x11, 0x0c, 0xab, 0xd2,
-  0x15, 0x52, 0x46, 0x78, 0x80, 0x1a, 0x2d, 0xc0, 0x55, 0x60, 0xb7, 0x3c,
-  0x7c, 0xcd, 0x75, 0xdd, 0x10, 0x72, 0xc5, 0xcc, 0x55, 0x63, 0x5f, 0x57,
-  0xb5, 0x98, 0x8a, 0x47, 0x1e, 0x80, 0xb0, 0x48, 0x6f, 0xec, 0x11, 0x9d,
-  0x5d, 0xce, 0x27, 0x12, 0x74, 0x24, 0xd9, 0xe8, 0xa4, 0x9b, 0x25, 0xf0,
-  0xd1, 0x04, 0x07, 0xf5, 0x76, 0xd4, 0xd0, 0xe2, 0x01, 0x5f, 0x8a, 0xf0,
-  0x03, 0xa3, 0xd3, 0x2b, 0x85, 0x48, 0x76, 0xba, 0xd3, 0x18, 0x0a, 0xcf,
-  0x4e, 0x43, 0x00, 0x57, 0x66, 0xf7, 0xe8, 0x6e, 0x08, 0x06, 0x82, 0x36,
-  0x25, 0x1b, 0x0a, 0x4f, 0x6f, 0x52, 0x6e, 0x57, 0x77, 0xf0, 0x1b, 0x7c,
-  0xec, 0x57, 0x87, 0xc1, 0xe4, 0x5b, 0x9e, 0xde, 0xd1, 0xd1, 0xe3, 0x2c,
-  0x52, 0x03, 0x2c, 0x35, 0x07, 0x15, 0x9c, 0x9c, 0xed, 0x15, 0x87, 0xb3,
-  0x05, 0xc4, 0x2a, 0x6f, 0xcc, 0x5d, 0x3f, 0x41, 0x1f, 0x16, 0xd7, 0x23,
-  0xff, 0xe2, 0xb7, 0xa2, 0x6c, 0x5a, 0x48, 0x49, 0x06, 0x53, 0x8a, 0x36,
-  0x10, 0x03, 0xed, 0xf8, 0x41, 0xc4, 0x81, 0x7f, 0xa1, 0x98, 0x9a, 0x6c,
-  0x23, 0x6d, 0x10, 0xcd, 0xf1, 0x70, 0xca, 0x88, 0x91, 0xc0, 0x61, 0x51,
-  0x2c, 0x8f, 0x05, 0x01, 0xc2, 0xb4, 0x87, 0x1e, 0xb1, 0xa9, 0x82, 0x90,
-  0x94, 0x18, 0x83, 0xba, 0xf9, 0x39, 0xc0, 0x6e, 0xbc, 0xce, 0x48, 0xf6,
-  0x16, 0x5b, 0x46, 0xe7, 0x4b, 0x51, 0x31, 0x4e, 0x91, 0xc9, 0x96, 0xb3,
-  0xbf, 0x15, 0x34, 0x80, 0x41, 0x72, 0x8c, 0x32, 0x13, 0x00, 0x84, 0x10,
-  0x64, 0xcc, 0x61, 0xc3, 0x2e, 0x09, 0xcd, 0x80, 0xb9, 0x75, 0xb0, 0x2e,
-  0x4d, 0x0e, 0x3e, 0x48, 0x36, 0x8c, 0xc8, 0xbc, 0xd5, 0xb4, 0xd8, 0x06,
-  0x31, 0x00, 0x48, 0x4e, 0x43, 0x2a, 0x0d, 0xa0, 0x06, 0xe6, 0x85, 0x6c,
-  0x65, 0xa7, 0x79, 0x83, 0xbf, 0x7a, 0x00, 0x7e, 0x4b, 0x07, 0x2a, 0x60,
-  0x74, 0x1e, 0xc9, 0x47, 0x78, 0x05, 0xc5, 0x11, 0x5b, 0x19, 0xfc, 0x32,
-  0x2d, 0xa7, 0x02, 0x58, 0xd9, 0x1a, 0x85, 0x32, 0xfa, 0x6e, 0x62, 0x99,
-  0xff, 0xb2, 0xda, 0xfa, 0x36, 0x99, 0x86, 0x2f, 0x91, 0x1d, 0xfa, 0x72,
-  0xa6, 0xff, 0x18, 0xa7, 0x48, 0xb4, 0x4e, 0xa4, 0x00, 0x91, 0x03, 0xc6,
-  0xb1, 0x08, 0xfc, 0xd3, 0x95, 0xe7, 0x74, 0x13, 0x56, 0x06, 0x07, 0x24,
-  0x8f, 0x4b, 0xff, 0xb1, 0x02, 0xe8, 0x08, 0x95, 0x25, 0x00, 0x03, 0x56,
-  0x93, 0xab, 0xb9, 0xde, 0x11, 0xef, 0x25, 0x17, 0x95, 0x5b, 0x59, 0x56,
-  0xb5, 0x74, 0xf8, 0xd7, 0xc8, 0x8b, 0x6f, 0x35, 0xcf, 0x83, 0x48, 0x46,
-  0xb6, 0x12, 0x0e, 0x10, 0x00, 0x92, 0x2c, 0x41, 0x33, 0xdb, 0x13, 0x65,
-  0x0e, 0x97, 0x0c, 0xff, 0x15, 0x5a, 0xa5, 0x00, 0xb1, 0x31, 0xe6, 0x2b,
-  0xca, 0x1b, 0xed, 0x01, 0x94, 0x2b, 0x74, 0xb5, 0x1b, 0x7a, 0x5d, 0xc2,
-  0xf6, 0xb0, 0x93, 0x71, 0x6d, 0x4e, 0x3f, 0x96, 0x5e, 0xc3, 0x96, 0x3c,
-  0xd1, 0xe9, 0x94, 0x16, 0x45, 0x2d, 0x1b, 0x97, 0xa9, 0x1f, 0x5a, 0x06,
-  0xd0, 0xe6, 0x25, 0x71, 0xbc, 0x6e, 0x01, 0x75, 0x81, 0x3b, 0xa0, 0xce,
-  0xe4, 0x1a, 0x2f, 0xe9, 0x74, 0x67, 0xcc, 0x61, 0x76, 0x13, 0x8a, 0x92,
-  0x93, 0x64, 0x7f, 0x2b, 0xc9, 0xeb, 0x96, 0x32, 0x59, 0x1b, 0xe8, 0x2c,
-  0x25, 0x31, 0xe4, 0xea, 0x93, 0x86, 0x25, 0x35, 0xbd, 0xc1, 0x2e, 0x6b,
-  0x9e, 0x24, 0xc1, 0x30, 0xa7, 0x1c, 0x8e, 0x01, 0x64, 0x0b, 0x70, 0xfa,
-  0x17, 0x15, 0x48, 0xf4, 0x74, 0xf0, 0xf2, 0xdf, 0xf2, 0x22, 0x04, 0xa5,
-  0x97, 0x0c, 0x7a, 0x05, 0x80, 0xff, 0x3b, 0xa1, 0xcd, 0x7f, 0x7c, 0x06,
-  0xb8, 0xff, 0x00, 0xe9, 0xde, 0xa7, 0x01, 0x1e, 0xa3, 0xda, 0xc7, 0x27,
-  0x61, 0x48, 0x58, 0xfc, 0x6c, 0x50, 0x10, 0xbf, 0x8b, 0x87, 0x4c, 0x58,
-  0xff, 0x8b, 0x97, 0x4a, 0x58, 0x89, 0x15, 0x89, 0x45, 0xb0, 0x02, 0x16,
-  0x39, 0x50, 0xa5, 0x4e, 0xdb, 0x55, 0x04, 0x17, 0x06, 0x20, 0x73, 0x54,
-  0x4d, 0x52, 0x08, 0x28, 0x97, 0xac, 0x85, 0x26, 0x1d, 0x8d, 0xe9, 0xf0,
-  0x44, 0x01, 0xb4, 0x08, 0x2c, 0xa5, 0x04, 0xbf, 0x8a, 0xd9, 0x80, 0xe3,
-  0x3f, 0x00, 0x5b, 0x8c, 0x88, 0xe1, 0x5e, 0xf0, 0x88, 0x6c, 0x5b, 0x0d,
-  0x8a, 0xec, 0xcd, 0xd0, 0xeb, 0x01, 0xbc, 0x8a, 0xeb, 0x37, 0xfc, 0x88,
-  0x76, 0xf4, 0xd5, 0x81, 0x3e, 0x1c, 0x67, 0xb5, 0xe0, 0xd6, 0xf8, 0xa3,
-  0x09, 0x83, 0x13, 0x67, 0xfc, 0xd4, 0x55, 0xff, 0x1f, 0xd7, 0x02, 0x10,
-  0x6b, 0xed, 0xdf, 0x6d, 0x0b, 0xdd, 0xdb, 0x74, 0x08, 0x07, 0xf0, 0x2d,
-  0xf2, 0xd1, 0x1a, 0x3a, 0xc9, 0x77, 0x08, 0x76, 0x56, 0xf4, 0x8b, 0x1d,
-  0xf2, 0xb6, 0x0b, 0xf0, 0x7f, 0x07, 0x83, 0xd1, 0x7d, 0x0c, 0xff, 0x11,
-  0x83, 0x00, 0x8c, 0x5e, 0xee, 0x0b, 0x0d, 0xec, 0xca, 0x8a, 0xc7, 0x18,
-  0x77, 0x34, 0x7d, 0xe8, 0x2f, 0x54, 0xea, 0xb4, 0x48, 0x75, 0x99, 0x8e,
-  0xbc, 0x18, 0x8b, 0x76, 0xec, 0x1f, 0x45, 0xfe, 0x62, 0x65, 0xef, 0x44,
-  0xfe, 0xe9, 0x90, 0x00, 0xdb, 0xa1, 0x9c, 0x2a, 0x16, 0xdb, 0x9a, 0xc7,
-  0x28, 0xe4, 0x53, 0x8e, 0x33, 0x63, 0x19, 0x0f, 0x76, 0xf2, 0x02, 0xcb,
-  0xf0, 0xe6, 0x2f, 0xe4, 0xe8, 0x93, 0x86, 0x91, 0xf7, 0xc6, 0x8e, 0x91,
-  0x48, 0x1c, 0xea, 0xb3, 0xe8, 0x71, 0x72, 0x13, 0x77, 0xe0, 0x4a, 0x56,
-  0xca, 0x11, 0x6d, 0x1a, 0xaa, 0xf8, 0xe4, 0x15, 0x5a, 0x63, 0x16, 0x5f,
-  0x29, 0x05, 0xf0, 0x61, 0x40, 0xd4, 0xf6, 0x3c, 0x0e, 0xfa, 0x0b, 0xe8,
-  0xf8, 0x3e, 0x51, 0x10, 0x64, 0x1a, 0x82, 0x02, 0x36, 0x2f, 0xf8, 0x50,
-  0xac, 0xcd, 0xaa, 0x10, 0xea, 0x7c, 0xa4, 0xb2, 0x9b, 0x57, 0xac, 0x40,
-  0xad, 0xae, 0xa4, 0x44, 0xb0, 0x95, 0x1d, 0x26, 0x24, 0x1f, 0x78, 0x90,
-  0x55, 0x0b, 0xc6, 0x80, 0xb7, 0x53, 0x03, 0x9c, 0x0e, 0xff, 0x01, 0x03,
-  0x47, 0x29, 0x13, 0x57, 0x2b, 0xeb, 0xb2, 0x31, 0x1c, 0x06, 0x50, 0xde,
-  0x1b, 0x48, 0xbb, 0x35, 0xab, 0xe2, 0x1f, 0x5a, 0x58, 0x03, 0x80, 0xf5,
-  0x72, 0x06, 0x13, 0x90, 0x2c, 0xd0, 0x5f, 0x51, 0xd2, 0x36, 0x08, 0x1a,
-  0x81, 0xa0, 0x46, 0x38, 0xc8, 0xfe, 0x32, 0x6f, 0xad, 0x6e, 0xfd, 0xe9,
-  0x11, 0x01, 0x68, 0x8a, 0x21, 0x74, 0x40, 0x35, 0x8e, 0x03, 0xd0, 0x17,
-  0x0f, 0x22, 0x52, 0x4a, 0x43, 0x83, 0x80, 0x58, 0x13, 0x6b, 0x4e, 0x55,
-  0xdc, 0xfd, 0x7b, 0x43, 0x59, 0x14, 0x9b, 0xa9, 0x16, 0x27, 0x83, 0x79,
-  0xf6, 0x20, 0x0b, 0x74, 0x0f, 0x0e, 0x07, 0x0c, 0x16, 0x75, 0x83, 0xfe,
-  0x72, 0xfc, 0x47, 0xaf, 0x75, 0x87, 0x2b, 0xa5, 0x42, 0x05, 0x88, 0x95,
-  0x93, 0x80, 0x48, 0xdb, 0x49, 0x02, 0x47, 0x70, 0x80, 0xd4, 0xac, 0x5b,
-  0x68, 0xc2, 0xa1, 0x0f, 0x34, 0xb6, 0xeb, 0x3c, 0x1f, 0x13, 0x39, 0x2d,
-  0x37, 0x80, 0x0e, 0xcb, 0x35, 0x33, 0x60, 0x3d, 0x32, 0x31, 0xc8, 0x2f,
-  0x78, 0xf9, 0x0e, 0x9f, 0x40, 0x3e, 0x42, 0xb8, 0x5f, 0x62, 0x74, 0x56,
-  0x05, 0x4b, 0x07, 0x50, 0x64, 0x67, 0x3c, 0x56, 0x68, 0x96, 0x5b, 0x82,
-  0x2e, 0x88, 0x72, 0x15, 0xac, 0x2f, 0xb5, 0xfc, 0x80, 0xbf, 0xfb, 0xae,
-  0xc7, 0x20, 0x72, 0x25, 0x06, 0xfe, 0x7a, 0x77, 0x1e, 0x6a, 0x0b, 0xc8,
-  0x32, 0x58, 0xf7, 0x78, 0x45, 0x83, 0x99, 0x4a, 0x74, 0xfc, 0x04, 0xd8,
-  0xe7, 0xfe, 0x69, 0x1d, 0x17, 0x64, 0xb9, 0x0f, 0x81, 0xc2, 0xc2, 0x2e,
-  0x01, 0x1e, 0xe4, 0xb1, 0x88, 0x0f, 0xb1, 0x2c, 0xf0, 0x01, 0xe8, 0x5b,
-  0x42, 0x9c, 0x1f, 0xe6, 0x80, 0xda, 0xb9, 0x17, 0x16, 0x20, 0x10, 0xc2,
-  0x0f, 0x42, 0x21, 0x01, 0xc2, 0x24, 0x9b, 0xf6, 0xe8, 0xfa, 0xfd, 0x50,
-  0x8c, 0x6c, 0xc7, 0x47, 0x8f, 0x3b, 0x08, 0x25, 0x79, 0x9c, 0x0e, 0xe4,
-  0x42, 0x0f, 0xb1, 0x45, 0x6e, 0x23, 0xb1, 0x43, 0xc0, 0x10, 0xe6, 0x41,
-  0x90, 0x3f, 0x39, 0x3d, 0xb0, 0x3b, 0x01, 0x87, 0x2b, 0xcd, 0x92, 0x0d,
-  0x64, 0x17, 0x16, 0x64, 0x61, 0x22, 0x65, 0xc5, 0xc8, 0x0b, 0x71, 0x1c,
-  0x26, 0x9c, 0x1f, 0x80, 0x6c, 0xfc, 0xf0, 0x21, 0x82, 0x9c, 0x23, 0x17,
-  0xd8, 0xe1, 0xfe, 0x83, 0x55, 0x10, 0x7e, 0x2c, 0xa5, 0xfd, 0x3c, 0xcd,
-  0x5f, 0xaa, 0x10, 0x34, 0x8a, 0x1b, 0x81, 0x41, 0x88, 0x82, 0x9d, 0xa6,
-  0xb6, 0x09, 0x10, 0x04, 0xc1, 0x8b, 0xad, 0xab, 0x09, 0xe5, 0x8c, 0x6c,
-  0x01, 0x9d, 0x8d, 0x2d, 0xb1, 0x1a, 0x46, 0xaf, 0x0d, 0xff, 0x34, 0xff,
-  0xc7, 0x64, 0x91, 0xc4, 0xc8, 0x4b, 0xae, 0x22, 0x70, 0x0f, 0xa3, 0x59,
-  0x25, 0x93, 0x80, 0xd9, 0x00, 0x1b, 0xf3, 0x47, 0xf0, 0x20, 0x5b, 0x89,
-  0x87, 0x68, 0xdc, 0xa3, 0x57, 0xee, 0xd9, 0x2a, 0x90, 0x23, 0xae, 0x87,
-  0x15, 0x6d, 0xd3, 0x2b, 0xaa, 0xf0, 0x17, 0x7c, 0xd8, 0x70, 0xdb, 0x96,
-  0x62, 0x97, 0x90, 0x0d, 0x38, 0xfc, 0x09, 0xc4, 0xa5, 0x2a, 0x49, 0x18,
-  0xe4, 0x94, 0x0c, 0x0e, 0xf0, 0x13, 0x3a, 0x0c, 0x92, 0x20, 0x6d, 0xb6,
-  0x64, 0xfa, 0x40, 0xcb, 0x0f, 0xb6, 0x1e, 0x5c, 0x8b, 0x4c, 0x96, 0x41,
-  0x1c, 0x0c, 0x03, 0x1b, 0x54, 0xd6, 0x60, 0x44, 0x55, 0x78, 0x32, 0x63,
-  0x97, 0x71, 0xe8, 0xe1, 0x8a, 0x90, 0x5f, 0xb4, 0x54, 0x0a, 0x8b, 0x44,
-  0x97, 0x08, 0xd4, 0x90, 0xfc, 0x89, 0x44, 0x12, 0x89, 0x54, 0x14, 0x10,
-  0x60, 0x1b, 0x0b, 0x0d, 0x5b, 0x40, 0x14, 0x61, 0x0c, 0xf5, 0xe8, 0x7c,
-  0xb8, 0x73, 0x93, 0x2c, 0x65, 0x16, 0xeb, 0x18, 0xeb, 0x30, 0xa9, 0xd5,
-  0x28, 0x96, 0x5f, 0x61, 0xe8, 0x47, 0x67, 0x59, 0x14, 0x6d, 0xf8, 0x58,
-  0xb4, 0x05, 0xc7, 0x3b, 0xd4, 0x31, 0x5f, 0x04, 0x04, 0x3c, 0x06, 0xf3,
-  0x08, 0xcd, 0x0a, 0x84, 0x5a, 0x4e, 0xf9, 0x05, 0xfc, 0x19, 0xfe, 0x1c,
-  0x00, 0x01, 0xf2, 0x02, 0x32, 0x04, 0x32, 0x06, 0x32, 0x08, 0x32, 0x0a,
-  0x20, 0x55, 0x3c, 0x7e, 0x0c, 0x6a, 0x35, 0x15, 0xa6, 0x61, 0x4f, 0xc7,
-  0xd6, 0xff, 0xcb, 0x1e, 0x8e, 0x9b, 0x80, 0x8b, 0xdf, 0x42, 0x62, 0xe0,
-  0xc7, 0x80, 0xe4, 0x63, 0x27, 0x2b, 0xd7, 0x45, 0x37, 0x38, 0x9b, 0x11,
-  0x59, 0x10, 0x27, 0x79, 0x68, 0xaa, 0x0b, 0xc2, 0x60, 0xc3, 0x20, 0x63,
-  0x6c, 0x0b, 0x60, 0x82, 0x22, 0x0c, 0x74, 0x0f, 0xe5, 0xe9, 0xc2, 0x56,
-  0x0b, 0x41, 0x7c, 0xa3, 0x28, 0x5f, 0x09, 0x7f, 0x87, 0x6b, 0x01, 0xcd,
-  0x71, 0x71, 0xc2, 0xc1, 0xe0, 0x33, 0xa9, 0xd1, 0x40, 0xc8, 0x39, 0xc9,
-  0x0e, 0xe3, 0xfa, 0x8a, 0x97, 0x68, 0x75, 0xb6, 0x00, 0x36, 0x79, 0x50,
-  0x1e, 0xc0, 0x14, 0xe4, 0xa8, 0x11, 0x6e, 0xb9, 0x7c, 0x0c, 0xf0, 0x7a,
-  0x6b, 0xfb, 0x16, 0xf5, 0x87, 0xa7, 0x5a, 0xa7, 0x8a, 0xd6, 0x38, 0x08,
-  0xc8, 0xa6, 0xa5, 0x23, 0xcc, 0x61, 0xf7, 0xb9, 0xff, 0x66, 0xfe, 0x08,
-  0x7f, 0xe1, 0x50, 0x2f, 0x89, 0x40, 0xb1, 0x31, 0x2d, 0xaa, 0xa5, 0xe0,
-  0xd5, 0x24, 0x37, 0xdb, 0x58, 0x16, 0x33, 0x56, 0xfe, 0xb5, 0x0b, 0x84,
-  0x49, 0x39, 0x49, 0xf8, 0x2b, 0x96, 0x37, 0x39, 0xc6, 0x77, 0xab, 0x43,
-  0x90, 0xaa, 0x72, 0xe9, 0xf6, 0x57, 0x3b, 0x2c, 0x3d, 0x8c, 0xa9, 0x91,
-  0xcb, 0x3f, 0x41, 0x26, 0xca, 0x49, 0xf2, 0xd1, 0xf7, 0x57, 0x43, 0x2c,
-  0x45, 0xc3, 0xc8, 0x52, 0x8f, 0x89, 0x7f, 0x76, 0xac, 0xc7, 0x1d, 0x5b,
-  0x4c, 0xee, 0x47, 0x03, 0xb1, 0x49, 0x1d, 0x9a, 0xb2, 0xb0, 0x48, 0x66,
-  0x4b, 0x86, 0x4d, 0x34, 0x9b, 0x01, 0x63, 0x01, 0x64, 0x84, 0xf1, 0x83,
-  0x78, 0x20, 0x3d, 0x78, 0x51, 0x97, 0x11, 0x8b, 0x77, 0x44, 0x50, 0x47,
-  0x3b, 0x88, 0x44, 0x37, 0xdc, 0x3b, 0x54, 0xec, 0x08, 0x75, 0x10, 0x18,
-  0x96, 0xab, 0xc0, 0x33, 0x2d, 0x27, 0x0e, 0x81, 0x0f, 0xb4, 0xbb, 0x26,
-  0x38, 0xcb, 0x12, 0xcd, 0x37, 0x01, 0x39, 0x28, 0xcd, 0xe6, 0xb2, 0x02,
-  0x06, 0xd9, 0x04, 0x1e, 0x3d, 0xff, 0x70, 0x39, 0xb6, 0x02, 0x37, 0x0e,
-  0x03, 0x35, 0x2c, 0x33, 0x80, 0xcb, 0x49, 0x47, 0xe1, 0xe8, 0xf0, 0xf5,
-  0xb9, 0x64, 0x14, 0x03, 0x48, 0x32, 0xb0, 0xd4, 0xb9, 0x3f, 0xad, 0x41,
-  0x18, 0x96, 0x0a, 0x08, 0x42, 0xe6, 0x43, 0xb0, 0x45, 0x83, 0x31, 0x86,
-  0x9e, 0xc8, 0xe6, 0x42, 0x23, 0x07, 0x03, 0x2f, 0x5a, 0x13, 0x50, 0x86,
-  0x4d, 0x7a, 0xb2, 0x6d, 0x82, 0xb0, 0x98, 0xc4, 0x4b, 0x35, 0x89, 0x4d,
-  0x96, 0x6d, 0x1e, 0x05, 0xa8, 0x4b, 0x95, 0x00, 0x22, 0xbc, 0xc2, 0x7d,
-  0xe6, 0x3b, 0xa4, 0x3d, 0xe8, 0x09, 0x65, 0x7d, 0xcb, 0x3d, 0x3b, 0x20,
-  0x7f, 0x2b, 0x40, 0x2f, 0x5a, 0x1b, 0xd6, 0x50, 0x31, 0x3a, 0x6e, 0x83,
-  0xcb, 0x76, 0xb4, 0x0c, 0x24, 0x32, 0x4f, 0xc2, 0x51, 0xb9, 0x07, 0x05,
-  0x06, 0x28, 0xb0, 0x0e, 0x3a, 0x0f, 0x8d, 0xbe, 0x50, 0x25, 0xc6, 0x74,
-  0x40, 0x82, 0xd1, 0x41, 0xe1, 0x89, 0x94, 0x0e, 0xec, 0x03, 0x96, 0x4d,
-  0x4b, 0xda, 0x12, 0x14, 0x5d, 0x7c, 0x84, 0x16, 0x81, 0x16, 0xcb, 0x51,
-  0x4f, 0x2c, 0x10, 0xda, 0x12, 0x01, 0x70, 0xf2, 0x35, 0xcc, 0x57, 0x2d,
-  0xcb, 0xbc, 0xa3, 0x3a, 0x2d, 0xf8, 0x78, 0x07, 0x6a, 0xb1, 0x65, 0xed,
-  0xff, 0x77, 0x1b, 0x02, 0xb3, 0x19, 0x09, 0x96, 0x17, 0x15, 0x4e, 0x13,
-  0x5a, 0x11, 0xfc, 0x01, 0x6a, 0x07, 0x80, 0xb7, 0x34, 0xfb, 0xfb, 0x15,
-  0x7b, 0xce, 0x09, 0xb1, 0x39, 0x07, 0x56, 0xd1, 0x7c, 0xe9, 0x2f, 0x07,
-  0x51, 0xd4, 0xe9, 0xfa, 0xa9, 0xfa, 0xdb, 0xb2, 0x80, 0xbf, 0xc0, 0x00,
-  0x16, 0xa9, 0xd0, 0x84, 0xa9, 0xcd, 0xf0, 0x00, 0x60, 0x90, 0x54, 0xba,
-  0x83, 0xf1, 0xfc, 0x48, 0xa7, 0x43, 0x6f, 0x92, 0xf3, 0x9d, 0x90, 0x3b,
-  0xb0, 0xbf, 0x80, 0x6a, 0xf7, 0x40, 0xf3, 0x98, 0x80, 0x95, 0x1c, 0x6d,
-  0xd0, 0x41, 0xac, 0xce, 0x4d, 0x21, 0xc9, 0x53, 0xf4, 0x5c, 0x43, 0xc2,
-  0x54, 0x67, 0x81, 0xad, 0x7b, 0xf1, 0xf2, 0x7d, 0x2b, 0x9a, 0x47, 0x49,
-  0x4e, 0xa9, 0x48, 0xe6, 0x4b, 0xd2, 0x4d, 0x01, 0xfb, 0x11, 0xd8, 0xd5,
-  0xcb, 0x03, 0x4f, 0x32, 0x64, 0xa6, 0x84, 0xfd, 0x28, 0x67, 0xf7, 0x04,
-  0x23, 0x00, 0x92, 0xff, 0x05, 0xb6, 0x1f, 0x57, 0x7d, 0x59, 0x01, 0x60,
-  0x01, 0xe4, 0x2b, 0x02, 0xbc, 0xb8, 0x2c, 0x23, 0xd4, 0x18, 0x65, 0x12,
-  0xdf, 0x8b, 0x48, 0x90, 0x6a, 0x51, 0xf9, 0x04, 0x16, 0xe4, 0x11, 0xb0,
-  0xcb, 0x37, 0x05, 0xac, 0x0f, 0x10, 0x25, 0x70, 0x06, 0x4d, 0x4a, 0x97,
-  0x25, 0x43, 0x33, 0x14, 0x66, 0x45, 0x47, 0xc0, 0x56, 0x4b, 0x0d, 0x05,
-  0xc5, 0xb0, 0xd2, 0xb4, 0xb0, 0xb0, 0x10, 0x19, 0x41, 0x9a, 0x4e, 0xca,
-  0x87, 0x51, 0x8c, 0xee, 0x57, 0xb2, 0x47, 0xd8, 0x5f, 0x4a, 0x05, 0x35,
-  0x52, 0x38, 0x1d, 0x43, 0x90, 0xea, 0x5a, 0x03, 0x90, 0x69, 0x1c, 0x80,
-  0x52, 0xa3, 0x8d, 0x48, 0x96, 0xf1, 0x14, 0x40, 0xb5, 0x95, 0x82, 0x86,
-  0xc8, 0x70, 0x04, 0x55, 0xc9, 0x95, 0x84, 0xb6, 0x1a, 0x4f, 0x70, 0xa1,
-  0xb2, 0x00, 0xab, 0x46, 0x8a, 0x22, 0xd8, 0x9b, 0x12, 0xc0, 0x9a, 0x42,
-  0xbb, 0xc3, 0x13, 0xba, 0x6c, 0xeb, 0x5a, 0x45, 0x00, 0x36, 0xf6, 0x14,
-  0xe4, 0x78, 0xf0, 0xac, 0x66, 0xc1, 0xb2, 0xc9, 0x2c, 0x7b, 0xe2, 0x28,
-  0x96, 0xcb, 0x13, 0x80, 0x0a, 0x2f, 0xb6, 0xcc, 0x90, 0x15, 0x30, 0x64,
-  0xcd, 0xed, 0xa8, 0xaf, 0x5c, 0x92, 0x0c, 0x19, 0x5b, 0xa8, 0x5d, 0xef,
-  0x90, 0xfa, 0x05, 0x10, 0x00, 0x13, 0xfa, 0xac, 0x02, 0xe3, 0x05, 0x9d,
-  0xb1, 0x0c, 0x03, 0x67, 0x6f, 0x1b, 0x17, 0xa7, 0x2c, 0x0b, 0x03, 0xc9,
-  0x4b, 0x06, 0x43, 0x63, 0x92, 0xef, 0xbc, 0x5a, 0x06, 0xb9, 0x5c, 0x06,
-  0x02, 0xf2, 0x5e, 0x06, 0xd0, 0x60, 0xcc, 0x47, 0x4d, 0x0b, 0xc9, 0x47,
-  0xf0, 0x5c, 0x62, 0xda, 0x64, 0x06, 0x40, 0xbd, 0xbd, 0xe5, 0xee, 0x95,
-  0x7d, 0xcd, 0x66, 0x68, 0x27, 0xa9, 0x24, 0x73, 0x6a, 0x6b, 0x6c, 0x06,
-  0x0b, 0x08, 0xec, 0xc9, 0xcb, 0x01, 0x9b, 0x6e, 0x70, 0x06, 0x58, 0x0b,
-  0x53, 0x72, 0x9b, 0x06, 0x74, 0x06, 0x21, 0x4e, 0x76, 0x06, 0x6c, 0x78,
-  0x06, 0x83, 0x54, 0x90, 0x01, 0x1c, 0x4b, 0x06, 0xf6, 0x41, 0x12, 0x5b,
-  0x9a, 0x66, 0x5e, 0x08, 0x1e, 0x2c, 0x14, 0xb6, 0xff, 0xdd, 0x01, 0x14,
-  0x64, 0x32, 0x42, 0x90, 0x16, 0x1a, 0xb5, 0x03, 0xac, 0x24, 0x10, 0x06,
-  0x60, 0x69, 0x5e, 0x2e, 0x8b, 0xf1, 0xa0, 0xc3, 0x7d, 0xae, 0x2c, 0x76,
-  0x83, 0xf4, 0xed, 0x16, 0xb7, 0x14, 0x40, 0xb4, 0x80, 0x7a, 0x39, 0x6a,
-  0x06, 0xb2, 0x6c, 0x06, 0x01, 0xde, 0x6e, 0x1a, 0x15, 0x21, 0x84, 0x9b,
-  0x33, 0x70, 0x48, 0x6e, 0x1c, 0x6c, 0xd2, 0x6a, 0x41, 0xa4, 0x4a, 0x84,
-  0x2c, 0x40, 0x13, 0x33, 0x3f, 0xb0, 0xa7, 0x43, 0x08, 0xea, 0x12, 0x94,
-  0x9d, 0x21, 0x0c, 0x02, 0xd9, 0x10, 0x5c, 0x9a, 0xe9, 0xa7, 0x38, 0xc8,
-  0x33, 0x00, 0x1f, 0xe9, 0xc4, 0xf4, 0xd4, 0xbf, 0x18, 0xf0, 0x74, 0x18,
-  0x0b, 0x5a, 0xd3, 0x92, 0xf8, 0x7f, 0x63, 0xf3, 0xe8, 0x51, 0xea, 0xe8,
-  0xc1, 0x36, 0xf0, 0x60, 0x30, 0x3c, 0x7e, 0x12, 0xbf, 0x14, 0x22, 0x41,
-  0x17, 0xc3, 0x1b, 0x57, 0x45, 0x9a, 0x8d, 0x0c, 0x64, 0x2e, 0x26, 0x05,
-  0xbb, 0xb0, 0x19, 0x1a, 0x86, 0x99, 0xf5, 0x78, 0x75, 0xe6, 0xc6, 0x44,
-  0x82, 0xf8, 0x0a, 0x5d, 0xce, 0x01, 0x75, 0x15, 0xcd, 0xdf, 0x2f, 0x91,
-  0x12, 0x91, 0x06, 0xaa, 0x04, 0xb7, 0x5c, 0xc6, 0x6c, 0x6c, 0x2b, 0x0e,
-  0xa2, 0x25, 0x6e, 0xfa, 0x06, 0x22, 0xe8, 0xdd, 0x62, 0xa9, 0xdd, 0xb0,
-  0xbe, 0x5a, 0x1a, 0xff, 0x02, 0x30, 0x7b, 0x44, 0x60, 0xb2, 0xff, 0x8a,
-  0x6c, 0x8a, 0x46, 0x0a, 0xa2, 0x8c, 0xaa, 0x6c, 0x61, 0xaf, 0x43, 0x42,
-  0x6d, 0x8e, 0x6c, 0x4d, 0xf7, 0x8c, 0x1e, 0x90, 0x6c, 0x38, 0x4b, 0x13,
-  0xa4, 0x23, 0x85, 0x35, 0x46, 0x68, 0x5e, 0xa5, 0x09, 0xff, 0x16, 0x92,
-  0x6c, 0xa3, 0x94, 0x6c, 0xb4, 0x42, 0x10, 0xa2, 0xac, 0x2b, 0x52, 0x44,
-  0x3a, 0xa9, 0xb8, 0x32, 0x01, 0x20, 0x9c, 0x88, 0x64, 0x0f, 0x08, 0x08,
-  0x8a, 0xed, 0xce, 0x34, 0xe9, 0xbb, 0x03, 0x32, 0xe9, 0x10, 0x01, 0x9b,
-  0x30, 0x2e, 0xe9, 0x65, 0xda, 0x7b, 0xe8, 0x1c, 0xd7, 0xa2, 0x14, 0x91,
-  0x65, 0x78, 0xc8, 0x08, 0xfc, 0xb9, 0x56, 0xe8, 0x2a, 0x04, 0x60, 0x56,
-  0x98, 0x39, 0xa4, 0xc4, 0x25, 0x5c, 0xab, 0x1b, 0x26, 0x83, 0x03, 0x6f,
-  0x92, 0x13, 0x56, 0x0a, 0x5c, 0xe8, 0x29, 0xd5, 0xc0, 0x2d, 0xc0, 0x13,
-  0xd2, 0x12, 0x0c, 0xe1, 0x0e, 0x2d, 0x62, 0xb0, 0xda, 0x00, 0x1b, 0x34,
-  0x10, 0x24, 0xb4, 0x04, 0x42, 0x47, 0xcb, 0xb1, 0xfc, 0x24, 0xf4, 0x83,
-  0x7d, 0x1a, 0xb0, 0x5d, 0x0a, 0xba, 0x8d, 0x2c, 0x5f, 0x7a, 0x64, 0x91,
-  0x85, 0x86, 0xe0, 0xe8, 0x5c, 0xe8, 0x10, 0x27, 0x97, 0x2f, 0x02, 0x7c,
-  0x8c, 0x40, 0xfe, 0x22, 0xf2, 0x23, 0x96, 0xe7, 0x74, 0x85, 0x70, 0x62,
-  0xd0, 0x1d, 0xe8, 0x77, 0xd7, 0x83, 0xb9, 0xf2, 0x40, 0x6c, 0x37, 0x3a,
-  0x42, 0x0f, 0x11, 0x6c, 0x56, 0xf0, 0x5d, 0xe7, 0xe2, 0xa4, 0x12, 0x9b,
-  0xe4, 0x05, 0x25, 0x1b, 0x2f, 0x3f, 0x64, 0x0e, 0xea, 0x8b, 0x41, 0x5c,
-  0x60, 0x51, 0x2f, 0x46, 0xbe, 0x2c, 0x14, 0x06, 0x35, 0x59, 0x33, 0x65,
-  0xf4, 0x90, 0xf6, 0x19, 0x39, 0x65, 0x37, 0x96, 0xf0, 0xf2, 0x0b, 0x08,
-  0x2c, 0x07, 0x2b, 0x34, 0x0e, 0x03, 0xc8, 0x68, 0x62, 0xc9, 0xa5, 0xbf,
-  0xe2, 0x02, 0x59, 0x59, 0x13, 0x33, 0xd4, 0x38, 0xff, 0x48, 0x18, 0x42,
-  0xc3, 0xfe, 0xc9, 0x87, 0x01, 0x74, 0x7e, 0x6f, 0x67, 0xfe, 0xfe, 0x83,
-  0x93, 0xbd, 0xc2, 0x5c, 0x01, 0x34, 0x84, 0x04, 0xf0, 0xed, 0x05, 0xdd,
-  0x44, 0xeb, 0x7f, 0x90, 0x97, 0x85, 0x81, 0x13, 0x8e, 0x41, 0x91, 0xa8,
-  0x66, 0x10, 0xcb, 0xe2, 0x23, 0x13, 0x23, 0x05, 0x90, 0xf0, 0xe3, 0x68,
-  0x20, 0x67, 0x70, 0x3c, 0x60, 0x5b, 0xce, 0xe8, 0xc4, 0x6b, 0x2a, 0x24,
-  0x2f, 0x06, 0x13, 0x4b, 0xcd, 0x11, 0xe6, 0xe8, 0xd9, 0x9b, 0xe6, 0xcb,
-  0x62, 0x10, 0x04, 0x38, 0x2a, 0x95, 0x57, 0x43, 0x89, 0x6d, 0xea, 0x01,
-  0xf6, 0x66, 0xb0, 0x0e, 0xba, 0x57, 0x1a, 0x30, 0x22, 0x3c, 0x49, 0x06,
-  0xb2, 0x72, 0xcc, 0xc7, 0x2b, 0x18, 0x00, 0x42, 0x0c, 0x1e, 0x7a, 0x00,
-  0x4b, 0x97, 0x74, 0xf1, 0xfd, 0x65, 0x4f, 0xd8, 0x4e, 0xfd, 0x0a, 0xdc,
-  0x2f, 0x8b, 0x91, 0xa1, 0xaf, 0x21, 0x6c, 0x16, 0x60, 0xcb, 0x57, 0x42,
-  0xb1, 0x42, 0xd9, 0x16, 0x64, 0x96, 0x7f, 0x84, 0xb3, 0xc4, 0x27, 0xa6,
-  0xa6, 0x4a, 0x06, 0xb1, 0x63, 0xbb, 0x07, 0x0b, 0x46, 0xfd, 0x59, 0x45,
-  0x4a, 0x0c, 0x4b, 0xd0, 0x7e, 0x2c, 0x36, 0xe9, 0xb2, 0x4f, 0x09, 0x90,
-  0x45, 0x29, 0xf2, 0x03, 0xe8, 0x76, 0x68, 0x1c, 0x64, 0xb9, 0x8d, 0x5e,
-  0xf2, 0x6e, 0x56, 0x0c, 0x08, 0x84, 0xbd, 0x98, 0x64, 0x03, 0x2f, 0x11,
-  0x59, 0x04, 0x47, 0x17, 0x9c, 0xfc, 0x53, 0x4e, 0xad, 0x91, 0x91, 0x12,
-  0x92, 0x12, 0x39, 0x71, 0x73, 0x12, 0x5e, 0xe6, 0xf3, 0x55, 0x96, 0xfa,
-  0xf8, 0x43, 0xeb, 0x43, 0xb0, 0x00, 0x93, 0x29, 0x08, 0x2c, 0x2e, 0x15,
-  0xff, 0x06, 0x8a, 0x04, 0x88, 0x05, 0x8a, 0x44, 0x15, 0x8e, 0x88, 0x54,
-  0xdb, 0x74, 0x1b, 0x02, 0x19, 0x2c, 0x13, 0xbe, 0x11, 0xe8, 0x80, 0xe4,
-  0xb9, 0x62, 0x02, 0xd3, 0xb6, 0x1a, 0x02, 0x5b, 0x04, 0x20, 0x65, 0x21,
-  0x96, 0x05, 0x27, 0x59, 0x25, 0x65, 0x1f, 0xe4, 0x1d, 0xe8, 0x5f, 0xc1,
-  0xd2, 0xc1, 0x2b, 0xd0, 0x29, 0x62, 0xcd, 0xd9, 0x0b, 0x2f, 0x65, 0x2d,
-  0x96, 0x0c, 0x0e, 0x00, 0x10, 0x81, 0x84, 0x24, 0xd9, 0xf0, 0xc7, 0x41,
-  0x1e, 0xa2, 0x16, 0x3f, 0xf9, 0xec, 0xc7, 0xad, 0x45, 0x6e, 0x11, 0x0e,
-  0xc2, 0xd6, 0x05, 0x36, 0x48, 0x43, 0x19, 0x11, 0xfc, 0xbe, 0xc7, 0x84,
-  0x0e, 0x43, 0xe9, 0xd8, 0x10, 0x05, 0xc8, 0x12, 0xc8, 0x14, 0xc8, 0x16,
-  0xc8, 0x18, 0xb8, 0x44, 0x46, 0x31, 0xcf, 0x1e, 0x20, 0x3c, 0x22, 0xf3,
-  0x24, 0xcf, 0x1c, 0x26, 0x3c, 0x28, 0x95, 0xa4, 0x09, 0xf8, 0xe8, 0x5b,
-  0x6e, 0x8c, 0x32, 0x38, 0x1b, 0xb9, 0x21, 0x94, 0x23, 0xe5, 0x49, 0x06,
-  0x9c, 0x37, 0x1d, 0xd7, 0x17, 0xc1, 0x7c, 0xbc, 0x17, 0xb1, 0xc9, 0x14,
-  0x08, 0xd7, 0x38, 0x8c, 0x6d, 0x8b, 0x94, 0x96, 0x18, 0xe4, 0x22, 0x8b,
-  0xfa, 0xfe, 0xb1, 0x0b, 0xe8, 0xb2, 0x7a, 0x5d, 0xf2, 0x1c, 0x03, 0x1c,
-  0x0d, 0xe5, 0x96, 0x56, 0x4c, 0xdc, 0x69, 0x5c, 0x04, 0x08, 0xbc, 0x22,
-  0x9f, 0x6c, 0xe8, 0x69, 0xb6, 0x7d, 0x1a, 0xec, 0x5a, 0xee, 0x24, 0xcc,
-  0x51, 0x2f, 0xa4, 0x7c, 0x13, 0x7f, 0x20, 0x87, 0xd5, 0x49, 0x1e, 0xb3,
-  0x0b, 0x5b, 0xb6, 0xfd, 0x50, 0xad, 0xe6, 0x23, 0xf3, 0xf6, 0x7f, 0x13,
-  0x75, 0x64, 0xf4, 0x77, 0x24, 0x70, 0x9c, 0x36, 0x1c, 0xf6, 0x58, 0xf4,
-  0xa4, 0xdd, 0xaf, 0x03, 0x7d, 0x25, 0xee, 0xf6, 0x7c, 0x99, 0x9f, 0x39,
-  0xb8, 0x1d, 0x73, 0xd7, 0x3a, 0x58, 0x37, 0x37, 0x8b, 0x85, 0xfb, 0xec,
-  0xe8, 0xd7, 0x7c, 0x11, 0x40, 0xb2, 0x2f, 0x56, 0x86, 0x41, 0x86, 0x3b,
-  0x3f, 0xf9, 0x7f, 0x78, 0x83, 0xbc, 0x1c, 0x7b, 0x7e, 0x71, 0x8b, 0x0c,
-  0xa1, 0x40, 0xd0, 0x42, 0x21, 0xa9, 0x94, 0xc2, 0x44, 0x12, 0x12, 0x54,
-  0x9c, 0xbd, 0x6c, 0x8c, 0x4b, 0x2c, 0x55, 0x8b, 0xc1, 0x5d, 0xe6, 0x89,
-  0x64, 0x39, 0x61, 0x5a, 0x82, 0x6a, 0x53, 0x83, 0x7e, 0x39, 0x4f, 0x39,
-  0xed, 0x71, 0x7e, 0x96, 0xec, 0x81, 0x1e, 0xc7, 0xcf, 0x02, 0x7e, 0x56,
-  0x68, 0x7e, 0x22, 0xcb, 0x14, 0x63, 0x6d, 0x2e, 0x36, 0xe2, 0x71, 0x14,
-  0x60, 0x2c, 0x80, 0x20, 0xc3, 0x0b, 0x6f, 0x50, 0x1f, 0x56, 0xd7, 0x03,
-  0x3b, 0x38, 0x19, 0x7e, 0x92, 0x35, 0x03, 0x04, 0xe4, 0x01, 0xde, 0x16,
-  0x03, 0x06, 0x2b, 0x61, 0x4c, 0xc2, 0x03, 0x58, 0xca, 0x13, 0xa9, 0x5d,
-  0x10, 0x06, 0x78, 0xae, 0xe9, 0x60, 0x92, 0x34, 0xfe, 0x1b, 0x73, 0x87,
-  0x6d, 0x95, 0x80, 0x5d, 0x77, 0x90, 0x80, 0x49, 0x43, 0x6e, 0x78, 0x7d,
-  0x04, 0x70, 0x23, 0x61, 0x9a, 0x73, 0x4f, 0xc9, 0x51, 0x68, 0xf8, 0xd2,
-  0x49, 0x8b, 0x61, 0x7e, 0x28, 0x7f, 0x08, 0x81, 0xb8, 0xdf, 0x55, 0xff,
-  0x03, 0x76, 0x1e, 0x47, 0xf5, 0x81, 0x9a, 0x57, 0xa0, 0xfb, 0x4b, 0x17,
-  0x59, 0x50, 0x29, 0x01, 0x74, 0x56, 0x2c, 0x84, 0x20, 0x90, 0x5c, 0x54,
-  0x7d, 0x75, 0x2b, 0xb6, 0x1f, 0x1b, 0x25, 0xd8, 0x52, 0x3a, 0x4a, 0xba,
-  0xce, 0x57, 0x68, 0x59, 0x10, 0xd8, 0x7d, 0xe8, 0xff, 0xa2, 0x59, 0x9a,
-  0x5b, 0xb2, 0xf0, 0xb0, 0x5f, 0xe0, 0x9c, 0x6a, 0x19, 0x70, 0x1d, 0x70,
-  0xd6, 0x46, 0x2f, 0x40, 0x09, 0x8b, 0x01, 0x81, 0x7f, 0x90, 0x6c, 0x5f,
-  0x21, 0x90, 0x30, 0xf7, 0x42, 0x51, 0xd4, 0xb6, 0xa0, 0x05, 0x32, 0x13,
-  0x8b, 0x0e, 0x89, 0x03, 0x9f, 0x59, 0xb2, 0x1d, 0x5a, 0x4e, 0x01, 0x0e,
-  0x25, 0x7a, 0x3b, 0x92, 0xc9, 0xb7, 0x16, 0xa9, 0xcb, 0x2b, 0x64, 0x58,
-  0x33, 0x49, 0x49, 0x47, 0x4c, 0x66, 0xea, 0xe0, 0xca, 0x95, 0x9c, 0xa9,
-  0x92, 0x2b, 0x7a, 0x1c, 0x92, 0x94, 0x96, 0x64, 0x13, 0x88, 0xa8, 0x3d,
-  0xd9, 0xb3, 0x3b, 0xff, 0x2b, 0x47, 0x11, 0x1b, 0x4f, 0x13, 0x4d, 0x63,
-  0x50, 0x49, 0x64, 0x22, 0xab, 0xff, 0x69, 0x79, 0x65, 0x01, 0xc2, 0x90,
-  0x79, 0x53, 0x52, 0xa5, 0xa4, 0x57, 0xe9, 0xb0, 0xb7, 0xb9, 0x59, 0x82,
-  0x8d, 0xc2, 0x03, 0xa6, 0xc9, 0x13, 0x5a, 0x99, 0xba, 0x5e, 0xfa, 0x9c,
-  0x7e, 0x3c, 0x68, 0x33, 0x8c, 0x4b, 0x20, 0x69, 0x70, 0x48, 0x90, 0x6a,
-  0xa4, 0x03, 0x06, 0x48, 0x10, 0x5f, 0x2e, 0x48, 0x10, 0x60, 0x86, 0x48,
-  0x10, 0x61, 0x86, 0x48, 0x32, 0xed, 0x15, 0x74, 0x30, 0x90, 0x21, 0x50,
-  0x30, 0x48, 0x91, 0x51, 0x30, 0x48, 0x81, 0x52, 0x72, 0x48, 0x4b, 0x95,
-  0x9c, 0x9e, 0x10, 0x52, 0xa7, 0x4a, 0x78, 0x20, 0x3b, 0x3d, 0x78, 0x53,
-  0x30, 0x81, 0x53, 0x6c, 0xa9, 0x39, 0xf2, 0x67, 0xf0, 0x0d, 0x3c, 0x90,
-  0x2e, 0xc7, 0x44, 0x0c, 0x6a, 0x91, 0x62, 0x37, 0x05, 0xbc, 0x90, 0x18,
-  0x04, 0x12, 0x9b, 0xf0, 0x94, 0xfa, 0x00, 0x26, 0x47, 0x04, 0xbc, 0x9c,
-  0xf5, 0x74, 0xd9, 0x35, 0x17, 0xe5, 0xf0, 0x90, 0xf2, 0x07, 0xac, 0x77,
-  0x6c, 0x1a, 0xe8, 0xad, 0x74, 0x45, 0xb7, 0xc8, 0x0b, 0x44, 0x7a, 0x75,
-  0x06, 0xb8, 0x63, 0x97, 0x5b, 0x7c, 0x02, 0x05, 0x2c, 0x49, 0x63, 0x9d,
-  0x1b, 0x43, 0x96, 0x20, 0xcb, 0xbe, 0x75, 0x5b, 0xfe, 0x4d, 0xdf, 0xeb,
-  0x80, 0x09, 0x44, 0x1d, 0x15, 0x28, 0x38, 0xba, 0xd7, 0x63, 0x0a, 0x36,
-  0x9a, 0xc5, 0x93, 0xb0, 0x06, 0x01, 0xc9, 0xf6, 0xce, 0xf4, 0x0f, 0x13,
-  0x42, 0x09, 0x6c, 0x0b, 0xc1, 0x87, 0x01, 0xf2, 0x27, 0xf0, 0xb0, 0x77,
-  0x23, 0x91, 0x41, 0xb3, 0x0e, 0x05, 0xa9, 0x2c, 0x6d, 0x1e, 0x92, 0x99,
-  0xfe, 0x4d, 0x8e, 0x14, 0x50, 0xd2, 0x59, 0x01, 0x7d, 0x83, 0x6e, 0xf0,
-  0xb5, 0xbe, 0x5e, 0x2b, 0xa5, 0x29, 0x19, 0x41, 0xf0, 0x74, 0x3b, 0x63,
-  0x37, 0xf2, 0x2c, 0xf0, 0x80, 0x39, 0xcb, 0x76, 0x01, 0xcd, 0xbe, 0x76,
-  0x01, 0x9b, 0x74, 0x80, 0x17, 0x26, 0x05, 0x27, 0x9b, 0x00, 0xfe, 0x00,
-  0x2c, 0xf0, 0xb2, 0xf2, 0x18, 0x9d, 0x01, 0x9c, 0x51, 0x8b, 0x30, 0x1a,
-  0x5e, 0x20, 0xe8, 0x85, 0x76, 0x0c, 0xe3, 0x3a, 0xfc, 0x04, 0xdc, 0x07,
-  0x8b, 0xfa, 0xc0, 0xc7, 0x05, 0x5e, 0x08, 0x2e, 0x76, 0x61, 0x49, 0x8b,
-  0x4b, 0x65, 0x11, 0xb0, 0x13, 0xbc, 0xd5, 0x6f, 0x6d, 0x45, 0x15, 0x01,
-  0x33, 0x06, 0x5a, 0x29, 0xd9, 0x04, 0x17, 0xf3, 0x19, 0x01, 0x5e, 0x1b,
-  0x38, 0x0f, 0xfb, 0x6c, 0x30, 0x1d, 0xb1, 0x1f, 0x9b, 0x8f, 0x0b, 0x65,
-  0x21, 0x8c, 0x23, 0x7d, 0xdb, 0x0b, 0x25, 0x2d, 0x27, 0x5b, 0xd7, 0x1f,
-  0x02, 0x4f, 0xfe, 0x1c, 0x7f, 0x07, 0x81, 0x7d, 0x1d, 0x06, 0x4e, 0x91,
-  0x13, 0x9f, 0x0d, 0xfc, 0x11, 0x0c, 0xd5, 0xf6, 0x78, 0x21, 0xcb, 0x13,
-  0x32, 0xdb, 0x7f, 0x06, 0x07, 0x11, 0xd4, 0x00, 0x76, 0xb6, 0x74, 0x4d,
-  0x7b, 0xe1, 0x5d, 0x11, 0x02, 0x09, 0xc8, 0xc8, 0x75, 0x0e, 0xbb, 0x75,
-  0xd1, 0x32, 0x77, 0xfb, 0x2b, 0xeb, 0x0c, 0x61, 0x65, 0xdb, 0x29, 0xae,
-  0x2b, 0x24, 0xc0, 0x12, 0xb2, 0x74, 0xee, 0xc9, 0xec, 0xb5, 0xf0, 0xae,
-  0xf3, 0x0e, 0x62, 0x11, 0xd9, 0x27, 0x2d, 0x6d, 0x2f, 0x78, 0xb4, 0xee,
-  0x02, 0x4b, 0x60, 0x8f, 0x8e, 0x9d, 0x52, 0xdb, 0x45, 0x31, 0x13, 0x33,
-  0x18, 0x9c, 0x0a, 0x65, 0x5e, 0x18, 0xb5, 0xb8, 0x75, 0x25, 0xc6, 0x80,
-  0x64, 0x1e, 0x49, 0x0f, 0x1b, 0x51, 0x34, 0x49, 0x06, 0x80, 0xcd, 0x8d,
-  0x06, 0xfd, 0x6e, 0x2e, 0x52, 0x1b, 0x48, 0xc2, 0xe2, 0xda, 0xec, 0x92,
-  0xe0, 0x63, 0x2c, 0x08, 0xbb, 0x68, 0x7f, 0x22, 0x12, 0xc4, 0x85, 0x47,
-  0xe5, 0x9a, 0x6a, 0x60, 0x28, 0x74, 0x3b, 0x0f, 0x2c, 0x3d, 0x2b, 0x15,
-  0x03, 0x91, 0x3f, 0x92, 0x41, 0x19, 0x43, 0x19, 0x45, 0x21, 0x91, 0x47,
-  0x92, 0x49, 0x19, 0x4b, 0x19, 0x4d, 0x21, 0x91, 0x4f, 0x92, 0x51, 0x19,
-  0x53, 0x19, 0x55, 0x21, 0x91, 0x57, 0x92, 0x59, 0x19, 0x5b, 0x19, 0x5d,
-  0x83, 0x3c, 0x01, 0x31, 0xf6, 0x73, 0x04, 0x1e, 0x4a, 0xd9, 0x6a, 0x80,
-  0xa5, 0x90, 0x04, 0x70, 0x49, 0x10, 0x1b, 0x0d, 0x80, 0x28, 0xcd, 0x60,
-  0x5e, 0x25, 0x33, 0x5e, 0xc8, 0x60, 0x4c, 0x64, 0xd2, 0x62, 0x53, 0x62,
-  0x3c, 0x64, 0x84, 0xcd, 0x68, 0x66, 0x25, 0x33, 0x66, 0xc8, 0x68, 0x4c,
-  0x6c, 0xd2, 0x6a, 0x53, 0x6a, 0x3c, 0x6c, 0x84, 0xcd, 0x70, 0x6e, 0x25,
-  0x33, 0x6e, 0xc8, 0x70, 0x4c, 0x74, 0xd2, 0x72, 0x53, 0x72, 0x3c, 0x74,
-  0x84, 0xcd, 0x78, 0x76, 0x25, 0x22, 0x93, 0x7e, 0x57, 0x3b, 0xc1, 0xc7,
-  0x97, 0xb5, 0x2c, 0x40, 0xc2, 0x42, 0xc2, 0x8a, 0x59, 0x1c, 0x8c, 0x4c,
-  0xb7, 0x1e, 0x8c, 0x5c, 0x27, 0x3d, 0x68, 0x05, 0x4c, 0xd1, 0x2c, 0x09,
-  0xae, 0xc7, 0x84, 0xac, 0xad, 0x81, 0x26, 0xcd, 0x41, 0x3f, 0x24, 0x33,
-  0x3f, 0xc8, 0x41, 0x4c, 0x45, 0xd2, 0x43, 0x43, 0x43, 0x3c, 0x45, 0x84,
-  0xcd, 0x49, 0x47, 0x24, 0x33, 0x47, 0xc8, 0x49, 0x4c, 0x4d, 0xd2, 0x4b,
-  0x43, 0x4b, 0x3c, 0x4d, 0x84, 0xcd, 0x51, 0x4f, 0x24, 0x33, 0x4f, 0xce,
-  0x51, 0x83, 0xea, 0x0b, 0x50, 0x81, 0x01, 0x31, 0xc7, 0x64, 0x09, 0x6a,
-  0x10, 0x08, 0x0d, 0x81, 0x26, 0xcd, 0x5d, 0x5b, 0x24, 0x33, 0x5b, 0xc8,
-  0x5d, 0x48, 0xb4, 0x0f, 0x21, 0xa1, 0x39, 0x4b, 0x06, 0xd2, 0x09, 0x47,
-  0xc7, 0x48, 0x07, 0x03, 0xc7, 0x92, 0x40, 0x9a, 0xc7, 0x40, 0x05, 0x1c,
-  0xc7, 0x40, 0x94, 0xd2, 0xc7, 0x03, 0x00, 0xe4, 0xc7, 0x40, 0xa6, 0xc7,
-  0x90, 0x01, 0x07, 0xc7, 0x40, 0x25, 0x28, 0x12, 0x3c, 0xb7, 0x26, 0x8c,
-  0xff, 0x8d, 0x02, 0x48, 0x56, 0xf1, 0x26, 0x91, 0xfd, 0xa0, 0xca, 0x71,
-  0xde, 0x26, 0x32, 0xfb, 0x34, 0x19, 0x78, 0x5a, 0x8c, 0x7b, 0x27, 0x7e,
-  0x0d, 0x56, 0xd5, 0x28, 0x4f, 0x81, 0xeb, 0x0b, 0x64, 0x0c, 0xc5, 0x00,
-  0x74, 0xf6, 0x16, 0xbe, 0xd8, 0xfc, 0xff, 0x8c, 0xa5, 0x33, 0x42, 0xb2,
-  0xb4, 0x03, 0x43, 0x11, 0x60, 0xa2, 0x01, 0x2e, 0x31, 0x02, 0x79, 0x12,
-  0xf0, 0x0e, 0x25, 0x5f, 0x6a, 0x32, 0xa1, 0x8d, 0xf2, 0x14, 0x45, 0x58,
-  0x12, 0x5c, 0x18, 0xc7, 0x10, 0x5b, 0x0e, 0xc7, 0x04, 0x5a, 0x03, 0x81,
-  0xc7, 0x59, 0x00, 0xe0, 0xc7, 0x40, 0x58, 0x38, 0xc7, 0x10, 0x57, 0x05,
-  0xaa, 0xef, 0xcd, 0x09, 0x9b, 0x09, 0xf8, 0xd8, 0x7c, 0x5b, 0x0e, 0x0b,
-  0xa3, 0x5a, 0x61, 0x19, 0x5c, 0xd1, 0x25, 0xa1, 0x1b, 0x14, 0xe4, 0x64,
-  0x2e, 0x66, 0x46, 0x68, 0x42, 0xe4, 0x6a, 0x64, 0x6c, 0x2e, 0x6e, 0x46,
-  0x70, 0x42, 0xe4, 0x72, 0x64, 0x74, 0x2e, 0x76, 0x46, 0x78, 0x13, 0xaf,
-  0x9b, 0x18, 0x60, 0xfe, 0x12, 0x84, 0x02, 0x25, 0x3b, 0x92, 0x5d, 0x24,
-  0x01, 0xf6, 0xc6, 0x13, 0x0f, 0x13, 0x0f, 0x0d, 0xe5, 0x80, 0x82, 0x00,
-  0xc2, 0xaf, 0x06, 0x1c, 0x0b, 0xb5, 0x20, 0xe0, 0x26, 0xb2, 0xa9, 0x6d,
-  0xc6, 0x7d, 0x4a, 0xe7, 0x2d, 0x72, 0x82, 0x5d, 0xca, 0x9f, 0x5b, 0x19,
-  0x49, 0x96, 0x06, 0xa1, 0x70, 0x5f, 0x95, 0xd0, 0x7b, 0x15, 0x96, 0x30,
-  0x52, 0x0c, 0x5d, 0x81, 0xec, 0x1f, 0xd8, 0xc4, 0x4f, 0x46, 0x26, 0x26,
-  0x8f, 0x9a, 0x47, 0x9f, 0x38, 0xe3, 0x50, 0xa8, 0x74, 0xe1, 0xf0, 0x09,
-  0x76, 0x6a, 0xa4, 0xc3, 0x6f, 0xf4, 0x04, 0x9e, 0xee, 0xf0, 0x79, 0xea,
-  0xe7, 0xec, 0x9e, 0xe6, 0xe8, 0x79, 0xe2, 0xef, 0xe4, 0xaa, 0x7f, 0x9a,
-  0x8d, 0x46, 0xda, 0xa9, 0x03, 0x71, 0x60, 0x3f, 0xa7, 0x6e, 0x80, 0xef,
-  0x9d, 0x25, 0x47, 0x20, 0xb0, 0x18, 0x75, 0x8b, 0x07, 0x20, 0x00, 0x76,
-  0x36, 0x18, 0x06, 0x2a, 0xf6, 0x22, 0x0e, 0x33, 0xdc, 0xb3, 0x1a, 0x97,
-  0x56, 0xda, 0x89, 0xb0, 0x07, 0x17, 0x16, 0x24, 0xb6, 0x0e, 0xff, 0x02,
-  0xbf, 0xbf, 0x03, 0x7c, 0xb1, 0xa8, 0x64, 0x92, 0x9d, 0x85, 0x15, 0xcc,
-  0xe3, 0x40, 0xb6, 0x1b, 0x13, 0x74, 0xb0, 0x72, 0x34, 0x06, 0x8b, 0x08,
-  0x5d, 0xb2, 0x50, 0x2f, 0x9c, 0x31, 0x4e, 0xbb, 0xd9, 0x50, 0x19, 0x55,
-  0x97, 0x64, 0x3b, 0xf5, 0x50, 0x31, 0x7c, 0x3d, 0x37, 0x92, 0x40, 0x2f,
-  0x76, 0x65, 0xbc, 0x16, 0x3b, 0x6e, 0x4d, 0xff, 0x01, 0x67, 0xa0, 0x3f,
-  0xb5, 0xff, 0xc2, 0x4b, 0xf9, 0xfe, 0x2c, 0x1b, 0x3b, 0x40, 0xc2, 0x2b,
-  0xed, 0x7e, 0x03, 0x89, 0x1d, 0x61, 0x1a, 0x58, 0xa2, 0x46, 0x74, 0xbe,
-  0xf5, 0x41, 0x2b, 0x90, 0x6d, 0x6c, 0xfe, 0x27, 0xae, 0x31, 0x8d, 0xd6,
-  0x9b, 0x2f, 0x78, 0x2f, 0x2d, 0x27, 0xec, 0x20, 0xf1, 0x09, 0x52, 0xb2,
-  0x1d, 0xee, 0x5d, 0xe2, 0xeb, 0x84, 0x0a, 0xf4, 0xb6, 0x57, 0x36, 0x66,
-  0x36, 0xc9, 0xfc, 0x58, 0x23, 0x0b, 0xbe, 0x3b, 0x44, 0x02, 0x77, 0x48,
-  0x8a, 0xb7, 0xbb, 0x14, 0x77, 0xb2, 0x42, 0x23, 0xb8, 0x54, 0x83, 0x60,
-  0x7f, 0x87, 0xd8, 0x2b, 0x40, 0x3b, 0x1b, 0xd1, 0x50, 0x3d, 0x62, 0x7f,
-  0xae, 0x9a, 0x00, 0xa8, 0x5a, 0x8e, 0x13, 0xf4, 0x7f, 0x12, 0x7c, 0x06,
-  0x43, 0x52, 0x63, 0x73, 0x0a, 0x6a, 0x2d, 0x9a, 0x6b, 0x01, 0xe2, 0xbb,
-  0x7c, 0x60, 0x8b, 0x48, 0x58, 0x68, 0x48, 0x01, 0xc1, 0x10, 0x4a, 0x17,
-  0x14, 0x4a, 0x18, 0xcb, 0x76, 0x3b, 0xb8, 0xf8, 0x58, 0x7f, 0x37, 0x7c,
-  0x7d, 0x8e, 0x73, 0x30, 0x96, 0x17, 0xcd, 0xcf, 0xd0, 0x28, 0xda, 0x92,
-  0xb8, 0xeb, 0x82, 0x5a, 0x83, 0xb0, 0x05, 0xfe, 0xb1, 0x68, 0xd2, 0xd5,
-  0xe7, 0xea, 0x33, 0x90, 0x6b, 0x26, 0x02, 0x79, 0xdc, 0x08, 0x64, 0xde,
-  0x21, 0x92, 0xde, 0x39, 0xdc, 0x08, 0xe5, 0xe6, 0x92, 0xe8, 0x73, 0x03,
-  0x75, 0x48, 0xde, 0x43, 0xe0, 0x21, 0x0c, 0xe0, 0x91, 0xc8, 0xde, 0x47,
-  0xe2, 0x2c, 0xe4, 0xe3, 0xf4, 0xb1, 0xc3, 0x01, 0x12, 0x3a, 0x43, 0x01,
-  0x26, 0xd5, 0x3f, 0xa1, 0xc6, 0xe5, 0x80, 0x76, 0xe4, 0x84, 0xfc, 0x22,
-  0x40, 0x6c, 0xc6, 0x1b, 0x50, 0xab, 0x59, 0x66, 0x0a, 0xc1, 0x0c, 0x01,
-  0x20, 0x23, 0xc2, 0x3b, 0xb2, 0xf0, 0x77, 0x49, 0x72, 0x1b, 0x7b, 0xf2,
-  0xdb, 0x73, 0x42, 0x54, 0xf4, 0x2c, 0xf2, 0x86, 0x30, 0x2d, 0xa5, 0x9b,
-  0xec, 0x26, 0x66, 0xfe, 0x68, 0x71, 0x2b, 0x82, 0xd9, 0x55, 0x5f, 0xec,
-  0x77, 0x51, 0x3f, 0xea, 0x73, 0x4a, 0x2c, 0xec, 0xb2, 0xea, 0x48, 0xf6,
-  0x11, 0x4c, 0x15, 0x84, 0xc3, 0xd9, 0xb3, 0x53, 0xe8, 0x67, 0x5d, 0xe6,
-  0x3c, 0xe8, 0xb2, 0xe6, 0x5c, 0xdc, 0x91, 0x32, 0xde, 0x01, 0x3c, 0xe4,
-  0x77, 0x71, 0xfc, 0xe2, 0x73, 0x6a, 0xb2, 0xe4, 0xc9, 0xe2, 0x72, 0xde,
-  0x44, 0xc8, 0xe0, 0x03, 0xeb, 0x84, 0x1e, 0x20, 0x10, 0x95, 0xa9, 0x84,
-  0x39, 0x27, 0x83, 0xbc, 0x28, 0xa8, 0xf6, 0x19, 0x08, 0xcd, 0xfa, 0x0c,
-  0x14, 0x20, 0x4b, 0x20, 0xac, 0xfa, 0x1d, 0x13, 0x03, 0x12, 0x29, 0x05,
-  0x22, 0xc6, 0xb1, 0x7f, 0x58, 0x93, 0x2c, 0xbc, 0x56, 0x9c, 0x88, 0x6e,
-  0x92, 0x83, 0x7f, 0x02, 0xe5, 0x47, 0x0c, 0x61, 0x84, 0x04, 0x2d, 0x7a,
-  0x80, 0x92, 0xcb, 0x24, 0x10, 0xb3, 0x55, 0x47, 0x0b, 0x9c, 0x75, 0x0b,
-  0xd2, 0xd6, 0xec, 0x8f, 0x59, 0xc5, 0x08, 0xd6, 0xe6, 0x77, 0x09, 0xec,
-  0x85, 0x00, 0x37, 0xad, 0x98, 0xf8, 0x03, 0xb5, 0xd4, 0x85, 0xa7, 0x84,
-  0x2f, 0xf4, 0x5b, 0x59, 0x17, 0xd2, 0x68, 0x89, 0x8c, 0x96, 0x5c, 0x9c,
-  0xd6, 0xc7, 0x24, 0x10, 0x85, 0x16, 0x95, 0x1e, 0xcc, 0xda, 0x5d, 0x23,
-  0x6c, 0x1f, 0x22, 0xd3, 0x24, 0xdc, 0x89, 0xef, 0x84, 0xac, 0x1d, 0x27,
-  0xff, 0x0b, 0xa8, 0x2c, 0x34, 0x62, 0x28, 0xcb, 0xa5, 0xda, 0x93, 0x94,
-  0xfc, 0x57, 0x11, 0x1b, 0x47, 0x13, 0x3b, 0x33, 0x33, 0xb9, 0xa5, 0xb5,
-  0xd1, 0x09, 0x3b, 0x2b, 0xd7, 0xba, 0xb6, 0xaa, 0x00, 0x25, 0x56, 0xc3,
-  0x5c, 0x9a, 0x18, 0x1a, 0xc6, 0x17, 0x8b, 0xdb, 0x14, 0x8b, 0x1a, 0x59,
-  0x8e, 0x2c, 0x31, 0x1d, 0xeb, 0x5a, 0xb3, 0x61, 0x72, 0x49, 0x70, 0x0e,
-  0x7c, 0x56, 0x05, 0xa2, 0x7e, 0x5e, 0x76, 0x4e, 0xca, 0x1f, 0xd8, 0x5b,
-  0x92, 0x25, 0x9b, 0x31, 0xe0, 0x0b, 0x09, 0xcd, 0xae, 0x75, 0x16, 0x15,
-  0xb4, 0xb2, 0x17, 0x10, 0x84, 0x2f, 0x85, 0xfd, 0x48, 0x3b, 0x47, 0x1f,
-  0x56, 0xbb, 0x81, 0x7b, 0x7f, 0x7c, 0x08, 0x3b, 0x57, 0x1d, 0x72, 0x68,
-  0x09, 0x95, 0xe1, 0x9c, 0x5e, 0x1f, 0xb5, 0x1d, 0x96, 0x9a, 0xcc, 0x39,
-  0x4f, 0x01, 0x2b, 0x75, 0x37, 0x1b, 0xc1, 0x3f, 0x14, 0x06, 0xbb, 0x4b,
-  0xb0, 0xb0, 0x39, 0x17, 0x32, 0x8c, 0x00, 0xad, 0xae, 0x94, 0xc0, 0xde,
-  0x94, 0x1a, 0x89, 0x12, 0xb9, 0x2d, 0x92, 0x47, 0xc3, 0xca, 0x70, 0x31,
-  0x47, 0xac, 0xeb, 0x4c, 0x64, 0x9d, 0x61, 0x24, 0x2c, 0x24, 0x1e, 0x0b,
-  0x33, 0x21, 0x61, 0x55, 0x88, 0x4c, 0x1f, 0x11, 0x2f, 0x6d, 0x4b, 0x83,
-  0xfb, 0xe8, 0x0a, 0x77, 0x16, 0x8b, 0x3c, 0xfd, 0x98, 0x76, 0xb8, 0x0c,
-  0x4b, 0xce, 0x0d, 0xdb, 0xb8, 0x0e, 0x04, 0x08, 0xcb, 0xb8, 0x0f, 0x03,
-  0x43, 0x4c, 0x21, 0x31, 0x7b, 0x89, 0x76, 0x93, 0x01, 0x9b, 0x05, 0x8e,
-  0xb3, 0x76, 0x09, 0x7e, 0x01, 0x84, 0x76, 0xa9, 0xe3, 0xd1, 0x84, 0x20,
-  0xf0, 0xe8, 0xa3, 0xf6, 0x56, 0x76, 0x01, 0xa8, 0xcd, 0x13, 0x00, 0x87,
-  0x2c, 0x4f, 0x99, 0x8b, 0x14, 0x9a, 0x42, 0x29, 0xdc, 0x85, 0x22, 0x2b,
-  0x80, 0x3f, 0xfc, 0x75, 0x19, 0x51, 0x3c, 0x45, 0x13, 0x46, 0xab, 0x85,
-  0xbb, 0xd4, 0xff, 0x07, 0x53, 0xfe, 0xe7, 0xff, 0x07, 0x7c, 0x1f, 0x05,
-  0x94, 0x32, 0x06, 0x50, 0xc9, 0x07, 0x42, 0x28, 0x43, 0x80, 0xb7, 0x20,
-  0x2d, 0x22, 0x5f, 0x92, 0x00, 0x25, 0xf6, 0x1f, 0x22, 0x06, 0xd1, 0x08,
-  0x1b, 0x36, 0x1b, 0x6c, 0x26, 0xfa, 0xb3, 0x15, 0xcc, 0xf8, 0xa3, 0x8f,
-  0x0d, 0x43, 0x2a, 0x33, 0x28, 0x93, 0x20, 0x91, 0x19, 0xc8, 0x13, 0x75,
-  0xea, 0x0f, 0x72, 0x2b, 0xdc, 0xb2, 0xff, 0x0f, 0x16, 0x1d, 0x57, 0x57,
-  0xa4, 0x04, 0x5b, 0x2f, 0x47, 0xf5, 0x20, 0x58, 0x13, 0x7c, 0x09, 0x5b,
-  0x39, 0xf3, 0x89, 0x02, 0xfc, 0xff, 0x02, 0x74, 0x20, 0x25, 0x60, 0x4b,
-  0x24, 0x0e, 0x05, 0x40, 0x0e, 0x06, 0x40, 0x0e, 0x07, 0x4a, 0x18, 0x2e,
-  0x42, 0x74, 0x85, 0xd0, 0x32, 0x29, 0x81, 0x79, 0x5b, 0x2d, 0xa1, 0x27,
-  0x7e, 0x08, 0x94, 0x82, 0x14, 0x12, 0x7e, 0xb4, 0x78, 0xac, 0xa1, 0x50,
-  0x0f, 0x56, 0x06, 0x40, 0x7e, 0xcd, 0xeb, 0x13, 0xdb, 0x10, 0x05, 0x3f,
-  0x59, 0x13, 0x6a, 0x98, 0x99, 0x02, 0x45, 0x17, 0xc8, 0xa4, 0x0c, 0x24,
-  0x8c, 0x11, 0x8a, 0xac, 0x0d, 0x41, 0xc0, 0xbf, 0x5d, 0x09, 0x0c, 0xb7,
-  0x05, 0xb1, 0x14, 0xfe, 0xe8, 0x90, 0x5d, 0x25, 0xff, 0x01, 0x0d, 0xd5,
-  0x2c, 0x41, 0xd4, 0x90, 0x04, 0xad, 0x2a, 0x24, 0x10, 0x26, 0xa3, 0x02,
-  0x4f, 0x97, 0xca, 0x5c, 0x01, 0x22, 0x07, 0xc2, 0x14, 0x75, 0xc5, 0x5c,
-  0x41, 0xe8, 0xc0, 0xac, 0x90, 0xc6, 0x18, 0x16, 0x02, 0xc7, 0xa0, 0xe8,
-  0x92, 0x8c, 0x5c, 0x0b, 0xd8, 0x1c, 0x13, 0x85, 0x66, 0x3f, 0xa8, 0xcc,
-  0xbd, 0x65, 0x80, 0xc9, 0x36, 0xc8, 0x06, 0x4f, 0x4f, 0xff, 0x4e, 0x55,
-  0x63, 0xd6, 0x1c, 0x55, 0xb8, 0xbe, 0x46, 0x08, 0x04, 0x62, 0x0c, 0x5b,
-  0xed, 0xca, 0x40, 0x6c, 0xfb, 0x4f, 0x6a, 0x79, 0xaf, 0xda, 0x61, 0x1a,
-  0x2c, 0x2a, 0x8f, 0xe8, 0xaa, 0x66, 0x26, 0x82, 0xca, 0xb3, 0x6f, 0xda,
-  0x18, 0x63, 0x61, 0x1b, 0x2b, 0x51, 0xd9, 0x20, 0x1c, 0x70, 0xe1, 0x5f,
-  0x09, 0x09, 0xac, 0x30, 0x08, 0xf6, 0xea, 0x19, 0x04, 0xf6, 0x03, 0x74,
-  0x14, 0x09, 0xf2, 0x07, 0x7c, 0x05, 0xf2, 0x0a, 0x7e, 0x0a, 0xe6, 0x0d,
-  0x74, 0xed, 0x10, 0x7e, 0x05, 0x49, 0xc1, 0xe9, 0x98, 0xc1, 0x0b, 0x53,
-  0x7b, 0x77, 0x0b, 0x75, 0x62, 0xf4, 0x10, 0x77, 0x54, 0xcf, 0xfb, 0x10,
-  0xe4, 0x72, 0x19, 0x77, 0x76, 0x76, 0x11, 0x1e, 0x03, 0x20, 0x34, 0x04,
-  0x9e, 0x0b, 0x77, 0xc6, 0x10, 0x76, 0x59, 0x06, 0x3a, 0x28, 0xa2, 0x6d,
-  0xfb, 0x04, 0x80, 0x5b, 0x4c, 0x1f, 0x18, 0xb9, 0x4c, 0x11, 0xed, 0xb9,
-  0xb6, 0x0a, 0x06, 0x20, 0x66, 0x2d, 0xc9, 0x0b, 0xc8, 0x21, 0xf9, 0x00,
-  0x02, 0x76, 0x18, 0x09, 0x93, 0x0a, 0x7e, 0x26, 0x8b, 0xc6, 0x09, 0x6c,
-  0x00, 0xd4, 0x0a, 0xd1, 0x00, 0x3a, 0x48, 0x10, 0x02, 0xc0, 0x35, 0x68,
-  0x80, 0x26, 0xc8, 0x01, 0x65, 0x45, 0x32, 0xd7, 0x56, 0xc8, 0x4b, 0xf6,
-  0xeb, 0x11, 0x48, 0x4c, 0xf7, 0xfb, 0x75, 0x0d, 0x3a, 0x18, 0xea, 0xfe,
-  0x45, 0x82, 0xff, 0x59, 0xc1, 0x36, 0x54, 0x5d, 0x93, 0x8a, 0xe0, 0xf4,
-  0xb4, 0x06, 0x85, 0x38, 0x10, 0x4b, 0x01, 0xb9, 0x6e, 0x5f, 0xb2, 0x4f,
-  0xd7, 0x10, 0xfe, 0x7f, 0x32, 0x74, 0x06, 0xe8, 0x05, 0x00, 0xe8, 0xc5,
-  0xeb, 0x00, 0x52, 0x0b, 0x71, 0x1a, 0x03, 0x1d, 0xc1, 0xda, 0x5f, 0x0f,
-  0xe8, 0xf5, 0xe0, 0x06, 0x59, 0x59, 0x9f, 0x58, 0x07, 0x68, 0xc8, 0xf6,
-  0x24, 0xe8, 0x55, 0x34, 0x0d, 0x33, 0x05, 0x4b, 0xca, 0x47, 0x27, 0x06,
-  0x34, 0xcc, 0xb2, 0x39, 0x73, 0x07, 0x4b, 0xce, 0x2b, 0x27, 0x48, 0x34,
-  0xd2, 0xb2, 0x1d, 0x73, 0x08, 0x4b, 0xd7, 0x0f, 0x3d, 0x2e, 0x37, 0xb7,
-  0x05, 0x68, 0xdb, 0x83, 0x24, 0x85, 0x7b, 0x68, 0xdf, 0x24, 0x6b, 0xbd,
-  0x05, 0xe8, 0x0d, 0x87, 0x51, 0x7d, 0xa3, 0x3c, 0x40, 0x3d, 0xea, 0xe3,
-  0xfe, 0x13, 0x09, 0xe8, 0xf9, 0x86, 0x46, 0x22, 0x46, 0xe7, 0x7e, 0x0d,
-  0xe8, 0xe5, 0x4e, 0x3a, 0x46, 0xed, 0x7e, 0x48, 0xe8, 0xd1, 0x4e, 0x2c,
-  0x46, 0xf2, 0x7e, 0x4d, 0xe8, 0xbd, 0x4e, 0x1a, 0x46, 0xf4, 0x7e, 0x4f,
-  0xe8, 0xa9, 0x70, 0x16, 0xdb, 0x6d, 0x1a, 0x9a, 0x24, 0x2c, 0x17, 0x3f,
-  0x68, 0xf6, 0x8d, 0x24, 0x91, 0xa8, 0xec, 0x58, 0xf0, 0x52, 0x08, 0xdc,
-  0xd3, 0x42, 0xec, 0xb8, 0x01, 0x25, 0x5e, 0x51, 0xd1, 0xe0, 0x05, 0xaa,
-  0x95, 0x83, 0xd3, 0x33, 0x59, 0x43, 0x08, 0x51, 0x71, 0x0a, 0x7c, 0xe2,
-  0x98, 0x93, 0x83, 0x41, 0x06, 0x99, 0x17, 0x1f, 0x8b, 0xd9, 0x51, 0x48,
-  0xa3, 0x82, 0xad, 0xc0, 0xdd, 0x9b, 0xfe, 0xd5, 0x30, 0x37, 0x60, 0x68,
-  0x04, 0xe0, 0x25, 0x6a, 0x0b, 0x0b, 0x3c, 0x6f, 0x20, 0x6c, 0xfd, 0x68,
-  0x09, 0x25, 0xe8, 0x1e, 0x33, 0x44, 0x6b, 0xd2, 0x06, 0x72, 0x47, 0x3b,
-  0xdb, 0x44, 0x1a, 0x0c, 0x34, 0x05, 0x8d, 0x7d, 0xb3, 0x0c, 0x0d, 0x48,
-  0x14, 0xdb, 0x83, 0x20, 0x26, 0x2b, 0xa5, 0x99, 0x01, 0x76, 0x05, 0x07,
-  0x0c, 0x03, 0x9f, 0xe8, 0x6e, 0xb3, 0x6f, 0x28, 0x1c, 0xeb, 0x23, 0xd9,
-  0x68, 0x91, 0x37, 0xe7, 0xdc, 0x85, 0xb6, 0xa9, 0x0c, 0x0f, 0x69, 0xb3,
-  0xc1, 0x47, 0xc1, 0x7d, 0xe8, 0xff, 0x8d, 0xeb, 0x06, 0xd2, 0x8f, 0x0b,
-  0xbb, 0xe8, 0x06, 0x01, 0x54, 0x60, 0xae, 0x60, 0x8c, 0xb6, 0x2f, 0x33,
-  0xc0, 0xfd, 0xa3, 0x44, 0x5f, 0xa3, 0x42, 0x5f, 0x04, 0x61, 0xea, 0x7a,
-  0xa2, 0x0b, 0x22, 0xdf, 0x5f, 0x56, 0xe8, 0x52, 0x05, 0x05, 0x4a, 0xbe,
-  0xc2, 0x2f, 0x42, 0x04, 0xd7, 0x11, 0x52, 0x6e, 0xfe, 0x12, 0xfc, 0x80,
-  0xb6, 0x0c, 0xc6, 0x0e, 0xfc, 0x09, 0xb9, 0x06, 0x79, 0x6c, 0xff, 0x46,
-  0x15, 0x98, 0xca, 0x02, 0xde, 0xb1, 0xe8, 0x6c, 0xee, 0x80, 0xbf, 0x42,
-  0x77, 0x0e, 0x9f, 0x72, 0x02, 0x73, 0xb9, 0x05, 0x33, 0x3e, 0x80, 0xfe,
-  0x03, 0xa5, 0x89, 0xee, 0xeb, 0x70, 0x90, 0xd7, 0xee, 0x60, 0xfd, 0x59,
-  0x59, 0xa0, 0x75, 0xb4, 0xc3, 0x6f, 0x64, 0x25, 0xeb, 0x05, 0x76, 0x06,
-  0xe5, 0x25, 0xec, 0xdf, 0x76, 0x04, 0xfe, 0x03, 0x26, 0x6a, 0x06, 0xec,
-  0x0c, 0xd3, 0x84, 0xc2, 0x1a, 0xcd, 0x81, 0xaa, 0x37, 0xb5, 0x1e, 0x26,
-  0x02, 0x33, 0xd4, 0x31, 0x52, 0x98, 0xfb, 0x7c, 0x22, 0x68, 0x21, 0x1e,
-  0x66, 0x16, 0x9c, 0xd0, 0x21, 0x3c, 0x32, 0x06, 0x43, 0x31, 0x99, 0xb2,
-  0xaf, 0xff, 0x68, 0x41, 0x5d, 0x6a, 0xd7, 0xd8, 0x0b, 0x59, 0xc8, 0xf1,
-  0xeb, 0x71, 0x90, 0x07, 0xdc, 0xee, 0x74, 0x63, 0x23, 0xee, 0xd7, 0xfc,
-  0x59, 0x7c, 0xcd, 0x45, 0x26, 0xf9, 0x9e, 0x03, 0x63, 0x4e, 0x56, 0x40,
-  0xe5, 0x7e, 0x9f, 0x4d, 0xff, 0x21, 0xc9, 0x68, 0x81, 0xc9, 0x53, 0x53,
-  0xb4, 0x87, 0xb1, 0xb9, 0x6f, 0x77, 0x02, 0xe8, 0x5f, 0x38, 0x36, 0xa3,
-  0x57, 0x22, 0x47, 0x51, 0x4d, 0x68, 0xb3, 0xa8, 0x42, 0x9f, 0x10, 0x68,
-  0xd0, 0x6c, 0x0c, 0x17, 0xd2, 0x03, 0x38, 0x00, 0x27, 0x2a, 0xfd, 0x24,
-  0xda, 0x83, 0x94, 0x5c, 0x73, 0x57, 0xae, 0x06, 0x0b, 0xb8, 0xfb, 0xb6,
-  0x0e, 0x5b, 0x20, 0x1b, 0xc0, 0xaa, 0x2b, 0x6c, 0xdb, 0x31, 0xd8, 0x75,
-  0x90, 0x4b, 0xfa, 0x09, 0xa4, 0x6a, 0x8e, 0x2a, 0xc5, 0x50, 0x09, 0x03,
-  0x40, 0x84, 0xa9, 0x06, 0xdf, 0x19, 0x91, 0xbe, 0x90, 0x40, 0x68, 0x29,
-  0x27, 0x47, 0x7f, 0x83, 0x7c, 0x83, 0x4d, 0x9c, 0x56, 0x95, 0x39, 0xd3,
-  0xb0, 0x0f, 0x07, 0x15, 0x6f, 0xdf, 0x32, 0x75, 0x4a, 0x3b, 0x4e, 0xe4,
-  0x76, 0xe4, 0x30, 0x64, 0x9b, 0xe4, 0x07, 0xa9, 0x92, 0x84, 0x72, 0x41,
-  0x11, 0xf0, 0x33, 0x75, 0x51, 0xb3, 0xa3, 0x26, 0x58, 0x07, 0x55, 0x72,
-  0xc4, 0x79, 0xda, 0x82, 0xe4, 0xe7, 0xf2, 0xb1, 0x82, 0x51, 0xc9, 0x2e,
-  0x33, 0xe9, 0x46, 0x34, 0xc5, 0xf2, 0xeb, 0x78, 0x90, 0x58, 0x60, 0x0b,
-  0x85, 0x23, 0xe4, 0x2c, 0x08, 0xe4, 0x4e, 0x99, 0xdc, 0x07, 0x10, 0x28,
-  0x63, 0x7e, 0x5b, 0x23, 0x30, 0x91, 0x28, 0x92, 0x32, 0xa7, 0xaf, 0xaf,
-  0x21, 0xe5, 0x1a, 0x13, 0xdb, 0x40, 0x75, 0x07, 0x5c, 0x96, 0x1e, 0x50,
-  0x6c, 0xc9, 0x08, 0xba, 0x61, 0x75, 0x5f, 0xb3, 0x57, 0x9e, 0x68, 0x59,
-  0x67, 0x5a, 0x00, 0x65, 0x4d, 0x4c, 0x61, 0xed, 0x36, 0xa0, 0x62, 0x74,
-  0x9a, 0x01, 0xea, 0x25, 0x8b, 0x95, 0xa0, 0xbc, 0xa9, 0xda, 0x7b, 0x68,
-  0x78, 0x28, 0x0c, 0x39, 0x47, 0xe4, 0x81, 0x1a, 0xe8, 0xd1, 0x84, 0x50,
-  0x87, 0x1f, 0x13, 0x6f, 0x2d, 0x28, 0x68, 0x84, 0xe5, 0x28, 0xe8, 0x02,
-  0x6c, 0x18, 0xcf, 0x96, 0x06, 0x91, 0xc6, 0x90, 0x28, 0xa6, 0xad, 0x91,
-  0x8d, 0x9d, 0x8a, 0x67, 0x87, 0x78, 0x92, 0x81, 0x8f, 0xd9, 0xae, 0x23,
-  0x63, 0x76, 0xbe, 0x22, 0xab, 0x05, 0x4a, 0x67, 0x36, 0x41, 0x25, 0x4c,
-  0xa2, 0x9c, 0x64, 0xdf, 0xa6, 0xaa, 0x68, 0x17, 0x29, 0x23, 0x0a, 0x25,
-  0x4c, 0x6b, 0x9c, 0x0f, 0x5c, 0x0a, 0xdc, 0x04, 0x7f, 0x04, 0x10, 0x2a,
-  0x43, 0x20, 0x68, 0x8a, 0x07, 0x16, 0xae, 0x25, 0xa2, 0xdb, 0x77, 0xf0,
-  0x18, 0xc2, 0x0e, 0xe0, 0x44, 0xfb, 0x59, 0x88, 0x32, 0x82, 0x57, 0xe0,
-  0x51, 0xfa, 0x6d, 0x08, 0x02, 0xf9, 0x14, 0x60, 0x32, 0xfe, 0x68, 0x40,
-  0x29, 0xe8, 0xc2, 0x35, 0x20, 0x9f, 0xe7, 0x68, 0x5b, 0x6c, 0x0a, 0xb7,
-  0xa2, 0x49, 0x19, 0xe8, 0xb4, 0x02, 0x8a, 0x50, 0x76, 0x04, 0xc8, 0x2c,
-  0x23, 0x90, 0x34, 0x3f, 0x21, 0x57, 0xe8, 0xd2, 0xff, 0x4c, 0x59, 0xd1,
-  0xe8, 0xba, 0x28, 0x00, 0x2b, 0xe2, 0xd0, 0x8b, 0xf2, 0x6a, 0x4d, 0x56,
-  0xd8, 0x66, 0xff, 0x22, 0xe8, 0xe9, 0x08, 0x35, 0x36, 0xde, 0x1c, 0x48,
-  0x2d, 0xeb, 0x04, 0xdc, 0x05, 0x72, 0x35, 0x48, 0x60, 0x68, 0x4c, 0xb7,
-  0x2b, 0x7c, 0x58, 0x77, 0x5e, 0x35, 0xc6, 0x30, 0x13, 0x39, 0x7d, 0x73,
-  0x1a, 0x2d, 0xa1, 0x7e, 0x73, 0x46, 0x02, 0xb4, 0x13, 0x01, 0x7c, 0x38,
-  0x16, 0x1b, 0x77, 0xb8, 0xfe, 0x50, 0x1e, 0x68, 0x8c, 0x22, 0xb9, 0x3c,
-  0xdd, 0xda, 0xad, 0x53, 0xbd, 0x0e, 0x86, 0x7c, 0xff, 0xd2, 0x0f, 0xc8,
-  0x33, 0x9d, 0xcf, 0x40, 0x04, 0x9e, 0x23, 0x8d, 0x79, 0x22, 0xe5, 0x40,
-  0xb6, 0x1e, 0x1f, 0x7d, 0x7c, 0xe6, 0xfe, 0xd2, 0x5e, 0x37, 0x6d, 0x0f,
-  0xcf, 0xaa, 0x9a, 0x23, 0x5d, 0x3c, 0x6e, 0xf2, 0xd6, 0x33, 0x4d, 0xcf,
-  0x32, 0x12, 0x9e, 0x24, 0x3d, 0x7c, 0xf6, 0xfd, 0xd2, 0x4e, 0x33, 0x2d,
-  0xcf, 0xba, 0x8a, 0x23, 0x1d, 0x36, 0x46, 0xf6, 0xe9, 0x0e, 0xc6, 0x65,
-  0x01, 0x9e, 0x0e, 0xf4, 0x69, 0xc7, 0x1c, 0xff, 0x52, 0x18, 0x19, 0x48,
-  0x59, 0x71, 0x3e, 0xbd, 0x27, 0x68, 0x82, 0x29, 0xe3, 0xc3, 0x7a, 0x73,
-  0x34, 0x4b, 0x58, 0x8d, 0x0c, 0x39, 0xbf, 0x4a, 0xa4, 0x9b, 0x1f, 0xb2,
-  0x4a, 0xeb, 0x0b, 0xd8, 0x68, 0xa1, 0x26, 0x33, 0x0d, 0xdd, 0xa9, 0x0c,
-  0x40, 0x34, 0x00, 0xf8, 0xc2, 0x29, 0x66, 0x13, 0x32, 0xcf, 0xf4, 0xe9,
-  0x67, 0x0b, 0x80, 0x30, 0x68, 0xe8, 0x52, 0x61, 0x32, 0x50, 0xbb, 0xd8,
-  0xf5, 0x29, 0xf5, 0xdb, 0x21, 0xd2, 0x3e, 0x03, 0x2a, 0xf6, 0xf2, 0x0c,
-  0xcf, 0xc5, 0x2d, 0x34, 0x6e, 0xd3, 0xb8, 0xcd, 0x42, 0x32, 0x34, 0xab,
-  0xc2, 0xd9, 0x6d, 0x1a, 0x1c, 0x68, 0x2a, 0xdb, 0x86, 0x2a, 0xf5, 0xdb,
-  0x18, 0x92, 0x3f, 0xfe, 0x10, 0x75, 0xba, 0x46, 0x56, 0x03, 0x5c, 0xab,
-  0x2a, 0x9c, 0x7b, 0xf2, 0xd5, 0x0c, 0x6e, 0xf2, 0xf2, 0x0c, 0x61, 0xf9,
-  0x10, 0x2b, 0x3b, 0x54, 0x0c, 0xf6, 0x4a, 0x2b, 0x4a, 0x72, 0x47, 0x36,
-  0x30, 0xa1, 0x1e, 0x4b, 0x2b, 0xce, 0x4a, 0x30, 0x7c, 0x75, 0x2b, 0x9c,
-  0x23, 0xf9, 0x92, 0x2b, 0x39, 0x16, 0xe4, 0xb0, 0x19, 0x09, 0xe4, 0xea,
-  0x1d, 0xfc, 0x49, 0x08, 0x70, 0x76, 0x05, 0x97, 0x2d, 0xa1, 0x9d, 0x60,
-  0xf9, 0x56, 0x03, 0x2c, 0x3c, 0xd9, 0x49, 0xd9, 0x13, 0x2c, 0x3c, 0xcc,
-  0x49, 0xd9, 0x27, 0x2c, 0x3c, 0xbf, 0x49, 0xd9, 0x47, 0x2c, 0x3c, 0xb2,
-  0x49, 0xd9, 0x5e, 0x2c, 0x39, 0xa5, 0x93, 0x3d, 0x61, 0xf7, 0xf5, 0x0b,
-  0xd1, 0xe1, 0xca, 0x4f, 0x85, 0x12, 0x6f, 0xcf, 0x0e, 0x0e, 0x2d, 0x70,
-  0xa1, 0x1d, 0x91, 0x17, 0x24, 0x69, 0xff, 0xfc, 0x84, 0x10, 0x88, 0x93,
-  0x9a, 0x28, 0xf0, 0xcc, 0x0e, 0x38, 0x89, 0x3a, 0xbe, 0xe2, 0xf1, 0x0d,
-  0x44, 0x8f, 0xa2, 0x3d, 0x68, 0x7b, 0x8f, 0x2c, 0x90, 0x73, 0xff, 0x6a,
-  0xec, 0x86, 0x0c, 0x1d, 0xd2, 0x48, 0xd6, 0x6a, 0x18, 0x18, 0x72, 0x92,
-  0xe9, 0xba, 0x4c, 0x3d, 0x94, 0xbb, 0xde, 0x97, 0xfc, 0x15, 0x58, 0x13,
-  0x8d, 0xec, 0xd2, 0x2c, 0xe8, 0x9d, 0xb5, 0x0c, 0xe8, 0x7c, 0x6b, 0x37,
-  0x01, 0xd3, 0x11, 0x36, 0x6f, 0x89, 0xfc, 0x7c, 0x8f, 0x2c, 0x8e, 0xe6,
-  0x7c, 0x40, 0x6d, 0xaa, 0x30, 0xc2, 0xdd, 0x29, 0x60, 0x20, 0xe9, 0xd1,
-  0x6e, 0x02, 0x45, 0x95, 0x76, 0x81, 0xa8, 0x1f, 0x41, 0x68, 0xad, 0x2c,
-  0x23, 0xb2, 0x9f, 0x7c, 0xc6, 0x2c, 0x23, 0x89, 0x92, 0x7c, 0x8f, 0x06,
-  0xaa, 0x23, 0xe9, 0xf6, 0x25, 0x02, 0x68, 0xef, 0x40, 0xcd, 0x08, 0x55,
-  0x23, 0x0c, 0xee, 0x2d, 0x6a, 0x0a, 0x0c, 0x9c, 0x64, 0x38, 0x7e, 0xb7,
-  0x0b, 0x11, 0x2d, 0xcc, 0xe8, 0x71, 0x82, 0x3b, 0x15, 0x7e, 0x1a, 0xdb,
-  0x68, 0x14, 0x1f, 0x0b, 0x34, 0x44, 0x9c, 0x6e, 0xd2, 0x19, 0xc9, 0x51,
-  0xcd, 0x02, 0x1c, 0x2c, 0x0c, 0xd2, 0x24, 0x73, 0x32, 0x4b, 0x21, 0x31,
-  0x27, 0x03, 0x34, 0x24, 0xb3, 0x0d, 0x49, 0x04, 0xe5, 0xf6, 0xfd, 0x97,
-  0x29, 0x11, 0x31, 0x18, 0xfd, 0xc2, 0x26, 0x74, 0xcd, 0x2a, 0x1f, 0x1d,
-  0x0b, 0x05, 0x2d, 0x2c, 0xb3, 0x29, 0x0e, 0x64, 0xda, 0x7b, 0x66, 0xba,
-  0x97, 0x31, 0xe7, 0x30, 0x23, 0x21, 0x09, 0xe2, 0xb6, 0x4e, 0x34, 0x5a,
-  0x0f, 0xeb, 0xff, 0xb5, 0x24, 0xf6, 0x68, 0x39, 0x1f, 0xcb, 0xc7, 0xc6,
-  0x4b, 0xd0, 0x4d, 0x5a, 0xb5, 0xeb, 0x05, 0x00, 0x28, 0x39, 0x0a, 0x19,
-  0x49, 0x66, 0x10, 0x91, 0x8c, 0x96, 0x4e, 0x9e, 0x7c, 0xf4, 0x41, 0xf0,
-  0xf4, 0x05, 0xa1, 0xfe, 0x5b, 0x76, 0x7f, 0x14, 0x05, 0xca, 0x55, 0x2d,
-  0x5d, 0xed, 0xbd, 0x8a, 0x00, 0x06, 0x96, 0x07, 0xbf, 0x5d, 0x7e, 0x47,
-  0x15, 0x23, 0x30, 0x75, 0xba, 0x3f, 0x4a, 0x3b, 0xdb, 0x1f, 0x1e, 0x09,
-  0x6d, 0x35, 0x05, 0x96, 0x53, 0x2f, 0xdd, 0x1e, 0x88, 0x00, 0xb2, 0x06,
-  0x28, 0xcc, 0xbd, 0x05, 0x69, 0xb6, 0x65, 0xab, 0x15, 0x6b, 0x2e, 0x5d,
-  0x19, 0x6f, 0x65, 0x40, 0x0b, 0x97, 0x2d, 0x23, 0xfe, 0x9e, 0x7a, 0xc7,
-  0xd9, 0x0c, 0x11, 0xa7, 0xf1, 0x75, 0x4b, 0x14, 0x7a, 0x66, 0xf5, 0x79,
-  0x20, 0x07, 0xcb, 0x01, 0xeb, 0x84, 0x0e, 0xab, 0x9b, 0xff, 0x01, 0xaa,
-  0x04, 0x35, 0x6f, 0x40, 0xae, 0x88, 0x19, 0xba, 0x01, 0x39, 0x13, 0x3b,
-  0xa4, 0x54, 0xa8, 0x0c, 0xb1, 0x0c, 0xc4, 0xf8, 0x41, 0x75, 0x11, 0xaa,
-  0x77, 0xdb, 0xd0, 0x63, 0x08, 0xf3, 0xf4, 0xfb, 0xb7, 0x27, 0x59, 0x16,
-  0xa9, 0x4d, 0x50, 0xe0, 0xfa, 0x1a, 0xe7, 0xfa, 0x22, 0xb5, 0xc2, 0xd0,
-  0x66, 0x08, 0x5a, 0x4c, 0x88, 0x5c, 0x1c, 0xeb, 0x20, 0x1b, 0x3b, 0x0b,
-  0x6a, 0x09, 0x03, 0xe9, 0x6e, 0x19, 0x14, 0xc5, 0x05, 0xbe, 0x2c, 0x17,
-  0x10, 0x1d, 0x46, 0x7e, 0x06, 0x56, 0x06, 0xe0, 0x18, 0x6e, 0x55, 0x0f,
-  0xfb, 0xbd, 0x2d, 0xb3, 0x07, 0x07, 0x4d, 0x30, 0xff, 0x96, 0xfa, 0x60,
-  0x6a, 0xf7, 0x09, 0xed, 0x45, 0x20, 0x6e, 0x7c, 0x0d, 0x77, 0x43, 0xfc,
-  0x33, 0x8a, 0xb8, 0x04, 0xb5, 0x3d, 0x39, 0x56, 0x00, 0x00, 0xf6, 0x22,
-  0xeb, 0xe4, 0x0f, 0x13, 0x12, 0xc8, 0xeb, 0xd4, 0x4f, 0x02, 0xeb, 0xc4,
-  0x52, 0x9a, 0x83, 0x2c, 0x7d, 0xf3, 0x89, 0x2f, 0x8a, 0xaf, 0x01, 0x05,
-  0x66, 0x09, 0xfe, 0x01, 0x0f, 0x8a, 0x1f, 0xed, 0x05, 0xf8, 0x89, 0xce,
-  0x6e, 0xdb, 0xdc, 0x26, 0xf2, 0xe1, 0x05, 0xdf, 0x80, 0x2d, 0x5c, 0x3e,
-  0x48, 0xf9, 0x62, 0xd6, 0x36, 0x64, 0x2e, 0x00, 0xb6, 0x94, 0x3b, 0xc1,
-  0x0c, 0x97, 0x62, 0x07, 0xe8, 0x90, 0x2e, 0x65, 0xa8, 0xe4, 0x08, 0xe8,
-  0x21, 0x19, 0xee, 0x79, 0x0a, 0xe8, 0x14, 0x07, 0x34, 0x2f, 0x1a, 0xb8,
-  0x85, 0x95, 0x60, 0x0c, 0xcb, 0x7a, 0x0c, 0xe4, 0xe8, 0xfa, 0xf8, 0xe5,
-  0xc0, 0xf4, 0x11, 0xe8, 0xed, 0xf8, 0x85, 0x31, 0xda, 0x01, 0x47, 0xc9,
-  0x0b, 0x0b, 0x7f, 0x3e, 0x36, 0xd4, 0xa6, 0x6e, 0xa3, 0x22, 0x5f, 0x24,
-  0x3c, 0x31, 0xca, 0x19, 0x6c, 0x4e, 0x88, 0xf1, 0xfb, 0xfd, 0x2f, 0x0a,
-  0xaf, 0xaa, 0x42, 0x0b, 0xe2, 0x0b, 0xd2, 0xa1, 0x28, 0xd4, 0x78, 0x1d,
-  0x30, 0xc7, 0x14, 0xfd, 0x78, 0x2b, 0x4b, 0x25, 0x26, 0xf0, 0x1e, 0xd8,
-  0x04, 0xcc, 0x26, 0x21, 0xe3, 0xd8, 0x15, 0x63, 0xce, 0x70, 0x1f, 0x8c,
-  0x7e, 0x0a, 0x67, 0x1e, 0x3b, 0xf7, 0xc6, 0x7d, 0x06, 0x89, 0x69, 0x60,
-  0xeb, 0x08, 0x0d, 0x2b, 0xa8, 0x7f, 0x0e, 0xe0, 0x10, 0xf8, 0x94, 0x12,
-  0x00, 0x90, 0x61, 0xe0, 0xfe, 0x89, 0x8b, 0x01, 0x51, 0x58, 0x48, 0x1c,
-  0xee, 0x4b, 0xca, 0x74, 0x80, 0xec, 0xa4, 0xcc, 0xc5, 0xb3, 0x34, 0x01,
-  0x6a, 0x4c, 0x01, 0x79, 0xff, 0xf0, 0xf3, 0x59, 0x30, 0xcf, 0xf7, 0x76,
-  0x93, 0x30, 0x90, 0x78, 0x1c, 0x91, 0x30, 0xb5, 0x25, 0xd6, 0xf0, 0x94,
-  0x1b, 0xcd, 0x08, 0x3a, 0x21, 0xe0, 0x80, 0xff, 0xec, 0x62, 0xde, 0x30,
-  0xde, 0x19, 0x31, 0x6a, 0x09, 0xe9, 0x19, 0x20, 0xd6, 0xe7, 0xce, 0x18,
-  0x10, 0x3c, 0x39, 0x04, 0x26, 0x09, 0x47, 0x97, 0xa5, 0x1e, 0xbc, 0x28,
-  0x74, 0x7e, 0xb3, 0x91, 0x18, 0x47, 0x06, 0x38, 0x75, 0xe9, 0x2b, 0x03,
-  0x5c, 0x43, 0xe8, 0x99, 0xb2, 0x80, 0xf5, 0x1e, 0x51, 0xe2, 0x0e, 0x33,
-  0xff, 0x14, 0x3c, 0x07, 0xbf, 0x70, 0xcb, 0x2f, 0x8f, 0xbb, 0x60, 0xc0,
-  0x75, 0x5b, 0x7e, 0x2c, 0x72, 0x55, 0x23, 0xfb, 0xb6, 0xf0, 0x80, 0x08,
-  0xdf, 0x4c, 0x0e, 0x77, 0x91, 0x46, 0xe0, 0x00, 0x08, 0x77, 0x5d, 0xaa,
-  0x54, 0x31, 0x23, 0x70, 0x8d, 0x84, 0x77, 0xc9, 0x2b, 0x6d, 0x1f, 0x3d,
-  0xd3, 0x8c, 0x0a, 0xed, 0x0b, 0xc2, 0xca, 0x1e, 0xbc, 0x08, 0x34, 0xfc,
-  0x35, 0xd4, 0x57, 0x00, 0x9e, 0x42, 0x6f, 0xee, 0x02, 0x6b, 0xa4, 0xf8,
-  0x0d, 0x31, 0x6e, 0xf9, 0x9a, 0xd5, 0x28, 0x7b, 0x1f, 0xfc, 0xfb, 0x06,
-  0x07, 0xa2, 0xbb, 0xfa, 0x5f, 0xef, 0x80, 0x59, 0x89, 0xb9, 0x25, 0xb8,
-  0xb1, 0xd6, 0x01, 0x05, 0xdd, 0xcb, 0x82, 0xef, 0x01, 0x3e, 0x91, 0x31,
-  0x7c, 0xae, 0x31, 0x02, 0x60, 0xe6, 0x98, 0xf6, 0xcf, 0xcc, 0x31, 0xf5,
-  0x92, 0x76, 0xfe, 0xe7, 0x31, 0xe8, 0xec, 0x23, 0x5c, 0x9e, 0x14, 0x4a,
-  0x16, 0xd9, 0x1e, 0x0f, 0xa7, 0xd6, 0x48, 0x48, 0x07, 0x0d, 0x11, 0x9e,
-  0xec, 0x93, 0xf6, 0xdd, 0x2f, 0xeb, 0x0f, 0x98, 0x0c, 0x15, 0x86, 0x2e,
-  0xf9, 0xac, 0x23, 0xfb, 0x5c, 0x18, 0x08, 0x71, 0xd3, 0x2b, 0x40, 0xbe,
-  0x21, 0xee, 0xff, 0x77, 0x18, 0xdb, 0x02, 0x16, 0x2b, 0x06, 0x24, 0x22,
-  0x18, 0xcd, 0x52, 0x9d, 0x28, 0xa4, 0xee, 0x40, 0xad, 0x85, 0x30, 0x91,
-  0x7b, 0xf7, 0x29, 0x32, 0x6a, 0x12, 0x6e, 0x4e, 0x67, 0xf1, 0xb3, 0x74,
-  0x32, 0x32, 0xd6, 0xaa, 0x16, 0xc3, 0x13, 0xcf, 0x64, 0x50, 0x76, 0x95,
-  0x40, 0x80, 0xca, 0x30, 0x24, 0xe8, 0x45, 0xac, 0x40, 0x05, 0xac, 0x32,
-  0x07, 0xc3, 0x65, 0x5d, 0x02, 0x40, 0x45, 0x6e, 0x0f, 0xeb, 0x22, 0xca,
-  0x23, 0x94, 0xb8, 0x24, 0x88, 0xa3, 0xc8, 0x0e, 0x42, 0x47, 0xe1, 0xee,
-  0xfd, 0xea, 0x08, 0x1c, 0xec, 0x32, 0x8e, 0xa2, 0x75, 0x4a, 0x3c, 0x1f,
-  0xa3, 0x94, 0xbe, 0x5f, 0x12, 0xf0, 0xa1, 0x8e, 0xf0, 0x7e, 0xec, 0x44,
-  0x28, 0x01, 0x80, 0x60, 0xe3, 0x83, 0xf5, 0xa4, 0x99, 0xd3, 0x98, 0x8d,
-  0xe9, 0xdb, 0x22, 0xc2, 0xe2, 0xe4, 0x9f, 0xed, 0x9c, 0x29, 0x33, 0x8e,
-  0x46, 0x33, 0x6c, 0xb5, 0xf4, 0xf9, 0x64, 0x33, 0x1c, 0x12, 0x75, 0x80,
-  0xfc, 0x7f, 0x33, 0xe8, 0x09, 0x22, 0xda, 0xbb, 0x12, 0xc7, 0x06, 0x79,
-  0xf4, 0x68, 0x0b, 0x4f, 0x6f, 0x82, 0x33, 0x35, 0xa0, 0xbd, 0x1d, 0xeb,
-  0x21, 0x59, 0x59, 0x07, 0x13, 0x63, 0x91, 0xa2, 0xa9, 0x02, 0xe4, 0xa2,
-  0x06, 0xac, 0xf3, 0x19, 0x0c, 0x81, 0x52, 0x95, 0x72, 0xfe, 0x68, 0x90,
-  0x66, 0x9f, 0xe0, 0xdd, 0x83, 0xbc, 0x14, 0xaa, 0x4e, 0x16, 0xdd, 0x85,
-  0xdb, 0x39, 0x0a, 0x0b, 0x7c, 0x18, 0x01, 0x02, 0x73, 0xbb, 0x79, 0x02,
-  0xcf, 0x01, 0x47, 0xda, 0x63, 0x02, 0xe7, 0x1d, 0x30, 0x76, 0x3b, 0xc6,
-  0xec, 0x71, 0x1d, 0x40, 0xbf, 0x84, 0x33, 0x55, 0x73, 0x68, 0x74, 0x3b,
-  0xdf, 0xf9, 0x33, 0x0d, 0x40, 0xd5, 0xaf, 0xf3, 0xd4, 0xfa, 0x13, 0x0d,
-  0xe8, 0x59, 0xb0, 0x82, 0xdf, 0xe3, 0x75, 0x4f, 0x68, 0x30, 0xb1, 0x34,
-  0x24, 0x9f, 0x27, 0x68, 0x6c, 0x67, 0x0c, 0x36, 0x3b, 0xcb, 0x22, 0x73,
-  0x97, 0xa1, 0x84, 0x52, 0x0d, 0x3c, 0xff, 0x44, 0x5b, 0x7c, 0x9c, 0x6c,
-  0x41, 0x11, 0xd9, 0xd8, 0x73, 0x86, 0x71, 0x01, 0xfd, 0x13, 0xff, 0xb4,
-  0x12, 0x01, 0xb6, 0x03, 0x10, 0x8e, 0xfd, 0xc2, 0x34, 0xe8, 0xb9, 0x20,
-  0xdb, 0x25, 0xeb, 0x0d, 0x12, 0x0d, 0x4b, 0x35, 0xf3, 0x5d, 0xa3, 0xc6,
-  0x6e, 0x17, 0xd1, 0x28, 0xdb, 0x06, 0xe8, 0x48, 0x66, 0x12, 0x90, 0x8f,
-  0x8e, 0x11, 0x90, 0x08, 0x75, 0x12, 0x35, 0x6b, 0xcf, 0x46, 0x1b, 0x0b,
-  0x10, 0x30, 0x6b, 0x47, 0x44, 0xed, 0x16, 0x15, 0xb5, 0x8c, 0x44, 0x86,
-  0x58, 0xc1, 0x19, 0xd2, 0xde, 0x71, 0x45, 0x34, 0xf8, 0xf6, 0x70, 0x1f,
-  0x20, 0xe8, 0x3b, 0x20, 0xfe, 0x87, 0x35, 0x6a, 0x14, 0x9b, 0x27, 0x28,
-  0x73, 0x25, 0x58, 0x93, 0xc1, 0x66, 0x4b, 0x9d, 0x03, 0x8a, 0x07, 0x7e,
-  0x27, 0x14, 0x6a, 0x46, 0x76, 0x23, 0x54, 0xa5, 0x27, 0xc8, 0x60, 0xa0,
-  0xcb, 0xfc, 0xfe, 0x27, 0x13, 0x09, 0x43, 0xc9, 0x09, 0xfe, 0xe9, 0xb9,
-  0xfe, 0xe9, 0xb6, 0xfe, 0xce, 0x12, 0x5b, 0x8b, 0x73, 0xd2, 0x32, 0x33,
-  0xfc, 0xbe, 0x0e, 0x7f, 0x91, 0x32, 0x91, 0xfc, 0x41, 0xb4, 0xb1, 0x15,
-  0xd9, 0x32, 0x6f, 0x72, 0x0a, 0xe4, 0x15, 0x72, 0xec, 0x9f, 0x52, 0x06,
-  0x87, 0x80, 0x57, 0x01, 0x7c, 0x3d, 0x4e, 0xe9, 0x22, 0x2f, 0xcd, 0x0d,
-  0x2e, 0x2a, 0xbc, 0xca, 0x61, 0x55, 0xeb, 0x37, 0x51, 0x63, 0xdb, 0x78,
-  0x19, 0x7e, 0x79, 0x93, 0xfd, 0x7c, 0x39, 0x72, 0x71, 0x87, 0xfd, 0xf8,
-  0xc9, 0xea, 0x59, 0xec, 0x4f, 0xa7, 0x35, 0xd9, 0x85, 0xf1, 0xf0, 0xc3,
-  0x0a, 0x6c, 0x45, 0x35, 0x47, 0x14, 0xe6, 0xfb, 0x71, 0xcf, 0x10, 0x36,
-  0xee, 0x8c, 0x71, 0x47, 0xa3, 0xc9, 0x4f, 0x9f, 0x1a, 0x4c, 0x18, 0x14,
-  0x26, 0xc2, 0x90, 0x0a, 0x97, 0x78, 0x67, 0xea, 0xe9, 0xdd, 0x2f, 0x36,
-  0x5b, 0x0c, 0x63, 0x78, 0x2e, 0xfc, 0x0f, 0x68, 0x4d, 0x36, 0x6a, 0x12,
-  0xd2, 0xb2, 0x3f, 0x56, 0x36, 0xe8, 0x94, 0x26, 0x0b, 0xd5, 0x90, 0xac,
-  0x36, 0xfd, 0x70, 0x52, 0x71, 0x60, 0xcd, 0x1c, 0x00, 0x80, 0xf3, 0x13,
-  0x6a, 0x34, 0x66, 0xc9, 0x9e, 0x01, 0xce, 0x10, 0x29, 0x53, 0xb0, 0x7a,
-  0x7c, 0x90, 0x83, 0xff, 0xa3, 0x29, 0xbd, 0x74, 0x90, 0x8b, 0x84, 0x56,
-  0xab, 0xd1, 0xd6, 0x2e, 0xec, 0x2b, 0xc2, 0x00, 0x5e, 0x40, 0x99, 0xf7,
-  0xfb, 0x28, 0xb7, 0xf5, 0xd9, 0x59, 0x06, 0x3d, 0x6d, 0x0a, 0xee, 0xdf,
-  0xc8, 0x59, 0x93, 0x91, 0x56, 0x9f, 0xc1, 0x78, 0xf0, 0x3f, 0x9a, 0x0e,
-  0x68, 0xb6, 0xdf, 0xff, 0x15, 0x7a, 0x70, 0x9f, 0xc3, 0xfe, 0x36, 0x23,
-  0xc5, 0x92, 0x70, 0x8e, 0x42, 0xf0, 0x86, 0x51, 0x90, 0x4a, 0xaf, 0x11,
-  0x09, 0x08, 0x5e, 0xe1, 0xe8, 0x7d, 0x23, 0x37, 0xd6, 0xbc, 0x03, 0x74,
-  0x3f, 0x41, 0x09, 0x68, 0x5d, 0x37, 0x63, 0xf4, 0xa9, 0x63, 0x74, 0x66,
-  0xf1, 0x37, 0xe8, 0x8b, 0x25, 0xb9, 0xde, 0x99, 0x37, 0x1b, 0x49, 0x13,
-  0xf8, 0xe8, 0x66, 0xac, 0x27, 0xc1, 0x18, 0xe6, 0x70, 0x0c, 0xd0, 0x74,
-  0x2d, 0xb3, 0xe3, 0x28, 0x5f, 0x26, 0x06, 0x09, 0x05, 0x0b, 0x4c, 0x84,
-  0x75, 0x06, 0x00, 0x04, 0x32, 0x1a, 0x95, 0xe8, 0x2b, 0x38, 0x0b, 0x56,
-  0x16, 0xcc, 0x36, 0xfe, 0x0d, 0x68, 0xdb, 0x37, 0xa5, 0x5b, 0x09, 0x44,
-  0x4f, 0x5a, 0x6a, 0x43, 0x42, 0xac, 0xba, 0x61, 0x45, 0x1b, 0x44, 0x84,
-  0x9d, 0x26, 0x2c, 0x0e, 0xbb, 0xe3, 0x64, 0x9d, 0x6a, 0x75, 0xae, 0x4a,
-  0xd6, 0x9c, 0x04, 0x44, 0x7e, 0x20, 0x03, 0x46, 0x5f, 0x80, 0xbf, 0xd2,
-  0x60, 0x6d, 0x76, 0x28, 0x84, 0x13, 0xe5, 0x8a, 0x87, 0xe8, 0x98, 0x3b,
-  0xc7, 0x26, 0xac, 0xa8, 0xfa, 0xd6, 0xc6, 0x4a, 0xa8, 0x0f, 0xcf, 0x72,
-  0x3b, 0x94, 0xa6, 0x40, 0x8f, 0xa7, 0x1a, 0x7e, 0xbb, 0x51, 0x19, 0x10,
-  0xe0, 0x3b, 0xff, 0x2d, 0xe8, 0xe3, 0x68, 0xdd, 0x37, 0x72, 0x1c, 0x6c,
-  0x6f, 0x25, 0xe5, 0x1b, 0x25, 0x6e, 0x36, 0xa0, 0xc9, 0xe3, 0x9c, 0xdb,
-  0xff, 0x9e, 0x48, 0x67, 0x98, 0x41, 0x4f, 0x01, 0x6a, 0xc3, 0xd0, 0x59,
-  0x50, 0x67, 0x90, 0xe7, 0xcd, 0x10, 0x38, 0xb2, 0x9f, 0xee, 0xf0, 0x07,
-  0x09, 0xab, 0x13, 0x96, 0x66, 0x4c, 0x32, 0xad, 0xd4, 0xae, 0x7b, 0x45,
-  0x91, 0x4a, 0xdf, 0x4a, 0x38, 0x95, 0xee, 0x1f, 0x9f, 0x8e, 0xf2, 0x0c,
-  0x68, 0x63, 0x38, 0x38, 0x12, 0x6f, 0x7f, 0x96, 0x6c, 0x38, 0xe8, 0xf4,
-  0x97, 0x23, 0xa1, 0x38, 0x08, 0xaa, 0xec, 0xb2, 0x6e, 0xb9, 0xad, 0x58,
-  0x2c, 0xb1, 0xbd, 0x47, 0x46, 0x8c, 0x9f, 0xec, 0x29, 0x6c, 0x6c, 0xf0,
-  0xb4, 0xf1, 0x58, 0x48, 0xb9, 0x79, 0xf2, 0xd6, 0xf7, 0xdc, 0xe6, 0x6d,
-  0xcf, 0xd2, 0xfe, 0x9e, 0xed, 0x20, 0x5c, 0xeb, 0x38, 0x63, 0x79, 0x74,
-  0x9f, 0x6e, 0x05, 0x39, 0x23, 0x4b, 0x92, 0x6e, 0x8f, 0xc8, 0x9b, 0x32,
-  0xa3, 0x27, 0x25, 0xd2, 0x5b, 0x80, 0x39, 0x2a, 0x39, 0xa4, 0xa2, 0x7e,
-  0xc4, 0x0b, 0x68, 0x47, 0x39, 0xc7, 0xb5, 0x48, 0x6e, 0x7f, 0xc9, 0x50,
-  0x39, 0xe8, 0x9b, 0x2a, 0x89, 0x39, 0xcd, 0x6a, 0x14, 0xe8, 0x92, 0x6d,
-  0x8e, 0x14, 0x47, 0x5f, 0x9b, 0x25, 0xa2, 0x86, 0x6c, 0xa0, 0x00, 0x2d,
-  0xad, 0xe1, 0x68, 0xba, 0x39, 0xc7, 0x1c, 0xa4, 0x6d, 0x80, 0x5d, 0x1b,
-  0x98, 0x43, 0x9e, 0x7c, 0x51, 0x30, 0x60, 0x56, 0xb8, 0xf7, 0xe0, 0xd5,
-  0x59, 0xb5, 0x67, 0xca, 0xe5, 0x9f, 0xed, 0xec, 0xec, 0x3c, 0x0e, 0xb8,
-  0x0a, 0x3a, 0x47, 0x11, 0x62, 0x6d, 0x49, 0x7e, 0x47, 0xc3, 0x90, 0x9a,
-  0xe4, 0x12, 0x11, 0xb8, 0xb4, 0xbf, 0x03, 0x02, 0xb9, 0x66, 0x22, 0x36,
-  0x97, 0x0b, 0xa9, 0x68, 0xb6, 0x28, 0x4b, 0x02, 0x0b, 0x51, 0x73, 0xfa,
-  0x6c, 0x7b, 0xff, 0x12, 0x7e, 0x15, 0x1f, 0x9d, 0x27, 0x2d, 0x10, 0xaf,
-  0x40, 0x19, 0xe7, 0x2b, 0xe8, 0xe0, 0x1a, 0xbf, 0x00, 0x61, 0xec, 0xb1,
-  0xa1, 0xfa, 0x12, 0x4b, 0x48, 0x1f, 0x6e, 0xe8, 0x46, 0x12, 0x99, 0xff,
-  0x59, 0x56, 0x68, 0x6e, 0x3a, 0xe8, 0xc1, 0xb6, 0x19, 0x08, 0x57, 0x0a,
-  0xbb, 0xc7, 0x0a, 0x00, 0x10, 0xae, 0x72, 0x15, 0x00, 0x59, 0x81, 0x7a,
-  0x36, 0x64, 0xab, 0x92, 0x7b, 0x64, 0xe8, 0x61, 0x15, 0x84, 0x53, 0x99,
-  0xb0, 0x1a, 0x41, 0x0b, 0xc3, 0xf6, 0x05, 0xf1, 0x39, 0x5b, 0x41, 0xbc,
-  0xa1, 0xbf, 0x3e, 0x64, 0x1b, 0x9a, 0x55, 0x61, 0x19, 0x0f, 0x0f, 0x74,
-  0x3b, 0x21, 0x0f, 0x00, 0x74, 0x21, 0x20, 0x0f, 0x8b, 0x87, 0x6f, 0xfd,
-  0x64, 0x8b, 0x97, 0x6d, 0x64, 0x01, 0x0b, 0xbb, 0x11, 0x6a, 0xaa, 0x88,
-  0xff, 0x2f, 0xf6, 0x03, 0x7e, 0x88, 0x61, 0x7c, 0x5e, 0x4a, 0x65, 0x95,
-  0xb9, 0x81, 0x48, 0x79, 0x7b, 0x65, 0x72, 0x79, 0x65, 0x07, 0x16, 0xc3,
-  0x7e, 0xbc, 0x3c, 0xbd, 0x48, 0x27, 0xfb, 0xf8, 0x3e, 0x37, 0x6e, 0x0a,
-  0xee, 0xd1, 0xcc, 0x00, 0x47, 0x10, 0x43, 0xb9, 0x71, 0x3c, 0x9c, 0x6b,
-  0xec, 0x30, 0x87, 0x43, 0x7c, 0xb2, 0x13, 0x12, 0x3e, 0x5a, 0x7e, 0x07,
-  0xb3, 0xc4, 0x86, 0x27, 0x4b, 0xe6, 0xfc, 0x05, 0x06, 0xce, 0xe4, 0xea,
-  0xcb, 0x26, 0xca, 0x8a, 0x87, 0xa9, 0x1b, 0x61, 0x94, 0x72, 0x71, 0x7e,
-  0x20, 0x6b, 0x20, 0x26, 0x19, 0x08, 0xa6, 0xbd, 0x63, 0x0c, 0x0a, 0x34,
-  0xb0, 0xcb, 0x56, 0xbb, 0x04, 0x7d, 0x1d, 0xd3, 0x2e, 0xf8, 0x43, 0x0b,
-  0x8f, 0x6f, 0x30, 0x5d, 0x1c, 0xeb, 0x1b, 0x81, 0x1c, 0x30, 0xa7, 0xd2,
-  0xac, 0xa5, 0xdd, 0xb4, 0x42, 0xff, 0x54, 0x1f, 0xcc, 0x1b, 0x43, 0xa7,
-  0x61, 0x12, 0xff, 0xce, 0x24, 0x2c, 0x5b, 0x36, 0xc1, 0xce, 0x44, 0x4b,
-  0x9c, 0x72, 0xcd, 0x34, 0x77, 0x76, 0xa9, 0x2d, 0x3c, 0x83, 0xfa, 0xdd,
-  0x12, 0xae, 0x35, 0x3b, 0x2b, 0x23, 0xb6, 0x2b, 0x24, 0x1b, 0xd0, 0x2e,
-  0x42, 0x39, 0xde, 0x5e, 0x1d, 0x36, 0x41, 0x0b, 0xdc, 0x0c, 0x75, 0x0c,
-  0x51, 0x93, 0x01, 0xeb, 0x8c, 0x23, 0x2c, 0xa5, 0x40, 0x23, 0x26, 0xe8,
-  0xc5, 0xff, 0x68, 0x8c, 0xde, 0xee, 0x02, 0x6b, 0xb0, 0x63, 0x66, 0x1c,
-  0xdd, 0xd1, 0xe9, 0x9b, 0x76, 0x77, 0x11, 0xee, 0x68, 0x98, 0x0b, 0x06,
-  0x77, 0x8a, 0x1f, 0xba, 0x9a, 0x46, 0x03, 0x8c, 0x04, 0x15, 0xbf, 0x8a,
-  0x37, 0xfd, 0x68, 0x9e, 0x3a, 0x48, 0xc3, 0xe6, 0x24, 0x6a, 0x00, 0x46,
-  0xc5, 0x4a, 0xd4, 0x06, 0x65, 0x97, 0xaa, 0xa4, 0xba, 0x27, 0x1e, 0xa6,
-  0x52, 0x13, 0x1d, 0xb8, 0xb8, 0x51, 0x25, 0x1f, 0xaf, 0xac, 0x55, 0xdf,
-  0x96, 0xff, 0x75, 0x02, 0xff, 0x35, 0xdb, 0x68, 0xd8, 0x65, 0x11, 0x3b,
-  0x0d, 0x5d, 0x02, 0x04, 0xdb, 0x68, 0xf3, 0x0e, 0x02, 0x27, 0x0a, 0x2f,
-  0x08, 0x68, 0xfc, 0x2e, 0xf3, 0x1e, 0xbf, 0x3f, 0x06, 0x3b, 0x12, 0xcd,
-  0xd8, 0x1e, 0x39, 0x3d, 0x07, 0x68, 0x3e, 0xb2, 0x0d, 0xdc, 0xed, 0x68,
-  0x51, 0x06, 0x95, 0xd5, 0xa0, 0x79, 0x23, 0x60, 0x01, 0x1e, 0x2a, 0xa8,
-  0xda, 0xec, 0xc6, 0x2c, 0xe5, 0xbc, 0x46, 0xef, 0xd0, 0x1a, 0x61, 0x3d,
-  0x83, 0x3a, 0xa6, 0x80, 0x6d, 0x8e, 0x53, 0xb8, 0x3e, 0x96, 0x1e, 0x05,
-  0x55, 0x6c, 0x4f, 0x59, 0xb8, 0x8c, 0x1e, 0x6b, 0x5b, 0x40, 0x14, 0x65,
-  0x5d, 0xd8, 0x81, 0x1e, 0xa3, 0x76, 0x16, 0x47, 0x07, 0x68, 0xb6, 0x62,
-  0x2f, 0x66, 0x4e, 0x67, 0x59, 0x5c, 0xd9, 0x76, 0x31, 0x1e, 0xaa, 0xe3,
-  0x5c, 0xd9, 0x6c, 0x3b, 0xd6, 0x74, 0x9a, 0xcd, 0x41, 0x7c, 0x6c, 0x21,
-  0x3a, 0x96, 0xeb, 0x3e, 0x51, 0x02, 0x7c, 0x4f, 0xe8, 0xba, 0xe8, 0x38,
-  0xc1, 0x08, 0xc3, 0xd4, 0x82, 0x20, 0x0b, 0x52, 0x0f, 0x68, 0x81, 0x6c,
-  0x5b, 0x0a, 0xc0, 0x0a, 0xc5, 0xdc, 0x91, 0x36, 0xe8, 0x54, 0x67, 0xd9,
-  0x07, 0x08, 0x34, 0x26, 0x79, 0x05, 0x47, 0x6e, 0x2e, 0xdb, 0x1d, 0x00,
-  0x43, 0xfc, 0x80, 0x30, 0xa4, 0x8c, 0x2f, 0x68, 0x92, 0x6c, 0x1e, 0xbc,
-  0xec, 0x17, 0x06, 0x3d, 0x5e, 0x3b, 0x68, 0x9a, 0x5c, 0xa4, 0x1d, 0x3c,
-  0x4e, 0xa4, 0xb8, 0x9b, 0x1d, 0x0a, 0x41, 0x2d, 0xc0, 0xbf, 0xfe, 0x00,
-  0x86, 0x44, 0x9b, 0xaf, 0xaa, 0x51, 0x14, 0xac, 0x0c, 0x10, 0x0f, 0xac,
-  0x51, 0x0f, 0x53, 0x0b, 0x02, 0x28, 0xdd, 0xa6, 0xff, 0x1d, 0x6c, 0xda,
-  0xcc, 0xba, 0x5f, 0x1d, 0xa2, 0xe0, 0x94, 0x00, 0x20, 0x91, 0x1b, 0x2a,
-  0xac, 0xd7, 0x19, 0xb2, 0x0e, 0xff, 0xb7, 0x5e, 0xe8, 0xbf, 0xed, 0x1e,
-  0x86, 0x35, 0x4a, 0x65, 0xf5, 0xc3, 0x0f, 0x1d, 0x17, 0x89, 0xc5, 0x84,
-  0x52, 0xe3, 0x13, 0x68, 0x85, 0xfb, 0x71, 0xc8, 0xf4, 0x1c, 0xe1, 0x01,
-  0x3c, 0xff, 0x5b, 0x09, 0x68, 0xb7, 0x11, 0x06, 0xe3, 0x1c, 0x65, 0x2a,
-  0xbe, 0xd9, 0xb1, 0xaa, 0xde, 0xde, 0xb1, 0x5b, 0x01, 0x36, 0xff, 0xe7,
-  0xc2, 0x43, 0x40, 0x46, 0x81, 0xe0, 0x2c, 0x01, 0x88, 0x43, 0xc5, 0xdb,
-  0x68, 0x14, 0x38, 0xaa, 0x77, 0x49, 0xff, 0xb5, 0x16, 0x6f, 0x2d, 0xb5,
-  0x14, 0x01, 0x61, 0x41, 0x73, 0x59, 0x4b, 0x57, 0xed, 0x84, 0x65, 0x66,
-  0x8e, 0x1b, 0xdc, 0x35, 0x74, 0x1c, 0x3f, 0x2f, 0x23, 0x3c, 0xe8, 0xcf,
-  0x6b, 0x1c, 0x1b, 0x30, 0xd1, 0x9c, 0xe2, 0xf6, 0x83, 0xce, 0x2c, 0x26,
-  0x0b, 0x21, 0x7b, 0x24, 0x6e, 0xf3, 0x2a, 0xa3, 0x10, 0x52, 0x01, 0x97,
-  0x7b, 0x25, 0x3c, 0x07, 0x4f, 0xab, 0xff, 0x66, 0x66, 0xde, 0xbf, 0x04,
-  0x48, 0x29, 0x99, 0xae, 0x15, 0x55, 0x9d, 0x29, 0x1a, 0xad, 0xfe, 0x1f,
-  0x29, 0xe8, 0xb8, 0x70, 0x93, 0x6e, 0xd7, 0x21, 0x7b, 0x29, 0x01, 0x19,
-  0x23, 0x08, 0x6e, 0xe7, 0x50, 0xec, 0x90, 0x50, 0x19, 0x81, 0x1e, 0x75,
-  0x3c, 0x56, 0x0f, 0x5d, 0xb9, 0x81, 0x52, 0x2d, 0x5f, 0x78, 0xa9, 0x0c,
-  0xf9, 0x90, 0x12, 0x2b, 0xde, 0x72, 0x61, 0x0a, 0xc0, 0x0f, 0x61, 0xf8,
-  0x83, 0x0e, 0x7a, 0xf5, 0x22, 0xb3, 0x1c, 0x04, 0x78, 0x31, 0x66, 0xeb,
-  0x21, 0x13, 0x43, 0xb2, 0x1d, 0x56, 0x99, 0x7f, 0x39, 0x2a, 0xd8, 0x30,
-  0xcd, 0x11, 0x83, 0x86, 0xe5, 0x93, 0x65, 0x54, 0xca, 0x5e, 0xe0, 0x9b,
-  0xd3, 0xaf, 0xb7, 0x59, 0xae, 0x1b, 0x48, 0x59, 0xb2, 0x87, 0x03, 0xb3,
-  0x82, 0x78, 0x9a, 0x19, 0xb8, 0x1d, 0x99, 0xcd, 0x22, 0x38, 0x0d, 0xbe,
-  0xb7, 0x33, 0x37, 0x25, 0xe1, 0x50, 0xbe, 0xa6, 0xb7, 0xce, 0x2e, 0x64,
-  0x88, 0xbd, 0x86, 0x55, 0x27, 0x46, 0x85, 0x67, 0x41, 0x23, 0x34, 0x76,
-  0xd8, 0x0a, 0x46, 0x38, 0x41, 0x3e, 0xc0, 0x9a, 0xfe, 0xa0, 0x9a, 0xb3,
-  0x3c, 0x83, 0xea, 0xc1, 0xa1, 0x80, 0xdf, 0xed, 0xa5, 0x0c, 0x88, 0x11,
-  0x5c, 0x85, 0x50, 0x65, 0x81, 0x70, 0x19, 0x87, 0xdf, 0x8b, 0x76, 0xc0,
-  0x3c, 0xea, 0x5f, 0x3a, 0xea, 0xe8, 0x01, 0x30, 0x15, 0xe8, 0x95, 0x18,
-  0xe3, 0x68, 0xcb, 0x2c, 0x77, 0x0e, 0x12, 0x55, 0xdb, 0xcf, 0x08, 0x35,
-  0xc6, 0x1a, 0x59, 0x2c, 0x5a, 0x90, 0x96, 0xba, 0x32, 0x16, 0xff, 0xdd,
-  0xa1, 0xb8, 0x30, 0x5d, 0x56, 0xf1, 0x9e, 0x3c, 0x17, 0x01, 0x84, 0xb1,
-  0x5e, 0xe4, 0x7e, 0x8d, 0x9c, 0xfd, 0xce, 0x1d, 0x25, 0x2c, 0x87, 0x89,
-  0xcc, 0x3b, 0x92, 0x22, 0xb7, 0x93, 0x68, 0x44, 0xa3, 0x3d, 0x39, 0x1d,
-  0x8c, 0x64, 0xfa, 0x3b, 0xa9, 0xa0, 0x00, 0x75, 0x91, 0x21, 0xbc, 0x07,
-  0x6a, 0x90, 0x2a, 0xf2, 0x86, 0x3d, 0x43, 0x06, 0x23, 0x44, 0x34, 0x12,
-  0x8e, 0xc7, 0x91, 0x83, 0x8c, 0x34, 0x23, 0x4f, 0x3e, 0xa9, 0xbf, 0xae,
-  0x2d, 0x4d, 0xab, 0xb9, 0x3c, 0x24, 0x64, 0x20, 0x20, 0x89, 0x33, 0xa1,
-  0x10, 0xb6, 0x17, 0x36, 0x29, 0xa9, 0x1c, 0xbf, 0x1e, 0x4e, 0xd0, 0xa5,
-  0xa4, 0xaa, 0xc5, 0x8f, 0x70, 0x40, 0x19, 0x20, 0xab, 0x0d, 0x14, 0x01,
-  0x96, 0x2c, 0x17, 0xab, 0x3c, 0xff, 0x63, 0x1f, 0x11, 0x67, 0x6a, 0x0a,
-  0x0d, 0xd6, 0xe8, 0xfd, 0x28, 0x06, 0x59, 0xe9, 0xc0, 0xfe, 0x54, 0x80,
-  0x20, 0x70, 0xf8, 0xd8, 0x10, 0xf4, 0xdb, 0x40, 0x55, 0x72, 0x88, 0x3d,
-  0x38, 0xa6, 0x3d, 0x6c, 0x19, 0x08, 0xe3, 0xf8, 0x2a, 0x01, 0x09, 0x69,
-  0xd3, 0x38, 0x42, 0xab, 0x33, 0xe1, 0xcb, 0x3d, 0xf7, 0x1c, 0x58, 0x63,
-  0x10, 0xf0, 0x87, 0x3e, 0x8e, 0x40, 0x4b, 0x63, 0x04, 0x58, 0x9e, 0x4e,
-  0x68, 0x45, 0xdb, 0x13, 0x13, 0x20, 0xa4, 0x37, 0x7e, 0x82, 0x3e, 0x68,
-  0x80, 0x3e, 0x2b, 0xe4, 0x2b, 0x09, 0x14, 0xe8, 0xb2, 0x90, 0xc5, 0x68,
-  0x14, 0x66, 0x5f, 0x0a, 0x15, 0x2f, 0xea, 0x09, 0x8d, 0xbf, 0xb1, 0x2d,
-  0x09, 0xe8, 0x50, 0xe9, 0xa6, 0x1d, 0x23, 0x85, 0x3e, 0x32, 0x73, 0x68,
-  0x11, 0xab, 0xb7, 0x81, 0xc6, 0xcb, 0xfd, 0x62, 0x83, 0x02, 0xf1, 0xe3,
-  0x57, 0xe1, 0x31, 0xd2, 0x82, 0x24, 0x12, 0x83, 0x0f, 0x30, 0x90, 0x37,
-  0x46, 0x68, 0x84, 0x67, 0xc8, 0x82, 0xa0, 0x62, 0x42, 0x9d, 0x95, 0x26,
-  0x65, 0xcf, 0x79, 0xf9, 0x8f, 0x56, 0x2f, 0x02, 0x95, 0xbc, 0x2e, 0x12,
-  0x07, 0x59, 0x0b, 0x57, 0x45, 0x52, 0xb2, 0x16, 0x8a, 0x68, 0xa9, 0xf8,
-  0x8c, 0x72, 0x03, 0xf6, 0x3e, 0x9e, 0x68, 0xc6, 0x70, 0xcd, 0x06, 0x11,
-  0x38, 0x90, 0xec, 0xfe, 0xe1, 0x3e, 0xe8, 0x08, 0x0f, 0x6a, 0x7c, 0x85,
-  0x5c, 0xe5, 0x17, 0x83, 0x7c, 0x0b, 0xc3, 0xbc, 0x50, 0xc0, 0x5c, 0xb7,
-  0x1c, 0xbf, 0x00, 0x0f, 0x7f, 0x3f, 0xb1, 0x03, 0xd4, 0x74, 0xee, 0xb4,
-  0x2d, 0xa1, 0xe4, 0xb3, 0x42, 0x08, 0x66, 0xce, 0x61, 0x6e, 0x6b, 0xe9,
-  0x97, 0x28, 0x30, 0x2e, 0x97, 0x2d, 0x59, 0x84, 0x11, 0x22, 0x59, 0xd4,
-  0x70, 0x75, 0x71, 0xe7, 0xf2, 0xde, 0x22, 0x53, 0x26, 0xa7, 0x3f, 0xf2,
-  0x95, 0x09, 0x16, 0x30, 0xeb, 0x81, 0x61, 0x36, 0xf6, 0xc7, 0x40, 0x15,
-  0xc9, 0x2a, 0x3c, 0x08, 0xe8, 0x87, 0x9b, 0x5d, 0x24, 0x4d, 0xbb, 0x12,
-  0xd9, 0x68, 0x2d, 0x20, 0x34, 0x12, 0xaf, 0x96, 0x83, 0x1d, 0x83, 0x2f,
-  0xb0, 0x3f, 0x71, 0x9c, 0xff, 0xe6, 0xf7, 0x07, 0x18, 0x7b, 0x37, 0x3f,
-  0xeb, 0x3f, 0x9e, 0x03, 0xdf, 0x05, 0x75, 0x15, 0x3f, 0x2c, 0x29, 0x50,
-  0x21, 0x1a, 0x32, 0x1a, 0x00, 0x8f, 0xdd, 0xd7, 0x47, 0x3f, 0xa1, 0x30,
-  0x70, 0xfc, 0x17, 0xe8, 0xd9, 0x60, 0xc2, 0x2c, 0x2e, 0x0e, 0x22, 0x05,
-  0x77, 0xb2, 0x4f, 0x91, 0x6b, 0x21, 0xff, 0x67, 0x60, 0x60, 0x0e, 0xf8,
-  0x2d, 0xe8, 0x2c, 0xe0, 0x1d, 0x3a, 0x92, 0x9a, 0x2d, 0x23, 0x96, 0x70,
-  0x5f, 0xc0, 0x13, 0xf8, 0x8b, 0x40, 0x20, 0x12, 0x47, 0xec, 0x54, 0x48,
-  0x9e, 0x36, 0xe8, 0x6f, 0x7e, 0xff, 0x74, 0x18, 0xdb, 0x02, 0x16, 0x40,
-  0x23, 0xdc, 0xef, 0x5e, 0x1a, 0x8b, 0x2f, 0x14, 0x19, 0x65, 0xd9, 0x57,
-  0x38, 0x3c, 0x41, 0xe8, 0x36, 0xc9, 0x7c, 0x5a, 0x0e, 0x8a, 0xcf, 0xf6,
-  0x61, 0xfe, 0xc2, 0xe9, 0x8e, 0xb3, 0xe4, 0x5d, 0x3f, 0x72, 0x1a, 0x60,
-  0x72, 0x65, 0x53, 0x52, 0x21, 0x79, 0xbd, 0xe5, 0x02, 0xe4, 0xa5, 0x07,
-  0xcd, 0x5f, 0x21, 0xc8, 0xa9, 0x0d, 0xd3, 0x9b, 0x15, 0x4b, 0x2f, 0x68,
-  0xac, 0x09, 0xd1, 0x3e, 0x0a, 0xe8, 0x99, 0x5f, 0x40, 0x1b, 0xb0, 0x20,
-  0x27, 0x13, 0xe8, 0x9a, 0x78, 0x06, 0x10, 0x3f, 0xfc, 0x18, 0xe8, 0xec,
-  0xde, 0x95, 0xe4, 0x1f, 0xdf, 0x85, 0x09, 0x9a, 0x30, 0xb2, 0x80, 0x88,
-  0xe1, 0x2f, 0x5f, 0x3f, 0x0a, 0x72, 0xaf, 0x5d, 0x47, 0xb7, 0x24, 0xf9,
-  0x33, 0xe8, 0xf6, 0x5e, 0x98, 0x32, 0x0a, 0x16, 0xa6, 0x70, 0x5b, 0xbd,
-  0x20, 0x25, 0x1c, 0xc8, 0xc8, 0x20, 0x50, 0xb2, 0xaf, 0x70, 0xc2, 0xc1,
-  0x81, 0x4f, 0x45, 0xe8, 0xb4, 0x90, 0x5e, 0x98, 0x93, 0x3e, 0xc3, 0xc5,
-  0x16, 0x80, 0x15, 0x83, 0x85, 0xa6, 0x5e, 0xb6, 0xdb, 0x0c, 0x0e, 0x8b,
-  0x49, 0x72, 0x8c, 0x5e, 0x11, 0xb1, 0xb7, 0xe8, 0xe8, 0x49, 0xde, 0xbd,
-  0x49, 0x8f, 0x0c, 0x68, 0xf0, 0x3f, 0xef, 0xe8, 0x62, 0x0b, 0x3d, 0xb7,
-  0xf4, 0x08, 0x89, 0x13, 0x82, 0x59, 0xc9, 0x9e, 0x51, 0xb3, 0x70, 0x80,
-  0x05, 0x18, 0x8b, 0xf4, 0xf6, 0xb8, 0x07, 0x7e, 0xef, 0x0a, 0x10, 0xf8,
-  0xd0, 0x57, 0xad, 0xac, 0x13, 0x78, 0x0b, 0xf6, 0x74, 0x2b, 0x65, 0x7e,
-  0x40, 0x74, 0x0c, 0x81, 0xfe, 0xdd, 0x2b, 0x74, 0x06, 0xb0, 0x05, 0xc0,
-  0x54, 0xa0, 0xb4, 0x97, 0x57, 0x72, 0xd6, 0x36, 0x16, 0x40, 0xbb, 0x5b,
-  0x94, 0xdd, 0x16, 0xd9, 0x62, 0xac, 0xfe, 0xe9, 0x14, 0x29, 0x5d, 0x0c,
-  0x83, 0x2f, 0x14, 0x56, 0x68, 0xc0, 0x2b, 0x40, 0x7c, 0xe6, 0xf8, 0x3e,
-  0x37, 0x8b, 0xc6, 0x12, 0x6f, 0xf4, 0x30, 0x40, 0xb4, 0x6a, 0x12, 0x4d,
-  0x2d, 0x3f, 0x7c, 0x5d, 0x7f, 0xf2, 0xbf, 0x32, 0xff, 0xf6, 0x1f, 0x68,
-  0x33, 0x55, 0xdd, 0x17, 0x62, 0xa6, 0xbe, 0x5d, 0xb4, 0x3a, 0xdc, 0x2a,
-  0xa4, 0x0a, 0x10, 0xad, 0x09, 0x06, 0xc1, 0xcd, 0x12, 0x1e, 0xf4, 0x20,
-  0x2f, 0xc8, 0x1f, 0x79, 0x63, 0x42, 0xa3, 0x72, 0x06, 0x48, 0xa4, 0x12,
-  0x87, 0xce, 0xd5, 0x36, 0x4f, 0x40, 0x0e, 0x17, 0xcf, 0xf0, 0xdc, 0x77,
-  0xa1, 0x99, 0x0d, 0x6b, 0x40, 0xc6, 0x9b, 0x09, 0x4a, 0xac, 0x5d, 0xc6,
-  0x06, 0x93, 0xd9, 0x62, 0x41, 0x5b, 0x63, 0x96, 0x8c, 0x40, 0xeb, 0x6f,
-  0x2e, 0x1b, 0x54, 0x64, 0x39, 0xf6, 0xff, 0xb0, 0x2c, 0xe3, 0xe3, 0xe6,
-  0xe2, 0xd6, 0xe2, 0x20, 0x32, 0x9d, 0x63, 0x04, 0xd9, 0xb3, 0x87, 0xd6,
-  0xdb, 0xde, 0x35, 0x09, 0x1d, 0xd4, 0x14, 0x7b, 0xe3, 0x35, 0xad, 0x40,
-  0x11, 0x9c, 0xe2, 0x6e, 0xd0, 0xe6, 0x5c, 0x76, 0x47, 0x13, 0x68, 0xbc,
-  0xe5, 0x1a, 0x6d, 0xcd, 0xcb, 0xee, 0x1a, 0x09, 0x1b, 0xa7, 0x44, 0xec,
-  0xdc, 0x59, 0x59, 0x23, 0x0d, 0x0d, 0x39, 0xb0, 0x35, 0x74, 0x84, 0x16,
-  0x80, 0x26, 0xc5, 0x09, 0x3c, 0x77, 0xe9, 0x43, 0x8d, 0xa7, 0xce, 0x87,
-  0x5c, 0x83, 0xcf, 0x36, 0x42, 0x00, 0xe8, 0x02, 0x5b, 0x48, 0x2b, 0xef,
-  0xee, 0x38, 0x1b, 0xa7, 0x4e, 0x9d, 0x5c, 0x80, 0x30, 0xcd, 0x3d, 0x3b,
-  0x6c, 0x9b, 0xf4, 0xe3, 0xa5, 0x6c, 0x2f, 0x1e, 0x8e, 0x49, 0x69, 0x47,
-  0x67, 0xf8, 0xe7, 0x45, 0xe8, 0x10, 0xdb, 0x68, 0xfc, 0x0c, 0x0c, 0x1d,
-  0x95, 0x03, 0x9f, 0x5c, 0x19, 0x41, 0x23, 0x12, 0x63, 0x0c, 0x1c, 0x5b,
-  0x48, 0x24, 0x85, 0x11, 0x4b, 0xb6, 0x34, 0x13, 0x0f, 0x6c, 0xfe, 0x5b,
-  0xf2, 0x37, 0xcd, 0x10, 0x4e, 0x7d, 0x27, 0x2c, 0x4a, 0xe4, 0xc6, 0x13,
-  0x51, 0x5c, 0xfc, 0x10, 0xb2, 0x69, 0xc4, 0x11, 0x6e, 0x2d, 0xba, 0x5b,
-  0x40, 0x90, 0x7c, 0xfe, 0x03, 0x04, 0x97, 0x22, 0x31, 0x8a, 0x89, 0xcb,
-  0x52, 0xe3, 0x08, 0xbf, 0x63, 0x74, 0xe6, 0x01, 0x6c, 0x0c, 0x5d, 0x2b,
-  0xda, 0x4a, 0x66, 0x13, 0x90, 0x6f, 0xad, 0x55, 0x28, 0xdc, 0xa4, 0x43,
-  0xed, 0x47, 0x55, 0xec, 0xe8, 0xe5, 0x88, 0x4b, 0x91, 0xcc, 0xd3, 0xf1,
-  0x34, 0x12, 0x23, 0xc8, 0xb8, 0x1e, 0xeb, 0x00, 0xe6, 0x66, 0x61, 0xa8,
-  0x6d, 0xa4, 0xe1, 0xfc, 0x00, 0xbb, 0xbf, 0x75, 0x2e, 0x2a, 0x2e, 0x83,
-  0x6e, 0x1f, 0x7f, 0x1d, 0xc0, 0x10, 0x65, 0xb0, 0xb2, 0x10, 0x3c, 0xd9,
-  0x3a, 0xc4, 0x04, 0x14, 0x9f, 0x6e, 0x6b, 0xfd, 0x5f, 0x44, 0x20, 0x3c,
-  0x23, 0xb3, 0x2b, 0x8e, 0x4f, 0xb4, 0xcf, 0x19, 0xd3, 0xbc, 0x9b, 0x41,
-  0x3b, 0xda, 0x3e, 0xc2, 0x96, 0x25, 0x67, 0x89, 0x41, 0x7b, 0x1c, 0x95,
-  0x5a, 0x80, 0xc2, 0xfc, 0x3f, 0xe3, 0x8c, 0x07, 0xb4, 0xb2, 0xff, 0x41,
-  0x37, 0x79, 0x1b, 0x81, 0x9b, 0x03, 0xa2, 0x01, 0x43, 0xde, 0x52, 0x19,
-  0xe0, 0x28, 0xe0, 0x79, 0x94, 0x1d, 0x29, 0xc6, 0x47, 0x42, 0xba, 0x38,
-  0x3d, 0x5a, 0x10, 0x8f, 0xef, 0x4b, 0x10, 0x02, 0x8a, 0xe4, 0x48, 0x5a,
-  0x8e, 0x4e, 0xf0, 0x18, 0x2e, 0x85, 0x13, 0x5a, 0x4a, 0x56, 0xa1, 0xde,
-  0x52, 0x1b, 0x05, 0x80, 0xc0, 0xf7, 0x59, 0x41, 0xe0, 0xcd, 0x6c, 0x7b,
-  0x70, 0xd9, 0x95, 0xe4, 0xa3, 0xd9, 0x23, 0xbc, 0x54, 0x3e, 0x0b, 0x76,
-  0xb8, 0x90, 0x59, 0xa7, 0x38, 0x58, 0x24, 0x77, 0x59, 0x33, 0x81, 0x71,
-  0x72, 0x84, 0x59, 0x00, 0xde, 0x5f, 0x1b, 0x05, 0x6c, 0xc8, 0x68, 0x59,
-  0x03, 0x63, 0x8c, 0x42, 0xc3, 0x73, 0x4c, 0x59, 0xe4, 0x67, 0x42, 0x73,
-  0x3f, 0x59, 0xe4, 0x84, 0x42, 0x73, 0x4e, 0x59, 0xfc, 0x87, 0x42, 0xe8,
-  0x60, 0x0e, 0xb9, 0x9f, 0x42, 0x1b, 0x3a, 0x13, 0x19, 0xa2, 0x66, 0x4c,
-  0xbf, 0xb9, 0x27, 0x2c, 0xe8, 0x91, 0x26, 0x96, 0xbc, 0x38, 0x69, 0xd4,
-  0xdb, 0x13, 0x12, 0x23, 0xd7, 0x2c, 0x24, 0xd8, 0xee, 0x42, 0xc7, 0xd7,
-  0xe2, 0x58, 0x21, 0x5c, 0x04, 0x96, 0x80, 0x75, 0x9e, 0x1c, 0x06, 0x33,
-  0xd8, 0x44, 0x30, 0xf4, 0xc3, 0xda, 0x53, 0x22, 0x85, 0x24, 0xc6, 0xfd,
-  0x42, 0xdb, 0x39, 0x93, 0x58, 0x02, 0x1b, 0x09, 0x4f, 0x2c, 0x75, 0xdc,
-  0x0b, 0x43, 0xc9, 0xe0, 0xc8, 0xcd, 0xeb, 0x14, 0x00, 0x5a, 0xde, 0x55,
-  0x3f, 0xcf, 0x11, 0xfa, 0x54, 0x7c, 0xf3, 0x2c, 0x60, 0x37, 0x63, 0xce,
-  0xd9, 0x0e, 0x21, 0xf9, 0x46, 0xcc, 0x06, 0xc3, 0x3a, 0x9b, 0x04, 0xbe,
-  0xaf, 0x18, 0xd4, 0x38, 0x4b, 0xfd, 0x8f, 0x20, 0x90, 0x10, 0x38, 0xfa,
-  0x8e, 0x25, 0x90, 0xf8, 0xb4, 0x54, 0x8c, 0xd2, 0xf0, 0x88, 0x84, 0xcf,
-  0x05, 0x4b, 0x00, 0x75, 0x60, 0x0e, 0x7c, 0x04, 0x74, 0x66, 0x81, 0xf4,
-  0x06, 0x74, 0x57, 0x41, 0x90, 0x08, 0x62, 0x41, 0x01, 0x91, 0x32, 0xd8,
-  0x74, 0x2b, 0x1c, 0x1f, 0x0e, 0x75, 0x47, 0x12, 0x25, 0x01, 0xba, 0x2a,
-  0x34, 0x1a, 0x15, 0x2b, 0x20, 0x70, 0x67, 0xd4, 0x5e, 0x15, 0x16, 0x79,
-  0x1e, 0x81, 0x79, 0x6a, 0x05, 0x8f, 0xee, 0x60, 0xae, 0x32, 0x01, 0x12,
-  0x35, 0xf3, 0x8c, 0x40, 0x01, 0x84, 0x48, 0x9a, 0x60, 0x03, 0x0e, 0xb3,
-  0xd8, 0xfa, 0xfe, 0x30, 0xc0, 0x0b, 0x0e, 0x8f, 0xe9, 0x26, 0xf8, 0x53,
-  0xf3, 0x67, 0x25, 0xcf, 0xcd, 0x41, 0x43, 0x47, 0x9f, 0xd6, 0x69, 0xf4,
-  0x41, 0x5e, 0x02, 0x36, 0xcc, 0x56, 0xda, 0x13, 0x16, 0x0d, 0xaa, 0xc9,
-  0xb7, 0x56, 0x43, 0x18, 0x95, 0x84, 0x43, 0x0b, 0x54, 0x74, 0x4c, 0xe9,
-  0xf8, 0x3d, 0x7f, 0x82, 0xbe, 0xce, 0x74, 0xda, 0x40, 0x10, 0x25, 0x8d,
-  0xc9, 0x5a, 0x56, 0x42, 0xd8, 0x25, 0x46, 0xec, 0x87, 0xd1, 0x83, 0x8d,
-  0xfe, 0x42, 0xb3, 0x5d, 0xa0, 0x55, 0x83, 0x77, 0xee, 0x50, 0x0c, 0x09,
-  0x14, 0xab, 0x50, 0x76, 0xea, 0x68, 0xbb, 0xd9, 0x56, 0x17, 0xa6, 0x1f,
-  0xe2, 0x08, 0xeb, 0xa7, 0xe4, 0xc1, 0x5b, 0x82, 0xdc, 0x1a, 0x5f, 0xec,
-  0xcb, 0x59, 0xce, 0xf3, 0xec, 0xe7, 0x7b, 0xd5, 0xd9, 0x9d, 0xf3, 0xb8,
-  0x13, 0x5f, 0x93, 0x83, 0x6d, 0x6d, 0x36, 0x61, 0xda, 0xec, 0x01, 0x44,
-  0xf4, 0x71, 0xc2, 0x55, 0x3b, 0x24, 0x3b, 0x20, 0xe7, 0x23, 0x50, 0xe3,
-  0x70, 0x80, 0xd1, 0x1f, 0xcf, 0xc6, 0xed, 0x46, 0xf1, 0x3d, 0x03, 0x82,
-  0xf0, 0x8f, 0xab, 0xc3, 0x46, 0xf6, 0x7e, 0x5b, 0x50, 0x98, 0xd4, 0x44,
-  0xa2, 0x5c, 0x8b, 0xf6, 0xc0, 0xba, 0x11, 0xff, 0xff, 0x8b, 0x30, 0xac,
-  0xf0, 0x2f, 0xdd, 0x2b, 0x3f, 0x78, 0x27, 0x2a, 0x60, 0xb2, 0x43, 0x4b,
-  0x36, 0x33, 0x06, 0x49, 0x90, 0xa0, 0xed, 0x04, 0x5f, 0x61, 0x32, 0x72,
-  0x3e, 0x6c, 0x26, 0xe6, 0x79, 0x42, 0x4e, 0x60, 0x64, 0x67, 0x47, 0xaa,
-  0x6d, 0xd3, 0x14, 0x10, 0x00, 0xc2, 0xe1, 0xb7, 0xf9, 0xeb, 0x1a, 0xb6,
-  0xf7, 0x50, 0x02, 0x2e, 0xd6, 0xe5, 0xf7, 0xc6, 0x01, 0x78, 0x47, 0x01,
-  0xd4, 0x7d, 0x92, 0x00, 0x05, 0x00, 0xc0, 0x85, 0x80, 0xc1, 0x16, 0xe0,
-  0x52, 0x48, 0x20, 0x4f, 0xa7, 0x13, 0x8b, 0xb4, 0x1e, 0x0b, 0x2b, 0x65,
-  0x5b, 0xfe, 0x87, 0xa6, 0xc9, 0xff, 0x06, 0xd6, 0x0c, 0x2f, 0xb1, 0x23,
-  0x14, 0x5c, 0x9f, 0x85, 0x84, 0xc0, 0x7c, 0x05, 0x51, 0xda, 0x78, 0x09,
-  0xb8, 0x0e, 0xd2, 0xd0, 0xb1, 0x19, 0xa3, 0xda, 0x5b, 0xfd, 0xc7, 0x87,
-  0x9c, 0x4a, 0xb0, 0x49, 0x56, 0xad, 0x66, 0x72, 0x67, 0x4e, 0xa0, 0xf1,
-  0xe2, 0x4a, 0x24, 0x70, 0x52, 0xfe, 0xfe, 0x80, 0xe2, 0x8f, 0x0a, 0xc2,
-  0xa2, 0xd6, 0x0c, 0x14, 0x4c, 0x8f, 0xde, 0xb1, 0x04, 0xd2, 0xe2, 0xd9,
-  0x18, 0x7f, 0x2e, 0x8a, 0xd6, 0x6a, 0x0a, 0x2e, 0x20, 0xdc, 0x0c, 0x08,
-  0x09, 0xfc, 0x08, 0x24, 0xf7, 0x8e, 0xe3, 0x4a, 0xf7, 0x06, 0xa0, 0xed,
-  0xec, 0x08, 0xf1, 0x85, 0xfb, 0x68, 0xf1, 0x51, 0x11, 0xb4, 0x00, 0xc8,
-  0x15, 0xdf, 0x57, 0x11, 0xb1, 0x08, 0xd3, 0xbf, 0xe8, 0x0b, 0xfc, 0xe9,
-  0x8e, 0xdb, 0x17, 0x02, 0xb0, 0x85, 0x38, 0xed, 0x8a, 0x07, 0x88, 0x22,
-  0x6e, 0x12, 0x2d, 0x07, 0x20, 0x87, 0xe6, 0xe2, 0x06, 0x77, 0x2e, 0x0f,
-  0x37, 0xff, 0x0d, 0xb1, 0xb4, 0x0e, 0xb0, 0x07, 0xe8, 0x35, 0xfd, 0x14,
-  0xeb, 0x76, 0xa0, 0xde, 0x4a, 0xb2, 0x3d, 0x3b, 0xe8, 0x7d, 0x6c, 0x0d,
-  0x84, 0xde, 0xeb, 0x67, 0x0e, 0xfd, 0x4c, 0xeb, 0x5d, 0x37, 0x3e, 0xeb,
-  0x58, 0xa0, 0xb8, 0xe7, 0x0e, 0x44, 0x1c, 0xc1, 0x17, 0x0c, 0xed, 0x4a,
-  0x0b, 0x2c, 0x27, 0xda, 0x8a, 0x26, 0x7a, 0xd8, 0x9a, 0xfb, 0x18, 0xee,
-  0x47, 0xb5, 0xaa, 0x39, 0x59, 0xbe, 0xf2, 0x81, 0x25, 0x52, 0x50, 0x2a,
-  0x5c, 0xb8, 0xf8, 0x50, 0x33, 0x2a, 0x0d, 0x7d, 0x99, 0x25, 0xeb, 0x1e,
-  0xba, 0xd1, 0xfe, 0x8a, 0xde, 0xd4, 0xb4, 0x02, 0xb7, 0xdf, 0x9c, 0xd1,
-  0x13, 0x8a, 0x1e, 0x63, 0x33, 0xb4, 0xb4, 0x09, 0x0d, 0x54, 0xda, 0xd5,
-  0xc0, 0x13, 0x9b, 0x43, 0xa0, 0xe0, 0x60, 0x75, 0xd8, 0x0e, 0x70, 0x7e,
-  0xa1, 0xdc, 0x4a, 0x01, 0xdd, 0x4d, 0xa0, 0xe1, 0x8f, 0x17, 0xfc, 0x7d,
-  0x1c, 0xee, 0xb0, 0x06, 0x50, 0x1a, 0x6c, 0x03, 0xdf, 0xd3, 0xe0, 0x4b,
-  0xe1, 0xb0, 0xb7, 0x01, 0x5d, 0xa2, 0x0c, 0x6c, 0xa6, 0xfc, 0x73, 0x0a,
-  0x05, 0x40, 0x14, 0x88, 0xfe, 0x35, 0x91, 0x80, 0x6b, 0xca, 0x65, 0xff,
-  0xec, 0x8b, 0xe5, 0x5d, 0xc2, 0x0b, 0x8a, 0x2b, 0xfd, 0xb0, 0x34, 0xb0,
-  0x52, 0xb0, 0x4d, 0xcd, 0x03, 0x01, 0xc3, 0x43, 0xb0, 0x2e, 0x78, 0xb8,
-  0xec, 0xaf, 0x50, 0xce, 0x07, 0x8d, 0x00, 0x06, 0x8e, 0xc2, 0x04, 0x20,
-  0x5d, 0x87, 0x45, 0xc2, 0xeb, 0x0a, 0xdc, 0x78, 0xff, 0x97, 0x5b, 0xd9,
-  0xa1, 0x08, 0x76, 0xff, 0x0e, 0x03, 0xba, 0xf0, 0xeb, 0x3f, 0x2e, 0xbd,
-  0x4f, 0x40, 0x22, 0xbd, 0x20, 0x78, 0xeb, 0xbf, 0x5a, 0xcd, 0x39, 0xd8,
-  0xaa, 0x74, 0xde, 0x38, 0x60, 0x83, 0x7c, 0xdf, 0x5d, 0x74, 0x1e, 0x83,
-  0x3c, 0xe2, 0x00, 0x7d, 0x0b, 0xa3, 0x52, 0x62, 0x00, 0x76, 0xbd, 0x15,
-  0xfd, 0x4a, 0xf7, 0x44, 0x02, 0x04, 0x05, 0xaa, 0x3e, 0x25, 0x5d, 0xc1,
-  0xe8, 0x66, 0xbb, 0x80, 0x80, 0x7c, 0x0c, 0x7c, 0x7c, 0x0b, 0x8a, 0x44,
-  0x11, 0x5d, 0xcd, 0xd6, 0x8d, 0xfd, 0x74, 0xa2, 0xf8, 0x24, 0xbc, 0xe5,
-  0x06, 0x8e, 0x04, 0xa9, 0x6d, 0x18, 0xff, 0x00, 0x7d, 0xce, 0x13, 0xff,
-  0x91, 0x74, 0x0c, 0xe8, 0xd2, 0x0e, 0x2f, 0x44, 0x1f, 0x59, 0x6c, 0x20,
-  0x0c, 0x10, 0x30, 0x66, 0xa0, 0x49, 0xcc, 0x1e, 0x5e, 0x37, 0x83, 0xe8,
-  0xe0, 0x2d, 0x6b, 0xe9, 0x7d, 0x23, 0x1b, 0x63, 0x7a, 0xb7, 0x7c, 0x29,
-  0x6f, 0x44, 0x08, 0x2a, 0x8f, 0xb8, 0x26, 0x6d, 0xb3, 0x39, 0x04, 0x33,
-  0xb3, 0x57, 0xd9, 0x0d, 0x2a, 0x85, 0xe6, 0x4a, 0x34, 0xdf, 0x07, 0xeb,
-  0x35, 0xeb, 0x33, 0x51, 0x2d, 0xba, 0x03, 0x1a, 0xf8, 0x06, 0xe1, 0xfd,
-  0x04, 0x2b, 0xc7, 0x89, 0x04, 0x57, 0x9d, 0x18, 0x50, 0x9e, 0x9a, 0x42,
-  0x0f, 0xbb, 0x04, 0x3b, 0xc7, 0x6b, 0x59, 0x4d, 0xb0, 0x00, 0x02, 0x16,
-  0xad, 0xf6, 0x4c, 0x02, 0x10, 0x6a, 0xd3, 0x9a, 0xb5, 0xb1, 0x81, 0xd0,
-  0x4c, 0x4c, 0xf2, 0x0c, 0x08, 0x2e, 0x8b, 0xed, 0xeb, 0x06, 0x8a, 0x09,
-  0xc0, 0x88, 0x04, 0x55, 0xd1, 0x6d, 0x0a, 0xa1, 0x0c, 0x83, 0x84, 0x56,
-  0x46, 0xf8, 0x05, 0x48, 0x89, 0x05, 0x56, 0x01, 0xcb, 0xfe, 0x8b, 0x5d,
-  0x0a, 0xff, 0x45, 0x0a, 0x36, 0x6f, 0xb4, 0xdc, 0x3f, 0x05, 0x57, 0x40,
-  0xb0, 0x58, 0x59, 0xd6, 0xd4, 0x3d, 0xad, 0xee, 0x75, 0xcd, 0x2c, 0x6d,
-  0x05, 0x09, 0x41, 0xc9, 0x8d, 0x65, 0xf6, 0x11, 0xc6, 0xa6, 0xee, 0xf7,
-  0x45, 0x65, 0x48, 0xbb, 0x76, 0x04, 0x6a, 0x86, 0xb0, 0x61, 0x6c, 0xb1,
-  0x69, 0xff, 0xbf, 0x14, 0x00, 0xbe, 0x5c, 0x49, 0xeb, 0x12, 0x75, 0x94,
-  0x03, 0xa2, 0x27, 0x17, 0x10, 0xf2, 0xfe, 0x05, 0x03, 0x4d, 0xc4, 0xc6,
-  0x6c, 0xc0, 0x4f, 0x35, 0x9c, 0xe7, 0xb2, 0x35, 0xfe, 0x48, 0x7a, 0x24,
-  0x08, 0x18, 0xb0, 0x02, 0x0b, 0xc5, 0x26, 0x13, 0xf4, 0x76, 0x81, 0x1d,
-  0x59, 0xd0, 0xf7, 0x72, 0x12, 0x57, 0x0b, 0x36, 0x38, 0xc5, 0x89, 0x84,
-  0xf5, 0xdf, 0xc6, 0x0b, 0x87, 0x09, 0x63, 0x10, 0xff, 0x41, 0xae, 0x83,
-  0xdb, 0x1c, 0x1f, 0x10, 0x5f, 0xc2, 0xa9, 0xfe, 0xff, 0x2e, 0x75, 0x01,
-  0x4e, 0x4e, 0x95, 0xb4, 0xb0, 0xbb, 0x98, 0xaa, 0x25, 0xa1, 0x07, 0xbe,
-  0x6c, 0xb3, 0x2e, 0x39, 0x3f, 0xaa, 0x1f, 0x04, 0xf7, 0xeb, 0x99, 0x0f,
-  0xad, 0x23, 0x95, 0x42, 0xb1, 0x4b, 0x3e, 0xc3, 0xcb, 0x7f, 0x00, 0x2f,
-  0x00, 0x3a, 0x00, 0x5c, 0x00, 0xdb, 0x5f, 0xb3, 0x01, 0x59, 0x72, 0x03,
-  0x46, 0x8f, 0x56, 0xc1, 0xc0, 0x5e, 0xeb, 0x80, 0x9b, 0x8a, 0x06, 0xc6,
-  0xba, 0x07, 0x0b, 0x08, 0x46, 0x08, 0x46, 0x0a, 0x46, 0x0a, 0x46, 0x0c,
-  0x46, 0x0c, 0x61, 0xb1, 0x90, 0xaa, 0x46, 0x1d, 0xea, 0x03, 0xff, 0x29,
-  0xab, 0x9b, 0x90, 0x3f, 0xe3, 0x20, 0x74, 0xf5, 0x7e, 0xf1, 0xb7, 0x1c,
-  0xd8, 0x37, 0x3d, 0x50, 0x21, 0xd2, 0x6d, 0xbf, 0x04, 0x0d, 0x36, 0x46,
-  0x74, 0xd3, 0x04, 0xb9, 0xf1, 0x1c, 0xb7, 0x03, 0xf7, 0x10, 0x6c, 0x33,
-  0xff, 0xb5, 0xd3, 0xf0, 0x5b, 0xb9, 0x44, 0xbb, 0xd5, 0xdc, 0xb4, 0x43,
-  0xbe, 0xc9, 0xfc, 0xcb, 0xe3, 0x0e, 0x41, 0x1b, 0x87, 0x0c, 0x6c, 0xbd,
-  0x01, 0xae, 0xfb, 0x4a, 0x3a, 0x02, 0x07, 0xef, 0xad, 0xcb, 0xf8, 0x97,
-  0xfe, 0x75, 0xc4, 0xdc, 0x81, 0x4e, 0x06, 0xde, 0x51, 0x0c, 0x56, 0xb8,
-  0x83, 0x5a, 0xb7, 0xb4, 0xfe, 0x50, 0x6d, 0xeb, 0xaf, 0x89, 0xfb, 0xac,
-  0x3b, 0xc6, 0x75, 0xa8, 0x26, 0x46, 0xe0, 0xda, 0x46, 0x5b, 0xd0, 0x8a,
-  0x33, 0x96, 0x27, 0xa6, 0x08, 0x96, 0x08, 0x41, 0x69, 0x8c, 0xfb, 0x4e,
-  0xeb, 0x49, 0x48, 0xb6, 0x82, 0x47, 0x22, 0x03, 0x04, 0x34, 0x0a, 0xb3,
-  0x08, 0x48, 0x69, 0x82, 0x89, 0x12, 0xad, 0x23, 0x04, 0xa6, 0x3a, 0xa4,
-  0xd8, 0x58, 0xff, 0x56, 0xba, 0x09, 0x4e, 0x36, 0xbd, 0x0f, 0xe6, 0x5b,
-  0x08, 0xee, 0x45, 0xff, 0x33, 0x07, 0xbf, 0x0d, 0x21, 0x77, 0x22, 0x75,
-  0x19, 0x80, 0xd9, 0x7e, 0xab, 0x46, 0xcd, 0x10, 0x06, 0x5b, 0x4b, 0xab,
-  0x2c, 0x02, 0xd8, 0x1f, 0xfe, 0x49, 0xe9, 0x0b, 0x54, 0x2a, 0xc2, 0x00,
-  0x2e, 0x73, 0x30, 0x3f, 0xcb, 0x75, 0x25, 0x7c, 0xa6, 0xb4, 0x13, 0xb4,
-  0x54, 0x2b, 0xa3, 0x07, 0x9a, 0x05, 0x30, 0xa8, 0xda, 0xa3, 0x08, 0x84,
-  0x43, 0xf6, 0x33, 0xc9, 0x98, 0xc2, 0x46, 0x18, 0xfa, 0x8a, 0xd0, 0x3c,
-  0x72, 0xba, 0x87, 0x01, 0xbf, 0x77, 0xeb, 0x20, 0xe1, 0x80, 0xfa, 0x77,
-  0xc3, 0x63, 0xbf, 0x51, 0x76, 0xeb, 0x08, 0x09, 0xf2, 0x61, 0x75, 0x0d,
-  0xdd, 0x09, 0x2b, 0x80, 0x6c, 0x1b, 0x02, 0xa3, 0x8a, 0xfb, 0x72, 0x8a,
-  0x04, 0x2f, 0x6d, 0x46, 0x1a, 0x8b, 0x2b, 0xc2, 0x5b, 0x92, 0x2b, 0xdb,
-  0x75, 0x25, 0x09, 0x74, 0x6b, 0x91, 0x04, 0x6a, 0x62, 0xd7, 0x7c, 0x13,
-  0x0d, 0xba, 0x78, 0x1d, 0xdf, 0x7d, 0x25, 0xfc, 0xff, 0x0d, 0x6a, 0xdb,
-  0x67, 0xcd, 0x39, 0x63, 0x01, 0xb9, 0x9c, 0x5c, 0x24, 0x17, 0x59, 0x81,
-  0xcf, 0xd6, 0x00, 0x40, 0xf3, 0xbd, 0x2a, 0xf6, 0x0a, 0x80, 0xe1, 0xff,
-  0xa1, 0xc4, 0x4a, 0x25, 0x00, 0xc0, 0x0b, 0xb6, 0xf8, 0x2f, 0xa9, 0xd1,
-  0x0e, 0xbd, 0xe7, 0x81, 0xc9, 0x40, 0x0d, 0xa3, 0x58, 0xe3, 0x49, 0x69,
-  0xc2, 0x11, 0xb0, 0x89, 0x3f, 0xce, 0xe2, 0xd5, 0x04, 0x1b, 0xdb, 0xc1,
-  0x62, 0xd9, 0x3c, 0x8a, 0x78, 0x3b, 0x57, 0xd9, 0xbf, 0x2c, 0x9c, 0x62,
-  0xfe, 0xad, 0x9a, 0xab, 0xfc, 0x17, 0xa9, 0xff, 0xa7, 0x6b, 0x02, 0x5b,
-  0xab, 0x1c, 0x4b, 0xf0, 0x7d, 0x23, 0x1f, 0x26, 0xfe, 0x1f, 0xe1, 0x34,
-  0x8e, 0x15, 0x00, 0xa5, 0x88, 0xbf, 0xf5, 0x0a, 0xc0, 0x7d, 0x0d, 0xeb,
-  0x48, 0x5a, 0x17, 0xc1, 0x52, 0x41, 0xd3, 0x7a, 0x6c, 0x13, 0x8a, 0x74,
-  0xf0, 0xc9, 0xca, 0xd1, 0x6d, 0xb8, 0x02, 0xa4, 0x50, 0xda, 0x6a, 0x74,
-  0xc9, 0x6f, 0x70, 0x02, 0xdc, 0x0a, 0x20, 0x09, 0x4c, 0xbd, 0x29, 0x4c,
-  0x9b, 0x0a, 0x1e, 0xa3, 0xfb, 0x77, 0x6b, 0xc2, 0x77, 0x3b, 0xc6, 0x8f,
-  0x06, 0x56, 0x99, 0x7d, 0x62, 0xc0, 0xb9, 0x5d, 0x34, 0x74, 0x3d, 0x1b,
-  0xc9, 0x72, 0xb1, 0xf0, 0x0f, 0x0f, 0x27, 0x02, 0x72, 0x26, 0x71, 0x77,
-  0xb2, 0x4f, 0xd7, 0xd3, 0xf0, 0x8d, 0x3c, 0x14, 0x2b, 0xf9, 0xb9, 0x9f,
-  0x9b, 0x33, 0x12, 0x3c, 0x0b, 0xcc, 0xd7, 0xb0, 0xbe, 0x1c, 0x0f, 0xde,
-  0x2a, 0xb9, 0xfa, 0x59, 0xc3, 0x21, 0x90, 0x11, 0xd2, 0x00, 0xbb, 0x51,
-  0x09, 0xe8, 0xb2, 0x91, 0x45, 0xe0, 0x10, 0xe7, 0xf5, 0xd7, 0x09, 0xad,
-  0xdf, 0x29, 0xe7, 0x81, 0xfe, 0x06, 0x24, 0x2a, 0x32, 0xa0, 0x5a, 0xe6,
-  0x7d, 0x58, 0xe6, 0x47, 0xdd, 0xf8, 0x07, 0x40, 0xa1, 0x6d, 0x42, 0xff,
-  0x07, 0x99, 0x33, 0xc2, 0x2b, 0xc2, 0x6e, 0x3b, 0x8b, 0xc8, 0xee, 0x0d,
-  0xf7, 0x47, 0x02, 0x14, 0x63, 0x0d, 0x85, 0x2f, 0x78, 0x19, 0x95, 0x46,
-  0xf4, 0x2c, 0x1d, 0xb4, 0xf1, 0x4f, 0xa3, 0xf9, 0x9e, 0x69, 0x0a, 0xdc,
-  0x6d, 0x41, 0xb2, 0xba, 0x4e, 0x62, 0xf0, 0xd6, 0x60, 0x10, 0xd8, 0x47,
-  0x11, 0x48, 0x74, 0x83, 0xec, 0xcd, 0xb1, 0xd3, 0x5c, 0x61, 0x88, 0xfa,
-  0x3c, 0x10, 0x3d, 0x66, 0x4a, 0x01, 0x7c, 0xbf, 0x10, 0x0d, 0xe7, 0x7e,
-  0x37, 0x76, 0xff, 0x99, 0x83, 0x29, 0x36, 0x7f, 0x19, 0x56, 0x08, 0x81,
-  0x64, 0x02, 0xc0, 0x5f, 0xfe, 0xe0, 0x6b, 0x4c, 0x48, 0x55, 0x61, 0x6d,
-  0x84, 0x7c, 0xf0, 0x00, 0x12, 0xd8, 0x58, 0x83, 0xfa, 0x01, 0x3d, 0x57,
-  0xfb, 0xbc, 0x47, 0x3b, 0x74, 0xc7, 0x30, 0x9d, 0xe3, 0x04, 0x9e, 0x28,
-  0xc9, 0x08, 0x20, 0xa4, 0x5b, 0xdd, 0x5f, 0x7d, 0x96, 0x0d, 0x16, 0x5b,
-  0x01, 0x0f, 0x65, 0x11, 0xba, 0xeb, 0x6c, 0x09, 0x79, 0xfc, 0x60, 0xfe,
-  0x01, 0x53, 0x35, 0x92, 0xea, 0x13, 0x43, 0x63, 0x70, 0x0a, 0x12, 0xbe,
-  0xc2, 0x05, 0x37, 0x0d, 0x2f, 0x0d, 0x21, 0x2b, 0x81, 0x46, 0xe3, 0x16,
-  0x1c, 0xf4, 0xeb, 0x19, 0x1e, 0xcb, 0xd4, 0x29, 0x1c, 0xe8, 0x1d, 0x4a,
-  0x98, 0x05, 0x8a, 0x88, 0xd1, 0x2d, 0x71, 0xdb, 0xd1, 0xe0, 0x5c, 0x0c,
-  0xdb, 0x46, 0x3b, 0x34, 0x7e, 0xd5, 0xe2, 0xb8, 0x49, 0xe5, 0x6c, 0x37,
-  0x2d, 0x8c, 0x33, 0xb4, 0xcf, 0x40, 0x6c, 0x37, 0x99, 0x90, 0x36, 0x7e,
-  0x2e, 0xc3, 0x27, 0x6a, 0x01, 0xed, 0xdb, 0xca, 0x8f, 0x28, 0x36, 0x4e,
-  0x05, 0xf9, 0x09, 0x85, 0x68, 0x5a, 0xae, 0xc8, 0x03, 0x8b, 0x36, 0x3c,
-  0xc6, 0x15, 0x6e, 0x75, 0xd0, 0x47, 0xcb, 0x63, 0xa6, 0x47, 0x6b, 0x60,
-  0x77, 0xcf, 0xc9, 0x55, 0x0b, 0x08, 0x06, 0x62, 0x43, 0xeb, 0x70, 0x57,
-  0xcb, 0x07, 0x69, 0x04, 0x0d, 0x76, 0x24, 0x63, 0xb8, 0x0e, 0x66, 0x95,
-  0xdf, 0xfa, 0x0c, 0x03, 0xd0, 0x52, 0x6c, 0x0b, 0x0a, 0x1a, 0xb5, 0xd9,
-  0x0a, 0x0e, 0xbb, 0xe8, 0x45, 0x04, 0xef, 0x06, 0x5c, 0x0a, 0x19, 0xd2,
-  0xa1, 0x18, 0x3f, 0x94, 0xe2, 0xca, 0xdc, 0x47, 0x7e, 0x0e, 0xaf, 0x0f,
-  0x04, 0x33, 0xc4, 0x12, 0xc2, 0x74, 0xb4, 0xcf, 0x2d, 0x47, 0x29, 0xcd,
-  0x4d, 0x84, 0x64, 0x3d, 0xed, 0xdb, 0x1c, 0xd8, 0x63, 0xe1, 0xd2, 0x73,
-  0x08, 0xf8, 0x05, 0x76, 0xf6, 0x03, 0x03, 0x02, 0x56, 0x7b, 0x48, 0xca,
-  0x03, 0xba, 0xf7, 0xcd, 0xf0, 0xe4, 0x87, 0x6d, 0xb8, 0xd6, 0x8d, 0xba,
-  0x85, 0xe2, 0x6c, 0x49, 0xc9, 0x30, 0xc6, 0xd3, 0x17, 0xd9, 0x18, 0x16,
-  0xb5, 0x04, 0x0d, 0xf4, 0x68, 0x49, 0xe0, 0xad, 0xc2, 0xc8, 0x50, 0x6f,
-  0x6d, 0x51, 0x5e, 0x92, 0x19, 0x87, 0xb7, 0xc2, 0xe6, 0xc9, 0xd3, 0xf6,
-  0xff, 0x7d, 0x37, 0x24, 0xcb, 0x40, 0x8b, 0x8d, 0x5c, 0x1e, 0x1b, 0x24,
-  0xa0, 0x6e, 0x12, 0x88, 0x07, 0x24, 0xb0, 0x7d, 0x74, 0x1d, 0x80, 0x3e,
-  0xb4, 0x0c, 0x0a, 0xaf, 0x78, 0x06, 0xe3, 0x0d, 0x75, 0x0f, 0x71, 0x73,
-  0x16, 0xf8, 0xcd, 0x06, 0xe9, 0x0b, 0x42, 0xe9, 0xdd, 0xac, 0x00, 0x26,
-  0x90, 0x50, 0xa2, 0x3a, 0x6c, 0x90, 0x02, 0x00, 0x87, 0xe2, 0x4f, 0xcc,
-  0x01, 0x16, 0x77, 0x33, 0x44, 0x4d, 0x74, 0xdf, 0x93, 0xf7, 0x89, 0xc7,
-  0xde, 0xb6, 0xf7, 0xd8, 0x68, 0x00, 0xc8, 0x19, 0x4b, 0x31, 0xa4, 0xad,
-  0x1e, 0x95, 0xeb, 0x48, 0xc7, 0x1a, 0x75, 0x1f, 0x74, 0x63, 0x40, 0xb4,
-  0x18, 0x3f, 0xb6, 0xb8, 0xca, 0x4a, 0x16, 0x12, 0x0e, 0x52, 0x1c, 0x6d,
-  0x3d, 0x01, 0x87, 0x17, 0xe6, 0x90, 0xc9, 0x64, 0x3a, 0x1c, 0x74, 0x0a,
-  0x59, 0x2b, 0x81, 0xc3, 0x77, 0x62, 0xff, 0x6e, 0x35, 0xb3, 0x93, 0xfc,
-  0x04, 0x0e, 0x2d, 0xdc, 0x67, 0xf4, 0xfe, 0x38, 0x10, 0xb2, 0x3d, 0xee,
-  0x06, 0x19, 0x0c, 0xb0, 0xce, 0x95, 0x26, 0xa5, 0x77, 0xa3, 0x56, 0x99,
-  0x0d, 0xd7, 0x54, 0xc8, 0x2b, 0x24, 0x28, 0x42, 0xd5, 0xf1, 0xe9, 0xf7,
-  0x00, 0x27, 0xdd, 0xdf, 0x04, 0x0a, 0x46, 0xcd, 0x99, 0x50, 0x33, 0xd9,
-  0xf4, 0x1d, 0x65, 0x39, 0xbb, 0x05, 0x73, 0x28, 0xf9, 0x07, 0xe5, 0xf6,
-  0x27, 0xcc, 0x1e, 0x3b, 0x2c, 0xc6, 0xf2, 0x9e, 0x1b, 0x36, 0x73, 0x14,
-  0xf6, 0xb7, 0xe9, 0xad, 0x46, 0xfd, 0x04, 0x03, 0xc7, 0x7c, 0x1a, 0xc9,
-  0x2d, 0x84, 0x65, 0xb8, 0x85, 0x2b, 0x1f, 0x0b, 0x1d, 0xeb, 0x7c, 0xff,
-  0xf6, 0x9c, 0x94, 0x63, 0x73, 0x74, 0x2c, 0x60, 0x5e, 0xfc, 0xf6, 0x2c,
-  0x1f, 0xd6, 0x01, 0xea, 0xec, 0xeb, 0x75, 0x4f, 0xb9, 0x4e, 0x05, 0xb4,
-  0x80, 0x66, 0xb6, 0xbf, 0x5d, 0x82, 0x3c, 0x41, 0xeb, 0x36, 0x22, 0xd0,
-  0xdc, 0x42, 0x7d, 0x16, 0x27, 0x6b, 0x53, 0x61, 0xc7, 0xe2, 0x5b, 0x88,
-  0xfb, 0xf4, 0x0f, 0xd7, 0x25, 0xb9, 0xd6, 0xd7, 0xfd, 0x30, 0x42, 0x09,
-  0xd9, 0xff, 0xd4, 0xf6, 0xc3, 0xeb, 0x16, 0x5e, 0x5e, 0xcc, 0x05, 0x43,
-  0xaa, 0x07, 0x86, 0x58, 0x06, 0x06, 0x58, 0x64, 0x31, 0x36, 0x10, 0xd1,
-  0xe8, 0xb4, 0xd3, 0x2d, 0x59, 0x4a, 0x32, 0x50, 0xdf, 0x9e, 0x33, 0xd2,
-  0x5b, 0xf7, 0xa9, 0xf3, 0xc2, 0x65, 0xff, 0xdb, 0x8a, 0x16, 0x12, 0xb6,
-  0x55, 0x0d, 0xb0, 0xd1, 0xe8, 0x2a, 0xd0, 0x88, 0xe6, 0xf3, 0x99, 0xa1,
-  0x8b, 0x9f, 0x38, 0x04, 0x38, 0x43, 0x68, 0xfa, 0x8b, 0x15, 0x3b, 0x14,
-  0x74, 0x99, 0x69, 0x4a, 0x0f, 0x8d, 0x99, 0x5b, 0x9e, 0x14, 0xee, 0xfe,
-  0xc2, 0x3a, 0x36, 0xc4, 0x72, 0x04, 0xb5, 0x91, 0xb2, 0x2d, 0x64, 0x15,
-  0x7b, 0xeb, 0x2d, 0xd3, 0x80, 0x4b, 0x0a, 0xe8, 0xc4, 0x19, 0x05, 0x34,
-  0xb6, 0x46, 0x76, 0xfe, 0x0c, 0x3b, 0x96, 0xcf, 0x4a, 0x2c, 0xe0, 0x90,
-  0x0a, 0x66, 0x1a, 0x28, 0x0c, 0x96, 0x99, 0x0c, 0x7d, 0x68, 0xff, 0xb2,
-  0x22, 0xfe, 0xc8, 0x08, 0x4a, 0xd7, 0x31, 0x21, 0x50, 0x5d, 0x42, 0x66,
-  0x6d, 0x9d, 0x15, 0x0c, 0x88, 0xd1, 0xe5, 0x1a, 0x1c, 0x0d, 0xbc, 0x9a,
-  0xfc, 0xfa, 0x5d, 0x6b, 0xff, 0xc8, 0x83, 0xb6, 0x36, 0x07, 0x2e, 0xd7,
-  0xc1, 0x0a, 0xc4, 0xbe, 0xf6, 0x26, 0x8b, 0x37, 0x83, 0x01, 0x6f, 0x41,
-  0x5a, 0x62, 0x16, 0x4a, 0x1b, 0xd9, 0x25, 0xfe, 0x38, 0x45, 0x29, 0x7a,
-  0x71, 0x8a, 0xdc, 0x33, 0x9d, 0x2c, 0x81, 0xbb, 0x09, 0xa6, 0x07, 0x2a,
-  0xf9, 0x0a, 0x26, 0x89, 0xaa, 0x0a, 0x8b, 0x91, 0x96, 0x37, 0xa7, 0xf1,
-  0x80, 0xa7, 0x95, 0x0b, 0x8e, 0xd0, 0x86, 0x07, 0x13, 0x29, 0x9d, 0x0a,
-  0x58, 0x99, 0x72, 0x1b, 0x74, 0x14, 0x11, 0x90, 0x88, 0xe8, 0x12, 0x19,
-  0xd6, 0x3f, 0x13, 0x46, 0xd6, 0x50, 0x3c, 0x1c, 0xe6, 0xc1, 0x64, 0xaf,
-  0xe5, 0x06, 0xfd, 0xd0, 0x39, 0x4e, 0x0a, 0x77, 0x24, 0xbd, 0x04, 0x06,
-  0x77, 0x1f, 0x75, 0x44, 0x3b, 0xbc, 0xa5, 0x7f, 0x17, 0x39, 0x0b, 0xe6,
-  0x77, 0xb7, 0x12, 0x04, 0x04, 0x77, 0xbd, 0x0d, 0xf8, 0xb6, 0x88, 0x7f,
-  0xf7, 0x1a, 0x36, 0x38, 0x08, 0x43, 0x87, 0x08, 0x70, 0xf0, 0x0c, 0xb1,
-  0x20, 0xeb, 0xa0, 0x45, 0x58, 0x21, 0x46, 0x00, 0x99, 0x3b, 0xa8, 0xdb,
-  0xc9, 0x59, 0xb6, 0x81, 0x62, 0x00, 0xcd, 0xa1, 0x5f, 0xa4, 0x2a, 0xbc,
-  0x01, 0xa4, 0x7f, 0xcf, 0x20, 0x01, 0x80, 0x6a, 0x27, 0xae, 0x5f, 0xe1,
-  0x17, 0x01, 0xfe, 0x75, 0x5b, 0x02, 0x0a, 0x2c, 0x08, 0xb6, 0x06, 0x14,
-  0xe6, 0x0e, 0x06, 0x85, 0x88, 0xe4, 0x68, 0x11, 0x66, 0xf6, 0x05, 0xc8,
-  0x0c, 0xc8, 0x06, 0xce, 0x08, 0xfb, 0x17, 0x40, 0x18, 0x31, 0xb9, 0x3f,
-  0xbb, 0xfa, 0x41, 0x44, 0xbb, 0x83, 0x60, 0xff, 0x23, 0xd9, 0x2f, 0x4b,
-  0x22, 0x1c, 0xd0, 0xf9, 0xb2, 0x0a, 0x0d, 0x0c, 0x92, 0x46, 0xa5, 0xef,
-  0xb0, 0xff, 0x36, 0x99, 0x08, 0x23, 0x9f, 0xe8, 0xe9, 0x93, 0x67, 0x87,
-  0x40, 0x60, 0x58, 0x76, 0x48, 0x89, 0x06, 0xc3, 0x88, 0x90, 0x32, 0x19,
-  0x0a, 0x01, 0x92, 0x0a, 0xe4, 0x47, 0x0b, 0xd9, 0xb9, 0xfe, 0x36, 0x6c,
-  0x59, 0xbc, 0xe9, 0x74, 0x6c, 0xd4, 0x3e, 0x06, 0x2d, 0xe0, 0x66, 0x0e,
-  0x6d, 0x47, 0x8a, 0x6e, 0x5b, 0x4d, 0x4e, 0xaa, 0x0c, 0x9c, 0x33, 0x68,
-  0x48, 0x34, 0x5f, 0x3c, 0xf9, 0x0c, 0x2c, 0x54, 0x60, 0x10, 0x4d, 0xcd,
-  0x89, 0x95, 0x0a, 0x0d, 0x6d, 0x26, 0xf1, 0x5e, 0x49, 0xff, 0xfd, 0x63,
-  0xe3, 0x06, 0x68, 0x09, 0xb2, 0xe4, 0x18, 0xb8, 0xb4, 0xc3, 0x4b, 0x8e,
-  0x38, 0x9b, 0x00, 0xa0, 0x70, 0x7c, 0x33, 0x55, 0x87, 0x6e, 0x24, 0xc9,
-  0x6e, 0xc9, 0x02, 0x73, 0x6c, 0x4e, 0x04, 0xaa, 0x12, 0x8d, 0xe2, 0x0a,
-  0xe5, 0xc7, 0x2a, 0x44, 0x9b, 0xc6, 0x02, 0x7f, 0x05, 0x57, 0x24, 0x60,
-  0x7f, 0x76, 0x47, 0xab, 0xa6, 0x00, 0x0b, 0xd3, 0xce, 0x37, 0x0e, 0x81,
-  0xfe, 0x6a, 0x34, 0x35, 0x64, 0x0a, 0xdf, 0xd0, 0x0c, 0x5c, 0x28, 0xd9,
-  0x14, 0xcc, 0xa5, 0x0c, 0x96, 0x5c, 0x06, 0x59, 0xcc, 0x97, 0xb6, 0xdc,
-  0x11, 0x98, 0xe0, 0x60, 0x00, 0x32, 0x17, 0xdd, 0x88, 0x91, 0xf7, 0xc0,
-  0x60, 0x32, 0x2e, 0xf8, 0x37, 0x18, 0x59, 0xba, 0x54, 0xf3, 0x86, 0xc7,
-  0x80, 0x06, 0x4e, 0xc1, 0x89, 0x2c, 0x5a, 0x5f, 0x72, 0x74, 0x8a, 0x3d,
-  0xdb, 0x1e, 0x39, 0x48, 0x7d, 0x56, 0x49, 0x8a, 0xc2, 0x5f, 0x55, 0x75,
-  0x5b, 0x46, 0xe8, 0xc5, 0xd6, 0x18, 0xc0, 0x3a, 0x38, 0xfe, 0x1f, 0x1d,
-  0x04, 0x2a, 0xd9, 0x46, 0x6d, 0xae, 0x06, 0x31, 0x7a, 0x37, 0xd5, 0xac,
-  0x57, 0x3d, 0xa1, 0xff, 0xc6, 0xab, 0x89, 0x72, 0x25, 0x61, 0x1f, 0xac,
-  0xfb, 0x7d, 0x34, 0xe8, 0x65, 0x0a, 0x77, 0x81, 0x01, 0x3c, 0x8b, 0xab,
-  0x1c, 0x7c, 0x96, 0xa0, 0x8c, 0xb6, 0x91, 0x33, 0xd2, 0x10, 0xba, 0xb8,
-  0x18, 0xc0, 0x6d, 0x9e, 0x04, 0x50, 0x48, 0x89, 0xc2, 0x08, 0x10, 0xd5,
-  0xda, 0x5e, 0xb0, 0xca, 0x1c, 0xdd, 0x4a, 0xe8, 0xb3, 0xbe, 0x1b, 0x65,
-  0xde, 0xa7, 0x67, 0xdc, 0xfb, 0x08, 0xe0, 0x24, 0x12, 0x95, 0x07, 0xda,
-  0x75, 0xbe, 0xea, 0xc9, 0x77, 0x13, 0xb8, 0xd2, 0x4a, 0x07, 0x1f, 0x65,
-  0x14, 0x0f, 0x88, 0xb8, 0x95, 0xc9, 0xd7, 0xe9, 0x03, 0x35, 0x88, 0x7a,
-  0x99, 0x95, 0x3f, 0x90, 0xb8, 0xd6, 0x7e, 0x1f, 0xf4, 0x0e, 0x0a, 0xe4,
-  0x47, 0x34, 0x96, 0x04, 0x92, 0x15, 0x55, 0x0a, 0x2f, 0x87, 0x4d, 0xb9,
-  0x02, 0xec, 0xdb, 0x6a, 0x01, 0x06, 0x0e, 0x6d, 0xa1, 0x02, 0x6d, 0x99,
-  0x9c, 0x1c, 0x3b, 0x8c, 0xcf, 0x70, 0x1a, 0xee, 0x27, 0x70, 0xd5, 0x7b,
-  0x38, 0xac, 0x14, 0xa8, 0xbc, 0x74, 0x85, 0x23, 0x80, 0x1a, 0x0a, 0x3a,
-  0x9b, 0xe6, 0xd8, 0xf6, 0x10, 0x52, 0xad, 0xc0, 0x08, 0xaf, 0x1b, 0x0c,
-  0xdb, 0x05, 0xe0, 0x15, 0x04, 0x38, 0x92, 0xe8, 0x35, 0xe0, 0xce, 0x56,
-  0xc9, 0x15, 0x8b, 0x16, 0x41, 0x6f, 0x4e, 0x16, 0x03, 0x8b, 0xf0, 0xc2,
-  0xc3, 0xe8, 0xf3, 0x23, 0x7b, 0xde, 0x32, 0x36, 0x6d, 0x40, 0xdc, 0x0e,
-  0xe4, 0xff, 0x43, 0x64, 0xba, 0x12, 0xdf, 0x41, 0x48, 0xee, 0xe8, 0x8a,
-  0x00, 0x47, 0x4d, 0x40, 0x3d, 0x6c, 0xa2, 0x73, 0x1f, 0xcc, 0xd6, 0x86,
-  0x00, 0x2e, 0xe2, 0xd1, 0xe3, 0xf7, 0x35, 0x05, 0x5d, 0x02, 0x12, 0x59,
-  0x83, 0x78, 0xf3, 0x14, 0x6d, 0x79, 0xe9, 0xb7, 0x9e, 0x1e, 0x81, 0xa7,
-  0x23, 0x24, 0x62, 0xfd, 0x3e, 0xd9, 0xf8, 0xe0, 0x3d, 0x3c, 0x46, 0x57,
-  0x17, 0xdf, 0x02, 0x95, 0x68, 0xa2, 0x10, 0x1e, 0xba, 0x3c, 0x25, 0xa6,
-  0x0b, 0x75, 0x04, 0xc1, 0x0d, 0x46, 0x68, 0xd8, 0x25, 0x77, 0x4b, 0x33,
-  0x76, 0x6d, 0xf1, 0xd6, 0x0b, 0x61, 0x81, 0x88, 0xfa, 0x2b, 0x45, 0x6f,
-  0x33, 0x09, 0xf7, 0x8b, 0xfa, 0x57, 0x50, 0x56, 0xce, 0x9c, 0x06, 0xa8,
-  0x04, 0xb4, 0xcb, 0x15, 0x0d, 0xfb, 0x73, 0x63, 0xf9, 0x4c, 0x74, 0x54,
-  0x2b, 0xdd, 0x3f, 0xeb, 0x42, 0x8c, 0x3a, 0xf0, 0x57, 0xb8, 0xd9, 0x9d,
-  0x46, 0xbd, 0x3c, 0xa3, 0xe0, 0x46, 0x7b, 0x76, 0x28, 0x57, 0x10, 0xd8,
-  0x46, 0xc9, 0x55, 0x73, 0x12, 0x89, 0x51, 0xdd, 0x43, 0x03, 0x6a, 0x11,
-  0x14, 0x47, 0x13, 0xac, 0x48, 0x08, 0xa0, 0x98, 0xeb, 0x13, 0xa1, 0x48,
-  0x10, 0xc2, 0x05, 0x80, 0xca, 0xd8, 0xae, 0x29, 0x11, 0x07, 0x45, 0xda,
-  0xeb, 0x23, 0xe5, 0x20, 0x5a, 0x65, 0xc2, 0x21, 0xfd, 0x2e, 0xef, 0x59,
-  0x4f, 0xc0, 0x22, 0x36, 0x37, 0xec, 0xe1, 0x20, 0x8c, 0x92, 0x55, 0x37,
-  0xdb, 0xfc, 0x2b, 0xc0, 0xe0, 0x99, 0xb9, 0x0a, 0xe8, 0x00, 0xbf, 0x5c,
-  0x9d, 0x8a, 0x1c, 0x10, 0x4a, 0xa1, 0x36, 0xba, 0xf8, 0xa8, 0x5e, 0xd4,
-  0x80, 0xfb, 0x2b, 0x85, 0x13, 0x6d, 0x04, 0x2d, 0xb7, 0xfd, 0x45, 0x15,
-  0x37, 0x08, 0x39, 0x77, 0xff, 0x2e, 0x80, 0xeb, 0x30, 0x72, 0x29, 0xf7,
-  0xe1, 0xfc, 0x03, 0xc3, 0x12, 0xd6, 0x74, 0xeb, 0x0a, 0xdc, 0xd7, 0xbc,
-  0x36, 0x37, 0x0e, 0x97, 0x87, 0xfb, 0xd1, 0xf7, 0xe2, 0x92, 0x97, 0x15,
-  0x76, 0x13, 0xd1, 0x28, 0x0c, 0x05, 0xde, 0x73, 0xe1, 0x4d, 0x7c, 0x85,
-  0x07, 0xa1, 0xda, 0x18, 0x51, 0x53, 0xb5, 0x46, 0x5f, 0x12, 0x62, 0x1b,
-  0xd1, 0x87, 0xff, 0x23, 0x1e, 0xad, 0x07, 0x63, 0x96, 0x04, 0x0e, 0x8a,
-  0xb6, 0x02, 0x8b, 0x05, 0xfd, 0xdb, 0xd1, 0xe9, 0x01, 0x80, 0xeb, 0xe1,
-  0xc0, 0x02, 0x6d, 0x97, 0x73, 0x09, 0xa5, 0xbc, 0x56, 0x06, 0xcd, 0x13,
-  0x0c, 0xa8, 0x02, 0xdf, 0x2b, 0x89, 0x0f, 0x89, 0x57, 0xe3, 0x02, 0x8a,
-  0xc4, 0x29, 0x04, 0x01, 0x4d, 0x4c, 0xd4, 0xd6, 0x81, 0xea, 0x35, 0xff,
-  0x3b, 0xc2, 0x73, 0x07, 0xa3, 0x9a, 0x00, 0x15, 0x83, 0x35, 0x08, 0x33,
-  0x21, 0x25, 0xbb, 0x3d, 0x03, 0x06, 0x1b, 0x70, 0x83, 0xd2, 0x76, 0x61,
-  0x0b, 0xd2, 0xad, 0x40, 0xdb, 0x81, 0xc1, 0x2f, 0x72, 0x06, 0x57, 0xfb,
-  0xcc, 0x73, 0x06, 0x87, 0x16, 0x99, 0x30, 0x1b, 0x95, 0xe4, 0xa4, 0xde,
-  0x3c, 0xa0, 0x9a, 0xfc, 0xb7, 0xd6, 0x0e, 0x0f, 0x78, 0xb4, 0x3b, 0xee,
-  0xc6, 0xcd, 0x21, 0x72, 0x8f, 0xf3, 0xb7, 0x04, 0x17, 0x56, 0x05, 0x1d,
-  0x98, 0x19, 0x6d, 0x0f, 0x98, 0x8e, 0x1b, 0x0e, 0x8a, 0x7b, 0x98, 0x38,
-  0x35, 0x2e, 0x60, 0xb4, 0x43, 0x06, 0xa6, 0x67, 0x2e, 0x03, 0xbf, 0x91,
-  0x2d, 0x28, 0x05, 0x67, 0x43, 0x3e, 0xcf, 0x8b, 0x5e, 0x0c, 0x15, 0x82,
-  0x92, 0xce, 0x4b, 0x0a, 0xcd, 0x1d, 0x3e, 0x5d, 0xeb, 0x14, 0x26, 0x9f,
-  0xb6, 0xff, 0x3c, 0x26, 0x34, 0x70, 0x12, 0x35, 0xe0, 0x3a, 0x07, 0x1f,
-  0xb3, 0x08, 0x80, 0x5b, 0xb5, 0x75, 0x99, 0xe7, 0x63, 0x1a, 0xb4, 0xf4,
-  0x12, 0xb3, 0x10, 0xe8, 0xbe, 0xfb, 0x8a, 0xc3, 0x04, 0xf0, 0x15, 0x09,
-  0xbc, 0x37, 0x1e, 0x51, 0xb9, 0x54, 0x4b, 0xf1, 0xd9, 0xd0, 0x59, 0x80,
-  0x2d, 0x81, 0x09, 0xbf, 0x04, 0x0f, 0x74, 0x56, 0xcd, 0x10, 0xfc, 0xeb,
-  0x6a, 0x3c, 0x03, 0x75, 0x1a, 0x0b, 0x57, 0x1a, 0x6e, 0x0a, 0x3c, 0x1a,
-  0x09, 0x38, 0x7f, 0x26, 0x87, 0x00, 0xfe, 0xb4, 0x01, 0xed, 0xb9, 0x07,
-  0x06, 0x0f, 0xdb, 0xb8, 0x03, 0xf5, 0xde, 0xf6, 0x3c, 0x40, 0x75, 0xda,
-  0x44, 0xb5, 0x48, 0xa1, 0x0e, 0xa3, 0x6b, 0x10, 0xd5, 0x7e, 0xb8, 0x12,
-  0x11, 0x32, 0xdb, 0xeb, 0x1a, 0x00, 0x59, 0x6f, 0x20, 0x06, 0x67, 0x36,
-  0x26, 0xcb, 0x80, 0x0e, 0x01, 0x34, 0x00, 0xdb, 0xeb, 0x18, 0x13, 0x9b,
-  0x53, 0x12, 0x6f, 0xac, 0x7f, 0xff, 0x0a, 0xdd, 0xc0, 0x58, 0x69, 0x3e,
-  0xe8, 0x84, 0x00, 0x18, 0x5e, 0xc0, 0xb0, 0x40, 0x1f, 0x1b, 0x07, 0x0f,
-  0xe8, 0xd4, 0x77, 0xff, 0xb2, 0x7c, 0x17, 0x8b, 0x65, 0x53, 0xaa, 0x0b,
-  0x6e, 0x42, 0xa3, 0xff, 0x24, 0x7f, 0x8a, 0xe0, 0x88, 0x26, 0xe3, 0xb5,
-  0x4a, 0x03, 0x02, 0x1e, 0x2a, 0x7d, 0x8a, 0xe4, 0x4a, 0xdb, 0x28, 0x4e,
-  0xff, 0x12, 0x44, 0xbb, 0xf0, 0x3a, 0x06, 0x0c, 0x7b, 0x74, 0x2d, 0xa0,
-  0x11, 0x9a, 0x2e, 0xa5, 0x9e, 0x76, 0x16, 0x37, 0xff, 0xe7, 0x1e, 0x19,
-  0xe5, 0x80, 0x3e, 0x70, 0x67, 0xa8, 0xb1, 0xc5, 0x63, 0x64, 0x7e, 0xdd,
-  0x05, 0xc6, 0x2d, 0x40, 0x63, 0x18, 0x76, 0xbf, 0x13, 0x06, 0x40, 0x73,
-  0x9e, 0x0c, 0x07, 0x0c, 0x62, 0x98, 0xa2, 0x95, 0xdd, 0x88, 0x17, 0x58,
-  0x2d, 0xb0, 0xb6, 0x69, 0x0b, 0xce, 0x3b, 0xa0, 0xdb, 0x3a, 0xfe, 0x18,
-  0x45, 0xac, 0x54, 0x29, 0xed, 0x1f, 0xd5, 0xed, 0xf0, 0xba, 0xea, 0xa4,
-  0xf6, 0x52, 0xb8, 0xef, 0x4a, 0xa9, 0xe2, 0x91, 0xfe, 0x8a, 0x7b, 0x9f,
-  0xb4, 0x06, 0xd9, 0x43, 0x36, 0xe8, 0x2a, 0x6b, 0xd9, 0xb3, 0x00, 0xb0,
-  0x0d, 0x14, 0xa1, 0xa3, 0x63, 0x46, 0x1e, 0xd6, 0xe9, 0x32, 0xb7, 0x0e,
-  0x00, 0xa2, 0x5b, 0x5f, 0xa2, 0x5a, 0x75, 0x2e, 0xa9, 0xb6, 0x04, 0xa7,
-  0xe0, 0xd9, 0x07, 0xe5, 0xf0, 0xe1, 0x4a, 0x18, 0x48, 0x2b, 0x5d, 0x2c,
-  0x18, 0xf5, 0x36, 0x4c, 0x3d, 0xc2, 0x44, 0xe9, 0x7f, 0x3e, 0xf6, 0xc2,
-  0x80, 0x75, 0xb6, 0x35, 0x13, 0x42, 0x21, 0x05, 0x6e, 0xd1, 0x0f, 0xc4,
-  0x2e, 0x52, 0x2b, 0x4c, 0x0c, 0x04, 0x06, 0x72, 0x3e, 0x5a, 0x59, 0x72,
-  0x19, 0xdb, 0x2e, 0x42, 0x1b, 0xb6, 0x12, 0x3b, 0x0d, 0xe2, 0x72, 0x09,
-  0xad, 0xe9, 0x6d, 0x17, 0x72, 0x30, 0xea, 0xcf, 0x1b, 0xee, 0x02, 0x00,
-  0x9f, 0x01, 0x1e, 0xb4, 0x2f, 0x6f, 0x23, 0x06, 0x53, 0xb4, 0x8e, 0x1a,
-  0xd2, 0x6e, 0x08, 0xb4, 0x4e, 0x38, 0x66, 0x63, 0x61, 0x9c, 0xdb, 0x59,
-  0x93, 0x13, 0x5a, 0xb7, 0x1f, 0x08, 0x51, 0x9d, 0x8c, 0x1f, 0x9c, 0xe2,
-  0x53, 0x5b, 0xd0, 0x02, 0x32, 0x23, 0x9a, 0x04, 0x4f, 0xc0, 0x2c, 0xb9,
-  0x8c, 0x97, 0x22, 0x48, 0x14, 0xe5, 0x13, 0x8b, 0x00, 0x56, 0x33, 0xdb,
-  0x3d, 0x02, 0x75, 0x5c, 0x26, 0x8d, 0x03, 0x8a, 0x59, 0x43, 0xe7, 0xac,
-  0xe6, 0x28, 0xc7, 0xa4, 0x82, 0xc6, 0xc4, 0x03, 0xad, 0x30, 0x1a, 0xc0,
-  0xb4, 0x17, 0x56, 0xc2, 0x07, 0x9f, 0x53, 0x4c, 0xa9, 0x97, 0xc1, 0x52,
-  0xc4, 0x89, 0x45, 0x63, 0xdf, 0xbb, 0xb3, 0x1e, 0x83, 0x5f, 0x0e, 0x55,
-  0x7f, 0xe2, 0xfe, 0x0d, 0x20, 0x66, 0x4c, 0xd9, 0xc1, 0x08, 0x34, 0xb0,
-  0x83, 0x02, 0x4b, 0xa6, 0x76, 0x04, 0x80, 0xf0, 0xa9, 0xd2, 0x16, 0x74,
-  0xb6, 0x1c, 0x59, 0xac, 0xc5, 0xb0, 0x4d, 0xf0, 0x10, 0x00, 0xea, 0xe1,
-  0x4d, 0xe7, 0x2e, 0x16, 0xe9, 0x89, 0x27, 0xc4, 0xc0, 0x7c, 0x0e, 0x2e,
-  0x9a, 0x10, 0x01, 0x70, 0x0b, 0x1e, 0x09, 0x60, 0x4e, 0xe2, 0xeb, 0x6f,
-  0x6a, 0x69, 0x80, 0xb3, 0xa7, 0xc7, 0x0c, 0x56, 0x6c, 0x2b, 0x64, 0x1e,
-  0xe6, 0xeb, 0xbd, 0xc3, 0xb2, 0xc0, 0x15, 0xff, 0x3c, 0x48, 0xf8, 0x83,
-  0xee, 0x95, 0x04, 0xd6, 0xdd, 0x20, 0x0e, 0x78, 0x2e, 0xfe, 0x8a, 0x99,
-  0x60, 0xd6, 0x32, 0xaf, 0xb1, 0x13, 0xa5, 0xc6, 0xeb, 0xa3, 0x1b, 0xb6,
-  0x33, 0x0d, 0xf0, 0x6e, 0x5d, 0xdb, 0xb1, 0x7e, 0xdc, 0xa0, 0xf8, 0x01,
-  0x6f, 0x11, 0x63, 0xdb, 0x4f, 0x5a, 0x26, 0xc7, 0xb2, 0xb4, 0x47, 0x45,
-  0x5f, 0xa6, 0x06, 0x59, 0x28, 0x78, 0x2d, 0x01, 0x04, 0x7f, 0x06, 0x04,
-  0xb5, 0xec, 0x4d, 0x9a, 0x1a, 0x05, 0x4b, 0x94, 0x25, 0xb5, 0xb9, 0xae,
-  0x04, 0x4b, 0xf0, 0xf7, 0xff, 0xd1, 0x49, 0x74, 0x0b, 0x8b, 0x3e, 0xde,
-  0x4b, 0x68, 0x16, 0x05, 0x97, 0xdd, 0x75, 0x0b, 0x34, 0x2a, 0x8a, 0x83,
-  0xd6, 0x13, 0x2a, 0xf3, 0xfe, 0x8b, 0x3d, 0x50, 0xef, 0xb6, 0x6c, 0x0a,
-  0xc3, 0xff, 0xe9, 0x3a, 0xe0, 0x75, 0xe9, 0x8b, 0xd9, 0xf8, 0x80, 0x39,
-  0x3d, 0x75, 0xe2, 0x6f, 0x15, 0xf3, 0xa6, 0x87, 0xcb, 0xe2, 0x75, 0xd9,
-  0x47, 0xf1, 0x2c, 0xeb, 0x1d, 0x59, 0xf9, 0x35, 0x8a, 0x46, 0xbb, 0x93,
-  0x8c, 0xc2, 0x0e, 0x39, 0x25, 0xb1, 0x1e, 0xc5, 0xe9, 0x29, 0x9f, 0x91,
-  0x62, 0x9e, 0x8b, 0x14, 0xbd, 0xe8, 0x0f, 0x07, 0x59, 0xe0, 0x07, 0xc1,
-  0xff, 0xcc, 0x07, 0x00, 0x0b, 0xcf, 0x0f, 0x1e, 0x8b, 0x17, 0x8e, 0x87,
-  0xd2, 0x0e, 0x8b, 0x15, 0x6f, 0xba, 0x83, 0x4c, 0x04, 0x0a, 0xe1, 0x35,
-  0x1a, 0x79, 0x85, 0x18, 0xed, 0x1f, 0x07, 0x55, 0x4b, 0xff, 0x5d, 0x9c,
-  0x9c, 0x56, 0x1e, 0x06, 0x8e, 0x5e, 0xbb, 0xfa, 0x29, 0x8f, 0x04, 0xcd,
-  0x8f, 0x44, 0x06, 0x6d, 0x05, 0x08, 0xb2, 0x02, 0x0e, 0xc2, 0x0c, 0x13,
-  0xf6, 0x0c, 0x01, 0x89, 0x2b, 0xdb, 0x89, 0x31, 0x89, 0x6d, 0x37, 0x89,
-  0xa1, 0x3d, 0xb2, 0x6d, 0x1f, 0x4a, 0x50, 0xbc, 0xf8, 0x2c, 0x00, 0x58,
-  0x15, 0x60, 0x92, 0xc0, 0x44, 0xb2, 0xe5, 0x06, 0xcc, 0x04, 0x88, 0x34,
-  0x8f, 0x0e, 0x07, 0x84, 0x45, 0x5b, 0x0f, 0xc2, 0xc3, 0xeb, 0x06, 0x2a,
-  0x85, 0xa2, 0x50, 0x80, 0xc7, 0x82, 0x2d, 0x57, 0xc5, 0x58, 0x7e, 0xb0,
-  0xac, 0x57, 0xba, 0x81, 0x36, 0xf6, 0x37, 0x85, 0x84, 0xf8, 0xd5, 0x4a,
-  0x98, 0xc0, 0xbe, 0xab, 0xfa, 0x41, 0xaa, 0x47, 0x3b, 0x35, 0x23, 0x7f,
-  0xa5, 0xe5, 0x9c, 0x81, 0xf6, 0x42, 0x9a, 0x1d, 0x05, 0xc1, 0x18, 0x48,
-  0x0a, 0x43, 0x79, 0xec, 0x92, 0x25, 0x80, 0x4d, 0xc4, 0x80, 0xdb, 0xed,
-  0xb4, 0x42, 0x7f, 0x91, 0x0a, 0xa4, 0x08, 0x44, 0x53, 0x65, 0x50, 0x05,
-  0x2e, 0x44, 0xff, 0x99, 0x10, 0x22, 0x61, 0x22, 0x03, 0x61, 0x06, 0xa2,
-  0x65, 0x0a, 0x01, 0xbf, 0x3c, 0x83, 0xfb, 0x24, 0x77, 0x58, 0x02, 0x1d,
-  0x83, 0x2c, 0x60, 0x53, 0x15, 0x91, 0xbf, 0x30, 0x0e, 0x0b, 0xc9, 0x7d,
-  0x11, 0xa0, 0x80, 0xea, 0x49, 0x0b, 0x17, 0x29, 0x2d, 0x47, 0xc1, 0xf7,
-  0xd9, 0xdf, 0xcd, 0xd9, 0x00, 0x8d, 0x76, 0xde, 0xff, 0xe3, 0x0f, 0x91,
-  0x2b, 0xd2, 0xf7, 0xf3, 0x91, 0x01, 0xbf, 0x18, 0x14, 0x46, 0xe3, 0x09,
-  0xeb, 0xbd, 0xf1, 0x0d, 0xc3, 0x0a, 0x53, 0xbd, 0xf5, 0x8d, 0x4e, 0xde,
-  0xbf, 0x28, 0x03, 0xce, 0xfc, 0x4e, 0x8a, 0xfe, 0x04, 0x2c, 0x0a, 0x73,
-  0x04, 0x04, 0x3a, 0xb6, 0x56, 0x02, 0x17, 0x96, 0xaa, 0xe2, 0x85, 0xef,
-  0xfe, 0xb5, 0xaa, 0x63, 0xa0, 0x8a, 0x11, 0x41, 0x99, 0x0c, 0x1c, 0x26,
-  0x2d, 0x5c, 0x83, 0x06, 0x73, 0xda, 0x92, 0xe4, 0x05, 0x2d, 0xbc, 0x52,
-  0x08, 0xd4, 0x2a, 0x17, 0x67, 0xb0, 0x61, 0x6c, 0xa4, 0x5e, 0x18, 0xa0,
-  0x61, 0xb7, 0xc4, 0x22, 0xa6, 0xd6, 0x44, 0x19, 0x32, 0x44, 0x56, 0x08,
-  0x2f, 0x7d, 0x52, 0x7e, 0x4b, 0x24, 0xe4, 0x1f, 0xdb, 0xdf, 0x8c, 0x41,
-  0x42, 0xea, 0xa8, 0x24, 0x32, 0x43, 0x04, 0x09, 0x68, 0x7f, 0xfc, 0xf3,
-  0xa5, 0x73, 0x01, 0xa4, 0x70, 0x70, 0x41, 0xa1, 0x64, 0x1f, 0xea, 0x4e,
-  0x06, 0xe0, 0x07, 0x2f, 0xc2, 0xfc, 0xf7, 0xc7, 0x4d, 0x0e, 0x04, 0x6e,
-  0xd7, 0xaa, 0x49, 0xdd, 0x2c, 0xf3, 0xab, 0xba, 0x2b, 0xaa, 0x5f, 0xa4,
-  0x11, 0xc2, 0xd9, 0xb1, 0x6b, 0xae, 0x04, 0x04, 0x05, 0x62, 0x03, 0x0c,
-  0xfb, 0x1e, 0x04, 0xb4, 0x3c, 0x10, 0x5b, 0xc3, 0xd1, 0x68, 0x30, 0xfe,
-  0xc1, 0x39, 0x0d, 0x75, 0x2b, 0xf9, 0xc9, 0x2b, 0xd2, 0xb4, 0x40, 0x42,
-  0xa8, 0x60, 0x75, 0x37, 0x3a, 0xd3, 0xa5, 0xf2, 0x81, 0x00, 0x8b, 0x90,
-  0x22, 0xa5, 0x85, 0x07, 0x88, 0x0b, 0xd7, 0xb0, 0x11, 0x7f, 0x01, 0x74,
-  0x7a, 0xa1, 0xc6, 0x4a, 0x21, 0x68, 0x82, 0xbb, 0xe5, 0xa9, 0x80, 0x4c,
-  0xe6, 0xa3, 0xcd, 0xf4, 0xe2, 0xfd, 0x60, 0xa0, 0xf4, 0x98, 0xf8, 0x59,
-  0x58, 0xd1, 0x22, 0xd6, 0x84, 0x21, 0xd1, 0x80, 0x66, 0xbf, 0xe7, 0x24,
-  0x15, 0x36, 0x3e, 0xf0, 0xdb, 0x0f, 0x29, 0x26, 0x81, 0x0d, 0xcf, 0x6a,
-  0x44, 0xdf, 0x66, 0xc0, 0x7d, 0x13, 0xe9, 0xb1, 0xbb, 0x00, 0x56, 0x04,
-  0x74, 0xea, 0x23, 0xb8, 0x50, 0x9b, 0x16, 0xfd, 0xe9, 0xd4, 0xa3, 0x00,
-  0xb6, 0xbb, 0x6c, 0x46, 0xee, 0xeb, 0x17, 0x28, 0x10, 0x35, 0x78, 0x41,
-  0x9c, 0x28, 0x6a, 0x02, 0xf7, 0xa0, 0xfb, 0xb5, 0x56, 0x67, 0xf2, 0x84,
-  0x00, 0xbf, 0x16, 0x7c, 0x53, 0x73, 0x4b, 0x2f, 0x77, 0x3b, 0xfd, 0x76,
-  0xee, 0xfc, 0xa9, 0x6f, 0xfb, 0x1e, 0x81, 0xce, 0x00, 0x20, 0x51, 0xad,
-  0x80, 0x09, 0xeb, 0x25, 0xff, 0x00, 0x26, 0x95, 0x3b, 0x6f, 0x22, 0x75,
-  0x18, 0xfd, 0x53, 0x4e, 0x5d, 0x0a, 0x19, 0x02, 0x6b, 0x93, 0x0e, 0x5a,
-  0x5a, 0x00, 0x9e, 0x19, 0x14, 0xc6, 0x93, 0x0e, 0xf6, 0x22, 0xbf, 0x3a,
-  0xd8, 0xf7, 0xfe, 0x75, 0xff, 0x7c, 0x1d, 0xe8, 0x27, 0x03, 0x3b, 0x32,
-  0x00, 0x10, 0x04, 0xfe, 0xc7, 0xd6, 0x81, 0xe2, 0xff, 0xda, 0x6d, 0xd0,
-  0x80, 0xf8, 0x59, 0x97, 0xd4, 0xb0, 0x96, 0xde, 0xb8, 0x3c, 0x68, 0x07,
-  0x6c, 0x93, 0xf7, 0xc1, 0x46, 0x86, 0x85, 0xf8, 0xb6, 0x02, 0x07, 0x04,
-  0x58, 0x02, 0xd0, 0x00, 0x37, 0xd7, 0xb1, 0xf0, 0x22, 0x6f, 0x17, 0x0a,
-  0xc1, 0xb4, 0x86, 0x3d, 0x72, 0xb8, 0x1a, 0xfd, 0x01, 0xe8, 0x81, 0xe6,
-  0xc4, 0x95, 0xed, 0xf8, 0x0d, 0x9d, 0xdc, 0x89, 0x87, 0x46, 0xd0, 0x14,
-  0xfb, 0x8a, 0xa5, 0xfc, 0x4b, 0x30, 0xea, 0x78, 0x49, 0x1e, 0xc1, 0x72,
-  0x0d, 0x84, 0xbb, 0xa9, 0x2b, 0xa8, 0x8c, 0xb9, 0x5d, 0x60, 0x1e, 0xce,
-  0x86, 0xe6, 0x53, 0x29, 0x47, 0x80, 0x2b, 0x54, 0xed, 0x62, 0x91, 0x86,
-  0xfe, 0xc0, 0x4c, 0x2e, 0xde, 0x06, 0xde, 0xfc, 0xac, 0x2e, 0x32, 0xed,
-  0x2d, 0x3c, 0x0d, 0x1a, 0xa2, 0xaa, 0xde, 0xee, 0x1c, 0xe2, 0xf0, 0x0d,
-  0x77, 0x7a, 0xee, 0xdd, 0x6c, 0xfd, 0x50, 0xf3, 0x4a, 0x3b, 0xfb, 0x5b,
-  0x07, 0xfc, 0x8a, 0x0f, 0x78, 0xaa, 0x3b, 0xfb, 0x01, 0xf1, 0x46, 0xe7,
-  0xd8, 0x20, 0x20, 0xa5, 0x20, 0x85, 0x1b, 0x5a, 0xab, 0x51, 0x75, 0xf3,
-  0x52, 0xfc, 0x31, 0x8e, 0xcf, 0x81, 0x8f, 0x5b, 0xeb, 0x2b, 0xfb, 0x97,
-  0xdf, 0x2e, 0x3f, 0x90, 0xb7, 0xb7, 0xd0, 0x70, 0xd4, 0xfb, 0x5d, 0x11,
-  0x20, 0xa6, 0x36, 0xfc, 0x87, 0xb7, 0x82, 0x61, 0x72, 0xff, 0x06, 0x3c,
-  0x7a, 0x77, 0x02, 0x2c, 0x20, 0xaa, 0xa0, 0x0a, 0xdc, 0x50, 0x4f, 0x97,
-  0x42, 0x64, 0x5c, 0x2c, 0x0f, 0x7e, 0x0c, 0x6f, 0x2b, 0x0e, 0x80, 0x3d,
-  0x14, 0xbf, 0xca, 0xe8, 0x42, 0xf6, 0x04, 0x41, 0x57, 0x76, 0x7d, 0x05,
-  0x24, 0xdf, 0x88, 0x05, 0xaa, 0x05, 0x6a, 0xce, 0xc6, 0x5a, 0x9e, 0x46,
-  0x8d, 0x0c, 0xe2, 0x80, 0x3f, 0x5c, 0xef, 0xf9, 0x3f, 0x2f, 0x74, 0x21,
-  0x6f, 0x10, 0x5c, 0x46, 0x56, 0x6f, 0x1a, 0x98, 0x05, 0xc0, 0x17, 0xdb,
-  0x61, 0x22, 0xfa, 0xfa, 0x62, 0x80, 0x3c, 0xf2, 0x04, 0x5a, 0x62, 0xa6,
-  0xbb, 0x62, 0x1c, 0x21, 0x91, 0xae, 0x7c, 0x0c, 0x51, 0xad, 0xb5, 0x34,
-  0xb9, 0x0a, 0x05, 0xb6, 0x35, 0x04, 0x18, 0x0f, 0x08, 0xe8, 0x63, 0x32,
-  0xf4, 0xde, 0x4a, 0xd6, 0xaf, 0xc8, 0xc6, 0x54, 0xff, 0xa8, 0xc2, 0x04,
-  0x46, 0x86, 0xec, 0x80, 0x27, 0x68, 0x37, 0x37, 0x79, 0x1a, 0xd4, 0xad,
-  0x0e, 0x5a, 0x01, 0x4d, 0x2a, 0x40, 0x58, 0x0b, 0x08, 0x3f, 0x29, 0xbf,
-  0x43, 0xea, 0xca, 0x33, 0xf6, 0x30, 0xbe, 0xf2, 0x75, 0x08, 0xa8, 0x6f,
-  0xdc, 0x1c, 0xb8, 0xfa, 0xc9, 0x1b, 0x69, 0x93, 0xb6, 0xca, 0x03, 0x00,
-  0x69, 0x9d, 0x5f, 0x5a, 0x10, 0x82, 0xe5, 0x51, 0xd5, 0x1f, 0x17, 0xfe,
-  0xe8, 0x25, 0x05, 0x00, 0x05, 0x64, 0x08, 0xc8, 0xec, 0x0e, 0x01, 0x70,
-  0xe9, 0x16, 0x20, 0x73, 0xfe, 0x08, 0x54, 0x83, 0xb7, 0x63, 0xfe, 0x0a,
-  0x49, 0x02, 0xdc, 0xfd, 0x1c, 0x2b, 0x3e, 0xbb, 0xb8, 0x52, 0x4b, 0xdc,
-  0x70, 0x60, 0xf9, 0x12, 0x88, 0xde, 0x57, 0x4e, 0xf7, 0x56, 0x5e, 0xbc,
-  0x66, 0x3e, 0x93, 0xc4, 0xfe, 0x21, 0x33, 0xf6, 0xc0, 0x00, 0x4b, 0x76,
-  0x3b, 0x24, 0x17, 0x57, 0x91, 0x4b, 0x93, 0x9f, 0xd8, 0x9b, 0x00, 0x1d,
-  0x5c, 0x5c, 0x9c, 0x81, 0xe1, 0xb0, 0x68, 0x7e, 0x36, 0x86, 0x05, 0x8f,
-  0xc7, 0x4a, 0x96, 0x25, 0xa5, 0xb1, 0x71, 0xd9, 0x54, 0xb4, 0x0a, 0x3a,
-  0x6c, 0xa5, 0x8a, 0x2a, 0xbc, 0x02, 0x19, 0x72, 0xb5, 0x39, 0x46, 0x5a,
-  0x55, 0xc2, 0x0c, 0x5d, 0x0a, 0xc6, 0x32, 0x2a, 0xce, 0x73, 0x15, 0xed,
-  0x0e, 0x80, 0xbf, 0xb0, 0x5c, 0x3b, 0xad, 0x0c, 0x15, 0x96, 0x00, 0x46,
-  0x2d, 0xab, 0x7a, 0x23, 0x8e, 0x5a, 0x7b, 0x33, 0x12, 0x83, 0xf2, 0x62,
-  0xdb, 0x4e, 0x57, 0xa7, 0x1b, 0x3a, 0x8d, 0x2f, 0xa8, 0x35, 0xf4, 0xb6,
-  0x09, 0x5c, 0x04, 0xdb, 0x01, 0x0e, 0xe9, 0xd2, 0x22, 0xff, 0x4b, 0x08,
-  0xcd, 0x0c, 0xcb, 0x96, 0x4f, 0x1c, 0x92, 0xfe, 0x19, 0x6f, 0x36, 0x8c,
-  0x01, 0x8b, 0x38, 0x76, 0x8c, 0x54, 0x05, 0xe0, 0x5c, 0x06, 0x90, 0xa3,
-  0x62, 0xfc, 0x47, 0xad, 0x8b, 0xd7, 0xc4, 0x32, 0xc0, 0xc2, 0xa9, 0x5e,
-  0xa8, 0x8d, 0x75, 0xff, 0x39, 0x65, 0xe2, 0x0a, 0x6f, 0xb3, 0x2b, 0xf9,
-  0x87, 0xf7, 0x4a, 0xbb, 0x2f, 0x29, 0x81, 0xa4, 0x18, 0xc0, 0xf1, 0x44,
-  0x92, 0xc0, 0x6b, 0x4b, 0x63, 0xa6, 0xfc, 0xce, 0x82, 0xd8, 0x6b, 0xe5,
-  0xf7, 0x3e, 0x37, 0x33, 0x26, 0x25, 0x13, 0xb9, 0x8b, 0x68, 0x54, 0xbe,
-  0x1e, 0x5d, 0xff, 0x2b, 0xc3, 0xc2, 0x2e, 0xd9, 0x2a, 0x0b, 0x79, 0x60,
-  0xf3, 0x76, 0x95, 0x23, 0x42, 0x31, 0xe7, 0x7f, 0x58, 0xb9, 0x7a, 0x61,
-  0xe2, 0xac, 0x8a, 0x1d, 0xef, 0x17, 0x1c, 0xae, 0x74, 0xf6, 0xc6, 0x3a,
-  0xc5, 0xf4, 0xe7, 0x3a, 0xc1, 0xff, 0x3a, 0xdd, 0x72, 0x07, 0x3a, 0xd9,
-  0x77, 0x03, 0xdb, 0x80, 0xeb, 0x0a, 0xc3, 0xde, 0x74, 0xdd, 0x63, 0x04,
-  0xd5, 0x25, 0xb6, 0x3a, 0xfc, 0x60, 0x20, 0xde, 0xac, 0xd0, 0x48, 0x5f,
-  0xca, 0x7d, 0x51, 0x53, 0x74, 0x76, 0xc8, 0xe3, 0x1d, 0x5d, 0xb5, 0x86,
-  0xbe, 0x22, 0x2b, 0xd9, 0x8b, 0xcb, 0xc2, 0xb0, 0x7d, 0x32, 0xe4, 0x8a,
-  0xfc, 0x84, 0xb4, 0x22, 0x66, 0x2d, 0x2c, 0xbd, 0x32, 0xc2, 0x62, 0xd7,
-  0x97, 0xb8, 0x36, 0x03, 0xaa, 0xcc, 0xbc, 0x03, 0x37, 0xc8, 0x41, 0x1e,
-  0x1e, 0xf8, 0xdc, 0x15, 0x8a, 0xc6, 0x4d, 0xea, 0x8a, 0xfb, 0xc2, 0xd4,
-  0x10, 0x86, 0xe0, 0x08, 0x9b, 0x04, 0x04, 0xfc, 0x90, 0x27, 0x14, 0x40,
-  0x27, 0xaa, 0x12, 0xbc, 0x31, 0x96, 0x47, 0xa3, 0xa8, 0x9f, 0xb1, 0xec,
-  0x50, 0x0d, 0xfb, 0xea, 0x36, 0x46, 0x57, 0xe7, 0xb7, 0x96, 0xa1, 0x2d,
-  0xba, 0x5f, 0xc3, 0x36, 0x5f, 0xb1, 0x47, 0xfe, 0x4e, 0xec, 0xf8, 0x75,
-  0x2f, 0x53, 0x51, 0x52, 0x28, 0x58, 0x0d, 0x6a, 0x5b, 0x4c, 0xf8, 0x05,
-  0xe2, 0x50, 0x1f, 0x4e, 0x56, 0x0a, 0x53, 0xd3, 0xba, 0x36, 0x01, 0xcf,
-  0x40, 0x01, 0x7e, 0xed, 0xee, 0x8d, 0xbe, 0x1c, 0xa9, 0x07, 0x66, 0x75,
-  0x5b, 0xc3, 0xaf, 0x23, 0x0a, 0x40, 0x0c, 0xe6, 0xe4, 0x02, 0xb0, 0x38,
-  0xac, 0xdf, 0x40, 0x12, 0x3c, 0x25, 0x74, 0x11, 0x60, 0x50, 0xf8, 0x7f,
-  0xee, 0xe8, 0xac, 0xdf, 0x9b, 0xe9, 0xe9, 0xee, 0x03, 0xf7, 0x89, 0x76,
-  0xf0, 0xac, 0x18, 0x5c, 0xe7, 0x2a, 0xa5, 0xaa, 0xed, 0x89, 0x4e, 0xf2,
-  0x02, 0x1b, 0x60, 0x4e, 0x82, 0xf5, 0xb4, 0x83, 0x15, 0x0d, 0x4a, 0xf6,
-  0x47, 0x66, 0x61, 0x01, 0xac, 0x0f, 0x70, 0x8b, 0xd0, 0xa1, 0x2a, 0x69,
-  0x85, 0xbf, 0x23, 0x60, 0x73, 0x13, 0x8a, 0x9f, 0x82, 0x69, 0x2d, 0x09,
-  0xa0, 0x17, 0x29, 0xb8, 0x73, 0xa1, 0x03, 0xf8, 0xca, 0xd5, 0xe9, 0x97,
-  0x5e, 0x87, 0xfd, 0x00, 0x77, 0x94, 0xdc, 0x00, 0xbb, 0x5a, 0xeb, 0xd0,
-  0x0a, 0xe6, 0xed, 0xe7, 0x02, 0xeb, 0xc5, 0x8b, 0xe2, 0x4a, 0x71, 0xf5,
-  0x2b, 0xbf, 0xa5, 0x88, 0x56, 0xf5, 0xeb, 0xb5, 0x4b, 0x8d, 0xfe, 0x85,
-  0xdf, 0x19, 0x77, 0x1b, 0x20, 0xb5, 0x05, 0xdf, 0xeb, 0xa7, 0x1d, 0x4d,
-  0x00, 0x63, 0x14, 0x29, 0x76, 0x13, 0x08, 0xb5, 0xdf, 0x3c, 0x93, 0xe9,
-  0x4c, 0x03, 0x0d, 0x5a, 0x36, 0xa9, 0x8b, 0x5c, 0x53, 0x85, 0x37, 0x20,
-  0x02, 0x73, 0xb6, 0x12, 0xe3, 0x79, 0x8b, 0x68, 0x5e, 0x4f, 0x0b, 0xac,
-  0x6d, 0xb5, 0x75, 0xdb, 0x6f, 0xff, 0x16, 0x04, 0xdb, 0x75, 0xd7, 0x0c,
-  0xf6, 0xf3, 0xfe, 0xc5, 0xe9, 0x62, 0xf0, 0x73, 0xca, 0xb5, 0x6b, 0x7c,
-  0x0e, 0x41, 0x00, 0xbe, 0xd0, 0x92, 0x2c, 0x30, 0x98, 0xef, 0x34, 0x77,
-  0x19, 0xb5, 0x02, 0xc1, 0x87, 0x46, 0xfd, 0xcc, 0xd1, 0xd1, 0xe0, 0xad,
-  0xbb, 0x03, 0x6f, 0x01, 0x03, 0xc2, 0x01, 0x6e, 0x10, 0xe9, 0x33, 0xc6,
-  0x3b, 0x9b, 0xd9, 0x1b, 0xf6, 0x72, 0x74, 0xb5, 0x06, 0xd1, 0x3d, 0x2b,
-  0x1d, 0x63, 0xb8, 0x10, 0xe9, 0x65, 0x03, 0x20, 0x82, 0x4a, 0xbb, 0xa9,
-  0xef, 0xe9, 0xf0, 0x59, 0xff, 0xb7, 0x08, 0x6e, 0xe0, 0xb7, 0x0a, 0xef,
-  0x03, 0x10, 0xb3, 0xe9, 0x02, 0x8a, 0xda, 0x09, 0xec, 0x9b, 0xc7, 0xfb,
-  0x16, 0xb1, 0xb6, 0x04, 0xfa, 0xcf, 0xa5, 0xeb, 0x10, 0x6b, 0x1d, 0x15,
-  0x73, 0xfa, 0x01, 0x33, 0x10, 0xe1, 0x99, 0x47, 0x47, 0x51, 0x6e, 0x06,
-  0xd4, 0xae, 0x10, 0x9a, 0x6d, 0x0f, 0x15, 0xcd, 0x0e, 0x17, 0xe1, 0x8d,
-  0x7e, 0xbb, 0xa9, 0xa0, 0x2f, 0x96, 0x94, 0x2b, 0x83, 0x88, 0x9a, 0xed,
-  0x1f, 0x94, 0x4e, 0xf8, 0xf4, 0xe3, 0x1a, 0x83, 0xf9, 0x6d, 0x82, 0x15,
-  0x7a, 0xcb, 0xfc, 0xb5, 0xb2, 0x30, 0x4b, 0x19, 0xb2, 0x8d, 0x20, 0x2b,
-  0xff, 0xe8, 0x09, 0xfe, 0xe2, 0xf9, 0xe9, 0x49, 0xfe, 0x75, 0x8e, 0x04,
-  0x52, 0x47, 0xea, 0x8a, 0xc7, 0x5a, 0xac, 0x8a, 0x0d, 0xb4, 0x56, 0xbd,
-  0xf4, 0x45, 0xf6, 0x16, 0xb6, 0xa3, 0x56, 0xba, 0xc4, 0xd2, 0x0b, 0xc4,
-  0xf1, 0x4b, 0xe9, 0xfc, 0x7b, 0x8b, 0x6c, 0x9b, 0x5d, 0xba, 0x07, 0x30,
-  0x7e, 0x36, 0xff, 0x37, 0x43, 0x43, 0x89, 0xd7, 0x07, 0x7a, 0x4b, 0x20,
-  0x10, 0x2d, 0x17, 0x8b, 0x0e, 0x31, 0x7f, 0xe8, 0x7b, 0xfd, 0xb0, 0x3a,
-  0xaa, 0x6f, 0x07, 0x5a, 0xe8, 0x72, 0xd0, 0xfd, 0x36, 0xb7, 0xd0, 0x00,
-  0xae, 0x5d, 0x00, 0xdd, 0xfb, 0x42, 0xb1, 0xd3, 0xba, 0xda, 0x5d, 0xcf,
-  0x50, 0x3b, 0xd1, 0xd1, 0x7f, 0xa9, 0xff, 0xda, 0x77, 0x9e, 0x00, 0x4c,
-  0x32, 0xc8, 0x43, 0x7f, 0xb5, 0x34, 0xc1, 0xb9, 0xfd, 0x7a, 0x36, 0x89,
-  0x05, 0x25, 0x2a, 0xd9, 0xe9, 0xb9, 0x1f, 0x6c, 0x64, 0x76, 0x75, 0x0d,
-  0x26, 0xce, 0x3d, 0xa7, 0xe7, 0xf7, 0xeb, 0x0b, 0x36, 0xc4, 0x0c, 0xad,
-  0x55, 0xe3, 0xc0, 0x0b, 0xc7, 0x94, 0x5b, 0x12, 0xbf, 0xff, 0x62, 0x4b,
-  0xe8, 0x33, 0xfd, 0x3b, 0x4e, 0xf6, 0x1a, 0x28, 0xde, 0xea, 0xf6, 0xeb,
-  0x7d, 0xc9, 0x3b, 0x72, 0x0d, 0x3b, 0x60, 0x03, 0xb9, 0x01, 0x1b, 0x5b,
-  0x51, 0xfa, 0x8d, 0x5e, 0xbb, 0x53, 0x52, 0xea, 0x9f, 0x23, 0x25, 0x98,
-  0x0d, 0x06, 0xa9, 0x43, 0x0c, 0x40, 0x09, 0x4a, 0xca, 0xe0, 0x47, 0xb7,
-  0x73, 0x07, 0x05, 0x41, 0x08, 0x5f, 0xda, 0x1d, 0xb1, 0x06, 0x88, 0x02,
-  0xdc, 0x70, 0x18, 0xb2, 0x01, 0xf8, 0xfc, 0x7e, 0x11, 0xe8, 0xd6, 0xfc,
-  0x1b, 0xbb, 0x3d, 0xfd, 0x2d, 0x75, 0x01, 0x49, 0x2b, 0xd1, 0x4a, 0x3a,
-  0x08, 0x34, 0x50, 0x2c, 0x23, 0xf5, 0x7b, 0xe4, 0x14, 0xc4, 0x05, 0xb1,
-  0x2b, 0x6e, 0x11, 0x37, 0xbb, 0xf2, 0x00, 0x4f, 0x8d, 0x26, 0xef, 0x1b,
-  0xe9, 0xfc, 0x4d, 0xf1, 0x7e, 0x11, 0xdb, 0xdd, 0xb8, 0x05, 0x6a, 0xed,
-  0x3d, 0x05, 0x8d, 0x75, 0xc6, 0xfb, 0x66, 0xfb, 0x80, 0xfc, 0x6f, 0xc3,
-  0x41, 0x07, 0x62, 0x53, 0x7f, 0x44, 0x51, 0xf2, 0xd6, 0x42, 0x1b, 0x11,
-  0xc0, 0x78, 0xde, 0xb9, 0xfc, 0x58, 0x75, 0x11, 0x1b, 0x7c, 0x40, 0x4b,
-  0xbb, 0x4b, 0x46, 0x02, 0x7d, 0x7a, 0x1c, 0x5a, 0x98, 0x03, 0x51, 0x1a,
-  0x9d, 0xaa, 0x0c, 0x4b, 0xc0, 0xb0, 0xff, 0x20, 0xe8, 0x65, 0xfc, 0x4b,
-  0x3b, 0xd9, 0x7f, 0xba, 0xf6, 0x12, 0x40, 0x26, 0x29, 0xc1, 0xb0, 0x30,
-  0xa2, 0xf4, 0x6c, 0xef, 0xfb, 0xe8, 0x52, 0x43, 0xb5, 0x75, 0xdf, 0x9e,
-  0x27, 0x2b, 0xca, 0x2b, 0xda, 0x81, 0x26, 0xe2, 0x6d, 0x3c, 0x8b, 0xe1,
-  0x08, 0x3c, 0x20, 0xdb, 0x40, 0x4b, 0xd8, 0x07, 0xff, 0x26, 0xac, 0xe8,
-  0x2f, 0xfc, 0x49, 0x4b, 0x87, 0xee, 0xca, 0xe3, 0x07, 0x2f, 0xc2, 0x24,
-  0xfc, 0xe4, 0xba, 0x0a, 0x12, 0xb5, 0x4a, 0xa9, 0x17, 0x94, 0x0e, 0x03,
-  0xaa, 0x34, 0x39, 0x5b, 0x4d, 0x0b, 0xeb, 0xdb, 0x7e, 0x09, 0x57, 0x5d,
-  0x63, 0x01, 0x77, 0x22, 0xe9, 0x41, 0xfc, 0x0c, 0x39, 0x12, 0x72, 0x64,
-  0x0b, 0x90, 0xa1, 0x1f, 0x70, 0x05, 0x0d, 0xe5, 0x2a, 0x4b, 0xfd, 0x03,
-  0x5b, 0x46, 0x26, 0x0a, 0xa6, 0x33, 0x77, 0x8d, 0x07, 0x74, 0xa8, 0x26,
-  0x86, 0x99, 0x1a, 0xb1, 0x9a, 0xfa, 0xf0, 0xef, 0xf9, 0xb0, 0x25, 0xe8,
-  0xb5, 0xae, 0xfb, 0x02, 0xd2, 0x75, 0xf8, 0x8b, 0xad, 0x27, 0xb7, 0x7d,
-  0x66, 0xb0, 0xfb, 0xb6, 0x07, 0xf7, 0xea, 0x20, 0xc9, 0xfa, 0x83, 0xee,
-  0x31, 0x30, 0xbf, 0x5e, 0x19, 0xd2, 0x03, 0xd2, 0x4e, 0xff, 0xd2, 0x0e,
-  0xd2, 0x7c, 0xd2, 0x89, 0xd2, 0xc7, 0xff, 0xd2, 0xce, 0xd2, 0xd3, 0xd2,
-  0x37, 0xd2, 0xfc, 0xff, 0xd2, 0xda, 0xd2, 0xde, 0xd2, 0xe2, 0xd2, 0x78,
-  0xff, 0xd3, 0x24, 0xd4, 0xc8, 0xd3, 0xe8, 0xd3, 0x5e, 0xd8, 0xd5, 0x9a,
-  0x01, 0xf8, 0x29, 0xd2, 0x2f, 0xd2, 0x8c, 0x3c, 0x6a, 0x48, 0x30, 0x23,
-  0x7e, 0x50, 0xa1, 0xe9, 0x4a, 0x5a, 0x94, 0x4e, 0x5d, 0xb9, 0x4a, 0x6a,
-  0x05, 0x6e, 0x5e, 0x16, 0xeb, 0x4a, 0x25, 0xe8, 0x90, 0x04, 0xf1, 0xa0,
-  0xe8, 0x02, 0x72, 0x35, 0x1e, 0x37, 0x3a, 0xe3, 0x5a, 0xc4, 0x52, 0xb9,
-  0xdb, 0xc5, 0xd9, 0xfc, 0xd0, 0x3b, 0xf7, 0x04, 0xba, 0x91, 0xc1, 0x48,
-  0x6f, 0x85, 0xf0, 0x03, 0xf8, 0xfd, 0x14, 0x78, 0x3e, 0x17, 0x88, 0xa5,
-  0xeb, 0xf1, 0x3b, 0xba, 0xda, 0x03, 0xbe, 0x4a, 0x8c, 0xdb, 0x3b, 0xc3,
-  0xb7, 0xb3, 0xfa, 0xec, 0xf7, 0xd0, 0xc8, 0x72, 0xfb, 0x04, 0x7f, 0x73,
-  0xfb, 0xa5, 0xfb, 0xe2, 0xf1, 0xeb, 0xb0, 0x1f, 0x10, 0x18, 0xad, 0xdb,
-  0x52, 0xd8, 0x0d, 0x2f, 0x8b, 0xc3, 0xb7, 0xab, 0x20, 0xe1, 0xfc, 0xa8,
-  0x1f, 0x4b, 0xaf, 0x42, 0xca, 0x5f, 0x08, 0x74, 0x13, 0x40, 0xa8, 0xc8,
-  0x32, 0x2e, 0xf2, 0xcc, 0xf2, 0xa9, 0xa6, 0x50, 0x81, 0x6d, 0xe8, 0x0f,
-  0x50, 0x4b, 0x95, 0xc0, 0x10, 0x58, 0xf9, 0xc4, 0x59, 0xf2, 0x78, 0x59,
-  0x0e, 0x51, 0x17, 0x1b, 0xeb, 0x16, 0x70, 0x06, 0x21, 0xd0, 0xaf, 0x0e,
-  0x07, 0x96, 0x02, 0x06, 0x7b, 0x03, 0x63, 0x5a, 0xd8, 0xea, 0x65, 0xf9,
-  0xb8, 0xe3, 0x01, 0xad, 0x39, 0x3d, 0x8d, 0x0e, 0xdf, 0x94, 0x10, 0x4a,
-  0xb8, 0x37, 0x04, 0x74, 0x69, 0x0b, 0xc9, 0x74, 0xab, 0x65, 0x55, 0xf6,
-  0x75, 0x1c, 0x0d, 0xe2, 0x79, 0x0a, 0xb3, 0x16, 0xed, 0x83, 0xcf, 0x0c,
-  0x1f, 0x68, 0x0d, 0x05, 0x56, 0x97, 0xdb, 0x83, 0xf7, 0x6a, 0x7c, 0x50,
-  0x59, 0xa2, 0xd9, 0xa0, 0x75, 0x65, 0xdf, 0x8c, 0xd2, 0xd1, 0xd6, 0xd1,
-  0xd7, 0x52, 0x7c, 0x8a, 0xa5, 0xbf, 0xff, 0x04, 0x3b, 0xf3, 0x72, 0x05,
-  0x2b, 0xf3, 0x1b, 0xfe, 0xfd, 0x40, 0xe2, 0xe7, 0x5b, 0xf7, 0xc3, 0x2e,
-  0x92, 0x55, 0x2a, 0xd5, 0xa1, 0xe8, 0x6d, 0xeb, 0x0b, 0x44, 0xcc, 0xc0,
-  0x4d, 0x10, 0x74, 0x79, 0xca, 0x2e, 0xb6, 0xf7, 0xf3, 0xd7, 0x66, 0x20,
-  0x6d, 0x01, 0x92, 0xda, 0xff, 0xeb, 0xed, 0x5b, 0x0e, 0x53, 0x80, 0xf9,
-  0x10, 0xc2, 0x73, 0x10, 0x18, 0xff, 0xd3, 0xe0, 0xd3, 0xe2, 0xf6, 0xd9,
-  0x80, 0xe9, 0xc1, 0x10, 0xd3, 0x9e, 0x7e, 0xd3, 0xcb, 0x80, 0xe9, 0x10,
-  0xdb, 0x1f, 0xc0, 0x11, 0x6c, 0xcb, 0x20, 0x98, 0xda, 0x6b, 0xcd, 0xea,
-  0x20, 0x3e, 0xe3, 0x0b, 0xc3, 0x4e, 0xd2, 0xdf, 0x13, 0xcb, 0x07, 0x0e,
-  0x06, 0x04, 0x88, 0x25, 0x60, 0xa0, 0xd1, 0xa6, 0xfc, 0x3e, 0xf6, 0x13,
-  0xc9, 0x0d, 0xed, 0xb3, 0x1f, 0x6d, 0x41, 0xd8, 0x72, 0xf4, 0x8b, 0xb6,
-  0x3d, 0x83, 0x17, 0x1f, 0x72, 0x0e, 0xf4, 0x3b, 0x1e, 0xcc, 0x4b, 0x2e,
-  0xe9, 0xe8, 0x42, 0x6d, 0xe8, 0x03, 0xde, 0x8e, 0xc3, 0x39, 0x1e, 0xca,
-  0xdc, 0x10, 0x23, 0x8b, 0x4b, 0xa4, 0xf6, 0x51, 0xaa, 0x70, 0x5b, 0x52,
-  0x36, 0x1e, 0x41, 0xbb, 0x38, 0x3b, 0x36, 0x13, 0x94, 0xb4, 0x55, 0xde,
-  0xaa, 0x25, 0x5e, 0xc7, 0x47, 0x02, 0xa3, 0xe7, 0x12, 0x0c, 0x36, 0x8b,
-  0xa3, 0xd7, 0x15, 0x0b, 0x75, 0xa3, 0xce, 0x4b, 0xb8, 0xdb, 0x19, 0xeb,
-  0x37, 0xb3, 0xff, 0x0f, 0xbe, 0x3b, 0x3b, 0x18, 0x6f, 0x8b, 0x04, 0xa8,
-  0x01, 0xf1, 0x75, 0x0f, 0x03, 0x07, 0x0b, 0x0b, 0x3f, 0xad, 0x03, 0xe4,
-  0x52, 0x44, 0xb5, 0x2e, 0xdb, 0x5f, 0x32, 0x00, 0x0d, 0xd6, 0x9b, 0xb5,
-  0x1b, 0xbd, 0xea, 0xc3, 0x01, 0x07, 0x28, 0xd5, 0xd0, 0x33, 0x4a, 0x7c,
-  0xad, 0x43, 0xa0, 0x8b, 0xa5, 0x84, 0xab, 0xdf, 0x73, 0x76, 0x89, 0x3e,
-  0x49, 0xb6, 0x3b, 0x04, 0xda, 0x2d, 0x04, 0x2d, 0x8c, 0xa8, 0xc3, 0x5b,
-  0x19, 0x4b, 0xaa, 0x7b, 0xc3, 0x8b, 0x36, 0x06, 0x50, 0xcd, 0x8f, 0xec,
-  0x6b, 0x12, 0x2b, 0x5b, 0x02, 0x5d, 0x6b, 0x1b, 0x2c, 0x7f, 0x89, 0x77,
-  0x04, 0xc3, 0x89, 0x1e, 0x2e, 0x89, 0x5f, 0xd9, 0x29, 0x5f, 0x58, 0xce,
-  0xd1, 0x44, 0x75, 0xd8, 0x52, 0x42, 0x03, 0xfe, 0x72, 0x36, 0x25, 0xfe,
-  0xff, 0x3d, 0xdd, 0xe5, 0x73, 0x03, 0x7e, 0x89, 0x3e, 0xca, 0xdf, 0x44,
-  0x74, 0x1f, 0x8b, 0x1e, 0x35, 0xdb, 0xdf, 0xc1, 0xd3, 0x39, 0x07, 0x73,
-  0x1a, 0xb7, 0x8b, 0x33, 0x3b, 0xda, 0xf6, 0x75, 0xf5, 0xe8, 0x66, 0xf3,
-  0xf6, 0x21, 0xe8, 0x8a, 0x04, 0xf2, 0x1c, 0xe8, 0x1c, 0xc4, 0x17, 0xd5,
-  0xf3, 0x13, 0x37, 0x06, 0xc6, 0x08, 0x39, 0xe2, 0x37, 0x73, 0xe9, 0xb6,
-  0x18, 0xff, 0xde, 0x9f, 0xc3, 0x05, 0x04, 0x1d, 0x11, 0x17, 0x6b, 0x0e,
-  0x48, 0xf4, 0xea, 0x5b, 0x5b, 0x25, 0x34, 0x46, 0x09, 0x06, 0xf0, 0xb6,
-  0x0d, 0x4b, 0x6b, 0x58, 0x18, 0x76, 0xdb, 0x53, 0x0a, 0xcc, 0x40, 0x01,
-  0xde, 0x70, 0x74, 0x14, 0xad, 0xb0, 0x94, 0x94, 0xca, 0x37, 0x50, 0x58,
-  0x40, 0x89, 0x4a, 0xa0, 0x15, 0xe6, 0xbb, 0x40, 0xc3, 0x5b, 0x3b, 0x6c,
-  0xc3, 0x26, 0xe4, 0x19, 0x19, 0x16, 0x6d, 0xa1, 0x21, 0x85, 0x89, 0x46,
-  0x61, 0x28, 0x73, 0x58, 0x5b, 0x29, 0x72, 0xf3, 0xc5, 0x03, 0x37, 0xa9,
-  0xcb, 0x48, 0x5a, 0x16, 0x0b, 0x96, 0xc2, 0x37, 0xb4, 0x8f, 0x10, 0xa1,
-  0x10, 0x04, 0x6d, 0xec, 0x40, 0xc4, 0x51, 0x50, 0x6d, 0x11, 0x5b, 0xae,
-  0x3c, 0xe6, 0xad, 0x1f, 0x3e, 0x82, 0xfc, 0x18, 0x7b, 0x5b, 0xf4, 0x0c,
-  0x77, 0x1f, 0x56, 0x83, 0xe9, 0x87, 0x05, 0xe1, 0x14, 0x37, 0xca, 0x24,
-  0xfe, 0x5b, 0x47, 0x61, 0x29, 0xa4, 0x9b, 0x32, 0xc2, 0xad, 0x83, 0x0f,
-  0x06, 0x19, 0xe5, 0x77, 0x35, 0x0e, 0xe2, 0x15, 0x8c, 0xad, 0x68, 0xd1,
-  0xdd, 0x03, 0xc3, 0x88, 0x6e, 0x95, 0xe9, 0x10, 0x6d, 0xe5, 0xfb, 0xa1,
-  0x65, 0x4d, 0x7e, 0x02, 0x2b, 0xd0, 0x29, 0x17, 0x1a, 0x87, 0xf2, 0x17,
-  0x71, 0x02, 0x42, 0xd0, 0x89, 0x15, 0xdd, 0x48, 0xdf, 0xe8, 0x37, 0xb7,
-  0x56, 0xd9, 0x93, 0x06, 0x56, 0x48, 0x7e, 0xd3, 0x08, 0x19, 0x3a, 0x73,
-  0x37, 0x1a, 0x3f, 0x2d, 0x3b, 0x31, 0x8b, 0x0f, 0x89, 0x49, 0x75, 0x5a,
-  0x5a, 0x0d, 0x5f, 0xb7, 0xe2, 0x66, 0xfa, 0x08, 0x0b, 0x64, 0xba, 0x2f,
-  0x3b, 0xca, 0x72, 0xee, 0x0c, 0x77, 0x05, 0x32, 0xa8, 0xeb, 0x95, 0xa3,
-  0x70, 0x8f, 0x8d, 0x61, 0x68, 0xd0, 0xd6, 0x21, 0x69, 0xe9, 0x65, 0xfe,
-  0x64, 0x46, 0x1a, 0xc1, 0x90, 0x2e, 0x0a, 0x5b, 0x5d, 0x89, 0xdc, 0xba,
-  0x96, 0x92, 0x85, 0x9b, 0x5f, 0xf7, 0xe3, 0xd0, 0xe3, 0x05, 0xbe, 0xd6,
-  0xe6, 0x03, 0xc1, 0x96, 0xdd, 0x09, 0x03, 0xd6, 0xbc, 0x16, 0xff, 0x26,
-  0xe0, 0x37, 0xe8, 0x8f, 0x06, 0xd4, 0xb6, 0x4b, 0x03, 0xd6, 0x6f, 0xd8,
-  0x4b, 0x2e, 0x8c, 0xe3, 0x1e, 0x82, 0xda, 0x79, 0x61, 0xda, 0x25, 0x7e,
-  0x3e, 0xdc, 0x4b, 0xfc, 0x8e, 0x8a, 0x8d, 0x84, 0xe0, 0xbe, 0x80, 0x00,
-  0xd0, 0xc7, 0x2f, 0x68, 0x40, 0x8c, 0xc5, 0xe3, 0x87, 0xd6, 0x93, 0x12,
-  0x45, 0x50, 0xb4, 0x87, 0x46, 0xca, 0xca, 0x58, 0x40, 0x90, 0x17, 0xd7,
-  0x72, 0x11, 0x68, 0x20, 0x50, 0xc4, 0xba, 0x34, 0xb1, 0x7f, 0x1f, 0x75,
-  0xe3, 0x6e, 0xe0, 0x80, 0xf1, 0x7f, 0x0d, 0xff, 0x6c, 0xe9, 0x40, 0x75,
-  0x06, 0x8b, 0x1b, 0x07, 0xf8, 0xfc, 0x72, 0x5c, 0x8b, 0xe7, 0x06, 0x1f,
-  0x1b, 0x81, 0x51, 0xa5, 0x49, 0x00, 0x6f, 0x21, 0xaa, 0x8e, 0xdd, 0xf6,
-  0x87, 0xf2, 0x87, 0xd9, 0x9f, 0xb6, 0xc4, 0x43, 0x14, 0x92, 0x5b, 0xbf,
-  0x07, 0xf6, 0x72, 0x40, 0xe8, 0x12, 0x06, 0xc0, 0xf9, 0xc0, 0xe4, 0x59,
-  0xe8, 0x0d, 0xb1, 0x09, 0x75, 0xa3, 0xa6, 0x09, 0x6a, 0xe4, 0x9a, 0x25,
-  0x42, 0x01, 0x99, 0xb4, 0x01, 0x43, 0x2b, 0xf4, 0x10, 0x7f, 0xf9, 0xe3,
-  0x15, 0xac, 0x49, 0x2c, 0xfe, 0x22, 0x74, 0x0f, 0x04, 0x22, 0x3c, 0x5c,
-  0x0d, 0x0a, 0x56, 0x1c, 0xc2, 0x22, 0x9a, 0xb4, 0x10, 0x6f, 0x97, 0xc3,
-  0xe9, 0xe2, 0xfd, 0x26, 0x59, 0x03, 0xca, 0x2e, 0x8e, 0xff, 0xb0, 0x1e,
-  0xd0, 0x4b, 0x43, 0x03, 0x8e, 0xdb, 0x8b, 0xfa, 0xec, 0x2b, 0xeb, 0x72,
-  0xe6, 0xdf, 0xc1, 0x89, 0x2e, 0xd2, 0x4b, 0x8d, 0xe3, 0xd5, 0x8d, 0x76,
-  0x85, 0xe0, 0xc5, 0x02, 0x36, 0x6f, 0xbe, 0xe0, 0xfa, 0x74, 0xf0, 0x01,
-  0x35, 0x25, 0x00, 0x8d, 0x2e, 0x8b, 0xd3, 0xdf, 0x8b, 0x77, 0xff, 0x36,
-  0xd8, 0x03, 0x36, 0xf8, 0xa1, 0xdf, 0x3d, 0xa3, 0x82, 0x00, 0xa1, 0x6f,
-  0x32, 0xa3, 0x84, 0x00, 0x0a, 0x12, 0x14, 0x0c, 0x75, 0xd5, 0x0e, 0xbc,
-  0xe7, 0x51, 0xe8, 0x20, 0x51, 0xca, 0x05, 0x26, 0x7d, 0x85, 0x1e, 0xf5,
-  0x6b, 0x37, 0xe9, 0x56, 0x66, 0xd3, 0xfc, 0xc9, 0x36, 0x12, 0x06, 0xd8,
-  0x34, 0x8c, 0x2a, 0xd8, 0x10, 0xfd, 0xef, 0x12, 0x07, 0xa3, 0xde, 0x4b,
-  0x04, 0x57, 0x3d, 0xf5, 0x55, 0x26, 0x33, 0x3e, 0x97, 0x89, 0x3f, 0x16,
-  0x8c, 0x02, 0x15, 0x0b, 0x15, 0x4d, 0x9d, 0xf4, 0x0a, 0xf6, 0x16, 0x79,
-  0xa1, 0xdd, 0x1e, 0xa3, 0x86, 0x2d, 0x4a, 0x00, 0x93, 0x00, 0x02, 0xdd,
-  0xe3, 0xbe, 0x05, 0x10, 0xcf, 0xeb, 0xc4, 0x84, 0x9f, 0xda, 0x95, 0xdb,
-  0x65, 0x1e, 0xbf, 0x05, 0x54, 0x75, 0xff, 0x72, 0x62, 0x6f, 0x20, 0x43,
-  0x2b, 0x2b, 0x20, 0x97, 0x2d, 0x6f, 0x70, 0xf1, 0x79, 0x72, 0x69, 0x67,
-  0x04, 0x6f, 0x5a, 0x31, 0x39, 0x39, 0xff, 0x30, 0x20, 0x42, 0x6f, 0x72,
-  0x6c, 0x61, 0x6e, 0xff, 0x64, 0x20, 0x49, 0x6e, 0x74, 0x6c, 0x2e, 0x00,
-  0xff, 0x4e, 0x75, 0x6c, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6f, 0x0c, 0x65,
-  0x72, 0x20, 0xff, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x2f,
-  0x0d, 0x0a, 0x44, 0xfd, 0x69, 0x76, 0x69, 0x64, 0x65, 0x20, 0xb6, 0x15,
-  0x72, 0x2f, 0xb7, 0x0d, 0x41, 0x62, 0xb7, 0x6e, 0x06, 0x6d, 0x61, 0x73,
-  0x2a, 0x0e, 0x7e, 0x67, 0x72, 0x61, 0x6d, 0x20, 0xeb, 0x2e, 0x6d, 0x34,
-  0x60, 0x61, 0x5d, 0x65, 0x6f, 0x6e, 0xaf, 0x1d, 0x74, 0x65, 0x01, 0x5e,
-  0xa2, 0xca, 0x56, 0x0f, 0x07, 0x25, 0xbf, 0x73, 0x02, 0x54, 0x52, 0xc5,
-  0x55, 0x45, 0xb1, 0x28, 0x4e, 0xbd, 0x12, 0x41, 0x4c, 0x53, 0xc3, 0x08,
-  0x19, 0x47, 0x1c, 0x6d, 0x44, 0x5f, 0x0c, 0xff, 0x4c, 0x4f, 0x57, 0x5f,
-  0x34, 0x47, 0x42, 0x5f, 0x6f, 0x17, 0x54, 0x31, 0x36, 0x7b, 0x20, 0x1a,
-  0x0b, 0xfb, 0x41, 0x42, 0x4f, 0x52, 0x54, 0x16, 0x09, 0xec, 0x4d, 0x42,
-  0x52, 0x0f, 0x0f, 0x43, 0x48, 0xfb, 0x45, 0x43, 0x4b, 0x45, 0x58, 0x5e,
-  0x6c, 0x41, 0x15, 0x26, 0x4f, 0xdd, 0x3c, 0x52, 0x53, 0x8f, 0x0a, 0x44,
-  0x45, 0x4c, 0xda, 0x5f, 0x4e, 0x06, 0xdb, 0x0f, 0x47, 0x20, 0x03, 0xfb,
-  0x46, 0x4c, 0x41, 0x47, 0x5f, 0x88, 0x7c, 0x43, 0x54, 0x4f, 0x52, 0x8b,
-  0x0e, 0x6d, 0x42, 0x27, 0x60, 0x20, 0x76, 0x4d, 0x0b, 0xd8, 0x4f, 0x0f,
-  0x1e, 0x52, 0x45, 0xd9, 0x89, 0x4f, 0x09, 0x6d, 0x3d, 0x54, 0xbb, 0x8d,
-  0x4e, 0x59, 0x03, 0x6c, 0x43, 0x16, 0x27, 0x56, 0x45, 0x6d, 0x78, 0x49,
-  0xde, 0x0f, 0x34, 0x00, 0x35, 0x00, 0xde, 0xd0, 0x57, 0x39, 0x35, 0xfb,
-  0x03, 0x42, 0x04, 0xad, 0x38, 0x1e, 0xb1, 0x44, 0x21, 0xb2, 0x58, 0x58,
-  0x5b, 0x75, 0x4e, 0x6f, 0x95, 0x55, 0x6e, 0x6b, 0x0b, 0x74, 0x77, 0xd9,
-  0x6e, 0x20, 0x08, 0x2c, 0x00, 0x18, 0x00, 0x7b, 0x12, 0x32, 0x08, 0x0e,
-  0x36, 0x7a, 0x45, 0x14, 0x38, 0x28, 0xb4, 0x5b, 0xad, 0x64, 0x11, 0x2f,
-  0x4e, 0x54, 0xd8, 0x46, 0x53, 0x2c, 0x7d, 0x33, 0x32, 0x65, 0xac, 0x1f,
-  0x08, 0x27, 0x31, 0x36, 0x3b, 0x35, 0x09, 0x7b, 0x50, 0x60, 0x03, 0xb2,
-  0x36, 0x0f, 0xd9, 0x28, 0x2c, 0x1f, 0x23, 0x61, 0x6c, 0xb2, 0x1f, 0xdd,
-  0x6a, 0x20, 0x70, 0x62, 0xfd, 0x64, 0x31, 0x33, 0x80, 0x0f, 0x79, 0x31,
-  0x36, 0x2d, 0x96, 0x5f, 0xf7, 0x12, 0x3f, 0x63, 0x54, 0x68, 0x78, 0x61,
-  0x22, 0x89, 0x01, 0xe3, 0x22, 0x20, 0x76, 0x7a, 0x6d, 0x75, 0x13, 0x1a,
-  0x70, 0x35, 0x77, 0xff, 0x1a, 0x66, 0x64, 0x69, 0x73, 0x6b, 0xb6, 0x2e,
-  0x0d, 0x69, 0xde, 0x18, 0x66, 0x69, 0x6c, 0xed, 0x17, 0x73, 0x20, 0x1a,
-  0x4b, 0xde, 0x39, 0x6f, 0x66, 0x20, 0x37, 0x9a, 0x6e, 0x67, 0xda, 0x65,
-  0x2e, 0x00, 0x37, 0x92, 0x4f, 0x70, 0x1a, 0xa1, 0x31, 0x9e, 0xc6, 0x20,
-  0x54, 0xaa, 0x0b, 0x5f, 0x5d, 0x16, 0x53, 0xc7, 0x4d, 0x41, 0x37, 0x06,
-  0x9a, 0xda, 0x49, 0x56, 0x84, 0x37, 0x6f, 0x0a, 0x50, 0xda, 0x61, 0x72,
-  0x24, 0xc7, 0x26, 0x6e, 0x75, 0xda, 0x6d, 0x62, 0x29, 0xc8, 0x4b, 0xff,
-  0x20, 0x28, 0x31, 0x2d, 0x34, 0x29, 0x73, 0x51, 0x4f, 0x08, 0x5d, 0x49,
-  0x4f, 0x5a, 0xff, 0x3d, 0x7c, 0xb2, 0x0a, 0x55, 0xfc, 0x00, 0x43, 0x4c,
-  0x45, 0x41, 0xba, 0x0a, 0x4e, 0x5a, 0x7c, 0x64, 0x5d, 0x73, 0x76, 0x65,
-  0x87, 0x55, 0x68, 0xb5, 0x61, 0x56, 0xad, 0x07, 0xe4, 0x6a, 0xe1, 0x77,
-  0x68, 0x39, 0x30, 0x50, 0xa5, 0x88, 0x40, 0xe6, 0xe3, 0x43, 0x55, 0x21,
-  0x3f, 0xda, 0x09, 0xf1, 0x98, 0xac, 0xe9, 0xef, 0x91, 0xd7, 0xf4, 0x45,
-  0x06, 0xe8, 0x55, 0x4d, 0xd4, 0xb7, 0xc1, 0x1c, 0x89, 0x50, 0xb6, 0x8b,
-  0x4d, 0x05, 0xf6, 0x49, 0x4e, 0x46, 0xb9, 0xa7, 0x08, 0x73, 0x03, 0x08,
-  0x5e, 0x32, 0x37, 0xe5, 0x44, 0x49, 0xe3, 0x46, 0x59, 0x00, 0xec, 0xdd,
-  0x04, 0x56, 0x6b, 0x31, 0x27, 0x6f, 0x49, 0x03, 0x6e, 0x0d, 0x51, 0x00,
-  0x30, 0xf1, 0x6f, 0x52, 0x27, 0x1c, 0xeb, 0xc6, 0x67, 0x53, 0xc4, 0x0c,
-  0x3b, 0x5b, 0x08, 0x37, 0x04, 0xdb, 0x54, 0x70, 0x55, 0xb7, 0x53, 0x06,
-  0x57, 0x41, 0x6b, 0x6a, 0x72, 0x6c, 0x53, 0x27, 0xf1, 0x58, 0x00, 0xcd,
-  0xe4, 0x53, 0xda, 0x50, 0x41, 0x19, 0x1b, 0x7c, 0x53, 0x79, 0x6f, 0xc9,
-  0x61, 0x78, 0x20, 0xaf, 0x45, 0x63, 0x61, 0xcd, 0x5b, 0x26, 0x02, 0x18,
-  0x00, 0x46, 0x34, 0x00, 0xc0, 0x2c, 0xdd, 0x0e, 0x50, 0x58, 0xaf, 0x2c,
-  0x2a, 0xb7, 0x14, 0x33, 0x29, 0xae, 0x41, 0xf9, 0x81, 0x66, 0x0a, 0x70,
-  0x67, 0x73, 0xc1, 0x59, 0x65, 0x82, 0x5a, 0x31, 0x63, 0xa3, 0x4d, 0x10,
-  0x5e, 0x23, 0xeb, 0x01, 0x46, 0x1b, 0xb8, 0x00, 0x20, 0x25, 0xd8, 0x95,
-  0x00, 0x76, 0x79, 0x1e, 0x52, 0x34, 0xba, 0x75, 0x94, 0x69, 0xb1, 0x1d,
-  0x70, 0x92, 0x41, 0x05, 0x3c, 0xb6, 0x7a, 0x46, 0x73, 0xde, 0x9d, 0x63,
-  0x69, 0x66, 0xf6, 0x23, 0x7b, 0x56, 0xca, 0x38, 0x24, 0x4a, 0xfb, 0x95,
-  0x0b, 0x95, 0x3d, 0x08, 0x78, 0xc4, 0x70, 0xdb, 0x52, 0x6d, 0x3a, 0x6c,
-  0x79, 0x3f, 0x06, 0x23, 0x37, 0xe3, 0x25, 0x6c, 0xfe, 0x64, 0x29, 0x20,
-  0x6d, 0x75, 0x73, 0x74, 0xe0, 0xe6, 0x68, 0x25, 0x5b, 0x62, 0x34, 0x30,
-  0x56, 0x71, 0xb0, 0x22, 0x18, 0x74, 0xeb, 0x8a, 0x65, 0xfb, 0x5a, 0x4a,
-  0x15, 0x30, 0x2a, 0x1c, 0x56, 0xa9, 0x1d, 0x86, 0x15, 0x65, 0x48, 0x36,
-  0x73, 0x1c, 0x7d, 0x2c, 0x20, 0x79, 0xac, 0x06, 0x4c, 0xd9, 0x94, 0xc6,
-  0x79, 0xc0, 0x1b, 0x45, 0x26, 0x0a, 0x31, 0x7b, 0xa4, 0x0a, 0xf6, 0x9d,
-  0x44, 0x4f, 0x6a, 0x3e, 0x40, 0x88, 0x76, 0x6f, 0x74, 0x49, 0x61, 0xeb,
-  0x98, 0x85, 0x4b, 0x3c, 0x30, 0xe3, 0xeb, 0xab, 0xf6, 0x0a, 0x4c, 0xe6,
-  0xe1, 0x69, 0x63, 0x0b, 0x52, 0x24, 0x16, 0xe7, 0xcb, 0xca, 0x2c, 0x10,
-  0xac, 0x60, 0x34, 0x1b, 0x47, 0x69, 0x4e, 0x07, 0x56, 0x02, 0x55, 0xb0,
-  0x3d, 0xa4, 0x68, 0xd5, 0x35, 0x64, 0x36, 0xa6, 0x65, 0x77, 0x10, 0x29,
-  0x3b, 0x79, 0x2a, 0x58, 0x40, 0x10, 0xaf, 0x8d, 0x6e, 0x26, 0x72, 0x63,
-  0xdb, 0x2f, 0x70, 0x81, 0x20, 0xb7, 0x40, 0x61, 0x44, 0x65, 0x66, 0x44,
-  0x82, 0x86, 0xca, 0x45, 0x06, 0x0a, 0x30, 0x54, 0xd3, 0x0e, 0xb0, 0x3d,
-  0x59, 0x2d, 0x02, 0x9c, 0x18, 0x09, 0x91, 0xb0, 0x62, 0x81, 0x7a, 0x34,
-  0x74, 0x4c, 0x93, 0x4b, 0x73, 0x0a, 0xcb, 0x3c, 0x11, 0x73, 0x4a, 0x1e,
-  0xb8, 0x46, 0x69, 0x78, 0xf0, 0x07, 0x33, 0xd6, 0x04, 0x42, 0xce, 0x3b,
-  0x53, 0x74, 0x38, 0x46, 0x42, 0xb4, 0x36, 0x25, 0x21, 0x53, 0x0a, 0x08,
-  0x22, 0x04, 0x2c, 0xbf, 0x37, 0x31, 0x32, 0xb9, 0xd9, 0x18, 0x08, 0xf6,
-  0xb9, 0x1c, 0x14, 0xb0, 0x18, 0x9c, 0x00, 0x3c, 0x5b, 0xfa, 0x3e, 0x6d,
-  0x12, 0x68, 0xa9, 0x7c, 0x79, 0x53, 0x73, 0xc6, 0x61, 0xc5, 0xa1, 0x79,
-  0x5b, 0x99, 0x3b, 0x68, 0x21, 0xcb, 0x5f, 0x61, 0x23, 0x2d, 0xc3, 0x76,
-  0xba, 0x20, 0x77, 0xdf, 0x22, 0x68, 0x20, 0x27, 0x2d, 0xb5, 0x27, 0xb0,
-  0xbd, 0xba, 0x27, 0x2f, 0x27, 0x80, 0x2e, 0x3c, 0x27, 0x3a, 0x27, 0x4c,
-  0x45, 0x99, 0x77, 0xcc, 0x12, 0x1e, 0x03, 0x92, 0x2c, 0x25, 0x87, 0x1a,
-  0x20, 0x4c, 0x97, 0x1d, 0x14, 0xa1, 0x75, 0x8c, 0x42, 0x16, 0xb0, 0x28,
-  0xb1, 0x92, 0x2c, 0x93, 0x77, 0x4a, 0x94, 0x8f, 0x33, 0x08, 0x31, 0x81,
-  0x9b, 0x20, 0x62, 0x0a, 0x7b, 0xd2, 0x68, 0xc2, 0x58, 0x35, 0x63, 0x05,
-  0xda, 0x44, 0x05, 0x4a, 0xe3, 0x61, 0x64, 0x79, 0x0d, 0x30, 0x92, 0x99,
-  0x0c, 0xd7, 0x56, 0xc2, 0x56, 0x0c, 0x07, 0x5c, 0x9b, 0xe1, 0xf8, 0xf7,
-  0xa4, 0x67, 0x96, 0x35, 0x08, 0x6d, 0x23, 0x63, 0xe0, 0x32, 0x40, 0xc0,
-  0xc5, 0xdd, 0x19, 0x61, 0x62, 0x6c, 0x85, 0x44, 0x6a, 0x50, 0x15, 0xb0,
-  0xa3, 0x2e, 0xa0, 0xfa, 0xd5, 0x1a, 0x2b, 0x1f, 0x0b, 0x09, 0x63, 0xa0,
-  0x22, 0x61, 0x11, 0x8b, 0x57, 0x37, 0xa5, 0x87, 0xd3, 0x66, 0x59, 0xbd,
-  0x92, 0x85, 0x56, 0x37, 0x43, 0xca, 0x5e, 0x74, 0x93, 0x30, 0xbd, 0x61,
-  0x6d, 0xad, 0xc4, 0xce, 0x05, 0x35, 0x68, 0xb0, 0xbc, 0xad, 0x6d, 0x04,
-  0x78, 0xa2, 0x25, 0xc7, 0xb7, 0x70, 0x74, 0x17, 0xb9, 0xb6, 0x73, 0x74,
-  0xc8, 0x0e, 0xc3, 0x73, 0x01, 0x17, 0x51, 0xbb, 0x91, 0x00, 0x39, 0x00,
-  0x75, 0x00, 0x3b, 0x81, 0x96, 0xaf, 0x53, 0x18, 0xa6, 0x4a, 0x1c, 0x08,
-  0x28, 0x81, 0x51, 0x2a, 0xee, 0x59, 0x13, 0xb0, 0x22, 0x48, 0x1b, 0x22,
-  0xa1, 0x08, 0xd8, 0x23, 0xb0, 0x79, 0x96, 0x0c, 0x1d, 0x3b, 0x84, 0x79,
-  0x89, 0x38, 0x10, 0xd7, 0xff, 0x63, 0xee, 0x0b, 0x66, 0xdc, 0x61, 0xc2,
-  0x6c, 0x50, 0x80, 0x80, 0x6c, 0x73, 0x23, 0x60, 0x4b, 0x41, 0xab, 0x27,
-  0x2b, 0x56, 0x23, 0x10, 0xb0, 0x74, 0x20, 0xd5, 0x95, 0x6b, 0xb0, 0x5e,
-  0x22, 0xd0, 0xec, 0x27, 0x57, 0x20, 0x15, 0x65, 0xfb, 0x6e, 0x5d, 0x20,
-  0x15, 0x80, 0x76, 0x43, 0x52, 0x04, 0x48, 0x04, 0x8b, 0xa5, 0x81, 0x5d,
-  0x12, 0x2d, 0xf6, 0x47, 0xc1, 0x2b, 0x4f, 0x01, 0x60, 0x5d, 0x44, 0x80,
-  0xf6, 0x21, 0xb6, 0x10, 0x1a, 0x9d, 0x7c, 0x84, 0x57, 0x06, 0xa4, 0xbf,
-  0xd8, 0x59, 0x40, 0x60, 0x3c, 0xf9, 0xec, 0x5e, 0x20, 0x90, 0x49, 0x41,
-  0x12, 0xc0, 0x69, 0x83, 0x04, 0x86, 0x89, 0x04, 0x0e, 0x08, 0xa4, 0x0e,
-  0xaa, 0x04, 0xb6, 0x30, 0x64, 0xc7, 0xcc, 0x77, 0x13, 0x06, 0xda, 0x6f,
-  0x70, 0x1c, 0x0f, 0x8e, 0x74, 0x0a, 0x63, 0x18, 0x9a, 0x70, 0x22, 0xf5,
-  0xf6, 0x2e, 0xce, 0x72, 0xfb, 0x74, 0x17, 0x77, 0x1a, 0xa9, 0xf1, 0x16,
-  0x21, 0x6d, 0x44, 0xb0, 0x44, 0x02, 0x6d, 0x46, 0xc0, 0xab, 0x65, 0x21,
-  0xb0, 0x00, 0x20, 0xbd, 0xe4, 0x49, 0x53, 0x4b, 0x8b, 0x0e, 0x0a, 0x06,
-  0x56, 0xd8, 0x26, 0x73, 0x9e, 0x20, 0x00, 0xad, 0xb2, 0xab, 0x33, 0xb3,
-  0x40, 0x37, 0x5c, 0x25, 0x2d, 0x32, 0xb5, 0x30, 0x5b, 0x95, 0x00, 0xed,
-  0x25, 0x34, 0x16, 0x6d, 0x1e, 0x57, 0xd7, 0xf2, 0x74, 0x71, 0x76, 0x42,
-  0x79, 0x3a, 0x12, 0xdb, 0x42, 0x0c, 0x61, 0x6f, 0x0a, 0x45, 0x2e, 0x20,
-  0xd5, 0x52, 0x65, 0xbe, 0xa3, 0x73, 0x6e, 0x79, 0x64, 0xd8, 0x4c, 0x0a,
-  0x0c, 0x3e, 0x1b, 0x3a, 0x09, 0x98, 0x45, 0x02, 0xd6, 0x2a, 0xbe, 0xc4,
-  0x73, 0xe2, 0x7c, 0x9e, 0x2e, 0x61, 0xe7, 0xc9, 0xc3, 0x6d, 0x6d, 0x6f,
-  0x39, 0xbe, 0x2e, 0x2e, 0x2f, 0x93, 0x58, 0x60, 0x2e, 0x70, 0x65, 0xf1,
-  0x9a, 0x73, 0xe2, 0x7a, 0x97, 0x85, 0x6d, 0x70, 0xb9, 0x75, 0x35, 0x8f,
-  0x29, 0x3f, 0x20, 0x5b, 0x82, 0x2f, 0x4e, 0x05, 0x5d, 0xf4, 0x28, 0x7c,
-  0xf9, 0x70, 0x2d, 0x23, 0x79, 0xe8, 0x2a, 0xe6, 0x2a, 0x2e, 0xee, 0x6c,
-  0x70, 0x63, 0x0d, 0xa5, 0x6d, 0x42, 0x58, 0x60, 0x31, 0x36, 0x65, 0x73,
-  0xa9, 0x19, 0x5a, 0x0a, 0xce, 0x84, 0x66, 0xd0, 0x11, 0x0a, 0xfc, 0x8e,
-  0x17, 0xb7, 0x63, 0x34, 0x73, 0x3a, 0x62, 0x5c, 0xbd, 0x37, 0xf6, 0x53,
-  0x46, 0x3e, 0xb5, 0x1b, 0xec, 0x51, 0x2f, 0xa5, 0x1d, 0x86, 0x72, 0xbd,
-  0x75, 0xc5, 0xc2, 0xbc, 0xd6, 0xdf, 0x39, 0xda, 0x72, 0x9b, 0xc0, 0xc7,
-  0xc6, 0xfd, 0xb3, 0xbe, 0xc3, 0x45, 0x6e, 0x97, 0xb6, 0x41, 0x65, 0x01,
-  0xa7, 0x31, 0xc1, 0x55, 0xbb, 0x16, 0x25, 0x60, 0xbd, 0x3a, 0xc1, 0x25,
-  0xb3, 0x9a, 0xd9, 0xe1, 0xe4, 0xe2, 0x53, 0x1e, 0xe8, 0x2f, 0x24, 0x8e,
-  0x42, 0x26, 0x15, 0xde, 0x58, 0x5b, 0xfa, 0xf3, 0x6f, 0x1d, 0x5c, 0xfe,
-  0x9b, 0x20, 0x4c, 0x42, 0x41, 0x03, 0x47, 0x2d, 0x88, 0xee, 0x64, 0x81,
-  0x20, 0x56, 0x20, 0x32, 0x6c, 0xb1, 0x5d, 0xc3, 0x6c, 0x01, 0x96, 0x02,
-  0xe0, 0xfe, 0x4e, 0x0a, 0x11, 0xa0, 0x1a, 0xe5, 0x3f, 0xfa, 0x5b, 0x2c,
-  0xf7, 0x31, 0x30, 0x30, 0x5d, 0x0f, 0xa3, 0x96, 0x9a, 0xf7, 0xd6, 0x8d,
-  0x7f, 0x20, 0x97, 0x05, 0x3a, 0x3c, 0x7d, 0x29, 0x3e, 0x98, 0x1f, 0x60,
-  0x8b, 0x4c, 0x1d, 0xd4, 0x13, 0x3e, 0x67, 0x23, 0x3e, 0xe6, 0x0f, 0x4e,
-  0x36, 0x23, 0x08, 0xb1, 0x7e, 0x75, 0x50, 0x61, 0x95, 0x7f, 0xb1, 0x49,
-  0x13, 0x62, 0x30, 0x49, 0xb6, 0x00, 0x46, 0xca, 0x49, 0xda, 0x8a, 0x03,
-  0xf5, 0x02, 0x58, 0x4f, 0x83, 0xff, 0x98, 0x99, 0x54, 0x84, 0x02, 0x25,
-  0x87, 0xdf, 0x4f, 0xbd, 0x2c, 0x9b, 0xc2, 0x05, 0x1a, 0xd0, 0x20, 0xc2,
-  0x00, 0x94, 0xa1, 0x77, 0xf7, 0x94, 0xe3, 0x89, 0xa6, 0x5b, 0x3b, 0x2c,
-  0x4a, 0x8d, 0x8e, 0x62, 0x4b, 0x95, 0x6f, 0x52, 0xda, 0xc2, 0x73, 0xc8,
-  0x6c, 0x4d, 0x44, 0x73, 0xd5, 0x77, 0x2d, 0x95, 0x00, 0xdb, 0x41, 0x34,
-  0x6f, 0x1e, 0xa5, 0xe8, 0x83, 0x6c, 0x42, 0x9f, 0x47, 0x77, 0x81, 0x6d,
-  0xc3, 0xc7, 0xc7, 0x41, 0x03, 0x84, 0xc9, 0x76, 0x2f, 0x44, 0xb8, 0xb2,
-  0x0c, 0x41, 0x20, 0x37, 0x23, 0x6a, 0x16, 0x71, 0x62, 0x33, 0xac, 0x6b,
-  0xf6, 0x1e, 0x25, 0xac, 0xfb, 0x82, 0x05, 0x68, 0x53, 0xe6, 0x6d, 0x1b,
-  0x12, 0x33, 0x62, 0x19, 0x5d, 0x88, 0xc9, 0xec, 0x08, 0x88, 0x12, 0xd6,
-  0x92, 0x7f, 0x18, 0x76, 0x3d, 0xb2, 0xb0, 0xb1, 0x37, 0x86, 0x59, 0x3c,
-  0x27, 0xde, 0x3e, 0xb4, 0xd6, 0xa9, 0x91, 0xb0, 0xa5, 0xba, 0x73, 0x25,
-  0x4d, 0x4d, 0xb2, 0x20, 0xf0, 0x57, 0x49, 0x54, 0x48, 0xa1, 0x82, 0x19,
-  0x81, 0xd6, 0x8d, 0x21, 0x75, 0x22, 0x9c, 0x71, 0x24, 0x26, 0x0b, 0x4b,
-  0xd8, 0x71, 0x61, 0xf3, 0x34, 0x96, 0x48, 0x29, 0xf1, 0x05, 0x90, 0x3e,
-  0x36, 0x22, 0x05, 0x02, 0xcc, 0x06, 0x26, 0x2f, 0x9d, 0x04, 0x5e, 0x66,
-  0xc3, 0xfa, 0x6b, 0x49, 0xf6, 0xa3, 0x7b, 0x01, 0xf7, 0x5b, 0x3a, 0x47,
-  0x46, 0x7c, 0xa2, 0x2f, 0x06, 0x1e, 0x59, 0x10, 0x32, 0x35, 0x84, 0xde,
-  0xb8, 0x1f, 0x42, 0x08, 0xb0, 0x1f, 0x9b, 0x7d, 0x8c, 0x03, 0x4d, 0xa5,
-  0x65, 0x4b, 0x5b, 0x4c, 0x48, 0x6b, 0x48, 0x0c, 0x90, 0xc2, 0x46, 0xb1,
-  0x3b, 0xd2, 0x3d, 0x35, 0xb0, 0x0a, 0xbf, 0xf2, 0x28, 0x4d, 0x1a, 0x52,
-  0x8b, 0x4d, 0xab, 0x42, 0xfb, 0x80, 0xd4, 0x02, 0x63, 0xba, 0x88, 0x64,
-  0x29, 0x70, 0xfe, 0x2b, 0x65, 0x3f, 0x9e, 0x5e, 0xb3, 0xa6, 0x7b, 0x2a,
-  0x65, 0x01, 0x03, 0x9b, 0xac, 0xad, 0xde, 0x5a, 0xd6, 0xd6, 0x5d, 0xb1,
-  0xd9, 0x5e, 0xab, 0x12, 0x94, 0xdd, 0x36, 0x42, 0x78, 0x14, 0x42, 0x29,
-  0x6c, 0x22, 0x04, 0x10, 0x38, 0x7c, 0x5d, 0x49, 0x53, 0x59, 0x81, 0x36,
-  0x22, 0xb3, 0x9b, 0x65, 0x3a, 0xb2, 0x36, 0x40, 0x38, 0xb1, 0x07, 0xb0,
-  0x60, 0x6f, 0x4c, 0x41, 0x85, 0x2f, 0x18, 0x6c, 0xaa, 0x6f, 0x5e, 0x69,
-  0x83, 0x98, 0xc0, 0x64, 0x3f, 0x6c, 0x78, 0xd8, 0x3f, 0x5c, 0x53, 0x1c,
-  0xf6, 0xcf, 0xe5, 0x63, 0x75, 0x12, 0xa9, 0xae, 0x92, 0x78, 0x46, 0xc0,
-  0x79, 0xee, 0x2c, 0x4c, 0x75, 0x83, 0x61, 0x91, 0x4c, 0x83, 0x62, 0x05,
-  0x85, 0x4d, 0x85, 0x5d, 0x0a, 0x57, 0xc3, 0x4f, 0x01, 0xe0, 0x6d, 0x66,
-  0x8b, 0x49, 0x48, 0x11, 0x46, 0xa4, 0x50, 0x61, 0x2c, 0x21, 0x87, 0x21,
-  0x86, 0x34, 0x0e, 0xe9, 0x10, 0xfc, 0x9a, 0x2c, 0xc1, 0x6f, 0x60, 0x68,
-  0x38, 0x43, 0x68, 0x0e, 0x77, 0x88, 0x73, 0xc8, 0xe8, 0x5c, 0xa8, 0xcc,
-  0x2b, 0x7b, 0x50, 0x00, 0x02, 0x31, 0x84, 0x48, 0x7d, 0x22, 0x35, 0x22,
-  0x83, 0x91, 0x56, 0x4d, 0xfb, 0x73, 0x10, 0xf6, 0xf8, 0x5f, 0x96, 0x12,
-  0x0b, 0x6b, 0x75, 0x74, 0x5f, 0x81, 0x14, 0x70, 0x4d, 0xe0, 0x07, 0x7f,
-  0xf3, 0x53, 0x77, 0x61, 0x70, 0x59, 0x47, 0xa0, 0xe6, 0x79, 0x47, 0xb6,
-  0xec, 0x72, 0xc2, 0x34, 0xdb, 0x46, 0x73, 0x1c, 0x93, 0x35, 0x60, 0x81,
-  0x48, 0x60, 0xca, 0x68, 0xc6, 0xd9, 0x0d, 0x46, 0xc1, 0x5b, 0x04, 0xb5,
-  0x64, 0x6c, 0xe8, 0x11, 0x3c, 0x36, 0x3c, 0xb5, 0x61, 0x16, 0xd4, 0x6b,
-  0xe7, 0x86, 0xd5, 0x68, 0x90, 0x7a, 0xf7, 0x5b, 0x7b, 0x7b, 0x39, 0x26,
-  0x3a, 0x4b, 0x64, 0x60, 0xcd, 0xdf, 0x07, 0x02, 0xc0, 0x03, 0x52, 0x6a,
-  0xad, 0xc5, 0xc6, 0x9b, 0x22, 0xb8, 0xd7, 0x1a, 0xac, 0x81, 0x25, 0xe8,
-  0xc2, 0x91, 0x5e, 0x61, 0x49, 0x83, 0x15, 0x58, 0x08, 0xc5, 0x5f, 0x38,
-  0x7b, 0x30, 0x0e, 0x3b, 0x53, 0x4b, 0x03, 0x0d, 0x94, 0x31, 0x7b, 0x50,
-  0x2b, 0x03, 0x62, 0x4d, 0x89, 0x85, 0x36, 0x4e, 0x54, 0xf2, 0x54, 0x65,
-  0x73, 0x58, 0x9d, 0xd7, 0x80, 0x4f, 0x61, 0x11, 0x3c, 0x6f, 0x62, 0x2d,
-  0xbd, 0x69, 0x1e, 0x69, 0x2c, 0xae, 0x0c, 0x1e, 0x4f, 0x0e, 0x4a, 0x1e,
-  0x94, 0x12, 0x1d, 0x78, 0x28, 0x73, 0x29, 0x4d, 0x20, 0x17, 0x6b, 0x03,
-  0xd7, 0x90, 0x34, 0x3b, 0x5d, 0x59, 0xf6, 0x63, 0x57, 0x2d, 0x81, 0x47,
-  0x8f, 0xce, 0x09, 0x10, 0x0a, 0x2f, 0x54, 0x19, 0x47, 0xb2, 0x3d, 0xd2,
-  0x4e, 0x06, 0xcb, 0x49, 0x73, 0x1a, 0x86, 0x92, 0x37, 0x68, 0xb8, 0xf0,
-  0x09, 0x8c, 0x71, 0x75, 0x6b, 0xb0, 0x72, 0x22, 0x43, 0x8a, 0xb2, 0xb9,
-  0x71, 0x73, 0x28, 0x0e, 0xc3, 0x85, 0xca, 0xa3, 0x75, 0xc2, 0x18, 0x29,
-  0xf0, 0x0f, 0x5a, 0x8e, 0x87, 0xa7, 0x00, 0x20, 0x0c, 0xb8, 0x0a, 0x00,
-  0x93, 0x64, 0x25, 0x89, 0x73, 0x49, 0xa8, 0x79, 0xc0, 0x5e, 0x36, 0x17,
-  0x88, 0xd4, 0x41, 0x78, 0x01, 0x01, 0x87, 0x60, 0x38, 0xe4, 0x4a, 0x6f,
-  0xaa, 0x30, 0x33, 0x00, 0x78, 0xbb, 0xa6, 0x5e, 0xab, 0x73, 0xa3, 0x0e,
-  0x47, 0x05, 0x4f, 0x6b, 0x03, 0xc9, 0x50, 0xc0, 0x38, 0xea, 0x2a, 0x75,
-  0x54, 0xb3, 0xa9, 0x2b, 0x31, 0x5a, 0x03, 0xd8, 0x10, 0x73, 0x9a, 0xa1,
-  0x76, 0x8c, 0xf0, 0x1a, 0x32, 0x76, 0xdb, 0x82, 0x13, 0x63, 0x68, 0xb6,
-  0x3f, 0x0e, 0x73, 0x2d, 0x70, 0x13, 0xe1, 0xa5, 0x5e, 0x29, 0x1d, 0x84,
-  0x28, 0x0d, 0x59, 0x16, 0x61, 0x6f, 0x79, 0x5d, 0x6b, 0x07, 0x06, 0x71,
-  0x6b, 0x69, 0x1a, 0xc4, 0x14, 0x02, 0x47, 0xed, 0x6e, 0x61, 0x75, 0x22,
-  0xb9, 0x72, 0x18, 0xa8, 0x4b, 0xc6, 0x75, 0x73, 0xdb, 0x09, 0x74, 0x2e,
-  0x85, 0xfb, 0x11, 0x73, 0x75, 0x4d, 0xd1, 0x2b, 0x7c, 0x0d, 0x42, 0x62,
-  0xa6, 0x03, 0xed, 0x69, 0x62, 0x69, 0x87, 0x72, 0x44, 0x18, 0x46, 0x21,
-  0xef, 0x8e, 0x65, 0x46, 0x59, 0x08, 0xf5, 0x1b, 0x2b, 0xad, 0x79, 0x5e,
-  0x0a, 0xca, 0x4c, 0x5c, 0x6b, 0xa5, 0x6d, 0x73, 0x25, 0x32, 0xd8, 0x18,
-  0x4d, 0x2c, 0x8c, 0x3e, 0x6f, 0x57, 0x2f, 0xb9, 0x40, 0xc1, 0x19, 0x1c,
-  0x10, 0x32, 0x50, 0xd7, 0xa1, 0x5c, 0xc0, 0x62, 0xc3, 0x3e, 0x6e, 0x54,
-  0xcc, 0xeb, 0x6c, 0xb0, 0x85, 0x27, 0x8b, 0xb4, 0x1a, 0x2e, 0x46, 0x9d,
-  0x5b, 0x17, 0xe2, 0x00, 0x5d, 0x5e, 0x80, 0xc2, 0x00, 0x2c, 0x0a, 0x1c,
-  0xeb, 0xde, 0x73, 0x37, 0x7b, 0x45, 0x73, 0x63, 0x0b, 0x5a, 0x62, 0xe6,
-  0x44, 0x0f, 0xc6, 0x74, 0x46, 0xa2, 0xf5, 0xee, 0x62, 0x60, 0x8c, 0xf0,
-  0x3a, 0x00, 0x95, 0x01, 0xaa, 0xfd, 0xc1, 0x73, 0x5c, 0x3a, 0x2e, 0x14,
-  0x4a, 0x02, 0x81, 0xc7, 0x5b, 0x02, 0x63, 0x15, 0x56, 0xcc, 0xd8, 0x4e,
-  0x78, 0x55, 0xb0, 0x85, 0xb6, 0x34, 0x41, 0x23, 0x55, 0x6d, 0x71, 0x83,
-  0x13, 0x66, 0x28, 0xc8, 0x08, 0xda, 0xaa, 0x35, 0x2b, 0xa9, 0x15, 0x13,
-  0x31, 0xad, 0xd3, 0xb7, 0xc7, 0x6d, 0x75, 0xcf, 0x25, 0xb4, 0x0a, 0xbf,
-  0x04, 0xfe, 0x42, 0xcd, 0xa9, 0xff, 0x99, 0x3c, 0x45, 0xb9, 0xf4, 0x95,
-  0x02, 0xa0, 0xc1, 0x13, 0x4c, 0x81, 0x05, 0x3c, 0xb5, 0x2c, 0x56, 0x52,
-  0x27, 0x8e, 0x0d, 0x55, 0xf6, 0xa8, 0x20, 0x1e, 0xdd, 0x2d, 0x22, 0x2e,
-  0x60, 0x29, 0x03, 0x59, 0xd8, 0x2d, 0x4e, 0x26, 0x01, 0x85, 0x79, 0xb5,
-  0x2d, 0x02, 0xc8, 0x28, 0x90, 0x73, 0x46, 0xc9, 0xe5, 0x20, 0x63, 0x4c,
-  0x23, 0xc8, 0x27, 0x6c, 0x00, 0x28, 0xd8, 0x4b, 0x5b, 0x0e, 0x6c, 0x20,
-  0x5f, 0x80, 0x38, 0x5b, 0xe0, 0x90, 0x81, 0xd9, 0xaa, 0x43, 0x77, 0x70,
-  0x55, 0x39, 0x7f, 0x70, 0x26, 0x15, 0x46, 0x70, 0xa1, 0xdb, 0xe5, 0x6c,
-  0x09, 0x7b, 0x31, 0x31, 0x2e, 0x02, 0x41, 0x8b, 0xb3, 0x2e, 0x2d, 0x48,
-  0xd6, 0x2d, 0x2e, 0x90, 0x75, 0xa6, 0x0a, 0x70, 0x06, 0x24, 0xd4, 0x66,
-  0x3a, 0x3b, 0xf5, 0xaa, 0xe0, 0x0e, 0xea, 0x57, 0x6e, 0xf7, 0xf4, 0x35,
-  0xa6, 0x57, 0xc0, 0x21, 0x3d, 0xac, 0xbc, 0x0c, 0x86, 0x70, 0x2c, 0xf1,
-  0x77, 0x2d, 0x3e, 0x62, 0x40, 0x5f, 0x8d, 0x5b, 0x5b, 0x70, 0x13, 0x5c,
-  0xf9, 0x5d, 0x2e, 0x48, 0x89, 0xf6, 0x5f, 0x63, 0x79, 0x63, 0xdd, 0x28,
-  0x6e, 0x29, 0x78, 0x2e, 0x04, 0xfa, 0x17, 0x15, 0xbe, 0x25, 0x72, 0xcd,
-  0x1a, 0x90, 0x5d, 0x2c, 0xc5, 0x25, 0x95, 0x00, 0x54, 0x28, 0xcc, 0x35,
-  0x49, 0x9a, 0x23, 0xa8, 0x2d, 0x09, 0xfb, 0x8c, 0x1d, 0xa1, 0x14, 0x95,
-  0xe6, 0x8b, 0x3c, 0x60, 0x54, 0x0f, 0x3a, 0x05, 0xa0, 0x2f, 0x8c, 0x54,
-  0x51, 0x23, 0x42, 0x43, 0xc4, 0x00, 0x58, 0x60, 0x16, 0x20, 0x70, 0x96,
-  0x06, 0x82, 0xab, 0x8c, 0x45, 0xad, 0x29, 0x2a, 0x07, 0xc2, 0xa3, 0x61,
-  0x11, 0x70, 0x0c, 0xdd, 0xa3, 0x73, 0x79, 0x74, 0xf6, 0x6d, 0x5e, 0xd3,
-  0xce, 0x0f, 0x63, 0x8c, 0xd7, 0x10, 0x7e, 0x60, 0x61, 0x6b, 0x9b, 0xd8,
-  0x66, 0x66, 0x1d, 0xcc, 0x2e, 0x68, 0x56, 0x99, 0x2a, 0x19, 0x9f, 0xbc,
-  0x27, 0x46, 0xac, 0x22, 0x9c, 0x48, 0x43, 0x05, 0x30, 0x36, 0xe0, 0x64,
-  0x24, 0x32, 0x31, 0x66, 0x3f, 0xe6, 0x1c, 0x38, 0xc5, 0x46, 0xad, 0xd9,
-  0x90, 0x62, 0x34, 0xcd, 0x78, 0xd6, 0x4c, 0x53, 0x74, 0x62, 0x51, 0x92,
-  0x70, 0x56, 0x29, 0xc8, 0x58, 0x18, 0x60, 0xcc, 0x7e, 0x49, 0x95, 0xdb,
-  0x65, 0x03, 0x77, 0x88, 0x68, 0xd5, 0x99, 0x48, 0x11, 0xde, 0x2e, 0x01,
-  0x0b, 0xfc, 0x16, 0x5b, 0xd6, 0x50, 0x38, 0x60, 0xb0, 0x2e, 0x96, 0x1c,
-  0x18, 0x2c, 0x4c, 0x09, 0x68, 0x1d, 0x42, 0x71, 0x1a, 0x3a, 0xfa, 0xb3,
-  0x00, 0xe0, 0x33, 0x22, 0xca, 0xf6, 0xf5, 0xd4, 0x6b, 0xe1, 0x9f, 0x40,
-  0x70, 0x21, 0xd9, 0x2e, 0x5f, 0x44, 0xb0, 0x34, 0x2d, 0x52, 0xef, 0x18,
-  0x99, 0x4c, 0x1c, 0x5f, 0xe6, 0x62, 0xf9, 0x81, 0x5c, 0xd9, 0x81, 0xab,
-  0x15, 0x25, 0xeb, 0x33, 0xa0, 0x11, 0x61, 0xc2, 0xc4, 0x00, 0x21, 0x33,
-  0x1a, 0x9d, 0x2e, 0x08, 0xfa, 0x1b, 0x82, 0x18, 0x2e, 0x90, 0x4f, 0x29,
-  0x0e, 0x07, 0x10, 0x5c, 0x24, 0x05, 0x92, 0xa8, 0xc2, 0x4c, 0x2d, 0xe7,
-  0xa5, 0x60, 0x4d, 0x05, 0x84, 0x10, 0xa5, 0x4c, 0x42, 0xc8, 0x4b, 0x8d,
-  0xbb, 0x02, 0x6e, 0x2d, 0x94, 0x2a, 0xb0, 0x4d, 0xd0, 0x45, 0xa5, 0x61,
-  0x42, 0x01, 0xe0, 0x6a, 0xa4, 0x13, 0x94, 0x9c, 0x16, 0x2e, 0x00, 0x84,
-  0x5a, 0x71, 0x55, 0x5e, 0x46, 0xf8, 0x71, 0x66, 0x38, 0x42, 0x12, 0x28,
-  0x56, 0x89, 0x86, 0x98, 0x52, 0x63, 0x11, 0xd8, 0x56, 0x48, 0x2f, 0x53,
-  0x65, 0x6d, 0xd0, 0x77, 0x26, 0xc2, 0x8c, 0x51, 0xd9, 0x47, 0x6c, 0x25,
-  0x2e, 0x73, 0x99, 0xaf, 0x1e, 0x45, 0xc2, 0x20, 0x98, 0x72, 0x27, 0x38,
-  0xa9, 0x64, 0xee, 0x35, 0x61, 0xa8, 0x2d, 0xc7, 0xa4, 0x0a, 0x97, 0x2d,
-  0xc8, 0x45, 0x49, 0xf3, 0x84, 0x0d, 0x1d, 0x2b, 0x8d, 0x0d, 0xf9, 0x89,
-  0x36, 0x19, 0x59, 0x04, 0xac, 0x8b, 0x05, 0x8a, 0x1b, 0x0c, 0xa7, 0x2d,
-  0x06, 0xd0, 0x08, 0x0b, 0xf4, 0x2e, 0x53, 0x8e, 0x78, 0xd0, 0x70, 0x20,
-  0x67, 0xfe, 0x00, 0x56, 0x02, 0x3a, 0x50, 0x4c, 0xb2, 0x54, 0xd5, 0x80,
-  0x4d, 0x75, 0x20, 0x61, 0x46, 0x28, 0xce, 0xaf, 0x4f, 0x41, 0x49, 0xbd,
-  0xa4, 0xd3, 0x2d, 0x78, 0xb7, 0xca, 0x53, 0x6e, 0x00, 0x78, 0x8a, 0x20,
-  0x70, 0x9d, 0x42, 0x63, 0x58, 0x8c, 0xf9, 0x6c, 0x65, 0x3a, 0xa3, 0x00,
-  0x98, 0x7e, 0x04, 0x48, 0x09, 0x61, 0x1d, 0xe0, 0x2f, 0x4d, 0xb9, 0x70,
-  0x84, 0x24, 0x6c, 0xa7, 0x06, 0x50, 0x48, 0xb0, 0x25, 0x0c, 0x06, 0xb0,
-  0x60, 0x85, 0x38, 0x4f, 0x87, 0xb8, 0x61, 0x39, 0x48, 0x4d, 0x08, 0x80,
-  0x9f, 0x4b, 0x29, 0xd8, 0x9f, 0x52, 0xf6, 0x1c, 0x9f, 0x15, 0xbd, 0x1d,
-  0x90, 0x9f, 0x5b, 0x39, 0x34, 0x95, 0xdd, 0x8c, 0xeb, 0x60, 0x4d, 0x15,
-  0xa8, 0xc3, 0x35, 0x36, 0x61, 0x63, 0x3d, 0x25, 0x20, 0xc0, 0x6c, 0x13,
-  0x37, 0x2a, 0xa4, 0x4c, 0xde, 0x68, 0x93, 0x38, 0x4e, 0x93, 0x35, 0x19,
-  0xc2, 0x0a, 0x30, 0x58, 0xc4, 0x7b, 0x91, 0x16, 0x11, 0x18, 0x72, 0x88,
-  0xc2, 0x71, 0x50, 0x20, 0xea, 0xa8, 0x41, 0x90, 0x06, 0x06, 0x8c, 0xea,
-  0x3c, 0x25, 0x73, 0x19, 0x8b, 0x56, 0x81, 0x5e, 0x2d, 0x64, 0x95, 0x06,
-  0x2d, 0x64, 0x68, 0xd5, 0x0e, 0x79, 0x54, 0xa0, 0xe8, 0x33, 0x19, 0x1a,
-  0x5f, 0x25, 0x68, 0x12, 0x66, 0xba, 0xd2, 0x3a, 0xe7, 0x85, 0x21, 0x3a,
-  0x84, 0x32, 0xc1, 0x07, 0x90, 0x33, 0x64, 0x34, 0x19, 0x35, 0x06, 0x4d,
-  0x70, 0xf2, 0x35, 0x6d, 0x03, 0x41, 0x7d, 0x14, 0x41, 0x6b, 0x41, 0x9e,
-  0x45, 0x92, 0x27, 0x09, 0x5a, 0x80, 0x70, 0x0c, 0xb7, 0x8d, 0x41, 0x52,
-  0x97, 0x4e, 0x47, 0x21, 0xb2, 0x20, 0xc1, 0x10, 0x4d, 0x3f, 0x73, 0x4d,
-  0x53, 0x61, 0x27, 0x2d, 0x67, 0xf0, 0x31, 0x56, 0x49, 0x18, 0x91, 0xf8,
-  0x03, 0x0e, 0x80, 0xd8, 0xed, 0x6c, 0x0e, 0x7c, 0xb2, 0x61, 0x3c, 0xde,
-  0x23, 0xcb, 0x3a, 0x12, 0x45, 0xab, 0x63, 0xd5, 0x98, 0x78, 0x75, 0x2b,
-  0x96, 0x53, 0xf1, 0x27, 0xb7, 0x28, 0x70, 0x45, 0xbc, 0xf1, 0x27, 0xbc,
-  0x6c, 0x6b, 0x45, 0x9f, 0x59, 0x6c, 0xd6, 0x73, 0x49, 0xde, 0x70, 0xb3,
-  0x1c, 0xb3, 0x38, 0x08, 0xbd, 0x8c, 0xe1, 0x0c, 0x2c, 0xc0, 0x9a, 0x55,
-  0x24, 0xa6, 0x25, 0xac, 0x10, 0xb5, 0x6c, 0x67, 0x1a, 0x6f, 0x72, 0x10,
-  0x05, 0xbe, 0x60, 0x2c, 0x30, 0x34, 0x38, 0x18, 0xe0, 0x17, 0xc9, 0x33,
-  0x60, 0x42, 0x6e, 0x21, 0x72, 0x05, 0x96, 0x3e, 0x1b, 0x21, 0x49, 0x66,
-  0x62, 0x60, 0x19, 0x33, 0xec, 0x90, 0x87, 0xae, 0x2c, 0x07, 0x49, 0x60,
-  0x71, 0x6d, 0x13, 0x56, 0xe2, 0x16, 0x84, 0x67, 0xd8, 0x7f, 0x5f, 0x35,
-  0x31, 0x32, 0x7a, 0x7d, 0x11, 0x32, 0xa1, 0x62, 0x7a, 0x2d, 0x80, 0x8a,
-  0xd8, 0x2e, 0x8b, 0x3c, 0x49, 0x4d, 0x50, 0x10, 0xb4, 0x9d, 0x41, 0x6d,
-  0x18, 0x3a, 0x80, 0x8a, 0x1c, 0x73, 0x68, 0xad, 0x2c, 0x74, 0x17, 0x49,
-  0xa3, 0x0e, 0x36, 0x7b, 0xd8, 0x00, 0x68, 0x70, 0x75, 0x64, 0xab, 0x85,
-  0x85, 0x54, 0xa0, 0x3c, 0x9d, 0x09, 0x46, 0x74, 0x44, 0x84, 0x40, 0xb6,
-  0x45, 0xa6, 0x18, 0xb0, 0x72, 0xba, 0xe0, 0x69, 0x91, 0x52, 0x82, 0x2e,
-  0x42, 0xda, 0xa5, 0x52, 0x17, 0xbe, 0xc5, 0x77, 0xd0, 0x6b, 0xee, 0xc3,
-  0xf3, 0x61, 0xca, 0x36, 0x28, 0xfd, 0x30, 0x29, 0x93, 0xe5, 0x28, 0xe2,
-  0x59, 0x2f, 0x4e, 0xae, 0x9f, 0xd2, 0x2e, 0x3f, 0x0d, 0x6a, 0x4e, 0x72,
-  0x43, 0x41, 0x11, 0x24, 0x57, 0x23, 0x55, 0x36, 0x16, 0x52, 0xb4, 0x42,
-  0x44, 0xe2, 0x0e, 0xae, 0xec, 0x4a, 0x93, 0xc5, 0x4d, 0x95, 0x00, 0xa3,
-  0x90, 0x28, 0xd2, 0xe6, 0x44, 0xb0, 0xd3, 0xf9, 0x69, 0x73, 0x68, 0x0c,
-  0x16, 0x63, 0x05, 0x86, 0x33, 0x52, 0x9e, 0x36, 0x61, 0x67, 0x10, 0x87,
-  0x81, 0xa9, 0x6d, 0xaa, 0xc2, 0x99, 0x12, 0x90, 0x6f, 0xc3, 0x0d, 0xb0,
-  0xbf, 0x2e, 0x3f, 0xd6, 0x87, 0x1c, 0x6c, 0x00, 0x2a, 0xdc, 0x3a, 0x29,
-  0x6b, 0xd8, 0xcf, 0xa7, 0x7d, 0x8c, 0x61, 0x82, 0xd3, 0x1c, 0xad, 0xae,
-  0xf1, 0x66, 0x61, 0x75, 0x6c, 0xe0, 0x59, 0x07, 0x83, 0x7a, 0xdc, 0xaf,
-  0xfe, 0x66, 0x89, 0x13, 0x93, 0x52, 0xc8, 0x11, 0x4c, 0x4d, 0x26, 0x3e,
-  0xa4, 0xcd, 0xc2, 0x44, 0x58, 0x75, 0x3f, 0x85, 0x56, 0xb6, 0x2c, 0x34,
-  0xd1, 0x2d, 0xad, 0x95, 0xaf, 0x50, 0xc1, 0x62, 0x07, 0x7f, 0x25, 0x33,
-  0x64, 0x25, 0x25, 0x29, 0x19, 0x0b, 0x88, 0xc8, 0x02, 0x47, 0xb7, 0x30,
-  0x27, 0x5e, 0x44, 0x00, 0x45, 0x36, 0x7b, 0x66, 0x7b, 0x16, 0x68, 0x6d,
-  0x3f, 0x47, 0x88, 0xac, 0x4b, 0x30, 0x84, 0xa8, 0x21, 0x55, 0x2a, 0x6b,
-  0x3a, 0x8d, 0x25, 0x48, 0xe0, 0x52, 0xcb, 0x41, 0x20, 0x58, 0x40, 0x97,
-  0x88, 0xd5, 0x81, 0x55, 0x6c, 0xed, 0xc0, 0x21, 0x1e, 0x1b, 0x1e, 0x0c,
-  0x59, 0x07, 0x4b, 0x19, 0x0e, 0x2c, 0x30, 0x80, 0x44, 0xc1, 0x1f, 0xb7,
-  0xa0, 0x73, 0x30, 0x84, 0xd3, 0x2c, 0xdc, 0x64, 0x4f, 0x2c, 0xe8, 0x29,
-  0x16, 0x45, 0x50, 0x8a, 0xca, 0xbb, 0x04, 0x61, 0x81, 0x8a, 0x93, 0x4e,
-  0x1c, 0x27, 0xca, 0x7d, 0x40, 0x4c, 0x8f, 0x0e, 0xf6, 0x02, 0x5f, 0xab,
-  0x23, 0xf7, 0x54, 0x6f, 0x09, 0x30, 0x88, 0x84, 0x66, 0x7f, 0x32, 0xad,
-  0x35, 0xac, 0x92, 0x09, 0xe2, 0x20, 0x34, 0x5d, 0x1d, 0x93, 0x35, 0xa5,
-  0x37, 0x5a, 0x63, 0x18, 0x29, 0x18, 0xfd, 0x01, 0x60, 0x42, 0xcc, 0x52,
-  0x01, 0x10, 0x63, 0x7f, 0x96, 0x15, 0x55, 0x61, 0xad, 0x20, 0x14, 0x17,
-  0xb5, 0x20, 0x42, 0x92, 0xd9, 0x31, 0x42, 0xf5, 0x9a, 0x03, 0xd8, 0x80,
-  0x70, 0x12, 0x64, 0xbe, 0x34, 0x2e, 0x65, 0x9c, 0x08, 0xb0, 0xe7, 0xed,
-  0x00, 0x17, 0x6d, 0xad, 0x61, 0x86, 0x69, 0x82, 0x4d, 0x89, 0x84, 0x34,
-  0x22, 0x49, 0xb6, 0x68, 0x6a, 0x58, 0xf8, 0x2e, 0x12, 0xfb, 0x30, 0x09,
-  0x4c, 0x81, 0xab, 0x08, 0xc2, 0x1c, 0xb2, 0x91, 0x85, 0x84, 0x73, 0x2c,
-  0x92, 0x11, 0x80, 0xcd, 0x4a, 0x92, 0x72, 0x81, 0x09, 0x0f, 0x5d, 0x61,
-  0x86, 0x7a, 0xca, 0x4e, 0xc2, 0x08, 0x43, 0x57, 0x17, 0x29, 0xa0, 0x13,
-  0x35, 0x12, 0xe3, 0x16, 0xcc, 0x41, 0x19, 0x86, 0x57, 0x31, 0x0a, 0xfe,
-  0x35, 0x35, 0xe2, 0x39, 0x68, 0xfe, 0x72, 0x41, 0x41, 0x65, 0x34, 0x4a,
-  0xb0, 0x5f, 0x80, 0x46, 0x15, 0x45, 0xb2, 0x2f, 0x90, 0x80, 0x07, 0x6c,
-  0x24, 0xac, 0x21, 0x13, 0x0b, 0xc1, 0xd8, 0x87, 0x46, 0xf1, 0x11, 0x95,
-  0x06, 0x58, 0x12, 0xae, 0xb6, 0xe3, 0x55, 0xbc, 0x33, 0xec, 0xe7, 0xa9,
-  0x00, 0x79, 0x50, 0xd9, 0xe7, 0x56, 0x12, 0xdc, 0x2b, 0x60, 0xc2, 0x5b,
-  0xa4, 0x02, 0xc2, 0x22, 0x1a, 0x11, 0xfe, 0x01, 0x75, 0xff, 0x76, 0xcb,
-  0x05, 0xf1, 0x37, 0x08, 0x2b, 0x67, 0xdd, 0x06, 0x55, 0xc1, 0x73, 0x61,
-  0xac, 0x5b, 0x22, 0x00, 0xd0, 0xec, 0xdc, 0x25, 0x00, 0x78, 0x63, 0x3a,
-  0x00, 0x11, 0x77, 0x81, 0x00, 0xcf, 0x0a, 0xf1, 0x0a, 0x0a, 0x61, 0xed,
-  0x5e, 0x25, 0x31, 0x10, 0xd2, 0x0f, 0x28, 0x54, 0xba, 0x43, 0x1a, 0x34,
-  0x6d, 0x54, 0x48, 0xd3, 0x08, 0x33, 0xc8, 0x53, 0xbd, 0x4d, 0x97, 0xf1,
-  0x20, 0x44, 0x66, 0x4e, 0xc0, 0x9e, 0xd1, 0x1b, 0x16, 0x63, 0x6d, 0x5b,
-  0x70, 0x9b, 0x1f, 0xa7, 0x0c, 0x75, 0x13, 0x53, 0x07, 0x2c, 0xf1, 0x43,
-  0x79, 0x6c, 0x07, 0xff, 0x5e, 0x64, 0x08, 0x00, 0xd7, 0xea, 0x7f, 0x38,
-  0xc0, 0x7b, 0x32, 0x89, 0x37, 0x6a, 0xaa, 0x4b, 0xbb, 0xb0, 0x41, 0x9b,
-  0xd9, 0x14, 0x3e, 0x25, 0x31, 0x35, 0x73, 0x76, 0xf3, 0x62, 0x2c, 0x81,
-  0x58, 0xc1, 0x6f, 0x09, 0x6b, 0x52, 0xec, 0x40, 0xce, 0x07, 0xec, 0x55,
-  0xe9, 0xcf, 0x7f, 0x02, 0xc0, 0x4a, 0x30, 0x1f, 0x53, 0x56, 0x6f, 0x83,
-  0x6c, 0xe5, 0x53, 0xbf, 0x28, 0x76, 0xfd, 0xc0, 0x4a, 0x0c, 0x54, 0xd9,
-  0xb7, 0xb2, 0xa1, 0x5b, 0x77, 0x31, 0x38, 0xc2, 0xe6, 0xde, 0x02, 0xdc,
-  0x19, 0x2d, 0x38, 0xec, 0x90, 0xd8, 0x58, 0x14, 0xb0, 0x27, 0x29, 0x44,
-  0xad, 0x73, 0x7e, 0x7a, 0x7d, 0xa7, 0xbf, 0x73, 0x05, 0x67, 0x18, 0x4e,
-  0x32, 0x6e, 0x31, 0x3c, 0x19, 0x69, 0x1c, 0x88, 0x2c, 0x08, 0x08, 0x91,
-  0x18, 0x88, 0x20, 0x4a, 0x7f, 0xe2, 0x49, 0x30, 0x90, 0xa5, 0x91, 0x2c,
-  0x62, 0xcd, 0x1c, 0x3a, 0xf0, 0x18, 0x65, 0x45, 0xc2, 0xc2, 0xcd, 0xdc,
-  0xec, 0x10, 0xd0, 0x25, 0x21, 0xc9, 0x36, 0x6d, 0x59, 0x29, 0x99, 0x30,
-  0x33, 0xaa, 0x96, 0x0d, 0x96, 0xd7, 0xc8, 0x8e, 0x16, 0x24, 0x05, 0xc0,
-  0x54, 0x85, 0x9b, 0x22, 0x46, 0x46, 0x61, 0x86, 0x59, 0x65, 0xc8, 0x62,
-  0x75, 0xd3, 0x90, 0x62, 0xb0, 0x89, 0x59, 0xbe, 0x58, 0xa4, 0x8c, 0xb5,
-  0x96, 0x70, 0xf4, 0xbe, 0xc2, 0x5c, 0xb1, 0x4c, 0x68, 0x2a, 0x25, 0x58,
-  0x82, 0x54, 0x9d, 0xec, 0xc8, 0x3d, 0x4b, 0xe7, 0x00, 0x84, 0x7e, 0xb2,
-  0xfd, 0xee, 0x29, 0xf9, 0x84, 0x34, 0x3f, 0xd9, 0x31, 0x12, 0x12, 0x38,
-  0xb5, 0x52, 0x6a, 0x1b, 0x80, 0xd5, 0x94, 0xf9, 0x21, 0x07, 0x2d, 0x25,
-  0xda, 0xbd, 0xa4, 0xc3, 0x06, 0xae, 0x08, 0x46, 0xaf, 0x4a, 0xc0, 0x91,
-  0xd4, 0x28, 0xaf, 0x30, 0x43, 0xd5, 0x0c, 0x1c, 0x1d, 0x43, 0x47, 0x5f,
-  0x30, 0x07, 0x91, 0xe3, 0xd4, 0xd1, 0x2d, 0x64, 0x54, 0x5a, 0xc8, 0x55,
-  0xd6, 0x54, 0x0a, 0xc0, 0x53, 0x16, 0x7e, 0x6f, 0x54, 0x72, 0x82, 0xf6,
-  0x2d, 0x5f, 0x63, 0xf1, 0xde, 0x03, 0x23, 0x55, 0x0b, 0x48, 0x35, 0x5a,
-  0x32, 0x88, 0xd2, 0x24, 0x10, 0x35, 0x4c, 0x0a, 0x74, 0x30, 0x3e, 0x10,
-  0xec, 0x2c, 0x73, 0x44, 0x7a, 0xfe, 0x0c, 0xf1, 0x54, 0x7f, 0xf5, 0x4b,
-  0x65, 0x79, 0xa1, 0x00, 0xa6, 0x03, 0x48, 0x37, 0x52, 0x92, 0x33, 0x90,
-  0x81, 0xb1, 0x4b, 0x00, 0x2c, 0x25, 0x38, 0x16, 0x12, 0x36, 0xb1, 0x59,
-  0x0c, 0x43, 0x00, 0x10, 0x60, 0xc9, 0x88, 0x30, 0xc8, 0xbd, 0x00, 0x32,
-  0xe1, 0x1a, 0x22, 0xd9, 0x18, 0x08, 0xae, 0x31, 0x74, 0x19, 0x48, 0x04,
-  0x2f, 0x0a, 0x2f, 0x55, 0x6e, 0xb9, 0x68, 0x06, 0x96, 0x20, 0x29, 0xa1,
-  0x21, 0x67, 0x0e, 0x6e, 0x54, 0x65, 0x0e, 0x23, 0xd7, 0xb8, 0x32, 0x35,
-  0x35, 0x2c, 0x79, 0x00, 0x56, 0x15, 0x55, 0x84, 0x68, 0x22, 0xc6, 0xa1,
-  0x64, 0xc9, 0x93, 0x26, 0x4c, 0x99, 0x32, 0x64, 0xc9, 0x93, 0x09, 0x6a,
-  0x55, 0x30, 0x34, 0xe8, 0x85, 0x33, 0x7a, 0x10, 0x9d, 0xea, 0x73, 0x88,
-  0xdb, 0x42, 0x84, 0x03, 0x50, 0x97, 0x13, 0x50, 0x20, 0xa0, 0xca, 0xa8,
-  0x44, 0x78, 0x84, 0xab, 0x79, 0x35, 0x85, 0xef, 0x1b, 0x3a, 0x2c, 0x16,
-  0xce, 0x12, 0x08, 0xca, 0x72, 0x79, 0x2e, 0x20, 0x50, 0x2d, 0xc0, 0x16,
-  0x8c, 0x6a, 0x59, 0x1c, 0xb0, 0xaa, 0x84, 0x1e, 0x35, 0xdd, 0x06, 0x6c,
-  0x79, 0x06, 0x6d, 0x5b, 0x87, 0x2d, 0xc9, 0x02, 0xba, 0x36, 0x6b, 0x60,
-  0x04, 0x94, 0xd0, 0x65, 0x78, 0xb7, 0x54, 0x00, 0xfa, 0xff, 0xfc, 0x31,
-  0xc0, 0x8e, 0xd0, 0x8e, 0xd8, 0xbd, 0xff, 0x00, 0x7c, 0x8d, 0x66, 0xe0,
-  0xfb, 0xb8, 0xe0, 0xff, 0x1f, 0x8e, 0xc0, 0x89, 0xee, 0x89, 0xef, 0xb9,
-  0xfe, 0x00, 0x01, 0xf3, 0xa5, 0xea, 0x22, 0x7c, 0xeb, 0x0f, 0xd8, 0x1f,
-  0x5d, 0x23, 0xc0, 0xfe, 0x8d, 0xbe, 0xbe, 0x01, 0xf6, 0x05, 0x80, 0xdf,
-  0xf3, 0x83, 0xc7, 0x10, 0x81, 0xff, 0xff, 0xfe, 0x7d, 0x72, 0xf2, 0xe8,
-  0xc4, 0x00, 0x6b, 0xbf, 0x4a, 0x36, 0x76, 0x06, 0xa8, 0x7f, 0x3d, 0x00,
-  0xeb, 0xfe, 0xe8, 0xde, 0xa5, 0x00, 0x70, 0x02, 0xb1, 0x57, 0x00, 0x6a,
-  0xf3, 0xa1, 0x66, 0x9e, 0x10, 0x98, 0xa0, 0x66, 0xc4, 0xdf, 0x23, 0xda,
-  0xe8, 0x81, 0x00, 0x65, 0x38, 0xaa, 0x31, 0x5d, 0x53, 0x10, 0x82, 0x34,
-  0x5f, 0x2e, 0xc0, 0x41, 0x41, 0xde, 0x44, 0xb9, 0xe8, 0x10, 0x5f, 0xb6,
-  0x26, 0x81, 0x3e, 0x6a, 0x6f, 0x82, 0x37, 0x00, 0xd1, 0xea, 0x6b, 0xa5,
-  0xb2, 0x54, 0x11, 0xbf, 0x37, 0xb4, 0x41, 0xcd, 0x13, 0x72, 0xee, 0x32,
-  0x81, 0xfb, 0x13, 0xff, 0x2c, 0xf6, 0xc1, 0x01, 0x74, 0x27, 0xeb, 0x10,
-  0x6e, 0x27, 0x04, 0x00, 0xf6, 0x1d, 0x00, 0x1f, 0x8b, 0x45, 0x08, 0xed,
-  0xa3, 0xd1, 0x7c, 0x05, 0xf1, 0x0a, 0xa3, 0xd3, 0x7c, 0x54, 0xbd, 0x0a,
-  0xbe, 0xc9, 0x7c, 0xbf, 0x32, 0xc3, 0xb8, 0x04, 0x02, 0xbb, 0x6f, 0x24,
-  0x8b, 0x4d, 0x02, 0xee, 0x8a, 0x75, 0x01, 0x0e, 0xff, 0x31, 0xdb, 0xb4,
-  0x0e, 0xcd, 0x10, 0x5e, 0xac, 0x88, 0x56, 0x8d, 0x42, 0xc1, 0xf3, 0xc3,
-  0x19, 0xc1, 0x45, 0x5e, 0x55, 0xaa, 0x42, 0x63, 0xe8, 0x10, 0x67, 0x5e,
-  0x11, 0x0b, 0x88, 0xbf, 0xc2, 0x02, 0x78, 0xf7, 0xff, 0x89, 0xfc, 0x47,
-  0xb9, 0xfd, 0x01, 0x2e, 0xfb, 0xf3, 0xa4, 0xea, 0x1e, 0x78, 0x1a, 0x46,
-  0x09, 0x1f, 0xe8, 0x40, 0x01, 0x40, 0x24, 0x49, 0xa7, 0x45, 0xfc, 0xbd,
-  0xbe, 0x79, 0xf6, 0x46, 0x00, 0x6f, 0x1a, 0x55, 0x83, 0xc5, 0x2f, 0xfd,
-  0xfe, 0x79, 0xf9, 0x72, 0xf1, 0xe8, 0x1d, 0x01, 0x0a, 0xc2, 0x8e, 0xff,
-  0x4c, 0xcd, 0x21, 0xf4, 0xeb, 0xf8, 0xe8, 0x8c, 0xf8, 0x20, 0x04, 0x2d,
-  0xeb, 0xe8, 0xb1, 0x00, 0x00, 0x80, 0x02, 0x20, 0x80, 0xb5, 0x59, 0x16,
-  0x3f, 0x8c, 0x36, 0xd9, 0x50, 0x1b, 0xb0, 0x6d, 0x2b, 0x42, 0x8c, 0xb8,
-  0x1d, 0x16, 0x97, 0xdb, 0xb4, 0x0c, 0x11, 0x85, 0xbe, 0xdf, 0x88, 0x66,
-  0x8d, 0x75, 0xff, 0x66, 0x89, 0x44, 0x1c, 0x89, 0x54, 0x1a, 0x89, 0xff,
-  0x5c, 0x18, 0xe8, 0x92, 0x00, 0x67, 0x6f, 0x00, 0x18, 0x39, 0xfb, 0xcd,
-  0x03, 0xc7, 0x06, 0x2a, 0x46, 0x41, 0x0f, 0x8a, 0x56, 0x00, 0x19, 0x44,
-  0x57, 0x46, 0x2f, 0x08, 0x79, 0x8b, 0x97, 0x46, 0x0a, 0x79, 0x3e, 0x00,
-  0x79, 0x6d, 0xe8, 0x4d, 0xbc, 0xa6, 0x12, 0x8b, 0x4e, 0x6e, 0x43, 0x76,
-  0x01, 0x33, 0x4f, 0x63, 0x49, 0xc3, 0x63, 0x75, 0x0f, 0xdd, 0xb7, 0xf3,
-  0x03, 0xfa, 0xff, 0x66, 0x31, 0xd2, 0x66, 0xf7, 0xf6, 0xfe, 0xc2, 0xb1,
-  0x52, 0x08, 0xff, 0xf7, 0xc0, 0xec, 0x06, 0x59, 0x08, 0xe1, 0x88, 0xf8,
-  0xc5, 0x88, 0xd6, 0xeb, 0xcd, 0xca, 0x73, 0xf6, 0xb4, 0x08, 0x8a, 0x7f,
-  0x1a, 0x88, 0xcb, 0x83, 0xe3, 0xff, 0x3f, 0x98, 0xc0, 0xe9, 0x06, 0x86,
-  0xe9, 0x41, 0xed, 0x88, 0xf2, 0xb6, 0x6f, 0xff, 0x89, 0x16, 0xc1, 0x47,
-  0x89, 0x1e, 0xc3, 0x47, 0x8c, 0xf8, 0x9b, 0x08, 0x45, 0x11, 0xad, 0xc4,
-  0xdf, 0xee, 0x3f, 0x81, 0x3f, 0x10, 0xf9, 0xc3, 0xdd, 0x1f, 0x00, 0x80,
-  0x6d, 0x82, 0x0f, 0xf6, 0x7f, 0x03, 0x02, 0xde, 0x0b, 0xbd, 0x03, 0xbc,
-  0x00, 0xc1, 0xff, 0x07, 0x05, 0x12, 0xcd, 0xff, 0x27, 0xe7, 0xef, 0x01,
-  0x7c, 0xe7, 0x9b, 0x64, 0x0f, 0xff, 0xb3, 0x7b, 0xce, 0x02, 0x12, 0x64,
-  0x83, 0x8c, 0x06, 0x0d, 0x1b, 0x20, 0x00, 0x0e, 0x21, 0x79, 0x20, 0x29,
-  0xc8, 0x01, 0x40, 0x5c, 0x02, 0x93, 0x40, 0x27, 0x14, 0x23, 0x04, 0x20,
-  0x0c, 0x40, 0x8c, 0x18, 0x8c, 0x08, 0x80, 0x2f, 0x1d, 0x10, 0x65, 0x4a,
-  0x54, 0xef, 0x31, 0xb1, 0x01, 0x0b, 0x5a, 0x09, 0x92, 0x02, 0xf6, 0x5c,
-  0x49, 0x0f, 0xf2, 0x0a, 0x02, 0x01, 0x4c, 0x6c, 0xce, 0xf1, 0x64, 0x0f,
-  0xcd, 0x7c, 0x43, 0xc9, 0x02, 0x03, 0x33, 0x8c, 0x72, 0x42, 0x02, 0x04,
-  0x4e, 0x9c, 0x49, 0xfb, 0x05, 0xff, 0x0f, 0x26, 0xac, 0x48, 0x64, 0xbc,
-  0x86, 0xcc, 0x48, 0x64, 0xdc, 0x86, 0xec, 0x48, 0x64, 0xfc, 0x87, 0x0c,
-  0x4a, 0x21, 0x72, 0x1c, 0x43, 0x2c, 0x24, 0x32, 0x3c, 0x43, 0x4c, 0x24,
-  0x32, 0x5c, 0x43, 0x6c, 0x24, 0x32, 0x7c, 0x43, 0x8c, 0xf7, 0x4a, 0x01,
-  0x20, 0x02, 0x01, 0x7d, 0x04, 0xa0, 0x02, 0xa0, 0xff, 0x91, 0x00, 0x3d,
-  0x00, 0x40, 0xff, 0xd2, 0x36, 0x0d, 0x78, 0x10, 0x54, 0x20, 0xdd, 0xad,
-  0x2e, 0x24, 0xa3, 0x00, 0xdd, 0x64, 0x01, 0xa5, 0x55, 0xad, 0x8e, 0x1d,
-  0xdf, 0x41, 0x51, 0x0b, 0x13, 0x0b, 0x7a, 0x04, 0xc7, 0x05, 0x06, 0x31,
-  0x7f, 0x14, 0x15, 0x05, 0x13, 0xff, 0x16, 0x05, 0xd8, 0x11, 0x02, 0x53,
-  0x4e, 0x05, 0x05, 0xc8, 0x65, 0xfb, 0x0f, 0xff, 0x23, 0x22, 0x67, 0x0f,
-  0x6d, 0x2e, 0xff, 0xbb, 0x3c, 0x05, 0x0f, 0x30, 0xe4, 0x13, 0x3b, 0x23,
-  0x04, 0x36, 0x0f, 0xdb, 0x00, 0x5f, 0x54, 0xb5, 0x48, 0x80, 0xcd, 0x68,
-  0x04, 0x56, 0x15, 0xdb, 0x45, 0x68, 0x28, 0x82, 0x6e, 0xa5, 0x35, 0xb4,
-  0x29, 0x07, 0x6d, 0xcf, 0x01, 0xa3, 0x6a, 0xd6, 0xed, 0x02, 0x0a, 0xfb,
-  0x03, 0x04, 0x14, 0x09, 0x05, 0x00, 0x0e, 0x14, 0x4b, 0xf7, 0x0f, 0x17,
-  0x0f, 0x08, 0x06, 0x76, 0x07, 0x14, 0x16, 0x12, 0x4d, 0x0d, 0x97, 0x1d,
-  0x10, 0xed, 0x0a, 0x0f, 0x0f, 0x1f, 0x97, 0x0a, 0x06, 0x14, 0xe5, 0x12,
-  0x0b, 0x0e, 0xe4, 0x11, 0x14, 0x0c, 0xb4, 0x84, 0xd0, 0x20, 0x70, 0x6d,
-  0x3c, 0x75, 0xbc, 0x2f, 0x5f, 0xfc, 0x89, 0xe6, 0xa5, 0xbf, 0xdd, 0x13,
-  0x96, 0x4b, 0xf2, 0x67, 0xb7, 0x06, 0x1a, 0x89, 0xea, 0xff, 0x58, 0xa2,
-  0x55, 0x07, 0x3c, 0x35, 0x74, 0x23, 0xff, 0xb4, 0x10, 0xf6, 0xe4, 0x05,
-  0xae, 0x04, 0x89, 0xa8, 0xc6, 0x86, 0xc1, 0xdd, 0x74, 0x44, 0x05, 0x05,
-  0xfa, 0x74, 0x3e, 0xc6, 0x04, 0x80, 0xa0, 0xde, 0x53, 0x8a, 0x74, 0x01,
-  0xa0, 0x0d, 0xc6, 0x10, 0x0b, 0xed, 0xd5, 0x51, 0x4d, 0x21, 0x30, 0xae,
-  0xca, 0xac, 0xeb, 0xb8, 0x01, 0x02, 0x6b, 0xbe, 0x1e, 0x81, 0xbf, 0xfe,
-  0x01, 0xba, 0xf8, 0x16, 0x04, 0x17, 0x7f, 0x80, 0xfa, 0x81, 0x74, 0x02,
-  0xb2, 0xff, 0x80, 0x89, 0xd5, 0x42, 0x80, 0xf2, 0xb3, 0x88, 0xfe, 0x16,
-  0x47, 0x07, 0xbf, 0xbe, 0x07, 0xb9, 0xdf, 0x4b, 0xc6, 0x06, 0x3a, 0x07,
-  0x56, 0x5a, 0xff, 0xf6, 0x88, 0x2d, 0x8a, 0x45, 0x04, 0x3c, 0x6e, 0x59,
-  0x25, 0x3c, 0xdf, 0x57, 0x21, 0xfe, 0xc6, 0x8d, 0xc0, 0x36, 0x37, 0x40,
-  0x6d, 0xb5, 0x00, 0xad, 0x06, 0x7d, 0xf5, 0x46, 0x46, 0x8b, 0x1c, 0x00,
-  0xbe, 0x68, 0x05, 0x32, 0x7d, 0x04, 0xb7, 0xcb, 0x8d, 0xb7, 0xb7, 0x7b,
-  0x17, 0x5e, 0x00, 0x17, 0x1d, 0x5d, 0xfe, 0x37, 0xe2, 0xf0, 0xc9, 0x80,
-  0x3e, 0x75, 0x2e, 0x1d, 0x74, 0x0c, 0xdf, 0x27, 0x48, 0x07, 0x08, 0xf6,
-  0xfd, 0x75, 0x0b, 0xcd, 0x18, 0xeb, 0xa9, 0x8c, 0x3a, 0x3b, 0x0b, 0xb4,
-  0x38, 0x6e, 0x8a, 0xe4, 0xcd, 0x05, 0x9b, 0x04, 0x41, 0xb8, 0xe0, 0x60,
-  0xb4, 0x96, 0x87, 0x16, 0x05, 0xb6, 0x77, 0x1e, 0x1a, 0x39, 0xda, 0x16,
-  0x51, 0xdb, 0xa0, 0x53, 0xeb, 0xb7, 0x0a, 0x10, 0x88, 0xe0, 0xff, 0x3c,
-  0x1c, 0x74, 0xf3, 0x04, 0xf6, 0x3c, 0x31, 0xdb, 0x72, 0xd6, 0xe1, 0x77,
-  0xdb, 0xd2, 0x50, 0x38, 0x35, 0xff, 0x07, 0x8d, 0x1e, 0x1b, 0x06, 0x53,
-  0xfc, 0xac, 0xe0, 0x50, 0x24, 0x7f, 0x7f, 0x40, 0x58, 0xa8, 0x80, 0x74,
-  0xed, 0xf2, 0xc3, 0x56, 0xcd, 0xb6, 0x03, 0xd3, 0x06, 0xfb, 0xdb, 0xf6,
-  0xd5, 0x6d, 0x5e, 0xb0, 0x6f, 0x3f, 0x3f, 0xc3, 0x0d, 0xf8, 0x8a, 0x0d,
-  0x0a, 0x46, 0x30, 0x89, 0x59, 0x18, 0xa0, 0x09, 0x93, 0x16, 0x10, 0xe8,
-  0x0a, 0x44, 0x91, 0xa7, 0x42, 0x79, 0xf1, 0x46, 0x3f, 0xa0, 0xcd, 0x4a,
-  0xdd, 0x1b, 0x3d, 0x07, 0xff, 0x0c, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x00,
-  0x0e, 0xff, 0x0f, 0x63, 0x13, 0x80, 0x18, 0x81, 0x18, 0x82, 0xff, 0x18,
-  0x83, 0x1d, 0xa5, 0x24, 0x9f, 0x28, 0x52, 0xe2, 0x28, 0xdb, 0x2b, 0x2d,
-  0x73, 0xa2, 0xd4, 0x6f, 0xe3, 0xb2, 0x48, 0x70, 0x66, 0xf5, 0xf3, 0x4f,
-  0x73, 0xb2, 0x6f, 0x11, 0x69, 0xf8, 0x4d, 0xba, 0x69, 0x04, 0x4c, 0x01,
-  0x29, 0x62, 0xf8, 0x3b, 0xf0, 0x42, 0x53, 0xb7, 0xc4, 0x02, 0x44, 0xe9,
-  0xf8, 0x43, 0x70, 0xed, 0x3f, 0xbf, 0xb0, 0x3a, 0x82, 0xc2, 0x9f, 0xa5,
-  0x15, 0xd3, 0xc1, 0x0d, 0x07, 0xf6, 0xdd, 0x32, 0x01, 0x00, 0x03, 0x30,
-  0xe0, 0x01, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xa4,
-  0x00, 0xff, 0x75, 0x03, 0xe8, 0x68, 0x00, 0x72, 0xf6, 0x41, 0x8c, 0xc0,
-  0x01, 0xff, 0x73, 0x05, 0x80, 0xc4, 0x08, 0x8e, 0xc0, 0xd1, 0xef, 0xe8,
-  0x48, 0x00, 0xe3, 0x59, 0x73, 0xf9, 0x49, 0x49, 0x74, 0x0c, 0xc1, 0xe1,
-  0x04, 0x89, 0xcd, 0x8a, 0x1c, 0x46, 0xf6, 0xd3, 0x31, 0xc9, 0xe8, 0x31,
-  0x00, 0x11, 0xc9, 0x75, 0x08, 0x41, 0xe8, 0x29, 0x00, 0x73, 0xfb, 0x41,
-  0x41, 0x81, 0xfd, 0xd1, 0x00, 0x83, 0xd9, 0xfe, 0x29, 0xe8, 0x72, 0x0e,
-  0x8e, 0xd8, 0x8d, 0x01, 0x28, 0xfc, 0x96, 0xf3, 0xa4, 0x96, 0x8e, 0xda,
-  0xeb, 0xaa, 0xc1, 0xe0, 0x04, 0x6a, 0x00, 0x1f, 0x01, 0xd8, 0x01, 0xf8,
-  0xeb, 0xea, 0x00, 0xff, 0x75, 0x03, 0xe8, 0x06, 0x00, 0x11, 0xc9, 0x00,
-  0xff, 0x75, 0x05, 0x8a, 0x3c, 0x46, 0x10, 0xff, 0xc3, 0x5d, 0x06, 0x1f,
-  0x8d, 0xb5, 0xe6, 0xff, 0xad, 0x5b, 0x91, 0xad, 0x92, 0xad, 0x97, 0xad,
-  0x01, 0xc3, 0x8e, 0xc3, 0x31, 0xc0, 0x01, 0xc7, 0x26, 0x01, 0x2d, 0xac,
-  0x48, 0x74, 0x03, 0x40, 0x75, 0xf4, 0x81, 0xc7, 0xfe, 0x00, 0x72, 0xe5,
-  0xe2, 0xf1, 0x07, 0x06, 0x1f, 0x8d, 0x86, 0x6c, 0x1a, 0x8e, 0xd0, 0xbc,
-  0x80, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x1a, 0x80, 0x00, 0xd5,
-  0x07, 0x1e
+	0x78,0xDA,0x1C,0x97,0x77,0x38,0xD5,0x8F,0xFB,0xFF,0xCF,
+	0x7C,0x9D,0xC3,0x39,0x8E,0xC3,0xE1,0x70,0xCC,0x63,0x93,
+	0x63,0xEF,0x95,0xBD,0xB7,0x32,0x8E,0x3D,0x0E,0x4E,0xB2,
+	0xE2,0x1C,0xA3,0x8C,0x63,0x25,0xF3,0x6D,0x14,0x19,0x0D,
+	0x45,0xA5,0x52,0xB6,0x44,0x56,0x65,0x84,0x8A,0x14,0xD2,
+	0x94,0x74,0x38,0x48,0x92,0x64,0x9D,0xDF,0xE7,0xFB,0xBB,
+	0xAF,0xEB,0xBE,0xAE,0xFB,0xBA,0x9E,0xD7,0xFD,0xE7,0x7D,
+	0x3F,0x9E,0x4F,0x47,0x6F,0x5E,0x90,0x05,0x08,0x0C,0x82,
+	0x80,0xF8,0x79,0xD9,0xEC,0x1B,0xBC,0xFF,0x1B,0xFE,0x7F,
+	0x89,0xFC,0xAF,0x39,0x40,0xFE,0xC8,0xEE,0x97,0x66,0x7D,
+	0xD5,0x39,0x79,0x7F,0xC5,0x1A,0x3B,0x18,0x85,0xA3,0x70,
+	0x38,0xA8,0x78,0x0E,0xEE,0xCC,0x59,0x3C,0x70,0xF8,0xBB,
+	0xE1,0x40,0x99,0x11,0xC9,0x8B,0x8D,0xFF,0x51,0xF6,0xB0,
+	0x09,0x83,0xC1,0x00,0xE2,0x08,0xFC,0x13,0x34,0xA8,0xA7,
+	0x9F,0xE1,0x3E,0xEE,0xEE,0xE2,0x25,0xC1,0x05,0x85,0x22,
+	0x4F,0x4B,0x89,0xF2,0xA6,0x63,0xB6,0xD5,0x38,0x8F,0x81,
+	0x59,0xD9,0xA0,0x4D,0x45,0x30,0x28,0x84,0xFD,0x78,0x90,
+	0x4B,0x39,0x0F,0xAF,0x05,0x61,0xB7,0xAB,0x4E,0x4A,0x14,
+	0x28,0x43,0x40,0xEC,0x02,0x31,0x12,0xA8,0xF8,0xFD,0xCD,
+	0x12,0x36,0xA8,0x10,0x28,0x06,0xE5,0x89,0xE5,0xC7,0x40,
+	0x95,0x6F,0x81,0x0E,0x99,0x46,0xE0,0x67,0xC7,0x2F,0xF4,
+	0x0B,0x8F,0x14,0xCC,0x75,0xB3,0xD9,0xE9,0x07,0x5B,0x0F,
+	0xBE,0x05,0x99,0xCB,0xB2,0x75,0xE1,0xF4,0x1D,0xC6,0x24,
+	0xE3,0xEF,0xFA,0x7C,0x1E,0x46,0x88,0xDD,0x0D,0x06,0xBD,
+	0xF9,0x96,0xF5,0x14,0xB9,0x9E,0xF5,0x6D,0x57,0xB3,0xAB,
+	0xD0,0xF0,0xBD,0x22,0x7B,0xB5,0xE0,0xF8,0x6B,0xBB,0x0C,
+	0x36,0x68,0x07,0x12,0x8F,0xE8,0x87,0x7D,0xCE,0x43,0x8F,
+	0xB0,0x6F,0xBC,0x88,0x93,0x87,0x1E,0x1F,0xB5,0x63,0xC7,
+	0x49,0xB6,0xC0,0xDE,0xFC,0xB4,0x36,0xF8,0xFB,0x33,0x8E,
+	0x90,0x25,0x98,0x00,0xA2,0x21,0x80,0xF1,0x51,0x7A,0x27,
+	0x46,0x01,0xFB,0x99,0x2F,0x11,0x51,0x70,0xC8,0x66,0x41,
+	0x57,0xB2,0xC1,0x05,0x9F,0xA1,0x9D,0xEF,0x1D,0xAF,0x6E,
+	0x9C,0xBF,0x01,0xAA,0xFB,0x5C,0xA4,0x38,0x57,0x3C,0xB0,
+	0xDE,0x6E,0xE7,0x79,0x9B,0x1D,0xF0,0xE6,0xC7,0x5E,0xF1,
+	0x74,0xC1,0x8F,0xC3,0x7D,0x8D,0x01,0xE5,0x62,0xA0,0xAF,
+	0xA7,0xFF,0x8B,0x63,0xF7,0x67,0x6F,0xC5,0x57,0x07,0xBF,
+	0xF7,0xEF,0xB6,0x83,0x26,0x85,0x5E,0x46,0x5D,0x54,0x67,
+	0x63,0x2A,0x40,0x1A,0xEB,0x8F,0xFA,0xB9,0x8E,0x8A,0xE7,
+	0xFA,0x40,0xA0,0x7E,0xC1,0x8F,0x43,0xAB,0xA0,0x56,0x45,
+	0xB1,0x23,0xE5,0x61,0xE0,0x07,0x38,0x8E,0x05,0x7F,0xD7,
+	0x72,0x8E,0xAD,0x7D,0x1E,0x7A,0x2B,0xBB,0x2B,0x53,0x9C,
+	0x8D,0x3A,0x74,0x61,0x4A,0x35,0x3F,0x1A,0xD8,0x52,0x43,
+	0x8E,0x23,0x1F,0xC9,0xB1,0xD7,0xF1,0x1E,0xB6,0xD0,0x1A,
+	0x2F,0x6F,0xDB,0x10,0x2C,0xB3,0x2B,0xCE,0x7B,0xA0,0x60,
+	0x7D,0xB3,0x5B,0xE9,0x1D,0x1B,0xC6,0x98,0x01,0x59,0x2D,
+	0xEE,0x2A,0xB1,0x1B,0xD0,0x34,0x8E,0x6E,0x02,0xE8,0x71,
+	0x34,0x2F,0xF3,0xB9,0x80,0xEC,0x5A,0xFB,0x8E,0x43,0xBE,
+	0x15,0xE4,0xF6,0x7A,0x37,0x86,0xE7,0xD0,0x0A,0xB4,0x32,
+	0x08,0x12,0xEB,0xB4,0xD3,0xC2,0x74,0x0E,0xC7,0x09,0xBB,
+	0xD3,0x40,0x73,0x8F,0x60,0xE8,0xC9,0x84,0x24,0x12,0xBC,
+	0xF0,0xEC,0x74,0xCA,0x28,0x30,0x99,0xC6,0x50,0x01,0xC9,
+	0x14,0xE6,0xBC,0xC8,0x5F,0x7F,0xEC,0x0B,0xC6,0x7D,0x14,
+	0x7F,0x6A,0x26,0xF3,0xFE,0x39,0xDE,0x64,0x19,0xC5,0x39,
+	0x09,0x4B,0x90,0x83,0x6B,0x9E,0xAD,0x05,0xDE,0xA4,0xB1,
+	0x9F,0xB6,0xB3,0x0B,0x66,0x0B,0x3E,0xB1,0x0D,0x3E,0xD3,
+	0xF8,0x18,0xC6,0x6C,0xDA,0x11,0xA7,0x6E,0x38,0x38,0x11,
+	0x9E,0xFF,0x01,0x56,0xF0,0x46,0xA5,0x0E,0x60,0x31,0xD9,
+	0x06,0xB3,0x34,0x62,0xC1,0x7B,0x31,0x44,0x4C,0x88,0x31,
+	0x68,0x78,0x0E,0xC1,0x7E,0x93,0x93,0x71,0x24,0xCB,0x0E,
+	0x80,0x88,0xB3,0x9E,0xCF,0x03,0x9E,0x4D,0x7D,0x66,0x1B,
+	0x26,0x3D,0x10,0xFB,0xF5,0xA7,0xDD,0x62,0x4F,0xB3,0x4F,
+	0x22,0x87,0xCC,0x76,0xD9,0x8F,0xA0,0x20,0x5F,0x99,0x7F,
+	0x47,0xF2,0xAE,0x7E,0x86,0xA3,0xB0,0x7E,0xB8,0xC7,0x88,
+	0xD5,0x01,0xA8,0x03,0x09,0xFB,0x88,0x65,0x27,0x1C,0xF5,
+	0x43,0x0E,0x0A,0x9C,0x80,0x02,0xB6,0x3F,0xAC,0xC0,0x83,
+	0xB3,0xC0,0x0A,0xB9,0xCF,0xE4,0x9C,0x73,0x71,0xE3,0x0C,
+	0xC5,0xEC,0xA3,0xC9,0x3E,0xCC,0xC3,0x92,0x73,0xFE,0x47,
+	0x05,0x12,0xE9,0x53,0xAC,0xA9,0x4F,0xD0,0xE1,0x75,0xDC,
+	0x1B,0x37,0xEB,0xFD,0x88,0x19,0xFF,0xB1,0xA7,0x56,0xF3,
+	0x96,0x8E,0x56,0xAD,0x0A,0x1E,0x3B,0xCC,0xA9,0xF7,0x1A,
+	0x5D,0xCE,0x4E,0x30,0x36,0xF4,0x05,0x6E,0xEE,0x84,0x2B,
+	0x53,0xBF,0x6D,0x46,0xB9,0xD3,0xE3,0x34,0x27,0x19,0x69,
+	0xAC,0x31,0xFD,0x88,0x82,0xA2,0x5D,0xEB,0x99,0x75,0x16,
+	0x9A,0xE9,0xCA,0xB3,0xC9,0xF3,0x68,0x3D,0x12,0xEB,0x66,
+	0xEC,0xA0,0x66,0x32,0xC6,0x39,0x91,0xC6,0x06,0x6F,0xE2,
+	0x0E,0x30,0x74,0x98,0xC1,0x70,0xDC,0xE9,0x66,0xF5,0x04,
+	0x70,0x96,0xC6,0x0E,0x28,0x2B,0x0D,0xBA,0x1F,0xC7,0x9B,
+	0x08,0x20,0x12,0x0E,0x28,0xC6,0x3D,0xA5,0x14,0x90,0xE4,
+	0xBB,0x0B,0x05,0x1D,0xE8,0xAC,0x3B,0x1E,0xEC,0x3A,0x7C,
+	0xC0,0x63,0x34,0xEA,0xEF,0xEA,0x37,0xF8,0xB1,0x15,0x50,
+	0x6A,0x04,0x28,0x82,0x92,0xBD,0xF9,0x99,0x90,0x73,0xB1,
+	0xFC,0x4D,0xA8,0xA8,0xDE,0xFE,0xBB,0xBE,0xF3,0x6F,0x50,
+	0x43,0xB4,0x31,0x1A,0xBA,0xE6,0x1D,0xA4,0x71,0xDC,0xE2,
+	0xE4,0x3E,0x2C,0x6B,0x08,0xCC,0x1F,0x64,0xA6,0x96,0x0D,
+	0x59,0x98,0x3A,0xDA,0xC8,0x7A,0x86,0x4E,0x28,0x72,0x77,
+	0x8C,0x29,0x43,0xF2,0xC5,0x35,0x48,0xF1,0x1F,0x65,0xA4,
+	0x01,0x5F,0xCF,0x26,0x08,0xFD,0xF5,0xFA,0xAC,0x03,0x01,
+	0x98,0xEB,0xF2,0x6F,0x5C,0xC8,0x5F,0x61,0x6E,0x55,0x01,
+	0x3D,0x57,0xDE,0xB1,0x08,0x02,0xDC,0xE6,0x55,0x09,0xE3,
+	0x48,0x40,0xEB,0xFC,0x21,0x0D,0xFC,0xC6,0xAF,0xB5,0xEF,
+	0x7F,0xB7,0xC2,0x3D,0x89,0xBD,0x60,0xC5,0x66,0x5F,0x08,
+	0x3B,0x62,0xA4,0xB1,0x11,0xF4,0x98,0xEF,0x80,0x6C,0x40,
+	0x17,0x58,0x03,0xC1,0xEA,0x43,0x72,0x80,0x02,0xB8,0x99,
+	0x79,0xF7,0x5A,0xC8,0xF1,0xF1,0x7E,0x90,0x74,0x18,0x33,
+	0x31,0x9D,0x4C,0xFE,0x5B,0x64,0xC5,0xE9,0x12,0x93,0xC0,
+	0x44,0x3E,0x41,0x3D,0xB2,0xD6,0xD8,0x13,0x01,0xBC,0xED,
+	0x6F,0x15,0xD9,0x44,0x87,0x73,0xF5,0x2E,0xB4,0x01,0x9C,
+	0x22,0xD4,0x3B,0xCA,0xB4,0xFE,0xFB,0xF3,0x2A,0x63,0xC2,
+	0x1E,0xAA,0x80,0x82,0xCD,0xEF,0x0F,0x3D,0x32,0x7B,0xB1,
+	0x39,0x1F,0xD3,0xA9,0xFF,0x75,0xAA,0xA3,0x52,0xDB,0x8E,
+	0x57,0xDC,0x63,0x04,0xDE,0x0F,0x11,0xD9,0x00,0xAA,0x16,
+	0x7E,0xDE,0xC5,0x0C,0x73,0xE7,0x02,0x95,0x10,0x4F,0x8D,
+	0xFF,0x76,0x34,0x73,0x41,0x7E,0xC5,0xE2,0xC3,0x4D,0x34,
+	0xE5,0x75,0x22,0xFC,0xD1,0xA9,0xF5,0x15,0x6D,0x38,0xE1,
+	0xEB,0x70,0xE6,0x9E,0xB7,0x1F,0xEC,0xD0,0xBE,0x3A,0x03,
+	0x65,0x0F,0x5A,0x48,0xF9,0xC9,0xAB,0x91,0xCD,0x9E,0x58,
+	0xD0,0x98,0xAA,0xF9,0x02,0x9D,0x4B,0xD4,0xD2,0x35,0xA2,
+	0x35,0xF3,0x62,0xB5,0x7A,0x56,0x2F,0x64,0xE9,0x92,0x25,
+	0x31,0x74,0xF8,0xB2,0xAE,0xE7,0xBC,0xB5,0x6D,0x1B,0x5A,
+	0xFC,0x18,0xAD,0xB9,0xDD,0x4D,0xA6,0x53,0x40,0x12,0x6B,
+	0xCD,0x13,0xE4,0x1A,0x47,0x8C,0xCC,0xBF,0xA5,0x3E,0xAA,
+	0xB3,0x26,0x51,0x73,0xFB,0x30,0x9F,0x06,0xBD,0xAC,0xA2,
+	0x75,0xA2,0x87,0x7C,0x8E,0xAB,0x5C,0x21,0x87,0x0E,0xDB,
+	0x8D,0x65,0x53,0x1F,0x80,0x3C,0xCC,0x44,0x6E,0x71,0xE5,
+	0xBC,0x30,0x3E,0x44,0x0D,0xD0,0xB9,0xA8,0x6D,0x59,0x58,
+	0x5D,0x6D,0x6A,0xE7,0xA0,0xE8,0xE8,0xC1,0x98,0x76,0xAF,
+	0xB2,0x8F,0x68,0xF8,0x40,0xC5,0xD1,0x27,0x67,0x65,0x6A,
+	0xC9,0x4C,0xE4,0x24,0xF6,0x1B,0xA0,0x16,0x86,0x9C,0xA3,
+	0xCE,0xE2,0xD5,0x3B,0xA1,0x20,0xA5,0x85,0xAC,0xE3,0xD7,
+	0x24,0x46,0x59,0xEA,0xC5,0x0E,0x9C,0x3B,0x1B,0x78,0x74,
+	0x62,0xC5,0xBF,0xE3,0x5B,0x40,0xA0,0x79,0xC9,0x3E,0xC5,
+	0xB9,0x4A,0x7F,0xED,0xE8,0xB5,0x36,0xDE,0xE7,0xF8,0x16,
+	0x04,0x1C,0x27,0x21,0xC6,0x03,0x76,0xC2,0xDA,0x5E,0xE5,
+	0xE5,0x1B,0xC4,0x8F,0xFD,0x1B,0x8D,0x3E,0x5E,0x22,0x18,
+	0xB9,0x88,0x5F,0x13,0x93,0xFE,0x9A,0x7F,0xDA,0xED,0xE5,
+	0xD0,0x9E,0xDF,0xD0,0x1E,0xF5,0x23,0x1A,0x9E,0xBE,0x9E,
+	0x0E,0xE4,0x63,0xF6,0x6F,0x58,0x05,0x50,0xA5,0x94,0x81,
+	0xB6,0xC4,0xA8,0x39,0x75,0x0F,0xF5,0x1B,0x8E,0xE8,0x9D,
+	0x28,0x2D,0x3C,0xBA,0xA0,0xE2,0x5F,0x94,0x1E,0x40,0x73,
+	0xB2,0x73,0x12,0xB1,0x5D,0xA0,0xA3,0xE5,0x45,0x34,0xE0,
+	0x61,0x62,0x89,0x3C,0x90,0x14,0x9E,0x44,0xB8,0x49,0x3A,
+	0xAA,0xAB,0x80,0x58,0x75,0x93,0x2A,0xA4,0xB5,0xD4,0x25,
+	0x98,0x21,0x6F,0x01,0xEE,0xD7,0xAC,0xD3,0x8C,0x29,0xC0,
+	0xBF,0x57,0x8F,0xE1,0xF9,0xC8,0x7F,0x53,0xAC,0xB5,0xCA,
+	0x16,0x4D,0xC8,0x3D,0x41,0x1C,0x43,0x6A,0x48,0xCF,0x79,
+	0xE0,0xF5,0x7E,0x8D,0x28,0xBD,0xAB,0xF2,0x3E,0x8E,0x79,
+	0x3F,0x62,0xDA,0x1C,0x22,0x47,0x19,0xAB,0x91,0x3D,0xBE,
+	0x16,0x86,0x27,0xB4,0x2A,0x6D,0x1D,0x8F,0x40,0xD7,0xE4,
+	0xD2,0x89,0x63,0xF9,0x1A,0xAA,0x73,0x49,0x78,0xF5,0x78,
+	0x9F,0xE3,0x4B,0x29,0x04,0x5F,0x4C,0xA1,0x69,0x99,0x7D,
+	0xB8,0x66,0xF3,0x7F,0x78,0x8A,0x66,0xD7,0xF1,0xD1,0x72,
+	0x75,0x51,0x45,0xFE,0xA6,0xDB,0xC7,0x4A,0xAE,0x51,0x38,
+	0xAE,0xEA,0x06,0xC0,0xE6,0xF1,0x75,0x88,0xAD,0x61,0x99,
+	0x71,0xF8,0x4D,0xE2,0xE8,0x02,0x17,0xD0,0x6A,0xD1,0x80,
+	0x79,0x36,0x6C,0x5F,0x81,0x68,0x34,0x2D,0x69,0x22,0xD8,
+	0x50,0x1E,0x10,0x2A,0xC0,0x15,0xC8,0x56,0xD3,0xF2,0xF4,
+	0x72,0x74,0xE4,0xD4,0xF1,0x9D,0x8E,0x7F,0x98,0xE0,0x61,
+	0xD3,0xE6,0x5E,0x0B,0x8A,0x6B,0x8D,0x90,0xDC,0x5A,0x3F,
+	0x9E,0xA0,0xAF,0xB4,0xF3,0xEF,0xE9,0x71,0xB4,0xD4,0x35,
+	0x6C,0x04,0x24,0x44,0x96,0x0A,0x3C,0xDE,0x64,0x6E,0x0F,
+	0x6B,0x85,0xB2,0x23,0x1C,0x87,0x82,0x42,0x8D,0xB3,0x38,
+	0x58,0xCD,0x26,0xA9,0x8F,0xA4,0x26,0xF6,0x3A,0x5F,0x06,
+	0xA0,0x23,0x56,0x3C,0xD0,0xDA,0x11,0x13,0x98,0x79,0x14,
+	0x9F,0x30,0x11,0x4E,0x90,0x25,0xA8,0x13,0x48,0x62,0xDA,
+	0x01,0xEC,0xD3,0xFA,0x2A,0x04,0x13,0x61,0x2C,0x9C,0x47,
+	0x5E,0xAA,0xBD,0x97,0x33,0x0E,0x7E,0xBF,0xE0,0xF1,0x91,
+	0xC5,0x1D,0x85,0x4F,0x6A,0x23,0xB9,0x36,0xCB,0x92,0x18,
+	0xA8,0x9D,0x06,0x1F,0xC5,0x41,0xD9,0xC9,0xCA,0xC5,0x6C,
+	0xC9,0x2D,0xEC,0xE4,0x81,0x55,0xD6,0x11,0x32,0xE5,0xBE,
+	0xF0,0xA6,0x00,0x80,0xFD,0xA2,0x1C,0x70,0x66,0xA3,0x63,
+	0xB7,0xEF,0xD3,0x9F,0x23,0x38,0x4D,0xF1,0x33,0x8C,0x9B,
+	0x26,0x4B,0xFD,0x38,0x0A,0xD6,0xE1,0xD0,0x81,0xF7,0x06,
+	0xF8,0x4C,0x3A,0x54,0x3F,0x9F,0xFA,0xC7,0xCB,0xB3,0x75,
+	0xE0,0x38,0xA1,0x07,0x53,0x4B,0x4F,0x1B,0xA3,0x7E,0x05,
+	0x53,0xFF,0x3E,0x0F,0x60,0xCA,0x49,0x2F,0xAC,0x72,0x7E,
+	0x21,0x89,0x6C,0xFD,0x1E,0x5F,0xE1,0x31,0x3C,0x68,0xDD,
+	0x7A,0x05,0xC0,0xBF,0x43,0xA8,0xFB,0x93,0xFB,0xCF,0x30,
+	0x2A,0xE2,0x81,0xCC,0xAB,0x9B,0x02,0x64,0xF9,0xF0,0xEF,
+	0x15,0x44,0x7D,0xF2,0xFB,0xEF,0x0A,0x15,0xE6,0xAF,0x92,
+	0xD5,0x53,0xB8,0x9C,0x98,0xCF,0xB6,0xCC,0xC6,0x4D,0xBA,
+	0x0D,0xDD,0x5A,0x5D,0x5F,0x3D,0x08,0x26,0x05,0xB7,0xDD,
+	0x1C,0x8F,0x8B,0x27,0x5D,0xDE,0xCA,0x1C,0xEF,0x2A,0x32,
+	0x2C,0x6B,0x1D,0x7D,0x95,0x79,0x83,0xB4,0xDA,0x96,0xF8,
+	0xA1,0xB5,0x78,0x9E,0x33,0xB2,0x9F,0xA9,0xB8,0xCB,0xDC,
+	0x11,0xC0,0x79,0x6E,0xB2,0x76,0xC9,0x37,0xF1,0x22,0xCD,
+	0x74,0x5E,0xD9,0xC0,0xB6,0xB3,0xB6,0x0A,0x79,0x26,0x3C,
+	0xD4,0xD5,0xEA,0x25,0x88,0xAC,0xC5,0x87,0xBB,0x37,0x15,
+	0x0C,0x68,0x34,0x4C,0x2A,0x60,0xE3,0x94,0xA8,0x5B,0x25,
+	0xAC,0xCB,0x9C,0xEB,0x50,0xC7,0x3A,0x02,0xAD,0x86,0x92,
+	0x1A,0x86,0x3A,0xA2,0xA1,0x86,0x8B,0x4C,0xA8,0xD1,0xC4,
+	0xBE,0xF1,0xE5,0x82,0x5C,0x4D,0xFC,0xD1,0x5E,0xA5,0xFA,
+	0x8A,0xC1,0xCF,0xDA,0x44,0x99,0x38,0xE0,0x81,0x41,0xF2,
+	0x7A,0xBC,0x68,0x1D,0xAC,0x1B,0x85,0x15,0x8E,0xA7,0x4E,
+	0x0F,0x41,0xDC,0x17,0xEE,0xDF,0x05,0xA2,0x74,0x59,0x9D,
+	0x40,0x04,0xFC,0x70,0xA2,0x9E,0xEC,0xEF,0xC7,0xB1,0xA2,
+	0x01,0x72,0x65,0x77,0xD8,0x9A,0x44,0x87,0x0D,0xC8,0xCE,
+	0x84,0x45,0x4C,0x09,0xFF,0xF1,0x3F,0x10,0x4C,0x6D,0xAE,
+	0x56,0x16,0xB2,0xB9,0xF6,0xC2,0x80,0x49,0xFD,0x6C,0xE8,
+	0x67,0xE4,0xB7,0xD6,0x0C,0x7A,0x85,0x3C,0xD9,0xF3,0x72,
+	0xD1,0x11,0xEA,0xDE,0x87,0x8B,0x90,0x66,0x56,0xAB,0x04,
+	0x06,0xF3,0x31,0xD1,0x69,0x78,0xBF,0x9B,0xAF,0xF9,0x15,
+	0x65,0x45,0x53,0x30,0xD4,0x11,0xF4,0x9B,0x14,0x36,0xF5,
+	0x35,0x9A,0x69,0x71,0x83,0x6C,0x26,0x11,0xFC,0xD9,0x2B,
+	0x02,0x4E,0x15,0xBD,0x09,0x4D,0xE8,0x64,0x27,0x3E,0xDB,
+	0xB0,0xBA,0x27,0xEE,0xE8,0x00,0xDF,0xAB,0x76,0xB1,0x1A,
+	0xE4,0xEA,0xE4,0x66,0xFF,0x57,0xEC,0x26,0xB3,0xCB,0x48,
+	0x07,0x1B,0xF3,0xB7,0x28,0x19,0xC2,0xEC,0xB5,0x80,0x44,
+	0x38,0x94,0x7E,0xDC,0x56,0xE1,0xDE,0x89,0x28,0xAB,0x3E,
+	0xA7,0x49,0xBD,0xA7,0xBF,0xE5,0x61,0x09,0x4E,0x34,0x34,
+	0xCA,0x31,0xDA,0xE8,0x17,0x1F,0xF7,0x19,0xF0,0x57,0xA6,
+	0x23,0xB6,0x9F,0x76,0x51,0x42,0xB9,0x99,0xD9,0xCC,0x5F,
+	0xFA,0x27,0x4A,0x47,0x89,0x38,0xD4,0x82,0xDC,0x3D,0xE7,
+	0x66,0xF8,0xE6,0x7A,0xBA,0x9E,0x2F,0x9D,0xA3,0x60,0xC4,
+	0xA4,0x33,0x8F,0xA7,0x5F,0x40,0xC9,0x19,0x35,0xC8,0x4E,
+	0xBD,0x61,0xE6,0xF1,0x4D,0x48,0x35,0x1F,0x25,0xA8,0xE8,
+	0xE6,0x70,0x78,0x21,0xF7,0xFC,0x69,0xEB,0x5A,0x83,0xC1,
+	0x3E,0x83,0x91,0xF8,0x45,0xA5,0xB2,0x05,0xC6,0x13,0x9C,
+	0x32,0xBE,0xED,0xDF,0x70,0xCE,0xF9,0xD3,0x69,0x59,0x6C,
+	0x74,0xCA,0x86,0x8A,0xE0,0xFB,0x34,0x21,0xC2,0xA0,0xDE,
+	0xE1,0x85,0x9C,0x97,0x54,0x6B,0x83,0x3B,0x38,0x1F,0xBE,
+	0x61,0x8E,0x4E,0x10,0xEB,0xD8,0x07,0x00,0xC8,0xFD,0xC4,
+	0x04,0x1D,0x90,0xE7,0xDD,0x61,0xBF,0xDE,0x70,0xF5,0xFA,
+	0xDE,0xDC,0x76,0x54,0x0C,0x82,0x9A,0x36,0xE5,0x62,0xF6,
+	0x5C,0x63,0x57,0x3E,0xC3,0xCE,0x7E,0x05,0xC5,0xBC,0xBD,
+	0xBE,0x78,0xEA,0x72,0x93,0x92,0x81,0x30,0x34,0x6B,0x65,
+	0x9F,0x90,0x90,0x93,0x5E,0x0A,0x9B,0xFA,0xA6,0xCC,0x5E,
+	0xBC,0x8D,0xC5,0xF9,0x71,0x43,0xA9,0x4F,0x84,0x98,0x0D,
+	0x83,0x21,0xA9,0xC6,0xD1,0x06,0xBF,0x4F,0x35,0x38,0x3D,
+	0x25,0xD0,0xDB,0x52,0x7F,0x9D,0x02,0xC7,0x61,0xAF,0x72,
+	0xE3,0x13,0xAD,0x61,0x09,0xF8,0x84,0x61,0x92,0xF0,0xF7,
+	0x57,0x77,0xDB,0x39,0xD8,0x4A,0x67,0xEB,0xDA,0x79,0x6D,
+	0xFA,0xAE,0xC5,0x44,0x91,0xFB,0x78,0x84,0x86,0xD5,0xB9,
+	0xF5,0xE7,0xA2,0x1C,0xC7,0x3C,0x87,0x85,0xB0,0xE6,0xD5,
+	0x9B,0xE7,0x98,0x4F,0x62,0x16,0xF4,0xE9,0x37,0xE4,0x29,
+	0xF1,0x14,0xE5,0xA1,0xD1,0xB5,0x2D,0xAC,0xF9,0xCE,0x06,
+	0x46,0x68,0x34,0x69,0x14,0xF7,0x40,0xB5,0xEB,0xB7,0x2E,
+	0x99,0x3B,0x5C,0xF4,0xB5,0xF2,0xCA,0x92,0x4F,0xAA,0x81,
+	0xC8,0xD6,0x40,0xA1,0x54,0xA4,0x0B,0x76,0xB2,0xAA,0x22,
+	0x4B,0xCB,0x0A,0xEF,0x7A,0x3A,0xDF,0x79,0x9F,0x19,0x72,
+	0xE8,0x76,0xAB,0xA6,0xA5,0x4F,0xAD,0x6C,0x80,0x30,0x42,
+	0x81,0xC6,0x2D,0xD5,0xFD,0x68,0xE1,0xBE,0xAA,0x76,0x2A,
+	0x12,0x02,0xFB,0xB6,0x62,0x72,0x6D,0x88,0x39,0x03,0xAD,
+	0xEE,0x43,0x0F,0xF3,0x25,0x27,0x56,0x8D,0x93,0xB9,0xCB,
+	0x79,0xAB,0xB5,0xED,0x7C,0x78,0xB4,0x08,0x5E,0x9A,0x8F,
+	0x3B,0xA4,0x1C,0x16,0x8C,0xAC,0x89,0x06,0xFC,0x27,0xEA,
+	0x45,0x28,0xFA,0x86,0x51,0x88,0x2D,0x29,0x75,0x19,0x11,
+	0x78,0x37,0xEB,0x92,0xE1,0x22,0x57,0xC7,0xCE,0xC4,0x03,
+	0x22,0x05,0xA6,0xBB,0xF4,0xF1,0x13,0x18,0xB6,0x40,0x5C,
+	0x59,0x10,0xA2,0x90,0xE2,0x56,0xFA,0x31,0x63,0x90,0xB2,
+	0x58,0xD5,0xD3,0xE0,0x37,0xCD,0xB6,0xD1,0xEF,0xE2,0xC1,
+	0x8B,0xEB,0x2B,0x8D,0x6A,0xA5,0xEA,0x25,0x5D,0xEB,0x95,
+	0x0E,0xAF,0xA0,0x1C,0xC5,0x91,0x42,0x3A,0x85,0xB5,0x3F,
+	0xAF,0xBC,0xCA,0x81,0x19,0x84,0xA8,0xE4,0x4A,0xAC,0x84,
+	0x43,0x9E,0xAD,0x83,0x9C,0xA6,0xC3,0x61,0x93,0x31,0x06,
+	0x50,0x61,0x2F,0x13,0xD9,0x97,0x81,0x62,0x93,0xFF,0x4C,
+	0xC7,0x89,0x5C,0x16,0x21,0x1E,0x96,0x12,0x3F,0xFA,0x90,
+	0x2D,0xF6,0x7C,0xE5,0xAA,0xF7,0x84,0x5F,0xA2,0x51,0xF4,
+	0xAB,0x59,0xE4,0x52,0xED,0xE3,0xC9,0x5F,0xD1,0x91,0x2E,
+	0x0C,0x0A,0x60,0xB0,0xCC,0x9F,0xD8,0x82,0x6C,0xFE,0xF7,
+	0x11,0x4C,0x75,0x17,0x61,0xF5,0x65,0xFD,0x96,0x22,0x87,
+	0xF0,0xBD,0x33,0x68,0xDE,0xEA,0x04,0xA3,0xDF,0x32,0x16,
+	0xEA,0x0C,0xFC,0x43,0x64,0x1F,0x4A,0x4C,0xFE,0xA7,0xAA,
+	0x3A,0xDA,0x9C,0xB6,0x92,0xC4,0x44,0x47,0x09,0x1B,0x3E,
+	0xBB,0xA6,0x14,0xD9,0x1A,0x1B,0xA8,0x7E,0x56,0xFC,0x93,
+	0x25,0x73,0xE7,0xDB,0x1E,0x35,0xDC,0x56,0x3D,0x54,0xD4,
+	0xB2,0xE7,0xBA,0xAC,0x48,0x9F,0x9E,0xA4,0x7B,0xD3,0xBB,
+	0x5B,0xA5,0x91,0x25,0x16,0xBF,0xDD,0x91,0x73,0x34,0xBE,
+	0x97,0x2A,0xE2,0xAA,0xBA,0x22,0xE1,0xBF,0x7E,0x56,0xA0,
+	0x92,0x87,0x85,0xF8,0xCC,0xC7,0xEC,0xB8,0x27,0x67,0x32,
+	0xA5,0xFE,0x95,0x3C,0x89,0x83,0x88,0xC4,0x77,0xDB,0xE4,
+	0xBE,0xFC,0xF4,0x2F,0x34,0x59,0xB8,0x98,0x8F,0x30,0xF6,
+	0xB9,0xA6,0x31,0x72,0xAC,0x58,0xCA,0xF0,0x7A,0xA4,0x50,
+	0x79,0xE1,0x83,0xDC,0x62,0xD2,0xBB,0xC2,0x9C,0xCE,0x5A,
+	0x3B,0xF5,0xF2,0x53,0x22,0xB1,0x66,0x1C,0x0B,0xE0,0xA1,
+	0xAB,0xC1,0x91,0x57,0x05,0x28,0xE7,0x16,0xFD,0x27,0xDE,
+	0x12,0xBA,0xBC,0x4C,0x06,0xD6,0x89,0x97,0x5F,0xB3,0xB4,
+	0x9A,0x9A,0x75,0x2A,0xFE,0x9A,0x3B,0x70,0xD8,0x26,0x40,
+	0x45,0x3A,0x3F,0x88,0x38,0xFF,0xE5,0x7C,0xCD,0x42,0xDF,
+	0x28,0xF7,0xC7,0xD2,0x6E,0x91,0x59,0x5C,0xEE,0x91,0x34,
+	0xD4,0xCE,0xBB,0x6B,0xAF,0xB1,0xA3,0x21,0x2F,0x2C,0x5A,
+	0x66,0xBA,0xD2,0xEE,0x68,0xEE,0x03,0x26,0xA3,0x26,0xCC,
+	0xB8,0xD3,0x0B,0x91,0x16,0xD5,0x0D,0x72,0xE6,0xB0,0xA3,
+	0x46,0xDE,0x29,0x5E,0x6B,0xCC,0x27,0xE8,0x1E,0xE6,0x62,
+	0x65,0x12,0x37,0xF4,0x23,0x76,0x8A,0x5B,0x2B,0x04,0xEE,
+	0x32,0x87,0x2D,0x44,0xB0,0xC1,0x3C,0x46,0x3C,0x71,0x3C,
+	0x77,0x3E,0xF0,0x1C,0x47,0x1D,0x82,0xC9,0xBC,0xDC,0xBA,
+	0x9E,0xE7,0xFB,0xE5,0x5B,0x76,0x6F,0x8C,0x5E,0xEF,0x9D,
+	0x55,0x9F,0xE5,0xC0,0x7A,0xFC,0x5D,0xA4,0x29,0xCC,0x39,
+	0xC1,0xE6,0xB3,0x1B,0xA2,0x8E,0x80,0x9A,0xF7,0x28,0xF8,
+	0x24,0xF3,0x0D,0x17,0x69,0x62,0x9A,0xF8,0xF3,0x79,0xC3,
+	0x95,0x85,0x5B,0x57,0xD0,0x92,0x7D,0x70,0x93,0x00,0x27,
+	0x69,0xE6,0x4C,0x3F,0xD7,0xDA,0x7B,0x66,0xEA,0xA2,0x32,
+	0x7B,0xDF,0x24,0xED,0x0F,0x55,0x56,0x23,0xEC,0x72,0xA7,
+	0x3C,0x50,0x1A,0x63,0x01,0x67,0xA9,0x01,0xCC,0x8E,0xD0,
+	0xCE,0x01,0x14,0x6E,0xDC,0x2A,0x55,0xCB,0xA6,0x15,0x48,
+	0xE8,0xE0,0x7F,0x98,0x48,0x58,0xA0,0x3A,0x62,0xC2,0xB3,
+	0x1A,0xBE,0xAF,0xBB,0x89,0x55,0xFB,0x87,0xFC,0xCF,0xDF,
+	0xA5,0x7A,0x32,0x27,0x39,0x06,0xD6,0x57,0x7E,0xC3,0x06,
+	0x03,0xDF,0xAA,0xEE,0x4A,0x3D,0x4E,0x2C,0x57,0x3F,0x8D,
+	0xEC,0x8D,0x0A,0xD5,0xAB,0x96,0x0E,0x9F,0x07,0x44,0x1B,
+	0x72,0xAB,0xF1,0x79,0x64,0xEE,0x86,0xDA,0x59,0x64,0xC3,
+	0xDE,0xF7,0x95,0xDA,0x0E,0x02,0x32,0x06,0xD1,0x1E,0x42,
+	0xC6,0x5E,0xCD,0xA1,0x0B,0xCE,0x41,0xF0,0xA4,0xC9,0x1D,
+	0xEB,0x8D,0xAC,0x41,0xA4,0xCE,0xE4,0x9F,0x53,0x94,0x41,
+	0x3A,0xB9,0x96,0x8B,0xFF,0x2A,0x25,0x81,0x30,0x3E,0x08,
+	0xFC,0xAA,0xE5,0x3F,0x7F,0x58,0x50,0xE5,0xE4,0x83,0x4C,
+	0x2C,0xE0,0xF5,0xB8,0x82,0x8F,0x7F,0xCC,0x89,0xBD,0xB9,
+	0x80,0xC8,0xC3,0x5D,0xE1,0x70,0xDB,0x70,0x29,0xC0,0x20,
+	0xDB,0xC5,0xB0,0x66,0x95,0x12,0x9A,0x81,0xCF,0xBB,0x3E,
+	0x4B,0x0C,0x05,0x4A,0x34,0xEF,0xAC,0x47,0xFC,0x99,0x28,
+	0x77,0x14,0x76,0x5F,0x42,0xD2,0x98,0x63,0x6D,0x40,0x66,
+	0xC2,0xB1,0x75,0xCB,0x85,0xAB,0x73,0xDA,0x15,0xF5,0xD7,
+	0xE7,0x01,0x95,0x86,0x81,0x6A,0xF9,0x21,0xB2,0x44,0xD3,
+	0xDB,0xF5,0x57,0x42,0xF5,0xFB,0x75,0x35,0xA9,0x4F,0xBC,
+	0x98,0xB1,0x41,0xAD,0xAB,0x7B,0xBF,0x0E,0xD8,0x1D,0x4D,
+	0x7C,0xD0,0x0F,0x58,0xF0,0xCA,0xE7,0xB5,0x3D,0xA6,0xF7,
+	0x3A,0xD1,0xBD,0xB1,0xF7,0xCE,0xDE,0x0F,0xB3,0x35,0x8A,
+	0xE6,0xA0,0x08,0x75,0x36,0x84,0xA4,0x5E,0xFF,0xF8,0x5C,
+	0xA4,0xF0,0x7E,0x0D,0x88,0x83,0x8B,0x04,0x0A,0xD5,0x81,
+	0xBA,0xB0,0x78,0xE8,0x3B,0x90,0x32,0xFE,0xD7,0xD0,0x1B,
+	0xF8,0x85,0x17,0x56,0x84,0xAC,0x1A,0xAE,0xB3,0xD9,0x08,
+	0x31,0xC9,0xAF,0x1F,0x38,0xE2,0x04,0x6E,0x2E,0x7C,0x02,
+	0xB0,0x9A,0x47,0x6D,0x1C,0x1E,0x20,0xF9,0x8F,0x10,0x00,
+	0xA7,0xBC,0x7F,0x43,0x5C,0xEC,0x43,0xB5,0x32,0xDA,0x53,
+	0x38,0xE5,0x76,0x50,0x36,0x59,0x82,0xE7,0x32,0xDA,0x59,
+	0x5C,0x7F,0x4D,0x02,0xBB,0x5C,0xF5,0x74,0x94,0x6F,0x20,
+	0x99,0x1F,0xD8,0xE2,0xED,0x56,0x97,0x05,0xFD,0xD0,0xA2,
+	0x58,0x19,0xCF,0xD9,0x03,0x2C,0xFD,0xD0,0xD0,0x20,0x81,
+	0x63,0x8A,0xA3,0x76,0xF6,0xFA,0xD5,0xC0,0x29,0xF5,0x31,
+	0x45,0xF3,0xBA,0x48,0xAA,0x50,0x44,0xEC,0xED,0x47,0x44,
+	0x60,0xA8,0xC2,0xB2,0x43,0x4F,0x65,0x1F,0x19,0x41,0xAB,
+	0x3B,0xCE,0x11,0x87,0x8C,0xC0,0x00,0x11,0x96,0xFF,0xB8,
+	0x89,0x89,0x7C,0x4A,0x1C,0x02,0xDD,0xE1,0xC8,0x88,0x4D,
+	0xAA,0x58,0x8F,0xD1,0x93,0xBA,0x88,0x2C,0xE3,0xC4,0xDA,
+	0x2A,0xB2,0xB1,0x99,0x4D,0xF7,0x33,0xFB,0x84,0x6E,0x96,
+	0x48,0x11,0x30,0xF0,0x58,0x4B,0x9D,0x47,0xE0,0x37,0x74,
+	0xCE,0xAA,0x72,0x9F,0xC8,0x3C,0x16,0x17,0x76,0x04,0xB3,
+	0xCA,0x4B,0x3B,0x38,0xBF,0xC4,0x82,0xA5,0x7C,0x5E,0xBE,
+	0x87,0x04,0xF9,0x98,0xA4,0xB0,0xEA,0x58,0xC2,0xF2,0xE9,
+	0xE0,0x34,0xAC,0x07,0x95,0x12,0xC9,0x15,0x6D,0x77,0x4F,
+	0xBC,0xC8,0xA9,0xEA,0x0D,0x0B,0xC8,0xFA,0x5A,0x77,0xF2,
+	0x46,0x64,0xFD,0xED,0x38,0x76,0x17,0x3A,0x13,0x15,0x08,
+	0x6D,0x04,0xD1,0x97,0x60,0x4B,0xF0,0x5D,0x80,0x4E,0xF0,
+	0xF0,0x8F,0xF3,0xCF,0x4A,0xEF,0xB8,0x79,0xAF,0xFF,0x7C,
+	0x54,0xA0,0xC9,0x0C,0xCB,0x84,0x71,0x33,0x41,0x56,0xC9,
+	0x9A,0xD6,0xCA,0xCB,0x23,0xC6,0x4D,0x87,0xC8,0x04,0x76,
+	0x39,0xDD,0x4A,0x2D,0x8B,0x85,0xE2,0x4B,0xEF,0x7C,0xAC,
+	0x9D,0xBA,0xBE,0x5F,0xD3,0x7A,0xB9,0x9C,0xF2,0x8D,0x72,
+	0x3A,0x96,0x6E,0x5A,0xAB,0x22,0x95,0x2B,0x14,0xC2,0x9D,
+	0x58,0x8E,0xFB,0x2A,0x90,0xC8,0x29,0x88,0xED,0x5D,0x71,
+	0x60,0xE1,0xA5,0xF5,0xC6,0x7F,0x64,0x95,0x5F,0xEF,0x09,
+	0x76,0x56,0x44,0x18,0x0A,0xD7,0x86,0x94,0xAA,0xC3,0xC4,
+	0x73,0x4E,0xB0,0xDA,0x74,0x15,0xCA,0x65,0x96,0xE0,0x71,
+	0x22,0x4B,0xFC,0xFF,0x44,0x12,0xD1,0x2D,0xF0,0x7D,0x9F,
+	0x76,0xD1,0x2C,0x07,0x4A,0x87,0x0A,0xE2,0x3E,0x7B,0x90,
+	0xBE,0x59,0xB9,0xFA,0x67,0x0E,0x4E,0x96,0x36,0xE5,0x31,
+	0x52,0x3D,0x55,0x9C,0x79,0xB9,0x13,0xBD,0xF7,0xAD,0xCF,
+	0xD5,0xF4,0xDA,0x77,0xE6,0x05,0x06,0xCA,0xF2,0x44,0xD4,
+	0x31,0x7F,0xAF,0xD2,0xFF,0xD8,0x8D,0xA0,0xA4,0xE8,0x0C,
+	0x60,0x86,0x0D,0x7A,0xC7,0x1B,0xED,0xF6,0xA3,0xF7,0xDA,
+	0xA5,0x2B,0x4D,0xB3,0x7C,0x6E,0xF8,0x94,0xA5,0x00,0xB2,
+	0xB8,0x88,0xE8,0x69,0x2D,0x4D,0x2D,0x19,0x2F,0xD1,0x7B,
+	0xAD,0x96,0x09,0xEA,0x9E,0x4F,0x82,0x1E,0x48,0x09,0x95,
+	0xFE,0xE9,0x5C,0x0B,0xF4,0xB1,0x32,0x74,0x38,0xB7,0xD8,
+	0xD3,0x9C,0x15,0x28,0xA7,0xF0,0xB8,0x19,0x1A,0x0C,0xAE,
+	0x36,0x51,0x6F,0x22,0xB5,0xE0,0x82,0x47,0xB7,0x2B,0xA6,
+	0x40,0x1B,0x92,0xA7,0x9A,0x41,0x31,0x02,0x72,0xE3,0x81,
+	0xAC,0xFE,0xAB,0x31,0x13,0x15,0xD2,0xBB,0xCC,0x23,0x1C,
+	0x59,0xFD,0xCA,0xFA,0x25,0x89,0x0F,0x63,0x57,0x53,0x97,
+	0x45,0xD1,0xE3,0x0F,0x7B,0x5B,0xAE,0xAE,0x8D,0xA9,0x42,
+	0xEB,0x5E,0xCB,0xFD,0xBE,0x98,0x47,0xAE,0xEB,0x7A,0x1D,
+	0x04,0x4F,0xA4,0xB6,0x23,0x25,0xA2,0xB7,0xA8,0x5A,0x5F,
+	0x99,0x7A,0x29,0x84,0x56,0x28,0x14,0xA6,0x3D,0x11,0xF0,
+	0xD5,0xF7,0x2A,0x61,0xCB,0xA8,0xC2,0x1A,0x13,0xC5,0x67,
+	0x5A,0xD8,0x28,0x59,0x71,0x7B,0x20,0x3B,0x80,0xB0,0x75,
+	0x1D,0x92,0xE0,0x31,0xA8,0x5E,0xF3,0xB0,0x97,0xBB,0xD7,
+	0xA6,0xC7,0x80,0x44,0x97,0xA0,0xBC,0x5A,0x70,0x37,0xFD,
+	0xD7,0x7C,0xE5,0xD5,0xD1,0x29,0x0E,0xE6,0xDA,0x95,0x68,
+	0x7E,0x96,0xE9,0x18,0xB1,0x22,0x7A,0xCE,0xB6,0xE2,0xFC,
+	0x78,0x1A,0x1F,0x8B,0x68,0x5B,0x51,0xD0,0x45,0xEB,0x1C,
+	0xB8,0x26,0x3A,0xD1,0x54,0x69,0x03,0x17,0x73,0x79,0x14,
+	0x9F,0x77,0x69,0x50,0xEB,0xA6,0x87,0x8F,0xC4,0x54,0x51,
+	0x74,0x5B,0x9C,0x21,0x32,0x25,0x16,0x8D,0x2A,0xD6,0x8E,
+	0x91,0x50,0x33,0x66,0x31,0xED,0x95,0x36,0x99,0x25,0xC1,
+	0xFE,0x82,0x1F,0x89,0x86,0x01,0x66,0x75,0xC6,0x6C,0x27,
+	0x20,0xCB,0x6A,0x16,0x06,0x09,0xF0,0xD0,0xC5,0xCF,0x72,
+	0x04,0x5B,0xF0,0xAB,0x2B,0xF0,0x57,0xF5,0x9C,0xE6,0x6E,
+	0x4F,0xA8,0xE2,0xEE,0x75,0x40,0x15,0x83,0x48,0xB9,0x05,
+	0x7C,0xCA,0x7F,0x42,0x3F,0x9F,0xE3,0x4B,0x79,0xBA,0x72,
+	0x92,0x01,0x7E,0x17,0x82,0x9C,0x80,0xE6,0x15,0xDF,0xD4,
+	0x59,0x8C,0x52,0x37,0xC9,0x31,0xEA,0xDA,0xA7,0x6B,0xE4,
+	0xC3,0x2E,0x2B,0xA6,0xE5,0xE7,0xBA,0xDB,0x5C,0x6E,0x52,
+	0x8F,0xC2,0x70,0xB7,0xBE,0x69,0x60,0xCD,0xD7,0x5E,0x14,
+	0xEC,0xF6,0x9C,0x12,0x3D,0x07,0x77,0x06,0xDD,0x2C,0xF0,
+	0x19,0xC0,0x6A,0xFC,0x47,0x3B,0x5A,0x79,0x82,0x60,0x18,
+	0x2A,0x59,0xB5,0xFF,0x35,0x54,0xA1,0x29,0xD9,0x8F,0xDD,
+	0x93,0x2B,0x50,0xB2,0xBA,0x7F,0xC7,0x09,0x40,0xFB,0xC0,
+	0x65,0xCE,0x05,0xD0,0x55,0x33,0xCF,0x61,0x52,0xE5,0x04,
+	0x6B,0x3A,0x8C,0x78,0xAB,0xEE,0xF8,0xA0,0x8F,0xEA,0x10,
+	0x5E,0x17,0x3A,0x32,0x5E,0x54,0x62,0x86,0x17,0x32,0xBE,
+	0x35,0x5B,0xAD,0x5B,0xB3,0x7A,0x35,0x2D,0x66,0x65,0x2B,
+	0xC3,0x03,0xF4,0x83,0x77,0x49,0x36,0xB5,0xF2,0x93,0xDD,
+	0x73,0x35,0x0D,0x16,0xE3,0x3D,0x6E,0x1F,0xFF,0xB2,0x2C,
+	0xBD,0x07,0xF3,0x2A,0x5F,0x3A,0x1C,0xAC,0xB1,0xC0,0x56,
+	0x93,0xCA,0x9B,0xEB,0xB6,0x34,0x97,0x36,0x2B,0xD2,0x3F,
+	0x01,0x4E,0x26,0xD8,0xF0,0x6B,0xF9,0xFE,0xC9,0x86,0x02,
+	0x8E,0x48,0x93,0x3F,0xD9,0xCA,0x06,0x95,0xDA,0xCF,0x6B,
+	0xA4,0x1A,0x94,0xD8,0x75,0x9A,0x17,0x9F,0xD6,0x30,0xD3,
+	0x80,0xC3,0xDB,0x37,0x8F,0xA8,0xE2,0x29,0x4D,0x29,0x1C,
+	0x22,0x67,0x64,0xA0,0xDF,0xE4,0x03,0xD2,0x9A,0xA2,0x02,
+	0xD4,0x2E,0x96,0xFB,0x7D,0xA3,0x9D,0x56,0x0D,0xAD,0x48,
+	0x12,0xF3,0x2C,0x68,0xCF,0x89,0x86,0xB3,0x28,0xDA,0x08,
+	0x28,0xEF,0xC4,0x7B,0x34,0xEF,0xEC,0x2F,0x9D,0xD6,0x35,
+	0x27,0x91,0x67,0xBA,0xCF,0xAB,0x0C,0x5F,0x7E,0x92,0xA2,
+	0xFC,0x7C,0x9A,0xB7,0xEE,0xEF,0xF5,0x73,0x48,0x2E,0xF2,
+	0x8F,0xF5,0xFC,0x44,0xBA,0xD5,0x23,0x3E,0x90,0xE2,0xE1,
+	0x88,0xC1,0x70,0x7A,0xB9,0x82,0x83,0xF3,0x3C,0xC3,0x4F,
+	0x3B,0xB5,0xC0,0x90,0x03,0xC5,0x92,0x48,0xE5,0xD6,0x66,
+	0xEB,0xBC,0x9B,0x5A,0x84,0x0E,0xC1,0x9F,0x68,0xF5,0xDF,
+	0x70,0xED,0x7C,0x27,0x8D,0x07,0xAF,0xF3,0xD2,0xE6,0x2B,
+	0x2E,0x76,0x2B,0x19,0x38,0x6E,0x56,0xDF,0x2C,0xFB,0x35,
+	0xD8,0x37,0xDF,0xCF,0x7C,0xE6,0x54,0xFD,0x1B,0x74,0xF2,
+	0xD1,0xFA,0xA0,0x79,0xE9,0xAD,0xE7,0xD6,0x7E,0xFD,0xBE,
+	0x0F,0x9D,0xB2,0x9E,0x1C,0x34,0x80,0x3E,0x5E,0x32,0x6D,
+	0x45,0xEE,0xB1,0x13,0x74,0x23,0xB8,0xA9,0xC6,0x66,0x5C,
+	0xBC,0xB5,0x69,0xD2,0xCC,0xFF,0xC6,0x34,0x3F,0xBF,0x32,
+	0xE2,0x4E,0xA7,0xA9,0x08,0xC5,0x94,0xA6,0xF0,0xA4,0xD3,
+	0x55,0x04,0xAF,0x23,0xBB,0x36,0x8C,0x24,0x16,0x8C,0xBC,
+	0xB1,0x73,0x81,0x3D,0xDB,0xCC,0x55,0x62,0xD3,0x0F,0x8D,
+	0x73,0x50,0xB0,0x66,0x53,0xE1,0x0D,0xFC,0xCA,0x82,0x81,
+	0x21,0x36,0x58,0x5C,0x6A,0x01,0xDE,0x19,0x0C,0x26,0x74,
+	0x20,0x9A,0xA0,0xDC,0x41,0x0A,0x7A,0xB7,0xB5,0x73,0x0F,
+	0x53,0x87,0x73,0x83,0xC6,0x40,0xD9,0x52,0x7A,0x63,0xFA,
+	0x4D,0xAC,0xA5,0xCA,0xB9,0x99,0x2A,0xEE,0x9F,0x1D,0xF7,
+	0x4B,0x3D,0xE6,0x92,0xA1,0x9E,0x69,0xCE,0x11,0x26,0x6B,
+	0xCF,0x83,0xC7,0xBC,0x6F,0x49,0x9D,0xBF,0x7C,0x15,0x9A,
+	0x74,0x45,0xFF,0x44,0x50,0xEE,0xB9,0x40,0x2B,0x34,0x76,
+	0x9F,0xDA,0xC7,0x57,0xB6,0xB8,0x37,0xC2,0x5C,0xBF,0xDB,
+	0x8F,0x7C,0x49,0x3D,0x59,0x7C,0x4E,0xA1,0x59,0xD1,0x31,
+	0x41,0x14,0x85,0x4E,0x6E,0x7F,0x58,0x2F,0x2B,0xE2,0x5E,
+	0x91,0x20,0xB7,0x8B,0xCA,0x69,0xCE,0xE0,0x5D,0x4D,0x47,
+	0x51,0x15,0x50,0xFF,0x03,0x9E,0x28,0x3F,0xC5,0x58,0x7B,
+	0x70,0x41,0x8B,0x97,0x37,0x76,0xD0,0xDF,0xE2,0x77,0x09,
+	0xF9,0x7D,0xA2,0xE7,0xE7,0xDF,0xB7,0xC8,0x17,0xB2,0x23,
+	0x02,0xE1,0x7E,0xD1,0x11,0x29,0x9B,0x0B,0xDC,0x6C,0x7C,
+	0xDA,0x30,0x70,0x63,0xCC,0xFD,0x13,0xEC,0xE6,0xD8,0xDD,
+	0x81,0x0A,0x91,0x7E,0xBD,0xA7,0x9D,0x70,0x46,0x87,0x9E,
+	0xB7,0x16,0xF3,0x11,0xFE,0xB2,0xFD,0x70,0x67,0x63,0x98,
+	0xB3,0xC5,0xAB,0x18,0xBF,0x20,0x47,0x34,0x3A,0xD7,0xEC,
+	0xAA,0xC5,0x35,0xBB,0x2A,0x09,0x59,0x8F,0x6A,0x27,0x94,
+	0xC0,0x5B,0x64,0xBE,0xFB,0xDB,0xF0,0x0B,0xED,0xC6,0x06,
+	0xD1,0x57,0xE2,0x36,0xA5,0x7B,0x8D,0x2C,0x02,0xCC,0xEA,
+	0xFB,0x55,0xA9,0x34,0x14,0x06,0x7A,0xEB,0xF2,0x60,0xE8,
+	0xB9,0xE4,0x12,0x4D,0x63,0x31,0xAA,0x8B,0x55,0xBF,0x58,
+	0x6A,0x23,0x9B,0xC4,0x59,0xAA,0x77,0x53,0x57,0x27,0xF8,
+	0xCE,0xDB,0xF5,0xBE,0x65,0xA6,0xD8,0x11,0x0B,0xBE,0x3C,
+	0x27,0xC9,0xFE,0x0C,0xA5,0xFA,0x08,0x30,0xFB,0x95,0x82,
+	0x19,0xC7,0x13,0x5C,0x69,0x9C,0xB3,0xC0,0x09,0x1F,0x1A,
+	0x69,0xB0,0x98,0xCD,0xFF,0x0A,0x03,0x61,0x53,0x87,0x70,
+	0xBF,0xDD,0xC4,0x5E,0x83,0x25,0x52,0x33,0xC6,0x08,0x1C,
+	0x4D,0x50,0x14,0x54,0x38,0x2A,0xB7,0xF7,0x85,0x7F,0x12,
+	0xFC,0xF9,0x1A,0x47,0xCA,0xB2,0x98,0x1E,0x8F,0xCA,0x81,
+	0x23,0x71,0x1C,0x6B,0x0D,0x93,0x9F,0xF2,0xF9,0xD6,0xE3,
+	0x69,0x65,0xAD,0xBB,0x75,0xF4,0x41,0xFF,0x6B,0xD3,0x42,
+	0x35,0x0A,0xAD,0x17,0xB9,0x74,0x4B,0x90,0x8B,0xDF,0xCD,
+	0xF1,0x68,0x37,0x52,0x77,0x57,0x45,0x01,0x47,0xED,0x10,
+	0xB6,0x6B,0x54,0x92,0x6B,0x22,0x0A,0x8E,0x6E,0x97,0x67,
+	0xFC,0x8D,0x53,0x0E,0x68,0x11,0xF3,0x61,0xCA,0xDF,0x00,
+	0xFB,0x4C,0x67,0x35,0xDC,0xCD,0xF2,0x18,0x7F,0x3F,0x04,
+	0xD5,0xEC,0xB3,0x38,0xF4,0x03,0x3D,0x80,0x66,0x3D,0x96,
+	0xF8,0xF7,0x0F,0xDF,0x8B,0x58,0x69,0x92,0x78,0xB5,0x38,
+	0x40,0x1C,0x9B,0x56,0x1F,0xDF,0x02,0x53,0x9F,0xA1,0x7B,
+	0xCA,0x6B,0x21,0xFF,0x16,0xFA,0x78,0x38,0x13,0x39,0xCA,
+	0x40,0xC3,0x73,0x56,0x7F,0xB8,0xD8,0xAA,0x74,0xBE,0xFC,
+	0xF3,0xBF,0x0F,0xD7,0x2F,0x58,0x6D,0x01,0xD5,0xDB,0xBF,
+	0x3F,0x0B,0x6E,0x83,0x58,0xFC,0x91,0xB8,0xAD,0x1A,0xA1,
+	0xA5,0xDF,0x3B,0xDB,0x45,0xD8,0x2E,0x27,0xFA,0x35,0x1B,
+	0x8E,0xAF,0x29,0x00,0xDA,0x35,0xCA,0x89,0x9F,0xFC,0x6E,
+	0x9D,0x3A,0xFC,0x71,0xEA,0xE0,0xD2,0xB5,0xF3,0x0B,0x45,
+	0xE4,0xA1,0x3E,0x18,0x45,0x2C,0xBF,0xEC,0xB5,0x75,0x9F,
+	0xD5,0x85,0x92,0x47,0x01,0x3D,0xD3,0xA8,0xB4,0x9F,0x2B,
+	0x7D,0x5C,0x84,0x12,0x1E,0x91,0x9F,0x8E,0xD3,0xC2,0x0B,
+	0xD6,0x56,0xBB,0x1D,0x54,0xD7,0xAB,0x6D,0xED,0xC5,0x56,
+	0xB4,0x93,0x8A,0x1A,0x02,0x8F,0x98,0x77,0x8B,0x8A,0x66,
+	0x2E,0x29,0x7B,0x65,0x0F,0x99,0x7C,0x24,0xA2,0x67,0x87,
+	0xE6,0x44,0x77,0x37,0x61,0x3B,0xBF,0xD7,0xB6,0x26,0xB6,
+	0x41,0x3E,0x97,0x3F,0xC0,0xEB,0x39,0x29,0xBC,0x14,0x34,
+	0x45,0x28,0x5C,0xC4,0x77,0xEE,0x9F,0x82,0xAC,0xB0,0x34,
+	0x9C,0xA0,0x5A,0x42,0x7F,0xF9,0xA1,0x55,0x59,0x53,0x5D,
+	0x5F,0x5D,0x57,0xE3,0x38,0xEC,0x28,0x68,0xE6,0x57,0xDB,
+	0xE2,0xBD,0x48,0x3C,0x1A,0xFD,0x23,0xAA,0x84,0x18,0x8B,
+	0x29,0xDB,0x3A,0xDA,0x7C,0xB5,0xA9,0xE4,0xA6,0xB1,0x28,
+	0x85,0xF6,0x08,0x25,0x76,0x09,0xFE,0x29,0x95,0xE9,0xFA,
+	0x78,0x16,0xF9,0x75,0xC5,0x0B,0x79,0xEF,0xA1,0xAA,0x36,
+	0xD7,0x3C,0x77,0xC9,0xFD,0xDF,0xBB,0x08,0x2F,0x75,0xBC,
+	0xDE,0xEE,0x3D,0xCC,0xD7,0x64,0x6D,0xE0,0xAB,0xED,0xD5,
+	0x17,0xFA,0xA6,0x65,0x2F,0x62,0xDB,0x10,0xAD,0x9B,0x33,
+	0xFA,0x8D,0x88,0xA2,0x9F,0xAE,0x73,0xFA,0xD7,0x11,0x28,
+	0xA9,0x58,0xB3,0x19,0xBC,0x24,0x73,0xE0,0xF0,0x8C,0x6C,
+	0x54,0xCF,0x2F,0x43,0x99,0x1D,0x43,0xEB,0xA3,0x2C,0x46,
+	0xD7,0x63,0x4D,0x23,0x5A,0xBF,0x34,0xA0,0x9A,0x72,0x4D,
+	0xF4,0x6C,0x7A,0x0F,0x9E,0x00,0x06,0x8D,0xE7,0x67,0x16,
+	0x65,0x7A,0xE8,0xD8,0xEF,0x40,0x77,0xDE,0x5F,0x40,0xB0,
+	0xB5,0xBB,0xBE,0xEC,0x82,0x15,0x55,0xF5,0x10,0x03,0x36,
+	0x8B,0x44,0x0F,0x8C,0xE3,0x13,0x9E,0x6F,0x69,0xD2,0x0D,
+	0xDB,0x56,0x9D,0x43,0xC7,0xA1,0xDF,0x66,0xCB,0xA5,0xA7,
+	0x1B,0xBE,0x74,0x16,0x7C,0xF9,0x26,0x60,0xE7,0x55,0x7E,
+	0x4E,0x63,0x77,0xF4,0x28,0x8E,0x94,0x88,0xC8,0xFC,0x7D,
+	0x36,0x0D,0xB1,0xA5,0x44,0x17,0xF0,0xAB,0xB8,0xDF,0x9B,
+	0x05,0x2D,0xE3,0xEC,0x4C,0x71,0xC8,0x6F,0xF5,0x46,0xEB,
+	0xE5,0x96,0x3D,0xA5,0xBE,0xD3,0x30,0x19,0xF0,0xE1,0x35,
+	0x2C,0xBF,0xDB,0xBC,0x80,0x0D,0x43,0xCC,0x51,0x3F,0x89,
+	0xAA,0x8B,0x89,0x2E,0x65,0x61,0x57,0x2E,0x35,0xD2,0x01,
+	0x66,0x0F,0xC6,0x6A,0x46,0x2C,0x8E,0xDD,0x68,0xE8,0x44,
+	0xDD,0xCD,0xDA,0x60,0x34,0x36,0xAB,0x19,0xEC,0xE3,0x81,
+	0x59,0x13,0xAB,0xAB,0x3F,0x32,0x8E,0x53,0xAE,0x8D,0xB3,
+	0x1F,0x97,0x97,0x2D,0x56,0xE5,0x93,0x6B,0x5C,0xEC,0xB9,
+	0x42,0xFC,0xEA,0x24,0x96,0x3C,0xB9,0x96,0x4A,0xAA,0x38,
+	0xD7,0xBC,0xF1,0x84,0x64,0x70,0x8A,0x1F,0x67,0xC6,0x3F,
+	0x7F,0x2E,0xA6,0x2F,0x60,0xE0,0x74,0xD7,0xC9,0xDC,0xFC,
+	0xF2,0xC3,0x2D,0x75,0x07,0xFD,0x9D,0x56,0x3C,0x5A,0x98,
+	0xD1,0xE7,0xA7,0x6F,0xF2,0xBD,0x73,0xEC,0xA8,0x74,0xE9,
+	0x63,0x5E,0x1C,0x04,0xA3,0xF7,0xFD,0x0E,0x82,0x0B,0x23,
+	0x37,0xC3,0xB8,0xD3,0x5C,0x6C,0x80,0xC5,0x03,0x4F,0x4C,
+	0x02,0xFC,0x78,0x89,0x69,0x7C,0x18,0xE6,0xF5,0xFF,0xCB,
+	0xFD,0x81,0xE5,0xB9,0x6D,0x46,0xE6,0x03,0x1F,0xAA,0xBD,
+	0x9A,0x78,0xB9,0x04,0x1D,0x5E,0x8C,0x39,0x54,0x84,0x9F,
+	0x18,0xBC,0x5B,0xAE,0x5E,0xDE,0x56,0xA2,0xBF,0xD4,0x47,
+	0x50,0x90,0x45,0x9F,0x1B,0xC4,0x03,0xBC,0x26,0x01,0x77,
+	0xD1,0xC4,0x84,0xE7,0x7E,0x4B,0x7F,0x4A,0xB6,0x66,0x2E,
+	0xE8,0xF1,0x70,0x8B,0x7C,0xB8,0x8D,0xA7,0x9F,0x7B,0x07,
+	0xB2,0xD2,0x43,0x9D,0x31,0xE2,0x6A,0xC9,0x80,0x3F,0xB2,
+	0x5C,0x79,0x3A,0xFB,0x86,0x57,0x91,0x3B,0xE1,0x15,0xBB,
+	0x7F,0x60,0xA3,0x27,0x6D,0x0D,0x04,0x0D,0x63,0x3D,0x5E,
+	0xC5,0x8F,0x03,0x09,0x9D,0x4C,0x60,0xE2,0xF4,0x8A,0x75,
+	0x28,0x73,0xE6,0x6F,0xD5,0xC1,0xCD,0x8D,0x1E,0x4C,0xA5,
+	0xDB,0x40,0x40,0x9E,0x90,0xCC,0xBC,0xE2,0x88,0xDE,0xE8,
+	0x82,0xFA,0x98,0xE6,0x6A,0xE1,0xB3,0x4B,0x93,0x4E,0x2E,
+	0x9A,0x43,0xB5,0x4F,0x6B,0x9F,0xAD,0xEB,0x55,0x3F,0x67,
+	0x59,0xE5,0xDB,0x2D,0xDB,0x7D,0x70,0x08,0xE0,0x03,0x8D,
+	0x7F,0x3E,0xFD,0x9D,0xB9,0x24,0xB0,0xF9,0xFB,0x56,0x91,
+	0xD8,0x99,0xAB,0xDF,0x6D,0xAA,0x90,0x76,0x6F,0xEA,0x7D,
+	0xA2,0xC4,0x34,0x45,0x49,0xA7,0x44,0x32,0x0E,0xA4,0xB8,
+	0x99,0x05,0xFF,0x5D,0x8B,0xC8,0x25,0xA7,0x30,0x62,0x6A,
+	0xE3,0xBE,0x8E,0x6C,0xD1,0xB9,0x93,0x82,0x6E,0x49,0xFC,
+	0x83,0x36,0x27,0xE1,0x29,0x76,0x30,0xA3,0x11,0xE9,0x0C,
+	0xBF,0xF1,0x14,0x25,0xE2,0x18,0x7A,0x6C,0x74,0x94,0x2F,
+	0x6E,0x12,0x0D,0x2D,0x97,0x35,0x7A,0x9D,0x85,0x5F,0x2B,
+	0x6B,0xF8,0xEC,0x27,0x4B,0x8C,0x9B,0x59,0x7A,0x55,0xBC,
+	0xF5,0xE0,0xBC,0x1E,0x11,0x2B,0xD2,0xD9,0x90,0x25,0x57,
+	0x8E,0x1D,0x6C,0x68,0x10,0xD4,0x11,0x3D,0x96,0x85,0x2F,
+	0x26,0xAA,0xF8,0x95,0xA8,0x1A,0x2B,0x63,0x99,0x67,0x88,
+	0x63,0x2E,0x63,0x67,0x47,0xBD,0xE2,0xCE,0xA3,0xAD,0xCB,
+	0x35,0x8D,0xF2,0xB2,0xF0,0xAA,0xFF,0xA7,0x69,0xEA,0x15,
+	0x51,0x70,0x22,0x5B,0x39,0x85,0xF3,0x57,0xF7,0xEA,0x55,
+	0xBF,0x46,0x8D,0xD8,0x96,0x7C,0x8D,0x5D,0xAE,0xB7,0xA2,
+	0x23,0xBE,0x05,0xE2,0x47,0x5F,0xA1,0xE1,0xAD,0xDF,0xD1,
+	0x8F,0x18,0xE3,0xC0,0x0F,0xE2,0x68,0x1D,0x1A,0xD1,0xCA,
+	0x42,0xE7,0x33,0xC6,0x6D,0x36,0x89,0xA3,0xF1,0x68,0x64,
+	0xEB,0x36,0xDA,0x77,0x55,0x4C,0xEF,0xB8,0x87,0x5D,0xD4,
+	0x7C,0x89,0xAE,0xDE,0xDF,0x38,0xBD,0xA2,0x38,0xC1,0x64,
+	0x73,0x1E,0x02,0xF1,0xA9,0xCE,0x92,0x15,0xCF,0x26,0x77,
+	0xBD,0xD5,0x45,0x84,0x6D,0x20,0xFE,0xCB,0xEE,0xCD,0xC2,
+	0x8B,0x5D,0x7E,0x36,0x42,0xE2,0x8E,0x3C,0xCC,0xB1,0x85,
+	0xC2,0x1F,0x8F,0xB3,0x3D,0x1D,0x54,0x85,0xBF,0x57,0x95,
+	0xF4,0x87,0x5E,0xC5,0x8D,0x51,0xBE,0xF3,0x6C,0x81,0xEA,
+	0x13,0x95,0x70,0x36,0x2B,0x7A,0x6B,0x37,0xF5,0x08,0xF5,
+	0xEB,0x84,0x39,0xD5,0x94,0x9D,0x83,0x3B,0xF3,0x36,0x5B,
+	0x25,0x77,0x40,0x64,0x97,0x4D,0xC2,0x4C,0x6B,0x48,0x8E,
+	0x58,0xC9,0xDF,0x75,0x01,0x26,0xF9,0x7A,0xF8,0x44,0xBA,
+	0xB8,0x0A,0x52,0x26,0x23,0xA3,0x9E,0xB3,0x99,0x78,0xEB,
+	0xFE,0xD2,0xE7,0x39,0xB4,0x4C,0xF3,0xB2,0xDB,0x95,0x38,
+	0xBE,0x53,0x4B,0x7A,0x90,0xE9,0x13,0xDE,0xA7,0xA0,0xD2,
+	0x24,0x5A,0x9B,0x6C,0x85,0xEA,0xA0,0x49,0xED,0x0D,0x38,
+	0xFC,0x9B,0x79,0x8C,0xDA,0xF9,0x8B,0x68,0xEA,0x60,0x45,
+	0x82,0x48,0x8B,0xC4,0x87,0x4C,0xD3,0x7D,0x10,0xE3,0x30,
+	0x99,0x57,0x3E,0x70,0x18,0x7F,0x19,0x04,0xAE,0x12,0xDE,
+	0x96,0x02,0xC5,0x6B,0x92,0x14,0xA7,0x55,0x05,0xCD,0x05,
+	0x26,0x6A,0xE4,0xF6,0x78,0x86,0xA8,0xBF,0x6E,0x7C,0x31,
+	0xB8,0xA0,0x0A,0x5D,0x3F,0xE4,0x1A,0xC0,0x14,0x24,0x42,
+	0x7F,0x66,0x92,0x3F,0x7A,0xE6,0x53,0xDA,0x79,0x3A,0x1B,
+	0x94,0x78,0xE6,0xC9,0xA7,0x17,0xD7,0x3C,0x2B,0x9A,0xC5,
+	0x5E,0x62,0x40,0x5D,0x3F,0x7E,0x79,0xBE,0x67,0xAE,0xCA,
+	0xBD,0x6E,0xB2,0x71,0x10,0xB1,0xC8,0x48,0xF6,0x96,0xC3,
+	0x46,0xF7,0x00,0x17,0x38,0x9C,0x4D,0x89,0x4E,0xFE,0x67,
+	0x15,0xAD,0xAD,0x78,0x97,0x99,0x39,0xF9,0x1D,0x61,0x81,
+	0xD9,0xFE,0x73,0x62,0xBA,0xE6,0xFB,0xE5,0xB2,0x15,0x05,
+	0x0E,0x56,0x4A,0x9E,0x51,0xDD,0x11,0xD7,0x9F,0xE2,0x75,
+	0x0D,0x05,0x28,0xD7,0x63,0x2F,0xD8,0x7E,0x70,0xF5,0xAC,
+	0x0E,0x1C,0x1F,0xE4,0x13,0x8F,0x39,0xAE,0x24,0x18,0xF5,
+	0x91,0x57,0x09,0xFB,0x0C,0x25,0xCC,0xAA,0xBE,0x3E,0xF7,
+	0x0A,0x95,0x78,0x7D,0x87,0xC5,0x49,0xFD,0x2C,0x10,0xFF,
+	0xE6,0xE3,0x2A,0x6A,0x8E,0x34,0xB2,0xF5,0x3B,0xFE,0x04,
+	0x97,0x5C,0x0D,0x1F,0x2E,0x62,0x47,0x9D,0x09,0x38,0x0A,
+	0xFE,0xFC,0xC7,0x5B,0xFA,0x8D,0x59,0x36,0x73,0xE9,0xAA,
+	0xE4,0xF6,0x71,0x45,0xD9,0xF2,0xD8,0x47,0x79,0x8E,0x0D,
+	0x42,0x3B,0x38,0xE6,0xC3,0x3C,0xE9,0x05,0x23,0xE0,0x8E,
+	0xA2,0x90,0xF8,0xF9,0xD3,0x54,0xEB,0x28,0xAE,0xEA,0x42,
+	0xD1,0x84,0xB6,0x52,0x9F,0xEB,0xD2,0xF9,0x9A,0x6F,0x5B,
+	0xB3,0xB8,0x66,0x5B,0x39,0x93,0x3A,0x09,0x87,0xE4,0xD8,
+	0x9A,0x58,0xE6,0xE3,0x53,0x00,0x85,0x1C,0xDC,0x70,0xA5,
+	0xDA,0xE7,0x99,0xDF,0xC9,0xBC,0xAC,0x42,0x51,0x8F,0x8E,
+	0x4E,0x2E,0x2B,0x8F,0xA7,0x1F,0x4F,0x54,0xC4,0x54,0x3A,
+	0x8C,0xF1,0x49,0xED,0xF7,0xBD,0x09,0x1F,0x9F,0x57,0x53,
+	0x78,0x22,0xCA,0xCF,0x94,0x9C,0x06,0xC2,0x27,0x85,0xBB,
+	0x48,0x7C,0xD3,0x87,0x93,0x5C,0xF6,0xCB,0x78,0x26,0x50,
+	0x59,0xCA,0xBE,0x40,0x2A,0x6F,0xDB,0xB5,0x7F,0xF2,0x4B,
+	0x73,0xBF,0x6D,0x35,0xD9,0x4A,0x80,0xF9,0xAD,0xC1,0xA6,
+	0xFA,0xC3,0x19,0xF2,0xDB,0x86,0xA6,0xEA,0x97,0x3B,0xE4,
+	0x91,0x5E,0x59,0x41,0xE6,0xC0,0x74,0xE2,0x5A,0xF7,0x85,
+	0x6A,0xBC,0xC1,0xC6,0x37,0xB7,0xF2,0xF1,0x05,0xFB,0xB3,
+	0xA5,0x82,0xA5,0xE1,0x9D,0x29,0xC7,0x2E,0x9D,0xAE,0x07,
+	0xC2,0x8A,0x2B,0x16,0x72,0x63,0x78,0x09,0x4C,0x86,0xA6,
+	0x7D,0x5B,0xB2,0x7D,0x41,0x9C,0xE6,0x7C,0xDB,0xE9,0x64,
+	0x94,0x10,0x93,0xD2,0xC0,0x55,0xED,0xA7,0xE8,0xE3,0x71,
+	0x6A,0x01,0x70,0x3E,0x77,0x07,0x08,0xB3,0xF9,0x0D,0x17,
+	0x66,0x9A,0xDA,0xBB,0xEA,0x87,0xA6,0xBD,0xA2,0xF8,0x6A,
+	0x9F,0x14,0xB6,0x66,0x4E,0x1B,0x79,0xB4,0x1D,0xC3,0xFB,
+	0x9C,0x05,0xB8,0x35,0x47,0xDB,0x90,0xC9,0x78,0x11,0x26,
+	0xB8,0x21,0x6C,0x7C,0x2F,0x97,0x4A,0xFA,0x3D,0x5D,0x33,
+	0xB9,0x36,0x4F,0xFA,0xFE,0x89,0x47,0x94,0xF9,0xE9,0x54,
+	0x50,0xD8,0x6C,0xCE,0x8D,0xA4,0xCE,0x50,0x8E,0x49,0x0F,
+	0x9E,0xF1,0x07,0xCF,0xB5,0x7E,0xB4,0x01,0x7D,0xC9,0x1A,
+	0x62,0xCC,0xAE,0x06,0x46,0x75,0xF3,0x0B,0xBF,0xC6,0xDC,
+	0xAC,0x12,0xC4,0x02,0xF5,0x27,0x57,0xCD,0xF5,0x5C,0x21,
+	0x37,0xE5,0x8C,0x17,0x6F,0x6B,0x35,0xB7,0xEF,0xFE,0xEB,
+	0xDD,0xFA,0xB1,0x99,0xBF,0xF1,0xB8,0x1C,0x9B,0xE9,0x9F,
+	0x98,0xE7,0xB1,0xAA,0x94,0x54,0xB7,0xE6,0x7B,0x76,0xD8,
+	0x7C,0x1A,0xB8,0xFB,0x96,0x33,0xE5,0x93,0x0C,0x27,0x94,
+	0x26,0xCF,0x78,0x65,0x50,0xEB,0x4A,0x4F,0xD9,0x7A,0xEC,
+	0x26,0x98,0x7E,0x75,0x78,0x7B,0x1E,0xC9,0x6D,0xEA,0x43,
+	0x80,0x0D,0xA5,0xFC,0xBE,0xD8,0x89,0x86,0x78,0x28,0xED,
+	0xF3,0xC2,0x68,0x68,0x78,0x37,0x9C,0x06,0x3C,0x06,0xE8,
+	0x2A,0x97,0x3E,0xC8,0x9F,0xF0,0xC9,0x87,0x8D,0x06,0x4D,
+	0x71,0xEC,0x1C,0x13,0x47,0xAB,0x4F,0xE9,0xAA,0x8A,0x6B,
+	0x4F,0xA7,0x2D,0x38,0x6B,0x03,0x71,0xBB,0xE7,0xC7,0xF5,
+	0x7E,0xB5,0x9C,0x37,0xA1,0x77,0x1A,0xB4,0xA2,0x97,0x34,
+	0xE0,0xF6,0x27,0x66,0xA5,0x00,0x4D,0xFF,0xB6,0x17,0x53,
+	0xF8,0x9E,0x07,0xFA,0xF4,0x90,0x27,0x7C,0xA0,0x38,0xF5,
+	0xB1,0x9B,0x61,0x51,0x24,0x78,0x05,0x4C,0x76,0xA9,0x11,
+	0x78,0x3E,0x6D,0x62,0xF4,0x7D,0xD3,0x25,0x02,0xDD,0x64,
+	0x5C,0xC4,0x97,0x1D,0xAD,0x51,0x71,0x7E,0xF9,0xCC,0x76,
+	0x93,0x18,0x93,0x0F,0xA6,0xEA,0x73,0x7B,0xDA,0x98,0xE0,
+	0x0B,0x9C,0x8C,0x86,0xD0,0x9D,0xD2,0xD3,0x6C,0x22,0x38,
+	0x3B,0x8B,0xC4,0x5C,0x5E,0xE9,0x32,0x33,0xEE,0x56,0xCE,
+	0xD2,0xB9,0xB7,0x99,0xE5,0x57,0xEC,0x07,0x0A,0xDA,0x8E,
+	0xFC,0x7E,0x41,0xAD,0x60,0x8A,0xDE,0xAC,0xF9,0x90,0xC2,
+	0x66,0xE7,0xFC,0x46,0xC5,0xDD,0x04,0x6A,0x44,0xC8,0x17,
+	0x48,0xDA,0xC6,0x28,0x3B,0x7D,0x81,0x10,0xAA,0xB1,0x5F,
+	0xB7,0x14,0x42,0xF0,0xE9,0x06,0xD1,0xDD,0x09,0xCE,0xB2,
+	0x4E,0xE1,0xB2,0x0D,0xAE,0xF1,0xD2,0x82,0xE7,0x04,0xA8,
+	0x51,0xE6,0xC1,0x1B,0x2E,0x66,0x42,0xD4,0xB9,0x33,0x64,
+	0xDF,0xAA,0x65,0xF0,0x1B,0xE6,0x3E,0x1F,0xCA,0x0A,0x2F,
+	0xD6,0x10,0x53,0xF2,0x2A,0xCC,0xA9,0x1C,0x84,0xBC,0x3E,
+	0xC7,0x7D,0x79,0x1C,0x06,0x44,0x7B,0xFC,0x75,0x0E,0x68,
+	0x47,0x4C,0x4A,0x44,0x2E,0xB3,0x0B,0x8D,0xB3,0x74,0xA4,
+	0xD4,0xA4,0x14,0x4D,0x55,0x26,0x90,0x34,0x99,0x44,0x38,
+	0x17,0x4D,0x5C,0x47,0x98,0x46,0x38,0x2D,0xD0,0xE1,0x41,
+	0x6D,0xF7,0x23,0x1E,0x84,0xA8,0x08,0xF4,0x5C,0xF7,0x0A,
+	0x3F,0x43,0x7E,0x8C,0x6F,0xC3,0xBF,0x5E,0x68,0x46,0x0B,
+	0x68,0x72,0x7C,0x9D,0x12,0xCE,0xA4,0x5D,0xB3,0xA6,0x37,
+	0x09,0xED,0x5D,0x16,0xC4,0x3B,0x45,0xD6,0x7F,0x86,0x71,
+	0x7E,0x0A,0x01,0x45,0xC9,0xDA,0x7E,0x94,0x85,0xB8,0x22,
+	0xC4,0xC4,0x85,0x70,0xAA,0xEF,0xF8,0x22,0xD7,0x69,0xC7,
+	0x50,0xA7,0xA5,0x6F,0x2D,0xFC,0xA6,0x75,0xF2,0xFD,0x5C,
+	0xF6,0x62,0xEE,0x58,0xE2,0xB8,0x43,0x68,0x9C,0x61,0x4E,
+	0x7F,0x2D,0xB4,0xE2,0x50,0x74,0x61,0x55,0xFE,0xBA,0xC9,
+	0xE4,0x84,0xAA,0x3C,0xE5,0xA2,0x8E,0x66,0x26,0xB1,0x8A,
+	0x83,0xAB,0x80,0x5F,0x86,0x23,0x9C,0xC8,0x29,0x23,0x0A,
+	0x9E,0xBD,0x5D,0xDF,0x6C,0x3A,0x4D,0x8F,0xAA,0x29,0x9D,
+	0x2C,0xE4,0x49,0xC9,0xA8,0x21,0xDB,0x08,0xCD,0x2A,0x48,
+	0x49,0xA7,0x03,0xF0,0xD7,0x6C,0x0B,0x5D,0x1B,0x28,0xB9,
+	0x14,0x65,0x63,0x94,0xD5,0x20,0x75,0xB2,0x3F,0xDA,0x69,
+	0x19,0x3A,0x8A,0x5B,0x78,0x9F,0x07,0xE4,0x45,0xA1,0x9D,
+	0x9B,0xB8,0x84,0xA7,0xFC,0xF7,0x84,0x83,0x38,0x11,0xAB,
+	0x26,0x0D,0x82,0xCC,0x0B,0x15,0xB7,0x87,0xDE,0xA9,0xCA,
+	0x6F,0x7B,0x2C,0x1B,0xF4,0x9F,0x8B,0x53,0x48,0x84,0x1B,
+	0xD8,0xE7,0x24,0xB4,0x4A,0x46,0xBF,0x69,0xAC,0xDB,0xC8,
+	0x4C,0x4F,0x6A,0x7D,0xF9,0xA0,0x00,0xF5,0x9E,0x3D,0xC7,
+	0x82,0xDF,0x8F,0x87,0xD8,0x4C,0xC5,0x8D,0xC2,0x7E,0xCC,
+	0x54,0xA3,0x16,0x37,0x95,0xC1,0xCE,0xA3,0x6D,0xB5,0x79,
+	0xF5,0xA5,0x7A,0x11,0xF5,0x4A,0x85,0x4E,0xC4,0xA8,0x64,
+	0xA1,0x4E,0x88,0xA0,0xD4,0x38,0x73,0x39,0xD2,0x72,0xAD,
+	0x6F,0x95,0x69,0x59,0x0F,0xF1,0x3D,0x31,0x70,0x5D,0xD6,
+	0xED,0xC5,0x7C,0xAF,0x24,0xB1,0x78,0x6E,0xD2,0xCE,0x6C,
+	0x74,0x44,0xF5,0xCE,0x06,0xFD,0x18,0xF6,0x74,0xAB,0xF0,
+	0xC8,0xBE,0x89,0x2A,0xA7,0x52,0x99,0x79,0x1C,0xA7,0x63,
+	0x6E,0xBF,0x3D,0x23,0x20,0x87,0x58,0x76,0xFB,0xAC,0x0B,
+	0x5D,0x8B,0xD4,0xC5,0xCB,0x9E,0xBB,0xF3,0xD1,0x35,0x85,
+	0x98,0x85,0xAA,0x8A,0x39,0x87,0x4D,0xC7,0x99,0x29,0x75,
+	0xE5,0x61,0x12,0x9B,0xD1,0xCE,0xFE,0xF6,0x2F,0xC3,0xA3,
+	0x3F,0x3F,0x11,0xC9,0x47,0xE8,0x53,0x8F,0xBD,0x2B,0x50,
+	0x31,0xFA,0xC2,0x76,0xE9,0xC7,0x5C,0xF6,0x36,0x78,0x4D,
+	0xEB,0x14,0x22,0x88,0x39,0x61,0xCD,0xFE,0xD2,0xF5,0x6B,
+	0x12,0x83,0x52,0x90,0xFC,0xA7,0x60,0x5F,0x22,0x6B,0xED,
+	0xBE,0x73,0xBE,0xF2,0xBD,0x4D,0x0F,0xE4,0xA8,0x6C,0xA0,
+	0x94,0x38,0x7C,0x0F,0x7E,0xB9,0x90,0xAC,0xFF,0x5C,0x7A,
+	0xC3,0x98,0x4C,0xE3,0xFD,0x0A,0x37,0xFB,0xD5,0x03,0x4F,
+	0xA6,0xD5,0x00,0xD1,0xF4,0x94,0x2B,0xA0,0x2D,0x62,0x0A,
+	0x27,0x9D,0x3E,0x0A,0xA4,0x76,0x47,0x15,0xEC,0x20,0x42,
+	0xC9,0x19,0xD1,0x34,0xA9,0x02,0x34,0x76,0x43,0x4D,0x2D,
+	0x45,0x7B,0xB3,0xAA,0x2E,0xF4,0x4B,0xFA,0x90,0xAA,0xC1,
+	0x50,0xBA,0x3C,0x25,0xEF,0x71,0x0E,0xA7,0xFD,0xE8,0x27,
+	0xFB,0xB8,0xD0,0x09,0xF7,0x61,0x03,0x8C,0xC9,0x9F,0x34,
+	0x54,0x91,0x3F,0x48,0x13,0x81,0xC8,0xED,0x69,0x03,0xA5,
+	0x8E,0xD1,0x51,0x0B,0x74,0xDE,0x3B,0xBA,0x76,0x7C,0xC5,
+	0xCE,0x63,0xC5,0x95,0xD4,0xE1,0x24,0x79,0x13,0x2A,0x78,
+	0x6E,0xDF,0xEE,0x44,0xDC,0xE9,0x89,0x38,0xE1,0xE3,0x08,
+	0x7A,0x89,0x07,0xC5,0x89,0x60,0xB5,0xB5,0x94,0xC7,0xA7,
+	0x7D,0xCD,0xC7,0x21,0xBA,0x15,0x4F,0x07,0x15,0x0D,0xA3,
+	0x32,0x82,0xE2,0x32,0xC1,0xDA,0xA8,0x27,0xBE,0x46,0xE5,
+	0x67,0x94,0xDB,0x13,0x1D,0xB4,0x33,0x0A,0x40,0x58,0x50,
+	0x97,0x43,0xD1,0xF0,0x4F,0x74,0x8A,0x34,0x52,0x70,0x76,
+	0x4C,0x68,0x1E,0xE7,0xDE,0x82,0xB7,0x4D,0xFD,0xC6,0xD2,
+	0x76,0xA0,0x6C,0xBD,0x49,0xB0,0x0D,0xC9,0xE8,0x11,0x79,
+	0x6D,0xEB,0x2C,0x8E,0x5E,0xA0,0xD2,0x22,0x6C,0xFB,0x12,
+	0x39,0xB1,0x9F,0xB8,0x30,0xD4,0x8B,0x7E,0x06,0x89,0x1A,
+	0xB9,0xE5,0x72,0x8D,0xB6,0x12,0xE3,0x97,0x89,0xBA,0x7B,
+	0x25,0x24,0xAB,0x0A,0x59,0xFD,0x3B,0x08,0x73,0x8A,0xDA,
+	0x58,0xA2,0x6A,0x4D,0xB7,0xDC,0x46,0x82,0x11,0x3D,0x69,
+	0xFD,0x62,0x39,0x7B,0xA9,0x1B,0x06,0xEA,0x79,0x70,0x5C,
+	0x79,0xA1,0x00,0xF1,0x70,0x09,0x65,0x68,0xCE,0x36,0x5F,
+	0xDC,0x66,0x49,0x29,0xB3,0xC3,0xB3,0x90,0xBF,0x51,0x07,
+	0x2C,0x15,0xD6,0x06,0x0B,0x44,0x60,0x1A,0xB0,0x56,0x9F,
+	0x83,0xCE,0x51,0xAF,0x12,0x47,0x45,0xAF,0x8F,0x65,0x3C,
+	0x5C,0xFB,0x67,0x93,0xAA,0xD7,0x4F,0x89,0x5D,0x43,0x3D,
+	0x04,0x40,0x76,0x91,0x23,0x6A,0x55,0x43,0x94,0xE3,0x23,
+	0x7F,0x37,0x2E,0x81,0x35,0x3D,0x3A,0x3B,0x91,0x85,0x67,
+	0x91,0x2A,0x31,0x66,0x06,0x92,0x56,0xA6,0xDC,0x9D,0x03,
+	0xE8,0x54,0x0C,0xC7,0x1C,0x0C,0x0B,0x4A,0xAB,0x53,0x4D,
+	0xC1,0x0A,0xDF,0xD6,0x4B,0xBF,0xCA,0xF9,0x3A,0x54,0x71,
+	0x91,0xBB,0x97,0x33,0x15,0x36,0xDC,0x89,0xD2,0x54,0xE5,
+	0x29,0x6F,0xE6,0x92,0xBD,0xB6,0xC9,0x91,0xD6,0x42,0xFC,
+	0xC8,0x91,0x91,0x5B,0xD6,0xF6,0x7C,0x6E,0x66,0x64,0xD4,
+	0xEE,0xE5,0xCA,0x19,0x30,0x0F,0xF5,0xBA,0xF9,0x4E,0xB3,
+	0x80,0xE5,0xBF,0x14,0x83,0xF4,0x9D,0x04,0xCD,0x30,0x6D,
+	0x65,0x4B,0x15,0xE1,0xA8,0x31,0x66,0xAD,0x69,0xCE,0x3B,
+	0xA4,0x67,0x00,0xA7,0x04,0xF3,0x83,0x3F,0x9D,0x67,0xF0,
+	0x44,0xCC,0x0B,0xBA,0xA4,0xC1,0xF3,0x04,0xD8,0x46,0x5A,
+	0x4D,0x86,0x40,0xA1,0x11,0x8F,0x44,0xA1,0x9E,0xFD,0x3B,
+	0x40,0xCE,0x97,0x6B,0x07,0x79,0x5E,0x0B,0x72,0x5F,0x82,
+	0xD7,0xA5,0x93,0x7E,0x84,0x7E,0xD0,0x09,0x31,0xCF,0xAB,
+	0xF7,0x54,0xAF,0xF3,0x5D,0x66,0xEF,0x9A,0x4D,0x5B,0xB1,
+	0xF0,0x0A,0x9D,0xF7,0x20,0x76,0x0D,0x66,0xF0,0xC8,0x70,
+	0x04,0xF2,0x94,0xE4,0x8C,0x37,0xD1,0xF8,0xE9,0x48,0x02,
+	0xD5,0xC5,0xBA,0xEA,0xEF,0xE3,0xD2,0x83,0x14,0x0D,0xB3,
+	0xBA,0x25,0x3F,0x85,0x31,0x65,0x6B,0x63,0x49,0x09,0x66,
+	0x3D,0x4D,0x56,0xE8,0x0A,0xE4,0xD4,0x32,0xE6,0xA3,0x79,
+	0x59,0xB4,0x8A,0x0C,0xFD,0x06,0x76,0xD7,0x88,0xD3,0xB7,
+	0x6D,0x13,0x3C,0xBF,0x01,0x3E,0xF6,0x59,0xC5,0x3C,0x12,
+	0xBE,0xD1,0x6C,0x94,0xDD,0x2F,0x26,0x23,0x61,0x8D,0x18,
+	0x91,0x79,0x6C,0x73,0x12,0xFB,0xBC,0x71,0xD4,0x46,0x62,
+	0xA9,0x7F,0x58,0x36,0xC2,0xF7,0x72,0x7C,0x85,0x6C,0x56,
+	0x3F,0x70,0x83,0xC6,0x83,0x9C,0x32,0x3F,0x23,0x97,0x5C,
+	0x36,0x5C,0xEC,0x6C,0xE7,0xEB,0xF9,0x9D,0x27,0x58,0x5C,
+	0xE8,0x85,0x0C,0x7E,0x8E,0xC4,0xFB,0x6D,0x49,0x02,0x15,
+	0x52,0x02,0xF7,0xF4,0xCC,0xDE,0x50,0x09,0xB2,0xD4,0x64,
+	0x74,0x73,0x9D,0x43,0x6E,0x19,0x5B,0x3A,0x64,0x76,0x77,
+	0xC4,0xC9,0xF8,0xA4,0x2B,0x10,0x3F,0x8B,0x58,0xE4,0xC4,
+	0xB3,0x45,0xC8,0x86,0xCA,0x3E,0x7D,0x70,0x7C,0xAE,0x5F,
+	0x46,0x9C,0x66,0xCF,0x96,0xF8,0xF5,0x95,0xE7,0xDB,0x05,
+	0x9B,0xC9,0xCB,0x7E,0x2C,0x27,0x36,0x88,0x0C,0x8A,0x06,
+	0x25,0x83,0xC2,0xD8,0xFA,0x27,0xF5,0xA9,0xFA,0x14,0xFD,
+	0xD1,0xBB,0xC8,0xFE,0xEC,0x23,0xC6,0x3B,0x50,0x9F,0x2D,
+	0xBB,0xDD,0xB4,0xE7,0xAE,0x7B,0xBE,0xC7,0xC1,0xD1,0x24,
+	0xEE,0x42,0xD8,0x81,0xF7,0x9A,0xD2,0xFB,0xBF,0x4E,0xBB,
+	0xF1,0xB8,0x61,0x88,0x60,0x1E,0x5F,0x2E,0x61,0x45,0xD4,
+	0xFD,0xC8,0x6D,0xFC,0xB5,0x8F,0x72,0xB8,0xFB,0x5D,0xBE,
+	0x11,0xBE,0x09,0x43,0x89,0xA2,0x7D,0xEE,0x5D,0x19,0xB8,
+	0xA9,0xE8,0x53,0xDE,0x40,0xA1,0x78,0xFD,0x48,0x16,0x96,
+	0x47,0x19,0x34,0x6E,0x68,0x9E,0x90,0x32,0x97,0x57,0xA9,
+	0xBB,0x02,0x6A,0x22,0xF9,0xAD,0x1E,0x5D,0x00,0xC1,0xBD,
+	0x9F,0x51,0xD9,0x01,0x6A,0x10,0x70,0x64,0x11,0x04,0xD4,
+	0xCB,0x2E,0x3A,0x7F,0x60,0x75,0xE1,0xBB,0x48,0x41,0x0A,
+	0x76,0x07,0xF6,0xB7,0xC2,0x03,0xC3,0xE0,0xAD,0x4E,0x61,
+	0x29,0x45,0x80,0x21,0x03,0xDA,0x50,0x97,0xF7,0x38,0x9E,
+	0xBB,0xAB,0x3C,0xE8,0x7B,0xD3,0xFC,0x6E,0x56,0x49,0x0C,
+	0x21,0xA5,0x01,0xF7,0xC0,0x2E,0xC3,0x94,0x49,0xFA,0x47,
+	0x6C,0xDC,0xF3,0x09,0xF7,0x90,0x00,0xCF,0x8E,0xCB,0xF9,
+	0xD6,0x62,0x8C,0x66,0x9B,0x98,0x35,0x9E,0x2B,0x7E,0x2F,
+	0xE5,0x78,0x69,0xD2,0xF3,0xCC,0xFA,0x1A,0x99,0xCD,0x29,
+	0x18,0xE2,0x4F,0xC2,0xCC,0xEB,0x45,0x70,0x40,0xFE,0x26,
+	0xF4,0xE6,0x1B,0xC5,0x1C,0x9B,0x84,0xC7,0x6F,0x04,0x39,
+	0x5F,0x39,0x99,0x83,0x3C,0xC3,0xFE,0x32,0xA3,0x91,0x40,
+	0xA6,0xB6,0x8C,0x30,0xA7,0x73,0x8C,0x5B,0xB4,0x67,0xE2,
+	0xA6,0x70,0xCA,0x9A,0x67,0xEE,0xE0,0x92,0xCF,0xD5,0x4F,
+	0x53,0x53,0xDF,0x48,0x6E,0x50,0x92,0x16,0x82,0xBF,0xB6,
+	0x76,0x9D,0x3F,0xB7,0x0D,0xFE,0xEC,0x58,0xCC,0x84,0x9F,
+	0xB1,0xA9,0x38,0x7E,0x56,0x8A,0xBD,0xD8,0x75,0x23,0xD2,
+	0xDB,0xC6,0x16,0x38,0x91,0xAF,0x8D,0x85,0xAE,0xEF,0x9A,
+	0x3E,0xCB,0x48,0xAF,0xBB,0x5C,0x1D,0x29,0x15,0x85,0x9D,
+	0xFC,0x15,0xFB,0xE2,0x42,0xE9,0x40,0x90,0x2B,0xE9,0x3F,
+	0x38,0x78,0xA8,0x3D,0x57,0xAC,0xA5,0x31,0xB3,0xE4,0xA2,
+	0x60,0xD6,0xE3,0x7F,0x7A,0x03,0xD1,0xBD,0x2F,0x6D,0x76,
+	0xF0,0x3E,0x56,0x3F,0xEC,0x5D,0xD5,0x9C,0x4A,0xC7,0x2A,
+	0xDA,0xFA,0xF9,0x35,0x19,0xA6,0x71,0x85,0xEA,0x38,0x50,
+	0x36,0x96,0x32,0x11,0xF4,0x54,0x99,0x63,0x92,0xD1,0x4D,
+	0x6F,0x56,0x76,0xC4,0x1C,0xB7,0xD1,0x2E,0x1C,0xED,0x7D,
+	0xDB,0x3E,0x07,0xA8,0x81,0x6C,0x9C,0xCC,0x8F,0x71,0x5D,
+	0x07,0x96,0x73,0x22,0x43,0x6F,0x27,0x67,0xF5,0x9F,0x05,
+	0xA5,0xD9,0x23,0x8E,0x05,0xD2,0xC4,0xC6,0xAC,0xFF,0x97,
+	0x5B,0x79,0x7C,0x08,0x07,0xEA,0x4A,0xB7,0x21,0x5E,0xF3,
+	0x42,0x39,0xEA,0x7B,0xD1,0xC1,0x55,0xEC,0xD6,0xF7,0x7B,
+	0xDA,0x55,0xE7,0x55,0x4A,0x45,0xF7,0xE2,0x6E,0xB1,0x05,
+	0x6F,0xDB,0xB4,0x3B,0xD5,0x83,0x4A,0xA1,0xC3,0x2D,0xC8,
+	0x83,0x37,0x97,0x7E,0xD0,0x70,0x1E,0x00,0x42,0xFA,0x3F,
+	0x7B,0x76,0x0B,0x84,0x89,0xBC,0x24,0x03,0x82,0x7A,0x94,
+	0xDF,0xEB,0xFE,0xC4,0xF3,0x53,0x46,0xE0,0x92,0x0F,0xD9,
+	0xA3,0x83,0xB6,0x3B,0x3B,0x5A,0x10,0xA3,0xF5,0x2A,0xCB,
+	0xC6,0xAA,0x93,0x17,0x83,0x05,0x95,0x91,0x4C,0x35,0x16,
+	0x70,0xA1,0x98,0x4A,0x34,0x9B,0xDF,0xBB,0x01,0xD4,0xA2,
+	0xB6,0xAC,0xF8,0x42,0x78,0x1D,0x7C,0x51,0x91,0xD6,0x21,
+	0x7C,0xD6,0x6F,0x68,0xA7,0xB9,0xFC,0x4C,0x94,0x93,0x71,
+	0x85,0xFF,0xD3,0x0A,0xC3,0xA9,0x95,0x8B,0x78,0x4B,0x25,
+	0xE1,0xCA,0x46,0x71,0x6F,0xE0,0xF5,0xB2,0xCC,0x99,0xDE,
+	0x68,0x30,0x3D,0xC3,0xE0,0xFA,0xCB,0x25,0x21,0x95,0x15,
+	0x5A,0xF8,0x44,0x50,0x02,0x2E,0xBF,0xAC,0x9C,0x92,0xAE,
+	0x38,0xC6,0xAA,0x50,0x27,0x0B,0x33,0x49,0x32,0x6A,0x4B,
+	0xAB,0xE5,0xE7,0x65,0xB4,0x9E,0x0C,0x2A,0x9F,0xBE,0x2A,
+	0x3D,0xA8,0x7A,0x5B,0xA4,0x18,0x4C,0x41,0xC5,0xEE,0x09,
+	0xF0,0xDB,0x6C,0xD3,0x36,0xB7,0x3E,0x6F,0x49,0xC2,0x1A,
+	0x2A,0xD1,0x67,0xE1,0x0C,0xB6,0x41,0xDD,0x64,0x7A,0x0A,
+	0xF0,0x88,0x0D,0x5A,0xF9,0x74,0x1B,0x2C,0x76,0xF3,0xFD,
+	0x88,0x5C,0x90,0x8D,0xD7,0x41,0xA4,0x0B,0xB6,0xBF,0x20,
+	0xD7,0xC1,0x8B,0x5D,0x50,0x69,0xE7,0x95,0xC7,0x9F,0x67,
+	0xD9,0x0C,0xC1,0xEB,0xB9,0x34,0x38,0x2D,0xB8,0xC3,0x04,
+	0x00,0x62,0xFC,0x49,0x47,0x37,0xA4,0x7C,0xE5,0xFD,0x1C,
+	0x59,0xD1,0xA2,0x95,0x4D,0x0B,0x70,0x3B,0x92,0xD4,0x00,
+	0xEB,0xCF,0x9F,0x67,0x7C,0x33,0x06,0xF9,0x14,0x5E,0xF8,
+	0xEA,0xBF,0x79,0x21,0xD2,0x87,0x2B,0x7F,0x6D,0xF2,0x35,
+	0x0B,0xDC,0x9B,0xCF,0xD2,0x39,0xB8,0x90,0xB0,0xFD,0x36,
+	0xE3,0xB8,0x48,0x78,0xC7,0x97,0x77,0xBB,0x37,0x39,0xB2,
+	0x70,0xE1,0x07,0x33,0xEE,0x6C,0xF1,0x59,0x08,0xF6,0xF4,
+	0xFA,0xE7,0x28,0xD4,0xC7,0x05,0x1A,0x12,0xB1,0xA9,0xB4,
+	0x35,0x25,0xA4,0x3F,0x96,0x88,0x4C,0xF0,0xD8,0x2E,0x10,
+	0xDD,0xEA,0x44,0x6D,0xA6,0x23,0xB2,0xA6,0x52,0xD1,0x6C,
+	0x9E,0x2C,0x50,0xA1,0xFF,0x06,0x8A,0x6B,0xED,0x45,0xFE,
+	0x88,0x60,0xA2,0x66,0x2A,0x53,0xE5,0xE4,0x6A,0xBB,0x0D,
+	0xBD,0xAA,0xB8,0x57,0xB0,0x20,0x61,0x4D,0xDC,0xF2,0x28,
+	0x38,0xF4,0xA7,0xC5,0xD1,0x4A,0x09,0x68,0xA1,0xAE,0xF6,
+	0x18,0x7E,0xA1,0x7A,0x44,0x7E,0xE9,0x44,0xB1,0x46,0x08,
+	0x81,0x3B,0x61,0x0B,0x32,0xBE,0xB9,0xAC,0xB2,0xC4,0x2C,
+	0x3F,0x5F,0xFA,0x77,0xB8,0xB8,0xD4,0x46,0x64,0xB5,0x8D,
+	0x79,0x26,0x0E,0x97,0xF8,0xC5,0xCE,0xE3,0x05,0x4F,0x94,
+	0xD0,0xDD,0xDD,0x25,0x7E,0xEF,0x10,0x7C,0x80,0x02,0x7C,
+	0x33,0xC8,0x64,0x66,0xC7,0x10,0xB3,0x87,0x62,0xEE,0x1E,
+	0x77,0xC5,0x52,0x84,0x32,0x21,0xDA,0x2A,0xBB,0x2E,0xF7,
+	0x27,0xEF,0x62,0x57,0x53,0xEA,0x5B,0x6B,0x3C,0xEF,0x9B,
+	0x34,0x3D,0xA8,0xB7,0x68,0xBE,0x24,0x2A,0x2B,0x2D,0x9E,
+	0x54,0xE2,0x8E,0x1A,0x66,0x74,0x9D,0x80,0xD6,0x62,0xD8,
+	0x60,0xA8,0xB5,0x02,0xCE,0x53,0x91,0xD5,0xAA,0x26,0x02,
+	0xB8,0x7C,0x12,0xB6,0xE9,0xD1,0xBA,0xB7,0x28,0xEE,0xED,
+	0x05,0x65,0xFC,0x89,0x03,0x70,0x25,0xA4,0xD7,0x01,0xAE,
+	0xD3,0xDA,0x48,0xA1,0x8C,0xEB,0x56,0xBA,0xA3,0x47,0xEA,
+	0x31,0x4D,0xD1,0x87,0x2B,0x3C,0x60,0x6A,0xBE,0x04,0xCD,
+	0x44,0xAB,0x18,0xFA,0x5A,0x80,0x5B,0xD2,0xCD,0xCE,0x3C,
+	0x8B,0xE1,0x85,0x3B,0xED,0xE4,0xFE,0xE1,0xF0,0x9C,0x39,
+	0x99,0xAF,0xA6,0x11,0x2F,0x97,0x95,0xBC,0x43,0x44,0xD1,
+	0xB8,0x31,0x08,0x34,0x9E,0x9E,0x75,0x14,0x77,0x60,0xFD,
+	0x90,0x9E,0xAB,0xF8,0xBF,0x2F,0x78,0xE1,0x52,0x39,0xC3,
+	0x66,0xC1,0x16,0x62,0x1D,0xCB,0x98,0xB9,0xEF,0x43,0x1D,
+	0xAA,0xE3,0xD6,0xEC,0x64,0x19,0x8A,0xE3,0xF4,0x94,0x74,
+	0x18,0x98,0x71,0x2D,0x8D,0x40,0x23,0x75,0xB5,0x51,0x95,
+	0xA4,0x7F,0x98,0x6B,0x26,0xC7,0xCD,0x1E,0x05,0x04,0xD3,
+	0x3C,0xE0,0xF6,0x08,0x17,0x4A,0xB8,0xA1,0x07,0xB5,0xC2,
+	0x27,0x53,0xF9,0x42,0x1C,0xFF,0x7D,0x95,0x8E,0x03,0x46,
+	0xFF,0xFE,0x83,0x11,0x62,0x9C,0x0C,0x70,0x74,0x36,0x51,
+	0x2C,0x02,0x35,0xAA,0xEE,0xF5,0x37,0xC9,0x32,0xAB,0xCA,
+	0x8E,0x76,0x00,0x9B,0xFB,0x71,0x74,0x4A,0x54,0x80,0xD2,
+	0xCD,0x9D,0x31,0x34,0xA4,0x0C,0x16,0x5B,0x6A,0xB9,0xC0,
+	0xDD,0x42,0xDA,0x04,0x33,0x7D,0xCC,0x6A,0xC5,0x97,0x19,
+	0xEF,0xBB,0x05,0xF0,0x44,0xEC,0x10,0xB7,0x99,0x04,0x78,
+	0x48,0xBA,0x66,0x87,0xB9,0x77,0xE8,0x52,0x18,0x39,0x62,
+	0xFD,0x9F,0x01,0x52,0x26,0xB9,0x16,0xB3,0x64,0xC6,0xDD,
+	0x62,0x19,0x2D,0xD5,0x62,0x3E,0x80,0x5D,0x36,0x2D,0x31,
+	0xD6,0x33,0x6A,0x36,0x00,0xE7,0x2A,0x4E,0x96,0x71,0x51,
+	0x04,0xF0,0x94,0x20,0xC9,0xD0,0xE7,0xA3,0xA8,0x33,0x22,
+	0xB2,0xB5,0xE2,0x8C,0xC8,0x83,0x4D,0x89,0xCC,0x5A,0x29,
+	0x81,0xB9,0xAF,0x47,0x59,0xEE,0xD8,0x34,0x52,0xC3,0xA1,
+	0xE1,0x64,0xC0,0x5D,0xAC,0x66,0xBE,0x70,0x86,0xE9,0x85,
+	0xCC,0x2B,0xB7,0x3A,0x39,0xB0,0xB0,0xC1,0x82,0xA6,0x7B,
+	0x1C,0xDF,0x0B,0x23,0xC1,0x57,0x8A,0x94,0x5A,0x84,0xAC,
+	0x1E,0x72,0xB1,0x35,0xD9,0x23,0x94,0xD2,0x67,0xA3,0xF6,
+	0x0F,0x24,0x63,0xB9,0x6F,0x92,0x65,0xCA,0x19,0xF3,0x20,
+	0xE1,0xDF,0xD6,0x9B,0x44,0x9F,0xBC,0x5C,0xEA,0x87,0x9B,
+	0x9E,0x1B,0xF3,0xC7,0x4A,0xA4,0x1E,0xE4,0xF2,0x47,0xBD,
+	0x51,0xBC,0xBB,0x29,0x90,0x32,0x17,0xBB,0x50,0x11,0x5C,
+	0x59,0xC2,0xA5,0x7B,0xC0,0xF1,0xAC,0xE1,0x98,0xAD,0xE0,
+	0xD2,0x45,0x34,0x66,0x13,0xA7,0x8F,0x2E,0x23,0x46,0x75,
+	0x52,0xF6,0x4C,0xC6,0xB9,0x3B,0xC5,0x7C,0x0B,0x1C,0x2A,
+	0x4C,0x45,0xD0,0x50,0xE1,0x93,0xEF,0x02,0x2D,0xDC,0x93,
+	0xD4,0x43,0x2A,0xCF,0x30,0xBF,0xE6,0x97,0x04,0xB4,0x9F,
+	0xE4,0x2C,0xB0,0xA8,0x44,0xCE,0x94,0x1C,0xE4,0x59,0xF0,
+	0xE6,0x9D,0xE4,0xC3,0x06,0x0A,0xA3,0xB8,0x7C,0x4C,0xF8,
+	0x82,0xD0,0x7F,0x98,0x29,0x8F,0xE2,0xCB,0x49,0xA1,0x78,
+	0x96,0x20,0x4B,0xB5,0xF1,0xAD,0x7C,0x45,0x40,0x10,0xD3,
+	0x3A,0x9C,0xCC,0x17,0xB5,0xEB,0xD5,0x0E,0x1F,0x31,0x98,
+	0x51,0x0B,0x80,0xC1,0x0C,0x81,0xDF,0xC8,0x49,0xCE,0x6C,
+	0x6F,0xA7,0x7F,0xF0,0x03,0xC2,0x91,0x08,0x08,0xBC,0x05,
+	0x51,0x87,0xA9,0x03,0xEA,0x48,0x75,0x4E,0xA2,0xBB,0x61,
+	0x1A,0x3A,0x42,0x8B,0xFF,0x56,0x90,0xF3,0xC8,0x3B,0xF6,
+	0xB8,0x58,0x71,0x0D,0xA3,0xE0,0xB3,0x59,0xF0,0x97,0x11,
+	0xC6,0x52,0x88,0x9C,0xE2,0xAC,0xA5,0x8E,0x6E,0x0D,0x0F,
+	0x19,0x2B,0x97,0x4C,0xBD,0x8B,0x1A,0x0A,0x7C,0x4A,0x0C,
+	0x89,0x44,0x05,0x66,0x4A,0xA2,0x69,0xDC,0xDF,0x57,0x86,
+	0x3C,0x50,0xA6,0x29,0x37,0xE5,0x03,0x38,0xD2,0x73,0x4F,
+	0x83,0x27,0xCF,0x9C,0x19,0x1A,0xFC,0xA2,0xD1,0x38,0x65,
+	0x32,0xAA,0x37,0x86,0xF9,0xB6,0x97,0x5F,0x49,0xA5,0x77,
+	0x82,0xB4,0x93,0x5D,0xC4,0x06,0xF8,0x96,0xEE,0xF0,0x44,
+	0x77,0xA7,0xA0,0x37,0xCF,0x9E,0xDE,0xC7,0xFF,0xC9,0xBD,
+	0xED,0x7D,0x3B,0xFF,0x9D,0x2E,0x72,0xF4,0x56,0x83,0xD4,
+	0x44,0xD0,0xDF,0x6E,0x76,0xD8,0x11,0x32,0xFD,0xAB,0x8B,
+	0x4A,0x9E,0x49,0x8B,0x9A,0xD2,0xDD,0x86,0x2F,0x6F,0xA5,
+	0x75,0x16,0xBC,0xF0,0x1A,0x1E,0x47,0x1D,0xA8,0x6C,0x5B,
+	0x3D,0xDB,0x5D,0xC5,0x0A,0x1D,0xBD,0xE1,0xC4,0x7B,0xE6,
+	0x25,0x77,0xE3,0x56,0x76,0x3C,0x0D,0x48,0x46,0x85,0x8D,
+	0xA5,0xE3,0xC6,0xA6,0xB2,0x2F,0x6C,0xB7,0xA6,0xFE,0x7A,
+	0x9A,0x93,0x2C,0x9F,0x8E,0xBA,0xFD,0x97,0x97,0x9E,0x70,
+	0x7F,0x44,0xD4,0xC7,0x61,0xC3,0x1A,0xDA,0x62,0x2B,0x5A,
+	0xDD,0xDA,0x6C,0x13,0x66,0x7F,0xDE,0x51,0xB3,0x06,0x1C,
+	0x02,0xA6,0x64,0xFF,0xCA,0x4A,0x22,0x1A,0x25,0xB9,0x56,
+	0xF2,0x14,0x24,0x5A,0xB8,0x58,0x1B,0x5C,0xB0,0xD0,0xF9,
+	0x60,0x70,0x72,0x0D,0x49,0xC7,0x0A,0x56,0xDC,0x1B,0xD0,
+	0x50,0x92,0xC3,0x64,0x70,0xB7,0xF7,0xC8,0xEA,0x8E,0xF3,
+	0x4E,0xEA,0x80,0xF5,0xE4,0x27,0x97,0x5B,0x21,0xC0,0x3C,
+	0x4C,0xCC,0x88,0x1D,0xAB,0xD7,0x09,0xD1,0xC1,0x40,0xB5,
+	0x48,0x1A,0x8C,0x71,0x5B,0xEB,0xAF,0xCC,0xCD,0x3F,0xDD,
+	0x14,0x3E,0xA8,0x8D,0x7A,0xF3,0x4C,0xB7,0x71,0x93,0xA9,
+	0x60,0x05,0x27,0xD2,0x6C,0xD9,0xBC,0xD9,0x32,0x4B,0xED,
+	0xFC,0xD5,0xD1,0x65,0x33,0x29,0x04,0x54,0xC5,0x1B,0xE7,
+	0x72,0xDE,0xF1,0x6C,0x6B,0x54,0x66,0xF3,0xE5,0x67,0xF6,
+	0x5A,0x79,0x8E,0x15,0x51,0x62,0xF0,0x3B,0xF6,0x97,0x40,
+	0x92,0xBD,0x43,0xA9,0xCB,0x06,0xF5,0x46,0x4C,0x8E,0xD0,
+	0xD4,0x71,0x23,0x03,0x62,0xBA,0xA2,0x89,0x8A,0xB7,0xF0,
+	0x3B,0x17,0x35,0xFD,0xE8,0xAC,0xF1,0x84,0x76,0xB4,0xB4,
+	0xBA,0xF3,0x90,0x6B,0x37,0x02,0x0E,0xC8,0x37,0x63,0xF4,
+	0xB9,0x8B,0xFA,0x5C,0x64,0x86,0x69,0x26,0x99,0x53,0xA6,
+	0x5F,0xF3,0x2E,0x62,0xD6,0xA0,0x15,0x8E,0xF6,0xEF,0x79,
+	0xF9,0xFC,0x52,0xB2,0xF1,0x19,0xF8,0x71,0x57,0x67,0x12,
+	0xF6,0x3D,0x2F,0x38,0x76,0x4B,0x6B,0xC2,0x53,0x69,0xBC,
+	0xF7,0xA6,0xBE,0xD2,0x6E,0x12,0x22,0xA2,0x25,0x74,0x9D,
+	0x9D,0x28,0x0C,0x69,0x23,0x70,0x54,0x08,0xF0,0x3B,0xE1,
+	0xBC,0x79,0x0E,0xC0,0x11,0x08,0x46,0x97,0xE6,0xFE,0x3E,
+	0xFF,0xB9,0x97,0x1C,0x2D,0x7A,0x08,0x8F,0xA9,0x94,0x15,
+	0x15,0x84,0xEB,0xCC,0xCA,0x5E,0xE3,0xDE,0x42,0x2B,0xA3,
+	0x7F,0x00,0x84,0x6F,0x7C,0x9D,0xDD,0x38,0xB9,0x09,0x0A,
+	0x2C,0x39,0xF9,0x38,0xEB,0xD7,0x81,0xCD,0x6D,0xF3,0x98,
+	0xB2,0xDF,0x57,0x4A,0x0C,0x9A,0xFB,0x19,0x11,0x7F,0x4D,
+	0x7E,0x5F,0x66,0x5C,0x12,0x89,0x7A,0x6D,0x7A,0xFF,0xA5,
+	0xA3,0xC4,0xD8,0x89,0x6D,0x5F,0xF3,0xA1,0x93,0xE1,0x19,
+	0x4D,0xE7,0x7E,0x6D,0xA5,0x2A,0x56,0x5B,0xDB,0x3A,0x35,
+	0xDA,0x2C,0xDB,0x4F,0x3B,0x82,0xF7,0x79,0xE6,0xDE,0x8E,
+	0x43,0x9D,0xD5,0x29,0xB7,0xB2,0x0F,0xE5,0xC3,0xFF,0xC2,
+	0xA4,0x40,0x65,0x6C,0x78,0xA7,0xB8,0x67,0x2A,0x19,0x1C,
+	0x08,0x5E,0x52,0x84,0xF4,0x3E,0x22,0x49,0xCD,0x08,0x86,
+	0xF2,0x7E,0x2E,0xB0,0x29,0x89,0x70,0xFD,0x07,0xC3,0x2F,
+	0xF1,0x34,0x8F,0xEB,0xC0,0xEF,0x73,0x63,0x65,0x62,0x01,
+	0x47,0xBB,0x4A,0x19,0x73,0x0D,0xBE,0x30,0x4B,0xEB,0x01,
+	0x0F,0x7B,0x2E,0xF8,0xF3,0xE6,0xE9,0xF6,0xE6,0x66,0x2C,
+	0xC1,0xB4,0xDA,0xE9,0x45,0xAE,0x6B,0xE1,0x86,0x67,0xAB,
+	0xF5,0x5C,0x80,0x1D,0x5C,0xCB,0x4D,0x57,0xD4,0xBC,0x64,
+	0xD5,0x1B,0x5A,0x72,0x4A,0x84,0xE1,0x76,0xB3,0xC8,0xA6,
+	0xE2,0x17,0x9F,0x49,0xC7,0xA5,0xCC,0xF3,0xA3,0xB1,0x30,
+	0xF7,0xB1,0x4B,0xD9,0x9D,0x42,0xCE,0xB1,0x75,0xAD,0xA0,
+	0x7B,0x56,0xF9,0x92,0x73,0x35,0xBC,0x03,0xD5,0x66,0x3D,
+	0x4F,0x71,0x8F,0x23,0x59,0xDE,0x96,0x20,0xED,0x1D,0xBE,
+	0xA5,0xA4,0xCD,0xFB,0x61,0x83,0xAD,0x63,0xA4,0x73,0x8B,
+	0xF2,0x15,0xE3,0x38,0x06,0xA7,0x4A,0xE7,0x44,0x09,0xBF,
+	0x2A,0x65,0x72,0xFD,0xCE,0x43,0xDF,0x32,0x34,0xC1,0xE7,
+	0x8E,0xDF,0xCF,0x92,0x3D,0x38,0x16,0x84,0xDB,0xBB,0x0F,
+	0xF9,0x06,0xBF,0xD2,0x82,0x86,0x86,0xC7,0x08,0x0B,0xDC,
+	0x26,0xA1,0xA0,0x63,0xF6,0x80,0x79,0x48,0xD9,0xCF,0x5E,
+	0x6F,0xA0,0xDB,0x17,0x80,0x6C,0xF9,0x03,0xAF,0x03,0x27,
+	0xAC,0x1D,0x51,0x63,0xD6,0x9B,0xBE,0xC1,0xEF,0x29,0x80,
+	0xC9,0x93,0x27,0xDF,0x37,0x2E,0xA5,0x4E,0x86,0x51,0xE5,
+	0x1A,0xA5,0xE3,0x23,0x4E,0x47,0x02,0x28,0xE4,0xDA,0xD8,
+	0x38,0xB8,0x26,0x3A,0x16,0xF0,0x42,0x9D,0x88,0xAB,0x01,
+	0x68,0x80,0x84,0x53,0x02,0x10,0x99,0x04,0x64,0x9D,0x2C,
+	0x01,0x8B,0xD8,0x03,0x3B,0xA6,0xBC,0x3E,0xD5,0x61,0xFE,
+	0x48,0x31,0x12,0x5F,0x27,0xFB,0x23,0x98,0x8F,0xA2,0x6E,
+	0x56,0x82,0x17,0xEA,0x80,0xDE,0x97,0xC6,0x02,0x81,0xA7,
+	0xFC,0x95,0x0B,0x7E,0x5D,0x7F,0x9A,0xFA,0x80,0x94,0x90,
+	0xB5,0xBD,0x8E,0xEF,0xE2,0x33,0x69,0x67,0x9C,0xD5,0x8B,
+	0x00,0x5A,0x23,0x01,0xF0,0xA7,0x68,0x21,0x7E,0x89,0xEC,
+	0x1A,0x8D,0x58,0x9B,0x68,0x91,0xC8,0xE9,0x08,0xD3,0x7A,
+	0xBB,0x6C,0x92,0x09,0x4E,0xC3,0xB8,0xF9,0xB6,0x39,0x72,
+	0x95,0xF7,0xE2,0x15,0x09,0x34,0x64,0x1E,0xEB,0x5B,0xBD,
+	0x72,0x5B,0x77,0x54,0x03,0x24,0xBE,0xF2,0x6C,0x7B,0xA6,
+	0x5F,0x70,0x93,0x26,0x88,0xF2,0x7E,0x53,0xB6,0x9B,0x1E,
+	0xF2,0x9B,0xE9,0xBA,0xCA,0x1C,0xD4,0xDE,0x0C,0x54,0x35,
+	0x4C,0xE3,0xED,0xE7,0x93,0x34,0x15,0x78,0x2A,0xEC,0x69,
+	0x59,0x5D,0x84,0xA6,0x28,0xCB,0xC2,0x7B,0x9A,0x09,0x42,
+	0xE7,0xAB,0xFE,0x24,0xD1,0x97,0x87,0x2D,0x32,0x77,0x39,
+	0xFD,0x5E,0x82,0xE9,0xFC,0x93,0x9F,0x55,0x4A,0x79,0x4B,
+	0x81,0xBB,0xB0,0x2E,0xDF,0xE1,0xC8,0x48,0x45,0xCC,0x0D,
+	0x99,0xE8,0x3D,0x40,0x92,0xF9,0x31,0xB8,0xF1,0x63,0x73,
+	0x9F,0xB7,0x10,0x1B,0xA2,0x7A,0xCE,0x22,0xB0,0x95,0x9D,
+	0x1F,0x99,0x6F,0xC5,0x79,0xA3,0xF0,0x6E,0x64,0xD0,0x43,
+	0x73,0xB3,0xA8,0xE2,0x48,0xC7,0xBF,0x85,0x62,0x25,0x91,
+	0xBA,0xF6,0xB8,0x7A,0xA9,0x1C,0x2D,0x2B,0xAA,0x7F,0x03,
+	0x07,0x1B,0x5F,0x16,0x79,0xF3,0x62,0x64,0xBB,0x19,0xF6,
+	0xC6,0x7D,0x45,0x37,0x0B,0xFD,0xC6,0x47,0xEA,0x60,0x62,
+	0xED,0x05,0x0A,0x37,0x12,0x99,0xBF,0xFE,0x52,0x73,0xA5,
+	0x07,0xAA,0xBE,0x82,0x05,0xD7,0xA8,0x2A,0xAF,0x84,0xBE,
+	0x3F,0xC7,0x14,0x99,0xBD,0xC1,0x57,0x1A,0x9A,0x34,0x8A,
+	0x3C,0xE8,0xF6,0x60,0x1E,0x83,0x05,0x7A,0x5C,0xD6,0xAB,
+	0x7F,0x26,0xE3,0x7B,0x4F,0x58,0x36,0x0B,0x1A,0x53,0x86,
+	0xF3,0xE0,0xF4,0x65,0x2A,0xBC,0x1D,0x50,0x1A,0xC0,0x4D,
+	0xF3,0xA2,0xBF,0x62,0x94,0x82,0x9B,0xDF,0x83,0x84,0x35,
+	0xB1,0xD2,0xED,0x30,0x33,0xEB,0xF1,0x96,0x03,0xE9,0xED,
+	0xAC,0x54,0xA1,0x66,0x3F,0xCE,0xC7,0x45,0xA4,0x80,0xB3,
+	0x94,0xD2,0x9C,0xF3,0x5F,0x98,0xBE,0x4C,0xAC,0x5C,0xA5,
+	0x0A,0x24,0xA5,0xD0,0xE4,0x48,0x72,0x4B,0xAA,0xE2,0x07,
+	0x2D,0x27,0x36,0xF8,0xB5,0x28,0x33,0x71,0x36,0xAB,0x7B,
+	0xCB,0x24,0x52,0x47,0xDF,0x8C,0x9B,0x27,0xD2,0x63,0xD3,
+	0xEF,0xC7,0x62,0x3D,0x6F,0xCD,0x12,0x5C,0x46,0x58,0xC5,
+	0x98,0x82,0x59,0x2D,0x30,0xF5,0x0D,0x74,0x55,0xB1,0xEA,
+	0x23,0xF1,0x01,0x5A,0x64,0x8D,0xD0,0xED,0x92,0x1D,0x82,
+	0x5E,0xA8,0x4E,0xC5,0xE6,0x16,0x0A,0x49,0x42,0x28,0x6A,
+	0x62,0xA0,0xA3,0xD4,0xE0,0xB1,0x86,0xFE,0x45,0x08,0x99,
+	0x8C,0xD3,0x98,0xD1,0x65,0xDB,0x08,0x9A,0x3D,0x3D,0x1A,
+	0xCB,0x05,0xD3,0xD2,0x62,0xC2,0x8F,0x8E,0xB2,0xCA,0x9F,
+	0x0C,0xF9,0x82,0x35,0xB3,0x61,0x9B,0xEB,0xF0,0x8F,0x16,
+	0xAC,0xF4,0x92,0xCA,0x9C,0x0C,0x5C,0xB1,0x69,0xE9,0x9D,
+	0x30,0xEC,0xF8,0xA2,0x14,0x4E,0x0A,0x5E,0xB2,0xF9,0x8D,
+	0x4A,0x0C,0x8F,0x35,0x0C,0xF4,0x79,0xC9,0x7C,0x76,0xFA,
+	0x98,0xB4,0x0A,0x80,0xB3,0x9F,0xE4,0x59,0x66,0xCE,0xD7,
+	0x2C,0x8F,0x07,0x63,0x61,0xBA,0xC7,0x2E,0x79,0x9A,0xE7,
+	0x45,0xAD,0x82,0x77,0xC2,0x9A,0x31,0x8F,0x3D,0x85,0x54,
+	0x25,0x0D,0x6D,0x81,0xD6,0xB8,0x89,0x11,0x45,0x41,0x90,
+	0x19,0x5A,0xEC,0x2C,0xC8,0xBE,0x92,0xF6,0xEB,0x30,0xD4,
+	0x79,0xCE,0xE9,0x90,0xF3,0x83,0x4A,0x41,0x69,0xDD,0x43,
+	0x89,0x48,0x7C,0xE0,0xB8,0xA7,0x59,0x8B,0xD9,0x3C,0x9E,
+	0x52,0x91,0x9E,0xDD,0xF6,0x4C,0xEE,0xD6,0x2D,0x3B,0xA0,
+	0x25,0xA4,0x07,0x81,0xB2,0x3A,0x24,0x5B,0xDA,0xA1,0xED,
+	0x5F,0xA7,0x91,0xB4,0x57,0x5A,0x9D,0x39,0x4A,0x2C,0x15,
+	0xB6,0xA0,0xCC,0x04,0xAA,0x08,0xA5,0xBB,0xC8,0x7F,0x2B,
+	0xDA,0x03,0x8D,0xCC,0x7E,0x72,0x99,0x02,0x55,0xE1,0x21,
+	0xC3,0xAC,0x05,0x6A,0x0F,0x4E,0x38,0x35,0x95,0x96,0xF2,
+	0x96,0xF1,0xEA,0x9D,0x89,0xE7,0xF5,0x5F,0xFE,0xED,0x5E,
+	0xB1,0xB7,0x6B,0xCE,0x32,0x6F,0x06,0x95,0x2B,0x20,0x49,
+	0xCA,0xFC,0x6C,0x20,0x1F,0x76,0x01,0x9E,0x6F,0xC1,0x5F,
+	0x7C,0xE1,0xE4,0x02,0x4D,0x18,0x42,0x20,0xE1,0xFA,0x78,
+	0x98,0x8C,0xA5,0xEE,0x60,0xC8,0x9B,0x4E,0x21,0x88,0x0F,
+	0x8C,0x18,0x2A,0x51,0x01,0x97,0x23,0xCB,0x84,0x8A,0x2F,
+	0x89,0x32,0x03,0x06,0xA7,0x07,0x15,0x5F,0x2B,0x04,0x4F,
+	0xCE,0xA3,0x54,0x42,0x95,0x2A,0xD0,0x18,0x10,0x36,0x23,
+	0x5B,0x7A,0x7E,0x73,0xC4,0x54,0xEC,0x06,0xDE,0xF8,0xDF,
+	0xDA,0x48,0x93,0x65,0x34,0x0F,0x66,0xE8,0x1D,0x5C,0xDB,
+	0xC6,0x9C,0xC0,0x73,0xD0,0x37,0x92,0x8D,0x31,0x5F,0x99,
+	0xC3,0xC2,0x47,0x79,0x47,0xF9,0x46,0xF1,0xA3,0x82,0x8F,
+	0x2C,0xAC,0xD4,0x5E,0x89,0x11,0x0D,0x25,0x7F,0x4B,0xBF,
+	0x12,0x91,0x35,0x94,0xBF,0x54,0xCF,0xB1,0xCB,0xF4,0x89,
+	0x2E,0x54,0xD7,0x15,0xEE,0x96,0xB8,0x28,0xF5,0xDD,0x16,
+	0xA8,0xD5,0x11,0x9D,0x15,0x18,0x4C,0xE9,0x15,0x68,0x19,
+	0xE3,0x43,0xCE,0xEA,0x16,0x46,0x15,0x5C,0xAC,0x10,0x5C,
+	0x92,0x2C,0xD8,0x3B,0x6A,0x41,0x31,0x5B,0xCF,0xFA,0x6D,
+	0x89,0x40,0x45,0xB8,0xBE,0x57,0x78,0x38,0x7C,0x38,0xE5,
+	0x0B,0x43,0xF6,0x4A,0x5E,0x8B,0x64,0x9E,0xEA,0x4C,0x15,
+	0x5A,0xF3,0xDE,0x90,0x9E,0x70,0x55,0xA9,0x4F,0xC1,0xA5,
+	0x13,0x73,0xDF,0xDA,0x8A,0xB5,0xA1,0x7C,0x3A,0x0F,0x5D,
+	0x9A,0x96,0xA5,0x7E,0xEF,0xA4,0xE3,0xE8,0x94,0xED,0x44,
+	0xE9,0xD8,0x5A,0x6D,0x91,0x1D,0xAF,0xED,0xFA,0x8F,0x0F,
+	0xA1,0xA9,0x32,0x1B,0x3B,0x29,0x55,0xD7,0xF4,0x1E,0x89,
+	0xC6,0xCF,0xEA,0x7B,0xE9,0xE8,0x14,0xE4,0xEC,0xAF,0x31,
+	0x67,0x53,0x78,0x4C,0x5A,0x55,0x3C,0xCE,0x9B,0x9E,0x37,
+	0x30,0xFE,0x97,0x9E,0x94,0xD5,0x2B,0x72,0x2E,0xED,0x4C,
+	0x01,0xBA,0xCE,0xE4,0xB5,0x99,0x44,0xE3,0xC5,0x21,0x0B,
+	0x5E,0xDE,0x93,0xB5,0x4F,0x22,0x0B,0xED,0x49,0xEE,0x05,
+	0x83,0x7E,0xCB,0x79,0x14,0xBD,0x20,0xEF,0xCC,0x88,0x13,
+	0x59,0x69,0x7A,0xCE,0x7A,0xEB,0x67,0xD2,0x2A,0xD6,0x32,
+	0xC4,0x46,0x5E,0x41,0xD2,0x3C,0xA8,0x69,0x92,0xE3,0x7C,
+	0x21,0x51,0xCA,0xDA,0x8B,0x67,0xF8,0x02,0x49,0x0C,0xE2,
+	0x53,0x54,0x8C,0x8B,0xB8,0xC7,0x2C,0xD4,0x40,0x97,0x90,
+	0x56,0xA6,0x05,0x85,0x2D,0x81,0x3F,0xE1,0xA1,0x80,0x62,
+	0x90,0xC3,0x10,0xD4,0xEB,0x05,0xAE,0xD1,0x0F,0x0B,0x24,
+	0x3D,0x58,0x09,0x2C,0xD3,0x3C,0x12,0x8E,0xCF,0x8D,0xBA,
+	0xC4,0xF0,0x4B,0x2C,0x61,0xD8,0x9A,0x47,0x27,0xA5,0xC2,
+	0x62,0xA5,0x82,0xAA,0xE3,0x9D,0xC7,0x5C,0xA9,0xBB,0xD3,
+	0xB6,0x05,0x41,0x69,0xF2,0xE9,0xC8,0x8C,0x47,0x9F,0xDD,
+	0xD9,0xD0,0x04,0x31,0xEB,0x3F,0x19,0xD5,0x9E,0xD7,0xF7,
+	0xED,0x05,0xC8,0x2E,0x0A,0x60,0x9A,0x07,0x29,0x9B,0x58,
+	0xE2,0x7B,0x32,0x95,0xAE,0xD8,0x29,0x2E,0x2C,0x33,0xE7,
+	0xA6,0x6F,0xF7,0xF8,0xA5,0x27,0x95,0x8C,0x9D,0x4B,0x65,
+	0xB2,0x6F,0x90,0xAB,0x7D,0x5A,0x37,0x9B,0x03,0xBE,0xD4,
+	0x46,0x10,0x62,0x45,0x63,0xDF,0x59,0xA9,0x98,0x70,0x14,
+	0x80,0x33,0xD2,0x4B,0x22,0x03,0x24,0x4A,0x54,0xFF,0x9A,
+	0xB9,0xCE,0x74,0x5E,0x87,0xAB,0xE3,0x0A,0x30,0x79,0xD0,
+	0x6B,0xE4,0x56,0x51,0x6F,0x27,0x30,0x46,0xE6,0xAC,0x41,
+	0xD9,0x58,0x17,0xBE,0x71,0x5C,0x91,0xE2,0xA5,0x61,0x6B,
+	0x6B,0xED,0x10,0xB6,0xFA,0xE5,0xC5,0xA5,0xDA,0xC6,0x32,
+	0xC5,0xB3,0x22,0x65,0x17,0x2B,0x28,0xB8,0x0B,0x77,0x8C,
+	0xE6,0xDB,0x0C,0xD8,0x8A,0xD6,0x3C,0xC2,0xCE,0x38,0xC7,
+	0x10,0x17,0x5B,0x8A,0xE4,0x3D,0xF6,0xA9,0xE4,0x50,0xF0,
+	0x50,0x49,0xF2,0x09,0xB7,0x86,0x7A,0xCF,0x95,0xE6,0xAE,
+	0x6E,0x72,0x66,0xD1,0x10,0xF4,0xD6,0x18,0xCE,0xBB,0xEA,
+	0xB1,0xFF,0x5E,0x6D,0x9A,0x21,0x55,0xA3,0xD0,0x9E,0x78,
+	0x2A,0xF6,0x7F,0xA8,0xA8,0x87,0x02,0x36,0xD8,0x00,0x65,
+	0x1B,0x6C,0xE0,0x79,0x1B,0x6C,0xD0,0x79,0x1B,0xF5,0x75,
+	0x7E,0x9A,0x6A,0x89,0x84,0x8B,0xAA,0x4D,0xA9,0xAB,0xAA,
+	0x4D,0x86,0x5B,0x9C,0x8D,0xFD,0xA5,0xDA,0xAB,0x58,0xB7,
+	0xDB,0x76,0x49,0x44,0x03,0xA3,0xA4,0x13,0xAA,0x19,0x27,
+	0x22,0x1B,0xF5,0xB6,0xC2,0x37,0xB9,0x0C,0x4B,0x94,0x47,
+	0x2C,0xD0,0x11,0xA5,0xC1,0x3A,0xF0,0xDE,0x12,0x41,0x18,
+	0x6F,0xCD,0xE6,0xC5,0x3D,0x90,0xAC,0x35,0xAC,0xB7,0xF6,
+	0x0F,0x6D,0x5E,0x4B,0xE0,0xFB,0x66,0xC9,0x16,0xE2,0x7E,
+	0x62,0xA4,0x10,0xB3,0x89,0x66,0xD9,0x35,0x8A,0xB2,0x38,
+	0x4B,0x07,0x1E,0x85,0x54,0xFA,0xA4,0x40,0xE0,0x24,0xDB,
+	0x90,0x2B,0xC2,0xE6,0x15,0xC4,0xF1,0x3E,0xBA,0xCF,0x91,
+	0xE3,0x67,0x16,0x83,0xC3,0x42,0x94,0x5F,0x5E,0xF7,0xF1,
+	0x6C,0x08,0xA7,0x76,0xF5,0xF3,0xF2,0x66,0x00,0x3C,0xB6,
+	0xF3,0x72,0x9B,0x1B,0x67,0xC6,0x11,0x89,0x1A,0xCC,0x05,
+	0x6F,0xC9,0x6D,0x36,0x27,0x4A,0x95,0x9A,0xB6,0x61,0xE0,
+	0x8D,0xA4,0x28,0xB1,0xB2,0xAA,0x23,0xC7,0x62,0x3E,0x97,
+	0x69,0x32,0x38,0x35,0x2B,0x7A,0xB3,0xA3,0xCF,0x5F,0xB1,
+	0x41,0x81,0x60,0xBA,0x49,0x33,0x08,0xD1,0xD9,0x22,0x6D,
+	0x32,0xF4,0xC6,0x13,0xC0,0x93,0x7D,0x09,0xE0,0x1A,0x1A,
+	0x43,0x40,0x16,0x2E,0x57,0x03,0x3A,0x02,0x91,0x36,0x5B,
+	0xB7,0x04,0xAF,0x80,0x6B,0x5D,0x0B,0x54,0x85,0xFC,0x89,
+	0xCC,0x9C,0x04,0xF4,0x37,0xFD,0x03,0xD8,0x07,0x44,0xC1,
+	0xDE,0xC0,0x08,0xDC,0x1F,0xA9,0x9C,0x10,0x64,0x5B,0x60,
+	0x1F,0xCA,0xD3,0x8C,0xEB,0x7D,0x1B,0x13,0x65,0xC9,0x0F,
+	0xD6,0x00,0xBC,0x15,0xE6,0x61,0x02,0xBF,0x09,0x60,0x7F,
+	0x61,0x5D,0xEE,0xFD,0x48,0x55,0xD1,0x16,0xF1,0x9A,0xFF,
+	0x50,0xA1,0x12,0x85,0x52,0xA9,0x0B,0x28,0x19,0x25,0x39,
+	0x9F,0x59,0x71,0x88,0xF3,0x91,0x48,0x3A,0x22,0x23,0x55,
+	0x14,0x70,0x2A,0xC5,0x5D,0xE3,0x3A,0xE0,0x41,0xBF,0xDD,
+	0x49,0x92,0x18,0xC7,0xA9,0x2F,0xA4,0x03,0x08,0x9E,0x19,
+	0x50,0x42,0x27,0xCD,0xF1,0xDC,0x57,0x3F,0x1E,0x08,0xC7,
+	0xE8,0x28,0x1D,0xD3,0x43,0x9F,0x52,0x4F,0xDC,0x57,0x64,
+	0xA1,0x83,0x42,0x17,0x14,0x1E,0x28,0x4A,0x0F,0xF0,0xB6,
+	0xD2,0x36,0xC6,0xD6,0x3A,0x36,0x1F,0xFC,0xC6,0x04,0xF3,
+	0xCC,0xCB,0x29,0x45,0xA9,0x24,0xB5,0x6F,0x40,0xEC,0x03,
+	0xFF,0x2B,0xBE,0xE2,0xB6,0x60,0xA9,0x86,0xD3,0x10,0xAC,
+	0xE5,0x0C,0xF5,0x17,0xEC,0x78,0x44,0x97,0x19,0x66,0x50,
+	0xC4,0x6C,0xB9,0x85,0x5D,0x35,0x6D,0x01,0xC6,0x64,0x11,
+	0x70,0x18,0xAD,0xEC,0x26,0x6C,0x33,0xB4,0xF8,0x7E,0xAD,
+	0xEC,0x4B,0x08,0x09,0xD9,0x43,0x4D,0x97,0xE4,0x7D,0x96,
+	0x63,0xFD,0xBD,0x3A,0x22,0x50,0x9E,0x66,0xC0,0x4D,0x32,
+	0x52,0xE4,0x87,0x96,0x1A,0x97,0x99,0x12,0xCC,0x09,0x96,
+	0x12,0xA5,0xD6,0x65,0xB6,0x04,0x7B,0x82,0xA3,0x44,0xA9,
+	0x73,0x99,0x2B,0xE1,0x04,0xC1,0x5D,0xA2,0xD4,0xB3,0x8C,
+	0x4C,0xF0,0x21,0xF8,0x65,0x19,0x82,0xD5,0x76,0xE2,0x61,
+	0x62,0x76,0xF3,0x11,0x8C,0x86,0x12,0x58,0xAC,0x2D,0x56,
+	0x98,0x8B,0x21,0x3F,0x19,0xE8,0x2F,0xA3,0xE1,0x3F,0x1A,
+	0xE8,0x40,0x99,0x0E,0x3E,0x11,0x6C,0x48,0xC9,0x9E,0xA4,
+	0x86,0xC9,0x68,0x84,0x8D,0x52,0x1D,0xFE,0x87,0xC3,0x13,
+	0x11,0x86,0x91,0xD9,0x93,0xB1,0xD1,0x32,0x1A,0xD1,0xA3,
+	0xB1,0x0E,0xB4,0xE9,0xB8,0x13,0x71,0x86,0xB4,0xEC,0xC9,
+	0xA4,0x04,0x19,0xC9,0xF2,0x34,0x4F,0x83,0xC1,0x91,0xCA,
+	0x0E,0x92,0xC9,0x90,0xD9,0x50,0x3E,0x59,0xA4,0xD0,0xA1,
+	0x4B,0xAC,0xD0,0x57,0xCE,0x88,0x0A,0x77,0x98,0x22,0x71,
+	0x3C,0x18,0xC9,0xBE,0xDF,0x94,0x21,0x3B,0x69,0x6A,0x2C,
+	0xAD,0x61,0x3C,0x6A,0xEA,0x60,0x39,0x6D,0x6E,0x6E,0x6E,
+	0x68,0x99,0x3D,0x69,0x6B,0x2D,0xAD,0x61,0x3D,0x6A,0xEB,
+	0xE0,0x38,0x6D,0x6F,0x6E,0x6F,0xE8,0x98,0x3D,0xE9,0xEA,
+	0x2C,0xAD,0xE1,0xFC,0xD2,0x35,0x6B,0x15,0xE5,0x92,0x01,
+	0x56,0x1B,0xA1,0x70,0x44,0x60,0x91,0x5C,0xFF,0xDB,0xF4,
+	0xF3,0x91,0xD6,0xF0,0x19,0xF5,0xB3,0x69,0xE7,0x96,0xA8,
+	0xD3,0xB3,0x07,0xA6,0x39,0xAC,0x47,0x6C,0x10,0xD0,0x91,
+	0x32,0x93,0xEA,0x11,0x13,0xB8,0xC8,0x88,0xC9,0xC5,0xE9,
+	0x11,0x28,0x68,0x69,0xC4,0xE4,0xD6,0x48,0x09,0x18,0x31,
+	0x62,0x22,0x23,0xCF,0x6B,0xD8,0x25,0x5B,0xC8,0x2E,0x82,
+	0xD8,0x78,0xFC,0x92,0x2D,0x3D,0xBC,0xFE,0xE2,0xCC,0x27,
+	0x59,0xF5,0x7D,0x4D,0x42,0x92,0x77,0xE1,0x39,0xB9,0x34,
+	0x2E,0x8F,0xB7,0xF2,0xCE,0x19,0x2C,0x14,0x05,0xFD,0x1C,
+	0x44,0xDB,0xC1,0xF7,0xCD,0x1D,0xB0,0x0B,0x1B,0x34,0xCC,
+	0x5A,0xDB,0xA1,0xE6,0x3C,0x81,0x37,0xC0,0xCA,0x6A,0x90,
+	0x64,0xDE,0x4D,0x8C,0x4C,0x40,0x84,0x7A,0x5D,0xD1,0x16,
+	0x9F,0xA5,0x17,0xAF,0xAF,0xE0,0x08,0xD6,0x07,0x33,0x02,
+	0xF3,0x86,0x66,0x8C,0x90,0x41,0x5F,0x46,0x4C,0xBC,0x74,
+	0x47,0xB0,0x9E,0xF0,0xBB,0x3F,0x27,0x39,0x6A,0x38,0x76,
+	0xE7,0x52,0x7C,0x30,0xA8,0x9B,0xDE,0x41,0x04,0xDF,0x29,
+	0x99,0x3A,0x61,0xBE,0x25,0x8A,0x72,0x98,0x15,0xD5,0x6C,
+	0x29,0x82,0x12,0xA9,0x1C,0x6D,0x15,0x6B,0xB6,0x14,0x47,
+	0xA1,0x29,0x27,0x58,0x25,0xE1,0x1E,0xD6,0x08,0x06,0x1E,
+	0xF1,0x66,0x43,0x64,0x0C,0xCA,0xFC,0xA4,0xC1,0x3B,0xC3,
+	0x38,0x6E,0x1C,0x37,0xD7,0x77,0x46,0x26,0x68,0xE8,0x21,
+	0x20,0x82,0xEA,0x20,0x7E,0x91,0x6D,0x6D,0x8C,0x1A,0x4E,
+	0xB5,0xFB,0xA1,0x14,0x97,0xE9,0xF7,0xE2,0x9A,0x0F,0xC1,
+	0xB6,0x02,0xA8,0x8B,0x0D,0xB8,0xF4,0xFA,0x1C,0x7F,0x85,
+	0xAA,0x1B,0xDA,0x2F,0x63,0x4D,0x7C,0xEE,0x99,0xB3,0x95,
+	0xAC,0xEC,0x7F,0xD5,0xD6,0xD7,0x74,0xBF,0xB9,0xDC,0xA1,
+	0x7D,0xDD,0xE4,0x48,0x88,0xA8,0x7F,0x1A,0xB3,0x0D,0xBB,
+	0xBA,0xB1,0x99,0xBC,0xFA,0x63,0xED,0xEA,0x32,0x33,0x79,
+	0xF1,0xE7,0xD2,0xDD,0xF4,0xEA,0x22,0xAB,0xF7,0x8D,0xD0,
+	0x33,0x81,0xC6,0xB7,0xA3,0x19,0x3F,0xAF,0xC8,0x58,0x13,
+	0x9B,0x05,0xE9,0x05,0x08,0x22,0x28,0x41,0x5B,0x10,0x38,
+	0xB6,0x23,0x89,0xD1,0xF8,0xD0,0x26,0x54,0xE9,0xF1,0x3E,
+	0xAF,0x19,0x21,0x80,0x97,0xEE,0xC4,0xB0,0x21,0xFD,0xFD,
+	0xD0,0x94,0x96,0x3B,0x94,0xB2,0x2B,0x39,0xFC,0x13,0xDF,
+	0x4C,0x3A,0x85,0x71,0xB4,0xE6,0x38,0x4D,0xA0,0x00,0xE9,
+	0xD7,0xEA,0xA2,0x52,0xAB,0xE6,0xD4,0x33,0xEF,0x42,0x70,
+	0xAF,0xA4,0x18,0xFC,0x71,0x51,0x4B,0x31,0xD2,0x29,0x33,
+	0x51,0x49,0x08,0xED,0xC5,0x1B,0x44,0x3B,0xB2,0xC1,0xE1,
+	0xD7,0x8D,0x3B,0xD8,0x43,0xF6,0xFF,0x8E,0x48,0xC2,0x06,
+	0x26,0x43,0x8A,0xEB,0x69,0xD0,0x3C,0xD1,0x20,0x21,0xAF,
+	0x1B,0x56,0xB4,0xBE,0x3F,0xA6,0x8A,0x25,0x51,0x91,0x47,
+	0x72,0x0F,0xD4,0x8A,0xDE,0xD5,0xA8,0x24,0xA9,0x28,0xC9,
+	0xAD,0x11,0x7F,0x71,0xB8,0xB5,0x8A,0x6E,0xF8,0x2D,0xB2,
+	0xB2,0x39,0xB7,0x3B,0x3D,0xB5,0xC3,0xB4,0xC7,0x0E,0xBC,
+	0xA4,0x50,0x7D,0x06,0x16,0x90,0x44,0x9B,0xFC,0xAE,0x1E,
+	0xBE,0xC4,0x56,0x33,0xA9,0x47,0x27,0xB3,0x02,0xD3,0x73,
+	0xE7,0x14,0x4D,0x0C,0x84,0xA7,0x5C,0x8C,0x82,0xD3,0x1F,
+	0x54,0x83,0xEE,0x78,0x17,0xE3,0xB6,0xD3,0x79,0x53,0x00,
+	0x73,0xB7,0x90,0x78,0xCE,0x08,0xA5,0xEA,0xD3,0xE0,0xC5,
+	0x9E,0x94,0xC0,0x02,0x1B,0x2F,0xAA,0x0D,0x78,0x10,0x6B,
+	0x27,0xC0,0x67,0x27,0x38,0x9E,0x60,0xF0,0x68,0xD7,0x2B,
+	0x5D,0x27,0x25,0xB5,0x38,0x5E,0xB5,0x42,0x60,0xF2,0xD5,
+	0x6B,0xF9,0xF7,0x65,0x8F,0x58,0x99,0xDE,0x59,0xCD,0xF0,
+	0xA3,0x16,0xEA,0xF4,0xDB,0x1F,0xAB,0x1A,0x25,0xA7,0x65,
+	0x21,0xC9,0x1F,0x90,0x94,0x4F,0x12,0x65,0x9F,0xF4,0x3E,
+	0x20,0xBF,0x2F,0x97,0x31,0xE3,0xA1,0x74,0x9B,0x4F,0xE6,
+	0x5F,0x24,0xD0,0x5F,0x4A,0x47,0x3F,0x59,0x2F,0x92,0x96,
+	0xBE,0x6D,0xB7,0x3C,0x05,0xF3,0xEA,0x9B,0x83,0x65,0xDF,
+	0x1A,0xD7,0x0D,0x7F,0x67,0x24,0x2C,0x65,0x1F,0x48,0x9A,
+	0x44,0x0E,0x0B,0xBB,0xDC,0x23,0x87,0x71,0x0E,0xA2,0xC1,
+	0x44,0xA9,0x21,0x83,0xD6,0xCD,0x44,0xDB,0x38,0xE1,0x73,
+	0x5B,0x0B,0xF1,0x66,0x27,0xB7,0x49,0x5B,0xE7,0x55,0x95,
+	0x1A,0x6A,0xD6,0x64,0xC3,0x8E,0xA8,0x67,0x14,0x33,0xE7,
+	0xDD,0x03,0xD6,0x12,0x5D,0x8D,0x57,0xE3,0xED,0x48,0x6B,
+	0xAD,0xAB,0x36,0x3B,0x3C,0x0E,0xFC,0xD9,0x4F,0xE7,0xDB,
+	0x4E,0x30,0xC3,0xFD,0x96,0x0D,0x99,0xAD,0xCB,0xBE,0x1F,
+	0x4A,0xD5,0x3F,0x81,0x0D,0x97,0x12,0xCF,0x1C,0x2C,0xC6,
+	0x47,0xB4,0x2E,0x8D,0x2D,0xC6,0x7D,0xB2,0x18,0xFD,0x02,
+	0x65,0x65,0x8B,0x11,0xB1,0x97,0x1A,0xB3,0xF5,0xE4,0xB2,
+	0x7A,0xE5,0xEF,0xEC,0x10,0x90,0x93,0x7B,0x68,0x3E,0xA2,
+	0x3D,0xF1,0xFE,0x9E,0x28,0x0E,0xCA,0xAB,0x00,0x97,0x1C,
+	0x6E,0x49,0xF7,0x2A,0x27,0xF5,0x7A,0xD4,0x5E,0x88,0x2E,
+	0xCB,0x4A,0x87,0x7C,0xB7,0x46,0x07,0x65,0xC3,0x94,0xCE,
+	0x32,0xCA,0xC6,0xA5,0xB1,0x6D,0xEE,0xD6,0xA8,0x5A,0x3A,
+	0x6A,0xFA,0xDD,0xDA,0x7F,0xE4,0xE7,0xC8,0x77,0xCB,0x89,
+	0x1C,0x6B,0x39,0x20,0x9D,0xA6,0xCB,0xBB,0xD0,0x8E,0x99,
+	0x9C,0xDB,0xD9,0x2A,0xDB,0x3E,0x64,0x81,0x69,0x6A,0x5E,
+	0x61,0x85,0x6F,0xED,0xBB,0x11,0x69,0x6C,0x0E,0xFE,0x92,
+	0xD8,0xC4,0x7B,0x3F,0xA9,0x48,0x71,0xC9,0x37,0xD2,0x1F,
+	0xF2,0x7E,0x66,0xDF,0x17,0x95,0x63,0xA3,0xEE,0x90,0x34,
+	0x83,0xE5,0xC7,0x1B,0xDE,0x97,0x5F,0x3C,0xF0,0xE4,0x11,
+	0xB6,0xC6,0x19,0x68,0x68,0x74,0x37,0x74,0x4C,0x71,0x18,
+	0x28,0xCE,0x3E,0xEE,0xBC,0x0B,0x92,0xF1,0x78,0xEA,0x5B,
+	0x2D,0x28,0x34,0x2C,0x50,0xB0,0xC0,0x57,0x20,0x44,0x2E,
+	0x26,0xA9,0x89,0xB2,0xBC,0xDB,0x82,0xE2,0x6C,0x63,0x31,
+	0x29,0x1E,0xF0,0x1B,0x69,0xFE,0x09,0x4E,0x2F,0xC4,0xE7,
+	0x7C,0xCA,0x64,0x6A,0xD4,0xBE,0xA0,0x38,0x26,0x1F,0xD0,
+	0xF1,0xFC,0xED,0xAD,0x02,0xD8,0x6C,0x95,0x9C,0x43,0x1B,
+	0x03,0x6B,0x71,0x8F,0x9E,0x8C,0x73,0xE9,0x29,0x48,0x03,
+	0x4F,0xD1,0x38,0x2A,0xC7,0xA5,0xAF,0xB5,0xFE,0xE2,0x1D,
+	0xA2,0x15,0xD5,0x13,0x7A,0xCE,0x60,0x45,0xBA,0x8E,0xF0,
+	0xA0,0x31,0x1F,0xD0,0x63,0xDF,0xDC,0xAC,0x27,0xA0,0x5E,
+	0x08,0x6A,0x7A,0x70,0x71,0xE0,0xD3,0x45,0xA1,0x3C,0xDE,
+	0x6E,0xA5,0x32,0xEB,0xA7,0x2F,0x62,0xD5,0xAC,0xEF,0xB3,
+	0x1C,0x28,0x57,0x82,0xA4,0x49,0xD2,0x62,0x28,0x0D,0x89,
+	0x20,0xF7,0x0B,0x0E,0xE2,0x3C,0x2A,0x51,0xF6,0x59,0xFB,
+	0x4C,0xCE,0x44,0x7C,0x81,0xE1,0xE1,0xE5,0x84,0x47,0x68,
+	0xFB,0x97,0x5C,0x0B,0x8F,0x30,0x30,0xE4,0xF8,0x23,0x6E,
+	0xA8,0xB9,0x83,0x84,0xDA,0xB9,0xBC,0x84,0x72,0x70,0x0D,
+	0xBC,0xB8,0x2D,0x81,0x23,0x0D,0x9C,0x9D,0xD0,0xF8,0x6D,
+	0x2A,0x9B,0xB8,0xC9,0xBC,0xB9,0xE3,0x91,0x00,0xBE,0x33,
+	0x89,0x03,0xE5,0x92,0x9C,0xAB,0x0A,0xF8,0xAA,0xCD,0x14,
+	0x3E,0xE4,0x48,0x2A,0x32,0x8C,0x0F,0xE8,0x04,0x57,0x43,
+	0x4B,0x9C,0xD5,0xBD,0x9C,0x9E,0x19,0x36,0xE2,0xC4,0xD1,
+	0x0F,0x36,0x22,0x45,0x1C,0x7E,0x51,0x1D,0x70,0x19,0x43,
+	0x98,0xC9,0x9B,0x33,0xBA,0x88,0x4A,0x92,0x01,0x65,0x20,
+	0x99,0x1D,0x71,0x49,0x60,0x0A,0x29,0xAC,0x2D,0x1C,0x29,
+	0xBB,0xD7,0xC6,0x3F,0xB1,0x7B,0xF3,0x3F,0x2E,0xF3,0x63,
+	0x1A,0xF2,0xE5,0xC4,0x52,0xC2,0x28,0x8E,0xBE,0xCA,0x1D,
+	0xA7,0xF8,0xA1,0x95,0xCD,0x8D,0x17,0xF5,0xF4,0xAC,0x87,
+	0xF9,0xA8,0x58,0xFF,0x21,0x7A,0xE1,0x52,0x38,0x7C,0xF4,
+	0x7E,0xE7,0x41,0x0E,0xD8,0x10,0x1A,0x51,0x26,0xD0,0x5E,
+	0x1A,0x03,0x37,0xC1,0x00,0x26,0x18,0x84,0x9D,0xA0,0xB2,
+	0x19,0x2D,0xE7,0xB5,0xBA,0x42,0x46,0xB2,0x8F,0x52,0x9D,
+	0x5C,0x1A,0xF2,0x62,0x26,0x1F,0x6F,0x5A,0x7B,0xD2,0xFD,
+	0x3A,0x17,0x6E,0x0F,0xC0,0x24,0x6D,0x92,0x85,0x5B,0xC0,
+	0xC2,0x8D,0xC9,0xB8,0x88,0xCB,0x55,0x10,0x4B,0x81,0xD1,
+	0x7A,0xB4,0x74,0x21,0x4F,0xFE,0x7D,0x2E,0xD3,0x81,0x7E,
+	0x3F,0x0E,0x74,0x17,0xBC,0x85,0xEF,0x88,0x59,0xE2,0x27,
+	0xC3,0x06,0x73,0xBD,0x25,0x99,0xCE,0x94,0xC0,0x9A,0x8E,
+	0x49,0x63,0x65,0x6F,0x42,0x9C,0x2B,0x5F,0xF8,0x82,0x25,
+	0x11,0x43,0x7C,0xF4,0xE7,0xBE,0xA6,0xCC,0x81,0xFB,0x25,
+	0xC3,0x82,0x78,0xC8,0xC8,0x75,0x66,0x59,0xA1,0x2F,0x6A,
+	0x4E,0x04,0x97,0x13,0x66,0x7C,0x67,0xE2,0x49,0x28,0x63,
+	0x4C,0x7B,0x14,0x70,0x76,0x66,0x3B,0xB9,0x87,0xBC,0x13,
+	0x71,0x7F,0xD4,0x67,0x85,0x84,0x05,0xA3,0x7D,0xD6,0x5F,
+	0x98,0x44,0xEE,0x3B,0x47,0x24,0x3F,0x7C,0x1F,0x24,0x44,
+	0x3A,0xF6,0x1F,0xF3,0x6E,0x98,0x6C,0xE6,0x8B,0xB6,0x98,
+	0xF7,0x82,0x21,0x41,0xC2,0x8A,0xAE,0xF3,0x44,0x91,0xD8,
+	0xAF,0x01,0x1C,0x1C,0xF7,0x55,0x91,0x3B,0xAB,0x04,0xD8,
+	0x0E,0x94,0xC6,0xC7,0xB1,0x85,0x48,0x81,0x6F,0x71,0xA6,
+	0x71,0x2E,0x73,0xD1,0xD6,0xB1,0x69,0x70,0xDB,0xC1,0x95,
+	0xCB,0x83,0xA8,0x13,0xE7,0x12,0x51,0xF4,0xE0,0x6D,0x6C,
+	0xE2,0xC9,0x57,0xFB,0xD8,0xA5,0x38,0x42,0x62,0x42,0x02,
+	0x8F,0x18,0x94,0xA8,0x09,0xBB,0x8A,0x4A,0x1C,0xC6,0x26,
+	0x90,0x01,0x7D,0xF9,0x1B,0x51,0xFB,0x30,0x86,0x8F,0x83,
+	0xB8,0x60,0xB7,0x03,0xCF,0x7A,0x77,0x27,0x27,0x40,0x0C,
+	0x53,0x1A,0x43,0x8D,0x4A,0xFC,0x03,0x41,0x12,0x04,0x39,
+	0xCA,0x39,0xD3,0x64,0x0B,0x86,0x39,0x22,0x41,0x33,0x9C,
+	0x53,0x20,0x7D,0x1B,0x2C,0x64,0x40,0x8B,0xCA,0x90,0x1D,
+	0x05,0x87,0x5A,0xAA,0xCF,0x7A,0x8C,0xDA,0xEF,0xB0,0x78,
+	0x6C,0x1C,0xFE,0xEE,0xD3,0xB9,0xF4,0x05,0x57,0x8F,0x2C,
+	0x33,0xD9,0xE4,0x41,0xED,0x93,0x7E,0xE5,0xF9,0x5F,0xB6,
+	0xDB,0x81,0x1C,0x5D,0xAC,0x3D,0xB8,0x3B,0x3A,0xA0,0xD5,
+	0x79,0x16,0x7B,0x94,0xAE,0x4E,0x03,0x98,0x70,0x10,0xF3,
+	0x39,0x0B,0xE4,0x86,0x3A,0x23,0x04,0x15,0x1D,0x7C,0x1F,
+	0xC0,0xCD,0xFC,0xF3,0x05,0x20,0x93,0xAF,0x79,0x21,0xA8,
+	0xA3,0x3B,0xD2,0x4C,0x77,0x4D,0x2E,0x0D,0xB8,0xFD,0x0B,
+	0x6B,0x39,0x40,0x73,0xA2,0x55,0x2F,0x1E,0x61,0xFF,0x52,
+	0x51,0xCE,0x46,0x73,0xBA,0x55,0x34,0x1E,0x69,0x3F,0xCB,
+	0x6D,0xA4,0xAC,0xD3,0x05,0xA7,0x2E,0x64,0x49,0xE7,0x9C,
+	0xA3,0x7E,0x96,0x3E,0xFD,0x04,0xCE,0xE4,0xCA,0x75,0x4D,
+	0xBD,0x69,0x68,0x62,0xB4,0xFA,0xED,0x08,0xC7,0xC1,0xFC,
+	0x77,0xDE,0x4A,0xD2,0xEA,0x47,0x1A,0x17,0xF3,0xBB,0x93,
+	0xBE,0xD5,0x7A,0x9A,0x0D,0x73,0xCA,0x89,0x64,0xB5,0x95,
+	0xE6,0xC8,0x7C,0xE2,0x24,0x64,0xB5,0x9D,0xE6,0xCC,0x6C,
+	0x8C,0xC5,0x2F,0x44,0x09,0x55,0x4B,0x93,0x04,0x8C,0xA9,
+	0x3B,0x45,0xD2,0xA5,0x77,0xD6,0xBC,0x36,0xDD,0x90,0x1F,
+	0xDE,0x98,0xAD,0x3D,0x02,0xCB,0xF8,0xBB,0x4E,0x7D,0x81,
+	0xDF,0xBD,0x94,0xF5,0x46,0x83,0x6C,0x8E,0x74,0x3D,0xC3,
+	0x99,0xB2,0x78,0xB9,0x3C,0xCB,0x14,0xA8,0x12,0x10,0x2F,
+	0x98,0x77,0xB5,0xB9,0x99,0xD9,0x34,0xF0,0xB1,0xE6,0xE8,
+	0xAD,0xAA,0x4E,0x20,0x15,0xF6,0x45,0x26,0x02,0x85,0x32,
+	0x8C,0x21,0x46,0x1E,0x52,0x39,0x64,0x98,0x62,0x1A,0x16,
+	0xA7,0xA7,0x81,0x38,0x6B,0x83,0x05,0x0B,0x21,0xB4,0x26,
+	0xBC,0x28,0xB5,0x0D,0xCD,0x65,0xC3,0xB7,0x90,0x45,0x94,
+	0x55,0x6C,0xA8,0x02,0x27,0xC0,0x11,0x68,0xE8,0x35,0x66,
+	0x74,0x5B,0x8C,0xBC,0x08,0x4B,0x6A,0x9E,0x5A,0xAA,0xF3,
+	0xE3,0x43,0x4E,0x67,0x23,0x9A,0xFB,0x54,0xDB,0xA0,0xF5,
+	0xE0,0xFF,0x8C,0x68,0x11,0x0B,0x98,0xFE,0x0F,0xD5,0xC3,
+	0x04,0xC0,0x27,0x03,0x1F,0x04,0x16,0x76,0xAA,0x68,0x0C,
+	0x1C,0xDE,0xB4,0x08,0xB8,0x69,0x16,0x00,0x0B,0x5A,0x3D,
+	0x7B,0x03,0x25,0xF9,0x39,0xC0,0x83,0xE9,0x06,0x87,0xDB,
+	0xF5,0x0D,0xA9,0x98,0xC1,0x66,0x79,0xDC,0xA2,0x8F,0x78,
+	0x0F,0x18,0x9D,0xE8,0x61,0xCC,0x01,0x47,0x37,0x90,0x1C,
+	0xC9,0xB6,0xE2,0xBF,0xFC,0x02,0xF2,0xA9,0x85,0x19,0xB9,
+	0xC1,0xE8,0x37,0x4B,0xC4,0x5C,0x8B,0x83,0xC4,0x77,0xC3,
+	0x35,0x8E,0x33,0x8E,0xA0,0x0D,0x79,0x1B,0xAC,0xD8,0x92,
+	0xD9,0x8D,0xC0,0x43,0x32,0xF9,0x3A,0xBD,0xFD,0x69,0x0C,
+	0x45,0x86,0x05,0x4F,0x00,0xBE,0xCB,0xAC,0x7D,0x4E,0x80,
+	0x1D,0x41,0x65,0x23,0x80,0x35,0xF4,0x9B,0xEC,0x21,0xA1,
+	0xC9,0x8C,0xBB,0x3A,0x1D,0x62,0xB2,0x10,0x8D,0x19,0x35,
+	0xB7,0xCB,0xFB,0x29,0x92,0x54,0x09,0xB1,0x30,0x7C,0xED,
+	0x6B,0x09,0x43,0x75,0xC0,0x5C,0xAD,0xAA,0xF5,0x21,0x9B,
+	0x6A,0xEA,0x17,0x31,0x3B,0x87,0x22,0x8F,0xFE,0x62,0x9D,
+	0x29,0x41,0x7C,0xD8,0xA0,0x85,0x48,0x6D,0xCC,0x1E,0x90,
+	0x53,0x26,0x2D,0x65,0xFF,0x5D,0x85,0x86,0x38,0x79,0x98,
+	0x7C,0x4F,0xBB,0xE6,0xC8,0x96,0x18,0xA3,0x66,0x8C,0x9D,
+	0x38,0xD1,0x9E,0xDB,0xD2,0x1D,0x93,0x08,0x61,0x06,0xE8,
+	0x6A,0xDF,0xF4,0x94,0xB4,0x76,0x75,0xA4,0xB6,0xDD,0x31,
+	0xBB,0x86,0xA5,0xBE,0x8E,0x44,0x0B,0x4C,0x43,0x75,0x41,
+	0x72,0xC7,0x0E,0xA5,0xDF,0x67,0x5D,0xF4,0x8D,0xF7,0x7C,
+	0x00,0xA0,0x1E,0xED,0x77,0x62,0x7C,0x88,0xC2,0x03,0x77,
+	0x15,0x23,0x17,0xD4,0xE6,0xE8,0x25,0xF6,0x7B,0x1C,0xF5,
+	0x11,0xC5,0xC7,0x9E,0xBB,0x70,0x40,0x4D,0xB2,0x1B,0x81,
+	0xCF,0x84,0xD2,0xBE,0x12,0x13,0xAA,0x82,0x9C,0x75,0x7A,
+	0x56,0x4A,0x96,0x63,0xAD,0xC7,0x25,0xBD,0x37,0xCD,0xDC,
+	0x08,0xFE,0x98,0xCF,0xEA,0x74,0x3B,0x03,0xA7,0xA5,0x84,
+	0x25,0x55,0x4A,0xCD,0x12,0xA2,0xB1,0x2C,0x3B,0xCE,0x94,
+	0x67,0x53,0x83,0xEE,0xDA,0x76,0x53,0xD6,0x0B,0xE1,0x1E,
+	0xF7,0x2C,0xF9,0x7D,0xE6,0xD2,0x8F,0xAD,0x96,0x4C,0xD7,
+	0x31,0x65,0x8D,0x15,0x2B,0xCD,0xE7,0x5B,0xAC,0xA4,0x12,
+	0xAF,0x40,0x54,0x8E,0xD4,0x12,0x09,0xB9,0xE4,0x54,0xF5,
+	0x01,0x81,0x95,0x0F,0x49,0xF3,0x91,0x52,0x2D,0x95,0x2F,
+	0x53,0xBF,0xFD,0xF0,0xA1,0xC4,0x77,0x21,0xDC,0x82,0x09,
+	0x1D,0xE1,0x5B,0x21,0xE6,0x12,0x39,0x86,0x7C,0x1C,0x44,
+	0x0F,0x68,0xF3,0xBC,0x4A,0x25,0x87,0x7B,0x83,0x42,0x1D,
+	0x1D,0x82,0xD6,0xB5,0xAF,0x07,0xD3,0xAA,0xC1,0xAB,0x32,
+	0x05,0x97,0xAE,0xF7,0x36,0xBE,0x3F,0x47,0x4D,0x92,0x47,
+	0xEB,0x59,0x2F,0x65,0x08,0x31,0xA7,0xB2,0x5D,0x72,0xC5,
+	0x71,0x31,0x4A,0xF2,0xD4,0xEC,0xEF,0xF2,0x4C,0x48,0xA4,
+	0xE0,0xAB,0x0A,0xA0,0x74,0xB8,0x44,0xFE,0x56,0x53,0x69,
+	0xD1,0x95,0xFC,0xF0,0xDC,0xA4,0xB2,0x8C,0xFF,0xE6,0x1F,
+	0x48,0x85,0x24,0xF4,0x49,0xDE,0x83,0xDB,0x85,0x6B,0x9B,
+	0xCA,0x38,0xDC,0xA8,0xA5,0x7C,0xBE,0x75,0x97,0x2A,0xA0,
+	0x20,0xC5,0x29,0xE3,0x70,0xBA,0x96,0xDB,0x97,0xF3,0x03,
+	0x2C,0x1D,0x86,0x3D,0x66,0x4E,0xA4,0xE6,0x23,0xF0,0x0F,
+	0x64,0x6E,0x2C,0x24,0x6E,0x0A,0x0E,0x61,0xBE,0x58,0xEC,
+	0x93,0x2F,0xA8,0x67,0x7A,0x7E,0x71,0xDD,0x8B,0x42,0x42,
+	0xFE,0xF1,0x05,0xAA,0x1F,0x51,0x4D,0x14,0x98,0x43,0x5A,
+	0xC4,0x6B,0x3F,0xA8,0x3E,0x91,0x9C,0x5D,0x37,0x6C,0x09,
+	0xCC,0x76,0x48,0xBE,0x4B,0x02,0x6C,0x94,0x24,0x55,0xA2,
+	0x69,0x2C,0xE1,0xC9,0x9C,0x66,0x3B,0x90,0xA7,0x98,0x8F,
+	0xE5,0x41,0x8A,0x8B,0xAF,0x0B,0xB6,0x22,0x1C,0x3D,0xE6,
+	0xC2,0xD8,0x92,0xCC,0x15,0xA4,0x96,0xF6,0x27,0x11,0x1B,
+	0x25,0x16,0xEC,0x03,0x3C,0x4E,0xCB,0x26,0x90,0xEA,0xD0,
+	0xA5,0x98,0xE2,0x95,0xE8,0xAF,0x35,0xAC,0x8A,0xD3,0x4B,
+	0x8D,0x17,0x52,0xAA,0x4B,0x8B,0xB7,0x82,0xB4,0xE3,0xC0,
+	0x29,0xBA,0x78,0xE1,0xC4,0x47,0x47,0x2E,0x62,0xD4,0x42,
+	0xC9,0x6E,0xC3,0x8F,0xEF,0x9B,0x4E,0x3C,0xC1,0x9C,0x4F,
+	0x61,0x4F,0x73,0x8F,0x6A,0x5C,0x79,0x65,0x02,0xBB,0x2A,
+	0x55,0x94,0x2C,0xF9,0xDD,0xA4,0x53,0x4C,0x3C,0x35,0x65,
+	0xF9,0x68,0xDA,0x5F,0x27,0x8A,0xFB,0xD5,0xDD,0x6A,0x29,
+	0x3F,0xC3,0xE8,0xAD,0x77,0x1A,0x8E,0xAF,0xD4,0x79,0xAF,
+	0x4A,0x1B,0xA5,0xEC,0x1C,0x4E,0x3B,0x69,0x28,0xBD,0x7A,
+	0x9C,0x2F,0x25,0xAA,0x6D,0xB5,0xB3,0x82,0x19,0x0E,0x05,
+	0x5F,0xC5,0x6C,0x9F,0x1A,0x11,0x61,0xBB,0x09,0x12,0x6C,
+	0xC8,0x67,0x8E,0x3F,0x91,0xA3,0x66,0x2A,0x7C,0x7B,0x7A,
+	0x36,0x5E,0xD3,0xDE,0xAB,0x08,0xAD,0xD7,0x6F,0x57,0x5F,
+	0x23,0xDE,0x6A,0xC7,0x42,0xCD,0x51,0xEB,0x64,0x35,0xB8,
+	0x3E,0x36,0xA2,0x4D,0x34,0x41,0xBB,0x43,0x0A,0x61,0x38,
+	0xF5,0x57,0xDB,0x2B,0xE1,0x28,0x86,0x2A,0x95,0xE9,0x16,
+	0xA4,0xEE,0xD2,0x33,0xF7,0x47,0xE1,0xCF,0x82,0xC4,0xF4,
+	0x71,0xE8,0xB1,0x9D,0x2D,0xF4,0xAB,0xE7,0x4A,0x9A,0xD1,
+	0x6F,0x1E,0x4D,0x9A,0xA9,0x6B,0xDE,0x1B,0x9A,0x8F,0x12,
+	0x12,0xA1,0x1E,0x5B,0x38,0x7F,0xEC,0xCF,0x82,0x60,0x99,
+	0xF1,0x11,0x96,0xFE,0xD8,0xCA,0x03,0xEA,0x7B,0xEF,0x58,
+	0xED,0xB9,0xAD,0xB7,0xE8,0xE8,0xAD,0x2D,0x74,0xD0,0x3F,
+	0xAC,0xA2,0xC1,0x49,0xF4,0x8E,0x9D,0xA2,0x5D,0x9C,0xB5,
+	0xB6,0x6A,0x9D,0x98,0xBD,0xE2,0x4B,0x3B,0xD5,0x14,0xBA,
+	0x62,0xAD,0xD4,0xBF,0x32,0x45,0x3D,0xFC,0x52,0x33,0x81,
+	0x63,0x69,0x55,0xF4,0xC0,0x16,0x19,0x9B,0x00,0xAF,0x54,
+	0xAA,0xBB,0x12,0xF8,0xCF,0x03,0x4A,0x32,0x9C,0xB7,0x9D,
+	0xC7,0x91,0x0C,0x27,0x6C,0xE7,0xE5,0x48,0x86,0xFD,0xB6,
+	0xF3,0xD6,0x24,0xC3,0x56,0xDB,0x79,0x7F,0x92,0x5E,0x43,
+	0xB9,0x51,0xD0,0xDF,0x3F,0xA8,0xA9,0xAF,0x2F,0x9C,0x73,
+	0x78,0x63,0x5E,0x61,0x30,0x4A,0xB1,0x75,0xA2,0xA5,0x02,
+	0xD2,0xA7,0xD8,0x07,0xD9,0xD8,0x0B,0xE5,0xD5,0xF2,0x9B,
+	0x13,0x18,0xDD,0x3C,0xFD,0xBE,0xC5,0x5F,0x5C,0x16,0xFF,
+	0xDD,0x30,0xA2,0x9E,0xFB,0x8F,0x54,0x12,0xCF,0x8E,0x58,
+	0x3B,0x8F,0x16,0x9D,0xB6,0x79,0x17,0x21,0x28,0x18,0x57,
+	0xB6,0xF2,0xD8,0xC1,0xE8,0x62,0xCF,0xA7,0xCA,0x03,0x7E,
+	0x2F,0x5C,0xD1,0xDA,0x34,0x89,0x79,0xA5,0x03,0xCD,0x4C,
+	0x39,0xAD,0x03,0x7E,0xC3,0xA3,0x1D,0x93,0x77,0x90,0xF2,
+	0x1F,0xA9,0x78,0x39,0xC5,0x24,0xEA,0xAE,0xEA,0xD0,0x47,
+	0x85,0x40,0xE2,0xCA,0x54,0x34,0xC4,0xF2,0x52,0x42,0xC6,
+	0x1D,0x71,0x53,0x6A,0x13,0x49,0xAA,0xF5,0x5A,0xCA,0x30,
+	0x49,0x2A,0xAF,0x2C,0xE5,0x3F,0xE0,0xAE,0xD4,0xCA,0x8E,
+	0x0C,0x84,0xFA,0xD3,0x64,0x12,0xE9,0x2E,0x85,0xDE,0x50,
+	0x8A,0xE0,0x44,0xD7,0x52,0x74,0xD3,0xBA,0x50,0x3C,0x4A,
+	0x13,0xCC,0x33,0x99,0x06,0xFC,0x69,0x42,0x0B,0x54,0x3E,
+	0x71,0x94,0xA6,0x45,0x6D,0xF4,0x34,0x61,0xCC,0x75,0x12,
+	0x22,0x42,0x42,0x4F,0x4B,0xC7,0xAB,0xDB,0x4B,0xA8,0xC9,
+	0x41,0x35,0xA5,0xDB,0xB8,0x6C,0x61,0xDF,0x77,0x0E,0x2B,
+	0x15,0x78,0xD4,0x04,0x0F,0x87,0x64,0x69,0x93,0xC7,0xC4,
+	0x45,0x51,0x70,0x25,0x52,0x9B,0x02,0x86,0xF2,0xFE,0x5C,
+	0xD8,0xE3,0x4A,0xB5,0x1F,0xAA,0x52,0x12,0x1C,0x8B,0x9D,
+	0x4E,0x9A,0xDE,0xDC,0x2C,0x76,0x87,0xF4,0x0E,0x55,0x4F,
+	0x7C,0x7C,0x64,0xD8,0xFE,0xB5,0xA3,0x77,0x07,0x0B,0x0E,
+	0x92,0xD7,0xE3,0x24,0xD8,0x86,0x61,0x4B,0x0B,0x2B,0x9C,
+	0xAE,0xA6,0x6C,0x9B,0x6E,0x6E,0xC3,0xEB,0x8E,0x7C,0x12,
+	0xD2,0xF9,0xE0,0x2F,0xDC,0x95,0xFC,0xD6,0x9F,0xE4,0x83,
+	0x80,0x0A,0x44,0xBF,0x5F,0x9A,0x35,0xBF,0x94,0x2A,0xFD,
+	0xB1,0xB1,0x9D,0xC1,0x82,0xB8,0x18,0x47,0x94,0x16,0xBC,
+	0xE2,0x84,0xCA,0x47,0xB1,0x0B,0xA0,0x56,0x40,0x7E,0xE2,
+	0x09,0xFC,0x54,0x67,0xE8,0x3D,0xFE,0xD3,0xCA,0x7E,0x84,
+	0x98,0x50,0x13,0x54,0xA5,0x92,0xD4,0xD1,0xD5,0xB3,0x23,
+	0xF3,0x68,0x9E,0xDB,0xBF,0xE8,0xF6,0x7C,0x67,0xC3,0xFE,
+	0x24,0x13,0x11,0xE3,0x60,0x56,0x36,0xE6,0x5E,0x0D,0x1B,
+	0x7C,0x17,0xA6,0x15,0x63,0xF2,0xE0,0x02,0xE1,0x31,0x58,
+	0x0F,0x67,0x50,0x7F,0xF2,0x0E,0xBA,0x05,0xFD,0x6C,0xD7,
+	0x94,0xCE,0x73,0x37,0x71,0xE1,0x75,0x08,0xF2,0xF7,0xF6,
+	0x7E,0x97,0x1C,0x19,0xDF,0xE8,0xE8,0xF2,0x65,0x4F,0xE8,
+	0xC7,0x9E,0x64,0xC7,0xD0,0xEB,0x30,0xA4,0xB7,0xC3,0x05,
+	0x5F,0x11,0x16,0x51,0xD8,0x00,0x15,0xC1,0x01,0x5D,0x89,
+	0x26,0xF0,0x3D,0x87,0xF7,0x91,0x04,0xB0,0xA2,0x56,0x69,
+	0x80,0x07,0xF0,0x45,0x30,0xDA,0x9D,0x7B,0xFF,0x89,0x52,
+	0x1B,0x02,0xE1,0xA8,0xCA,0xAE,0xD8,0x0B,0x8C,0xF8,0xCB,
+	0xB1,0x6E,0x49,0x8C,0x4E,0xE1,0x4A,0x34,0x3F,0xD0,0xC8,
+	0x7F,0x04,0xEB,0x30,0xD2,0xF3,0x00,0x81,0x76,0x24,0x59,
+	0x4B,0xDC,0x38,0xDE,0x51,0xD6,0x8C,0x33,0x84,0xF5,0xCC,
+	0xAD,0x3A,0x8B,0x94,0xFA,0x3B,0x4F,0x25,0xFF,0x21,0x18,
+	0x1E,0xC6,0x71,0x04,0xE6,0xCE,0x17,0x5F,0x87,0xEF,0xE6,
+	0xBD,0x8C,0x5E,0xF8,0x20,0xBB,0xF5,0x15,0xFE,0x99,0xA1,
+	0xE4,0x7B,0xDC,0xE6,0x5F,0xF0,0x3B,0x6D,0x8A,0x32,0xA8,
+	0xF3,0xA2,0xC1,0x20,0xBA,0x32,0x18,0xC1,0x2C,0x51,0x0E,
+	0xBD,0xB3,0x84,0x64,0x4A,0x10,0x36,0x92,0x39,0x99,0x7C,
+	0x08,0x4D,0x15,0xA1,0x47,0x39,0x97,0x02,0xD1,0xE3,0x67,
+	0xD1,0x4B,0xCC,0xBD,0xDD,0xEF,0x03,0xDB,0x3C,0xCC,0xF5,
+	0xDD,0x1C,0xB5,0xF7,0x60,0xEB,0x31,0x14,0x2A,0xFD,0xB8,
+	0xF6,0xCC,0xAD,0xE8,0x9B,0x92,0x01,0xD2,0x86,0x6A,0x2F,
+	0x08,0x91,0x4E,0x17,0x7E,0xED,0x1F,0xAA,0x70,0x3E,0xBC,
+	0x6B,0x86,0x5A,0x44,0x4D,0xD7,0xC9,0xCF,0x24,0x89,0xAA,
+	0x8E,0xF0,0x1D,0x26,0x29,0xDA,0xCB,0xC8,0x6E,0x8A,0xCD,
+	0xC1,0x26,0x64,0x25,0xBE,0xCD,0xF1,0x87,0xBC,0x8C,0x15,
+	0x2F,0x4C,0xE3,0x0C,0x17,0x33,0xF8,0x3B,0x9C,0x0A,0xE4,
+	0x9D,0x0A,0x64,0x21,0xB9,0x14,0xEF,0xA4,0x63,0xBE,0x60,
+	0x77,0x2F,0xF2,0x82,0x4A,0x82,0xBE,0x1C,0xE5,0x15,0x80,
+	0x5D,0xBD,0x6C,0x44,0x36,0xEC,0x5F,0xD0,0x18,0x6B,0xF5,
+	0x13,0xCF,0xDB,0x34,0xC1,0x11,0x0E,0xE0,0x64,0xF6,0xE6,
+	0x6F,0xB2,0xEA,0xAB,0xBF,0x09,0xE5,0xAA,0x25,0x49,0x22,
+	0xA5,0xAA,0x1D,0x32,0xEF,0x36,0x2F,0x0A,0x4F,0x22,0xF5,
+	0x25,0xBE,0x30,0xD8,0x6B,0xC1,0x9F,0x54,0x3F,0x11,0xD4,
+	0x22,0x38,0x56,0x08,0xC4,0x77,0x3F,0x5E,0x0A,0x62,0x0D,
+	0xF5,0x60,0xB2,0x1C,0xD6,0x95,0x0D,0x62,0xBD,0xF2,0xB4,
+	0xB4,0xB6,0x52,0x41,0x6B,0x40,0x97,0xBE,0xA2,0x08,0xF5,
+	0x35,0x67,0x56,0xB5,0x32,0xFE,0x88,0xB9,0x2E,0x62,0x34,
+	0xD8,0x7C,0x86,0x88,0xFE,0xD8,0x71,0x95,0xFF,0x7A,0x02,
+	0x07,0xE8,0x3E,0x69,0xA4,0x38,0x77,0xA9,0xFD,0xCE,0x4D,
+	0x06,0xF2,0xB3,0x03,0x26,0xB1,0xD4,0xEA,0x0B,0x08,0x99,
+	0xE8,0x77,0xF7,0xA4,0x9A,0x54,0x6C,0x51,0x76,0xE2,0x98,
+	0x62,0x94,0xB8,0xD1,0x9B,0x42,0xCE,0x75,0xD4,0xD0,0x0B,
+	0xB1,0x5E,0xA4,0xE6,0x81,0xD6,0x8C,0x27,0xE8,0xAA,0x59,
+	0xCC,0x06,0xE4,0x74,0xFD,0x2E,0x97,0x5A,0xF4,0xBF,0xEA,
+	0xB7,0xF2,0xE7,0xC4,0x0F,0xF6,0x01,0xC4,0x8D,0x9E,0xBD,
+	0x80,0x9F,0x0C,0x72,0x5E,0xB7,0xCC,0xA3,0x96,0x77,0x60,
+	0xF8,0xC7,0xF1,0xCC,0x9F,0xE0,0xE3,0xA5,0x6A,0x29,0x0F,
+	0xD4,0x20,0x81,0xCB,0x97,0x77,0x5E,0x4D,0xA8,0xFD,0x3F,
+	0x8A,0xEB,0x3C,0x9E,0x09,0xC7,0xFF,0x03,0xF8,0xEE,0xCD,
+	0xCC,0xCC,0xDC,0xF7,0xDC,0xF7,0xDC,0x73,0xDF,0xCC,0x7D,
+	0xDF,0xF7,0xAD,0xC5,0x86,0x6C,0x73,0x44,0x4C,0xC8,0x59,
+	0xA1,0x28,0xE9,0x20,0xE9,0x10,0x85,0xDC,0x2A,0x57,0x09,
+	0xA5,0x44,0xC9,0x4D,0x94,0xA6,0xC9,0x87,0x0E,0x94,0x63,
+	0xBF,0xEF,0xEF,0xF1,0xFE,0xE3,0xFD,0xFF,0xFB,0x8F,0xF7,
+	0xEB,0xF9,0xFA,0x53,0x9E,0x7C,0xFC,0x4D,0x93,0xB9,0x29,
+	0x13,0x74,0x93,0xCF,0x41,0x60,0x56,0x82,0xFB,0xDE,0xB4,
+	0x9D,0x1D,0x9C,0x8B,0xE7,0xE6,0xE6,0xA5,0xDD,0x45,0x75,
+	0x16,0xF7,0x55,0x14,0xFF,0x39,0xFC,0xDF,0x46,0x99,0x83,
+	0x20,0x21,0xC4,0xA9,0x29,0x15,0xF3,0xE7,0x52,0x5B,0xEC,
+	0x14,0xA1,0x79,0x90,0x80,0x0A,0x4C,0x56,0x5A,0x68,0xDC,
+	0xE3,0x86,0xE2,0x9D,0x2D,0xF3,0xA6,0x3C,0x8D,0xB2,0xF4,
+	0x3D,0x25,0xAD,0x58,0x6C,0xBC,0xCB,0x89,0x9D,0x27,0x34,
+	0x2D,0xAD,0xE9,0x06,0x81,0x21,0xDE,0x77,0x51,0x6E,0xC9,
+	0x15,0xE6,0x8C,0x31,0x0D,0x59,0xA6,0x4D,0xA3,0x39,0xB4,
+	0x51,0x0B,0x3E,0x14,0x1D,0x0C,0x32,0xB7,0x89,0xE7,0x66,
+	0x49,0x8F,0xC9,0x5C,0xEE,0x92,0x2D,0xA8,0x1B,0x41,0x5B,
+	0xDA,0x7E,0xDE,0x3A,0xFA,0x8E,0x10,0xDB,0xD4,0xBA,0x70,
+	0x9B,0xEE,0x60,0x2C,0x59,0x77,0xF9,0x79,0x28,0x76,0xBB,
+	0xF6,0xC2,0x76,0xE6,0xA6,0xB5,0x22,0x90,0x11,0xB6,0x96,
+	0xF3,0xE7,0x4E,0xD5,0xD4,0xD5,0xF3,0x1B,0xF3,0xD2,0x83,
+	0xAB,0x5F,0x6E,0xFD,0xB8,0xAE,0xA4,0x7D,0x81,0xA8,0x4D,
+	0x6E,0xFF,0xFD,0x37,0x4A,0x5B,0x0C,0x4B,0x67,0x1C,0x66,
+	0x69,0x33,0x39,0xA4,0xE7,0x7A,0xB1,0xAF,0x60,0x69,0xBF,
+	0x49,0x9C,0xAE,0x09,0x67,0xB5,0x75,0x6B,0x9E,0x89,0xB3,
+	0xA4,0xFC,0xFD,0xE1,0xBC,0x91,0x65,0xB7,0x1F,0x80,0xBE,
+	0xDC,0x86,0x35,0xFE,0x12,0x46,0x65,0x7B,0x54,0x24,0x1D,
+	0x93,0x4A,0x63,0x6E,0xAD,0x2C,0xE6,0x3C,0xE5,0x6B,0x70,
+	0x11,0x58,0xCC,0x9B,0x37,0x40,0x72,0x66,0x08,0x01,0x41,
+	0xD4,0xDE,0x34,0xD0,0x3B,0xA0,0xED,0x5C,0x24,0xE8,0x9B,
+	0xB8,0x46,0xB2,0xD1,0xF0,0xE6,0x29,0x71,0xF3,0xBE,0x5C,
+	0x6D,0x6F,0x2A,0x89,0x66,0xB4,0xFC,0x57,0x9B,0xCB,0xFC,
+	0xE3,0xE3,0x5F,0x1F,0xFE,0xF1,0x72,0x31,0xFD,0x9B,0xCF,
+	0x2E,0xAF,0xD1,0x5D,0x49,0x1A,0x2D,0x3A,0xB2,0xB7,0x14,
+	0x48,0xE4,0x13,0x28,0x82,0xD1,0x6B,0x69,0xEA,0x95,0xDA,
+	0x5C,0x0F,0x2E,0x63,0xB6,0x75,0x60,0xC6,0x75,0xB2,0x05,
+	0xCF,0xEC,0x0C,0xF5,0xDC,0x29,0xE0,0x11,0x2F,0xBB,0x0D,
+	0x0B,0xEC,0x00,0x63,0x2E,0x1C,0x0D,0xEA,0x30,0xBB,0x71,
+	0xF3,0x72,0x2C,0x2E,0x2C,0x97,0xA3,0xEE,0xAF,0xE0,0xBA,
+	0xE1,0x78,0xC1,0xF7,0x8A,0xF3,0x30,0xA6,0x5D,0x0C,0xB6,
+	0xF4,0xE2,0x05,0x9E,0x52,0x04,0x1D,0xAB,0x1B,0xF7,0x8E,
+	0x28,0xCA,0x89,0xD1,0x88,0xB3,0xB5,0xFE,0x21,0xC0,0xDF,
+	0x5E,0x62,0x7D,0xCE,0x6F,0x40,0x78,0x72,0xE9,0x94,0x8D,
+	0xCE,0xFE,0x6E,0xA2,0x24,0x8E,0x69,0x84,0x3B,0xCE,0xD7,
+	0x8D,0xE5,0xAB,0x56,0x50,0xA4,0xCA,0xF9,0x5D,0x1A,0x88,
+	0x71,0xBC,0x01,0x2E,0x82,0x67,0x2A,0xF0,0xC5,0x12,0x93,
+	0x65,0xBC,0xEA,0x15,0x46,0xC2,0x6A,0x5E,0x1F,0x1E,0x2B,
+	0xF0,0x72,0x58,0x8D,0x72,0x1C,0x6F,0x74,0x1F,0x6F,0x74,
+	0x1C,0xBF,0xC5,0x06,0x16,0x53,0x27,0xB5,0xB4,0x0F,0x9F,
+	0xA3,0xB3,0xCA,0xB4,0xCA,0x0E,0x2D,0xDA,0x5A,0xF8,0x67,
+	0xB5,0x12,0x92,0x90,0x5F,0xF8,0x93,0x36,0x6F,0x79,0xC0,
+	0xF2,0x19,0xBE,0xC0,0x0C,0x13,0x97,0x0D,0x69,0xF5,0x71,
+	0x2E,0xBC,0xF2,0xD3,0xB1,0x70,0x6F,0x96,0x9E,0x7B,0xE4,
+	0x7C,0xAA,0x70,0x66,0xDA,0xA5,0xA3,0x0C,0x83,0xA4,0x53,
+	0xF9,0x47,0xFB,0xA3,0xDF,0xFD,0x37,0x5D,0xEF,0xE9,0xCE,
+	0xE6,0xED,0x6C,0x0F,0x21,0xC9,0x36,0xBA,0xB6,0x7C,0xEB,
+	0x07,0xA7,0xDE,0x61,0x08,0x5B,0x25,0xA7,0x6C,0xEB,0x46,
+	0x5D,0x6F,0x89,0x38,0x09,0xF1,0xC9,0x0F,0x96,0x22,0xAF,
+	0xA4,0x9E,0xF8,0xBE,0xB1,0xA8,0x4E,0x08,0x44,0x45,0xA6,
+	0xE2,0x0F,0xB9,0x49,0xCE,0x84,0x58,0xEC,0x64,0xAB,0x99,
+	0x0F,0x81,0x79,0x59,0x9E,0xF3,0x63,0x69,0x23,0xE1,0x28,
+	0xD1,0xE3,0x54,0xD8,0xB8,0x18,0x80,0xF1,0x8B,0x37,0x56,
+	0x27,0x66,0xF4,0x26,0xF0,0x2D,0x46,0xC9,0xB3,0xF9,0x74,
+	0x46,0x69,0x0E,0xBB,0x4E,0xE9,0x19,0xAD,0xB4,0x38,0xD7,
+	0xE7,0xE1,0xFB,0x69,0xFC,0xA6,0xCA,0x20,0x20,0xC4,0xBC,
+	0x6A,0xEF,0x40,0xB1,0xF3,0xCF,0xAC,0x3F,0xCC,0x84,0x82,
+	0xDC,0x5A,0x1E,0xF1,0xBF,0x54,0xE6,0x73,0x6B,0x20,0x75,
+	0xDB,0xEC,0x1A,0x9A,0xD4,0xB1,0xCC,0xE6,0x3F,0x9D,0x78,
+	0x6B,0xE8,0x98,0x20,0xF3,0xB2,0x3C,0xF1,0x82,0xE5,0xF6,
+	0x39,0xF7,0x52,0x87,0xC7,0x3C,0x1C,0x88,0x90,0xCF,0xCC,
+	0x33,0x32,0x7A,0xD3,0x4F,0xC1,0x34,0x33,0x0B,0x0E,0x52,
+	0xB0,0x5E,0xE4,0xEF,0x07,0x91,0xB4,0x98,0x1D,0x3D,0x66,
+	0xB1,0x5C,0xF7,0x52,0x95,0x9E,0xA8,0x3D,0xEF,0x3E,0x33,
+	0xA6,0x51,0x61,0x40,0x68,0x3D,0x11,0x35,0x41,0x53,0x7B,
+	0xB2,0xA6,0x18,0x2A,0x0F,0xE3,0x80,0x72,0x3A,0xE5,0xD2,
+	0x61,0x00,0x88,0x96,0x48,0x05,0x53,0x45,0x9F,0xD3,0x47,
+	0xE0,0x0D,0xE1,0x98,0x8B,0x34,0xAF,0x57,0x1F,0xC8,0x61,
+	0xED,0x1A,0x10,0x6B,0x65,0xD9,0xD8,0x13,0x6E,0x23,0x6A,
+	0x9D,0x7B,0x43,0x5E,0x15,0xDD,0xBB,0x16,0x75,0x23,0x96,
+	0xFE,0xC8,0x61,0xFA,0x3A,0xC4,0x3A,0x13,0x07,0x26,0x86,
+	0x32,0xFA,0x26,0xC3,0x28,0xC9,0x8A,0xB9,0xBC,0x5F,0x8B,
+	0xF2,0x99,0x57,0x8D,0x5E,0xC9,0x37,0xDE,0xFF,0x37,0x3D,
+	0xEC,0x70,0x9F,0xFB,0x5D,0x92,0xD1,0xE5,0xBB,0xE6,0x17,
+	0xEF,0x89,0x64,0xF6,0xBA,0x0B,0x63,0x56,0x8C,0xD8,0x6A,
+	0xCC,0x35,0xD2,0xA2,0x5E,0x92,0x18,0x39,0x41,0xEE,0xAB,
+	0xA8,0x5C,0x3C,0xA1,0x66,0x74,0xED,0xFA,0x3C,0xFB,0xA6,
+	0xDD,0x89,0xAB,0x16,0xAE,0xC0,0xD8,0xA1,0x09,0x7F,0xB7,
+	0x13,0xA5,0xDF,0xC6,0x31,0xFA,0xAD,0xB7,0xB6,0xB6,0xE1,
+	0x1C,0x0F,0x79,0x2B,0x63,0x9C,0xB4,0x9A,0x3E,0x3C,0x4A,
+	0xB7,0x29,0x73,0x58,0x76,0xD0,0xAF,0xD8,0x92,0xBC,0x75,
+	0xE1,0x27,0x8A,0x14,0xA9,0xAF,0x8F,0x4D,0xC8,0xAA,0x24,
+	0xEB,0x33,0x7F,0x5F,0x91,0xA9,0xD5,0x47,0x34,0x6C,0xB6,
+	0xC6,0x77,0x37,0xF9,0xA9,0xB6,0x3C,0xB3,0x25,0x96,0xDC,
+	0xDA,0x54,0x22,0x93,0xB7,0xDB,0x76,0xFC,0xEC,0xBA,0xD3,
+	0x7E,0x4E,0xEF,0x2D,0xAC,0x53,0xDE,0x4D,0x1E,0xDF,0xFC,
+	0x81,0x0B,0x62,0xE9,0x47,0xA6,0xD1,0x6E,0xC5,0x43,0x0D,
+	0x64,0x1C,0xCB,0xE3,0x2F,0x8E,0x54,0x6B,0xD5,0x29,0xC8,
+	0x4D,0x06,0x32,0x0C,0x94,0x0D,0xEE,0xDC,0xCE,0x7C,0xC1,
+	0x49,0xB2,0x35,0x78,0xD5,0x6E,0x17,0x9F,0x35,0xEA,0x66,
+	0xC0,0xAC,0x56,0x2E,0x34,0x18,0x8F,0xE5,0x63,0x96,0x53,
+	0x2E,0xF0,0xD9,0x86,0x56,0xCB,0xDD,0x3E,0x47,0xAE,0x01,
+	0xA8,0x35,0x7D,0x26,0xF5,0x18,0xBC,0x12,0xBB,0x43,0x61,
+	0x04,0x8B,0x5E,0xB5,0xBA,0x99,0xE1,0xAE,0x11,0xE6,0xD3,
+	0xB5,0xB7,0xF2,0xD1,0xBF,0xFD,0xC4,0xD8,0xD7,0x5B,0x3F,
+	0x36,0x37,0x8D,0xD1,0x5D,0x48,0x43,0x5B,0x9E,0x08,0x8A,
+	0x7D,0xA6,0xED,0x50,0xE9,0xB5,0x2F,0x58,0x9E,0xAE,0xB6,
+	0x3E,0x30,0xA8,0x3B,0x46,0x9A,0x70,0x85,0xF3,0x01,0xA9,
+	0x43,0xD1,0x11,0xC4,0xE9,0x4E,0xFD,0x47,0x4E,0x67,0x63,
+	0x33,0xF9,0x25,0x6F,0x28,0xA8,0x61,0x1E,0x9B,0x0B,0x7F,
+	0x53,0x61,0xAE,0x88,0xF4,0x01,0xC2,0x37,0x5B,0x6A,0xFF,
+	0x61,0x1D,0xED,0x24,0xE3,0x99,0x44,0x6C,0x15,0xDB,0xDF,
+	0x87,0x14,0x6F,0xC8,0x1C,0xE8,0x10,0x46,0xF8,0x22,0x7B,
+	0x5F,0x21,0x01,0x98,0x47,0x49,0xFC,0x00,0xFF,0xEC,0xD3,
+	0x84,0xA8,0x87,0xE5,0xE9,0x51,0xCC,0x70,0xFE,0x5C,0xCF,
+	0xAA,0x66,0x11,0x0B,0xCE,0xA1,0x5D,0xE8,0x8E,0x41,0xA0,
+	0xC5,0xD3,0xDA,0x3E,0xD3,0x28,0xD1,0x6B,0xDE,0xE1,0xC2,
+	0xDC,0xDC,0x34,0x23,0x29,0x6E,0x00,0x4D,0x0A,0xC7,0x5D,
+	0x9C,0x9F,0x70,0x14,0x55,0x7C,0x85,0x12,0x05,0xE4,0xEC,
+	0xE5,0x89,0x6D,0x28,0x60,0xAB,0xEF,0x82,0x33,0x0B,0xC2,
+	0x33,0x42,0x1C,0xA2,0x2B,0xBA,0xB3,0xED,0xD2,0xD2,0xA3,
+	0x93,0xD2,0xA2,0xE1,0x02,0x43,0x99,0x4F,0x8D,0x9F,0xD9,
+	0x29,0x1C,0xEC,0x9B,0xEA,0xC5,0x23,0xB7,0xDE,0xBF,0x01,
+	0xD8,0x62,0xAC,0xBA,0x4F,0x19,0x5F,0x8F,0xDB,0xD4,0xC8,
+	0xB7,0xCA,0x68,0xE5,0xC5,0x9A,0x06,0x64,0xC2,0x9F,0xBC,
+	0x38,0xA7,0xE0,0xB8,0x7E,0x08,0x85,0xBD,0xFD,0xF2,0xFD,
+	0xB5,0xFC,0x58,0x51,0xFE,0x03,0xD1,0xF0,0xCB,0x49,0xA7,
+	0x32,0x71,0x71,0x38,0x79,0x61,0xC4,0xDD,0x67,0x91,0x28,
+	0xA4,0x4E,0xF3,0x6B,0x9F,0x5E,0xC8,0x19,0xF1,0x29,0xFC,
+	0xBE,0x15,0xE7,0xC5,0x04,0x8D,0x60,0x31,0x96,0x68,0xB6,
+	0x98,0xC6,0xBD,0xC9,0xC6,0xFA,0xC5,0x36,0x4B,0xB6,0x97,
+	0xE4,0x1B,0x51,0xAB,0x7B,0xE1,0x58,0xF6,0x5B,0x59,0xD5,
+	0x40,0xC2,0xC0,0x5B,0x6B,0xC7,0xEB,0x49,0xE3,0x3A,0x29,
+	0xC9,0x0F,0xD4,0x8C,0x73,0xFE,0x2D,0x62,0x1F,0xE9,0x1A,
+	0xA9,0xC8,0x74,0xA8,0xC8,0x8A,0x4E,0xE0,0x2D,0x0D,0x96,
+	0x42,0xC4,0x09,0x16,0x9C,0x0B,0x28,0x3A,0xCA,0xFD,0x12,
+	0x90,0x55,0x22,0xA3,0x5A,0x6F,0x2E,0x23,0xCF,0x7C,0xC9,
+	0x26,0x95,0x2C,0xFD,0xEF,0xB3,0x37,0x47,0xC6,0x88,0x2D,
+	0xBE,0xDF,0xA8,0x4E,0x4E,0xE1,0xD9,0x22,0x5D,0xE5,0x84,
+	0xA5,0x14,0x49,0xF6,0x5C,0x23,0x82,0x4B,0x20,0xFC,0x7D,
+	0x45,0x7A,0x47,0xA4,0x9B,0x86,0x76,0x43,0xEB,0xB2,0xB1,
+	0x00,0xE2,0x4B,0x87,0x0F,0xB0,0xE8,0x2B,0x0D,0x77,0x7A,
+	0x14,0x24,0xEE,0x7A,0xF0,0x8A,0x77,0x75,0xB9,0xCB,0x49,
+	0x3E,0x6E,0xF4,0x5E,0xAE,0x64,0xD3,0x41,0x6C,0xDD,0x79,
+	0xD2,0x4C,0x34,0x8F,0x11,0x57,0x30,0x08,0x32,0x4F,0xFA,
+	0x85,0x06,0x29,0x20,0xD5,0x11,0xA4,0x43,0xFC,0x2F,0x89,
+	0x3E,0x33,0x98,0x11,0x76,0x7C,0x46,0xC2,0xC0,0x04,0x4E,
+	0x32,0x6D,0xE5,0x5A,0xF8,0x41,0x72,0x87,0x55,0x7C,0xAC,
+	0x49,0x93,0x09,0x03,0x4A,0x28,0xDF,0x9F,0xDB,0x1C,0x56,
+	0xFD,0xFA,0x94,0xF8,0xDF,0x84,0x48,0xB8,0x49,0x8E,0xE1,
+	0x5D,0x06,0xE5,0x82,0x67,0x97,0x69,0xA5,0x04,0xD4,0x9B,
+	0xEC,0xEA,0xDF,0x55,0x22,0x11,0x17,0x68,0xCE,0x17,0x1D,
+	0x3C,0x93,0x2D,0x51,0x97,0x2C,0x60,0x0B,0x27,0x75,0x44,
+	0xA8,0xC7,0xB8,0x9C,0xF0,0x0F,0x9A,0x4D,0xD6,0x94,0x68,
+	0x58,0x0B,0x9A,0x25,0x1B,0x4D,0xD3,0xAE,0x8D,0x5B,0x64,
+	0x90,0xA5,0x0C,0x2B,0x59,0xA6,0xEE,0xA0,0x0C,0x57,0x66,
+	0x0F,0x53,0x7F,0x00,0x31,0xF4,0xE1,0x2C,0x8E,0xD3,0x83,
+	0x9B,0x94,0x4D,0x0E,0x44,0xF6,0x23,0x5F,0x2E,0x94,0x11,
+	0x98,0x5E,0x27,0x66,0xE1,0x08,0x1D,0xF9,0x34,0xA8,0x6D,
+	0x3C,0x7E,0x5E,0x1C,0x60,0x75,0xC8,0xD0,0xB8,0x53,0xA2,
+	0x4E,0x2A,0x27,0x4B,0x3C,0xDD,0x14,0x84,0x99,0x84,0x18,
+	0x91,0xAE,0x05,0xDD,0x11,0x37,0x76,0xB9,0xD3,0x55,0x2D,
+	0x8E,0xB4,0x50,0xEB,0xEF,0x3B,0x06,0x9C,0xB3,0xAE,0x7E,
+	0xDC,0xE0,0xCE,0xD7,0x88,0xC2,0x70,0x37,0xBA,0x73,0x7B,
+	0x72,0x82,0x14,0x17,0xEF,0xB2,0xC5,0xC9,0x73,0x6F,0x7A,
+	0x42,0xC5,0x6F,0xAF,0x5C,0x06,0xE0,0xCA,0x44,0x95,0x1B,
+	0x3F,0x09,0xB7,0xA2,0xD9,0x9D,0x21,0xCC,0xBE,0x1F,0x12,
+	0xE7,0x74,0x1D,0xA2,0xFF,0x0C,0x71,0x8B,0x0B,0x16,0xBE,
+	0xCC,0xF5,0x58,0xE3,0x25,0xE5,0x1D,0x9C,0x1A,0xF9,0x2D,
+	0xF6,0x19,0x68,0xCC,0x0E,0xE4,0x20,0x75,0xF2,0xC0,0xD6,
+	0xC4,0xA2,0x95,0x9F,0xCF,0xB6,0x34,0x2C,0x2D,0xB5,0x04,
+	0x02,0x09,0xEC,0x6F,0x83,0x56,0xE6,0xC4,0xEC,0x15,0x55,
+	0x60,0x81,0xD5,0xCB,0xFF,0x99,0x50,0xBF,0x21,0xC5,0x9E,
+	0xDD,0x2E,0x90,0xA0,0xD6,0xCE,0x07,0x0C,0xB7,0xA0,0xFA,
+	0x3B,0xFA,0xFE,0xC8,0x8D,0x8E,0xB9,0x20,0xBA,0xA0,0x4B,
+	0x13,0x33,0x53,0x97,0x31,0x66,0xBE,0x8B,0x13,0x13,0xD5,
+	0x78,0x7F,0x7D,0x75,0x37,0xE7,0xAD,0xAA,0x3C,0xA7,0x54,
+	0xBA,0x6C,0xFC,0x2F,0xE5,0x3A,0x8C,0x07,0xF0,0x4A,0xBA,
+	0x9C,0x31,0xDC,0xF5,0x21,0x3B,0x26,0x66,0xA9,0x0F,0x62,
+	0xA7,0x54,0xF5,0x88,0xDF,0xFB,0x86,0x92,0x48,0xD3,0xB1,
+	0xA4,0x12,0xB3,0x2B,0xF1,0x52,0xFC,0x27,0xA9,0x74,0x25,
+	0xA0,0xB0,0x0C,0x22,0xFE,0x9B,0xDB,0x66,0xA9,0x9B,0x70,
+	0xB6,0x04,0xDD,0xD8,0x87,0x3B,0xB8,0x3B,0xDB,0x43,0x2D,
+	0x34,0xF5,0x01,0xEA,0x6F,0x29,0x56,0x65,0x29,0x29,0x1C,
+	0xD9,0xCF,0x1D,0xBE,0x9F,0x83,0x3E,0xFD,0x47,0xFA,0x89,
+	0x18,0x24,0x55,0x33,0x86,0x25,0xC5,0x6B,0xD5,0x2A,0xEE,
+	0x53,0x95,0x65,0xA0,0x3C,0xA3,0x31,0xCE,0x93,0x73,0xEE,
+	0xEB,0xA5,0x68,0xAF,0xB1,0x90,0x95,0xEA,0xA9,0xC7,0x9D,
+	0xFE,0x8F,0x44,0xED,0xFC,0x5B,0xF3,0xC1,0x4F,0xCE,0xA6,
+	0x5E,0x13,0xEE,0x12,0xAF,0x1A,0x97,0xD6,0xE7,0x7A,0xDE,
+	0xA9,0xAD,0x27,0xF7,0xD9,0xED,0xF9,0xDD,0xCE,0xB7,0xF8,
+	0xA8,0x82,0x67,0xE7,0xBC,0x15,0x88,0x79,0x27,0x2C,0x64,
+	0x74,0x92,0x67,0x90,0x44,0x7D,0x0B,0xD3,0xFE,0x6B,0xC7,
+	0x35,0xD7,0x9E,0x18,0xE7,0x7C,0x1F,0xA8,0x65,0x2C,0xFF,
+	0xA8,0x47,0x15,0xF0,0x04,0xE5,0xB9,0x45,0x67,0x27,0x0A,
+	0xE7,0x2F,0x17,0x27,0xF7,0x1B,0x7F,0x0F,0x35,0xFC,0xCE,
+	0x04,0x6A,0xF0,0x33,0x2B,0x84,0xD6,0x48,0xAF,0x55,0x53,
+	0xD0,0x58,0xEF,0xF9,0x77,0x08,0xDD,0x61,0x11,0x7F,0xD5,
+	0x80,0xD2,0xCA,0x1E,0x2D,0x01,0xF6,0x62,0x6D,0x97,0x46,
+	0xB0,0xCF,0xCE,0x4D,0x63,0x41,0x60,0x6E,0x4B,0xC8,0x97,
+	0xCC,0xF3,0xD7,0x8F,0xDE,0x8A,0xCB,0xA9,0xE6,0x17,0xBE,
+	0x31,0x2A,0x97,0xEE,0xBC,0x44,0xB2,0xAE,0x33,0x31,0x10,
+	0x2F,0x89,0xFA,0x67,0xF4,0xA0,0x06,0x40,0x2F,0x93,0x7A,
+	0x0A,0x8F,0x2D,0x55,0xFE,0x79,0xCE,0xC4,0x0A,0x26,0x63,
+	0xAD,0x83,0xBD,0xF0,0xAA,0x2C,0xA7,0x44,0x47,0xC6,0xD5,
+	0xF4,0x41,0xDF,0x23,0x35,0xE7,0x87,0xDD,0xC6,0xB2,0x51,
+	0x38,0x5C,0xA1,0x76,0x2D,0xA6,0x43,0x90,0xA0,0xF4,0x40,
+	0xAC,0x4F,0xC2,0x65,0xA2,0xFE,0x4E,0xC3,0xCB,0x8B,0x89,
+	0xE6,0xC2,0xB8,0x87,0x5C,0x7C,0xC0,0x4A,0x55,0xC1,0x87,
+	0xC6,0xEC,0x48,0x49,0x9E,0x13,0xB1,0x48,0xAE,0x69,0xE6,
+	0x91,0x22,0xCC,0x7F,0xA3,0xFF,0xD8,0x8B,0x81,0x4B,0xDC,
+	0x9F,0xC1,0xFC,0x9E,0x37,0xF7,0x4E,0x2A,0x30,0xD1,0xBF,
+	0x6B,0x42,0x16,0x46,0xAC,0xED,0x2B,0x03,0x39,0x4E,0x4E,
+	0xE9,0x5B,0x3E,0xD4,0xFE,0xFC,0xDA,0x64,0x4F,0xCC,0x2F,
+	0x12,0xB3,0x9D,0x6F,0x7A,0xC1,0xDC,0x31,0x12,0xE2,0x77,
+	0xD3,0x85,0x64,0x33,0xCF,0xCB,0x8B,0xBB,0xA3,0x97,0x79,
+	0xD6,0x94,0xC4,0x30,0x55,0xF9,0xA2,0xC2,0xC1,0xC7,0x6C,
+	0x2D,0x7D,0x49,0xE2,0x8B,0x09,0x45,0xF2,0xAB,0x7F,0xE7,
+	0x38,0xDF,0xD7,0xA2,0xC6,0xC1,0x74,0xDB,0xB8,0x2B,0x2E,
+	0x93,0x67,0xAA,0x45,0x25,0xF1,0x3C,0xEC,0xCC,0x1E,0x7E,
+	0x7D,0x14,0x91,0x03,0xDA,0x59,0xF3,0xFD,0xAC,0x39,0x79,
+	0x56,0x16,0x9B,0xC3,0xAD,0x51,0xAA,0x47,0x24,0xE5,0x9E,
+	0x18,0x39,0x5B,0x13,0x61,0x79,0xA3,0x42,0x3E,0xFA,0x5D,
+	0xDA,0xDF,0x8B,0x3E,0xEA,0xA0,0x8A,0xA7,0x78,0x2C,0xDC,
+	0x9F,0xD3,0xD7,0xC6,0xA3,0x55,0xA0,0x88,0xF4,0x60,0xBF,
+	0x24,0x09,0xBC,0x6B,0x7A,0x93,0x34,0x9C,0x38,0x0E,0xE3,
+	0xD1,0x2F,0xDD,0x3C,0xFE,0x6C,0xCA,0x44,0x70,0xC7,0x66,
+	0xE4,0x05,0x7D,0x15,0xCC,0xC9,0xE0,0x1C,0x7A,0xEA,0xD6,
+	0x1F,0xD4,0x29,0xD6,0x07,0xE0,0xCE,0x32,0x6B,0x01,0x7F,
+	0xA0,0x6D,0xB5,0xA9,0xD5,0x7E,0x79,0x62,0x89,0x88,0x79,
+	0x1B,0x1E,0x1F,0xB7,0x71,0x45,0x51,0x03,0x7F,0x45,0xCD,
+	0x3F,0x97,0x47,0xDA,0xFF,0x43,0x22,0xFD,0xD4,0xB7,0x9F,
+	0x4B,0xD2,0x9E,0xF2,0xF7,0xCC,0x7E,0x56,0x70,0x08,0x68,
+	0xB0,0xB2,0xC3,0x09,0xBB,0xAF,0xCC,0xF9,0x47,0x95,0x8D,
+	0x11,0xCC,0xFC,0xEA,0x60,0x59,0xE7,0x5E,0xEC,0x2C,0x49,
+	0x0D,0xA7,0x83,0x7D,0x5C,0x99,0x23,0x9E,0xA3,0xDE,0x6C,
+	0x76,0xEA,0x3A,0x7B,0x7D,0x0F,0x2E,0x94,0xAE,0x67,0xC6,
+	0x32,0xBB,0x09,0x5E,0x86,0xD2,0xF9,0xCD,0x54,0x95,0xDC,
+	0xA4,0x44,0xB4,0x44,0x00,0x17,0x17,0x3F,0xD9,0x9A,0xD5,
+	0x6A,0x24,0x1E,0x0A,0x32,0x67,0xC3,0x06,0x55,0xF1,0x68,
+	0x69,0x68,0x4A,0xAB,0x6B,0x59,0x9C,0x14,0xFB,0x44,0x58,
+	0x18,0x7A,0x5F,0x8D,0xA9,0xBA,0x22,0x6E,0x58,0x7E,0x4D,
+	0x4D,0xA6,0x32,0x31,0xB4,0x9F,0x77,0xBF,0xD8,0x1C,0x87,
+	0xB5,0xDD,0xF4,0xB2,0xBB,0x49,0x60,0x26,0x64,0xB2,0x69,
+	0xFF,0x4F,0x41,0x73,0x99,0x85,0xFF,0x42,0x44,0x8A,0xD5,
+	0xF9,0x84,0xA3,0x67,0x7D,0xF5,0x8D,0x2D,0x98,0x84,0xD1,
+	0x8C,0x00,0x74,0xD1,0xBB,0xDD,0xF0,0xE3,0xC1,0x8D,0x0B,
+	0x4F,0xBE,0x04,0x9B,0x25,0x89,0x84,0x25,0x45,0x7B,0x7A,
+	0x48,0xA5,0x3D,0xFB,0x0A,0xFA,0x52,0x0F,0x1F,0x0F,0x95,
+	0x1A,0x79,0xC0,0x35,0x55,0xCD,0xEF,0xA8,0x4E,0x6A,0xE4,
+	0x78,0x6F,0x8A,0x64,0x56,0x85,0x9A,0x8B,0x36,0xE3,0x14,
+	0x78,0x99,0xD7,0x52,0x61,0x18,0xB3,0x43,0x21,0xE6,0xE6,
+	0x52,0xC5,0x17,0xC9,0xE5,0x3C,0x8E,0x6B,0x1A,0xAD,0x8C,
+	0x82,0xCF,0xEA,0xA1,0x66,0xC8,0xA4,0xC7,0xC1,0xB6,0x9D,
+	0xB2,0x7F,0xB5,0x99,0xBB,0x21,0x57,0xB5,0x90,0x02,0x77,
+	0x13,0x03,0x9F,0xE1,0xE4,0xC4,0x46,0x46,0x70,0x6E,0xAD,
+	0x8F,0x13,0x07,0x07,0xB2,0x5D,0x6D,0x98,0x6D,0xA5,0x21,
+	0x57,0x2F,0x99,0x0E,0xBD,0x14,0x60,0xF0,0xE7,0xE4,0xDD,
+	0x0D,0xE9,0x98,0x47,0xA1,0x8B,0xED,0x93,0x4A,0x42,0x78,
+	0x5A,0x3A,0x99,0x4C,0xFB,0xA5,0x67,0xF6,0x17,0x51,0xA4,
+	0x6D,0xB3,0xFF,0x98,0x11,0x9C,0x26,0x9D,0xBF,0x11,0x85,
+	0xBC,0x67,0xFD,0x47,0x6F,0xBA,0x3F,0x49,0x64,0x40,0x85,
+	0x8A,0x7F,0xEF,0x76,0xC1,0x33,0xFF,0x43,0x62,0xF6,0x27,
+	0x7C,0x9B,0x1A,0x79,0x53,0x39,0x77,0x69,0x2A,0xD1,0x99,
+	0xE6,0x34,0x54,0xF6,0xF1,0xA2,0x0A,0x0D,0xD6,0x0C,0xED,
+	0xF7,0xAA,0x69,0xBB,0xE2,0x9B,0x34,0x4D,0x10,0x30,0xEF,
+	0x0D,0xBC,0xBC,0x28,0x30,0x1B,0xD1,0x78,0xBC,0xC1,0xA7,
+	0x14,0x8C,0xCA,0x51,0xE7,0xF3,0x21,0xF5,0xAB,0x98,0x67,
+	0xAC,0xFF,0x2F,0x4A,0x8A,0x87,0xB1,0x09,0xBF,0x35,0xCC,
+	0xDB,0x62,0xB1,0xCE,0x6A,0x66,0x19,0xC1,0x59,0x3F,0xFB,
+	0xB4,0xD8,0xBB,0x92,0x24,0x6D,0xEF,0x45,0xC1,0x88,0xBB,
+	0xCF,0x83,0xDB,0x0C,0x17,0x94,0xEF,0x20,0x31,0x4D,0x1C,
+	0xB0,0x81,0x71,0xAC,0xC4,0x6F,0x9C,0xFA,0x88,0x64,0x5A,
+	0xA4,0x65,0x5D,0x12,0xCC,0xEE,0x0E,0x36,0xFF,0xED,0x47,
+	0x82,0xAB,0x39,0x5A,0xF0,0xDD,0xF6,0x42,0x4A,0x6D,0x15,
+	0x57,0x9C,0xF9,0x70,0x35,0x87,0x43,0x63,0xF0,0x30,0xEC,
+	0xD2,0x6C,0x84,0x45,0x60,0x64,0x65,0x89,0x39,0x2B,0x01,
+	0x2F,0xEA,0x15,0x65,0xB0,0xCB,0x6E,0x56,0x5D,0x5B,0x5B,
+	0x5F,0x9D,0x5E,0xC5,0x69,0xDD,0x88,0x84,0xCC,0x3E,0xC9,
+	0x9F,0x9E,0x5F,0xD2,0xE5,0x10,0xFF,0xC0,0x97,0xBE,0xA6,
+	0xDB,0x64,0xCE,0x73,0x7D,0x35,0x7E,0x62,0x3D,0x28,0xD9,
+	0x96,0x97,0xF4,0xF4,0xAB,0x08,0x65,0xFC,0xF5,0x96,0x08,
+	0x87,0xE8,0x3D,0xEB,0xCD,0x05,0x7F,0x7F,0x19,0x2E,0x2E,
+	0x83,0x66,0x5D,0x5A,0xAE,0x00,0x43,0xFE,0x25,0x87,0x71,
+	0xCA,0x86,0xD5,0xF9,0x7B,0x6F,0xF3,0x83,0x72,0xDE,0x11,
+	0x2C,0x01,0x4C,0x50,0xA0,0x9D,0xCA,0x7F,0x5B,0xFA,0xA2,
+	0xF7,0x5C,0x6E,0x04,0x31,0x34,0xC6,0x4D,0x8C,0xC8,0xD5,
+	0xBF,0xD7,0xEA,0xC9,0xEA,0x12,0x17,0xEC,0x4F,0xDA,0x9E,
+	0xD8,0xFF,0x66,0xC3,0xC4,0xCC,0x93,0x0E,0x51,0x28,0xF1,
+	0x0A,0xF0,0xAD,0x20,0x61,0x0B,0x19,0x6C,0x24,0x4A,0x2C,
+	0xD0,0x4E,0x36,0x8F,0xC7,0xB1,0x43,0x87,0x97,0x9B,0x7C,
+	0x1C,0xF8,0x53,0x6F,0x1C,0xE3,0x72,0x46,0x41,0xD5,0xE1,
+	0xCB,0x30,0xAF,0x7B,0xD0,0x21,0xA6,0xF5,0xE4,0x0B,0x9E,
+	0x78,0xB5,0x9E,0x40,0xF3,0xD2,0x8C,0x63,0x30,0xE4,0x8A,
+	0xB4,0x66,0x51,0xE1,0x6B,0x8F,0x35,0x44,0x5F,0x24,0x6D,
+	0x1D,0x48,0x46,0x05,0xAB,0xCC,0x39,0xC4,0xF0,0x96,0x26,
+	0x34,0x79,0x2B,0x2E,0xDC,0xB1,0xFA,0x61,0xEB,0xBD,0xC9,
+	0xFC,0x5A,0xE0,0x58,0xF6,0x66,0x6A,0x47,0x07,0x2B,0x33,
+	0xD2,0x25,0xC1,0x02,0xAC,0xC7,0x84,0xDF,0xA7,0xDC,0xF9,
+	0x7C,0x08,0xE8,0xED,0xA3,0xE3,0x95,0xF1,0x39,0xF1,0x92,
+	0x59,0xE2,0xFD,0x98,0xE8,0xE6,0x56,0x8C,0xF1,0xAC,0xE1,
+	0x0B,0x08,0xDF,0xAD,0xF8,0xB8,0xA3,0x50,0x6B,0x9C,0xB1,
+	0xCC,0x13,0x95,0x0B,0xAE,0x6D,0xEF,0x84,0xA7,0x9E,0x56,
+	0x5B,0x18,0xCD,0x99,0x0E,0x56,0xCA,0x9D,0x28,0xB4,0x48,
+	0x17,0xAB,0x08,0x60,0x0C,0x1E,0x9A,0xAD,0x95,0xC0,0xDB,
+	0x5A,0xD9,0x16,0x7A,0x69,0xA2,0xD9,0xD5,0xE0,0xDB,0x40,
+	0xAB,0x25,0x0F,0xE1,0x15,0xC5,0x95,0xB4,0xCB,0xE2,0x4A,
+	0xC3,0xB6,0x96,0x3D,0xFA,0x26,0x01,0x98,0x8B,0xFF,0x39,
+	0x62,0x40,0x45,0x5F,0xEC,0x02,0x2E,0xB8,0x6C,0x0B,0xE1,
+	0xF3,0x78,0x03,0x1C,0x7C,0x6A,0x97,0x3C,0x44,0xA1,0x8C,
+	0xFE,0x3D,0x7F,0x8B,0x95,0x71,0x72,0x7A,0xE2,0x6C,0xC5,
+	0x97,0xBA,0x59,0x99,0xA7,0x5E,0xA6,0x9C,0xC9,0x5D,0xA5,
+	0xFE,0xF7,0xF4,0xFD,0x64,0x53,0xFC,0xB5,0xB3,0x4F,0x25,
+	0xE5,0xFA,0x03,0x96,0x42,0x45,0xA1,0xE4,0x11,0x92,0x3F,
+	0x38,0xB2,0xC4,0x72,0x88,0xEA,0xE4,0xFF,0xE5,0x84,0x25,
+	0xD5,0xCC,0xFF,0x4B,0xAE,0x25,0xD5,0xC5,0xFF,0x30,0xDF,
+	0x92,0x19,0x86,0xEE,0xBE,0x65,0x29,0x6A,0xC8,0x2B,0x7C,
+	0x3B,0xC6,0xA9,0xAF,0x5B,0x41,0x95,0x59,0x26,0x5F,0xF9,
+	0x54,0xFF,0xE4,0x87,0x79,0x5E,0xAC,0xCC,0x27,0x55,0xD9,
+	0x99,0x2D,0xCB,0x57,0x9F,0x56,0xFD,0xA4,0x82,0x20,0x95,
+	0x0C,0xFA,0x4D,0x31,0x98,0xF6,0x8C,0xB5,0xC6,0xEF,0xA1,
+	0x39,0x4F,0xE9,0x3C,0xD9,0xE1,0x23,0xCB,0x79,0x83,0x4B,
+	0x7E,0x20,0x51,0x0E,0x57,0x55,0xFA,0x02,0xA7,0xD5,0xE8,
+	0xCA,0xC8,0x38,0x8B,0x0F,0x10,0xB0,0xE4,0x6D,0xF6,0x8E,
+	0xE7,0x9F,0x57,0xC6,0x2F,0xD5,0x30,0xBD,0xC8,0xB7,0xB3,
+	0x68,0xA9,0xBF,0xC4,0x37,0xB0,0x21,0xC3,0x6A,0xC8,0xF3,
+	0xC7,0x42,0x1F,0xF4,0x1D,0x8F,0x2E,0xE2,0x4A,0x31,0xFA,
+	0xFF,0x2E,0xC8,0x95,0xEE,0xB7,0x79,0x95,0x4C,0x6E,0x17,
+	0xE4,0xBE,0x83,0x3A,0x02,0xE8,0x61,0xE8,0x0C,0x08,0x2D,
+	0x26,0xFB,0x37,0x8C,0xE6,0x6B,0x51,0x8A,0x88,0xB0,0x00,
+	0x96,0x69,0xCD,0xD0,0x54,0xC4,0x24,0xD1,0x74,0x5B,0xAC,
+	0x1C,0xB0,0x47,0x59,0x47,0x84,0x5F,0x05,0x97,0x78,0xE2,
+	0x43,0x08,0xBF,0x40,0x9A,0x44,0x76,0x5A,0x2C,0xF4,0xE2,
+	0x56,0xD8,0x23,0x2D,0x20,0x56,0xF7,0x57,0x89,0x39,0x30,
+	0xD7,0xEE,0x5A,0x18,0x18,0xFD,0x64,0xE6,0xDF,0xB1,0x46,
+	0x3F,0x27,0xFA,0xE2,0x86,0xFC,0xBE,0xE7,0xAF,0x13,0x72,
+	0xEF,0xC6,0x2D,0xAC,0x6C,0x6F,0x4D,0x9F,0xFC,0x6D,0x11,
+	0x02,0x22,0xBC,0xF1,0x99,0xE3,0x15,0xE0,0x6A,0x18,0xED,
+	0xF4,0xB1,0x12,0xAA,0xC8,0xB5,0xE2,0xF4,0xA2,0x39,0x6D,
+	0xEC,0x9B,0x64,0x9D,0x7D,0xFE,0x96,0x36,0x67,0x8E,0x91,
+	0x3B,0x3F,0x1A,0xE0,0x63,0x39,0x23,0x47,0xDC,0xCC,0x7F,
+	0x9F,0x73,0xFE,0xD8,0xF2,0x49,0x70,0x8D,0x77,0x4E,0xCA,
+	0x96,0x1B,0x8A,0x83,0xEF,0xA1,0x5B,0xF2,0x77,0x52,0xEF,
+	0xAC,0x8F,0xE0,0x5D,0xC9,0x55,0x04,0xEB,0xDE,0x97,0x81,
+	0xC0,0xB3,0x0B,0x22,0xA1,0x9B,0xAF,0xFD,0xDF,0xFE,0xDA,
+	0xFC,0x96,0xFE,0x71,0xF6,0xC6,0xAF,0x2E,0xDE,0xD0,0x4B,
+	0x39,0x14,0x0A,0x21,0x7C,0x6E,0x13,0x68,0xFD,0xFB,0xD4,
+	0xA0,0xB7,0x91,0xAC,0x11,0xEE,0x9B,0x8C,0xDB,0x5A,0x22,
+	0xE3,0xBD,0xE4,0xBB,0xE1,0x1F,0xC4,0x1D,0x13,0xF0,0xD9,
+	0xED,0x8B,0x0F,0x87,0x88,0xBB,0x99,0x81,0x6E,0x57,0x3F,
+	0x58,0xDF,0x0E,0x2A,0xDE,0xED,0xEF,0xE1,0x61,0xB3,0x8B,
+	0x35,0x1A,0xB7,0xD5,0x17,0x55,0xCC,0x52,0x15,0x94,0xC3,
+	0x5A,0xAD,0x1C,0x09,0xDA,0x30,0xFB,0xD2,0x9A,0x1F,0x90,
+	0xD0,0x70,0xAD,0x24,0x53,0xB2,0xFC,0x7A,0x9A,0xA5,0x4B,
+	0x58,0xD4,0x09,0xDB,0x06,0xCA,0x14,0x1F,0x06,0x30,0xF8,
+	0xB9,0xF3,0x2F,0x4B,0xA4,0x63,0xCF,0x0D,0x84,0x9F,0xFE,
+	0xBA,0x37,0x0C,0x4C,0xB5,0x05,0x7E,0x38,0x53,0x0E,0x80,
+	0x02,0xFA,0xF3,0x18,0x03,0x02,0x2B,0x1E,0x76,0x38,0xD7,
+	0x7B,0xBC,0xC5,0x6D,0x12,0x9C,0x2A,0xD1,0x81,0xC7,0xF9,
+	0x77,0x47,0xD9,0xB0,0x69,0x94,0x7A,0x8B,0x0C,0x5F,0xD0,
+	0xAD,0xBC,0xDC,0xFE,0x0C,0xA8,0xFB,0x5C,0x2A,0x47,0x17,
+	0x7A,0x72,0xA2,0x45,0xB8,0x6E,0x2E,0xF0,0xE8,0x55,0xFE,
+	0x75,0x87,0x66,0x7B,0x9F,0xA6,0x98,0xA4,0x13,0x2E,0x35,
+	0x3B,0xAB,0x0E,0xB2,0x89,0x1E,0xC7,0xC7,0x8C,0xD5,0x8B,
+	0xC8,0xC1,0xDB,0xD3,0x28,0x3E,0xA7,0x8B,0x4B,0x2D,0x90,
+	0xC9,0xD5,0x59,0xA1,0x2C,0x7C,0xD1,0x74,0x2C,0x12,0x8F,
+	0x5B,0x40,0x21,0x38,0x0E,0x11,0xB2,0x7B,0x17,0xD6,0x1C,
+	0xF6,0x60,0x35,0x3F,0x36,0x11,0x3B,0x79,0x07,0xA4,0x1D,
+	0x77,0x9E,0x36,0xC0,0x08,0xFF,0xB2,0x2F,0x4F,0x0B,0x62,
+	0xAA,0x8F,0xC9,0x79,0xB8,0x71,0x61,0x5E,0x10,0xD4,0x9C,
+	0xA7,0xFF,0xA3,0x08,0x5E,0x20,0x1D,0x8F,0x55,0x83,0xE3,
+	0xF2,0xD7,0x57,0x61,0x29,0x78,0x6E,0x3D,0x36,0x57,0x4B,
+	0x1B,0xBA,0x19,0xCE,0xD4,0x3D,0xE2,0x63,0x25,0xD7,0x2C,
+	0x39,0xB4,0x9A,0x18,0x31,0xCF,0x90,0xB9,0x72,0x97,0x58,
+	0x27,0xD0,0x47,0x4E,0xAC,0x60,0x3D,0x53,0x96,0x5F,0x4D,
+	0xD7,0x37,0xB4,0xB5,0xD8,0x80,0x20,0xEA,0x87,0x03,0xA7,
+	0xAA,0xC2,0x5C,0x91,0xFC,0xE9,0x99,0x6B,0x07,0x42,0x5B,
+	0xB6,0xED,0x0D,0x06,0xFE,0xCF,0x7F,0x66,0xCB,0x79,0xB8,
+	0x29,0x07,0x75,0xED,0xBB,0x69,0x2B,0x73,0x9D,0xA9,0x92,
+	0x63,0x49,0xF4,0xBC,0x3F,0x2E,0x5A,0xFA,0xD0,0x06,0xEA,
+	0x5C,0xBE,0xFE,0x9E,0xB7,0x48,0x22,0x52,0xBB,0xAD,0x8D,
+	0x83,0xCB,0x6B,0xEE,0x63,0x3F,0x6F,0xB5,0x55,0xCD,0x4A,
+	0x18,0x7D,0x06,0x9D,0x98,0x59,0xBB,0xE0,0x00,0x5C,0x74,
+	0xAE,0xF9,0x7C,0x51,0xF0,0xF0,0x8C,0xD8,0x56,0x33,0xCC,
+	0x4D,0x84,0x0C,0x5E,0x9E,0x5A,0x71,0xFC,0xDC,0xDC,0x09,
+	0x0C,0xBE,0x8D,0x22,0xDF,0x3D,0xA4,0x22,0xA1,0xE6,0x7C,
+	0x05,0xC7,0xBA,0x65,0x8C,0xB8,0xB1,0x68,0xF6,0x66,0xF1,
+	0xD7,0xE0,0x41,0xCE,0x22,0x95,0xA3,0x66,0x9D,0x66,0x8F,
+	0x66,0xE7,0x71,0x30,0x70,0xC8,0xAA,0x19,0x9F,0xDA,0xB5,
+	0xF9,0xD8,0xED,0x2D,0xFC,0x3C,0x00,0x76,0x61,0x10,0x82,
+	0x0B,0xCE,0xB7,0x19,0x64,0x21,0x17,0x52,0xD9,0x57,0x02,
+	0x67,0x6B,0x11,0xC9,0x6C,0x34,0xB8,0x67,0x9B,0x65,0x86,
+	0x7F,0xE6,0x6A,0x2E,0xFD,0x0C,0x97,0xCA,0xEA,0x0B,0x18,
+	0x37,0x98,0x69,0xA0,0x2D,0xE9,0x87,0xE5,0x64,0x2C,0x07,
+	0xD3,0x24,0x72,0x8C,0x57,0x01,0x67,0x38,0xEB,0x3C,0x22,
+	0x00,0xC9,0xCF,0xF8,0x8F,0x1C,0xF6,0xAC,0x41,0x10,0x68,
+	0x83,0xA9,0x5C,0xF0,0x00,0x33,0xA6,0x97,0xC1,0xC8,0x40,
+	0x65,0x64,0x70,0x16,0x59,0xF3,0x04,0x8F,0x4F,0x9F,0x3F,
+	0xA2,0xDD,0xDE,0x97,0x7D,0xFA,0x15,0x76,0x01,0xF2,0x80,
+	0x22,0xC4,0x06,0x9C,0x79,0xCB,0xCB,0x2E,0xA3,0xA1,0x98,
+	0x93,0x68,0x75,0x6B,0x49,0x7F,0x32,0x0E,0x85,0xD1,0x88,
+	0xA9,0xB1,0x7F,0x23,0x11,0xA2,0x97,0xC3,0x5C,0x51,0x8B,
+	0xDB,0x38,0x23,0x23,0x1A,0x79,0xBA,0x33,0x43,0x29,0xC1,
+	0x1A,0xA1,0x7C,0xB1,0x4B,0x9E,0xF2,0xC4,0x00,0xA2,0xFD,
+	0xC4,0x77,0x96,0x4B,0x39,0x6F,0xDD,0x41,0x67,0x19,0xCE,
+	0xD2,0x65,0x69,0xBB,0xAB,0xF5,0x80,0x45,0xF6,0x61,0x9F,
+	0x8F,0x20,0x2A,0xAF,0x0A,0x21,0xBE,0x37,0x84,0xDC,0x6E,
+	0x5E,0xB3,0xE4,0xEE,0x85,0x18,0xBD,0x8A,0xF3,0x77,0x6E,
+	0x06,0x80,0x04,0x9A,0x76,0x9D,0x40,0x98,0xD8,0xA9,0x6B,
+	0xED,0x2D,0xD9,0x13,0x4E,0x4E,0x3F,0x51,0x08,0x7C,0xF1,
+	0x0F,0x16,0xAC,0x88,0xA3,0xBF,0x00,0xE2,0xFD,0x9E,0x82,
+	0xAC,0x45,0xE5,0xE4,0xFA,0x10,0xF7,0xA1,0x76,0x85,0x50,
+	0x1F,0xE0,0xEB,0xE3,0xE2,0x60,0x24,0xDB,0x06,0x49,0x48,
+	0x68,0x5B,0x30,0x83,0xFA,0x9A,0x37,0xFB,0xF9,0x4F,0x7F,
+	0x30,0x69,0xDA,0xA2,0x8F,0xAB,0x52,0xA0,0x1C,0x16,0xA3,
+	0xE7,0xA3,0x77,0x79,0x86,0xEF,0x6E,0xED,0xD9,0x44,0xDB,
+	0xF5,0x26,0x43,0x62,0xCF,0x35,0x87,0x93,0x5B,0x4E,0xB2,
+	0xFB,0xF8,0x00,0xCF,0x83,0xEC,0x59,0x58,0xFA,0x65,0xF0,
+	0x6D,0x05,0x41,0xCC,0xCF,0x63,0x28,0xD8,0xF9,0xC5,0x30,
+	0xB9,0xDF,0x55,0xF7,0xFA,0xB7,0x56,0xDD,0x63,0xBB,0xD3,
+	0xB2,0x08,0xA1,0x66,0x10,0xE7,0x4B,0x79,0xDE,0xDF,0xC9,
+	0xD9,0xE2,0xFE,0x13,0x7B,0x49,0x58,0x5F,0x4E,0x82,0xFE,
+	0xCB,0xC2,0xDC,0x3F,0xCB,0xC3,0x9C,0xF9,0x1C,0x91,0x18,
+	0xB6,0xC5,0xA3,0x9C,0x79,0x31,0x49,0x4C,0xE8,0xE0,0x83,
+	0x63,0x36,0x9E,0x0E,0x74,0x71,0xA9,0x68,0x6B,0xEE,0xBD,
+	0xDA,0x20,0x57,0x0B,0x7F,0x4E,0x7E,0x82,0x37,0x30,0x6B,
+	0x90,0x84,0xEC,0xB1,0xAA,0xB8,0x9B,0x64,0x2A,0x2C,0x5B,
+	0x1C,0x4D,0x87,0x5E,0x67,0x01,0xD4,0x01,0x86,0x80,0x20,
+	0xC0,0x7C,0xE8,0x13,0xA0,0x7F,0x12,0x98,0x78,0xD1,0x67,
+	0xA0,0x3F,0x84,0xC5,0xA8,0x2E,0x82,0x0D,0xF7,0xC0,0x39,
+	0x11,0x44,0x04,0x11,0xF9,0xBF,0x41,0x11,0x51,0xE1,0x2D,
+	0xA5,0x0D,0x44,0xF1,0xEF,0x60,0xB6,0xD2,0xC3,0xEA,0x52,
+	0xB3,0x35,0x1C,0xED,0x4F,0xE6,0x4E,0xA7,0xD8,0x8C,0x9E,
+	0x89,0x9B,0xD4,0x24,0xA5,0x0F,0xC2,0x45,0x20,0xD2,0xA6,
+	0x20,0xDD,0x3B,0x62,0x9D,0xE0,0x3D,0x0C,0x59,0x9B,0xDD,
+	0x3E,0xB5,0x1D,0xD8,0x6D,0xDD,0xFB,0x71,0xA1,0xCD,0xEA,
+	0xF9,0xE8,0xE1,0xEB,0x35,0xB4,0x85,0x68,0x3E,0x8A,0xFC,
+	0x0C,0xF8,0xE8,0xC0,0xC1,0x10,0x04,0xFF,0xAF,0xE9,0xF5,
+	0xFE,0x95,0x63,0xFA,0x8B,0x85,0x6C,0x17,0xD8,0x92,0x3B,
+	0xCA,0xA7,0x2B,0x27,0xA0,0xB3,0xED,0xD8,0x8D,0xC2,0x7A,
+	0x5C,0x78,0xD0,0x68,0x34,0x4C,0xBF,0x2F,0x4F,0x5C,0x99,
+	0x23,0x06,0x4E,0x14,0x69,0x57,0x2A,0xDC,0x45,0x54,0x22,
+	0x2C,0x4E,0x96,0x1C,0xB8,0xB0,0xEC,0xED,0x3A,0xCE,0xDA,
+	0x4A,0x83,0x21,0x3A,0xC8,0x27,0x08,0xBB,0x93,0x67,0x0B,
+	0xB1,0x4D,0x32,0x90,0xBB,0x86,0x77,0x66,0xFC,0xD8,0x3E,
+	0x3D,0x1C,0x2E,0x84,0x67,0xDC,0xEB,0x81,0x88,0x2D,0x1B,
+	0xB6,0x36,0xBC,0x8F,0x4B,0x2A,0x45,0x9A,0x2E,0xCC,0x98,
+	0xCD,0x7C,0x48,0x1C,0xC7,0xC0,0x02,0x1D,0x1F,0xAA,0x82,
+	0x66,0x24,0x8F,0xED,0x37,0x38,0xBD,0x94,0x07,0x01,0x78,
+	0xAA,0x86,0xD9,0x6B,0xBA,0x5C,0xC6,0xDD,0x36,0xDE,0x36,
+	0x2F,0x95,0x3A,0xF8,0x35,0xA8,0xC6,0xFD,0xB9,0x3A,0x44,
+	0xAE,0xD5,0xAE,0xF6,0xE8,0xD5,0x41,0xA2,0xD0,0xBF,0xA2,
+	0x09,0xE3,0xA4,0x9E,0x7C,0x60,0x5F,0x0A,0x0B,0xF7,0x99,
+	0xF1,0x2F,0x65,0x28,0xB2,0xCF,0x3D,0x99,0x85,0xE0,0xF8,
+	0x19,0x4E,0xE7,0x5A,0xE4,0x50,0x61,0x90,0x45,0x41,0x75,
+	0x45,0x07,0x49,0x45,0x10,0x75,0x0A,0x51,0xA4,0x58,0x65,
+	0x30,0xB0,0x5C,0x65,0x9E,0x2E,0xC7,0x41,0x8B,0x2B,0x83,
+	0xC4,0x46,0x7C,0xCA,0xE0,0xE5,0xEA,0x49,0x15,0x5F,0x3E,
+	0x23,0x77,0xC8,0xE6,0x8A,0x9D,0x3F,0x31,0x6E,0x10,0x09,
+	0xEC,0xBE,0x1E,0x24,0x2B,0xE8,0x9F,0xFD,0x6E,0x1A,0x60,
+	0xFE,0xEB,0x99,0xF2,0x2E,0x92,0xF1,0x99,0x5D,0xFB,0xC2,
+	0x41,0x0E,0xD0,0xCF,0xD9,0xB1,0xAF,0xFE,0xE0,0x3D,0xFA,
+	0xD9,0xB7,0xEC,0x51,0x73,0xAE,0x3A,0xBF,0x35,0xFB,0x93,
+	0x83,0x3C,0xCD,0x85,0x66,0x6F,0x57,0x3F,0x42,0x44,0xE7,
+	0x07,0x22,0x66,0x8D,0x8B,0x52,0x8D,0x7C,0x67,0xFB,0x54,
+	0xAF,0x47,0x1C,0x37,0x5D,0x7B,0x78,0x28,0xF8,0x80,0x7D,
+	0x2F,0x0E,0x14,0xF8,0x50,0xCC,0x71,0xFB,0x8C,0x8C,0xA4,
+	0xFC,0xB1,0xE4,0x67,0x9D,0x0B,0xFC,0x80,0xFA,0x82,0xBE,
+	0x3F,0xC8,0xFE,0x33,0x5C,0x2C,0xBB,0x00,0xC1,0x01,0x0F,
+	0x8B,0xA9,0xD3,0x64,0xDE,0x22,0xDA,0xF6,0xE8,0xD8,0x7B,
+	0x4A,0x17,0xE8,0x8E,0xDB,0x5C,0x2C,0x6D,0x34,0x21,0x11,
+	0xB4,0x80,0xC4,0x71,0x38,0x3D,0x53,0x72,0xAA,0x46,0x4A,
+	0xD4,0x1D,0xA4,0xC4,0x0D,0xA6,0x18,0x0D,0x5F,0x84,0xF9,
+	0x54,0x9D,0x89,0xE8,0xEF,0x0E,0xD6,0xA1,0x99,0x88,0x8E,
+	0x26,0xB5,0x6C,0x73,0x73,0x2B,0x80,0x92,0xE4,0x4F,0xFD,
+	0x8F,0x8A,0x9F,0xA6,0xB6,0xCF,0x1B,0xF3,0xA9,0xFC,0xED,
+	0xBE,0x55,0xAD,0x8D,0x35,0xE6,0x7C,0xF3,0xA9,0xF9,0xB9,
+	0x18,0xF7,0x92,0x72,0xF7,0x3F,0xFF,0x21,0xA9,0x52,0x9E,
+	0x49,0x40,0xAF,0x3B,0x07,0xB3,0xB5,0xCC,0x66,0x05,0xF3,
+	0xED,0xCF,0x27,0x8E,0xA6,0x65,0xA5,0x6F,0xD9,0xC7,0x30,
+	0x59,0x65,0xAD,0x9A,0x80,0xF5,0x33,0x7E,0xEB,0xB6,0x8B,
+	0xFB,0x70,0xF3,0x5A,0x8A,0x25,0x1B,0x5E,0xA5,0x3D,0xA8,
+	0x32,0x18,0x6F,0x54,0x3C,0xB2,0xC5,0xB5,0x67,0x0B,0xE2,
+	0x8B,0xE4,0xCA,0x53,0x4F,0x15,0xAE,0x20,0xFE,0x56,0x15,
+	0x6F,0xDB,0x71,0xAD,0xFB,0x7B,0xF3,0x24,0x72,0x81,0x62,
+	0xD1,0xDA,0xE3,0x12,0xB1,0x3D,0x1D,0x86,0x99,0xB1,0xE5,
+	0xB1,0xA3,0xE5,0x6C,0x8E,0xB7,0x4C,0x05,0x85,0x17,0xFC,
+	0x33,0xC6,0x98,0xC4,0x38,0x00,0x33,0xFA,0x30,0x5C,0xDF,
+	0x32,0xF5,0x92,0xD9,0x55,0x39,0x4A,0x84,0x2C,0x61,0x1F,
+	0x44,0x76,0x14,0xA8,0x3F,0xF4,0x78,0x25,0xCE,0xC9,0xCE,
+	0x3B,0x9C,0x92,0x9B,0xB1,0x0D,0xC0,0xCE,0xF8,0xE5,0xFC,
+	0x03,0x9A,0xF8,0x1E,0x3C,0xB5,0x35,0xA2,0xBD,0xD2,0xB8,
+	0xB1,0x06,0xB9,0xA9,0x38,0x8A,0xC0,0xDD,0x09,0x5C,0x0C,
+	0x3D,0x53,0xC9,0x25,0x10,0x08,0xE4,0x8E,0xE6,0xE9,0x61,
+	0x91,0x39,0xD2,0x0E,0xC3,0x8E,0x81,0x9E,0xBA,0xE5,0xDF,
+	0x79,0xAD,0x22,0x13,0x91,0xD8,0xE7,0x83,0x50,0x3D,0x2E,
+	0x75,0x2E,0x29,0x95,0x6C,0xE2,0x9A,0x80,0xD8,0x6F,0x96,
+	0xB0,0xC4,0xEB,0x0F,0x4A,0x62,0x4C,0x71,0x87,0xAB,0xD0,
+	0xA2,0x82,0xF7,0x6A,0xA7,0xE6,0xDF,0xAF,0x04,0xA1,0xE6,
+	0x89,0x46,0x3A,0x99,0x1F,0x57,0xBB,0xEC,0xBF,0x92,0xF5,
+	0xD4,0x4A,0xB4,0xDB,0xDE,0x99,0x93,0xF5,0xAA,0x4A,0x09,
+	0x99,0xF8,0x21,0x85,0x58,0xE0,0x8F,0xF9,0xB1,0x8B,0x8A,
+	0x04,0x17,0xE8,0x5F,0x8E,0x3C,0x52,0xC0,0xA3,0x11,0x70,
+	0x31,0xC1,0x78,0x98,0x3F,0x9E,0x3E,0x61,0xFB,0x3A,0xF2,
+	0xAE,0x6D,0x5C,0x58,0xCA,0xBB,0x51,0x6F,0x4E,0x04,0x2C,
+	0xC2,0x8A,0x95,0xE8,0xFB,0x1A,0x7E,0x12,0xC2,0x95,0x2C,
+	0x1B,0xD9,0x85,0x8E,0xA9,0x58,0xFE,0x87,0x02,0x4F,0x78,
+	0x90,0x39,0x91,0x22,0xED,0xB3,0x48,0x74,0x2F,0xD3,0x06,
+	0xF2,0x1F,0x2C,0x08,0x29,0x3C,0x59,0x2B,0x64,0x76,0x79,
+	0x75,0x6C,0xC1,0x36,0x13,0xFD,0x98,0x1B,0xA2,0xFD,0x02,
+	0x3B,0x48,0x6B,0x7B,0xA7,0x66,0xAB,0x34,0xEE,0x9C,0x1B,
+	0x65,0xF2,0x63,0x5E,0x6C,0x26,0xF2,0xF3,0x24,0x15,0xB1,
+	0x0F,0x4D,0xDE,0x05,0x83,0x41,0x3E,0xE9,0x76,0x63,0xE0,
+	0x9E,0xBD,0xF1,0xED,0x2F,0xF9,0x94,0xAE,0xE9,0xF3,0x3D,
+	0x79,0xAB,0x64,0xFB,0x51,0x8D,0xE1,0x29,0xC1,0x59,0x21,
+	0x81,0x76,0x08,0xD7,0x6F,0x92,0xFD,0x4A,0xD3,0xE0,0x88,
+	0x5B,0x02,0xC5,0x3D,0xA4,0x5C,0x38,0xBF,0x73,0x70,0x7D,
+	0x74,0x6A,0x97,0x7D,0x46,0x4F,0xF6,0xB5,0x79,0xF1,0xF9,
+	0x20,0x09,0x51,0xD9,0x9A,0x78,0x6C,0x01,0x5C,0xB6,0xF9,
+	0x0C,0x4D,0x9C,0x61,0xDA,0x86,0x42,0x3E,0x4E,0x85,0xAD,
+	0x71,0xD1,0xB9,0x4F,0x51,0x05,0xF6,0xC7,0x61,0x1B,0x9C,
+	0x96,0x1B,0x8B,0x8D,0x00,0xF9,0x52,0xB7,0xDB,0x86,0xE4,
+	0x52,0x10,0x20,0x7F,0xD5,0xF5,0x0D,0x50,0x20,0x45,0xDB,
+	0xDA,0x99,0xB6,0x7C,0x69,0xAF,0xF0,0xD5,0x52,0xC7,0xDE,
+	0x0C,0x09,0x30,0x22,0xEC,0xA8,0x79,0xA7,0x49,0xA2,0x82,
+	0x65,0xF7,0x4A,0x84,0x2E,0x49,0x8B,0x34,0x6F,0x13,0x32,
+	0xEB,0xE8,0x1A,0x73,0x10,0xC0,0xA2,0x3D,0xC4,0x28,0x26,
+	0xC0,0x7C,0xC1,0xF5,0xD2,0xD1,0x28,0x43,0x31,0x1A,0xD2,
+	0x5F,0x25,0x7B,0x28,0x25,0x82,0x1D,0xAF,0xFB,0xE4,0xD2,
+	0x21,0x04,0xAD,0xB6,0x70,0xE2,0xF7,0xB1,0x3E,0xA6,0xD5,
+	0x64,0x0B,0x26,0x8C,0x6A,0x7E,0x5B,0x21,0x5F,0x9F,0x52,
+	0xE7,0x53,0xC5,0xF5,0xC9,0x6B,0x44,0x45,0x56,0xD1,0xF2,
+	0xE3,0xCE,0xC6,0x1E,0x40,0x61,0x71,0x19,0x82,0x24,0x8E,
+	0x57,0xB9,0x69,0xCF,0xFE,0x16,0x8F,0x36,0xE8,0x85,0x52,
+	0x15,0xFF,0xC2,0xBF,0xEE,0x2A,0xBC,0x91,0x30,0x52,0x1D,
+	0xFE,0x79,0x53,0x94,0x40,0xE5,0xDB,0xED,0xDC,0x68,0x22,
+	0x1E,0x41,0xC0,0xAF,0x32,0x44,0x46,0xD5,0x72,0xA3,0xBB,
+	0xF2,0x54,0x24,0x39,0xC5,0x59,0x19,0xEC,0xDD,0xEB,0x97,
+	0x23,0xA9,0x34,0xD5,0xB0,0x90,0xC3,0x5D,0x55,0xC9,0x69,
+	0xE0,0xF7,0x4D,0x16,0xDD,0xB5,0xDB,0x05,0xDA,0xC6,0x88,
+	0xE9,0xE8,0x0B,0x3E,0x6B,0x6C,0xC1,0x22,0x48,0x4F,0x2C,
+	0x58,0x9E,0x11,0x50,0x88,0xF3,0x0C,0x7F,0xB5,0x1A,0x58,
+	0x70,0xF0,0x9B,0xFB,0x93,0x5C,0xF7,0xF4,0xA7,0x23,0x0D,
+	0x4B,0x8E,0x59,0xF6,0x87,0xDD,0x21,0x96,0x40,0x48,0xC8,
+	0x1B,0xA8,0x55,0x03,0xFC,0x9C,0x1F,0x0C,0xE6,0x17,0xA5,
+	0x49,0xC0,0xBC,0x67,0xB6,0x4D,0xA9,0xF9,0x3B,0x68,0xB9,
+	0x2D,0xDF,0xD4,0x9E,0x0C,0xDC,0x7B,0xF0,0x6B,0x30,0x9A,
+	0x3D,0x5F,0x24,0x80,0xED,0xF0,0xE6,0x6A,0x7E,0xCF,0x54,
+	0x9E,0x28,0x58,0xFF,0x55,0x55,0x5B,0x7C,0x4B,0x1F,0xA2,
+	0x6F,0x45,0xFA,0x57,0xCC,0x6F,0xC4,0x47,0xAB,0x3A,0xE9,
+	0xC0,0x7D,0xBE,0x2A,0xF0,0x26,0xDF,0xD6,0xF1,0xA0,0x21,
+	0xE1,0x45,0x12,0xA4,0xBD,0xAC,0x55,0x2D,0x8A,0x3F,0x9D,
+	0xA5,0x36,0xC5,0x70,0x44,0x32,0x5F,0x08,0x43,0x75,0x3A,
+	0x88,0xC9,0xC7,0x28,0xA3,0xCA,0x77,0x0E,0xAA,0x2B,0xA5,
+	0xC8,0x18,0x11,0x45,0x54,0x65,0x15,0xEA,0x0C,0x89,0xDD,
+	0x2A,0x7D,0x3C,0x82,0x70,0xF8,0xA4,0x29,0xE5,0x16,0x6C,
+	0x19,0x43,0xB9,0xC1,0x8F,0x2A,0x78,0xFF,0x55,0x44,0x8C,
+	0xEB,0xE9,0xB5,0xC3,0x7F,0xC1,0x71,0xEC,0x91,0x9C,0x0E,
+	0x02,0x1C,0xFF,0x69,0x00,0xF9,0xE2,0xF9,0xAE,0x7C,0xB1,
+	0x5E,0x0E,0x30,0xC1,0x22,0x20,0x42,0xC0,0x41,0x74,0x56,
+	0xEE,0x58,0xDF,0x46,0xE9,0xF4,0xA9,0xA2,0x05,0xED,0x1B,
+	0xAA,0xD9,0xBD,0x1C,0x77,0xE1,0xCA,0x7F,0x91,0xF2,0x85,
+	0x0D,0xC8,0xE2,0xB2,0x4A,0xBD,0x7B,0x3B,0x8C,0x7B,0x15,
+	0x9C,0x17,0x26,0xCE,0xC1,0x79,0x95,0x6E,0x20,0xFD,0xAA,
+	0x92,0x44,0x69,0x7C,0x3C,0xA5,0x05,0x4C,0xAC,0xF0,0xB4,
+	0x19,0x2F,0x71,0xDA,0xCD,0x58,0x6C,0x7D,0x20,0xEA,0xF1,
+	0x57,0xD8,0xD1,0x84,0x81,0x0B,0x32,0x45,0xF6,0x19,0x04,
+	0x96,0x22,0x49,0xB7,0x36,0x7A,0x5A,0x9F,0x25,0x68,0xC0,
+	0xB9,0x9E,0xD2,0x89,0x85,0x40,0x52,0x9E,0x71,0xED,0x77,
+	0x14,0x64,0xED,0x89,0x10,0xF4,0x11,0x56,0xF9,0x88,0xC4,
+	0x6D,0x54,0x0B,0x8E,0x55,0x63,0xE3,0x27,0x45,0x04,0x54,
+	0x19,0xDD,0x9F,0x1F,0xF5,0xEF,0xC8,0x8E,0x00,0x8C,0xD7,
+	0x86,0xDE,0x51,0x7E,0x0A,0xBC,0x93,0xF5,0x0E,0x07,0x64,
+	0xC4,0x2A,0x3C,0x0A,0xFD,0x2C,0x08,0x3C,0xA6,0x07,0x82,
+	0x90,0xAA,0x88,0x0E,0x18,0xDF,0x3A,0x1A,0x96,0x57,0xF0,
+	0x85,0xC4,0x13,0xB3,0x0B,0x1D,0x41,0x8D,0xC0,0xDE,0x22,
+	0x0E,0x04,0xCD,0x85,0x34,0xBB,0xCD,0x7A,0xFF,0x59,0x58,
+	0xF7,0xE6,0x84,0xB1,0x65,0x66,0xD5,0x1D,0xA5,0xC5,0x26,
+	0xFE,0xB6,0x22,0xB9,0x50,0xE5,0xC4,0xFA,0xFF,0x9A,0xD9,
+	0x84,0x2A,0x84,0xCC,0x2D,0xE6,0xC6,0xA5,0x13,0xF9,0xE6,
+	0x61,0x7E,0xC9,0x76,0x85,0xB0,0xA1,0x82,0x52,0x2D,0x61,
+	0x24,0xB0,0x1C,0xF9,0xC5,0x96,0x73,0xB6,0xFB,0x98,0x40,
+	0xF6,0x7F,0xBA,0x41,0x23,0x7F,0x30,0x85,0xA9,0xAD,0xC4,
+	0xA0,0x29,0xB6,0x45,0xF1,0x81,0xCE,0x2E,0x0D,0xA8,0xEB,
+	0xDA,0x24,0x3B,0x9D,0x50,0xE3,0xBF,0x28,0x55,0xAF,0x30,
+	0x8C,0xF3,0x78,0x61,0x05,0x92,0x8B,0x22,0xBF,0x13,0x62,
+	0xCF,0x3E,0x8A,0x5C,0x83,0x91,0x38,0x5A,0xBF,0x08,0x75,
+	0xB5,0x0D,0x39,0x5E,0xD0,0xAF,0x06,0xD4,0x24,0x66,0x68,
+	0x7B,0xE7,0xC7,0xCB,0x8E,0xC6,0x8F,0x82,0xA8,0x64,0x17,
+	0x48,0x03,0xF6,0xFC,0x2A,0xF2,0xEB,0x2B,0x65,0xEB,0xEA,
+	0x61,0x50,0x16,0xD4,0x57,0x36,0x2C,0x2B,0xD9,0xF6,0xE1,
+	0x5D,0x00,0xE7,0xD4,0x5B,0x3D,0x74,0xF6,0x71,0xAC,0x8E,
+	0x6E,0x14,0x72,0x79,0x02,0x15,0xA4,0x38,0xCB,0xF7,0xA6,
+	0x1E,0x55,0x19,0x04,0xF3,0x7F,0x73,0xA5,0x63,0x81,0xE7,
+	0xEA,0x4A,0x18,0x40,0x4B,0x70,0xB1,0xA0,0x6C,0xAF,0x3F,
+	0x4C,0x0B,0xBF,0xAF,0x27,0xE4,0xDF,0xE3,0xF5,0xEB,0xDC,
+	0x2B,0x06,0xCC,0x65,0xA0,0x50,0x35,0x20,0x34,0x89,0x56,
+	0x64,0x32,0x2F,0x61,0x60,0x77,0xC6,0xC7,0xBE,0x68,0x30,
+	0xD4,0x9B,0x1E,0x48,0x64,0xBE,0x9C,0x16,0xEA,0x37,0xD4,
+	0x3F,0x96,0x14,0x87,0x28,0xCF,0x12,0x29,0x8F,0x60,0x9A,
+	0xA7,0xF5,0x3E,0x36,0xFA,0x9A,0xD4,0xB2,0x87,0x1F,0x16,
+	0x26,0xC9,0x85,0x4B,0x36,0x1E,0x9C,0xD1,0x61,0x46,0x23,
+	0x53,0xB2,0x81,0xC6,0xC5,0x0F,0xC5,0x32,0x2A,0x6B,0x4A,
+	0x3A,0xCA,0xB4,0x27,0x31,0x3D,0x5D,0x42,0xFD,0x94,0x9B,
+	0x10,0x37,0xBB,0xC2,0x41,0x04,0xE6,0xE3,0x5C,0x48,0xF3,
+	0x98,0xD8,0xA2,0x03,0xF3,0xC9,0x73,0xD1,0xE8,0xA5,0x7B,
+	0x27,0x16,0x0E,0x10,0x2B,0xB2,0xD8,0x0A,0xF8,0x1C,0xFD,
+	0xF9,0xF7,0xD1,0x14,0xDE,0xAE,0x49,0x07,0xB8,0x64,0x34,
+	0x1F,0x77,0x41,0x57,0xC5,0xE8,0xA7,0x0D,0xB0,0x6E,0xC1,
+	0xE9,0xAA,0x0A,0xB3,0xD2,0xAE,0xE9,0x4C,0xC9,0xDF,0xE8,
+	0xFF,0x9D,0x4F,0xA7,0x12,0x52,0xCE,0xEF,0x8D,0x54,0xCF,
+	0x77,0xEE,0x06,0x6D,0xCE,0xC7,0x02,0x61,0x68,0x4A,0x2D,
+	0x88,0x52,0x75,0x5D,0xCC,0xA8,0xE4,0x5D,0xA2,0xC8,0x96,
+	0x42,0xE2,0xC7,0x74,0xFD,0x46,0xBE,0xFB,0x4F,0x69,0x79,
+	0x32,0x0C,0x11,0xA4,0x61,0xF5,0xFA,0xCC,0x2E,0xC6,0xA3,
+	0xA9,0x1F,0xF1,0x58,0x14,0x35,0x0F,0x5D,0xE1,0x87,0xE8,
+	0x97,0x33,0x75,0x57,0xDE,0xFA,0x8C,0xF2,0x17,0x0B,0x58,
+	0x24,0xB8,0x08,0x80,0x8B,0xB7,0x07,0x87,0x98,0xBF,0x64,
+	0xD2,0x97,0xB4,0x08,0x14,0xF3,0x05,0xF4,0x17,0xB6,0x55,
+	0x54,0x0F,0x76,0xD9,0xC2,0x6E,0x8B,0x59,0x04,0xB0,0x75,
+	0x36,0x37,0x21,0xDF,0xA6,0x4A,0xBE,0x99,0x3E,0x07,0xC0,
+	0xAF,0xBE,0x5F,0xDB,0xD3,0x85,0x06,0x83,0xB0,0xFE,0x39,
+	0xA9,0xBF,0xF8,0x28,0x69,0x1B,0x9D,0x37,0x25,0xB2,0xEF,
+	0xC9,0xC8,0x46,0x1C,0x99,0xCE,0xEE,0xAF,0x98,0x18,0x13,
+	0x7D,0x05,0x97,0x41,0x15,0xA4,0xDB,0x18,0x89,0x1E,0x63,
+	0xB9,0xBB,0x9C,0x74,0xC8,0x00,0x17,0x91,0x34,0x23,0x97,
+	0xE2,0xA8,0x9D,0x4C,0xD9,0x99,0xE6,0x0C,0xCF,0x2E,0xF8,
+	0xA7,0x62,0x93,0xA0,0xCD,0xB1,0x57,0xFC,0xCF,0xD7,0xCD,
+	0xE7,0xED,0x75,0xD8,0x7D,0x48,0xDB,0x6B,0x7E,0xAE,0x03,
+	0x6A,0xE4,0x5F,0x27,0x9A,0x97,0xCA,0xA2,0x19,0xCB,0xB2,
+	0xC4,0x70,0xDB,0xB7,0x6B,0xF6,0x06,0xF1,0x99,0x71,0xDD,
+	0x0A,0x31,0x3D,0x59,0xD1,0x17,0x33,0x43,0x1C,0xF5,0xA6,
+	0x62,0x0B,0xDD,0x17,0xAD,0xC0,0xB1,0x3C,0x7C,0xB6,0xBC,
+	0x8D,0x76,0x88,0x9A,0xAB,0x2C,0xDE,0x5A,0x3B,0xCC,0x20,
+	0x94,0x31,0x36,0xF3,0x48,0x89,0x07,0x6E,0x33,0xC7,0x92,
+	0xF9,0x8A,0x0B,0x88,0x1E,0x94,0x3A,0xC2,0xFF,0xE7,0xEF,
+	0xDA,0x2F,0x4D,0xD0,0xDB,0xFC,0x8C,0x2B,0x29,0xF7,0xD6,
+	0x9B,0x3F,0x54,0xE9,0x5F,0xA9,0xEA,0x46,0x32,0x01,0x7D,
+	0x41,0x37,0x8A,0xC4,0x30,0x0E,0xB5,0x84,0x9E,0xFD,0xFB,
+	0x21,0x1F,0x18,0x07,0x2A,0x79,0xBC,0x14,0x88,0x5A,0xE7,
+	0x91,0x0D,0xBF,0x1E,0xC2,0x20,0x85,0x8D,0x67,0xB0,0x34,
+	0x92,0x94,0xF6,0x3E,0x1F,0x82,0x87,0xB0,0xD3,0xB4,0xFF,
+	0x71,0xF7,0xD3,0x53,0x82,0x1E,0xFA,0x4A,0xFE,0xC1,0xFB,
+	0xBD,0xD5,0xF2,0x2B,0xFC,0xC9,0xBC,0xEF,0x15,0x51,0xD0,
+	0x25,0xEA,0x67,0xE7,0x8C,0x3C,0x78,0xED,0x9C,0x90,0xBB,
+	0x67,0x3B,0x31,0x14,0x1B,0x21,0xFA,0x3E,0x9F,0x2D,0x23,
+	0xD1,0x04,0x8F,0xAC,0x84,0xA0,0x8B,0x3A,0x40,0xC5,0xD0,
+	0xA3,0xF9,0xF7,0x1B,0x40,0x06,0xEB,0x73,0x3F,0x88,0x72,
+	0x85,0xCA,0x51,0xFF,0xD4,0x07,0x36,0xCE,0x8B,0xBA,0x0F,
+	0x5A,0x56,0x29,0xE4,0x2E,0xF4,0x5D,0x03,0x15,0xBD,0x50,
+	0x82,0x00,0x9D,0x9D,0x3E,0x4C,0x67,0x7F,0xD7,0x65,0x1B,
+	0x0D,0x52,0xE1,0x75,0xD7,0x00,0xFC,0x39,0xBA,0x08,0x6D,
+	0x29,0xB9,0x5E,0x13,0x30,0x4C,0x34,0x31,0x67,0x32,0x39,
+	0x9C,0x73,0xB2,0xC9,0x7C,0x3E,0x7B,0x40,0x3D,0x09,0xE6,
+	0x7B,0xF0,0x86,0x0A,0xCB,0x17,0xA8,0xD2,0x10,0xAD,0xF8,
+	0x72,0x67,0xC9,0xB8,0xE6,0xDA,0x61,0xE7,0x34,0x9A,0x3B,
+	0xB5,0xCD,0x68,0x6B,0x78,0x5C,0x2A,0xE9,0xE2,0xAF,0x4E,
+	0x88,0xA0,0x0F,0x54,0xFC,0xAA,0x30,0x85,0xFB,0xEA,0x05,
+	0x51,0x74,0x51,0xFA,0x55,0x7D,0x5D,0x7C,0x58,0x9B,0x15,
+	0xEC,0xEE,0x09,0x3C,0xB8,0xAF,0x4C,0x4D,0x11,0x7A,0xC2,
+	0xCA,0xF4,0x5D,0x71,0x08,0x8A,0xFF,0x6C,0xF9,0x5B,0x47,
+	0xE4,0xB8,0xB8,0x69,0x30,0x8B,0x4F,0xFE,0x56,0x07,0xDB,
+	0x58,0x5E,0x27,0x11,0xAB,0xBB,0x62,0x08,0x97,0x7C,0x82,
+	0x60,0x04,0xB6,0xD3,0xAB,0xBE,0x45,0x8A,0xB4,0xFD,0xC6,
+	0x3E,0xC1,0x30,0x9F,0x1F,0x14,0x0D,0x41,0xB6,0xF9,0x39,
+	0x9E,0xEA,0x49,0xB8,0x77,0x7B,0x39,0xEE,0xCC,0x4E,0xF8,
+	0x33,0xD4,0xB2,0x39,0xFA,0x20,0xDC,0x34,0x9F,0x71,0xCC,
+	0x21,0x2B,0xD6,0x18,0x4C,0x17,0xE1,0xF4,0x15,0x89,0x47,
+	0x1A,0x8B,0x70,0xE8,0x67,0xC9,0xE7,0x03,0x8E,0xDB,0x80,
+	0x3F,0xBA,0xE1,0x30,0xEE,0xF9,0x2E,0xF0,0x9F,0xA5,0x5D,
+	0x63,0x73,0xFA,0x9C,0x75,0xBB,0x5D,0x2D,0xBA,0x2E,0x0E,
+	0xF3,0x31,0xB3,0x0B,0xCB,0xA3,0x35,0xCF,0x12,0x01,0xF8,
+	0x27,0xE0,0x60,0x27,0x08,0xF2,0xAF,0x19,0x68,0xA0,0x0E,
+	0x60,0x9E,0x25,0xC4,0x5B,0xED,0x89,0x4D,0x68,0xCC,0x62,
+	0x23,0x17,0xFB,0xFD,0x4E,0x9A,0x32,0x73,0x01,0x42,0x21,
+	0xFD,0xCD,0xE6,0x92,0xA2,0x70,0x6E,0xE6,0x87,0x14,0x76,
+	0x6B,0x86,0x60,0x71,0xB4,0x67,0x03,0x67,0xBC,0x65,0x1D,
+	0x5B,0x36,0xAB,0x68,0xA5,0x40,0x7E,0xAD,0xDD,0x01,0x0C,
+	0x92,0x50,0x3E,0x53,0xF4,0xC5,0x61,0x5E,0xD1,0x85,0x8D,
+	0xB5,0xEE,0xDD,0x36,0x84,0xA1,0xD2,0x69,0x6A,0x35,0x3C,
+	0xD7,0xF0,0xF5,0x37,0x93,0x05,0xF4,0xD8,0xDF,0x24,0x84,
+	0xBF,0x32,0x4C,0x13,0x4F,0xDC,0x6F,0x79,0x19,0x19,0x95,
+	0xB9,0x08,0x1D,0x56,0x33,0x8F,0x14,0x4A,0xEE,0xE3,0x85,
+	0x99,0x53,0x6F,0xA2,0xE0,0xA8,0x88,0xAB,0xB7,0x2B,0x16,
+	0x0B,0x04,0xFD,0xD4,0x9A,0x3B,0x4E,0x72,0xBE,0x35,0xAA,
+	0x99,0x37,0x3C,0x16,0xB2,0x69,0xF4,0x52,0xFA,0x21,0xF9,
+	0xF1,0xC7,0x76,0xCF,0xF7,0x3B,0xBB,0x1E,0x5D,0xFF,0x39,
+	0x3C,0x58,0x2D,0x3B,0x2E,0x4A,0xBF,0xD5,0x06,0x9B,0xB5,
+	0x22,0x30,0x95,0xE3,0x66,0x9F,0x00,0x9A,0xB9,0xF8,0x6A,
+	0xEB,0x22,0x89,0x12,0xD3,0x1B,0x5A,0x9D,0x68,0xC0,0xED,
+	0xC0,0xD0,0xDB,0x01,0x74,0xFC,0x83,0x0E,0xC8,0xBD,0x95,
+	0x59,0xF8,0xD7,0xED,0xCF,0x0E,0x42,0x76,0x2A,0xC1,0xAA,
+	0x42,0x7F,0x08,0x4E,0x26,0x83,0xD6,0x1B,0x59,0xA6,0xBB,
+	0x83,0x0C,0x7A,0x87,0x2E,0xAF,0xA5,0x14,0x34,0xFE,0x3D,
+	0xF7,0x0B,0xBC,0x87,0x8A,0x13,0x0A,0x02,0x4B,0x32,0x0D,
+	0xF0,0x4F,0x12,0x9E,0xC7,0x5B,0x8A,0x76,0x60,0x8D,0xB8,
+	0x56,0x93,0x38,0x9A,0x36,0x28,0x82,0x49,0x1A,0xDF,0xDF,
+	0x89,0x6E,0x81,0x00,0xB7,0x80,0x12,0x6D,0xEA,0x09,0x32,
+	0x30,0xCF,0xB6,0x0B,0x22,0x93,0xF1,0x88,0x36,0x17,0xFD,
+	0x98,0xC8,0xF0,0xEB,0xF3,0xFE,0x97,0x78,0x03,0x3A,0x25,
+	0x11,0xEE,0x37,0x4A,0x24,0xAF,0xAF,0x7A,0x06,0x4E,0x80,
+	0xB4,0x64,0xAE,0x41,0x5C,0xFB,0x55,0xBB,0x4B,0xAE,0x48,
+	0xDB,0xF1,0x7D,0xE5,0x2D,0x06,0xF8,0x68,0xCF,0x9B,0x80,
+	0xE8,0x41,0xF2,0xE7,0xC1,0x45,0xFE,0x56,0xDF,0x1A,0xD7,
+	0x15,0x5F,0xDD,0x39,0x3B,0xFC,0x02,0xDC,0xA4,0x21,0xD2,
+	0xDF,0x26,0xE8,0x33,0x08,0xBF,0xE5,0xE9,0xF4,0xE0,0xCA,
+	0x80,0xC7,0x8B,0x42,0x9B,0xC8,0xE5,0xDE,0x27,0x12,0x39,
+	0xA1,0x68,0xEF,0xAC,0xD5,0x63,0x2E,0x5C,0x8C,0xD3,0xEC,
+	0x00,0x42,0xA7,0x39,0x07,0xE4,0x78,0x37,0x19,0xC2,0xD8,
+	0x7E,0x30,0x29,0x40,0xEB,0x10,0xF3,0x6F,0x7C,0xD9,0xEC,
+	0xBC,0x8D,0x01,0x7C,0xFF,0xEC,0xFC,0x0D,0x2F,0xB0,0x51,
+	0xA8,0xF0,0xA2,0x3F,0x03,0x8D,0xBF,0x86,0x01,0x26,0x72,
+	0x4A,0x70,0x84,0xB9,0xAC,0xB2,0x12,0x62,0x4F,0x32,0x9E,
+	0xDC,0x7B,0x85,0xF2,0x21,0xAB,0x44,0x49,0xAC,0xB3,0x9E,
+	0x0D,0xB5,0xF6,0xF3,0xB3,0x8D,0xED,0xF6,0x73,0xB6,0x2A,
+	0x20,0xD3,0x8B,0x38,0x74,0x2A,0xFE,0xB8,0xA8,0x2A,0x6C,
+	0x5A,0xEB,0x71,0x0B,0x6F,0xFD,0x30,0xAB,0x4E,0xB4,0x43,
+	0x9B,0x6B,0x3B,0x3E,0x78,0xBE,0x25,0x73,0xA1,0x66,0x1F,
+	0x98,0xC0,0x13,0x39,0xEF,0x1A,0x20,0xFF,0xAA,0xB5,0xCD,
+	0xD6,0x26,0xF4,0x2E,0xCC,0x5F,0x31,0x55,0x0D,0x08,0xC9,
+	0x82,0x41,0xDA,0x37,0x9D,0xAF,0x89,0x40,0x1D,0x2F,0xCB,
+	0xB5,0x77,0x3F,0x82,0x38,0x6E,0xEF,0xB1,0xDF,0xDB,0xD3,
+	0x38,0x8B,0x4D,0x97,0x1C,0x49,0x02,0xD0,0x2B,0x8B,0x74,
+	0x4E,0x1D,0xE5,0xA2,0x9C,0x69,0x5E,0xE5,0x5F,0xC7,0xC5,
+	0x26,0x6E,0xFF,0x75,0x90,0x91,0x43,0xEC,0x0D,0xC3,0x15,
+	0xFA,0x46,0xF1,0xEC,0x3E,0xC3,0xC0,0x84,0xBE,0x9A,0xC0,
+	0xFF,0xEB,0x6E,0xFE,0xEB,0x55,0xFA,0xAC,0xED,0x8E,0x2A,
+	0x4B,0xDC,0xFF,0xAF,0x6E,0x11,0xB1,0xF7,0x52,0xC9,0x20,
+	0xDA,0x40,0xAE,0x45,0xE2,0xE5,0x86,0xD2,0xAD,0xB2,0x88,
+	0x9B,0xC5,0x7C,0xCF,0x98,0xDC,0x70,0xFF,0x15,0xF8,0x00,
+	0xFB,0x0D,0x1C,0xC0,0xF9,0x8E,0x5B,0xA2,0x58,0xF0,0x42,
+	0xFE,0x24,0xBA,0x98,0x3F,0xA1,0x27,0xC7,0x09,0x82,0xFC,
+	0xAC,0x2B,0x92,0x96,0x27,0xF4,0x43,0x12,0xEE,0xED,0xC8,
+	0x0E,0xBE,0x7E,0xDD,0x47,0x02,0x76,0x21,0xA4,0xF7,0x9F,
+	0xD2,0x45,0xC8,0xF8,0x45,0x6B,0x18,0x05,0x8A,0x68,0x05,
+	0xA1,0x07,0x51,0xBC,0xBB,0x28,0x60,0xA1,0xCA,0x7C,0xA1,
+	0x66,0x21,0x45,0xAF,0xB0,0xD6,0xA4,0x95,0x22,0xE9,0xE0,
+	0xF6,0x74,0x5F,0x15,0xE0,0xC7,0x1F,0x56,0xDE,0x6F,0xDD,
+	0xFA,0x15,0xF6,0x06,0x52,0xA0,0x73,0x11,0x0D,0xCF,0xB5,
+	0x09,0xE4,0x1E,0x1C,0x62,0xC1,0x94,0xF3,0x6E,0xBB,0x31,
+	0x5E,0x9D,0x55,0xF3,0x7D,0xE9,0x97,0xD9,0xDC,0xE8,0xDB,
+	0x93,0x4D,0xD8,0xD5,0xCB,0xCB,0xDD,0xFF,0xE8,0x70,0xB5,
+	0xFF,0xF9,0xC3,0x7F,0x16,0x0D,0xB6,0x46,0xBA,0x32,0x59,
+	0xF5,0x5F,0xAF,0x67,0xEF,0x5A,0x5E,0x13,0x87,0x0E,0x08,
+	0xD9,0x21,0xAD,0xD2,0x36,0xCB,0xE5,0x18,0xCE,0x2F,0x18,
+	0xF3,0x3F,0xDA,0x2C,0xB3,0xCA,0x90,0x77,0x10,0xD6,0x9E,
+	0xD1,0x6E,0x50,0xBC,0x35,0xBB,0x0A,0x23,0x1D,0x2E,0x0D,
+	0x0E,0x87,0xDD,0x8E,0x46,0x02,0xFB,0x8C,0x73,0x0E,0x64,
+	0x53,0xFC,0x40,0xE2,0x39,0xAA,0x61,0x9E,0xFC,0x65,0x7D,
+	0x1A,0x68,0xCE,0xD1,0x33,0x3C,0x35,0x8C,0xEF,0xF6,0x9C,
+	0x82,0x4A,0x6A,0xB6,0x03,0x7B,0xB3,0xCB,0xE3,0xB3,0x80,
+	0xF3,0xC9,0x4B,0xEC,0x35,0xEE,0x32,0x95,0xC9,0xBD,0x5F,
+	0x65,0xC0,0x3E,0x21,0x3E,0xE2,0x1A,0x07,0xEB,0xD9,0x0E,
+	0xD7,0x10,0xD2,0xF3,0xD9,0x9F,0xF3,0x2E,0x4B,0x7D,0x8A,
+	0xE0,0xB7,0x87,0x2E,0x45,0xC7,0x10,0x55,0x24,0x15,0x02,
+	0x31,0xEC,0xF0,0x01,0x09,0x56,0x36,0xAC,0xE6,0xFD,0x77,
+	0xDC,0xDE,0x10,0x59,0x53,0xC4,0x63,0x51,0x85,0x12,0x93,
+	0x57,0x0B,0xCA,0x81,0x51,0xE7,0xCA,0xBF,0x40,0xD5,0x9E,
+	0x7A,0x20,0x3E,0x28,0x0B,0x9E,0xF8,0x5F,0xB1,0xBD,0x13,
+	0x22,0x54,0x13,0xDE,0xF9,0x42,0xFA,0xEE,0xB4,0xB5,0xB0,
+	0x96,0xB5,0x0F,0x42,0xFD,0x8C,0x47,0xA6,0xA3,0xEC,0x17,
+	0xC9,0xF9,0xE5,0x12,0x0B,0xCB,0xEF,0xF7,0x65,0xB5,0xAC,
+	0x20,0x1C,0xA4,0xAC,0xC3,0x5F,0xF5,0x54,0xE0,0x9D,0xC4,
+	0x44,0x8B,0xDA,0x28,0xC9,0xEF,0x2E,0xB0,0x15,0xB8,0xFA,
+	0xE0,0xE1,0xDE,0x2B,0x67,0x34,0x24,0xFE,0x53,0x83,0xFD,
+	0xA2,0xEA,0xAF,0x87,0x3D,0x2A,0x0D,0xA1,0x77,0x78,0x06,
+	0x67,0x5B,0xE2,0x1E,0x41,0x20,0xD0,0x08,0x30,0xEA,0x40,
+	0x02,0xD2,0x66,0x8C,0x09,0x1C,0x7A,0x4F,0xD2,0x38,0x1E,
+	0x30,0xE0,0xA2,0xAB,0xFC,0x1D,0x55,0x99,0x6C,0x33,0xB7,
+	0xBC,0x1F,0x46,0xD7,0x33,0x9C,0xAA,0xFF,0x99,0x0D,0x28,
+	0x2E,0x95,0xAE,0xCF,0x83,0x17,0x70,0x7E,0x6A,0xE6,0xC9,
+	0x02,0xD2,0x4E,0xD7,0x0E,0x3B,0x48,0x91,0xCE,0xF6,0x7E,
+	0x7D,0xC0,0x70,0x5A,0xAF,0x1B,0xFF,0xBD,0x7A,0x14,0x56,
+	0xF3,0xFB,0xEA,0xBE,0xBF,0xDF,0x7B,0xE9,0xE9,0x5C,0xA9,
+	0xF7,0x8C,0x98,0xBE,0x6F,0xB2,0xFC,0x04,0xD3,0xED,0x79,
+	0x6E,0x25,0xF9,0x6C,0xAE,0x77,0xB1,0xD6,0xCB,0x31,0xFD,
+	0x67,0x78,0x37,0x5A,0x7A,0x01,0x3E,0x10,0xDA,0x77,0x99,
+	0x2E,0xB7,0x6A,0x81,0xA3,0x8D,0x0F,0x75,0x80,0x8E,0x5E,
+	0x32,0x71,0x8B,0x25,0xA8,0x88,0xD1,0x4D,0xB5,0xB8,0xAE,
+	0x18,0x0B,0xDA,0xAB,0x39,0x68,0xF7,0x39,0xF1,0x33,0x17,
+	0xD0,0x27,0x90,0xE1,0x49,0x75,0x54,0x4F,0x31,0x3A,0x4A,
+	0xDE,0x3A,0x7C,0x90,0x70,0x20,0x91,0xFD,0x16,0x80,0x73,
+	0x6F,0x62,0x70,0xB0,0xE4,0xD8,0x00,0xF9,0x0A,0xA3,0x04,
+	0x69,0xBA,0xD0,0x91,0xA7,0x4B,0x30,0x52,0x18,0x14,0x77,
+	0x09,0x1D,0x10,0x00,0xB8,0x29,0xCC,0x37,0x7C,0x09,0xBD,
+	0x2B,0xDD,0x67,0x38,0xB3,0x77,0x4C,0x67,0x67,0x88,0x33,
+	0x15,0xC0,0x46,0x5A,0x00,0x0C,0xE4,0xF8,0xD5,0x74,0xF6,
+	0x2A,0x7B,0x8E,0x32,0xC1,0xD8,0xF7,0xBF,0xF2,0xA1,0xB9,
+	0x72,0xA9,0xCB,0x98,0x04,0x27,0x5F,0xDA,0x1B,0x20,0x9E,
+	0xCB,0xDB,0xEF,0x00,0xC1,0x21,0x7E,0xA0,0x09,0x80,0xDE,
+	0xA7,0x96,0x6D,0xE9,0x04,0x41,0xE4,0x40,0xDB,0x39,0x93,
+	0xA4,0x2E,0x91,0x23,0x20,0x33,0x7B,0xFD,0x45,0xC5,0x8F,
+	0x7D,0xAE,0x1B,0x0B,0x85,0xF9,0xC4,0x09,0xBE,0x83,0xA2,
+	0xFA,0x43,0x47,0x8D,0xEF,0xA9,0xF6,0x12,0x03,0x49,0x5C,
+	0xB9,0xBD,0x0F,0x54,0xEE,0x97,0x74,0x07,0x87,0x49,0xBC,
+	0x3D,0xB7,0xEE,0xA9,0x64,0xCB,0x50,0xF1,0xFA,0x11,0x51,
+	0x76,0xEE,0xB8,0xDF,0x09,0xBF,0x04,0x5B,0x3A,0x6C,0xC4,
+	0x6B,0xFD,0x50,0x33,0xE6,0x12,0xB9,0xDD,0xB0,0xB4,0x25,
+	0xB6,0xBA,0xCD,0x95,0x72,0x7A,0x6B,0x91,0x7C,0xE4,0xF6,
+	0xCB,0xC1,0xE8,0x20,0x10,0x7E,0x58,0xC4,0x9D,0xDA,0x60,
+	0x74,0x00,0xDC,0x21,0x7E,0x9B,0xC1,0xE1,0xEA,0x71,0x79,
+	0xA2,0x01,0x0F,0xDD,0xE9,0xBF,0x3C,0x0E,0x35,0x2F,0xBC,
+	0xCB,0xBE,0x18,0xC8,0x52,0x39,0xB8,0xB2,0x8C,0x37,0x2B,
+	0xED,0xEC,0x9C,0x48,0xFC,0x70,0x10,0xCC,0x83,0xBB,0x4B,
+	0x38,0xCC,0xEF,0x3C,0x1B,0x9E,0xC4,0x86,0x19,0x9F,0x4E,
+	0x01,0xA9,0xE2,0x1A,0x6A,0x90,0x0B,0x6E,0xAE,0x57,0x2C,
+	0xA3,0x82,0x54,0xB9,0x33,0x51,0x09,0x2A,0x68,0x86,0x09,
+	0x5F,0xDF,0x18,0xD3,0x72,0x17,0x62,0xE1,0x9B,0x7C,0x06,
+	0x2A,0xBB,0x5C,0x00,0x6D,0x80,0xC6,0xBE,0x1D,0x0E,0xB8,
+	0x49,0x3C,0x8F,0x5A,0x65,0x98,0x05,0xFD,0xF7,0xD7,0x4C,
+	0x9D,0x26,0x95,0x80,0x09,0x22,0xFA,0x24,0x88,0x5C,0x85,
+	0xF6,0x0B,0xCE,0x87,0x4B,0xFF,0xFB,0x17,0xC1,0x30,0xFE,
+	0x09,0x09,0x88,0xB8,0xDB,0x1B,0x21,0x26,0x55,0xF6,0x28,
+	0x03,0xE5,0xDE,0xD4,0xAE,0xD3,0x8D,0x84,0x76,0xE8,0x42,
+	0x84,0xB8,0x11,0xCC,0x48,0xAD,0xDF,0x4B,0x0E,0xD3,0x8F,
+	0x47,0x86,0xBD,0xD8,0xF7,0x07,0x21,0xC4,0x73,0x9B,0x0C,
+	0x05,0x92,0x9E,0x5E,0x9A,0xC8,0x87,0x26,0x74,0x00,0xD0,
+	0x59,0xD9,0xDC,0x8F,0x13,0x61,0xA6,0xD4,0x67,0xF5,0x7D,
+	0x4C,0x7B,0x57,0xE3,0xF9,0x4F,0x3A,0xE2,0x7E,0xC2,0x82,
+	0x58,0xD7,0xBF,0x51,0xD1,0x93,0x97,0x3A,0xC6,0xC0,0x80,
+	0x93,0x37,0x42,0x03,0x30,0x67,0xBF,0xBA,0x7F,0x94,0x14,
+	0x3C,0x66,0xCA,0x41,0x01,0xD0,0x28,0xC4,0xC8,0x26,0x1A,
+	0x98,0xB8,0x21,0x80,0xA3,0x1E,0x23,0xBC,0x72,0x3A,0x23,
+	0x8F,0x91,0xF6,0xA0,0x85,0x23,0x31,0x15,0xD3,0xDE,0x2E,
+	0x0F,0xC7,0x85,0xC4,0xB0,0xBF,0xD8,0x82,0x25,0x5F,0x97,
+	0x3D,0x9F,0x90,0xA7,0x31,0xA6,0x97,0x5E,0x1C,0x4B,0x69,
+	0xEF,0xF6,0x03,0x1C,0x93,0x8D,0x64,0x05,0x7D,0xCB,0x1C,
+	0x2F,0xDD,0x9A,0xA9,0x06,0x88,0x07,0x05,0x5D,0xCF,0xFE,
+	0xDC,0x4C,0xCA,0x24,0x9C,0x83,0x5E,0x7C,0xE5,0x50,0x29,
+	0x57,0xDF,0x72,0x6A,0xD6,0xAB,0x0D,0x69,0x48,0xAE,0x2F,
+	0x52,0x7E,0x0A,0x12,0x4E,0x6A,0x37,0x20,0x06,0x78,0x0F,
+	0xA2,0x82,0x91,0xC3,0x5A,0xCA,0x6F,0xA9,0xFC,0x3F,0xD0,
+	0x8C,0xBE,0xE6,0x20,0xA3,0x26,0x14,0x7F,0x25,0x80,0xA8,
+	0xF6,0xF0,0xB4,0xCC,0x85,0x80,0x74,0x6D,0x6C,0xCE,0xCF,
+	0x88,0x79,0x17,0xDF,0x7B,0xA2,0x86,0xE7,0xD5,0xEF,0xEB,
+	0xFE,0xEE,0xE0,0x08,0x82,0xCC,0x03,0xD1,0x1B,0x93,0xD2,
+	0x6C,0x47,0xC4,0x38,0xEA,0x75,0xA5,0xAB,0x58,0xF9,0xB1,
+	0x70,0x02,0xA1,0x04,0x58,0xAC,0x9F,0x5C,0xE2,0x05,0x5D,
+	0x09,0x82,0x95,0xD6,0x45,0x1C,0xDA,0x36,0x15,0x7F,0x7A,
+	0xA1,0xD5,0x3F,0xF8,0x20,0xE4,0xFE,0x79,0x3A,0xDB,0x20,
+	0x7A,0x15,0x99,0xF0,0x44,0xE5,0x6F,0xFE,0x9E,0x43,0xAF,
+	0xBA,0x52,0xF6,0x1D,0xA1,0xFE,0x1D,0xEB,0xF2,0xFE,0x38,
+	0xC7,0xC8,0xBB,0x87,0x6F,0xCF,0xCE,0xC4,0x7D,0xDD,0x33,
+	0xD5,0xD3,0x96,0x97,0xE3,0xED,0x2E,0x26,0x79,0x3D,0x97,
+	0x08,0x66,0xAB,0x0C,0x0D,0xE2,0x67,0x95,0x39,0xD3,0xC2,
+	0x7E,0x25,0x57,0xC8,0x58,0x6A,0x7E,0xCB,0xF2,0xEB,0x3E,
+	0x1D,0xBE,0xDA,0x58,0x24,0xFE,0x9F,0xA0,0xD8,0x23,0xDA,
+	0xEE,0xB0,0xE1,0xCB,0xDF,0xDF,0x0C,0x07,0xD8,0x86,0x8B,
+	0x49,0x70,0xC3,0xD9,0x14,0xF0,0x3C,0x83,0x85,0x1C,0x5A,
+	0xA2,0x2D,0x46,0x42,0x3E,0xCA,0x75,0x18,0x1E,0x86,0xE1,
+	0x96,0x1A,0x27,0xEC,0x42,0xC7,0xCE,0xB8,0x7B,0xD2,0x92,
+	0x47,0xD6,0xC4,0x83,0xDB,0xCF,0x3D,0x97,0x56,0x99,0x2D,
+	0x7E,0x3D,0xD8,0x7C,0x46,0xEB,0x4B,0xD1,0x61,0x6E,0x9B,
+	0x74,0x8C,0x9A,0xEA,0x33,0xAD,0xC1,0x88,0x4F,0x57,0xBA,
+	0x08,0xE0,0x86,0x37,0x4F,0xC1,0x7A,0x23,0x16,0x12,0x12,
+	0xFB,0x0B,0xFC,0x45,0xC3,0xCE,0xDF,0x8B,0x0E,0x06,0x3F,
+	0x60,0xCE,0xAD,0x20,0xAA,0x21,0x90,0xC3,0x52,0x05,0x3E,
+	0x73,0x85,0x06,0xEC,0x53,0xCD,0x4A,0xDB,0xBA,0xFB,0xB7,
+	0x5A,0x36,0xDD,0xB8,0x0E,0xBE,0x13,0x88,0xBE,0xDF,0x3A,
+	0x2B,0x6B,0xD5,0x7A,0x42,0x87,0x08,0xA1,0x2D,0xB6,0xC7,
+	0x2E,0x9B,0xFB,0x74,0x75,0x4F,0x77,0x0F,0x45,0x3F,0xAE,
+	0xD8,0x40,0xA7,0x7D,0xE8,0xAA,0x9B,0xA4,0x8B,0x0F,0xD2,
+	0x73,0xAA,0x87,0x00,0x7C,0x67,0x0E,0xCC,0xFC,0xB1,0x75,
+	0xFE,0xB9,0xD8,0x03,0x78,0x0C,0x3D,0x70,0xE8,0xB1,0x0C,
+	0xD2,0x1C,0xB5,0xFE,0x05,0xD4,0xAC,0xDF,0xB8,0x6C,0x8E,
+	0x35,0x96,0xA3,0xF1,0x84,0xB9,0xED,0x67,0x6D,0x31,0x1B,
+	0x97,0xAB,0x37,0x36,0xB6,0xC0,0x7B,0x85,0xC9,0xDB,0x8D,
+	0x42,0x41,0xDF,0x94,0xEB,0x1B,0x7E,0x14,0xBA,0xFC,0x04,
+	0x89,0x86,0xB9,0x9C,0xFD,0xD3,0x96,0xC3,0xCF,0xE5,0xB0,
+	0x6B,0x1B,0x13,0x0E,0x6C,0xE4,0x4E,0x2C,0x9E,0xA8,0x55,
+	0x3E,0x99,0xD7,0x27,0x13,0x46,0xE5,0x2D,0xBA,0x75,0xF6,
+	0xA4,0x1A,0x47,0x8D,0xA0,0x52,0x17,0xB5,0x16,0xBC,0x3F,
+	0xF6,0x71,0xE3,0x4A,0x48,0xFE,0x11,0x20,0xE5,0xF2,0x02,
+	0xA0,0x37,0x80,0x35,0x81,0x5C,0xFF,0xF1,0x0D,0xC4,0x7A,
+	0x59,0xBC,0xEA,0x70,0xEA,0x8F,0x4A,0x5F,0x7D,0x81,0xCF,
+	0x1F,0x56,0xBB,0xE3,0xF9,0xE3,0xBC,0x65,0xE1,0x14,0x51,
+	0x5C,0x3B,0x74,0x99,0x75,0x4F,0xDC,0x19,0x10,0xC9,0xA7,
+	0x94,0xCC,0x8B,0x68,0x5F,0x36,0xBE,0xB4,0xE1,0x04,0xE6,
+	0x0A,0x20,0x3C,0x28,0x0E,0xF2,0xCC,0xD3,0xC3,0x81,0xA8,
+	0x1D,0xD8,0xB5,0xB4,0x62,0x52,0x88,0x2B,0x67,0x23,0xA5,
+	0x9D,0x3E,0x9F,0xC0,0x16,0x80,0xCC,0xD3,0x3F,0xA1,0x76,
+	0x7F,0x1D,0xBF,0xDC,0x88,0xD8,0xA6,0x8E,0xB5,0xC7,0x65,
+	0xA0,0x2D,0x00,0xCF,0x27,0xCA,0x55,0x35,0xAE,0xFE,0xA7,
+	0x93,0x22,0xDC,0x0E,0x1A,0xC8,0x27,0x1E,0xBD,0x79,0xFF,
+	0x7E,0xA5,0xA9,0x17,0x9C,0x00,0x04,0x0F,0x02,0xE3,0x31,
+	0x1B,0xDA,0xC3,0x46,0xD5,0xB3,0xA2,0xBB,0x49,0xB4,0x76,
+	0xD8,0x7B,0x13,0x15,0xF1,0xC8,0x2E,0xCC,0x46,0x34,0x18,
+	0x77,0xD6,0xA1,0xF7,0xC1,0x7F,0x1B,0xDB,0xFE,0xEC,0x4E,
+	0x44,0xFC,0x4A,0x27,0xF2,0x3F,0x30,0xE6,0xC9,0x06,0xA8,
+	0x68,0x8E,0x63,0xB3,0xFA,0xD5,0x81,0x40,0x4B,0x07,0xE4,
+	0xDF,0xBB,0x7A,0x16,0x26,0x4E,0x9C,0x9F,0xFA,0x0F,0xA8,
+	0x8D,0xF9,0x5C,0x65,0x6B,0xEB,0x1E,0x0F,0xFB,0xF0,0x08,
+	0x73,0x8D,0xC2,0xCD,0x3F,0x8E,0x16,0xFC,0x7C,0x3E,0xB3,
+	0xF7,0x41,0x8D,0x7A,0xE5,0x65,0x95,0x9C,0x82,0x6B,0x3F,
+	0x24,0x2F,0xBB,0xEC,0xFF,0x5E,0x13,0xC9,0xF9,0x4B,0x39,
+	0xCB,0x7F,0xFA,0xF5,0x61,0x7B,0xAB,0x86,0xA3,0x70,0xEB,
+	0x79,0x9C,0x0A,0x9B,0xC9,0x71,0xBC,0xFA,0x77,0xC3,0xFE,
+	0x98,0x7E,0x01,0xE2,0x61,0xFB,0xBD,0xE8,0x55,0x40,0x63,
+	0x11,0x57,0x9B,0xCF,0xB3,0xDF,0x36,0xBB,0x02,0x1D,0x75,
+	0x3E,0x3D,0x2F,0x26,0x39,0x5F,0xEC,0x38,0x6E,0x1C,0xA6,
+	0x17,0x93,0xAB,0x83,0x7B,0xE0,0x1A,0x99,0x04,0xB6,0x9E,
+	0x95,0x55,0xE1,0x27,0xF8,0x69,0x47,0x1C,0x46,0x4D,0xB0,
+	0x18,0xAD,0x99,0xC5,0x4C,0x3F,0x6A,0x36,0x6C,0x48,0x80,
+	0x07,0x30,0x93,0x26,0x8E,0x08,0x9D,0x13,0x80,0x47,0xC1,
+	0x80,0xC5,0x03,0xCB,0x96,0xA9,0x9E,0xB9,0xE0,0x77,0x6E,
+	0x46,0xEF,0xDF,0x67,0x3D,0x60,0xCF,0xA5,0xDC,0x04,0x38,
+	0x69,0x8D,0x58,0x65,0xB5,0xEB,0x0C,0x74,0x1F,0x9D,0x26,
+	0x14,0x42,0xE5,0x94,0x67,0x37,0xBA,0x25,0xC9,0x51,0xC9,
+	0x74,0x2E,0xF9,0xB7,0x26,0xF7,0xBE,0xED,0xB1,0x38,0x09,
+	0x2F,0x50,0x4D,0xDE,0x6B,0xFD,0x9C,0xAF,0x2E,0x07,0x62,
+	0xFB,0xD8,0x11,0x8E,0x4C,0xED,0x23,0x23,0x97,0x5D,0x11,
+	0xC5,0xA5,0xEF,0xBB,0xAC,0x33,0xA3,0x46,0x49,0x5C,0x46,
+	0x61,0xE0,0x6E,0xA0,0x68,0xA0,0xFB,0xBF,0xF3,0x21,0xBD,
+	0x9E,0x1E,0xDF,0x6F,0xC9,0xC8,0x5D,0xE5,0x82,0x3D,0xB0,
+	0x42,0x99,0x73,0x38,0x8C,0xAD,0xD8,0x76,0x52,0xE1,0x50,
+	0x0B,0x44,0xE8,0x9C,0x78,0x0B,0xAC,0x00,0xB4,0x90,0x28,
+	0xD4,0x0A,0xDC,0x3F,0xCC,0xE4,0x61,0x4E,0x1F,0x8A,0xF6,
+	0x9A,0x1C,0xA9,0xD1,0x81,0xF6,0x2A,0xEF,0x1D,0x0C,0x11,
+	0x3A,0x6E,0xAA,0x32,0x7F,0xD2,0xBF,0xF0,0xBD,0x80,0xB6,
+	0xA8,0xC4,0xF3,0xE8,0xF5,0xFE,0x04,0xB8,0x9E,0x97,0xFF,
+	0x4F,0x74,0xE3,0xD0,0x79,0x27,0x93,0x67,0x7E,0xB1,0x0B,
+	0x1A,0xFB,0xC3,0x04,0x7A,0x9E,0x3E,0x7C,0x10,0x73,0xC0,
+	0x38,0x4C,0x18,0xB2,0x80,0x47,0x78,0x66,0x59,0xBB,0xFF,
+	0x9C,0xB6,0x14,0xE5,0xE9,0x4F,0x5D,0xEA,0x3E,0xF4,0xA3,
+	0xF3,0x88,0x66,0x98,0x3B,0xF6,0x3A,0x12,0x41,0x67,0x4E,
+	0x8B,0x05,0x5C,0x05,0xBB,0x8B,0xDC,0x68,0x40,0x39,0xF6,
+	0x37,0xB3,0x71,0xCC,0xE8,0x43,0x47,0xA3,0xD9,0xAC,0x9E,
+	0x5D,0xAC,0xB9,0xBC,0xD2,0x40,0xB3,0xC6,0xED,0xDF,0xE4,
+	0xFF,0x0E,0x98,0x1E,0x56,0xED,0xF4,0xE5,0x9B,0x0A,0x2A,
+	0x63,0x2A,0x73,0xD9,0xF2,0xAB,0x14,0xE3,0xE2,0xCF,0x08,
+	0x63,0xDC,0xBC,0xB9,0xE3,0x0C,0x9C,0x2D,0xDF,0xC8,0x54,
+	0x3F,0xB4,0x77,0xCC,0xDF,0x1A,0x5B,0xFB,0x5F,0x7A,0xCA,
+	0x1E,0x7E,0xE9,0x41,0x62,0xDB,0x1D,0x1E,0x08,0x5E,0x46,
+	0x83,0x1B,0x74,0x0C,0x02,0x9D,0x39,0x59,0xF3,0x99,0x1C,
+	0xBE,0xC1,0x91,0xC0,0x14,0xE9,0x0D,0x8B,0x43,0x94,0x01,
+	0x36,0x29,0x8A,0xB3,0xB4,0x56,0x32,0x11,0xCA,0xF5,0x55,
+	0xD9,0xF1,0x08,0x1C,0x48,0x94,0x47,0xDE,0xD5,0x4E,0x39,
+	0x0F,0xA7,0xDD,0x97,0x3F,0x57,0x25,0xD2,0x72,0xED,0xDF,
+	0xF6,0x7F,0x7F,0x9B,0xE5,0x98,0xED,0x8F,0x0E,0x40,0x93,
+	0xF4,0xFD,0xE2,0x26,0x85,0xCE,0x33,0x31,0xCD,0x07,0x1D,
+	0xF0,0xBD,0xEF,0xB8,0xD1,0x7F,0x39,0x5B,0x9A,0x1A,0x7D,
+	0x21,0xC2,0x93,0xE0,0x49,0x17,0xF6,0x24,0x7A,0x32,0x63,
+	0xB2,0x70,0xF2,0x15,0x7B,0xF2,0xED,0xE4,0xD4,0xA4,0xDE,
+	0xE4,0x21,0x7B,0x72,0x6E,0x72,0x69,0x72,0x75,0x32,0x95,
+	0x3D,0x25,0xFB,0x61,0x64,0x8A,0x39,0x15,0x32,0xF3,0xF1,
+	0x1A,0x70,0x5F,0x69,0x52,0x7D,0xB2,0xC4,0x38,0xD6,0x4E,
+	0x43,0x26,0xD3,0xAD,0x76,0xC3,0x21,0xE0,0xB2,0x4B,0x70,
+	0xB7,0x43,0x2C,0x34,0x3E,0x44,0x80,0xE5,0x20,0xC7,0x2C,
+	0x85,0xEC,0xD4,0x30,0x41,0x49,0xBA,0x12,0x7A,0x86,0x6B,
+	0x01,0x2F,0x3C,0xBA,0xE7,0x5F,0xCE,0x1E,0x4E,0x18,0xED,
+	0x41,0x7A,0xCA,0x06,0xEC,0x12,0xF2,0xB6,0xC1,0xFB,0x47,
+	0x7C,0xA9,0xA6,0x82,0x05,0xF5,0xAC,0x1D,0xA3,0x9E,0x39,
+	0xF0,0x73,0x87,0x92,0x79,0xA3,0xA1,0xCE,0x27,0xFF,0x36,
+	0xF7,0x26,0x46,0x92,0x0E,0x20,0x59,0xD4,0x83,0xFA,0x83,
+	0xD5,0x1D,0x56,0xB3,0x24,0x46,0xA8,0x69,0xDE,0x63,0x86,
+	0x4B,0xBD,0x78,0xA8,0xF3,0x21,0xEE,0xF3,0xE1,0x7D,0x49,
+	0xC7,0xC7,0x96,0x63,0xA1,0x08,0x1A,0xAF,0xF9,0xFD,0x11,
+	0x2D,0xFC,0xCF,0x37,0x3F,0x1F,0xDC,0x75,0xCB,0xA6,0x30,
+	0xB9,0xDD,0x1C,0x2B,0xFA,0x31,0x7E,0x7F,0x5F,0xF8,0xFF,
+	0x4C,0xF5,0x47,0xBB,0x0B,0x8A,0xB2,0x04,0x12,0x61,0x52,
+	0x13,0x8F,0xD1,0xF0,0x4A,0x10,0x2C,0x1D,0x1C,0x19,0x30,
+	0xF3,0x3D,0xFA,0x6F,0xD7,0x1A,0xB0,0xC9,0xC0,0xE4,0x3C,
+	0x7A,0xF9,0x32,0xC6,0xA1,0x4B,0x0F,0x42,0x3B,0xC9,0x39,
+	0x4A,0x7B,0x18,0xED,0xBD,0x4B,0x17,0xE3,0x5A,0x4D,0x43,
+	0x3E,0x11,0xF8,0x91,0xF3,0x0E,0x25,0x49,0xE2,0x82,0xFA,
+	0x5C,0x99,0xCF,0xD9,0x8B,0xCD,0x70,0xF3,0xBF,0x3D,0x5B,
+	0x43,0x8F,0x5E,0x2E,0x99,0x7C,0x3F,0xFD,0xFE,0x93,0x47,
+	0x46,0x51,0x7D,0x1F,0x1B,0x62,0xF4,0x2B,0x09,0xAA,0xF2,
+	0x4B,0xF4,0xF8,0xC8,0x7C,0xF5,0x5B,0xE0,0xDE,0x10,0xBE,
+	0xDC,0x5B,0xF9,0x63,0x2D,0x93,0xC2,0xE2,0xB4,0x7E,0xD3,
+	0xEF,0x8C,0xA1,0xA5,0x8D,0xE1,0x3B,0xF6,0x7E,0x7D,0x8A,
+	0xC1,0x51,0x80,0xE5,0x73,0x6C,0xD6,0x8F,0x40,0xB4,0x27,
+	0xE3,0x2F,0x66,0x90,0x8A,0x11,0x62,0x4F,0xAD,0x4C,0xAD,
+	0xEE,0xCE,0x32,0x36,0x06,0x30,0x53,0x37,0x33,0xA7,0x5E,
+	0x33,0x36,0x30,0xF3,0x92,0xFD,0x3C,0xE4,0xD7,0xB8,0xAB,
+	0x73,0x71,0xE3,0xDF,0x71,0xA6,0x6B,0x9C,0x43,0x2E,0x93,
+	0xCB,0xBC,0xAF,0xE1,0x68,0x18,0xA4,0x40,0x2E,0xAC,0xE6,
+	0xFD,0xDD,0x43,0xD3,0x5D,0xDE,0x51,0xAE,0x1F,0x4F,0x24,
+	0x29,0x16,0x33,0x49,0xBF,0x8B,0x3B,0x4C,0x72,0x04,0x25,
+	0x93,0xD0,0xBF,0x8D,0x24,0xDE,0x38,0xE2,0x37,0x98,0x96,
+	0x14,0x26,0x78,0xE9,0xC2,0x90,0x81,0xC4,0xD8,0x02,0x46,
+	0xA6,0xD8,0xF1,0xCE,0xAE,0x7B,0x43,0x62,0xA0,0x07,0x41,
+	0xC2,0xA2,0x57,0xDF,0x88,0xC0,0x7B,0xB9,0xCD,0x7B,0xA9,
+	0x41,0x2E,0xE4,0x95,0x2D,0xA8,0xEE,0x1B,0x16,0x45,0x28,
+	0xAE,0xFB,0xC4,0xCF,0x49,0xAF,0x7B,0xEB,0xD8,0x35,0x2F,
+	0xCC,0xD2,0x7B,0xC2,0xE6,0x7E,0x6E,0x64,0x24,0x94,0x50,
+	0x0C,0xB9,0x0F,0xDC,0xA1,0x73,0x83,0xE1,0x9C,0x9C,0x66,
+	0x4D,0xE0,0x2F,0x1E,0xD6,0xED,0xF8,0xF9,0x50,0x2D,0x00,
+	0xD7,0x74,0x75,0xBB,0xE8,0xB3,0xEF,0x43,0x40,0xB8,0xE2,
+	0xC7,0x09,0x6D,0x87,0x8C,0x26,0xAB,0x9A,0xE2,0xFA,0xDC,
+	0x87,0xCB,0xD4,0xE4,0x42,0x53,0xFB,0x0E,0x23,0xC8,0x9C,
+	0x1A,0x44,0xAD,0xE4,0xFE,0x50,0xA0,0xB0,0x63,0x43,0xFA,
+	0x50,0x31,0x01,0xE6,0x36,0x7E,0x71,0x33,0x0E,0xAB,0x12,
+	0x08,0x0A,0x8E,0x13,0x55,0xCD,0x2A,0x4C,0x81,0x0C,0x15,
+	0x4A,0xE0,0x0B,0x43,0x67,0x95,0x42,0xFD,0xDE,0xBE,0xB7,
+	0xA6,0xCF,0x78,0x58,0x82,0x8F,0x93,0x08,0x72,0xC7,0x6C,
+	0x93,0xC5,0xAF,0x54,0x70,0x66,0xA1,0xE9,0xD8,0xB2,0x35,
+	0x4D,0xB2,0x58,0x42,0x77,0x7E,0x79,0x60,0xCA,0x00,0x4E,
+	0x15,0xE9,0x2C,0xD6,0x36,0x9A,0xDB,0xA5,0xFF,0x61,0xC6,
+	0xFC,0xDA,0x95,0x62,0x16,0x41,0x7E,0x8A,0x31,0xC5,0x5E,
+	0x08,0x7E,0xFC,0xC5,0xAB,0x07,0x1B,0x46,0x18,0xAC,0xEA,
+	0x51,0x37,0x3A,0x84,0xD8,0x4B,0xB7,0x86,0xA0,0x10,0x71,
+	0x1E,0xC1,0x38,0xB4,0xDD,0xEF,0xEF,0x81,0x81,0x72,0x3A,
+	0x44,0x0E,0xD8,0x76,0x07,0x97,0x63,0x9C,0x9F,0x50,0xF2,
+	0xBC,0x27,0xF2,0x8D,0x39,0x70,0x29,0x91,0xC6,0xD7,0xD4,
+	0x7C,0xF9,0xF2,0x98,0x9E,0x9B,0x9F,0x79,0xA1,0x43,0x0D,
+	0xFF,0x7A,0xAF,0xF9,0x50,0xA0,0x11,0x79,0x48,0xFE,0x8B,
+	0xB0,0xB0,0x00,0xA5,0x56,0x2A,0xAF,0x90,0x18,0xAE,0x48,
+	0xF5,0x0B,0x54,0x4A,0xFA,0xF5,0x12,0xAC,0xF7,0xE0,0xB5,
+	0x5D,0x80,0x00,0x67,0xE5,0xA0,0x5E,0xDB,0x45,0x4C,0x2D,
+	0x06,0x42,0xD9,0x34,0x7F,0xE1,0xEE,0x46,0xE1,0x09,0x7C,
+	0x64,0xBC,0xDE,0x24,0x69,0x7A,0xF6,0x50,0x28,0x3D,0xF0,
+	0x37,0x2A,0x45,0xD2,0x27,0x67,0x23,0x1F,0xFA,0x99,0x4F,
+	0x6F,0x4C,0xF6,0x38,0xD0,0x36,0x5C,0xE9,0x4E,0xB5,0xD6,
+	0x60,0x53,0x0E,0x37,0x4C,0xF8,0x6B,0x8A,0x2E,0x7A,0x95,
+	0xBF,0xA4,0x89,0xF4,0x7E,0x11,0x3C,0x54,0x10,0x5F,0xB1,
+	0x81,0xA1,0x7C,0x3D,0xA8,0x8D,0x76,0xCE,0x04,0xA9,0x4C,
+	0x28,0x09,0x8A,0xE4,0xFF,0x14,0x3C,0x05,0xB2,0x9C,0x28,
+	0xE4,0x5F,0xB4,0x5B,0x66,0xEA,0x75,0xFA,0xCC,0x5E,0x82,
+	0xF9,0xD8,0x65,0x4E,0x21,0x84,0x0D,0xA9,0x7A,0x22,0x66,
+	0x6A,0x46,0x9A,0xC5,0xDC,0x85,0xF6,0xF4,0x80,0x00,0xAE,
+	0xD0,0xCE,0xD5,0x98,0x7F,0x08,0xCE,0xA8,0x1E,0x75,0xA3,
+	0xB1,0xA4,0x2D,0x54,0x0A,0x54,0xEB,0x3E,0xAB,0xA2,0x2E,
+	0xF1,0xE2,0xF9,0x70,0xD2,0xC4,0xB4,0xD4,0xC9,0x8D,0xE8,
+	0xE3,0x28,0xA2,0xC8,0x40,0x29,0x1E,0x19,0x18,0x5C,0xB8,
+	0xD0,0x53,0x59,0x9E,0x57,0x1D,0xBA,0xB7,0x36,0xB1,0x06,
+	0x7D,0x3E,0xBD,0x0E,0x1E,0xA8,0x5C,0xE4,0x00,0x4F,0x3F,
+	0x15,0x60,0xCB,0xAF,0xE8,0x31,0x2F,0xC2,0x3E,0x74,0x38,
+	0x82,0xA7,0x13,0x66,0x1C,0xF1,0x25,0x6B,0x12,0x67,0xE7,
+	0xD2,0xC2,0xE7,0xE4,0x32,0x4D,0x17,0x1C,0x0F,0x2F,0x14,
+	0x9D,0xCF,0x5D,0x79,0xCE,0x00,0x4C,0xBC,0x52,0x27,0x99,
+	0x97,0xBC,0x5C,0xCB,0x9F,0xBE,0x84,0xB5,0x71,0x6B,0xCB,
+	0x27,0x8E,0x8D,0xF9,0x99,0x97,0x0A,0x7E,0x4A,0xE2,0x21,
+	0xE1,0xDC,0x5E,0xF4,0xE8,0xB4,0x64,0x49,0xD2,0xD7,0xE2,
+	0x57,0x18,0x3B,0x59,0x5C,0x6C,0xF2,0x86,0x39,0x1D,0x56,
+	0x2C,0x0A,0xDF,0x3F,0x4C,0x0A,0x2A,0xFE,0x06,0x93,0x14,
+	0xCD,0x76,0xAF,0xB7,0x07,0x24,0x48,0x35,0x5C,0x58,0xDC,
+	0xCD,0xFF,0x99,0x3F,0x7B,0xAB,0xE3,0x85,0x15,0x5F,0x79,
+	0x60,0x1F,0x7C,0x37,0xC9,0x9C,0x89,0x85,0xF5,0xFF,0xED,
+	0xFF,0xE2,0xCF,0xE4,0x6A,0xE1,0xA0,0xD7,0xDD,0xE5,0x88,
+	0xFD,0x72,0x4D,0xCE,0x12,0x58,0xD5,0x06,0xB4,0x52,0xF9,
+	0x8D,0xC9,0xFA,0xBB,0xC6,0xDF,0x68,0xAF,0x7A,0x2C,0x4D,
+	0xE3,0x86,0x48,0x1B,0x07,0x71,0x21,0x7D,0xC4,0x06,0xA5,
+	0xAF,0xB5,0x61,0x12,0xAE,0x0C,0x6D,0xAC,0x1E,0xC9,0xFB,
+	0x83,0xC7,0xF0,0x17,0xD8,0xCD,0x12,0x13,0x8E,0x56,0xE0,
+	0x0B,0xF3,0xC5,0xFF,0x36,0x55,0x58,0x49,0xEB,0xCB,0x03,
+	0x85,0xF8,0x49,0xC7,0xF3,0x6B,0x1F,0xCF,0x27,0xE7,0xAD,
+	0xBC,0x04,0x11,0x12,0x9E,0xAF,0xFC,0xA3,0x6D,0x03,0x75,
+	0xE5,0x00,0xE7,0xF1,0xC5,0x53,0xCB,0xC5,0x29,0x6C,0xC2,
+	0x0C,0x98,0xB0,0x5F,0xBB,0x6C,0x52,0x77,0x16,0x50,0x9B,
+	0xA0,0x55,0x97,0x0B,0x40,0x62,0xF9,0x50,0xF4,0x8F,0xE8,
+	0xA7,0xDF,0xDC,0x99,0x38,0xF7,0x31,0xA8,0xFC,0x99,0x3C,
+	0x89,0x3F,0x71,0x7A,0x1B,0x3E,0x31,0x53,0x87,0xA3,0x04,
+	0x2C,0x6C,0x46,0xA7,0x44,0x79,0x06,0x73,0xF4,0x1F,0x16,
+	0x5E,0xB7,0xE4,0x08,0xF1,0x35,0xF9,0xE3,0x2D,0xAF,0x6D,
+	0x7A,0xA5,0xD0,0x4C,0xA0,0x04,0xC4,0xCF,0xC9,0xEF,0x7C,
+	0xE3,0x37,0x72,0x57,0x20,0xAD,0x76,0x51,0xA2,0xEE,0x9C,
+	0x9A,0x03,0xE0,0x12,0x00,0xB4,0xB8,0xF6,0x1C,0x8A,0x79,
+	0xC7,0x7A,0x91,0x7B,0x6B,0xAE,0x62,0x3E,0x5A,0xA2,0x0F,
+	0xEA,0x45,0x67,0x27,0x45,0x24,0xE0,0xAC,0x54,0x54,0x70,
+	0x57,0xD4,0x12,0x12,0x77,0xD2,0x92,0x4E,0x9E,0x80,0x24,
+	0x04,0x68,0x1A,0x18,0xB0,0x35,0x70,0x96,0x09,0x49,0xE4,
+	0xF0,0x78,0x76,0x14,0xCE,0x3E,0x9E,0x46,0xC6,0x03,0xD8,
+	0x2E,0x74,0x32,0x19,0x97,0x98,0x70,0x32,0x01,0x15,0x9D,
+	0x84,0x63,0x87,0x53,0xA9,0x27,0x4F,0xC4,0x53,0xA2,0xD5,
+	0xB9,0x90,0xD6,0x47,0x27,0x93,0x4F,0x46,0x45,0xE3,0x3A,
+	0xF8,0x93,0xD4,0x3B,0xB9,0x2C,0x22,0x3A,0xE3,0x61,0x94,
+	0x70,0xAA,0x32,0x3A,0xF3,0x44,0x52,0x38,0x05,0xC7,0xC2,
+	0x53,0x74,0xC2,0xC2,0x83,0xA3,0x13,0xE2,0x1F,0x8B,0xD3,
+	0xA2,0x81,0x21,0xB7,0xC7,0x7C,0xB8,0xE1,0x72,0x7D,0x54,
+	0x90,0x97,0xC7,0x4B,0x6F,0x9B,0x16,0x45,0x97,0x67,0x58,
+	0x0B,0x27,0xCF,0x21,0x84,0xB0,0xAD,0x18,0xC5,0x3A,0x14,
+	0xC5,0x76,0x72,0xF5,0x0D,0xD5,0xB1,0xB5,0x0C,0x4D,0x10,
+	0xF4,0xD2,0x24,0xA4,0xE3,0x44,0x38,0x0F,0x2C,0x2C,0x5D,
+	0x3D,0xBC,0x04,0x38,0x36,0x9D,0x2D,0x3D,0xB8,0xB9,0xAD,
+	0xEC,0x0E,0x6C,0xAC,0x1C,0x6D,0xFC,0x42,0xC8,0x16,0xFC,
+	0xF2,0xAE,0x8B,0xC6,0x1E,0x9E,0x17,0x91,0xD6,0x36,0x4E,
+	0x73,0xA1,0x2E,0xB0,0x79,0x6E,0x5B,0x1C,0xF8,0x80,0xE8,
+	0x64,0x61,0x1B,0x5A,0x90,0x61,0xE5,0xE5,0xEA,0x51,0x8C,
+	0xA6,0x58,0x2A,0x84,0xE1,0x92,0x9D,0x39,0x67,0x5C,0xB9,
+	0x25,0x3C,0x6C,0x66,0x0B,0x5D,0x39,0x28,0x26,0x5E,0xBD,
+	0xE7,0x5D,0xFC,0xC1,0x64,0x2B,0x01,0x05,0x1F,0x1B,0x4A,
+	0xAA,0xFD,0x12,0xB7,0x0E,0x40,0x17,0xB0,0x34,0xE1,0x6B,
+	0xA0,0x7B,0x00,0xB6,0x84,0x34,0xE9,0x4B,0xB4,0x58,0x4B,
+	0xB5,0xFA,0xF9,0x05,0xD2,0x5D,0x12,0x2A,0xBC,0xE3,0xE3,
+	0x38,0x69,0x29,0xB3,0xF1,0x38,0x84,0x2A,0x40,0x08,0x90,
+	0x8E,0xD5,0x42,0xA0,0x09,0xA7,0x6D,0xF8,0xF4,0x15,0xDB,
+	0x02,0x9B,0xA2,0x78,0xD4,0x5D,0xBC,0x66,0x88,0x9E,0xAA,
+	0x67,0xB4,0xB5,0xA2,0x1B,0x25,0x11,0x0A,0x9A,0x04,0x23,
+	0x5D,0x8E,0x74,0xB7,0x30,0x70,0x2B,0x81,0x7B,0x56,0x51,
+	0x55,0x52,0x26,0x9C,0xDC,0x2A,0xB9,0x18,0x8B,0x4B,0x8C,
+	0x38,0x8A,0xD2,0xD4,0x66,0x70,0xA7,0x69,0x12,0xD4,0x2A,
+	0x43,0xF7,0xB0,0x66,0x91,0x5E,0xA4,0xD4,0x70,0xE9,0x42,
+	0xE0,0x9A,0x34,0x2E,0xF9,0x34,0x85,0xCE,0x2B,0x92,0xA8,
+	0x9B,0xC2,0x16,0x89,0x89,0x3A,0x49,0x8D,0xEB,0xC0,0x73,
+	0x9D,0x5C,0x12,0x8A,0x39,0x49,0xFE,0x21,0x48,0xC5,0x89,
+	0x38,0x2E,0x19,0x24,0xC4,0xE0,0xF4,0xAE,0xC5,0x9F,0x98,
+	0x8B,0xC6,0x03,0xF4,0xCA,0x5D,0x13,0x45,0x6A,0x35,0x6F,
+	0x0E,0xE3,0xBC,0x1A,0x38,0x43,0x83,0x05,0x3C,0x5F,0x39,
+	0x5B,0xE8,0xC1,0xAE,0xCD,0xD9,0xFB,0xE4,0xEA,0x25,0x20,
+	0xDD,0xE6,0xC2,0x93,0x64,0x5F,0xC9,0xC7,0xD3,0xE7,0x28,
+	0x11,0x4A,0x23,0x8E,0x6C,0x9C,0xA2,0xA6,0x9A,0x8E,0x12,
+	0xD5,0xDD,0x15,0x11,0x6C,0xEF,0x1A,0xC0,0x36,0xC9,0x68,
+	0x45,0x7A,0x1F,0x02,0xAC,0x9C,0x6C,0x2C,0x7A,0x90,0x2E,
+	0x01,0x19,0x51,0xC1,0xD4,0xE4,0xE8,0x7C,0x6F,0x52,0x7B,
+	0xB8,0x4F,0x13,0xFC,0x4B,0xEC,0xE7,0x14,0x92,0x81,0x86,
+	0x5B,0x7D,0x81,0xF9,0xFA,0x9A,0x95,0xB7,0x94,0xD9,0x1C,
+	0xC7,0xCE,0xD5,0xC6,0x8D,0xFF,0xCA,0x3E,0xFD,0xB6,0x81,
+	0x31,0xBD,0x9D,0x3F,0x74,0x0E,0x88,0x15,0xBA,0x75,0x14,
+	0x3B,0x43,0x77,0xED,0x5D,0x88,0xDD,0xF7,0x10,0x54,0x30,
+	0x22,0x44,0x4B,0xEF,0xAB,0xB5,0xFD,0x1A,0xD1,0x1F,0xB0,
+	0xB9,0x08,0xF1,0x89,0xD3,0x54,0x48,0xB0,0x07,0xC7,0x73,
+	0xB9,0x03,0x34,0x76,0x12,0x3C,0x14,0xC4,0x58,0xC3,0x27,
+	0x3C,0x5F,0xA0,0x8C,0x02,0x11,0x7A,0x90,0x79,0xAF,0x44,
+	0xEF,0x4E,0x4F,0x98,0xAF,0x45,0x5C,0x6C,0x12,0xD9,0x53,
+	0x61,0xC7,0x0F,0x30,0xFE,0xC5,0x73,0xCE,0xCD,0x42,0x58,
+	0x34,0xC3,0x33,0x2D,0x61,0x34,0x3C,0x15,0xF7,0xD8,0x26,
+	0x32,0x7C,0x3C,0x50,0x1E,0x24,0x04,0x20,0xEA,0x00,0xFA,
+	0x55,0x17,0xD1,0x6E,0x7E,0x8F,0x55,0x95,0x3B,0xF9,0xB4,
+	0x95,0x1E,0x59,0xFC,0xCD,0x8E,0x41,0x26,0x9E,0xA0,0x0E,
+	0xF8,0x47,0x9F,0x0D,0xD0,0x8C,0xAC,0x73,0xC6,0x84,0xC8,
+	0xB0,0x80,0x44,0xD1,0x2E,0x00,0x4E,0x6E,0xA6,0x02,0x90,
+	0x9C,0x26,0xE1,0xA1,0xD3,0x43,0xBF,0x7C,0xB2,0x45,0x3C,
+	0xB1,0xDC,0x02,0x6A,0xDC,0x71,0x9A,0x48,0x5D,0xBA,0x11,
+	0x79,0x32,0x66,0x57,0x26,0xDD,0x67,0x4C,0x5F,0xD6,0xE1,
+	0xA0,0x82,0xB3,0xC2,0x04,0x91,0xFA,0x22,0x71,0xDE,0x83,
+	0x62,0x48,0x4E,0x33,0x83,0xC9,0xE8,0xAD,0xC9,0x91,0x8F,
+	0xA3,0x94,0x70,0x14,0x3A,0x95,0xB6,0xB2,0x4E,0x92,0x0B,
+	0x8C,0xD0,0xD1,0xF0,0x39,0xD5,0x2C,0x2D,0x44,0x63,0x15,
+	0x45,0x1F,0x04,0x38,0xF0,0x6B,0x28,0x8B,0xF9,0x3C,0x10,
+	0x3F,0xC7,0x1F,0x6D,0x47,0xA0,0x8A,0x9D,0x51,0xC5,0xA5,
+	0x35,0xC2,0x9C,0x66,0x2F,0x0F,0xA7,0xF5,0x8B,0xDA,0xC8,
+	0x23,0x35,0xD3,0xEF,0x20,0x77,0x6F,0x58,0xBB,0xC6,0x9A,
+	0x9A,0x17,0x24,0x27,0xD0,0xEC,0xC3,0x59,0x57,0xF3,0x1C,
+	0x8D,0x35,0xD6,0x58,0x0F,0x77,0x91,0x4E,0xEB,0x9F,0x4F,
+	0x46,0x72,0x7A,0xC8,0x0A,0x7C,0x7B,0x3D,0xA6,0x8A,0x69,
+	0x0C,0xD3,0x11,0xB5,0x3D,0xE9,0x02,0xF7,0x01,0x79,0x37,
+	0x9B,0xDC,0x21,0x7D,0xD4,0x8D,0x22,0xDC,0x8D,0x4E,0xC1,
+	0x28,0x19,0xA5,0x29,0xFB,0x99,0x63,0x1E,0x9F,0x8F,0x97,
+	0x4F,0x8A,0x9C,0x57,0x4F,0xCC,0xC6,0x75,0x9A,0x87,0x5B,
+	0x47,0xC7,0x58,0x9F,0x3D,0x37,0x66,0x03,0x43,0x6A,0x78,
+	0x4D,0xA1,0x9B,0x4D,0xFC,0xD5,0x40,0xD7,0x85,0x38,0xCA,
+	0x9A,0x23,0xB2,0x4F,0xEB,0xD0,0x9C,0x2E,0x39,0x52,0x91,
+	0xAF,0x8D,0x79,0xA8,0x0E,0x12,0x5D,0xC4,0x93,0xA9,0xDB,
+	0x70,0xED,0x69,0x88,0xE5,0x5B,0x23,0x4F,0x9A,0x3E,0xD1,
+	0xB2,0x8D,0x20,0x27,0xE5,0x89,0x44,0x48,0x43,0x54,0xFB,
+	0xF4,0x34,0xB5,0xBA,0x67,0x85,0x10,0xBB,0xDD,0x62,0x7C,
+	0xCD,0x42,0xD7,0x01,0xC6,0x81,0xFF,0x4C,0x29,0x58,0xD2,
+	0x83,0x8C,0x34,0x4F,0xEA,0x70,0xF8,0xCB,0xDA,0xB4,0xC0,
+	0x2A,0x23,0x92,0xD4,0xEB,0xD0,0x70,0x19,0xB5,0xA1,0xE4,
+	0x1E,0x5C,0xCA,0xB2,0x34,0x09,0xA7,0xA0,0xD6,0xAE,0xD0,
+	0xFC,0xAC,0x47,0x41,0x5D,0x81,0x81,0x37,0x56,0x30,0x54,
+	0x70,0xB2,0xA9,0x4A,0x79,0x83,0x95,0x00,0x97,0xAB,0xCA,
+	0xE5,0x8B,0xE0,0x9C,0xAE,0x88,0xF3,0xD5,0xD2,0x4B,0x2C,
+	0x05,0x9A,0x15,0x5B,0xCA,0x55,0x2F,0xA5,0x38,0x5C,0xBE,
+	0xA8,0x8D,0xD0,0xCC,0xAE,0xC6,0x45,0x20,0xD3,0x27,0x49,
+	0x83,0x7E,0xBA,0x91,0xD0,0x39,0x6B,0xA8,0xC3,0x5A,0x78,
+	0x54,0x1A,0x97,0x46,0x79,0x15,0xEA,0x93,0xCF,0xA0,0x0F,
+	0x0A,0x1E,0x54,0xFD,0x79,0x7F,0xEF,0xCE,0x89,0x4A,0x5D,
+	0x04,0x45,0x26,0x72,0x45,0xCB,0xBC,0xFF,0xE5,0xA2,0x70,
+	0x78,0x04,0x39,0xCF,0x3A,0xD6,0x8D,0xBF,0xB9,0x0E,0x5F,
+	0xF3,0xEF,0xA3,0x88,0x8A,0x24,0x27,0x47,0x64,0x8D,0x74,
+	0x38,0x4F,0xB1,0xAF,0x5E,0x7D,0xFE,0x54,0x8C,0xFF,0xB3,
+	0xF2,0x3C,0x1F,0x3D,0xAB,0xB1,0x10,0xDA,0x25,0x8D,0x67,
+	0xE1,0x94,0xA6,0x17,0x6F,0xA1,0xBA,0xA4,0xE6,0xA7,0x4D,
+	0x14,0x48,0xEA,0x6D,0xB9,0x57,0x9D,0x89,0x34,0xC1,0xEE,
+	0x0E,0x2A,0x6D,0x04,0x3D,0x44,0x05,0x0A,0xBA,0xF7,0x96,
+	0x01,0x0C,0x00,0x74,0x80,0x51,0x76,0xE5,0x63,0x4F,0xA1,
+	0xBB,0x0E,0x62,0x08,0xC5,0x6C,0x77,0xE5,0x2D,0x7F,0xDE,
+	0x66,0x69,0x3B,0x51,0xE9,0x5A,0xC4,0x8C,0x4C,0x73,0x5A,
+	0x25,0x4A,0xDC,0x28,0x37,0xAD,0x50,0x1F,0xF3,0x89,0x1D,
+	0xB9,0xC5,0x19,0xB3,0x10,0x3E,0x48,0x76,0x63,0x30,0xC8,
+	0x54,0x99,0x30,0x47,0x8B,0x87,0x0A,0x2A,0x3E,0x32,0x98,
+	0x66,0x1A,0xEE,0x63,0x45,0x5C,0x73,0x88,0xF4,0xC4,0xA6,
+	0x82,0x2F,0x8E,0x3F,0xFA,0x20,0x3E,0x18,0xC7,0xCF,0x48,
+	0xB6,0xF2,0x80,0xD8,0x41,0x8A,0xEB,0xB3,0x83,0xB1,0x6A,
+	0xBB,0xB6,0x03,0x2A,0xAE,0xC0,0xB0,0x60,0x6B,0xC6,0xAE,
+	0x54,0x07,0x46,0xE4,0x46,0x46,0xAE,0x2F,0xEC,0x4E,0xDF,
+	0x8C,0xBF,0x79,0x98,0xF1,0xDF,0xCD,0x10,0x5C,0xA9,0xBD,
+	0x05,0xB6,0xFF,0x64,0x0E,0xE4,0x5C,0x21,0x04,0x8D,0xB8,
+	0x83,0x6E,0x80,0x74,0x68,0x44,0xBD,0x7A,0x93,0xC2,0x0B,
+	0x9B,0x4B,0x48,0x14,0xE3,0xBE,0x40,0x43,0x46,0x0A,0x5D,
+	0x4B,0x94,0xFE,0xB3,0x8B,0x7F,0x9B,0x74,0x40,0x13,0x4C,
+	0x11,0x79,0xB0,0x23,0x20,0x45,0xB1,0x6E,0xB6,0x06,0x51,
+	0x88,0xFD,0x0F,0xA3,0xA5,0x9A,0x01,0xB8,0x67,0x5F,0xEC,
+	0x3D,0x1D,0x8B,0xD1,0x48,0x98,0xCF,0x8C,0x3C,0xF5,0x26,
+	0x0E,0xD0,0xD4,0xFA,0x50,0xFB,0x89,0xB9,0x5E,0x90,0x9C,
+	0x9A,0x56,0xBB,0x46,0x60,0x05,0xE0,0x87,0x9C,0x8E,0x00,
+	0x45,0xC2,0xF7,0xD3,0x4F,0xDA,0xA9,0x64,0xCB,0x34,0x43,
+	0xEC,0xBC,0x25,0x2A,0x3C,0x01,0x69,0x83,0xC7,0x7D,0xF4,
+	0x88,0x7E,0x5E,0x47,0x8D,0x4F,0x8B,0x9A,0x71,0x42,0xA2,
+	0x4C,0x45,0x0D,0x39,0xAE,0xDA,0x80,0xA6,0x95,0x9F,0xBF,
+	0xA0,0xAE,0x66,0xDC,0xC4,0x87,0x7F,0x1B,0x1D,0xA2,0x50,
+	0x12,0x0C,0x9E,0xE3,0xF1,0xEA,0x97,0xFC,0xC2,0xF0,0x89,
+	0xD1,0x3B,0xD7,0xA8,0xAB,0xA7,0xAF,0xE4,0x51,0x12,0xBB,
+	0xE9,0xBA,0x17,0x95,0xCC,0x70,0x81,0x67,0xD5,0x5D,0xA0,
+	0xC1,0xBF,0x15,0x33,0xFE,0x26,0xAA,0xC9,0xA4,0x31,0x95,
+	0xD7,0x95,0xF1,0x5B,0xE4,0xC4,0x48,0xAE,0x7A,0x8A,0xA5,
+	0x5F,0x98,0x26,0x21,0x9A,0xFA,0x40,0x38,0x00,0xF9,0x36,
+	0x37,0x66,0x82,0x07,0x79,0x78,0x41,0xB0,0x33,0x52,0x87,
+	0x6A,0x18,0x11,0xF4,0x4C,0x6F,0xD7,0x93,0x68,0xDA,0x2E,
+	0xBA,0xE9,0xAE,0x5E,0x2F,0x7E,0x2E,0xE9,0x19,0xFD,0xE5,
+	0xE0,0xD3,0xE9,0x65,0x83,0xB9,0xA4,0xEA,0xFE,0x57,0xC3,
+	0x47,0x4F,0x9E,0x0F,0xD9,0xC4,0x5F,0xE9,0xB0,0x88,0x06,
+	0xDE,0xD3,0x1C,0xF0,0xEE,0x15,0x90,0x0B,0x7B,0x66,0x38,
+	0x20,0xF7,0xE4,0xDA,0xEC,0xE7,0x2F,0xAB,0x9E,0x12,0x4C,
+	0x75,0xD9,0x0B,0x96,0xF2,0xFC,0x4B,0x7E,0x81,0xFF,0x7E,
+	0x25,0x88,0x07,0x1D,0x57,0xE3,0x9C,0x2C,0x2D,0xC0,0xB6,
+	0x6A,0x05,0x5B,0x51,0xD9,0x38,0x1F,0x9C,0x16,0xB9,0x25,
+	0x78,0x88,0x0C,0xAC,0x04,0xAD,0x1C,0xBB,0x20,0x79,0x6A,
+	0x44,0xBE,0x9A,0xFD,0x0B,0x54,0xDD,0xD3,0xD4,0xD0,0x08,
+	0xE6,0xAE,0xAB,0xBC,0xB6,0x37,0x7D,0x3E,0x0B,0x77,0x05,
+	0x6A,0x68,0x7C,0x46,0xC9,0xF4,0xAA,0x64,0x58,0xB1,0x93,
+	0xF8,0x07,0x5E,0xD3,0x13,0x32,0xA6,0xEB,0xDC,0x2E,0x04,
+	0x19,0x44,0x4B,0x26,0xDD,0x2D,0xBC,0x22,0xAB,0xC5,0x9E,
+	0x37,0x42,0xC3,0xBE,0x03,0x40,0x1C,0xB3,0x9F,0x2B,0x02,
+	0xFF,0x01,0xF9,0xB9,0xE6,0xB0,0xAF,0x56,0x79,0xE5,0x82,
+	0xE4,0xF2,0x97,0x5D,0x9F,0xA9,0x56,0x0F,0x42,0x45,0x26,
+	0x70,0x83,0x80,0xCB,0xB5,0x29,0x7B,0x97,0xD7,0x0A,0xEF,
+	0x06,0x1A,0xA9,0x3A,0x9C,0xBF,0x10,0xE1,0x58,0x91,0xE0,
+	0x31,0x37,0x48,0x1D,0x21,0x3B,0x5B,0x53,0x3F,0xA6,0xA8,
+	0x55,0x00,0xE6,0x2D,0x74,0x12,0x24,0xEA,0x99,0x39,0x64,
+	0xCB,0x5B,0xB6,0x29,0xD9,0x94,0xA1,0x57,0xAF,0x2C,0xC0,
+	0xB9,0xA3,0xC9,0xEA,0xD6,0x5D,0xAD,0x28,0x0B,0x9C,0x9E,
+	0x4C,0xAC,0xC0,0xA9,0x08,0xED,0xC6,0xB8,0x5D,0x09,0xB9,
+	0xC6,0x83,0xB3,0x50,0x92,0xE7,0x3A,0x45,0x14,0xAB,0x1D,
+	0x21,0x1C,0x5C,0x30,0xBA,0x89,0x28,0xC0,0x4E,0x97,0x67,
+	0x09,0x25,0x9B,0xB4,0x36,0xB7,0xE8,0x9D,0xF3,0x37,0x56,
+	0x58,0x32,0x6D,0x9B,0x7E,0x50,0xD6,0x5C,0xDF,0x43,0x95,
+	0x73,0x76,0x6E,0xC5,0x6D,0xFB,0xDA,0x7B,0xD9,0xD5,0x9E,
+	0x15,0xCE,0x9E,0x3E,0x2F,0x45,0x97,0xBE,0x7E,0x4A,0x56,
+	0x9E,0xD3,0x71,0xE6,0x54,0xF8,0x2F,0x9D,0x4A,0x3B,0xA5,
+	0x1D,0x68,0xA9,0x29,0x41,0x1A,0x0A,0x7A,0x03,0x93,0x57,
+	0xBF,0x01,0x09,0x89,0x19,0xFA,0x17,0x67,0xBF,0x5B,0x97,
+	0x0E,0xDC,0x0B,0x34,0xB4,0x25,0x66,0xDC,0x56,0x87,0x49,
+	0xF8,0x63,0xB4,0x74,0x73,0x97,0xBA,0x24,0x2D,0x11,0xCD,
+	0x92,0xD5,0x67,0x4A,0xC0,0xCE,0xF5,0xD1,0x8E,0x81,0x4E,
+	0x76,0x71,0x76,0xA8,0xD2,0x41,0x62,0x8B,0xD1,0xA4,0x89,
+	0x6E,0x33,0xB2,0xEF,0xA7,0xA2,0xB3,0x88,0x47,0xB1,0xF3,
+	0x43,0xCB,0x03,0xC6,0x07,0x50,0x64,0x4F,0x41,0x94,0x52,
+	0xE2,0xB1,0x4A,0xB4,0xD9,0xCD,0x90,0x27,0x77,0xD3,0x95,
+	0xA3,0x81,0xE0,0xEA,0xC6,0xA6,0xA5,0x80,0xE9,0xE9,0xE0,
+	0x96,0xD9,0x90,0x87,0xD8,0xCB,0x8B,0x04,0xCB,0x54,0x3E,
+	0x4B,0x25,0xB2,0x34,0x04,0xA3,0x9F,0x11,0x6C,0xEF,0xE9,
+	0x9F,0x4D,0x90,0x7E,0x52,0x1D,0x6D,0xD8,0x4A,0x30,0xD7,
+	0x6F,0x81,0x37,0x87,0x25,0x38,0x59,0xE4,0xA9,0x0B,0x91,
+	0x1B,0x12,0x42,0x4E,0xE6,0x5C,0xED,0x8F,0x32,0x23,0xA7,
+	0xCE,0x98,0x05,0x79,0x8A,0xED,0xBE,0xFB,0x1A,0x49,0xC7,
+	0x3E,0x78,0x54,0x9E,0x4A,0xEC,0x4F,0xDB,0x52,0x75,0xA2,
+	0xE7,0x84,0x97,0x39,0xE5,0x44,0x40,0xF3,0x9C,0xF3,0x82,
+	0x91,0xBE,0x43,0xAE,0xC0,0x15,0x4A,0x4C,0xB1,0xBD,0x1D,
+	0x0F,0xF1,0x8E,0x5B,0xB8,0xAA,0x54,0xBE,0xD4,0x39,0x1D,
+	0xF4,0x06,0xE6,0xF0,0x9A,0xEA,0x40,0x42,0x18,0x49,0xDF,
+	0x8A,0x84,0x4E,0x29,0xA0,0x8E,0x30,0x83,0xEE,0xBF,0x51,
+	0x49,0x77,0x03,0x80,0x34,0x73,0xED,0xCE,0x48,0xEB,0x4A,
+	0xE7,0x94,0xF9,0x38,0x1F,0x50,0x31,0xBB,0xFB,0xA1,0x95,
+	0x58,0xCE,0x38,0x3A,0x2D,0x34,0x9B,0x2F,0xD1,0x79,0x05,
+	0x9E,0xF5,0xCB,0x33,0x25,0x3C,0xD1,0xDF,0xB6,0x66,0x3D,
+	0xCD,0xB6,0x63,0x33,0x69,0x50,0x67,0x9E,0x48,0x15,0xBB,
+	0xA4,0x1B,0x96,0x6D,0x17,0x36,0x46,0x1A,0x9E,0xE5,0x22,
+	0x0E,0x04,0x42,0xDA,0xA3,0xC8,0x4C,0x1E,0x63,0x82,0x71,
+	0x7B,0xB8,0xC0,0x87,0xB8,0x6F,0xE7,0x3E,0x92,0x4A,0x4F,
+	0xEF,0x05,0xA6,0xA7,0x1B,0xC8,0x1B,0x3A,0x46,0x85,0x8D,
+	0x2F,0xC3,0x41,0xFD,0x60,0x8F,0xD8,0xA6,0x97,0xC3,0xD5,
+	0xD2,0x5D,0x9F,0x44,0x1A,0xB3,0xE5,0x98,0x83,0x65,0x21,
+	0xE1,0xF6,0x39,0xFC,0x7E,0x88,0x97,0xA1,0xFA,0xE9,0x1A,
+	0x68,0x23,0x4F,0x47,0x30,0xD7,0x65,0xCD,0x74,0x37,0x15,
+	0x70,0x84,0x73,0x61,0x1E,0xC1,0xC5,0xEB,0xA7,0x57,0x34,
+	0xD5,0xEF,0xC6,0x27,0x86,0x6B,0x38,0x8F,0x71,0x42,0x84,
+	0xDA,0xB3,0x93,0x12,0x27,0x55,0x1F,0xA1,0x24,0x5C,0xD1,
+	0x0E,0x12,0x97,0xB1,0xE2,0xA9,0x8A,0x54,0x25,0x67,0x9C,
+	0x60,0x1C,0xF8,0x53,0xA9,0x8E,0x51,0xB0,0xFF,0x6E,0xA4,
+	0xAF,0x5A,0xB6,0xED,0xC5,0xB7,0x1C,0x18,0xA4,0xBA,0x97,
+	0xB0,0x6D,0xAB,0xC9,0xA4,0x0B,0xEC,0xB5,0x3D,0x55,0xE4,
+	0x5C,0xB9,0x1E,0xA9,0x6B,0x9B,0xA3,0xE4,0x14,0x3D,0xAE,
+	0x39,0x49,0xDA,0xAA,0xA8,0xB5,0xFB,0x14,0x55,0x11,0x3D,
+	0x94,0x37,0x56,0x47,0x1F,0x14,0x52,0xDA,0xE6,0x0E,0xB8,
+	0x90,0x7F,0x0F,0x80,0x43,0x75,0x21,0x01,0x97,0xA2,0xE4,
+	0x0A,0xA9,0xF6,0xF7,0xD3,0xFA,0x43,0x08,0x82,0x05,0x1F,
+	0x2C,0x52,0x81,0xC0,0xFC,0x30,0xFD,0x2F,0x0E,0x09,0x0D,
+	0x1A,0xDA,0x80,0xD4,0xDE,0xBB,0x21,0x0F,0xA9,0x75,0x68,
+	0x5B,0xA8,0x6B,0x1C,0x78,0xD4,0xAD,0x5F,0xFF,0xBB,0x32,
+	0xDD,0xEB,0xC9,0x03,0x15,0xCD,0x00,0xF0,0x0C,0x86,0x7A,
+	0xAD,0x36,0xB9,0x64,0x5B,0x44,0x2B,0x79,0xFE,0x2C,0x6F,
+	0x24,0xA9,0xC3,0x0C,0x4D,0x55,0x4B,0xE4,0xFD,0x5C,0x1F,
+	0xA2,0x24,0x9E,0xAB,0xC8,0xE5,0x2F,0x10,0x9E,0x90,0x16,
+	0x1C,0x07,0x87,0x9D,0x8A,0x3B,0x29,0xF2,0x82,0x0F,0x64,
+	0xFB,0x23,0x3E,0x9C,0x2E,0xDD,0x9D,0x24,0x74,0xDF,0x71,
+	0x98,0x4E,0x9D,0xE7,0xA0,0xE1,0xF3,0x0E,0x78,0xA8,0x74,
+	0xE7,0xF7,0x2A,0x19,0x5C,0x96,0x11,0x77,0xC1,0x3F,0x4E,
+	0x46,0x9C,0xCC,0x4F,0xB2,0x16,0x22,0x4A,0xFD,0x77,0x21,
+	0x9A,0xE8,0x8F,0xF8,0x23,0xAA,0xD2,0x94,0x16,0x82,0x1C,
+	0x73,0x0A,0x8A,0xAB,0xA7,0x50,0xE5,0xB4,0x66,0x84,0x9C,
+	0x55,0x4B,0x4C,0x13,0x7C,0xD5,0xBB,0xCD,0x07,0x84,0xC5,
+	0x30,0x5A,0x6E,0x9F,0x6A,0x83,0xFA,0x23,0x86,0x4C,0xE3,
+	0xBD,0xDE,0xB0,0xC8,0xCD,0x79,0x0A,0xC5,0x6D,0x22,0x78,
+	0xE2,0x8D,0x40,0xC1,0x55,0x40,0x70,0x08,0x63,0x10,0xA0,
+	0x8A,0x14,0x63,0x2D,0x51,0xF5,0xD2,0x6D,0xA8,0x91,0x9C,
+	0x01,0x11,0xEB,0xD6,0xDC,0xC3,0x34,0xE2,0xED,0x3F,0x5B,
+	0x11,0x61,0x25,0xDB,0x86,0x80,0x0A,0x60,0xC3,0xD1,0x00,
+	0x35,0xC8,0x10,0xCF,0xE7,0x00,0xCA,0x7E,0x15,0x08,0x8A,
+	0xE4,0xF7,0x79,0x33,0xE3,0x92,0xEA,0xDD,0x9C,0xD7,0xA1,
+	0x63,0x21,0xE3,0x4D,0x39,0x95,0xC3,0x1B,0xA3,0x38,0x82,
+	0x98,0x6B,0xD0,0x55,0x79,0xC0,0xCF,0xAB,0xD9,0x34,0xD5,
+	0xF9,0x8A,0x42,0x7F,0x27,0xD7,0x86,0xEC,0x83,0x1C,0x5B,
+	0x8E,0x3F,0x60,0x57,0x19,0xDB,0x74,0xFF,0xAE,0x00,0xD5,
+	0x0C,0xF0,0x3A,0x65,0x43,0x8D,0xDB,0x55,0x7D,0x3C,0x14,
+	0x2E,0x70,0x79,0xEF,0xDE,0xC7,0x49,0x2C,0xAA,0x49,0xE3,
+	0xC3,0x94,0xC0,0xFE,0x33,0x6A,0x2E,0xF2,0xC0,0xBC,0xB4,
+	0x76,0x35,0xD0,0x88,0x62,0x29,0x95,0x38,0xFA,0x15,0x17,
+	0xE9,0x24,0x33,0xA2,0x40,0x06,0x28,0xCE,0x38,0x06,0xA2,
+	0xC9,0xB8,0x50,0x86,0x7E,0xE0,0x4A,0x69,0xF6,0x6C,0x83,
+	0x55,0x4A,0xA2,0xB7,0x41,0x56,0xA2,0x3C,0x3F,0x31,0xB1,
+	0x76,0xFE,0x2B,0x99,0x23,0x5D,0x53,0x13,0x0F,0xB2,0x28,
+	0x7E,0x82,0x57,0xB3,0x9B,0x56,0xC3,0x97,0xD2,0xEF,0x22,
+	0x13,0x61,0xB2,0x1F,0x62,0x0C,0x8D,0xFE,0x34,0xAC,0xA0,
+	0xBF,0xFB,0xC6,0xEF,0xFD,0xD6,0xBD,0xEB,0xDB,0x2F,0x65,
+	0xD2,0xF8,0x14,0x75,0x2E,0x51,0x75,0x27,0x45,0xCD,0x34,
+	0xC2,0x3C,0xF4,0x7C,0x60,0x60,0x22,0x6F,0xD0,0xDF,0x60,
+	0xBC,0x5D,0xE1,0x6E,0x68,0x64,0x5A,0xE4,0xA2,0x62,0xBC,
+	0x52,0x2A,0x1E,0xF2,0x4F,0x90,0xFF,0xB9,0x5C,0xD2,0xB8,
+	0x48,0x69,0xB0,0xEA,0x4B,0xB9,0x0A,0x80,0x97,0xE2,0x1B,
+	0x5D,0xFB,0x6B,0x32,0xF7,0xD5,0x38,0x0E,0x4A,0xC4,0x6B,
+	0xF9,0x2A,0xD6,0x8B,0x8D,0xC3,0xBC,0xB8,0x0D,0xA1,0x35,
+	0xEA,0x25,0x5E,0xEE,0x32,0x96,0x56,0x2F,0x00,0x7E,0x61,
+	0x02,0xB8,0xC4,0x4A,0xD8,0xD9,0x87,0x25,0x36,0x4D,0x4A,
+	0xCA,0xF0,0xC1,0xBA,0x70,0x9E,0x44,0xD4,0x62,0x1D,0x35,
+	0x8D,0xB6,0x4B,0x09,0x99,0x7A,0xCB,0x1D,0x59,0xF2,0x09,
+	0x93,0x19,0x16,0x1E,0x57,0x3D,0x13,0x13,0x23,0xFE,0x06,
+	0x4F,0xF2,0xA9,0x52,0x16,0xBE,0xF5,0x54,0x81,0xD8,0x28,
+	0x7D,0xDD,0xCE,0x0A,0xAA,0x41,0x58,0x89,0x92,0xD5,0xD2,
+	0x8C,0x31,0x5B,0x17,0xD3,0x7F,0x49,0x6C,0x9A,0x2D,0x8D,
+	0xD0,0x19,0x4F,0x9D,0x76,0xF2,0xA4,0x45,0xB8,0x97,0x27,
+	0xFA,0x28,0x8D,0xF8,0x09,0x85,0xBD,0xC9,0xB4,0xFF,0x9F,
+	0xF9,0xC1,0x29,0x05,0xA4,0x8F,0x55,0x76,0x3C,0x4B,0x78,
+	0x20,0xE7,0xA1,0x40,0xE0,0xB4,0x9B,0x7E,0x58,0x33,0xBE,
+	0x52,0x4C,0x48,0xD5,0x89,0x83,0x24,0x6E,0x79,0x4A,0xC4,
+	0xF0,0xDF,0x13,0xC0,0x8A,0xB6,0xF4,0xD8,0xEE,0x9F,0x0F,
+	0x71,0x9F,0x6F,0x99,0x27,0x4A,0xCD,0xE2,0x43,0xAD,0x9B,
+	0x75,0xD4,0x3C,0xFE,0x13,0xAA,0x72,0x12,0x0B,0x5D,0x8F,
+	0xF8,0x9B,0x1D,0x34,0x9B,0xFD,0x90,0x5F,0x8E,0xA5,0x5D,
+	0xC3,0x13,0x3E,0xF8,0x02,0x20,0xA5,0x2D,0x72,0x03,0x8F,
+	0xF8,0x27,0x7A,0x56,0x08,0x5F,0xEA,0xAA,0x84,0x86,0x63,
+	0x82,0x64,0xA1,0xE5,0xF7,0x07,0x9D,0xD4,0xBE,0xD5,0x87,
+	0x39,0x43,0x73,0x31,0xF5,0x4E,0x96,0x23,0x8E,0xE7,0x7B,
+	0x41,0xF1,0x6A,0x97,0x95,0x9B,0x9D,0x27,0x6C,0xEA,0xC3,
+	0x2D,0x81,0x2B,0xB1,0x77,0x78,0x2F,0x5F,0x17,0xC0,0x03,
+	0x72,0x03,0x4E,0x79,0x87,0x10,0xF7,0x4F,0xC5,0xE8,0x5B,
+	0x62,0x15,0x7D,0x0A,0xCF,0x5D,0xF5,0x88,0xE4,0x99,0xF1,
+	0xB1,0x53,0xF7,0x8C,0xA6,0x4C,0xA4,0xC8,0x0F,0x96,0xB8,
+	0xCF,0xDA,0x92,0xE5,0xF0,0xD4,0xAA,0xC7,0x12,0x36,0x83,
+	0xB8,0xAB,0x49,0x0A,0xFA,0x0F,0xA2,0xB6,0x74,0xC3,0xEF,
+	0xAB,0xBD,0xBA,0x83,0xBC,0xA2,0x36,0x62,0x63,0xFF,0x2B,
+	0x97,0x4B,0x5C,0xE5,0x3C,0xD7,0xDF,0x42,0x82,0xB0,0x3F,
+	0xA4,0xB1,0x18,0x5A,0x24,0x8A,0xBA,0xA7,0x06,0x9B,0x40,
+	0x70,0xFE,0xC6,0x7B,0x5E,0x48,0x9D,0x48,0xC4,0x9D,0x38,
+	0x06,0xF8,0x80,0x0C,0xDD,0x9C,0x5A,0xBD,0x3E,0x32,0x9C,
+	0xE9,0xB8,0x70,0xA2,0xE2,0xDB,0xC7,0xAE,0x16,0xF6,0xCF,
+	0xEE,0x4C,0xA9,0xA5,0x76,0x8E,0x79,0xC6,0x03,0x52,0x8B,
+	0x70,0x89,0x37,0x2C,0x23,0xFD,0x4A,0xFE,0x92,0xA3,0x0D,
+	0xEB,0x00,0x57,0x33,0x21,0x76,0x1C,0xE1,0xE2,0x2B,0xEA,
+	0xCE,0xDD,0x89,0xB9,0xB2,0xE4,0x7B,0x30,0x37,0xBB,0x66,
+	0x39,0x14,0xAC,0x39,0x2C,0x4F,0xDF,0x35,0xBF,0x2B,0xDC,
+	0xC0,0xCE,0x19,0xC1,0xB8,0xE5,0xA8,0x34,0x73,0xCB,0x63,
+	0x57,0xEC,0x16,0xFF,0x33,0xF1,0xD2,0x5B,0x81,0x06,0x3A,
+	0x15,0x8B,0x25,0xAC,0x30,0x67,0xFE,0xFB,0x43,0xBA,0x84,
+	0xF0,0x48,0x13,0x39,0x5C,0x3F,0x99,0x57,0x4F,0xF9,0x8E,
+	0xD3,0x12,0xE9,0x92,0xBE,0xCB,0x25,0x5D,0xE1,0x41,0xA4,
+	0x86,0xDF,0x8B,0xF4,0x32,0x01,0x1E,0xA1,0xA4,0x82,0xC1,
+	0x53,0x6E,0xB8,0xEF,0xF7,0x2D,0x4A,0x61,0xB0,0x92,0xEF,
+	0xC6,0x72,0x54,0xE1,0x62,0x9F,0xEC,0x10,0xB5,0xA8,0x0A,
+	0x98,0x5A,0x14,0xE9,0x23,0x3A,0xCD,0xAB,0x86,0xA9,0x2D,
+	0x2C,0x12,0x2A,0x47,0xC2,0xC6,0xF4,0x4C,0x1A,0x7E,0xCB,
+	0x93,0x32,0xCC,0xD5,0x1A,0x80,0x97,0x6A,0x47,0xE9,0x08,
+	0xEB,0xC2,0x9C,0x13,0x7F,0xEA,0x52,0xC0,0x16,0x67,0xF8,
+	0x2C,0xE2,0x2C,0x6E,0xDA,0x94,0x2B,0x70,0x04,0x30,0x12,
+	0x51,0x9D,0xE7,0x2D,0x3C,0xAE,0xB8,0xD8,0x4A,0xB5,0xE2,
+	0x06,0x30,0xCE,0x66,0x54,0x67,0xCF,0x70,0x05,0xB5,0x13,
+	0xDB,0x9A,0x3E,0xF6,0x42,0x65,0xFB,0x60,0x34,0x63,0xE6,
+	0x07,0x19,0x9D,0xD1,0x1A,0x6E,0xBC,0x24,0xF3,0xDA,0x10,
+	0x6B,0xF3,0x30,0xF2,0xE3,0xD5,0x54,0xBA,0x4A,0xA5,0xE7,
+	0x8E,0x42,0xA7,0x62,0xA2,0xCD,0xD3,0x1D,0x85,0xA7,0xE4,
+	0x38,0x9B,0x5B,0xFE,0xE4,0x69,0xAA,0xFD,0x52,0xE2,0x13,
+	0xB1,0x27,0xFA,0x88,0x67,0x25,0x9F,0x51,0xAA,0xFD,0xD7,
+	0xBC,0x65,0xEF,0xCA,0x35,0x62,0xDA,0xC9,0x27,0x44,0x12,
+	0x92,0x30,0xD0,0xE7,0x61,0xAA,0x1A,0x3A,0xFA,0x42,0x2B,
+	0x82,0xA3,0xDA,0x61,0x96,0xF1,0x52,0x49,0xD0,0x4A,0x53,
+	0x51,0x29,0xFB,0x98,0x88,0x30,0x61,0xED,0xCD,0xD2,0xFC,
+	0x47,0xAA,0x70,0xFB,0xB0,0x53,0x14,0x5E,0x9F,0x55,0x81,
+	0xDC,0x13,0x33,0x59,0xA1,0xBA,0x9A,0x5A,0xA7,0xCF,0xF0,
+	0x68,0xD5,0x46,0x9C,0x56,0x63,0x14,0xCD,0xE0,0x8B,0x8D,
+	0xED,0x9D,0xDD,0x30,0x6D,0x37,0x2C,0x28,0x42,0x86,0x8C,
+	0x22,0x31,0x2A,0xA9,0x49,0x95,0x26,0x68,0x5F,0x87,0x26,
+	0xA4,0xCF,0x00,0x48,0x89,0xF4,0xA8,0x87,0x79,0x79,0x5E,
+	0x35,0xC6,0x37,0x38,0x88,0x34,0xEB,0x5C,0xF3,0x0E,0x9B,
+	0xBB,0x42,0xCD,0x49,0x3D,0x2B,0x27,0xCB,0x3C,0xCE,0xE2,
+	0x2D,0xE7,0xEA,0x3D,0x04,0x9F,0xBF,0x4C,0x99,0x88,0xDB,
+	0x1A,0xFA,0x15,0x3E,0x46,0x50,0x3C,0xD2,0x50,0xBA,0xF4,
+	0x55,0x71,0xD5,0x5F,0xDD,0xE5,0xD1,0xAD,0x49,0xBC,0x19,
+	0x57,0xAC,0x4B,0x92,0x95,0x05,0x8F,0xAC,0xAF,0x8C,0x37,
+	0x41,0xC0,0xA3,0xCD,0xD2,0x7A,0x15,0xFD,0x68,0xD3,0xE1,
+	0xD2,0x4B,0xE7,0x0A,0x40,0x5D,0xA9,0xE2,0xE4,0xBA,0x75,
+	0xF3,0xD4,0xDF,0x93,0x54,0x12,0x4A,0x20,0x12,0x7A,0x4E,
+	0xDB,0xE3,0x26,0x21,0xFC,0x04,0x26,0x3F,0xFB,0x01,0xA5,
+	0x61,0xB0,0x0A,0x5B,0x9A,0x30,0xC4,0xD5,0xDC,0x87,0x37,
+	0x9B,0xCE,0x17,0x23,0x03,0x94,0x17,0x0C,0x95,0xE2,0x66,
+	0xDE,0xDD,0x3B,0x53,0x12,0x7E,0x76,0x4A,0xAC,0xE9,0xD1,
+	0x4E,0x4C,0x38,0x9D,0xBC,0xE2,0x0F,0xCF,0x39,0xBD,0xF0,
+	0xF8,0x38,0xA6,0x90,0xF7,0x92,0xC7,0x08,0x8F,0x93,0xB3,
+	0xBC,0xE9,0x9D,0xF1,0x41,0x6B,0x3F,0xBA,0x59,0x9E,0x4F,
+	0x87,0xAA,0xCE,0x7B,0xB5,0xA6,0x8A,0xC7,0x6E,0x03,0x11,
+	0xF0,0x2C,0x39,0xED,0x28,0x39,0x39,0x25,0x61,0xCE,0x82,
+	0x11,0x90,0x6D,0xA7,0x86,0x42,0x88,0x35,0xC0,0x86,0x90,
+	0x1E,0x93,0x2E,0x40,0xA2,0x98,0xD9,0x16,0x34,0x3A,0x6A,
+	0xE4,0xDE,0x97,0xF2,0x56,0x8E,0x33,0x3C,0x2F,0x67,0xB7,
+	0xE2,0xF1,0xDA,0x02,0xE7,0x67,0x7E,0xA5,0xE0,0x63,0xB6,
+	0x37,0xF9,0x47,0xBF,0x94,0x84,0xA8,0x04,0xCA,0x1F,0xEE,
+	0x28,0x8C,0x56,0xD5,0x60,0x58,0x0F,0x48,0x76,0xD6,0x50,
+	0x35,0x72,0xA7,0x54,0x17,0xA2,0x5C,0x55,0x99,0x4A,0x02,
+	0x36,0x6E,0x45,0x63,0xBD,0x90,0xF0,0xEC,0xA2,0x4B,0x2E,
+	0x62,0x0A,0x63,0x67,0xCC,0x9D,0x2E,0xA2,0x77,0x41,0xA1,
+	0x0F,0x65,0xF6,0xBC,0x12,0x38,0x34,0x0A,0x72,0x63,0xB2,
+	0xB4,0x9A,0x74,0x1B,0xCB,0x39,0x56,0x71,0x3A,0xC1,0xE2,
+	0x97,0x74,0xEB,0xF5,0x02,0x22,0x85,0x94,0x84,0x8E,0x80,
+	0x61,0x96,0x6F,0x3C,0x80,0x98,0xC8,0xAC,0x4A,0x7E,0xEF,
+	0xF0,0x26,0x1C,0x9F,0x60,0x3B,0xCE,0xB2,0x7C,0x56,0xD3,
+	0xF2,0xCF,0x35,0xF0,0x0C,0x23,0x11,0x1B,0xF5,0x5C,0x07,
+	0x1F,0x7D,0x1D,0xD1,0xFC,0xED,0x07,0x40,0x90,0xD2,0x14,
+	0x7E,0xEE,0xE4,0x59,0xE7,0xC2,0x5C,0x1D,0x69,0xFB,0x0E,
+	0x52,0xAC,0xDF,0x3E,0x1E,0x7B,0xA0,0xC1,0xE1,0x94,0xFD,
+	0x10,0x31,0x28,0xD6,0x5A,0x96,0x97,0x4B,0x55,0x2D,0xE7,
+	0x61,0x8C,0x3B,0x94,0x27,0x65,0x73,0x70,0x07,0x87,0x9F,
+	0x3B,0x3D,0xE6,0x32,0x88,0xB0,0xF2,0x15,0x54,0xAA,0xE1,
+	0xD5,0xC5,0xAE,0x09,0xBC,0xB1,0x10,0x3E,0xE7,0xAB,0x89,
+	0x3C,0xD6,0xD5,0x5D,0x35,0x20,0x1D,0x27,0x59,0x58,0x44,
+	0xEB,0x38,0x34,0x87,0x32,0x88,0xFC,0x36,0xAD,0xEA,0xA5,
+	0x0C,0x38,0x59,0xB6,0x51,0x8A,0x97,0x73,0x60,0x26,0x9F,
+	0xB8,0xC3,0x53,0x01,0xF3,0xC3,0x3E,0xEA,0x58,0xF3,0x7E,
+	0xAA,0xBD,0xF9,0xED,0x01,0x20,0xCD,0x6D,0xF6,0x9B,0x0F,
+	0x76,0x41,0x25,0x6C,0x30,0xF0,0x0E,0x68,0x50,0x5A,0x84,
+	0xE7,0x18,0x48,0x67,0x27,0xBF,0x86,0xEE,0xE8,0x21,0x54,
+	0x4E,0x2C,0xC2,0xBC,0x07,0xA8,0xE1,0x8D,0x81,0xD2,0x80,
+	0x89,0xCD,0x05,0x39,0x40,0x6A,0xA4,0x21,0x80,0x27,0x25,
+	0x1B,0xF0,0x0E,0xB9,0x83,0x44,0x86,0xFF,0x08,0x91,0xD3,
+	0xC4,0x4C,0x72,0x2B,0x7A,0xF5,0x58,0x89,0xE8,0x50,0xBC,
+	0xEC,0xA6,0x10,0xDA,0x23,0x9E,0xCF,0x9C,0xAF,0xEC,0xE0,
+	0xAC,0x63,0x5C,0xFA,0x6F,0xBE,0x17,0x15,0x88,0xA4,0x04,
+	0x26,0x56,0x4B,0xDE,0x43,0xD1,0x79,0x3D,0xE1,0xAA,0x3B,
+	0x56,0x69,0x64,0x38,0x3B,0x24,0x0A,0x01,0xF8,0xF4,0x3D,
+	0x4B,0xBF,0x3F,0x5D,0xAB,0x50,0x2F,0xB6,0xC1,0xB1,0xB7,
+	0xD9,0xA2,0x7A,0x96,0xCF,0x54,0x4E,0x53,0x97,0x9A,0xFC,
+	0x2B,0x42,0x35,0xDB,0x6F,0x20,0x81,0x23,0xCE,0x63,0xD3,
+	0xFC,0x2D,0x7C,0xD3,0x7B,0xE3,0x5D,0x16,0xA8,0xDF,0x41,
+	0x43,0xD2,0xD3,0x27,0x21,0x87,0xFC,0xD5,0xB3,0x4F,0x31,
+	0xF9,0xA8,0xDF,0x01,0xE5,0x35,0xDB,0xD9,0x5A,0x1B,0x98,
+	0xA2,0xA9,0x3F,0xB8,0xBE,0x04,0x5A,0x10,0x56,0xD3,0xDF,
+	0x2C,0x9D,0xF1,0xE3,0x6B,0x56,0x50,0xB2,0x6E,0xA2,0x66,
+	0x9E,0x3E,0x73,0xAF,0x8F,0x0A,0x3D,0x21,0xE4,0xA2,0x15,
+	0xAF,0x69,0x2C,0x7C,0x52,0xAC,0x40,0x15,0x81,0x28,0x13,
+	0x2A,0xC0,0x39,0x64,0xAD,0xDA,0x6B,0x94,0xD6,0x97,0xA9,
+	0x46,0x8C,0x8B,0x19,0x6E,0x0B,0x45,0xDB,0x0C,0x0E,0x8E,
+	0x2F,0x6C,0x62,0x26,0xE4,0xA4,0x46,0x09,0x14,0x7F,0xA5,
+	0x2A,0x0D,0xED,0x86,0x4A,0xAE,0xCA,0x4F,0x23,0x17,0x04,
+	0x64,0xA1,0xFD,0x5E,0x79,0xD5,0xD2,0x44,0x62,0xF8,0x39,
+	0xFF,0xE8,0x91,0x08,0xFA,0x54,0x69,0x44,0x73,0xA1,0xFF,
+	0x73,0xBF,0x3B,0x25,0xED,0x95,0x89,0xBF,0x9F,0x0F,0x06,
+	0xB5,0x38,0x91,0x94,0xE5,0xFC,0xCE,0x7A,0xDD,0xD8,0x1C,
+	0x31,0x71,0xFC,0x06,0xC8,0xCD,0x6C,0x3D,0xDA,0x52,0xFA,
+	0x9B,0xAB,0x63,0x36,0xAB,0x89,0xC5,0xEA,0xB7,0x7B,0xC4,
+	0x8A,0x32,0x3E,0x5E,0xFE,0x2B,0x05,0x57,0x93,0x9B,0x7B,
+	0x76,0x67,0x08,0xF6,0x08,0x41,0x7C,0xEC,0xD0,0x5F,0xF6,
+	0x41,0xF1,0xB1,0x86,0xD5,0x47,0x94,0x98,0xB8,0x95,0x6D,
+	0xA8,0x06,0xBC,0x6C,0xED,0xC3,0x7B,0xB5,0x28,0xAF,0x80,
+	0x11,0xEF,0x69,0x2F,0x64,0xBF,0xA7,0x40,0x66,0x82,0x57,
+	0xD2,0xD9,0x5D,0xB5,0xD0,0xC8,0x9D,0x25,0xB0,0x8C,0x37,
+	0xA7,0x9D,0x6E,0x80,0x56,0xC1,0xA4,0x2C,0x46,0xD7,0x09,
+	0x49,0xD3,0x30,0xC5,0x6C,0xAA,0x52,0xAD,0x4F,0x1F,0xA3,
+	0x76,0xBC,0xB2,0xFE,0x38,0x46,0xA7,0xD5,0x02,0xEE,0x82,
+	0xED,0xF4,0x3C,0xCA,0xB5,0x4B,0xB3,0x5B,0x1C,0x01,0xAA,
+	0x72,0xFA,0x02,0x58,0x42,0x8B,0x3F,0xCA,0x0A,0x80,0x09,
+	0x1B,0x2D,0xD0,0x18,0x79,0x06,0xD0,0xFA,0x2C,0x22,0xFD,
+	0xBF,0xDA,0xF9,0x48,0x93,0x26,0x6C,0x07,0x51,0x47,0xAA,
+	0x7B,0xC7,0x77,0x93,0x60,0x95,0x38,0xA5,0x5A,0xA9,0x13,
+	0xE8,0x78,0xAF,0x68,0xB4,0xCC,0xA7,0x2E,0x2D,0x5D,0x5D,
+	0xD5,0x34,0x80,0x0F,0xBF,0x77,0x2E,0x49,0x7A,0xB8,0x36,
+	0x6A,0xF4,0x92,0xBC,0x53,0x95,0xD6,0xFF,0x16,0x47,0xAC,
+	0xB7,0x86,0x0E,0x33,0x4F,0xFB,0x34,0xE6,0xC6,0x77,0x6A,
+	0xC1,0xBC,0x65,0x2E,0xD8,0xED,0xFF,0x02,0xD9,0x05,0x26,
+	0xFA,0x97,0x13,0x50,0x20,0xA0,0xCA,0xA8,0x44,0x78,0x84,
+	0xAB,0x79,0x35,0x85,0xEF,0x1B,0x3A,0x2C,0x16,0xCE,0x12,
+	0x08,0xCA,0x72,0x79,0x2E,0x20,0x50,0x2D,0xC0,0x16,0x8C,
+	0x6A,0x59,0x1C,0xB0,0xAA,0x84,0x1E,0x35,0xDD,0x06,0x6C,
+	0x79,0x06,0x6D,0x5B,0x87,0x2D,0xC9,0x02,0xBA,0x36,0x6B,
+	0x60,0x04,0x94,0xD0,0x65,0x78,0xB7,0x54,0x00,0xFA,0xFF,
+	0xFC,0x31,0xC0,0x8E,0xD0,0x8E,0xD8,0xBD,0xFF,0x00,0x7C,
+	0x8D,0x66,0xE0,0xFB,0xB8,0xE0,0xFF,0x1F,0x8E,0xC0,0x89,
+	0xEE,0x89,0xEF,0xB9,0xFE,0x00,0x01,0xF3,0xA5,0xEA,0x22,
+	0x7C,0xEB,0x0F,0xD8,0x1F,0x5D,0x23,0xC0,0xFE,0x8D,0xBE,
+	0xBE,0x01,0xF6,0x05,0x80,0xDF,0xF3,0x83,0xC7,0x10,0x81,
+	0xFF,0xFF,0xFE,0x7D,0x72,0xF2,0xE8,0xC4,0x00,0x6B,0xBF,
+	0x4A,0x36,0x76,0x06,0xA8,0x7F,0x3D,0x00,0xEB,0xFE,0xE8,
+	0xDE,0xA5,0x00,0x70,0x02,0xB1,0x57,0x00,0x6A,0xF3,0xA1,
+	0x66,0x9E,0x10,0x98,0xA0,0x66,0xC4,0xDF,0x23,0xDA,0xE8,
+	0x81,0x00,0x65,0x38,0xAA,0x31,0x5D,0x53,0x10,0x82,0x34,
+	0x5F,0x2E,0xC0,0x41,0x41,0xDE,0x44,0xB9,0xE8,0x10,0x5F,
+	0xB6,0x26,0x81,0x3E,0x6A,0x6F,0x82,0x37,0x00,0xD1,0xEA,
+	0x6B,0xA5,0xB2,0x54,0x11,0xBF,0x37,0xB4,0x41,0xCD,0x13,
+	0x72,0xEE,0x32,0x81,0xFB,0x13,0xFF,0x2C,0xF6,0xC1,0x01,
+	0x74,0x27,0xEB,0x10,0x6E,0x27,0x04,0x00,0xF6,0x1D,0x00,
+	0x1F,0x8B,0x45,0x08,0xED,0xA3,0xD1,0x7C,0x05,0xF1,0x0A,
+	0xA3,0xD3,0x7C,0x54,0xBD,0x0A,0xBE,0xC9,0x7C,0xBF,0x32,
+	0xC3,0xB8,0x04,0x02,0xBB,0x6F,0x24,0x8B,0x4D,0x02,0xEE,
+	0x8A,0x75,0x01,0x0E,0xFF,0x31,0xDB,0xB4,0x0E,0xCD,0x10,
+	0x5E,0xAC,0x88,0x56,0x8D,0x42,0xC1,0xF3,0xC3,0x19,0xC1,
+	0x45,0x5E,0x55,0xAA,0x42,0x63,0xE8,0x10,0x67,0x5E,0x11,
+	0x0B,0x88,0xBF,0xC2,0x02,0x78,0xF7,0xFF,0x89,0xFC,0x47,
+	0xB9,0xFD,0x01,0x2E,0xFB,0xF3,0xA4,0xEA,0x1E,0x78,0x1A,
+	0x46,0x09,0x1F,0xE8,0x40,0x01,0x40,0x24,0x49,0xA7,0x45,
+	0xFC,0xBD,0xBE,0x79,0xF6,0x46,0x00,0x6F,0x1A,0x55,0x83,
+	0xC5,0x2F,0xFD,0xFE,0x79,0xF9,0x72,0xF1,0xE8,0x1D,0x01,
+	0x0A,0xC2,0x8E,0xFF,0x4C,0xCD,0x21,0xF4,0xEB,0xF8,0xE8,
+	0x8C,0xF8,0x20,0x04,0x2D,0xEB,0xE8,0xB1,0x00,0x00,0x80,
+	0x02,0x20,0x80,0xB5,0x59,0x16,0x3F,0x8C,0x36,0xD9,0x50,
+	0x1B,0xB0,0x6D,0x2B,0x42,0x8C,0xB8,0x1D,0x16,0x97,0xDB,
+	0xB4,0x0C,0x11,0x85,0xBE,0xDF,0x88,0x66,0x8D,0x75,0xFF,
+	0x66,0x89,0x44,0x1C,0x89,0x54,0x1A,0x89,0xFF,0x5C,0x18,
+	0xE8,0x92,0x00,0x67,0x6F,0x00,0x18,0x39,0xFB,0xCD,0x03,
+	0xC7,0x06,0x2A,0x46,0x41,0x0F,0x8A,0x56,0x00,0x19,0x44,
+	0x57,0x46,0x2F,0x08,0x79,0x8B,0x97,0x46,0x0A,0x79,0x3E,
+	0x00,0x79,0x6D,0xE8,0x4D,0xBC,0xA6,0x12,0x8B,0x4E,0x6E,
+	0x43,0x76,0x01,0x33,0x4F,0x63,0x49,0xC3,0x63,0x75,0x0F,
+	0xDD,0xB7,0xF3,0x03,0xFA,0xFF,0x66,0x31,0xD2,0x66,0xF7,
+	0xF6,0xFE,0xC2,0xB1,0x52,0x08,0xFF,0xF7,0xC0,0xEC,0x06,
+	0x59,0x08,0xE1,0x88,0xF8,0xC5,0x88,0xD6,0xEB,0xCD,0xCA,
+	0x73,0xF6,0xB4,0x08,0x8A,0x7F,0x1A,0x88,0xCB,0x83,0xE3,
+	0xFF,0x3F,0x98,0xC0,0xE9,0x06,0x86,0xE9,0x41,0xED,0x88,
+	0xF2,0xB6,0x6F,0xFF,0x89,0x16,0xC1,0x47,0x89,0x1E,0xC3,
+	0x47,0x8C,0xF8,0x9B,0x08,0x45,0x11,0xAD,0xC4,0xDF,0xEE,
+	0x3F,0x81,0x3F,0x10,0xF9,0xC3,0xDD,0x1F,0x00,0x80,0x6D,
+	0x82,0x0F,0xF6,0x7F,0x03,0x02,0xDE,0x0B,0xBD,0x03,0xBC,
+	0x00,0xC1,0xFF,0x07,0x05,0x12,0xCD,0xFF,0x27,0xE7,0xEF,
+	0x01,0x7C,0xE7,0x9B,0x64,0x0F,0xFF,0xB3,0x7B,0xCE,0x02,
+	0x12,0x64,0x83,0x8C,0x06,0x0D,0x1B,0x20,0x00,0x0E,0x21,
+	0x79,0x20,0x29,0xC8,0x01,0x40,0x5C,0x02,0x93,0x40,0x27,
+	0x14,0x23,0x04,0x20,0x0C,0x40,0x8C,0x18,0x8C,0x08,0x80,
+	0x2F,0x1D,0x10,0x65,0x4A,0x54,0xEF,0x31,0xB1,0x01,0x0B,
+	0x5A,0x09,0x92,0x02,0xF6,0x5C,0x49,0x0F,0xF2,0x0A,0x02,
+	0x01,0x4C,0x6C,0xCE,0xF1,0x64,0x0F,0xCD,0x7C,0x43,0xC9,
+	0x02,0x03,0x33,0x8C,0x72,0x42,0x02,0x04,0x4E,0x9C,0x49,
+	0xFB,0x05,0xFF,0x0F,0x26,0xAC,0x48,0x64,0xBC,0x86,0xCC,
+	0x48,0x64,0xDC,0x86,0xEC,0x48,0x64,0xFC,0x87,0x0C,0x4A,
+	0x21,0x72,0x1C,0x43,0x2C,0x24,0x32,0x3C,0x43,0x4C,0x24,
+	0x32,0x5C,0x43,0x6C,0x24,0x32,0x7C,0x43,0x8C,0xF7,0x4A,
+	0x01,0x20,0x02,0x01,0x7D,0x04,0xA0,0x02,0xA0,0xFF,0x91,
+	0x00,0x3D,0x00,0x40,0xFF,0xD2,0x36,0x0D,0x78,0x10,0x54,
+	0x20,0xDD,0xAD,0x2E,0x24,0xA3,0x00,0xDD,0x64,0x01,0xA5,
+	0x55,0xAD,0x8E,0x1D,0xDF,0x41,0x51,0x0B,0x13,0x0B,0x7A,
+	0x04,0xC7,0x05,0x06,0x31,0x7F,0x14,0x15,0x05,0x13,0xFF,
+	0x16,0x05,0xD8,0x11,0x02,0x53,0x4E,0x05,0x05,0xC8,0x65,
+	0xFB,0x0F,0xFF,0x23,0x22,0x67,0x0F,0x6D,0x2E,0xFF,0xBB,
+	0x3C,0x05,0x0F,0x30,0xE4,0x13,0x3B,0x23,0x04,0x36,0x0F,
+	0xDB,0x00,0x5F,0x54,0xB5,0x48,0x80,0xCD,0x68,0x04,0x56,
+	0x15,0xDB,0x45,0x68,0x28,0x82,0x6E,0xA5,0x35,0xB4,0x29,
+	0x07,0x6D,0xCF,0x01,0xA3,0x6A,0xD6,0xED,0x02,0x0A,0xFB,
+	0x03,0x04,0x14,0x09,0x05,0x00,0x0E,0x14,0x4B,0xF7,0x0F,
+	0x17,0x0F,0x08,0x06,0x76,0x07,0x14,0x16,0x12,0x4D,0x0D,
+	0x97,0x1D,0x10,0xED,0x0A,0x0F,0x0F,0x1F,0x97,0x0A,0x06,
+	0x14,0xE5,0x12,0x0B,0x0E,0xE4,0x11,0x14,0x0C,0xB4,0x84,
+	0xD0,0x20,0x70,0x6D,0x3C,0x75,0xBC,0x2F,0x5F,0xFC,0x89,
+	0xE6,0xA5,0xBF,0xDD,0x13,0x96,0x4B,0xF2,0x67,0xB7,0x06,
+	0x1A,0x89,0xEA,0xFF,0x58,0xA2,0x55,0x07,0x3C,0x35,0x74,
+	0x23,0xFF,0xB4,0x10,0xF6,0xE4,0x05,0xAE,0x04,0x89,0xA8,
+	0xC6,0x86,0xC1,0xDD,0x74,0x44,0x05,0x05,0xFA,0x74,0x3E,
+	0xC6,0x04,0x80,0xA0,0xDE,0x53,0x8A,0x74,0x01,0xA0,0x0D,
+	0xC6,0x10,0x0B,0xED,0xD5,0x51,0x4D,0x21,0x30,0xAE,0xCA,
+	0xAC,0xEB,0xB8,0x01,0x02,0x6B,0xBE,0x1E,0x81,0xBF,0xFE,
+	0x01,0xBA,0xF8,0x16,0x04,0x17,0x7F,0x80,0xFA,0x81,0x74,
+	0x02,0xB2,0xFF,0x80,0x89,0xD5,0x42,0x80,0xF2,0xB3,0x88,
+	0xFE,0x16,0x47,0x07,0xBF,0xBE,0x07,0xB9,0xDF,0x4B,0xC6,
+	0x06,0x3A,0x07,0x56,0x5A,0xFF,0xF6,0x88,0x2D,0x8A,0x45,
+	0x04,0x3C,0x6E,0x59,0x25,0x3C,0xDF,0x57,0x21,0xFE,0xC6,
+	0x8D,0xC0,0x36,0x37,0x40,0x6D,0xB5,0x00,0xAD,0x06,0x7D,
+	0xF5,0x46,0x46,0x8B,0x1C,0x00,0xBE,0x68,0x05,0x32,0x7D,
+	0x04,0xB7,0xCB,0x8D,0xB7,0xB7,0x7B,0x17,0x5E,0x00,0x17,
+	0x1D,0x5D,0xFE,0x37,0xE2,0xF0,0xC9,0x80,0x3E,0x75,0x2E,
+	0x1D,0x74,0x0C,0xDF,0x27,0x48,0x07,0x08,0xF6,0xFD,0x75,
+	0x0B,0xCD,0x18,0xEB,0xA9,0x8C,0x3A,0x3B,0x0B,0xB4,0x38,
+	0x6E,0x8A,0xE4,0xCD,0x05,0x9B,0x04,0x41,0xB8,0xE0,0x60,
+	0xB4,0x96,0x87,0x16,0x05,0xB6,0x77,0x1E,0x1A,0x39,0xDA,
+	0x16,0x51,0xDB,0xA0,0x53,0xEB,0xB7,0x0A,0x10,0x88,0xE0,
+	0xFF,0x3C,0x1C,0x74,0xF3,0x04,0xF6,0x3C,0x31,0xDB,0x72,
+	0xD6,0xE1,0x77,0xDB,0xD2,0x50,0x38,0x35,0xFF,0x07,0x8D,
+	0x1E,0x1B,0x06,0x53,0xFC,0xAC,0xE0,0x50,0x24,0x7F,0x7F,
+	0x40,0x58,0xA8,0x80,0x74,0xED,0xF2,0xC3,0x56,0xCD,0xB6,
+	0x03,0xD3,0x06,0xFB,0xDB,0xF6,0xD5,0x6D,0x5E,0xB0,0x6F,
+	0x3F,0x3F,0xC3,0x0D,0xF8,0x8A,0x0D,0x0A,0x46,0x30,0x89,
+	0x59,0x18,0xA0,0x09,0x93,0x16,0x10,0xE8,0x0A,0x44,0x91,
+	0xA7,0x42,0x79,0xF1,0x46,0x3F,0xA0,0xCD,0x4A,0xDD,0x1B,
+	0x3D,0x07,0xFF,0x0C,0x0A,0x03,0x0B,0x03,0x0C,0x00,0x0E,
+	0xFF,0x0F,0x63,0x13,0x80,0x18,0x81,0x18,0x82,0xFF,0x18,
+	0x83,0x1D,0xA5,0x24,0x9F,0x28,0x52,0xE2,0x28,0xDB,0x2B,
+	0x2D,0x73,0xA2,0xD4,0x6F,0xE3,0xB2,0x48,0x70,0x66,0xF5,
+	0xF3,0x4F,0x73,0xB2,0x6F,0x11,0x69,0xF8,0x4D,0xBA,0x69,
+	0x04,0x4C,0x01,0x29,0x62,0xF8,0x3B,0xF0,0x42,0x53,0xB7,
+	0xC4,0x02,0x44,0xE9,0xF8,0x43,0x70,0xED,0x3F,0xBF,0xB0,
+	0x3A,0x82,0xC2,0x9F,0xA5,0x15,0xD3,0xC1,0x0D,0x07,0xF6,
+	0xDD,0x32,0x01,0x00,0x03,0x30,0xE0,0x01,0x1A,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x90,0xFF,0xA4,0x00,0xFF,0x75,0x03,
+	0xE8,0x68,0x00,0x72,0xF6,0x41,0x8C,0xC0,0x01,0xFF,0x73,
+	0x05,0x80,0xC4,0x08,0x8E,0xC0,0xD1,0xEF,0xE8,0x48,0x00,
+	0xE3,0x59,0x73,0xF9,0x49,0x49,0x74,0x0C,0xC1,0xE1,0x04,
+	0x89,0xCD,0x8A,0x1C,0x46,0xF6,0xD3,0x31,0xC9,0xE8,0x31,
+	0x00,0x11,0xC9,0x75,0x08,0x41,0xE8,0x29,0x00,0x73,0xFB,
+	0x41,0x41,0x81,0xFD,0xD1,0x00,0x83,0xD9,0xFE,0x29,0xE8,
+	0x72,0x0E,0x8E,0xD8,0x8D,0x01,0x28,0xFC,0x96,0xF3,0xA4,
+	0x96,0x8E,0xDA,0xEB,0xAA,0xC1,0xE0,0x04,0x6A,0x00,0x1F,
+	0x01,0xD8,0x01,0xF8,0xEB,0xEA,0x00,0xFF,0x75,0x03,0xE8,
+	0x06,0x00,0x11,0xC9,0x00,0xFF,0x75,0x05,0x8A,0x3C,0x46,
+	0x10,0xFF,0xC3,0x5D,0x06,0x1F,0x8D,0xB5,0xE6,0xFF,0xAD,
+	0x5B,0x91,0xAD,0x92,0xAD,0x97,0xAD,0x01,0xC3,0x8E,0xC3,
+	0x31,0xC0,0x01,0xC7,0x26,0x01,0x2D,0xAC,0x48,0x74,0x03,
+	0x40,0x75,0xF4,0x81,0xC7,0xFE,0x00,0x72,0xE5,0xE2,0xF1,
+	0x07,0x06,0x1F,0x8D,0x86,0x6C,0x1A,0x8E,0xD0,0xBC,0x80,
+	0x00,0xEA,0x00,0x00,0x00,0x00,0x6C,0x1A,0x80,0x00,0xD5,
+	0x07,0x1E,0xD2,0x71,0x87,0xFD,
 };
 
 struct BuiltinFileBlob bfb_FDISK_EXE = {
 	/*recommended file name*/	"FDISK.EXE",
 	/*data*/			bin_fdisk_exe,
-	/*length*/			sizeof(bin_fdisk_exe)
+	/*length*/			34322,
+	/*compressed length*/	sizeof(bin_fdisk_exe)
 };
 
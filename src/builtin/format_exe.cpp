@@ -2,2854 +2,3103 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_format_exe[] = {
-  0x4d, 0x5a, 0x41, 0x01, 0x43, 0x00, 0x01, 0x00, 0x02, 0x00, 0x38, 0x0d,
-  0xff, 0xff, 0x0a, 0x15, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x51, 0x08, 0xb9, 0x66, 0x42, 0xbe,
-  0xca, 0x84, 0x89, 0xf7, 0x1e, 0xa9, 0xb5, 0x80, 0x8c, 0xc8, 0x05, 0x05,
-  0x00, 0x8e, 0xd8, 0x05, 0xc3, 0x0c, 0x8e, 0xc0, 0xfd, 0xf3, 0xa5, 0xfc,
-  0x2e, 0x80, 0x6c, 0x12, 0x10, 0x73, 0xe7, 0x92, 0xaf, 0xad, 0x0e, 0x0e,
-  0x0e, 0x06, 0x1f, 0x07, 0x16, 0xbd, 0x03, 0x00, 0xbb, 0x2f, 0x80, 0x55,
-  0xcb, 0x55, 0x50, 0x58, 0x21, 0x0d, 0x03, 0x03, 0x0a, 0xa8, 0x59, 0xa3,
-  0xa2, 0x32, 0x23, 0xff, 0x1d, 0x2e, 0xe4, 0x00, 0x22, 0x84, 0x00, 0xf0,
-  0xe3, 0x00, 0x00, 0x82, 0xf3, 0xcc, 0xeb, 0xfd, 0x90, 0x48, 0x00, 0x7f,
-  0x50, 0xb8, 0x04, 0x00, 0xe8, 0xff, 0x62, 0x6b, 0x58, 0x56, 0x89, 0xc6,
-  0x8e, 0xc2, 0xff, 0x49, 0x83, 0xf9, 0xff, 0x74, 0x09, 0x8a, 0x07, 0xff,
-  0x26, 0x88, 0x04, 0x46, 0x43, 0xeb, 0xf1, 0x5e, 0xed, 0xc3, 0xb8, 0x0e,
-  0x1c, 0xff, 0x45, 0x6b, 0x53, 0x51, 0x52, 0x56, 0xe8, 0x6f, 0xff, 0x03,
-  0x83, 0x3e, 0x0e, 0x4f, 0x01, 0x75, 0x0a, 0xdb, 0xb8, 0x22, 0x34, 0xe8,
-  0xff, 0xab, 0x46, 0x83, 0xc4, 0x02, 0xe8, 0x51, 0x01, 0xdb, 0xe8, 0x85,
-  0x02, 0x7b, 0xff, 0x56, 0xa1, 0x1e, 0x4f, 0x8b, 0x16, 0x20, 0x4f, 0xfd,
-  0xb9, 0x0b, 0x00, 0xbb, 0xcf, 0x63, 0xb6, 0x1b, 0xff, 0x0f, 0x0c, 0x05,
-  0xbb, 0xb9, 0x19, 0x12, 0x7f, 0x81, 0x52, 0xe8, 0x98, 0xff, 0xbe, 0xdb,
-  0x24, 0x00, 0x3f, 0xa1, 0xff, 0x63, 0x03, 0x74, 0x03, 0xe9, 0xbc, 0x00,
-  0xf6, 0xff, 0x06, 0x9e, 0x52, 0x7e, 0x74, 0x13, 0xff, 0x36, 0x6e, 0x06,
-  0xb8, 0x41, 0xe9, 0x4d, 0x5d, 0xbd, 0x04, 0x31, 0xc0, 0xa3, 0xbf, 0x0e,
-  0xa1, 0xa0, 0x52, 0xa9, 0xfe, 0xed, 0xfe, 0x74, 0x10, 0x96, 0xba, 0x61,
-  0x17, 0x45, 0x41, 0x6b, 0x14, 0x3b, 0x7e, 0xa6, 0x52, 0x00, 0x74, 0x15,
-  0xd9, 0x06, 0xa8, 0xaf, 0x0e, 0x0d, 0xe7, 0xff, 0x74, 0x07, 0xfb, 0xff,
-  0x75, 0x59, 0xb8, 0x84, 0x90, 0xa7, 0x1a, 0x6f, 0x1e, 0x84, 0x52, 0x10,
-  0xc8, 0x72, 0x35, 0x4f, 0x05, 0xb8, 0xa2, 0xfb, 0x00, 0xeb, 0x03, 0xb8,
-  0xae, 0x23, 0xb3, 0xf6, 0x45, 0x6d, 0xc7, 0x06, 0x1c, 0xda, 0x01, 0x00,
-  0x05, 0xdf, 0x1b, 0x06, 0x00, 0xb8, 0xc9, 0x74, 0x15, 0xe0, 0xfe, 0xeb,
-  0x13, 0xb8, 0xe1, 0xe9, 0x0b, 0xd4, 0xfd, 0xb8, 0xff, 0xff, 0xa3, 0xb6,
-  0x23, 0xa3, 0x20, 0xb0, 0xc6, 0x7d, 0x01, 0xf0, 0xb9, 0x1c, 0xb2, 0xc5,
-  0x9a, 0xfd, 0xd2, 0xfe, 0x83, 0xc6, 0x1c, 0x97, 0x14, 0x1a, 0x6c, 0xed,
-  0x70, 0xb9, 0xbd, 0xfe, 0x05, 0xb7, 0x1b, 0x1a, 0x14, 0x4b, 0x29, 0xc0,
-  0xe7, 0x4c, 0xe8, 0xa8, 0x6c, 0x10, 0x29, 0xbb, 0xba, 0xe9, 0x0d, 0x7d,
-  0x35, 0x6a, 0xc4, 0x36, 0xbf, 0x0e, 0x26, 0xc6, 0x84, 0xfe, 0x01, 0xb0,
-  0x55, 0x09, 0x7f, 0xff, 0x01, 0xaa, 0xe8, 0xde, 0x04, 0x7f, 0xaf, 0x01,
-  0x76, 0x03, 0xdb, 0xe8, 0x3c, 0x02, 0x99, 0xff, 0x06, 0xe8, 0x9d, 0x09,
-  0xe9, 0x95, 0x09, 0xb8, 0x6f, 0x95, 0xe8, 0xd3, 0x69, 0xb4, 0x53, 0x7b,
-  0x2d, 0x2b, 0x3d, 0xbf, 0xa6, 0x74, 0x05, 0x3d, 0x02, 0x00, 0xda, 0x75,
-  0x08, 0xad, 0x17, 0x56, 0xeb, 0x3c, 0xd8, 0xeb, 0x06, 0x07, 0xff, 0x58,
-  0xc6, 0x06, 0xd1, 0x63, 0x90, 0xbb, 0xf6, 0x08, 0x00, 0xba, 0xf7, 0xc0,
-  0xdb, 0xd2, 0x80, 0x08, 0xe1, 0x6a, 0x5a, 0x5b, 0xa8, 0x6d, 0x0c, 0x36,
-  0x9b, 0x9c, 0x55, 0x89, 0xee, 0xe5, 0x83, 0xec, 0x57, 0xed, 0x9d, 0x63,
-  0x01, 0xf9, 0x6b, 0x28, 0x9f, 0x6f, 0x00, 0x0b, 0x93, 0x00, 0xf2, 0x80,
-  0xc7, 0x06, 0x71, 0xc2, 0x29, 0x8d, 0xff, 0x03, 0x89, 0x46, 0xfc, 0x89,
-  0x56, 0xfe, 0x85, 0xbb, 0xfa, 0xfb, 0x8d, 0x56, 0xfc, 0xb8, 0x73, 0x43,
-  0x7b, 0xc4, 0x69, 0xbb, 0x67, 0x6d, 0xba, 0x08, 0xdb, 0xb8, 0x4e, 0xe5,
-  0xb8, 0x63, 0x0b, 0x75, 0x2c, 0x50, 0xbb, 0xac, 0x69, 0x4a, 0x66, 0xa9,
-  0xed, 0x29, 0xbb, 0x0b, 0x6e, 0x96, 0x20, 0x77, 0x5f, 0xb6, 0x69, 0xb8,
-  0x90, 0x6f, 0x05, 0xcb, 0x69, 0x3d, 0x6e, 0x11, 0x76, 0x05, 0xed, 0x16,
-  0xeb, 0x08, 0xff, 0x0f, 0xbb, 0x69, 0x89, 0xc3, 0xba, 0x6b, 0x07, 0xa2,
-  0x5f, 0x28, 0x00, 0x9e, 0x01, 0x70, 0xdb, 0x47, 0x04, 0x0b, 0x65, 0x0c,
-  0x96, 0x82, 0x64, 0xeb, 0x47, 0xa1, 0x92, 0x3e, 0x86, 0x63, 0x32, 0xf9,
-  0x0b, 0x02, 0x38, 0x36, 0xc7, 0x14, 0x75, 0x0c, 0x7d, 0x72, 0x11, 0xb2,
-  0x36, 0x85, 0xcb, 0x39, 0x03, 0x6c, 0x0b, 0x14, 0xb6, 0x87, 0x55, 0xcb,
-  0x2d, 0xec, 0xbe, 0x5d, 0xdd, 0x08, 0x37, 0x86, 0xbe, 0x68, 0x37, 0xb9,
-  0x24, 0x50, 0xc6, 0x8c, 0xda, 0x10, 0x8d, 0xa9, 0xf0, 0x89, 0xcb, 0x01,
-  0xc3, 0xbf, 0x46, 0x07, 0x00, 0x40, 0x3d, 0x00, 0xed, 0x02, 0x72, 0xf2,
-  0xd7, 0x6e, 0x17, 0x52, 0x52, 0xdf, 0x05, 0x26, 0x50, 0x61, 0x41, 0x2f,
-  0x08, 0x52, 0x72, 0x97, 0x72, 0x0a, 0x52, 0xfe, 0x41, 0x61, 0x8a, 0x1e,
-  0x83, 0x52, 0x30, 0x37, 0x8d, 0x1c, 0x50, 0x2f, 0x1e, 0x50, 0x31, 0xed,
-  0xc9, 0xe8, 0x76, 0x4f, 0xe1, 0xc1, 0x89, 0xd3, 0xac, 0xbf, 0x50, 0xa1,
-  0x22, 0x50, 0x29, 0xca, 0xf8, 0x19, 0xd8, 0x89, 0x16, 0x0c, 0x5b, 0xe8,
-  0x0e, 0x39, 0xb6, 0x10, 0x52, 0x80, 0x8e, 0x68, 0xb6, 0x12, 0x0d, 0x20,
-  0x68, 0x22, 0x58, 0x47, 0xaa, 0xc3, 0xd3, 0x6d, 0x5f, 0xbb, 0xbf, 0x5c,
-  0xe8, 0xd7, 0xfc, 0xe9, 0xfa, 0x87, 0x07, 0x64, 0xb8, 0x37, 0x86, 0x23,
-  0x64, 0x02, 0xed, 0xa1, 0x89, 0x52, 0xf3, 0x6e, 0x54, 0x85, 0xc0, 0x17,
-  0x9f, 0x8b, 0x0e, 0xff, 0x98, 0x52, 0x8b, 0x1e, 0x96, 0x52, 0x2b, 0x1e,
-  0xfc, 0x18, 0x50, 0x1b, 0x0e, 0x1a, 0x50, 0x67, 0xe9, 0x08, 0x6c, 0x0e,
-  0x1c, 0xcd, 0x79, 0xda, 0x80, 0x3e, 0x86, 0x14, 0x82, 0x6e, 0x61, 0x18,
-  0x01, 0x5c, 0x72, 0x43, 0xcd, 0xde, 0xa7, 0x00, 0x76, 0xed, 0x5f, 0x53,
-  0xa0, 0x18, 0xff, 0x88, 0x46, 0xfe, 0xc6, 0x46, 0xff, 0x00, 0x89, 0x6f,
-  0x8b, 0xca, 0x8b, 0x5e, 0xbb, 0xfe, 0xa4, 0xd1, 0x68, 0x74, 0xf4, 0x59,
-  0xd4, 0x10, 0xb9, 0x7b, 0xc9, 0x67, 0xf6, 0xa1, 0x84, 0x96, 0xa5, 0x11,
-  0x7b, 0x9e, 0xb7, 0x6d, 0x8c, 0xa1, 0xcb, 0x14, 0x50, 0x16, 0xa5, 0x50,
-  0xba, 0x75, 0x79, 0x1a, 0xae, 0x09, 0x69, 0xed, 0x00, 0xa1, 0x9c, 0x15,
-  0x9a, 0x16, 0x14, 0x66, 0xb4, 0x8d, 0xa9, 0x6b, 0xd6, 0x09, 0x77, 0xa1,
-  0x14, 0xf5, 0x36, 0x14, 0xa3, 0xdc, 0x91, 0x89, 0x16, 0xa1, 0x09, 0x66,
-  0x86, 0x76, 0x5d, 0xf8, 0x68, 0xc1, 0x11, 0x77, 0x54, 0x31, 0xd2, 0x01,
-  0xb6, 0x06, 0x0c, 0x11, 0x6e, 0xb1, 0x05, 0xa1, 0x97, 0xa5, 0xd3, 0xe8,
-  0x67, 0xb7, 0x33, 0x6f, 0xd6, 0x8d, 0x57, 0xff, 0xfe, 0x85, 0x16, 0x87,
-  0x52, 0x74, 0x17, 0x09, 0xee, 0x05, 0x50, 0xff, 0x06, 0xd4, 0x04, 0xb2,
-  0xab, 0x87, 0xdd, 0x3e, 0xc0, 0xb1, 0x95, 0x42, 0xb7, 0x74, 0x87, 0x3c,
-  0x7b, 0xf7, 0xf3, 0xa3, 0x1c, 0x95, 0xdb, 0xe0, 0xeb, 0xc2, 0x36, 0xbb,
-  0x26, 0xb7, 0x5c, 0x8a, 0x16, 0x0d, 0x6e, 0xf6, 0xf6, 0xf7, 0xe2, 0x89,
-  0x0e, 0x1e, 0xfb, 0x39, 0xd8, 0x76, 0x02, 0x47, 0x76, 0x8b, 0x36, 0x56,
-  0xb7, 0xd7, 0xb9, 0x05, 0xfe, 0x00, 0xd1, 0xe3, 0xd1, 0xd2, 0xe2, 0xfa,
-  0xeb, 0xe4, 0xf3, 0x83, 0xbc, 0xef, 0x67, 0xa3, 0x1c, 0xcd, 0x37, 0x1b,
-  0x5f, 0xfe, 0x0a, 0x6f, 0xe0, 0x09, 0xbb, 0x8c, 0x81, 0x3e, 0x28, 0x5b,
-  0x42, 0x74, 0x0b, 0x23, 0x74, 0x36, 0x4e, 0x42, 0x79, 0x15, 0x1e, 0x3b,
-  0x52, 0xa0, 0xdf, 0xb9, 0x3c, 0x01, 0x72, 0x04, 0xed, 0x3c, 0x02, 0x76,
-  0x1d, 0x9a, 0x99, 0x30, 0x40, 0x7f, 0x1d, 0x52, 0xe9, 0x62, 0x06, 0xb8,
-  0x85, 0x14, 0x28, 0xcf, 0xa0, 0x66, 0x57, 0x09, 0x99, 0xfc, 0x31, 0xff,
-  0x89, 0x7e, 0xfe, 0x67, 0x58, 0x1d, 0xae, 0x8b, 0x0b, 0xa6, 0x3b, 0x66,
-  0xbb, 0x76, 0x15, 0xa1, 0xa8, 0x68, 0x8c, 0x5d, 0x6d, 0x3b, 0x06, 0xdb,
-  0x0d, 0x05, 0xc7, 0x08, 0x6d, 0x00, 0x36, 0xd3, 0xc0, 0x51, 0x67, 0x85,
-  0x40, 0xd6, 0x75, 0x04, 0xfe, 0xad, 0x24, 0xa5, 0xbe, 0x70, 0x58, 0xe3,
-  0x77, 0xb7, 0x68, 0x66, 0xc7, 0x41, 0x67, 0x46, 0x04, 0xad, 0x39, 0x93,
-  0xfd, 0x48, 0x3b, 0x76, 0xfe, 0x72, 0x15, 0x9f, 0x0f, 0x0e, 0x89, 0xf0,
-  0xb5, 0x2b, 0x40, 0xdf, 0x38, 0x72, 0x32, 0x39, 0xf8, 0x74, 0xb3, 0x2e,
-  0x35, 0xf7, 0x0b, 0x56, 0xb8, 0xcc, 0x36, 0x4d, 0x90, 0x04, 0xad, 0xba,
-  0x43, 0x7e, 0xea, 0xb8, 0x26, 0xdc, 0x63, 0x6c, 0x53, 0x2d, 0xa8, 0x74,
-  0xd3, 0x1b, 0xd0, 0x4f, 0x74, 0x46, 0xdb, 0x3b, 0x36, 0x81, 0x72, 0xb0,
-  0xa6, 0x6a, 0xe6, 0xe1, 0x9f, 0x5c, 0xe9, 0x93, 0x5b, 0xab, 0x1a, 0x6e,
-  0xca, 0xd5, 0x65, 0x56, 0xc9, 0x0d, 0x0e, 0x2f, 0x22, 0x63, 0x63, 0x2a,
-  0xff, 0xba, 0x62, 0x63, 0x89, 0xd0, 0xe8, 0x57, 0x67, 0x6f, 0xca, 0x66,
-  0x63, 0xa0, 0xc6, 0x69, 0x63, 0x30, 0xf7, 0xfa, 0xa0, 0x68, 0x05, 0x5f,
-  0xfc, 0x1c, 0x2c, 0x27, 0x3a, 0xf0, 0x67, 0xa0, 0x67, 0x63, 0xad, 0xe3,
-  0x1f, 0xdd, 0x8a, 0x26, 0x20, 0x66, 0xb6, 0xfe, 0x06, 0x68, 0x6e, 0xf8,
-  0x30, 0xe4, 0x17, 0xa5, 0xb9, 0x08, 0x0b, 0x7c, 0xe0, 0x38, 0x7f, 0xfe,
-  0x01, 0xd8, 0x11, 0xca, 0x0b, 0x1b, 0xf2, 0xfb, 0x89, 0x4e, 0xf4, 0x01,
-  0xf8, 0x09, 0x63, 0x8a, 0x6f, 0xaf, 0xff, 0x1f, 0x0b, 0x9c, 0xd7, 0x2f,
-  0x8a, 0x4e, 0xf8, 0xe3, 0x88, 0x4e, 0xf6, 0x8b, 0x56, 0x55, 0xf6, 0x03,
-  0x5e, 0xf6, 0x0c, 0xc8, 0xfa, 0x36, 0x8b, 0x06, 0xb6, 0x2e, 0xf2, 0x16,
-  0x2e, 0xf4, 0x57, 0x2a, 0xff, 0x66, 0xf2, 0xd1, 0x56, 0xf4, 0xe2, 0xf8,
-  0x6c, 0x1f, 0xfc, 0x82, 0xde, 0x54, 0x8b, 0x76, 0xf6, 0xb7, 0xc4, 0xf2,
-  0x11, 0x6b, 0x53, 0x37, 0x7e, 0xf2, 0x01, 0xc8, 0x11, 0xda, 0x3b, 0xbe,
-  0x5f, 0x5e, 0x1e, 0xc0, 0x0e, 0x3c, 0xcf, 0x08, 0x65, 0x31, 0xb0, 0xf6,
-  0xec, 0xe1, 0xe8, 0xc0, 0xb3, 0x6f, 0x40, 0xdb, 0x01, 0x39, 0xdb, 0x09,
-  0x20, 0xe1, 0x4b, 0x52, 0x54, 0x38, 0x35, 0x1f, 0xb0, 0x03, 0x72, 0x8e,
-  0x14, 0x99, 0x85, 0x2d, 0x59, 0x81, 0x3b, 0xa1, 0xb0, 0x72, 0x08, 0xd0,
-  0xb2, 0x3d, 0xa1, 0x4a, 0xc6, 0x58, 0x07, 0x21, 0x20, 0x60, 0x03, 0x58,
-  0xaa, 0x38, 0x37, 0x1c, 0x1b, 0x02, 0x6c, 0x46, 0x28, 0xdf, 0x04, 0xeb,
-  0x32, 0xe9, 0x61, 0x0c, 0xbb, 0x10, 0x80, 0x5b, 0x18, 0x45, 0x36, 0x0f,
-  0x40, 0x10, 0x80, 0xbc, 0xeb, 0x51, 0xcd, 0x7a, 0xcb, 0x68, 0x02, 0xf4,
-  0x9a, 0x3f, 0xa1, 0x0e, 0x00, 0x8f, 0xf0, 0x05, 0xdc, 0x73, 0x12, 0x0a,
-  0xe6, 0x56, 0x1c, 0x81, 0x6a, 0xa4, 0x72, 0x6c, 0x1c, 0x11, 0xe3, 0x75,
-  0x54, 0x61, 0x71, 0x8f, 0x62, 0x90, 0x6b, 0x1d, 0x85, 0x35, 0xa6, 0xbe,
-  0xed, 0x04, 0xe9, 0x89, 0x49, 0xde, 0x76, 0xfb, 0x68, 0x0e, 0x80, 0x4b,
-  0x0d, 0xa6, 0x2d, 0xab, 0xd3, 0x1a, 0xa3, 0xa5, 0xfa, 0x6b, 0x0d, 0xcf,
-  0xd8, 0x6d, 0xcb, 0x7d, 0xf6, 0xd9, 0x74, 0x5e, 0x27, 0xd8, 0x10, 0x6a,
-  0xb6, 0x44, 0xca, 0xe9, 0x29, 0x79, 0xf0, 0xc4, 0x1e, 0x3c, 0xfd, 0x87,
-  0x2d, 0x05, 0xff, 0x83, 0x09, 0xe9, 0x24, 0xc9, 0xea, 0x32, 0xeb, 0xbf,
-  0x51, 0x01, 0xf3, 0x73, 0xc3, 0xc1, 0x39, 0x29, 0x2e, 0x32, 0x70, 0xb6,
-  0x56, 0x4f, 0x2b, 0x08, 0x3e, 0x51, 0x1e, 0x79, 0x87, 0x99, 0x74, 0xb6,
-  0x27, 0xf0, 0x69, 0x0a, 0xdc, 0x94, 0x06, 0x58, 0x67, 0x97, 0xe5, 0x9a,
-  0x50, 0x31, 0xc1, 0xbf, 0xed, 0x8d, 0x44, 0x02, 0x95, 0xcb, 0x0d, 0x03,
-  0xe3, 0x9b, 0x3e, 0x8d, 0x5c, 0xb2, 0x02, 0x6a, 0x72, 0xbe, 0x50, 0x4e,
-  0xc7, 0x3e, 0x3e, 0x94, 0x02, 0x25, 0x3b, 0xa5, 0x28, 0x5f, 0xc9, 0x40,
-  0x63, 0x71, 0x10, 0xb4, 0x0c, 0xf0, 0xa3, 0x7e, 0x11, 0x65, 0xf2, 0x1d,
-  0x16, 0xe7, 0xa5, 0x03, 0x4a, 0x9b, 0xf6, 0x75, 0x4e, 0x16, 0x0e, 0xc6,
-  0x4e, 0xa2, 0xad, 0xa7, 0x4b, 0xf3, 0x12, 0x5e, 0x7c, 0x97, 0x69, 0xfa,
-  0xa1, 0x5a, 0x7e, 0x99, 0x6f, 0x67, 0x7a, 0x8b, 0x6e, 0x0e, 0x8b, 0x56,
-  0xbf, 0xde, 0x77, 0x64, 0x70, 0x19, 0x3b, 0x7c, 0x89, 0xfa, 0xc2, 0x83,
-  0xc2, 0xa2, 0xb5, 0x48, 0xbe, 0x78, 0x01, 0x56, 0xfa, 0x11, 0xd4, 0x26,
-  0x8e, 0xe6, 0x74, 0x17, 0x59, 0x74, 0x3c, 0x49, 0x3e, 0xf2, 0x16, 0x3b,
-  0x36, 0x4e, 0xb7, 0x5a, 0x4b, 0x26, 0x08, 0x5a, 0x26, 0xdf, 0x58, 0x80,
-  0x7f, 0x76, 0x12, 0x0a, 0x7f, 0xd6, 0x0e, 0x03, 0xdb, 0x14, 0xc3, 0x32,
-  0x34, 0x1f, 0xd1, 0x06, 0x9e, 0x01, 0x1a, 0xff, 0x95, 0xa3, 0xb6, 0x02,
-  0xfa, 0x1e, 0xcd, 0x12, 0x10, 0x2c, 0x75, 0xd3, 0x00, 0x61, 0x0a, 0xeb,
-  0xff, 0x73, 0x9a, 0x03, 0x4d, 0x3d, 0x89, 0xc0, 0xf8, 0x2b, 0xad, 0xef,
-  0x99, 0xed, 0xf2, 0x1b, 0x16, 0x25, 0xc3, 0xbb, 0x64, 0x1e, 0x05, 0x05,
-  0x81, 0x63, 0x7a, 0x5b, 0x8e, 0xc3, 0x8d, 0x01, 0xeb, 0x5b, 0x36, 0xd1,
-  0x81, 0x00, 0xb6, 0x66, 0x10, 0x6f, 0x1b, 0xe8, 0x47, 0x63, 0xe3, 0x3b,
-  0x56, 0xf6, 0x73, 0x6d, 0x3b, 0xe4, 0x42, 0x14, 0xb6, 0xb4, 0xf4, 0x5f,
-  0xf6, 0xe8, 0x19, 0x4d, 0x6d, 0xc8, 0xf0, 0x2b, 0x3b, 0x0d, 0x6d, 0xf8,
-  0x07, 0x1b, 0xf2, 0xf0, 0x13, 0x47, 0x35, 0x1d, 0x6d, 0x15, 0x0a, 0x73,
-  0x67, 0x11, 0x5b, 0x09, 0xfa, 0xda, 0x73, 0x15, 0xe4, 0xde, 0x14, 0xfb,
-  0x89, 0xf1, 0x1e, 0x4a, 0x73, 0x0d, 0x40, 0xb7, 0x7e, 0x26, 0x76, 0xfc,
-  0x16, 0x5b, 0x86, 0x87, 0x61, 0x14, 0xc5, 0x5e, 0xbe, 0x16, 0xc7, 0x01,
-  0x83, 0xd6, 0x95, 0x56, 0xbd, 0x36, 0x39, 0xc6, 0x73, 0x0b, 0x0c, 0x71,
-  0xbb, 0xff, 0x60, 0x7e, 0xfa, 0x4b, 0x42, 0xb8, 0x77, 0x89, 0xd2, 0xe8,
-  0xb9, 0xee, 0x4c, 0xb8, 0xb2, 0xa7, 0x9c, 0x4c, 0x3f, 0xe2, 0xa0, 0x8b,
-  0x52, 0xe4, 0x26, 0x88, 0x07, 0xe3, 0x47, 0x21, 0x0f, 0x47, 0x02, 0x89,
-  0xff, 0x42, 0x3b, 0x09, 0x0f, 0x07, 0x03, 0xff, 0x42, 0x5b, 0x1e, 0xe4,
-  0x00, 0xc3, 0x12, 0xb0, 0x0f, 0x34, 0x64, 0x04, 0x3b, 0x05, 0x08, 0x0e,
-  0x06, 0x43, 0xe9, 0x07, 0x0f, 0xbe, 0xd1, 0x44, 0x83, 0x1d, 0x8a, 0x81,
-  0x0e, 0xbb, 0xa2, 0xed, 0x58, 0x56, 0x30, 0x5c, 0x0d, 0x50, 0x62, 0x0b,
-  0xb8, 0x52, 0x0b, 0x5a, 0xb4, 0x36, 0xc4, 0x3c, 0x68, 0xb9, 0xd5, 0x42,
-  0xb8, 0x62, 0x09, 0xd8, 0xdf, 0x17, 0x76, 0xa0, 0x81, 0xfe, 0xfe, 0xfc,
-  0x01, 0x7f, 0x9a, 0x85, 0xd2, 0x75, 0x25, 0xc3, 0x85, 0xfb, 0x6d, 0xed,
-  0x2d, 0xc4, 0x3e, 0x47, 0xda, 0x01, 0xf7, 0x49, 0xe6, 0x5a, 0x09, 0x0e,
-  0x45, 0x01, 0xcb, 0x0a, 0x92, 0x02, 0xdb, 0x8d, 0xeb, 0xfb, 0x2e, 0x88,
-  0xc8, 0xfe, 0xc0, 0x10, 0x07, 0x88, 0x05, 0x65, 0x2f, 0xc9, 0x00, 0x72,
-  0x00, 0x58, 0x17, 0x88, 0xc6, 0x04, 0xbe, 0x41, 0x6d, 0x7c, 0x16, 0xb8,
-  0xeb, 0x6c, 0x3b, 0x3c, 0x0f, 0x8b, 0xc3, 0x6e, 0xe7, 0xd2, 0xff, 0x18,
-  0x32, 0x27, 0xec, 0x12, 0x09, 0xe6, 0x3b, 0x14, 0x04, 0xaa, 0x67, 0x19,
-  0x86, 0x8b, 0xba, 0x98, 0x8b, 0x30, 0x70, 0x7c, 0x6c, 0xf1, 0x4d, 0x4a,
-  0x7a, 0x34, 0x56, 0x2d, 0x27, 0x3b, 0x9d, 0x30, 0x1b, 0xad, 0xe8, 0x1e,
-  0xb7, 0xa1, 0x1d, 0x03, 0x16, 0x12, 0x42, 0xcd, 0x13, 0x50, 0x4b, 0xc3,
-  0x30, 0x76, 0x39, 0xdf, 0x3b, 0x4b, 0x6c, 0x1b, 0x1e, 0xdb, 0x0e, 0x16,
-  0x41, 0x0f, 0xaf, 0x4d, 0x58, 0xcd, 0xd7, 0x5a, 0xce, 0xd2, 0x2e, 0x06,
-  0xe4, 0x39, 0x60, 0xbf, 0x16, 0xe8, 0x82, 0x4b, 0x09, 0x48, 0xc2, 0x07,
-  0x74, 0x1c, 0x20, 0x28, 0x4d, 0x98, 0x5c, 0x6a, 0x13, 0x5b, 0x02, 0x1a,
-  0x06, 0x86, 0x25, 0x8d, 0x8c, 0x0c, 0x5d, 0x39, 0xee, 0x28, 0x16, 0x56,
-  0x60, 0x82, 0x71, 0x1f, 0xad, 0x1f, 0xd3, 0x8d, 0xc2, 0xf6, 0xc7, 0x11,
-  0xf8, 0xfd, 0x0e, 0xfb, 0x6c, 0x82, 0x56, 0x6a, 0xaf, 0x16, 0x82, 0x4c,
-  0xe9, 0x86, 0x58, 0xae, 0x0a, 0x76, 0x1b, 0x8a, 0xfc, 0x19, 0x2a, 0xf6,
-  0x33, 0x4d, 0x83, 0x4a, 0x8c, 0x2b, 0xf7, 0xf8, 0x03, 0x44, 0x01, 0xad,
-  0x7f, 0x11, 0xfb, 0x39, 0xde, 0x72, 0xdc, 0x1f, 0x91, 0xfc, 0xc0, 0x77,
-  0xd5, 0x87, 0x52, 0x7c, 0x74, 0x3b, 0x1c, 0xd4, 0x02, 0x22, 0xaa, 0x3b,
-  0x03, 0x4c, 0xff, 0xec, 0xe8, 0xe8, 0x4a, 0x88, 0xb0, 0x37, 0x66, 0xc0,
-  0x80, 0xbf, 0xa3, 0x90, 0x04, 0xed, 0xb8, 0x5d, 0x1a, 0x8c, 0x2e, 0x36,
-  0x84, 0x0f, 0x68, 0x7b, 0xdf, 0x8a, 0x97, 0x15, 0x42, 0x8b, 0xd2, 0x15,
-  0x1b, 0xb3, 0x0e, 0x0d, 0xc7, 0x20, 0x85, 0x43, 0xd7, 0xec, 0x0a, 0x7e,
-  0xd1, 0xce, 0x1c, 0x0b, 0x08, 0x0b, 0xe0, 0xeb, 0xa3, 0x2c, 0x22, 0x7d,
-  0xea, 0x8d, 0x46, 0xea, 0x0b, 0x01, 0x60, 0xe0, 0x8a, 0x46, 0xf1, 0xd8,
-  0x50, 0xd1, 0xeb, 0xfb, 0xea, 0x09, 0x65, 0xee, 0x6c, 0x07, 0xec, 0x5b,
-  0x36, 0xd3, 0xdf, 0xe0, 0x09, 0x0e, 0xef, 0x27, 0x0b, 0x22, 0xf6, 0x3d,
-  0x12, 0xdb, 0xea, 0x59, 0x47, 0xb3, 0x16, 0x0a, 0x9a, 0xeb, 0x17, 0xe9,
-  0x4a, 0x2a, 0x06, 0x8c, 0x5d, 0x5e, 0xf0, 0x6e, 0x12, 0x89, 0x5e, 0xe9,
-  0x48, 0xf1, 0x2e, 0xc3, 0xef, 0x10, 0x81, 0x6e, 0xee, 0xbc, 0xed, 0x07,
-  0xb1, 0x09, 0xf1, 0xb2, 0xee, 0x4a, 0x19, 0x18, 0x2e, 0x19, 0xce, 0xf9,
-  0x0e, 0x11, 0x39, 0x9b, 0x84, 0x1e, 0x3a, 0x2c, 0x06, 0x87, 0xe9, 0xf0,
-  0x47, 0xfe, 0xb8, 0x0a, 0xb9, 0xa9, 0x8f, 0x5e, 0x90, 0xbc, 0x11, 0x30,
-  0x52, 0x24, 0x2a, 0xe4, 0x35, 0x92, 0x1b, 0x35, 0xdb, 0x0b, 0xfb, 0x5a,
-  0xfb, 0x53, 0xa1, 0x5c, 0x53, 0xb9, 0x0f, 0x55, 0xbe, 0xee, 0x60, 0xe9,
-  0x22, 0x01, 0xf9, 0x24, 0x6a, 0xde, 0x1e, 0x15, 0xf9, 0xa3, 0x1c, 0x01,
-  0x5a, 0x1d, 0xd6, 0x24, 0x30, 0xfb, 0x8c, 0xd8, 0xeb, 0xdd, 0x1c, 0xe5,
-  0x4d, 0xab, 0x52, 0x42, 0x7c, 0xa3, 0x63, 0x08, 0x7d, 0xb3, 0x01, 0x8d,
-  0x94, 0xd8, 0xa3, 0xd6, 0x11, 0xc1, 0x09, 0xa8, 0x1e, 0xd9, 0x31, 0xd6,
-  0x9c, 0x73, 0x2e, 0xff, 0xa1, 0xd8, 0xfb, 0x9a, 0x03, 0x25, 0x44, 0xee,
-  0x89, 0x97, 0xda, 0x09, 0x6e, 0x17, 0x01, 0x1e, 0xcf, 0x11, 0x3b, 0x1e,
-  0x83, 0x8e, 0xc1, 0x77, 0x04, 0x40, 0x1f, 0x76, 0x42, 0x3b, 0x16, 0x0a,
-  0xe1, 0x76, 0xd9, 0xb1, 0x3e, 0x31, 0xb8, 0xac, 0x6c, 0x6a, 0x39, 0xc9,
-  0xf0, 0x51, 0xad, 0x8d, 0x37, 0xcb, 0xff, 0xb7, 0xb8, 0xba, 0xd1, 0x13,
-  0x56, 0x6e, 0x04, 0x42, 0xa1, 0xdf, 0x2a, 0x48, 0x39, 0xc2, 0x76, 0xee,
-  0xe5, 0xb8, 0xd6, 0x26, 0x9e, 0x43, 0x5a, 0x24, 0x4b, 0xf3, 0xbc, 0x5d,
-  0xb1, 0x92, 0xc4, 0x7c, 0x62, 0xce, 0x76, 0x53, 0x7e, 0x3e, 0x8b, 0xb7,
-  0xdb, 0x60, 0x4a, 0x08, 0x19, 0x87, 0x76, 0x89, 0x87, 0x4b, 0xd2, 0x4a,
-  0x9f, 0xfb, 0x7f, 0xef, 0x89, 0x36, 0x08, 0x45, 0xbe, 0x54, 0xf9, 0x03,
-  0x7c, 0xd8, 0xc3, 0x75, 0x9b, 0xd8, 0xf4, 0x38, 0x21, 0x79, 0x04, 0x05,
-  0x72, 0xe0, 0x38, 0x53, 0xcd, 0x78, 0x26, 0xc6, 0xf4, 0x50, 0x07, 0xfc,
-  0xe2, 0x43, 0x5d, 0x58, 0xc9, 0x92, 0x8d, 0x0a, 0xb1, 0x52, 0x3b, 0xc2,
-  0x4f, 0xb2, 0xf7, 0xf6, 0xa1, 0x24, 0x05, 0x50, 0xf8, 0xce, 0x54, 0x85,
-  0x1b, 0x68, 0x83, 0xc6, 0x7e, 0xf4, 0x5f, 0xd7, 0x23, 0x18, 0x78, 0x1f,
-  0xa1, 0x9f, 0x63, 0x18, 0xf4, 0x5f, 0x9b, 0x00, 0xb6, 0x8a, 0x07, 0xa2,
-  0x2d, 0x87, 0xd5, 0xe8, 0x94, 0xa2, 0x68, 0xee, 0xa4, 0xda, 0xb8, 0x13,
-  0xdd, 0x49, 0x8c, 0x5f, 0x4c, 0xbc, 0x9a, 0x18, 0xc3, 0x2e, 0x72, 0x8b,
-  0xe3, 0x66, 0xc5, 0xa1, 0x4b, 0xd0, 0x6d, 0x17, 0x05, 0x97, 0xf2, 0x57,
-  0x01, 0x12, 0xc6, 0xfb, 0xd1, 0xe6, 0x8a, 0x94, 0x95, 0x5d, 0x0b, 0x02,
-  0x5f, 0xc1, 0x02, 0x8e, 0x40, 0xe7, 0xd9, 0x7c, 0xd3, 0x50, 0xb3, 0xc5,
-  0x86, 0x13, 0xf2, 0x6c, 0x02, 0xf2, 0xb5, 0xf4, 0x6b, 0x12, 0xba, 0xa6,
-  0x25, 0xbe, 0x08, 0x6a, 0x05, 0x5d, 0xfc, 0xa2, 0xad, 0x64, 0x05, 0xe6,
-  0xf4, 0xa2, 0x67, 0xd0, 0xf2, 0xa2, 0xac, 0x05, 0x7c, 0xd3, 0x3a, 0x61,
-  0xa3, 0x72, 0x8d, 0x5b, 0xae, 0xa3, 0xc3, 0x64, 0x63, 0xaa, 0x5b, 0x6e,
-  0x8d, 0x06, 0xda, 0xfe, 0xb9, 0x10, 0xc9, 0x90, 0x89, 0x77, 0xa9, 0xb2,
-  0x6e, 0x63, 0xc1, 0x08, 0xb9, 0xa5, 0x63, 0x63, 0x61, 0xeb, 0x1c, 0x6d,
-  0xdb, 0x18, 0xf4, 0x85, 0xdb, 0x74, 0x37, 0xbd, 0x07, 0x06, 0x75, 0x19,
-  0x8d, 0xd5, 0x13, 0x9c, 0x7a, 0x98, 0x5a, 0x5b, 0xec, 0x71, 0xb3, 0x37,
-  0x07, 0x2c, 0x58, 0x8c, 0x86, 0xdd, 0xf4, 0x89, 0xb8, 0xba, 0x61, 0x14,
-  0x9e, 0x68, 0x08, 0xee, 0x23, 0xe8, 0x96, 0x3e, 0x96, 0x83, 0xa7, 0x47,
-  0xcf, 0x01, 0x7c, 0x96, 0x02, 0x9e, 0x3c, 0x15, 0x8d, 0xba, 0x6b, 0x0e,
-  0x07, 0x78, 0x15, 0xb8, 0x15, 0xba, 0x51, 0xa6, 0xe9, 0x31, 0x6c, 0xac,
-  0x04, 0xad, 0xdb, 0x18, 0x66, 0x6b, 0x31, 0xb2, 0x09, 0x85, 0x16, 0x5f,
-  0x0f, 0x5c, 0x16, 0x6b, 0xb1, 0xba, 0x99, 0xb4, 0xe4, 0x51, 0xfd, 0x0f,
-  0xc2, 0x5d, 0xb4, 0xa1, 0x13, 0x4d, 0xa6, 0x05, 0xb9, 0xa0, 0xb3, 0x2d,
-  0x3e, 0xc2, 0x9d, 0xa0, 0x0f, 0x1e, 0x66, 0xd9, 0x5e, 0xd0, 0xa7, 0x0d,
-  0x0c, 0x8c, 0xd0, 0x87, 0x6a, 0x33, 0x14, 0x7b, 0x4b, 0xa9, 0xfa, 0x95,
-  0x01, 0xd8, 0x7f, 0x01, 0x02, 0x43, 0x20, 0xe1, 0xfa, 0xa2, 0x66, 0x26,
-  0x09, 0x0c, 0xd2, 0x35, 0xb1, 0xa1, 0x73, 0x24, 0xb6, 0x89, 0x1e, 0x73,
-  0x1e, 0xdd, 0xfc, 0x40, 0xe4, 0x4e, 0x25, 0xde, 0x08, 0x63, 0x46, 0x83,
-  0xfe, 0x37, 0x5d, 0x60, 0x8b, 0x68, 0x51, 0x17, 0xb0, 0x90, 0x52, 0x68,
-  0x03, 0xe8, 0x06, 0xc3, 0x99, 0x13, 0xe8, 0x08, 0xd1, 0x65, 0x35, 0x4e,
-  0x4b, 0xdc, 0x05, 0x1e, 0x8c, 0x63, 0x38, 0xe8, 0xd4, 0x94, 0xad, 0x4a,
-  0x53, 0x68, 0x05, 0x15, 0x3c, 0x5a, 0x49, 0xde, 0x11, 0x83, 0x06, 0x36,
-  0xdf, 0x21, 0x11, 0x06, 0x38, 0x52, 0x08, 0x5d, 0xdb, 0x21, 0x05, 0xf2,
-  0x2c, 0x1b, 0xbc, 0xfa, 0x07, 0x7f, 0x2e, 0x1f, 0x04, 0x06, 0x17, 0x62,
-  0x50, 0x36, 0x33, 0x49, 0x68, 0xfc, 0x6d, 0x7e, 0xe9, 0x79, 0x2d, 0x77,
-  0x58, 0x9c, 0xdd, 0x2c, 0x4d, 0x30, 0x05, 0x05, 0xa3, 0x2b, 0x00, 0x64,
-  0xfa, 0xd9, 0x5c, 0x8f, 0xc7, 0x4a, 0xb6, 0xd4, 0x03, 0xbb, 0xbe, 0xb8,
-  0x2f, 0x3b, 0xa6, 0x14, 0xec, 0x0e, 0xeb, 0x41, 0x24, 0x2b, 0x9b, 0x68,
-  0xef, 0x35, 0x2f, 0x0c, 0xeb, 0x1c, 0x70, 0xe5, 0xf1, 0x31, 0x8e, 0xa2,
-  0xf1, 0xfb, 0x49, 0xf8, 0xe9, 0x5c, 0xe9, 0xd2, 0xfe, 0x5c, 0x34, 0x47,
-  0xff, 0x0c, 0x71, 0xd4, 0x02, 0x6b, 0x26, 0xce, 0x61, 0x77, 0x46, 0x7c,
-  0xc0, 0xfe, 0xe8, 0xce, 0x4b, 0xc0, 0xf8, 0x46, 0xd9, 0x4c, 0x12, 0xba,
-  0x2e, 0x5a, 0x66, 0x13, 0x5f, 0xad, 0x2f, 0x89, 0x8b, 0x8e, 0x7a, 0x30,
-  0xc0, 0x3d, 0xba, 0xbc, 0x16, 0xd8, 0x09, 0x08, 0x51, 0x1a, 0x28, 0x49,
-  0xd0, 0xb9, 0xb7, 0x85, 0x8a, 0x67, 0x4d, 0x87, 0x06, 0xfe, 0xeb, 0xcf,
-  0xb1, 0x0f, 0x8b, 0x07, 0xd3, 0xdd, 0xd5, 0xb1, 0x04, 0xff, 0x06, 0x25,
-  0x0f, 0x00, 0xbe, 0x10, 0xe0, 0x00, 0x29, 0xc6, 0xd5, 0x01, 0xb6, 0xdf,
-  0x50, 0x10, 0xb7, 0x2e, 0x24, 0x0f, 0xcb, 0xd3, 0xe0, 0xc5, 0x34, 0x58,
-  0xd6, 0x08, 0x50, 0x03, 0x05, 0xf5, 0x73, 0x0a, 0x8a, 0x4f, 0xbb, 0x75,
-  0x80, 0x00, 0x20, 0x77, 0xeb, 0x07, 0x54, 0x37, 0x2b, 0xf7, 0xd8, 0x43,
-  0x5c, 0x39, 0x1f, 0x0a, 0xae, 0x06, 0x3c, 0xa9, 0xd8, 0xd5, 0xb6, 0xe0,
-  0x29, 0x05, 0x0a, 0x67, 0x50, 0x07, 0x05, 0x71, 0x6e, 0x7c, 0x44, 0x01,
-  0xec, 0x53, 0x7f, 0xd1, 0xd9, 0x14, 0x07, 0x64, 0x04, 0x36, 0x3f, 0xba,
-  0x6b, 0x50, 0xd9, 0xa0, 0x06, 0x1b, 0x05, 0x09, 0xa5, 0x04, 0x6c, 0x23,
-  0x61, 0xd8, 0xe0, 0x34, 0x39, 0x77, 0x8e, 0x57, 0x44, 0x0a, 0x3a, 0x4d,
-  0xc3, 0xcf, 0x57, 0xb1, 0x03, 0xe4, 0xd3, 0xe0, 0x01, 0x0e, 0x09, 0xfd,
-  0x3f, 0x44, 0x08, 0xf3, 0x35, 0xb1, 0x4d, 0xaa, 0x08, 0xfe, 0xe9, 0xf1,
-  0xfe, 0x7e, 0x15, 0x83, 0x15, 0x0d, 0x42, 0xee, 0x8d, 0x15, 0x92, 0x01,
-  0xff, 0x1e, 0x17, 0x26, 0x17, 0x45, 0x17, 0x97, 0x17, 0x9b, 0xab, 0xe6,
-  0x1a, 0xee, 0x06, 0x1b, 0xeb, 0x03, 0x61, 0x01, 0x79, 0xf0, 0x1a, 0x7a,
-  0xf5, 0x1a, 0xfa, 0x17, 0xa6, 0x1a, 0xb8, 0x89, 0x24, 0x4d, 0x72, 0xeb,
-  0x58, 0x5d, 0x04, 0x26, 0xe6, 0x36, 0xa6, 0xa3, 0xba, 0x38, 0xf6, 0x5a,
-  0x80, 0x3b, 0x06, 0x00, 0x08, 0x2e, 0x42, 0x34, 0x79, 0x28, 0x1c, 0x2f,
-  0x44, 0x20, 0xb3, 0x21, 0xb0, 0x27, 0x38, 0x5b, 0x1b, 0xef, 0xfa, 0x19,
-  0x24, 0xe0, 0x16, 0xa1, 0x69, 0xc6, 0x16, 0x44, 0xd7, 0xd8, 0x22, 0x3b,
-  0x4d, 0x06, 0x06, 0x4b, 0x3b, 0xfe, 0x04, 0xc0, 0x24, 0x1a, 0xda, 0xb9,
-  0x0b, 0x81, 0x6d, 0x43, 0x0c, 0xda, 0xc3, 0x63, 0x4e, 0xed, 0x48, 0xc5,
-  0x63, 0xb1, 0x11, 0xc9, 0x34, 0x15, 0x07, 0x0b, 0xd2, 0xc7, 0x2a, 0x35,
-  0x79, 0x80, 0x0d, 0xd0, 0x08, 0xad, 0xef, 0x26, 0x70, 0x14, 0x15, 0xf0,
-  0xad, 0x12, 0x3c, 0x99, 0xcb, 0xd7, 0x2f, 0xcd, 0x0a, 0x4d, 0xb5, 0xeb,
-  0xbe, 0x0b, 0x12, 0x02, 0x4d, 0xb3, 0x54, 0xbb, 0x59, 0x1a, 0x2d, 0xb9,
-  0x11, 0xef, 0x2f, 0x5f, 0x73, 0x5d, 0x2d, 0x36, 0x20, 0xcd, 0xbd, 0x1c,
-  0x3c, 0x08, 0x81, 0x3a, 0xeb, 0x11, 0xd9, 0x33, 0xb5, 0xab, 0x0a, 0x3a,
-  0x64, 0xaf, 0x69, 0x83, 0xb2, 0x95, 0xa3, 0xba, 0xb5, 0xf0, 0x29, 0xf3,
-  0xd5, 0x85, 0xe3, 0x68, 0x07, 0x17, 0xd8, 0x54, 0x4d, 0x04, 0xbb, 0x6e,
-  0xb7, 0x5b, 0x05, 0x18, 0x59, 0xb6, 0x92, 0xc7, 0xc5, 0x2b, 0x6b, 0x99,
-  0x18, 0xf6, 0xd1, 0xe8, 0xb8, 0xcd, 0xc1, 0x06, 0x1b, 0xaa, 0xbf, 0xef,
-  0x63, 0x74, 0x49, 0x4c, 0x7e, 0x45, 0xa1, 0x00, 0x36, 0xae, 0x99, 0x0d,
-  0x76, 0x6f, 0x65, 0x75, 0xf4, 0x3b, 0x76, 0x70, 0x75, 0xee, 0xc8, 0x52,
-  0xda, 0x46, 0xce, 0xf0, 0xd5, 0xd9, 0x1e, 0xc7, 0x6d, 0x73, 0x10, 0x9a,
-  0x5b, 0xcd, 0x69, 0x68, 0x65, 0xcb, 0x46, 0x03, 0xc2, 0x36, 0x89, 0xb2,
-  0x33, 0x1b, 0xb7, 0x6d, 0x9b, 0x47, 0x36, 0x6b, 0x66, 0xc7, 0x9a, 0x72,
-  0xeb, 0x5f, 0xa3, 0x58, 0x6e, 0x89, 0x62, 0xdd, 0x8b, 0x97, 0x93, 0x16,
-  0x6b, 0x45, 0xde, 0x17, 0x48, 0xee, 0xa3, 0xcb, 0xdc, 0x70, 0x4b, 0x05,
-  0xe2, 0x12, 0x43, 0xd0, 0x53, 0xcd, 0xa3, 0x23, 0x6b, 0x03, 0x2b, 0x74,
-  0x53, 0x56, 0x68, 0xe4, 0x6c, 0x96, 0x6f, 0x32, 0xbf, 0x12, 0xe9, 0x9c,
-  0x00, 0x46, 0x6b, 0x56, 0x60, 0x0d, 0xfb, 0x5e, 0x83, 0xbf, 0x38, 0x5a,
-  0x7d, 0x2d, 0xe8, 0xd5, 0xeb, 0xea, 0xbf, 0xa8, 0x7c, 0x0b, 0x81, 0xbf,
-  0x4c, 0x6d, 0x0d, 0x02, 0xbc, 0x0e, 0xe9, 0xf3, 0xfe, 0xbb, 0x7e, 0x70,
-  0xf0, 0x3b, 0x14, 0x49, 0x66, 0xc1, 0x6e, 0x80, 0xb8, 0x94, 0xed, 0x47,
-  0x27, 0x32, 0x3e, 0x5f, 0x4c, 0xa1, 0xd9, 0x84, 0x8b, 0xed, 0x1e, 0x74,
-  0xcb, 0x8b, 0x0e, 0xe8, 0xdb, 0x16, 0x58, 0x0a, 0xc7, 0x34, 0xc9, 0xbf,
-  0x0b, 0x58, 0xd1, 0xea, 0xd1, 0xee, 0xd8, 0xa3, 0xbf, 0xa5, 0x7d, 0x37,
-  0xc9, 0xd3, 0x03, 0xc7, 0x4c, 0xcd, 0xd6, 0x2c, 0x95, 0x1a, 0x3a, 0xea,
-  0xb9, 0xec, 0x95, 0xd9, 0x31, 0xd8, 0xba, 0x29, 0xc7, 0x68, 0xc6, 0x41,
-  0x06, 0xc5, 0x5c, 0x08, 0x73, 0x6b, 0xd8, 0x80, 0xbc, 0x0a, 0xa3, 0x6c,
-  0x63, 0x1f, 0x3f, 0xc6, 0x90, 0xf7, 0x3c, 0x37, 0x58, 0x9d, 0x10, 0x1a,
-  0x68, 0x38, 0xb7, 0x6e, 0x36, 0xba, 0x35, 0xc7, 0x40, 0x85, 0x41, 0xc0,
-  0xa0, 0x64, 0xff, 0x9a, 0xc7, 0x48, 0x3d, 0x05, 0x00, 0xc1, 0x77, 0x22,
-  0xff, 0xef, 0x2e, 0xff, 0xa7, 0x50, 0x12, 0xff, 0xbb, 0x68, 0x01, 0xeb,
-  0x22, 0xbb, 0xb0, 0x04, 0xf0, 0xeb, 0x1d, 0xbb, 0xd0, 0x6f, 0x46, 0x18,
-  0xbb, 0xa0, 0xa1, 0x05, 0x8f, 0x7e, 0xbb, 0x40, 0x0b, 0xeb, 0x0e, 0xee,
-  0x09, 0x57, 0xb8, 0xfa, 0xe9, 0x86, 0x52, 0x85, 0x2a, 0xbf, 0x61, 0x05,
-  0xd9, 0x0a, 0xd0, 0x00, 0xb6, 0xd8, 0x99, 0xc0, 0x08, 0xc8, 0x14, 0xb0,
-  0xa3, 0x84, 0x0b, 0xa4, 0xea, 0xe1, 0x50, 0xf8, 0x61, 0xbf, 0xc2, 0x67,
-  0x4a, 0x08, 0xa3, 0x61, 0x96, 0x65, 0x59, 0x9a, 0xc7, 0xc9, 0x60, 0xb3,
-  0xb0, 0x5b, 0x04, 0xa4, 0x07, 0x50, 0x53, 0x90, 0x52, 0xc2, 0x62, 0x4e,
-  0x27, 0x09, 0x17, 0xaa, 0xc4, 0x30, 0x3c, 0xa0, 0x81, 0x0e, 0x5d, 0xff,
-  0xeb, 0x0e, 0x1b, 0x40, 0x26, 0x5e, 0x6d, 0x83, 0x30, 0x0f, 0x9a, 0x2a,
-  0x08, 0x14, 0xfb, 0x70, 0x40, 0xeb, 0x57, 0xcd, 0xae, 0x3b, 0xca, 0xf1,
-  0x72, 0x08, 0x75, 0x4c, 0xfa, 0xaf, 0x73, 0x46, 0xeb, 0xc7, 0xf8, 0x01,
-  0x6c, 0x01, 0x16, 0x99, 0x22, 0x1d, 0x1c, 0x53, 0x93, 0x45, 0x76, 0x34,
-  0x3d, 0xdc, 0x08, 0xba, 0x2b, 0x8e, 0x2a, 0x40, 0xcb, 0x1b, 0x9a, 0xa3,
-  0x21, 0x71, 0xa3, 0x00, 0xac, 0xab, 0xd0, 0xb9, 0x19, 0xd0, 0x1d, 0xd0,
-  0xba, 0xaa, 0x93, 0x5d, 0x67, 0xbb, 0x19, 0xa8, 0x32, 0x37, 0x7d, 0xe6,
-  0x54, 0x14, 0xa1, 0xab, 0x25, 0xb6, 0x36, 0x90, 0x05, 0x20, 0xe8, 0xa9,
-  0xc6, 0xb3, 0xb5, 0xe1, 0x8d, 0x45, 0xff, 0x9f, 0xe4, 0x2e, 0x1c, 0x5c,
-  0x12, 0x4f, 0xa5, 0x01, 0xe1, 0xe9, 0xfd, 0x00, 0x46, 0xc0, 0x7b, 0x6e,
-  0x64, 0x7a, 0x90, 0x01, 0x76, 0x16, 0xff, 0x03, 0x74, 0xa2, 0xf2, 0x6d,
-  0xcb, 0xe9, 0xd6, 0xb7, 0x0a, 0x66, 0x26, 0xdb, 0x04, 0x23, 0xbb, 0x35,
-  0x0e, 0x6c, 0x36, 0xb9, 0x9d, 0xbd, 0xab, 0x06, 0xb3, 0xb2, 0xce, 0x09,
-  0xe7, 0x8e, 0x2f, 0x91, 0x2c, 0xd9, 0x7b, 0x3f, 0x4b, 0xce, 0x1b, 0x16,
-  0xf3, 0x73, 0xd9, 0x21, 0xff, 0xa4, 0x6c, 0x64, 0x2d, 0x7e, 0x59, 0x3f,
-  0xe9, 0x82, 0x00, 0xfb, 0x51, 0xff, 0x29, 0x39, 0x0d, 0xc6, 0x22, 0xef,
-  0x73, 0x05, 0x65, 0x90, 0xff, 0x2f, 0x29, 0x0a, 0x2c, 0x28, 0x8c, 0x2e,
-  0x8c, 0x15, 0x94, 0xdd, 0x5f, 0x21, 0x06, 0x23, 0x2f, 0x23, 0xf3, 0xb3,
-  0x3e, 0x5d, 0x93, 0x18, 0xc1, 0x75, 0x10, 0xae, 0xa2, 0x21, 0xc9, 0xe4,
-  0x2e, 0xf1, 0xe9, 0x75, 0xff, 0xae, 0xc0, 0x6d, 0x0d, 0xc4, 0x83, 0xe3,
-  0x00, 0xa0, 0x62, 0xba, 0xe2, 0xc1, 0x10, 0x53, 0xee, 0xb7, 0x28, 0x9a,
-  0xbb, 0x04, 0x9e, 0x0e, 0x17, 0x04, 0x7d, 0xc5, 0x9e, 0x22, 0xba, 0xf4,
-  0x92, 0x08, 0x72, 0xb2, 0x55, 0x73, 0x07, 0xf6, 0x06, 0x74, 0xd4, 0x0d,
-  0x71, 0x37, 0x63, 0x2d, 0x50, 0xee, 0x51, 0xb8, 0xe8, 0x43, 0x9a, 0x77,
-  0x06, 0xfc, 0x1e, 0x80, 0x75, 0x4b, 0xe9, 0x23, 0xb7, 0x0b, 0x9f, 0x66,
-  0x2e, 0x3c, 0x30, 0x8e, 0x53, 0x3e, 0x09, 0xa2, 0x6e, 0x36, 0x14, 0x9f,
-  0x51, 0xe8, 0x60, 0x8d, 0xf4, 0x9b, 0xb5, 0x6c, 0x8f, 0xbe, 0xfe, 0xff,
-  0x04, 0x7c, 0x45, 0xf8, 0x77, 0x18, 0xb7, 0x6d, 0x2b, 0x7e, 0x0b, 0x88,
-  0x4f, 0x3e, 0x27, 0x00, 0x2c, 0xc4, 0x66, 0xfc, 0xf4, 0x3c, 0x24, 0x72,
-  0x07, 0x3f, 0x41, 0x24, 0xeb, 0x27, 0xd9, 0x3c, 0x12, 0x0a, 0xfc, 0x12,
-  0xeb, 0x1c, 0x3c, 0x0f, 0x9c, 0x0f, 0x0b, 0x5c, 0x3c, 0xd0, 0x09, 0x76,
-  0xb6, 0x9a, 0x09, 0x35, 0xf1, 0x05, 0xe9, 0x7b, 0x33, 0x19, 0x31, 0x99,
-  0xbf, 0xb3, 0xdc, 0xa1, 0x14, 0xc7, 0xb7, 0xa0, 0x67, 0xa1, 0x5b, 0x40,
-  0xe5, 0x4a, 0x76, 0x7b, 0xd5, 0x2d, 0x0f, 0x30, 0xd2, 0xe4, 0xf3, 0xe1,
-  0x07, 0x55, 0xb0, 0x54, 0xd8, 0x9b, 0xe4, 0xd1, 0xa2, 0x84, 0xdd, 0xfd,
-  0x38, 0x3c, 0xbc, 0xc4, 0x13, 0xb8, 0x8f, 0xd9, 0xa1, 0x2d, 0xe4, 0x31,
-  0x77, 0x8e, 0x3d, 0x24, 0x81, 0xee, 0x84, 0x20, 0x89, 0xdd, 0xac, 0x20,
-  0x80, 0x3b, 0xcd, 0x3d, 0xe9, 0xf7, 0xb7, 0x88, 0x5e, 0x73, 0x2c, 0x82,
-  0x38, 0x56, 0xc9, 0xc9, 0xba, 0xf1, 0x28, 0x57, 0x68, 0x0e, 0x4f, 0x30,
-  0xb8, 0x33, 0xb6, 0x0c, 0x0f, 0x47, 0x6b, 0x04, 0x50, 0x7c, 0x34, 0x4f,
-  0x07, 0x72, 0x12, 0xcc, 0x83, 0xd9, 0x62, 0x26, 0x45, 0xb4, 0x4d, 0x13,
-  0x73, 0x0b, 0x3e, 0x5b, 0x75, 0x1f, 0x27, 0x8c, 0x79, 0x32, 0x8f, 0x14,
-  0x3d, 0xeb, 0xfc, 0x05, 0xb8, 0x67, 0x0c, 0xeb, 0x90, 0xae, 0x68, 0xeb,
-  0x74, 0x47, 0xa1, 0xaf, 0x9a, 0xeb, 0x27, 0x0b, 0xc2, 0x81, 0xfa, 0xd0,
-  0xfd, 0x72, 0x06, 0xf7, 0xc2, 0xff, 0x02, 0xd8, 0xf5, 0xe8, 0x09, 0xf3,
-  0x61, 0xed, 0x6d, 0x2b, 0x85, 0xa1, 0x11, 0xfc, 0xe8, 0x52, 0x53, 0xe8,
-  0xcb, 0xf2, 0x9c, 0x57, 0x02, 0x26, 0x60, 0x6b, 0x14, 0x71, 0x4d, 0x7b,
-  0x42, 0xeb, 0x47, 0x23, 0xee, 0x89, 0x13, 0x95, 0xa3, 0x1f, 0x42, 0x1e,
-  0xb4, 0x25, 0x0c, 0x2e, 0x3d, 0xa3, 0x78, 0x15, 0x1f, 0xa2, 0x60, 0xb1,
-  0x7a, 0xa1, 0xd7, 0x54, 0x6e, 0xa4, 0x8c, 0xcc, 0x9a, 0x2c, 0x24, 0x85,
-  0xe4, 0x13, 0xbb, 0xd4, 0x19, 0xb0, 0x80, 0x2c, 0xfb, 0x54, 0x8f, 0xf2,
-  0xc2, 0xd0, 0xcd, 0xd6, 0xc1, 0x52, 0xdf, 0xfb, 0x67, 0x04, 0x26, 0x09,
-  0xcb, 0x55, 0xb6, 0xef, 0xf2, 0xd6, 0x13, 0x74, 0x86, 0x0e, 0x1a, 0x6e,
-  0x77, 0x02, 0x0d, 0xd9, 0x33, 0x4c, 0xd5, 0x8e, 0xe9, 0x7e, 0x52, 0xeb,
-  0x8d, 0x3d, 0xc2, 0x7b, 0x76, 0x18, 0xa9, 0xc1, 0x43, 0x72, 0x5d, 0x40,
-  0x1d, 0x2e, 0xbe, 0x2c, 0xf8, 0x33, 0x47, 0x1b, 0x3c, 0x74, 0x53, 0x2d,
-  0x4b, 0x5a, 0x3d, 0xa5, 0x0f, 0xc7, 0x90, 0x29, 0x60, 0x68, 0x58, 0xc7,
-  0x58, 0x5a, 0x68, 0x37, 0x56, 0x1b, 0x04, 0xf2, 0x32, 0xba, 0x2a, 0xf2,
-  0x2d, 0xba, 0x0c, 0xf2, 0x28, 0xba, 0x16, 0xf2, 0x23, 0xba, 0x14, 0xf0,
-  0x1e, 0xeb, 0x44, 0x1d, 0x39, 0x67, 0x76, 0x49, 0xe4, 0x2b, 0x19, 0x62,
-  0xf3, 0x0c, 0xa7, 0x4e, 0xd7, 0xdb, 0x27, 0x52, 0x0f, 0xe6, 0xd6, 0xdf,
-  0xc7, 0x2b, 0xb8, 0xd6, 0x9f, 0xf1, 0x30, 0xf6, 0x6b, 0xea, 0xb7, 0x7f,
-  0x77, 0x07, 0x88, 0xd4, 0x30, 0xd0, 0x73, 0xbb, 0x16, 0x75, 0x9a, 0xf1,
-  0xdc, 0x53, 0xa3, 0x32, 0x52, 0x0b, 0x42, 0x34, 0x97, 0x52, 0xa3, 0x3a,
-  0x74, 0x08, 0x3c, 0xcd, 0xf7, 0x44, 0xb5, 0x56, 0xdb, 0xae, 0x84, 0x10,
-  0xe8, 0x19, 0x1e, 0x3c, 0x39, 0xbb, 0xa8, 0xda, 0xe5, 0x84, 0xc2, 0x77,
-  0x37, 0x66, 0x7c, 0x51, 0xdd, 0x29, 0x06, 0x17, 0x16, 0x2b, 0x12, 0x66,
-  0x87, 0x44, 0x86, 0x17, 0x89, 0x26, 0xd1, 0x23, 0x1b, 0xd3, 0xb3, 0x50,
-  0x23, 0x74, 0x3b, 0x83, 0xdb, 0xa3, 0x3e, 0x04, 0x52, 0x6a, 0xdb, 0x40,
-  0x69, 0x36, 0x6d, 0x02, 0x38, 0xbb, 0x23, 0x36, 0x4a, 0x06, 0x6b, 0x4c,
-  0xd0, 0x71, 0x5f, 0xf1, 0x65, 0xef, 0x3b, 0x0d, 0x0e, 0xb0, 0x64, 0x16,
-  0x74, 0x61, 0xf5, 0x20, 0x25, 0x29, 0xa7, 0x3c, 0x12, 0xf1, 0x64, 0xce,
-  0xe4, 0x0a, 0x52, 0xe3, 0x17, 0xc7, 0x3b, 0x10, 0x62, 0x9a, 0x1a, 0x17,
-  0x74, 0x53, 0x0e, 0x74, 0xff, 0x2a, 0xcc, 0x58, 0xe0, 0x64, 0xb7, 0x6c,
-  0x81, 0xc3, 0x52, 0x80, 0x85, 0x6e, 0xff, 0x00, 0x8e, 0xc0, 0x26, 0x8a,
-  0x17, 0x88, 0xd0, 0x1f, 0x94, 0x8e, 0x74, 0x24, 0xb2, 0xfc, 0xf6, 0xc2,
-  0x20, 0x75, 0xdc, 0xaf, 0xd3, 0x0e, 0xa3, 0x4b, 0x02, 0x10, 0xda, 0x74,
-  0x11, 0x22, 0x8d, 0xca, 0x7c, 0x24, 0xc1, 0xd3, 0x8d, 0xfe, 0xb1, 0x06,
-  0xd2, 0xea, 0x80, 0xfa, 0x29, 0xce, 0x5a, 0x04, 0x2d, 0x90, 0xd5, 0x09,
-  0x84, 0xbd, 0x8d, 0x11, 0xb8, 0xd8, 0x4b, 0x9b, 0x0f, 0xe9, 0xb8, 0xee,
-  0x0e, 0xe9, 0xa9, 0x04, 0x9a, 0x41, 0xad, 0xfa, 0x42, 0xcb, 0x1a, 0x0f,
-  0x60, 0x3b, 0x76, 0x3a, 0x47, 0xd9, 0xa3, 0xa5, 0xb0, 0x40, 0xbb, 0xab,
-  0xdb, 0x16, 0x60, 0x0f, 0x1a, 0x51, 0xe5, 0x2b, 0xf9, 0x80, 0xb2, 0x7f,
-  0x01, 0x68, 0xda, 0xcf, 0x53, 0xf8, 0x0b, 0x07, 0xcf, 0x79, 0x45, 0x50,
-  0xb7, 0xa0, 0x07, 0x3c, 0x0d, 0xfc, 0x74, 0x04, 0x3c, 0x1b, 0x75, 0xe8,
-  0xc2, 0x59, 0x7c, 0x34, 0x68, 0x03, 0x36, 0x73, 0x3a, 0x0d, 0x14, 0xa9,
-  0xf0, 0xaa, 0xfa, 0xe9, 0x3b, 0xf1, 0x86, 0xb2, 0xea, 0x84, 0x4e, 0x53,
-  0xf8, 0xd2, 0x81, 0x68, 0x49, 0xa2, 0x58, 0x53, 0xa2, 0x51, 0x92, 0xfe,
-  0xc8, 0x0d, 0x44, 0x8a, 0x1e, 0x25, 0xe3, 0xf1, 0xfe, 0xc3, 0x88, 0x1e,
-  0x2d, 0xa8, 0xc7, 0x75, 0x2a, 0x60, 0x52, 0x64, 0x85, 0x2e, 0xf1, 0x7a,
-  0x52, 0x8c, 0x1e, 0xad, 0xdb, 0x63, 0x68, 0x07, 0xec, 0x92, 0xa3, 0x96,
-  0x2d, 0x6c, 0x98, 0xb3, 0x2f, 0x80, 0x05, 0xc0, 0x4a, 0xbc, 0x32, 0xf1,
-  0x6a, 0xe5, 0x14, 0x4d, 0x0d, 0x22, 0xff, 0x06, 0x24, 0xce, 0x6e, 0xa1,
-  0x92, 0x54, 0xdb, 0xfd, 0x76, 0x4b, 0x0e, 0x3a, 0x1c, 0x86, 0x28, 0x6c,
-  0x03, 0x8c, 0x2e, 0x91, 0x64, 0x0f, 0x5c, 0x84, 0x29, 0xce, 0x7b, 0x50,
-  0xad, 0xb5, 0x15, 0xab, 0xeb, 0xeb, 0x74, 0xfb, 0x0f, 0x1b, 0x59, 0xac,
-  0xf6, 0x0f, 0xe9, 0xde, 0x00, 0x0a, 0xcd, 0x05, 0xc6, 0x2e, 0xd3, 0x00,
-  0x96, 0x40, 0xee, 0xe9, 0x2a, 0x59, 0xa4, 0x04, 0x54, 0xae, 0xed, 0xf3,
-  0x02, 0x88, 0xd1, 0xe8, 0x61, 0x8c, 0xed, 0x17, 0x10, 0x1e, 0x9a, 0x3a,
-  0x02, 0x66, 0x46, 0xa8, 0x45, 0xf2, 0x81, 0xc3, 0x32, 0x48, 0x42, 0xd6,
-  0x04, 0xbc, 0xd9, 0x00, 0xbd, 0x0c, 0x27, 0x84, 0x83, 0x51, 0xb2, 0x8c,
-  0x52, 0xde, 0x5f, 0x99, 0xd5, 0x72, 0xaf, 0x39, 0x96, 0x6e, 0x07, 0x66,
-  0xff, 0xdc, 0x93, 0x38, 0x10, 0xb9, 0xc5, 0x28, 0x99, 0x28, 0xd9, 0x0e,
-  0xd3, 0xba, 0x14, 0xb0, 0x77, 0x7e, 0xeb, 0x06, 0x33, 0xd5, 0x66, 0x64,
-  0x67, 0x57, 0xb7, 0x83, 0x4e, 0x59, 0x5b, 0x0d, 0x05, 0xba, 0x32, 0xaf,
-  0x80, 0x6d, 0x8a, 0x28, 0x3c, 0xa3, 0x37, 0x8e, 0x77, 0x38, 0xdc, 0x43,
-  0xa4, 0x52, 0xaa, 0x6c, 0x62, 0xa2, 0x52, 0x1a, 0x9c, 0x0d, 0x7a, 0xba,
-  0xa5, 0x20, 0x69, 0x76, 0x40, 0xba, 0x10, 0x00, 0x18, 0x41, 0x56, 0x5c,
-  0xe1, 0x34, 0x3d, 0xab, 0x74, 0x77, 0x2f, 0x58, 0x0a, 0xc6, 0x0b, 0x91,
-  0xe5, 0xda, 0x10, 0xc9, 0x45, 0x28, 0x2c, 0x7f, 0xf2, 0x0b, 0x11, 0xc9,
-  0x30, 0xa9, 0xd2, 0xf7, 0xeb, 0x5c, 0x3a, 0x39, 0x36, 0xdc, 0x3b, 0x00,
-  0x02, 0x73, 0x97, 0x32, 0x96, 0x11, 0x09, 0x48, 0xe6, 0x63, 0xc8, 0xf4,
-  0x27, 0x32, 0x02, 0xd4, 0x20, 0x23, 0xfa, 0x74, 0xb1, 0x16, 0x1d, 0x9a,
-  0x8a, 0xd6, 0x43, 0x94, 0x03, 0x6c, 0xd1, 0x0e, 0x27, 0x1a, 0x07, 0x6c,
-  0xbb, 0x87, 0xd6, 0x3b, 0x0d, 0x32, 0x75, 0x78, 0x74, 0x1a, 0x49, 0xe5,
-  0xcb, 0xbb, 0x11, 0x9e, 0x90, 0x27, 0x14, 0x08, 0x89, 0xc6, 0x44, 0x88,
-  0xdb, 0x12, 0x18, 0x85, 0x32, 0x2d, 0xaf, 0x66, 0x3a, 0x16, 0x17, 0x27,
-  0xe9, 0x12, 0x72, 0xde, 0x44, 0xf9, 0x10, 0x58, 0xa7, 0x61, 0x61, 0x6a,
-  0x36, 0x0e, 0x4a, 0x1b, 0x8a, 0x30, 0x5b, 0x8d, 0x0b, 0x0b, 0x8e, 0x8b,
-  0x75, 0x2a, 0x36, 0xe0, 0x9f, 0x06, 0xec, 0xf9, 0x3e, 0x00, 0xe8, 0xaf,
-  0x4b, 0x3a, 0x36, 0x79, 0x11, 0x0d, 0x3d, 0x33, 0x4d, 0xf8, 0x0c, 0x32,
-  0xa0, 0xea, 0x14, 0xc0, 0x60, 0xfc, 0x93, 0xf3, 0x33, 0xda, 0x4e, 0xb8,
-  0x0a, 0xdb, 0x7a, 0x51, 0x9b, 0x14, 0xd4, 0x5e, 0x20, 0x1b, 0x6a, 0x8d,
-  0xfd, 0x46, 0xca, 0xe8, 0xea, 0x4b, 0xc6, 0xb6, 0x05, 0x18, 0x03, 0xc2,
-  0xce, 0x88, 0xe2, 0x46, 0xea, 0xde, 0x71, 0x8c, 0x5e, 0xf8, 0xe4, 0x15,
-  0x1a, 0xe9, 0xc7, 0x40, 0x88, 0x46, 0xb7, 0xf0, 0x15, 0xee, 0x18, 0xcc,
-  0x00, 0x8d, 0x29, 0xb7, 0x1d, 0xec, 0x4d, 0xf8, 0x46, 0x2b, 0x51, 0x01,
-  0x94, 0x10, 0xb6, 0x66, 0x16, 0x86, 0xe0, 0x28, 0x4b, 0x1d, 0xc3, 0x52,
-  0x77, 0x3a, 0x89, 0xc2, 0xb6, 0xe6, 0xa3, 0x60, 0x9f, 0x9c, 0xe8, 0x82,
-  0xfc, 0x09, 0x61, 0x8e, 0xcb, 0x95, 0x73, 0x6e, 0x04, 0x7e, 0xf8, 0xdd,
-  0x20, 0xf6, 0x06, 0x2a, 0x7e, 0xde, 0x0d, 0x0d, 0xb8, 0xad, 0xec, 0xce,
-  0x67, 0x26, 0x7f, 0x22, 0x07, 0x00, 0xf6, 0x50, 0xbc, 0x8a, 0x07, 0x74,
-  0x24, 0x0a, 0x13, 0xde, 0x06, 0x83, 0xe3, 0x07, 0x00, 0x50, 0xeb, 0x1c,
-  0xcf, 0x2c, 0x7d, 0x9b, 0xd3, 0x29, 0xa6, 0x3d, 0xdd, 0x04, 0x01, 0x1f,
-  0xa1, 0x8d, 0x9a, 0x29, 0xff, 0xc2, 0x74, 0x26, 0x21, 0xd0, 0x42, 0x29,
-  0xc2, 0x60, 0x21, 0xf9, 0x52, 0xb8, 0x0f, 0x13, 0x64, 0x1b, 0x55, 0x6b,
-  0xfa, 0x15, 0x5b, 0x03, 0x08, 0x81, 0x73, 0xd3, 0x78, 0x06, 0x9c, 0x52,
-  0x19, 0xa0, 0x35, 0x48, 0x06, 0x0a, 0xec, 0x05, 0x90, 0xda, 0xeb, 0x25,
-  0x5d, 0x00, 0x5d, 0xa2, 0x36, 0x96, 0xbc, 0x7c, 0xc6, 0x11, 0xc3, 0x0b,
-  0x6a, 0x09, 0x83, 0xf0, 0x4a, 0xae, 0x50, 0x37, 0xc7, 0xe3, 0x25, 0xa6,
-  0xc8, 0x38, 0xe0, 0xd0, 0x35, 0x05, 0x04, 0x04, 0xc8, 0xc8, 0xb6, 0x57,
-  0x70, 0xed, 0x1b, 0xc7, 0x25, 0x47, 0x47, 0x55, 0x39, 0x7e, 0x86, 0xb4,
-  0x35, 0x49, 0x81, 0x19, 0xd5, 0x16, 0x23, 0xcd, 0x98, 0xa3, 0x23, 0x3a,
-  0x23, 0x90, 0x81, 0x35, 0xb2, 0x16, 0xe4, 0x8b, 0x05, 0x42, 0xc4, 0xf7,
-  0x14, 0xb8, 0xbd, 0x5e, 0x4f, 0x84, 0xb8, 0xdb, 0x00, 0x14, 0x09, 0x7a,
-  0x38, 0x95, 0x8b, 0xbf, 0x19, 0x7d, 0x08, 0x85, 0xd2, 0x74, 0x6f, 0xaa,
-  0xd2, 0xeb, 0xf2, 0x7e, 0x0d, 0x74, 0x2e, 0x00, 0x44, 0x34, 0x0b, 0x42,
-  0x01, 0x5d, 0xe6, 0x05, 0x2a, 0x68, 0xe3, 0x50, 0x5e, 0xb1, 0x99, 0x2b,
-  0xc2, 0xa5, 0x14, 0x6d, 0x61, 0x3d, 0xda, 0x38, 0x41, 0x25, 0x9e, 0x41,
-  0x3b, 0x47, 0x2e, 0x35, 0xe3, 0xe8, 0xe8, 0xe1, 0x88, 0x72, 0x22, 0x50,
-  0x3f, 0x20, 0x50, 0xf5, 0x76, 0x3f, 0x19, 0x6e, 0xa5, 0x52, 0xba, 0x81,
-  0x63, 0x16, 0x70, 0x06, 0x11, 0x6d, 0x23, 0xff, 0x3d, 0xfb, 0x03, 0x77,
-  0x0a, 0x75, 0x49, 0x81, 0x77, 0x27, 0xfe, 0xbf, 0x76, 0xee, 0x41, 0xb8,
-  0xb2, 0x21, 0xdf, 0xf4, 0x24, 0x8f, 0xea, 0x74, 0x09, 0xea, 0xf8, 0xeb,
-  0x2b, 0xcd, 0x11, 0x0d, 0x79, 0x15, 0x6c, 0x12, 0xd7, 0xec, 0x5d, 0xf3,
-  0x08, 0x81, 0xa1, 0x45, 0x40, 0xb3, 0x79, 0x02, 0x85, 0xcc, 0xb4, 0xa3,
-  0x26, 0x1a, 0x7c, 0x0d, 0xed, 0xca, 0x89, 0x1e, 0x02, 0x4e, 0x54, 0x20,
-  0x59, 0x22, 0xb8, 0xa6, 0x4a, 0xa3, 0x36, 0xb0, 0x89, 0x66, 0x4b, 0x76,
-  0x11, 0x16, 0xa2, 0xde, 0x51, 0x1e, 0x1e, 0x50, 0x24, 0x04, 0x91, 0x6b,
-  0x6e, 0x07, 0x66, 0x8b, 0x08, 0x1d, 0xff, 0x48, 0x99, 0xf7, 0xd0, 0xf7,
-  0xd2, 0x89, 0xed, 0xce, 0x21, 0xc6, 0x4f, 0x76, 0x36, 0xd8, 0x21, 0xd6,
-  0x25, 0x19, 0xf0, 0x29, 0xf1, 0x19, 0x83, 0xf0, 0x12, 0x0d, 0x9b, 0xc8,
-  0xc6, 0x74, 0x0c, 0x53, 0x89, 0x9e, 0x5d, 0x91, 0x45, 0x35, 0x06, 0xb7,
-  0x4f, 0x81, 0x5e, 0x40, 0x4a, 0xf1, 0xc2, 0x4c, 0x21, 0x14, 0x61, 0x40,
-  0x55, 0xd1, 0x76, 0x61, 0xbb, 0xbe, 0xfe, 0x6b, 0x5e, 0x5d, 0x62, 0x0e,
-  0x2f, 0xd1, 0xe9, 0xd1, 0x80, 0xdb, 0x9b, 0x49, 0x85, 0xc9, 0x02, 0x5c,
-  0xd6, 0x81, 0xd2, 0xf0, 0x27, 0x76, 0x13, 0xad, 0x52, 0xd2, 0xf8, 0xd2,
-  0x00, 0xb9, 0x0a, 0x00, 0x0e, 0x09, 0x12, 0x69, 0xba, 0x2c, 0x4d, 0x29,
-  0x18, 0x76, 0x05, 0x3d, 0x1b, 0x05, 0xc0, 0x47, 0x0a, 0x12, 0xd1, 0xdb,
-  0x7d, 0xfd, 0xab, 0xda, 0x7e, 0xc6, 0x23, 0xb8, 0x5a, 0x1d, 0xa5, 0xc5,
-  0x74, 0x0b, 0xba, 0xd0, 0x02, 0x06, 0x2c, 0x61, 0x15, 0x65, 0x20, 0xaa,
-  0x0d, 0xe0, 0x2e, 0xb3, 0x1f, 0x10, 0xad, 0x81, 0x6d, 0x30, 0xf2, 0xd3,
-  0x24, 0x95, 0x53, 0x04, 0x1d, 0x22, 0xc6, 0x2f, 0x90, 0x97, 0xa5, 0x09,
-  0x48, 0x23, 0x81, 0xf8, 0xec, 0x84, 0x00, 0x81, 0xed, 0x5d, 0xed, 0xa1,
-  0x10, 0x02, 0x33, 0xf7, 0x7c, 0xa1, 0x12, 0x05, 0x40, 0x7e, 0xfa, 0x41,
-  0x09, 0x44, 0x4c, 0xaa, 0x0a, 0x37, 0x93, 0xa7, 0xd2, 0x73, 0x49, 0x0b,
-  0xd5, 0x69, 0xa2, 0x71, 0x54, 0x9c, 0x6c, 0x13, 0x68, 0xb7, 0xfe, 0x51,
-  0x63, 0x43, 0x23, 0x5f, 0xe4, 0x3c, 0x70, 0x30, 0x33, 0xad, 0x23, 0x2e,
-  0xe0, 0x02, 0x7d, 0x14, 0xc3, 0x17, 0xdb, 0x3d, 0x16, 0x97, 0x22, 0x3e,
-  0xe9, 0x7a, 0x0c, 0x0f, 0x7c, 0x00, 0x60, 0xa0, 0x8e, 0x01, 0xbb, 0x18,
-  0x7c, 0x8d, 0x02, 0x78, 0xa3, 0x6a, 0x63, 0x3d, 0x05, 0xbc, 0x09, 0xfc,
-  0xa3, 0x6c, 0xc9, 0xb6, 0x40, 0x97, 0xff, 0x4a, 0x16, 0x00, 0x63, 0xff,
-  0x73, 0x70, 0x16, 0x4f, 0x22, 0x3d, 0x27, 0x32, 0x04, 0x6b, 0x0d, 0x3b,
-  0x96, 0x92, 0xd3, 0x4d, 0x37, 0x40, 0x28, 0xae, 0x12, 0x1f, 0x9c, 0xc3,
-  0x08, 0x45, 0x2e, 0x4c, 0x6d, 0xe6, 0xc7, 0xdb, 0x14, 0xae, 0x22, 0x94,
-  0xec, 0x3e, 0x34, 0x65, 0x9b, 0xb4, 0xa6, 0xd8, 0x10, 0xff, 0xa4, 0x1e,
-  0x00, 0xe8, 0x19, 0x47, 0x28, 0x03, 0xba, 0x3e, 0x46, 0xf3, 0x0d, 0xd9,
-  0x4f, 0xf2, 0x7d, 0xf2, 0xe8, 0x9c, 0x48, 0x87, 0xb1, 0xde, 0x74, 0x52,
-  0x70, 0xe0, 0x4d, 0x83, 0x57, 0x75, 0x00, 0x3a, 0x04, 0x25, 0xde, 0x39,
-  0x46, 0x34, 0x89, 0xd7, 0x29, 0x76, 0x41, 0x38, 0x1e, 0xbb, 0xab, 0xa8,
-  0x17, 0x31, 0xe5, 0x02, 0x17, 0x90, 0x3e, 0xe4, 0x03, 0x0e, 0x14, 0x41,
-  0xb3, 0x06, 0x4b, 0x15, 0xdb, 0x47, 0x74, 0x21, 0x36, 0x3a, 0x0d, 0x06,
-  0x99, 0xba, 0x11, 0x39, 0x04, 0xfd, 0xa9, 0xb8, 0x2c, 0xd8, 0x09, 0xfa,
-  0x21, 0x7a, 0x27, 0xc1, 0x84, 0xa9, 0x7f, 0x8a, 0x47, 0x18, 0x3c, 0x3f,
-  0x77, 0x8b, 0x22, 0xff, 0xbc, 0x1e, 0x26, 0x80, 0xbf, 0x00, 0xa8, 0x43,
-  0x57, 0x49, 0x07, 0x00, 0x15, 0x41, 0xad, 0xe4, 0x07, 0xd3, 0x7f, 0x0b,
-  0x5d, 0x3b, 0x06, 0x0c, 0x02, 0x4d, 0x91, 0x5e, 0xe1, 0x17, 0xeb, 0xc3,
-  0xa3, 0x11, 0x9d, 0xdc, 0x34, 0x56, 0xf5, 0x83, 0x68, 0x68, 0x88, 0x37,
-  0xc1, 0x5e, 0xfc, 0xc2, 0x8c, 0x06, 0x52, 0xaa, 0xd8, 0xfa, 0x3f, 0x85,
-  0xd5, 0x55, 0xc3, 0xd1, 0x3c, 0x43, 0x62, 0x30, 0xf0, 0x71, 0xc3, 0x48,
-  0x5a, 0xad, 0xa1, 0x67, 0x6e, 0x1c, 0xa1, 0x46, 0x6e, 0x86, 0x09, 0xb9,
-  0x32, 0x32, 0x97, 0x1e, 0xa4, 0xba, 0x48, 0x12, 0x00, 0xd9, 0x22, 0xf2,
-  0xac, 0x15, 0xe8, 0x3b, 0x9d, 0xa4, 0xa7, 0x55, 0xf0, 0xb0, 0x01, 0xeb,
-  0x1d, 0x46, 0x41, 0x23, 0x5e, 0xb3, 0xc1, 0x17, 0x65, 0xc3, 0x17, 0xba,
-  0xc4, 0x1e, 0x36, 0x68, 0x06, 0xd0, 0xf9, 0x38, 0x7e, 0xf9, 0x5f, 0x16,
-  0x71, 0xa9, 0x45, 0x48, 0x3f, 0x3d, 0x08, 0x8c, 0xd8, 0x0b, 0xa9, 0x8d,
-  0x02, 0x62, 0xfb, 0xbe, 0x14, 0x4f, 0xa5, 0x00, 0x63, 0xa4, 0x08, 0x19,
-  0xfc, 0x57, 0x44, 0x43, 0xf3, 0x07, 0x66, 0xfc, 0x20, 0x77, 0x0d, 0xe8,
-  0xc2, 0x4b, 0x5a, 0x9e, 0xdd, 0x75, 0x7e, 0x0b, 0xb9, 0x16, 0x10, 0x18,
-  0x67, 0xe5, 0x4b, 0x0e, 0x7d, 0x4b, 0xff, 0x2e, 0x9a, 0x18, 0x20, 0x65,
-  0x18, 0xee, 0xff, 0xc3, 0xfc, 0x12, 0x2a, 0x36, 0x2a, 0xa1, 0xdd, 0x28,
-  0x36, 0x05, 0xaa, 0x3b, 0x07, 0xa4, 0xb3, 0x16, 0x03, 0x73, 0x05, 0x77,
-  0x99, 0x28, 0x6e, 0x1b, 0x65, 0x90, 0x28, 0x90, 0xbc, 0x96, 0x05, 0xe7,
-  0x82, 0x29, 0xbb, 0x5c, 0x15, 0x77, 0x28, 0xfc, 0x44, 0x29, 0x65, 0x28,
-  0x2d, 0x27, 0xf8, 0x80, 0x28, 0x95, 0x7f, 0x96, 0x23, 0xca, 0x3f, 0x0f,
-  0xe3, 0x29, 0xe0, 0x2b, 0x2e, 0x30, 0x5f, 0x0d, 0x2e, 0x3f, 0x2e, 0x3a,
-  0x89, 0x2e, 0xee, 0x81, 0x0b, 0xff, 0x44, 0x45, 0x92, 0xa2, 0xd8, 0xca,
-  0x52, 0x7a, 0x92, 0xf6, 0xa6, 0x81, 0x0a, 0x98, 0x34, 0x2c, 0x10, 0xab,
-  0xea, 0xc0, 0x41, 0x2f, 0xed, 0xe8, 0xcc, 0x37, 0x5d, 0x43, 0xb7, 0x56,
-  0xbd, 0xdb, 0xb5, 0x02, 0xa9, 0x2c, 0xab, 0xb2, 0xad, 0xcb, 0xb1, 0xb3,
-  0x2c, 0xaf, 0xb2, 0xb9, 0xcb, 0xbb, 0xbd, 0x28, 0x51, 0x8e, 0xb0, 0x4a,
-  0xe6, 0xbe, 0x91, 0x50, 0xe9, 0xda, 0x02, 0xbd, 0xf8, 0xab, 0x29, 0x80,
-  0x70, 0xda, 0xbb, 0x5a, 0x4b, 0x34, 0x16, 0x15, 0xd8, 0xe8, 0xd5, 0x4a,
-  0x97, 0x62, 0x9b, 0x63, 0x10, 0xbd, 0x97, 0x8a, 0x84, 0x90, 0x4f, 0x40,
-  0x29, 0xd5, 0x88, 0xc2, 0xd4, 0x1b, 0xd3, 0xd8, 0x58, 0xeb, 0x24, 0x68,
-  0xce, 0x56, 0x37, 0x8e, 0x72, 0x18, 0x1b, 0x77, 0x8c, 0x9e, 0x1f, 0x99,
-  0xe9, 0x09, 0x82, 0xba, 0x02, 0xbb, 0x21, 0xdf, 0x25, 0x0a, 0xe9, 0x95,
-  0x02, 0xad, 0x43, 0x93, 0x07, 0x00, 0x71, 0x23, 0x88, 0xd8, 0x1d, 0x1a,
-  0xf6, 0xfd, 0x85, 0xbf, 0x4b, 0xe0, 0x75, 0xec, 0x6e, 0xae, 0xe8, 0xb1,
-  0xef, 0x39, 0x74, 0xe3, 0x53, 0xb8, 0x9a, 0xf0, 0x52, 0x7f, 0xeb, 0xd6,
-  0xb8, 0xf4, 0x74, 0x3b, 0x46, 0x87, 0x09, 0xd9, 0xeb, 0x2f, 0x3a, 0xdd,
-  0x16, 0x2d, 0x83, 0x7d, 0x67, 0xf0, 0x9c, 0x2d, 0x24, 0x8f, 0xe3, 0xb8,
-  0x16, 0x96, 0x19, 0x18, 0x78, 0xba, 0xae, 0x97, 0x04, 0xae, 0xf8, 0x27,
-  0xee, 0x54, 0x4a, 0x88, 0xa2, 0xe0, 0x46, 0xe9, 0x55, 0x56, 0xab, 0xbf,
-  0xff, 0x40, 0xba, 0x18, 0x19, 0xe8, 0x89, 0x49, 0x76, 0x39, 0x06, 0xb9,
-  0xde, 0xd4, 0xe9, 0x0a, 0x02, 0xc6, 0x13, 0x1f, 0x59, 0x75, 0x39, 0x02,
-  0x72, 0xf6, 0x01, 0x32, 0x28, 0xce, 0x61, 0x81, 0x01, 0x54, 0xae, 0x8b,
-  0x16, 0x93, 0xdf, 0x96, 0x32, 0x4a, 0x7a, 0x0e, 0x9f, 0x95, 0xa5, 0x2b,
-  0x73, 0x67, 0xf2, 0xbd, 0x9e, 0x2e, 0xb8, 0x3b, 0xda, 0x79, 0x9e, 0x1e,
-  0x7d, 0x5b, 0xae, 0x01, 0xa1, 0x31, 0x53, 0x5d, 0x5c, 0xad, 0x74, 0x08,
-  0xad, 0xf3, 0xa4, 0x4f, 0xb1, 0x9b, 0x34, 0xb3, 0xfa, 0x92, 0x01, 0x93,
-  0xe1, 0xbd, 0x32, 0x5c, 0xd3, 0x18, 0x82, 0x66, 0x0e, 0x4f, 0xc3, 0x79,
-  0x01, 0xa5, 0x5b, 0x08, 0x10, 0x71, 0x35, 0xb9, 0xf7, 0x19, 0x68, 0x08,
-  0x4f, 0xbb, 0x5f, 0x34, 0xbd, 0xf3, 0x56, 0x4c, 0xaf, 0xf4, 0x8e, 0x2c,
-  0x59, 0x49, 0x4b, 0xd6, 0x3d, 0xa5, 0xa0, 0xf0, 0xed, 0x46, 0x3d, 0xb4,
-  0x04, 0xff, 0x41, 0x3d, 0x40, 0x01, 0x74, 0x3c, 0x3d, 0x68, 0x2f, 0x37,
-  0x3d, 0xd0, 0x4b, 0xb5, 0x32, 0xfb, 0x3d, 0xb0, 0x04, 0x74, 0x2d, 0x1d,
-  0x6b, 0x05, 0xc3, 0x5b, 0x18, 0x0b, 0xf2, 0x74, 0x23, 0x3d, 0x90, 0xf1,
-  0x1e, 0x3d, 0x20, 0x2d, 0x25, 0x19, 0xbc, 0x09, 0x06, 0x74, 0x14, 0xaa,
-  0xdf, 0x2a, 0x0f, 0x3d, 0xd6, 0x05, 0x04, 0x2d, 0xf5, 0xcf, 0xa0, 0x0e,
-  0xdd, 0x09, 0x9e, 0x0d, 0x6e, 0x2f, 0x89, 0xf0, 0x29, 0x64, 0x07, 0xe9,
-  0xef, 0x0b, 0xe6, 0x71, 0x76, 0xd3, 0xca, 0x1d, 0x27, 0x29, 0xba, 0xa7,
-  0x09, 0xc0, 0x71, 0xf8, 0x03, 0xb8, 0xdd, 0x5f, 0x03, 0x51, 0x2d, 0xe9,
-  0xce, 0xb6, 0x00, 0x87, 0xb5, 0x43, 0xcd, 0xfd, 0x48, 0x28, 0xbb, 0x00,
-  0x4b, 0x50, 0x00, 0x36, 0x53, 0x00, 0x4e, 0xc3, 0x69, 0xc5, 0x65, 0xa3,
-  0xba, 0xe0, 0x41, 0x7e, 0x49, 0xf6, 0xf6, 0x19, 0xeb, 0xbc, 0x3d, 0xc8,
-  0xb7, 0x73, 0xbf, 0xb5, 0xf5, 0xd9, 0xa2, 0x09, 0x00, 0xb3, 0x0f, 0x00,
-  0x66, 0x12, 0x00, 0xcd, 0x24, 0x00, 0x0a, 0x7c, 0x56, 0x15, 0xf2, 0x2a,
-  0xcf, 0x0c, 0xc7, 0x37, 0xc9, 0x63, 0xeb, 0x42, 0x86, 0xdd, 0xf9, 0xa1,
-  0x28, 0x23, 0x16, 0xb6, 0x1a, 0x5f, 0x1e, 0x49, 0xf0, 0x2d, 0x1a, 0xe9,
-  0x5b, 0x46, 0x3c, 0xb6, 0x09, 0x8a, 0x89, 0xee, 0x46, 0x4b, 0xeb, 0x48,
-  0xa2, 0x06, 0x5b, 0x07, 0x2d, 0x8d, 0x41, 0xc5, 0xa8, 0x9f, 0xdf, 0x67,
-  0x8f, 0x63, 0x3a, 0xc7, 0x00, 0x68, 0x50, 0x38, 0xba, 0x76, 0x22, 0xe2,
-  0x29, 0x13, 0xc2, 0xff, 0xdb, 0x2c, 0xbb, 0x4d, 0x18, 0x8b, 0x56, 0xe4,
-  0x5b, 0x8d, 0xe6, 0xeb, 0xe8, 0x78, 0x33, 0x1c, 0x41, 0x4d, 0x0e, 0x1e,
-  0xfa, 0x2d, 0x2f, 0x00, 0x3d, 0x4f, 0x96, 0x8c, 0x09, 0x09, 0x4f, 0x3c,
-  0x28, 0x26, 0x04, 0xae, 0x28, 0x67, 0xc7, 0xb6, 0x1c, 0x6d, 0xdd, 0xc2,
-  0x2a, 0x3b, 0xfa, 0x06, 0x28, 0x4f, 0x7e, 0x3f, 0x15, 0x4f, 0xbe, 0x05,
-  0xd1, 0xe6, 0x03, 0x76, 0xde, 0x3c, 0x34, 0x8a, 0x1c, 0x25, 0x36, 0xc6,
-  0xf6, 0x87, 0xd0, 0xa6, 0x10, 0xfd, 0x80, 0x7c, 0x01, 0x3a, 0x75, 0x23,
-  0xa2, 0x05, 0x66, 0x1e, 0x97, 0xea, 0x7e, 0xfc, 0x61, 0xf6, 0xdb, 0x8c,
-  0xc7, 0x47, 0x8a, 0x23, 0xd8, 0xeb, 0x18, 0x1c, 0xf7, 0x12, 0xb8, 0x4a,
-  0x59, 0x63, 0x5c, 0x1c, 0xbb, 0x27, 0x4a, 0x2c, 0x50, 0x9a, 0xf0, 0xe4,
-  0xc2, 0x3d, 0x65, 0x66, 0xd3, 0x78, 0x3d, 0xa8, 0xef, 0xa3, 0x16, 0x24,
-  0x4f, 0x50, 0x14, 0x20, 0x96, 0x80, 0xdb, 0xf4, 0x92, 0x1b, 0xa6, 0x21,
-  0xf1, 0x0a, 0xe8, 0x91, 0xf8, 0x3a, 0x1b, 0x36, 0x62, 0x07, 0x98, 0xe1,
-  0x1a, 0x3f, 0x28, 0x60, 0x29, 0x70, 0x45, 0x05, 0x40, 0xca, 0xb1, 0x63,
-  0xd9, 0x06, 0xb3, 0xa8, 0x03, 0x5b, 0x8d, 0x28, 0x10, 0x64, 0xa9, 0xe4,
-  0xbd, 0x66, 0x73, 0x1c, 0x6d, 0xa7, 0x78, 0x44, 0xd4, 0xc6, 0x18, 0x48,
-  0x82, 0xdb, 0x0e, 0x14, 0xb5, 0x27, 0xb7, 0x63, 0x25, 0x4d, 0xb1, 0x28,
-  0x10, 0x90, 0x75, 0x6c, 0x0e, 0x06, 0xef, 0x14, 0x14, 0x47, 0xca, 0xdd,
-  0xd2, 0x84, 0x9c, 0x88, 0x1b, 0xed, 0xb4, 0x24, 0x28, 0x8e, 0x40, 0x75,
-  0x11, 0x48, 0x7c, 0x0c, 0x28, 0xa1, 0xb9, 0x50, 0xcd, 0xcd, 0x18, 0x44,
-  0xa8, 0x18, 0xb6, 0x03, 0xcd, 0x49, 0x67, 0x78, 0x14, 0x45, 0x96, 0x94,
-  0x8b, 0x78, 0x0d, 0x16, 0x39, 0x32, 0x0b, 0x5a, 0x7d, 0x7a, 0x6d, 0x2b,
-  0xb2, 0xc3, 0x9d, 0x69, 0x48, 0xdb, 0x5c, 0x4b, 0x8b, 0x1e, 0xec, 0xa2,
-  0x13, 0x84, 0xe5, 0x6f, 0x1b, 0x14, 0x47, 0xbf, 0x02, 0x6d, 0x2f, 0x0c,
-  0xa1, 0xa2, 0x0a, 0x2e, 0x9b, 0xee, 0x83, 0xf9, 0x02, 0x25, 0x9e, 0x9e,
-  0x12, 0xd9, 0x52, 0xad, 0xf7, 0xa1, 0xab, 0x19, 0xfd, 0x04, 0x30, 0xc8,
-  0xeb, 0x3e, 0x8b, 0x4c, 0xf1, 0xde, 0x18, 0x29, 0x33, 0x6d, 0x9c, 0x45,
-  0x84, 0xeb, 0x80, 0x1b, 0x1f, 0x31, 0x44, 0xde, 0x00, 0xf1, 0x1a, 0xeb,
-  0x0f, 0xcc, 0x71, 0x1b, 0x8c, 0x18, 0x9b, 0x1b, 0x4d, 0x1b, 0x6e, 0xee,
-  0xad, 0x1a, 0x7f, 0x0d, 0xf8, 0xa2, 0x9c, 0x6c, 0x93, 0x02, 0xb9, 0xd9,
-  0x2a, 0x3f, 0x5f, 0x80, 0x3e, 0x9c, 0x78, 0xcd, 0x90, 0x63, 0xc0, 0x4d,
-  0xda, 0xf6, 0x74, 0x08, 0x1a, 0x0c, 0x89, 0xdb, 0x2d, 0xe6, 0x1d, 0x3a,
-  0x43, 0x05, 0x7a, 0xb5, 0x3b, 0x16, 0x68, 0x5f, 0xd9, 0x46, 0xf8, 0x74,
-  0x90, 0x52, 0xbb, 0xae, 0xb8, 0x84, 0x52, 0xa7, 0x5a, 0xa0, 0xff, 0x56,
-  0xa1, 0x03, 0xc4, 0x8e, 0x2e, 0x81, 0xf8, 0xff, 0x0a, 0x5b, 0x11, 0xba,
-  0x17, 0xa6, 0x42, 0xb3, 0x0a, 0x97, 0x89, 0x10, 0x54, 0xbf, 0xe8, 0x88,
-  0xf3, 0xe8, 0xb5, 0x2d, 0x7b, 0x49, 0xed, 0x6c, 0x37, 0x75, 0xec, 0x18,
-  0xbc, 0x16, 0x06, 0xb4, 0xd6, 0x53, 0x73, 0x5d, 0xf7, 0x4d, 0x0c, 0x3b,
-  0xdb, 0x39, 0x11, 0xda, 0x2c, 0xdc, 0x17, 0x2a, 0x1c, 0xb9, 0xf4, 0x19,
-  0xc2, 0x11, 0xdb, 0x74, 0xe3, 0xf9, 0x6d, 0x1a, 0x06, 0xdf, 0xe1, 0x4c,
-  0xeb, 0x40, 0xb8, 0x63, 0x74, 0x19, 0xda, 0xfb, 0xb8, 0xa2, 0x09, 0xa7,
-  0xd0, 0x1d, 0x88, 0x9a, 0x00, 0xb4, 0x14, 0xfa, 0x68, 0x22, 0x25, 0xa0,
-  0x16, 0xb6, 0xba, 0x20, 0xb9, 0x47, 0x15, 0x1d, 0x6c, 0x09, 0xaf, 0xe0,
-  0x5b, 0x5e, 0x0c, 0x1e, 0xa5, 0x04, 0x96, 0xb4, 0x49, 0xe9, 0x14, 0x9a,
-  0xc7, 0x5e, 0x8e, 0xef, 0x09, 0x9a, 0xc1, 0x10, 0xf8, 0x2e, 0x17, 0x1f,
-  0x26, 0xcb, 0x06, 0x47, 0x6c, 0xb5, 0xe1, 0x07, 0x72, 0x09, 0xbd, 0x1e,
-  0xb5, 0xdb, 0x32, 0xb8, 0x55, 0x58, 0xa4, 0x56, 0x7e, 0x63, 0x39, 0xe8,
-  0x87, 0xd2, 0xe0, 0x5b, 0xd6, 0xc3, 0x59, 0x32, 0x07, 0x75, 0x20, 0xce,
-  0x25, 0xed, 0x39, 0xb8, 0x79, 0xd6, 0x32, 0x23, 0x95, 0x37, 0xa4, 0x3c,
-  0x48, 0x19, 0xdf, 0x4d, 0x39, 0x02, 0x2d, 0x1f, 0x9f, 0xf5, 0x18, 0xb8,
-  0xd0, 0x76, 0x24, 0xfe, 0x18, 0x71, 0xde, 0x3c, 0xc7, 0x01, 0xe8, 0x2c,
-  0xf5, 0x20, 0x77, 0x1f, 0x60, 0x53, 0x0b, 0xe0, 0x06, 0x5e, 0x53, 0x96,
-  0x76, 0x07, 0x38, 0x18, 0x6e, 0x1f, 0x2e, 0x32, 0xab, 0xec, 0x7a, 0x48,
-  0x3d, 0x04, 0x59, 0xf4, 0x27, 0x07, 0xc8, 0x26, 0xf4, 0xb8, 0x06, 0x1e,
-  0xeb, 0xb6, 0x9e, 0x0e, 0x04, 0xf2, 0x0d, 0xb8, 0x1b, 0xd6, 0x08, 0x5c,
-  0xc3, 0x1e, 0xfe, 0x6d, 0x35, 0x1e, 0x4f, 0x91, 0xae, 0xbb, 0x3f, 0x09,
-  0xa4, 0x18, 0x09, 0x2b, 0xfd, 0xd7, 0x28, 0xe8, 0x69, 0xf1, 0xda, 0x07,
-  0xcf, 0x28, 0x4e, 0x6b, 0x0a, 0xa7, 0x80, 0x4b, 0xd5, 0xf7, 0xec, 0xe8,
-  0x53, 0xf1, 0x5e, 0x76, 0xf1, 0x21, 0xc2, 0x70, 0x55, 0x9d, 0x1a, 0x4e,
-  0xdd, 0x14, 0x1a, 0xbb, 0x07, 0x0a, 0xcd, 0xd1, 0x61, 0x0d, 0xe4, 0x00,
-  0x90, 0x40, 0x6a, 0x1d, 0xf8, 0x6f, 0x18, 0xab, 0xdb, 0x86, 0xd6, 0x88,
-  0x6c, 0xfe, 0xe6, 0x3f, 0x81, 0xfb, 0x05, 0x41, 0xbb, 0x17, 0x1a, 0x64,
-  0x54, 0x67, 0xcb, 0x9f, 0x07, 0x05, 0xeb, 0xbf, 0x72, 0x1c, 0xe8, 0x40,
-  0x42, 0x55, 0xe8, 0xe9, 0x07, 0x59, 0x62, 0xe8, 0x5b, 0x0b, 0x29, 0xda,
-  0x3e, 0x8a, 0x05, 0x06, 0x02, 0xf6, 0x4f, 0x43, 0x3d, 0x59, 0x6f, 0xc6,
-  0x48, 0xca, 0x37, 0x6c, 0xbf, 0xcb, 0x77, 0xb8, 0xbb, 0x82, 0xb9, 0xea,
-  0x17, 0x10, 0x88, 0x6e, 0xa7, 0x57, 0xee, 0xa3, 0x8c, 0x63, 0xf5, 0x00,
-  0x6c, 0xa9, 0xc7, 0xbc, 0x00, 0x00, 0xc7, 0xb1, 0x00, 0x57, 0x5a, 0x54,
-  0x04, 0xaf, 0x0b, 0x6a, 0xdc, 0xf9, 0x27, 0x28, 0x17, 0xbf, 0xe9, 0x84,
-  0x89, 0xfc, 0x68, 0x1d, 0xaf, 0x17, 0x48, 0x13, 0x69, 0xe2, 0xdd, 0xcf,
-  0x74, 0x84, 0x15, 0x4e, 0xb6, 0xf9, 0x2f, 0x34, 0x12, 0xb1, 0x86, 0x0f,
-  0xc0, 0x2a, 0x43, 0x18, 0x32, 0x30, 0x50, 0x43, 0xc1, 0x71, 0xfa, 0x3b,
-  0x58, 0x70, 0xa4, 0x97, 0xfa, 0x89, 0xd6, 0xd7, 0x89, 0xda, 0xc5, 0x0a,
-  0x95, 0x34, 0x6c, 0xee, 0x3c, 0x9d, 0x0c, 0xbb, 0x17, 0xb8, 0x96, 0x97,
-  0xa6, 0x52, 0xa3, 0x06, 0xe5, 0x84, 0x18, 0x2f, 0x3b, 0x2e, 0x29, 0xe6,
-  0x9f, 0x1c, 0xa2, 0x34, 0x35, 0xee, 0x4e, 0x75, 0x4d, 0x74, 0xb8, 0x3a,
-  0xac, 0x3b, 0x01, 0x3f, 0x35, 0x7f, 0x60, 0x56, 0x02, 0x50, 0x46, 0x8c,
-  0xe4, 0xd4, 0x01, 0x65, 0xe6, 0xab, 0xe8, 0xaa, 0x9b, 0x05, 0xb0, 0x59,
-  0x16, 0x85, 0x40, 0x9c, 0x14, 0x6d, 0xcb, 0x99, 0xbe, 0x12, 0xc6, 0x89,
-  0x56, 0xc2, 0x28, 0x4d, 0x7b, 0x4e, 0x44, 0x15, 0xb0, 0x3a, 0xac, 0x93,
-  0x04, 0x04, 0xba, 0xa7, 0x0b, 0x03, 0x90, 0x07, 0x6e, 0xf5, 0x4c, 0x0b,
-  0x02, 0x83, 0xf0, 0xc3, 0x0b, 0x81, 0x3f, 0x4b, 0x10, 0x0f, 0xdd, 0xb8,
-  0xda, 0x7d, 0xb7, 0xb9, 0x16, 0xf7, 0x8a, 0x64, 0x41, 0xe0, 0x9e, 0x10,
-  0xd6, 0xd9, 0x29, 0xd8, 0x45, 0x08, 0x40, 0x36, 0x76, 0x2a, 0xe5, 0x0e,
-  0x1f, 0x92, 0x8c, 0x66, 0x8b, 0x6f, 0x46, 0x0e, 0x8b, 0x17, 0x6d, 0x77,
-  0xdc, 0xb3, 0x53, 0xde, 0x00, 0xf5, 0xb0, 0x28, 0x97, 0xad, 0x14, 0xb4,
-  0x1d, 0xac, 0x0d, 0xc4, 0x41, 0x74, 0x2f, 0x5c, 0xd7, 0x06, 0x12, 0x35,
-  0x43, 0xbd, 0x04, 0x40, 0x76, 0x05, 0x8a, 0x39, 0x93, 0x02, 0xc1, 0x3c,
-  0xa1, 0x6d, 0x15, 0x7e, 0xa0, 0x37, 0xae, 0xf4, 0xe0, 0xdc, 0x74, 0x2e,
-  0x25, 0xff, 0xb7, 0xde, 0x02, 0xdc, 0xb8, 0xba, 0x7b, 0x34, 0x27, 0x6b,
-  0x08, 0x1b, 0x16, 0x3a, 0xed, 0x7e, 0xdc, 0x3b, 0xb2, 0x0c, 0x0b, 0x58,
-  0x42, 0x61, 0x63, 0x82, 0xd7, 0xb6, 0x7d, 0x11, 0x79, 0xd0, 0x65, 0xd2,
-  0x04, 0xb7, 0x7b, 0x0a, 0x12, 0xb5, 0x3a, 0xb8, 0xd7, 0x75, 0x2d, 0xd8,
-  0xf3, 0xb0, 0x2e, 0x9f, 0xb8, 0x25, 0xbd, 0x36, 0x24, 0xba, 0x1f, 0x6b,
-  0xc0, 0x58, 0x77, 0xb8, 0xc6, 0x5c, 0x68, 0xca, 0x15, 0x7b, 0xc1, 0xdf,
-  0x09, 0xb1, 0xc0, 0x15, 0x7e, 0xdd, 0x5c, 0x08, 0xdf, 0x2c, 0xd2, 0x0b,
-  0x46, 0xd0, 0xdb, 0x74, 0x12, 0x5f, 0xb0, 0x40, 0x6f, 0xb0, 0xb8, 0x1c,
-  0x20, 0x6c, 0x1a, 0xa5, 0xfb, 0xeb, 0xd9, 0xe3, 0xfe, 0x8d, 0x77, 0x13,
-  0x8b, 0x04, 0x16, 0x0d, 0xcc, 0x5a, 0xce, 0x01, 0x99, 0xed, 0x0e, 0x63,
-  0xee, 0x20, 0x8b, 0x07, 0x10, 0x01, 0x2b, 0xcd, 0x05, 0x60, 0xce, 0xd7,
-  0xb0, 0x8a, 0x5c, 0xd3, 0x77, 0xee, 0x13, 0xc6, 0x31, 0xff, 0xa7, 0xf8,
-  0xff, 0x89, 0xd7, 0x83, 0xc7, 0x24, 0x8b, 0x35, 0x8b, 0xde, 0x7d, 0x02,
-  0x51, 0x2d, 0xbf, 0x5b, 0x02, 0x20, 0xc4, 0xeb, 0xac, 0xad, 0x89, 0x64,
-  0x6b, 0xaa, 0x8c, 0xad, 0x71, 0x0c, 0x8a, 0x9f, 0x61, 0x10, 0x92, 0xfc,
-  0xdf, 0xfe, 0xb0, 0x74, 0x18, 0x85, 0x81, 0xff, 0xf8, 0xbb, 0xfe, 0x0c,
-  0x77, 0xac, 0x01, 0xe1, 0x97, 0x20, 0xe9, 0x14, 0x6d, 0xf6, 0x98, 0xe1,
-  0x0f, 0x75, 0x38, 0x5a, 0x30, 0xd2, 0x06, 0xd2, 0x3e, 0xd0, 0x10, 0x72,
-  0x25, 0x13, 0x44, 0x60, 0xbb, 0xab, 0xe5, 0x5d, 0x3f, 0x05, 0x28, 0x5b,
-  0x2a, 0x0d, 0xc4, 0x72, 0xce, 0x00, 0xfe, 0x81, 0x7e, 0xcc, 0xc8, 0x00,
-  0x73, 0xd9, 0x6c, 0xbb, 0x62, 0x40, 0xda, 0x5f, 0x05, 0x9e, 0x25, 0xac,
-  0x37, 0x78, 0x83, 0xd3, 0x57, 0x9b, 0x5d, 0xd0, 0x89, 0xb9, 0x82, 0x04,
-  0x4f, 0x19, 0x89, 0xc1, 0xf6, 0x03, 0x4e, 0xac, 0x11, 0xbe, 0xec, 0xc1,
-  0x05, 0x1b, 0x65, 0xcc, 0xbf, 0xce, 0x18, 0x39, 0xd3, 0xc1, 0x77, 0x06,
-  0xb8, 0x7a, 0x39, 0xc1, 0x6c, 0xf4, 0xfd, 0x20, 0xb9, 0x97, 0x14, 0x0b,
-  0xb4, 0x0d, 0xeb, 0x7d, 0x20, 0xc4, 0xb8, 0x02, 0xbe, 0x30, 0xeb, 0x95,
-  0xc8, 0x38, 0x65, 0xd6, 0x41, 0xbf, 0xe5, 0x89, 0xf9, 0xe8, 0x72, 0x3a,
-  0xc2, 0x8b, 0x5e, 0xb1, 0xc2, 0xc3, 0x52, 0xfe, 0xde, 0x11, 0xd0, 0x89,
-  0x46, 0xca, 0x47, 0x47, 0x89, 0xdb, 0x5e, 0xee, 0x0b, 0xf4, 0x2f, 0xc4,
-  0x20, 0x73, 0xb6, 0x0b, 0x3d, 0x1f, 0xd8, 0x0e, 0xe0, 0xb5, 0xfc, 0xbf,
-  0xfb, 0x0f, 0x03, 0x5e, 0xc4, 0x13, 0x6b, 0x3c, 0x10, 0x67, 0xff, 0x4d,
-  0x18, 0x46, 0xb3, 0xea, 0x5e, 0x02, 0xc2, 0xc1, 0x7f, 0x30, 0x81, 0x54,
-  0xc8, 0x37, 0xf1, 0xb8, 0x29, 0x21, 0x6c, 0x7f, 0x17, 0xfb, 0xeb, 0x26,
-  0x46, 0x36, 0xc1, 0x43, 0x01, 0xfb, 0xd8, 0x13, 0x56, 0xca, 0x05, 0x3d,
-  0xfb, 0xe0, 0x83, 0xd2, 0x43, 0x65, 0x56, 0xdd, 0x5e, 0xd6, 0x52, 0x8b,
-  0xf1, 0x4e, 0xd8, 0x83, 0xd1, 0x46, 0x85, 0xfd, 0x89, 0xfa, 0xe8, 0xdf,
-  0x39, 0x8b, 0x92, 0x3d, 0x6c, 0xf0, 0x95, 0x19, 0xb6, 0x5a, 0xca, 0x9b,
-  0xcb, 0x5c, 0x21, 0xe3, 0xe9, 0xf9, 0xfd, 0x29, 0xa0, 0x3b, 0x37, 0x66,
-  0x75, 0x4a, 0x18, 0x8e, 0x73, 0x41, 0x0d, 0x9c, 0x11, 0xed, 0x09, 0x0f,
-  0x96, 0xd8, 0x31, 0x58, 0xd6, 0xba, 0xb3, 0x83, 0xeb, 0x1d, 0xc8, 0x0d,
-  0x65, 0x23, 0x81, 0xbe, 0xdb, 0x9f, 0xd6, 0x05, 0x11, 0xa1, 0xb3, 0xaa,
-  0x45, 0x6e, 0xa7, 0x39, 0xc6, 0x17, 0x70, 0xe8, 0xce, 0xb6, 0x0a, 0x58,
-  0xb8, 0xdf, 0x7e, 0xc0, 0xe9, 0xe5, 0x00, 0x0a, 0xb9, 0xec, 0xb3, 0x63,
-  0x13, 0x0f, 0x4a, 0xcf, 0x74, 0x09, 0x59, 0x8e, 0x0a, 0x22, 0x59, 0x4f,
-  0xc6, 0xf6, 0x13, 0x11, 0x21, 0xdd, 0x49, 0x1e, 0x30, 0x35, 0x08, 0x96,
-  0x78, 0xe9, 0x20, 0xd6, 0x19, 0xd8, 0x79, 0xd6, 0xb8, 0x86, 0xa4, 0x0f,
-  0x64, 0x83, 0x64, 0xc8, 0x64, 0xbe, 0x65, 0xc8, 0xe6, 0xbe, 0xb8, 0xb7,
-  0xcc, 0xee, 0x12, 0x82, 0xd4, 0x33, 0x17, 0x2a, 0x0c, 0x33, 0xc4, 0x2a,
-  0x64, 0x2d, 0xa3, 0x01, 0xee, 0xe4, 0xb1, 0xe5, 0xbb, 0xf0, 0x22, 0xe8,
-  0xbb, 0xf6, 0x22, 0xb4, 0x57, 0x26, 0x6a, 0x9c, 0x2d, 0x0d, 0x40, 0xf6,
-  0x99, 0x22, 0xb4, 0x1b, 0x50, 0xfe, 0x56, 0xc2, 0x83, 0xc2, 0x16, 0x39,
-  0xd0, 0xcd, 0x17, 0x3b, 0xb6, 0x17, 0x39, 0xeb, 0x91, 0x55, 0xb4, 0x24,
-  0x0a, 0x72, 0xee, 0x6b, 0xd3, 0xfc, 0x65, 0xa6, 0x88, 0x56, 0x2d, 0xe8,
-  0x2d, 0x23, 0xe8, 0xff, 0x12, 0x29, 0xd1, 0xe3, 0xe0, 0x60, 0x82, 0x93,
-  0xc4, 0xea, 0x2f, 0x72, 0x2b, 0x46, 0xee, 0xe1, 0x1b, 0x56, 0xf4, 0x6f,
-  0xf6, 0xf3, 0x8b, 0xd8, 0xc6, 0x11, 0x90, 0xa5, 0xa2, 0x02, 0x11, 0xf1,
-  0xd8, 0x05, 0x4a, 0xb1, 0x7f, 0xf2, 0x0d, 0x90, 0x06, 0x18, 0x76, 0x7b,
-  0x56, 0xaa, 0x2f, 0x6d, 0xcc, 0x68, 0x0d, 0xa6, 0xce, 0x34, 0x29, 0x4b,
-  0xa3, 0xf1, 0xd7, 0x2b, 0x56, 0xc0, 0x0b, 0x17, 0x7f, 0x4e, 0xc2, 0x89,
-  0x4e, 0xbc, 0x89, 0xff, 0xd7, 0x29, 0xc7, 0x89, 0xce, 0x1b, 0x76, 0xaa,
-  0x2c, 0xc0, 0x2f, 0x5c, 0x72, 0x07, 0x75, 0xf4, 0x3d, 0x3b, 0x7e, 0xb8,
-  0x1b, 0x6b, 0xbe, 0xea, 0xa8, 0xfd, 0x00, 0xb6, 0x61, 0x4e, 0xe9, 0x79,
-  0x04, 0xf0, 0xba, 0x26, 0x5e, 0xa9, 0x0d, 0x83, 0xdb, 0xeb, 0x1c, 0x84,
-  0xb8, 0x23, 0xc0, 0x37, 0x29, 0xf8, 0x19, 0x88, 0xf2, 0x5b, 0xe8, 0x83,
-  0x26, 0xb5, 0xdd, 0x11, 0x0d, 0x38, 0xb3, 0xbf, 0x21, 0xed, 0x89, 0x3f,
-  0xee, 0x89, 0x77, 0x02, 0xe1, 0xb6, 0x05, 0x32, 0xbb, 0x37, 0x7f, 0xba,
-  0xb5, 0xf0, 0x23, 0xe8, 0xa7, 0x36, 0x27, 0xa2, 0x2a, 0x60, 0x8c, 0xa5,
-  0xcd, 0x1c, 0x86, 0xee, 0x88, 0x1b, 0x46, 0xc2, 0xeb, 0xea, 0xcb, 0x3f,
-  0xa7, 0x9d, 0x03, 0xa3, 0x6d, 0x02, 0x24, 0x0b, 0x9d, 0x91, 0xad, 0xda,
-  0xb6, 0x90, 0xc3, 0x7b, 0x2b, 0x5e, 0xc6, 0xaf, 0x80, 0xc0, 0xd2, 0x7c,
-  0xce, 0x5f, 0x23, 0xdd, 0x1a, 0xb8, 0x34, 0xd8, 0x28, 0x68, 0x11, 0x7b,
-  0xf0, 0x72, 0x09, 0xa7, 0x5e, 0xc6, 0xe8, 0x34, 0x67, 0xc4, 0xf7, 0xd0,
-  0x88, 0x21, 0x72, 0x15, 0x05, 0x9d, 0xe8, 0x86, 0xaa, 0xfd, 0x5f, 0xda,
-  0x36, 0x89, 0x7e, 0xf6, 0xa1, 0x89, 0x0b, 0x76, 0xbb, 0x0d, 0x87, 0xec,
-  0xa0, 0x24, 0x12, 0x7b, 0x1b, 0x36, 0xc6, 0x06, 0xaa, 0x00, 0x46, 0x1b,
-  0x09, 0xe0, 0x09, 0x0a, 0x35, 0x80, 0x6e, 0x8a, 0xb2, 0x54, 0x00, 0x9e,
-  0x62, 0xda, 0x03, 0xe5, 0x76, 0x31, 0xf6, 0xa0, 0xdb, 0xba, 0x07, 0xe2,
-  0x6c, 0x05, 0xbc, 0xb6, 0xe4, 0x3d, 0xc2, 0xec, 0x1d, 0xca, 0xde, 0x2b,
-  0x09, 0x6a, 0x22, 0x94, 0x28, 0x76, 0x4c, 0x72, 0x1a, 0xd9, 0x10, 0xb6,
-  0x65, 0x72, 0x91, 0x11, 0xd0, 0xf0, 0x73, 0xc2, 0x89, 0xae, 0xc8, 0x0b,
-  0x89, 0xb6, 0x67, 0xe7, 0x3a, 0x61, 0x20, 0xc9, 0x34, 0xec, 0x77, 0x2c,
-  0x31, 0x39, 0x25, 0x06, 0x1d, 0xe4, 0x07, 0x0b, 0x42, 0x30, 0x02, 0x7c,
-  0x5c, 0x76, 0x0b, 0x10, 0xae, 0x80, 0x24, 0xd8, 0xe3, 0xb7, 0x09, 0x1d,
-  0x7e, 0xeb, 0x48, 0xb8, 0xb6, 0x24, 0x3a, 0x6f, 0xe4, 0x58, 0xe2, 0xa1,
-  0xa3, 0xee, 0xb7, 0xe3, 0xc4, 0x7a, 0x10, 0x0a, 0x74, 0xc0, 0x2f, 0x6d,
-  0x3e, 0x42, 0xa6, 0xdc, 0x8f, 0xe6, 0x8b, 0x56, 0xde, 0xa5, 0x39, 0x3a,
-  0xaa, 0x2e, 0xdd, 0x00, 0x75, 0x29, 0x80, 0x34, 0xdb, 0xeb, 0x4e, 0x64,
-  0x65, 0x0e, 0x8c, 0xde, 0x1c, 0x26, 0x25, 0x74, 0xff, 0x10, 0x40, 0xdf,
-  0xe3, 0x4f, 0x3b, 0x76, 0xf4, 0x75, 0xb1, 0x21, 0x8f, 0xfb, 0xee, 0x75,
-  0x19, 0xb8, 0x60, 0x18, 0xa6, 0x17, 0xb0, 0x02, 0x41, 0x1e, 0x67, 0x25,
-  0xeb, 0xeb, 0xf3, 0xee, 0x65, 0x19, 0xf4, 0x39, 0x19, 0xe4, 0x14, 0x06,
-  0x9e, 0xed, 0x37, 0xdf, 0x0f, 0x1c, 0x62, 0x27, 0x37, 0x82, 0xb4, 0xd7,
-  0x2e, 0x51, 0x5f, 0x03, 0x08, 0xac, 0x43, 0x0f, 0x20, 0x1a, 0xdf, 0xae,
-  0xdc, 0xf2, 0xac, 0x2b, 0xad, 0x41, 0x8d, 0xae, 0xb1, 0xa0, 0xb6, 0x31,
-  0x2d, 0x81, 0xb5, 0xb3, 0x56, 0x62, 0xd7, 0x2b, 0x27, 0x61, 0x4e, 0xf4,
-  0xd8, 0x6a, 0xb6, 0xda, 0x80, 0x35, 0x2b, 0x54, 0x7f, 0x56, 0xf2, 0x8b,
-  0x7e, 0xfe, 0xd1, 0xb5, 0xe7, 0x01, 0xd8, 0x2e, 0x89, 0x83, 0x56, 0x97,
-  0x06, 0xcb, 0xae, 0xac, 0xc2, 0xfd, 0xff, 0x9e, 0xdb, 0x81, 0x17, 0x80,
-  0x8a, 0x00, 0xb0, 0x81, 0xc2, 0x8c, 0xc8, 0xf4, 0xd9, 0x12, 0xb9, 0x85,
-  0x53, 0x56, 0x3e, 0xba, 0x81, 0x5d, 0x6e, 0x02, 0x8d, 0x9e, 0xfb, 0x36,
-  0xf6, 0x69, 0x54, 0xbb, 0x2b, 0xd1, 0xf7, 0x8e, 0xf6, 0xfe, 0x83, 0x0d,
-  0xe8, 0x01, 0x11, 0x0d, 0x69, 0xfb, 0x56, 0xe2, 0x03, 0x56, 0xb4, 0x1a,
-  0x77, 0xe4, 0x13, 0x9e, 0x33, 0x65, 0xda, 0x89, 0x93, 0x2b, 0xc2, 0x5f,
-  0x07, 0xfd, 0x0e, 0x21, 0x72, 0x71, 0x12, 0xdf, 0x06, 0xb4, 0x01, 0x83,
-  0x56, 0xdb, 0xfa, 0x00, 0x67, 0xfc, 0x3b, 0xf7, 0xdb, 0x3a, 0xea, 0xa5,
-  0x77, 0x4f, 0xf1, 0x0a, 0x3b, 0x56, 0xe0, 0x3d, 0x49, 0xec, 0x30, 0x32,
-  0xf9, 0x01, 0x77, 0x64, 0x2c, 0xc6, 0xb5, 0xb6, 0x07, 0xf2, 0x5a, 0xe8,
-  0xef, 0x5c, 0x4e, 0xe6, 0x74, 0x17, 0x07, 0xce, 0x2d, 0x73, 0xf4, 0xf9,
-  0x64, 0x77, 0x0e, 0xa2, 0x95, 0xfd, 0x7b, 0x89, 0xc8, 0xb5, 0x4a, 0xf2,
-  0xa0, 0x65, 0x15, 0xfd, 0xbb, 0x54, 0x75, 0x20, 0x05, 0x78, 0xb4, 0x15,
-  0x73, 0xce, 0x74, 0x77, 0x49, 0xda, 0x72, 0x09, 0x16, 0xd1, 0x56, 0x76,
-  0x71, 0x8e, 0xfe, 0xde, 0x2b, 0xb4, 0xf7, 0xda, 0x2a, 0xc6, 0xf4, 0x25,
-  0x97, 0x20, 0x3e, 0x20, 0x30, 0xa9, 0xda, 0x1b, 0xd4, 0xb9, 0xa6, 0x43,
-  0xb0, 0x06, 0x21, 0x46, 0xd2, 0xe9, 0x4e, 0xe4, 0x43, 0xef, 0x1b, 0x22,
-  0x84, 0x10, 0xc4, 0xd1, 0xb6, 0xa3, 0x26, 0x24, 0xc8, 0x1e, 0xb9, 0xc5,
-  0xb8, 0x5a, 0x13, 0x76, 0x14, 0xea, 0x7e, 0xfb, 0xfa, 0x11, 0x57, 0x11,
-  0x37, 0x39, 0xfa, 0xb9, 0xa2, 0x03, 0x33, 0xff, 0x6f, 0x17, 0xb2, 0x11,
-  0x56, 0xbb, 0xda, 0x76, 0x00, 0x75, 0x2e, 0xe9, 0xfc, 0x36, 0x8b, 0xe8,
-  0x47, 0xe6, 0x64, 0xd0, 0x74, 0x08, 0x48, 0x7b, 0xe1, 0x3d, 0x1d, 0x5d,
-  0x04, 0x34, 0x1c, 0x83, 0x26, 0x5f, 0x12, 0x55, 0x27, 0xa7, 0x0d, 0x21,
-  0x7d, 0x1b, 0xf6, 0x83, 0xbb, 0x62, 0x04, 0x83, 0x63, 0x6d, 0x00, 0x9b,
-  0x97, 0xda, 0xb2, 0xb8, 0x9b, 0x39, 0x82, 0x0d, 0x23, 0xb2, 0xc7, 0x05,
-  0xa8, 0x85, 0x4c, 0xda, 0xf5, 0x8f, 0x8a, 0xdd, 0xeb, 0x7b, 0x59, 0x20,
-  0xa7, 0x61, 0x40, 0x64, 0x64, 0xd6, 0x32, 0x08, 0xe8, 0xd4, 0x31, 0x4b,
-  0xd6, 0xc4, 0x18, 0x02, 0x65, 0xca, 0xa6, 0xa4, 0x41, 0xb4, 0xa3, 0x00,
-  0x58, 0xd7, 0x34, 0xc3, 0xaa, 0xea, 0x5d, 0x95, 0x8b, 0x36, 0x41, 0x8c,
-  0x7a, 0xbf, 0x2a, 0xa3, 0x12, 0xec, 0x31, 0x3c, 0x32, 0xf1, 0x0f, 0x37,
-  0xc3, 0xc1, 0x19, 0xd1, 0xa1, 0xe0, 0x5c, 0xf5, 0xe1, 0x1e, 0x84, 0xd8,
-  0xee, 0x26, 0x3b, 0x47, 0x52, 0xdc, 0xdd, 0x71, 0x85, 0xdb, 0x8b, 0x0c,
-  0xe4, 0xf0, 0x77, 0xff, 0x38, 0x01, 0xbe, 0xb6, 0xee, 0x75, 0x1d, 0x00,
-  0xe8, 0x70, 0x2a, 0x61, 0xfe, 0x35, 0x53, 0xc1, 0xf8, 0x41, 0x9f, 0x1e,
-  0xbd, 0xc9, 0x72, 0xa2, 0xd9, 0x8d, 0xe8, 0x74, 0x8d, 0x31, 0x06, 0x29,
-  0x6b, 0xa0, 0x41, 0x09, 0x50, 0xb9, 0x5f, 0x34, 0xf9, 0xf0, 0xbd, 0xee,
-  0xb8, 0x9a, 0xd3, 0x56, 0x84, 0x59, 0x08, 0x1a, 0xa5, 0xab, 0x8d, 0x76,
-  0xd7, 0xb7, 0xe6, 0x01, 0xff, 0xb2, 0xdb, 0xee, 0xfd, 0x03, 0xec, 0x34,
-  0xea, 0xcd, 0x44, 0xdd, 0xb8, 0xc3, 0x27, 0x5c, 0x35, 0x0a, 0x83, 0x20,
-  0x8b, 0xb4, 0x82, 0x14, 0x4e, 0xe4, 0xf6, 0x1f, 0x7e, 0x8d, 0xde, 0x9a,
-  0xe8, 0x4d, 0x36, 0xa3, 0xee, 0x6b, 0xf0, 0x66, 0x06, 0x12, 0xc1, 0x62,
-  0xba, 0xf8, 0x3a, 0x21, 0x6a, 0x06, 0x25, 0xa4, 0xdb, 0x25, 0x27, 0xc5,
-  0x15, 0x3b, 0xae, 0x31, 0xb7, 0x2b, 0xf0, 0xaf, 0xe4, 0xef, 0x1d, 0x0f,
-  0xdd, 0x30, 0xdc, 0x81, 0x6e, 0x4e, 0x96, 0xaa, 0xe8, 0x46, 0x83, 0xfb,
-  0x68, 0xf2, 0x06, 0x66, 0xea, 0xba, 0xf4, 0x6b, 0x80, 0x16, 0xfe, 0x00,
-  0x28, 0x5d, 0xec, 0x18, 0x01, 0x6c, 0xde, 0xea, 0xa3, 0x16, 0x43, 0xf6,
-  0x5b, 0x0b, 0x1f, 0x75, 0x6d, 0x67, 0x27, 0xd9, 0x5b, 0xb9, 0x0b, 0x91,
-  0x08, 0x66, 0x3a, 0x4e, 0xfe, 0x90, 0x43, 0x1c, 0x8b, 0x1d, 0x49, 0x25,
-  0xe2, 0x32, 0x8b, 0xe5, 0xb3, 0x03, 0x29, 0xaa, 0x68, 0xb3, 0x33, 0x0d,
-  0xdf, 0x0a, 0x5e, 0x9b, 0x45, 0x2a, 0x3b, 0xfd, 0x5e, 0xf6, 0x73, 0x25,
-  0xb8, 0x4c, 0xd3, 0x43, 0x75, 0xa2, 0x90, 0x6a, 0xf6, 0x53, 0x1d, 0x1f,
-  0x82, 0x5b, 0xab, 0x6f, 0x18, 0xa7, 0x5c, 0x0a, 0xcc, 0x1e, 0xeb, 0xf2,
-  0x2f, 0xbc, 0xbb, 0x3e, 0x4f, 0xc7, 0x30, 0xc0, 0x8b, 0x3d, 0xb0, 0xff,
-  0xea, 0xa8, 0xe4, 0x5d, 0xb4, 0x74, 0x8e, 0x87, 0x4c, 0x85, 0xcb, 0x3b,
-  0x7e, 0x80, 0x4d, 0x5e, 0x01, 0xb9, 0xfa, 0x9d, 0x3c, 0xa8, 0xf8, 0x6b,
-  0x8d, 0x90, 0xb4, 0xbd, 0xfd, 0xad, 0xab, 0x18, 0xee, 0xf8, 0xb8, 0x78,
-  0x4c, 0x9d, 0x0f, 0x11, 0xec, 0x72, 0x9f, 0xc1, 0xa1, 0xf6, 0xf5, 0xf0,
-  0xe8, 0x01, 0x0d, 0x56, 0xff, 0x6e, 0x0e, 0xf5, 0x2f, 0xac, 0x5e, 0x59,
-  0x83, 0xe6, 0xcf, 0x1c, 0x91, 0x0a, 0xcc, 0xd8, 0x0a, 0xb7, 0xd9, 0xea,
-  0x03, 0xcd, 0x5e, 0xf2, 0x11, 0xb9, 0xf1, 0x25, 0xf3, 0x21, 0xad, 0xcd,
-  0x9f, 0xe9, 0xdd, 0xd8, 0xfd, 0x12, 0x8b, 0x62, 0x1d, 0x9f, 0xa9, 0x94,
-  0x1c, 0x34, 0x10, 0xd4, 0xea, 0x02, 0x0a, 0x76, 0xa4, 0x22, 0xe1, 0x34,
-  0xfe, 0x3a, 0x14, 0x47, 0x19, 0xab, 0x21, 0xbf, 0x45, 0x10, 0x3c, 0x07,
-  0x77, 0x04, 0xc1, 0x3c, 0x01, 0xbb, 0x30, 0xb8, 0xdc, 0x61, 0xa7, 0x76,
-  0xe0, 0xb8, 0x1a, 0x28, 0xad, 0xff, 0x9a, 0x0a, 0x27, 0x46, 0x1a, 0xc6,
-  0x56, 0xea, 0xac, 0xef, 0xef, 0x3e, 0x55, 0x9d, 0x0e, 0xae, 0x63, 0x28,
-  0x9a, 0x43, 0x06, 0x89, 0x22, 0x06, 0x4b, 0xe9, 0x39, 0x32, 0xc3, 0xa8,
-  0x4d, 0x01, 0xa4, 0x5d, 0x96, 0xf8, 0x23, 0xf4, 0x70, 0x76, 0x2d, 0x54,
-  0xdc, 0x72, 0xec, 0x47, 0x05, 0x99, 0x4b, 0x2e, 0xf7, 0xe8, 0x1b, 0x7e,
-  0xf8, 0xaf, 0x71, 0xa7, 0xfc, 0xfb, 0xe8, 0x39, 0xd7, 0x72, 0xdf, 0xa7,
-  0xd1, 0x39, 0xc3, 0x73, 0xad, 0xcd, 0xe2, 0x96, 0xf6, 0xfa, 0xea, 0x35,
-  0x13, 0x57, 0x4a, 0x38, 0x05, 0x4f, 0x85, 0x1f, 0x36, 0x5a, 0xe9, 0xb6,
-  0x9c, 0x7e, 0xd5, 0x35, 0xa8, 0xab, 0xdb, 0x06, 0x1b, 0x15, 0x50, 0x5a,
-  0x8c, 0xcf, 0x6e, 0x24, 0xb8, 0xf7, 0x4d, 0x28, 0xeb, 0x18, 0x19, 0x60,
-  0x03, 0x7e, 0xf0, 0x14, 0x7d, 0x0b, 0xec, 0x87, 0x88, 0x4f, 0x76, 0xc2,
-  0xa9, 0x09, 0x70, 0xe1, 0x49, 0x0f, 0x6f, 0xec, 0xb9, 0xcc, 0x84, 0x1b,
-  0x3b, 0x99, 0xec, 0x57, 0x63, 0xbd, 0x51, 0x74, 0x23, 0x85, 0xdb, 0x0a,
-  0x0b, 0x0c, 0x43, 0xa0, 0x6a, 0x21, 0xfd, 0xa7, 0xf9, 0xea, 0x8a, 0x44,
-  0x10, 0x85, 0xf0, 0x55, 0xbd, 0x44, 0x2a, 0x84, 0xc0, 0x6d, 0x86, 0xfe,
-  0xae, 0x0a, 0xca, 0x6d, 0x0c, 0x04, 0x32, 0xd6, 0x01, 0x9b, 0x62, 0xfe,
-  0x35, 0xef, 0x86, 0x25, 0xb6, 0x1c, 0x89, 0xe9, 0x40, 0x44, 0xa8, 0x06,
-  0x7f, 0x6e, 0xc6, 0x83, 0xc6, 0x0e, 0xd1, 0x8b, 0x14, 0x5a, 0x81, 0x36,
-  0x5e, 0xf8, 0x57, 0x0e, 0xcf, 0x16, 0xfa, 0x56, 0xd4, 0xce, 0xfc, 0x25,
-  0x39, 0x7d, 0x12, 0x24, 0x5e, 0x81, 0xda, 0xac, 0x44, 0x68, 0xb9, 0xfc,
-  0xcd, 0xa9, 0xb3, 0xaa, 0xc0, 0x6a, 0xfe, 0x08, 0x10, 0x3f, 0xf6, 0xeb,
-  0x11, 0x18, 0x32, 0x75, 0xcd, 0xf1, 0xe5, 0x38, 0x91, 0x5d, 0x88, 0xfa,
-  0x45, 0x72, 0x9f, 0x83, 0xb8, 0x23, 0x29, 0x6c, 0x1b, 0xc9, 0xde, 0x0c,
-  0xe9, 0x6a, 0xfc, 0x00, 0x3f, 0x20, 0x41, 0x2d, 0x82, 0x58, 0x54, 0x0d,
-  0x0b, 0xfc, 0x6a, 0x75, 0x19, 0xaf, 0xea, 0x35, 0xe5, 0x96, 0xbb, 0x7f,
-  0xc0, 0xc3, 0x1c, 0xf5, 0x24, 0x2d, 0x42, 0xbd, 0x7d, 0x10, 0xb8, 0xac,
-  0xd2, 0x1e, 0x90, 0x21, 0x18, 0xb0, 0xc2, 0xc3, 0x02, 0xff, 0x75, 0x0b,
-  0x4c, 0x2a, 0x16, 0x02, 0xdd, 0xb6, 0x60, 0x5f, 0xb6, 0x9d, 0x4c, 0x20,
-  0xda, 0x8b, 0x2c, 0x24, 0xab, 0x3d, 0x2e, 0x8b, 0x50, 0xa2, 0x0b, 0xd8,
-  0xa4, 0xdc, 0xfa, 0xf9, 0xde, 0xc6, 0xe8, 0xfa, 0x93, 0x02, 0x4b, 0x08,
-  0xf0, 0x2c, 0xf8, 0xba, 0x22, 0x4f, 0xd9, 0x83, 0xec, 0x57, 0x91, 0x72,
-  0x89, 0x46, 0xd2, 0xcc, 0xd4, 0xd5, 0x4c, 0xf8, 0x1e, 0x16, 0x9c, 0x03,
-  0x0d, 0xaa, 0x89, 0xd9, 0x53, 0x89, 0x55, 0x18, 0xdd, 0x7a, 0x1a, 0x2e,
-  0xb5, 0x5e, 0x4f, 0xc3, 0xe4, 0x20, 0xc2, 0xe6, 0xb1, 0x62, 0xec, 0xaf,
-  0xd6, 0x01, 0x4d, 0xc3, 0xde, 0xb4, 0x13, 0x2b, 0x0a, 0x76, 0x03, 0x75,
-  0x7b, 0x56, 0xb8, 0xdd, 0xa9, 0xb5, 0xe6, 0x07, 0x06, 0x19, 0x3b, 0x02,
-  0x2a, 0x0b, 0x66, 0xda, 0x03, 0x6b, 0x8f, 0x01, 0x1d, 0xc4, 0xdc, 0x57,
-  0x28, 0x39, 0x43, 0xb3, 0x0b, 0xe2, 0x5c, 0x03, 0x64, 0x85, 0x5b, 0x47,
-  0xa9, 0x03, 0x5d, 0x63, 0xd8, 0x71, 0x64, 0xe2, 0x68, 0x40, 0xeb, 0xcf,
-  0x3b, 0x14, 0x74, 0x73, 0x38, 0x46, 0xac, 0xfa, 0x5e, 0xec, 0xd3, 0xe3,
-  0x21, 0x54, 0x62, 0xf8, 0x05, 0x04, 0x1b, 0x60, 0xe0, 0x2d, 0xec, 0xd6,
-  0x24, 0x13, 0xb0, 0xe2, 0x39, 0xf0, 0x69, 0x43, 0x1b, 0x79, 0xda, 0x76,
-  0x16, 0x10, 0xb2, 0xab, 0xee, 0xa7, 0xda, 0x4d, 0x9b, 0xeb, 0xeb, 0x06,
-  0xe9, 0x6d, 0x66, 0x5a, 0x29, 0x96, 0x4e, 0xe0, 0x59, 0xe2, 0xf7, 0x45,
-  0x19, 0x51, 0x0b, 0x69, 0x65, 0xdc, 0x96, 0xe2, 0xde, 0x4f, 0x4b, 0x2d,
-  0x57, 0xa6, 0x2b, 0xa3, 0xbb, 0xe8, 0xbd, 0x2c, 0x46, 0x6a, 0xd4, 0x7e,
-  0xc9, 0xd2, 0x74, 0x09, 0x1d, 0x07, 0xbd, 0x0c, 0xe8, 0x8f, 0x16, 0xcd,
-  0x65, 0x10, 0x83, 0xde, 0x9d, 0xea, 0xe0, 0xfe, 0x8c, 0x13, 0xc7, 0x05,
-  0x0b, 0xba, 0x77, 0x45, 0x02, 0x04, 0xcf, 0x04, 0x06, 0x2a, 0x3e, 0x0c,
-  0xec, 0x25, 0x04, 0xe4, 0xee, 0xb9, 0x07, 0x11, 0xb8, 0x2a, 0x77, 0x09,
-  0xed, 0x8d, 0xc3, 0x00, 0x41, 0xb1, 0x7c, 0xf9, 0x42, 0xd2, 0x3f, 0x01,
-  0xfb, 0x80, 0x67, 0x03, 0x81, 0x0f, 0xef, 0xbe, 0x3d, 0xff, 0x0f, 0x72,
-  0x13, 0x01, 0x50, 0x84, 0xb7, 0x9d, 0x0c, 0x0b, 0x3a, 0xbc, 0x4e, 0xde,
-  0x0b, 0xf7, 0x76, 0x49, 0xc3, 0x26, 0x77, 0x22, 0x0b, 0x07, 0x74, 0x85,
-  0x19, 0x24, 0x16, 0x37, 0x69, 0x5d, 0xf6, 0x01, 0xf2, 0x8a, 0xd4, 0xe8,
-  0x4b, 0xd7, 0x11, 0x80, 0xc2, 0x56, 0x52, 0x27, 0x02, 0xce, 0x3e, 0x5a,
-  0x78, 0x55, 0x16, 0xba, 0xf0, 0x6b, 0xf8, 0xf2, 0x7c, 0x4b, 0xa1, 0x8c,
-  0x63, 0x6d, 0x3c, 0xfd, 0x37, 0x25, 0x04, 0xff, 0x0e, 0x68, 0x0a, 0x50,
-  0x31, 0xb2, 0x95, 0xfc, 0xdb, 0x13, 0x3d, 0x05, 0xa8, 0xfe, 0x18, 0xd7,
-  0x2c, 0xc4, 0x83, 0x9f, 0x55, 0x2c, 0x03, 0x17, 0xeb, 0x68, 0x56, 0xe6,
-  0x2c, 0x3e, 0x07, 0x89, 0x97, 0x41, 0x62, 0x3c, 0xd9, 0x4c, 0xf2, 0x80,
-  0xbd, 0x61, 0x46, 0xe9, 0x25, 0x73, 0x33, 0xda, 0x1a, 0x09, 0xab, 0x5c,
-  0x0c, 0x4e, 0x57, 0xf1, 0x03, 0x2c, 0xe9, 0xfc, 0xa1, 0xc4, 0xb3, 0xec,
-  0x01, 0xe5, 0xee, 0x11, 0xe2, 0xe9, 0x38, 0xfe, 0x59, 0xef, 0xd4, 0x19,
-  0xd2, 0x27, 0x4d, 0x15, 0x58, 0xbb, 0xc6, 0xe8, 0xfa, 0x35, 0xf0, 0x9a,
-  0xc4, 0x71, 0x09, 0x5b, 0x79, 0x1d, 0x1d, 0x11, 0xc8, 0x8a, 0x05, 0x35,
-  0xfb, 0x9a, 0x94, 0x36, 0x45, 0xe8, 0x46, 0xea, 0x67, 0xa0, 0x64, 0xb4,
-  0x2b, 0xdc, 0x13, 0xe4, 0x10, 0x16, 0x14, 0x1c, 0x4a, 0x6e, 0xd9, 0x19,
-  0x2a, 0x49, 0x93, 0x2c, 0x85, 0xda, 0xf5, 0xc1, 0xdc, 0x00, 0x1c, 0xe1,
-  0x38, 0xbb, 0x70, 0xac, 0xf8, 0x61, 0xd8, 0xc6, 0xdb, 0xf6, 0x31, 0xe4,
-  0x8c, 0xf8, 0xed, 0x63, 0xfa, 0xe7, 0x03, 0x1b, 0xe1, 0xe4, 0x3d, 0xe6,
-  0x50, 0x83, 0x37, 0xd4, 0x68, 0xaa, 0xec, 0xd9, 0x40, 0x2b, 0x9c, 0xe8,
-  0xb3, 0xdc, 0xc0, 0xea, 0x02, 0x82, 0xff, 0x05, 0x0f, 0x00, 0xb1, 0x04,
-  0xd3, 0xe8, 0x6b, 0x1f, 0xe7, 0x77, 0xe8, 0x11, 0x9c, 0x0b, 0xac, 0x30,
-  0xb2, 0x96, 0xd4, 0xba, 0x25, 0x13, 0xd5, 0x68, 0x68, 0x9e, 0xc9, 0xeb,
-  0xc6, 0xfa, 0x04, 0xdf, 0xc9, 0x0a, 0x72, 0xda, 0x32, 0xdc, 0x32, 0xda,
-  0x32, 0xde, 0xc9, 0xdc, 0x4c, 0xde, 0x85, 0xe4, 0xba, 0x29, 0x03, 0x90,
-  0xde, 0x2e, 0x20, 0x42, 0xf6, 0x65, 0x16, 0x9f, 0x68, 0x69, 0xb8, 0xe2,
-  0x7d, 0xe0, 0xb8, 0x57, 0x2a, 0xb3, 0x94, 0x65, 0x46, 0x06, 0xc6, 0x3c,
-  0xdc, 0x75, 0x11, 0x8f, 0xda, 0x75, 0x09, 0x24, 0x8c, 0xbc, 0x99, 0x08,
-  0x2c, 0x0b, 0xc7, 0x4f, 0x1d, 0xb9, 0x4b, 0x38, 0xec, 0x68, 0x07, 0x3d,
-  0x28, 0xb6, 0x8d, 0x76, 0xb6, 0xf7, 0x4f, 0x3b, 0xcc, 0x11, 0x07, 0x8f,
-  0x0c, 0xa0, 0x66, 0xf0, 0x90, 0xf6, 0x64, 0xe4, 0x1b, 0xe6, 0x23, 0x31,
-  0xf1, 0x94, 0x57, 0x9d, 0x47, 0xfa, 0xb5, 0xa7, 0x4d, 0x68, 0x49, 0xfc,
-  0x96, 0x18, 0xfb, 0x95, 0x39, 0xbe, 0x29, 0x65, 0xe8, 0x90, 0xea, 0x2e,
-  0xf4, 0x69, 0xf8, 0xa4, 0x4b, 0xac, 0x61, 0x92, 0x0d, 0x85, 0x15, 0x98,
-  0xd3, 0x17, 0x8a, 0x6a, 0x2a, 0x2e, 0x5a, 0x03, 0x46, 0xe6, 0x8f, 0xd6,
-  0x44, 0x67, 0xbd, 0xf8, 0x18, 0x92, 0xc6, 0xf6, 0x8f, 0xc8, 0xf0, 0xe4,
-  0x38, 0x03, 0x06, 0xe4, 0x46, 0xe6, 0x4e, 0x24, 0xc1, 0x99, 0x5b, 0x52,
-  0xfd, 0x05, 0x76, 0x1a, 0x94, 0x27, 0x32, 0x84, 0x60, 0x20, 0xb4, 0x46,
-  0x30, 0xe3, 0x76, 0xf7, 0x76, 0xc7, 0x36, 0x84, 0x40, 0xf7, 0x8c, 0x60,
-  0xee, 0x63, 0x81, 0xfe, 0x2c, 0xec, 0x98, 0x0f, 0xf7, 0x12, 0x36, 0x8c,
-  0x79, 0x19, 0xfc, 0x31, 0x28, 0x0e, 0xc7, 0x78, 0xc7, 0x28, 0x53, 0x79,
-  0x0f, 0x79, 0x96, 0xe6, 0xe0, 0x79, 0xe8, 0x0b, 0x96, 0xe6, 0xe8, 0x23,
-  0x52, 0x76, 0x76, 0x07, 0x44, 0xce, 0x22, 0xa7, 0xf4, 0x5d, 0x44, 0xff,
-  0xfb, 0x15, 0x76, 0x12, 0xb8, 0x6c, 0xb6, 0xb0, 0x81, 0x02, 0x61, 0x0e,
-  0xf6, 0xe9, 0xd4, 0xfc, 0x23, 0xba, 0x8f, 0xfa, 0x2c, 0x96, 0xf0, 0x54,
-  0x14, 0x56, 0x74, 0xd5, 0x03, 0x5c, 0x42, 0x81, 0xf3, 0x77, 0x12, 0x83,
-  0x0b, 0x5c, 0x83, 0x0a, 0x85, 0xef, 0xd6, 0xf4, 0xf0, 0x86, 0xad, 0xa1,
-  0xc4, 0x0a, 0x01, 0xb2, 0x7a, 0xf6, 0xff, 0xea, 0x8a, 0x7d, 0x01, 0x80,
-  0xe7, 0x0f, 0xe0, 0x8a, 0x1d, 0x30, 0xdd, 0x9b, 0x55, 0x02, 0xbe, 0x73,
-  0x89, 0xd6, 0xd3, 0xe6, 0xdf, 0x08, 0x01, 0xd3, 0xfa, 0x09, 0xf8, 0xd6,
-  0x81, 0xfb, 0xf7, 0x0f, 0xb6, 0x51, 0xbb, 0x37, 0x6b, 0x01, 0x5e, 0x85,
-  0xf8, 0x7b, 0xf7, 0xf2, 0x00, 0x81, 0xfe, 0x0f, 0xcd, 0xbe, 0x76, 0x27,
-  0xfb, 0x96, 0xf0, 0x45, 0x85, 0xa4, 0x0c, 0xde, 0x36, 0x0f, 0xfe, 0x50,
-  0xa2, 0x96, 0xd8, 0x3c, 0xf9, 0x43, 0xe5, 0x05, 0x22, 0x75, 0x86, 0x42,
-  0xb6, 0x2d, 0x7c, 0xf7, 0x14, 0x1f, 0x3e, 0x4b, 0x01, 0xc2, 0x9a, 0xe6,
-  0x11, 0x0e, 0x72, 0x68, 0x1d, 0x07, 0x62, 0x86, 0x95, 0xde, 0x93, 0x85,
-  0x6b, 0x5a, 0x4a, 0x19, 0xf6, 0x0e, 0x76, 0x5c, 0xe7, 0xf8, 0x94, 0x86,
-  0x92, 0x77, 0x4a, 0xd2, 0x8b, 0x4e, 0x2c, 0xc1, 0xf2, 0xd0, 0x4c, 0x8d,
-  0x96, 0x8d, 0x19, 0x0a, 0x17, 0xe0, 0x2b, 0x4a, 0x9a, 0x91, 0x8c, 0x1b,
-  0xa9, 0xee, 0x37, 0xf0, 0x85, 0xf6, 0x17, 0xce, 0x68, 0xfb, 0xfe, 0xc3,
-  0xe5, 0x75, 0x20, 0x40, 0xc2, 0x21, 0x47, 0xdc, 0xe9, 0xe4, 0x89, 0xfe,
-  0xa1, 0x18, 0xe4, 0xc3, 0x13, 0xaa, 0xec, 0xbd, 0xe3, 0x18, 0xff, 0x8f,
-  0x16, 0xc9, 0x21, 0x01, 0x4c, 0xfc, 0x9e, 0x0d, 0x27, 0x59, 0xe6, 0x7c,
-  0xe8, 0xe9, 0x56, 0xfb, 0x4b, 0xc4, 0x06, 0x2e, 0x7c, 0x25, 0x83, 0x2f,
-  0x76, 0x89, 0xd1, 0xa1, 0xea, 0x8e, 0xc1, 0xde, 0x3b, 0x40, 0x26, 0x80,
-  0x9b, 0x2b, 0x03, 0x42, 0xb6, 0xeb, 0x8a, 0xd0, 0x83, 0x9e, 0xed, 0x04,
-  0x20, 0x94, 0x5b, 0x2d, 0x9d, 0xc2, 0x56, 0x77, 0x88, 0xdb, 0xf5, 0x0d,
-  0x0e, 0x40, 0xbf, 0x1b, 0xb4, 0x02, 0xcd, 0x21, 0x5a, 0xb1, 0xc3, 0x3c,
-  0x98, 0x3f, 0x46, 0x2c, 0xee, 0x1c, 0x4f, 0x1c, 0xe0, 0xe8, 0xd0, 0xff,
-  0x85, 0xef, 0x0a, 0xcb, 0xda, 0x0c, 0x8d, 0x89, 0xb5, 0x6d, 0x16, 0x06,
-  0xdc, 0x88, 0x07, 0x0f, 0xd9, 0x26, 0x14, 0x65, 0x18, 0x01, 0x60, 0x90,
-  0xb8, 0x6b, 0x77, 0x62, 0xd7, 0x83, 0xf9, 0xe1, 0xf6, 0x75, 0x17, 0xe4,
-  0x9a, 0x55, 0x02, 0xdf, 0x68, 0x0e, 0xf7, 0xdf, 0xf7, 0xb7, 0x5e, 0xe6,
-  0xdf, 0x00, 0xf4, 0xc6, 0x07, 0x2d, 0xff, 0xc8, 0xa0, 0x60, 0xaa, 0x0b,
-  0xf8, 0xde, 0x74, 0xef, 0x99, 0x7a, 0x89, 0x1d, 0x9a, 0xad, 0x32, 0x04,
-  0x0a, 0xd0, 0x16, 0x44, 0xfa, 0x05, 0x80, 0xfe, 0x25, 0x8a, 0x9f, 0x96,
-  0x2a, 0x88, 0x1c, 0xc0, 0x13, 0xf6, 0xb4, 0x25, 0x54, 0x36, 0x46, 0xc0,
-  0xe1, 0x09, 0xd3, 0x4a, 0x7b, 0x77, 0xc6, 0xc6, 0xb6, 0x74, 0x4e, 0x8b,
-  0x3e, 0xcb, 0x76, 0x11, 0xdf, 0x12, 0x8a, 0x1f, 0x8a, 0x3c, 0xfe, 0x89,
-  0xc7, 0x88, 0x3d, 0x88, 0x1c, 0xff, 0x58, 0xeb, 0x25, 0x8a, 0x81, 0xf6,
-  0x9b, 0x10, 0x15, 0xf8, 0x3e, 0x7f, 0x24, 0x23, 0x97, 0x15, 0x6e, 0x08,
-  0x46, 0x08, 0xe4, 0x42, 0x4a, 0xd0, 0xe4, 0xbd, 0xed, 0x91, 0xcd, 0xc1,
-  0x35, 0x00, 0x0c, 0x51, 0xc6, 0x25, 0x59, 0x4b, 0x99, 0x0a, 0xcc, 0x1d,
-  0x26, 0x3e, 0x08, 0xe8, 0x0e, 0xab, 0x9d, 0xaa, 0xf2, 0xa5, 0xd1, 0xdb,
-  0x4f, 0x2b, 0x16, 0x48, 0xe8, 0xeb, 0xcb, 0x50, 0x7c, 0xf4, 0x28, 0x24,
-  0x05, 0x93, 0x77, 0x1a, 0x42, 0x83, 0xba, 0xc1, 0x8a, 0x28, 0xd8, 0x39,
-  0x46, 0xee, 0x1b, 0x5e, 0x3d, 0x25, 0x29, 0x33, 0x7f, 0xe8, 0xc1, 0xfe,
-  0xeb, 0xed, 0x30, 0xaa, 0xc0, 0x1c, 0x29, 0x0b, 0x24, 0xf2, 0x3f, 0xfc,
-  0x20, 0x00, 0xe0, 0x80, 0x3c, 0x2d, 0x23, 0x71, 0x7b, 0x7e, 0xf2, 0x46,
-  0x08, 0x61, 0x30, 0x4e, 0x5d, 0x12, 0x30, 0x5a, 0x39, 0xd6, 0x37, 0x0b,
-  0xfe, 0x72, 0x1a, 0x3c, 0x39, 0x77, 0x16, 0x02, 0xfa, 0x51, 0xf8, 0x81,
-  0x78, 0xe3, 0xc7, 0x3c, 0x6a, 0x46, 0xdf, 0x9e, 0x30, 0x01, 0xd7, 0xeb,
-  0xf6, 0xe0, 0x8d, 0x44, 0x01, 0x2d, 0xd6, 0x6c, 0x2d, 0xa3, 0x00, 0x80,
-  0x0d, 0xc2, 0xe9, 0xbb, 0x61, 0x0e, 0x68, 0x75, 0x99, 0x07, 0x35, 0x5b,
-  0xc6, 0xfe, 0x75, 0x89, 0xc1, 0x46, 0x3d, 0x0d, 0xd8, 0xfd, 0x72, 0x23,
-  0x76, 0x50, 0x3d, 0x73, 0xa3, 0x06, 0xb0, 0x7b, 0x4b, 0x3d, 0x78, 0x81,
-  0x7b, 0x61, 0x3d, 0x75, 0x04, 0x7f, 0x5e, 0xe9, 0x28, 0x01, 0x3d, 0x6f,
-  0x6f, 0x0c, 0x4f, 0x3d, 0x69, 0x2f, 0x45, 0xe9, 0x1b, 0x2d, 0x25, 0xfc,
-  0x20, 0x22, 0x3d, 0x63, 0x01, 0xd6, 0x67, 0x58, 0x04, 0xf8, 0x42, 0xe9,
-  0x07, 0x01, 0x25, 0xc4, 0xf0, 0x67, 0xe9, 0x10, 0x01, 0x04, 0xd5, 0x09,
-  0x07, 0x6c, 0x07, 0x1f, 0x4b, 0xc5, 0xfe, 0xe9, 0xe9, 0x40, 0xff, 0xa8,
-  0xba, 0xe9, 0x3a, 0xff, 0x35, 0x35, 0x87, 0x15, 0x8c, 0x0b, 0xbd, 0x8b,
-  0xb7, 0x4f, 0x18, 0x98, 0x00, 0xdb, 0xb9, 0xf6, 0x15, 0x0f, 0x03, 0x99,
-  0x21, 0x3e, 0x7c, 0xeb, 0x05, 0xb9, 0x0a, 0x06, 0x71, 0xea, 0xb9, 0x10,
-  0x70, 0x8d, 0x07, 0x3e, 0x41, 0x45, 0x07, 0xb8, 0x43, 0x06, 0x02, 0x76,
-  0x1b, 0xeb, 0x5f, 0x4d, 0x33, 0x04, 0x83, 0x77, 0xae, 0xf4, 0x53, 0x07,
-  0xf8, 0x78, 0xeb, 0x49, 0xe9, 0x99, 0xd9, 0x0c, 0xc9, 0x58, 0x6a, 0x0f,
-  0x99, 0xeb, 0x2e, 0x60, 0x0d, 0x23, 0xa2, 0x76, 0xeb, 0x1f, 0x20, 0x53,
-  0x0d, 0x21, 0x20, 0x09, 0x8f, 0x1a, 0x8d, 0xf6, 0x95, 0x56, 0xb7, 0x08,
-  0xe8, 0x80, 0xd2, 0xfd, 0x8d, 0x77, 0xb8, 0x9d, 0x17, 0x7b, 0x42, 0xfe,
-  0xab, 0xf0, 0xfd, 0x29, 0xc7, 0x56, 0x10, 0x82, 0xb7, 0x09, 0x85, 0xff,
-  0xc7, 0x7e, 0x09, 0x20, 0x7f, 0xe8, 0x39, 0xfd, 0x4f, 0xeb, 0xf3, 0x8e,
-  0x1d, 0x3b, 0xcb, 0x52, 0x5d, 0xc1, 0x07, 0x0b, 0xb7, 0x08, 0x51, 0xbf,
-  0x1c, 0x25, 0xfd, 0x41, 0xeb, 0xec, 0x6d, 0x20, 0x7f, 0x2e, 0x7a, 0x49,
-  0xfe, 0xf9, 0x23, 0x15, 0x80, 0xa9, 0x6b, 0x16, 0x7b, 0xe8, 0x0c, 0xfd,
-  0x46, 0x7b, 0xe9, 0x43, 0xfe, 0x70, 0xb5, 0x89, 0x07, 0x09, 0xc0, 0x30,
-  0x40, 0xb9, 0xee, 0x39, 0x22, 0x2e, 0x34, 0x6a, 0xd7, 0x9a, 0xb8, 0x2c,
-  0xdc, 0x03, 0xfc, 0x2e, 0x40, 0xf1, 0x7e, 0x38, 0x02, 0x72, 0x38, 0xcc,
-  0xa3, 0xa1, 0x7a, 0x2f, 0xb8, 0x24, 0x15, 0x23, 0x3f, 0x0c, 0x52, 0x5a,
-  0xd4, 0xd3, 0xcd, 0xf9, 0x05, 0x82, 0xd5, 0x97, 0x97, 0xbb, 0x10, 0x17,
-  0x7f, 0x7e, 0xb8, 0x52, 0x52, 0xe8, 0x69, 0x22, 0x1a, 0x3b, 0xbb, 0xd4,
-  0x08, 0x1f, 0x81, 0xc7, 0xd2, 0x2b, 0xbe, 0x75, 0x83, 0xa3, 0x40, 0x02,
-  0xad, 0xfc, 0xbc, 0x52, 0x52, 0x00, 0x76, 0xf4, 0x05, 0x5d, 0x9a, 0x0e,
-  0xdb, 0x8a, 0x94, 0x10, 0x88, 0xb7, 0x97, 0x03, 0xc6, 0x84, 0x76, 0x18,
-  0x4b, 0x4e, 0xb7, 0x2d, 0x7d, 0xdc, 0x5a, 0xd7, 0xed, 0x2c, 0x43, 0x8a,
-  0xca, 0x10, 0xe0, 0x48, 0x28, 0x05, 0x95, 0x33, 0xff, 0x1b, 0x20, 0xeb,
-  0x26, 0x83, 0xfb, 0x52, 0xa6, 0xf8, 0x21, 0x8d, 0x5c, 0xff, 0xf5, 0x44,
-  0x35, 0xcd, 0x88, 0xdb, 0x15, 0x8a, 0x87, 0x03, 0x5a, 0xed, 0xf4, 0x3f,
-  0xb4, 0xdc, 0x4b, 0xbb, 0x34, 0x7d, 0xef, 0x3b, 0x5f, 0x42, 0xc2, 0xed,
-  0xc6, 0x06, 0x60, 0x4d, 0x44, 0x36, 0x46, 0x61, 0x52, 0x2c, 0xc3, 0x96,
-  0x8d, 0x82, 0xb5, 0x84, 0x28, 0xe8, 0x09, 0x7b, 0x3a, 0xa8, 0xed, 0x5f,
-  0xc1, 0xfc, 0x43, 0x08, 0x28, 0xd8, 0xd0, 0x5a, 0x23, 0x77, 0xa8, 0x0c,
-  0xa5, 0x52, 0xea, 0xba, 0xcc, 0x2a, 0x9b, 0x6f, 0x78, 0x25, 0xdb, 0xbb,
-  0x2f, 0x0b, 0xe6, 0xaa, 0x2a, 0x6c, 0xa7, 0x3e, 0x24, 0x81, 0xef, 0x5d,
-  0x25, 0x30, 0x93, 0x29, 0x97, 0x01, 0x16, 0x2b, 0x3e, 0x47, 0x25, 0xa0,
-  0x70, 0x4f, 0x9f, 0x17, 0x88, 0x22, 0xb8, 0x6a, 0x15, 0x0d, 0xff, 0xaa,
-  0xfc, 0xb1, 0xdf, 0x54, 0xfa, 0x1e, 0xdb, 0x20, 0x8e, 0xd0, 0x1a, 0xc6,
-  0xee, 0x36, 0x14, 0xb8, 0x18, 0xe9, 0x1d, 0x45, 0xf7, 0xb8, 0x4f, 0x09,
-  0x4e, 0x3b, 0x0b, 0xe0, 0x07, 0x8e, 0x2b, 0x2e, 0x9c, 0x2b, 0xdc, 0x9f,
-  0xa3, 0x2b, 0xb3, 0x21, 0xaa, 0x7b, 0xdf, 0xc3, 0x16, 0xe5, 0xcb, 0x60,
-  0xbc, 0xdd, 0xd5, 0x1c, 0x04, 0x37, 0x06, 0xbb, 0x0e, 0x6e, 0xa6, 0xfa,
-  0x2b, 0x7c, 0x97, 0x23, 0x84, 0xea, 0xb6, 0x24, 0xbe, 0x87, 0x02, 0xdc,
-  0x1e, 0x09, 0x2c, 0xf2, 0x78, 0x4c, 0x02, 0x05, 0xbe, 0xb2, 0x98, 0x24,
-  0xbb, 0x11, 0xdc, 0x38, 0x0c, 0x2c, 0xf2, 0x5e, 0x17, 0x7d, 0xa0, 0x24,
-  0x32, 0x86, 0xf4, 0xbe, 0x21, 0x53, 0x30, 0xf5, 0xe8, 0xe4, 0x26, 0x53,
-  0xea, 0x74, 0x07, 0x76, 0x0d, 0x43, 0xbf, 0x7e, 0x1e, 0x2c, 0x50, 0xe8,
-  0x87, 0xfb, 0x76, 0x14, 0xf6, 0x59, 0x74, 0x13, 0xec, 0x38, 0x76, 0xfb,
-  0x0e, 0x32, 0x0a, 0x62, 0x21, 0x9c, 0x5b, 0xf8, 0x0b, 0x60, 0x42, 0x32,
-  0x7b, 0x0c, 0xa1, 0x91, 0xc8, 0x44, 0x73, 0x45, 0x65, 0x21, 0x2c, 0x91,
-  0x33, 0x91, 0x0b, 0x90, 0x20, 0x39, 0x38, 0x06, 0x5e, 0x48, 0xe4, 0x01,
-  0x39, 0x53, 0x07, 0xf0, 0xfa, 0x3c, 0x0c, 0x8e, 0xdd, 0x0a, 0x40, 0x72,
-  0xf5, 0x20, 0x72, 0x1b, 0x47, 0xbe, 0x74, 0x31, 0x04, 0x23, 0xae, 0xb4,
-  0x9d, 0xfa, 0x38, 0x0d, 0x3f, 0x13, 0x2b, 0x1f, 0x36, 0xa8, 0x80, 0x95,
-  0xeb, 0x04, 0xa1, 0x75, 0xc3, 0xab, 0x3d, 0xd8, 0x71, 0x7d, 0x05, 0xae,
-  0xbd, 0x09, 0xc1, 0x88, 0xc3, 0x18, 0x0d, 0xdd, 0xe0, 0x1a, 0x01, 0x38,
-  0xd1, 0x78, 0xb4, 0xed, 0x2c, 0x06, 0xe2, 0x86, 0x45, 0x0e, 0x40, 0x10,
-  0xf0, 0xf7, 0xea, 0x1e, 0x40, 0x00, 0x1b, 0x10, 0xbb, 0x2b, 0x0b, 0x69,
-  0x5e, 0x23, 0xf4, 0x90, 0x21, 0x9c, 0x13, 0x23, 0x6c, 0xac, 0xc6, 0x73,
-  0xdc, 0xe8, 0x2f, 0x4f, 0x20, 0x27, 0x75, 0x92, 0x25, 0x1c, 0x18, 0xfa,
-  0x9a, 0x8e, 0xef, 0xb5, 0xba, 0x90, 0xd9, 0x2a, 0xff, 0x09, 0x3d, 0x51,
-  0xff, 0xe9, 0x53, 0x19, 0x7a, 0x0b, 0x7c, 0x17, 0x0b, 0x31, 0xba, 0x08,
-  0x74, 0x10, 0x0b, 0x2d, 0x7b, 0x0c, 0xb8, 0x8a, 0x34, 0xb1, 0xe3, 0xf9,
-  0x0d, 0x78, 0xa0, 0x41, 0x63, 0x48, 0x14, 0x6e, 0x1a, 0x75, 0x2a, 0x94,
-  0x20, 0x01, 0xb6, 0x55, 0x8f, 0x1a, 0xe8, 0x4b, 0xeb, 0xdf, 0xb6, 0x92,
-  0x2c, 0xeb, 0xdc, 0x63, 0xf7, 0xbc, 0x7b, 0x26, 0x19, 0x7d, 0x75, 0x1d,
-  0xb8, 0x94, 0xd2, 0x34, 0xae, 0x20, 0xd1, 0x70, 0x6f, 0x09, 0xde, 0x88,
-  0x04, 0xbc, 0x43, 0x06, 0x1d, 0x86, 0xe9, 0xaa, 0x5a, 0x95, 0x93, 0x2b,
-  0x44, 0xda, 0xbf, 0xfe, 0xdf, 0xcb, 0xba, 0xb5, 0xb4, 0xff, 0xb3, 0xb2,
-  0xb1, 0xb0, 0xaf, 0xa9, 0x7f, 0x3f, 0xff, 0x31, 0x30, 0x1f, 0x10, 0x0f,
-  0x0e, 0x0d, 0x0c, 0xff, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
-  0xdb, 0x03, 0x02, 0xdb, 0x4b, 0xff, 0x4f, 0xf8, 0x4e, 0x05, 0x4f, 0x0a,
-  0x4f, 0x0f, 0xfa, 0x4f, 0x14, 0x4f, 0x19, 0x4f, 0x17, 0x7b, 0x23, 0x4f,
-  0xff, 0x28, 0x4f, 0x2d, 0x4f, 0x32, 0x4f, 0x37, 0x4f, 0xff, 0x3c, 0x4f,
-  0x41, 0x4f, 0x46, 0x4f, 0x50, 0x4f, 0xff, 0x55, 0x4f, 0x5a, 0x4f, 0x5f,
-  0x4f, 0x64, 0x4f, 0xff, 0x69, 0x4f, 0x6e, 0x4f, 0x73, 0x4f, 0x78, 0x4f,
-  0xff, 0x7e, 0x4f, 0x84, 0x4f, 0x8a, 0x4f, 0x90, 0x4f, 0xff, 0x96, 0x4f,
-  0x9c, 0x4f, 0xa2, 0x4f, 0xa8, 0x4f, 0xff, 0xae, 0x4f, 0xb4, 0x4f, 0xdd,
-  0x4f, 0xe3, 0x4f, 0x0b, 0x0e, 0xed, 0xfd, 0x4f, 0xf2, 0x4f, 0xf7, 0x4f,
-  0xfc, 0x1b, 0x48, 0x50, 0xff, 0x06, 0x50, 0x0b, 0x50, 0x10, 0x50, 0x15,
-  0x50, 0xfd, 0x1a, 0x50, 0x1f, 0x50, 0x24, 0x50, 0x4b, 0xf3, 0x2e, 0xff,
-  0x50, 0x33, 0x50, 0x38, 0x50, 0x5f, 0x50, 0x64, 0x84, 0x50, 0x6c, 0x75,
-  0x7d, 0x1d, 0x88, 0xbb, 0x2a, 0x6d, 0x01, 0x88, 0xf2, 0x68, 0x1c, 0x55,
-  0xa1, 0xe0, 0x5a, 0xde, 0x85, 0xda, 0x30, 0xdb, 0x08, 0x54, 0x0b, 0xd6,
-  0x55, 0xc5, 0xec, 0x85, 0x72, 0xc2, 0xcc, 0x2c, 0x4c, 0xcd, 0xd0, 0xcb,
-  0x99, 0xf8, 0xc0, 0x17, 0x37, 0x2b, 0x86, 0x01, 0xee, 0x52, 0xb8, 0xf8,
-  0x12, 0x9f, 0xb8, 0xb8, 0x13, 0xba, 0x2d, 0xff, 0xf8, 0x1e, 0x0d, 0xd2,
-  0x8e, 0xb9, 0xba, 0x1e, 0x0d, 0xa0, 0x71, 0x57, 0xbf, 0x36, 0x0e, 0x24,
-  0x69, 0x91, 0x39, 0x02, 0xa6, 0x31, 0x93, 0x82, 0x9a, 0x04, 0x43, 0x69,
-  0x73, 0x39, 0x08, 0xa6, 0x55, 0x93, 0x64, 0x9a, 0x10, 0x63, 0x69, 0x55,
-  0x39, 0x20, 0xa6, 0x79, 0x93, 0x46, 0x9a, 0x40, 0x8c, 0x69, 0x37, 0x39,
-  0x80, 0xa6, 0xa3, 0x9f, 0x28, 0xb8, 0xba, 0x74, 0x09, 0x1e, 0xe1, 0xef,
-  0x71, 0x48, 0x3d, 0x4b, 0xbe, 0x6a, 0xc5, 0x8c, 0xc9, 0xbf, 0xde, 0xb9,
-  0x23, 0x00, 0xbf, 0x63, 0xfe, 0x4d, 0xf2, 0xae, 0xd1, 0xe1, 0x89, 0xcf,
-  0x0d, 0x57, 0xfb, 0x85, 0x85, 0x4d, 0xff, 0xe0, 0xd9, 0x5d, 0x28, 0xf5,
-  0x8a, 0xf7, 0xe1, 0xe5, 0x2f, 0x48, 0xb8, 0xea, 0x2d, 0xc6, 0xeb, 0xf1,
-  0x63, 0xc0, 0x2e, 0xa1, 0xfd, 0xdd, 0x5b, 0x04, 0xe7, 0xcb, 0xb8, 0x34,
-  0xe2, 0xcb, 0xb8, 0x4a, 0xdd, 0xcb, 0xb8, 0x59, 0xd8, 0xcb, 0xb8, 0x6f,
-  0xd3, 0xcb, 0xb8, 0x7b, 0xce, 0xcb, 0xb8, 0x94, 0xc9, 0xcb, 0xb8, 0xab,
-  0xc4, 0xcb, 0xb8, 0xc1, 0xbf, 0xcb, 0xb8, 0xe1, 0xba, 0xfe, 0xb8, 0x00,
-  0x2f, 0xeb, 0xb5, 0xb8, 0x1c, 0x5f, 0xb0, 0xb8, 0xf1, 0x30, 0xff, 0xeb,
-  0xab, 0xb8, 0x44, 0x2f, 0xeb, 0xa6, 0xb8, 0x97, 0x5f, 0xa1, 0xb8, 0x97,
-  0x7f, 0x9c, 0xb8, 0x97, 0x92, 0x97, 0xb8, 0x97, 0xa4, 0x92, 0xb8, 0x97,
-  0xbc, 0x8d, 0xb8, 0x97, 0xc8, 0x88, 0xb8, 0x96, 0xe2, 0x83, 0xa5, 0x01,
-  0xe2, 0x2f, 0xe9, 0x7d, 0x5f, 0x4e, 0x1a, 0x30, 0xe9, 0x77, 0x6c, 0x05,
-  0x31, 0xb2, 0x71, 0xcb, 0x46, 0x6b, 0x2c, 0x54, 0xb2, 0x65, 0xcb, 0x6f,
-  0x5f, 0x2c, 0x7c, 0xb2, 0x59, 0xcb, 0x95, 0x53, 0x2c, 0xac, 0xb2, 0x4d,
-  0xcb, 0xc1, 0x47, 0x2c, 0xdb, 0xb4, 0x41, 0x42, 0x92, 0xed, 0x06, 0x31,
-  0xc2, 0x9a, 0x32, 0x04, 0xc6, 0xf5, 0x28, 0xf1, 0xcc, 0xbd, 0xd4, 0x14,
-  0x77, 0x69, 0x0b, 0x40, 0xd1, 0xfc, 0xe6, 0x2e, 0xff, 0xa4, 0xcb, 0x4d,
-  0x2f, 0x80, 0x31, 0xe9, 0x5d, 0x4a, 0xd8, 0x37, 0x73, 0xeb, 0x58, 0xdb,
-  0xb8, 0x57, 0x04, 0x53, 0xcb, 0xb8, 0x67, 0x4e, 0xcb, 0xb8, 0x77, 0x49,
-  0xcb, 0xb8, 0x8c, 0x44, 0xcb, 0xb8, 0xa9, 0x3f, 0xcb, 0xb8, 0xb4, 0x3a,
-  0xcb, 0xb8, 0xc7, 0x35, 0xcb, 0xb8, 0xd8, 0x30, 0xcb, 0xb8, 0xed, 0x2b,
-  0xcb, 0xb8, 0xf9, 0x26, 0xfe, 0xb8, 0x04, 0x32, 0xeb, 0x21, 0xb8, 0x14,
-  0x5e, 0x1c, 0xb8, 0x26, 0x5f, 0x17, 0xb8, 0x35, 0x32, 0x04, 0x2e, 0xfd,
-  0x49, 0x32, 0x5c, 0x59, 0x32, 0xb9, 0x71, 0x32, 0x5a, 0xf1, 0x17, 0x6d,
-  0xb0, 0xf6, 0x3f, 0xda, 0xb8, 0x9b, 0xb6, 0x32, 0x0b, 0xa4, 0x7e, 0x80,
-  0xca, 0x80, 0x8f, 0x3d, 0xff, 0x91, 0x06, 0xe9, 0xba, 0xf9, 0xb8, 0x84,
-  0x32, 0x4d, 0x32, 0x91, 0x6c, 0x04, 0xd7, 0x01, 0x36, 0x23, 0x0a, 0x1b,
-  0x35, 0x71, 0x1d, 0x34, 0x4c, 0xa0, 0x52, 0x3e, 0x51, 0x4a, 0x23, 0x23,
-  0x84, 0x61, 0x7f, 0xdd, 0xb2, 0x3e, 0x65, 0x3d, 0xa1, 0x00, 0xaa, 0xba,
-  0x07, 0x12, 0xa0, 0x3e, 0x16, 0xc2, 0x40, 0x25, 0x13, 0xf4, 0xd1, 0x1b,
-  0xa3, 0x42, 0x02, 0xf0, 0xfb, 0x44, 0x52, 0xa1, 0x46, 0x18, 0xa4, 0x48,
-  0xbd, 0x3d, 0x1c, 0x40, 0x82, 0x1a, 0xcf, 0x43, 0x0d, 0xa1, 0xbb, 0x32,
-  0x20, 0x34, 0x52, 0x00, 0xcd, 0x5f, 0xaa, 0x66, 0x0c, 0xe9, 0x2d, 0x4a,
-  0xa5, 0x4c, 0xf8, 0x0f, 0x1c, 0xe8, 0x4b, 0xf8, 0xa9, 0x46, 0x06, 0xdf,
-  0xfb, 0xbc, 0xe6, 0x71, 0x7d, 0x75, 0x11, 0xf6, 0x06, 0xa8, 0x27, 0x26,
-  0x6a, 0xbe, 0xec, 0xd3, 0xee, 0xf9, 0x16, 0xf0, 0x59, 0x26, 0xf1, 0x07,
-  0xa0, 0x61, 0x33, 0x27, 0x11, 0x96, 0xc7, 0xc4, 0x50, 0xcd, 0x9c, 0x03,
-  0xbb, 0xf1, 0xa2, 0xc2, 0xf5, 0x04, 0xbf, 0x37, 0xa1, 0x38, 0x52, 0x0b,
-  0x06, 0xa2, 0x36, 0x3a, 0xa4, 0x5e, 0xc3, 0x7a, 0x9a, 0x36, 0x38, 0x43,
-  0x66, 0x0c, 0xc9, 0x7a, 0xf9, 0x94, 0x1b, 0xe8, 0xd0, 0xf7, 0x00, 0xe4,
-  0x36, 0x23, 0x93, 0x0a, 0x0b, 0x41, 0x87, 0xb2, 0x00, 0x7d, 0x72, 0x1c,
-  0x33, 0xc8, 0x44, 0xb3, 0xd9, 0xba, 0x2b, 0xfc, 0x1b, 0x49, 0xb1, 0x06,
-  0x7a, 0xb2, 0x0b, 0x73, 0x65, 0x20, 0x92, 0x5c, 0xbb, 0x15, 0x3b, 0x9f,
-  0x37, 0xa8, 0x60, 0xf2, 0x47, 0x38, 0x76, 0x74, 0xcf, 0xf4, 0x66, 0xe7,
-  0x18, 0x4d, 0x9c, 0x9b, 0xe7, 0x0c, 0x36, 0xe7, 0x5f, 0xac, 0x1a, 0xe8,
-  0xc8, 0xe8, 0xf6, 0x06, 0xd6, 0x27, 0x6f, 0x04, 0x73, 0x62, 0x4e, 0x5f,
-  0x04, 0x66, 0x6e, 0x55, 0x79, 0x90, 0x02, 0xe6, 0x3e, 0x90, 0x40, 0xd9,
-  0x0c, 0xb2, 0x79, 0x65, 0x32, 0x90, 0x6e, 0x26, 0x3e, 0x40, 0xa6, 0x91,
-  0x1b, 0x5e, 0xe5, 0xf3, 0x3c, 0x42, 0xd6, 0x44, 0x53, 0xd9, 0x1d, 0x50,
-  0x3b, 0xb7, 0x33, 0x39, 0x36, 0x27, 0x33, 0xba, 0x68, 0xbd, 0xf3, 0x1a,
-  0x86, 0x48, 0x3a, 0x04, 0x46, 0x78, 0x28, 0xcd, 0x99, 0xb9, 0x32, 0xea,
-  0xf5, 0x02, 0x66, 0xdc, 0x9f, 0x8a, 0xff, 0x36, 0x88, 0x4e, 0x34, 0xcf,
-  0x01, 0xbb, 0x24, 0x0a, 0x34, 0x11, 0x67, 0x78, 0xe2, 0xe9, 0xc1, 0xf8,
-  0x7d, 0x39, 0xf1, 0x17, 0xb3, 0x13, 0x2f, 0x68, 0x64, 0xf3, 0x9a, 0x07,
-  0x02, 0x7d, 0x51, 0x03, 0x5c, 0x83, 0xe9, 0x1b, 0xd5, 0x84, 0xd9, 0x08,
-  0xeb, 0x1a, 0xbb, 0x3b, 0xb8, 0x70, 0x25, 0xa7, 0x3e, 0x12, 0x02, 0x03,
-  0x4c, 0x89, 0x19, 0xcf, 0xf2, 0x1b, 0x75, 0xdd, 0xa8, 0x43, 0x20, 0x23,
-  0x0d, 0x50, 0x7d, 0xfa, 0x0d, 0x01, 0xae, 0x2c, 0x12, 0x9c, 0x0d, 0x03,
-  0xb8, 0x21, 0xce, 0xb0, 0x86, 0x17, 0x0d, 0xd4, 0xb8, 0xb4, 0xc6, 0x16,
-  0x0a, 0x02, 0xeb, 0x03, 0xd3, 0x89, 0xb3, 0xee, 0xf2, 0x6e, 0xb8, 0xeb,
-  0x09, 0x9b, 0xe4, 0x02, 0xb8, 0xcb, 0x22, 0x35, 0xda, 0x38, 0x29, 0x1d,
-  0x5b, 0xca, 0x65, 0x9a, 0x35, 0xab, 0xeb, 0x12, 0xc7, 0x1c, 0x1b, 0xed,
-  0x09, 0xa4, 0xbd, 0x72, 0x27, 0x36, 0xc8, 0xb3, 0xcd, 0x6e, 0xa9, 0x23,
-  0xa4, 0x34, 0x9f, 0x8c, 0xf4, 0xd2, 0x95, 0x39, 0x3e, 0x37, 0x64, 0x8b,
-  0x66, 0x87, 0x91, 0x81, 0x9a, 0xd7, 0x77, 0x47, 0x16, 0x38, 0x2c, 0x6d,
-  0x8c, 0x65, 0xd2, 0x63, 0x33, 0xb5, 0x48, 0x59, 0xe5, 0x06, 0x39, 0x91,
-  0x4f, 0x9a, 0x48, 0x45, 0x46, 0x86, 0x6b, 0x3b, 0x9e, 0x3b, 0x75, 0xd5,
-  0x91, 0xc8, 0x4d, 0xad, 0x84, 0x78, 0x0f, 0xdf, 0xa9, 0xfe, 0xba, 0xc5,
-  0x39, 0x6c, 0x0c, 0x1e, 0xe2, 0x5b, 0xf2, 0x3a, 0x09, 0x64, 0x14, 0x66,
-  0x45, 0x91, 0x0a, 0x9a, 0x8c, 0x00, 0x46, 0xd5, 0x6c, 0xf6, 0xf1, 0xf9,
-  0x18, 0x3b, 0x64, 0xec, 0x66, 0x5e, 0x91, 0xe2, 0x9b, 0x8b, 0xd8, 0xf1,
-  0x7e, 0x6c, 0xce, 0x3b, 0x5b, 0xce, 0x27, 0x39, 0x3c, 0x6c, 0xc4, 0x09,
-  0x66, 0x66, 0x91, 0xba, 0x9a, 0xa3, 0xb0, 0x46, 0xeb, 0x69, 0xa6, 0x1c,
-  0x12, 0x3d, 0xb2, 0x9c, 0x33, 0x44, 0x48, 0x92, 0xcd, 0x88, 0x88, 0x23,
-  0xc9, 0x34, 0x7e, 0x8e, 0x13, 0x3e, 0x59, 0x74, 0x19, 0x5a, 0xa4, 0x6a,
-  0x5f, 0xca, 0x60, 0x9e, 0xf1, 0x04, 0x5b, 0xa3, 0x16, 0xa4, 0x53, 0x6e,
-  0xee, 0x09, 0x91, 0x49, 0xcb, 0x35, 0x3f, 0x3f, 0x23, 0x7d, 0x34, 0x35,
-  0x8c, 0xc6, 0xd2, 0x2b, 0x39, 0x0f, 0x40, 0x64, 0x21, 0x66, 0x52, 0x91,
-  0x17, 0x9a, 0x9b, 0x0d, 0x46, 0xdc, 0x69, 0x03, 0x1c, 0x21, 0x41, 0xb9,
-  0xf9, 0xf0, 0xe6, 0x6b, 0x91, 0xef, 0x9a, 0xb6, 0xe5, 0x46, 0xfe, 0x69,
-  0xdb, 0x1c, 0x44, 0x42, 0xb2, 0xd1, 0x33, 0x8e, 0x48, 0xc7, 0xcd, 0xdb,
-  0xbd, 0x23, 0x1d, 0x96, 0x43, 0xb3, 0x46, 0x64, 0x69, 0xa9, 0x19, 0xa7,
-  0xb1, 0x9f, 0xf0, 0x97, 0x6d, 0x18, 0x8b, 0x15, 0x64, 0x54, 0x08, 0xbc,
-  0x34, 0x07, 0xde, 0x0a, 0xef, 0x43, 0xeb, 0x16, 0x3f, 0xcd, 0x1d, 0x18,
-  0x33, 0x10, 0x79, 0x53, 0xb8, 0xf6, 0x6e, 0x05, 0x06, 0xc6, 0x0e, 0x44,
-  0x86, 0xe6, 0x67, 0xf0, 0x47, 0x09, 0xcb, 0x08, 0xe0, 0xdd, 0x14, 0x58,
-  0x2d, 0x26, 0x74, 0x15, 0x51, 0xfa, 0xba, 0x0e, 0x7e, 0x12, 0xe9, 0x3e,
-  0x00, 0x9f, 0x10, 0xc4, 0x14, 0x46, 0x24, 0xf0, 0xbb, 0x00, 0x2a, 0x0b,
-  0x31, 0xda, 0x8b, 0x8d, 0x04, 0x6c, 0x15, 0x0a, 0x1f, 0x63, 0xe8, 0x2c,
-  0x15, 0x43, 0x6c, 0x3e, 0x20, 0xa3, 0x46, 0x02, 0x7f, 0xb9, 0xe8, 0x16,
-  0x15, 0x60, 0x0a, 0xc4, 0xb7, 0xac, 0xce, 0x5a, 0x77, 0x85, 0x14, 0x92,
-  0xa2, 0xe8, 0x87, 0x05, 0x8b, 0xdf, 0x40, 0xa0, 0x6a, 0x96, 0xc5, 0x28,
-  0x09, 0xca, 0xaa, 0x23, 0xbd, 0x4c, 0xc9, 0x15, 0x51, 0xb0, 0x82, 0x1b,
-  0x0d, 0x37, 0x0b, 0xeb, 0x52, 0xba, 0x4a, 0x08, 0xb1, 0xcf, 0xef, 0x32,
-  0x62, 0xbb, 0x00, 0x6d, 0x1b, 0x56, 0x97, 0x0e, 0x43, 0x14, 0x46, 0xc3,
-  0x00, 0x11, 0x8b, 0x54, 0x6e, 0xa4, 0x26, 0x4f, 0x86, 0x39, 0x70, 0xd0,
-  0x89, 0xbb, 0x3a, 0x2c, 0x39, 0x33, 0x2e, 0x37, 0x57, 0x44, 0x6b, 0x58,
-  0xc1, 0x76, 0x74, 0x0f, 0x4b, 0xeb, 0x01, 0x7e, 0x84, 0x73, 0x68, 0x44,
-  0x5f, 0x74, 0x14, 0x79, 0xb6, 0x44, 0xda, 0x80, 0x6c, 0x76, 0xef, 0xce,
-  0x2b, 0x6e, 0x16, 0x4a, 0x08, 0x06, 0xeb, 0x6f, 0x39, 0xb8, 0x6a, 0x08,
-  0x00, 0x0a, 0xa5, 0xa8, 0x45, 0xca, 0x1d, 0x5d, 0x0c, 0x58, 0x4d, 0x29,
-  0xea, 0x7b, 0x67, 0x63, 0x48, 0x04, 0x6a, 0x65, 0xd4, 0xec, 0x56, 0x1e,
-  0x0b, 0x51, 0x3a, 0x04, 0x83, 0x1e, 0xea, 0xa3, 0xa4, 0xd5, 0xd6, 0x0b,
-  0x7d, 0x40, 0x15, 0x80, 0xd7, 0x2d, 0x40, 0x3d, 0x5f, 0x07, 0x36, 0x77,
-  0xda, 0xeb, 0x0e, 0xa5, 0xec, 0x3d, 0x77, 0x07, 0x06, 0x76, 0x34, 0xa3,
-  0x52, 0xec, 0x37, 0x56, 0x75, 0x01, 0x39, 0x9a, 0x31, 0x85, 0xd2, 0xae,
-  0x0f, 0x36, 0xbb, 0xa0, 0x8c, 0xe9, 0xee, 0x5f, 0x7a, 0x1d, 0x23, 0xd6,
-  0x80, 0xfe, 0xfb, 0xbf, 0x30, 0x52, 0x3d, 0xed, 0x14, 0xad, 0x42, 0x7b,
-  0x81, 0xfd, 0x82, 0x7b, 0x51, 0xb8, 0xbb, 0x28, 0xb4, 0xc0, 0xee, 0x03,
-  0xf5, 0x5b, 0x14, 0x0c, 0xe1, 0x34, 0xb3, 0xfb, 0xba, 0x19, 0x35, 0x1f,
-  0xa0, 0xfe, 0xa1, 0x9d, 0x15, 0x7f, 0xd6, 0x13, 0x39, 0xc3, 0x6b, 0xf4,
-  0xc5, 0x0c, 0x50, 0xb9, 0x93, 0x4b, 0x08, 0x7b, 0x62, 0xb8, 0x6b, 0xdc,
-  0xd8, 0xd4, 0x5a, 0xa9, 0x81, 0x6a, 0x65, 0x66, 0x91, 0xbd, 0x4e, 0x82,
-  0x14, 0xce, 0x9f, 0x35, 0x69, 0x31, 0xd8, 0x87, 0x1d, 0x65, 0x15, 0x9d,
-  0xe8, 0x18, 0x9c, 0x8e, 0x06, 0xbe, 0x18, 0x45, 0xeb, 0x04, 0xdc, 0x87,
-  0x3e, 0x45, 0xb3, 0x2b, 0x87, 0x76, 0x56, 0x29, 0x62, 0x0b, 0x44, 0x61,
-  0x06, 0x94, 0x55, 0x9c, 0x98, 0x20, 0xb8, 0x92, 0x12, 0x8c, 0x85, 0x1c,
-  0x02, 0x50, 0x46, 0x86, 0xf1, 0xd6, 0x31, 0xff, 0x1a, 0x7b, 0x01, 0xd8,
-  0x10, 0x17, 0xf8, 0x86, 0xba, 0xf8, 0x02, 0xf7, 0xde, 0x85, 0xf6, 0xa9,
-  0xa3, 0x6e, 0x74, 0x4c, 0xc5, 0xde, 0xed, 0x63, 0xa2, 0xe9, 0xf0, 0x55,
-  0x01, 0xeb, 0x6c, 0x68, 0x63, 0x28, 0x76, 0x7e, 0x37, 0x86, 0x7b, 0x68,
-  0xa9, 0x2d, 0x02, 0xfe, 0x8b, 0x4e, 0xf8, 0x89, 0xf2, 0xe8, 0xcc, 0xa5,
-  0xf0, 0x8a, 0x2a, 0x51, 0x87, 0x5b, 0xe9, 0x75, 0xa0, 0x09, 0x3b, 0x80,
-  0x1e, 0x20, 0xe0, 0x4f, 0xeb, 0x07, 0xa1, 0x36, 0x3d, 0x53, 0x50, 0x85,
-  0x2b, 0xc4, 0x20, 0x56, 0xf9, 0xfe, 0x81, 0xfb, 0x07, 0x02, 0x75, 0x37,
-  0x0d, 0x90, 0x6f, 0x18, 0x80, 0x75, 0x30, 0xbf, 0x81, 0x06, 0x00, 0x47,
-  0x40, 0x83, 0xef, 0x86, 0x74, 0x73, 0x6a, 0xea, 0x91, 0xa4, 0xb0, 0xa8,
-  0x57, 0x6d, 0x85, 0x7a, 0x95, 0x1e, 0xd7, 0x57, 0x83, 0xd8, 0x7e, 0x12,
-  0x83, 0xff, 0x03, 0x7d, 0x0d, 0xc1, 0x32, 0x42, 0x4c, 0xdb, 0x88, 0xf9,
-  0xcb, 0x76, 0x15, 0x46, 0xa1, 0xde, 0x48, 0x25, 0x7f, 0x00, 0xa9, 0x4f,
-  0x74, 0x7d, 0x0e, 0x12, 0x3e, 0xc0, 0x26, 0x1d, 0xa3, 0xf8, 0xe1, 0x0b,
-  0x46, 0xfa, 0xe0, 0x5b, 0x0d, 0xfe, 0x0b, 0x46, 0x29, 0x67, 0x2e, 0x49,
-  0x78, 0x1a, 0x3b, 0x94, 0x8a, 0x45, 0x35, 0x90, 0xb1, 0x6c, 0x53, 0x5f,
-  0x37, 0xfa, 0x46, 0x58, 0xbb, 0x77, 0xf2, 0xec, 0x51, 0xd6, 0xf3, 0x61,
-  0x98, 0x21, 0x3d, 0xb1, 0x2a, 0x00, 0x34, 0x12, 0x3a, 0xae, 0x57, 0x04,
-  0x5c, 0x37, 0x0a, 0x18, 0x61, 0x26, 0xaf, 0x17, 0xc5, 0xc1, 0x45, 0x35,
-  0x2e, 0x1a, 0x29, 0xd9, 0x3f, 0x56, 0x36, 0x55, 0x42, 0xad, 0x27, 0x74,
-  0x4e, 0xa3, 0xd4, 0x10, 0x70, 0x0c, 0x05, 0xaa, 0xed, 0x99, 0xf3, 0xeb,
-  0xda, 0x9b, 0xbf, 0x8f, 0xec, 0x06, 0xae, 0x30, 0xa0, 0xbb, 0xc8, 0x80,
-  0x26, 0x56, 0x69, 0x7f, 0x49, 0x45, 0x27, 0x85, 0x0e, 0x46, 0x10, 0xe7,
-  0xf9, 0x10, 0x19, 0x10, 0xee, 0xba, 0x48, 0x7b, 0xa5, 0xba, 0xa0, 0xc6,
-  0x88, 0xd1, 0x3a, 0x63, 0xeb, 0x0f, 0x88, 0x16, 0x05, 0x48, 0x14, 0xd5,
-  0x67, 0x5d, 0xcc, 0x8a, 0x91, 0x63, 0x6c, 0x07, 0x00, 0x42, 0x52, 0x1e,
-  0x65, 0x13, 0x02, 0x31, 0xa1, 0xa5, 0xc3, 0xe5, 0x19, 0x3d, 0xc7, 0x3d,
-  0x84, 0x22, 0x16, 0x2a, 0x16, 0x9e, 0xe1, 0x11, 0x51, 0x01, 0xea, 0x1f,
-  0xfd, 0xb9, 0xee, 0xfd, 0x75, 0x69, 0xff, 0xd8, 0x91, 0xfd, 0xeb, 0x9e,
-  0x7a, 0xdf, 0xdf, 0x0e, 0x50, 0xb8, 0x36, 0x46, 0x2c, 0xee, 0xf8, 0xba,
-  0x1a, 0xc7, 0xc4, 0xdb, 0xfb, 0xe2, 0xa0, 0x8b, 0x63, 0x17, 0x42, 0x56,
-  0xa2, 0x6b, 0x62, 0x87, 0x3d, 0xfe, 0x06, 0xac, 0x10, 0x8b, 0x99, 0x0e,
-  0x39, 0x47, 0x2d, 0x93, 0x86, 0xde, 0x91, 0x12, 0x67, 0x82, 0x17, 0x6b,
-  0x8b, 0x5c, 0xa6, 0x68, 0x91, 0x91, 0x91, 0x1b, 0xd8, 0x7e, 0xfb, 0x8a,
-  0x63, 0xbf, 0x77, 0xb8, 0x9d, 0x1c, 0x6a, 0x74, 0xeb, 0xfc, 0x80, 0x56,
-  0xfd, 0x57, 0x3b, 0xf1, 0xec, 0x0f, 0x58, 0x8f, 0xa3, 0x22, 0x89, 0x5e,
-  0xfd, 0xec, 0x89, 0x4e, 0xee, 0x89, 0x56, 0x56, 0xa1, 0xdb, 0x04, 0x05,
-  0xf2, 0x2c, 0x06, 0xbe, 0xf4, 0x8c, 0xd9, 0x8d, 0xdc, 0x16, 0x81, 0x66,
-  0x6c, 0x17, 0x80, 0x2e, 0x77, 0x08, 0x25, 0xb5, 0x6e, 0xa1, 0x60, 0x2d,
-  0x81, 0x0b, 0xe4, 0xe2, 0x6b, 0x10, 0x14, 0x71, 0xfe, 0x09, 0x5a, 0x93,
-  0xde, 0x02, 0x30, 0xf6, 0x80, 0xd4, 0x0e, 0x5a, 0xd8, 0x2a, 0x5d, 0x58,
-  0x05, 0x73, 0xb2, 0x45, 0xe0, 0xdb, 0xfc, 0x0a, 0xe2, 0x1a, 0xc8, 0xaa,
-  0x6b, 0xbc, 0xe4, 0x3e, 0x7e, 0xf6, 0x8d, 0x56, 0xde, 0x8d, 0xdd, 0x1a,
-  0xe8, 0x34, 0x06, 0x71, 0xc1, 0xea, 0x32, 0x7a, 0xae, 0xd1, 0x0b, 0x8b,
-  0xc2, 0x02, 0x32, 0xb6, 0x7f, 0x2e, 0x59, 0x6c, 0x51, 0x60, 0x26, 0xe9,
-  0x8b, 0x76, 0xa6, 0x63, 0xfa, 0x38, 0x40, 0xbf, 0x27, 0xcf, 0x09, 0xdf,
-  0x75, 0x4d, 0xff, 0x88, 0xc4, 0x80, 0xe4, 0x7f, 0x80, 0xfc, 0x02, 0xc3,
-  0x73, 0x43, 0xf9, 0x4b, 0x0a, 0x08, 0xda, 0x88, 0xe0, 0xe7, 0x02, 0xe5,
-  0xed, 0xa8, 0x0b, 0xb6, 0x1e, 0xe0, 0x08, 0x4e, 0xea, 0x8a, 0xd1, 0x09,
-  0x4a, 0x47, 0x09, 0x7e, 0xee, 0xbd, 0xda, 0xd3, 0x99, 0xea, 0x91, 0x3b,
-  0x13, 0x3c, 0x04, 0xf8, 0x72, 0x0e, 0x76, 0x29, 0x3c, 0xdf, 0x5c, 0x1b,
-  0x3c, 0x0c, 0x74, 0xc0, 0x1c, 0xeb, 0x53, 0x98, 0x0d, 0xe2, 0xb7, 0x09,
-  0x29, 0x75, 0x1a, 0x2e, 0xe9, 0x78, 0x16, 0x16, 0x00, 0x17, 0x0c, 0x72,
-  0x00, 0x40, 0x37, 0xe6, 0x6d, 0xb8, 0x07, 0x6f, 0x04, 0x68, 0xb8, 0x0b,
-  0x2c, 0x63, 0x0a, 0xa6, 0xb6, 0x31, 0x5e, 0xd9, 0xbf, 0xee, 0x6c, 0xf0,
-  0xff, 0x66, 0x08, 0x6c, 0x05, 0x0a, 0x52, 0xe0, 0xb7, 0xc7, 0xe0, 0x8d,
-  0x45, 0xd1, 0xae, 0xe2, 0x4a, 0xda, 0x8b, 0x9e, 0x55, 0x2c, 0x70, 0xfe,
-  0x68, 0xf4, 0xa3, 0xc2, 0x42, 0x10, 0xe9, 0x10, 0x8d, 0x6b, 0x5b, 0xe2,
-  0xe0, 0x2b, 0xf5, 0x62, 0xf0, 0x5a, 0x93, 0x10, 0xdf, 0xa0, 0x56, 0xb8,
-  0xc4, 0x46, 0x2e, 0x12, 0xea, 0x79, 0x1c, 0x1d, 0xff, 0xf9, 0xb2, 0xf7,
-  0xec, 0x71, 0xe0, 0x8b, 0x83, 0xf9, 0xd7, 0x1f, 0xe4, 0x72, 0x0e, 0x38,
-  0x18, 0xa5, 0x93, 0xc1, 0x8b, 0x7e, 0xbf, 0x13, 0xf6, 0x3c, 0x01, 0x77,
-  0x04, 0xa7, 0xa8, 0x11, 0x77, 0x8a, 0xd3, 0x09, 0xcb, 0xc3, 0x75, 0xf7,
-  0x0f, 0xc2, 0xf2, 0x7a, 0xe8, 0x0c, 0x26, 0x1b, 0x63, 0xe8, 0x01, 0xa5,
-  0x03, 0x0c, 0x7e, 0x06, 0x02, 0x8b, 0x83, 0x3e, 0xaa, 0xea, 0x3c, 0xef,
-  0x53, 0x5e, 0x36, 0x9b, 0x30, 0x1a, 0x6b, 0xef, 0x22, 0x56, 0xa7, 0xdd,
-  0x8a, 0xdc, 0x92, 0x8d, 0x4e, 0xb4, 0xe8, 0x06, 0x83, 0x80, 0x86, 0x6a,
-  0xc1, 0x1b, 0x10, 0x57, 0xe1, 0x43, 0x74, 0x28, 0x49, 0xe9, 0xa1, 0x86,
-  0x78, 0x46, 0x3d, 0x06, 0x05, 0x0a, 0xb5, 0x4e, 0x4b, 0x6e, 0x86, 0xe9,
-  0x6c, 0xee, 0xcb, 0x03, 0x7c, 0x9d, 0x37, 0x49, 0xe9, 0x62, 0xb6, 0xff,
-  0x95, 0x12, 0x5e, 0xdc, 0x0d, 0x58, 0x2b, 0x5b, 0x1a, 0x50, 0x03, 0x1f,
-  0x60, 0xd9, 0x6f, 0xe3, 0xda, 0xbb, 0xa1, 0x2c, 0x89, 0x4f, 0x37, 0xc1,
-  0xc2, 0x7a, 0xad, 0xae, 0x83, 0x69, 0x78, 0x67, 0x28, 0xa2, 0xff, 0x96,
-  0x7c, 0xa1, 0xdb, 0x02, 0x3b, 0x7e, 0x7a, 0x7d, 0x23, 0x89, 0x0d, 0x21,
-  0xff, 0x01, 0xf7, 0x8b, 0x3d, 0x80, 0x3d, 0x2f, 0x74, 0xe8, 0x06, 0x80,
-  0x7d, 0xa5, 0x79, 0xdc, 0x10, 0x8b, 0x25, 0xcd, 0x14, 0xc8, 0x0f, 0x99,
-  0xca, 0x76, 0xd8, 0xcb, 0x00, 0x2d, 0x0d, 0xaa, 0x46, 0x5d, 0xc0, 0x87,
-  0x13, 0x6b, 0x63, 0x1d, 0x62, 0x43, 0x96, 0x60, 0x0a, 0xa1, 0x92, 0x9d,
-  0x0b, 0xe9, 0xd9, 0xb0, 0x00, 0x30, 0x3d, 0x05, 0x40, 0xa3, 0xaf, 0x6f,
-  0x14, 0x6b, 0x24, 0x07, 0x7b, 0x8d, 0x47, 0x01, 0x0d, 0xb5, 0x8a, 0x1f,
-  0x07, 0xac, 0xfe, 0xc2, 0x89, 0xc8, 0xe8, 0x9b, 0x17, 0xd1, 0x6c, 0x0d,
-  0x47, 0x80, 0xb6, 0xfb, 0x64, 0x1d, 0x25, 0x3a, 0x9a, 0x2a, 0x16, 0xfe,
-  0x1c, 0x50, 0xff, 0x34, 0xa5, 0x82, 0xa3, 0x46, 0x55, 0x73, 0x98, 0xe8,
-  0xb7, 0xa7, 0xeb, 0x5f, 0x7d, 0x21, 0x12, 0xc8, 0xa1, 0x37, 0xc0, 0xc6,
-  0x8b, 0x4a, 0x4f, 0xed, 0xc7, 0xb8, 0x7e, 0xbb, 0x16, 0x48, 0x47, 0xa4,
-  0x5b, 0x17, 0x3e, 0x6b, 0x6d, 0x55, 0x5a, 0x08, 0x02, 0xdd, 0x14, 0x89,
-  0x3e, 0xae, 0x17, 0xe4, 0x68, 0x0d, 0x15, 0x58, 0x83, 0xcd, 0x0f, 0x63,
-  0x30, 0x04, 0x73, 0x2f, 0xe2, 0xf6, 0xeb, 0x13, 0x64, 0x72, 0x0c, 0x1f,
-  0xf7, 0x46, 0xeb, 0xb1, 0x99, 0x8d, 0x15, 0xe2, 0xac, 0xab, 0xf2, 0xf1,
-  0xa9, 0x0c, 0x45, 0x88, 0x5e, 0x9a, 0xf8, 0xa3, 0x05, 0x94, 0x9b, 0x8c,
-  0x8c, 0xdb, 0x01, 0x4b, 0x57, 0x04, 0x26, 0x28, 0xd8, 0x57, 0xf2, 0x17,
-  0x88, 0xff, 0xfd, 0xdb, 0x76, 0x25, 0x20, 0xb7, 0x21, 0x18, 0x58, 0x7a,
-  0x47, 0x2b, 0xff, 0x65, 0xe7, 0x63, 0x2a, 0x0a, 0xe2, 0xba, 0x3f, 0x47,
-  0xdb, 0x03, 0xcb, 0x0f, 0xdb, 0x34, 0x8d, 0xcd, 0xa3, 0x22, 0x24, 0x24,
-  0x6e, 0x28, 0xd1, 0xd5, 0x76, 0x4a, 0xb4, 0xd1, 0x1c, 0x6b, 0x86, 0x1e,
-  0xf7, 0xb8, 0x7b, 0x42, 0x4e, 0x98, 0x0e, 0xe0, 0xf4, 0x8e, 0x63, 0xa2,
-  0x90, 0x56, 0xea, 0xf2, 0xa3, 0x9d, 0x63, 0x80, 0x05, 0x37, 0x05, 0x58,
-  0xd2, 0xee, 0xa3, 0xa5, 0x08, 0xa2, 0xa7, 0xb5, 0x93, 0x45, 0x93, 0x7a,
-  0xaf, 0x51, 0x66, 0x7d, 0xa2, 0xea, 0x8f, 0xb7, 0x8b, 0x80, 0x25, 0xb3,
-  0x2f, 0xbf, 0xea, 0xc1, 0x63, 0x0d, 0x45, 0x45, 0x6a, 0x0f, 0x81, 0xf4,
-  0x51, 0x4a, 0xfa, 0x82, 0xc5, 0xa7, 0xa0, 0x1a, 0x98, 0x43, 0x00, 0x28,
-  0x06, 0x02, 0x6c, 0x87, 0xa3, 0x11, 0x04, 0x88, 0x70, 0x55, 0x43, 0x5e,
-  0x89, 0x82, 0xde, 0xb3, 0x46, 0x81, 0xfe, 0x82, 0xdf, 0xb2, 0xe9, 0xe8,
-  0x05, 0x00, 0x10, 0x7a, 0x4b, 0x1f, 0x1a, 0x88, 0x0b, 0x28, 0x20, 0x7a,
-  0xb7, 0x35, 0xc9, 0xb7, 0xf5, 0x26, 0x0e, 0xa1, 0x64, 0x16, 0xd3, 0x82,
-  0x0d, 0x20, 0xe5, 0x5a, 0x53, 0x89, 0x42, 0x44, 0x0e, 0x5e, 0x0b, 0xdb,
-  0x55, 0xae, 0xc6, 0xb1, 0xd1, 0xe6, 0x7c, 0x17, 0x1e, 0x8e, 0xbe, 0xf6,
-  0x87, 0xd6, 0x03, 0xdb, 0x7b, 0x41, 0x0b, 0x58, 0x25, 0xba, 0x55, 0xd0,
-  0xfa, 0x03, 0x43, 0xf3, 0x35, 0x09, 0x8c, 0x31, 0x2c, 0xa2, 0xab, 0xd9,
-  0x06, 0xec, 0xf6, 0xff, 0x38, 0x32, 0x1f, 0x30, 0x85, 0x0e, 0x4b, 0x8a,
-  0xe0, 0xfb, 0x2b, 0x94, 0x09, 0xe6, 0x02, 0x83, 0x12, 0xee, 0x34, 0x57,
-  0xb2, 0x55, 0x04, 0xda, 0xe9, 0x24, 0x18, 0xb6, 0xe2, 0x0a, 0x20, 0xc9,
-  0xe8, 0xd5, 0x12, 0x18, 0x7d, 0xaa, 0xf8, 0x68, 0x66, 0x20, 0x7c, 0x33,
-  0xf7, 0x26, 0xcb, 0x96, 0x63, 0xf8, 0x10, 0x60, 0x89, 0xdd, 0x79, 0x11,
-  0xdb, 0x6d, 0x1c, 0xf4, 0xbc, 0x07, 0xf6, 0x89, 0xdf, 0x10, 0x30, 0x38,
-  0x20, 0x40, 0x36, 0x1e, 0x9c, 0x0b, 0x01, 0x22, 0x55, 0xf3, 0xa8, 0x35,
-  0x85, 0x88, 0x14, 0x4a, 0xae, 0x28, 0x97, 0x90, 0x3f, 0xa1, 0xcc, 0x5e,
-  0x53, 0x8a, 0xda, 0x24, 0x60, 0x89, 0x95, 0x98, 0x0e, 0xd0, 0xf8, 0x1b,
-  0xeb, 0x05, 0xee, 0x48, 0xeb, 0x19, 0x25, 0xf6, 0x39, 0xc7, 0x77, 0x0a,
-  0x15, 0x0c, 0xf6, 0xd8, 0x1b, 0x48, 0x3b, 0xd4, 0x30, 0x48, 0x6e, 0xc5,
-  0xd2, 0xe5, 0xa7, 0x8d, 0x88, 0xed, 0x2d, 0x01, 0xf8, 0xc6, 0x82, 0xee,
-  0xe7, 0x00, 0x6f, 0x52, 0x01, 0x18, 0x72, 0xf4, 0x14, 0x4b, 0x86, 0x88,
-  0xb7, 0x86, 0x0e, 0xb0, 0xff, 0x6e, 0x05, 0xef, 0xe7, 0xdd, 0x03, 0xf0,
-  0xe7, 0x42, 0xb3, 0xa5, 0x3f, 0x16, 0x4b, 0x38, 0xa3, 0x46, 0x5c, 0x48,
-  0x48, 0x52, 0x40, 0x20, 0xb2, 0xc3, 0x8b, 0x8a, 0x40, 0x2b, 0x4b, 0xcf,
-  0xbf, 0x6d, 0x61, 0x1b, 0x28, 0xfc, 0x03, 0x3b, 0x38, 0xd2, 0xaa, 0x58,
-  0x76, 0xfa, 0x0b, 0x2c, 0x17, 0xaa, 0x56, 0xf1, 0xd7, 0xd0, 0xc7, 0x0b,
-  0x39, 0xc7, 0xa0, 0x02, 0x96, 0x4b, 0x3b, 0xb4, 0xd5, 0x51, 0x36, 0xfe,
-  0xfc, 0x74, 0x25, 0x43, 0x6d, 0x04, 0x89, 0x52, 0x19, 0x80, 0xdc, 0x60,
-  0x01, 0x83, 0x06, 0x5a, 0x88, 0x05, 0xbd, 0x12, 0x55, 0xa1, 0x1e, 0x54,
-  0x2d, 0x2e, 0xf0, 0xe8, 0x09, 0x09, 0x12, 0x5d, 0x39, 0x3c, 0x4b, 0x33,
-  0xc3, 0xc0, 0x89, 0xd1, 0x07, 0xe3, 0xf6, 0xda, 0x83, 0xc2, 0x27, 0xe1,
-  0x7e, 0xf0, 0x61, 0x52, 0x94, 0xf6, 0xdf, 0xc6, 0x83, 0x99, 0xfb, 0xf7,
-  0x89, 0xd7, 0x8a, 0x06, 0xbe, 0x24, 0xf0, 0x0c, 0x0f, 0x88, 0xed, 0x07,
-  0xeb, 0x15, 0xac, 0x16, 0x0f, 0x79, 0x0f, 0x0c, 0x70, 0xda, 0x1d, 0xfd,
-  0x24, 0xff, 0x46, 0x82, 0xa4, 0x00, 0xdd, 0xb5, 0x0b, 0x97, 0xa0, 0xa8,
-  0xec, 0x97, 0x48, 0xff, 0x0e, 0x70, 0x28, 0x50, 0xcb, 0x15, 0xbe, 0x24,
-  0x73, 0x68, 0xb1, 0x09, 0x97, 0xe9, 0xd3, 0xe2, 0x75, 0xcb, 0xd7, 0x68,
-  0x0d, 0x89, 0xd9, 0xb7, 0x01, 0xf3, 0x44, 0x8a, 0x2d, 0x80, 0x1f, 0x59,
-  0x02, 0xc0, 0x7c, 0xe8, 0x02, 0x5d, 0x5e, 0x50, 0x48, 0x05, 0x6b, 0xcc,
-  0xa6, 0xe4, 0x20, 0xde, 0x10, 0x03, 0x1e, 0x84, 0x2a, 0x32, 0xff, 0xe2,
-  0xf6, 0x89, 0x73, 0x1b, 0x16, 0x18, 0x05, 0xb2, 0x1c, 0x8c, 0x5e, 0x60,
-  0xf6, 0xde, 0x83, 0xf2, 0xeb, 0x8f, 0x22, 0xc9, 0xee, 0x52, 0x89, 0x82,
-  0xb4, 0x84, 0x41, 0x64, 0x05, 0xd6, 0x18, 0x1d, 0xb4, 0x31, 0x61, 0x02,
-  0x3e, 0x89, 0xf9, 0x01, 0xc1, 0x0e, 0x16, 0x1f, 0x01, 0xf2, 0xf9, 0x89,
-  0x4e, 0xea, 0x89, 0xde, 0x0b, 0x91, 0x0e, 0x9b, 0xcb, 0x9a, 0x09, 0x2c,
-  0xf0, 0xb2, 0xf2, 0x33, 0xf2, 0x48, 0x3d, 0xf2, 0xf0, 0x73, 0x35, 0x7d,
-  0x0b, 0x3b, 0x3e, 0xb0, 0x0f, 0x76, 0x97, 0xff, 0xc6, 0x24, 0xc8, 0xea,
-  0x4c, 0xe3, 0x8d, 0xfc, 0x53, 0x57, 0xa8, 0x16, 0x2a, 0x00, 0xd8, 0xa0,
-  0x9b, 0xd8, 0x60, 0xf6, 0xe1, 0x7c, 0x8d, 0x9f, 0xec, 0xb4, 0x08, 0xee,
-  0x04, 0xe0, 0x39, 0x25, 0xe5, 0xda, 0x29, 0xc3, 0x7a, 0x22, 0xdc, 0x69,
-  0x19, 0xd3, 0x28, 0x8d, 0x0b, 0xa2, 0x0d, 0x47, 0x96, 0xc2, 0xfe, 0xeb,
-  0x80, 0x99, 0x46, 0x56, 0xfb, 0xe1, 0xd7, 0x00, 0x71, 0x06, 0x87, 0x69,
-  0x87, 0xa3, 0x35, 0x20, 0x30, 0x12, 0x7d, 0xc3, 0xe8, 0x85, 0xda, 0x1b,
-  0xaf, 0x30, 0x23, 0x68, 0xc0, 0xd0, 0x3a, 0x6e, 0x5d, 0xd9, 0x11, 0x06,
-  0x68, 0x19, 0x28, 0x3d, 0xc8, 0x08, 0x05, 0x2b, 0x7a, 0x0a, 0x41, 0x0b,
-  0x4b, 0xb8, 0x0a, 0x10, 0x14, 0x42, 0x6e, 0x2c, 0x56, 0xfa, 0x66, 0x97,
-  0xa1, 0xe6, 0x81, 0xc2, 0x9b, 0xd6, 0xea, 0x14, 0xe0, 0x74, 0x1f, 0x2c,
-  0x9d, 0x1d, 0x01, 0x1e, 0x6e, 0x20, 0x11, 0x0e, 0xb4, 0x21, 0x00, 0x88,
-  0x45, 0xc7, 0x46, 0x11, 0x0e, 0x2b, 0x32, 0x60, 0xfe, 0x85, 0xa3, 0xa7,
-  0x39, 0x12, 0xfa, 0x34, 0x39, 0xfa, 0x72, 0x07, 0x01, 0x66, 0xc1, 0x42,
-  0x27, 0xfd, 0xc1, 0x30, 0xe5, 0xd1, 0xe1, 0x1f, 0x6e, 0x8e, 0xa0, 0x06,
-  0x8d, 0xca, 0x8a, 0xcb, 0x2d, 0xc2, 0xd8, 0xf7, 0x41, 0x0e, 0x4b, 0xfa,
-  0xad, 0xf6, 0x71, 0xb1, 0x46, 0x33, 0x9e, 0x18, 0x13, 0xc8, 0xc8, 0x46,
-  0x3a, 0xe3, 0x24, 0xff, 0x80, 0x65, 0xf6, 0xb6, 0x64, 0x05, 0xee, 0x16,
-  0x5d, 0x2b, 0x2a, 0x6c, 0xce, 0x75, 0x25, 0x54, 0x64, 0xb2, 0x08, 0xa8,
-  0xc3, 0xab, 0x70, 0xca, 0x66, 0x3d, 0xef, 0xc7, 0xee, 0x2e, 0xe4, 0x4e,
-  0xf4, 0xe0, 0x15, 0xa1, 0x25, 0xf6, 0xc9, 0x03, 0x18, 0xca, 0x13, 0x2a,
-  0x13, 0x7c, 0xfb, 0x32, 0xf4, 0xe8, 0x1f, 0xf2, 0x88, 0x81, 0x4f, 0x3f,
-  0x83, 0x13, 0x72, 0x6d, 0x83, 0x56, 0x6a, 0x76, 0x79, 0xbf, 0xfd, 0xd8,
-  0x91, 0xec, 0x0b, 0x23, 0x7e, 0x75, 0xfe, 0xe9, 0xb4, 0xfd, 0x14, 0xb5,
-  0x6e, 0x42, 0xa2, 0x06, 0x40, 0x53, 0x95, 0xc1, 0xf8, 0x48, 0x7c, 0xd3,
-  0xe8, 0x3e, 0x0d, 0x22, 0x10, 0x67, 0x28, 0xf4, 0x1c, 0x3e, 0x31, 0x58,
-  0x0e, 0xbc, 0xdc, 0x59, 0xef, 0x07, 0x14, 0x8f, 0x50, 0xf2, 0x8b, 0x46,
-  0x9a, 0xf0, 0xf6, 0x31, 0x38, 0xf9, 0xf6, 0x72, 0x09, 0x75, 0x26, 0xbc,
-  0x39, 0xd8, 0x73, 0x1f, 0x61, 0x37, 0xc8, 0x36, 0xc7, 0x76, 0x21, 0xcd,
-  0x1b, 0xb0, 0x9f, 0xe1, 0xcb, 0xfa, 0x5c, 0x9c, 0x28, 0xf8, 0xae, 0x94,
-  0x69, 0x11, 0x94, 0x41, 0x13, 0x36, 0x74, 0x01, 0x8b, 0x84, 0xfc, 0xfe,
-  0xf2, 0x8b, 0x8c, 0xd9, 0x4e, 0xf6, 0x01, 0x92, 0xca, 0x71, 0xf2, 0x06,
-  0xed, 0x45, 0xc8, 0x74, 0xcf, 0x02, 0xe0, 0x8c, 0x2e, 0xe2, 0x07, 0xae,
-  0x15, 0x8e, 0xdb, 0xd1, 0x17, 0x64, 0x0d, 0xd0, 0x5c, 0x41, 0xce, 0x95,
-  0xfc, 0x2e, 0xc1, 0x53, 0xf0, 0x2e, 0x67, 0xde, 0xd1, 0x66, 0x02, 0x11,
-  0x3b, 0x96, 0xfa, 0xfc, 0x08, 0x6c, 0x41, 0x12, 0xf3, 0x50, 0xd5, 0x66,
-  0x03, 0x2f, 0xf9, 0x26, 0x8a, 0x5d, 0xbc, 0x03, 0x68, 0x7c, 0x86, 0xe3,
-  0xed, 0x10, 0xfc, 0x45, 0x02, 0x30, 0xe4, 0x09, 0xc3, 0x81, 0xd8, 0x01,
-  0x0e, 0x4d, 0x05, 0xa2, 0x0d, 0xa9, 0xd4, 0x82, 0xdc, 0x80, 0xb4, 0x47,
-  0x05, 0xd6, 0x53, 0xb4, 0xb1, 0xb5, 0x03, 0xbb, 0xbc, 0xb8, 0xb2, 0xe1,
-  0xb5, 0xce, 0xe0, 0x76, 0x23, 0x81, 0xfa, 0x20, 0xdd, 0x0e, 0x17, 0x75,
-  0x42, 0x36, 0xf7, 0xf0, 0x72, 0x10, 0x0c, 0xa5, 0x2f, 0x0d, 0x7a, 0x7d,
-  0xb6, 0x00, 0x0f, 0xf7, 0xdd, 0xf8, 0x09, 0xda, 0x6b, 0xb1, 0x38, 0x3d,
-  0xb8, 0xea, 0xd3, 0x30, 0x9d, 0x43, 0x06, 0xdf, 0xac, 0xbf, 0xb0, 0xb1,
-  0xc8, 0xfe, 0xd7, 0x46, 0xf0, 0x14, 0xbc, 0x0a, 0x7b, 0x09, 0x0b, 0x2e,
-  0x02, 0x40, 0x76, 0x03, 0x0f, 0xd3, 0x58, 0xec, 0x0f, 0x3e, 0xf2, 0x86,
-  0xd6, 0x12, 0x20, 0xdc, 0xf4, 0x15, 0x36, 0x0f, 0xea, 0x65, 0xf9, 0x3d,
-  0x22, 0xf2, 0x7f, 0xf8, 0xe9, 0x86, 0xfe, 0xff, 0x36, 0xaa, 0x48, 0x36,
-  0x26, 0x46, 0x6e, 0xb8, 0x1a, 0x49, 0xd9, 0x7e, 0x1e, 0xbc, 0x08, 0xe9,
-  0xa9, 0xfb, 0x1f, 0x79, 0x97, 0x83, 0x04, 0xef, 0x1d, 0x00, 0x0b, 0x49,
-  0xa4, 0xe4, 0x21, 0x06, 0x41, 0xce, 0x6f, 0x1b, 0x90, 0x7b, 0x78, 0x07,
-  0xeb, 0xe2, 0x3e, 0xd4, 0x6c, 0x0a, 0x1e, 0x6e, 0x63, 0xa2, 0xf5, 0x99,
-  0x7d, 0x2d, 0x00, 0x04, 0x76, 0x48, 0x57, 0x04, 0x40, 0x68, 0xf6, 0x23,
-  0x34, 0x66, 0x89, 0x10, 0x5e, 0x3d, 0xc3, 0x08, 0x9c, 0x8e, 0x02, 0x31,
-  0x8a, 0x2f, 0xe4, 0x11, 0x58, 0x8a, 0x0e, 0xad, 0x06, 0x0b, 0x9c, 0x63,
-  0xba, 0xaf, 0x41, 0x76, 0xa8, 0x8e, 0x04, 0xc3, 0x0b, 0x81, 0x63, 0xc7,
-  0x54, 0xc8, 0xbd, 0xef, 0xa5, 0xb1, 0xa6, 0x01, 0xc7, 0x01, 0xb0, 0x74,
-  0x17, 0x06, 0x93, 0x89, 0x32, 0x72, 0x56, 0x49, 0xe7, 0x65, 0xdf, 0x91,
-  0x23, 0xcb, 0x52, 0xef, 0x90, 0x75, 0xf8, 0x0a, 0xce, 0xec, 0x2b, 0x99,
-  0x85, 0xa2, 0x06, 0x0b, 0xd1, 0xe7, 0xf0, 0x63, 0x0b, 0x99, 0x05, 0x4b,
-  0x97, 0xf7, 0xd4, 0xfb, 0x99, 0x33, 0xc3, 0x60, 0x7e, 0xee, 0xe8, 0xe8,
-  0xa5, 0x46, 0x82, 0x37, 0x94, 0x7c, 0xa2, 0xc3, 0x85, 0xdb, 0xa7, 0x44,
-  0xf9, 0x18, 0xd8, 0x7b, 0x74, 0xee, 0x61, 0xb1, 0x0d, 0x57, 0x6b, 0x95,
-  0x62, 0xa6, 0x02, 0x80, 0x04, 0x5b, 0x98, 0xa5, 0x6e, 0xb3, 0xf6, 0xde,
-  0x01, 0x7b, 0x2e, 0x38, 0x37, 0xc5, 0x69, 0x03, 0x12, 0x81, 0x5d, 0x24,
-  0x40, 0xb4, 0xbb, 0xe0, 0x04, 0xd4, 0xcd, 0xe4, 0x04, 0xd3, 0xd7, 0xde,
-  0x53, 0xe2, 0x79, 0x3e, 0xfe, 0xee, 0xd9, 0x14, 0xf0, 0xef, 0xf6, 0x04,
-  0x9e, 0xf8, 0xe6, 0x7a, 0xe8, 0x83, 0xe9, 0xe2, 0x0d, 0xda, 0x4b, 0x98,
-  0x5b, 0x61, 0x96, 0x26, 0xd5, 0xc2, 0xc2, 0x6c, 0x18, 0x15, 0x00, 0x22,
-  0x57, 0x8f, 0x60, 0x14, 0x38, 0xca, 0x08, 0x70, 0x7f, 0xa1, 0x48, 0x4c,
-  0x45, 0x81, 0xaf, 0x38, 0x72, 0xe9, 0x59, 0x27, 0x02, 0xbf, 0x8d, 0x86,
-  0xdc, 0xfd, 0xe8, 0x59, 0x82, 0x03, 0x33, 0xd9, 0xba, 0xbf, 0xae, 0x47,
-  0x6a, 0x06, 0x60, 0x07, 0x0b, 0xdd, 0x77, 0x88, 0x09, 0x2d, 0xda, 0x5d,
-  0x67, 0x10, 0x42, 0x75, 0xee, 0xb8, 0xe0, 0xc9, 0x9f, 0x2c, 0xb8, 0x1c,
-  0xb6, 0x4a, 0x09, 0x22, 0x76, 0xa9, 0xcc, 0xfa, 0x80, 0x46, 0xe7, 0x96,
-  0xe8, 0x46, 0xf5, 0x60, 0xb9, 0x68, 0xcb, 0x23, 0x17, 0xf1, 0x73, 0x17,
-  0x44, 0xc2, 0x6a, 0xa1, 0x53, 0xb6, 0x01, 0xd0, 0x1e, 0x1f, 0xd6, 0x02,
-  0x46, 0x1a, 0x01, 0x1d, 0x4a, 0x35, 0xff, 0xf8, 0x28, 0x65, 0x38, 0x24,
-  0x0d, 0x24, 0x2c, 0x12, 0x8b, 0xf1, 0xee, 0x76, 0x27, 0x02, 0x9b, 0xda,
-  0x2b, 0xae, 0xbb, 0xf0, 0x7e, 0x03, 0x70, 0x3e, 0x0d, 0xf1, 0xe0, 0x01,
-  0x7e, 0x0f, 0x9a, 0x6d, 0x0a, 0x0a, 0x54, 0xf7, 0xbf, 0xc0, 0xd7, 0xff,
-  0x40, 0xeb, 0xeb, 0x41, 0x5c, 0x29, 0x80, 0x97, 0xd5, 0xf7, 0xde, 0xdc,
-  0x89, 0xf2, 0x42, 0x0d, 0x9f, 0x1f, 0x99, 0x88, 0xda, 0xef, 0x09, 0x82,
-  0xc3, 0x0f, 0x96, 0x25, 0x78, 0x77, 0x83, 0xb4, 0xec, 0x40, 0xf7, 0x0f,
-  0x1e, 0x49, 0x85, 0xa3, 0x74, 0xa2, 0xeb, 0x4b, 0x62, 0xf2, 0x2d, 0xa1,
-  0x81, 0x8e, 0xe0, 0x5b, 0x0c, 0x21, 0x82, 0x9f, 0x27, 0x74, 0x83, 0x68,
-  0x07, 0xad, 0x56, 0x96, 0xea, 0xf2, 0x11, 0xf8, 0xad, 0xd6, 0x16, 0x32,
-  0xc6, 0x73, 0x26, 0xe5, 0x5c, 0x4a, 0xcf, 0x3e, 0xdd, 0x24, 0x23, 0x2b,
-  0xae, 0xed, 0xbe, 0x0c, 0x50, 0xb6, 0x1d, 0xfa, 0x0d, 0x0f, 0x9f, 0xf4,
-  0xf2, 0x74, 0x88, 0x32, 0x30, 0x92, 0x06, 0x81, 0x0a, 0xd0, 0x7c, 0xdd,
-  0x5d, 0x0e, 0xb8, 0x98, 0xd8, 0x41, 0xfc, 0xdc, 0x83, 0x5d, 0xa2, 0x0e,
-  0x0e, 0xa8, 0x91, 0xf6, 0xb7, 0x3b, 0xc1, 0x73, 0x03, 0x51, 0xa1, 0x73,
-  0x5f, 0x3c, 0x73, 0x15, 0x14, 0xe2, 0x64, 0x8c, 0x75, 0x74, 0xd5, 0x02,
-  0x12, 0x3f, 0x38, 0xeb, 0x17, 0x66, 0x0d, 0x8e, 0xd9, 0xf0, 0x15, 0xe2,
-  0x3a, 0x02, 0xf6, 0x7c, 0x26, 0x3b, 0xe8, 0x2e, 0x0b, 0xe8, 0xd6, 0x01,
-  0xae, 0x51, 0x5e, 0x5e, 0xed, 0x11, 0xb9, 0x0b, 0x40, 0x82, 0xb2, 0x22,
-  0xdb, 0x53, 0xd1, 0x98, 0x67, 0xe2, 0xe2, 0xde, 0x74, 0x19, 0xa6, 0xd4,
-  0x68, 0x0c, 0x25, 0x19, 0xba, 0xd6, 0x84, 0x77, 0x65, 0xb1, 0xfc, 0xd8,
-  0x0b, 0x20, 0xd3, 0xae, 0xeb, 0xd6, 0x6c, 0x20, 0xe4, 0x0a, 0x5c, 0x80,
-  0x78, 0xb7, 0xe0, 0x1b, 0x3b, 0x79, 0x00, 0x74, 0x0a, 0x89, 0xae, 0x18,
-  0x96, 0x89, 0x51, 0xa0, 0xe7, 0xec, 0x33, 0xce, 0x43, 0xe1, 0x19, 0x16,
-  0x4a, 0xad, 0x65, 0x82, 0xeb, 0xff, 0xec, 0xf6, 0x74, 0x1e, 0xb8, 0xba,
-  0xe2, 0xd3, 0x28, 0x7b, 0x8b, 0xcf, 0x86, 0x8c, 0xba, 0x17, 0x11, 0x35,
-  0x8d, 0x10, 0x83, 0x29, 0x83, 0xc7, 0xff, 0x01, 0x2f, 0x4b, 0x29, 0xfe,
-  0x35, 0x22, 0x28, 0x24, 0x89, 0xda, 0xbf, 0x1b, 0xe8, 0xfd, 0xfb, 0x3d,
-  0x1b, 0x47, 0xaa, 0xdd, 0xf4, 0x3a, 0xed, 0x9c, 0xdb, 0x70, 0xaf, 0x06,
-  0xfc, 0x86, 0xf0, 0xe8, 0xb7, 0x99, 0x44, 0xfe, 0x11, 0x86, 0xd7, 0x0b,
-  0x46, 0x16, 0x86, 0x15, 0xd5, 0xaf, 0xfd, 0x0d, 0x31, 0xfe, 0x44, 0x34,
-  0xe9, 0xf3, 0x1c, 0xd7, 0x28, 0xf9, 0x36, 0xea, 0x0f, 0x16, 0xeb, 0x60,
-  0x74, 0x6d, 0x92, 0x96, 0xe8, 0xe6, 0xa6, 0x19, 0x8a, 0x13, 0x3e, 0x49,
-  0xe6, 0x0d, 0x22, 0x97, 0x4b, 0x8d, 0xdb, 0x05, 0xd5, 0x6f, 0x94, 0xbf,
-  0xd0, 0x30, 0x4b, 0xe9, 0x87, 0xfc, 0xff, 0x00, 0x8c, 0x16, 0x2e, 0x4f,
-  0xc3, 0x3b, 0xc4, 0x0b, 0xcd, 0x2b, 0xe8, 0xc4, 0xf7, 0xd8, 0x5f, 0x69,
-  0x38, 0x4f, 0x77, 0x08, 0xda, 0x8c, 0xd0, 0x07, 0xd8, 0x14, 0x74, 0xdf,
-  0x80, 0x0e, 0x5a, 0xb8, 0x9b, 0x82, 0x6b, 0x15, 0x23, 0x2a, 0xb4, 0x97,
-  0x0c, 0x74, 0x61, 0xc4, 0x63, 0x6b, 0xbf, 0x7f, 0x76, 0x65, 0x72, 0x66,
-  0x6c, 0xf0, 0x6f, 0x77, 0x21, 0x00, 0x1a, 0x0c, 0x1b, 0x64, 0xc7, 0x1e,
-  0xe9, 0x07, 0x57, 0xb9, 0x4a, 0x7f, 0xb0, 0x00, 0xf2, 0xae, 0x4f, 0x8a,
-  0xf1, 0x04, 0x88, 0x05, 0x3c, 0x41, 0xa2, 0x6c, 0xa1, 0xe5, 0x7c, 0x83,
-  0xc6, 0x02, 0x88, 0x0a, 0xd2, 0x8e, 0x45, 0x6f, 0x0f, 0x75, 0xe8, 0x5f,
-  0x1a, 0xc6, 0x01, 0x11, 0x9f, 0x30, 0xd9, 0x7c, 0x32, 0x57, 0x10, 0x72,
-  0x0c, 0x37, 0x27, 0xf3, 0xa5, 0xf6, 0x13, 0xc9, 0xf3, 0xa4, 0x1c, 0x1a,
-  0xab, 0x77, 0xbd, 0xd9, 0x88, 0xd0, 0x57, 0xbb, 0x4f, 0x8a, 0xe0, 0x1b,
-  0xa6, 0xab, 0x9d, 0xaa, 0x9b, 0x1a, 0x31, 0xdd, 0x66, 0x33, 0x97, 0xc0,
-  0xf7, 0xd1, 0x8b, 0x49, 0x85, 0x5c, 0x16, 0x05, 0x43, 0xff, 0xd2, 0x78,
-  0x16, 0x0b, 0xc9, 0x79, 0x41, 0xf7, 0xdb, 0xd9, 0xf7, 0xd0, 0xd9, 0x6f,
-  0xa2, 0x37, 0x00, 0xf7, 0xb7, 0xda, 0xc0, 0x83, 0xda, 0x52, 0xfe, 0xb0,
-  0x07, 0x5d, 0x1c, 0x12, 0x21, 0xec, 0x1a, 0x00, 0x09, 0x1e, 0xc3, 0xe8,
-  0x0f, 0xc3, 0x0a, 0x61, 0x2e, 0xc1, 0x0b, 0x0b, 0x66, 0x4b, 0xf8, 0x74,
-  0x16, 0x43, 0x3b, 0xda, 0x5f, 0x98, 0x8b, 0xc8, 0x8b, 0xc2, 0xa2, 0x2b,
-  0x2d, 0x3b, 0xb7, 0x91, 0x02, 0x8b, 0xda, 0xf0, 0x8b, 0xd1, 0x2b, 0xc9,
-  0xbf, 0x19, 0xca, 0x72, 0x1a, 0x75, 0x10, 0xff, 0x3b, 0xd8, 0x77, 0x0c,
-  0x2b, 0xc3, 0x8b, 0xd8, 0x6b, 0x10, 0x1d, 0x55, 0xee, 0x61, 0x07, 0xff,
-  0xdb, 0x93, 0x87, 0xca, 0xc3, 0x55, 0x56, 0x2b, 0xfb, 0xf6, 0x8b, 0xee,
-  0x03, 0xdb, 0xae, 0x7b, 0x72, 0x11, 0x45, 0x2a, 0xb9, 0xf5, 0x77, 0x04,
-  0x7f, 0x76, 0xef, 0xf8, 0x13, 0xf6, 0x4d, 0xf1, 0x78, 0x20, 0xd1, 0xd9,
-  0x2b, 0x33, 0x34, 0x7f, 0x19, 0xca, 0xf5, 0x72, 0xf0, 0x03, 0x75, 0x0f,
-  0x0c, 0x4f, 0x1b, 0x03, 0xfe, 0xc3, 0x13, 0xd1, 0x73, 0xf1, 0xeb, 0xdf,
-  0xf6, 0x07, 0x4e, 0xff, 0x8b, 0xca, 0x8b, 0xc6, 0x33, 0xd2, 0x5e, 0xb7,
-  0x5d, 0xcd, 0x93, 0x50, 0xc5, 0x92, 0x0b, 0x36, 0xf7, 0xe2, 0x91, 0xef,
-  0x06, 0x04, 0xf7, 0xe3, 0x03, 0xdd, 0xc8, 0x58, 0x04, 0xd1, 0x82, 0xc3,
-  0x93, 0xd0, 0x5a, 0xbf, 0x0d, 0x1b, 0xfc, 0x55, 0x52, 0x8b, 0x05, 0x8b,
-  0x5d, 0x6d, 0x19, 0x4d, 0x1b, 0xd5, 0x55, 0x1a, 0x75, 0x39, 0x04, 0x2f,
-  0xf7, 0xf8, 0xcd, 0x21, 0xc2, 0x89, 0xfd, 0x26, 0xed, 0x05, 0x89, 0x16,
-  0x96, 0x89, 0x89, 0x59, 0x89, 0x7f, 0x89, 0x6d, 0x0a, 0x1b, 0xc0, 0x5d,
-  0xa7, 0x07, 0xed, 0xd1, 0x47, 0x0c, 0x0b, 0xf4, 0xc2, 0x47, 0x07, 0xf6,
-  0xfe, 0xe8, 0xcc, 0x2f, 0x82, 0xb0, 0x2d, 0xec, 0x00, 0x53, 0x74, 0x89,
-  0xcf, 0xba, 0x46, 0x08, 0x8e, 0x6e, 0x2a, 0x1e, 0x8e, 0xd8, 0x10, 0x8e,
-  0xe0, 0x1f, 0xb9, 0x87, 0x68, 0x51, 0x30, 0x62, 0x60, 0x14, 0x9a, 0xeb,
-  0xcf, 0x82, 0x69, 0xb7, 0xec, 0xed, 0xee, 0x05, 0x96, 0x04, 0xf0, 0x59,
-  0x06, 0x65, 0xf2, 0x96, 0x08, 0xf6, 0x58, 0x0a, 0xbf, 0xd0, 0x45, 0x06,
-  0x17, 0x15, 0xf9, 0x05, 0x8d, 0x56, 0xec, 0xd2, 0x2b, 0xf3, 0xe8, 0xc3,
-  0x08, 0xc7, 0x07, 0xc6, 0x89, 0x50, 0x5b, 0x05, 0xf0, 0x2c, 0x04, 0xb2,
-  0xf2, 0xcb, 0x06, 0xf6, 0x2c, 0x08, 0xb2, 0xf8, 0xc7, 0x0a, 0xc6, 0x00,
-  0x57, 0xb8, 0xa6, 0xae, 0x9f, 0x68, 0x42, 0xe6, 0xea, 0xca, 0xbd, 0x36,
-  0xe3, 0xa6, 0x2f, 0x98, 0x83, 0xb7, 0x64, 0xc6, 0x8d, 0x68, 0x2c, 0x85,
-  0x4e, 0xe0, 0xe8, 0x50, 0x03, 0xe8, 0x79, 0x64, 0xab, 0xd1, 0x86, 0x4d,
-  0x61, 0x16, 0x36, 0xf3, 0xfb, 0x53, 0x1e, 0x52, 0x8e, 0x68, 0x70, 0x6f,
-  0x06, 0x94, 0x1d, 0xe1, 0x8e, 0xdd, 0x1f, 0xb6, 0x1e, 0x57, 0x26, 0xa5,
-  0x46, 0xf0, 0x04, 0x8e, 0x5e, 0x06, 0x85, 0x26, 0xfd, 0x8f, 0x45, 0x0a,
-  0x58, 0x5b, 0xae, 0x00, 0x91, 0xc2, 0x8c, 0x07, 0x2f, 0xe4, 0x07, 0x5d,
-  0x8f, 0x9c, 0x07, 0x21, 0xd1, 0xc3, 0x3f, 0x5e, 0xb8, 0x00, 0x44, 0x6e,
-  0x4c, 0x19, 0xc9, 0x02, 0x60, 0xe1, 0x04, 0xc0, 0xd7, 0xf5, 0xa3, 0x46,
-  0x58, 0xc1, 0xf8, 0x97, 0xa1, 0x02, 0xd1, 0x02, 0x50, 0x49, 0x76, 0xf0,
-  0xe8, 0xd8, 0x07, 0x04, 0xc0, 0x45, 0x5e, 0x22, 0xff, 0x75, 0x11, 0x88,
-  0x9a, 0xae, 0x0c, 0x0f, 0x6c, 0x06, 0xd8, 0x1a, 0xa5, 0x4f, 0xf6, 0x8b,
-  0x86, 0xfc, 0xfd, 0x27, 0x32, 0xb0, 0xf3, 0xc1, 0x89, 0xd0, 0xd4, 0x05,
-  0x07, 0xdb, 0x7a, 0xd8, 0x39, 0xd6, 0x7f, 0x02, 0x5f, 0xd7, 0x39, 0xcf,
-  0x76, 0x15, 0xe1, 0x29, 0xcf, 0x19, 0x79, 0x56, 0x22, 0x89, 0x8f, 0x74,
-  0x7f, 0x0c, 0x4b, 0xcb, 0xff, 0xdd, 0x77, 0x06, 0x6b, 0xbc, 0xe0, 0xeb,
-  0x4e, 0xb9, 0x6f, 0x94, 0xbe, 0xfe, 0xfd, 0x30, 0x49, 0x27, 0x0b, 0x26,
-  0x96, 0x52, 0xcf, 0x2c, 0x02, 0xdf, 0x76, 0x25, 0x23, 0x96, 0x2b, 0x64,
-  0xd5, 0xb8, 0x7a, 0xe8, 0x70, 0x9b, 0x04, 0x7c, 0x82, 0x6f, 0x3d, 0x29,
-  0x4e, 0xfe, 0xed, 0x19, 0xc6, 0x75, 0x93, 0x77, 0x23, 0x75, 0xd0, 0xeb,
-  0xdb, 0xb1, 0x8b, 0x0e, 0xeb, 0xbc, 0xd9, 0x22, 0x01, 0x32, 0xc9, 0xed,
-  0x36, 0x26, 0x07, 0xf3, 0xad, 0x9a, 0xfa, 0x95, 0xe9, 0x4f, 0xff, 0x68,
-  0xaa, 0xde, 0x54, 0xf8, 0xdd, 0xae, 0xc3, 0xb4, 0x40, 0xc8, 0xf5, 0x21,
-  0x92, 0x43, 0x3c, 0x44, 0xc2, 0xb1, 0xc8, 0x7f, 0x6f, 0x01, 0x0b, 0x31,
-  0xc2, 0xd2, 0x3b, 0x35, 0x10, 0xb4, 0xb6, 0x30, 0xa2, 0x81, 0xae, 0x76,
-  0xf3, 0xe8, 0xb2, 0xb7, 0x19, 0xeb, 0xec, 0x05, 0x28, 0xb2, 0xba, 0xd0,
-  0x17, 0x2d, 0xbc, 0x84, 0xe6, 0x99, 0xc3, 0xb8, 0x45, 0x50, 0x02, 0xb9,
-  0xe8, 0x44, 0x07, 0x3c, 0xd0, 0x0d, 0x42, 0x69, 0xf8, 0x00, 0xa8, 0x02,
-  0x74, 0x63, 0x8d, 0xc4, 0xf4, 0x1a, 0xf6, 0xc4, 0x20, 0x2c, 0x40, 0xb0,
-  0x0d, 0xc6, 0xf6, 0x15, 0x36, 0xc2, 0xb4, 0x42, 0xd4, 0x60, 0x2f, 0xf4,
-  0xd1, 0xca, 0x85, 0xe2, 0xd2, 0x7c, 0x5c, 0x45, 0xbe, 0xbd, 0x12, 0xf6,
-  0x46, 0xff, 0xb0, 0x26, 0x14, 0x70, 0x6a, 0xee, 0x2b, 0x80, 0xe6, 0x7f,
-  0xb6, 0xd3, 0x07, 0x64, 0x10, 0xa2, 0xa8, 0x05, 0x7b, 0x4b, 0xaa, 0x17,
-  0x6f, 0x1d, 0xfe, 0x40, 0x74, 0x8e, 0x39, 0x10, 0x45, 0x30, 0xec, 0x35,
-  0x64, 0xf9, 0x1a, 0x4f, 0xff, 0x43, 0x40, 0x6b, 0x75, 0x20, 0x19, 0x7c,
-  0xeb, 0x0b, 0xeb, 0x10, 0x1f, 0x89, 0x8d, 0x11, 0xc1, 0x59, 0xbf, 0x30,
-  0x5d, 0x0e, 0xeb, 0x16, 0x8e, 0xff, 0xd7, 0x05, 0xeb, 0xef, 0xe9, 0x06,
-  0x01, 0xc7, 0xe8, 0xdd, 0xaa, 0xd6, 0x3d, 0xb1, 0x81, 0x4a, 0x54, 0xb8,
-  0xbf, 0xfb, 0xbe, 0x50, 0x2c, 0xbe, 0x36, 0xfa, 0x30, 0x02, 0x73, 0x29,
-  0xf7, 0x84, 0x5b, 0xc4, 0x24, 0xe0, 0xfe, 0x2b, 0xe0, 0x6a, 0xa9, 0xe7,
-  0x03, 0x89, 0xd0, 0x13, 0x62, 0x8d, 0xb4, 0xd4, 0x73, 0x32, 0xd1, 0x91,
-  0x01, 0x1b, 0xe4, 0x0a, 0xd4, 0x75, 0x6c, 0x5b, 0x09, 0x01, 0xa3, 0xfb,
-  0x39, 0x62, 0x0d, 0x85, 0xc2, 0x12, 0xc0, 0x3b, 0x75, 0x5a, 0x88, 0x60,
-  0xfc, 0xeb, 0x6e, 0xfa, 0x86, 0xf1, 0xc8, 0xfe, 0xd0, 0x3c, 0xc1, 0xf7,
-  0x43, 0x2e, 0x1c, 0x31, 0xf5, 0xdb, 0x68, 0xff, 0x1f, 0xfa, 0x21, 0xdd,
-  0xa8, 0xc1, 0x3d, 0x88, 0x0c, 0x95, 0x31, 0xd6, 0x57, 0x01, 0xea, 0xa0,
-  0x17, 0x8d, 0xbe, 0x80, 0x6f, 0x99, 0x89, 0xeb, 0x69, 0x73, 0x2d, 0x0f,
-  0x82, 0x81, 0xf7, 0x0c, 0x74, 0xc7, 0x1a, 0x0a, 0x9d, 0x58, 0x3b, 0x54,
-  0x75, 0x54, 0x5d, 0xf4, 0x5e, 0x6f, 0x2b, 0xfa, 0x8a, 0x07, 0x05, 0x2d,
-  0x16, 0x07, 0x9b, 0x74, 0x05, 0x6d, 0xfa, 0x77, 0x47, 0x11, 0x6c, 0x61,
-  0xff, 0x7a, 0x06, 0x4d, 0x43, 0xd9, 0x74, 0x85, 0x4c, 0x2e, 0x7e, 0xd8,
-  0x77, 0xff, 0x4f, 0x0e, 0xe9, 0x2f, 0xeb, 0x0d, 0xf2, 0x08, 0xe1, 0xd2,
-  0x59, 0x9b, 0x05, 0xe0, 0xa8, 0xfe, 0xdd, 0x79, 0x8c, 0xc8, 0x30, 0x9f,
-  0x15, 0x5e, 0x3b, 0x06, 0xf6, 0x60, 0x07, 0x54, 0xf8, 0xc3, 0xa7, 0xa3,
-  0x71, 0x53, 0x56, 0x3b, 0x41, 0x74, 0x7f, 0x8a, 0x24, 0x3c, 0x41, 0x72,
-  0x06, 0xff, 0x3c, 0x5a, 0x77, 0x02, 0x04, 0x20, 0x80, 0xfc, 0x6d, 0x0a,
-  0x08, 0xad, 0x04, 0x0b, 0xc2, 0x03, 0x80, 0xbf, 0xe9, 0x38, 0xe0, 0x40,
-  0x75, 0x84, 0xe4, 0xb8, 0xa7, 0x43, 0x46, 0xdd, 0x45, 0x88, 0xc3, 0x02,
-  0x80, 0xd1, 0xff, 0xa0, 0xc5, 0x3a, 0x70, 0x5e, 0xe1, 0x3b, 0x00, 0x9c,
-  0x62, 0x04, 0x00, 0xbd, 0xd6, 0x44, 0x4b, 0xe8, 0x5a, 0x9b, 0xd0, 0x4a,
-  0x02, 0xb8, 0xf0, 0x33, 0x30, 0xc9, 0xfd, 0x0f, 0xbb, 0x54, 0x4b, 0x04,
-  0xbb, 0xf3, 0x88, 0xc8, 0x2d, 0x40, 0x0b, 0xf5, 0x8d, 0x11, 0x6f, 0xd4,
-  0xbd, 0x05, 0x50, 0xd5, 0x84, 0xc9, 0x5b, 0x72, 0x60, 0x06, 0x97, 0xdc,
-  0x53, 0x19, 0x25, 0x7b, 0x41, 0x6c, 0xd6, 0x0c, 0x15, 0x66, 0x42, 0xa1,
-  0x11, 0xa0, 0xf4, 0xde, 0xd5, 0x4b, 0xeb, 0xe4, 0x0c, 0x6b, 0x51, 0xd0,
-  0x46, 0x04, 0xf8, 0xcd, 0x8c, 0xda, 0xef, 0x97, 0xc7, 0x8e, 0xc2, 0x57,
-  0xfd, 0xac, 0xaa, 0x84, 0xc0, 0xe0, 0xfa, 0xa9, 0x35, 0x06, 0xe6, 0x11,
-  0xff, 0x58, 0xeb, 0xe0, 0x3d, 0x61, 0x00, 0x7c, 0x08, 0xff, 0x3d, 0x7a,
-  0x00, 0x7f, 0x03, 0x2d, 0x20, 0x00, 0x7b, 0x8a, 0xc8, 0x81, 0x17, 0x6c,
-  0x2d, 0x43, 0xf1, 0xf6, 0x84, 0xbf, 0x4b, 0xbf, 0x7f, 0x03, 0x43, 0xeb,
-  0xf0, 0x88, 0xfd, 0xc1, 0x3c, 0x2b, 0x75, 0x1d, 0x43, 0xb8, 0x37, 0x8a,
-  0x17, 0xa3, 0xc9, 0x6f, 0xd6, 0x18, 0xe2, 0x20, 0x74, 0x13, 0x0d, 0xf8,
-  0xc5, 0xf7, 0xea, 0xbd, 0xb7, 0x43, 0x2d, 0x30, 0xbf, 0x74, 0xe6, 0x3c,
-  0x2d, 0x74, 0xdf, 0xfc, 0xeb, 0xde, 0x80, 0xf9, 0x2d, 0x75, 0x0a, 0x90,
-  0xd7, 0xd3, 0x8b, 0xb5, 0x4b, 0x77, 0x02, 0xff, 0x16, 0x5a, 0xa8, 0x4f,
-  0x35, 0xa3, 0x40, 0x76, 0xfa, 0xde, 0x05, 0xf6, 0x0c, 0x03, 0xed, 0x5c,
-  0x4f, 0xf4, 0xee, 0xe9, 0x10, 0x02, 0xcd, 0x64, 0x0f, 0xe3, 0xd0, 0xe9,
-  0x53, 0x7f, 0xe9, 0x8a, 0x00, 0x4f, 0x70, 0x65, 0xf1, 0x6e, 0x20, 0x57,
-  0x61, 0xbf, 0xf2, 0x6f, 0x6d, 0x20, 0x43, 0x2f, 0xff, 0x43, 0x2b, 0x2b,
-  0x31, 0x36, 0x20, 0x52, 0x75, 0xff, 0x6e, 0x2d, 0x54, 0x69, 0x6d, 0x65,
-  0x20, 0x73, 0xff, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x20, 0x50, 0xfe,
-  0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0xdf, 0x21, 0x6f, 0x70, 0x79,
-  0x72, 0xff, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29, 0xff, 0x20,
-  0x53, 0x79, 0x62, 0x61, 0x73, 0x65, 0x2c, 0xf6, 0x20, 0x49, 0x6e, 0x63,
-  0x23, 0xff, 0x31, 0x39, 0x38, 0x38, 0x2d, 0x32, 0x30, 0xf6, 0x30, 0x32,
-  0x2e, 0x2a, 0x00, 0xfe, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0xdb, 0x1c,
-  0x73, 0x2b, 0x6d, 0x6e, 0x47, 0xb7, 0x6e, 0x2e, 0x64, 0x65, 0x6d, 0x48,
-  0x63, 0xa2, 0x02, 0x5d, 0xfb, 0x4e, 0x6f, 0xad, 0x0c, 0x10, 0xdb, 0x6f,
-  0x75, 0x43, 0x20, 0x6d, 0x18, 0x6d, 0xa2, 0x57, 0xd6, 0xb2, 0x79, 0xff,
-  0x6e, 0x00, 0x0d, 0x0a, 0x03, 0x00, 0xfb, 0xff, 0xb9, 0x3a, 0x09, 0x8e,
-  0xc1, 0xbb, 0xfd, 0xbc, 0xff, 0x83, 0xc3, 0x0f, 0x80, 0xe3, 0xf0, 0x26,
-  0x89, 0x89, 0x1e, 0xe3, 0x7d, 0x26, 0x8c, 0x1e, 0x32, 0x5b, 0xe2, 0xdc,
-  0x67, 0x11, 0x8e, 0x06, 0x89, 0xdd, 0xe3, 0x15, 0x3a, 0xe8, 0x4f, 0x8b,
-  0xd3, 0x66, 0x27, 0x01, 0x35, 0x26, 0x6d, 0xe7, 0x36, 0x02, 0xcd, 0xf5,
-  0x3d, 0x8b, 0x0e, 0xa3, 0xae, 0x18, 0x7f, 0x2b, 0xc8, 0x3b, 0xd1, 0x72,
-  0x0b, 0x17, 0x07, 0x7f, 0xb8, 0x3b, 0x73, 0x8c, 0xca, 0xe8, 0x67, 0xb4,
-  0x02, 0x12, 0x4a, 0x1d, 0x87, 0xd2, 0x78, 0x01, 0x64, 0xd5, 0x6b, 0x7c,
-  0x3e, 0xa5, 0x30, 0xfb, 0xda, 0x03, 0xd8, 0x26, 0xa1, 0x57, 0x6d, 0x8e,
-  0x30, 0xe9, 0xd8, 0xb4, 0x4a, 0xd6, 0x7f, 0x8c, 0xdf, 0x8e, 0xc7, 0xbf,
-  0x81, 0xff, 0x00, 0x8a, 0x4d, 0xff, 0xb5, 0x00, 0xfc, 0xb0, 0xfe, 0x20,
-  0xf3, 0xae, 0x8d, 0x75, 0xff, 0xba, 0xef, 0x8b, 0xc2, 0x26, 0x8b, 0x3e,
-  0x6b, 0x82, 0x87, 0x73, 0x3e, 0x52, 0x70, 0x06, 0x54, 0x4f, 0xb0, 0x96,
-  0x41, 0x6f, 0x79, 0x2a, 0xc0, 0xaa, 0x4b, 0x93, 0xaa, 0xed, 0x4f, 0xb4,
-  0x30, 0x37, 0xed, 0x26, 0xa2, 0x34, 0x18, 0xed, 0x88, 0x26, 0x35, 0x50,
-  0xff, 0xcf, 0x3c, 0x03, 0x72, 0x58, 0x8e, 0x1e, 0x2c, 0x89, 0x00, 0x65,
-  0x78, 0xbd, 0x00, 0x01, 0x37, 0x88, 0x0d, 0x20, 0xdd, 0x20, 0x3d, 0xe3,
-  0x12, 0xff, 0x81, 0x7c, 0x02, 0x38, 0x37, 0x75, 0x27, 0x80, 0xe8, 0x7c,
-  0x04, 0x3d, 0x29, 0xa3, 0x7f, 0xcd, 0x01, 0xeb, 0x1c, 0x3d, 0x6c, 0x89,
-  0x66, 0xc5, 0x41, 0xd7, 0xa4, 0x0c, 0x20, 0x34, 0x13, 0x5d, 0x83, 0x04,
-  0x6f, 0x09, 0x3c, 0x6e, 0x75, 0xf5, 0x07, 0x81, 0xe5, 0xff, 0x14, 0xb8,
-  0x17, 0x05, 0x80, 0xb7, 0x88, 0xac, 0x75, 0xbb, 0xfa, 0x05, 0x75, 0xba,
-  0xee, 0xac, 0x46, 0x46, 0x0d, 0x96, 0xa4, 0x8e, 0x25, 0xe0, 0xfb, 0xf1,
-  0x89, 0x36, 0x56, 0x4f, 0x82, 0x6d, 0x58, 0x69, 0xff, 0xdc, 0x8b, 0xc5,
-  0xa2, 0x40, 0x4f, 0x20, 0x26, 0x85, 0x9e, 0xc0, 0x74, 0x9b, 0xb9, 0x2f,
-  0x2c, 0xbf, 0x10, 0x50, 0xda, 0x2b, 0xcf, 0x91, 0x35, 0x56, 0x5b, 0xf8,
-  0x42, 0x82, 0x4f, 0x0e, 0xab, 0xed, 0x33, 0x75, 0xa3, 0x08, 0xfd, 0x8c,
-  0x0e, 0x44, 0x4f, 0xa3, 0x46, 0xd2, 0x06, 0x48, 0xcd, 0x4a, 0x4c, 0xfb,
-  0x4f, 0x33, 0xed, 0xb8, 0x32, 0x19, 0x66, 0x4e, 0xd6, 0x50, 0x4f, 0x72,
-  0xa2, 0x35, 0x49, 0x6f, 0x56, 0x25, 0x04, 0x50, 0x7f, 0xe6, 0xda, 0xfc,
-  0x8d, 0xa5, 0x3e, 0x78, 0x68, 0xed, 0xab, 0x7b, 0x46, 0xca, 0xfe, 0x01,
-  0xf3, 0xaf, 0x58, 0x74, 0x3b, 0x25, 0xf1, 0xc3, 0xb8, 0x1e, 0x41, 0x70,
-  0xbc, 0x7d, 0xbd, 0x05, 0xbf, 0xbd, 0x8c, 0xcf, 0x8e, 0xdf, 0xba, 0xdb,
-  0x4d, 0x73, 0x1b, 0x3d, 0x6b, 0xf2, 0x18, 0x7f, 0x1f, 0x5a, 0x8b, 0xf2,
-  0xfc, 0xac, 0x77, 0xa0, 0xfb, 0x8b, 0xce, 0xe0, 0x2b, 0xca, 0x49, 0x77,
-  0x77, 0x1e, 0x60, 0x51, 0x73, 0xab, 0xfc, 0x5f, 0x0b, 0x58, 0x46, 0xa5,
-  0xb7, 0x4b, 0xba, 0x0f, 0x6f, 0x5f, 0x64, 0x03, 0x58, 0xda, 0xb4, 0x4c,
-  0x0f, 0xd7, 0x0e, 0x61, 0x7d, 0xd8, 0x58, 0xc3, 0xcb, 0xcb, 0x3c, 0x1c,
-  0xd7, 0xc0, 0xe4, 0x22, 0x93, 0x1e, 0xc6, 0x2a, 0xda, 0x17, 0x30, 0x19,
-  0x2d, 0x4a, 0xf0, 0xdf, 0x1b, 0x29, 0xf9, 0xf3, 0xa6, 0xc1, 0x74, 0x05,
-  0xa2, 0xba, 0xd8, 0xf2, 0xff, 0x1a, 0x1f, 0xdb, 0x04, 0x9e, 0x1a, 0x24,
-  0x5a, 0x1d, 0xc6, 0x29, 0xfc, 0x78, 0x8d, 0x76, 0xdd, 0xad, 0xb7, 0xc5,
-  0x5e, 0xd8, 0x2d, 0xde, 0x8d, 0xbe, 0x02, 0x33, 0xc9, 0x3b, 0x17, 0x97,
-  0xf0, 0x92, 0x87, 0xe8, 0xd1, 0xf7, 0x37, 0x5e, 0x01, 0x37, 0x89, 0x17,
-  0x51, 0x37, 0x0a, 0x8a, 0x9f, 0x6c, 0xf0, 0x4b, 0x88, 0x1c, 0x46, 0x16,
-  0xdf, 0xd3, 0xd7, 0xc3, 0x68, 0xd3, 0x4e, 0x7a, 0xe7, 0x47, 0x85, 0x32,
-  0x89, 0xf6, 0xaa, 0x64, 0xda, 0xd2, 0x65, 0xab, 0xe7, 0x74, 0xf9, 0x0a,
-  0xa0, 0x9e, 0x6e, 0xc3, 0x07, 0xe8, 0x9e, 0x88, 0x5a, 0x9b, 0x5e, 0x19,
-  0x83, 0x04, 0xa8, 0x44, 0x45, 0x5f, 0x2d, 0x72, 0xec, 0x7a, 0x4f, 0x17,
-  0xdb, 0x3a, 0x07, 0x46, 0x45, 0xb6, 0x28, 0x43, 0x1e, 0x84, 0xf4, 0x0d,
-  0xfe, 0x58, 0x2c, 0xa3, 0x13, 0x3b, 0xd7, 0xaf, 0x50, 0xe8, 0xe0, 0x56,
-  0xdd, 0xa7, 0x2a, 0xdd, 0x93, 0xd8, 0xff, 0xfd, 0xc8, 0xe9, 0xd8, 0xfe,
-  0xa2, 0x1e, 0x68, 0x1f, 0xd6, 0x0d, 0xac, 0x50, 0xce, 0x26, 0x12, 0x6a,
-  0xbe, 0x9b, 0x9e, 0xc1, 0xfe, 0x73, 0x09, 0x8c, 0xaf, 0x08, 0x04, 0x40,
-  0xc9, 0xf1, 0x9a, 0xc5, 0x5b, 0x50, 0xe4, 0xd1, 0xe8, 0xce, 0x0a, 0x55,
-  0x37, 0x25, 0x73, 0x39, 0x01, 0x30, 0x09, 0xdf, 0x37, 0x2b, 0x80, 0xfb,
-  0x50, 0x6f, 0x92, 0xb2, 0x0e, 0xeb, 0xb7, 0x07, 0x08, 0x22, 0x72, 0xfa,
-  0x14, 0xb2, 0x13, 0x88, 0xd3, 0xda, 0xa6, 0x8a, 0xb7, 0x83, 0x4f, 0x98,
-  0x13, 0x14, 0x03, 0x1c, 0x90, 0x6b, 0x59, 0x21, 0x72, 0x20, 0x72, 0x83,
-  0x17, 0x7f, 0xe5, 0x80, 0xfa, 0x13, 0x76, 0xe0, 0xf0, 0xeb, 0xdc, 0x88,
-  0xf8, 0x52, 0x84, 0xd3, 0xe1, 0xcc, 0x6d, 0xe8, 0xaa, 0xc4, 0xd0, 0xd0,
-  0x5a, 0x88, 0x7c, 0x1a, 0x09, 0xd0, 0x14, 0x53, 0x4a, 0x20, 0xbd, 0x7b,
-  0xa8, 0x31, 0x2b, 0x0f, 0x04, 0x5d, 0x94, 0x7e, 0xb6, 0xfc, 0xd2, 0x89,
-  0x16, 0x00, 0xf3, 0x0f, 0xc0, 0x89, 0x36, 0x1e, 0x5b, 0x02, 0x55, 0x83,
-  0x02, 0xc7, 0x04, 0x5d, 0xce, 0xfc, 0x07, 0xbd, 0x04, 0x1b, 0xd1, 0xba,
-  0xfe, 0xff, 0x99, 0xdb, 0xc6, 0x53, 0x54, 0xf7, 0x5b, 0x07, 0x4c, 0x5c,
-  0x17, 0x77, 0x25, 0x17, 0xba, 0x50, 0x0a, 0xc7, 0x0d, 0x46, 0xbe, 0x00,
-  0x0b, 0x44, 0x46, 0x0e, 0x46, 0x38, 0x67, 0x9b, 0x36, 0x0e, 0x09, 0x77,
-  0x34, 0xc4, 0x2a, 0xba, 0x52, 0xc9, 0x53, 0x97, 0x8e, 0x72, 0x4f, 0x6b,
-  0xa9, 0xeb, 0x50, 0x5d, 0xd7, 0x9c, 0x45, 0xcd, 0xb9, 0x07, 0xb9, 0x07,
-  0x1f, 0x8d, 0x16, 0x02, 0x96, 0x14, 0xd7, 0x5c, 0x0b, 0x6a, 0xc4, 0x2b,
-  0x65, 0xc3, 0x8a, 0xfb, 0x9b, 0x38, 0x8b, 0x36, 0xd4, 0xec, 0xbb, 0x12,
-  0x59, 0xa8, 0x86, 0xe4, 0x1b, 0xe3, 0x1c, 0x00, 0x2c, 0xa3, 0x49, 0x6a,
-  0x17, 0x86, 0xad, 0xa9, 0x05, 0xa1, 0x84, 0xa2, 0x13, 0x6a, 0xb1, 0xcf,
-  0x09, 0x0a, 0xad, 0x0e, 0x12, 0x4b, 0x33, 0xed, 0x50, 0xa2, 0x53, 0xcc,
-  0xa2, 0x05, 0xb8, 0x5d, 0xef, 0x06, 0x98, 0x75, 0x5f, 0x9c, 0xe8, 0xb7,
-  0xe5, 0x09, 0x0c, 0x07, 0xf7, 0x39, 0xc1, 0x75, 0xce, 0x15, 0x5e, 0x17,
-  0xc0, 0xdc, 0x12, 0x10, 0x07, 0x4d, 0xf1, 0xb9, 0x17, 0x91, 0x60, 0xd0,
-  0x53, 0x59, 0xdc, 0x84, 0x61, 0x0f, 0xea, 0x62, 0x2f, 0x16, 0x42, 0x63,
-  0xd1, 0x21, 0x0a, 0x3c, 0xee, 0xb7, 0x52, 0xb4, 0x37, 0x94, 0x38, 0x28,
-  0x14, 0x5a, 0x1e, 0xb4, 0x16, 0x26, 0x88, 0xd8, 0xbe, 0xe4, 0x8a, 0xf5,
-  0x65, 0x1a, 0x9a, 0x36, 0x60, 0x0c, 0xa9, 0x37, 0x55, 0xb8, 0xeb, 0x06,
-  0x5d, 0x77, 0x03, 0x14, 0x82, 0x15, 0x8c, 0xd1, 0x8c, 0x06, 0x44, 0x8f,
-  0xb2, 0x1e, 0xff, 0x17, 0x86, 0x1f, 0x29, 0x62, 0x16, 0xbd, 0x23, 0xad,
-  0x4b, 0x03, 0x00, 0x4d, 0xbc, 0x09, 0x14, 0x0c, 0x12, 0xe7, 0x22, 0x21,
-  0x77, 0x26, 0xff, 0x1f, 0x22, 0x56, 0xe8, 0x88, 0xd0, 0xcb, 0x86, 0x77,
-  0xdd, 0xa3, 0x1e, 0xe8, 0x2d, 0x37, 0xbf, 0x2e, 0x71, 0xbb, 0xec, 0x96,
-  0xb9, 0xfe, 0x0d, 0x59, 0x1a, 0x01, 0xdd, 0x0a, 0x73, 0x16, 0xb3, 0xe2,
-  0x02, 0x60, 0xc3, 0x06, 0x5b, 0xed, 0x3a, 0x97, 0x71, 0x72, 0xf6, 0xb6,
-  0x75, 0x8a, 0x06, 0x89, 0xfd, 0x76, 0x81, 0xfe, 0x1b, 0xea, 0x74, 0x17,
-  0x0b, 0x5d, 0x47, 0x82, 0xfe, 0x08, 0xe8, 0x7c, 0xff, 0xc6, 0x04, 0x16,
-  0x04, 0xc7, 0x1b, 0xdc, 0x8a, 0xff, 0x6d, 0x54, 0x1f, 0x09, 0xa1, 0x2c,
-  0x5e, 0xd8, 0x5d, 0x7e, 0x88, 0xcd, 0xe8, 0x92, 0x16, 0xe9, 0xd1, 0xba,
-  0x0e, 0xbb, 0xd7, 0x3d, 0x61, 0x4b, 0xe8, 0x10, 0x24, 0x72, 0x77, 0x5c,
-  0x10, 0xa0, 0x58, 0x48, 0x4c, 0xdb, 0x84, 0x05, 0x5b, 0xec, 0xcd, 0x6b,
-  0xc2, 0x6d, 0xf2, 0xe8, 0x10, 0xff, 0xba, 0x68, 0x21, 0x59, 0xe7, 0x37,
-  0x67, 0x08, 0x17, 0xa5, 0xf2, 0xbb, 0xe2, 0xa1, 0xf0, 0xbb, 0xa3, 0x66,
-  0x56, 0x60, 0xff, 0x20, 0xe8, 0xd4, 0xad, 0xe8, 0x99, 0xf9, 0x1a, 0x73,
-  0x0c, 0xb6, 0x7f, 0xb8, 0xde, 0xbb, 0xb9, 0xdc, 0xbb, 0x0a, 0xd6, 0x05,
-  0x20, 0x6a, 0x23, 0xdf, 0xa0, 0x50, 0xa1, 0xf4, 0xbb, 0xfb, 0xe8, 0x19,
-  0x00, 0xa3, 0xe4, 0x2d, 0x5b, 0x14, 0xa3, 0xb6, 0xe0, 0x02, 0xf0, 0xd9,
-  0x08, 0xde, 0x65, 0xe2, 0x6b, 0x3f, 0xb0, 0xdc, 0xa8, 0xd1, 0xad, 0xb5,
-  0x94, 0x06, 0xa8, 0x52, 0x6a, 0xb5, 0x4e, 0x99, 0x2b, 0xb4, 0x8e, 0xf2,
-  0xbd, 0x60, 0xe8, 0x71, 0x00, 0x05, 0xbc, 0x7a, 0x40, 0x29, 0xf2, 0x6f,
-  0x19, 0x89, 0xd1, 0x83, 0x52, 0xd4, 0xa0, 0x5f, 0xae, 0x80, 0xe2, 0xfe,
-  0x01, 0xf8, 0xd0, 0x31, 0xff, 0x40, 0x41, 0xb4, 0xe6, 0x42, 0xa2, 0xd0,
-  0x7f, 0xc2, 0xd2, 0x23, 0x82, 0xa1, 0xc0, 0x5f, 0x91, 0x2a, 0x0f, 0x95,
-  0x90, 0x5d, 0x33, 0x04, 0x53, 0x89, 0xfb, 0x3f, 0x8d, 0x66, 0xfc, 0xa1,
-  0x6a, 0x5d, 0xe4, 0x07, 0xa0, 0x9a, 0x10, 0xac, 0x91, 0x76, 0x3f, 0x01,
-  0xdf, 0xab, 0x46, 0x94, 0xca, 0x48, 0x60, 0xa9, 0xa3, 0x89, 0xc1, 0x61,
-  0x40, 0xac, 0x54, 0x1c, 0xb7, 0x34, 0xb1, 0x11, 0x2d, 0x0d, 0xba, 0x58,
-  0x37, 0x33, 0x04, 0xdb, 0x4e, 0x63, 0xda, 0x42, 0xcb, 0xa2, 0x36, 0x38,
-  0x20, 0x82, 0x9b, 0x8b, 0xf7, 0x3c, 0xea, 0x09, 0x74, 0xf9, 0xb6, 0x68,
-  0x49, 0xb4, 0x95, 0x2c, 0x11, 0x22, 0x12, 0x7b, 0xe9, 0x76, 0xfc, 0x3a,
-  0x5d, 0x09, 0x75, 0x82, 0x3b, 0xfd, 0x82, 0x12, 0x46, 0x75, 0x50, 0x09,
-  0x1a, 0x14, 0xb7, 0x2b, 0xb0, 0x01, 0x05, 0xad, 0xfe, 0x24, 0xe2, 0xeb,
-  0xe3, 0x3c, 0x01, 0xe4, 0x86, 0x5c, 0xd1, 0x58, 0xaa, 0x87, 0x96, 0xfe,
-  0xd7, 0xac, 0x1b, 0x5b, 0x4c, 0x41, 0x76, 0x42, 0x48, 0x46, 0x35, 0x6f,
-  0xbd, 0x6b, 0xa6, 0xe9, 0x56, 0xae, 0xcf, 0x5b, 0xba, 0x28, 0x11, 0xd8,
-  0x1b, 0x64, 0x74, 0xd3, 0x6f, 0x4d, 0x5c, 0x75, 0x13, 0x23, 0x1b, 0x10,
-  0x4a, 0xe5, 0xdd, 0x59, 0x07, 0x46, 0xbe, 0x06, 0xfe, 0x5c, 0x74, 0x9a,
-  0xeb, 0xde, 0x23, 0x53, 0x6d, 0x93, 0x23, 0x97, 0x09, 0xeb, 0xd5, 0x60,
-  0x1a, 0xe0, 0xeb, 0xe9, 0x05, 0xfc, 0xb9, 0x13, 0x0c, 0xb6, 0x33, 0xdf,
-  0x69, 0xe2, 0x74, 0xef, 0xd1, 0xc7, 0x6e, 0xec, 0x88, 0x27, 0xb7, 0xab,
-  0xd6, 0x88, 0x00, 0xeb, 0x39, 0x68, 0x69, 0x37, 0xbe, 0x3b, 0x41, 0x5a,
-  0xf4, 0xed, 0xe9, 0x2c, 0x59, 0xa1, 0x28, 0x7d, 0xe4, 0x8b, 0xbd, 0x63,
-  0xe9, 0x01, 0x05, 0x6c, 0x5f, 0xa0, 0x1c, 0x11, 0xbf, 0x7a, 0x52, 0x50,
-  0xff, 0xcc, 0xeb, 0x06, 0x57, 0x56, 0x49, 0x44, 0x45, 0x8b, 0x4f, 0xad,
-  0x84, 0x68, 0xcb, 0x5b, 0x8b, 0x1e, 0x13, 0x68, 0x32, 0x5a, 0x67, 0xcb,
-  0x2a, 0xdf, 0x40, 0xd9, 0x81, 0xc3, 0x27, 0x8a, 0x7b, 0x9a, 0xf0, 0xe8,
-  0x0d, 0xbf, 0x56, 0xa3, 0xfa, 0x55, 0x8b, 0xec, 0xc5, 0xb7, 0x83, 0x9c,
-  0x8f, 0xd1, 0x47, 0x12, 0x0b, 0xb5, 0x4f, 0x5b, 0x40, 0x57, 0x1b, 0xf5,
-  0x77, 0x02, 0x0e, 0xa9, 0xde, 0x5b, 0x10, 0x08, 0x6e, 0x02, 0x0e, 0x8f,
-  0x86, 0x84, 0xdd, 0x47, 0x10, 0x40, 0x1f, 0x8d, 0x5d, 0x53, 0x83, 0x53,
-  0x99, 0x80, 0xb4, 0x03, 0x77, 0x6b, 0x26, 0x8a, 0x5b, 0x28, 0x8b, 0x2c,
-  0x8b, 0xb2, 0x8b, 0xab, 0xe1, 0x76, 0x08, 0x8e, 0x22, 0xfe, 0x8b, 0x5f,
-  0x02, 0x1f, 0xcb, 0xcd, 0x34, 0x24, 0x1a, 0xf3, 0xdf, 0x02, 0x02, 0xc3,
-  0xcc, 0x90, 0xe5, 0xc3, 0xcd, 0x04, 0x96, 0x05, 0x06, 0x59, 0x07, 0x65,
-  0x08, 0x96, 0x09, 0x0a, 0x59, 0x0b, 0x65, 0x0c, 0x96, 0x0d, 0x0e, 0x59,
-  0x0f, 0x65, 0x10, 0x96, 0x11, 0x12, 0x59, 0x13, 0x65, 0x14, 0x96, 0x15,
-  0x16, 0x59, 0x17, 0x65, 0x18, 0x96, 0x19, 0x1a, 0x59, 0x1b, 0x65, 0x1c,
-  0x96, 0x1d, 0x1e, 0x59, 0x1f, 0x65, 0x20, 0x96, 0x21, 0x22, 0x59, 0x23,
-  0x6d, 0x24, 0xf2, 0xc4, 0x8e, 0x02, 0x56, 0x1e, 0xed, 0xcd, 0x27, 0x0b,
-  0xb6, 0x28, 0x02, 0x29, 0x59, 0x2a, 0x65, 0x2b, 0x96, 0x2c, 0x2d, 0x59,
-  0x2e, 0x65, 0x2f, 0x96, 0x30, 0x31, 0x59, 0x32, 0x65, 0x33, 0x96, 0x34,
-  0x35, 0x59, 0x36, 0x65, 0x37, 0x96, 0x38, 0x39, 0x59, 0x3a, 0x65, 0x3b,
-  0x96, 0x3c, 0x3d, 0x59, 0x3e, 0x65, 0x3f, 0x96, 0x40, 0x41, 0x59, 0x42,
-  0x65, 0x43, 0x96, 0x44, 0x45, 0x59, 0x46, 0x65, 0x47, 0x96, 0x48, 0x49,
-  0x59, 0x4a, 0x65, 0x4b, 0x96, 0x4c, 0x4d, 0x59, 0x4e, 0x65, 0x4f, 0x96,
-  0x50, 0x51, 0x59, 0x52, 0x65, 0x53, 0x96, 0x54, 0x55, 0x59, 0x56, 0x65,
-  0x57, 0x96, 0x58, 0x59, 0x59, 0x5a, 0x65, 0x5b, 0x96, 0x5c, 0x5d, 0x59,
-  0x5e, 0x65, 0x5f, 0x96, 0x60, 0x61, 0x59, 0x62, 0x65, 0x63, 0x96, 0x64,
-  0x65, 0x59, 0x66, 0x65, 0x67, 0x96, 0x68, 0x69, 0x59, 0x6a, 0x65, 0x6b,
-  0x96, 0x6c, 0x6d, 0x59, 0x6e, 0x65, 0x6f, 0x96, 0x70, 0x71, 0x59, 0x72,
-  0x65, 0x73, 0x96, 0x74, 0x75, 0x59, 0x76, 0x65, 0x77, 0x96, 0x78, 0x79,
-  0x59, 0x7a, 0x65, 0x7b, 0x96, 0x7c, 0x7d, 0x59, 0x7e, 0x65, 0x7f, 0x96,
-  0x80, 0x81, 0x59, 0x82, 0x65, 0x83, 0x96, 0x84, 0x85, 0x59, 0x86, 0x65,
-  0x87, 0x96, 0x88, 0x89, 0x59, 0x8a, 0x65, 0x8b, 0x96, 0x8c, 0x8d, 0x59,
-  0x8e, 0x65, 0x8f, 0x96, 0x90, 0x91, 0x59, 0x92, 0x65, 0x93, 0x96, 0x94,
-  0x95, 0x59, 0x96, 0x65, 0x97, 0x96, 0x98, 0x99, 0x59, 0x9a, 0x65, 0x9b,
-  0x96, 0x9c, 0x9d, 0x59, 0x9e, 0x65, 0x9f, 0x96, 0xa0, 0xa1, 0x59, 0xa2,
-  0x65, 0xa3, 0x96, 0xa4, 0xa5, 0x59, 0xa6, 0x65, 0xa7, 0x96, 0xa8, 0xa9,
-  0x59, 0xaa, 0x65, 0xab, 0x96, 0xac, 0xad, 0x59, 0xae, 0x65, 0xaf, 0x96,
-  0xb0, 0xb1, 0x59, 0xb2, 0x65, 0xb3, 0x96, 0xb4, 0xb5, 0x59, 0xb6, 0x65,
-  0xb7, 0x96, 0xb8, 0xb9, 0x59, 0xba, 0x65, 0xbb, 0x96, 0xbc, 0xbd, 0x59,
-  0xbe, 0x65, 0xbf, 0x96, 0xc0, 0xc1, 0x59, 0xc2, 0x65, 0xc3, 0x96, 0xc4,
-  0xc5, 0x59, 0xc6, 0x65, 0xc7, 0x96, 0xc8, 0xc9, 0x59, 0xca, 0x65, 0xcb,
-  0x96, 0xcc, 0xcd, 0x59, 0xce, 0x65, 0xcf, 0x96, 0xd0, 0xd1, 0x59, 0xd2,
-  0x65, 0xd3, 0x96, 0xd4, 0xd5, 0x59, 0xd6, 0x65, 0xd7, 0x96, 0xd8, 0xd9,
-  0x59, 0xda, 0x65, 0xdb, 0x96, 0xdc, 0xdd, 0x59, 0xde, 0x65, 0xdf, 0x96,
-  0xe0, 0xe1, 0x59, 0xe2, 0x65, 0xe3, 0x96, 0xe4, 0xe5, 0x59, 0xe6, 0x65,
-  0xe7, 0x96, 0xe8, 0xe9, 0x59, 0xea, 0x65, 0xeb, 0x96, 0xec, 0xed, 0x59,
-  0xee, 0x65, 0xef, 0x96, 0xf0, 0xf1, 0x59, 0xf2, 0x65, 0xf3, 0x96, 0xf4,
-  0xf5, 0x59, 0xf6, 0x65, 0xf7, 0x96, 0xf8, 0xf9, 0x59, 0xfa, 0x65, 0xfb,
-  0x96, 0xfc, 0xfd, 0x59, 0xfe, 0x65, 0xff, 0xf6, 0x25, 0x73, 0x03, 0x9d,
-  0x18, 0xdd, 0x9d, 0x1e, 0x26, 0x61, 0x09, 0xed, 0xb8, 0xe6, 0xe3, 0xea,
-  0xb8, 0xe8, 0xbb, 0xc5, 0xbb, 0x45, 0xd4, 0x3c, 0x23, 0x2e, 0xb7, 0xfa,
-  0xbb, 0xda, 0x06, 0x22, 0x93, 0xfe, 0xfc, 0x8a, 0x84, 0xfd, 0xbb, 0x24,
-  0x01, 0x04, 0x36, 0x02, 0x80, 0x7f, 0x02, 0xda, 0x76, 0x0c, 0x25, 0x61,
-  0xab, 0x5e, 0x61, 0xde, 0x05, 0x95, 0xc7, 0x5e, 0xb6, 0xac, 0x2a, 0x36,
-  0x36, 0x76, 0x16, 0x32, 0xa2, 0xb6, 0xa1, 0x94, 0xd0, 0x34, 0x46, 0xc2,
-  0xae, 0x84, 0xfc, 0x07, 0x88, 0xc4, 0x8a, 0x57, 0x01, 0x1a, 0xd0, 0x88,
-  0x6f, 0x40, 0xf6, 0xc4, 0xff, 0x74, 0xe8, 0x0c, 0x81, 0x3e, 0xde, 0xaa,
-  0xa4, 0x03, 0x74, 0xbb, 0x0e, 0x98, 0x03, 0xef, 0xe9, 0x88, 0xf3, 0x74,
-  0x67, 0x6f, 0x1e, 0x24, 0x33, 0x0e, 0xe3, 0x74, 0x08, 0x27, 0x62, 0x02,
-  0xc5, 0xf0, 0x6e, 0x60, 0xf8, 0x51, 0xa5, 0x53, 0x12, 0x93, 0x80, 0x03,
-  0xb0, 0x41, 0x78, 0x57, 0xb2, 0x4f, 0x40, 0x5d, 0xbc, 0x42, 0xd2, 0x3d,
-  0xea, 0xf5, 0xea, 0x3d, 0x05, 0x50, 0xb1, 0x32, 0x9e, 0xd0, 0xee, 0x42,
-  0x8c, 0xe0, 0x72, 0x3b, 0x81, 0x51, 0x95, 0x4e, 0xf3, 0xa8, 0xb7, 0x70,
-  0x4f, 0x76, 0x89, 0x3d, 0xce, 0x73, 0xa6, 0x4f, 0x51, 0x2b, 0x2e, 0xa7,
-  0x3c, 0x80, 0x20, 0x68, 0x53, 0x61, 0x21, 0x36, 0x68, 0x2f, 0x7b, 0x1e,
-  0x68, 0x29, 0xd6, 0xbd, 0xb4, 0xcb, 0x19, 0xc6, 0x20, 0x14, 0xf6, 0x06,
-  0xf7, 0xd1, 0xbe, 0xad, 0xe1, 0x38, 0x6f, 0x36, 0xa4, 0x4f, 0xeb, 0xb5,
-  0xcb, 0x1b, 0xf6, 0x07, 0xa3, 0x0e, 0xdb, 0xeb, 0x08, 0x4c, 0x5a, 0x7a,
-  0xef, 0x4a, 0x39, 0xf9, 0x72, 0x0f, 0x47, 0x2f, 0x5d, 0xf3, 0x44, 0xf4,
-  0x8a, 0x03, 0x86, 0x7a, 0x52, 0x4c, 0xed, 0x3b, 0x0e, 0x1f, 0x81, 0x77,
-  0xda, 0x7e, 0x74, 0x04, 0xeb, 0x9b, 0x89, 0xed, 0x0a, 0xeb, 0xf5, 0xd9,
-  0x60, 0xd2, 0x06, 0xa6, 0x96, 0xe8, 0x01, 0xe9, 0x74, 0x6c, 0x17, 0xeb,
-  0x9c, 0x33, 0x2c, 0x11, 0xa2, 0x55, 0xd9, 0x5c, 0xf6, 0xea, 0x34, 0xb7,
-  0xad, 0x08, 0x8b, 0xfe, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x43, 0xd6,
-  0x4c, 0x3b, 0xdd, 0x02, 0x14, 0x0c, 0x20, 0x35, 0x2e, 0xb6, 0xc0, 0x04,
-  0x12, 0x43, 0x51, 0x67, 0xc9, 0x75, 0xbd, 0x15, 0x92, 0xd5, 0x1b, 0x09,
-  0x42, 0x23, 0xdf, 0x5b, 0x75, 0xf3, 0xec, 0xeb, 0x50, 0xeb, 0x50, 0x0e,
-  0x28, 0x40, 0x39, 0x13, 0x3b, 0xc3, 0x12, 0xa4, 0xbf, 0xf7, 0x76, 0xb7,
-  0xc7, 0xed, 0xe8, 0xf8, 0xc5, 0x75, 0x93, 0x3b, 0xd8, 0x5b, 0x73, 0x09,
-  0x8d, 0x99, 0x0e, 0x34, 0x05, 0x46, 0x0e, 0xb4, 0xc1, 0x38, 0xb5, 0xda,
-  0xd5, 0xf5, 0xff, 0xed, 0x09, 0x45, 0x61, 0xb6, 0x65, 0xec, 0xe0, 0x75,
-  0x3a, 0xbb, 0x5d, 0xa3, 0x8e, 0x06, 0x5b, 0xba, 0x31, 0x8b, 0xf6, 0x73,
-  0x6a, 0x07, 0x26, 0xbf, 0x83, 0xfe, 0xf5, 0x44, 0xa0, 0x42, 0xda, 0x86,
-  0x26, 0x3e, 0xb4, 0x43, 0xe5, 0x05, 0x6c, 0x2e, 0x42, 0x2c, 0xbb, 0xf1,
-  0x2e, 0xc3, 0x29, 0xf0, 0x05, 0xf8, 0x14, 0x74, 0x32, 0x42, 0x12, 0xcb,
-  0x85, 0xf3, 0x17, 0x9d, 0x84, 0x70, 0x94, 0x50, 0xc2, 0xe2, 0x61, 0x64,
-  0x2a, 0x61, 0xb6, 0x00, 0xfe, 0x11, 0xcf, 0xda, 0x39, 0xa3, 0x5a, 0xa2,
-  0x6f, 0xd4, 0x0e, 0xf8, 0xbb, 0x30, 0xf6, 0xc9, 0x8d, 0x45, 0x02, 0x46,
-  0xfe, 0x0c, 0x75, 0x14, 0xa3, 0xea, 0xbb, 0x00, 0x39, 0x43, 0xc3, 0x20,
-  0x56, 0x74, 0xc4, 0x4a, 0x56, 0x3d, 0xc3, 0x47, 0x63, 0x5b, 0x1d, 0x0e,
-  0x26, 0x06, 0xdc, 0xc1, 0x46, 0xb1, 0x7b, 0x43, 0x37, 0x06, 0xf5, 0xeb,
-  0xd3, 0x04, 0x6f, 0xd0, 0x9a, 0xfe, 0xeb, 0xfb, 0xa5, 0xe8, 0x32, 0x06,
-  0xa1, 0x42, 0x5d, 0x64, 0x08, 0xde, 0xa1, 0xf8, 0x06, 0x05, 0xd5, 0x55,
-  0x68, 0xcc, 0x57, 0xc6, 0x56, 0x02, 0xdb, 0xcf, 0x79, 0x09, 0xe3, 0xf8,
-  0xf0, 0x87, 0xb7, 0x47, 0x9f, 0xa8, 0x09, 0x84, 0x76, 0x30, 0xe7, 0x9f,
-  0x8f, 0xce, 0xe8, 0xe9, 0x34, 0x00, 0x1f, 0x4f, 0xd1, 0x81, 0xff, 0xc7,
-  0xfc, 0xbb, 0x29, 0xc1, 0xb0, 0x01, 0x41, 0xf2, 0x47, 0x57, 0x1e, 0x07,
-  0xa0, 0x7a, 0x4d, 0xb9, 0xb5, 0x8b, 0xb6, 0x22, 0xbf, 0x18, 0xed, 0xa3,
-  0xfa, 0x02, 0x1a, 0xc4, 0xd6, 0xe2, 0x1a, 0x48, 0x44, 0x14, 0x17, 0x42,
-  0x76, 0x43, 0x3d, 0xfe, 0x04, 0xfa, 0x3e, 0x3d, 0xfd, 0xff, 0xa9, 0x4c,
-  0x7f, 0xce, 0xff, 0xe9, 0xae, 0x00, 0x3d, 0xb6, 0xfc, 0x0a, 0x24, 0x97,
-  0xbb, 0xff, 0xba, 0xa2, 0x9f, 0x8d, 0xb1, 0x6d, 0xfb, 0xa1, 0xb2, 0x08,
-  0xfc, 0xcb, 0xe0, 0x98, 0x46, 0xa8, 0xda, 0x06, 0x45, 0xa2, 0x19, 0xbe,
-  0x3e, 0x0d, 0xe9, 0x85, 0x23, 0x6b, 0x54, 0x0e, 0x53, 0xa9, 0x88, 0x6a,
-  0x1e, 0x55, 0xcd, 0x6e, 0x9e, 0xb4, 0x63, 0x03, 0x04, 0xbe, 0x73, 0x02,
-  0x33, 0xff, 0x85, 0xdf, 0x40, 0x02, 0x8b, 0xf7, 0x1f, 0x1d, 0x6a, 0xfa,
-  0x70, 0x0a, 0x7f, 0xbc, 0x59, 0xe8, 0x73, 0xff, 0xb6, 0x8e, 0xf5, 0x83,
-  0x26, 0x5e, 0xb3, 0x06, 0x45, 0x16, 0x33, 0xed, 0x8e, 0xc6, 0x0f, 0x97,
-  0x3f, 0x12, 0x26, 0x4d, 0x6c, 0x26, 0x4d, 0x48, 0xf6, 0x53, 0xd4, 0x70,
-  0x34, 0xff, 0x43, 0xb1, 0x78, 0xe6, 0x38, 0x3e, 0x8d, 0x52, 0x7b, 0x54,
-  0x5f, 0x76, 0x65, 0xbb, 0xa4, 0xaa, 0xdb, 0x92, 0xba, 0x05, 0x45, 0x56,
-  0x52, 0xa3, 0xa6, 0x40, 0x2e, 0x3d, 0x46, 0xfd, 0xe1, 0x64, 0xbd, 0xd5,
-  0xe5, 0x5d, 0x1f, 0xcd, 0xd2, 0xdd, 0x09, 0x8f, 0xff, 0x3d, 0x81, 0x82,
-  0x72, 0x08, 0x3d, 0x9a, 0xfc, 0x82, 0x77, 0x03, 0x2d, 0x21, 0x00, 0x11,
-  0xb6, 0x29, 0xa4, 0xb0, 0xf1, 0x17, 0xe9, 0x58, 0x49, 0xad, 0xf4, 0x9a,
-  0x00, 0x50, 0x01, 0xc8, 0xf3, 0xba, 0x27, 0x7a, 0x2d, 0xaa, 0xe8, 0x7c,
-  0xe8, 0x8c, 0x67, 0x0c, 0xfb, 0xb6, 0xc5, 0xd6, 0xdd, 0x26, 0xb2, 0xfb,
-  0x40, 0x6d, 0xc4, 0x3d, 0x15, 0xbb, 0x33, 0xe8, 0xa8, 0x09, 0x1e, 0x09,
-  0x75, 0xe9, 0x2e, 0xc7, 0x16, 0x4a, 0xc5, 0xe3, 0xd1, 0x6b, 0xdf, 0x45,
-  0xdf, 0x41, 0x74, 0xd9, 0xb8, 0x92, 0x4b, 0x0b, 0xa2, 0xf4, 0x08, 0xe6,
-  0xc5, 0xcd, 0x6e, 0x96, 0x59, 0xe9, 0x00, 0x16, 0x12, 0x76, 0x80, 0x96,
-  0x54, 0x2b, 0xd6, 0x05, 0x08, 0xc1, 0x78, 0x5d, 0x42, 0xb6, 0x41, 0x0a,
-  0x16, 0x9a, 0x3c, 0x02, 0xdd, 0xf2, 0x46, 0x7e, 0x45, 0xc0, 0x6a, 0x85,
-  0x29, 0xf0, 0xfb, 0xe8, 0x31, 0xe9, 0x03, 0xd5, 0x7f, 0x7e, 0x8b, 0x4e,
-  0x7e, 0x29, 0xf9, 0x3b, 0xf5, 0x4e, 0x78, 0x76, 0x11, 0x4d, 0xea, 0xe1,
-  0x8a, 0xf3, 0xbb, 0x9c, 0x10, 0xf4, 0x53, 0xf8, 0x71, 0xeb, 0x5b, 0x8d,
-  0x14, 0xb6, 0x20, 0xfa, 0xd7, 0xb7, 0x04, 0xcb, 0x01, 0xfe, 0xcf, 0xe8,
-  0xca, 0xe8, 0x80, 0x7d, 0xff, 0xd8, 0x77, 0x04, 0xdc, 0x26, 0x5c, 0x47,
-  0x5a, 0x96, 0xdb, 0x59, 0xf2, 0x44, 0x6e, 0x8b, 0xac, 0xdb, 0xb3, 0xe8,
-  0x0c, 0x7a, 0xd1, 0x8d, 0x56, 0x28, 0xe4, 0x5d, 0x1f, 0xd3, 0x04, 0x8d,
-  0xb8, 0x75, 0x1b, 0x40, 0xfc, 0xb0, 0xfa, 0xb5, 0xf2, 0xf2, 0xfa, 0x62,
-  0xdd, 0x33, 0x7e, 0x7e, 0xb0, 0x8a, 0x3b, 0xbd, 0x6f, 0x47, 0xe9, 0x6c,
-  0x32, 0xb8, 0x02, 0x71, 0x0b, 0x70, 0xd3, 0xba, 0xb8, 0x00, 0xce, 0x00,
-  0x51, 0xb2, 0x7f, 0x46, 0xcc, 0xab, 0xb0, 0xa2, 0xd0, 0x3e, 0x2a, 0x50,
-  0x85, 0xf2, 0x8a, 0x1f, 0x6a, 0xb5, 0xc9, 0xd1, 0x54, 0xab, 0x87, 0x8d,
-  0xbd, 0x39, 0xc8, 0x72, 0x5f, 0x75, 0x91, 0xdf, 0xaa, 0x23, 0x5f, 0x92,
-  0x0a, 0x83, 0xf9, 0x06, 0x02, 0x71, 0x88, 0x25, 0x03, 0x56, 0x11, 0xfa,
-  0x77, 0x4a, 0x8b, 0x55, 0x5f, 0x90, 0x5d, 0x06, 0x39, 0xd1, 0xe0, 0x76,
-  0x51, 0x89, 0x96, 0x63, 0x10, 0x95, 0x38, 0xd9, 0x14, 0x4d, 0x89, 0x7e,
-  0x29, 0xc8, 0xff, 0x45, 0x0c, 0xbe, 0xbe, 0x59, 0x8d, 0x8f, 0xab, 0x01,
-  0x37, 0x54, 0xc2, 0xdf, 0xda, 0xc5, 0x7f, 0xdf, 0xff, 0x0f, 0x89, 0x7c,
-  0x02, 0x6b, 0x41, 0x6a, 0x50, 0x6b, 0x43, 0x91, 0x47, 0x9e, 0x0d, 0x11,
-  0xe0, 0x80, 0x0f, 0x01, 0x78, 0x18, 0x5e, 0x8d, 0xd6, 0xbd, 0xfe, 0x75,
-  0x70, 0xe7, 0xa4, 0xb2, 0xdb, 0x57, 0x14, 0x11, 0x6f, 0x52, 0xa8, 0x39,
-  0xd0, 0xb6, 0x76, 0x1e, 0xc2, 0x2d, 0xf3, 0xfb, 0x04, 0x39, 0xf3, 0x75,
-  0xa0, 0x24, 0x9b, 0x5c, 0x0a, 0x7a, 0x27, 0xde, 0xe7, 0xff, 0x4d, 0x0e,
-  0xb6, 0x03, 0x02, 0xe6, 0x5a, 0x58, 0xb6, 0x4a, 0x7c, 0xb6, 0x36, 0xb2,
-  0xa8, 0xc1, 0xf7, 0x96, 0x08, 0xd1, 0xeb, 0xab, 0xd0, 0xc5, 0x1a, 0xc1,
-  0xe1, 0x62, 0x4a, 0x05, 0x85, 0x99, 0xf0, 0xee, 0x02, 0xf6, 0x04, 0xb5,
-  0x19, 0xf5, 0xa0, 0x06, 0x35, 0xe7, 0x4c, 0x05, 0x02, 0x5e, 0x5c, 0xd3,
-  0xf6, 0x07, 0x8d, 0x60, 0xfd, 0x6e, 0x03, 0x17, 0x89, 0x14, 0x3b, 0xad,
-  0xc3, 0x24, 0x62, 0x4a, 0xd9, 0x9e, 0x5f, 0x65, 0x5d, 0x70, 0x08, 0x15,
-  0x5c, 0xee, 0x62, 0xb5, 0xf8, 0xfa, 0x8b, 0x04, 0x03, 0x15, 0x23, 0xff,
-  0x44, 0x02, 0x9f, 0xf4, 0x3d, 0x03, 0x05, 0x7f, 0x1b, 0x05, 0x3b, 0x57,
-  0x7e, 0x30, 0x7f, 0x06, 0xa9, 0x67, 0x5d, 0x0f, 0xff, 0xf0, 0x4f, 0x0c,
-  0x3b, 0x77, 0xba, 0x14, 0x08, 0x3b, 0x16, 0xc8, 0x76, 0xd6, 0x15, 0x04,
-  0xb9, 0x12, 0xb3, 0x0a, 0x0a, 0xc2, 0x0a, 0x3e, 0xb1, 0x85, 0x66, 0xd2,
-  0xa0, 0x35, 0xa8, 0xa1, 0x6b, 0x2f, 0xe0, 0xde, 0x2d, 0x1c, 0x52, 0x9b,
-  0xb7, 0x33, 0x02, 0x77, 0xb9, 0x9f, 0xe6, 0xd7, 0x0e, 0x98, 0x32, 0x36,
-  0x79, 0x0e, 0x96, 0xbc, 0x40, 0xe4, 0x76, 0x4f, 0x4d, 0x0c, 0x5f, 0x82,
-  0xfa, 0x00, 0x6b, 0xca, 0xfc, 0x40, 0x4b, 0xeb, 0x24, 0x53, 0x94, 0x28,
-  0xa5, 0x4b, 0xb7, 0xe2, 0x0a, 0x76, 0x50, 0xc4, 0x8b, 0x1c, 0x16, 0x95,
-  0xf7, 0x07, 0xa8, 0x01, 0xd6, 0x63, 0x60, 0xff, 0xb0, 0xf5, 0x07, 0x24,
-  0x5b, 0x28, 0x4a, 0xd8, 0x75, 0xeb, 0x43, 0xbe, 0x5c, 0x32, 0xeb, 0x03,
-  0xe3, 0xc8, 0x9d, 0x06, 0xdc, 0x27, 0xd5, 0x32, 0x35, 0xef, 0x9c, 0x0b,
-  0xc9, 0x68, 0x84, 0x58, 0x83, 0x12, 0x58, 0x75, 0x10, 0x1b, 0x70, 0x88,
-  0xe9, 0xa5, 0x1d, 0xc9, 0x1d, 0x73, 0xab, 0x63, 0x3b, 0x14, 0xdf, 0xeb,
-  0xc6, 0xf5, 0x45, 0x28, 0x29, 0xec, 0x61, 0x5c, 0xa6, 0x73, 0x7c, 0x02,
-  0xb7, 0xa5, 0xe9, 0x1a, 0xc0, 0xff, 0x53, 0x6b, 0x4a, 0x1c, 0x74, 0x1e,
-  0xa4, 0xb4, 0x5a, 0xff, 0x40, 0xce, 0xef, 0x46, 0x85, 0x07, 0x62, 0x7d,
-  0x54, 0xf1, 0xed, 0x25, 0x2b, 0xb6, 0x85, 0x86, 0x3d, 0xe0, 0x2c, 0x5b,
-  0x84, 0x3c, 0xed, 0x8d, 0x7c, 0x10, 0xa2, 0x04, 0x4b, 0xff, 0xc7, 0xaa,
-  0x44, 0xd6, 0xf4, 0x04, 0xcf, 0xf2, 0xf6, 0x38, 0x22, 0xeb, 0x18, 0x7c,
-  0x58, 0x63, 0x7c, 0x29, 0x76, 0xeb, 0x16, 0x05, 0xee, 0xf0, 0x89, 0xc7,
-  0x4a, 0x37, 0xad, 0x35, 0x68, 0x7e, 0x50, 0x1b, 0x30, 0x3a, 0x3e, 0xa0,
-  0xc0, 0xef, 0x6c, 0xeb, 0xbf, 0x53, 0xa1, 0x68, 0x0a, 0x28, 0xe5, 0x79,
-  0xad, 0xd5, 0x60, 0xb7, 0x12, 0xe9, 0x01, 0xd8, 0x03, 0x52, 0x01, 0xc7,
-  0x76, 0x30, 0x4f, 0x5e, 0xb5, 0x0c, 0x78, 0xdc, 0x27, 0x16, 0x01, 0xa2,
-  0xfe, 0x21, 0xe3, 0xa1, 0x03, 0xca, 0x80, 0xb5, 0xd5, 0x73, 0x42, 0xd6,
-  0x31, 0xe8, 0x28, 0x97, 0xdc, 0x2e, 0x72, 0x23, 0x35, 0x39, 0x17, 0xb0,
-  0x19, 0x1e, 0x5b, 0xc7, 0xe9, 0xef, 0xa1, 0xa2, 0x4f, 0x1d, 0x68, 0x29,
-  0x78, 0xf1, 0x17, 0x1a, 0x6f, 0xd7, 0xa8, 0x47, 0xef, 0x29, 0xc2, 0xe2,
-  0xeb, 0xdb, 0x53, 0x2c, 0xcb, 0x77, 0xa1, 0xac, 0x6c, 0xc1, 0x09, 0xad,
-  0x04, 0x60, 0x81, 0xfe, 0x65, 0x44, 0x8e, 0x3d, 0xe9, 0x6d, 0xb4, 0x56,
-  0x6a, 0x69, 0xe7, 0xdb, 0x18, 0x43, 0xf0, 0x19, 0x44, 0x03, 0x6d, 0xd9,
-  0x3b, 0xd1, 0x03, 0x73, 0x1c, 0xe7, 0x09, 0x04, 0x70, 0x64, 0x04, 0xf4,
-  0x76, 0xd4, 0x00, 0xb1, 0x1b, 0xf8, 0x2a, 0xad, 0x3b, 0xde, 0x76, 0xc9,
-  0x52, 0x12, 0x88, 0x6b, 0x3d, 0x47, 0x8a, 0x78, 0xd8, 0x77, 0xbd, 0x74,
-  0x25, 0xe1, 0x3c, 0x26, 0x71, 0x06, 0x83, 0xb0, 0x9a, 0x00, 0xae, 0x10,
-  0x09, 0xb6, 0x4e, 0xad, 0x8d, 0xd6, 0xf7, 0xc9, 0xf8, 0x39, 0xc7, 0x75,
-  0x43, 0x01, 0xa9, 0x61, 0x02, 0x4b, 0x84, 0xd0, 0x4b, 0x07, 0x42, 0x1a,
-  0x83, 0x09, 0x5a, 0x4a, 0xef, 0x0b, 0x0c, 0x01, 0x89, 0x04, 0xe5, 0xc7,
-  0x47, 0x0a, 0x01, 0xbf, 0x2f, 0xff, 0x47, 0x0c, 0xe8, 0x9e, 0x81, 0xf8,
-  0x44, 0xed, 0x72, 0xcf, 0xe1, 0xf3, 0x76, 0x05, 0x66, 0xe1, 0xb1, 0x07,
-  0x07, 0x39, 0xf0, 0xc0, 0x73, 0xb0, 0xae, 0xf9, 0x30, 0xd0, 0x3d, 0x1c,
-  0x6a, 0xbe, 0x25, 0xa7, 0x68, 0x36, 0x50, 0x43, 0x70, 0xf6, 0xeb, 0x94,
-  0xc7, 0x54, 0xae, 0x05, 0x78, 0xc4, 0xeb, 0xb0, 0xc0, 0x9c, 0xc7, 0x34,
-  0x74, 0x5a, 0x0e, 0x26, 0xe9, 0xdd, 0x28, 0x41, 0xa0, 0x73, 0x9a, 0xf2,
-  0xc3, 0x6e, 0xda, 0x2b, 0x16, 0xd1, 0x1d, 0x2b, 0x75, 0x11, 0x7d, 0xd1,
-  0xfa, 0x01, 0xd6, 0x5f, 0xdc, 0x03, 0x16, 0x40, 0xc0, 0xf8, 0x3d, 0xbd,
-  0xdf, 0x8b, 0x27, 0xb7, 0x5d, 0x3d, 0xe8, 0xd1, 0x1c, 0xf8, 0x4d, 0xb0,
-  0x5d, 0x83, 0xf7, 0xe2, 0xf7, 0x74, 0x17, 0x1e, 0xb8, 0x3d, 0x1d, 0x77,
-  0x89, 0xb4, 0x1e, 0x22, 0x02, 0x7d, 0xa1, 0x32, 0x83, 0x47, 0x2f, 0xaf,
-  0xa2, 0xf7, 0x24, 0xe8, 0xfe, 0x2c, 0x8d, 0x5e, 0xd4, 0xba, 0xd0, 0x18,
-  0x2c, 0x13, 0x03, 0x4e, 0x13, 0xe0, 0xbe, 0x4e, 0xd3, 0xa1, 0x22, 0xa0,
-  0xf6, 0x33, 0x14, 0x9a, 0x02, 0xdf, 0x03, 0x16, 0x45, 0x4d, 0x41, 0xf0,
-  0x00, 0x57, 0x4a, 0x45, 0x04, 0x4a, 0xbc, 0xd8, 0x02, 0xfe, 0x28, 0xe8,
-  0x91, 0xfc, 0x15, 0x9a, 0x02, 0xf9, 0xca, 0x0a, 0xa3, 0x7f, 0xc0, 0xb2,
-  0xac, 0x9a, 0xe4, 0x6a, 0xe3, 0x39, 0x82, 0x06, 0xd7, 0x5e, 0x78, 0x89,
-  0xca, 0x2d, 0x88, 0xa0, 0x7e, 0x3b, 0x63, 0x75, 0x1e, 0x85, 0xe8, 0x3e,
-  0x4c, 0xe1, 0xda, 0x9f, 0x0c, 0x2d, 0x9e, 0xb7, 0xf8, 0x55, 0x78, 0xff,
-  0x80, 0xd1, 0x2d, 0x28, 0xdb, 0xb8, 0x09, 0x39, 0x90, 0xee, 0xee, 0xe9,
-  0xfb, 0xa3, 0x85, 0x50, 0xc7, 0xf7, 0x6c, 0x8d, 0x4e, 0x60, 0x06, 0x5b,
-  0x62, 0x9d, 0x64, 0x4a, 0x3a, 0x05, 0x97, 0xe8, 0xe8, 0x3b, 0x03, 0x2b,
-  0xe2, 0x43, 0xbf, 0x26, 0x3e, 0xa2, 0xdc, 0x58, 0x13, 0x74, 0x1b, 0xa0,
-  0x9e, 0xe3, 0xb4, 0x05, 0x6c, 0x42, 0x68, 0xe0, 0x70, 0xf6, 0x64, 0xc1,
-  0x51, 0xf0, 0xdb, 0xca, 0x77, 0x16, 0x46, 0x83, 0xe6, 0x1b, 0x03, 0xb2,
-  0xa5, 0xee, 0x25, 0x4d, 0xac, 0x9e, 0x01, 0x6f, 0xf2, 0x2b, 0xe0, 0x89,
-  0x6d, 0x01, 0xc6, 0x13, 0xd3, 0xb5, 0x2d, 0xb2, 0x57, 0x6a, 0xdb, 0x66,
-  0x53, 0x70, 0xf7, 0x81, 0xea, 0x93, 0x00, 0x5e, 0x45, 0x68, 0xb7, 0x5c,
-  0x50, 0x49, 0x63, 0x84, 0x05, 0x38, 0xbd, 0xff, 0x16, 0xe8, 0x4f, 0x03,
-  0x3c, 0x85, 0x77, 0x02, 0xa1, 0xcb, 0x6e, 0x74, 0x42, 0xea, 0xdd, 0x06,
-  0x36, 0x60, 0x6c, 0x09, 0x6e, 0x05, 0x6b, 0x20, 0x89, 0x5c, 0x11, 0x36,
-  0x54, 0x60, 0x02, 0x56, 0xf4, 0x1c, 0xad, 0x1c, 0x15, 0x28, 0x47, 0x35,
-  0x79, 0x46, 0xf7, 0xc0, 0x6c, 0xb6, 0xb2, 0xf5, 0x1b, 0xdd, 0x72, 0x27,
-  0x58, 0x75, 0x0c, 0x40, 0x2b, 0xd2, 0x8f, 0xb1, 0x35, 0xee, 0xd6, 0xbc,
-  0x45, 0x0e, 0x6c, 0x7d, 0x66, 0xc7, 0x83, 0x3b, 0x2f, 0xf3, 0xb1, 0xed,
-  0x5a, 0xc7, 0xc7, 0xde, 0xc6, 0xe8, 0xdb, 0xed, 0x20, 0x34, 0x10, 0x4d,
-  0xf1, 0x63, 0x1d, 0x46, 0x76, 0xc5, 0xe8, 0x66, 0x2c, 0x92, 0x64, 0x41,
-  0xa1, 0xc6, 0x98, 0x80, 0x86, 0xeb, 0xd1, 0xb3, 0x44, 0xa1, 0x80, 0x85,
-  0xad, 0xc1, 0x3e, 0x14, 0x88, 0x16, 0x23, 0xba, 0x62, 0x70, 0x3a, 0x01,
-  0x0d, 0xd8, 0x07, 0x66, 0x8f, 0x09, 0x6f, 0x48, 0x66, 0x98, 0x4b, 0x0b,
-  0x81, 0x6a, 0x06, 0x58, 0xdc, 0x68, 0x12, 0xd8, 0x96, 0x70, 0x3a, 0xce,
-  0x37, 0x2a, 0x3f, 0x24, 0x49, 0xed, 0x6d, 0x10, 0x6a, 0x4e, 0x4b, 0x16,
-  0x02, 0xdf, 0x61, 0x4b, 0x7b, 0x72, 0x52, 0x0d, 0x82, 0x0d, 0xaa, 0xa3,
-  0x7a, 0x7a, 0x42, 0x81, 0x86, 0x08, 0x16, 0xea, 0xbf, 0x25, 0x23, 0xed,
-  0xe2, 0xe8, 0x82, 0xf4, 0x18, 0xc8, 0x11, 0xd7, 0xa6, 0x11, 0x8c, 0x62,
-  0xba, 0xa5, 0x5b, 0x1a, 0x0e, 0x3a, 0x70, 0x46, 0x7a, 0x76, 0xef, 0x9a,
-  0x07, 0xd9, 0x59, 0x78, 0x5d, 0xf5, 0xfc, 0x76, 0x3e, 0xf4, 0xfd, 0x1b,
-  0x7d, 0xe8, 0x54, 0x64, 0x2d, 0xe6, 0xf3, 0x00, 0x97, 0x9b, 0xe0, 0xec,
-  0x37, 0xe8, 0x6e, 0x07, 0x70, 0x79, 0x28, 0x7b, 0x81, 0x46, 0xc6, 0xad,
-  0xb9, 0x5a, 0x0d, 0xd2, 0xe8, 0xda, 0x93, 0xf5, 0x45, 0xb9, 0x27, 0xa2,
-  0x0f, 0x0d, 0xea, 0xc3, 0xa0, 0x02, 0xd3, 0x7f, 0x8a, 0x56, 0x7e, 0x57,
-  0x30, 0xf6, 0x56, 0x2c, 0x5c, 0x4b, 0x1b, 0xed, 0xbf, 0x50, 0x89, 0x74,
-  0x60, 0xe3, 0xb8, 0xaa, 0x4b, 0x31, 0x6d, 0xb6, 0x47, 0xb4, 0x09, 0x10,
-  0x7c, 0x4a, 0x64, 0x15, 0x2d, 0x2d, 0x0e, 0xcd, 0x69, 0x45, 0xf0, 0x72,
-  0xe8, 0x53, 0xf5, 0xf9, 0x18, 0x4d, 0xf5, 0xf0, 0x47, 0xf5, 0x98, 0x98,
-  0x6f, 0x70, 0x62, 0xe8, 0xf3, 0x04, 0x08, 0xac, 0xd4, 0xea, 0xad, 0x1c,
-  0x28, 0xee, 0xe9, 0xd0, 0xfe, 0x86, 0x4d, 0xdb, 0x05, 0x88, 0xe7, 0x8e,
-  0x2c, 0x78, 0x6f, 0x7b, 0x5c, 0x23, 0x8b, 0xe0, 0xba, 0x51, 0xab, 0x30,
-  0x95, 0x6d, 0xa7, 0x3b, 0xec, 0xd6, 0x89, 0xf2, 0xce, 0x4f, 0xe8, 0x27,
-  0xfd, 0x46, 0x4c, 0xf7, 0xba, 0xa0, 0x4b, 0xb9, 0xd0, 0xb4, 0x2b, 0x7b,
-  0xec, 0xb6, 0x19, 0xec, 0x1f, 0x07, 0x07, 0x7d, 0xec, 0xe9, 0x6a, 0x79,
-  0x89, 0x46, 0x5f, 0xef, 0x09, 0x0c, 0x30, 0xdd, 0x0c, 0xe9, 0x6a, 0xb6,
-  0x56, 0x54, 0x0f, 0x4e, 0x00, 0xff, 0x00, 0x17, 0x97, 0xb8, 0xae, 0x80,
-  0x4b, 0x8d, 0xca, 0x14, 0xab, 0xea, 0x8b, 0xb6, 0x89, 0x16, 0x03, 0xf5,
-  0x5a, 0xc3, 0x03, 0xca, 0xee, 0xba, 0x73, 0xc2, 0xb7, 0xf7, 0x3a, 0x4f,
-  0x56, 0x03, 0xb4, 0x2d, 0x6a, 0x38, 0x25, 0xa8, 0xc0, 0xd3, 0xeb, 0xcb,
-  0x5f, 0x83, 0x70, 0x00, 0x10, 0x6a, 0x52, 0x24, 0x9c, 0x7d, 0x0b, 0x8c,
-  0xd0, 0x2b, 0x1c, 0xb2, 0x05, 0xfd, 0x44, 0xe8, 0x72, 0x9b, 0x70, 0x1b,
-  0xc0, 0x47, 0x24, 0xee, 0xa1, 0x30, 0x47, 0x68, 0x03, 0x8f, 0xca, 0x1a,
-  0x57, 0x2b, 0x4f, 0x3a, 0x05, 0xa5, 0x02, 0x89, 0x51, 0x19, 0xaa, 0xda,
-  0x96, 0xd2, 0x1a, 0x86, 0x31, 0xed, 0xd3, 0xb4, 0x4e, 0x05, 0xe0, 0xe8,
-  0x56, 0x06, 0xd7, 0x97, 0x67, 0x3f, 0x11, 0xb4, 0x4f, 0x77, 0x0f, 0x46,
-  0x06, 0x5a, 0x4c, 0xb2, 0xa1, 0xff, 0x34, 0x0a, 0xe7, 0x02, 0x39, 0x8b,
-  0x43, 0xe4, 0x55, 0xf4, 0x88, 0xbc, 0x13, 0x32, 0x44, 0x68, 0xb3, 0x14,
-  0x4a, 0x0c, 0x8d, 0xb9, 0x46, 0x4a, 0x2d, 0x06, 0x54, 0xa5, 0x12, 0x7d,
-  0x58, 0x66, 0xdb, 0x0a, 0xd8, 0xe0, 0xa1, 0x40, 0xab, 0x7e, 0x01, 0xc6,
-  0xeb, 0xf0, 0x46, 0x80, 0xd0, 0x99, 0xa3, 0x66, 0x61, 0xad, 0xfc, 0x19,
-  0xe2, 0xe8, 0x3e, 0xe0, 0xe6, 0x43, 0x15, 0x81, 0x8c, 0x81, 0xb5, 0x16,
-  0x0f, 0xc1, 0xa1, 0x5d, 0x84, 0x6a, 0xf0, 0x85, 0x43, 0xb9, 0xff, 0x9b,
-  0xd0, 0xaf, 0x23, 0xd6, 0xf5, 0xf4, 0x0a, 0x70, 0x18, 0x04, 0xda, 0xf5,
-  0xd3, 0xea, 0x81, 0x17, 0x96, 0xaa, 0xae, 0xe6, 0xb5, 0xa3, 0x27, 0xc2,
-  0xbc, 0x68, 0x38, 0x8b, 0x80, 0xd8, 0xff, 0x1d, 0x67, 0x03, 0x13, 0x22,
-  0xd4, 0xaf, 0xd7, 0x47, 0xdf, 0x1a, 0x6a, 0xd3, 0xef, 0x36, 0xb7, 0xf9,
-  0xd8, 0x1a, 0x08, 0xa1, 0x83, 0x6d, 0x0d, 0x21, 0x95, 0xf8, 0xd5, 0x8d,
-  0x16, 0xa0, 0x24, 0x50, 0x07, 0x0c, 0x77, 0x00, 0x64, 0xc7, 0xb6, 0x43,
-  0xff, 0x57, 0xe8, 0x47, 0x47, 0x35, 0x81, 0x75, 0xb3, 0x43, 0x8c, 0x94,
-  0x0b, 0x1d, 0xdd, 0x8d, 0x00, 0x6d, 0x91, 0x15, 0xb7, 0x7e, 0x04, 0x9f,
-  0x03, 0x2d, 0x51, 0xf6, 0x70, 0x17, 0xb6, 0xbe, 0x06, 0x10, 0xed, 0x3f,
-  0x01, 0x42, 0xdb, 0xb2, 0x8b, 0xdf, 0xc7, 0x81, 0xbf, 0x24, 0xeb, 0x83,
-  0xfa, 0x7e, 0x76, 0xa7, 0x17, 0x71, 0xcc, 0x3f, 0xea, 0x20, 0x5e, 0xf3,
-  0xe8, 0x6b, 0xea, 0xe6, 0x1e, 0xb8, 0xf6, 0xe9, 0x67, 0xff, 0x0d, 0xdc,
-  0x0a, 0x87, 0x0e, 0xc1, 0x42, 0xf3, 0xe8, 0xd3, 0xe8, 0x24, 0xbf, 0x14,
-  0x12, 0x20, 0x1d, 0x5e, 0x0d, 0x3e, 0x75, 0xd1, 0x01, 0x43, 0xfd, 0xdd,
-  0x21, 0x46, 0x46, 0xf0, 0x06, 0x1a, 0x06, 0x56, 0xf0, 0x14, 0xe8, 0xa4,
-  0x33, 0xa9, 0x0f, 0x5a, 0x94, 0xfe, 0x11, 0x08, 0x8d, 0x5d, 0x17, 0x16,
-  0x05, 0x20, 0x46, 0xdc, 0x80, 0x8e, 0x1f, 0x11, 0xda, 0xd2, 0x0f, 0x88,
-  0x25, 0x34, 0xd0, 0x0d, 0x2a, 0xa2, 0x88, 0x37, 0x81, 0xfe, 0xca, 0xc8,
-  0x88, 0x17, 0xa3, 0xf9, 0x9b, 0x56, 0x52, 0xf0, 0x51, 0x53, 0x06, 0x1e,
-  0xb6, 0xef, 0x8e, 0x43, 0xf8, 0x46, 0x0a, 0xa3, 0xce, 0xee, 0xb3, 0x08,
-  0xa3, 0xd0, 0x80, 0x5b, 0xfb, 0xd2, 0x03, 0xb5, 0xda, 0x4f, 0x2c, 0xc0,
-  0x8b, 0x2e, 0x72, 0xbf, 0xae, 0x8b, 0xb9, 0x6e, 0xd4, 0x0f, 0xd4, 0xd6,
-  0x4f, 0xb8, 0xf0, 0xb4, 0x29, 0x5d, 0xcc, 0xbf, 0xbe, 0xd6, 0x10, 0xd8,
-  0x20, 0x2c, 0x10, 0xee, 0x55, 0x41, 0xdb, 0x16, 0xde, 0x14, 0x26, 0x9b,
-  0xdc, 0xe4, 0x4f, 0x5f, 0x0e, 0x02, 0xf6, 0x75, 0x10, 0xbf, 0x2e, 0xd8,
-  0xc4, 0x35, 0xb6, 0x7f, 0xe0, 0x53, 0xa1, 0x8f, 0x5b, 0x06, 0xe2, 0xda,
-  0x4f, 0xbb, 0x5d, 0x16, 0x28, 0x04, 0x2a, 0x37, 0x5a, 0xb0, 0x04, 0xff,
-  0x33, 0xc9, 0xeb, 0x02, 0x32, 0xc0, 0xf8, 0x50, 0xd1, 0xb4, 0x0b, 0x68,
-  0x7f, 0x5d, 0xb4, 0x3e, 0x4f, 0x3d, 0x92, 0x06, 0x2f, 0x62, 0x1e, 0x4a,
-  0x4f, 0xe8, 0x58, 0xb4, 0x4b, 0xb7, 0x83, 0x9f, 0x5b, 0x11, 0x1b, 0x35,
-  0xe7, 0xdd, 0x58, 0x8e, 0x55, 0x8b, 0x34, 0x8e, 0x85, 0xb9, 0x4c, 0x0c,
-  0xe3, 0xd9, 0x06, 0xe0, 0x7d, 0x35, 0x9e, 0x93, 0x1f, 0xe9, 0x40, 0xc4,
-  0x7f, 0x07, 0x5d, 0x72, 0x04, 0xb4, 0x4d, 0x00, 0x77, 0x53, 0xe8, 0x3a,
-  0xe8, 0x89, 0x1f, 0xd1, 0x71, 0x59, 0x5a, 0x5a, 0x69, 0x37, 0xc1, 0xe6,
-  0x4f, 0x1c, 0x5d, 0x0f, 0x1f, 0x00, 0xc8, 0x36, 0x98, 0x25, 0x0b, 0xe6,
-  0x29, 0xe0, 0xfa, 0x81, 0xfa, 0x50, 0x5d, 0x2e, 0x7e, 0xba, 0x92, 0xa7,
-  0x46, 0x06, 0x8e, 0x80, 0x64, 0x6f, 0x28, 0x8d, 0xeb, 0x2c, 0xd5, 0x0a,
-  0x6b, 0xca, 0x8d, 0xa3, 0xf7, 0xdc, 0x5c, 0x08, 0x20, 0xe8, 0x87, 0xc6,
-  0xec, 0x35, 0xdc, 0x03, 0x2d, 0x4b, 0x46, 0xa1, 0x0a, 0x2f, 0x81, 0x06,
-  0xef, 0x73, 0x06, 0x41, 0xfc, 0x8b, 0x70, 0x37, 0x54, 0xf8, 0xbd, 0x75,
-  0x39, 0x23, 0x98, 0x5d, 0x06, 0x5f, 0x41, 0xad, 0xfa, 0x0f, 0x00, 0xbb,
-  0x67, 0x5c, 0x8b, 0x1f, 0xa0, 0xf1, 0x71, 0xb7, 0xab, 0x25, 0x9e, 0xad,
-  0x76, 0x5b, 0x8b, 0xf3, 0xdf, 0x5d, 0x5f, 0xf3, 0x82, 0xef, 0x6e, 0x0a,
-  0x74, 0x52, 0x3d, 0xdb, 0xc3, 0x75, 0xba, 0x50, 0x4b, 0xd7, 0xeb, 0xf1,
-  0x3c, 0x2f, 0x74, 0xc3, 0x3d, 0x2a, 0x43, 0xf1, 0x41, 0x3a, 0x30, 0xd3,
-  0x96, 0xff, 0x14, 0x38, 0x3c, 0x6e, 0x70, 0x8a, 0x14, 0x83, 0xf1, 0x82,
-  0xa9, 0xdb, 0x83, 0x3f, 0x03, 0xe8, 0x88, 0x47, 0x01, 0x9a, 0x54, 0xb7,
-  0xee, 0x2c, 0x9d, 0xeb, 0xd1, 0xae, 0x2d, 0xbb, 0xa0, 0x09, 0x9c, 0x3c,
-  0xee, 0x2e, 0x74, 0x98, 0x53, 0x96, 0xdd, 0xc6, 0x00, 0x5e, 0xe9, 0x2d,
-  0xeb, 0x11, 0xe9, 0x3b, 0x94, 0x10, 0x02, 0xcd, 0x87, 0xf4, 0xba, 0x87,
-  0x1d, 0xbf, 0x61, 0xad, 0x6b, 0x9a, 0xbb, 0x06, 0x84, 0xe9, 0x7a, 0xb5,
-  0xff, 0x0a, 0xb0, 0x38, 0xf5, 0x4a, 0x6a, 0x08, 0xb5, 0x52, 0xc8, 0xa2,
-  0x23, 0x57, 0x96, 0x38, 0xb8, 0xa1, 0x03, 0x43, 0x35, 0x8e, 0xac, 0x3b,
-  0x14, 0xe2, 0x08, 0xab, 0xa8, 0x60, 0xcb, 0xe7, 0x27, 0xc1, 0x47, 0xfb,
-  0x14, 0x36, 0x43, 0xfe, 0x33, 0x84, 0x16, 0x73, 0xa1, 0x20, 0xbc, 0x8b,
-  0xd8, 0xb4, 0x48, 0x2f, 0x63, 0x87, 0xd3, 0x72, 0x5a, 0xea, 0xb4, 0x23,
-  0x0a, 0xfc, 0x25, 0xe2, 0xd1, 0x6d, 0x02, 0x7d, 0x78, 0x06, 0x75, 0x27,
-  0x49, 0x37, 0xe7, 0x5e, 0x02, 0x07, 0x15, 0xd7, 0x66, 0xc2, 0x27, 0x57,
-  0x4a, 0x0c, 0xee, 0x5b, 0x73, 0x1f, 0xdc, 0xe8, 0x48, 0x15, 0x83, 0xf6,
-  0x1b, 0xc7, 0x5f, 0xed, 0xde, 0x1f, 0xe0, 0x1e, 0x57, 0x91, 0x8c, 0x1b,
-  0x9c, 0x5f, 0x1f, 0x28, 0x2b, 0x93, 0x9e, 0xa5, 0x53, 0xf2, 0xd7, 0x3d,
-  0x5c, 0x80, 0x26, 0x34, 0x75, 0x92, 0x07, 0x0f, 0x98, 0x3d, 0x85, 0x2f,
-  0x1e, 0xa8, 0xf0, 0x49, 0x1f, 0xb6, 0x50, 0x22, 0xcb, 0x00, 0xce, 0x77,
-  0xfe, 0x9a, 0x55, 0x44, 0xbd, 0x4d, 0x74, 0x4b, 0x3c, 0x34, 0x16, 0x03,
-  0x4d, 0xa4, 0x3a, 0x0b, 0x47, 0x75, 0xa6, 0xf8, 0xd4, 0x82, 0x57, 0xb0,
-  0x33, 0xa6, 0xd7, 0x0a, 0x42, 0xf3, 0x61, 0x01, 0x0b, 0xa2, 0x76, 0x29,
-  0x1b, 0xad, 0xc6, 0xe0, 0x0d, 0x9c, 0x62, 0x0a, 0x30, 0x1e, 0x90, 0x5b,
-  0xe4, 0x10, 0x55, 0xbc, 0x16, 0xe8, 0x40, 0xee, 0x5a, 0x2d, 0x17, 0x2e,
-  0x56, 0xfa, 0xe5, 0xe8, 0x3b, 0x02, 0x7c, 0x28, 0xe8, 0x28, 0x96, 0xd7,
-  0x0f, 0x0a, 0x3b, 0x2d, 0xe8, 0x61, 0x10, 0x2b, 0x49, 0x39, 0xf8, 0xe8,
-  0x58, 0xee, 0xe6, 0x13, 0x07, 0xa2, 0x6a, 0x91, 0xc7, 0x20, 0x7b, 0xde,
-  0x05, 0xa2, 0x9a, 0xc7, 0xe0, 0x37, 0xf4, 0x63, 0x39, 0x35, 0x97, 0x8a,
-  0x50, 0x22, 0xeb, 0x36, 0x1a, 0xff, 0xd6, 0x6e, 0x21, 0x06, 0xda, 0x50,
-  0x46, 0x1a, 0xc7, 0x68, 0x95, 0xc2, 0xf0, 0x6c, 0xd3, 0x6e, 0xf0, 0xfd,
-  0xfe, 0xf8, 0x25, 0x5a, 0x9e, 0x1b, 0x66, 0xce, 0x14, 0xbe, 0x5d, 0xe8,
-  0xfe, 0xf9, 0x81, 0xb9, 0x01, 0x07, 0xc5, 0x01, 0x24, 0xe6, 0xdf, 0xed,
-  0x5d, 0x8e, 0xd7, 0x97, 0xed, 0xeb, 0xca, 0x75, 0x1c, 0x8a, 0xb4, 0x3d,
-  0x88, 0x2c, 0xd6, 0x9d, 0x3b, 0x15, 0x0d, 0x80, 0x4b, 0xd1, 0x88, 0x66,
-  0x07, 0xee, 0x2d, 0x3a, 0xe9, 0x16, 0x0d, 0x6f, 0x86, 0x13, 0x1b, 0xd9,
-  0x8a, 0x05, 0x8b, 0xc7, 0x9a, 0x14, 0x6b, 0xeb, 0x95, 0x1c, 0x42, 0xf8,
-  0xb6, 0x12, 0x07, 0x4e, 0x03, 0x60, 0xc1, 0xa1, 0x07, 0xa3, 0x2d, 0xdb,
-  0x80, 0xf1, 0xa4, 0x25, 0xa8, 0x67, 0x9a, 0xc3, 0x08, 0xc6, 0x0c, 0x18,
-  0xe6, 0x2a, 0x4b, 0xdf, 0x08, 0x56, 0x07, 0xde, 0xeb, 0xea, 0x0c, 0xed,
-  0x58, 0x07, 0x2e, 0x0a, 0xe0, 0xe1, 0x0a, 0xc8, 0x72, 0x43, 0x64, 0x41,
-  0x08, 0xeb, 0xf1, 0x57, 0xf7, 0xc6, 0x1d, 0xa0, 0xac, 0x54, 0xa1, 0xd3,
-  0x50, 0xb0, 0x26, 0x8b, 0xf5, 0xa6, 0x1e, 0x68, 0xe3, 0x60, 0x87, 0x12,
-  0xe0, 0xc0, 0x17, 0x0a, 0x51, 0xe9, 0x0f, 0x0e, 0x9a, 0x99, 0xc7, 0x12,
-  0x75, 0xde, 0xdb, 0x74, 0x02, 0x2a, 0x58, 0x68, 0x40, 0x09, 0xe8, 0x31,
-  0xc8, 0x7a, 0x5b, 0x07, 0x0e, 0xf8, 0x62, 0x0c, 0x3f, 0xd5, 0x46, 0xf6,
-  0x01, 0x3a, 0xb9, 0x36, 0x9c, 0x07, 0xaa, 0x5d, 0x40, 0xe4, 0x58, 0x68,
-  0x3e, 0xd7, 0x7c, 0x27, 0x02, 0x03, 0x88, 0x94, 0xe8, 0x38, 0xad, 0xed,
-  0x55, 0xd4, 0x23, 0x77, 0x2d, 0xb5, 0xc8, 0x46, 0x65, 0x34, 0xa2, 0x6f,
-  0xd1, 0xc2, 0x72, 0xf2, 0xa9, 0x41, 0x8f, 0x61, 0x01, 0x16, 0x6a, 0xde,
-  0x91, 0xec, 0x07, 0xa0, 0x44, 0xf0, 0x0a, 0xa2, 0x9b, 0xea, 0xf2, 0x43,
-  0x10, 0xbb, 0x05, 0x29, 0x01, 0x04, 0x41, 0x4e, 0x81, 0xa2, 0x10, 0xc4,
-  0x60, 0xc3, 0xab, 0x22, 0x9d, 0x4c, 0x17, 0x3c, 0x42, 0x0b, 0x39, 0x76,
-  0x8a, 0x3e, 0x46, 0x77, 0x40, 0xd0, 0xf9, 0x40, 0x72, 0xa8, 0x81, 0x30,
-  0x91, 0xa2, 0x51, 0x91, 0x7d, 0x61, 0x0f, 0xb4, 0x02, 0x52, 0x87, 0xcf,
-  0x20, 0x11, 0x74, 0x39, 0x2d, 0x1a, 0x8c, 0x0f, 0x1a, 0xe1, 0x4b, 0xec,
-  0x49, 0x8c, 0xb8, 0xb5, 0x89, 0xd0, 0x2b, 0x4f, 0xdb, 0x8e, 0x42, 0x0a,
-  0x29, 0x38, 0xd6, 0x53, 0xdc, 0x74, 0x09, 0x88, 0x27, 0xc2, 0xcb, 0x18,
-  0x4a, 0x36, 0x3e, 0xf8, 0x53, 0x29, 0xd9, 0x07, 0x15, 0x8a, 0xfb, 0x1f,
-  0x30, 0xe7, 0x8a, 0x87, 0x59, 0xc0, 0x11, 0xea, 0x62, 0x0b, 0x7d, 0x85,
-  0x78, 0x42, 0x0b, 0xf3, 0x91, 0x87, 0xe3, 0x8b, 0x73, 0x2a, 0xc6, 0x55,
-  0xbb, 0x87, 0x73, 0x48, 0x4b, 0x69, 0x4b, 0xb0, 0xbf, 0x45, 0x4b, 0x39,
-  0xd9, 0x77, 0x14, 0x4d, 0xf3, 0x10, 0x15, 0x84, 0x17, 0x81, 0x35, 0x5a,
-  0x78, 0x00, 0x2d, 0xc6, 0xb7, 0x0f, 0x5c, 0xd3, 0xf8, 0xab, 0x31, 0x90,
-  0x5b, 0x62, 0xe3, 0xbb, 0x01, 0xd8, 0xc3, 0x49, 0x6e, 0x09, 0x29, 0xd9,
-  0x8b, 0x7c, 0x5e, 0x45, 0xa3, 0x25, 0x3c, 0x31, 0xc1, 0x4a, 0xb8, 0xca,
-  0xdb, 0x1e, 0x9b, 0x8d, 0x4f, 0x36, 0x32, 0xc9, 0xa0, 0x49, 0x9d, 0x88,
-  0xc7, 0x05, 0xc6, 0xac, 0x06, 0xe2, 0x69, 0x33, 0x24, 0xf5, 0x20, 0x3b,
-  0x6e, 0x68, 0x76, 0x1b, 0xce, 0xc4, 0x14, 0x96, 0x68, 0xff, 0x2b, 0x9f,
-  0x03, 0x5b, 0xb6, 0x65, 0x00, 0xbb, 0xd3, 0x77, 0x11, 0x49, 0x80, 0x67,
-  0xa7, 0x46, 0x8e, 0x4b, 0x0a, 0xf1, 0xeb, 0xbc, 0x89, 0xd9, 0x1e, 0x1a,
-  0x0a, 0xcb, 0x65, 0xc2, 0xeb, 0xdb, 0x39, 0xb2, 0x00, 0x85, 0x2f, 0xef,
-  0x5b, 0x44, 0x45, 0xff, 0x42, 0x55, 0x47, 0x5d, 0x20, 0x20, 0x46, 0x69,
-  0xf0, 0x6c, 0x65, 0x20, 0x53, 0x17, 0xe7, 0xfc, 0x20, 0x43, 0x72, 0x65,
-  0x61, 0xc2, 0x5f, 0x43, 0x46, 0x41, 0x54, 0x33, 0xff, 0x32, 0x20, 0x66,
-  0x6c, 0x61, 0x67, 0x73, 0x20, 0xfd, 0x30, 0x78, 0x25, 0x30, 0x34, 0x78,
-  0xbf, 0x0c, 0x69, 0x78, 0x65, 0x64, 0x20, 0xdb, 0x74, 0x6f, 0x0f, 0x2e,
-  0x61, 0x1f, 0x88, 0xb6, 0x64, 0x73, 0xe6, 0x2e, 0x21, 0x4f, 0x6f, 0x72,
-  0x63, 0x65, 0x22, 0xc4, 0x42, 0x5b, 0x87, 0x75, 0xf0, 0x70, 0x20, 0x42,
-  0x6f, 0x16, 0xf0, 0xdb, 0x2f, 0x66, 0x53, 0x04, 0x2b, 0x25, 0x20, 0x5a,
-  0x69, 0x08, 0x56, 0x05, 0x26, 0xec, 0x20, 0x00, 0x2b, 0x16, 0x3c, 0xbb,
-  0x29, 0x64, 0x65, 0xf6, 0x66, 0x61, 0x75, 0x6c, 0x25, 0xed, 0x70, 0x6f,
-  0x4d, 0x7f, 0x7e, 0x20, 0x69, 0x6e, 0xfb, 0x76, 0x61, 0x6c, 0x69, 0x64,
-  0x1a, 0xb6, 0x20, 0x55, 0x12, 0xfb, 0x6e, 0x67, 0x20, 0x73, 0x35, 0x3f,
-  0x36, 0x20, 0x61, 0x6e, 0x6d, 0x33, 0x31, 0xff, 0x32, 0x69, 0x73, 0x61,
-  0x62, 0x6c, 0x76, 0x40, 0x28, 0x6e, 0xdd, 0x53, 0x73, 0x70, 0xbb, 0x6a,
-  0x65, 0x29, 0x95, 0xf4, 0x52, 0x44, 0x2f, 0x90, 0x34, 0x2e, 0x31, 0xff,
-  0x00, 0x4e, 0x4f, 0x20, 0x4e, 0x41, 0x4d, 0x45, 0xb9, 0x20, 0x00, 0xed,
-  0xaa, 0x10, 0x6d, 0xac, 0x00, 0xf6, 0x0b, 0x30, 0x49, 0x0f, 0x73, 0x2f,
-  0x63, 0xdd, 0x6c, 0x75, 0xf2, 0x72, 0x73, 0x6a, 0xa1, 0x7f, 0x50, 0x42,
-  0x21, 0x3f, 0x20, 0x41, 0x82, 0x62, 0x19, 0xe3, 0xae, 0x6b, 0x46, 0xed,
-  0x52, 0x6f, 0x75, 0x66, 0x75, 0x5b, 0x72, 0xed, 0xba, 0x69, 0x6b, 0x24,
-  0x83, 0x77, 0x7a, 0x65, 0xd6, 0xe0, 0x25, 0x75, 0x85, 0xba, 0xff, 0x74,
-  0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x6d, 0x77, 0xb1, 0x69, 0x70, 0x6c,
-  0x6e, 0x17, 0x6f, 0x66, 0x67, 0x35, 0x02, 0x1b, 0xd8, 0x35, 0x31, 0x0b,
-  0x14, 0x62, 0xb6, 0x79, 0x57, 0x73, 0xd7, 0xcb, 0x5b, 0x33, 0x6b, 0xb2,
-  0x2e, 0x5a, 0x65, 0x21, 0xb3, 0x49, 0xd9, 0xbb, 0x20, 0x94, 0x20, 0x63,
-  0x75, 0x66, 0x74, 0x84, 0x1d, 0x84, 0x94, 0x9f, 0x5a, 0x61, 0x70, 0x70,
-  0x7e, 0xf7, 0x2d, 0x3e, 0xd7, 0xb3, 0x74, 0x76, 0x00, 0x28, 0x7a, 0x10,
-  0xbc, 0x7d, 0x2d, 0x27, 0x69, 0xd6, 0xf4, 0x29, 0x10, 0xc2, 0x64, 0x25,
-  0xec, 0x65, 0x2e, 0x30, 0xb0, 0x98, 0x65, 0x4d, 0x5b, 0xf7, 0x34, 0x30,
-  0x8e, 0xc2, 0x20, 0x81, 0x06, 0xce, 0x1b, 0x2e, 0xcb, 0x81, 0x65, 0x1c,
-  0x61, 0x7f, 0x2d, 0xbb, 0x69, 0x3f, 0x3f, 0x5c, 0x2d, 0x95, 0x2a, 0xbd,
-  0x63, 0xc1, 0x24, 0x70, 0x98, 0x8f, 0xde, 0x21, 0x6d, 0x12, 0xe1, 0x16,
-  0x69, 0x5b, 0x18, 0x2d, 0x91, 0x65, 0x6c, 0x26, 0x85, 0x9b, 0x61, 0x84,
-  0x29, 0x65, 0x25, 0x0f, 0x44, 0x75, 0x6d, 0xdb, 0x6d, 0x79, 0x1c, 0x74,
-  0x1a, 0xb7, 0x16, 0x98, 0x32, 0xfb, 0x1d, 0x32, 0x42, 0x2b, 0x65, 0x23,
-  0x2f, 0x41, 0xff, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x3a, 0xdb,
-  0x20, 0x45, 0x24, 0x68, 0x08, 0x9e, 0x8d, 0x61, 0x68, 0x18, 0xd1, 0x24,
-  0x86, 0x30, 0x15, 0xf0, 0xbf, 0x27, 0x31, 0x36, 0x4d, 0x42, 0x2d, 0xed,
-  0x36, 0x34, 0x6b, 0x0b, 0x85, 0x57, 0x9c, 0xc7, 0x39, 0x78, 0x3b, 0x02,
-  0xb6, 0x34, 0x70, 0x98, 0x31, 0x70, 0x89, 0x40, 0xbd, 0xde, 0x3d, 0xcf,
-  0x9f, 0x73, 0x3a, 0x62, 0x43, 0xd7, 0x09, 0x06, 0xb8, 0x6a, 0x75, 0xd0,
-  0x50, 0x2b, 0x63, 0x32, 0x61, 0x72, 0xdc, 0xdf, 0x26, 0x61, 0x4d, 0x71,
-  0x2e, 0x86, 0x2e, 0x2c, 0x76, 0x19, 0x4f, 0x70, 0xd8, 0x49, 0x6d, 0xeb,
-  0x69, 0x64, 0x58, 0x83, 0x21, 0x05, 0x3b, 0xc7, 0x20, 0x52, 0x80, 0xca,
-  0x44, 0xc6, 0x4b, 0x79, 0x31, 0x86, 0x66, 0x50, 0x30, 0xbd, 0x6e, 0x73,
-  0x38, 0x64, 0x23, 0x2d, 0x19, 0x1b, 0x94, 0x70, 0x49, 0x84, 0x8d, 0x8b,
-  0xb2, 0x35, 0x28, 0x59, 0x9e, 0x0d, 0x31, 0xe3, 0xfe, 0x75, 0x5e, 0xfc,
-  0xe6, 0x4e, 0x1b, 0x17, 0x32, 0x21, 0x1b, 0x69, 0x21, 0x60, 0xe1, 0x1b,
-  0xca, 0x9a, 0xc7, 0x32, 0x9b, 0x37, 0x37, 0x85, 0x32, 0xa5, 0x4c, 0xaf,
-  0xda, 0x65, 0x6c, 0x06, 0x20, 0x6b, 0x56, 0x73, 0x5f, 0x72, 0x6d, 0x70,
-  0x4d, 0x0a, 0x92, 0x28, 0x15, 0xd8, 0xc1, 0xaa, 0x4a, 0x6b, 0x61, 0x56,
-  0x71, 0x20, 0x4d, 0xbd, 0xef, 0x3a, 0x0a, 0x20, 0x92, 0x00, 0x96, 0x04,
-  0x32, 0xdb, 0xd2, 0x00, 0x2b, 0x03, 0xf7, 0x53, 0x6b, 0x65, 0x77, 0xe6,
-  0x32, 0x32, 0x0d, 0xcc, 0x31, 0xd7, 0xb6, 0xa9, 0xc2, 0x6d, 0xa8, 0xa7,
-  0xdf, 0xfc, 0x3a, 0x20, 0x43, 0x79, 0x6c, 0x69, 0xd7, 0x72, 0xb9, 0x3b,
-  0x55, 0x20, 0x48, 0x6d, 0x3d, 0x64, 0x9b, 0x0a, 0xd2, 0x2d, 0xcc, 0x0d,
-  0xc0, 0x06, 0x4e, 0xd5, 0x6a, 0xda, 0x06, 0x73, 0x6b, 0xe5, 0xe0, 0xc1,
-  0x18, 0xae, 0x16, 0x4f, 0x7e, 0x5f, 0x46, 0x6c, 0x6f, 0x17, 0x6d, 0x79,
-  0x5f, 0x61, 0x51, 0xf7, 0x28, 0x20, 0x68, 0x4c, 0x5d, 0x3d, 0x79, 0x63,
-  0x60, 0x11, 0xbe, 0x0b, 0x29, 0x30, 0x43, 0xdf, 0x0c, 0x5b, 0x68, 0x16,
-  0x5f, 0x44, 0x31, 0x33, 0x2e, 0x35, 0xb7, 0x5d, 0x44, 0x4f, 0x6e, 0x86,
-  0x6c, 0xb0, 0x68, 0x32, 0xd7, 0x95, 0x97, 0x01, 0x5f, 0x9a, 0x21, 0xd7,
-  0x1a, 0x22, 0x33, 0x2d, 0x59, 0x42, 0xad, 0x6c, 0x1c, 0xb3, 0xcb, 0x8a,
-  0x7c, 0xef, 0x72, 0x0c, 0x6e, 0xe0, 0x40, 0x23, 0x7d, 0x69, 0xb5, 0x66,
-  0x40, 0xab, 0x05, 0xa7, 0x5f, 0xcb, 0x58, 0xb5, 0x2e, 0xd9, 0x82, 0x4b,
-  0x33, 0x51, 0x66, 0xa3, 0xb0, 0x33, 0x6c, 0x2c, 0x27, 0xd7, 0xef, 0xb3,
-  0x68, 0xb0, 0x37, 0x67, 0xe9, 0x21, 0x21, 0x09, 0xa4, 0x64, 0x59, 0x3e,
-  0x25, 0x34, 0x6c, 0xdf, 0x0b, 0x43, 0x48, 0x53, 0x3d, 0x86, 0x5b, 0x0c,
-  0xb6, 0x3a, 0x96, 0x3a, 0xe6, 0x06, 0x21, 0xa6, 0xb6, 0xb4, 0x64, 0x75,
-  0x37, 0x6d, 0x25, 0x63, 0x3a, 0x73, 0x38, 0x2b, 0x22, 0x70, 0x62, 0x61,
-  0x81, 0x44, 0xb7, 0x08, 0x44, 0x50, 0xd8, 0x54, 0x5d, 0x5d, 0x63, 0xca,
-  0x34, 0xa1, 0x3e, 0x22, 0x5d, 0xcd, 0x30, 0xc1, 0x25, 0x78, 0x8c, 0x87,
-  0x6c, 0x35, 0x0c, 0x61, 0xcc, 0xca, 0x11, 0x58, 0x3a, 0x02, 0x14, 0xea,
-  0x6d, 0x35, 0x52, 0xa9, 0xd1, 0x03, 0xed, 0x33, 0x6f, 0xb8, 0x6d, 0xbf,
-  0x26, 0xbd, 0x0d, 0x24, 0x0b, 0x48, 0x6f, 0x08, 0xc4, 0xd8, 0x35, 0x16,
-  0x7d, 0x44, 0x4d, 0x41, 0xa0, 0x51, 0xe6, 0xbd, 0xd1, 0xa5, 0x49, 0x0e,
-  0xce, 0xca, 0x89, 0xd9, 0x39, 0xd9, 0x4c, 0x37, 0xb2, 0x4e, 0x6b, 0x50,
-  0x9c, 0x63, 0x74, 0xb0, 0xaf, 0x74, 0x65, 0x65, 0x4e, 0xb0, 0xb5, 0xe9,
-  0x53, 0x80, 0x36, 0xd6, 0x01, 0xfe, 0x45, 0x43, 0x54, 0x4f, 0x52, 0x53,
-  0xdc, 0x3f, 0x45, 0x52, 0x6f, 0xe2, 0x52, 0x41, 0x43, 0xb3, 0x4b, 0x54,
-  0x06, 0x9e, 0xc7, 0x47, 0x95, 0x33, 0x0a, 0xf2, 0x44, 0x61, 0x74, 0x61,
-  0x08, 0x41, 0x99, 0x61, 0x1b, 0xd9, 0x29, 0x4f, 0x58, 0x46, 0x0d, 0x43,
-  0x4c, 0x4d, 0x5c, 0x32, 0xb3, 0x78, 0xe9, 0x70, 0x88, 0xdb, 0xc4, 0x6c,
-  0x83, 0xd8, 0x99, 0x7b, 0x4d, 0x6f, 0x98, 0x14, 0xec, 0xb1, 0x15, 0x96,
-  0x4e, 0xdb, 0x48, 0x0e, 0x64, 0x18, 0xb1, 0x84, 0xac, 0xeb, 0x6e, 0xf1,
-  0x52, 0x7c, 0xe0, 0x72, 0x21, 0xc0, 0xe3, 0xd9, 0x70, 0x38, 0x43, 0x75,
-  0xd1, 0x17, 0x17, 0xa0, 0x5f, 0x44, 0x2e, 0x44, 0x23, 0x50, 0x6a, 0x3d,
-  0x58, 0xa0, 0x65, 0x9e, 0x1d, 0x54, 0x27, 0x64, 0xd6, 0x20, 0x56, 0x8a,
-  0xc1, 0x75, 0xce, 0xd2, 0xb1, 0x13, 0xe6, 0xd8, 0x3a, 0x04, 0xa4, 0x02,
-  0x37, 0x4e, 0xa4, 0xfd, 0xed, 0x64, 0x3e, 0xa6, 0x28, 0x08, 0xb9, 0x3d,
-  0x09, 0x8b, 0xab, 0x08, 0xc3, 0x38, 0xb7, 0x07, 0x32, 0x6c, 0x78, 0xe2,
-  0x39, 0x22, 0xad, 0x54, 0x94, 0xb7, 0x61, 0x2d, 0x79, 0x70, 0x6c, 0x53,
-  0x6b, 0x4b, 0xb7, 0x77, 0x8b, 0x6e, 0x31, 0xd9, 0x39, 0xd8, 0x66, 0x4c,
-  0xb0, 0x24, 0x09, 0x64, 0x65, 0x5c, 0x54, 0x5e, 0xc2, 0xf4, 0x93, 0x83,
-  0x67, 0x38, 0x08, 0x02, 0x2f, 0x4f, 0x0f, 0x4a, 0x78, 0x14, 0x2b, 0x94,
-  0x17, 0x7c, 0x34, 0x34, 0x30, 0x6b, 0x30, 0x04, 0xb3, 0x5c, 0x66, 0x20,
-  0x2c, 0x84, 0x1b, 0x3a, 0xc9, 0x00, 0x11, 0xec, 0x06, 0x26, 0xc5, 0xf6,
-  0x27, 0x66, 0x43, 0x89, 0x02, 0x81, 0xfb, 0xca, 0x57, 0x61, 0x73, 0x9e,
-  0x17, 0xe0, 0x7c, 0xc1, 0x8b, 0x7d, 0x06, 0x3f, 0x16, 0x45, 0x6f, 0xe8,
-  0xd5, 0x75, 0xd8, 0xdb, 0x2e, 0x40, 0x80, 0xf1, 0x4f, 0x56, 0xb1, 0x2a,
-  0x46, 0xa3, 0x32, 0xa7, 0x76, 0x54, 0x3a, 0x33, 0x57, 0x2e, 0xca, 0x20,
-  0x47, 0xd0, 0x73, 0xa9, 0x76, 0xce, 0x6e, 0x21, 0xd3, 0x83, 0x68, 0x8b,
-  0x9c, 0x02, 0x17, 0x15, 0x37, 0x32, 0xb0, 0x30, 0x21, 0x5a, 0x34, 0x1b,
-  0x2a, 0x2f, 0x31, 0x4b, 0xd6, 0x2f, 0xcd, 0x34, 0x20, 0x2f, 0x89, 0x38,
-  0x57, 0xe0, 0x73, 0xf7, 0x89, 0x5b, 0x41, 0x4d, 0xcd, 0x40, 0x70, 0x8b,
-  0x6d, 0xb7, 0x30, 0xf7, 0x3e, 0x74, 0x41, 0x84, 0x08, 0xb7, 0x4c, 0xbd,
-  0x4a, 0x81, 0x5a, 0xae, 0x51, 0x83, 0x35, 0xd1, 0xec, 0x68, 0x5f, 0x08,
-  0x1b, 0x2e, 0x60, 0x28, 0xe2, 0x31, 0xa5, 0x2f, 0x08, 0xd7, 0x63, 0x94,
-  0x2c, 0x33, 0x6b, 0x66, 0x61, 0x63, 0xc5, 0x01, 0x6f, 0x32, 0x61, 0x68,
-  0x3d, 0xec, 0x31, 0x37, 0x68, 0x70, 0xe9, 0x63, 0xd7, 0x5a, 0x89, 0x93,
-  0x86, 0x19, 0xaf, 0xd7, 0x6d, 0x46, 0xd9, 0x28, 0x1b, 0x6e, 0x1a, 0x03,
-  0x73, 0x8c, 0x9b, 0xd6, 0xfe, 0x16, 0x9c, 0x4a, 0x0d, 0xa4, 0x78, 0x18,
-  0x69, 0xa7, 0x21, 0x73, 0x61, 0x8f, 0x30, 0xd5, 0x67, 0x43, 0xae, 0xdd,
-  0x32, 0xbc, 0x75, 0x35, 0x2f, 0xc9, 0x79, 0x77, 0x61, 0xa4, 0x79, 0x27,
-  0x0e, 0x53, 0xc1, 0x4f, 0x16, 0x34, 0xd3, 0x6f, 0x1b, 0x03, 0xff, 0xb6,
-  0x77, 0x69, 0xf5, 0xb0, 0x9f, 0x9e, 0x38, 0x68, 0x3a, 0x04, 0xaf, 0xc0,
-  0x88, 0xe8, 0x12, 0xf3, 0xd9, 0x6b, 0x5b, 0xac, 0x44, 0xcd, 0xe9, 0x47,
-  0xe0, 0x75, 0x74, 0x29, 0x42, 0x7c, 0x68, 0x49, 0xd1, 0xbc, 0x32, 0x3c,
-  0x68, 0x69, 0x6e, 0x9a, 0x68, 0x73, 0x2d, 0xa9, 0x8e, 0x70, 0x2c, 0x18,
-  0xc7, 0x6d, 0x5d, 0x65, 0x79, 0xb0, 0xda, 0x5b, 0xd3, 0x69, 0xca, 0x67,
-  0x6e, 0xd0, 0xdc, 0xe9, 0x91, 0x34, 0x2c, 0x62, 0x4c, 0xd7, 0x61, 0x82,
-  0x5e, 0x78, 0x0b, 0xf8, 0x05, 0x32, 0x66, 0x0f, 0x54, 0x06, 0xd4, 0x2c,
-  0x70, 0xa5, 0x40, 0xb4, 0x63, 0x21, 0xbc, 0xac, 0x47, 0x5d, 0x05, 0xac,
-  0x3d, 0x75, 0x98, 0x29, 0x41, 0x38, 0x87, 0x28, 0x39, 0x8d, 0x29, 0x97,
-  0x6b, 0x27, 0x2f, 0x43, 0x06, 0xb5, 0x48, 0x0e, 0xe1, 0xc9, 0x7f, 0x12,
-  0x97, 0x1f, 0x55, 0x70, 0x64, 0xcf, 0x61, 0x74, 0x4e, 0xb6, 0x54, 0x3f,
-  0x45, 0xd5, 0x35, 0xed, 0xcd, 0x42, 0x75, 0x13, 0x61, 0x75, 0x3e, 0x3a,
-  0x65, 0x3f, 0xb9, 0x32, 0xe3, 0x1a, 0x19, 0xc3, 0x14, 0x71, 0x52, 0x4f,
-  0x4d, 0x68, 0x0e, 0xd1, 0x66, 0x38, 0x0e, 0xb9, 0x1b, 0x2a, 0x53, 0xe0,
-  0xbd, 0x8c, 0xea, 0x73, 0x65, 0x74, 0xb2, 0x62, 0xc4, 0xec, 0x8d, 0x5e,
-  0x2e, 0x76, 0x11, 0x6a, 0x61, 0x5d, 0x60, 0x4a, 0x90, 0x5c, 0x59, 0x99,
-  0x4d, 0x62, 0xaa, 0x3a, 0x0d, 0x77, 0xd7, 0x65, 0xa6, 0xb5, 0x0a, 0xa1,
-  0xd1, 0xf5, 0x00, 0xd8, 0x9b, 0xe9, 0x74, 0x77, 0xfb, 0x44, 0x88, 0x99,
-  0x56, 0xab, 0x86, 0x1b, 0x63, 0x59, 0xb5, 0xb1, 0xb2, 0x08, 0xd7, 0xd4,
-  0x67, 0xcd, 0x98, 0x17, 0x68, 0x24, 0xe5, 0x0b, 0x96, 0xad, 0x13, 0xfe,
-  0x8b, 0x2f, 0x04, 0x92, 0xc8, 0x02, 0x33, 0x30, 0x08, 0xe4, 0xc0, 0x76,
-  0xe9, 0x50, 0xd8, 0xf8, 0x57, 0x45, 0x41, 0x3a, 0x29, 0x53, 0x24, 0xf0,
-  0xb1, 0x64, 0x38, 0xbd, 0x63, 0xe1, 0x6b, 0x8e, 0xd9, 0xb4, 0xb2, 0x2e,
-  0x5c, 0x5d, 0xc0, 0x31, 0x38, 0x2c, 0x30, 0x56, 0xd9, 0x92, 0x6e, 0x2a,
-  0xa1, 0x21, 0x34, 0x03, 0x72, 0xea, 0xdc, 0xad, 0x67, 0x75, 0x30, 0xb2,
-  0x12, 0xee, 0x01, 0x16, 0xea, 0x22, 0x61, 0xb2, 0x74, 0x81, 0x6f, 0x1a,
-  0x9c, 0xe6, 0x2d, 0x46, 0xbd, 0x9b, 0x26, 0x5f, 0x14, 0x8a, 0x48, 0xcb,
-  0xc6, 0x25, 0x22, 0x86, 0xc8, 0x7b, 0xb7, 0x1d, 0xa8, 0x6a, 0x0f, 0xf0,
-  0x52, 0xe2, 0x07, 0x43, 0x65, 0x3c, 0xb8, 0x3a, 0x68, 0x42, 0xeb, 0x99,
-  0x68, 0x5b, 0x50, 0xc3, 0xa6, 0xf5, 0x6e, 0x75, 0x79, 0x47, 0xa9, 0x2b,
-  0xf6, 0x1b, 0x5d, 0x11, 0xac, 0x63, 0xaa, 0xb1, 0x9e, 0xd5, 0x68, 0x75,
-  0xed, 0x16, 0x20, 0x35, 0x68, 0x2f, 0x5d, 0x67, 0x62, 0x70, 0xbd, 0x9d,
-  0x28, 0x48, 0x44, 0x6e, 0x3d, 0x78, 0x78, 0x50, 0x2b, 0x8f, 0x15, 0x64,
-  0x33, 0x99, 0x44, 0x79, 0x20, 0x33, 0x36, 0x3c, 0x32, 0x35, 0x81, 0xaf,
-  0x8f, 0x76, 0x2b, 0x31, 0x30, 0x49, 0xb7, 0x45, 0x15, 0x32, 0x38, 0x91,
-  0x38, 0xb6, 0x2d, 0xb4, 0x70, 0xe6, 0xce, 0x14, 0xc6, 0x45, 0x58, 0x8e,
-  0x30, 0x0c, 0x6f, 0xb3, 0x93, 0x49, 0xb6, 0xb7, 0x29, 0x53, 0x43, 0x8d,
-  0x41, 0x48, 0x7c, 0x16, 0x61, 0x0e, 0xc0, 0xeb, 0xe3, 0x2d, 0x33, 0x55,
-  0xfb, 0x03, 0x38, 0x3f, 0xec, 0x41, 0x98, 0x37, 0x0e, 0x45, 0xd4, 0x20,
-  0x2a, 0xfa, 0x5a, 0x78, 0x2a, 0xb8, 0x50, 0x06, 0x67, 0x1b, 0x11, 0xaf,
-  0x2c, 0x0f, 0x01, 0xe3, 0x4b, 0xd3, 0xc6, 0x11, 0x82, 0x4c, 0x5b, 0x13,
-  0x00, 0x80, 0x4b, 0x26, 0x08, 0x8c, 0x89, 0xa3, 0x09, 0xef, 0x41, 0x63,
-  0x63, 0x93, 0x68, 0x61, 0x14, 0x6d, 0x1c, 0x61, 0x2d, 0xab, 0x8e, 0x4f,
-  0xc5, 0x6c, 0xa6, 0x6f, 0x34, 0x29, 0x6d, 0x06, 0xaf, 0x07, 0x47, 0x68,
-  0xb5, 0xd1, 0x55, 0xbe, 0xee, 0x4c, 0x2f, 0x30, 0x38, 0xd5, 0xfa, 0x80,
-  0xe8, 0xb6, 0x6a, 0x54, 0x95, 0xcf, 0xcc, 0x22, 0x71, 0xd6, 0xcc, 0x07,
-  0x47, 0x0b, 0xa1, 0x3a, 0x17, 0xfb, 0x6d, 0x6f, 0x6b, 0x5d, 0x6a, 0x7a,
-  0x95, 0x49, 0x92, 0x20, 0xc9, 0x49, 0x92, 0x34, 0x31, 0xcc, 0xea, 0xb7,
-  0xdb, 0x2d, 0x72, 0x06, 0xef, 0xc3, 0x6c, 0xd5, 0x31, 0xeb, 0x7b, 0x14,
-  0xd6, 0x16, 0xf3, 0x03, 0x3f, 0x08, 0x1b, 0x85, 0x48, 0xf8, 0x2f, 0x58,
-  0x50, 0x2f, 0x32, 0xe1, 0x64, 0xcd, 0xf0, 0xab, 0x75, 0x42, 0x43, 0x2a,
-  0x5e, 0xf0, 0x83, 0x24, 0xed, 0x8d, 0x0d, 0x68, 0x5f, 0xc4, 0x22, 0x4e,
-  0x7b, 0x12, 0x43, 0x59, 0x65, 0x82, 0x4c, 0x7a, 0x06, 0x2d, 0x58, 0x67,
-  0x7c, 0xa1, 0xb9, 0xb9, 0xde, 0x67, 0x6c, 0x66, 0x2d, 0x63, 0xcd, 0x3d,
-  0xb5, 0xc6, 0x4d, 0x73, 0xe1, 0x60, 0x58, 0xc3, 0x83, 0x4e, 0x42, 0x25,
-  0xb3, 0x96, 0x00, 0x9a, 0x2a, 0xb2, 0xda, 0x16, 0x18, 0x02, 0x15, 0x94,
-  0xa1, 0x36, 0x1a, 0x06, 0x31, 0xca, 0x57, 0xb9, 0x36, 0x20, 0x99, 0x36,
-  0x02, 0x6b, 0x49, 0xf2, 0xda, 0xf1, 0xe7, 0xf6, 0xea, 0xb3, 0xb1, 0x60,
-  0x57, 0x2c, 0x30, 0xae, 0x52, 0x88, 0xd0, 0x26, 0x22, 0x73, 0x12, 0x71,
-  0xed, 0x28, 0x29, 0x1b, 0x84, 0x2f, 0x09, 0x25, 0xb1, 0x0b, 0xb6, 0x66,
-  0x0a, 0x6d, 0xcc, 0x4f, 0x62, 0xb2, 0xc0, 0x78, 0x90, 0x9b, 0x7f, 0xd2,
-  0x0e, 0x78, 0xc0, 0x23, 0x0d, 0xad, 0xcd, 0x0d, 0x65, 0x76, 0xb0, 0x30,
-  0x8b, 0x7b, 0x9c, 0x63, 0x30, 0x84, 0xdf, 0xa1, 0x9f, 0xa3, 0x64, 0x59,
-  0x03, 0x4d, 0xa8, 0x41, 0x1b, 0x83, 0x67, 0x02, 0x38, 0x6b, 0x43, 0x68,
-  0x64, 0xc1, 0xac, 0x10, 0xcc, 0x56, 0xcf, 0xdd, 0x05, 0x73, 0x18, 0xbb,
-  0x1d, 0x2f, 0x4a, 0xd9, 0x99, 0x2f, 0x14, 0x98, 0x56, 0xef, 0x15, 0x6e,
-  0x2a, 0x34, 0x6b, 0x6b, 0x87, 0x54, 0x61, 0x64, 0x22, 0xd3, 0x69, 0xae,
-  0x96, 0xa5, 0x72, 0x49, 0x12, 0x81, 0x4b, 0x3b, 0x08, 0x30, 0x09, 0x7a,
-  0x6c, 0x7d, 0xb7, 0x40, 0x56, 0x56, 0xb4, 0xb5, 0x95, 0xaa, 0xe2, 0x51,
-  0x8f, 0x38, 0x9b, 0x44, 0xac, 0x46, 0x31, 0x12, 0x06, 0x92, 0x10, 0x8d,
-  0xf6, 0x2f, 0x82, 0x42, 0x1c, 0x07, 0x47, 0x0e, 0xb0, 0x27, 0xb1, 0x1d,
-  0x23, 0x31, 0x43, 0x4f, 0xb3, 0xd6, 0x68, 0x34, 0xb5, 0x02, 0x7b, 0xd9,
-  0x24, 0x0b, 0x05, 0x87, 0x8a, 0x43, 0x11, 0x9b, 0xa3, 0x6f, 0xc4, 0xe0,
-  0x29, 0xb5, 0x7a, 0x2d, 0x45, 0x57, 0x5e, 0x19, 0xfb, 0x5c, 0x77, 0x30,
-  0x41, 0x82, 0x53, 0x0b, 0x8d, 0xdf, 0x55, 0x4d, 0xa7, 0x53, 0x6d, 0x86,
-  0x21, 0x52, 0x7e, 0x13, 0x4d, 0x45, 0xd4, 0x85, 0x9a, 0x88, 0x54, 0x85,
-  0x8a, 0x8b, 0xd8, 0xf9, 0x33, 0xa7, 0x40, 0x85, 0x46, 0x22, 0xa7, 0x65,
-  0x95, 0xbc, 0x77, 0x4a, 0x32, 0xb9, 0xd0, 0x06, 0x6b, 0xf4, 0x2a, 0x5a,
-  0x48, 0x8a, 0xe1, 0x94, 0x48, 0xdb, 0xec, 0x41, 0x4c, 0x7d, 0x85, 0xe0,
-  0x70, 0x08, 0x56, 0x2a, 0x25, 0xdb, 0x31, 0x02, 0x32, 0x2c, 0x34, 0xb7,
-  0x38, 0x0b, 0x5a, 0x36, 0x03, 0x19, 0x22, 0xce, 0x78, 0x99, 0x66, 0xcb,
-  0xb5, 0xd0, 0x1d, 0xc3, 0x21, 0x08, 0xd3, 0x8d, 0xb4, 0xa4, 0x73, 0xec,
-  0x38, 0x74, 0xc3, 0xec, 0x16, 0xfe, 0x08, 0x61, 0x46, 0x83, 0x2d, 0x70,
-  0x42, 0x8b, 0xc0, 0x77, 0x7b, 0xad, 0xf4, 0x25, 0x9b, 0x27, 0x74, 0xd9,
-  0x9f, 0x2d, 0x49, 0x6b, 0xb0, 0x9e, 0x9a, 0xba, 0x35, 0xeb, 0xad, 0x72,
-  0xe4, 0x1b, 0x43, 0x2d, 0x72, 0x70, 0xdd, 0x88, 0x42, 0x29, 0x9b, 0xe9,
-  0xfd, 0xd9, 0x2b, 0x2a, 0x50, 0x91, 0x78, 0xc3, 0x76, 0xdb, 0xbd, 0xbe,
-  0x34, 0x65, 0xa4, 0x50, 0x3b, 0x4f, 0x0b, 0x9a, 0xa8, 0xd0, 0xf5, 0xcf,
-  0xa4, 0x2b, 0x7b, 0x1e, 0x58, 0x31, 0x6f, 0x1c, 0x4d, 0x2f, 0x43, 0xec,
-  0x50, 0x55, 0x2e, 0xb4, 0x21, 0xc8, 0x31, 0x78, 0x4e, 0x33, 0x32, 0x4b,
-  0x19, 0x57, 0x62, 0x6a, 0x42, 0x74, 0xcc, 0xa6, 0x4f, 0x1f, 0x61, 0x68,
-  0x91, 0x8f, 0x3b, 0x73, 0x8c, 0x65, 0x81, 0x24, 0xd0, 0xe1, 0x61, 0x66,
-  0x4f, 0xd1, 0xd1, 0xa1, 0x74, 0x08, 0x97, 0x2f, 0x74, 0x13, 0x89, 0x88,
-  0x4b, 0xda, 0xc6, 0x25, 0x63, 0x49, 0x2d, 0x65, 0x6d, 0x19, 0x57, 0xb0,
-  0x55, 0x6e, 0x5e, 0xb1, 0xc4, 0x22, 0x67, 0x7c, 0x6e, 0x42, 0x20, 0x58,
-  0x24, 0x49, 0x97, 0x2c, 0x38, 0x9a, 0x5e, 0xcc, 0xa0, 0xd6, 0x7a, 0x52,
-  0x81, 0x68, 0x09, 0x4c, 0x0f, 0xd6, 0xd4, 0x50, 0x87, 0xa5, 0xfb, 0x53,
-  0x55, 0x42, 0x53, 0x54, 0x8f, 0x98, 0xcf, 0xc4, 0x73, 0x86, 0xb2, 0x26,
-  0xde, 0xab, 0x29, 0x99, 0x09, 0x10, 0x96, 0x63, 0x23, 0x4b, 0x1f, 0x41,
-  0x53, 0x53, 0x49, 0xc1, 0x47, 0x4e, 0x62, 0xa9, 0xf5, 0x55, 0x8a, 0x62,
-  0x38, 0x83, 0x21, 0x5b, 0x83, 0xc3, 0x20, 0xd8, 0x8b, 0x5b, 0x49, 0x35,
-  0x3f, 0x8e, 0x4a, 0x4f, 0x49, 0x73, 0x07, 0x95, 0x2b, 0x60, 0x89, 0x58,
-  0x34, 0xc7, 0x5a, 0x91, 0x16, 0xd8, 0x6d, 0x1e, 0x22, 0x73, 0xc0, 0x16,
-  0xc5, 0xd5, 0x32, 0x2d, 0xe9, 0x50, 0xbe, 0xda, 0x36, 0xe0, 0x67, 0x98,
-  0x14, 0x76, 0x56, 0x6e, 0xd7, 0x79, 0x94, 0x87, 0xb1, 0x16, 0x82, 0x07,
-  0x45, 0x58, 0x79, 0xbc, 0xf9, 0x13, 0x59, 0xc7, 0x78, 0x41, 0xd9, 0x42,
-  0x39, 0x61, 0xb2, 0x9e, 0x4f, 0x3e, 0x43, 0x2c, 0x24, 0xfc, 0xdf, 0xbd,
-  0x79, 0x8c, 0x65, 0x14, 0x05, 0xcc, 0x31, 0x30, 0x0c, 0x3a, 0xf0, 0xea,
-  0x4d, 0x73, 0x3c, 0x25, 0x28, 0xda, 0x19, 0xfc, 0x95, 0x3a, 0xb9, 0x84,
-  0x81, 0x3e, 0xb2, 0x8b, 0xed, 0x78, 0x25, 0x7b, 0xe9, 0x1c, 0x35, 0x16,
-  0x23, 0x4b, 0xbe, 0xb0, 0x78, 0x00, 0x92, 0x53, 0xd0, 0xf1, 0x38, 0x36,
-  0x4d, 0xac, 0xe1, 0xb1, 0xac, 0xbb, 0x4e, 0x4f, 0x54, 0x93, 0x0b, 0x10,
-  0xca, 0xee, 0x2d, 0xb4, 0x1e, 0x2d, 0x17, 0x4f, 0x59, 0x53, 0x47, 0x3c,
-  0xda, 0x61, 0xa0, 0x14, 0xaf, 0x68, 0xe7, 0x4e, 0x31, 0x0a, 0xfa, 0x14,
-  0x72, 0x18, 0x72, 0x4c, 0xbb, 0x04, 0x7d, 0x16, 0xa5, 0xda, 0x76, 0x1e,
-  0x9d, 0xb0, 0xc9, 0x1d, 0x7c, 0x25, 0x81, 0x43, 0xa1, 0xd8, 0x35, 0xff,
-  0xfc, 0x3a, 0x76, 0x3a, 0x5a, 0x3a, 0xff, 0x7a, 0x3a, 0x51, 0x71, 0x55,
-  0x75, 0x42, 0x62, 0xfe, 0x53, 0x73, 0x59, 0x79, 0x41, 0x61, 0x31, 0x2d,
-  0x20, 0xfc, 0x46, 0x3a, 0x66, 0x3a, 0x54, 0x3a, 0x1b, 0x02, 0x4e, 0xf6,
-  0x3a, 0x6e, 0x3a, 0x2f, 0xad, 0xa1, 0xd5, 0x91, 0xa2, 0x78, 0x1c, 0xc1,
-  0x02, 0x02, 0xa2, 0x4e, 0x59, 0x76, 0x04, 0x36, 0xe2, 0x6c, 0x99, 0xfa,
-  0xd1, 0x88, 0x63, 0x73, 0xd2, 0x26, 0x62, 0x6f, 0x99, 0xb7, 0xe9, 0x26,
-  0x10, 0xae, 0x72, 0xd2, 0xc2, 0x2d, 0x39, 0x2e, 0xfa, 0x41, 0x2d, 0x5a,
-  0x2c, 0x24, 0xc6, 0x5e, 0x06, 0x14, 0x04, 0x57, 0xfc, 0x51, 0x2f, 0x3a,
-  0x20, 0xba, 0x91, 0x2d, 0xc5, 0x11, 0x1b, 0x0d, 0x63, 0x60, 0x35, 0x81,
-  0x54, 0x55, 0x0b, 0x67, 0x35, 0xd7, 0x35, 0x0a, 0xca, 0xb6, 0x27, 0x6c,
-  0x0e, 0x29, 0xb9, 0x00, 0x5b, 0xab, 0xc5, 0x80, 0xc2, 0x72, 0xa3, 0xa1,
-  0x0d, 0x86, 0x62, 0xe4, 0x24, 0xd7, 0x35, 0x65, 0x25, 0xb7, 0x7e, 0x6d,
-  0x69, 0x7d, 0xfa, 0x00, 0xa1, 0x56, 0x39, 0x38, 0x00, 0x39, 0x29, 0x28,
-  0xb4, 0x55, 0xb3, 0x6d, 0x77, 0x00, 0xad, 0x96, 0xf6, 0x0d, 0x2f, 0x70,
-  0x09, 0x76, 0x36, 0x2f, 0xf2, 0x80, 0xf5, 0x57, 0xac, 0x6b, 0x0f, 0x45,
-  0xda, 0x0f, 0x49, 0x52, 0x96, 0xf4, 0x52, 0xdc, 0x9f, 0x55, 0x4e, 0x12,
-  0xb6, 0x31, 0x2c, 0x0b, 0xf4, 0x52, 0x42, 0x2d, 0xfa, 0x55, 0x53, 0x4c,
-  0x59, 0xb9, 0x6e, 0x20, 0x95, 0xc0, 0x3a, 0xdb, 0x14, 0x30, 0x2c, 0x04,
-  0x66, 0x38, 0xce, 0x33, 0x32, 0xfb, 0x0e, 0x37, 0x09, 0xc0, 0x73, 0xeb,
-  0x05, 0xb3, 0x34, 0x34, 0x23, 0x77, 0xd5, 0xec, 0xa4, 0xea, 0xda, 0x34,
-  0x05, 0x50, 0x7d, 0x1b, 0x38, 0x8d, 0x20, 0x36, 0x8b, 0x3b, 0x37, 0x17,
-  0x00, 0x37, 0x2f, 0x39, 0x34, 0x77, 0x14, 0x37, 0x34, 0x33, 0x32, 0x19,
-  0x95, 0xc8, 0x35, 0xdc, 0x53, 0x00, 0x4f, 0x1c, 0xb5, 0xf7, 0x47, 0x45,
-  0x6d, 0x20, 0x3f, 0x00, 0x6e, 0x0c, 0x38, 0x33, 0xfb, 0x18, 0x54, 0x87,
-  0x2c, 0x0f, 0x9f, 0x39, 0x75, 0x38, 0x35, 0xef, 0x8c, 0x86, 0x61, 0x6e,
-  0x37, 0x31, 0x83, 0x81, 0xca, 0xb7, 0x34, 0x32, 0x36, 0xf1, 0x4e, 0x00,
-  0x55, 0xc1, 0xf5, 0x37, 0x44, 0xa8, 0x17, 0x3d, 0x7d, 0x4a, 0xe7, 0xbd,
-  0xc9, 0xb0, 0x25, 0x2f, 0xe8, 0xb0, 0x44, 0x05, 0x27, 0x80, 0x79, 0x02,
-  0x08, 0x0d, 0x6c, 0x3a, 0xfa, 0x75, 0x63, 0x65, 0x58, 0x84, 0x11, 0xc1,
-  0xde, 0x21, 0x39, 0x31, 0x77, 0x2c, 0x2f, 0x21, 0x18, 0xc7, 0x8a, 0xc9,
-  0x2a, 0x58, 0x54, 0x1a, 0x4c, 0x36, 0x2e, 0xac, 0x66, 0x66, 0xd5, 0x44,
-  0x61, 0x64, 0x30, 0x2c, 0x48, 0x3d, 0xb0, 0x1a, 0x0d, 0xba, 0x3f, 0x59,
-  0x6f, 0x0d, 0xf5, 0x59, 0x4b, 0xa2, 0x5c, 0x74, 0x62, 0x69, 0x33, 0xd1,
-  0xee, 0x42, 0xdd, 0x2d, 0xbe, 0x11, 0x81, 0xce, 0xa0, 0x43, 0x4e, 0x75,
-  0x64, 0x65, 0x21, 0x60, 0x6c, 0x26, 0x03, 0xb4, 0x77, 0x08, 0x18, 0x18,
-  0xc1, 0x77, 0xc8, 0xe3, 0x71, 0x93, 0xd4, 0x9e, 0x2d, 0x98, 0x1a, 0x2c,
-  0x95, 0xd9, 0x34, 0x06, 0x30, 0x0a, 0xc0, 0x7b, 0xe0, 0x9e, 0xc1, 0xf4,
-  0x81, 0x73, 0x1a, 0x8c, 0x9e, 0x36, 0x57, 0x2b, 0xd0, 0x36, 0x2f, 0xb8,
-  0x13, 0x30, 0x58, 0xb9, 0x21, 0x21, 0xb0, 0xa8, 0x75, 0xda, 0x62, 0x01,
-  0xc6, 0x9c, 0x75, 0xe6, 0x28, 0xa1, 0x1e, 0x4f, 0x6c, 0x19, 0xbb, 0x06,
-  0x04, 0x00, 0xde, 0x2c, 0x15, 0x83, 0x5e, 0x80, 0xc0, 0x22, 0x95, 0x02,
-  0x93, 0x24, 0x2e, 0x64, 0x17, 0x81, 0x6c, 0x2d, 0x1c, 0x5f, 0xc8, 0xfb,
-  0xd8, 0x6f, 0x46, 0xc8, 0x32, 0xb7, 0x1a, 0xb9, 0xcf, 0xec, 0x13, 0xeb,
-  0x25, 0xe1, 0xde, 0xdb, 0x58, 0x2b, 0xb8, 0xf7, 0x00, 0x2a, 0x13, 0x1c,
-  0xae, 0x30, 0x12, 0x00, 0x4d, 0x30, 0x92, 0xbd, 0xd6, 0x04, 0x15, 0x37,
-  0x65, 0x5c, 0x33, 0x20, 0x19, 0x12, 0x8e, 0x0f, 0x02, 0x42, 0x02, 0xd4,
-  0xd9, 0xe0, 0x9f, 0x1d, 0x28, 0x48, 0xf6, 0x68, 0xb1, 0x62, 0x6d, 0xda,
-  0x55, 0xae, 0x21, 0xad, 0x7b, 0x8f, 0x7f, 0x25, 0xc0, 0x7a, 0x2b, 0xdc,
-  0xac, 0x77, 0x7e, 0x1b, 0x62, 0x47, 0x03, 0x72, 0x43, 0x4d, 0xf1, 0x85,
-  0x47, 0xa1, 0x25, 0x16, 0x36, 0xa4, 0xc0, 0xec, 0x2f, 0xc8, 0x24, 0x34,
-  0xca, 0x69, 0x46, 0x91, 0xc7, 0x79, 0x5d, 0x43, 0x68, 0xb7, 0x04, 0xbc,
-  0xda, 0xaf, 0x95, 0x41, 0x28, 0xf2, 0xc5, 0xe2, 0x73, 0x05, 0x21, 0x5a,
-  0x27, 0x98, 0x63, 0x0d, 0xf6, 0x46, 0x0e, 0x38, 0x2b, 0xf6, 0x2e, 0x28,
-  0xd5, 0x57, 0x4e, 0xa5, 0xbd, 0x84, 0xe0, 0x4c, 0x3b, 0x74, 0x51, 0x75,
-  0x6d, 0x4f, 0x6b, 0x81, 0x23, 0x82, 0xf8, 0xd5, 0x66, 0x9a, 0xee, 0x68,
-  0xf0, 0x0e, 0x4b, 0x67, 0x61, 0x61, 0x2a, 0x89, 0xde, 0x26, 0x52, 0x09,
-  0x48, 0xa8, 0x73, 0x98, 0x2f, 0x58, 0x17, 0x60, 0xe4, 0xbd, 0x28, 0xdc,
-  0x3a, 0x52, 0x66, 0x0b, 0x92, 0x81, 0xfa, 0xcd, 0x53, 0x61, 0x56, 0x12,
-  0x5b, 0x56, 0x06, 0x1c, 0x40, 0x9b, 0x7e, 0xb7, 0xd1, 0x2b, 0x06, 0x1c,
-  0x36, 0x8c, 0x1a, 0x2c, 0x01, 0xda, 0x07, 0xcb, 0x38, 0x73, 0x0c, 0x4a,
-  0x23, 0x6c, 0x11, 0x4d, 0x09, 0x15, 0xd8, 0x0a, 0x3f, 0x6d, 0x6e, 0x51,
-  0xc9, 0xd7, 0xe6, 0xa9, 0x65, 0xe4, 0xed, 0x50, 0x1b, 0x01, 0xd7, 0x86,
-  0x00, 0x8a, 0x46, 0x6f, 0xf5, 0x30, 0x66, 0x58, 0x09, 0xfd, 0x28, 0x79,
-  0x2f, 0x6e, 0x29, 0x1b, 0xb8, 0x00, 0x60, 0x1f, 0xb9, 0x88, 0x06, 0x12,
-  0x5b, 0x36, 0x41, 0xa9, 0x76, 0x50, 0xb6, 0x78, 0x74, 0x2d, 0x0a, 0x11,
-  0x2e, 0xdb, 0x20, 0x5b, 0x1d, 0x70, 0x17, 0xe4, 0xa5, 0x4b, 0x18, 0x77,
-  0x61, 0xc6, 0xda, 0x8d, 0x13, 0x99, 0x6e, 0x06, 0x41, 0x50, 0x24, 0x55,
-  0x35, 0x4e, 0x2e, 0x32, 0x73, 0xd6, 0x80, 0xd5, 0x6f, 0x61, 0x68, 0xa9,
-  0x56, 0x15, 0x24, 0x6e, 0x20, 0x30, 0x5c, 0xc3, 0x07, 0x8c, 0xaa, 0xa5,
-  0x48, 0x75, 0x58, 0xf0, 0xaf, 0x02, 0xc1, 0xb2, 0x32, 0x2c, 0x49, 0x11,
-  0x35, 0x4e, 0x64, 0x8d, 0xab, 0x57, 0x26, 0x2f, 0x30, 0x74, 0x31, 0x5e,
-  0xdc, 0x01, 0xf6, 0x9f, 0x4a, 0x31, 0x60, 0x39, 0x75, 0x52, 0x64, 0x87,
-  0x20, 0xf7, 0xed, 0x29, 0x29, 0x27, 0x14, 0x66, 0xad, 0xf4, 0x0e, 0x66,
-  0x14, 0xb2, 0x6c, 0xc0, 0x7b, 0x8f, 0x05, 0x1c, 0x36, 0x00, 0x06, 0x82,
-  0x02, 0x8f, 0x77, 0x7d, 0x62, 0x25, 0x43, 0xaf, 0x0b, 0x00, 0xd2, 0x97,
-  0x18, 0x30, 0xcb, 0xda, 0x87, 0xe6, 0x08, 0x23, 0x76, 0x70, 0xaa, 0x6f,
-  0x1d, 0x18, 0x53, 0x1d, 0x6c, 0x32, 0xdd, 0x92, 0x69, 0xb4, 0xe0, 0x1b,
-  0x30, 0xc3, 0x70, 0x74, 0x79, 0xab, 0x64, 0x05, 0x97, 0x6f, 0x2a, 0x42,
-  0xec, 0xc6, 0xff, 0x6c, 0x8e, 0xad, 0x9b, 0x38, 0x91, 0xd9, 0x4c, 0xb0,
-  0x35, 0xb7, 0xea, 0x80, 0xc9, 0x3d, 0x78, 0x25, 0xe0, 0x14, 0x27, 0x0a,
-  0x75, 0x15, 0x9d, 0x8b, 0x73, 0x57, 0xaa, 0xb2, 0x54, 0x5f, 0x23, 0x49,
-  0x42, 0x47, 0x5b, 0x4f, 0x21, 0x48, 0xe0, 0x87, 0xc7, 0x06, 0x57, 0x60,
-  0x1d, 0x86, 0x47, 0xb2, 0x84, 0x8f, 0x05, 0xfd, 0xa7, 0x42, 0x69, 0x67,
-  0x08, 0x73, 0x6e, 0xf4, 0x50, 0xc1, 0x30, 0xd6, 0x1b, 0x3f, 0x2b, 0x00,
-  0x59, 0xb0, 0x08, 0x71, 0x57, 0x75, 0xb7, 0x31, 0x49, 0xa1, 0x70, 0x2c,
-  0x81, 0x6b, 0xb5, 0x4b, 0xf1, 0xa0, 0x44, 0x26, 0x05, 0x21, 0x3d, 0xc2,
-  0x7d, 0x18, 0x38, 0xed, 0x59, 0x19, 0x61, 0x8a, 0xde, 0x15, 0x27, 0x46,
-  0x78, 0x3e, 0x32, 0x12, 0x41, 0x0c, 0x6b, 0x04, 0x21, 0xc4, 0x30, 0xc7,
-  0x19, 0xda, 0xaa, 0x21, 0xf0, 0x8e, 0x65, 0x28, 0xc1, 0x2c, 0x98, 0xe3,
-  0x49, 0xc2, 0x56, 0xc1, 0x2d, 0x37, 0x8a, 0x28, 0xcd, 0x7f, 0x52, 0xec,
-  0x85, 0x1c, 0x0b, 0xa4, 0x29, 0x0a, 0x03, 0x0d, 0x25, 0x09, 0xda, 0x58,
-  0x1d, 0x2d, 0x0e, 0xf6, 0x85, 0xe4, 0xa1, 0x66, 0x48, 0x9a, 0x07, 0xe6,
-  0x4a, 0x3a, 0xb5, 0xd6, 0xa1, 0x2b, 0x32, 0xd8, 0x99, 0x2b, 0xfd, 0x57,
-  0x54, 0xaf, 0xee, 0x40, 0xc0, 0x01, 0x1d, 0x26, 0x03, 0xb1, 0xbc, 0x67,
-  0x60, 0x2c, 0x18, 0xca, 0xfe, 0xc6, 0xce, 0x48, 0x14, 0x5e, 0x4f, 0xa6,
-  0x73, 0xb9, 0x3a, 0x5a, 0xb4, 0xf8, 0x44, 0xe9, 0xb1, 0x19, 0xbf, 0x50,
-  0x4c, 0x41, 0x4e, 0x4e, 0x45, 0x75, 0x0d, 0x75, 0x84, 0x3c, 0x86, 0x8d,
-  0x65, 0x30, 0x1e, 0x68, 0x75, 0x50, 0x18, 0x72, 0x1b, 0x2e, 0x28, 0xd6,
-  0x80, 0xb0, 0x89, 0x69, 0x29, 0x35, 0x19, 0x33, 0x3b, 0x78, 0x05, 0xd8,
-  0x40, 0x52, 0x39, 0x7f, 0x96, 0x43, 0xcc, 0x10, 0x08, 0x5c, 0x83, 0xe1,
-  0xc2, 0xbe, 0x04, 0xac, 0xb7, 0x56, 0x9e, 0x08, 0x33, 0x2f, 0x0a, 0x3a,
-  0x1a, 0x7b, 0x6f, 0x0c, 0x81, 0x18, 0x65, 0x0e, 0x46, 0x09, 0x34, 0x2a,
-  0xc0, 0xbc, 0xe0, 0x00, 0x70, 0x66, 0x27, 0x0f, 0x3a, 0x06, 0x5a, 0x61,
-  0x6b, 0x93, 0x58, 0x03, 0x06, 0x5e, 0x77, 0xcd, 0x36, 0xe0, 0x50, 0x04,
-  0x85, 0xbd, 0x41, 0x4d, 0x1a, 0x50, 0x8d, 0x4c, 0xfb, 0x49, 0x46, 0x56,
-  0x41, 0x53, 0x6e, 0xb6, 0x49, 0x4d, 0x0c, 0xf1, 0x41, 0x45, 0x50, 0x65,
-  0x7d, 0x89, 0x70, 0x0d, 0x19, 0xc3, 0xc0, 0x20, 0xe0, 0x4a, 0x60, 0x15,
-  0x07, 0xff, 0x03, 0x00, 0x10, 0x42, 0x0f, 0x18, 0x09, 0xb5, 0x0b, 0xb2,
-  0x4d, 0x2e, 0xc6, 0x68, 0x30, 0x73, 0x13, 0xdc, 0xb5, 0x79, 0x94, 0x31,
-  0xd9, 0x4d, 0x57, 0x5b, 0xe2, 0x31, 0x08, 0xac, 0x81, 0x8d, 0x2d, 0x9a,
-  0x47, 0xbd, 0x1e, 0x38, 0x61, 0xf7, 0x4c, 0xbc, 0x00, 0xf0, 0x2b, 0x84,
-  0x45, 0xd8, 0x2f, 0xa9, 0x6c, 0xe6, 0x60, 0x62, 0x84, 0x7b, 0x50, 0x30,
-  0xe2, 0x6e, 0x51, 0x58, 0x3a, 0x5c, 0x13, 0x54, 0xf0, 0x2e, 0x46, 0x49,
-  0x4c, 0xb0, 0x80, 0x28, 0x6f, 0x6a, 0x63, 0x2e, 0x29, 0xb2, 0x00, 0xb4,
-  0x37, 0x4e, 0xe9, 0x42, 0x4f, 0x3f, 0xc1, 0x96, 0x14, 0xcb, 0xb8, 0x70,
-  0x0d, 0x0f, 0x0c, 0x65, 0x33, 0x60, 0x9f, 0x61, 0x52, 0x45, 0x53, 0x9e,
-  0x43, 0x56, 0xe6, 0x30, 0x3c, 0x8d, 0x81, 0x3a, 0x23, 0x3c, 0xde, 0x29,
-  0xc2, 0x34, 0x34, 0xa3, 0xa0, 0x11, 0xc1, 0x49, 0x7e, 0x1b, 0xaf, 0x2e,
-  0x52, 0x7b, 0x44, 0xdb, 0x59, 0x41, 0x02, 0xcb, 0x36, 0x70, 0x4b, 0x4d,
-  0x24, 0x96, 0xb6, 0xf6, 0x80, 0x3a, 0x16, 0xcd, 0x33, 0x70, 0xaa, 0xa4,
-  0x38, 0x97, 0x50, 0x89, 0x27, 0x02, 0x43, 0x6a, 0xb8, 0x04, 0x2a, 0xc3,
-  0xda, 0x4a, 0x64, 0x13, 0xa2, 0xb0, 0x65, 0x32, 0x8b, 0x18, 0x2e, 0x18,
-  0x29, 0x00, 0x31, 0x26, 0x69, 0x01, 0x1f, 0x9c, 0x86, 0x0a, 0x40, 0x12,
-  0x58, 0xba, 0x2b, 0xd9, 0xd4, 0x32, 0x09, 0x41, 0x25, 0xbb, 0x2f, 0x5a,
-  0x44, 0x45, 0xf2, 0x4c, 0x45, 0x54, 0x45, 0x31, 0x3a, 0xce, 0xb7, 0x3a,
-  0x76, 0x50, 0x67, 0x69, 0x14, 0xe3, 0x60, 0x97, 0x5b, 0x9b, 0x09, 0x6c,
-  0x30, 0x27, 0x2d, 0xd6, 0x27, 0x02, 0x5f, 0x02, 0x02, 0xf6, 0xae, 0x6b,
-  0x1b, 0x29, 0x0d, 0x82, 0x9c, 0xd7, 0x19, 0x14, 0xbc, 0x41, 0x11, 0x85,
-  0x4b, 0x8b, 0x95, 0x2d, 0x20, 0x30, 0x6c, 0x66, 0xb7, 0x8a, 0x5b, 0x2a,
-  0x2e, 0x20, 0xa3, 0x45, 0x99, 0x36, 0x22, 0x5c, 0x2e, 0x20, 0x19, 0x21,
-  0xe4, 0x31, 0x6b, 0x27, 0xfb, 0x91, 0x90, 0x6a, 0xaa, 0x68, 0x95, 0x6f,
-  0xc1, 0xd3, 0x88, 0x2e, 0x10, 0x06, 0x5e, 0x2b, 0x03, 0x3d, 0x3a, 0x61,
-  0x93, 0x46, 0x02, 0xee, 0x5a, 0xf6, 0x52, 0x3b, 0x18, 0xb0, 0x62, 0x41,
-  0x17, 0x25, 0x56, 0x43, 0x4d, 0x20, 0x75, 0xf0, 0x3b, 0x44, 0x50, 0x36,
-  0xa5, 0x06, 0x90, 0xd9, 0x17, 0x0d, 0xb9, 0x32, 0x48, 0x39, 0x4a, 0xcc,
-  0x8d, 0x4e, 0x3d, 0xb0, 0x90, 0xc1, 0x68, 0x8a, 0x61, 0xb0, 0x1e, 0x27,
-  0xd0, 0x09, 0x45, 0xd0, 0x9a, 0x30, 0x3a, 0xfc, 0x5a, 0xe2, 0x37, 0x04,
-  0x46, 0x15, 0x92, 0xa0, 0xc8, 0x80, 0xc0, 0xc1, 0xdf, 0x4b, 0xd9, 0x6e,
-  0x4a, 0xde, 0xc9, 0x3c, 0x00, 0x3e, 0xc8, 0xac, 0xc3, 0x11, 0x46, 0x65,
-  0xaa, 0x46, 0xd6, 0x54, 0xac, 0x56, 0x2c, 0x6c, 0xb0, 0x3a, 0xb0, 0x12,
-  0x7c, 0xdd, 0x6d, 0x71, 0x51, 0xa2, 0x63, 0x45, 0x35, 0x13, 0x2f, 0xbd,
-  0x1f, 0xce, 0x41, 0x11, 0x1a, 0xe4, 0x2c, 0xa3, 0x0c, 0x24, 0x8c, 0x82,
-  0xe8, 0xba, 0x73, 0xa4, 0x8f, 0x0d, 0xe2, 0x6f, 0xcd, 0x35, 0x91, 0x30,
-  0x79, 0x33, 0x32, 0x21, 0x17, 0xb0, 0x47, 0x3f, 0x2a, 0x08, 0x40, 0xc5,
-  0xc3, 0x93, 0xb2, 0xa4, 0x98, 0x28, 0xda, 0x19, 0x66, 0x99, 0x99, 0xf8,
-  0xcd, 0x29, 0x2c, 0xf4, 0x6e, 0x19, 0x1f, 0x0b, 0x45, 0x5c, 0x46, 0x1c,
-  0x1a, 0x04, 0xea, 0xe1, 0x61, 0xaa, 0x20, 0x42, 0x60, 0x55, 0xd2, 0xb1,
-  0x07, 0x6f, 0x24, 0x8f, 0x28, 0x41, 0xed, 0x67, 0xa2, 0x21, 0x08, 0xcf,
-  0x2d, 0x32, 0x06, 0xf7, 0x31, 0x50, 0x21, 0xf2, 0xa8, 0xf0, 0x63, 0xad,
-  0x19, 0x8e, 0xa3, 0x6e, 0xeb, 0x03, 0xb3, 0x2f, 0x7b, 0x17, 0x80, 0xdc,
-  0x53, 0x49, 0x31, 0x91, 0x10, 0x65, 0x68, 0x88, 0x12, 0x85, 0xd7, 0xa1,
-  0xb2, 0x24, 0xc0, 0x24, 0xd5, 0xb8, 0x2d, 0x15, 0x8a, 0x18, 0x04, 0xda,
-  0x90, 0x46, 0xe7, 0x89, 0x1f, 0x81, 0x86, 0x90, 0xcd, 0xe3, 0xcc, 0xc2,
-  0x08, 0xd7, 0x3c, 0x6c, 0x6d, 0x73, 0x0a, 0xd7, 0x9a, 0xa4, 0x0a, 0x42,
-  0x20, 0xe9, 0x6e, 0x6b, 0x6d, 0x1b, 0x38, 0x67, 0x1d, 0x0d, 0x00, 0xe2,
-  0x14, 0xc3, 0xb2, 0x48, 0x71, 0xb0, 0x6f, 0x96, 0xbc, 0xdc, 0x2c, 0x94,
-  0x99, 0x29, 0x0a, 0x91, 0xeb, 0xb8, 0x30, 0x0e, 0x7f, 0x33, 0x34, 0x35,
-  0x36, 0x37, 0x38, 0xf4, 0x39, 0x41, 0x42, 0x43, 0xba, 0xa8, 0x46, 0x00,
-  0x77, 0x2f, 0xf3, 0x55, 0x74, 0xd1, 0x29, 0x77, 0x59, 0x54, 0x20, 0xf0,
-  0x54, 0x59, 0x39, 0x6c, 0x23, 0x8d, 0xa2, 0x68, 0x05, 0xef, 0x1c, 0xda,
-  0x22, 0x75, 0x4b, 0x49, 0xb3, 0x20, 0x96, 0x93, 0x6e, 0x2c, 0xc5, 0x41,
-  0x53, 0x9e, 0xb3, 0x29, 0x00, 0x7b, 0x5d, 0x4b, 0x37, 0xac, 0x38, 0xab,
-  0x18, 0xc2, 0x5b, 0x3d, 0x6f, 0x76, 0x58, 0x07, 0xc0, 0x40, 0x72, 0x64,
-  0x31, 0x28, 0x9c, 0x26, 0x78, 0x45, 0x66, 0xc1, 0x36, 0xdc, 0x70, 0x29,
-  0x23, 0x27, 0x17, 0x33, 0x22, 0xd1, 0xfa, 0x47, 0x1c, 0x07, 0x3b, 0x41,
-  0xa0, 0x56, 0x2f, 0xdf, 0x0e, 0xd9, 0x23, 0x4a, 0x0c, 0x6b, 0x08, 0x94,
-  0xd3, 0xc6, 0x34, 0x8c, 0x30, 0x05, 0x9d, 0xd8, 0x1b, 0x02, 0x4e, 0x83,
-  0x2d, 0x8e, 0x7b, 0x4d, 0x4f, 0x56, 0xf6, 0x40, 0xab, 0x17, 0x2c, 0x7e,
-  0x4c, 0x4f, 0x50, 0x50, 0x59, 0x18, 0x85, 0x64, 0xb3, 0xc1, 0x41, 0x56,
-  0x2a, 0xd1, 0x44, 0x2d, 0x74, 0x20, 0xa2, 0x27, 0xf0, 0xa1, 0x6e, 0x3d,
-  0x53, 0x4b, 0x3a, 0xd1, 0x49, 0xec, 0x15, 0x42, 0x45, 0x5d, 0x7c, 0x47,
-  0xb6, 0x48, 0x87, 0x47, 0x05, 0x4f, 0x47, 0x78, 0x0b, 0x14, 0x41, 0xa1,
-  0xd0, 0x14, 0xde, 0x25, 0xd8, 0x45, 0x53, 0xeb, 0x41, 0x50, 0x50, 0x45,
-  0xad, 0x2d, 0x13, 0xdb, 0x43, 0x4f, 0xd8, 0x49, 0x2b, 0x6b, 0x96, 0xf8,
-  0x6e, 0x9f, 0x52, 0xd7, 0x22, 0x36, 0xe9, 0x00, 0x0a, 0x41, 0x35, 0x89,
-  0x59, 0x10, 0x6d, 0x2f, 0x89, 0x00, 0xc2, 0xb1, 0x98, 0x2c, 0x43, 0x4f,
-  0x0b, 0x96, 0x24, 0x00, 0xc1, 0x60, 0x3a, 0xc2, 0x43, 0xa3, 0x2c, 0x5c,
-  0x05, 0xeb, 0xe0, 0x20, 0x2d, 0x9e, 0x1a, 0x00, 0x76, 0x86, 0x3f, 0x85,
-  0x3b, 0xff, 0x21, 0x23, 0x24, 0x25, 0x27, 0x2d, 0x40, 0x5f, 0xf8, 0x7b,
-  0x7d, 0x7e, 0x00, 0x50, 0x44, 0x80, 0x28, 0xe8, 0xbc, 0x23, 0x52, 0xe3,
-  0x06, 0xd6, 0x64, 0x69, 0xaa, 0x5c, 0xe8, 0x31, 0x31, 0x52, 0x7c, 0x30,
-  0x29, 0x02, 0xda, 0xfb, 0x08, 0x20, 0x08, 0x07, 0x94, 0x6d, 0x08, 0x02,
-  0x07, 0x22, 0xb1, 0x24, 0x40, 0x98, 0x1c, 0x45, 0x81, 0xe2, 0x81, 0x9c,
-  0xb3, 0x55, 0x9b, 0x78, 0x72, 0x44, 0x58, 0x1e, 0x23, 0x6d, 0x80, 0x4f,
-  0xe4, 0x33, 0xa2, 0x00, 0xd1, 0xa9, 0xe2, 0xb2, 0xf0, 0xfd, 0xb0, 0x67,
-  0x6c, 0x60, 0xce, 0xc2, 0x64, 0xb2, 0xac, 0x35, 0x6c, 0x73, 0x4c, 0xd2,
-  0x5f, 0x8f, 0x7a, 0x73, 0xfd, 0x33, 0x30, 0x8d, 0x9c, 0x75, 0x30, 0xc0,
-  0x21, 0xe9, 0x5c, 0x84, 0xa3, 0x67, 0x9d, 0x42, 0x20, 0x57, 0x18, 0x0f,
-  0xee, 0x8a, 0x00, 0xfa, 0x0f, 0x00, 0x70, 0xaa, 0x1b, 0xe7, 0x6d, 0x0e,
-  0xea, 0xf5, 0x0c, 0x1c, 0x06, 0x3c, 0x4f, 0x13, 0x7b, 0xb5, 0x11, 0x60,
-  0x18, 0xa0, 0xc6, 0xbc, 0x75, 0xf1, 0x23, 0x07, 0x53, 0x0a, 0xd0, 0x59,
-  0x07, 0xa9, 0xb5, 0x0d, 0x78, 0x31, 0x21, 0x1b, 0x05, 0xfc, 0x3d, 0x43,
-  0x52, 0x43, 0x54, 0xa0, 0x97, 0x24, 0x1e, 0xb4, 0x08, 0x3f, 0xbe, 0x48,
-  0x65, 0xd5, 0x4e, 0x3b, 0xec, 0xe1, 0x36, 0x16, 0x18, 0x23, 0x01, 0x31,
-  0x33, 0x2f, 0xff, 0x9d, 0x77, 0x70, 0x03, 0xb2, 0xd8, 0x20, 0xa6, 0xda,
-  0x44, 0x0d, 0x17, 0x10, 0x69, 0x70, 0x3b, 0xad, 0x90, 0x09, 0x0c, 0xb5,
-  0x38, 0xb6, 0x84, 0x63, 0x41, 0x22, 0xa6, 0x43, 0x01, 0x20, 0xb2, 0xd8,
-  0x00, 0xb4, 0x4b, 0xac, 0x26, 0x00, 0x3c, 0x43, 0x68, 0x60, 0xd4, 0x2f,
-  0xb8, 0x19, 0x2d, 0x50, 0x95, 0x95, 0xb6, 0x05, 0x43, 0x02, 0xea, 0x44,
-  0x00, 0x92, 0x7a, 0xda, 0x75, 0xc8, 0xdf, 0xf1, 0x00, 0x68, 0x06, 0x33,
-  0x60, 0x24, 0xd7, 0x0c, 0x60, 0xad, 0x88, 0x96, 0xdc, 0x41, 0x35, 0xa9,
-  0xc9, 0x42, 0x97, 0x36, 0x7e, 0x4b, 0x4d, 0x30, 0xe0, 0x19, 0xf6, 0x81,
-  0x0b, 0xe4, 0x75, 0x6e, 0x5a, 0xbd, 0xae, 0xaf, 0x72, 0xe4, 0x8f, 0x16,
-  0x7b, 0x5c, 0x2f, 0x61, 0x79, 0x62, 0xd8, 0x74, 0x6e, 0xc4, 0x61, 0x6d,
-  0xb1, 0x16, 0x11, 0xec, 0xe0, 0x15, 0x25, 0x86, 0xf4, 0x20, 0xc6, 0x0c,
-  0x2f, 0xc1, 0x21, 0x65, 0xac, 0xd0, 0x69, 0x66, 0x6e, 0x04, 0x90, 0x36,
-  0x21, 0x1e, 0x28, 0x50, 0x37, 0xe4, 0x32, 0x29, 0x65, 0xcb, 0x84, 0x1e,
-  0x25, 0x9b, 0xac, 0x1b, 0x25, 0xed, 0xa9, 0x0b, 0x5b, 0x9a, 0x74, 0x08,
-  0x99, 0x22, 0x91, 0xf6, 0x8a, 0x6f, 0x24, 0x39, 0xd0, 0xa9, 0x6f, 0x59,
-  0x6b, 0x44, 0x5b, 0x45, 0x8c, 0xd3, 0x28, 0x34, 0xdc, 0x2f, 0x2c, 0x43,
-  0x43, 0x68, 0xb4, 0xbe, 0xcb, 0x29, 0x10, 0x48, 0x30, 0x02, 0x08, 0x60,
-  0xa4, 0x51, 0x58, 0x26, 0x23, 0x05, 0x23, 0x01, 0x68, 0xc5, 0xe6, 0x73,
-  0xcb, 0x6b, 0x90, 0x25, 0x93, 0xe2, 0x43, 0x5b, 0x18, 0x53, 0x10, 0x25,
-  0x3b, 0xa9, 0x49, 0x47, 0x2f, 0x84, 0x7d, 0xc6, 0x24, 0x4d, 0x28, 0x9b,
-  0x1f, 0xff, 0xdf, 0x7b, 0x79, 0xb2, 0x29, 0x19, 0xd9, 0xce, 0x2c, 0x1c,
-  0x05, 0x20, 0x93, 0xbe, 0x11, 0x6c, 0xb6, 0x0d, 0x6b, 0x66, 0x75, 0x4b,
-  0x1a, 0x36, 0x16, 0x11, 0xb3, 0x43, 0x00, 0x6a, 0x6e, 0x86, 0x00, 0x61,
-  0x14, 0xb9, 0x24, 0x2b, 0x4b, 0x39, 0x09, 0x44, 0x88, 0x99, 0x4b, 0x2a,
-  0x04, 0x3b, 0xea, 0xb3, 0x0d, 0x87, 0x35, 0x73, 0x62, 0x8d, 0x0f, 0x16,
-  0x10, 0x59, 0xf9, 0xd6, 0x67, 0x30, 0xa6, 0x04, 0x84, 0x6c, 0xe4, 0x90,
-  0x91, 0x8f, 0x8c, 0xae, 0x42, 0x71, 0x6c, 0x14, 0xb4, 0x9b, 0xc9, 0x4a,
-  0xac, 0x67, 0x2e, 0x8c, 0x58, 0xe0, 0xb0, 0x74, 0xed, 0x28, 0x8f, 0x05,
-  0x23, 0x7e, 0x65, 0x50, 0x87, 0xdf, 0x29, 0x03, 0x30, 0x04, 0x59, 0x31,
-  0x82, 0xa8, 0xb0, 0x10, 0x95, 0x63, 0xdc, 0x2d, 0x60, 0x9e, 0xa4, 0x16,
-  0x95, 0xf6, 0x1b, 0x00, 0x4c, 0x1b, 0x07, 0x5a, 0x22, 0x0c, 0x8e, 0xb6,
-  0x7b, 0x84, 0x85, 0x85, 0x92, 0x27, 0xb0, 0x46, 0x56, 0x13, 0x04, 0x8f,
-  0xe0, 0x16, 0xee, 0x1b, 0xcd, 0x92, 0x22, 0xb4, 0x6c, 0x70, 0x0f, 0x29,
-  0xa0, 0x35, 0x9b, 0x1c, 0xd8, 0x36, 0x4c, 0x18, 0x8b, 0xff, 0x25, 0x65,
-  0x83, 0x20, 0xe0, 0x88, 0x08, 0x98, 0x87, 0xf9, 0x47, 0xb6, 0x25, 0x87,
-  0x5c, 0x56, 0xce, 0xc8, 0x20, 0x02, 0x71, 0x61, 0x9b, 0x99, 0x0a, 0x30,
-  0x86, 0x6e, 0x30, 0x81, 0xe1, 0x73, 0x39, 0x80, 0xe0, 0x33, 0xe8, 0xc9,
-  0x6c, 0xc6, 0xf0, 0x00, 0x1d, 0xca, 0x96, 0x0e, 0x32, 0x90, 0x43, 0x5d,
-  0x82, 0xcd, 0x8f, 0x2e, 0xfe, 0x43, 0x42, 0x00, 0x6b, 0x52, 0x76, 0x43,
-  0x87, 0x12, 0xb2, 0x44, 0x51, 0x26, 0xa3, 0x32, 0x01, 0x43, 0x70, 0xb9,
-  0x8e, 0xaa, 0x31, 0x68, 0x4a, 0x73, 0x39, 0x6e, 0xb6, 0x3e, 0x00, 0xa3,
-  0x0b, 0x2d, 0x6d, 0x70, 0x08, 0xbd, 0x00, 0x53, 0x07, 0x78, 0xae, 0xe0,
-  0x07, 0xa1, 0x57, 0x67, 0x3f, 0x4c, 0x20, 0xd6, 0x2c, 0x5b, 0xd5, 0x74,
-  0x82, 0x40, 0x2c, 0xeb, 0xad, 0x5c, 0xa6, 0x2c, 0xa1, 0x45, 0x21, 0x2e,
-  0xa4, 0x7e, 0x5d, 0x2c, 0x6b, 0x63, 0x25, 0x00, 0x67, 0x05, 0x35, 0x16,
-  0x57, 0xa1, 0x86, 0xa0, 0x25, 0x58, 0xf5, 0x73, 0x34, 0xd7, 0x1c, 0x0f,
-  0xe6, 0x02, 0x3a, 0xb6, 0x35, 0x6c, 0xcd, 0xc6, 0x47, 0x53, 0xa6, 0x3e,
-  0x00, 0x20, 0x63, 0x82, 0xd6, 0x2b, 0x29, 0x06, 0x39, 0xda, 0x65, 0x96,
-  0xd9, 0x73, 0x1b, 0x4a, 0x10, 0xc9, 0xc4, 0x9b, 0x4c, 0x29, 0x0a, 0x42,
-  0x1e, 0x4a, 0xf0, 0xc2, 0x56, 0x31, 0x30, 0x66, 0x12, 0x62, 0xb2, 0x3e,
-  0x59, 0x74, 0x5d, 0x65, 0x05, 0xcd, 0x64, 0xa3, 0x0c, 0x80, 0xb3, 0x7a,
-  0x1e, 0x68, 0x87, 0x5f, 0xb3, 0x20, 0x28, 0xb2, 0x73, 0x1b, 0x3b, 0x73,
-  0x59, 0x0d, 0xcc, 0x24, 0x21, 0xd1, 0x26, 0x4f, 0xca, 0x28, 0xd7, 0xe9,
-  0x80, 0x64, 0x11, 0x1e, 0x4f, 0x87, 0xec, 0x01, 0x67, 0xbb, 0x53, 0x17,
-  0x9f, 0x06, 0x15, 0x10, 0x9b, 0x93, 0x4a, 0x54, 0x36, 0x5c, 0x58, 0x2d,
-  0xf7, 0x04, 0x24, 0xab, 0xb7, 0x05, 0x42, 0x5b, 0x6c, 0x4f, 0xdc, 0x61,
-  0xa3, 0x0a, 0x18, 0x73, 0x0e, 0xa7, 0x42, 0x75, 0x69, 0xd3, 0x35, 0x4c,
-  0x28, 0x0b, 0xeb, 0x2c, 0x40, 0x97, 0x3f, 0x65, 0x05, 0x92, 0x8f, 0x2c,
-  0x52, 0xd0, 0x78, 0x03, 0xc4, 0x18, 0x30, 0xcf, 0x81, 0x47, 0x44, 0x08,
-  0x44, 0x72, 0x20, 0xb5, 0x78, 0x88, 0x43, 0x07, 0xc0, 0x5f, 0x63, 0x72,
-  0x48, 0x28, 0x68, 0xf6, 0xa5, 0x02, 0xa8, 0xf4, 0x4e, 0x19, 0x54, 0xc0,
-  0x00, 0x58, 0xb4, 0x3b, 0x25, 0x36, 0x65, 0x68, 0x56, 0xac, 0x77, 0xc1,
-  0x35, 0xff, 0x57, 0x59, 0xf5, 0x77, 0x42, 0xe1, 0x37, 0x08, 0x45, 0x2e,
-  0x40, 0xb5, 0x7a, 0x69, 0x2a, 0xb8, 0x94, 0x8d, 0x44, 0xf6, 0x14, 0x45,
-  0x14, 0xdb, 0x63, 0xaa, 0x75, 0x70, 0x5b, 0x9d, 0xe8, 0x07, 0xc1, 0x80,
-  0x61, 0x07, 0x40, 0x93, 0xc8, 0x31, 0xb4, 0x39, 0x00, 0x72, 0x69, 0xa5,
-  0x9d, 0x86, 0x36, 0x42, 0x73, 0x33, 0xb7, 0x11, 0xe1, 0x9c, 0x64, 0x27,
-  0x47, 0x4e, 0xb5, 0x55, 0x03, 0x0b, 0x6a, 0x2c, 0x64, 0x78, 0xab, 0x72,
-  0x81, 0x6c, 0xf2, 0x79, 0x04, 0xb0, 0xea, 0x78, 0xaf, 0xeb, 0xea, 0x85,
-  0x64, 0x84, 0x0c, 0x64, 0xe0, 0x0f, 0xeb, 0x2f, 0x32, 0xc0, 0x5e, 0x5b,
-  0x00, 0x61, 0xd1, 0xd0, 0x1a, 0x73, 0x0e, 0xd8, 0x35, 0xf3, 0x38, 0xc2,
-  0x8c, 0x5c, 0x05, 0x6b, 0x89, 0x45, 0x22, 0x5c, 0x44, 0x19, 0x13, 0x57,
-  0x88, 0x2a, 0xc1, 0x9c, 0x65, 0x58, 0x84, 0x98, 0x16, 0x41, 0x28, 0xc1,
-  0xd2, 0x15, 0x27, 0x55, 0x5b, 0xf4, 0x2f, 0x56, 0x5b, 0x3a, 0x23, 0x68,
-  0x5d, 0xba, 0x5d, 0x0c, 0x51, 0xf9, 0x04, 0x55, 0xf4, 0x46, 0x3a, 0xef,
-  0x00, 0x09, 0xbf, 0x53, 0x04, 0x44, 0x5d, 0x60, 0x39, 0x53, 0x54, 0x8a,
-  0x3a, 0x31, 0xd6, 0xf2, 0x20, 0x2f, 0x4e, 0x3a, 0x6c, 0x46, 0x80, 0xec,
-  0x34, 0x34, 0x0c, 0x73, 0xec, 0x27, 0x59, 0x26, 0x8b, 0xf1, 0xa0, 0x53,
-  0x04, 0xe1, 0x44, 0x5c, 0x75, 0x8c, 0x50, 0x2d, 0xe1, 0xf0, 0x81, 0xc7,
-  0xfb, 0xc1, 0x2c, 0x3b, 0xed, 0x23, 0x85, 0x78, 0xb0, 0x71, 0xcd, 0x38,
-  0x04, 0x74, 0xa3, 0x9b, 0x3c, 0x5b, 0x51, 0x08, 0xfc, 0x74, 0x43, 0xd0,
-  0x16, 0x73, 0x07, 0xc5, 0xb5, 0x31, 0x32, 0x11, 0x56, 0x10, 0x44, 0x48,
-  0x27, 0xc5, 0x4e, 0xab, 0xce, 0x40, 0x6f, 0x2f, 0x21, 0x51, 0x82, 0xb5,
-  0x09, 0xaf, 0xd8, 0x49, 0xc9, 0x44, 0x36, 0x42, 0x28, 0xae, 0xe3, 0xbd,
-  0x79, 0x04, 0xb6, 0x39, 0x73, 0x35, 0x60, 0x55, 0x04, 0xa1, 0xf1, 0xda,
-  0x80, 0xb8, 0x03, 0x67, 0x67, 0x1d, 0x0b, 0x72, 0xe8, 0xe1, 0xe2, 0x12,
-  0xd7, 0xb9, 0xab, 0xc3, 0x13, 0xc3, 0x85, 0x4c, 0x63, 0xce, 0x48, 0x51,
-  0x49, 0x50, 0xe8, 0x71, 0x93, 0xe7, 0xb2, 0x73, 0x8e, 0x5b, 0x35, 0x49,
-  0x6a, 0xbe, 0xac, 0xd4, 0xb5, 0x20, 0xb7, 0x85, 0x30, 0xaa, 0x2c, 0xc1,
-  0x4e, 0x56, 0xb2, 0x18, 0x87, 0x9d, 0x65, 0x00, 0xbd, 0x88, 0x06, 0x25,
-  0x1a, 0x8c, 0x3b, 0x01, 0xb9, 0x28, 0x7b, 0xa2, 0x46, 0xac, 0x4f, 0x3b,
-  0x29, 0x8e, 0x1b, 0x55, 0x41, 0x27, 0x55, 0x6e, 0xca, 0x63, 0x6f, 0x08,
-  0xf0, 0xb3, 0xd6, 0x2b, 0x79, 0x98, 0x00, 0xda, 0x4c, 0xe4, 0x00, 0x40,
-  0x08, 0x50, 0x72, 0x37, 0x84, 0xf9, 0xd8, 0x1f, 0xbc, 0x4e, 0x67, 0x52,
-  0x20, 0x08, 0xc0, 0x4b, 0x40, 0xd8, 0x15, 0xa4, 0x3b, 0xd8, 0x33, 0x18,
-  0xa1, 0x57, 0x25, 0x56, 0xc2, 0xbe, 0x07, 0x6c, 0xc5, 0x29, 0x43, 0x19,
-  0xd8, 0x3a, 0xdd, 0x58, 0x09, 0x36, 0x02, 0x5a, 0x33, 0x02, 0x76, 0x39,
-  0xdb, 0xaf, 0xea, 0x1b, 0x69, 0x6b, 0xb6, 0x69, 0x5b, 0x42, 0x0f, 0x03,
-  0x6b, 0xdc, 0x8b, 0xe1, 0x30, 0x98, 0x17, 0x4d, 0x20, 0xe1, 0xbc, 0x9c,
-  0x11, 0x34, 0x92, 0xb3, 0x45, 0x78, 0x1c, 0xa3, 0x1e, 0x98, 0x95, 0x48,
-  0x21, 0x2c, 0xe8, 0x31, 0xa5, 0x50, 0xd9, 0x4d, 0x42, 0x17, 0x23, 0xca,
-  0xde, 0x41, 0x32, 0xfb, 0xd9, 0xe2, 0x08, 0x83, 0xa5, 0x25, 0x83, 0x1f,
-  0x6f, 0x78, 0x45, 0x48, 0x20, 0xd2, 0x2f, 0x4b, 0x3d, 0x0a, 0x59, 0x1f,
-  0xb0, 0x3e, 0x24, 0x07, 0x5a, 0xa0, 0xc1, 0x92, 0x03, 0xd8, 0x8d, 0x72,
-  0x49, 0x0f, 0x2b, 0xb7, 0x46, 0x73, 0xfb, 0x3a, 0x2f, 0x2f, 0x77, 0x00,
-  0x60, 0x2e, 0xf0, 0x6a, 0xa3, 0xe5, 0x6e, 0x5b, 0x19, 0x67, 0xa1, 0x2f,
-  0x6d, 0xe6, 0x6a, 0x78, 0x7c, 0x19, 0xf1, 0x84, 0x27, 0xda, 0x67, 0x74,
-  0xcd, 0x23, 0xeb, 0x43, 0x85, 0x01, 0x03, 0x8e, 0x8d, 0xbe, 0x58, 0xe3,
-  0x61, 0x3b, 0xa8, 0x63, 0x74, 0x58, 0x1c, 0xf6, 0xf0, 0x70, 0xc0, 0x1c,
-  0x78, 0x20, 0x2d, 0x83, 0x3c, 0xc0, 0x81, 0x63, 0x7d, 0x20, 0x3c, 0x72,
-  0x93, 0x0b, 0x62, 0x89, 0x40, 0xd2, 0xb6, 0x64, 0x73, 0x86, 0x83, 0x17,
-  0xc7, 0xd3, 0x5e, 0x3e, 0x88, 0xd1, 0x48, 0x73, 0xb5, 0x03, 0x94, 0x62,
-  0xe7, 0x02, 0xea, 0x25, 0x30, 0x18, 0x69, 0x0f, 0xdd, 0x20, 0x7b, 0x56,
-  0x5b, 0xf0, 0x36, 0x3a, 0x20, 0xa8, 0x3b, 0x3c, 0x65, 0x0a, 0xad, 0x40,
-  0x3d, 0x6c, 0x8a, 0x2e, 0x37, 0xe8, 0x2d, 0x73, 0x62, 0xb5, 0x2e, 0x59,
-  0xc2, 0x48, 0xaf, 0x3d, 0xa5, 0x69, 0x61, 0x50, 0x23, 0xa2, 0x4a, 0x70,
-  0x86, 0x18, 0x8e, 0x28, 0xf1, 0xe8, 0xa3, 0x6e, 0x2b, 0x4f, 0x78, 0x6f,
-  0x68, 0x6e, 0xb9, 0x59, 0xce, 0xbc, 0x0b, 0x57, 0x9c, 0x41, 0x73, 0x6a,
-  0xe4, 0x65, 0x07, 0x06, 0x70, 0xb5, 0x84, 0xb5, 0x5a, 0x68, 0x36, 0x8a,
-  0x74, 0x2c, 0x0a, 0x74, 0xeb, 0x1c, 0xfd, 0x02, 0x5b, 0x64, 0x65, 0xfc,
-  0x5f, 0x35, 0x69, 0x6c, 0x1c, 0x48, 0x70, 0xff, 0x30, 0x1b, 0x31, 0xd1,
-  0x9a, 0x74, 0x83, 0xa9, 0x67, 0x00, 0xaf, 0x07, 0x1d, 0x06, 0x10, 0x62,
-  0x11, 0xd4, 0x03, 0xb2, 0xa6, 0xa3, 0x10, 0x28, 0x0c, 0x03, 0x6a, 0xd7,
-  0x3f, 0xa4, 0x45, 0x16, 0x31, 0x89, 0x1b, 0x50, 0xe2, 0xdb, 0x19, 0x02,
-  0x46, 0xc2, 0xa7, 0xcd, 0x1c, 0xd5, 0xba, 0x4b, 0x28, 0xb1, 0x2b, 0x80,
-  0x29, 0xb1, 0xad, 0x81, 0x59, 0xea, 0x91, 0x28, 0x2b, 0x24, 0x59, 0xc2,
-  0x82, 0x60, 0xc3, 0xf6, 0xa7, 0x29, 0x09, 0x72, 0x71, 0x03, 0x84, 0x45,
-  0x9d, 0x02, 0x77, 0xb3, 0x42, 0x2e, 0x4a, 0x42, 0x90, 0xe9, 0x45, 0x9b,
-  0xd0, 0x9b, 0xd7, 0xb4, 0xc7, 0x29, 0x17, 0xd4, 0x64, 0x5e, 0xce, 0xf8,
-  0x5b, 0x63, 0xa1, 0x8b, 0x0d, 0x64, 0x4d, 0x37, 0x53, 0x73, 0x39, 0x2d,
-  0xc0, 0x49, 0x43, 0x72, 0x73, 0x37, 0x2a, 0xdf, 0x47, 0x31, 0x4d, 0x0f,
-  0x2f, 0xa2, 0x33, 0x3c, 0x58, 0x73, 0x77, 0xff, 0x86, 0x77, 0x81, 0x7d,
-  0x0c, 0x09, 0x6f, 0xbd, 0xfe, 0x61, 0x04, 0x81, 0x7a, 0xe0, 0x2f, 0x71,
-  0x76, 0x22, 0x00, 0x9c, 0xe6, 0x14, 0x82, 0x9c, 0xc4, 0xc8, 0x7a, 0xc7,
-  0xe9, 0x4c, 0x77, 0x56, 0xea, 0x23, 0xd0, 0x03, 0x70, 0x58, 0x21, 0xc3,
-  0x30, 0x7b, 0xd5, 0x3c, 0x46, 0x32, 0x87, 0x6e, 0x59, 0x43, 0x28, 0x2d,
-  0x71, 0x48, 0xcf, 0x88, 0x33, 0xfc, 0x63, 0x13, 0x30, 0x78, 0x38, 0x6a,
-  0x49, 0x79, 0x43, 0xd3, 0x4e, 0x30, 0x10, 0x16, 0x58, 0x21, 0xbd, 0xd2,
-  0xcf, 0x65, 0x00, 0x06, 0xa4, 0x01, 0xd4, 0x5f, 0xd6, 0x1d, 0x5f, 0x15,
-  0x2c, 0x26, 0x45, 0x30, 0x9f, 0xb2, 0xdf, 0x1c, 0x2f, 0x31, 0x04, 0xca,
-  0xa0, 0xd6, 0x05, 0x4c, 0x88, 0x58, 0xd2, 0x2c, 0x4e, 0x0a, 0x31, 0x80,
-  0xe1, 0x12, 0xec, 0x2b, 0x00, 0x03, 0x6c, 0x31, 0x38, 0xb0, 0x38, 0x42,
-  0x9d, 0x56, 0x12, 0x46, 0xea, 0x2c, 0xf5, 0x76, 0xca, 0x4f, 0xd6, 0x68,
-  0x43, 0x01, 0x8c, 0x03, 0x65, 0x34, 0x09, 0x4f, 0xbe, 0x35, 0x2d, 0xbd,
-  0x90, 0x64, 0x89, 0xa2, 0x9d, 0x11, 0x66, 0x7f, 0xd5, 0x3f, 0xd0, 0x03,
-  0x6f, 0x03, 0x27, 0x86, 0x85, 0x09, 0x86, 0xab, 0xfd, 0x25, 0x98, 0x3f,
-  0xc2, 0x45, 0xd3, 0xfc, 0x2a, 0xd4, 0x1e, 0x0c, 0x51, 0x07, 0x93, 0x17,
-  0x38, 0x88, 0xc3, 0x94, 0x66, 0x49, 0x21, 0x6d, 0x83, 0xa0, 0x80, 0x32,
-  0x34, 0x68, 0x28, 0x31, 0xf9, 0x44, 0x26, 0xa2, 0x3d, 0x2d, 0x78, 0x0b,
-  0x23, 0xa6, 0x25, 0x9b, 0x4c, 0x49, 0x99, 0x27, 0xbd, 0x46, 0x02, 0x62,
-  0x4b, 0x30, 0x58, 0x8a, 0x60, 0x84, 0x46, 0xee, 0x66, 0xa7, 0xa8, 0x68,
-  0x40, 0xf6, 0xc5, 0x7d, 0x0c, 0x73, 0x9b, 0x45, 0x46, 0xd8, 0x78, 0x6b,
-  0x5d, 0x95, 0xd6, 0x31, 0x73, 0x3b, 0x20, 0xb3, 0x62, 0x07, 0x04, 0x88,
-  0x94, 0xe8, 0x0e, 0x22, 0x28, 0x4e, 0xbd, 0x71, 0x27, 0x32, 0x74, 0xb5,
-  0x66, 0x61, 0x7e, 0xaa, 0xc6, 0xe2, 0x6c, 0x0c, 0x98, 0x2c, 0x3b, 0x65,
-  0xd4, 0xc5, 0x78, 0x01, 0x29, 0xc4, 0xd3, 0x34, 0x09, 0x6e, 0xd8, 0x3b,
-  0x5b, 0xfd, 0x1b, 0x73, 0x9c, 0x09, 0x7b, 0x7c, 0x90, 0x0e, 0x2e, 0xc0,
-  0x91, 0xfc, 0x48, 0x41, 0x52, 0x44, 0x43, 0x41, 0xb0, 0x93, 0x29, 0x66,
-  0x16, 0xaf, 0xe0, 0x7b, 0x8e, 0x19, 0x36, 0x95, 0x14, 0xbd, 0x26, 0x84,
-  0x23, 0xa7, 0xdc, 0x12, 0x7b, 0x68, 0xb2, 0x33, 0xc5, 0x28, 0x00, 0x01,
-  0xa9, 0x09, 0x41, 0x7b, 0x31, 0xfd, 0x23, 0x1c, 0x49, 0x91, 0x63, 0x89,
-  0x29, 0x1c, 0xd8, 0x29, 0x62, 0x9c, 0x56, 0x52, 0xd0, 0x1b, 0x91, 0xc3,
-  0xa8, 0xa0, 0xc0, 0x89, 0xd7, 0x1c, 0x88, 0x93, 0x40, 0x11, 0x64, 0xc2,
-  0x82, 0x35, 0xcf, 0xc0, 0x16, 0xb0, 0x52, 0xe1, 0x29, 0xfd, 0x04, 0x54,
-  0xe0, 0x1b, 0xc3, 0x89, 0x16, 0x56, 0x6d, 0x1d, 0x65, 0xf2, 0xb2, 0x8a,
-  0xd6, 0x52, 0xb2, 0x9e, 0x9b, 0x2f, 0x6d, 0x17, 0x06, 0x3f, 0x5b, 0x21,
-  0x29, 0x61, 0x48, 0x6c, 0x45, 0x90, 0xec, 0x9b, 0x45, 0x97, 0x0c, 0x84,
-  0xa7, 0x25, 0x6a, 0x5e, 0x2b, 0x07, 0x0d, 0x26, 0x53, 0xf6, 0xdb, 0x21,
-  0x12, 0x03, 0x20, 0xc0, 0x98, 0x37, 0x01, 0x9b, 0x2c, 0x15, 0x90, 0x7a,
-  0xbc, 0x29, 0x00, 0x35, 0x70, 0x21, 0x80, 0x85, 0xc1, 0x61, 0xc2, 0x4e,
-  0x0c, 0xaf, 0x57, 0x64, 0xa8, 0x33, 0x49, 0xa2, 0x65, 0x74, 0x84, 0xc0,
-  0x81, 0x24, 0x2c, 0x16, 0x21, 0x61, 0xc6, 0x96, 0xb4, 0x6e, 0xba, 0x6b,
-  0xea, 0x06, 0xa0, 0x55, 0x75, 0x04, 0x02, 0x52, 0x68, 0x3c, 0x2f, 0x13,
-  0xb6, 0x8b, 0xcf, 0x34, 0x18, 0xfe, 0x2f, 0x06, 0x9c, 0x36, 0x10, 0xe1,
-  0x33, 0x6e, 0xd3, 0x65, 0xb0, 0xbd, 0xe3, 0x2f, 0x80, 0x03, 0x65, 0x4a,
-  0x84, 0xd3, 0xd0, 0x80, 0x1d, 0xac, 0x9a, 0x67, 0x20, 0xaf, 0x20, 0x63,
-  0x16, 0xc4, 0x61, 0xbf, 0xd6, 0x2f, 0x63, 0xb4, 0xea, 0x35, 0x25, 0x5f,
-  0x51, 0x33, 0x5e, 0xdc, 0xde, 0x19, 0x86, 0x3d, 0x60, 0x22, 0xe6, 0x34,
-  0x34, 0xa2, 0x28, 0x3d, 0xeb, 0xc1, 0xc2, 0x1e, 0x81, 0x98, 0xcc, 0x18,
-  0x43, 0x73, 0x54, 0x5d, 0x6c, 0x29, 0x3e, 0x55, 0x5a, 0x92, 0xa2, 0x49,
-  0x9c, 0xb0, 0x73, 0x8d, 0x90, 0xec, 0x51, 0xa4, 0xd9, 0x8c, 0x88, 0xba,
-  0xad, 0x6b, 0x69, 0x6b, 0xdc, 0x5b, 0xf6, 0x66, 0x92, 0xa2, 0x99, 0x77,
-  0x82, 0xdd, 0xa3, 0x49, 0x25, 0x03, 0x95, 0x30, 0x86, 0x73, 0x39, 0x34,
-  0x28, 0x4c, 0xe4, 0x3b, 0x94, 0xbb, 0x11, 0x26, 0x16, 0x22, 0xe6, 0xe0,
-  0x47, 0x1f, 0x34, 0x38, 0x36, 0x21, 0x20, 0x4d, 0xd7, 0x17, 0x48, 0x8c,
-  0x88, 0x6c, 0x4d, 0x14, 0xb0, 0xe8, 0xf8, 0x24, 0x0d, 0xb1, 0x7b, 0xcc,
-  0x0f, 0x99, 0xc2, 0x8c, 0xbc, 0xe8, 0x61, 0x93, 0xdf, 0x10, 0xd4, 0x59,
-  0x72, 0x20, 0x96, 0x88, 0x12, 0x79, 0x52, 0x1d, 0x8b, 0xbf, 0xc0, 0xe0,
-  0xaf, 0x23, 0xca, 0x34, 0x48, 0xcb, 0xa7, 0x94, 0x7b, 0x3d, 0xf9, 0x09,
-  0x63, 0x90, 0x61, 0x11, 0x9b, 0x0a, 0x46, 0xc2, 0x61, 0x6d, 0x47, 0x08,
-  0x60, 0x29, 0xe3, 0xec, 0x73, 0x13, 0xc4, 0x3a, 0xc2, 0xcc, 0x18, 0x3b,
-  0xa8, 0x33, 0x34, 0x65, 0xfd, 0xbd, 0x14, 0xca, 0x88, 0xa7, 0x42, 0x19,
-  0x18, 0x81, 0x71, 0x09, 0x89, 0x79, 0x26, 0x2c, 0x7a, 0xb7, 0x0b, 0xb4,
-  0xa2, 0x73, 0xc5, 0x71, 0x65, 0x04, 0x86, 0x48, 0x41, 0x61, 0xc7, 0xb9,
-  0x8a, 0x55, 0xbd, 0x43, 0x25, 0x25, 0x20, 0xe0, 0x06, 0xfb, 0x91, 0x63,
-  0x14, 0x84, 0x08, 0xc1, 0x6b, 0x74, 0x6c, 0x0d, 0x17, 0x21, 0x6a, 0x36,
-  0x81, 0xf8, 0x25, 0x41, 0xe1, 0x90, 0x47, 0xc4, 0x93, 0x5e, 0x2d, 0x04,
-  0xa0, 0x5c, 0x87, 0x1c, 0xa0, 0x5b, 0x11, 0x31, 0xc0, 0x25, 0x64, 0x28,
-  0xe8, 0x09, 0xa9, 0x51, 0xc8, 0x02, 0x99, 0x3d, 0x23, 0xe3, 0x29, 0x00,
-  0x9d, 0xf9, 0x2d, 0x15, 0xd6, 0x99, 0x00, 0x04, 0x20, 0xd7, 0x1b, 0x06,
-  0x80, 0x12, 0xbc, 0x43, 0x5a, 0xea, 0x37, 0x2b, 0x35, 0x44, 0x54, 0x92,
-  0x69, 0xc5, 0x55, 0x01, 0x83, 0x30, 0x64, 0x24, 0x68, 0x2c, 0x9d, 0x3c,
-  0x6c, 0x2e, 0x56, 0x6b, 0x22, 0x9c, 0x1d, 0x55, 0xea, 0xf9, 0x2c, 0xef,
-  0xb5, 0x59, 0x8c, 0x6f, 0x24, 0x75, 0x04, 0x67, 0x17, 0x1d, 0xaa, 0x13,
-  0x5e, 0x65, 0x33, 0xd8, 0x29, 0x5c, 0x17, 0x70, 0x21, 0x07, 0x70, 0xad,
-  0x68, 0x56, 0x62, 0x5d, 0x93, 0x96, 0x60, 0x64, 0x1d, 0x3f, 0x51, 0x9f,
-  0x8b, 0x5f, 0x49, 0x4f, 0xfe, 0x28, 0x78, 0x2c, 0x79, 0x2c, 0x30, 0x29,
-  0xe8, 0x11, 0x2b, 0x03, 0x62, 0x45, 0x7a, 0xd4, 0x0f, 0x4b, 0x68, 0x0c,
-  0x8c, 0x41, 0xb5, 0xa2, 0x63, 0xb9, 0x86, 0xc8, 0x64, 0x04, 0xd7, 0xb1,
-  0xe2, 0xbe, 0x15, 0xd8, 0x56, 0x12, 0xc1, 0x23, 0x19, 0xd0, 0x7a, 0x32,
-  0x2f, 0x56, 0x63, 0x5b, 0x5b, 0x1f, 0x9d, 0x35, 0x2c, 0x40, 0x98, 0x80,
-  0x02, 0xfc, 0x5c, 0x5b, 0x25, 0x13, 0x8d, 0x2a, 0x41, 0x30, 0x68, 0x01,
-  0x60, 0xa7, 0x92, 0x7e, 0xa1, 0x73, 0x54, 0x08, 0xd2, 0x74, 0x78, 0xb5,
-  0x56, 0x37, 0x09, 0x28, 0x82, 0x04, 0xd8, 0xd9, 0x7b, 0x28, 0x15, 0x0e,
-  0xf5, 0xaf, 0x0a, 0x49, 0xc9, 0xa3, 0xf6, 0xd8, 0x28, 0x5a, 0x29, 0xaf,
-  0x25, 0x05, 0x84, 0x2a, 0xb0, 0x31, 0xe8, 0x65, 0x87, 0x75, 0x60, 0x34,
-  0x42, 0x80, 0xc9, 0xff, 0x63, 0x35, 0x64, 0x61, 0x36, 0x2f, 0x1f, 0x7e,
-  0x32, 0x5d, 0x00, 0x16, 0x36, 0x5f, 0xdc, 0x34, 0x73, 0x52, 0x46, 0x7b,
-  0xc0, 0x3a, 0x9b, 0x97, 0x16, 0xc7, 0x83, 0x08, 0xd6, 0x36, 0xf1, 0xb5,
-  0x12, 0x02, 0x2e, 0x62, 0x13, 0x09, 0x15, 0x7b, 0xac, 0x17, 0xde, 0x08,
-  0xba, 0xa4, 0x67, 0x21, 0x47, 0xc5, 0x70, 0x8c, 0xf7, 0x78, 0x35, 0x28,
-  0x7a, 0xbc, 0x75, 0x4c, 0xf5, 0x01, 0xe3, 0x71, 0xe9, 0x87, 0xf9, 0x23,
-  0x0a, 0xeb, 0x76, 0xaa, 0x0e, 0x5f, 0x2b, 0xd5, 0x1b, 0x0a, 0x2c, 0x09,
-  0x82, 0x43, 0xb7, 0x2c, 0x4f, 0x54, 0x73, 0x81, 0x26, 0xc5, 0x58, 0xbb,
-  0x48, 0x39, 0x6e, 0x40, 0xe8, 0x78, 0xb0, 0xe3, 0xc7, 0x06, 0xb2, 0x68,
-  0x2e, 0x68, 0xad, 0x07, 0x0a, 0xc7, 0xc8, 0x6d, 0x50, 0x0a, 0x7d, 0xd0,
-  0x28, 0x88, 0x3f, 0x9d, 0x74, 0xb1, 0x35, 0x42, 0x92, 0x25, 0xbc, 0x5c,
-  0x16, 0x9b, 0x60, 0x2f, 0x34, 0x01, 0x9a, 0xc5, 0x04, 0x39, 0x26, 0x0a,
-  0x02, 0x9d, 0x03, 0x5e, 0x7f, 0x17, 0x2b, 0x42, 0x2e, 0xc6, 0x43, 0x2e,
-  0xd3, 0x6a, 0x86, 0xf7, 0x00, 0x60, 0xe0, 0x36, 0x62, 0x13, 0xc2, 0x6b,
-  0x11, 0xbc, 0x2e, 0x1e, 0xa6, 0xca, 0x14, 0x6a, 0x52, 0xb0, 0xfe, 0x96,
-  0x1f, 0x46, 0x02, 0x92, 0xcb, 0x55, 0x78, 0xfe, 0x03, 0x7b, 0x09, 0x05,
-  0x7a, 0x41, 0xd7, 0x62, 0x45, 0x88, 0x30, 0x23, 0x95, 0xc0, 0x2d, 0x29,
-  0xfa, 0xc4, 0x5e, 0x99, 0x02, 0xcc, 0xdc, 0x0e, 0xf7, 0x24, 0x45, 0xc3,
-  0xd8, 0x59, 0x29, 0x61, 0x60, 0x26, 0x45, 0x60, 0xf8, 0x20, 0x8f, 0xf4,
-  0x05, 0x9b, 0xd0, 0x0c, 0xc5, 0x66, 0xd6, 0x9d, 0x41, 0xc2, 0x4e, 0x2f,
-  0x4e, 0x01, 0x61, 0x60, 0x75, 0x48, 0x59, 0xcc, 0xa8, 0x7f, 0xe9, 0x55,
-  0x53, 0x45, 0x44, 0x61, 0x3e, 0x28, 0x11, 0x0e, 0xb3, 0x21, 0x67, 0x87,
-  0x46, 0xae, 0x14, 0x3b, 0x8a, 0x70, 0x25, 0x5d, 0x9d, 0x4d, 0x66, 0x61,
-  0x08, 0x10, 0x5e, 0x16, 0x36, 0x0a, 0x29, 0x56, 0x31, 0x59, 0x89, 0x80,
-  0xa4, 0x48, 0x95, 0x18, 0x72, 0x82, 0xd8, 0x97, 0x67, 0x00, 0x4b, 0x13,
-  0xb0, 0x0a, 0x5d, 0x64, 0x64, 0x0d, 0x56, 0xaf, 0x08, 0x12, 0xe6, 0xdf,
-  0x29, 0x00, 0x84, 0x69, 0xb9, 0x31, 0x98, 0x0a, 0x49, 0xb9, 0x04, 0x48,
-  0xff, 0x70, 0x2f, 0x15, 0x92, 0x1e, 0x02, 0xcb, 0x7e, 0x52, 0xcc, 0x60,
-  0x38, 0x44, 0x30, 0x47, 0x21, 0xb8, 0xc5, 0x86, 0xe2, 0x02, 0xca, 0x6b,
-  0xde, 0x16, 0x02, 0x9c, 0xf1, 0x4c, 0x58, 0x0b, 0xe1, 0x5a, 0x3b, 0x1b,
-  0xb7, 0x4f, 0x57, 0x85, 0x4e, 0xc9, 0x47, 0xdf, 0x50, 0x2c, 0x26, 0xb5,
-  0x81, 0x97, 0x85, 0x5e, 0xa8, 0xcd, 0x6e, 0x02, 0x8f, 0x30, 0x27, 0x61,
-  0x32, 0x8c, 0xdd, 0xd4, 0xf1, 0x04, 0x27, 0x1d, 0x45, 0x4f, 0x44, 0x3b,
-  0x4c, 0x57, 0x01, 0x8a, 0x35, 0x92, 0x0a, 0xc2, 0xd0, 0x1a, 0x10, 0x5e,
-  0xd7, 0x1c, 0x80, 0x04, 0xc3, 0xb0, 0x42, 0x27, 0x06, 0xc1, 0x35, 0x54,
-  0x3b, 0x00, 0x10, 0x2c, 0x41, 0x97, 0xaa, 0x62, 0x05, 0xc0, 0x7e, 0xc3,
-  0xb0, 0x0c, 0x16, 0x1e, 0x02, 0x4d, 0x21, 0xf0, 0xc0, 0x0d, 0x27, 0x5b,
-  0x08, 0x2d, 0xae, 0x36, 0x7a, 0x9e, 0xeb, 0xf4, 0x0a, 0xc5, 0xd8, 0xcf,
-  0x83, 0xbe, 0x10, 0xe1, 0x1f, 0x43, 0xc2, 0x13, 0x12, 0x9c, 0x15, 0x22,
-  0x49, 0xc0, 0x3b, 0xc3, 0x8a, 0x81, 0x29, 0xd9, 0x13, 0x0f, 0x43, 0x4f,
-  0x4d, 0xf6, 0x53, 0x50, 0x45, 0x43, 0x07, 0xfe, 0x4d, 0x44, 0x2e, 0x45,
-  0x58, 0x45, 0xf6, 0x0f, 0xd1, 0xda, 0x4e, 0x0b, 0xe7, 0x07, 0x13, 0xb0,
-  0x0f, 0xc0, 0x59, 0xd5, 0x69, 0xc3, 0x6a, 0x63, 0x2d, 0xe9, 0xfe, 0x67,
-  0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0xdc, 0xf9, 0x70, 0x71, 0x37, 0x1d,
-  0x75, 0x76, 0x77, 0xe2, 0x78, 0x79, 0x7a, 0xa9, 0xac, 0x5b, 0xe3, 0x48,
-  0x6e, 0x05, 0x2e, 0x5c, 0xda, 0x02, 0x62, 0x0d, 0xcc, 0x10, 0xcd, 0x1a,
-  0x04, 0xec, 0x65, 0x78, 0x65, 0x49, 0x25, 0x86, 0x71, 0x0a, 0x92, 0xbe,
-  0x6f, 0x03, 0x00, 0x92, 0x01, 0x9c, 0x0a, 0x0c, 0x85, 0xc9, 0x38, 0x32,
-  0x0c, 0x72, 0x58, 0x32, 0x48, 0x00, 0xc8, 0x0c, 0xc8, 0x98, 0xc8, 0x88,
-  0x03, 0x0c, 0x36, 0x01, 0x00, 0x4a, 0xa3, 0xff, 0x31, 0xc0, 0xfa, 0x8e,
-  0xd0, 0xbc, 0x00, 0x7c, 0xff, 0xfb, 0x0e, 0x1f, 0xeb, 0x19, 0x5e, 0xfc,
-  0xac, 0x8a, 0x08, 0x85, 0xfb, 0xc5, 0xb4, 0x0e, 0x10, 0xbe, 0xeb, 0xcd,
-  0x10, 0xeb, 0xf2, 0xdf, 0x1c, 0xcd, 0x16, 0xcd, 0x19, 0xfc, 0xf4, 0xeb,
-  0xfd, 0xe8, 0xe4, 0xff, 0x04, 0x66, 0x5e, 0x2c, 0xba, 0xd0, 0x24, 0xdb,
-  0x8a, 0xc4, 0xc1, 0x05, 0xe3, 0xa7, 0x43, 0xd7, 0x95, 0x30, 0x1e, 0x91,
-  0x26, 0xc7, 0x8f, 0x78, 0xd2, 0x0d, 0x0a, 0x01, 0x63, 0x93, 0xc6, 0xb7,
-  0xc5, 0x79, 0x08, 0xa4, 0xba, 0x19, 0x67, 0x21, 0xbe, 0x57, 0xa0, 0x35,
-  0x1e, 0xd0, 0x8c, 0x02, 0xad, 0x70, 0x03, 0xfb, 0x40, 0x00, 0x40, 0x01,
-  0xfe, 0x07, 0x70, 0x08, 0x00, 0x96, 0x1c, 0xc3, 0x18, 0xfc, 0x68, 0x01,
-  0xfc, 0x02, 0x00, 0x09, 0x84, 0xdd, 0x02, 0x31, 0x70, 0xf3, 0x00, 0x80,
-  0x02, 0xff, 0xd9, 0x02, 0x18, 0x4f, 0xd0, 0x02, 0xfd, 0x7b, 0x31, 0x18,
-  0x2b, 0xf2, 0xa0, 0x05, 0xf9, 0x03, 0x43, 0x01, 0x37, 0xe0, 0x00, 0x60,
-  0xf9, 0x09, 0xf9, 0x07, 0x00, 0x0f, 0x00, 0x7b, 0x40, 0x0b, 0xf0, 0x2f,
-  0x6c, 0x12, 0x4a, 0xa6, 0xf0, 0xdb, 0x7c, 0x16, 0x18, 0xa4, 0x24, 0x26,
-  0x00, 0x67, 0x10, 0xc2, 0xf8, 0x6d, 0x42, 0xf7, 0x4a, 0xae, 0x7e, 0x20,
-  0x0d, 0xf0, 0x0a, 0x00, 0x15, 0x40, 0x1c, 0x20, 0x03, 0xd2, 0x0a, 0x00,
-  0xe6, 0x40, 0x06, 0x92, 0x0a, 0xb6, 0x4a, 0x11, 0xb7, 0x95, 0x40, 0x1a,
-  0x75, 0x18, 0x2a, 0x80, 0xc7, 0x3c, 0xac, 0x0b, 0xf9, 0xec, 0x4a, 0xae,
-  0x9e, 0x59, 0x0b, 0x02, 0x7c, 0x3c, 0x1b, 0xf0, 0x0b, 0x9b, 0x00, 0x2a,
-  0xc5, 0x1b, 0x6f, 0x00, 0x13, 0x48, 0x77, 0x20, 0x78, 0x3a, 0x0d, 0xd4,
-  0xda, 0x12, 0x68, 0xed, 0xda, 0x8d, 0x03, 0x65, 0x26, 0x36, 0x0c, 0x49,
-  0x55, 0xed, 0x99, 0x72, 0x01, 0x0a, 0xa1, 0xdf, 0x9a, 0x0b, 0x06, 0x04,
-  0x05, 0x6f, 0x00, 0x02, 0x03, 0xff, 0xff, 0x0e, 0x07, 0x24, 0x06, 0x08,
-  0x01, 0xff, 0x14, 0x08, 0x5c, 0x36, 0x03, 0x90, 0x54, 0xef, 0x74, 0x4f,
-  0x0f, 0x92, 0x10, 0x52, 0x6d, 0x50, 0x7b, 0x45, 0x8f, 0x01, 0x42, 0x6c,
-  0xef, 0x74, 0x6b, 0x46, 0xdd, 0x05, 0x79, 0x05, 0x20, 0xcf, 0x68, 0x80,
-  0x44, 0xbf, 0x81, 0x11, 0x9b, 0x7a, 0x76, 0x0b, 0x1f, 0x0f, 0x6b, 0x6f,
-  0x08, 0x86, 0x3f, 0xfe, 0x35, 0x07, 0x8c, 0xe7, 0x62, 0x01, 0xc8, 0x00,
-  0x89, 0xf8, 0x70, 0x04, 0x01, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0xff, 0xa4, 0x00, 0xff, 0x75, 0x03, 0xe8, 0x6a, 0x00, 0x72, 0xf6,
-  0x41, 0x8c, 0xc0, 0xe8, 0x55, 0x00, 0xe3, 0x66, 0x73, 0xf9, 0x49, 0x49,
-  0x74, 0x11, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xc9, 0x01, 0xc9, 0x89, 0xcd,
-  0x8a, 0x1c, 0x46, 0xf6, 0xd3, 0x31, 0xc9, 0xe8, 0x39, 0x00, 0x11, 0xc9,
-  0x75, 0x08, 0x41, 0xe8, 0x31, 0x00, 0x73, 0xfb, 0x41, 0x41, 0x81, 0xfd,
-  0xd1, 0x00, 0x83, 0xd9, 0xfe, 0x29, 0xe8, 0x72, 0x0e, 0x8e, 0xd8, 0x8d,
-  0x01, 0x28, 0xfc, 0x96, 0xf3, 0xa4, 0x96, 0x8e, 0xda, 0xeb, 0xb0, 0xd1,
-  0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0x50, 0x31, 0xc0, 0x8e, 0xd8,
-  0x58, 0x01, 0xd8, 0x01, 0xf8, 0xeb, 0xe2, 0x00, 0xff, 0x75, 0x03, 0xe8,
-  0x06, 0x00, 0x11, 0xc9, 0x00, 0xff, 0x75, 0x05, 0x8a, 0x3c, 0x46, 0x10,
-  0xff, 0xc3, 0x5d, 0x06, 0x1f, 0x8d, 0xb5, 0x82, 0xff, 0xad, 0x5b, 0x91,
-  0xad, 0x92, 0xad, 0x97, 0xad, 0x01, 0xc3, 0x8e, 0xc3, 0x31, 0xc0, 0x01,
-  0xc7, 0x26, 0x01, 0x2d, 0xac, 0x48, 0x74, 0x03, 0x40, 0x75, 0xf4, 0x81,
-  0xc7, 0xfe, 0x00, 0xe2, 0xf3, 0x07, 0x06, 0x1f, 0xbc, 0x00, 0x08, 0xea,
-  0xc8, 0x72, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x07, 0x1a
+	0x78,0xDA,0x1C,0x97,0x77,0x3C,0x14,0x8E,0xE3,0xC6,0x6F,
+	0x4F,0x77,0x0E,0xE7,0x8C,0xB3,0xF7,0x26,0xD9,0x2B,0xF3,
+	0x88,0x38,0x23,0x92,0x2D,0x7B,0x56,0x9C,0x53,0xD9,0x19,
+	0x39,0x2B,0x1A,0x7C,0xD2,0x32,0xD2,0x50,0x64,0xC5,0x71,
+	0x65,0x16,0x95,0x94,0x51,0xB2,0xA9,0xA4,0x3B,0x87,0x90,
+	0x90,0x71,0xF7,0xFB,0xBE,0x7E,0xCF,0xEB,0xF5,0xBC,0x5E,
+	0xCF,0xFF,0xEF,0xE7,0x8F,0xE7,0x71,0xF4,0xB2,0x00,0x5A,
+	0x01,0x80,0x00,0x10,0xC0,0x00,0xC3,0xE5,0xA2,0x04,0xFF,
+	0x17,0xFE,0x5F,0x62,0xFF,0x33,0x0A,0xE0,0x82,0x68,0x0F,
+	0xB5,0xEC,0x7C,0x9F,0x45,0xDB,0x91,0x78,0xF2,0x22,0xBD,
+	0xE0,0x2D,0x14,0x0A,0x28,0x9A,0x80,0xF6,0xF1,0x14,0x75,
+	0x1F,0xFE,0xA9,0x39,0xD0,0x48,0x8F,0xE6,0xC7,0xC5,0xFF,
+	0xBA,0xF6,0xBC,0x0E,0x8B,0xC5,0xC2,0x24,0xE1,0x84,0x57,
+	0x60,0x00,0x43,0x33,0xDD,0x7D,0xD0,0xDD,0xD9,0x53,0x1A,
+	0x03,0x06,0xA3,0x1E,0x9F,0xAE,0xAE,0xD2,0x96,0xE5,0x8A,
+	0x6B,0x2C,0x02,0x64,0xB2,0x00,0xEB,0x3F,0x00,0x80,0xCB,
+	0x7F,0x3E,0xB0,0x0F,0x8B,0xED,0x00,0x69,0xCE,0x74,0x08,
+	0x80,0xC9,0x3D,0x13,0xE5,0xE9,0x41,0xEB,0x2F,0xEA,0xE5,
+	0x1E,0xCF,0xFC,0xC7,0xA5,0x20,0xF3,0xE0,0x5C,0x85,0x5C,
+	0x08,0xC9,0x8A,0xBD,0xE1,0xB7,0xDA,0x47,0xC7,0x8A,0x71,
+	0x6D,0xA2,0xDC,0x5C,0x5C,0x3D,0x98,0x67,0xB9,0xE0,0x4C,
+	0x33,0x2C,0x19,0x98,0x80,0x9A,0xA6,0xCB,0xE8,0x30,0xB9,
+	0x4F,0x49,0x99,0xAF,0x41,0x4C,0x17,0xE0,0x34,0x33,0x1B,
+	0x94,0xC4,0xF5,0xA8,0x94,0x20,0xE7,0x13,0xA4,0xC8,0x87,
+	0xED,0x68,0x00,0xE3,0x53,0x50,0x2B,0x91,0xCB,0xCB,0x03,
+	0x65,0xB4,0x8B,0xF0,0xA7,0x65,0xB8,0x32,0xFF,0xE3,0x76,
+	0x4E,0xCB,0x01,0x8E,0x55,0x72,0x83,0xC0,0x14,0x30,0xEB,
+	0x25,0x60,0x9B,0x0B,0xBB,0xE7,0x9A,0x4A,0x11,0xE0,0xEA,
+	0xC5,0xC2,0xE8,0x16,0x2C,0x47,0xDF,0x57,0x90,0x23,0xDD,
+	0xD5,0x5D,0xD8,0xCA,0x0A,0xD7,0x27,0x9C,0x55,0x0E,0x05,
+	0x57,0xDA,0x11,0x28,0x64,0x63,0x11,0x85,0x37,0x4E,0x7D,
+	0xE8,0x0A,0xA0,0x08,0x4E,0xC2,0x1E,0x3F,0xC7,0x62,0x7E,
+	0x71,0x29,0xF0,0x7D,0x6E,0xC2,0x69,0x7A,0x56,0xF1,0x23,
+	0xD1,0xB3,0x12,0x59,0xAE,0xB8,0xB7,0x71,0xBA,0x64,0x28,
+	0xBD,0x6A,0x1F,0xC0,0x06,0xD3,0xEB,0x65,0x9B,0xB7,0x6D,
+	0x62,0x06,0x60,0x62,0x53,0x40,0x00,0x74,0x9E,0x08,0x03,
+	0xD0,0xDF,0x51,0x04,0x17,0x38,0x6C,0x01,0xFA,0x37,0x16,
+	0xFA,0xF3,0x21,0x9D,0xCB,0xAD,0x6E,0x95,0xAD,0x96,0x6A,
+	0xE8,0x4F,0x01,0xAE,0xB7,0x8B,0x35,0xBD,0x29,0x3F,0x1C,
+	0xE5,0x64,0xF6,0x8B,0x95,0xE1,0x45,0xA3,0x57,0xCF,0xB5,
+	0xBF,0xE2,0x40,0xDB,0x88,0xA2,0x78,0x07,0xE5,0xEE,0x5F,
+	0x27,0x98,0x8F,0xA3,0x71,0xCA,0x8C,0x0E,0x16,0x26,0x45,
+	0x37,0xF2,0xB5,0x5E,0x17,0x56,0xA1,0x3F,0x8B,0x03,0x6C,
+	0x70,0x47,0xA6,0x71,0x81,0xB5,0xCC,0x39,0x48,0xDA,0x73,
+	0x20,0x15,0x3C,0xCD,0x34,0x01,0xDD,0xE2,0xC2,0x98,0x77,
+	0x91,0xAC,0x9B,0x48,0xFA,0xD9,0x9B,0xCC,0xB1,0x88,0x16,
+	0xB7,0x24,0x75,0x55,0xD3,0xAE,0x87,0x14,0xA8,0x29,0x08,
+	0x30,0x95,0x80,0xA8,0x13,0xF2,0x60,0x9B,0x4C,0xB0,0x61,
+	0x70,0xAE,0x67,0x3F,0x6C,0x24,0xA8,0x98,0xB1,0x8D,0x00,
+	0x74,0xEC,0x74,0x4F,0x8F,0xA6,0x23,0xBE,0x45,0x7A,0x79,
+	0x3F,0x8E,0xE1,0xD1,0xBB,0x7D,0xC7,0x9D,0xB6,0xF6,0x33,
+	0x73,0xE5,0xD4,0xEA,0xDD,0x20,0xE0,0xBF,0x28,0xA5,0xFB,
+	0x67,0x01,0xE8,0xEB,0x80,0xCD,0xF4,0x01,0xD8,0xF9,0x5E,
+	0xE5,0x42,0x2E,0x98,0x46,0x3A,0xA0,0x79,0x70,0xB2,0x19,
+	0x7B,0xFB,0x85,0x1E,0x07,0xF4,0x78,0xAB,0xA4,0xD7,0x11,
+	0x8C,0xB0,0x98,0x0E,0xC4,0x34,0xDD,0xE9,0x27,0x3D,0x08,
+	0x9D,0xA0,0xE6,0xCC,0x78,0x16,0x61,0x1F,0xFA,0x64,0x55,
+	0x99,0x81,0x8E,0x2D,0x95,0x4A,0xF4,0x6F,0x8D,0xA0,0x17,
+	0x9F,0x85,0x0E,0x46,0x98,0xC6,0xF2,0x51,0xA1,0xAB,0x04,
+	0x36,0x82,0xCB,0xCB,0x88,0xA0,0xF5,0x75,0x44,0xC1,0xAB,
+	0xFC,0x95,0x00,0xF7,0x80,0xE7,0xA6,0x6D,0x21,0xE8,0x10,
+	0x9E,0xD2,0xCB,0xC1,0x6C,0xDB,0xCA,0x6B,0x66,0x39,0x41,
+	0xDA,0xFF,0xD0,0x20,0x03,0xBD,0x01,0x7C,0x02,0x4F,0x4A,
+	0x1C,0x5F,0x93,0x5E,0xF6,0xA0,0x21,0x38,0x1A,0x8D,0x6F,
+	0xBD,0xE2,0x3E,0xA8,0xBE,0xD2,0xE9,0x3B,0x8B,0xD0,0xCF,
+	0xE9,0x0C,0xD7,0x6F,0x97,0x73,0xEE,0x2F,0x98,0xC2,0x15,
+	0x3E,0x59,0xA7,0x0D,0x02,0xFB,0xBA,0x48,0x70,0x80,0xB9,
+	0x29,0x60,0x15,0x14,0xB7,0xF9,0x35,0x56,0xC8,0xD5,0x75,
+	0x1E,0xAA,0xE0,0x1C,0x68,0xA1,0x89,0x70,0x8D,0x2B,0x8B,
+	0x43,0xB9,0x72,0x2C,0x02,0xF3,0x24,0x32,0x5D,0xB5,0xF4,
+	0x0B,0xC5,0x9C,0x35,0x25,0x9C,0x8F,0xAC,0xBE,0x63,0x52,
+	0xC9,0xDF,0x7A,0x68,0x63,0xCF,0xBA,0x9C,0x2B,0x65,0x9C,
+	0x95,0xDF,0xEF,0x8A,0x4C,0xD0,0x08,0x3C,0xDE,0x4C,0xAC,
+	0x61,0x2B,0xCE,0x35,0xBD,0x28,0xBC,0x95,0x1F,0x23,0x15,
+	0x2E,0xE3,0x69,0x5B,0xDB,0x37,0x16,0xE3,0xCF,0xE8,0xF2,
+	0x61,0x7E,0x3D,0x60,0xED,0x5D,0x81,0x07,0xD3,0xF5,0x73,
+	0x64,0x83,0x41,0xAB,0x95,0x34,0xD7,0x3F,0xB1,0x27,0xB3,
+	0xBB,0x85,0xEE,0xE7,0x63,0xB9,0xFF,0xB9,0xE6,0x4B,0x94,
+	0xBA,0xAA,0x4A,0x1C,0x08,0x3B,0x13,0xB1,0xA2,0xCE,0x61,
+	0x2C,0x44,0x34,0x56,0x6C,0xE8,0xE2,0x54,0xBA,0x59,0x0E,
+	0xFE,0x72,0x6C,0xA0,0x30,0xD0,0x27,0xCE,0x6A,0x68,0xEE,
+	0x11,0x80,0xBA,0xEA,0xEF,0x56,0x21,0xCC,0xCD,0x25,0x71,
+	0xFA,0x49,0x5C,0x00,0xED,0x6C,0xFE,0xFB,0x7C,0x3F,0x06,
+	0xE7,0xC1,0x48,0x38,0x65,0xEB,0xF4,0x67,0x5C,0x7B,0xD2,
+	0xBB,0xB0,0xED,0xCA,0xAC,0xD2,0x1A,0xBE,0xA4,0x7B,0x6D,
+	0x31,0x05,0x95,0x83,0x78,0x67,0x42,0x8D,0x73,0x47,0xC2,
+	0x45,0xD1,0x7A,0x64,0xC4,0x2A,0xA0,0xF2,0x8E,0x60,0x39,
+	0x01,0x1F,0xDA,0x52,0xF8,0x24,0x6A,0x1C,0x99,0x58,0x89,
+	0xFF,0xAB,0x87,0xAF,0x9E,0x29,0xA1,0x11,0x2A,0x91,0xA1,
+	0x39,0x54,0xDF,0xDD,0xF0,0x1E,0xBE,0xC4,0x93,0x47,0x46,
+	0x81,0xAD,0x30,0x1E,0xBE,0xD8,0x46,0x68,0x65,0x59,0xCD,
+	0x18,0x33,0xAC,0xED,0xE8,0xD9,0xF1,0xC2,0x53,0x5C,0x4E,
+	0x36,0xE1,0x8A,0x2B,0x45,0x08,0xB9,0x06,0x75,0xE6,0xC2,
+	0x3E,0x43,0x9A,0x9E,0x5E,0x99,0x35,0xEB,0x6E,0xBC,0x69,
+	0xD9,0x46,0xB9,0x62,0x92,0xB4,0xF3,0xA7,0x5A,0xEC,0xE6,
+	0xF4,0x02,0xBB,0x57,0x8F,0xA1,0xD0,0xE6,0x93,0x47,0xC0,
+	0xC4,0x6E,0x6F,0xEF,0x7C,0xA7,0x61,0x25,0xF6,0x0D,0x27,
+	0xA8,0x20,0x5B,0x6A,0xBE,0x9E,0x47,0xDB,0xD7,0x76,0x28,
+	0x07,0x30,0xF2,0x63,0x64,0xF4,0xFB,0x1E,0x7B,0xF1,0x4F,
+	0xE6,0xCB,0xDF,0x61,0xD5,0x62,0x43,0xFA,0x44,0x7F,0x0E,
+	0xEA,0xEC,0x02,0x92,0x51,0x90,0x61,0xA6,0xE4,0x6D,0x49,
+	0x41,0xCB,0x52,0xF4,0x9C,0x2C,0x2F,0x0A,0x4A,0x18,0xBB,
+	0x56,0xCC,0xB7,0x9B,0x00,0xE3,0x20,0xAB,0x26,0x20,0xAA,
+	0x78,0xF9,0x2D,0x2D,0xF3,0x34,0x71,0x57,0xD6,0x19,0x18,
+	0x3D,0x1B,0xAF,0xF4,0xA9,0x22,0xF4,0x14,0xF2,0xD6,0xC1,
+	0x11,0x2E,0x2D,0x95,0x13,0xE6,0x29,0x5E,0x9F,0x8F,0x7E,
+	0x68,0x1C,0xCA,0xA0,0x0A,0x56,0x3E,0x0E,0x2F,0xF0,0x8D,
+	0x31,0x86,0x4D,0x63,0xA0,0x03,0x88,0x18,0x80,0xDE,0x58,
+	0xB7,0x4B,0x58,0xB6,0xF9,0x78,0x02,0x84,0x53,0x27,0x57,
+	0xD3,0x79,0xCE,0xF3,0x47,0x62,0x5B,0x78,0xE8,0x80,0x45,
+	0x18,0x09,0x52,0x67,0x78,0xFD,0xD0,0xCE,0x98,0xCA,0x89,
+	0x13,0xBC,0xCF,0x8B,0xA5,0xAD,0xBF,0x50,0x35,0x9F,0x37,
+	0x88,0xD3,0x36,0xDC,0xA5,0x34,0x6B,0xE8,0xEE,0xA0,0x3D,
+	0xE8,0x1F,0xF4,0x1C,0x8B,0x21,0x75,0x1D,0x56,0xA9,0xCB,
+	0x74,0x85,0x99,0xA0,0x68,0x37,0xF5,0xC7,0x94,0x31,0xE2,
+	0x30,0x99,0x42,0x9A,0x36,0xD6,0xCB,0x88,0x6B,0x78,0x18,
+	0xB9,0xF4,0xED,0xBE,0x0F,0xEB,0xBA,0xF7,0x53,0xD1,0xD8,
+	0xF7,0x5F,0x42,0x3C,0xDE,0x61,0xB0,0x9A,0x32,0x41,0x41,
+	0x2A,0xDC,0x8E,0x33,0x41,0xB4,0x61,0xE6,0xA9,0xB0,0xB3,
+	0xEF,0x43,0x83,0x2A,0xFA,0x23,0x82,0xB4,0x76,0xF6,0x2A,
+	0xC2,0xA1,0xFE,0x07,0x62,0x6A,0x8A,0x46,0xEB,0x61,0x15,
+	0x61,0x41,0x75,0x3F,0x24,0x67,0xF3,0x14,0xA4,0x42,0x5B,
+	0x39,0xB0,0xF0,0xD8,0x5D,0xAD,0x45,0xA1,0x9A,0x76,0x04,
+	0x3A,0x79,0xC1,0x20,0x8D,0x03,0x9C,0xE0,0x7B,0x8F,0x26,
+	0x6E,0xEE,0xD3,0x9C,0xB6,0x80,0xBB,0xC8,0xA0,0xBC,0xB3,
+	0xCF,0xB9,0x92,0xE8,0x3B,0x5F,0x35,0xF3,0x9C,0x76,0x7F,
+	0xE4,0x3A,0x6D,0xE7,0x7B,0xB8,0x6F,0x83,0xFD,0xB6,0x79,
+	0xDE,0xEE,0xE9,0xE5,0xC3,0x5A,0x35,0x36,0x09,0x1A,0x5B,
+	0xA7,0x54,0xB8,0xA1,0x9B,0x23,0x1E,0x5B,0xDF,0x77,0xA3,
+	0x25,0x0F,0x2E,0xCF,0x9D,0xCC,0xA7,0x6E,0xB7,0xBD,0xDE,
+	0xE4,0x8B,0x72,0xD3,0x4F,0xDD,0x04,0xBE,0xE5,0x9B,0x32,
+	0xEE,0xF4,0xF7,0x93,0xE8,0xC6,0x9A,0x7C,0x42,0x84,0x1C,
+	0x69,0xD8,0x5E,0xF9,0xC6,0xEC,0x6E,0x3E,0x6B,0x3E,0x0D,
+	0x34,0x9C,0x46,0x4A,0x7D,0x73,0x70,0x3D,0x69,0xA0,0x2B,
+	0xD9,0x00,0x8E,0x2B,0xC2,0xDF,0xCA,0x56,0x3F,0x9D,0x61,
+	0x5C,0xD9,0x10,0x87,0x18,0x6E,0x32,0xAD,0xB4,0xEF,0xF7,
+	0x84,0x4B,0x4B,0x05,0x80,0x3D,0x6B,0x0D,0xF4,0xC5,0x88,
+	0xA0,0x68,0x92,0xD2,0x3C,0x84,0xAD,0xCD,0x0A,0xE4,0x61,
+	0xE0,0xD2,0xBD,0x85,0x6D,0xF4,0x78,0xCD,0x71,0xE9,0x2F,
+	0xD9,0x2E,0x43,0x97,0x06,0xC3,0x41,0x5B,0xE5,0xC7,0x2A,
+	0xB1,0x80,0xAB,0xEB,0xD0,0x99,0x78,0x7E,0xD4,0x92,0x87,
+	0x58,0x46,0xE4,0x83,0xB8,0x68,0x31,0xBE,0x1F,0x09,0x27,
+	0x03,0xCF,0x5F,0x3D,0x53,0x1C,0x25,0x9E,0xAD,0xFB,0xB0,
+	0x73,0x15,0xC2,0xA2,0x1D,0x9F,0xA3,0xEE,0x87,0x63,0xD3,
+	0x1D,0x30,0x0F,0xD5,0x9F,0x8E,0x89,0x56,0xD7,0xEC,0x45,
+	0x61,0x3E,0x4D,0xC4,0x0C,0xA6,0x6C,0x4F,0x52,0xFC,0x14,
+	0x27,0x70,0x91,0xAD,0xD6,0xEF,0x59,0xCA,0x17,0xD7,0x5F,
+	0x4B,0x98,0x1C,0x5E,0x51,0x87,0x72,0x33,0x91,0x2C,0xB9,
+	0x77,0xCB,0xDA,0xEC,0x2E,0x17,0xE0,0x9F,0xF8,0xBE,0x1E,
+	0x43,0x65,0x0D,0xED,0x73,0xAD,0x1E,0x64,0x55,0x84,0x99,
+	0x8B,0xC4,0xC5,0x2B,0xB7,0x28,0xAD,0x8A,0xEB,0x11,0xA8,
+	0x99,0x1B,0x30,0xCF,0xB0,0xB2,0x9F,0xE5,0xCE,0x47,0x7A,
+	0xBA,0x56,0x0B,0xAD,0x41,0x37,0x07,0x31,0xE0,0x1F,0xB7,
+	0xCD,0x0A,0x7D,0x9A,0x40,0x91,0x71,0x9D,0xCE,0x4E,0x03,
+	0x66,0x66,0x37,0x40,0xF2,0xC6,0x35,0x4A,0xFE,0xEF,0xCC,
+	0x83,0xCE,0xE3,0x5A,0x78,0xD6,0xAB,0x53,0xF9,0x42,0x36,
+	0xC5,0x09,0xBF,0x6A,0xC0,0xF6,0xB7,0xB7,0x13,0x9C,0x08,
+	0xD8,0x7E,0xA7,0xAA,0xBA,0x47,0x0E,0x7F,0xF8,0xFD,0x92,
+	0xCB,0x22,0xF6,0x2A,0xBD,0x52,0x6F,0x9D,0x0D,0xBB,0x94,
+	0x1F,0x8B,0xCD,0xF7,0xE8,0x9A,0x4B,0x0C,0x3E,0x27,0x62,
+	0x9C,0x4C,0xDB,0xEB,0xCD,0xEC,0xAD,0x7A,0x61,0xD7,0x79,
+	0x01,0xE8,0xB1,0xC7,0xF7,0x59,0xA1,0x68,0x89,0x22,0x74,
+	0x9A,0x62,0x72,0xDC,0x6C,0x93,0x60,0xAC,0xE7,0xD4,0xE6,
+	0xE5,0xA0,0x80,0xF0,0x52,0x98,0xF7,0x4C,0x4F,0xA3,0xF2,
+	0xA3,0xD2,0xC6,0xB1,0xE0,0x69,0x7C,0x9F,0xB6,0x8E,0xE4,
+	0x08,0xEC,0x1E,0x50,0x94,0x7B,0xB3,0xBA,0x15,0xB4,0x27,
+	0x31,0xC4,0x8F,0x53,0x4B,0x18,0x03,0x04,0xA2,0xD8,0xDC,
+	0xF8,0x72,0xB0,0xA3,0x29,0xAD,0x7B,0x57,0xB5,0xEE,0xF7,
+	0xAD,0xD5,0x4D,0x22,0x41,0xBE,0x8F,0x11,0x2C,0x01,0x85,
+	0x66,0x04,0x5D,0xF2,0x2E,0xEA,0x2B,0x04,0xB2,0xBD,0xF5,
+	0x46,0x32,0x00,0xAD,0xA1,0xB8,0xB3,0x44,0xA6,0x6D,0xD0,
+	0x0F,0x63,0x8F,0xED,0xF8,0x18,0xE3,0x45,0x4B,0x7C,0x6B,
+	0xCB,0x96,0xFF,0x36,0x53,0xC4,0x31,0xE6,0xED,0xBA,0xAA,
+	0x31,0x26,0x66,0x17,0x4E,0xDC,0x5C,0x17,0xB0,0xD5,0x15,
+	0x8F,0x11,0x44,0xC5,0x87,0xF1,0x79,0x23,0xF7,0xA6,0xE2,
+	0x05,0x17,0xE7,0xF0,0xFB,0xB4,0x0D,0x09,0xFB,0x78,0x8C,
+	0x79,0x5B,0xAA,0x02,0xF5,0x80,0xE0,0x9D,0x73,0x25,0x10,
+	0xFF,0xC6,0xAF,0x93,0x30,0x00,0xCC,0x1C,0xBF,0xE9,0xF1,
+	0x4A,0xCF,0xB0,0x3F,0x1E,0xCD,0x73,0x9E,0xC1,0x0D,0x48,
+	0xDD,0x73,0xB0,0xA4,0x27,0xD2,0x46,0x99,0xED,0x6B,0x27,
+	0xE8,0x4D,0x8F,0xEE,0x9C,0x38,0xF6,0xBD,0x22,0xDF,0x75,
+	0x51,0x21,0x17,0xFE,0xC3,0x56,0x9A,0xD7,0x16,0x44,0xE3,
+	0x5A,0x1A,0x23,0x79,0xE1,0x60,0xAE,0xA5,0xB7,0xC4,0x22,
+	0xA0,0x8F,0xBF,0x81,0x57,0x27,0x18,0x62,0x0C,0x45,0x60,
+	0x61,0x56,0x2C,0x38,0x6F,0xE7,0x88,0x75,0xA6,0x78,0x5E,
+	0x06,0x96,0x51,0xB5,0xEA,0xE9,0xA1,0xE5,0x83,0x71,0x3E,
+	0x83,0xA6,0xBB,0xA2,0xBD,0x5A,0xF4,0x5E,0x9B,0x84,0xB7,
+	0x7F,0xB1,0xA4,0x9F,0x41,0x4E,0xCC,0x0B,0x51,0x2B,0x32,
+	0x38,0x9C,0x03,0x60,0x5A,0x79,0xF6,0x68,0x82,0x7C,0x5F,
+	0xF6,0x7E,0xCC,0xAA,0xFA,0x6B,0x33,0xDB,0x29,0xE0,0xCE,
+	0xF1,0x25,0x2F,0x24,0xD6,0x06,0x38,0x88,0xBA,0x06,0x9A,
+	0x2E,0x64,0xEF,0x6B,0xE4,0xBE,0xE5,0x74,0xE3,0xE0,0xB9,
+	0xD0,0x10,0xCD,0x77,0x80,0x38,0x80,0xA7,0x50,0x6E,0x3F,
+	0xA4,0xD3,0x22,0x26,0x99,0x40,0x67,0x47,0x1B,0x9B,0xF0,
+	0xE6,0xF7,0xC5,0xFE,0x1A,0xE5,0x0A,0x6B,0x2B,0xAE,0xF0,
+	0x23,0x97,0x8C,0xF1,0x90,0xDA,0x30,0x91,0x9C,0xFC,0x8E,
+	0xFF,0xF2,0xB5,0xCE,0x25,0x47,0x6F,0x38,0xDA,0x5F,0xD2,
+	0xF1,0x50,0x57,0x34,0xBE,0xAB,0x45,0xAC,0x63,0x4A,0xB4,
+	0x55,0x8A,0x83,0x09,0xFC,0x96,0x43,0x02,0xCE,0x0E,0x7D,
+	0x5A,0x54,0xC3,0x79,0x63,0x87,0x68,0xA2,0xC4,0x34,0x96,
+	0x60,0xC1,0xFB,0xDC,0xD1,0x73,0xE8,0xAB,0xD7,0xC7,0x51,
+	0x0D,0xD8,0xA2,0x61,0x40,0x17,0x81,0x79,0xD9,0x01,0x69,
+	0xD7,0x0B,0xA7,0x88,0x49,0x29,0x39,0xFE,0xE7,0x13,0x29,
+	0xE0,0x0D,0x12,0x85,0xE5,0xC8,0x17,0x16,0xF0,0xF8,0x1A,
+	0xAE,0x29,0x11,0x3C,0x02,0x2E,0x9F,0x97,0xAC,0x93,0x1C,
+	0x2B,0xEC,0xDD,0x1E,0xE0,0xDB,0x3D,0xC4,0xEE,0x47,0x5F,
+	0xF6,0x88,0x7C,0x4E,0xB8,0x7C,0x82,0x95,0xE3,0x59,0x8F,
+	0xA2,0x12,0xF3,0x0E,0x44,0x54,0xB6,0x8F,0x3A,0x66,0xDA,
+	0x17,0xA8,0xEE,0xEC,0x82,0xAD,0x81,0x75,0x69,0x7C,0xFB,
+	0x86,0x73,0x71,0x33,0x92,0x25,0x07,0xDD,0x89,0x5F,0xAE,
+	0xB8,0x26,0x53,0x8C,0xC5,0x3E,0x83,0x64,0x6A,0x8D,0xC1,
+	0x27,0xB8,0x2B,0x4C,0xA6,0x7D,0x6E,0x83,0x7E,0x68,0x77,
+	0x7A,0x57,0x75,0x31,0x64,0x95,0xEE,0x2B,0x5A,0xA0,0xA1,
+	0x97,0xC5,0x1B,0x9E,0x34,0x9F,0x57,0x26,0x68,0x99,0x3F,
+	0x2A,0x48,0x6C,0xC6,0x62,0x06,0xA4,0xB2,0xAD,0xBE,0xAE,
+	0xA0,0x52,0x47,0x3E,0x8A,0xA1,0x11,0xE8,0x05,0x76,0xB5,
+	0x9A,0x4C,0xCA,0x72,0x21,0x69,0x19,0x0D,0x0C,0x58,0xC8,
+	0x23,0x6D,0x4C,0x38,0x8F,0xB0,0xF7,0x97,0x91,0x21,0x6B,
+	0xD1,0xF0,0x15,0x6F,0xBD,0xB1,0xF9,0x05,0x24,0xF6,0xB7,
+	0x22,0x5A,0x66,0xDB,0x94,0x7F,0x7A,0xF9,0xB4,0x6D,0x33,
+	0x01,0x55,0xCE,0x16,0x62,0xD9,0xAB,0xC0,0x0A,0x7C,0xFD,
+	0xD6,0x63,0xF9,0x69,0x7E,0x2C,0xBB,0x0D,0x8D,0xBE,0xDF,
+	0xB8,0x8C,0xD8,0xB5,0x97,0xAB,0xF0,0x46,0xE4,0x46,0xD3,
+	0x9A,0xBD,0x88,0xB0,0x86,0xC8,0xC7,0x7F,0x58,0x3E,0xC3,
+	0xDB,0x59,0x12,0x46,0x6A,0xB0,0x2B,0xAC,0x75,0x5B,0x0E,
+	0x1D,0xD5,0xFE,0xE4,0xAA,0x5F,0xF1,0x4B,0x3E,0x2D,0x57,
+	0x39,0x95,0x45,0xDD,0x6B,0x44,0xDD,0x69,0xF4,0xBE,0xD7,
+	0xBE,0x5B,0xA5,0x8F,0x5B,0x3B,0xAF,0x7B,0xE7,0x5A,0x00,
+	0x4B,0x06,0xF8,0x4F,0x2E,0x72,0x4E,0x42,0xF0,0x5F,0xB5,
+	0x18,0xD0,0x4B,0x7C,0x5C,0x4E,0x6B,0xBF,0x60,0x82,0x3D,
+	0x2B,0xF6,0xD3,0xF1,0xA9,0xAB,0x65,0x72,0x75,0x10,0x22,
+	0xA5,0x19,0x58,0x78,0x63,0xA2,0x7A,0x9C,0xAF,0x07,0xF9,
+	0x58,0x62,0xF2,0xC8,0xF8,0x9D,0x78,0x0D,0x6E,0xE5,0xC4,
+	0x7E,0x39,0x58,0xDE,0x7A,0x8D,0x56,0x36,0x85,0x8C,0x15,
+	0x02,0x4A,0x7C,0xE2,0x33,0x96,0xC8,0x2C,0xEA,0x49,0x84,
+	0x98,0x4B,0x52,0x2D,0x8D,0x09,0xA8,0x6F,0xD4,0xC9,0x46,
+	0xB3,0x23,0xF4,0x67,0xD1,0x91,0x86,0xEF,0xD6,0x5D,0xEA,
+	0x0A,0xF5,0x07,0xB9,0x6D,0xF4,0x8E,0x11,0x01,0x8F,0x58,
+	0x88,0x65,0xE5,0xBC,0x8A,0x9D,0x61,0x2F,0x75,0xED,0x27,
+	0x7D,0x5C,0xE1,0x9E,0x95,0x97,0x9C,0xC3,0x9F,0x97,0xBE,
+	0x8D,0xD7,0x5E,0x27,0x9F,0xF9,0x48,0x75,0x4B,0x35,0xCB,
+	0x6F,0x9B,0x0E,0xB0,0x47,0x88,0x5C,0xA1,0xD2,0xAE,0x38,
+	0x8C,0xDA,0xDF,0xDF,0x4F,0xFB,0x4D,0xD3,0x43,0xD8,0x74,
+	0x9E,0xFC,0x07,0x4E,0x9E,0xE8,0x4B,0xB8,0x3D,0xB1,0x65,
+	0x20,0x7D,0x11,0x02,0x8D,0x5B,0x30,0x70,0x1B,0xBA,0xA0,
+	0xD0,0xBF,0xE5,0x0C,0x3F,0xF8,0x6E,0xE5,0xEB,0xF9,0xEE,
+	0x5A,0x21,0xAA,0xD1,0xD5,0xB8,0x97,0xDC,0xB4,0xB3,0x5D,
+	0x29,0x07,0x75,0xDE,0xFD,0x78,0x32,0x9B,0x18,0x9E,0xD9,
+	0x9F,0xBA,0xE5,0xFF,0x55,0x56,0xF8,0x82,0x64,0xE5,0xFD,
+	0x20,0xE1,0x2D,0xFF,0xDB,0x80,0xD6,0x3C,0x78,0x95,0xFA,
+	0x95,0x2F,0xCC,0x1B,0x55,0xE1,0x6B,0x0F,0xA6,0xE8,0x02,
+	0xB3,0xC7,0x0B,0xFC,0x4F,0xBC,0x2C,0x17,0xEE,0xD3,0x88,
+	0xCB,0xFF,0x11,0xFA,0xA6,0xD2,0x61,0x38,0x46,0x08,0x5A,
+	0xB6,0x79,0x0A,0xC8,0xDF,0xBF,0x3F,0xB2,0x94,0x77,0xE3,
+	0xA6,0x2F,0x1A,0xE4,0xDF,0x03,0x2A,0x32,0xFF,0x35,0x99,
+	0x3C,0xE6,0xDC,0xFC,0x26,0x47,0x60,0x33,0x1A,0xB4,0xF9,
+	0x62,0x2B,0x8A,0xBF,0xE3,0xA1,0x7C,0x27,0x22,0x12,0xEA,
+	0x7B,0x50,0x55,0x17,0x0C,0x5D,0xDA,0xAA,0x0A,0x1B,0xDE,
+	0xAC,0x7A,0x06,0x4D,0x1E,0x33,0x0A,0xAC,0x8E,0x2B,0xF4,
+	0xAE,0xAF,0xEE,0x0B,0x0E,0xAA,0xF5,0x8E,0x2D,0x84,0x4D,
+	0x71,0xDA,0x71,0xEF,0x8A,0x69,0x89,0x4F,0x9A,0x62,0x83,
+	0x7A,0x10,0xED,0x35,0x41,0x41,0x81,0x6C,0xB1,0x98,0x69,
+	0xE1,0xAD,0xEC,0x69,0x8A,0xFE,0x2B,0x38,0x2C,0x41,0xA4,
+	0xF0,0x8B,0xC0,0x9D,0x4B,0xFF,0x79,0x79,0xAF,0x9C,0x6F,
+	0xD6,0x87,0xAB,0x79,0x16,0xE4,0xCC,0x6E,0xD1,0xE8,0x1D,
+	0x81,0xF8,0x7B,0xE1,0x88,0x35,0x59,0x66,0xA9,0x59,0x69,
+	0xE6,0x23,0xDB,0x4F,0xC0,0xE4,0x52,0xD0,0x3D,0x13,0xC1,
+	0xC2,0x8E,0x28,0x2C,0xFC,0x82,0x20,0x5D,0xB0,0xC3,0xE5,
+	0x21,0xEB,0x48,0xF4,0x33,0x48,0xDD,0xB4,0x70,0x68,0xD4,
+	0x91,0x26,0x64,0x36,0xC1,0x9F,0xD7,0x87,0x10,0xD5,0xD8,
+	0x71,0xAB,0x65,0xD1,0xE5,0x90,0xB7,0xD7,0xB7,0xA5,0x52,
+	0xC0,0xF1,0x21,0xB4,0xBD,0xA2,0x59,0xDD,0xAC,0xF7,0x6E,
+	0x05,0xAF,0x44,0xE8,0xA4,0xDF,0xF0,0x23,0x0C,0x4F,0xC1,
+	0xF0,0x95,0xC8,0xA3,0xF8,0x24,0x87,0x27,0x7B,0x37,0x81,
+	0x13,0x69,0x40,0x90,0x95,0xD4,0xB7,0xBD,0xAA,0x50,0x05,
+	0x24,0xCF,0xA8,0x6E,0x63,0x65,0xBC,0x5C,0x2B,0x4D,0x22,
+	0x5E,0x62,0xF6,0xC0,0x7C,0xD1,0x49,0x7E,0x0E,0x11,0x44,
+	0xCA,0xE4,0xE8,0xFB,0x06,0xE4,0x87,0xBB,0x08,0x35,0x14,
+	0xBB,0x86,0x83,0x99,0xB0,0xBE,0x5B,0x02,0x4C,0xC4,0x48,
+	0x88,0xAE,0x93,0xC3,0x0C,0x54,0xA2,0x20,0xC8,0x80,0xF9,
+	0xF9,0x46,0x9D,0xBD,0x5B,0x38,0x54,0xD0,0xC4,0xEB,0xF8,
+	0x1C,0x5F,0x26,0x4C,0x6F,0x5E,0x9A,0x0F,0x66,0xE0,0x8A,
+	0xF0,0x9D,0x96,0x86,0x6E,0xAA,0x11,0x5F,0xEE,0xC1,0xD3,
+	0x34,0x24,0x21,0x30,0xA1,0x33,0xCE,0x7A,0x47,0x8F,0x87,
+	0x1F,0xC4,0xA4,0xB2,0x2E,0xAA,0x27,0x7A,0xDE,0x99,0x55,
+	0x73,0xD4,0x82,0x42,0xAB,0x55,0x01,0xC1,0x7B,0x93,0x3E,
+	0x57,0x07,0xEC,0x5B,0x3F,0x83,0x19,0x9D,0x74,0x4D,0xE3,
+	0x87,0xF8,0x15,0x2C,0xDB,0x42,0x4E,0xF5,0x76,0xF8,0x6F,
+	0x5D,0x4D,0x1E,0xB6,0xD8,0xB9,0x9F,0x1B,0x47,0x8A,0xAA,
+	0x36,0xF6,0x8F,0xEF,0xB2,0x7C,0x58,0xA3,0x1C,0x1F,0x1D,
+	0x5B,0x2E,0xCF,0xF9,0xCF,0xA0,0x28,0x85,0x8F,0x81,0x89,
+	0xA4,0xE4,0x6E,0x0E,0xF3,0xA3,0x43,0xF7,0x2E,0x69,0xF2,
+	0x04,0x7F,0x87,0x86,0x57,0xA8,0x80,0x7F,0x9D,0x26,0x2D,
+	0xBF,0xE8,0x92,0x56,0xB7,0x69,0xC7,0x4B,0xC2,0x04,0x12,
+	0xE1,0x22,0xAA,0x74,0x7C,0xB8,0xBD,0x2D,0x3B,0x2F,0xCC,
+	0xF1,0x0A,0x8C,0xC3,0xFE,0xD4,0xC8,0x9B,0x0F,0x1F,0x9B,
+	0xFD,0xD2,0x08,0xE1,0xC2,0xE4,0x79,0x01,0x9D,0xB8,0x05,
+	0x80,0x72,0xFF,0x17,0x60,0xEB,0xBC,0x33,0xAE,0x4D,0x43,
+	0x8E,0x77,0x70,0x6C,0xE1,0x8D,0x8E,0xE7,0x38,0xC2,0x19,
+	0x0C,0xFD,0x1B,0x8F,0xCA,0x23,0x33,0x12,0xD2,0x01,0x52,
+	0x89,0x6C,0xF8,0x49,0x7D,0xD5,0x9D,0x09,0x2B,0x1F,0x43,
+	0x49,0x54,0x3D,0xCC,0xE4,0xC9,0xC4,0x97,0xD6,0x05,0x65,
+	0x28,0x2A,0xCC,0x19,0x0E,0x3D,0x1F,0x9B,0x6C,0x0D,0x5C,
+	0x71,0x4B,0x1B,0x99,0xC4,0xC3,0x83,0x21,0x7A,0xC7,0x3A,
+	0xA2,0x9C,0x27,0x2B,0x60,0x44,0x28,0xB2,0x06,0x12,0x2D,
+	0x1B,0x38,0xB1,0xA0,0x63,0x98,0x58,0x74,0xCA,0x1A,0x65,
+	0xE4,0xD8,0xF7,0xE9,0x54,0x23,0x78,0x71,0x6C,0x01,0x88,
+	0x45,0x1E,0x1E,0xB3,0x46,0xFC,0xD1,0x6D,0x74,0xAC,0x45,
+	0x70,0x58,0x1B,0x9C,0x54,0xC1,0x4C,0x41,0x8C,0xE5,0x5A,
+	0xA1,0xE0,0x35,0x20,0x57,0x42,0x48,0x41,0xC8,0x46,0xA8,
+	0x4C,0xE8,0xF6,0xD3,0x25,0xD1,0x35,0x18,0x91,0x0D,0x0E,
+	0x04,0x5E,0x5C,0x17,0xBD,0xF4,0x57,0x74,0x4F,0xE8,0xA1,
+	0x28,0x9D,0x26,0xE7,0x18,0xC7,0xF6,0xF4,0x85,0x28,0x2C,
+	0xE9,0x3D,0xAC,0xEE,0x30,0xD8,0xF6,0x4A,0x37,0x86,0x01,
+	0x10,0x1A,0x96,0x3A,0x17,0x95,0xC4,0x34,0xAD,0xA5,0x9A,
+	0xA5,0x1B,0x14,0x0D,0xBC,0x89,0xBF,0xF7,0x44,0xE4,0x16,
+	0x08,0x95,0x11,0xFD,0x04,0xEB,0xAF,0x13,0x32,0xC6,0x8E,
+	0x30,0x98,0x83,0x31,0x07,0xD2,0x2D,0x27,0x3A,0xD5,0x8E,
+	0xCE,0x88,0xB1,0xE2,0x99,0xEA,0x0B,0x72,0x5A,0xB5,0x7B,
+	0x13,0xD4,0xC8,0xF7,0x4E,0x47,0x10,0x8E,0x1E,0x1D,0x50,
+	0xD1,0xBD,0x98,0x8E,0x19,0x46,0xD4,0xFD,0x56,0x38,0x87,
+	0x17,0x5C,0xAF,0xE3,0x37,0xB9,0x35,0xF8,0x55,0x73,0x08,
+	0xE5,0xF8,0x82,0xDD,0x89,0xE6,0x07,0x39,0x36,0x9F,0x64,
+	0x9C,0x16,0x55,0x6F,0xE7,0xFB,0xAD,0xE9,0x1F,0xEF,0xAB,
+	0xAE,0x27,0x35,0xF4,0x4A,0xCC,0x04,0x91,0x61,0xC4,0xE6,
+	0x9B,0x3C,0xFA,0xE2,0x29,0xCA,0x28,0xF8,0x79,0x44,0x66,
+	0xD3,0xCD,0xEA,0x8E,0x17,0xEB,0xCA,0x7F,0xBE,0x64,0xFF,
+	0x08,0x87,0x0B,0x4D,0x9C,0x74,0x84,0x30,0x62,0xDB,0xBC,
+	0xA1,0xC2,0xA7,0x5B,0xAF,0x0D,0xBC,0x51,0x8D,0xBA,0x25,
+	0xBC,0x3D,0xC2,0xA4,0x0F,0xF5,0xC0,0x88,0xB5,0x5D,0xBF,
+	0x83,0x28,0xC7,0x4F,0xA4,0xDA,0x54,0x02,0xF4,0xEA,0x6F,
+	0x61,0xA8,0x67,0x43,0x12,0xB6,0x8C,0xA9,0xE7,0x12,0xD6,
+	0xDE,0xBA,0x4E,0x91,0x3E,0xAE,0x7F,0x99,0x94,0x18,0x88,
+	0x89,0xC7,0x95,0x7B,0x0F,0x45,0x84,0x87,0x0C,0x92,0xC0,
+	0xBD,0x7A,0xB4,0xA6,0xA3,0xC4,0xB6,0x98,0xDB,0xB6,0x7A,
+	0x51,0xA1,0x03,0xE5,0x71,0x6C,0xFF,0x6A,0xCF,0x58,0xDA,
+	0x99,0xD9,0xFC,0xB2,0xEB,0x84,0x28,0x9B,0x39,0x21,0xBB,
+	0xB5,0xEA,0xC1,0x99,0x73,0x0E,0xD0,0xEF,0xFC,0x56,0xC3,
+	0x6E,0x43,0xD5,0xB2,0x51,0x60,0x55,0x8A,0x9B,0x47,0xF8,
+	0x62,0x74,0xE9,0x59,0xED,0x2E,0x7E,0xD6,0x1D,0x00,0x29,
+	0xCA,0x23,0x00,0xB3,0xEF,0x97,0xD9,0x65,0xE0,0x95,0xA2,
+	0xCE,0xFC,0xC2,0x5E,0xEE,0x7A,0x9C,0x8C,0xCE,0xE8,0x3A,
+	0x11,0x83,0x01,0xBD,0xC4,0xB2,0xFE,0x70,0x18,0xA9,0xE7,
+	0xD6,0x8D,0xF1,0xC7,0x43,0x7B,0x62,0xD3,0xE9,0x37,0x56,
+	0x6D,0x15,0xB5,0xCD,0xFC,0x4F,0x54,0x4E,0x66,0xE5,0xAF,
+	0x4A,0x50,0x06,0xF3,0xB1,0xCC,0x69,0x82,0x27,0x6A,0x40,
+	0xE7,0x5D,0x17,0xDA,0x73,0x64,0x79,0x64,0x6D,0xA2,0xBA,
+	0xAB,0x26,0x45,0xFF,0xDD,0x18,0x78,0xE0,0xC4,0xD0,0xB8,
+	0xDA,0x4D,0x51,0xA3,0xE5,0xF6,0x95,0x9B,0x93,0x47,0x26,
+	0x3A,0x94,0x07,0xC2,0xFB,0x2D,0x60,0x6F,0x7C,0x10,0xF1,
+	0x51,0x13,0xE9,0x2F,0x51,0xD5,0xD1,0x41,0x92,0xC7,0xFA,
+	0x8B,0x77,0x4C,0xF4,0x3D,0xEF,0xE2,0x44,0xC3,0x0D,0xDA,
+	0x62,0xF5,0x3A,0x74,0x07,0xCC,0xB3,0x2D,0xBA,0x2B,0x82,
+	0xB9,0xE5,0x03,0x76,0xA6,0x50,0x40,0x4F,0xA2,0x0C,0xF7,
+	0xB7,0x06,0xF7,0x91,0x33,0x3F,0x97,0x11,0x0E,0x64,0xCB,
+	0x30,0x1A,0x20,0xEB,0x6C,0x71,0xC6,0xF0,0x59,0x92,0x30,
+	0xA3,0xA2,0x12,0x7A,0x35,0x95,0x61,0x8E,0x66,0x63,0xD7,
+	0x90,0xA7,0xE8,0x7B,0xAC,0x1C,0xD7,0x6C,0x95,0xAE,0x40,
+	0xE8,0x24,0x6A,0x18,0xD0,0x3A,0x71,0xAB,0x1B,0xF1,0x16,
+	0xDF,0x50,0x9D,0x85,0x7E,0xB0,0xFC,0xCD,0x79,0x37,0xB0,
+	0xAB,0x37,0xCC,0x1E,0x51,0x1D,0x58,0x1A,0x72,0xBA,0x7C,
+	0xE0,0x5D,0x40,0x73,0x83,0x37,0xE4,0x01,0xDC,0xD9,0xAD,
+	0xD8,0xB5,0xF7,0x8C,0x93,0x22,0x52,0xA8,0xF6,0xB5,0x96,
+	0x49,0x45,0x06,0xD6,0x97,0xCB,0xC6,0x12,0xCD,0x15,0xFC,
+	0x62,0x32,0xB5,0x78,0xCB,0x55,0x10,0xF8,0xFD,0x73,0xE6,
+	0xEC,0x53,0x43,0xF5,0xC6,0xEF,0x37,0xE2,0x10,0x09,0x27,
+	0xF6,0x9E,0xC7,0x93,0xD8,0x03,0xBB,0xC0,0x68,0x20,0xE1,
+	0x96,0x8C,0xB8,0x98,0xDB,0x75,0x1B,0xAA,0x8E,0xE9,0x0C,
+	0xA2,0x43,0xB5,0x48,0xC5,0x7C,0x90,0x58,0x5E,0x2D,0x7D,
+	0xBE,0x1A,0xF0,0xEC,0xE9,0x70,0xBB,0xC8,0xB0,0xF8,0x70,
+	0x47,0xED,0x75,0xDF,0x30,0x86,0xC8,0x63,0x6D,0xFD,0x94,
+	0xA5,0x93,0xF8,0xCA,0xA7,0xF2,0xAD,0x7A,0xC5,0x50,0x29,
+	0xE6,0x93,0xFE,0xE6,0x17,0xDF,0x0A,0x6D,0xB8,0xF7,0x17,
+	0x35,0xC4,0x7C,0xF8,0xC9,0x35,0xC0,0x6F,0xAC,0x43,0x00,
+	0xA9,0x3B,0x29,0x36,0xF8,0x52,0x31,0x90,0x4A,0xE0,0x82,
+	0x29,0x55,0x9B,0x31,0x83,0xAC,0xF1,0x36,0x54,0xA8,0xC2,
+	0x34,0x44,0x96,0xA1,0x8B,0x8D,0xD6,0x6B,0xBF,0xFB,0xEA,
+	0x29,0xAC,0xB9,0xE9,0x23,0xF2,0x57,0x91,0x66,0x89,0xDA,
+	0x64,0xD2,0x31,0x87,0x8F,0x44,0xC2,0x9F,0xF8,0x49,0x69,
+	0xEE,0x83,0xE8,0x60,0xF5,0xD4,0xD3,0xC7,0x58,0x97,0x01,
+	0xFB,0x2E,0x5C,0x65,0x43,0x4C,0xBF,0xCC,0xEF,0x78,0x68,
+	0x48,0x31,0x57,0x53,0x19,0xA5,0xA6,0x54,0xA0,0x51,0x20,
+	0x78,0x63,0xD6,0x5F,0x1A,0x26,0xAB,0x29,0xFB,0xA7,0xD9,
+	0xCC,0xF7,0xBA,0x70,0x4F,0x02,0xAE,0xBE,0x4A,0xFA,0xDD,
+	0xA2,0xC6,0x06,0x2B,0x81,0x5B,0xDF,0x1D,0x83,0x79,0x9D,
+	0xF9,0x03,0x50,0x71,0xA6,0xE3,0x7B,0x0F,0xCE,0x6D,0xAD,
+	0x4D,0xA9,0x9C,0x01,0xB9,0x87,0x15,0x82,0xA4,0xBC,0xB9,
+	0x27,0xD3,0xB1,0x75,0x0D,0x11,0xD7,0xE4,0x1E,0x0F,0xDF,
+	0x86,0x51,0x3E,0x63,0xCE,0xEB,0x07,0xA9,0x3B,0xAF,0xB9,
+	0xD0,0x99,0x56,0xE5,0x89,0xB0,0x03,0x89,0xF4,0x04,0x07,
+	0x96,0x6C,0x1B,0xFA,0x7E,0xA8,0x86,0x89,0x56,0x91,0x9B,
+	0x19,0xB2,0x2A,0x56,0x0F,0x7F,0xDF,0x85,0x19,0x50,0xB8,
+	0x75,0xFB,0x45,0xF4,0xD5,0x4E,0x0E,0x17,0x92,0x6C,0xB3,
+	0x9B,0x28,0xDC,0x16,0xA3,0x9A,0x8A,0xCE,0x25,0x9B,0x29,
+	0x02,0xD4,0x5E,0x87,0x1E,0x6C,0x99,0xC8,0xC5,0xC1,0x8F,
+	0x59,0xC8,0xB1,0x15,0x27,0x4D,0xF8,0x51,0x07,0xFC,0x6C,
+	0x31,0x13,0xDE,0x3B,0xBC,0x68,0x1F,0x93,0x61,0x24,0xB5,
+	0xB5,0x1C,0xA9,0xBB,0x01,0x65,0x25,0x1D,0x15,0x39,0x72,
+	0xAB,0xAB,0x79,0xA6,0x12,0x3F,0xD0,0x56,0x11,0x56,0xE9,
+	0x6D,0xFE,0xD3,0x9E,0x9A,0xF4,0x45,0x9D,0x57,0x6B,0x74,
+	0xF1,0xCF,0x37,0xB8,0x7B,0xC3,0xC9,0x89,0xDB,0x8B,0x23,
+	0x55,0x59,0xB3,0x87,0x06,0x26,0x2F,0x5F,0x0B,0xD0,0xAF,
+	0x4E,0x56,0xAA,0x2F,0x1E,0x49,0x2C,0x32,0x95,0xCB,0x58,
+	0xCB,0x92,0xA2,0xCD,0x3E,0x93,0x4A,0x37,0x1E,0x32,0x65,
+	0xED,0xB4,0xE5,0xFA,0xC5,0xAB,0x5D,0x36,0xF0,0x78,0xF7,
+	0xAE,0x63,0x43,0xE9,0x54,0x38,0x96,0xAC,0x45,0x3F,0xDA,
+	0xCA,0xC3,0x6B,0x1B,0x05,0x71,0x4E,0xD6,0x21,0xC3,0xE3,
+	0xF8,0x3F,0x64,0x4E,0x9E,0x51,0xB0,0x69,0x71,0x14,0x88,
+	0x47,0x9B,0x79,0x27,0x48,0x2A,0x16,0x5C,0xD4,0xBE,0x8A,
+	0x37,0x65,0x1F,0x40,0xE9,0x61,0x3C,0xEC,0xE2,0xFA,0x70,
+	0x36,0xC5,0xB6,0xF2,0x79,0x39,0x5B,0x11,0xDD,0x9B,0xB1,
+	0x37,0x7C,0x18,0x07,0xDB,0xE9,0xE5,0x82,0x26,0xFE,0x32,
+	0x91,0x7F,0x02,0x57,0x63,0x54,0xB3,0x2B,0xF9,0x0E,0x98,
+	0xAE,0x6E,0xCC,0xC1,0xCD,0x3B,0xA7,0x40,0x0A,0x01,0x51,
+	0xF8,0xF3,0x8E,0x49,0x96,0x6C,0x5B,0xD9,0x35,0x9A,0xC0,
+	0xCD,0x6A,0x49,0x4B,0x89,0x16,0x79,0x1E,0x0D,0xD3,0xEA,
+	0x0B,0x82,0x92,0x55,0x01,0x8D,0x97,0x2A,0xBF,0x9E,0x8C,
+	0x7D,0x50,0xF0,0xA1,0x5C,0x4D,0x2E,0x7B,0x51,0x80,0xF1,
+	0x59,0xA4,0x21,0x5D,0x6D,0xFF,0xE4,0xD5,0xCD,0xDE,0xE1,
+	0xA1,0xF1,0x1E,0xD7,0xF9,0xFD,0x30,0x88,0x02,0x72,0xD0,
+	0xBD,0xF5,0xF7,0xE6,0xB8,0x00,0x25,0x07,0x2B,0x1A,0x9B,
+	0x08,0xC2,0x4C,0x1E,0x3D,0xF1,0xA5,0x88,0x95,0xEA,0xCA,
+	0x2E,0x34,0xED,0x4D,0xA2,0x0A,0x3F,0xE9,0xB1,0x8A,0xF3,
+	0x35,0x17,0xD7,0xE8,0x54,0xDB,0x3D,0x6A,0x4B,0x34,0xA1,
+	0xB8,0xA9,0x3B,0x78,0x99,0xD6,0xF0,0x0E,0x14,0x2B,0x07,
+	0x84,0x7B,0x0E,0x78,0x7A,0x85,0xEB,0x7B,0x10,0x21,0x9B,
+	0xDA,0x1D,0x2A,0x9B,0xEA,0x1D,0x3C,0x9B,0x4A,0x1D,0x84,
+	0x4D,0xD9,0x0E,0xFC,0xBA,0x04,0xDB,0x5A,0xDC,0x30,0x8C,
+	0x7A,0x7C,0x51,0x55,0xE4,0xCC,0x1F,0x9E,0x47,0x4E,0x5F,
+	0xA7,0x15,0x5D,0x79,0x97,0xC6,0xE7,0x07,0x54,0xE9,0xE3,
+	0xF7,0x37,0xB4,0xB6,0xA3,0x96,0xDB,0xD2,0x12,0xE1,0xB9,
+	0x9F,0xB5,0x86,0xE3,0x19,0x84,0x84,0xF2,0x8D,0x19,0xB7,
+	0x6A,0x6D,0x57,0xB4,0xA5,0x4E,0x99,0x6B,0xB5,0x11,0x05,
+	0x61,0x32,0xB4,0x63,0xFD,0xC2,0x63,0xBA,0x3E,0x0B,0xC7,
+	0x14,0x91,0x30,0x31,0x64,0x3C,0x9E,0xFA,0x99,0xD5,0x9B,
+	0xA8,0x1F,0x9A,0xEC,0x32,0xAB,0x0C,0x13,0x22,0xA8,0xF2,
+	0x87,0x5E,0xB1,0xCE,0x11,0xA2,0x29,0x8C,0xC8,0x12,0xC7,
+	0x9A,0x9D,0x65,0x29,0xC6,0x99,0xD3,0xD5,0x66,0x10,0xD7,
+	0xC8,0x69,0xF3,0x08,0xBD,0x18,0x90,0x01,0x43,0x56,0xCF,
+	0x1E,0x16,0x75,0x62,0xF8,0xBC,0xFF,0x46,0xC8,0x6F,0x63,
+	0x0C,0xB6,0x21,0x98,0x40,0x09,0xFC,0x2B,0x25,0xAF,0xFC,
+	0xC8,0x84,0x7F,0x23,0xF8,0xE3,0x22,0xCA,0xF5,0x87,0xD0,
+	0x80,0x31,0xEE,0x4C,0xB9,0xA8,0x10,0xC5,0x0D,0x4B,0xE1,
+	0xAA,0x7C,0xF0,0x5C,0x08,0x6E,0x8B,0xCE,0xE8,0x73,0x4D,
+	0xCF,0x8E,0xE5,0x02,0x8A,0xBA,0x15,0xF2,0x84,0x72,0x87,
+	0x25,0x6F,0x14,0x51,0xE4,0x9A,0x0E,0xB6,0x7B,0xA5,0x12,
+	0x66,0x9E,0x8F,0x61,0xAB,0x1D,0x40,0xB8,0x29,0x0A,0x9F,
+	0x4C,0xE1,0xFB,0x64,0xB9,0x9E,0xB1,0x42,0x4E,0x23,0x6C,
+	0x74,0x39,0x7D,0x4F,0xF9,0xA3,0x17,0x44,0xBD,0xF8,0x0B,
+	0x32,0xEB,0x55,0x21,0x1F,0x7D,0xC2,0xE1,0x36,0x2F,0x8B,
+	0xBE,0x86,0x65,0x3D,0x81,0x94,0x5B,0xD4,0xED,0x59,0x0E,
+	0x8A,0xF2,0x06,0x18,0x53,0x8D,0x6C,0x27,0xAB,0x6B,0x1A,
+	0xCC,0x19,0x4F,0xA7,0x09,0x01,0xBC,0xA2,0x2E,0x3F,0x55,
+	0xFF,0xA5,0x37,0xA5,0x01,0xC3,0xA7,0x3E,0xB9,0xED,0xA2,
+	0xE1,0x9F,0x2E,0xDA,0x38,0xB7,0x55,0xC0,0x4D,0x30,0x07,
+	0x14,0x88,0x09,0x31,0x81,0xD9,0x7B,0x3A,0x59,0x27,0x1C,
+	0xAC,0x17,0x6F,0x84,0xC1,0x3F,0x59,0xAF,0xDD,0x63,0x19,
+	0x6F,0xE4,0x34,0x2D,0x67,0x39,0xB9,0xED,0x8E,0x66,0x84,
+	0x1F,0xAF,0xF2,0x74,0xAB,0x72,0xB9,0xC6,0x79,0x8B,0xB1,
+	0xCE,0x93,0x90,0xFF,0xB1,0xC1,0xE9,0xCB,0x95,0x50,0x7F,
+	0x3C,0x90,0xA0,0x12,0xE0,0x1A,0x9C,0xAD,0xB1,0x71,0xC9,
+	0xB5,0x40,0xA2,0x6E,0x3A,0x28,0x1C,0xBE,0x72,0xAD,0xBA,
+	0x54,0x3D,0xFA,0xBF,0x66,0xCD,0x74,0x68,0xB7,0xFD,0x4B,
+	0xED,0x8D,0xC8,0x9F,0x78,0x47,0x8C,0x0C,0x17,0x26,0xF7,
+	0x31,0xB6,0xF2,0xDA,0xC9,0xE9,0x43,0xAA,0x03,0xD6,0x48,
+	0x2C,0x47,0x29,0x1A,0x5C,0xA0,0x51,0x12,0xCC,0xEB,0x93,
+	0xA5,0xFC,0x31,0xC9,0xB9,0xEE,0x85,0xE0,0x53,0x36,0x9B,
+	0xB2,0xCF,0x4B,0x3C,0xFD,0x6C,0x9B,0x97,0x35,0x07,0x40,
+	0x0D,0x41,0xFB,0x35,0xC6,0x00,0xA5,0xE6,0x6B,0x2C,0x95,
+	0xD3,0x0F,0x20,0x27,0xEB,0x57,0xFF,0x80,0x72,0x47,0x98,
+	0x81,0x05,0xAB,0x42,0x38,0x89,0x72,0x23,0x50,0x28,0xE9,
+	0xB1,0xCD,0x66,0x46,0x9F,0xB6,0x9D,0xE5,0x38,0xE4,0xE5,
+	0x24,0xE0,0x15,0x8F,0x62,0x56,0xA6,0x4B,0x53,0x81,0xEB,
+	0x9C,0xFF,0xAD,0x2F,0x71,0xCF,0x0D,0x4B,0x63,0xE1,0xA1,
+	0xDC,0x99,0xEB,0x06,0xB8,0xF6,0x37,0x4A,0xB7,0x94,0x26,
+	0xB1,0x63,0x1D,0xF8,0x86,0xC4,0x54,0x36,0xEC,0xE8,0x97,
+	0xD0,0xE0,0xB0,0x53,0x6D,0x99,0x4E,0xA7,0xBD,0x31,0xD0,
+	0x0E,0xED,0xE7,0xE9,0x31,0x79,0x4A,0x26,0xD5,0xFA,0x45,
+	0x89,0x06,0x33,0x56,0x0F,0x5C,0x6B,0xA3,0xCF,0x54,0xB9,
+	0x8A,0xDE,0xC1,0x5C,0xEA,0xA8,0x91,0x8A,0xA0,0x9A,0x77,
+	0xE0,0x00,0xC2,0x16,0x1E,0x3E,0xDF,0x74,0x4C,0x9F,0x52,
+	0x12,0x35,0x3D,0x51,0xFD,0xE8,0x92,0x9F,0x53,0xB8,0x77,
+	0x36,0x4A,0x6A,0x69,0x9B,0x68,0xBE,0x77,0x5A,0x4F,0x46,
+	0x77,0xD8,0x3E,0x46,0x86,0x7A,0x33,0xC6,0x00,0x50,0x7C,
+	0x99,0x76,0x29,0x1F,0xD2,0x6E,0x29,0xE8,0xED,0x96,0xA2,
+	0x36,0xE8,0xB3,0x94,0xEC,0x1E,0xA5,0x91,0x20,0x5E,0x9E,
+	0x37,0x6E,0x75,0x03,0x1C,0x3D,0x82,0x55,0x14,0x85,0x47,
+	0x33,0xAE,0x8C,0x1B,0x63,0xB4,0x13,0x2E,0x50,0x44,0x8F,
+	0xFF,0x1C,0x64,0xF0,0xDD,0x2B,0x56,0xC4,0x23,0x68,0xFD,
+	0xD6,0xB9,0xD3,0xFC,0xC2,0xD9,0xDA,0xEA,0xCF,0x43,0x8D,
+	0x08,0x42,0x8A,0x2C,0xFE,0xB8,0x39,0xEB,0x7F,0x38,0xCF,
+	0x47,0x81,0x81,0x91,0x7A,0x58,0x7B,0x62,0x9E,0x96,0x77,
+	0x21,0x1A,0x5D,0x94,0x9F,0xA0,0xA2,0xB7,0x70,0x1F,0xB6,
+	0xF2,0xCF,0x0C,0xC0,0x7C,0xEE,0x60,0xA4,0x77,0x91,0x0F,
+	0x63,0x7A,0xD4,0x71,0x97,0x47,0xBB,0x62,0x19,0xDF,0x1D,
+	0x70,0x70,0xFD,0xCF,0xD1,0x29,0x27,0x3A,0x6A,0xFA,0x92,
+	0xCB,0x6D,0xFC,0x67,0x3F,0x29,0x62,0x64,0xE1,0x21,0xE9,
+	0x3D,0x73,0xD9,0xA1,0xBF,0x15,0x2A,0x0C,0xEE,0xFD,0x98,
+	0xFB,0x9D,0xB4,0x3C,0x77,0xBE,0xC0,0x6F,0x77,0x51,0x50,
+	0x94,0x35,0x60,0x9E,0x4B,0x6A,0x5B,0x17,0x5C,0x13,0xFE,
+	0x00,0x28,0x54,0x6E,0x13,0x5F,0x71,0xDC,0x25,0xA9,0xBA,
+	0x00,0x6F,0xE0,0x5A,0x43,0x09,0x39,0x0B,0x4A,0x0E,0xE2,
+	0x7D,0xAE,0x89,0x46,0xB4,0xDE,0xD6,0xA5,0xEA,0x80,0xFB,
+	0x77,0x98,0x97,0x0F,0x90,0x81,0x45,0x83,0x37,0xE3,0x63,
+	0x21,0xA9,0xBB,0xB3,0x52,0xDB,0x30,0x95,0xD4,0x39,0x0C,
+	0x86,0x5E,0xB7,0xF2,0x31,0x4C,0x21,0x4D,0x06,0x0E,0xD8,
+	0x76,0x7E,0x99,0x07,0xA7,0xC8,0xA1,0x04,0xE6,0x60,0x99,
+	0x3F,0xE0,0x00,0x67,0xB6,0xD8,0x27,0xB5,0x94,0xDB,0x63,
+	0xCA,0x0F,0x4D,0x67,0x21,0x40,0xC9,0xCA,0xC2,0x72,0x65,
+	0x6E,0x2F,0x45,0x41,0x7A,0xD8,0x52,0xB9,0x37,0x40,0xFA,
+	0x9F,0x2B,0x9D,0x57,0x20,0x98,0xE8,0x1E,0xB5,0x27,0xE8,
+	0x0D,0x46,0x64,0xC4,0x8F,0x5D,0x80,0xDD,0x71,0x15,0xA9,
+	0xD0,0xB5,0x83,0xA1,0x56,0xA0,0xC5,0x53,0x6C,0x79,0x5F,
+	0x80,0x6F,0x95,0x5E,0xE9,0xCB,0xE4,0x7E,0xBE,0x3E,0x74,
+	0x24,0x32,0x73,0xDD,0xBE,0xDE,0x59,0x7F,0xE0,0x87,0xFC,
+	0xC3,0xB7,0x06,0x0B,0xC3,0xBA,0x50,0x08,0xE4,0xED,0xDB,
+	0xD6,0x53,0xE7,0x56,0x89,0x03,0xF2,0xB6,0xB6,0xEE,0x86,
+	0xA9,0x39,0x2D,0xBA,0xC7,0x33,0x44,0xBE,0x10,0x64,0x87,
+	0xFE,0xAB,0x96,0x35,0x92,0x2D,0xCE,0xD0,0x6D,0x22,0x2C,
+	0xE6,0x43,0x2D,0x5F,0xEF,0xE0,0xE9,0xAF,0xFC,0xC8,0x59,
+	0xF4,0x69,0x00,0x1E,0x79,0xC9,0xE0,0x66,0x7E,0x97,0x48,
+	0x0A,0x22,0x7B,0x94,0x72,0xB6,0x76,0x94,0xBD,0x99,0x8A,
+	0xA1,0x68,0x00,0xAC,0x75,0xD0,0x96,0x40,0xDF,0x25,0xA8,
+	0x4A,0xF8,0x0F,0x67,0xBF,0xC6,0x5B,0xAA,0xBD,0x35,0xF8,
+	0x98,0x40,0xD3,0x29,0x03,0x0B,0xF9,0x7B,0x16,0xC6,0xB6,
+	0x1A,0xBA,0x3F,0x98,0xCC,0x6F,0xB9,0x71,0x32,0xCE,0xC7,
+	0xA4,0x9C,0xFF,0x52,0x8F,0x89,0xC4,0xD6,0xB8,0x76,0x64,
+	0x04,0x11,0xCE,0xC1,0xF8,0x62,0x64,0xB9,0xA6,0xFB,0xE0,
+	0x44,0x54,0xC2,0xF1,0x8C,0x44,0x45,0x4E,0x17,0x75,0xCD,
+	0x82,0xDE,0x24,0x3D,0xBF,0x25,0x77,0x75,0x99,0x82,0x5C,
+	0xDE,0x65,0xAB,0x0E,0xF1,0x61,0x2E,0x0A,0x46,0xF3,0x7F,
+	0x5D,0xF1,0xFD,0x83,0xC8,0xA8,0xB4,0x31,0x6F,0xBE,0x08,
+	0xCA,0xFE,0xD0,0x52,0xAD,0x20,0x9A,0x8C,0x59,0x7D,0x4F,
+	0x93,0x00,0x39,0x9D,0x94,0x3A,0x2D,0x43,0x7F,0x68,0x5F,
+	0xAD,0xD7,0x40,0x0B,0x75,0xA0,0xF2,0x11,0xAA,0xE6,0x5C,
+	0x24,0x24,0x9C,0xE5,0x20,0x25,0x51,0xFF,0xAB,0x6B,0x3E,
+	0x42,0x9C,0x6B,0x77,0x6B,0x67,0x78,0x67,0x94,0xB6,0xFA,
+	0x51,0xBA,0x9F,0x4C,0xD5,0x9B,0x90,0x1E,0x97,0x17,0x59,
+	0x57,0xDE,0x10,0xC9,0x5C,0xE7,0xC7,0xDC,0x7E,0xDB,0x4F,
+	0xE1,0x71,0xA3,0xDD,0xF3,0x2D,0xB1,0xD1,0x85,0xB5,0x91,
+	0x33,0xFC,0xCC,0xED,0x37,0x7A,0x4F,0x48,0xE3,0x03,0xCD,
+	0xDD,0x47,0xA8,0x81,0x8C,0x4E,0x4E,0x94,0x9F,0xEF,0x19,
+	0xAC,0xE6,0x08,0x6B,0x24,0x7D,0xFA,0xF6,0xF1,0xEC,0x77,
+	0x20,0x9F,0xF1,0x8C,0xD1,0x75,0x45,0xAA,0x40,0x9D,0xEB,
+	0xE8,0xEE,0x28,0xA0,0x1D,0x05,0xC0,0x22,0xF9,0x23,0x3A,
+	0xD4,0x1C,0x95,0x85,0xA9,0x50,0x53,0x22,0xB4,0xDB,0x16,
+	0xC5,0x3F,0x32,0x9D,0x72,0xF8,0x74,0x2A,0xB5,0x5F,0x96,
+	0xEE,0x25,0x5E,0xF3,0x86,0x82,0xEE,0x18,0x06,0xC1,0xD4,
+	0x02,0x05,0x43,0xA4,0x6A,0x31,0x0B,0x1A,0xCD,0x92,0xB8,
+	0xBA,0x8C,0x18,0xAD,0xCD,0x31,0xB9,0x9B,0x6E,0x10,0x71,
+	0x99,0x7E,0xCD,0xE2,0xB2,0x1A,0xA4,0x9D,0x6C,0xC6,0xEE,
+	0x4A,0x16,0x20,0x63,0xD5,0x77,0xB5,0x12,0x07,0x3A,0xBA,
+	0x93,0x5C,0xC9,0x0F,0x35,0x4F,0xDD,0xB3,0x40,0x5A,0x9F,
+	0xA8,0x45,0xE9,0x5F,0x7F,0x34,0x1A,0x7F,0x1C,0xFD,0x25,
+	0xA2,0xEA,0xFC,0xC9,0x3B,0xD1,0x02,0xE1,0x6D,0x1C,0x97,
+	0x20,0x2B,0x59,0xFF,0x45,0x93,0x73,0x5A,0x47,0xEB,0x64,
+	0x35,0x16,0x40,0x29,0xF8,0x3E,0xA1,0x69,0x53,0x42,0x99,
+	0x8C,0x19,0xEB,0x12,0x0F,0x6F,0x32,0x20,0xA0,0xA2,0x08,
+	0xC8,0x10,0x4E,0x2E,0x04,0x5D,0xA8,0x8E,0x0C,0x32,0x85,
+	0xBE,0x44,0x1E,0x54,0x47,0xBF,0x6B,0x35,0x2F,0xE3,0xDA,
+	0x13,0x00,0x41,0xDC,0xF8,0x73,0x04,0xB2,0x8C,0xA9,0xA2,
+	0x36,0x24,0x0A,0x63,0x5C,0x7A,0x6D,0xCC,0x51,0xDF,0x5C,
+	0xA9,0x9E,0x5F,0xF2,0x4E,0x1F,0xC2,0x46,0xE3,0x44,0xCC,
+	0xD2,0xC0,0x34,0xBE,0x5E,0xE6,0xC6,0x8A,0x99,0x4E,0xC8,
+	0xED,0x96,0x87,0x13,0x38,0xEE,0x03,0x09,0x00,0x53,0xC4,
+	0x56,0x09,0xDC,0x61,0x46,0xFA,0x83,0x99,0x24,0x6F,0xA6,
+	0x6C,0x32,0xEF,0xD8,0x5D,0x69,0x9C,0xA3,0xB8,0x9E,0x5B,
+	0x70,0xCC,0x3C,0x95,0x00,0x30,0x82,0xC8,0xCF,0x19,0x92,
+	0x74,0x68,0x5F,0x95,0xA9,0x16,0x06,0x12,0x8C,0xA7,0x8F,
+	0x85,0x8E,0xFC,0x04,0x09,0x15,0x9B,0x2D,0x82,0xB1,0x78,
+	0x8B,0x66,0x98,0x83,0xE0,0xB4,0x2D,0x45,0x5A,0xCF,0x08,
+	0x03,0xBB,0xD5,0xC1,0x67,0x08,0x39,0x7C,0x42,0x57,0x9B,
+	0x40,0xEE,0x49,0x5F,0x52,0xEC,0xC9,0x7A,0x92,0x96,0x67,
+	0x2B,0x6C,0x72,0x2C,0x31,0x5F,0x86,0xFB,0x52,0x42,0x21,
+	0xBD,0x0B,0xF0,0xD8,0xEA,0xD4,0x71,0x38,0x40,0xD0,0xA2,
+	0x6E,0x11,0x3E,0x96,0x86,0xF6,0x35,0x86,0xF1,0x80,0x1C,
+	0x4B,0xFC,0xBE,0x09,0xB1,0xFB,0xAA,0xF9,0xEE,0xCE,0xE8,
+	0x78,0xFC,0xCD,0x0C,0x0F,0xCF,0xD5,0xEF,0xF1,0x3B,0xE8,
+	0x2D,0x80,0xB9,0xD6,0x4E,0xEC,0x1D,0xCB,0xFE,0xE2,0xDE,
+	0x37,0x62,0x62,0x75,0x46,0x6B,0xFD,0x7C,0x9F,0x9D,0x57,
+	0x5D,0x65,0x58,0xAC,0x58,0x25,0x29,0x36,0x07,0xD9,0xAE,
+	0xAD,0x5D,0x26,0xF1,0xA0,0xC3,0x8E,0x1F,0x30,0x29,0xB3,
+	0xF9,0x4C,0x90,0x69,0x7C,0xF7,0xC1,0x23,0xF7,0xF5,0x06,
+	0x20,0x5B,0x9C,0x64,0x21,0xEB,0xD7,0xDC,0x23,0x14,0xD2,
+	0x27,0xD4,0xF1,0x5A,0x42,0x2F,0x1C,0x36,0xFC,0xCF,0x20,
+	0xF5,0x9F,0x3F,0xE1,0xFC,0x13,0x1B,0xBB,0x63,0xA6,0x88,
+	0x82,0x09,0xF4,0x93,0x42,0xD0,0x99,0xFD,0x4E,0x3C,0xB9,
+	0x06,0x10,0xF4,0x00,0x21,0x72,0x70,0xCA,0xDA,0xEA,0x0F,
+	0x3C,0xF4,0x40,0x2A,0x11,0xC3,0xEC,0x75,0xF0,0xBA,0x37,
+	0x9B,0x90,0x8A,0x6E,0x27,0xE0,0x84,0xC3,0x7E,0x3A,0x60,
+	0x53,0x1C,0xB8,0x1A,0xE5,0xC2,0x52,0x21,0xC2,0x6B,0xDC,
+	0xBE,0x03,0x7E,0x15,0x3D,0x95,0xCA,0x59,0x25,0x3D,0x68,
+	0xAD,0x31,0xFC,0x41,0x33,0x01,0x1C,0x0F,0x4D,0xBC,0xA5,
+	0x14,0x4B,0x0C,0x29,0x56,0x2A,0x7E,0x59,0x0A,0xFD,0x75,
+	0x59,0x99,0xE1,0x23,0x98,0xA8,0x74,0x60,0xAD,0x1C,0xA2,
+	0xA4,0xAE,0xB8,0x9B,0xAE,0x74,0x33,0xAD,0x54,0xF6,0xFD,
+	0x31,0xDE,0x1F,0xCA,0x0B,0xAA,0x1A,0x5A,0xFE,0x18,0x8D,
+	0x63,0x1A,0x46,0x34,0x8D,0xB5,0x0C,0x34,0xD7,0xDA,0xE6,
+	0x5A,0xD5,0xC4,0x7B,0xD7,0x4B,0xD7,0xB6,0x1F,0x66,0xA0,
+	0xFE,0xD3,0x51,0xC3,0x3D,0x5D,0xEE,0xB6,0xD0,0x5C,0x65,
+	0x7E,0xD0,0xF7,0xB5,0x6A,0xF3,0x78,0x35,0xFD,0x02,0xF4,
+	0x44,0xED,0x69,0x53,0xDD,0x60,0x63,0xB3,0xDA,0xF3,0xA6,
+	0xF6,0x41,0xC6,0x2B,0x25,0x97,0xA2,0x06,0xFB,0xA5,0xCE,
+	0x12,0x67,0xD6,0x14,0xE8,0xD5,0xEE,0x53,0xE5,0xF4,0x73,
+	0x53,0x0C,0x2F,0x07,0x1D,0x82,0xE0,0x04,0xF3,0x8B,0x7D,
+	0xD9,0x99,0xDB,0x41,0xB8,0x57,0x65,0x79,0x59,0xC5,0x64,
+	0x73,0xE5,0x2F,0xB9,0xBD,0x9F,0x89,0x63,0x13,0x9E,0x6C,
+	0xB9,0xF0,0x8F,0x1E,0xFA,0x45,0x71,0xC2,0xC4,0xC4,0x82,
+	0x7B,0x92,0xB7,0x58,0xC8,0xCB,0x1D,0x20,0x86,0xF4,0xBC,
+	0x3C,0x8A,0x75,0x13,0x54,0x67,0x75,0x1D,0x0E,0x38,0x2F,
+	0x9B,0x3B,0x21,0x2E,0xBA,0x7D,0x98,0xDD,0xE5,0xB0,0x90,
+	0xB0,0x12,0x5B,0xCF,0x6C,0xFC,0x6D,0x48,0xF9,0xE1,0x46,
+	0x2F,0x5F,0x77,0x4D,0x63,0x8F,0xD3,0xB7,0x28,0xC6,0xA4,
+	0x2B,0xC8,0x49,0xB6,0xA6,0xD1,0x2C,0x41,0x3D,0x33,0x25,
+	0x6C,0xFD,0x8E,0xBA,0xDC,0xD5,0x1F,0x74,0x42,0xA9,0x88,
+	0xF0,0x85,0x8E,0xFA,0x32,0x48,0xFD,0xAE,0xE2,0xDA,0x49,
+	0xFB,0xDC,0xAA,0x05,0x12,0xCB,0xDD,0xE3,0x69,0x17,0xD7,
+	0xBC,0x43,0x58,0x84,0x49,0x3B,0x4E,0x35,0x84,0xB5,0xCF,
+	0x7D,0x66,0xA1,0x40,0xFD,0x02,0x92,0xA7,0x13,0x0C,0x41,
+	0x71,0xDB,0x40,0x6D,0xA5,0x8F,0x81,0x19,0xC0,0x93,0xF5,
+	0xF9,0x84,0xEB,0xF3,0xA5,0xDA,0xF6,0x97,0xB0,0xF7,0x6F,
+	0xD6,0xA8,0xC6,0x87,0x6D,0xBE,0xBA,0xA7,0x41,0x37,0x9E,
+	0xBA,0x78,0x4F,0x22,0xC5,0xBB,0x1E,0x58,0x79,0xC4,0xCD,
+	0xD7,0xA7,0x8E,0x82,0xA8,0xFB,0xF3,0x80,0xDC,0x78,0x5B,
+	0xA7,0x79,0xEF,0x1A,0xF0,0xFA,0xB7,0x57,0xDA,0x3E,0x63,
+	0xC2,0x97,0x43,0xB1,0xE4,0xBE,0x8B,0xC0,0x1A,0x6F,0x04,
+	0xEE,0xBC,0x6E,0xFB,0x8E,0x48,0x38,0x82,0xCC,0xF0,0xD7,
+	0x79,0xF5,0xC7,0xE3,0xC4,0xF3,0xAD,0x22,0xB5,0xD3,0xC7,
+	0x1D,0xC6,0x4D,0x6B,0x2A,0xD6,0x57,0x49,0xA6,0x2D,0x10,
+	0xAE,0x85,0xA9,0x39,0x90,0x62,0x62,0x1A,0xAE,0xA9,0x6F,
+	0x3A,0xEC,0xF0,0x42,0x7B,0xDF,0xB4,0x01,0x42,0x51,0x17,
+	0x8F,0x82,0xF6,0x79,0x0B,0xA3,0x37,0x29,0xB2,0xA6,0xC5,
+	0x1B,0x12,0xA6,0x52,0xEA,0xF2,0x22,0x2F,0x91,0x30,0x0A,
+	0xBE,0x76,0x5E,0x85,0xD7,0x74,0x1C,0x0A,0x51,0xFF,0xFB,
+	0xA9,0x02,0x3B,0x8B,0xBC,0x87,0x89,0xD5,0xA4,0xAD,0x2B,
+	0x07,0xC3,0x59,0xBF,0xD1,0x4B,0xE7,0xA9,0x63,0xEF,0xC5,
+	0x15,0x95,0x3B,0x1E,0x21,0xBB,0xCF,0xEF,0x82,0xE9,0xB3,
+	0xFE,0x60,0x17,0x75,0xD6,0xC7,0x56,0xC0,0x95,0x17,0x56,
+	0x43,0x87,0x76,0x4A,0x0C,0x80,0x83,0x33,0x40,0xCF,0x0D,
+	0xE0,0xD4,0x17,0xF1,0x26,0xA4,0xBA,0x63,0xC1,0x22,0xF5,
+	0xF8,0xF6,0xB6,0x08,0xFB,0xA5,0xE9,0xDB,0xB6,0xF8,0xAE,
+	0x17,0x7F,0x27,0xAB,0x90,0x80,0x66,0x5E,0x40,0x28,0x3F,
+	0x60,0x48,0x0E,0x80,0x4A,0xF6,0x10,0xDC,0x54,0xF9,0xC4,
+	0x33,0xA0,0xFF,0x2E,0x88,0x6D,0x99,0x33,0xFB,0xAF,0x52,
+	0x49,0x96,0xD0,0x2A,0xEA,0x2F,0x71,0x7C,0x5D,0x5D,0x94,
+	0xE5,0x4D,0x32,0x69,0x45,0xE6,0xD1,0xD6,0x48,0x0E,0x6C,
+	0xBB,0x2A,0x98,0x37,0x5C,0xBD,0xD0,0xE2,0xCD,0xE3,0xFB,
+	0xF3,0x61,0x57,0x83,0x8C,0x06,0x00,0xE1,0xCE,0x06,0x1D,
+	0x54,0x99,0xEF,0xCA,0x02,0xBD,0xDC,0x69,0x35,0x86,0xA3,
+	0x70,0xBE,0xC7,0xA2,0x77,0xE1,0x12,0x9B,0x79,0xE1,0xA8,
+	0x98,0x85,0x23,0x56,0x62,0x4F,0x5D,0x13,0x60,0x4A,0x2E,
+	0x2D,0x40,0x22,0xC9,0x26,0x4A,0x0A,0x90,0x7A,0xA5,0xB0,
+	0x81,0x56,0xB1,0x98,0xD9,0x5E,0x15,0xE3,0x3D,0x98,0x12,
+	0x39,0xF5,0x98,0x20,0xB9,0x13,0x3A,0xB2,0x04,0xA6,0xCE,
+	0x99,0xE8,0xE4,0x89,0xC9,0xEB,0xF5,0x6F,0x5F,0x19,0x7E,
+	0x88,0x3B,0x4C,0x4F,0x06,0x1A,0x25,0xC8,0x56,0x41,0x43,
+	0x25,0xCA,0x96,0x53,0x0F,0x02,0xB7,0xA7,0x0B,0x06,0x6C,
+	0xF3,0x64,0x27,0xD8,0xC2,0x62,0x3B,0xFC,0x74,0xFB,0xD3,
+	0x41,0x3E,0x62,0x0C,0x45,0x7B,0x35,0xE7,0xF2,0xF5,0xC5,
+	0x5E,0xD3,0x90,0xD0,0xB1,0x0B,0xA6,0x8F,0x7F,0x57,0x13,
+	0xE4,0xC8,0xCE,0x78,0xA9,0xD2,0xF4,0xE9,0xAD,0x6B,0xC4,
+	0x87,0xD2,0x1B,0x28,0x66,0xC9,0xAE,0x11,0x51,0xEF,0x0C,
+	0xFC,0xBF,0x6F,0xA2,0xC7,0x94,0x02,0x94,0xCF,0xD9,0x40,
+	0xCD,0xDF,0x37,0x06,0x4D,0xC2,0x9A,0x1F,0x83,0xBD,0x0B,
+	0x95,0x70,0xC1,0x4F,0x16,0x5F,0x85,0xC6,0x8B,0xC5,0x3C,
+	0xBA,0x60,0xFD,0xB9,0x5F,0xD8,0xEE,0xF2,0x34,0x16,0xFF,
+	0x42,0xB1,0x2D,0x48,0xDE,0xB1,0x51,0x09,0x57,0x9C,0x10,
+	0x8D,0x85,0xFD,0xC6,0xE3,0x6D,0xDF,0xCF,0x8E,0x66,0xDD,
+	0xC9,0x25,0xAE,0xB6,0xC8,0x29,0x15,0x99,0x27,0xF0,0xD9,
+	0x25,0xF3,0x28,0x55,0xB6,0x3B,0x0F,0x0D,0x09,0x5B,0x3F,
+	0x16,0x6E,0x05,0x0F,0x1D,0x0F,0xBB,0x80,0xB7,0x29,0xBD,
+	0x91,0x7F,0x01,0x43,0x30,0xD4,0x46,0x7B,0xA5,0x5C,0x8A,
+	0x51,0x6D,0xEA,0xBB,0x1B,0x61,0x37,0xED,0xE3,0x90,0x2F,
+	0xB1,0x52,0x25,0x90,0xF5,0xF3,0x2C,0x11,0x6F,0xDB,0x05,
+	0x8A,0xD1,0xE4,0xA9,0xAC,0x42,0x69,0xDC,0x5E,0xCB,0xFC,
+	0x07,0x92,0xBF,0x77,0x8F,0x7F,0xD2,0xB5,0x6E,0xA7,0xF2,
+	0xA9,0xC8,0x21,0x44,0xEB,0x2D,0xDB,0x2C,0xFF,0xC4,0xC6,
+	0x9C,0xB0,0xF2,0xD1,0x98,0x3B,0x36,0x59,0xEC,0x74,0xA2,
+	0xE4,0x11,0xEB,0x39,0xC0,0x86,0x28,0x9B,0xF7,0xC3,0x79,
+	0x62,0x81,0xF0,0x6D,0xA2,0x23,0x31,0x76,0xAD,0x4E,0x34,
+	0x0D,0xB3,0x5B,0x75,0x27,0xFA,0x3A,0xA8,0x7D,0x52,0xE5,
+	0x98,0x7F,0xBA,0xD9,0x9D,0x0B,0x43,0xC5,0x41,0xDD,0x8E,
+	0x53,0xDB,0x14,0x84,0x28,0x0F,0x6D,0x5A,0x7D,0x49,0xDC,
+	0xC8,0x0A,0x7A,0xE9,0x85,0x31,0x21,0xDC,0x7F,0x92,0xB4,
+	0x4B,0x29,0x76,0x65,0xD4,0xD3,0xB3,0x5C,0x1F,0x79,0x55,
+	0x70,0x3D,0x2A,0xC1,0xAF,0x8B,0x34,0x32,0x76,0xB9,0x28,
+	0x6F,0xBE,0x0E,0xA1,0x87,0x96,0xCD,0xA8,0x32,0x1A,0xEE,
+	0x64,0x17,0x33,0xF7,0x0F,0xF3,0x85,0x7A,0xD2,0xF1,0xD5,
+	0x68,0xFD,0x84,0x15,0xE1,0x97,0x04,0x58,0xCB,0xB8,0x5B,
+	0xBC,0xEF,0x8E,0x23,0x8F,0xF1,0xB4,0x21,0xDF,0x94,0xDA,
+	0x8C,0x90,0x8A,0x58,0xFB,0x96,0x48,0x2F,0xDF,0x34,0xE5,
+	0xC7,0xBF,0x18,0x51,0xD8,0xFC,0xB7,0x13,0x6C,0x73,0x7A,
+	0x10,0x45,0x64,0x6A,0x9F,0x5E,0x85,0x7C,0x34,0x2C,0x9E,
+	0x5B,0x0E,0x68,0xC1,0xEF,0x85,0xCB,0xC8,0x57,0x10,0x5A,
+	0x3B,0xA4,0xDA,0x6D,0x05,0xC5,0xA3,0x91,0xCF,0x17,0xBC,
+	0xFD,0x78,0x24,0x6A,0x20,0xA5,0x2D,0xC7,0x59,0xF8,0xF2,
+	0x01,0xBF,0xA2,0xDF,0xC8,0xF2,0x1E,0xDC,0xAE,0x86,0x90,
+	0xA4,0xC2,0x20,0xCC,0x36,0xFA,0xC5,0x37,0x78,0x1C,0xF2,
+	0x95,0xC4,0x8B,0x69,0x6D,0xBA,0xBB,0xE7,0x03,0x8F,0xD4,
+	0x20,0x43,0xE6,0x95,0xD1,0x05,0xEF,0xF1,0xBE,0xD3,0xDA,
+	0xF0,0x04,0xA9,0x8F,0xF2,0xAB,0x86,0xF4,0x8B,0xE3,0xDA,
+	0xB2,0x37,0xF5,0x1F,0x98,0xD8,0x89,0xCC,0x3B,0x1A,0x82,
+	0xD4,0x25,0xEF,0xFF,0x15,0xA6,0x0F,0x53,0xE5,0x38,0xC2,
+	0xE7,0xE7,0x4C,0x06,0x80,0x4C,0xB5,0xBF,0x52,0x89,0x92,
+	0x01,0x6E,0xE8,0x05,0x98,0x9F,0x5B,0x29,0x15,0x6E,0x20,
+	0x1C,0x2B,0xA9,0xA1,0xFD,0x74,0xE5,0x92,0x9D,0x29,0xE4,
+	0xF4,0x96,0x22,0xFC,0xAD,0xC2,0x16,0x1D,0x26,0xC1,0x6E,
+	0xBD,0x87,0x85,0x6C,0x62,0xE8,0xC4,0x71,0x84,0x4F,0x9F,
+	0x04,0x27,0x46,0x57,0x82,0x5C,0x52,0xCF,0x38,0x86,0x7C,
+	0x20,0x8C,0x54,0x3D,0xFC,0xAA,0xC4,0x8C,0xD8,0x98,0x82,
+	0x7F,0x52,0x72,0x8A,0x42,0x3D,0x4A,0x77,0xF8,0xB2,0xB3,
+	0xC2,0x74,0xDB,0xF0,0xA3,0x6E,0x48,0xF7,0x9E,0x73,0xBF,
+	0x2B,0xEA,0x34,0x8B,0x17,0x65,0xC0,0x51,0x43,0x23,0x81,
+	0x98,0x45,0x40,0xB1,0x79,0xA4,0xF8,0xEE,0x59,0xE1,0xA7,
+	0xD3,0x39,0xE3,0xB9,0xD1,0x9C,0xA5,0x63,0x19,0xFB,0x50,
+	0x0B,0x86,0x90,0x68,0xF0,0xC9,0xB0,0xC1,0xFB,0x70,0x28,
+	0xBB,0x2B,0x4E,0x8C,0x69,0x6E,0xE9,0xCE,0x64,0xC1,0x4F,
+	0x9F,0x61,0x7A,0xA3,0x95,0xA7,0xCC,0xF2,0xA0,0x30,0xD0,
+	0x36,0xD9,0xCA,0xF4,0xF4,0xD9,0x7E,0xBB,0xF7,0xFA,0xD1,
+	0x5D,0x83,0x89,0x74,0xC6,0xE5,0xF6,0x65,0x21,0x5C,0x6E,
+	0xEC,0xA3,0x53,0x6B,0xD5,0x05,0x41,0x7F,0x01,0xD1,0x4F,
+	0x06,0x5E,0x02,0x00,0x03,0x8D,0x80,0x53,0x5E,0x27,0x21,
+	0xCF,0xD1,0x91,0x33,0xFF,0x14,0x95,0x84,0xBA,0x58,0x59,
+	0xB4,0x83,0x70,0xF1,0xE7,0x42,0x76,0x02,0x11,0xDF,0x67,
+	0x3F,0x51,0xB2,0x04,0x9D,0x5A,0xFF,0x69,0xEA,0xF0,0x37,
+	0xE6,0xF0,0x76,0xAB,0x58,0x09,0x6B,0x6B,0x39,0x5B,0xF5,
+	0x9C,0xDF,0x33,0xF6,0x3C,0xF7,0xA0,0x6C,0x8F,0x36,0xFE,
+	0x95,0x36,0xF5,0x06,0x75,0x53,0x27,0x7A,0xCD,0xE4,0x2E,
+	0x0F,0x43,0x88,0x5E,0x5A,0xF6,0xD0,0xB5,0x1A,0xF6,0x33,
+	0x4B,0x58,0xD3,0x58,0x43,0x79,0xE9,0xBE,0x58,0x95,0x8E,
+	0xEE,0x9A,0x53,0x82,0x23,0x85,0x6E,0xF4,0xCC,0x18,0x78,
+	0x4C,0x37,0x2D,0xC0,0x03,0xE4,0x4C,0x2A,0x58,0xFC,0x0C,
+	0x0C,0x59,0x7A,0xCA,0xAC,0xBD,0x0D,0x6D,0x38,0x4D,0xC8,
+	0x36,0xBF,0x83,0x8F,0x19,0xBC,0xD5,0xC9,0xDF,0x4F,0xF3,
+	0xE8,0x55,0x72,0x4C,0x72,0xB2,0x16,0x6C,0x30,0x7A,0x76,
+	0x1D,0x02,0xE9,0x78,0x84,0x06,0x17,0xC3,0x63,0xFF,0x9E,
+	0x40,0x83,0x32,0xD7,0xFB,0xD0,0x19,0xC7,0x1C,0x70,0xBC,
+	0xB3,0xF4,0xA9,0x94,0xB6,0x76,0xC2,0x4E,0x5E,0xB0,0xC5,
+	0xC2,0x3D,0xDC,0xF8,0xA4,0xF2,0x84,0x0D,0xC2,0x5C,0x8F,
+	0xAA,0xF2,0x13,0x2B,0x79,0xAD,0x20,0x34,0xFF,0x2C,0x09,
+	0x9B,0x2F,0x14,0x93,0x38,0xD3,0xEC,0x36,0x07,0xF8,0xDB,
+	0xA0,0x54,0x56,0x87,0x6F,0x11,0x7F,0x86,0x79,0x6D,0x41,
+	0xD1,0xF4,0xF9,0x0A,0xE3,0xD7,0xB5,0x7A,0x05,0x31,0xA7,
+	0x42,0xF3,0x0C,0xAF,0x83,0x7A,0x4C,0x2A,0x63,0x04,0x53,
+	0x2B,0xF4,0xEB,0xB7,0x16,0x66,0x28,0x1A,0xF2,0xDC,0xB6,
+	0x39,0xD0,0x0C,0xBD,0x23,0x49,0x47,0x31,0x0A,0x41,0x24,
+	0x18,0xAD,0xA6,0xCE,0x18,0x37,0xF1,0xA0,0x3D,0x2D,0x03,
+	0x83,0x2E,0x7F,0x6D,0x4D,0xE1,0xBB,0x38,0x1C,0x32,0x0A,
+	0x69,0x4B,0x42,0xF1,0xBF,0x30,0xA2,0x7F,0x4D,0x50,0x9F,
+	0xF8,0xD3,0xA0,0x71,0x9F,0x2E,0xFF,0x4A,0x4F,0xAE,0x43,
+	0x32,0xAA,0xDB,0x33,0x91,0xDE,0xEF,0x13,0xFE,0x5E,0x30,
+	0xA9,0x67,0x1E,0xD9,0xD8,0x2D,0x98,0x3A,0xEB,0x83,0x98,
+	0x57,0x1B,0x45,0x93,0x86,0xA7,0x29,0xFC,0xFE,0x0D,0xE6,
+	0x67,0x1B,0xE8,0x62,0x52,0xD1,0xA2,0x35,0xFB,0xEC,0xC9,
+	0x1F,0x9C,0xC2,0x44,0x81,0x7C,0x08,0x01,0xF3,0xC1,0xEB,
+	0x23,0xF0,0xD6,0x2A,0x36,0x68,0x4D,0x2A,0x1F,0x8E,0x03,
+	0xAA,0x0E,0x41,0x03,0x3E,0x7E,0x6D,0xC8,0xF3,0x19,0x4B,
+	0x5C,0x13,0xE8,0x3F,0xC2,0x7D,0xB4,0xCB,0xA5,0x7D,0xCD,
+	0x1C,0x90,0xCB,0xD7,0xCD,0x9F,0x4B,0x01,0xB9,0xA8,0x77,
+	0x79,0x83,0xA4,0x5E,0xB3,0x9F,0xD5,0xD1,0x82,0xA3,0x6A,
+	0x0B,0xEA,0xCE,0xF3,0xE4,0xDD,0x0F,0xC4,0x5D,0x3B,0x98,
+	0xE7,0x34,0x50,0x84,0xB3,0x33,0xB8,0xBB,0x0C,0x0E,0x4F,
+	0xE2,0x33,0xE0,0xB7,0x32,0x29,0x16,0x3E,0x66,0xFB,0xBF,
+	0x6F,0xBC,0x09,0x06,0x5E,0x5A,0xA3,0xB0,0x51,0xB3,0x61,
+	0x5C,0x9C,0xBC,0x80,0x75,0x00,0xE3,0xE9,0x4F,0xDF,0x63,
+	0x50,0x25,0x6F,0x15,0xCC,0xEB,0xB8,0x8F,0x00,0x4E,0x46,
+	0xEA,0x87,0xB7,0x80,0xF8,0xC9,0x68,0xC6,0x19,0xF3,0x29,
+	0x7F,0xE8,0x3D,0xF9,0x67,0xFA,0x17,0x32,0xC7,0x4E,0xDD,
+	0xF6,0x1D,0xA6,0xB5,0x5F,0x86,0x90,0x45,0x68,0x3D,0xDB,
+	0x60,0xA7,0x67,0x7C,0x9D,0x2B,0x3D,0x50,0x62,0xC8,0x87,
+	0xAE,0x8F,0xC2,0x86,0x63,0x3D,0x89,0x30,0xFA,0x25,0xC3,
+	0x9E,0xE8,0xAD,0x43,0xA9,0xF6,0x32,0x3C,0xBA,0x05,0xC3,
+	0x4E,0x91,0x7A,0x4D,0x07,0x75,0x6A,0xB1,0x6F,0xBE,0x35,
+	0x08,0x19,0xB7,0xE8,0xFA,0x49,0xFB,0xC7,0x8C,0x33,0xEA,
+	0xCD,0xF7,0x6B,0xEC,0xED,0x73,0xE5,0xCC,0xF1,0x0D,0xD3,
+	0x48,0xEF,0x6D,0x6D,0x69,0xD3,0x7E,0x6B,0xE8,0x2D,0xCD,
+	0xD7,0x52,0xF1,0xAD,0x68,0x53,0xC9,0x09,0xEC,0xC2,0x8B,
+	0x83,0xAE,0x7D,0x5E,0xB0,0xDF,0x6B,0x81,0x28,0x13,0x5C,
+	0x18,0xD7,0x51,0x98,0xD4,0xBC,0xEC,0x07,0xEA,0xED,0x49,
+	0xD3,0xCA,0x38,0xF9,0x56,0x7F,0x83,0xAE,0x2C,0x1D,0x9D,
+	0x26,0xB4,0xCF,0x56,0x20,0xE9,0xF5,0x58,0x01,0xF7,0x27,
+	0x04,0x3C,0xDE,0x43,0x4D,0xF7,0x17,0x32,0x47,0xAD,0x42,
+	0x3C,0x66,0xFD,0xC6,0x5D,0xF3,0x37,0x9C,0x26,0x32,0x47,
+	0x48,0xD9,0x87,0xB4,0x3D,0xE6,0xBC,0x61,0xFE,0x35,0xD3,
+	0xE8,0xF5,0x9B,0x22,0xAD,0x5E,0xEF,0x6F,0x0F,0xFA,0x48,
+	0xFF,0x60,0xFD,0x3B,0x54,0xAE,0x30,0xD6,0x0F,0x4D,0xB0,
+	0x17,0x2E,0x8A,0xB7,0xC0,0xDC,0xE1,0x5B,0x45,0xF2,0x96,
+	0x4E,0x1C,0xF1,0x1C,0xEF,0x68,0xCE,0x64,0x8B,0xBF,0xC5,
+	0x84,0xC8,0x66,0x74,0x4E,0xDF,0x1F,0x87,0xF2,0x55,0x36,
+	0xD7,0xDA,0xC4,0x3E,0x32,0xEC,0x17,0x3A,0xC7,0xFC,0xD8,
+	0x8A,0xF2,0xA4,0xCF,0xA7,0x76,0xB3,0x7E,0x02,0x50,0xED,
+	0x2B,0xCD,0x41,0x02,0xBC,0xF6,0x9F,0x28,0xC8,0xD3,0x45,
+	0x28,0x99,0xD3,0xE4,0xFE,0x6D,0x01,0x3E,0xE9,0xD9,0xE3,
+	0x12,0x5A,0xBA,0x88,0xD2,0x0B,0x2C,0xA9,0x71,0x91,0x89,
+	0x8B,0xE3,0xF4,0x9C,0x07,0xBC,0xC1,0x99,0xC1,0x6F,0x83,
+	0x3B,0x43,0xDE,0x2E,0x75,0xD2,0xDB,0x3E,0xAC,0xF1,0x5F,
+	0xFE,0x7C,0x54,0x48,0x85,0xE7,0xE8,0x6B,0x95,0x60,0xF5,
+	0x6A,0xE0,0xDA,0x62,0xE3,0x4F,0xC6,0xBA,0x0C,0x93,0xB1,
+	0x2D,0xD3,0x72,0x4A,0x21,0xF2,0x8E,0x3A,0xC6,0x7C,0xFB,
+	0x96,0x4C,0x0B,0xD1,0x99,0xE3,0xD1,0x9B,0xD9,0x4B,0x30,
+	0x1C,0x1E,0x12,0x32,0x6E,0x15,0x32,0x64,0x97,0xB8,0xB7,
+	0xC8,0xA1,0xE2,0xD6,0xA2,0xC6,0x0E,0x42,0x1E,0xE6,0x7A,
+	0xA8,0x33,0xD5,0x65,0x99,0x5C,0x7E,0xE5,0x91,0x1F,0x0B,
+	0x01,0x97,0xAF,0xBF,0x5E,0xD6,0x8C,0x53,0x25,0xAD,0x7D,
+	0x23,0x7A,0x6C,0x9D,0xDD,0xFE,0x93,0x3F,0xD1,0xCF,0x57,
+	0x5C,0x53,0x05,0xE2,0xDB,0x98,0x80,0xDA,0x37,0xA6,0x6D,
+	0x62,0x8A,0x61,0xC2,0xD4,0x24,0x8F,0x5A,0xCD,0x98,0x0F,
+	0xE1,0x98,0x87,0x1F,0x75,0x94,0x1D,0xAA,0x37,0xBE,0xAA,
+	0x7A,0x74,0xA3,0x85,0xD2,0x9C,0x7A,0x69,0x4E,0x2F,0x69,
+	0xDC,0xAF,0xCA,0x03,0xB4,0x8F,0x44,0x6A,0xAD,0x5A,0xB7,
+	0xA6,0x4F,0x1C,0x3C,0x61,0xCB,0xD4,0x38,0x95,0x4E,0x8C,
+	0xEA,0x5C,0x7E,0x7C,0x08,0x68,0x0D,0x74,0x62,0x5D,0x84,
+	0xAC,0x77,0x28,0xF8,0x3D,0xC1,0x64,0x4E,0xB3,0xC5,0xB2,
+	0xE8,0xB2,0xDD,0xFA,0xCA,0xBB,0x22,0xB9,0x9B,0xDE,0xCC,
+	0x4C,0x85,0x17,0xB3,0x7C,0x18,0x83,0xE6,0x2E,0xE9,0x55,
+	0xDA,0xB1,0x35,0x5A,0x22,0xE8,0x5B,0x2B,0x54,0x9B,0xA1,
+	0x9F,0xD6,0xF1,0x62,0x5D,0x96,0xF9,0x48,0x4F,0xB1,0x4A,
+	0x25,0xA0,0xA0,0x66,0x48,0x2C,0x67,0x2D,0x97,0x48,0xEA,
+	0x65,0x2F,0x0F,0x1E,0x7B,0x74,0x17,0x5C,0x1D,0x03,0x92,
+	0x43,0xDF,0x2D,0xA9,0x9B,0x6A,0x2D,0xEE,0x4B,0x52,0xF5,
+	0xEB,0x7F,0x9E,0xDE,0x3D,0x9A,0xFC,0xD1,0x5F,0x76,0x56,
+	0x94,0xAE,0x33,0xA1,0x14,0xCE,0x97,0xB4,0x1E,0x87,0x7C,
+	0xE4,0xD7,0xCF,0xD4,0x09,0x7B,0xBD,0x33,0x9C,0x2B,0x1D,
+	0x27,0x08,0xBD,0xCB,0xCC,0xA9,0x3D,0xF4,0x9F,0xD2,0xA3,
+	0xA5,0x6E,0x57,0xD2,0xD0,0x54,0x06,0xE6,0xCA,0x4A,0x85,
+	0x1C,0x7F,0x12,0x51,0xAF,0x1F,0x56,0x0B,0x20,0x11,0x91,
+	0x0B,0x48,0x94,0x6E,0x7A,0x6C,0x5E,0xD3,0x49,0xC0,0xBD,
+	0x33,0x53,0xE0,0x9F,0xD4,0x23,0xDB,0x15,0xD3,0x1D,0xF0,
+	0xEF,0xD1,0xD0,0x97,0xAD,0x8B,0xA6,0xBD,0x2B,0xE2,0xEF,
+	0xE7,0x54,0x91,0x91,0x32,0x37,0x94,0xA8,0x27,0xE2,0x44,
+	0x27,0x71,0xAD,0x21,0x71,0x25,0x7C,0xC3,0xEB,0xF1,0xBD,
+	0xB4,0xFA,0xB7,0x68,0x5A,0x6B,0xD8,0x2F,0xA3,0x40,0xA9,
+	0x77,0x3A,0x2B,0x89,0x6A,0x47,0x0C,0xE5,0x61,0xE2,0x8B,
+	0x70,0xB4,0xA5,0x16,0x28,0xD9,0x87,0x8A,0xC6,0xD5,0xA7,
+	0xCB,0x4D,0xFC,0x68,0x43,0x8A,0xA7,0xB2,0xED,0xE8,0xAD,
+	0x72,0x46,0x67,0x17,0x3D,0xBF,0x57,0x56,0xAF,0xB5,0xFD,
+	0x78,0x7D,0x09,0x87,0xA2,0x74,0x6B,0xC6,0x98,0x59,0x3E,
+	0x9C,0xB9,0xBA,0x94,0xEF,0x31,0x57,0x63,0x68,0x54,0xAB,
+	0x31,0x0B,0x48,0x50,0x4E,0xD7,0x99,0x66,0x3B,0x05,0x87,
+	0x60,0x0B,0xE6,0xC4,0x14,0xE4,0x29,0x5C,0x9C,0xF9,0xFC,
+	0x0F,0xB2,0x31,0x75,0x2B,0xA1,0x51,0xFA,0xEA,0xFE,0x5A,
+	0x82,0x08,0x3D,0x40,0xF8,0xA1,0x50,0x03,0xC8,0x42,0x22,
+	0x4C,0x9E,0xCD,0xFE,0xB3,0x16,0x22,0xB2,0x65,0x28,0xB2,
+	0x88,0x87,0xDD,0x5B,0xD5,0x9F,0xE7,0x15,0x3B,0xA3,0xA8,
+	0x7F,0xB9,0xE5,0xAB,0x86,0x8B,0x3F,0x18,0xF1,0xCC,0x8A,
+	0x57,0x4A,0x74,0xBE,0x7E,0x66,0xF3,0x99,0x6A,0x9D,0x45,
+	0x61,0x7D,0x63,0x45,0xEB,0x11,0xF5,0x8C,0x17,0xCD,0x1E,
+	0x67,0xBE,0xAA,0x2A,0x06,0x3A,0x6D,0x4D,0x44,0xB6,0x4E,
+	0xA5,0xEB,0xAA,0x9E,0x4C,0xF3,0xD8,0xCC,0x4F,0xE5,0x8C,
+	0xBC,0xF8,0x05,0x9C,0xD0,0xA0,0x65,0x7A,0x94,0xC1,0x06,
+	0xEB,0x9F,0xF5,0x1E,0x72,0xEF,0x4D,0x67,0x08,0xA5,0xE7,
+	0x01,0x1A,0x32,0x7A,0x0B,0xDE,0x6E,0x4D,0xF2,0xB7,0x67,
+	0xBB,0x79,0x98,0x75,0x64,0xF8,0xC6,0x82,0x0A,0xEF,0xED,
+	0xEB,0x6D,0x47,0x9C,0x64,0xA8,0x8E,0xEC,0x14,0x6D,0x73,
+	0x32,0x31,0x4C,0x20,0x1F,0x26,0x62,0xDF,0xE3,0x3B,0xD8,
+	0xA3,0x45,0x34,0x71,0x51,0xE0,0xDE,0xD1,0x90,0x29,0xDA,
+	0x75,0xD5,0x5E,0x7F,0xF8,0x21,0x56,0x3A,0xEE,0x3C,0xFF,
+	0x3C,0xAC,0x05,0x98,0xE9,0x31,0xBD,0x07,0x08,0x3B,0x30,
+	0xDE,0x99,0x36,0x5A,0xAE,0x49,0x24,0x6F,0xA0,0x8C,0x3D,
+	0x16,0x4C,0x8F,0xAF,0x68,0x69,0xFF,0x03,0x26,0x06,0xAB,
+	0xF5,0xBF,0x68,0x85,0x6F,0x7A,0x31,0x7F,0xFB,0x38,0x2D,
+	0x51,0x84,0xE0,0x1F,0xD5,0xE3,0xB7,0xFE,0x05,0x27,0x62,
+	0xAB,0x6E,0x1E,0x26,0xD1,0xDE,0xBE,0xB0,0xDF,0xAC,0x08,
+	0x11,0x3C,0x64,0x9C,0x4C,0x90,0x82,0x5E,0x68,0x11,0x8C,
+	0xFF,0x48,0x49,0x3C,0x3E,0x15,0x87,0x24,0x8C,0x78,0x50,
+	0xCF,0x17,0x71,0xE6,0x54,0x5B,0x76,0xA6,0x54,0xFA,0xB7,
+	0xE4,0xCB,0xA4,0xCC,0xA4,0xB4,0x9E,0x4C,0x11,0x3F,0xB7,
+	0x3F,0xB4,0x6A,0x80,0x49,0x93,0x46,0x59,0x4E,0x8B,0x56,
+	0xBF,0x89,0x32,0x59,0xB8,0xD7,0x23,0xAD,0xD5,0x0A,0x72,
+	0x6F,0x25,0xDA,0xDF,0xD0,0xBD,0x04,0xA8,0xF8,0xE5,0xD4,
+	0xFD,0x3D,0xBE,0x53,0x7C,0xFA,0x86,0x7B,0xED,0x55,0xE0,
+	0xA3,0xDC,0xB3,0x42,0x4D,0x7C,0x1E,0x8C,0x29,0x2A,0x20,
+	0x41,0x83,0x75,0xA0,0x97,0xCF,0xB4,0x5D,0x0A,0x1E,0xA6,
+	0x20,0xEC,0x92,0xBE,0x99,0x8A,0xFB,0x42,0x74,0xC4,0x32,
+	0x15,0xFC,0xF9,0xDD,0x15,0x1F,0x61,0xA4,0x53,0x88,0xDB,
+	0x99,0x8C,0x33,0x90,0xCC,0xA0,0x18,0xC0,0xED,0xB2,0xA9,
+	0x26,0xFA,0x6D,0xC3,0xCB,0x18,0xD9,0xA6,0x01,0xE8,0xE3,
+	0xEC,0x13,0x53,0x7F,0xAF,0xE6,0xCD,0xB2,0x93,0x4E,0x4B,
+	0x3D,0x0A,0x34,0x0F,0x0E,0x1E,0xD7,0x46,0x30,0x3F,0x1F,
+	0x71,0x18,0x7F,0x2D,0x0C,0x0A,0x79,0xFF,0xF0,0x81,0x45,
+	0x4B,0x35,0xC0,0xF3,0xAB,0x4E,0x5F,0xED,0xB2,0xEF,0xCD,
+	0x7C,0x3D,0x8B,0x82,0x4B,0x5D,0x2A,0xD5,0xFC,0x2B,0x47,
+	0x4C,0xB4,0x37,0x78,0xF5,0xFB,0x7A,0x44,0x46,0x2A,0x17,
+	0x7C,0xFE,0x7E,0x93,0xC8,0x9A,0x58,0x53,0x30,0xB6,0x75,
+	0x9D,0x99,0x3D,0x9F,0x3D,0x9D,0xCF,0xB3,0xB8,0x9E,0xC8,
+	0x35,0x00,0x76,0xB6,0xAE,0x25,0x88,0x03,0x98,0xE7,0x54,
+	0x02,0x39,0xBA,0x6E,0x3D,0xBB,0x16,0xF7,0x25,0x5E,0xBD,
+	0x8B,0xAB,0x9A,0x2C,0x64,0x52,0x0A,0x8F,0xC0,0x94,0xA3,
+	0x2A,0x2C,0x90,0xCE,0xED,0xFE,0x3A,0xFF,0xD6,0x5F,0xAD,
+	0xD1,0xCB,0xC7,0x3C,0xB2,0x4E,0x23,0x44,0x6B,0x9E,0x16,
+	0x52,0xBF,0xB6,0x2D,0x01,0xB9,0x4D,0xD3,0x6B,0x87,0xE0,
+	0x15,0x9D,0xE5,0x21,0xEB,0x59,0x7A,0x9F,0xA2,0x8F,0x2E,
+	0x2A,0x53,0x2A,0xBF,0xE5,0x32,0xDE,0x69,0x71,0x5B,0x32,
+	0xB5,0x70,0xAE,0x9C,0xE9,0xA8,0x57,0xBD,0x16,0xB5,0x1E,
+	0x0A,0xE3,0xEF,0x39,0xD3,0xB1,0x6B,0x24,0x1D,0x09,0x93,
+	0x7F,0x30,0x2D,0xAF,0xF8,0x46,0xD0,0xB8,0xFE,0x48,0x9B,
+	0xEA,0xFA,0xF3,0xC5,0xDF,0xE2,0xBC,0xB3,0x5A,0x33,0x19,
+	0xB1,0x4E,0xA5,0xB5,0x4C,0x52,0xE6,0x7E,0xF8,0x26,0x2C,
+	0x74,0xB9,0x63,0x2B,0x2A,0x9D,0xC0,0x01,0x28,0xF9,0xAE,
+	0x08,0x03,0xA3,0xE7,0x96,0xAB,0x09,0x56,0xDB,0xDE,0x68,
+	0xC9,0x84,0x98,0x30,0xC5,0x49,0xEF,0x76,0x74,0x09,0x22,
+	0xD4,0xC8,0x89,0x53,0x6C,0x25,0x96,0x2F,0x7E,0x5C,0xFE,
+	0xBB,0x76,0xFE,0xCF,0x66,0xB0,0x72,0x6D,0x78,0xF3,0x51,
+	0xCC,0x3C,0xCA,0xEF,0xB6,0x8D,0x8A,0xF1,0xA1,0xDF,0x76,
+	0xBC,0x3C,0xFD,0xC4,0x98,0x55,0x42,0x55,0x71,0xE4,0xB6,
+	0x9B,0xB8,0xE4,0x65,0xEF,0xA7,0x67,0x85,0x1F,0xF9,0xA0,
+	0x3E,0x48,0xB0,0x37,0x35,0x5F,0x32,0xCC,0xC8,0x03,0x5A,
+	0xDD,0xF9,0xA6,0x0D,0xDC,0xE5,0xC7,0x8B,0xBE,0x2D,0x94,
+	0xA2,0x2B,0x27,0xB2,0x07,0x8D,0x53,0xD3,0x1D,0xFD,0x80,
+	0xED,0x7B,0x77,0x4D,0x1E,0xEF,0x46,0x15,0x16,0xB7,0xBC,
+	0x3A,0xAC,0x7B,0x2A,0xBC,0xB6,0x4B,0xBF,0x70,0xE2,0x2E,
+	0x2F,0xDF,0x4A,0xDC,0xFD,0x9E,0xCA,0xED,0xBF,0xEB,0x4C,
+	0x20,0xC6,0x83,0x1B,0x8B,0xFD,0xAB,0xF9,0xCC,0xEF,0x74,
+	0xE6,0xD2,0x27,0xB1,0x12,0xD4,0x87,0x09,0x54,0xDB,0xE4,
+	0x32,0x78,0xC8,0x6F,0x93,0xAF,0x7D,0x43,0xFE,0x8F,0x74,
+	0xDD,0xD0,0x7D,0xD6,0xEC,0xC4,0x21,0x7F,0xFE,0x19,0xF1,
+	0xFB,0x4F,0x6E,0x88,0xE9,0xE0,0x3E,0x2F,0x83,0x50,0xD4,
+	0x07,0x32,0xDF,0x74,0x38,0x46,0x78,0x5B,0x91,0xA7,0xD2,
+	0x5D,0x36,0x38,0x13,0x78,0x22,0xA4,0xC7,0x04,0xC8,0xD0,
+	0xA2,0xCF,0x04,0x3E,0xA2,0x2E,0xD0,0x45,0x95,0xEA,0xB8,
+	0xE5,0x28,0x45,0x92,0x68,0xBF,0xC7,0xF2,0xB3,0xDF,0xBF,
+	0xCD,0xDC,0xEF,0x62,0xEB,0x83,0x94,0xCA,0xAD,0x60,0x34,
+	0x19,0x98,0x03,0xCB,0x50,0xBB,0xEF,0xB1,0x23,0xF0,0x81,
+	0x6F,0xE9,0xAE,0xEC,0xD6,0x39,0xAA,0xFA,0xC9,0x99,0xB8,
+	0x15,0x5B,0xE8,0x2D,0x07,0x8D,0x1D,0x26,0x31,0x75,0xF7,
+	0xF9,0xF9,0x47,0x07,0xFB,0x4C,0xC3,0xAF,0x71,0xF3,0x8F,
+	0x46,0x0C,0xFB,0xE2,0xEB,0x86,0xBE,0x97,0x6E,0xEF,0x2D,
+	0xEB,0x0A,0x9C,0xB2,0x37,0x80,0x92,0xB3,0x25,0xF5,0xBC,
+	0x58,0xAD,0x77,0x52,0xBF,0xE8,0x3E,0x7E,0x3A,0x0D,0x23,
+	0x0A,0x3A,0x7B,0x15,0x7C,0x8A,0x95,0xA3,0xEF,0x38,0x2A,
+	0xB1,0x85,0x45,0x02,0xC0,0xA9,0xEB,0xF8,0x14,0xF4,0xCA,
+	0x95,0x5C,0x32,0xB5,0xF7,0x09,0xF2,0xDC,0xB7,0xE3,0xBC,
+	0x67,0x57,0xDA,0x3F,0x64,0x11,0x8D,0x6F,0xAD,0x9C,0x0A,
+	0x7A,0xE5,0x42,0x91,0xCD,0x9E,0x46,0xA1,0x79,0xAC,0x2A,
+	0x22,0xA5,0x0F,0x1F,0xFD,0x5B,0xCE,0xB3,0xC6,0x65,0xAF,
+	0xBB,0xBF,0xB2,0x56,0xC9,0xEA,0x8E,0xC9,0xE1,0xD4,0xA3,
+	0xDE,0xC7,0xF0,0x40,0xB4,0xC7,0x81,0xB7,0xCF,0x70,0x74,
+	0x7F,0xE7,0xC8,0xB7,0x8A,0xD1,0x58,0xE6,0xD6,0x8F,0x61,
+	0x69,0xB1,0xFD,0x99,0xFD,0xD8,0x91,0x7C,0xBC,0x57,0x86,
+	0x9E,0xDF,0xEE,0x29,0xEC,0x27,0xC2,0x9E,0xC7,0xE7,0x8F,
+	0x07,0xF2,0x86,0x29,0xFC,0x72,0x7E,0x19,0x53,0xCF,0xAC,
+	0xC3,0xDB,0x0F,0x86,0x9E,0x34,0xD7,0x76,0x47,0x72,0x10,
+	0xB8,0x63,0xDB,0x6C,0x3E,0x61,0xED,0x84,0xA1,0x8D,0x9F,
+	0x06,0x25,0xBE,0xB9,0x7B,0x36,0x71,0xF7,0x33,0xE9,0xB2,
+	0xCA,0xD1,0xC4,0x77,0x73,0x3C,0xAC,0xC8,0x03,0xC0,0x31,
+	0x29,0x0B,0xF5,0xCB,0x9E,0x27,0x31,0xE8,0x83,0xC8,0x04,
+	0x91,0xE7,0xCB,0xBA,0x3F,0x4B,0x19,0x69,0xDD,0x7D,0x62,
+	0x7F,0xE5,0xD4,0x2D,0x5F,0xA5,0xE0,0xE8,0xCF,0x46,0x25,
+	0x8A,0xA5,0x85,0x1B,0x7A,0xFB,0x40,0xDC,0x04,0xF4,0x09,
+	0x15,0x02,0x68,0xB6,0x35,0xC0,0xBF,0xF5,0xEE,0x09,0xA9,
+	0xA9,0x7C,0x35,0xB9,0xA7,0xA6,0x1A,0xF9,0xCE,0x55,0xE8,
+	0x89,0x07,0x33,0x7B,0xFF,0xE6,0xFA,0x99,0x7B,0xD7,0x41,
+	0x0E,0x88,0x75,0xB5,0xDD,0x0E,0x19,0xF2,0x64,0xE6,0xCA,
+	0xA9,0x92,0x38,0x1A,0x69,0xF4,0xC3,0xE7,0x2F,0x27,0x76,
+	0x25,0x08,0x77,0xC0,0x98,0x5A,0xDA,0xA4,0x1B,0xCD,0x5D,
+	0x78,0xF6,0x92,0xA8,0xC6,0x0B,0x3F,0x72,0xDF,0xA2,0x54,
+	0xEF,0x52,0xE3,0x99,0x95,0xE7,0xE3,0x40,0xC7,0xBE,0xB9,
+	0x16,0x01,0x55,0x14,0x15,0x9C,0x90,0xE4,0x41,0x9F,0x7D,
+	0xF2,0x62,0x09,0x0E,0x13,0x31,0x06,0xA9,0xA0,0x43,0xA7,
+	0xC0,0x51,0x57,0x81,0xE2,0xAF,0x67,0x4E,0x29,0x19,0x5A,
+	0x35,0xA3,0xBF,0xFB,0x80,0x83,0xB3,0xBD,0x6D,0x9F,0x80,
+	0x7D,0x83,0x26,0xCE,0x07,0x7F,0x0F,0x37,0x67,0x7F,0x32,
+	0xC6,0x53,0xE2,0x0D,0x48,0xCF,0xF6,0xFC,0x56,0xC6,0x7E,
+	0x48,0x9F,0x3C,0xB3,0x0B,0x85,0x10,0x03,0x16,0xD4,0x57,
+	0xC6,0xE5,0x04,0x1A,0xBE,0x1B,0xAE,0x47,0x58,0x11,0x2F,
+	0x4E,0x51,0x09,0xB8,0xA6,0xA7,0x6B,0x8F,0xA6,0x1C,0x6F,
+	0xB3,0xD9,0x30,0x56,0x4C,0xA8,0x97,0x72,0xA9,0xD3,0xC2,
+	0xE9,0xEF,0x3B,0x36,0x22,0x2E,0xE8,0x88,0x90,0x99,0xD2,
+	0xEF,0x73,0x64,0x07,0xF5,0x53,0x0F,0x55,0xAB,0x19,0xCC,
+	0x57,0x6A,0xA4,0xC8,0xCF,0xA9,0xEF,0x46,0x29,0x48,0x71,
+	0xF8,0x2B,0x1E,0xE6,0x55,0xC2,0x50,0x08,0x2E,0x73,0xEE,
+	0xEE,0xF2,0x02,0xA7,0x40,0x60,0x00,0x8A,0xEE,0x48,0xB4,
+	0x01,0x41,0x3E,0x41,0x60,0x2A,0x66,0x3C,0x2B,0xF2,0x90,
+	0xC5,0xB5,0x76,0x38,0x1F,0x5D,0x25,0x11,0xB9,0x5A,0xD8,
+	0x07,0xB0,0x68,0x4C,0xFE,0x67,0x39,0x7A,0x0C,0xB8,0x9F,
+	0x1E,0x06,0xCE,0xE0,0xFD,0xDD,0x69,0xCA,0xE5,0x8D,0x13,
+	0x00,0x3A,0x67,0xB5,0xDD,0xE5,0x41,0x1B,0xBD,0x74,0x9A,
+	0x43,0xEF,0x50,0x8F,0xF7,0x29,0x24,0xCA,0xA0,0xE1,0x94,
+	0x6C,0x11,0x39,0x82,0x7E,0x84,0xEF,0x36,0x70,0x33,0xEF,
+	0x33,0xD3,0xE1,0x2B,0x5F,0x7A,0xAF,0x87,0xAB,0x22,0xE8,
+	0xA3,0x99,0xD7,0x05,0x77,0x42,0xC7,0x7A,0xD4,0xEE,0x66,
+	0xB2,0x43,0x65,0x41,0x50,0x8C,0xC9,0xA1,0xBE,0x3C,0x84,
+	0x8B,0x0D,0x47,0x39,0x1F,0x69,0xBA,0x79,0x30,0x2D,0x60,
+	0x0A,0x7D,0xCC,0x11,0xFE,0xAA,0xF6,0x3A,0xF3,0xBE,0xBB,
+	0x1A,0x58,0x88,0x1D,0xEE,0xB1,0xA4,0x66,0x06,0xA7,0x95,
+	0x59,0x9C,0x31,0x99,0x3C,0xB1,0x99,0xFE,0x2A,0x90,0xC4,
+	0x92,0x8F,0x3F,0x3A,0x25,0x8A,0x7C,0xEA,0xC3,0xE3,0x74,
+	0x6A,0x03,0xAC,0xC6,0x3A,0xA8,0x7C,0xDD,0xBC,0x02,0xFC,
+	0xB9,0xC6,0xF7,0x9D,0x65,0xC0,0x39,0xFD,0xFB,0xB3,0xC8,
+	0xA8,0xA2,0xA3,0xA0,0x27,0xE3,0x7F,0x90,0x74,0xD7,0xCB,
+	0x5F,0x9F,0x47,0x7A,0x5F,0x14,0x17,0xE7,0x7B,0x9B,0x07,
+	0xD5,0xDD,0x2F,0xBF,0xA1,0x67,0xC3,0x24,0x2D,0x87,0x55,
+	0x04,0xB7,0xA8,0xCE,0x08,0x2C,0xE2,0x08,0x78,0x31,0xFB,
+	0xD8,0x49,0x11,0x95,0xE3,0xD7,0xD5,0xB2,0xA7,0xFE,0xF6,
+	0xCC,0x00,0xC4,0xBE,0x19,0x30,0xCE,0x3D,0xDB,0x0D,0x9C,
+	0xE8,0x9F,0xDE,0x3E,0xB2,0x58,0xB0,0xBB,0x1A,0xB4,0xF7,
+	0x0B,0x4C,0xFC,0xB6,0x68,0xBA,0xE4,0x9C,0xA9,0xFF,0x39,
+	0xBC,0x76,0x65,0xD2,0x5C,0xF5,0x0E,0xB3,0x79,0xA6,0x7B,
+	0x19,0x74,0x99,0x0B,0xE5,0x05,0x34,0x42,0xC6,0x98,0x51,
+	0x92,0xBF,0x12,0x99,0x7C,0x77,0xD0,0xCF,0xB4,0x9A,0x4A,
+	0x3F,0x77,0xC8,0x0B,0x7C,0x09,0x0F,0xBF,0xF7,0x8E,0xDD,
+	0xBF,0x07,0x99,0x7F,0x87,0x8A,0x9B,0xD2,0x9E,0xD1,0x9E,
+	0xD2,0x9E,0x7B,0x37,0x73,0x62,0x2E,0x7B,0xB1,0x43,0x19,
+	0x5C,0x3C,0xA7,0x21,0x65,0xB9,0x1D,0x42,0xB8,0x1F,0x1E,
+	0x41,0xFF,0x9E,0xB2,0x40,0x3F,0xA5,0xD2,0x7C,0x23,0x84,
+	0x04,0xEB,0x37,0x99,0x49,0xE0,0xBB,0x3A,0x95,0x80,0x94,
+	0x2B,0x78,0x79,0x0B,0xA1,0x86,0x1E,0x20,0x8B,0xB7,0x3B,
+	0x18,0xAC,0x84,0xC3,0x4D,0x95,0x5A,0x0B,0xA9,0xAD,0x3B,
+	0x64,0xE3,0x0F,0x7C,0xF0,0xAB,0x3C,0x15,0xA1,0xEB,0xC5,
+	0xDB,0xC1,0x8B,0xC4,0x25,0xD9,0x23,0x1B,0x37,0x4E,0xDD,
+	0xB5,0xDD,0x7B,0xF1,0xC8,0x31,0xFC,0xF8,0x41,0xA9,0xF0,
+	0xFE,0x4D,0xC3,0x4E,0xE5,0x10,0x66,0xF1,0xB2,0xC6,0x56,
+	0xC4,0xEE,0x03,0x87,0x67,0x81,0xD7,0x30,0xD9,0x82,0xFF,
+	0x8D,0x09,0xE5,0x45,0xAA,0x68,0x78,0x81,0x49,0x4B,0x57,
+	0xC7,0xAD,0xC3,0x5E,0xED,0x0A,0x5F,0xEB,0xDF,0xBE,0xFA,
+	0x76,0x7D,0xD1,0x00,0x0C,0x5B,0x24,0x2D,0x39,0xC9,0xF5,
+	0xDC,0xF2,0x76,0x3D,0x84,0x52,0x45,0x6F,0x28,0x6A,0x67,
+	0x05,0x48,0xB5,0x90,0xB4,0x7E,0x50,0x77,0xA8,0x03,0x7A,
+	0x59,0xE6,0x3B,0x05,0x01,0x6B,0x41,0x19,0x1C,0xB5,0x95,
+	0xFF,0x78,0x77,0xF8,0xF5,0x0A,0x2E,0x8A,0x1C,0x1C,0x51,
+	0xC2,0x0E,0x5C,0x18,0x50,0x72,0xBB,0xC8,0x7B,0xB1,0x74,
+	0x69,0xE1,0x22,0x13,0x5D,0xBA,0xC4,0x94,0x75,0xA5,0x52,
+	0xE1,0xD6,0x1F,0x65,0x1E,0x6D,0xF9,0x5A,0x73,0xF7,0x05,
+	0xA9,0xFC,0xF4,0xE8,0xD6,0x86,0x0C,0x50,0x20,0x76,0x9B,
+	0xF5,0xF9,0x40,0xB6,0xE3,0xEA,0x9E,0x5A,0xE9,0xFA,0x49,
+	0xBC,0x07,0xE5,0x0B,0xD8,0xC7,0x32,0xE3,0x4F,0x22,0x7F,
+	0x26,0xDA,0x27,0x13,0x95,0xFD,0x7B,0x7C,0x6B,0x3D,0xA7,
+	0xAE,0xF2,0x35,0x0A,0xD8,0x74,0x69,0x9B,0xBB,0x9C,0x97,
+	0x02,0x4C,0xFF,0xC5,0xBB,0x90,0x27,0xAE,0x35,0x7B,0xDB,
+	0x1D,0xD4,0x19,0x4F,0x1B,0x1F,0x5B,0x9A,0x47,0x00,0xC7,
+	0xF6,0x90,0xBB,0xE3,0x19,0xFB,0x3B,0xBC,0xAD,0x2E,0x0C,
+	0xFD,0x28,0xA0,0x5F,0xF6,0x6E,0xD2,0xCE,0x26,0x20,0x83,
+	0xC3,0x3B,0xD4,0x49,0x55,0xDC,0x2F,0x5D,0xB7,0xC9,0x7E,
+	0xC0,0x33,0xA7,0xC7,0xCB,0x71,0xAE,0x2A,0x9D,0x30,0xF9,
+	0x67,0xF5,0x13,0x2A,0x93,0x90,0x63,0xD9,0xAA,0x9E,0xBC,
+	0x83,0x97,0x34,0x73,0x00,0xF6,0x96,0x2F,0xF1,0x61,0xE3,
+	0xC2,0xC5,0xE1,0x67,0x72,0x6E,0xCE,0x5D,0xCF,0x8E,0xF2,
+	0xB2,0x17,0xD9,0xC6,0x52,0x7D,0x7E,0xED,0xDE,0xC8,0xB9,
+	0x96,0x68,0x3F,0x9A,0xEF,0xA4,0xD6,0xB3,0x39,0x7C,0xA2,
+	0xB0,0xB4,0x50,0x04,0x25,0xB4,0xA0,0x6A,0x5F,0x5E,0x52,
+	0x40,0x7C,0xB2,0xA6,0xBF,0x9E,0xBD,0x2D,0xF4,0x31,0x7C,
+	0x9F,0xD3,0xF7,0x33,0x41,0xCA,0xBC,0x57,0xDA,0x76,0x86,
+	0xB5,0x48,0xE3,0x54,0x0A,0x2F,0xF6,0x09,0xD4,0xAE,0xBC,
+	0xFA,0x21,0xCC,0xBD,0x4A,0x78,0x27,0x0D,0x3C,0x71,0x70,
+	0x0F,0xA3,0x78,0x7A,0x29,0x99,0xC9,0xF2,0xD8,0x77,0x78,
+	0x0D,0xD3,0x48,0x96,0xCF,0xD4,0xA4,0xD2,0x46,0x2A,0x97,
+	0x8B,0x7A,0xE6,0x8C,0xCD,0x15,0xD2,0x6F,0xAB,0x82,0x2D,
+	0x5B,0xD9,0x79,0xC3,0x99,0xF7,0x56,0x21,0x52,0x37,0xBC,
+	0xD5,0xEF,0xF6,0x7A,0x24,0xE6,0x4E,0xFF,0xC5,0x60,0xCD,
+	0xBB,0x88,0x2D,0xA0,0x21,0x69,0xAF,0xC6,0x3E,0x93,0xFF,
+	0x8E,0x91,0xD4,0xD6,0xC4,0xC8,0x62,0x0B,0xCC,0x61,0x6E,
+	0xF6,0x6F,0xD4,0xE0,0x14,0x4F,0x21,0xED,0x45,0x0C,0x01,
+	0x36,0x93,0x0B,0xE7,0x9D,0x54,0xC0,0x87,0x08,0x03,0x03,
+	0x8A,0xE9,0x51,0x89,0x67,0xBE,0x66,0xFE,0xFB,0xB6,0x9D,
+	0x20,0xB4,0x58,0xEE,0x0E,0x9A,0x0F,0xC7,0xEE,0xCC,0xEF,
+	0xB4,0xF9,0x2D,0xCD,0x03,0xB6,0xFA,0xE1,0xEA,0xDC,0xB7,
+	0x15,0x01,0xB5,0xE8,0xDD,0x39,0xCA,0xEF,0x5B,0x97,0x68,
+	0xE2,0xE5,0x75,0xDA,0x10,0xD4,0x30,0xC1,0x7A,0x0F,0x9A,
+	0xCE,0x91,0xCF,0xBB,0x5F,0xAA,0x92,0x2B,0xD6,0x2D,0xB0,
+	0xDD,0x22,0x7F,0x52,0x8F,0xD4,0xFD,0x0D,0x39,0x66,0x9F,
+	0x94,0xD8,0xDF,0xDF,0x4A,0x71,0xCA,0x37,0x1B,0xA4,0xF2,
+	0xCD,0xF3,0xE7,0x49,0xE6,0x99,0x70,0x68,0x03,0xB9,0xA6,
+	0xB9,0x62,0x5C,0x4F,0xB6,0x7C,0x5E,0xC6,0xF6,0x6D,0x9C,
+	0xE0,0xAE,0x59,0x9A,0x9C,0x6C,0x99,0x60,0x2C,0x82,0x84,
+	0x58,0xB4,0xB4,0x1F,0x5E,0x7C,0xB5,0x5A,0x32,0xD4,0xA3,
+	0x0B,0xE0,0x71,0xE9,0x97,0x3F,0xED,0x70,0x0B,0xF5,0x41,
+	0x5C,0xC1,0x0C,0xC1,0xC4,0x3E,0xBD,0x5B,0xBB,0x59,0x33,
+	0x32,0x4D,0x56,0x25,0xD8,0x31,0xD9,0x83,0xCE,0xC9,0x5B,
+	0x4A,0x72,0xD0,0xEB,0x89,0xA2,0x96,0x99,0x1D,0x3D,0x79,
+	0x4A,0x13,0x86,0xA4,0x35,0xA2,0x9F,0xA9,0xBC,0xF2,0xD1,
+	0x34,0x66,0x0F,0x87,0xBD,0xAA,0x55,0xDB,0x2D,0xA6,0x8C,
+	0x96,0xDB,0x3C,0x76,0x20,0x05,0x58,0x48,0x37,0x51,0x97,
+	0x3D,0x9F,0x94,0xBA,0x49,0x42,0x04,0x6A,0x39,0xF9,0xF2,
+	0x6B,0x79,0x19,0x8E,0xEB,0xA3,0x39,0x71,0xA2,0x26,0x86,
+	0x89,0x04,0xD0,0x9E,0xCB,0x6E,0xC6,0x85,0x1F,0x03,0x26,
+	0x91,0xA4,0xF9,0x7B,0x5A,0xC0,0xAF,0xEC,0xED,0x85,0x42,
+	0x6B,0xA0,0xFA,0x78,0xB4,0x7A,0x35,0x20,0x1D,0xD3,0xCB,
+	0x62,0x04,0x62,0xC3,0x13,0x6E,0xC1,0x75,0xBD,0xFB,0x39,
+	0x09,0xB4,0x1E,0x92,0x29,0x66,0xE2,0x30,0x4E,0x96,0xEA,
+	0x6C,0x1A,0x5F,0x0D,0x6B,0x48,0x72,0x30,0xBD,0x90,0x91,
+	0x14,0x68,0x9A,0x00,0x49,0xF3,0x63,0x29,0x01,0x4D,0xCF,
+	0x9E,0xE5,0x21,0x9B,0x46,0x68,0xDA,0xB0,0x88,0xEA,0xF2,
+	0x07,0x52,0x32,0xA6,0x41,0xC0,0xF1,0x30,0x4F,0xC8,0xAE,
+	0x25,0x0B,0x0E,0x94,0x7F,0xBD,0x1E,0xC6,0xC2,0x01,0x21,
+	0x5F,0x90,0xF0,0x68,0xB8,0xA4,0xC3,0x1B,0x0E,0x8B,0x65,
+	0xCE,0x7D,0xDC,0xC1,0x32,0xE2,0xEA,0xEA,0x5E,0x11,0x2C,
+	0x40,0xBF,0xCA,0x6F,0x23,0x0B,0xFF,0x07,0x98,0x6E,0xDF,
+	0x16,0xE4,0x05,0xDF,0x92,0x36,0x4B,0x66,0x43,0xDB,0x51,
+	0xB0,0xF3,0xCB,0xED,0xB8,0x73,0x85,0x70,0x33,0x0B,0x1B,
+	0x38,0xDD,0x0A,0x06,0xA2,0x12,0xD9,0xFE,0x8E,0x47,0x21,
+	0x99,0x89,0xF5,0x5B,0x6E,0xF0,0xDD,0x0B,0xEC,0xE3,0xAC,
+	0x5B,0x93,0x3C,0xEF,0x3C,0x23,0x79,0x6F,0xB1,0x35,0x02,
+	0x30,0xB2,0x55,0x54,0xB6,0xA4,0x94,0x1B,0x46,0x5A,0x0A,
+	0x79,0x55,0xB4,0x70,0xFB,0xA6,0x47,0x1B,0x82,0x99,0x3E,
+	0x7A,0x58,0x98,0x48,0xBF,0x2B,0x94,0x64,0xC9,0x79,0xBA,
+	0x7E,0xA8,0x3C,0xE0,0x81,0xBB,0xDC,0x86,0xCC,0xE6,0x0E,
+	0xA4,0x22,0xA5,0xD2,0x98,0x86,0x87,0x64,0xF6,0x9F,0x22,
+	0x71,0xE3,0x41,0x57,0xDF,0x1E,0x38,0xBA,0x0D,0xE1,0xD2,
+	0x25,0x26,0x7F,0x68,0xC1,0x5E,0x89,0x91,0x4A,0xD3,0xB8,
+	0x74,0x9C,0xF3,0x4F,0x56,0x30,0xFD,0x49,0x14,0x21,0x89,
+	0xC9,0x73,0x48,0x4A,0x62,0x59,0x71,0xCE,0xBD,0xA0,0xC1,
+	0x91,0xDD,0x5A,0xE6,0xED,0x6B,0x86,0x32,0x1A,0x3A,0x91,
+	0x5F,0xCB,0xE9,0x6A,0x33,0xE0,0x03,0x0D,0xF3,0x8D,0x54,
+	0x03,0x50,0x9C,0xC1,0x87,0xEA,0xCA,0x4B,0x9A,0x74,0x39,
+	0x41,0xD9,0x63,0x3C,0xAE,0x5E,0x9F,0xC7,0x86,0xFE,0x41,
+	0x2F,0x7F,0x29,0x2B,0x63,0xE0,0x84,0xD2,0x52,0xE9,0xAE,
+	0xAE,0xCC,0x08,0x19,0x51,0x63,0xC6,0x67,0x84,0x64,0xC6,
+	0xC0,0xA8,0x6A,0x67,0x42,0x66,0xB5,0x39,0xA8,0xEE,0xE0,
+	0xA5,0xAB,0x2B,0x80,0xBA,0x05,0xF5,0x2D,0xC7,0x4E,0xE7,
+	0xDD,0xC0,0xE5,0xB6,0x95,0x81,0xFB,0xB3,0xA8,0xC2,0x0E,
+	0x4E,0x6D,0xEA,0x29,0x33,0x5E,0x5F,0x57,0xD5,0xAC,0xF2,
+	0xDE,0xE3,0x16,0xEC,0x94,0xA0,0x37,0x8F,0x72,0x89,0x52,
+	0x6C,0x85,0xCC,0x7D,0xD7,0x87,0xBB,0xD2,0x85,0x3E,0xDC,
+	0xBF,0xD6,0xBA,0x43,0xB9,0xD3,0x82,0x79,0x57,0xC0,0x5E,
+	0xAB,0x5B,0xC7,0x5A,0x66,0x1C,0x18,0x3A,0x29,0xBF,0x8D,
+	0xFD,0x2D,0x7B,0x57,0xFB,0x61,0x01,0x8E,0xD6,0x7A,0xA4,
+	0x40,0x57,0xB5,0xBE,0xD2,0xC2,0xCB,0x2F,0xB2,0x94,0x98,
+	0xC8,0x24,0xA3,0xC7,0xAB,0xFE,0x3D,0x07,0x56,0x08,0xA5,
+	0x89,0x61,0x2F,0xD9,0xC4,0xC7,0x3C,0x35,0xAE,0xCB,0x1D,
+	0x1F,0x54,0x6E,0x9F,0xBD,0x20,0x3F,0xCD,0xD0,0x44,0x2F,
+	0xD5,0xAA,0x44,0x3F,0x32,0x93,0xCB,0xF8,0xED,0x2B,0xAF,
+	0x75,0x5D,0xB9,0x0C,0x48,0x50,0x35,0xB3,0x95,0xAF,0x38,
+	0x47,0xBE,0x2F,0x94,0x2B,0x43,0x8F,0x14,0xC4,0x70,0x6B,
+	0x0F,0x1A,0xE7,0x4F,0xEE,0x49,0x4C,0x4B,0x15,0x0D,0x8B,
+	0xF6,0xAF,0xE9,0xE1,0xE9,0xC2,0x2C,0x71,0x9B,0x1D,0x3A,
+	0x19,0xE9,0x64,0x8C,0x5E,0x80,0x17,0xA9,0x6A,0xDC,0x51,
+	0x9D,0xB9,0x5F,0xAD,0xDA,0x2C,0x5D,0x9B,0x34,0xDF,0x47,
+	0xF8,0x39,0x18,0xF0,0x72,0xF6,0x8B,0x18,0x44,0x1F,0xC6,
+	0xC0,0xC6,0x3E,0xDC,0x53,0x4D,0x2E,0x93,0xCD,0x5A,0x6E,
+	0x95,0xEB,0xBC,0x02,0x9A,0x91,0x40,0xAA,0x6D,0x5E,0x38,
+	0x01,0x82,0x76,0x36,0xFD,0x27,0xC7,0xE0,0x9B,0x31,0xE0,
+	0x51,0xDB,0xF4,0x13,0x4A,0xA9,0x90,0xD3,0xCE,0xD9,0xEA,
+	0x94,0x76,0xD3,0xFA,0xCB,0x5C,0x54,0x70,0x5B,0xA6,0xC0,
+	0xA9,0x18,0xAB,0xAE,0x54,0x09,0x35,0x67,0xE6,0x95,0x7D,
+	0x2A,0x7E,0xFB,0x34,0x45,0x60,0xC5,0x80,0xBA,0x8F,0xD5,
+	0x46,0x9D,0x91,0xBE,0xE3,0xBD,0x8B,0x0E,0xB0,0xD4,0x4E,
+	0xE2,0xA9,0x2C,0x79,0x6B,0x1D,0x6F,0x13,0x22,0xAD,0x56,
+	0x72,0xB4,0x04,0x5D,0x2C,0x65,0x68,0x00,0xF3,0xB3,0x5B,
+	0x04,0x1A,0xBA,0xC1,0xD7,0xF7,0x4C,0x78,0x8A,0x66,0x51,
+	0xE6,0x71,0x7F,0xA5,0xE2,0x88,0xB6,0x9D,0x94,0x23,0x10,
+	0xD9,0xFA,0x96,0xBB,0x7B,0x06,0x98,0x63,0x02,0xAA,0x92,
+	0x7A,0x8F,0xD3,0x6F,0xB2,0x21,0x95,0x09,0x7D,0x4F,0x4D,
+	0x27,0xCE,0xA7,0x40,0xEB,0x5F,0x21,0x7B,0x72,0xFB,0x84,
+	0x31,0xB3,0x0B,0xA2,0x40,0x83,0x91,0x0B,0x2D,0xAB,0x6A,
+	0xB0,0xEF,0x39,0x36,0x58,0x73,0xDC,0xFA,0xCE,0xB2,0x84,
+	0x39,0x80,0x88,0x63,0xA8,0xA2,0x23,0xFC,0x64,0xB7,0x8A,
+	0xA5,0xEF,0x08,0xC8,0x46,0x3F,0xEB,0x8F,0x9F,0x61,0x6A,
+	0x92,0xA5,0x14,0x13,0xAE,0xC9,0x8B,0x09,0xEF,0x95,0x17,
+	0xFD,0x7E,0xD1,0x51,0x3C,0xA9,0xC2,0x45,0x9A,0xBA,0x70,
+	0x59,0x6E,0x22,0x97,0xD0,0xC9,0x42,0xE8,0x23,0x1D,0x08,
+	0x0A,0x0E,0xAD,0x9E,0xC4,0x43,0xCF,0xD3,0x69,0xFC,0xF1,
+	0x0F,0x73,0xA1,0xC2,0x22,0xC8,0x0E,0x1F,0x2B,0x9A,0xA0,
+	0x72,0x43,0x0A,0xD8,0xEA,0x7E,0x55,0x94,0xE9,0xC0,0x9E,
+	0x6F,0xBD,0xA6,0xC6,0x9E,0x09,0xDA,0x79,0x99,0xA4,0x20,
+	0x92,0x92,0x20,0x4E,0xBF,0x31,0xAA,0x53,0x2F,0x35,0x72,
+	0xEE,0x2C,0x72,0x2E,0x17,0xF2,0xD2,0x0A,0x26,0x9E,0xC3,
+	0xAA,0xF5,0xBA,0x79,0x5D,0xD5,0x7A,0xAA,0x8B,0x33,0x3F,
+	0xD8,0xF1,0xA2,0x85,0xDB,0xDC,0xD4,0xD8,0xF0,0xFC,0x49,
+	0xDA,0x31,0xEE,0x11,0x2D,0x49,0x1C,0x2F,0x16,0xC3,0xC3,
+	0x45,0xA3,0x90,0x08,0x38,0x0C,0x0A,0x99,0x06,0x83,0xA6,
+	0x1D,0xB8,0xE4,0x5D,0x27,0x28,0x19,0x45,0xE6,0xDD,0x23,
+	0xE3,0xC9,0x22,0x64,0xA1,0x24,0x59,0x32,0x57,0x89,0xAC,
+	0x4E,0xD6,0x26,0xEB,0x93,0xB9,0x26,0x64,0x0B,0x32,0x89,
+	0xEC,0x4C,0xE6,0xBA,0x93,0xBD,0xC8,0xFE,0xE4,0x60,0x32,
+	0x37,0x82,0x1C,0x4B,0x8E,0x27,0x5F,0x20,0x73,0x53,0xC9,
+	0x59,0xE4,0x3C,0x72,0x31,0x99,0x5B,0x4A,0xBE,0x43,0xAE,
+	0x22,0x3F,0x26,0x73,0xEB,0xC9,0x2D,0xE4,0x59,0xF2,0x0F,
+	0x32,0x1A,0xBB,0x7A,0x48,0xDE,0x24,0xEF,0x90,0x0F,0x88,
+	0x76,0xCE,0x5C,0x98,0x33,0xDA,0x19,0xE7,0x2C,0xE8,0x7C,
+	0x28,0xEA,0x2C,0xE9,0x2C,0xE7,0xEC,0xF0,0x47,0x83,0xEB,
+	0x7C,0xD4,0xD9,0xC0,0xD9,0xDF,0x39,0x38,0xCB,0x39,0x3A,
+	0x21,0x45,0x3C,0x97,0xA1,0x12,0x03,0xCC,0xDD,0x0C,0x17,
+	0x73,0xAF,0x5C,0xF0,0x9A,0xCB,0x9E,0xD2,0x9A,0x46,0x9C,
+	0x44,0x8F,0xBB,0xBF,0x59,0xC9,0x8E,0xEB,0xFD,0xA0,0x76,
+	0x62,0x68,0x78,0xF0,0xD6,0x6E,0xB7,0x90,0xBE,0x6A,0x0E,
+	0x70,0xCD,0x95,0xBE,0xCB,0x7F,0x9F,0x4E,0x17,0xE8,0x50,
+	0xE7,0xEE,0x4A,0x60,0x46,0x8B,0xDA,0x3B,0x24,0x30,0x15,
+	0xE7,0x4F,0x75,0xE9,0x61,0xE5,0x22,0x4A,0x0C,0x41,0x0F,
+	0x8F,0x5C,0xBF,0x5C,0x0E,0xB1,0x8A,0x88,0x37,0x44,0x3C,
+	0x74,0xBF,0x1E,0x5C,0x8E,0x0B,0x8A,0x70,0x37,0x94,0x7A,
+	0x78,0xF1,0x3A,0xA9,0xDC,0xBC,0x20,0x42,0xDF,0x30,0xFD,
+	0x61,0xF5,0x7D,0x25,0x7A,0x07,0x05,0x29,0xF1,0xED,0xF7,
+	0x79,0x3B,0x53,0x87,0xCE,0xC8,0x37,0x05,0xEF,0xBA,0xE6,
+	0xDA,0x65,0x01,0x5D,0x41,0x1C,0xC7,0xCD,0xFA,0x91,0x6F,
+	0xB4,0x4F,0x98,0x53,0xFB,0xD9,0xD9,0x8E,0xDC,0x85,0x49,
+	0x5F,0xA5,0xBF,0x79,0x3B,0xDF,0x7E,0x6A,0xDA,0xD1,0x97,
+	0xD5,0xFB,0xD9,0x1B,0x41,0xDD,0x1A,0x95,0x87,0xB3,0xDE,
+	0x90,0x5F,0x83,0x74,0x9D,0xEF,0x83,0x74,0xFB,0xD9,0x41,
+	0xFA,0xE9,0x89,0x41,0xFA,0xD9,0xB1,0x41,0x7A,0xD2,0xC7,
+	0x41,0xFA,0x8D,0x77,0x83,0xF4,0xA7,0xAF,0x07,0xE9,0x3D,
+	0x5D,0x83,0xF4,0x6F,0x1D,0x1C,0x3A,0x40,0x93,0xFD,0x82,
+	0x2E,0xE6,0xDF,0x40,0xDF,0xD0,0xE2,0xB2,0x9F,0xD2,0xAD,
+	0x35,0xD9,0x0F,0xE9,0x65,0xFE,0x95,0xF4,0xB2,0xB4,0x3B,
+	0xF4,0xB2,0x6B,0x65,0xF4,0xB2,0x07,0xD7,0xE8,0x65,0x2F,
+	0x0B,0xE9,0x65,0x6F,0x73,0xE9,0xA5,0xDF,0x33,0x6B,0x80,
+	0xDF,0x35,0x59,0x29,0xFE,0x4E,0xA2,0x5A,0xAC,0xC4,0x68,
+	0xE8,0x91,0xA6,0xF3,0x83,0xA4,0x28,0xB5,0x93,0x4D,0x21,
+	0x83,0x67,0xFD,0xD5,0x92,0x9B,0x4E,0x0F,0xDE,0x74,0x53,
+	0x7B,0xD6,0xE4,0x38,0xD8,0x63,0xAB,0x36,0xDD,0x62,0x61,
+	0x79,0x6D,0x15,0x76,0xA4,0xB7,0x5C,0x1B,0xD2,0xFF,0x57,
+	0x69,0xE3,0xC3,0xAB,0xCF,0xF8,0xC4,0x08,0xB4,0xF9,0xC8,
+	0xC1,0x92,0x06,0xF7,0xC1,0xA0,0xA3,0x66,0xFA,0x11,0x96,
+	0xAF,0xFD,0x84,0x7E,0x3C,0xDB,0x73,0x9A,0x7E,0x0A,0xE2,
+	0x36,0x48,0x0F,0x73,0x1A,0xA4,0x27,0x1E,0x1F,0xA4,0x17,
+	0x58,0x0F,0xD2,0x9F,0x1C,0x1B,0xA4,0xB7,0x18,0x0D,0xD2,
+	0x07,0x74,0x07,0xE9,0x13,0x5A,0x83,0xF4,0x55,0xD5,0x41,
+	0xFA,0x3F,0x05,0x0E,0x1D,0xA2,0xCD,0x96,0xA6,0xE3,0xFD,
+	0xC4,0xE8,0x0A,0xFE,0x42,0x74,0x5D,0x6D,0x88,0xC6,0xE1,
+	0x71,0x6D,0x9F,0xD3,0xDA,0xED,0xE7,0xB5,0xBD,0x36,0x84,
+	0x62,0x1A,0xB6,0x8F,0x4D,0xD1,0x6F,0xB7,0x6A,0xA3,0x1F,
+	0xA4,0xA6,0xBF,0x4F,0xBF,0x6A,0xCA,0x2D,0x81,0xB1,0x3A,
+	0xFE,0xD1,0xB3,0xB4,0x1D,0xB5,0x4B,0xA2,0x21,0x5F,0x81,
+	0x7A,0xB2,0x28,0xA2,0xEE,0x79,0x71,0x9D,0x13,0x15,0xAE,
+	0x66,0x2E,0xF6,0xB2,0xB2,0x59,0x81,0x69,0xB3,0x4D,0x66,
+	0x21,0xA6,0x95,0x80,0xDA,0x0E,0x38,0x7F,0x85,0x19,0xA1,
+	0xD7,0x5C,0x5E,0x60,0x6B,0x84,0x58,0x6D,0x09,0x5A,0xDF,
+	0xB7,0x76,0xAD,0x24,0x09,0x3F,0xB0,0x7B,0x65,0x2A,0x66,
+	0x7E,0x59,0xF4,0x93,0x15,0xA6,0x92,0xA1,0x2D,0xA5,0xE3,
+	0x0A,0x18,0xF2,0xAF,0x0D,0xE5,0x61,0xA9,0xDB,0xD7,0x9C,
+	0xD8,0xE5,0x15,0x63,0x3A,0xEC,0x3E,0x21,0xC1,0xE6,0xF7,
+	0x5F,0x2E,0x9D,0x4F,0x49,0xE0,0xDB,0x86,0x3D,0x56,0x54,
+	0x88,0xEC,0x5C,0x19,0x5B,0xFB,0x47,0x58,0x3F,0xAD,0xB0,
+	0x01,0xAF,0x08,0x3C,0xAA,0xC8,0x57,0x3A,0xF0,0xDA,0x79,
+	0xE8,0x0E,0x98,0xB1,0x51,0xD5,0xFB,0x17,0xD2,0xA5,0x5F,
+	0x69,0xE0,0x8A,0x86,0x55,0xE9,0x19,0x3D,0xF0,0xEB,0xBB,
+	0x54,0xAE,0x67,0x60,0x15,0xCA,0xF3,0xEE,0xD2,0xBF,0x1B,
+	0x44,0xE6,0xF0,0x0E,0x60,0x51,0x4F,0xF6,0x3A,0x0A,0x6D,
+	0x71,0xA5,0x09,0x90,0x12,0x27,0x76,0xF4,0xAD,0x75,0xF3,
+	0x64,0x87,0xEA,0x01,0xF1,0x78,0x23,0xEC,0x52,0x13,0x3A,
+	0x3E,0x44,0xEA,0x9A,0x0F,0x43,0xD0,0xF8,0xBE,0xFE,0xE3,
+	0x80,0x4D,0x5B,0x03,0x2A,0xE5,0xD3,0x56,0xE8,0x2F,0x61,
+	0xC7,0x3B,0xB7,0x7F,0xF1,0xE8,0xFD,0xF2,0x7F,0x26,0xCA,
+	0x7C,0xCB,0xDC,0x86,0x8D,0x2B,0x9E,0x85,0xC4,0x9F,0x71,
+	0xF2,0x87,0x84,0xC6,0xBA,0x5F,0x2C,0x06,0x2D,0x99,0x15,
+	0x9B,0x4F,0xF2,0x34,0x5D,0x0C,0xD1,0x2E,0x8E,0x55,0x30,
+	0x33,0x7F,0x58,0x42,0xF4,0xFB,0xF9,0xC7,0xC4,0x72,0xDC,
+	0xDA,0x6D,0x52,0xDC,0xD9,0xB8,0xED,0xA8,0xA1,0x9E,0xE2,
+	0xD1,0x8E,0xF0,0x57,0x7F,0x44,0x73,0xEC,0x8C,0x20,0xA4,
+	0x0B,0x4A,0x43,0xB7,0xDA,0xB5,0x97,0xFF,0x82,0x42,0x67,
+	0xEE,0xE7,0x71,0xF5,0x72,0x9D,0x74,0x3E,0x01,0x19,0x72,
+	0x28,0x1D,0xBE,0xB0,0x0B,0xDF,0x59,0x3D,0xBB,0x29,0x86,
+	0x1B,0x42,0xCD,0x02,0x9A,0xE1,0xC1,0x7F,0xCA,0xE1,0xA0,
+	0x14,0x17,0xB0,0x4F,0x26,0x8B,0xF8,0x25,0x6B,0x12,0xC1,
+	0x16,0x65,0x18,0xD3,0xCF,0xC9,0x3F,0x32,0xE3,0x07,0x81,
+	0x4F,0xD0,0x44,0x3E,0x6D,0x12,0x13,0x66,0x1F,0x5B,0x49,
+	0xC9,0x62,0x9C,0x53,0xF6,0x30,0xC0,0x7A,0x35,0xFE,0x3B,
+	0x18,0x30,0x5D,0xFA,0x63,0x43,0x8E,0x10,0xE6,0x33,0xBD,
+	0xA5,0x9F,0x80,0x02,0xB1,0xC1,0x63,0xB4,0xE6,0xB5,0xCD,
+	0x58,0x3A,0x1B,0x79,0x7B,0x11,0x44,0x1F,0x94,0xD1,0x9D,
+	0x32,0x50,0x16,0xF7,0x7E,0x1F,0x52,0xAE,0xFB,0x94,0xCD,
+	0x3F,0x20,0x46,0x5C,0x45,0x3E,0x78,0x15,0xA7,0xA8,0xF7,
+	0xB6,0x79,0x28,0xF6,0x89,0xEC,0x03,0x9D,0xFB,0x05,0x5B,
+	0xA3,0x37,0x0D,0xCD,0xF4,0x83,0xF3,0x43,0xAF,0x94,0x64,
+	0x94,0x7F,0x4D,0xB4,0x25,0x18,0xA8,0xC5,0x14,0x84,0x8C,
+	0x06,0x1D,0x7D,0x61,0x77,0xFA,0x27,0xCC,0xB0,0x84,0x5C,
+	0x6E,0x67,0x43,0xCA,0x89,0x32,0xBE,0x67,0x9C,0xF0,0xA5,
+	0xE4,0xAD,0x63,0x5D,0xD6,0x05,0xDE,0xF9,0x27,0x9C,0x8E,
+	0x37,0x86,0xD1,0x3C,0x12,0xDF,0xBD,0x37,0x8D,0x90,0xC1,
+	0xF8,0x50,0x9B,0x12,0x54,0x79,0x01,0x80,0xF4,0x25,0x7A,
+	0x7B,0xE3,0x9F,0xB0,0x71,0xF0,0x4A,0xA8,0x5F,0xC9,0xF7,
+	0xDB,0xF9,0x13,0x1B,0xA9,0xD1,0x1F,0x8D,0xBD,0x3F,0x2A,
+	0x1A,0x9A,0x44,0xBF,0x46,0x86,0x86,0x96,0x74,0x94,0x57,
+	0x37,0x90,0xD8,0x11,0x0F,0xC5,0xF8,0x4D,0x9B,0xEE,0x1C,
+	0xB5,0xB6,0xBB,0x36,0x94,0x9B,0x2B,0xFB,0x4E,0x27,0xB5,
+	0x48,0xC0,0xEC,0x34,0x45,0xC4,0xEB,0x41,0xA4,0xFF,0xFB,
+	0x80,0x7B,0x1B,0x10,0xEF,0x6A,0xC2,0x03,0xB7,0xD8,0x35,
+	0x64,0xC9,0xF1,0x41,0xDD,0x63,0xC7,0x64,0x53,0x74,0x74,
+	0x0B,0xFA,0x47,0x55,0x0D,0x79,0xCD,0x83,0xA5,0x43,0x5D,
+	0x4B,0x84,0xCA,0x6F,0x63,0x48,0x33,0x11,0x60,0x31,0x69,
+	0x8B,0xF6,0x7F,0xEB,0x4B,0x51,0x25,0xBF,0xCB,0x5B,0x7F,
+	0x92,0x38,0x11,0xD3,0x62,0xD6,0x96,0x4D,0x23,0x47,0x8B,
+	0xEC,0x06,0x86,0xA6,0x5F,0xC9,0x8A,0x97,0x5A,0x35,0x93,
+	0x82,0x23,0x9E,0x88,0x3C,0x6A,0xBC,0xBF,0x5E,0x16,0x23,
+	0x9C,0x2F,0x18,0x7C,0x12,0xF1,0x52,0x07,0x3E,0x87,0xFA,
+	0x6D,0xC5,0x26,0x1C,0x1B,0x12,0x17,0x3E,0x8A,0xBB,0xE8,
+	0x46,0xDF,0x8E,0x85,0xC2,0xFA,0xB1,0xD6,0x39,0x4B,0x61,
+	0xEB,0xB6,0xC8,0x41,0xC4,0xC2,0x2C,0xDE,0x53,0x5D,0x81,
+	0x22,0xE8,0xB2,0xD7,0x81,0x4D,0xE5,0x67,0x99,0x01,0xEE,
+	0xE3,0x5E,0xE3,0x49,0x72,0xEB,0x0C,0x80,0x0A,0xFA,0xC8,
+	0x54,0x7E,0x21,0x24,0x5A,0x10,0x25,0x19,0xC4,0x54,0x13,
+	0xB4,0x8A,0x36,0x93,0xAA,0x26,0x81,0xD2,0xDA,0x99,0x04,
+	0xC1,0x00,0xD4,0xEB,0xB6,0x67,0x1F,0xBD,0x12,0xB3,0xF1,
+	0xD7,0xAA,0x98,0x57,0xA0,0xF9,0xF3,0xE6,0x15,0x91,0xA5,
+	0x6F,0x94,0x90,0xEF,0x6B,0x65,0x5F,0x9D,0x78,0x27,0xE8,
+	0xD2,0x70,0x99,0x88,0xD1,0x47,0xB3,0x5D,0x3B,0xEC,0x11,
+	0x8D,0x9F,0x7E,0x6B,0x9F,0x61,0x00,0x62,0x88,0x1E,0x65,
+	0x58,0x2B,0x3C,0xA9,0x0F,0xC0,0x97,0x7F,0x32,0xF6,0x81,
+	0x02,0x39,0xC7,0xF0,0xDC,0x30,0x8D,0x61,0xA4,0x66,0x78,
+	0x54,0x43,0xFF,0x94,0x75,0x94,0x67,0x0F,0x95,0xC2,0xEB,
+	0xC0,0x06,0xA6,0x66,0xC5,0x87,0x5B,0xFB,0x53,0xF0,0x17,
+	0x5B,0xAD,0xA7,0xD2,0xA3,0xA9,0xBF,0x3F,0xAA,0xC6,0x12,
+	0xEC,0x11,0x30,0xF6,0x59,0x43,0x7A,0x24,0x02,0x80,0xAA,
+	0x79,0x6C,0xF3,0x5E,0xDC,0x97,0xC7,0xD3,0x51,0x79,0x39,
+	0x29,0x2C,0xC8,0x0E,0x12,0x19,0xF2,0x79,0xC5,0x43,0x02,
+	0xED,0x62,0x04,0xC9,0x94,0x58,0xAE,0x7E,0xF0,0x65,0x1C,
+	0x9D,0x62,0x2E,0x98,0xFE,0x55,0xDD,0xDC,0xD4,0x1F,0xAE,
+	0x97,0x38,0xC5,0xC6,0xD6,0xAC,0x98,0x26,0xC2,0x61,0x54,
+	0x9D,0x6A,0xD7,0x15,0x7D,0x8F,0x04,0xA0,0x61,0xF9,0x91,
+	0xEC,0xD1,0x7A,0x5E,0x3D,0x46,0x45,0x01,0x6B,0xCD,0xFF,
+	0x92,0xB8,0xEC,0x78,0x3A,0x67,0xBF,0x4B,0xCB,0xD5,0x74,
+	0x15,0x5F,0x67,0x99,0x94,0x71,0x78,0x39,0xC9,0x85,0xCE,
+	0x50,0x6A,0xE9,0x5E,0x03,0xFF,0xF5,0xC6,0xF3,0x7C,0xD3,
+	0x69,0xDE,0xEF,0x10,0xD1,0x95,0xAC,0xE0,0x54,0xDE,0x15,
+	0x4C,0x1B,0x17,0x30,0xEC,0x8B,0xDA,0x7A,0xC3,0xE3,0xDC,
+	0x7E,0xDD,0x01,0x91,0x74,0x86,0x1E,0x35,0x33,0xF1,0xD9,
+	0xEB,0x49,0x46,0x64,0x48,0x68,0xC9,0x2B,0xA7,0xCB,0xF8,
+	0x8F,0xF7,0x75,0x23,0x8E,0x4C,0x5C,0x11,0x0F,0x11,0xBC,
+	0xCB,0x14,0xBE,0x53,0x04,0xEB,0x14,0xB6,0x61,0x43,0x66,
+	0xAE,0x98,0xD9,0x34,0xAB,0x5E,0xA1,0x7A,0x28,0x9F,0x41,
+	0x5B,0x07,0xC2,0x6E,0xB8,0xDF,0xF9,0x4F,0x8A,0x7E,0x8D,
+	0xBF,0x20,0x5B,0x0C,0xE4,0x4C,0xCA,0xD9,0x18,0x3F,0xC2,
+	0x15,0x4D,0x02,0x4E,0xE0,0x84,0x76,0x73,0x3A,0x76,0x41,
+	0x3B,0x73,0xD9,0xDB,0x4F,0xAA,0x63,0x29,0x27,0xDE,0xCC,
+	0xAD,0x06,0x55,0xB1,0xD6,0xDD,0x81,0xEC,0xE8,0xF0,0x20,
+	0x25,0x6A,0xAA,0x7E,0x4E,0x52,0xF8,0x13,0x75,0x10,0x27,
+	0xDF,0x69,0x97,0xB6,0xC9,0xFC,0x50,0xB3,0x9E,0xA7,0xE2,
+	0x72,0xC5,0x9B,0x95,0x50,0x81,0x34,0x4E,0x97,0x90,0x5A,
+	0x20,0xB3,0xE1,0x95,0x7A,0xA6,0x6E,0xCE,0xD9,0xAA,0xAF,
+	0xA5,0x3C,0xFE,0x71,0x32,0xF6,0xE1,0xA0,0x04,0x7D,0x4C,
+	0xF1,0x59,0xE1,0xF4,0x04,0xAD,0xAE,0x0C,0x18,0xC0,0xD6,
+	0x3C,0xF3,0x77,0x0E,0x25,0x3E,0x72,0xB9,0xE4,0x41,0xC3,
+	0xE3,0x53,0x31,0xD9,0x97,0x6E,0x4A,0x7C,0x3D,0x95,0x39,
+	0x91,0xCA,0x9F,0xC9,0x05,0xA7,0x60,0x7A,0xB4,0x2D,0x4F,
+	0x4C,0xE7,0xFE,0x1B,0xA4,0x0A,0x92,0x2A,0xE7,0xEC,0xE4,
+	0xD3,0x00,0x4F,0xC8,0x94,0x14,0x2C,0xBF,0x59,0xB7,0x82,
+	0x78,0xF5,0xEE,0x37,0x34,0x69,0x6F,0xC1,0x1B,0xC3,0x41,
+	0x93,0x94,0xC3,0x34,0x8E,0x5F,0x10,0x35,0xBE,0x91,0x67,
+	0xA3,0x5B,0xDC,0x18,0xED,0xE6,0xAF,0xBF,0x47,0xF2,0x64,
+	0x24,0x6E,0xAE,0xB8,0x8C,0xFF,0x09,0xFC,0x4F,0xDA,0xB4,
+	0x51,0x05,0xA0,0xC3,0x6F,0x54,0x7F,0x0A,0xE2,0xA3,0x8F,
+	0x12,0x0E,0x54,0x78,0x2E,0xF4,0xA6,0xC7,0x46,0x57,0x43,
+	0x54,0x79,0xF2,0x98,0x87,0x9E,0xBB,0x65,0x9D,0x22,0xC5,
+	0xA9,0xFA,0x33,0xEE,0x1C,0x0F,0xB4,0x76,0xF5,0xD6,0x1F,
+	0xF6,0xD4,0xED,0xAE,0xAB,0x2B,0xB0,0x7A,0xAD,0x0A,0xC6,
+	0xDB,0x74,0x05,0x8F,0x88,0xB4,0xE3,0x36,0x8A,0xD9,0x58,
+	0x12,0xEE,0xD7,0x3F,0x9C,0x08,0x6E,0xAD,0xC3,0x2E,0xA9,
+	0xA6,0xA3,0xA2,0x3F,0x77,0xC4,0x28,0x88,0xCD,0x9B,0x4B,
+	0x80,0xDA,0xE1,0xBF,0x84,0xF9,0x7E,0xC8,0x2B,0x09,0x8A,
+	0x86,0x03,0x2C,0x5D,0x25,0x42,0x04,0x40,0x47,0x2A,0x6B,
+	0xFA,0x7E,0x8A,0x98,0x0E,0x98,0x66,0xC9,0x10,0x54,0x08,
+	0xF7,0xBE,0xF1,0xB9,0x00,0x97,0x25,0x0F,0xDB,0xD7,0x0E,
+	0x13,0x22,0xB8,0x13,0x25,0x87,0xEC,0x7B,0x97,0xE6,0xE7,
+	0xB1,0xCE,0x74,0xBD,0xFF,0x9D,0x95,0xDD,0x0E,0xD1,0x81,
+	0xD7,0xD3,0xFB,0xDF,0x2B,0xF2,0x83,0x84,0x2C,0x3D,0xAA,
+	0xA2,0xCE,0x5C,0x31,0xE5,0xC0,0x9E,0xE1,0xF2,0x6F,0x61,
+	0x0D,0x6D,0xD5,0xAF,0xE7,0xCC,0x95,0xF0,0x87,0x5D,0x16,
+	0x8A,0xCA,0xF7,0x79,0x18,0x5E,0x52,0x52,0x42,0x9C,0x48,
+	0xDD,0xCF,0x0B,0xEA,0xFA,0xDF,0xE8,0x15,0x8B,0xA4,0xB0,
+	0x0F,0xD2,0x3D,0x0E,0x4F,0x19,0x6F,0xAC,0xF0,0x7A,0x5E,
+	0xAD,0x96,0xA1,0xF9,0x1D,0xAE,0xD0,0x9C,0xD6,0x68,0x1E,
+	0x1E,0x95,0xD3,0x10,0xE8,0xA6,0x1A,0xAC,0x73,0xAB,0x60,
+	0xB2,0x70,0x86,0x90,0x11,0x1A,0x2D,0x94,0xAE,0x91,0x88,
+	0x90,0x7F,0x11,0x5B,0x19,0xA0,0x9E,0x81,0x5E,0xFC,0x1E,
+	0x85,0xC3,0x9F,0xE7,0x20,0xBD,0xAE,0xCF,0x81,0xB4,0xB6,
+	0xD3,0x3F,0x63,0xBD,0x26,0x54,0x7C,0x3D,0xA1,0xF1,0x4D,
+	0x36,0x0B,0xD3,0x07,0xA8,0xEF,0xA2,0x6F,0x6B,0xA3,0x5E,
+	0x2E,0x9A,0xA5,0x6E,0x17,0x7A,0xCC,0x15,0xCE,0x8A,0x32,
+	0x75,0x60,0xE7,0x7B,0x96,0xB5,0x2F,0xD5,0x8F,0xA0,0xF3,
+	0x7B,0x41,0xDA,0xAD,0x69,0x1A,0xA7,0xA3,0x5D,0x02,0x14,
+	0x58,0xF9,0xD4,0x87,0x41,0x7B,0x06,0xE6,0x5D,0x8A,0x9F,
+	0x90,0xF3,0x09,0x8E,0xDC,0xDC,0xD7,0xE9,0x8B,0x69,0xE9,
+	0x07,0xA0,0xBE,0x78,0xAB,0x7F,0x0E,0x28,0xC4,0x54,0xEE,
+	0xC2,0x2F,0xD0,0xCF,0xD5,0xC7,0xE8,0x56,0x89,0x05,0x84,
+	0xD3,0x72,0xDE,0x08,0xD2,0xDE,0x16,0x99,0xBA,0xF6,0x6A,
+	0x6A,0xEC,0xD6,0x72,0x89,0xB1,0x80,0x09,0x64,0x37,0x0E,
+	0x4B,0x55,0x36,0x99,0xF7,0x21,0x9A,0xF0,0x50,0xBA,0xC5,
+	0xD8,0x6E,0xFF,0x61,0xBE,0xB7,0x21,0x95,0x13,0x44,0x35,
+	0x58,0x17,0x08,0x04,0x80,0x10,0x4F,0x1C,0xC0,0x5C,0x7F,
+	0x29,0x86,0x0E,0x3F,0x0B,0x09,0xA7,0xA3,0xD5,0x82,0x50,
+	0x0F,0x5B,0x8F,0xF8,0x4D,0x76,0xAD,0x45,0xAF,0x73,0x43,
+	0x11,0xD1,0x50,0x94,0xEB,0x42,0xDB,0xC0,0x42,0xA1,0xCD,
+	0x48,0xFD,0x77,0xFB,0xA9,0xFC,0x7B,0xEE,0x6A,0xE7,0x38,
+	0xE1,0x5B,0xD5,0xBD,0x96,0x38,0x16,0xAE,0x30,0xCA,0xFB,
+	0xFB,0x82,0xEA,0xDF,0x33,0xEB,0x5E,0xD7,0x71,0xF3,0x15,
+	0x1E,0xF4,0xD7,0x24,0x0D,0xFE,0xE5,0x8B,0x62,0xE2,0xDC,
+	0x7F,0x4D,0x3B,0x2B,0xE7,0x17,0xF2,0x33,0xFF,0x7D,0x95,
+	0x5C,0x8C,0xC3,0x1A,0x08,0xD7,0x5C,0xEF,0xC9,0x4F,0xED,
+	0x12,0xD8,0x36,0x01,0x26,0x42,0x1E,0x3D,0xE6,0x4B,0xCC,
+	0x1B,0x43,0x0E,0xF6,0x25,0xEC,0xF0,0xF6,0x6E,0x5E,0x62,
+	0xF2,0x28,0x10,0x83,0x98,0xC0,0x1A,0x30,0x4F,0x2A,0x0C,
+	0x94,0x9F,0x69,0x56,0xBB,0x6C,0xF2,0xDB,0xCD,0x4F,0xEF,
+	0xB6,0x96,0x68,0xD4,0x6F,0x19,0x8F,0x47,0xB3,0x79,0x33,
+	0xD7,0x0A,0x9D,0x5A,0x98,0xB0,0xCC,0xF4,0x9C,0xC8,0x1E,
+	0x22,0xEE,0xD4,0x37,0x2B,0x8A,0xD2,0x71,0x56,0x65,0xCE,
+	0x05,0x92,0x29,0x0C,0x8A,0x7A,0xE1,0xE4,0x10,0x9B,0xC3,
+	0x8A,0x5E,0x1B,0x04,0x27,0xDF,0xD5,0x3F,0xCE,0x3A,0xD3,
+	0xCA,0xBD,0xC9,0xEF,0x37,0x83,0xF1,0x54,0xF5,0x16,0x75,
+	0x06,0x4B,0x06,0x4C,0x9E,0xFD,0x31,0xC5,0xA8,0x54,0xA3,
+	0x91,0xF5,0x7B,0x7A,0x2F,0xD5,0xD5,0x67,0x46,0x5C,0x08,
+	0x53,0xAA,0xE2,0x96,0x26,0x57,0x4E,0x83,0x8C,0x53,0x2F,
+	0xA5,0xC8,0xD2,0x30,0xD2,0x5C,0xE0,0x4E,0xBE,0x69,0xBA,
+	0xA9,0x26,0x85,0x09,0x4B,0x4F,0xA9,0xB9,0x38,0x83,0xCB,
+	0x97,0x1F,0xC2,0xBF,0xE5,0xBD,0xF5,0x9E,0x3A,0x31,0x08,
+	0x50,0xC7,0xD4,0x92,0x7C,0xBB,0xAF,0x08,0x44,0x05,0x89,
+	0x9F,0xB1,0x2A,0x0D,0x40,0x55,0x5E,0xBB,0x8B,0x66,0x4D,
+	0x36,0x00,0xB4,0x4C,0xA1,0xE6,0xD5,0xCF,0xCF,0xE2,0xA3,
+	0xE4,0xE0,0x49,0x85,0xB6,0x40,0xCC,0x8B,0x3C,0x49,0xF8,
+	0x33,0x4E,0x2F,0xED,0x2D,0xF3,0xB6,0xD0,0x48,0x34,0xC6,
+	0x36,0xBD,0x75,0x3F,0x58,0x5C,0xDE,0xA8,0x5C,0x85,0xC0,
+	0x11,0x73,0xE6,0xEA,0xD4,0x5C,0xAE,0x26,0xB9,0xC7,0xFF,
+	0xC7,0x6C,0x7B,0xC4,0xF6,0x4F,0x91,0xE6,0x7F,0x5B,0xA9,
+	0xDF,0xDD,0x9F,0x6F,0x4F,0x5E,0x1D,0xA0,0xA7,0x32,0x08,
+	0x76,0xB6,0x0F,0xBC,0x85,0xCC,0xA2,0x62,0xDC,0xBD,0x10,
+	0xA0,0x59,0x3C,0xCD,0xAC,0x5E,0x68,0x31,0x1C,0x23,0xE8,
+	0x99,0x39,0xC4,0x1B,0xA4,0x05,0x89,0xD7,0xFC,0xBE,0xCD,
+	0x16,0x08,0x8E,0xE3,0x91,0xDC,0x21,0xB1,0x1B,0x6F,0x15,
+	0x0A,0x7E,0x7F,0xF6,0x74,0x73,0xE3,0x09,0x8F,0x4D,0xAE,
+	0x5F,0xF9,0x6E,0x35,0xF4,0xC6,0xED,0x82,0x82,0x69,0xA0,
+	0xC3,0x29,0x88,0x82,0xD2,0xC4,0xA9,0x4D,0xA1,0x5C,0xEE,
+	0xE1,0x34,0x55,0x5E,0xAA,0x4D,0x5A,0xD8,0xF3,0x92,0xAD,
+	0x2A,0x37,0xE4,0x57,0x90,0x0A,0xEA,0x7B,0xC7,0x31,0xDB,
+	0x69,0xF0,0x20,0xEF,0xB4,0x4E,0xE1,0x50,0xB5,0x8C,0x9C,
+	0x5C,0xAC,0xD2,0xC8,0x17,0xAA,0x7D,0xCB,0x88,0x58,0x54,
+	0x8E,0xC4,0x0E,0x3D,0xC9,0xD2,0xE9,0x3F,0xEC,0xC2,0x56,
+	0x51,0x50,0x55,0xB1,0xC7,0xF2,0x66,0xF5,0xDD,0xA0,0x74,
+	0xA8,0x3E,0xD4,0x73,0x74,0xAD,0xBA,0x06,0x51,0xF5,0xE8,
+	0xC5,0x75,0x9B,0xEB,0x97,0x9E,0xBB,0x84,0xA6,0x54,0x2D,
+	0x5F,0x6D,0xCB,0x4F,0x97,0x6F,0xD6,0xEC,0x5A,0xEE,0x09,
+	0xC2,0xD8,0xD8,0x44,0xF2,0x66,0x6C,0xB9,0xD8,0xEF,0x5D,
+	0x7E,0xF3,0xA8,0x42,0xF4,0x3F,0x2B,0x80,0x12,0x0C,0x14,
+	0x7D,0xA5,0x9A,0x0F,0x92,0x7B,0xCE,0xDD,0xCA,0x8F,0x76,
+	0x79,0xAE,0x99,0x94,0xC1,0xB9,0x3C,0xDF,0xC4,0x62,0x42,
+	0x01,0xB8,0x4B,0x0E,0x92,0xA2,0xB9,0x68,0x25,0xA9,0x4B,
+	0x6D,0xBA,0xEF,0xDA,0xFE,0x2A,0x60,0x2B,0x83,0x09,0x63,
+	0x97,0x31,0x52,0x3F,0xBD,0xDC,0x68,0x96,0xD6,0x58,0x3F,
+	0xF4,0xB4,0x7B,0x7D,0x7F,0xE3,0xC8,0x52,0xB2,0x90,0x44,
+	0x51,0xE7,0xF6,0x95,0x71,0xF0,0x74,0x92,0x05,0xDA,0x53,
+	0xBE,0xC3,0x7D,0x78,0x0F,0x6C,0xF5,0x47,0x17,0x59,0x70,
+	0x44,0xAD,0xEA,0xE9,0x24,0x6C,0x65,0x9B,0x6B,0xA0,0x2D,
+	0xA9,0x95,0x8D,0x75,0xC8,0x5B,0xD8,0x57,0xBD,0x81,0x5C,
+	0x02,0x65,0xF2,0xAF,0xE9,0x9C,0x6A,0x72,0x87,0x4C,0xB1,
+	0xE4,0x84,0x5B,0xBF,0xA3,0xA4,0xDE,0x31,0xBF,0xF0,0x0B,
+	0xA7,0xD4,0xEE,0x86,0x87,0x4A,0x25,0x1F,0xDD,0x51,0x18,
+	0x2C,0x0D,0xDA,0xC5,0x05,0xD0,0x66,0x2F,0xF2,0x4D,0xC7,
+	0x88,0x6D,0xBD,0x84,0x6F,0xD3,0xE6,0x71,0x5A,0x06,0x52,
+	0xE6,0x7A,0x12,0x77,0xD0,0x40,0x19,0xF7,0x3F,0x8F,0x75,
+	0xB3,0x73,0xF1,0xF6,0xF5,0x4A,0x65,0xC5,0xC7,0x2A,0x3F,
+	0xF8,0xB9,0xE5,0x4D,0xC9,0x05,0xD0,0x6E,0xFE,0x87,0x1D,
+	0xDE,0x25,0xB2,0xA1,0x6B,0x76,0x6C,0x11,0xF9,0x6D,0xC3,
+	0x81,0x44,0x94,0x20,0xCF,0xF6,0x04,0xD1,0xCE,0xF8,0xB3,
+	0x96,0x5D,0xEC,0x9B,0xD1,0x9F,0x8F,0x0A,0x73,0x57,0xD5,
+	0x81,0xBB,0xFD,0x97,0xD7,0x7E,0x01,0xCE,0xBA,0x02,0x85,
+	0xE3,0xB6,0xF0,0x0E,0x39,0xB9,0x6D,0x39,0xD8,0x06,0x6E,
+	0x2C,0xF4,0xF7,0xAF,0x59,0xF0,0xFA,0x2F,0xCB,0xE6,0x9A,
+	0x63,0x04,0x07,0x83,0x6A,0x92,0x8F,0x9D,0x9D,0xAB,0xB9,
+	0x54,0x53,0x5F,0x7E,0x9E,0xB9,0xAA,0xC3,0xA7,0xAE,0x98,
+	0x40,0xA2,0xD2,0x01,0xD8,0xD8,0x60,0xB4,0xD6,0x93,0xBA,
+	0x87,0x56,0x13,0xAA,0xF5,0xD8,0xF8,0x3A,0x3C,0x80,0x36,
+	0x1C,0xA8,0x00,0x95,0x3A,0x18,0xB7,0x7C,0x71,0xD1,0xE3,
+	0x1C,0x50,0xE4,0xAD,0x62,0x20,0x34,0x57,0x91,0xF4,0x99,
+	0x00,0x60,0x26,0xCC,0x2B,0x17,0xFA,0x8A,0xDF,0xBD,0x52,
+	0xE2,0xA4,0xBA,0xC6,0x3A,0x13,0x89,0xE4,0xF7,0x35,0x34,
+	0x71,0x38,0xDA,0xD7,0x4D,0x1B,0x81,0xFF,0xD8,0x9E,0xCA,
+	0xEC,0x55,0xFC,0x96,0xBA,0x1E,0xE8,0x7A,0x63,0x7B,0xBE,
+	0x3F,0xF3,0xD6,0xFE,0x0E,0xED,0x6B,0x1E,0xAC,0x53,0x6E,
+	0x9D,0x87,0x37,0x77,0x15,0xCE,0x16,0x7C,0x46,0xE0,0xBD,
+	0xC8,0xCB,0x73,0x6E,0x4A,0xFC,0x50,0x8E,0x4B,0xBA,0xFC,
+	0x00,0x30,0xFB,0x02,0x5D,0x56,0xF1,0x78,0xA5,0xCC,0x8E,
+	0x8B,0x3D,0xA7,0xE4,0x3C,0x28,0xD8,0x29,0x17,0x1F,0xDE,
+	0x88,0x2C,0x63,0x8D,0x7D,0x4F,0x18,0xFC,0x1A,0x8E,0xA1,
+	0x4D,0xB6,0x01,0xFF,0x58,0xE7,0xA9,0xA7,0x4B,0x9E,0x06,
+	0x75,0x27,0x33,0x41,0xBE,0x7E,0xCE,0x76,0xD0,0xA8,0x0F,
+	0x0F,0x17,0xA5,0xE6,0x70,0x60,0x89,0x2C,0x15,0x6D,0xEE,
+	0xF7,0x6D,0x5A,0x3C,0x91,0x20,0x0C,0x6D,0x12,0x2B,0xF0,
+	0x0B,0xD8,0x9E,0xCB,0xDC,0x64,0x5F,0x95,0x79,0xB7,0xE6,
+	0x4A,0xBB,0xDC,0x92,0x65,0x11,0x0C,0x1D,0x17,0x16,0x6F,
+	0x39,0x12,0x08,0x32,0xA3,0xFD,0x03,0xF6,0x60,0x09,0x92,
+	0xC0,0xCD,0x7F,0x34,0xA7,0x65,0xDA,0x1C,0xBA,0x04,0x7B,
+	0x7B,0xB0,0x1C,0xA9,0xB6,0xDE,0xB4,0x79,0x74,0xD3,0xCE,
+	0x74,0x73,0x3D,0x5E,0x37,0x05,0x6D,0x6C,0xD6,0xC0,0x4B,
+	0x2D,0xE3,0xF6,0xCB,0xBD,0x5D,0x3E,0xF1,0xA3,0xF0,0xC0,
+	0xED,0xD4,0x63,0x82,0x0A,0x60,0xA2,0xE2,0xF6,0x44,0xC0,
+	0xF6,0xB7,0xE4,0xC2,0xFB,0x2B,0x2D,0x88,0x35,0xC8,0x82,
+	0xA1,0xFC,0xCF,0x29,0xE5,0xBE,0x4B,0x32,0x33,0x11,0x22,
+	0x63,0x4A,0x85,0xE8,0x2A,0x8C,0x6D,0x69,0x2F,0x87,0x9D,
+	0x7E,0x8B,0xE4,0xB1,0xFF,0xED,0x2B,0xE0,0x3C,0xEC,0x4A,
+	0xC4,0x95,0x6A,0x5D,0x29,0x2D,0xFE,0x94,0x3E,0x66,0xF6,
+	0x14,0xF1,0xB9,0x96,0x6C,0x78,0xF7,0xB0,0x51,0xAC,0xEF,
+	0x24,0x1F,0x2C,0x5C,0x44,0xC9,0xF4,0x2D,0x02,0xAA,0x7A,
+	0x09,0x65,0x81,0x76,0xA0,0xA3,0x70,0x78,0xCB,0x58,0x35,
+	0x8F,0xBD,0xD0,0xB2,0xCA,0xA5,0x8C,0xDE,0xDB,0xE3,0xCB,
+	0xF8,0x05,0x8A,0xA4,0xDA,0x5D,0x71,0xA0,0x44,0xAC,0x14,
+	0x1F,0xB6,0x45,0x1A,0x90,0x6B,0x33,0x40,0xE2,0xC3,0xAA,
+	0x6A,0x07,0x70,0xB2,0xAB,0x1F,0x19,0xF2,0xEF,0xE9,0x18,
+	0xEE,0xC5,0xFD,0x1F,0x05,0xE7,0xFD,0x08,0x85,0xE3,0x30,
+	0xE0,0x73,0xDB,0xDE,0x67,0x9C,0x71,0xF6,0x3C,0xCE,0xDE,
+	0xC2,0x71,0xB6,0xBB,0xEC,0xB3,0x0F,0xC7,0xD9,0x72,0x77,
+	0x46,0x2A,0x5B,0x76,0xFB,0x52,0x1A,0x46,0x43,0x45,0x21,
+	0x5B,0xB2,0x8A,0x52,0x8A,0x94,0x2D,0xA3,0x3E,0x3A,0x8E,
+	0x92,0xAC,0x90,0x7B,0xBF,0xEF,0x5F,0xF1,0x3C,0xCF,0x2F,
+	0x0F,0x8C,0x23,0xA2,0xCF,0x46,0xE5,0x5F,0x1F,0xE6,0xBF,
+	0xB1,0x25,0xD9,0xF8,0xB2,0x4A,0x68,0xE9,0x70,0xD1,0x3B,
+	0x74,0xFF,0xD4,0x9E,0x35,0x9F,0xF3,0x41,0xFD,0xEE,0xA9,
+	0x46,0x9C,0xDE,0x1D,0x71,0xE1,0x37,0x6F,0x70,0xA6,0xDF,
+	0x14,0xD9,0x99,0xE4,0xDD,0xD6,0x70,0xC8,0x4F,0x44,0xA0,
+	0x86,0x7A,0xEC,0x07,0xBA,0x92,0x67,0x78,0x13,0xBC,0x76,
+	0xE0,0x49,0xE2,0x70,0x84,0xC5,0xAF,0xA1,0x9F,0x5A,0xDF,
+	0xDD,0xB6,0x17,0x45,0xAB,0x94,0x76,0xDF,0x82,0xC4,0x87,
+	0x85,0xD5,0x85,0xCF,0x1C,0xEA,0x6E,0x33,0x65,0xB7,0x0A,
+	0xB2,0xF0,0x27,0x72,0x84,0x93,0xE2,0x72,0xBC,0xA3,0x93,
+	0xD3,0x7A,0xFE,0x4D,0x5D,0x5A,0xE7,0x56,0x38,0x47,0x3F,
+	0x5E,0x6D,0xFE,0x27,0xD2,0x12,0x6F,0x53,0x0D,0xB5,0xF2,
+	0xB8,0xD6,0xB7,0xEF,0x70,0x66,0x9C,0x69,0xC9,0x2B,0x2F,
+	0x10,0xA9,0xBA,0x2D,0x65,0xA9,0xE3,0xCB,0xF7,0x62,0x8E,
+	0xF8,0x0B,0x26,0x72,0x81,0xB0,0x55,0x8C,0xBB,0xB9,0xB9,
+	0xAB,0x63,0xFC,0x77,0x37,0x89,0x93,0xAE,0xFC,0xC2,0x64,
+	0x8A,0x2A,0x4B,0x32,0x7A,0x63,0x38,0x94,0x2C,0x37,0x82,
+	0x6C,0xB8,0xBB,0xF4,0xEE,0x20,0xE0,0x96,0xEA,0xFE,0xD3,
+	0xAB,0x51,0x82,0x57,0xAD,0x85,0x0D,0x69,0x1C,0xC5,0xB9,
+	0x47,0xC7,0x5B,0xC5,0x25,0xD3,0x6E,0xBB,0x1C,0x97,0x87,
+	0x4F,0x6D,0x41,0x37,0xEC,0xDE,0xD0,0x3E,0x02,0x17,0x4B,
+	0xB4,0x96,0x61,0x4F,0x45,0xCB,0x66,0xC7,0xC4,0xC2,0x79,
+	0x47,0x03,0xAC,0x3F,0x5C,0x3B,0xD2,0xEA,0xF3,0xD8,0xD4,
+	0x8A,0xFC,0x3A,0x16,0x01,0x14,0x34,0x63,0x1C,0x1C,0xC1,
+	0x63,0xAD,0x85,0xFE,0x10,0xBE,0x44,0x80,0xB4,0xFF,0x2A,
+	0x17,0x05,0xBE,0x00,0x51,0xCE,0xE4,0x7F,0xDB,0x10,0x38,
+	0xB2,0x03,0x62,0xBE,0x73,0x0E,0x64,0x4D,0x71,0xF0,0xB9,
+	0x42,0xAA,0x79,0x1F,0x7D,0xCE,0x9E,0xCB,0x6C,0xB6,0x87,
+	0x4C,0x78,0x34,0x37,0xB6,0x80,0xBA,0x5E,0xB4,0x37,0x2D,
+	0xB5,0x7C,0x58,0x4C,0x56,0xC8,0x3A,0x40,0xCD,0xF3,0x89,
+	0xD1,0x6D,0x0C,0xF7,0x36,0x93,0x04,0x78,0xEE,0x6B,0xF3,
+	0x9E,0x3E,0xDB,0x0A,0xE0,0xDF,0x9B,0xDF,0xE7,0x9C,0x89,
+	0x69,0x34,0xB6,0x68,0x5F,0x1B,0xC7,0xDC,0xC6,0x42,0x17,
+	0xEA,0x7A,0x1A,0x1A,0xDF,0x1C,0x4F,0xE2,0x36,0x45,0x5E,
+	0x70,0xA5,0x73,0x72,0x6B,0x01,0xAD,0x92,0x41,0xFC,0xE3,
+	0xBE,0xEB,0xFC,0x96,0x5B,0xF9,0x13,0x42,0xA8,0xB9,0x6D,
+	0x51,0x43,0xFE,0x35,0xF2,0x5F,0x0B,0xF9,0xAD,0x8C,0xFD,
+	0xD5,0xFC,0x63,0xB6,0xE1,0x63,0x07,0x43,0x65,0x5C,0x7C,
+	0xBB,0xA4,0xE3,0xF4,0x39,0x99,0x17,0xF0,0xD5,0x47,0x87,
+	0xB2,0x69,0xD7,0x73,0xC0,0xBF,0xA4,0x01,0xDC,0x8E,0xF7,
+	0xBE,0xCB,0x41,0xAD,0x3F,0x24,0x20,0x2F,0xA6,0xA7,0xC2,
+	0x58,0xCB,0x96,0x9F,0x63,0xB9,0x64,0xE2,0xC3,0xAA,0x77,
+	0x6E,0x9C,0x45,0x03,0xC0,0xC9,0x0E,0x3E,0x60,0x2B,0xCA,
+	0xAE,0x82,0x7E,0x44,0xA1,0x40,0x90,0xC5,0x00,0xFC,0x56,
+	0x19,0x50,0xA7,0x48,0xFB,0xBB,0xA0,0x6F,0x11,0x5F,0x3D,
+	0x94,0xFB,0x56,0x58,0xE7,0x33,0xEB,0xE4,0xDA,0x32,0xF0,
+	0x00,0x77,0x56,0xD8,0x90,0xE7,0x9B,0xEE,0x5F,0xF7,0x1B,
+	0x1F,0x70,0x0C,0x71,0x34,0xD0,0xC4,0xA0,0x57,0x0A,0x75,
+	0x93,0xBC,0x1D,0x7F,0x90,0x17,0x2E,0x29,0xBC,0x73,0xFF,
+	0x75,0x91,0xBE,0xCF,0xF5,0x61,0x5D,0xE3,0x46,0x5E,0x35,
+	0x94,0x7B,0xEC,0xC7,0x66,0x18,0xF7,0x0D,0x88,0xF3,0xF5,
+	0xBD,0xCF,0x87,0x37,0xF4,0x06,0x42,0xCE,0xFD,0x64,0x32,
+	0xEF,0xE3,0xB2,0x8D,0xAE,0x9E,0xA9,0x1E,0xC8,0x9B,0x7D,
+	0x68,0xFB,0x57,0x7C,0x2A,0x9D,0xF6,0x93,0xD4,0xC8,0xEB,
+	0x13,0x73,0x2D,0xF4,0x01,0x30,0x13,0xEC,0x5F,0x7E,0x3F,
+	0xFE,0xF9,0xEE,0x57,0x8E,0x74,0x2D,0x63,0xA3,0xD7,0x51,
+	0x20,0xA1,0xAC,0x40,0x45,0xAB,0xE6,0xAE,0x45,0xF0,0xE7,
+	0x91,0xEF,0xE0,0xF1,0xC9,0xAF,0x1E,0xCB,0x69,0x96,0xC7,
+	0x3F,0xA7,0x45,0x36,0x7F,0xED,0x82,0xEF,0xEC,0xAF,0x9C,
+	0x66,0xE6,0xAC,0x2E,0xF3,0xCE,0x38,0x97,0xFB,0x93,0x18,
+	0xCA,0x5F,0xFA,0xFB,0x63,0xC5,0x45,0x01,0xF2,0x3E,0x17,
+	0x42,0x44,0x8C,0x87,0xE1,0x89,0x19,0x55,0x0E,0x2E,0x76,
+	0x59,0xCF,0x8C,0x93,0x56,0x89,0x2A,0xC0,0x9E,0xD2,0xFC,
+	0xB9,0x7F,0x4C,0x62,0x36,0x48,0x6F,0xBA,0xB3,0xE7,0xA9,
+	0x7D,0x34,0x34,0x04,0xC6,0x3D,0x9F,0x52,0xC0,0x89,0x9E,
+	0x09,0x8C,0x14,0xB0,0xA1,0xFF,0x6C,0x5F,0x7C,0x7B,0x57,
+	0xB3,0x5D,0xAA,0xD5,0x89,0x53,0x3E,0xF9,0xD1,0xFB,0x83,
+	0x4C,0xDC,0x0F,0x06,0x13,0xB7,0x13,0xD2,0x41,0x79,0xA7,
+	0x20,0xF6,0x9B,0x2A,0x66,0xDB,0x1F,0x5D,0xE5,0xD1,0xCA,
+	0x31,0x2A,0x23,0x3B,0x01,0xC4,0x49,0x72,0x48,0x3B,0x19,
+	0xB0,0xF7,0x55,0xC9,0xC6,0x8A,0xBC,0x8A,0x9A,0x42,0xC5,
+	0xBF,0x7F,0x26,0xAB,0x00,0x2B,0x66,0x34,0x9E,0x76,0x6D,
+	0x9E,0x03,0x25,0x5A,0xF2,0xFE,0x5E,0xE4,0x38,0xC7,0x7F,
+	0x33,0x8E,0x8B,0xCB,0x73,0xAF,0xA7,0x77,0x92,0x6D,0xC5,
+	0x62,0x59,0x07,0xA8,0x65,0x5E,0xFF,0xB2,0xF7,0x75,0xAE,
+	0x70,0xCB,0x86,0xF7,0xAE,0xEC,0x8D,0x82,0x99,0x5F,0x9C,
+	0xD9,0x03,0xFC,0x0C,0xA5,0xD4,0x94,0x9C,0xE6,0x75,0xAB,
+	0x3D,0x7E,0x19,0xC7,0xBC,0x1A,0x5A,0x35,0xCB,0x39,0x74,
+	0x0B,0x5D,0x95,0x55,0xB6,0xE8,0xCF,0x23,0x97,0x7D,0x57,
+	0x85,0x96,0x43,0x81,0xD5,0x7B,0x33,0xD6,0xB6,0x04,0xF7,
+	0xEB,0x27,0x10,0xBA,0x83,0x54,0xE5,0xFF,0x02,0x9C,0x3E,
+	0x5A,0xCE,0x2B,0x2A,0x68,0x3C,0xDD,0x78,0xC9,0x43,0x68,
+	0x95,0x3E,0xE0,0xE5,0xBF,0xBB,0xBD,0x45,0x2B,0xD0,0xC5,
+	0x5C,0x86,0x66,0x71,0x8D,0x9E,0x99,0x0F,0xE4,0x6B,0x2F,
+	0x9F,0xB2,0x3E,0x9A,0xCB,0x09,0xAC,0xE6,0xE3,0xAB,0xBD,
+	0xB4,0xDB,0x66,0xD6,0x47,0x05,0x9D,0xAC,0xA2,0x06,0x9B,
+	0x53,0x45,0x45,0x96,0xC3,0x4B,0xE8,0xB4,0x2F,0x40,0xA1,
+	0x13,0xC6,0x2C,0xB1,0x08,0xDE,0xB2,0xE9,0x4D,0xD1,0x65,
+	0x53,0xE0,0xEE,0x19,0x65,0x33,0xA6,0x16,0x37,0x73,0x82,
+	0xE3,0xE9,0xC9,0xA0,0xA0,0x0D,0xC1,0x0E,0x6E,0xAB,0xEC,
+	0x26,0xF9,0x59,0x8F,0xB1,0xF2,0xC8,0xE5,0xE5,0xAF,0x34,
+	0x89,0x07,0x9F,0x29,0x3C,0x4A,0x12,0x9D,0x13,0xB9,0x29,
+	0xE4,0xC6,0xA3,0x29,0x6E,0xD4,0xF8,0x53,0xD6,0x44,0x2C,
+	0xEA,0x3B,0x57,0x40,0x66,0x6A,0xDB,0x22,0xD2,0x2C,0x0D,
+	0x40,0xE3,0x2A,0x7C,0x2A,0xCE,0x28,0x3C,0x59,0xF9,0x63,
+	0x5D,0xEF,0x03,0x76,0x49,0x02,0xE1,0x54,0x4F,0xCE,0x66,
+	0xB1,0xD7,0x77,0x69,0x32,0xED,0x9D,0xCB,0xE3,0xAA,0xE9,
+	0xC5,0x1F,0xF3,0x4B,0x3A,0xC5,0x04,0x0D,0x4A,0x05,0x72,
+	0xD4,0x72,0x86,0xD8,0x1C,0xDA,0xCE,0x6A,0xC7,0x06,0xF2,
+	0xAA,0x8A,0x85,0x33,0x3D,0x48,0xE6,0xBF,0x43,0x0B,0xA4,
+	0xFD,0xE3,0xF9,0x6D,0xD3,0x8D,0x5B,0xB3,0x89,0xCF,0xA0,
+	0x47,0xF9,0x9B,0xCC,0xB6,0x1B,0xB6,0xC7,0x82,0xF9,0x93,
+	0xDC,0x38,0x44,0xBE,0xE8,0x97,0x67,0xFF,0x78,0x75,0x8E,
+	0x6D,0xF5,0x57,0xFF,0x48,0x4D,0xAA,0xFE,0x35,0x5C,0xE3,
+	0x47,0xB0,0x42,0x68,0x71,0x97,0x19,0xCC,0x95,0x07,0x12,
+	0x45,0xC2,0x96,0x8E,0x2B,0xBC,0xF2,0xD7,0x9D,0x4B,0x67,
+	0x21,0x5F,0x12,0xAE,0xF6,0x8C,0x62,0x9C,0x57,0xCF,0x1F,
+	0xB1,0x01,0x25,0x08,0x2D,0xFC,0x80,0xD9,0x2B,0xEE,0x11,
+	0x0D,0xE6,0xAB,0xBD,0xA9,0xE0,0x28,0x63,0x7C,0x0A,0x7C,
+	0xA6,0x64,0x14,0x36,0x25,0x42,0x5B,0xC8,0xE4,0xF3,0x6B,
+	0xAF,0xC8,0x8E,0x11,0x55,0x50,0x6F,0xBE,0xCE,0x43,0x23,
+	0xBD,0x0A,0x8B,0xE9,0xC9,0x48,0x26,0x27,0x45,0xC4,0x6E,
+	0x26,0xA4,0xC8,0x01,0x24,0x79,0x90,0xE1,0x43,0x32,0xAB,
+	0x30,0x9F,0x0E,0xA7,0x8C,0x06,0xC0,0xD6,0x53,0x7C,0xD1,
+	0x6F,0x70,0x01,0xC4,0xDC,0xBA,0x3A,0xB6,0xEA,0xBF,0x33,
+	0x39,0x83,0xC0,0x02,0xAE,0x4F,0x65,0x76,0x09,0xFC,0x74,
+	0x66,0xB0,0xE4,0x20,0x87,0xE0,0x5D,0xCC,0xF4,0x19,0x5D,
+	0x1F,0x81,0x24,0x1E,0x23,0x95,0x3F,0xF7,0x77,0x85,0xDF,
+	0xFE,0xB9,0x27,0x25,0xF9,0x24,0xA5,0x7B,0xBA,0x60,0xD4,
+	0xA7,0x0B,0x5F,0xB4,0x88,0x7C,0xF0,0xE4,0xF6,0xE3,0x0A,
+	0x49,0x9D,0xF9,0x08,0xBD,0xEB,0xBD,0x7B,0x63,0xC5,0x8E,
+	0x79,0x01,0x08,0x08,0x96,0xFD,0x29,0x15,0xC1,0xFD,0x36,
+	0xCD,0x7A,0x6F,0x76,0x7A,0x6F,0x74,0x3A,0xA1,0xDA,0x08,
+	0xB0,0xD7,0x36,0xD3,0x9B,0x33,0xE3,0x7E,0xDC,0x00,0x0B,
+	0x94,0x12,0x92,0x5B,0x97,0x04,0x70,0xCA,0x0C,0x30,0xF9,
+	0x07,0xB8,0x48,0x5A,0x7D,0xDC,0xDC,0x11,0xCE,0xFB,0x34,
+	0x04,0xD6,0x6C,0x26,0xB8,0xBC,0xF8,0x4D,0x71,0x7F,0xB5,
+	0x06,0xDA,0xAC,0xED,0x12,0xB0,0x78,0x66,0xB3,0x78,0x4C,
+	0xE3,0x6D,0x8F,0xC4,0x70,0x92,0x24,0x5D,0x80,0x6D,0x36,
+	0x95,0xC2,0xA3,0x31,0x50,0x3C,0x15,0x23,0x20,0xED,0xF5,
+	0x93,0x04,0x63,0xCF,0x5E,0x39,0x3F,0x3C,0xE0,0xE5,0xAD,
+	0x71,0xB8,0x5B,0xFC,0x13,0x34,0xFB,0x34,0x3D,0x49,0xD0,
+	0x4E,0xBD,0x63,0x27,0x05,0x9C,0x91,0xFC,0x6B,0x5F,0x78,
+	0xD7,0xF5,0x77,0x2A,0x6A,0x6C,0x5A,0x43,0x4F,0x3F,0x43,
+	0x62,0x78,0x27,0x69,0x13,0x44,0xE7,0xE7,0xC1,0x23,0x41,
+	0xC7,0x03,0xC2,0x63,0xD4,0xDF,0xAC,0x85,0x5D,0x98,0x1B,
+	0xBB,0x78,0xB8,0x78,0x50,0xEF,0x53,0x50,0x5B,0xE0,0xC8,
+	0x15,0xC2,0xEB,0xCB,0xDC,0x86,0x7B,0xCB,0x97,0x7E,0x41,
+	0xC1,0x7B,0xDF,0x40,0xF3,0x6F,0x7C,0xC1,0x63,0xD9,0x03,
+	0x57,0x46,0xFD,0x7A,0x78,0x91,0x47,0x5E,0xEE,0xC5,0x90,
+	0xE2,0xC0,0x38,0x09,0x57,0xE4,0x17,0x2F,0x49,0xBA,0x09,
+	0x58,0x7B,0x6F,0x7F,0x44,0xAE,0xBF,0xF0,0x9F,0xF2,0x06,
+	0xA4,0x10,0xC1,0x28,0x2C,0x24,0x16,0x66,0x14,0xC6,0x71,
+	0x21,0x7B,0x03,0x1F,0xC2,0x36,0xC6,0xEC,0x79,0xB8,0xB7,
+	0xFB,0xED,0x61,0xBB,0xC7,0xCC,0xF7,0xDA,0xD9,0x0D,0xE8,
+	0x75,0x80,0x07,0xAD,0xF0,0x63,0x27,0x0E,0x5E,0x16,0xAF,
+	0x2E,0x53,0x36,0x25,0x50,0xB6,0x28,0xDB,0x71,0x9E,0x72,
+	0x12,0x13,0x1A,0x22,0x72,0x93,0xF5,0x31,0x3B,0xAA,0x6D,
+	0x7D,0xE3,0x27,0x84,0x01,0xDE,0x24,0x42,0xC9,0x5B,0x0C,
+	0xF8,0xAE,0x2F,0x57,0xCF,0xA8,0x1D,0x54,0x4C,0xF4,0x2F,
+	0xA4,0xD4,0x7B,0xFD,0x93,0xC6,0x1F,0xE6,0x00,0x7C,0x08,
+	0x36,0x58,0x48,0xF0,0x87,0x6C,0x6A,0x82,0x9B,0xB6,0xDE,
+	0x41,0x77,0x35,0xE1,0x4D,0xFB,0x43,0x5C,0x83,0x00,0x9F,
+	0xF6,0x07,0x4F,0xEF,0x52,0x6C,0x56,0xD6,0x86,0xBB,0x0D,
+	0xBF,0x3D,0xD0,0x2E,0xCF,0x69,0x0B,0x1F,0x2C,0xA5,0x68,
+	0xE6,0xB9,0x2D,0x32,0x09,0x20,0x66,0x5A,0xF8,0x93,0xB1,
+	0x7C,0x57,0x12,0xC2,0xF0,0xCF,0xA1,0x87,0x8C,0x7B,0x19,
+	0x25,0x31,0x01,0x7A,0x55,0x7A,0xA9,0x6C,0x5E,0xB6,0x55,
+	0xC6,0x47,0xF9,0x3E,0x6E,0x13,0x5C,0x16,0x04,0xCD,0x53,
+	0xFE,0x77,0xC1,0x8E,0xCB,0xD7,0xFF,0x29,0xE0,0x52,0x7F,
+	0x09,0x4C,0xFB,0x3B,0x2C,0xF0,0xC2,0x2D,0x98,0xDC,0xD8,
+	0xC0,0x89,0xA0,0x76,0x80,0x6D,0xBC,0x8B,0xC4,0x5B,0x60,
+	0xC8,0x12,0xB8,0x77,0x72,0xA7,0x06,0xE7,0xDB,0xB7,0x7F,
+	0xBD,0x0A,0x38,0x06,0x24,0x38,0x26,0x6F,0x32,0xA7,0x60,
+	0xE0,0x5E,0xBB,0x20,0x79,0x36,0x5D,0xB0,0xE0,0xE6,0x53,
+	0x1E,0xFE,0x58,0xE8,0x94,0xE4,0x7D,0xFC,0x6E,0x71,0xFE,
+	0xD1,0x3F,0x15,0xDD,0x86,0x3F,0x7D,0x85,0xA3,0x9F,0x21,
+	0xB0,0xD9,0xD3,0x53,0x26,0x13,0x19,0xC0,0xE0,0x49,0x93,
+	0x8F,0xC9,0xA2,0x4B,0x6A,0x1F,0x25,0xD2,0xBC,0xE5,0x0B,
+	0x2F,0xD0,0x32,0x78,0x9C,0xDF,0xB1,0xE7,0x53,0xA0,0x31,
+	0x2F,0x16,0x59,0x6E,0x1D,0x09,0x57,0x5F,0x1E,0xFF,0xC3,
+	0x38,0xAA,0x70,0x2B,0x33,0xDC,0x3F,0x6A,0x02,0x17,0x92,
+	0x95,0x14,0x18,0x1A,0xE1,0x5F,0xDA,0x4F,0x33,0x13,0x2B,
+	0xC0,0x67,0xB2,0x13,0x2C,0xD4,0xDC,0x8E,0x37,0x24,0x06,
+	0xE9,0x57,0x52,0x14,0xE8,0xA3,0xAC,0xD9,0xC6,0x62,0x3E,
+	0xD6,0x8B,0x69,0x79,0x0E,0xDD,0xB7,0x1B,0x86,0xCA,0xB0,
+	0x3F,0xF5,0x37,0x0F,0xAE,0xAD,0xE2,0xD9,0x94,0xC7,0x5F,
+	0x3D,0xF7,0xE7,0x9F,0x0E,0x34,0x5B,0xBD,0xD9,0x91,0xBB,
+	0x8C,0x35,0xB7,0xED,0x6F,0x7C,0x93,0x91,0xC0,0xC1,0xAD,
+	0xD3,0xFF,0xC9,0xCC,0x40,0xA0,0xB9,0x15,0x53,0x9D,0xF5,
+	0x34,0xF9,0x0F,0xB3,0xA9,0x4D,0x82,0xB5,0x0E,0x51,0x6D,
+	0xEA,0x1C,0x15,0x43,0xBF,0xC8,0x5D,0xB9,0x31,0xD0,0x6E,
+	0x47,0x00,0x76,0x30,0x6D,0x61,0xE6,0xA3,0xBC,0x36,0x51,
+	0xFB,0x80,0x5A,0x20,0x2D,0xAC,0xF4,0xD5,0xB6,0xE4,0xEE,
+	0x2B,0x94,0xA6,0x55,0x03,0xEF,0xE0,0xAE,0xA8,0x61,0x7F,
+	0xB3,0xCD,0xE7,0x10,0xED,0xED,0xB1,0xE1,0xBC,0xE5,0x4F,
+	0x67,0x02,0xEC,0x5E,0x76,0x0B,0xED,0xE2,0xD8,0x0D,0xCA,
+	0x22,0x89,0xD1,0x3F,0x35,0x32,0x57,0x32,0x5A,0xC7,0x61,
+	0xE1,0x02,0xD5,0xB5,0x90,0x74,0xE7,0xC7,0x62,0x09,0xD2,
+	0xC7,0x56,0xB4,0x32,0x13,0x01,0x3B,0xCC,0xBA,0x41,0xF8,
+	0x5F,0x49,0x3C,0x1B,0x6B,0x15,0x43,0x47,0x49,0x9C,0x61,
+	0x71,0xB3,0x04,0x64,0x0B,0x4B,0x05,0xFB,0x88,0x3D,0x98,
+	0x40,0x3E,0x16,0xA2,0x8C,0x3D,0x09,0x61,0xFD,0x5A,0x85,
+	0x72,0x0C,0x31,0xE7,0x1F,0x4F,0x58,0x34,0x66,0x39,0x79,
+	0xB6,0xF7,0x1C,0xBE,0x24,0x68,0xBE,0x34,0x3C,0xC0,0x00,
+	0xA9,0x6A,0x7B,0xB9,0xFE,0xAF,0x14,0x17,0x8F,0x35,0x16,
+	0xA3,0x1F,0xFD,0x00,0x15,0x8E,0x0A,0x87,0x96,0x36,0x7F,
+	0xA6,0xEA,0x8E,0x5D,0xE2,0x40,0x7E,0xE7,0xFA,0x4C,0x8F,
+	0xF5,0xE7,0xE4,0xA8,0x39,0x34,0x09,0xE5,0xCD,0xEB,0x17,
+	0xEA,0x35,0xA3,0xFB,0x15,0x84,0x1C,0xB1,0xE2,0x0F,0xF2,
+	0x7F,0xBF,0x39,0x1E,0x35,0xEF,0xDB,0xC3,0x6A,0x49,0xE9,
+	0xEC,0xCC,0x52,0xD8,0xB2,0x07,0x72,0xF3,0xB5,0x7D,0x16,
+	0x05,0x3C,0xD7,0x74,0x26,0x7C,0x38,0xD6,0x2A,0xC5,0x4A,
+	0x5F,0x66,0x26,0xDC,0x28,0x64,0x45,0x51,0xD1,0xFC,0xD9,
+	0x59,0x7B,0x3C,0xB4,0x21,0x49,0xAE,0xDB,0xBE,0x66,0x9E,
+	0x74,0xCF,0xC0,0xED,0xA0,0x04,0x8D,0x83,0x22,0x18,0x04,
+	0x8D,0x80,0x55,0xD0,0x20,0x71,0x07,0x29,0xF6,0x82,0xB1,
+	0x24,0xF6,0x69,0xA8,0x2B,0x76,0x9A,0x96,0xE7,0xA2,0x75,
+	0x6E,0x2A,0x85,0x8D,0xE7,0x5B,0xD5,0x66,0xF1,0x6E,0xC1,
+	0x97,0x3E,0x11,0x2B,0x20,0x8B,0xB5,0xC7,0xF3,0x69,0x25,
+	0x6F,0x30,0x77,0x45,0x83,0xCC,0xA0,0xBB,0x21,0x30,0xCF,
+	0xFD,0x81,0x87,0x35,0xA7,0x3C,0xBC,0xCD,0xAC,0x69,0x19,
+	0x45,0x8A,0xE6,0xD6,0x49,0x50,0xB6,0xB9,0x5F,0x0A,0x10,
+	0x8C,0xCA,0x3C,0x8A,0xE3,0x82,0xD7,0x83,0xB9,0xFB,0x41,
+	0x99,0x3D,0xAB,0xC6,0x8B,0x56,0xF4,0xDC,0xEF,0xED,0x0F,
+	0xB1,0xB8,0x79,0xBB,0x82,0x01,0x60,0xE6,0x18,0xBB,0xF2,
+	0xB5,0x69,0x62,0xD0,0x92,0x19,0xE0,0x56,0x28,0x18,0xD0,
+	0x3D,0x61,0xEB,0xCC,0xF4,0xAB,0x18,0x75,0x02,0xB6,0x6F,
+	0xEA,0x61,0xDE,0xFE,0xE3,0xEF,0xF2,0x74,0x06,0x77,0xFD,
+	0x29,0x78,0x83,0xB6,0xE2,0xDE,0x29,0x15,0x4C,0xF8,0xDC,
+	0x0D,0x21,0x7C,0xC9,0x7D,0xEB,0x9F,0x14,0x02,0xBD,0x3E,
+	0xE7,0x21,0xA1,0x94,0x6E,0x1D,0x3B,0xC1,0x23,0x1A,0x61,
+	0x53,0x25,0x58,0xB9,0xFD,0xF5,0x8B,0x33,0xEB,0x3B,0x4F,
+	0xCC,0xC9,0x51,0x1C,0x78,0x7F,0xA4,0x64,0xE6,0xD7,0xF5,
+	0xA1,0xB2,0x7E,0x9F,0x7F,0x75,0x8F,0x73,0x7B,0x17,0x0F,
+	0x1E,0x19,0x40,0x57,0x04,0xD9,0xBE,0xAC,0x45,0x0B,0x12,
+	0xE0,0x0C,0x9C,0x6D,0x71,0x1A,0x90,0x01,0x42,0xA3,0x00,
+	0xE9,0x45,0x6F,0xB2,0xC4,0x62,0xD1,0xD8,0xDF,0xBB,0xB9,
+	0x3D,0xCE,0x3D,0x19,0x20,0x2C,0x6B,0xB3,0xE0,0x5F,0x9F,
+	0xB9,0x06,0x5D,0x1A,0xDB,0x6E,0x54,0x24,0x56,0xF3,0x36,
+	0x61,0x42,0x7C,0x19,0x45,0x13,0xE6,0xDD,0x7F,0xBD,0xB7,
+	0xD6,0xDD,0x86,0x45,0x63,0x7A,0x68,0x2B,0xE6,0x68,0xDA,
+	0xC2,0x11,0xEB,0x6B,0xE6,0x5F,0x34,0x9D,0xEB,0xE2,0xE4,
+	0x78,0x71,0x8B,0x73,0x0A,0x90,0x8D,0xF0,0xAB,0xC5,0x1B,
+	0xD4,0x58,0x25,0x1F,0x7C,0x85,0xEC,0xF2,0x80,0x36,0x02,
+	0xF0,0xDB,0x3F,0x57,0x05,0x80,0x23,0xE1,0xFC,0xDF,0x46,
+	0x57,0x3D,0x32,0x56,0x8B,0x00,0xF8,0x44,0xF2,0xEF,0x78,
+	0x94,0x0F,0xA9,0x67,0x2B,0x21,0x0E,0x85,0xD5,0x66,0x63,
+	0x35,0x34,0x74,0x0C,0x51,0xEE,0x74,0x76,0x3C,0xDA,0x33,
+	0x2A,0x8E,0x8C,0xA2,0xB2,0xD3,0xA8,0x34,0x72,0x9C,0x16,
+	0x8A,0x70,0x9C,0x90,0x44,0x8B,0x4A,0x88,0xA7,0x2E,0xC8,
+	0x25,0x24,0xA6,0x25,0xB1,0xA3,0x22,0x29,0x34,0x94,0x2A,
+	0x56,0x8D,0x8D,0xF2,0x48,0x0B,0x25,0x51,0xC9,0x9A,0xBB,
+	0x28,0xC7,0xF8,0x30,0x05,0xB6,0x8E,0x89,0xB1,0x31,0x5A,
+	0x17,0xB3,0x8B,0xD1,0xD5,0x52,0x07,0x1C,0xA3,0xDC,0xBC,
+	0x5C,0x5C,0x50,0xB3,0x52,0x54,0x8D,0xB8,0x78,0xFB,0xB6,
+	0x78,0xAD,0x70,0x72,0x9C,0x43,0x58,0x35,0x30,0xF0,0xD0,
+	0x2D,0xA1,0x9E,0x47,0x60,0x36,0x81,0x8E,0x45,0xC5,0x89,
+	0xC7,0x55,0xFB,0x4C,0x34,0xA5,0xB1,0xE3,0x01,0xBC,0x5C,
+	0x20,0xC0,0x21,0xBB,0xC3,0x94,0xB3,0xAC,0xAF,0xEB,0xDF,
+	0x0B,0x76,0xCE,0x00,0x7F,0xE6,0xB7,0x4D,0xE5,0xC2,0x42,
+	0x99,0x6F,0x67,0x95,0x4B,0x64,0x74,0xFD,0x97,0xE7,0x22,
+	0x05,0xCB,0xA0,0x85,0xF3,0xDF,0x44,0x4D,0x99,0xF8,0xE2,
+	0xF1,0x08,0x15,0x0E,0x03,0xE5,0xB8,0x1F,0x86,0xC0,0x91,
+	0x1D,0x8B,0x62,0xBE,0x9A,0xA7,0xE2,0x19,0x1A,0x6F,0xCC,
+	0xC6,0x92,0xB8,0xC5,0x60,0x19,0xED,0x66,0xD4,0x92,0x61,
+	0x66,0x64,0x33,0x50,0xC8,0x49,0xFA,0xFC,0xA7,0x54,0x8E,
+	0xF0,0x2F,0x31,0x67,0x2C,0xEF,0x63,0x0E,0x67,0x40,0x53,
+	0xCA,0x55,0x3E,0x71,0x65,0x98,0xD5,0xA9,0x66,0xA7,0x89,
+	0x8C,0x92,0x85,0xB2,0xA1,0x9E,0x2C,0x36,0xA0,0xC8,0x95,
+	0xDD,0x02,0x38,0x6A,0x38,0x46,0xFD,0x79,0x5A,0x4A,0x67,
+	0x77,0xFE,0x2A,0xEE,0x57,0x2E,0xB6,0x8C,0xC9,0x3E,0x4F,
+	0xB5,0x74,0x4F,0x84,0x7A,0xE2,0x1B,0x18,0xD6,0x09,0x69,
+	0xEA,0xBD,0x8F,0x9D,0xAF,0x3C,0xDE,0xC0,0x37,0x63,0x8C,
+	0x36,0x94,0xAB,0xF5,0xC5,0x37,0x0A,0x94,0x0D,0x08,0xEC,
+	0x8F,0xE6,0xA0,0x24,0xDF,0x32,0x19,0xCD,0x42,0x00,0x39,
+	0xB5,0x1B,0xC0,0x61,0x54,0xC0,0x8B,0x9A,0x47,0x59,0x7C,
+	0x13,0x62,0x67,0x9D,0x01,0x1A,0x1B,0xD1,0x55,0x32,0x99,
+	0x67,0xC0,0x16,0x6A,0x35,0x19,0x23,0x1C,0x2C,0x29,0x8B,
+	0xD8,0xC2,0x88,0xD7,0xD6,0x93,0xF7,0x78,0x50,0xFA,0xC2,
+	0x81,0x39,0xE0,0x04,0x4E,0xF3,0x78,0xFA,0x0E,0x2C,0xEB,
+	0x3F,0xB6,0x48,0xBB,0x18,0x24,0xB3,0xAD,0xA0,0x8E,0xDE,
+	0x75,0x00,0xA1,0x77,0xFE,0xAC,0xC3,0xE1,0x78,0x19,0xF7,
+	0xCA,0x94,0x16,0x0F,0x7F,0x17,0x1A,0x7A,0xE3,0xB3,0xE3,
+	0x7C,0xA3,0xD8,0x73,0xC5,0xAF,0xAB,0xAD,0xF0,0x28,0xE5,
+	0xBC,0x3B,0xBD,0xB4,0x8A,0x0E,0x6D,0xCD,0x1E,0x01,0xC2,
+	0x8C,0xC6,0xC7,0x4B,0x06,0xDE,0xFE,0xFB,0x36,0xD9,0x78,
+	0xBE,0x27,0x1B,0x7A,0xF4,0x1A,0xF8,0xBF,0x12,0x3E,0x5B,
+	0x7C,0x0D,0xEE,0x13,0xD4,0x61,0xC4,0xC9,0xE5,0x10,0xAF,
+	0xB7,0xD1,0xAE,0x2B,0x11,0xE1,0x36,0x41,0xC0,0x27,0x55,
+	0x1B,0x38,0x26,0x78,0x2B,0x81,0x09,0x19,0x2B,0x33,0x47,
+	0xA5,0xF7,0x2D,0x53,0x29,0x1B,0x4F,0xD2,0x71,0xC3,0xC7,
+	0x1C,0x7F,0x9E,0xF9,0xD2,0xCC,0x94,0x7E,0x0F,0xB4,0xCB,
+	0x58,0x27,0xBE,0x38,0xDB,0x0D,0xE9,0xE9,0x2E,0xF9,0x58,
+	0xB6,0xD0,0x39,0xEB,0x4A,0x45,0x5A,0xC4,0x6C,0x89,0x67,
+	0xC8,0xFA,0x15,0x6F,0x1D,0xD5,0xA5,0x54,0x1E,0x16,0x7F,
+	0x58,0xD4,0x18,0x76,0x4C,0x49,0x91,0x09,0x39,0x49,0x7D,
+	0x72,0x14,0xCC,0xED,0x8B,0xBB,0xDF,0xE6,0xDC,0xC9,0x9F,
+	0x10,0x1C,0x0E,0xF2,0x9D,0x69,0x76,0xE1,0x9F,0xE4,0x23,
+	0x9D,0x9D,0xF2,0x1D,0x78,0xF7,0xCE,0x5C,0x6A,0xB2,0xF7,
+	0xBB,0xFC,0x15,0x99,0x41,0xF5,0x19,0x31,0x8C,0x04,0xDA,
+	0x69,0x73,0x01,0xA9,0xF6,0xF7,0xCF,0x83,0x3E,0x1A,0xA4,
+	0xBA,0x73,0x6A,0x8B,0x2D,0x29,0x3B,0x0B,0xBE,0x23,0xA9,
+	0xE8,0x27,0x3D,0xA8,0x76,0x94,0x5A,0x9A,0x3C,0x5F,0xDF,
+	0xF6,0x3A,0x68,0x0A,0xFD,0xB5,0xF4,0x25,0x50,0xEF,0xAD,
+	0x99,0xD8,0xF5,0xCD,0xCB,0xE7,0x99,0x63,0x7B,0x46,0x41,
+	0x1C,0x46,0x85,0x62,0x27,0x8D,0xB8,0x8A,0xEE,0xC6,0x6E,
+	0x3A,0x17,0x48,0xE1,0x10,0x0B,0xE3,0x93,0x03,0x94,0x71,
+	0xB7,0xD3,0x3F,0xEC,0xF3,0x74,0x0B,0x77,0x1F,0x87,0xCF,
+	0x7C,0x22,0x3F,0xF9,0x41,0xFB,0xCB,0x55,0x79,0x27,0x7E,
+	0x00,0xC6,0xBC,0x53,0xE0,0x57,0x11,0x24,0x91,0x03,0xAE,
+	0xB5,0xB5,0x0B,0x46,0x27,0xAD,0x9F,0xC6,0x8B,0xCD,0x9A,
+	0xC2,0x70,0x76,0xAD,0xAA,0x58,0x99,0xDC,0x6D,0xDE,0x63,
+	0x5F,0xCD,0x1A,0x61,0xB3,0xC9,0x67,0x04,0xE6,0xA2,0xF7,
+	0xFC,0x43,0xF5,0xF9,0x2B,0x53,0xEC,0x7F,0x6F,0x56,0xA7,
+	0x8E,0xAB,0x65,0x28,0xB2,0x13,0xBC,0x75,0x84,0x0F,0xCA,
+	0x42,0xD1,0x2F,0x2B,0xEE,0xF4,0x1D,0x53,0x39,0x4B,0x9E,
+	0xC1,0xC1,0x56,0x6F,0x7F,0xDF,0x7C,0xED,0x4F,0xF8,0x3E,
+	0xC6,0xFC,0xC0,0xE5,0x65,0xA4,0x44,0x35,0xE1,0xC0,0x70,
+	0x2E,0x18,0x69,0x64,0x1E,0x12,0x12,0x2E,0x37,0xF1,0xB1,
+	0xDA,0x60,0x70,0xF9,0xA4,0x03,0x91,0x26,0xE1,0x82,0xF1,
+	0x99,0x07,0x45,0x6D,0x39,0xF8,0x72,0x61,0x11,0x90,0xD4,
+	0xC5,0x18,0xA2,0x5C,0x12,0x2A,0x29,0x47,0x2C,0xE3,0xBF,
+	0xCC,0x03,0xE1,0xE4,0xC5,0x4D,0xD6,0x5C,0xC1,0xBE,0x7B,
+	0xEE,0xF8,0xD2,0xFB,0x38,0xE6,0xE3,0x57,0xA3,0xA3,0x7E,
+	0x05,0x67,0x24,0x39,0x47,0x45,0x3C,0x9C,0x50,0xDD,0xE9,
+	0xB5,0x3A,0x1A,0xFC,0xE0,0xC0,0xAB,0xE7,0x5A,0x8F,0x3E,
+	0x15,0x22,0x00,0x7F,0xF8,0x7B,0x0B,0x0D,0x65,0xFC,0x81,
+	0x5E,0x39,0xC0,0x21,0x70,0xE0,0x87,0x23,0x58,0x37,0x18,
+	0x39,0xD6,0x79,0xCC,0xBE,0x31,0x3B,0xE8,0xE1,0xB9,0xE7,
+	0x0F,0x73,0x09,0x10,0x4B,0x51,0x12,0xEB,0x24,0x70,0x0D,
+	0xF1,0xE2,0x5E,0x02,0xB8,0x6D,0x71,0x7C,0x38,0xE3,0xC8,
+	0x0A,0x43,0x3E,0xCE,0x14,0xFD,0x57,0xEA,0x9D,0xEE,0x6F,
+	0x3D,0xAE,0x97,0x25,0xE1,0x63,0x1E,0xB1,0x08,0x81,0x93,
+	0xB7,0xEC,0x46,0x3A,0x60,0x1D,0x30,0xD9,0x52,0x04,0x90,
+	0x21,0x32,0x19,0xC0,0x1D,0xFD,0x4A,0x83,0x3C,0x50,0x74,
+	0x58,0x61,0x5C,0x6C,0xF8,0x79,0xBD,0x4B,0x88,0x58,0x9B,
+	0xFF,0x1D,0xF9,0x4D,0x0A,0xA0,0x59,0xE3,0x18,0x2D,0x96,
+	0x5F,0xFF,0x08,0x52,0x95,0x5B,0x2D,0x1C,0xDD,0xF8,0x91,
+	0x93,0xAB,0x9E,0x4F,0xC8,0x59,0x6F,0x83,0x50,0xED,0xF1,
+	0xBE,0x1A,0xD2,0x1E,0xF8,0x0B,0x5A,0x4E,0x0F,0xBE,0xC5,
+	0x6C,0xFB,0x8F,0x93,0x07,0xB6,0x67,0xD2,0x47,0xFF,0x20,
+	0x1A,0x24,0xD6,0x3B,0x27,0x24,0x00,0x73,0xFD,0xDD,0x21,
+	0x76,0x29,0x64,0xD4,0x83,0x38,0x97,0x4B,0xE2,0x5F,0x0B,
+	0xD5,0x46,0xD8,0x84,0x8D,0xC9,0x71,0x99,0xFF,0x6C,0x73,
+	0x6F,0x36,0xBA,0x6A,0xAC,0x2A,0xE2,0x27,0xD3,0x8C,0x50,
+	0x2E,0x98,0x7A,0xF9,0xBD,0x68,0x87,0x2C,0x79,0xD3,0x30,
+	0x84,0xE7,0x91,0x91,0x57,0x3B,0x0B,0x1A,0x98,0x02,0x12,
+	0xC9,0x16,0x2D,0x19,0x2B,0x81,0xDA,0x5E,0x68,0x92,0x61,
+	0x8B,0xE5,0xCB,0xAA,0x85,0x22,0xBA,0x15,0xEA,0x9D,0x41,
+	0x00,0xD7,0x17,0x9C,0x22,0x3C,0x42,0x3F,0xE4,0xE5,0x52,
+	0x94,0xD9,0xB2,0xF2,0xDE,0xCC,0x82,0xD1,0x77,0xF9,0x29,
+	0xF3,0x35,0x32,0x4C,0xB4,0x51,0x8F,0xD6,0xA9,0xAE,0x75,
+	0x46,0xC7,0x31,0x2F,0x51,0x92,0x63,0x9E,0x8B,0x8A,0x78,
+	0xBE,0x0C,0x0C,0x19,0x80,0xFA,0x6F,0x98,0x5E,0x3F,0x95,
+	0xB4,0xDB,0x4A,0x2F,0x82,0x16,0xFE,0x4B,0xCE,0x3A,0x46,
+	0xAE,0xD1,0xC4,0xB8,0x03,0xED,0xB3,0x8F,0xE1,0xCC,0x33,
+	0xEC,0x41,0x30,0x02,0x3C,0x84,0x9C,0x2B,0x62,0xC7,0x79,
+	0xCA,0x72,0x56,0x69,0x06,0x4D,0x05,0x9E,0x2B,0x18,0x61,
+	0x5E,0x46,0xAC,0x8E,0x75,0xF2,0x75,0x4D,0x5A,0x90,0x9C,
+	0x99,0x02,0x8A,0x49,0x29,0x01,0x02,0x95,0xBE,0x0E,0x2E,
+	0xB3,0xB9,0x10,0xFF,0xF5,0x91,0x98,0xFE,0xB8,0x2D,0xA6,
+	0x00,0xBB,0x93,0x22,0x47,0xFC,0x61,0x14,0x09,0x17,0xBB,
+	0xBF,0xD5,0xB5,0x5C,0xB5,0xD9,0x55,0x13,0xE1,0x1D,0xC2,
+	0x46,0x31,0x3F,0xD7,0x33,0x6F,0xFC,0x95,0xA4,0xF2,0xB4,
+	0x66,0xB4,0x7F,0xED,0xEA,0x98,0xEB,0xE2,0x9A,0x80,0xA0,
+	0xA2,0x15,0x16,0x2A,0x09,0x55,0xDB,0x5D,0x87,0x4C,0x09,
+	0x40,0xCD,0x77,0xB4,0xBF,0x48,0x4D,0xEB,0x22,0x70,0x73,
+	0x1A,0xFE,0x95,0xBC,0x1C,0x73,0xA2,0x61,0xAE,0x76,0xAC,
+	0xBE,0xE5,0x2A,0xB4,0xD6,0x3D,0xBA,0xC5,0xED,0x86,0x46,
+	0x73,0xD9,0x56,0x77,0x08,0xF3,0x14,0x00,0xF2,0xE2,0xB4,
+	0x95,0xDA,0x56,0x82,0x44,0xE1,0x58,0x8E,0xFB,0xE7,0xCA,
+	0xE0,0xA7,0x99,0xCB,0xC7,0x1C,0xFB,0xA3,0x3A,0x6C,0x2B,
+	0xEB,0xE6,0x15,0x9B,0xEA,0xD1,0x8C,0xFE,0x4F,0x0A,0xD9,
+	0x55,0xBD,0xC1,0x97,0xD4,0xF9,0xAF,0x5D,0x0C,0xD4,0x03,
+	0x7B,0x14,0x1E,0x9E,0x28,0x8D,0x38,0xAA,0x8A,0x0E,0xFC,
+	0x0E,0xAB,0xBC,0x29,0x50,0x77,0x29,0xF9,0x04,0xC7,0xC2,
+	0x13,0xDC,0xD5,0x61,0x87,0x90,0x47,0x35,0x85,0x7D,0x24,
+	0xAB,0x3A,0x4F,0xA9,0x36,0xFD,0x46,0x41,0x34,0x6F,0xA7,
+	0xAF,0x91,0x1E,0x78,0xD6,0x2D,0x6C,0xC6,0xE6,0x5D,0xB5,
+	0xA1,0x31,0x2A,0xBB,0xA2,0x78,0xCF,0x7C,0x8D,0x93,0xF6,
+	0xB7,0x95,0xE2,0xD8,0x7C,0x4D,0x53,0x50,0x5E,0x28,0x7D,
+	0x35,0xF9,0xC8,0x34,0x90,0x93,0x9E,0x6D,0xF6,0x2F,0x5B,
+	0x08,0x47,0x27,0x70,0x4A,0x8A,0xB4,0x69,0x34,0x70,0x40,
+	0xEA,0x8F,0x15,0x97,0x59,0xDF,0xCC,0x39,0xBE,0xE7,0x07,
+	0x8C,0xF9,0x3E,0x3E,0xCF,0x38,0x9E,0xAC,0x43,0xFA,0xBB,
+	0x58,0x27,0xDB,0x38,0xE0,0x0C,0x12,0xBA,0x63,0x1E,0xAC,
+	0x7A,0x3F,0xFD,0xE8,0xDF,0xA9,0x2A,0x38,0x85,0x0C,0xA7,
+	0x8D,0x27,0xB8,0x06,0xD0,0x85,0x15,0x90,0x02,0x4E,0xFF,
+	0xCD,0x13,0x61,0xB8,0x97,0xD0,0xE3,0x00,0xDA,0x4D,0xD6,
+	0x57,0x05,0x8F,0xB8,0x2B,0x0A,0xD7,0x39,0x59,0x5F,0x42,
+	0x24,0x17,0x59,0xAB,0x90,0xA3,0x0E,0x61,0x9E,0x56,0xBD,
+	0x85,0xA8,0x65,0xDA,0xAF,0xB1,0xA1,0xF8,0xF5,0x02,0x95,
+	0xB6,0x27,0x13,0x05,0x00,0x96,0x09,0x25,0xCA,0xE8,0xA5,
+	0x99,0xB5,0xDF,0xF6,0xC6,0xAA,0x26,0xB1,0x4A,0xF5,0xEC,
+	0xF7,0xE2,0xEE,0xB0,0x55,0x0E,0x48,0x6C,0x70,0xA5,0x94,
+	0x60,0xCF,0x69,0x77,0x02,0xFB,0x3D,0x0B,0xEA,0xE3,0xED,
+	0x68,0x6B,0x57,0x8C,0xAF,0xCF,0xA5,0xBC,0xF3,0x2F,0x96,
+	0x11,0xA6,0xE8,0xFA,0x45,0xBE,0x53,0x5F,0xB0,0x9A,0xCE,
+	0x1A,0x50,0x29,0x4A,0xBF,0xB9,0xC9,0xE4,0xED,0xF1,0xAE,
+	0x39,0xF0,0x2A,0x5E,0x7F,0xDD,0x96,0x73,0xEB,0xC2,0x98,
+	0xBD,0x10,0x77,0x0B,0xDE,0xDF,0xCA,0x07,0xB9,0x93,0x02,
+	0xE4,0x7B,0xF4,0xD5,0x5F,0x00,0x1E,0x0F,0xE4,0xBB,0x90,
+	0x9F,0x3B,0x6F,0x2F,0x60,0x25,0x5B,0x1A,0xE8,0x91,0xE3,
+	0x71,0x23,0xB3,0x19,0x94,0x12,0xA3,0x5C,0xE4,0xAF,0x5A,
+	0xAC,0x59,0xDC,0x54,0xFC,0x64,0x29,0x19,0x5E,0x26,0x7F,
+	0x5C,0x1C,0x0C,0x94,0x7D,0x37,0xA2,0xAF,0x28,0xF9,0x67,
+	0x01,0x08,0x1C,0x78,0x7F,0xF1,0xBF,0x81,0x11,0x30,0x03,
+	0x02,0x25,0xC2,0xC8,0x70,0x06,0x27,0x17,0xF1,0xFF,0xFF,
+	0x76,0xBC,0x7C,0x44,0x7E,0xB2,0x00,0x43,0x50,0x88,0x28,
+	0x4C,0x16,0x61,0x88,0x22,0x88,0x62,0x64,0x71,0x86,0x84,
+	0x24,0x11,0x49,0x96,0x62,0x48,0xCB,0x10,0x65,0xC9,0x28,
+	0x86,0x9C,0x3C,0x51,0x21,0x4E,0x71,0xEB,0x55,0x19,0xD0,
+	0x5B,0x66,0x63,0x44,0x85,0xBB,0x55,0x15,0xA8,0x46,0x54,
+	0x27,0x6B,0x30,0x34,0xD1,0x44,0x2D,0xB2,0x36,0x03,0xA3,
+	0x43,0xD4,0x25,0xEB,0x31,0xF4,0x0D,0x88,0x86,0x64,0x23,
+	0x86,0xB1,0x09,0xD1,0x94,0x6C,0xC6,0x30,0xB7,0x20,0x5A,
+	0x92,0x4F,0x30,0xAC,0xAC,0x89,0x36,0x64,0x2C,0xC3,0xD6,
+	0x8E,0x88,0x23,0xDB,0x33,0x1C,0x1C,0x89,0x4E,0x64,0x67,
+	0x86,0x8B,0x2B,0xD1,0x8D,0x8C,0x67,0x10,0x4E,0x12,0xDD,
+	0xC9,0x1E,0x0C,0x4F,0x2F,0xA2,0x37,0xD9,0x87,0xE1,0x4B,
+	0x24,0xFA,0x91,0xFD,0x19,0x01,0x81,0xC4,0x20,0x72,0x30,
+	0x23,0x84,0x44,0x0C,0x25,0x87,0x31,0xC2,0xC9,0xC4,0x08,
+	0x72,0x24,0x83,0x12,0x45,0x8C,0x26,0xC7,0x30,0x62,0xE3,
+	0x88,0xF1,0xE4,0x04,0x46,0xE2,0x29,0x62,0x12,0x99,0xCA,
+	0xA0,0xD1,0x89,0xC9,0xE4,0x14,0x46,0x6A,0x1A,0xF1,0x34,
+	0x39,0x9D,0x71,0xE6,0x2C,0xF1,0x1C,0x39,0x83,0x91,0x99,
+	0x45,0xCC,0x26,0xE7,0x30,0x72,0xF3,0x88,0xF9,0xE4,0xF3,
+	0x8C,0x82,0x42,0x62,0x11,0xB9,0x98,0x51,0x52,0x4A,0x2C,
+	0x23,0x5F,0x60,0x5C,0xBC,0x44,0xBC,0x4C,0xBE,0xC2,0xB8,
+	0x7A,0x8D,0xC8,0x20,0x5F,0x67,0x94,0xDF,0x20,0xDE,0x24,
+	0x57,0x30,0x6E,0xDD,0x26,0xDE,0x21,0xDF,0x65,0x54,0x56,
+	0x11,0xAB,0xC9,0x35,0x8C,0x7B,0xF7,0x89,0x0F,0xC8,0x0F,
+	0x19,0xB5,0x8F,0x88,0x8F,0xC9,0x4F,0x18,0x75,0xF5,0xC4,
+	0xA7,0xE4,0x67,0x8C,0x86,0x46,0x62,0x13,0xF9,0x39,0xA3,
+	0xB9,0x85,0xD8,0x4A,0x6E,0x63,0xB4,0x77,0x10,0x3B,0xC9,
+	0x5D,0x8C,0x17,0xDD,0xC4,0x97,0xE4,0x1E,0x46,0x6F,0x1F,
+	0xB1,0x9F,0x3C,0xC0,0x78,0xF5,0x9A,0x38,0x48,0x1E,0x62,
+	0xBC,0x79,0x4B,0x1C,0x26,0xBF,0x63,0xBC,0x1F,0x21,0x7E,
+	0x20,0x7F,0x64,0x8C,0x8E,0x11,0x3F,0x91,0xC7,0x19,0x9F,
+	0xBF,0x10,0x27,0xC8,0x93,0x8C,0xA9,0x69,0xE2,0x0C,0x79,
+	0x96,0x31,0x37,0x4F,0xFC,0x4A,0x5E,0x60,0x2C,0x2E,0x11,
+	0x97,0xC9,0xDF,0x18,0xDF,0xFF,0x23,0xAE,0x90,0xFF,0x57,
+	0xF9,0xAB,0xC4,0x35,0x32,0x8B,0xB1,0xBE,0x41,0xFC,0x49,
+	0xFE,0xC5,0xD8,0xFC,0x4D,0xDC,0x22,0xFF,0x61,0x6C,0xEF,
+	0x10,0x77,0xC9,0x7B,0x8C,0xFD,0xBF,0xC4,0x03,0xF2,0x21,
+	0xE3,0xE8,0x1F,0xF1,0x98,0xCC,0xDE,0x55,0xA2,0x82,0x6E,
+	0x8B,0xCF,0xDF,0x96,0x51,0x26,0x71,0x6E,0xB4,0xAF,0x7C,
+	0x5B,0x6B,0x67,0x76,0xBD,0xEE,0xB2,0xFB,0x6C,0xAE,0xA0,
+	0xD5,0x76,0xD0,0x35,0x03,0x95,0xBF,0x72,0x7C,0x54,0x94,
+	0xFB,0xAF,0x4B,0x91,0x03,0x6C,0x08,0xCC,0xCC,0x00,0xCE,
+	0x24,0xF3,0x28,0x91,0x9E,0x04,0x91,0xBE,0x42,0xAE,0x0D,
+	0x05,0xB5,0xD6,0xA9,0x1B,0x1A,0x26,0x23,0x74,0xAB,0x5B,
+	0xAB,0xAE,0x8E,0xEA,0xE3,0xFA,0x9F,0xE6,0x1E,0xC1,0x0A,
+	0x5E,0x15,0xF9,0x70,0x48,0x8E,0x16,0x24,0x58,0xED,0xBE,
+	0x62,0xD3,0x98,0x3C,0x59,0x96,0x5F,0x1F,0xDF,0x03,0xD1,
+	0xBA,0xF8,0xCA,0x41,0xBF,0x56,0x0B,0xFE,0xD0,0x22,0x13,
+	0x64,0x14,0xF5,0xF8,0xBE,0xD1,0xE0,0x2A,0xA1,0xC0,0xD7,
+	0x9B,0xF1,0x21,0xFB,0x27,0xEF,0x7B,0x08,0x5D,0xC9,0x04,
+	0x35,0x58,0xA7,0xFA,0x34,0xE1,0xAD,0x02,0x5F,0xD8,0x7C,
+	0xB2,0x58,0xDB,0x59,0xB3,0x80,0x10,0x1A,0x75,0xEF,0x8C,
+	0xFE,0xB4,0x29,0x59,0x4C,0x32,0xCB,0x3A,0x79,0xCD,0xED,
+	0x4F,0x6D,0x5B,0x22,0x3E,0xB9,0xD0,0xE2,0x03,0xF5,0x01,
+	0xFE,0xA4,0x86,0xD6,0x43,0xF3,0x4C,0x14,0xC5,0x83,0x24,
+	0x67,0x48,0xD1,0x4E,0x97,0xA1,0xA8,0x4D,0x74,0x37,0xBF,
+	0x93,0x18,0x44,0x89,0xEC,0x42,0xF7,0xC6,0x5E,0xD6,0x2F,
+	0x19,0x27,0x18,0xDE,0xC3,0xB3,0x5A,0xDE,0x21,0x77,0x61,
+	0x35,0x7C,0xB3,0x2C,0xB8,0x8B,0xDF,0xE9,0x5F,0x4E,0x26,
+	0x7F,0x93,0xF8,0xED,0xB5,0x03,0xFF,0xD8,0x6E,0x17,0x81,
+	0xF2,0x4F,0xBB,0xBB,0x6C,0x98,0xF1,0xC9,0x66,0xA5,0xCC,
+	0x9C,0xA3,0x81,0x59,0x15,0x85,0x1B,0x5C,0xAC,0x9D,0xE9,
+	0x90,0x4F,0xD0,0x07,0x0C,0x26,0xC7,0x2A,0x2D,0x56,0x8C,
+	0x75,0x4B,0x4F,0x53,0xB0,0xDA,0x6B,0x3A,0x60,0x77,0x4D,
+	0xBF,0xAD,0x1E,0x5E,0x7C,0x2C,0xC2,0xB1,0x65,0xD2,0x9F,
+	0x82,0x9D,0x70,0x31,0x9B,0x07,0x8A,0xF0,0xA0,0x0C,0xB4,
+	0x5A,0x7B,0xC1,0x42,0xD8,0x93,0x91,0x6F,0xE9,0xDD,0xA2,
+	0x97,0xBF,0x20,0x39,0x6D,0x14,0x16,0xFC,0xE9,0x7F,0xD6,
+	0x59,0x04,0x16,0x81,0x4F,0xD5,0xCA,0x44,0xD8,0x6C,0x40,
+	0xE8,0x5E,0xCF,0x5E,0x72,0xDB,0xD0,0x06,0x73,0xFF,0x35,
+	0xFD,0x8A,0xD9,0x94,0x3F,0x95,0xB3,0xF4,0x06,0x9F,0x3E,
+	0x04,0xC7,0xD7,0xDC,0x67,0xDC,0x32,0xF3,0x65,0x87,0xBD,
+	0xC1,0x69,0x47,0x6A,0x25,0xAF,0x2F,0xD2,0x4D,0xBB,0x02,
+	0x6B,0xCA,0xA0,0xFE,0x9D,0x3A,0xC5,0xBB,0xD4,0x68,0x98,
+	0x72,0x4F,0xCE,0xF1,0x8E,0x6D,0xA5,0xCD,0x4C,0xBE,0xB2,
+	0x65,0x33,0xF6,0x3F,0x48,0xAC,0x96,0x8D,0x66,0xD7,0x6F,
+	0xAD,0x01,0xB5,0x4D,0xC8,0xBE,0x08,0x4D,0xD7,0x46,0xE8,
+	0x5D,0xDE,0x1F,0xB1,0xDB,0xB9,0x89,0x57,0x09,0xFD,0xCB,
+	0xA4,0x70,0x75,0x52,0x2B,0xE0,0x58,0xF0,0xE3,0x8C,0x49,
+	0x8D,0x5F,0x75,0xC2,0x67,0xBE,0xFD,0x2E,0xCC,0xEE,0xDB,
+	0x52,0x3B,0x20,0xEE,0x98,0x87,0x2E,0x52,0xB3,0xD6,0x05,
+	0x30,0xC1,0x0E,0xA0,0xBC,0x69,0xAF,0x9C,0xBC,0x2D,0x06,
+	0xEC,0xC3,0xFC,0xA5,0xF9,0x94,0xA1,0x73,0x7D,0xB8,0xC6,
+	0x74,0xAC,0x11,0x74,0x87,0x35,0x0E,0x4E,0x18,0xBD,0x79,
+	0xCC,0x3A,0xBC,0xCF,0xD4,0x85,0x56,0xD9,0x04,0x86,0xC3,
+	0xBF,0x56,0xED,0x43,0x21,0x5F,0xBC,0x28,0xEF,0x7D,0x06,
+	0xBD,0x81,0xB3,0x1F,0xD3,0x38,0xBF,0xED,0x6F,0x9E,0x6F,
+	0xB3,0xBF,0x5B,0xCB,0x99,0x9B,0x8C,0xF9,0x71,0xF7,0xC2,
+	0x07,0xE6,0xAA,0x3E,0x40,0x16,0x3F,0x96,0xC5,0x1E,0x3A,
+	0xEA,0x52,0xEB,0x6B,0xE0,0xB0,0xDE,0xB2,0xF7,0x91,0x81,
+	0x55,0x9E,0x76,0xED,0x68,0x29,0x6E,0x95,0xEF,0x11,0xDF,
+	0xA8,0x39,0x00,0x4A,0xBE,0x9A,0x58,0x96,0x74,0xB0,0x15,
+	0x11,0xB3,0x49,0xC6,0x5A,0x1C,0x83,0x0F,0x2C,0x2D,0xFE,
+	0xB1,0x1F,0xB9,0x64,0x7C,0x60,0xAF,0x3E,0x05,0x58,0xB4,
+	0x1E,0x71,0x29,0x5E,0xEF,0x62,0x77,0x56,0xDF,0x2D,0x6D,
+	0x8C,0x3B,0xAC,0x6A,0x82,0x1F,0xBD,0x5B,0x2C,0xC7,0xD5,
+	0xCE,0x40,0xED,0xAA,0x25,0x5E,0x5A,0xF2,0xAE,0xE6,0x29,
+	0xC4,0x78,0xF2,0x79,0x3C,0x2A,0x88,0x96,0xF1,0x1A,0x89,
+	0xBF,0xD3,0x1C,0x06,0x02,0xBF,0xA4,0x02,0xF5,0xD8,0x79,
+	0x0B,0x56,0xC0,0xE2,0x3D,0x59,0xE9,0xE8,0x83,0x44,0xAE,
+	0x8C,0x17,0x44,0x26,0x95,0xDD,0x5A,0xB6,0x93,0xA3,0x1C,
+	0xF4,0x1C,0x6A,0x87,0xD0,0xDB,0x28,0x1B,0xE4,0xBF,0x7E,
+	0x42,0x48,0xD9,0x35,0x56,0xD9,0xD5,0x61,0xD7,0xE3,0x73,
+	0xA2,0x3E,0x1B,0xDB,0x98,0xBA,0x62,0x6C,0x59,0xEA,0x9E,
+	0xEE,0x19,0x9C,0x4C,0xEE,0xBA,0xF7,0x78,0xF6,0x72,0x27,
+	0xC4,0xCE,0xDB,0xBD,0xE6,0x81,0x95,0x96,0x05,0xEE,0xDF,
+	0x52,0x78,0xF7,0x97,0xFF,0x02,0x65,0x47,0x3E,0xCD,0x73,
+	0x5E,0x60,0x5B,0x64,0x65,0x27,0xC1,0x2D,0x6E,0x1E,0x65,
+	0xA7,0x80,0xD0,0x72,0x00,0xC1,0x56,0xB5,0x7B,0x0D,0xBF,
+	0xC5,0x56,0x7D,0x1D,0xEB,0xB7,0x6F,0x02,0x08,0x1C,0x6F,
+	0xFE,0x74,0xAA,0x9C,0x46,0x3F,0x66,0x9E,0x61,0x96,0x44,
+	0xF2,0x1C,0xB6,0xBE,0x9E,0x98,0x57,0x6E,0x3A,0xB4,0x8A,
+	0x7B,0x65,0x21,0xDA,0xA5,0xC7,0xAC,0xE5,0x94,0xE1,0xA4,
+	0xAF,0x6A,0x0D,0x21,0x9C,0x5E,0x7F,0x1B,0x8B,0x59,0xB0,
+	0x5B,0xB0,0xA6,0x4D,0xB7,0x5F,0x76,0xE6,0xAE,0xDE,0x86,
+	0xAF,0xBC,0x1E,0x89,0x67,0x10,0x57,0x01,0x08,0xA1,0xE4,
+	0x4C,0x86,0xA7,0xC6,0x04,0x04,0xDE,0x97,0x1A,0x68,0xD3,
+	0x6A,0xCD,0x85,0xB8,0x69,0x0E,0x9C,0xDF,0xC2,0x9D,0xB3,
+	0xEB,0x8D,0xCE,0x53,0xDB,0x3C,0x64,0xEA,0xAC,0x82,0xBE,
+	0x64,0x9C,0x2B,0x76,0x3B,0xA7,0xF6,0xD7,0x6C,0xC7,0x2D,
+	0x35,0x59,0xD0,0x75,0x6D,0xA9,0xE8,0x4F,0xD7,0x2D,0x81,
+	0x6D,0x8F,0xFD,0x53,0x2C,0xFF,0x52,0x91,0x56,0xD4,0xC1,
+	0x64,0x1B,0xF8,0x1D,0xC7,0xF1,0x47,0xE6,0x30,0x33,0xF3,
+	0x2C,0x7B,0x2A,0x05,0x3C,0xA7,0x1C,0x60,0xEF,0xC7,0x98,
+	0x25,0x6E,0xD9,0xC6,0x17,0xD7,0xCD,0x3E,0x67,0xF2,0x9C,
+	0x1E,0x2B,0xF5,0x56,0xFD,0x1E,0x28,0x3B,0x0E,0x2E,0x6D,
+	0xA7,0x23,0xAD,0x8E,0x1A,0x0E,0x5A,0xB6,0xB6,0x0E,0x42,
+	0xE7,0xF5,0xCE,0x9D,0x6B,0x28,0x32,0xEB,0x4E,0xB0,0x5F,
+	0x8D,0xD5,0x6D,0x07,0x9E,0xE2,0x4E,0x1C,0xEF,0x6C,0x07,
+	0x7C,0x00,0x9C,0x6C,0xCA,0xC0,0xBD,0x7F,0xD2,0x50,0x3D,
+	0x6A,0xA9,0x4E,0xC8,0xDB,0x2A,0x92,0x8D,0x6E,0x79,0x3B,
+	0xE6,0xF9,0xE4,0x7C,0x69,0xB7,0xC9,0x9B,0xA4,0x60,0xFA,
+	0xA5,0x85,0xC7,0x0A,0xC1,0x97,0xB9,0x72,0xFE,0x42,0x81,
+	0xA7,0x0A,0x94,0x40,0xDE,0x82,0x07,0x29,0x4E,0xC5,0x5E,
+	0xC1,0x17,0x03,0xA1,0x26,0x63,0x8B,0xC9,0x27,0x0B,0x19,
+	0x61,0x02,0xD7,0x8C,0xA7,0x45,0x5C,0x0B,0xCF,0xA9,0xBD,
+	0x61,0xDB,0xF1,0xBC,0x7C,0x49,0x2C,0xBD,0xF0,0x84,0xC3,
+	0xC8,0xB3,0x7F,0x61,0xE6,0x75,0xC6,0x02,0x9B,0xBF,0xF0,
+	0x0C,0x30,0xC6,0x3A,0x9A,0x10,0x83,0xBD,0x64,0x7F,0x87,
+	0x57,0x70,0x31,0x93,0x9F,0x23,0x55,0x3C,0xA8,0x74,0xA2,
+	0xFB,0x98,0x9E,0xF8,0xE3,0x5E,0xD3,0xAC,0x8F,0x88,0x60,
+	0x82,0x7B,0xAD,0xC9,0x68,0x6B,0xB2,0x4C,0x3F,0xFA,0xCF,
+	0x21,0xD8,0xE4,0x0F,0xBD,0x52,0xB1,0x22,0x80,0xEB,0xB4,
+	0xCA,0xD7,0x1F,0x6C,0x57,0xBE,0x56,0x10,0x70,0xC5,0xCF,
+	0xB7,0xD5,0xE9,0x4C,0xAB,0x61,0x53,0x6D,0xDF,0x1E,0x03,
+	0x3E,0xC6,0x7A,0x32,0xFA,0x5A,0xB2,0x6F,0x29,0xD4,0x09,
+	0x92,0x77,0x63,0xF3,0x27,0x70,0x17,0xDC,0x22,0xB1,0x53,
+	0x09,0x35,0xF8,0xE1,0x02,0x01,0x06,0x05,0x8C,0xEF,0xC2,
+	0x4A,0x43,0xFE,0xC5,0x83,0xC4,0x0A,0x45,0xCC,0xEA,0x07,
+	0x14,0x43,0x9D,0xA6,0xEF,0x04,0x93,0x03,0x13,0xE1,0xA2,
+	0x01,0x3F,0x43,0x5B,0xF6,0x0F,0x8A,0xC1,0x20,0x51,0x05,
+	0xB6,0x2D,0xF0,0xEE,0xB6,0x05,0x08,0x92,0x81,0x84,0x98,
+	0xF9,0x9C,0xC3,0x64,0x40,0x1F,0x45,0x06,0xF2,0xB3,0x37,
+	0xF1,0x3C,0x66,0x29,0x9D,0x22,0x70,0x33,0xC4,0x9B,0xE4,
+	0x09,0x51,0x70,0x87,0xD0,0x73,0x2E,0xAE,0x7E,0x2E,0xCB,
+	0xC6,0xBC,0x88,0x4F,0x95,0x06,0xB5,0x55,0x31,0xDA,0x8B,
+	0x5F,0xD1,0x52,0xEE,0x15,0x6D,0x7A,0xC0,0x94,0x8E,0xBB,
+	0x2B,0x93,0x7C,0xE5,0xBA,0x86,0x69,0x7C,0x8C,0x17,0x56,
+	0xDF,0x93,0xF1,0xAE,0x3C,0xC1,0xD9,0x07,0x80,0x98,0xE1,
+	0x23,0x2B,0x67,0x96,0xA2,0xC7,0x55,0xD5,0xFB,0xCE,0x6D,
+	0xCB,0x5C,0xC9,0x84,0x57,0xC5,0x52,0x88,0x6B,0x7B,0xB0,
+	0x5A,0x8E,0x89,0xB0,0x10,0x76,0xC3,0x0E,0x4C,0xD1,0x5F,
+	0xD5,0x69,0x8A,0xCE,0xC2,0xBE,0x0C,0xD0,0x65,0x81,0xBE,
+	0xBD,0xB9,0x0D,0x9D,0x53,0xF9,0xA2,0x6B,0xF0,0xEB,0x16,
+	0xF7,0x5B,0x4A,0xAE,0x6F,0x8E,0x90,0x2F,0x5D,0x00,0x99,
+	0x58,0xB0,0x7A,0x5F,0xFA,0xAD,0x34,0xF5,0x49,0x98,0x99,
+	0xC8,0x02,0x6B,0x70,0xC7,0x4E,0x55,0x6D,0x9D,0x14,0xF0,
+	0x80,0x7A,0x06,0xD8,0x76,0x7F,0x55,0xB2,0x97,0xED,0x11,
+	0xE3,0x24,0x45,0x93,0xB9,0xD7,0xEC,0xC7,0xB6,0xFA,0xF0,
+	0x0B,0x97,0x07,0x0B,0x3D,0xEB,0xF9,0x7B,0x43,0x49,0xA3,
+	0x35,0x2F,0xDF,0x62,0x51,0xD3,0x3F,0xD7,0x7C,0xA3,0xF4,
+	0x8C,0x40,0x35,0xD8,0x99,0x3D,0xF4,0xD8,0x76,0x62,0x1B,
+	0xFC,0x71,0x6B,0xD7,0x58,0x9E,0x25,0x7E,0xC6,0x37,0xEC,
+	0x8C,0x5A,0x32,0x0B,0x01,0xF9,0xB9,0x59,0x38,0xE4,0x64,
+	0x54,0x6F,0x40,0x39,0x47,0x40,0x62,0x4C,0x2D,0x2B,0x7B,
+	0x7F,0xC5,0xB2,0x7A,0x3C,0xAA,0x28,0x5C,0xAA,0xFF,0xA5,
+	0xD5,0x7F,0x09,0x69,0x13,0x5A,0xE5,0x98,0x02,0xB9,0x73,
+	0x0C,0x25,0x63,0xF0,0x41,0x2D,0x3C,0xA9,0x73,0x2A,0x08,
+	0x8E,0xEA,0x63,0xB9,0x6F,0x55,0xA0,0xE1,0xCC,0x96,0x2F,
+	0x54,0x9B,0x09,0x1D,0xA6,0xEA,0xF5,0x39,0xAD,0x24,0x05,
+	0x03,0x13,0xB1,0x06,0x09,0x19,0xFF,0xA1,0xD5,0x5F,0x55,
+	0xD5,0x78,0x69,0x8A,0x5A,0xEA,0x6F,0x31,0xC9,0x84,0xC9,
+	0x5A,0xFB,0x5F,0x6A,0xFD,0xCB,0xAC,0x59,0x0F,0xCD,0x77,
+	0x29,0x55,0x75,0xB1,0x7D,0x9C,0xF5,0xE0,0x90,0xAC,0x63,
+	0xB2,0x6D,0x99,0xC5,0x6A,0x5C,0xB3,0x77,0x74,0xD4,0x8F,
+	0x59,0x71,0xEC,0xA6,0x84,0x2D,0x28,0x6E,0xDA,0x6C,0x0C,
+	0x44,0x95,0xFA,0xC1,0x09,0x4E,0x0C,0x07,0x6F,0x27,0x7F,
+	0x06,0x34,0x22,0xF7,0xD5,0xEB,0xCD,0xBE,0x26,0xBF,0x75,
+	0x17,0x2A,0x88,0xB1,0xB0,0x2F,0x4A,0x9D,0x4A,0xE9,0xA6,
+	0x29,0x2D,0x99,0x2B,0x9F,0x82,0xE6,0x34,0xDC,0x04,0x3C,
+	0x15,0xE0,0x6C,0x75,0xAB,0x2F,0x9D,0xD8,0x7B,0xBB,0x6F,
+	0x32,0x44,0xC7,0x72,0x3C,0x22,0x01,0x9D,0x73,0x47,0x9D,
+	0x61,0x36,0x92,0x39,0x9C,0x7E,0x4E,0xBF,0xB8,0x79,0x38,
+	0x0A,0xC1,0xFF,0x0D,0xD9,0x73,0x71,0xF4,0x68,0xB3,0xED,
+	0x79,0x98,0x77,0xB2,0xF6,0x6D,0x37,0x92,0x3E,0x2E,0xFD,
+	0x49,0x86,0x44,0x2C,0x35,0xC2,0x60,0x26,0x9B,0xBD,0xD4,
+	0x86,0xA7,0x7F,0x31,0xA3,0x16,0x52,0xD1,0x2F,0x95,0x1E,
+	0x52,0x0C,0x09,0xD8,0xC4,0x5D,0xD6,0xD5,0x21,0xCF,0xA7,
+	0x90,0xD4,0x57,0xAC,0x86,0xDE,0x5B,0x43,0xFA,0x34,0x3F,
+	0x3E,0xE5,0xD5,0x79,0x55,0xEB,0x4A,0xEA,0xCD,0xAD,0x81,
+	0xF8,0x19,0x0D,0xC4,0x98,0xB4,0x06,0x5D,0xF0,0xEC,0xD8,
+	0x01,0xC7,0x44,0xF0,0x1C,0x08,0x61,0xD5,0xBB,0x6F,0xD1,
+	0xBD,0x50,0xAC,0xD2,0x16,0x68,0xC1,0x1C,0x93,0xDA,0x77,
+	0x6D,0x08,0xCC,0xD9,0x5B,0xDE,0xA3,0x89,0xC9,0xB4,0x5B,
+	0x48,0xA7,0x14,0x36,0xCB,0xC8,0x03,0xCF,0x56,0xE9,0xE6,
+	0xD8,0x6B,0x3F,0xAB,0xDE,0x53,0x64,0x1E,0x6B,0x96,0x06,
+	0x7D,0xEE,0x1C,0x15,0xD7,0x14,0x06,0xB9,0x09,0x2F,0xBE,
+	0x74,0x1B,0xAF,0x92,0xAF,0xDC,0xD5,0x13,0xB9,0x09,0x5C,
+	0x00,0x21,0xEC,0x5C,0xAD,0x37,0x01,0x3E,0x4E,0x76,0x60,
+	0xA7,0x17,0x53,0xC0,0x63,0x55,0xE6,0xA5,0x23,0xD1,0x9B,
+	0xC0,0xBF,0xC3,0x5C,0x35,0x19,0xBD,0x4D,0x75,0x37,0xBF,
+	0x47,0x7F,0x33,0xC9,0x86,0x4E,0x06,0xA5,0x16,0x0E,0xA3,
+	0x0B,0x2A,0xCF,0x99,0x85,0xD1,0x65,0xF2,0x98,0x96,0x2E,
+	0x4B,0x33,0x77,0x79,0xD0,0x77,0xDA,0xF6,0xBD,0x52,0xD9,
+	0x99,0x63,0x68,0xD5,0xD9,0x76,0x4E,0x93,0x8B,0x3F,0x7F,
+	0xAE,0x1E,0xD6,0xE4,0x11,0x86,0xF6,0x62,0x4B,0xDD,0x42,
+	0xA0,0xFE,0xA1,0xB7,0xC3,0x9D,0x4C,0x21,0xD7,0x99,0x4C,
+	0x33,0x90,0xC6,0x32,0xB6,0x47,0xD9,0xB2,0x7A,0xCE,0x57,
+	0x98,0x86,0xAC,0xBC,0xF3,0xAD,0x19,0x12,0x6B,0x43,0x59,
+	0x4C,0xDC,0x0D,0xEF,0x3B,0xB9,0x39,0x3B,0x9C,0x82,0xC0,
+	0xE5,0xAC,0x20,0x41,0x4D,0xF7,0x7F,0x2A,0xB9,0xD6,0xDD,
+	0xE1,0x48,0xD8,0xD2,0x58,0x2C,0x8C,0xE3,0x18,0x14,0x1E,
+	0x6F,0x41,0x37,0xF9,0x44,0xCF,0x46,0x78,0x24,0xEE,0x65,
+	0xAD,0x5D,0x01,0x04,0xD9,0x51,0xDA,0x02,0x08,0x8E,0x61,
+	0xB9,0x10,0xE3,0x6E,0x36,0x82,0x89,0x07,0x99,0xE7,0xA5,
+	0x00,0xAB,0xDE,0xC5,0xD3,0x6C,0xD6,0xE6,0xA1,0x86,0x21,
+	0xB1,0x9C,0xF1,0x90,0x18,0x54,0x61,0x80,0xA0,0xA1,0x67,
+	0x08,0xD0,0x7B,0x5B,0xAA,0x5E,0x4A,0x54,0xD5,0xDE,0x20,
+	0x0D,0xB7,0xD7,0x1B,0xDB,0xDA,0xB4,0x83,0x9C,0x4F,0x52,
+	0xF1,0xA5,0xF3,0x58,0x69,0x7C,0xBA,0xD0,0x68,0xF0,0x73,
+	0xE2,0x85,0x1D,0x5F,0xEC,0xD9,0x88,0xA1,0x1C,0x33,0xED,
+	0x3F,0x8D,0x1B,0x7E,0x43,0x43,0x5F,0x07,0x99,0xB3,0x1B,
+	0x28,0x7D,0x01,0xD7,0xDF,0x61,0xD2,0xB8,0xE4,0xD7,0xCC,
+	0x08,0xCD,0xCB,0xE1,0xD6,0x55,0x83,0xE5,0x99,0xF9,0xAC,
+	0xB1,0xE7,0xB6,0x55,0x99,0x79,0xF5,0x7D,0x96,0x22,0x05,
+	0x08,0x85,0xCE,0xD0,0x44,0x53,0x0E,0xDE,0x29,0x58,0xC4,
+	0x05,0xCE,0x04,0x87,0x88,0x72,0x67,0xEE,0xAC,0x68,0xA8,
+	0xEF,0x1C,0x45,0x68,0x8A,0x91,0x68,0xFA,0xC1,0x48,0xFD,
+	0x84,0xA2,0xE3,0x46,0x9C,0x40,0xB4,0x9B,0x33,0x02,0xB8,
+	0x40,0x72,0x4E,0x4F,0x72,0xE7,0xCD,0xE6,0x7D,0x5C,0x73,
+	0xFA,0xB4,0x4D,0x56,0x3E,0x1C,0xB1,0xD6,0xA3,0xA4,0xB0,
+	0xB1,0xCC,0xCC,0xDE,0x16,0x7F,0x23,0x38,0xF9,0x40,0xB0,
+	0x24,0xB4,0xF3,0xBE,0xBF,0x24,0x9F,0x69,0x22,0xEE,0x74,
+	0xF2,0xAF,0x9B,0xB0,0x69,0x62,0x6A,0xE0,0xCE,0x51,0xB2,
+	0xE5,0xF6,0x3F,0xE4,0x59,0xA6,0x67,0x38,0x7A,0xE5,0x0F,
+	0xE0,0x7A,0xC5,0xE2,0xBA,0x11,0x33,0x1E,0x96,0x98,0xA6,
+	0x9A,0x9E,0x85,0x1B,0xAC,0xEF,0xF0,0xE3,0xFD,0xC4,0x9C,
+	0xB9,0xB2,0x63,0xD7,0xA1,0x52,0xCD,0xCF,0xBB,0x36,0x50,
+	0x09,0x1C,0xCF,0x28,0xF2,0x3E,0xE7,0x83,0xD9,0xF5,0xD6,
+	0x0C,0x70,0x46,0x6E,0xF4,0x10,0x0A,0x69,0x21,0xDF,0xDA,
+	0x1F,0x3B,0xEB,0xC4,0xB5,0xDA,0x37,0x73,0x0A,0x9C,0x71,
+	0x0A,0x17,0x45,0xA3,0xF9,0x46,0xA2,0xEC,0x36,0x93,0x98,
+	0x1E,0x3B,0x7F,0xC5,0x5D,0x77,0x36,0xED,0x77,0xCA,0xCB,
+	0x13,0x12,0x43,0x99,0x7F,0xC0,0xF0,0xBA,0xCF,0x6B,0xF5,
+	0x52,0xAA,0x3F,0x57,0x47,0x8F,0xF3,0x5D,0x67,0x21,0x05,
+	0x3F,0xCA,0x34,0x53,0x13,0xD2,0x03,0x14,0x8A,0x17,0x3B,
+	0x4F,0x3E,0xC1,0x5C,0x8B,0x7B,0x68,0xB6,0x3E,0x51,0xB8,
+	0xF5,0x01,0xCF,0x54,0xF9,0x87,0x73,0xD9,0xEB,0xAC,0x74,
+	0xEE,0x18,0x6D,0xD6,0x48,0x5F,0x6F,0x95,0x58,0x97,0x85,
+	0xC1,0xCE,0xAE,0xAF,0x46,0xA7,0x15,0xE2,0x82,0x7F,0x71,
+	0xF2,0x60,0xE6,0x79,0x56,0xA3,0x5B,0xBD,0x3D,0xF9,0xDD,
+	0x00,0x6C,0x80,0xD8,0xF5,0xF6,0xA7,0x99,0xCE,0xA5,0xC3,
+	0x22,0x4F,0xD6,0x8A,0x5B,0x0B,0x11,0xA0,0x1D,0xBF,0x01,
+	0xD0,0xF0,0xCF,0x4E,0x6A,0x7F,0xDB,0x9E,0x29,0xDE,0x1B,
+	0xD4,0x8C,0x8E,0x36,0x56,0xAA,0xED,0x1D,0x67,0xBD,0x0B,
+	0xCE,0x49,0x04,0x08,0x44,0xBB,0x2B,0xDE,0x3A,0xCB,0x5D,
+	0x32,0xAA,0x21,0xD5,0x04,0xF9,0x67,0xCB,0x4C,0xAA,0x48,
+	0x44,0xF6,0xDA,0x2B,0xFE,0xAC,0xC2,0xD8,0x53,0x40,0x17,
+	0x86,0x25,0x7D,0x34,0xF0,0xA6,0x90,0xFB,0xC0,0xC2,0x93,
+	0x12,0x8F,0x67,0x18,0x9F,0x24,0xF3,0x75,0x36,0xC6,0x9B,
+	0xDD,0x20,0x8B,0x4C,0x6F,0xE8,0xE4,0xF5,0xC8,0x13,0x82,
+	0xCD,0xF8,0x14,0x7E,0x1C,0xD4,0xCF,0xA5,0xA9,0x8A,0xAD,
+	0xCF,0xF5,0x03,0x68,0x52,0x8C,0xFD,0xEE,0xB5,0x5D,0xF0,
+	0x42,0x58,0xD7,0x96,0xF2,0x5C,0xC4,0x89,0xA7,0xB4,0x03,
+	0xE7,0x84,0x86,0x7A,0xDE,0x17,0x3A,0xEB,0x1B,0x31,0xCB,
+	0x35,0xB5,0x58,0x65,0xF5,0xE4,0x1C,0xC7,0x20,0x6B,0x13,
+	0x97,0x39,0x7A,0xA3,0x26,0x82,0x54,0x7F,0x24,0xB1,0xCC,
+	0xB4,0x5C,0x5C,0xC1,0x8A,0x66,0x95,0x64,0xB5,0x20,0xF8,
+	0xFB,0xAA,0x02,0x73,0xA3,0x37,0xF3,0xB0,0x1D,0xEC,0x8A,
+	0xD1,0x67,0x0A,0x13,0x3B,0xDB,0x5C,0x89,0xE2,0xE0,0x99,
+	0x9D,0xF1,0xB5,0x2C,0x31,0xC6,0xE3,0xA7,0x2B,0x2D,0x35,
+	0x2A,0xFD,0x2F,0x28,0xC6,0xC5,0x99,0x53,0x6C,0xE9,0x48,
+	0x90,0xB0,0xFC,0xE7,0x67,0x93,0xF6,0x0B,0x92,0xD1,0xE3,
+	0xBF,0x0C,0xDB,0xFE,0x4E,0x49,0xC2,0xAB,0x72,0xE2,0x78,
+	0xE5,0xAE,0xED,0x7F,0x29,0x45,0x54,0x2A,0x12,0x60,0x3C,
+	0x29,0x80,0xF0,0xA1,0x56,0x2C,0xDB,0x87,0x69,0x6F,0x6F,
+	0x90,0x45,0x7F,0x8E,0x2D,0xB9,0xCA,0x2D,0x3D,0x5F,0x0A,
+	0x88,0xBB,0x24,0xDA,0x76,0x0E,0x7C,0x17,0x84,0x3E,0xB9,
+	0x9B,0x28,0xD6,0xFA,0x12,0x2A,0xB0,0x71,0x82,0xC3,0x66,
+	0xB6,0xA9,0x78,0x61,0x28,0xAB,0x47,0x91,0x95,0x73,0x70,
+	0x2E,0xF9,0xA1,0xD8,0xA9,0xF7,0x27,0xD6,0x50,0x41,0x7F,
+	0x98,0x31,0x6B,0x2B,0x32,0xED,0xBB,0xAB,0x91,0x6C,0xDE,
+	0x39,0xAE,0xF3,0x7C,0x7D,0x36,0x7F,0x98,0xE3,0x4C,0xC5,
+	0x1E,0x11,0x21,0x94,0x74,0x10,0xAF,0x25,0x7D,0x8C,0x03,
+	0xFB,0x6F,0x5E,0x0E,0x87,0xDB,0x84,0x4A,0x42,0xBD,0x37,
+	0x45,0x98,0xF7,0xF4,0x1E,0xF1,0xFB,0x5D,0x3D,0x16,0x84,
+	0x97,0x06,0x8A,0x21,0x20,0x28,0xDC,0x5C,0x66,0x99,0xAC,
+	0xE0,0xCC,0x27,0xFE,0x02,0x25,0xFD,0x51,0x5E,0xF5,0xEA,
+	0x02,0xA3,0xAC,0xE3,0xE1,0x37,0x05,0x62,0x35,0x7F,0x2B,
+	0xBC,0xDD,0x37,0x4F,0x7A,0x40,0x65,0x5A,0x7F,0x95,0x61,
+	0xF7,0x71,0x5C,0x35,0x1F,0x7E,0x3E,0x87,0xD7,0x8C,0x66,
+	0xFA,0x1F,0x7E,0x02,0xB5,0xCC,0xE0,0x35,0x7B,0x8B,0xB5,
+	0x92,0x7A,0x9E,0x16,0x77,0xC4,0x7F,0xE6,0xFF,0x3C,0x81,
+	0x6F,0xDF,0x6C,0x56,0x0B,0x7C,0xDF,0xF3,0x72,0x42,0x60,
+	0x0A,0xA5,0x29,0xF0,0xD3,0xCB,0x7A,0x16,0xF1,0x55,0x44,
+	0xB9,0x62,0xEE,0x3B,0x3E,0x98,0x0F,0xB8,0x4B,0x17,0xE8,
+	0xD1,0x9A,0x7A,0x65,0xD0,0x9A,0xB1,0xE8,0x51,0x75,0xC1,
+	0x1F,0xBA,0x3C,0x83,0xEF,0x0A,0x44,0xA8,0x82,0xD5,0x8D,
+	0xFC,0x1A,0xC0,0x6C,0xBD,0xB7,0x2C,0xA0,0x6E,0xEF,0x3E,
+	0x61,0xAC,0x99,0x9B,0x92,0x11,0xD8,0x6C,0x89,0xB7,0xB8,
+	0x0C,0xD5,0x0E,0x95,0x71,0xC2,0x33,0x7D,0x9B,0x9D,0xDB,
+	0x72,0xEE,0xFA,0x0B,0x22,0x0D,0x7E,0xCC,0xFB,0x96,0x79,
+	0x15,0xEB,0x97,0xE5,0x75,0xB8,0xF0,0x7C,0x9B,0x86,0x2E,
+	0x9E,0x35,0xB8,0x73,0x45,0x76,0xD5,0xEA,0x55,0x06,0x2C,
+	0x30,0x09,0xDC,0xEC,0x0A,0x48,0xF1,0x60,0x9A,0x32,0x0B,
+	0x65,0xC7,0x4E,0x11,0xFD,0xFC,0xA2,0x8C,0xFA,0x56,0xF0,
+	0x52,0x81,0xFC,0xB2,0x80,0x37,0x86,0xE5,0x4A,0xDC,0x2B,
+	0x6A,0x8B,0x07,0x59,0x07,0x84,0x40,0xAD,0x73,0x9D,0x97,
+	0x1F,0xE2,0xA0,0x65,0x99,0xE1,0x09,0xAA,0xA5,0x2C,0xCD,
+	0x2F,0x5C,0x31,0xC3,0xA5,0x35,0x7B,0x73,0x01,0x70,0x14,
+	0xF3,0xFC,0xE0,0xBA,0xC1,0x1C,0x08,0xED,0x8C,0xAB,0xE2,
+	0xD2,0xCE,0x82,0xFE,0xA2,0x42,0xAD,0x8F,0x8A,0x13,0x8D,
+	0x3C,0xF7,0xBB,0xE9,0x26,0x0A,0xE5,0x81,0xD0,0x60,0xEB,
+	0xFA,0x03,0x7E,0x40,0x57,0x64,0x40,0xB1,0x6C,0xE5,0xEF,
+	0x53,0x6D,0x4F,0x94,0xEE,0xD4,0x27,0xFB,0x17,0xFF,0x59,
+	0x08,0x0C,0xFE,0x93,0xFD,0x2B,0x9E,0x8B,0xE6,0x6E,0x31,
+	0x3B,0x40,0xEF,0x24,0x38,0x4F,0xB2,0x7E,0x9B,0x6B,0xD3,
+	0x06,0x2C,0xD4,0xB1,0xBF,0xAD,0x4D,0x31,0xE3,0x0C,0xB6,
+	0x88,0xB1,0x79,0x7C,0x62,0x91,0x48,0xCE,0xEF,0xEC,0x47,
+	0xB3,0x39,0x27,0x40,0xCC,0x02,0x7B,0x8E,0x9B,0x9E,0x6D,
+	0x3F,0x35,0x6F,0xB3,0xC6,0x9E,0xA2,0xBB,0x2A,0x39,0x6F,
+	0x99,0xFF,0xD4,0xA2,0x95,0x7B,0x30,0xE6,0x07,0x01,0x41,
+	0xAB,0x68,0x96,0xE0,0xAA,0xD9,0x55,0x01,0xE0,0xC8,0xF9,
+	0xED,0xCE,0xF3,0xD2,0x3D,0xA4,0xFA,0x98,0x9B,0x5D,0xD0,
+	0xDC,0xD5,0xD3,0x2D,0x6C,0xAE,0x06,0xE3,0x1D,0xA7,0x68,
+	0x78,0x8B,0xFB,0x9B,0x6A,0x05,0x1F,0x86,0x71,0x7B,0x15,
+	0x08,0x6B,0x50,0x56,0x67,0x26,0xB2,0x0C,0x7F,0x52,0x1B,
+	0xF2,0xEE,0x87,0x4A,0x9F,0xFD,0xA1,0x88,0x21,0xF6,0x58,
+	0x2F,0x17,0x41,0xAD,0x42,0xBD,0x28,0x9E,0x6A,0x76,0xD0,
+	0x0E,0x3B,0x3F,0x9E,0xE4,0xB7,0xD6,0xAC,0xC0,0x75,0xA4,
+	0xB4,0x3C,0x16,0x07,0x3C,0x9B,0x0A,0xA5,0xAB,0x38,0x1A,
+	0xFD,0x08,0x02,0xC2,0x44,0x27,0x23,0xFA,0x55,0x7C,0x9C,
+	0x78,0x7E,0xFA,0x53,0x65,0xE7,0x98,0x0E,0xA2,0x39,0xBB,
+	0xC8,0xA1,0xE0,0x8D,0xAF,0xB2,0x8B,0x32,0x3E,0x97,0x4A,
+	0x90,0xB7,0x82,0x65,0x55,0x35,0xAE,0xDC,0xB9,0xEF,0xB1,
+	0x35,0x69,0x11,0x90,0xA9,0xAC,0x4F,0xBF,0x0C,0xE3,0x2F,
+	0xB7,0xC8,0xD3,0x96,0xA9,0xDD,0x74,0x94,0x6D,0x25,0xC8,
+	0xBF,0x03,0x7C,0x48,0x39,0xBE,0xE9,0x65,0xDB,0xED,0x4A,
+	0x73,0x36,0xD7,0x47,0x80,0x5C,0xEF,0x99,0x72,0xDB,0xD3,
+	0x1F,0xEC,0x7F,0xCE,0xF6,0x69,0xD0,0x7B,0x30,0xC9,0x65,
+	0xF3,0x87,0xC4,0xC1,0x5D,0x9D,0xAC,0x86,0xAC,0x1F,0x5C,
+	0xE4,0xBD,0x15,0xCA,0x85,0x91,0xB9,0xE8,0xFF,0x5D,0xC0,
+	0xEB,0x05,0x82,0x69,0xF5,0xD3,0x0F,0x2D,0xA6,0xE5,0x7D,
+	0xF0,0x1F,0xD3,0x0C,0x78,0x46,0x95,0xA9,0xCA,0x98,0xE4,
+	0xE7,0x32,0x43,0x33,0x49,0x02,0x1A,0x8E,0x26,0xFB,0x4C,
+	0xDF,0x9F,0x2B,0xC2,0xB0,0xEA,0xE8,0x4B,0x43,0xA8,0xF4,
+	0xAF,0x90,0xEA,0x9B,0x43,0x8B,0x46,0xDB,0x61,0x26,0x06,
+	0xD7,0x8B,0x08,0xF2,0x2C,0x43,0x49,0xF6,0x44,0xBC,0x1C,
+	0x74,0x86,0x80,0x93,0x1C,0xA2,0x5C,0xEB,0xDF,0x8C,0x1D,
+	0x8F,0xDF,0xFC,0x77,0xBC,0xAF,0xE4,0x77,0x07,0x19,0xF1,
+	0x41,0xE4,0x65,0x20,0xF3,0xF8,0x6F,0x56,0x07,0x07,0xEC,
+	0x35,0x87,0xE2,0xCA,0xC2,0x46,0x60,0xD9,0xE4,0xF5,0x0D,
+	0xD6,0x30,0x5D,0xAA,0xA8,0xD9,0xA2,0x40,0x73,0xE2,0xB6,
+	0x99,0x28,0x6F,0xA6,0xF3,0x58,0x41,0x04,0xEC,0x27,0xDA,
+	0x74,0x15,0xC1,0x9B,0x90,0x2F,0x8C,0x9C,0x2E,0x82,0x14,
+	0x0F,0xDD,0x14,0x89,0x61,0x5D,0x93,0xB2,0xD9,0x6F,0x15,
+	0x82,0xB9,0x81,0x42,0xFA,0xAA,0x60,0x35,0xE8,0xD9,0xCC,
+	0xDF,0xF7,0x94,0x6A,0x23,0x6F,0x0E,0xC0,0x07,0x79,0xC4,
+	0x57,0xD4,0x9D,0x17,0xE0,0xDE,0xB0,0xAF,0xAC,0x35,0x9E,
+	0x0D,0x5F,0x98,0x16,0xD7,0xE2,0x12,0xD7,0x9B,0x24,0x6C,
+	0xB8,0x35,0x9C,0xF5,0xDB,0x67,0x6F,0x50,0xBA,0xB2,0xCE,
+	0xB3,0x6A,0x9C,0xD0,0xA0,0x5C,0xBC,0xF3,0x40,0x86,0xF2,
+	0x2D,0xE4,0xBC,0xD0,0x62,0xAF,0x18,0xD7,0xC9,0x55,0x7E,
+	0xBE,0x9B,0x37,0x86,0x84,0xE8,0x5F,0x67,0x69,0x40,0x75,
+	0x5F,0x8A,0x15,0x27,0x53,0xE7,0xCD,0x69,0x7F,0x18,0xDF,
+	0x7E,0x28,0xCF,0x89,0x2F,0xB8,0x5D,0x0E,0xD3,0x0E,0xC3,
+	0x5B,0xB0,0xC7,0x81,0x56,0xDF,0x7D,0x29,0x96,0x93,0x67,
+	0x54,0x80,0xA0,0x82,0xAB,0x4C,0xE3,0xFA,0x0D,0xAF,0xCF,
+	0x0A,0x29,0xE8,0x96,0x37,0x38,0xB2,0x7E,0x75,0xC2,0x58,
+	0x7F,0xD2,0xD6,0x23,0xEB,0x0B,0x24,0x0E,0x44,0xF4,0xD7,
+	0x4B,0xEB,0xB0,0x4A,0xDB,0x4D,0xAE,0xEA,0x8A,0xB5,0x2D,
+	0xAC,0x40,0x17,0x44,0x8D,0x03,0x6C,0xED,0x96,0x55,0x2D,
+	0xF0,0x2A,0x64,0xE0,0x89,0xFC,0x6D,0x17,0x31,0x73,0x1B,
+	0x6E,0x93,0xE4,0x22,0x4B,0x5C,0x8A,0xD5,0xE8,0x5F,0xAB,
+	0xA4,0xDA,0x2C,0xCC,0xA5,0xEA,0x93,0x97,0xCE,0x92,0xF8,
+	0x9B,0x81,0xEE,0xE7,0x3F,0xA2,0x04,0x69,0x26,0x68,0xC9,
+	0x12,0x7E,0xC9,0x25,0xE7,0x75,0xC7,0x92,0xF6,0x96,0xC2,
+	0x51,0x0D,0xFC,0x6C,0x99,0x0D,0x97,0x9A,0xF1,0x84,0xC7,
+	0x1C,0x8D,0xB3,0x40,0xA5,0xFF,0x9D,0xB8,0x93,0xA1,0xE5,
+	0xBE,0x87,0xDA,0x34,0x4C,0xB4,0xE8,0x50,0x16,0xF3,0xA3,
+	0xE8,0x3C,0xB1,0x57,0x70,0x2D,0x94,0xFB,0x6C,0x5E,0xAA,
+	0x0D,0xF7,0x9F,0x4B,0xE7,0xBF,0x15,0x53,0xD5,0x07,0xBD,
+	0xBA,0xCE,0x53,0x1D,0x9C,0xA3,0x9C,0x1B,0x7A,0xEC,0x9C,
+	0x4D,0xA6,0x53,0x44,0x5C,0xFF,0x08,0x88,0xE6,0x8A,0x65,
+	0x19,0xF8,0xA5,0x02,0xD0,0x83,0x6D,0xFC,0x01,0xE3,0xFB,
+	0x4F,0x74,0x2E,0xFA,0x87,0x7E,0xEB,0xE2,0x98,0x1A,0x70,
+	0x8C,0xE7,0x54,0x9B,0x2E,0x3E,0x13,0x64,0x57,0xA3,0x64,
+	0xAE,0xD3,0xE7,0xD4,0x3E,0x3C,0x2B,0x53,0x51,0x8A,0x37,
+	0xD4,0x7D,0x5B,0xE9,0x78,0xBB,0x60,0x08,0x32,0x58,0x07,
+	0x5D,0x8E,0xD2,0x53,0xDC,0x41,0x99,0xC5,0x53,0x92,0x91,
+	0x1F,0x5E,0x89,0x30,0x28,0x6C,0x8D,0xBB,0x20,0xFF,0x56,
+	0x32,0xA0,0x6B,0x3C,0x45,0xD0,0x31,0x33,0xF2,0x21,0xAE,
+	0xCC,0x99,0xEB,0x37,0xEB,0x45,0xE1,0xB4,0x8C,0x24,0xD7,
+	0x3B,0x72,0x3F,0x6B,0xD6,0xA4,0x09,0x90,0xA7,0xFD,0xCB,
+	0xDF,0xD6,0x8E,0x6D,0xE3,0x65,0x1F,0x88,0x42,0xE1,0xA2,
+	0x36,0x63,0xC9,0x28,0x0F,0xB1,0x1F,0x47,0x28,0x6C,0x12,
+	0x99,0xD4,0x1F,0x8C,0xC5,0x59,0x7B,0xEA,0xB1,0x75,0x51,
+	0x11,0xB1,0xA4,0x48,0x2A,0xEA,0x1F,0x26,0x55,0x09,0xA3,
+	0x9F,0xDA,0xC3,0x13,0x95,0x4A,0x0E,0x47,0xCD,0xD2,0x12,
+	0xF8,0xB5,0x48,0xB2,0x05,0xAD,0xE1,0xD4,0x15,0x2D,0x39,
+	0x7C,0x42,0x52,0x18,0x59,0xFE,0x95,0x8D,0xFF,0x79,0xFA,
+	0x66,0x22,0xCA,0x26,0x01,0xB1,0x39,0xAB,0x1D,0xE1,0x01,
+	0xD6,0x50,0x42,0xF9,0x45,0xC1,0xBD,0x21,0xCA,0xEB,0x28,
+	0x80,0x06,0xC2,0xBC,0x4B,0x2D,0x9C,0xBC,0x1B,0x41,0xA2,
+	0xC7,0x2A,0x6D,0x24,0x26,0xB8,0x66,0x9C,0x43,0x45,0xC5,
+	0x1F,0x26,0x93,0x62,0xA3,0xC2,0x25,0x5B,0x51,0x5E,0x42,
+	0x87,0xF1,0x91,0x28,0xAA,0xC1,0x09,0x43,0x14,0x29,0x3E,
+	0x4E,0x4F,0x87,0xAD,0x1B,0x45,0x25,0x85,0xC6,0x26,0x5B,
+	0xA9,0xC6,0xCF,0x7B,0x50,0x13,0xBB,0xA2,0xC9,0x6A,0xD7,
+	0xB6,0xDD,0x6D,0xB5,0x2F,0xEA,0x6B,0xE9,0xB0,0x01,0x6E,
+	0x78,0x94,0x9B,0xB5,0xAB,0x5D,0x07,0x0A,0xB0,0xF1,0x58,
+	0x20,0xAE,0x0E,0xB0,0xCB,0x8D,0x71,0xE4,0xA7,0x6A,0x87,
+	0xCD,0xC7,0xD2,0xB7,0x92,0xA8,0xD1,0x55,0x19,0x04,0x1B,
+	0xB9,0x13,0x28,0xEB,0xEC,0x50,0x89,0x6F,0x4F,0x63,0x70,
+	0x1B,0xEE,0x09,0xF4,0x08,0xBA,0x7F,0xD2,0x46,0x67,0x54,
+	0x8C,0x62,0x4E,0xCA,0x69,0xF2,0xC4,0xA2,0x12,0x3D,0xAF,
+	0x93,0x4D,0x4B,0x8A,0x22,0x53,0x35,0x51,0x71,0x29,0x8D,
+	0x51,0x89,0xB1,0xF1,0x62,0x09,0x11,0x91,0x06,0x40,0xE4,
+	0x94,0x81,0x0E,0xB7,0x48,0x68,0x6B,0x9A,0x0F,0x75,0xF2,
+	0x9D,0xBF,0x5E,0x4C,0x93,0x96,0x1F,0x59,0xEE,0xB9,0xE3,
+	0x74,0x17,0xEA,0x2A,0x2A,0x8C,0x1E,0x41,0xCB,0x95,0xCE,
+	0xBD,0x7A,0xD7,0x8F,0x94,0x98,0x78,0x6E,0x0F,0x6D,0x39,
+	0xF9,0x9C,0x96,0x0C,0x50,0x3D,0x2D,0xF0,0xE2,0x2C,0x5A,
+	0x25,0x6A,0x62,0x5B,0x4D,0xA0,0x3F,0x5C,0x69,0x9D,0xAC,
+	0x85,0x69,0x28,0x27,0xBB,0xFA,0xEF,0xE9,0x63,0xCA,0xFA,
+	0x51,0x59,0xD0,0x0F,0x48,0xAD,0x77,0x59,0x64,0x29,0x52,
+	0x06,0xBA,0x2B,0xEA,0xC4,0x89,0x00,0xF4,0x35,0xF5,0xEE,
+	0xB0,0x3E,0xC5,0xC4,0xF2,0x0B,0x5F,0xE5,0xE2,0x84,0x96,
+	0x10,0x51,0xFE,0xE2,0xE8,0x4B,0xE4,0x58,0xE5,0xBC,0x0A,
+	0x52,0xAE,0x1A,0x59,0x89,0xDF,0x96,0x1E,0x37,0x1B,0x97,
+	0x26,0x45,0x93,0x6C,0x43,0x94,0xEB,0x1E,0x4A,0xEB,0xDA,
+	0x68,0x90,0x15,0xB4,0xAD,0xD9,0x3E,0xD6,0xEE,0x6E,0x8E,
+	0x6E,0xF6,0xA6,0xB3,0x28,0x3B,0x45,0x0A,0xFC,0x4E,0x29,
+	0x89,0x22,0x3E,0xA6,0x98,0x8F,0x11,0xDD,0xEC,0x51,0xD1,
+	0x31,0x74,0xB5,0x41,0x6F,0x18,0xEA,0xC7,0x70,0xE7,0xF9,
+	0xDC,0x1A,0x32,0x49,0x35,0x03,0xB6,0xEA,0x27,0x96,0xEB,
+	0x24,0x16,0x5A,0x75,0x7F,0xB5,0xF8,0x78,0x97,0x6A,0x1A,
+	0x8A,0x9D,0xE4,0x84,0xB6,0x47,0xD3,0x47,0x09,0x1A,0x61,
+	0xBA,0xA4,0xA4,0xB9,0x05,0x65,0x92,0xEB,0x29,0xAD,0x7C,
+	0x2D,0xCD,0x64,0x09,0x7C,0xE2,0x94,0x63,0x1C,0x2B,0x2A,
+	0xDC,0x37,0x47,0x0E,0x62,0x36,0x84,0x72,0xCF,0x1C,0xB6,
+	0x1D,0x74,0x4E,0xD3,0xC9,0x8F,0x20,0x60,0xBA,0xE3,0xA9,
+	0xC6,0xE1,0x0A,0x68,0x09,0xE4,0xD5,0x44,0xC7,0xDC,0xD2,
+	0xE2,0x26,0x03,0x55,0xE2,0x1D,0x5E,0x9D,0x6F,0xC7,0xF4,
+	0xA0,0xA3,0x15,0x37,0xA4,0x98,0xAE,0x1C,0x32,0x4A,0x2E,
+	0x64,0x09,0x39,0x7C,0x73,0x48,0xB7,0xC2,0xC8,0x28,0x4F,
+	0xF7,0xBE,0xCB,0xB3,0x19,0x72,0x2C,0x14,0x15,0xE3,0x4D,
+	0x0D,0x4E,0x8A,0x4B,0x74,0xE5,0xBA,0xAC,0x2A,0x3A,0xD5,
+	0xF7,0xD8,0x29,0x86,0xE4,0x7D,0x0A,0xE5,0xDA,0xFD,0xCB,
+	0x94,0x0B,0x75,0x19,0xC0,0x00,0xEB,0xCE,0x7E,0x02,0x68,
+	0x80,0xF6,0x3C,0x62,0xC8,0x29,0x2B,0xBA,0xBA,0xBC,0xEF,
+	0x75,0x26,0x5B,0x1F,0xF5,0xC7,0xD5,0x3E,0x5C,0x38,0x32,
+	0x45,0x61,0xD3,0x62,0xA3,0x26,0x93,0x3A,0xCC,0xBC,0x50,
+	0x0E,0x71,0x16,0xE1,0x15,0x5C,0x9F,0xD0,0xEF,0x79,0x7B,
+	0xA1,0x6E,0x5F,0xA2,0x67,0xA0,0xD4,0x98,0xFF,0x16,0xFB,
+	0xC4,0x9F,0x22,0xF0,0xE7,0x82,0x71,0xB1,0x09,0x62,0x71,
+	0x69,0xC1,0xA4,0x93,0x7B,0xAA,0x28,0x8A,0x4B,0xA0,0x45,
+	0x5A,0x58,0x88,0xE0,0x4B,0x6E,0x35,0x0C,0x76,0x81,0xC7,
+	0x9F,0x82,0x08,0xB6,0xD5,0xD1,0xD3,0x32,0x68,0x0B,0xB4,
+	0xC5,0xC7,0xE7,0xC7,0x36,0x50,0x74,0x27,0xAF,0x5D,0xE7,
+	0x08,0xBE,0x29,0x37,0x29,0x29,0xAF,0x87,0x26,0xDA,0xD4,
+	0xC7,0x4A,0x3D,0x7F,0x57,0x74,0xE6,0x57,0x12,0x4F,0xFC,
+	0xA2,0x95,0xC2,0xD9,0xA8,0x96,0x08,0xAB,0x27,0x90,0x87,
+	0xC1,0xEF,0x7C,0x5B,0xB4,0xA6,0xB3,0x9D,0xF5,0x4E,0x46,
+	0xD4,0x34,0xE8,0xC5,0x6A,0xAA,0x4C,0xFE,0x7A,0x4E,0x69,
+	0x30,0x8A,0x5C,0x95,0x93,0xE3,0xBC,0x17,0x4E,0xB4,0x54,
+	0xD2,0x8F,0x5D,0xE0,0xC6,0x3A,0x78,0x58,0xE4,0xFB,0xF3,
+	0xB4,0x9A,0x32,0x4C,0x57,0xA0,0x72,0x0F,0x5A,0x9B,0xC3,
+	0xE9,0x46,0x71,0x4A,0x61,0xA6,0x54,0x63,0x0D,0xF9,0xC4,
+	0x50,0x52,0x96,0x6D,0x1B,0xDC,0x96,0x30,0xE5,0x19,0x18,
+	0x18,0x36,0xAC,0x5F,0x65,0x29,0x1F,0x38,0x82,0xE9,0x53,
+	0x4A,0x2D,0x39,0x1F,0x6B,0xC0,0x43,0x7A,0x3F,0x2C,0xE8,
+	0x6B,0x0A,0x14,0x59,0x8B,0x33,0x70,0x7F,0x34,0x06,0xDA,
+	0xD0,0x4B,0x68,0x8F,0xEB,0x51,0xEE,0xE6,0x55,0xE4,0x76,
+	0x48,0x80,0xBF,0x9A,0x32,0x40,0x9C,0xB5,0x75,0xB5,0xAE,
+	0x3C,0xB9,0xD2,0x3D,0x76,0xDF,0x91,0xEF,0xC3,0x70,0xE1,
+	0xB4,0xC9,0xB4,0x8B,0x51,0x93,0x5B,0x0C,0xE1,0x56,0x18,
+	0xAD,0xE1,0x19,0x8D,0x4C,0x76,0x6B,0x68,0x59,0xF5,0xC8,
+	0x34,0x9C,0xE0,0x38,0xB6,0xC3,0x7A,0xE2,0xDD,0x3D,0xE6,
+	0x4E,0xD8,0xB9,0x27,0x2C,0xBB,0x5B,0x63,0x9F,0x3B,0x7B,
+	0x42,0xEF,0x0C,0xD9,0x5F,0xD3,0xE3,0xDA,0xB2,0x25,0xD1,
+	0x48,0x70,0xEB,0x1B,0x24,0xE4,0xB4,0x1A,0xDE,0x17,0xC7,
+	0x8B,0x75,0x71,0x0D,0xD0,0x7D,0x9E,0xBA,0x9A,0x58,0x30,
+	0xFB,0x2A,0x36,0x67,0xEA,0x46,0xBA,0x6B,0x42,0xB9,0xC8,
+	0x7A,0xA3,0x28,0xC3,0x6D,0xD6,0x81,0x2F,0x5C,0xBC,0x31,
+	0xB7,0x8E,0x15,0xFF,0xDB,0xFD,0xCC,0x62,0x92,0x5C,0xEF,
+	0xB7,0xE9,0x44,0x63,0x2C,0x7D,0x4C,0x4C,0xAC,0x32,0xD8,
+	0x56,0xCB,0x56,0x81,0x10,0x6D,0xE1,0x5B,0x49,0xBE,0x23,
+	0xED,0xA9,0x12,0x3E,0x81,0xF2,0x2E,0xEA,0xA3,0x7F,0xF8,
+	0xD4,0x28,0xBC,0x32,0x65,0x0A,0xBE,0x07,0x34,0x72,0xBB,
+	0xF7,0x6F,0x23,0xDC,0xF2,0x81,0x2A,0xBC,0xC3,0x82,0xB3,
+	0xF8,0x09,0x7C,0xC0,0xB8,0x0D,0xA6,0x1B,0x9B,0xBA,0x6C,
+	0x22,0x5F,0xEF,0x79,0xB5,0x8D,0x84,0x4E,0x4B,0x8C,0xF5,
+	0x88,0x71,0x6E,0x4B,0x29,0x8E,0xD7,0x99,0x36,0x99,0x8A,
+	0x70,0x69,0x50,0xE4,0x0C,0x27,0x07,0x78,0x06,0xF5,0x6F,
+	0x5F,0xC9,0x89,0x34,0x86,0x03,0xB5,0xF1,0xFC,0x4E,0xA9,
+	0x22,0x1A,0x57,0xC5,0xCE,0xE8,0xEB,0x63,0x62,0x30,0xE0,
+	0xE7,0x01,0x11,0x28,0xCD,0x5C,0xA4,0xE9,0x5B,0x80,0xE0,
+	0x3A,0x54,0xF9,0xF5,0xAE,0x4A,0x04,0xB6,0x10,0x98,0x75,
+	0x38,0xEC,0x43,0xA2,0xDE,0x11,0x5B,0x3C,0xD3,0x57,0x7C,
+	0x16,0x7A,0x02,0x61,0x97,0xC0,0xFC,0x42,0x9F,0x9A,0xD5,
+	0xB2,0xCA,0xFC,0x8D,0xF7,0x6E,0x54,0xC7,0xD5,0xE8,0x3E,
+	0x4C,0xF6,0x34,0xD5,0xF3,0xD1,0x1A,0x46,0xD9,0x8F,0x52,
+	0x1F,0x25,0x7F,0x88,0x97,0x1B,0xCF,0xA1,0x14,0xDF,0x02,
+	0x8A,0x89,0x1A,0xE9,0x36,0x60,0xE4,0xFC,0xF4,0x91,0xEA,
+	0xDA,0x3A,0xCE,0x13,0xDA,0x23,0xFA,0x28,0xED,0x42,0x63,
+	0x9F,0x45,0xEA,0x5E,0xA1,0xBF,0xB5,0xEB,0x88,0x55,0x62,
+	0x71,0x5C,0x1B,0x66,0xCF,0x92,0x66,0x9D,0x0B,0x6F,0x73,
+	0xE9,0x76,0xCA,0xF2,0x7B,0x7A,0x32,0xC7,0x60,0x6C,0x9D,
+	0x12,0x0C,0x47,0x6A,0x85,0xA8,0x2E,0xEB,0xDC,0xD7,0x86,
+	0x4F,0x86,0x5D,0xD5,0xD4,0x8B,0x89,0x20,0x85,0xBD,0xE6,
+	0x48,0xD0,0x25,0x51,0x2C,0xD6,0x75,0x8C,0x28,0x89,0xAB,
+	0x61,0x93,0x7E,0x85,0x57,0xF2,0x25,0x9E,0x4D,0xC6,0xE1,
+	0xA6,0x55,0x91,0xF1,0x92,0x20,0x6A,0x49,0xC5,0xC4,0x31,
+	0xE2,0x96,0x13,0xEF,0xBD,0x54,0xF1,0xA8,0x87,0x72,0x54,
+	0xD2,0x05,0xCC,0x97,0x48,0xEC,0xD3,0x79,0xDD,0x17,0x74,
+	0x03,0xED,0xB7,0x69,0x29,0xA4,0x7B,0x69,0x2A,0x7C,0x1E,
+	0x7D,0x78,0x84,0xFE,0x78,0x02,0x12,0xC4,0x6E,0x4D,0x89,
+	0xDA,0x69,0xB8,0x7B,0xC7,0x98,0x62,0x0A,0x7E,0xD6,0x5B,
+	0xC0,0x14,0xFA,0x33,0x1D,0xE3,0x5F,0x67,0x3B,0xB2,0x6A,
+	0xBF,0x48,0xA7,0xA9,0xD9,0x9C,0xA1,0x38,0x8E,0xBD,0xD0,
+	0x35,0xA7,0x44,0xC5,0xDF,0xA4,0x50,0xD1,0x8F,0xCA,0x12,
+	0x35,0xC5,0x87,0xE2,0x02,0xC9,0x69,0x0D,0x33,0xFE,0xE3,
+	0x51,0xC3,0x91,0xF1,0xA3,0x73,0xAB,0x97,0xF4,0x35,0x43,
+	0x5D,0x26,0x49,0xD9,0x41,0xA9,0xDC,0xFB,0x10,0xDD,0x08,
+	0x7E,0x4F,0xE8,0x67,0xCD,0xC4,0xFB,0x56,0xCD,0x61,0x72,
+	0x2F,0xEA,0xEC,0x03,0x21,0x75,0x16,0xF4,0x72,0x35,0x6B,
+	0xE3,0xF3,0xAA,0x26,0xA5,0x6A,0xD7,0x63,0x54,0xB4,0xB1,
+	0xD0,0x16,0x07,0xBE,0xA5,0xB7,0x19,0x42,0xD7,0x65,0xBD,
+	0x12,0xC3,0x3F,0x92,0x68,0x6E,0xAD,0x9E,0x27,0xEC,0xBE,
+	0x18,0x6C,0x8C,0xD8,0xD0,0x85,0x49,0x74,0x4B,0x53,0xF2,
+	0x89,0x0E,0xDD,0x6F,0x92,0x12,0x03,0x22,0xA7,0xDC,0xF1,
+	0xAE,0x14,0xBE,0xB1,0x08,0x63,0xBE,0x0E,0xA4,0xBA,0xC7,
+	0x62,0x77,0xC9,0x1A,0x95,0x4C,0x6B,0x0A,0x7D,0xB5,0x5E,
+	0x1A,0xA4,0x95,0x2C,0x18,0x4D,0x0A,0x0C,0x71,0xBA,0x18,
+	0x40,0xBC,0xE1,0x1A,0xFA,0xD8,0x94,0x37,0x65,0x92,0xFC,
+	0xA0,0x85,0xAB,0x6A,0x6C,0x07,0x30,0x55,0xB1,0x4A,0x4B,
+	0x39,0xB4,0x2D,0xB8,0xE1,0xFD,0x24,0x1F,0x19,0x46,0x6C,
+	0x69,0x6C,0x82,0x4F,0x7E,0x8E,0x1C,0x29,0x17,0xA3,0x28,
+	0xFE,0xC7,0xCD,0xA8,0x17,0x3E,0x2E,0xD6,0x06,0x5F,0x7E,
+	0x03,0xD4,0xC3,0xC0,0xBF,0xF7,0x26,0xAF,0x12,0xA6,0xF6,
+	0x7D,0xEC,0xAC,0x4D,0xD5,0x3C,0x14,0x37,0x1B,0xC3,0x8D,
+	0xBB,0xC3,0x96,0x62,0xCA,0xA6,0x9B,0x9B,0xB4,0x02,0x02,
+	0x7B,0x75,0x8C,0x35,0x31,0xDE,0xD3,0x97,0xE3,0xD5,0xAB,
+	0xE4,0xF4,0x41,0x49,0x6B,0x73,0xF5,0x91,0x74,0x4C,0x93,
+	0xD0,0x4F,0x0E,0xC4,0x9A,0x3C,0xA9,0x89,0x96,0x95,0x20,
+	0x79,0x6B,0x05,0x8D,0xEB,0xAE,0x50,0x0E,0x16,0x29,0x72,
+	0x78,0x37,0xA8,0x24,0x9F,0xFF,0x26,0xBD,0x4D,0xBA,0x36,
+	0x9A,0x7F,0xD3,0x7D,0x19,0x86,0x25,0x9B,0xB7,0x9B,0x52,
+	0x6C,0x58,0x37,0x28,0xFE,0x84,0x81,0x07,0x3B,0xF1,0xF4,
+	0x34,0xFB,0x47,0x1A,0xBB,0xC8,0x40,0xC1,0xBA,0xB0,0xC7,
+	0x8D,0x77,0xBE,0x50,0xE8,0x1B,0x08,0x94,0x01,0x45,0x3B,
+	0x30,0x32,0x34,0xB1,0xFB,0xB6,0xAA,0x83,0x6D,0xBC,0x45,
+	0x6A,0x2A,0x41,0xE3,0x82,0x68,0xB8,0xDE,0x0D,0xDB,0x34,
+	0x94,0x9E,0xA1,0xB9,0xAE,0x41,0xD6,0xB3,0x0B,0xC9,0x1A,
+	0x3A,0x18,0xC7,0x36,0x3B,0x51,0x5D,0xE3,0x4B,0xC6,0xAD,
+	0xE8,0xE6,0xC4,0x95,0x0F,0x22,0x83,0x76,0xBE,0x65,0x18,
+	0x9E,0x84,0xE7,0x57,0x1C,0x5B,0xDB,0xD4,0x3C,0xB0,0xA5,
+	0xD6,0x0E,0x67,0x10,0x24,0xBE,0x5E,0xD6,0x37,0xB4,0x9E,
+	0xD7,0x21,0xC8,0xF8,0xC4,0xBA,0x75,0xB9,0x11,0x9F,0xDD,
+	0x67,0x94,0xFA,0x81,0x5F,0xAA,0x7A,0x3B,0x01,0x1A,0x89,
+	0x14,0x7C,0xA6,0xC9,0xCF,0xF1,0xCD,0x79,0x7C,0x50,0x30,
+	0xDB,0xC5,0x5F,0x18,0x90,0xE9,0xAC,0x0C,0x2F,0x29,0xAC,
+	0xE1,0xFC,0x65,0x1D,0x16,0x76,0x85,0x42,0x12,0x89,0x93,
+	0x22,0xA1,0x9F,0x94,0xE1,0x5F,0xC7,0x3E,0x48,0xD0,0x57,
+	0x8B,0x83,0x3E,0x83,0xD9,0x53,0x5A,0xC6,0xBC,0x5E,0xFE,
+	0x74,0xD1,0xC6,0x18,0x7F,0x39,0xC8,0x64,0xB6,0x46,0x7B,
+	0x5E,0xFB,0xF8,0x5E,0xFE,0xD4,0xC4,0x7B,0x98,0x3D,0x77,
+	0x95,0xA9,0xD8,0x61,0x5C,0x42,0x4C,0x60,0xF4,0xE9,0x6B,
+	0x8E,0x97,0x51,0x6F,0x1D,0x2F,0xEB,0xEB,0xBC,0x5F,0x6B,
+	0x9B,0x45,0x27,0x41,0x7F,0x0D,0xC4,0x7E,0xD1,0x61,0xA5,
+	0x8B,0x4C,0x20,0xFE,0x80,0x4E,0xC0,0x91,0x79,0x0E,0xFB,
+	0xDA,0xBE,0x04,0x6D,0xDD,0xA5,0xF0,0x91,0xCD,0x27,0x74,
+	0x1B,0xAC,0x7A,0xD0,0x66,0x8E,0xE2,0x46,0x29,0x2F,0x25,
+	0xF8,0x95,0xBC,0x5B,0xBA,0x10,0x96,0x48,0xCE,0x76,0x39,
+	0x0D,0x45,0xFB,0x46,0x9E,0xA9,0xEA,0xE8,0xF8,0x1A,0x19,
+	0x1B,0x81,0x0E,0x1B,0xB1,0x68,0x19,0x74,0xA5,0x2E,0x85,
+	0xF8,0x0E,0xE4,0xB8,0xD9,0x28,0x3D,0x67,0x00,0x6E,0xAA,
+	0x37,0xCD,0x20,0xC4,0x81,0xA2,0x57,0xAB,0x0C,0x25,0xA1,
+	0x3A,0xC3,0x3E,0x1D,0x86,0xA8,0x1B,0x86,0xC0,0x18,0xC7,
+	0xAD,0x99,0xDF,0x3F,0x76,0xD7,0x9E,0x37,0x86,0xF8,0x68,
+	0x62,0x9E,0xBA,0x17,0x8C,0x2A,0xCB,0x53,0x85,0x4E,0x6D,
+	0xA8,0xAA,0x21,0x73,0xB5,0x39,0x95,0x1A,0xB9,0x5B,0x23,
+	0xB8,0xE2,0xDE,0xE3,0x43,0x9B,0x7A,0x53,0x2F,0x56,0x64,
+	0x7C,0xE2,0x4B,0xED,0x55,0xE0,0xAD,0x1F,0xE1,0x25,0x27,
+	0x37,0x60,0x8A,0xD3,0x6F,0x85,0x61,0x72,0x17,0xAA,0xEE,
+	0xD6,0x84,0x13,0x41,0xAE,0xB5,0xD6,0xC8,0x9C,0x48,0xA0,
+	0x71,0x0C,0x96,0x12,0xDE,0x57,0x27,0xF0,0xDE,0xFB,0xE3,
+	0x3C,0x84,0x2A,0xDE,0x25,0xAD,0xED,0x34,0x7D,0x43,0x5B,
+	0xA4,0xDC,0xFB,0x97,0x68,0xBC,0xBA,0x7E,0x4C,0xCC,0x79,
+	0x4F,0x52,0xB8,0xFC,0x78,0xD4,0x53,0xC6,0xFD,0x24,0x47,
+	0xA1,0x2C,0x67,0x33,0x38,0x86,0xF3,0x74,0xEC,0xD9,0x36,
+	0x2B,0x6F,0xEF,0xE6,0x96,0x6B,0x8F,0x97,0x4F,0x5E,0x30,
+	0xAE,0xB0,0xAD,0xC3,0xE9,0x08,0x41,0x2F,0x0B,0x94,0xEE,
+	0x6A,0x67,0xDB,0x48,0xC1,0xEC,0xF9,0x1A,0x54,0x1A,0xA5,
+	0x15,0x74,0xB0,0xF8,0xE7,0x13,0x14,0xFD,0x16,0x60,0xFA,
+	0xB4,0x22,0x37,0xE4,0x7C,0x11,0x56,0xB0,0xA2,0x26,0xE1,
+	0xD5,0xA2,0x5A,0xCB,0x69,0xB4,0x9D,0x4F,0x90,0xC4,0x61,
+	0x40,0x0A,0xC6,0x3A,0xDB,0x83,0xBB,0x74,0xC1,0xCB,0xF5,
+	0xA1,0x47,0x5C,0xBE,0x9C,0xFB,0x39,0x61,0x57,0xBB,0xCF,
+	0x79,0x37,0x0B,0x3C,0xF3,0x8A,0x8A,0xA7,0xFE,0xEA,0x3D,
+	0xB4,0xCA,0xC3,0xC9,0x3F,0x24,0x5F,0x7B,0x91,0xE2,0xA4,
+	0xDB,0x31,0x0A,0x8D,0xD9,0x56,0xF7,0x73,0x28,0x5A,0xBA,
+	0xEA,0x30,0xBB,0x6E,0xED,0x72,0x36,0x6F,0x31,0x11,0xEE,
+	0xAD,0xAE,0x34,0xAB,0x03,0xD4,0xD5,0xD4,0x6F,0x33,0xE6,
+	0xF6,0x33,0x04,0x49,0xC8,0x7F,0x48,0xBD,0x11,0xF1,0xAE,
+	0x65,0x54,0x7A,0x40,0x0E,0x3E,0x5E,0xDA,0x7C,0x8F,0xBA,
+	0x6E,0x4C,0x1B,0x58,0x47,0x1C,0xC3,0x49,0xB8,0x1C,0x74,
+	0xA2,0x4D,0x71,0x6F,0x4A,0x7A,0xFD,0xB6,0x52,0x85,0x0A,
+	0x6D,0xFA,0x2E,0xDA,0x31,0xA6,0xE1,0xCE,0xCD,0x4E,0x03,
+	0x56,0x7D,0xD2,0x77,0x24,0x16,0x9D,0x94,0x38,0x5F,0x60,
+	0xA3,0x56,0xB1,0xFA,0x6F,0x5A,0x43,0x9D,0x70,0x29,0x75,
+	0x20,0x79,0xB6,0xFB,0xA5,0x3E,0xF9,0x1E,0xC1,0x0C,0xCF,
+	0x7D,0xB3,0x76,0x74,0xE7,0xE3,0x3D,0x8D,0x74,0x19,0x5F,
+	0x9D,0x04,0x29,0x57,0x6D,0xEC,0x3A,0xC1,0x4B,0xAB,0x59,
+	0xEE,0x8D,0x4E,0xAA,0x9B,0x9E,0xAE,0xB3,0x84,0x4F,0x68,
+	0xB4,0x0D,0xED,0xFD,0x03,0xBC,0x2C,0x89,0x72,0xE9,0x82,
+	0x19,0xB5,0x84,0x9C,0xA5,0x38,0xBA,0x44,0x8A,0xC0,0x8F,
+	0x8D,0x55,0xD1,0xE0,0xD7,0xB5,0x69,0xC2,0x85,0x05,0xCE,
+	0x33,0x83,0x4A,0x61,0x8E,0x68,0x72,0x9C,0x84,0x4F,0x83,
+	0x57,0x7C,0x50,0xE3,0x2B,0xF9,0xC8,0x33,0xF1,0x36,0x28,
+	0x5F,0x45,0xC7,0xEB,0x9A,0xC6,0x37,0x83,0xDE,0x57,0x4E,
+	0x9C,0x76,0xCF,0xA2,0x70,0xBA,0xF0,0x4F,0x7C,0x26,0x9C,
+	0xBF,0x7F,0xE8,0xE1,0x65,0xE3,0xE1,0x79,0xA1,0xFC,0xE3,
+	0x2B,0x6A,0x7E,0x93,0xF2,0xD7,0x27,0x6A,0x37,0x38,0x05,
+	0x18,0x61,0x0A,0xCE,0xB2,0xD6,0x1E,0x1E,0x8E,0x7D,0xF6,
+	0x6E,0xA1,0x8F,0x76,0xBC,0x8A,0x42,0x8D,0x73,0xE4,0xFC,
+	0x73,0x06,0x50,0x53,0xC5,0xFE,0x8E,0x06,0x27,0xCA,0x9C,
+	0xF0,0x8E,0x54,0xD8,0x35,0x8D,0x90,0x42,0x5F,0xFD,0x21,
+	0xBF,0x4B,0x88,0xA9,0x38,0x19,0x79,0x6A,0x2F,0xE2,0xF5,
+	0x17,0x5D,0xF4,0x2A,0xE1,0xE5,0x8C,0xE1,0x62,0x64,0xB9,
+	0x48,0xB2,0x77,0xFC,0x64,0xDA,0xD5,0xF3,0x8D,0x88,0x6C,
+	0x98,0x9D,0x6F,0xDA,0x8B,0xBF,0xC2,0xC4,0xA1,0x54,0xEB,
+	0x69,0x1B,0x13,0x52,0xD3,0x1D,0xBC,0x25,0x56,0x53,0xF1,
+	0x68,0xA1,0x3B,0xAD,0x84,0x2C,0x02,0x79,0xAF,0x83,0xE1,
+	0x31,0xDD,0x5C,0x73,0xA5,0x9A,0x2B,0xA9,0xCE,0x48,0x1C,
+	0x5D,0x33,0xED,0xC8,0xCD,0xB2,0x6C,0x2A,0xDE,0x48,0x55,
+	0x4A,0x5F,0x95,0x32,0x40,0x28,0x38,0xBF,0x6C,0x48,0x05,
+	0x5C,0xF6,0x18,0xFD,0x6D,0x6C,0xE8,0x5A,0xB7,0xD4,0x58,
+	0xD7,0xE5,0x86,0xF7,0xBC,0xC2,0x2D,0x30,0xFC,0x13,0xDD,
+	0x2C,0x83,0x16,0xC3,0x13,0x3D,0xEC,0xCD,0x67,0x48,0x95,
+	0x22,0xCF,0x28,0x3F,0xDC,0x74,0xB8,0x0E,0x44,0x92,0xC4,
+	0x93,0x5C,0xBA,0xC0,0x67,0x11,0xF7,0x67,0x92,0x65,0x6E,
+	0x37,0xBC,0x95,0x3E,0xA3,0x94,0x85,0xAD,0x9A,0x32,0x60,
+	0x1F,0x99,0x26,0x9B,0xFA,0x99,0xB2,0x4F,0x9B,0x9E,0x3C,
+	0xE5,0x45,0xB7,0x09,0x3D,0xF6,0xA0,0x12,0xD3,0xAC,0x49,
+	0x3A,0x68,0xD4,0x11,0xCE,0x34,0xC2,0xD4,0xD3,0x14,0x09,
+	0x74,0xDB,0x35,0x8D,0x37,0xD5,0xAE,0xAF,0xFA,0x72,0xA9,
+	0x3A,0x55,0xAA,0x0F,0x08,0xAC,0x76,0x23,0x26,0x83,0x0D,
+	0x97,0x63,0x6F,0x1C,0x8C,0x15,0x84,0x51,0x3F,0x29,0x87,
+	0x26,0xDC,0x68,0x5B,0x55,0x16,0x78,0x9A,0xF4,0xA9,0x1F,
+	0x6D,0xA2,0x75,0x60,0x8D,0xF6,0xD3,0x54,0x1C,0x0C,0x82,
+	0x8A,0x80,0x7D,0x8E,0x4E,0x6A,0x9B,0xA2,0x3A,0x2F,0xA1,
+	0x5F,0x0B,0x22,0x79,0xC3,0x42,0x0C,0xB2,0x3C,0xBD,0xB8,
+	0x23,0x0D,0x26,0x0D,0xB8,0x86,0x5B,0x55,0x62,0xF9,0xD4,
+	0x3A,0x00,0xFE,0x4F,0x5E,0x67,0xF6,0x27,0xD5,0x54,0xF1,
+	0xE6,0x87,0x7E,0x57,0x9C,0x34,0x20,0x2B,0xB5,0x9D,0x8B,
+	0x8B,0x3A,0x7B,0x00,0xA8,0xF2,0x36,0x31,0x06,0x98,0xA8,
+	0xA9,0x36,0x7B,0x3D,0x8F,0x4B,0x01,0xD4,0x33,0x76,0x79,
+	0xB5,0x13,0x39,0x93,0x0D,0xB5,0xB7,0x32,0x77,0x7C,0xEA,
+	0x62,0xF8,0xED,0x66,0xF8,0x1D,0xDD,0x19,0xDB,0xEE,0x73,
+	0x77,0xBD,0xDC,0x84,0x5A,0x75,0x34,0xB9,0xB7,0xDD,0x6D,
+	0xD0,0x07,0x5E,0x1E,0x2E,0xC4,0x8E,0x78,0xD4,0xB5,0x5E,
+	0xD3,0x59,0x11,0x8C,0x26,0x38,0xC2,0xF8,0x83,0x9E,0xEE,
+	0x21,0x9F,0x11,0x67,0x2F,0x95,0x05,0x79,0xAE,0xAF,0xAF,
+	0x90,0xF2,0x65,0xFD,0xDE,0xDA,0x8C,0x3E,0x84,0x70,0x16,
+	0x69,0x5C,0x8A,0x32,0x2C,0x36,0x33,0x12,0x03,0x18,0x69,
+	0x9B,0xE8,0xA7,0x88,0x18,0xE9,0xEB,0xE9,0x4A,0x5C,0x7B,
+	0x63,0x30,0xE7,0x01,0xC0,0x4B,0xB5,0xEC,0xD9,0xDB,0xC5,
+	0xA1,0x4E,0x00,0xE2,0x79,0x8C,0xF5,0x0E,0xC5,0x3D,0xCF,
+	0x6B,0xF2,0xDF,0x35,0xA1,0x1B,0x1B,0xFC,0x2A,0xC9,0x27,
+	0xC5,0x1B,0xE9,0xE4,0x64,0x0D,0xB7,0xE9,0xEB,0x1A,0xFE,
+	0x76,0x03,0x78,0xF5,0xED,0x18,0xD9,0xD6,0x8A,0x59,0x9C,
+	0x75,0xFA,0xD1,0xFD,0xB6,0x41,0x49,0x9B,0xD9,0x60,0x0B,
+	0x51,0xC9,0x4C,0x03,0xC2,0x79,0x63,0x4D,0x0F,0xE8,0x61,
+	0x64,0xDF,0x5C,0xC1,0xBE,0xAF,0x72,0x26,0x3A,0x29,0x9A,
+	0xDA,0x72,0xE2,0x43,0x45,0x6F,0xD5,0x7D,0x3D,0x25,0x5D,
+	0x0C,0xB5,0xEA,0x22,0x22,0xBE,0xD8,0x92,0xC2,0x31,0x9A,
+	0x0E,0x16,0x0D,0x92,0xBC,0x9D,0x27,0x88,0x09,0xBC,0x3B,
+	0x44,0xE7,0xEA,0x00,0x5A,0x68,0x94,0xDE,0xD8,0x4F,0x9B,
+	0x79,0xF4,0x4B,0xC1,0xAC,0x0F,0x95,0x58,0x37,0x7A,0x38,
+	0x59,0x2E,0x24,0x56,0x19,0xD4,0x9C,0x02,0x17,0x17,0xEF,
+	0x4B,0x79,0xF3,0xED,0xD4,0x95,0xCF,0x77,0xD0,0xE5,0x92,
+	0x9A,0xD7,0xA6,0xF5,0xA1,0x18,0xAE,0xDE,0xF4,0xC5,0x3B,
+	0x7D,0xDB,0x59,0x54,0xC9,0x92,0x3B,0x86,0x3E,0x1A,0xA3,
+	0x86,0xDA,0xED,0xC2,0x18,0xDF,0x0E,0x39,0xB9,0x86,0x5A,
+	0xFA,0x4C,0x28,0xC7,0xE0,0x2D,0xFA,0x8A,0x6A,0x95,0x0C,
+	0x3E,0x56,0xA2,0x0B,0x0A,0x06,0x7C,0xD5,0x14,0xCD,0x09,
+	0xCA,0xEC,0x95,0xBF,0x06,0xBC,0xA2,0xA8,0x15,0x2E,0x96,
+	0x15,0x8B,0x96,0x0A,0x7E,0x73,0x38,0x95,0x80,0x7B,0xA3,
+	0xDB,0x26,0xD9,0xF1,0x71,0x5D,0x98,0xA5,0xB4,0xF4,0x75,
+	0xD6,0x57,0xA3,0x7D,0x0F,0xA0,0x2E,0x2C,0xF5,0x14,0x23,
+	0x04,0x70,0xC5,0x5C,0xEE,0x9E,0x00,0x8B,0x1A,0x91,0x03,
+	0xF4,0x50,0x12,0x42,0x65,0xFC,0x40,0x1B,0xE0,0xE7,0xE9,
+	0xC5,0xBB,0xD2,0xAA,0x0E,0xBB,0x94,0xC6,0xD0,0xB8,0x19,
+	0xAF,0xA7,0x72,0xF5,0xE9,0x17,0x32,0x94,0x7A,0x4F,0x6B,
+	0xCC,0xD5,0xA5,0x9C,0x43,0x86,0xDA,0x83,0x92,0xB0,0xAE,
+	0xBF,0xF3,0xEC,0xAB,0x94,0x10,0x86,0xF7,0x7A,0xD7,0xB5,
+	0xDF,0x28,0xEA,0x0F,0x47,0xE1,0x2E,0x0D,0xA5,0x05,0x62,
+	0x29,0x6D,0xE0,0x17,0x33,0xCF,0xAE,0x59,0xAB,0x6E,0xBD,
+	0x5E,0xA6,0x42,0xE4,0xFC,0x54,0xCA,0xC3,0x78,0x77,0x71,
+	0x7C,0xC6,0x1A,0xBB,0x5A,0xAA,0x5F,0x7C,0xDC,0xEE,0x77,
+	0xE7,0x2E,0xBA,0x98,0xD1,0x4E,0xD2,0xE3,0xF0,0x31,0x59,
+	0x0A,0xD9,0xFB,0x5F,0x22,0x6E,0xFE,0xA4,0x6C,0xF2,0x39,
+	0x47,0x92,0x48,0xEA,0x85,0x5F,0x95,0xDD,0x39,0x1D,0x6A,
+	0xA9,0xE5,0xDA,0xBE,0x62,0x21,0xDF,0xBB,0x55,0xE7,0x4C,
+	0xDD,0x23,0xB8,0x2F,0x67,0x1D,0x8C,0x78,0x90,0xBC,0x85,
+	0xFC,0xBD,0xA1,0x52,0x56,0x15,0xE7,0xDA,0xC6,0x34,0xA0,
+	0x52,0x86,0x25,0x92,0x9A,0x1C,0x33,0xB0,0x77,0xC6,0x54,
+	0x1E,0x27,0x85,0x58,0x41,0x57,0x4E,0xD1,0x29,0xAE,0x13,
+	0x71,0xF1,0x27,0xDF,0x4E,0xAE,0x3C,0x22,0x7F,0xDF,0x20,
+	0x20,0x39,0x26,0xF3,0x01,0x45,0xB8,0x84,0x1D,0x4C,0x84,
+	0x2F,0xE7,0x3F,0xD5,0x34,0xED,0x78,0x35,0x64,0x3B,0x20,
+	0x44,0xB6,0xA3,0x00,0x2A,0xE4,0x6F,0x68,0xFD,0x28,0x99,
+	0xD0,0x9A,0x4A,0x43,0x73,0x09,0x6A,0xCD,0xA2,0xFC,0xA5,
+	0x13,0xC5,0xBE,0xDF,0x77,0x16,0x4F,0x21,0x0D,0xCE,0x94,
+	0x0A,0xDF,0x88,0x87,0x5A,0x13,0x14,0xBD,0x0C,0xDC,0xB4,
+	0x74,0xA9,0x13,0x99,0x5F,0x12,0x48,0x94,0x47,0xDE,0xA2,
+	0x8A,0xF1,0x28,0x4C,0xC0,0x00,0xAC,0xE4,0xF1,0x7D,0x07,
+	0xBA,0xEF,0xE6,0x33,0x60,0x5F,0x93,0xAE,0xA6,0xA3,0xA0,
+	0x81,0x5B,0x78,0xE9,0x13,0x1F,0x65,0x6D,0x0C,0x4D,0x27,
+	0x68,0x8E,0x63,0xF7,0xAE,0x93,0x4E,0x88,0x09,0xDD,0x3D,
+	0xFC,0x3C,0x6A,0x6F,0x43,0x4D,0x4D,0x45,0x24,0xA2,0x7E,
+	0x9B,0x2F,0x42,0xA4,0x29,0xB6,0x37,0xFD,0x02,0x44,0xCA,
+	0x10,0x00,0xCD,0x06,0x5E,0x48,0x39,0x1B,0xAA,0x84,0x7D,
+	0xC6,0x0D,0xF8,0x74,0x5D,0x1C,0xF3,0x6E,0xE6,0xFC,0x0A,
+	0x5C,0x21,0x39,0xF1,0x71,0x82,0xB4,0xB8,0x87,0x74,0xAC,
+	0xEE,0xFC,0xE5,0xA8,0xE6,0x45,0x24,0x66,0x20,0x91,0x96,
+	0xF6,0x24,0x1C,0x72,0x3D,0x41,0xDD,0x66,0x7D,0x90,0x1D,
+	0x5B,0x56,0x5F,0x61,0x7C,0x69,0xDA,0xA5,0xC1,0xA0,0x6D,
+	0x2D,0xF3,0xAD,0x45,0xAA,0xD2,0xA2,0x88,0x0A,0x17,0x5D,
+	0xF4,0x76,0x31,0xD5,0xE7,0x71,0x93,0x67,0xB0,0x82,0xA3,
+	0x8D,0xBD,0x3F,0x5E,0xCE,0x61,0xF1,0xFC,0x10,0xD4,0x27,
+	0x44,0x3A,0xDF,0xBE,0x29,0xF7,0x02,0xE4,0xDF,0x43,0x9B,
+	0xA8,0x48,0x38,0x35,0x7E,0x9B,0xD0,0x87,0x99,0x40,0x9E,
+	0xD0,0x00,0x10,0x1B,0xE0,0xA7,0x7C,0xE8,0x6D,0x3A,0x8E,
+	0x55,0x89,0x9A,0x59,0x31,0x2D,0xCE,0xBF,0x2B,0x6D,0x95,
+	0x21,0x72,0x16,0xFD,0x67,0xC5,0x8D,0x37,0x88,0x12,0xA4,
+	0xA2,0xAF,0xA2,0x2A,0xB8,0x54,0x4B,0x5D,0x21,0x6B,0x9E,
+	0x18,0xB0,0xDC,0x2B,0xCC,0x90,0xC4,0xCC,0x63,0xB9,0xCD,
+	0x32,0xB2,0x6A,0x9F,0x66,0xF9,0x37,0xC7,0x7E,0xEF,0x3E,
+	0xB4,0x51,0x91,0xEA,0x48,0x86,0xFB,0x7A,0x9E,0x14,0xF7,
+	0x3D,0x35,0x2E,0x10,0xAF,0x12,0xE7,0x8C,0xAF,0x34,0x9A,
+	0x6F,0x37,0xEF,0x7B,0x55,0x84,0xC3,0x4D,0xD8,0x8A,0x93,
+	0x69,0xCB,0x44,0x95,0x86,0xEE,0xD4,0x0D,0x8D,0x7F,0x3E,
+	0x9E,0xCF,0x7E,0x5A,0xF5,0x72,0x48,0x2B,0x83,0x1A,0x5F,
+	0x44,0x86,0x68,0x8A,0x0F,0x1F,0x0F,0x7E,0x70,0x10,0x09,
+	0xC2,0x3F,0xA0,0x76,0x98,0xFA,0x35,0xEF,0xDB,0xAE,0x36,
+	0x4A,0xF4,0x10,0x5C,0xAC,0xDD,0xDC,0xEC,0xE8,0xBC,0xF4,
+	0x5C,0xF3,0xFC,0x52,0x32,0x46,0x86,0x42,0x27,0x88,0x27,
+	0x21,0xB5,0x54,0x27,0x32,0x1B,0x0A,0xA3,0xD4,0x0C,0x24,
+	0xF4,0xCC,0x52,0x21,0x53,0x56,0xEE,0x26,0x19,0x0C,0xEC,
+	0x7B,0x01,0x78,0x40,0xCE,0x52,0xFF,0x4B,0x70,0x5D,0x9B,
+	0xF7,0x1D,0xB8,0x9E,0x36,0x97,0xA9,0x64,0x7A,0x02,0x4F,
+	0x96,0x38,0x99,0x0F,0xC7,0xA9,0xAF,0xDE,0xFB,0x62,0x11,
+	0x90,0x18,0xA1,0xC2,0x6F,0x0A,0xF5,0x23,0xC5,0x5C,0xF1,
+	0x05,0x41,0x83,0x52,0x46,0x0C,0x17,0x09,0xE0,0xBC,0x6E,
+	0x6B,0x57,0x49,0x42,0xA9,0xCB,0xA1,0x23,0xCE,0xDB,0xDA,
+	0x23,0xBE,0xD5,0xD1,0x95,0xE7,0xB7,0xB5,0x1D,0x81,0x7C,
+	0xB6,0x30,0x91,0x57,0x62,0xA0,0x17,0xB5,0xE8,0x14,0x22,
+	0x0A,0x63,0x83,0x00,0x02,0x36,0xFC,0xE2,0x9C,0x2D,0xDC,
+	0x4D,0xAE,0x5A,0x83,0x14,0x0C,0x55,0x78,0xAE,0x25,0xED,
+	0xAA,0xCE,0xB4,0xAB,0x8F,0xFF,0xB2,0x0E,0xBC,0x2E,0xAB,
+	0x14,0x7D,0xD3,0xBE,0x5B,0xC6,0x98,0xB4,0xE7,0xF2,0x02,
+	0xB0,0xA9,0x91,0x6B,0x37,0xA5,0xFD,0x28,0x76,0x25,0x24,
+	0x34,0x37,0x9D,0x80,0x59,0x8E,0x3F,0xE9,0x6B,0x1A,0x20,
+	0xEC,0xB9,0xA9,0x85,0x73,0x74,0x69,0xC8,0x54,0x4D,0x88,
+	0x0E,0xD3,0x52,0x6B,0x02,0x34,0x1B,0xB9,0xAD,0xDA,0xE0,
+	0x4F,0xF4,0x31,0x44,0xDE,0xB5,0x27,0xF2,0xF2,0xF3,0x90,
+	0xF5,0x42,0xEE,0x92,0xDC,0xED,0x3C,0xEE,0x60,0xBD,0x57,
+	0x30,0xE6,0xA5,0x59,0xA6,0x0A,0xE6,0x5F,0xD5,0xFA,0xF5,
+	0xF5,0x6B,0x2A,0x05,0xFB,0x1C,0xCF,0x21,0x9F,0x69,0xB9,
+	0xA7,0xDB,0xCE,0x12,0xAD,0x81,0xEF,0x0C,0x13,0x9D,0x5D,
+	0x15,0x19,0xAD,0xBB,0x99,0xA6,0x88,0x11,0xBD,0xC4,0xC7,
+	0xF7,0x8C,0xAF,0x13,0x0A,0x55,0x80,0xD8,0xE8,0x76,0xB0,
+	0xFA,0xC0,0x8C,0x53,0xB8,0x70,0x75,0x03,0x59,0xB7,0x58,
+	0x5C,0x4B,0x5C,0x0D,0xA0,0xA3,0x1C,0xC5,0x21,0x7B,0x2B,
+	0x9F,0xCB,0x4A,0xC8,0xB7,0x53,0x63,0xFA,0xB3,0x2E,0xA7,
+	0xB5,0x52,0x97,0xB6,0x9F,0xAD,0xDD,0x96,0x8B,0x9D,0xA7,
+	0x9D,0x8E,0xE9,0x87,0x36,0xD3,0x64,0x42,0x64,0x94,0xC8,
+	0xB7,0x90,0xEB,0xFE,0x15,0x9C,0xB1,0x18,0x15,0xF4,0x84,
+	0x0A,0x30,0x18,0x08,0xDC,0x7D,0x1A,0x83,0x54,0xE3,0xCD,
+	0xBE,0x35,0x29,0x21,0xF2,0xC2,0x5A,0x30,0xCF,0xB9,0xF8,
+	0x1A,0x1A,0x85,0x89,0x8D,0x68,0x2B,0xF2,0x57,0xD7,0x42,
+	0xD5,0xD8,0xDD,0x30,0x94,0x0F,0xD0,0x42,0x49,0xC8,0x7D,
+	0xD7,0x89,0x51,0x39,0xBC,0x74,0x31,0xFA,0x31,0xE5,0x5A,
+	0x42,0xDF,0x78,0x81,0x96,0x00,0x34,0x48,0x03,0x64,0x61,
+	0x4A,0xBA,0x82,0x03,0xFE,0xF4,0xDB,0x75,0x37,0x13,0x6F,
+	0x08,0xB5,0x16,0x53,0xF2,0xC6,0xBA,0xA2,0xE8,0x9B,0x66,
+	0xB6,0x04,0xC3,0xFB,0xD0,0x8B,0xD3,0x62,0xBC,0x1D,0xBA,
+	0x0E,0x26,0x4E,0xEF,0x4B,0xDD,0x2C,0x1A,0x2E,0xF6,0x51,
+	0x8A,0x48,0x0D,0x32,0x2A,0xA3,0x9C,0x76,0xA3,0x37,0x31,
+	0xA6,0x47,0x7E,0xCB,0x46,0x60,0x9C,0xE8,0xE5,0xCA,0x37,
+	0x99,0xBD,0x7D,0x0B,0xCE,0xD3,0xF1,0x4E,0x5F,0xDF,0x9A,
+	0x03,0x2C,0xDF,0xD4,0x0D,0x08,0xE2,0xC8,0x8F,0x71,0x13,
+	0x9E,0x75,0xDE,0x9A,0xB1,0x0D,0xA6,0x0D,0x42,0x67,0xE6,
+	0xE3,0x4E,0x9D,0xAC,0x0E,0xB3,0x33,0x10,0xD6,0xEE,0x96,
+	0xFD,0x60,0x2D,0x28,0xF9,0x5D,0xB3,0x86,0x47,0xB1,0x24,
+	0x9B,0xD9,0x49,0xBD,0x77,0x81,0x77,0x39,0x61,0xC4,0xE0,
+	0x12,0x26,0x4D,0x4F,0x57,0x4E,0xAC,0xC1,0xFE,0x84,0x3A,
+	0xDC,0xEA,0xF5,0xC0,0x95,0xA6,0x7B,0xE5,0xFF,0x03,0x64,
+	0xC4,0x8D,0x1B,0xFB,0x23,0x6A,0x9A,0xDB,0xF1,0x12,0xB2,
+	0xDC,0x76,0x01,0x38,0x29,0x49,0xF0,0xDA,0x12,0xE9,0x31,
+	0xCA,0x26,0xC4,0xEB,0x53,0x23,0x2C,0x41,0xF1,0x82,0xAA,
+	0xF5,0x46,0x64,0xB5,0x1C,0xFC,0x23,0x5A,0x17,0xBA,0xA7,
+	0x43,0x90,0xDB,0xAA,0xDD,0x0C,0xAB,0x97,0x28,0xAB,0x89,
+	0x67,0x81,0x9E,0x6B,0xA7,0x8B,0x65,0xCE,0x79,0x38,0xEA,
+	0x5C,0x12,0x20,0x53,0x0A,0x84,0xF2,0x26,0xAB,0x9A,0x14,
+	0x7B,0x15,0xBF,0xB4,0xA3,0x45,0x8B,0xC4,0xC1,0x33,0x17,
+	0x71,0x3F,0x0A,0x65,0xB3,0xF2,0x2F,0x8E,0x7C,0x7B,0xDF,
+	0x0F,0x9F,0x34,0x8F,0x8D,0xA3,0x72,0x4D,0xDE,0xBC,0xC7,
+	0x65,0x83,0x5A,0x8D,0x8F,0x89,0x43,0x1A,0x47,0x4A,0xF3,
+	0x02,0x96,0x45,0x06,0x9A,0x1C,0x4E,0x35,0x24,0x30,0x5E,
+	0xCC,0x69,0x5E,0xBD,0xA1,0xC6,0x75,0x89,0xD5,0x8E,0xE1,
+	0xCB,0xD0,0xD3,0x37,0x30,0x34,0x32,0xDE,0x36,0xB1,0xB6,
+	0xC1,0x76,0xD6,0xE2,0x00,0x29,0xDA,0x7F,0xBC,0x68,0x63,
+	0x6A,0x29,0x44,0x4F,0xD4,0xA6,0x27,0xD1,0x24,0x56,0xA1,
+	0xB4,0x9A,0x02,0xF9,0x25,0x35,0x23,0x4F,0x77,0x76,0x7C,
+	0x8E,0x62,0x5C,0x89,0xD7,0x7C,0x6D,0xED,0x71,0xE7,0xB9,
+	0x1A,0x20,0x3D,0xD0,0xD9,0xA8,0xCE,0xF8,0x89,0x78,0xBF,
+	0xBF,0x45,0x42,0xB2,0x2F,0xAC,0xD7,0x2A,0x29,0x5C,0x47,
+	0xF5,0x96,0x72,0xAA,0x5D,0x44,0x9F,0xE1,0x5C,0xA2,0x9A,
+	0x82,0x8A,0x98,0x9E,0xFC,0xD8,0x81,0xBD,0x14,0xCC,0xCC,
+	0xBA,0xD2,0x5B,0x7B,0x81,0x6F,0x5A,0xC1,0x89,0x27,0x06,
+	0x7E,0x75,0x7C,0x50,0xBF,0x04,0x03,0xB9,0x3D,0xF5,0x3F,
+	0x5E,0xE7,0xA0,0xCB,0xD2,0x5D,0xF1,0xDE,0xBB,0x56,0x4F,
+	0xC4,0x34,0xCF,0xB9,0xE0,0x09,0x04,0xA2,0x78,0x5E,0xF8,
+	0xF3,0x3E,0x6B,0x6F,0xF5,0x31,0x5B,0x34,0x0D,0x55,0xAD,
+	0xB2,0x59,0x15,0x6F,0xE1,0xE1,0x6C,0x3A,0xE6,0xB8,0x2E,
+	0x6A,0x63,0x17,0x78,0xC6,0xBE,0xD5,0xE1,0xBC,0x3D,0x04,
+	0x6F,0x9F,0xCA,0x2D,0x62,0x5D,0x35,0x2A,0xF2,0x55,0x69,
+	0xCA,0xCE,0x83,0x65,0x4D,0x20,0xD8,0xD5,0xA3,0x85,0x67,
+	0xB1,0xF8,0x29,0x47,0x8D,0x18,0xC6,0x7E,0xFC,0x5D,0xF7,
+	0x49,0x79,0xC3,0x55,0x00,0x97,0xB5,0x41,0x21,0x51,0x20,
+	0x4E,0xBB,0x10,0xD0,0xDF,0x58,0xAE,0x89,0xC5,0x73,0x33,
+	0x14,0x01,0x7D,0x21,0xA6,0xFD,0xD8,0x1A,0xCD,0x00,0x08,
+	0x6B,0x11,0x85,0xBE,0x23,0x09,0x48,0xCE,0x3F,0x91,0x67,
+	0xC6,0x96,0x53,0x50,0x54,0x52,0x41,0x5B,0x05,0xEF,0xA7,
+	0x9F,0x3D,0x07,0x20,0xD8,0x66,0xAA,0x32,0x5F,0x28,0xB8,
+	0x7F,0x83,0x4E,0x84,0x47,0x3D,0x0E,0x60,0xEA,0xE8,0xB8,
+	0x9F,0xC1,0xA8,0x01,0x67,0x0E,0xE1,0x28,0x38,0xEC,0x6A,
+	0x1C,0x1C,0x08,0x93,0x6F,0x54,0xB4,0x2A,0x97,0xB2,0xCB,
+	0x5A,0xCE,0xBA,0xF5,0xDC,0xAB,0x22,0x35,0xC9,0xD6,0x57,
+	0x46,0x21,0x2E,0x13,0xFF,0x5D,0xAF,0x1A,0x30,0xF6,0x68,
+	0xB9,0x69,0xF3,0x5F,0x43,0x64,0x6C,0xC8,0x87,0xFE,0xF0,
+	0xA6,0x3A,0x83,0x58,0xAA,0xCB,0xA7,0xE0,0x0B,0xA7,0xA9,
+	0xFF,0xF4,0x30,0xA5,0xB7,0xE8,0x98,0x5E,0xB9,0xD5,0x80,
+	0xDC,0x9A,0xC8,0xDB,0x36,0x28,0x1F,0x71,0xFE,0x9F,0x45,
+	0x80,0x03,0x7E,0x40,0xE2,0x63,0xE4,0x8F,0x38,0xBE,0xB5,
+	0x1D,0x1E,0x29,0xA8,0x39,0x5E,0x38,0xBD,0x45,0x30,0x44,
+	0xBC,0x72,0xF0,0x05,0xFD,0xB7,0x02,0xCC,0x83,0x6B,0x94,
+	0x08,0x7B,0xD4,0xC2,0x9B,0xAA,0x23,0x87,0x84,0x1C,0x59,
+	0x60,0xDD,0xB1,0x9E,0x95,0xD7,0x15,0x65,0x9A,0xE1,0x27,
+	0x5E,0x3A,0x90,0xBF,0xB8,0x99,0xAD,0x2F,0x19,0x22,0xC4,
+	0x15,0x38,0x74,0xF4,0xB4,0xD9,0xB7,0x53,0x12,0x41,0x4D,
+	0x53,0xA8,0x07,0x33,0xB6,0xBC,0x62,0x02,0x51,0x89,0x66,
+	0xF5,0x17,0x39,0x79,0x5A,0x8C,0x5B,0x73,0xC3,0xAC,0xE5,
+	0x1F,0x60,0x39,0x50,0x4D,0x53,0x80,0x66,0xE7,0x3A,0x65,
+	0x80,0x39,0x96,0x12,0xF2,0x59,0xBB,0x5D,0x02,0x4D,0xB8,
+	0x76,0xAD,0x15,0x82,0x05,0xAE,0xD9,0x02,0x2E,0x9F,0x9E,
+	0xA1,0xBF,0x59,0xF8,0x0D,0xA0,0x40,0xF5,0x42,0x14,0x27,
+	0x79,0x42,0xEA,0x0B,0x18,0x73,0xD6,0x06,0x8F,0xDE,0xDA,
+	0x5C,0x37,0x3C,0xE7,0xEC,0x8A,0x59,0x94,0xD8,0xCD,0xE2,
+	0xFE,0x4E,0x8F,0xF7,0xEB,0x7E,0xFA,0x2C,0xE9,0xFB,0x05,
+	0x44,0x7A,0x80,0x36,0x29,0x2D,0x74,0x8A,0x16,0xFF,0x8A,
+	0x14,0xD7,0x88,0x10,0x5C,0x5F,0x14,0x55,0xCA,0xDF,0x46,
+	0x0D,0xF2,0x68,0xF7,0xC9,0x91,0xEB,0x46,0xA3,0x22,0xE2,
+	0xC1,0x17,0x0D,0xE5,0x64,0x54,0x09,0x46,0xDF,0x75,0xD5,
+	0xC8,0xEF,0x72,0x65,0x94,0x2A,0xEA,0x90,0x4A,0x1B,0x8F,
+	0xB8,0xFD,0x6F,0xD2,0xE0,0x37,0xE4,0x2F,0xED,0x16,0x25,
+	0x28,0x9A,0x8C,0x3E,0x4A,0x20,0xC6,0xD8,0xFA,0xDB,0x95,
+	0x8C,0xAB,0xEA,0xCF,0x69,0x6B,0x62,0xB1,0x94,0xE6,0x97,
+	0xEF,0xD4,0x04,0x1C,0x30,0x40,0x78,0xC8,0xBD,0x93,0xBE,
+	0xCA,0x0A,0x10,0x05,0x0E,0xCA,0xEB,0x15,0xEA,0xBB,0x98,
+	0x8B,0x4A,0x57,0x96,0xB1,0xFE,0xE2,0x1E,0x02,0x4A,0x66,
+	0x8F,0x1C,0xED,0xB5,0x73,0xCF,0x0E,0x2A,0xBA,0xAA,0x56,
+	0xC8,0xB2,0x17,0xD2,0xD3,0x9A,0xD4,0x24,0xA6,0x3F,0x68,
+	0x4A,0x41,0x50,0x57,0x5E,0x0A,0xC6,0xB6,0xF2,0xC6,0x44,
+	0xD0,0x9D,0x25,0x0D,0x11,0x82,0xCF,0xB1,0x80,0xE8,0xF8,
+	0x7C,0x00,0x49,0xA4,0x43,0x51,0xC3,0xD9,0x84,0xF3,0x7F,
+	0x35,0xEB,0xAC,0x0E,0x36,0x5B,0x7B,0xCE,0x7B,0xDE,0x80,
+	0x1A,0x5A,0xCA,0x8F,0x10,0x20,0xFE,0x9D,0x88,0xC4,0x3C,
+	0x00,0xE7,0xC6,0x7E,0xBF,0x78,0xE9,0x42,0xC9,0x53,0x9B,
+	0x53,0xB1,0x22,0xCD,0x15,0x6F,0x9D,0xEA,0x22,0xB5,0x4A,
+	0x7C,0x17,0x1B,0x68,0x1B,0xAA,0x17,0x20,0x0A,0xE7,0xC8,
+	0x84,0xF3,0x0B,0x6A,0x20,0x0C,0x98,0xA8,0x93,0x5D,0xDB,
+	0x20,0x70,0x2D,0x6C,0x0E,0x1D,0x72,0xE7,0x1E,0xE2,0xDA,
+	0x2E,0x12,0xE0,0x82,0x84,0xF9,0xC9,0xF3,0x94,0xB5,0xA6,
+	0xE7,0xE6,0xE5,0x5D,0x56,0x69,0xC0,0x79,0x0B,0x83,0x2F,
+	0x2C,0x22,0x7E,0x22,0x47,0x2E,0xCB,0x37,0xC7,0x26,0xF2,
+	0xAB,0x55,0x1A,0x54,0x48,0x4D,0x19,0xBA,0x88,0x17,0xB3,
+	0x95,0xC8,0x39,0xA8,0xC5,0x02,0x78,0xF9,0xF9,0xBF,0xF6,
+	0xAD,0x4A,0xE7,0x03,0xBC,0x3F,0xBC,0x41,0x01,0x4F,0x91,
+	0x2A,0x6E,0x70,0x61,0xF2,0xE3,0x31,0x59,0x4B,0x54,0x93,
+	0xCC,0x45,0x3D,0xE6,0xDB,0xD8,0xC1,0x4D,0x80,0xF4,0x30,
+	0x83,0x4F,0xF7,0x22,0x36,0x30,0x7B,0xE4,0x82,0xD6,0x31,
+	0xD6,0x06,0x10,0xE3,0x9E,0x8C,0x3D,0x2F,0xD4,0x64,0x7B,
+	0x52,0xB9,0x46,0x97,0x03,0x9B,0xD8,0x51,0xF6,0x58,0x87,
+	0xE2,0x44,0x35,0x89,0x6F,0xB5,0x04,0xD4,0x70,0xA3,0xE3,
+	0x12,0xE1,0xDD,0x00,0x0F,0x58,0xEA,0xD3,0x45,0x58,0x95,
+	0x4F,0xE4,0x09,0x17,0xD4,0x84,0xA6,0xFF,0x17,0x5A,0xB6,
+	0x95,0x26,0xAB,0x3E,0xE0,0x81,0x66,0x95,0x9D,0x9C,0xD6,
+	0xBD,0x73,0x81,0x9A,0x31,0x61,0x4A,0x80,0x48,0x88,0x01,
+	0xC2,0xA7,0x2A,0xBF,0x52,0xC9,0x77,0x87,0xAA,0x3F,0x29,
+	0xC5,0xBF,0x02,0x34,0x6D,0x35,0x88,0x1D,0x19,0xB4,0xF7,
+	0x78,0x60,0x09,0x40,0x85,0x65,0x4F,0x68,0xA8,0x41,0x4D,
+	0x66,0xC8,0x8C,0x69,0x2A,0xD2,0x49,0xE0,0xED,0xAB,0x0A,
+	0x17,0x35,0x2E,0x1B,0x19,0xA7,0xCD,0x7E,0x6F,0x1D,0x4C,
+	0x84,0x50,0x68,0x93,0x25,0x91,0x16,0x48,0x86,0x8C,0x84,
+	0xD7,0xF0,0x64,0x3E,0x3F,0x2D,0x43,0x39,0x1F,0xFC,0x1C,
+	0xA5,0xDA,0x44,0x45,0x9A,0x51,0x89,0xBC,0xEF,0x15,0xE5,
+	0xC6,0x94,0xF1,0xC3,0xAA,0x93,0xAB,0x99,0xE1,0x82,0x32,
+	0xF8,0xF3,0xEB,0x1C,0x91,0x5D,0x1E,0x62,0x77,0xA1,0xA2,
+	0x02,0x15,0x57,0x9C,0x3C,0x0D,0x03,0x7C,0xD1,0x7B,0x60,
+	0xC5,0x27,0x6D,0x10,0x1B,0xFF,0x58,0xFC,0x1C,0xA9,0x86,
+	0x4B,0x9C,0xCA,0xF7,0xD0,0x86,0x1E,0x35,0x6E,0xE0,0xA2,
+	0xCA,0xCD,0xD2,0xB4,0xBA,0x7E,0x82,0x0C,0xB9,0x7C,0x41,
+	0xD3,0x7D,0x34,0x15,0xF4,0x4A,0x1C,0xF3,0x31,0xCB,0xDE,
+	0x16,0x6E,0x9B,0x84,0x6A,0x49,0x2D,0xC0,0xC2,0x7A,0x83,
+	0xC3,0x92,0x1C,0x54,0x29,0xBB,0xF7,0x81,0xB5,0xDB,0x6E,
+	0x12,0x9E,0xBD,0x00,0xDF,0x66,0x33,0x25,0x43,0x32,0xC5,
+	0xBB,0x2E,0xA5,0xCF,0x80,0xED,0x43,0xDC,0x49,0xB1,0x59,
+	0x32,0x82,0xDB,0x69,0x59,0xB5,0x9C,0x8E,0x52,0x6F,0xBF,
+	0x5A,0x6A,0xBB,0x2B,0x62,0x27,0x32,0x1B,0xF6,0x98,0x9E,
+	0xE8,0x7F,0x9B,0x09,0xEB,0xCB,0x24,0xC1,0xAC,0xAE,0xBC,
+	0xD1,0x69,0x36,0x01,0x24,0x45,0xDD,0xBF,0x9D,0x6F,0x68,
+	0x43,0xD5,0x6B,0x13,0x5C,0xBA,0x15,0xAE,0x62,0xEF,0xD6,
+	0xE2,0x05,0xE2,0x8E,0xD6,0x0C,0x4F,0x7D,0x92,0x94,0x15,
+	0xBB,0x95,0x06,0x6E,0x58,0x4B,0x7D,0xC6,0x5A,0xCB,0x0B,
+	0xCF,0xE5,0x09,0x5F,0xE4,0x67,0x69,0xEB,0xF6,0x06,0xF9,
+	0x03,0x48,0x63,0xA3,0x92,0x54,0xBE,0x29,0x83,0x3F,0xC6,
+	0xFD,0x25,0x01,0x90,0x98,0x42,0x3B,0xF9,0x00,0x5B,0x09,
+	0x61,0x9F,0x02,0xF5,0xBE,0x5B,0xFF,0x93,0xE4,0x72,0x84,
+	0xB5,0x6A,0xDF,0x27,0x51,0x15,0x2F,0xFF,0x6D,0x6D,0x6F,
+	0x7F,0x53,0x05,0x4A,0x60,0x67,0x20,0xCF,0xC9,0xBF,0x60,
+	0xAF,0x6D,0x9C,0xE9,0x2F,0x00,0x67,0x8F,0x07,0xD8,0x36,
+	0x30,0xC4,0xC4,0xC3,0xB3,0xC8,0x54,0x67,0x62,0x0B,0xA5,
+	0xED,0x66,0x1A,0x8B,0xCB,0x5C,0xD7,0xD7,0xE7,0xA1,0xAE,
+	0xAB,0x10,0x95,0x8B,0x7F,0x57,0x7A,0x80,0x97,0x6C,0x03,
+	0xE8,0x25,0x04,0xF4,0xD2,0x66,0xD6,0xD0,0x61,0x9F,0xA6,
+	0xD9,0x86,0x42,0x5E,0x6A,0xC3,0xA9,0x11,0x63,0x30,0xAD,
+	0xA6,0xC2,0xDC,0xFF,0x24,0xFC,0x88,0x86,0x1D,0x45,0x50,
+	0x61,0xAF,0x5B,0x74,0x74,0x05,0xBD,0x05,0x6C,0x1D,0x54,
+	0x5E,0xBB,0x3D,0xF9,0x60,0x95,0xA0,0x2D,0x77,0x32,0xBB,
+	0x85,0xF3,0xD9,0x94,0xE3,0x5B,0x5B,0x43,0x1B,0xD5,0xA7,
+	0xDF,0xBA,0xD3,0xC0,0xAD,0x26,0x54,0x83,0x10,0x2F,0x70,
+	0xD5,0xEF,0x99,0xCC,0x76,0x50,0x64,0xA4,0x34,0x77,0x12,
+	0x73,0x69,0x59,0x68,0xB2,0xE3,0xC9,0x80,0xF0,0x40,0x9E,
+	0x4B,0xD8,0x07,0x87,0x93,0x8E,0x04,0xE6,0xA9,0x2B,0x3F,
+	0x9A,0xA8,0x65,0xFE,0x06,0x8E,0xD1,0x2F,0xEB,0x3E,0xB7,
+	0xA0,0xDA,0xF2,0x30,0x8F,0x35,0xFB,0xDC,0xBC,0x9B,0xC4,
+	0xCF,0xDF,0x26,0x03,0xBA,0x0B,0xA0,0x4A,0x92,0x25,0x66,
+	0x1C,0x1D,0xAA,0xE9,0xD5,0xB8,0x3A,0xBC,0x99,0x5A,0x19,
+	0xD2,0xCB,0x5A,0xC5,0x2B,0x7E,0x38,0x2C,0x01,0xBE,0xF9,
+	0x7C,0x42,0x23,0xAD,0x1C,0x30,0xE3,0xF2,0x1D,0x60,0x05,
+	0x27,0x24,0x19,0xE5,0xFE,0x9D,0x92,0x7D,0xE1,0x16,0xE9,
+	0x8E,0x82,0xF7,0x3A,0x5B,0x4D,0x89,0xDE,0x33,0x9B,0xD2,
+	0x13,0xAF,0xF2,0x51,0xF2,0xEE,0x7F,0x09,0x8B,0x7D,0xAD,
+	0x86,0x95,0x98,0x32,0x9D,0xF7,0xE5,0x34,0x04,0xFA,0xE9,
+	0x01,0x93,0x4D,0x66,0x9F,0xAD,0x21,0xA3,0x62,0x5A,0xA3,
+	0xFC,0x6D,0xF8,0x41,0x31,0x73,0xC5,0x4B,0x98,0x72,0x31,
+	0x57,0xD4,0xD2,0x8B,0x5B,0x82,0xFA,0x97,0x9F,0xDB,0xA5,
+	0x4A,0xD5,0xC8,0x94,0x5F,0x73,0x90,0xD3,0x64,0xEA,0xDC,
+	0x27,0x4C,0xBB,0xDA,0x88,0x29,0x0C,0x7F,0xB5,0xD6,0x3D,
+	0x9C,0x5E,0x86,0xE7,0xDC,0x57,0xCA,0x91,0x4D,0x48,0xB5,
+	0x73,0x40,0x7D,0xD2,0x76,0xB6,0xE0,0x22,0xCA,0x36,0x58,
+	0x2A,0xC2,0xFC,0x2A,0xFB,0x2E,0x83,0xA6,0x4A,0x93,0x1C,
+	0xF9,0x35,0xDA,0x70,0xD4,0x43,0x53,0x6D,0xED,0x14,0x40,
+	0x88,0xD6,0x66,0x74,0xCD,0x7F,0xF1,0xFE,0x12,0x91,0x55,
+	0xDA,0x71,0x2B,0xD1,0xA9,0x67,0x24,0x7E,0xE7,0xAA,0xCC,
+	0x44,0xD2,0x46,0x14,0x58,0xD8,0x3C,0x0E,0x50,0x59,0xE9,
+	0x4B,0xDF,0x6F,0x24,0xB3,0xDA,0x30,0x9A,0xAF,0xD4,0xEE,
+	0x66,0x62,0xAF,0x54,0x2A,0x0A,0x9D,0x63,0xDE,0x9B,0x15,
+	0x76,0x16,0x65,0x9E,0x74,0x85,0x3B,0xB4,0xD0,0xEA,0x53,
+	0x6B,0x38,0x35,0x3F,0x47,0x6C,0x68,0x3C,0xC8,0xB2,0x60,
+	0xCC,0x81,0xDA,0x02,0xBA,0x1A,0xFA,0x03,0xB8,0xA6,0x84,
+	0x11,0x8F,0xE2,0x9F,0x47,0xA5,0x7B,0xFB,0x6F,0x1A,0x9A,
+	0xA2,0x6A,0xCD,0xCC,0xC9,0x5C,0xF5,0x56,0x16,0xB1,0x45,
+	0x5A,0x46,0x4C,0x34,0x35,0xB4,0x45,0x8B,0xD8,0xEF,0xF0,
+	0xCC,0xE2,0x7E,0x14,0x89,0xA0,0x50,0xED,0x94,0x98,0x2F,
+	0x5E,0xA6,0xFA,0x9B,0x59,0x13,0xAF,0x81,0x4F,0x4D,0xA0,
+	0xC4,0x77,0x10,0x3F,0xBC,0xE0,0xF6,0xB9,0x65,0x4D,0x8D,
+	0xFE,0x4E,0x86,0x41,0x13,0x5B,0x72,0x5B,0xFC,0x28,0x86,
+	0x45,0x34,0x4D,0x2E,0x1A,0x4B,0xEA,0x1F,0xD0,0x3F,0x9C,
+	0x7C,0x14,0x6C,0x10,0x15,0x2B,0xE5,0x90,0xC8,0xC6,0x20,
+	0x75,0xC6,0x6E,0xD2,0x72,0x1E,0x45,0x02,0x9E,0xC1,0xA4,
+	0xA1,0x02,0xA1,0x82,0x9F,0x41,0x4D,0x0F,0x6A,0x04,0x54,
+	0x79,0x40,0xD1,0x93,0x27,0xEE,0xD9,0x21,0x74,0x0A,0x91,
+	0x84,0xE5,0x59,0x09,0x20,0xAE,0xFF,0xE1,0x88,0xD4,0x97,
+	0x4E,0x67,0xD5,0x46,0x8D,0x4C,0xB5,0xC6,0xFA,0x2C,0xE2,
+	0xDA,0x25,0x55,0x0D,0x45,0x62,0x7F,0x76,0xC8,0xC0,0xEE,
+	0x43,0x35,0xCE,0xA4,0x53,0xA0,0x5C,0xBB,0xDB,0xC0,0x94,
+	0xE7,0x36,0x5A,0x4E,0x36,0x17,0x57,0xED,0x2A,0x46,0x2B,
+	0x26,0x9B,0x87,0xD4,0xC4,0x3E,0x87,0x07,0x7D,0xD8,0xF7,
+	0x0F,0xAB,0x2A,0xE6,0x0D,0x77,0x35,0xF2,0xA0,0x9A,0xA0,
+	0x7B,0x1D,0xB1,0x49,0x54,0x23,0xF5,0x05,0x7B,0x1D,0x57,
+	0x7E,0xED,0x6A,0x3D,0x73,0x5F,0x6A,0x0A,0x3B,0x3F,0x25,
+	0xEB,0x2C,0x0F,0x67,0x42,0xF7,0x31,0x09,0x9C,0x75,0x7A,
+	0x51,0xFB,0x54,0xB2,0x3C,0xE0,0xD6,0x8A,0x48,0xF6,0xAD,
+	0x57,0x6F,0x4E,0x0F,0xAD,0xBA,0xA4,0x78,0xAF,0x29,0x8C,
+	0x82,0x12,0x7D,0xE5,0x06,0x30,0xE9,0x5F,0xCC,0x71,0xBA,
+	0xE7,0xE3,0x89,0x58,0x55,0xF4,0x29,0x87,0x8F,0x05,0x7A,
+	0x47,0x61,0xC2,0x98,0x54,0xE3,0x68,0xC7,0x34,0xEC,0xB8,
+	0x1B,0x46,0x00,0xE1,0x2B,0xD7,0xFD,0xE9,0x23,0x19,0x00,
+	0xBD,0xC7,0xF1,0x39,0x78,0x42,0x3A,0x58,0x54,0x53,0xD9,
+	0x0E,0x73,0xB7,0x69,0x41,0x4A,0x5B,0x07,0x3C,0x5C,0x39,
+	0x01,0x71,0x29,0xF0,0xFD,0xA4,0xE9,0xC6,0xA5,0x93,0xB9,
+	0x24,0xB4,0xAE,0x01,0x00,0xC5,0xEA,0x18,0x37,0x18,0xDB,
+	0xDC,0xF6,0x16,0xC2,0xAD,0x69,0xEE,0x24,0x0F,0xE3,0x27,
+	0x28,0x58,0x8E,0x12,0x10,0x59,0x9F,0x13,0xFF,0xD2,0x00,
+	0xDD,0x7D,0x31,0xBC,0xB0,0xFA,0xB6,0x60,0x44,0xC6,0x97,
+	0x13,0xA3,0xA0,0x04,0x90,0x4A,0x7E,0x1E,0x67,0xFE,0x93,
+	0x7F,0x4A,0xE5,0x27,0xFA,0xED,0xC6,0x8F,0xD4,0x3F,0xCB,
+	0xF0,0x9C,0x84,0x5D,0x11,0x33,0x2E,0x18,0xB8,0x1A,0xE1,
+	0x28,0x17,0x97,0x53,0x99,0xA9,0xAB,0x4F,0x51,0xD5,0xF9,
+	0x6B,0xAB,0x5C,0x6D,0x81,0x4E,0xE5,0x56,0x78,0xA0,0x54,
+	0xE1,0xE2,0x78,0x43,0xA5,0x1B,0x07,0x0C,0x75,0xC6,0xF8,
+	0x16,0x85,0xE4,0xE2,0x7E,0x46,0x3C,0xAC,0xA5,0x58,0xED,
+	0xBE,0x3E,0xCB,0x43,0xAD,0xB0,0xC3,0x4D,0xA5,0xC6,0x04,
+	0x5E,0x9B,0xD0,0xA1,0x9A,0xA1,0x9E,0x87,0xC2,0xC0,0x05,
+	0x57,0x99,0x7C,0xF2,0xAA,0x6E,0xDD,0xA7,0x54,0x74,0x69,
+	0x2D,0x11,0xA4,0x73,0x8F,0x07,0x97,0x63,0x79,0xCA,0x35,
+	0xCD,0xC8,0x9F,0x5F,0xA7,0x72,0xA8,0xBD,0x1A,0xD7,0xE7,
+	0x8C,0x9F,0x32,0xF3,0xFF,0x87,0xA4,0xDE,0xE2,0x4C,0x3F,
+	0x73,0x91,0x4F,0xAB,0xF7,0xD2,0x91,0x83,0xB5,0xBB,0x2D,
+	0xD6,0xBA,0xE1,0x8A,0x5A,0x04,0xE2,0xD9,0x62,0x7A,0x99,
+	0x84,0xE1,0x35,0x91,0x6E,0xE5,0x5C,0x85,0x87,0x73,0x42,
+	0xE9,0x94,0x26,0xBD,0xD7,0xAA,0x00,0x8E,0x47,0x9C,0xD6,
+	0xE9,0x3A,0xFF,0x14,0xA4,0x1C,0x2F,0x85,0x15,0xAA,0x49,
+	0x4D,0xA9,0x85,0xDE,0xF2,0x76,0x1F,0x45,0x5E,0x1A,0xA8,
+	0xAD,0xEC,0x2D,0x9C,0x94,0x2A,0xB8,0x62,0x25,0x18,0xDE,
+	0x9F,0x6D,0xF0,0xB1,0x17,0xD1,0xE0,0xBE,0xA4,0xF6,0x0F,
+	0xEC,0xB9,0x88,0x1C,0x28,0x44,0x78,0xC7,0x49,0x93,0xB7,
+	0x9A,0x8A,0x26,0xDC,0x9B,0xEE,0x54,0x68,0xC7,0x89,0x41,
+	0x4F,0xF8,0xCB,0xA9,0x91,0x1C,0x62,0xED,0x2E,0xAE,0x57,
+	0xD8,0x5D,0xE7,0xC9,0x7D,0xA8,0x14,0x1D,0xA4,0x01,0xE3,
+	0x55,0xF6,0xD8,0x9D,0x95,0x13,0x02,0xA1,0x7A,0xCB,0x8D,
+	0x38,0x2A,0x34,0x45,0x2F,0x9E,0x7E,0xA1,0x06,0x30,0x48,
+	0x94,0xCB,0xCC,0xEB,0x23,0xF5,0xBB,0xF1,0x3C,0xF3,0x09,
+	0xAF,0xD5,0x73,0xAC,0x26,0xD3,0x72,0x7B,0xB3,0x14,0x35,
+	0x11,0x72,0xA4,0x41,0x46,0x73,0x7C,0x67,0xCC,0x1A,0xB4,
+	0xD2,0x8B,0x0E,0x06,0xBA,0x53,0xCC,0xB5,0x85,0x5B,0x8B,
+	0x3F,0xEA,0x8B,0x1F,0x6B,0x43,0x6F,0x19,0x0A,0x2C,0xE9,
+	0xC5,0x8F,0x93,0x1B,0xBA,0xBF,0x69,0x67,0x82,0xC8,0x4E,
+	0xB9,0xE3,0xA3,0x99,0xD2,0x75,0x37,0x23,0x51,0xCF,0x50,
+	0x61,0x88,0x57,0xA4,0x9E,0x09,0xED,0xB0,0xE6,0x35,0x03,
+	0xA5,0xE0,0x93,0x7A,0x41,0x73,0x5F,0x25,0xF2,0x2D,0x42,
+	0xE4,0x57,0xF4,0xF5,0xAB,0x55,0x2D,0x58,0x7D,0xFD,0x32,
+	0x59,0xE5,0xEF,0xC5,0xB1,0x54,0xCF,0xC0,0x58,0x35,0x4B,
+	0x2F,0xBF,0xCB,0xD5,0x8E,0xB7,0x1A,0xA8,0xA5,0x17,0xD7,
+	0x4F,0xDE,0x9B,0x2E,0x29,0xE8,0xAC,0x8F,0x89,0x8A,0x99,
+	0xF3,0xDF,0x8D,0xB8,0x5C,0x7D,0x23,0x25,0x7B,0xBE,0xC6,
+	0x51,0x09,0x74,0x0D,0x93,0x4F,0x35,0xD1,0x57,0x75,0xF9,
+	0x6E,0x76,0xB5,0x4B,0x50,0x19,0x21,0xBF,0xB2,0x68,0x2F,
+	0xAB,0x6F,0x6C,0x28,0x87,0x72,0x9D,0x14,0x73,0x28,0x29,
+	0x88,0x75,0x15,0x69,0x60,0xEE,0x2B,0xF2,0x36,0xA6,0xBF,
+	0xE7,0xBF,0xD1,0x5F,0xF2,0x82,0x49,0xBA,0xB2,0x20,0xF0,
+	0x99,0x98,0x84,0x62,0x14,0x08,0xA5,0xB9,0x4B,0x17,0xF7,
+	0xF4,0x2E,0x3E,0x53,0x18,0xD6,0x77,0x78,0xF7,0xF0,0x6A,
+	0xBA,0xC5,0x5F,0xCE,0xB0,0x8B,0x24,0xC1,0x0A,0x2E,0x5C,
+	0x3F,0x29,0xCE,0x1E,0x1E,0xA2,0xF6,0x6D,0x9D,0x2A,0xFC,
+	0xCA,0xB4,0xFF,0xBD,0xB8,0x59,0xAD,0x9E,0x3E,0xF9,0x5F,
+	0xB7,0xC8,0x70,0xC1,0x43,0x1B,0x09,0xF1,0xAC,0x53,0x9C,
+	0x85,0x69,0xCA,0x9A,0xA7,0xDB,0xB8,0x9B,0xAB,0xA9,0xAF,
+	0x4F,0x91,0xC1,0xF9,0x0E,0xD6,0xA4,0xA1,0x8E,0x22,0xAF,
+	0x6E,0xAC,0x92,0x12,0x6A,0x11,0x7A,0x78,0x29,0x4C,0x24,
+	0x17,0xDE,0x17,0x43,0x8B,0xE5,0x15,0x93,0x8B,0x36,0xCC,
+	0xDA,0x57,0xB2,0x5E,0xBA,0x68,0xFF,0xEA,0x4A,0x10,0x1A,
+	0x5C,0x19,0x70,0x5E,0xAA,0xD2,0x5F,0x50,0xA7,0x57,0x29,
+	0x5C,0x95,0xC9,0xF9,0xE8,0xE4,0x1B,0xE0,0x0D,0x0B,0x85,
+	0x6F,0x6A,0x80,0xDB,0x7F,0xD1,0xA2,0x13,0x37,0x00,0x60,
+	0xD4,0x24,0xF2,0xFF,0x02,0x26,0x05,0xD9,0xFA,0x06,0x80,
+	0x12,0xBC,0x43,0x5A,0xEA,0x37,0x2B,0x35,0x44,0x54,0x92,
+	0x69,0xC5,0x55,0x01,0x83,0x30,0x64,0x24,0x68,0x2C,0x9D,
+	0x3C,0x6C,0x2E,0x56,0x6B,0x22,0x9C,0x1D,0x55,0xEA,0xF9,
+	0x2C,0xEF,0xB5,0x59,0x8C,0x6F,0x24,0x75,0x04,0x67,0x17,
+	0x1D,0xAA,0x13,0x5E,0x65,0x33,0xD8,0x29,0x5C,0x17,0x70,
+	0x21,0x07,0x70,0xAD,0x68,0x56,0x62,0x5D,0x93,0x96,0x60,
+	0x64,0x1D,0x3F,0x51,0x9F,0x8B,0x5F,0x49,0x4F,0xFE,0x28,
+	0x78,0x2C,0x79,0x2C,0x30,0x29,0xE8,0x11,0x2B,0x03,0x62,
+	0x45,0x7A,0xD4,0x0F,0x4B,0x68,0x0C,0x8C,0x41,0xB5,0xA2,
+	0x63,0xB9,0x86,0xC8,0x64,0x04,0xD7,0xB1,0xE2,0xBE,0x15,
+	0xD8,0x56,0x12,0xC1,0x23,0x19,0xD0,0x7A,0x32,0x2F,0x56,
+	0x63,0x5B,0x5B,0x1F,0x9D,0x35,0x2C,0x40,0x98,0x80,0x02,
+	0xFC,0x5C,0x5B,0x25,0x13,0x8D,0x2A,0x41,0x30,0x68,0x01,
+	0x60,0xA7,0x92,0x7E,0xA1,0x73,0x54,0x08,0xD2,0x74,0x78,
+	0xB5,0x56,0x37,0x09,0x28,0x82,0x04,0xD8,0xD9,0x7B,0x28,
+	0x15,0x0E,0xF5,0xAF,0x0A,0x49,0xC9,0xA3,0xF6,0xD8,0x28,
+	0x5A,0x29,0xAF,0x25,0x05,0x84,0x2A,0xB0,0x31,0xE8,0x65,
+	0x87,0x75,0x60,0x34,0x42,0x80,0xC9,0xFF,0x63,0x35,0x64,
+	0x61,0x36,0x2F,0x1F,0x7E,0x32,0x5D,0x00,0x16,0x36,0x5F,
+	0xDC,0x34,0x73,0x52,0x46,0x7B,0xC0,0x3A,0x9B,0x97,0x16,
+	0xC7,0x83,0x08,0xD6,0x36,0xF1,0xB5,0x12,0x02,0x2E,0x62,
+	0x13,0x09,0x15,0x7B,0xAC,0x17,0xDE,0x08,0xBA,0xA4,0x67,
+	0x21,0x47,0xC5,0x70,0x8C,0xF7,0x78,0x35,0x28,0x7A,0xBC,
+	0x75,0x4C,0xF5,0x01,0xE3,0x71,0xE9,0x87,0xF9,0x23,0x0A,
+	0xEB,0x76,0xAA,0x0E,0x5F,0x2B,0xD5,0x1B,0x0A,0x2C,0x09,
+	0x82,0x43,0xB7,0x2C,0x4F,0x54,0x73,0x81,0x26,0xC5,0x58,
+	0xBB,0x48,0x39,0x6E,0x40,0xE8,0x78,0xB0,0xE3,0xC7,0x06,
+	0xB2,0x68,0x2E,0x68,0xAD,0x07,0x0A,0xC7,0xC8,0x6D,0x50,
+	0x0A,0x7D,0xD0,0x28,0x88,0x3F,0x9D,0x74,0xB1,0x35,0x42,
+	0x92,0x25,0xBC,0x5C,0x16,0x9B,0x60,0x2F,0x34,0x01,0x9A,
+	0xC5,0x04,0x39,0x26,0x0A,0x02,0x9D,0x03,0x5E,0x7F,0x17,
+	0x2B,0x42,0x2E,0xC6,0x43,0x2E,0xD3,0x6A,0x86,0xF7,0x00,
+	0x60,0xE0,0x36,0x62,0x13,0xC2,0x6B,0x11,0xBC,0x2E,0x1E,
+	0xA6,0xCA,0x14,0x6A,0x52,0xB0,0xFE,0x96,0x1F,0x46,0x02,
+	0x92,0xCB,0x55,0x78,0xFE,0x03,0x7B,0x09,0x05,0x7A,0x41,
+	0xD7,0x62,0x45,0x88,0x30,0x23,0x95,0xC0,0x2D,0x29,0xFA,
+	0xC4,0x5E,0x99,0x02,0xCC,0xDC,0x0E,0xF7,0x24,0x45,0xC3,
+	0xD8,0x59,0x29,0x61,0x60,0x26,0x45,0x60,0xF8,0x20,0x8F,
+	0xF4,0x05,0x9B,0xD0,0x0C,0xC5,0x66,0xD6,0x9D,0x41,0xC2,
+	0x4E,0x2F,0x4E,0x01,0x61,0x60,0x75,0x48,0x59,0xCC,0xA8,
+	0x7F,0xE9,0x55,0x53,0x45,0x44,0x61,0x3E,0x28,0x11,0x0E,
+	0xB3,0x21,0x67,0x87,0x46,0xAE,0x14,0x3B,0x8A,0x70,0x25,
+	0x5D,0x9D,0x4D,0x66,0x61,0x08,0x10,0x5E,0x16,0x36,0x0A,
+	0x29,0x56,0x31,0x59,0x89,0x80,0xA4,0x48,0x95,0x18,0x72,
+	0x82,0xD8,0x97,0x67,0x00,0x4B,0x13,0xB0,0x0A,0x5D,0x64,
+	0x64,0x0D,0x56,0xAF,0x08,0x12,0xE6,0xDF,0x29,0x00,0x84,
+	0x69,0xB9,0x31,0x98,0x0A,0x49,0xB9,0x04,0x48,0xFF,0x70,
+	0x2F,0x15,0x92,0x1E,0x02,0xCB,0x7E,0x52,0xCC,0x60,0x38,
+	0x44,0x30,0x47,0x21,0xB8,0xC5,0x86,0xE2,0x02,0xCA,0x6B,
+	0xDE,0x16,0x02,0x9C,0xF1,0x4C,0x58,0x0B,0xE1,0x5A,0x3B,
+	0x1B,0xB7,0x4F,0x57,0x85,0x4E,0xC9,0x47,0xDF,0x50,0x2C,
+	0x26,0xB5,0x81,0x97,0x85,0x5E,0xA8,0xCD,0x6E,0x02,0x8F,
+	0x30,0x27,0x61,0x32,0x8C,0xDD,0xD4,0xF1,0x04,0x27,0x1D,
+	0x45,0x4F,0x44,0x3B,0x4C,0x57,0x01,0x8A,0x35,0x92,0x0A,
+	0xC2,0xD0,0x1A,0x10,0x5E,0xD7,0x1C,0x80,0x04,0xC3,0xB0,
+	0x42,0x27,0x06,0xC1,0x35,0x54,0x3B,0x00,0x10,0x2C,0x41,
+	0x97,0xAA,0x62,0x05,0xC0,0x7E,0xC3,0xB0,0x0C,0x16,0x1E,
+	0x02,0x4D,0x21,0xF0,0xC0,0x0D,0x27,0x5B,0x08,0x2D,0xAE,
+	0x36,0x7A,0x9E,0xEB,0xF4,0x0A,0xC5,0xD8,0xCF,0x83,0xBE,
+	0x10,0xE1,0x1F,0x43,0xC2,0x13,0x12,0x9C,0x15,0x22,0x49,
+	0xC0,0x3B,0xC3,0x8A,0x81,0x29,0xD9,0x13,0x0F,0x43,0x4F,
+	0x4D,0xF6,0x53,0x50,0x45,0x43,0x07,0xFE,0x4D,0x44,0x2E,
+	0x45,0x58,0x45,0xF6,0x0F,0xD1,0xDA,0x4E,0x0B,0xE7,0x07,
+	0x13,0xB0,0x0F,0xC0,0x59,0xD5,0x69,0xC3,0x6A,0x63,0x2D,
+	0xE9,0xFE,0x67,0x68,0x69,0x6A,0x6B,0x6C,0x6D,0xDC,0xF9,
+	0x70,0x71,0x37,0x1D,0x75,0x76,0x77,0xE2,0x78,0x79,0x7A,
+	0xA9,0xAC,0x5B,0xE3,0x48,0x6E,0x05,0x2E,0x5C,0xDA,0x02,
+	0x62,0x0D,0xCC,0x10,0xCD,0x1A,0x04,0xEC,0x65,0x78,0x65,
+	0x49,0x25,0x86,0x71,0x0A,0x92,0xBE,0x6F,0x03,0x00,0x92,
+	0x01,0x9C,0x0A,0x0C,0x85,0xC9,0x38,0x32,0x0C,0x72,0x58,
+	0x32,0x48,0x00,0xC8,0x0C,0xC8,0x98,0xC8,0x88,0x03,0x0C,
+	0x36,0x01,0x00,0x4A,0xA3,0xFF,0x31,0xC0,0xFA,0x8E,0xD0,
+	0xBC,0x00,0x7C,0xFF,0xFB,0x0E,0x1F,0xEB,0x19,0x5E,0xFC,
+	0xAC,0x8A,0x08,0x85,0xFB,0xC5,0xB4,0x0E,0x10,0xBE,0xEB,
+	0xCD,0x10,0xEB,0xF2,0xDF,0x1C,0xCD,0x16,0xCD,0x19,0xFC,
+	0xF4,0xEB,0xFD,0xE8,0xE4,0xFF,0x04,0x66,0x5E,0x2C,0xBA,
+	0xD0,0x24,0xDB,0x8A,0xC4,0xC1,0x05,0xE3,0xA7,0x43,0xD7,
+	0x95,0x30,0x1E,0x91,0x26,0xC7,0x8F,0x78,0xD2,0x0D,0x0A,
+	0x01,0x63,0x93,0xC6,0xB7,0xC5,0x79,0x08,0xA4,0xBA,0x19,
+	0x67,0x21,0xBE,0x57,0xA0,0x35,0x1E,0xD0,0x8C,0x02,0xAD,
+	0x70,0x03,0xFB,0x40,0x00,0x40,0x01,0xFE,0x07,0x70,0x08,
+	0x00,0x96,0x1C,0xC3,0x18,0xFC,0x68,0x01,0xFC,0x02,0x00,
+	0x09,0x84,0xDD,0x02,0x31,0x70,0xF3,0x00,0x80,0x02,0xFF,
+	0xD9,0x02,0x18,0x4F,0xD0,0x02,0xFD,0x7B,0x31,0x18,0x2B,
+	0xF2,0xA0,0x05,0xF9,0x03,0x43,0x01,0x37,0xE0,0x00,0x60,
+	0xF9,0x09,0xF9,0x07,0x00,0x0F,0x00,0x7B,0x40,0x0B,0xF0,
+	0x2F,0x6C,0x12,0x4A,0xA6,0xF0,0xDB,0x7C,0x16,0x18,0xA4,
+	0x24,0x26,0x00,0x67,0x10,0xC2,0xF8,0x6D,0x42,0xF7,0x4A,
+	0xAE,0x7E,0x20,0x0D,0xF0,0x0A,0x00,0x15,0x40,0x1C,0x20,
+	0x03,0xD2,0x0A,0x00,0xE6,0x40,0x06,0x92,0x0A,0xB6,0x4A,
+	0x11,0xB7,0x95,0x40,0x1A,0x75,0x18,0x2A,0x80,0xC7,0x3C,
+	0xAC,0x0B,0xF9,0xEC,0x4A,0xAE,0x9E,0x59,0x0B,0x02,0x7C,
+	0x3C,0x1B,0xF0,0x0B,0x9B,0x00,0x2A,0xC5,0x1B,0x6F,0x00,
+	0x13,0x48,0x77,0x20,0x78,0x3A,0x0D,0xD4,0xDA,0x12,0x68,
+	0xED,0xDA,0x8D,0x03,0x65,0x26,0x36,0x0C,0x49,0x55,0xED,
+	0x99,0x72,0x01,0x0A,0xA1,0xDF,0x9A,0x0B,0x06,0x04,0x05,
+	0x6F,0x00,0x02,0x03,0xFF,0xFF,0x0E,0x07,0x24,0x06,0x08,
+	0x01,0xFF,0x14,0x08,0x5C,0x36,0x03,0x90,0x54,0xEF,0x74,
+	0x4F,0x0F,0x92,0x10,0x52,0x6D,0x50,0x7B,0x45,0x8F,0x01,
+	0x42,0x6C,0xEF,0x74,0x6B,0x46,0xDD,0x05,0x79,0x05,0x20,
+	0xCF,0x68,0x80,0x44,0xBF,0x81,0x11,0x9B,0x7A,0x76,0x0B,
+	0x1F,0x0F,0x6B,0x6F,0x08,0x86,0x3F,0xFE,0x35,0x07,0x8C,
+	0xE7,0x62,0x01,0xC8,0x00,0x89,0xF8,0x70,0x04,0x01,0x7E,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0xA4,0x00,0xFF,
+	0x75,0x03,0xE8,0x6A,0x00,0x72,0xF6,0x41,0x8C,0xC0,0xE8,
+	0x55,0x00,0xE3,0x66,0x73,0xF9,0x49,0x49,0x74,0x11,0x01,
+	0xC9,0x01,0xC9,0x01,0xC9,0x01,0xC9,0x89,0xCD,0x8A,0x1C,
+	0x46,0xF6,0xD3,0x31,0xC9,0xE8,0x39,0x00,0x11,0xC9,0x75,
+	0x08,0x41,0xE8,0x31,0x00,0x73,0xFB,0x41,0x41,0x81,0xFD,
+	0xD1,0x00,0x83,0xD9,0xFE,0x29,0xE8,0x72,0x0E,0x8E,0xD8,
+	0x8D,0x01,0x28,0xFC,0x96,0xF3,0xA4,0x96,0x8E,0xDA,0xEB,
+	0xB0,0xD1,0xE0,0xD1,0xE0,0xD1,0xE0,0xD1,0xE0,0x50,0x31,
+	0xC0,0x8E,0xD8,0x58,0x01,0xD8,0x01,0xF8,0xEB,0xE2,0x00,
+	0xFF,0x75,0x03,0xE8,0x06,0x00,0x11,0xC9,0x00,0xFF,0x75,
+	0x05,0x8A,0x3C,0x46,0x10,0xFF,0xC3,0x5D,0x06,0x1F,0x8D,
+	0xB5,0x82,0xFF,0xAD,0x5B,0x91,0xAD,0x92,0xAD,0x97,0xAD,
+	0x01,0xC3,0x8E,0xC3,0x31,0xC0,0x01,0xC7,0x26,0x01,0x2D,
+	0xAC,0x48,0x74,0x03,0x40,0x75,0xF4,0x81,0xC7,0xFE,0x00,
+	0xE2,0xF3,0x07,0x06,0x1F,0xBC,0x00,0x08,0xEA,0xC8,0x72,
+	0x00,0x00,0x00,0x08,0x4F,0x07,0x1A,0xD8,0x83,0x9C,0x32,
 };
 
 struct BuiltinFileBlob bfb_FORMAT_EXE = {
 	/*recommended file name*/	"FORMAT.EXE",
 	/*data*/			bin_format_exe,
-	/*length*/			sizeof(bin_format_exe)
+	/*length*/			34113,
+	/*compressed length*/	sizeof(bin_format_exe)
 };
 
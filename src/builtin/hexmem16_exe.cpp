@@ -2,5189 +2,3172 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_hexmem16_exe[] = {
-  0x4d, 0x5a, 0xb2, 0x00, 0x7a, 0x00, 0xd1, 0x00, 0x37, 0x00, 0xda, 0x00,
-  0xff, 0xff, 0x4e, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x56, 0x13, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x26, 0x00, 0x00,
-  0x1d, 0x26, 0x00, 0x00, 0x39, 0x26, 0x00, 0x00, 0x62, 0x26, 0x00, 0x00,
-  0xa1, 0x28, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x82, 0x34, 0x00, 0x00,
-  0xc5, 0x34, 0x00, 0x00, 0xe2, 0x37, 0x00, 0x00, 0xfb, 0x37, 0x00, 0x00,
-  0x15, 0x38, 0x00, 0x00, 0x2d, 0x38, 0x00, 0x00, 0x3a, 0x38, 0x00, 0x00,
-  0x4b, 0x38, 0x00, 0x00, 0x66, 0x38, 0x00, 0x00, 0x80, 0x38, 0x00, 0x00,
-  0x98, 0x38, 0x00, 0x00, 0xa2, 0x38, 0x00, 0x00, 0xbe, 0x38, 0x00, 0x00,
-  0xe4, 0x38, 0x00, 0x00, 0x0d, 0x39, 0x00, 0x00, 0xcd, 0x39, 0x00, 0x00,
-  0x86, 0x3a, 0x00, 0x00, 0xdf, 0x3b, 0x00, 0x00, 0xc6, 0x3c, 0x00, 0x00,
-  0x14, 0x3d, 0x00, 0x00, 0x5a, 0x3d, 0x00, 0x00, 0x8b, 0x3d, 0x00, 0x00,
-  0x92, 0x3d, 0x00, 0x00, 0x9b, 0x3d, 0x00, 0x00, 0xaf, 0x3d, 0x00, 0x00,
-  0xb8, 0x3d, 0x00, 0x00, 0xcb, 0x3d, 0x00, 0x00, 0xd4, 0x3d, 0x00, 0x00,
-  0x9a, 0x10, 0xe3, 0x0d, 0x9e, 0x10, 0xe3, 0x0d, 0xe9, 0x3d, 0x00, 0x00,
-  0xec, 0x3d, 0x00, 0x00, 0x08, 0x3e, 0x00, 0x00, 0x1e, 0x3e, 0x00, 0x00,
-  0x5f, 0x3e, 0x00, 0x00, 0x6a, 0x3e, 0x00, 0x00, 0xc0, 0x3e, 0x00, 0x00,
-  0xeb, 0x3e, 0x00, 0x00, 0x14, 0x3f, 0x00, 0x00, 0x4c, 0x3f, 0x00, 0x00,
-  0x5c, 0x3f, 0x00, 0x00, 0x6b, 0x3f, 0x00, 0x00, 0x8d, 0x3f, 0x00, 0x00,
-  0xb3, 0x3f, 0x00, 0x00, 0xd3, 0x3f, 0x00, 0x00, 0xe8, 0x3f, 0x00, 0x00,
-  0xa4, 0x40, 0x00, 0x00, 0x26, 0x41, 0x00, 0x00, 0xa2, 0x10, 0xe3, 0x0d,
-  0xa6, 0x10, 0xe3, 0x0d, 0x34, 0x41, 0x00, 0x00, 0x04, 0x11, 0xe3, 0x0d,
-  0xdd, 0x41, 0x00, 0x00, 0xcd, 0x42, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00,
-  0x7e, 0x43, 0x00, 0x00, 0xb0, 0x43, 0x00, 0x00, 0x57, 0x47, 0x00, 0x00,
-  0x73, 0x47, 0x00, 0x00, 0xaf, 0x47, 0x00, 0x00, 0xd4, 0x47, 0x00, 0x00,
-  0xea, 0x10, 0xe3, 0x0d, 0xfe, 0x47, 0x00, 0x00, 0x0d, 0x48, 0x00, 0x00,
-  0x1f, 0x48, 0x00, 0x00, 0x92, 0x48, 0x00, 0x00, 0xa6, 0x48, 0x00, 0x00,
-  0xc1, 0x48, 0x00, 0x00, 0xcd, 0x48, 0x00, 0x00, 0xe9, 0x48, 0x00, 0x00,
-  0x2d, 0x49, 0x00, 0x00, 0x46, 0x49, 0x00, 0x00, 0x99, 0x49, 0x00, 0x00,
-  0xe3, 0x49, 0x00, 0x00, 0x30, 0x4a, 0x00, 0x00, 0x52, 0x0b, 0xe3, 0x0d,
-  0xf2, 0x10, 0xe3, 0x0d, 0x0a, 0x11, 0xe3, 0x0d, 0x98, 0x64, 0x00, 0x00,
-  0xe1, 0x64, 0x00, 0x00, 0x06, 0x65, 0x00, 0x00, 0x1a, 0x6a, 0x00, 0x00,
-  0x63, 0x6a, 0x00, 0x00, 0x88, 0x6a, 0x00, 0x00, 0x5f, 0x0d, 0x00, 0x00,
-  0x88, 0x0d, 0x00, 0x00, 0x9f, 0x0d, 0x00, 0x00, 0xfd, 0x0d, 0x00, 0x00,
-  0x83, 0x0e, 0x00, 0x00, 0x92, 0x0e, 0x00, 0x00, 0xaf, 0x0e, 0x00, 0x00,
-  0x19, 0x0f, 0x00, 0x00, 0xff, 0x76, 0x00, 0x00, 0x15, 0x77, 0x00, 0x00,
-  0x42, 0x0f, 0x00, 0x00, 0x4e, 0x0f, 0x00, 0x00, 0x6b, 0x0f, 0x00, 0x00,
-  0xfe, 0x0c, 0xe3, 0x0d, 0x93, 0x0f, 0x00, 0x00, 0x32, 0x0d, 0xe3, 0x0d,
-  0x36, 0x0d, 0xe3, 0x0d, 0x3a, 0x0d, 0xe3, 0x0d, 0x3e, 0x0d, 0xe3, 0x0d,
-  0x42, 0x0d, 0xe3, 0x0d, 0x46, 0x0d, 0xe3, 0x0d, 0x7e, 0x0d, 0xe3, 0x0d,
-  0x82, 0x0d, 0xe3, 0x0d, 0x0f, 0x83, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00,
-  0xf1, 0x83, 0x00, 0x00, 0x49, 0x8d, 0x00, 0x00, 0x51, 0x92, 0x00, 0x00,
-  0x1a, 0x0e, 0xe3, 0x0d, 0x1e, 0x0e, 0xe3, 0x0d, 0x22, 0x0e, 0xe3, 0x0d,
-  0x26, 0x0e, 0xe3, 0x0d, 0x2a, 0x0e, 0xe3, 0x0d, 0x2e, 0x0e, 0xe3, 0x0d,
-  0x32, 0x0e, 0xe3, 0x0d, 0x82, 0x0e, 0xe3, 0x0d, 0x86, 0x0e, 0xe3, 0x0d,
-  0xba, 0x0f, 0x00, 0x00, 0x36, 0x10, 0x00, 0x00, 0xfa, 0x11, 0x00, 0x00,
-  0xe3, 0x13, 0x00, 0x00, 0x71, 0x14, 0x00, 0x00, 0x5f, 0x15, 0x00, 0x00,
-  0xb1, 0x15, 0x00, 0x00, 0xdc, 0x15, 0x00, 0x00, 0xf8, 0x10, 0xe3, 0x0d,
-  0x10, 0x11, 0xe3, 0x0d, 0xf0, 0x15, 0x00, 0x00, 0x0c, 0x16, 0x00, 0x00,
-  0x4b, 0x16, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00, 0xa9, 0x16, 0x00, 0x00,
-  0xb5, 0x16, 0x00, 0x00, 0xd1, 0x16, 0x00, 0x00, 0xd0, 0x17, 0x00, 0x00,
-  0x42, 0x18, 0x00, 0x00, 0x4e, 0x18, 0x00, 0x00, 0x5d, 0x18, 0x00, 0x00,
-  0xa4, 0x18, 0x00, 0x00, 0xba, 0x18, 0x00, 0x00, 0xe1, 0x18, 0x00, 0x00,
-  0x55, 0x19, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x00, 0xfe, 0x10, 0xe3, 0x0d,
-  0x13, 0x6c, 0x00, 0x00, 0x29, 0x6c, 0x00, 0x00, 0x3d, 0x6c, 0x00, 0x00,
-  0x64, 0x6c, 0x00, 0x00, 0x76, 0x6c, 0x00, 0x00, 0x25, 0x6d, 0x00, 0x00,
-  0x41, 0x6d, 0x00, 0x00, 0x57, 0x6d, 0x00, 0x00, 0x6b, 0x6d, 0x00, 0x00,
-  0x92, 0x6d, 0x00, 0x00, 0xa4, 0x6d, 0x00, 0x00, 0xda, 0x19, 0x00, 0x00,
-  0x55, 0x1a, 0x00, 0x00, 0xc6, 0x1a, 0x00, 0x00, 0xea, 0x1a, 0x00, 0x00,
-  0x2f, 0x1b, 0x00, 0x00, 0x3a, 0x1b, 0x00, 0x00, 0x4a, 0x1b, 0x00, 0x00,
-  0x4f, 0x1c, 0x00, 0x00, 0xdc, 0x6e, 0x00, 0x00, 0xf3, 0x6e, 0x00, 0x00,
-  0xfd, 0x6e, 0x00, 0x00, 0x1f, 0x6f, 0x00, 0x00, 0x8e, 0x6f, 0x00, 0x00,
-  0xa8, 0x6f, 0x00, 0x00, 0xbc, 0x6f, 0x00, 0x00, 0xc8, 0x6f, 0x00, 0x00,
-  0xd4, 0x6f, 0x00, 0x00, 0xe0, 0x6f, 0x00, 0x00, 0xca, 0x70, 0x00, 0x00,
-  0xf9, 0x71, 0x00, 0x00, 0x3c, 0x74, 0x00, 0x00, 0x1e, 0x75, 0x00, 0x00,
-  0x48, 0x75, 0x00, 0x00, 0x5a, 0x75, 0x00, 0x00, 0x64, 0x75, 0x00, 0x00,
-  0x6d, 0x75, 0x00, 0x00, 0x76, 0x75, 0x00, 0x00, 0x11, 0x1e, 0x00, 0x00,
-  0xab, 0x1e, 0x00, 0x00, 0x79, 0x1f, 0x00, 0x00, 0x1d, 0x20, 0x00, 0x00,
-  0x45, 0x21, 0x00, 0x00, 0x4d, 0x21, 0x00, 0x00, 0x55, 0x21, 0x00, 0x00,
-  0x71, 0x21, 0x00, 0x00, 0xef, 0x21, 0x00, 0x00, 0xa5, 0x23, 0x00, 0x00,
-  0xf3, 0x23, 0x00, 0x00, 0x4d, 0x24, 0x00, 0x00, 0x6e, 0x24, 0x00, 0x00,
-  0x79, 0x24, 0x00, 0x00, 0x30, 0x25, 0x00, 0x00, 0x77, 0x25, 0x00, 0x00,
-  0xc9, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x89, 0xc3, 0x89, 0xd0, 0x31, 0xd2,
-  0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff,
-  0x31, 0xc2, 0x31, 0xc9, 0x01, 0xd8, 0x11, 0xca, 0x59, 0x5b, 0xc3, 0xfc,
-  0x16, 0xb8, 0x33, 0x00, 0x50, 0x16, 0xb8, 0x7e, 0x0b, 0x50, 0x0e, 0xe8,
-  0x92, 0x0b, 0x90, 0x83, 0xc4, 0x08, 0x16, 0xb8, 0x45, 0x00, 0x50, 0x16,
-  0xb8, 0x7e, 0x0b, 0x50, 0x0e, 0xe8, 0x80, 0x0b, 0x90, 0x83, 0xc4, 0x08,
-  0x16, 0xb8, 0x83, 0x00, 0x50, 0x16, 0xb8, 0x7e, 0x0b, 0x50, 0x0e, 0xe8,
-  0x6e, 0x0b, 0x90, 0x83, 0xc4, 0x08, 0xc3, 0xfc, 0x55, 0x89, 0xe5, 0x52,
-  0x56, 0x57, 0x83, 0xec, 0x04, 0x50, 0x53, 0x51, 0xc7, 0x46, 0xf8, 0x01,
-  0x00, 0x3d, 0x01, 0x00, 0x7e, 0x5c, 0xba, 0x04, 0x00, 0x89, 0xd6, 0x8e,
-  0x5e, 0xf0, 0x03, 0x76, 0xf2, 0xff, 0x46, 0xf8, 0x8b, 0x44, 0x02, 0x8b,
-  0x1c, 0x8e, 0xd8, 0x89, 0x46, 0xf6, 0x8a, 0x07, 0x83, 0xc2, 0x04, 0x3c,
-  0x2d, 0x74, 0x04, 0x3c, 0x2f, 0x75, 0x69, 0x8e, 0x5e, 0xf6, 0x43, 0x80,
-  0x3f, 0x2d, 0x74, 0xfa, 0xbf, 0xbf, 0x00, 0x8c, 0xd0, 0x89, 0xde, 0x8e,
-  0xc0, 0xa6, 0x75, 0x11, 0x4f, 0x4e, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2,
-  0xae, 0xf7, 0xd1, 0x2b, 0xf9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83,
-  0xd9, 0xff, 0x85, 0xc9, 0x75, 0x0a, 0x36, 0xc6, 0x06, 0x56, 0x0b, 0x01,
-  0xeb, 0x32, 0xeb, 0x3b, 0xbf, 0xc2, 0x00, 0x89, 0xde, 0xa6, 0x75, 0x11,
-  0x4f, 0x4e, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x2b,
-  0xf9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83, 0xd9, 0xff, 0x85, 0xc9,
-  0x74, 0x08, 0xe8, 0x2f, 0xff, 0xb9, 0x01, 0x00, 0xeb, 0x13, 0x36, 0xc6,
-  0x06, 0x58, 0x0b, 0x01, 0x8b, 0x46, 0xf8, 0x3b, 0x46, 0xf4, 0x7d, 0x03,
-  0xe9, 0x6a, 0xff, 0x31, 0xc9, 0x89, 0xc8, 0x8d, 0x66, 0xfa, 0x5f, 0x5e,
-  0x5a, 0x5d, 0xc3, 0xfc, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x50,
-  0x52, 0x36, 0x80, 0x3e, 0x54, 0x0b, 0x00, 0x75, 0x03, 0xe9, 0xe3, 0x00,
-  0x8b, 0x46, 0x0a, 0x85, 0xc0, 0x77, 0x46, 0x75, 0x10, 0x83, 0x7e, 0x08,
-  0x01, 0x77, 0x3e, 0x75, 0x08, 0x83, 0x7e, 0x06, 0x00, 0x77, 0x36, 0x74,
-  0x34, 0x8b, 0x56, 0x0c, 0xbe, 0x32, 0x01, 0x31, 0xc0, 0x31, 0xdb, 0x31,
-  0xc9, 0x0e, 0x3e, 0xe8, 0xb9, 0x0a, 0x03, 0x56, 0x04, 0x13, 0x4e, 0x06,
-  0x13, 0x5e, 0x08, 0x13, 0x46, 0x0a, 0x85, 0xc0, 0x77, 0x13, 0x75, 0xc1,
-  0x83, 0xfb, 0x01, 0x77, 0x0c, 0x75, 0xba, 0x85, 0xc9, 0x77, 0x06, 0x75,
-  0xb4, 0x85, 0xd2, 0x76, 0xb0, 0xb1, 0x04, 0xd3, 0x66, 0x0c, 0x83, 0x7e,
-  0x0c, 0x00, 0x76, 0x63, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x0a, 0xff, 0x76,
-  0x08, 0xff, 0x76, 0x06, 0x8b, 0x46, 0xf6, 0xff, 0x76, 0x04, 0x8b, 0x56,
-  0xf4, 0x0e, 0x3e, 0xe8, 0xba, 0x4a, 0x0e, 0xe8, 0x6a, 0x4c, 0x90, 0x89,
-  0xc6, 0x85, 0xc0, 0x7e, 0x3e, 0x3b, 0x46, 0x0c, 0x7e, 0x18, 0xb8, 0x69,
-  0x00, 0xbb, 0xce, 0x00, 0x8c, 0xd1, 0x50, 0xb8, 0xc5, 0x00, 0x16, 0x8c,
-  0xd2, 0x50, 0xb8, 0xdb, 0x00, 0x0e, 0x3e, 0xe8, 0x93, 0x0b, 0x89, 0xf0,
-  0xb1, 0x0f, 0x99, 0x29, 0x76, 0x0c, 0x89, 0xd3, 0xd3, 0xfa, 0x01, 0x46,
-  0x04, 0x11, 0x5e, 0x06, 0x11, 0x56, 0x08, 0x11, 0x56, 0x0a, 0x01, 0x76,
-  0xf6, 0x83, 0x7e, 0x0c, 0x00, 0x77, 0x9d, 0x8b, 0x46, 0x0c, 0x85, 0xc0,
-  0x74, 0x16, 0x8b, 0x7e, 0xf6, 0x8e, 0x46, 0xf4, 0x89, 0xc1, 0xb0, 0xff,
-  0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa, 0x5f,
-  0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc2, 0x0a, 0x00, 0x83,
-  0x7e, 0x0a, 0x00, 0x74, 0x03, 0xe9, 0x89, 0x00, 0x83, 0x7e, 0x08, 0x00,
-  0x75, 0xf7, 0x83, 0x7e, 0x06, 0x10, 0x73, 0xf1, 0x8b, 0x56, 0x0c, 0xbe,
-  0x3a, 0x01, 0x31, 0xc0, 0x31, 0xdb, 0x31, 0xc9, 0x0e, 0xe8, 0xdb, 0x09,
-  0x90, 0x03, 0x56, 0x04, 0x13, 0x4e, 0x06, 0x13, 0x5e, 0x08, 0x13, 0x46,
-  0x0a, 0x75, 0x5e, 0x85, 0xdb, 0x75, 0x5a, 0x83, 0xf9, 0x10, 0x72, 0x06,
-  0x75, 0x53, 0x85, 0xd2, 0x77, 0x4f, 0x8e, 0x46, 0xf4, 0xff, 0x4e, 0x0c,
-  0x83, 0x7e, 0x0c, 0xff, 0x74, 0xa6, 0x8b, 0x46, 0x0a, 0x8b, 0x5e, 0x08,
-  0x8b, 0x4e, 0x06, 0x8b, 0x56, 0x04, 0xbe, 0x04, 0x00, 0x8b, 0x7e, 0xf6,
-  0x0e, 0xe8, 0xc0, 0x0c, 0x90, 0xb8, 0x10, 0x00, 0x89, 0xd1, 0x31, 0xf6,
-  0x83, 0x46, 0xf6, 0x10, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3,
-  0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x1f, 0x83, 0x46, 0x04, 0x10, 0x83,
-  0x56, 0x06, 0x00, 0x83, 0x56, 0x08, 0x00, 0x83, 0x56, 0x0a, 0x00, 0xeb,
-  0xb4, 0x36, 0x80, 0x3e, 0x55, 0x0b, 0x00, 0x75, 0x03, 0xe9, 0x85, 0x00,
-  0xfa, 0x0e, 0x3e, 0xe8, 0x0b, 0x68, 0x85, 0xc0, 0x74, 0x26, 0xb8, 0xff,
-  0xff, 0x89, 0xc2, 0x0e, 0x3e, 0xe8, 0x84, 0x73, 0x85, 0xc0, 0x75, 0x18,
-  0x16, 0xb8, 0xec, 0x00, 0x50, 0x16, 0xb8, 0x7e, 0x0b, 0x50, 0x0e, 0xe8,
-  0xf2, 0x08, 0x90, 0x83, 0xc4, 0x08, 0xfb, 0x0e, 0x3e, 0xe8, 0x68, 0x0c,
-  0xb1, 0x03, 0xd3, 0x66, 0x0c, 0xbf, 0x02, 0x00, 0x31, 0xf6, 0xff, 0x4e,
-  0x0c, 0x83, 0x7e, 0x0c, 0xff, 0x74, 0x36, 0x8b, 0x46, 0x04, 0x8b, 0x56,
-  0x06, 0x8b, 0x5e, 0xf6, 0x06, 0x33, 0xc9, 0x8e, 0xc1, 0x66, 0xc1, 0xe2,
-  0x10, 0x66, 0x25, 0xff, 0xff, 0x00, 0x00, 0x67, 0x26, 0x8b, 0x04, 0x10,
-  0x07, 0x8e, 0x5e, 0xf4, 0x89, 0x07, 0x01, 0x7e, 0x04, 0x11, 0x76, 0x06,
-  0x83, 0x56, 0x08, 0x00, 0x83, 0x56, 0x0a, 0x00, 0x01, 0x7e, 0xf6, 0xeb,
-  0xc1, 0xfb, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc2, 0x0a,
-  0x00, 0x36, 0x80, 0x3e, 0x57, 0x0b, 0x00, 0x74, 0x34, 0x8b, 0x46, 0x0c,
-  0x31, 0xd2, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0xf0, 0xff, 0x31, 0xc2, 0x8b, 0x5e, 0x04, 0x52, 0x8b, 0x56, 0xf4, 0x50,
-  0x8b, 0x46, 0xf6, 0x8b, 0x4e, 0x06, 0xe8, 0xa7, 0xfc, 0x0e, 0x3e, 0xe8,
-  0xc8, 0x74, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc2, 0x0a,
-  0x00, 0xb1, 0x04, 0x8b, 0x46, 0x0c, 0x8b, 0x7e, 0xf6, 0xd3, 0xe0, 0x8e,
-  0x46, 0xf4, 0x89, 0xc1, 0xb0, 0xff, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3,
-  0xab, 0x13, 0xc9, 0xf3, 0xaa, 0x5f, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0xc2, 0x0a, 0x00, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x3e, 0xe8, 0xb9, 0xfc, 0xc7, 0x46, 0xd6, 0x00, 0x00,
-  0xc7, 0x46, 0xd8, 0x01, 0x00, 0xc7, 0x46, 0xda, 0x00, 0x00, 0xc7, 0x46,
-  0xea, 0x00, 0x00, 0xc7, 0x46, 0xe2, 0x00, 0x00, 0xc7, 0x46, 0xe0, 0x00,
-  0x00, 0xc7, 0x46, 0xde, 0x00, 0x00, 0xc7, 0x46, 0xdc, 0x00, 0x00, 0x85,
-  0xc0, 0x74, 0x06, 0xb8, 0x01, 0x00, 0xe9, 0xde, 0x07, 0x16, 0xb8, 0x42,
-  0x01, 0x50, 0x8c, 0xd2, 0x0e, 0xe8, 0x99, 0x0b, 0x90, 0x83, 0xc4, 0x04,
-  0xb8, 0x6c, 0x0b, 0x0e, 0x3e, 0xe8, 0xbc, 0x0b, 0x0e, 0xe8, 0xc6, 0x76,
-  0x90, 0x16, 0xb8, 0x47, 0x01, 0x50, 0x8c, 0xd2, 0x0e, 0xe8, 0x7d, 0x0b,
-  0x90, 0x83, 0xc4, 0x04, 0xb8, 0x6c, 0x0b, 0x0e, 0x3e, 0xe8, 0xa0, 0x0b,
-  0x0e, 0xe8, 0xb4, 0x77, 0x90, 0x16, 0xb8, 0x4c, 0x01, 0x50, 0x8c, 0xd2,
-  0x0e, 0xe8, 0x61, 0x0b, 0x90, 0x83, 0xc4, 0x04, 0xb8, 0x6c, 0x0b, 0x0e,
-  0x3e, 0xe8, 0x84, 0x0b, 0x0e, 0xe8, 0xee, 0x8c, 0x90, 0x16, 0xb8, 0x51,
-  0x01, 0x50, 0x8c, 0xd2, 0x0e, 0xe8, 0x45, 0x0b, 0x90, 0x83, 0xc4, 0x04,
-  0xb8, 0x6c, 0x0b, 0x0e, 0x3e, 0xe8, 0x68, 0x0b, 0x0e, 0xe8, 0xbc, 0x75,
-  0x90, 0x16, 0xb8, 0x57, 0x01, 0x50, 0x8c, 0xd2, 0x0e, 0xe8, 0x29, 0x0b,
-  0x90, 0x83, 0xc4, 0x04, 0xb8, 0x6c, 0x0b, 0x0e, 0x3e, 0xe8, 0x4c, 0x0b,
-  0x0e, 0xe8, 0xa4, 0x8f, 0x90, 0x16, 0xb8, 0x5e, 0x01, 0x50, 0x8c, 0xd2,
-  0x0e, 0xe8, 0x0d, 0x0b, 0x90, 0x83, 0xc4, 0x04, 0xb8, 0x6c, 0x0b, 0x0e,
-  0x3e, 0xe8, 0x30, 0x0b, 0x0e, 0xe8, 0xac, 0x94, 0x90, 0x16, 0xb8, 0x63,
-  0x01, 0x50, 0x8c, 0xd2, 0x0e, 0xe8, 0xf1, 0x0a, 0x90, 0x83, 0xc4, 0x04,
-  0xb8, 0x6c, 0x0b, 0x0e, 0x3e, 0xe8, 0x14, 0x0b, 0x0e, 0xe8, 0xbc, 0x45,
-  0x90, 0x36, 0xa2, 0x54, 0x0b, 0x16, 0xb8, 0x6a, 0x01, 0x50, 0x0e, 0xe8,
-  0xd3, 0x0a, 0x90, 0x83, 0xc4, 0x04, 0x0e, 0xe8, 0x44, 0x9c, 0x90, 0x85,
-  0xc0, 0x75, 0x0c, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xfa, 0x5f, 0x5e, 0x5a,
-  0x5d, 0x4d, 0xcb, 0x36, 0x80, 0x3e, 0xa4, 0x0e, 0x32, 0x76, 0x06, 0x36,
-  0xc6, 0x06, 0xa4, 0x0e, 0x32, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74,
-  0x1a, 0x16, 0xb8, 0x70, 0x01, 0x50, 0x0e, 0xe8, 0x9b, 0x0a, 0x90, 0x83,
-  0xc4, 0x04, 0x16, 0xb8, 0xb1, 0x01, 0x50, 0x0e, 0x3e, 0xe8, 0x8d, 0x0a,
-  0x83, 0xc4, 0x04, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74, 0x03, 0xe9,
-  0xce, 0x00, 0x36, 0x80, 0x3e, 0x0d, 0x0e, 0x03, 0x7c, 0x16, 0x36, 0x80,
-  0x3e, 0x56, 0x0b, 0x00, 0x75, 0x0e, 0xb8, 0xff, 0xff, 0x89, 0xc2, 0x0e,
-  0x3e, 0xe8, 0x30, 0x71, 0x36, 0xa2, 0x55, 0x0b, 0x36, 0x80, 0x3e, 0x0d,
-  0x0e, 0x02, 0x7c, 0xd7, 0x36, 0x80, 0x3e, 0x58, 0x0b, 0x00, 0x75, 0xcf,
-  0xfa, 0xbe, 0xe6, 0x01, 0x8c, 0xd0, 0xbf, 0x30, 0x11, 0x8e, 0xd8, 0x8e,
-  0xc0, 0xb9, 0x20, 0x00, 0x57, 0x8a, 0x04, 0x26, 0x88, 0x05, 0x3c, 0x00,
-  0x74, 0x11, 0x8a, 0x44, 0x01, 0x83, 0xc6, 0x02, 0x26, 0x88, 0x45, 0x01,
-  0x83, 0xc7, 0x02, 0x3c, 0x00, 0x75, 0xe6, 0x5f, 0xbf, 0x20, 0x11, 0x30,
-  0xc0, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa,
-  0x5f, 0x30, 0xe4, 0x50, 0xb8, 0x08, 0x00, 0x8c, 0xd2, 0x50, 0xb8, 0x30,
-  0x11, 0xe8, 0x90, 0xfa, 0x89, 0xc3, 0x89, 0xd1, 0x89, 0xf8, 0x8c, 0xd2,
-  0xbe, 0x20, 0x11, 0xe8, 0x82, 0xfa, 0x0e, 0xe8, 0xa4, 0x72, 0x90, 0xb8,
-  0x08, 0x00, 0xbf, 0x30, 0x11, 0x8c, 0xd2, 0x8c, 0xd1, 0x8e, 0xc2, 0x1e,
-  0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83,
-  0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x75, 0x20, 0xb9, 0x08, 0x00, 0xbf, 0xef,
-  0x01, 0xbe, 0x28, 0x11, 0x8e, 0xda, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05,
-  0x19, 0xc9, 0x83, 0xd9, 0xff, 0x85, 0xc9, 0x75, 0x06, 0x36, 0xc6, 0x06,
-  0x57, 0x0b, 0x01, 0xfb, 0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x0b,
-  0xb8, 0x01, 0x00, 0x0e, 0x3e, 0xe8, 0x30, 0x8f, 0xe9, 0x46, 0x01, 0xfa,
-  0x0e, 0xe8, 0x42, 0xc1, 0x90, 0x84, 0xc0, 0x75, 0x03, 0xe9, 0x2b, 0x01,
-  0x0e, 0xe8, 0x18, 0xc1, 0x90, 0xb1, 0xad, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x06, 0xba,
-  0x64, 0x00, 0x88, 0xc8, 0xee, 0xb1, 0xd0, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x06, 0xba,
-  0x64, 0x00, 0x88, 0xc8, 0xee, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x06, 0xba, 0x60, 0x00, 0xec,
-  0x2a, 0xe4, 0xba, 0x60, 0x00, 0xbb, 0xff, 0xff, 0xec, 0x2a, 0xe4, 0x88,
-  0xc5, 0xba, 0x64, 0x00, 0xb1, 0xd1, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x06, 0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0xbb, 0xff,
-  0xff, 0x88, 0xe9, 0xba, 0x64, 0x00, 0x80, 0xc9, 0x03, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8,
-  0xee, 0x0e, 0x3e, 0xe8, 0x1a, 0xc0, 0xb1, 0xae, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x06,
-  0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0x0e, 0xe8, 0xf2, 0xbf, 0x90, 0xba,
-  0x92, 0x00, 0xec, 0x2a, 0xe4, 0xa8, 0x02, 0x75, 0x03, 0x0c, 0x03, 0xee,
-  0xfb, 0x36, 0xa0, 0x57, 0x0b, 0x30, 0xe4, 0x50, 0x36, 0xa0, 0x55, 0x0b,
-  0x50, 0x30, 0xc0, 0x50, 0x16, 0xb8, 0xf8, 0x01, 0x50, 0x0e, 0x3e, 0xe8,
-  0x3f, 0x08, 0x83, 0xc4, 0x0a, 0x36, 0xff, 0x36, 0xde, 0x0c, 0x36, 0xff,
-  0x36, 0xdc, 0x0c, 0x36, 0xff, 0x36, 0xda, 0x0c, 0x36, 0xff, 0x36, 0xd8,
-  0x0c, 0x36, 0xff, 0x36, 0xea, 0x0c, 0x36, 0xff, 0x36, 0xe8, 0x0c, 0x36,
-  0x80, 0x3e, 0x54, 0x0b, 0x00, 0x74, 0x05, 0xba, 0x1b, 0x02, 0xeb, 0x03,
-  0xba, 0x1f, 0x02, 0x8c, 0xd0, 0x50, 0x52, 0x16, 0xb8, 0x22, 0x02, 0x50,
-  0x0e, 0xe8, 0x01, 0x08, 0x90, 0x83, 0xc4, 0x14, 0x16, 0xb8, 0x3f, 0x02,
-  0x50, 0x0e, 0x3e, 0xe8, 0xf3, 0x07, 0x83, 0xc4, 0x04, 0x0e, 0x3e, 0xe8,
-  0x2f, 0x08, 0x83, 0x7e, 0xd6, 0x00, 0x74, 0x03, 0xe9, 0x0b, 0x04, 0x83,
-  0x7e, 0xd8, 0x00, 0x75, 0x03, 0xe9, 0xf4, 0x01, 0x36, 0xa0, 0xa4, 0x0e,
-  0x30, 0xe4, 0x50, 0xc7, 0x46, 0xe4, 0x40, 0x11, 0xff, 0x76, 0xe2, 0xc7,
-  0x46, 0xf4, 0x00, 0x00, 0xff, 0x76, 0xe0, 0x8c, 0xd2, 0xff, 0x76, 0xde,
-  0xb8, 0x40, 0x11, 0xff, 0x76, 0xdc, 0x8c, 0x56, 0xe6, 0xe8, 0x50, 0xf9,
-  0x36, 0xa0, 0xa4, 0x0e, 0x30, 0xe4, 0x3b, 0x46, 0xf4, 0x7f, 0x03, 0xe9,
-  0xb9, 0x01, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x8b, 0x46, 0xf4, 0x30, 0xf6,
-  0xf7, 0xea, 0x31, 0xff, 0x36, 0x8b, 0x16, 0x98, 0x0e, 0x89, 0xc3, 0x36,
-  0xa1, 0x9a, 0x0e, 0xd1, 0xe3, 0x8e, 0xd8, 0x01, 0xda, 0x89, 0x46, 0xf6,
-  0x89, 0x56, 0xe8, 0x89, 0x56, 0xf8, 0x8b, 0x46, 0xf4, 0x99, 0xb1, 0x0f,
-  0x89, 0xd3, 0xd3, 0xfb, 0x89, 0xc6, 0x89, 0xd8, 0x89, 0xd1, 0x89, 0xf2,
-  0xbe, 0x52, 0x02, 0x0e, 0x3e, 0xe8, 0xf7, 0x03, 0x8b, 0x76, 0xdc, 0x01,
-  0xd6, 0x8b, 0x56, 0xde, 0x11, 0xca, 0x89, 0x56, 0xee, 0x8b, 0x56, 0xe0,
-  0x11, 0xda, 0x89, 0x56, 0xf0, 0x8b, 0x56, 0xe2, 0x11, 0xc2, 0x89, 0xf8,
-  0x89, 0x56, 0xf2, 0x99, 0xb1, 0x0f, 0x89, 0xd3, 0x89, 0x76, 0xec, 0xd3,
-  0xfb, 0x89, 0xc6, 0x89, 0xd8, 0x89, 0xd1, 0x89, 0xf2, 0xbe, 0x5a, 0x02,
-  0x0e, 0xe8, 0xbf, 0x03, 0x90, 0xb8, 0x3c, 0x00, 0x29, 0xd0, 0x89, 0x46,
-  0xce, 0xba, 0x00, 0x00, 0x19, 0xca, 0x8b, 0x4e, 0xee, 0xba, 0x00, 0x00,
-  0x19, 0xda, 0x8b, 0x5e, 0xf0, 0x31, 0xc0, 0x8b, 0x56, 0xec, 0x89, 0x46,
-  0xd0, 0x89, 0x46, 0xd2, 0x89, 0x46, 0xd4, 0x8b, 0x46, 0xf2, 0x8b, 0x76,
-  0xce, 0x0e, 0x3e, 0xe8, 0xb2, 0x06, 0x30, 0xf6, 0x36, 0x8b, 0x1e, 0x50,
-  0x0b, 0x80, 0xe2, 0x0f, 0x36, 0x8e, 0x06, 0x52, 0x0b, 0x01, 0xd3, 0x47,
-  0x26, 0x8a, 0x07, 0x8e, 0x46, 0xf6, 0x30, 0xe4, 0x8b, 0x5e, 0xf8, 0x80,
-  0xcc, 0x0e, 0x83, 0x46, 0xf8, 0x02, 0x26, 0x89, 0x07, 0x83, 0xff, 0x10,
-  0x7d, 0x03, 0xe9, 0x4d, 0xff, 0x89, 0xfb, 0xb1, 0x04, 0xd1, 0xe3, 0x31,
-  0xc0, 0x03, 0x5e, 0xe8, 0x47, 0xc7, 0x07, 0x20, 0x0e, 0xeb, 0x06, 0x40,
-  0x3d, 0x10, 0x00, 0x7d, 0x6b, 0xc4, 0x5e, 0xe4, 0x26, 0x8a, 0x1f, 0x88,
-  0xda, 0x30, 0xf6, 0x36, 0x8b, 0x36, 0x50, 0x0b, 0xd3, 0xfa, 0x36, 0x8e,
-  0x06, 0x52, 0x0b, 0x01, 0xd6, 0x26, 0x8a, 0x14, 0x89, 0xfe, 0xd1, 0xe6,
-  0x30, 0xf6, 0x03, 0x76, 0xe8, 0x80, 0xce, 0x07, 0x89, 0x14, 0x88, 0xda,
-  0x80, 0xe2, 0x0f, 0x36, 0x8b, 0x1e, 0x50, 0x0b, 0x30, 0xf6, 0x36, 0x8e,
-  0x06, 0x52, 0x0b, 0x01, 0xd3, 0x47, 0x26, 0x8a, 0x17, 0x89, 0xfb, 0xd1,
-  0xe3, 0x03, 0x5e, 0xe8, 0x80, 0xce, 0x07, 0x89, 0x17, 0x89, 0xc2, 0x30,
-  0xe6, 0xff, 0x46, 0xe4, 0x80, 0xe2, 0x01, 0x47, 0x83, 0xfa, 0x01, 0x75,
-  0x9e, 0x89, 0xfb, 0xd1, 0xe3, 0x03, 0x5e, 0xe8, 0x01, 0xd7, 0xc7, 0x07,
-  0x20, 0x00, 0xeb, 0x8f, 0x89, 0xfb, 0x83, 0x46, 0xe4, 0xf0, 0xd1, 0xe3,
-  0x31, 0xd2, 0x03, 0x5e, 0xe8, 0x47, 0xc7, 0x07, 0x20, 0x07, 0x89, 0xfb,
-  0x8e, 0x46, 0xe6, 0xd1, 0xe3, 0x8b, 0x76, 0xe4, 0x47, 0x42, 0x26, 0x8a,
-  0x04, 0xff, 0x46, 0xe4, 0x30, 0xe4, 0x89, 0xde, 0x80, 0xcc, 0x0d, 0x03,
-  0x76, 0xe8, 0x83, 0xc3, 0x02, 0x89, 0x04, 0x83, 0xfa, 0x10, 0x7c, 0xe1,
-  0x89, 0xfa, 0xd1, 0xe2, 0x36, 0xa0, 0xa3, 0x0e, 0x30, 0xe4, 0x39, 0xc7,
-  0x7d, 0x0f, 0x89, 0xd3, 0x47, 0x03, 0x5e, 0xe8, 0x83, 0xc2, 0x02, 0xc7,
-  0x07, 0x20, 0x07, 0xeb, 0xe7, 0xff, 0x46, 0xf4, 0xe9, 0x39, 0xfe, 0x30,
-  0xc0, 0x89, 0x46, 0xd8, 0x31, 0xc0, 0x0e, 0xe8, 0x3d, 0x06, 0x90, 0x89,
-  0xc1, 0x30, 0xe5, 0x89, 0xc2, 0x83, 0xf9, 0x1b, 0x75, 0x03, 0xe9, 0xf9,
-  0x01, 0x83, 0xf9, 0x67, 0x74, 0x03, 0xe9, 0xd7, 0x00, 0x0e, 0x3e, 0xe8,
-  0x1e, 0x9e, 0x31, 0xd2, 0x31, 0xc0, 0xc7, 0x46, 0xd8, 0x01, 0x00, 0x0e,
-  0x3e, 0xe8, 0xfc, 0x9b, 0xb8, 0x46, 0x02, 0x8c, 0xd2, 0x31, 0xf6, 0x0e,
-  0x3e, 0xe8, 0x84, 0x9d, 0x0e, 0xe8, 0xa4, 0x9d, 0x90, 0xb9, 0xff, 0xff,
-  0x31, 0xdb, 0x0e, 0xe8, 0xdf, 0x05, 0x90, 0x89, 0xc2, 0x3d, 0x0d, 0x00,
-  0x74, 0x35, 0x3d, 0x1b, 0x00, 0x74, 0x30, 0x3d, 0x30, 0x00, 0x7c, 0x05,
-  0x3d, 0x39, 0x00, 0x7e, 0x0a, 0x83, 0xfa, 0x61, 0x7c, 0x23, 0x83, 0xfa,
-  0x66, 0x7f, 0x1e, 0x83, 0xfe, 0x10, 0x7d, 0x12, 0x88, 0xd0, 0x88, 0x52,
-  0xbc, 0x30, 0xe4, 0x46, 0x0e, 0xe8, 0xb2, 0x9c, 0x36, 0x0e, 0x3e, 0xe8,
-  0x62, 0x9d, 0x88, 0x5a, 0xbc, 0xeb, 0xbf, 0xeb, 0x45, 0x83, 0xfa, 0x08,
-  0x75, 0xb8, 0x85, 0xf6, 0x7e, 0xb4, 0x88, 0x5a, 0xbb, 0x36, 0xa0, 0xa0,
-  0x0e, 0x36, 0x8a, 0x16, 0xa1, 0x0e, 0x00, 0xc8, 0x30, 0xf6, 0x30, 0xe4,
-  0x0e, 0xe8, 0x84, 0x9b, 0x90, 0xb8, 0x20, 0x00, 0x0e, 0xe8, 0x7e, 0x9c,
-  0x90, 0x36, 0xa0, 0xa0, 0x0e, 0x36, 0x8a, 0x16, 0xa1, 0x0e, 0x00, 0xc8,
-  0x30, 0xf6, 0x30, 0xe4, 0x4e, 0x0e, 0x3e, 0xe8, 0x66, 0x9b, 0x0e, 0xe8,
-  0x1a, 0x9d, 0x90, 0xe9, 0x78, 0xff, 0x83, 0xfa, 0x0d, 0x75, 0x51, 0xb8,
-  0x10, 0x00, 0x8c, 0xd2, 0x31, 0xdb, 0x31, 0xc9, 0x50, 0x8d, 0x46, 0xbc,
-  0x0e, 0xe8, 0xae, 0x08, 0x90, 0x89, 0x46, 0xe2, 0x89, 0x5e, 0xe0, 0x89,
-  0x4e, 0xde, 0x89, 0x56, 0xdc, 0xe9, 0x11, 0x01, 0x88, 0xc3, 0x30, 0xff,
-  0x36, 0xf6, 0x87, 0x4d, 0x0a, 0x20, 0x74, 0x27, 0x89, 0xc8, 0x2d, 0x30,
-  0x00, 0xbb, 0x0a, 0x00, 0x99, 0x31, 0xc9, 0x89, 0xc6, 0x89, 0xd7, 0x8b,
-  0x46, 0xda, 0x8b, 0x56, 0xea, 0x0e, 0x3e, 0xe8, 0x94, 0x08, 0x01, 0xf0,
-  0x11, 0xfa, 0x89, 0x46, 0xda, 0x89, 0x56, 0xea, 0xe9, 0xde, 0x00, 0xa8,
-  0xff, 0x75, 0xf9, 0x83, 0x7e, 0xea, 0x00, 0x75, 0x10, 0x83, 0x7e, 0xda,
-  0x00, 0x75, 0x0a, 0xc7, 0x46, 0xda, 0x01, 0x00, 0xc7, 0x46, 0xea, 0x00,
-  0x00, 0x88, 0xf0, 0x98, 0x89, 0xc2, 0x3d, 0x48, 0x00, 0x75, 0x26, 0x8b,
-  0x4e, 0xea, 0x8b, 0x56, 0xda, 0xbe, 0x7a, 0x02, 0x31, 0xc0, 0x31, 0xdb,
-  0xc7, 0x46, 0xd8, 0x01, 0x00, 0x0e, 0x3e, 0xe8, 0x19, 0x01, 0x29, 0x56,
-  0xdc, 0x19, 0x4e, 0xde, 0x19, 0x5e, 0xe0, 0x19, 0x46, 0xe2, 0xe9, 0x8c,
-  0x00, 0x3d, 0x50, 0x00, 0x75, 0x0f, 0x8b, 0x4e, 0xea, 0x8b, 0x56, 0xda,
-  0xbe, 0x72, 0x02, 0x31, 0xc0, 0x31, 0xdb, 0xeb, 0x62, 0x3d, 0x49, 0x00,
-  0x75, 0x38, 0x8b, 0x5e, 0xda, 0x8b, 0x4e, 0xea, 0x36, 0xa0, 0xa4, 0x0e,
-  0x31, 0xd2, 0x30, 0xe4, 0x0e, 0xe8, 0x12, 0x08, 0x90, 0x89, 0xc6, 0x89,
-  0xd1, 0x31, 0xdb, 0x89, 0xf2, 0x31, 0xc0, 0xbe, 0x6a, 0x02, 0xc7, 0x46,
-  0xd8, 0x01, 0x00, 0x0e, 0x3e, 0xe8, 0xc7, 0x00, 0x29, 0x56, 0xdc, 0x19,
-  0x4e, 0xde, 0x19, 0x5e, 0xe0, 0x19, 0x46, 0xe2, 0xeb, 0x3b, 0x3d, 0x51,
-  0x00, 0x75, 0x36, 0x8b, 0x5e, 0xda, 0x8b, 0x4e, 0xea, 0x36, 0xa0, 0xa4,
-  0x0e, 0x31, 0xd2, 0x30, 0xe4, 0x0e, 0x3e, 0xe8, 0xd4, 0x07, 0x89, 0xc6,
-  0x89, 0xd1, 0x31, 0xdb, 0x89, 0xf2, 0x31, 0xc0, 0xbe, 0x62, 0x02, 0xc7,
-  0x46, 0xd8, 0x01, 0x00, 0x0e, 0xe8, 0x8b, 0x00, 0x90, 0x01, 0x56, 0xdc,
-  0x11, 0x4e, 0xde, 0x11, 0x5e, 0xe0, 0x11, 0x46, 0xe2, 0x31, 0xc0, 0x89,
-  0x46, 0xda, 0x89, 0x46, 0xea, 0x83, 0x7e, 0xd6, 0x00, 0x75, 0x03, 0xe9,
-  0xf5, 0xfb, 0xb8, 0xff, 0xff, 0x31, 0xd2, 0x0e, 0x3e, 0xe8, 0x98, 0x6a,
-  0x0e, 0xe8, 0x64, 0x41, 0x90, 0x31, 0xc0, 0x8d, 0x66, 0xfa, 0x5f, 0x5e,
-  0x5a, 0x5d, 0x4d, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x8d, 0x56, 0x14,
-  0x8b, 0x5e, 0x10, 0x8b, 0x4e, 0x12, 0x16, 0x89, 0x56, 0xfc, 0x8d, 0x56,
-  0xfc, 0x8b, 0x46, 0x0c, 0x52, 0x8b, 0x56, 0x0e, 0x8c, 0x56, 0xfe, 0x0e,
-  0x3e, 0xe8, 0x75, 0x0b, 0x89, 0xec, 0x5d, 0x5a, 0x59, 0x5b, 0xcb, 0x00,
-  0x56, 0x26, 0xff, 0x74, 0x06, 0x26, 0xff, 0x74, 0x04, 0x26, 0xff, 0x74,
-  0x02, 0x26, 0xff, 0x34, 0x8b, 0xf4, 0x0e, 0xe8, 0x05, 0x00, 0x83, 0xc4,
-  0x08, 0x5e, 0xcb, 0x55, 0x8b, 0xec, 0x50, 0x53, 0x51, 0x52, 0x36, 0x0b,
-  0x44, 0x06, 0x74, 0x03, 0xe9, 0xc0, 0x00, 0x36, 0x0b, 0x5c, 0x04, 0x75,
-  0x53, 0x36, 0x0b, 0x4c, 0x02, 0x75, 0x15, 0x36, 0x0b, 0x14, 0x75, 0x04,
-  0x8b, 0xe5, 0x5d, 0xcb, 0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x24, 0x92, 0x91,
-  0x8b, 0xe5, 0x5d, 0xcb, 0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x24, 0x50, 0x52,
-  0x8b, 0x46, 0xfa, 0x36, 0xf7, 0x64, 0x02, 0x50, 0x52, 0x8b, 0x46, 0xf8,
-  0x36, 0xf7, 0x64, 0x02, 0x01, 0x46, 0xf4, 0x11, 0x56, 0xf2, 0x11, 0x5e,
-  0xf0, 0x8b, 0x46, 0xfa, 0x36, 0xf7, 0x24, 0x01, 0x46, 0xf4, 0x11, 0x56,
-  0xf2, 0x11, 0x5e, 0xf0, 0x58, 0x5b, 0x59, 0x5a, 0x8b, 0xe5, 0x5d, 0xcb,
-  0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x24, 0x50, 0x52, 0x8b, 0x46, 0xf8, 0x36,
-  0xf7, 0x64, 0x04, 0x50, 0x52, 0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x64, 0x02,
-  0x01, 0x46, 0xf4, 0x11, 0x56, 0xf2, 0x83, 0x56, 0xf0, 0x00, 0x8b, 0x46,
-  0xfa, 0x36, 0xf7, 0x24, 0x01, 0x46, 0xf4, 0x11, 0x56, 0xf2, 0x83, 0x56,
-  0xf0, 0x00, 0x8b, 0x46, 0xfa, 0x36, 0xf7, 0x64, 0x02, 0x01, 0x46, 0xf2,
-  0x11, 0x56, 0xf0, 0x8b, 0x46, 0xfc, 0x36, 0xf7, 0x24, 0x01, 0x46, 0xf2,
-  0x11, 0x56, 0xf0, 0x8b, 0x46, 0xfa, 0x36, 0xf7, 0x64, 0x04, 0x01, 0x46,
-  0xf0, 0x8b, 0x46, 0xfc, 0x36, 0xf7, 0x64, 0x02, 0x01, 0x46, 0xf0, 0x58,
-  0x5b, 0x59, 0x5a, 0x8b, 0xe5, 0x5d, 0xcb, 0x8b, 0x46, 0xf8, 0x36, 0xf7,
-  0x24, 0x50, 0x52, 0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x64, 0x04, 0x50, 0x52,
-  0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x64, 0x02, 0x01, 0x46, 0xf4, 0x11, 0x56,
-  0xf2, 0x83, 0x56, 0xf0, 0x00, 0x8b, 0x46, 0xfa, 0x36, 0xf7, 0x24, 0x01,
-  0x46, 0xf4, 0x11, 0x56, 0xf2, 0x83, 0x56, 0xf0, 0x00, 0x8b, 0x46, 0xfa,
-  0x36, 0xf7, 0x64, 0x02, 0x01, 0x46, 0xf2, 0x11, 0x56, 0xf0, 0x8b, 0x46,
-  0xfc, 0x36, 0xf7, 0x24, 0x01, 0x46, 0xf2, 0x11, 0x56, 0xf0, 0x8b, 0x46,
-  0xfa, 0x36, 0xf7, 0x64, 0x04, 0x01, 0x46, 0xf0, 0x8b, 0x46, 0xfc, 0x36,
-  0xf7, 0x64, 0x02, 0x01, 0x46, 0xf0, 0x8b, 0x46, 0xf8, 0x36, 0xf7, 0x64,
-  0x06, 0x01, 0x46, 0xf0, 0x8b, 0x46, 0xfe, 0x36, 0xf7, 0x24, 0x01, 0x46,
-  0xf0, 0x58, 0x5b, 0x59, 0x5a, 0x8b, 0xe5, 0x5d, 0xcb, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x81, 0xec, 0x06, 0x01, 0xbe, 0xe3, 0x0d, 0x8e, 0xde, 0xc7,
-  0x46, 0xfe, 0x01, 0x00, 0x83, 0x3e, 0x74, 0x15, 0x00, 0x74, 0x0b, 0xc7,
-  0x46, 0xfe, 0x02, 0x00, 0xc7, 0x06, 0x74, 0x15, 0x00, 0x00, 0xff, 0x76,
-  0x0e, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x0a, 0x51, 0x53, 0x52, 0x50, 0xb8,
-  0xe3, 0x0d, 0x50, 0xb8, 0xbc, 0x04, 0x50, 0xb8, 0x00, 0x01, 0x50, 0x16,
-  0x8d, 0x96, 0xfa, 0xfe, 0x52, 0x0e, 0x3e, 0xe8, 0xfa, 0x0c, 0xb8, 0xe3,
-  0x0d, 0x83, 0xc4, 0x18, 0x8e, 0xd8, 0x80, 0x3e, 0x62, 0x10, 0x00, 0x75,
-  0x03, 0xe9, 0x33, 0x01, 0x8c, 0xd0, 0x8d, 0xbe, 0xfa, 0xfe, 0x8e, 0xc0,
-  0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x89, 0xca,
-  0x83, 0xc2, 0x13, 0x80, 0xe2, 0xfe, 0x0e, 0xe8, 0x1a, 0x0d, 0x90, 0x39,
-  0xc2, 0x72, 0x03, 0xe9, 0xec, 0x00, 0x8c, 0xd0, 0x8d, 0xbe, 0xfa, 0xfe,
-  0x8e, 0xc0, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49,
-  0x89, 0xc8, 0x05, 0x13, 0x00, 0x24, 0xfe, 0x2b, 0xe0, 0x8b, 0xc4, 0x8c,
-  0xd2, 0x89, 0xd3, 0x89, 0xc2, 0xbe, 0xe3, 0x04, 0xb8, 0xe3, 0x0d, 0x89,
-  0xd7, 0x8e, 0xc3, 0x8e, 0xd8, 0x57, 0x8a, 0x04, 0x26, 0x88, 0x05, 0x3c,
-  0x00, 0x74, 0x11, 0x8a, 0x44, 0x01, 0x83, 0xc6, 0x02, 0x26, 0x88, 0x45,
-  0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00, 0x75, 0xe6, 0x5f, 0xbe, 0xf4, 0x04,
-  0x89, 0x56, 0xfa, 0x57, 0xb9, 0xff, 0xff, 0xb0, 0x00, 0xf2, 0xae, 0x4f,
-  0x8a, 0x04, 0xaa, 0x3c, 0x00, 0x74, 0x0b, 0x8a, 0x44, 0x01, 0x83, 0xc6,
-  0x02, 0xaa, 0x3c, 0x00, 0x75, 0xee, 0x5f, 0x8c, 0xd0, 0x8d, 0xb6, 0xfa,
-  0xfe, 0x8e, 0xd8, 0x89, 0x5e, 0xfc, 0x57, 0xb9, 0xff, 0xff, 0xb0, 0x00,
-  0xf2, 0xae, 0x4f, 0x8a, 0x04, 0xaa, 0x3c, 0x00, 0x74, 0x0b, 0x8a, 0x44,
-  0x01, 0x83, 0xc6, 0x02, 0xaa, 0x3c, 0x00, 0x75, 0xee, 0x5f, 0x0e, 0xe8,
-  0x7a, 0x0c, 0x90, 0x3d, 0x12, 0x00, 0x76, 0x55, 0xb8, 0x12, 0x00, 0x2b,
-  0xe0, 0x8b, 0xc4, 0x8c, 0xd2, 0x89, 0xc3, 0xff, 0x76, 0xfe, 0xb8, 0xe3,
-  0x0d, 0x50, 0xb8, 0xf7, 0x04, 0x50, 0x52, 0x53, 0x0e, 0xe8, 0x66, 0x0c,
-  0x90, 0xb8, 0xe3, 0x0d, 0x83, 0xc4, 0x0a, 0x8e, 0xd8, 0x80, 0x3e, 0x62,
-  0x10, 0x00, 0x74, 0x0e, 0x52, 0x53, 0xcc, 0xeb, 0x06, 0x57, 0x56, 0x49,
-  0x44, 0x45, 0x4f, 0x83, 0xc4, 0x04, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x80,
-  0x3e, 0x62, 0x10, 0x00, 0x75, 0x15, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xca,
-  0x06, 0x00, 0x31, 0xd2, 0x31, 0xdb, 0xe9, 0x30, 0xff, 0x31, 0xdb, 0x31,
-  0xd2, 0xeb, 0xb0, 0xff, 0x76, 0xfc, 0xff, 0x76, 0xfa, 0xcc, 0xeb, 0x06,
-  0x57, 0x56, 0x49, 0x44, 0x45, 0x4f, 0x83, 0xc4, 0x04, 0xeb, 0xd7, 0x8d,
-  0x9e, 0xfa, 0xfe, 0xb8, 0xe3, 0x04, 0x8c, 0xd1, 0x8c, 0xda, 0x0e, 0xe8,
-  0x33, 0x0c, 0x36, 0x0e, 0x3e, 0xe8, 0x48, 0x00, 0xeb, 0xc0, 0x52, 0x56,
-  0x55, 0x89, 0xe5, 0x89, 0xc6, 0x89, 0xca, 0x8b, 0x4e, 0x0c, 0x89, 0xd8,
-  0x8b, 0x5e, 0x0a, 0x85, 0xf6, 0x74, 0x06, 0x5d, 0x5e, 0x5a, 0xca, 0x0a,
-  0x00, 0xff, 0x76, 0x12, 0xbe, 0xe3, 0x0d, 0xff, 0x76, 0x10, 0x8e, 0xde,
-  0xff, 0x76, 0x0e, 0xc7, 0x06, 0x74, 0x15, 0x01, 0x00, 0x0e, 0xe8, 0x28,
-  0xfe, 0xeb, 0xe0, 0x00, 0x85, 0xf6, 0x74, 0x0b, 0xd1, 0xe8, 0xd1, 0xdb,
-  0xd1, 0xd9, 0xd1, 0xda, 0x4e, 0x75, 0xf5, 0xcb, 0x52, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0xa1, 0xfe, 0x0c, 0x8b, 0x16, 0xfc, 0x0c, 0x3d, 0x00, 0x00,
-  0x75, 0x06, 0x81, 0xfa, 0x62, 0x0f, 0x74, 0x04, 0xff, 0x1e, 0xfc, 0x0c,
-  0x0e, 0xe8, 0x02, 0x00, 0x5a, 0xcb, 0x53, 0x52, 0xbb, 0xff, 0x00, 0xb8,
-  0x08, 0x05, 0xba, 0xe3, 0x0d, 0x0e, 0x3e, 0xe8, 0xeb, 0x0b, 0x5a, 0x5b,
-  0xcb, 0x53, 0x51, 0x52, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x8d, 0x56,
-  0x10, 0x8b, 0x5e, 0x0c, 0x8b, 0x4e, 0x0e, 0x16, 0x89, 0x56, 0xfc, 0x8d,
-  0x56, 0xfc, 0xb8, 0x6c, 0x0b, 0x52, 0xba, 0xe3, 0x0d, 0x8c, 0x56, 0xfe,
-  0x0e, 0xe8, 0xc1, 0x07, 0x90, 0x89, 0xec, 0x5d, 0x5a, 0x59, 0x5b, 0xcb,
-  0x85, 0xd2, 0x75, 0x0c, 0x85, 0xc0, 0x75, 0x08, 0x0e, 0xe8, 0xee, 0x0c,
-  0x90, 0x31, 0xc0, 0xcb, 0xe9, 0xec, 0x0c, 0x89, 0xc0, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0xa1, 0x70, 0x10, 0xc7, 0x06, 0x70, 0x10, 0x00, 0x00, 0x85,
-  0xc0, 0x74, 0x01, 0xcb, 0xb4, 0x08, 0xcd, 0x21, 0x30, 0xe4, 0xcb, 0xe9,
-  0xbd, 0x0f, 0x89, 0xc0, 0x52, 0x3c, 0x30, 0x72, 0x0b, 0x3c, 0x39, 0x77,
-  0x07, 0x30, 0xe4, 0x2d, 0x30, 0x00, 0x5a, 0xc3, 0x30, 0xe4, 0x0e, 0xe8,
-  0x7c, 0x0f, 0x90, 0x89, 0xc2, 0x3c, 0x61, 0x72, 0x04, 0x3c, 0x69, 0x76,
-  0x10, 0x3c, 0x6a, 0x72, 0x04, 0x3c, 0x72, 0x76, 0x08, 0x3c, 0x73, 0x72,
-  0x0b, 0x3c, 0x7a, 0x77, 0x07, 0x30, 0xe4, 0x2d, 0x57, 0x00, 0x5a, 0xc3,
-  0xb8, 0x25, 0x00, 0x5a, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec,
-  0x2a, 0x50, 0x52, 0x53, 0x51, 0x85, 0xc9, 0x75, 0x2b, 0x85, 0xdb, 0x75,
-  0x27, 0x8b, 0x5e, 0xd4, 0x8b, 0x46, 0xd2, 0x89, 0x5e, 0xfa, 0x89, 0x46,
-  0xf2, 0xb8, 0xe3, 0x0d, 0x8e, 0x5e, 0xf2, 0x8b, 0x5e, 0xfa, 0x8a, 0x1f,
-  0x8e, 0xd8, 0x30, 0xff, 0xf6, 0x87, 0x4d, 0x0a, 0x02, 0x74, 0x0e, 0xff,
-  0x46, 0xfa, 0xeb, 0xe8, 0x8e, 0xd9, 0x89, 0x07, 0x89, 0x57, 0x02, 0xeb,
-  0xd0, 0x8e, 0x5e, 0xf2, 0x8b, 0x5e, 0xfa, 0x8a, 0x07, 0x88, 0x46, 0xfe,
-  0x3c, 0x2b, 0x74, 0x03, 0xe9, 0x14, 0x01, 0xff, 0x46, 0xfa, 0x8b, 0x46,
-  0x08, 0x85, 0xc0, 0x74, 0x03, 0xe9, 0x33, 0x01, 0x8e, 0x5e, 0xf2, 0x8b,
-  0x5e, 0xfa, 0x80, 0x3f, 0x30, 0x74, 0x03, 0xe9, 0x0a, 0x01, 0x8a, 0x47,
-  0x01, 0x3c, 0x78, 0x74, 0x03, 0xe9, 0xf9, 0x00, 0xc7, 0x46, 0x08, 0x10,
-  0x00, 0x8e, 0x5e, 0xf2, 0x8b, 0x5e, 0xfa, 0x80, 0x3f, 0x30, 0x75, 0x03,
-  0xe9, 0x41, 0x01, 0x8b, 0x5e, 0xfa, 0x8b, 0x46, 0xf2, 0xb1, 0x03, 0x8b,
-  0x7e, 0x08, 0x89, 0x5e, 0xec, 0x89, 0x46, 0xee, 0x30, 0xc0, 0xd3, 0xe7,
-  0x88, 0x46, 0xfc, 0x30, 0xe4, 0x31, 0xdb, 0x89, 0x46, 0xf8, 0x89, 0x46,
-  0xf6, 0x89, 0x46, 0xf4, 0x8e, 0x5e, 0xf2, 0x8b, 0x76, 0xfa, 0x8a, 0x04,
-  0x30, 0xe4, 0xe8, 0x03, 0xff, 0x89, 0x46, 0xf0, 0x3b, 0x46, 0x08, 0x7d,
-  0x03, 0xe9, 0x19, 0x01, 0x8b, 0x46, 0xf2, 0x3b, 0x46, 0xee, 0x75, 0x11,
-  0x3b, 0x76, 0xec, 0x75, 0x0c, 0x8b, 0x76, 0xd4, 0x8b, 0x46, 0xd2, 0x89,
-  0x76, 0xfa, 0x89, 0x46, 0xf2, 0x83, 0x7e, 0xce, 0x00, 0x75, 0x06, 0x83,
-  0x7e, 0xd0, 0x00, 0x74, 0x11, 0x8e, 0x5e, 0xce, 0x8b, 0x76, 0xd0, 0x8b,
-  0x7e, 0xfa, 0x8b, 0x46, 0xf2, 0x89, 0x3c, 0x89, 0x44, 0x02, 0x83, 0x7e,
-  0x0a, 0x01, 0x75, 0x36, 0x81, 0xfb, 0x00, 0x80, 0x77, 0x12, 0x75, 0x2e,
-  0x83, 0x7e, 0xf8, 0x00, 0x77, 0x0a, 0x75, 0x26, 0x83, 0x7e, 0xf6, 0x00,
-  0x77, 0x02, 0x75, 0x1e, 0x81, 0xfb, 0x00, 0x80, 0x75, 0x1e, 0x83, 0x7e,
-  0xf8, 0x00, 0x75, 0x18, 0x83, 0x7e, 0xf6, 0x00, 0x75, 0x12, 0x83, 0x7e,
-  0xf4, 0x00, 0x75, 0x0c, 0x80, 0x7e, 0xfe, 0x2d, 0x75, 0x06, 0x80, 0x7e,
-  0xfc, 0x00, 0x74, 0x68, 0xb8, 0x0e, 0x00, 0x0e, 0x3e, 0xe8, 0x5d, 0x0e,
-  0x83, 0x7e, 0x0a, 0x00, 0x74, 0x6f, 0x80, 0x7e, 0xfe, 0x2d, 0x75, 0x6c,
-  0xb8, 0x00, 0x80, 0x31, 0xdb, 0x31, 0xc9, 0x31, 0xff, 0x89, 0xfa, 0x89,
-  0xec, 0x5d, 0x5f, 0x5e, 0xc2, 0x04, 0x00, 0x3c, 0x2d, 0x75, 0x03, 0xe9,
-  0xe5, 0xfe, 0xe9, 0xe5, 0xfe, 0x3c, 0x58, 0x75, 0x03, 0xe9, 0x00, 0xff,
-  0x8e, 0x5e, 0xf2, 0x8b, 0x5e, 0xfa, 0x80, 0x3f, 0x30, 0x75, 0x08, 0xc7,
-  0x46, 0x08, 0x08, 0x00, 0xe9, 0x00, 0xff, 0xc7, 0x46, 0x08, 0x0a, 0x00,
-  0xe9, 0xf8, 0xfe, 0x3d, 0x02, 0x00, 0x7c, 0x13, 0x3d, 0x24, 0x00, 0x7f,
-  0x0e, 0x3d, 0x10, 0x00, 0x75, 0x03, 0xe9, 0xd8, 0xfe, 0xe9, 0xe3, 0xfe,
-  0xe9, 0x2a, 0x01, 0xb8, 0x0d, 0x00, 0x0e, 0xe8, 0xf3, 0x0d, 0x90, 0x31,
-  0xdb, 0x31, 0xc9, 0x31, 0xff, 0x31, 0xc0, 0xeb, 0xa0, 0xe9, 0x09, 0x01,
-  0xbb, 0xff, 0xff, 0xb8, 0xff, 0x7f, 0x89, 0xd9, 0x89, 0xdf, 0xeb, 0x91,
-  0x8a, 0x47, 0x01, 0x3c, 0x78, 0x75, 0x07, 0x83, 0x46, 0xfa, 0x02, 0xe9,
-  0xb1, 0xfe, 0x3c, 0x58, 0x74, 0xf5, 0xe9, 0xaa, 0xfe, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0x8b, 0x85, 0x34, 0x0f, 0x39, 0xc3, 0x77, 0x2f, 0x75, 0x31,
-  0x8b, 0x46, 0xf8, 0x3b, 0x85, 0x32, 0x0f, 0x77, 0x24, 0x8b, 0x46, 0xf8,
-  0x3b, 0x85, 0x32, 0x0f, 0x75, 0x1f, 0x8b, 0x46, 0xf6, 0x3b, 0x85, 0x30,
-  0x0f, 0x77, 0x12, 0x8b, 0x46, 0xf6, 0x3b, 0x85, 0x30, 0x0f, 0x75, 0x0d,
-  0x8b, 0x46, 0xf4, 0x3b, 0x85, 0x2e, 0x0f, 0x76, 0x04, 0xc6, 0x46, 0xfc,
-  0x01, 0x8b, 0x46, 0xf8, 0x89, 0x46, 0xe6, 0x8b, 0x46, 0xf6, 0x89, 0x46,
-  0xde, 0x8b, 0x46, 0xf4, 0x89, 0x46, 0xe4, 0x8b, 0x46, 0x08, 0xb1, 0x0f,
-  0x99, 0x89, 0x5e, 0xe8, 0x89, 0x46, 0xd6, 0x89, 0x56, 0xd8, 0x89, 0xd8,
-  0xd3, 0xfa, 0x8b, 0x5e, 0xf8, 0x8b, 0x4e, 0xf6, 0x89, 0x56, 0xda, 0x89,
-  0x56, 0xdc, 0x8b, 0x56, 0xf4, 0x8d, 0x76, 0xd6, 0x0e, 0xe8, 0x97, 0xf9,
-  0x90, 0x89, 0xc6, 0x89, 0x5e, 0xe0, 0x89, 0x4e, 0xea, 0x8b, 0x46, 0xf0,
-  0x89, 0xd3, 0x99, 0xb1, 0x0f, 0x89, 0x56, 0xe2, 0xd3, 0xfa, 0x01, 0xc3,
-  0x89, 0x5e, 0xf4, 0x8b, 0x46, 0xea, 0x13, 0x46, 0xe2, 0x89, 0x46, 0xf6,
-  0x8b, 0x46, 0xe0, 0x11, 0xd0, 0x89, 0x46, 0xf8, 0x8b, 0x46, 0xe8, 0x89,
-  0xd3, 0x11, 0xf3, 0x39, 0xc3, 0x72, 0x30, 0x75, 0x28, 0x8b, 0x46, 0xf8,
-  0x3b, 0x46, 0xe6, 0x72, 0x26, 0x8b, 0x46, 0xf8, 0x3b, 0x46, 0xe6, 0x75,
-  0x18, 0x8b, 0x46, 0xf6, 0x3b, 0x46, 0xde, 0x72, 0x16, 0x8b, 0x46, 0xf6,
-  0x3b, 0x46, 0xde, 0x75, 0x08, 0x8b, 0x46, 0xf4, 0x3b, 0x46, 0xe4, 0x72,
-  0x06, 0xff, 0x46, 0xfa, 0xe9, 0xed, 0xfd, 0xc6, 0x46, 0xfc, 0x01, 0xeb,
-  0xf4, 0xb8, 0xff, 0xff, 0x89, 0xc3, 0x89, 0xc1, 0x89, 0xc7, 0xe9, 0x88,
-  0xfe, 0x80, 0x7e, 0xfe, 0x2d, 0x75, 0x21, 0x31, 0xc0, 0x2b, 0x46, 0xf4,
-  0x89, 0x46, 0xf4, 0xb8, 0x00, 0x00, 0x1b, 0x46, 0xf6, 0x89, 0x46, 0xf6,
-  0xb8, 0x00, 0x00, 0x1b, 0x46, 0xf8, 0x89, 0x46, 0xf8, 0xb8, 0x00, 0x00,
-  0x19, 0xd8, 0x89, 0xc3, 0x8b, 0x4e, 0xf6, 0x8b, 0x7e, 0xf4, 0x89, 0xd8,
-  0x8b, 0x5e, 0xf8, 0xe9, 0x53, 0xfe, 0x56, 0x55, 0x89, 0xe5, 0x31, 0xf6,
-  0xeb, 0x07, 0x56, 0x55, 0x89, 0xe5, 0xbe, 0x01, 0x00, 0x56, 0xff, 0x76,
-  0x08, 0xe8, 0xdd, 0xfc, 0x5d, 0x5e, 0xca, 0x02, 0x00, 0x00, 0x93, 0x50,
-  0x92, 0x0b, 0xc0, 0x74, 0x02, 0xf7, 0xe2, 0x91, 0x0b, 0xc0, 0x74, 0x04,
-  0xf7, 0xe3, 0x03, 0xc8, 0x58, 0xf7, 0xe3, 0x03, 0xd1, 0xcb, 0xe9, 0x88,
-  0x00, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x57, 0x61, 0x74, 0x63, 0x6f, 0x6d,
-  0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x31, 0x36, 0x20, 0x52, 0x75, 0x6e,
-  0x2d, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
-  0x2e, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x43,
-  0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29,
-  0x20, 0x53, 0x79, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x49, 0x6e, 0x63,
-  0x2e, 0x20, 0x31, 0x39, 0x38, 0x38, 0x2d, 0x32, 0x30, 0x30, 0x32, 0x2e,
-  0x2a, 0x2a, 0x2a, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x61, 0x73, 0x73,
-  0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x74, 0x65,
-  0x63, 0x74, 0x65, 0x64, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f,
-  0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x63,
-  0x6f, 0x6e, 0x00, 0x0d, 0x0a, 0xfb, 0xb9, 0xe3, 0x0d, 0x8e, 0xc1, 0xbb,
-  0xa5, 0x16, 0x83, 0xc3, 0x0f, 0x80, 0xe3, 0xf0, 0x26, 0x89, 0x1e, 0x6c,
-  0x10, 0x26, 0x8c, 0x1e, 0x66, 0x10, 0x03, 0xdc, 0x83, 0xc3, 0x0f, 0x80,
-  0xe3, 0xf0, 0x8e, 0xd1, 0x8b, 0xe3, 0x26, 0x89, 0x1e, 0x6e, 0x10, 0x8b,
-  0xd3, 0xd1, 0xea, 0xd1, 0xea, 0xd1, 0xea, 0xd1, 0xea, 0x26, 0x80, 0x3e,
-  0x6a, 0x10, 0x00, 0x75, 0x3f, 0x8b, 0x0e, 0x02, 0x00, 0x8c, 0xc0, 0x2b,
-  0xc8, 0x3b, 0xd1, 0x72, 0x0d, 0xbb, 0x01, 0x00, 0xb8, 0xc9, 0x13, 0x8c,
-  0xca, 0x0e, 0x3e, 0xe8, 0x27, 0x07, 0x8c, 0xc0, 0x8b, 0xda, 0xd1, 0xe3,
-  0xd1, 0xe3, 0xd1, 0xe3, 0xd1, 0xe3, 0x75, 0x03, 0xbb, 0xfe, 0xff, 0x26,
-  0x89, 0x1e, 0x64, 0x10, 0x8b, 0xda, 0x03, 0xd8, 0x26, 0xa1, 0x66, 0x10,
-  0x8e, 0xc0, 0x2b, 0xd8, 0xb4, 0x4a, 0xcd, 0x21, 0x8c, 0xdf, 0x8e, 0xc7,
-  0xbf, 0x81, 0x00, 0x8a, 0x4d, 0xff, 0xb5, 0x00, 0xfc, 0xb0, 0x20, 0xf3,
-  0xae, 0x8d, 0x75, 0xff, 0xba, 0xe3, 0x0d, 0x8e, 0xc2, 0x26, 0x8b, 0x3e,
-  0x6c, 0x10, 0x26, 0x89, 0x3e, 0x86, 0x10, 0x26, 0x8c, 0x06, 0x88, 0x10,
-  0x74, 0x03, 0x41, 0xf3, 0xa4, 0x2a, 0xc0, 0xaa, 0xb0, 0x00, 0xaa, 0x4f,
-  0xb4, 0x30, 0xcd, 0x21, 0x26, 0xa2, 0x68, 0x10, 0x26, 0x88, 0x26, 0x69,
-  0x10, 0x8b, 0xcf, 0x3c, 0x03, 0x72, 0x58, 0x8e, 0x1e, 0x2c, 0x00, 0x2b,
-  0xf6, 0xbd, 0x00, 0x01, 0x8b, 0x04, 0x0d, 0x20, 0x20, 0x3d, 0x6e, 0x6f,
-  0x75, 0x12, 0x81, 0x7c, 0x02, 0x38, 0x37, 0x75, 0x27, 0x80, 0x7c, 0x04,
-  0x3d, 0x75, 0x21, 0x83, 0xcd, 0x01, 0xeb, 0x1c, 0x3d, 0x6c, 0x66, 0x75,
-  0x1a, 0x8b, 0x44, 0x02, 0x0c, 0x20, 0x3d, 0x6e, 0x3d, 0x75, 0x10, 0x8a,
-  0x44, 0x04, 0x0c, 0x20, 0x3c, 0x6e, 0x75, 0x07, 0x81, 0xe5, 0xff, 0xfe,
-  0x83, 0xc6, 0x05, 0x80, 0x3c, 0x00, 0xac, 0x75, 0xfa, 0x80, 0x3c, 0x00,
-  0x75, 0xba, 0xac, 0x46, 0x46, 0x80, 0x3c, 0x00, 0xa4, 0x75, 0xfa, 0x8e,
-  0xda, 0x8b, 0xf1, 0x89, 0x36, 0x8a, 0x10, 0x8c, 0x06, 0x8c, 0x10, 0x8b,
-  0xdc, 0x8b, 0xc5, 0xa2, 0x74, 0x10, 0x20, 0x26, 0x8e, 0x10, 0x89, 0x3e,
-  0x6c, 0x10, 0xb9, 0xa5, 0x16, 0xbf, 0x20, 0x11, 0x2b, 0xcf, 0xb0, 0x00,
-  0xf3, 0xaa, 0x83, 0x3e, 0x76, 0x10, 0x00, 0x75, 0x18, 0xb8, 0xe3, 0x15,
-  0xa3, 0x76, 0x10, 0x8c, 0x0e, 0x78, 0x10, 0xa3, 0x7a, 0x10, 0x8c, 0x0e,
-  0x7c, 0x10, 0xa3, 0x7e, 0x10, 0x8c, 0x0e, 0x80, 0x10, 0x33, 0xed, 0x55,
-  0x8b, 0xec, 0xb8, 0xe2, 0x15, 0xa3, 0x82, 0x10, 0x8c, 0x0e, 0x84, 0x10,
-  0xb8, 0xff, 0x00, 0x0e, 0x3e, 0xe8, 0x24, 0x0b, 0x0e, 0xe8, 0xba, 0x0a,
-  0x90, 0x50, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0xfc, 0x8d, 0x3e, 0x00, 0x00,
-  0x8e, 0xc2, 0xb9, 0x10, 0x00, 0xb8, 0x01, 0x01, 0xf3, 0xaf, 0x58, 0x74,
-  0x3b, 0x8b, 0xd8, 0xb8, 0xac, 0x13, 0x8c, 0xca, 0xbc, 0x25, 0x17, 0x53,
-  0x50, 0x52, 0x8c, 0xcf, 0x8e, 0xdf, 0xba, 0xdb, 0x13, 0xb8, 0x01, 0x3d,
-  0xcd, 0x21, 0x8b, 0xd8, 0x1f, 0x5a, 0x8b, 0xf2, 0xfc, 0xac, 0x3c, 0x00,
-  0x75, 0xfb, 0x8b, 0xce, 0x2b, 0xca, 0x49, 0xb4, 0x40, 0xcd, 0x21, 0x8e,
-  0xdf, 0xba, 0xdf, 0x13, 0xb9, 0x02, 0x00, 0xb4, 0x40, 0xcd, 0x21, 0x58,
-  0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x80, 0x3e, 0x56, 0x10, 0x00, 0x74, 0x0d,
-  0x50, 0xa0, 0x57, 0x10, 0xb4, 0x25, 0xc5, 0x16, 0x58, 0x10, 0xcd, 0x21,
-  0x58, 0x50, 0xb8, 0x00, 0x00, 0xba, 0x0f, 0x00, 0x0e, 0xe8, 0x03, 0x0b,
-  0x90, 0x58, 0xb4, 0x4c, 0xcd, 0x21, 0x50, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8,
-  0x58, 0xc3, 0xcb, 0xcb, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x02, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xbe, 0x5a, 0x0b, 0x80,
-  0x26, 0x89, 0x0b, 0xf8, 0x89, 0xc1, 0x80, 0x0e, 0x89, 0x0b, 0x04, 0x8e,
-  0xd9, 0x83, 0x7c, 0x0a, 0x00, 0x75, 0x16, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8,
-  0x31, 0xc0, 0xa3, 0x64, 0x14, 0xa3, 0x66, 0x14, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0xb8, 0x12, 0x00, 0x0e, 0xe8, 0xa1, 0x0d,
-  0x90, 0x89, 0xc7, 0x85, 0xc0, 0x75, 0x71, 0xb8, 0x12, 0x00, 0x0e, 0xe8,
-  0x48, 0x02, 0x90, 0x89, 0xc7, 0x89, 0x56, 0xfe, 0x85, 0xd2, 0x75, 0x04,
-  0x85, 0xc0, 0x74, 0x5e, 0x8e, 0x5e, 0xfe, 0x89, 0x75, 0x04, 0xb8, 0xe3,
-  0x0d, 0x89, 0x4d, 0x06, 0x8e, 0xd8, 0x8b, 0x16, 0x60, 0x14, 0xa1, 0x62,
-  0x14, 0x8e, 0x5e, 0xfe, 0x89, 0x45, 0x02, 0xb8, 0xe3, 0x0d, 0x89, 0x15,
-  0x8e, 0xd8, 0x8b, 0x46, 0xfe, 0x89, 0x3e, 0x60, 0x14, 0xa3, 0x62, 0x14,
-  0x8e, 0xd9, 0x89, 0x7c, 0x06, 0x89, 0x44, 0x08, 0x8b, 0x7c, 0x06, 0x8e,
-  0xd8, 0xc7, 0x45, 0x08, 0x00, 0x00, 0xc7, 0x45, 0x0a, 0x00, 0x00, 0x8e,
-  0xd9, 0xc5, 0x7c, 0x06, 0xc6, 0x45, 0x10, 0x00, 0x8e, 0xd9, 0xc5, 0x7c,
-  0x06, 0x83, 0xc6, 0x12, 0xc7, 0x45, 0x0c, 0x00, 0x00, 0xe9, 0x63, 0xff,
-  0xeb, 0x10, 0xbb, 0x01, 0x00, 0xb8, 0x5c, 0x09, 0xba, 0xe3, 0x0d, 0x0e,
-  0x3e, 0xe8, 0xad, 0x04, 0xeb, 0x92, 0xc7, 0x46, 0xfe, 0xe3, 0x0d, 0xeb,
-  0x8b, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04,
-  0xb1, 0x03, 0x89, 0xc3, 0xd3, 0xe3, 0x01, 0xc3, 0x31, 0xc9, 0xd1, 0xe3,
-  0xb8, 0xe3, 0x0d, 0x81, 0xc3, 0x5a, 0x0b, 0x8e, 0xd8, 0x89, 0x5e, 0xfc,
-  0x8b, 0x16, 0x62, 0x14, 0x8b, 0x1e, 0x60, 0x14, 0x85, 0xd2, 0x75, 0x04,
-  0x85, 0xdb, 0x74, 0x3b, 0x8e, 0xda, 0x8b, 0x07, 0x8b, 0x7f, 0x02, 0xc5,
-  0x77, 0x04, 0x89, 0x46, 0xfe, 0x8a, 0x44, 0x0b, 0xbb, 0x01, 0x00, 0xa8,
-  0x40, 0x75, 0x04, 0xa8, 0x08, 0x74, 0x11, 0x89, 0xf0, 0x8c, 0xda, 0x0e,
-  0x3e, 0xe8, 0x44, 0x0e, 0x41, 0x8b, 0x5e, 0xfe, 0x89, 0xfa, 0xeb, 0xcc,
-  0x3b, 0x76, 0xfc, 0x72, 0xf4, 0x81, 0xfe, 0xb4, 0x0b, 0x73, 0xe4, 0x31,
-  0xdb, 0xeb, 0xe0, 0x89, 0xc8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0xb8, 0x05, 0x00, 0xe8, 0x81, 0xff, 0xcb, 0x31, 0xc0, 0xe8,
-  0x7b, 0xff, 0xe9, 0xf3, 0x0e, 0x89, 0xc0, 0x51, 0x56, 0x89, 0xc6, 0x89,
-  0xd8, 0x8e, 0xda, 0x8b, 0x1c, 0x8b, 0x4c, 0x02, 0x0e, 0xe8, 0x21, 0x0f,
-  0x90, 0x8e, 0xda, 0xff, 0x44, 0x0c, 0x5e, 0x59, 0xcb, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x06, 0x89, 0xc6, 0x89, 0x56, 0xfe, 0x89, 0xdf,
-  0x8e, 0xda, 0xc5, 0x5c, 0x06, 0x8b, 0x47, 0x0c, 0x3d, 0x01, 0x00, 0x74,
-  0x0c, 0x85, 0xc0, 0x74, 0x03, 0xe9, 0xa4, 0x00, 0xc7, 0x47, 0x0c, 0x01,
-  0x00, 0x8e, 0x5e, 0xfe, 0x8b, 0x44, 0x0a, 0x8b, 0x5c, 0x06, 0x30, 0xe4,
-  0x80, 0x64, 0x0a, 0xcf, 0x24, 0x30, 0x8e, 0x5c, 0x08, 0x89, 0x46, 0xfa,
-  0x8b, 0x47, 0x0a, 0x8b, 0x57, 0x08, 0x85, 0xc0, 0x75, 0x0e, 0x85, 0xd2,
-  0x75, 0x0a, 0x8b, 0x56, 0xfe, 0x89, 0xf0, 0x0e, 0x3e, 0xe8, 0x91, 0x0f,
-  0x8e, 0x5e, 0xfe, 0xc7, 0x46, 0xfc, 0x00, 0x00, 0xf6, 0x44, 0x0b, 0x04,
-  0x74, 0x0d, 0x80, 0x64, 0x0b, 0xfa, 0xc7, 0x46, 0xfc, 0x01, 0x00, 0x80,
-  0x4c, 0x0b, 0x01, 0xb8, 0x00, 0x00, 0x50, 0xb8, 0x43, 0x17, 0x50, 0x8b,
-  0x56, 0xfe, 0xff, 0x76, 0x0c, 0x89, 0xfb, 0xff, 0x76, 0x0a, 0x89, 0xf0,
-  0x0e, 0xe8, 0xf7, 0x0f, 0x90, 0x89, 0xc3, 0x83, 0x7e, 0xfc, 0x00, 0x74,
-  0x14, 0x8e, 0x5e, 0xfe, 0x89, 0xf0, 0x80, 0x64, 0x0b, 0xfa, 0x8c, 0xda,
-  0x80, 0x4c, 0x0b, 0x04, 0x0e, 0xe8, 0x9f, 0x04, 0x90, 0x8e, 0x5e, 0xfe,
-  0xf6, 0x44, 0x0a, 0x20, 0x74, 0x03, 0xbb, 0xff, 0xff, 0x8e, 0x5e, 0xfe,
-  0x8b, 0x46, 0xfa, 0x09, 0x44, 0x0a, 0x89, 0xd8, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0xca, 0x04, 0x00, 0x31, 0xc0, 0xeb, 0xf4, 0x85, 0xf6, 0x74, 0x0b,
-  0xd1, 0xe2, 0xd1, 0xd1, 0xd1, 0xd3, 0xd1, 0xd0, 0x4e, 0x75, 0xf5, 0xcb,
-  0x53, 0x51, 0x89, 0xd1, 0x85, 0xd2, 0x74, 0x2b, 0x81, 0xfa, 0xe3, 0x0d,
-  0x74, 0x28, 0x31, 0xdb, 0x0e, 0xe8, 0x2e, 0x1e, 0x90, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0x3b, 0x0e, 0x5e, 0x10, 0x74, 0x13, 0x8e, 0xd9, 0x31, 0xdb,
-  0xb9, 0xe3, 0x0d, 0x8b, 0x47, 0x0a, 0x8e, 0xc1, 0x26, 0x3b, 0x06, 0x60,
-  0x10, 0x77, 0x0b, 0x59, 0x5b, 0xcb, 0x0e, 0xe8, 0x65, 0x1f, 0x90, 0x59,
-  0x5b, 0xcb, 0x8e, 0xd9, 0xa3, 0x60, 0x10, 0x59, 0x5b, 0xcb, 0x53, 0x51,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x89, 0xc6, 0x85, 0xc0,
-  0x75, 0x03, 0xe9, 0x7a, 0x00, 0x3d, 0xe6, 0xff, 0x77, 0xf8, 0x05, 0x03,
-  0x00, 0x24, 0xfe, 0x89, 0x46, 0xf8, 0x3d, 0x06, 0x00, 0x72, 0x61, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x46, 0xf8, 0x3b, 0x06, 0x60, 0x10, 0x76,
-  0x68, 0x8b, 0x0e, 0x5e, 0x10, 0x85, 0xc9, 0x74, 0x6d, 0xb8, 0xe3, 0x0d,
-  0x89, 0xca, 0x31, 0xdb, 0x8e, 0xd8, 0x89, 0xf0, 0x89, 0x0e, 0x5e, 0x10,
-  0x0e, 0xe8, 0xe4, 0x1c, 0x90, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0x51, 0x89,
-  0xf2, 0x89, 0xc8, 0x0e, 0x3e, 0xe8, 0xfb, 0x1f, 0x85, 0xc0, 0x75, 0xd9,
-  0xba, 0xe3, 0x0d, 0x89, 0x4e, 0xfa, 0x8e, 0xd9, 0x31, 0xff, 0x89, 0x46,
-  0xfc, 0x8b, 0x45, 0x0a, 0x8e, 0xc2, 0x89, 0x4e, 0xfe, 0x26, 0x3b, 0x06,
-  0x60, 0x10, 0x77, 0x5f, 0xc5, 0x7e, 0xfc, 0x8b, 0x4d, 0x04, 0xeb, 0xb1,
-  0xc7, 0x46, 0xf8, 0x06, 0x00, 0xeb, 0x98, 0x31, 0xc0, 0x31, 0xc9, 0x89,
-  0xca, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0x31, 0xc0, 0x8b,
-  0x0e, 0x5c, 0x10, 0xa3, 0x60, 0x10, 0xeb, 0x91, 0xeb, 0x31, 0x89, 0xf0,
-  0x0e, 0xe8, 0x9d, 0x20, 0x90, 0x89, 0xc2, 0x89, 0xc1, 0x85, 0xc0, 0x75,
-  0x28, 0x89, 0xf0, 0x0e, 0x3e, 0xe8, 0x24, 0x21, 0x85, 0xc0, 0x74, 0x03,
-  0xe9, 0x60, 0xff, 0x85, 0xd2, 0x75, 0x10, 0x89, 0xf0, 0x0e, 0x3e, 0xe8,
-  0x7b, 0x0a, 0x89, 0xc3, 0x85, 0xc0, 0x74, 0x03, 0xb9, 0xe3, 0x0d, 0x89,
-  0xd8, 0xeb, 0xb4, 0xeb, 0x26, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x83, 0x3e,
-  0x5c, 0x10, 0x00, 0x75, 0x07, 0x89, 0x16, 0x5c, 0x10, 0xe9, 0x49, 0xff,
-  0xc5, 0x5e, 0xfc, 0x89, 0x57, 0x04, 0x8e, 0xda, 0x31, 0xdb, 0x8b, 0x46,
-  0xfa, 0x89, 0x47, 0x02, 0xe9, 0x36, 0xff, 0x8e, 0xda, 0xa3, 0x60, 0x10,
-  0xe9, 0x71, 0xff, 0x51, 0x56, 0x57, 0x89, 0xc6, 0x8e, 0xc2, 0x89, 0xd8,
-  0x26, 0xc5, 0x1c, 0x26, 0x8b, 0x7c, 0x0c, 0x3b, 0x7f, 0x04, 0x73, 0x16,
-  0x8b, 0x3f, 0x8d, 0x55, 0x01, 0x8b, 0x4f, 0x02, 0x89, 0x17, 0x8e, 0xd9,
-  0x88, 0x05, 0x26, 0xff, 0x44, 0x0c, 0x5f, 0x5e, 0x59, 0xcb, 0xc7, 0x47,
-  0x06, 0xff, 0xff, 0xeb, 0xf5, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83,
-  0xec, 0x08, 0x89, 0xc7, 0x89, 0xd6, 0x8b, 0x56, 0x0c, 0xc7, 0x46, 0xfe,
-  0x00, 0x00, 0x8b, 0x4e, 0x0e, 0x89, 0x46, 0xf8, 0x4b, 0xb8, 0x00, 0x00,
-  0x89, 0x5e, 0xfc, 0x50, 0xb8, 0x8b, 0x19, 0x89, 0xd3, 0x50, 0x8c, 0xd2,
-  0xff, 0x76, 0x12, 0x8d, 0x46, 0xf8, 0xff, 0x76, 0x10, 0x89, 0x76, 0xfa,
-  0x0e, 0xe8, 0xe7, 0x0d, 0x90, 0x8e, 0xde, 0x01, 0xc7, 0xc6, 0x05, 0x00,
-  0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xca, 0x08, 0x00, 0x53, 0x52, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x8d, 0x56, 0x14, 0x16, 0x89, 0x56, 0xfc,
-  0x8d, 0x56, 0xfc, 0x8b, 0x5e, 0x0e, 0x52, 0x8b, 0x46, 0x0a, 0xff, 0x76,
-  0x12, 0x8b, 0x56, 0x0c, 0xff, 0x76, 0x10, 0x8c, 0x56, 0xfe, 0x0e, 0xe8,
-  0x8b, 0xff, 0x89, 0xec, 0x5d, 0x5a, 0x5b, 0xcb, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x0a, 0x89, 0xc7, 0x89, 0xd6, 0x89, 0x5e, 0xfe,
-  0x8b, 0x5e, 0x0c, 0x89, 0x46, 0xf6, 0x8b, 0x46, 0xfe, 0x89, 0x46, 0xfa,
-  0xb8, 0x00, 0x00, 0x8b, 0x4e, 0x0e, 0x50, 0xb8, 0x8b, 0x19, 0x89, 0x56,
-  0xf8, 0x50, 0x8c, 0xd2, 0xff, 0x76, 0x12, 0x8d, 0x46, 0xf6, 0xff, 0x76,
-  0x10, 0xc7, 0x46, 0xfc, 0x00, 0x00, 0x0e, 0xe8, 0x69, 0x0d, 0x90, 0x89,
-  0xc2, 0x3b, 0x46, 0xfe, 0x72, 0x0b, 0x83, 0x7e, 0xfc, 0x00, 0x75, 0x0e,
-  0x89, 0xd0, 0xe9, 0x77, 0xff, 0x8e, 0xde, 0x01, 0xc7, 0xc6, 0x05, 0x00,
-  0xeb, 0xec, 0xb8, 0xff, 0xff, 0xe9, 0x68, 0xff, 0x53, 0x52, 0x55, 0x89,
-  0xe5, 0x83, 0xec, 0x04, 0x8d, 0x56, 0x14, 0x16, 0x89, 0x56, 0xfc, 0x8d,
-  0x56, 0xfc, 0x8b, 0x5e, 0x0e, 0x52, 0x8b, 0x46, 0x0a, 0xff, 0x76, 0x12,
-  0x8b, 0x56, 0x0c, 0xff, 0x76, 0x10, 0x8c, 0x56, 0xfe, 0x0e, 0xe8, 0x77,
-  0xff, 0xe9, 0x6e, 0xff, 0x53, 0xbb, 0xe3, 0x0d, 0x8e, 0xdb, 0x80, 0x3e,
-  0x62, 0x10, 0x00, 0x75, 0x04, 0x31, 0xc0, 0x5b, 0xcb, 0x52, 0x50, 0xcc,
-  0xeb, 0x06, 0x57, 0x56, 0x49, 0x44, 0x45, 0x4f, 0xb8, 0x01, 0x00, 0x83,
-  0xc4, 0x04, 0x5b, 0xcb, 0x52, 0xba, 0xe3, 0x0d, 0x8b, 0xc4, 0x8e, 0xda,
-  0x2b, 0x06, 0x6c, 0x10, 0x5a, 0xcb, 0x53, 0x51, 0x52, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x04, 0x8d, 0x56, 0x14, 0x8b, 0x5e, 0x10, 0x8b, 0x4e, 0x12,
-  0x16, 0x89, 0x56, 0xfc, 0x8d, 0x56, 0xfc, 0x8b, 0x46, 0x0c, 0x52, 0x8b,
-  0x56, 0x0e, 0x8c, 0x56, 0xfe, 0x0e, 0x3e, 0xe8, 0x5e, 0x1f, 0x89, 0xec,
-  0x5d, 0x5a, 0x59, 0x5b, 0xcb, 0x56, 0x57, 0x89, 0xde, 0x89, 0xcf, 0xbb,
-  0x7e, 0x0b, 0xb9, 0xe3, 0x0d, 0x0e, 0x3e, 0xe8, 0x94, 0x03, 0xbb, 0x7e,
-  0x0b, 0xb9, 0xe3, 0x0d, 0xb8, 0x8a, 0x09, 0x89, 0xca, 0x0e, 0x3e, 0xe8,
-  0x84, 0x03, 0xbb, 0x7e, 0x0b, 0xb9, 0xe3, 0x0d, 0x89, 0xf0, 0x89, 0xfa,
-  0x0e, 0xe8, 0x76, 0x03, 0x90, 0x5f, 0x5e, 0xcb, 0xe9, 0x21, 0xfa, 0x89,
-  0xc0, 0x51, 0x56, 0x89, 0xc1, 0x89, 0xd6, 0x0e, 0x3e, 0xe8, 0x5c, 0xff,
-  0x85, 0xc0, 0x74, 0x03, 0x5e, 0x59, 0xcb, 0x89, 0xc8, 0x89, 0xf2, 0x0e,
-  0x3e, 0xe8, 0x04, 0xfa, 0x5e, 0x59, 0xcb, 0x52, 0x56, 0x57, 0x55, 0x89,
-  0xe5, 0x83, 0xec, 0x14, 0x8b, 0x76, 0x0c, 0x8b, 0x7e, 0x10, 0x89, 0xc2,
-  0x8e, 0xd9, 0x8b, 0x07, 0x89, 0x46, 0xec, 0x8b, 0x47, 0x02, 0x89, 0x46,
-  0xee, 0x8b, 0x47, 0x04, 0x89, 0x46, 0xf0, 0x8b, 0x47, 0x06, 0x89, 0x46,
-  0xf2, 0x8b, 0x47, 0x08, 0x89, 0x46, 0xf6, 0x8b, 0x47, 0x0a, 0x8e, 0x5e,
-  0x12, 0x89, 0x46, 0xf8, 0x8b, 0x45, 0x06, 0x89, 0x46, 0xfa, 0x8c, 0xd1,
-  0x8b, 0x05, 0x8d, 0x5e, 0xec, 0x89, 0x46, 0xfc, 0x89, 0xd0, 0x0e, 0xe8,
-  0xdd, 0x1e, 0x90, 0x8e, 0x5e, 0x0e, 0x8b, 0x46, 0xec, 0x89, 0x04, 0x8b,
-  0x46, 0xee, 0x89, 0x44, 0x02, 0x8b, 0x46, 0xf0, 0x89, 0x44, 0x04, 0x8b,
-  0x46, 0xf2, 0x89, 0x44, 0x06, 0x8b, 0x46, 0xf6, 0x89, 0x44, 0x08, 0x8b,
-  0x46, 0xf8, 0x89, 0x44, 0x0a, 0x8b, 0x46, 0xfe, 0x25, 0x01, 0x00, 0x89,
-  0x44, 0x0c, 0x8e, 0x5e, 0x12, 0x8b, 0x46, 0xfa, 0x89, 0x45, 0x06, 0x8b,
-  0x46, 0xfc, 0x89, 0x05, 0x8b, 0x46, 0xec, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0x5a, 0xca, 0x08, 0x00, 0x52, 0x56, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08,
-  0x89, 0xc6, 0x8d, 0x46, 0xf8, 0x8c, 0xd2, 0x0e, 0x3e, 0xe8, 0x93, 0x1e,
-  0x16, 0x8d, 0x56, 0xf8, 0x52, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x0a, 0x89,
-  0xf0, 0x0e, 0xe8, 0x42, 0xff, 0x89, 0xec, 0x5d, 0x5e, 0x5a, 0xca, 0x04,
-  0x00, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02,
-  0x89, 0xc7, 0xbb, 0xe3, 0x0d, 0x8e, 0xdb, 0x31, 0xc9, 0x8b, 0x36, 0x62,
-  0x14, 0x8b, 0x1e, 0x60, 0x14, 0x89, 0x76, 0xfe, 0x8b, 0x46, 0xfe, 0x85,
-  0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x28, 0x8e, 0xd8, 0xc5, 0x77, 0x04,
-  0x85, 0x7c, 0x0a, 0x75, 0x0c, 0x8e, 0x5e, 0xfe, 0xc5, 0x37, 0x89, 0xf3,
-  0x8c, 0x5e, 0xfe, 0xeb, 0xdf, 0x41, 0xf6, 0x44, 0x0b, 0x10, 0x74, 0xed,
-  0x89, 0xf0, 0x8c, 0xda, 0x0e, 0xe8, 0x13, 0x00, 0x90, 0xeb, 0xe2, 0x89,
-  0xc8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0xb8, 0xff,
-  0xff, 0xeb, 0x9e, 0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec,
-  0x08, 0x89, 0xc6, 0x89, 0x56, 0xfe, 0x8e, 0xda, 0xc7, 0x46, 0xfc, 0x00,
-  0x00, 0xf6, 0x44, 0x0b, 0x10, 0x74, 0x03, 0xe9, 0x87, 0x00, 0xc5, 0x7c,
-  0x06, 0x8b, 0x45, 0x0a, 0x8b, 0x55, 0x08, 0x85, 0xc0, 0x75, 0x04, 0x85,
-  0xd2, 0x74, 0x43, 0x8e, 0x5e, 0xfe, 0x80, 0x64, 0x0a, 0xef, 0xf6, 0x44,
-  0x0b, 0x20, 0x75, 0x36, 0x8b, 0x44, 0x04, 0x99, 0x89, 0xd3, 0x09, 0xc3,
-  0x74, 0x16, 0x89, 0xd1, 0x89, 0xc3, 0xba, 0x01, 0x00, 0xf7, 0xd9, 0x8b,
-  0x44, 0x0c, 0xf7, 0xdb, 0x83, 0xd9, 0x00, 0x0e, 0x3e, 0xe8, 0xdb, 0x1d,
-  0x83, 0xfa, 0xff, 0x75, 0x11, 0x3d, 0xff, 0xff, 0x75, 0x0c, 0x8e, 0x5e,
-  0xfe, 0xc7, 0x46, 0xfc, 0xff, 0xff, 0x80, 0x4c, 0x0a, 0x20, 0x8e, 0x5e,
-  0xfe, 0xc5, 0x7c, 0x06, 0x8b, 0x45, 0x08, 0x8b, 0x55, 0x0a, 0x8e, 0x5e,
-  0xfe, 0xc7, 0x44, 0x04, 0x00, 0x00, 0x89, 0x04, 0x89, 0x54, 0x02, 0x83,
-  0x7e, 0xfc, 0x00, 0x75, 0x09, 0xc5, 0x5c, 0x06, 0xf6, 0x47, 0x0e, 0x01,
-  0x75, 0x67, 0x8b, 0x46, 0xfc, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b,
-  0xcb, 0x80, 0x64, 0x0b, 0xef, 0xf6, 0x44, 0x0a, 0x02, 0x74, 0xc3, 0xc5,
-  0x7c, 0x06, 0x8b, 0x45, 0x0a, 0x8b, 0x55, 0x08, 0x85, 0xc0, 0x75, 0x04,
-  0x85, 0xd2, 0x74, 0xb2, 0x8e, 0x5e, 0xfe, 0x89, 0x56, 0xf8, 0x89, 0x46,
-  0xfa, 0x8b, 0x7c, 0x04, 0x85, 0xff, 0x74, 0xa2, 0x83, 0x7e, 0xfc, 0x00,
-  0x75, 0x9c, 0x8e, 0x5e, 0xfe, 0x8b, 0x5e, 0xf8, 0x8b, 0x4e, 0xfa, 0x89,
-  0xfa, 0x8b, 0x44, 0x0c, 0x0e, 0xe8, 0x89, 0x1d, 0x90, 0x89, 0xc2, 0x3d,
-  0xff, 0xff, 0x75, 0x13, 0x8e, 0x5e, 0xfe, 0x89, 0x46, 0xfc, 0x80, 0x4c,
-  0x0a, 0x20, 0x01, 0x56, 0xf8, 0x29, 0xd7, 0xeb, 0xcb, 0xeb, 0x16, 0x85,
-  0xc0, 0x75, 0xf3, 0xb8, 0x0c, 0x00, 0x0e, 0xe8, 0x0b, 0x02, 0x90, 0x8e,
-  0x5e, 0xfe, 0xc7, 0x46, 0xfc, 0xff, 0xff, 0xeb, 0xdd, 0x8e, 0x5e, 0xfe,
-  0x8b, 0x44, 0x0c, 0x0e, 0x3e, 0xe8, 0xaa, 0x1d, 0x3d, 0xff, 0xff, 0x74,
-  0x03, 0xe9, 0x6e, 0xff, 0x89, 0x46, 0xfc, 0xe9, 0x68, 0xff, 0x53, 0xb4,
-  0x35, 0xcd, 0x21, 0x89, 0xd8, 0x8c, 0xc2, 0x5b, 0xcb, 0x52, 0x89, 0xda,
-  0x1e, 0x8e, 0xd9, 0xb4, 0x25, 0xcd, 0x21, 0x1f, 0x5a, 0xcb, 0x51, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x50, 0x52, 0x89, 0xde, 0x85,
-  0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x70, 0x85, 0xdb, 0x74, 0x6a, 0x0e,
-  0x3e, 0xe8, 0x6b, 0x1d, 0x89, 0xc1, 0x81, 0x7e, 0xf8, 0xe3, 0x0d, 0x75,
-  0x67, 0x8b, 0x46, 0xfa, 0x89, 0x46, 0xfc, 0x8b, 0x46, 0xf8, 0x89, 0xda,
-  0x89, 0x46, 0xfe, 0x8b, 0x46, 0xfa, 0x0e, 0xe8, 0xd5, 0x1e, 0x90, 0x85,
-  0xc0, 0x75, 0x6b, 0x89, 0xf0, 0x0e, 0x3e, 0xe8, 0x48, 0xfa, 0x89, 0xc7,
-  0x89, 0x56, 0xfe, 0x89, 0xd0, 0x89, 0x7e, 0xfc, 0x85, 0xd2, 0x75, 0x04,
-  0x85, 0xff, 0x74, 0x60, 0x8b, 0x76, 0xfa, 0x8b, 0x56, 0xf8, 0x8e, 0xc0,
-  0x8b, 0x46, 0xfa, 0x1e, 0x8e, 0xda, 0xd1, 0xe9, 0xf3, 0xa5, 0x11, 0xc9,
-  0xf3, 0xa4, 0x1f, 0x0e, 0x3e, 0xe8, 0xd4, 0xf9, 0x8b, 0x46, 0xfc, 0x8b,
-  0x56, 0xfe, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xcb, 0xeb, 0x0b, 0x89,
-  0xd8, 0x0e, 0x3e, 0xe8, 0x04, 0xfa, 0xeb, 0xee, 0xeb, 0x0b, 0x0e, 0xe8,
-  0xb6, 0xf9, 0x90, 0x31, 0xc0, 0x31, 0xd2, 0xeb, 0xe1, 0x8b, 0x46, 0xfa,
-  0x8b, 0x56, 0xf8, 0x0e, 0x3e, 0xe8, 0xbe, 0x1e, 0x89, 0x46, 0xfc, 0x89,
-  0x56, 0xfe, 0x83, 0x7e, 0xfe, 0x00, 0x75, 0xc4, 0x83, 0x7e, 0xfc, 0x00,
-  0x74, 0x89, 0xeb, 0xbc, 0x81, 0x7e, 0xf8, 0xe3, 0x0d, 0x75, 0x0c, 0x8b,
-  0x46, 0xfa, 0x89, 0xca, 0x0e, 0xe8, 0x47, 0x1e, 0x90, 0xeb, 0xa9, 0x8b,
-  0x46, 0xfa, 0x8b, 0x56, 0xf8, 0x89, 0xcb, 0x0e, 0x3e, 0xe8, 0x8a, 0x1e,
-  0xeb, 0x9a, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x89, 0xc7,
-  0x89, 0x56, 0xfe, 0x89, 0xde, 0x89, 0x4e, 0xfc, 0x8e, 0xd9, 0xc5, 0x5c,
-  0x06, 0x8b, 0x47, 0x0a, 0x8b, 0x57, 0x08, 0x85, 0xc0, 0x75, 0x04, 0x85,
-  0xd2, 0x74, 0x61, 0x8e, 0x5e, 0xfc, 0xc7, 0x46, 0xfa, 0x00, 0x00, 0xf6,
-  0x44, 0x0b, 0x04, 0x75, 0x5e, 0x89, 0x7e, 0xf8, 0x31, 0xd2, 0x8e, 0x5e,
-  0xfe, 0x8a, 0x05, 0x30, 0xe4, 0x85, 0xc0, 0x74, 0x12, 0x8b, 0x4e, 0xfc,
-  0x89, 0xf3, 0x47, 0x0e, 0x3e, 0xe8, 0x5d, 0x07, 0x3d, 0xff, 0xff, 0x75,
-  0xe5, 0x89, 0xc2, 0x83, 0x7e, 0xfa, 0x00, 0x74, 0x1a, 0x8e, 0x5e, 0xfc,
-  0x80, 0x64, 0x0b, 0xf9, 0x80, 0x4c, 0x0b, 0x04, 0x85, 0xd2, 0x75, 0x0b,
-  0x89, 0xf0, 0x8c, 0xda, 0x0e, 0xe8, 0x67, 0xfd, 0x90, 0x89, 0xc2, 0x85,
-  0xd2, 0x75, 0x05, 0x89, 0xfa, 0x2b, 0x56, 0xf8, 0x89, 0xd0, 0x89, 0xec,
-  0x5d, 0x5f, 0x5e, 0xcb, 0x89, 0xf0, 0x89, 0xca, 0x0e, 0xe8, 0xed, 0x07,
-  0x90, 0xeb, 0x94, 0x80, 0x64, 0x0b, 0xf9, 0xc7, 0x46, 0xfa, 0x01, 0x00,
-  0x80, 0x4c, 0x0b, 0x02, 0xeb, 0x93, 0x3d, 0x41, 0x00, 0x7c, 0x08, 0x3d,
-  0x5a, 0x00, 0x7f, 0x03, 0x05, 0x20, 0x00, 0xcb, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xd8, 0x83, 0x3e, 0x70, 0x10, 0x00, 0x74, 0x04, 0xb8, 0x01, 0x00, 0xcb,
-  0xb4, 0x0b, 0xcd, 0x21, 0x30, 0xe4, 0xcb, 0x00, 0xcd, 0x11, 0xcb, 0x52,
-  0x8a, 0xe0, 0x8a, 0xf4, 0xcd, 0x16, 0x75, 0x0a, 0x80, 0xe6, 0x0f, 0x80,
-  0xfe, 0x01, 0x75, 0x02, 0x2b, 0xc0, 0x5a, 0xcb, 0xcd, 0x12, 0xcb, 0x8a,
-  0xe0, 0x8a, 0xc3, 0xcd, 0x17, 0x8a, 0xc4, 0xb4, 0x00, 0xcb, 0x8a, 0xe0,
-  0x8a, 0xc3, 0xcd, 0x14, 0xcb, 0x53, 0x51, 0x52, 0x89, 0xc1, 0x0e, 0xe8,
-  0xc1, 0x1d, 0x90, 0x89, 0xc3, 0x8e, 0xda, 0x89, 0x0f, 0x5a, 0x59, 0x5b,
-  0xcb, 0x53, 0x52, 0x0e, 0x3e, 0xe8, 0xaf, 0x1d, 0x89, 0xc3, 0x8e, 0xda,
-  0xc7, 0x07, 0x0d, 0x00, 0x5a, 0x5b, 0xcb, 0x53, 0x52, 0x0e, 0x3e, 0xe8,
-  0x9d, 0x1d, 0x89, 0xc3, 0x8e, 0xda, 0xc7, 0x07, 0x0e, 0x00, 0x5a, 0x5b,
-  0xcb, 0x53, 0x52, 0x0e, 0x3e, 0xe8, 0x8b, 0x1d, 0x89, 0xc3, 0x8e, 0xda,
-  0xb8, 0xff, 0xff, 0xc7, 0x07, 0x09, 0x00, 0x5a, 0x5b, 0xcb, 0x53, 0x51,
-  0x52, 0x89, 0xc1, 0x0e, 0x3e, 0xe8, 0x7a, 0x1d, 0xeb, 0xb1, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x1e, 0x9a,
-  0x15, 0x8b, 0x0e, 0x9c, 0x15, 0xa1, 0x9e, 0x15, 0xc7, 0x06, 0x96, 0x10,
-  0x00, 0x20, 0x0e, 0xe8, 0x5c, 0xe3, 0x36, 0x0e, 0x3e, 0xe8, 0x5a, 0x1d,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x53, 0x52, 0x55, 0x89, 0xe5, 0x89, 0xc3,
-  0x83, 0x3f, 0x00, 0x75, 0x06, 0x89, 0xec, 0x5d, 0x5a, 0x5b, 0xc3, 0x1e,
-  0xff, 0x17, 0x1f, 0xeb, 0xf4, 0x53, 0x55, 0x89, 0xe5, 0x89, 0xc3, 0x8e,
-  0xc2, 0x26, 0x8b, 0x47, 0x02, 0x26, 0x8b, 0x17, 0x85, 0xc0, 0x75, 0x09,
-  0x85, 0xd2, 0x75, 0x05, 0x89, 0xec, 0x5d, 0x5b, 0xc3, 0x1e, 0x26, 0xff,
-  0x1f, 0x1f, 0xeb, 0xf4, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x89, 0xc1, 0x1e, 0xe8, 0x50, 0xf5, 0xbf, 0x06, 0x11, 0xbb, 0xee, 0x10,
-  0x89, 0xfe, 0x88, 0xc8, 0x81, 0xfb, 0x06, 0x11, 0x73, 0x16, 0x80, 0x3f,
-  0x02, 0x75, 0x05, 0x83, 0xc3, 0x06, 0xeb, 0xf0, 0x3a, 0x47, 0x01, 0x72,
-  0xf6, 0x89, 0xde, 0x8a, 0x47, 0x01, 0xeb, 0xef, 0x81, 0xfe, 0x06, 0x11,
-  0x74, 0x17, 0x8d, 0x44, 0x02, 0x80, 0x3c, 0x00, 0x75, 0x08, 0xe8, 0x80,
-  0xff, 0xc6, 0x04, 0x02, 0xeb, 0xc7, 0x8c, 0xda, 0xe8, 0x8e, 0xff, 0xeb,
-  0xf4, 0x1f, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0x53,
-  0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x89, 0xc1, 0x1e, 0x88, 0xcd, 0xe8,
-  0xf4, 0xf4, 0x88, 0xd1, 0xbf, 0x12, 0x11, 0xbb, 0x06, 0x11, 0x89, 0xfe,
-  0x88, 0xe8, 0x81, 0xfb, 0x12, 0x11, 0x73, 0x16, 0x80, 0x3f, 0x02, 0x75,
-  0x05, 0x83, 0xc3, 0x06, 0xeb, 0xf0, 0x3a, 0x47, 0x01, 0x77, 0xf6, 0x89,
-  0xde, 0x8a, 0x47, 0x01, 0xeb, 0xef, 0x81, 0xfe, 0x12, 0x11, 0x74, 0x1e,
-  0x3a, 0x4c, 0x01, 0x73, 0x05, 0xc6, 0x04, 0x02, 0xeb, 0xcd, 0x8d, 0x44,
-  0x02, 0x80, 0x3c, 0x00, 0x75, 0x05, 0xe8, 0x18, 0xff, 0xeb, 0xee, 0x8c,
-  0xda, 0xe8, 0x29, 0xff, 0xeb, 0xe7, 0x1f, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0x59, 0x5b, 0xcb, 0x00, 0xc3, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52,
-  0xb8, 0xe3, 0x0d, 0x50, 0xb8, 0x80, 0x15, 0x50, 0xb8, 0xe3, 0x0d, 0x50,
-  0xb8, 0x88, 0x15, 0x50, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xff, 0x36, 0x88,
-  0x10, 0x8b, 0x1e, 0x8a, 0x10, 0x8b, 0x0e, 0x8c, 0x10, 0xff, 0x36, 0x86,
-  0x10, 0xa1, 0xa0, 0x15, 0x0e, 0xe8, 0x30, 0x00, 0xbb, 0xe3, 0x0d, 0x8e,
-  0xdb, 0xa3, 0x8c, 0x15, 0x89, 0x16, 0x8e, 0x15, 0xa1, 0x88, 0x15, 0x8b,
-  0x16, 0x82, 0x15, 0xa3, 0x8a, 0x15, 0xa3, 0x9e, 0x15, 0x89, 0x16, 0x86,
-  0x15, 0xa1, 0x80, 0x15, 0x89, 0x16, 0x9c, 0x15, 0xa3, 0x84, 0x15, 0xa3,
-  0x9a, 0x15, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x56, 0x57, 0x83, 0xec, 0x0e, 0x8b, 0x7e, 0x06, 0x89, 0x46, 0xf6, 0x89,
-  0x5e, 0xf2, 0x89, 0x4e, 0xf4, 0x8d, 0x56, 0xee, 0x16, 0x31, 0xc0, 0x52,
-  0x8b, 0x4e, 0x08, 0x50, 0x89, 0xfb, 0x50, 0x8b, 0x46, 0xf6, 0xe8, 0xc0,
-  0x00, 0x89, 0xc2, 0x8b, 0x46, 0xee, 0x29, 0xf8, 0x89, 0xc1, 0x05, 0x02,
-  0x00, 0x24, 0xfe, 0x42, 0x89, 0xc3, 0x89, 0xd0, 0xd1, 0xe0, 0xd1, 0xe0,
-  0x89, 0xde, 0x05, 0x04, 0x00, 0x01, 0xc6, 0x46, 0x83, 0xe6, 0xfe, 0x41,
-  0x89, 0xf0, 0xba, 0xe3, 0x0d, 0x0e, 0x3e, 0xe8, 0xd3, 0x01, 0x89, 0x46,
-  0xfa, 0x85, 0xc0, 0x74, 0x2e, 0x31, 0xf6, 0x31, 0xc0, 0x89, 0x76, 0xf8,
-  0x85, 0xd2, 0x75, 0x2f, 0x83, 0x7e, 0xfa, 0x00, 0x75, 0x29, 0xc5, 0x5e,
-  0x0a, 0x89, 0x07, 0xc5, 0x5e, 0x0e, 0x8b, 0x46, 0xf8, 0x89, 0x37, 0x89,
-  0x47, 0x02, 0x8b, 0x46, 0xfa, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d,
-  0xca, 0x0c, 0x00, 0x89, 0xf0, 0x0e, 0x3e, 0xe8, 0x4c, 0xf6, 0x89, 0x46,
-  0xfa, 0xeb, 0xc6, 0x8e, 0x5e, 0x08, 0x89, 0xfe, 0x8e, 0xc2, 0x8b, 0x7e,
-  0xfa, 0x8b, 0x46, 0xf2, 0x57, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9, 0xf3,
-  0xa4, 0x5f, 0x89, 0xfe, 0x8e, 0xda, 0x16, 0x89, 0xd1, 0x01, 0xde, 0x8d,
-  0x5e, 0xee, 0x89, 0x04, 0x53, 0x8b, 0x46, 0xf4, 0x52, 0x89, 0x44, 0x02,
-  0x8d, 0x44, 0x04, 0x89, 0xfb, 0x50, 0x8b, 0x46, 0xf6, 0xe8, 0x19, 0x00,
-  0x40, 0x89, 0xc7, 0xd1, 0xe7, 0xd1, 0xe7, 0x8e, 0xda, 0x01, 0xf7, 0xc7,
-  0x05, 0x00, 0x00, 0x89, 0x56, 0xf8, 0xc7, 0x45, 0x02, 0x00, 0x00, 0xeb,
-  0x85, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x89, 0xc2,
-  0x8e, 0xd9, 0x8b, 0x4e, 0x0c, 0xc7, 0x46, 0xfc, 0x00, 0x00, 0x8a, 0x07,
-  0x3c, 0x20, 0x75, 0x03, 0x43, 0xeb, 0xf7, 0x3c, 0x09, 0x74, 0xf9, 0x84,
-  0xc0, 0x74, 0x30, 0x30, 0xc0, 0x80, 0x3f, 0x22, 0x74, 0x20, 0x89, 0x5e,
-  0xf8, 0x8c, 0x5e, 0xfa, 0x8c, 0x5e, 0xfe, 0x89, 0xde, 0x8e, 0x46, 0xfe,
-  0x80, 0x3f, 0x22, 0x75, 0x53, 0x85, 0xd2, 0x75, 0x15, 0x43, 0x84, 0xc0,
-  0x75, 0x09, 0xb0, 0x02, 0xeb, 0xee, 0xb0, 0x01, 0x43, 0xeb, 0xdb, 0x30,
-  0xc0, 0xeb, 0xe5, 0xe9, 0x9a, 0x00, 0x3c, 0x01, 0x75, 0x36, 0x85, 0xc9,
-  0x75, 0x06, 0x83, 0x7e, 0x0a, 0x00, 0x74, 0x5e, 0x8b, 0x7e, 0xfc, 0xd1,
-  0xe7, 0xd1, 0xe7, 0x8e, 0xc1, 0x03, 0x7e, 0x0a, 0x8b, 0x46, 0xf8, 0x26,
-  0x89, 0x05, 0x8b, 0x46, 0xfa, 0x26, 0x89, 0x45, 0x02, 0x8a, 0x07, 0xff,
-  0x46, 0xfc, 0x84, 0xc0, 0x74, 0x4e, 0x8e, 0x46, 0xfe, 0x43, 0x26, 0xc6,
-  0x04, 0x00, 0xeb, 0x82, 0x80, 0x3f, 0x20, 0x75, 0x2f, 0x84, 0xc0, 0x74,
-  0xc1, 0x80, 0x3f, 0x00, 0x74, 0xbc, 0x80, 0x3f, 0x5c, 0x75, 0x11, 0x85,
-  0xd2, 0x75, 0x24, 0x80, 0x7f, 0x01, 0x22, 0x75, 0x07, 0x43, 0x80, 0x7f,
-  0xfe, 0x5c, 0x74, 0x84, 0x85, 0xc9, 0x75, 0x2a, 0x83, 0x7e, 0x0a, 0x00,
-  0x75, 0x24, 0x43, 0xe9, 0x76, 0xff, 0xeb, 0x44, 0x80, 0x3f, 0x09, 0x74,
-  0xcc, 0xeb, 0xce, 0x80, 0x7f, 0x01, 0x22, 0x75, 0x05, 0x43, 0xeb, 0xe0,
-  0xeb, 0x14, 0x80, 0x7f, 0x01, 0x5c, 0x75, 0xd8, 0x3c, 0x01, 0x74, 0xf1,
-  0xeb, 0xd2, 0x8a, 0x27, 0x26, 0x88, 0x24, 0x46, 0xeb, 0xd4, 0x8e, 0x46,
-  0xfe, 0x26, 0x88, 0x04, 0xc4, 0x76, 0x0e, 0x26, 0x89, 0x1c, 0x89, 0xf3,
-  0x8b, 0x46, 0xfc, 0x26, 0x8c, 0x5f, 0x02, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0x5a, 0xc2, 0x08, 0x00, 0xff, 0x46, 0xfc, 0x80, 0x3f, 0x00, 0x74, 0xe0,
-  0xe9, 0x05, 0xff, 0x45, 0x55, 0x89, 0xe5, 0x52, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xd8, 0xa1, 0x8e, 0x15, 0x8b, 0x16, 0x8c, 0x15, 0x85, 0xc0, 0x75, 0x08,
-  0x85, 0xd2, 0x75, 0x04, 0x5a, 0x5d, 0x4d, 0xcb, 0x89, 0xd0, 0x8b, 0x16,
-  0x8e, 0x15, 0x0e, 0xe8, 0x72, 0xf4, 0x90, 0xeb, 0xef, 0x53, 0x51, 0x52,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc7, 0x85, 0xc0,
-  0x74, 0x49, 0x3d, 0xea, 0xff, 0x77, 0x44, 0x05, 0x03, 0x00, 0x24, 0xfe,
-  0x89, 0x46, 0xfc, 0x3d, 0x06, 0x00, 0x72, 0x42, 0xc6, 0x46, 0xfe, 0x00,
-  0x31, 0xd2, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x46, 0xfc, 0x3b, 0x06,
-  0x94, 0x10, 0x76, 0x3f, 0x8b, 0x36, 0x92, 0x10, 0x85, 0xf6, 0x74, 0x2d,
-  0x85, 0xf6, 0x75, 0x40, 0x80, 0x7e, 0xfe, 0x00, 0x74, 0x38, 0x89, 0xf8,
-  0x0e, 0xe8, 0xc8, 0x19, 0x90, 0x85, 0xc0, 0x74, 0x6b, 0xc6, 0x46, 0xfe,
-  0x00, 0xeb, 0xcf, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xcb, 0xc7, 0x46, 0xfc, 0x06, 0x00, 0xeb, 0xb7, 0x89, 0x36, 0x94,
-  0x10, 0x8b, 0x36, 0x90, 0x10, 0xeb, 0xc9, 0x31, 0xc0, 0x8b, 0x36, 0x90,
-  0x10, 0xa3, 0x94, 0x10, 0xeb, 0xbe, 0xeb, 0x3e, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xd8, 0x8b, 0x4c, 0x0a, 0x89, 0x36, 0x92, 0x10, 0x39, 0xf9, 0x72, 0x11,
-  0x89, 0xf3, 0x89, 0xc2, 0x89, 0xf8, 0x0e, 0xe8, 0x4a, 0x11, 0x90, 0x89,
-  0xc2, 0x85, 0xc0, 0x75, 0x32, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x3b, 0x0e,
-  0x94, 0x10, 0x77, 0x0a, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x74, 0x04,
-  0xeb, 0x86, 0x89, 0x0e, 0x94, 0x10, 0xeb, 0xf0, 0xeb, 0x15, 0x89, 0xf8,
-  0x0e, 0xe8, 0x52, 0x1a, 0x90, 0x85, 0xc0, 0x75, 0x03, 0xe9, 0x7a, 0xff,
-  0xc6, 0x46, 0xfe, 0x01, 0xe9, 0x53, 0xff, 0x89, 0xd0, 0xeb, 0x82, 0x51,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x06, 0x89, 0xc6, 0x89, 0x56,
-  0xfe, 0x89, 0x5e, 0xfc, 0x8e, 0xda, 0x83, 0x7c, 0x0a, 0x00, 0x75, 0x03,
-  0xe9, 0x86, 0x00, 0x31, 0xff, 0xf6, 0x44, 0x0b, 0x10, 0x74, 0x03, 0xe9,
-  0x80, 0x00, 0x8e, 0x5e, 0xfe, 0x8b, 0x44, 0x04, 0x85, 0xc0, 0x74, 0x18,
-  0xf7, 0xd8, 0x99, 0x89, 0xd1, 0x8b, 0x54, 0x0c, 0x89, 0xc3, 0x89, 0x56,
-  0xfa, 0xba, 0x01, 0x00, 0x8b, 0x46, 0xfa, 0x0e, 0x3e, 0xe8, 0xef, 0x15,
-  0x83, 0x7e, 0xfc, 0x00, 0x74, 0x0d, 0x8e, 0x5e, 0xfe, 0x8b, 0x44, 0x0c,
-  0x0e, 0xe8, 0xf7, 0x1a, 0x90, 0x09, 0xc7, 0x8e, 0x5e, 0xfe, 0xf6, 0x44,
-  0x0a, 0x08, 0x74, 0x1e, 0xc5, 0x5c, 0x06, 0x8b, 0x47, 0x08, 0x8b, 0x57,
-  0x0a, 0x0e, 0x3e, 0xe8, 0x22, 0xf3, 0x8e, 0x5e, 0xfe, 0xc5, 0x5c, 0x06,
-  0xc7, 0x47, 0x08, 0x00, 0x00, 0xc7, 0x47, 0x0a, 0x00, 0x00, 0x8e, 0x5e,
-  0xfe, 0xf6, 0x44, 0x0b, 0x08, 0x74, 0x0d, 0xbb, 0xe3, 0x0d, 0x89, 0xf0,
-  0x8c, 0xda, 0x8e, 0xdb, 0xff, 0x1e, 0x90, 0x15, 0x89, 0xf8, 0x89, 0xec,
-  0x5d, 0x5f, 0x5e, 0x59, 0xcb, 0xbf, 0xff, 0xff, 0xeb, 0xf2, 0x0e, 0xe8,
-  0x55, 0xf7, 0x90, 0x89, 0xc7, 0xe9, 0x76, 0xff, 0x51, 0x56, 0x89, 0xc1,
-  0x89, 0xd6, 0x0e, 0xe8, 0x45, 0xff, 0x89, 0xc3, 0x89, 0xf2, 0x89, 0xc8,
-  0x0e, 0xe8, 0x51, 0x00, 0x90, 0x89, 0xd8, 0x5e, 0x59, 0xcb, 0x53, 0x51,
-  0x56, 0x57, 0x89, 0xc1, 0x89, 0xd6, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b,
-  0x1e, 0x60, 0x14, 0x8b, 0x3e, 0x62, 0x14, 0x85, 0xff, 0x75, 0x04, 0x85,
-  0xdb, 0x74, 0x19, 0x8e, 0xdf, 0x8b, 0x47, 0x06, 0x8b, 0x57, 0x04, 0x39,
-  0xf0, 0x75, 0x04, 0x39, 0xca, 0x74, 0x11, 0x8b, 0x17, 0x8b, 0x7f, 0x02,
-  0x89, 0xd3, 0xeb, 0xdf, 0xb8, 0xff, 0xff, 0x5f, 0x5e, 0x59, 0x5b, 0xcb,
-  0xbb, 0x01, 0x00, 0x89, 0xc8, 0x89, 0xf2, 0x0e, 0xe8, 0x9d, 0xff, 0xeb,
-  0xee, 0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x89,
-  0xc7, 0x89, 0x56, 0xfe, 0xb8, 0xe3, 0x0d, 0xbe, 0x60, 0x14, 0x8e, 0xd8,
-  0x8b, 0x4c, 0x02, 0x8b, 0x1c, 0x85, 0xc9, 0x75, 0x04, 0x85, 0xdb, 0x74,
-  0x4f, 0x8e, 0xc1, 0x26, 0x8b, 0x57, 0x06, 0x26, 0x8b, 0x47, 0x04, 0x3b,
-  0x56, 0xfe, 0x75, 0x04, 0x39, 0xf8, 0x74, 0x06, 0x89, 0xde, 0x8e, 0xd9,
-  0xeb, 0xda, 0x8e, 0x46, 0xfe, 0x26, 0x80, 0x4d, 0x0a, 0x03, 0x8e, 0xc1,
-  0x26, 0x8b, 0x47, 0x02, 0x26, 0x8b, 0x17, 0x89, 0x44, 0x02, 0xb8, 0xe3,
-  0x0d, 0x89, 0x14, 0x8e, 0xd8, 0xa1, 0x64, 0x14, 0x8b, 0x16, 0x66, 0x14,
-  0x8e, 0xd9, 0x89, 0x07, 0xb8, 0xe3, 0x0d, 0x89, 0x57, 0x02, 0x8e, 0xd8,
-  0x89, 0x1e, 0x64, 0x14, 0x89, 0x0e, 0x66, 0x14, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0x59, 0x5b, 0xcb, 0x53, 0x51, 0x52, 0x56, 0xbb, 0xe3, 0x0d, 0x8e,
-  0xdb, 0x8b, 0x1e, 0x66, 0x14, 0x8b, 0x0e, 0x64, 0x14, 0x85, 0xdb, 0x75,
-  0x09, 0x85, 0xc9, 0x75, 0x05, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0x89, 0xcb,
-  0x8e, 0x1e, 0x66, 0x14, 0x89, 0xd8, 0x8c, 0xda, 0x8b, 0x37, 0x8b, 0x4f,
-  0x02, 0xbb, 0xe3, 0x0d, 0x0e, 0xe8, 0xd0, 0xf1, 0x90, 0x8e, 0xdb, 0x89,
-  0x36, 0x64, 0x14, 0x89, 0x0e, 0x66, 0x14, 0xeb, 0xc3, 0x52, 0x56, 0x57,
-  0x55, 0x89, 0xe5, 0x50, 0x8e, 0xd9, 0xc5, 0x77, 0x06, 0x8b, 0x44, 0x0c,
-  0x3d, 0x01, 0x00, 0x74, 0x0c, 0x85, 0xc0, 0x74, 0x03, 0xe9, 0x91, 0x00,
-  0xc7, 0x44, 0x0c, 0x01, 0x00, 0x8e, 0xd9, 0xf6, 0x47, 0x0a, 0x02, 0x75,
-  0x03, 0xe9, 0x8b, 0x00, 0xc5, 0x77, 0x06, 0x8b, 0x44, 0x08, 0x8b, 0x74,
-  0x0a, 0x85, 0xf6, 0x75, 0x0d, 0x85, 0xc0, 0x75, 0x09, 0x89, 0xd8, 0x89,
-  0xca, 0x0e, 0x3e, 0xe8, 0x8b, 0x00, 0xbe, 0x00, 0x04, 0x83, 0x7e, 0xfe,
-  0x0a, 0x75, 0x30, 0x8e, 0xd9, 0xbe, 0x00, 0x06, 0xf6, 0x47, 0x0a, 0x40,
-  0x75, 0x25, 0x80, 0x4f, 0x0b, 0x10, 0xc5, 0x3f, 0xc6, 0x05, 0x0d, 0x8e,
-  0xd9, 0xff, 0x07, 0xff, 0x47, 0x04, 0x8b, 0x47, 0x04, 0x3b, 0x47, 0x0e,
-  0x75, 0x0d, 0x89, 0xd8, 0x89, 0xca, 0x0e, 0xe8, 0xb5, 0xf5, 0x90, 0x85,
-  0xc0, 0x75, 0x2e, 0x8e, 0xd9, 0x80, 0x4f, 0x0b, 0x10, 0xc5, 0x3f, 0x8a,
-  0x46, 0xfe, 0x88, 0x05, 0x8e, 0xd9, 0xff, 0x07, 0xff, 0x47, 0x04, 0x85,
-  0x77, 0x0a, 0x75, 0x08, 0x8b, 0x47, 0x04, 0x3b, 0x47, 0x0e, 0x75, 0x2a,
-  0x89, 0xd8, 0x89, 0xca, 0x0e, 0xe8, 0x87, 0xf5, 0x90, 0x85, 0xc0, 0x74,
-  0x1d, 0xb8, 0xff, 0xff, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0xcb, 0xb8,
-  0x04, 0x00, 0x0e, 0xe8, 0x8b, 0xf8, 0x90, 0x8e, 0xd9, 0xb8, 0xff, 0xff,
-  0x80, 0x4f, 0x0a, 0x20, 0xeb, 0xe6, 0x8a, 0x46, 0xfe, 0x30, 0xe4, 0xeb,
-  0xdf, 0x53, 0x51, 0x56, 0x89, 0xc3, 0x89, 0xd1, 0x0e, 0xe8, 0xd6, 0x18,
-  0x90, 0x8e, 0xd9, 0x83, 0x7f, 0x0e, 0x00, 0x75, 0x0c, 0x8a, 0x47, 0x0b,
-  0xa8, 0x02, 0x74, 0x65, 0xc7, 0x47, 0x0e, 0x86, 0x00, 0x8e, 0xd9, 0x8b,
-  0x47, 0x0e, 0x0e, 0xe8, 0x10, 0xf1, 0x90, 0x8e, 0xd9, 0xc5, 0x77, 0x06,
-  0x89, 0x44, 0x08, 0x89, 0x54, 0x0a, 0x8e, 0xd9, 0xc5, 0x77, 0x06, 0x8b,
-  0x44, 0x0a, 0x8b, 0x54, 0x08, 0x85, 0xc0, 0x75, 0x4e, 0x85, 0xd2, 0x75,
-  0x4a, 0x8e, 0xd9, 0x80, 0x67, 0x0b, 0xf8, 0x80, 0x4f, 0x0b, 0x04, 0xc5,
-  0x77, 0x06, 0x8d, 0x47, 0x10, 0x89, 0x4c, 0x0a, 0x89, 0x44, 0x08, 0x8e,
-  0xd9, 0xc7, 0x47, 0x0e, 0x01, 0x00, 0x8e, 0xd9, 0xc5, 0x77, 0x06, 0x8b,
-  0x44, 0x08, 0x8b, 0x54, 0x0a, 0x8e, 0xd9, 0xc7, 0x47, 0x04, 0x00, 0x00,
-  0x89, 0x07, 0x89, 0x57, 0x02, 0x5e, 0x59, 0x5b, 0xcb, 0xa8, 0x04, 0x74,
-  0x07, 0xc7, 0x47, 0x0e, 0x40, 0x00, 0xeb, 0x95, 0xc7, 0x47, 0x0e, 0x00,
-  0x02, 0xeb, 0x8e, 0x8e, 0xd9, 0x80, 0x4f, 0x0a, 0x08, 0xeb, 0xcb, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x78, 0x8b, 0x76, 0x0a, 0xc6, 0x46,
-  0xfe, 0x00, 0xc7, 0x46, 0xd4, 0x00, 0x00, 0xc7, 0x46, 0xd6, 0xc8, 0x00,
-  0xc7, 0x46, 0xdc, 0x00, 0x00, 0x89, 0x46, 0xd0, 0x89, 0x56, 0xd2, 0x89,
-  0x5e, 0xf8, 0x89, 0x4e, 0xfa, 0xc5, 0x5e, 0xf8, 0x8a, 0x07, 0x84, 0xc0,
-  0x74, 0x18, 0x8d, 0x57, 0x01, 0x3c, 0x25, 0x74, 0x14, 0x88, 0xc3, 0x89,
-  0x56, 0xf8, 0x8d, 0x46, 0xd0, 0x8c, 0xd2, 0x30, 0xff, 0xff, 0x5e, 0x0e,
-  0xeb, 0xdf, 0xe9, 0x2d, 0x02, 0x8e, 0x5e, 0x0c, 0x8d, 0x5e, 0xd0, 0x16,
-  0x8b, 0x04, 0x8c, 0xd1, 0x89, 0x46, 0xf2, 0x53, 0x8b, 0x44, 0x02, 0x8d,
-  0x5e, 0xf2, 0x89, 0x46, 0xf4, 0x89, 0xd0, 0x8b, 0x56, 0xfa, 0xe8, 0x18,
-  0x02, 0x8e, 0x46, 0x0c, 0x89, 0xc3, 0x8b, 0x46, 0xf2, 0x8e, 0xda, 0x26,
-  0x89, 0x04, 0x8b, 0x46, 0xf4, 0x26, 0x89, 0x44, 0x02, 0x89, 0x56, 0xfa,
-  0x8a, 0x07, 0x43, 0x88, 0x46, 0xea, 0x89, 0x5e, 0xf8, 0x84, 0xc0, 0x74,
-  0xb9, 0x3c, 0x6e, 0x75, 0x54, 0x8a, 0x46, 0xd5, 0xa8, 0x04, 0x74, 0x1a,
-  0x8e, 0x5e, 0x0c, 0x83, 0x04, 0x04, 0xc5, 0x3c, 0xc5, 0x5d, 0xfc, 0x8a,
-  0x46, 0xd4, 0xa8, 0x10, 0x74, 0x1f, 0x8a, 0x46, 0xdc, 0x88, 0x07, 0xe9,
-  0x73, 0xff, 0xa8, 0x02, 0x74, 0xe2, 0x8e, 0x5e, 0x0c, 0x83, 0x04, 0x02,
-  0xb8, 0xe3, 0x0d, 0xc4, 0x1c, 0x8e, 0xd8, 0x26, 0x8b, 0x5f, 0xfe, 0xeb,
-  0xda, 0xa8, 0x20, 0x74, 0x08, 0x8b, 0x46, 0xdc, 0x89, 0x07, 0xe9, 0x50,
-  0xff, 0xa8, 0x40, 0x74, 0x0e, 0x8b, 0x46, 0xdc, 0x99, 0x89, 0x07, 0x89,
-  0x57, 0x02, 0xe9, 0x40, 0xff, 0xeb, 0x1a, 0xa8, 0x80, 0x74, 0xe2, 0x8b,
-  0x46, 0xdc, 0x99, 0x89, 0x07, 0xb1, 0x0f, 0x89, 0x57, 0x02, 0xd3, 0xfa,
-  0x89, 0x57, 0x04, 0x89, 0x57, 0x06, 0xe9, 0x24, 0xff, 0x8e, 0x5e, 0x0c,
-  0x8d, 0x56, 0xfe, 0x8d, 0x5e, 0xee, 0x16, 0x8c, 0xd1, 0x52, 0x8b, 0x04,
-  0x8d, 0x56, 0xd0, 0x89, 0x46, 0xee, 0x16, 0x8b, 0x44, 0x02, 0x52, 0x89,
-  0x46, 0xf0, 0x8c, 0xd2, 0x8d, 0x46, 0x88, 0xe8, 0x08, 0x06, 0x8e, 0x5e,
-  0x0c, 0x89, 0x46, 0xfc, 0x8b, 0x46, 0xee, 0x89, 0x04, 0x8b, 0x46, 0xf0,
-  0x89, 0x44, 0x02, 0x8b, 0x46, 0xde, 0x03, 0x46, 0xe0, 0x03, 0x46, 0xe2,
-  0x03, 0x46, 0xe4, 0x03, 0x46, 0xe6, 0x03, 0x46, 0xe8, 0x89, 0x56, 0xf6,
-  0x29, 0x46, 0xd8, 0xf6, 0x46, 0xd4, 0x08, 0x74, 0x1f, 0x8d, 0x7e, 0x88,
-  0x8c, 0xd1, 0x83, 0x7e, 0xde, 0x00, 0x7e, 0x30, 0x8e, 0xd9, 0x8d, 0x46,
-  0xd0, 0x8a, 0x1d, 0x8c, 0xd2, 0x30, 0xff, 0xff, 0x5e, 0x0e, 0x47, 0xff,
-  0x4e, 0xde, 0xeb, 0xe6, 0x80, 0x7e, 0xeb, 0x20, 0x75, 0xdb, 0x83, 0x7e,
-  0xd8, 0x00, 0x7e, 0xd5, 0xbb, 0x20, 0x00, 0x8d, 0x46, 0xd0, 0x8c, 0xd2,
-  0xff, 0x5e, 0x0e, 0xff, 0x4e, 0xd8, 0xeb, 0xea, 0x83, 0x7e, 0xe0, 0x00,
-  0x7e, 0x10, 0xbb, 0x30, 0x00, 0x8d, 0x46, 0xd0, 0x8c, 0xd2, 0xff, 0x5e,
-  0x0e, 0xff, 0x4e, 0xe0, 0xeb, 0xea, 0x8a, 0x46, 0xea, 0x3c, 0x73, 0x75,
-  0x50, 0xf6, 0x46, 0xd4, 0x40, 0x75, 0x20, 0x83, 0x7e, 0xe2, 0x00, 0x7e,
-  0x2e, 0x8e, 0x5e, 0xf6, 0x8b, 0x5e, 0xfc, 0x8d, 0x46, 0xd0, 0x8a, 0x1f,
-  0x8c, 0xd2, 0x30, 0xff, 0xff, 0x46, 0xfc, 0xff, 0x5e, 0x0e, 0xff, 0x4e,
-  0xe2, 0xeb, 0xe0, 0xff, 0x76, 0x10, 0x8d, 0x5e, 0xd0, 0x8b, 0x46, 0xfc,
-  0x8b, 0x56, 0xf6, 0xff, 0x76, 0x0e, 0x8c, 0xd1, 0xe8, 0xdb, 0x04, 0x83,
-  0x7e, 0xe4, 0x00, 0x7e, 0x34, 0xbb, 0x30, 0x00, 0x8d, 0x46, 0xd0, 0x8c,
-  0xd2, 0xff, 0x5e, 0x0e, 0xff, 0x4e, 0xe4, 0xeb, 0xea, 0x3c, 0x53, 0x74,
-  0xd2, 0x83, 0x7e, 0xe2, 0x00, 0x7e, 0xe0, 0x8e, 0x5e, 0xf6, 0x8b, 0x5e,
-  0xfc, 0x8d, 0x46, 0xd0, 0x8a, 0x1f, 0x8c, 0xd2, 0x30, 0xff, 0xff, 0x46,
-  0xfc, 0xff, 0x5e, 0x0e, 0xff, 0x4e, 0xe2, 0xeb, 0xe0, 0x83, 0x7e, 0xe6,
-  0x00, 0x7e, 0x1a, 0x8e, 0x5e, 0xf6, 0x8b, 0x5e, 0xfc, 0x8d, 0x46, 0xd0,
-  0x8a, 0x1f, 0x8c, 0xd2, 0x30, 0xff, 0xff, 0x46, 0xfc, 0xff, 0x5e, 0x0e,
-  0xff, 0x4e, 0xe6, 0xeb, 0xe0, 0x83, 0x7e, 0xe8, 0x00, 0x7e, 0x10, 0xbb,
-  0x30, 0x00, 0x8d, 0x46, 0xd0, 0x8c, 0xd2, 0xff, 0x5e, 0x0e, 0xff, 0x4e,
-  0xe8, 0xeb, 0xea, 0xf6, 0x46, 0xd4, 0x08, 0x75, 0x03, 0xe9, 0xc5, 0xfd,
-  0x83, 0x7e, 0xd8, 0x00, 0x7e, 0xf7, 0xbb, 0x20, 0x00, 0x8d, 0x46, 0xd0,
-  0x8c, 0xd2, 0xff, 0x5e, 0x0e, 0xff, 0x4e, 0xd8, 0xeb, 0xea, 0x8b, 0x46,
-  0xdc, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xca, 0x08, 0x00, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x8b, 0x7e, 0x08, 0x89, 0xc6, 0x8e, 0xda,
-  0x89, 0x5e, 0xfc, 0x89, 0x4e, 0xfe, 0x8e, 0x46, 0x0a, 0x89, 0xfb, 0x8c,
-  0xc1, 0x26, 0xc6, 0x45, 0x1b, 0x20, 0xe8, 0x8a, 0x01, 0x8e, 0x46, 0x0a,
-  0x89, 0xc3, 0x8e, 0xda, 0x26, 0xc7, 0x45, 0x08, 0x00, 0x00, 0x89, 0xc6,
-  0x80, 0x3f, 0x2a, 0x74, 0x28, 0x8e, 0x46, 0x0a, 0x8a, 0x04, 0x3c, 0x30,
-  0x72, 0x3b, 0x3c, 0x39, 0x77, 0x37, 0xba, 0x0a, 0x00, 0x26, 0x8b, 0x45,
-  0x08, 0xf7, 0xea, 0x89, 0xc2, 0x8a, 0x04, 0x30, 0xe4, 0x2d, 0x30, 0x00,
-  0x01, 0xc2, 0x46, 0x26, 0x89, 0x55, 0x08, 0xeb, 0xdb, 0xc4, 0x5e, 0xfc,
-  0x26, 0x83, 0x07, 0x02, 0x26, 0xc4, 0x07, 0x89, 0xc3, 0x26, 0x8b, 0x47,
-  0xfe, 0x8e, 0x46, 0x0a, 0x26, 0x89, 0x45, 0x08, 0x85, 0xc0, 0x7c, 0x43,
-  0x46, 0x8e, 0x46, 0x0a, 0x26, 0xc7, 0x45, 0x0a, 0xff, 0xff, 0x80, 0x3c,
-  0x2e, 0x75, 0x5b, 0x46, 0x26, 0xc7, 0x45, 0x0a, 0x00, 0x00, 0x80, 0x3c,
-  0x2a, 0x74, 0x33, 0x8e, 0x46, 0x0a, 0x8a, 0x04, 0x3c, 0x30, 0x72, 0x46,
-  0x3c, 0x39, 0x77, 0x42, 0xba, 0x0a, 0x00, 0x26, 0x8b, 0x45, 0x0a, 0xf7,
-  0xea, 0x89, 0xc2, 0x8a, 0x04, 0x30, 0xe4, 0x2d, 0x30, 0x00, 0x01, 0xc2,
-  0x46, 0x26, 0x89, 0x55, 0x0a, 0xeb, 0xdb, 0x26, 0xf7, 0x5d, 0x08, 0x26,
-  0x80, 0x4d, 0x04, 0x08, 0xeb, 0xb2, 0xc4, 0x5e, 0xfc, 0x26, 0x83, 0x07,
-  0x02, 0x26, 0xc4, 0x07, 0x89, 0xc3, 0x26, 0x8b, 0x47, 0xfe, 0x8e, 0x46,
-  0x0a, 0x26, 0x89, 0x45, 0x0a, 0x85, 0xc0, 0x7c, 0x21, 0x46, 0x8a, 0x04,
-  0x8d, 0x54, 0x01, 0x3c, 0x68, 0x73, 0x1f, 0x3c, 0x4c, 0x73, 0x55, 0x3c,
-  0x49, 0x75, 0x53, 0x80, 0x7c, 0x01, 0x36, 0x75, 0x3f, 0x80, 0x7c, 0x02,
-  0x34, 0x75, 0x39, 0xe9, 0x9e, 0x00, 0x26, 0xc7, 0x45, 0x0a, 0xff, 0xff,
-  0xeb, 0xd7, 0x8d, 0x5c, 0x02, 0x77, 0x12, 0x80, 0x7c, 0x01, 0x68, 0x75,
-  0x58, 0x8e, 0x46, 0x0a, 0x89, 0xde, 0x26, 0x80, 0x4d, 0x04, 0x10, 0xeb,
-  0x17, 0x3c, 0x74, 0x73, 0x23, 0x3c, 0x6c, 0x75, 0x34, 0x3a, 0x44, 0x01,
-  0x75, 0x24, 0x8e, 0x46, 0x0a, 0x89, 0xde, 0x26, 0x80, 0x4d, 0x04, 0x80,
-  0x89, 0xf0, 0x8c, 0xda, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc2, 0x04, 0x00,
-  0xeb, 0x29, 0xeb, 0x3d, 0x76, 0x5e, 0x3c, 0x7a, 0x74, 0x5a, 0x3c, 0x77,
-  0x75, 0xe6, 0x8e, 0x46, 0x0a, 0x46, 0x26, 0x80, 0x4d, 0x04, 0x40, 0xeb,
-  0xdb, 0x3c, 0x6a, 0x75, 0xd7, 0x8e, 0x46, 0x0a, 0x46, 0x26, 0x81, 0x4d,
-  0x04, 0x80, 0x01, 0xeb, 0xcb, 0xeb, 0x25, 0x76, 0xf0, 0x3c, 0x57, 0x74,
-  0x14, 0x3c, 0x4e, 0x75, 0xbf, 0x8e, 0x46, 0x0a, 0x89, 0xd6, 0x26, 0x80,
-  0x4d, 0x05, 0x02, 0xeb, 0xb3, 0x3c, 0x46, 0x75, 0xaf, 0x8e, 0x46, 0x0a,
-  0x46, 0x26, 0x80, 0x4d, 0x05, 0x04, 0xeb, 0xa4, 0x8e, 0x46, 0x0a, 0x89,
-  0xd6, 0x26, 0x80, 0x4d, 0x04, 0x20, 0xeb, 0x98, 0x8e, 0x46, 0x0a, 0x83,
-  0xc6, 0x03, 0xeb, 0x8b, 0x46, 0xeb, 0x8d, 0x56, 0x89, 0xc6, 0x8e, 0xc2,
-  0x8e, 0xd9, 0xc7, 0x47, 0x04, 0x00, 0x00, 0x26, 0x8a, 0x04, 0x3c, 0x2d,
-  0x74, 0x0b, 0x3c, 0x23, 0x75, 0x0d, 0x80, 0x4f, 0x04, 0x01, 0x46, 0xeb,
-  0xee, 0x80, 0x4f, 0x04, 0x08, 0xeb, 0xf7, 0x3c, 0x2b, 0x75, 0x0a, 0x80,
-  0x4f, 0x04, 0x04, 0x80, 0x67, 0x04, 0xfd, 0xeb, 0xe9, 0x3c, 0x20, 0x75,
-  0x0c, 0xf6, 0x47, 0x04, 0x04, 0x75, 0xdf, 0x80, 0x4f, 0x04, 0x02, 0xeb,
-  0xd9, 0x3c, 0x30, 0x75, 0x05, 0x88, 0x47, 0x1b, 0xeb, 0xd0, 0x89, 0xf0,
-  0x8c, 0xc2, 0x5e, 0xc3, 0x56, 0x57, 0x89, 0xc6, 0x89, 0xd7, 0x89, 0xda,
-  0x8e, 0xdf, 0x31, 0xc0, 0x39, 0xd0, 0x74, 0x0b, 0x89, 0xf3, 0x46, 0x80,
-  0x3f, 0x00, 0x74, 0x03, 0x40, 0xeb, 0xf1, 0x5f, 0x5e, 0xc3, 0x51, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xdf, 0x89, 0xc6, 0x89,
-  0x56, 0xfe, 0x31, 0xc9, 0x83, 0xfb, 0xff, 0x75, 0x2a, 0x8e, 0x5e, 0xfe,
-  0x8b, 0x04, 0x85, 0xc0, 0x74, 0x18, 0x89, 0xc3, 0x8c, 0xd2, 0x8d, 0x46,
-  0xfc, 0x83, 0xc6, 0x02, 0x0e, 0xe8, 0xa1, 0x13, 0x90, 0x3d, 0xff, 0xff,
-  0x74, 0xe3, 0x01, 0xc1, 0xeb, 0xdf, 0x89, 0xc8, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0x59, 0xc3, 0x8e, 0x5e, 0xfe, 0x8b, 0x04, 0x85, 0xc0, 0x74, 0x1c,
-  0x39, 0xf9, 0x7f, 0x18, 0x89, 0xc3, 0x8c, 0xd2, 0x8d, 0x46, 0xfc, 0x83,
-  0xc6, 0x02, 0x0e, 0xe8, 0x73, 0x13, 0x90, 0x3d, 0xff, 0xff, 0x74, 0xdf,
-  0x01, 0xc1, 0xeb, 0xdb, 0x39, 0xf9, 0x7e, 0xce, 0x89, 0xf8, 0xeb, 0xcc,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0xba, 0x10, 0x00, 0x8b,
-  0x7e, 0xfe, 0x8b, 0x76, 0xfe, 0x0e, 0x3e, 0xe8, 0xd1, 0x13, 0x8e, 0x46,
-  0xfc, 0x8b, 0x5e, 0xfe, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7,
-  0xd1, 0x49, 0xc5, 0x46, 0xfa, 0x89, 0xca, 0x48, 0x01, 0xce, 0x01, 0xc3,
-  0x85, 0xd2, 0x75, 0x17, 0x8b, 0x5e, 0xfe, 0x8e, 0x5e, 0xfc, 0x01, 0xc3,
-  0x85, 0xc0, 0x7c, 0x1e, 0x05, 0xff, 0xff, 0xc6, 0x07, 0x30, 0x83, 0xc3,
-  0xff, 0xeb, 0xf1, 0x83, 0xc6, 0xff, 0x83, 0xc2, 0xff, 0x8a, 0x0c, 0x05,
-  0xff, 0xff, 0x26, 0x88, 0x0f, 0x83, 0xc3, 0xff, 0xeb, 0xd2, 0x8b, 0x5e,
-  0xfe, 0x8e, 0x5e, 0xfc, 0x03, 0x5e, 0xfa, 0xc6, 0x07, 0x00, 0x89, 0xec,
-  0x5d, 0x5f, 0x5e, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x0a,
-  0x89, 0xc6, 0x89, 0x56, 0xfa, 0x89, 0x5e, 0xf6, 0x89, 0x4e, 0xf8, 0x85,
-  0xc9, 0x7c, 0x36, 0xc5, 0x5e, 0x08, 0x83, 0x7f, 0x0a, 0xff, 0x75, 0x05,
-  0xc7, 0x47, 0x0a, 0x04, 0x00, 0xba, 0x0a, 0x00, 0x8b, 0x4e, 0xfa, 0x8b,
-  0x46, 0xf8, 0x89, 0xf3, 0x0e, 0xe8, 0x43, 0x13, 0x90, 0x89, 0x76, 0xfc,
-  0x8b, 0x46, 0xfa, 0x8e, 0x5e, 0xfa, 0x89, 0x46, 0xfe, 0x8d, 0x44, 0x01,
-  0x80, 0x3c, 0x00, 0x74, 0x16, 0x89, 0xc6, 0xeb, 0xf4, 0x8e, 0xda, 0xf7,
-  0x5e, 0xf8, 0xc6, 0x04, 0x2d, 0xf7, 0x5e, 0xf6, 0x83, 0x5e, 0xf8, 0x00,
-  0x46, 0xeb, 0xb8, 0xc5, 0x5e, 0x08, 0x83, 0x7f, 0x0a, 0x00, 0x74, 0x40,
-  0x8e, 0x5e, 0xfa, 0x31, 0xff, 0xc6, 0x04, 0x2e, 0x89, 0xc6, 0xc5, 0x5e,
-  0x08, 0x3b, 0x7f, 0x0a, 0x7d, 0x28, 0x8b, 0x46, 0xf6, 0xbb, 0x0a, 0x00,
-  0x31, 0xd2, 0x31, 0xc9, 0xc7, 0x46, 0xf8, 0x00, 0x00, 0x0e, 0x3e, 0xe8,
-  0x50, 0xe5, 0x89, 0x56, 0xf8, 0x89, 0x46, 0xf6, 0x8a, 0x46, 0xf8, 0x8e,
-  0x5e, 0xfa, 0x04, 0x30, 0x47, 0x88, 0x04, 0x46, 0xeb, 0xd0, 0x8e, 0x5e,
-  0xfa, 0xc6, 0x04, 0x00, 0xf6, 0x46, 0xf7, 0x80, 0x75, 0x03, 0xe9, 0x93,
-  0xfd, 0x8b, 0x46, 0xfa, 0x3b, 0x46, 0xfe, 0x75, 0x05, 0x3b, 0x76, 0xfc,
-  0x74, 0x1a, 0x83, 0xc6, 0xff, 0x8e, 0xd8, 0x80, 0x3c, 0x2e, 0x75, 0x03,
-  0x83, 0xc6, 0xff, 0x8e, 0x5e, 0xfa, 0x80, 0x3c, 0x39, 0x75, 0x3f, 0xc6,
-  0x04, 0x30, 0xeb, 0xdc, 0x8e, 0xd8, 0xc6, 0x04, 0x31, 0x8e, 0x5e, 0xfa,
-  0x46, 0x8a, 0x04, 0x8d, 0x7c, 0x01, 0x3c, 0x30, 0x75, 0x04, 0x89, 0xfe,
-  0xeb, 0xf3, 0x3c, 0x2e, 0x75, 0x13, 0xc6, 0x04, 0x30, 0x8d, 0x75, 0x01,
-  0x88, 0x05, 0x8e, 0x5e, 0xfa, 0x80, 0x3c, 0x30, 0x75, 0x03, 0x46, 0xeb,
-  0xf8, 0x8e, 0x5e, 0xfa, 0xc6, 0x04, 0x30, 0x46, 0xc6, 0x04, 0x00, 0xe9,
-  0x32, 0xfd, 0xfe, 0x04, 0xe9, 0x2d, 0xfd, 0x53, 0x89, 0xc3, 0x8e, 0xda,
-  0xf6, 0x47, 0x04, 0x08, 0x75, 0x22, 0x80, 0x7f, 0x1b, 0x30, 0x75, 0x1c,
-  0x8b, 0x47, 0x08, 0x2b, 0x47, 0x0e, 0x2b, 0x47, 0x10, 0x2b, 0x47, 0x12,
-  0x2b, 0x47, 0x14, 0x2b, 0x47, 0x16, 0x2b, 0x47, 0x18, 0x85, 0xc0, 0x7e,
-  0x03, 0x01, 0x47, 0x10, 0x5b, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83,
-  0xec, 0x06, 0x50, 0x52, 0x89, 0xde, 0x89, 0x4e, 0xfe, 0x8e, 0x5e, 0xfe,
-  0x83, 0x7c, 0x12, 0x00, 0x7f, 0x03, 0xe9, 0xe3, 0xfc, 0x8e, 0x5e, 0xf6,
-  0x8b, 0x5e, 0xf8, 0x8d, 0x46, 0xfa, 0x8c, 0xd2, 0x8b, 0x1f, 0x83, 0x46,
-  0xf8, 0x02, 0x0e, 0xe8, 0x7b, 0x11, 0x90, 0x89, 0xc1, 0x3d, 0xff, 0xff,
-  0x74, 0xd7, 0x8e, 0x5e, 0xfe, 0x3b, 0x44, 0x12, 0x7f, 0x24, 0x8d, 0x7e,
-  0xfa, 0x8c, 0x56, 0xfc, 0x49, 0x83, 0xf9, 0xff, 0x74, 0xc3, 0x8e, 0x5e,
-  0xfc, 0x8b, 0x56, 0xfe, 0x8a, 0x1d, 0x89, 0xf0, 0x30, 0xff, 0xff, 0x5e,
-  0x08, 0x8e, 0x5e, 0xfe, 0x47, 0xff, 0x4c, 0x12, 0xeb, 0xe2, 0xc7, 0x44,
-  0x12, 0x00, 0x00, 0xe9, 0x92, 0xfc, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83,
-  0xec, 0x18, 0x8b, 0x76, 0x08, 0x89, 0x46, 0xfc, 0x89, 0x56, 0xfe, 0x8e,
-  0xd9, 0x8e, 0x46, 0x0a, 0x26, 0xc7, 0x44, 0x18, 0x00, 0x00, 0x89, 0x46,
-  0xf4, 0x26, 0x8b, 0x44, 0x18, 0x26, 0x89, 0x44, 0x16, 0x26, 0x89, 0x44,
-  0x14, 0x26, 0x89, 0x44, 0x12, 0x26, 0x89, 0x44, 0x10, 0x26, 0x89, 0x44,
-  0x0e, 0x26, 0x8a, 0x44, 0x1a, 0x89, 0x56, 0xf6, 0x3c, 0x62, 0x75, 0x2e,
-  0x8e, 0x46, 0x0a, 0x26, 0x8a, 0x44, 0x04, 0xa8, 0x80, 0x74, 0x6c, 0x83,
-  0x07, 0x08, 0xc4, 0x3f, 0x26, 0x8b, 0x45, 0xfe, 0x89, 0x46, 0xf2, 0x26,
-  0x8b, 0x45, 0xfc, 0x89, 0x46, 0xf0, 0x26, 0x8b, 0x45, 0xfa, 0x89, 0x46,
-  0xee, 0x26, 0x8b, 0x45, 0xf8, 0x89, 0x46, 0xec, 0xeb, 0x60, 0x3c, 0x6f,
-  0x74, 0xce, 0x3c, 0x75, 0x74, 0xca, 0x3c, 0x78, 0x74, 0xc6, 0x3c, 0x58,
-  0x74, 0xc2, 0x3c, 0x64, 0x75, 0x2f, 0x8e, 0x46, 0x0a, 0x26, 0x8a, 0x44,
-  0x04, 0xa8, 0x80, 0x74, 0x27, 0x83, 0x07, 0x08, 0xc4, 0x3f, 0x26, 0x8b,
-  0x45, 0xfe, 0x89, 0x46, 0xf2, 0x26, 0x8b, 0x45, 0xfc, 0x89, 0x46, 0xf0,
-  0x26, 0x8b, 0x45, 0xfa, 0x89, 0x46, 0xee, 0x26, 0x8b, 0x45, 0xf8, 0x89,
-  0x46, 0xec, 0xe9, 0x01, 0x01, 0xe9, 0x87, 0x00, 0xe9, 0xb7, 0x00, 0xa8,
-  0x40, 0x74, 0x4b, 0x83, 0x07, 0x04, 0xc4, 0x3f, 0x26, 0x8b, 0x45, 0xfc,
-  0x89, 0x46, 0xf8, 0x26, 0x8b, 0x45, 0xfe, 0x89, 0x46, 0xfa, 0x8e, 0x46,
-  0x0a, 0x26, 0x8a, 0x44, 0x1a, 0xbf, 0x0a, 0x00, 0x3c, 0x64, 0x73, 0x66,
-  0x3c, 0x50, 0x73, 0x65, 0x3c, 0x45, 0x73, 0x64, 0x3c, 0x43, 0x74, 0x63,
-  0x8e, 0x5e, 0x0a, 0xc7, 0x44, 0x08, 0x00, 0x00, 0x8b, 0x5e, 0xfc, 0x8a,
-  0x44, 0x1a, 0x8e, 0x5e, 0xfe, 0x88, 0x07, 0x8e, 0x5e, 0x0a, 0xc7, 0x44,
-  0x0e, 0x01, 0x00, 0xe9, 0x19, 0x02, 0x83, 0x07, 0x02, 0xc4, 0x3f, 0xc7,
-  0x46, 0xfa, 0x00, 0x00, 0x26, 0x8b, 0x45, 0xfe, 0x8e, 0x46, 0x0a, 0x89,
-  0x46, 0xf8, 0x26, 0xf6, 0x44, 0x04, 0x20, 0x74, 0x07, 0xc7, 0x46, 0xfa,
-  0x00, 0x00, 0xeb, 0xa6, 0x26, 0xf6, 0x44, 0x04, 0x10, 0x74, 0x9f, 0x8a,
-  0x46, 0xf8, 0x30, 0xe4, 0x89, 0x46, 0xf8, 0x30, 0xc0, 0xeb, 0x90, 0x3c,
-  0x69, 0x75, 0x8f, 0xe9, 0x40, 0xff, 0xe9, 0x3e, 0x01, 0xe9, 0xb7, 0x03,
-  0xe9, 0xfa, 0x03, 0x83, 0x07, 0x02, 0x8b, 0x46, 0xfc, 0xc5, 0x3f, 0x8b,
-  0x56, 0xfe, 0x8b, 0x5d, 0xfe, 0x0e, 0x3e, 0xe8, 0xdf, 0x0f, 0x3d, 0xff,
-  0xff, 0x75, 0x24, 0x8e, 0x5e, 0x0a, 0xc7, 0x44, 0x12, 0x00, 0x00, 0xe9,
-  0xb1, 0x01, 0xa8, 0x40, 0x74, 0x18, 0x83, 0x07, 0x04, 0xc4, 0x3f, 0x26,
-  0x8b, 0x45, 0xfc, 0x89, 0x46, 0xf8, 0x26, 0x8b, 0x45, 0xfe, 0x89, 0x46,
-  0xfa, 0xeb, 0x2b, 0xe9, 0x8f, 0x01, 0x83, 0x07, 0x02, 0xc4, 0x3f, 0x26,
-  0x8b, 0x45, 0xfe, 0x99, 0x8e, 0x46, 0x0a, 0x89, 0x46, 0xf8, 0x26, 0x8a,
-  0x44, 0x04, 0x89, 0x56, 0xfa, 0xa8, 0x20, 0x75, 0x03, 0xe9, 0x76, 0x00,
-  0x8b, 0x46, 0xf8, 0x99, 0x89, 0x46, 0xf8, 0x89, 0x56, 0xfa, 0x8e, 0x46,
-  0x0a, 0x31, 0xc0, 0x26, 0xf6, 0x44, 0x04, 0x80, 0x74, 0x6a, 0x83, 0x7e,
-  0xf2, 0x00, 0x7c, 0x10, 0x75, 0x0a, 0x83, 0x7e, 0xf0, 0x00, 0x75, 0x04,
-  0x83, 0x7e, 0xee, 0x00, 0x85, 0xc0, 0x74, 0x69, 0x8e, 0x46, 0x0a, 0x26,
-  0x8b, 0x44, 0x0e, 0x89, 0xc2, 0x8b, 0x7e, 0xfc, 0x42, 0x01, 0xc7, 0x26,
-  0x89, 0x54, 0x0e, 0x8e, 0x46, 0xfe, 0x26, 0xc6, 0x05, 0x2d, 0x8e, 0x46,
-  0x0a, 0x26, 0xf6, 0x44, 0x04, 0x80, 0x74, 0x38, 0x31, 0xc0, 0x2b, 0x46,
-  0xec, 0x89, 0x46, 0xec, 0xb8, 0x00, 0x00, 0x1b, 0x46, 0xee, 0x89, 0x46,
-  0xee, 0xb8, 0x00, 0x00, 0x1b, 0x46, 0xf0, 0x89, 0x46, 0xf0, 0xb8, 0x00,
-  0x00, 0x1b, 0x46, 0xf2, 0x89, 0x46, 0xf2, 0xe9, 0xb0, 0xfe, 0xa8, 0x10,
-  0x74, 0x90, 0x8a, 0x46, 0xf8, 0x98, 0xeb, 0x83, 0x83, 0x7e, 0xfa, 0x00,
-  0x7c, 0xa6, 0xeb, 0xa0, 0xf7, 0x5e, 0xfa, 0xf7, 0x5e, 0xf8, 0x83, 0x5e,
-  0xfa, 0x00, 0xe9, 0x91, 0xfe, 0x8e, 0x46, 0x0a, 0x26, 0x8a, 0x44, 0x04,
-  0xa8, 0x04, 0x74, 0x1a, 0x26, 0x8b, 0x44, 0x0e, 0x89, 0xc2, 0x8b, 0x7e,
-  0xfc, 0x42, 0x01, 0xc7, 0x26, 0x89, 0x54, 0x0e, 0x8e, 0x46, 0xfe, 0x26,
-  0xc6, 0x05, 0x2b, 0xe9, 0x6c, 0xfe, 0xa8, 0x02, 0x75, 0x03, 0xe9, 0x65,
-  0xfe, 0x26, 0x8b, 0x44, 0x0e, 0x89, 0xc2, 0x8b, 0x7e, 0xfc, 0x42, 0x01,
-  0xc7, 0x26, 0x89, 0x54, 0x0e, 0x8e, 0x46, 0xfe, 0x26, 0xc6, 0x05, 0x20,
-  0xe9, 0x4b, 0xfe, 0x77, 0x53, 0x8e, 0x5e, 0x0a, 0x83, 0x7c, 0x0a, 0xff,
-  0x74, 0x04, 0xc6, 0x44, 0x1b, 0x20, 0x8e, 0x5e, 0x0a, 0x8b, 0x5e, 0xfc,
-  0x8b, 0x46, 0xfe, 0x03, 0x5c, 0x0e, 0x89, 0x46, 0xf6, 0x89, 0x5e, 0xf4,
-  0xf6, 0x44, 0x04, 0x80, 0x74, 0x28, 0x83, 0x7c, 0x0a, 0x00, 0x75, 0x25,
-  0x83, 0x7e, 0xf2, 0x00, 0x75, 0x1f, 0x83, 0x7e, 0xf0, 0x00, 0x75, 0x19,
-  0x83, 0x7e, 0xee, 0x00, 0x75, 0x13, 0x83, 0x7e, 0xec, 0x00, 0x75, 0x0d,
-  0x8e, 0xd8, 0xc6, 0x07, 0x00, 0x31, 0xc0, 0xe9, 0x4c, 0x03, 0xe9, 0x77,
-  0x03, 0xe9, 0x07, 0x03, 0x3c, 0x6f, 0x73, 0x59, 0x3c, 0x66, 0x72, 0x5d,
-  0x77, 0x5e, 0x8e, 0x46, 0x0a, 0x26, 0xf6, 0x44, 0x04, 0x20, 0x74, 0x51,
-  0x83, 0x07, 0x04, 0x8b, 0x56, 0xfe, 0xc5, 0x3f, 0x06, 0x8b, 0x45, 0xfc,
-  0x56, 0x89, 0x46, 0xf8, 0x8b, 0x45, 0xfe, 0x8b, 0x5e, 0xf8, 0x89, 0x46,
-  0xfa, 0x89, 0xc1, 0x8b, 0x46, 0xfc, 0xe8, 0x3f, 0xfb, 0xbb, 0xff, 0xff,
-  0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0xe8, 0x37, 0xfa, 0x8e, 0x5e, 0x0a,
-  0x89, 0x44, 0x12, 0x8b, 0x56, 0x0a, 0x89, 0xf0, 0xe8, 0x3c, 0xfc, 0x8b,
-  0x46, 0xf4, 0x8b, 0x56, 0xf6, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc2, 0x08,
-  0x00, 0x77, 0x0c, 0xbf, 0x08, 0x00, 0xe9, 0x48, 0xff, 0xe9, 0xa4, 0x01,
-  0xe9, 0x96, 0x01, 0x3c, 0x73, 0x72, 0x03, 0xe9, 0xb1, 0x00, 0x3c, 0x70,
-  0x74, 0x03, 0xe9, 0x97, 0xfd, 0x8e, 0x46, 0x0a, 0x26, 0xf6, 0x44, 0x05,
-  0x06, 0x75, 0x03, 0xe9, 0x2a, 0x03, 0x8e, 0x46, 0x0a, 0x26, 0x83, 0x7c,
-  0x08, 0x00, 0x75, 0x10, 0x26, 0xf6, 0x44, 0x05, 0x02, 0x75, 0x03, 0xe9,
-  0x1e, 0x03, 0x26, 0xc7, 0x44, 0x08, 0x04, 0x00, 0x8e, 0x46, 0x0a, 0x26,
-  0x80, 0x64, 0x04, 0xf9, 0x83, 0x07, 0x02, 0x8b, 0x57, 0x02, 0x8b, 0x3f,
-  0x8e, 0xc2, 0x26, 0x8b, 0x45, 0xfe, 0x8e, 0x46, 0x0a, 0x89, 0x46, 0xea,
-  0x26, 0xf6, 0x44, 0x05, 0x04, 0x74, 0x55, 0x83, 0xc7, 0x02, 0xba, 0x04,
-  0x00, 0x89, 0x3f, 0x8b, 0x4e, 0xfe, 0x8e, 0x5f, 0x02, 0x8b, 0x5e, 0xfc,
-  0x8b, 0x45, 0xfe, 0xe8, 0x2a, 0xfa, 0xc5, 0x5e, 0xfc, 0xba, 0x04, 0x00,
-  0x8b, 0x46, 0xea, 0x83, 0xc3, 0x05, 0x8c, 0xd9, 0xc6, 0x47, 0xff, 0x3a,
-  0xe8, 0x15, 0xfa, 0x8e, 0x5e, 0x0a, 0x80, 0x7c, 0x1a, 0x50, 0x75, 0x0b,
-  0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0x0e, 0xe8, 0x0d, 0x0e, 0x90, 0xbb,
-  0xff, 0xff, 0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf6, 0xe8, 0x69, 0xf9, 0x8e,
-  0x5e, 0x0a, 0x89, 0x44, 0x0e, 0xe9, 0x2f, 0xff, 0xba, 0x04, 0x00, 0x8b,
-  0x5e, 0xfc, 0x8b, 0x4e, 0xfe, 0xeb, 0xc9, 0x77, 0x69, 0xc4, 0x7e, 0xfc,
-  0x26, 0xc6, 0x05, 0x00, 0x8e, 0x46, 0x0a, 0x26, 0x8a, 0x44, 0x05, 0xa8,
-  0x04, 0x74, 0x4e, 0x83, 0x07, 0x04, 0xc5, 0x3f, 0x8b, 0x45, 0xfe, 0x8b,
-  0x5d, 0xfc, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x06, 0x89, 0x5e,
-  0xf4, 0x89, 0x46, 0xf6, 0x8e, 0x5e, 0x0a, 0x80, 0x7c, 0x1a, 0x53, 0x75,
-  0x2f, 0xf6, 0x44, 0x04, 0x20, 0x74, 0x2c, 0x8b, 0x46, 0xf4, 0x8b, 0x56,
-  0xf6, 0x8b, 0x5c, 0x0a, 0xe8, 0x0d, 0xf9, 0x8e, 0x5e, 0x0a, 0x89, 0x44,
-  0x12, 0x83, 0x7c, 0x0a, 0x00, 0x7d, 0x03, 0xe9, 0xcd, 0xfe, 0x3b, 0x44,
-  0x0a, 0x7e, 0xf8, 0x8b, 0x44, 0x0a, 0xe9, 0xbf, 0xfe, 0xe9, 0xf5, 0x00,
-  0xe9, 0x22, 0x01, 0xe9, 0x10, 0x01, 0x3c, 0x78, 0x75, 0x5d, 0x8e, 0x5e,
-  0x0a, 0x8a, 0x44, 0x04, 0xa8, 0x01, 0x74, 0x4d, 0xa8, 0x80, 0x74, 0x59,
-  0x83, 0x7e, 0xf2, 0x00, 0x75, 0x12, 0x83, 0x7e, 0xf0, 0x00, 0x75, 0x0c,
-  0x83, 0x7e, 0xee, 0x00, 0x75, 0x06, 0x83, 0x7e, 0xec, 0x00, 0x74, 0x31,
-  0x8b, 0x44, 0x0e, 0x89, 0xc2, 0x8b, 0x5e, 0xfc, 0x42, 0x01, 0xc3, 0x89,
-  0x54, 0x0e, 0x8e, 0x5e, 0xfe, 0xc6, 0x07, 0x30, 0x8e, 0x5e, 0x0a, 0x8b,
-  0x44, 0x0e, 0x89, 0xc2, 0x8b, 0x5e, 0xfc, 0x42, 0x01, 0xc3, 0x89, 0x54,
-  0x0e, 0x8e, 0x46, 0x0a, 0x8e, 0x5e, 0xfe, 0x26, 0x8a, 0x44, 0x1a, 0x88,
-  0x07, 0xbf, 0x10, 0x00, 0xe9, 0xbe, 0xfd, 0x3c, 0x75, 0x75, 0x03, 0xe9,
-  0xb7, 0xfd, 0xe9, 0x17, 0xfc, 0x8b, 0x46, 0xfa, 0x0b, 0x46, 0xf8, 0xeb,
-  0xb5, 0x3c, 0x69, 0x74, 0xee, 0x3c, 0x67, 0x74, 0x03, 0xe9, 0x04, 0xfc,
-  0xff, 0x76, 0x0a, 0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0xbf, 0xe3, 0x0d,
-  0x8c, 0xd9, 0x56, 0x8e, 0xdf, 0xff, 0x46, 0xf4, 0xff, 0x1e, 0xa0, 0x10,
-  0xe9, 0x20, 0xfe, 0x77, 0x03, 0xe9, 0x4d, 0xfe, 0x3c, 0x58, 0x73, 0x0a,
-  0x3c, 0x53, 0x75, 0x03, 0xe9, 0xee, 0xfe, 0xe9, 0xd6, 0xfb, 0x77, 0x03,
-  0xe9, 0x53, 0xff, 0x3c, 0x63, 0x75, 0x20, 0x26, 0xc7, 0x44, 0x12, 0x01,
-  0x00, 0x26, 0xf6, 0x44, 0x04, 0x40, 0x75, 0x66, 0x83, 0x07, 0x02, 0xc5,
-  0x3f, 0x8b, 0x5e, 0xfc, 0x8a, 0x45, 0xfe, 0x8e, 0x5e, 0xfe, 0x88, 0x07,
-  0xe9, 0xe4, 0xfd, 0x3c, 0x62, 0x75, 0xa2, 0xbf, 0x02, 0x00, 0xe9, 0x40,
-  0xfd, 0x76, 0x9d, 0x3c, 0x47, 0x74, 0x99, 0x3c, 0x46, 0x75, 0x03, 0xe9,
-  0x90, 0xfd, 0xe9, 0x93, 0xfb, 0xa8, 0x02, 0x75, 0x03, 0xe9, 0xb3, 0xfe,
-  0x83, 0x07, 0x02, 0xc5, 0x3f, 0x8b, 0x5d, 0xfe, 0x85, 0xdb, 0x75, 0x03,
-  0xe9, 0xbd, 0xfe, 0xc7, 0x46, 0xf6, 0xe3, 0x0d, 0x89, 0x5e, 0xf4, 0xe9,
-  0xb2, 0xfe, 0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf6, 0x8b, 0x5c, 0x0a, 0xe8,
-  0xec, 0xf7, 0xe9, 0xbe, 0xfe, 0xf6, 0x44, 0x04, 0x40, 0x75, 0xeb, 0xe9,
-  0xa9, 0xfe, 0x83, 0x07, 0x02, 0x8d, 0x46, 0xe8, 0xc5, 0x3f, 0x8c, 0xd2,
-  0x8b, 0x5d, 0xfe, 0x0e, 0x3e, 0xe8, 0x9d, 0x0b, 0x3d, 0xff, 0xff, 0x75,
-  0x03, 0xe9, 0x77, 0xfd, 0xc5, 0x5e, 0xfc, 0x8a, 0x46, 0xe8, 0x88, 0x07,
-  0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x83, 0x3e, 0xa2, 0x15, 0x00, 0x74, 0xe9,
-  0x8a, 0x5e, 0xe8, 0x30, 0xff, 0x8a, 0x87, 0xa5, 0x15, 0x24, 0x01, 0x30,
-  0xe4, 0x85, 0xc0, 0x74, 0xd8, 0xc5, 0x5e, 0xfc, 0x8a, 0x46, 0xe9, 0x88,
-  0x47, 0x01, 0x8e, 0x5e, 0x0a, 0xff, 0x44, 0x0e, 0xe9, 0x40, 0xfd, 0x8e,
-  0x5e, 0x0a, 0x8b, 0x46, 0xfc, 0x8b, 0x5e, 0xf0, 0x57, 0x8b, 0x4e, 0xee,
-  0xff, 0x76, 0xfe, 0x03, 0x44, 0x0e, 0x8b, 0x56, 0xec, 0x50, 0x8b, 0x46,
-  0xf2, 0x0e, 0x3e, 0xe8, 0x3a, 0x0c, 0x8e, 0x5e, 0x0a, 0x80, 0x7c, 0x1a,
-  0x58, 0x75, 0x0b, 0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0x0e, 0x3e, 0xe8,
-  0xd5, 0x0b, 0xbb, 0xff, 0xff, 0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf6, 0xe8,
-  0x32, 0xf7, 0x8e, 0x5e, 0x0a, 0x89, 0x44, 0x12, 0x3b, 0x44, 0x0a, 0x7c,
-  0x53, 0xf6, 0x44, 0x04, 0x01, 0x75, 0x03, 0xe9, 0xed, 0xfc, 0x83, 0xff,
-  0x0a, 0x7d, 0xf8, 0x85, 0xc0, 0x74, 0x08, 0xc5, 0x5e, 0xf4, 0x80, 0x3f,
-  0x30, 0x74, 0xec, 0x8e, 0x5e, 0x0a, 0xff, 0x44, 0x10, 0xe9, 0xd3, 0xfc,
-  0x83, 0x7c, 0x0a, 0x00, 0x75, 0x10, 0x8b, 0x46, 0xfa, 0x0b, 0x46, 0xf8,
-  0x75, 0x08, 0x8e, 0x5e, 0xf6, 0xc6, 0x07, 0x00, 0xeb, 0xbc, 0x8e, 0x5e,
-  0x0a, 0x8b, 0x5e, 0xfc, 0x8b, 0x4e, 0xfe, 0x8b, 0x46, 0xf8, 0x8b, 0x56,
-  0xfa, 0x57, 0x03, 0x5c, 0x0e, 0x0e, 0x3e, 0xe8, 0x05, 0x0d, 0xeb, 0x82,
-  0x8b, 0x44, 0x0a, 0x2b, 0x44, 0x12, 0x89, 0x44, 0x10, 0xe9, 0x97, 0xfc,
-  0x26, 0x80, 0x4c, 0x05, 0x04, 0xe9, 0xce, 0xfc, 0x26, 0xc7, 0x44, 0x08,
-  0x09, 0x00, 0xe9, 0xdf, 0xfc, 0x00, 0x00, 0x00, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc1, 0x89, 0x56, 0xfe, 0x89, 0xd0,
-  0xc7, 0x46, 0xfc, 0x00, 0x00, 0x50, 0x8c, 0xd8, 0x1f, 0x89, 0x46, 0xfe,
-  0x85, 0xc9, 0x74, 0x68, 0x89, 0xc8, 0x05, 0x03, 0x00, 0x39, 0xc8, 0x72,
-  0x5f, 0x24, 0xfe, 0x89, 0xdf, 0x89, 0xc1, 0x8b, 0x47, 0x0a, 0x83, 0xf9,
-  0x06, 0x73, 0x03, 0xb9, 0x06, 0x00, 0x39, 0xc1, 0x77, 0x4a, 0x8b, 0x55,
-  0x08, 0x8b, 0x5d, 0x06, 0x39, 0xd1, 0x76, 0x51, 0x89, 0xfe, 0x83, 0xc6,
-  0x10, 0x8b, 0x07, 0x39, 0xc1, 0x77, 0x4d, 0x89, 0x55, 0x08, 0x29, 0xc8,
-  0xff, 0x45, 0x0c, 0x3d, 0x06, 0x00, 0x72, 0x59, 0x89, 0xde, 0x01, 0xce,
-  0x89, 0x75, 0x06, 0x89, 0x04, 0x8b, 0x7f, 0x02, 0x89, 0x0f, 0x89, 0x7c,
-  0x02, 0x8b, 0x47, 0x04, 0x89, 0x44, 0x04, 0x89, 0x75, 0x04, 0x89, 0xc7,
-  0x89, 0x75, 0x02, 0x80, 0x0f, 0x01, 0x83, 0xc3, 0x02, 0x89, 0x5e, 0xfc,
-  0x8b, 0x46, 0xfe, 0x50, 0x8c, 0xd8, 0x1f, 0x8b, 0x46, 0xfc, 0x89, 0xec,
-  0x5d, 0x5f, 0x5e, 0x59, 0xcb, 0x8b, 0x5d, 0x14, 0x31, 0xd2, 0xeb, 0xa8,
-  0x39, 0xd0, 0x76, 0x02, 0x89, 0xc2, 0x8b, 0x5f, 0x04, 0x39, 0xf3, 0x75,
-  0xa0, 0x8b, 0x46, 0xfe, 0x89, 0x55, 0x0a, 0x50, 0x8c, 0xd8, 0x1f, 0xeb,
-  0xd6, 0xff, 0x4d, 0x0e, 0x8b, 0x77, 0x02, 0x89, 0x75, 0x06, 0x8b, 0x7f,
-  0x04, 0x89, 0x7c, 0x04, 0xeb, 0xb2, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x08, 0x89, 0xc6, 0x89, 0xd1, 0x89, 0xdf, 0x89, 0xd0, 0x50,
-  0x8c, 0xd8, 0x1f, 0x89, 0xc1, 0x85, 0xf6, 0x75, 0x03, 0xe9, 0x77, 0x00,
-  0x83, 0xee, 0x02, 0xf6, 0x04, 0x01, 0x74, 0xf5, 0x8b, 0x14, 0x89, 0x5e,
-  0xfe, 0x80, 0xe2, 0xfe, 0x89, 0xf3, 0x01, 0xd3, 0xf6, 0x07, 0x01, 0x75,
-  0x6e, 0x03, 0x17, 0x89, 0x14, 0x3b, 0x5d, 0x06, 0x75, 0x03, 0x89, 0x75,
-  0x06, 0x8b, 0x7f, 0x02, 0x8b, 0x5f, 0x04, 0x89, 0x5d, 0x04, 0x89, 0x7f,
-  0x02, 0x8b, 0x7e, 0xfe, 0xff, 0x4d, 0x0e, 0x8b, 0x7f, 0x02, 0x89, 0xfa,
-  0x8b, 0x04, 0x03, 0x15, 0x89, 0x7e, 0xfc, 0x39, 0xd6, 0x75, 0x3d, 0x03,
-  0x05, 0x8b, 0x5e, 0xfe, 0x89, 0x05, 0x3b, 0x57, 0x06, 0x75, 0x03, 0x89,
-  0x7f, 0x06, 0x8b, 0x76, 0xfc, 0x8b, 0x5e, 0xfe, 0xff, 0x4f, 0x0c, 0x3b,
-  0x77, 0x06, 0x73, 0x08, 0x3b, 0x47, 0x08, 0x76, 0x03, 0x89, 0x47, 0x08,
-  0x8b, 0x5e, 0xfe, 0x3b, 0x47, 0x0a, 0x76, 0x03, 0x89, 0x47, 0x0a, 0x89,
-  0xc8, 0x50, 0x8c, 0xd8, 0x1f, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xcb,
-  0xe9, 0xa0, 0x00, 0x89, 0x14, 0x8b, 0x5d, 0x06, 0x39, 0xde, 0x72, 0x03,
-  0xe9, 0x71, 0x00, 0x3b, 0x77, 0x02, 0x77, 0x9f, 0x8b, 0x5d, 0x14, 0x39,
-  0xde, 0x72, 0x98, 0x8b, 0x5e, 0xfe, 0x8b, 0x5f, 0x0e, 0x89, 0xd8, 0x40,
-  0x8b, 0x7e, 0xfe, 0x89, 0x46, 0xf8, 0x8b, 0x45, 0x0c, 0x31, 0xd2, 0x89,
-  0x46, 0xfa, 0xf7, 0x76, 0xf8, 0x89, 0xc2, 0x39, 0xd8, 0x73, 0x24, 0x8b,
-  0x46, 0xfa, 0x29, 0xd8, 0xd1, 0xe2, 0x39, 0xd8, 0x76, 0x50, 0x8b, 0x1c,
-  0x01, 0xf3, 0x8b, 0x07, 0xa8, 0x01, 0x75, 0x03, 0xe9, 0x60, 0xff, 0x3d,
-  0xff, 0xff, 0x74, 0x07, 0x24, 0xfe, 0x01, 0xc3, 0x4a, 0x75, 0xeb, 0x8b,
-  0x5e, 0xfe, 0x8b, 0x5f, 0x06, 0x39, 0xde, 0x72, 0x32, 0x39, 0xde, 0x72,
-  0xe3, 0x8b, 0x5f, 0x04, 0x39, 0xde, 0x72, 0xdc, 0x8b, 0x5f, 0x04, 0x39,
-  0xde, 0x72, 0xd5, 0x8b, 0x5f, 0x04, 0xeb, 0xe9, 0x8b, 0x5f, 0x04, 0x39,
-  0xde, 0x72, 0xc9, 0x89, 0xfb, 0x8b, 0x47, 0x12, 0x83, 0xc3, 0x10, 0x39,
-  0xc6, 0x76, 0x88, 0xe9, 0x1d, 0xff, 0xba, 0xff, 0xff, 0xeb, 0xab, 0x8b,
-  0x5e, 0xfe, 0x8b, 0x5f, 0x14, 0xeb, 0xc6, 0x8b, 0x7e, 0xfe, 0xff, 0x45,
-  0x0e, 0x8b, 0x7e, 0xfc, 0x89, 0x5c, 0x04, 0x89, 0x7c, 0x02, 0x89, 0x75,
-  0x04, 0x89, 0x77, 0x02, 0xe9, 0x1a, 0xff, 0x53, 0x52, 0x56, 0x85, 0xc0,
-  0x75, 0x03, 0xe9, 0xd8, 0x00, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x8b, 0x36,
-  0x94, 0x15, 0x85, 0xf6, 0x74, 0x3e, 0x39, 0xc6, 0x77, 0x08, 0x8b, 0x14,
-  0x01, 0xf2, 0x39, 0xc2, 0x77, 0x5a, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x89,
-  0xf3, 0x8b, 0x74, 0x02, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6, 0x77, 0x08,
-  0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x40, 0xba, 0xe3, 0x0d, 0x8e,
-  0xda, 0x8b, 0x77, 0x04, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6, 0x77, 0x08,
-  0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x28, 0xba, 0xe3, 0x0d, 0x8e,
-  0xda, 0x8b, 0x36, 0x92, 0x10, 0x85, 0xf6, 0x75, 0x20, 0xba, 0xe3, 0x0d,
-  0x8e, 0xda, 0x8b, 0x36, 0x90, 0x10, 0x85, 0xf6, 0x74, 0x98, 0x39, 0xc6,
-  0x76, 0x0c, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x8b, 0x74, 0x04, 0xeb, 0xee,
-  0xeb, 0x41, 0xe9, 0x64, 0x00, 0x39, 0xc6, 0x77, 0x08, 0x8b, 0x14, 0x01,
-  0xf2, 0x39, 0xc2, 0x77, 0x32, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x89, 0xf3,
-  0x8b, 0x74, 0x02, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6, 0x77, 0x08, 0x8b,
-  0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x18, 0xba, 0xe3, 0x0d, 0x8e, 0xda,
-  0x8b, 0x77, 0x04, 0x85, 0xf6, 0x74, 0xae, 0x39, 0xc6, 0x77, 0xaa, 0x8b,
-  0x14, 0x01, 0xf2, 0x39, 0xc2, 0x76, 0xa2, 0xba, 0xe3, 0x0d, 0x89, 0xf3,
-  0x0e, 0xe8, 0xda, 0xfd, 0x90, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x89, 0x36,
-  0x94, 0x15, 0x3b, 0x36, 0x92, 0x10, 0x73, 0x09, 0x8b, 0x44, 0x0a, 0x3b,
-  0x06, 0x94, 0x10, 0x77, 0x14, 0x5e, 0x5a, 0x5b, 0xcb, 0xba, 0xe3, 0x0d,
-  0x8e, 0xda, 0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0xcd, 0xe9, 0x7d,
-  0xff, 0xa3, 0x94, 0x10, 0xeb, 0xe7, 0xe9, 0x5d, 0x0a, 0x89, 0xc0, 0x53,
-  0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x06, 0x89, 0xc7, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0x83, 0x3e, 0xa8, 0x10, 0x00, 0x75, 0x03, 0xe9,
-  0xd3, 0x00, 0x8e, 0xdf, 0x31, 0xdb, 0x8b, 0x07, 0x31, 0xf6, 0x89, 0x46,
-  0xfa, 0x85, 0xc0, 0x74, 0xee, 0x83, 0xc2, 0x02, 0x83, 0xfa, 0x02, 0x73,
-  0x03, 0xba, 0xff, 0xff, 0xb8, 0xe3, 0x0d, 0x8e, 0xc0, 0x26, 0xa1, 0x96,
-  0x10, 0x26, 0x39, 0xc2, 0x73, 0x03, 0x26, 0x89, 0xc2, 0xb1, 0x04, 0x83,
-  0xc2, 0x0f, 0xd3, 0xea, 0x85, 0xd2, 0x75, 0x03, 0xba, 0x00, 0x10, 0xb1,
-  0x04, 0x8b, 0x46, 0xfa, 0xd3, 0xe8, 0x01, 0xc2, 0x81, 0xfa, 0x00, 0x10,
-  0x76, 0x03, 0xba, 0x00, 0x10, 0x8e, 0xc7, 0x89, 0xd3, 0xb4, 0x4a, 0xcd,
-  0x21, 0x19, 0xdb, 0x85, 0xdb, 0x7c, 0xa4, 0xb1, 0x04, 0xd3, 0xe2, 0x89,
-  0x14, 0x8b, 0x54, 0x12, 0x8e, 0xc7, 0x89, 0xd3, 0x89, 0x7e, 0xfe, 0x26,
-  0x8b, 0x07, 0x8b, 0x5e, 0xfa, 0x89, 0xd1, 0x83, 0xeb, 0x04, 0x01, 0xd0,
-  0x89, 0x5e, 0xfc, 0x39, 0xd8, 0x74, 0x22, 0x26, 0x89, 0x57, 0x02, 0x89,
-  0xd3, 0x26, 0x8b, 0x47, 0x04, 0x8b, 0x5e, 0xfc, 0x26, 0x89, 0x47, 0x04,
-  0x89, 0xd3, 0x8b, 0x46, 0xfc, 0x26, 0x89, 0x47, 0x04, 0x89, 0x44, 0x12,
-  0x89, 0xc1, 0xff, 0x44, 0x0e, 0x8b, 0x04, 0x89, 0xcb, 0x29, 0xc8, 0x8e,
-  0x46, 0xfe, 0x2d, 0x04, 0x00, 0x26, 0x89, 0x07, 0x3b, 0x44, 0x0a, 0x76,
-  0x03, 0x89, 0x44, 0x0a, 0x8b, 0x1c, 0x83, 0xeb, 0x04, 0x8e, 0xdf, 0xc7,
-  0x07, 0xff, 0xff, 0xba, 0x01, 0x00, 0xc7, 0x47, 0x02, 0x00, 0x00, 0x89,
-  0xd0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0x31, 0xd2, 0xeb,
-  0xf2, 0x53, 0x51, 0x52, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x83, 0x3e, 0xa8,
-  0x10, 0x00, 0x75, 0x03, 0xe9, 0x81, 0x00, 0x3d, 0xe0, 0xff, 0x77, 0xf8,
-  0x05, 0x1c, 0x00, 0x3b, 0x06, 0x96, 0x10, 0x73, 0x03, 0xa1, 0x96, 0x10,
-  0x89, 0xc2, 0xb1, 0x04, 0x83, 0xc2, 0x0f, 0xd3, 0xea, 0x85, 0xd2, 0x75,
-  0x03, 0xba, 0x00, 0x10, 0x89, 0xd3, 0xb4, 0x48, 0xcd, 0x21, 0x19, 0xdb,
-  0x85, 0xdb, 0x7c, 0x54, 0x8e, 0xd8, 0x31, 0xdb, 0xc7, 0x47, 0x06, 0x16,
-  0x00, 0xc7, 0x47, 0x0e, 0x01, 0x00, 0xc7, 0x47, 0x12, 0x16, 0x00, 0xc7,
-  0x47, 0x14, 0x16, 0x00, 0xc7, 0x47, 0x18, 0x10, 0x00, 0xc7, 0x47, 0x1a,
-  0x10, 0x00, 0x89, 0x5f, 0x02, 0x89, 0x5f, 0x04, 0xb1, 0x04, 0x89, 0x5f,
-  0x08, 0xd3, 0xe2, 0x89, 0x5f, 0x0c, 0x89, 0x17, 0x8b, 0x17, 0x89, 0x5f,
-  0x10, 0x83, 0xc2, 0xe6, 0x89, 0x57, 0x16, 0x89, 0x57, 0x0a, 0x8b, 0x1f,
-  0x83, 0xeb, 0x04, 0xc7, 0x47, 0x02, 0x00, 0x00, 0xc7, 0x07, 0xff, 0xff,
-  0x5a, 0x59, 0x5b, 0xcb, 0x31, 0xc0, 0xeb, 0xf8, 0x31, 0xc0, 0xcb, 0x56,
-  0x89, 0xc6, 0x8e, 0xda, 0x89, 0xd8, 0x8b, 0x1c, 0x8d, 0x57, 0x01, 0x8e,
-  0x44, 0x02, 0x89, 0x14, 0x26, 0x88, 0x07, 0xff, 0x44, 0x0c, 0x5e, 0xcb,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x89, 0xc6, 0x89, 0xd7, 0xb8, 0x00, 0x00,
-  0x50, 0xb8, 0x63, 0x3a, 0x50, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x0a, 0x89,
-  0xf0, 0x0e, 0x3e, 0xe8, 0x45, 0xed, 0x8e, 0xdf, 0x01, 0xc6, 0xc6, 0x04,
-  0x00, 0x5d, 0x5f, 0x5e, 0xca, 0x04, 0x00, 0x52, 0x56, 0x57, 0x89, 0xc6,
-  0x89, 0xca, 0x89, 0xd8, 0x89, 0xf3, 0x0e, 0xe8, 0x08, 0x09, 0x90, 0x5f,
-  0x5e, 0x5a, 0xcb, 0x53, 0x89, 0xc3, 0x8c, 0xc8, 0x8e, 0xda, 0x89, 0x47,
-  0x02, 0x8c, 0xd8, 0x8e, 0xda, 0x89, 0x47, 0x06, 0x8c, 0xc0, 0x8e, 0xda,
-  0x89, 0x07, 0x8c, 0xd0, 0x8e, 0xda, 0x89, 0x47, 0x04, 0x5b, 0xcb, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x8d, 0x7e, 0xfc,
-  0x88, 0xd0, 0x89, 0xda, 0x89, 0xf3, 0xb4, 0x42, 0xcd, 0x21, 0x36, 0x89,
-  0x05, 0x36, 0x89, 0x55, 0x02, 0xd1, 0xd2, 0xd1, 0xca, 0x85, 0xd2, 0x7c,
-  0x0c, 0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0xcb, 0x0e, 0x3e, 0xe8, 0x31, 0x0c, 0x99, 0xeb, 0xf2, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x89, 0x5e, 0xfc, 0x89, 0x4e,
-  0xfe, 0x89, 0xd7, 0x0e, 0x3e, 0xe8, 0x80, 0x0c, 0xa8, 0x80, 0x74, 0x14,
-  0xb0, 0x02, 0x89, 0xf3, 0x31, 0xd2, 0x31, 0xc9, 0xb4, 0x42, 0xcd, 0x21,
-  0xd1, 0xd2, 0xd1, 0xca, 0x85, 0xd2, 0x7c, 0x27, 0xc5, 0x56, 0xfc, 0x89,
-  0xf9, 0x89, 0xf3, 0xb4, 0x40, 0xcd, 0x21, 0x19, 0xd2, 0x89, 0xc6, 0x85,
-  0xd2, 0x7c, 0x14, 0x39, 0xf8, 0x74, 0x08, 0xb8, 0x0c, 0x00, 0x0e, 0xe8,
-  0x5b, 0xe4, 0x90, 0x89, 0xf0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xcb, 0x0e,
-  0x3e, 0xe8, 0xd3, 0x0b, 0xeb, 0xf3, 0xe9, 0x8d, 0x0c, 0x89, 0xc0, 0x53,
-  0x89, 0xc3, 0x8e, 0xda, 0x83, 0xeb, 0x02, 0x8b, 0x07, 0x24, 0xfe, 0x2d,
-  0x02, 0x00, 0x5b, 0xcb, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec,
-  0x08, 0x8e, 0x46, 0x0e, 0x89, 0xd9, 0x83, 0xc3, 0x03, 0x80, 0xe3, 0xfe,
-  0x39, 0xcb, 0x73, 0x5a, 0xbb, 0xff, 0xff, 0x89, 0xd6, 0x8e, 0xd8, 0x83,
-  0xee, 0x02, 0x8b, 0x0c, 0x80, 0xe1, 0xfe, 0x89, 0x76, 0xf8, 0x39, 0xcb,
-  0x76, 0x54, 0x8b, 0x7e, 0x0c, 0x29, 0xcb, 0x01, 0xce, 0x26, 0x89, 0x1d,
-  0x8e, 0xd8, 0x8b, 0x1c, 0x89, 0x5e, 0xfe, 0x83, 0xfb, 0xff, 0x74, 0x38,
-  0xf6, 0x46, 0xfe, 0x01, 0x75, 0x3b, 0x8b, 0x5c, 0x04, 0x89, 0x5e, 0xfa,
-  0x8b, 0x5c, 0x02, 0x89, 0x5e, 0xfc, 0x3d, 0xe3, 0x0d, 0x75, 0x2d, 0x8b,
-  0x1e, 0x90, 0x10, 0x8e, 0xd8, 0x83, 0x7f, 0x04, 0x00, 0x74, 0x2b, 0x39,
-  0xd3, 0x76, 0x1f, 0x8e, 0xd8, 0x8b, 0x5f, 0x04, 0xeb, 0xed, 0x83, 0xfb,
-  0x06, 0x73, 0xa4, 0xbb, 0x06, 0x00, 0xeb, 0x9f, 0xbb, 0x02, 0x00, 0xe9,
-  0x8f, 0x00, 0xe9, 0x9c, 0x00, 0xe9, 0x94, 0x00, 0xeb, 0x4e, 0x8b, 0x0f,
-  0x01, 0xd9, 0x39, 0xd1, 0x76, 0xd9, 0x8e, 0xd8, 0x3b, 0x77, 0x06, 0x75,
-  0x06, 0x8b, 0x4c, 0x02, 0x89, 0x4f, 0x06, 0x8b, 0x7e, 0x0c, 0x8b, 0x4e,
-  0xfe, 0x26, 0x3b, 0x0d, 0x73, 0x32, 0x8b, 0x7e, 0xfc, 0x8e, 0xd8, 0x8b,
-  0x4e, 0xfa, 0x89, 0x4d, 0x04, 0x89, 0xcf, 0x8b, 0x4e, 0xfc, 0x89, 0x4d,
-  0x02, 0x8b, 0x7e, 0xf8, 0x8b, 0x4e, 0xfe, 0x01, 0x0d, 0x8b, 0x7e, 0x0c,
-  0xff, 0x4f, 0x0e, 0x26, 0x3b, 0x0d, 0x73, 0x3f, 0x01, 0xce, 0x26, 0x29,
-  0x0d, 0xe9, 0x60, 0xff, 0x31, 0xdb, 0xeb, 0xb6, 0x26, 0x2b, 0x0d, 0x83,
-  0xf9, 0x06, 0x72, 0xc6, 0x89, 0xfb, 0x26, 0x03, 0x37, 0x8e, 0xd8, 0x8b,
-  0x5e, 0xfc, 0x89, 0x5c, 0x02, 0x8b, 0x5e, 0xfa, 0x89, 0x5c, 0x04, 0x8b,
-  0x5e, 0xfc, 0x89, 0x0c, 0x89, 0x77, 0x04, 0x8b, 0x5e, 0xfa, 0x89, 0x77,
-  0x02, 0x89, 0xfb, 0x26, 0x8b, 0x07, 0x8b, 0x5e, 0xf8, 0x01, 0x07, 0x31,
-  0xdb, 0x89, 0xd8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xca, 0x04, 0x00,
-  0xbb, 0x01, 0x00, 0xeb, 0xf0, 0x29, 0xd9, 0x83, 0xf9, 0x06, 0x72, 0xe7,
-  0x8b, 0x7e, 0xf8, 0x89, 0xde, 0x80, 0xc9, 0x01, 0x01, 0x5e, 0xf8, 0x83,
-  0xce, 0x01, 0x8b, 0x5e, 0xf8, 0x89, 0x35, 0x89, 0x0f, 0x3d, 0xe3, 0x0d,
-  0x75, 0x31, 0x8b, 0x1e, 0x90, 0x10, 0x8e, 0xd8, 0x83, 0x7f, 0x04, 0x00,
-  0x74, 0x13, 0x39, 0xd3, 0x76, 0x07, 0x8e, 0xd8, 0x8b, 0x5f, 0x04, 0xeb,
-  0xed, 0x8b, 0x0f, 0x01, 0xd9, 0x39, 0xd1, 0x76, 0xf1, 0x8b, 0x56, 0xf8,
-  0x8e, 0xd8, 0x83, 0xc2, 0x02, 0xff, 0x47, 0x0c, 0x0e, 0xe8, 0x1a, 0x0b,
-  0x90, 0xeb, 0x9c, 0x31, 0xdb, 0xeb, 0xea, 0x53, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc6, 0x89, 0xd7, 0x80, 0xe1, 0xfe,
-  0x8d, 0x56, 0xfe, 0xb8, 0xe3, 0x0d, 0x16, 0x89, 0xfb, 0x52, 0x89, 0xf2,
-  0x0e, 0xe8, 0x68, 0xfe, 0x85, 0xc0, 0x74, 0x19, 0x3d, 0x01, 0x00, 0x74,
-  0x0a, 0x3d, 0x02, 0x00, 0x75, 0xe2, 0xf6, 0xc1, 0x01, 0x74, 0x0e, 0x31,
-  0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0x89, 0xf0, 0xeb,
-  0xf4, 0x8b, 0x46, 0xfe, 0x0e, 0xe8, 0x9a, 0x01, 0x90, 0x85, 0xc0, 0x74,
-  0xe6, 0x80, 0xc9, 0x01, 0xeb, 0xbe, 0x51, 0x56, 0x89, 0xc1, 0x89, 0xd6,
-  0x81, 0xfa, 0xe3, 0x0d, 0x75, 0x10, 0x89, 0xda, 0x0e, 0xe8, 0x9b, 0xff,
-  0x90, 0x85, 0xc0, 0x75, 0x17, 0x31, 0xd2, 0x5e, 0x59, 0xcb, 0x89, 0xc2,
-  0x89, 0xf0, 0x0e, 0xe8, 0xc1, 0x0a, 0x90, 0x3d, 0xff, 0xff, 0x75, 0x04,
-  0x31, 0xc0, 0xeb, 0xe9, 0x89, 0xc8, 0x89, 0xf2, 0x5e, 0x59, 0xcb, 0xb8,
-  0x96, 0x15, 0xba, 0xe3, 0x0d, 0xcb, 0xb8, 0x98, 0x15, 0xba, 0xe3, 0x0d,
-  0xcb, 0xcb, 0x53, 0x52, 0x89, 0xc3, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xba,
-  0xff, 0x00, 0xff, 0x1e, 0x98, 0x10, 0xb8, 0x10, 0x00, 0x0e, 0x3e, 0xe8,
-  0x29, 0xe3, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xff, 0x1e, 0x98, 0x10, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0xff, 0x1e, 0x9c, 0x10, 0x89, 0xd8, 0xe9, 0x98,
-  0xd7, 0x89, 0xc0, 0x52, 0x89, 0xc2, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xff,
-  0x1e, 0x98, 0x10, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xff, 0x1e, 0x9c, 0x10,
-  0x89, 0xd0, 0xeb, 0xe2, 0x31, 0xc0, 0xcb, 0x53, 0x56, 0x57, 0x89, 0xc6,
-  0xbb, 0xe3, 0x0d, 0xb8, 0xe3, 0x0d, 0x8e, 0xdb, 0x31, 0xff, 0x8b, 0x1e,
-  0x90, 0x10, 0x85, 0xdb, 0x74, 0x0d, 0x39, 0xde, 0x72, 0x09, 0x8e, 0xd8,
-  0x89, 0xdf, 0x8b, 0x5f, 0x04, 0xeb, 0xef, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8,
-  0x89, 0x7c, 0x02, 0x89, 0x5c, 0x04, 0x85, 0xff, 0x74, 0x42, 0x89, 0x75,
-  0x04, 0x85, 0xdb, 0x75, 0x41, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8d, 0x44,
-  0x10, 0x8b, 0x1c, 0x83, 0xc6, 0x16, 0xc7, 0x44, 0xfa, 0x00, 0x00, 0xc7,
-  0x44, 0xf2, 0x00, 0x00, 0xc7, 0x44, 0xf6, 0x00, 0x00, 0xc7, 0x44, 0xf8,
-  0x00, 0x00, 0x89, 0x44, 0xfc, 0x89, 0x44, 0xfe, 0x83, 0xeb, 0x16, 0x89,
-  0x44, 0xf0, 0x89, 0x1c, 0x01, 0xf3, 0x89, 0xf0, 0xc7, 0x07, 0xff, 0xff,
-  0x5f, 0x5e, 0x5b, 0xc3, 0x89, 0x36, 0x90, 0x10, 0xeb, 0xbb, 0xb8, 0xe3,
-  0x0d, 0x8e, 0xd8, 0x89, 0x77, 0x02, 0xeb, 0xb5, 0x53, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0xa1, 0x90, 0x10, 0x85, 0xc0, 0x74, 0x14, 0x89, 0xc3, 0x8b,
-  0x5f, 0x12, 0x8b, 0x07, 0x01, 0xd8, 0x05, 0x02, 0x00, 0x3b, 0x06, 0x64,
-  0x10, 0x75, 0x04, 0x8b, 0x07, 0x5b, 0xcb, 0x31, 0xc0, 0x5b, 0xcb, 0x53,
-  0x51, 0x89, 0xc3, 0x89, 0xd1, 0x8e, 0xda, 0x8b, 0x07, 0x89, 0xc2, 0x83,
-  0xc2, 0x03, 0x80, 0xe2, 0xfe, 0x39, 0xc2, 0x73, 0x05, 0x31, 0xc0, 0x59,
-  0x5b, 0xc3, 0x0e, 0xe8, 0xba, 0xff, 0x39, 0xd0, 0x72, 0x2c, 0x31, 0xd2,
-  0x8e, 0xd9, 0x89, 0x17, 0x83, 0xc2, 0x1e, 0x3b, 0x17, 0x72, 0xe6, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0xa1, 0x96, 0x10, 0x39, 0xc2, 0x73, 0x05, 0x89,
-  0xc2, 0x80, 0xe2, 0xfe, 0x8e, 0xd9, 0x89, 0x17, 0x85, 0xd2, 0x74, 0xcd,
-  0xb8, 0x01, 0x00, 0x59, 0x5b, 0xc3, 0x29, 0xc2, 0xeb, 0xd2, 0x53, 0x52,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x50, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xa1,
-  0xa8, 0x10, 0x85, 0xc0, 0x74, 0x09, 0x83, 0x3e, 0x64, 0x10, 0xfe, 0x75,
-  0x0a, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x5b, 0xcb, 0x8d,
-  0x46, 0xfe, 0x8c, 0xd2, 0xe8, 0x80, 0xff, 0x85, 0xc0, 0x74, 0xec, 0xb8,
-  0xe3, 0x0d, 0x8b, 0x5e, 0xfe, 0x8e, 0xd8, 0x03, 0x1e, 0x64, 0x10, 0x3b,
-  0x1e, 0x64, 0x10, 0x73, 0x03, 0xbb, 0xfe, 0xff, 0x89, 0xd8, 0x0e, 0xe8,
-  0x72, 0x09, 0x90, 0x3d, 0xff, 0xff, 0x74, 0xc9, 0x89, 0xc6, 0x3d, 0xf8,
-  0xff, 0x77, 0xc2, 0x39, 0xc3, 0x76, 0xbe, 0x29, 0xc3, 0x89, 0x5e, 0xfe,
-  0x8d, 0x47, 0xfe, 0x39, 0xd8, 0x77, 0xb2, 0xba, 0xe3, 0x0d, 0x8e, 0xda,
-  0x89, 0x46, 0xfe, 0x8b, 0x1e, 0x90, 0x10, 0x85, 0xdb, 0x74, 0x0b, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0x83, 0x7f, 0x04, 0x00, 0x75, 0x48, 0x85, 0xdb,
-  0x74, 0x5f, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x07, 0x8d, 0x7c, 0xfe,
-  0x01, 0xd8, 0x39, 0xc7, 0x75, 0x4f, 0x83, 0x46, 0xfe, 0x02, 0x89, 0xc6,
-  0x8b, 0x46, 0xfe, 0x01, 0x07, 0x03, 0x7e, 0xfe, 0xc7, 0x05, 0xff, 0xff,
-  0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x46, 0xfe, 0x0c, 0x01, 0x89, 0x04,
-  0xc7, 0x47, 0x0a, 0xff, 0xff, 0x8d, 0x44, 0x02, 0xff, 0x47, 0x0c, 0x0e,
-  0x3e, 0xe8, 0x2f, 0xf8, 0xb8, 0x01, 0x00, 0xe9, 0x51, 0xff, 0x39, 0xf3,
-  0x76, 0x0a, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8b, 0x5f, 0x04, 0xeb, 0x9b,
-  0x8b, 0x07, 0x01, 0xd8, 0x05, 0x02, 0x00, 0x39, 0xf0, 0x73, 0x9f, 0xeb,
-  0xe9, 0x83, 0x7e, 0xfe, 0x1c, 0x73, 0x03, 0xe9, 0x2b, 0xff, 0xb8, 0xe3,
-  0x0d, 0x8e, 0xd8, 0x8b, 0x46, 0xfe, 0x89, 0x04, 0x89, 0xf0, 0x89, 0xf3,
-  0xe8, 0x00, 0xfe, 0x89, 0xc7, 0x89, 0xc6, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8,
-  0x8b, 0x05, 0x89, 0x46, 0xfe, 0xeb, 0x99, 0x53, 0x51, 0x52, 0x56, 0x89,
-  0xc1, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0x19, 0xd2, 0x31, 0xf6, 0x85,
-  0xd2, 0x7f, 0x02, 0x75, 0x10, 0x89, 0xc8, 0x31, 0xd2, 0x0e, 0x3e, 0xe8,
-  0xbf, 0x07, 0x89, 0xf0, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0xb8, 0x04, 0x00,
-  0xbe, 0xff, 0xff, 0x0e, 0x3e, 0xe8, 0x99, 0xdf, 0xeb, 0xe3, 0x53, 0x89,
-  0xc3, 0x8e, 0xda, 0xf6, 0x47, 0x0b, 0x20, 0x74, 0x02, 0x5b, 0xcb, 0x8b,
-  0x47, 0x0c, 0x0e, 0xe8, 0xd0, 0x08, 0x90, 0x85, 0xc0, 0x74, 0xf2, 0x8e,
-  0xda, 0x80, 0x4f, 0x0b, 0x20, 0xf6, 0x47, 0x0b, 0x07, 0x75, 0xe6, 0x80,
-  0x4f, 0x0b, 0x02, 0x5b, 0xcb, 0x56, 0x89, 0xc6, 0x85, 0xd2, 0x75, 0x04,
-  0x85, 0xc0, 0x74, 0x11, 0xf6, 0xc7, 0xff, 0x74, 0x10, 0x8e, 0xda, 0x88,
-  0x3c, 0xb8, 0x02, 0x00, 0x88, 0x5c, 0x01, 0x5e, 0xcb, 0x31, 0xc0, 0x5e,
-  0xcb, 0x8e, 0xda, 0xb8, 0x01, 0x00, 0x88, 0x1c, 0x5e, 0xcb, 0x56, 0x57,
-  0x55, 0x89, 0xe5, 0x83, 0xec, 0x26, 0x53, 0x51, 0x89, 0xd1, 0x8e, 0x46,
-  0xd6, 0xc6, 0x46, 0xda, 0x00, 0x8d, 0x76, 0xdb, 0x89, 0xdf, 0x8c, 0x56,
-  0xfe, 0x8d, 0x5e, 0xfc, 0x89, 0x4e, 0xfc, 0x33, 0xd2, 0x36, 0xf7, 0x37,
-  0x36, 0x89, 0x07, 0xb8, 0xe3, 0x0d, 0x89, 0xd3, 0x8e, 0xd8, 0x8a, 0x87,
-  0x1c, 0x0a, 0x8e, 0x5e, 0xfe, 0x88, 0x04, 0x8b, 0x46, 0xfc, 0x46, 0x85,
-  0xc0, 0x75, 0xda, 0x8e, 0x5e, 0xfe, 0x83, 0xc6, 0xff, 0x8a, 0x04, 0x26,
-  0x88, 0x05, 0x47, 0x84, 0xc0, 0x75, 0xf3, 0x8b, 0x46, 0xd8, 0x8b, 0x56,
-  0xd6, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xcb, 0x56, 0x57, 0x89, 0xde, 0x89,
-  0xcf, 0x83, 0xfa, 0x0a, 0x75, 0x04, 0x85, 0xc0, 0x7c, 0x0b, 0x0e, 0xe8,
-  0x90, 0xff, 0x89, 0xf0, 0x89, 0xfa, 0x5f, 0x5e, 0xcb, 0x8e, 0xd9, 0xf7,
-  0xd8, 0x43, 0xc6, 0x04, 0x2d, 0xeb, 0xeb, 0x53, 0x51, 0x89, 0xc1, 0x89,
-  0xc3, 0x8e, 0xda, 0x8a, 0x07, 0x84, 0xc0, 0x74, 0x0f, 0x2c, 0x61, 0x3c,
-  0x19, 0x76, 0x03, 0x43, 0xeb, 0xf1, 0x04, 0x41, 0x88, 0x07, 0xeb, 0xf7,
-  0x89, 0xc8, 0x59, 0x5b, 0xcb, 0x53, 0x52, 0xbb, 0x01, 0x00, 0xb8, 0xfa,
-  0x09, 0xba, 0xe3, 0x0d, 0x0e, 0xe8, 0x31, 0xda, 0x90, 0x5a, 0x5b, 0xcb,
-  0x53, 0x89, 0xc3, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x8a, 0x9f, 0xa5, 0x15,
-  0x80, 0xe3, 0x01, 0x30, 0xff, 0x89, 0xd8, 0x5b, 0xcb, 0x31, 0xc0, 0xe9,
-  0x1a, 0x08, 0x89, 0xc0, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x4c,
-  0x52, 0x8b, 0x76, 0x0a, 0xc6, 0x46, 0xb4, 0x00, 0x8d, 0x7e, 0xb5, 0x8c,
-  0x56, 0xfe, 0x89, 0x76, 0xfa, 0x8b, 0x76, 0x0c, 0x89, 0x7e, 0xf8, 0x89,
-  0x76, 0xfc, 0x8b, 0x76, 0x0e, 0x8b, 0x56, 0xb2, 0x89, 0x76, 0xf6, 0x8d,
-  0x76, 0xf6, 0x8b, 0xfa, 0x85, 0xc0, 0x74, 0x2e, 0x8b, 0xd0, 0x8b, 0xc3,
-  0x33, 0xdb, 0x36, 0x3b, 0x14, 0x72, 0x0a, 0x8b, 0xd8, 0x8b, 0xc2, 0x33,
-  0xd2, 0x36, 0xf7, 0x34, 0x93, 0x36, 0xf7, 0x34, 0x91, 0x36, 0xf7, 0x34,
-  0x97, 0x36, 0xf7, 0x34, 0x36, 0x89, 0x14, 0x8b, 0xd0, 0x8b, 0xc3, 0x8b,
-  0xd9, 0x8b, 0xcf, 0xe9, 0x2e, 0x00, 0x85, 0xdb, 0x74, 0x15, 0x8b, 0xd3,
-  0x8b, 0xc1, 0x33, 0xdb, 0x33, 0xc9, 0x36, 0x3b, 0x14, 0x72, 0xda, 0x8b,
-  0xc8, 0x8b, 0xc2, 0x33, 0xd2, 0xeb, 0xce, 0x8b, 0xd1, 0x8b, 0xc7, 0x33,
-  0xc9, 0x33, 0xff, 0x36, 0x3b, 0x14, 0x72, 0xc9, 0x8b, 0xf8, 0x8b, 0xc2,
-  0x33, 0xd2, 0xeb, 0xbd, 0xbf, 0xe3, 0x0d, 0x89, 0xd6, 0x8e, 0xdf, 0x8b,
-  0x7e, 0xf6, 0x89, 0x56, 0xb2, 0x8a, 0x95, 0x1c, 0x0a, 0x8e, 0x5e, 0xfe,
-  0x8b, 0x7e, 0xf8, 0xff, 0x46, 0xf8, 0x88, 0x15, 0x85, 0xc0, 0x74, 0x03,
-  0xe9, 0x6f, 0xff, 0x85, 0xdb, 0x75, 0xf9, 0x85, 0xc9, 0x75, 0xf5, 0x85,
-  0xf6, 0x75, 0xf1, 0x83, 0x46, 0xf8, 0xff, 0x8e, 0x5e, 0xfe, 0x8b, 0x5e,
-  0xf8, 0x8a, 0x07, 0xc5, 0x5e, 0xfa, 0xff, 0x46, 0xfa, 0x88, 0x07, 0x84,
-  0xc0, 0x75, 0xe8, 0x8b, 0x46, 0x0a, 0x8b, 0x56, 0x0c, 0x89, 0xec, 0x5d,
-  0x5f, 0x5e, 0xca, 0x06, 0x00, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec,
-  0x04, 0x8b, 0x76, 0x0a, 0x8b, 0x7e, 0x0c, 0x89, 0x76, 0xfc, 0x89, 0x7e,
-  0xfe, 0x83, 0x7e, 0x0e, 0x0a, 0x75, 0x0c, 0x85, 0xc0, 0x7c, 0x1c, 0x75,
-  0x06, 0x85, 0xdb, 0x75, 0x02, 0x85, 0xc9, 0xff, 0x76, 0x0e, 0xff, 0x76,
-  0xfe, 0xff, 0x76, 0xfc, 0x0e, 0xe8, 0xe8, 0xfe, 0x8b, 0x56, 0x0c, 0x89,
-  0xf0, 0xeb, 0xbe, 0x8e, 0xdf, 0x31, 0xff, 0x29, 0xd7, 0x89, 0xfa, 0xbf,
-  0x00, 0x00, 0x19, 0xcf, 0x89, 0xf9, 0xbf, 0x00, 0x00, 0x19, 0xdf, 0x89,
-  0xfb, 0xbf, 0x00, 0x00, 0x19, 0xc7, 0x89, 0xf8, 0x8d, 0x7c, 0x01, 0xc6,
-  0x04, 0x2d, 0x89, 0x7e, 0xfc, 0xeb, 0xc4, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x26, 0x53, 0x51, 0xc6, 0x46, 0xda, 0x00, 0x8d, 0x76, 0xdb,
-  0x89, 0xdf, 0x8c, 0xd3, 0x89, 0x4e, 0xfe, 0x8e, 0xc3, 0x8b, 0x5e, 0x0a,
-  0x89, 0x5e, 0xfc, 0x8d, 0x5e, 0xfc, 0x33, 0xc9, 0x36, 0x3b, 0x17, 0x72,
-  0x07, 0x92, 0x87, 0xd1, 0x36, 0xf7, 0x37, 0x91, 0x36, 0xf7, 0x37, 0x36,
-  0x89, 0x17, 0x8b, 0xd1, 0xbb, 0xe3, 0x0d, 0x8e, 0xdb, 0x8b, 0x5e, 0xfc,
-  0x8a, 0x9f, 0x1c, 0x0a, 0x26, 0x88, 0x1c, 0x46, 0x85, 0xd2, 0x75, 0xcd,
-  0x85, 0xc0, 0x75, 0xc9, 0x8e, 0x5e, 0xfe, 0x83, 0xc6, 0xff, 0x26, 0x8a,
-  0x04, 0x88, 0x05, 0x47, 0x84, 0xc0, 0x75, 0xf3, 0x8b, 0x46, 0xd8, 0x8b,
-  0x56, 0xd6, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xca, 0x02, 0x00, 0x56, 0x57,
-  0x55, 0x89, 0xe5, 0x89, 0xde, 0x89, 0xcf, 0x83, 0x7e, 0x0a, 0x0a, 0x75,
-  0x04, 0x85, 0xd2, 0x7c, 0x0d, 0xff, 0x76, 0x0a, 0x0e, 0xe8, 0x77, 0xff,
-  0x89, 0xf0, 0x89, 0xfa, 0xeb, 0xda, 0x8e, 0xd9, 0xf7, 0xda, 0xc6, 0x04,
-  0x2d, 0xf7, 0xd8, 0x83, 0xda, 0x00, 0x43, 0xeb, 0xe4, 0xcb, 0x53, 0x51,
-  0x52, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xa1, 0x64, 0x10, 0x05, 0x10, 0x00,
-  0x24, 0xf0, 0xb1, 0x04, 0x89, 0xc2, 0xd3, 0xea, 0x85, 0xd2, 0x74, 0x0e,
-  0x80, 0x3e, 0x6a, 0x10, 0x00, 0x74, 0x0b, 0xb8, 0x00, 0x10, 0x39, 0xd0,
-  0x77, 0x21, 0x5a, 0x59, 0x5b, 0xcb, 0x8e, 0x06, 0x66, 0x10, 0x31, 0xdb,
-  0x4b, 0xb4, 0x4a, 0xcd, 0x21, 0x8c, 0xd8, 0x2b, 0x06, 0x66, 0x10, 0x29,
-  0xc3, 0x89, 0xd8, 0x81, 0xfb, 0x00, 0x10, 0x76, 0xdd, 0xeb, 0xd8, 0x29,
-  0xd0, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0xb1, 0x04, 0x8b, 0x16, 0x64, 0x10,
-  0xd3, 0xe0, 0x30, 0xf6, 0x05, 0x10, 0x00, 0x80, 0xe2, 0x0f, 0x29, 0xd0,
-  0x89, 0xc2, 0x0e, 0xe8, 0xce, 0xfa, 0x90, 0x01, 0xd0, 0x2d, 0x08, 0x00,
-  0x0e, 0xe8, 0x25, 0xe0, 0x36, 0x0e, 0x3e, 0xe8, 0x2d, 0xf4, 0xeb, 0xae,
-  0x52, 0x89, 0xc2, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xa1, 0xa8, 0x10, 0x89,
-  0x16, 0xa8, 0x10, 0x5a, 0xcb, 0x00, 0x55, 0x1e, 0x52, 0x50, 0x32, 0xff,
-  0x8b, 0xcb, 0xd1, 0xe3, 0x03, 0xd9, 0x81, 0xc3, 0x23, 0x44, 0x8c, 0xc9,
-  0x8e, 0xc1, 0xe8, 0x2c, 0x00, 0x53, 0x1e, 0x55, 0x8b, 0xec, 0xc5, 0x5e,
-  0x06, 0x9c, 0x8f, 0x47, 0x12, 0x89, 0x07, 0x89, 0x4f, 0x04, 0x89, 0x57,
-  0x06, 0x89, 0x77, 0x0a, 0x89, 0x7f, 0x0c, 0x8f, 0x47, 0x08, 0x8f, 0x47,
-  0x0e, 0x8f, 0x47, 0x02, 0x8c, 0x47, 0x10, 0x83, 0xc4, 0x04, 0x1f, 0x5d,
-  0xcb, 0x06, 0x53, 0x8e, 0xda, 0x8b, 0xd8, 0xff, 0x77, 0x0e, 0x8b, 0x07,
-  0x8b, 0x4f, 0x04, 0x8b, 0x57, 0x06, 0x8b, 0x77, 0x0a, 0x8b, 0x7f, 0x0c,
-  0x8b, 0x6f, 0x08, 0x8e, 0x47, 0x10, 0x8b, 0x5f, 0x02, 0x1f, 0xcb, 0xcd,
-  0x00, 0xc3, 0xcd, 0x01, 0xc3, 0xcd, 0x02, 0xc3, 0xcc, 0x90, 0xc3, 0xcd,
-  0x04, 0xc3, 0xcd, 0x05, 0xc3, 0xcd, 0x06, 0xc3, 0xcd, 0x07, 0xc3, 0xcd,
-  0x08, 0xc3, 0xcd, 0x09, 0xc3, 0xcd, 0x0a, 0xc3, 0xcd, 0x0b, 0xc3, 0xcd,
-  0x0c, 0xc3, 0xcd, 0x0d, 0xc3, 0xcd, 0x0e, 0xc3, 0xcd, 0x0f, 0xc3, 0xcd,
-  0x10, 0xc3, 0xcd, 0x11, 0xc3, 0xcd, 0x12, 0xc3, 0xcd, 0x13, 0xc3, 0xcd,
-  0x14, 0xc3, 0xcd, 0x15, 0xc3, 0xcd, 0x16, 0xc3, 0xcd, 0x17, 0xc3, 0xcd,
-  0x18, 0xc3, 0xcd, 0x19, 0xc3, 0xcd, 0x1a, 0xc3, 0xcd, 0x1b, 0xc3, 0xcd,
-  0x1c, 0xc3, 0xcd, 0x1d, 0xc3, 0xcd, 0x1e, 0xc3, 0xcd, 0x1f, 0xc3, 0xcd,
-  0x20, 0xc3, 0xcd, 0x21, 0xc3, 0xcd, 0x22, 0xc3, 0xcd, 0x23, 0xc3, 0xcd,
-  0x24, 0xc3, 0xe9, 0x8e, 0x02, 0xe9, 0x95, 0x02, 0xcd, 0x27, 0xc3, 0xcd,
-  0x28, 0xc3, 0xcd, 0x29, 0xc3, 0xcd, 0x2a, 0xc3, 0xcd, 0x2b, 0xc3, 0xcd,
-  0x2c, 0xc3, 0xcd, 0x2d, 0xc3, 0xcd, 0x2e, 0xc3, 0xcd, 0x2f, 0xc3, 0xcd,
-  0x30, 0xc3, 0xcd, 0x31, 0xc3, 0xcd, 0x32, 0xc3, 0xcd, 0x33, 0xc3, 0xcd,
-  0x34, 0xc3, 0xcd, 0x35, 0xc3, 0xcd, 0x36, 0xc3, 0xcd, 0x37, 0xc3, 0xcd,
-  0x38, 0xc3, 0xcd, 0x39, 0xc3, 0xcd, 0x3a, 0xc3, 0xcd, 0x3b, 0xc3, 0xcd,
-  0x3c, 0xc3, 0xcd, 0x3d, 0xc3, 0xcd, 0x3e, 0xc3, 0xcd, 0x3f, 0xc3, 0xcd,
-  0x40, 0xc3, 0xcd, 0x41, 0xc3, 0xcd, 0x42, 0xc3, 0xcd, 0x43, 0xc3, 0xcd,
-  0x44, 0xc3, 0xcd, 0x45, 0xc3, 0xcd, 0x46, 0xc3, 0xcd, 0x47, 0xc3, 0xcd,
-  0x48, 0xc3, 0xcd, 0x49, 0xc3, 0xcd, 0x4a, 0xc3, 0xcd, 0x4b, 0xc3, 0xcd,
-  0x4c, 0xc3, 0xcd, 0x4d, 0xc3, 0xcd, 0x4e, 0xc3, 0xcd, 0x4f, 0xc3, 0xcd,
-  0x50, 0xc3, 0xcd, 0x51, 0xc3, 0xcd, 0x52, 0xc3, 0xcd, 0x53, 0xc3, 0xcd,
-  0x54, 0xc3, 0xcd, 0x55, 0xc3, 0xcd, 0x56, 0xc3, 0xcd, 0x57, 0xc3, 0xcd,
-  0x58, 0xc3, 0xcd, 0x59, 0xc3, 0xcd, 0x5a, 0xc3, 0xcd, 0x5b, 0xc3, 0xcd,
-  0x5c, 0xc3, 0xcd, 0x5d, 0xc3, 0xcd, 0x5e, 0xc3, 0xcd, 0x5f, 0xc3, 0xcd,
-  0x60, 0xc3, 0xcd, 0x61, 0xc3, 0xcd, 0x62, 0xc3, 0xcd, 0x63, 0xc3, 0xcd,
-  0x64, 0xc3, 0xcd, 0x65, 0xc3, 0xcd, 0x66, 0xc3, 0xcd, 0x67, 0xc3, 0xcd,
-  0x68, 0xc3, 0xcd, 0x69, 0xc3, 0xcd, 0x6a, 0xc3, 0xcd, 0x6b, 0xc3, 0xcd,
-  0x6c, 0xc3, 0xcd, 0x6d, 0xc3, 0xcd, 0x6e, 0xc3, 0xcd, 0x6f, 0xc3, 0xcd,
-  0x70, 0xc3, 0xcd, 0x71, 0xc3, 0xcd, 0x72, 0xc3, 0xcd, 0x73, 0xc3, 0xcd,
-  0x74, 0xc3, 0xcd, 0x75, 0xc3, 0xcd, 0x76, 0xc3, 0xcd, 0x77, 0xc3, 0xcd,
-  0x78, 0xc3, 0xcd, 0x79, 0xc3, 0xcd, 0x7a, 0xc3, 0xcd, 0x7b, 0xc3, 0xcd,
-  0x7c, 0xc3, 0xcd, 0x7d, 0xc3, 0xcd, 0x7e, 0xc3, 0xcd, 0x7f, 0xc3, 0xcd,
-  0x80, 0xc3, 0xcd, 0x81, 0xc3, 0xcd, 0x82, 0xc3, 0xcd, 0x83, 0xc3, 0xcd,
-  0x84, 0xc3, 0xcd, 0x85, 0xc3, 0xcd, 0x86, 0xc3, 0xcd, 0x87, 0xc3, 0xcd,
-  0x88, 0xc3, 0xcd, 0x89, 0xc3, 0xcd, 0x8a, 0xc3, 0xcd, 0x8b, 0xc3, 0xcd,
-  0x8c, 0xc3, 0xcd, 0x8d, 0xc3, 0xcd, 0x8e, 0xc3, 0xcd, 0x8f, 0xc3, 0xcd,
-  0x90, 0xc3, 0xcd, 0x91, 0xc3, 0xcd, 0x92, 0xc3, 0xcd, 0x93, 0xc3, 0xcd,
-  0x94, 0xc3, 0xcd, 0x95, 0xc3, 0xcd, 0x96, 0xc3, 0xcd, 0x97, 0xc3, 0xcd,
-  0x98, 0xc3, 0xcd, 0x99, 0xc3, 0xcd, 0x9a, 0xc3, 0xcd, 0x9b, 0xc3, 0xcd,
-  0x9c, 0xc3, 0xcd, 0x9d, 0xc3, 0xcd, 0x9e, 0xc3, 0xcd, 0x9f, 0xc3, 0xcd,
-  0xa0, 0xc3, 0xcd, 0xa1, 0xc3, 0xcd, 0xa2, 0xc3, 0xcd, 0xa3, 0xc3, 0xcd,
-  0xa4, 0xc3, 0xcd, 0xa5, 0xc3, 0xcd, 0xa6, 0xc3, 0xcd, 0xa7, 0xc3, 0xcd,
-  0xa8, 0xc3, 0xcd, 0xa9, 0xc3, 0xcd, 0xaa, 0xc3, 0xcd, 0xab, 0xc3, 0xcd,
-  0xac, 0xc3, 0xcd, 0xad, 0xc3, 0xcd, 0xae, 0xc3, 0xcd, 0xaf, 0xc3, 0xcd,
-  0xb0, 0xc3, 0xcd, 0xb1, 0xc3, 0xcd, 0xb2, 0xc3, 0xcd, 0xb3, 0xc3, 0xcd,
-  0xb4, 0xc3, 0xcd, 0xb5, 0xc3, 0xcd, 0xb6, 0xc3, 0xcd, 0xb7, 0xc3, 0xcd,
-  0xb8, 0xc3, 0xcd, 0xb9, 0xc3, 0xcd, 0xba, 0xc3, 0xcd, 0xbb, 0xc3, 0xcd,
-  0xbc, 0xc3, 0xcd, 0xbd, 0xc3, 0xcd, 0xbe, 0xc3, 0xcd, 0xbf, 0xc3, 0xcd,
-  0xc0, 0xc3, 0xcd, 0xc1, 0xc3, 0xcd, 0xc2, 0xc3, 0xcd, 0xc3, 0xc3, 0xcd,
-  0xc4, 0xc3, 0xcd, 0xc5, 0xc3, 0xcd, 0xc6, 0xc3, 0xcd, 0xc7, 0xc3, 0xcd,
-  0xc8, 0xc3, 0xcd, 0xc9, 0xc3, 0xcd, 0xca, 0xc3, 0xcd, 0xcb, 0xc3, 0xcd,
-  0xcc, 0xc3, 0xcd, 0xcd, 0xc3, 0xcd, 0xce, 0xc3, 0xcd, 0xcf, 0xc3, 0xcd,
-  0xd0, 0xc3, 0xcd, 0xd1, 0xc3, 0xcd, 0xd2, 0xc3, 0xcd, 0xd3, 0xc3, 0xcd,
-  0xd4, 0xc3, 0xcd, 0xd5, 0xc3, 0xcd, 0xd6, 0xc3, 0xcd, 0xd7, 0xc3, 0xcd,
-  0xd8, 0xc3, 0xcd, 0xd9, 0xc3, 0xcd, 0xda, 0xc3, 0xcd, 0xdb, 0xc3, 0xcd,
-  0xdc, 0xc3, 0xcd, 0xdd, 0xc3, 0xcd, 0xde, 0xc3, 0xcd, 0xdf, 0xc3, 0xcd,
-  0xe0, 0xc3, 0xcd, 0xe1, 0xc3, 0xcd, 0xe2, 0xc3, 0xcd, 0xe3, 0xc3, 0xcd,
-  0xe4, 0xc3, 0xcd, 0xe5, 0xc3, 0xcd, 0xe6, 0xc3, 0xcd, 0xe7, 0xc3, 0xcd,
-  0xe8, 0xc3, 0xcd, 0xe9, 0xc3, 0xcd, 0xea, 0xc3, 0xcd, 0xeb, 0xc3, 0xcd,
-  0xec, 0xc3, 0xcd, 0xed, 0xc3, 0xcd, 0xee, 0xc3, 0xcd, 0xef, 0xc3, 0xcd,
-  0xf0, 0xc3, 0xcd, 0xf1, 0xc3, 0xcd, 0xf2, 0xc3, 0xcd, 0xf3, 0xc3, 0xcd,
-  0xf4, 0xc3, 0xcd, 0xf5, 0xc3, 0xcd, 0xf6, 0xc3, 0xcd, 0xf7, 0xc3, 0xcd,
-  0xf8, 0xc3, 0xcd, 0xf9, 0xc3, 0xcd, 0xfa, 0xc3, 0xcd, 0xfb, 0xc3, 0xcd,
-  0xfc, 0xc3, 0xcd, 0xfd, 0xc3, 0xcd, 0xfe, 0xc3, 0xcd, 0xff, 0xc3, 0xcd,
-  0x25, 0x73, 0x03, 0x9d, 0xf9, 0xc3, 0x9d, 0xf8, 0xc3, 0xcd, 0x26, 0x73,
-  0x03, 0x9d, 0xf9, 0xc3, 0x9d, 0xf8, 0xc3, 0x85, 0xd2, 0x75, 0x08, 0xcb,
-  0x85, 0xd2, 0x75, 0x03, 0x31, 0xc0, 0xcb, 0x53, 0x52, 0x89, 0xc3, 0x88,
-  0xc2, 0x30, 0xe4, 0x0e, 0x3e, 0xe8, 0xba, 0xd8, 0x81, 0xfb, 0x00, 0x01,
-  0x73, 0x45, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x80, 0x3e, 0x68, 0x10, 0x03,
-  0x72, 0x32, 0x80, 0xfb, 0x50, 0x75, 0x04, 0xb2, 0x0e, 0xeb, 0x07, 0x80,
-  0xfb, 0x22, 0x72, 0x1b, 0xb2, 0x13, 0xb8, 0xe3, 0x0d, 0x88, 0xd3, 0x8e,
-  0xd8, 0x30, 0xff, 0x8a, 0x87, 0xaa, 0x10, 0x98, 0x0e, 0xe8, 0x39, 0xd8,
-  0x90, 0xb8, 0xff, 0xff, 0x5a, 0x5b, 0xcb, 0x80, 0xfb, 0x20, 0x72, 0x04,
-  0xb2, 0x05, 0xeb, 0xde, 0x80, 0xfa, 0x13, 0x76, 0xd9, 0xeb, 0xd5, 0x88,
-  0xf8, 0x30, 0xe4, 0xeb, 0xdf, 0x52, 0x89, 0xc2, 0x0e, 0xe8, 0x9b, 0xff,
-  0x89, 0xd0, 0x5a, 0xcb, 0x53, 0x52, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x3b,
-  0x06, 0xbe, 0x10, 0x72, 0x05, 0x31, 0xc0, 0x5a, 0x5b, 0xcb, 0x89, 0xc3,
-  0x8b, 0x16, 0xe8, 0x10, 0xd1, 0xe3, 0x8e, 0x1e, 0xea, 0x10, 0x01, 0xd3,
-  0x8b, 0x07, 0x5a, 0x5b, 0xcb, 0x53, 0x51, 0xbb, 0xe3, 0x0d, 0x8e, 0xdb,
-  0x3b, 0x06, 0xbe, 0x10, 0x72, 0x03, 0x59, 0x5b, 0xcb, 0x89, 0xc3, 0x8b,
-  0x0e, 0xe8, 0x10, 0xd1, 0xe3, 0x8e, 0x1e, 0xea, 0x10, 0x01, 0xcb, 0x89,
-  0x17, 0x59, 0x5b, 0xcb, 0x53, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0x9a,
-  0x40, 0x4a, 0x00, 0x00, 0x5b, 0xcb, 0x53, 0x89, 0xc3, 0xb4, 0x68, 0xf8,
-  0xcd, 0x21, 0x9a, 0x40, 0x4a, 0x00, 0x00, 0x90, 0x5b, 0xcb, 0x53, 0x51,
-  0x89, 0xc1, 0x89, 0xd0, 0x83, 0xfa, 0xff, 0x74, 0x0b, 0x81, 0xf9, 0xe3,
-  0x0d, 0x75, 0x08, 0x0e, 0x3e, 0xe8, 0xaf, 0xef, 0x59, 0x5b, 0xcb, 0x89,
-  0xca, 0x31, 0xdb, 0x0e, 0x3e, 0xe8, 0x46, 0xee, 0x59, 0x5b, 0xcb, 0x51,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc1, 0x89, 0xd6,
-  0x89, 0xdf, 0x80, 0x66, 0xfe, 0xfe, 0x8d, 0x56, 0xfc, 0x16, 0x89, 0xfb,
-  0x89, 0xc8, 0x52, 0x89, 0xf2, 0x0e, 0x3e, 0xe8, 0x2e, 0xf3, 0x85, 0xc0,
-  0x74, 0x1a, 0x3d, 0x01, 0x00, 0x74, 0x0b, 0x3d, 0x02, 0x00, 0x75, 0xe2,
-  0xf6, 0x46, 0xfe, 0x01, 0x74, 0x0e, 0xb8, 0xff, 0xff, 0x89, 0xec, 0x5d,
-  0x5f, 0x5e, 0x59, 0xcb, 0x89, 0xf0, 0xeb, 0xf5, 0x8b, 0x56, 0xfc, 0x89,
-  0xc8, 0x0e, 0x3e, 0xe8, 0x51, 0xf0, 0x85, 0xc0, 0x74, 0xe4, 0x80, 0x4e,
-  0xfe, 0x01, 0xeb, 0xba, 0x52, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0x03, 0x06,
-  0x64, 0x10, 0x0e, 0xe8, 0x02, 0x00, 0x5a, 0xcb, 0x53, 0x51, 0x52, 0x89,
-  0xc2, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x3b, 0x16, 0x6e, 0x10, 0x72, 0x48,
-  0x89, 0xd3, 0xb1, 0x04, 0x83, 0xc3, 0x0f, 0xd3, 0xeb, 0x85, 0xdb, 0x75,
-  0x03, 0xbb, 0x00, 0x10, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x80, 0x3e, 0x6a,
-  0x10, 0x00, 0x75, 0x10, 0xb9, 0xe3, 0x0d, 0x8c, 0xd0, 0x8e, 0xd9, 0x2b,
-  0x06, 0x66, 0x10, 0x01, 0xc3, 0xa1, 0x66, 0x10, 0x8e, 0xc0, 0xb4, 0x4a,
-  0xcd, 0x21, 0x1b, 0xc0, 0x85, 0xc0, 0x75, 0x10, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xd8, 0xa1, 0x64, 0x10, 0x89, 0x16, 0x64, 0x10, 0x5a, 0x59, 0x5b, 0xcb,
-  0x0e, 0xe8, 0x8b, 0xf4, 0x90, 0x89, 0xc3, 0x8e, 0xda, 0xb8, 0xff, 0xff,
-  0xc7, 0x07, 0x05, 0x00, 0xeb, 0xea, 0x53, 0x51, 0x52, 0x89, 0xc3, 0xb8,
-  0x00, 0x44, 0xcd, 0x21, 0x19, 0xc9, 0xf6, 0xc2, 0x80, 0x74, 0x07, 0xb8,
-  0x01, 0x00, 0x5a, 0x59, 0x5b, 0xcb, 0x31, 0xc0, 0xeb, 0xf8, 0x51, 0x57,
-  0x89, 0xd1, 0x89, 0xc7, 0xba, 0xe3, 0x0d, 0x81, 0xc7, 0xa4, 0x15, 0x29,
-  0xc1, 0xb0, 0x01, 0x41, 0x47, 0x8e, 0xc2, 0x57, 0xf3, 0xaa, 0x5f, 0x5f,
-  0x59, 0xc3, 0x51, 0x52, 0x57, 0xba, 0xe3, 0x0d, 0xb9, 0x01, 0x01, 0x31,
-  0xc0, 0x8e, 0xda, 0xbf, 0xa4, 0x15, 0xa3, 0xa2, 0x15, 0xa3, 0xec, 0x10,
-  0x8e, 0xc2, 0x30, 0xc0, 0x57, 0xf3, 0xaa, 0x5f, 0x5f, 0x5a, 0x59, 0xc3,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x3d, 0xff, 0xff, 0x74, 0x48, 0x3d, 0xfe,
-  0xff, 0x74, 0x43, 0x3d, 0xfd, 0xff, 0x75, 0x06, 0xe8, 0xc7, 0xff, 0xe9,
-  0xb9, 0x00, 0x3d, 0xfc, 0xff, 0x75, 0x29, 0xe8, 0xbc, 0xff, 0xba, 0x9f,
-  0x00, 0xb8, 0x81, 0x00, 0xe8, 0x97, 0xff, 0xba, 0xfc, 0x00, 0xb8, 0xe0,
-  0x00, 0xe8, 0x8e, 0xff, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xc7, 0x06, 0xa2,
-  0x15, 0x01, 0x00, 0xc7, 0x06, 0xec, 0x10, 0xa4, 0x03, 0xe9, 0x8b, 0x00,
-  0x85, 0xc0, 0x74, 0x06, 0xb8, 0x01, 0x00, 0xe9, 0x83, 0x00, 0x1e, 0x33,
-  0xc0, 0x8e, 0xd8, 0xb4, 0x63, 0xcd, 0x21, 0x8c, 0xdf, 0x73, 0x02, 0x33,
-  0xff, 0x85, 0xff, 0x75, 0x02, 0x8b, 0xf7, 0x1f, 0x89, 0xf3, 0x89, 0xfa,
-  0x85, 0xff, 0x75, 0x04, 0x85, 0xf6, 0x74, 0x5f, 0xe8, 0x67, 0xff, 0x8e,
-  0xdf, 0x83, 0x3c, 0x00, 0x74, 0x0b, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xc7,
-  0x06, 0xa2, 0x15, 0x01, 0x00, 0x89, 0xd6, 0x8e, 0xde, 0x83, 0x3f, 0x00,
-  0x74, 0x10, 0x8a, 0x57, 0x01, 0x8a, 0x07, 0x30, 0xf6, 0x30, 0xe4, 0xe8,
-  0x24, 0xff, 0x43, 0x43, 0xeb, 0xe9, 0x1e, 0x55, 0x8b, 0xec, 0x83, 0xec,
-  0x08, 0x33, 0xc0, 0x8e, 0xd8, 0xb8, 0x01, 0x65, 0xbb, 0xff, 0xff, 0xb9,
-  0x07, 0x00, 0xba, 0xff, 0xff, 0x8d, 0x7e, 0xf8, 0x16, 0x07, 0xcd, 0x21,
-  0x8b, 0x46, 0xfd, 0x73, 0x02, 0x33, 0xc0, 0x8b, 0xe5, 0x5d, 0x1f, 0xba,
-  0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0xec, 0x10, 0x31, 0xc0, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0xcb, 0x00, 0x73, 0x09, 0x50, 0x0e, 0x3e, 0xe8, 0xfb, 0xfc,
-  0x58, 0xeb, 0x02, 0x2b, 0xc0, 0xcb, 0x00, 0x00, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x83, 0xec, 0x08, 0x36, 0x80, 0x3e, 0xd0, 0x0c,
-  0x00, 0x75, 0x45, 0x36, 0xc6, 0x06, 0xd0, 0x0c, 0x01, 0x36, 0x80, 0x3e,
-  0x0d, 0x0e, 0x00, 0x7d, 0x05, 0x0e, 0x3e, 0xe8, 0x9c, 0x46, 0x36, 0x80,
-  0x3e, 0x0d, 0x0e, 0x04, 0x7d, 0x11, 0x36, 0xc7, 0x06, 0xe8, 0x0c, 0x82,
-  0x02, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0x31, 0xc0, 0xe9, 0xba, 0x01, 0x36,
-  0xa0, 0x14, 0x0e, 0xa8, 0x01, 0x75, 0x14, 0x36, 0xc7, 0x06, 0xe8, 0x0c,
-  0xa5, 0x02, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0x31, 0xc0, 0xe9, 0xa1, 0x01,
-  0xe9, 0x98, 0x01, 0xa8, 0x04, 0x74, 0x11, 0x36, 0xa1, 0xde, 0x0d, 0x36,
-  0x8b, 0x16, 0xdc, 0x0d, 0x85, 0xc0, 0x75, 0x09, 0x85, 0xd2, 0x75, 0x05,
-  0x0e, 0xe8, 0xbc, 0x42, 0x36, 0x0e, 0x3e, 0xe8, 0xe8, 0x2f, 0x0e, 0xe8,
-  0xee, 0x30, 0x36, 0x0e, 0x3e, 0xe8, 0xea, 0x37, 0x36, 0x80, 0x3e, 0x2c,
-  0x0d, 0x00, 0x74, 0x18, 0x36, 0xc7, 0x06, 0xe8, 0x0c, 0xb4, 0x02, 0x36,
-  0x8c, 0x16, 0xea, 0x0c, 0x31, 0xc0, 0x8d, 0x66, 0xf8, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x36, 0xf6, 0x06, 0x14, 0x0e, 0x08, 0x74, 0x20,
-  0x36, 0x80, 0x3e, 0x2f, 0x0d, 0x00, 0x75, 0x18, 0x36, 0xc7, 0x06, 0xe8,
-  0x0c, 0xdd, 0x02, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0x31, 0xc0, 0x8d, 0x66,
-  0xf8, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x31, 0xc0, 0x36, 0xa3,
-  0xe6, 0x0c, 0xb8, 0xff, 0xff, 0x36, 0xc7, 0x06, 0xe4, 0x0c, 0x0f, 0x00,
-  0x36, 0xa3, 0xe2, 0x0c, 0x36, 0xa3, 0xe0, 0x0c, 0x36, 0xa1, 0xde, 0x0d,
-  0x36, 0x8b, 0x1e, 0xdc, 0x0d, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74,
-  0x20, 0x8e, 0xd8, 0xf6, 0x47, 0x45, 0x20, 0x74, 0x18, 0x31, 0xc0, 0x36,
-  0xa3, 0xe6, 0x0c, 0xb8, 0xff, 0xff, 0x36, 0xc7, 0x06, 0xe4, 0x0c, 0xff,
-  0x00, 0x36, 0xa3, 0xe2, 0x0c, 0x36, 0xa3, 0xe0, 0x0c, 0x36, 0xa1, 0xe6,
-  0x0c, 0x36, 0x8b, 0x16, 0xe4, 0x0c, 0x36, 0x8b, 0x1e, 0xe2, 0x0c, 0x36,
-  0x8b, 0x0e, 0xe0, 0x0c, 0x36, 0xa3, 0xde, 0x0c, 0x36, 0x89, 0x16, 0xdc,
-  0x0c, 0x36, 0x89, 0x1e, 0xda, 0x0c, 0x36, 0x89, 0x0e, 0xd8, 0x0c, 0x36,
-  0xa1, 0xde, 0x0d, 0x36, 0x8b, 0x1e, 0xdc, 0x0d, 0x85, 0xc0, 0x75, 0x04,
-  0x85, 0xdb, 0x74, 0x59, 0x8e, 0xd8, 0x8b, 0x47, 0x34, 0x3d, 0x00, 0x80,
-  0x77, 0x08, 0x75, 0x4d, 0x83, 0x7f, 0x32, 0x08, 0x72, 0x47, 0x8a, 0x47,
-  0x6a, 0x3c, 0x20, 0x73, 0x02, 0xb0, 0x20, 0x30, 0xe4, 0xba, 0x01, 0x00,
-  0x89, 0x46, 0xf0, 0x30, 0xc0, 0x31, 0xdb, 0x89, 0x46, 0xf2, 0x89, 0x46,
-  0xf4, 0x89, 0x46, 0xf6, 0x31, 0xc9, 0x8b, 0x76, 0xf0, 0x0e, 0x3e, 0xe8,
-  0x52, 0xcc, 0x83, 0xea, 0x01, 0x36, 0x89, 0x16, 0xd8, 0x0c, 0x83, 0xd9,
-  0x00, 0x36, 0x89, 0x0e, 0xda, 0x0c, 0x83, 0xdb, 0x00, 0x1d, 0x00, 0x00,
-  0x36, 0x89, 0x1e, 0xdc, 0x0c, 0x36, 0xa3, 0xde, 0x0c, 0x36, 0xf6, 0x06,
-  0x05, 0x0e, 0x08, 0x74, 0x0e, 0x36, 0xf6, 0x06, 0x07, 0x0e, 0x02, 0x74,
-  0x06, 0x36, 0xc6, 0x06, 0xd1, 0x0c, 0x01, 0x36, 0xf6, 0x06, 0x05, 0x0e,
-  0x40, 0x74, 0x06, 0x36, 0xc6, 0x06, 0xd2, 0x0c, 0x01, 0x36, 0x80, 0x3e,
-  0xd1, 0x0c, 0x00, 0x75, 0x08, 0x36, 0x80, 0x3e, 0xd2, 0x0c, 0x00, 0x74,
-  0x08, 0x36, 0xc6, 0x06, 0xd3, 0x0c, 0x01, 0xeb, 0x12, 0x36, 0xc7, 0x06,
-  0xe8, 0x0c, 0x38, 0x03, 0x36, 0xc6, 0x06, 0xd3, 0x0c, 0x00, 0x36, 0x8c,
-  0x16, 0xea, 0x0c, 0x36, 0xa0, 0xd3, 0x0c, 0x30, 0xe4, 0x8d, 0x66, 0xf8,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x56, 0x57, 0x83, 0xec, 0x06, 0x89, 0xc7, 0x36, 0xf6, 0x06, 0x14, 0x0e,
-  0x08, 0x74, 0x5c, 0x89, 0xd3, 0x31, 0xd2, 0xb1, 0x04, 0xd3, 0xe2, 0xd3,
-  0xc3, 0x31, 0xda, 0x81, 0xe3, 0xf0, 0xff, 0x31, 0xda, 0x89, 0xde, 0x31,
-  0xc0, 0x01, 0xfe, 0x11, 0xc2, 0x36, 0x80, 0x3e, 0x2f, 0x0d, 0x00, 0x74,
-  0x2f, 0x89, 0xf3, 0xb1, 0x0c, 0xd3, 0xeb, 0xd3, 0xca, 0x31, 0xd3, 0x81,
-  0xe2, 0x0f, 0x00, 0x31, 0xd3, 0x89, 0xd8, 0x0e, 0x3e, 0xe8, 0xc0, 0x35,
-  0x83, 0xfa, 0xff, 0x75, 0x05, 0x3d, 0xff, 0xff, 0x74, 0x0e, 0x31, 0xdb,
-  0x81, 0xe6, 0xff, 0x0f, 0x01, 0xc6, 0x11, 0xda, 0x31, 0xc0, 0xeb, 0x37,
-  0xb8, 0xff, 0xff, 0x89, 0xc3, 0x89, 0xc2, 0x89, 0xc6, 0xeb, 0x2c, 0xbe,
-  0x04, 0x00, 0xc7, 0x46, 0xf6, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xdb, 0x31,
-  0xc9, 0xc7, 0x46, 0xf8, 0x00, 0x00, 0x0e, 0xe8, 0x4e, 0xcb, 0x90, 0x89,
-  0xd6, 0xc7, 0x46, 0xfa, 0x00, 0x00, 0x01, 0xfe, 0x8b, 0x56, 0xf6, 0x11,
-  0xca, 0x13, 0x5e, 0xf8, 0x13, 0x46, 0xfa, 0x89, 0xd1, 0x89, 0xf2, 0x8d,
-  0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xcb, 0xfc, 0x36, 0xf6, 0x06, 0x14,
-  0x0e, 0x08, 0x74, 0x06, 0xb8, 0x00, 0x10, 0x31, 0xd2, 0xcb, 0xba, 0x10,
-  0x00, 0x31, 0xc0, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x52, 0x36, 0x8b, 0x16,
-  0xee, 0x0c, 0x36, 0xa1, 0xec, 0x0c, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0,
-  0x74, 0x24, 0x36, 0xa1, 0xf0, 0x0c, 0x36, 0x8b, 0x16, 0xf2, 0x0c, 0x0e,
-  0x3e, 0xe8, 0x04, 0xcb, 0x31, 0xc0, 0x36, 0xa3, 0xf4, 0x0c, 0x36, 0xa3,
-  0xf0, 0x0c, 0x36, 0xa3, 0xf2, 0x0c, 0x36, 0xa3, 0xec, 0x0c, 0x36, 0xa3,
-  0xee, 0x0c, 0x36, 0x8b, 0x16, 0xfa, 0x0c, 0x36, 0xa1, 0xf8, 0x0c, 0x85,
-  0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x0f, 0x0e, 0x3e, 0xe8, 0xd8, 0xca,
-  0x31, 0xc0, 0x36, 0xa3, 0xf8, 0x0c, 0x36, 0xa3, 0xfa, 0x0c, 0x5a, 0x5d,
-  0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x89, 0xc3, 0x88, 0xd5,
-  0x85, 0xc0, 0x74, 0x22, 0x36, 0x8b, 0x16, 0xee, 0x0c, 0x36, 0xa1, 0xec,
-  0x0c, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x13, 0x36, 0x3b, 0x1e,
-  0xf4, 0x0c, 0x77, 0x0c, 0x36, 0x3a, 0x2e, 0xf6, 0x0c, 0x75, 0x05, 0xb8,
-  0x01, 0x00, 0xeb, 0x63, 0x81, 0xc3, 0xff, 0x0f, 0x81, 0xe3, 0x00, 0xf0,
-  0x0e, 0xe8, 0x64, 0xff, 0x89, 0xd8, 0x05, 0x20, 0x10, 0x36, 0x89, 0x1e,
-  0xf4, 0x0c, 0x0e, 0xe8, 0xc4, 0xca, 0x90, 0x36, 0xa3, 0xf0, 0x0c, 0x36,
-  0x89, 0x16, 0xf2, 0x0c, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x1c,
-  0xb1, 0x04, 0xd3, 0xe8, 0x01, 0xc2, 0x36, 0x88, 0x2e, 0xf6, 0x0c, 0x81,
-  0xc2, 0xff, 0x00, 0x31, 0xc0, 0x30, 0xd2, 0x36, 0xa3, 0xec, 0x0c, 0x36,
-  0x89, 0x16, 0xee, 0x0c, 0x36, 0x8b, 0x16, 0xee, 0x0c, 0x36, 0xa1, 0xec,
-  0x0c, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x08, 0xb8, 0x01, 0x00,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x31, 0xc0, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x72, 0x50, 0x53, 0x51,
-  0x52, 0x8b, 0x46, 0x0e, 0x36, 0x80, 0x3e, 0xd3, 0x0c, 0x00, 0x75, 0x03,
-  0xe9, 0x8a, 0x1c, 0x85, 0xc0, 0x74, 0xf9, 0x83, 0x7e, 0x88, 0xff, 0x75,
-  0x0f, 0x83, 0xfb, 0xff, 0x75, 0x0a, 0x83, 0xf9, 0xff, 0x75, 0x05, 0x83,
-  0xfa, 0xff, 0x74, 0xe4, 0x83, 0x7e, 0x0c, 0xff, 0x75, 0x12, 0x83, 0x7e,
-  0x0a, 0xff, 0x75, 0x0c, 0x83, 0x7e, 0x08, 0xff, 0x75, 0x06, 0x83, 0x7e,
-  0x06, 0xff, 0x74, 0xcc, 0x8b, 0x56, 0x88, 0x36, 0x3b, 0x16, 0xde, 0x0c,
-  0x77, 0xc2, 0x75, 0x2e, 0x89, 0xda, 0x36, 0x3b, 0x16, 0xdc, 0x0c, 0x77,
-  0xb7, 0x89, 0xda, 0x36, 0x3b, 0x16, 0xdc, 0x0c, 0x75, 0x1c, 0x89, 0xca,
-  0x36, 0x3b, 0x16, 0xda, 0x0c, 0x77, 0xa5, 0x89, 0xca, 0x36, 0x3b, 0x16,
-  0xda, 0x0c, 0x75, 0x0a, 0x8b, 0x56, 0x82, 0x36, 0x3b, 0x16, 0xd8, 0x0c,
-  0x77, 0x92, 0x8b, 0x5e, 0x82, 0x31, 0xd2, 0x31, 0xc9, 0x31, 0xff, 0x01,
-  0xc3, 0x89, 0x5e, 0xc8, 0x8b, 0x5e, 0x84, 0x11, 0xd3, 0x8b, 0x76, 0x86,
-  0x11, 0xd6, 0x89, 0x76, 0xca, 0x8b, 0x76, 0x88, 0x11, 0xd6, 0x36, 0x3b,
-  0x36, 0xde, 0x0c, 0x76, 0x03, 0xe9, 0xf5, 0x1b, 0x75, 0x27, 0x8b, 0x76,
-  0xca, 0x36, 0x3b, 0x36, 0xdc, 0x0c, 0x77, 0xf1, 0x8b, 0x76, 0xca, 0x36,
-  0x3b, 0x36, 0xdc, 0x0c, 0x75, 0x13, 0x36, 0x3b, 0x1e, 0xda, 0x0c, 0x77,
-  0xe0, 0x75, 0x0a, 0x8b, 0x5e, 0xc8, 0x36, 0x3b, 0x1e, 0xd8, 0x0c, 0x77,
-  0xd4, 0x8b, 0x5e, 0x0c, 0x36, 0x3b, 0x1e, 0xde, 0x0c, 0x77, 0xca, 0x75,
-  0x32, 0x8b, 0x5e, 0x0a, 0x36, 0x3b, 0x1e, 0xdc, 0x0c, 0x77, 0xbe, 0x8b,
-  0x5e, 0x0a, 0x36, 0x3b, 0x1e, 0xdc, 0x0c, 0x75, 0x1e, 0x8b, 0x5e, 0x08,
-  0x36, 0x3b, 0x1e, 0xda, 0x0c, 0x77, 0xaa, 0x8b, 0x5e, 0x08, 0x36, 0x3b,
-  0x1e, 0xda, 0x0c, 0x75, 0x0a, 0x8b, 0x5e, 0x06, 0x36, 0x3b, 0x1e, 0xd8,
-  0x0c, 0x77, 0x96, 0x8b, 0x76, 0x06, 0x01, 0xc6, 0x13, 0x56, 0x08, 0x13,
-  0x4e, 0x0a, 0x8b, 0x5e, 0x0c, 0x11, 0xfb, 0x36, 0x3b, 0x1e, 0xde, 0x0c,
-  0x77, 0x4b, 0x75, 0x19, 0x36, 0x3b, 0x0e, 0xdc, 0x0c, 0x77, 0x42, 0x75,
-  0x10, 0x36, 0x3b, 0x16, 0xda, 0x0c, 0x77, 0x39, 0x75, 0x07, 0x36, 0x3b,
-  0x36, 0xd8, 0x0c, 0x77, 0x30, 0x36, 0xf6, 0x06, 0x14, 0x0e, 0x08, 0x74,
-  0x2b, 0x8b, 0x76, 0x06, 0x8b, 0x4e, 0x08, 0x8b, 0x5e, 0x0a, 0x8b, 0x56,
-  0x0c, 0x0b, 0x76, 0x82, 0x0b, 0x4e, 0x84, 0x0b, 0x56, 0x88, 0x0b, 0x5e,
-  0x86, 0x83, 0xfa, 0x10, 0x72, 0x11, 0x75, 0x06, 0x85, 0xdb, 0x75, 0x02,
-  0x85, 0xc9, 0xe9, 0xf8, 0x07, 0xe9, 0x29, 0x1b, 0xe9, 0x04, 0x0e, 0x36,
-  0x80, 0x3e, 0xd2, 0x0c, 0x00, 0x74, 0xef, 0x8b, 0x56, 0x0c, 0x3b, 0x56,
-  0x88, 0x77, 0x2a, 0x75, 0x36, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77,
-  0x20, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75, 0x26, 0x8b, 0x56, 0x08,
-  0x3b, 0x56, 0x84, 0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75,
-  0x16, 0x8b, 0x56, 0x06, 0x3b, 0x56, 0x82, 0x76, 0x0e, 0x8b, 0x4e, 0x0c,
-  0x8b, 0x76, 0x0a, 0x8b, 0x5e, 0x08, 0x8b, 0x56, 0x06, 0xeb, 0x0c, 0x8b,
-  0x4e, 0x88, 0x8b, 0x76, 0x86, 0x8b, 0x5e, 0x84, 0x8b, 0x56, 0x82, 0x31,
-  0xff, 0x29, 0xd7, 0x89, 0x7e, 0xdc, 0xba, 0x00, 0x00, 0x19, 0xda, 0xbb,
-  0x00, 0x00, 0x19, 0xf3, 0x89, 0xde, 0xbb, 0x10, 0x00, 0x19, 0xcb, 0x75,
-  0x4a, 0x85, 0xf6, 0x75, 0x46, 0x81, 0xfa, 0x00, 0x01, 0x73, 0x62, 0x8b,
-  0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77, 0x2a, 0x75, 0x38, 0x8b, 0x56, 0x0a,
-  0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75,
-  0x28, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x77, 0x10, 0x8b, 0x56, 0x08,
-  0x3b, 0x56, 0x84, 0x75, 0x18, 0x8b, 0x56, 0x06, 0x3b, 0x56, 0x82, 0x76,
-  0x10, 0x8b, 0x76, 0x0c, 0x8b, 0x4e, 0x0a, 0x8b, 0x56, 0x08, 0x8b, 0x5e,
-  0x06, 0xeb, 0x0e, 0xeb, 0x20, 0x8b, 0x76, 0x88, 0x8b, 0x4e, 0x86, 0x8b,
-  0x56, 0x84, 0x8b, 0x5e, 0x82, 0x31, 0xff, 0x29, 0xdf, 0x89, 0xfb, 0xbf,
-  0x00, 0x00, 0x19, 0xd7, 0x89, 0xfa, 0xbe, 0x00, 0x00, 0x19, 0xce, 0xeb,
-  0x05, 0xba, 0x00, 0x01, 0x31, 0xdb, 0x89, 0x5e, 0xb2, 0x89, 0x56, 0xc6,
-  0x85, 0xd2, 0x77, 0x06, 0x75, 0x0c, 0x39, 0xc3, 0x76, 0x08, 0xc7, 0x46,
-  0xc6, 0x00, 0x00, 0x89, 0x46, 0xb2, 0x8b, 0x46, 0xc6, 0x3d, 0x20, 0x00,
-  0x77, 0x08, 0x75, 0x10, 0x83, 0x7e, 0xb2, 0x00, 0x76, 0x0a, 0xc7, 0x46,
-  0xb2, 0x00, 0x00, 0xc7, 0x46, 0xc6, 0x20, 0x00, 0x36, 0xa1, 0xee, 0x0c,
-  0x36, 0x8b, 0x16, 0xec, 0x0c, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xd2, 0x74,
-  0x08, 0x36, 0x80, 0x3e, 0xf6, 0x0c, 0x05, 0x74, 0x1d, 0xba, 0x05, 0x00,
-  0xb8, 0x00, 0x90, 0x0e, 0xe8, 0xb3, 0xfc, 0x85, 0xc0, 0x75, 0x12, 0x36,
-  0xc7, 0x06, 0xe8, 0x0c, 0x67, 0x03, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0xe9,
-  0xe1, 0x19, 0xe9, 0xb6, 0x02, 0x36, 0xc5, 0x1e, 0xec, 0x0c, 0x31, 0xd2,
-  0x8c, 0xd8, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0xf0, 0xff, 0x31, 0xc2, 0x31, 0xc9, 0x01, 0xd8, 0x89, 0x46, 0x8a, 0x11,
-  0xca, 0x89, 0x56, 0x8c, 0x80, 0xc7, 0x70, 0x8b, 0x56, 0x8a, 0x81, 0xc2,
-  0x00, 0x80, 0x8b, 0x46, 0x8c, 0xbe, 0x01, 0x00, 0x11, 0xc8, 0xbf, 0x40,
-  0x00, 0x89, 0x47, 0x02, 0x83, 0xc3, 0x04, 0x31, 0xc0, 0x80, 0xca, 0x01,
-  0x89, 0x57, 0xfc, 0x31, 0xd2, 0x89, 0xd1, 0x83, 0xc3, 0x04, 0x89, 0x7f,
-  0xfe, 0x80, 0xc9, 0x87, 0x83, 0xc2, 0x00, 0x83, 0xd7, 0x40, 0x83, 0xc6,
-  0x01, 0x15, 0x00, 0x00, 0x89, 0x4f, 0xfc, 0x85, 0xc0, 0x77, 0x08, 0x75,
-  0xe0, 0x81, 0xfe, 0x00, 0x04, 0x72, 0xda, 0x36, 0xc5, 0x1e, 0xec, 0x0c,
-  0x31, 0xd2, 0x8c, 0xd8, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8,
-  0x89, 0x46, 0x8a, 0x11, 0xd1, 0x89, 0x4e, 0x8c, 0xb1, 0x03, 0x89, 0x5e,
-  0xd8, 0x8c, 0x5e, 0xc4, 0x31, 0xf6, 0xd3, 0xe2, 0x31, 0xc0, 0x01, 0xd3,
-  0x31, 0xc9, 0x31, 0xd2, 0x8b, 0x7e, 0x8a, 0x89, 0x7e, 0xe2, 0x8b, 0x7e,
-  0x8c, 0xc7, 0x46, 0xfa, 0x00, 0x00, 0x89, 0x7e, 0xdc, 0x8b, 0x7e, 0xe2,
-  0xc7, 0x46, 0xe4, 0x00, 0x00, 0x81, 0xc7, 0x00, 0x10, 0x89, 0x7e, 0xe6,
-  0x8b, 0x7e, 0xdc, 0x83, 0xd7, 0x00, 0x89, 0x7e, 0xe2, 0x8b, 0x7e, 0xfa,
-  0x83, 0xd7, 0x00, 0x89, 0x7e, 0xc8, 0x8b, 0x7e, 0xe4, 0x83, 0xd7, 0x00,
-  0xc7, 0x46, 0xe4, 0x00, 0x00, 0x89, 0x7e, 0xdc, 0x8b, 0x7e, 0xe6, 0xc7,
-  0x46, 0xe6, 0x00, 0x00, 0x01, 0xd7, 0x89, 0x7e, 0xca, 0x8b, 0x7e, 0xe2,
-  0x11, 0xcf, 0x89, 0x7e, 0xe2, 0x8b, 0x7e, 0xc8, 0x13, 0x7e, 0xe4, 0x89,
-  0x7e, 0xe4, 0x8b, 0x7e, 0xdc, 0x13, 0x7e, 0xe6, 0x89, 0x7e, 0xe6, 0x8b,
-  0x7e, 0xca, 0x83, 0xcf, 0x01, 0x89, 0x7e, 0xfa, 0x8b, 0x7e, 0xe2, 0x89,
-  0x7e, 0xca, 0x8b, 0x7e, 0xe4, 0x89, 0x7e, 0xc8, 0x8b, 0x7e, 0xe6, 0x83,
-  0xc3, 0x08, 0x89, 0x7f, 0xfe, 0x8b, 0x7e, 0xc8, 0x89, 0x7f, 0xfc, 0x8b,
-  0x7e, 0xca, 0x81, 0xc2, 0x00, 0x10, 0x83, 0xd1, 0x00, 0x89, 0x7f, 0xfa,
-  0x8b, 0x7e, 0xfa, 0x83, 0xc6, 0x01, 0x15, 0x00, 0x00, 0x89, 0x7f, 0xf8,
-  0x85, 0xc0, 0x77, 0x0a, 0x74, 0x03, 0xe9, 0x53, 0xff, 0x83, 0xfe, 0x04,
-  0x72, 0xf8, 0xb1, 0x03, 0x89, 0xf2, 0x8b, 0x5e, 0xd8, 0xd3, 0xe2, 0x8e,
-  0x5e, 0xc4, 0x01, 0xd3, 0x85, 0xc0, 0x77, 0x26, 0x75, 0x06, 0x81, 0xfe,
-  0x00, 0x02, 0x73, 0x1e, 0xc7, 0x47, 0x06, 0x00, 0x00, 0xc7, 0x47, 0x04,
-  0x00, 0x00, 0xc7, 0x47, 0x02, 0x00, 0x00, 0xc7, 0x07, 0x00, 0x00, 0x83,
-  0xc3, 0x08, 0x83, 0xc6, 0x01, 0x15, 0x00, 0x00, 0xeb, 0xd6, 0x31, 0xc0,
-  0xb1, 0x0c, 0x89, 0x46, 0xda, 0x89, 0x46, 0xb6, 0x89, 0x46, 0xf0, 0x89,
-  0x46, 0xf2, 0xd3, 0xe0, 0x89, 0x46, 0xf4, 0xeb, 0x27, 0x83, 0x46, 0xf0,
-  0x00, 0x81, 0x56, 0xf2, 0x00, 0x40, 0x80, 0x46, 0xf5, 0x10, 0x83, 0x46,
-  0xda, 0x01, 0x83, 0x56, 0xb6, 0x00, 0x8b, 0x46, 0xb6, 0x85, 0xc0, 0x76,
-  0x03, 0xe9, 0x86, 0x00, 0x75, 0x06, 0x83, 0x7e, 0xda, 0x04, 0x73, 0xf5,
-  0x8b, 0x5e, 0xf4, 0x8b, 0x56, 0xf0, 0xb1, 0x03, 0x36, 0xa1, 0xec, 0x0c,
-  0x31, 0xf6, 0x36, 0x8e, 0x1e, 0xee, 0x0c, 0x89, 0x56, 0xe8, 0x8b, 0x56,
-  0xf2, 0x80, 0xc4, 0x10, 0x89, 0x56, 0xb8, 0x31, 0xd2, 0x01, 0xc3, 0xd3,
-  0xe2, 0x31, 0xc0, 0x01, 0xd3, 0x31, 0xc9, 0x31, 0xd2, 0x8b, 0x7e, 0xe8,
-  0x09, 0xcf, 0x89, 0x7e, 0xc8, 0x8b, 0x7e, 0xb8, 0x83, 0xc3, 0x08, 0x09,
-  0xd7, 0xc7, 0x47, 0xfe, 0x00, 0x00, 0x89, 0x7e, 0xfa, 0x8b, 0x7e, 0xc8,
-  0xc7, 0x47, 0xfc, 0x00, 0x00, 0x81, 0xcf, 0x87, 0x00, 0x89, 0x7e, 0xc8,
-  0x8b, 0x7e, 0xfa, 0x83, 0xc1, 0x00, 0x83, 0xd2, 0x20, 0x89, 0x7f, 0xfa,
-  0x8b, 0x7e, 0xc8, 0x83, 0xc6, 0x01, 0x15, 0x00, 0x00, 0x89, 0x7f, 0xf8,
-  0x85, 0xc0, 0x76, 0x03, 0xe9, 0x66, 0xff, 0x75, 0xb8, 0x81, 0xfe, 0x00,
-  0x02, 0x72, 0xb2, 0xe9, 0x5b, 0xff, 0x36, 0xc5, 0x1e, 0xec, 0x0c, 0x31,
-  0xd2, 0x8c, 0xd8, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81,
-  0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x11,
-  0xca, 0x05, 0x00, 0x50, 0x89, 0x46, 0x8a, 0x83, 0xd2, 0x00, 0x89, 0x56,
-  0x8c, 0x80, 0xc7, 0x10, 0x8b, 0x46, 0x8a, 0x25, 0x00, 0xf0, 0x8b, 0x56,
-  0x8c, 0xc7, 0x47, 0x04, 0x00, 0x00, 0xc7, 0x47, 0x06, 0x00, 0x00, 0x89,
-  0x57, 0x02, 0x0c, 0x01, 0x89, 0x07, 0x8b, 0x46, 0x8a, 0x05, 0x00, 0x10,
-  0x8b, 0x56, 0x8c, 0xc7, 0x47, 0x0c, 0x00, 0x00, 0x83, 0xd2, 0x00, 0xc7,
-  0x47, 0x0e, 0x00, 0x00, 0x89, 0x57, 0x0a, 0x25, 0x00, 0xf0, 0x0c, 0x01,
-  0x89, 0x47, 0x08, 0x36, 0xa1, 0xfa, 0x0c, 0x36, 0x8b, 0x16, 0xf8, 0x0c,
-  0x85, 0xc0, 0x75, 0x27, 0x85, 0xd2, 0x75, 0x23, 0xb8, 0x48, 0x00, 0x0e,
-  0x3e, 0xe8, 0xde, 0xc4, 0x36, 0xa3, 0xf8, 0x0c, 0x36, 0x89, 0x16, 0xfa,
-  0x0c, 0x85, 0xd2, 0x75, 0x0e, 0x85, 0xc0, 0x75, 0x0a, 0x36, 0xc7, 0x06,
-  0xe8, 0x0c, 0xae, 0x03, 0xe9, 0xed, 0x16, 0x66, 0x33, 0xc0, 0x8c, 0xc8,
-  0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x8a, 0xff, 0x66, 0x33, 0xc0,
-  0x8c, 0xd8, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0xa2, 0xff, 0x36,
-  0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x07, 0x00, 0x00, 0xc7, 0x47, 0x02, 0x00,
-  0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x04, 0x00, 0x00, 0xc7,
-  0x47, 0x06, 0x00, 0x00, 0x8b, 0x56, 0x8a, 0x8b, 0x46, 0x8c, 0x36, 0x8b,
-  0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2,
-  0x89, 0x47, 0x0a, 0x83, 0xca, 0xff, 0x89, 0x57, 0x08, 0x8b, 0x46, 0x8a,
-  0x8b, 0x46, 0x8c, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47,
-  0x0e, 0x0f, 0x00, 0x80, 0xcc, 0x9a, 0x89, 0x47, 0x0c, 0x8b, 0x56, 0xa2,
-  0x8b, 0x46, 0xa4, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e,
-  0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x12, 0x83, 0xca, 0xff, 0x89,
-  0x57, 0x10, 0x8b, 0x46, 0xa2, 0x8b, 0x46, 0xa4, 0x36, 0xc5, 0x1e, 0xf8,
-  0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x16, 0x0f, 0x00, 0x80, 0xcc, 0x92, 0x89,
-  0x47, 0x14, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x18, 0xff, 0xff,
-  0xc7, 0x47, 0x1a, 0x00, 0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47,
-  0x1c, 0x00, 0x92, 0xc7, 0x47, 0x1e, 0x8f, 0x00, 0x66, 0x33, 0xc0, 0x8c,
-  0xd0, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0xa2, 0xff, 0x8b, 0x56,
-  0xa2, 0x8b, 0x46, 0xa4, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36,
-  0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x22, 0x83, 0xca, 0xff,
-  0x89, 0x57, 0x20, 0x8b, 0x46, 0xa2, 0x8b, 0x46, 0xa4, 0x36, 0x8b, 0x1e,
-  0xf8, 0x0c, 0x30, 0xe4, 0x31, 0xd2, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x80,
-  0xcc, 0x92, 0x89, 0x47, 0x24, 0x8c, 0xd0, 0xb1, 0x04, 0xd3, 0xe2, 0xd3,
-  0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0xc7, 0x47, 0x26,
-  0x0f, 0x00, 0x89, 0xd3, 0x31, 0xd2, 0x05, 0x08, 0x15, 0x89, 0x46, 0xa2,
-  0x11, 0xd3, 0x89, 0x5e, 0xa4, 0x8b, 0x56, 0xa2, 0x8b, 0x46, 0xa4, 0x36,
-  0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31,
-  0xd2, 0x89, 0x47, 0x42, 0x83, 0xca, 0xff, 0x89, 0x57, 0x40, 0x8b, 0x46,
-  0xa2, 0x8b, 0x46, 0xa4, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7,
-  0x47, 0x46, 0x0f, 0x00, 0x80, 0xcc, 0x89, 0x89, 0x47, 0x44, 0x31, 0xd2,
-  0x36, 0xa1, 0xfa, 0x0c, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89,
-  0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46, 0x8a, 0x11, 0xd1, 0x89, 0x4e,
-  0x8c, 0x36, 0xc7, 0x06, 0x70, 0x14, 0x47, 0x00, 0x8b, 0x46, 0x8a, 0x36,
-  0xa3, 0x72, 0x14, 0x8b, 0x46, 0x8a, 0x8b, 0x46, 0x8c, 0x36, 0xc7, 0x06,
-  0x78, 0x14, 0xff, 0x07, 0x36, 0xc7, 0x06, 0x84, 0x14, 0x28, 0x00, 0x36,
-  0x8b, 0x36, 0xee, 0x0c, 0x36, 0xa3, 0x74, 0x14, 0x36, 0x89, 0x16, 0x76,
-  0x14, 0x36, 0x89, 0x16, 0x7a, 0x14, 0x36, 0x89, 0x16, 0x7c, 0x14, 0x36,
-  0x89, 0x16, 0x7e, 0x14, 0x36, 0x89, 0x16, 0x80, 0x14, 0x36, 0x89, 0x16,
-  0x82, 0x14, 0x89, 0xf0, 0x36, 0x89, 0x16, 0x86, 0x14, 0xb1, 0x04, 0xd3,
-  0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x36,
-  0x8b, 0x1e, 0xec, 0x0c, 0x31, 0xc9, 0x01, 0xd8, 0x89, 0x46, 0x8a, 0x11,
-  0xca, 0x89, 0x56, 0x8c, 0x8e, 0xde, 0x80, 0xc7, 0x40, 0xc7, 0x87, 0xe0,
-  0x0f, 0x87, 0x00, 0x8b, 0x46, 0x08, 0xc7, 0x87, 0xe8, 0x0f, 0x87, 0x00,
-  0x8b, 0x56, 0x0c, 0xc7, 0x87, 0xf0, 0x0f, 0x87, 0x00, 0x24, 0xe0, 0xc7,
-  0x87, 0xf8, 0x0f, 0x87, 0x00, 0x30, 0xf6, 0x89, 0x87, 0xe2, 0x0f, 0x8b,
-  0x46, 0x0a, 0x80, 0xe2, 0x0f, 0x89, 0x87, 0xe4, 0x0f, 0x8b, 0x46, 0x06,
-  0x89, 0x97, 0xe6, 0x0f, 0x01, 0xc8, 0x8b, 0x46, 0x08, 0x15, 0x20, 0x00,
-  0x8b, 0x4e, 0x0a, 0x83, 0xd1, 0x00, 0x8b, 0x56, 0x0c, 0x83, 0xd2, 0x00,
-  0x89, 0x8f, 0xec, 0x0f, 0x30, 0xf6, 0x24, 0xe0, 0x80, 0xe2, 0x0f, 0x89,
-  0x87, 0xea, 0x0f, 0x8b, 0x46, 0x84, 0x89, 0x97, 0xee, 0x0f, 0x8b, 0x56,
-  0x88, 0x24, 0xe0, 0x30, 0xf6, 0x89, 0x87, 0xf2, 0x0f, 0x8b, 0x46, 0x86,
-  0x80, 0xe2, 0x0f, 0x89, 0x87, 0xf4, 0x0f, 0x8b, 0x46, 0x82, 0x89, 0x97,
-  0xf6, 0x0f, 0x05, 0x00, 0x00, 0x8b, 0x4e, 0x84, 0x83, 0xd1, 0x20, 0x8b,
-  0x56, 0x86, 0x83, 0xd2, 0x00, 0x8b, 0x46, 0x88, 0x15, 0x00, 0x00, 0x89,
-  0x97, 0xfc, 0x0f, 0x30, 0xe4, 0x80, 0xe1, 0xe0, 0x24, 0x0f, 0x89, 0x8f,
-  0xfa, 0x0f, 0x89, 0x87, 0xfe, 0x0f, 0x31, 0xd2, 0x36, 0xa1, 0xee, 0x0c,
-  0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff,
-  0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xec, 0x0c, 0x89, 0xc6, 0x31, 0xc9, 0x01,
-  0xde, 0x89, 0x76, 0x8a, 0x89, 0xd6, 0x11, 0xce, 0x89, 0x76, 0x8c, 0x01,
-  0xd8, 0x89, 0x46, 0x8a, 0x11, 0xca, 0x89, 0x56, 0x8c, 0x8b, 0x46, 0x8a,
-  0x05, 0x00, 0x70, 0x36, 0xa3, 0x88, 0x14, 0x8b, 0x46, 0x8c, 0x11, 0xc8,
-  0x36, 0xa3, 0x8a, 0x14, 0x31, 0xd2, 0x8c, 0xd0, 0xb1, 0x04, 0xd3, 0xe2,
-  0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x31, 0xdb,
-  0x05, 0x70, 0x14, 0x89, 0x46, 0x8a, 0x11, 0xda, 0x89, 0x56, 0x8c, 0x8b,
-  0x46, 0x8a, 0x36, 0xa3, 0x8c, 0x14, 0x8b, 0x46, 0x8c, 0x36, 0xa3, 0x8e,
-  0x14, 0x31, 0xd2, 0x8c, 0xd0, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31,
-  0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x89, 0xd3, 0x31, 0xd2, 0x05,
-  0x78, 0x14, 0x89, 0x46, 0x8a, 0x11, 0xd3, 0x89, 0x5e, 0x8c, 0x8b, 0x46,
-  0x8a, 0x36, 0xa3, 0x90, 0x14, 0x8b, 0x46, 0x8c, 0x36, 0xc7, 0x06, 0x96,
-  0x14, 0x40, 0x00, 0x36, 0xa3, 0x92, 0x14, 0x36, 0x89, 0x16, 0x94, 0x14,
-  0x36, 0x89, 0x16, 0x98, 0x14, 0x36, 0x89, 0x16, 0x9a, 0x14, 0x36, 0xc7,
-  0x06, 0x9c, 0x14, 0x08, 0x00, 0x8b, 0x46, 0x08, 0x36, 0x89, 0x16, 0x9e,
-  0x14, 0x30, 0xe4, 0x8b, 0x56, 0x06, 0x24, 0x1f, 0x83, 0xc2, 0x00, 0x89,
-  0x56, 0x8a, 0x15, 0x80, 0xff, 0x89, 0x46, 0x8c, 0x8b, 0x46, 0x84, 0x30,
-  0xe4, 0x8b, 0x56, 0x82, 0x24, 0x1f, 0x83, 0xc2, 0x00, 0x89, 0x56, 0xa2,
-  0x15, 0xc0, 0xff, 0x89, 0x46, 0xa4, 0xff, 0x76, 0xc6, 0x8b, 0x46, 0x8a,
-  0xff, 0x76, 0xb2, 0x8b, 0x56, 0x8c, 0x52, 0x50, 0x8b, 0x46, 0xa2, 0x8b,
-  0x56, 0xa4, 0x52, 0x50, 0x8c, 0xd0, 0x8e, 0xd8, 0x0e, 0xe8, 0xb5, 0x15,
-  0x90, 0x8b, 0x46, 0xb2, 0x83, 0xc4, 0x0c, 0x8d, 0x66, 0xfc, 0x5f, 0x5e,
-  0x5d, 0x4d, 0xca, 0x0a, 0x00, 0x8b, 0x76, 0x06, 0x8b, 0x56, 0x08, 0x8b,
-  0x4e, 0x0a, 0x8b, 0x5e, 0x0c, 0x0b, 0x76, 0x82, 0x0b, 0x56, 0x84, 0x0b,
-  0x4e, 0x86, 0x0b, 0x5e, 0x88, 0x75, 0x09, 0x83, 0xf9, 0x10, 0x72, 0x07,
-  0x75, 0x02, 0x85, 0xd2, 0xe9, 0x02, 0x13, 0x36, 0x80, 0x3e, 0xd1, 0x0c,
-  0x00, 0x74, 0xf5, 0x8b, 0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77, 0x2a, 0x75,
-  0x36, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b, 0x56, 0x0a,
-  0x3b, 0x56, 0x86, 0x75, 0x26, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x77,
-  0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75, 0x16, 0x8b, 0x56, 0x06,
-  0x3b, 0x56, 0x82, 0x76, 0x0e, 0x8b, 0x4e, 0x0c, 0x8b, 0x5e, 0x0a, 0x8b,
-  0x56, 0x08, 0x8b, 0x76, 0x06, 0xeb, 0x0c, 0x8b, 0x4e, 0x88, 0x8b, 0x5e,
-  0x86, 0x8b, 0x56, 0x84, 0x8b, 0x76, 0x82, 0x31, 0xff, 0x29, 0xf7, 0x89,
-  0x7e, 0xfa, 0xbe, 0x00, 0x00, 0x19, 0xd6, 0xba, 0x10, 0x00, 0x19, 0xda,
-  0x89, 0xd3, 0xba, 0x00, 0x00, 0x19, 0xca, 0x75, 0x4a, 0x85, 0xdb, 0x75,
-  0x46, 0x81, 0xfe, 0x00, 0x01, 0x73, 0x62, 0x8b, 0x56, 0x0c, 0x3b, 0x56,
-  0x88, 0x77, 0x2a, 0x75, 0x38, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77,
-  0x20, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75, 0x28, 0x8b, 0x56, 0x08,
-  0x3b, 0x56, 0x84, 0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75,
-  0x18, 0x8b, 0x56, 0x06, 0x3b, 0x56, 0x82, 0x76, 0x10, 0x8b, 0x76, 0x0c,
-  0x8b, 0x4e, 0x0a, 0x8b, 0x56, 0x08, 0x8b, 0x5e, 0x06, 0xeb, 0x0e, 0xeb,
-  0x20, 0x8b, 0x76, 0x88, 0x8b, 0x4e, 0x86, 0x8b, 0x56, 0x84, 0x8b, 0x5e,
-  0x82, 0x31, 0xff, 0x29, 0xdf, 0x89, 0xfb, 0xbf, 0x00, 0x00, 0x19, 0xd7,
-  0x89, 0xfa, 0xbe, 0x10, 0x00, 0x19, 0xce, 0xeb, 0x05, 0xba, 0x00, 0x01,
-  0x31, 0xdb, 0x89, 0x5e, 0xb4, 0x89, 0x56, 0xd0, 0x85, 0xd2, 0x77, 0x06,
-  0x75, 0x0c, 0x39, 0xc3, 0x76, 0x08, 0xc7, 0x46, 0xd0, 0x00, 0x00, 0x89,
-  0x46, 0xb4, 0x8b, 0x46, 0xd0, 0x3d, 0x40, 0x00, 0x77, 0x08, 0x75, 0x10,
-  0x83, 0x7e, 0xb4, 0x00, 0x76, 0x0a, 0xc7, 0x46, 0xb4, 0x00, 0x00, 0xc7,
-  0x46, 0xd0, 0x40, 0x00, 0x36, 0xa1, 0xee, 0x0c, 0x36, 0x8b, 0x1e, 0xec,
-  0x0c, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x08, 0x36, 0x80, 0x3e,
-  0xf6, 0x0c, 0x04, 0x74, 0x24, 0xba, 0x04, 0x00, 0xb8, 0x00, 0x20, 0x0e,
-  0xe8, 0x9b, 0xf4, 0x85, 0xc0, 0x75, 0x19, 0x36, 0xc7, 0x06, 0xe8, 0x0c,
-  0xd4, 0x03, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0x8d, 0x66, 0xfc, 0x5f, 0x5e,
-  0x5d, 0x4d, 0xca, 0x0a, 0x00, 0xe9, 0x7a, 0x00, 0x36, 0xc4, 0x1e, 0xec,
-  0x0c, 0x31, 0xd2, 0x8c, 0xc0, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31,
-  0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x89, 0xd1, 0x31, 0xd2, 0x01,
-  0xd8, 0x89, 0x46, 0x9a, 0x11, 0xd1, 0x89, 0x4e, 0x9c, 0x89, 0x5e, 0xf6,
-  0x8c, 0x46, 0xf8, 0x8b, 0x46, 0x9a, 0x05, 0x00, 0x10, 0x8b, 0x56, 0x9c,
-  0x8e, 0x5e, 0xf8, 0xbf, 0x40, 0x00, 0x89, 0xde, 0x83, 0xd2, 0x00, 0x83,
-  0xc6, 0x04, 0x89, 0x57, 0x02, 0xba, 0x01, 0x00, 0x0c, 0x01, 0x89, 0x07,
-  0x31, 0xc0, 0x31, 0xdb, 0x89, 0xd9, 0x83, 0xc6, 0x04, 0x26, 0x89, 0x7c,
-  0xfe, 0x80, 0xc9, 0x87, 0x83, 0xc3, 0x00, 0x83, 0xd7, 0x40, 0x83, 0xc2,
-  0x01, 0x15, 0x00, 0x00, 0x26, 0x89, 0x4c, 0xfc, 0x85, 0xc0, 0x77, 0x10,
-  0x75, 0xde, 0x81, 0xfa, 0x00, 0x04, 0x73, 0x08, 0xeb, 0xd6, 0x89, 0x5e,
-  0xf6, 0x89, 0x46, 0xf8, 0x36, 0xa1, 0xfa, 0x0c, 0x36, 0x8b, 0x16, 0xf8,
-  0x0c, 0x85, 0xc0, 0x75, 0x27, 0x85, 0xd2, 0x75, 0x23, 0xb8, 0x48, 0x00,
-  0x0e, 0xe8, 0xf6, 0xbe, 0x90, 0x36, 0xa3, 0xf8, 0x0c, 0x36, 0x89, 0x16,
-  0xfa, 0x0c, 0x85, 0xd2, 0x75, 0x0e, 0x85, 0xc0, 0x75, 0x0a, 0x36, 0xc7,
-  0x06, 0xe8, 0x0c, 0xae, 0x03, 0xe9, 0x04, 0x11, 0x66, 0x33, 0xc0, 0x8c,
-  0xc8, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x9a, 0xff, 0x66, 0x33,
-  0xc0, 0x8c, 0xd8, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x8e, 0xff,
-  0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x07, 0x00, 0x00, 0xc7, 0x47, 0x02,
-  0x00, 0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x04, 0x00, 0x00,
-  0xc7, 0x47, 0x06, 0x00, 0x00, 0x8b, 0x56, 0x9a, 0x8b, 0x46, 0x9c, 0x36,
-  0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31,
-  0xd2, 0x89, 0x47, 0x0a, 0x83, 0xca, 0xff, 0x89, 0x57, 0x08, 0x8b, 0x46,
-  0x9a, 0x8b, 0x46, 0x9c, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7,
-  0x47, 0x0e, 0x0f, 0x00, 0x80, 0xcc, 0x9a, 0x89, 0x47, 0x0c, 0x8b, 0x56,
-  0x8e, 0x8b, 0x46, 0x90, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36,
-  0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x12, 0x83, 0xca, 0xff,
-  0x89, 0x57, 0x10, 0x8b, 0x46, 0x8e, 0x8b, 0x46, 0x90, 0x36, 0xc5, 0x1e,
-  0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x16, 0x0f, 0x00, 0x80, 0xcc, 0x92,
-  0x89, 0x47, 0x14, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x18, 0xff,
-  0xff, 0xc7, 0x47, 0x1a, 0x00, 0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7,
-  0x47, 0x1c, 0x00, 0x92, 0xc7, 0x47, 0x1e, 0x8f, 0x00, 0x66, 0x33, 0xc0,
-  0x8c, 0xd0, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x8e, 0xff, 0x8b,
-  0x56, 0x8e, 0x8b, 0x46, 0x90, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0,
-  0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x22, 0x83, 0xca,
-  0xff, 0x89, 0x57, 0x20, 0x8b, 0x46, 0x8e, 0x8b, 0x46, 0x90, 0x36, 0x8b,
-  0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0x31, 0xd2, 0x36, 0x8e, 0x1e, 0xfa, 0x0c,
-  0x80, 0xcc, 0x92, 0x89, 0x47, 0x24, 0x8c, 0xd0, 0xc7, 0x47, 0x26, 0x0f,
-  0x00, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0,
-  0xff, 0x31, 0xc2, 0x31, 0xdb, 0x05, 0x08, 0x15, 0x89, 0x46, 0x8e, 0x11,
-  0xda, 0x89, 0x56, 0x90, 0x8b, 0x56, 0x8e, 0x8b, 0x46, 0x90, 0x36, 0x8b,
-  0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2,
-  0x89, 0x47, 0x42, 0x83, 0xca, 0xff, 0x89, 0x57, 0x40, 0x8b, 0x46, 0x8e,
-  0x8b, 0x46, 0x90, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47,
-  0x46, 0x0f, 0x00, 0x80, 0xcc, 0x89, 0x89, 0x47, 0x44, 0x31, 0xd2, 0x36,
-  0xa1, 0xfa, 0x0c, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81,
-  0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd1,
-  0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46, 0x9a, 0x11, 0xd1, 0x89, 0x4e, 0x9c,
-  0x36, 0xc7, 0x06, 0x70, 0x14, 0x47, 0x00, 0x8b, 0x46, 0x9a, 0x36, 0xa3,
-  0x72, 0x14, 0x8b, 0x46, 0x9a, 0x8b, 0x46, 0x9c, 0x36, 0xc7, 0x06, 0x78,
-  0x14, 0xff, 0x07, 0x36, 0xc7, 0x06, 0x84, 0x14, 0x28, 0x00, 0x8b, 0x7e,
-  0x08, 0x8b, 0x5e, 0x0a, 0x8b, 0x4e, 0x08, 0xbe, 0x20, 0x00, 0x36, 0xa3,
-  0x74, 0x14, 0x36, 0x89, 0x16, 0x76, 0x14, 0x36, 0x89, 0x16, 0x7a, 0x14,
-  0x36, 0x89, 0x16, 0x7c, 0x14, 0x36, 0x89, 0x16, 0x7e, 0x14, 0x36, 0x89,
-  0x16, 0x80, 0x14, 0x36, 0x89, 0x16, 0x82, 0x14, 0x36, 0x89, 0x16, 0x86,
-  0x14, 0x8b, 0x46, 0x0c, 0x8b, 0x56, 0x06, 0x83, 0xe7, 0xc0, 0x0e, 0xe8,
-  0xa6, 0xb3, 0x90, 0xc5, 0x5e, 0xf6, 0x89, 0xd0, 0x31, 0xd2, 0x25, 0x0f,
-  0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0x00,
-  0xe0, 0x31, 0xc2, 0xbe, 0x20, 0x00, 0x09, 0xfa, 0x0c, 0x87, 0x89, 0x97,
-  0xf2, 0x0f, 0x8b, 0x56, 0x06, 0x89, 0x87, 0xf0, 0x0f, 0x83, 0xc2, 0x00,
-  0x8b, 0x4e, 0x08, 0x83, 0xd1, 0x40, 0x8b, 0x5e, 0x0a, 0x83, 0xd3, 0x00,
-  0x8b, 0x46, 0x0c, 0x15, 0x00, 0x00, 0x89, 0xcf, 0x0e, 0xe8, 0x60, 0xb3,
-  0x90, 0x8b, 0x5e, 0xf6, 0x83, 0xe7, 0xc0, 0x89, 0xd0, 0x31, 0xd2, 0x25,
-  0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0x00, 0xe0, 0x31, 0xc2, 0xbe, 0x20, 0x00, 0x8b, 0x4e, 0x84, 0x0c, 0x87,
-  0x09, 0xfa, 0x89, 0x87, 0xf4, 0x0f, 0x8b, 0x7e, 0x84, 0x89, 0x97, 0xf6,
-  0x0f, 0x8b, 0x46, 0x88, 0x8b, 0x5e, 0x86, 0x8b, 0x56, 0x82, 0x83, 0xe7,
-  0xc0, 0x0e, 0x3e, 0xe8, 0x1e, 0xb3, 0x8b, 0x5e, 0xf6, 0x89, 0xd0, 0x31,
-  0xd2, 0x25, 0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0x00, 0xe0, 0x31, 0xc2, 0xbe, 0x20, 0x00, 0x09, 0xfa, 0x0c,
-  0x87, 0x89, 0x97, 0xfa, 0x0f, 0x8b, 0x56, 0x82, 0x89, 0x87, 0xf8, 0x0f,
-  0x83, 0xc2, 0x00, 0x8b, 0x4e, 0x84, 0x83, 0xd1, 0x40, 0x8b, 0x5e, 0x86,
-  0x83, 0xd3, 0x00, 0x8b, 0x46, 0x88, 0x15, 0x00, 0x00, 0x89, 0xcf, 0x0e,
-  0x3e, 0xe8, 0xd8, 0xb2, 0x83, 0xe7, 0xc0, 0x89, 0xd0, 0x31, 0xd2, 0x25,
-  0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0x00, 0xe0, 0x31, 0xc2, 0x8b, 0x5e, 0xf6, 0x0c, 0x87, 0x09, 0xfa, 0x89,
-  0x87, 0xfc, 0x0f, 0x89, 0x97, 0xfe, 0x0f, 0x36, 0xa1, 0xee, 0x0c, 0x31,
-  0xd2, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0,
-  0xff, 0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xec, 0x0c, 0x31, 0xc9, 0x01, 0xd8,
-  0x89, 0x46, 0x9a, 0x11, 0xca, 0x89, 0x56, 0x9c, 0x8b, 0x46, 0x9a, 0x36,
-  0xa3, 0x88, 0x14, 0x8b, 0x46, 0x9c, 0x36, 0xa3, 0x8a, 0x14, 0x31, 0xd2,
-  0x8c, 0xd0, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0xf0, 0xff, 0x31, 0xc2, 0x31, 0xdb, 0x05, 0x70, 0x14, 0x89, 0x46, 0x9a,
-  0x11, 0xda, 0x89, 0x56, 0x9c, 0x8b, 0x46, 0x9a, 0x36, 0xa3, 0x8c, 0x14,
-  0x8b, 0x46, 0x9c, 0x36, 0xa3, 0x8e, 0x14, 0x31, 0xd2, 0x8c, 0xd0, 0xb1,
-  0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31,
-  0xc2, 0x89, 0xd3, 0x31, 0xd2, 0x05, 0x78, 0x14, 0x89, 0x46, 0x9a, 0x11,
-  0xd3, 0x89, 0x5e, 0x9c, 0x8b, 0x46, 0x9a, 0x36, 0xa3, 0x90, 0x14, 0x8b,
-  0x46, 0x9c, 0x36, 0xc7, 0x06, 0x96, 0x14, 0x40, 0x00, 0x36, 0xc7, 0x06,
-  0x9c, 0x14, 0x08, 0x00, 0x36, 0xa3, 0x92, 0x14, 0x36, 0x89, 0x16, 0x94,
-  0x14, 0x36, 0x89, 0x16, 0x98, 0x14, 0x36, 0x89, 0x16, 0x9a, 0x14, 0x8b,
-  0x46, 0x08, 0x36, 0x89, 0x16, 0x9e, 0x14, 0x30, 0xe4, 0x8b, 0x56, 0x06,
-  0x24, 0x3f, 0x83, 0xc2, 0x00, 0x89, 0x56, 0x9a, 0x15, 0x00, 0xff, 0x89,
-  0x46, 0x9c, 0x8b, 0x46, 0x84, 0x30, 0xe4, 0x8b, 0x56, 0x82, 0x24, 0x3f,
-  0x83, 0xc2, 0x00, 0x89, 0x56, 0x8e, 0x15, 0x80, 0xff, 0x89, 0x46, 0x90,
-  0xff, 0x76, 0xd0, 0x8b, 0x46, 0x9a, 0xff, 0x76, 0xb4, 0x8b, 0x56, 0x9c,
-  0x52, 0x50, 0x8b, 0x46, 0x8e, 0x8b, 0x56, 0x90, 0x52, 0x50, 0x8c, 0xd0,
-  0x8e, 0xd8, 0x0e, 0xe8, 0x93, 0x0e, 0x90, 0x8b, 0x46, 0xb4, 0x83, 0xc4,
-  0x0c, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x0a, 0x00, 0x83,
-  0x7e, 0x0c, 0x00, 0x75, 0x55, 0x83, 0x7e, 0x0a, 0x00, 0x75, 0x4f, 0x83,
-  0x7e, 0x08, 0x10, 0x73, 0x49, 0x83, 0x7e, 0x88, 0x00, 0x75, 0x43, 0x83,
-  0x7e, 0x86, 0x00, 0x75, 0x3d, 0x83, 0x7e, 0x84, 0x10, 0x73, 0x37, 0x8b,
-  0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77, 0x2a, 0x75, 0x30, 0x8b, 0x56, 0x0a,
-  0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75,
-  0x20, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x77, 0x10, 0x8b, 0x56, 0x08,
-  0x3b, 0x56, 0x84, 0x75, 0x10, 0x8b, 0x56, 0x06, 0x3b, 0x56, 0x82, 0x76,
-  0x08, 0x8b, 0x56, 0x06, 0xeb, 0x06, 0xe9, 0xc8, 0x00, 0x8b, 0x56, 0x82,
-  0x31, 0xdb, 0x29, 0xd3, 0x89, 0x5e, 0xba, 0x39, 0xc3, 0x76, 0x03, 0x89,
-  0x46, 0xba, 0x8b, 0x46, 0xba, 0x89, 0x46, 0xbc, 0x8b, 0x46, 0x82, 0x8b,
-  0x5e, 0x86, 0x8b, 0x4e, 0x84, 0x30, 0xe4, 0x8b, 0x56, 0x82, 0x24, 0x0f,
-  0xbe, 0x04, 0x00, 0x89, 0x46, 0xde, 0x8b, 0x46, 0x88, 0x8b, 0x7e, 0x06,
-  0x0e, 0xe8, 0x10, 0xb1, 0x90, 0x8b, 0x46, 0x0c, 0x8b, 0x5e, 0x0a, 0x8b,
-  0x4e, 0x08, 0xbe, 0x04, 0x00, 0x89, 0x56, 0xe0, 0x8b, 0x56, 0x06, 0x83,
-  0xe7, 0x0f, 0x0e, 0xe8, 0xf6, 0xb0, 0x90, 0x8b, 0x46, 0xbc, 0x89, 0xd1,
-  0x3d, 0x00, 0x10, 0x72, 0x44, 0xb8, 0x00, 0x10, 0x8e, 0x46, 0xe0, 0x89,
-  0xfe, 0x8b, 0x7e, 0xde, 0x81, 0x6e, 0xbc, 0x00, 0x10, 0x1e, 0x57, 0x91,
-  0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x1f,
-  0x81, 0x46, 0x06, 0x00, 0x10, 0x83, 0x56, 0x08, 0x00, 0x83, 0x56, 0x0a,
-  0x00, 0x83, 0x56, 0x0c, 0x00, 0x81, 0x46, 0x82, 0x00, 0x10, 0x83, 0x56,
-  0x84, 0x00, 0x83, 0x56, 0x86, 0x00, 0x83, 0x56, 0x88, 0x00, 0xe9, 0x77,
-  0xff, 0x85, 0xc0, 0x76, 0x17, 0x8e, 0x46, 0xe0, 0x89, 0xfe, 0x8b, 0x7e,
-  0xde, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9,
-  0xf3, 0xa4, 0x5f, 0x1f, 0x8b, 0x46, 0xba, 0x8d, 0x66, 0xfc, 0x5f, 0x5e,
-  0x5d, 0x4d, 0xca, 0x0a, 0x00, 0x8b, 0x76, 0x06, 0x8b, 0x5e, 0x08, 0x8b,
-  0x56, 0x0a, 0x8b, 0x4e, 0x0c, 0x0b, 0x76, 0x82, 0x0b, 0x5e, 0x84, 0x0b,
-  0x4e, 0x88, 0x0b, 0x56, 0x86, 0x83, 0xf9, 0x10, 0x72, 0x0b, 0x75, 0x06,
-  0x85, 0xd2, 0x75, 0x02, 0x85, 0xdb, 0xe9, 0x46, 0x06, 0x36, 0x80, 0x3e,
-  0xd2, 0x0c, 0x00, 0x74, 0xf5, 0x8b, 0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77,
-  0x2a, 0x75, 0x36, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b,
-  0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75, 0x26, 0x8b, 0x56, 0x08, 0x3b, 0x56,
-  0x84, 0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75, 0x16, 0x8b,
-  0x56, 0x06, 0x3b, 0x56, 0x82, 0x76, 0x0e, 0x8b, 0x5e, 0x0c, 0x8b, 0x4e,
-  0x0a, 0x8b, 0x56, 0x08, 0x8b, 0x76, 0x06, 0xeb, 0x0c, 0x8b, 0x5e, 0x88,
-  0x8b, 0x4e, 0x86, 0x8b, 0x56, 0x84, 0x8b, 0x76, 0x82, 0x31, 0xff, 0x29,
-  0xf7, 0xbe, 0x00, 0x00, 0x19, 0xd6, 0xba, 0x00, 0x00, 0x19, 0xca, 0xb9,
-  0x10, 0x00, 0x19, 0xd9, 0x89, 0xcb, 0x89, 0x7e, 0xc8, 0x75, 0x4a, 0x85,
-  0xd2, 0x75, 0x46, 0x81, 0xfe, 0x00, 0x01, 0x73, 0x62, 0x8b, 0x56, 0x0c,
-  0x3b, 0x56, 0x88, 0x77, 0x2a, 0x75, 0x38, 0x8b, 0x56, 0x0a, 0x3b, 0x56,
-  0x86, 0x77, 0x20, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75, 0x28, 0x8b,
-  0x56, 0x08, 0x3b, 0x56, 0x84, 0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56,
-  0x84, 0x75, 0x18, 0x8b, 0x56, 0x06, 0x3b, 0x56, 0x82, 0x76, 0x10, 0x8b,
-  0x76, 0x0c, 0x8b, 0x5e, 0x0a, 0x8b, 0x56, 0x08, 0x8b, 0x4e, 0x06, 0xeb,
-  0x0e, 0xeb, 0x20, 0x8b, 0x76, 0x88, 0x8b, 0x5e, 0x86, 0x8b, 0x56, 0x84,
-  0x8b, 0x4e, 0x82, 0x31, 0xff, 0x29, 0xcf, 0x89, 0xf9, 0xbf, 0x00, 0x00,
-  0x19, 0xd7, 0x89, 0xfa, 0xbe, 0x00, 0x00, 0x19, 0xde, 0xeb, 0x05, 0xba,
-  0x00, 0x01, 0x31, 0xc9, 0x89, 0x4e, 0xaa, 0x89, 0x56, 0xac, 0x83, 0x7e,
-  0xac, 0x00, 0x77, 0x0b, 0x83, 0x7e, 0xac, 0x00, 0x75, 0x0d, 0x3b, 0x46,
-  0xaa, 0x73, 0x08, 0x89, 0x46, 0xaa, 0xc7, 0x46, 0xac, 0x00, 0x00, 0x83,
-  0x7e, 0xac, 0x20, 0x77, 0x0c, 0x83, 0x7e, 0xac, 0x20, 0x75, 0x10, 0x83,
-  0x7e, 0xaa, 0x00, 0x76, 0x0a, 0xc7, 0x46, 0xaa, 0x00, 0x00, 0xc7, 0x46,
-  0xac, 0x20, 0x00, 0x36, 0xa1, 0xfa, 0x0c, 0x36, 0x8b, 0x16, 0xf8, 0x0c,
-  0x85, 0xc0, 0x75, 0x27, 0x85, 0xd2, 0x75, 0x23, 0xb8, 0x28, 0x00, 0x0e,
-  0x3e, 0xe8, 0x72, 0xb8, 0x36, 0xa3, 0xf8, 0x0c, 0x36, 0x89, 0x16, 0xfa,
-  0x0c, 0x85, 0xd2, 0x75, 0x0e, 0x85, 0xc0, 0x75, 0x0a, 0x36, 0xc7, 0x06,
-  0xe8, 0x0c, 0xae, 0x03, 0xe9, 0x81, 0x0a, 0x66, 0x33, 0xc0, 0x8c, 0xc8,
-  0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x92, 0xff, 0x66, 0x33, 0xc0,
-  0x8c, 0xd8, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x96, 0xff, 0x36,
-  0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x07, 0x00, 0x00, 0xc7, 0x47, 0x02, 0x00,
-  0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x04, 0x00, 0x00, 0xc7,
-  0x47, 0x06, 0x00, 0x00, 0x8b, 0x56, 0x92, 0x8b, 0x46, 0x94, 0x36, 0x8b,
-  0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2,
-  0x89, 0x47, 0x0a, 0x83, 0xca, 0xff, 0x89, 0x57, 0x08, 0x8b, 0x46, 0x92,
-  0x8b, 0x46, 0x94, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47,
-  0x0e, 0x0f, 0x00, 0x80, 0xcc, 0x9a, 0x89, 0x47, 0x0c, 0x8b, 0x56, 0x96,
-  0x8b, 0x46, 0x98, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e,
-  0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x12, 0x83, 0xca, 0xff, 0x89,
-  0x57, 0x10, 0x8b, 0x46, 0x96, 0x8b, 0x46, 0x98, 0x36, 0xc5, 0x1e, 0xf8,
-  0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x16, 0x0f, 0x00, 0x80, 0xcc, 0x92, 0x89,
-  0x47, 0x14, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x18, 0xff, 0xff,
-  0xc7, 0x47, 0x1a, 0x00, 0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x47,
-  0x1c, 0x00, 0x92, 0xc7, 0x47, 0x1e, 0x8f, 0x00, 0x66, 0x33, 0xc0, 0x8c,
-  0xd0, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86, 0x96, 0xff, 0x8b, 0x56,
-  0x96, 0x8b, 0x46, 0x98, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36,
-  0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x22, 0x83, 0xca, 0xff,
-  0x89, 0x57, 0x20, 0x8b, 0x46, 0x96, 0x8b, 0x46, 0x98, 0x36, 0xc5, 0x1e,
-  0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x26, 0x0f, 0x00, 0x80, 0xcc, 0x92,
-  0x89, 0x47, 0x24, 0x31, 0xd2, 0x36, 0xa1, 0xfa, 0x0c, 0xb1, 0x04, 0xd3,
-  0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x36,
-  0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46,
-  0x92, 0x11, 0xd1, 0x89, 0x4e, 0x94, 0x36, 0xc7, 0x06, 0x70, 0x14, 0x27,
-  0x00, 0x8b, 0x46, 0x92, 0x36, 0xa3, 0x72, 0x14, 0x8b, 0x46, 0x92, 0x8b,
-  0x46, 0x94, 0x36, 0xa3, 0x74, 0x14, 0x36, 0x89, 0x16, 0x76, 0x14, 0x36,
-  0xa1, 0xee, 0x0c, 0x36, 0x8b, 0x16, 0xec, 0x0c, 0x85, 0xc0, 0x75, 0x04,
-  0x85, 0xd2, 0x74, 0x08, 0x36, 0x80, 0x3e, 0xf6, 0x0c, 0x03, 0x74, 0x24,
-  0xba, 0x03, 0x00, 0xb8, 0x00, 0x50, 0x0e, 0xe8, 0xdc, 0xeb, 0x85, 0xc0,
-  0x75, 0x19, 0x36, 0xc7, 0x06, 0xe8, 0x0c, 0x1a, 0x04, 0x36, 0x8c, 0x16,
-  0xea, 0x0c, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x0a, 0x00,
-  0xe9, 0xdf, 0x01, 0x36, 0xc5, 0x1e, 0xec, 0x0c, 0x31, 0xd2, 0x8c, 0xd8,
-  0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff,
-  0x31, 0xc2, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46, 0x92, 0x11,
-  0xd1, 0x89, 0x4e, 0x94, 0xb1, 0x03, 0x89, 0x5e, 0xce, 0x8c, 0x5e, 0xbe,
-  0x31, 0xf6, 0x31, 0xc0, 0xd3, 0xe2, 0x31, 0xff, 0x01, 0xd3, 0x31, 0xd2,
-  0x8b, 0x4e, 0x92, 0x89, 0x4e, 0xca, 0x8b, 0x4e, 0x94, 0xc7, 0x46, 0xc8,
-  0x00, 0x00, 0x89, 0x4e, 0xdc, 0x8b, 0x4e, 0xca, 0xc7, 0x46, 0xca, 0x00,
-  0x00, 0x81, 0xc1, 0x00, 0x10, 0x89, 0x4e, 0xfa, 0x8b, 0x4e, 0xdc, 0x83,
-  0xd1, 0x00, 0x89, 0x4e, 0xe2, 0x8b, 0x4e, 0xc8, 0x83, 0xd1, 0x00, 0x89,
-  0x4e, 0xc8, 0x8b, 0x4e, 0xca, 0x83, 0xd1, 0x00, 0xc7, 0x46, 0xdc, 0x00,
-  0x00, 0x89, 0x4e, 0xca, 0x8b, 0x4e, 0xfa, 0xc7, 0x46, 0xe6, 0x00, 0x00,
-  0x01, 0xf9, 0x89, 0x4e, 0xe4, 0x8b, 0x4e, 0xe2, 0x11, 0xd1, 0x89, 0x4e,
-  0xe2, 0x8b, 0x4e, 0xc8, 0x13, 0x4e, 0xdc, 0x89, 0x4e, 0xdc, 0x8b, 0x4e,
-  0xca, 0x13, 0x4e, 0xe6, 0x89, 0x4e, 0xe6, 0x8b, 0x4e, 0xe4, 0x80, 0xc9,
-  0x01, 0x89, 0x4e, 0xe4, 0x8b, 0x4e, 0xe2, 0x89, 0x4e, 0xe2, 0x8b, 0x4e,
-  0xdc, 0x89, 0x4e, 0xdc, 0x8b, 0x4e, 0xe6, 0x83, 0xc3, 0x08, 0x89, 0x4f,
-  0xfe, 0x8b, 0x4e, 0xdc, 0x89, 0x4f, 0xfc, 0x8b, 0x4e, 0xe2, 0x81, 0xc7,
-  0x00, 0x10, 0x83, 0xd2, 0x00, 0x89, 0x4f, 0xfa, 0x8b, 0x4e, 0xe4, 0x83,
-  0xc6, 0x01, 0x15, 0x00, 0x00, 0x89, 0x4f, 0xf8, 0x85, 0xc0, 0x77, 0x0a,
-  0x74, 0x03, 0xe9, 0x53, 0xff, 0x83, 0xfe, 0x04, 0x72, 0xf8, 0xb1, 0x03,
-  0x89, 0xf2, 0x8b, 0x5e, 0xce, 0xd3, 0xe2, 0x8e, 0x5e, 0xbe, 0x01, 0xd3,
-  0x85, 0xc0, 0x77, 0x26, 0x75, 0x06, 0x81, 0xfe, 0x00, 0x02, 0x73, 0x1e,
-  0xc7, 0x47, 0x06, 0x00, 0x00, 0xc7, 0x47, 0x04, 0x00, 0x00, 0xc7, 0x47,
-  0x02, 0x00, 0x00, 0xc7, 0x07, 0x00, 0x00, 0x83, 0xc3, 0x08, 0x83, 0xc6,
-  0x01, 0x15, 0x00, 0x00, 0xeb, 0xd6, 0x31, 0xc0, 0xb1, 0x0c, 0x89, 0x46,
-  0xc0, 0x89, 0x46, 0xc2, 0x89, 0x46, 0xea, 0x89, 0x46, 0xec, 0xd3, 0xe0,
-  0x89, 0x46, 0xee, 0xeb, 0x27, 0x83, 0x46, 0xea, 0x00, 0x81, 0x56, 0xec,
-  0x00, 0x40, 0x80, 0x46, 0xef, 0x10, 0x83, 0x46, 0xc0, 0x01, 0x83, 0x56,
-  0xc2, 0x00, 0x8b, 0x46, 0xc2, 0x85, 0xc0, 0x76, 0x03, 0xe9, 0x86, 0x00,
-  0x75, 0x06, 0x83, 0x7e, 0xc0, 0x04, 0x73, 0xf5, 0x8b, 0x5e, 0xee, 0x8b,
-  0x56, 0xea, 0xb1, 0x03, 0x36, 0xa1, 0xec, 0x0c, 0x31, 0xf6, 0x36, 0x8e,
-  0x1e, 0xee, 0x0c, 0x89, 0x56, 0xcc, 0x8b, 0x56, 0xec, 0x80, 0xc4, 0x10,
-  0x89, 0x56, 0xd6, 0x31, 0xd2, 0x01, 0xc3, 0xd3, 0xe2, 0x31, 0xc0, 0x01,
-  0xd3, 0x31, 0xc9, 0x31, 0xd2, 0x8b, 0x7e, 0xcc, 0x09, 0xcf, 0x89, 0x7e,
-  0xdc, 0x8b, 0x7e, 0xd6, 0x83, 0xc3, 0x08, 0x09, 0xd7, 0xc7, 0x47, 0xfe,
-  0x00, 0x00, 0x89, 0x7e, 0xe2, 0x8b, 0x7e, 0xdc, 0xc7, 0x47, 0xfc, 0x00,
-  0x00, 0x81, 0xcf, 0x87, 0x00, 0x89, 0x7e, 0xdc, 0x8b, 0x7e, 0xe2, 0x83,
-  0xc1, 0x00, 0x83, 0xd2, 0x20, 0x89, 0x7f, 0xfa, 0x8b, 0x7e, 0xdc, 0x83,
-  0xc6, 0x01, 0x15, 0x00, 0x00, 0x89, 0x7f, 0xf8, 0x85, 0xc0, 0x76, 0x03,
-  0xe9, 0x66, 0xff, 0x75, 0xb8, 0x81, 0xfe, 0x00, 0x02, 0x72, 0xb2, 0xe9,
-  0x5b, 0xff, 0x36, 0xc5, 0x1e, 0xec, 0x0c, 0x31, 0xd2, 0x8c, 0xd8, 0xb1,
-  0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31,
-  0xc2, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46, 0x92, 0x11, 0xd1,
-  0x89, 0x4e, 0x94, 0x80, 0xc7, 0x40, 0x8b, 0x56, 0x08, 0xc7, 0x87, 0xe0,
-  0x0f, 0x87, 0x00, 0x8b, 0x46, 0x0c, 0xc7, 0x87, 0xe8, 0x0f, 0x87, 0x00,
-  0x80, 0xe2, 0xe0, 0xc7, 0x87, 0xf0, 0x0f, 0x87, 0x00, 0x30, 0xe4, 0xc7,
-  0x87, 0xf8, 0x0f, 0x87, 0x00, 0x24, 0x0f, 0x89, 0x97, 0xe2, 0x0f, 0x8b,
-  0x56, 0x0a, 0x89, 0x87, 0xe6, 0x0f, 0x8b, 0x46, 0x06, 0x89, 0x97, 0xe4,
-  0x0f, 0x05, 0x00, 0x00, 0x8b, 0x56, 0x08, 0x83, 0xd2, 0x20, 0x8b, 0x4e,
-  0x0a, 0x83, 0xd1, 0x00, 0x8b, 0x46, 0x0c, 0x15, 0x00, 0x00, 0x89, 0x8f,
-  0xec, 0x0f, 0x30, 0xe4, 0x80, 0xe2, 0xe0, 0x24, 0x0f, 0x89, 0x97, 0xea,
-  0x0f, 0x89, 0x87, 0xee, 0x0f, 0x8b, 0x46, 0x84, 0x8b, 0x56, 0x88, 0x24,
-  0xe0, 0x30, 0xf6, 0x89, 0x87, 0xf2, 0x0f, 0x8b, 0x46, 0x86, 0x80, 0xe2,
-  0x0f, 0x89, 0x87, 0xf4, 0x0f, 0x8b, 0x46, 0x82, 0x89, 0x97, 0xf6, 0x0f,
-  0x05, 0x00, 0x00, 0x8b, 0x56, 0x84, 0x83, 0xd2, 0x20, 0x8b, 0x4e, 0x86,
-  0x83, 0xd1, 0x00, 0x8b, 0x46, 0x88, 0x15, 0x00, 0x00, 0x89, 0x8f, 0xfc,
-  0x0f, 0x30, 0xe4, 0x80, 0xe2, 0xe0, 0x24, 0x0f, 0x89, 0x97, 0xfa, 0x0f,
-  0x89, 0x87, 0xfe, 0x0f, 0x31, 0xd2, 0x36, 0xa1, 0xee, 0x0c, 0xb1, 0x04,
-  0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2,
-  0x36, 0x8b, 0x1e, 0xec, 0x0c, 0x89, 0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89,
-  0x46, 0x92, 0x11, 0xd1, 0x89, 0x4e, 0x94, 0xfa, 0x0f, 0x20, 0xe0, 0x66,
-  0x83, 0xc8, 0x30, 0x0f, 0x22, 0xe0, 0x66, 0x8b, 0x86, 0x92, 0xff, 0x0f,
-  0x22, 0xd8, 0x06, 0xb8, 0xe3, 0x0d, 0x8e, 0xc0, 0x26, 0x0f, 0x01, 0x16,
-  0x70, 0x14, 0x07, 0x8b, 0x46, 0x08, 0x30, 0xe4, 0x8b, 0x56, 0x06, 0x24,
-  0x1f, 0x83, 0xc2, 0x00, 0x89, 0x56, 0x92, 0x15, 0x80, 0xff, 0x89, 0x46,
-  0x94, 0x8b, 0x46, 0x84, 0x30, 0xe4, 0x8b, 0x56, 0x82, 0x24, 0x1f, 0x83,
-  0xc2, 0x00, 0x89, 0x56, 0x96, 0x15, 0xc0, 0xff, 0x89, 0x46, 0x98, 0x66,
-  0x8b, 0x8e, 0xaa, 0xff, 0x66, 0x8b, 0xb6, 0x92, 0xff, 0x66, 0x8b, 0xbe,
-  0x96, 0xff, 0x9a, 0x61, 0x6b, 0x00, 0x00, 0x0f, 0x20, 0xe0, 0x66, 0x83,
-  0xe0, 0xcf, 0x0f, 0x22, 0xe0, 0x66, 0x33, 0xc0, 0x0f, 0x22, 0xd8, 0x31,
-  0xc0, 0x36, 0xc7, 0x06, 0x70, 0x14, 0xff, 0xff, 0x36, 0xa3, 0x72, 0x14,
-  0x36, 0xa3, 0x74, 0x14, 0x06, 0xb8, 0xe3, 0x0d, 0x8e, 0xc0, 0x26, 0x0f,
-  0x01, 0x16, 0x70, 0x14, 0x07, 0xfb, 0x8b, 0x46, 0xaa, 0x8d, 0x66, 0xfc,
-  0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x0a, 0x00, 0x8b, 0x76, 0x06, 0x8b, 0x4e,
-  0x08, 0x8b, 0x56, 0x0a, 0x8b, 0x5e, 0x0c, 0x0b, 0x76, 0x82, 0x0b, 0x4e,
-  0x84, 0x0b, 0x5e, 0x88, 0x0b, 0x56, 0x86, 0x36, 0x3b, 0x1e, 0xe6, 0x0c,
-  0x72, 0x1e, 0x74, 0x03, 0xe9, 0x5e, 0x05, 0x36, 0x3b, 0x16, 0xe4, 0x0c,
-  0x72, 0x12, 0x75, 0xf4, 0x36, 0x3b, 0x0e, 0xe2, 0x0c, 0x72, 0x09, 0x75,
-  0xeb, 0x36, 0x3b, 0x36, 0xe0, 0x0c, 0x77, 0xe4, 0x36, 0x80, 0x3e, 0xd1,
-  0x0c, 0x00, 0x74, 0xdc, 0x8b, 0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77, 0x2a,
-  0x75, 0x36, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b, 0x56,
-  0x0a, 0x3b, 0x56, 0x86, 0x75, 0x26, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84,
-  0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75, 0x16, 0x8b, 0x56,
-  0x06, 0x3b, 0x56, 0x82, 0x76, 0x0e, 0x8b, 0x56, 0x0c, 0x8b, 0x4e, 0x0a,
-  0x8b, 0x5e, 0x08, 0x8b, 0x76, 0x06, 0xeb, 0x0c, 0x8b, 0x56, 0x88, 0x8b,
-  0x4e, 0x86, 0x8b, 0x5e, 0x84, 0x8b, 0x76, 0x82, 0x36, 0x8b, 0x3e, 0xe0,
-  0x0c, 0x83, 0xc7, 0x01, 0x89, 0x7e, 0xe4, 0x36, 0x8b, 0x3e, 0xe2, 0x0c,
-  0x83, 0xd7, 0x00, 0x89, 0x7e, 0xe2, 0x36, 0x8b, 0x3e, 0xe4, 0x0c, 0x83,
-  0xd7, 0x00, 0x89, 0x7e, 0xfa, 0x36, 0x8b, 0x3e, 0xe6, 0x0c, 0x83, 0xd7,
-  0x00, 0x89, 0x7e, 0xdc, 0x8b, 0x7e, 0xe4, 0x29, 0xf7, 0x8b, 0x76, 0xe2,
-  0x19, 0xde, 0x8b, 0x5e, 0xfa, 0x19, 0xcb, 0x8b, 0x4e, 0xdc, 0x19, 0xd1,
-  0x89, 0xca, 0x89, 0x7e, 0xfa, 0x75, 0x4a, 0x85, 0xdb, 0x75, 0x46, 0x81,
-  0xfe, 0x00, 0x01, 0x73, 0x40, 0x8b, 0x56, 0x0c, 0x3b, 0x56, 0x88, 0x77,
-  0x2a, 0x75, 0x38, 0x8b, 0x56, 0x0a, 0x3b, 0x56, 0x86, 0x77, 0x20, 0x8b,
-  0x56, 0x0a, 0x3b, 0x56, 0x86, 0x75, 0x28, 0x8b, 0x56, 0x08, 0x3b, 0x56,
-  0x84, 0x77, 0x10, 0x8b, 0x56, 0x08, 0x3b, 0x56, 0x84, 0x75, 0x18, 0x8b,
-  0x56, 0x06, 0x3b, 0x56, 0x82, 0x76, 0x10, 0x8b, 0x5e, 0x0c, 0x8b, 0x4e,
-  0x0a, 0x8b, 0x76, 0x08, 0x8b, 0x56, 0x06, 0xeb, 0x0e, 0xeb, 0x4a, 0x8b,
-  0x5e, 0x88, 0x8b, 0x4e, 0x86, 0x8b, 0x76, 0x84, 0x8b, 0x56, 0x82, 0x36,
-  0x8b, 0x3e, 0xe0, 0x0c, 0x83, 0xc7, 0x01, 0x89, 0x7e, 0xe4, 0x36, 0x8b,
-  0x3e, 0xe2, 0x0c, 0x83, 0xd7, 0x00, 0x89, 0x7e, 0xe2, 0x36, 0x8b, 0x3e,
-  0xe4, 0x0c, 0x83, 0xd7, 0x00, 0x89, 0x7e, 0xdc, 0x36, 0x8b, 0x3e, 0xe6,
-  0x0c, 0x83, 0xd7, 0x00, 0x8b, 0x7e, 0xe4, 0x29, 0xd7, 0x89, 0xfa, 0x8b,
-  0x7e, 0xe2, 0x19, 0xf7, 0x89, 0xfe, 0x8b, 0x5e, 0xdc, 0x19, 0xcb, 0xeb,
-  0x05, 0xbe, 0x00, 0x01, 0x31, 0xca, 0x89, 0x56, 0xa6, 0x89, 0x76, 0xa8,
-  0x83, 0x7e, 0xa8, 0x00, 0x77, 0x0b, 0x83, 0x7e, 0xa8, 0x00, 0x75, 0x0d,
-  0x3b, 0x46, 0xa6, 0x73, 0x08, 0x89, 0x46, 0xa6, 0xc7, 0x46, 0xa8, 0x00,
-  0x00, 0x83, 0x7e, 0xa8, 0x40, 0x77, 0x0c, 0x83, 0x7e, 0xa8, 0x40, 0x75,
-  0x10, 0x83, 0x7e, 0xa6, 0x00, 0x76, 0x0a, 0xc7, 0x46, 0xa6, 0x00, 0x00,
-  0xc7, 0x46, 0xa8, 0x40, 0x00, 0x36, 0xa1, 0xee, 0x0c, 0x36, 0x8b, 0x1e,
-  0xec, 0x0c, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x08, 0x36, 0x80,
-  0x3e, 0xf6, 0x0c, 0x02, 0x74, 0x68, 0xba, 0x02, 0x00, 0xb8, 0x00, 0x10,
-  0x0e, 0xe8, 0x7e, 0xe6, 0x85, 0xc0, 0x75, 0x16, 0x36, 0xc7, 0x06, 0xe8,
-  0x0c, 0x5c, 0x04, 0x36, 0x8c, 0x16, 0xea, 0x0c, 0x8d, 0x66, 0xfc, 0x5f,
-  0x5e, 0x5d, 0x4d, 0xca, 0x0a, 0x00, 0x36, 0x8b, 0x1e, 0xec, 0x0c, 0x36,
-  0xa1, 0xee, 0x0c, 0x31, 0xd2, 0x31, 0xff, 0x89, 0x5e, 0xd2, 0x89, 0x46,
-  0xd4, 0x89, 0xde, 0x8e, 0x5e, 0xd4, 0x31, 0xc0, 0x31, 0xdb, 0x89, 0xd9,
-  0x83, 0xc6, 0x04, 0x89, 0x7c, 0xfe, 0x80, 0xc9, 0x87, 0x83, 0xc3, 0x00,
-  0x83, 0xd7, 0x40, 0x83, 0xc2, 0x01, 0x15, 0x00, 0x00, 0x89, 0x4c, 0xfc,
-  0x85, 0xc0, 0x77, 0x10, 0x75, 0xe0, 0x81, 0xfa, 0x00, 0x04, 0x73, 0x08,
-  0xeb, 0xd8, 0x89, 0x5e, 0xd2, 0x89, 0x46, 0xd4, 0x36, 0x8b, 0x16, 0xfa,
-  0x0c, 0x36, 0xa1, 0xf8, 0x0c, 0x85, 0xd2, 0x75, 0x27, 0x85, 0xc0, 0x75,
-  0x23, 0xb8, 0x28, 0x00, 0x0e, 0xe8, 0x12, 0xb1, 0x90, 0x36, 0xa3, 0xf8,
-  0x0c, 0x36, 0x89, 0x16, 0xfa, 0x0c, 0x85, 0xd2, 0x75, 0x0e, 0x85, 0xc0,
-  0x75, 0x0a, 0x36, 0xc7, 0x06, 0xe8, 0x0c, 0xae, 0x03, 0xe9, 0x20, 0x03,
-  0x66, 0x33, 0xc0, 0x8c, 0xc8, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89, 0x86,
-  0x9e, 0xff, 0x66, 0x33, 0xc0, 0x8c, 0xd8, 0x66, 0xc1, 0xe0, 0x04, 0x66,
-  0x89, 0x86, 0xae, 0xff, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7, 0x07, 0x00,
-  0x00, 0xc7, 0x47, 0x02, 0x00, 0x00, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0xc7,
-  0x47, 0x04, 0x00, 0x00, 0xc7, 0x47, 0x06, 0x00, 0x00, 0x8b, 0x56, 0x9e,
-  0x8b, 0x46, 0xa0, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e,
-  0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47, 0x0a, 0x83, 0xca, 0xff, 0x89,
-  0x57, 0x08, 0x8b, 0x46, 0x9e, 0x8b, 0x46, 0xa0, 0x36, 0xc5, 0x1e, 0xf8,
-  0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x0e, 0x0f, 0x00, 0x80, 0xcc, 0x9a, 0x89,
-  0x47, 0x0c, 0x8b, 0x56, 0xae, 0x8b, 0x46, 0xb0, 0x36, 0x8b, 0x1e, 0xf8,
-  0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89, 0x47,
-  0x12, 0x83, 0xca, 0xff, 0x89, 0x57, 0x10, 0x8b, 0x46, 0xae, 0x8b, 0x46,
-  0xb0, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x16, 0x0f,
-  0x00, 0x80, 0xcc, 0x92, 0x89, 0x47, 0x14, 0x36, 0xc5, 0x1e, 0xf8, 0x0c,
-  0xc7, 0x47, 0x18, 0xff, 0xff, 0xc7, 0x47, 0x1a, 0x00, 0x00, 0x36, 0xc5,
-  0x1e, 0xf8, 0x0c, 0xc7, 0x47, 0x1c, 0x00, 0x92, 0xc7, 0x47, 0x1e, 0x8f,
-  0x00, 0x66, 0x33, 0xc0, 0x8c, 0xd0, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x89,
-  0x86, 0xae, 0xff, 0x8b, 0x56, 0xae, 0x8b, 0x46, 0xb0, 0x36, 0x8b, 0x1e,
-  0xf8, 0x0c, 0x89, 0xd0, 0x36, 0x8e, 0x1e, 0xfa, 0x0c, 0x31, 0xd2, 0x89,
-  0x47, 0x22, 0x83, 0xca, 0xff, 0x89, 0x57, 0x20, 0x8b, 0x46, 0xae, 0x8b,
-  0x46, 0xb0, 0x36, 0xc5, 0x1e, 0xf8, 0x0c, 0x30, 0xe4, 0xc7, 0x47, 0x26,
-  0x0f, 0x00, 0x80, 0xcc, 0x92, 0x89, 0x47, 0x24, 0x31, 0xd2, 0x36, 0xa1,
-  0xfa, 0x0c, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0xf0, 0xff, 0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xf8, 0x0c, 0x89, 0xd1, 0x31,
-  0xd2, 0x01, 0xd8, 0x89, 0x46, 0x9e, 0x11, 0xd1, 0x89, 0x4e, 0xa0, 0x36,
-  0xc7, 0x06, 0x70, 0x14, 0x27, 0x00, 0x8b, 0x46, 0x9e, 0x36, 0xa3, 0x72,
-  0x14, 0x8b, 0x46, 0x9e, 0x8b, 0x46, 0xa0, 0x8b, 0x7e, 0x08, 0x8b, 0x5e,
-  0x0a, 0x8b, 0x4e, 0x08, 0xbe, 0x20, 0x00, 0x36, 0xa3, 0x74, 0x14, 0x36,
-  0x89, 0x16, 0x76, 0x14, 0x8b, 0x46, 0x0c, 0x8b, 0x56, 0x06, 0x83, 0xe7,
-  0xc0, 0x0e, 0x3e, 0xe8, 0x46, 0xa6, 0xc5, 0x5e, 0xd2, 0x89, 0xd0, 0x31,
-  0xd2, 0x25, 0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0x00, 0xe0, 0x31, 0xc2, 0xbe, 0x20, 0x00, 0x09, 0xfa, 0x0c,
-  0x87, 0x89, 0x97, 0xf2, 0x0f, 0x8b, 0x56, 0x06, 0x89, 0x87, 0xf0, 0x0f,
-  0x83, 0xc2, 0x00, 0x8b, 0x4e, 0x08, 0x83, 0xd1, 0x40, 0x8b, 0x5e, 0x0a,
-  0x83, 0xd3, 0x00, 0x8b, 0x46, 0x0c, 0x15, 0x00, 0x00, 0x89, 0xcf, 0x0e,
-  0x3e, 0xe8, 0x00, 0xa6, 0x83, 0xe7, 0xc0, 0x89, 0xd0, 0x31, 0xd2, 0x25,
-  0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0,
-  0x00, 0xe0, 0x31, 0xc2, 0x8b, 0x5e, 0xd2, 0x0c, 0x87, 0x09, 0xfa, 0x89,
-  0x87, 0xf4, 0x0f, 0x89, 0x97, 0xf6, 0x0f, 0x8b, 0x46, 0x88, 0x8b, 0x5e,
-  0x86, 0x8b, 0x4e, 0x84, 0x8b, 0x56, 0x82, 0xbe, 0x20, 0x00, 0x8b, 0x7e,
-  0x84, 0x0e, 0x3e, 0xe8, 0xc2, 0xa5, 0x8b, 0x5e, 0xd2, 0x83, 0xe7, 0xc0,
-  0x89, 0xd0, 0x31, 0xd2, 0x25, 0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3,
-  0xc0, 0x31, 0xc2, 0x81, 0xe0, 0x00, 0xe0, 0x31, 0xc2, 0xbe, 0x20, 0x00,
-  0x09, 0xfa, 0x0c, 0x87, 0x89, 0x97, 0xfa, 0x0f, 0x8b, 0x56, 0x82, 0x89,
-  0x87, 0xf8, 0x0f, 0x83, 0xc2, 0x00, 0x8b, 0x4e, 0x84, 0x83, 0xd1, 0x40,
-  0x8b, 0x5e, 0x86, 0x83, 0xd3, 0x00, 0x8b, 0x46, 0x88, 0x15, 0x00, 0x00,
-  0x89, 0xcf, 0x0e, 0xe8, 0x7a, 0xa5, 0x90, 0x83, 0xe7, 0xc0, 0x89, 0xd0,
-  0x31, 0xd2, 0x25, 0x0f, 0x00, 0xb1, 0x0d, 0xd3, 0xe2, 0xd3, 0xc0, 0x31,
-  0xc2, 0x81, 0xe0, 0x00, 0xe0, 0x31, 0xc2, 0x8b, 0x5e, 0xd2, 0x0c, 0x87,
-  0x09, 0xfa, 0x89, 0x87, 0xfc, 0x0f, 0x89, 0x97, 0xfe, 0x0f, 0x36, 0xa1,
-  0xee, 0x0c, 0x31, 0xd2, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x36, 0x8b, 0x1e, 0xec, 0x0c, 0x89,
-  0xd1, 0x31, 0xd2, 0x01, 0xd8, 0x89, 0x46, 0x9e, 0x11, 0xd1, 0x89, 0x4e,
-  0xa0, 0xfa, 0x0f, 0x20, 0xe0, 0x66, 0x83, 0xc8, 0x10, 0x0f, 0x22, 0xe0,
-  0x66, 0x8b, 0x86, 0x9e, 0xff, 0x0f, 0x22, 0xd8, 0x06, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xc0, 0x26, 0x0f, 0x01, 0x16, 0x70, 0x14, 0x07, 0x8b, 0x46, 0x08,
-  0x30, 0xe4, 0x8b, 0x56, 0x06, 0x24, 0x3f, 0x83, 0xc2, 0x00, 0x89, 0x56,
-  0x9e, 0x15, 0x00, 0xff, 0x89, 0x46, 0xa0, 0x8b, 0x46, 0x84, 0x30, 0xe4,
-  0x8b, 0x56, 0x82, 0x24, 0x3f, 0x83, 0xc2, 0x00, 0x89, 0x56, 0xae, 0x15,
-  0x80, 0xff, 0x89, 0x46, 0xb0, 0x66, 0x8b, 0x8e, 0xa6, 0xff, 0x66, 0x8b,
-  0xb6, 0x9e, 0xff, 0x66, 0x8b, 0xbe, 0xae, 0xff, 0x9a, 0xb7, 0x6b, 0x00,
-  0x00, 0x0f, 0x20, 0xe0, 0x66, 0x83, 0xe0, 0xef, 0x0f, 0x22, 0xe0, 0x66,
-  0x33, 0xc0, 0x0f, 0x22, 0xd8, 0x31, 0xc0, 0x36, 0xc7, 0x06, 0x70, 0x14,
-  0xff, 0xff, 0x36, 0xa3, 0x72, 0x14, 0x36, 0xa3, 0x74, 0x14, 0x06, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xc0, 0x26, 0x0f, 0x01, 0x16, 0x70, 0x14, 0x07, 0xfb,
-  0x8b, 0x46, 0xa6, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x0a,
-  0x00, 0x36, 0xc7, 0x06, 0xe8, 0x0c, 0x9d, 0x04, 0x36, 0x8c, 0x16, 0xea,
-  0x0c, 0x31, 0xc0, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x0a,
-  0x00, 0x9c, 0x1e, 0x56, 0x51, 0xfa, 0x31, 0xc0, 0x8e, 0xd8, 0xbe, 0x34,
-  0x00, 0x8b, 0x0c, 0xc7, 0x04, 0xec, 0x6a, 0x51, 0x8b, 0x4c, 0x02, 0x8c,
-  0x4c, 0x02, 0x51, 0x66, 0xbe, 0xf8, 0xff, 0xff, 0xff, 0x66, 0x67, 0x8b,
-  0x36, 0xbe, 0x34, 0x00, 0x59, 0x89, 0x4c, 0x02, 0x59, 0x89, 0x0c, 0x59,
-  0x5e, 0x1f, 0x9d, 0xcb, 0x83, 0xc4, 0x06, 0x40, 0xeb, 0xeb, 0x55, 0x89,
-  0xe5, 0x9c, 0x60, 0x8c, 0xc8, 0x2e, 0xa3, 0x4c, 0x6b, 0x66, 0x31, 0xf6,
-  0x8b, 0x76, 0x06, 0x66, 0x31, 0xc0, 0x8b, 0x46, 0x08, 0x66, 0xc1, 0xe0,
-  0x04, 0x66, 0x01, 0xf0, 0xfa, 0x83, 0xec, 0x08, 0x89, 0xe3, 0x0f, 0x01,
-  0x07, 0x83, 0xec, 0x08, 0x89, 0xe7, 0xc7, 0x05, 0xff, 0x00, 0x66, 0x89,
-  0x45, 0x02, 0x0f, 0x01, 0x15, 0x8c, 0xdb, 0x8c, 0xc1, 0x0f, 0x20, 0xc0,
-  0x0c, 0x01, 0x0f, 0x22, 0xc0, 0xb8, 0x08, 0x00, 0x8e, 0xd8, 0x8e, 0xc0,
-  0xea, 0x41, 0x6b, 0x10, 0x00, 0x0f, 0x20, 0xc0, 0x24, 0xfe, 0x0f, 0x22,
-  0xc0, 0xea, 0x4e, 0x6b, 0x00, 0x00, 0x8e, 0xdb, 0x8e, 0xc1, 0x83, 0xc4,
-  0x08, 0x89, 0xe3, 0x0f, 0x01, 0x17, 0x83, 0xc4, 0x08, 0x61, 0x9d, 0x5d,
-  0xcb, 0x06, 0x1e, 0x16, 0x8c, 0xc8, 0x2e, 0xa3, 0xb1, 0x6b, 0x0f, 0x20,
-  0xc0, 0x66, 0x0d, 0x01, 0x00, 0x00, 0x80, 0x0f, 0x22, 0xc0, 0xea, 0x7b,
-  0x6b, 0x08, 0x00, 0xb8, 0x10, 0x00, 0x8e, 0xd8, 0xb8, 0x18, 0x00, 0x8e,
-  0xc0, 0xb8, 0x20, 0x00, 0x8e, 0xd0, 0x66, 0x89, 0xca, 0x66, 0x83, 0xe2,
-  0x03, 0x66, 0xc1, 0xe9, 0x02, 0xfc, 0xf3, 0x26, 0x66, 0x67, 0xa5, 0x66,
-  0x89, 0xd1, 0xf3, 0x26, 0x67, 0xa4, 0x0f, 0x20, 0xc0, 0x66, 0x25, 0xfe,
-  0xff, 0xff, 0x7f, 0x0f, 0x22, 0xc0, 0xea, 0xb3, 0x6b, 0x00, 0x00, 0x17,
-  0x1f, 0x07, 0xcb, 0x06, 0x1e, 0x16, 0x8c, 0xc8, 0x2e, 0xa3, 0x07, 0x6c,
-  0x0f, 0x20, 0xc0, 0x66, 0x0d, 0x01, 0x00, 0x00, 0x80, 0x0f, 0x22, 0xc0,
-  0xea, 0xd1, 0x6b, 0x08, 0x00, 0xb8, 0x10, 0x00, 0x8e, 0xd8, 0xb8, 0x18,
-  0x00, 0x8e, 0xc0, 0xb8, 0x20, 0x00, 0x8e, 0xd0, 0x66, 0x89, 0xca, 0x66,
-  0x83, 0xe2, 0x03, 0x66, 0xc1, 0xe9, 0x02, 0xfc, 0xf3, 0x26, 0x66, 0x67,
-  0xa5, 0x66, 0x89, 0xd1, 0xf3, 0x26, 0x67, 0xa4, 0x0f, 0x20, 0xc0, 0x66,
-  0x25, 0xfe, 0xff, 0xff, 0x7f, 0x0f, 0x22, 0xc0, 0xea, 0x09, 0x6c, 0x00,
-  0x00, 0x17, 0x1f, 0x07, 0xcb, 0x55, 0x0e, 0x1e, 0x06, 0x16, 0xbe, 0xe3,
-  0x0d, 0x8e, 0xe6, 0xbe, 0x80, 0x14, 0x64, 0x66, 0x8b, 0x44, 0x04, 0x66,
-  0x50, 0x66, 0x31, 0xc0, 0x66, 0x50, 0x89, 0xe5, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xe0, 0x66, 0x31, 0xff, 0x64, 0xc4, 0x3e, 0xec, 0x0c, 0x66, 0x81, 0xc7,
-  0x00, 0x10, 0x00, 0x00, 0xb8, 0xe3, 0x0d, 0x8e, 0xe0, 0x66, 0x31, 0xf6,
-  0x64, 0xc5, 0x36, 0xf8, 0x0c, 0x66, 0x83, 0xc6, 0x28, 0xb8, 0x01, 0xde,
-  0xcd, 0x67, 0x80, 0xfc, 0x00, 0x74, 0x08, 0x66, 0xb8, 0x01, 0xcc, 0xbb,
-  0xaa, 0xeb, 0xfe, 0x66, 0x89, 0x5e, 0x00, 0xbb, 0xe3, 0x0d, 0x8e, 0xe3,
-  0x64, 0x66, 0xc7, 0x06, 0x98, 0x14, 0x89, 0x6c, 0x00, 0x00, 0x66, 0x31,
-  0xf6, 0xbe, 0xe3, 0x0d, 0x66, 0xc1, 0xe6, 0x04, 0x66, 0x81, 0xc6, 0x88,
-  0x14, 0x00, 0x00, 0xb8, 0x0c, 0xde, 0xcd, 0x67, 0xf4, 0xb8, 0x10, 0x00,
-  0x8e, 0xd8, 0xb8, 0x18, 0x00, 0x8e, 0xc0, 0x8e, 0xe0, 0x8e, 0xe8, 0xb8,
-  0x20, 0x00, 0x8e, 0xd0, 0x0f, 0x20, 0xe0, 0x66, 0x83, 0xc8, 0x10, 0x0f,
-  0x22, 0xe0, 0x66, 0x8b, 0x4e, 0x1e, 0x66, 0x8b, 0x76, 0x1a, 0x66, 0x8b,
-  0x7e, 0x16, 0xfc, 0x66, 0x51, 0x66, 0xc1, 0xe9, 0x02, 0xf3, 0x26, 0x66,
-  0x67, 0xa5, 0x66, 0x59, 0x66, 0x83, 0xe1, 0x03, 0xf3, 0x26, 0x67, 0xa4,
-  0x0f, 0x20, 0xe0, 0x66, 0x83, 0xe0, 0xef, 0x0f, 0x22, 0xe0, 0x66, 0x81,
-  0xe4, 0xff, 0xff, 0x00, 0x00, 0x66, 0x31, 0xc0, 0x8b, 0x46, 0x0c, 0x66,
-  0x50, 0x66, 0x50, 0x66, 0x50, 0x8b, 0x46, 0x0a, 0x66, 0x50, 0x8b, 0x46,
-  0x08, 0x66, 0x50, 0x66, 0x89, 0xe8, 0x66, 0x50, 0x66, 0x9c, 0x8b, 0x46,
-  0x0e, 0x66, 0x50, 0x66, 0x68, 0x18, 0x6d, 0x00, 0x00, 0x66, 0x8b, 0x46,
-  0x04, 0x66, 0x50, 0x66, 0x8b, 0x46, 0x00, 0x66, 0x50, 0x66, 0xb8, 0x0c,
-  0xde, 0x00, 0x00, 0x66, 0x67, 0xff, 0x2c, 0x24, 0x83, 0xc4, 0x10, 0x5d,
-  0xcb, 0x55, 0x66, 0x31, 0xf6, 0x66, 0x31, 0xff, 0xbe, 0xe3, 0x0d, 0x8e,
-  0xe6, 0x64, 0x8b, 0x36, 0xee, 0x0c, 0x66, 0xc1, 0xe6, 0x04, 0x64, 0x8b,
-  0x3e, 0xec, 0x0c, 0x66, 0x01, 0xfe, 0x66, 0x56, 0x0e, 0x1e, 0x06, 0x16,
-  0xbe, 0xe3, 0x0d, 0x8e, 0xe6, 0xbe, 0x80, 0x14, 0x64, 0x66, 0x8b, 0x44,
-  0x04, 0x66, 0x50, 0x66, 0x31, 0xc0, 0x66, 0x50, 0x89, 0xe5, 0xb8, 0xe3,
-  0x0d, 0x8e, 0xe0, 0x66, 0x31, 0xff, 0x64, 0xc4, 0x3e, 0xec, 0x0c, 0x66,
-  0x81, 0xc7, 0x00, 0x80, 0x00, 0x00, 0xb8, 0xe3, 0x0d, 0x8e, 0xe0, 0x66,
-  0x31, 0xf6, 0x64, 0xc5, 0x36, 0xf8, 0x0c, 0x66, 0x83, 0xc6, 0x28, 0xb8,
-  0x01, 0xde, 0xcd, 0x67, 0x80, 0xfc, 0x00, 0x74, 0x08, 0x66, 0xb8, 0x01,
-  0xcc, 0xbb, 0xaa, 0xeb, 0xfe, 0x66, 0x89, 0x5e, 0x00, 0xbb, 0xe3, 0x0d,
-  0x8e, 0xe3, 0x64, 0x66, 0xc7, 0x06, 0x98, 0x14, 0xb7, 0x6d, 0x00, 0x00,
-  0x66, 0x31, 0xf6, 0xbe, 0xe3, 0x0d, 0x66, 0xc1, 0xe6, 0x04, 0x66, 0x81,
-  0xc6, 0x88, 0x14, 0x00, 0x00, 0xb8, 0x0c, 0xde, 0xcd, 0x67, 0xf4, 0xb8,
-  0x10, 0x00, 0x8e, 0xd8, 0xb8, 0x18, 0x00, 0x8e, 0xc0, 0x8e, 0xe0, 0x8e,
-  0xe8, 0xb8, 0x20, 0x00, 0x8e, 0xd0, 0x0f, 0x20, 0xe0, 0x66, 0x83, 0xc8,
-  0x10, 0x0f, 0x22, 0xe0, 0x66, 0x8b, 0x46, 0x10, 0x66, 0x67, 0x8d, 0xb0,
-  0x00, 0x80, 0x00, 0x00, 0x66, 0x67, 0x8d, 0xb8, 0x00, 0x50, 0x00, 0x00,
-  0x66, 0xb9, 0x00, 0x04, 0x00, 0x00, 0xfc, 0x26, 0x66, 0x67, 0xa5, 0x66,
-  0x31, 0xc0, 0x66, 0x67, 0xab, 0xe2, 0xf4, 0x0f, 0x20, 0xc1, 0x66, 0x81,
-  0xe1, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x22, 0xc1, 0x66, 0x8b, 0x5e, 0x10,
-  0x0f, 0x22, 0xdb, 0x0f, 0x20, 0xe0, 0x66, 0x83, 0xc8, 0x30, 0x0f, 0x22,
-  0xe0, 0x66, 0x81, 0xc9, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x22, 0xc1, 0x66,
-  0x8b, 0x4e, 0x22, 0x66, 0x8b, 0x76, 0x1e, 0x66, 0x8b, 0x7e, 0x1a, 0xfc,
-  0x66, 0x51, 0x66, 0xc1, 0xe9, 0x02, 0xf3, 0x26, 0x66, 0x67, 0xa5, 0x66,
-  0x59, 0x66, 0x83, 0xe1, 0x03, 0xf3, 0x26, 0x67, 0xa4, 0x0f, 0x20, 0xc1,
-  0x66, 0x81, 0xe1, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x22, 0xc1, 0x66, 0x8b,
-  0x5e, 0x10, 0x66, 0x81, 0xc3, 0x00, 0x70, 0x00, 0x00, 0x0f, 0x22, 0xdb,
-  0x0f, 0x20, 0xe0, 0x66, 0x83, 0xe0, 0xcf, 0x0f, 0x22, 0xe0, 0x66, 0x81,
-  0xc9, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x22, 0xc1, 0x66, 0x81, 0xe4, 0xff,
-  0xff, 0x00, 0x00, 0x66, 0x31, 0xc0, 0x8b, 0x46, 0x0c, 0x66, 0x50, 0x66,
-  0x50, 0x66, 0x50, 0x8b, 0x46, 0x0a, 0x66, 0x50, 0x8b, 0x46, 0x08, 0x66,
-  0x50, 0x66, 0x89, 0xe8, 0x66, 0x50, 0x66, 0x9c, 0x8b, 0x46, 0x0e, 0x66,
-  0x50, 0x66, 0x68, 0xba, 0x6e, 0x00, 0x00, 0x66, 0x8b, 0x46, 0x04, 0x66,
-  0x50, 0x66, 0x8b, 0x46, 0x00, 0x66, 0x50, 0x66, 0xb8, 0x0c, 0xde, 0x00,
-  0x00, 0x66, 0x67, 0xff, 0x2c, 0x24, 0x83, 0xc4, 0x14, 0x5d, 0xcb, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x60, 0x1e, 0x06,
-  0x0e, 0x16, 0xfa, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x31, 0xc0, 0x8a, 0x1e,
-  0x5a, 0x0d, 0x2e, 0x88, 0x1e, 0xbf, 0x6e, 0x80, 0xfb, 0x20, 0x75, 0x02,
-  0x0c, 0x01, 0xbb, 0xe3, 0x0d, 0x8e, 0xc3, 0x26, 0x8e, 0x06, 0x58, 0x0d,
-  0xbb, 0xe3, 0x0d, 0x8e, 0xdb, 0x8b, 0x1e, 0x50, 0x0d, 0x2e, 0x89, 0x1e,
-  0xc0, 0x6e, 0x8b, 0x1e, 0x52, 0x0d, 0x2e, 0x89, 0x1e, 0xc2, 0x6e, 0x8c,
-  0xcb, 0x8e, 0xdb, 0x2e, 0xff, 0x1e, 0xc0, 0x6e, 0x73, 0x12, 0xb8, 0xe3,
-  0x0d, 0x8e, 0xd8, 0xc6, 0x06, 0x5a, 0x0d, 0x00, 0x83, 0xc4, 0x04, 0x07,
-  0x1f, 0x61, 0x9d, 0xcb, 0xb8, 0x06, 0x03, 0xcd, 0x31, 0x89, 0x0e, 0xc6,
-  0x6e, 0x89, 0x1e, 0xc8, 0x6e, 0x8c, 0x0e, 0xca, 0x6e, 0x8c, 0x1e, 0xcc,
-  0x6e, 0x8c, 0x06, 0xce, 0x6e, 0x8c, 0x16, 0xd0, 0x6e, 0x80, 0x3e, 0xbf,
-  0x6e, 0x20, 0x75, 0x19, 0x66, 0x89, 0x3e, 0xc0, 0x6e, 0x89, 0x36, 0xc4,
-  0x6e, 0x5a, 0x58, 0x89, 0xc1, 0x89, 0xc6, 0x89, 0xe3, 0xbf, 0x84, 0x6f,
-  0x66, 0xff, 0x2e, 0xc0, 0x6e, 0x89, 0x3e, 0xc0, 0x6e, 0x89, 0x36, 0xc2,
-  0x6e, 0x5a, 0x58, 0x89, 0xc1, 0x89, 0xc6, 0x89, 0xe3, 0xbf, 0x84, 0x6f,
-  0xff, 0x2e, 0xc0, 0x6e, 0x2e, 0xa1, 0xc6, 0x6e, 0x2e, 0x8b, 0x1e, 0xc8,
-  0x6e, 0xb9, 0xe3, 0x0d, 0x8e, 0xd9, 0xa3, 0x68, 0x0d, 0x89, 0x1e, 0x6a,
-  0x0d, 0x2e, 0xa1, 0xc0, 0x6e, 0x2e, 0x8b, 0x1e, 0xc2, 0x6e, 0x2e, 0x8b,
-  0x0e, 0xc4, 0x6e, 0xba, 0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0x60, 0x0d, 0x89,
-  0x1e, 0x62, 0x0d, 0x89, 0x0e, 0x64, 0x0d, 0x2e, 0xa1, 0xca, 0x6e, 0xba,
-  0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0x7a, 0x15, 0x2e, 0xa1, 0xcc, 0x6e, 0xba,
-  0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0x78, 0x15, 0x2e, 0xa1, 0xce, 0x6e, 0xba,
-  0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0x76, 0x15, 0x2e, 0xa1, 0xd0, 0x6e, 0xba,
-  0xe3, 0x0d, 0x8e, 0xda, 0xa3, 0x7c, 0x15, 0xe8, 0x09, 0x00, 0x07, 0x1f,
-  0x61, 0x9d, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x53, 0x51, 0x31,
-  0xc0, 0x8e, 0xc0, 0x8c, 0xc8, 0x26, 0x8b, 0x1e, 0x84, 0x00, 0x26, 0x8b,
-  0x0e, 0x86, 0x00, 0x26, 0xc7, 0x06, 0x84, 0x00, 0x2a, 0x70, 0x26, 0xa3,
-  0x86, 0x00, 0x2e, 0x89, 0x1e, 0xef, 0x6f, 0x2e, 0x89, 0x0e, 0xf1, 0x6f,
-  0xb4, 0x62, 0xcd, 0x21, 0x2e, 0x89, 0x1e, 0xd2, 0x6e, 0x59, 0x5b, 0x58,
-  0x07, 0xc3, 0x80, 0xfc, 0x4c, 0x74, 0x05, 0x2e, 0xff, 0x2e, 0xef, 0x6f,
-  0x50, 0x53, 0xb4, 0x62, 0xcd, 0x21, 0x2e, 0x3b, 0x1e, 0xd2, 0x6e, 0x74,
-  0x07, 0x5b, 0x58, 0x2e, 0xff, 0x2e, 0xef, 0x6f, 0x5b, 0x58, 0x06, 0x50,
-  0x53, 0x51, 0x31, 0xc0, 0x8e, 0xc0, 0x8c, 0xc8, 0x2e, 0x8b, 0x1e, 0xef,
-  0x6f, 0x2e, 0x8b, 0x0e, 0xf1, 0x6f, 0x26, 0x89, 0x1e, 0x84, 0x00, 0x26,
-  0x89, 0x0e, 0x86, 0x00, 0x59, 0x5b, 0x58, 0x07, 0xfa, 0x89, 0xc5, 0x2e,
-  0xa1, 0xcc, 0x6e, 0x89, 0xc1, 0x89, 0xc2, 0x89, 0xe3, 0x2e, 0x8b, 0x36,
-  0xca, 0x6e, 0xbf, 0x86, 0x70, 0x2e, 0xff, 0x2e, 0xc6, 0x6e, 0x89, 0xe8,
-  0xb4, 0x4c, 0xcd, 0x21, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x89, 0xe5, 0x66, 0x8b, 0x46, 0x06,
-  0x2e, 0x66, 0xa3, 0x8d, 0x70, 0x66, 0x8b, 0x46, 0x0a, 0x2e, 0x66, 0xa3,
-  0x91, 0x70, 0x66, 0x8b, 0x46, 0x0e, 0x2e, 0x66, 0xa3, 0x95, 0x70, 0x60,
-  0x1e, 0x06, 0x0e, 0x16, 0x1e, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x31, 0xc0,
-  0x2e, 0xa3, 0x99, 0x70, 0x66, 0xa1, 0x60, 0x0d, 0x2e, 0x66, 0xa3, 0x9b,
-  0x70, 0xa1, 0x64, 0x0d, 0x2e, 0xa3, 0x9f, 0x70, 0xa1, 0x78, 0x15, 0x89,
-  0xc1, 0x8b, 0x16, 0x7c, 0x15, 0x89, 0xe3, 0x8b, 0x36, 0x7a, 0x15, 0xbf,
-  0x04, 0x71, 0xff, 0x1e, 0x68, 0x0d, 0x83, 0xc4, 0x06, 0x07, 0x1f, 0x61,
-  0x5d, 0x31, 0xc0, 0xcb, 0x83, 0x3e, 0xa1, 0x70, 0x00, 0x75, 0x4f, 0x31,
-  0xc0, 0xb9, 0x02, 0x00, 0xcd, 0x31, 0x73, 0x03, 0xe9, 0x96, 0x00, 0xa3,
-  0xa1, 0x70, 0x83, 0xc0, 0x08, 0xa3, 0xa3, 0x70, 0xb8, 0x09, 0x00, 0x8b,
-  0x1e, 0xa1, 0x70, 0xb1, 0xf0, 0x30, 0xed, 0xcd, 0x31, 0x72, 0xfe, 0xb8,
-  0x08, 0x00, 0x8b, 0x1e, 0xa1, 0x70, 0x31, 0xc9, 0x31, 0xd2, 0x4a, 0xcd,
-  0x31, 0xb8, 0x09, 0x00, 0x8b, 0x1e, 0xa3, 0x70, 0xb1, 0xf2, 0x30, 0xed,
-  0xcd, 0x31, 0x72, 0xfe, 0xb8, 0x08, 0x00, 0x8b, 0x1e, 0xa3, 0x70, 0x31,
-  0xc9, 0x31, 0xd2, 0x4a, 0xcd, 0x31, 0xb8, 0x07, 0x00, 0x8b, 0x1e, 0xa1,
-  0x70, 0x8b, 0x16, 0x91, 0x70, 0x8b, 0x0e, 0x93, 0x70, 0xcd, 0x31, 0x66,
-  0x0f, 0xb7, 0x06, 0x8f, 0x70, 0x66, 0xc1, 0xe0, 0x04, 0x66, 0x0f, 0xb7,
-  0x1e, 0x8d, 0x70, 0x66, 0x01, 0xd8, 0x89, 0xc2, 0x66, 0xc1, 0xe8, 0x10,
-  0x89, 0xc1, 0x8b, 0x1e, 0xa3, 0x70, 0xb8, 0x07, 0x00, 0xcd, 0x31, 0x8b,
-  0x0e, 0x95, 0x70, 0x89, 0x0e, 0x99, 0x70, 0x1e, 0x06, 0xfc, 0xa1, 0xa1,
-  0x70, 0x8b, 0x1e, 0xa3, 0x70, 0x8e, 0xd8, 0x8e, 0xc3, 0x31, 0xf6, 0x89,
-  0xf7, 0xf3, 0xa4, 0x07, 0x1f, 0x58, 0x89, 0xc1, 0x5a, 0x5e, 0x89, 0xe3,
-  0xbf, 0xbc, 0x71, 0x66, 0xff, 0x1e, 0x9b, 0x70, 0x07, 0x1f, 0x61, 0x5d,
-  0x2e, 0xa1, 0x99, 0x70, 0xcb, 0x55, 0x89, 0xe5, 0x8b, 0x46, 0x06, 0x2e,
-  0xa3, 0x8d, 0x70, 0x8b, 0x46, 0x08, 0x2e, 0xa3, 0x8f, 0x70, 0x8b, 0x46,
-  0x0a, 0x2e, 0xa3, 0x91, 0x70, 0x8b, 0x46, 0x0c, 0x2e, 0xa3, 0x93, 0x70,
-  0x8b, 0x46, 0x0e, 0x2e, 0xa3, 0x95, 0x70, 0x8b, 0x46, 0x10, 0x2e, 0xa3,
-  0x97, 0x70, 0x60, 0x1e, 0x06, 0x0e, 0x16, 0x1e, 0xb8, 0xe3, 0x0d, 0x8e,
-  0xd8, 0x31, 0xc0, 0x2e, 0xa3, 0x99, 0x70, 0x66, 0xa1, 0x60, 0x0d, 0x2e,
-  0x66, 0xa3, 0x9b, 0x70, 0xa1, 0x64, 0x0d, 0x2e, 0xa3, 0x9f, 0x70, 0xa1,
-  0x78, 0x15, 0x89, 0xc1, 0x8b, 0x16, 0x7c, 0x15, 0x89, 0xe3, 0x8b, 0x36,
-  0x7a, 0x15, 0xbf, 0x33, 0x72, 0xff, 0x1e, 0x68, 0x0d, 0x83, 0xc4, 0x06,
-  0x07, 0x1f, 0x61, 0x5d, 0x31, 0xc0, 0xcb, 0x83, 0x3e, 0xa1, 0x70, 0x00,
-  0x75, 0x4f, 0x31, 0xc0, 0xb9, 0x02, 0x00, 0xcd, 0x31, 0x73, 0x03, 0xe9,
-  0x8e, 0x00, 0xa3, 0xa1, 0x70, 0x83, 0xc0, 0x08, 0xa3, 0xa3, 0x70, 0xb8,
-  0x09, 0x00, 0x8b, 0x1e, 0xa1, 0x70, 0xb1, 0xf0, 0x30, 0xed, 0xcd, 0x31,
-  0x72, 0xfe, 0xb8, 0x08, 0x00, 0x8b, 0x1e, 0xa1, 0x70, 0x31, 0xc9, 0x31,
-  0xd2, 0x4a, 0xcd, 0x31, 0xb8, 0x09, 0x00, 0x8b, 0x1e, 0xa3, 0x70, 0xb1,
-  0xf2, 0x30, 0xed, 0xcd, 0x31, 0x72, 0xfe, 0xb8, 0x08, 0x00, 0x8b, 0x1e,
-  0xa3, 0x70, 0x31, 0xc9, 0x31, 0xd2, 0x4a, 0xcd, 0x31, 0xb8, 0x07, 0x00,
-  0x8b, 0x1e, 0xa1, 0x70, 0x8b, 0x16, 0x91, 0x70, 0x8b, 0x0e, 0x93, 0x70,
-  0xcd, 0x31, 0x8b, 0x16, 0x8f, 0x70, 0x89, 0xd1, 0xc1, 0xe9, 0x0c, 0xc1,
-  0xe2, 0x04, 0x03, 0x16, 0x8d, 0x70, 0x83, 0xd1, 0x00, 0x8b, 0x1e, 0xa3,
-  0x70, 0xb8, 0x07, 0x00, 0xcd, 0x31, 0x8b, 0x0e, 0x95, 0x70, 0x89, 0x0e,
-  0x99, 0x70, 0x1e, 0x06, 0xfc, 0xa1, 0xa1, 0x70, 0x8b, 0x1e, 0xa3, 0x70,
-  0x8e, 0xd8, 0x8e, 0xc3, 0x31, 0xf6, 0x89, 0xf7, 0xf3, 0xa4, 0x07, 0x1f,
-  0x58, 0x89, 0xc1, 0x5a, 0x5e, 0x89, 0xe3, 0xbf, 0xe2, 0x72, 0xff, 0x1e,
-  0x9b, 0x70, 0x07, 0x1f, 0x61, 0x5d, 0x2e, 0xa1, 0x99, 0x70, 0xcb, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x55, 0x0e, 0xe8, 0x07, 0x00, 0x5d, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0xcb, 0xdb, 0xe3, 0xc7, 0x06, 0x16, 0x0e, 0x5a, 0x5a,
-  0xdd, 0x3e, 0x16, 0x0e, 0x83, 0x3e, 0x16, 0x0e, 0x00, 0x75, 0x14, 0xd9,
-  0x3e, 0x16, 0x0e, 0xa1, 0x16, 0x0e, 0x25, 0x3f, 0x10, 0x83, 0xf8, 0x3f,
-  0x75, 0x05, 0x80, 0x0e, 0x14, 0x0e, 0x02, 0x9c, 0x58, 0x25, 0xff, 0x0f,
-  0x50, 0x9d, 0x9c, 0x58, 0x25, 0x00, 0xf0, 0x3d, 0x00, 0xf0, 0x75, 0x04,
-  0xb8, 0x00, 0x00, 0xcb, 0x9c, 0x0d, 0x00, 0xf0, 0x50, 0x9d, 0x9c, 0x58,
-  0x9d, 0x25, 0x00, 0xf0, 0x75, 0x04, 0xb8, 0x02, 0x00, 0xcb, 0x0f, 0x01,
-  0xe0, 0x24, 0x01, 0xb1, 0x03, 0xd2, 0xe0, 0x08, 0x06, 0x14, 0x0e, 0x66,
-  0x9c, 0x66, 0x58, 0x66, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x66, 0x50, 0x66,
-  0x9d, 0x66, 0x9c, 0x66, 0x58, 0x66, 0xa9, 0x00, 0x00, 0x04, 0x00, 0x75,
-  0x04, 0xb8, 0x03, 0x00, 0xcb, 0x66, 0x25, 0xff, 0xff, 0xdf, 0xff, 0x66,
-  0x50, 0x66, 0x9d, 0x66, 0x9c, 0x66, 0x58, 0x66, 0xa9, 0x00, 0x00, 0x20,
-  0x00, 0x75, 0x67, 0x66, 0x0d, 0x00, 0x00, 0x20, 0x00, 0x66, 0x50, 0x66,
-  0x9d, 0x66, 0x9c, 0x66, 0x58, 0x66, 0xa9, 0x00, 0x00, 0x20, 0x00, 0x74,
-  0x51, 0x80, 0x0e, 0x14, 0x0e, 0x01, 0x66, 0x31, 0xc0, 0x0f, 0xa2, 0xbe,
-  0xe0, 0x0d, 0x66, 0x89, 0x1c, 0x66, 0x89, 0x54, 0x04, 0x66, 0x89, 0x4c,
-  0x08, 0xc6, 0x44, 0x0c, 0x00, 0x66, 0xa3, 0x10, 0x0e, 0x66, 0xb8, 0x01,
-  0x00, 0x00, 0x00, 0x0f, 0xa2, 0xbe, 0xfd, 0x0d, 0x66, 0x89, 0x04, 0x66,
-  0x89, 0x5c, 0x04, 0x66, 0x89, 0x54, 0x08, 0x66, 0x89, 0x4c, 0x0c, 0x66,
-  0xc1, 0xe8, 0x08, 0x66, 0x83, 0xe0, 0x0f, 0x3c, 0x04, 0x74, 0x0a, 0x3c,
-  0x05, 0x74, 0x06, 0x3c, 0x06, 0x74, 0x02, 0xb0, 0x06, 0xcb, 0xb8, 0x04,
-  0x00, 0xcb, 0x55, 0x89, 0xe5, 0x8b, 0x56, 0x06, 0x66, 0xed, 0x89, 0xc2,
-  0x66, 0xc1, 0xe8, 0x10, 0x92, 0x5d, 0xcb, 0x55, 0x89, 0xe5, 0x8b, 0x56,
-  0x06, 0x66, 0x8b, 0x46, 0x08, 0x66, 0xef, 0x5d, 0xcb, 0x66, 0x50, 0x66,
-  0x51, 0x66, 0x52, 0x66, 0xb9, 0x19, 0x01, 0x00, 0x00, 0x0f, 0x32, 0x66,
-  0x0d, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x30, 0x66, 0x5a, 0x66, 0x59, 0x66,
-  0x58, 0xcb, 0x1e, 0x66, 0x50, 0x66, 0x53, 0x66, 0x51, 0x66, 0x52, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0x66, 0x31, 0xdb, 0x66, 0x89, 0xd9, 0x66, 0x89,
-  0xda, 0x66, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x0f, 0xa2, 0x66, 0x89, 0x16,
-  0xed, 0x0d, 0x66, 0x89, 0x0e, 0xf1, 0x0d, 0x66, 0x89, 0x1e, 0xf5, 0x0d,
-  0x66, 0xa3, 0xf9, 0x0d, 0x66, 0x5a, 0x66, 0x59, 0x66, 0x5b, 0x66, 0x58,
-  0x1f, 0xcb, 0xfa, 0xea, 0x00, 0x00, 0xff, 0xff, 0xfa, 0xb8, 0x00, 0xb8,
-  0x8e, 0xd8, 0xc7, 0x06, 0x00, 0x00, 0x30, 0x1e, 0xb8, 0x50, 0x00, 0x8e,
-  0xd8, 0xa1, 0x08, 0x00, 0x89, 0xc4, 0xa1, 0x0a, 0x00, 0x8e, 0xd0, 0x8b,
-  0x1e, 0x0c, 0x00, 0x3e, 0xff, 0x36, 0x06, 0x00, 0x3e, 0xff, 0x36, 0x04,
-  0x00, 0x8e, 0xdb, 0x8e, 0xc3, 0xcb, 0x9c, 0xfa, 0x0f, 0x31, 0x66, 0x92,
-  0x66, 0x89, 0xd1, 0x66, 0x89, 0xc3, 0x66, 0xc1, 0xe8, 0x10, 0x66, 0xc1,
-  0xe9, 0x10, 0x9d, 0xcb, 0x9c, 0x50, 0x53, 0x51, 0x52, 0xfa, 0x66, 0xc1,
-  0xe0, 0x10, 0x89, 0xd8, 0x66, 0xc1, 0xe1, 0x10, 0x66, 0x81, 0xe2, 0xff,
-  0xff, 0x00, 0x00, 0x66, 0x09, 0xca, 0x66, 0x92, 0x66, 0xb9, 0x10, 0x00,
-  0x00, 0x00, 0x0f, 0x30, 0x5a, 0x59, 0x5b, 0x58, 0x9d, 0xcb, 0x1e, 0x06,
-  0x9c, 0x50, 0x53, 0x51, 0x52, 0x56, 0xfa, 0x66, 0xc1, 0xe2, 0x10, 0x66,
-  0x25, 0xff, 0xff, 0x00, 0x00, 0x66, 0x09, 0xd0, 0x8c, 0xda, 0x8e, 0xc2,
-  0x8e, 0xd9, 0x89, 0xde, 0x0f, 0xa2, 0x66, 0x89, 0x04, 0x66, 0x89, 0x5c,
-  0x04, 0x66, 0x89, 0x4c, 0x08, 0x66, 0x89, 0x54, 0x0c, 0x5e, 0x5a, 0x59,
-  0x5b, 0x58, 0x9d, 0x07, 0x1f, 0xcb, 0x1e, 0x06, 0x16, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0xa1, 0x60, 0x0d, 0x2e, 0xa3, 0x31, 0x76, 0xa1, 0x62, 0x0d,
-  0x2e, 0xa3, 0x33, 0x76, 0xa1, 0x64, 0x0d, 0x2e, 0xa3, 0x35, 0x76, 0x2e,
-  0x8c, 0x0e, 0x29, 0x76, 0x2e, 0x8c, 0x16, 0x2b, 0x76, 0x89, 0xe0, 0x2e,
-  0xa3, 0x2d, 0x76, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0xa0, 0x5a, 0x0d, 0x2e,
-  0xa2, 0x2f, 0x76, 0x2e, 0xc6, 0x06, 0x30, 0x76, 0x00, 0xb8, 0xe3, 0x0d,
-  0x8e, 0xd8, 0xa1, 0x78, 0x15, 0x89, 0xc1, 0xba, 0xe3, 0x0d, 0x8e, 0xda,
-  0x8b, 0x16, 0x7c, 0x15, 0xbe, 0xe3, 0x0d, 0x8e, 0xde, 0x8b, 0x36, 0x7a,
-  0x15, 0xbb, 0xe3, 0x0d, 0x8e, 0xc3, 0x89, 0xe3, 0xbf, 0x84, 0x75, 0x26,
-  0xff, 0x2e, 0x68, 0x0d, 0x2e, 0x80, 0x3e, 0x2f, 0x76, 0x20, 0x74, 0x38,
-  0xb8, 0x02, 0x02, 0xb3, 0x06, 0xcd, 0x31, 0x51, 0x52, 0xb8, 0x03, 0x02,
-  0xb3, 0x06, 0x8c, 0xc9, 0x66, 0xba, 0x1b, 0x76, 0x00, 0x00, 0xcd, 0x31,
-  0x0f, 0x57, 0xc0, 0x5a, 0x59, 0xb8, 0x03, 0x02, 0xb3, 0x06, 0xcd, 0x31,
-  0xa1, 0x29, 0x76, 0x89, 0xc1, 0x89, 0xc6, 0x8b, 0x16, 0x2b, 0x76, 0x89,
-  0xe3, 0xbf, 0x01, 0x76, 0xff, 0x2e, 0x31, 0x76, 0xb8, 0x02, 0x02, 0xb3,
-  0x06, 0xcd, 0x31, 0x66, 0x51, 0x66, 0x52, 0xb8, 0x03, 0x02, 0xb3, 0x06,
-  0x8c, 0xc9, 0x66, 0xba, 0x0b, 0x76, 0x00, 0x00, 0xcd, 0x31, 0x0f, 0x57,
-  0xc0, 0x66, 0x5a, 0x66, 0x59, 0xb8, 0x03, 0x02, 0xb3, 0x06, 0xcd, 0x31,
-  0xa1, 0x29, 0x76, 0x89, 0xc1, 0x89, 0xc6, 0x8b, 0x16, 0x2b, 0x76, 0x89,
-  0xe3, 0xbf, 0x01, 0x76, 0x66, 0xff, 0x2e, 0x31, 0x76, 0x17, 0x07, 0x1f,
-  0x2e, 0x0f, 0xb6, 0x06, 0x30, 0x76, 0xcb, 0x55, 0x89, 0xe5, 0xc6, 0x06,
-  0x30, 0x76, 0x01, 0x66, 0x83, 0x46, 0x0e, 0x03, 0x5d, 0x66, 0xcb, 0x55,
-  0x89, 0xe5, 0xc6, 0x06, 0x30, 0x76, 0x01, 0x83, 0x46, 0x08, 0x03, 0x5d,
-  0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89,
-  0xc3, 0x89, 0xd7, 0x31, 0xc0, 0x89, 0x46, 0xf0, 0x89, 0x46, 0xf2, 0x36,
-  0x80, 0x3e, 0x0d, 0x0e, 0x03, 0x7c, 0x49, 0x36, 0xf6, 0x06, 0x14, 0x0e,
-  0x08, 0x75, 0x08, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74, 0x05, 0x31,
-  0xc0, 0xe9, 0xd6, 0x00, 0x85, 0xd2, 0x75, 0x0a, 0x83, 0xfb, 0xff, 0x73,
-  0x05, 0xbb, 0xff, 0xff, 0x31, 0xd7, 0xb8, 0x28, 0x00, 0xb1, 0x0c, 0xd3,
-  0xeb, 0xd3, 0xcf, 0x31, 0xfb, 0x81, 0xe7, 0x0f, 0x00, 0x31, 0xfb, 0x0e,
-  0x3e, 0xe8, 0xe6, 0xa1, 0x89, 0x46, 0xf4, 0x89, 0x56, 0xf6, 0x85, 0xd2,
-  0x75, 0x10, 0x85, 0xc0, 0x75, 0x0c, 0x31, 0xc0, 0x8d, 0x66, 0xf8, 0x5f,
-  0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x89, 0xc6, 0x83, 0xc6, 0x0f, 0x83,
-  0xe6, 0xf0, 0xb1, 0x04, 0x89, 0xf2, 0xd3, 0xea, 0x03, 0x56, 0xf6, 0x83,
-  0xe6, 0x0f, 0x8e, 0xda, 0xc7, 0x44, 0x04, 0x00, 0x00, 0x83, 0xe7, 0x0f,
-  0xc7, 0x44, 0x06, 0x00, 0x00, 0x81, 0xcf, 0x80, 0x00, 0x89, 0x5c, 0x08,
-  0x89, 0x7c, 0x0e, 0x52, 0x8b, 0x44, 0x06, 0x8b, 0x5e, 0xf2, 0x89, 0x44,
-  0x02, 0x8b, 0x46, 0xf0, 0x8b, 0x4c, 0x04, 0x89, 0x44, 0x0a, 0x31, 0xc0,
-  0x31, 0xff, 0x80, 0xcc, 0x93, 0x09, 0xc3, 0x89, 0x5c, 0x0c, 0xbb, 0x00,
-  0x00, 0x89, 0x0c, 0xb1, 0x04, 0xd3, 0xe7, 0xd3, 0xc3, 0x31, 0xdf, 0x81,
-  0xe3, 0xf0, 0xff, 0x31, 0xdf, 0x56, 0xb1, 0x04, 0xbb, 0x00, 0x00, 0xc7,
-  0x44, 0x16, 0x8f, 0x00, 0xd3, 0xe3, 0x31, 0xc0, 0x89, 0x5c, 0x12, 0x0d,
-  0xff, 0xff, 0x89, 0x44, 0x10, 0x8c, 0xd0, 0x81, 0xcf, 0x00, 0x9b, 0x89,
-  0x7c, 0x14, 0x8e, 0xd8, 0x0e, 0xe8, 0xba, 0xf3, 0x90, 0x8b, 0x46, 0xf4,
-  0x83, 0xc4, 0x04, 0x8b, 0x56, 0xf6, 0x0e, 0xe8, 0xf2, 0xa0, 0x90, 0xb8,
-  0x01, 0x00, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x58, 0x50, 0x89, 0xd6,
-  0x89, 0xca, 0xb9, 0x40, 0x00, 0x8d, 0x7e, 0xa4, 0x8c, 0x56, 0xfa, 0x30,
-  0xc0, 0x8e, 0x46, 0xfa, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13,
-  0xc9, 0xf3, 0xaa, 0x5f, 0xc7, 0x46, 0xb4, 0xff, 0xff, 0x89, 0xd0, 0x89,
-  0xd9, 0x30, 0xe4, 0x83, 0xc1, 0x00, 0x15, 0x00, 0x93, 0x89, 0x4e, 0xb6,
-  0x89, 0x46, 0xb8, 0x81, 0xfa, 0x00, 0x01, 0x77, 0x02, 0x75, 0x0a, 0x30,
-  0xd2, 0x89, 0xd0, 0x05, 0x8f, 0x00, 0x89, 0x46, 0xba, 0xc7, 0x46, 0xbc,
-  0xff, 0xff, 0x89, 0xf0, 0x8b, 0x56, 0xa2, 0x30, 0xe4, 0x83, 0xc2, 0x00,
-  0x15, 0x00, 0x93, 0x89, 0x56, 0xbe, 0x89, 0x46, 0xc0, 0x81, 0xfe, 0x00,
-  0x01, 0x77, 0x02, 0x75, 0x0b, 0x81, 0xe6, 0x00, 0xff, 0x81, 0xc6, 0x8f,
-  0x00, 0x89, 0x76, 0xc2, 0xc6, 0x46, 0xe5, 0x87, 0x8b, 0x46, 0x06, 0x8b,
-  0x56, 0x08, 0x8d, 0x5e, 0xe4, 0x16, 0xd1, 0xea, 0xd1, 0xd8, 0x8c, 0xd1,
-  0x8d, 0x56, 0xf2, 0x89, 0x46, 0xe8, 0x8d, 0x46, 0xa4, 0x52, 0x8d, 0x56,
-  0xe4, 0x89, 0x46, 0xec, 0x16, 0xb8, 0x15, 0x00, 0x52, 0x8c, 0x56, 0xf2,
-  0x0e, 0xe8, 0x6f, 0xa3, 0x90, 0x8a, 0x46, 0xe5, 0x84, 0xc0, 0x75, 0x04,
-  0x30, 0xe4, 0xeb, 0x03, 0xb8, 0xff, 0xff, 0x8d, 0x66, 0xfc, 0x5f, 0x5e,
-  0x5d, 0x4d, 0xca, 0x04, 0x00, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57,
-  0x83, 0xec, 0x0a, 0x89, 0xc7, 0x89, 0x56, 0xfa, 0x89, 0xde, 0x89, 0x4e,
-  0xf8, 0x8b, 0x46, 0x08, 0x0b, 0x46, 0x06, 0x74, 0x41, 0x36, 0x80, 0x3e,
-  0x0d, 0x0e, 0xff, 0x75, 0x05, 0x0e, 0x3e, 0xe8, 0xc4, 0x18, 0x36, 0x80,
-  0x3e, 0x0d, 0x0e, 0x02, 0x7d, 0x06, 0xb8, 0xff, 0xff, 0xe9, 0xfd, 0x00,
-  0x8b, 0x46, 0x08, 0x3d, 0x01, 0x00, 0x77, 0x02, 0x75, 0x3b, 0xb8, 0x01,
-  0x00, 0x8b, 0x4e, 0xf8, 0x8b, 0x56, 0xfa, 0x50, 0x31, 0xc0, 0x89, 0xf3,
-  0x50, 0x89, 0xf8, 0x0e, 0xe8, 0xe5, 0xfe, 0x85, 0xc0, 0x74, 0x0d, 0xb8,
-  0xff, 0xff, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04, 0x00,
-  0x01, 0x46, 0x06, 0x83, 0x56, 0x08, 0xff, 0x01, 0xc7, 0x83, 0x56, 0xfa,
-  0x01, 0x01, 0xc6, 0x83, 0x56, 0xf8, 0x01, 0xeb, 0xbb, 0x85, 0xc0, 0x75,
-  0x06, 0x83, 0x7e, 0x06, 0x02, 0x72, 0x49, 0x8b, 0x46, 0x06, 0x8b, 0x4e,
-  0xf8, 0x8b, 0x56, 0xfa, 0x24, 0xfe, 0x89, 0x46, 0xf4, 0x8b, 0x46, 0x08,
-  0x89, 0xf3, 0x50, 0x89, 0x46, 0xf6, 0xff, 0x76, 0xf4, 0x89, 0xf8, 0x0e,
-  0xe8, 0x95, 0xfe, 0x85, 0xc0, 0x74, 0x0d, 0xb8, 0xff, 0xff, 0x8d, 0x66,
-  0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04, 0x00, 0xc7, 0x46, 0x08, 0x00,
-  0x00, 0x03, 0x7e, 0xf4, 0x8b, 0x46, 0xf6, 0x11, 0x46, 0xfa, 0x03, 0x76,
-  0xf4, 0x11, 0x46, 0xf8, 0x83, 0x66, 0x06, 0x01, 0x8b, 0x46, 0x08, 0x0b,
-  0x46, 0x06, 0x74, 0x5b, 0x31, 0xc0, 0x50, 0xb8, 0x02, 0x00, 0x31, 0xd2,
-  0x50, 0x8c, 0xd0, 0xb1, 0x04, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2, 0x81,
-  0xe0, 0xf0, 0xff, 0x31, 0xc2, 0x8d, 0x5e, 0xf2, 0x31, 0xc9, 0x01, 0xd8,
-  0x89, 0xf3, 0x11, 0xca, 0x8b, 0x4e, 0xf8, 0x0e, 0xe8, 0x39, 0xfe, 0x85,
-  0xc0, 0x74, 0x0d, 0xb8, 0xff, 0xff, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d,
-  0x4d, 0xca, 0x04, 0x00, 0x8b, 0x56, 0xfa, 0x89, 0xf8, 0x89, 0xfe, 0xb1,
-  0x04, 0xd3, 0xe8, 0xd3, 0xca, 0x31, 0xd0, 0x81, 0xe2, 0xff, 0x0f, 0x31,
-  0xd0, 0x83, 0xe6, 0x0f, 0x8e, 0xd8, 0x8a, 0x46, 0xf2, 0x88, 0x04, 0x31,
-  0xc0, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x08, 0x50, 0x89, 0x5e,
-  0xf4, 0x89, 0x4e, 0xf6, 0x89, 0x56, 0xf8, 0xc7, 0x46, 0xfa, 0xff, 0xff,
-  0xb4, 0x3f, 0x8b, 0x9e, 0xf2, 0xff, 0x8b, 0x8e, 0xf8, 0xff, 0x8b, 0x96,
-  0xf4, 0xff, 0x8b, 0xb6, 0xf6, 0xff, 0x1e, 0x8e, 0xde, 0xcd, 0x21, 0x1f,
-  0x8b, 0xd8, 0x19, 0xdb, 0x0b, 0xc3, 0x89, 0x86, 0xfa, 0xff, 0x8b, 0x46,
-  0xfa, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x08, 0x50, 0x89, 0x5e, 0xf4, 0x89,
-  0x4e, 0xf6, 0x89, 0x56, 0xf8, 0xc7, 0x46, 0xfa, 0xff, 0xff, 0xb4, 0x40,
-  0x8b, 0x9e, 0xf2, 0xff, 0x8b, 0x8e, 0xf8, 0xff, 0x8b, 0x96, 0xf4, 0xff,
-  0x8b, 0xb6, 0xf6, 0xff, 0x1e, 0x8e, 0xde, 0xcd, 0x21, 0x1f, 0x8b, 0xd8,
-  0x19, 0xdb, 0x0b, 0xc3, 0x89, 0x86, 0xfa, 0xff, 0x8b, 0x46, 0xfa, 0x8d,
-  0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x0e, 0x36, 0x80, 0x3e, 0x4c,
-  0x0d, 0x00, 0x75, 0x14, 0x36, 0x80, 0x3e, 0x28, 0x0d, 0x01, 0x75, 0x0f,
-  0x36, 0xc6, 0x06, 0x54, 0x0d, 0x00, 0x36, 0xc6, 0x06, 0x4c, 0x0d, 0x01,
-  0xe9, 0x7f, 0x00, 0x30, 0xc0, 0x88, 0x46, 0xf4, 0x88, 0x46, 0xf2, 0x30,
-  0xe4, 0x89, 0x46, 0xec, 0x89, 0x46, 0xee, 0x89, 0x46, 0xf0, 0x89, 0x46,
-  0xe8, 0x89, 0x46, 0xea, 0x06, 0xb8, 0x87, 0x16, 0xcd, 0x2f, 0x0b, 0xc0,
-  0x75, 0x1e, 0xc6, 0x86, 0xf4, 0xff, 0x01, 0x89, 0x9e, 0xf0, 0xff, 0x88,
-  0x8e, 0xf2, 0xff, 0x89, 0x96, 0xec, 0xff, 0x89, 0xb6, 0xee, 0xff, 0x89,
-  0xbe, 0xe8, 0xff, 0x8c, 0x86, 0xea, 0xff, 0x07, 0x8b, 0x46, 0xf0, 0x36,
-  0xa3, 0x48, 0x0d, 0x8a, 0x46, 0xf4, 0x36, 0xa2, 0x54, 0x0d, 0x8b, 0x46,
-  0xec, 0x36, 0xa3, 0x4a, 0x0d, 0x8b, 0x46, 0xe8, 0x36, 0xa3, 0x50, 0x0d,
-  0x8b, 0x46, 0xea, 0x36, 0xa3, 0x52, 0x0d, 0x8a, 0x46, 0xf2, 0x36, 0xc7,
-  0x06, 0x58, 0x0d, 0xff, 0xff, 0x36, 0xa2, 0x55, 0x0d, 0x8b, 0x46, 0xee,
-  0x36, 0xc6, 0x06, 0x4c, 0x0d, 0x01, 0x36, 0xa3, 0x56, 0x0d, 0x8d, 0x66,
-  0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x83, 0xec, 0x0e, 0x36, 0x83, 0x3e, 0x0e,
-  0x0d, 0x00, 0x74, 0x03, 0xe9, 0xeb, 0x00, 0x8d, 0x56, 0xec, 0x8d, 0x5e,
-  0xec, 0xb8, 0x21, 0x00, 0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46, 0xec, 0x00,
-  0x30, 0x0e, 0x3e, 0xe8, 0x36, 0xa1, 0x8a, 0x66, 0xec, 0x36, 0xc7, 0x06,
-  0x14, 0x0d, 0x55, 0x05, 0x8a, 0x46, 0xed, 0x36, 0x8c, 0x16, 0x16, 0x0d,
-  0x36, 0xa3, 0x0e, 0x0d, 0x3d, 0x00, 0x05, 0x72, 0x62, 0x80, 0x7e, 0xef,
-  0xfd, 0x75, 0x5c, 0x36, 0xc6, 0x06, 0x0c, 0x0d, 0x02, 0x8a, 0x5e, 0xf1,
-  0x8a, 0x46, 0xf0, 0x31, 0xd2, 0x30, 0xe4, 0x16, 0xb1, 0x08, 0xd3, 0xe2,
-  0xd3, 0xc0, 0x31, 0xc2, 0x81, 0xe0, 0x00, 0xff, 0x31, 0xc2, 0x30, 0xff,
-  0x89, 0xc1, 0x09, 0xda, 0x8a, 0x46, 0xee, 0x8d, 0x5e, 0xec, 0x36, 0x89,
-  0x16, 0x12, 0x0d, 0x8d, 0x56, 0xec, 0x30, 0xe4, 0x52, 0x09, 0xc1, 0xb8,
-  0x21, 0x00, 0x36, 0x89, 0x0e, 0x10, 0x0d, 0x8c, 0xd1, 0xc7, 0x46, 0xec,
-  0xff, 0x33, 0x0e, 0xe8, 0xca, 0xa0, 0x90, 0x8b, 0x46, 0xec, 0x36, 0xa3,
-  0x20, 0x0d, 0x8b, 0x46, 0xf2, 0x36, 0xa3, 0x22, 0x0d, 0xeb, 0x15, 0x36,
-  0x81, 0x3e, 0x0e, 0x0d, 0x00, 0x02, 0x72, 0x0c, 0x80, 0x7e, 0xef, 0xff,
-  0x75, 0x06, 0x36, 0xc6, 0x06, 0x0c, 0x0d, 0x01, 0xc7, 0x46, 0xec, 0x06,
-  0x33, 0x8d, 0x56, 0xec, 0x8d, 0x5e, 0xec, 0xb8, 0x21, 0x00, 0x16, 0x8c,
-  0xd1, 0x52, 0xc7, 0x46, 0xee, 0x00, 0x00, 0x0e, 0x3e, 0xe8, 0x88, 0xa0,
-  0xf6, 0x46, 0xf8, 0x01, 0x75, 0x20, 0x8a, 0x46, 0xee, 0x3c, 0x05, 0x72,
-  0x19, 0x3c, 0x08, 0x77, 0x15, 0x88, 0xc4, 0x36, 0xc7, 0x06, 0x14, 0x0d,
-  0x64, 0x05, 0x8a, 0x46, 0xef, 0x36, 0x8c, 0x16, 0x16, 0x0d, 0x36, 0xa3,
-  0x0e, 0x0d, 0x8d, 0x66, 0xfa, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x57, 0x81, 0xec, 0xa2, 0x00,
-  0x36, 0xa0, 0x2d, 0x0d, 0x84, 0xc0, 0x74, 0x03, 0xe9, 0x16, 0x02, 0x30,
-  0xe4, 0x36, 0xa3, 0x2a, 0x0d, 0x36, 0xa2, 0x2c, 0x0d, 0x36, 0xa0, 0x0f,
-  0x0d, 0x36, 0xc6, 0x06, 0x2d, 0x0d, 0x01, 0x3d, 0x14, 0x00, 0x74, 0x05,
-  0x3d, 0x0a, 0x00, 0x75, 0x1a, 0x36, 0xc7, 0x06, 0x18, 0x0d, 0x75, 0x05,
-  0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x05, 0x36, 0xa1, 0x0e, 0x0d, 0x36, 0x8c,
-  0x16, 0x1a, 0x0d, 0x36, 0xa3, 0x2a, 0x0d, 0x36, 0x83, 0x3e, 0x2a, 0x0d,
-  0x00, 0x75, 0x65, 0x8d, 0x56, 0xea, 0x8d, 0x5e, 0xea, 0xb8, 0x2f, 0x00,
-  0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46, 0xea, 0x0a, 0x16, 0x0e, 0x3e, 0xe8,
-  0xea, 0x9f, 0x83, 0x7e, 0xea, 0x00, 0x75, 0x48, 0x8b, 0x46, 0xec, 0x3d,
-  0x00, 0x03, 0x72, 0x40, 0x3d, 0x00, 0x07, 0x77, 0x3b, 0x36, 0xa3, 0x2a,
-  0x0d, 0x8b, 0x46, 0xee, 0x3d, 0x03, 0x00, 0x74, 0x0d, 0x3d, 0x02, 0x00,
-  0x75, 0x10, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x02, 0xeb, 0x16, 0x36, 0xc6,
-  0x06, 0x2c, 0x0d, 0x03, 0xeb, 0x0e, 0x31, 0xc0, 0x36, 0xa3, 0x2a, 0x0d,
-  0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74, 0x0c, 0x36, 0xc7, 0x06, 0x18,
-  0x0d, 0x8d, 0x05, 0x36, 0x8c, 0x16, 0x1a, 0x0d, 0x36, 0x83, 0x3e, 0x2a,
-  0x0d, 0x00, 0x75, 0x39, 0x8d, 0x56, 0xea, 0x8d, 0x5e, 0xea, 0xb8, 0x2f,
-  0x00, 0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46, 0xea, 0x80, 0x46, 0x0e, 0xe8,
-  0x7e, 0x9f, 0x90, 0x83, 0x7e, 0xea, 0x00, 0x75, 0x1c, 0x36, 0xc7, 0x06,
-  0x2a, 0x0d, 0x00, 0x03, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x01, 0x36, 0xc7,
-  0x06, 0x18, 0x0d, 0x9e, 0x05, 0x36, 0x8c, 0x16, 0x1a, 0x0d, 0xe9, 0x38,
-  0x01, 0x36, 0x83, 0x3e, 0x2a, 0x0d, 0x00, 0x75, 0x60, 0x8d, 0x56, 0xea,
-  0x8d, 0x5e, 0xea, 0xb8, 0x2f, 0x00, 0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46,
-  0xea, 0x00, 0x16, 0x0e, 0x3e, 0xe8, 0x3c, 0x9f, 0x8a, 0x46, 0xea, 0x3c,
-  0x01, 0x74, 0x04, 0x3c, 0xff, 0x75, 0x0f, 0x36, 0xc7, 0x06, 0x2a, 0x0d,
-  0x00, 0x02, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x03, 0xeb, 0x23, 0x3c, 0x03,
-  0x74, 0x04, 0x3c, 0x04, 0x75, 0x13, 0x8a, 0x76, 0xea, 0x8a, 0x56, 0xeb,
-  0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x03, 0x36, 0x89, 0x16, 0x2a, 0x0d, 0xeb,
-  0x08, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74, 0x0c, 0x36, 0xc7, 0x06,
-  0x18, 0x0d, 0xaf, 0x05, 0x36, 0x8c, 0x16, 0x1a, 0x0d, 0x36, 0x83, 0x3e,
-  0x2a, 0x0d, 0x00, 0x75, 0x3c, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x75,
-  0x34, 0x36, 0x83, 0x3e, 0x0e, 0x0d, 0x00, 0x75, 0x04, 0x0e, 0xe8, 0x75,
-  0xfd, 0x36, 0xa1, 0x0e, 0x0d, 0x3d, 0x10, 0x05, 0x72, 0x1f, 0x3d, 0x7f,
-  0x05, 0x77, 0x1a, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x04, 0x36, 0xc7, 0x06,
-  0x18, 0x0d, 0xc0, 0x05, 0x31, 0xc0, 0x36, 0x8c, 0x16, 0x1a, 0x0d, 0x36,
-  0xa3, 0x2a, 0x0d, 0xeb, 0x08, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x04, 0x75,
-  0x6f, 0x0e, 0xe8, 0xef, 0x0d, 0x85, 0xc0, 0x74, 0x67, 0xb9, 0x94, 0x00,
-  0x8d, 0xbe, 0x56, 0xff, 0x8c, 0xd2, 0x30, 0xc0, 0x8e, 0xc2, 0x57, 0x8a,
-  0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa, 0x5f, 0xc7, 0x86,
-  0x56, 0xff, 0x94, 0x00, 0x8d, 0x86, 0x56, 0xff, 0xc7, 0x86, 0x58, 0xff,
-  0x00, 0x00, 0x0e, 0xe8, 0x12, 0x0f, 0x85, 0xc0, 0x74, 0x43, 0x8a, 0xa6,
-  0x5a, 0xff, 0x8b, 0x96, 0x5e, 0xff, 0x30, 0xc0, 0x36, 0xc7, 0x06, 0x18,
-  0x0d, 0xe1, 0x05, 0x09, 0xc2, 0x36, 0x8c, 0x16, 0x1a, 0x0d, 0x36, 0x89,
-  0x16, 0x2a, 0x0d, 0x83, 0xbe, 0x68, 0xff, 0x00, 0x75, 0x14, 0x83, 0xbe,
-  0x66, 0xff, 0x02, 0x75, 0x0d, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x04, 0xb8,
-  0x01, 0x00, 0xeb, 0x24, 0xeb, 0x0b, 0x36, 0xc6, 0x06, 0x2c, 0x0d, 0x03,
-  0xb8, 0x01, 0x00, 0xeb, 0x17, 0x36, 0xa0, 0x2c, 0x0d, 0x84, 0xc0, 0x74,
-  0x0d, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf8, 0x5f, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x30, 0xe4, 0x8d, 0x66, 0xf8, 0x5f, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x04, 0x31, 0xc0, 0x89, 0x46, 0xf6, 0x89, 0x46, 0xf4, 0xb4, 0x52, 0xcd,
-  0x21, 0x72, 0x08, 0x8c, 0x86, 0xf6, 0xff, 0x89, 0x9e, 0xf4, 0xff, 0x8b,
-  0x46, 0xf4, 0x8b, 0x56, 0xf6, 0x36, 0xa3, 0x08, 0x0d, 0x36, 0x89, 0x16,
-  0x0a, 0x0d, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x53, 0x89, 0xc3, 0x8e, 0xda, 0x8b, 0x47, 0x0a, 0x3d, 0x80, 0x00, 0x72,
-  0x05, 0x3d, 0xff, 0xff, 0x75, 0x06, 0x31, 0xc0, 0x31, 0xd2, 0x5b, 0xcb,
-  0x89, 0xc2, 0x31, 0xc0, 0x5b, 0xcb, 0x53, 0x51, 0x89, 0xc3, 0x8e, 0xda,
-  0x31, 0xc9, 0x31, 0xd2, 0xeb, 0x07, 0x42, 0x43, 0x83, 0xfa, 0x08, 0x7d,
-  0x13, 0x8a, 0x07, 0x84, 0xc0, 0x74, 0x0d, 0x3c, 0x20, 0x72, 0x04, 0x3c,
-  0x7f, 0x72, 0xeb, 0xb9, 0x01, 0x00, 0xeb, 0xe6, 0x89, 0xc8, 0x59, 0x5b,
-  0xcb, 0xfc, 0x53, 0x36, 0xa1, 0x0a, 0x0d, 0x36, 0x8b, 0x1e, 0x08, 0x0d,
-  0x85, 0xc0, 0x75, 0x08, 0x85, 0xdb, 0x75, 0x04, 0x31, 0xc0, 0x5b, 0xcb,
-  0x8e, 0xd8, 0x8b, 0x47, 0xfe, 0x5b, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x02, 0x89, 0xc3, 0x89, 0x56, 0xf6,
-  0x8e, 0xda, 0x8b, 0x47, 0x0a, 0x85, 0xc0, 0x76, 0x6f, 0x3d, 0x80, 0x00,
-  0x73, 0x6a, 0xb9, 0x02, 0x00, 0xbf, 0x09, 0x06, 0x89, 0xda, 0x8c, 0xd0,
-  0x83, 0xc2, 0x0f, 0x8e, 0xc0, 0x89, 0xd6, 0x0b, 0xc9, 0xf3, 0xa6, 0x74,
-  0x05, 0x19, 0xc9, 0x83, 0xd9, 0xff, 0x85, 0xc9, 0x74, 0x17, 0xb9, 0x02,
-  0x00, 0xbf, 0x0c, 0x06, 0x89, 0xd6, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05,
-  0x19, 0xc9, 0x83, 0xd9, 0xff, 0x85, 0xc9, 0x75, 0x1b, 0xb9, 0x06, 0x00,
-  0x8e, 0x46, 0xf6, 0x89, 0xdf, 0x30, 0xc0, 0x83, 0xc7, 0x11, 0x57, 0x8a,
-  0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa, 0x5f, 0xeb, 0x3e,
-  0xb9, 0x08, 0x00, 0x8e, 0x46, 0xf6, 0x89, 0xd7, 0x30, 0xc0, 0x57, 0x8a,
-  0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa, 0x5f, 0xeb, 0x26,
-  0x89, 0xdf, 0x83, 0xc7, 0x0f, 0x8b, 0x56, 0xf6, 0x89, 0xf8, 0x0e, 0xe8,
-  0x20, 0xff, 0x85, 0xc0, 0x74, 0x14, 0xb9, 0x08, 0x00, 0x8e, 0x46, 0xf6,
-  0x30, 0xc0, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3,
-  0xaa, 0x5f, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc7,
-  0x8e, 0xda, 0x80, 0x7d, 0x0e, 0x5a, 0x74, 0x0b, 0x8b, 0x05, 0x85, 0xc0,
-  0x74, 0x05, 0x3d, 0xff, 0xff, 0x75, 0x05, 0x31, 0xc0, 0xe9, 0x87, 0x00,
-  0x81, 0x7d, 0x02, 0x00, 0x40, 0x72, 0x0a, 0x31, 0xc0, 0x89, 0xec, 0x5d,
-  0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0x89, 0xc2, 0x31, 0xdb, 0x40, 0x89, 0x5d,
-  0x04, 0x89, 0x45, 0x06, 0x8b, 0x05, 0x89, 0x45, 0x0c, 0x8e, 0xc2, 0x26,
-  0x8a, 0x07, 0x88, 0x45, 0x0e, 0x26, 0x8b, 0x47, 0x01, 0x89, 0xfe, 0x89,
-  0x45, 0x0a, 0x8c, 0xd9, 0x26, 0x8b, 0x47, 0x03, 0x89, 0x56, 0xfe, 0x89,
-  0x45, 0x08, 0x31, 0xc0, 0x8e, 0x46, 0xfe, 0x43, 0x46, 0x26, 0x8a, 0x57,
-  0x07, 0x8e, 0xc1, 0x40, 0x26, 0x88, 0x54, 0x0e, 0x3d, 0x08, 0x00, 0x72,
-  0xeb, 0x8a, 0x45, 0x0e, 0xc6, 0x45, 0x17, 0x00, 0x3c, 0x5a, 0x74, 0x0e,
-  0x3c, 0x4d, 0x74, 0x0a, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59,
-  0x5b, 0xcb, 0x8b, 0x05, 0x03, 0x45, 0x08, 0x40, 0x3b, 0x05, 0x77, 0x0a,
-  0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0x89, 0x05,
-  0xb8, 0x01, 0x00, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x89, 0xc3, 0x89, 0xd1, 0x36, 0xa1,
-  0x0a, 0x0d, 0x36, 0x8b, 0x16, 0x08, 0x0d, 0x85, 0xc0, 0x75, 0x08, 0x85,
-  0xd2, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x27, 0x8e, 0xd9, 0xc7, 0x47, 0x02,
-  0x00, 0x00, 0x0e, 0xe8, 0x4c, 0xfe, 0x8e, 0xd9, 0x89, 0x07, 0x85, 0xc0,
-  0x74, 0x05, 0x3d, 0xff, 0xff, 0x75, 0x07, 0x31, 0xc0, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x89, 0xd8, 0x89, 0xca, 0x0e, 0xe8, 0x06, 0xff, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x52, 0x56, 0x57, 0x8e, 0xd9, 0x31, 0xc9, 0x89,
-  0x47, 0x02, 0x89, 0x0f, 0x8b, 0x37, 0x8e, 0xc0, 0x26, 0x8b, 0x44, 0x02,
-  0x89, 0x47, 0x04, 0xc4, 0x37, 0x26, 0x8b, 0x44, 0x16, 0x89, 0x47, 0x06,
-  0xc4, 0x37, 0x26, 0x8b, 0x44, 0x2c, 0x89, 0x47, 0x08, 0x31, 0xc0, 0xc4,
-  0x37, 0x26, 0x8a, 0x94, 0x80, 0x00, 0x30, 0xf6, 0x39, 0xd0, 0x73, 0x0d,
-  0x01, 0xc6, 0x26, 0x80, 0xbc, 0x81, 0x00, 0x20, 0x75, 0x03, 0x40, 0xeb,
-  0xe6, 0xc4, 0x37, 0x26, 0x8a, 0x94, 0x80, 0x00, 0x30, 0xf6, 0x39, 0xd0,
-  0x73, 0x14, 0x89, 0xf7, 0x89, 0xce, 0x01, 0xc7, 0x41, 0x26, 0x8a, 0x95,
-  0x81, 0x00, 0x01, 0xde, 0x40, 0x88, 0x54, 0x0a, 0xeb, 0xdf, 0x01, 0xcb,
-  0xb8, 0x01, 0x00, 0x88, 0x77, 0x0a, 0x5f, 0x5e, 0x5a, 0xcb, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x89, 0xc3, 0x8e, 0xda, 0x8b, 0x47,
-  0x04, 0x8b, 0x4f, 0x06, 0x89, 0x07, 0x89, 0x4f, 0x02, 0x8b, 0x47, 0x02,
-  0x8b, 0x0f, 0x85, 0xc0, 0x75, 0x04, 0x85, 0xc9, 0x74, 0x0d, 0x81, 0x7f,
-  0x12, 0x00, 0x02, 0x73, 0x06, 0x83, 0x7f, 0x0a, 0xff, 0x75, 0x05, 0x31,
-  0xc0, 0xe9, 0x9c, 0x00, 0x89, 0xce, 0x8e, 0xc0, 0x26, 0x8b, 0x04, 0x89,
-  0x47, 0x0a, 0xc4, 0x37, 0x26, 0x8b, 0x44, 0x02, 0x89, 0x47, 0x08, 0xc4,
-  0x37, 0x26, 0x8b, 0x44, 0x04, 0x89, 0x47, 0x0c, 0xc4, 0x37, 0x26, 0x8b,
-  0x44, 0x06, 0x89, 0x47, 0x0e, 0xc4, 0x37, 0x26, 0x8b, 0x44, 0x08, 0x89,
-  0xdf, 0x89, 0x47, 0x10, 0x83, 0xc7, 0x14, 0xf6, 0x47, 0x0d, 0x80, 0x75,
-  0x31, 0xb8, 0x08, 0x00, 0x8b, 0x37, 0x8b, 0x4f, 0x02, 0x83, 0xc6, 0x0b,
-  0x8e, 0xc2, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13,
-  0xc9, 0xf3, 0xa4, 0x5f, 0x1f, 0x8a, 0x47, 0x14, 0xc6, 0x47, 0x1b, 0x00,
-  0x3c, 0x21, 0x72, 0x04, 0x3c, 0x7f, 0x72, 0x26, 0xc6, 0x47, 0x14, 0x00,
-  0xeb, 0x20, 0xb8, 0x08, 0x00, 0x8b, 0x37, 0x8b, 0x4f, 0x02, 0x83, 0xc6,
-  0x0a, 0x8e, 0xc2, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5,
-  0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x1f, 0xc6, 0x47, 0x1c, 0x00, 0xff, 0x47,
-  0x12, 0x8b, 0x4f, 0x0a, 0x8b, 0x47, 0x08, 0x89, 0x4f, 0x04, 0x89, 0x47,
-  0x06, 0xb8, 0x01, 0x00, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x89, 0xc3, 0x8e, 0xda,
-  0xb8, 0x22, 0x00, 0x36, 0x8b, 0x16, 0x0a, 0x0d, 0x36, 0x8b, 0x0e, 0x08,
-  0x0d, 0x85, 0xd2, 0x75, 0x09, 0x85, 0xc9, 0x75, 0x05, 0x31, 0xc0, 0xe9,
-  0x82, 0x00, 0x36, 0x81, 0x3e, 0x0e, 0x0d, 0x00, 0x02, 0x73, 0x09, 0x31,
-  0xc0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x36, 0x81, 0x3e, 0x0e,
-  0x0d, 0x00, 0x03, 0x73, 0x05, 0xb8, 0x17, 0x00, 0xeb, 0x05, 0x75, 0x03,
-  0xb8, 0x28, 0x00, 0xc7, 0x47, 0x0a, 0x00, 0x00, 0xc7, 0x47, 0x08, 0x00,
-  0x00, 0xc7, 0x47, 0x12, 0x00, 0x00, 0x36, 0x8b, 0x0e, 0x08, 0x0d, 0x36,
-  0x8b, 0x16, 0x0a, 0x0d, 0x01, 0xc1, 0x89, 0x57, 0x06, 0xbf, 0x0f, 0x06,
-  0x89, 0x4f, 0x04, 0xb8, 0x08, 0x00, 0x8b, 0x57, 0x06, 0x89, 0x0f, 0x89,
-  0xd1, 0x8b, 0x37, 0x89, 0x57, 0x02, 0x83, 0xc6, 0x0a, 0x16, 0x07, 0x1e,
-  0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83,
-  0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x74, 0x09, 0x31, 0xc0, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x89, 0xd8, 0x8c, 0xda, 0x0e, 0xe8, 0x7e, 0xfe,
-  0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89, 0x46, 0xf0, 0x89, 0x56,
-  0xf2, 0xb8, 0xff, 0xff, 0x89, 0x46, 0xf4, 0x89, 0x46, 0xf6, 0xb8, 0x06,
-  0xde, 0x66, 0x8b, 0x8e, 0xf0, 0xff, 0xcd, 0x67, 0x0a, 0xe4, 0x0f, 0x85,
-  0x05, 0x00, 0x66, 0x89, 0x96, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x8b, 0x56,
-  0xf6, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x53, 0x52, 0x31, 0xc0, 0xbb, 0x9c, 0x01, 0x8e, 0xd8, 0x8b, 0x17, 0x8b,
-  0x47, 0x02, 0x09, 0xd0, 0x75, 0x06, 0xb8, 0x01, 0x00, 0x5a, 0x5b, 0xc3,
-  0x31, 0xc0, 0x5a, 0x5b, 0xc3, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0xc6, 0x46, 0xf4, 0xff, 0x36, 0x80,
-  0x3e, 0x2e, 0x0d, 0x00, 0x75, 0x5c, 0x36, 0xc6, 0x06, 0x2e, 0x0d, 0x01,
-  0x36, 0xf6, 0x06, 0x14, 0x0e, 0x08, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x50,
-  0xe8, 0xb5, 0xff, 0x85, 0xc0, 0x74, 0x04, 0x31, 0xc0, 0xeb, 0x45, 0x0e,
-  0xe8, 0xc5, 0xf8, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x00, 0x74, 0x04, 0x31,
-  0xc0, 0xeb, 0x35, 0x1e, 0x06, 0xb8, 0x00, 0xde, 0xcd, 0x67, 0x88, 0xa6,
-  0xf4, 0xff, 0xb8, 0xe3, 0x0d, 0x8e, 0xd8, 0x88, 0x3e, 0x7f, 0x15, 0xb8,
-  0xe3, 0x0d, 0x8e, 0xd8, 0x88, 0x1e, 0x7e, 0x15, 0x07, 0x1f, 0x80, 0x7e,
-  0xf4, 0x00, 0x74, 0x04, 0x31, 0xc0, 0xeb, 0x0c, 0x36, 0xc6, 0x06, 0x2f,
-  0x0d, 0x01, 0x36, 0xa0, 0x2f, 0x0d, 0x30, 0xe4, 0x8d, 0x66, 0xf6, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x06, 0x88, 0x46, 0xf6, 0x31, 0xc0,
-  0x89, 0x46, 0xf2, 0x89, 0x46, 0xf4, 0xb8, 0x02, 0x02, 0x8a, 0x9e, 0xf6,
-  0xff, 0x33, 0xc9, 0x33, 0xd2, 0xcd, 0x31, 0x89, 0x8e, 0xf2, 0xff, 0x89,
-  0x96, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf2, 0x8d, 0x66, 0xf8,
-  0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x88, 0x46, 0xf8, 0x89, 0x4e, 0xf2,
-  0x89, 0x5e, 0xf4, 0xc7, 0x46, 0xf6, 0x01, 0x00, 0xb8, 0x03, 0x02, 0x8a,
-  0x9e, 0xf8, 0xff, 0x8b, 0x8e, 0xf2, 0xff, 0x8b, 0x96, 0xf4, 0xff, 0xcd,
-  0x31, 0x73, 0x06, 0xc7, 0x86, 0xf6, 0xff, 0x00, 0x00, 0x8b, 0x46, 0xf6,
-  0x8d, 0x66, 0xfa, 0x5f, 0x5e, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0xc7, 0x46,
-  0xf4, 0x00, 0x00, 0x36, 0x80, 0x3e, 0x54, 0x0d, 0x00, 0x74, 0x39, 0x36,
-  0x83, 0x3e, 0x58, 0x0d, 0xff, 0x75, 0x31, 0x36, 0xa1, 0x56, 0x0d, 0x85,
-  0xc0, 0x75, 0x06, 0x36, 0xa3, 0x58, 0x0d, 0xeb, 0x26, 0x1e, 0xb4, 0x48,
-  0xbb, 0xe3, 0x0d, 0x8e, 0xdb, 0x8b, 0x1e, 0x56, 0x0d, 0xcd, 0x21, 0x1f,
-  0x72, 0x04, 0x89, 0x86, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x85, 0xc0, 0x74,
-  0x0a, 0x8b, 0x46, 0xf4, 0x36, 0xa3, 0x58, 0x0d, 0xb8, 0x01, 0x00, 0x8d,
-  0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x88, 0xc2, 0x3c, 0xff, 0x75, 0x1e, 0x36,
-  0xa0, 0x0d, 0x0e, 0x3c, 0xff, 0x74, 0x04, 0x3c, 0x03, 0x7c, 0x10, 0x36,
-  0xa1, 0x48, 0x0d, 0x25, 0x01, 0x00, 0x3d, 0x01, 0x00, 0x75, 0x04, 0xb2,
-  0x20, 0xeb, 0x02, 0xb2, 0x10, 0x36, 0xa0, 0x5a, 0x0d, 0x84, 0xc0, 0x74,
-  0x09, 0x38, 0xc2, 0x74, 0x4f, 0x31, 0xc0, 0xe9, 0x6d, 0x00, 0x80, 0xfa,
-  0x10, 0x74, 0x05, 0x80, 0xfa, 0x20, 0x75, 0x61, 0x80, 0xfa, 0x20, 0x75,
-  0x0c, 0x36, 0xf6, 0x06, 0x48, 0x0d, 0x01, 0x75, 0x04, 0x31, 0xc0, 0xeb,
-  0x52, 0x36, 0xa1, 0x52, 0x0d, 0x36, 0x0b, 0x06, 0x50, 0x0d, 0x74, 0x47,
-  0x0e, 0xe8, 0x3a, 0xff, 0x85, 0xc0, 0x74, 0x3f, 0x36, 0x83, 0x3e, 0x56,
-  0x0d, 0x00, 0x74, 0x08, 0x36, 0xa1, 0x58, 0x0d, 0x85, 0xc0, 0x74, 0x2f,
-  0x36, 0x83, 0x3e, 0x58, 0x0d, 0xff, 0x75, 0x06, 0x31, 0xc0, 0xeb, 0x23,
-  0xeb, 0x16, 0x8c, 0xd0, 0x36, 0x88, 0x16, 0x5a, 0x0d, 0x8e, 0xd8, 0x0e,
-  0x3e, 0xe8, 0x20, 0xea, 0x36, 0xa0, 0x5a, 0x0d, 0x84, 0xc0, 0x74, 0x09,
-  0xb8, 0x01, 0x00, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x30, 0xe4, 0x5a,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x0e, 0x50, 0x8d, 0x7e, 0xea, 0x8d, 0x5e, 0xea,
-  0x8c, 0xd0, 0x16, 0x8c, 0xd1, 0x8e, 0xc0, 0x8e, 0xd8, 0xbe, 0x6c, 0x0d,
-  0x53, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xb8, 0x21, 0x00, 0xc7,
-  0x46, 0xea, 0x12, 0xfd, 0xc7, 0x46, 0xec, 0x57, 0x34, 0x0e, 0x3e, 0xe8,
-  0x0e, 0x97, 0x81, 0x7e, 0xea, 0x78, 0x56, 0x75, 0x37, 0x8b, 0x5e, 0xe8,
-  0x8e, 0xda, 0x8a, 0x46, 0xee, 0x88, 0x07, 0x8b, 0x46, 0xf0, 0x89, 0x47,
-  0x02, 0x8b, 0x46, 0xec, 0x89, 0x47, 0x04, 0x83, 0x7f, 0x02, 0x00, 0x75,
-  0x16, 0x3d, 0x35, 0x12, 0x75, 0x07, 0xc7, 0x47, 0x02, 0x00, 0x02, 0xeb,
-  0x0a, 0x3d, 0x37, 0x12, 0x75, 0x05, 0xc7, 0x47, 0x02, 0x00, 0x03, 0xb8,
-  0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0xbb, 0x78, 0x00, 0xeb, 0x06, 0x81, 0xfb, 0x90, 0x00, 0x7d, 0x46,
-  0x89, 0xde, 0x31, 0xd2, 0xd1, 0xe6, 0x8e, 0xda, 0xd1, 0xe6, 0x8b, 0x14,
-  0x8b, 0x4c, 0x02, 0x83, 0xc6, 0x02, 0x83, 0xfa, 0xff, 0x74, 0x09, 0x85,
-  0xc9, 0x74, 0x05, 0x83, 0xf9, 0xff, 0x75, 0x03, 0x43, 0xeb, 0xd7, 0xb8,
-  0x04, 0x00, 0xbf, 0x18, 0x06, 0x8c, 0xd2, 0xbe, 0x0a, 0x00, 0x8e, 0xc2,
-  0x1e, 0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9,
-  0x83, 0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x75, 0xdc, 0xeb, 0x03, 0xbb, 0xff,
-  0xff, 0x89, 0xd8, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0xbb, 0x78, 0x00,
-  0xeb, 0x06, 0x81, 0xfb, 0x90, 0x00, 0x7d, 0x46, 0x89, 0xde, 0x31, 0xd2,
-  0xd1, 0xe6, 0x8e, 0xda, 0xd1, 0xe6, 0x8b, 0x14, 0x8b, 0x4c, 0x02, 0x83,
-  0xc6, 0x02, 0x83, 0xfa, 0xff, 0x74, 0x09, 0x85, 0xc9, 0x74, 0x05, 0x83,
-  0xf9, 0xff, 0x75, 0x03, 0x43, 0xeb, 0xd7, 0xb8, 0x08, 0x00, 0xbf, 0x1d,
-  0x06, 0x8c, 0xd2, 0xbe, 0x03, 0x01, 0x8e, 0xc2, 0x1e, 0x91, 0x8e, 0xd8,
-  0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83, 0xd9, 0xff, 0x1f,
-  0x85, 0xc9, 0x75, 0xdc, 0xeb, 0x03, 0xbb, 0xff, 0xff, 0x89, 0xd8, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0xb8, 0x8f, 0x16, 0xba, 0x00, 0x03, 0xcd,
-  0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0xb8, 0x8f, 0x16, 0xba, 0x00,
-  0x02, 0xcd, 0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04,
-  0x88, 0x46, 0xf4, 0xc7, 0x46, 0xf2, 0x00, 0x00, 0x8a, 0x46, 0xf4, 0x84,
-  0xc0, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02, 0x30, 0xe4, 0x88, 0x46,
-  0xf4, 0xb8, 0x8f, 0x16, 0x33, 0xd2, 0x8a, 0x96, 0xf4, 0xff, 0xcd, 0x2f,
-  0x89, 0x86, 0xf2, 0xff, 0x8b, 0x46, 0xf2, 0x8d, 0x66, 0xf6, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0xc7, 0x46, 0xf4, 0x00, 0x00, 0xb8,
-  0x8f, 0x16, 0xba, 0x00, 0x01, 0xcd, 0x2f, 0x89, 0x86, 0xf4, 0xff, 0x81,
-  0x7e, 0xf4, 0x8f, 0x16, 0x75, 0x05, 0xb8, 0xff, 0xff, 0xeb, 0x03, 0x8b,
-  0x46, 0xf4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x36, 0xa0, 0x2c, 0x0d, 0x3c, 0x03, 0x74, 0x04, 0x3c, 0x04,
-  0x75, 0x04, 0xb8, 0x01, 0x00, 0xcb, 0x31, 0xc0, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0xb8, 0x80, 0x16, 0x33, 0xdb,
-  0xcd, 0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x0e, 0xe8,
-  0xa8, 0xf3, 0x36, 0xa0, 0x84, 0x0d, 0x84, 0xc0, 0x7d, 0x25, 0xbb, 0x00,
-  0xff, 0x30, 0xc0, 0xba, 0x00, 0xe0, 0x36, 0xa2, 0x84, 0x0d, 0x8e, 0xda,
-  0x30, 0xe4, 0x80, 0x3f, 0x00, 0x75, 0x0c, 0x40, 0x43, 0x3d, 0x00, 0x01,
-  0x7d, 0x0c, 0x80, 0x3f, 0x00, 0x74, 0xf4, 0x36, 0xa0, 0x84, 0x0d, 0xe9,
-  0xf1, 0x00, 0xc7, 0x46, 0xf0, 0x00, 0x00, 0xc7, 0x46, 0xf2, 0x00, 0xf0,
-  0xc7, 0x46, 0xf4, 0x00, 0xf0, 0x31, 0xc0, 0x31, 0xd2, 0x31, 0xdb, 0x8e,
-  0x46, 0xf4, 0xeb, 0x09, 0x31, 0xd2, 0x40, 0x43, 0x3d, 0x00, 0x10, 0x7d,
-  0x22, 0x36, 0xc5, 0x36, 0x7c, 0x0d, 0x89, 0xf7, 0x26, 0x8a, 0x0f, 0x01,
-  0xd7, 0x3a, 0x0d, 0x75, 0xe7, 0x42, 0x01, 0xd6, 0x80, 0x3c, 0x00, 0x75,
-  0xe1, 0x8e, 0x5e, 0xf4, 0x80, 0x7f, 0x01, 0x00, 0x75, 0xd8, 0x40, 0x3d,
-  0x00, 0x10, 0x7c, 0x10, 0x36, 0xa0, 0x84, 0x0d, 0x98, 0x8d, 0x66, 0xf6,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x31, 0xd2, 0x3d, 0x00,
-  0x10, 0x7d, 0x3c, 0x8b, 0x5e, 0xf0, 0x8b, 0x76, 0xf2, 0x36, 0x8e, 0x1e,
-  0x82, 0x0d, 0x89, 0x76, 0xee, 0x01, 0xc3, 0x8e, 0x46, 0xee, 0x36, 0x8b,
-  0x36, 0x80, 0x0d, 0x89, 0xf7, 0x26, 0x8a, 0x0f, 0x01, 0xd7, 0x3a, 0x0d,
-  0x75, 0x10, 0x42, 0x01, 0xd6, 0x80, 0x3c, 0x00, 0x75, 0x0a, 0x36, 0xc6,
-  0x06, 0x84, 0x0d, 0x01, 0xeb, 0x09, 0x31, 0xd2, 0x40, 0x43, 0x3d, 0x00,
-  0x10, 0x7c, 0xd7, 0x3d, 0x00, 0x10, 0x7c, 0x10, 0x36, 0xa0, 0x84, 0x0d,
-  0x98, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0xc5, 0x5e, 0xf0, 0x01, 0xc3, 0x3d, 0x00, 0x10, 0x7d, 0x09, 0x80, 0x3f,
-  0x20, 0x75, 0x04, 0x43, 0x40, 0xeb, 0xf2, 0x31, 0xdb, 0x3d, 0x00, 0x10,
-  0x7d, 0x1b, 0x8e, 0x5e, 0xf2, 0x89, 0xc6, 0x03, 0x76, 0xf0, 0x43, 0x8a,
-  0x14, 0x40, 0x36, 0x88, 0x97, 0x84, 0x0d, 0x83, 0xfb, 0x3f, 0x73, 0x05,
-  0x3d, 0x00, 0x10, 0x7c, 0xe8, 0x36, 0xa0, 0x84, 0x0d, 0x36, 0xc6, 0x87,
-  0x85, 0x0d, 0x00, 0x98, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec,
-  0x02, 0x89, 0xc6, 0x89, 0x4e, 0xfa, 0x36, 0xa0, 0x5a, 0x0d, 0x3c, 0x20,
-  0x75, 0x18, 0xff, 0x76, 0x08, 0xff, 0x76, 0x06, 0x51, 0x53, 0x52, 0x8c,
-  0xd0, 0x56, 0x8e, 0xd8, 0x0e, 0xe8, 0x45, 0xe8, 0x90, 0x83, 0xc4, 0x0c,
-  0xeb, 0x3d, 0x3c, 0x10, 0x75, 0x37, 0x8b, 0x4e, 0x06, 0x89, 0xf7, 0x8e,
-  0xc2, 0x30, 0xc0, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9,
-  0xf3, 0xaa, 0x5f, 0xff, 0x76, 0x08, 0xff, 0x76, 0x06, 0xff, 0x76, 0xfa,
-  0x53, 0x52, 0x8c, 0xd0, 0x56, 0x8e, 0xd8, 0x0e, 0x3e, 0xe8, 0x31, 0xe9,
-  0x83, 0xc4, 0x0c, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04,
-  0x00, 0x31, 0xc0, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04,
-  0x00, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x0e, 0xe8, 0x46, 0xf1, 0x36, 0xa0,
-  0x54, 0x0d, 0x84, 0xc0, 0x75, 0x05, 0x30, 0xe4, 0x5d, 0x4d, 0xcb, 0xb8,
-  0xff, 0x00, 0x0e, 0xe8, 0x54, 0xfb, 0x85, 0xc0, 0x74, 0x03, 0xb8, 0x01,
-  0x00, 0x5d, 0x4d, 0xcb, 0x3c, 0x01, 0x74, 0x0a, 0x84, 0xc0, 0x75, 0x0c,
-  0xb8, 0x1e, 0x05, 0x8c, 0xd2, 0xcb, 0xb8, 0x26, 0x06, 0x8c, 0xd2, 0xcb,
-  0xb8, 0x45, 0x06, 0x8c, 0xd2, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0xbb, 0xff, 0xff, 0xc7, 0x46, 0xf4,
-  0x00, 0x00, 0xb9, 0x40, 0x00, 0x31, 0xd2, 0x8e, 0xd9, 0xb8, 0x0c, 0x00,
-  0xbe, 0x47, 0x06, 0x8c, 0xd9, 0x89, 0xd7, 0x8e, 0xc1, 0x8c, 0xd1, 0x1e,
-  0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83,
-  0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x75, 0x07, 0x89, 0xd3, 0x83, 0xc3, 0x0c,
-  0x8b, 0x1f, 0x83, 0xfb, 0xf0, 0x72, 0x0e, 0xbb, 0xff, 0xff, 0xff, 0x46,
-  0xf4, 0x42, 0x81, 0x7e, 0xf4, 0xf4, 0x01, 0x76, 0xc4, 0x89, 0xd8, 0x8d,
-  0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x31, 0xc0,
-  0x89, 0x46, 0xea, 0x89, 0x46, 0xec, 0x89, 0x46, 0xee, 0x16, 0x89, 0x46,
-  0xf0, 0xb8, 0x54, 0x06, 0xbb, 0x5d, 0x06, 0x8c, 0xd1, 0x8c, 0xd2, 0x50,
-  0xb8, 0x47, 0x06, 0x0e, 0x3e, 0xe8, 0x2e, 0x53, 0x36, 0xa3, 0x1e, 0x0d,
-  0x3d, 0xf0, 0xff, 0x73, 0x5d, 0x89, 0x46, 0xea, 0xc7, 0x46, 0xec, 0x00,
-  0x00, 0x66, 0x53, 0x66, 0x51, 0x66, 0xbb, 0x00, 0x00, 0x50, 0xd0, 0x66,
-  0x8b, 0x86, 0xea, 0xff, 0x66, 0x8b, 0xc8, 0xc4, 0xc4, 0x58, 0x02, 0x66,
-  0x89, 0x9e, 0xea, 0xff, 0x66, 0x89, 0x8e, 0xee, 0xff, 0x66, 0x59, 0x66,
-  0x5b, 0x81, 0x7e, 0xec, 0xaa, 0x55, 0x75, 0x21, 0x81, 0x7e, 0xea, 0xaa,
-  0x55, 0x75, 0x1a, 0x83, 0x7e, 0xf0, 0x00, 0x75, 0x07, 0x81, 0x7e, 0xee,
-  0x00, 0x04, 0x72, 0x0d, 0x83, 0x7e, 0xf0, 0x00, 0x75, 0x07, 0x81, 0x7e,
-  0xee, 0x00, 0x06, 0x76, 0x0c, 0x36, 0xa1, 0x1e, 0x0d, 0x0e, 0x3e, 0xe8,
-  0xaa, 0x52, 0xe9, 0x7d, 0x00, 0x8b, 0x76, 0xee, 0x83, 0xe6, 0x0f, 0x8b,
-  0x46, 0xee, 0x89, 0x46, 0xf2, 0x8b, 0x46, 0xf0, 0xbf, 0x62, 0x06, 0x89,
-  0x46, 0xf4, 0x8c, 0xd2, 0xb9, 0x04, 0x00, 0xd1, 0x6e, 0xf4, 0xd1, 0x5e,
-  0xf2, 0xe2, 0xf8, 0xb8, 0x0e, 0x00, 0x8e, 0xc2, 0x8b, 0x4e, 0xf2, 0x1e,
-  0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc9, 0x83,
-  0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x74, 0x0b, 0x36, 0xa1, 0x1e, 0x0d, 0x0e,
-  0x3e, 0xe8, 0x60, 0x52, 0xeb, 0x34, 0x8b, 0x76, 0xee, 0x83, 0xc6, 0x0c,
-  0x83, 0xe6, 0x0f, 0x8b, 0x46, 0xee, 0x05, 0x0c, 0x00, 0x8b, 0x56, 0xf0,
-  0x11, 0xca, 0xb1, 0x04, 0xd3, 0xe8, 0xd3, 0xca, 0x31, 0xd0, 0x81, 0xe2,
-  0xff, 0x0f, 0x31, 0xd0, 0x8e, 0xd8, 0x36, 0xa1, 0x1e, 0x0d, 0x89, 0x04,
-  0x3d, 0xff, 0xff, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0,
-  0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x52, 0x36, 0xa1, 0xc6, 0x0d, 0x85, 0xc0, 0x74,
-  0x18, 0x89, 0xc2, 0xb8, 0x01, 0x10, 0xef, 0x36, 0x8b, 0x16, 0xc6, 0x0d,
-  0x31, 0xc0, 0x42, 0xef, 0x36, 0x8b, 0x16, 0xc6, 0x0d, 0x83, 0xc2, 0x02,
-  0xed, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57,
-  0x83, 0xec, 0x0c, 0x89, 0x46, 0xf0, 0x89, 0x56, 0xf2, 0x89, 0x5e, 0xf4,
-  0x89, 0x4e, 0xf6, 0x36, 0xa1, 0xc6, 0x0d, 0x85, 0xc0, 0x74, 0x43, 0x89,
-  0xc2, 0xb8, 0x01, 0x10, 0xef, 0x36, 0x8b, 0x16, 0xc6, 0x0d, 0xb8, 0x01,
-  0x00, 0x42, 0xef, 0x36, 0xa1, 0xc6, 0x0d, 0x05, 0x02, 0x00, 0x89, 0x46,
-  0xf8, 0xc7, 0x46, 0xfa, 0x00, 0x00, 0x06, 0x66, 0x60, 0x66, 0x8b, 0x96,
-  0xf8, 0xff, 0x66, 0x8b, 0x86, 0xf0, 0xff, 0x66, 0x0f, 0xb7, 0x9e, 0x06,
-  0x00, 0x66, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xc4, 0xbe, 0xf4, 0xff, 0xf3,
-  0x6c, 0x66, 0x61, 0x07, 0x31, 0xc0, 0x31, 0xd2, 0x8d, 0x66, 0xfc, 0x5f,
-  0x5e, 0x5d, 0x4d, 0xca, 0x02, 0x00, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x06, 0x89, 0x46, 0xf2, 0x89, 0x56, 0xf4, 0x36,
-  0xa1, 0xc6, 0x0d, 0x85, 0xc0, 0x74, 0x32, 0x89, 0xc2, 0xb8, 0x00, 0x10,
-  0xef, 0x36, 0x8b, 0x16, 0xc6, 0x0d, 0x31, 0xc0, 0x42, 0xef, 0x36, 0xa1,
-  0xc6, 0x0d, 0x05, 0x02, 0x00, 0x89, 0x46, 0xf6, 0x1e, 0x56, 0x51, 0x52,
-  0xfc, 0x8b, 0x96, 0xf6, 0xff, 0xc5, 0xb6, 0xf2, 0xff, 0xb9, 0x01, 0x00,
-  0xf3, 0x6e, 0x5a, 0x59, 0x5e, 0x1f, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf8,
-  0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x31, 0xc0, 0x89, 0x46,
-  0xee, 0x89, 0x46, 0xf0, 0x89, 0x46, 0xf2, 0x89, 0x46, 0xf4, 0x36, 0x80,
-  0x3e, 0x1c, 0x0d, 0x00, 0x75, 0x1c, 0x36, 0xc6, 0x06, 0x1c, 0x0d, 0x01,
-  0x36, 0xa3, 0xc6, 0x0d, 0x36, 0xf6, 0x06, 0x06, 0x0d, 0x02, 0x74, 0x0c,
-  0x36, 0xc7, 0x06, 0x1e, 0x0d, 0xff, 0xff, 0xe9, 0x7a, 0x00, 0xeb, 0x60,
-  0x0e, 0xe8, 0x4a, 0xfd, 0x36, 0xa3, 0x1e, 0x0d, 0x3d, 0xff, 0xff, 0x75,
-  0x0c, 0x36, 0xf6, 0x06, 0x06, 0x0d, 0x01, 0x75, 0x04, 0x0e, 0xe8, 0x99,
-  0xfd, 0x36, 0xa1, 0x1e, 0x0d, 0x3d, 0xff, 0xff, 0x74, 0x3e, 0x89, 0x46,
-  0xee, 0xc7, 0x46, 0xf0, 0x00, 0x00, 0x66, 0x53, 0x66, 0x52, 0x66, 0xbb,
-  0x03, 0x00, 0x50, 0xd0, 0x66, 0x8b, 0x86, 0xee, 0xff, 0xc4, 0xc4, 0x58,
-  0x02, 0x66, 0x89, 0x9e, 0xee, 0xff, 0x66, 0x89, 0x96, 0xf2, 0xff, 0x66,
-  0x5a, 0x66, 0x5b, 0x81, 0x7e, 0xf0, 0xaa, 0x55, 0x75, 0x0e, 0x81, 0x7e,
-  0xee, 0xaa, 0x55, 0x75, 0x07, 0x8b, 0x46, 0xf2, 0x36, 0xa3, 0xc6, 0x0d,
-  0x36, 0x83, 0x3e, 0x1e, 0x0d, 0xff, 0x74, 0x0e, 0xb8, 0x01, 0x00, 0x8d,
-  0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x31, 0xc0,
-  0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02,
-  0x36, 0xa1, 0x1e, 0x0d, 0x3d, 0xff, 0xff, 0x74, 0x21, 0x89, 0x46, 0xf4,
-  0x66, 0xbb, 0xff, 0xff, 0x50, 0xd0, 0x8b, 0x86, 0xf4, 0xff, 0xc4, 0xc4,
-  0x58, 0x02, 0x36, 0xa1, 0x1e, 0x0d, 0x0e, 0xe8, 0x3e, 0x50, 0x90, 0x36,
-  0xc7, 0x06, 0x1e, 0x0d, 0xff, 0xff, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x06, 0xb8, 0xff, 0xff, 0x89, 0x46, 0xf2, 0x89,
-  0x46, 0xf4, 0x36, 0xa1, 0x1e, 0x0d, 0x3d, 0xff, 0xff, 0x75, 0x06, 0x31,
-  0xc0, 0x31, 0xd2, 0xeb, 0x20, 0x89, 0x46, 0xf6, 0x66, 0x53, 0x66, 0xbb,
-  0x02, 0x00, 0x50, 0xd0, 0x8b, 0x86, 0xf6, 0xff, 0xc4, 0xc4, 0x58, 0x02,
-  0x66, 0x89, 0x9e, 0xf2, 0xff, 0x66, 0x5b, 0x8b, 0x46, 0xf2, 0x8b, 0x56,
-  0xf4, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x08, 0xc7,
-  0x46, 0xf2, 0x00, 0x00, 0x36, 0x83, 0x3e, 0x1e, 0x0d, 0xff, 0x75, 0x04,
-  0x31, 0xc0, 0xeb, 0x3b, 0x89, 0x56, 0xf0, 0x89, 0x46, 0xf6, 0x36, 0xa1,
-  0x1e, 0x0d, 0x89, 0x46, 0xf4, 0x1e, 0x66, 0x56, 0x66, 0x51, 0x66, 0xbb,
-  0x01, 0x00, 0x50, 0xd0, 0x66, 0x33, 0xf6, 0x8b, 0x86, 0xf4, 0xff, 0x8b,
-  0xb6, 0xf0, 0xff, 0x8e, 0xde, 0x8b, 0xb6, 0xf6, 0xff, 0x33, 0xc9, 0xc4,
-  0xc4, 0x58, 0x02, 0x89, 0x9e, 0xf2, 0xff, 0x66, 0x5e, 0x66, 0x5b, 0x1f,
-  0x8b, 0x46, 0xf2, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x3c, 0x02, 0x74, 0x14, 0x3c, 0x01, 0x74, 0x0a, 0x84, 0xc0,
-  0x75, 0x12, 0xb8, 0x1e, 0x05, 0x8c, 0xd2, 0xcb, 0xb8, 0x71, 0x06, 0x8c,
-  0xd2, 0xcb, 0xb8, 0x78, 0x06, 0x8c, 0xd2, 0xcb, 0xb8, 0x45, 0x06, 0x8c,
-  0xd2, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x8b, 0xec, 0x83,
-  0x46, 0x02, 0x03, 0x1e, 0xbd, 0xe3, 0x0d, 0x8e, 0xdd, 0xc6, 0x06, 0x34,
-  0x0e, 0x01, 0x1f, 0x5d, 0xcf, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x52, 0x36,
-  0x8b, 0x16, 0xde, 0x0d, 0x36, 0xa1, 0xdc, 0x0d, 0x85, 0xd2, 0x75, 0x04,
-  0x85, 0xc0, 0x74, 0x05, 0x0e, 0xe8, 0xc8, 0x8a, 0x90, 0x31, 0xc0, 0x36,
-  0xa3, 0xdc, 0x0d, 0x36, 0xa3, 0xde, 0x0d, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x10,
-  0x8c, 0xd0, 0x8d, 0x7e, 0xe6, 0x8e, 0xc0, 0x8e, 0xd8, 0xbe, 0x35, 0x0e,
-  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x0e, 0xe8, 0xb2, 0xff,
-  0xb8, 0x7a, 0x00, 0x0e, 0x3e, 0xe8, 0xd2, 0x8a, 0x89, 0xc7, 0x36, 0xa3,
-  0xdc, 0x0d, 0x36, 0x89, 0x16, 0xde, 0x0d, 0x85, 0xd2, 0x75, 0x07, 0x85,
-  0xc0, 0x75, 0x03, 0xe9, 0x42, 0x03, 0xb9, 0x7a, 0x00, 0x8e, 0xc2, 0x30,
-  0xc0, 0x57, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab, 0x13, 0xc9, 0xf3, 0xaa,
-  0x5f, 0x36, 0xf6, 0x06, 0x14, 0x0e, 0x01, 0x75, 0x03, 0xe9, 0x17, 0x03,
-  0x8d, 0x5e, 0xe6, 0xba, 0x00, 0x80, 0x8c, 0xd1, 0x30, 0xe4, 0x0e, 0xe8,
-  0xf4, 0xe6, 0x90, 0x8b, 0x46, 0xe8, 0x3d, 0x00, 0x80, 0x77, 0x08, 0x75,
-  0xe4, 0x83, 0x7e, 0xe6, 0x01, 0x72, 0xde, 0x8b, 0x46, 0xe6, 0x36, 0xc5,
-  0x3e, 0xdc, 0x0d, 0x8d, 0x5e, 0xe6, 0x89, 0x45, 0x32, 0xba, 0x00, 0x80,
-  0x8b, 0x46, 0xe8, 0x8c, 0xd1, 0x89, 0x45, 0x34, 0xb8, 0x01, 0x00, 0x36,
-  0x80, 0x0e, 0x14, 0x0e, 0x04, 0x0e, 0x3e, 0xe8, 0xbc, 0xe6, 0x36, 0xc5,
-  0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x45, 0x36, 0x8b, 0x46, 0xe8,
-  0x89, 0x45, 0x38, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xea, 0x89,
-  0x45, 0x3a, 0x8b, 0x46, 0xec, 0x89, 0x45, 0x3c, 0x36, 0xc5, 0x3e, 0xdc,
-  0x0d, 0x8b, 0x46, 0xee, 0x89, 0x45, 0x3e, 0x8b, 0x46, 0xf0, 0x89, 0x45,
-  0x40, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xf2, 0x89, 0x45, 0x42,
-  0x8b, 0x46, 0xf4, 0x89, 0x45, 0x44, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b,
-  0x45, 0x34, 0x3d, 0x00, 0x80, 0x77, 0x0b, 0x74, 0x03, 0xe9, 0x0a, 0x01,
-  0x83, 0x7d, 0x32, 0x04, 0x72, 0xf7, 0x8d, 0x5e, 0xe6, 0xb8, 0x02, 0x00,
-  0xba, 0x00, 0x80, 0x8c, 0xd1, 0x0e, 0x3e, 0xe8, 0x50, 0xe6, 0x36, 0xc5,
-  0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x05, 0x8b, 0x46, 0xe8, 0x89,
-  0x45, 0x02, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xea, 0x89, 0x45,
-  0x04, 0x8b, 0x46, 0xec, 0x89, 0x45, 0x06, 0x36, 0xc5, 0x3e, 0xdc, 0x0d,
-  0x8b, 0x46, 0xee, 0x89, 0x45, 0x08, 0x8b, 0x46, 0xf0, 0x89, 0x45, 0x0a,
-  0x8b, 0x46, 0xf2, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8d, 0x5e, 0xe6, 0x89,
-  0x45, 0x0c, 0xba, 0x00, 0x80, 0x8b, 0x46, 0xf4, 0x8c, 0xd1, 0x89, 0x45,
-  0x0e, 0xb8, 0x03, 0x00, 0x0e, 0xe8, 0xfe, 0xe5, 0x90, 0x36, 0xc5, 0x3e,
-  0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x45, 0x10, 0x8b, 0x46, 0xe8, 0x89,
-  0x45, 0x12, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xea, 0x89, 0x45,
-  0x14, 0x8b, 0x46, 0xec, 0x89, 0x45, 0x16, 0x36, 0xc5, 0x3e, 0xdc, 0x0d,
-  0x8b, 0x46, 0xee, 0x89, 0x45, 0x18, 0x8b, 0x46, 0xf0, 0x89, 0x45, 0x1a,
-  0x8b, 0x46, 0xf2, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8d, 0x5e, 0xe6, 0x89,
-  0x45, 0x1c, 0xba, 0x00, 0x80, 0x8b, 0x46, 0xf4, 0x8c, 0xd1, 0x89, 0x45,
-  0x1e, 0xb8, 0x04, 0x00, 0x0e, 0xe8, 0xaa, 0xe5, 0x90, 0x36, 0xc5, 0x3e,
-  0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x45, 0x20, 0x8b, 0x46, 0xe8, 0x89,
-  0x45, 0x22, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xea, 0x89, 0x45,
-  0x24, 0x8b, 0x46, 0xec, 0x89, 0x45, 0x26, 0x36, 0xc5, 0x3e, 0xdc, 0x0d,
-  0x8b, 0x46, 0xee, 0x89, 0x45, 0x28, 0x8b, 0x46, 0xf0, 0x89, 0x45, 0x2a,
-  0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xf2, 0x89, 0x45, 0x2c, 0x8b,
-  0x46, 0xf4, 0x89, 0x45, 0x2e, 0x36, 0xc5, 0x1e, 0xdc, 0x0d, 0xc6, 0x47,
-  0x30, 0x00, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x45, 0x34, 0x3d, 0x00,
-  0x80, 0x77, 0x08, 0x75, 0x5a, 0x83, 0x7d, 0x32, 0x05, 0x72, 0x54, 0x8d,
-  0x5e, 0xe6, 0xb8, 0x05, 0x00, 0xba, 0x00, 0x80, 0x8c, 0xd1, 0x0e, 0xe8,
-  0x38, 0xe5, 0x90, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89,
-  0x45, 0x46, 0x8b, 0x46, 0xe8, 0x89, 0x45, 0x48, 0x36, 0xc5, 0x3e, 0xdc,
-  0x0d, 0x8b, 0x46, 0xea, 0x89, 0x45, 0x4a, 0x8b, 0x46, 0xec, 0x89, 0x45,
-  0x4c, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xee, 0x89, 0x45, 0x4e,
-  0x8b, 0x46, 0xf0, 0x89, 0x45, 0x50, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b,
-  0x46, 0xf2, 0x89, 0x45, 0x52, 0x8b, 0x46, 0xf4, 0x89, 0x45, 0x54, 0x36,
-  0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x45, 0x34, 0x3d, 0x00, 0x80, 0x77, 0x08,
-  0x75, 0x5a, 0x83, 0x7d, 0x32, 0x06, 0x72, 0x54, 0x8d, 0x5e, 0xe6, 0xb8,
-  0x06, 0x00, 0xba, 0x00, 0x80, 0x8c, 0xd1, 0x0e, 0x3e, 0xe8, 0xce, 0xe4,
-  0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x45, 0x56, 0x8b,
-  0x46, 0xe8, 0x89, 0x45, 0x58, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46,
-  0xea, 0x89, 0x45, 0x5a, 0x8b, 0x46, 0xec, 0x89, 0x45, 0x5c, 0x36, 0xc5,
-  0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xee, 0x89, 0x45, 0x5e, 0x8b, 0x46, 0xf0,
-  0x89, 0x45, 0x60, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xf2, 0x89,
-  0x45, 0x62, 0x8b, 0x46, 0xf4, 0x89, 0x45, 0x64, 0x36, 0xc5, 0x3e, 0xdc,
-  0x0d, 0x8b, 0x45, 0x34, 0x3d, 0x00, 0x80, 0x77, 0x08, 0x75, 0x27, 0x83,
-  0x7d, 0x32, 0x07, 0x72, 0x21, 0x8d, 0x5e, 0xe6, 0xb8, 0x07, 0x00, 0xba,
-  0x00, 0x80, 0x8c, 0xd1, 0x0e, 0xe8, 0x66, 0xe4, 0x90, 0x36, 0xc5, 0x3e,
-  0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89, 0x45, 0x66, 0x8b, 0x46, 0xe8, 0x89,
-  0x45, 0x68, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x45, 0x34, 0x3d, 0x00,
-  0x80, 0x77, 0x08, 0x75, 0x5a, 0x83, 0x7d, 0x32, 0x08, 0x72, 0x54, 0x8d,
-  0x5e, 0xe6, 0xb8, 0x08, 0x00, 0xba, 0x00, 0x80, 0x8c, 0xd1, 0x0e, 0xe8,
-  0x30, 0xe4, 0x90, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xe6, 0x89,
-  0x45, 0x6a, 0x8b, 0x46, 0xe8, 0x89, 0x45, 0x6c, 0x36, 0xc5, 0x3e, 0xdc,
-  0x0d, 0x8b, 0x46, 0xea, 0x89, 0x45, 0x6e, 0x8b, 0x46, 0xec, 0x89, 0x45,
-  0x70, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b, 0x46, 0xee, 0x89, 0x45, 0x72,
-  0x8b, 0x46, 0xf0, 0x89, 0x45, 0x74, 0x36, 0xc5, 0x3e, 0xdc, 0x0d, 0x8b,
-  0x46, 0xf2, 0x89, 0x45, 0x76, 0x8b, 0x46, 0xf4, 0x89, 0x45, 0x78, 0x36,
-  0xf6, 0x06, 0x14, 0x0e, 0x04, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02,
-  0x31, 0xc0, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x36, 0xc6, 0x06, 0x14, 0x0e, 0x00,
-  0x0e, 0xe8, 0xcb, 0xe1, 0x90, 0x36, 0xa2, 0x0d, 0x0e, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08,
-  0x36, 0x80, 0x3e, 0xd1, 0x0d, 0x00, 0x75, 0x6c, 0x36, 0xc6, 0x06, 0xd1,
-  0x0d, 0x01, 0x36, 0xc6, 0x06, 0xd0, 0x0d, 0x00, 0x36, 0xc7, 0x06, 0xd4,
-  0x0d, 0x9d, 0x06, 0x36, 0xc7, 0x06, 0xd8, 0x0d, 0x9e, 0x06, 0x36, 0x8c,
-  0x16, 0xd6, 0x0d, 0x30, 0xc0, 0x36, 0x8c, 0x16, 0xda, 0x0d, 0x36, 0xa2,
-  0xd3, 0x0d, 0x36, 0xa2, 0xd2, 0x0d, 0x36, 0x80, 0x3e, 0x0d, 0x0e, 0x00,
-  0x7d, 0x04, 0x0e, 0xe8, 0x9c, 0xff, 0x36, 0xf6, 0x06, 0x14, 0x0e, 0x01,
-  0x75, 0x11, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0xa3, 0x06, 0x36, 0x8c, 0x16,
-  0xd6, 0x0d, 0x31, 0xc0, 0xe9, 0x4e, 0x01, 0x36, 0xf6, 0x06, 0x08, 0x0e,
-  0x02, 0x75, 0x14, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0xb6, 0x06, 0x36, 0x8c,
-  0x16, 0xd6, 0x0d, 0x31, 0xc0, 0xe9, 0x35, 0x01, 0xe9, 0x2c, 0x01, 0x0e,
-  0x3e, 0xe8, 0x0c, 0xea, 0x36, 0xa0, 0x2c, 0x0d, 0x3c, 0x02, 0x74, 0x04,
-  0x3c, 0x03, 0x75, 0x6a, 0x36, 0xc7, 0x06, 0xd8, 0x0d, 0xd9, 0x06, 0x36,
-  0x8c, 0x16, 0xda, 0x0d, 0x0e, 0xe8, 0x30, 0xe8, 0x90, 0x36, 0x80, 0x3e,
-  0x54, 0x0d, 0x00, 0x74, 0x53, 0x36, 0x80, 0x3e, 0x5a, 0x0d, 0x00, 0x75,
-  0x08, 0xb8, 0xff, 0x00, 0x0e, 0xe8, 0x3a, 0xf2, 0x90, 0x36, 0x80, 0x3e,
-  0x5a, 0x0d, 0x00, 0x74, 0x2a, 0x8c, 0xd0, 0x8e, 0xd8, 0x0e, 0x3e, 0xe8,
-  0x24, 0xe3, 0x85, 0xc0, 0x75, 0x09, 0x36, 0xc6, 0x06, 0xd0, 0x0d, 0x01,
-  0xe9, 0xd4, 0x00, 0x3d, 0x01, 0x00, 0x75, 0x2c, 0x36, 0xc7, 0x06, 0xd4,
-  0x0d, 0x31, 0x07, 0x36, 0x8c, 0x16, 0xd6, 0x0d, 0xe9, 0xc0, 0x00, 0x36,
-  0xc7, 0x06, 0xd4, 0x0d, 0x66, 0x07, 0x36, 0x8c, 0x16, 0xd6, 0x0d, 0xe9,
-  0xb1, 0x00, 0xeb, 0x0f, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0x8a, 0x07, 0x36,
-  0x8c, 0x16, 0xd6, 0x0d, 0xe9, 0xa0, 0x00, 0x36, 0xf6, 0x06, 0x14, 0x0e,
-  0x08, 0x75, 0x04, 0x3c, 0x04, 0x75, 0x52, 0x36, 0xc7, 0x06, 0xd8, 0x0d,
-  0xfa, 0x07, 0xb8, 0x06, 0x00, 0xbb, 0x40, 0x8d, 0xb9, 0x00, 0x00, 0x36,
-  0x8c, 0x16, 0xda, 0x0d, 0x0e, 0xe8, 0x7a, 0x8b, 0x90, 0x89, 0x46, 0xf2,
-  0xb8, 0x06, 0x00, 0x89, 0x56, 0xf4, 0x0e, 0xe8, 0x77, 0x8b, 0x90, 0x0f,
-  0x57, 0xc0, 0x8b, 0x5e, 0xf2, 0x8b, 0x4e, 0xf4, 0xb8, 0x06, 0x00, 0x0e,
-  0x3e, 0xe8, 0x65, 0x8b, 0x36, 0x80, 0x3e, 0x34, 0x0e, 0x00, 0x75, 0x03,
-  0xe9, 0x73, 0xff, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0x31, 0x07, 0x36, 0x8c,
-  0x16, 0xd6, 0x0d, 0xeb, 0x42, 0x31, 0xc0, 0x89, 0x46, 0xee, 0x89, 0x46,
-  0xf0, 0x36, 0xc7, 0x06, 0xd8, 0x0d, 0x38, 0x08, 0x36, 0x8c, 0x16, 0xda,
-  0x0d, 0x0f, 0x20, 0xe0, 0x66, 0x89, 0x86, 0xee, 0xff, 0x8b, 0x46, 0xee,
-  0xf6, 0xc4, 0x02, 0x74, 0x08, 0x36, 0xc6, 0x06, 0xd0, 0x0d, 0x01, 0xeb,
-  0x0c, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0x4f, 0x08, 0x36, 0x8c, 0x16, 0xd6,
-  0x0d, 0xb0, 0x01, 0x36, 0xa2, 0xd2, 0x0d, 0x36, 0xa2, 0xd3, 0x0d, 0x36,
-  0xa0, 0xd0, 0x0d, 0x30, 0xe4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x04, 0x31, 0xc0, 0x89, 0x46, 0xf2, 0x89, 0x46, 0xf4,
-  0x36, 0xf6, 0x06, 0x14, 0x0e, 0x01, 0x74, 0x5e, 0x36, 0xf6, 0x06, 0x08,
-  0x0e, 0x02, 0x74, 0x56, 0x36, 0xa0, 0xd3, 0x0d, 0x84, 0xc0, 0x75, 0x04,
-  0x30, 0xe4, 0xeb, 0x4a, 0x0f, 0x20, 0xe0, 0x66, 0x25, 0xff, 0xfd, 0xff,
-  0xff, 0x0f, 0x22, 0xe0, 0x66, 0x8b, 0xd8, 0x0f, 0x20, 0xe0, 0x66, 0x25,
-  0x00, 0x02, 0x00, 0x00, 0x66, 0x81, 0xe3, 0x00, 0x02, 0x00, 0x00, 0x66,
-  0x33, 0xc3, 0x66, 0x89, 0x86, 0xf2, 0xff, 0x8b, 0x46, 0xf4, 0x0b, 0x46,
-  0xf2, 0x85, 0xc0, 0x74, 0x10, 0x36, 0xc7, 0x06, 0xd4, 0x0d, 0x69, 0x08,
-  0x36, 0x8c, 0x16, 0xd6, 0x0d, 0x31, 0xc0, 0xeb, 0x09, 0x36, 0xc6, 0x06,
-  0xd0, 0x0d, 0x00, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x31, 0xc0, 0x89, 0x46, 0xf2, 0x89,
-  0x46, 0xf4, 0x36, 0xf6, 0x06, 0x14, 0x0e, 0x01, 0x74, 0x5e, 0x36, 0xf6,
-  0x06, 0x08, 0x0e, 0x02, 0x74, 0x56, 0x36, 0xa0, 0xd2, 0x0d, 0x84, 0xc0,
-  0x75, 0x04, 0x30, 0xe4, 0xeb, 0x4a, 0x0f, 0x20, 0xe0, 0x66, 0x0d, 0x00,
-  0x02, 0x00, 0x00, 0x0f, 0x22, 0xe0, 0x66, 0x8b, 0xd8, 0x0f, 0x20, 0xe0,
-  0x66, 0x25, 0x00, 0x02, 0x00, 0x00, 0x66, 0x81, 0xe3, 0x00, 0x02, 0x00,
-  0x00, 0x66, 0x33, 0xc3, 0x66, 0x89, 0x86, 0xf2, 0xff, 0x8b, 0x46, 0xf4,
-  0x0b, 0x46, 0xf2, 0x85, 0xc0, 0x74, 0x10, 0x36, 0xc7, 0x06, 0xd4, 0x0d,
-  0x69, 0x08, 0x36, 0x8c, 0x16, 0xd6, 0x0d, 0x31, 0xc0, 0xeb, 0x09, 0x36,
-  0xc6, 0x06, 0xd0, 0x0d, 0x01, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf6, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x1c, 0x36, 0xc6, 0x06, 0x58,
-  0x0e, 0x00, 0x36, 0x80, 0x3e, 0x0d, 0x0e, 0x00, 0x7d, 0x05, 0x0e, 0xe8,
-  0xf4, 0xfc, 0x90, 0x36, 0x80, 0x3e, 0x0d, 0x0e, 0x02, 0x7d, 0x05, 0x31,
-  0xc0, 0xe9, 0xcd, 0x00, 0x8d, 0x56, 0xda, 0x8d, 0x5e, 0xda, 0xb8, 0x2f,
-  0x00, 0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46, 0xda, 0x00, 0x43, 0x0e, 0xe8,
-  0xd2, 0x87, 0x90, 0x80, 0x7e, 0xda, 0x80, 0x74, 0x0d, 0x31, 0xc0, 0x8d,
-  0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x36, 0xc6,
-  0x06, 0x58, 0x0e, 0x01, 0x8d, 0x56, 0xe8, 0x8d, 0x5e, 0xda, 0x16, 0xb8,
-  0x2f, 0x00, 0x52, 0x8d, 0x56, 0xda, 0x16, 0x8c, 0xd1, 0x52, 0xc7, 0x46,
-  0xda, 0x10, 0x43, 0x0e, 0x3e, 0xe8, 0x03, 0x87, 0x8b, 0x46, 0xdc, 0x36,
-  0xa3, 0x5c, 0x0e, 0x8b, 0x46, 0xe8, 0x36, 0xa3, 0x5e, 0x0e, 0x32, 0xe4,
-  0xff, 0x1e, 0x5c, 0x0e, 0xa3, 0x5a, 0x0e, 0x80, 0xe2, 0x01, 0x88, 0x16,
-  0x60, 0x0e, 0xb4, 0x88, 0xb3, 0x80, 0xff, 0x1e, 0x5c, 0x0e, 0x80, 0xfb,
-  0x80, 0x74, 0x05, 0x80, 0x0e, 0x60, 0x0e, 0x02, 0x36, 0xf6, 0x06, 0x60,
-  0x0e, 0x02, 0x74, 0x46, 0xb8, 0x01, 0x00, 0x50, 0x31, 0xc0, 0x50, 0x8c,
-  0xd0, 0x8e, 0xd8, 0x0e, 0xe8, 0x67, 0x01, 0x83, 0xc4, 0x04, 0x89, 0xc2,
-  0x3d, 0xff, 0xff, 0x74, 0x2d, 0x8d, 0x5e, 0xf0, 0x8c, 0xd1, 0x0e, 0xe8,
-  0xac, 0x03, 0x85, 0xc0, 0x74, 0x1a, 0x8b, 0x46, 0xf2, 0x0b, 0x46, 0xf0,
-  0x74, 0x0c, 0x83, 0x7e, 0xf2, 0x00, 0x75, 0x0c, 0x83, 0x7e, 0xf0, 0x01,
-  0x75, 0x06, 0x36, 0x80, 0x26, 0x60, 0x0e, 0xfd, 0x89, 0xd0, 0x0e, 0xe8,
-  0x9c, 0x01, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x02, 0x50, 0xc7, 0x46, 0xf4, 0x00, 0x00, 0x36, 0xa0,
-  0x58, 0x0e, 0x84, 0xc0, 0x75, 0x04, 0x30, 0xe4, 0xeb, 0x20, 0x83, 0x7e,
-  0xf2, 0x00, 0x7e, 0x05, 0xb8, 0x03, 0x00, 0xeb, 0x03, 0xb8, 0x04, 0x00,
-  0x89, 0x46, 0xf2, 0x8a, 0xa6, 0xf2, 0xff, 0xff, 0x1e, 0x5c, 0x0e, 0x89,
-  0x86, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0xc7, 0x46, 0xf4, 0x00, 0x00,
-  0x36, 0xa0, 0x58, 0x0e, 0x84, 0xc0, 0x75, 0x04, 0x30, 0xe4, 0xeb, 0x20,
-  0x83, 0x7e, 0xf2, 0x00, 0x7e, 0x05, 0xb8, 0x05, 0x00, 0xeb, 0x03, 0xb8,
-  0x06, 0x00, 0x89, 0x46, 0xf2, 0x8a, 0xa6, 0xf2, 0xff, 0xff, 0x1e, 0x5c,
-  0x0e, 0x89, 0x86, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xf6, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0xc7, 0x46, 0xf4, 0x00,
-  0x00, 0x36, 0xa0, 0x58, 0x0e, 0x84, 0xc0, 0x75, 0x04, 0x30, 0xe4, 0xeb,
-  0x0d, 0xb4, 0x07, 0xff, 0x1e, 0x5c, 0x0e, 0x89, 0x86, 0xf4, 0xff, 0x8b,
-  0x46, 0xf4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x36,
-  0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x3f, 0x36, 0xf6, 0x06, 0x60, 0x0e,
-  0x02, 0x74, 0x1e, 0xb4, 0x88, 0xff, 0x1e, 0x5c, 0x0e, 0xa3, 0x50, 0x0e,
-  0x66, 0xc1, 0xe8, 0x10, 0xa3, 0x52, 0x0e, 0x89, 0x16, 0x54, 0x0e, 0x66,
-  0xc1, 0xea, 0x10, 0x89, 0x16, 0x56, 0x0e, 0xeb, 0x19, 0xb4, 0x08, 0xff,
-  0x1e, 0x5c, 0x0e, 0xa3, 0x50, 0x0e, 0xc7, 0x06, 0x52, 0x0e, 0x00, 0x00,
-  0x89, 0x16, 0x54, 0x0e, 0xc7, 0x06, 0x56, 0x0e, 0x00, 0x00, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57,
-  0x83, 0xec, 0x02, 0xc7, 0x46, 0xfa, 0xff, 0xff, 0x36, 0x80, 0x3e, 0x58,
-  0x0e, 0x00, 0x74, 0x4a, 0x36, 0xf6, 0x06, 0x60, 0x0e, 0x02, 0x74, 0x16,
-  0xb4, 0x89, 0x66, 0x8b, 0x96, 0x06, 0x00, 0xff, 0x1e, 0x5c, 0x0e, 0xa8,
-  0x01, 0x75, 0x03, 0x33, 0xd2, 0x4a, 0x89, 0x96, 0xfa, 0xff, 0x83, 0x7e,
-  0xfa, 0xff, 0x75, 0x26, 0x83, 0x7e, 0x08, 0x00, 0x75, 0x06, 0x83, 0x7e,
-  0x06, 0xff, 0x72, 0x05, 0xb8, 0xff, 0xff, 0xeb, 0x18, 0xb4, 0x09, 0x8b,
-  0x96, 0x06, 0x00, 0xff, 0x1e, 0x5c, 0x0e, 0xa8, 0x01, 0x75, 0x03, 0x33,
-  0xd2, 0x4a, 0x89, 0x96, 0xfa, 0xff, 0x8b, 0x46, 0xfa, 0x8d, 0x66, 0xfc,
-  0x5f, 0x5e, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0xc7, 0x46, 0xf4, 0x00, 0x00,
-  0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x0e, 0xb4, 0x0a, 0x8b, 0x96,
-  0xf2, 0xff, 0xff, 0x1e, 0x5c, 0x0e, 0x89, 0x86, 0xf4, 0xff, 0x8b, 0x46,
-  0xf4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x18, 0x50, 0x89, 0xce,
-  0x89, 0xd7, 0xc7, 0x46, 0xf8, 0x00, 0x00, 0x36, 0x80, 0x3e, 0x58, 0x0e,
-  0x00, 0x75, 0x03, 0xe9, 0xaa, 0x00, 0x85, 0xd2, 0x75, 0x20, 0x8b, 0x46,
-  0x06, 0x8b, 0x56, 0x08, 0xb1, 0x0c, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0x00, 0xf0, 0x31, 0xc2, 0x8b, 0x46, 0x06, 0x89, 0x56, 0x08,
-  0x25, 0x0f, 0x00, 0x89, 0x46, 0x06, 0x83, 0x7e, 0xe2, 0x00, 0x75, 0x17,
-  0x89, 0xd8, 0x89, 0xf2, 0xb1, 0x0c, 0xd3, 0xe2, 0xd3, 0xc0, 0x31, 0xc2,
-  0x81, 0xe0, 0x00, 0xf0, 0x31, 0xc2, 0x89, 0xd6, 0x83, 0xe3, 0x0f, 0x8b,
-  0x46, 0x0a, 0x89, 0x46, 0xe4, 0x8b, 0x46, 0x0c, 0x89, 0x46, 0xe6, 0x8b,
-  0x46, 0x06, 0x89, 0x7e, 0xe8, 0x89, 0x46, 0xea, 0x8b, 0x46, 0x08, 0x89,
-  0x5e, 0xf0, 0x89, 0x46, 0xec, 0x8b, 0x46, 0xe2, 0x89, 0x76, 0xf2, 0x89,
-  0x46, 0xee, 0x8d, 0x46, 0xe4, 0x89, 0x46, 0xf4, 0x8c, 0x56, 0xfa, 0xc7,
-  0x46, 0xf6, 0x00, 0x00, 0x8c, 0xd8, 0x89, 0x86, 0xf6, 0xff, 0x8b, 0x46,
-  0xfa, 0x3b, 0x46, 0xf6, 0x74, 0x18, 0xb8, 0x3e, 0x02, 0xbb, 0x93, 0x08,
-  0x8c, 0xd1, 0x50, 0xb8, 0x88, 0x08, 0x16, 0x8c, 0xd2, 0x50, 0xb8, 0xa2,
-  0x08, 0x0e, 0x3e, 0xe8, 0xd3, 0x75, 0xb4, 0x0b, 0x8b, 0xb6, 0xf4, 0xff,
-  0xff, 0x1e, 0x5c, 0x0e, 0x89, 0x86, 0xf8, 0xff, 0x8b, 0x46, 0xf8, 0x8d,
-  0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x08, 0x00, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x04, 0x50, 0x31, 0xc0,
-  0x89, 0x46, 0xf4, 0x89, 0x46, 0xf6, 0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00,
-  0x74, 0x1a, 0xb4, 0x0c, 0x8b, 0x96, 0xf2, 0xff, 0xff, 0x1e, 0x5c, 0x0e,
-  0xa8, 0x01, 0x75, 0x04, 0x33, 0xdb, 0x8b, 0xd3, 0x89, 0x9e, 0xf4, 0xff,
-  0x89, 0x96, 0xf6, 0xff, 0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf6, 0x8d, 0x66,
-  0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0xc7, 0x46, 0xf4,
-  0x00, 0x00, 0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x0e, 0xb4, 0x0d,
-  0x8b, 0x96, 0xf2, 0xff, 0xff, 0x1e, 0x5c, 0x0e, 0x89, 0x86, 0xf4, 0xff,
-  0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x02, 0xc7,
-  0x46, 0xfa, 0x00, 0x00, 0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x43,
-  0x36, 0xf6, 0x06, 0x60, 0x0e, 0x02, 0x74, 0x13, 0xb4, 0x8f, 0x66, 0x8b,
-  0x9e, 0x08, 0x00, 0x8b, 0x96, 0x06, 0x00, 0xff, 0x1e, 0x5c, 0x0e, 0x89,
-  0x86, 0xfa, 0xff, 0x83, 0x7e, 0xfa, 0x00, 0x75, 0x22, 0x83, 0x7e, 0x0a,
-  0x00, 0x75, 0x06, 0x83, 0x7e, 0x08, 0xff, 0x72, 0x04, 0x31, 0xc0, 0xeb,
-  0x15, 0xb4, 0x0f, 0x8b, 0x9e, 0x08, 0x00, 0x8b, 0x96, 0x06, 0x00, 0xff,
-  0x1e, 0x5c, 0x0e, 0x89, 0x86, 0xfa, 0xff, 0x8b, 0x46, 0xfa, 0x8d, 0x66,
-  0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x06, 0x50, 0x89, 0x5e, 0xf4, 0x89, 0x4e, 0xf6, 0xc7,
-  0x46, 0xf8, 0x00, 0x00, 0x36, 0x80, 0x3e, 0x58, 0x0e, 0x00, 0x74, 0x48,
-  0x36, 0xf6, 0x06, 0x60, 0x0e, 0x02, 0x74, 0x1b, 0xb4, 0x8e, 0x8b, 0x96,
-  0xf2, 0xff, 0xff, 0x1e, 0x5c, 0x0e, 0x8b, 0xb6, 0xf4, 0xff, 0x66, 0x89,
-  0x14, 0x88, 0x7c, 0x04, 0x88, 0x5c, 0x05, 0x89, 0x86, 0xf8, 0xff, 0x83,
-  0x7e, 0xf8, 0x00, 0x75, 0x1f, 0xb4, 0x0e, 0x8b, 0x96, 0xf2, 0xff, 0xff,
-  0x1e, 0x5c, 0x0e, 0x8b, 0xb6, 0xf4, 0xff, 0x89, 0x14, 0xc7, 0x44, 0x02,
-  0x00, 0x00, 0x88, 0x7c, 0x04, 0x88, 0x5c, 0x05, 0x89, 0x86, 0xf8, 0xff,
-  0x8b, 0x46, 0xf8, 0x8d, 0x66, 0xfa, 0x5f, 0x5e, 0x5a, 0x5d, 0x4d, 0xcb,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x31,
-  0xc0, 0x36, 0xa3, 0x78, 0x0e, 0x36, 0xa3, 0x74, 0x0e, 0x36, 0x80, 0x3e,
-  0x71, 0x0e, 0x00, 0x74, 0x0e, 0xb4, 0x42, 0x06, 0xcd, 0x67, 0x07, 0x89,
-  0x1e, 0x78, 0x0e, 0x89, 0x16, 0x74, 0x0e, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x06, 0xb8, 0x67, 0x00, 0x36, 0xc6, 0x06, 0x71, 0x0e,
-  0x00, 0x0e, 0x3e, 0xe8, 0x98, 0x84, 0x85, 0xd2, 0x75, 0x09, 0x85, 0xc0,
-  0x75, 0x05, 0x31, 0xc0, 0xe9, 0x48, 0x01, 0xb8, 0x08, 0x00, 0xbe, 0x0a,
-  0x00, 0x36, 0x8b, 0x3e, 0x80, 0x0e, 0x89, 0xd1, 0x36, 0x8e, 0x06, 0x82,
-  0x0e, 0x1e, 0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05, 0x19,
-  0xc9, 0x83, 0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x74, 0x33, 0xb8, 0x08, 0x00,
-  0xbe, 0x0a, 0x00, 0x36, 0x8b, 0x3e, 0x84, 0x0e, 0x89, 0xd1, 0x36, 0x8e,
-  0x06, 0x86, 0x0e, 0x1e, 0x91, 0x8e, 0xd8, 0x0b, 0xc9, 0xf3, 0xa6, 0x74,
-  0x05, 0x19, 0xc9, 0x83, 0xd9, 0xff, 0x1f, 0x85, 0xc9, 0x74, 0x0d, 0x31,
-  0xc0, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0xb0, 0x01, 0x36, 0xa2, 0x71, 0x0e, 0x36, 0xa2, 0x73, 0x0e, 0x31, 0xc0,
-  0x36, 0xa3, 0x76, 0x0e, 0xb4, 0x40, 0x06, 0xcd, 0x67, 0x07, 0x88, 0x26,
-  0x70, 0x0e, 0xb4, 0x41, 0x06, 0xcd, 0x67, 0x07, 0x0a, 0xe4, 0x75, 0x0d,
-  0x89, 0x1e, 0x76, 0x0e, 0xb4, 0x46, 0x06, 0xcd, 0x67, 0x07, 0xa2, 0x72,
-  0x0e, 0x36, 0x8b, 0x16, 0x7e, 0x0e, 0x36, 0xa1, 0x7c, 0x0e, 0x85, 0xd2,
-  0x75, 0x04, 0x85, 0xc0, 0x74, 0x11, 0x0e, 0xe8, 0x4e, 0x7e, 0x90, 0x31,
-  0xc0, 0x36, 0xa3, 0x7c, 0x0e, 0x36, 0xa3, 0x7e, 0x0e, 0xeb, 0x08, 0x85,
-  0xd2, 0x75, 0x5f, 0x85, 0xc0, 0x75, 0x5b, 0xb8, 0x00, 0x04, 0x0e, 0xe8,
-  0x78, 0x7e, 0x90, 0x36, 0xa3, 0x7c, 0x0e, 0x36, 0x89, 0x16, 0x7e, 0x0e,
-  0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x42, 0x89, 0x56, 0xf4, 0x89,
-  0x46, 0xf0, 0xc7, 0x46, 0xf2, 0x00, 0x00, 0x06, 0xb8, 0x00, 0x58, 0x8b,
-  0xbe, 0xf4, 0xff, 0x8e, 0xc7, 0x8b, 0xbe, 0xf0, 0xff, 0xcd, 0x67, 0x0a,
-  0xe4, 0x75, 0x04, 0x89, 0x8e, 0xf2, 0xff, 0x07, 0x83, 0x7e, 0xf2, 0x00,
-  0x75, 0x1a, 0x36, 0xa1, 0x7c, 0x0e, 0x36, 0x8b, 0x16, 0x7e, 0x0e, 0x0e,
-  0x3e, 0xe8, 0xe8, 0x7d, 0x31, 0xc0, 0x36, 0xa3, 0x7c, 0x0e, 0x36, 0xa3,
-  0x7e, 0x0e, 0xeb, 0x34, 0x8a, 0x46, 0xf2, 0x36, 0xa2, 0x73, 0x0e, 0x81,
-  0x7e, 0xf2, 0x00, 0x01, 0x73, 0x26, 0x8b, 0x5e, 0xf2, 0x36, 0xa1, 0x7c,
-  0x0e, 0xd1, 0xe3, 0x36, 0x8b, 0x16, 0x7e, 0x0e, 0xd1, 0xe3, 0x0e, 0xe8,
-  0x70, 0x83, 0x90, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xc0, 0x74, 0x09, 0x36,
-  0xa3, 0x7c, 0x0e, 0x36, 0x89, 0x16, 0x7e, 0x0e, 0xb8, 0x01, 0x00, 0x8d,
-  0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0xc7,
-  0x46, 0xf4, 0xff, 0xff, 0x36, 0x80, 0x3e, 0x71, 0x0e, 0x00, 0x74, 0x12,
-  0xb4, 0x43, 0x8b, 0x9e, 0xf2, 0xff, 0x06, 0xcd, 0x67, 0x07, 0x0a, 0xe4,
-  0x75, 0x04, 0x89, 0x96, 0xf4, 0xff, 0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xf6,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0xc7, 0x46, 0xf4,
-  0x00, 0x00, 0x36, 0x80, 0x3e, 0x71, 0x0e, 0x00, 0x74, 0x14, 0xb4, 0x45,
-  0x8b, 0x96, 0xf2, 0xff, 0x06, 0xcd, 0x67, 0x07, 0x0a, 0xe4, 0x75, 0x06,
-  0xc7, 0x86, 0xf4, 0xff, 0x01, 0x00, 0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xf6,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x51, 0x56, 0x57, 0x83, 0xec, 0x02, 0x50, 0x52, 0x53, 0xc7, 0x46, 0xf8,
-  0x00, 0x00, 0x36, 0xa0, 0x73, 0x0e, 0x30, 0xe4, 0x3b, 0x46, 0xf4, 0x77,
-  0x04, 0x30, 0xc0, 0xeb, 0x27, 0x36, 0x80, 0x3e, 0x71, 0x0e, 0x00, 0x74,
-  0x1c, 0xb4, 0x44, 0x8a, 0x86, 0xf4, 0xff, 0x8b, 0x9e, 0xf2, 0xff, 0x8b,
-  0x96, 0xf6, 0xff, 0x06, 0xcd, 0x67, 0x07, 0x0a, 0xe4, 0x75, 0x06, 0xc7,
-  0x86, 0xf8, 0xff, 0x01, 0x00, 0x8b, 0x46, 0xf8, 0x8d, 0x66, 0xfa, 0x5f,
-  0x5e, 0x59, 0x5d, 0x4d, 0xcb, 0xfc, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89,
-  0xc7, 0x36, 0xa0, 0x73, 0x0e, 0x30, 0xe4, 0x39, 0xc7, 0x72, 0x04, 0x30,
-  0xc0, 0xeb, 0x59, 0x85, 0xff, 0x75, 0x1b, 0x36, 0x8b, 0x16, 0x7e, 0x0e,
-  0x36, 0xa1, 0x7c, 0x0e, 0x85, 0xd2, 0x75, 0x0e, 0x85, 0xc0, 0x75, 0x0a,
-  0x36, 0xa1, 0x76, 0x0e, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0x36, 0x8b,
-  0x0e, 0x7c, 0x0e, 0x31, 0xd2, 0x31, 0xdb, 0x36, 0xa0, 0x73, 0x0e, 0x30,
-  0xe4, 0x39, 0xc2, 0x73, 0x25, 0x36, 0xa1, 0x7e, 0x0e, 0x85, 0xc0, 0x75,
-  0x04, 0x85, 0xc9, 0x74, 0x19, 0x89, 0xce, 0x8e, 0xd8, 0x01, 0xde, 0x3b,
-  0x7c, 0x02, 0x75, 0x08, 0x8b, 0x04, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb,
-  0x83, 0xc3, 0x04, 0x42, 0xeb, 0xd1, 0x31, 0xc0, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x52, 0xba, 0xcc, 0x03, 0xfa, 0xec, 0x2a, 0xe4, 0xba, 0xc2, 0x03,
-  0x89, 0xc3, 0x30, 0xc0, 0xee, 0xba, 0xcc, 0x03, 0xec, 0x2a, 0xe4, 0xa8,
-  0xef, 0x74, 0x0a, 0xba, 0xc2, 0x03, 0x88, 0xd8, 0xee, 0x31, 0xc0, 0xeb,
-  0x2b, 0xb0, 0xef, 0xba, 0xc2, 0x03, 0xee, 0xba, 0xcc, 0x03, 0xec, 0x2a,
-  0xe4, 0x25, 0xef, 0x00, 0x3d, 0xef, 0x00, 0x74, 0x0d, 0xba, 0xc2, 0x03,
-  0x88, 0xd8, 0xee, 0x30, 0xc0, 0x5a, 0x5b, 0x5d, 0x4d, 0xcb, 0xba, 0xc2,
-  0x03, 0x88, 0xd8, 0xee, 0xfb, 0xb8, 0x01, 0x00, 0x5a, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0xb0, 0x0f, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x88, 0xc3, 0xb0, 0x0e, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x88, 0xc5, 0x88, 0xc7, 0x36,
-  0x8a, 0x0e, 0xb8, 0x0e, 0x31, 0xd2, 0x30, 0xc5, 0x89, 0xd8, 0xf7, 0xf1,
-  0x36, 0x88, 0x16, 0xa0, 0x0e, 0x89, 0xd8, 0x31, 0xd2, 0xf7, 0xf1, 0x36,
-  0xa2, 0xa1, 0x0e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x53, 0xb8,
-  0x40, 0x00, 0xbb, 0x50, 0x00, 0x8e, 0xd8, 0x36, 0xa0, 0xa0, 0x0e, 0x88,
-  0x07, 0xbb, 0x51, 0x00, 0x36, 0xa0, 0xa1, 0x0e, 0x88, 0x07, 0x5b, 0xcb,
-  0xcc, 0x9c, 0xe6, 0x9c, 0x00, 0x9d, 0x16, 0x9d, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x3c, 0x03, 0x77, 0x70, 0x30, 0xe4, 0x89, 0xc3, 0xd1, 0xe3, 0x2e,
-  0xff, 0xa7, 0xb0, 0x9c, 0x36, 0xc7, 0x06, 0xb2, 0x0e, 0x0a, 0x00, 0x30,
-  0xc0, 0x36, 0xc7, 0x06, 0xb6, 0x0e, 0x02, 0x00, 0x36, 0xa3, 0xb0, 0x0e,
-  0x36, 0xa3, 0xb4, 0x0e, 0xeb, 0x4b, 0x36, 0xc7, 0x06, 0xb2, 0x0e, 0x0a,
-  0x00, 0x30, 0xc0, 0x36, 0xc7, 0x06, 0xb6, 0x0e, 0x01, 0x00, 0x36, 0xa3,
-  0xb0, 0x0e, 0x36, 0xa3, 0xb4, 0x0e, 0xeb, 0x31, 0x36, 0xc7, 0x06, 0xb2,
-  0x0e, 0x0b, 0x00, 0x30, 0xc0, 0x36, 0xc7, 0x06, 0xb4, 0x0e, 0x00, 0x80,
-  0x36, 0xa3, 0xb0, 0x0e, 0xeb, 0x17, 0x36, 0xc7, 0x06, 0xb0, 0x0e, 0x00,
-  0x80, 0x36, 0xc7, 0x06, 0xb2, 0x0e, 0x0b, 0x00, 0x30, 0xc0, 0x36, 0xc7,
-  0x06, 0xb4, 0x0e, 0x00, 0x80, 0x36, 0xa3, 0xb6, 0x0e, 0x36, 0x8b, 0x36,
-  0xb0, 0x0e, 0x36, 0x8b, 0x1e, 0xb0, 0x0e, 0x36, 0x8b, 0x3e, 0xb2, 0x0e,
-  0x36, 0xa1, 0xb0, 0x0e, 0x36, 0x8b, 0x16, 0xb2, 0x0e, 0xb1, 0x04, 0xd3,
-  0xeb, 0xd3, 0xcf, 0x31, 0xfb, 0x81, 0xe7, 0xff, 0x0f, 0x31, 0xfb, 0x83,
-  0xe6, 0x0f, 0x36, 0x8b, 0x3e, 0xb0, 0x0e, 0x36, 0x89, 0x36, 0x90, 0x0e,
-  0x36, 0x89, 0x1e, 0x92, 0x0e, 0x36, 0x89, 0x36, 0x98, 0x0e, 0x36, 0x03,
-  0x3e, 0xb4, 0x0e, 0x36, 0x89, 0x1e, 0x9a, 0x0e, 0x83, 0xe7, 0x0f, 0x36,
-  0x03, 0x06, 0xb4, 0x0e, 0x36, 0x13, 0x16, 0xb6, 0x0e, 0x36, 0x89, 0x3e,
-  0x94, 0x0e, 0xb1, 0x04, 0xd3, 0xe8, 0xd3, 0xca, 0x31, 0xd0, 0x81, 0xe2,
-  0xff, 0x0f, 0x31, 0xd0, 0x36, 0x89, 0x3e, 0x9c, 0x0e, 0x36, 0xa3, 0x96,
-  0x0e, 0x36, 0xa3, 0x9e, 0x0e, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0xfc,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x88, 0xc1, 0x88, 0xc5, 0xd0,
-  0xe5, 0x36, 0xa0, 0xba, 0x0e, 0xd0, 0xe5, 0xa8, 0x10, 0x74, 0x21, 0xb0,
-  0x06, 0xba, 0xce, 0x03, 0xee, 0xba, 0xcf, 0x03, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0x80, 0xe4, 0xf3, 0x08, 0xec, 0xba, 0xce, 0x03, 0xb0, 0x06, 0xee,
-  0xba, 0xcf, 0x03, 0x88, 0xe0, 0xee, 0xeb, 0x1a, 0xa8, 0x20, 0x74, 0x1e,
-  0xb8, 0x00, 0x0f, 0xcd, 0x10, 0x88, 0xec, 0x80, 0xcc, 0x02, 0xba, 0xce,
-  0x03, 0xb0, 0x06, 0xee, 0xba, 0xcf, 0x03, 0x88, 0xe0, 0xee, 0x88, 0xc8,
-  0x30, 0xe4, 0x0e, 0xe8, 0xb2, 0xfe, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x2f, 0x9f, 0x2f, 0x9f, 0x2f, 0x9f, 0x2f, 0x9f, 0x48, 0x9f, 0x48, 0x9f,
-  0x48, 0x9f, 0x2f, 0x9f, 0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f,
-  0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f, 0x50, 0x9f,
-  0x50, 0x9f, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x36,
-  0xc6, 0x06, 0xb8, 0x0e, 0x50, 0x30, 0xc0, 0x36, 0xc6, 0x06, 0xa4, 0x0e,
-  0x19, 0x36, 0xa2, 0xa1, 0x0e, 0x36, 0xa2, 0xa0, 0x0e, 0x36, 0xa2, 0xbc,
-  0x0e, 0x36, 0xa0, 0xba, 0x0e, 0x36, 0xc6, 0x06, 0xa3, 0x0e, 0x50, 0xa8,
-  0x10, 0x74, 0x59, 0xba, 0xcc, 0x03, 0xec, 0x2a, 0xe4, 0xa8, 0x01, 0x74,
-  0x09, 0x36, 0xc7, 0x06, 0xae, 0x0e, 0xd0, 0x03, 0xeb, 0x07, 0x36, 0xc7,
-  0x06, 0xae, 0x0e, 0xb0, 0x03, 0xb0, 0x06, 0xba, 0xce, 0x03, 0xee, 0xba,
-  0xcf, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x04, 0xb0,
-  0x01, 0xeb, 0x02, 0x30, 0xc0, 0x36, 0xa2, 0xac, 0x0e, 0x88, 0xe0, 0x30,
-  0xe4, 0xd1, 0xf8, 0xd1, 0xf8, 0x25, 0x03, 0x00, 0xba, 0xc4, 0x03, 0x0e,
-  0xe8, 0x0d, 0xfe, 0xb0, 0x01, 0xee, 0xba, 0xc5, 0x03, 0xec, 0x2a, 0xe4,
-  0xa8, 0x01, 0x75, 0x06, 0xb0, 0x01, 0xeb, 0x04, 0xeb, 0x35, 0x30, 0xc0,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x36, 0xa2, 0xbc, 0x0e, 0xb0, 0x13, 0x83,
-  0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec,
-  0x2a, 0xe4, 0xd0, 0xe0, 0x36, 0xa2, 0xb8, 0x0e, 0x36, 0x80, 0x3e, 0xac,
-  0x0e, 0x00, 0x74, 0x08, 0x36, 0xa2, 0xa3, 0x0e, 0x0e, 0xe8, 0x4a, 0xfd,
-  0xe9, 0xf2, 0x01, 0xa8, 0x20, 0x74, 0x56, 0xb8, 0x40, 0x00, 0xbb, 0x63,
-  0x00, 0x8e, 0xd8, 0x8a, 0x07, 0x24, 0xf0, 0x3c, 0xd0, 0x74, 0x0d, 0x3c,
-  0xb0, 0x75, 0x09, 0x36, 0xc7, 0x06, 0xae, 0x0e, 0xb0, 0x03, 0xeb, 0x07,
-  0x36, 0xc7, 0x06, 0xae, 0x0e, 0xd0, 0x03, 0xb8, 0x00, 0x0f, 0xcd, 0x10,
-  0x3c, 0x12, 0x77, 0x2c, 0x30, 0xe4, 0x89, 0xc3, 0xd1, 0xe3, 0x2e, 0xff,
-  0xa7, 0x0c, 0x9e, 0x36, 0xc6, 0x06, 0xac, 0x0e, 0x01, 0x36, 0x81, 0x3e,
-  0xae, 0x0e, 0xb0, 0x03, 0x75, 0x05, 0xb8, 0x02, 0x00, 0xeb, 0x16, 0xb8,
-  0x03, 0x00, 0xeb, 0x11, 0xb8, 0x03, 0x00, 0xeb, 0x06, 0xe9, 0xb2, 0x00,
-  0xb8, 0x01, 0x00, 0x36, 0xc6, 0x06, 0xac, 0x0e, 0x00, 0x0e, 0xe8, 0x5b,
-  0xfd, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x13, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0xd0,
-  0xe0, 0x36, 0xa2, 0xb8, 0x0e, 0x36, 0x80, 0x3e, 0xac, 0x0e, 0x00, 0x74,
-  0x08, 0x36, 0xa2, 0xa3, 0x0e, 0x0e, 0xe8, 0xb1, 0xfc, 0x36, 0x8b, 0x36,
-  0xb0, 0x0e, 0x36, 0x8b, 0x1e, 0xb0, 0x0e, 0x36, 0x8b, 0x3e, 0xb2, 0x0e,
-  0x36, 0xa1, 0xb0, 0x0e, 0x36, 0x8b, 0x16, 0xb2, 0x0e, 0x83, 0xe6, 0x0f,
-  0xb1, 0x04, 0xd3, 0xeb, 0xd3, 0xcf, 0x31, 0xfb, 0x81, 0xe7, 0xff, 0x0f,
-  0x31, 0xfb, 0x36, 0x89, 0x36, 0x90, 0x0e, 0x36, 0x89, 0x1e, 0x92, 0x0e,
-  0x36, 0x03, 0x06, 0xb4, 0x0e, 0x36, 0x13, 0x16, 0xb6, 0x0e, 0x36, 0x89,
-  0x36, 0x98, 0x0e, 0xb1, 0x04, 0xd3, 0xe8, 0xd3, 0xca, 0x31, 0xd0, 0x81,
-  0xe2, 0xff, 0x0f, 0x31, 0xd0, 0x36, 0x89, 0x1e, 0x9a, 0x0e, 0x36, 0x8b,
-  0x16, 0xb0, 0x0e, 0x36, 0xa3, 0x96, 0x0e, 0x36, 0x03, 0x16, 0xb4, 0x0e,
-  0x36, 0xa3, 0x9e, 0x0e, 0x36, 0x89, 0x16, 0x94, 0x0e, 0x36, 0x89, 0x16,
-  0x9c, 0x0e, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xa8, 0x40,
-  0x74, 0x1e, 0x36, 0xc7, 0x06, 0xae, 0x0e, 0xd0, 0x03, 0xb8, 0x00, 0x0f,
-  0xcd, 0x10, 0x88, 0xc4, 0x3c, 0x07, 0x74, 0x04, 0x3c, 0x03, 0x77, 0x0a,
-  0x36, 0xc6, 0x06, 0xac, 0x0e, 0x01, 0xeb, 0x08, 0xeb, 0x64, 0x36, 0xc6,
-  0x06, 0xac, 0x0e, 0x00, 0x80, 0xfc, 0x01, 0x77, 0x0a, 0xb0, 0x28, 0x36,
-  0xa2, 0xb8, 0x0e, 0x36, 0xa2, 0xa3, 0x0e, 0x36, 0xc7, 0x06, 0xb0, 0x0e,
-  0x00, 0x80, 0x36, 0xc7, 0x06, 0xb2, 0x0e, 0x0b, 0x00, 0x36, 0xc7, 0x06,
-  0xb4, 0x0e, 0x00, 0x80, 0x36, 0xc7, 0x06, 0x92, 0x0e, 0x00, 0xb8, 0x36,
-  0xc7, 0x06, 0x96, 0x0e, 0x00, 0xc0, 0x36, 0xc7, 0x06, 0x9a, 0x0e, 0x00,
-  0xb8, 0x31, 0xc0, 0x36, 0xc7, 0x06, 0x9e, 0x0e, 0x00, 0xc0, 0x36, 0xa3,
-  0xb6, 0x0e, 0x36, 0xa3, 0x90, 0x0e, 0x36, 0xa3, 0x94, 0x0e, 0x36, 0xa3,
-  0x98, 0x0e, 0x36, 0xa3, 0x9c, 0x0e, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0xa8, 0x80, 0x74, 0x57, 0x36, 0xc7, 0x06, 0xae, 0x0e, 0xb0,
-  0x03, 0x36, 0xc6, 0x06, 0xac, 0x0e, 0x01, 0x36, 0xc7, 0x06, 0xb2, 0x0e,
-  0x0b, 0x00, 0x36, 0xc7, 0x06, 0xb4, 0x0e, 0x00, 0x80, 0x36, 0xc7, 0x06,
-  0x92, 0x0e, 0x00, 0xb0, 0x36, 0xc7, 0x06, 0x94, 0x0e, 0x00, 0x80, 0x36,
-  0xc7, 0x06, 0x96, 0x0e, 0x00, 0xb8, 0x36, 0xc7, 0x06, 0x9a, 0x0e, 0x00,
-  0xb0, 0x36, 0xc7, 0x06, 0x9c, 0x0e, 0x00, 0x80, 0x31, 0xc0, 0x36, 0xc7,
-  0x06, 0x9e, 0x0e, 0x00, 0xb8, 0x36, 0xa3, 0xb0, 0x0e, 0x36, 0xa3, 0xb6,
-  0x0e, 0x36, 0xa3, 0x90, 0x0e, 0x36, 0xa3, 0x98, 0x0e, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x30, 0x8d, 0x7e, 0xc6, 0x8d, 0x56, 0xc6,
-  0x8d, 0x5e, 0xc6, 0x8c, 0xd0, 0x16, 0x8c, 0xd1, 0x8e, 0xc0, 0x8e, 0xd8,
-  0xbe, 0xf4, 0x0e, 0x31, 0xc0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-  0x52, 0x36, 0xa3, 0xba, 0x0e, 0x36, 0xa3, 0xae, 0x0e, 0xb8, 0x10, 0x00,
-  0xc7, 0x46, 0xc6, 0x00, 0x1a, 0x0e, 0x3e, 0xe8, 0xe6, 0x7a, 0x80, 0x7e,
-  0xc6, 0x1a, 0x75, 0x4d, 0x8a, 0x46, 0xc8, 0x3c, 0x01, 0x75, 0x08, 0x36,
-  0x80, 0x0e, 0xba, 0x0e, 0x80, 0xeb, 0x3e, 0x3c, 0x02, 0x75, 0x08, 0x36,
-  0x80, 0x0e, 0xba, 0x0e, 0x40, 0xeb, 0x32, 0x3c, 0x04, 0x74, 0x04, 0x3c,
-  0x05, 0x75, 0x08, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x60, 0xeb, 0x22, 0x3c,
-  0x07, 0x74, 0x04, 0x3c, 0x08, 0x75, 0x08, 0x36, 0x80, 0x0e, 0xba, 0x0e,
-  0x70, 0xeb, 0x12, 0x3c, 0x0a, 0x74, 0x08, 0x3c, 0x0b, 0x74, 0x04, 0x3c,
-  0x0c, 0x75, 0x06, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x48, 0x36, 0x83, 0x3e,
-  0xba, 0x0e, 0x00, 0x75, 0x28, 0xc7, 0x46, 0xc6, 0x00, 0x12, 0x8d, 0x56,
-  0xc6, 0x8d, 0x5e, 0xc6, 0xb8, 0x10, 0x00, 0x16, 0x8c, 0xd1, 0x52, 0xc7,
-  0x46, 0xc8, 0x10, 0xff, 0x0e, 0xe8, 0x70, 0x7a, 0x90, 0x80, 0x7e, 0xc9,
-  0xff, 0x74, 0x06, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x60, 0x36, 0x83, 0x3e,
-  0xba, 0x0e, 0x00, 0x74, 0x03, 0xe9, 0xb6, 0x00, 0xb0, 0x0f, 0xba, 0xd4,
-  0x03, 0xee, 0xba, 0xd5, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc3, 0xb0, 0xaa,
-  0xb9, 0xe8, 0x03, 0xee, 0xba, 0xd5, 0x03, 0x49, 0x74, 0x0a, 0xec, 0x2a,
-  0xe4, 0x88, 0x46, 0xf4, 0x3c, 0xaa, 0x75, 0xf3, 0xba, 0xd5, 0x03, 0x88,
-  0xd8, 0xee, 0x80, 0x7e, 0xf4, 0xaa, 0x75, 0xcd, 0x8d, 0x7e, 0xe2, 0x8d,
-  0x56, 0xe2, 0x8d, 0x5e, 0xe2, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x40, 0x8c,
-  0xd0, 0x16, 0x8c, 0xd1, 0x8e, 0xc0, 0x8e, 0xd8, 0xbe, 0x02, 0x0f, 0x52,
-  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xb8, 0x1a, 0x00, 0xc7, 0x46,
-  0xe2, 0x00, 0x81, 0x0e, 0x3e, 0xe8, 0xf8, 0x79, 0xf6, 0x46, 0xe2, 0x80,
-  0x74, 0x0c, 0xf6, 0x46, 0xee, 0x01, 0x75, 0x06, 0x36, 0x80, 0x0e, 0xba,
-  0x0e, 0x02, 0x8d, 0x7e, 0xd4, 0x8d, 0x56, 0xd4, 0x8d, 0x5e, 0xd4, 0x8c,
-  0xd0, 0x16, 0x8c, 0xd1, 0x8e, 0xc0, 0x8e, 0xd8, 0xbe, 0x10, 0x0f, 0x31,
-  0xc0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x52, 0x89, 0x46, 0xd6,
-  0x89, 0x46, 0xe0, 0xb8, 0x15, 0x00, 0xc7, 0x46, 0xd4, 0x00, 0x06, 0x0e,
-  0x3e, 0xe8, 0xb4, 0x79, 0x83, 0x7e, 0xd6, 0x00, 0x74, 0x0c, 0xf6, 0x46,
-  0xe0, 0x01, 0x75, 0x06, 0x36, 0x80, 0x0e, 0xbb, 0x0e, 0x01, 0x36, 0x83,
-  0x3e, 0xba, 0x0e, 0x00, 0x75, 0x36, 0xb0, 0x0f, 0xba, 0xb4, 0x03, 0xee,
-  0xba, 0xb5, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc3, 0xb0, 0xaa, 0xb9, 0xe8,
-  0x03, 0xee, 0xba, 0xb5, 0x03, 0x49, 0x74, 0x0a, 0xec, 0x2a, 0xe4, 0x88,
-  0x46, 0xf4, 0x3c, 0xaa, 0x75, 0xf3, 0xba, 0xb5, 0x03, 0x88, 0xd8, 0xee,
-  0x80, 0x7e, 0xf4, 0xaa, 0x75, 0x06, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x80,
-  0x36, 0xf6, 0x06, 0xba, 0x0e, 0x80, 0x74, 0x4c, 0xc7, 0x46, 0xf0, 0x00,
-  0x00, 0xba, 0xba, 0x03, 0xbe, 0xff, 0xff, 0xec, 0x2a, 0xe4, 0x88, 0xc3,
-  0x4e, 0x74, 0x3b, 0xba, 0xba, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc2, 0x80,
-  0xe2, 0x80, 0x88, 0xde, 0x80, 0xe6, 0x80, 0x88, 0x46, 0xf2, 0x38, 0xf2,
-  0x75, 0x24, 0x88, 0xda, 0x30, 0xc2, 0xf6, 0xc2, 0x01, 0x74, 0x11, 0x80,
-  0xf3, 0x01, 0xa8, 0x01, 0x74, 0x0a, 0xff, 0x46, 0xf0, 0x81, 0x7e, 0xf0,
-  0x58, 0x02, 0x73, 0x0a, 0xba, 0x80, 0x00, 0xec, 0x2a, 0xe4, 0xeb, 0xc4,
-  0xeb, 0x43, 0x85, 0xf6, 0x76, 0x3f, 0x8a, 0x46, 0xf2, 0x88, 0xda, 0x30,
-  0xe4, 0x30, 0xc2, 0xf6, 0xc2, 0x80, 0x74, 0x31, 0xb1, 0x04, 0xd3, 0xf8,
-  0x25, 0x07, 0x00, 0x36, 0x80, 0x0e, 0xba, 0x0e, 0x04, 0x36, 0xa2, 0xad,
-  0x0e, 0x3d, 0x05, 0x00, 0x74, 0x05, 0x3d, 0x01, 0x00, 0x75, 0x11, 0x8a,
-  0x46, 0xf2, 0xb1, 0x04, 0x30, 0xe4, 0xd3, 0xf8, 0x24, 0x07, 0x36, 0xa2,
-  0xad, 0x0e, 0xeb, 0x05, 0x36, 0x88, 0x26, 0xad, 0x0e, 0x0e, 0xe8, 0xe5,
-  0xfa, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57,
-  0x81, 0xec, 0x80, 0x00, 0x89, 0xc7, 0x89, 0xd6, 0x36, 0xf6, 0x06, 0xbb,
-  0x0e, 0x01, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x50,
-  0x36, 0xf6, 0x06, 0xba, 0x0e, 0x02, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb,
-  0x02, 0x31, 0xc0, 0x50, 0x36, 0xa0, 0xad, 0x0e, 0x30, 0xe4, 0x50, 0x36,
-  0xf6, 0x06, 0xba, 0x0e, 0x04, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02,
-  0x30, 0xc0, 0x50, 0x36, 0xf6, 0x06, 0xba, 0x0e, 0x08, 0x74, 0x05, 0xb8,
-  0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x50, 0x36, 0xf6, 0x06, 0xba, 0x0e,
-  0x80, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x50, 0x36,
-  0xf6, 0x06, 0xba, 0x0e, 0x40, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02,
-  0x31, 0xc0, 0x50, 0x36, 0xf6, 0x06, 0xba, 0x0e, 0x20, 0x74, 0x05, 0xb8,
-  0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x50, 0x36, 0xf6, 0x06, 0xba, 0x0e,
-  0x10, 0x74, 0x05, 0xb8, 0x01, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x50, 0x16,
-  0xb8, 0xc2, 0x08, 0x50, 0x16, 0x8d, 0x96, 0x78, 0xff, 0x52, 0x0e, 0xe8,
-  0xf4, 0x76, 0x90, 0x83, 0xc4, 0x1a, 0x85, 0xf6, 0x75, 0x10, 0x85, 0xff,
-  0x75, 0x0c, 0x8d, 0x86, 0x78, 0xff, 0x8c, 0xd2, 0x0e, 0xe8, 0x38, 0x03,
-  0xeb, 0x0f, 0x8d, 0x86, 0x78, 0xff, 0x89, 0xfb, 0x89, 0xf1, 0x8c, 0xd2,
-  0x0e, 0xe8, 0xa2, 0x7a, 0x90, 0x36, 0xa0, 0xbc, 0x0e, 0x30, 0xe4, 0x50,
-  0x36, 0xa0, 0xac, 0x0e, 0x50, 0x36, 0xa1, 0xb0, 0x0e, 0x36, 0x8b, 0x16,
-  0xb2, 0x0e, 0x36, 0x03, 0x06, 0xb4, 0x0e, 0x36, 0x13, 0x16, 0xb6, 0x0e,
-  0x05, 0xff, 0xff, 0x83, 0xd2, 0xff, 0x52, 0x50, 0x36, 0xff, 0x36, 0xb2,
-  0x0e, 0x36, 0xff, 0x36, 0xb0, 0x0e, 0x36, 0xff, 0x36, 0xae, 0x0e, 0x16,
-  0xb8, 0x0b, 0x09, 0x50, 0x16, 0x8d, 0x96, 0x78, 0xff, 0x52, 0x0e, 0xe8,
-  0x88, 0x76, 0x90, 0x83, 0xc4, 0x16, 0x85, 0xf6, 0x75, 0x10, 0x85, 0xff,
-  0x75, 0x0c, 0x8d, 0x86, 0x78, 0xff, 0x8c, 0xd2, 0x0e, 0xe8, 0xcc, 0x02,
-  0xeb, 0x0f, 0x8d, 0x86, 0x78, 0xff, 0x89, 0xfb, 0x89, 0xf1, 0x8c, 0xd2,
-  0x0e, 0xe8, 0x36, 0x7a, 0x90, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x88, 0xc3,
-  0x36, 0xa0, 0xba, 0x0e, 0xa8, 0x10, 0x74, 0x16, 0xba, 0xcc, 0x03, 0xec,
-  0x2a, 0xe4, 0x24, 0xfe, 0x30, 0xe4, 0x89, 0xc2, 0x88, 0xd8, 0x08, 0xd0,
-  0xba, 0xc2, 0x03, 0xee, 0xeb, 0x0c, 0xa8, 0x20, 0x74, 0x08, 0x88, 0xd8,
-  0xba, 0xc2, 0x03, 0x0c, 0x02, 0xee, 0x84, 0xdb, 0x74, 0x05, 0xb8, 0xd0,
-  0x03, 0xeb, 0x03, 0xb8, 0xb0, 0x03, 0x36, 0xa3, 0xae, 0x0e, 0x5a, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x36, 0xa0,
-  0xba, 0x0e, 0xa8, 0x10, 0x74, 0x2e, 0xba, 0xcc, 0x03, 0xec, 0x2a, 0xe4,
-  0xba, 0xc2, 0x03, 0x24, 0xfe, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0xee,
-  0xba, 0xcf, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x80, 0xe4, 0xf3, 0x80,
-  0xcc, 0x08, 0xba, 0xce, 0x03, 0xb0, 0x06, 0xee, 0xba, 0xcf, 0x03, 0x88,
-  0xe0, 0xee, 0xeb, 0x16, 0xa8, 0x20, 0x74, 0x23, 0xb0, 0x02, 0xba, 0xc2,
-  0x03, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0xee, 0xb0, 0x0a, 0xba, 0xcf,
-  0x03, 0xee, 0xb8, 0x40, 0x00, 0xbb, 0x63, 0x00, 0x8e, 0xd8, 0xc6, 0x07,
-  0xb4, 0xbb, 0x10, 0x00, 0x80, 0x0f, 0x30, 0x5a, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x36, 0xa0, 0xba, 0x0e, 0xa8, 0x10,
-  0x74, 0x2e, 0xba, 0xcc, 0x03, 0xec, 0x2a, 0xe4, 0xba, 0xc2, 0x03, 0x0c,
-  0x01, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0xee, 0xba, 0xcf, 0x03, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0x80, 0xe4, 0xf3, 0x80, 0xcc, 0x0c, 0xba, 0xce,
-  0x03, 0xb0, 0x06, 0xee, 0xba, 0xcf, 0x03, 0x88, 0xe0, 0xee, 0xeb, 0x16,
-  0xa8, 0x20, 0x74, 0x26, 0xb0, 0x03, 0xba, 0xc2, 0x03, 0xee, 0xb0, 0x06,
-  0xba, 0xce, 0x03, 0xee, 0xb0, 0x0e, 0xba, 0xcf, 0x03, 0xee, 0xb8, 0x40,
-  0x00, 0xbb, 0x63, 0x00, 0x8e, 0xd8, 0xc6, 0x07, 0xd4, 0xbb, 0x10, 0x00,
-  0x80, 0x27, 0x10, 0x80, 0x0f, 0x20, 0x5a, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc,
-  0x36, 0xa2, 0xa0, 0x0e, 0x36, 0x88, 0x16, 0xa1, 0x0e, 0xcb, 0x53, 0x51,
-  0x52, 0x56, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x88, 0xc1, 0x84, 0xc0,
-  0x75, 0x03, 0xe9, 0xb4, 0x00, 0x36, 0xa0, 0xa4, 0x0e, 0x38, 0xc1, 0x76,
-  0x02, 0x88, 0xc1, 0x36, 0xa0, 0xa4, 0x0e, 0x38, 0xc1, 0x73, 0x54, 0x88,
-  0xc5, 0x36, 0x8b, 0x1e, 0x98, 0x0e, 0x28, 0xcd, 0x36, 0x8e, 0x1e, 0x9a,
-  0x0e, 0x88, 0xc8, 0x36, 0x8a, 0x16, 0xb8, 0x0e, 0x30, 0xe4, 0x88, 0x56,
-  0xfe, 0x88, 0x66, 0xff, 0xf7, 0x6e, 0xfe, 0x89, 0xde, 0x8c, 0xda, 0xd1,
-  0xe0, 0x8e, 0xc2, 0x01, 0xc6, 0x30, 0xe4, 0x84, 0xed, 0x76, 0x24, 0x30,
-  0xc0, 0x36, 0x80, 0x3e, 0xb8, 0x0e, 0x00, 0x76, 0x14, 0x26, 0x8b, 0x14,
-  0x83, 0xc6, 0x02, 0xfe, 0xc0, 0x89, 0x17, 0x83, 0xc3, 0x02, 0x36, 0x3a,
-  0x06, 0xb8, 0x0e, 0x72, 0xec, 0xfe, 0xc4, 0x38, 0xec, 0x72, 0xdc, 0x36,
-  0x8a, 0x16, 0xa4, 0x0e, 0x88, 0xc8, 0x30, 0xf6, 0x30, 0xe4, 0x29, 0xc2,
-  0x89, 0xd0, 0x36, 0x8a, 0x16, 0xb8, 0x0e, 0x30, 0xf6, 0xf7, 0xea, 0x36,
-  0xc5, 0x1e, 0x98, 0x0e, 0xd1, 0xe0, 0x30, 0xf6, 0x01, 0xc3, 0x84, 0xc9,
-  0x76, 0x27, 0x30, 0xd2, 0x36, 0x80, 0x3e, 0xb8, 0x0e, 0x00, 0x76, 0x17,
-  0x36, 0x8a, 0x26, 0xa2, 0x0e, 0x30, 0xc0, 0x0c, 0x20, 0xfe, 0xc2, 0x89,
-  0x07, 0x83, 0xc3, 0x02, 0x36, 0x3a, 0x16, 0xb8, 0x0e, 0x72, 0xe9, 0xfe,
-  0xc6, 0x38, 0xce, 0x72, 0xd9, 0x89, 0xec, 0x5d, 0x5e, 0x5a, 0x59, 0x5b,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x36, 0xfe, 0x06, 0xa1, 0x0e, 0x36,
-  0xa0, 0xa1, 0x0e, 0x36, 0x3a, 0x06, 0xa4, 0x0e, 0x72, 0x11, 0x36, 0xa0,
-  0xa4, 0x0e, 0xfe, 0xc8, 0x36, 0xa2, 0xa1, 0x0e, 0xb8, 0x01, 0x00, 0x0e,
-  0xe8, 0x0b, 0xff, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x88, 0xc2, 0x3c, 0x0a, 0x75, 0x0c, 0x36, 0xc6, 0x06, 0xa0, 0x0e,
-  0x00, 0x0e, 0xe8, 0xc1, 0xff, 0xeb, 0x73, 0x3c, 0x09, 0x75, 0x23, 0x36,
-  0xa0, 0xa0, 0x0e, 0x0c, 0x07, 0xfe, 0xc0, 0x36, 0xa2, 0xa0, 0x0e, 0x36,
-  0x3a, 0x06, 0xa3, 0x0e, 0x72, 0x5c, 0x36, 0xc6, 0x06, 0xa0, 0x0e, 0x00,
-  0x0e, 0xe8, 0x9e, 0xff, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x36, 0xa0,
-  0xa0, 0x0e, 0x36, 0x3a, 0x06, 0xa3, 0x0e, 0x72, 0x0a, 0x36, 0xc6, 0x06,
-  0xa0, 0x0e, 0x00, 0x0e, 0xe8, 0x83, 0xff, 0x30, 0xf6, 0x36, 0x8a, 0x26,
-  0xa2, 0x0e, 0x89, 0xd1, 0x88, 0xe5, 0x36, 0xa0, 0xa1, 0x0e, 0x36, 0x8a,
-  0x16, 0xb8, 0x0e, 0x30, 0xe4, 0xf7, 0xea, 0x89, 0xc2, 0x36, 0xa0, 0xa0,
-  0x0e, 0x30, 0xe4, 0x01, 0xd0, 0x36, 0x8b, 0x1e, 0x98, 0x0e, 0xd1, 0xe0,
-  0x36, 0x8e, 0x1e, 0x9a, 0x0e, 0x01, 0xc3, 0x89, 0x0f, 0x36, 0xfe, 0x06,
-  0xa0, 0x0e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x89, 0xc3, 0x8e, 0xda, 0x80, 0x3f, 0x00, 0x74, 0x12, 0x8e, 0xda,
-  0x8a, 0x07, 0x30, 0xe4, 0x43, 0x0e, 0xe8, 0x55, 0xff, 0x8e, 0xda, 0x80,
-  0x3f, 0x00, 0x75, 0xee, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x52, 0x36, 0x80, 0x3e, 0xac, 0x0e, 0x00, 0x74, 0x48, 0x36, 0xa0,
-  0xa1, 0x0e, 0x30, 0xe4, 0x89, 0xc2, 0x36, 0xa0, 0xb8, 0x0e, 0x89, 0xc3,
-  0x89, 0xd0, 0xf7, 0xeb, 0x89, 0xc3, 0x36, 0xa0, 0xa0, 0x0e, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x30, 0xe4, 0x83, 0xc2, 0x04, 0x01, 0xc3, 0xb0, 0x0e,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xf8, 0x83, 0xc2, 0x05, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x0f, 0x83, 0xc2, 0x04, 0xee, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x5a, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x53, 0x36, 0x8b, 0x1e, 0x98, 0x0e, 0x30, 0xe4,
-  0x36, 0x8e, 0x1e, 0x9a, 0x0e, 0x36, 0x80, 0x3e, 0xa4, 0x0e, 0x00, 0x76,
-  0x23, 0x30, 0xc0, 0x36, 0x80, 0x3e, 0xb8, 0x0e, 0x00, 0x76, 0x10, 0xfe,
-  0xc0, 0xc7, 0x07, 0x20, 0x07, 0x83, 0xc3, 0x02, 0x36, 0x3a, 0x06, 0xb8,
-  0x0e, 0x72, 0xf0, 0xfe, 0xc4, 0x36, 0x3a, 0x26, 0xa4, 0x0e, 0x72, 0xdd,
-  0x5b, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x52, 0xba, 0xb8, 0x03, 0x30,
-  0xc0, 0xee, 0xb0, 0x01, 0xba, 0xbf, 0x03, 0xee, 0xb0, 0x02, 0xba, 0xb8,
-  0x03, 0xee, 0x30, 0xe4, 0x88, 0xe0, 0xba, 0xb4, 0x03, 0x88, 0xe3, 0xee,
-  0x30, 0xff, 0xba, 0xb5, 0x03, 0x36, 0x8a, 0x87, 0xcc, 0x0e, 0xee, 0xfe,
-  0xc4, 0x80, 0xfc, 0x0c, 0x72, 0xe6, 0xb0, 0x0a, 0xba, 0xb8, 0x03, 0xee,
-  0x5a, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x52,
-  0xba, 0xb8, 0x03, 0x30, 0xc0, 0xee, 0xba, 0xbf, 0x03, 0xee, 0x30, 0xe4,
-  0x88, 0xe0, 0xba, 0xb4, 0x03, 0x88, 0xe3, 0xee, 0x30, 0xff, 0xba, 0xb5,
-  0x03, 0x36, 0x8a, 0x87, 0xd8, 0x0e, 0xee, 0xfe, 0xc4, 0x80, 0xfc, 0x0c,
-  0x72, 0xe6, 0xb0, 0x28, 0xba, 0xb8, 0x03, 0xee, 0x5a, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x30, 0xe4, 0xb1, 0x05,
-  0x89, 0xc3, 0x88, 0xd0, 0xd3, 0xe3, 0xba, 0xd9, 0x03, 0x09, 0xd8, 0xee,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x52, 0xba,
-  0xd8, 0x03, 0xee, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x88, 0xc7, 0x88, 0xd3, 0xba, 0xda, 0x03, 0xec, 0x2a, 0xe4, 0x88,
-  0xf8, 0x30, 0xe4, 0x05, 0x10, 0x00, 0xee, 0xba, 0xde, 0x03, 0x88, 0xd8,
-  0xee, 0xba, 0xda, 0x03, 0xee, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x52, 0xb0, 0x04, 0xba, 0xc4, 0x03, 0xee, 0xb0, 0x06, 0xba,
-  0xc5, 0x03, 0xee, 0xba, 0xc4, 0x03, 0x30, 0xc0, 0xee, 0xb0, 0x01, 0xba,
-  0xc5, 0x03, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2,
-  0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0xe3, 0x83, 0xc2, 0x05,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x30, 0xc0, 0x83, 0xc2, 0x05, 0xee, 0xba,
-  0xc4, 0x03, 0xee, 0xb0, 0x03, 0xba, 0xc5, 0x03, 0xee, 0xb0, 0x02, 0xba,
-  0xc4, 0x03, 0xee, 0xb0, 0x0f, 0xba, 0xc5, 0x03, 0xee, 0x5a, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x89, 0xc3, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x13, 0x83, 0xc2, 0x04, 0xb1, 0x03, 0xee,
-  0xd3, 0xeb, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xd8, 0x83, 0xc2, 0x05,
-  0xee, 0x5a, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x52, 0x89, 0xc3, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x0c, 0x83,
-  0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2,
-  0x05, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x0d, 0x83, 0xc2, 0x04,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee,
-  0x5a, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x52, 0x88,
-  0xc4, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x08, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x5a,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x88, 0xc3,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x0a, 0xec, 0x2a, 0xe4, 0xb0,
-  0x33, 0xba, 0xc0, 0x03, 0xee, 0x88, 0xd8, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x0a, 0xec, 0x2a, 0xe4, 0x5a, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x89, 0xc3, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0xb0, 0x18, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x88, 0xe0, 0x30, 0xe4, 0xb1,
-  0x04, 0x24, 0x01, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xd3, 0xe0, 0x83, 0xc2,
-  0x04, 0x89, 0xc1, 0x36, 0xf6, 0x06, 0xba, 0x0e, 0x10, 0x74, 0x70, 0xb0,
-  0x07, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a,
-  0xe4, 0x25, 0xef, 0x00, 0x09, 0xc8, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88,
-  0xc4, 0x83, 0xc2, 0x04, 0xb0, 0x07, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0,
-  0x09, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2,
-  0x05, 0xb1, 0x09, 0xec, 0x2a, 0xe4, 0x89, 0xda, 0xd3, 0xea, 0x30, 0xe4,
-  0x30, 0xf6, 0xb1, 0x06, 0x80, 0xe2, 0x01, 0x24, 0xbf, 0xd3, 0xe2, 0x09,
-  0xd0, 0x88, 0xc4, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x09, 0x83, 0xc2,
-  0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05,
-  0xee, 0xeb, 0x11, 0xb0, 0x07, 0x80, 0xc9, 0x0f, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x88, 0xc8, 0x83, 0xc2, 0x05, 0xee, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x52, 0xb0, 0x04, 0xba, 0xce, 0x03,
-  0xee, 0xb0, 0x02, 0xba, 0xcf, 0x03, 0xee, 0xb0, 0x05, 0xba, 0xce, 0x03,
-  0xee, 0xba, 0xcf, 0x03, 0x30, 0xc0, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03,
-  0xee, 0xb0, 0x0c, 0xba, 0xcf, 0x03, 0xee, 0xb0, 0x02, 0xba, 0xc4, 0x03,
-  0xee, 0xb0, 0x04, 0xba, 0xc5, 0x03, 0xee, 0xba, 0xc4, 0x03, 0xee, 0xb0,
-  0x06, 0xba, 0xc5, 0x03, 0xee, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x52, 0xb0, 0x04, 0xba, 0xce, 0x03, 0xee, 0xba, 0xcf, 0x03,
-  0x30, 0xc0, 0xee, 0xb0, 0x05, 0xba, 0xce, 0x03, 0xee, 0xb0, 0x10, 0xba,
-  0xcf, 0x03, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0xee, 0xb0, 0x0e, 0xba,
-  0xcf, 0x03, 0xee, 0xb0, 0x02, 0xba, 0xc4, 0x03, 0xee, 0xb0, 0x03, 0xba,
-  0xc5, 0x03, 0xee, 0xb0, 0x04, 0xba, 0xc4, 0x03, 0xee, 0xb0, 0x02, 0xba,
-  0xc5, 0x03, 0xee, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x52, 0x88, 0xc3, 0x36, 0x3a, 0x06, 0xbc, 0x0e, 0x74, 0x4c, 0xb0,
-  0x01, 0xba, 0xc4, 0x03, 0xee, 0xba, 0xc5, 0x03, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0x80, 0xe4, 0xfe, 0x88, 0xd8, 0x34, 0x01, 0x08, 0xc4, 0xba, 0xc4,
-  0x03, 0xb0, 0x01, 0xee, 0xba, 0xc5, 0x03, 0x88, 0xe0, 0xee, 0xba, 0xcc,
-  0x03, 0x36, 0x88, 0x1e, 0xbc, 0x0e, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x80,
-  0xe4, 0xf3, 0x84, 0xdb, 0x74, 0x05, 0xba, 0x01, 0x00, 0xeb, 0x02, 0x31,
-  0xd2, 0xd1, 0xe2, 0x88, 0xe0, 0xd1, 0xe2, 0x30, 0xe4, 0x09, 0xd0, 0xba,
-  0xc2, 0x03, 0xee, 0x5a, 0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x56, 0x89, 0xc3, 0xb1, 0x0e, 0x89, 0xd6, 0xd3, 0xee, 0xd3,
-  0xe8, 0x89, 0xf1, 0xd1, 0xe1, 0x30, 0xe4, 0xd1, 0xe1, 0x09, 0xc8, 0xb1,
-  0x0d, 0xd3, 0xeb, 0x30, 0xff, 0xb1, 0x04, 0x80, 0xe3, 0x01, 0xd3, 0xe3,
-  0xb1, 0x0d, 0x30, 0xe4, 0xd3, 0xea, 0x09, 0xd8, 0x30, 0xf6, 0xb1, 0x05,
-  0x80, 0xe2, 0x01, 0x30, 0xe4, 0xd3, 0xe2, 0x09, 0xd0, 0x88, 0xc4, 0xba,
-  0xc4, 0x03, 0xb0, 0x03, 0xee, 0xba, 0xc5, 0x03, 0x88, 0xe0, 0xee, 0x5e,
-  0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x56, 0x83, 0xec, 0x04, 0x89, 0xc3, 0x8e, 0xda, 0x36, 0xf6, 0x06, 0xba,
-  0x0e, 0x10, 0x75, 0x03, 0xe9, 0x31, 0x04, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83,
-  0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x80, 0xe4, 0x7f, 0x83, 0xc2, 0x04, 0xb0, 0x17, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0xba, 0xcc, 0x03, 0xec,
-  0x2a, 0xe4, 0x8a, 0x17, 0x88, 0xd1, 0x80, 0xe1, 0x03, 0x30, 0xed, 0x88,
-  0xc4, 0x89, 0xce, 0x80, 0xe4, 0x3b, 0xd1, 0xe6, 0x88, 0xe1, 0xd1, 0xe6,
-  0x89, 0xc8, 0x09, 0xf0, 0x88, 0xd4, 0xd0, 0xec, 0xd0, 0xec, 0x80, 0xe4,
-  0x01, 0x88, 0x6e, 0xf7, 0x88, 0x66, 0xf6, 0xb1, 0x06, 0x8b, 0x76, 0xf6,
-  0x30, 0xe4, 0xd3, 0xe6, 0x89, 0x46, 0xf6, 0x09, 0xf0, 0xb1, 0x03, 0x89,
-  0x46, 0xf6, 0x88, 0xd0, 0xd2, 0xe8, 0x24, 0x01, 0xb1, 0x07, 0x30, 0xe4,
-  0x8a, 0x56, 0xf6, 0xd3, 0xe0, 0x30, 0xf6, 0x89, 0xc1, 0x89, 0xd0, 0xba,
-  0xc2, 0x03, 0x09, 0xc8, 0xee, 0x8a, 0x57, 0x1e, 0x88, 0xd0, 0x24, 0x01,
-  0x30, 0xe4, 0xb1, 0x04, 0x89, 0xc6, 0x88, 0xd0, 0xd1, 0xe6, 0xd0, 0xe8,
-  0xd1, 0xe6, 0x24, 0x01, 0x89, 0xf2, 0xd3, 0xe0, 0x09, 0xc2, 0x8a, 0x07,
-  0xd2, 0xe8, 0x24, 0x01, 0x34, 0x01, 0x30, 0xe4, 0xb1, 0x05, 0x09, 0xc2,
-  0x8a, 0x07, 0xd2, 0xe8, 0xb1, 0x03, 0x24, 0x01, 0xd3, 0xe0, 0x89, 0xd1,
-  0xba, 0xc4, 0x03, 0x09, 0xc1, 0xb0, 0x01, 0xee, 0xba, 0xc5, 0x03, 0x88,
-  0xc8, 0xee, 0x30, 0xe4, 0x80, 0x7f, 0x16, 0x05, 0x75, 0x05, 0xba, 0x01,
-  0x00, 0xeb, 0x02, 0x31, 0xd2, 0xb1, 0x06, 0xd3, 0xe2, 0x8b, 0x4f, 0x14,
-  0x83, 0xe1, 0x0f, 0x09, 0xd1, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x11,
-  0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xc8, 0x83,
-  0xc2, 0x05, 0xee, 0xb0, 0x06, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x8a, 0x4f,
-  0x10, 0x83, 0xc2, 0x04, 0x80, 0xe9, 0x02, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x88, 0xc8, 0x83, 0xc2, 0x05, 0xee, 0x8b, 0x57, 0x10, 0x83, 0xea,
-  0x02, 0x89, 0x56, 0xf6, 0x8a, 0x56, 0xf7, 0x30, 0xf6, 0x88, 0xe0, 0x89,
-  0xd1, 0x30, 0xe4, 0x80, 0xe1, 0x01, 0x89, 0xc2, 0x8b, 0x76, 0xf6, 0x08,
-  0xca, 0xb1, 0x09, 0xd3, 0xee, 0xb1, 0x05, 0x83, 0xe6, 0x01, 0x8a, 0x67,
-  0x12, 0xd3, 0xe6, 0x89, 0xd1, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x10,
-  0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83,
-  0xc2, 0x05, 0xee, 0x8a, 0x47, 0x13, 0x30, 0xe4, 0x09, 0xf1, 0x89, 0xc6,
-  0x83, 0xe6, 0x01, 0x88, 0xc8, 0xd1, 0xe6, 0x89, 0xc2, 0xd1, 0xe6, 0xb1,
-  0x09, 0x09, 0xf2, 0x8b, 0x77, 0x12, 0xd3, 0xee, 0xb1, 0x07, 0x83, 0xe6,
-  0x01, 0x88, 0xd0, 0xd3, 0xe6, 0x89, 0xc1, 0x8a, 0x67, 0x18, 0x09, 0xf1,
-  0xfe, 0xcc, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x12, 0x83, 0xc2, 0x04,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee,
-  0x8b, 0x47, 0x18, 0x48, 0x89, 0x46, 0xf6, 0x8a, 0x46, 0xf7, 0x30, 0xe4,
-  0x89, 0xc6, 0x88, 0xc8, 0xb1, 0x09, 0x89, 0xc2, 0x8b, 0x46, 0xf6, 0xd3,
-  0xe8, 0x83, 0xe6, 0x01, 0x30, 0xe4, 0xb1, 0x06, 0x24, 0x01, 0xd1, 0xe6,
-  0xd3, 0xe0, 0x09, 0xf2, 0x89, 0xc1, 0x88, 0xd0, 0x30, 0xe4, 0x89, 0x46,
-  0xf6, 0x09, 0xc8, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x89, 0x46, 0xf6, 0x8a,
-  0x67, 0x1a, 0x83, 0xc2, 0x04, 0xb0, 0x15, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a, 0x47, 0x1b, 0x30, 0xe4,
-  0x89, 0xc2, 0xb1, 0x03, 0x80, 0xe2, 0x01, 0x8a, 0x46, 0xf6, 0xd3, 0xe2,
-  0x89, 0x46, 0xf8, 0x09, 0xd0, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x89, 0x46,
-  0xf8, 0x8a, 0x67, 0x1c, 0x83, 0xc2, 0x04, 0xb0, 0x16, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a, 0x47, 0x17,
-  0x30, 0xe4, 0xb1, 0x05, 0x89, 0xc2, 0x8a, 0x07, 0xd3, 0xe2, 0xb1, 0x07,
-  0xd2, 0xe8, 0xb1, 0x06, 0xd3, 0xe0, 0x89, 0xc1, 0x09, 0xd1, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x88, 0xc8, 0x83, 0xc2, 0x05, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0xb0, 0x07, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x8a, 0x46, 0xf8, 0x83, 0xc2, 0x05, 0xb1, 0x06, 0xee, 0x8a, 0x07, 0xd2,
-  0xe8, 0x24, 0x01, 0x34, 0x01, 0x30, 0xe4, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xd3, 0xe0, 0x83, 0xc2, 0x04, 0x89, 0xc1, 0xb0, 0x17, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x24, 0x10, 0x30,
-  0xe4, 0x89, 0xc2, 0x8a, 0x47, 0x1e, 0xd0, 0xe8, 0x09, 0xca, 0xd0, 0xe8,
-  0xb1, 0x05, 0x24, 0x01, 0xd3, 0xe0, 0xb1, 0x03, 0x09, 0xc2, 0x8a, 0x47,
-  0x1e, 0xd2, 0xe8, 0x24, 0x01, 0x30, 0xe4, 0xd3, 0xe0, 0xb1, 0x04, 0x09,
-  0xc2, 0x8a, 0x47, 0x1e, 0xd2, 0xe8, 0x24, 0x01, 0x30, 0xe4, 0xd1, 0xe0,
-  0xd1, 0xe0, 0xb1, 0x05, 0x09, 0xc2, 0x8a, 0x47, 0x1e, 0xd2, 0xe8, 0x24,
-  0x01, 0x34, 0x01, 0x30, 0xe4, 0xd1, 0xe0, 0xb1, 0x06, 0x09, 0xc2, 0x8a,
-  0x47, 0x1e, 0xd2, 0xe8, 0x24, 0x01, 0x34, 0x01, 0x89, 0xd1, 0x30, 0xe4,
-  0x09, 0xc1, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2, 0x04,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xc8, 0x83, 0xc2, 0x05, 0xee,
-  0x8a, 0x67, 0x02, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x80, 0xec, 0x05, 0x83,
-  0xc2, 0x04, 0x30, 0xc8, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0,
-  0x83, 0xc2, 0x05, 0xee, 0x8a, 0x67, 0x04, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xfe, 0xcc, 0x83, 0xc2, 0x04, 0xb0, 0x01, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a, 0x67, 0x06, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0xb0, 0x02, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xb1, 0x05, 0xee, 0x8a, 0x47,
-  0x0e, 0xd2, 0xe0, 0x8a, 0x67, 0x08, 0x80, 0xe4, 0x1f, 0x08, 0xc4, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x80, 0xcc, 0x80, 0x83, 0xc2, 0x04, 0xb0, 0x03,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee,
-  0x8a, 0x67, 0x0a, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x04, 0x83, 0xc2,
-  0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05,
-  0xee, 0x8b, 0x57, 0x08, 0x8a, 0x47, 0x0f, 0xd3, 0xea, 0x8b, 0x5f, 0x0c,
-  0x30, 0xf6, 0xb1, 0x07, 0x80, 0xe2, 0x01, 0x30, 0xe4, 0xd3, 0xe2, 0xb1,
-  0x05, 0x30, 0xff, 0xd3, 0xe0, 0x80, 0xe3, 0x1f, 0x09, 0xd0, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x09, 0xc3, 0x83, 0xc2, 0x04, 0x88, 0xc8, 0xee, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x80, 0xcc, 0x80, 0x83, 0xc2, 0x04, 0xb0, 0x11, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x80, 0xcc, 0x80, 0x83, 0xc2, 0x04, 0xb0, 0x17,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee,
-  0x8d, 0x66, 0xfa, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x56, 0x83, 0xec, 0x06, 0x89, 0xc3, 0x8e, 0xda,
-  0x36, 0xf6, 0x06, 0xba, 0x0e, 0x10, 0x75, 0x03, 0xe9, 0xb7, 0x04, 0xba,
-  0xcc, 0x03, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x89, 0xc2, 0xd1, 0xfa, 0xd1,
-  0xfa, 0x80, 0xe2, 0x03, 0x80, 0x27, 0xfc, 0xb1, 0x06, 0x08, 0x17, 0x89,
-  0xc2, 0xd3, 0xfa, 0x80, 0x27, 0xfb, 0x80, 0xe2, 0x01, 0xb1, 0x07, 0xd3,
-  0xf8, 0xb1, 0x03, 0xd0, 0xe2, 0x24, 0x01, 0xd0, 0xe2, 0x08, 0x17, 0xd2,
-  0xe0, 0x80, 0x27, 0xf7, 0x08, 0x07, 0xb0, 0x01, 0xba, 0xc4, 0x03, 0xee,
-  0xba, 0xc5, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0x80, 0xe4, 0x01, 0x80,
-  0xf4, 0x01, 0xb1, 0x04, 0x80, 0xe4, 0x01, 0x80, 0x27, 0xef, 0xd2, 0xe4,
-  0x08, 0x27, 0x30, 0xe4, 0xb1, 0x03, 0x89, 0xc2, 0xd3, 0xfa, 0x80, 0xe2,
-  0x01, 0xb1, 0x05, 0x80, 0x27, 0xdf, 0xd2, 0xe2, 0xb1, 0x04, 0x08, 0x17,
-  0x89, 0xc2, 0xd3, 0xfa, 0x80, 0x67, 0x1e, 0xfd, 0x80, 0xe2, 0x01, 0xd1,
-  0xf8, 0xd1, 0xf8, 0xd0, 0xe2, 0x24, 0x01, 0x08, 0x57, 0x1e, 0x80, 0x67,
-  0x1e, 0xfe, 0x08, 0x47, 0x1e, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17,
-  0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05,
-  0xb1, 0x06, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8, 0x24, 0x01, 0x34,
-  0x01, 0x24, 0x01, 0x80, 0x27, 0xbf, 0xd2, 0xe0, 0x89, 0xde, 0x08, 0x07,
-  0x8c, 0xd8, 0x83, 0xc6, 0x1e, 0x8e, 0xc0, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83,
-  0xc2, 0x05, 0xb1, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8, 0x24,
-  0x01, 0xd0, 0xe0, 0x80, 0x24, 0xfb, 0xd0, 0xe0, 0x08, 0x04, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x83, 0xc2, 0x05, 0xb1, 0x03, 0xec, 0x2a, 0xe4, 0x30, 0xe4,
-  0xd3, 0xf8, 0x24, 0x01, 0x80, 0x24, 0xf7, 0xd2, 0xe0, 0x08, 0x04, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd1,
-  0xf8, 0xd1, 0xf8, 0x24, 0x01, 0xb1, 0x04, 0x80, 0x24, 0xef, 0xd2, 0xe0,
-  0x08, 0x04, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x17, 0x83, 0xc2, 0x04,
-  0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4,
-  0x30, 0xe4, 0xd1, 0xf8, 0x24, 0x01, 0x34, 0x01, 0xb1, 0x05, 0x24, 0x01,
-  0x80, 0x24, 0xdf, 0xd2, 0xe0, 0x08, 0x04, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83,
-  0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x24, 0x01, 0x34, 0x01, 0xb1, 0x06, 0x24,
-  0x01, 0x80, 0x24, 0xbf, 0xd2, 0xe0, 0x08, 0x04, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8, 0x24, 0x01,
-  0xb1, 0x07, 0x80, 0x27, 0x7f, 0xd2, 0xe0, 0x08, 0x07, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x30, 0xc0, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x05, 0x05, 0x00,
-  0x89, 0x47, 0x02, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x01, 0x83, 0xc2,
-  0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a,
-  0xe4, 0x30, 0xe4, 0x40, 0x89, 0x47, 0x04, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xb0, 0x02, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83,
-  0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x89, 0x47, 0x06, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8,
-  0xb1, 0x05, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xd3, 0xe0, 0x83, 0xc2, 0x04,
-  0x89, 0xc1, 0xb0, 0x03, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2,
-  0x05, 0xec, 0x2a, 0xe4, 0x24, 0x1f, 0x30, 0xe4, 0x89, 0xc2, 0x8b, 0x47,
-  0x06, 0x09, 0xca, 0x24, 0xc0, 0x09, 0xc2, 0x89, 0x57, 0x08, 0x8b, 0x57,
-  0x06, 0x8b, 0x47, 0x08, 0x30, 0xf6, 0x30, 0xe4, 0x80, 0xe2, 0x3f, 0x24,
-  0x3f, 0x39, 0xc2, 0x72, 0x04, 0x83, 0x47, 0x08, 0x40, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0xb0, 0x04, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x89, 0x47, 0x0a,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x8b, 0x57,
-  0x0a, 0x24, 0x1f, 0x80, 0xe2, 0xe0, 0x30, 0xe4, 0x09, 0xd0, 0x8b, 0x57,
-  0x0a, 0x89, 0x47, 0x0c, 0x30, 0xf6, 0x30, 0xe4, 0x80, 0xe2, 0x1f, 0x24,
-  0x1f, 0x39, 0xc2, 0x72, 0x04, 0x83, 0x47, 0x0c, 0x20, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0xb0, 0x03, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0x83, 0xc2, 0x05, 0xb1, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3,
-  0xf8, 0x24, 0x03, 0x88, 0x47, 0x0e, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88,
-  0xc8, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2,
-  0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8, 0x24, 0x03, 0x88, 0x47,
-  0x0f, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x07, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x36,
-  0x8b, 0x16, 0xae, 0x0e, 0x89, 0xc1, 0x88, 0x46, 0xf8, 0x24, 0x01, 0x83,
-  0xc2, 0x04, 0x88, 0x46, 0xf7, 0xb0, 0x06, 0xc6, 0x46, 0xf6, 0x00, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x88, 0x4e, 0xf4, 0x83, 0xc2, 0x05, 0xb1,
-  0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x8b, 0x56, 0xf6, 0x88, 0x66, 0xf5,
-  0x09, 0xc2, 0x8b, 0x46, 0xf4, 0xd3, 0xf8, 0x30, 0xe4, 0xb1, 0x09, 0x24,
-  0x01, 0xd3, 0xe0, 0x09, 0xd0, 0x05, 0x02, 0x00, 0x89, 0x47, 0x10, 0x8b,
-  0x46, 0xf4, 0xd1, 0xf8, 0xd1, 0xf8, 0x88, 0xc5, 0x80, 0xe5, 0x01, 0x30,
-  0xc9, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x10, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x30,
-  0xe4, 0x89, 0xc2, 0x8b, 0x46, 0xf4, 0x88, 0xee, 0xb1, 0x07, 0xd3, 0xf8,
-  0x30, 0xe4, 0xb1, 0x09, 0x24, 0x01, 0xd3, 0xe0, 0x09, 0xc2, 0x89, 0x57,
-  0x12, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xec, 0x2a, 0xe4, 0x8b,
-  0x57, 0x12, 0x24, 0x0f, 0x80, 0xe2, 0xf0, 0x30, 0xe4, 0x09, 0xd0, 0x89,
-  0x47, 0x14, 0x8b, 0x47, 0x12, 0x8b, 0x57, 0x14, 0x30, 0xe4, 0x30, 0xf6,
-  0x24, 0x0f, 0x80, 0xe2, 0x0f, 0x39, 0xd0, 0x72, 0x04, 0x83, 0x47, 0x14,
-  0x10, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee,
-  0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0xb1, 0x06, 0xec, 0x2a,
-  0xe4, 0x30, 0xe4, 0xd3, 0xf8, 0xa8, 0x01, 0x74, 0x05, 0xb8, 0x05, 0x00,
-  0xeb, 0x03, 0xb8, 0x03, 0x00, 0x88, 0x47, 0x16, 0x36, 0x8b, 0x16, 0xae,
-  0x0e, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0x83, 0xc2, 0x05, 0xb1, 0x05, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0xd3, 0xf8,
-  0x25, 0x01, 0x00, 0x88, 0x47, 0x17, 0x8a, 0x46, 0xf8, 0x36, 0x8b, 0x16,
-  0xae, 0x0e, 0x88, 0x46, 0xf6, 0x88, 0x66, 0xf7, 0x83, 0xc2, 0x04, 0xb0,
-  0x12, 0x8b, 0x4e, 0xf6, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xd1, 0xf9,
-  0x83, 0xc2, 0x05, 0x88, 0xcd, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x80, 0xe5,
-  0x01, 0x89, 0xc2, 0x8b, 0x46, 0xf6, 0x88, 0xee, 0xb1, 0x06, 0xd3, 0xf8,
-  0x30, 0xe4, 0xb1, 0x09, 0x24, 0x01, 0xd3, 0xe0, 0x09, 0xd0, 0x40, 0xb1,
-  0x03, 0x89, 0x47, 0x18, 0x8b, 0x46, 0xf6, 0x36, 0x8b, 0x16, 0xae, 0x0e,
-  0xd3, 0xf8, 0x83, 0xc2, 0x04, 0x88, 0xc5, 0xb0, 0x15, 0xee, 0x36, 0x8b,
-  0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05, 0x80, 0xe5, 0x01, 0xec, 0x2a, 0xe4,
-  0x88, 0xec, 0x89, 0x47, 0x1a, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0xb0, 0x16,
-  0x83, 0xc2, 0x04, 0xee, 0x36, 0x8b, 0x16, 0xae, 0x0e, 0x83, 0xc2, 0x05,
-  0xec, 0x2a, 0xe4, 0x8b, 0x57, 0x1a, 0x24, 0x7f, 0x80, 0xe2, 0x80, 0x30,
-  0xe4, 0x09, 0xd0, 0x89, 0x47, 0x1c, 0x8b, 0x47, 0x1a, 0x8b, 0x57, 0x1c,
-  0x30, 0xe4, 0x30, 0xf6, 0x24, 0x7f, 0x80, 0xe2, 0x7f, 0x39, 0xd0, 0x72,
-  0x05, 0x81, 0x47, 0x1c, 0x80, 0x00, 0x8d, 0x66, 0xfa, 0x5e, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57,
-  0x83, 0xec, 0x0e, 0x8d, 0x7e, 0xea, 0x8d, 0x5e, 0xea, 0x8c, 0xd0, 0x16,
-  0x8c, 0xd1, 0x8e, 0xc0, 0x8e, 0xd8, 0xbe, 0x1e, 0x0f, 0x53, 0xa5, 0xa5,
-  0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xb8, 0x10, 0x00, 0xc7, 0x46, 0xea, 0x12,
-  0x11, 0xc7, 0x46, 0xec, 0x00, 0x00, 0x0e, 0xe8, 0xca, 0x66, 0x90, 0x36,
-  0xc6, 0x06, 0xa4, 0x0e, 0x32, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x53, 0x89, 0xc3, 0x8e, 0xda, 0x8b, 0x07, 0x8b,
-  0x5f, 0x02, 0x85, 0xdb, 0x75, 0x0a, 0x3d, 0x01, 0x00, 0x75, 0x05, 0xb8,
-  0x01, 0x00, 0x5b, 0xcb, 0x31, 0xc0, 0x5b, 0xcb, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x1a, 0x36, 0xa0, 0xc4, 0x0e, 0x30,
-  0xe4, 0x89, 0xc2, 0xd1, 0xe2, 0xd1, 0xe2, 0xb1, 0x05, 0x01, 0xc2, 0x36,
-  0xa1, 0x98, 0x0e, 0xd3, 0xe2, 0x36, 0x8b, 0x1e, 0x9a, 0x0e, 0x01, 0xc2,
-  0x36, 0xa1, 0xc0, 0x0e, 0x36, 0x8b, 0x36, 0xbe, 0x0e, 0x89, 0x46, 0xfc,
-  0x31, 0xc0, 0x89, 0x5e, 0xfa, 0x89, 0x46, 0xf2, 0x83, 0x7e, 0xfc, 0x00,
-  0x75, 0x04, 0x85, 0xf6, 0x74, 0x49, 0x3d, 0x50, 0x00, 0x73, 0x44, 0x8e,
-  0x5e, 0xfc, 0x8b, 0x4c, 0x02, 0x8b, 0x1c, 0x85, 0xc9, 0x75, 0x04, 0x85,
-  0xdb, 0x74, 0x34, 0x8e, 0xd9, 0x8b, 0x4e, 0xf2, 0xc7, 0x46, 0xec, 0x01,
-  0x00, 0x36, 0x3b, 0x0e, 0xc2, 0x0e, 0x75, 0x04, 0xb1, 0x01, 0xeb, 0x02,
-  0x30, 0xc9, 0x88, 0x4e, 0xfe, 0x84, 0xc9, 0x74, 0x05, 0xb9, 0x00, 0x1f,
-  0xeb, 0x03, 0xb9, 0x00, 0x70, 0x89, 0x4e, 0xf6, 0x80, 0x7e, 0xfe, 0x00,
-  0x74, 0x08, 0xb9, 0x00, 0x1e, 0xeb, 0x06, 0xe9, 0xfc, 0x00, 0xb9, 0x00,
-  0x71, 0x8e, 0x46, 0xfc, 0x89, 0x4e, 0xf4, 0x26, 0x80, 0x7c, 0x06, 0x50,
-  0x73, 0xed, 0x8b, 0x4e, 0xf6, 0x80, 0xc9, 0x20, 0x89, 0x4e, 0xf0, 0x89,
-  0xc1, 0xd1, 0xe1, 0x89, 0x4e, 0xf8, 0x8e, 0x46, 0xfc, 0x26, 0x8a, 0x4c,
-  0x06, 0xc6, 0x46, 0xe7, 0x00, 0x88, 0x4e, 0xe6, 0x3b, 0x46, 0xe6, 0x73,
-  0x12, 0xc4, 0x7e, 0xf8, 0x8b, 0x4e, 0xf0, 0x40, 0x01, 0xd7, 0x83, 0x46,
-  0xf8, 0x02, 0x26, 0x89, 0x0d, 0xeb, 0xdb, 0x8e, 0x46, 0xfc, 0x26, 0x8a,
-  0x4c, 0x06, 0xc6, 0x46, 0xe7, 0x00, 0x88, 0x4e, 0xe6, 0x26, 0x8a, 0x4c,
-  0x07, 0xc6, 0x46, 0xeb, 0x00, 0x88, 0x4e, 0xea, 0x8b, 0x4e, 0xe6, 0x03,
-  0x4e, 0xea, 0x39, 0xc8, 0x73, 0x54, 0x80, 0x3f, 0x00, 0x74, 0x4f, 0x83,
-  0x7e, 0xec, 0x00, 0x74, 0x2a, 0x8a, 0x0f, 0x26, 0x3a, 0x4c, 0x04, 0x75,
-  0x22, 0xc6, 0x46, 0xe7, 0x00, 0x8e, 0x46, 0xfa, 0xc7, 0x46, 0xec, 0x00,
-  0x00, 0x88, 0x4e, 0xe6, 0x89, 0xc7, 0x43, 0x8b, 0x4e, 0xf4, 0xd1, 0xe7,
-  0x40, 0x0b, 0x4e, 0xe6, 0x01, 0xd7, 0x26, 0x89, 0x0d, 0xeb, 0xa8, 0xc6,
-  0x46, 0xeb, 0x00, 0x89, 0xc7, 0x8a, 0x0f, 0x43, 0x8e, 0x46, 0xfa, 0x88,
-  0x4e, 0xea, 0xd1, 0xe7, 0x8b, 0x4e, 0xf6, 0x0b, 0x4e, 0xea, 0x01, 0xd7,
-  0x40, 0x26, 0x89, 0x0d, 0xeb, 0x89, 0x8b, 0x5e, 0xf6, 0x80, 0xcb, 0x20,
-  0x89, 0x5e, 0xe8, 0x89, 0xc3, 0xd1, 0xe3, 0x89, 0x5e, 0xee, 0x8e, 0x5e,
-  0xfc, 0x8a, 0x4c, 0x06, 0x8a, 0x5c, 0x07, 0x30, 0xed, 0x30, 0xff, 0x01,
-  0xcb, 0x39, 0xd8, 0x73, 0x14, 0x8b, 0x5e, 0xee, 0x8e, 0x5e, 0xfa, 0x8b,
-  0x4e, 0xe8, 0x40, 0x01, 0xd3, 0x83, 0x46, 0xee, 0x02, 0x89, 0x0f, 0xeb,
-  0xd9, 0xff, 0x46, 0xf2, 0x83, 0xc6, 0x0c, 0xe9, 0xb8, 0xfe, 0x89, 0xc3,
-  0x8e, 0x5e, 0xfa, 0xd1, 0xe3, 0x3d, 0x50, 0x00, 0x73, 0x0e, 0x89, 0xde,
-  0x40, 0x01, 0xd6, 0x83, 0xc3, 0x02, 0xc7, 0x04, 0x20, 0x70, 0xeb, 0xed,
-  0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x8b, 0x76, 0x06, 0x89, 0x46,
-  0xf0, 0x89, 0x56, 0xf2, 0x89, 0xf0, 0xd1, 0xe0, 0xd1, 0xe0, 0x8e, 0xd9,
-  0x01, 0xc3, 0x8b, 0x47, 0x02, 0x8b, 0x3f, 0x89, 0x46, 0xf4, 0x8e, 0xd8,
-  0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x89, 0xf0, 0x30, 0xf6, 0xf7, 0xe2, 0xc7,
-  0x46, 0xf6, 0x01, 0x00, 0xd1, 0xe0, 0x8b, 0x1d, 0x05, 0x02, 0x00, 0x8b,
-  0x4d, 0x02, 0x01, 0x46, 0xf0, 0x85, 0xc9, 0x75, 0x3f, 0x83, 0xfb, 0x01,
-  0x75, 0x3a, 0x8b, 0x46, 0x0a, 0xc5, 0x5e, 0xf0, 0x0c, 0xcc, 0x89, 0x47,
-  0xfe, 0x31, 0xc0, 0x83, 0x7e, 0x08, 0x00, 0x76, 0x12, 0x8b, 0x56, 0x0a,
-  0x80, 0xca, 0xcd, 0x83, 0xc3, 0x02, 0x40, 0x89, 0x57, 0xfe, 0x3b, 0x46,
-  0x08, 0x72, 0xf4, 0x8b, 0x5e, 0x08, 0x8b, 0x46, 0x0a, 0xd1, 0xe3, 0x8e,
-  0x5e, 0xf2, 0x03, 0x5e, 0xf0, 0x0c, 0xb9, 0x89, 0x07, 0xe9, 0x88, 0x00,
-  0x31, 0xd2, 0x83, 0x7e, 0x08, 0x00, 0x76, 0x63, 0x8b, 0x76, 0xf0, 0x8b,
-  0x46, 0xf2, 0x89, 0x4e, 0xfa, 0x89, 0x46, 0xf8, 0x8e, 0x5e, 0xfa, 0x80,
-  0x3f, 0x00, 0x74, 0x4f, 0x83, 0x7e, 0xf6, 0x00, 0x74, 0x30, 0x8a, 0x07,
-  0x30, 0xe4, 0x0e, 0xe8, 0x90, 0x67, 0x90, 0x8e, 0x5e, 0xf4, 0x89, 0xc1,
-  0x8a, 0x45, 0x04, 0x30, 0xe4, 0x0e, 0x3e, 0xe8, 0x80, 0x67, 0x39, 0xc1,
-  0x75, 0x14, 0x8e, 0x5e, 0xfa, 0x8a, 0x07, 0x30, 0xe4, 0x8e, 0x5e, 0xf8,
-  0x0b, 0x46, 0x0c, 0xc7, 0x46, 0xf6, 0x00, 0x00, 0xeb, 0x0d, 0x8e, 0x5e,
-  0xfa, 0x8a, 0x07, 0x30, 0xe4, 0x8e, 0x5e, 0xf8, 0x0b, 0x46, 0x0a, 0x89,
-  0x04, 0x43, 0x42, 0x83, 0xc6, 0x02, 0x3b, 0x56, 0x08, 0x72, 0xa9, 0x8b,
-  0x46, 0x0a, 0x89, 0xd3, 0x8e, 0x5e, 0xf2, 0xd1, 0xe3, 0x0c, 0x20, 0x03,
-  0x5e, 0xf0, 0x3b, 0x56, 0x08, 0x73, 0x09, 0x83, 0xc3, 0x02, 0x42, 0x89,
-  0x47, 0xfe, 0xeb, 0xf2, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca,
-  0x08, 0x00, 0x45, 0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec, 0x36,
-  0x50, 0x52, 0x88, 0x5e, 0xf6, 0x8e, 0x5e, 0x08, 0x31, 0xc0, 0x8b, 0x5e,
-  0x06, 0x89, 0x46, 0xd4, 0x89, 0x46, 0xd6, 0x89, 0x46, 0xf4, 0x8b, 0x07,
-  0xc6, 0x46, 0xf8, 0x01, 0x3d, 0x00, 0x4b, 0x74, 0x05, 0x3d, 0x00, 0x4d,
-  0x75, 0x03, 0xff, 0x46, 0xf4, 0xc5, 0x5e, 0x06, 0xc7, 0x07, 0x00, 0x00,
-  0x83, 0x7e, 0xc0, 0x00, 0x75, 0x06, 0x83, 0x7e, 0xc2, 0x00, 0x74, 0x66,
-  0xb8, 0x01, 0x00, 0x89, 0x46, 0xe6, 0x89, 0x46, 0xf2, 0xb8, 0x40, 0x00,
-  0xbb, 0x17, 0x00, 0x8e, 0xd8, 0xba, 0x02, 0x00, 0x8a, 0x07, 0x31, 0xf6,
-  0x24, 0x08, 0x8e, 0x5e, 0xc0, 0x30, 0xe4, 0x8b, 0x5e, 0xc2, 0x89, 0x46,
-  0xc6, 0x8b, 0x47, 0x08, 0x89, 0x76, 0xdc, 0x89, 0x46, 0xc4, 0x8b, 0x47,
-  0x0a, 0x8b, 0x5e, 0xc4, 0x89, 0x46, 0xcc, 0x8e, 0xd8, 0x89, 0x5e, 0xe0,
-  0x8b, 0x7e, 0xe0, 0x8b, 0x5e, 0xe0, 0x8b, 0x45, 0x02, 0x8b, 0x1f, 0x85,
-  0xc0, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x61, 0x8e, 0xc0, 0x26, 0x8b, 0x4f,
-  0x02, 0x26, 0x8b, 0x07, 0x85, 0xc9, 0x75, 0x0d, 0x3d, 0x01, 0x00, 0x75,
-  0x08, 0xb8, 0x01, 0x00, 0xeb, 0x1b, 0xe9, 0x52, 0x04, 0x89, 0xc7, 0x8e,
-  0xc1, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x89,
-  0xc8, 0x83, 0xf9, 0x4e, 0x76, 0x03, 0xb8, 0x4e, 0x00, 0x05, 0x02, 0x00,
-  0x3b, 0x46, 0xf2, 0x76, 0x03, 0x89, 0x46, 0xf2, 0x3b, 0x56, 0xe6, 0x76,
-  0x15, 0x8b, 0x5e, 0xe6, 0x8a, 0x46, 0xf6, 0x83, 0xc3, 0x02, 0x30, 0xe4,
-  0x01, 0xd8, 0x3d, 0x19, 0x00, 0x77, 0x03, 0x89, 0x56, 0xe6, 0x83, 0x46,
-  0xe0, 0x04, 0xff, 0x46, 0xdc, 0x42, 0xeb, 0x8c, 0x8b, 0x46, 0xdc, 0x89,
-  0x46, 0xf0, 0x8b, 0x46, 0xf2, 0xf7, 0x66, 0xe6, 0xd1, 0xe0, 0x0e, 0xe8,
-  0x34, 0x5f, 0x90, 0x89, 0xc3, 0x89, 0xd1, 0x89, 0x46, 0xda, 0x89, 0x56,
-  0xde, 0x8a, 0x46, 0xf6, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x30, 0xe4, 0x88,
-  0x56, 0xca, 0x88, 0x66, 0xcb, 0xf7, 0x6e, 0xca, 0x8b, 0x7e, 0xc2, 0x36,
-  0x8b, 0x16, 0x98, 0x0e, 0xd1, 0xe0, 0x36, 0x8e, 0x1e, 0x9a, 0x0e, 0x8e,
-  0x46, 0xc0, 0x01, 0xc2, 0x26, 0x8a, 0x45, 0x06, 0x30, 0xe4, 0xd1, 0xe0,
-  0x01, 0xc2, 0x8c, 0x5e, 0xea, 0x89, 0x56, 0xce, 0x85, 0xc9, 0x75, 0x07,
-  0x85, 0xdb, 0x75, 0x03, 0xe9, 0xac, 0x03, 0xc7, 0x46, 0xe2, 0x00, 0x00,
-  0x83, 0x7e, 0xe6, 0x00, 0x76, 0x54, 0x8e, 0x46, 0xde, 0x8e, 0x5e, 0xea,
-  0x8b, 0x46, 0xf2, 0xf7, 0x66, 0xe2, 0x89, 0xc1, 0x36, 0xa0, 0xa3, 0x0e,
-  0x30, 0xe4, 0xf7, 0x66, 0xe2, 0x89, 0x46, 0xee, 0x31, 0xc0, 0x83, 0x7e,
-  0xf2, 0x00, 0x76, 0x27, 0x8b, 0x5e, 0xda, 0x8b, 0x7e, 0xee, 0x89, 0xca,
-  0xd1, 0xe7, 0xd1, 0xe2, 0x03, 0x7e, 0xce, 0x01, 0xd3, 0xff, 0x46, 0xee,
-  0x40, 0x83, 0xc3, 0x02, 0x41, 0x8b, 0x15, 0x83, 0xc7, 0x02, 0x26, 0x89,
-  0x57, 0xfe, 0x3b, 0x46, 0xf2, 0x72, 0xea, 0xff, 0x46, 0xe2, 0x8b, 0x46,
-  0xe2, 0x3b, 0x46, 0xe6, 0x72, 0xb2, 0x8b, 0x46, 0xe6, 0x36, 0x8b, 0x3e,
-  0x46, 0x0a, 0x31, 0xc9, 0x48, 0x81, 0xcf, 0xba, 0x00, 0x89, 0x46, 0xd8,
-  0x85, 0xc0, 0x76, 0x27, 0x8e, 0x5e, 0xea, 0x36, 0xa0, 0xa3, 0x0e, 0x30,
-  0xe4, 0xf7, 0xe1, 0x89, 0xc3, 0xd1, 0xe3, 0x03, 0x5e, 0xce, 0x89, 0x3f,
-  0x89, 0xc3, 0x03, 0x5e, 0xf2, 0xd1, 0xe3, 0x03, 0x5e, 0xce, 0x41, 0x89,
-  0x7f, 0xfe, 0x3b, 0x4e, 0xd8, 0x72, 0xdc, 0x36, 0xa0, 0xa3, 0x0e, 0x30,
-  0xe4, 0xf7, 0x66, 0xd8, 0x89, 0x46, 0xd2, 0x8b, 0x5e, 0xce, 0x8b, 0x56,
-  0xd2, 0x36, 0xa1, 0x46, 0x0a, 0x8e, 0x5e, 0xea, 0x0c, 0xc8, 0xd1, 0xe2,
-  0x36, 0x8b, 0x0e, 0x46, 0x0a, 0x89, 0x56, 0xca, 0x01, 0xd3, 0x8b, 0x56,
-  0xf2, 0x80, 0xc9, 0xcd, 0x89, 0x07, 0x8b, 0x5e, 0xce, 0xb8, 0x01, 0x00,
-  0x83, 0xc3, 0x02, 0x29, 0xc2, 0x03, 0x5e, 0xca, 0x39, 0xc2, 0x76, 0x0b,
-  0x83, 0xc3, 0x02, 0x40, 0x89, 0x4f, 0xfe, 0x39, 0xd0, 0x72, 0xf5, 0x8b,
-  0x5e, 0xd2, 0x36, 0xa1, 0x46, 0x0a, 0x03, 0x5e, 0xf2, 0x8e, 0x5e, 0xea,
-  0xd1, 0xe3, 0x0c, 0xbc, 0x03, 0x5e, 0xce, 0x31, 0xff, 0x89, 0x47, 0xfe,
-  0x83, 0x7e, 0xf0, 0x00, 0x76, 0x3f, 0x8b, 0x46, 0xf2, 0x2d, 0x02, 0x00,
-  0x89, 0x46, 0xc8, 0x39, 0xf7, 0x75, 0x06, 0x36, 0xa1, 0x44, 0x0a, 0xeb,
-  0x04, 0x36, 0xa1, 0x48, 0x0a, 0x50, 0x75, 0x06, 0x36, 0xa1, 0x42, 0x0a,
-  0xeb, 0x04, 0x36, 0xa1, 0x46, 0x0a, 0x8b, 0x5e, 0xc4, 0x8b, 0x4e, 0xcc,
-  0x50, 0x8b, 0x56, 0xea, 0xff, 0x76, 0xc8, 0x8b, 0x46, 0xce, 0x57, 0x47,
-  0x0e, 0xe8, 0x52, 0xfc, 0x3b, 0x7e, 0xf0, 0x72, 0xca, 0x8b, 0x46, 0xf2,
-  0x2d, 0x02, 0x00, 0x89, 0x46, 0xe8, 0x8b, 0x46, 0xf0, 0x48, 0x89, 0x46,
-  0xd0, 0x80, 0x7e, 0xf8, 0x00, 0x75, 0x03, 0xe9, 0xe9, 0x01, 0xb8, 0x40,
-  0x00, 0xbb, 0x17, 0x00, 0x8e, 0xd8, 0x8a, 0x17, 0x80, 0xe2, 0x08, 0x30,
-  0xf6, 0x36, 0xff, 0x1e, 0xc8, 0x0e, 0x89, 0xd3, 0x83, 0x7e, 0xc6, 0x00,
-  0x74, 0x0d, 0x85, 0xd2, 0x75, 0x09, 0xff, 0x46, 0xf4, 0x83, 0x7e, 0xf4,
-  0x02, 0x73, 0xd4, 0x0e, 0x3e, 0xe8, 0x54, 0x64, 0x89, 0x5e, 0xc6, 0x85,
-  0xc0, 0x74, 0xc2, 0x0e, 0x3e, 0xe8, 0x89, 0x54, 0x89, 0x46, 0xec, 0x85,
-  0xc0, 0x75, 0x0c, 0x0e, 0x3e, 0xe8, 0x7d, 0x54, 0xc6, 0x46, 0xec, 0x00,
-  0x88, 0x46, 0xed, 0x8b, 0x46, 0xec, 0x3d, 0x1b, 0x00, 0x74, 0xa8, 0x3d,
-  0x0d, 0x00, 0x74, 0x67, 0x3d, 0x00, 0x48, 0x75, 0x65, 0x36, 0xff, 0x36,
-  0x48, 0x0a, 0x8b, 0x5e, 0xc4, 0x36, 0xff, 0x36, 0x46, 0x0a, 0x8b, 0x4e,
-  0xcc, 0xff, 0x76, 0xe8, 0x8b, 0x46, 0xce, 0x56, 0x8b, 0x56, 0xea, 0x0e,
-  0xe8, 0xb7, 0xfb, 0x85, 0xf6, 0x75, 0x05, 0x8b, 0x76, 0xd0, 0xeb, 0x01,
-  0x4e, 0x89, 0xf3, 0xd1, 0xe3, 0xd1, 0xe3, 0x8e, 0x5e, 0xcc, 0x03, 0x5e,
-  0xc4, 0x8b, 0x07, 0x8b, 0x57, 0x02, 0x0e, 0xe8, 0xca, 0xf9, 0x85, 0xc0,
-  0x75, 0xdd, 0x36, 0xff, 0x36, 0x44, 0x0a, 0x8b, 0x5e, 0xc4, 0x36, 0xff,
-  0x36, 0x42, 0x0a, 0x8b, 0x4e, 0xcc, 0xff, 0x76, 0xe8, 0x8b, 0x46, 0xce,
-  0x56, 0x8b, 0x56, 0xea, 0x0e, 0xe8, 0x76, 0xfb, 0xe9, 0x36, 0xff, 0xe9,
-  0x0e, 0x01, 0x3d, 0x00, 0x50, 0x75, 0x60, 0x36, 0xff, 0x36, 0x48, 0x0a,
-  0x8b, 0x5e, 0xc4, 0x36, 0xff, 0x36, 0x46, 0x0a, 0x8b, 0x4e, 0xcc, 0xff,
-  0x76, 0xe8, 0x8b, 0x46, 0xce, 0x56, 0x8b, 0x56, 0xea, 0x0e, 0xe8, 0x4d,
-  0xfb, 0x46, 0x3b, 0x76, 0xf0, 0x72, 0x02, 0x31, 0xf6, 0x89, 0xf3, 0xd1,
-  0xe3, 0xd1, 0xe3, 0x8e, 0x5e, 0xcc, 0x03, 0x5e, 0xc4, 0x8b, 0x07, 0x8b,
-  0x57, 0x02, 0x0e, 0xe8, 0x62, 0xf9, 0x85, 0xc0, 0x75, 0xdf, 0x36, 0xff,
-  0x36, 0x44, 0x0a, 0x8b, 0x5e, 0xc4, 0x36, 0xff, 0x36, 0x42, 0x0a, 0x8b,
-  0x4e, 0xcc, 0xff, 0x76, 0xe8, 0x8b, 0x46, 0xce, 0x56, 0x8b, 0x56, 0xea,
-  0x0e, 0xe8, 0x0e, 0xfb, 0xe9, 0xce, 0xfe, 0x3d, 0x00, 0x4b, 0x74, 0x05,
-  0x3d, 0x00, 0x4d, 0x75, 0x10, 0xc5, 0x5e, 0x06, 0x8b, 0x46, 0xec, 0x89,
-  0x07, 0x31, 0xc0, 0x89, 0x46, 0xd4, 0xe9, 0xa3, 0x00, 0x3d, 0x20, 0x00,
-  0x77, 0x03, 0xe9, 0xac, 0xfe, 0x3d, 0x7f, 0x00, 0x73, 0xf8, 0x8b, 0x7e,
-  0xf0, 0x8b, 0x5e, 0xc4, 0x36, 0xff, 0x36, 0x48, 0x0a, 0x8b, 0x4e, 0xcc,
-  0x36, 0xff, 0x36, 0x46, 0x0a, 0x8b, 0x46, 0xce, 0xff, 0x76, 0xe8, 0x8b,
-  0x56, 0xea, 0x56, 0x46, 0x0e, 0xe8, 0xc2, 0xfa, 0x39, 0xfe, 0x72, 0x02,
-  0x31, 0xf6, 0x89, 0xf3, 0xd1, 0xe3, 0xd1, 0xe3, 0x8e, 0x5e, 0xcc, 0x03,
-  0x5e, 0xc4, 0xc5, 0x07, 0x89, 0xc3, 0x8a, 0x47, 0x04, 0x30, 0xe4, 0x0e,
-  0x3e, 0xe8, 0xe2, 0x62, 0x89, 0xc2, 0x8b, 0x46, 0xec, 0x0e, 0x3e, 0xe8,
-  0xd8, 0x62, 0x39, 0xc2, 0x74, 0x0d, 0x4f, 0x75, 0x04, 0x31, 0xf6, 0xeb,
-  0x06, 0x46, 0x3b, 0x76, 0xf0, 0xeb, 0xc7, 0x36, 0xff, 0x36, 0x44, 0x0a,
-  0x8b, 0x5e, 0xc4, 0x36, 0xff, 0x36, 0x42, 0x0a, 0x8b, 0x4e, 0xcc, 0xff,
-  0x76, 0xe8, 0x8b, 0x46, 0xce, 0x56, 0x8b, 0x56, 0xea, 0x0e, 0xe8, 0x69,
-  0xfa, 0x85, 0xff, 0x7f, 0x03, 0xe9, 0x25, 0xfe, 0x89, 0xf3, 0xd1, 0xe3,
-  0xd1, 0xe3, 0x8e, 0x5e, 0xcc, 0x03, 0x5e, 0xc4, 0x8b, 0x07, 0x89, 0x46,
-  0xd4, 0x8b, 0x47, 0x02, 0x89, 0x46, 0xd6, 0xc7, 0x46, 0xe4, 0x00, 0x00,
-  0x83, 0x7e, 0xe6, 0x00, 0x76, 0x4e, 0x8e, 0x46, 0xea, 0x8e, 0x5e, 0xde,
-  0x8b, 0x46, 0xf2, 0xf7, 0x66, 0xe4, 0x89, 0xc7, 0x36, 0xa0, 0xa3, 0x0e,
-  0x30, 0xe4, 0xf7, 0x66, 0xe4, 0x89, 0xc2, 0x31, 0xc0, 0x83, 0x7e, 0xf2,
-  0x00, 0x76, 0x22, 0x89, 0xd3, 0x89, 0xfe, 0xd1, 0xe3, 0xd1, 0xe6, 0x03,
-  0x5e, 0xce, 0x03, 0x76, 0xda, 0x40, 0x83, 0xc3, 0x02, 0x42, 0x8b, 0x0c,
-  0x83, 0xc6, 0x02, 0x47, 0x26, 0x89, 0x4f, 0xfe, 0x3b, 0x46, 0xf2, 0x72,
-  0xec, 0xff, 0x46, 0xe4, 0x8b, 0x46, 0xe4, 0x3b, 0x46, 0xe6, 0x72, 0xb8,
-  0x8b, 0x46, 0xda, 0x8b, 0x56, 0xde, 0x0e, 0xe8, 0xf6, 0x5a, 0x90, 0x8b,
-  0x46, 0xd4, 0x8b, 0x56, 0xd6, 0x8d, 0x66, 0xfa, 0x5f, 0x5e, 0x59, 0x5d,
-  0x4d, 0xca, 0x04, 0x00, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57,
-  0x83, 0xec, 0x08, 0x36, 0x8b, 0x16, 0xbe, 0x0e, 0x36, 0xa1, 0xc0, 0x0e,
-  0x31, 0xf6, 0x31, 0xff, 0x89, 0x76, 0xf4, 0x89, 0x76, 0xf6, 0x89, 0x76,
-  0xf2, 0x85, 0xc0, 0x75, 0x0b, 0x85, 0xd2, 0x75, 0x07, 0x31, 0xc0, 0x31,
-  0xd2, 0xe9, 0x66, 0x02, 0xb8, 0x40, 0x00, 0xbb, 0x17, 0x00, 0x8e, 0xd8,
-  0x8a, 0x07, 0xa8, 0x08, 0x74, 0x5f, 0x36, 0x89, 0x36, 0xc2, 0x0e, 0x0e,
-  0xe8, 0xdd, 0xf7, 0x36, 0xff, 0x1e, 0xc8, 0x0e, 0x0e, 0xe8, 0xd4, 0x61,
-  0x90, 0x85, 0xc0, 0x74, 0x69, 0x0e, 0x3e, 0xe8, 0x0b, 0x52, 0x85, 0xc0,
-  0x75, 0x60, 0x0e, 0xe8, 0x03, 0x52, 0x90, 0x89, 0xc1, 0x31, 0xd2, 0x3d,
-  0x9b, 0x00, 0x75, 0x55, 0x36, 0xff, 0x0e, 0xc2, 0x0e, 0x36, 0x83, 0x3e,
-  0xc2, 0x0e, 0x00, 0x7d, 0x2c, 0x31, 0xc0, 0x36, 0xa3, 0xc2, 0x0e, 0x36,
-  0xc5, 0x36, 0xbe, 0x0e, 0x01, 0xc6, 0x8b, 0x54, 0x02, 0x8b, 0x1c, 0x85,
-  0xd2, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x0d, 0x36, 0xff, 0x06, 0xc2, 0x0e,
-  0x05, 0x0c, 0x00, 0xeb, 0xe2, 0xe9, 0xf0, 0x01, 0x36, 0xff, 0x0e, 0xc2,
-  0x0e, 0xba, 0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea, 0x36, 0x8b,
-  0x36, 0xbe, 0x0e, 0x36, 0x8b, 0x3e, 0xc0, 0x0e, 0x01, 0xc6, 0x0e, 0xe8,
-  0x66, 0xf7, 0xe9, 0xbe, 0x00, 0x3d, 0x9d, 0x00, 0x75, 0x44, 0x36, 0xff,
-  0x06, 0xc2, 0x0e, 0xba, 0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea,
-  0x36, 0xc5, 0x1e, 0xbe, 0x0e, 0x01, 0xc3, 0x8b, 0x47, 0x02, 0x8b, 0x17,
-  0x85, 0xc0, 0x75, 0x0a, 0x85, 0xd2, 0x75, 0x06, 0x31, 0xc0, 0x36, 0xa3,
-  0xc2, 0x0e, 0xba, 0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea, 0x36,
-  0x8b, 0x36, 0xbe, 0x0e, 0x36, 0x8b, 0x3e, 0xc0, 0x0e, 0x01, 0xc6, 0x0e,
-  0xe8, 0x1d, 0xf7, 0xe9, 0x75, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0x36, 0x8b,
-  0x3e, 0xc0, 0x0e, 0x36, 0x8b, 0x36, 0xbe, 0x0e, 0x8e, 0xdf, 0x89, 0x46,
-  0xf0, 0x8b, 0x5c, 0x02, 0x8b, 0x04, 0x85, 0xdb, 0x75, 0x04, 0x85, 0xc0,
-  0x74, 0x1e, 0x8e, 0xdf, 0x8a, 0x44, 0x05, 0x30, 0xe4, 0x39, 0xc1, 0x74,
-  0x13, 0x83, 0xc6, 0x0c, 0x8e, 0xdf, 0x42, 0x8b, 0x5c, 0x02, 0x8b, 0x04,
-  0x85, 0xdb, 0x75, 0xe6, 0x85, 0xc0, 0x75, 0xe2, 0x8e, 0xdf, 0x8b, 0x5c,
-  0x02, 0x8b, 0x04, 0x85, 0xdb, 0x75, 0x11, 0x85, 0xc0, 0x75, 0x0d, 0x36,
-  0xc7, 0x06, 0xc2, 0x0e, 0xff, 0xff, 0x31, 0xf6, 0x31, 0xff, 0xeb, 0x05,
-  0x36, 0x89, 0x16, 0xc2, 0x0e, 0x8b, 0x46, 0xf0, 0x36, 0x3b, 0x06, 0xc2,
-  0x0e, 0x74, 0x04, 0x0e, 0xe8, 0xad, 0xf6, 0x85, 0xff, 0x75, 0x15, 0x85,
-  0xf6, 0x75, 0x11, 0xb8, 0x40, 0x00, 0xbb, 0x17, 0x00, 0x8e, 0xd8, 0x8a,
-  0x07, 0xa8, 0x08, 0x74, 0x03, 0xe9, 0xb7, 0xfe, 0xb8, 0x40, 0x00, 0xbb,
-  0x17, 0x00, 0x8e, 0xd8, 0x8a, 0x07, 0xa8, 0x08, 0x75, 0x10, 0x0e, 0xe8,
-  0x82, 0x60, 0x90, 0x85, 0xc0, 0x74, 0x07, 0x0e, 0x3e, 0xe8, 0xb9, 0x50,
-  0xeb, 0xf0, 0x85, 0xff, 0x75, 0x04, 0x85, 0xf6, 0x74, 0x5d, 0x8d, 0x56,
-  0xf2, 0x36, 0x8a, 0x1e, 0xc4, 0x0e, 0x16, 0x89, 0xf0, 0x52, 0xfe, 0xc3,
-  0x89, 0xfa, 0x30, 0xff, 0x0e, 0xe8, 0x22, 0xf9, 0x89, 0x46, 0xf4, 0x89,
-  0x56, 0xf6, 0x85, 0xd2, 0x75, 0x3d, 0x85, 0xc0, 0x75, 0x39, 0x8b, 0x46,
-  0xf2, 0x3d, 0x00, 0x4b, 0x75, 0x50, 0x36, 0xff, 0x0e, 0xc2, 0x0e, 0x36,
-  0x83, 0x3e, 0xc2, 0x0e, 0x00, 0x7d, 0x2b, 0x31, 0xc0, 0x36, 0xa3, 0xc2,
-  0x0e, 0x36, 0xc5, 0x36, 0xbe, 0x0e, 0x01, 0xc6, 0x8b, 0x54, 0x02, 0x8b,
-  0x1c, 0x85, 0xd2, 0x75, 0x04, 0x85, 0xdb, 0x74, 0x0c, 0x36, 0xff, 0x06,
-  0xc2, 0x0e, 0x05, 0x0c, 0x00, 0xeb, 0xe2, 0xeb, 0x62, 0x36, 0xff, 0x0e,
-  0xc2, 0x0e, 0xba, 0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea, 0x36,
-  0x8b, 0x36, 0xbe, 0x0e, 0x36, 0x8b, 0x3e, 0xc0, 0x0e, 0x01, 0xc6, 0xe9,
-  0x11, 0xfe, 0x3d, 0x00, 0x4d, 0x75, 0x40, 0x36, 0xff, 0x06, 0xc2, 0x0e,
-  0xba, 0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea, 0x36, 0xc5, 0x1e,
-  0xbe, 0x0e, 0x01, 0xc3, 0x8b, 0x47, 0x02, 0x8b, 0x17, 0x85, 0xc0, 0x75,
-  0x0a, 0x85, 0xd2, 0x75, 0x06, 0x31, 0xc0, 0x36, 0xa3, 0xc2, 0x0e, 0xba,
-  0x0c, 0x00, 0x36, 0xa1, 0xc2, 0x0e, 0xf7, 0xea, 0x36, 0x8b, 0x36, 0xbe,
-  0x0e, 0x36, 0x8b, 0x3e, 0xc0, 0x0e, 0x01, 0xc6, 0xe9, 0xcc, 0xfd, 0xbb,
-  0x17, 0x00, 0xb8, 0x40, 0x00, 0x8e, 0xd8, 0x8a, 0x07, 0xa8, 0x08, 0x75,
-  0xf5, 0x36, 0xc7, 0x06, 0xc2, 0x0e, 0xff, 0xff, 0x0e, 0xe8, 0x94, 0xf5,
-  0x8b, 0x46, 0xf4, 0x8b, 0x56, 0xf6, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0x4d, 0xcb, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec,
-  0x28, 0x89, 0xc6, 0x89, 0x56, 0xfa, 0x89, 0x5e, 0xd8, 0x89, 0x4e, 0xda,
-  0x8b, 0x46, 0x06, 0x8b, 0x56, 0x08, 0x89, 0x56, 0xf4, 0x3d, 0x01, 0x00,
-  0x73, 0x03, 0xb8, 0x01, 0x00, 0xc5, 0x5e, 0xd8, 0x89, 0x46, 0xe8, 0x89,
-  0xdf, 0x31, 0xc0, 0x80, 0x3d, 0x00, 0x74, 0x20, 0x80, 0x3f, 0x0a, 0x75,
-  0x07, 0xff, 0x46, 0xe8, 0x31, 0xc0, 0xeb, 0x0e, 0x80, 0x3f, 0x20, 0x72,
-  0x09, 0x40, 0x3b, 0x46, 0xf4, 0x76, 0x03, 0x89, 0x46, 0xf4, 0x43, 0x80,
-  0x3f, 0x00, 0x75, 0xe0, 0x83, 0x46, 0xf4, 0x04, 0x83, 0x7e, 0xf4, 0x50,
-  0x76, 0x05, 0xc7, 0x46, 0xf4, 0x50, 0x00, 0x83, 0x46, 0xe8, 0x02, 0x83,
-  0x7e, 0xe8, 0x19, 0x76, 0x05, 0xc7, 0x46, 0xe8, 0x19, 0x00, 0x36, 0xa0,
-  0xa4, 0x0e, 0x30, 0xe4, 0x89, 0xc3, 0x2b, 0x5e, 0xe8, 0x36, 0x8a, 0x16,
-  0xa3, 0x0e, 0xd1, 0xeb, 0x30, 0xf6, 0x89, 0xd8, 0x89, 0xd1, 0xf7, 0xe2,
-  0x2b, 0x4e, 0xf4, 0x89, 0xc2, 0x36, 0xa1, 0x98, 0x0e, 0xd1, 0xe2, 0xd1,
-  0xe9, 0x01, 0xc2, 0x89, 0xc8, 0x36, 0x8b, 0x3e, 0x9a, 0x0e, 0xd1, 0xe0,
-  0x8e, 0x5e, 0xfa, 0x01, 0xc2, 0x8b, 0x46, 0xf4, 0x89, 0x44, 0x08, 0x8b,
-  0x46, 0xe8, 0x89, 0x44, 0x0a, 0x8b, 0x46, 0xf4, 0x89, 0x14, 0xf7, 0x66,
-  0xe8, 0x89, 0x7c, 0x02, 0x89, 0x4c, 0x0c, 0xd1, 0xe0, 0x89, 0x5c, 0x0e,
-  0x0e, 0xe8, 0xbe, 0x57, 0x90, 0x8e, 0x5e, 0xfa, 0x89, 0x44, 0x04, 0x89,
-  0x54, 0x06, 0x8b, 0x44, 0x06, 0x8b, 0x54, 0x04, 0x85, 0xc0, 0x75, 0x04,
-  0x85, 0xd2, 0x74, 0x6b, 0xc7, 0x46, 0xea, 0x00, 0x00, 0x83, 0x7e, 0xe8,
-  0x00, 0x76, 0x60, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x8b, 0x46, 0xea, 0x30,
-  0xf6, 0xf7, 0xe2, 0x89, 0x46, 0xf6, 0x8b, 0x46, 0xea, 0xf7, 0x66, 0xf4,
-  0x89, 0x46, 0xf8, 0x31, 0xd2, 0x83, 0x7e, 0xf4, 0x00, 0x76, 0x35, 0x89,
-  0xc3, 0x8b, 0x46, 0xf6, 0xd1, 0xe3, 0xd1, 0xe0, 0x8e, 0x5e, 0xfa, 0xff,
-  0x46, 0xf6, 0xff, 0x46, 0xf8, 0x42, 0xc4, 0x3c, 0x01, 0xc7, 0x8b, 0x4c,
-  0x04, 0x05, 0x02, 0x00, 0x01, 0xd9, 0x8e, 0x5c, 0x06, 0x89, 0x4e, 0xd4,
-  0x26, 0x8b, 0x0d, 0x8b, 0x7e, 0xd4, 0x83, 0xc3, 0x02, 0x89, 0x0d, 0x3b,
-  0x56, 0xf4, 0x72, 0xd4, 0xff, 0x46, 0xea, 0x8b, 0x46, 0xea, 0x3b, 0x46,
-  0xe8, 0x72, 0xa0, 0x36, 0xa1, 0x4a, 0x0a, 0x0c, 0x20, 0xbb, 0x01, 0x00,
-  0x89, 0x46, 0xe4, 0x8b, 0x46, 0xe8, 0x36, 0x8b, 0x0e, 0x4a, 0x0a, 0x29,
-  0xd8, 0x80, 0xc9, 0xba, 0x89, 0x46, 0xe2, 0x39, 0xd8, 0x76, 0x47, 0x36,
-  0x8a, 0x16, 0xa3, 0x0e, 0x89, 0xd8, 0x30, 0xf6, 0xf7, 0xe2, 0x8e, 0x5e,
-  0xfa, 0x89, 0xc2, 0x8b, 0x3c, 0xd1, 0xe2, 0x8e, 0x5c, 0x02, 0x01, 0xd7,
-  0x89, 0x0d, 0x8e, 0x5e, 0xfa, 0xc5, 0x3c, 0x01, 0xd7, 0x8b, 0x56, 0xe4,
-  0x03, 0x46, 0xf4, 0x89, 0x55, 0x02, 0x8e, 0x5e, 0xfa, 0xd1, 0xe0, 0xc5,
-  0x3c, 0x01, 0xc7, 0x89, 0x55, 0xfc, 0x8e, 0x5e, 0xfa, 0xc5, 0x3c, 0x01,
-  0xc7, 0x43, 0x89, 0x4d, 0xfe, 0x3b, 0x5e, 0xe2, 0x72, 0xb9, 0x36, 0x8a,
-  0x16, 0xa3, 0x0e, 0x8b, 0x46, 0xe2, 0x30, 0xf6, 0xf7, 0xe2, 0x89, 0x46,
-  0xd6, 0x36, 0xa1, 0x4a, 0x0a, 0x0c, 0xcd, 0xbb, 0x01, 0x00, 0x89, 0x46,
-  0xe6, 0x8b, 0x46, 0xf4, 0x29, 0xd8, 0x89, 0x46, 0xe0, 0x8b, 0x46, 0xd6,
-  0xd1, 0xe0, 0xba, 0x02, 0x00, 0x05, 0x02, 0x00, 0x3b, 0x5e, 0xe0, 0x73,
-  0x21, 0x8b, 0x4e, 0xe6, 0x8e, 0x5e, 0xfa, 0xc5, 0x3c, 0x01, 0xd7, 0x43,
-  0x89, 0x0d, 0x8e, 0x5e, 0xfa, 0x83, 0xc2, 0x02, 0xc5, 0x3c, 0x01, 0xc7,
-  0x05, 0x02, 0x00, 0x89, 0x0d, 0x3b, 0x5e, 0xe0, 0x72, 0xe2, 0x36, 0xa1,
-  0x4a, 0x0a, 0x8e, 0x5e, 0xfa, 0x0c, 0xc9, 0xc5, 0x1c, 0x36, 0x8b, 0x16,
-  0x4a, 0x0a, 0x89, 0x07, 0x8b, 0x5e, 0xf4, 0x8e, 0x5e, 0xfa, 0x80, 0xca,
-  0xbb, 0xd1, 0xe3, 0xc5, 0x04, 0x01, 0xc3, 0x36, 0xa1, 0x4a, 0x0a, 0x89,
-  0x57, 0xfe, 0x8b, 0x56, 0xd6, 0x8e, 0x5e, 0xfa, 0x0c, 0xc8, 0xd1, 0xe2,
-  0xc5, 0x1c, 0x01, 0xd3, 0x36, 0x8b, 0x16, 0x4a, 0x0a, 0x89, 0x07, 0x8b,
-  0x46, 0xd6, 0x8e, 0x5e, 0xfa, 0x80, 0xca, 0xbc, 0x03, 0x46, 0xf4, 0x8b,
-  0x1c, 0xd1, 0xe0, 0x8e, 0x5c, 0x02, 0x01, 0xc3, 0x31, 0xc0, 0x89, 0x57,
-  0xfe, 0x8b, 0x5e, 0xd8, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x89, 0x46, 0xec,
-  0x8e, 0x46, 0xda, 0x30, 0xf6, 0x8e, 0x5e, 0xda, 0x83, 0xc2, 0x02, 0x89,
-  0x5e, 0xee, 0x89, 0x56, 0xd6, 0x80, 0x3f, 0x00, 0x74, 0x5d, 0x36, 0x8b,
-  0x16, 0x4a, 0x0a, 0x80, 0xca, 0x20, 0x89, 0x56, 0xf2, 0x8b, 0x56, 0xe8,
-  0x8b, 0x7e, 0xf4, 0x83, 0xea, 0x02, 0x83, 0xef, 0x04, 0x89, 0x56, 0xdc,
-  0x8b, 0x5e, 0xee, 0x26, 0x80, 0x3f, 0x0a, 0x75, 0x3c, 0x89, 0xc2, 0x8b,
-  0x5e, 0xd6, 0xd1, 0xe2, 0xd1, 0xe3, 0x8b, 0x4e, 0xf2, 0x01, 0xda, 0x39,
-  0xf8, 0x73, 0x0f, 0x8e, 0x5e, 0xfa, 0x40, 0xc5, 0x1c, 0x01, 0xd3, 0x83,
-  0xc2, 0x02, 0x89, 0x0f, 0xeb, 0xed, 0xff, 0x46, 0xec, 0x8b, 0x56, 0xec,
-  0x3b, 0x56, 0xdc, 0x73, 0x4f, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0x30, 0xf6,
-  0x31, 0xc0, 0x01, 0x56, 0xd6, 0xeb, 0x32, 0xeb, 0x3f, 0x26, 0x80, 0x3f,
-  0x20, 0x72, 0x2a, 0x39, 0xf8, 0x73, 0x25, 0x26, 0x8a, 0x17, 0x36, 0x8b,
-  0x1e, 0x4a, 0x0a, 0x30, 0xf6, 0x09, 0xd3, 0x89, 0x5e, 0xd4, 0x8b, 0x5e,
-  0xd6, 0x8e, 0x5e, 0xfa, 0x01, 0xc3, 0x8b, 0x0c, 0xd1, 0xe3, 0x8e, 0x5c,
-  0x02, 0x01, 0xcb, 0x8b, 0x56, 0xd4, 0x89, 0x17, 0x40, 0xff, 0x46, 0xee,
-  0x8b, 0x5e, 0xee, 0x26, 0x80, 0x3f, 0x00, 0x74, 0x03, 0xe9, 0x7c, 0xff,
-  0x8b, 0x56, 0xf4, 0x83, 0xea, 0x04, 0x89, 0x56, 0xf0, 0x8b, 0x56, 0xe8,
-  0x36, 0x8b, 0x3e, 0x4a, 0x0a, 0x83, 0xea, 0x02, 0x83, 0xcf, 0x20, 0x89,
-  0x56, 0xde, 0x8b, 0x56, 0xec, 0x3b, 0x56, 0xde, 0x73, 0x30, 0x89, 0xc2,
-  0x8b, 0x5e, 0xd6, 0xd1, 0xe2, 0xd1, 0xe3, 0x01, 0xda, 0x3b, 0x46, 0xf0,
-  0x73, 0x0f, 0x8e, 0x5e, 0xfa, 0x40, 0xc5, 0x1c, 0x01, 0xd3, 0x83, 0xc2,
-  0x02, 0x89, 0x3f, 0xeb, 0xec, 0x36, 0x8a, 0x16, 0xa3, 0x0e, 0xff, 0x46,
-  0xec, 0x30, 0xf6, 0x31, 0xc0, 0x01, 0x56, 0xd6, 0xeb, 0xc8, 0x8e, 0x5e,
-  0xfa, 0x8b, 0x46, 0xf4, 0x89, 0x44, 0x08, 0x8b, 0x46, 0xe8, 0x89, 0x44,
-  0x0a, 0xb8, 0x01, 0x00, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca,
-  0x04, 0x00, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x08, 0x89, 0xc3, 0x89, 0x56, 0xf6, 0x85, 0xd2, 0x75, 0x07, 0x85, 0xc0,
-  0x75, 0x03, 0xe9, 0xae, 0x00, 0x8e, 0xda, 0x8b, 0x57, 0x06, 0x8b, 0x47,
-  0x04, 0x85, 0xd2, 0x75, 0x07, 0x85, 0xc0, 0x75, 0x03, 0xe9, 0x8f, 0x00,
-  0xc7, 0x46, 0xf0, 0x00, 0x00, 0x83, 0x7f, 0x0a, 0x00, 0x76, 0x69, 0x8e,
-  0x5e, 0xf6, 0x8b, 0x46, 0xf0, 0xf7, 0x67, 0x08, 0x36, 0x8a, 0x16, 0xa3,
-  0x0e, 0x89, 0x46, 0xf4, 0x8b, 0x46, 0xf0, 0x30, 0xf6, 0xf7, 0xe2, 0x89,
-  0x46, 0xf2, 0x31, 0xc0, 0x83, 0x7f, 0x08, 0x00, 0x76, 0x38, 0x8b, 0x4e,
-  0xf2, 0x8b, 0x56, 0xf4, 0xd1, 0xe1, 0xd1, 0xe2, 0x8e, 0x5e, 0xf6, 0xff,
-  0x46, 0xf4, 0xff, 0x46, 0xf2, 0x40, 0xc5, 0x77, 0x04, 0x8e, 0x46, 0xf6,
-  0x01, 0xd6, 0x26, 0x8b, 0x3f, 0x83, 0xc2, 0x02, 0x26, 0x8e, 0x47, 0x02,
-  0x01, 0xcf, 0x8b, 0x34, 0x26, 0x89, 0x35, 0x8e, 0x5e, 0xf6, 0x83, 0xc1,
-  0x02, 0x3b, 0x47, 0x08, 0x72, 0xd2, 0xff, 0x46, 0xf0, 0x8e, 0x5e, 0xf6,
-  0x8b, 0x46, 0xf0, 0x3b, 0x47, 0x0a, 0x72, 0x97, 0x8e, 0x5e, 0xf6, 0x8b,
-  0x47, 0x04, 0x8b, 0x57, 0x06, 0x0e, 0x3e, 0xe8, 0x06, 0x54, 0x8e, 0x5e,
-  0xf6, 0xc7, 0x47, 0x04, 0x00, 0x00, 0xc7, 0x47, 0x06, 0x00, 0x00, 0x8e,
-  0x5e, 0xf6, 0xc7, 0x07, 0x00, 0x00, 0xc7, 0x47, 0x02, 0x00, 0x00, 0x8d,
-  0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55,
-  0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x12, 0x89, 0xc3, 0x8d,
-  0x7e, 0xe6, 0xc7, 0x46, 0xf6, 0x08, 0x00, 0x8c, 0xd0, 0x89, 0xd1, 0x8e,
-  0xc0, 0x8e, 0xd8, 0x8c, 0xd2, 0xb8, 0x12, 0x00, 0xbe, 0x2c, 0x0f, 0x50,
-  0xb8, 0x02, 0x00, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x50,
-  0x8d, 0x46, 0xe6, 0xbe, 0x01, 0x00, 0x0e, 0xe8, 0x62, 0xfb, 0x85, 0xc0,
-  0x75, 0x03, 0xe9, 0xd3, 0x00, 0x8b, 0x5e, 0xee, 0x83, 0xeb, 0x0e, 0x8a,
-  0x56, 0xf4, 0xd1, 0xeb, 0x02, 0x56, 0xf0, 0x03, 0x5e, 0xf2, 0x80, 0xea,
-  0x02, 0x88, 0xd8, 0x30, 0xf6, 0x30, 0xe4, 0x36, 0xc6, 0x06, 0xa2, 0x0e,
-  0x70, 0x0e, 0xe8, 0xff, 0xe0, 0xb8, 0x4b, 0x09, 0x8c, 0xd2, 0x0e, 0xe8,
-  0x8a, 0xe2, 0xb8, 0x4e, 0x09, 0x8c, 0xd2, 0x36, 0xc6, 0x06, 0xa2, 0x0e,
-  0x71, 0x0e, 0xe8, 0x7b, 0xe2, 0xb8, 0x50, 0x09, 0x8c, 0xd2, 0x36, 0xc6,
-  0x06, 0xa2, 0x0e, 0x70, 0x0e, 0xe8, 0x6c, 0xe2, 0x8a, 0x56, 0xf4, 0x8a,
-  0x46, 0xf6, 0x02, 0x56, 0xf0, 0x00, 0xd8, 0x80, 0xea, 0x02, 0x30, 0xe4,
-  0x30, 0xf6, 0x0e, 0xe8, 0xc2, 0xe0, 0xb8, 0x4b, 0x09, 0x8c, 0xd2, 0x0e,
-  0xe8, 0x4d, 0xe2, 0xb8, 0x55, 0x09, 0x8c, 0xd2, 0x36, 0xc6, 0x06, 0xa2,
-  0x0e, 0x71, 0x0e, 0xe8, 0x3e, 0xe2, 0xb8, 0x57, 0x09, 0x8c, 0xd2, 0x36,
-  0xc6, 0x06, 0xa2, 0x0e, 0x70, 0x0e, 0xe8, 0x2f, 0xe2, 0x36, 0xff, 0x1e,
-  0xc8, 0x0e, 0x0e, 0xe8, 0x4e, 0x5a, 0x90, 0x85, 0xc0, 0x74, 0xf2, 0x0e,
-  0x3e, 0xe8, 0x85, 0x4a, 0x89, 0xc2, 0x85, 0xc0, 0x75, 0x09, 0x0e, 0xe8,
-  0x7b, 0x4a, 0x90, 0x88, 0xc6, 0x30, 0xd2, 0x83, 0xfa, 0x59, 0x74, 0x05,
-  0x83, 0xfa, 0x79, 0x75, 0x05, 0xbe, 0x01, 0x00, 0xeb, 0x11, 0x83, 0xfa,
-  0x4e, 0x74, 0x0a, 0x83, 0xfa, 0x6e, 0x74, 0x05, 0x83, 0xfa, 0x1b, 0x75,
-  0xc0, 0x31, 0xf6, 0x8d, 0x46, 0xe6, 0x8c, 0xd2, 0x0e, 0xe8, 0x16, 0xfe,
-  0x89, 0xf0, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d, 0xcb,
-  0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x06, 0x89,
-  0xc7, 0x36, 0xa0, 0xa0, 0x0e, 0x88, 0x46, 0xf6, 0x36, 0xa0, 0xa1, 0x0e,
-  0x88, 0x46, 0xf4, 0x36, 0xa1, 0xaa, 0x0e, 0x36, 0x8b, 0x16, 0xa8, 0x0e,
-  0x85, 0xc0, 0x75, 0x24, 0x85, 0xd2, 0x75, 0x20, 0xb8, 0x00, 0x01, 0x0e,
-  0x3e, 0xe8, 0xd2, 0x52, 0x36, 0xa3, 0xa8, 0x0e, 0x36, 0x89, 0x16, 0xaa,
-  0x0e, 0x85, 0xd2, 0x75, 0x0b, 0x85, 0xc0, 0x75, 0x07, 0x31, 0xc9, 0x31,
-  0xd2, 0xe9, 0x29, 0x01, 0x81, 0xff, 0xff, 0x00, 0x76, 0x03, 0xbf, 0xff,
-  0x00, 0x8a, 0x56, 0xf4, 0x8a, 0x46, 0xf6, 0x36, 0x8b, 0x36, 0xa8, 0x0e,
-  0x31, 0xdb, 0x36, 0x8e, 0x1e, 0xaa, 0x0e, 0x00, 0xd8, 0x30, 0xf6, 0x30,
-  0xe4, 0xc6, 0x04, 0x00, 0x0e, 0xe8, 0xd0, 0xdf, 0x0e, 0xe8, 0x84, 0xe1,
-  0x0e, 0xe8, 0xa2, 0xd6, 0x0e, 0xe8, 0xc1, 0x49, 0x90, 0x89, 0xc1, 0x85,
-  0xc0, 0x75, 0x09, 0x0e, 0x3e, 0xe8, 0xb5, 0x49, 0x88, 0xc5, 0x30, 0xc9,
-  0x83, 0xf9, 0x08, 0x75, 0x2c, 0x85, 0xdb, 0x76, 0xe3, 0x8a, 0x46, 0xf6,
-  0x4b, 0x8a, 0x4e, 0xf4, 0x00, 0xd8, 0x30, 0xed, 0x88, 0x46, 0xf2, 0x88,
-  0x6e, 0xf3, 0x89, 0xca, 0x8b, 0x46, 0xf2, 0x0e, 0xe8, 0x91, 0xdf, 0xb8,
-  0x20, 0x00, 0x0e, 0xe8, 0x8c, 0xe0, 0x89, 0xca, 0x8b, 0x46, 0xf2, 0xeb,
-  0xaf, 0x83, 0xf9, 0x1b, 0x75, 0x37, 0x8a, 0x56, 0xf4, 0x8a, 0x46, 0xf6,
-  0x36, 0x8b, 0x36, 0xa8, 0x0e, 0x31, 0xdb, 0x31, 0xc9, 0x36, 0x8e, 0x1e,
-  0xaa, 0x0e, 0x00, 0xd8, 0x30, 0xf6, 0x30, 0xe4, 0xc6, 0x04, 0x00, 0x0e,
-  0xe8, 0x5d, 0xdf, 0x0e, 0xe8, 0x11, 0xe1, 0x0e, 0xe8, 0x2f, 0xd6, 0x31,
-  0xd2, 0x89, 0xc8, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0x83, 0xf9, 0x0d, 0x74, 0x49, 0x83, 0xf9, 0x20, 0x7d, 0x07, 0x85,
-  0xc9, 0x7c, 0x03, 0xe9, 0x6e, 0xff, 0x39, 0xfb, 0x73, 0xf9, 0x8a, 0x46,
-  0xf4, 0x88, 0x46, 0xf2, 0x8a, 0x46, 0xf6, 0xc6, 0x46, 0xf3, 0x00, 0x00,
-  0xd8, 0x8b, 0x56, 0xf2, 0x30, 0xe4, 0x0e, 0xe8, 0x1a, 0xdf, 0x88, 0xc8,
-  0x89, 0xde, 0x30, 0xe4, 0x43, 0x0e, 0xe8, 0x11, 0xe0, 0x8a, 0x46, 0xf6,
-  0x36, 0xc5, 0x16, 0xa8, 0x0e, 0x01, 0xd6, 0x00, 0xd8, 0x8b, 0x56, 0xf2,
-  0x30, 0xe4, 0x88, 0x0c, 0xe9, 0x25, 0xff, 0x8a, 0x56, 0xf4, 0x36, 0xc5,
-  0x06, 0xa8, 0x0e, 0x01, 0xc3, 0x8a, 0x46, 0xf6, 0x30, 0xf6, 0x30, 0xe4,
-  0xc6, 0x07, 0x00, 0x0e, 0xe8, 0xe1, 0xde, 0x0e, 0xe8, 0x95, 0xe0, 0x0e,
-  0xe8, 0xb3, 0xd5, 0x36, 0x8b, 0x0e, 0xa8, 0x0e, 0x36, 0x8b, 0x16, 0xaa,
-  0x0e, 0x89, 0xc8, 0x8d, 0x66, 0xf8, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x55, 0x89, 0xe5,
-  0x52, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0xa8, 0x03, 0x75, 0xf0, 0x36, 0xa2, 0x3d, 0x0f, 0x5a, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x52, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x3d, 0xff, 0x00, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x03, 0xb8, 0x01,
-  0x00, 0x5a, 0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51,
-  0x52, 0x83, 0xec, 0x16, 0xc6, 0x46, 0xf0, 0xad, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0x36, 0x80, 0x26, 0x3c, 0x0f, 0xfe, 0x31, 0xc9, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0x8a, 0x46, 0xf0, 0xba,
-  0x64, 0x00, 0xee, 0x0e, 0xe8, 0x89, 0xff, 0xc6, 0x46, 0xe4, 0x47, 0xc6,
-  0x46, 0xf4, 0x60, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46, 0xf4, 0xba, 0x64,
-  0x00, 0xee, 0x84, 0xe4, 0x74, 0x26, 0x8a, 0x46, 0xe4, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0x88, 0x46, 0xe8, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x0f, 0x02, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46, 0xe8, 0xba, 0x60,
-  0x00, 0xee, 0x84, 0xe4, 0x74, 0xea, 0xc6, 0x46, 0xf6, 0xa8, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02,
-  0x75, 0x07, 0x8a, 0x46, 0xf6, 0xba, 0x64, 0x00, 0xee, 0xc6, 0x46, 0xe6,
-  0xd3, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0x36, 0x80, 0x0e, 0x3c, 0x0f,
-  0x01, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0,
-  0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a,
-  0x46, 0xe6, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4, 0x74, 0x86, 0xc6, 0x46,
-  0xee, 0xaa, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46, 0xee, 0xba, 0x60, 0x00,
-  0xee, 0x84, 0xe4, 0x75, 0x03, 0xe9, 0x5e, 0x01, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75,
-  0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0xa6, 0xba,
-  0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xaa, 0x00, 0x75, 0x99,
-  0x36, 0xf6, 0x06, 0x3c, 0x0f, 0x01, 0x74, 0x91, 0x36, 0xf6, 0x06, 0x3d,
-  0x0f, 0x20, 0x74, 0x89, 0xc6, 0x46, 0xf8, 0xd3, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04,
-  0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07,
-  0x8a, 0x46, 0xf8, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4, 0x74, 0x24, 0xc6,
-  0x46, 0xea, 0x55, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9,
-  0x8c, 0x00, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46,
-  0xea, 0xba, 0x60, 0x00, 0xee, 0x84, 0xe4, 0x74, 0xea, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x22,
-  0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0x55, 0x00, 0x75,
-  0x15, 0x36, 0xf6, 0x06, 0x3c, 0x0f, 0x01, 0x74, 0x0d, 0x36, 0xf6, 0x06,
-  0x3d, 0x0f, 0x20, 0x74, 0x05, 0xb9, 0x01, 0x00, 0xeb, 0x04, 0x85, 0xc9,
-  0x74, 0x29, 0xc6, 0x46, 0xf2, 0xa8, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x0f, 0x8a, 0x46,
-  0xf2, 0xba, 0x64, 0x00, 0xee, 0xeb, 0x06, 0x36, 0x80, 0x26, 0x3c, 0x0f,
-  0xfe, 0xc6, 0x46, 0xec, 0xae, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0x8a, 0x46, 0xec,
-  0xba, 0x64, 0x00, 0xee, 0x89, 0xc8, 0x8d, 0x66, 0xfa, 0x5a, 0x59, 0x5b,
-  0x5d, 0x4d, 0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x83,
-  0xec, 0x10, 0x88, 0xc5, 0xc6, 0x46, 0xea, 0xe7, 0xb1, 0xd4, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02,
-  0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x06, 0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23,
-  0x8a, 0x4e, 0xea, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9,
-  0xd0, 0x08, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60,
-  0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75,
-  0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba,
-  0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87,
-  0xc6, 0x46, 0xf4, 0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01,
-  0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64,
-  0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf4, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4,
-  0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0xfc, 0x07, 0x30, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee,
-  0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a,
-  0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe8, 0xb1, 0x06,
-  0xc6, 0x46, 0xf6, 0xd4, 0xd3, 0xf8, 0xbb, 0xff, 0xff, 0x88, 0xc1, 0xba,
-  0x64, 0x00, 0x80, 0xe1, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4,
-  0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x07, 0x8a, 0x46, 0xf6, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4,
-  0x74, 0x20, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x21,
-  0x07, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00,
-  0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60,
-  0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xc6,
-  0x46, 0xf8, 0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb,
-  0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00,
-  0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf8, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02,
-  0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x4d, 0x06, 0x30, 0xc0, 0x88,
-  0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84,
-  0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75,
-  0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4,
-  0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe8, 0xb1, 0x04, 0xc6,
-  0x46, 0xf2, 0xd4, 0xd3, 0xf8, 0xbb, 0xff, 0xff, 0x88, 0xc1, 0xba, 0x64,
-  0x00, 0x80, 0xe1, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02,
-  0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x07, 0x8a, 0x46, 0xf2, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4, 0x74,
-  0x20, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x72, 0x05,
-  0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88,
-  0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00,
-  0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xc6, 0x46,
-  0xec, 0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02,
-  0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88,
-  0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xec, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75,
-  0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x9e, 0x04, 0x30, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4,
-  0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30,
-  0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe8, 0xd1, 0xf8, 0xc6, 0x46,
-  0xee, 0xd4, 0xd1, 0xf8, 0xbb, 0xff, 0xff, 0x88, 0xc1, 0xba, 0x64, 0x00,
-  0x80, 0xe1, 0x03, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75,
-  0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74,
-  0x07, 0x8a, 0x46, 0xee, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4, 0x74, 0x20,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0xc3, 0x03, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec,
-  0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xc6, 0x46, 0xf0,
-  0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf0, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07,
-  0xb0, 0x01, 0xeb, 0x05, 0xe9, 0xef, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74,
-  0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4,
-  0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe9, 0xbb, 0xff, 0xff, 0x80, 0xe1,
-  0x03, 0xba, 0x64, 0x00, 0xb5, 0xd4, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88, 0xe8, 0xee, 0x84, 0xe4,
-  0x74, 0x20, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x1d,
-  0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00,
-  0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60,
-  0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xb5,
-  0xf3, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xb1, 0xd4, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0x22, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0x88,
-  0xe9, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0,
-  0x01, 0xeb, 0x05, 0xe9, 0x4c, 0x01, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d,
-  0xfa, 0x00, 0x75, 0x87, 0xb5, 0x14, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xb1, 0xd4, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04,
-  0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06,
-  0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x22, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0x88, 0xe9, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x7b, 0x00, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x12, 0xba, 0x60, 0x00, 0xec,
-  0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x05, 0xb8, 0x01, 0x00,
-  0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x66, 0xfa, 0x5a, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x83, 0xec, 0x10,
-  0x88, 0xc5, 0xc6, 0x46, 0xea, 0xe7, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04,
-  0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06,
-  0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e,
-  0xea, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0xfb, 0x07,
-  0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88,
-  0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00,
-  0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xc6, 0x46,
-  0xf6, 0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02,
-  0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88,
-  0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf6, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75,
-  0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x27, 0x07, 0x30, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4,
-  0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30,
-  0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe8, 0xb1, 0x06, 0xbb, 0xff,
-  0xff, 0xd3, 0xf8, 0xba, 0x64, 0x00, 0x24, 0x03, 0xb1, 0xd4, 0x88, 0x46,
-  0xf8, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0,
-  0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba,
-  0x64, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf8,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6,
-  0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x4c, 0x06, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec,
-  0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xc6, 0x46, 0xf4,
-  0xe8, 0xb1, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64, 0x00, 0x88, 0xc8,
-  0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xf4, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07,
-  0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x78, 0x05, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74,
-  0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4,
-  0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88, 0xe8, 0xb1, 0x04, 0xbb, 0xff, 0xff,
-  0xd3, 0xf8, 0xba, 0x64, 0x00, 0x24, 0x03, 0xb1, 0xd4, 0x88, 0x46, 0xec,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01,
-  0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64,
-  0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x23, 0x8a, 0x4e, 0xec, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4,
-  0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x9d, 0x04, 0x30, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee,
-  0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff,
-  0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a,
-  0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0xb1, 0xe8, 0xc6, 0x46,
-  0xee, 0xd4, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46, 0xee, 0xba, 0x64, 0x00,
-  0xee, 0x84, 0xe4, 0x74, 0x20, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb,
-  0x05, 0xe9, 0xcb, 0x03, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06,
-  0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff,
-  0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26,
-  0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74,
-  0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00,
-  0x75, 0x87, 0x88, 0xe8, 0xd1, 0xf8, 0xc6, 0x46, 0xf2, 0xd4, 0xd1, 0xf8,
-  0xbb, 0xff, 0xff, 0x88, 0xc1, 0xba, 0x64, 0x00, 0x80, 0xe1, 0x03, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb,
-  0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x07, 0x8a, 0x46, 0xf2,
-  0xba, 0x64, 0x00, 0xee, 0x84, 0xe4, 0x74, 0x20, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07,
-  0xb0, 0x01, 0xeb, 0x05, 0xe9, 0xf0, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74,
-  0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4,
-  0x3d, 0xfa, 0x00, 0x75, 0x87, 0xb1, 0xe8, 0xc6, 0x46, 0xf0, 0xd4, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4,
-  0x02, 0x75, 0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x07, 0x8a, 0x46, 0xf0, 0xba, 0x64, 0x00, 0xee, 0x84, 0xe4,
-  0x74, 0x20, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d,
-  0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x1e,
-  0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00,
-  0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75,
-  0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a,
-  0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec,
-  0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36,
-  0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x94, 0xba, 0x60,
-  0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x87, 0x88,
-  0xe9, 0xbb, 0xff, 0xff, 0x80, 0xe1, 0x03, 0xba, 0x64, 0x00, 0xb5, 0xd4,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x04, 0xb0, 0x01,
-  0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x64,
-  0x00, 0x88, 0xe8, 0xee, 0x84, 0xe4, 0x74, 0x20, 0xbb, 0xff, 0xff, 0xba,
-  0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b,
-  0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75, 0x07,
-  0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x4c, 0x01, 0x30, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74,
-  0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x1d, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x74, 0x94, 0xba, 0x60, 0x00, 0xec, 0x2a, 0xe4, 0x30, 0xe4,
-  0x3d, 0xfa, 0x00, 0x75, 0x87, 0xb5, 0xe9, 0xbb, 0xff, 0xff, 0xba, 0x64,
-  0x00, 0xb1, 0xd4, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0xf6, 0xc4, 0x02, 0x75,
-  0x04, 0xb0, 0x01, 0xeb, 0x02, 0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74,
-  0x06, 0xba, 0x64, 0x00, 0x88, 0xc8, 0xee, 0x84, 0xe4, 0x74, 0x22, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0x88, 0xe9, 0xec, 0x2a, 0xe4, 0x88, 0xc4,
-  0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f,
-  0xf6, 0xc4, 0x02, 0x75, 0x07, 0xb0, 0x01, 0xeb, 0x05, 0xe9, 0x7b, 0x00,
-  0x30, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x06, 0xba, 0x60, 0x00, 0x88,
-  0xc8, 0xee, 0x84, 0xe4, 0x74, 0xeb, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00,
-  0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4,
-  0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x3a, 0xbb,
-  0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a, 0xe4, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88, 0x26, 0x3d, 0x0f, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x1d, 0xbb, 0xff, 0xff, 0xba, 0x64, 0x00, 0xec, 0x2a,
-  0xe4, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x36, 0x88,
-  0x26, 0x3d, 0x0f, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x12, 0xba, 0x60, 0x00,
-  0xec, 0x2a, 0xe4, 0x30, 0xe4, 0x3d, 0xfa, 0x00, 0x75, 0x05, 0xb8, 0x01,
-  0x00, 0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x66, 0xfa, 0x5a, 0x59, 0x5b, 0x5d,
-  0x4d, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0x55, 0x89, 0xe5, 0x0e, 0xe8, 0x9a, 0x9e, 0x90, 0x36, 0x80, 0x3e,
-  0x0d, 0x0e, 0x00, 0x7d, 0x05, 0x0e, 0x3e, 0xe8, 0xec, 0xb4, 0x0e, 0xe8,
-  0x92, 0x9f, 0x90, 0x36, 0x80, 0x3e, 0x2c, 0x0d, 0x04, 0x75, 0x06, 0xb8,
-  0x01, 0x00, 0x5d, 0x4d, 0xcb, 0x31, 0xc0, 0x5d, 0x4d, 0xcb, 0x84, 0xdc,
-  0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc,
-  0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x89, 0xdc, 0x7f, 0xdc,
-  0x7a, 0xdc, 0x75, 0xdc, 0x70, 0xdc, 0x53, 0x2d, 0xf0, 0xff, 0x3d, 0x0f,
-  0x00, 0x77, 0x22, 0x89, 0xc3, 0xd1, 0xe3, 0x2e, 0xff, 0xa7, 0x3e, 0xdc,
-  0xb8, 0x8e, 0x09, 0xeb, 0x17, 0xb8, 0x9c, 0x09, 0xeb, 0x12, 0xb8, 0xb7,
-  0x09, 0xeb, 0x0d, 0xb8, 0xce, 0x09, 0xeb, 0x08, 0xb8, 0xe0, 0x09, 0xeb,
-  0x03, 0xb8, 0xf8, 0x09, 0x8c, 0xd2, 0x5b, 0xcb, 0x45, 0x55, 0x89, 0xe5,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x50, 0x8b, 0x86, 0xf4, 0xff, 0xc4, 0xc4,
-  0x58, 0x01, 0x8d, 0x66, 0xf6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0x4d,
-  0xcb, 0xfc, 0x45, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x12, 0x89,
-  0xc6, 0x89, 0x56, 0xf8, 0x89, 0x4e, 0xfa, 0xc7, 0x46, 0xf4, 0xff, 0xff,
-  0xb8, 0x00, 0x10, 0x0e, 0x3e, 0xe8, 0xb2, 0x3b, 0x89, 0x46, 0xea, 0x89,
-  0x56, 0xec, 0x8b, 0x46, 0xea, 0x8b, 0x56, 0xec, 0x85, 0xd2, 0x75, 0x0a,
-  0x85, 0xc0, 0x75, 0x06, 0xb8, 0xff, 0xff, 0xe9, 0x31, 0x01, 0x8e, 0x46,
-  0xf8, 0x89, 0xf7, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1,
-  0x49, 0x89, 0xca, 0x42, 0x81, 0xfa, 0x00, 0x10, 0x73, 0x21, 0x8b, 0x7e,
-  0xea, 0x8b, 0x46, 0xec, 0x89, 0x46, 0xf2, 0x8c, 0xc1, 0x8e, 0x46, 0xf2,
-  0x89, 0xd0, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13,
-  0xc9, 0xf3, 0xa4, 0x5f, 0x1f, 0xeb, 0x09, 0xba, 0x01, 0x00, 0xc5, 0x76,
-  0xea, 0xc6, 0x04, 0x00, 0x8b, 0x46, 0xfa, 0x85, 0xc0, 0x75, 0x04, 0x85,
-  0xdb, 0x74, 0x55, 0x89, 0x56, 0xee, 0x89, 0xdf, 0x8e, 0xc0, 0xb9, 0xff,
-  0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x89, 0xc8, 0x01, 0xd0,
-  0x40, 0x3d, 0x00, 0x10, 0x73, 0x2c, 0x41, 0x89, 0x4e, 0xf0, 0x8b, 0x46,
-  0xec, 0x89, 0x46, 0xf2, 0x8b, 0x7e, 0xea, 0x89, 0xc8, 0x89, 0xde, 0x01,
-  0xd7, 0x8c, 0xc1, 0x8e, 0x46, 0xf2, 0x03, 0x56, 0xf0, 0x1e, 0x57, 0x91,
-  0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x1f,
-  0xeb, 0x13, 0x89, 0xd3, 0x42, 0x8e, 0x5e, 0xec, 0x03, 0x5e, 0xea, 0xc6,
-  0x07, 0x00, 0xeb, 0x05, 0xc7, 0x46, 0xee, 0x00, 0x00, 0x89, 0x56, 0xf6,
-  0xc4, 0x7e, 0x06, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1,
-  0x49, 0x89, 0xc8, 0x01, 0xd0, 0x40, 0x3d, 0x00, 0x10, 0x73, 0x1f, 0x89,
-  0xc8, 0x40, 0xc4, 0x7e, 0xea, 0x8b, 0x76, 0x06, 0x8b, 0x4e, 0x08, 0x01,
-  0xd7, 0x1e, 0x57, 0x91, 0x8e, 0xd8, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9,
-  0xf3, 0xa4, 0x5f, 0x1f, 0xeb, 0x08, 0xc5, 0x5e, 0xea, 0x01, 0xd3, 0xc6,
-  0x07, 0x00, 0x60, 0x1e, 0x06, 0xf8, 0xc5, 0xb6, 0xea, 0xff, 0x33, 0xff,
-  0x8e, 0xc7, 0xf7, 0x86, 0xee, 0xff, 0xff, 0xff, 0x0f, 0x84, 0x0a, 0x00,
-  0x8c, 0xd8, 0x8e, 0xc0, 0x8b, 0xbe, 0xee, 0xff, 0x03, 0xfe, 0x8b, 0x9e,
-  0xf6, 0xff, 0x03, 0xde, 0x33, 0xc0, 0x8b, 0xc8, 0xc4, 0xc4, 0x58, 0x00,
-  0x07, 0x1f, 0x0f, 0x83, 0x02, 0x00, 0xf7, 0xd8, 0x89, 0x86, 0xf4, 0xff,
-  0x61, 0x8b, 0x46, 0xea, 0x8b, 0x56, 0xec, 0x0e, 0x3e, 0xe8, 0x24, 0x3a,
-  0x8b, 0x46, 0xf4, 0x8d, 0x66, 0xfc, 0x5f, 0x5e, 0x5d, 0x4d, 0xca, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-  0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x68, 0x65, 0x78, 0x6d, 0x65,
-  0x6d, 0x20, 0x5b, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5d, 0x0a,
-  0x00, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x6e, 0x66, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x44, 0x6f, 0x6e, 0x27, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x46,
-  0x6c, 0x61, 0x74, 0x20, 0x52, 0x65, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x64,
-  0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x65, 0x78,
-  0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
-  0x79, 0x0a, 0x00, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x6e, 0x62, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x44, 0x6f, 0x6e, 0x27, 0x74, 0x20, 0x75, 0x73, 0x65,
-  0x20, 0x42, 0x49, 0x4f, 0x53, 0x20, 0x49, 0x4e, 0x54, 0x20, 0x31, 0x35,
-  0x48, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x65, 0x78,
-  0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
-  0x79, 0x0a, 0x00, 0x6e, 0x66, 0x00, 0x6e, 0x62, 0x00, 0x68, 0x65, 0x78,
-  0x6d, 0x65, 0x6d, 0x2e, 0x63, 0x00, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x64,
-  0x61, 0x74, 0x61, 0x5f, 0x74, 0x6f, 0x00, 0x63, 0x70, 0x79, 0x20, 0x3c,
-  0x3d, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x70, 0x61, 0x72, 0x61, 0x00,
-  0x48, 0x6f, 0x73, 0x74, 0x20, 0x4f, 0x53, 0x20, 0x72, 0x65, 0x73, 0x65,
-  0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x49, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6e, 0x6f,
-  0x74, 0x20, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65,
-  0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x72,
-  0x65, 0x61, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x44, 0x4f, 0x53, 0x20, 0x00, 0x57, 0x49, 0x4e, 0x20, 0x00,
-  0x43, 0x50, 0x55, 0x20, 0x00, 0x44, 0x50, 0x4d, 0x49, 0x20, 0x00, 0x48,
-  0x49, 0x4d, 0x45, 0x4d, 0x20, 0x00, 0x45, 0x4d, 0x4d, 0x20, 0x00, 0x4c,
-  0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x00, 0x5b, 0x4f, 0x4b, 0x5d, 0x0a, 0x00,
-  0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x4d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x6e, 0x20, 0x69, 0x73,
-  0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-  0x73, 0x20, 0x63, 0x68, 0x6f, 0x73, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20,
-  0x6d, 0x61, 0x6b, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
-  0x6c, 0x65, 0x2e, 0x0a, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x49, 0x74, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x61,
-  0x63, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
-  0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2e, 0x0a, 0x00, 0x41, 0x42,
-  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x74, 0x72, 0x63, 0x61, 0x73, 0x74, 0x3d,
-  0x25, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x74, 0x72, 0x65, 0x61, 0x6c, 0x3d,
-  0x25, 0x64, 0x20, 0x62, 0x69, 0x6f, 0x73, 0x65, 0x78, 0x74, 0x3d, 0x25,
-  0x64, 0x0a, 0x00, 0x79, 0x65, 0x73, 0x00, 0x6e, 0x6f, 0x00, 0x4c, 0x4c,
-  0x4d, 0x45, 0x4d, 0x3a, 0x20, 0x25, 0x73, 0x20, 0x28, 0x25, 0x73, 0x29,
-  0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x3d, 0x30, 0x78, 0x25, 0x6c, 0x6c,
-  0x58, 0x0a, 0x00, 0x52, 0x65, 0x61, 0x64, 0x79, 0x0a, 0x00, 0x4a, 0x75,
-  0x6d, 0x70, 0x20, 0x74, 0x6f, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x65,
-  0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x20, 0x34, 0x38, 0x36,
-  0x20, 0x6f, 0x72, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x72, 0x20, 0x70,
-  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x00, 0x52, 0x65, 0x71,
-  0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x43, 0x50, 0x55, 0x49, 0x44, 0x00,
-  0x4c, 0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74,
-  0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x72, 0x6f,
-  0x6d, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x57, 0x69, 0x6e,
-  0x64, 0x6f, 0x77, 0x73, 0x00, 0x31, 0x36, 0x2d, 0x62, 0x69, 0x74, 0x20,
-  0x4c, 0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74,
-  0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x77, 0x68, 0x69,
-  0x6c, 0x65, 0x20, 0x76, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x38,
-  0x30, 0x38, 0x36, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20,
-  0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x28, 0x6e, 0x6f, 0x20, 0x56,
-  0x43, 0x50, 0x49, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73,
-  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x00,
-  0x4c, 0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
-  0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x43, 0x50, 0x55, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20,
-  0x50, 0x53, 0x45, 0x20, 0x6f, 0x72, 0x20, 0x50, 0x41, 0x45, 0x00, 0x6c,
-  0x6c, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x20,
-  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x33, 0x36, 0x4b, 0x42, 0x20, 0x6e,
-  0x65, 0x65, 0x64, 0x65, 0x64, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x32,
-  0x4d, 0x20, 0x50, 0x41, 0x45, 0x20, 0x56, 0x43, 0x50, 0x49, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x6c, 0x6c,
-  0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x47, 0x44, 0x54, 0x00,
-  0x6c, 0x6c, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f,
-  0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69,
-  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x38, 0x4b, 0x42, 0x20, 0x6e,
-  0x65, 0x65, 0x64, 0x65, 0x64, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x34,
-  0x4d, 0x20, 0x50, 0x53, 0x45, 0x20, 0x56, 0x43, 0x50, 0x49, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x6c, 0x6c,
-  0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x28, 0x32, 0x30, 0x4b, 0x42, 0x20, 0x6e, 0x65,
-  0x65, 0x64, 0x65, 0x64, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x32, 0x4d,
-  0x20, 0x50, 0x41, 0x45, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x00, 0x6c, 0x6c, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79,
-  0x3a, 0x20, 0x6e, 0x6f, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
-  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x34,
-  0x4b, 0x42, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x29, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x34, 0x4d, 0x20, 0x50, 0x53, 0x45, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x6c, 0x6c, 0x6d,
-  0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x20, 0x6d, 0x65,
-  0x74, 0x68, 0x6f, 0x64, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
-  0x62, 0x6c, 0x65, 0x00, 0x25, 0x68, 0x73, 0x2c, 0x20, 0x66, 0x75, 0x6e,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x25, 0x68, 0x73, 0x2c, 0x20, 0x66,
-  0x69, 0x6c, 0x65, 0x20, 0x25, 0x68, 0x73, 0x2c, 0x20, 0x6c, 0x69, 0x6e,
-  0x65, 0x20, 0x25, 0x64, 0x2e, 0x0a, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x00,
-  0x3a, 0x20, 0x00, 0x21, 0x42, 0x52, 0x45, 0x41, 0x4b, 0x52, 0x45, 0x54,
-  0x55, 0x52, 0x4e, 0x20, 0x25, 0x33, 0x64, 0x00, 0x41, 0x42, 0x4e, 0x4f,
-  0x52, 0x4d, 0x41, 0x4c, 0x20, 0x54, 0x45, 0x52, 0x4d, 0x49, 0x4e, 0x41,
-  0x54, 0x49, 0x4f, 0x4e, 0x00, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x52,
-  0x65, 0x61, 0x6c, 0x00, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64,
-  0x00, 0x45, 0x6e, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x00, 0x4e, 0x54,
-  0x00, 0x4f, 0x53, 0x2f, 0x32, 0x00, 0x42, 0x49, 0x4f, 0x53, 0x3a, 0x20,
-  0x00, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x42, 0x6f, 0x78, 0x20,
-  0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x31, 0x68, 0x20, 0x41, 0x48, 0x3d,
-  0x33, 0x30, 0x68, 0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x31, 0x68, 0x20,
-  0x41, 0x58, 0x3d, 0x33, 0x33, 0x30, 0x36, 0x68, 0x00, 0x44, 0x65, 0x64,
-  0x75, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x44, 0x4f, 0x53,
-  0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x49, 0x4e, 0x54,
-  0x20, 0x32, 0x46, 0x68, 0x20, 0x41, 0x58, 0x3d, 0x31, 0x36, 0x30, 0x41,
-  0x68, 0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x46, 0x68, 0x20, 0x41, 0x58,
-  0x3d, 0x34, 0x36, 0x38, 0x30, 0x68, 0x00, 0x49, 0x4e, 0x54, 0x20, 0x32,
-  0x46, 0x68, 0x20, 0x41, 0x58, 0x3d, 0x31, 0x36, 0x30, 0x30, 0x68, 0x00,
-  0x41, 0x73, 0x73, 0x75, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f,
-  0x6d, 0x20, 0x44, 0x4f, 0x53, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x47, 0x65, 0x74,
-  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x45, 0x78, 0x20, 0x5b, 0x4e,
-  0x54, 0x56, 0x44, 0x4d, 0x2e, 0x45, 0x58, 0x45, 0x20, 0x2b, 0x20, 0x44,
-  0x4f, 0x53, 0x4e, 0x54, 0x41, 0x53, 0x54, 0x2e, 0x56, 0x44, 0x44, 0x5d,
-  0x00, 0x53, 0x43, 0x00, 0x53, 0x44, 0x00, 0x4e, 0x55, 0x4c, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x00, 0x53, 0x42, 0x4f, 0x53, 0x00, 0x55, 0x4c, 0x54,
-  0x52, 0x41, 0x4d, 0x49, 0x44, 0x00, 0x57, 0x49, 0x4e, 0x45, 0x20, 0x28,
-  0x57, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x73, 0x20, 0x4e, 0x6f, 0x74, 0x20,
-  0x61, 0x6e, 0x20, 0x45, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x29,
-  0x00, 0x3f, 0x00, 0x44, 0x4f, 0x53, 0x4e, 0x54, 0x41, 0x53, 0x54, 0x2e,
-  0x56, 0x44, 0x44, 0x00, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
-  0x00, 0x49, 0x6e, 0x69, 0x74, 0x00, 0x44, 0x4f, 0x53, 0x4e, 0x54, 0x41,
-  0x53, 0x54, 0x2e, 0x56, 0x44, 0x44, 0xff, 0xff, 0x00, 0x4d, 0x53, 0x2d,
-  0x44, 0x4f, 0x53, 0x00, 0x46, 0x72, 0x65, 0x65, 0x44, 0x4f, 0x53, 0x00,
-  0x38, 0x30, 0x38, 0x36, 0x00, 0x31, 0x38, 0x36, 0x00, 0x32, 0x38, 0x36,
-  0x00, 0x33, 0x38, 0x36, 0x00, 0x34, 0x38, 0x36, 0x00, 0x35, 0x38, 0x36,
-  0x00, 0x36, 0x38, 0x36, 0x00, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x4e,
-  0x6f, 0x20, 0x43, 0x50, 0x55, 0x49, 0x44, 0x20, 0x61, 0x76, 0x61, 0x69,
-  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x43, 0x50, 0x55, 0x49, 0x44, 0x20,
-  0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x53, 0x53,
-  0x45, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x72, 0x65,
-  0x73, 0x65, 0x6e, 0x74, 0x00, 0x48, 0x6f, 0x6f, 0x6b, 0x20, 0x49, 0x4e,
-  0x54, 0x20, 0x36, 0x68, 0x2c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74,
-  0x65, 0x20, 0x53, 0x53, 0x45, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x65,
-  0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65,
-  0x73, 0x20, 0x61, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x5b, 0x44,
-  0x50, 0x4d, 0x49, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x57, 0x69,
-  0x6e, 0x20, 0x33, 0x2e, 0x31, 0x2f, 0x39, 0x78, 0x2f, 0x4d, 0x45, 0x20,
-  0x44, 0x4f, 0x53, 0x20, 0x62, 0x6f, 0x78, 0x5d, 0x00, 0x53, 0x53, 0x45,
-  0x20, 0x69, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c,
-  0x79, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20,
-  0x6e, 0x6f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x65,
-  0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20, 0x79, 0x65,
-  0x74, 0x00, 0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x65, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x44, 0x50, 0x4d, 0x49, 0x20, 0x70,
-  0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x64,
-  0x65, 0x00, 0x41, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x4d, 0x53, 0x2d, 0x44,
-  0x4f, 0x53, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x49, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x6f,
-  0x20, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x65, 0x73, 0x74,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x53, 0x53, 0x45, 0x20, 0x66, 0x72, 0x6f,
-  0x6d, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x57, 0x69, 0x6e,
-  0x20, 0x33, 0x2e, 0x31, 0x2f, 0x39, 0x78, 0x2f, 0x4d, 0x45, 0x20, 0x44,
-  0x4f, 0x53, 0x20, 0x62, 0x6f, 0x78, 0x2c, 0x20, 0x44, 0x50, 0x4d, 0x49,
-  0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
-  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x48, 0x6f, 0x6f, 0x6b, 0x20, 0x49,
-  0x4e, 0x54, 0x20, 0x36, 0x68, 0x2c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75,
-  0x74, 0x65, 0x20, 0x53, 0x53, 0x45, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65,
-  0x65, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x75, 0x73,
-  0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x5b,
-  0x4d, 0x53, 0x2d, 0x44, 0x4f, 0x53, 0x5d, 0x00, 0x38, 0x30, 0x33, 0x38,
-  0x36, 0x20, 0x4d, 0x4f, 0x56, 0x20, 0x43, 0x52, 0x34, 0x20, 0x5b, 0x4d,
-  0x53, 0x2d, 0x44, 0x4f, 0x53, 0x5d, 0x00, 0x53, 0x53, 0x45, 0x20, 0x69,
-  0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20,
-  0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x41, 0x74, 0x74,
-  0x65, 0x6d, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x77,
-  0x72, 0x69, 0x74, 0x65, 0x20, 0x43, 0x52, 0x34, 0x20, 0x66, 0x61, 0x69,
-  0x6c, 0x65, 0x64, 0x00, 0x68, 0x69, 0x6d, 0x65, 0x6d, 0x73, 0x79, 0x73,
-  0x2e, 0x63, 0x00, 0x68, 0x69, 0x6d, 0x65, 0x6d, 0x5f, 0x73, 0x79, 0x73,
-  0x5f, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x73, 0x65, 0x67, 0x76, 0x20, 0x3d,
-  0x3d, 0x20, 0x64, 0x73, 0x73, 0x65, 0x67, 0x00, 0x45, 0x4d, 0x4d, 0x58,
-  0x58, 0x58, 0x58, 0x30, 0x00, 0x45, 0x4d, 0x4d, 0x51, 0x58, 0x58, 0x58,
-  0x30, 0x00, 0x56, 0x47, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x45, 0x47, 0x41,
-  0x3d, 0x25, 0x75, 0x20, 0x43, 0x47, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x4d,
-  0x44, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x4d, 0x43, 0x47, 0x41, 0x3d, 0x25,
-  0x75, 0x20, 0x48, 0x47, 0x43, 0x3d, 0x25, 0x75, 0x28, 0x25, 0x75, 0x29,
-  0x20, 0x54, 0x61, 0x6e, 0x64, 0x79, 0x2f, 0x50, 0x43, 0x6a, 0x72, 0x3d,
-  0x25, 0x75, 0x20, 0x41, 0x6d, 0x73, 0x74, 0x72, 0x61, 0x64, 0x3d, 0x25,
-  0x75, 0x0a, 0x00, 0x20, 0x20, 0x33, 0x78, 0x30, 0x20, 0x49, 0x2f, 0x4f,
-  0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x25, 0x30,
-  0x33, 0x78, 0x20, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x40, 0x20, 0x30, 0x78,
-  0x25, 0x30, 0x35, 0x6c, 0x78, 0x2d, 0x30, 0x78, 0x25, 0x30, 0x35, 0x6c,
-  0x78, 0x20, 0x20, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x3d, 0x25, 0x75, 0x20,
-  0x39, 0x57, 0x3d, 0x25, 0x75, 0x0a, 0x00, 0x20, 0x20, 0x00, 0x59, 0x00,
-  0x65, 0x73, 0x20, 0x20, 0x00, 0x4e, 0x00, 0x6f, 0x20, 0x20, 0x00, 0x00,
-  0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6c, 0x6c,
-  0x6f, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73,
-  0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x00, 0x3a, 0x20,
-  0x00, 0x00, 0x44, 0x4c, 0x4c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f,
-  0x75, 0x6e, 0x64, 0x00, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
-  0x20, 0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x20, 0x6e, 0x6f, 0x74,
-  0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x49, 0x6e, 0x69, 0x74, 0x20,
-  0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-  0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e,
-  0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00,
-  0x49, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6e, 0x6f,
-  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00,
-  0x3f, 0x00, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x2d, 0x70,
-  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x00,
-  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62,
-  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
-  0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-  0x00, 0x00, 0x00, 0x70, 0x00, 0x71, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x1e,
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
-  0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0a, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
-  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x0c, 0x0c, 0x0c, 0x0c, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xe3, 0x0d,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x62, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x05, 0xe3, 0x0d,
-  0x23, 0x05, 0xe3, 0x0d, 0x28, 0x05, 0xe3, 0x0d, 0x31, 0x05, 0xe3, 0x0d,
-  0x3a, 0x05, 0xe3, 0x0d, 0x3d, 0x05, 0xe3, 0x0d, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x42, 0x05, 0xe3, 0x0d, 0x49, 0x05, 0xe3, 0x0d, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x06, 0xe3, 0x0d, 0x85, 0x06, 0xe3, 0x0d, 0x89, 0x06, 0xe3, 0x0d,
-  0x8d, 0x06, 0xe3, 0x0d, 0x91, 0x06, 0xe3, 0x0d, 0x95, 0x06, 0xe3, 0x0d,
-  0x99, 0x06, 0xe3, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x08, 0xe3, 0x0d,
-  0xb9, 0x08, 0xe3, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x19, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x35, 0x2d, 0x2e, 0x07, 0x5b, 0x02, 0x57, 0x57, 0x02, 0x03, 0x00, 0x00,
-  0x61, 0x50, 0x52, 0x0f, 0x19, 0x06, 0x19, 0x19, 0x02, 0x0d, 0x0d, 0x0c,
-  0xd8, 0x23, 0x80, 0x01, 0x53, 0x28, 0xb0, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-  0x33, 0x33, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x92, 0x24,
-  0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x1f, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0x99, 0x99,
-  0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xd1, 0x45, 0x17, 0x5d, 0x74, 0xd1,
-  0x45, 0x17, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0xb1, 0x13,
-  0x3b, 0xb1, 0x13, 0x3b, 0xb1, 0x13, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24,
-  0x49, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x38, 0x0e, 0x35, 0x94,
-  0xd7, 0x50, 0x5e, 0x43, 0x79, 0x0d, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-  0xcc, 0x0c, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xe8, 0xa2,
-  0x8b, 0x2e, 0xba, 0xe8, 0xa2, 0x0b, 0x16, 0xb2, 0x90, 0x85, 0x2c, 0x64,
-  0x21, 0x0b, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x70, 0x3d,
-  0x0a, 0xd7, 0xa3, 0x70, 0x3d, 0x0a, 0xd8, 0x89, 0x9d, 0xd8, 0x89, 0x9d,
-  0xd8, 0x09, 0x25, 0xb4, 0x97, 0xd0, 0x5e, 0x42, 0x7b, 0x09, 0x24, 0x49,
-  0x92, 0x24, 0x49, 0x92, 0x24, 0x09, 0x08, 0xcb, 0x3d, 0x8d, 0xb0, 0xdc,
-  0xd3, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x08, 0x10, 0x42,
-  0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x07, 0xf0, 0xc1, 0x07, 0x1f, 0x7c, 0xf0, 0xc1, 0x07, 0x87, 0x87,
-  0x87, 0x87, 0x87, 0x87, 0x87, 0x07, 0x50, 0x07, 0x75, 0x50, 0x07, 0x75,
-  0x50, 0x07, 0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x95, 0x3d, 0x00, 0x00, 0x95, 0x3d, 0x00, 0x00,
-  0x1d, 0x41, 0x00, 0x00, 0x1d, 0x41, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09,
-  0x01, 0x01, 0x0b, 0x06, 0x04, 0x05, 0x05, 0x05, 0x02, 0x03, 0xff, 0x0e,
-  0x07, 0x24, 0x06, 0x08, 0x01, 0xff, 0x14, 0x00, 0x01, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x10, 0xe3, 0x0d, 0x00, 0x00, 0x01, 0x20, 0xe4, 0x15, 0x00, 0x00,
-  0x01, 0x01, 0x3d, 0x21, 0x00, 0x00, 0x01, 0x38, 0xd2, 0x38, 0x00, 0x00,
-  0x01, 0x20, 0x45, 0x41, 0x00, 0x00, 0x01, 0x20, 0x39, 0x17, 0x00, 0x00,
-  0x01, 0x01, 0x9f, 0x23, 0x00, 0x00
+	0x78,0xDA,0xBC,0xBD,0x0B,0x7C,0x14,0xD5,0xD9,0x3F,0x7E,
+	0xF6,0x92,0xCD,0xB2,0xD9,0x6C,0x36,0x90,0x84,0x8B,0x18,
+	0xA2,0xC5,0x28,0x52,0x31,0xAB,0xBE,0x6B,0x31,0xE1,0xA2,
+	0x84,0x89,0x5A,0x0C,0x01,0x64,0x11,0x84,0xC5,0x0B,0xC6,
+	0x5B,0x8B,0x34,0xD9,0xD9,0xB4,0xBE,0x74,0x59,0x5C,0xD0,
+	0x9C,0x4C,0xB2,0xC6,0xCB,0xEB,0x5D,0x2B,0x82,0xFE,0x78,
+	0x7D,0xFB,0xB3,0x62,0x69,0x1B,0xC1,0x17,0x36,0x19,0x48,
+	0x80,0x38,0x98,0x8B,0xC5,0x90,0xD0,0x90,0x92,0x94,0xEE,
+	0x32,0x14,0x23,0xC4,0x10,0x96,0xB8,0xF3,0xFF,0x9E,0x99,
+	0x4D,0x08,0x54,0x6B,0xDF,0xBE,0x9F,0xDF,0x3F,0xF8,0xCC,
+	0x9C,0x39,0x97,0xE7,0x3C,0xE7,0x39,0xCF,0x79,0x2E,0x67,
+	0xCE,0xAC,0x77,0x2D,0xFB,0x88,0x3C,0x49,0x9A,0xC9,0xCD,
+	0xA4,0x9D,0x28,0x4A,0x61,0x0A,0x31,0x13,0xE2,0x1A,0x43,
+	0x48,0x16,0xD1,0xFE,0x92,0xB2,0x09,0xB9,0x1C,0x30,0x1D,
+	0xF0,0x00,0x60,0xD3,0x35,0x84,0xE8,0x6F,0x22,0xE4,0x29,
+	0xC0,0x5E,0xC0,0xB1,0x9B,0x09,0x39,0x0F,0x48,0xFF,0x11,
+	0x21,0xD7,0x01,0x6E,0x01,0xFC,0x18,0x50,0x0C,0xF0,0x03,
+	0x5E,0x01,0xBC,0x03,0xD8,0x05,0xE8,0x01,0x24,0x4F,0x27,
+	0x44,0x02,0x3C,0x7D,0x0B,0x21,0x47,0x73,0x09,0xA9,0xCF,
+	0x23,0x24,0x6D,0x06,0x21,0xCB,0x00,0x02,0xE0,0x79,0xC0,
+	0xEB,0x80,0xDF,0x00,0x6A,0x00,0x8D,0x80,0xCF,0x01,0xAF,
+	0xD9,0xBB,0x93,0xDF,0x02,0x44,0x90,0x3E,0x09,0x30,0xCF,
+	0x24,0x24,0x13,0xB0,0x12,0xF0,0x18,0x20,0x04,0x90,0x01,
+	0x69,0xB3,0x08,0x99,0x07,0x58,0x0E,0x78,0x1C,0x50,0x05,
+	0xF8,0x2D,0xA0,0x15,0x10,0x06,0x6C,0x99,0x4D,0x48,0xF6,
+	0xAD,0xA0,0x09,0xB8,0xDE,0x03,0xDC,0x84,0xB4,0x31,0xB5,
+	0x3B,0xF9,0x4F,0xB8,0x4B,0xB7,0x11,0xE2,0x9C,0x43,0x88,
+	0x0F,0xF0,0x21,0x60,0x49,0x01,0x21,0xA5,0x80,0xDF,0x00,
+	0x3E,0x07,0x9C,0x40,0xFD,0x18,0xEE,0xC9,0xB7,0x13,0x32,
+	0x09,0xF0,0x3C,0xE0,0x3D,0x40,0x2D,0x40,0x02,0x44,0x00,
+	0xD7,0xDD,0x41,0x08,0x07,0x78,0x15,0xD0,0x0D,0xC8,0xB9,
+	0x93,0x90,0x85,0x49,0xDD,0xC9,0xA7,0xD1,0xD6,0x82,0x7E,
+	0x5E,0x59,0x45,0xC8,0x9F,0x01,0xA6,0x87,0x08,0x99,0xF0,
+	0x18,0x21,0x0F,0x02,0xCA,0x01,0x2B,0x93,0x71,0x07,0xFC,
+	0x0A,0xF0,0x0D,0x20,0x60,0x03,0x7E,0xC0,0x6F,0x00,0xE3,
+	0x53,0x08,0x51,0xBC,0xE0,0x71,0x19,0x21,0xB7,0x21,0x8D,
+	0x59,0x22,0x8F,0x03,0x62,0xD6,0xEE,0xE4,0x17,0x70,0xBF,
+	0x21,0xB9,0x3B,0xD9,0x09,0xB8,0x05,0x30,0x13,0x70,0x1B,
+	0x80,0x03,0xF8,0x00,0x4F,0x01,0x52,0x02,0x84,0x8C,0x03,
+	0x7C,0x05,0xB8,0xA3,0x8A,0x90,0x05,0xCF,0xA3,0x6F,0x5B,
+	0x77,0x72,0x26,0xE0,0x4A,0x40,0x36,0xE0,0x5A,0xC0,0x34,
+	0xC0,0x0D,0x80,0xA7,0x00,0x4F,0x03,0x76,0x00,0xB7,0xD3,
+	0x4E,0x48,0x34,0x15,0x63,0x81,0x4C,0xFC,0x2C,0x0D,0x74,
+	0xA6,0x13,0xB2,0x0D,0x70,0x04,0x30,0x80,0x31,0xD9,0x31,
+	0xA6,0x5E,0xA4,0xAD,0x19,0x98,0x77,0xC0,0x7D,0x80,0xFF,
+	0x04,0xFC,0x0E,0xD0,0x0C,0x68,0x1A,0x0B,0x9A,0xC7,0x81,
+	0x66,0xC0,0x0A,0xC0,0x16,0xC0,0x0E,0xC0,0x9F,0x01,0x8B,
+	0xC7,0x13,0xE2,0x06,0xC4,0x80,0x67,0xCC,0x4F,0x08,0x99,
+	0x02,0x98,0x01,0x58,0x05,0xF0,0x02,0xAE,0xFA,0x29,0x21,
+	0xB7,0x02,0x96,0x00,0x1E,0x07,0x3C,0x0F,0xD8,0x02,0x68,
+	0x47,0x9B,0xC5,0x13,0x20,0x3B,0x80,0x13,0x80,0xEB,0x2F,
+	0x83,0xDC,0x01,0xEE,0x04,0xCC,0x9F,0x08,0xDA,0x56,0x13,
+	0x72,0x06,0xF0,0x0D,0x60,0xD2,0x13,0x84,0x04,0x01,0x5B,
+	0x01,0x9F,0x00,0xF6,0x01,0x3E,0x07,0x74,0x01,0x0E,0xAC,
+	0x21,0xE4,0xDC,0xCF,0x08,0xC9,0xF3,0x40,0x96,0x78,0x42,
+	0x6E,0x07,0x2C,0x03,0xAC,0x02,0xFC,0x14,0xE0,0x05,0xA4,
+	0x66,0x12,0xF2,0x5F,0x80,0x5F,0x4C,0xC2,0x3A,0xC0,0xA2,
+	0x98,0x7B,0x05,0x21,0x77,0x01,0x16,0x03,0x7E,0x06,0xF8,
+	0x12,0xF0,0xEE,0x0F,0xD0,0x1F,0xE0,0xAE,0xC9,0x84,0xAC,
+	0x06,0xFC,0x02,0x90,0x73,0x15,0x21,0x65,0x80,0xFD,0x57,
+	0x91,0x8B,0xFE,0x16,0x2D,0xA0,0x22,0x6D,0x72,0xB4,0x6C,
+	0x33,0xB6,0x1E,0x6B,0x0D,0x39,0xEA,0xD6,0x77,0xF5,0x2A,
+	0x8E,0x3A,0xC7,0x7E,0x5D,0x5B,0xEA,0x81,0xA5,0xF7,0x8A,
+	0x83,0x19,0x35,0x37,0x92,0xA2,0x8C,0x1A,0x5F,0x52,0x91,
+	0x2D,0xFC,0x7C,0x52,0x75,0x60,0x8F,0x39,0xA3,0x66,0xEE,
+	0x70,0x8E,0x3F,0x9E,0x13,0x18,0xCE,0x59,0xAD,0xE6,0x88,
+	0x83,0x8B,0xE9,0x5F,0x16,0xBA,0x96,0x04,0x4E,0x1A,0x8B,
+	0x16,0x2D,0x68,0xE0,0x06,0x74,0x64,0x86,0x8E,0xF8,0x96,
+	0xEF,0x30,0x12,0x7A,0x28,0xE8,0xEE,0x35,0x78,0x4F,0x2B,
+	0xDC,0x80,0x90,0xAF,0x17,0x26,0x06,0xDB,0x28,0xD7,0x5F,
+	0x91,0x18,0xA8,0x33,0xE6,0x5D,0xE7,0x31,0xE6,0x5D,0xCF,
+	0x3F,0x1A,0x74,0xF7,0xCF,0xF1,0xCF,0xBA,0xCE,0x13,0xDD,
+	0xBD,0x9B,0x54,0x36,0xD1,0xCE,0x60,0xE8,0x3D,0x3E,0x75,
+	0x7E,0xE1,0xC7,0x8A,0x72,0x63,0xE8,0xF4,0x07,0x67,0x9B,
+	0xA7,0x9E,0x3B,0xF3,0x9E,0x27,0x61,0xFC,0xFE,0xC0,0x61,
+	0x65,0xE3,0x7E,0xDE,0xE2,0xAC,0x37,0xB9,0x92,0x74,0xF2,
+	0x0D,0x72,0xEE,0xEE,0x3A,0x42,0x3B,0xFF,0x41,0x5D,0x8F,
+	0x39,0x7C,0xBD,0xF2,0xB1,0x8E,0xC8,0x63,0xD0,0xE6,0x9E,
+	0x24,0x9D,0xC0,0x0D,0xE4,0x72,0x7D,0xBF,0x34,0x44,0x1E,
+	0x53,0x1C,0xFB,0xE9,0xBE,0xAA,0xE2,0xE8,0x4A,0xF7,0xB2,
+	0x15,0x2A,0xED,0x8B,0x16,0xB8,0x96,0x14,0x2D,0x74,0xFA,
+	0x67,0xDE,0x9D,0x44,0x78,0x43,0xA4,0x9B,0x08,0x9C,0x65,
+	0x63,0xA8,0x8C,0xE3,0xED,0x01,0x9F,0x59,0x57,0x36,0x93,
+	0x37,0x07,0x7C,0x26,0x52,0xE6,0xF4,0xDC,0x24,0xB8,0xAC,
+	0xBB,0x6E,0xD0,0x39,0x42,0x8E,0x0E,0xC7,0x7E,0xDB,0xCC,
+	0xF0,0xC7,0x16,0x83,0xCB,0x38,0xA6,0xD0,0x34,0xC6,0x6D,
+	0x1E,0xA3,0x36,0x19,0xC3,0xD7,0x06,0xCE,0xEB,0xCA,0xAC,
+	0xFC,0x8E,0x8D,0xFB,0xCB,0x4C,0xFC,0xF6,0x8D,0x2D,0xDE,
+	0x0F,0xC1,0xEC,0x62,0x6B,0xC0,0x67,0x25,0xDE,0x07,0x15,
+	0xAF,0x55,0xF1,0x5A,0x14,0xAF,0x59,0xF1,0x9A,0x04,0xAE,
+	0x5F,0xF1,0x1A,0x05,0x57,0x1F,0xF0,0xEC,0xB8,0xD3,0x16,
+	0x7E,0x6C,0x5E,0x35,0xAD,0xDF,0x18,0xF2,0xCD,0xCC,0xE5,
+	0xAC,0xBE,0x71,0x35,0x8F,0x92,0x9D,0x07,0x49,0x65,0x73,
+	0x51,0xCD,0x5E,0x92,0x51,0xD9,0x52,0x54,0xD3,0x41,0x50,
+	0xEF,0x85,0x24,0xDA,0xBB,0x2D,0xE5,0xD5,0x29,0x5E,0x2B,
+	0x6D,0x6D,0x8D,0xEA,0x38,0x63,0xAA,0xDB,0x94,0xEA,0x32,
+	0xA7,0xBA,0x2C,0x3A,0x6F,0x3F,0xEB,0xA2,0xEC,0x4D,0x81,
+	0xB3,0x6E,0x0C,0x79,0x32,0x04,0x5F,0x7F,0x90,0xEB,0xA3,
+	0xB5,0x1F,0x2A,0x4B,0x2A,0xBA,0x9A,0x23,0x67,0xFE,0x6B,
+	0xCC,0xFE,0x33,0xEF,0xAF,0xAC,0x2A,0x1E,0x58,0xE9,0x5E,
+	0x7A,0xEF,0x8A,0x3A,0x0B,0x09,0xF8,0x2C,0xC4,0x63,0x88,
+	0x50,0x24,0xCC,0x84,0x3F,0x8B,0x01,0xDA,0x4B,0xBF,0x62,
+	0xC3,0xBB,0x65,0x68,0x78,0xE1,0x8E,0x51,0xD5,0x23,0x87,
+	0xC7,0xBB,0x37,0x76,0xF0,0xCB,0x02,0xE7,0xEC,0x25,0x26,
+	0x7E,0xD1,0xC6,0x96,0xB2,0xF9,0xE8,0x40,0x29,0x64,0x23,
+	0x53,0x3C,0xEF,0x81,0x63,0x82,0xDB,0x2C,0x14,0x9A,0x04,
+	0x97,0x71,0x97,0x91,0xA0,0x7B,0x5B,0x38,0x64,0xAD,0xAE,
+	0xB1,0x13,0xDA,0xEC,0xE8,0x0F,0x70,0xFD,0xF6,0xCC,0x25,
+	0xCF,0x05,0xDB,0x40,0xC9,0xBB,0xA0,0x64,0xCB,0xCA,0x49,
+	0x01,0xCE,0x68,0x0F,0xB8,0x4C,0x24,0xE0,0x32,0x03,0x2C,
+	0x44,0xDE,0x0E,0xFE,0x2F,0x56,0xF9,0xBF,0x91,0x44,0x31,
+	0xD6,0xA4,0x47,0x30,0x8E,0xEC,0x1A,0x45,0xA1,0x75,0x78,
+	0xDA,0x50,0xBA,0x31,0xC4,0x8F,0xCB,0xA8,0x39,0x39,0x2C,
+	0x7B,0xA7,0xCD,0x4C,0xF6,0xCE,0xA3,0xEC,0x11,0xEB,0x36,
+	0x03,0x58,0xBC,0x5B,0x4F,0x1C,0xFD,0x43,0x04,0x39,0x05,
+	0x0E,0xBC,0x35,0x09,0xEE,0x7E,0xD3,0x8D,0xFB,0x83,0xB5,
+	0xC5,0xB5,0xC7,0xEC,0xC5,0x57,0x29,0x0A,0x21,0x0F,0x67,
+	0x0B,0x46,0x7B,0x62,0xD0,0xDD,0x47,0x13,0x75,0x3E,0x63,
+	0xAA,0xD7,0x34,0x44,0x80,0xCE,0xD7,0x2F,0xD7,0x9E,0x1F,
+	0xC1,0x21,0xD0,0xB3,0x24,0x89,0x60,0xCE,0x39,0xEB,0xA5,
+	0x2B,0x46,0x70,0x1B,0x17,0x62,0xE6,0x8A,0x30,0x87,0x18,
+	0x72,0xF8,0xFF,0x0C,0x82,0x8A,0x7D,0x9E,0x11,0x6D,0xB7,
+	0x19,0xD1,0x0A,0x4C,0x68,0xED,0xFA,0xC7,0xB3,0x30,0x38,
+	0x77,0x68,0xE9,0x40,0x98,0x06,0x1B,0xB8,0x43,0x84,0x34,
+	0x70,0x6D,0x3A,0x5C,0xDA,0x59,0xEA,0x04,0xBB,0x1C,0x63,
+	0x97,0x2E,0x76,0xE9,0x64,0x97,0x23,0x84,0x80,0x31,0xA6,
+	0x1A,0x1D,0x89,0x74,0x26,0x66,0xD4,0xDC,0xA6,0x2B,0xAA,
+	0x6C,0xB1,0x85,0x5F,0x65,0x2B,0xD1,0x58,0xF3,0x93,0x24,
+	0x50,0xF2,0x49,0x92,0x2D,0x5C,0xEF,0xAD,0xCE,0xA8,0x29,
+	0xD0,0xCA,0x7E,0x39,0xA2,0xEC,0x6D,0x94,0x6D,0x2F,0x43,
+	0xD9,0x3C,0xAD,0xEC,0xFE,0x11,0x65,0x1B,0x50,0x76,0xAA,
+	0x12,0x65,0x0B,0xB4,0xB2,0xB9,0x23,0xCA,0x1E,0x41,0xD9,
+	0x27,0x3C,0xCA,0x96,0x68,0x65,0x53,0x46,0x94,0xCD,0x43,
+	0xD9,0x96,0x67,0x51,0xE6,0xD6,0xCA,0x92,0x47,0x94,0xE5,
+	0xA0,0xEC,0xD7,0x2F,0xA2,0xEC,0x41,0xAD,0xEC,0x2B,0xCB,
+	0x85,0xB2,0x34,0x86,0x73,0x6E,0xB5,0xF3,0x9D,0xBB,0x93,
+	0x32,0x6A,0x1E,0xD3,0x61,0x4E,0x5B,0xD5,0x52,0x5B,0x38,
+	0xFF,0x8D,0x6A,0x4C,0xB7,0x15,0x63,0x8C,0x2F,0xD3,0xBB,
+	0x1A,0x31,0x1B,0x5B,0x6C,0x37,0x78,0x4D,0x58,0xCC,0xB8,
+	0xE3,0xE9,0x87,0xC9,0xC4,0x33,0x21,0xA3,0x66,0x0D,0x6B,
+	0xF7,0xBA,0xDA,0x2E,0xA3,0x66,0x1B,0x1E,0x66,0x86,0xAB,
+	0x2C,0x78,0x88,0xD7,0x30,0x44,0x0E,0xB2,0x89,0x4C,0xB6,
+	0x19,0xD6,0x66,0xE0,0xEE,0x82,0x80,0xD9,0x86,0x64,0x2A,
+	0xE7,0x67,0xCE,0x77,0x16,0x27,0xA9,0xA5,0xFA,0xB5,0x5F,
+	0xE0,0x7E,0x0F,0x4A,0x3F,0x8B,0xEE,0x3A,0xAE,0xAB,0x6C,
+	0xDA,0x9D,0x93,0x1A,0x6C,0x0B,0x86,0x3E,0xCE,0x22,0x4B,
+	0x2A,0x8C,0xD9,0xE5,0x09,0x79,0xC4,0x93,0x5A,0x91,0xAF,
+	0x0B,0xD4,0xEB,0xB3,0xCB,0xE7,0xEA,0x02,0x0D,0xFA,0x3C,
+	0xC2,0x1F,0x5F,0xB9,0x3B,0x2B,0x35,0x27,0x34,0x72,0x6A,
+	0x73,0x7A,0x8A,0x6A,0xCC,0x84,0xAD,0xD7,0x9C,0xD4,0x70,
+	0x75,0x14,0xDA,0xB6,0x99,0x0E,0x54,0xB6,0xEC,0xCA,0x4A,
+	0x0D,0x3F,0x15,0x05,0x97,0x4A,0xAA,0x51,0x0C,0xDC,0x95,
+	0x2D,0x95,0xCD,0xC1,0xBA,0x4C,0xAC,0x88,0xA4,0xFD,0xC3,
+	0x3A,0x6B,0x12,0x14,0x5C,0xD6,0xC7,0x28,0xFF,0x52,0xB7,
+	0xEB,0x9A,0xD4,0x60,0xFB,0x88,0x22,0x94,0xB0,0x91,0x2F,
+	0x49,0xD2,0x9D,0x67,0x74,0xDA,0x88,0x27,0x09,0xCC,0x61,
+	0x63,0x78,0x36,0xC2,0xE9,0x80,0xF9,0xB6,0xDA,0xEA,0x0D,
+	0x21,0xAC,0x9D,0xA9,0x3A,0x5B,0x78,0x5C,0x6D,0xF5,0xB6,
+	0xFF,0xBB,0x53,0x51,0x76,0xAC,0x22,0x27,0xAF,0xED,0x29,
+	0xDF,0xB3,0x55,0xEF,0x31,0xFC,0x98,0xEF,0x73,0x96,0x67,
+	0xCF,0x48,0xE9,0xDF,0xA3,0xE7,0x4D,0x28,0x28,0xDF,0x77,
+	0x6A,0x5B,0xD3,0xF7,0xD7,0x19,0x59,0x43,0xC7,0x0F,0xD7,
+	0x28,0xEF,0x9A,0xAC,0xE3,0x6F,0xF9,0x47,0x85,0x97,0xFF,
+	0x83,0x42,0x8F,0x69,0xC7,0x7D,0xAC,0x04,0x57,0xD4,0x62,
+	0x55,0xF6,0xA2,0xEA,0xB6,0xE6,0xEF,0x21,0xA4,0x3C,0x82,
+	0xA4,0x7F,0xBF,0xE1,0x3B,0xAA,0xDD,0xC7,0xAA,0x81,0x23,
+	0x13,0x42,0xDB,0x3E,0xF8,0xFE,0x81,0x41,0x7F,0xEC,0xAE,
+	0xDE,0xF1,0x3C,0xAB,0xB3,0x55,0xCF,0x1B,0xAC,0x86,0x53,
+	0xE7,0x9D,0x6F,0x2F,0x49,0xC2,0xFC,0x39,0xDF,0x5E,0x9C,
+	0x54,0x94,0x13,0x82,0x9A,0x19,0x50,0xA5,0x69,0x96,0x39,
+	0xB0,0xC7,0xE2,0x54,0x9C,0x9D,0x56,0x5C,0x8E,0xB0,0x4B,
+	0x3B,0xBB,0xB4,0xB1,0xCB,0x09,0x76,0x09,0x5B,0x35,0xCB,
+	0xE1,0x49,0xD8,0x71,0x99,0x5E,0x36,0xEC,0x98,0xA4,0xAF,
+	0x6C,0x2A,0x5A,0x98,0x51,0x73,0xA5,0x1E,0x92,0xA9,0x63,
+	0x5A,0x2A,0x2D,0xA3,0x66,0x96,0x9E,0xE1,0x3A,0x93,0xC8,
+	0xC4,0x7B,0x66,0xF8,0x7A,0x18,0x94,0x43,0x4C,0x38,0x93,
+	0x8C,0x01,0x5F,0x1B,0xD3,0x79,0x7D,0x3A,0xE7,0xDB,0x5B,
+	0x6C,0xE8,0xBE,0x81,0xEB,0x99,0x9D,0xAA,0x78,0x8F,0x35,
+	0x70,0x7D,0xCC,0xEF,0xEA,0xAA,0x6C,0x51,0xBC,0x9D,0x35,
+	0x2C,0xEB,0x48,0xA5,0xEB,0x78,0xB8,0xE8,0x9C,0x56,0x0F,
+	0xA6,0x6C,0x9D,0x21,0xF2,0xB1,0xCE,0x59,0x91,0xB1,0xD9,
+	0x26,0x70,0x7D,0x39,0xFD,0x67,0x4F,0x38,0x14,0xA7,0x90,
+	0xF1,0x8A,0x8D,0x8A,0xCE,0x4D,0xAF,0xD9,0x9A,0xBB,0x83,
+	0x6D,0xBA,0x76,0x58,0x5B,0xEA,0x0A,0x53,0xD7,0x00,0xAA,
+	0xBC,0xBA,0x2D,0x05,0x56,0xE3,0x3C,0xAD,0xA7,0x6D,0x90,
+	0xCA,0xD3,0xBB,0x16,0xEA,0x41,0xC9,0x59,0x83,0xE0,0x3D,
+	0xA2,0x3B,0x24,0xB8,0x3A,0x53,0x0F,0x50,0xD7,0x29,0xC1,
+	0xD5,0x95,0xDA,0x4E,0x5D,0xBD,0x82,0xEB,0x58,0x6A,0x1D,
+	0x1D,0xA0,0xAE,0xD3,0x6A,0x2B,0xEA,0x3D,0x39,0xA2,0xE1,
+	0x32,0xBD,0x2D,0xBC,0xDB,0x50,0x5D,0x93,0x47,0xA6,0x34,
+	0x51,0xEE,0xE0,0x0E,0xF8,0x88,0x07,0x84,0xC2,0x53,0xEC,
+	0xDE,0x2E,0xB8,0x7B,0x1D,0x21,0xC1,0x75,0x92,0x72,0x28,
+	0x6A,0xA1,0xDC,0xE7,0x02,0x77,0x5A,0xF0,0x1E,0x44,0x4F,
+	0x1F,0x99,0x72,0xFA,0x9D,0x42,0x66,0x51,0x92,0xFF,0x58,
+	0x8A,0x33,0x68,0x5A,0x98,0xA4,0x6B,0x2D,0xC8,0xAE,0x48,
+	0x0C,0x72,0xFD,0x39,0x3D,0x82,0x7B,0xC0,0xFF,0xA9,0x2D,
+	0xC0,0x0D,0xE8,0xB3,0x69,0x62,0x40,0xB1,0xC3,0x4A,0xDF,
+	0xA5,0xD0,0xF3,0xDB,0x8C,0xCD,0xDD,0x8E,0x90,0xC1,0x1D,
+	0x2E,0x68,0x48,0xCC,0xB2,0xC9,0xA6,0xD9,0x33,0xEC,0xE4,
+	0x97,0x8F,0xEF,0x71,0xF7,0x64,0x57,0x4C,0x2A,0x6F,0x67,
+	0xE8,0x9C,0x45,0x49,0xAD,0x51,0x0D,0xDB,0xA1,0xEC,0x8A,
+	0x34,0x1A,0x6B,0x3E,0x9E,0xD3,0x6F,0xF0,0x86,0xFD,0x07,
+	0x13,0x69,0x5A,0x79,0x3B,0xEB,0x8A,0x75,0x89,0xAA,0xC3,
+	0x3D,0x8E,0xA5,0xE7,0x9B,0xBB,0x81,0x93,0x55,0x19,0x4B,
+	0xEB,0x72,0x8E,0x2B,0x5C,0x8F,0xFF,0x98,0xAE,0x20,0x10,
+	0xD5,0xF1,0x6F,0xC5,0xCB,0x74,0x5F,0xA0,0x43,0x22,0x3F,
+	0x4B,0xCF,0x07,0xB8,0x9E,0x5E,0x10,0xD1,0x12,0x27,0x22,
+	0x91,0x9E,0x0F,0x72,0xC7,0x9B,0xBB,0x05,0x6F,0x4F,0xC1,
+	0x6D,0xD9,0x15,0x46,0xB4,0xCD,0xE9,0xA1,0x9D,0xFE,0x4F,
+	0x93,0xD1,0x69,0x40,0xD4,0x53,0x63,0x20,0x6A,0x5F,0xFB,
+	0x67,0x1A,0x6D,0x3E,0xE6,0x7C,0x7B,0x33,0xE6,0x69,0x7A,
+	0xC3,0x2F,0xC1,0xBF,0x02,0x34,0x0F,0xD4,0xE9,0x19,0x02,
+	0xF9,0xAF,0x0A,0xD7,0x17,0x99,0x1E,0xCB,0x09,0x51,0xAE,
+	0xCD,0x11,0xB2,0x85,0x67,0x98,0xAA,0x69,0x6D,0xCE,0x5F,
+	0x68,0x5D,0xE0,0xDC,0x65,0x10,0x84,0x73,0xBA,0xC0,0xB9,
+	0x87,0x21,0x19,0x5F,0xB0,0xD5,0x9D,0xF9,0x96,0xA3,0xC5,
+	0x11,0x52,0x2D,0x02,0x9E,0x06,0x5F,0xAF,0xE1,0xF4,0x95,
+	0x2D,0x8E,0x7E,0xA6,0xAB,0xDF,0x84,0x36,0x79,0xB3,0x1A,
+	0xAE,0x8F,0xA3,0xC3,0x16,0x3E,0x9A,0x50,0x4D,0xEB,0x66,
+	0x40,0xDD,0xFD,0xDB,0x8C,0xCB,0x88,0x27,0x67,0x46,0x0E,
+	0x59,0x9B,0x30,0x63,0x3A,0xF1,0x59,0x02,0xD1,0xFB,0xD7,
+	0xFE,0x20,0x10,0x2D,0x5E,0x97,0x19,0x88,0xD9,0x7F,0x39,
+	0xBA,0xBC,0xA9,0x7C,0xE1,0x27,0x39,0x3D,0x9C,0x2D,0xFC,
+	0xD1,0x1B,0x4E,0x60,0x79,0xE0,0xCD,0xF2,0x65,0x9F,0xC8,
+	0xBB,0xE5,0xB9,0x81,0xA8,0x99,0xAF,0xD9,0xD8,0xEF,0xDB,
+	0x5E,0xBE,0x6C,0xA7,0xF3,0xED,0xB7,0x6D,0x10,0xAB,0x4D,
+	0x36,0xB2,0x2F,0x07,0x73,0x63,0x0B,0x6F,0x78,0xBD,0xBA,
+	0x26,0x8B,0xD8,0xC2,0xBE,0x37,0xAA,0x2F,0x29,0x2B,0x04,
+	0x8E,0xE2,0xD7,0x6D,0xE1,0x09,0x6F,0x56,0x47,0x7E,0xAE,
+	0x04,0xA2,0xC9,0xFC,0x02,0x58,0x7C,0x90,0x08,0xFF,0xA1,
+	0xA8,0x8A,0xFB,0xC4,0x16,0xFE,0xC0,0x5C,0x4D,0xB9,0x63,
+	0xD4,0xDD,0x45,0x0B,0x3B,0xA9,0xEB,0x48,0x24,0x55,0x57,
+	0x2E,0xE6,0x28,0xCE,0xFE,0x67,0xEE,0xB2,0x64,0x79,0xAE,
+	0xA6,0xFB,0xAE,0xCB,0x21,0x3B,0x2D,0xE4,0x55,0x78,0x64,
+	0xF5,0xF4,0x0B,0x81,0x6B,0x17,0x5C,0x27,0x80,0xF3,0x45,
+	0xB3,0xAE,0x37,0x35,0x4A,0x39,0x88,0xE2,0x89,0x48,0x27,
+	0xD9,0xAA,0xF0,0xE7,0x02,0xBE,0x13,0x84,0xF9,0x63,0xED,
+	0x84,0xB7,0xC0,0x3A,0xEA,0x34,0xEB,0x58,0xDE,0xFB,0x0A,
+	0x06,0x7E,0x3B,0xE1,0xB3,0x85,0xC2,0x13,0x82,0xAB,0x7D,
+	0xD7,0x93,0x7A,0xE6,0xBD,0x0C,0x71,0x6C,0xBC,0x6E,0x8A,
+	0xEB,0xC8,0xF8,0xC2,0xCE,0xF1,0xEE,0xAE,0xF1,0xDC,0xB1,
+	0x48,0x25,0x99,0x51,0x44,0xF8,0x94,0x78,0xD5,0x12,0xB5,
+	0xAA,0xFC,0xC0,0x8C,0x3B,0x08,0xFF,0x23,0xC1,0xDD,0x8E,
+	0x6C,0xB6,0xB6,0x1C,0x2D,0x6C,0xCC,0xA3,0x41,0x77,0x3D,
+	0x5C,0x97,0x0E,0x7A,0xDA,0x11,0xDA,0xF5,0x98,0x7E,0x08,
+	0x63,0x03,0x19,0x89,0x51,0xCE,0x9D,0xB1,0x80,0xF0,0xCE,
+	0x4B,0x1A,0xCF,0x0C,0x7F,0x9E,0x38,0xA2,0xF1,0x03,0xF1,
+	0xC6,0x61,0x81,0x54,0xEB,0x5C,0x47,0x52,0x0B,0x3B,0x53,
+	0xDD,0x5D,0xA9,0xDC,0x31,0x47,0x88,0x0D,0x90,0x3B,0xC1,
+	0x54,0x01,0x26,0xFE,0xEB,0xF3,0xB0,0x4B,0x8E,0x16,0xB4,
+	0x7E,0xE5,0x31,0x5B,0x78,0xD5,0xAD,0xD5,0x8E,0xD0,0xB0,
+	0xF1,0xBB,0xE0,0xBF,0x2F,0x84,0xBF,0x00,0x3F,0xBB,0xCA,
+	0x95,0x26,0xB8,0xED,0x42,0xE1,0xE8,0x0C,0xEA,0x1A,0xAC,
+	0x72,0x0D,0xC2,0xDB,0x80,0x43,0x62,0xAB,0x74,0xC5,0xD0,
+	0x9E,0x4F,0xA2,0x27,0x57,0x2C,0x5B,0x7A,0x6F,0x23,0x71,
+	0x65,0x2B,0x1E,0x13,0xC0,0x08,0xD0,0x67,0x2B,0x37,0x09,
+	0x7D,0xB6,0x70,0x02,0x81,0xDB,0xE4,0x6E,0x5C,0x2C,0x9C,
+	0x84,0xB3,0xBE,0xD0,0x99,0x94,0x6F,0x82,0xB4,0x85,0x88,
+	0x33,0x69,0xB9,0x91,0x5F,0xE4,0x4C,0x9A,0xA7,0xE7,0xD3,
+	0x9D,0x49,0x69,0xBC,0x51,0xF8,0xCB,0x8A,0x46,0xF8,0xCC,
+	0xCE,0xB3,0x93,0x9F,0x7F,0xEE,0x42,0xBA,0x68,0xA1,0xC0,
+	0x45,0x9D,0x67,0x57,0xE9,0x59,0x62,0x80,0x25,0x74,0x5C,
+	0x5F,0xAA,0xEB,0x74,0xAA,0xBB,0x57,0x2D,0x98,0x3C,0xFC,
+	0x78,0xCF,0xBD,0x4B,0x97,0x5D,0xDC,0x8E,0x55,0x37,0x5E,
+	0xD2,0x2E,0xE0,0xEA,0x25,0x23,0x1B,0x0E,0x3F,0xB3,0x0A,
+	0xA7,0x53,0xA1,0x89,0xB8,0x41,0xB5,0x50,0x4B,0xB3,0x02,
+	0xA3,0x8E,0xD3,0x72,0x59,0x95,0xFF,0xBF,0xBA,0xD1,0xB0,
+	0x99,0xD4,0x54,0x4C,0xAD,0x39,0xDC,0xB3,0x6B,0x09,0xE6,
+	0x64,0xFD,0x49,0x93,0x6E,0x57,0x77,0x72,0xB0,0xB3,0x81,
+	0x8B,0xE9,0x48,0x60,0xA6,0x27,0x1D,0x26,0x1A,0x69,0x3D,
+	0x69,0x30,0x21,0x0D,0x4D,0x6E,0xD3,0x9C,0xFF,0x05,0x8B,
+	0x16,0x16,0xD5,0x74,0x27,0x17,0xD5,0x7C,0x62,0x2C,0xAA,
+	0x21,0xBA,0xA2,0x8C,0xAA,0x97,0xA2,0xB1,0x85,0x98,0xB5,
+	0xA8,0x15,0xD9,0x81,0x3D,0xE3,0x82,0x6D,0xFE,0x99,0x0F,
+	0xD8,0x99,0x44,0xDC,0x08,0x3F,0xA4,0x6A,0x57,0x34,0x06,
+	0x37,0x64,0x28,0xC2,0xB9,0x83,0x1E,0x08,0xD4,0x8D,0xF1,
+	0x1F,0x8B,0x61,0xCD,0x25,0x57,0x4F,0xAF,0x2B,0x31,0x44,
+	0x4E,0x92,0x6F,0xA9,0xB5,0x2F,0x61,0x0C,0x99,0x1C,0x9B,
+	0xDA,0x25,0xEC,0xA9,0x6C,0x81,0xFA,0xAE,0xDB,0xD5,0x6D,
+	0x04,0x76,0xFA,0x45,0x50,0x0C,0xB6,0xFD,0x23,0x87,0x66,
+	0x57,0x9F,0x91,0xBA,0xA2,0x4B,0x80,0xE9,0x43,0x72,0xFA,
+	0x83,0xF9,0x15,0xC6,0xF7,0x51,0x2F,0x49,0xAB,0x87,0x24,
+	0x7F,0x6A,0x25,0x3A,0xFB,0x3D,0x3A,0x6B,0xA3,0xEE,0xC1,
+	0x7F,0x54,0xCD,0x16,0x7E,0xD2,0x5A,0x3D,0x63,0x34,0xF1,
+	0x2E,0xAE,0x19,0x4D,0xE2,0x74,0x88,0x8A,0x37,0xA6,0x0E,
+	0xFD,0x2C,0xA6,0x67,0x91,0x2D,0x5C,0x8C,0xF8,0x80,0x0D,
+	0xD9,0x12,0x1F,0xB2,0xC7,0xB6,0x70,0xD1,0xA7,0xB2,0x69,
+	0x89,0xEB,0x8E,0xFC,0xB9,0xF3,0x99,0x97,0x08,0x7E,0xC6,
+	0x99,0x91,0x0E,0x89,0x5E,0xE9,0x3E,0x60,0x22,0xD0,0x87,
+	0x1D,0x91,0x1C,0x28,0x3D,0x47,0x8B,0xFC,0xA1,0xE2,0x1D,
+	0x54,0xBC,0xD1,0x91,0x4D,0xE4,0x2F,0xAA,0xDE,0x8A,0xA2,
+	0x13,0x63,0x65,0x73,0x65,0xBB,0x2D,0x7C,0xA3,0x95,0x69,
+	0xB9,0xDB,0x89,0x1C,0x5A,0xE8,0xC2,0x24,0x61,0x51,0xC2,
+	0x50,0x59,0x69,0x9B,0xE0,0xB6,0x6C,0xEC,0xF7,0x98,0x56,
+	0xB8,0x97,0x1D,0xB0,0x60,0x6A,0x46,0x63,0xE6,0x14,0xAF,
+	0x3D,0xD8,0x89,0x59,0x62,0xD3,0xC5,0x16,0xEB,0x35,0x31,
+	0xB9,0x8B,0xA0,0x52,0x52,0x73,0xB8,0xB9,0xA3,0xF9,0x70,
+	0x73,0x7B,0x21,0xFF,0x75,0xE3,0x42,0x95,0xA4,0x4D,0x31,
+	0xAB,0x90,0x31,0x68,0x9D,0x41,0x08,0x6F,0x5A,0x1F,0x7D,
+	0x20,0xC5,0x63,0x54,0x32,0x07,0xAD,0xB6,0xB0,0x9E,0x2C,
+	0x6B,0x5C,0xB4,0x70,0xA7,0x42,0x6A,0xCC,0x09,0x3B,0xBA,
+	0x93,0xD1,0xB3,0x9C,0xB4,0xEC,0xDE,0xC6,0x11,0x8B,0xD6,
+	0x2E,0xB8,0xAD,0x42,0xA1,0x2D,0xBE,0x68,0xE1,0x05,0x2F,
+	0x44,0x3D,0xB6,0x68,0xC3,0xB5,0x89,0xD5,0xF1,0x45,0xBB,
+	0xB1,0x85,0x47,0x04,0xC7,0x9B,0xE1,0x8B,0x5B,0xA1,0x03,
+	0x1A,0x23,0x27,0xAD,0x34,0xA4,0xF5,0xBB,0xC6,0xDE,0x60,
+	0x5A,0x63,0x57,0xFD,0x7F,0x5D,0xE3,0x76,0xB3,0x74,0x45,
+	0x4E,0x4F,0x63,0xE4,0xBF,0x53,0x68,0x68,0x61,0x5E,0x4E,
+	0x49,0x52,0xDE,0xF4,0xB2,0xC4,0x9C,0x1E,0x28,0xD4,0x65,
+	0x22,0xD3,0x60,0x6B,0x53,0x60,0x13,0xF2,0xEE,0x2F,0x31,
+	0xE6,0x3D,0xEA,0xB5,0xE7,0x3D,0x86,0x7B,0x89,0xD7,0x9C,
+	0x57,0x8A,0x7A,0x4F,0xAA,0xF5,0x96,0xA0,0x5E,0xCD,0x55,
+	0xB8,0xA8,0xF2,0x1B,0x38,0x79,0x2D,0xE6,0x64,0x01,0xFC,
+	0xCC,0xA9,0x88,0xF2,0xAE,0x16,0xDC,0x30,0xDC,0x2D,0xD4,
+	0x0D,0x1D,0x7C,0x9A,0xF5,0xED,0x3E,0x2D,0xB8,0xA3,0x15,
+	0x93,0x82,0x6D,0x39,0x0A,0x53,0xDD,0x7A,0x8F,0x4D,0xE1,
+	0xA2,0x72,0x38,0x78,0x98,0x26,0xD2,0x25,0x7A,0xB9,0x29,
+	0x5E,0x21,0xB1,0x9C,0x8B,0xE5,0x4D,0x85,0x3E,0x49,0xD3,
+	0xA1,0x5C,0xE0,0xCC,0xA0,0x94,0xC9,0xB1,0x56,0xEC,0x9F,
+	0x95,0x83,0x27,0x8B,0xAE,0xA2,0x40,0x97,0xF7,0x73,0xA4,
+	0xCE,0x41,0x87,0x9B,0xED,0x64,0xB8,0x10,0x22,0x7F,0xAB,
+	0x0E,0x49,0xB8,0x0C,0xDB,0x0C,0x82,0xCF,0x4C,0xDD,0x70,
+	0x23,0x4E,0xE5,0x84,0x5A,0xFF,0x5A,0xCE,0x0D,0xE6,0xF4,
+	0x40,0x9D,0x72,0x03,0xCC,0xA1,0xE1,0xFA,0x58,0x13,0x6F,
+	0xB4,0xC2,0x98,0xD3,0x13,0x36,0x28,0x94,0xEB,0xCD,0xE5,
+	0xCC,0x70,0x19,0xC6,0x23,0xC6,0x3F,0x9D,0xCB,0x9D,0xE2,
+	0x53,0x73,0xBD,0x27,0x79,0xAB,0xE0,0x55,0xC7,0xE0,0x65,
+	0x63,0x08,0xF8,0x0E,0x62,0xB2,0x02,0xBE,0x26,0x48,0x7D,
+	0xD0,0x7D,0x50,0xF0,0x36,0x09,0x3E,0xD6,0x0F,0xCD,0xA3,
+	0xF9,0x7A,0x84,0xC2,0x3A,0xDE,0xB9,0xFE,0x3C,0xF1,0x97,
+	0x8D,0xE6,0xA7,0x05,0x7C,0x03,0xA4,0xCC,0xC2,0x67,0x07,
+	0x7C,0xFD,0xA4,0x4C,0xCF,0x67,0xB2,0x7C,0x3E,0x93,0xE5,
+	0xF2,0xE3,0x58,0x1E,0x3F,0x3A,0xE0,0xEB,0x23,0xBC,0xD5,
+	0xEF,0x8B,0x5D,0xC7,0x9B,0xFC,0xBE,0x41,0xE2,0x79,0xA4,
+	0xC6,0xC6,0x6C,0xC3,0x0A,0x9B,0x1A,0x54,0x3F,0xA1,0x96,
+	0xFC,0xA4,0x86,0xF8,0x99,0x19,0x74,0x28,0x34,0xAA,0x0A,
+	0x6F,0x9D,0x91,0xE4,0x5D,0x87,0x21,0xFE,0x25,0x86,0xFF,
+	0xF2,0xEE,0x41,0x8A,0x28,0x17,0x86,0x6E,0x06,0x2B,0xCC,
+	0x04,0x59,0xB8,0x5B,0x48,0x64,0x20,0x36,0x43,0x4F,0xD6,
+	0x8E,0x99,0x31,0x99,0xAC,0xB3,0xCD,0x50,0x95,0x41,0x5B,
+	0x2C,0xD2,0x1D,0x8B,0x5C,0xAB,0xAB,0x49,0x86,0x70,0x9E,
+	0x49,0xAE,0xD6,0x70,0x3B,0x42,0xF2,0xDB,0x91,0x51,0x3A,
+	0xF8,0xBB,0x35,0xCA,0x3A,0x7A,0x98,0x1E,0x95,0x9F,0x53,
+	0xB9,0xCB,0x27,0x06,0xB8,0xA8,0x3E,0xB2,0x0D,0x1D,0x79,
+	0xBE,0x8E,0xBC,0x1F,0x53,0xE5,0x47,0xD8,0x78,0x53,0xCA,
+	0x74,0xB1,0xEC,0x7A,0xDE,0xC1,0xF6,0x42,0x36,0xDE,0x90,
+	0x52,0x36,0x39,0x9E,0xE0,0x27,0x21,0x92,0xCD,0xDD,0x98,
+	0x93,0x52,0x36,0x3A,0x9E,0xE0,0x93,0xE1,0x31,0xE6,0x6E,
+	0x9C,0x96,0xE2,0x35,0xD6,0x73,0x83,0x6C,0xF3,0x84,0x72,
+	0xC7,0x05,0xC6,0xFC,0x4E,0x14,0x50,0xAE,0x07,0x93,0xBB,
+	0x2D,0xE5,0x55,0xEA,0x0E,0x53,0xEE,0x10,0x75,0xB5,0xD1,
+	0xB6,0xD6,0x28,0xBC,0x38,0xA1,0x10,0xFE,0x26,0xAC,0xF6,
+	0x11,0x44,0xC7,0x55,0xDE,0x43,0xB6,0xF0,0xCB,0xE7,0x98,
+	0x1D,0x65,0xE6,0xFF,0x84,0xC0,0xF5,0xD2,0x56,0xE6,0x4E,
+	0xBA,0x8E,0xB5,0x46,0x75,0x22,0x75,0xF7,0x09,0xDC,0x89,
+	0x31,0x70,0x0E,0x10,0x44,0x73,0x5D,0xA9,0xF0,0x17,0xE1,
+	0xA5,0x86,0x69,0x6B,0xEA,0x99,0xE9,0x62,0x49,0x0E,0x7F,
+	0x8D,0xBA,0x61,0x73,0xBC,0x24,0x5B,0xBB,0xF3,0xE3,0x18,
+	0x65,0x5C,0x67,0x49,0x86,0x76,0xE7,0xCD,0x8C,0x40,0xAE,
+	0xA7,0xC4,0x04,0x49,0x8B,0xFC,0xED,0x1B,0x46,0xA5,0xDC,
+	0xC7,0x42,0x3B,0x91,0xD6,0xD2,0x86,0x48,0x79,0x4C,0x9D,
+	0x86,0x2B,0x1C,0xA1,0xA9,0x8C,0xDE,0xBE,0x1A,0x42,0x2E,
+	0x63,0xE4,0xF7,0xAB,0x09,0x8C,0x66,0x00,0x89,0xF1,0x6D,
+	0x54,0x04,0xC9,0x82,0xAF,0x8F,0xE9,0x84,0x81,0xC8,0xA2,
+	0x18,0x53,0x13,0x8E,0x7E,0x39,0x91,0xDD,0x77,0xE9,0x88,
+	0x4B,0xF1,0x9A,0xC3,0x7F,0x1A,0x5C,0xE1,0x3E,0xA0,0x27,
+	0xE4,0x85,0xA2,0xE7,0x93,0x42,0x1E,0xFD,0xD9,0x63,0xCF,
+	0xE1,0x66,0x3C,0xDB,0x6D,0xD8,0x77,0x0F,0x2E,0xCD,0x8D,
+	0x91,0x72,0x32,0x7F,0xCD,0x43,0xAB,0xB3,0x96,0xDC,0xEF,
+	0x79,0xF0,0x89,0x9F,0x66,0xCD,0xB9,0x7E,0xCE,0xD4,0xA9,
+	0x0E,0x67,0xD6,0x42,0x7E,0xF5,0x75,0x77,0x3F,0xFA,0xD3,
+	0x87,0xB2,0x4A,0x7F,0x51,0xEA,0x79,0xE8,0xA7,0xD3,0xB2,
+	0x8A,0x9E,0x28,0xF1,0x3C,0xFA,0xC4,0xEA,0xD2,0xAC,0x39,
+	0x4F,0xAC,0xF9,0x45,0xC9,0xA3,0x0F,0x3F,0xE2,0xC9,0xBA,
+	0x66,0xCE,0x94,0xAC,0x45,0xBF,0x78,0xE0,0xFE,0xD2,0x87,
+	0x7E,0x98,0x75,0xC7,0xEA,0x07,0xA7,0x65,0x39,0xA6,0xFF,
+	0xE8,0x47,0xD7,0xDD,0x90,0x93,0x73,0xC3,0xB4,0x6B,0xAF,
+	0xBD,0x36,0xAB,0x70,0xF1,0xBC,0x79,0x59,0xF7,0x97,0x96,
+	0x3E,0xFA,0xF0,0xEA,0x9F,0x3E,0xB4,0xDA,0x93,0xB5,0xEA,
+	0x21,0xCF,0x43,0x0F,0x7A,0x1E,0x5A,0x45,0x0A,0x9F,0xF0,
+	0x64,0x3D,0xB4,0xFA,0x09,0xFE,0xE1,0x47,0xB2,0x7E,0xFA,
+	0xD0,0x4F,0x9F,0x28,0xF9,0x05,0x79,0xF0,0x89,0xD5,0x24,
+	0xD9,0x72,0xFE,0x63,0x4C,0x74,0xED,0xCE,0x77,0x33,0x02,
+	0x62,0x8A,0xBF,0xBB,0x37,0x9B,0x66,0xFE,0xC4,0x9E,0x5D,
+	0x99,0x59,0x6C,0x37,0x1C,0xD1,0x72,0x82,0xCD,0x42,0x37,
+	0x72,0x57,0xDB,0x85,0xD6,0xE6,0x13,0xDA,0xBF,0x6C,0xFF,
+	0xCC,0xC7,0x20,0x62,0xB3,0x04,0x9B,0x9E,0x54,0x86,0xA6,
+	0xEE,0xCB,0x6D,0x2E,0x49,0xDE,0xA9,0x23,0x35,0xFB,0xC7,
+	0x54,0x1E,0x80,0x54,0x5F,0x9D,0x58,0x19,0x12,0xDA,0x9B,
+	0xBB,0xB5,0x7F,0xBC,0x61,0x67,0x4C,0x01,0x82,0x55,0x76,
+	0xA1,0xDD,0xD0,0x96,0xBD,0xA9,0xD8,0x1E,0x0C,0x4D,0x6D,
+	0xDB,0x7E,0xA7,0x74,0x45,0xE5,0xD1,0x60,0xC3,0xEE,0xF5,
+	0xA4,0xE2,0x2E,0xE5,0x77,0x64,0xF0,0xC3,0xAC,0x33,0x1F,
+	0x54,0xF1,0x0A,0xB4,0x5B,0xB0,0x2E,0x5B,0x98,0x09,0x22,
+	0xE8,0xCC,0xA7,0x41,0x89,0xA9,0xDC,0xEE,0x31,0xDC,0x7A,
+	0x66,0xCB,0xB5,0xA1,0xF7,0x3F,0x24,0xEF,0xCF,0xDF,0x9E,
+	0x23,0x5D,0x91,0xFD,0xCE,0x23,0xF6,0xEC,0xF2,0xEC,0x47,
+	0xED,0xC2,0x67,0x79,0x86,0x92,0x7B,0x82,0x99,0x3F,0x24,
+	0x53,0xFB,0xFF,0x9B,0xE8,0x04,0x63,0x72,0x56,0xD6,0x0C,
+	0x8C,0x71,0xF4,0xFA,0xB5,0xFA,0x1F,0xDD,0xCC,0x5F,0xED,
+	0x5F,0x6B,0x9C,0xC1,0x5F,0x11,0x90,0x74,0xF2,0xC4,0x19,
+	0x3F,0x29,0xE6,0x27,0x08,0xF9,0x7A,0x2B,0x2A,0xCC,0xE0,
+	0xED,0x15,0xF9,0x46,0x6B,0x56,0xDE,0x6A,0x3E,0x71,0xFD,
+	0x5F,0x94,0x58,0xA0,0x3E,0xC1,0x9F,0x47,0x7E,0xCD,0x47,
+	0x71,0xE5,0x77,0xFC,0x9A,0xE3,0x70,0xDF,0xC2,0x47,0x83,
+	0xED,0xC2,0x57,0xD4,0x59,0x61,0xAF,0x34,0x55,0xDA,0x85,
+	0x23,0xC2,0xDE,0x77,0x3C,0xF6,0xAC,0xEC,0xA0,0x9D,0x82,
+	0xB6,0x8F,0xDF,0xCD,0x40,0x20,0x3F,0xF5,0xB3,0x0F,0xC9,
+	0x99,0xF7,0x03,0x33,0xBD,0xE0,0xC5,0xB8,0x9A,0xEE,0xF4,
+	0xCD,0x5E,0x7B,0xA5,0xED,0xE7,0xF6,0xCD,0x4F,0xE2,0xB6,
+	0xD6,0xBE,0xD9,0x87,0x9B,0xDF,0x7E,0xE3,0xDF,0xE0,0x37,
+	0xD5,0x1C,0x4B,0xDF,0xFC,0x14,0x1E,0x37,0xD8,0x6B,0x14,
+	0xB6,0xEE,0x27,0x27,0xD9,0xC2,0x3B,0x2C,0xD5,0x45,0x6C,
+	0xB4,0xED,0x83,0x55,0x33,0x09,0x09,0xD6,0x7D,0x6C,0x27,
+	0x35,0x3A,0xDD,0x99,0xDF,0xDC,0xE3,0xC9,0x15,0xDA,0x6A,
+	0x7E,0x0D,0x56,0x7E,0x72,0xD5,0xD8,0x45,0x45,0x0B,0x2B,
+	0x3F,0x0B,0x1E,0xDD,0xD1,0x31,0xA6,0x46,0x37,0x43,0xBA,
+	0x42,0x68,0x9B,0xB4,0x4C,0x38,0x3D,0xF8,0x6B,0xD0,0x79,
+	0x5E,0x38,0x38,0xF5,0xC0,0x1D,0xDB,0x67,0x4B,0x57,0xA0,
+	0xF8,0xE8,0x98,0x8F,0xF5,0x84,0xA5,0xEF,0x51,0x31,0xFA,
+	0x67,0xBA,0x60,0x1B,0x93,0x8B,0xDE,0x5E,0x62,0xDF,0x7E,
+	0xD5,0xDE,0x8C,0x7B,0xEC,0x28,0x80,0xEB,0x40,0x76,0xA4,
+	0x40,0x13,0x18,0x92,0xAA,0xEF,0xD9,0x3E,0x4F,0xBA,0xA2,
+	0x48,0x5D,0xE1,0xF7,0x88,0x8D,0xCC,0xDC,0xC4,0x35,0xBA,
+	0x5E,0xCD,0xDB,0xB5,0x2C,0xC9,0x9F,0x4D,0x93,0x06,0x68,
+	0xAD,0xDF,0x46,0x93,0x8C,0xC1,0xC3,0x81,0xB5,0x16,0xC2,
+	0x67,0xA8,0x65,0x8E,0xD0,0xE6,0x55,0x69,0x9B,0x8B,0xD3,
+	0x54,0x05,0xC5,0x8C,0x0F,0x8C,0xB5,0x2D,0xBC,0x29,0xB9,
+	0x9A,0x36,0xC0,0x04,0xFD,0x4C,0x7D,0xBA,0x5D,0x8F,0x27,
+	0xEA,0x8A,0xC1,0x2E,0x19,0xA1,0xCE,0xDD,0x41,0x77,0x8C,
+	0xF2,0xAA,0x37,0x71,0x97,0x09,0x3A,0x25,0xE3,0xBE,0xB4,
+	0x4D,0x0F,0xA4,0xB1,0xCC,0xB9,0xAC,0x3F,0x9A,0x8E,0x3C,
+	0x2E,0x46,0x67,0xDE,0x97,0xB6,0x19,0xD9,0x87,0xE9,0x5A,
+	0x13,0xCD,0x37,0x0B,0x6B,0x51,0xB5,0x61,0xAE,0x99,0x90,
+	0x86,0xB9,0x16,0xB0,0xE7,0xF0,0xDE,0xB5,0xA6,0xFA,0xB9,
+	0x76,0x2D,0x11,0xA8,0x1F,0xDD,0x30,0xD7,0x4A,0x48,0xE4,
+	0x41,0x45,0xB6,0x33,0xC1,0x5B,0x3E,0x4A,0xB3,0x9E,0xFF,
+	0xD7,0x28,0x3F,0x0F,0x17,0xAA,0x3B,0x59,0x16,0x2E,0x0C,
+	0xCA,0xB8,0xCD,0x40,0xC5,0xD6,0x6E,0x9D,0xE8,0xD8,0xDF,
+	0xDC,0x8D,0x0E,0xD7,0x8B,0xCB,0x92,0x54,0x6F,0x44,0xC8,
+	0x78,0x20,0x4D,0xC8,0xBC,0x2F,0x4D,0xA5,0xB3,0xC3,0x93,
+	0x8B,0x09,0x4F,0x14,0xD6,0xE9,0xF7,0x96,0x19,0x29,0x17,
+	0xAB,0xC8,0x4F,0x02,0xE6,0xAD,0xB3,0x79,0xE3,0x56,0xB3,
+	0x27,0x95,0xF6,0xC2,0x39,0x98,0x19,0xCE,0xB7,0xDD,0x2A,
+	0x80,0xEE,0xA8,0xFC,0x69,0xAE,0x77,0xB0,0xA4,0x6F,0x7D,
+	0x6C,0x7B,0x52,0x29,0xAC,0x8C,0xDC,0x45,0xF7,0x0D,0x31,
+	0x44,0xAC,0x49,0x20,0xE1,0xF5,0x4A,0xA3,0x23,0x14,0xFE,
+	0x77,0x25,0x72,0xC6,0x46,0x43,0x0B,0x5C,0x2C,0x0E,0x06,
+	0xF2,0x89,0xC2,0x3C,0xC4,0xC1,0x57,0xA4,0x54,0x07,0xDB,
+	0x95,0x7C,0xAB,0x7B,0x69,0x63,0x9C,0x40,0x13,0xCA,0x5D,
+	0x31,0x7A,0x34,0xD8,0xBE,0x77,0xB9,0x49,0x28,0xB0,0xCE,
+	0xD0,0x11,0x8F,0x55,0xB5,0x83,0x5B,0x48,0x43,0x81,0x55,
+	0x07,0x7B,0x17,0x13,0xF2,0x2D,0xC2,0x72,0x53,0x4E,0x8F,
+	0x7F,0x95,0xE5,0xB3,0xC9,0x39,0xC1,0xE5,0x66,0x0A,0x6B,
+	0x59,0x60,0x11,0x96,0xC0,0x60,0xF2,0x36,0x8C,0xC0,0x22,
+	0x00,0x45,0x2F,0x68,0x7C,0x2E,0x05,0xD5,0x1B,0xB8,0x41,
+	0x42,0xFA,0xF3,0x93,0x8C,0x9E,0x64,0xFF,0xAA,0xA4,0x28,
+	0x1E,0x75,0xC4,0x3F,0x2F,0x49,0x07,0x21,0x28,0xAA,0x99,
+	0x33,0xB6,0x08,0x95,0xE1,0x5C,0xD2,0xF3,0x70,0x2F,0xD1,
+	0x28,0x7C,0x16,0x96,0x5F,0x0C,0x30,0xC3,0xA4,0xCE,0x4B,
+	0x2F,0x6B,0x53,0xD9,0x8E,0x06,0x46,0x5B,0xF8,0x57,0xC6,
+	0x6A,0xE4,0xF5,0xE7,0x23,0xFA,0x32,0xC0,0x6A,0x30,0x5A,
+	0xB8,0xE8,0xA8,0x7C,0x0B,0x42,0x7B,0xD5,0xC3,0x32,0x12,
+	0x98,0x94,0x3E,0xD5,0xEF,0x39,0xD6,0xDC,0xDC,0xDC,0xDA,
+	0xDC,0xC4,0xFC,0x9E,0x45,0x0B,0x68,0xF3,0xC6,0x16,0xCF,
+	0xD4,0xF5,0xD1,0xEE,0x64,0xCF,0x35,0x2C,0xE2,0x9C,0x96,
+	0x59,0xAD,0x4A,0x50,0xAE,0xCD,0x6D,0xF7,0x8C,0x09,0x1E,
+	0x76,0x74,0x40,0xF3,0x60,0x08,0xC1,0xDA,0xEC,0x5C,0xD3,
+	0x7D,0xF6,0xB2,0x24,0x08,0x93,0x2D,0xFC,0xD0,0xA4,0x6A,
+	0xDC,0x83,0x87,0x37,0xDF,0x67,0x5F,0xCA,0x1C,0xA1,0x38,
+	0x8B,0xCC,0x6C,0xA3,0x1B,0x36,0xED,0x49,0x32,0xE3,0xB8,
+	0x52,0x36,0x90,0x60,0x80,0xAF,0x0A,0x85,0x3C,0xC3,0x44,
+	0x4A,0xEE,0xD7,0x2C,0x15,0x54,0x3E,0xB0,0x78,0x1F,0x11,
+	0x80,0x7E,0xE3,0x7E,0xCF,0x4F,0x99,0x64,0x1D,0x70,0x74,
+	0x60,0xA2,0x7B,0x29,0xB2,0x6C,0xE1,0x9E,0x89,0x18,0x23,
+	0x90,0x2C,0xA0,0xA7,0xE9,0x3E,0xF0,0xE9,0xFC,0x24,0x3C,
+	0x1C,0x86,0xDC,0xD0,0xC2,0x28,0xA8,0x81,0x53,0x30,0x28,
+	0xCC,0xB5,0x04,0xEB,0x68,0x61,0x4C,0x23,0x68,0xE5,0x5E,
+	0xDF,0xA0,0x70,0x97,0x51,0xDE,0xD6,0xC0,0x0D,0x98,0x88,
+	0xFC,0x0A,0x62,0xBF,0xFD,0xF4,0x80,0x3A,0x68,0x90,0xE6,
+	0x08,0x09,0xB6,0xE5,0x76,0x90,0x29,0x3F,0x27,0x3B,0x18,
+	0x0F,0xDF,0xCC,0x82,0xF7,0x44,0x6B,0x81,0xF4,0x1A,0x75,
+	0x1E,0x26,0x5F,0xA1,0x4E,0xE1,0x7D,0x0A,0x26,0xC7,0xAE,
+	0xE6,0xFC,0xBB,0x85,0x11,0xE0,0x31,0x60,0xDC,0xB4,0x4D,
+	0xDE,0x2E,0x67,0xAB,0x94,0x07,0x66,0x2E,0x87,0xFE,0x48,
+	0xA4,0x19,0xCB,0xED,0x91,0x3B,0x94,0xBD,0xEE,0x41,0xBA,
+	0xC4,0x18,0x6C,0x77,0x74,0x80,0xCB,0xB4,0x40,0x1F,0x71,
+	0x2A,0xC1,0x76,0xF4,0x12,0xF9,0x99,0x02,0x5E,0xD0,0x7A,
+	0xD0,0xD7,0x96,0xBD,0x77,0x62,0xB6,0xB0,0xD6,0x9A,0xBB,
+	0xCE,0x58,0x9A,0x21,0xCC,0xAA,0x5A,0xAC,0x13,0xE6,0xEB,
+	0xE9,0xD8,0xE0,0xE1,0xF2,0x84,0x6C,0xC8,0x15,0xA8,0x6B,
+	0x6C,0x28,0x30,0x29,0x8A,0xFC,0xF5,0x05,0xEE,0x35,0xD0,
+	0x43,0x82,0xCB,0x8A,0xA5,0x41,0x08,0xBC,0x49,0x70,0xEE,
+	0xC7,0x90,0x04,0x2C,0x81,0xA2,0x1A,0x61,0x3C,0x6D,0x2D,
+	0x62,0x5B,0x46,0xA3,0xAB,0xB8,0x01,0xB8,0xB4,0xF0,0x7E,
+	0x6C,0xE1,0xBF,0x26,0x57,0x07,0x3B,0x75,0x0D,0xF5,0x09,
+	0x44,0x1B,0xEE,0x01,0x33,0x59,0x74,0x21,0x8E,0x1C,0x8A,
+	0x20,0xDD,0x36,0x84,0x4C,0x16,0xB4,0x04,0x6A,0xB4,0x54,
+	0xBD,0x52,0x41,0x61,0x4E,0xE9,0xBD,0x8D,0x43,0x5D,0x5B,
+	0x58,0xD7,0x14,0x32,0xE3,0xB6,0xAA,0x56,0x1B,0xB3,0x16,
+	0xAD,0x51,0x89,0x50,0xBB,0x76,0x0D,0x0C,0xF5,0xDD,0x0F,
+	0x0C,0xAA,0xD4,0xDA,0xC2,0x8F,0x42,0x9B,0xD4,0xE5,0x72,
+	0xB1,0x92,0x24,0x26,0x92,0xBC,0x8D,0x36,0x45,0xCA,0x94,
+	0x38,0x3D,0xF2,0x49,0x18,0xEC,0xC8,0x23,0xCA,0x3F,0x49,
+	0x4E,0x99,0x12,0x59,0xAD,0x2C,0xDA,0x09,0x3E,0x77,0x68,
+	0x61,0x81,0xD1,0x11,0xBA,0xB7,0x71,0x61,0xD1,0x70,0x04,
+	0x50,0x83,0xD0,0x6B,0x8F,0x11,0x59,0x10,0x04,0x61,0x4F,
+	0xB0,0x7D,0xAA,0xE9,0x27,0xF6,0x65,0x8D,0xFF,0x5C,0xD4,
+	0xEC,0x9E,0x14,0x77,0xC0,0x31,0x31,0x9D,0xF4,0xB3,0x9D,
+	0xBE,0xA4,0x8F,0x55,0x2D,0xF4,0xA2,0x41,0x4B,0xD6,0x54,
+	0x8C,0xA2,0xCC,0x1E,0x6E,0x88,0x3F,0x43,0x12,0xC1,0x5B,
+	0xAF,0xA1,0x7A,0xA5,0xBB,0x31,0x72,0x45,0x54,0xD5,0x0C,
+	0xB5,0xF4,0x10,0x6A,0x2C,0x57,0x98,0x5C,0x60,0xE2,0xA0,
+	0x47,0x4E,0xE3,0xD9,0x18,0x45,0x7A,0x48,0x7F,0xA5,0x09,
+	0x5E,0xAB,0xE0,0xB3,0xD3,0xBA,0xE0,0x61,0x21,0x91,0x72,
+	0x27,0x85,0x02,0x3D,0x9C,0x5C,0xA1,0x00,0x5A,0xAA,0x57,
+	0x28,0x30,0xC1,0x57,0x15,0x0A,0xCC,0x8C,0xB9,0x58,0x4B,
+	0xEE,0xD1,0xCC,0x27,0x9A,0x8B,0xCC,0x68,0x65,0xB3,0x90,
+	0x50,0xC5,0xFC,0xE1,0x41,0xDA,0x64,0x0B,0xFF,0x29,0x13,
+	0xAB,0xD8,0x26,0x70,0x27,0xA9,0x51,0xE0,0x4E,0xC1,0x85,
+	0x65,0xBE,0x55,0xBE,0x91,0x39,0xB4,0xF9,0xEC,0xC5,0x12,
+	0x53,0xB9,0xF0,0x71,0xA0,0x65,0xB8,0xD8,0x55,0x3A,0x42,
+	0xF3,0xAD,0xC0,0xC5,0x44,0x70,0x2E,0x4A,0x07,0x69,0x02,
+	0x6B,0xA9,0x6A,0x38,0x88,0x82,0x1A,0x19,0xA9,0x6B,0x12,
+	0x22,0x53,0xC9,0xF6,0x1F,0x5E,0xC8,0xCC,0xA8,0x72,0x0D,
+	0x2C,0xD4,0xE2,0x55,0xB6,0x18,0x6E,0x63,0x62,0x80,0xCA,
+	0x46,0x32,0xC2,0xB8,0xD0,0x06,0x75,0x22,0x1C,0xFB,0x05,
+	0xA7,0xA6,0x78,0xA9,0x17,0xBA,0x24,0x86,0x15,0xC3,0xD4,
+	0xEF,0x35,0xC1,0x36,0x68,0xDE,0x8D,0x6B,0x2D,0x3C,0xBA,
+	0x8E,0xED,0xBD,0x99,0x9E,0xA9,0x74,0xC7,0xE4,0xA3,0xB7,
+	0x42,0x8B,0xD9,0x3D,0x7F,0x53,0x15,0x70,0x78,0x0C,0xA9,
+	0x96,0x8F,0x5D,0xD0,0xB5,0x8D,0x90,0x05,0xF9,0xAD,0x91,
+	0x4A,0x02,0x7A,0x34,0xD8,0x3E,0xA4,0xFC,0xE0,0x38,0x44,
+	0x9E,0x21,0xB0,0x17,0x58,0xD7,0xC2,0x62,0xB3,0xDA,0x4F,
+	0x8B,0x67,0x0E,0xB0,0x43,0x8B,0x7E,0x89,0x0A,0x59,0xBC,
+	0x53,0xC8,0x37,0xBE,0x4A,0x5B,0x47,0x89,0x9E,0x0C,0xDA,
+	0x4C,0xC5,0x1D,0x3A,0x72,0xF6,0xB0,0x90,0x6F,0x3D,0xDB,
+	0x11,0x38,0xCC,0xEC,0x74,0xC7,0xE5,0x81,0xA8,0xC2,0xA7,
+	0xCE,0x50,0x14,0x95,0x28,0x20,0x56,0x14,0xFF,0x3C,0x4B,
+	0x16,0x23,0x90,0xA1,0x35,0x0B,0x8B,0x2D,0x2C,0x3F,0xDF,
+	0x88,0xD5,0x64,0xA4,0x77,0xEB,0x55,0x81,0x1D,0x05,0x35,
+	0xDE,0x5F,0x60,0xD3,0xF1,0x0F,0x33,0xD6,0xC5,0xF5,0x05,
+	0x54,0x2A,0xBA,0x44,0x1C,0x24,0x5E,0x4A,0xD0,0x47,0x4C,
+	0xE5,0xBA,0x06,0x98,0x42,0x5F,0x6B,0xDC,0xA8,0x78,0xDE,
+	0x51,0x91,0xBC,0xC1,0x14,0x2D,0x73,0x8F,0xA3,0x34,0x0A,
+	0x8A,0x6C,0x61,0x7A,0x39,0xDB,0xB1,0x03,0x25,0x63,0x58,
+	0x7D,0x6E,0x90,0xD1,0xA1,0x73,0x0D,0x4C,0xF9,0x42,0x6E,
+	0x94,0x33,0x80,0xEA,0x4C,0x8D,0x15,0x6B,0x27,0x49,0x5F,
+	0x3D,0x44,0xA8,0xFC,0x27,0xD5,0x6E,0x58,0x31,0x8E,0xF7,
+	0x2F,0x47,0x43,0x70,0x63,0x35,0xD3,0x72,0x6C,0xF5,0x6C,
+	0xFF,0x37,0xE9,0x0A,0xDA,0x56,0x59,0x07,0xC1,0xA7,0xED,
+	0x99,0xC1,0xC3,0xDB,0xAF,0x92,0xAE,0x98,0xB4,0x6C,0x78,
+	0xD5,0x22,0xDA,0xA6,0x9D,0x71,0xF3,0xBD,0x06,0x73,0xF3,
+	0x18,0x70,0x3C,0x7E,0x39,0xAD,0x5D,0xEF,0x1B,0xE8,0x4E,
+	0x66,0xC3,0x8A,0x32,0x6D,0x09,0x79,0x69,0x87,0xA5,0xC4,
+	0x93,0x2D,0xFC,0xC7,0x4C,0xF6,0xFE,0xE5,0x71,0x55,0xCF,
+	0xDD,0x1E,0x55,0xCD,0x3F,0x6D,0xA2,0xBE,0x41,0x15,0x89,
+	0xE2,0xB9,0x0F,0xC1,0x97,0xE0,0x1A,0x08,0x86,0x50,0x39,
+	0x33,0xD8,0xCE,0x5E,0xEA,0xA5,0xEE,0x3F,0xB3,0x65,0x12,
+	0xDB,0xF9,0x3A,0x07,0x2E,0x31,0xE3,0xA5,0x32,0xAA,0x51,
+	0x4E,0xA2,0x6D,0xEA,0x0A,0x90,0x4F,0xC9,0xF0,0x92,0x7E,
+	0x7F,0x0E,0x11,0x2D,0x22,0xF7,0x3F,0xA3,0x21,0x10,0xA0,
+	0x64,0x57,0x26,0x13,0x69,0x57,0x2C,0xE0,0x8B,0x11,0x7E,
+	0x8F,0x6A,0xB4,0xA8,0xFC,0x89,0x46,0x99,0x95,0x51,0x76,
+	0xC0,0x16,0x2E,0xC8,0xAC,0x96,0xFF,0x53,0x6B,0x41,0x1B,
+	0xD1,0xA6,0x22,0x53,0x7E,0x6D,0x84,0x2E,0x44,0x67,0x9D,
+	0xB4,0x70,0x10,0xBE,0x04,0xB3,0xB7,0x71,0x23,0xCA,0xA6,
+	0xE2,0xFE,0xA0,0x7B,0xB0,0x81,0x8B,0x6A,0xA6,0x93,0x77,
+	0x53,0xDF,0x80,0xA3,0x05,0x4C,0xAC,0x48,0xC8,0xE9,0x01,
+	0x27,0x46,0x0B,0x85,0x83,0xF4,0x4C,0x01,0x8B,0xDB,0x12,
+	0xD9,0x44,0xB0,0x1D,0x58,0x5F,0x94,0x78,0x26,0xA0,0x15,
+	0xA6,0xF7,0x1C,0xB3,0x97,0x18,0x6F,0x92,0x26,0xAB,0x0F,
+	0x7F,0x83,0xF9,0xC2,0x63,0x02,0x8D,0x4E,0x05,0x19,0x4D,
+	0xEA,0xF8,0x1A,0xA1,0x03,0x40,0xDF,0xDF,0x12,0xAB,0xE5,
+	0x17,0x59,0x13,0x74,0xA6,0x1A,0x66,0xBD,0xFC,0xC2,0x8C,
+	0x5B,0xC9,0x5A,0xF3,0x8C,0x65,0x64,0x9D,0x21,0x21,0x8B,
+	0x34,0xC6,0x4D,0x03,0x62,0x77,0x8F,0x11,0x3A,0xAA,0x71,
+	0x7B,0x92,0x1A,0xBB,0x13,0x29,0xB5,0x71,0x61,0x45,0x57,
+	0x45,0x9F,0x94,0xC1,0x5B,0xFC,0xC7,0x53,0xFC,0x31,0x1D,
+	0xAF,0x9F,0x1A,0x5A,0xD6,0x28,0x8D,0x6E,0x44,0xB6,0x28,
+	0x8D,0xAD,0xD8,0xB3,0x9D,0x68,0xC9,0x34,0xA6,0xC6,0x68,
+	0xAD,0x2D,0x5C,0x0B,0xC9,0x11,0x83,0xED,0x34,0x85,0x2D,
+	0x99,0x45,0x6C,0xE7,0xE8,0x37,0x97,0xB3,0x8C,0x86,0xC4,
+	0x64,0xB2,0x2C,0x9E,0xF3,0x66,0x3C,0xC7,0x36,0x9C,0x23,
+	0xA8,0x39,0x58,0x61,0x0D,0x89,0xA3,0x88,0xB6,0x29,0x01,
+	0x64,0x33,0xC3,0x4F,0x5E,0x2E,0x6F,0x9B,0xAB,0xBE,0x02,
+	0xD7,0x0C,0x6F,0xE6,0x6B,0xE9,0x82,0xED,0x8D,0xF4,0x4D,
+	0x6F,0xA5,0x37,0x98,0x5E,0xB2,0x93,0x2C,0x5B,0x78,0x79,
+	0x37,0xDB,0x43,0x59,0x76,0xF9,0xD2,0x7B,0x57,0xDC,0xD5,
+	0xA8,0x2A,0x6A,0x38,0x17,0xB3,0x10,0x4D,0xAB,0xA6,0x41,
+	0xCC,0x54,0xC6,0x4E,0x92,0xFB,0x16,0xA9,0xD9,0xCC,0xD7,
+	0x2F,0xD0,0x67,0x0B,0x63,0x31,0x01,0xA3,0x54,0x66,0x9D,
+	0x5C,0x81,0x1A,0xD9,0xCA,0x24,0x56,0x25,0xAE,0x3A,0x68,
+	0x6D,0x66,0xB8,0xE8,0xEB,0xDD,0xA6,0xD4,0x9D,0xA7,0xEC,
+	0x34,0x56,0xBE,0x6F,0xFD,0x79,0x53,0x6A,0x69,0x86,0x7F,
+	0x96,0x9E,0x4F,0x08,0x88,0x26,0xB9,0xF7,0x96,0x02,0x5D,
+	0x49,0x3F,0xED,0x44,0x18,0x2B,0x7F,0xB9,0x3E,0x66,0x4A,
+	0xF5,0x8C,0xAD,0xCA,0xD7,0x33,0x5F,0xDE,0x1C,0xF6,0x2B,
+	0xF5,0x46,0xBD,0xDC,0x50,0xD9,0x1E,0x0E,0x2A,0x72,0xDF,
+	0xA4,0x61,0xC5,0x11,0xD7,0x19,0xC0,0x5C,0x2E,0x85,0xFB,
+	0xFA,0xCA,0x9B,0x77,0x8F,0x4E,0xDD,0x69,0x4A,0x05,0xF6,
+	0xF0,0xFA,0xF3,0xA3,0x2F,0xC5,0x5E,0x76,0x01,0xFB,0xE8,
+	0x54,0x4F,0xE6,0x2D,0xF3,0x74,0xA5,0x09,0x0C,0xAF,0x14,
+	0xEF,0x27,0x21,0x3C,0x4E,0x91,0x4F,0xA1,0x93,0x29,0x8A,
+	0xFC,0xD7,0x49,0x43,0x2B,0x9E,0x88,0x1A,0x9B,0x16,0xAA,
+	0x3B,0x58,0xFE,0x74,0x6D,0x13,0xAF,0x3C,0x5D,0x73,0xBC,
+	0x15,0x67,0xB9,0x5D,0xC8,0xAC,0xB0,0x0B,0xB6,0x4A,0xBB,
+	0xE2,0x7C,0xDA,0xBE,0xE9,0xED,0x74,0x5B,0x38,0x87,0xA8,
+	0x1A,0x72,0x73,0x65,0x3A,0xCD,0x08,0xA6,0x6F,0x2A,0x4F,
+	0x17,0x32,0x9E,0x4A,0xDF,0x5C,0x91,0xBE,0xF9,0x2D,0x64,
+	0x3C,0x9D,0xBE,0xC9,0x8F,0xDB,0x1B,0xE9,0x9B,0x37,0xA4,
+	0x6F,0x7E,0x2D,0x7D,0x99,0xCA,0x5E,0xD6,0x05,0x7B,0x19,
+	0x6C,0x13,0x7C,0x26,0xB6,0xD3,0xE1,0x3E,0x4D,0x0B,0xFB,
+	0xAA,0x5C,0xA7,0x32,0x1C,0xA1,0x85,0x42,0xA1,0xB9,0x88,
+	0x9E,0x67,0xAF,0x9C,0xC3,0x21,0x42,0xEB,0xA0,0xF7,0xA7,
+	0xC0,0xA7,0x4F,0xD0,0xC3,0x77,0xBA,0x8D,0x9D,0xEA,0x68,
+	0xEE,0x6A,0xEE,0xA2,0x9D,0x09,0x46,0xA2,0xAB,0xE7,0x02,
+	0xC7,0x63,0xB7,0xD2,0x5E,0xCD,0x8B,0x6E,0xD5,0x41,0x17,
+	0x41,0xDE,0xA7,0x39,0xFA,0x1D,0x21,0xEA,0x1D,0xC0,0xBC,
+	0x5C,0xCF,0x04,0x9D,0x9F,0xB2,0xD7,0x6D,0xA1,0x89,0x7B,
+	0x99,0x1D,0x19,0xA0,0x37,0xC3,0x3B,0xC1,0x12,0xAB,0x2A,
+	0x1E,0x5C,0xE9,0x5E,0x71,0xD7,0x01,0x2B,0x51,0xD7,0xFE,
+	0x3C,0x04,0xCC,0x51,0xB9,0x3E,0xE8,0x36,0xD3,0x58,0xB0,
+	0x4E,0xDB,0x32,0x59,0x32,0xFC,0x0E,0x1F,0x79,0xED,0x50,
+	0xB4,0xBA,0xCE,0x2A,0xF7,0x29,0x6A,0x5C,0x84,0x78,0x7C,
+	0x21,0x4C,0x51,0x55,0xBE,0x31,0x4E,0xE6,0x78,0x32,0x9B,
+	0x36,0x34,0xFF,0xB5,0xF9,0xAF,0xC1,0x76,0xDD,0xD9,0x86,
+	0x04,0x28,0x55,0xD7,0x40,0xC3,0x5C,0x04,0xD2,0xF2,0xC6,
+	0x85,0xC3,0xEB,0x97,0xD9,0xC1,0x42,0xAB,0xAA,0xE4,0x2B,
+	0x12,0xF3,0xB2,0x78,0xC3,0x1C,0xF9,0x6C,0xDE,0x28,0xCF,
+	0xB9,0x0D,0x21,0x4F,0x4E,0x4E,0xC8,0x3F,0xEB,0x4A,0x4F,
+	0x16,0x75,0x0F,0x54,0xBA,0xA3,0xB0,0x1F,0xB4,0x33,0xC8,
+	0xC5,0x90,0xC5,0x8E,0x1F,0xF0,0xE9,0x73,0x36,0x40,0xCA,
+	0x3E,0xD4,0xCB,0xA7,0x3E,0xD4,0xCD,0x91,0x3B,0x72,0x42,
+	0xF2,0x5F,0x22,0xAF,0x91,0x3C,0x1D,0xEF,0x64,0x2F,0x4B,
+	0xD5,0x9D,0x18,0xB7,0xE0,0x1B,0x54,0xFB,0xAF,0x35,0xF8,
+	0x60,0x0A,0x07,0xB2,0x99,0xE5,0x8B,0x66,0x23,0x52,0xA9,
+	0x48,0x54,0xB8,0x41,0x74,0x51,0x08,0x84,0x73,0xB2,0xEB,
+	0x8D,0x44,0x7E,0xCA,0x3F,0x2B,0x8B,0xBF,0x1E,0x59,0xB5,
+	0xFE,0x59,0xC4,0xF3,0x89,0x7F,0xD6,0x72,0x3E,0x15,0xBD,
+	0x4C,0xF6,0xAF,0xD3,0x5D,0xC9,0x27,0xCE,0xF1,0xAF,0x8B,
+	0x2D,0xF7,0x6C,0x00,0xE6,0x6B,0x19,0x66,0x7E,0xF2,0x9C,
+	0x88,0x57,0x91,0xF3,0xFD,0xB3,0x46,0x79,0x3E,0x95,0x0F,
+	0xAA,0x75,0x12,0xE6,0xC8,0x5D,0x72,0x1A,0x92,0xCB,0xF9,
+	0xB6,0x3C,0x9D,0xE7,0x2B,0xB9,0xA5,0xE2,0xEA,0xEC,0xF2,
+	0xC9,0x9C,0xFC,0x39,0xFA,0xC8,0x2E,0x37,0xEE,0xF1,0xDA,
+	0xB2,0xE9,0x44,0x7A,0x06,0xFA,0x31,0xBB,0x72,0xA5,0x5E,
+	0x13,0xDE,0x3A,0x33,0x01,0x21,0xAC,0xC7,0xAE,0x48,0x82,
+	0xA2,0x1E,0x06,0xD0,0xB6,0xFA,0x82,0x10,0x96,0xCA,0x74,
+	0xB6,0x0F,0xC8,0x74,0x2E,0x7B,0x07,0x40,0x9B,0x04,0x48,
+	0x91,0x2D,0x5C,0xD2,0x57,0x2D,0x7F,0x39,0x22,0x1E,0x62,
+	0xA1,0x9A,0xE7,0x8E,0x19,0x27,0x94,0xB2,0xFC,0xB8,0x23,
+	0x3D,0xC8,0x1C,0xE9,0xDB,0xEA,0xE1,0x1E,0x3A,0x5A,0xE2,
+	0xEE,0xF4,0x60,0xAE,0xE9,0x45,0xBB,0x77,0x96,0xE0,0x7C,
+	0xDE,0x0E,0xDF,0xFE,0xBA,0x8D,0xFD,0xFC,0x6C,0x3F,0x34,
+	0xAE,0xE7,0x47,0x74,0xC0,0x16,0xDE,0x37,0x1E,0xDA,0xDE,
+	0xF3,0x38,0x6B,0x20,0x7F,0x06,0x19,0x19,0x5A,0x56,0x98,
+	0x14,0x78,0xCA,0x7F,0xA0,0xCE,0x17,0xED,0x82,0xB3,0xDA,
+	0x2E,0xEF,0x87,0x97,0x8C,0xFB,0xE6,0x17,0xED,0xF2,0x2E,
+	0x79,0xA6,0x86,0x79,0x9E,0x85,0x02,0xE7,0xF4,0x73,0x25,
+	0xA9,0xF4,0x0C,0x1C,0x66,0x60,0xBB,0x33,0x95,0x69,0xCA,
+	0x10,0x7F,0x43,0x3C,0x3E,0x78,0xD1,0x5E,0x66,0xD1,0xEA,
+	0x7A,0x8C,0xF2,0xD3,0x14,0xCF,0x72,0xAF,0x9C,0xCE,0x6A,
+	0x2E,0x9C,0x50,0xAD,0x85,0x01,0x0A,0xBA,0xD6,0x45,0x16,
+	0x29,0xB4,0x49,0x7E,0x6A,0xC1,0xC5,0x61,0x94,0x7B,0x30,
+	0xD8,0xAE,0x06,0xAC,0x86,0xC8,0xD3,0xC4,0xA1,0xC4,0xFD,
+	0x00,0xBF,0x16,0x44,0x31,0x83,0x36,0xEE,0x6C,0xDB,0xAB,
+	0xB4,0x59,0xB8,0xDB,0x8A,0x35,0xE0,0x8A,0xC2,0xE4,0x33,
+	0x03,0x36,0x33,0xFC,0x65,0xBA,0x6A,0x4B,0x92,0xE3,0x46,
+	0x33,0x7C,0x76,0x42,0xF5,0xA8,0x06,0x2D,0xF2,0x31,0x7B,
+	0x32,0x55,0x4B,0x61,0x16,0x96,0x58,0x50,0xF3,0xCA,0x33,
+	0xCC,0xFE,0x2F,0x37,0x35,0x14,0xB0,0xF0,0xB4,0x80,0x85,
+	0xA7,0xAC,0x5A,0x92,0xD9,0x93,0xBC,0x93,0x79,0x79,0x95,
+	0xED,0xC1,0x0E,0x25,0xB3,0x1A,0x14,0xC7,0x6D,0xDA,0x6E,
+	0x18,0xE3,0xD3,0xB6,0xF0,0xE2,0xB3,0x88,0x8B,0x21,0x05,
+	0x71,0xB7,0x2F,0x3C,0x97,0xED,0x3C,0xB1,0x60,0x24,0xBC,
+	0x80,0x54,0xD3,0x36,0x54,0x64,0x6A,0x89,0x95,0xC5,0x35,
+	0xEB,0x7D,0x69,0xC2,0xCC,0x07,0xD2,0x36,0x2A,0xAA,0x7F,
+	0x34,0x3E,0x78,0x14,0xDE,0x9E,0xB0,0xC4,0x38,0xBD,0x97,
+	0x37,0x4E,0x3F,0xE0,0x49,0x15,0xC6,0x22,0x58,0xA5,0xAD,
+	0xF2,0x51,0xE8,0x68,0x55,0xE1,0x20,0x5E,0x55,0xFD,0xC7,
+	0xF0,0x9B,0xD0,0x46,0xC3,0x5E,0x91,0x5E,0x35,0x78,0xC0,
+	0xB8,0xEB,0xBE,0x34,0xC6,0x7E,0xBD,0x30,0x11,0x42,0xC9,
+	0x30,0xCE,0x47,0xE8,0x25,0x2C,0x31,0x41,0x03,0x1B,0x73,
+	0x5D,0x31,0x20,0x1D,0xF0,0x98,0xB0,0x60,0x0E,0xCB,0xED,
+	0x4C,0xFE,0xFC,0x77,0x59,0x0C,0xAC,0x82,0xAA,0x9E,0xB1,
+	0x4A,0x59,0x40,0x05,0x04,0x9B,0x56,0xA5,0x09,0x19,0xC5,
+	0x2C,0x4E,0x4F,0x64,0x39,0x4B,0xF4,0x88,0xB0,0x32,0x57,
+	0xA5,0x51,0x5B,0x7C,0x4F,0x40,0x55,0xAE,0x0B,0x5D,0xAA,
+	0x1E,0x13,0x32,0x8B,0xD3,0x04,0xDB,0xAA,0xB4,0x8D,0x1D,
+	0x50,0xEE,0xFB,0xF9,0x04,0x55,0x46,0x68,0x63,0x10,0xD9,
+	0x70,0x3E,0xDA,0x85,0x9B,0x11,0xB8,0xA0,0xA2,0x2D,0xDC,
+	0xF4,0x55,0x75,0xB0,0x83,0x3A,0x35,0x34,0xB2,0xA8,0x49,
+	0x6A,0x11,0xEC,0x73,0x99,0x09,0x73,0x71,0x21,0x1E,0x7E,
+	0x8E,0x34,0xE4,0xB3,0x78,0xF8,0x70,0x7F,0x81,0x45,0x8F,
+	0x09,0x16,0x88,0x5A,0xC3,0x2C,0x78,0x2C,0x10,0xD0,0x64,
+	0x66,0x44,0x10,0x96,0x32,0x9F,0x5B,0x20,0xBB,0x88,0x11,
+	0x2E,0x82,0x85,0xCF,0x09,0x1E,0xDE,0x45,0xE0,0x8F,0x59,
+	0x66,0xF3,0x57,0xF9,0xE7,0x27,0xD9,0xF7,0xCE,0xAA,0x4F,
+	0x48,0x0E,0x1E,0x56,0x12,0x95,0x02,0x23,0x1B,0x79,0x81,
+	0x8D,0x4F,0x56,0x1B,0x85,0x7F,0xF7,0x35,0x93,0xAE,0x69,
+	0xC1,0xC3,0x5A,0xB5,0x0A,0x2E,0x56,0x9E,0x10,0xAF,0xB8,
+	0xB1,0xCC,0xC2,0x9B,0xE3,0xB5,0xAF,0xD5,0x6A,0x3F,0xC3,
+	0x6A,0x7B,0x2E,0x67,0xFB,0x87,0xAA,0xF8,0x37,0xD6,0x18,
+	0xD9,0x1B,0xBB,0x81,0xEA,0xE0,0x61,0xE4,0xF9,0xE7,0x5B,
+	0xB2,0xE4,0xE3,0x40,0x91,0xD3,0x23,0x1F,0xC5,0x5C,0xB0,
+	0x73,0x1D,0xB6,0xF0,0xA1,0x71,0x28,0x0D,0xAC,0xB3,0x11,
+	0xDE,0x5A,0x51,0x90,0xB4,0x55,0xEF,0x79,0xA8,0xA1,0xC0,
+	0xF6,0x34,0xC6,0x23,0x14,0xD8,0x6C,0x61,0x3B,0xB8,0xC0,
+	0x86,0x0C,0x5F,0x9C,0xDE,0x6D,0x89,0x8F,0xDE,0x22,0xDC,
+	0xCD,0xBC,0x93,0x42,0x2C,0xEA,0x3B,0x41,0xD9,0xC3,0x49,
+	0x03,0xA0,0xCE,0x88,0xA2,0xAA,0x02,0x3B,0xC5,0x5A,0xCA,
+	0x37,0x07,0x0F,0x03,0x09,0x63,0x4A,0x9C,0x17,0xAC,0x69,
+	0x43,0x01,0xF3,0x48,0xD9,0x4E,0x3B,0x9B,0x90,0xAD,0x46,
+	0x4F,0x22,0xEA,0xCC,0x26,0xF2,0x7F,0xE0,0x46,0xF4,0x72,
+	0x90,0x8D,0xD1,0x62,0x96,0x87,0x76,0x20,0x7E,0x2E,0x78,
+	0x2D,0x6C,0x31,0x37,0x70,0x9F,0xB3,0x03,0x43,0x87,0xF6,
+	0x69,0xA7,0x86,0xD8,0x2B,0x79,0x57,0x0B,0x94,0x29,0x42,
+	0xE4,0xBD,0xEE,0x81,0x8A,0x44,0x28,0xBB,0x71,0x55,0x4B,
+	0x74,0x79,0x57,0x79,0xD2,0xCA,0xB1,0x78,0x06,0xAA,0xB8,
+	0xA6,0xCA,0x96,0x1C,0x45,0x71,0xDB,0xE4,0xA3,0x91,0xEB,
+	0xF4,0x41,0xB7,0xB5,0xCA,0xDD,0x94,0x21,0x18,0x2B,0x9B,
+	0x11,0x95,0x2C,0x12,0xA0,0xDA,0x61,0x8F,0xB8,0x3E,0x28,
+	0x22,0x57,0x34,0x3C,0x4E,0x1F,0xE4,0xB0,0xE6,0x60,0x10,
+	0x82,0xED,0xD9,0x2C,0x0C,0xE9,0xCB,0x86,0x58,0x61,0x09,
+	0x56,0x24,0xCE,0x29,0xE7,0x4E,0xA0,0x1B,0xA0,0xFF,0x38,
+	0x6F,0x35,0x7F,0x77,0x05,0xF7,0x47,0x90,0x0C,0xB7,0xCA,
+	0x1A,0x30,0x1A,0xF7,0xE6,0xED,0x5D,0x31,0x58,0xC1,0x7D,
+	0xBE,0xD5,0xEE,0x99,0x54,0xC1,0x1D,0x29,0x4F,0x8C,0x94,
+	0x2A,0xE0,0xDC,0x31,0xB5,0x94,0x49,0xE5,0x9E,0x89,0xC1,
+	0xB6,0x6C,0x61,0x65,0x4C,0x6E,0xDF,0x9A,0xE5,0x41,0x14,
+	0x73,0x84,0x26,0x46,0x8A,0x94,0xAD,0xB3,0x3D,0x30,0x53,
+	0x47,0x5E,0x55,0x99,0x10,0x99,0xAD,0xC8,0x13,0xB6,0xFA,
+	0x3D,0xC7,0xB4,0x9C,0x6D,0x29,0xC8,0x6B,0x8D,0x22,0xD0,
+	0xA6,0x4B,0x4C,0x91,0xC9,0x0A,0xA3,0xDB,0x15,0x83,0x4D,
+	0xCA,0xA8,0x6C,0x5E,0x28,0x20,0xE8,0x6B,0x42,0x80,0x95,
+	0x01,0xF2,0x17,0x22,0xC4,0xAA,0x6C,0xA9,0xE2,0xCA,0xC3,
+	0x66,0x53,0x90,0x45,0xB0,0x83,0x2C,0x78,0x32,0xAA,0xB1,
+	0x13,0x8C,0x5F,0xA7,0x81,0xEB,0x32,0x70,0xC7,0x0C,0x5C,
+	0x8F,0x81,0x3B,0x6E,0xE0,0xC2,0xD4,0xD5,0x3F,0x85,0x6B,
+	0xEB,0xE7,0x3E,0x37,0x7B,0x26,0x55,0xF9,0xCA,0x2B,0x9B,
+	0x03,0xBE,0x4E,0xE2,0x83,0x00,0x82,0x4F,0x15,0x97,0xC7,
+	0x39,0x55,0xA0,0x14,0x76,0xCA,0xC7,0xFD,0x3E,0x39,0x8B,
+	0xEF,0x60,0x47,0x39,0x7C,0x7F,0xDC,0x99,0x45,0x54,0x46,
+	0xA2,0x50,0x29,0x6C,0x93,0x4F,0x04,0x7C,0x5D,0xC4,0x67,
+	0xDF,0x99,0x33,0x22,0xB7,0x4B,0x3E,0x51,0xC1,0x9D,0xC8,
+	0x2B,0xE5,0x8B,0x80,0x7D,0x36,0x9F,0x15,0xF0,0x1D,0x23,
+	0xBE,0x69,0x41,0x77,0xBF,0xE0,0x1E,0x64,0xC8,0x27,0xA9,
+	0xC8,0xE1,0xF5,0xB3,0xCA,0xC7,0xE4,0x2E,0xC4,0xBF,0x98,
+	0x09,0xD5,0xB1,0x46,0x60,0x6D,0xAB,0x6C,0x0E,0x77,0x60,
+	0x35,0xF4,0x10,0xDF,0x4D,0x17,0xA1,0xED,0x91,0x4F,0xE4,
+	0x2D,0xF2,0xB4,0xA8,0xD8,0xBA,0xBE,0x1B,0x5B,0xC0,0x77,
+	0x9C,0xF8,0x26,0x7C,0x47,0xF9,0x71,0x56,0x1E,0xBE,0x94,
+	0xE0,0xB0,0x7C,0x82,0xF1,0x01,0x6B,0x74,0xEF,0x37,0xEA,
+	0x28,0xCF,0x5E,0x3A,0x4A,0x36,0x51,0xEA,0x06,0x92,0x99,
+	0x0C,0x19,0x26,0xF6,0x06,0xA7,0x1E,0x8E,0xAA,0x7B,0x90,
+	0x16,0xC6,0x82,0x9C,0x85,0x9E,0xAF,0xAC,0xCD,0xAE,0x9F,
+	0x7B,0x59,0x56,0xB8,0x42,0xC7,0x1E,0xE1,0x8F,0x66,0xAB,
+	0x7B,0x82,0xB4,0xDE,0x3F,0xEB,0x5A,0x44,0x8C,0x9C,0xA5,
+	0xC2,0x98,0x97,0x53,0x92,0x9B,0x37,0xBD,0xEC,0xE6,0x1D,
+	0x16,0x92,0x8D,0x88,0xEC,0xEC,0x09,0x5A,0xC7,0x5E,0xF3,
+	0x5C,0x97,0x43,0x74,0x75,0x5C,0x36,0x5D,0x6C,0x96,0x3B,
+	0xF6,0xB8,0x07,0xB3,0x03,0x89,0xFA,0xEC,0x3D,0x89,0x54,
+	0x84,0x42,0x63,0xA8,0x61,0xD2,0xB1,0xAC,0xD6,0xCE,0xE1,
+	0x58,0xBA,0x61,0xAE,0x05,0x2B,0x36,0x6F,0x1A,0x7F,0x2F,
+	0x97,0xAD,0x6E,0x37,0xFA,0xF3,0xAE,0xF5,0xDC,0x38,0x84,
+	0x9D,0x03,0xF6,0xDB,0x34,0xEC,0x96,0xBF,0xC3,0x6E,0x91,
+	0x3B,0xB2,0xCF,0xAE,0x30,0x43,0x5B,0x1A,0xCD,0xF2,0x47,
+	0xDF,0xDE,0x91,0x05,0x1D,0x5D,0xC1,0x55,0x18,0xAB,0xEE,
+	0xD6,0xE5,0x3D,0x52,0x3A,0x29,0x6F,0x5E,0xE9,0xE2,0xBC,
+	0x3B,0xF8,0x45,0xFE,0xB5,0x3A,0x27,0x3F,0xCB,0xBF,0x56,
+	0x7F,0x13,0x3F,0x3D,0xF2,0x16,0xD1,0xA8,0x90,0xBF,0xA8,
+	0x5A,0xAE,0x2F,0x1B,0x8D,0xB2,0x47,0xF8,0x7B,0xD8,0x98,
+	0x3B,0x19,0x6A,0xBB,0x3C,0x36,0xCF,0x53,0xFA,0x83,0xBC,
+	0x9F,0xF0,0x37,0xDD,0x92,0xAF,0xE3,0x27,0x0F,0x17,0xF8,
+	0x99,0xB5,0x19,0x7A,0x59,0x24,0x4F,0x91,0x67,0x78,0xDD,
+	0x79,0x4F,0x7A,0x96,0xE5,0x95,0xF1,0xC7,0x51,0x87,0x63,
+	0x55,0x66,0xCB,0x1D,0x79,0x8F,0xF1,0x5F,0xA8,0x8F,0xEB,
+	0xD1,0x42,0x87,0x78,0xF1,0x2A,0x6F,0x6F,0xDE,0x12,0x4F,
+	0x5A,0x5E,0x21,0xBF,0x9B,0xA1,0x3A,0x84,0x7A,0x09,0x7A,
+	0xF9,0xB7,0x79,0x1C,0xFF,0x9B,0x78,0xB3,0x04,0xA3,0xBC,
+	0x65,0xA8,0xC8,0x98,0x25,0xBF,0x82,0x74,0xA0,0xDE,0x20,
+	0x0B,0x9C,0x5C,0xE5,0x62,0xBB,0x50,0x71,0x15,0x93,0x5D,
+	0xC1,0x8E,0xE5,0x26,0xE5,0xFD,0x80,0x4F,0xF6,0xCF,0x37,
+	0xEA,0x38,0xF9,0x14,0x6E,0x66,0xF8,0x63,0x53,0x11,0x9E,
+	0xCC,0x37,0x1A,0xFD,0x0F,0x1B,0xBF,0x91,0x23,0x70,0xD2,
+	0xAC,0xFD,0x05,0x46,0x23,0x7F,0x14,0x79,0x7A,0xF9,0x70,
+	0x5E,0x0E,0x9F,0x50,0x5E,0x70,0x99,0xDC,0x04,0xEA,0xEB,
+	0xDC,0x22,0xDB,0xD7,0xA2,0x5F,0xD0,0xF6,0xE0,0x51,0x47,
+	0x68,0x7A,0x93,0x27,0x89,0x9E,0xE1,0x98,0x7F,0x63,0x98,
+	0x2D,0x7F,0xB5,0xD2,0x2D,0x0E,0xC7,0xA4,0xF4,0xA8,0x6A,
+	0xE0,0x1D,0xFB,0x03,0xE7,0x15,0xFE,0x5A,0x66,0xA6,0x55,
+	0x6B,0x4E,0x45,0xB6,0x42,0x07,0x03,0xF5,0x7A,0x5B,0x78,
+	0xD3,0x98,0x6A,0x16,0xE8,0x76,0xEB,0x6A,0xE5,0xA3,0xF1,
+	0x6D,0x82,0xA5,0xE2,0x50,0xCD,0x89,0xD3,0xCF,0xAD,0xBB,
+	0xA8,0x76,0xA9,0x56,0xFB,0x28,0x6A,0x77,0x4C,0x3F,0xE7,
+	0x3B,0x48,0x07,0xE4,0x4F,0xD5,0xCE,0x60,0xC0,0x76,0xD8,
+	0x89,0xE0,0x8B,0x09,0x5E,0xB6,0xCF,0xD3,0x3C,0x26,0x88,
+	0x85,0xE4,0x8E,0x5D,0x78,0x5B,0xBE,0x97,0x85,0x99,0xB7,
+	0xEB,0x0E,0xEA,0x44,0xA8,0xE5,0xB1,0x28,0x42,0x04,0x88,
+	0x74,0x68,0x6D,0x66,0x82,0xA2,0xD4,0x27,0xE6,0x04,0x44,
+	0x45,0xFE,0x2A,0x50,0xAF,0x04,0xEA,0x94,0x0A,0x2B,0xB2,
+	0xB2,0xCB,0x53,0x58,0x56,0x8B,0x56,0xD3,0xE0,0x8E,0xD6,
+	0x27,0x6A,0x3B,0x6B,0xE2,0xF0,0x36,0x19,0x86,0x16,0xA5,
+	0xEE,0x7E,0x5A,0x38,0xB0,0x71,0xFF,0x5A,0xE7,0x5E,0xB7,
+	0x39,0xB0,0xCE,0xA2,0xF0,0x09,0x70,0x2F,0x8C,0x04,0xC2,
+	0x27,0x14,0x46,0x99,0xD3,0x7D,0xC6,0x16,0x9E,0x33,0xA6,
+	0x9A,0x7A,0xA1,0x87,0xA2,0x41,0xF6,0xAE,0x35,0x56,0x95,
+	0xAF,0x43,0x08,0xE2,0xC9,0xA0,0xF5,0x72,0x5F,0xB0,0xFD,
+	0xAC,0x7B,0xA0,0xDE,0x78,0xDD,0x59,0x77,0x7F,0xC0,0x3D,
+	0x40,0x38,0xB9,0x46,0xC3,0x43,0x3C,0xB3,0x51,0xD9,0x81,
+	0x58,0x68,0x1A,0xAD,0x47,0x56,0xEE,0x3A,0xCB,0x2F,0xAF,
+	0x81,0xBF,0xBD,0xD3,0xC2,0xDE,0x8E,0xEF,0x6F,0xE0,0x06,
+	0x08,0xDB,0xED,0x28,0xFA,0x8B,0xBA,0x0D,0xD1,0x5F,0xC1,
+	0x0D,0xA0,0xBA,0x31,0xA7,0xA0,0xDC,0xC8,0xB1,0x17,0xB5,
+	0x51,0x78,0xBB,0xFD,0xDC,0x59,0x3F,0x16,0xF3,0x0B,0xDF,
+	0xA0,0xE3,0x5C,0x2E,0xC6,0x27,0xE4,0x7A,0x07,0x3D,0x13,
+	0x30,0xC4,0x60,0x1B,0x5B,0x38,0x06,0x96,0x72,0x47,0xFD,
+	0x79,0xD3,0xF9,0x59,0xF5,0xC6,0x1C,0xF9,0x48,0xB0,0xAD,
+	0xDE,0xE8,0x40,0x0E,0x13,0xFB,0xB5,0x3A,0x4C,0xB8,0x91,
+	0xC6,0xE4,0x33,0xA8,0x39,0x06,0xC5,0x55,0xBC,0x0E,0x96,
+	0x95,0x55,0xCF,0xE1,0x0D,0x9C,0x3C,0xA0,0x76,0x91,0xC3,
+	0xA1,0x9B,0xC8,0x0D,0xDF,0xC4,0x8C,0x91,0xEB,0xBE,0x59,
+	0xC4,0xD6,0x3A,0x44,0xC6,0xCC,0x5F,0xE9,0x5F,0x77,0x59,
+	0x0E,0x3F,0x11,0xCE,0xD7,0xD4,0x02,0xDB,0xD4,0x02,0xFB,
+	0xD4,0x82,0xD1,0x53,0x0B,0xD2,0xA6,0x16,0x64,0x4C,0x2D,
+	0x18,0xB7,0x31,0xE4,0x33,0xE8,0x0A,0xEC,0xF7,0x0E,0x71,
+	0xD1,0xC4,0xB6,0x2D,0x98,0xEA,0x70,0xC7,0x02,0x6B,0x47,
+	0x23,0x92,0x8E,0x74,0x0F,0xAA,0x5A,0x0B,0x86,0x2A,0x5A,
+	0xD9,0x22,0x4C,0x62,0xE7,0xC5,0x6C,0xE1,0x7F,0x87,0xBF,
+	0x59,0xCB,0x66,0xFE,0x0B,0x54,0xCC,0xCD,0x1F,0xBD,0x6E,
+	0x72,0x95,0x2F,0x5A,0xE9,0x1A,0xBC,0x23,0x70,0x4E,0xF1,
+	0x40,0x5C,0xD8,0x6E,0x44,0xC5,0xE5,0xB4,0x97,0xA9,0x6B,
+	0x33,0xAA,0x14,0x28,0xF3,0x46,0xCB,0xC7,0x1A,0xF2,0x47,
+	0x13,0x12,0x79,0x7E,0x30,0xDE,0xD7,0x38,0xC1,0x6B,0xD6,
+	0x36,0x22,0x82,0x87,0x55,0x1D,0x92,0x3F,0x8E,0x19,0xCC,
+	0xBE,0x6C,0x21,0x7F,0x1C,0xEC,0x5A,0x06,0x20,0x0D,0x30,
+	0x1A,0x60,0x07,0xD8,0xB2,0x2B,0xF2,0x27,0xC0,0x3E,0xE4,
+	0x3D,0x00,0x07,0x03,0xD5,0x2B,0xF2,0x8D,0xB0,0x47,0x3F,
+	0x09,0x24,0x9A,0xF7,0xCC,0x82,0x62,0x81,0x0F,0x7E,0x1A,
+	0xB7,0x41,0xD8,0x1B,0xDC,0x30,0xAF,0xA7,0x70,0xC3,0x5C,
+	0x9C,0x94,0xEF,0xCB,0x7B,0xC2,0x73,0x30,0x8F,0xF7,0x1C,
+	0xC8,0xFB,0xB9,0xA7,0x3E,0xEF,0x1E,0x4F,0x5D,0xDE,0x2A,
+	0xFE,0xFA,0x0B,0x18,0xAE,0xFE,0x5E,0x0C,0x11,0x9D,0x2E,
+	0xF2,0x0C,0x89,0xFC,0x81,0xC0,0x22,0xFE,0x38,0x90,0x68,
+	0x54,0x6B,0xA3,0xDA,0x80,0xD6,0x28,0xAA,0xE1,0x9A,0xB0,
+	0xDB,0x42,0xF2,0x56,0x95,0x16,0xE7,0x15,0x95,0x3E,0x94,
+	0x37,0xB7,0x74,0x55,0xDE,0x1C,0xCF,0x83,0x41,0xB7,0xA5,
+	0x21,0x1F,0xDA,0x16,0x5A,0x1F,0x15,0xC0,0x88,0xF2,0x44,
+	0x35,0x0B,0xCE,0x46,0x64,0xBC,0x1E,0x7A,0x6E,0xCF,0x2C,
+	0x75,0xB3,0x84,0x21,0x62,0xBA,0x02,0x28,0xFB,0xF3,0x8D,
+	0x59,0xF0,0x35,0x58,0xAE,0xFC,0x1E,0x7B,0xB2,0x7B,0x7E,
+	0x05,0x71,0xCA,0xE9,0x41,0x21,0xE2,0xAD,0xEA,0xBC,0x47,
+	0xF9,0x67,0x61,0x8C,0x23,0x33,0x75,0x91,0x3F,0x18,0x22,
+	0x51,0x03,0x90,0xC0,0x48,0xED,0x9D,0x05,0x8E,0x0B,0x2B,
+	0xD8,0x5A,0x3B,0x9A,0xC2,0x76,0x56,0x26,0xAB,0xFD,0x30,
+	0x7E,0x6F,0xD3,0x81,0xEC,0x71,0xDF,0x42,0xB6,0x3C,0x35,
+	0xF2,0xAC,0x4E,0xA5,0x81,0x65,0xBC,0x1A,0xEF,0x1F,0x4C,
+	0xC1,0x3A,0xDA,0x8A,0xA0,0x30,0xE2,0x85,0x5F,0x3F,0xF0,
+	0x2A,0x3B,0x00,0xE0,0x62,0x63,0x74,0x84,0x18,0x39,0x7E,
+	0xCF,0x63,0x01,0xDF,0x69,0xB2,0xD6,0xCE,0x5B,0x02,0xBE,
+	0x5E,0xC2,0xC3,0x28,0x9E,0x62,0x87,0x23,0x1E,0x65,0x5C,
+	0x10,0xF2,0x6D,0x88,0x92,0x7D,0x83,0xB7,0xE9,0x1A,0xB2,
+	0xE9,0xDD,0x36,0xE6,0x04,0xD7,0x27,0x5C,0xC7,0x4A,0xD4,
+	0x96,0x3F,0x62,0x2F,0x86,0x4F,0x82,0xA3,0xEA,0xFB,0xE0,
+	0x53,0xE0,0xB0,0x9A,0xE8,0x05,0xC7,0xD5,0x04,0x3C,0x9D,
+	0xD3,0x91,0x0F,0x63,0xF0,0x53,0xAA,0x31,0xE4,0x57,0xE4,
+	0x00,0x8B,0x99,0xD7,0xBE,0x27,0xBF,0x7D,0xD6,0x1D,0xC5,
+	0xBA,0x0C,0xB8,0xA3,0x24,0xF2,0x5C,0x6C,0x68,0xEA,0xE0,
+	0xDF,0x7C,0x7B,0x87,0x53,0x23,0x3F,0x89,0xB1,0x03,0xA6,
+	0x91,0x87,0x62,0xDF,0x5E,0x21,0x2B,0xF2,0xE3,0x58,0xD9,
+	0x22,0x70,0x08,0x51,0x8E,0xE2,0x31,0xD6,0xE7,0x5F,0x96,
+	0x85,0x07,0x4C,0x92,0xC0,0xC5,0x0C,0xCB,0x6D,0xEA,0x2E,
+	0x40,0x9F,0x4A,0xF1,0x35,0x6A,0x1C,0x74,0x15,0x1B,0x31,
+	0x3F,0x49,0x1D,0xEF,0x78,0x36,0x5E,0x7E,0x4C,0xC0,0x77,
+	0x92,0xF0,0x08,0x31,0xA0,0x86,0x1C,0xA1,0xC8,0x3C,0x43,
+	0xA4,0xCC,0x10,0x49,0x34,0xE4,0x3D,0x51,0xBA,0x34,0xAF,
+	0xB8,0x64,0x45,0x99,0x3B,0x3E,0xE6,0x2C,0xCF,0x02,0x70,
+	0x1E,0x73,0xB3,0x77,0x96,0x09,0xCC,0x77,0xA9,0x7B,0xCB,
+	0x6C,0x57,0x12,0xFC,0xA7,0xB5,0x98,0xB8,0xF0,0xAC,0xF3,
+	0x3B,0x15,0x45,0xDB,0xBF,0x0B,0xDF,0x0C,0x8D,0x04,0x7F,
+	0x74,0xB4,0xE0,0xB2,0xD0,0xDE,0x70,0x1E,0xC8,0xE9,0x83,
+	0xF7,0xA1,0x19,0x27,0x33,0x29,0xB3,0xEE,0x36,0x93,0xC8,
+	0xED,0x4A,0x64,0x8B,0x2E,0xF2,0x92,0x2E,0xAF,0xB4,0xC4,
+	0x10,0xD9,0x46,0xF2,0xD6,0xC0,0xA9,0x7F,0xF9,0x1B,0xAD,
+	0xBB,0x04,0x13,0x06,0x7D,0xAD,0x81,0x3D,0x04,0xD6,0x9A,
+	0x09,0x6F,0x67,0x79,0x8C,0x11,0x99,0x06,0xAC,0x2E,0xB3,
+	0x91,0xB0,0x12,0xFF,0x2A,0xE3,0x39,0x26,0x34,0x4B,0xF4,
+	0xC2,0x2C,0xB6,0x79,0x14,0x97,0xBC,0x13,0xAC,0xAE,0xD1,
+	0xB3,0x38,0xD0,0xA0,0x67,0xDF,0x90,0xCC,0x12,0xA0,0x04,
+	0x56,0xEA,0x19,0x4F,0xE6,0xC6,0xC2,0xD7,0xC2,0x79,0x1D,
+	0x44,0xB6,0xC0,0x9D,0x08,0x88,0x09,0x95,0x87,0xEB,0x0B,
+	0x94,0x5B,0xC2,0xE9,0x8C,0x5A,0xFF,0xDA,0x09,0x45,0x7C,
+	0x92,0x46,0xBF,0x2D,0x9C,0x6C,0xAB,0x56,0x47,0xC3,0xC8,
+	0x0E,0x3F,0x7A,0x4E,0x1D,0x8D,0x2D,0x72,0xBD,0xC2,0x9A,
+	0x02,0x53,0x61,0x4C,0xDE,0x5F,0xF6,0xE8,0x1E,0xDF,0x20,
+	0xE6,0x80,0x68,0xD3,0x98,0x80,0x69,0x2C,0x04,0x8B,0x20,
+	0xC0,0xE0,0xCB,0x8A,0xC1,0xF8,0x56,0xB6,0x09,0x13,0x80,
+	0x69,0xD0,0x3A,0x58,0xC4,0x5F,0xAF,0xB2,0xF2,0x87,0x1A,
+	0x62,0x61,0xB9,0x25,0x9C,0xAC,0xE1,0x1E,0xCD,0xA6,0xE7,
+	0x97,0x86,0x88,0x04,0x25,0x64,0xF1,0x0D,0xC0,0xD7,0x8F,
+	0xEC,0x8E,0x45,0xBE,0x26,0x91,0x2B,0x75,0x11,0x3B,0x3B,
+	0x92,0xB1,0x02,0xD5,0x98,0xAC,0xE8,0x3C,0x77,0x61,0xA9,
+	0x2F,0x55,0xE7,0x71,0xB4,0x3A,0x8F,0x56,0x75,0x1E,0x4D,
+	0x6C,0x1E,0x3D,0x0E,0x4D,0x4A,0xDC,0x90,0x12,0x91,0x09,
+	0x89,0x3B,0x06,0x0B,0xC4,0x24,0xE2,0xE2,0x6C,0x8E,0xED,
+	0x54,0xB3,0x95,0x5E,0x9E,0xB8,0xDB,0x4E,0x22,0xBB,0xBE,
+	0xC9,0xE3,0xC1,0xDB,0x3F,0x7C,0x13,0x19,0xCB,0x8C,0x49,
+	0x12,0x37,0x20,0xFF,0x2E,0xEF,0x51,0xCF,0xA9,0x3C,0x76,
+	0x94,0xD4,0x38,0xA8,0x78,0x2D,0x1A,0x5B,0x76,0x77,0x27,
+	0x57,0x1E,0x76,0x05,0x8F,0x2A,0x5C,0x9F,0x92,0xF9,0xB6,
+	0x3D,0x92,0x15,0x83,0xAC,0xDC,0x15,0xCB,0xBB,0xA7,0xD4,
+	0x92,0xB7,0x08,0x08,0x4E,0xC5,0x22,0x87,0xCE,0x23,0x6B,
+	0x91,0x92,0xF7,0x20,0x9F,0x85,0x89,0x1A,0xAD,0x23,0x4C,
+	0x76,0x66,0xF3,0xC5,0x98,0x27,0x30,0x06,0xCA,0x63,0x6E,
+	0x4C,0x55,0x1E,0x91,0x9E,0x6F,0xA0,0xFE,0xDE,0xD9,0xAD,
+	0x27,0x91,0xD9,0xDF,0x78,0xDF,0xCC,0x2B,0xF0,0xBC,0x0A,
+	0x8F,0xC3,0x10,0xA9,0xFE,0x26,0xF2,0xC2,0x79,0x55,0xE4,
+	0x7F,0x1B,0xD3,0xDA,0xAC,0x88,0x21,0x64,0x34,0x44,0xFE,
+	0x3B,0xD6,0xC0,0xF5,0x23,0xC8,0x74,0xF7,0x45,0x3E,0x8A,
+	0x5D,0x60,0xDF,0xC9,0xB3,0x91,0x5D,0x31,0xB5,0x0B,0x39,
+	0xF2,0x9F,0xAC,0x45,0x15,0x17,0xDE,0x3B,0x0B,0xFA,0x5D,
+	0xD5,0x20,0x6F,0x26,0x31,0x0D,0x02,0x91,0xFE,0x06,0xB3,
+	0x5E,0xC1,0x85,0xCB,0x13,0xE3,0x7B,0xA9,0xEF,0xA4,0x13,
+	0x4F,0xA4,0xC2,0x1D,0xCE,0x51,0x2A,0x9E,0x79,0x37,0x7D,
+	0xB2,0x4E,0xDD,0xD3,0x6D,0x53,0x2B,0x45,0xCA,0x0B,0x74,
+	0xE0,0x98,0x82,0xE9,0x9E,0xFD,0x0D,0x63,0x1D,0xB3,0xF7,
+	0xBD,0x4B,0x84,0xC2,0x53,0x8A,0x37,0x66,0xC8,0xB7,0x09,
+	0xAE,0x93,0x45,0x88,0x5B,0x80,0xFD,0x16,0xAB,0x36,0xAB,
+	0xF7,0x0C,0x8B,0xCD,0xCC,0xF0,0x1F,0x93,0x2E,0x88,0xCD,
+	0x0D,0x67,0xB5,0xA9,0xC5,0x8C,0xAE,0x5D,0x04,0x1A,0x75,
+	0xA0,0xE4,0x6F,0x83,0x01,0xC5,0xF2,0xCB,0x01,0xF4,0x66,
+	0xDE,0xEB,0xEE,0x63,0x67,0x9A,0x4E,0xAA,0x9D,0xD9,0x23,
+	0xAD,0x83,0xEA,0x0A,0xB5,0x6B,0x13,0xC0,0xC3,0xD8,0xF4,
+	0x63,0x49,0xCA,0x9F,0xC4,0xD7,0x73,0x21,0x06,0x3D,0x80,
+	0xD0,0x69,0x09,0x96,0x35,0xFA,0x49,0x48,0x96,0x9F,0x82,
+	0x90,0x4C,0xCD,0x1F,0x0D,0x9B,0x12,0x79,0x79,0x30,0xDB,
+	0x3F,0x2F,0xC1,0x18,0x39,0x38,0xC8,0x56,0xC7,0x28,0x12,
+	0x39,0x3A,0x48,0x08,0xB9,0xE0,0x2D,0xD5,0xAA,0x5B,0xF0,
+	0xEA,0x36,0x59,0x51,0x65,0xDB,0x24,0xB8,0x0A,0x1B,0xF7,
+	0x7B,0x1E,0xA1,0xFB,0x12,0x0C,0x64,0xFA,0xBE,0x92,0x95,
+	0x93,0x63,0xF0,0xA7,0x6A,0x85,0x02,0x4B,0xE0,0x9C,0xA9,
+	0xD4,0xF0,0xB1,0x89,0x4C,0xAF,0x2D,0xBB,0x53,0x58,0x6C,
+	0x16,0x56,0x98,0xA6,0x37,0x7B,0x17,0xD0,0x58,0xA0,0xDE,
+	0x2E,0x24,0x22,0xF3,0x2E,0xB8,0xD0,0x53,0xF6,0x29,0x73,
+	0xAD,0x6C,0x8F,0x68,0x29,0xED,0xD4,0x1D,0xA4,0xBC,0x09,
+	0x31,0xD0,0x3A,0x3D,0x4D,0xA1,0x6B,0xF5,0xEC,0x3D,0x14,
+	0x94,0x2E,0xEC,0x7B,0x03,0xE5,0xF5,0xFE,0x14,0x1D,0x3B,
+	0xD3,0xAC,0xEA,0x22,0xD6,0xEB,0xF0,0x0B,0x90,0x46,0x61,
+	0x45,0x9A,0xA3,0x45,0xDE,0x3A,0xBD,0xC9,0xAB,0x87,0x54,
+	0xAE,0x34,0x4E,0x3F,0xC3,0xBF,0xCD,0x5E,0x07,0x2E,0xB6,
+	0xB0,0x7A,0xF2,0x21,0xE5,0x2E,0x9B,0x50,0xA6,0x07,0x6A,
+	0x61,0x9D,0x91,0xAE,0x35,0xCA,0x1F,0x8D,0x7C,0xAB,0xD3,
+	0x0C,0x5A,0x9B,0xD4,0x51,0xD4,0x22,0xCE,0xC7,0xDC,0x92,
+	0xC0,0x29,0x7D,0xBF,0x51,0xE7,0xF9,0x5A,0x48,0xA3,0xEE,
+	0x98,0xFF,0x58,0x8C,0x9E,0xD1,0xB5,0xF6,0x27,0xEA,0xF8,
+	0xD5,0x86,0xB1,0x34,0x2D,0x77,0x05,0x54,0x89,0x8A,0x4A,
+	0x8F,0x9E,0xE8,0x0A,0x23,0x45,0xC2,0x17,0x63,0x5D,0x80,
+	0xEA,0xA8,0x60,0x34,0xA4,0x53,0xDF,0xE0,0xF4,0x43,0xFC,
+	0x0C,0x43,0x02,0x7B,0x9F,0x9F,0x90,0xBB,0x84,0x35,0x58,
+	0x67,0x12,0xBC,0xCC,0xCF,0x53,0xE6,0x5B,0x73,0xCB,0x4C,
+	0xA5,0xE6,0xDC,0x02,0xB3,0xD7,0x40,0x0B,0xCC,0xC8,0xCA,
+	0x2D,0xB0,0xB0,0xA4,0x85,0xEE,0x53,0xA9,0xD0,0x86,0x14,
+	0x79,0x9B,0xD0,0x34,0xC6,0xAF,0x4E,0x28,0xB3,0x9F,0x91,
+	0xDC,0x32,0x7D,0xD9,0xAF,0x30,0x4C,0x3C,0xBE,0x82,0x26,
+	0xC2,0x4A,0x1B,0x6D,0x9B,0x8D,0x6E,0x55,0xAD,0x69,0x75,
+	0xB4,0x40,0x69,0x9E,0xF5,0x0E,0xD0,0xBA,0xE9,0x6D,0xA5,
+	0x93,0x31,0xE1,0x53,0xDA,0x9A,0x8F,0x4D,0x6F,0xF3,0x16,
+	0x09,0x13,0x75,0x67,0x84,0x44,0xF6,0xC5,0x43,0xE4,0x3E,
+	0x85,0x79,0x25,0x89,0x93,0x63,0x3A,0xF1,0x4E,0x5E,0x56,
+	0x71,0x30,0xE4,0x37,0x00,0xBA,0x19,0xCB,0x3A,0x4B,0x8E,
+	0x68,0xB7,0x3F,0xE2,0x26,0x47,0xB4,0xF4,0x7E,0x7A,0x5E,
+	0x28,0x18,0x1D,0x10,0xED,0xD3,0xEB,0xBD,0xE5,0x91,0xCB,
+	0x95,0x1D,0x08,0x22,0xFE,0x4B,0x6D,0x9B,0x26,0xD7,0xB3,
+	0x51,0xCF,0xB5,0xC1,0x82,0xD0,0xE5,0xE0,0xAA,0x9E,0x4D,
+	0x53,0x99,0x3E,0x32,0x41,0x59,0xB4,0xD0,0xA5,0x6E,0xA4,
+	0xB5,0x11,0xF5,0xC0,0x88,0xE0,0x7C,0x31,0x7D,0x63,0xBF,
+	0x67,0xE6,0xF4,0xFA,0x32,0xB3,0x90,0xA6,0x3B,0x3D,0xBD,
+	0xAE,0x6C,0x99,0x5A,0x40,0xCF,0x08,0x1E,0x3D,0x4A,0xAC,
+	0x23,0x4A,0x66,0x6B,0x4D,0xCA,0x8C,0x97,0xE4,0x5F,0x13,
+	0x47,0xC5,0x36,0x0C,0xF9,0xAC,0xF8,0x43,0x35,0xDB,0x3D,
+	0x7C,0x05,0xA4,0x59,0xB5,0x0C,0x8F,0x51,0x3E,0x25,0xDF,
+	0x1A,0x59,0x45,0x46,0x34,0xBC,0xE1,0x3B,0xBB,0x1A,0x37,
+	0xA2,0xAB,0x0F,0x90,0xFF,0xBE,0x96,0xEF,0x7D,0x87,0xBD,
+	0xB6,0x87,0x2F,0xDC,0xFE,0x8D,0x76,0xA6,0x80,0x82,0xFE,
+	0x5C,0x74,0x5C,0x3A,0x0A,0xEB,0x83,0x6D,0x5C,0x96,0xA5,
+	0xB9,0x97,0xDD,0xDB,0xA8,0xB5,0xD6,0x50,0x49,0x91,0x5F,
+	0x2A,0x6C,0x1F,0xF2,0xAF,0x91,0x15,0x16,0x1A,0x5A,0x74,
+	0x61,0xD3,0xB0,0x21,0xAE,0x1E,0xB6,0xAA,0x87,0xE6,0x5A,
+	0x09,0xA2,0x90,0x0E,0x21,0xD1,0xD1,0xAF,0xED,0x81,0x9F,
+	0x0A,0xD4,0xE9,0x03,0x51,0x7D,0xA9,0x01,0x6C,0x65,0x15,
+	0x43,0xD9,0x9B,0x5E,0xB2,0x67,0x4F,0xAF,0x2B,0x35,0x64,
+	0xD3,0xBA,0x6D,0xC6,0x40,0x5D,0x4A,0xEB,0x09,0xC4,0x00,
+	0x86,0x1D,0xC4,0xCE,0xBE,0xE0,0x8A,0xB6,0x86,0x75,0x75,
+	0xEB,0xA3,0xC4,0xEE,0x65,0x39,0xC1,0x06,0xDA,0xCA,0x0E,
+	0x3A,0x8D,0xEF,0xD8,0xD8,0xB1,0x76,0x0B,0xFB,0x20,0x0C,
+	0xF2,0x72,0xF7,0x68,0x96,0x4D,0x7D,0xB0,0xEE,0x89,0x02,
+	0x5C,0xF8,0xE6,0x80,0x6C,0xD4,0x35,0x61,0xC9,0x4C,0x6F,
+	0xF3,0x5C,0x99,0x4D,0x97,0xE8,0x69,0x2B,0xDB,0x91,0xC3,
+	0xFA,0xCF,0xA6,0x58,0x5B,0xAD,0x6C,0xF7,0x97,0x25,0xB0,
+	0xEA,0x6B,0xA1,0xA0,0x04,0x23,0x6D,0x9C,0xB2,0x0F,0x9E,
+	0xC0,0x75,0x46,0x92,0x4D,0x13,0xA1,0x67,0x20,0x98,0xF9,
+	0x16,0x61,0x22,0xD0,0x04,0x8F,0x36,0x24,0x2A,0xCA,0x0E,
+	0x1D,0x69,0x28,0xD0,0xC3,0x19,0x6D,0x1A,0x3E,0xAB,0xD0,
+	0x22,0x9F,0x66,0x31,0x0D,0x63,0xC7,0xD0,0x40,0xD7,0x93,
+	0x19,0x5D,0xEC,0x24,0xC5,0x44,0x92,0x6B,0x7A,0xC9,0x5E,
+	0x6A,0xC0,0xB0,0x2E,0x1D,0x10,0x88,0xBF,0x3D,0x4E,0xFC,
+	0xDD,0xC1,0x36,0x47,0x47,0x43,0x81,0x29,0x83,0xA8,0x7B,
+	0x4D,0x0D,0x05,0xA3,0x59,0x2A,0x8D,0x5D,0xC6,0xD9,0x71,
+	0x99,0x60,0x27,0x74,0xA5,0x9E,0xAE,0x34,0x6E,0x33,0xD2,
+	0x95,0x66,0x8C,0x73,0xA5,0x95,0x8E,0x15,0xC6,0xD2,0x95,
+	0xF6,0x40,0xDD,0x71,0xBA,0x24,0x83,0x2E,0xB1,0xC0,0xFB,
+	0x96,0x8D,0x2A,0x61,0x8C,0xC8,0x65,0xEA,0x11,0x0A,0x79,
+	0xC0,0x11,0x6A,0x74,0xA9,0x31,0x7F,0x9B,0x30,0xB1,0x6A,
+	0x89,0x2E,0x98,0xAF,0xA7,0x69,0xD9,0xE5,0x89,0xEC,0x7C,
+	0x8C,0xB6,0x39,0xC5,0x42,0x43,0xF5,0xD4,0xCA,0x83,0xB7,
+	0x14,0x0D,0xBF,0x5F,0x9E,0x19,0x9E,0xFB,0xB7,0xE0,0x51,
+	0x5D,0x3D,0x22,0x06,0xED,0x08,0xCA,0x42,0x35,0x86,0x3C,
+	0x40,0xDB,0x98,0x54,0x98,0x47,0x55,0xB3,0xFD,0x38,0xC4,
+	0x10,0x95,0xFB,0x80,0xB9,0x40,0x5F,0xD9,0xC6,0x6E,0xA6,
+	0xCA,0x10,0x6E,0x89,0x95,0x4D,0xEC,0xC1,0x78,0x6F,0xE3,
+	0xB0,0xA6,0xAC,0xAF,0xF2,0x0D,0x96,0x37,0x51,0x48,0xE0,
+	0xF6,0xDB,0xA4,0x2B,0x9C,0x34,0xC1,0x49,0x17,0xEB,0x9B,
+	0x5B,0x9A,0x0F,0x6C,0x6C,0x59,0x6B,0x1D,0xF1,0x72,0x92,
+	0xBD,0x49,0x74,0x58,0x5F,0x95,0x4F,0x5F,0x68,0xA9,0x6D,
+	0x55,0xD0,0x2F,0x50,0xE2,0xB7,0xC2,0x46,0xA7,0x7D,0xA8,
+	0xA7,0x67,0x58,0x4C,0xC5,0x30,0xC5,0x51,0x5C,0xBD,0xD7,
+	0x35,0x48,0xCF,0x01,0xF9,0x6C,0x30,0xB3,0x85,0xD6,0x23,
+	0x2B,0x6D,0xFA,0x80,0xC7,0xAC,0xBE,0xAF,0xBD,0xB7,0xA7,
+	0x9A,0xF6,0x0E,0x63,0x6F,0x4D,0x92,0xCF,0x44,0xAA,0xAC,
+	0x90,0x4F,0x16,0xFF,0x04,0x64,0xBD,0x00,0x65,0x70,0x9D,
+	0x9E,0x5C,0x38,0x4F,0x61,0x0E,0x72,0x36,0x7A,0x38,0x20,
+	0x1A,0xFC,0xDD,0xB1,0xE9,0x8D,0xA5,0xCB,0x60,0x79,0xE8,
+	0x21,0x88,0xEF,0x29,0xBD,0x60,0xF5,0xFF,0x39,0x46,0xBD,
+	0x03,0xD3,0x1B,0xBD,0x77,0x0B,0x3E,0xEB,0x94,0x46,0xDD,
+	0xC1,0x6C,0x7A,0x79,0x10,0x7C,0x85,0x86,0x44,0xC8,0xEC,
+	0xF9,0x51,0x3F,0x17,0xD3,0xF1,0xB9,0x02,0x34,0x81,0x3B,
+	0x2A,0x2C,0x67,0x5A,0x7A,0x46,0x77,0x32,0x7F,0x9D,0x90,
+	0x59,0x6D,0x07,0x86,0x75,0x46,0xE2,0x99,0x3A,0xBD,0xD5,
+	0x3B,0x09,0x4D,0xA0,0x5D,0xFE,0x16,0x38,0x6F,0x2A,0xDD,
+	0xB2,0xD3,0x44,0xE4,0x5F,0xED,0x84,0xC1,0x7E,0x96,0x44,
+	0xDE,0x20,0x91,0x17,0x89,0x5C,0x28,0xA4,0xE8,0x0E,0xC3,
+	0x42,0x1C,0x0E,0xB6,0x41,0x49,0x42,0xC7,0xCE,0xD3,0xD3,
+	0xF9,0x26,0x74,0x28,0xB0,0x73,0x33,0xC9,0xA5,0x37,0x40,
+	0xD9,0x00,0x43,0x61,0x94,0xDE,0x65,0xA4,0x9F,0xB1,0x37,
+	0xA6,0x77,0x41,0xF7,0x0E,0xA0,0x54,0x97,0x8C,0x5A,0xCA,
+	0x7C,0x1B,0xAB,0x35,0x0B,0xC4,0x4D,0x49,0x86,0xC2,0x73,
+	0x74,0xC8,0xBF,0xCF,0x9E,0x9A,0x0C,0x23,0x54,0x52,0x4F,
+	0xCF,0x67,0x1B,0x6E,0x46,0x5B,0xF0,0x74,0xB9,0x9E,0x2D,
+	0x8D,0xE5,0x6C,0x15,0x50,0x2B,0x2D,0x33,0xB2,0x27,0x58,
+	0x87,0xF3,0xEA,0x9A,0x19,0xD0,0x25,0x3A,0x3A,0xE2,0xC7,
+	0x8F,0x96,0x62,0xF2,0x77,0xEA,0x88,0xDC,0x3B,0xE5,0x30,
+	0xC3,0xF1,0x57,0x74,0x45,0x3B,0xFD,0xFB,0x75,0x3A,0x38,
+	0xDC,0x07,0x75,0xCC,0x55,0xFD,0x37,0x9A,0xC2,0x86,0xE9,
+	0x18,0x31,0xCC,0x31,0x18,0x66,0x62,0x7C,0x98,0xF1,0xE1,
+	0x7C,0xC5,0xDE,0x4E,0xB7,0x61,0xB1,0x2B,0x05,0x56,0x5B,
+	0x78,0x42,0x52,0xB5,0xFC,0x06,0x48,0x3B,0x31,0x62,0x17,
+	0x1D,0x72,0x08,0x06,0x57,0xA9,0x5B,0xE9,0x19,0xF4,0xFC,
+	0x42,0xB6,0xD1,0xFE,0x48,0x0C,0x2A,0x62,0x3C,0xDB,0x9F,
+	0xB6,0xCC,0xD0,0x13,0xFE,0x58,0x7F,0xAD,0xCE,0x63,0x8B,
+	0xBF,0x0F,0x61,0x5B,0xDD,0xBD,0x72,0x1F,0x6C,0x9C,0x2D,
+	0xFC,0x9A,0x8E,0xED,0x15,0x1F,0x07,0x5D,0xF2,0x2E,0x6D,
+	0xF7,0x9F,0x9D,0x8B,0xE2,0xED,0xB4,0xDD,0x16,0x7E,0x5D,
+	0x61,0xBB,0xCE,0x63,0x1D,0x2D,0xEC,0xF8,0x47,0x1D,0x3B,
+	0x3C,0x51,0x6B,0x61,0xFB,0x12,0xEC,0xA8,0x8A,0x1C,0x61,
+	0x1B,0xFA,0x28,0xA8,0x79,0x29,0x1D,0xAB,0xB7,0xB1,0xE6,
+	0x15,0xF5,0xD6,0xB8,0x68,0x21,0x15,0x55,0xB5,0xB5,0x43,
+	0x21,0x4A,0xE6,0x2B,0xF6,0x1A,0x3B,0x8B,0xDF,0xA7,0x74,
+	0x6B,0x6F,0x16,0x59,0x86,0x96,0x78,0xC3,0x4E,0xDB,0x22,
+	0xAF,0x7C,0x41,0x43,0x0B,0x69,0xDD,0xB7,0x94,0x35,0xC9,
+	0xC7,0xB0,0xFE,0x16,0xB1,0xB5,0xB3,0xB3,0x3B,0xB9,0x46,
+	0x3D,0x9C,0xA1,0x30,0x3E,0xC1,0x87,0x4D,0x86,0x69,0x19,
+	0x05,0xCD,0x7A,0x94,0x71,0xE9,0x4B,0x4D,0xCB,0xC2,0x80,
+	0x2C,0x67,0x6F,0xF3,0x6F,0xA3,0xCC,0xCD,0xE5,0x6F,0x55,
+	0x73,0xAB,0xF2,0xED,0x50,0x3E,0xF5,0x19,0x0D,0xF9,0x08,
+	0xFA,0x1A,0xF2,0x4F,0xB3,0x4B,0x3F,0xBB,0x0C,0x40,0x05,
+	0xE5,0x0F,0xD2,0xFC,0x58,0x40,0xCE,0xA0,0xF9,0xBD,0x14,
+	0x76,0x8E,0xF6,0xB2,0xB5,0xBF,0xD2,0x7D,0xAF,0x48,0xD9,
+	0xEB,0xA1,0x9D,0x1A,0xDA,0x32,0xBD,0xFC,0xBB,0x45,0xDA,
+	0x4B,0x2C,0x74,0x1D,0xF2,0xA4,0x51,0x51,0x58,0x39,0x5A,
+	0x48,0xD4,0xB5,0x25,0xE8,0xA1,0x9D,0x56,0xD9,0x79,0xA3,
+	0x90,0xC8,0xD4,0x05,0x7B,0xB5,0xC0,0x36,0xD2,0xD9,0x41,
+	0x3D,0x5A,0x17,0xA8,0x33,0xC0,0xF0,0x43,0x15,0x27,0x38,
+	0x42,0x4B,0xEF,0x15,0x6D,0xE1,0x1D,0xCA,0xF4,0xA6,0x92,
+	0x1F,0x3A,0x5A,0x82,0x87,0xE9,0xD8,0x40,0x5D,0x66,0xEE,
+	0xD8,0x92,0xE3,0x1A,0xD6,0x97,0xEC,0xAC,0x16,0xAD,0x43,
+	0x75,0x56,0xB6,0xB1,0xC5,0x23,0xD5,0xE8,0x08,0xDA,0x4C,
+	0xA9,0x93,0x5B,0x16,0xC5,0xDF,0x36,0x68,0x55,0xB7,0x32,
+	0x02,0x46,0x05,0x66,0xAE,0xB2,0xC7,0x78,0xCB,0xD0,0x9B,
+	0xAD,0x7B,0x1B,0xAB,0xB8,0x58,0x65,0x4B,0xD8,0xCF,0x8E,
+	0xE9,0x9C,0x44,0x45,0xB6,0x8F,0xD3,0x66,0xC8,0x5C,0x65,
+	0xCF,0x05,0x94,0xB2,0x03,0xAE,0xB4,0xCD,0x16,0x2E,0x19,
+	0xA5,0xEE,0x27,0xED,0xA7,0xF5,0x33,0x06,0x94,0xB2,0xBA,
+	0xE9,0xA2,0x77,0xD7,0x14,0x11,0x8B,0xAF,0xAA,0x20,0x36,
+	0xBD,0xAD,0xEC,0x23,0xCD,0xCA,0x71,0xB1,0x38,0x83,0x93,
+	0x34,0xBB,0x03,0x79,0xE4,0x6F,0xC7,0xE3,0x4A,0xED,0x9D,
+	0x4F,0x62,0xD5,0xDA,0x98,0xAE,0x6D,0x7A,0x03,0x3F,0x3F,
+	0xC0,0xC5,0x20,0x74,0x10,0x1F,0x5D,0xA2,0xC1,0x17,0x6B,
+	0x48,0xD0,0xEC,0x0F,0x3B,0x2A,0x69,0xD5,0x51,0x28,0x52,
+	0x8B,0xA2,0x54,0xE5,0xAB,0xE2,0x3A,0x33,0x7C,0xFD,0x00,
+	0xFB,0xB8,0x77,0x81,0x32,0xFD,0x8C,0x37,0xFE,0xE6,0x0C,
+	0x93,0xF6,0x7A,0x9C,0x83,0xD3,0x7B,0x4B,0x7F,0x25,0x47,
+	0x02,0xBE,0xD8,0xC4,0x52,0x43,0x64,0xEA,0x30,0x16,0x6A,
+	0x84,0xE2,0x39,0x13,0x26,0x31,0x38,0x6E,0xF5,0x5A,0x66,
+	0x02,0xA8,0x93,0x5F,0x65,0xAF,0x6F,0x20,0xA2,0xE2,0xF6,
+	0x99,0x4C,0x5F,0x39,0xFA,0x37,0xB6,0xAC,0xD3,0x43,0x54,
+	0xF7,0xA9,0x5F,0x1A,0xED,0x4E,0xA4,0xBD,0xDA,0xD1,0x1B,
+	0x23,0xD9,0xA5,0x28,0xC8,0x79,0xF5,0xA8,0xDC,0x1D,0xDF,
+	0xAE,0x49,0xCA,0xF2,0xE8,0xEF,0x6D,0x14,0xD8,0x0A,0x6A,
+	0x32,0x33,0x89,0x3F,0x1D,0x6C,0xF7,0xCF,0x4F,0xCA,0x42,
+	0x49,0x22,0x7F,0x1C,0x29,0x94,0xBA,0x98,0x02,0x54,0x0F,
+	0x96,0xA4,0xF6,0x37,0x28,0x1E,0x7B,0xB0,0xBD,0x3C,0xAF,
+	0x46,0x4F,0xCA,0x97,0xEB,0xDC,0x98,0x61,0x77,0x63,0xB0,
+	0x1D,0x43,0x29,0x9F,0xE8,0x1E,0x52,0xCF,0xD9,0xEC,0x24,
+	0x61,0x90,0x3B,0x54,0xCF,0xB5,0x93,0x2A,0x6F,0x07,0x3D,
+	0x5A,0xC9,0x76,0xEA,0xA1,0x75,0x07,0x6F,0x6C,0x71,0x9E,
+	0xBD,0xD9,0xA9,0xBD,0x86,0x6A,0x0D,0xB6,0x55,0x3C,0x33,
+	0x91,0x45,0x38,0xE5,0xB0,0xC2,0x83,0x1C,0x56,0x54,0x3B,
+	0xDB,0x05,0xAA,0x57,0xD4,0x4F,0x57,0x0A,0x36,0x84,0xF8,
+	0x33,0x02,0xD7,0x26,0xB8,0x0E,0x69,0xBA,0x56,0x3B,0xB1,
+	0x15,0x88,0x5A,0x18,0x25,0x6B,0x93,0x6C,0xE1,0x6A,0x85,
+	0x9D,0xCE,0x42,0x49,0xF0,0xF0,0xD9,0xB6,0x39,0xF5,0xC6,
+	0xEB,0x64,0x19,0x1D,0xD7,0xB2,0x71,0xA9,0xAF,0x3D,0x52,
+	0x7E,0x78,0x7F,0xDE,0x78,0xAF,0x61,0x8E,0xFC,0x95,0xF1,
+	0xD6,0xF2,0x44,0xF9,0x2C,0xDD,0xA7,0x9E,0xA5,0x60,0x87,
+	0x4F,0xA3,0xEA,0xE1,0xD3,0xB0,0xA3,0xBD,0x9A,0x9D,0x92,
+	0x88,0x2F,0xCC,0x8A,0x5F,0xBD,0x9B,0xEE,0xEF,0xD6,0xE5,
+	0x40,0x30,0x98,0xE4,0x46,0x26,0x98,0x69,0x28,0x3E,0xA2,
+	0x79,0x0B,0xD5,0xB7,0x2D,0xDB,0x49,0x95,0xEF,0x77,0x18,
+	0x0C,0xF5,0x46,0x05,0xAF,0x95,0x42,0x6F,0xC1,0xF9,0xF4,
+	0x22,0xD4,0xF8,0x88,0x7A,0xFB,0xAB,0xBC,0xFD,0x82,0xFA,
+	0x0A,0x5E,0x68,0x12,0xC4,0x1B,0x3B,0x9C,0xB9,0x69,0x25,
+	0x16,0xA1,0x4D,0xA8,0x63,0x63,0xBE,0xE9,0x05,0xC0,0x73,
+	0x80,0x97,0x01,0x4E,0x78,0x14,0xA8,0x22,0x1C,0x16,0x3E,
+	0x8B,0x4C,0x23,0x90,0xA3,0x74,0xA1,0x55,0xA8,0xBD,0xB1,
+	0xE3,0xC6,0xFD,0xAC,0x4D,0xBB,0xB0,0x8F,0xB5,0x91,0x0F,
+	0x0A,0xCD,0x42,0xC3,0x8D,0xFB,0x6F,0x54,0x58,0xE6,0x7E,
+	0x61,0x40,0xCD,0xFC,0x6F,0x84,0x76,0xB0,0x1D,0x47,0x05,
+	0x5F,0x3F,0x75,0x7D,0x54,0xF1,0x1F,0x2A,0xFB,0xA0,0x3F,
+	0x15,0x6E,0xA0,0x3C,0x5D,0x7D,0xDD,0xF6,0x84,0x82,0x55,
+	0x7E,0x6E,0xE3,0x7E,0xFE,0x6B,0x78,0x74,0x5F,0x05,0xB8,
+	0x01,0x45,0x3B,0x94,0x54,0x91,0xB8,0xD7,0x1D,0x55,0xB8,
+	0x68,0x39,0x38,0xC3,0x87,0xD9,0x87,0xFC,0x2E,0xEB,0xD0,
+	0xE7,0x36,0xC3,0x7B,0xF9,0x08,0x20,0x7D,0x56,0x8C,0x09,
+	0x9E,0x4E,0xC0,0x67,0xB3,0xB0,0x4F,0x54,0xD6,0x4E,0xE4,
+	0x4D,0xC0,0xA8,0xDF,0xB8,0x5F,0xFD,0xB8,0x29,0xA6,0x78,
+	0x07,0x6D,0xE1,0x70,0x8C,0xB5,0xEE,0x95,0x77,0xC1,0xF1,
+	0x52,0xA6,0x7C,0x41,0xA3,0xBB,0x09,0x19,0xFF,0x19,0x3D,
+	0xC7,0x6E,0x47,0xE9,0x79,0x76,0x6B,0xA0,0x03,0x55,0x6B,
+	0x75,0x98,0x14,0x78,0xED,0xF2,0x9E,0x0B,0x82,0x71,0x41,
+	0x26,0x5A,0xD9,0xAE,0x9F,0x28,0x20,0xF4,0x72,0x0F,0x42,
+	0x3A,0xD8,0xE8,0xC7,0x96,0x24,0x3E,0xFF,0x4C,0x33,0x44,
+	0xE4,0x39,0x55,0x4C,0xC6,0x0A,0xCD,0xDA,0x3B,0x49,0xC4,
+	0x7B,0xBF,0x9A,0x68,0xC9,0x2E,0x9F,0xC8,0x41,0x0E,0x25,
+	0x08,0xCA,0x7E,0x4D,0x50,0xB2,0x2B,0x8C,0x7F,0x2F,0x28,
+	0x07,0xF4,0xDA,0x80,0x54,0x69,0xF1,0x59,0x98,0xB8,0xB4,
+	0xAC,0x4D,0x86,0x13,0xC2,0x8E,0x16,0x32,0x89,0x91,0xDB,
+	0x21,0x30,0xED,0x6C,0xCF,0xB5,0x2D,0xD0,0x4E,0xE6,0xC8,
+	0x3D,0x8D,0xDA,0x81,0x0F,0xF6,0xA2,0xD4,0x9E,0x60,0x27,
+	0x93,0x7B,0xE1,0x11,0xD5,0x31,0x97,0xCA,0x63,0x53,0x4F,
+	0xCD,0x63,0xDD,0x13,0xFB,0xF4,0xA6,0xB2,0x2B,0xD8,0x22,
+	0x0A,0x9A,0x8A,0xED,0x8E,0x8E,0x1F,0xAB,0x87,0xE1,0xDB,
+	0xA6,0xE2,0x01,0xFA,0xA2,0x6D,0xFD,0x79,0xB8,0x8F,0x7F,
+	0x92,0xDB,0xA6,0x34,0xA9,0x1A,0x03,0x6E,0x65,0xC6,0x2A,
+	0x7B,0x6B,0x57,0x4E,0x3F,0xD0,0xF9,0x8F,0xA5,0x4C,0x69,
+	0xA2,0x75,0xB6,0xF0,0xC1,0x68,0xB5,0xAE,0xE9,0x3A,0x33,
+	0x3C,0x88,0xAB,0xBA,0xD8,0x69,0x9B,0xEB,0xFA,0xE4,0x0F,
+	0x86,0x94,0x3C,0x94,0x18,0xCD,0xD8,0x6A,0x5F,0xD6,0x48,
+	0x16,0x67,0x2E,0x2C,0xBA,0x41,0x11,0x1A,0x9B,0xBB,0x0D,
+	0x87,0xD7,0x8B,0x3F,0xC8,0xAF,0xDC,0x1F,0xAC,0x0D,0xFF,
+	0x90,0x2C,0xCA,0x5C,0x2C,0x9C,0xDC,0xEB,0x36,0xBD,0xF1,
+	0x6C,0xC1,0x68,0x9A,0x48,0xE7,0xB3,0xD7,0x60,0xB4,0xCC,
+	0x42,0xD7,0x59,0x9F,0x2D,0x30,0x3F,0x5B,0x60,0x7B,0x16,
+	0x2E,0x53,0x81,0x3D,0xB0,0xC7,0x38,0x69,0x45,0xA3,0x69,
+	0x11,0xB4,0x6D,0x9B,0x52,0x66,0x83,0xE5,0x9D,0x6F,0x14,
+	0x96,0x98,0x84,0x32,0x8B,0xB0,0xCE,0x2A,0x3C,0x61,0x0E,
+	0x16,0xD8,0x85,0x95,0xFA,0x49,0x8D,0x12,0x11,0x25,0x9D,
+	0x28,0xE9,0xC5,0x4F,0xAB,0x45,0xC9,0x28,0x4A,0x09,0xA2,
+	0x64,0x12,0xA5,0x44,0x51,0x32,0x8B,0xD2,0x28,0x51,0xB2,
+	0x88,0x52,0x92,0x28,0x59,0x45,0x29,0x59,0x94,0x6C,0xA2,
+	0x94,0x22,0x4A,0x76,0x51,0x4A,0x15,0xA5,0xD1,0xA2,0x34,
+	0x46,0x94,0xD2,0x44,0x29,0x5D,0x94,0x32,0x44,0x69,0xAC,
+	0x28,0x8D,0x13,0xA5,0xF1,0xA2,0x34,0x41,0x94,0x2E,0x13,
+	0xA5,0x89,0xA2,0x74,0xB9,0x28,0x65,0x8A,0xD2,0x24,0x51,
+	0xCA,0x12,0xA5,0x2B,0x44,0xE9,0x4A,0x51,0xFA,0x81,0x28,
+	0x4D,0x16,0x23,0x41,0x7D,0xE4,0x3F,0xF4,0xD2,0xD5,0xA2,
+	0x74,0x8D,0x28,0x4D,0x11,0xA5,0x6B,0x45,0x69,0xAA,0x28,
+	0xFD,0x50,0x94,0xAE,0x13,0xA5,0x69,0xA2,0x74,0xBD,0x28,
+	0xE5,0x88,0x92,0x43,0x94,0x6E,0x10,0xA5,0x1B,0x45,0xE9,
+	0x26,0x51,0xFA,0x37,0x51,0x72,0x8A,0xD2,0xCD,0xA2,0xF4,
+	0x23,0x51,0x9A,0x2E,0x4A,0xB7,0x88,0x52,0xAE,0x28,0xE5,
+	0x89,0xD2,0x0C,0x51,0x9A,0x29,0x4A,0xB3,0x44,0x69,0xB6,
+	0x28,0xDD,0x2A,0x4A,0xB7,0x89,0xD2,0x1C,0x51,0xCA,0x17,
+	0xA5,0xB9,0xA2,0xC4,0x89,0x52,0x81,0x28,0xDD,0x2E,0x4A,
+	0x77,0x88,0xD2,0x9D,0xA2,0xF4,0x63,0x51,0x9A,0x27,0x4A,
+	0x77,0x89,0x52,0xA1,0x28,0xCD,0x17,0xA5,0x22,0x51,0x5A,
+	0x20,0x4A,0x0B,0x45,0x69,0x91,0x28,0xDD,0x2D,0x4A,0x8B,
+	0x45,0xC9,0x25,0x4A,0x4B,0x44,0xE9,0x1E,0x51,0x5A,0x2A,
+	0x4A,0xCB,0x44,0xE9,0x5E,0x51,0x5A,0x2E,0x4A,0x2B,0x44,
+	0xC9,0x2D,0x4A,0x2B,0x45,0xE9,0x3E,0x51,0xBA,0x5F,0x94,
+	0x1E,0x10,0xA5,0x07,0x45,0x69,0x95,0x28,0x3D,0x24,0x4A,
+	0xC5,0xA2,0xF4,0xB0,0x28,0x3D,0x22,0x4A,0x8F,0x8A,0xD2,
+	0x63,0xA2,0xF4,0xB8,0x28,0xFD,0x44,0x94,0x7E,0x2A,0x4A,
+	0xAB,0x45,0xE9,0x09,0x51,0x5A,0x23,0x4A,0x3F,0x13,0xA5,
+	0x12,0x51,0x2A,0x15,0x25,0x8F,0x28,0xF1,0xA2,0xE4,0x15,
+	0xA5,0x32,0x51,0xFA,0xB9,0x28,0xFD,0x42,0x94,0x9E,0x14,
+	0xA5,0x7F,0x17,0xA5,0xB5,0xA2,0xF4,0x4B,0x51,0xF2,0x89,
+	0xD2,0x3A,0x51,0xF2,0x8B,0xD2,0x7A,0x51,0x7A,0x4A,0x94,
+	0x02,0xA2,0xB4,0x41,0x94,0x36,0x8A,0xD2,0xD3,0xA2,0xF4,
+	0x8C,0x28,0x95,0x8B,0x12,0x15,0xA5,0x0A,0x51,0x12,0x44,
+	0xA9,0x52,0x94,0xAA,0x44,0x29,0x28,0x4A,0xCF,0x8A,0x12,
+	0xA6,0xE9,0x39,0x51,0x7A,0x5E,0x94,0x5E,0x10,0xA5,0x17,
+	0x45,0xE9,0x3F,0x44,0xE9,0x25,0x51,0x7A,0x59,0x94,0x5E,
+	0x11,0xA5,0x57,0x45,0xE9,0x35,0x51,0x7A,0x5D,0x94,0xDE,
+	0x10,0xA5,0x37,0x45,0xE9,0x2D,0x51,0xFA,0x95,0x28,0xBD,
+	0x2D,0x4A,0x9B,0x44,0xE9,0x1D,0x51,0xDA,0x2C,0x4A,0x5B,
+	0x44,0xE9,0x5D,0x51,0x7A,0x4F,0x94,0xFE,0x8F,0x28,0x6D,
+	0x15,0xA5,0xFF,0x14,0xA5,0xF7,0x45,0xE9,0xBF,0x44,0xE9,
+	0xD7,0xA2,0xF4,0x7F,0x45,0xE9,0x03,0x51,0xFA,0x8D,0x28,
+	0x7D,0x28,0x4A,0xDB,0x44,0xE9,0x23,0x51,0xFA,0xAD,0x28,
+	0x6D,0x17,0xA5,0xDF,0x89,0xD2,0xEF,0x45,0xE9,0x0F,0xA2,
+	0x54,0x23,0x4A,0x1F,0x8B,0xD2,0x0E,0x51,0xDA,0x29,0x4A,
+	0x9F,0x88,0xD2,0x7F,0x8B,0xD2,0x2E,0x51,0xDA,0x2D,0x4A,
+	0x21,0x51,0xAA,0x15,0xA5,0x3A,0x51,0x12,0x45,0x69,0x8F,
+	0x28,0xED,0x15,0xA5,0x7A,0x51,0x6A,0x10,0xA5,0x7D,0xA2,
+	0xB4,0x5F,0x94,0x0E,0x88,0x52,0xA3,0x28,0x7D,0x2A,0x4A,
+	0x92,0x28,0x1D,0x14,0xA5,0xCF,0x44,0xA9,0x49,0x94,0x9A,
+	0x45,0xA9,0x45,0x94,0x5A,0x45,0xE9,0x73,0x51,0xFA,0xA3,
+	0x28,0x1D,0x12,0xA5,0x2F,0x44,0xA9,0x4D,0x94,0x0E,0x8B,
+	0x52,0xBB,0x28,0x75,0x88,0xD2,0x11,0x51,0xFA,0x93,0x28,
+	0x75,0x8A,0xD2,0x51,0x51,0xEA,0x12,0xA5,0x3F,0x8B,0xD2,
+	0x31,0x51,0xEA,0x16,0xA5,0x1E,0x51,0xFA,0x8B,0x28,0x1D,
+	0x17,0xA5,0xBF,0x8A,0x52,0x58,0x94,0x22,0xA2,0x74,0x42,
+	0x94,0x64,0x51,0x3A,0x29,0x4A,0x7F,0x13,0xA5,0x53,0xA2,
+	0xF4,0xA5,0x28,0xF5,0x8A,0xD2,0x57,0xA2,0x74,0x5A,0x94,
+	0xCE,0x88,0x52,0x9F,0x28,0x7D,0x2D,0x4A,0xFD,0xA2,0x74,
+	0x56,0x94,0x06,0x44,0xE9,0x9C,0x28,0x45,0x45,0xE9,0xBC,
+	0x28,0x0D,0x8A,0xD2,0x37,0xA2,0x14,0x13,0x25,0x45,0x94,
+	0xAE,0x2A,0x35,0xBC,0x79,0x4E,0x7C,0x13,0xC5,0xD9,0x43,
+	0x29,0xA8,0x16,0x33,0xFB,0x2E,0xCF,0xC0,0xFC,0x2B,0x38,
+	0x6B,0xE5,0x75,0xEA,0x57,0xBE,0x3B,0xD8,0xE2,0xD6,0x95,
+	0xCE,0x8D,0x7F,0xA7,0xF8,0x88,0xDD,0x50,0x72,0x83,0xFF,
+	0x7C,0x11,0x6F,0xFC,0xC8,0x26,0x27,0xFA,0xCF,0x5F,0x59,
+	0x72,0xD9,0x47,0x63,0x50,0x56,0xDE,0xCA,0x3E,0x9B,0xAB,
+	0x78,0xE6,0x7D,0xFB,0x2B,0xB6,0xF0,0xF4,0xB6,0xEA,0x1A,
+	0xC4,0x4B,0xF7,0x36,0xFA,0xCF,0x67,0x95,0x18,0x3F,0x4A,
+	0x90,0x3B,0xFD,0xD1,0x31,0xDE,0xC3,0xF2,0x1F,0xCB,0x07,
+	0xD8,0xD9,0x82,0x85,0x4C,0x1B,0xBC,0xAE,0xD0,0x26,0xF6,
+	0x25,0xA1,0xAA,0x30,0x72,0x4D,0xBB,0xEC,0x25,0xF0,0x89,
+	0xD0,0x04,0x8E,0x54,0x46,0xD8,0xDE,0xDC,0x1D,0xCC,0x3C,
+	0x61,0xD7,0xB5,0x0A,0x89,0xEA,0x31,0x3E,0x55,0x0D,0xAA,
+	0x95,0x0C,0x4B,0xD5,0x2A,0xB6,0xE1,0x2A,0x8D,0x74,0xEC,
+	0x52,0xD5,0x86,0x31,0xDB,0xFF,0xDA,0xEC,0x3B,0x09,0xD1,
+	0x9E,0x1E,0x19,0x88,0x3F,0x56,0xAB,0x2E,0x58,0x2D,0x6D,
+	0x0A,0x44,0x15,0x4F,0xD2,0xFA,0x73,0x70,0x62,0xCD,0xEC,
+	0x3C,0xE1,0x97,0x0C,0xD3,0x01,0x47,0x07,0xD2,0xDC,0xA9,
+	0xA5,0x17,0xC2,0x15,0xB6,0x0D,0x75,0x88,0x1E,0xF5,0x17,
+	0xC7,0xE0,0x39,0x0F,0xC2,0x6D,0xA6,0xFB,0x16,0xAA,0x27,
+	0x9C,0xA7,0x9D,0x81,0x85,0x99,0xC0,0x3C,0xE7,0x24,0xCD,
+	0x73,0x86,0x9F,0xE3,0xB1,0x0D,0x1D,0xA6,0x58,0xCA,0x5C,
+	0xE7,0xAF,0x05,0xC4,0x4D,0xEC,0xA4,0xFE,0x82,0x5E,0xD4,
+	0xED,0xF1,0x23,0x82,0x90,0x77,0x68,0x43,0x34,0xC0,0x29,
+	0x8C,0x7F,0x3D,0xB9,0x60,0x48,0xEB,0xE5,0x66,0xAC,0xB6,
+	0x97,0xDC,0x4E,0x5B,0x11,0xC3,0x8A,0x29,0xAD,0x32,0xDB,
+	0x40,0xDC,0x49,0xEC,0x71,0x4E,0xB3,0xCF,0x95,0xEC,0x1F,
+	0x77,0x27,0x23,0xF8,0x3B,0xCC,0xF4,0xAC,0x4E,0x54,0xBF,
+	0x43,0x62,0x8A,0xF7,0xB2,0x10,0x6C,0x80,0x7D,0x48,0x65,
+	0x53,0xE8,0xDA,0x65,0xEA,0x97,0x08,0x42,0x5F,0xF5,0xF0,
+	0x01,0xC8,0x04,0xC2,0x42,0x01,0xE6,0x74,0x93,0x7C,0x38,
+	0x45,0xFB,0xFB,0xEB,0xFC,0x9E,0x44,0xF8,0x29,0x43,0x51,
+	0xEC,0x82,0x25,0xB4,0x99,0x36,0x80,0xB4,0xF5,0x0D,0x5B,
+	0xD2,0xA7,0xD4,0x7E,0xA8,0xBB,0xB5,0x20,0x58,0xB7,0xE4,
+	0xCC,0xFB,0x2B,0x57,0x2E,0x15,0x17,0x2C,0x5C,0x82,0x82,
+	0x8F,0x75,0x3A,0x07,0xC2,0xCF,0xDD,0x5B,0xD2,0x37,0xBF,
+	0x93,0xBE,0xF9,0xA4,0x3D,0x58,0x97,0x13,0x52,0x2B,0x2C,
+	0x5B,0x2A,0xAA,0x47,0xB3,0x98,0xE7,0x78,0xFB,0x8C,0x98,
+	0xE2,0x99,0x33,0xE3,0x1B,0x85,0x37,0x85,0x1B,0x94,0xC8,
+	0xC7,0x64,0xC6,0xA0,0xC2,0x4F,0x09,0x7F,0xA2,0xEC,0xF8,
+	0x15,0xA9,0x59,0x4F,0xC2,0x2F,0x2B,0x3B,0x06,0x49,0x4D,
+	0x17,0x09,0x07,0x35,0x2F,0xAE,0xC1,0xF4,0x4E,0x3A,0x82,
+	0x71,0xD3,0x49,0xFB,0x16,0x76,0x16,0x66,0xE8,0x47,0x5E,
+	0x02,0x24,0xF3,0xC6,0x50,0xB0,0x6D,0xFB,0x83,0xEC,0x13,
+	0xAB,0x52,0xFD,0x8D,0xCA,0x46,0x85,0xD7,0x0B,0x67,0x27,
+	0xD1,0x33,0x34,0xAA,0x1E,0x26,0xEA,0xF7,0xAC,0x0C,0x3F,
+	0xAC,0x04,0x8F,0x06,0xD8,0x37,0xB8,0x23,0x30,0xC1,0x1B,
+	0xE8,0x0C,0xCC,0x22,0x1E,0x7B,0xC5,0x12,0x5D,0x45,0x22,
+	0xFB,0x5C,0x3F,0x3C,0x59,0x99,0x33,0x47,0x8E,0x30,0x7B,
+	0x81,0xD8,0x93,0x61,0xAD,0xD1,0x3D,0x84,0x98,0xF3,0xE3,
+	0x44,0xB2,0x03,0xFE,0xA7,0x6F,0x20,0x23,0x51,0xBA,0x42,
+	0xE0,0xBE,0x41,0x2F,0x21,0xE1,0x2F,0x2B,0x26,0xA9,0xB3,
+	0x83,0xE1,0x39,0x42,0xDA,0x81,0x30,0x52,0x3A,0x8A,0xFD,
+	0x8A,0xC5,0xF9,0xC1,0x7B,0x64,0xFD,0xD4,0x50,0x23,0x21,
+	0xF1,0x23,0x91,0x2E,0x60,0x73,0xFA,0x67,0x36,0x59,0x09,
+	0x3F,0xD7,0x59,0x6F,0x6A,0xB2,0xEA,0xD4,0x1F,0x55,0x21,
+	0xBF,0x4C,0x40,0xED,0x37,0x38,0xF5,0xC1,0xF8,0xCB,0x54,
+	0x67,0x83,0x29,0x6C,0x7D,0x4A,0xEF,0xAC,0xCC,0x38,0x61,
+	0x85,0x13,0xB5,0x43,0xE7,0x7C,0x3B,0xCD,0xB6,0x55,0xC7,
+	0xA7,0xA9,0x05,0xEF,0x0E,0x17,0x6C,0xD2,0x45,0x5E,0xD1,
+	0x6D,0x35,0x7A,0x52,0x9D,0x9B,0x3A,0x93,0x9D,0x42,0xC6,
+	0x91,0xE4,0xA1,0xF3,0xA4,0xB6,0xF0,0x27,0xB7,0x31,0xFB,
+	0x18,0xBE,0xDE,0x16,0x3E,0x95,0xC3,0x52,0x27,0x6E,0x8E,
+	0xFF,0xD0,0xCB,0x38,0x15,0xC9,0xF6,0x21,0x24,0x55,0xC5,
+	0x03,0x6E,0xED,0x4C,0xA5,0xB3,0xDF,0x94,0x66,0x33,0x7B,
+	0xB2,0x50,0xEF,0xFA,0x64,0xC2,0x6B,0xF5,0xFE,0xF4,0xF7,
+	0xF5,0x1C,0x21,0xE7,0xE6,0xE3,0x56,0x08,0x08,0x2A,0xF4,
+	0x58,0x53,0x88,0x73,0xF3,0x31,0xAB,0x73,0x73,0x97,0x55,
+	0x23,0x22,0x53,0x25,0x82,0xBD,0x0E,0xC8,0x0A,0xB6,0xF5,
+	0x17,0xCC,0xCD,0xF2,0x8C,0xBB,0xB8,0x81,0x32,0xA2,0xC1,
+	0x71,0x2B,0xA8,0xEE,0xC1,0x25,0x13,0x39,0x82,0x0D,0x59,
+	0x9B,0x3B,0xAD,0x4E,0x9A,0x71,0x04,0x97,0xCC,0x76,0x5C,
+	0x6C,0x6D,0x7F,0x87,0x76,0x29,0x3C,0xF6,0x82,0x9B,0x66,
+	0x10,0x7F,0x99,0x99,0xBF,0x2B,0xB0,0xEE,0x06,0x73,0x49,
+	0x41,0x45,0xC1,0x63,0x79,0x59,0xA5,0xFA,0x0F,0xB3,0x72,
+	0x7A,0x76,0x60,0x3A,0xB9,0xDE,0x9C,0x10,0xFB,0x06,0x56,
+	0x3D,0x83,0xC3,0xF5,0x3B,0xF6,0x0B,0x5E,0xB6,0x77,0xB2,
+	0xF0,0xD3,0xC0,0x09,0x1D,0x90,0xB7,0x59,0x03,0x87,0x09,
+	0x50,0xB7,0x5B,0x03,0x1D,0xE4,0x72,0x82,0x64,0xE6,0x11,
+	0xAD,0xE3,0x7E,0x53,0x02,0x18,0x60,0xC3,0x3D,0xD1,0xA6,
+	0xF7,0xB0,0xDF,0x91,0x69,0xC6,0x0C,0xB1,0xDC,0xD9,0xEA,
+	0x53,0x8B,0x3A,0x5F,0xCD,0x98,0x3D,0x36,0x8B,0x2D,0x56,
+	0xE2,0x31,0x23,0xB7,0xD5,0xAA,0x93,0x47,0xAB,0xCC,0xFA,
+	0x91,0x41,0x7D,0x24,0x2A,0xCB,0x9C,0x6F,0xB7,0x5A,0x73,
+	0x7A,0x2E,0xB0,0x6D,0x70,0xE8,0xCC,0xAA,0x89,0x36,0xC4,
+	0x59,0xBD,0x9C,0xB6,0xC6,0x7F,0x30,0x49,0x74,0xB4,0xAF,
+	0xEF,0xEE,0x55,0x1C,0xED,0xB4,0xD3,0x11,0xD2,0xC5,0x52,
+	0xEB,0xB4,0x49,0xF0,0x5C,0x4F,0xCF,0x6C,0xB3,0xB6,0xCA,
+	0xAD,0x07,0x1C,0xAD,0xEB,0x8F,0xA5,0x10,0x47,0xAB,0x7A,
+	0x4A,0x3C,0xF4,0x6F,0xEC,0x7C,0x7E,0x02,0x5B,0x3B,0x36,
+	0x47,0xC7,0xFA,0xE3,0x4A,0x8A,0xAE,0x3E,0xB5,0x1D,0x2B,
+	0xF2,0x66,0xED,0xB3,0xCE,0x3A,0x5A,0x2F,0xFF,0x70,0x97,
+	0x91,0x34,0x70,0x88,0x48,0xB5,0x1F,0xA9,0xD2,0x5E,0x76,
+	0x87,0x0B,0x1B,0xAB,0xE9,0x21,0xF5,0x3D,0xA5,0x0E,0xFE,
+	0x67,0x7F,0xEA,0x81,0x31,0xEE,0x81,0x31,0x5C,0x94,0xFD,
+	0x5A,0x49,0xFC,0x44,0x6B,0xE3,0x60,0x9C,0x38,0x13,0x1C,
+	0x36,0x47,0x4B,0xE3,0x0E,0x3B,0x30,0xA8,0xE7,0x6D,0x17,
+	0x62,0xAE,0x4E,0x61,0x3A,0x4E,0x5A,0xE3,0x91,0xCC,0x64,
+	0xE7,0xA6,0x5E,0x36,0x81,0xA7,0x59,0x2C,0x66,0x54,0xE5,
+	0xA2,0x0F,0x8C,0x44,0xDE,0xE6,0xD3,0x80,0x93,0x80,0x53,
+	0xAC,0x3C,0x8A,0x46,0x03,0x43,0x8D,0x52,0x50,0xB7,0xED,
+	0x00,0xAB,0x3B,0x80,0xF2,0xA8,0x75,0x59,0xFC,0x34,0x2F,
+	0x0B,0x71,0xCB,0xFF,0x88,0x0A,0x57,0x5E,0xDA,0xCD,0x18,
+	0x67,0x6E,0x66,0x9F,0xB5,0xCC,0xEA,0xBC,0x65,0x5A,0xBF,
+	0x95,0x4F,0xC0,0x52,0x97,0x1F,0x5C,0x2F,0x2A,0x29,0xEB,
+	0xBB,0x49,0xAF,0x2D,0xBC,0x0A,0xA1,0x46,0x42,0x96,0x1D,
+	0x93,0xD8,0x87,0xF8,0x6B,0xCF,0x81,0x6A,0x95,0x00,0x0A,
+	0xA2,0xE2,0xCD,0x27,0x82,0xC1,0x61,0x5D,0x9D,0xB3,0x1C,
+	0xAD,0xD7,0xD7,0x29,0x18,0x4D,0x4E,0x8B,0x4A,0x1C,0xCD,
+	0x50,0xA9,0xBB,0xA8,0x2F,0xB3,0x1A,0x20,0xAB,0x42,0x7E,
+	0xD1,0x39,0xE3,0x12,0xF6,0x13,0x10,0x02,0x67,0xC3,0xB4,
+	0x60,0x7E,0x79,0x43,0xA4,0x62,0x22,0x6A,0x9F,0x0B,0xF8,
+	0xCA,0x15,0x3E,0x85,0x1D,0xCC,0xB0,0x04,0xCE,0x61,0x46,
+	0x98,0x79,0xE8,0x61,0x3F,0xAB,0xC5,0xDE,0x57,0x59,0x14,
+	0xF6,0xBE,0xCA,0xAC,0xB0,0xF7,0x55,0x26,0xC5,0xF3,0xA9,
+	0xE0,0x2A,0x77,0xE6,0x66,0x74,0x5A,0xCB,0xEA,0xF8,0x69,
+	0xB4,0x1D,0xC9,0x23,0xD6,0xB2,0x3F,0xC4,0x13,0xFC,0x44,
+	0x7A,0x00,0x89,0x76,0x6B,0xD9,0xBB,0xF1,0x04,0xFB,0xB2,
+	0xED,0x29,0xA4,0xDA,0xAC,0x65,0xCF,0x0B,0xEE,0xA7,0xD8,
+	0xE6,0x9A,0x43,0x61,0x1F,0x03,0xEF,0x13,0xDC,0x1B,0x52,
+	0x5B,0x05,0xEF,0xD3,0xA9,0x87,0xA8,0xF7,0x80,0xE0,0x2D,
+	0x4F,0x3D,0xE4,0xCC,0x75,0x76,0x5A,0xBD,0x86,0xC8,0xD7,
+	0x97,0xF1,0x57,0x0B,0x5E,0xB4,0x77,0x02,0xF5,0x57,0x43,
+	0x29,0x9E,0x31,0x10,0x98,0xBB,0x80,0xD2,0xBD,0x0F,0x69,
+	0xA0,0xFC,0x5C,0x70,0x5B,0x91,0x02,0x31,0x07,0xF8,0x1B,
+	0x10,0x3F,0x20,0x8D,0x26,0xBB,0x86,0x52,0x7C,0xA6,0xE0,
+	0x36,0x6B,0xAD,0xDE,0x1F,0x4A,0xB1,0xD6,0x26,0xAD,0xF5,
+	0x4B,0x82,0xD7,0xA4,0xAB,0x1F,0xE3,0x32,0x8F,0x29,0x44,
+	0xA6,0x35,0xF5,0xBC,0x86,0xEA,0xC7,0xFC,0x78,0x67,0xAE,
+	0x0D,0x78,0x6E,0xE3,0xED,0xDA,0x60,0xA6,0xF3,0x89,0x20,
+	0x01,0x2D,0x72,0xE2,0x42,0x35,0x15,0x2D,0x85,0x42,0x33,
+	0xFA,0x41,0xF4,0x93,0xE4,0x7D,0x2A,0xA9,0x70,0x43,0x92,
+	0xAB,0x3C,0xC9,0xFD,0x74,0x20,0x6A,0x2F,0x49,0x1D,0x0A,
+	0x93,0x22,0x03,0x89,0x91,0x29,0x97,0x45,0x8C,0xB6,0xF8,
+	0x2A,0xFB,0x12,0x95,0x73,0x5D,0xE5,0x65,0xD7,0xF2,0x4E,
+	0xC1,0x65,0xC9,0x75,0x3D,0x5D,0x96,0xA5,0xDD,0xF9,0x6C,
+	0xC1,0x65,0xCE,0x75,0x6D,0x28,0xB3,0x6B,0x77,0x3E,0x43,
+	0x70,0x99,0x72,0x5D,0x4F,0x21,0x9E,0x2C,0xB4,0xB2,0x50,
+	0xCC,0x6D,0x46,0x86,0x6C,0x15,0x0A,0xCB,0xC1,0x30,0x30,
+	0x0E,0x3C,0x55,0xA3,0x2D,0xDF,0x11,0xF5,0x47,0x78,0x76,
+	0xE2,0x72,0x86,0x76,0xEE,0xB4,0x93,0xF1,0x8D,0xFC,0x9D,
+	0x88,0xF6,0xB8,0xF5,0x51,0x38,0x2A,0x0F,0x0C,0xF7,0xF7,
+	0xA3,0x4B,0xFA,0xBB,0xE6,0x92,0xFE,0xC6,0xC5,0xFB,0xB3,
+	0xB3,0x8F,0x95,0xC0,0x0C,0x17,0x86,0x66,0x92,0x6D,0x72,
+	0x16,0xE6,0x45,0x28,0x7C,0x5A,0x70,0x6D,0x60,0x73,0xA7,
+	0x4C,0x89,0x47,0x74,0x08,0xF3,0x76,0xE1,0x76,0x50,0x4E,
+	0xD8,0x41,0x74,0x50,0x51,0xEE,0x8F,0xA8,0xAB,0x7E,0x63,
+	0x4B,0x99,0x89,0xB7,0x4E,0x17,0xBD,0xE6,0x06,0xAE,0x9E,
+	0x1D,0xA6,0xF8,0x48,0xE0,0xEA,0x67,0x64,0x11,0xE8,0x37,
+	0x7B,0xC0,0xF7,0x11,0xF1,0x5A,0x1A,0xB8,0x8F,0xD8,0xF9,
+	0xC4,0xFA,0x2C,0xE2,0xDC,0xA4,0xCA,0xEC,0x49,0x6B,0xFC,
+	0xCB,0x0D,0xA6,0x87,0xFA,0xAD,0x09,0x9E,0xCB,0x77,0x24,
+	0x90,0x1A,0x52,0x6D,0x0B,0xFF,0x96,0xBD,0x8C,0xD5,0xB4,
+	0xD1,0xC3,0x06,0x55,0x0F,0x45,0xFE,0x3C,0x3E,0xF2,0x7B,
+	0xBD,0x73,0x6F,0xE6,0x49,0xAB,0xA3,0xA5,0xB2,0xED,0xEF,
+	0x7F,0xD1,0x90,0x72,0x15,0xEC,0x27,0x8D,0x2A,0xFD,0x0D,
+	0x6B,0x04,0x57,0xC5,0xFA,0x3A,0xE2,0x17,0xB8,0xCA,0x5D,
+	0x3A,0x92,0xBA,0x6F,0xF7,0x6C,0x42,0x0B,0xF4,0x01,0xD1,
+	0xE8,0x08,0xF9,0x0F,0xE8,0xE8,0x92,0x41,0x47,0x0B,0x6D,
+	0xC6,0x23,0x5D,0x17,0xF3,0xEF,0x7F,0x26,0x50,0x47,0x02,
+	0x5F,0xCC,0x0E,0xD4,0xEB,0xD2,0x41,0xF4,0x7C,0xF4,0x0B,
+	0x82,0xBB,0xD6,0xC7,0x88,0xB1,0xA4,0xFD,0x3B,0x7A,0xA3,
+	0xCD,0x8E,0x16,0xAD,0xBF,0x66,0x5A,0x58,0xB9,0xCD,0x40,
+	0xDD,0x6D,0x95,0xEE,0x3D,0x8E,0xFE,0xD6,0x63,0x50,0x7A,
+	0xAD,0x10,0xF0,0x16,0xC1,0x57,0x41,0x7D,0xC7,0x04,0x5F,
+	0xA5,0xAA,0xA3,0x30,0x4D,0x82,0xEF,0x58,0x03,0xD7,0x43,
+	0xC8,0xFA,0x06,0x62,0xA7,0xBE,0xE3,0x82,0xEF,0x48,0xE0,
+	0x0B,0xA2,0x56,0x89,0xAA,0x89,0x7D,0x82,0xAF,0x07,0x09,
+	0xB5,0x8E,0x5A,0xFD,0x78,0x03,0x77,0x1C,0xDA,0x0D,0x53,
+	0x7C,0x00,0x6D,0x53,0x3F,0x53,0xEB,0xEE,0x1B,0xE3,0xEB,
+	0xA1,0xBE,0x1E,0xB4,0x1E,0xE3,0x3B,0xAE,0xA2,0x39,0x10,
+	0xF8,0x4C,0x47,0x7D,0x51,0x54,0x51,0x2B,0xF6,0xA8,0x98,
+	0x8E,0x07,0x44,0x33,0xC6,0x86,0xFA,0x74,0xDD,0x20,0xEA,
+	0x80,0x17,0xF6,0x40,0x33,0xA1,0xEB,0xA2,0xAC,0x3B,0x6D,
+	0xA0,0xEB,0x06,0x30,0x50,0x8B,0x87,0xBD,0xF9,0x0D,0xC4,
+	0x8C,0x25,0x03,0x18,0xC5,0x69,0xC1,0xDD,0xD6,0x7A,0x2C,
+	0xE8,0xDE,0xA3,0x6B,0x45,0x59,0x36,0x6F,0x02,0x13,0xF4,
+	0xA5,0x99,0x0D,0x05,0x26,0x76,0x4E,0xDA,0x48,0x48,0x7C,
+	0xFB,0x9F,0x10,0xE0,0xD7,0xD0,0xC8,0x87,0x1C,0xA1,0x6D,
+	0x56,0xF5,0x67,0x6D,0x7E,0x4F,0xD9,0x59,0x8A,0xD3,0xAD,
+	0x5D,0xB0,0x56,0xF2,0xD5,0x01,0xAE,0x97,0xAC,0x77,0x9D,
+	0x26,0xB3,0xFD,0xDC,0xD7,0xF6,0x00,0xD7,0xAE,0x0B,0xB8,
+	0x7E,0x4F,0x04,0xEE,0xF7,0x1B,0x43,0x5E,0x76,0xB0,0x9B,
+	0xE9,0x92,0x76,0x63,0xE9,0xD7,0x82,0xBB,0x4F,0x70,0xF5,
+	0x6E,0x33,0x30,0xD5,0xE5,0xE8,0x77,0x06,0x33,0x4F,0x59,
+	0xA9,0x2B,0x2C,0xB8,0x4E,0xFB,0xF7,0xD8,0xA9,0xAB,0x06,
+	0x6C,0x16,0x47,0x32,0x35,0x3C,0xEA,0x33,0x75,0x80,0x35,
+	0x20,0x60,0xD4,0x17,0x0D,0x05,0x31,0xC6,0x2C,0x0C,0x6A,
+	0x5F,0x43,0xC1,0x20,0x78,0xFB,0xD9,0x33,0x1A,0x27,0xA3,
+	0x81,0x5A,0x12,0x68,0xC9,0x52,0xC7,0xBB,0x6F,0xC4,0x78,
+	0xD1,0x75,0xB1,0xC2,0xD7,0xB0,0x61,0x95,0x7C,0x14,0xB9,
+	0x57,0xF9,0x87,0xD3,0x9B,0x7A,0x20,0x81,0x14,0x61,0x8E,
+	0x03,0x2D,0x44,0x15,0x2A,0xBB,0xC0,0x55,0x5C,0x45,0x7A,
+	0x05,0x57,0x65,0x9C,0x17,0xE0,0x0A,0x5D,0xA2,0xB7,0xEA,
+	0x68,0x22,0x4A,0x12,0x88,0x5D,0x2D,0xB1,0x82,0x39,0x2D,
+	0xEC,0x2D,0x0B,0x2B,0xB4,0xA0,0x3E,0xCA,0x0B,0xCC,0xCE,
+	0x4D,0x51,0x26,0xEE,0x03,0x4C,0xDC,0xAF,0x86,0x8A,0xFE,
+	0x41,0xCD,0xED,0x6C,0xC7,0xB7,0x73,0x8F,0x6A,0x3D,0x28,
+	0x2C,0x0B,0x32,0x6D,0x28,0xB4,0xA8,0x12,0xFF,0x81,0x21,
+	0xF2,0xB7,0x8C,0xE2,0x1B,0x43,0x95,0xFB,0x8A,0x6B,0xBB,
+	0x8C,0xC5,0xF4,0xE9,0x0A,0x85,0x3D,0xB5,0xC5,0x9F,0xDE,
+	0x61,0x84,0x0F,0x58,0xD9,0x44,0xA8,0x33,0xA2,0x3D,0x0D,
+	0x13,0x05,0xE1,0x87,0xE0,0xC3,0xD5,0x18,0xB0,0xD2,0x26,
+	0xB0,0x34,0xCA,0x5E,0x5E,0x16,0x58,0x02,0x07,0x14,0xBA,
+	0xC4,0x0C,0x52,0x59,0x21,0x6B,0x91,0xD3,0x03,0x32,0x53,
+	0x88,0xFF,0xD3,0xD7,0x68,0x81,0x55,0x70,0xBD,0x23,0x70,
+	0x5B,0x2E,0x6D,0x34,0x5A,0x6D,0x84,0x91,0xAB,0x85,0x43,
+	0x8D,0x32,0x58,0xA3,0xE7,0x69,0x41,0x5A,0xBC,0xE3,0x71,
+	0xF0,0xB1,0x0B,0x26,0x0C,0xD3,0x31,0x91,0x3C,0xDF,0x50,
+	0x90,0xF9,0x2C,0x61,0x24,0x37,0x0D,0x93,0xFC,0xED,0x1D,
+	0x5C,0xA9,0x76,0x90,0x15,0xEF,0x40,0x50,0x3B,0x70,0xB4,
+	0xA8,0xC5,0x6A,0x17,0x93,0x2B,0x9B,0x2E,0x9E,0x9B,0x86,
+	0x82,0xEC,0x14,0xC2,0xDC,0x8D,0x04,0x73,0x3A,0xE5,0xDE,
+	0x49,0x6D,0xA5,0xEE,0x2D,0xDF,0x8E,0xFA,0x36,0x15,0xF5,
+	0xEC,0x4B,0x68,0xE7,0x18,0xED,0x94,0x16,0xE4,0xA3,0x17,
+	0x4C,0xCA,0xC5,0xC8,0x35,0x14,0x17,0x2D,0x6E,0xCC,0xC7,
+	0x9A,0xB4,0x02,0x48,0x6E,0x85,0x73,0x73,0x49,0x5A,0x9C,
+	0x7B,0x0D,0xA6,0x9F,0xA7,0x29,0x89,0xB8,0x6D,0x48,0xBB,
+	0x86,0x38,0x05,0x27,0x74,0xD9,0x66,0x4F,0x1A,0xE6,0xD1,
+	0xCB,0x2E,0x4F,0xB2,0xCB,0x5A,0x76,0xF1,0xB1,0x8B,0x9F,
+	0x5D,0x9E,0x4A,0xA3,0xBD,0xB8,0x3D,0x9D,0xF6,0x77,0x1D,
+	0x42,0x00,0x47,0xE8,0xAE,0x60,0xA7,0xBF,0x61,0x76,0xC3,
+	0x33,0x5D,0x29,0xCF,0xA0,0x4B,0x73,0xC3,0x33,0x61,0x96,
+	0x70,0x59,0x1B,0x9E,0xE9,0x45,0x62,0x72,0x57,0xC3,0x33,
+	0x03,0xB8,0xE7,0xF4,0xD3,0x67,0x8E,0xA5,0x08,0x9C,0xC5,
+	0x7F,0x2C,0x85,0x3E,0xD3,0x83,0x94,0x89,0xBE,0x7C,0x3C,
+	0x45,0xB7,0x0F,0x4D,0xD2,0xB3,0x08,0xF4,0x37,0x16,0x3B,
+	0x5A,0x31,0xC9,0x7D,0xF6,0x64,0x4A,0x4E,0xFF,0xE4,0x2E,
+	0xB5,0xE6,0x09,0xD4,0xDC,0x40,0x5F,0x3E,0x95,0x02,0x0B,
+	0x3E,0xB9,0x8B,0x61,0x39,0x8D,0x9C,0xA7,0xD5,0xB2,0x3E,
+	0xA4,0x9E,0xA2,0x2F,0xF7,0xA7,0x24,0xB0,0xAF,0x7B,0x37,
+	0x04,0x9A,0x61,0x29,0x9E,0x06,0x02,0x81,0x2B,0x67,0xAB,
+	0xE7,0xE5,0xC1,0x94,0x9C,0x1E,0xFF,0x9F,0xBB,0x26,0xA7,
+	0xD0,0x67,0xA3,0xA8,0x1E,0x4B,0x61,0xFC,0x3B,0x65,0xFD,
+	0x96,0xE1,0xD0,0x7A,0x0C,0xA8,0x93,0x7A,0x2B,0xE8,0xA1,
+	0xD4,0x83,0xD4,0x5B,0x79,0x61,0x70,0xEA,0x32,0x59,0xE3,
+	0xDC,0x5C,0x0E,0x3E,0x56,0xA6,0xEE,0x73,0x6E,0xAE,0x48,
+	0xC3,0xE2,0xBB,0x64,0x82,0x1D,0x1D,0x09,0x6B,0xD2,0x58,
+	0x8B,0x76,0xAD,0x85,0x73,0x73,0x25,0xAB,0xEE,0xDC,0x1C,
+	0xFC,0x96,0xCA,0xAA,0x20,0xFC,0x5C,0xAD,0x0E,0x41,0xD0,
+	0xAA,0x57,0xA7,0x69,0x53,0xF4,0x52,0xDA,0x6C,0x78,0xE8,
+	0xCF,0x33,0xEE,0xBF,0xC8,0x2E,0xAF,0xB0,0xCB,0x6B,0x2C,
+	0xF4,0x78,0x23,0xCD,0xCC,0xB8,0x8B,0xC7,0xB7,0xD2,0x72,
+	0x7A,0x60,0xF9,0x26,0x4F,0x82,0x0D,0xA0,0xAE,0x8A,0x74,
+	0xBF,0x42,0x39,0x60,0xD9,0xC0,0x72,0x9F,0x8A,0xE7,0xBE,
+	0x93,0x1E,0x42,0xEE,0x16,0xC5,0x5B,0x0F,0xF4,0x8A,0xF7,
+	0x23,0x2C,0xF3,0x85,0x45,0x4C,0xAA,0x5C,0x5B,0x16,0x16,
+	0x21,0x20,0x6D,0xB3,0x85,0x7F,0x97,0x5E,0x2D,0x70,0x1F,
+	0x05,0xF6,0x58,0x87,0xBE,0xA6,0xB2,0x10,0xE6,0x1F,0xC0,
+	0x88,0xAA,0x7E,0x05,0xF3,0x0F,0x5C,0x1B,0x92,0x0A,0x9F,
+	0x4E,0x72,0x97,0xF3,0xA3,0xD8,0xEF,0xA9,0x26,0xC2,0x3B,
+	0x68,0x89,0xE8,0xC7,0x68,0x5E,0xB8,0xE7,0xEB,0x7F,0xCD,
+	0x2F,0x70,0xAB,0x76,0xDA,0x1B,0xF7,0x0B,0xDC,0xAA,0x95,
+	0xF6,0x32,0x2B,0x7D,0x16,0x4A,0x91,0xD9,0xE7,0x43,0x70,
+	0x7A,0xC7,0xB7,0xD3,0x56,0xF5,0x07,0xFB,0xE0,0x17,0x74,
+	0xC0,0x2F,0x88,0xFD,0xBF,0xF6,0x0B,0xEC,0x23,0xFD,0x82,
+	0xED,0xD4,0xD5,0x34,0xD2,0x2F,0x68,0x62,0x7E,0xC1,0x76,
+	0x81,0x6B,0x9A,0x31,0x3B,0xEE,0x17,0x6C,0x57,0xFD,0x82,
+	0xED,0xCC,0x2F,0x68,0x9A,0x1D,0xF7,0x0B,0x32,0xE3,0x7E,
+	0x41,0x47,0xDC,0x2F,0x30,0x7A,0x26,0xEF,0x30,0xC2,0x2F,
+	0xC8,0xB2,0x85,0x5F,0xEF,0x43,0xC9,0x78,0x55,0x4B,0x7E,
+	0xAE,0xF9,0x05,0x17,0x78,0x1E,0x79,0x92,0x38,0xF7,0x68,
+	0x1A,0x3D,0xF4,0xED,0x06,0xFB,0x35,0xB6,0xA6,0xDF,0xA0,
+	0xEE,0xFE,0x4A,0xF6,0xD3,0x33,0xAF,0xA9,0x4A,0xFB,0x8D,
+	0xA0,0x7B,0x80,0x39,0x08,0x9D,0x90,0xF6,0x40,0xBD,0x11,
+	0x2A,0x1D,0xB1,0x17,0xD3,0xEA,0x2C,0xE0,0xA0,0x87,0x91,
+	0x95,0x4D,0xD7,0xAA,0x7E,0x82,0xA8,0xFA,0x09,0x75,0xCC,
+	0x9C,0x64,0xD3,0x79,0xCC,0x51,0xB0,0xF3,0x9D,0x70,0xB4,
+	0x8C,0xA5,0x66,0xF9,0x10,0x3B,0xFC,0xCB,0x0D,0x7C,0xAB,
+	0xA2,0x0F,0xF7,0xEF,0xAA,0xFE,0x4E,0x45,0x6F,0x4C,0x1D,
+	0xA9,0xE8,0x5F,0xBB,0x48,0xD1,0x07,0xBF,0x4F,0xD1,0xBF,
+	0x26,0x70,0x6F,0x7C,0xA7,0xA2,0x57,0x0B,0xBF,0x45,0xD1,
+	0x07,0x05,0xAE,0xFA,0x3B,0x15,0xBD,0x5A,0xF8,0xBF,0x50,
+	0xF4,0x41,0xE5,0xDB,0x3B,0x18,0x56,0xF4,0xC3,0x85,0x7F,
+	0xA7,0xE8,0x55,0xD5,0xFE,0x77,0xCA,0x80,0xA9,0xF9,0x20,
+	0x53,0x06,0xD5,0xDF,0x8E,0x78,0x58,0xCD,0x5F,0x44,0xF9,
+	0x3F,0xAF,0xE6,0x35,0x91,0x18,0x56,0xF3,0xAF,0x69,0x6A,
+	0x5E,0xE5,0xDD,0x45,0x6A,0x5E,0xF0,0xA9,0xDE,0x7E,0xA1,
+	0x79,0x17,0xBC,0xD7,0xEF,0xD5,0xF6,0xAA,0xAE,0x67,0xBF,
+	0x08,0xEC,0x32,0x05,0xFE,0x1A,0xB2,0x85,0xDF,0xFB,0x6D,
+	0xF5,0x5E,0x08,0x48,0x93,0xA3,0xE5,0x2A,0x8C,0x31,0x79,
+	0x88,0x1A,0xD2,0xE5,0xA8,0x03,0xBE,0x51,0x51,0xEB,0x33,
+	0xF4,0x65,0x28,0x63,0x97,0x89,0x42,0xD3,0x43,0xED,0xA0,
+	0x9F,0x40,0xF3,0x6C,0x74,0x18,0x68,0x05,0x51,0x56,0xA6,
+	0x82,0x3F,0xB3,0x85,0xEF,0xFB,0x6D,0xB5,0xE0,0xEE,0x07,
+	0xC2,0xEF,0x42,0x04,0xCD,0x6D,0x7D,0x66,0x54,0x54,0x55,
+	0xE7,0xBE,0x0D,0x4C,0x9D,0x43,0x7F,0xAB,0x9A,0xE1,0x29,
+	0x46,0xC6,0xCC,0x70,0xE6,0x6F,0x85,0xEF,0x23,0x23,0x0A,
+	0x32,0x9E,0xA2,0x30,0x34,0x2A,0x19,0x1B,0x54,0x32,0x9E,
+	0x56,0xC9,0x28,0xD7,0xC8,0x40,0xDC,0xFB,0xD1,0x77,0xD1,
+	0x00,0xEC,0x1A,0x01,0x83,0x29,0xF4,0xE5,0x58,0x0A,0x5B,
+	0xCE,0x97,0xFE,0x94,0xF2,0x08,0x9B,0xF7,0x1A,0x33,0x0B,
+	0x6F,0xA8,0x4C,0x67,0x36,0xE1,0x8D,0x7F,0x68,0x11,0x5E,
+	0x63,0x42,0xA0,0x55,0xAE,0xD4,0x2A,0xFF,0x43,0x8B,0xF0,
+	0x1A,0xB3,0x08,0x5A,0xF5,0xEA,0x34,0x6D,0x36,0x55,0x8B,
+	0xA0,0xA9,0xFF,0x6F,0x31,0x0C,0x17,0x5B,0x84,0x59,0xAA,
+	0xEE,0x7F,0x2D,0x9D,0x40,0xF7,0xBF,0x31,0x6C,0x11,0xB4,
+	0xDC,0xA0,0x6A,0x27,0xAA,0x15,0x6F,0x13,0xD0,0x2B,0xDE,
+	0xED,0xD0,0x21,0xCC,0x22,0x04,0x05,0x57,0xF5,0x90,0x45,
+	0x78,0xC1,0x06,0x8B,0xB0,0xFD,0x22,0x8B,0xC0,0x7E,0xAD,
+	0x9B,0x5F,0xAC,0x7E,0x4C,0x3A,0x1F,0xE1,0xB4,0xBD,0xF4,
+	0x0E,0x44,0xDD,0x84,0x9F,0x13,0xF0,0xC1,0x1D,0x9E,0x11,
+	0xF0,0x6D,0xB0,0x97,0xDE,0x3C,0xAC,0x97,0x73,0x2E,0xD1,
+	0xCB,0x59,0x97,0xE8,0x65,0x7B,0x5C,0x2F,0xAB,0x61,0xA1,
+	0x29,0xB2,0x8F,0xB0,0x80,0xB0,0x63,0x0A,0x86,0xBC,0x03,
+	0x8A,0xD6,0x40,0xB9,0x1D,0x02,0xB7,0x83,0x72,0x9F,0xC0,
+	0xA8,0xB3,0xE9,0x2F,0x8C,0xD3,0x9F,0xB2,0xCB,0x48,0xD4,
+	0x1F,0xF4,0x2A,0x17,0x7C,0x26,0x5B,0xD8,0xBE,0xAD,0x9A,
+	0xC9,0xA8,0x26,0xD6,0x28,0x71,0x75,0xA9,0xF2,0x9A,0x02,
+	0x8D,0xF5,0x21,0x4A,0x3E,0xA1,0xCD,0x33,0x88,0xBD,0x24,
+	0xBF,0x86,0xD8,0x83,0x5C,0x17,0x45,0x3C,0xD1,0xB9,0x7E,
+	0xF5,0x27,0xE4,0xD2,0x1F,0xF6,0x5E,0xCF,0x99,0x10,0x5E,
+	0xC4,0x7F,0x54,0x3B,0xE0,0xB2,0x92,0xF5,0xDC,0x53,0x2C,
+	0x63,0x03,0x1E,0x9E,0x06,0x94,0x93,0x48,0x99,0x02,0xE7,
+	0x7B,0xEC,0x10,0x92,0x4B,0xDA,0x83,0xD2,0x8B,0xED,0x26,
+	0x0B,0x76,0x41,0x92,0x6A,0x37,0xDD,0xB0,0x9B,0xE5,0x49,
+	0x70,0x45,0x60,0x35,0x93,0x10,0x57,0xB7,0xC0,0x72,0x76,
+	0x44,0x38,0x53,0x3C,0xA2,0xFE,0x57,0x2C,0xA7,0x7B,0xC8,
+	0x92,0xA9,0x96,0xD3,0x3D,0x64,0xC7,0x34,0xCB,0xA9,0x99,
+	0x4D,0x66,0x2F,0x3F,0x86,0x21,0x3B,0x4C,0x1B,0x11,0x50,
+	0xC0,0x72,0xB6,0xFC,0xEF,0x2C,0xA7,0x66,0xA9,0x0B,0x87,
+	0x2D,0xA7,0x66,0xAB,0x0B,0x59,0x8F,0xF1,0x57,0xA5,0xF1,
+	0x88,0xBA,0x53,0xB3,0x9C,0xFB,0x69,0xE1,0xFB,0xD4,0xF5,
+	0xEB,0x80,0xEF,0xD7,0xA4,0x2C,0x89,0x5D,0xF9,0xE4,0x5C,
+	0xEE,0xFD,0x52,0x33,0xE5,0xDE,0x6F,0xE0,0x7E,0x8D,0x10,
+	0xC3,0xF7,0xEB,0xAC,0x32,0x2B,0xBB,0x32,0x13,0xFA,0xBE,
+	0x6A,0x42,0xDF,0x67,0x26,0xF4,0xD7,0x2C,0xB4,0xBE,0xD4,
+	0x04,0x5D,0xC3,0x62,0x8D,0x92,0x9A,0xEF,0x34,0x41,0xEB,
+	0x2D,0x23,0x4D,0xD0,0xF3,0x17,0x99,0xA0,0x97,0xBE,0xCF,
+	0x04,0x3D,0x2F,0x70,0x2F,0x7E,0xA7,0x09,0x52,0x0B,0xBF,
+	0xC5,0x04,0xBD,0x24,0x70,0xAF,0x7C,0xA7,0x09,0x52,0x0B,
+	0xFF,0x17,0x26,0xE8,0x25,0xE5,0xDB,0x3B,0x18,0x36,0x41,
+	0x17,0x75,0x90,0x1D,0xEF,0x60,0xF2,0xF7,0x5A,0x8A,0xE7,
+	0x99,0xA5,0x78,0x51,0xB5,0x14,0x57,0x43,0x1B,0x3E,0xAF,
+	0x59,0x0A,0x75,0x88,0xC3,0xF6,0xE0,0x5B,0xB7,0x35,0x0C,
+	0x70,0x5F,0x0C,0x70,0x5F,0x8A,0x6C,0xE1,0x23,0xF2,0xB0,
+	0xFB,0x32,0xC1,0x78,0xA9,0xFB,0x72,0x54,0xF7,0x3D,0xFB,
+	0x0D,0x1A,0x05,0x6C,0xBF,0xE1,0x60,0xA5,0x7B,0x17,0xFB,
+	0xBC,0x1F,0xC1,0xB1,0x82,0xE0,0xB8,0x45,0x28,0x7C,0x9E,
+	0x16,0x1E,0x10,0x0A,0x5F,0x6C,0xE0,0xF6,0x41,0x49,0x17,
+	0x1E,0x11,0x0A,0x0F,0x34,0x70,0x07,0x10,0x13,0xD7,0x12,
+	0x3B,0x2D,0x8C,0x0A,0x85,0x47,0xD8,0x06,0x40,0xE1,0x31,
+	0xA1,0x70,0x9F,0x9A,0xD8,0x87,0x0A,0x48,0x68,0xDF,0x89,
+	0xB2,0x96,0x51,0x6D,0xBF,0xE1,0x1C,0x2D,0xEC,0x11,0x0A,
+	0x8F,0xB1,0x8E,0x58,0xDD,0x31,0x85,0x47,0x34,0x64,0x63,
+	0x0A,0x8F,0xD3,0xC2,0xE3,0x42,0x61,0x8F,0x7F,0xBF,0x4E,
+	0xAB,0xA2,0x56,0xD0,0x4A,0xD5,0xFD,0x86,0xF9,0x31,0xF6,
+	0x38,0x7F,0x10,0x45,0x6C,0x93,0x83,0x05,0x1F,0xF3,0xD1,
+	0x6F,0xCF,0xD0,0xC6,0xCA,0xB7,0xEE,0x37,0x1C,0x64,0xFB,
+	0x0D,0xBB,0xFE,0xE7,0xFB,0x0D,0x21,0xCA,0xD5,0x51,0xEE,
+	0x04,0xE5,0x4E,0xB2,0xFD,0x86,0x53,0x6C,0xBF,0xE1,0x04,
+	0x59,0xEF,0x3A,0xC9,0xF6,0x1B,0xBE,0xB4,0x07,0xB8,0x90,
+	0x2E,0xE0,0x82,0xF9,0xE2,0xEA,0x46,0xEC,0x37,0x84,0xD4,
+	0xFD,0x86,0x53,0x82,0xEB,0xC4,0x25,0xFB,0x0D,0x9F,0x0A,
+	0xAE,0x93,0xEA,0x7E,0xC3,0xA1,0x4B,0xF7,0x1B,0x3E,0x65,
+	0xFB,0x0D,0x47,0x04,0xDF,0xA1,0x91,0xFB,0x0D,0xC7,0x04,
+	0xDF,0x91,0x11,0xFB,0x0D,0x6C,0x6B,0x67,0xC4,0x7E,0xC3,
+	0x91,0x7F,0x75,0xBF,0x61,0x68,0x7A,0x11,0x00,0x42,0x59,
+	0x0C,0xC5,0x80,0x56,0x2D,0x06,0xF4,0x1F,0xEB,0xD2,0x62,
+	0x40,0x88,0xAC,0x1A,0x03,0x22,0x10,0x7B,0x19,0x31,0xA0,
+	0xCB,0x42,0x9F,0x39,0xAE,0x05,0x80,0x3D,0x6A,0xE8,0xE6,
+	0x32,0x83,0x90,0x78,0x04,0xA8,0xF9,0x0D,0x2C,0x02,0xEC,
+	0x41,0x7B,0xD6,0xE2,0x04,0x42,0xB7,0x53,0x2C,0x0A,0xFC,
+	0xBE,0x08,0xD0,0xB5,0x41,0x45,0xF3,0xB4,0x8A,0x46,0xB5,
+	0xFB,0xCF,0x0E,0x5E,0x40,0xF3,0x7D,0x11,0xE0,0x45,0xE3,
+	0x89,0xA6,0x64,0x75,0x15,0x07,0xF6,0xE5,0xA4,0x5C,0xD9,
+	0x55,0x2C,0x40,0xBB,0xA4,0x5C,0xD9,0x66,0xD2,0x8E,0xE2,
+	0xA6,0xE8,0x32,0xD6,0xA4,0x25,0xC2,0xEE,0x8E,0x0C,0xC2,
+	0x9E,0x57,0x8D,0xEB,0x8B,0x97,0x04,0x61,0x2F,0xA9,0x41,
+	0xD8,0x2B,0xC5,0x42,0xF0,0x7D,0xA5,0x58,0xF8,0x3D,0x74,
+	0x94,0xB0,0xEB,0x25,0xE5,0xB5,0xFB,0x1F,0x27,0x44,0x45,
+	0xDF,0xF5,0x19,0x43,0x7F,0x63,0x08,0xC8,0x1D,0x21,0x75,
+	0x89,0x2A,0x0A,0x5B,0x9F,0x6C,0x65,0x5E,0xD4,0xDB,0x79,
+	0x81,0x7B,0xFF,0x62,0x6B,0x53,0xA8,0x5A,0x1B,0xF7,0xD0,
+	0x2E,0xAE,0x9B,0x59,0x1B,0x67,0x6E,0xE6,0x71,0x6B,0x49,
+	0x26,0xA4,0xD5,0x9D,0xE0,0xCC,0xCD,0xE8,0xB1,0x96,0x8C,
+	0xE6,0xFB,0x9C,0xB9,0xB6,0x63,0xD6,0x92,0x51,0xBC,0xEC,
+	0xCC,0x75,0x76,0x59,0xCB,0x7A,0xE2,0xC1,0xDB,0x91,0x7F,
+	0xC1,0x04,0xB9,0x54,0x13,0xE4,0x8E,0x9B,0x20,0x97,0x6A,
+	0x82,0xDC,0xCC,0x04,0x39,0x85,0x99,0x5D,0xD6,0x40,0x83,
+	0x8E,0xFA,0x7A,0x90,0x3C,0x66,0xD5,0x36,0x09,0x91,0xEC,
+	0xD1,0x92,0x51,0x24,0x8F,0x6B,0x49,0xC8,0x5D,0xCF,0x94,
+	0xB3,0x82,0xF7,0xD8,0xF8,0x4E,0xC1,0x1D,0x1D,0xDF,0x88,
+	0xD5,0x37,0xBE,0x99,0x1E,0x40,0x9D,0x11,0x91,0xDE,0xEC,
+	0x7F,0xC1,0x5E,0x69,0xF6,0x51,0x73,0x2D,0x6C,0xF2,0x9D,
+	0x71,0x0B,0xE9,0x65,0x7B,0xCE,0xDF,0x47,0xDE,0x91,0x21,
+	0xF2,0x18,0x6D,0x30,0x69,0x58,0x1A,0xE3,0xCF,0xC2,0xE6,
+	0xBB,0x8F,0x8C,0x6F,0x94,0x13,0x76,0xC1,0xB2,0xC1,0xE1,
+	0x7B,0x8F,0x7A,0xB7,0x06,0x7C,0x5B,0x55,0xCB,0xB6,0x55,
+	0xB5,0x6C,0xEF,0x31,0xCB,0xF6,0x5E,0x03,0xB7,0x95,0x59,
+	0xB6,0xAD,0xB3,0x99,0x65,0xDB,0x3A,0x9B,0x59,0xB6,0xF7,
+	0x54,0xCB,0xF6,0x1E,0xB3,0x6C,0x5B,0xBF,0x2B,0x38,0xD4,
+	0x7B,0x1E,0xD9,0xA1,0x87,0x76,0xB5,0xDB,0xC2,0xBE,0xE3,
+	0x28,0xC9,0x50,0xB5,0xEB,0xF2,0x4B,0xB5,0xAB,0xDA,0x50,
+	0xF3,0x47,0x1D,0x0A,0x75,0xB3,0x5F,0xAA,0xA7,0x9D,0x41,
+	0xF7,0xE7,0xC3,0x51,0xDE,0xDF,0x07,0x79,0x43,0x31,0x5E,
+	0x57,0x3C,0xC6,0x6B,0xD3,0x9A,0x8D,0x7C,0x13,0x74,0x35,
+	0x3A,0x54,0x0D,0x6C,0x78,0xF4,0xB6,0xEF,0x8E,0xF1,0xB2,
+	0x0C,0x23,0x0D,0xEC,0x5B,0x17,0x19,0xD8,0x0F,0xBE,0xCF,
+	0xC0,0xBE,0x25,0x70,0x6F,0x7F,0xA7,0x81,0x55,0x0B,0xBF,
+	0xC5,0xC0,0x7E,0x20,0x70,0x1F,0x7E,0xA7,0x81,0x55,0x0B,
+	0xFF,0x17,0x06,0xF6,0x03,0xE5,0xDB,0x3B,0x18,0x36,0xB0,
+	0x17,0x75,0xF0,0xCF,0x1B,0xD8,0xB7,0x98,0xBE,0x78,0x7B,
+	0xD8,0xC0,0xBE,0xA5,0x19,0x58,0x36,0xC4,0x6F,0x0D,0xBE,
+	0x2E,0x84,0x57,0x33,0xC3,0xDC,0x7B,0x7B,0x31,0x37,0xFF,
+	0xBB,0xF0,0x6A,0x66,0x98,0xBC,0xF7,0xDD,0x71,0x4D,0xCB,
+	0x50,0x60,0x35,0x22,0xAA,0x2A,0x64,0x6B,0x82,0x85,0x5D,
+	0xBE,0x0D,0x68,0x5D,0xF7,0x2E,0x6A,0xFD,0x83,0xE0,0xEC,
+	0x9F,0x0C,0xAF,0xC2,0x4F,0xBE,0x5B,0xFD,0xBD,0x64,0x7C,
+	0x4F,0x78,0x75,0x31,0x47,0xE3,0x1A,0xD8,0xAE,0x69,0xE0,
+	0xB7,0xBE,0x5B,0x03,0x6B,0xE1,0xCD,0x5B,0x6A,0xD0,0xF3,
+	0xF6,0x25,0x41,0xCF,0x07,0xAA,0x5E,0xFE,0x10,0x1A,0xF8,
+	0x3D,0xA6,0x81,0xDF,0x62,0x1A,0xF8,0x03,0xE5,0xB5,0x3F,
+	0x0C,0x6B,0xE0,0x2F,0xFF,0x79,0x0D,0xFC,0xDE,0x88,0x65,
+	0xC9,0x96,0xC8,0x9B,0xC6,0xE1,0x97,0xF3,0x43,0xF9,0x6F,
+	0x64,0xBA,0x16,0x44,0x1D,0xA1,0x60,0xDB,0xAE,0x9B,0x88,
+	0x60,0x6D,0x30,0x9E,0x7C,0x6C,0x81,0x30,0x4F,0x5F,0x39,
+	0x4F,0xBF,0xA0,0x78,0xD7,0x80,0xA2,0x28,0xC5,0x0F,0x0B,
+	0x4E,0x14,0x2D,0xA5,0xF3,0xF4,0x4B,0xA9,0x75,0xA9,0x7B,
+	0xD2,0x9B,0x8D,0x81,0x3D,0xA6,0xD9,0xB2,0xBC,0x98,0xFE,
+	0xE5,0x8D,0xFB,0x2A,0xF7,0x4D,0xDB,0x3C,0xEF,0xF1,0x62,
+	0x47,0x3F,0x14,0x6C,0xB1,0x23,0x84,0x01,0xAA,0xA2,0xAB,
+	0xEB,0x8D,0xB2,0x0F,0x92,0xBA,0x53,0x74,0x89,0xEC,0xFE,
+	0xD7,0x86,0x04,0x85,0x14,0xD3,0xB9,0xFA,0x14,0x5D,0x7A,
+	0x65,0x47,0x65,0x6D,0x4A,0x56,0xC8,0xAA,0x4B,0xB9,0x32,
+	0x54,0x63,0x26,0xEC,0x7F,0x05,0x73,0xE2,0xD6,0xC7,0xED,
+	0x18,0x5B,0x68,0x72,0x0C,0x79,0x27,0x0A,0x31,0xD0,0x60,
+	0x47,0xB0,0x36,0xB0,0x47,0x45,0x30,0x16,0xF7,0xFB,0xDF,
+	0x5C,0xD1,0x68,0xCA,0xCC,0x60,0x9D,0x6D,0x7B,0x1C,0x15,
+	0x8B,0x93,0x75,0x84,0xF8,0x59,0xE5,0x7F,0x7F,0xDC,0x4C,
+	0x6A,0xEC,0xC0,0x52,0x33,0x8E,0x04,0x43,0x35,0x59,0x24,
+	0xD8,0x54,0x4C,0x0F,0x14,0x07,0x8E,0x19,0x8A,0x6B,0x23,
+	0xFA,0xC1,0x33,0xD9,0xC5,0x0F,0xBF,0x5B,0x4C,0x9B,0xCF,
+	0x64,0x3F,0xBC,0x85,0xB5,0xBB,0x2A,0xA6,0x28,0xEB,0x58,
+	0xBB,0xDF,0xA2,0x93,0xB1,0x93,0x12,0x87,0xB0,0x26,0xFE,
+	0xE4,0x22,0xAC,0xCD,0xFF,0x22,0xD6,0x51,0x3F,0xD1,0xB0,
+	0x2E,0xB6,0x65,0x9A,0x32,0xD8,0x6F,0xD6,0x1F,0xDF,0xE5,
+	0x4F,0x5B,0x55,0x2C,0xE4,0x1B,0x8B,0x8B,0xC0,0x9D,0xE2,
+	0x22,0xFA,0x17,0x36,0x41,0x5D,0xC5,0x0E,0x65,0xD5,0x9E,
+	0x99,0x27,0xAD,0xC5,0xCC,0x7F,0x23,0x24,0x9E,0xD7,0xBF,
+	0x6A,0xAF,0x73,0xC0,0x5A,0x1C,0xA8,0xBF,0xA6,0x46,0xD7,
+	0x29,0x3D,0xEC,0x1F,0x24,0x1E,0x73,0x71,0x8D,0xEE,0xD3,
+	0x9D,0xEF,0xCB,0xB1,0x62,0xEA,0x56,0x7F,0xF2,0xAA,0x7B,
+	0x55,0x71,0x83,0xE9,0x95,0x34,0x8A,0x8E,0xD0,0x00,0x5D,
+	0x14,0xD7,0x1E,0x37,0x16,0xAF,0xAF,0x2F,0x4F,0x03,0x1A,
+	0x2B,0x5A,0xF5,0x5D,0xA0,0x3B,0xD8,0x15,0x0C,0xAB,0xB4,
+	0x8F,0x94,0xCA,0xC2,0xCC,0x62,0xC1,0x3B,0xA1,0x58,0xF0,
+	0x65,0x0C,0x16,0x2F,0x60,0xA3,0xD1,0x06,0xB3,0xB4,0x38,
+	0xF0,0x67,0x83,0x36,0x9E,0x61,0x11,0x5B,0xDF,0xC3,0xFE,
+	0xAF,0x4E,0xEA,0xAC,0x5A,0x41,0x3F,0xFE,0x09,0x9C,0x85,
+	0x5D,0xCC,0x48,0xD3,0x30,0x2E,0x88,0xD7,0x6D,0xB8,0x3D,
+	0x32,0xEE,0xA7,0xA8,0x27,0x70,0x6C,0x94,0x02,0x47,0x70,
+	0x05,0x29,0xC8,0x79,0x58,0xF9,0xE1,0xE4,0xC0,0x1E,0xFB,
+	0x8A,0xC6,0xC5,0xA0,0x15,0x63,0x56,0x39,0xB2,0x8A,0xED,
+	0xE2,0x33,0xAA,0x57,0x09,0x8C,0x03,0xBA,0x58,0xB1,0xEB,
+	0x7F,0xC0,0x2D,0xFF,0xBF,0xC2,0xAD,0x3F,0xFC,0xF4,0x5F,
+	0xE5,0x16,0x67,0x2F,0x7E,0xB8,0xEA,0x43,0xD6,0x2B,0xEE,
+	0x88,0x2B,0x70,0xFF,0x98,0xC0,0x62,0x0C,0xAA,0x4C,0x03,
+	0x8D,0x0F,0xFF,0xD7,0xB1,0xBE,0x94,0xAC,0xDA,0xE2,0xF5,
+	0x7F,0x56,0x54,0x19,0xA8,0x2D,0x16,0xDC,0x68,0xDA,0x31,
+	0xC2,0x15,0x5B,0xBF,0x9F,0xA8,0x62,0x85,0xA2,0xC2,0x2B,
+	0xC1,0x7C,0x4C,0x80,0x6F,0xC2,0x77,0x31,0xFF,0x12,0x4C,
+	0xC5,0xEB,0x45,0xB2,0x06,0xEB,0x3E,0x8E,0x50,0x73,0xBE,
+	0x2E,0x20,0xFC,0xE7,0x67,0x68,0xC7,0xEA,0x7F,0x30,0x43,
+	0x69,0x2B,0x1A,0xC9,0xB7,0xFD,0xBD,0x71,0x5F,0xA6,0xC9,
+	0x96,0x11,0x8D,0xFF,0x9E,0x71,0x45,0xE6,0xB2,0xE4,0x69,
+	0xE5,0x99,0xBB,0x57,0xFB,0xCF,0x67,0xF1,0x7A,0xAB,0x8E,
+	0x31,0x58,0xCC,0x0E,0x9A,0xEE,0x49,0x8E,0xFF,0x86,0x51,
+	0x51,0xF2,0x34,0x9A,0x19,0x5A,0x2D,0x64,0x2E,0x64,0x89,
+	0xBA,0xD5,0x95,0x8D,0xC1,0x8E,0x69,0x0A,0x72,0x4A,0x47,
+	0xAB,0x28,0xEA,0x4D,0xCB,0x92,0xD9,0x8F,0x88,0x26,0x4E,
+	0xBA,0xFF,0xCD,0xC6,0x1A,0x93,0x41,0x72,0x50,0x5B,0xFD,
+	0x6A,0x9A,0xB9,0x6F,0x75,0xA5,0xED,0xC0,0xEA,0xCA,0xCC,
+	0x4F,0x57,0x57,0x9A,0x0E,0xAE,0xAE,0xCC,0x68,0x5A,0xED,
+	0x9F,0xB9,0x7B,0x75,0x16,0x3F,0xBE,0x98,0xCE,0x0C,0xAD,
+	0xA6,0xCE,0x3D,0xAB,0x97,0xDD,0x43,0x6B,0x69,0x3D,0xED,
+	0xDE,0xBD,0xE1,0x89,0x62,0x65,0x1A,0xF2,0xD4,0xFC,0xBA,
+	0x91,0xF9,0x2C,0x7B,0xDA,0xA6,0xFA,0xD5,0xD3,0x04,0xE0,
+	0x63,0x3F,0xD5,0x7D,0x78,0xF3,0x23,0xC9,0x34,0xF3,0xB1,
+	0xE4,0x69,0x9B,0x42,0x2C,0xB3,0x0E,0x17,0xDB,0x9E,0xD5,
+	0xDA,0xB9,0xAB,0xFB,0x50,0xF2,0x40,0x32,0xB5,0xAD,0x42,
+	0xE9,0x81,0x78,0xDE,0x93,0xE9,0xD3,0x36,0x7D,0x1A,0x4F,
+	0xFF,0x1C,0xE9,0x83,0xF1,0xB4,0x17,0xE9,0xA6,0x78,0x7A,
+	0x6D,0x7A,0x78,0x14,0x51,0xC9,0x67,0xEC,0x31,0x15,0x2D,
+	0x5A,0x00,0xC5,0x09,0x7F,0x23,0x5B,0xC8,0xDC,0x40,0xB2,
+	0x05,0xDB,0xD3,0x24,0xBB,0xC1,0xB4,0x81,0x5C,0xBB,0x26,
+	0x7B,0xF3,0xD3,0x04,0x3C,0xF8,0xF2,0x89,0x69,0xD4,0xF6,
+	0xD5,0x13,0xDB,0x1F,0x90,0xAE,0xC0,0x53,0xCB,0xEA,0xA5,
+	0xF7,0xDE,0x93,0x28,0xFA,0x07,0xE7,0x79,0x12,0xA6,0x29,
+	0xD3,0xBE,0x7C,0xA2,0x68,0x91,0x5A,0x92,0x8B,0x12,0x4F,
+	0xE2,0xBD,0xF7,0xA8,0x79,0xF7,0xDE,0x73,0x01,0x2D,0xC8,
+	0x06,0x06,0x01,0x18,0xB2,0x29,0xEB,0x80,0xA2,0x03,0x86,
+	0x22,0x4A,0xF7,0x32,0x5A,0x31,0xF6,0x3A,0xDA,0x3D,0x4D,
+	0x70,0x1E,0x58,0xBD,0xFB,0xE9,0x35,0x68,0x0D,0x66,0x86,
+	0xD9,0x2F,0x56,0xF7,0x91,0xEF,0xF8,0x83,0xCA,0xC6,0xF4,
+	0x9B,0xA6,0x15,0x6F,0xAE,0x5A,0x83,0x84,0x05,0x89,0xE7,
+	0x58,0xC2,0x86,0xC4,0x7F,0xAC,0x51,0x67,0x3B,0x33,0x3E,
+	0xDB,0xD3,0x36,0xBF,0xBA,0xA6,0x78,0xD3,0x7D,0xC9,0x28,
+	0x79,0x7D,0xCD,0x26,0x30,0x6A,0xF3,0xAF,0xD6,0x6C,0xFA,
+	0x79,0x3A,0xAD,0x15,0x32,0xD6,0xA6,0xD3,0x6E,0xC1,0xF9,
+	0x64,0xFA,0x6E,0xE3,0xCF,0x94,0xCC,0x47,0x92,0x61,0x0D,
+	0xC0,0x92,0x15,0x8E,0x50,0x63,0x60,0xE6,0xA6,0x35,0x84,
+	0x9F,0xEF,0x08,0x7D,0xAC,0x27,0x92,0xA3,0xD4,0x10,0x79,
+	0x89,0x6C,0xDE,0xB4,0x26,0x10,0x32,0x6F,0xDE,0xBC,0xA6,
+	0x66,0x14,0x11,0x32,0x37,0xAD,0xD9,0xD6,0x9B,0xF3,0x37,
+	0xC9,0x51,0x12,0x83,0xE6,0x67,0x8F,0x2C,0xF8,0xBB,0x53,
+	0x72,0xA8,0x85,0x9B,0xD7,0x6C,0x3B,0x3D,0xA2,0x70,0xF3,
+	0x70,0x61,0xA2,0x5A,0x55,0xC8,0x78,0x6E,0x8D,0x60,0x7B,
+	0x61,0x8D,0xE4,0x28,0x4E,0xF9,0x83,0xE9,0xD9,0x35,0xAA,
+	0x9D,0x49,0xF9,0x43,0x26,0x46,0x02,0x03,0x5C,0x57,0x5C,
+	0x1B,0xB6,0x83,0x38,0x34,0x43,0x7D,0xC9,0x21,0xD8,0xFE,
+	0x63,0x0D,0xB5,0xBD,0xBA,0x26,0xD3,0x34,0xB8,0x09,0x6D,
+	0x91,0x0D,0x43,0x23,0x3A,0xFA,0xE9,0xD9,0x33,0x5B,0x12,
+	0x27,0x41,0x6C,0x96,0xB9,0x21,0x36,0x9F,0xFC,0xAC,0x58,
+	0xC9,0x7C,0x7D,0x0D,0x23,0x7F,0xDA,0xA6,0x57,0xD7,0x34,
+	0x82,0x3F,0x8C,0x3D,0xE0,0x0E,0x96,0xD0,0xB4,0xCD,0xCF,
+	0xAE,0x61,0x3C,0x02,0x8B,0xB0,0xBC,0xA6,0x6D,0x7E,0x61,
+	0x0D,0x63,0x14,0xF8,0x04,0xAD,0x30,0x6D,0xF3,0xCB,0xFF,
+	0x73,0x76,0xDD,0x58,0xF2,0x3D,0xEC,0x0A,0xFE,0x3F,0x61,
+	0xD7,0xFF,0xD7,0xDE,0xDB,0xC0,0x35,0x75,0x65,0x8B,0xE2,
+	0xFB,0xE4,0x1B,0x24,0x27,0x68,0x2D,0xB6,0xB6,0x83,0x69,
+	0x8B,0xF4,0x63,0x5A,0x0D,0xD5,0x66,0xB4,0x82,0xE2,0x07,
+	0x07,0xED,0x28,0x32,0x68,0xA3,0x63,0xDB,0x54,0x54,0xA2,
+	0xCE,0xB5,0x60,0x43,0x12,0x6D,0x6F,0x8B,0xF1,0x46,0xDB,
+	0x9C,0x1C,0xC8,0x78,0xE7,0xCE,0xF4,0xCE,0x9D,0xD7,0x76,
+	0x54,0xE6,0xDD,0xD7,0xD7,0xDF,0xCC,0x3C,0xE8,0x75,0x7A,
+	0x11,0xFB,0x2C,0x82,0x82,0x1F,0xD5,0x21,0xE0,0xB3,0xD4,
+	0x3A,0x4A,0x91,0xD2,0x40,0x28,0xA5,0x94,0x89,0x14,0x2D,
+	0xE7,0xAD,0xB5,0xCF,0x09,0x09,0x1F,0xF6,0x63,0xDE,0xBB,
+	0xAF,0xFF,0xDF,0xFD,0xFD,0x0F,0x24,0x39,0x67,0x9F,0xBD,
+	0xD7,0x5A,0x7B,0xAD,0xB5,0xD7,0x5A,0xFB,0x9C,0xFD,0x21,
+	0x24,0xFD,0x7C,0x3B,0x1F,0x38,0xD6,0x99,0x70,0xAC,0x4D,
+	0xA5,0x4C,0x2A,0xDB,0x8E,0x3D,0xCD,0xEF,0xC6,0xA6,0x36,
+	0xFB,0x08,0x2E,0x49,0x2B,0xE4,0xB1,0x41,0x2D,0x91,0x57,
+	0xB3,0xFB,0xF0,0x6A,0x83,0x26,0x89,0x5D,0xB7,0xEE,0x2F,
+	0xF3,0x93,0x58,0x0F,0x7C,0x88,0x73,0xF2,0x07,0xF0,0x73,
+	0x20,0x89,0x9D,0xBE,0x20,0xD1,0x33,0xB0,0xC0,0xA9,0x76,
+	0xB3,0x93,0x59,0xC5,0xAB,0x6B,0xA7,0x8B,0x86,0xDC,0xD7,
+	0xE0,0x87,0xF4,0x66,0x90,0x5E,0xA7,0xAA,0x8A,0x90,0x33,
+	0xAF,0xEA,0x49,0x2F,0xA6,0xBD,0x36,0x9D,0xA6,0x28,0xC8,
+	0x19,0x03,0xD3,0x9A,0xC2,0x54,0x2A,0x9B,0x5A,0x75,0x9A,
+	0xC9,0xAC,0xED,0x55,0xDB,0x5A,0x9B,0x9E,0x80,0xCD,0x05,
+	0x9B,0xF5,0x1A,0xBD,0xFA,0xEF,0x78,0x05,0x59,0x95,0xE4,
+	0x0C,0xEE,0x3B,0x78,0x45,0x8C,0xBD,0x63,0x24,0xCE,0xCD,
+	0x98,0xDF,0x48,0x46,0xA6,0x3A,0x7E,0x82,0x24,0x30,0x60,
+	0x2A,0x0D,0x07,0x8F,0xB6,0xEA,0x6D,0xFC,0x9D,0x36,0x7E,
+	0x35,0x84,0xD8,0xCB,0x75,0xF5,0x4B,0x12,0x88,0xAD,0x3C,
+	0x91,0x05,0xDF,0x01,0x2D,0x04,0xEE,0x7E,0x05,0x77,0xE1,
+	0xCE,0x93,0xF0,0x59,0xAD,0x83,0x1C,0xE0,0xAC,0x82,0x3A,
+	0xB0,0xBD,0x86,0x74,0x95,0x23,0x3E,0x5D,0xED,0xD0,0xA4,
+	0x6B,0x1C,0x8A,0x0A,0x0D,0x4E,0xEC,0xA1,0x0A,0x63,0xD1,
+	0xD8,0x3E,0x95,0xF4,0xEF,0x17,0x4F,0x45,0x12,0xD0,0x02,
+	0x7F,0xF6,0xD4,0x19,0xA0,0xE1,0x27,0xB6,0x3C,0xDB,0xE1,
+	0xDB,0x01,0xB4,0xE1,0x61,0x89,0x2E,0x83,0xC9,0xB6,0x0E,
+	0x2C,0xFE,0xDA,0x33,0xC9,0x70,0x77,0x15,0xDE,0xA7,0x2A,
+	0x64,0x4B,0xFB,0xD0,0xC6,0x7F,0x60,0xE3,0x2F,0xDA,0xA0,
+	0x62,0x48,0x87,0x8D,0x4F,0xFA,0x14,0x28,0x61,0x3F,0x87,
+	0xAF,0xE4,0xBF,0xEA,0x6D,0xE5,0x5F,0xEA,0x69,0xC1,0x27,
+	0x6C,0x6B,0xA7,0x9D,0x19,0xEC,0x22,0x44,0x14,0x07,0xAB,
+	0x48,0x15,0x0E,0x49,0x25,0xC4,0x94,0x5C,0x95,0x0B,0x8E,
+	0xEC,0x80,0x8E,0xF0,0xC7,0x0F,0xC4,0x83,0x13,0x13,0x92,
+	0x13,0xC8,0x7C,0xD1,0xAC,0xC1,0x2F,0x15,0x86,0x53,0x75,
+	0x67,0x5E,0x1D,0x34,0xA4,0xD9,0x7E,0x01,0x61,0x8B,0x8D,
+	0xAF,0x43,0x6A,0xC1,0xFF,0x24,0xBE,0x76,0xE6,0x55,0x1C,
+	0xA7,0x36,0x08,0x8D,0x29,0x91,0x87,0x8E,0xD2,0x47,0xE0,
+	0x71,0xDA,0xA8,0x4F,0x89,0x3B,0x0D,0x79,0x0F,0x27,0x22,
+	0x29,0x26,0x90,0xF1,0xDA,0xD7,0xCE,0x24,0x6B,0x68,0x5E,
+	0xCB,0x60,0x74,0xC7,0x47,0x5B,0x5C,0x63,0xE9,0x45,0x5C,
+	0xE3,0x88,0xBF,0x8C,0x04,0xCB,0x5C,0x5B,0x0E,0x5C,0x5B,
+	0x9D,0x60,0xA5,0xA5,0xB4,0xD3,0xA0,0x9C,0xB4,0x22,0x3E,
+	0xB6,0x8E,0xF2,0x34,0xD7,0x81,0x0D,0xF0,0x33,0xCB,0x45,
+	0xDB,0xC8,0x23,0xAE,0x19,0xA5,0xEC,0xFD,0xF0,0x95,0xF4,
+	0x43,0x17,0xDF,0x3A,0xA3,0xFC,0x21,0x17,0xCD,0xB9,0x1F,
+	0x1C,0xCD,0xC1,0x99,0xAE,0x19,0xF5,0x1A,0x93,0x8B,0x48,
+	0x65,0xB1,0x29,0x49,0xB3,0x94,0xA1,0x3D,0xD1,0xDD,0x80,
+	0xB0,0x49,0x51,0x17,0x84,0xE6,0xDF,0x99,0x2A,0xCE,0xD8,
+	0xA2,0x9F,0xE1,0x9E,0x3F,0xD3,0x65,0x74,0xCC,0xA9,0x52,
+	0x28,0xFE,0x4D,0x73,0x36,0xED,0x27,0x79,0x55,0x4A,0x38,
+	0x29,0x3D,0x65,0xAB,0xBE,0xC3,0x45,0x40,0xDB,0x0D,0x6B,
+	0x6A,0xD6,0xFD,0x94,0xA6,0x9D,0x4D,0x3B,0x70,0xBF,0x0B,
+	0x7D,0x87,0x80,0x98,0xAF,0xBE,0xCB,0xB8,0xC4,0x19,0x69,
+	0x2E,0xB9,0x1C,0x95,0x49,0xA4,0xE4,0x84,0x48,0x49,0x64,
+	0xFE,0x4D,0xCA,0xDA,0xB0,0xF0,0x14,0xED,0xB4,0x19,0x86,
+	0xB7,0x81,0x62,0xD4,0x01,0xA4,0x9C,0xB1,0x79,0x38,0x56,
+	0xF9,0x94,0x6D,0xF8,0xDA,0xC3,0xE9,0x94,0x37,0xF1,0xB4,
+	0x91,0xF1,0xBE,0x38,0x72,0x50,0xC7,0xD7,0xF1,0xEF,0xE3,
+	0x0E,0x56,0x38,0xC8,0x47,0xDE,0x60,0x71,0x99,0x34,0x1A,
+	0x8E,0x8E,0x22,0xC5,0x21,0xB9,0xEA,0xB4,0x9A,0xCE,0x0B,
+	0x04,0x57,0xB3,0xF7,0x5C,0x17,0x8B,0xD5,0x47,0x44,0x31,
+	0xED,0x7D,0xE8,0x1C,0xD3,0x91,0x9F,0x7F,0x4E,0xBB,0xBE,
+	0xFB,0x13,0x03,0x49,0xC3,0xFD,0x3B,0x3B,0x0E,0xE0,0x88,
+	0x56,0x4B,0x18,0x97,0x56,0xC7,0x6D,0x1F,0xE9,0xA8,0x5C,
+	0xBA,0x43,0xE6,0x8A,0x33,0x7C,0xBD,0xA7,0xDE,0xE0,0xE9,
+	0xC0,0x79,0x37,0x7D,0xCD,0x5D,0x4A,0x4B,0xD8,0xD3,0x61,
+	0xF0,0x5F,0xA4,0x4B,0x34,0x7B,0x3E,0x31,0x34,0x2C,0xD1,
+	0xE0,0x73,0x37,0x37,0xE1,0x9F,0xD4,0xF1,0x2F,0xB0,0x79,
+	0xC2,0x12,0x8D,0x60,0xED,0x93,0xD6,0xC3,0x16,0x96,0xAB,
+	0xF8,0x25,0xF1,0xD0,0x9F,0x17,0xDD,0xEF,0xFD,0x53,0x5C,
+	0x1D,0xFF,0x64,0xC2,0x11,0xE8,0x50,0x61,0x87,0xF3,0x93,
+	0xE6,0xBA,0xB4,0x2B,0x74,0x5C,0xEA,0x15,0x4B,0xA5,0xEA,
+	0x08,0xCE,0x6E,0x4C,0xFA,0x39,0x69,0xBE,0x0A,0xD5,0x79,
+	0x72,0x92,0x5E,0x14,0xF9,0x25,0x89,0xA5,0x8D,0xBB,0xFF,
+	0x4C,0xFE,0x0B,0xFF,0xC2,0x64,0x7C,0x7B,0x53,0xFD,0xC5,
+	0x3E,0x81,0xEB,0x87,0x98,0x40,0xB0,0x84,0xD9,0x60,0xDF,
+	0xFE,0x7D,0x74,0x5F,0xCA,0x08,0x85,0xA3,0xF9,0x83,0xDC,
+	0x59,0x9B,0xCB,0x5F,0xE0,0x4F,0x1F,0xCE,0x24,0x65,0x25,
+	0xBF,0x2B,0xB5,0x0C,0x9A,0x6A,0xFC,0xDC,0x60,0xEC,0x36,
+	0x91,0x0D,0xDC,0x21,0x40,0xD3,0xC8,0x7F,0x60,0x6A,0xF7,
+	0x1C,0x23,0xB7,0x92,0x7F,0xE2,0x73,0xDE,0xE6,0xB9,0x2A,
+	0x1C,0xA5,0xB7,0x43,0xE1,0x8C,0x37,0x41,0xDF,0x55,0xFD,
+	0x73,0xC2,0x73,0xD5,0x0D,0xDC,0x3B,0x90,0xB1,0x57,0xB0,
+	0x1C,0x84,0x9C,0xB5,0x34,0xA7,0xE5,0x28,0xCF,0xD5,0xE0,
+	0xD3,0x1C,0xC8,0x39,0x61,0x77,0x07,0x11,0x77,0xD7,0x43,
+	0x56,0x57,0x6D,0x3D,0xF7,0xF1,0xCB,0xE0,0x17,0x04,0x8B,
+	0xAE,0xCC,0xDA,0x9E,0x14,0xE8,0x0A,0xB4,0x94,0x06,0xCA,
+	0x2C,0x7D,0x3C,0x17,0x2C,0xE3,0x7E,0x97,0x57,0x66,0x69,
+	0xE7,0xB9,0xEE,0xA4,0xAA,0x5B,0x49,0x5E,0xA9,0xA5,0x8F,
+	0x0D,0x16,0x95,0xEF,0xF3,0x71,0x1F,0xEF,0xA9,0x71,0xAA,
+	0x4C,0xED,0x21,0x65,0x95,0x28,0x46,0xFA,0x5A,0x2A,0x32,
+	0x3C,0xA2,0x17,0x57,0x7B,0xB7,0x0C,0xE2,0x1A,0x4C,0x03,
+	0x60,0x2A,0x26,0x70,0x1A,0xC7,0x42,0x2A,0x69,0xD1,0x89,
+	0xE3,0xBA,0x8F,0xDF,0x26,0xED,0x9C,0xF9,0xA2,0x06,0xD7,
+	0x70,0xFF,0x0A,0x87,0x50,0x64,0x30,0xB8,0x63,0xCE,0x3C,
+	0x60,0x8F,0x90,0x83,0x2B,0x5D,0xE4,0x02,0x47,0xBF,0xC8,
+	0xC5,0xA5,0x3E,0x3F,0xC6,0xA9,0xB5,0xFA,0x11,0x68,0x18,
+	0x0E,0xB7,0x5E,0x15,0x99,0x06,0x8F,0x65,0x90,0x61,0xEA,
+	0x3D,0x96,0x01,0x26,0x74,0x04,0xC4,0x8F,0xC3,0x4A,0x15,
+	0xF6,0x65,0x58,0x15,0x0A,0x04,0x57,0x34,0xED,0x07,0xE0,
+	0x08,0x09,0xD7,0x95,0xEF,0x47,0x78,0xBF,0x1A,0x0B,0xAF,
+	0x81,0xD3,0x11,0xA2,0x2C,0x81,0xAC,0xE1,0x89,0xDC,0xA0,
+	0xD2,0xD5,0x3F,0x91,0x1B,0xF0,0xD8,0x34,0x8C,0x4C,0xFA,
+	0x13,0x69,0x35,0xB9,0x60,0xB8,0xD3,0x9A,0x72,0x47,0xBF,
+	0x23,0x2C,0xB3,0xF6,0xD1,0xF7,0x8F,0x5F,0x4C,0x3C,0x0D,
+	0x18,0xD9,0xE0,0xDC,0xB1,0xB0,0x81,0x0C,0x7E,0x80,0x1F,
+	0xC2,0x21,0xB7,0xCD,0xA7,0xD3,0x1A,0xC1,0xFA,0x18,0xD2,
+	0x1A,0x51,0x13,0x5B,0x7C,0x5C,0x9F,0x57,0x15,0xED,0xA9,
+	0xAA,0xC6,0xB6,0x17,0xDA,0x5A,0x72,0x71,0x0D,0x19,0xDC,
+	0x1B,0x67,0xA0,0x81,0x1B,0x14,0xC5,0x43,0x0B,0x84,0xD7,
+	0xFB,0x44,0xC1,0x3F,0x20,0x0A,0xAF,0xF4,0x8B,0xC2,0xDB,
+	0x61,0x31,0xD9,0x7F,0xF9,0xEC,0x5D,0xD3,0x84,0x96,0xDB,
+	0x3F,0x9C,0x50,0xC7,0xBF,0x34,0x28,0x46,0xD7,0xE2,0x8D,
+	0x8E,0xB0,0x1E,0x03,0x25,0xF3,0xBB,0x42,0xA1,0x4E,0xD1,
+	0xD3,0x8D,0x03,0x50,0x97,0xEB,0xC1,0x01,0xC2,0xEF,0x7D,
+	0x7A,0xC6,0x69,0x30,0xD7,0x6B,0x56,0xEB,0x09,0x7C,0x2F,
+	0xD7,0x33,0x9D,0xBB,0x88,0xA9,0xC6,0xCB,0xF5,0x7B,0xB9,
+	0x3E,0x5C,0xE8,0x09,0xB7,0x60,0xA2,0xAD,0x3C,0xC8,0x73,
+	0x5D,0x9A,0xAA,0x97,0x93,0xCE,0xCE,0x9C,0x50,0xE3,0x4C,
+	0xAE,0x7F,0xA9,0x5F,0x64,0xF8,0xD7,0x7B,0x45,0xAF,0xBF,
+	0x4F,0xE4,0x5F,0xE9,0x16,0xF9,0xB7,0x7B,0x44,0xFE,0x68,
+	0x50,0x2C,0x7D,0xA9,0x4B,0xD4,0x42,0xF3,0x33,0x97,0x2F,
+	0xD5,0xFB,0xB8,0x7E,0xF3,0xC1,0xD5,0x7A,0x81,0xEB,0x36,
+	0x97,0x3F,0x06,0x3F,0x41,0x73,0x79,0x2E,0xFC,0x74,0x99,
+	0xCB,0xF3,0xE0,0x5E,0x1F,0x74,0xF6,0xD7,0x42,0x73,0x33,
+	0x1F,0x7C,0x1C,0x12,0x7B,0x24,0xEC,0xE6,0x72,0x8B,0xBE,
+	0xCC,0x16,0x7E,0x3A,0x76,0x74,0x39,0x50,0x8D,0x34,0x7B,
+	0xE6,0xB3,0x74,0x43,0xD7,0x10,0x29,0xB3,0x74,0x97,0x59,
+	0xBB,0xAB,0xEE,0x22,0xB8,0xC2,0x63,0x03,0xD7,0x4D,0x4C,
+	0xA0,0x8F,0xE6,0x03,0x3E,0x5B,0x37,0x80,0x9C,0xAC,0x7F,
+	0x5C,0xED,0xE3,0x3E,0x35,0x97,0x26,0x25,0xE9,0xCD,0xE5,
+	0xAC,0x3E,0x83,0xA8,0xED,0x1B,0xDC,0x25,0x9F,0x7D,0xE5,
+	0x7C,0x12,0x50,0x24,0xE8,0x15,0x3E,0xEB,0xE7,0x3E,0xAE,
+	0x17,0x77,0xEA,0x4B,0xAA,0xD4,0x0D,0x3F,0x4E,0x01,0x45,
+	0x30,0x89,0xFC,0xB1,0xB8,0x8B,0x3E,0xAE,0x07,0x80,0x9B,
+	0xF9,0xA4,0x49,0x7A,0xC0,0x63,0x6A,0xCF,0x8B,0x3B,0x06,
+	0x98,0xCC,0x3C,0x9B,0xA8,0x2F,0x0D,0x00,0x32,0x71,0x16,
+	0x1B,0x3C,0xBD,0x7F,0x1F,0xAD,0x94,0x11,0x08,0xEF,0x33,
+	0x97,0xDF,0xAD,0x0F,0xDD,0x6A,0xDE,0x8D,0xE4,0x29,0xEC,
+	0x09,0x80,0x4A,0xA4,0x9B,0xB5,0x26,0xE8,0x19,0xC8,0xAE,
+	0x99,0x35,0x8A,0xDA,0x1E,0xBA,0x3A,0x9B,0x77,0x7F,0x98,
+	0x1B,0x60,0x9C,0x46,0xC0,0x96,0xAE,0xB6,0xDF,0x9E,0xAE,
+	0xDB,0x71,0xAB,0xF7,0x38,0xA5,0x7E,0x13,0x50,0xFF,0xD9,
+	0x30,0xF5,0x65,0xB6,0xC1,0x91,0x9C,0x58,0xB3,0xBB,0xFB,
+	0x20,0x31,0xEF,0x7F,0x48,0xBF,0x07,0xE7,0x74,0x26,0x29,
+	0x4C,0xED,0xE6,0xF2,0x07,0xF4,0xE6,0x83,0x0F,0xEA,0xCD,
+	0xFB,0x0D,0x7A,0x40,0xFB,0x90,0x9E,0xC9,0x98,0x0C,0xC6,
+	0x37,0x23,0x9E,0x38,0xA7,0x02,0xC4,0xDB,0xF4,0x4E,0x35,
+	0x24,0x3F,0xA8,0x57,0x9B,0x0F,0xB0,0x7A,0x00,0x3C,0x55,
+	0x4F,0x4B,0x78,0xE6,0x3F,0x00,0x2A,0x50,0x50,0x66,0xE9,
+	0x2A,0xB3,0x76,0x55,0xCD,0x94,0xA9,0xEB,0x8A,0x4F,0xC2,
+	0x59,0x15,0xBF,0xA5,0xDB,0x2D,0x2E,0x85,0x4A,0x66,0x10,
+	0xA5,0x3D,0x33,0x83,0x68,0x77,0xCC,0xC3,0x52,0x20,0xA7,
+	0x0C,0x25,0x71,0xE8,0x71,0x96,0x4F,0x22,0x85,0xAA,0x08,
+	0x25,0xD1,0x5F,0x65,0x88,0xC5,0xD1,0xEF,0x00,0x58,0x32,
+	0xFE,0x09,0x14,0x75,0x99,0x5A,0x42,0x28,0x21,0x9B,0x3B,
+	0x1A,0x99,0x9B,0x63,0x83,0x25,0xBF,0xDD,0x47,0x91,0xDD,
+	0x09,0x05,0x20,0x93,0x92,0x42,0x63,0x68,0xE9,0xD7,0xA5,
+	0xD2,0x9D,0x73,0x18,0x19,0xC0,0xFA,0xD1,0x00,0x08,0x52,
+	0x9B,0xFE,0x5B,0x5C,0x4D,0x93,0x71,0xA8,0xD2,0x45,0x50,
+	0x65,0x0A,0x45,0x21,0xD3,0x74,0x4F,0xBA,0x12,0x92,0x55,
+	0xCE,0x5B,0x7C,0xAE,0x2E,0x9F,0x25,0x24,0xA5,0x82,0x6C,
+	0x1F,0xD0,0x87,0x74,0x23,0x08,0xFD,0x1F,0x23,0x08,0x4D,
+	0x97,0xEE,0x39,0x67,0x4B,0x4A,0xE7,0x54,0xB1,0x41,0xE7,
+	0x57,0xC8,0xBE,0x8C,0x44,0xB5,0x7D,0x5A,0xC6,0x2E,0xF5,
+	0x8E,0xA9,0x14,0x94,0x8A,0x96,0xAD,0x01,0x47,0x37,0xCC,
+	0x57,0x19,0xAE,0xCA,0x59,0xC4,0x06,0x3F,0xD3,0x83,0x25,
+	0xD9,0x7C,0xF8,0x97,0xA4,0xEC,0xA8,0x45,0x2C,0x6D,0x02,
+	0x37,0x50,0x3B,0xC2,0x0B,0xBC,0x64,0x11,0xE1,0x1E,0x7C,
+	0x37,0xBC,0xB4,0x56,0xC4,0x79,0x0C,0x93,0x0C,0x50,0x60,
+	0xB1,0xEF,0x5F,0xD7,0x41,0x8B,0xB6,0x8A,0xA6,0x1A,0x0A,
+	0xFE,0x23,0x75,0x5C,0xAD,0x04,0x1E,0xE9,0xF6,0x1C,0xDD,
+	0x22,0x42,0xCB,0xF5,0x1C,0xB5,0x89,0x0A,0xA7,0x5E,0xA2,
+	0x02,0xE7,0x0E,0xA4,0x84,0x26,0x48,0xB5,0xC3,0x8B,0x29,
+	0xE6,0xFD,0x0F,0xA2,0x82,0xE8,0x65,0x4F,0x25,0xA9,0x10,
+	0x9D,0xB6,0xF1,0x74,0x74,0xA5,0x71,0xC9,0x93,0xAB,0xD0,
+	0x8B,0xE3,0xA6,0x6A,0x87,0xF2,0xCE,0xDE,0x65,0xD7,0x95,
+	0xBE,0x14,0x16,0xF9,0xD7,0xFB,0xE5,0x15,0x90,0xCC,0xE5,
+	0x3A,0x44,0x1B,0xAF,0x8F,0xFA,0x3B,0x3A,0x3B,0x5C,0xC8,
+	0x8E,0xCF,0x70,0x13,0x3B,0xCE,0xD5,0x70,0x6A,0x70,0x49,
+	0xFF,0x27,0xCE,0xF0,0xB5,0x91,0x29,0xFD,0xFE,0x8B,0x18,
+	0xE5,0x87,0xB4,0x8B,0x16,0x7B,0x06,0x75,0x2F,0xDE,0x42,
+	0x67,0x5C,0xEB,0xD3,0x8D,0x76,0x55,0xFA,0x2E,0x7B,0x08,
+	0x77,0x64,0xEF,0xA0,0xF3,0xAD,0x6F,0xAC,0x32,0x1F,0x88,
+	0xC7,0x39,0x30,0x3A,0x3D,0x5D,0xE7,0xFA,0x43,0x69,0x3B,
+	0x0F,0x9C,0x07,0x33,0xF4,0x44,0x44,0xDF,0x91,0x42,0x05,
+	0x2E,0xED,0x1C,0xA6,0x48,0xF7,0xD6,0xB8,0x8A,0x00,0x71,
+	0xF1,0xCF,0xA0,0x37,0xF2,0x6E,0x9C,0x86,0xBF,0x58,0xDA,
+	0xE8,0xA9,0x35,0xF8,0x6B,0xF8,0x0B,0x23,0x36,0x4B,0x76,
+	0x4C,0xC1,0xFB,0x09,0x9A,0x51,0xC9,0xCE,0x3B,0x0E,0x6B,
+	0x88,0x1F,0x2A,0x7B,0xC5,0x54,0xE3,0x69,0x98,0x18,0x2B,
+	0x8B,0xD0,0xFC,0xC3,0x3A,0x7A,0xEB,0xFD,0x91,0x1B,0x3A,
+	0x87,0x52,0xF9,0x2B,0x9E,0x06,0x03,0x2E,0x7D,0x06,0xAE,
+	0xC1,0x88,0x4B,0x06,0x4C,0x96,0x72,0x8E,0xCC,0x17,0xC3,
+	0x9F,0x98,0xA5,0x9A,0xFD,0x17,0xDD,0x2F,0xB2,0xEB,0x1C,
+	0x13,0x04,0x35,0x94,0xA3,0xCC,0xC2,0x98,0xE8,0x65,0xB2,
+	0xFB,0x45,0x05,0xC9,0xB4,0xC7,0xC7,0xAC,0x2D,0x51,0x9B,
+	0xF6,0x61,0x26,0x2E,0x6D,0x94,0xA5,0x11,0xD4,0x7C,0x56,
+	0x82,0xBF,0x36,0xD5,0xA7,0xF5,0x66,0xB1,0xA9,0x42,0x36,
+	0xC3,0x0F,0xF1,0x59,0xF1,0xA5,0x1F,0xC0,0xA9,0x12,0x17,
+	0x81,0xCA,0xD2,0x41,0xBF,0x9B,0x1B,0x5A,0xCC,0xA5,0xFA,
+	0xD6,0x68,0xFD,0xC7,0x32,0x53,0xBD,0xAB,0xD9,0x0C,0x1D,
+	0xB1,0x87,0x7C,0x59,0x6C,0x7D,0xD6,0x14,0x92,0xBE,0xCE,
+	0xC1,0xA6,0xAF,0x70,0xC4,0x00,0x17,0xD4,0xCA,0x2C,0x5D,
+	0xE6,0x3C,0xF5,0x8E,0x58,0x84,0x38,0xE1,0x24,0x72,0x71,
+	0x23,0x32,0x53,0x85,0x0F,0x48,0x22,0x49,0x92,0x45,0xD2,
+	0x44,0x97,0xAD,0xB8,0x17,0x97,0x07,0x55,0xA0,0x7E,0x2E,
+	0xC7,0x15,0x17,0xB4,0x91,0xBA,0x68,0xE5,0xD9,0x24,0xD2,
+	0x0A,0xCA,0x1A,0x51,0xB2,0x53,0xE0,0x61,0xFC,0x1F,0xA4,
+	0x9D,0xE2,0xB3,0x15,0xBC,0x41,0xF8,0x91,0xBF,0x26,0x55,
+	0x58,0xA2,0xE0,0xB3,0x55,0xC7,0x7F,0x04,0x27,0x49,0x7C,
+	0xB6,0x86,0x9E,0x3C,0xC8,0x67,0x43,0x35,0xE0,0xD4,0xF7,
+	0x4B,0x37,0x31,0x85,0xE7,0x36,0x16,0xEB,0x99,0xFA,0x54,
+	0xF7,0x3B,0xBB,0x89,0xD1,0xA9,0xCC,0x0C,0x75,0xC4,0xDE,
+	0x99,0xCC,0x5F,0xE3,0xCF,0x31,0x0D,0x0B,0x53,0x7D,0xBF,
+	0xDA,0x4D,0x98,0xCB,0x99,0xDE,0xD5,0xF1,0xA1,0x2B,0xCC,
+	0x19,0x5C,0x58,0x60,0x47,0x3C,0x2E,0x0D,0x13,0xD1,0x14,
+	0x49,0x31,0x55,0xC2,0x4A,0x0D,0x4E,0x83,0x56,0x08,0xD9,
+	0x0A,0xC1,0x40,0xDF,0x0D,0x9D,0x72,0xE8,0x77,0xEF,0x9A,
+	0x44,0x14,0xC5,0x1A,0x69,0x19,0x4E,0x90,0xC1,0xAB,0x84,
+	0x3F,0x87,0xB4,0xA9,0xF8,0xEC,0x78,0x4A,0x11,0xD0,0xA8,
+	0xA3,0x27,0x90,0x92,0x40,0x4F,0x34,0x7C,0x36,0x4B,0x4F,
+	0x74,0xFC,0x15,0x3E,0x3B,0xD1,0xD3,0x30,0x39,0x9C,0xAD,
+	0x77,0x3B,0xD3,0xB0,0x27,0x8B,0x6B,0x5D,0x7B,0xEA,0x27,
+	0xF8,0x6B,0x47,0x0D,0x5E,0xF1,0x65,0x4F,0xAE,0xCF,0xBE,
+	0x83,0xA4,0xDF,0x45,0x95,0x3D,0xB5,0x3E,0x7B,0x32,0x09,
+	0x19,0xA3,0x05,0xE2,0xC7,0x14,0xA8,0xCF,0xBE,0x93,0x88,
+	0xD9,0x93,0x84,0x95,0xF1,0xB8,0xED,0xCB,0x4A,0x40,0x8E,
+	0x93,0xFE,0x64,0x55,0xBA,0x11,0x5B,0xB3,0xAA,0xBB,0x09,
+	0x08,0x06,0xA5,0xC3,0x82,0x74,0x9A,0xA4,0x35,0xB8,0xA1,
+	0x26,0xFF,0x40,0x64,0xD7,0x53,0x1C,0x87,0xF3,0xF4,0xA4,
+	0x39,0x6F,0x34,0x45,0x59,0xAC,0xAE,0x9A,0x42,0x42,0x6A,
+	0xA7,0x12,0xA2,0x6E,0xBA,0xB2,0xB9,0xBC,0xC6,0xF9,0x24,
+	0x42,0x28,0x14,0x0A,0x8F,0x39,0xC6,0xAF,0xD1,0xBC,0x6B,
+	0xD0,0x00,0x72,0x24,0x74,0x8D,0x86,0x37,0xF0,0x01,0xE1,
+	0x47,0xFC,0x1A,0xA4,0x37,0x49,0x3B,0x76,0x8F,0x72,0x47,
+	0x14,0x0F,0xAE,0xFB,0x0D,0x16,0x7C,0x68,0x34,0xBD,0xD8,
+	0x3F,0x80,0x98,0xC1,0xD2,0x87,0x13,0xB7,0xE8,0x6C,0xB5,
+	0x2A,0xCD,0x65,0x9B,0xE0,0xEF,0x15,0xCF,0x6E,0x8E,0x6F,
+	0x37,0xEC,0x55,0x13,0x1B,0xFF,0x4A,0xC4,0xC6,0x44,0x9B,
+	0xCE,0x8D,0x55,0x79,0x69,0x35,0x47,0x5E,0x65,0xC0,0x04,
+	0x4C,0x01,0xE9,0xC5,0x35,0x3A,0x91,0x19,0xEB,0x9E,0xA8,
+	0xC3,0xE9,0xAF,0x75,0xB1,0x11,0x8C,0xA2,0x9E,0xEB,0x17,
+	0xC1,0xD0,0xCE,0x00,0xE3,0x8C,0x6E,0x7D,0x86,0x9E,0x91,
+	0x3B,0x1F,0xA8,0xB0,0xB9,0xC1,0x3F,0x61,0x43,0xC5,0xD3,
+	0x2C,0x36,0x78,0x62,0x40,0xB6,0xF4,0x78,0xFD,0x48,0xB2,
+	0xA6,0x8A,0x5C,0x3E,0xBB,0xD9,0xFB,0xAF,0xFD,0xD2,0xAC,
+	0x4B,0xEF,0xFC,0x5D,0xB7,0x4A,0x27,0xC9,0x25,0xB7,0x6A,
+	0xA7,0xB9,0x4B,0xFA,0xA5,0x8C,0x09,0x00,0x75,0x26,0x40,
+	0xDD,0x3F,0x53,0x8F,0x76,0x73,0x74,0x44,0x42,0x67,0xBC,
+	0x79,0x39,0xDC,0x52,0x81,0x4E,0xC8,0x83,0x5E,0x99,0xEF,
+	0xF5,0xB0,0x38,0xEB,0xD4,0xAC,0xA6,0xB3,0x69,0x3C,0x8D,
+	0x89,0xE4,0xFA,0xF5,0xC5,0xD4,0x8F,0xCE,0x37,0xA3,0xEC,
+	0xF1,0x72,0x03,0x7C,0x4E,0x1F,0xC4,0x73,0x0D,0x5C,0x98,
+	0x21,0xD0,0x65,0xF3,0xBD,0x0E,0x61,0x1C,0x94,0xC3,0x50,
+	0xEE,0x6C,0x5A,0xB1,0xA6,0x01,0xEC,0x30,0x81,0xA0,0x3A,
+	0x3C,0xBC,0x09,0xF0,0x88,0xFA,0xD3,0xED,0xC1,0x71,0xDF,
+	0x71,0xA8,0xD7,0x5C,0xF0,0x52,0x10,0x48,0x39,0xD3,0xCC,
+	0x07,0x2C,0xD8,0x6E,0x35,0xE6,0xF2,0xB5,0xFA,0x50,0x6A,
+	0xF2,0xA1,0xA5,0xF2,0x33,0x4F,0x8B,0x1E,0xA2,0x42,0xBB,
+	0x8A,0x7F,0x89,0x92,0x04,0x9C,0x89,0x87,0x1F,0xCC,0x44,
+	0xDD,0xC3,0x70,0xD5,0x64,0xF8,0xDE,0x5A,0xF0,0xA3,0xC9,
+	0xE6,0xFD,0x7A,0x36,0x5D,0x04,0xE7,0xA9,0x7C,0x21,0xD1,
+	0x7C,0x60,0xA9,0x7E,0x3A,0x43,0x20,0xBC,0x77,0xAA,0xDE,
+	0x32,0x86,0x14,0x6F,0x25,0x9A,0xA1,0xF7,0x0B,0x56,0x3D,
+	0x6E,0x4E,0xAD,0x63,0x25,0xE8,0xE0,0x33,0xC4,0x3D,0x98,
+	0xE8,0x50,0xBB,0x07,0x8D,0xCE,0x7C,0xFC,0xC2,0x39,0x87,
+	0x4B,0x21,0xB0,0x44,0x46,0xE6,0x99,0x0F,0xE4,0xE9,0xCD,
+	0x13,0x34,0xB9,0x7A,0x47,0x36,0x1B,0x7C,0x14,0x05,0xB3,
+	0x00,0x08,0xB6,0xE8,0x71,0x9A,0xE1,0x81,0xB5,0xE8,0x22,
+	0x67,0xCA,0x15,0x00,0x4F,0x12,0xBA,0x27,0x94,0x54,0xDA,
+	0x68,0xF6,0x26,0xAD,0x03,0x91,0x80,0x6F,0x37,0x76,0x45,
+	0x50,0x49,0x13,0x74,0xA9,0x1B,0x1B,0x23,0x09,0x36,0xB7,
+	0xAC,0x04,0x03,0x83,0xD2,0x46,0x88,0x0B,0xFC,0xF8,0x9A,
+	0x68,0x9B,0x7E,0xD5,0x7F,0x95,0x0E,0x08,0xBC,0x20,0x50,
+	0x98,0xF4,0x15,0xC4,0x62,0x6B,0x66,0x03,0x44,0xF6,0x9F,
+	0x77,0x97,0x74,0xED,0xB4,0x38,0x7F,0x24,0x58,0x83,0x7E,
+	0x8C,0xF6,0xBC,0x18,0xAE,0xD2,0xED,0x2F,0xBA,0xC1,0x4E,
+	0x79,0x76,0x41,0x68,0x93,0x94,0xF1,0xC8,0x24,0xA7,0x16,
+	0x8D,0x9E,0x22,0x14,0x9F,0xF1,0xA3,0x49,0xB8,0x72,0xAF,
+	0x82,0x50,0xD7,0xAA,0x88,0xED,0x9D,0x0E,0x4B,0xE4,0xC8,
+	0x4E,0x12,0xD2,0xEC,0xBE,0xBE,0x8F,0xBC,0xC8,0xF1,0x97,
+	0xD3,0x9A,0x02,0x1D,0xFE,0x8B,0x81,0x0E,0x61,0xB2,0xB0,
+	0x1C,0x1A,0x91,0x02,0xA7,0xCF,0x41,0x6B,0x75,0xA8,0x71,
+	0x32,0x9D,0x72,0x71,0xE8,0xFD,0x2A,0x15,0x79,0xF7,0x36,
+	0x4D,0x69,0xD3,0xD1,0x78,0x02,0x06,0x61,0x4C,0x03,0x73,
+	0x5E,0x0A,0xE1,0xDE,0x6C,0x7C,0xCB,0xE8,0x28,0xF8,0x3B,
+	0xE3,0xD1,0x91,0x77,0x7F,0x80,0x78,0x94,0xCC,0x77,0xC4,
+	0x53,0xF5,0xF3,0xA4,0x6A,0xA2,0x3C,0x3B,0xF3,0x26,0x77,
+	0x14,0xE3,0xDD,0x81,0x50,0x02,0xBA,0x0D,0x0D,0x5C,0x1F,
+	0x21,0x10,0xF8,0x83,0xC8,0xE8,0x9C,0x46,0x08,0x50,0x21,
+	0x15,0x4A,0xCD,0x6A,0xF2,0xA1,0x6A,0xCF,0xE4,0x5F,0x02,
+	0x25,0xE7,0xFA,0xC6,0xEA,0x5D,0x54,0xAF,0x29,0x0E,0x06,
+	0xB3,0xF6,0x8B,0xBB,0x4B,0xFA,0x7F,0x9E,0xE4,0x54,0xE3,
+	0xDE,0x50,0x4A,0xD0,0xDA,0xD8,0x96,0x88,0x41,0x8E,0x1C,
+	0xDF,0xD1,0x5D,0x75,0xD2,0x6A,0x62,0xE9,0x74,0x27,0xCD,
+	0xFA,0x30,0x4A,0x66,0x0C,0x0E,0x1D,0x1B,0x7C,0xE3,0x0B,
+	0xF3,0xFE,0x3D,0xA0,0x55,0x2F,0x4E,0x3F,0x42,0x20,0xCC,
+	0xAA,0x26,0xAD,0xE6,0x83,0x7B,0xF4,0xFE,0x8B,0xA6,0x76,
+	0xF7,0x02,0xE2,0x4C,0xC8,0x5C,0x9C,0x41,0x98,0x17,0x13,
+	0x70,0xD9,0xEA,0x7E,0xCC,0xD8,0xF9,0x39,0xA8,0x50,0x2F,
+	0x0E,0x3B,0xE8,0x23,0xBD,0x48,0x61,0x2F,0x86,0x3C,0x69,
+	0x1F,0xFA,0xB9,0xFE,0x50,0x5C,0x5A,0x13,0x66,0x4F,0x7C,
+	0xF1,0x6E,0xF3,0x09,0xF3,0x0B,0x7A,0xFE,0x5A,0xAA,0xCF,
+	0xC0,0xBC,0xFF,0xA8,0xDE,0xF9,0xC9,0x22,0xE6,0x02,0x6E,
+	0x27,0xF3,0x91,0xDF,0xDA,0xEF,0xDE,0x05,0x4D,0xA7,0x05,
+	0xC2,0xE8,0x44,0x68,0x4C,0x00,0xF0,0xD7,0x31,0xD5,0x48,
+	0x6B,0xC2,0xD2,0xE9,0x82,0xB5,0x57,0x70,0xF5,0x99,0xFD,
+	0xC9,0xFF,0xA0,0xE7,0x5D,0x3D,0x4C,0x9D,0x1F,0x7A,0x44,
+	0x82,0xD9,0x1D,0x03,0x30,0x51,0x06,0x18,0x0F,0x96,0x69,
+	0x8F,0x9E,0x19,0xC6,0xFC,0xC2,0xFB,0xE3,0xC2,0x3D,0x61,
+	0xED,0x65,0xEA,0x10,0x74,0x1C,0xEE,0x6C,0xA2,0x5A,0x9C,
+	0x19,0xEA,0x4B,0xFB,0x10,0xAF,0xEF,0xF0,0x5B,0xFB,0xF8,
+	0x7A,0xA5,0xAB,0x77,0xB1,0x6F,0x72,0xA6,0xD9,0xFB,0xCF,
+	0x7B,0xF4,0x9E,0xEB,0x0B,0x8A,0xD5,0x08,0x24,0x88,0x40,
+	0xCC,0xF5,0x2F,0xEF,0xD5,0x93,0x5F,0x8F,0xB6,0x79,0x52,
+	0x24,0x56,0xCF,0xE7,0x0C,0x62,0x8B,0x4C,0x37,0x3A,0x6F,
+	0x13,0x5D,0x3A,0xD1,0xA5,0xF9,0xC9,0xAA,0xBC,0xD2,0x46,
+	0x0B,0x3E,0x27,0xC9,0x0A,0xEE,0xF3,0x1C,0x4F,0x08,0x65,
+	0xA4,0x27,0x42,0xE3,0xCA,0xD1,0xF0,0xD7,0xE8,0xB4,0xF8,
+	0x98,0x20,0x49,0x2A,0x20,0xBA,0x06,0x23,0x45,0xE6,0x07,
+	0xD3,0x3A,0x63,0x46,0xC5,0xE2,0xE6,0x83,0xA3,0x9E,0x43,
+	0xB0,0x41,0xEE,0x73,0xF3,0xFE,0xD5,0x20,0x2B,0xA7,0xDA,
+	0xD4,0x0E,0xB4,0xE0,0x96,0x9B,0xC1,0xD5,0xD7,0x71,0x45,
+	0x1B,0x90,0x39,0x24,0x40,0xE0,0x1F,0x0F,0x77,0x13,0xAA,
+	0x92,0xD5,0xA5,0x4D,0x67,0xAA,0x52,0x35,0xF8,0x9D,0x85,
+	0xDF,0xB1,0x7A,0x05,0x7A,0x4E,0x55,0xEB,0x70,0x26,0xC1,
+	0x25,0xA5,0xAA,0x12,0xC8,0xD1,0x6C,0x4D,0xE9,0x07,0xFC,
+	0xFB,0xFE,0x63,0xA5,0x81,0x71,0x9A,0x86,0x96,0x6F,0xF6,
+	0xD4,0x25,0x08,0xD3,0x3C,0xD7,0x7B,0xED,0x2C,0x14,0x16,
+	0xB9,0xFE,0x45,0xA0,0x8A,0xFD,0x8C,0xEB,0x38,0xDF,0x32,
+	0xBE,0xEE,0x26,0xA0,0x2F,0xE8,0x92,0x7A,0xCC,0x49,0xB8,
+	0x8C,0xF0,0x6A,0xCD,0x91,0xA7,0x34,0xA5,0x81,0xD2,0xA6,
+	0xDC,0xAA,0x6C,0x0D,0xAE,0x92,0xB0,0xCA,0x5C,0x9E,0xAC,
+	0xCF,0xE8,0x15,0x8B,0x9F,0x82,0x8C,0xD8,0x6F,0x25,0xF4,
+	0xD9,0xEA,0x11,0x42,0x72,0x1B,0x6D,0x02,0x74,0x9C,0x6D,
+	0xC2,0xC9,0xE3,0xC7,0xD7,0x2A,0x6C,0xFC,0xEB,0x70,0xCE,
+	0xFB,0x7B,0x44,0x7C,0x94,0xBA,0xBB,0xA4,0xFB,0xCD,0xC7,
+	0x9D,0x77,0x81,0xD5,0x82,0x9F,0xA9,0x74,0xC1,0x58,0xED,
+	0xEE,0x92,0x1E,0xA2,0xB2,0xEB,0xA3,0x17,0x1A,0x57,0x82,
+	0xF9,0x40,0x32,0xEE,0xF7,0xF3,0x66,0x5E,0xE7,0x8B,0x44,
+	0x70,0xF5,0x78,0x70,0x20,0x58,0x0F,0xEE,0x27,0xC7,0xF5,
+	0xBE,0xBB,0x41,0x03,0x3E,0xAA,0xB4,0xE9,0xB0,0x8A,0x04,
+	0x0A,0xFB,0x03,0xD6,0xBE,0xB6,0x81,0x2A,0x16,0x6C,0x8F,
+	0x90,0xD3,0x37,0x8E,0x7F,0x9F,0x20,0x43,0x5A,0x9F,0x17,
+	0x9A,0x8D,0x80,0xEA,0x13,0x24,0x58,0xEA,0x04,0x22,0x58,
+	0x7A,0x27,0x9E,0x1E,0xF9,0x18,0xC4,0xDF,0x82,0xD9,0x79,
+	0x15,0x4E,0xDB,0x56,0x0F,0x5B,0xC8,0x91,0xBA,0x03,0x3E,
+	0xA0,0x5E,0x4F,0x97,0x77,0xAF,0xAD,0x62,0x12,0x3F,0x83,
+	0xB8,0xA3,0x5E,0x9F,0x56,0xB3,0x48,0x3A,0xF1,0xD4,0x2A,
+	0x3E,0x5D,0x17,0xAB,0x65,0x09,0x52,0xEC,0x20,0x3D,0xEC,
+	0x90,0x4B,0x2E,0x8E,0x29,0x09,0x48,0xA0,0x28,0xA4,0xAB,
+	0x15,0x84,0xE7,0x06,0xE8,0x9C,0x4A,0x8D,0x6D,0xBD,0x4D,
+	0x78,0x65,0x00,0x38,0xF8,0x52,0xAF,0x68,0x33,0xFC,0xFB,
+	0xEB,0x1A,0x62,0x3B,0x8C,0xCF,0xCA,0x8F,0x1F,0xED,0x17,
+	0xBF,0xD8,0x66,0xCB,0xC7,0xF9,0x1B,0x4D,0x11,0xE5,0x52,
+	0xC4,0x3C,0xC9,0xC4,0x2D,0xF7,0x78,0x4B,0xBF,0x8C,0xE7,
+	0x61,0xC0,0x43,0x62,0x29,0x8C,0xA0,0x09,0x27,0x5B,0x7E,
+	0x92,0x77,0x43,0x78,0x25,0x2C,0x9E,0x78,0xBB,0x4F,0x04,
+	0xD0,0x5F,0x14,0xAE,0xFB,0xA9,0x75,0xDA,0x88,0x47,0x81,
+	0xB1,0xB6,0x50,0x87,0xDA,0x20,0x3D,0x39,0xC1,0xF8,0x00,
+	0x5C,0xF5,0x9D,0x7A,0xEC,0xE4,0xD6,0x6B,0xEE,0xC4,0xA7,
+	0x1C,0xF5,0x7A,0x70,0x91,0x1A,0xBD,0x82,0x76,0x3F,0x93,
+	0xF5,0xA2,0xD8,0xF9,0x3C,0x09,0xAD,0x67,0x83,0x8F,0x7D,
+	0x45,0x75,0x04,0xB7,0xA8,0xA3,0x19,0x18,0xEC,0x7B,0xFE,
+	0xCB,0x57,0xC8,0x62,0x64,0xF0,0x7C,0x80,0x49,0x4D,0x11,
+	0x28,0x4E,0x9E,0xED,0x88,0x52,0x52,0x9C,0x1E,0x51,0xD6,
+	0x1A,0x50,0x18,0xFE,0x95,0x3E,0xD1,0xB6,0x0E,0xB5,0xA6,
+	0x17,0xD4,0x85,0x05,0xDD,0x80,0x1F,0x2D,0x7D,0x4C,0x51,
+	0x8F,0xDD,0x5B,0xC0,0xE5,0x60,0x47,0xFA,0xFD,0xB1,0xF2,
+	0x8A,0xB4,0x9A,0x08,0xDA,0xBB,0xA0,0x06,0x36,0x68,0x05,
+	0xB9,0x8D,0x02,0x98,0x64,0x44,0x46,0x55,0x24,0x38,0x3F,
+	0x77,0x9F,0x4C,0xFE,0x4D,0x22,0x24,0x1A,0xFF,0xD1,0xFA,
+	0x4B,0x90,0xA4,0xCE,0x62,0xC8,0x08,0xFC,0x84,0x1A,0x1C,
+	0x51,0x10,0x84,0x18,0x8E,0x90,0x0F,0x94,0x3F,0x01,0x94,
+	0xE2,0xDE,0xD1,0xA3,0x79,0x4A,0x59,0x4A,0x7D,0x8B,0x54,
+	0x07,0x1A,0x5A,0xCC,0xE3,0x2D,0xC0,0xDE,0x30,0xD5,0x3F,
+	0xAE,0x3F,0xD9,0x66,0xC1,0xC6,0xC4,0x20,0x4F,0x66,0x85,
+	0x91,0x50,0xE1,0xED,0x5E,0xD1,0x7F,0x19,0x1F,0x8C,0xCD,
+	0x3A,0x85,0x28,0x28,0x06,0xAB,0xED,0x89,0x69,0xD4,0xFF,
+	0x0C,0x63,0x48,0x57,0x38,0x26,0xCB,0x56,0x64,0x92,0x6C,
+	0x45,0x9E,0xA5,0x56,0x64,0x67,0xD4,0x96,0xC8,0xAF,0x26,
+	0x85,0x6E,0x0F,0xA7,0x50,0x26,0xFF,0x4F,0x88,0xAB,0xFE,
+	0x52,0xAF,0x99,0xCD,0x32,0xD3,0x9E,0xFA,0xF3,0x8D,0xC8,
+	0x2A,0x02,0x97,0xF5,0xE6,0x03,0x97,0xF4,0xF2,0x94,0x7B,
+	0x35,0x1B,0x3C,0xE9,0xDB,0x87,0x8F,0x44,0x2E,0xE9,0xCD,
+	0xE5,0x97,0xF5,0xA3,0x23,0xB8,0xC4,0xD2,0xC6,0xB2,0x92,
+	0x0E,0x1A,0xAB,0x3C,0xC2,0xCA,0xA1,0xCA,0x7F,0x65,0x83,
+	0x6F,0x89,0x55,0xCF,0xE3,0xF3,0xA1,0x26,0x1F,0xDF,0x40,
+	0x8B,0xF2,0x00,0x16,0x40,0x6A,0xE9,0x02,0xAF,0x8B,0x94,
+	0x87,0x9F,0x27,0xA3,0xAD,0x2A,0x0D,0x7C,0x71,0xC1,0xD9,
+	0x29,0xCA,0x32,0x6B,0x47,0x35,0x71,0x97,0x06,0x70,0xFF,
+	0xF7,0xFE,0x8E,0x7D,0x02,0x17,0x94,0x16,0x94,0x68,0xF7,
+	0x94,0x74,0x30,0xF6,0xCB,0x02,0xD7,0x61,0x3E,0x31,0xFF,
+	0x92,0x1E,0xB2,0xF1,0x59,0x0F,0x57,0xE3,0x8C,0xE8,0x60,
+	0x69,0x80,0xCF,0x9A,0x0D,0xFA,0x60,0xC6,0x57,0x4F,0x2A,
+	0xC0,0xFC,0x8E,0x94,0x07,0xF2,0xF2,0x59,0x66,0xDC,0x90,
+	0x3B,0x6B,0x8E,0x9C,0xD0,0xC5,0x67,0x3D,0x8A,0x41,0x52,
+	0x56,0xBA,0x9C,0xD0,0xC3,0x67,0xCD,0xC7,0xD8,0x29,0x2B,
+	0x53,0x4E,0xE8,0xE3,0xB3,0x16,0xE1,0xF6,0xE0,0x59,0x4B,
+	0xA4,0x84,0x2C,0xBA,0xA0,0xC5,0x04,0xBA,0xEB,0xBB,0xE7,
+	0xC5,0x87,0x55,0xF6,0x6B,0x80,0xBA,0x4A,0x41,0x28,0x91,
+	0xB8,0x47,0x41,0x14,0x97,0x9A,0xA2,0x52,0x44,0x51,0xA9,
+	0x28,0x2A,0x4D,0x14,0x95,0x8E,0xA2,0x8A,0x47,0x55,0x1E,
+	0xAE,0x44,0x02,0xAD,0x44,0x3F,0x56,0x82,0xAD,0x52,0x82,
+	0x67,0x18,0xFA,0x78,0x5F,0x94,0xFC,0x44,0x0A,0x73,0x52,
+	0x14,0xE6,0x64,0x0A,0x33,0x29,0x0A,0xF3,0x36,0x0A,0x73,
+	0xEA,0x08,0x98,0x77,0x46,0x61,0x26,0xD3,0x5D,0x80,0xDE,
+	0x8C,0x85,0x69,0xA4,0x30,0xEF,0x8E,0xC2,0x4C,0xA1,0x30,
+	0x53,0xA3,0x30,0xEF,0xA3,0x30,0x1F,0x88,0xB2,0xE4,0x41,
+	0xCA,0x92,0x19,0xE6,0x13,0xC9,0x97,0xF4,0xF5,0xD9,0x26,
+	0x12,0xCB,0x1B,0x9D,0x73,0x1D,0x30,0x46,0x6D,0x5F,0x8D,
+	0x8C,0x51,0xCB,0x8C,0x09,0xCE,0x89,0xC5,0xC8,0x51,0x8C,
+	0x4B,0xA3,0x18,0x1F,0xA3,0x18,0x97,0x47,0x31,0xE6,0x50,
+	0x8C,0xB9,0x51,0x8C,0x79,0x14,0xE3,0xEA,0xB1,0x88,0x34,
+	0x12,0x22,0xCD,0xB0,0x04,0xCE,0xB5,0x47,0x11,0x59,0x28,
+	0xA2,0xB5,0x51,0x44,0xEB,0x28,0xA2,0x27,0xA3,0x88,0xAC,
+	0x14,0xD1,0xFA,0x28,0xA2,0x0D,0x14,0xD1,0xA6,0x91,0x88,
+	0xEE,0x05,0x44,0x5A,0xFB,0x5D,0x88,0x48,0x1B,0xA9,0x91,
+	0xAD,0x3D,0xA6,0x46,0x36,0x8A,0x68,0xCB,0x58,0xF2,0x74,
+	0x12,0x79,0xBA,0x48,0x29,0x53,0x6C,0xA9,0x9F,0xD1,0x52,
+	0xDB,0xA2,0xE4,0x15,0x52,0xF2,0xB6,0x47,0xC9,0xB3,0x53,
+	0xF2,0x1C,0x51,0xF2,0x5C,0x94,0xBC,0x9D,0xB4,0x85,0xA8,
+	0x6E,0xEA,0x9D,0xC0,0x26,0x4F,0x66,0x41,0xCE,0x67,0x3E,
+	0xDA,0x67,0x3E,0xA8,0x67,0x47,0x45,0x8B,0x38,0xAE,0x17,
+	0x2C,0xF7,0x36,0x5C,0x36,0x05,0x2C,0x77,0xBD,0xA6,0x51,
+	0x8F,0xC3,0xD4,0xCE,0xEB,0x5F,0xD3,0xC0,0x4F,0x8B,0xFE,
+	0x75,0x8D,0xB9,0x34,0xE9,0x82,0xDE,0x84,0x8F,0x00,0x2F,
+	0xEA,0xCD,0x07,0x9B,0xE1,0xD3,0xA4,0x97,0x17,0xC0,0x01,
+	0xE3,0xFD,0xAA,0x28,0x37,0xD0,0x89,0xB4,0x54,0xB9,0x94,
+	0x1D,0x3A,0x4D,0x39,0xD8,0x65,0xD5,0xB1,0x0A,0xBA,0xFE,
+	0xCD,0x79,0xFD,0xDB,0xC3,0x37,0x1E,0x61,0x3A,0x1F,0x64,
+	0x40,0x36,0x09,0x5D,0x34,0xC2,0x55,0x60,0x27,0xCC,0xF9,
+	0x33,0x8A,0xEC,0x03,0x0D,0xC5,0x02,0x9C,0x09,0xEE,0x93,
+	0x7B,0x7F,0xAB,0xE0,0x77,0x1D,0x10,0xA8,0xA3,0x91,0xD1,
+	0xA3,0x7D,0xFB,0xA4,0x6B,0xC7,0x03,0x74,0xEA,0xD1,0xFC,
+	0x60,0xCA,0x55,0x5C,0x3D,0x87,0xD2,0xCD,0x74,0x9E,0xA7,
+	0x9D,0xB8,0x07,0x29,0xC2,0x34,0x2D,0x45,0xD8,0x59,0x23,
+	0x55,0xC7,0x26,0x5F,0x56,0x92,0x90,0x81,0x26,0xF8,0xE4,
+	0x84,0xFD,0x24,0xD2,0xB5,0x86,0x40,0x3B,0x8F,0x92,0x31,
+	0xA8,0x05,0x15,0x3A,0x92,0x59,0x76,0x98,0x10,0x99,0x9E,
+	0xE7,0x85,0x7D,0x60,0xE8,0x21,0x15,0x5C,0x29,0x1B,0xDC,
+	0x21,0xEC,0x33,0xAC,0xA9,0x11,0xAC,0x7D,0x42,0x4E,0x3F,
+	0xA4,0x01,0x15,0x05,0x10,0xCB,0xCE,0x9F,0xCD,0xE2,0x1A,
+	0x23,0xC5,0x62,0x2C,0xFA,0xD0,0xA2,0x88,0xA3,0xA4,0x90,
+	0xE7,0xE8,0x28,0x40,0x1C,0x48,0xC4,0x83,0x5F,0x03,0xB1,
+	0x86,0x8F,0x2B,0xE8,0x7A,0x34,0x40,0x7E,0x28,0x81,0x96,
+	0x5C,0xA9,0xA3,0x25,0x2B,0x18,0xCA,0x68,0x64,0xF8,0xFE,
+	0xC6,0x91,0x9D,0xF4,0xD8,0x3E,0x49,0xA4,0x87,0x2E,0x49,
+	0xC1,0x61,0x95,0x98,0xEE,0xB0,0x98,0xF7,0x37,0xEB,0xE5,
+	0xF7,0x5F,0x8F,0x21,0xBA,0xE9,0xE2,0x57,0xA2,0x48,0xC7,
+	0x53,0xB5,0xD0,0x4B,0xA2,0x00,0x2F,0xBB,0xFB,0x2A,0xFD,
+	0x99,0x55,0x67,0x93,0xBA,0x2D,0xFD,0x13,0xB8,0x3E,0x30,
+	0xEE,0x89,0x94,0x8E,0xAD,0x3A,0x59,0x62,0x21,0x89,0xBD,
+	0x64,0xA4,0x5B,0xBD,0xF1,0xED,0xA8,0x68,0x1A,0x41,0x85,
+	0x1E,0xF1,0xFD,0x1F,0x51,0xC1,0x8C,0xA4,0x62,0x9C,0xF7,
+	0xB7,0x94,0x22,0x8C,0x44,0xD6,0xB2,0x64,0x78,0xA1,0xA6,
+	0x60,0xFF,0x8D,0x7D,0xF2,0x0B,0x3D,0x7C,0xAA,0x74,0x96,
+	0x94,0x59,0x2E,0x96,0x59,0x2F,0x0E,0x3F,0x6A,0xBF,0x48,
+	0x16,0xB3,0xC1,0xA6,0x97,0xF7,0xB9,0x4B,0x2E,0xBA,0x1D,
+	0xFA,0x11,0x8D,0x88,0x42,0x62,0xCA,0x2C,0x41,0xC8,0x9F,
+	0x04,0x05,0xF2,0xA0,0xA8,0x5C,0x28,0x71,0x31,0xC8,0x5E,
+	0xF9,0xB2,0xC0,0x5D,0x32,0x97,0x3F,0xC9,0xD2,0x37,0x40,
+	0x56,0xF6,0xE1,0x76,0x31,0xF9,0x49,0xB6,0x7C,0x1D,0xEB,
+	0x6E,0x63,0xBC,0x49,0xEB,0xD9,0x43,0xDE,0x7F,0x73,0x63,
+	0x8A,0xFB,0xBA,0xDB,0xA1,0x76,0xB3,0xEB,0x59,0x05,0x70,
+	0x07,0xBE,0x1D,0x1C,0x54,0x25,0x37,0xAD,0x46,0x9E,0x44,
+	0xB7,0x99,0xF1,0x1C,0x57,0xD1,0x4D,0x73,0x1D,0x0F,0x95,
+	0x59,0x7B,0xD1,0x3E,0xFC,0x5E,0x89,0xEB,0x8E,0x41,0x53,
+	0x9F,0xC0,0xF5,0x3A,0x12,0xE8,0x8E,0x0A,0xF0,0xDD,0xCB,
+	0x38,0x35,0x66,0x77,0xEA,0x7A,0xF6,0x2B,0xDC,0x2B,0xF9,
+	0x55,0x66,0xDC,0xA7,0x1C,0x34,0xBE,0xC9,0x95,0x1E,0xA3,
+	0xEC,0x5F,0xCB,0xCA,0x32,0x30,0x22,0x8C,0x12,0x35,0xB8,
+	0x92,0x90,0xB2,0x0A,0x27,0xC7,0xF5,0xF9,0xFE,0xB5,0x4F,
+	0x44,0xE2,0xE4,0x87,0x27,0x37,0x8B,0x94,0x6E,0x0A,0x49,
+	0x8D,0x90,0x34,0xDF,0x01,0xD2,0x68,0x40,0xFA,0x43,0xDA,
+	0x6F,0x2A,0x05,0x72,0x03,0x51,0x3A,0x16,0xC8,0x6C,0x4B,
+	0x3E,0xE4,0xA5,0x0C,0xCE,0x65,0x71,0x04,0x45,0x79,0x1E,
+	0xCB,0x27,0xAD,0x86,0xD3,0xAE,0x44,0x3E,0xC9,0xC2,0x86,
+	0x6E,0x3F,0xA4,0x93,0xEF,0x36,0x68,0xF2,0x70,0x5D,0x0A,
+	0xB8,0xD9,0xA0,0xB1,0xC0,0x59,0x2C,0x87,0x64,0x52,0x06,
+	0x45,0x51,0x06,0xFE,0x98,0x0C,0x3C,0xE9,0x10,0x0F,0x81,
+	0xB6,0x86,0x20,0x0C,0x5C,0xE6,0x7E,0x56,0xD3,0x63,0xFC,
+	0x2B,0x83,0xA2,0xA7,0x64,0x50,0x74,0xA6,0x7A,0x4A,0x74,
+	0x44,0x5A,0x17,0xC8,0x4E,0x7B,0xEC,0xB7,0x1D,0x8A,0x1B,
+	0x27,0xEF,0x4D,0xDE,0x4A,0x46,0x78,0x28,0xE1,0x63,0x0F,
+	0xC5,0x0B,0xAF,0xDC,0x8C,0x61,0x11,0x0A,0x6F,0xCB,0xE5,
+	0xCF,0xF1,0xEF,0xD3,0x45,0xA0,0xA4,0x62,0x60,0x5E,0xDE,
+	0xC4,0x11,0x07,0x46,0xE9,0x4D,0x78,0x65,0xC2,0xF0,0xFB,
+	0xBD,0xDE,0xB4,0x5A,0x9C,0x17,0x63,0xD1,0x4D,0x37,0x80,
+	0x30,0x34,0xB8,0x49,0x9A,0x73,0x0A,0xDF,0xC2,0xF7,0x8D,
+	0xCC,0xC3,0x5F,0xF0,0x5C,0xC5,0xB5,0x14,0x78,0xAE,0x5D,
+	0xE0,0xA0,0x23,0xD2,0x81,0x85,0x4A,0xF0,0xDD,0x27,0xBE,
+	0x82,0xB6,0xF6,0xE2,0x8E,0xDD,0x5C,0x1B,0xEF,0x82,0xB6,
+	0xDC,0x53,0xC6,0xB5,0x63,0xAF,0xCA,0x32,0x48,0x17,0xA4,
+	0x2A,0x6D,0xE1,0x21,0x92,0xA5,0x1B,0x2A,0x85,0x1D,0xB7,
+	0x55,0xCD,0x57,0x1C,0xF9,0x27,0x5D,0x69,0x20,0xB7,0xCA,
+	0xAB,0x4B,0xC2,0x1E,0xE0,0x41,0x5C,0x59,0xAF,0xD9,0x79,
+	0x68,0x82,0xF0,0x76,0xBF,0x5C,0xAB,0x01,0xC8,0x3D,0x10,
+	0xE9,0x92,0xE8,0x48,0x4C,0xA4,0xAB,0xC2,0x37,0xE7,0xF4,
+	0xB9,0xA9,0xCC,0x8D,0xA9,0x87,0x12,0x22,0xDC,0x00,0x46,
+	0xAA,0x66,0x7D,0x28,0x34,0xE3,0x4B,0x1A,0xFE,0x95,0xF0,
+	0x98,0x87,0xA8,0x5F,0xC3,0x51,0xFD,0x37,0x73,0x54,0x41,
+	0x7B,0x53,0x72,0x89,0xC5,0xB2,0xCC,0x6F,0x39,0xF4,0x73,
+	0x9B,0xF0,0xBA,0x8E,0x44,0x64,0x89,0xAF,0x96,0xE9,0x16,
+	0xB2,0x77,0xD3,0xF9,0xAB,0x1A,0x5C,0x0E,0xCA,0x8E,0x01,
+	0xF9,0xAD,0x87,0x0C,0xA3,0xF3,0xC5,0x08,0x7B,0xF8,0xE9,
+	0xA7,0x46,0x7E,0x91,0x1D,0x23,0x38,0xC7,0x52,0x19,0xD7,
+	0x1D,0x87,0xFC,0x11,0x2A,0x91,0x53,0x36,0x7E,0xB2,0xF7,
+	0x05,0x95,0xF7,0x49,0x35,0xB2,0xCB,0x53,0x32,0x40,0x9C,
+	0xD3,0x0E,0xB1,0xB1,0x19,0xF8,0xC9,0x0D,0x4B,0xC0,0x38,
+	0x46,0x33,0x51,0x9E,0xCA,0x8F,0x4C,0x63,0xF4,0x0B,0x23,
+	0xF1,0x9D,0xAC,0xB9,0xDC,0x81,0x2F,0xBF,0x9F,0xA5,0xEC,
+	0x58,0xA4,0x39,0xBB,0x59,0xCB,0x27,0xEF,0x84,0xF6,0xE1,
+	0x60,0xC7,0x6B,0x8B,0x9A,0xAA,0xCD,0xF8,0x52,0x1C,0x72,
+	0x83,0xEC,0x7E,0xBD,0x87,0x3E,0x74,0xAF,0xA1,0x0F,0xDD,
+	0x97,0x32,0x10,0xA4,0x1C,0xC5,0x69,0x24,0xF3,0xDD,0x2C,
+	0x1F,0x30,0xFB,0x35,0xFF,0xC0,0x8E,0xD3,0x93,0x9E,0x35,
+	0x9C,0x6B,0x8F,0x94,0xEB,0xA5,0xF1,0x72,0x8D,0xB4,0xA6,
+	0xE8,0xD6,0x9E,0x65,0xCD,0x07,0x8B,0xE9,0xFB,0x54,0x17,
+	0x7B,0x28,0x13,0xC9,0xF4,0xA6,0x6E,0x67,0x0F,0x2D,0xC4,
+	0xB3,0xF8,0x76,0xA7,0x9E,0x4F,0x86,0x74,0x0E,0xAF,0x0E,
+	0xDA,0x59,0xE8,0x79,0x94,0xB0,0xE6,0x03,0x2F,0xB0,0x91,
+	0x95,0x98,0xD9,0x60,0x4E,0x09,0xED,0x79,0xBC,0x00,0xF5,
+	0x2D,0x61,0x43,0xF8,0x1E,0xE7,0x69,0x20,0xFC,0x89,0x2A,
+	0x02,0xF1,0xC8,0xCE,0x92,0x7D,0xF4,0x0E,0x0F,0xA5,0xE4,
+	0x12,0x8B,0xC0,0x69,0x83,0x03,0xA6,0xDD,0x2B,0x4D,0x15,
+	0x59,0x2B,0x40,0x9F,0xD9,0xDF,0x20,0x1C,0x95,0x1E,0xD7,
+	0x3B,0x55,0xF8,0x3C,0x5B,0x4B,0xAD,0xEB,0x54,0xC4,0x43,
+	0x11,0xE2,0x2A,0x7C,0x2F,0xC6,0x20,0x99,0x8D,0x2F,0xF4,
+	0x81,0xE8,0xDD,0x90,0x8D,0x29,0x4E,0x05,0xDF,0x8F,0x59,
+	0x03,0x57,0x69,0xE6,0xC0,0x55,0x36,0xB8,0xDD,0xB3,0x4F,
+	0x46,0x17,0x37,0x8C,0xFF,0xEB,0x2D,0x33,0xB5,0x3D,0x28,
+	0xAA,0x49,0x87,0x16,0xE3,0x48,0x07,0xB9,0xF6,0x2A,0xF9,
+	0xD1,0xFA,0xD7,0xDB,0x74,0xA9,0xE4,0xE4,0x43,0x59,0xA8,
+	0x2C,0x72,0x49,0x4D,0x03,0x8E,0x5A,0x20,0x63,0xCB,0x4A,
+	0xAF,0x19,0x73,0xF3,0x56,0x49,0x1A,0xB9,0xBF,0x98,0x35,
+	0xB5,0xCF,0xE3,0xFA,0x77,0xA8,0x4C,0x35,0xA1,0x7B,0x65,
+	0x50,0x77,0x1E,0x5A,0xE2,0xC3,0x66,0x83,0x43,0x2E,0xA0,
+	0xD9,0x45,0x41,0x0E,0x50,0x90,0x92,0xD2,0xFD,0x94,0xBE,
+	0xC5,0x40,0x4A,0xA0,0xFB,0x46,0xC1,0xCC,0x6D,0xB0,0x23,
+	0x94,0x9F,0xEE,0x15,0x9D,0x77,0xC4,0x4A,0x4A,0x9A,0x11,
+	0x74,0xC0,0x25,0x29,0xDE,0x19,0xB3,0xC0,0xBE,0xC0,0xE2,
+	0x33,0x45,0xB9,0x54,0x6D,0xF1,0x74,0xF3,0x81,0x12,0x56,
+	0x7E,0x7D,0x75,0x3B,0x7F,0xCE,0xDF,0xC2,0x5C,0x9E,0xF7,
+	0x82,0xC2,0xA9,0x13,0x54,0x52,0x09,0x4F,0x9D,0x6A,0x51,
+	0x28,0x30,0xBC,0x34,0x63,0xD4,0xBF,0xE7,0x55,0xBF,0xA7,
+	0x1C,0xEC,0x7E,0xA0,0xBD,0xBA,0x56,0xC9,0xD7,0x99,0x6A,
+	0x7A,0xE0,0x12,0xAE,0xDE,0xF8,0xCC,0x11,0x0F,0x29,0xDE,
+	0x96,0x1E,0x68,0xA7,0x3F,0xAC,0xF8,0x0C,0xCE,0xE5,0x3B,
+	0xD3,0x3F,0x23,0x19,0x9F,0x11,0x87,0x5E,0xBA,0x6B,0xAA,
+	0x59,0x87,0x5C,0x91,0x2E,0xAE,0xD3,0xD7,0x2F,0x31,0xAD,
+	0x02,0x6A,0xF0,0x47,0xB6,0xC2,0xE0,0xA9,0x55,0xF5,0xD0,
+	0x53,0x4F,0xAD,0x1A,0x20,0xD0,0x53,0x6F,0x5D,0x05,0x3B,
+	0x2A,0xDD,0x7B,0xC2,0xDB,0x60,0xF6,0xB1,0x55,0x50,0x31,
+	0xD3,0x09,0xBE,0xE5,0xDA,0xE7,0x66,0x6F,0xD2,0x7E,0x96,
+	0x6F,0x49,0x6B,0x82,0xD3,0x83,0x07,0x58,0xB9,0xC5,0xAD,
+	0xAA,0xCA,0x24,0x47,0x70,0x64,0xA0,0x79,0xFF,0x7E,0xD6,
+	0xAB,0x3D,0xF2,0x13,0x90,0xC0,0x01,0x38,0x79,0xE2,0xCC,
+	0x7B,0xAF,0x76,0xBC,0x4A,0x5E,0x4B,0x7A,0x8D,0x72,0x34,
+	0x5D,0xB9,0x63,0xBB,0xA9,0x9D,0xAF,0x0B,0x5C,0x9D,0x21,
+	0xFE,0xB7,0x0A,0x9C,0xC1,0xFF,0x16,0x1B,0x4F,0xE8,0x4B,
+	0xF2,0xB7,0x59,0x05,0x31,0x97,0x57,0x80,0x26,0x1E,0x62,
+	0x43,0x3F,0x1E,0x79,0x87,0x89,0xDE,0x49,0xA3,0x77,0x26,
+	0x48,0x77,0x0E,0xB1,0xC4,0x8D,0x77,0x42,0x53,0xE0,0xA2,
+	0x02,0x2F,0xC6,0xDC,0x7C,0x1B,0x54,0xDD,0x0C,0x65,0x85,
+	0x64,0xFC,0x9A,0xFF,0x16,0xC8,0x0E,0x4F,0x92,0xDE,0x62,
+	0x2B,0x55,0x91,0x31,0x6C,0xA2,0x21,0xED,0xBA,0xA7,0xC3,
+	0x00,0xB7,0xE1,0x16,0x6F,0xDE,0x07,0x5F,0xC9,0xBF,0xC0,
+	0xB3,0x5F,0xB3,0x66,0xE5,0xFC,0x43,0x78,0xF9,0x1B,0xD6,
+	0xF3,0x89,0xC1,0xAC,0x04,0xA0,0xE6,0x5B,0x92,0x00,0x26,
+	0x3F,0xFF,0x97,0xEC,0xC8,0x67,0x68,0x90,0xF4,0x2A,0x90,
+	0xF8,0x0A,0x7C,0x5E,0x97,0x15,0x22,0xC2,0x71,0xEF,0x31,
+	0xEF,0x89,0xC6,0x8F,0xCD,0xFB,0xAB,0xD9,0xC6,0x8F,0xDF,
+	0x48,0x74,0xDC,0x55,0xA1,0xA9,0x3E,0x07,0x92,0xFB,0x33,
+	0x4A,0xCE,0x7B,0xDC,0xDD,0xFE,0x85,0xAE,0x1B,0x12,0x2A,
+	0x34,0x98,0xE4,0x6D,0xED,0x09,0x4D,0x7D,0xC3,0xE8,0x48,
+	0xAE,0x22,0x86,0xB3,0x89,0xDE,0x6E,0xF7,0x7B,0x8A,0xD8,
+	0x7B,0xDE,0x93,0xF8,0x5C,0xE0,0xAD,0x21,0x89,0xED,0x33,
+	0x7F,0x2B,0xFD,0x2D,0xA5,0x7F,0x33,0x7F,0x9B,0x3B,0xEE,
+	0x5F,0x34,0xC6,0xA8,0xD7,0x54,0xB1,0xB9,0xC0,0x9C,0x7A,
+	0xCD,0xEF,0xD8,0xDB,0x51,0x7A,0xE6,0x83,0xFB,0xE1,0xF3,
+	0x0E,0x8B,0xB4,0x41,0x6A,0x39,0x9B,0x0B,0xF4,0xFD,0x54,
+	0xD6,0x36,0x06,0x5A,0x79,0x83,0xE6,0x8F,0x6C,0xA3,0x32,
+	0xA4,0xA5,0x27,0x15,0xCA,0x91,0x94,0xA3,0x1B,0xAB,0x60,
+	0x42,0x0A,0x80,0x78,0xF0,0xF7,0xAC,0xB7,0xD5,0xD4,0x1E,
+	0x18,0x08,0x0C,0x4C,0x57,0x92,0xEA,0xE3,0x4A,0x36,0xA8,
+	0x1F,0xAA,0x60,0x7A,0xAA,0x4F,0x48,0xA0,0x9C,0x1A,0xC8,
+	0xA8,0x0A,0x3D,0x02,0x59,0x51,0xB7,0x10,0x67,0xC5,0x2D,
+	0xA3,0x54,0xAD,0xB1,0xD5,0x7C,0xB0,0x0A,0x4D,0xFB,0xEF,
+	0x59,0x7C,0xAF,0x74,0xB0,0x9C,0xC5,0x67,0x69,0x9D,0x7D,
+	0x0C,0xB0,0xC3,0x82,0xFA,0xB5,0x11,0xF4,0xCB,0xA7,0x4D,
+	0xE9,0x4D,0x6F,0x74,0xE8,0xD3,0x2B,0x9C,0x71,0x32,0x51,
+	0x32,0x75,0x8D,0x4A,0xCA,0xB2,0xF4,0x49,0x3B,0x1E,0x1C,
+	0x56,0xB1,0x84,0xD7,0xA1,0x56,0xBF,0x67,0x19,0xF3,0xEE,
+	0xF9,0x98,0xD3,0xA9,0xAE,0x52,0x90,0x50,0x12,0x86,0x86,
+	0x13,0xF1,0x4B,0xD3,0xF9,0x16,0x06,0xFC,0x34,0x0F,0x6E,
+	0xFD,0xF1,0x95,0xD4,0x36,0xBE,0x0D,0x61,0x95,0x37,0x6E,
+	0xA6,0x57,0xA0,0x49,0x23,0x55,0x2B,0x46,0xA5,0x62,0x14,
+	0x08,0x94,0x6B,0xB4,0x02,0x81,0x96,0x01,0x84,0x0A,0x49,
+	0x8B,0x94,0x49,0x87,0xA8,0x2A,0xE1,0x9A,0x16,0xF8,0xF5,
+	0xEA,0xB0,0x7B,0x7B,0x23,0xD3,0x91,0x1C,0x5B,0x63,0xEF,
+	0xF1,0x74,0x2D,0xF6,0x2F,0x77,0xC4,0x4B,0x95,0x0D,0xE9,
+	0x42,0x9B,0xA4,0x2A,0xB9,0x6F,0x30,0x3B,0xE2,0x2B,0xEE,
+	0xA3,0xD4,0x03,0xD5,0x23,0x1B,0x49,0xA4,0x89,0x34,0x68,
+	0x7E,0xC1,0x92,0x2A,0x5C,0x4C,0x83,0x25,0xD8,0x6E,0x7E,
+	0x03,0x57,0x74,0xBE,0xD7,0xEB,0x78,0x8D,0x0D,0xA8,0x1C,
+	0xC8,0x2F,0x07,0x22,0xCA,0xA1,0x3D,0x94,0xC7,0xD0,0xE1,
+	0x76,0xAC,0x91,0x45,0x20,0x73,0x79,0x1C,0xC0,0x15,0xF0,
+	0xF3,0x4B,0xE9,0xEA,0x15,0x09,0xCD,0x6F,0xA4,0xC4,0x57,
+	0x21,0x31,0x82,0xA6,0x4A,0x6A,0xDE,0x11,0x54,0xBF,0x1E,
+	0xD7,0x93,0x9B,0xCA,0x4A,0xEA,0xCB,0x2C,0xF5,0x65,0xD6,
+	0xFA,0xE8,0x2B,0xC2,0x7E,0x70,0xB0,0xF2,0x73,0xB7,0x3C,
+	0x73,0x39,0xE8,0x70,0xF9,0x1F,0xD9,0xAA,0x44,0x5C,0x90,
+	0x90,0x4C,0xC5,0x51,0xA9,0xCF,0xBB,0x4B,0xEA,0xA7,0x3A,
+	0x57,0xF8,0xB8,0x93,0xE9,0x0C,0x8E,0x69,0x65,0xAB,0x59,
+	0x77,0x68,0x7E,0xBA,0x42,0x3E,0xCF,0x0C,0x3D,0x9C,0xAE,
+	0x02,0xD6,0xA9,0xE5,0xEB,0xF5,0xA1,0xBB,0x29,0x2B,0x75,
+	0xF2,0xF5,0xF6,0xD0,0xA4,0xF4,0x78,0x87,0x2E,0x7D,0x02,
+	0xA4,0x25,0x60,0x87,0x04,0xD2,0x96,0x9A,0x3D,0xF3,0xAB,
+	0x21,0x4A,0xBD,0x0F,0x91,0x4C,0x92,0x08,0x02,0x94,0x52,
+	0x67,0xE9,0x64,0xA2,0x08,0x5E,0xF2,0x79,0xE8,0x61,0x9D,
+	0x12,0x1D,0x52,0xFE,0xF5,0x52,0x7E,0x87,0xB2,0xF3,0x6D,
+	0x52,0x61,0xA8,0x3E,0x0F,0xCD,0xE7,0x7F,0xD1,0xE6,0x53,
+	0x57,0xF1,0xE6,0xE1,0x20,0xBD,0x5A,0xE6,0x88,0xC7,0x04,
+	0xAE,0x3F,0xFD,0x4D,0xE7,0x17,0x70,0x0D,0x56,0xDB,0x5D,
+	0xD2,0xFF,0xA6,0xF3,0x6C,0x59,0x49,0x5B,0x99,0xA5,0xAD,
+	0xCC,0xDA,0x26,0x51,0x1B,0xAD,0xB7,0xC2,0x90,0x17,0x79,
+	0x35,0x3A,0x15,0x6A,0xDB,0x46,0x76,0x43,0x6D,0x07,0x9E,
+	0x0B,0x73,0x6D,0x6E,0x47,0x42,0x98,0xEB,0x61,0x64,0x62,
+	0x15,0x65,0x25,0xE7,0xCB,0x2C,0xE7,0xCB,0xAC,0xE7,0xA3,
+	0x65,0x13,0x0D,0x51,0x9E,0xF1,0xDC,0x05,0x9E,0x6B,0xAD,
+	0xBA,0x95,0xEE,0x33,0x8D,0xEF,0x37,0x0E,0x3D,0xE7,0x29,
+	0xB9,0x40,0x10,0x46,0xAB,0x04,0xE3,0x08,0xCB,0xC8,0x15,
+	0x36,0x03,0xF5,0x87,0x80,0xDE,0x3F,0x8D,0xA0,0xFE,0x4F,
+	0xA3,0xA8,0xFF,0xD3,0x30,0xF5,0x12,0x05,0x6E,0x88,0x09,
+	0xE1,0xDB,0xB1,0x9C,0x3E,0xF2,0xAE,0xAE,0x56,0x1E,0x15,
+	0x45,0x5A,0x3E,0xC7,0x31,0x0F,0xAE,0xF0,0xB4,0xD6,0xDD,
+	0xE6,0xF6,0x5E,0x76,0x77,0xB8,0xBD,0x5C,0xDF,0x9C,0x3E,
+	0x67,0x8A,0xF7,0xA2,0xA9,0x36,0x5C,0xCB,0x38,0x26,0xBA,
+	0xBF,0x60,0xC0,0x08,0xC5,0x8B,0x5C,0xEF,0xEE,0x92,0xDE,
+	0xB5,0x8A,0xE2,0xF8,0x6A,0x37,0x81,0x02,0xA1,0xE3,0xA1,
+	0xC5,0x7B,0xC3,0xAE,0x05,0x38,0x6E,0xF3,0xA2,0xA9,0x1D,
+	0x33,0xBB,0x1D,0x69,0xD0,0x98,0x06,0xA6,0x6B,0x09,0x45,
+	0xAA,0x32,0x1F,0xFC,0x03,0x9B,0xA1,0xC6,0x11,0x74,0x0C,
+	0x71,0x4E,0x84,0x8C,0x95,0xD0,0x0D,0x6B,0x1E,0x48,0xD1,
+	0xE2,0x8D,0x90,0xDA,0xEC,0x4D,0xFD,0x03,0xB4,0xE1,0x8F,
+	0x07,0xC7,0xED,0xED,0x5B,0xD6,0xEC,0xEE,0x76,0x13,0xBE,
+	0x81,0xBF,0x00,0xB4,0x43,0xFD,0x87,0x1F,0x3A,0xE5,0xD2,
+	0xBA,0x28,0x62,0xAE,0xF7,0xFF,0x01,0x1C,0xBD,0x94,0x1C,
+	0x79,0x36,0x65,0x92,0xB3,0xE9,0x46,0x15,0x73,0x8F,0xBA,
+	0xCE,0x1C,0x75,0x6D,0x1C,0x75,0x9D,0x18,0xBD,0x4E,0xAA,
+	0xAA,0xD5,0xE5,0x26,0x95,0xBD,0xB2,0x53,0xCC,0x83,0x3E,
+	0xBE,0x6B,0x9F,0xE7,0xF8,0xD4,0xBD,0x61,0x67,0x22,0x84,
+	0x23,0x09,0x65,0x2F,0xED,0x14,0x4B,0x9B,0xD8,0xE0,0x1C,
+	0x65,0xC8,0x80,0xE7,0xFC,0x75,0xFE,0x73,0xBC,0x3E,0xF8,
+	0xFC,0x3E,0xF3,0xFE,0x77,0x28,0x71,0xFB,0x7F,0xCF,0xE6,
+	0x0E,0x1B,0xA7,0xA8,0x05,0x52,0x8B,0xA2,0xA7,0x49,0xCC,
+	0xCB,0x35,0x8B,0x66,0x48,0x16,0xD1,0x96,0x89,0xE6,0x3F,
+	0xB2,0x49,0x55,0x13,0xE2,0x86,0x71,0x79,0x11,0x57,0xD2,
+	0x68,0x5C,0xEF,0x29,0x46,0xE2,0x32,0x3F,0xBF,0x6F,0xF4,
+	0xB3,0xFE,0x3C,0x6F,0x1D,0xBA,0x14,0x70,0x26,0x49,0x92,
+	0x33,0x49,0x19,0x02,0x9B,0x5C,0xEB,0x6D,0xD1,0x35,0x62,
+	0xD0,0x12,0x4A,0xC0,0x8D,0xC1,0xBD,0x2D,0x70,0x9E,0xA0,
+	0xE8,0xD9,0xF3,0x21,0x54,0x15,0x9C,0x8C,0xB2,0x0A,0x0C,
+	0x09,0x34,0xE0,0x98,0x68,0x25,0x4F,0x86,0x32,0x43,0x82,
+	0x02,0xF9,0x53,0x86,0x7A,0xC6,0xB8,0x4F,0xF7,0x7B,0xBA,
+	0x11,0xFE,0x33,0x09,0xA0,0xDF,0x53,0xA1,0x40,0x4C,0x52,
+	0xDE,0x8A,0x78,0xB8,0xD3,0x13,0x71,0x21,0xF5,0xDA,0x43,
+	0x47,0x12,0x89,0xDB,0x60,0x5A,0x37,0x1C,0x77,0x8E,0xC5,
+	0x93,0xC0,0x8C,0x87,0x27,0x61,0x0C,0x9E,0xD4,0x0A,0x65,
+	0x0C,0x1E,0x76,0x24,0x9E,0xF3,0x88,0xE7,0xDE,0x44,0xB7,
+	0xC1,0x28,0xD5,0x89,0xBA,0x5B,0x6F,0xD2,0x01,0x96,0x4E,
+	0x6D,0x91,0x46,0x98,0x79,0x8F,0xED,0xC1,0xD7,0x02,0x87,
+	0x20,0x60,0xFA,0x1D,0x3B,0xE7,0x98,0x0B,0x12,0xA4,0xB3,
+	0xE2,0xD5,0xDE,0x13,0xE0,0x5E,0x7E,0xCD,0xDE,0x77,0xD6,
+	0xEC,0x07,0xD7,0xE0,0x3D,0x69,0xF6,0x25,0x55,0x81,0x48,
+	0xBD,0x96,0x21,0xAF,0x4D,0xBC,0x56,0x38,0xC4,0x5F,0x2E,
+	0xBD,0x18,0x68,0xF5,0xD7,0x32,0xF5,0xA6,0xF6,0x3D,0x9F,
+	0xBA,0x52,0xC0,0xB9,0xBA,0xE7,0x57,0xB1,0xC4,0x35,0x39,
+	0x55,0x98,0xEC,0xA9,0x57,0x0C,0xD5,0xF0,0x53,0x3C,0x75,
+	0x0A,0xF3,0xA3,0xE0,0xF6,0xED,0xDD,0x43,0xC7,0xE7,0x74,
+	0xDB,0x2F,0x01,0x8C,0xDF,0x01,0x28,0x5C,0x4A,0xFC,0xFE,
+	0x5A,0xBE,0x51,0x02,0x19,0xBE,0xD6,0x65,0x3E,0x01,0x98,
+	0x02,0xAD,0xA6,0x30,0x53,0xB7,0xE7,0x94,0xEB,0x5E,0x53,
+	0x93,0x0C,0x6A,0x8A,0xD9,0x97,0x7A,0x90,0x35,0xD5,0x24,
+	0x18,0x87,0x6A,0x79,0x2D,0x85,0x06,0x25,0xEC,0x9D,0x43,
+	0xF5,0x73,0xCE,0xD9,0x3F,0xE0,0xBB,0x9F,0x8A,0x46,0x3A,
+	0xE6,0x21,0x0D,0x44,0x14,0x10,0xF6,0x01,0xC2,0xDF,0xB1,
+	0xF6,0x89,0x58,0x8D,0xA1,0x93,0x18,0x66,0x80,0x22,0xB3,
+	0xC1,0x09,0xE2,0x88,0xF1,0x29,0xF1,0x4E,0x1C,0x9E,0xB3,
+	0x1F,0xFD,0xEE,0x31,0x31,0x54,0x9C,0x1E,0xE7,0xBC,0x07,
+	0x63,0xC7,0x04,0xED,0x50,0x0D,0x65,0xD3,0xA3,0x10,0x8D,
+	0xD8,0x9F,0x8C,0x64,0x79,0x5D,0x94,0x9F,0x53,0xED,0x8F,
+	0xDC,0x8A,0x8F,0xDC,0xF2,0x88,0xA6,0x30,0x25,0x92,0x0F,
+	0x78,0x3F,0xA6,0xE8,0x25,0x36,0xE1,0xCE,0xE0,0x98,0xDD,
+	0xD4,0xCE,0x34,0x52,0x3E,0x06,0x5A,0x29,0x1F,0x99,0x3A,
+	0xDE,0x00,0xA4,0xEE,0x67,0x63,0xFA,0x1D,0x38,0x38,0x0B,
+	0x87,0x0A,0x4C,0xC2,0xCD,0x65,0x4C,0xED,0x8B,0xD9,0xE0,
+	0xE3,0x22,0x4D,0x71,0xF6,0xC4,0xE8,0x88,0x14,0x00,0x2C,
+	0x45,0x1C,0xA8,0xCD,0xE6,0xFD,0x55,0x2C,0x5F,0xC7,0x37,
+	0x5E,0x0B,0xF1,0x75,0x94,0x2E,0x8C,0x18,0x70,0x8C,0xBF,
+	0x8A,0x81,0x38,0x5A,0x0A,0x20,0xBC,0x03,0x10,0x42,0xF4,
+	0x8C,0x0E,0xB9,0xBD,0x2D,0x98,0x2A,0xE9,0xC4,0x2A,0x4A,
+	0x9B,0xA9,0x9D,0xD2,0x06,0x28,0x7E,0x07,0x4C,0xBF,0x67,
+	0x58,0x92,0x89,0x43,0x35,0x0D,0x5A,0xA3,0x76,0x58,0x8A,
+	0xBD,0x43,0xC7,0xCD,0x8F,0xA6,0x02,0x77,0xFF,0xF2,0x84,
+	0x4C,0x55,0x75,0x95,0x12,0x3A,0x08,0x15,0x4C,0xF5,0xBB,
+	0xA0,0x7F,0x0A,0xB8,0xEA,0x01,0x0D,0x69,0x05,0x4B,0xED,
+	0xBD,0xDA,0x63,0x12,0xC1,0x1E,0x9B,0x7D,0x2F,0xBF,0xC7,
+	0xF6,0x0C,0x1D,0x77,0xDF,0x48,0xB0,0x77,0x40,0x4B,0x80,
+	0x1C,0xB1,0x2D,0x4C,0x2A,0x8F,0xA5,0xC7,0x96,0x6B,0x89,
+	0x96,0xBB,0x6F,0x54,0xB9,0x9F,0x98,0xDA,0x2B,0xD5,0x7C,
+	0x9D,0xB7,0xB1,0xF9,0x6A,0xF5,0x07,0xCA,0xB8,0x96,0x9E,
+	0x98,0x37,0xC5,0xD5,0x2D,0x90,0x75,0x38,0xA7,0xB7,0xC1,
+	0xDB,0x5C,0x7D,0x91,0x36,0xA2,0x01,0x53,0xBB,0x3A,0x91,
+	0xF4,0x54,0x5F,0x46,0x27,0x01,0x69,0x3D,0xD1,0x32,0x15,
+	0x2A,0x08,0x1A,0xB1,0x19,0x9D,0x80,0x26,0x77,0x5C,0xAE,
+	0x12,0x9C,0x4B,0xAC,0x9B,0x32,0xCC,0xBA,0x8A,0xAB,0x51,
+	0x86,0x4E,0x1E,0x4E,0x35,0xD5,0x60,0x2A,0x85,0xA0,0xC4,
+	0x52,0xC0,0x08,0x3C,0x37,0xE0,0x79,0xEC,0x5B,0x3B,0x10,
+	0xD4,0x70,0x84,0x57,0xA9,0xEC,0x69,0x0E,0xC5,0x8A,0x23,
+	0xD6,0x7E,0x45,0x32,0x26,0x44,0x65,0xD6,0x1A,0x45,0xAC,
+	0x1F,0x57,0x92,0xB4,0x1E,0xDE,0xE3,0x52,0x16,0xDD,0xA8,
+	0x82,0xEB,0x46,0xD8,0x46,0x29,0xB6,0x44,0xBF,0x59,0x31,
+	0xAB,0xBA,0x46,0xD9,0x03,0xEC,0x88,0x49,0x5B,0x17,0xD3,
+	0x1F,0x8E,0x10,0x72,0xDB,0x28,0x94,0x18,0x6D,0x57,0xAA,
+	0x52,0x18,0x9A,0xD4,0x0C,0x28,0x54,0xFC,0x31,0xD9,0x6F,
+	0x6C,0xAF,0xD0,0xC6,0x46,0xAF,0xD0,0x37,0x8C,0x3B,0x29,
+	0x95,0x3C,0x0E,0xD9,0x22,0x37,0x63,0xEB,0x13,0x17,0x1B,
+	0xF0,0x56,0xC6,0x41,0x21,0xFE,0x62,0x73,0x17,0xB8,0xD6,
+	0x70,0xA5,0xC6,0xDD,0xC6,0xA4,0xBC,0xDB,0xDC,0x16,0xD7,
+	0x18,0xA9,0x59,0xDC,0xA8,0x9A,0x85,0x26,0x56,0x68,0xDD,
+	0xA7,0x0C,0x72,0xD2,0xC9,0x28,0x2B,0x23,0x72,0x3D,0x47,
+	0xE5,0x01,0x86,0xB1,0x42,0x2D,0x1B,0x54,0x94,0xAE,0x64,
+	0x30,0x13,0x68,0xBA,0x24,0x2D,0x95,0x2C,0x7B,0x59,0x0B,
+	0xD6,0xC5,0xEA,0x46,0xB4,0x1C,0x85,0x51,0x91,0x48,0xCB,
+	0xC5,0x18,0x5D,0x19,0x86,0x24,0x7D,0x49,0x97,0x14,0x23,
+	0xA5,0x8F,0x7C,0x7F,0x54,0xF3,0x0E,0xEB,0x58,0x0E,0x9A,
+	0x05,0xF7,0xA5,0xAE,0x09,0x1A,0xF6,0x21,0x6F,0xCB,0x6C,
+	0x46,0x77,0x1C,0x12,0xA5,0x1E,0x0B,0xD8,0x76,0xF0,0x03,
+	0x66,0x6F,0xF2,0x3B,0x6C,0xC4,0xF4,0xA3,0x8F,0xAA,0xA6,
+	0xEE,0xB8,0x29,0xD0,0xE6,0x6D,0x0D,0xB4,0x99,0xDA,0xE3,
+	0xA8,0x2B,0x8B,0x91,0x95,0x85,0xAF,0xAB,0x64,0xF9,0x0B,
+	0xCD,0x3D,0xCD,0x41,0xFE,0xF3,0xC0,0x47,0xD0,0x1B,0xFA,
+	0x28,0xEE,0x64,0xA5,0xBE,0x39,0x64,0x12,0x2B,0x55,0xEE,
+	0xAB,0x4C,0xF3,0xD5,0x4A,0x3D,0x44,0x21,0x5D,0x71,0x2D,
+	0xC0,0x57,0x35,0xF0,0x15,0x2E,0x28,0x5F,0x11,0xB1,0x52,
+	0x46,0x3C,0xF2,0x8D,0x39,0xEE,0xD7,0x01,0xA6,0x49,0x12,
+	0x2C,0x78,0x89,0x34,0xD5,0xE8,0xF6,0x20,0xF7,0xD2,0x25,
+	0xD9,0xB8,0xDB,0x77,0xA1,0x84,0xA7,0xC4,0x8A,0x47,0xF2,
+	0x68,0xBE,0x29,0xDE,0x80,0xFB,0x23,0xA5,0xE9,0x53,0xEF,
+	0x71,0xFE,0x9C,0xBB,0x7D,0x5E,0xA0,0xC3,0xFB,0x51,0xA0,
+	0x83,0x3F,0x19,0xD7,0xEB,0x3D,0xDF,0xD8,0xDD,0xD8,0xED,
+	0x6E,0x67,0xBC,0x85,0xD7,0xBC,0x36,0x10,0xB8,0xE0,0x02,
+	0xDF,0xD0,0xDC,0xC1,0x73,0xE1,0xB8,0xDE,0x4A,0x25,0xFC,
+	0x78,0x1B,0x9B,0x82,0x29,0x4C,0x25,0xD8,0x45,0x9F,0x25,
+	0x8C,0xDB,0x1E,0xE1,0x76,0x23,0x50,0xF7,0xB8,0x93,0x3D,
+	0xBE,0x35,0xC9,0xDE,0x46,0xDC,0xB8,0xB7,0x52,0xC5,0xD7,
+	0x7B,0x1B,0x03,0x1D,0x8D,0xC1,0x40,0x47,0x0A,0xC3,0xF7,
+	0x35,0xB7,0xC6,0xD5,0xFA,0xB4,0x58,0x6E,0x36,0xDE,0x55,
+	0x4B,0x57,0x95,0xCA,0x14,0xA6,0xB9,0x95,0x0F,0x40,0x85,
+	0xE3,0x8E,0xC9,0xBC,0x3E,0x09,0x76,0xC7,0xBD,0x2B,0x49,
+	0xED,0x8C,0xF0,0xB7,0x52,0xD3,0xDC,0x26,0xAC,0x9C,0xEC,
+	0xF9,0xC8,0x10,0x17,0x90,0x6A,0x3B,0x31,0xAA,0x71,0x54,
+	0xBD,0x2A,0x34,0xF4,0xC2,0xB7,0x32,0x11,0x6E,0xB8,0x3B,
+	0x15,0xB1,0xF7,0x84,0x35,0x89,0x9E,0x2E,0x05,0x6F,0x09,
+	0xFB,0x2C,0xD7,0x4C,0x61,0x2F,0x20,0xC3,0x55,0x6E,0x19,
+	0xBE,0x16,0xAA,0xA5,0x3B,0x5D,0x19,0xD7,0xDC,0x53,0xA9,
+	0xF6,0x74,0x30,0xBE,0xCD,0x93,0xA0,0x8A,0x32,0xFC,0xC4,
+	0x51,0x1A,0xED,0xCB,0xBE,0x05,0xC4,0xFB,0x39,0x5F,0x0F,
+	0x19,0xBD,0x27,0x81,0x4D,0xB5,0x81,0x8E,0xCA,0xB8,0xB8,
+	0x3E,0x61,0xC7,0x24,0x28,0xAE,0xC5,0xD4,0x46,0x28,0x7D,
+	0xCC,0xB7,0xF9,0xB6,0xB8,0xCF,0x87,0xDE,0x93,0x80,0x4C,
+	0x1A,0x05,0x44,0xC8,0xBE,0x6D,0x29,0x30,0xCF,0xC7,0x5D,
+	0x03,0x5F,0x51,0xEF,0x3D,0x59,0x19,0x07,0x34,0x70,0xE1,
+	0xE6,0x20,0x14,0x07,0x8E,0x68,0x52,0x98,0x40,0x07,0x70,
+	0xA9,0x8F,0x3F,0xE6,0x6D,0xC4,0x49,0x3A,0x61,0xB9,0x91,
+	0x62,0x99,0xCD,0x53,0x51,0x8C,0xB7,0x8E,0xA4,0xE9,0x0E,
+	0xF4,0x39,0x95,0x4A,0xD0,0x1B,0x1F,0x80,0x69,0xE3,0xB9,
+	0x81,0xB8,0x46,0xB9,0xC4,0x80,0x6F,0xF3,0x9D,0x58,0x22,
+	0x69,0x64,0x89,0x29,0xD4,0x46,0x03,0xE7,0x9B,0xDB,0x2A,
+	0x91,0xFB,0x1A,0xE0,0xFD,0xB1,0x08,0x53,0x27,0x8F,0x62,
+	0xAA,0x94,0xAA,0x1D,0x4E,0xF5,0x71,0xE8,0xBA,0x2A,0x35,
+	0x3D,0x51,0x31,0xC6,0xDA,0x9A,0x88,0x92,0x49,0xFA,0x97,
+	0x92,0x88,0xC4,0xF9,0xB2,0x93,0x1B,0x83,0x71,0xA7,0x1B,
+	0x83,0x95,0x6A,0x94,0x73,0xA5,0x32,0x0E,0x93,0xB0,0x34,
+	0x28,0x54,0x6B,0xA5,0x2A,0xE6,0x32,0xD0,0x1A,0x68,0xA5,
+	0x5A,0x21,0x25,0xCC,0xA6,0x49,0x95,0x9A,0x98,0x04,0x14,
+	0x5C,0xDC,0xB1,0xD1,0xEA,0x2E,0xD1,0xEA,0xDB,0xAC,0x90,
+	0xF4,0xBD,0x5B,0x0D,0x77,0x4C,0x27,0x47,0x54,0x7B,0xB3,
+	0xD4,0x46,0x86,0xDE,0x43,0x8E,0x30,0x23,0x6F,0x49,0x8A,
+	0x53,0xA1,0x18,0x29,0xAB,0x4A,0x64,0x16,0xDB,0xD4,0xEA,
+	0xDB,0xAC,0x73,0xB7,0x4F,0xD3,0xC9,0x6D,0xE9,0x3D,0x37,
+	0x02,0x50,0x8E,0x04,0x10,0x2F,0x01,0x50,0x8D,0x16,0xF6,
+	0x1A,0x9D,0x2F,0xDB,0xD0,0xDC,0x25,0x3C,0x9D,0x00,0x6D,
+	0x5B,0x2B,0xB7,0xED,0x4A,0xB5,0x49,0x6C,0x6E,0x75,0x5F,
+	0x9D,0x26,0x0B,0x2A,0xAE,0x0E,0x8A,0x79,0x4F,0xC6,0x9A,
+	0xF1,0xD1,0x0A,0x3E,0xB2,0x39,0x4B,0x24,0x4C,0x1C,0x6B,
+	0xB0,0xA7,0x7C,0x6D,0x81,0x11,0xED,0xBF,0xCC,0x36,0x38,
+	0xDA,0xA6,0x68,0x46,0xD8,0x94,0x7F,0x57,0x49,0x26,0x02,
+	0x25,0x18,0x18,0x0C,0x0C,0xBA,0xDB,0x94,0xEE,0x7B,0x6F,
+	0x54,0x6A,0x74,0x53,0xF8,0xDA,0xE6,0x41,0xF7,0xBD,0xD7,
+	0xA1,0x36,0x95,0xDA,0xE6,0x81,0x4A,0x65,0x63,0x5B,0x0A,
+	0xD3,0xD8,0xA6,0x9B,0xD2,0xD4,0xEA,0xBE,0xF7,0x9A,0x4E,
+	0x3B,0xDA,0x8C,0x32,0xEE,0x7E,0x06,0x0C,0x1D,0xFC,0xDE,
+	0xFB,0x59,0x53,0xBB,0xEE,0x5E,0xD0,0x3E,0x25,0x05,0x01,
+	0xE5,0xD5,0xEE,0x7B,0xAF,0x34,0xB5,0x55,0xAA,0x64,0xA0,
+	0x9B,0x93,0xBF,0x82,0x54,0x7C,0x5A,0x84,0x30,0x75,0x6B,
+	0x92,0x21,0x65,0x48,0x97,0x9D,0x3C,0x4E,0xED,0x2A,0x35,
+	0x94,0x36,0xE8,0xBC,0x81,0x52,0xA4,0x00,0xEC,0x77,0x9B,
+	0x5A,0xF9,0xCB,0x3A,0x6D,0x69,0x8B,0xA7,0x3E,0xD9,0x5F,
+	0x33,0x5E,0x09,0xF5,0x70,0x89,0xC6,0x56,0x77,0xCA,0xF5,
+	0xC6,0x56,0xDD,0x78,0x66,0xB3,0x52,0x39,0x9C,0xCD,0x9D,
+	0x72,0xAD,0x69,0xFC,0x4C,0x34,0x0B,0xD2,0x99,0x82,0x55,
+	0x4B,0xF9,0xEC,0xEB,0xB3,0x21,0x89,0xA8,0xFB,0xEE,0x94,
+	0x2B,0x37,0xCF,0x48,0x33,0x69,0x30,0xD3,0xBB,0xD1,0x4C,
+	0x93,0xC7,0x40,0x43,0xBA,0x40,0x93,0xEE,0xDD,0x05,0x99,
+	0xB4,0xC3,0x41,0xCE,0xA8,0x4C,0x6A,0x35,0x6E,0x83,0x20,
+	0x81,0x60,0xC6,0xDC,0xCD,0xE4,0xB3,0x55,0xA3,0x15,0x3E,
+	0x72,0x8F,0xCF,0x96,0xDB,0x82,0x7A,0x1C,0xCC,0x95,0xEA,
+	0x11,0x4D,0x5D,0x39,0x82,0xFC,0x69,0xA8,0x28,0x42,0xB6,
+	0x26,0xEE,0x74,0x4A,0x4D,0x5C,0x2D,0xAE,0x59,0xB5,0x46,
+	0x23,0x64,0xEB,0xB0,0x47,0xE1,0x6E,0x5B,0x90,0xB2,0x60,
+	0x6E,0xAD,0x5D,0xE5,0xC9,0xD6,0x65,0x8E,0x6E,0x29,0x51,
+	0xCC,0xF1,0xE3,0x63,0x16,0xD6,0xC4,0xA7,0x4C,0x73,0xB7,
+	0xB5,0xA2,0x6B,0x85,0x73,0x3E,0x3B,0x41,0x82,0x39,0x2D,
+	0x65,0x9A,0x04,0x33,0xC1,0x28,0x15,0x54,0x8E,0x2F,0x6D,
+	0xA5,0x37,0x9B,0x1D,0x36,0x12,0x63,0xB9,0x09,0xB7,0x0D,
+	0xA3,0x8D,0x5C,0xCC,0xB3,0x6F,0xB0,0xC3,0x1C,0xB0,0x1C,
+	0x5B,0x28,0x77,0xAD,0x42,0x53,0xCF,0x85,0x89,0xDC,0x8C,
+	0x72,0xFA,0xA3,0x68,0x04,0x4B,0xD8,0x6B,0xFB,0x6B,0x1C,
+	0x58,0xF2,0xFE,0x66,0x88,0x66,0x2B,0xE3,0xD0,0xD0,0xC5,
+	0x35,0xE2,0xF0,0xC2,0xEC,0x44,0x48,0x44,0x55,0xF1,0x9E,
+	0x70,0x7F,0xCC,0x98,0x4E,0x8D,0xF6,0x2D,0xC3,0xF5,0xC7,
+	0xC2,0xDE,0x1E,0x6C,0x52,0xC3,0x00,0x80,0x8D,0x93,0xC6,
+	0x37,0x05,0xC2,0x9A,0x49,0x29,0x06,0x77,0x5B,0x2F,0x32,
+	0x85,0xCF,0x9E,0x2C,0x64,0x4F,0x12,0xD6,0x4C,0xC6,0xC8,
+	0x0C,0x53,0x0D,0x73,0x1B,0x91,0x2F,0x93,0x13,0xC7,0x29,
+	0x3B,0xDC,0x6E,0xDE,0xC0,0x07,0x18,0xF4,0x15,0xB6,0x92,
+	0x78,0xB3,0x93,0xC6,0xD1,0xB7,0x61,0x16,0x4E,0x67,0x20,
+	0xC7,0x14,0xB0,0xFC,0x52,0xC5,0xC1,0xF5,0xDB,0xAE,0xA1,
+	0x41,0x99,0x24,0xE4,0x84,0xA5,0xDC,0x81,0x2F,0x21,0xBF,
+	0xF7,0x2C,0xCD,0x0F,0xB5,0xA4,0x2E,0x0D,0xEA,0xA2,0x89,
+	0x65,0x46,0x26,0x34,0xFB,0xEC,0xDB,0xE0,0x86,0xA4,0x44,
+	0x03,0xC8,0xD2,0x13,0x11,0x6F,0x06,0xC5,0xA1,0x1C,0x5A,
+	0x8C,0x6E,0x3E,0x7B,0xAA,0x44,0x4C,0xD2,0x98,0x3A,0x4F,
+	0x4D,0xD9,0xE5,0x6E,0x73,0x4B,0x75,0xBE,0x53,0xC8,0x9E,
+	0x2A,0xAC,0xB9,0x93,0xD6,0x19,0x52,0x77,0x41,0x9D,0xD5,
+	0xBB,0xB3,0xEF,0x74,0x93,0x31,0x96,0x0D,0x67,0x11,0x8C,
+	0x9E,0x44,0x90,0x6C,0x18,0x9E,0x44,0x90,0x48,0x27,0x11,
+	0x4C,0xA4,0x83,0x76,0xD9,0xE0,0x69,0xDB,0x3E,0xFA,0x1C,
+	0xFC,0xE1,0xD8,0xB9,0x2B,0x74,0xFA,0x91,0x56,0x78,0x5A,
+	0xB1,0xF7,0x43,0x67,0x3C,0x3E,0x3B,0xC2,0x67,0x30,0x91,
+	0x8D,0x6E,0xF3,0xE4,0x49,0x61,0x53,0xCD,0xFB,0x8F,0xD3,
+	0x0E,0x60,0xA0,0x2D,0x00,0x36,0x9E,0xA9,0x35,0x1F,0xF8,
+	0x35,0xDB,0xDC,0x06,0xFD,0x38,0xE8,0x5C,0xC2,0x45,0x0D,
+	0xBE,0x72,0x38,0x0A,0x6E,0xF9,0x46,0x5A,0x0D,0x6F,0x1D,
+	0xE4,0xB9,0x3E,0x4F,0xC9,0x0D,0x42,0x77,0xF9,0x5A,0x96,
+	0x91,0x4B,0x8A,0x97,0xF8,0xAD,0x37,0x84,0xE5,0x0A,0xE1,
+	0xCE,0xBD,0xA7,0xE8,0xA2,0x77,0xB3,0xFD,0x1F,0x08,0x39,
+	0x7D,0x40,0x16,0x43,0xCC,0xF3,0xD8,0x5A,0xD6,0xA9,0xAA,
+	0xC4,0x87,0xEA,0xA7,0xBC,0x39,0x43,0x7B,0x4E,0x39,0xD4,
+	0x87,0xC9,0xB4,0x90,0xF2,0x30,0xD9,0xCE,0xE7,0x84,0xDD,
+	0x25,0x43,0xC4,0xA1,0x3B,0x4C,0x92,0x43,0x9A,0xCE,0x1B,
+	0xE4,0x30,0x79,0xD6,0xCF,0xDD,0xE0,0x73,0xFA,0x53,0xDD,
+	0x2F,0x68,0x72,0x8B,0x3F,0x05,0x21,0xB9,0x4F,0x19,0xF9,
+	0x9C,0x5E,0xFE,0x58,0xE0,0x23,0x3E,0x67,0x00,0x6E,0xA6,
+	0xFA,0x96,0x83,0x26,0x7F,0x42,0xBC,0x39,0x1D,0xF3,0xB8,
+	0x8E,0xE2,0x49,0xC7,0x71,0xDF,0xE7,0xDE,0x4C,0xE6,0x7D,
+	0x0F,0x37,0xA0,0x48,0xE5,0xF5,0xA1,0x0F,0x47,0x66,0x82,
+	0x53,0x6D,0x3D,0x17,0x82,0xD3,0x2E,0x21,0xA7,0x43,0x99,
+	0xD3,0x35,0xF7,0x64,0xF1,0x6A,0xEC,0x18,0xAF,0xF4,0x94,
+	0x74,0x13,0xC7,0x03,0x3E,0x43,0xEA,0xA3,0xCB,0x55,0xCE,
+	0xBB,0x31,0xBB,0x9F,0x1B,0xA4,0xAC,0x84,0x62,0x7C,0xC3,
+	0x62,0x21,0xA7,0x3F,0xF0,0x49,0xE6,0x84,0x9C,0x0E,0xE6,
+	0x7D,0x84,0xFB,0x06,0x42,0xE1,0x1B,0x7C,0x86,0xC5,0x90,
+	0x0D,0xA0,0x05,0x3E,0x01,0xEA,0x26,0xE4,0x74,0x31,0xEF,
+	0x67,0xE2,0x6D,0x5E,0xB0,0x86,0xDD,0x67,0x8C,0xBC,0x35,
+	0x88,0x0F,0xEA,0x79,0x6B,0x0F,0xB0,0x04,0xA8,0xF0,0x3D,
+	0xA9,0x35,0x7D,0x6A,0x12,0x99,0x33,0x73,0x5B,0x8A,0x27,
+	0x0B,0x98,0x3A,0x28,0xE4,0x04,0x33,0x99,0x66,0x0F,0xD7,
+	0xA3,0xE0,0x0D,0xA1,0x0F,0x44,0xE0,0x65,0x7D,0x42,0x67,
+	0xD5,0x10,0x08,0xCA,0x3A,0x18,0xB8,0x8A,0xEC,0x64,0xF9,
+	0xCB,0x99,0xCC,0x05,0xE8,0x21,0x37,0xA8,0x8C,0xDB,0x43,
+	0x9F,0x4A,0x1B,0x04,0x47,0x9E,0x49,0xD0,0xB1,0xC8,0x82,
+	0x4B,0x23,0x0F,0x47,0xEE,0xC5,0xB8,0xC3,0xFF,0x01,0x53,
+	0x87,0x13,0xCB,0x16,0xF0,0x5C,0xBF,0xBF,0xC5,0xEC,0x4B,
+	0x2A,0x67,0xF9,0x5E,0x53,0xF8,0x5A,0x1B,0x9D,0xC7,0x13,
+	0x68,0x15,0x7E,0x00,0xCD,0x59,0x58,0xA1,0x60,0xB8,0x5E,
+	0x90,0xD0,0x02,0xCF,0x75,0xC6,0xF9,0xA8,0xC0,0xC5,0x9F,
+	0xB0,0xF6,0x26,0xBC,0xC7,0x67,0x0F,0xA5,0xD5,0xE0,0x10,
+	0x09,0xD7,0x24,0xC1,0x12,0xEF,0x3E,0x7D,0x16,0xF0,0x66,
+	0xF2,0x6B,0x86,0xE6,0x71,0x3A,0x7B,0x3F,0x2E,0xFF,0xC8,
+	0xC5,0x07,0xAE,0xFA,0xAD,0x7D,0x4A,0xC8,0x7C,0x98,0xD7,
+	0x76,0x7A,0x49,0x5A,0x13,0xCD,0xBE,0x51,0x70,0xF5,0xE2,
+	0x78,0xB6,0x1C,0xD0,0x87,0x01,0xA0,0x5D,0x66,0x6A,0x98,
+	0x38,0x4C,0xF8,0xC4,0x81,0x0D,0xEE,0xDB,0xBC,0xCF,0x6F,
+	0xED,0x87,0xA0,0x32,0x4B,0x45,0x77,0x26,0x74,0x6F,0x9E,
+	0x7B,0xCC,0x39,0x19,0x72,0xE2,0x6D,0xBF,0x75,0x60,0x02,
+	0x97,0x40,0xC7,0x28,0x84,0xF4,0xB1,0x69,0xF1,0xBC,0x6A,
+	0xF1,0x22,0x4F,0xBD,0x62,0x9E,0x45,0x67,0xFF,0xEF,0x38,
+	0xE6,0xA1,0x19,0x90,0x07,0xAE,0x26,0x18,0x81,0x00,0x48,
+	0x2B,0x8E,0x03,0xFA,0x16,0x01,0xD1,0xA1,0xBE,0xE8,0x20,
+	0x85,0xE1,0xB7,0xA5,0xE6,0xDC,0x3C,0xAF,0x35,0xEC,0xB7,
+	0xEA,0xD2,0x6A,0x04,0xAB,0x06,0x97,0x4F,0xC4,0xC7,0xC1,
+	0xFD,0x02,0xA8,0xC0,0x00,0x93,0x41,0x7E,0xEC,0x50,0x67,
+	0x90,0x15,0x4E,0xA5,0xC8,0xF5,0x9F,0xB0,0x6A,0xE8,0xA2,
+	0xAD,0x25,0x35,0x74,0xA8,0x40,0x2D,0x71,0xE0,0x2A,0x26,
+	0x3C,0xD7,0x81,0x03,0xC6,0x32,0xC9,0x91,0x29,0xC4,0xDF,
+	0x52,0xAD,0x20,0x3E,0x6D,0x5A,0x38,0x45,0xE7,0xB7,0xD6,
+	0x80,0xA1,0xB4,0xD6,0xF2,0x5C,0x3D,0x4E,0x88,0x73,0x5D,
+	0xE2,0xB9,0xE3,0x42,0x76,0xBC,0x60,0x3D,0xCE,0x73,0xEF,
+	0xF9,0x5B,0x78,0x6B,0xAB,0x50,0xD2,0x2A,0xC0,0x77,0x96,
+	0x42,0x98,0x26,0x2F,0xFC,0x98,0x8F,0x13,0xF9,0x56,0x2A,
+	0x52,0x05,0x2D,0xB0,0x5C,0x8F,0x2D,0x0F,0xF7,0xBB,0x0A,
+	0xDD,0xD1,0x99,0xA7,0xE2,0x1B,0xFC,0xC7,0x0E,0x8B,0xE2,
+	0xAC,0x9A,0xBE,0x3F,0x5E,0x0B,0x2C,0xE3,0x4F,0x7A,0xBE,
+	0xCC,0x71,0x29,0xAB,0x72,0x08,0x6E,0x45,0xCD,0xF5,0xE1,
+	0xCA,0xD8,0x7D,0xF3,0x2C,0x1D,0xAE,0x5B,0x05,0x6B,0x07,
+	0x04,0xC6,0x50,0x5F,0x53,0x3B,0xD3,0x92,0x71,0x3B,0xD9,
+	0xA1,0xE4,0x2D,0x1D,0x1E,0xAE,0x55,0x25,0x72,0x97,0x16,
+	0x85,0x4A,0x05,0x0E,0xE8,0x40,0x11,0x5C,0xB3,0x75,0x04,
+	0x5A,0xD9,0xE0,0xEC,0xA7,0xF7,0xE1,0x64,0x49,0xDC,0xE8,
+	0xC6,0x72,0x19,0x0A,0x52,0x3D,0xC0,0x87,0x6B,0xA7,0xBD,
+	0xB6,0x33,0xD7,0x0A,0x4F,0x0B,0x25,0xB5,0x60,0x92,0x86,
+	0x9F,0x1A,0xF9,0xB9,0x1A,0xA6,0x36,0xD5,0x97,0xA5,0xC1,
+	0x40,0x95,0xA9,0x2D,0xB5,0x76,0xF1,0x96,0x73,0x38,0xC9,
+	0x00,0xB7,0x35,0xEC,0xFC,0xBD,0x12,0x1F,0xC2,0x03,0x7F,
+	0x3A,0x88,0x6B,0xB5,0x9F,0xBB,0xEC,0xB7,0x76,0x51,0x4C,
+	0x6D,0xD0,0x29,0xDF,0x8F,0x60,0xF1,0x94,0xEB,0x41,0xD5,
+	0xE9,0x23,0xAE,0x7B,0x05,0xEB,0x45,0xA1,0xA4,0x87,0x3F,
+	0x1D,0xF8,0x24,0xD0,0xA6,0x2C,0x39,0xC7,0x34,0x8B,0x5C,
+	0x4F,0x26,0x50,0xBE,0x50,0xB8,0xD5,0xD3,0x00,0xED,0x12,
+	0xF5,0xA9,0xCF,0xDE,0x25,0x72,0x6D,0x02,0xD7,0x06,0x0D,
+	0xD7,0xFE,0x16,0x0E,0xFB,0x15,0xE6,0x73,0xF1,0x69,0xA7,
+	0x96,0xEE,0xFE,0x73,0x35,0x70,0xBE,0x65,0x6F,0x8D,0xEB,
+	0x5E,0x40,0x23,0x83,0xFF,0x08,0xDB,0x91,0xD2,0x7A,0x8E,
+	0x5F,0xC0,0xD7,0x29,0x51,0x03,0xE0,0x7C,0x21,0xBF,0x6B,
+	0x68,0x5E,0x4E,0x8B,0xFD,0x52,0x84,0x84,0x16,0x9E,0x6B,
+	0x12,0xAC,0xE7,0x04,0x4B,0x93,0xF9,0x00,0x17,0x0F,0x85,
+	0x13,0x4E,0x06,0xC0,0x6C,0xB1,0xA0,0x36,0x96,0xD3,0x4C,
+	0x33,0xEE,0xD1,0x73,0xEA,0x2C,0xAF,0x85,0x2C,0xC0,0x7B,
+	0x20,0xE7,0xFE,0x5A,0xA5,0xF5,0xF4,0xDC,0x5A,0xD7,0x04,
+	0xAA,0xE4,0x2B,0x87,0xC0,0xF2,0xFE,0x55,0xB0,0xD2,0xC2,
+	0x80,0x03,0xCA,0x83,0xA2,0xBD,0x03,0x88,0xD2,0x44,0xD0,
+	0x30,0x9C,0xC7,0xE0,0x5A,0x00,0xB5,0x7E,0x08,0x87,0xDA,
+	0x9F,0x9C,0x7B,0xCD,0xA9,0x31,0x1F,0x58,0x12,0x1F,0x52,
+	0x99,0x0F,0x2C,0x8D,0xCF,0xC5,0x8B,0x45,0xF4,0x82,0x43,
+	0x45,0x10,0x72,0xDE,0xCB,0x15,0x2C,0x5D,0xA2,0xEB,0xA4,
+	0xC0,0x9D,0x5B,0x93,0xCD,0x06,0xF3,0x6E,0xCC,0x2B,0xE9,
+	0xB5,0x9F,0x8E,0x14,0x0F,0x0A,0x5C,0x2F,0xF4,0x9E,0x1A,
+	0xDD,0x38,0x5A,0x44,0xD9,0xD9,0xC9,0x44,0x94,0xCC,0x37,
+	0xC5,0xDD,0x06,0xA1,0x86,0x59,0x4C,0x3E,0xC9,0xF2,0xCD,
+	0x9E,0x92,0x7A,0xE2,0xA0,0x13,0x29,0x41,0x47,0x3D,0x25,
+	0xFD,0x8A,0xE2,0xF3,0xD0,0x72,0x56,0x6F,0xE2,0xAD,0xF5,
+	0x7B,0x6B,0x1C,0xB5,0x70,0xCE,0xAF,0xE6,0xB9,0x6E,0x5C,
+	0x90,0x04,0xCE,0x5F,0x5C,0x5D,0x0F,0xF6,0xCA,0xCB,0x7D,
+	0x8A,0x53,0xE2,0xEF,0x20,0x8E,0x37,0x32,0xF4,0xC4,0xB1,
+	0x39,0x83,0x2C,0x75,0x16,0x98,0x45,0xF3,0x52,0xA4,0x0B,
+	0x7E,0x81,0xBE,0x9C,0xF7,0x44,0x17,0x50,0x70,0xCE,0x02,
+	0x24,0xB2,0xC1,0x7F,0xBF,0xBE,0x37,0xEC,0x54,0x0B,0xAE,
+	0xC6,0x10,0x93,0xC3,0x7F,0x11,0xB8,0x8A,0xED,0xFB,0x3D,
+	0x25,0xD4,0x41,0x2B,0xAC,0x51,0x80,0x1F,0xF9,0x12,0xC0,
+	0xFF,0x05,0x0A,0x2E,0x91,0x01,0x2C,0x1A,0x0D,0xC0,0x75,
+	0xBD,0xD3,0x2C,0x76,0xB2,0xD0,0xA2,0x72,0x9D,0xEB,0xBF,
+	0x0E,0xD3,0x8A,0xEB,0xDC,0x3C,0x57,0xAF,0x5D,0x91,0x16,
+	0x1E,0x07,0xCF,0x06,0xC4,0x73,0xE5,0xEB,0xF0,0xB0,0xD7,
+	0x3B,0xCF,0x0D,0x0D,0x37,0xDB,0x44,0x68,0xB3,0x38,0xB8,
+	0x56,0x8B,0xC3,0x90,0xCE,0x77,0x96,0x13,0xDC,0xB7,0x0B,
+	0x34,0x75,0x28,0x63,0x17,0x29,0x1E,0x10,0x4A,0x7A,0x25,
+	0x28,0x4B,0x11,0x8A,0x44,0x0C,0x77,0x0E,0xA1,0x59,0xBA,
+	0x2C,0x1C,0x1B,0xAC,0x1D,0x9C,0x3B,0x34,0x9A,0x90,0x13,
+	0x5A,0xBE,0xCE,0x97,0x2D,0x59,0xA7,0xB6,0x0D,0xE8,0xFA,
+	0xBB,0x71,0xE7,0x80,0x0D,0x73,0x6B,0x1D,0xFA,0x95,0x4E,
+	0x55,0x5A,0x38,0xA4,0x41,0xFA,0x43,0x0D,0x5F,0x47,0xE4,
+	0xD6,0xC1,0xBD,0xE2,0x2E,0x65,0xE7,0xF4,0xA1,0x91,0x55,
+	0x04,0x12,0xC1,0x24,0x83,0xFD,0xA1,0xDB,0x65,0xD1,0x76,
+	0x94,0xE3,0xE7,0xBA,0xFC,0xD6,0xCB,0xB4,0x1D,0xB5,0xE3,
+	0x50,0x0C,0x49,0x89,0xDB,0x71,0x92,0x3A,0x6D,0x46,0x77,
+	0xF3,0xCD,0xFC,0x10,0x00,0xE9,0x00,0x15,0x54,0xBA,0x2E,
+	0x62,0x03,0x5A,0x24,0x24,0x80,0x31,0xCC,0x4E,0x05,0x65,
+	0xC5,0x16,0xD4,0x2D,0xE2,0x10,0xB0,0x76,0x6C,0x41,0x55,
+	0x02,0x77,0x51,0xB0,0x5C,0x66,0x83,0xE1,0x75,0xFB,0x04,
+	0x40,0x66,0xB9,0x10,0x19,0xEC,0x71,0x5A,0x15,0xBB,0x26,
+	0x0E,0xB4,0xF9,0xA3,0x2C,0xFA,0xF0,0xB4,0x30,0xA8,0xB5,
+	0xAB,0x9F,0x77,0x85,0x79,0x57,0x1F,0xB0,0x7E,0x02,0x8E,
+	0xE0,0xC7,0x99,0x0F,0x9D,0x36,0xC5,0xB0,0x36,0x6A,0xDF,
+	0xD0,0x39,0x9E,0x36,0xF3,0xE6,0x5A,0x96,0x0D,0xFE,0xE5,
+	0x1A,0xD5,0x4A,0x36,0x78,0x3E,0x1F,0x77,0x5A,0xDF,0x0A,
+	0xBC,0x99,0x90,0x07,0x05,0xD7,0xB3,0x41,0x65,0xDE,0x3E,
+	0xFE,0x58,0x5A,0x53,0xC6,0x7F,0x21,0xCE,0xC7,0xCD,0x22,
+	0xB8,0x78,0xB3,0x67,0x7E,0x2D,0x4B,0x5E,0x7C,0x10,0x07,
+	0xDF,0xC0,0xD5,0x09,0x08,0x17,0x98,0x7A,0x61,0x35,0xC6,
+	0x04,0x4D,0xD4,0x1E,0xEA,0xCD,0xA2,0xA6,0x96,0x55,0x27,
+	0x90,0x50,0x5B,0x67,0x2F,0x43,0xCB,0x54,0x27,0x10,0xF3,
+	0x81,0x5A,0xF6,0x5A,0x17,0x8D,0x2E,0xC0,0x1A,0xD4,0x40,
+	0x19,0x36,0x68,0xBB,0xD6,0x79,0x94,0x64,0xBC,0x46,0x9C,
+	0x4B,0x68,0x91,0x68,0xAE,0x13,0xC9,0x00,0x94,0x3A,0xBA,
+	0x29,0x38,0x4E,0x05,0x00,0x6B,0x24,0x74,0x37,0x01,0xF4,
+	0x83,0x6B,0x9D,0x4E,0x7A,0x83,0xA6,0xD0,0x7B,0xFE,0x2B,
+	0x68,0x32,0x9F,0x54,0x08,0x2A,0x9C,0xD9,0x0F,0x95,0x4A,
+	0xF6,0x5F,0xF1,0x2D,0x51,0x9B,0xDA,0xE7,0x1E,0x73,0xDC,
+	0x02,0x8E,0xD8,0x7F,0x65,0x51,0xE4,0x2E,0xAE,0xD3,0xDB,
+	0xE6,0xBF,0x12,0xB9,0x9C,0x08,0x97,0x7A,0x73,0x03,0x10,
+	0x24,0x8A,0xC8,0xC9,0x90,0xDA,0xCC,0x27,0xD5,0xB2,0xB8,
+	0xA8,0xC8,0x3C,0x48,0x74,0xA8,0xD8,0xE0,0x1F,0xC2,0x7B,
+	0x45,0xE7,0xAD,0xD0,0xB6,0x26,0x8E,0x60,0x27,0x74,0x48,
+	0x87,0x62,0x13,0x9C,0x89,0x6C,0xF0,0x1F,0xD6,0x23,0x47,
+	0xB5,0xC0,0xD1,0xC3,0xB9,0xA1,0x5E,0x79,0xC7,0xD4,0xA7,
+	0xCA,0x2C,0x7D,0x66,0x5F,0xF2,0x71,0x36,0x89,0xEF,0xCD,
+	0x1B,0xAA,0xE3,0x07,0x4D,0x22,0x1B,0xBC,0xFB,0xCB,0xE1,
+	0x75,0x88,0x32,0x80,0x84,0xB9,0xA0,0x3D,0xD0,0x22,0x9C,
+	0xB9,0xB1,0x5C,0xFF,0xE1,0x4D,0xB9,0x9E,0x10,0xE5,0x7A,
+	0x68,0xC3,0xCD,0x99,0xDE,0x39,0x71,0x08,0x5B,0x58,0xE6,
+	0xFF,0x11,0xC3,0x3B,0xDF,0xFB,0x0A,0xEA,0x08,0x35,0x95,
+	0xAB,0xF9,0x57,0x99,0x5B,0x6C,0xF0,0x97,0x7F,0x1D,0x6F,
+	0x3C,0x20,0x6A,0xE7,0x7D,0x7C,0x3D,0xAE,0xE6,0x63,0x6D,
+	0xE1,0x73,0x2E,0x4A,0xA3,0x23,0x79,0x4B,0x3F,0x38,0xCB,
+	0x62,0x9C,0x47,0x77,0x02,0x92,0xB9,0x20,0x7F,0x25,0xAD,
+	0xC6,0x9D,0x41,0x1C,0x46,0xF7,0x82,0x78,0xA7,0x56,0xE4,
+	0x82,0x69,0x35,0x21,0xD6,0xBD,0xC0,0x68,0x8F,0xCB,0x9C,
+	0xC7,0xF5,0xA3,0xB7,0xEC,0x5F,0x8C,0xEF,0x35,0x5A,0x3D,
+	0x5C,0xBF,0x0A,0x4C,0x66,0xAE,0x4B,0xDD,0xC0,0xF5,0xE7,
+	0x12,0x0F,0x17,0x54,0x78,0x4A,0x82,0xB7,0xE3,0x65,0xF0,
+	0x76,0xFA,0x32,0x0A,0x47,0x51,0xFC,0xD0,0x1A,0xA4,0x8E,
+	0x31,0x10,0x32,0x85,0xF9,0x16,0x3E,0x70,0xAD,0xED,0x87,
+	0x39,0xFD,0x3C,0x8D,0x78,0x21,0xFA,0xED,0x64,0x6A,0xF9,
+	0x93,0x50,0x9F,0xDF,0x80,0x97,0x84,0xA8,0x84,0xC1,0x9E,
+	0x0D,0xBF,0x44,0x87,0x83,0xFC,0x97,0xE0,0xFC,0x64,0x7E,
+	0xF2,0x35,0x5B,0x90,0x7F,0x41,0xC1,0x2F,0x4F,0x08,0xB4,
+	0xF2,0x4F,0x42,0xDB,0x38,0xBA,0x06,0xA2,0x9C,0x41,0x7E,
+	0x89,0x8A,0x5F,0xAD,0xC1,0x95,0x9E,0x56,0xAB,0xE4,0x75,
+	0xF5,0xFF,0x0E,0x57,0x02,0x81,0x86,0x1F,0x24,0xAE,0xF5,
+	0x14,0xA3,0xC0,0x75,0x61,0x4C,0xC6,0x73,0x61,0x38,0xBB,
+	0x66,0xEB,0x87,0xB0,0x09,0x43,0xA9,0x7E,0xE2,0x7A,0x84,
+	0xAF,0x83,0xCE,0x05,0x34,0x7C,0xC4,0x29,0x72,0x61,0x91,
+	0x1B,0x58,0x74,0x3C,0x9D,0x69,0x10,0x96,0xAB,0x20,0x26,
+	0x60,0x3E,0xF0,0x3F,0xA9,0xE1,0x73,0xCE,0xA7,0x0A,0x7A,
+	0xA1,0xE4,0x3C,0xD8,0x04,0x5E,0x3F,0xCF,0xD2,0x6F,0x3F,
+	0x2F,0xE2,0xF0,0xCF,0xAE,0x79,0x5C,0xD0,0xBE,0xDF,0x7C,
+	0xE0,0xB1,0xF8,0x04,0xE3,0x11,0x0C,0x60,0xDA,0x71,0x3C,
+	0xB3,0xC0,0x3E,0x16,0x7F,0x7F,0x8B,0xFB,0x54,0x35,0xCF,
+	0xB5,0xCD,0x6D,0x71,0x65,0x4B,0x21,0x61,0x0B,0xA2,0x47,
+	0x62,0x6B,0x85,0xF4,0x40,0x9B,0xFF,0x49,0x05,0xF3,0x3E,
+	0x8F,0xB1,0xD7,0x89,0x74,0xE6,0x7D,0xC1,0xD2,0xAE,0x84,
+	0xEA,0x3D,0xAE,0xC0,0x28,0xB4,0x15,0x52,0x1A,0xF8,0xC7,
+	0x6F,0x48,0xF7,0x1A,0x16,0xF3,0x2B,0x86,0xE6,0x59,0xDB,
+	0xEC,0x87,0xE5,0x6A,0xB4,0x49,0xD5,0xB8,0x40,0xB1,0x9E,
+	0xA5,0x58,0x3B,0x80,0x37,0xF7,0x83,0xB4,0x5A,0x05,0xEE,
+	0x42,0xA0,0x15,0x02,0x27,0x8C,0x65,0xAC,0xAD,0xC5,0x77,
+	0x41,0xD0,0x2D,0x63,0x58,0x4C,0x71,0x79,0x6A,0x15,0x08,
+	0x12,0xBB,0x97,0x7A,0xC8,0x60,0x6F,0x43,0x20,0x90,0x9E,
+	0x70,0xEA,0xC4,0x9D,0x60,0xA9,0x1E,0x8B,0x47,0x6F,0xDD,
+	0x8F,0xE1,0xE4,0xE9,0x23,0x81,0xAB,0x27,0x54,0x4C,0x1D,
+	0x66,0x80,0xF8,0x01,0xEC,0x1B,0x66,0x03,0xFF,0x7E,0xE2,
+	0x4E,0xA6,0x39,0x92,0x95,0xBB,0x40,0xB3,0xBE,0x03,0xB4,
+	0x0B,0x77,0x02,0xFB,0xA0,0x4E,0x75,0xE0,0x1E,0x20,0xBB,
+	0x55,0x8E,0x83,0xB9,0x6E,0x3F,0x77,0xD1,0x04,0x31,0xE1,
+	0x45,0x40,0x0D,0x71,0x39,0x6F,0xB9,0x80,0x91,0xEA,0x53,
+	0x14,0x82,0xFB,0xB4,0x11,0x82,0x68,0xC1,0x12,0x14,0x4A,
+	0xFA,0x3D,0x5D,0x0A,0xCF,0x67,0x2A,0xDE,0x72,0x09,0xC2,
+	0xF4,0x54,0xD4,0xB5,0x74,0xE0,0x93,0xF5,0x02,0x28,0xC5,
+	0x55,0xE8,0xCC,0x30,0x17,0xE7,0x0E,0x14,0x1B,0x00,0x59,
+	0x26,0xA2,0x47,0x50,0x86,0xD0,0xA7,0x22,0xD7,0x2D,0x58,
+	0xBA,0xE7,0x59,0x2E,0x15,0xAF,0x94,0x82,0xAD,0x70,0x5A,
+	0x0D,0x63,0xB9,0x10,0x7A,0x38,0xB4,0x20,0x15,0x35,0xF4,
+	0x01,0x28,0x33,0x3D,0xD5,0x37,0x05,0x3A,0x52,0x8F,0xC5,
+	0x9B,0xC2,0x71,0xCD,0xBC,0xF5,0x3C,0x80,0x44,0xC5,0xAA,
+	0x13,0x12,0xC0,0x57,0x00,0xB9,0x67,0x04,0xCB,0x79,0x7E,
+	0x4A,0x26,0xC4,0x4B,0x12,0x5E,0x1C,0x57,0xF1,0x82,0x28,
+	0x58,0x80,0x1E,0x20,0xA6,0x17,0x68,0x03,0x75,0x7C,0x2C,
+	0x1E,0xA9,0xFB,0x33,0x10,0x7B,0x99,0x22,0xBC,0x5C,0x6C,
+	0x1A,0x26,0x8E,0xB9,0x38,0x8F,0xEB,0x1D,0x49,0xDA,0x82,
+	0x50,0x37,0xA5,0x07,0xE8,0x8B,0x90,0x74,0x12,0x7B,0x1E,
+	0x31,0xBA,0x4C,0xC7,0x09,0x44,0x26,0xB5,0x8E,0x5C,0x41,
+	0x8D,0xDA,0x1A,0x69,0x6A,0xD7,0x1F,0x09,0xF4,0x1E,0xF1,
+	0x61,0x88,0x6A,0x38,0xE9,0xE7,0xD2,0xAC,0x63,0xCF,0xAE,
+	0x78,0xE2,0xDA,0xEA,0xB7,0x82,0x2E,0xF7,0x5E,0xDB,0xAC,
+	0x93,0x79,0xDD,0x0F,0x57,0x92,0x72,0xF4,0x81,0x4B,0xDB,
+	0x05,0xBD,0x84,0x39,0xC0,0x3B,0xA8,0x4C,0xE0,0x23,0x50,
+	0x38,0x2B,0x28,0x76,0x3F,0x74,0x78,0x32,0x4F,0xEC,0x50,
+	0xF9,0xA1,0x67,0x72,0x21,0x55,0x58,0x00,0xE4,0xA6,0xFA,
+	0xB3,0x15,0xCC,0x9F,0x85,0xD9,0xA9,0xFC,0x23,0x90,0xC5,
+	0x73,0x4C,0x31,0x2F,0x5B,0x67,0x6F,0x12,0xB9,0x5E,0x09,
+	0xFA,0xBC,0xEC,0x78,0xFB,0x3F,0xE3,0x69,0xB6,0x0A,0x48,
+	0x01,0x8B,0xA9,0x59,0x0D,0x57,0xD1,0xD5,0xC7,0xF1,0x22,
+	0xB2,0x30,0xF9,0xB8,0x33,0xF4,0x26,0xF1,0x75,0x65,0xB8,
+	0x55,0x65,0x58,0x47,0x4A,0x1B,0x79,0xDA,0x89,0x2E,0x6D,
+	0xAA,0x9A,0x44,0x8E,0x3E,0x68,0xC0,0xC5,0xB7,0x22,0xD3,
+	0xDC,0x72,0xCB,0xB8,0x8E,0xA3,0xF8,0x5A,0x77,0xC3,0x75,
+	0x5A,0xD1,0x66,0x02,0x02,0xF1,0x84,0x58,0x1F,0x50,0x1F,
+	0x52,0x58,0x7A,0x21,0x40,0x74,0x77,0x29,0xBC,0x2D,0xF8,
+	0x08,0x07,0xFA,0xD9,0x07,0xD9,0xED,0x6C,0x50,0x6C,0xAD,
+	0xFA,0x71,0x1C,0x8E,0x18,0xF0,0xB5,0x55,0xE5,0xC0,0x09,
+	0x4D,0x7F,0x96,0x0D,0xFE,0x7D,0x5B,0x55,0x6E,0xE4,0x12,
+	0xB2,0x6D,0x6B,0x03,0x20,0x10,0x91,0x03,0x14,0xD2,0x02,
+	0x40,0xB0,0xE7,0x0F,0x11,0x49,0xA4,0xF0,0x8A,0xB6,0xAA,
+	0xC7,0x63,0x0A,0xCF,0x6F,0xAB,0x5A,0x13,0x53,0x78,0x66,
+	0x9B,0xEC,0x85,0x73,0xD6,0xA1,0xCF,0xC0,0x9D,0xCD,0xF7,
+	0x3E,0xC6,0xD7,0xE2,0xFC,0x19,0x40,0xF4,0xD8,0x3E,0x6F,
+	0xBD,0xA9,0xC9,0x33,0xF8,0x53,0x87,0xDA,0x33,0xF8,0x9C,
+	0x53,0x0D,0x35,0x08,0x4D,0xF4,0x0C,0xE6,0x38,0xE2,0x3D,
+	0x83,0x85,0x98,0x76,0x87,0xB3,0x26,0x2D,0x0C,0x55,0x43,
+	0x44,0x49,0x43,0x7C,0xEF,0xE8,0x31,0xD9,0x91,0x5D,0x92,
+	0x71,0x94,0x23,0xF4,0x19,0x70,0x8C,0x23,0x4E,0x8C,0x7C,
+	0x13,0x1F,0x3C,0xBD,0x81,0x43,0x3D,0x53,0x70,0xE4,0x7A,
+	0x15,0xC1,0xB9,0x3F,0x4D,0x79,0xE6,0xF2,0x37,0x70,0xE8,
+	0xD6,0x9B,0x38,0x58,0x74,0x02,0xDC,0xD4,0xE2,0xA2,0x3A,
+	0x9D,0xF7,0x33,0xBB,0x45,0x91,0xB8,0x94,0xEF,0x8A,0x44,
+	0xAA,0x28,0xB8,0x85,0x37,0xD8,0xB4,0x0F,0xA1,0x9F,0xF1,
+	0x26,0x4B,0x28,0xC7,0xEA,0x71,0xCE,0x5A,0xE3,0x15,0x36,
+	0xB8,0xE7,0x23,0x36,0x78,0xF0,0x02,0x1B,0x3C,0xB6,0x0C,
+	0x22,0x08,0x5A,0x89,0xF9,0xC1,0x3F,0x2D,0xF3,0x9E,0x30,
+	0x9D,0xF2,0x7C,0xA9,0x73,0x3E,0xB8,0xF7,0x43,0xD7,0x55,
+	0x00,0xF0,0x63,0x5F,0x4E,0x3F,0x14,0xFC,0xD4,0xCB,0xF5,
+	0x79,0x0B,0xBF,0xE0,0x31,0x8C,0x66,0x83,0xFF,0x78,0xA5,
+	0xCA,0x08,0x50,0x4A,0x5B,0xE9,0x75,0xE8,0x7F,0x78,0xBE,
+	0xBC,0xC3,0xF9,0xA3,0x11,0x08,0xD3,0x4E,0x8D,0x46,0xF9,
+	0x14,0xA0,0x9C,0x08,0x28,0x67,0x5E,0x48,0x6B,0xE2,0x4F,
+	0x46,0x2B,0xEF,0xF9,0x52,0xEF,0x58,0xE6,0xF9,0xD2,0xF8,
+	0x22,0x74,0xCF,0x5E,0x50,0x76,0x16,0x8A,0x73,0xAF,0x17,
+	0x7F,0xE9,0xA3,0x0B,0x8C,0x01,0xB8,0x7A,0xEE,0x0B,0x42,
+	0x5A,0xA0,0xFB,0x80,0xFD,0xD8,0xA9,0x57,0xBC,0x27,0xF9,
+	0xCB,0xF4,0x1D,0xFA,0xC4,0x56,0xC4,0x75,0x02,0x18,0xC3,
+	0x5C,0x90,0xEF,0x7B,0x13,0x3A,0xA7,0x8B,0x40,0x84,0xF9,
+	0x84,0x06,0x52,0xEB,0xE0,0x3E,0xC5,0xAD,0x05,0xDC,0x1F,
+	0x41,0x70,0xF6,0x2B,0xE8,0x98,0xFD,0xDB,0xFF,0x02,0x83,
+	0xFC,0x06,0x32,0xF4,0x4D,0x36,0x96,0x86,0x98,0xF9,0x2F,
+	0x79,0xD5,0xEB,0x71,0x20,0x50,0xF5,0x26,0xFC,0x7E,0x43,
+	0xE9,0xEC,0x35,0x1F,0xCC,0x30,0x44,0xDF,0x17,0x4A,0xE9,
+	0x19,0x22,0xA1,0x33,0x4C,0xD1,0x37,0xAE,0x1B,0xB1,0x0E,
+	0x59,0x52,0x3D,0xD7,0xFB,0x87,0x23,0xA2,0x08,0xF9,0xCC,
+	0xEE,0xD4,0x74,0xC3,0x50,0xDA,0x29,0x69,0x3C,0xA3,0xC2,
+	0xA1,0xFC,0xB1,0xB3,0xDF,0xEC,0x4D,0xCD,0x30,0x84,0x8F,
+	0x2B,0x9C,0x5A,0x1F,0xD7,0x0B,0x79,0x7A,0xD8,0x20,0x2F,
+	0xD6,0x73,0xED,0xD9,0xF5,0x5C,0xFF,0x7A,0xA9,0xD8,0xB8,
+	0xD9,0xE5,0xB1,0x90,0xDE,0xE3,0x7B,0x20,0x56,0x01,0xE6,
+	0x60,0xD1,0x3D,0xED,0x8E,0x54,0x1F,0xD7,0x2E,0x95,0xF2,
+	0x72,0xC1,0xF1,0xF1,0x40,0x41,0x75,0xA7,0x21,0xA6,0x6C,
+	0x10,0x2A,0x88,0x65,0xBB,0xEA,0xB9,0xF0,0x1B,0x5F,0x83,
+	0x12,0xB2,0x86,0x11,0x4D,0x3D,0xD7,0xD1,0x1C,0xA9,0x10,
+	0x9B,0x6E,0x60,0xBE,0x0D,0x7D,0x1D,0x32,0x7D,0x2F,0xD5,
+	0x73,0x3D,0x6F,0x7E,0xFB,0x6A,0xF5,0x48,0xA4,0x41,0x93,
+	0xB7,0x32,0xB1,0xA5,0x18,0xE7,0x70,0x29,0x6F,0x6B,0x0A,
+	0xE3,0x7C,0xF4,0xEB,0x6E,0xFE,0xE0,0x6B,0x6E,0x3A,0xFE,
+	0x55,0x92,0xAE,0xA9,0x3D,0xE3,0x4D,0xE2,0xFC,0x17,0x73,
+	0x58,0x03,0x15,0x72,0xFC,0x23,0xFC,0x66,0x18,0x8C,0x0E,
+	0xBE,0x9E,0x1B,0x68,0xFE,0xF6,0xD4,0x0E,0xC8,0x95,0x4C,
+	0xA9,0xE7,0xBA,0x1E,0xFF,0x3A,0x46,0x52,0x11,0x94,0x92,
+	0x68,0xC9,0xAE,0x88,0x08,0xFE,0x63,0x2A,0x79,0xF7,0x70,
+	0x25,0x1F,0x27,0xCE,0x5B,0xE5,0x4A,0xEA,0xE5,0x4A,0xAA,
+	0x71,0x85,0x2D,0x1C,0x34,0x7E,0x7F,0x3D,0xD7,0xF7,0x75,
+	0xF2,0x37,0xF8,0xB8,0x3E,0xAC,0x61,0x48,0x23,0x29,0x32,
+	0x74,0x70,0xFF,0xF8,0xF5,0xEA,0xD2,0x8D,0xD9,0xB1,0x59,
+	0x0D,0x8E,0x5E,0x9D,0x2F,0xD1,0x7B,0x02,0x98,0xF4,0x49,
+	0xE5,0xF9,0x6F,0xC9,0x5D,0x0D,0x6A,0xF4,0x49,0x64,0xD1,
+	0x3D,0xBE,0x9C,0xAE,0x6F,0xE4,0x6D,0xA3,0x6E,0xB8,0xDC,
+	0x7A,0xB9,0x5C,0xE8,0x3F,0x86,0xB5,0xBF,0x1C,0x66,0xED,
+	0x20,0x71,0xBE,0x0C,0x8D,0x36,0xF8,0xB7,0xD5,0xA9,0xFF,
+	0x1B,0xEB,0x74,0x43,0xFB,0xFD,0xD4,0xC9,0x1B,0xAC,0xC4,
+	0x17,0x14,0xE7,0x9B,0x07,0xA0,0x8C,0xF7,0x18,0x94,0x72,
+	0x7F,0xA4,0xFC,0x36,0xCD,0x21,0x2C,0x37,0x07,0xE3,0x37,
+	0x56,0xED,0x2E,0xED,0xF7,0x25,0xAE,0x81,0xBF,0x51,0x5C,
+	0x03,0xDF,0x58,0xA7,0x15,0x9A,0xEF,0x4D,0x5C,0x2A,0x68,
+	0xC8,0xDF,0x5D,0x5C,0x7D,0xDF,0x5A,0x5C,0x76,0xF5,0xF7,
+	0x25,0xAE,0xEE,0xBF,0x51,0x5C,0xDD,0xDF,0x58,0xA7,0xD7,
+	0x55,0xDF,0x97,0xB8,0x02,0x03,0xE0,0x13,0xCF,0x07,0xBE,
+	0xAB,0xB8,0x7A,0xBE,0xB5,0xB8,0xEA,0x94,0xDF,0x97,0xB8,
+	0x7A,0xFF,0x46,0x71,0xF5,0x7E,0x63,0x9D,0x3E,0x53,0x7C,
+	0x4F,0xE2,0xEA,0x84,0xBC,0x20,0x21,0xC8,0xFE,0xA7,0xF3,
+	0xDF,0xAE,0x52,0xC1,0x6F,0x27,0xA5,0x1F,0x7C,0x4F,0x35,
+	0xFA,0xD3,0x17,0x52,0xDE,0xCA,0xF3,0xDF,0x41,0x46,0x77,
+	0xCB,0x31,0x66,0xE7,0xD7,0x54,0x68,0x39,0xF3,0x3D,0x55,
+	0x68,0xF2,0x7F,0x50,0x85,0xFE,0x9E,0xFC,0xBF,0xAA,0xD0,
+	0xA4,0xD8,0x0A,0x45,0x57,0xA1,0xF8,0x7F,0x1D,0x45,0x5D,
+	0xFF,0xDE,0xDC,0x72,0xF8,0x6F,0x34,0x1C,0xE1,0x6F,0xAC,
+	0xD3,0xBD,0xDF,0x63,0x14,0x05,0xB9,0x9B,0xB1,0x8F,0x90,
+	0xA2,0xAC,0x3C,0xEF,0xE5,0x06,0xFE,0x6F,0x47,0x1C,0xCB,
+	0x35,0xFF,0xF9,0x82,0xDE,0x9D,0xEA,0xEF,0x2F,0x8A,0x1A,
+	0x29,0xAE,0xEE,0xFF,0xDB,0x11,0xC7,0x6B,0xDF,0x53,0xC4,
+	0x51,0x19,0xC4,0x78,0xE3,0xBB,0xF4,0xC1,0xBF,0x6D,0xA0,
+	0x71,0x46,0xF9,0x7D,0xC6,0x50,0x7D,0xDF,0x3D,0x86,0xFA,
+	0xF6,0x21,0x6F,0xAF,0xE2,0xFB,0x13,0x56,0xEF,0x77,0x10,
+	0x56,0xEF,0xB7,0xAE,0x51,0xF2,0x7F,0xBA,0x08,0xEA,0x7B,
+	0x0B,0x38,0x3A,0xFF,0x93,0x07,0x1C,0x23,0xD7,0x03,0x62,
+	0x83,0xBF,0x79,0x7D,0xDF,0xF0,0x32,0x40,0xF3,0x83,0xDD,
+	0x87,0xD8,0xE0,0x2F,0x7E,0xBB,0x4F,0x5E,0xC5,0x5E,0x23,
+	0x2D,0xB2,0x99,0x56,0x03,0x5F,0x7B,0x2E,0xF1,0xE3,0xFE,
+	0xED,0xBA,0xF4,0xFC,0x25,0xE7,0xA5,0xED,0x97,0x56,0x3D,
+	0xD4,0x2B,0x66,0x18,0xC8,0x8E,0xBB,0xE5,0x09,0xD4,0xF3,
+	0x2F,0x55,0xF9,0xE3,0x42,0x53,0xAA,0x5E,0x8D,0x0B,0x4D,
+	0xAA,0xFA,0xF7,0xB8,0x90,0xBE,0xEA,0x5C,0x5C,0x48,0x57,
+	0xD5,0x1A,0x17,0x52,0x56,0x0D,0xC4,0x95,0x36,0x3D,0x11,
+	0x5D,0xB7,0x21,0x57,0x5E,0x57,0x90,0x19,0x6F,0xD5,0xD1,
+	0x49,0xF8,0xE6,0x72,0x80,0xC7,0x3D,0xA9,0xFB,0x45,0x11,
+	0xB7,0x76,0x9D,0x1F,0x7C,0x6B,0x1E,0xAE,0xB5,0x69,0xE9,
+	0x16,0xB8,0x2E,0xC1,0xD2,0x8D,0x7B,0xCC,0xE0,0xC2,0xC7,
+	0xB8,0x13,0x49,0x1A,0xE3,0xE7,0x06,0xF8,0x6B,0x31,0xA3,
+	0x7E,0x4E,0x2F,0xDA,0x3D,0x48,0x12,0x8B,0xEF,0x12,0x4A,
+	0xBA,0x70,0x50,0x03,0xD7,0x57,0x7A,0xCC,0xCF,0xF5,0xF1,
+	0x8D,0xA3,0x96,0xE2,0x0E,0xC5,0x55,0x33,0xE4,0x84,0xAB,
+	0xAB,0x5E,0x45,0x04,0x6E,0x50,0x1E,0x5B,0xF4,0x38,0x6F,
+	0xE9,0xE1,0xAF,0xF8,0x6B,0x62,0x07,0x11,0x31,0x8D,0xB8,
+	0x92,0x6B,0xF1,0x83,0x0B,0xF9,0x9C,0x5E,0x09,0x20,0x40,
+	0xE6,0x4F,0xF2,0x97,0x99,0xF7,0x29,0x64,0xA5,0xA5,0x77,
+	0x34,0xE8,0x5B,0xF8,0xE6,0x45,0x7E,0x6B,0xB7,0xD2,0xDA,
+	0x55,0xAF,0x25,0x21,0x35,0xDD,0x05,0x82,0xB7,0x84,0x8F,
+	0x97,0x68,0xC6,0x01,0x3C,0x8D,0x3F,0x99,0x79,0x1C,0x68,
+	0xA5,0xBB,0x11,0x33,0xEF,0x8F,0x86,0xA5,0x3B,0x61,0xED,
+	0x62,0x9A,0x01,0xCE,0xFA,0x64,0xCD,0xC0,0x89,0xB7,0xBB,
+	0xC4,0x59,0xA2,0xBF,0xE1,0xDA,0x4B,0x3D,0xA2,0x28,0x1A,
+	0xF6,0xC4,0x93,0xD2,0x16,0x7F,0x8D,0x70,0xB4,0x47,0x54,
+	0x0E,0x09,0xAF,0x87,0x45,0xE5,0xE5,0x59,0x35,0x74,0x51,
+	0x51,0xA2,0x9D,0x66,0xF0,0x28,0xC8,0xB5,0x16,0x5C,0xFB,
+	0x25,0x5F,0x62,0x1B,0xAE,0x0E,0xF6,0x28,0x5D,0x0D,0x63,
+	0xDC,0xDD,0x4B,0x08,0x61,0xBE,0xE1,0x20,0xC4,0x94,0xF6,
+	0xF0,0xAC,0xD9,0x8F,0x98,0x7F,0x34,0x67,0xEE,0xC2,0x45,
+	0x8B,0x97,0x64,0x71,0x64,0x4B,0xC1,0xCE,0x67,0x0A,0x9E,
+	0x31,0x3E,0x51,0xB4,0xDD,0xB1,0xB5,0xA8,0xB0,0xF8,0xA9,
+	0x78,0x62,0x84,0x63,0x66,0xA1,0x0D,0x7F,0x8C,0x4B,0x8A,
+	0x0A,0xEF,0x75,0x18,0x9D,0xC5,0x05,0x46,0x6E,0x5B,0xBE,
+	0xC3,0x98,0x57,0x90,0xBF,0xCD,0xB8,0xA2,0x68,0x53,0x81,
+	0xD1,0x51,0x64,0xB4,0x17,0xE4,0x6F,0x32,0x16,0xEC,0x74,
+	0x14,0x14,0x6E,0x2A,0xD8,0x64,0x04,0x20,0x45,0xF6,0xE7,
+	0x22,0xA5,0x37,0x8C,0x2A,0xBD,0x68,0xD9,0xCA,0x55,0xC6,
+	0x65,0x39,0xAB,0x8D,0x69,0x8F,0x2C,0xBD,0x79,0xD9,0x42,
+	0x1B,0x29,0xDC,0x20,0x53,0x34,0x63,0x23,0xD9,0x58,0xB4,
+	0xFD,0xB9,0xA7,0x37,0xE5,0x3B,0xF2,0x9F,0x76,0x14,0x91,
+	0x8D,0xDB,0x9F,0x33,0xA6,0x67,0x18,0xEF,0xDB,0x5A,0xE8,
+	0xB8,0x7F,0x7B,0xBE,0x3D,0x9F,0x2C,0x2D,0x2A,0x76,0x18,
+	0x01,0xAA,0xBD,0xA0,0xB8,0xC0,0x61,0xDC,0x6E,0x2F,0xDA,
+	0x58,0x50,0x5C,0x5C,0x64,0x37,0xE6,0x17,0x6E,0x32,0x2E,
+	0x33,0xEE,0xC8,0x2F,0x36,0x16,0x16,0x39,0x8C,0xF9,0x1B,
+	0xB6,0xC9,0xC4,0x16,0x3B,0xF2,0xED,0x0E,0xA3,0x0D,0xAB,
+	0x61,0xC7,0x6A,0x3C,0x03,0xD5,0x88,0xC7,0x8D,0x32,0xE9,
+	0x11,0xF9,0x5D,0x02,0x10,0xC9,0x9A,0x65,0x39,0x46,0xB2,
+	0x38,0xF7,0x71,0x23,0x59,0x92,0xBB,0x62,0x99,0x91,0x2C,
+	0x5D,0xB6,0x22,0x6B,0x85,0x91,0x64,0xAD,0x80,0xAF,0xE5,
+	0xCB,0xE9,0xF9,0x13,0x2B,0x7F,0x0C,0xAC,0x5A,0x93,0x6F,
+	0x2F,0xDC,0x5A,0xB8,0xF9,0x51,0xE3,0x0A,0x5A,0x03,0x63,
+	0xF1,0x96,0xA2,0x1D,0x85,0xC6,0xAD,0xC5,0xC6,0x1D,0x5B,
+	0x00,0xCD,0x9A,0xAD,0x85,0x9B,0x8A,0x76,0x14,0x1B,0x37,
+	0x6E,0x29,0x2A,0x2E,0x28,0x46,0x2A,0x9E,0xC9,0xFF,0xBB,
+	0x02,0x63,0xBE,0x2B,0x7F,0xEB,0x36,0xA4,0x6B,0x86,0xC4,
+	0x2D,0x7A,0x2C,0x73,0x18,0x9F,0xD9,0xBA,0x79,0x8B,0x83,
+	0x12,0x6D,0x2F,0xB0,0x6D,0x2B,0xD8,0x08,0xC4,0x6F,0x74,
+	0x38,0x81,0xD2,0xE2,0xE7,0x8A,0x1D,0x20,0x22,0x89,0x4B,
+	0x50,0x48,0x92,0x5C,0xF6,0xD2,0xA8,0xDC,0xB7,0x3B,0xEC,
+	0x1B,0xF3,0x8B,0x1D,0x19,0xD3,0x37,0xD1,0x0A,0x62,0xFD,
+	0xF0,0x7C,0xC3,0x56,0x40,0xBC,0x13,0x93,0xE3,0xC9,0x73,
+	0x05,0xC5,0xA4,0xB0,0x48,0x22,0xFF,0x51,0xE3,0xF4,0x62,
+	0xE3,0x7D,0xD3,0x8B,0xEF,0x37,0x6E,0xDB,0xFA,0xCC,0x56,
+	0x47,0x86,0x69,0xE7,0xF4,0x6D,0xDB,0xD6,0xC6,0x13,0x10,
+	0xEF,0x26,0x10,0xC3,0x63,0xCE,0x67,0xB6,0x03,0xB5,0x8F,
+	0x1A,0x63,0xF8,0xA2,0x1A,0xC5,0xA7,0x9B,0xFD,0xE6,0x15,
+	0x3C,0xEB,0xDC,0x0A,0xCC,0x36,0xE6,0x1B,0x67,0xCF,0x31,
+	0x1B,0x41,0x1E,0x5B,0xA0,0x5A,0x05,0xF6,0xA8,0x80,0xA2,
+	0x59,0x80,0xC3,0xCB,0x96,0xC8,0x0C,0xDD,0x98,0x5F,0x88,
+	0x35,0x2F,0xDA,0x5E,0x60,0xCF,0x77,0x14,0x18,0x6D,0xF6,
+	0xA2,0x67,0x8C,0x3B,0xB6,0x3A,0xB6,0x6C,0x2D,0x8C,0xB0,
+	0x91,0xA4,0x99,0x1F,0xDA,0xB0,0xD5,0x61,0x1C,0x37,0xFF,
+	0x8E,0x2D,0x5B,0x41,0xCE,0xAE,0xAD,0x76,0xCA,0xB0,0x39,
+	0x26,0x40,0x8D,0xF2,0x45,0x51,0x00,0x13,0xB7,0xBA,0x0A,
+	0x8C,0xF7,0x15,0x16,0x19,0x2D,0x8B,0x73,0x97,0x19,0x8B,
+	0x0B,0xEC,0xAE,0xAD,0x1B,0x91,0xC2,0x88,0x1C,0xEE,0x97,
+	0x69,0xB0,0x47,0x08,0x73,0xA0,0xF4,0x1C,0x5B,0x0A,0x90,
+	0x42,0x63,0xB1,0x73,0xFB,0xF6,0x22,0xD0,0x9C,0xDC,0x55,
+	0x59,0x58,0x9D,0xDC,0x85,0x59,0x64,0xDB,0x36,0x90,0x05,
+	0x28,0xE4,0xA3,0x20,0x2D,0x59,0x2C,0x51,0x68,0xC6,0xFB,
+	0x66,0x99,0x7F,0xBC,0xC8,0x58,0x58,0x50,0x00,0xAA,0x7D,
+	0xBF,0xD1,0x06,0x65,0x1E,0x5E,0x81,0xC5,0x24,0xF4,0xDB,
+	0xF3,0x37,0x83,0x42,0x62,0xC6,0x6F,0x00,0x83,0x05,0xB3,
+	0x97,0xAC,0xFE,0x26,0x64,0x73,0x46,0xE1,0x9A,0xBD,0x82,
+	0x52,0xFA,0xDD,0x70,0xDD,0xF7,0xB0,0x69,0x7C,0x92,0xBF,
+	0x3D,0x84,0xD9,0xE3,0xD3,0x71,0x73,0x00,0x8E,0x2D,0x45,
+	0x9B,0x62,0x84,0x40,0xA6,0x6F,0x29,0x7E,0xD0,0x68,0x73,
+	0x16,0x6E,0x44,0x3B,0x64,0x94,0xAE,0x50,0xA8,0xF4,0x6C,
+	0xDB,0xD6,0x42,0x38,0xDB,0x84,0xCA,0x5F,0x0C,0x02,0xA4,
+	0x59,0x38,0x28,0x59,0xB0,0x89,0x80,0x9A,0xDE,0xB5,0x28,
+	0x2F,0x6B,0xE1,0x8F,0xF3,0xB2,0x56,0x3F,0x9E,0x97,0x63,
+	0x9C,0x3E,0x6B,0x13,0xB4,0x90,0x9C,0x95,0x79,0x2B,0x16,
+	0x2E,0x37,0xAE,0xCE,0xCA,0x5B,0xB1,0x2C,0x67,0xE1,0xEA,
+	0x65,0x2B,0x73,0x08,0xC9,0x29,0x2A,0x2C,0x40,0x1D,0xDF,
+	0x46,0x56,0x39,0xC0,0x4A,0xE4,0xDB,0x37,0x91,0xAC,0xC2,
+	0x2D,0xF9,0x85,0x1B,0x01,0x4A,0xCE,0x6A,0xB2,0x72,0xD5,
+	0xCC,0x87,0x09,0x1A,0x2A,0x80,0x68,0x91,0x34,0x69,0x51,
+	0xD1,0x4E,0x23,0x41,0xB3,0xF5,0x70,0xDA,0x16,0xE3,0xC2,
+	0xA5,0x19,0xB3,0x4C,0x5B,0xA2,0x97,0x6B,0x33,0x66,0xCD,
+	0x32,0x99,0xB7,0x90,0x25,0x05,0x9B,0x9C,0x1B,0x65,0x95,
+	0x45,0xF3,0xE1,0x2A,0xB0,0x17,0x03,0x7D,0x52,0x46,0x8E,
+	0x66,0x4C,0x33,0x9B,0x16,0x6E,0x89,0x4D,0x98,0x6D,0x9E,
+	0x63,0xDA,0x32,0x2A,0x07,0x24,0x40,0xE5,0x9C,0xCF,0x80,
+	0x41,0x19,0x03,0xCC,0x58,0xE8,0x7C,0x66,0x43,0x81,0x9D,
+	0x64,0x17,0x38,0x2C,0x52,0x4A,0xD6,0x4E,0xE3,0x13,0x39,
+	0xAB,0x2D,0x4B,0x56,0xCC,0xC8,0x5A,0x9B,0x65,0xFC,0x21,
+	0x66,0xCE,0x59,0xBD,0x70,0xD5,0xEA,0x19,0x96,0x25,0x4B,
+	0x9E,0x22,0xAB,0x16,0x93,0x55,0x4B,0x48,0xCE,0xE3,0xCB,
+	0xA9,0x71,0x21,0xAB,0x16,0xAD,0x5C,0x45,0x1E,0x5F,0xBE,
+	0x3A,0x6F,0xE1,0x0A,0x68,0x71,0x60,0xDE,0xB2,0x8C,0xF7,
+	0xAD,0x41,0x96,0x2E,0x2B,0x36,0xE6,0xA0,0x95,0x2C,0x34,
+	0x66,0x3D,0xE3,0x04,0xCB,0x51,0x64,0xBF,0x9F,0x2C,0x20,
+	0xB1,0xB0,0xC8,0x92,0xAD,0xC5,0xDB,0xF3,0x1D,0x1B,0x81,
+	0xDA,0xC2,0xAD,0x8E,0x11,0xB7,0x44,0x91,0xAC,0x58,0xF5,
+	0x10,0xA4,0x10,0xCE,0x5E,0x50,0x80,0xBF,0xD8,0xF0,0x48,
+	0x1A,0x7C,0x1E,0x86,0xCF,0x2C,0xF8,0x80,0x0D,0x20,0x8F,
+	0xC0,0xC7,0x0C,0x1F,0x89,0xFF,0x39,0x45,0x52,0xBB,0x8F,
+	0x91,0xBC,0x74,0x0D,0xAD,0x7C,0xEB,0x46,0x68,0xCB,0xC5,
+	0xC6,0x55,0xA0,0x37,0x5B,0x25,0xF3,0xBD,0x1D,0xAD,0x7B,
+	0xA1,0x03,0x8C,0x7D,0xD1,0xDF,0x51,0xFF,0x61,0xDE,0xF2,
+	0x20,0xF8,0x8D,0x82,0x8D,0x4E,0x68,0xF4,0x98,0x0F,0x8C,
+	0x6A,0x71,0x01,0xB4,0x73,0x9B,0x11,0x4C,0xC3,0xC6,0x7C,
+	0x67,0x31,0x35,0x3D,0xB6,0x7C,0xE7,0x36,0x87,0xF1,0x09,
+	0x6A,0xBD,0x9D,0xE0,0x62,0xEC,0x68,0x44,0x8C,0xB3,0x66,
+	0xA4,0xCD,0x9C,0xBB,0x73,0xE6,0x8A,0x2C,0xCA,0xD9,0x0D,
+	0x45,0x3B,0x81,0x4F,0x12,0xAA,0x8D,0x4E,0xBB,0x1D,0xD0,
+	0x6C,0x7B,0xCE,0xB8,0x69,0x6B,0x31,0xD2,0xB4,0xE9,0x41,
+	0x40,0xBF,0xA1,0x68,0xD3,0x73,0xC6,0x2D,0xE0,0x48,0x0A,
+	0x0A,0x69,0x1A,0xA2,0x78,0xAE,0xC0,0x41,0x1E,0x2F,0x8C,
+	0x78,0x15,0x28,0x03,0xB0,0x29,0x1A,0xB0,0x6F,0x0E,0xB0,
+	0xD9,0xE8,0xCD,0xC0,0xF0,0x80,0x24,0x91,0xA9,0x12,0x7B,
+	0x8C,0xF9,0xDB,0xB7,0x6F,0xC3,0xBA,0xA1,0x20,0x97,0x01,
+	0x44,0x30,0x47,0xD0,0x04,0x76,0xE4,0x3F,0x87,0x30,0xA0,
+	0xC6,0x0E,0xDA,0x62,0x90,0x96,0x51,0x76,0x6F,0x2C,0xC9,
+	0x0F,0x4A,0xD8,0x64,0xF6,0x44,0x79,0xF8,0xB7,0x31,0x48,
+	0xA2,0xEF,0x29,0x90,0x1B,0x08,0xCB,0xB8,0x62,0xA5,0xC5,
+	0xB8,0x38,0x6F,0x76,0x34,0xF9,0xA6,0xDC,0x21,0x0B,0x1D,
+	0xE0,0x91,0x20,0x62,0x00,0x55,0x05,0x04,0x3B,0xEC,0x5B,
+	0x01,0x1B,0x16,0xB5,0x49,0x6D,0x72,0xCB,0x56,0x68,0xEA,
+	0xE0,0xB6,0xC0,0x89,0xD3,0xD3,0xA7,0xE1,0xFC,0xE9,0x67,
+	0x8A,0x5C,0x05,0xA4,0xB8,0x60,0xB3,0xCB,0x98,0x91,0x61,
+	0xDC,0x04,0xCD,0x78,0x33,0x7A,0xD4,0xB5,0x70,0x98,0xF0,
+	0xE4,0x27,0xF4,0xC4,0x92,0xBD,0x30,0x63,0xBA,0xD3,0x98,
+	0x25,0xFD,0x2C,0x96,0x7E,0x56,0x2C,0x91,0x7E,0xE4,0xCB,
+	0xA5,0xD9,0x8B,0xE1,0xE7,0xBE,0xE9,0xCE,0xFB,0x8D,0xAB,
+	0xA1,0x1D,0x3F,0x37,0x33,0x77,0xF1,0xCF,0xEC,0x78,0x63,
+	0xE1,0x33,0xC5,0x0E,0x7B,0xFE,0x26,0x38,0x45,0xCF,0x3A,
+	0x6B,0xA7,0xC9,0xB8,0x6C,0xE6,0x4A,0xE3,0x86,0x7C,0x08,
+	0x40,0x32,0x8C,0xE0,0xE4,0x4C,0xB3,0x76,0x1A,0x8D,0xD0,
+	0x06,0x8C,0x99,0xF4,0xEA,0x91,0x6D,0x3B,0x1F,0x92,0x7F,
+	0x8D,0xC6,0x85,0xCB,0x73,0x97,0x52,0xE8,0x73,0xD7,0xC8,
+	0xE5,0xC9,0x4F,0x09,0xF0,0xCA,0x48,0x72,0x48,0x11,0x7C,
+	0x13,0x6C,0x27,0x05,0x85,0x45,0xCE,0xCD,0x5B,0x22,0xD6,
+	0x0F,0x6A,0x9E,0xBF,0x6D,0x5B,0xD1,0x46,0xEA,0xB0,0xD0,
+	0x54,0x01,0x76,0x27,0xB8,0x6C,0xD0,0x59,0xB4,0x4A,0x64,
+	0xC9,0xF2,0xE5,0x54,0x4A,0xB6,0x22,0xD0,0xC1,0xE1,0x76,
+	0x64,0xB4,0x17,0x39,0x1D,0xD8,0xF6,0xA2,0xB7,0xB0,0x65,
+	0x8D,0x93,0x3C,0x06,0x23,0x64,0x04,0x7D,0xB3,0xE5,0x6F,
+	0x2C,0x18,0x25,0xFD,0x05,0x84,0xDB,0x56,0x94,0x8F,0xE2,
+	0x78,0x68,0x7B,0x11,0x44,0x48,0xC3,0x4E,0x0B,0xB3,0xC1,
+	0x1D,0xB0,0xCA,0x31,0x91,0x5F,0xFE,0x86,0x8D,0x9B,0x0A,
+	0x6C,0x9B,0xB7,0x6C,0xFD,0xD9,0xDF,0x6D,0x7B,0xA6,0xB0,
+	0x68,0xFB,0xB3,0xF6,0x62,0x87,0xD3,0xB5,0x63,0xE7,0x73,
+	0xCF,0x63,0x28,0x41,0x9E,0x25,0x53,0x48,0x32,0xFC,0x0D,
+	0x47,0x8D,0x4A,0x3C,0xC6,0x06,0x93,0xF1,0x09,0x23,0x8F,
+	0x39,0xC3,0x87,0x9C,0xB0,0x96,0x1E,0x4B,0xC7,0x39,0xA4,
+	0xFB,0xBF,0xA6,0x87,0x77,0x9C,0x03,0xEF,0x32,0xE4,0xFB,
+	0x3F,0xEE,0x26,0x57,0xF5,0x63,0x62,0xEC,0x31,0xB9,0x14,
+	0x63,0xD2,0x14,0xB8,0xFE,0xEB,0x88,0x43,0x49,0x94,0x63,
+	0xF2,0xA8,0xC8,0xFF,0x7F,0x90,0x6F,0x66,0xEF,0xB7,0x3C,
+	0x36,0x18,0xBE,0x29,0x07,0x6E,0x2E,0x3B,0xF2,0x48,0x56,
+	0x5F,0xD5,0xDF,0x03,0x9F,0xFB,0xE0,0x93,0x06,0x9F,0x47,
+	0xE1,0x93,0xA1,0x1E,0x2B,0xF3,0xB1,0x25,0xC7,0x1E,0x8B,
+	0xA0,0xDC,0x32,0xF8,0x88,0xFF,0x5F,0xE1,0x64,0x0C,0x21,
+	0x6E,0xCD,0x55,0xFD,0x5E,0xF8,0xF0,0xF0,0x29,0x83,0xCF,
+	0x3F,0xC2,0xE7,0x57,0xF0,0xF9,0x17,0xCD,0xD8,0xBA,0xFE,
+	0x8D,0x28,0xE8,0x51,0xA1,0xBB,0xAA,0x3F,0xAC,0xFB,0x3A,
+	0x98,0xDA,0xDC,0xDB,0xC7,0x49,0xCD,0x1D,0x87,0xD3,0x8F,
+	0x3C,0x34,0x43,0xFB,0x84,0x62,0xCD,0x1A,0x05,0x34,0x9C,
+	0xFC,0xDC,0x3C,0xC3,0xED,0x9A,0xDB,0x6F,0x57,0xE8,0xF5,
+	0x09,0x2D,0xF7,0xB8,0x99,0x55,0xF7,0x55,0xFC,0x07,0x98,
+	0x07,0x51,0x3A,0x76,0x3D,0x2E,0x1F,0xF2,0xF5,0x82,0x59,
+	0xF2,0xF1,0xA6,0x74,0x3C,0xF0,0x8B,0x94,0x65,0xF4,0x5F,
+	0xBE,0x3F,0xED,0xD9,0x3B,0x1B,0xE8,0xFF,0xBF,0x48,0xC7,
+	0xED,0x81,0xAC,0x29,0x4F,0x39,0xE0,0x4B,0x06,0x73,0x6B,
+	0xE5,0x2D,0xF3,0xE8,0xBF,0x54,0x6A,0xD9,0xA4,0x89,0xF2,
+	0x21,0x97,0x37,0x44,0x8E,0x39,0xFE,0xAB,0xF8,0xCF,0x3E,
+	0xF2,0xCB,0xF7,0x73,0xAD,0x8B,0x9F,0xD3,0xBF,0x27,0x1D,
+	0x09,0xA6,0x84,0x3A,0xFA,0x1F,0x3C,0x28,0xCC,0xA8,0x0E,
+	0x1E,0x9C,0x90,0xF4,0xD6,0xBE,0xBD,0x0F,0x6E,0xBA,0x6B,
+	0x82,0x4C,0x4F,0xFC,0xF6,0x8C,0xF8,0xF7,0xCB,0xE1,0xAB,
+	0x85,0x7F,0x0D,0xFF,0xE3,0xA6,0x1F,0xFA,0xE7,0x46,0xEB,
+	0xA2,0xBF,0x8F,0x93,0xC9,0x8C,0xD3,0x9D,0xC9,0x28,0xAB,
+	0xB8,0xD4,0xAC,0x93,0x8D,0xAB,0x2E,0x71,0x91,0xEE,0xAE,
+	0x3D,0xF0,0x25,0xE3,0xD7,0xF6,0x1E,0xD3,0x4E,0x7B,0x01,
+	0xBE,0x5E,0x96,0x0E,0x6D,0xAE,0xD6,0x49,0xFF,0xE5,0x6A,
+	0x69,0xC7,0x65,0x56,0xC2,0xB7,0xE7,0x6B,0x22,0xF9,0x55,
+	0x06,0xA1,0x9F,0x1F,0x2C,0x94,0x3E,0x20,0xBC,0x38,0x86,
+	0x99,0xA0,0x51,0xA9,0xD5,0x6A,0x85,0x52,0x64,0xB5,0x29,
+	0x1A,0x1D,0x23,0x4E,0x86,0x74,0xB4,0x9C,0xCA,0x31,0xD6,
+	0x73,0xF4,0x51,0x93,0x88,0x3A,0xC6,0x18,0xDB,0x6F,0xC5,
+	0x67,0x1E,0x19,0x77,0xC1,0xF7,0x9C,0xA6,0x39,0x98,0x92,
+	0x85,0xD0,0x8D,0x73,0xA7,0x60,0xFA,0x6F,0xEF,0x21,0xE4,
+	0x7F,0x03,0xE7,0x43,0x5A,0xA3,
 };
 
 struct BuiltinFileBlob bfb_HEXMEM16_EXE = {
 	/*recommended file name*/	"HEXMEM16.EXE",
 	/*data*/			bin_hexmem16_exe,
-	/*length*/			sizeof(bin_hexmem16_exe)
+	/*length*/			62130,
+	/*compressed length*/	sizeof(bin_hexmem16_exe)
 };
 
@@ -2,7229 +2,4083 @@
 #include "dos_inc.h"
 
 static const unsigned char bin_hexmem32_exe[] = {
-  0x4d, 0x5a, 0xf6, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x05, 0x00, 0xac, 0x00,
-  0xff, 0xff, 0x96, 0x03, 0x00, 0x08, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x37, 0x00, 0x00, 0x6b, 0x05, 0x00, 0x00, 0xf7, 0x05, 0x00, 0x00,
-  0xde, 0x06, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0xcc, 0xeb, 0xfd, 0x90,
-  0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0xb8, 0x22, 0x00, 0xe8, 0xd2, 0x00, 0x85,
-  0xc0, 0x74, 0x24, 0xbf, 0x16, 0x06, 0x89, 0xc6, 0x57, 0xac, 0x88, 0x05,
-  0x47, 0x3c, 0x00, 0x75, 0xf8, 0x5f, 0x89, 0xf8, 0xba, 0x31, 0x00, 0xe8,
-  0x1d, 0x01, 0x89, 0xf8, 0xe8, 0x38, 0x01, 0x85, 0xc0, 0x74, 0x04, 0x89,
-  0xf8, 0xeb, 0x4e, 0x31, 0xc9, 0x31, 0xf6, 0xeb, 0x08, 0x41, 0x46, 0x46,
-  0x83, 0xf9, 0x02, 0x73, 0x19, 0xbb, 0x16, 0x06, 0xb8, 0x36, 0x00, 0x8b,
-  0x94, 0xda, 0x03, 0xe8, 0xbf, 0x01, 0x80, 0x3e, 0x16, 0x06, 0x00, 0x74,
-  0xe4, 0xb8, 0x16, 0x06, 0xeb, 0x27, 0x31, 0xc9, 0x31, 0xf6, 0xeb, 0x08,
-  0x41, 0x46, 0x46, 0x83, 0xf9, 0x02, 0x73, 0x16, 0xbb, 0x16, 0x06, 0xb8,
-  0x41, 0x00, 0x8b, 0x94, 0xda, 0x03, 0xe8, 0x98, 0x01, 0x80, 0x3e, 0x16,
-  0x06, 0x00, 0x74, 0xe4, 0xeb, 0xd7, 0xb8, 0x4b, 0x00, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0xc3, 0x53, 0x55, 0x89, 0xe5, 0x81, 0xec, 0x88, 0x00, 0x81,
-  0xed, 0x80, 0x00, 0x89, 0xd3, 0xe8, 0x68, 0xff, 0x89, 0x46, 0x78, 0x8b,
-  0x07, 0x89, 0x46, 0x7a, 0x8d, 0x46, 0xf8, 0x8d, 0x56, 0x78, 0xe8, 0xd6,
-  0x02, 0x89, 0x46, 0x7c, 0x8b, 0x46, 0x78, 0xc7, 0x46, 0x7e, 0x00, 0x00,
-  0xe8, 0xd7, 0x02, 0xb8, 0x57, 0x00, 0xe8, 0xdb, 0x02, 0x8b, 0x46, 0x78,
-  0xe8, 0xd5, 0x02, 0xe8, 0xf8, 0x02, 0x89, 0xc3, 0x8b, 0x07, 0xe8, 0xf9,
-  0x02, 0xe8, 0xc8, 0x02, 0xb8, 0x01, 0x00, 0xe8, 0xc7, 0x03, 0x8d, 0xa6,
-  0x80, 0x00, 0x5d, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc7,
-  0x8b, 0x36, 0xb4, 0x07, 0x85, 0xf6, 0x74, 0x53, 0x85, 0xc0, 0x74, 0x4f,
-  0x8b, 0x1c, 0x85, 0xdb, 0x74, 0x49, 0x89, 0xfa, 0x80, 0x3f, 0x00, 0x75,
-  0x05, 0x83, 0xc6, 0x02, 0xeb, 0xee, 0x89, 0xd0, 0xe8, 0x31, 0x06, 0x85,
-  0xc0, 0x74, 0x0e, 0x80, 0x3f, 0x3d, 0x75, 0xed, 0x8d, 0x47, 0x01, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x89, 0xd8, 0xe8, 0x51, 0x06, 0xe8, 0x78,
-  0x06, 0x89, 0xc1, 0x89, 0xd0, 0xe8, 0x47, 0x06, 0xe8, 0x6e, 0x06, 0x39,
-  0xc1, 0x75, 0xce, 0x89, 0xd8, 0xe8, 0x79, 0x06, 0x89, 0xc3, 0x89, 0xd0,
-  0xe8, 0x72, 0x06, 0x89, 0xc2, 0xeb, 0xb9, 0x31, 0xc0, 0xeb, 0xd0, 0x53,
-  0x52, 0x89, 0xc2, 0x89, 0xc3, 0x8a, 0x07, 0x84, 0xc0, 0x74, 0x0f, 0x2c,
-  0x41, 0x3c, 0x19, 0x76, 0x03, 0x43, 0xeb, 0xf1, 0x04, 0x61, 0x88, 0x07,
-  0xeb, 0xf7, 0x89, 0xd0, 0x5a, 0x5b, 0xc3, 0x53, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x89, 0xd3, 0x80, 0x3f, 0x00,
-  0x74, 0x3d, 0x80, 0x7f, 0x01, 0x00, 0x74, 0x3f, 0xb9, 0xff, 0xff, 0x89,
-  0xf7, 0x30, 0xc0, 0xe3, 0x0a, 0x8c, 0xda, 0x8e, 0xc2, 0xf2, 0xae, 0x75,
-  0x02, 0x4f, 0xa9, 0x8b, 0xf9, 0x89, 0x7e, 0xfc, 0x89, 0xdf, 0x8c, 0xd8,
-  0x8e, 0xc0, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49,
-  0x89, 0x4e, 0xfe, 0x8b, 0x4e, 0xfc, 0x29, 0xf1, 0x3b, 0x4e, 0xfe, 0x73,
-  0x28, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x8a,
-  0x17, 0x8a, 0x04, 0x3a, 0xc2, 0x74, 0x12, 0x3c, 0x00, 0x74, 0x0c, 0x46,
-  0x8a, 0x04, 0x3a, 0xc2, 0x74, 0x07, 0x46, 0x3c, 0x00, 0x75, 0xea, 0x2b,
-  0xf6, 0x89, 0xf0, 0xeb, 0xda, 0x89, 0xf7, 0x8a, 0x07, 0xe3, 0x0a, 0x8c,
-  0xda, 0x8e, 0xc2, 0xf2, 0xae, 0x75, 0x02, 0x4f, 0xa9, 0x8b, 0xf9, 0x89,
-  0xfa, 0x85, 0xff, 0x74, 0xc0, 0x8b, 0x4e, 0xfe, 0x8c, 0xde, 0x89, 0xdf,
-  0x8e, 0xc6, 0x89, 0xd6, 0xf3, 0xa6, 0x9f, 0xf6, 0xc4, 0x40, 0x75, 0x05,
-  0x89, 0xd6, 0x46, 0xeb, 0x9e, 0x89, 0xd0, 0xeb, 0xa6, 0x51, 0x56, 0x57,
-  0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc7, 0x89, 0xd6, 0x89, 0x5e,
-  0xfe, 0xe8, 0x9e, 0x01, 0x89, 0xc3, 0x31, 0xd2, 0x89, 0xf8, 0x8b, 0x0f,
-  0xe8, 0xae, 0x05, 0x85, 0xc0, 0x75, 0x59, 0x8b, 0x76, 0xfe, 0x8a, 0x05,
-  0x31, 0xd2, 0x3c, 0x5c, 0x74, 0x38, 0x3c, 0x2e, 0x74, 0x34, 0x3c, 0x2f,
-  0x74, 0x30, 0x84, 0xc0, 0x74, 0x06, 0x80, 0x7d, 0x01, 0x3a, 0x74, 0x26,
-  0xba, 0x90, 0x00, 0x8b, 0x46, 0xfe, 0xe8, 0xb6, 0x05, 0x8b, 0x46, 0xfe,
-  0x8b, 0x76, 0xfe, 0xe8, 0x2f, 0x06, 0x01, 0xc6, 0x89, 0xc2, 0x80, 0x7c,
-  0xff, 0x5c, 0x74, 0x0a, 0x3d, 0x8f, 0x00, 0x73, 0x05, 0x42, 0xc6, 0x04,
-  0x5c, 0x46, 0xbb, 0x8f, 0x00, 0x89, 0xf0, 0x29, 0xd3, 0x89, 0xfa, 0xc6,
-  0x04, 0x00, 0xe8, 0x23, 0x06, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xc3,
-  0x89, 0xf0, 0xe8, 0x50, 0xfe, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0x03, 0xe9,
-  0x79, 0x00, 0x80, 0x3f, 0x00, 0x74, 0xf8, 0x8b, 0x76, 0xfe, 0x31, 0xd2,
-  0x8a, 0x07, 0x84, 0xc0, 0x74, 0x04, 0x3c, 0x3b, 0x75, 0x4a, 0x3b, 0x76,
-  0xfe, 0x74, 0x3d, 0x8a, 0x44, 0xff, 0x3c, 0x5c, 0x74, 0x13, 0x3c, 0x2f,
-  0x74, 0x0f, 0x3c, 0x3a, 0x74, 0x0b, 0x81, 0xfa, 0x8f, 0x00, 0x73, 0x05,
-  0x42, 0xc6, 0x04, 0x5c, 0x46, 0x89, 0xf8, 0xc6, 0x04, 0x00, 0xe8, 0xbc,
-  0x05, 0x01, 0xc2, 0x81, 0xfa, 0x90, 0x00, 0x73, 0x13, 0x89, 0xfa, 0x89,
-  0xf0, 0xe8, 0xf2, 0x05, 0x8b, 0x46, 0xfe, 0x31, 0xd2, 0xe8, 0xf1, 0x04,
-  0x85, 0xc0, 0x74, 0x1b, 0x80, 0x3f, 0x00, 0x74, 0x1e, 0x43, 0xeb, 0xa2,
-  0x3c, 0x22, 0x75, 0x03, 0x43, 0xeb, 0xa5, 0x81, 0xfa, 0x8f, 0x00, 0x73,
-  0xf7, 0x42, 0x88, 0x04, 0x46, 0xeb, 0xf1, 0x89, 0xc8, 0xe8, 0xf7, 0x05,
-  0xe9, 0x72, 0xff, 0x8b, 0x5e, 0xfe, 0xc6, 0x07, 0x00, 0xe9, 0x69, 0xff,
-  0x53, 0x51, 0x56, 0x89, 0xc6, 0x89, 0xd1, 0xbb, 0x80, 0x00, 0x8e, 0x06,
-  0x38, 0x04, 0x26, 0x8a, 0x07, 0xbb, 0x81, 0x00, 0x30, 0xe4, 0x85, 0xc0,
-  0x7e, 0x10, 0x26, 0x80, 0x3f, 0x20, 0x75, 0x04, 0x43, 0x48, 0xeb, 0xf2,
-  0x26, 0x80, 0x3f, 0x09, 0x74, 0xf6, 0x85, 0xc0, 0x7e, 0x1e, 0x89, 0xc2,
-  0x85, 0xf6, 0x74, 0x25, 0x83, 0xf9, 0x02, 0x7c, 0x24, 0x39, 0xc8, 0x7d,
-  0x25, 0x4a, 0x83, 0xfa, 0xff, 0x74, 0x1a, 0x26, 0x8a, 0x0f, 0x43, 0x88,
-  0x0c, 0x46, 0xeb, 0xf1, 0x85, 0xf6, 0x74, 0x07, 0x85, 0xc9, 0x7e, 0x03,
-  0xc6, 0x04, 0x00, 0x31, 0xc0, 0x5e, 0x59, 0x5b, 0xc3, 0xc6, 0x04, 0x00,
-  0xeb, 0xf7, 0x89, 0xca, 0x4a, 0xeb, 0xd6, 0x53, 0x52, 0x89, 0xc3, 0xba,
-  0xff, 0x7f, 0xe8, 0x8f, 0xff, 0x89, 0xd8, 0x5a, 0x5b, 0xc3, 0x53, 0x8b,
-  0x1e, 0xb4, 0x07, 0xe8, 0xac, 0x05, 0x5b, 0xc3, 0x53, 0x52, 0xba, 0x6e,
-  0x04, 0xe8, 0xa3, 0x06, 0x89, 0xc3, 0x3d, 0xff, 0xff, 0x75, 0x03, 0x5a,
-  0x5b, 0xc3, 0xba, 0x6e, 0x04, 0xb8, 0x0a, 0x00, 0xe8, 0x07, 0x07, 0x3d,
-  0xff, 0xff, 0x74, 0xef, 0x8d, 0x47, 0x01, 0x5a, 0x5b, 0xc3, 0xb8, 0xa6,
-  0x06, 0xc3, 0xb8, 0xa8, 0x06, 0xc3, 0x53, 0x85, 0xc0, 0x7c, 0x06, 0x3b,
-  0x06, 0x30, 0x04, 0x7c, 0x05, 0xb8, 0x6d, 0x03, 0x5b, 0xc3, 0x89, 0xc3,
-  0xd1, 0xe3, 0x8b, 0x87, 0xde, 0x03, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc2, 0xe8, 0xce, 0xff,
-  0x89, 0xc3, 0x8b, 0x07, 0xc6, 0x06, 0xaa, 0x06, 0x00, 0x89, 0x46, 0xfe,
-  0x85, 0xd2, 0x75, 0x61, 0x8b, 0x46, 0xfe, 0xbf, 0xaa, 0x06, 0xe8, 0xbd,
-  0xff, 0x89, 0xc6, 0x1e, 0x07, 0x57, 0xb9, 0xff, 0xff, 0xb0, 0x00, 0xf2,
-  0xae, 0x4f, 0x8a, 0x04, 0x88, 0x05, 0x3c, 0x00, 0x74, 0x10, 0x8a, 0x44,
-  0x01, 0x83, 0xc6, 0x02, 0x88, 0x45, 0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00,
-  0x75, 0xe8, 0x5f, 0xbe, 0x7e, 0x03, 0x1e, 0x07, 0x57, 0xb9, 0xff, 0xff,
-  0xb0, 0x00, 0xf2, 0xae, 0x4f, 0x8a, 0x04, 0x88, 0x05, 0x3c, 0x00, 0x74,
-  0x10, 0x8a, 0x44, 0x01, 0x83, 0xc6, 0x02, 0x88, 0x45, 0x01, 0x83, 0xc7,
-  0x02, 0x3c, 0x00, 0x75, 0xe8, 0x5f, 0x89, 0xf8, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xbb, 0x5e, 0x00, 0xb8, 0xaa, 0x06, 0xbe,
-  0x7b, 0x03, 0xbf, 0xaa, 0x06, 0xe8, 0xf0, 0x06, 0xc6, 0x06, 0x08, 0x07,
-  0x00, 0x1e, 0x07, 0x57, 0xb9, 0xff, 0xff, 0xb0, 0x00, 0xf2, 0xae, 0x4f,
-  0x8a, 0x04, 0x88, 0x05, 0x3c, 0x00, 0x74, 0x10, 0x8a, 0x44, 0x01, 0x83,
-  0xc6, 0x02, 0x88, 0x45, 0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00, 0x75, 0xe8,
-  0x5f, 0xe9, 0x64, 0xff, 0xc3, 0x53, 0x52, 0x89, 0xc3, 0xff, 0x16, 0x32,
-  0x04, 0xba, 0xff, 0x00, 0xb8, 0x10, 0x00, 0xe8, 0x79, 0x07, 0xff, 0x16,
-  0x32, 0x04, 0xff, 0x16, 0x34, 0x04, 0x89, 0xd8, 0xe9, 0x11, 0x02, 0x52,
-  0x89, 0xc2, 0xff, 0x16, 0x32, 0x04, 0xff, 0x16, 0x34, 0x04, 0x89, 0xd0,
-  0xe9, 0x01, 0x02, 0x00, 0xe9, 0x8a, 0x00, 0x4f, 0x70, 0x65, 0x6e, 0x20,
-  0x57, 0x61, 0x74, 0x63, 0x6f, 0x6d, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b,
-  0x31, 0x36, 0x20, 0x52, 0x75, 0x6e, 0x2d, 0x54, 0x69, 0x6d, 0x65, 0x20,
-  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x20, 0x50, 0x6f, 0x72, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x20, 0x28, 0x43, 0x29, 0x20, 0x53, 0x79, 0x62, 0x61, 0x73,
-  0x65, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x31, 0x39, 0x38, 0x38,
-  0x2d, 0x32, 0x30, 0x30, 0x32, 0x2e, 0x2a, 0x2a, 0x2a, 0x20, 0x4e, 0x55,
-  0x4c, 0x4c, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e,
-  0x74, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x4e,
-  0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65,
-  0x6d, 0x6f, 0x72, 0x79, 0x00, 0x63, 0x6f, 0x6e, 0x00, 0x0d, 0x0a, 0x03,
-  0x00, 0xfb, 0xb9, 0x09, 0x03, 0x8e, 0xc1, 0xbb, 0xd0, 0x08, 0x83, 0xc3,
-  0x0f, 0x80, 0xe3, 0xf0, 0x26, 0x89, 0x1e, 0x3e, 0x04, 0x26, 0x8c, 0x1e,
-  0x38, 0x04, 0x03, 0xdc, 0x83, 0xc3, 0x0f, 0x80, 0xe3, 0xf0, 0x8e, 0xd1,
-  0x8b, 0xe3, 0x26, 0x89, 0x1e, 0x40, 0x04, 0x8b, 0xd3, 0xd1, 0xea, 0xd1,
-  0xea, 0xd1, 0xea, 0xd1, 0xea, 0x26, 0x80, 0x3e, 0x3c, 0x04, 0x00, 0x75,
-  0x3d, 0x8b, 0x0e, 0x02, 0x00, 0x8c, 0xc0, 0x2b, 0xc8, 0x3b, 0xd1, 0x72,
-  0x0b, 0xbb, 0x01, 0x00, 0xb8, 0x4f, 0x05, 0x8c, 0xca, 0xe8, 0xe2, 0x06,
-  0x8c, 0xc0, 0x8b, 0xda, 0xd1, 0xe3, 0xd1, 0xe3, 0xd1, 0xe3, 0xd1, 0xe3,
-  0x75, 0x03, 0xbb, 0xfe, 0xff, 0x26, 0x89, 0x1e, 0x36, 0x04, 0x8b, 0xda,
-  0x03, 0xd8, 0x26, 0xa1, 0x38, 0x04, 0x8e, 0xc0, 0x2b, 0xd8, 0xb4, 0x4a,
-  0xcd, 0x21, 0x8c, 0xdf, 0x8e, 0xc7, 0xbf, 0x81, 0x00, 0x8a, 0x4d, 0xff,
-  0xb5, 0x00, 0xfc, 0xb0, 0x20, 0xf3, 0xae, 0x8d, 0x75, 0xff, 0xba, 0x09,
-  0x03, 0x8e, 0xc2, 0x26, 0x8b, 0x3e, 0x3e, 0x04, 0x26, 0x89, 0x3e, 0x58,
-  0x04, 0x26, 0x8c, 0x06, 0x5a, 0x04, 0x74, 0x03, 0x41, 0xf3, 0xa4, 0x2a,
-  0xc0, 0xaa, 0xb0, 0x00, 0xaa, 0x4f, 0xb4, 0x30, 0xcd, 0x21, 0x26, 0xa2,
-  0x3a, 0x04, 0x26, 0x88, 0x26, 0x3b, 0x04, 0x8b, 0xcf, 0x3c, 0x03, 0x72,
-  0x58, 0x8e, 0x1e, 0x2c, 0x00, 0x2b, 0xf6, 0xbd, 0x00, 0x01, 0x8b, 0x04,
-  0x0d, 0x20, 0x20, 0x3d, 0x6e, 0x6f, 0x75, 0x12, 0x81, 0x7c, 0x02, 0x38,
-  0x37, 0x75, 0x27, 0x80, 0x7c, 0x04, 0x3d, 0x75, 0x21, 0x83, 0xcd, 0x01,
-  0xeb, 0x1c, 0x3d, 0x6c, 0x66, 0x75, 0x1a, 0x8b, 0x44, 0x02, 0x0c, 0x20,
-  0x3d, 0x6e, 0x3d, 0x75, 0x10, 0x8a, 0x44, 0x04, 0x0c, 0x20, 0x3c, 0x6e,
-  0x75, 0x07, 0x81, 0xe5, 0xff, 0xfe, 0x83, 0xc6, 0x05, 0x80, 0x3c, 0x00,
-  0xac, 0x75, 0xfa, 0x80, 0x3c, 0x00, 0x75, 0xba, 0xac, 0x46, 0x46, 0x80,
-  0x3c, 0x00, 0xa4, 0x75, 0xfa, 0x8e, 0xda, 0x8b, 0xf1, 0x89, 0x36, 0x5c,
-  0x04, 0x8c, 0x06, 0x5e, 0x04, 0x8b, 0xdc, 0x8b, 0xc5, 0xa2, 0x46, 0x04,
-  0x20, 0x26, 0x7a, 0x05, 0x89, 0x3e, 0x3e, 0x04, 0xb9, 0xd0, 0x08, 0xbf,
-  0x16, 0x06, 0x2b, 0xcf, 0xb0, 0x00, 0xf3, 0xaa, 0x83, 0x3e, 0x48, 0x04,
-  0x00, 0x75, 0x18, 0xb8, 0x47, 0x07, 0xa3, 0x48, 0x04, 0x8c, 0x0e, 0x4a,
-  0x04, 0xa3, 0x4c, 0x04, 0x8c, 0x0e, 0x4e, 0x04, 0xa3, 0x50, 0x04, 0x8c,
-  0x0e, 0x52, 0x04, 0x33, 0xed, 0xb8, 0x46, 0x07, 0xa3, 0x54, 0x04, 0x8c,
-  0x0e, 0x56, 0x04, 0xb8, 0xff, 0x00, 0xe8, 0xff, 0x04, 0xe8, 0xdc, 0x05,
-  0x50, 0xba, 0x09, 0x03, 0x8e, 0xda, 0xfc, 0x8d, 0x3e, 0x00, 0x00, 0x8e,
-  0xc2, 0xb9, 0x10, 0x00, 0xb8, 0x01, 0x01, 0xf3, 0xaf, 0x58, 0x74, 0x3b,
-  0x8b, 0xd8, 0xb8, 0x32, 0x05, 0x8c, 0xca, 0xbc, 0x50, 0x09, 0x53, 0x50,
-  0x52, 0x8c, 0xcf, 0x8e, 0xdf, 0xba, 0x61, 0x05, 0xb8, 0x01, 0x3d, 0xcd,
-  0x21, 0x8b, 0xd8, 0x1f, 0x5a, 0x8b, 0xf2, 0xfc, 0xac, 0x3c, 0x00, 0x75,
-  0xfb, 0x8b, 0xce, 0x2b, 0xca, 0x49, 0xb4, 0x40, 0xcd, 0x21, 0x8e, 0xdf,
-  0xba, 0x65, 0x05, 0xb9, 0x02, 0x00, 0xb4, 0x40, 0xcd, 0x21, 0x58, 0x50,
-  0xb8, 0x00, 0x00, 0xba, 0x0f, 0x00, 0xe8, 0xfe, 0x04, 0x58, 0xb4, 0x4c,
-  0xcd, 0x21, 0x50, 0xb8, 0x09, 0x03, 0x8e, 0xd8, 0x58, 0xc3, 0xcb, 0xcb,
-  0x53, 0x56, 0x89, 0xc3, 0x80, 0x3f, 0x00, 0x74, 0x23, 0x83, 0x3e, 0xc0,
-  0x07, 0x00, 0x74, 0x22, 0x8a, 0x07, 0x30, 0xe4, 0x89, 0xc6, 0x8a, 0x84,
-  0xc3, 0x07, 0x24, 0x01, 0x85, 0xc0, 0x74, 0x12, 0x80, 0x7f, 0x01, 0x00,
-  0x75, 0x0c, 0xb8, 0x02, 0x00, 0x5e, 0x5b, 0xc3, 0xb8, 0x01, 0x00, 0x5e,
-  0x5b, 0xc3, 0x31, 0xc0, 0x5e, 0x5b, 0xc3, 0x53, 0x52, 0x56, 0x89, 0xc3,
-  0x8a, 0x07, 0x30, 0xe4, 0x83, 0x3e, 0xc0, 0x07, 0x00, 0x74, 0x16, 0x89,
-  0xc6, 0x30, 0xf6, 0x8a, 0x94, 0xc3, 0x07, 0x80, 0xe2, 0x01, 0x85, 0xd2,
-  0x74, 0x07, 0x88, 0xc4, 0x8a, 0x57, 0x01, 0x88, 0xd0, 0x5e, 0x5a, 0x5b,
-  0xc3, 0xf6, 0xc4, 0xff, 0x74, 0x0c, 0x81, 0x3e, 0x7c, 0x05, 0xa4, 0x03,
-  0x74, 0x01, 0xc3, 0xe9, 0x9b, 0x08, 0xe9, 0xa6, 0x08, 0x53, 0x56, 0x89,
-  0xc3, 0x83, 0x3e, 0xc0, 0x07, 0x00, 0x74, 0x1e, 0x8a, 0x07, 0x30, 0xe4,
-  0x89, 0xc6, 0x8a, 0x84, 0xc3, 0x07, 0x24, 0x01, 0x85, 0xc0, 0x74, 0x0e,
-  0x80, 0x7f, 0x01, 0x00, 0x74, 0x08, 0x83, 0xc3, 0x02, 0x89, 0xd8, 0x5e,
-  0x5b, 0xc3, 0x43, 0xeb, 0xf8, 0x53, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02,
-  0x89, 0xd3, 0x8d, 0x56, 0xfe, 0xe8, 0x79, 0x08, 0x85, 0xc0, 0x75, 0x12,
-  0xf6, 0x46, 0xfe, 0x01, 0x74, 0x05, 0x83, 0xfb, 0x02, 0x74, 0x0c, 0x31,
-  0xc0, 0x89, 0xec, 0x5d, 0x5b, 0xc3, 0xb8, 0xff, 0xff, 0xeb, 0xf6, 0xb8,
-  0x00, 0x06, 0xe8, 0x79, 0x08, 0xeb, 0xee, 0x53, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x81, 0xec, 0x90, 0x00, 0x50, 0x81, 0xed, 0x0c, 0x01, 0x89,
-  0xd3, 0x8d, 0x76, 0x7f, 0x30, 0xd2, 0xb4, 0x47, 0xcd, 0x21, 0xe8, 0xb3,
-  0x08, 0x85, 0xc0, 0x75, 0x45, 0xb4, 0x19, 0xcd, 0x21, 0xc7, 0x46, 0x7d,
-  0x3a, 0x5c, 0x04, 0x41, 0x8d, 0x7e, 0x7c, 0x88, 0x46, 0x7c, 0x8c, 0xd8,
-  0x8e, 0xc0, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49,
-  0x89, 0xca, 0x42, 0x83, 0x7e, 0x7a, 0x00, 0x75, 0x12, 0x39, 0xd3, 0x76,
-  0x2b, 0x89, 0xd8, 0xe8, 0x8a, 0x08, 0x89, 0x46, 0x7a, 0x85, 0xc0, 0x74,
-  0x23, 0x89, 0xd3, 0x8d, 0x56, 0x7c, 0x8b, 0x46, 0x7a, 0xe8, 0xf0, 0x02,
-  0xeb, 0x08, 0xb8, 0x01, 0x00, 0xe8, 0x8b, 0x00, 0x31, 0xc0, 0x8d, 0xa6,
-  0x0c, 0x01, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x89, 0xd0, 0xeb, 0xd3,
-  0xb8, 0x05, 0x00, 0xeb, 0xe8, 0x51, 0x57, 0x89, 0xc7, 0x8c, 0xd8, 0x8e,
-  0xc0, 0xb9, 0xff, 0xff, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x89,
-  0xc8, 0x5f, 0x59, 0xc3, 0x51, 0x56, 0x57, 0x89, 0xd6, 0x89, 0xda, 0x85,
-  0xdb, 0x75, 0x04, 0x5f, 0x5e, 0x59, 0xc3, 0x8c, 0xdb, 0x89, 0xc7, 0x8e,
-  0xc3, 0x57, 0xb9, 0xff, 0xff, 0x31, 0xc0, 0xf2, 0xae, 0x4f, 0x89, 0xd1,
-  0xac, 0xaa, 0x84, 0xc0, 0xe0, 0xfa, 0x74, 0x03, 0x26, 0x88, 0x25, 0x58,
-  0xeb, 0xdd, 0x51, 0x56, 0x57, 0x89, 0xd6, 0x89, 0xc7, 0x1e, 0x07, 0x57,
-  0xb9, 0xff, 0xff, 0xb0, 0x00, 0xf2, 0xae, 0x4f, 0x8a, 0x04, 0x88, 0x05,
-  0x3c, 0x00, 0x74, 0x10, 0x8a, 0x44, 0x01, 0x83, 0xc6, 0x02, 0x88, 0x45,
-  0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00, 0x75, 0xe8, 0x5f, 0x89, 0xf8, 0x5f,
-  0x5e, 0x59, 0xc3, 0x53, 0x52, 0x89, 0xc2, 0xe8, 0xb4, 0xfa, 0x89, 0xc3,
-  0x89, 0x17, 0x5a, 0x5b, 0xc3, 0x53, 0xe8, 0xa9, 0xfa, 0x89, 0xc3, 0xc7,
-  0x07, 0x0d, 0x00, 0x5b, 0xc3, 0x53, 0xe8, 0x9d, 0xfa, 0x89, 0xc3, 0xc7,
-  0x07, 0x0e, 0x00, 0x5b, 0xc3, 0x53, 0xe8, 0x91, 0xfa, 0x89, 0xc3, 0xb8,
-  0xff, 0xff, 0xc7, 0x07, 0x09, 0x00, 0x5b, 0xc3, 0x53, 0x52, 0x89, 0xc2,
-  0xe8, 0x83, 0xfa, 0xeb, 0xc9, 0x00, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x81, 0xec, 0x9a, 0x00, 0x81, 0xed, 0x80, 0x00, 0x89, 0xc6, 0x89, 0x56,
-  0x76, 0x89, 0xd9, 0xe8, 0xe2, 0x0a, 0x89, 0xc2, 0x3d, 0xff, 0xff, 0x74,
-  0x03, 0xe9, 0xd4, 0x00, 0xe8, 0x57, 0xfa, 0x89, 0xc7, 0x83, 0x3d, 0x01,
-  0x74, 0x0a, 0xe8, 0x4d, 0xfa, 0x89, 0xc7, 0x83, 0x3d, 0x09, 0x75, 0xe9,
-  0x8a, 0x04, 0x3c, 0x5c, 0x74, 0xe3, 0x84, 0xc0, 0x74, 0xdf, 0x80, 0x7c,
-  0x01, 0x3a, 0x74, 0xd9, 0xb8, 0x80, 0x03, 0xe8, 0x4f, 0xf7, 0x89, 0xc7,
-  0x85, 0xc0, 0x74, 0xcd, 0x89, 0xf0, 0xe8, 0xf4, 0xfe, 0x40, 0x89, 0x46,
-  0x7a, 0xb8, 0x90, 0x00, 0x2b, 0x46, 0x7a, 0x89, 0x46, 0x78, 0x80, 0x3d,
-  0x00, 0x74, 0xb6, 0xba, 0x3b, 0x00, 0x89, 0xf8, 0xe8, 0x65, 0x0c, 0x89,
-  0x46, 0x7e, 0x85, 0xc0, 0x75, 0x0c, 0x89, 0xf8, 0x89, 0xfb, 0xe8, 0xcc,
-  0xfe, 0x01, 0xc3, 0x89, 0x5e, 0x7e, 0x8b, 0x5e, 0x7e, 0x29, 0xfb, 0x89,
-  0x5e, 0x7c, 0x3b, 0x5e, 0x78, 0x76, 0x11, 0xb8, 0x02, 0x00, 0xe8, 0x2a,
-  0xff, 0xb8, 0x0a, 0x00, 0xe8, 0x59, 0xff, 0xb8, 0xff, 0xff, 0xeb, 0x56,
-  0x89, 0xfa, 0x8d, 0x7e, 0xe6, 0x8d, 0x46, 0xe6, 0x03, 0x7e, 0x7c, 0xe8,
-  0x3f, 0x0c, 0x80, 0x7d, 0xff, 0x5c, 0x74, 0x04, 0xc6, 0x05, 0x5c, 0x47,
-  0x8b, 0x5e, 0x7a, 0x89, 0xf2, 0x89, 0xf8, 0xe8, 0x2b, 0x0c, 0x8b, 0x56,
-  0x76, 0x8d, 0x46, 0xe6, 0x89, 0xcb, 0xe8, 0x2b, 0x0a, 0x89, 0xc2, 0x3d,
-  0xff, 0xff, 0x75, 0x20, 0xe8, 0xa3, 0xf9, 0x89, 0xc7, 0x83, 0x3d, 0x01,
-  0x74, 0x0a, 0xe8, 0x99, 0xf9, 0x89, 0xc7, 0x83, 0x3d, 0x09, 0x75, 0x0c,
-  0x8b, 0x7e, 0x7e, 0x80, 0x3d, 0x3b, 0x75, 0x04, 0x47, 0xe9, 0x6e, 0xff,
-  0x89, 0xd0, 0x8d, 0xa6, 0x80, 0x00, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x53,
-  0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc6, 0x89,
-  0xd3, 0x8b, 0x7f, 0x04, 0x83, 0x7d, 0x04, 0x00, 0x74, 0x4c, 0x31, 0xff,
-  0xf6, 0x47, 0x07, 0x04, 0x75, 0x4b, 0x89, 0x76, 0xfe, 0x31, 0xc9, 0x8a,
-  0x04, 0x30, 0xe4, 0x85, 0xc0, 0x74, 0x0d, 0x89, 0xda, 0x46, 0xe8, 0x45,
-  0x00, 0x3d, 0xff, 0xff, 0x75, 0xed, 0x89, 0xc1, 0x85, 0xff, 0x74, 0x13,
-  0x80, 0x67, 0x07, 0xf9, 0x80, 0x4f, 0x07, 0x04, 0x85, 0xc9, 0x75, 0x07,
-  0x89, 0xd8, 0xe8, 0x8c, 0x0c, 0x89, 0xc1, 0x85, 0xc9, 0x75, 0x05, 0x89,
-  0xf1, 0x2b, 0x4e, 0xfe, 0x89, 0xc8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59,
-  0x5b, 0xc3, 0x89, 0xd0, 0xe8, 0x5b, 0x0d, 0xeb, 0xad, 0x80, 0x67, 0x07,
-  0xf9, 0xbf, 0x01, 0x00, 0x80, 0x4f, 0x07, 0x02, 0xeb, 0xa8, 0x53, 0x51,
-  0x56, 0x57, 0x89, 0xc1, 0x89, 0xd3, 0x8b, 0x77, 0x04, 0x8b, 0x44, 0x06,
-  0x3d, 0x01, 0x00, 0x74, 0x0c, 0x85, 0xc0, 0x74, 0x03, 0xe9, 0x6f, 0x00,
-  0xc7, 0x44, 0x06, 0x01, 0x00, 0xf6, 0x47, 0x06, 0x02, 0x75, 0x03, 0xe9,
-  0x69, 0x00, 0x8b, 0x77, 0x04, 0x83, 0x7c, 0x04, 0x00, 0x75, 0x05, 0x89,
-  0xd8, 0xe8, 0x16, 0x0d, 0xbe, 0x00, 0x04, 0x83, 0xf9, 0x0a, 0x75, 0x28,
-  0xbe, 0x00, 0x06, 0xf6, 0x47, 0x06, 0x40, 0x75, 0x1f, 0x8b, 0x3f, 0x80,
-  0x4f, 0x07, 0x10, 0xc6, 0x05, 0x0d, 0xff, 0x07, 0xff, 0x47, 0x02, 0x8b,
-  0x47, 0x02, 0x3b, 0x47, 0x0a, 0x75, 0x09, 0x89, 0xd8, 0xe8, 0x01, 0x0c,
-  0x85, 0xc0, 0x75, 0x23, 0x8b, 0x3f, 0x80, 0x4f, 0x07, 0x10, 0x88, 0x0d,
-  0xff, 0x07, 0xff, 0x47, 0x02, 0x85, 0x77, 0x06, 0x75, 0x08, 0x8b, 0x47,
-  0x02, 0x3b, 0x47, 0x0a, 0x75, 0x20, 0x89, 0xd8, 0xe8, 0xde, 0x0b, 0x85,
-  0xc0, 0x74, 0x17, 0xb8, 0xff, 0xff, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0xb8,
-  0x04, 0x00, 0xe8, 0xb2, 0xfd, 0xb8, 0xff, 0xff, 0x80, 0x4f, 0x06, 0x20,
-  0xeb, 0xec, 0x88, 0xc8, 0x30, 0xe4, 0xeb, 0xe6, 0x51, 0x56, 0x57, 0x89,
-  0xd6, 0x85, 0xdb, 0x75, 0x04, 0x5f, 0x5e, 0x59, 0xc3, 0x8c, 0xda, 0x89,
-  0xd9, 0x89, 0xc7, 0x8e, 0xc2, 0x57, 0xac, 0xaa, 0x84, 0xc0, 0xe0, 0xfa,
-  0x31, 0xc0, 0xd1, 0xe9, 0xf3, 0xab, 0x11, 0xc9, 0xf3, 0xaa, 0x58, 0xeb,
-  0xe0, 0x53, 0x52, 0x55, 0x89, 0xe5, 0x89, 0xc3, 0x83, 0x3f, 0x00, 0x75,
-  0x06, 0x89, 0xec, 0x5d, 0x5a, 0x5b, 0xc3, 0x1e, 0xff, 0x17, 0x1f, 0xeb,
-  0xf4, 0x53, 0x55, 0x89, 0xe5, 0x89, 0xc3, 0x8e, 0xc2, 0x26, 0x8b, 0x47,
-  0x02, 0x26, 0x8b, 0x17, 0x85, 0xc0, 0x75, 0x09, 0x85, 0xd2, 0x75, 0x05,
-  0x89, 0xec, 0x5d, 0x5b, 0xc3, 0x1e, 0x26, 0xff, 0x1f, 0x1f, 0xeb, 0xf4,
-  0xe8, 0x01, 0x00, 0xcb, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x89, 0xc1, 0x1e, 0xe8, 0x58, 0xfb, 0xbf, 0xfe, 0x05, 0xbb, 0xda, 0x05,
-  0x89, 0xfe, 0x88, 0xc8, 0x81, 0xfb, 0xfe, 0x05, 0x73, 0x16, 0x80, 0x3f,
-  0x02, 0x75, 0x05, 0x83, 0xc3, 0x06, 0xeb, 0xf0, 0x3a, 0x47, 0x01, 0x72,
-  0xf6, 0x89, 0xde, 0x8a, 0x47, 0x01, 0xeb, 0xef, 0x81, 0xfe, 0xfe, 0x05,
-  0x74, 0x17, 0x8d, 0x44, 0x02, 0x80, 0x3c, 0x00, 0x75, 0x08, 0xe8, 0x7c,
-  0xff, 0xc6, 0x04, 0x02, 0xeb, 0xc7, 0x8c, 0xda, 0xe8, 0x8a, 0xff, 0xeb,
-  0xf4, 0x1f, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xe8,
-  0x01, 0x00, 0xcb, 0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x89, 0xc1,
-  0x1e, 0x88, 0xcd, 0xe8, 0xf8, 0xfa, 0x88, 0xd1, 0xbf, 0x16, 0x06, 0xbb,
-  0xfe, 0x05, 0x89, 0xfe, 0x88, 0xe8, 0x81, 0xfb, 0x16, 0x06, 0x73, 0x16,
-  0x80, 0x3f, 0x02, 0x75, 0x05, 0x83, 0xc3, 0x06, 0xeb, 0xf0, 0x3a, 0x47,
-  0x01, 0x77, 0xf6, 0x89, 0xde, 0x8a, 0x47, 0x01, 0xeb, 0xef, 0x81, 0xfe,
-  0x16, 0x06, 0x74, 0x1e, 0x3a, 0x4c, 0x01, 0x73, 0x05, 0xc6, 0x04, 0x02,
-  0xeb, 0xcd, 0x8d, 0x44, 0x02, 0x80, 0x3c, 0x00, 0x75, 0x05, 0xe8, 0x10,
-  0xff, 0xeb, 0xee, 0x8c, 0xda, 0xe8, 0x21, 0xff, 0xeb, 0xe7, 0x1f, 0x89,
-  0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0xe9, 0x5d, 0xfa, 0x51, 0x56,
-  0x89, 0xc1, 0x89, 0xd6, 0xe8, 0xdb, 0x0b, 0x85, 0xc0, 0x74, 0x03, 0x5e,
-  0x59, 0xc3, 0x89, 0xc8, 0x89, 0xf2, 0xe8, 0x46, 0xfa, 0x5e, 0x59, 0xc3,
-  0x52, 0x8b, 0x16, 0xc6, 0x08, 0xa1, 0xc4, 0x08, 0xc7, 0x06, 0x9a, 0x05,
-  0x00, 0x20, 0xe8, 0xce, 0xf3, 0xe8, 0xe1, 0xf7, 0x5a, 0xc3, 0xc3, 0x53,
-  0x51, 0x52, 0xb8, 0xac, 0x07, 0xb9, 0xaa, 0x07, 0x8b, 0x1e, 0x58, 0x04,
-  0x8b, 0x16, 0x5c, 0x04, 0x50, 0xa1, 0xc8, 0x08, 0xe8, 0x19, 0x00, 0xa3,
-  0xbc, 0x07, 0xa1, 0xaa, 0x07, 0xa3, 0xae, 0x07, 0xa3, 0xc4, 0x08, 0xa1,
-  0xac, 0x07, 0xa3, 0xb0, 0x07, 0xa3, 0xc6, 0x08, 0x5a, 0x59, 0x5b, 0xc3,
-  0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x06, 0x50, 0x52, 0x89, 0xde,
-  0x89, 0x4e, 0xf8, 0x8d, 0x4e, 0xf6, 0x89, 0xf2, 0x31, 0xdb, 0xe8, 0x71,
-  0x00, 0x8b, 0x56, 0xf6, 0x40, 0x29, 0xf2, 0xd1, 0xe0, 0x89, 0xd1, 0x83,
-  0xc2, 0x02, 0x05, 0x02, 0x00, 0x80, 0xe2, 0xfe, 0x01, 0xd0, 0x31, 0xff,
-  0x40, 0x41, 0x24, 0xfe, 0x89, 0xd3, 0xe8, 0xbf, 0x03, 0x89, 0xc2, 0x89,
-  0x46, 0xfa, 0x31, 0xc0, 0x85, 0xd2, 0x75, 0x16, 0x8b, 0x5e, 0xf8, 0x89,
-  0x07, 0x8b, 0x5e, 0x04, 0x8b, 0x46, 0xfa, 0x89, 0x3f, 0x8d, 0x66, 0xfc,
-  0x5f, 0x5e, 0x5d, 0xc2, 0x02, 0x00, 0x89, 0xd7, 0x57, 0x8c, 0xd8, 0x8e,
-  0xc0, 0xd1, 0xe9, 0xf3, 0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x8b, 0x46,
-  0xf2, 0x01, 0xdf, 0x8d, 0x4e, 0xf6, 0x8d, 0x5d, 0x02, 0x89, 0x05, 0x8b,
-  0x46, 0xf4, 0xe8, 0x0d, 0x00, 0x40, 0x89, 0xc3, 0xd1, 0xe3, 0x01, 0xfb,
-  0xc7, 0x07, 0x00, 0x00, 0xeb, 0xba, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83,
-  0xec, 0x04, 0x50, 0x89, 0xd6, 0x89, 0x4e, 0xfe, 0x89, 0xda, 0x31, 0xc9,
-  0x8a, 0x04, 0x3c, 0x20, 0x75, 0x03, 0x46, 0xeb, 0xf7, 0x3c, 0x09, 0x74,
-  0xf9, 0x84, 0xc0, 0x74, 0x49, 0x30, 0xc0, 0x80, 0x3c, 0x22, 0x74, 0x19,
-  0x89, 0x76, 0xfc, 0x89, 0xf3, 0x80, 0x3c, 0x22, 0x75, 0x3b, 0x83, 0x7e,
-  0xfa, 0x00, 0x75, 0x12, 0x46, 0x84, 0xc0, 0x75, 0x09, 0xb0, 0x02, 0xeb,
-  0xec, 0xb0, 0x01, 0x46, 0xeb, 0xe2, 0x30, 0xc0, 0xeb, 0xe3, 0x3c, 0x01,
-  0x75, 0x1f, 0x85, 0xd2, 0x74, 0x58, 0x89, 0xcf, 0xd1, 0xe7, 0x01, 0xd7,
-  0x8b, 0x46, 0xfc, 0x89, 0x05, 0x8a, 0x04, 0x41, 0x84, 0xc0, 0x74, 0x48,
-  0x46, 0xc6, 0x07, 0x00, 0xeb, 0xa6, 0xe9, 0x56, 0x00, 0x80, 0x3c, 0x20,
-  0x75, 0x28, 0x84, 0xc0, 0x74, 0xd8, 0x80, 0x3c, 0x00, 0x74, 0xd3, 0x80,
-  0x3c, 0x5c, 0x75, 0x13, 0x83, 0x7e, 0xfa, 0x00, 0x75, 0x1b, 0x80, 0x7c,
-  0x01, 0x22, 0x75, 0x07, 0x46, 0x80, 0x7c, 0xfe, 0x5c, 0x74, 0x9a, 0x85,
-  0xd2, 0x75, 0x23, 0x46, 0xeb, 0x93, 0x80, 0x3c, 0x09, 0x74, 0xd3, 0xeb,
-  0xd5, 0x80, 0x7c, 0x01, 0x22, 0x75, 0x07, 0x46, 0xeb, 0xe9, 0xeb, 0x24,
-  0xeb, 0x13, 0x80, 0x7c, 0x01, 0x5c, 0x75, 0xdf, 0x3c, 0x01, 0x74, 0xef,
-  0xeb, 0xd9, 0x8a, 0x24, 0x88, 0x27, 0x43, 0xeb, 0xd6, 0x88, 0x07, 0x8b,
-  0x5e, 0xfe, 0x89, 0xc8, 0x89, 0x37, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc3,
-  0x41, 0x80, 0x3c, 0x00, 0x74, 0xed, 0xe9, 0x3d, 0xff, 0xa1, 0xbc, 0x07,
-  0x85, 0xc0, 0x75, 0x01, 0xc3, 0xe9, 0x2e, 0x0a, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x83, 0x3e, 0xb4, 0x07, 0x00,
-  0x75, 0x3a, 0xbb, 0x2c, 0x00, 0x8e, 0x06, 0x38, 0x04, 0x31, 0xf6, 0x26,
-  0x8b, 0x07, 0x31, 0xd2, 0x89, 0x46, 0xfe, 0x8e, 0xc0, 0x31, 0xdb, 0x30,
-  0xc0, 0x26, 0x3a, 0x07, 0x74, 0x0a, 0x43, 0x26, 0x3a, 0x07, 0x75, 0xfa,
-  0x42, 0x43, 0xeb, 0xf1, 0x89, 0xd8, 0x29, 0xf0, 0x75, 0x03, 0xb8, 0x01,
-  0x00, 0xe8, 0x44, 0x02, 0x89, 0xc1, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0x09,
-  0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x89, 0xd0, 0xd1,
-  0xe0, 0x05, 0x02, 0x00, 0x01, 0xd0, 0xe8, 0x27, 0x02, 0x89, 0xc7, 0x85,
-  0xc0, 0x74, 0x39, 0xa3, 0xb4, 0x07, 0x8e, 0x46, 0xfe, 0x89, 0x0e, 0xbe,
-  0x07, 0x30, 0xc9, 0x8d, 0x45, 0x02, 0x26, 0x3a, 0x0c, 0x75, 0x14, 0xa3,
-  0xb2, 0x07, 0xc7, 0x05, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xd2, 0x74, 0xc4,
-  0x4a, 0xc6, 0x05, 0x00, 0x47, 0xeb, 0xf5, 0x89, 0x1d, 0x89, 0xc7, 0x26,
-  0x8a, 0x04, 0x46, 0x88, 0x07, 0x43, 0x84, 0xc0, 0x75, 0xf5, 0xeb, 0xd3,
-  0x89, 0xc8, 0xe8, 0x89, 0x09, 0xeb, 0xa5, 0xe8, 0x45, 0x0a, 0xa1, 0xb4,
-  0x07, 0x85, 0xc0, 0x75, 0x08, 0xa1, 0xbe, 0x07, 0x85, 0xc0, 0x75, 0x0b,
-  0xc3, 0xe8, 0x72, 0x09, 0x31, 0xc0, 0xa3, 0xb4, 0x07, 0xeb, 0xee, 0xe8,
-  0x68, 0x09, 0x31, 0xc0, 0xa3, 0xbe, 0x07, 0xc3, 0x53, 0x89, 0xc3, 0x8a,
-  0x9f, 0xc3, 0x07, 0x80, 0xe3, 0x01, 0x30, 0xe7, 0x89, 0xd8, 0x5b, 0xc3,
-  0x31, 0xc0, 0xe9, 0x34, 0x00, 0x51, 0x57, 0x89, 0xc7, 0x89, 0xd1, 0x81,
-  0xc7, 0xc2, 0x07, 0x29, 0xc1, 0xb0, 0x01, 0x41, 0x47, 0x57, 0x1e, 0x07,
-  0xf3, 0xaa, 0x5f, 0x5f, 0x59, 0xc3, 0x51, 0x57, 0xb9, 0x01, 0x01, 0x31,
-  0xc0, 0xbf, 0xc2, 0x07, 0xa3, 0xc0, 0x07, 0xa3, 0x7c, 0x05, 0x30, 0xc0,
-  0x57, 0x1e, 0x07, 0xf3, 0xaa, 0x5f, 0x5f, 0x59, 0xc3, 0x53, 0x51, 0x52,
-  0x56, 0x57, 0x3d, 0xff, 0xff, 0x74, 0x43, 0x3d, 0xfe, 0xff, 0x74, 0x3e,
-  0x3d, 0xfd, 0xff, 0x75, 0x06, 0xe8, 0xce, 0xff, 0xe9, 0xae, 0x00, 0x3d,
-  0xfc, 0xff, 0x75, 0x24, 0xe8, 0xc3, 0xff, 0xba, 0x9f, 0x00, 0xb8, 0x81,
-  0x00, 0xe8, 0xa1, 0xff, 0xba, 0xfc, 0x00, 0xb8, 0xe0, 0x00, 0xe8, 0x98,
-  0xff, 0xc7, 0x06, 0xc0, 0x07, 0x01, 0x00, 0xc7, 0x06, 0x7c, 0x05, 0xa4,
-  0x03, 0xe9, 0x85, 0x00, 0x85, 0xc0, 0x74, 0x06, 0xb8, 0x01, 0x00, 0xe9,
-  0x7d, 0x00, 0x1e, 0x33, 0xc0, 0x8e, 0xd8, 0xb4, 0x63, 0xcd, 0x21, 0x8c,
-  0xdf, 0x73, 0x02, 0x33, 0xff, 0x85, 0xff, 0x75, 0x02, 0x8b, 0xf7, 0x1f,
-  0x89, 0xf3, 0x89, 0xfa, 0x85, 0xff, 0x75, 0x04, 0x85, 0xf6, 0x74, 0x59,
-  0xe8, 0x73, 0xff, 0x8e, 0xc7, 0x26, 0x83, 0x3c, 0x00, 0x74, 0x06, 0xc7,
-  0x06, 0xc0, 0x07, 0x01, 0x00, 0x89, 0xd6, 0x8e, 0xc6, 0x26, 0x83, 0x3f,
-  0x00, 0x74, 0x12, 0x26, 0x8a, 0x57, 0x01, 0x26, 0x8a, 0x07, 0x30, 0xf6,
-  0x30, 0xe4, 0xe8, 0x34, 0xff, 0x43, 0x43, 0xeb, 0xe6, 0x1e, 0x55, 0x8b,
-  0xec, 0x83, 0xec, 0x08, 0x33, 0xc0, 0x8e, 0xd8, 0xb8, 0x01, 0x65, 0xbb,
-  0xff, 0xff, 0xb9, 0x07, 0x00, 0xba, 0xff, 0xff, 0x8d, 0x7e, 0xf8, 0x16,
-  0x07, 0xcd, 0x21, 0x8b, 0x46, 0xfd, 0x73, 0x02, 0x33, 0xc0, 0x8b, 0xe5,
-  0x5d, 0x1f, 0xa3, 0x7c, 0x05, 0x31, 0xc0, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x3d, 0x81, 0x82, 0x72, 0x08, 0x3d, 0x9a, 0x82, 0x77, 0x03, 0x2d,
-  0x21, 0x00, 0xc3, 0x3d, 0x61, 0x00, 0x7c, 0x08, 0x3d, 0x7a, 0x00, 0x7f,
-  0x03, 0x2d, 0x20, 0x00, 0xc3, 0x53, 0x51, 0x89, 0xd3, 0x89, 0xc2, 0xb8,
-  0x00, 0x43, 0xcd, 0x21, 0x72, 0x02, 0x89, 0x0f, 0xe8, 0x69, 0x00, 0x59,
-  0x5b, 0xc3, 0x85, 0xd2, 0x75, 0x08, 0xc3, 0x85, 0xd2, 0x75, 0x03, 0x31,
-  0xc0, 0xc3, 0x53, 0x52, 0x89, 0xc3, 0x88, 0xc2, 0x30, 0xe4, 0xe8, 0xab,
-  0xf8, 0x81, 0xfb, 0x00, 0x01, 0x73, 0x39, 0x80, 0x3e, 0x3a, 0x04, 0x03,
-  0x72, 0x2b, 0x80, 0xfb, 0x50, 0x75, 0x04, 0xb2, 0x0e, 0xeb, 0x07, 0x80,
-  0xfb, 0x22, 0x72, 0x14, 0xb2, 0x13, 0x88, 0xd3, 0x30, 0xff, 0x8a, 0x87,
-  0x7e, 0x05, 0x98, 0xe8, 0x4d, 0xf8, 0xb8, 0xff, 0xff, 0x5a, 0x5b, 0xc3,
-  0x80, 0xfb, 0x20, 0x72, 0x04, 0xb2, 0x05, 0xeb, 0xe5, 0x80, 0xfa, 0x13,
-  0x76, 0xe0, 0xeb, 0xdc, 0x88, 0xf8, 0x30, 0xe4, 0xeb, 0xe1, 0x52, 0x89,
-  0xc2, 0xe8, 0xaa, 0xff, 0x89, 0xd0, 0x5a, 0xc3, 0x73, 0x07, 0x50, 0xe8,
-  0xa0, 0xff, 0x58, 0xeb, 0x02, 0x2b, 0xc0, 0xc3, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc7, 0x85, 0xc0, 0x74,
-  0x42, 0x3d, 0xea, 0xff, 0x77, 0x3d, 0x05, 0x03, 0x00, 0x24, 0xfe, 0x89,
-  0x46, 0xfc, 0x3d, 0x06, 0x00, 0x72, 0x3b, 0xc6, 0x46, 0xfe, 0x00, 0x31,
-  0xd2, 0x8b, 0x46, 0xfc, 0x3b, 0x06, 0x96, 0x05, 0x76, 0x3d, 0x8b, 0x36,
-  0x94, 0x05, 0x85, 0xf6, 0x74, 0x2b, 0x85, 0xf6, 0x75, 0x3c, 0x80, 0x7e,
-  0xfe, 0x00, 0x74, 0x61, 0x89, 0xf8, 0xe8, 0x8d, 0x08, 0x85, 0xc0, 0x74,
-  0x68, 0xc6, 0x46, 0xfe, 0x00, 0xeb, 0xd6, 0x31, 0xc0, 0x89, 0xec, 0x5d,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xc7, 0x46, 0xfc, 0x06, 0x00, 0xeb,
-  0xbe, 0x89, 0x36, 0x96, 0x05, 0x8b, 0x36, 0x92, 0x05, 0xeb, 0xcb, 0x31,
-  0xc0, 0x8b, 0x36, 0x92, 0x05, 0xa3, 0x96, 0x05, 0xeb, 0xc0, 0x8b, 0x4c,
-  0x0a, 0x89, 0x36, 0x94, 0x05, 0x39, 0xf9, 0x72, 0x0f, 0x8c, 0xda, 0x89,
-  0xf3, 0x89, 0xf8, 0xe8, 0x5a, 0x08, 0x89, 0xc2, 0x85, 0xc0, 0x75, 0x21,
-  0x3b, 0x0e, 0x96, 0x05, 0x77, 0x05, 0x8b, 0x74, 0x04, 0xeb, 0x9b, 0x89,
-  0x0e, 0x96, 0x05, 0xeb, 0xf5, 0x89, 0xf8, 0xe8, 0x38, 0x0b, 0x85, 0xc0,
-  0x74, 0x96, 0xc6, 0x46, 0xfe, 0x01, 0xe9, 0x74, 0xff, 0x89, 0xd0, 0xeb,
-  0x9c, 0xb8, 0x20, 0x00, 0xe8, 0x02, 0x0c, 0x53, 0x51, 0x52, 0x55, 0x89,
-  0xe5, 0x83, 0xec, 0x16, 0x8d, 0x4e, 0xf8, 0x8d, 0x5e, 0xea, 0x8d, 0x56,
-  0xea, 0xb8, 0x21, 0x00, 0xc6, 0x46, 0xeb, 0x52, 0xe8, 0x18, 0x0c, 0x8b,
-  0x5e, 0xec, 0x31, 0xd2, 0x4b, 0x4b, 0x8b, 0x46, 0xf8, 0x01, 0xd3, 0x11,
-  0xd0, 0x8e, 0xc0, 0x26, 0x8b, 0x07, 0x40, 0x89, 0xec, 0x5d, 0x5a, 0x59,
-  0x5b, 0xc3, 0x50, 0xb8, 0x06, 0x00, 0xe8, 0xc4, 0x0b, 0x58, 0x53, 0x52,
-  0x89, 0xc3, 0xb4, 0x48, 0xcd, 0x21, 0x19, 0xdb, 0x89, 0xc2, 0x85, 0xdb,
-  0x7d, 0x04, 0x31, 0xc2, 0xeb, 0x11, 0x8e, 0xc0, 0x31, 0xdb, 0x4b, 0xb4,
-  0x4a, 0xcd, 0x21, 0x8e, 0xc2, 0xb4, 0x4a, 0xcd, 0x21, 0x19, 0xdb, 0x89,
-  0xd0, 0x5a, 0x5b, 0xc3, 0x50, 0xb8, 0x06, 0x00, 0xe8, 0x92, 0x0b, 0x58,
-  0x53, 0x51, 0x89, 0xc1, 0x49, 0x31, 0xdb, 0x8e, 0xc1, 0x26, 0x8b, 0x4f,
-  0x03, 0x89, 0xd3, 0x43, 0x39, 0xd9, 0x73, 0x05, 0x31, 0xc0, 0x59, 0x5b,
-  0xc3, 0x29, 0xd9, 0x8e, 0xc0, 0x89, 0xcb, 0xb4, 0x4a, 0xcd, 0x21, 0x19,
-  0xdb, 0x89, 0xd0, 0xe8, 0x9c, 0xff, 0x59, 0x5b, 0xc3, 0x50, 0xb8, 0x12,
-  0x00, 0xe8, 0x5d, 0x0b, 0x58, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x50,
-  0x50, 0x52, 0x89, 0xdf, 0x31, 0xf6, 0x31, 0xc9, 0x89, 0x76, 0xfe, 0xb8,
-  0x01, 0x00, 0xe8, 0x79, 0xff, 0x85, 0xc0, 0x74, 0x0b, 0x8e, 0xc0, 0x31,
-  0xdb, 0x26, 0x89, 0x0f, 0x89, 0xc1, 0xeb, 0xeb, 0x80, 0x3e, 0x3a, 0x04,
-  0x02, 0x75, 0x13, 0x85, 0xc9, 0x74, 0x5d, 0xba, 0x81, 0x02, 0x89, 0xc8,
-  0xe8, 0x89, 0xff, 0x89, 0x46, 0xfe, 0x85, 0xc0, 0x74, 0x4e, 0x89, 0xcb,
-  0x85, 0xdb, 0x74, 0x16, 0x89, 0xfa, 0x89, 0xd8, 0xe8, 0x75, 0xff, 0x89,
-  0xc6, 0x85, 0xc0, 0x75, 0x09, 0x8e, 0xc3, 0x89, 0xc3, 0x26, 0x8b, 0x1f,
-  0xeb, 0xe6, 0x85, 0xf6, 0x74, 0x2e, 0xa1, 0x38, 0x04, 0x39, 0xf0, 0x73,
-  0x2a, 0x89, 0xc2, 0x4a, 0x31, 0xdb, 0x8e, 0xc2, 0x26, 0x8b, 0x57, 0x01,
-  0x3b, 0x16, 0x38, 0x04, 0x75, 0x19, 0x26, 0x03, 0x47, 0x03, 0x26, 0x80,
-  0x3f, 0x4d, 0x74, 0x09, 0x29, 0xd0, 0x3b, 0x46, 0xfc, 0x73, 0x08, 0xeb,
-  0x03, 0x40, 0xeb, 0xd5, 0xe9, 0xa3, 0x00, 0xb1, 0x04, 0x8b, 0x46, 0xfa,
-  0x8e, 0x06, 0x38, 0x04, 0x31, 0xdb, 0x31, 0xd2, 0xd3, 0xe7, 0x26, 0x89,
-  0x77, 0x2c, 0x57, 0x89, 0xf3, 0x31, 0xc9, 0xe8, 0x83, 0x0b, 0xff, 0x16,
-  0x32, 0x04, 0xe8, 0xa0, 0xfe, 0x89, 0xc1, 0x49, 0x31, 0xdb, 0x8e, 0xc1,
-  0x26, 0x8b, 0x57, 0x01, 0x3b, 0x16, 0x38, 0x04, 0x75, 0x08, 0x39, 0xd0,
-  0x74, 0x04, 0x39, 0xf0, 0x75, 0x5d, 0x89, 0xc1, 0x49, 0x31, 0xdb, 0x8e,
-  0xc1, 0x26, 0x80, 0x3f, 0x4d, 0x74, 0x49, 0x8b, 0x0e, 0x38, 0x04, 0x8e,
-  0xc1, 0x31, 0xdb, 0x4b, 0xb4, 0x4a, 0xcd, 0x21, 0x8e, 0xc1, 0xb4, 0x4a,
-  0xcd, 0x21, 0x19, 0xdb, 0xa1, 0x38, 0x04, 0x89, 0xc2, 0x4a, 0x31, 0xdb,
-  0x8e, 0xc2, 0x31, 0xf6, 0x26, 0x8b, 0x4f, 0x03, 0x8e, 0xc0, 0x01, 0xc1,
-  0x26, 0x89, 0x4c, 0x02, 0x8e, 0xc2, 0x26, 0x8b, 0x47, 0x03, 0x3b, 0x46,
-  0xfc, 0x73, 0x0c, 0xb8, 0x86, 0x03, 0xe8, 0x33, 0xf0, 0xb0, 0xff, 0xb4,
-  0x4c, 0xcd, 0x21, 0xb8, 0x01, 0x00, 0xeb, 0x44, 0x26, 0x03, 0x47, 0x03,
-  0x40, 0xeb, 0x8a, 0x8e, 0xc0, 0xb4, 0x49, 0xcd, 0x21, 0x19, 0xd2, 0xe9,
-  0x7c, 0xff, 0x8b, 0x46, 0xfe, 0x85, 0xc0, 0x74, 0x08, 0x8e, 0xc0, 0xb4,
-  0x49, 0xcd, 0x21, 0x19, 0xd2, 0x85, 0xf6, 0x74, 0x08, 0x8e, 0xc6, 0xb4,
-  0x49, 0xcd, 0x21, 0x19, 0xd2, 0x85, 0xc9, 0x74, 0x11, 0x8e, 0xc1, 0x31,
-  0xdb, 0x26, 0x8b, 0x1f, 0xb4, 0x49, 0xcd, 0x21, 0x19, 0xd2, 0x89, 0xd9,
-  0xeb, 0xeb, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0xb8,
-  0x10, 0x00, 0xe8, 0xe8, 0x09, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89,
-  0xe5, 0x50, 0x8b, 0x36, 0x38, 0x04, 0x31, 0xdb, 0x8e, 0xc6, 0x26, 0x8b,
-  0x47, 0x36, 0x26, 0x8b, 0x7f, 0x34, 0x39, 0xf0, 0x75, 0x05, 0x83, 0xff,
-  0x18, 0x74, 0x51, 0x89, 0xfe, 0x89, 0x46, 0xfe, 0x8b, 0x0e, 0x38, 0x04,
-  0x8e, 0x46, 0xfe, 0x43, 0x26, 0x8a, 0x14, 0x8e, 0xc1, 0x46, 0x26, 0x88,
-  0x57, 0x17, 0x83, 0xfb, 0x14, 0x7c, 0xe9, 0xbe, 0x14, 0x00, 0x89, 0xc2,
-  0x01, 0xf7, 0xa1, 0x38, 0x04, 0x31, 0xdb, 0x8e, 0xc0, 0x26, 0x3b, 0x77,
-  0x32, 0x73, 0x11, 0x8e, 0xc2, 0x26, 0x80, 0x3d, 0xff, 0x74, 0x05, 0x89,
-  0xf0, 0xe8, 0x7d, 0x0a, 0x47, 0x46, 0xeb, 0xe2, 0x26, 0xc7, 0x47, 0x32,
-  0x14, 0x00, 0x26, 0xc7, 0x47, 0x34, 0x18, 0x00, 0x26, 0x89, 0x47, 0x36,
-  0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xe9, 0x9e, 0xfd, 0x50, 0xb8, 0x16, 0x01,
-  0xe8, 0x66, 0x09, 0x58, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x81, 0xec,
-  0xf8, 0x00, 0x50, 0x52, 0x53, 0x81, 0xed, 0x80, 0x00, 0xbb, 0x4b, 0x00,
-  0x89, 0xc2, 0x8d, 0x46, 0x08, 0xe8, 0x00, 0xf7, 0xba, 0x5c, 0x00, 0x8d,
-  0x46, 0x08, 0xe8, 0x37, 0x0a, 0xba, 0x2e, 0x00, 0x85, 0xc0, 0x75, 0x03,
-  0x8d, 0x46, 0x08, 0xe8, 0xa2, 0x01, 0x85, 0xc0, 0x75, 0x30, 0xba, 0xa2,
-  0x03, 0x8d, 0x46, 0x08, 0xe8, 0x4f, 0xf4, 0x31, 0xc0, 0x50, 0xb8, 0x00,
-  0x02, 0x50, 0x8d, 0x46, 0x08, 0x50, 0xe8, 0xd6, 0x0b, 0x83, 0xc4, 0x06,
-  0x89, 0xc6, 0x3d, 0xff, 0xff, 0x75, 0x2f, 0xba, 0x2e, 0x00, 0x8d, 0x46,
-  0x08, 0xe8, 0xfc, 0x09, 0xba, 0xa7, 0x03, 0xe8, 0x01, 0x0c, 0x31, 0xc0,
-  0x50, 0xb8, 0x00, 0x02, 0x50, 0x8d, 0x46, 0x08, 0x50, 0xe8, 0xaf, 0x0b,
-  0x89, 0xc3, 0x83, 0xc4, 0x06, 0x89, 0xc6, 0xb8, 0x01, 0x00, 0xe8, 0x3e,
-  0xf4, 0x83, 0xfb, 0xff, 0x74, 0x21, 0xbb, 0x1c, 0x00, 0x8d, 0x56, 0x58,
-  0x89, 0xf0, 0xe8, 0x15, 0x0c, 0x3d, 0xff, 0xff, 0x75, 0x14, 0x89, 0xf0,
-  0xe8, 0xbe, 0x09, 0xb8, 0x03, 0x00, 0xe8, 0x1e, 0xf4, 0xb8, 0x0b, 0x00,
-  0xe8, 0x4d, 0xf4, 0xe9, 0x13, 0x01, 0x8b, 0x46, 0x58, 0x3d, 0x4d, 0x5a,
-  0x74, 0x05, 0x3d, 0x5a, 0x4d, 0x75, 0x05, 0xba, 0x01, 0x00, 0xeb, 0x02,
-  0x31, 0xd2, 0x89, 0x56, 0x7c, 0x85, 0xd2, 0x74, 0x1e, 0xb1, 0x05, 0x8b,
-  0x46, 0x5a, 0x8b, 0x56, 0x5c, 0x05, 0x0f, 0x00, 0xd3, 0xe2, 0xb1, 0x04,
-  0x83, 0xea, 0x20, 0xd3, 0xe8, 0x01, 0xd0, 0x03, 0x46, 0x62, 0x2b, 0x46,
-  0x60, 0xeb, 0x1a, 0xba, 0x02, 0x00, 0x89, 0xf0, 0x31, 0xdb, 0x31, 0xc9,
-  0xe8, 0x81, 0x0c, 0xbb, 0x10, 0x00, 0x05, 0x8f, 0x00, 0x83, 0xd2, 0x00,
-  0x31, 0xc9, 0xe8, 0xab, 0x0c, 0x89, 0x46, 0x7e, 0x89, 0xf0, 0x8b, 0x5e,
-  0x84, 0xe8, 0x51, 0x09, 0x31, 0xc0, 0x40, 0x83, 0x3f, 0x00, 0x74, 0x04,
-  0x43, 0x43, 0xeb, 0xf6, 0x89, 0xc2, 0xd1, 0xe0, 0x89, 0xc7, 0xe8, 0x87,
-  0xfb, 0x89, 0xc6, 0x89, 0xfb, 0x03, 0x7e, 0x84, 0x01, 0xc3, 0x4b, 0x4b,
-  0x4a, 0x4f, 0x4f, 0x85, 0xd2, 0x7e, 0x06, 0x8b, 0x05, 0x89, 0x07, 0xeb,
-  0xf1, 0x8d, 0x46, 0x08, 0x89, 0x04, 0xb8, 0x01, 0x00, 0x8d, 0x4e, 0x7a,
-  0x50, 0x8d, 0x46, 0x78, 0x8d, 0x5e, 0x74, 0x50, 0x8d, 0x46, 0x76, 0x8b,
-  0x56, 0x82, 0x50, 0x89, 0xf0, 0xe8, 0x38, 0x0d, 0x89, 0xc7, 0x3d, 0xff,
-  0xff, 0x74, 0x62, 0x8b, 0x46, 0x86, 0xb1, 0x04, 0xe8, 0xe6, 0xf2, 0x8b,
-  0x16, 0xa0, 0x05, 0x05, 0x0f, 0x00, 0x83, 0xc2, 0x10, 0xd3, 0xe8, 0x8d,
-  0x5e, 0x88, 0x01, 0xd0, 0x31, 0xc9, 0x01, 0x46, 0x7e, 0x89, 0xf2, 0x8d,
-  0x46, 0x08, 0xe8, 0x2d, 0x0e, 0x8b, 0x56, 0x76, 0x8b, 0x46, 0x7e, 0x89,
-  0xfb, 0xe8, 0x75, 0xfc, 0x85, 0xc0, 0x74, 0x03, 0xe8, 0xe4, 0xfd, 0xff,
-  0x76, 0x6c, 0xff, 0x76, 0x6e, 0xff, 0x76, 0x68, 0xff, 0x76, 0x66, 0xff,
-  0x76, 0x7c, 0x8d, 0x46, 0x88, 0x50, 0x8d, 0x46, 0x08, 0x50, 0x0e, 0xe8,
-  0x88, 0x0f, 0x90, 0x83, 0xc4, 0x0e, 0x8b, 0x46, 0x74, 0xe8, 0x92, 0x02,
-  0x89, 0xf0, 0xe8, 0x8d, 0x02, 0xb8, 0xff, 0xff, 0x8d, 0xa6, 0x80, 0x00,
-  0xe9, 0xab, 0xfd, 0xb8, 0x02, 0x00, 0xe8, 0x98, 0x07, 0xc7, 0x06, 0xa8,
-  0x05, 0x4c, 0x14, 0xc3, 0x53, 0x56, 0x89, 0xc3, 0x88, 0xd0, 0x3a, 0x07,
-  0x74, 0x0a, 0x89, 0xde, 0x43, 0x80, 0x3c, 0x00, 0x75, 0xf4, 0x31, 0xdb,
-  0x89, 0xd8, 0x5e, 0x5b, 0xc3, 0x51, 0x56, 0x57, 0x89, 0xd9, 0x89, 0xd6,
-  0x89, 0xc7, 0x57, 0x8c, 0xd8, 0x8e, 0xc0, 0xd1, 0xe9, 0xf3, 0xa5, 0x13,
-  0xc9, 0xf3, 0xa4, 0x5f, 0x89, 0xf8, 0x5f, 0x5e, 0x59, 0xc3, 0x53, 0x52,
-  0x56, 0x57, 0x80, 0x26, 0x83, 0x04, 0xf8, 0xbe, 0x60, 0x04, 0x80, 0x0e,
-  0x83, 0x04, 0x04, 0x8b, 0x44, 0x06, 0x85, 0xc0, 0x75, 0x08, 0xa3, 0xba,
-  0x07, 0x5f, 0x5e, 0x5a, 0x5b, 0xc3, 0xb8, 0x0c, 0x00, 0xe8, 0x74, 0xfa,
-  0x85, 0xc0, 0x75, 0x41, 0xb8, 0x0c, 0x00, 0xe8, 0x6a, 0xfa, 0x89, 0xc7,
-  0x85, 0xc0, 0x74, 0x28, 0xa1, 0xb8, 0x07, 0x89, 0x75, 0x02, 0x89, 0x05,
-  0x89, 0x7c, 0x04, 0xc7, 0x45, 0x04, 0x00, 0x00, 0x89, 0x3e, 0xb8, 0x07,
-  0x8b, 0x7c, 0x04, 0xc6, 0x45, 0x0a, 0x00, 0x8b, 0x7c, 0x04, 0x83, 0xc6,
-  0x0e, 0xc7, 0x45, 0x06, 0x00, 0x00, 0xeb, 0xb3, 0xbb, 0x01, 0x00, 0xb8,
-  0xac, 0x03, 0x8c, 0xda, 0xe8, 0xd7, 0xf5, 0xeb, 0xcb, 0x89, 0xc7, 0xeb,
-  0xc7, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc3, 0xd1, 0xe3, 0xb1, 0x03,
-  0x89, 0xda, 0xd3, 0xe2, 0xbf, 0x60, 0x04, 0x29, 0xda, 0x31, 0xc9, 0x8b,
-  0x1e, 0xb8, 0x07, 0x01, 0xd7, 0x85, 0xdb, 0x74, 0x2b, 0x8b, 0x37, 0x8b,
-  0x5f, 0x02, 0x8a, 0x47, 0x07, 0xba, 0x01, 0x00, 0xa8, 0x40, 0x75, 0x04,
-  0xa8, 0x08, 0x74, 0x0a, 0x89, 0xd8, 0xe8, 0x0e, 0x10, 0x41, 0x89, 0xf3,
-  0xeb, 0xdf, 0x39, 0xfb, 0x72, 0xf8, 0x81, 0xfb, 0xa6, 0x04, 0x73, 0xec,
-  0x31, 0xd2, 0xeb, 0xe8, 0x89, 0xc8, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3,
-  0xb8, 0x05, 0x00, 0xeb, 0xa8, 0x31, 0xc0, 0xe8, 0xa3, 0xff, 0xe9, 0x46,
-  0x10, 0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02,
-  0x89, 0xc6, 0xc7, 0x46, 0xfe, 0x00, 0x00, 0xf6, 0x44, 0x07, 0x10, 0x74,
-  0x03, 0xe9, 0x6c, 0x00, 0x8b, 0x5c, 0x04, 0x83, 0x7f, 0x04, 0x00, 0x74,
-  0x3b, 0x80, 0x64, 0x06, 0xef, 0xf6, 0x44, 0x07, 0x20, 0x75, 0x31, 0x8b,
-  0x44, 0x02, 0x99, 0x89, 0xd3, 0x09, 0xc3, 0x74, 0x14, 0x89, 0xd1, 0x89,
-  0xc3, 0xba, 0x01, 0x00, 0xf7, 0xd9, 0x8b, 0x44, 0x08, 0xf7, 0xdb, 0x83,
-  0xd9, 0x00, 0xe8, 0x4b, 0x0a, 0x83, 0xfa, 0xff, 0x75, 0x0e, 0x3d, 0xff,
-  0xff, 0x75, 0x09, 0xc7, 0x46, 0xfe, 0xff, 0xff, 0x80, 0x4c, 0x06, 0x20,
-  0x8b, 0x5c, 0x04, 0x8b, 0x47, 0x04, 0xc7, 0x44, 0x02, 0x00, 0x00, 0x89,
-  0x04, 0x83, 0x7e, 0xfe, 0x00, 0x75, 0x09, 0x8b, 0x5c, 0x04, 0xf6, 0x47,
-  0x08, 0x01, 0x75, 0x5e, 0x8b, 0x46, 0xfe, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0xc3, 0x80, 0x64, 0x07, 0xef, 0xf6, 0x44, 0x06, 0x02,
-  0x74, 0xce, 0x8b, 0x7c, 0x04, 0x8b, 0x45, 0x04, 0x85, 0xc0, 0x74, 0xc4,
-  0x89, 0xc7, 0x8b, 0x4c, 0x02, 0x85, 0xc9, 0x74, 0xbb, 0x83, 0x7e, 0xfe,
-  0x00, 0x75, 0xb5, 0x89, 0xcb, 0x89, 0xfa, 0x8b, 0x44, 0x08, 0xe8, 0xb6,
-  0x0f, 0x89, 0xc2, 0x3d, 0xff, 0xff, 0x75, 0x0d, 0x89, 0x46, 0xfe, 0x80,
-  0x4c, 0x06, 0x20, 0x01, 0xd7, 0x29, 0xd1, 0xeb, 0xd8, 0x85, 0xc0, 0x75,
-  0xf6, 0xb8, 0x0c, 0x00, 0xc7, 0x46, 0xfe, 0xff, 0xff, 0xe8, 0x0f, 0xf1,
-  0xeb, 0xe5, 0x8b, 0x44, 0x08, 0xe8, 0xe1, 0x0f, 0x3d, 0xff, 0xff, 0x75,
-  0x97, 0x89, 0x46, 0xfe, 0xeb, 0x92, 0x53, 0x56, 0x89, 0xc3, 0xe8, 0xd3,
-  0x0f, 0x83, 0x7f, 0x0a, 0x00, 0x75, 0x0c, 0x8a, 0x47, 0x07, 0xa8, 0x02,
-  0x74, 0x40, 0xc7, 0x47, 0x0a, 0x86, 0x00, 0x8b, 0x47, 0x0a, 0xe8, 0xc3,
-  0xf8, 0x8b, 0x77, 0x04, 0x89, 0x44, 0x04, 0x8b, 0x77, 0x04, 0x83, 0x7c,
-  0x04, 0x00, 0x75, 0x38, 0x80, 0x67, 0x07, 0xf8, 0x8d, 0x47, 0x0c, 0x8b,
-  0x77, 0x04, 0x80, 0x4f, 0x07, 0x04, 0x89, 0x44, 0x04, 0xc7, 0x47, 0x0a,
-  0x01, 0x00, 0x8b, 0x77, 0x04, 0x8b, 0x44, 0x04, 0xc7, 0x47, 0x02, 0x00,
-  0x00, 0x89, 0x07, 0x5e, 0x5b, 0xc3, 0xa8, 0x04, 0x74, 0x07, 0xc7, 0x47,
-  0x0a, 0x40, 0x00, 0xeb, 0xba, 0xc7, 0x47, 0x0a, 0x00, 0x02, 0xeb, 0xb3,
-  0x80, 0x4f, 0x06, 0x08, 0xeb, 0xd8, 0x80, 0x3e, 0x98, 0x05, 0x00, 0x75,
-  0x03, 0x31, 0xc0, 0xc3, 0x52, 0x50, 0xcc, 0xeb, 0x06, 0x57, 0x56, 0x49,
-  0x44, 0x45, 0x4f, 0xb8, 0x01, 0x00, 0x83, 0xc4, 0x04, 0xc3, 0x53, 0x52,
-  0x56, 0x85, 0xc0, 0x74, 0x55, 0x8b, 0x36, 0xca, 0x08, 0x85, 0xf6, 0x74,
-  0x34, 0x39, 0xc6, 0x77, 0x08, 0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77,
-  0x43, 0x89, 0xf3, 0x8b, 0x74, 0x02, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6,
-  0x77, 0x08, 0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x2e, 0x8b, 0x77,
-  0x04, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6, 0x77, 0x08, 0x8b, 0x14, 0x01,
-  0xf2, 0x39, 0xc2, 0x77, 0x51, 0x8b, 0x36, 0x94, 0x05, 0x85, 0xf6, 0x75,
-  0x15, 0x8b, 0x36, 0x92, 0x05, 0x85, 0xf6, 0x74, 0x09, 0x39, 0xc6, 0x76,
-  0x5b, 0x8b, 0x74, 0x04, 0xeb, 0xf3, 0xeb, 0x50, 0xeb, 0x34, 0x39, 0xc6,
-  0x77, 0x08, 0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x28, 0x89, 0xf3,
-  0x8b, 0x74, 0x02, 0x85, 0xf6, 0x74, 0x0c, 0x39, 0xc6, 0x77, 0x08, 0x8b,
-  0x14, 0x01, 0xf2, 0x39, 0xc2, 0x77, 0x13, 0x8b, 0x77, 0x04, 0x85, 0xf6,
-  0x74, 0xc3, 0x39, 0xc6, 0x77, 0xbf, 0x8b, 0x14, 0x01, 0xf2, 0x39, 0xc2,
-  0x76, 0xb7, 0x8c, 0xda, 0x89, 0xf3, 0xe8, 0x71, 0x01, 0x89, 0x36, 0xca,
-  0x08, 0x3b, 0x36, 0x94, 0x05, 0x73, 0x09, 0x8b, 0x44, 0x0a, 0x3b, 0x06,
-  0x96, 0x05, 0x77, 0x0e, 0x5e, 0x5a, 0x5b, 0xc3, 0x8b, 0x14, 0x01, 0xf2,
-  0x39, 0xc2, 0x77, 0xda, 0xeb, 0x9b, 0xa3, 0x96, 0x05, 0xeb, 0xed, 0x53,
-  0x52, 0x56, 0xa1, 0xb4, 0x07, 0x85, 0xc0, 0x74, 0x5a, 0x89, 0xc3, 0x8b,
-  0x07, 0x85, 0xc0, 0x74, 0x28, 0x83, 0x3e, 0xb2, 0x07, 0x00, 0x75, 0x05,
-  0x83, 0xc3, 0x02, 0xeb, 0xee, 0x89, 0xda, 0x2b, 0x16, 0xb4, 0x07, 0x8b,
-  0x36, 0xb2, 0x07, 0xd1, 0xfa, 0x01, 0xd6, 0x80, 0x3c, 0x00, 0x74, 0x03,
-  0xe8, 0x0b, 0xff, 0xc7, 0x07, 0x00, 0x00, 0xeb, 0xdf, 0x83, 0x3e, 0xb2,
-  0x07, 0x00, 0x74, 0x06, 0xa1, 0xb4, 0x07, 0xe8, 0xf8, 0xfe, 0xb8, 0x03,
-  0x00, 0xe8, 0x4c, 0xf7, 0x89, 0xc3, 0x85, 0xc0, 0x74, 0x17, 0xc7, 0x07,
-  0x00, 0x00, 0x83, 0xc3, 0x02, 0xa3, 0xb4, 0x07, 0x89, 0x1e, 0xb2, 0x07,
-  0xc6, 0x07, 0x00, 0x31, 0xc0, 0x5e, 0x5a, 0x5b, 0xc3, 0xb8, 0xff, 0xff,
-  0xeb, 0xf7, 0x31, 0xc0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc1, 0x89, 0x56, 0xfe, 0x89, 0xd0,
-  0xc7, 0x46, 0xfc, 0x00, 0x00, 0x50, 0x8c, 0xd8, 0x1f, 0x89, 0x46, 0xfe,
-  0x85, 0xc9, 0x74, 0x68, 0x89, 0xc8, 0x05, 0x03, 0x00, 0x39, 0xc8, 0x72,
-  0x5f, 0x24, 0xfe, 0x89, 0xdf, 0x89, 0xc1, 0x8b, 0x47, 0x0a, 0x83, 0xf9,
-  0x06, 0x73, 0x03, 0xb9, 0x06, 0x00, 0x39, 0xc1, 0x77, 0x4a, 0x8b, 0x55,
-  0x08, 0x8b, 0x5d, 0x06, 0x39, 0xd1, 0x76, 0x51, 0x89, 0xfe, 0x83, 0xc6,
-  0x10, 0x8b, 0x07, 0x39, 0xc1, 0x77, 0x4d, 0x89, 0x55, 0x08, 0x29, 0xc8,
-  0xff, 0x45, 0x0c, 0x3d, 0x06, 0x00, 0x72, 0x59, 0x89, 0xde, 0x01, 0xce,
-  0x89, 0x75, 0x06, 0x89, 0x04, 0x8b, 0x7f, 0x02, 0x89, 0x0f, 0x89, 0x7c,
-  0x02, 0x8b, 0x47, 0x04, 0x89, 0x44, 0x04, 0x89, 0x75, 0x04, 0x89, 0xc7,
-  0x89, 0x75, 0x02, 0x80, 0x0f, 0x01, 0x83, 0xc3, 0x02, 0x89, 0x5e, 0xfc,
-  0x8b, 0x46, 0xfe, 0x50, 0x8c, 0xd8, 0x1f, 0x8b, 0x46, 0xfc, 0x89, 0xec,
-  0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x8b, 0x5d, 0x14, 0x31, 0xd2, 0xeb, 0xa8,
-  0x39, 0xd0, 0x76, 0x02, 0x89, 0xc2, 0x8b, 0x5f, 0x04, 0x39, 0xf3, 0x75,
-  0xa0, 0x8b, 0x46, 0xfe, 0x89, 0x55, 0x0a, 0x50, 0x8c, 0xd8, 0x1f, 0xeb,
-  0xd6, 0xff, 0x4d, 0x0e, 0x8b, 0x77, 0x02, 0x89, 0x75, 0x06, 0x8b, 0x7f,
-  0x04, 0x89, 0x7c, 0x04, 0xeb, 0xb2, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x08, 0x89, 0xc6, 0x89, 0xd1, 0x89, 0xdf, 0x89, 0xd0, 0x50,
-  0x8c, 0xd8, 0x1f, 0x89, 0xc1, 0x85, 0xf6, 0x75, 0x03, 0xe9, 0x77, 0x00,
-  0x83, 0xee, 0x02, 0xf6, 0x04, 0x01, 0x74, 0xf5, 0x8b, 0x14, 0x89, 0x5e,
-  0xfe, 0x80, 0xe2, 0xfe, 0x89, 0xf3, 0x01, 0xd3, 0xf6, 0x07, 0x01, 0x75,
-  0x6e, 0x03, 0x17, 0x89, 0x14, 0x3b, 0x5d, 0x06, 0x75, 0x03, 0x89, 0x75,
-  0x06, 0x8b, 0x7f, 0x02, 0x8b, 0x5f, 0x04, 0x89, 0x5d, 0x04, 0x89, 0x7f,
-  0x02, 0x8b, 0x7e, 0xfe, 0xff, 0x4d, 0x0e, 0x8b, 0x7f, 0x02, 0x89, 0xfa,
-  0x8b, 0x04, 0x03, 0x15, 0x89, 0x7e, 0xfc, 0x39, 0xd6, 0x75, 0x3d, 0x03,
-  0x05, 0x8b, 0x5e, 0xfe, 0x89, 0x05, 0x3b, 0x57, 0x06, 0x75, 0x03, 0x89,
-  0x7f, 0x06, 0x8b, 0x76, 0xfc, 0x8b, 0x5e, 0xfe, 0xff, 0x4f, 0x0c, 0x3b,
-  0x77, 0x06, 0x73, 0x08, 0x3b, 0x47, 0x08, 0x76, 0x03, 0x89, 0x47, 0x08,
-  0x8b, 0x5e, 0xfe, 0x3b, 0x47, 0x0a, 0x76, 0x03, 0x89, 0x47, 0x0a, 0x89,
-  0xc8, 0x50, 0x8c, 0xd8, 0x1f, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xc3,
-  0xe9, 0xa0, 0x00, 0x89, 0x14, 0x8b, 0x5d, 0x06, 0x39, 0xde, 0x72, 0x03,
-  0xe9, 0x71, 0x00, 0x3b, 0x77, 0x02, 0x77, 0x9f, 0x8b, 0x5d, 0x14, 0x39,
-  0xde, 0x72, 0x98, 0x8b, 0x5e, 0xfe, 0x8b, 0x5f, 0x0e, 0x89, 0xd8, 0x40,
-  0x8b, 0x7e, 0xfe, 0x89, 0x46, 0xf8, 0x8b, 0x45, 0x0c, 0x31, 0xd2, 0x89,
-  0x46, 0xfa, 0xf7, 0x76, 0xf8, 0x89, 0xc2, 0x39, 0xd8, 0x73, 0x24, 0x8b,
-  0x46, 0xfa, 0x29, 0xd8, 0xd1, 0xe2, 0x39, 0xd8, 0x76, 0x50, 0x8b, 0x1c,
-  0x01, 0xf3, 0x8b, 0x07, 0xa8, 0x01, 0x75, 0x03, 0xe9, 0x60, 0xff, 0x3d,
-  0xff, 0xff, 0x74, 0x07, 0x24, 0xfe, 0x01, 0xc3, 0x4a, 0x75, 0xeb, 0x8b,
-  0x5e, 0xfe, 0x8b, 0x5f, 0x06, 0x39, 0xde, 0x72, 0x32, 0x39, 0xde, 0x72,
-  0xe3, 0x8b, 0x5f, 0x04, 0x39, 0xde, 0x72, 0xdc, 0x8b, 0x5f, 0x04, 0x39,
-  0xde, 0x72, 0xd5, 0x8b, 0x5f, 0x04, 0xeb, 0xe9, 0x8b, 0x5f, 0x04, 0x39,
-  0xde, 0x72, 0xc9, 0x89, 0xfb, 0x8b, 0x47, 0x12, 0x83, 0xc3, 0x10, 0x39,
-  0xc6, 0x76, 0x88, 0xe9, 0x1d, 0xff, 0xba, 0xff, 0xff, 0xeb, 0xab, 0x8b,
-  0x5e, 0xfe, 0x8b, 0x5f, 0x14, 0xeb, 0xc6, 0x8b, 0x7e, 0xfe, 0xff, 0x45,
-  0x0e, 0x8b, 0x7e, 0xfc, 0x89, 0x5c, 0x04, 0x89, 0x7c, 0x02, 0x89, 0x75,
-  0x04, 0x89, 0x77, 0x02, 0xe9, 0x1a, 0xff, 0x53, 0x56, 0x57, 0x89, 0xc6,
-  0x8b, 0x1e, 0x92, 0x05, 0x31, 0xff, 0x85, 0xdb, 0x74, 0x0b, 0x39, 0xde,
-  0x72, 0x07, 0x89, 0xdf, 0x8b, 0x5f, 0x04, 0xeb, 0xf1, 0x89, 0x7c, 0x02,
-  0x89, 0x5c, 0x04, 0x85, 0xff, 0x74, 0x3d, 0x89, 0x75, 0x04, 0x85, 0xdb,
-  0x75, 0x3c, 0x8d, 0x7c, 0x10, 0x8b, 0x1c, 0x83, 0xc6, 0x16, 0xc7, 0x44,
-  0xfa, 0x00, 0x00, 0xc7, 0x44, 0xf2, 0x00, 0x00, 0xc7, 0x44, 0xf6, 0x00,
-  0x00, 0xc7, 0x44, 0xf8, 0x00, 0x00, 0x89, 0x7c, 0xfc, 0x89, 0x7c, 0xfe,
-  0x83, 0xeb, 0x16, 0x89, 0x7c, 0xf0, 0x89, 0x1c, 0x01, 0xf3, 0x89, 0xf0,
-  0xc7, 0x07, 0xff, 0xff, 0x5f, 0x5e, 0x5b, 0xc3, 0x89, 0x36, 0x92, 0x05,
-  0xeb, 0xc0, 0x89, 0x77, 0x02, 0xeb, 0xbf, 0x53, 0xa1, 0x92, 0x05, 0x85,
-  0xc0, 0x74, 0x14, 0x89, 0xc3, 0x8b, 0x5f, 0x12, 0x8b, 0x07, 0x01, 0xd8,
-  0x05, 0x02, 0x00, 0x3b, 0x06, 0x36, 0x04, 0x75, 0x04, 0x8b, 0x07, 0x5b,
-  0xc3, 0x31, 0xc0, 0x5b, 0xc3, 0x53, 0x52, 0x89, 0xc3, 0x8b, 0x07, 0x89,
-  0xc2, 0x83, 0xc2, 0x03, 0x80, 0xe2, 0xfe, 0x39, 0xc2, 0x73, 0x05, 0x31,
-  0xc0, 0x5a, 0x5b, 0xc3, 0xe8, 0xc4, 0xff, 0x39, 0xd0, 0x72, 0x23, 0x31,
-  0xd2, 0x89, 0x17, 0x83, 0xc2, 0x1e, 0x3b, 0x17, 0x72, 0xe9, 0xa1, 0x9a,
-  0x05, 0x39, 0xc2, 0x73, 0x05, 0x89, 0xc2, 0x80, 0xe2, 0xfe, 0x89, 0x17,
-  0x85, 0xd2, 0x74, 0xd7, 0xb8, 0x01, 0x00, 0x5a, 0x5b, 0xc3, 0x29, 0xc2,
-  0xeb, 0xdb, 0x53, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x50, 0xa1, 0xaa, 0x05,
-  0x85, 0xc0, 0x74, 0x09, 0x83, 0x3e, 0x36, 0x04, 0xfe, 0x75, 0x08, 0x31,
-  0xc0, 0x89, 0xec, 0x5d, 0xe9, 0x6d, 0xff, 0x8d, 0x46, 0xfe, 0xe8, 0x98,
-  0xff, 0x85, 0xc0, 0x74, 0xf0, 0x8b, 0x5e, 0xfe, 0x03, 0x1e, 0x36, 0x04,
-  0x3b, 0x1e, 0x36, 0x04, 0x73, 0x03, 0xbb, 0xfe, 0xff, 0x89, 0xd8, 0xe8,
-  0x0f, 0x0b, 0x3d, 0xff, 0xff, 0x74, 0xd4, 0x89, 0xc6, 0x3d, 0xf8, 0xff,
-  0x77, 0xcd, 0x39, 0xc3, 0x76, 0xc9, 0x29, 0xc3, 0x89, 0x5e, 0xfe, 0x8d,
-  0x47, 0xfe, 0x39, 0xd8, 0x77, 0xbd, 0x8b, 0x1e, 0x92, 0x05, 0x89, 0x46,
-  0xfe, 0x85, 0xdb, 0x74, 0x06, 0x83, 0x7f, 0x04, 0x00, 0x75, 0x3c, 0x85,
-  0xdb, 0x74, 0x4e, 0x8b, 0x07, 0x8d, 0x7c, 0xfe, 0x01, 0xd8, 0x39, 0xc7,
-  0x75, 0x43, 0x83, 0x46, 0xfe, 0x02, 0x89, 0xc6, 0x8b, 0x46, 0xfe, 0x01,
-  0x07, 0x03, 0x7e, 0xfe, 0xc7, 0x05, 0xff, 0xff, 0x8b, 0x46, 0xfe, 0x0c,
-  0x01, 0x89, 0x04, 0xc7, 0x47, 0x0a, 0xff, 0xff, 0x8d, 0x44, 0x02, 0xff,
-  0x47, 0x0c, 0xe8, 0x25, 0xfb, 0xb8, 0x01, 0x00, 0xe9, 0x72, 0xff, 0x39,
-  0xf3, 0x76, 0x05, 0x8b, 0x5f, 0x04, 0xeb, 0xb1, 0x8b, 0x07, 0x01, 0xd8,
-  0x05, 0x02, 0x00, 0x39, 0xf0, 0x73, 0xb0, 0xeb, 0xee, 0x8b, 0x46, 0xfe,
-  0x3d, 0x1c, 0x00, 0x73, 0x03, 0xe9, 0x4f, 0xff, 0x89, 0x04, 0x89, 0xf0,
-  0x89, 0xf3, 0xe8, 0x5e, 0xfe, 0x89, 0xc7, 0x89, 0xc6, 0x8b, 0x05, 0x89,
-  0x46, 0xfe, 0xeb, 0xb0, 0x8c, 0x16, 0x9c, 0x05, 0xc3, 0x3b, 0xc4, 0x73,
-  0x13, 0x2b, 0xc4, 0xf7, 0xd8, 0x3b, 0x06, 0x3e, 0x04, 0x77, 0x08, 0x8c,
-  0xd0, 0x3b, 0x06, 0x9c, 0x05, 0x74, 0x01, 0xc3, 0x0e, 0x5a, 0xb8, 0xdb,
-  0x1d, 0xbb, 0x01, 0x00, 0xe8, 0xc3, 0xee, 0x53, 0x74, 0x61, 0x63, 0x6b,
-  0x20, 0x4f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x21, 0x00, 0x56,
-  0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x14, 0x50, 0x89, 0xd6, 0x89, 0xcf,
-  0x8b, 0x04, 0x89, 0x46, 0xec, 0x8b, 0x44, 0x02, 0x89, 0x46, 0xee, 0x8b,
-  0x44, 0x04, 0x89, 0x46, 0xf0, 0x8b, 0x44, 0x06, 0x89, 0x46, 0xf2, 0x8b,
-  0x44, 0x08, 0x89, 0x46, 0xf6, 0x8b, 0x44, 0x0a, 0x89, 0x46, 0xf8, 0x8b,
-  0x45, 0x06, 0x89, 0x46, 0xfa, 0x8b, 0x05, 0x8d, 0x56, 0xec, 0x89, 0x46,
-  0xfc, 0x8b, 0x46, 0xea, 0xe8, 0x4a, 0x0a, 0x8b, 0x46, 0xec, 0x89, 0x07,
-  0x8b, 0x46, 0xee, 0x89, 0x47, 0x02, 0x8b, 0x46, 0xf0, 0x89, 0x47, 0x04,
-  0x8b, 0x46, 0xf2, 0x89, 0x47, 0x06, 0x8b, 0x46, 0xf6, 0x89, 0x47, 0x08,
-  0x8b, 0x46, 0xf8, 0x89, 0x47, 0x0a, 0x8b, 0x46, 0xfe, 0x25, 0x01, 0x00,
-  0x89, 0x47, 0x0c, 0x8b, 0x46, 0xfa, 0x89, 0x45, 0x06, 0x8b, 0x46, 0xfc,
-  0x89, 0x05, 0x8b, 0x46, 0xec, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc3, 0x51,
-  0x56, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x89, 0xc6, 0x8d, 0x46, 0xf8,
-  0x8d, 0x4e, 0xf8, 0xe8, 0x09, 0x0a, 0x89, 0xf0, 0xe8, 0x64, 0xff, 0x89,
-  0xec, 0x5d, 0x5e, 0x59, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x89, 0xcf,
-  0x8b, 0x4e, 0x08, 0x8e, 0xc3, 0x89, 0xd6, 0x1e, 0x8e, 0xd8, 0xd1, 0xe9,
-  0xf3, 0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x1f, 0x5d, 0x5f, 0x5e, 0xc2, 0x02,
-  0x00, 0xe9, 0xf3, 0x09, 0x51, 0x57, 0x89, 0xc7, 0x8c, 0xd8, 0x8e, 0xc0,
-  0xb9, 0xff, 0xff, 0x30, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x4f, 0x88, 0xd0,
-  0xfd, 0xf2, 0xae, 0xfc, 0x75, 0x03, 0x89, 0xf9, 0x41, 0x89, 0xc8, 0x5f,
-  0x59, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x0a, 0x89, 0xc6,
-  0x89, 0x56, 0xfc, 0x89, 0x5e, 0xf8, 0x89, 0xcf, 0xc7, 0x46, 0xf6, 0xff,
-  0xff, 0x80, 0x3c, 0x20, 0x75, 0x03, 0x46, 0xeb, 0xf8, 0x8b, 0x46, 0xfc,
-  0x25, 0x83, 0x00, 0x8d, 0x5e, 0xf6, 0x89, 0xc2, 0x89, 0x46, 0xfa, 0x0b,
-  0x56, 0xf8, 0x89, 0xf0, 0xe8, 0xcb, 0x09, 0x85, 0xc0, 0x75, 0x09, 0x8b,
-  0x46, 0xf6, 0x3b, 0x06, 0xac, 0x05, 0x73, 0x49, 0xf6, 0x46, 0xfc, 0x03,
-  0x74, 0x35, 0x8b, 0x46, 0xf6, 0x3d, 0xff, 0xff, 0x74, 0x2d, 0xe8, 0xed,
-  0x09, 0x85, 0xc0, 0x75, 0x26, 0xf6, 0x46, 0xfd, 0x04, 0x74, 0x06, 0xf6,
-  0x46, 0xfc, 0x20, 0x75, 0x3f, 0xf6, 0x46, 0xfc, 0x40, 0x74, 0x14, 0x8d,
-  0x56, 0xfe, 0x8b, 0x5e, 0xf6, 0x31, 0xc9, 0xb4, 0x40, 0xcd, 0x21, 0x19,
-  0xd2, 0x89, 0xc1, 0x85, 0xd2, 0x7c, 0x33, 0x83, 0x7e, 0xf6, 0xff, 0x75,
-  0x3d, 0xf6, 0x46, 0xfc, 0x20, 0x75, 0x39, 0xeb, 0x0e, 0x89, 0xc3, 0xb4,
-  0x3e, 0xcd, 0x21, 0x19, 0xd2, 0xb8, 0x0b, 0x00, 0xe8, 0xa8, 0xe9, 0xb8,
-  0xff, 0xff, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc3, 0x8b, 0x5e, 0xf6, 0xb4,
-  0x3e, 0xcd, 0x21, 0x19, 0xd2, 0xb8, 0x07, 0x00, 0xeb, 0xe6, 0x8b, 0x5e,
-  0xf6, 0xb4, 0x3e, 0xcd, 0x21, 0x19, 0xd2, 0x89, 0xc8, 0xe8, 0x02, 0xf1,
-  0xeb, 0xdc, 0xeb, 0x4a, 0xe8, 0x3b, 0xe4, 0x89, 0xc3, 0x8b, 0x07, 0x3d,
-  0x02, 0x00, 0x75, 0xcb, 0x01, 0x05, 0x8b, 0x1d, 0x8b, 0x47, 0xfe, 0xc7,
-  0x05, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x03, 0xb8, 0x80, 0x01, 0x8b, 0x16,
-  0xd8, 0x05, 0xf7, 0xd2, 0x21, 0xd0, 0x31, 0xd2, 0xa8, 0x80, 0x75, 0x03,
-  0xba, 0x01, 0x00, 0x8d, 0x5e, 0xf6, 0x89, 0xf0, 0xe8, 0x63, 0x09, 0x85,
-  0xc0, 0x75, 0x9c, 0x8b, 0x46, 0xf6, 0x3b, 0x06, 0xac, 0x05, 0x73, 0x63,
-  0x83, 0x7e, 0xf8, 0x00, 0x75, 0x68, 0x8b, 0x46, 0xf6, 0xe8, 0x02, 0x09,
-  0x24, 0x3c, 0x89, 0xc2, 0x8b, 0x46, 0xf6, 0xe8, 0x24, 0x09, 0x85, 0xc0,
-  0x74, 0x03, 0x80, 0xce, 0x20, 0x80, 0x66, 0xfa, 0x7f, 0x83, 0x7e, 0xfa,
-  0x02, 0x75, 0x03, 0x80, 0xca, 0x03, 0x83, 0x7e, 0xfa, 0x00, 0x75, 0x03,
-  0x80, 0xca, 0x01, 0x83, 0x7e, 0xfa, 0x01, 0x75, 0x03, 0x80, 0xca, 0x02,
-  0xf6, 0x46, 0xfc, 0x10, 0x74, 0x03, 0x80, 0xca, 0x80, 0x89, 0xd0, 0x0c,
-  0x40, 0xf6, 0x46, 0xfd, 0x03, 0x74, 0x46, 0xf6, 0x46, 0xfd, 0x02, 0x74,
-  0x02, 0x89, 0xc2, 0x8b, 0x46, 0xf6, 0xe8, 0xbb, 0x09, 0x8b, 0x46, 0xf6,
-  0xe9, 0x33, 0xff, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0x19, 0xd2, 0xe9,
-  0x1f, 0xff, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0x19, 0xd2, 0x85, 0xd2,
-  0x7d, 0x03, 0xe9, 0x38, 0xff, 0x8b, 0x56, 0xfa, 0x8d, 0x5e, 0xf6, 0x89,
-  0xf0, 0x0b, 0x56, 0xf8, 0xe8, 0x6f, 0x08, 0x85, 0xc0, 0x75, 0x03, 0xe9,
-  0x74, 0xff, 0xe9, 0xfe, 0xfe, 0x81, 0x3e, 0x78, 0x05, 0x00, 0x02, 0x75,
-  0xba, 0xeb, 0xb6, 0x53, 0x55, 0x89, 0xe5, 0x8d, 0x5e, 0x0a, 0x8b, 0x07,
-  0x50, 0x31, 0xc0, 0x50, 0xff, 0x76, 0x08, 0xff, 0x76, 0x06, 0x83, 0xc3,
-  0x02, 0xe8, 0x06, 0x00, 0x83, 0xc4, 0x08, 0x5d, 0x5b, 0xc3, 0x53, 0x51,
-  0x52, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02, 0x8d, 0x46, 0x10, 0x8d, 0x4e,
-  0xfe, 0x8b, 0x5e, 0x0e, 0x8b, 0x56, 0x0c, 0x89, 0x46, 0xfe, 0x8b, 0x46,
-  0x0a, 0xe8, 0x1e, 0xfe, 0x89, 0xec, 0x5d, 0x5a, 0x59, 0x5b, 0xc3, 0x56,
-  0x57, 0x89, 0xc7, 0x89, 0xd6, 0x57, 0xf7, 0xc6, 0x01, 0x00, 0x74, 0x08,
-  0xac, 0x88, 0x05, 0x47, 0x3c, 0x00, 0x74, 0x26, 0x8b, 0x04, 0x84, 0xc0,
-  0x74, 0x1e, 0x89, 0x05, 0x83, 0xc7, 0x02, 0x84, 0xe4, 0x74, 0x17, 0x8b,
-  0x44, 0x02, 0x84, 0xc0, 0x74, 0x0e, 0x89, 0x05, 0x83, 0xc6, 0x04, 0x83,
-  0xc7, 0x02, 0x84, 0xe4, 0x75, 0xde, 0x74, 0x02, 0x88, 0x05, 0x58, 0x5f,
-  0x5e, 0xc3, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x50,
-  0xe8, 0x3a, 0x09, 0x8b, 0x46, 0xf6, 0x89, 0x56, 0xfc, 0xe8, 0xd6, 0x07,
-  0x89, 0x46, 0xf8, 0x85, 0xc0, 0x74, 0x41, 0xa8, 0x01, 0x74, 0x48, 0xa8,
-  0x40, 0x75, 0x49, 0x89, 0x5e, 0xfe, 0x31, 0xff, 0x8b, 0x4e, 0xfe, 0x8b,
-  0x56, 0xfc, 0x8b, 0x5e, 0xf6, 0xb4, 0x3f, 0xcd, 0x21, 0x19, 0xd2, 0x89,
-  0x46, 0xfa, 0x85, 0xd2, 0x7c, 0x48, 0x85, 0xc0, 0x74, 0x3b, 0x8b, 0x5e,
-  0xfc, 0x31, 0xd2, 0x31, 0xc0, 0x3b, 0x56, 0xfa, 0x73, 0x65, 0x80, 0x3f,
-  0x1a, 0x74, 0x38, 0x80, 0x3f, 0x0d, 0x75, 0x4e, 0x43, 0x42, 0xeb, 0xed,
-  0xb8, 0x04, 0x00, 0xe8, 0xb5, 0xe7, 0xb8, 0xff, 0xff, 0xeb, 0x18, 0xb8,
-  0x06, 0x00, 0xeb, 0xf3, 0x89, 0xd9, 0x8b, 0x5e, 0xf6, 0xb4, 0x3f, 0xcd,
-  0x21, 0x19, 0xd2, 0x89, 0xc7, 0x85, 0xd2, 0x7c, 0x09, 0x89, 0xf8, 0x89,
-  0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0xe8, 0x0d, 0xef, 0xeb, 0xf4, 0x89,
-  0xd3, 0x31, 0xc9, 0x31, 0xc0, 0xba, 0x01, 0x00, 0x2b, 0x5e, 0xfa, 0x19,
-  0xc9, 0x83, 0xc3, 0x01, 0x11, 0xc1, 0x8b, 0x46, 0xf6, 0xe8, 0x24, 0x00,
-  0xeb, 0xd7, 0x89, 0xc6, 0x47, 0x8a, 0x0f, 0x03, 0x76, 0xfc, 0x40, 0x88,
-  0x0c, 0xeb, 0xa5, 0x01, 0x46, 0xfc, 0x29, 0x46, 0xfe, 0xf6, 0x46, 0xf9,
-  0x20, 0x75, 0xbe, 0x83, 0x7e, 0xfe, 0x00, 0x74, 0xb8, 0xe9, 0x60, 0xff,
-  0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x8d, 0x7e,
-  0xfc, 0x88, 0xd0, 0x89, 0xda, 0x89, 0xf3, 0xb4, 0x42, 0xcd, 0x21, 0x36,
-  0x89, 0x05, 0x36, 0x89, 0x55, 0x02, 0xd1, 0xd2, 0xd1, 0xca, 0x85, 0xd2,
-  0x7c, 0x0c, 0x8b, 0x46, 0xfc, 0x8b, 0x56, 0xfe, 0x89, 0xec, 0x5d, 0x5f,
-  0x5e, 0xc3, 0xe8, 0x99, 0xee, 0x99, 0xeb, 0xf4, 0x0b, 0xd2, 0x78, 0x16,
-  0x0b, 0xc9, 0x79, 0x41, 0xf7, 0xd9, 0xf7, 0xdb, 0x83, 0xd9, 0x00, 0xe8,
-  0x37, 0x00, 0xf7, 0xda, 0xf7, 0xd8, 0x83, 0xda, 0x00, 0xc3, 0xf7, 0xda,
-  0xf7, 0xd8, 0x83, 0xda, 0x00, 0x0b, 0xc9, 0x79, 0x12, 0xf7, 0xd9, 0xf7,
-  0xdb, 0x83, 0xd9, 0x00, 0xe8, 0x1a, 0x00, 0xf7, 0xd9, 0xf7, 0xdb, 0x83,
-  0xd9, 0x00, 0xc3, 0xe8, 0x0f, 0x00, 0xf7, 0xd9, 0xf7, 0xdb, 0x83, 0xd9,
-  0x00, 0xf7, 0xda, 0xf7, 0xd8, 0x83, 0xda, 0x00, 0xc3, 0x0b, 0xc9, 0x75,
-  0x1a, 0x4b, 0x74, 0x16, 0x43, 0x3b, 0xda, 0x77, 0x09, 0x8b, 0xc8, 0x8b,
-  0xc2, 0x2b, 0xd2, 0xf7, 0xf3, 0x91, 0xf7, 0xf3, 0x8b, 0xda, 0x8b, 0xd1,
-  0x2b, 0xc9, 0xc3, 0x3b, 0xca, 0x72, 0x1a, 0x75, 0x10, 0x3b, 0xd8, 0x77,
-  0x0c, 0x2b, 0xc3, 0x8b, 0xd8, 0x2b, 0xc9, 0x2b, 0xd2, 0xb8, 0x01, 0x00,
-  0xc3, 0x2b, 0xc9, 0x2b, 0xdb, 0x93, 0x87, 0xca, 0xc3, 0x55, 0x56, 0x2b,
-  0xf6, 0x8b, 0xee, 0x03, 0xdb, 0x13, 0xc9, 0x72, 0x11, 0x45, 0x3b, 0xca,
-  0x72, 0xf5, 0x77, 0x04, 0x3b, 0xd8, 0x76, 0xef, 0xf8, 0x13, 0xf6, 0x4d,
-  0x78, 0x20, 0xd1, 0xd9, 0xd1, 0xdb, 0x2b, 0xc3, 0x19, 0xca, 0xf5, 0x72,
-  0xf0, 0x03, 0xf6, 0x4d, 0x78, 0x0c, 0xd1, 0xe9, 0xd1, 0xdb, 0x03, 0xc3,
-  0x13, 0xd1, 0x73, 0xf1, 0xeb, 0xdf, 0x03, 0xc3, 0x13, 0xd1, 0x8b, 0xd8,
-  0x8b, 0xca, 0x8b, 0xc6, 0x33, 0xd2, 0x5e, 0x5d, 0xc3, 0x53, 0x56, 0x89,
-  0xc3, 0x89, 0xd6, 0x8a, 0x04, 0x88, 0x07, 0x84, 0xc0, 0x74, 0x04, 0x43,
-  0x46, 0xeb, 0xf4, 0x89, 0xd8, 0x5e, 0x5b, 0xc3, 0x56, 0x57, 0x55, 0x89,
-  0xe5, 0x50, 0x50, 0x53, 0x51, 0x85, 0xd2, 0x75, 0x04, 0x8b, 0x16, 0xb4,
-  0x07, 0x31, 0xf6, 0x85, 0xd2, 0x74, 0x12, 0x89, 0xd3, 0x8b, 0x07, 0x85,
-  0xc0, 0x74, 0x0a, 0xe8, 0x9b, 0xe5, 0x40, 0x43, 0x43, 0x01, 0xc6, 0xeb,
-  0xf0, 0x46, 0x83, 0x7e, 0x0c, 0x00, 0x74, 0x0d, 0x8b, 0x5e, 0xfc, 0x8b,
-  0x07, 0xe8, 0x85, 0xe5, 0x05, 0x03, 0x00, 0x01, 0xc6, 0xa1, 0x9a, 0x05,
-  0x83, 0xc6, 0x0f, 0x89, 0x46, 0xfe, 0x89, 0xf0, 0xc7, 0x06, 0x9a, 0x05,
-  0x10, 0x00, 0xe8, 0xc7, 0xed, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0x23, 0x89,
-  0xf0, 0xe8, 0xbc, 0xed, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0x18, 0xb8, 0x05,
-  0x00, 0xe8, 0xcb, 0xe5, 0xb8, 0x08, 0x00, 0xe8, 0xfa, 0xe5, 0x8b, 0x46,
-  0xfe, 0xa3, 0x9a, 0x05, 0xb8, 0xff, 0xff, 0xe9, 0xa0, 0x00, 0x8b, 0x7e,
-  0xfa, 0x89, 0x1d, 0x83, 0xc3, 0x0f, 0x8b, 0x46, 0xfe, 0x80, 0xe3, 0xf0,
-  0xb1, 0x04, 0x89, 0xdf, 0xa3, 0x9a, 0x05, 0xd3, 0xef, 0x8c, 0xd8, 0x89,
-  0xf9, 0x8b, 0x7e, 0x08, 0x01, 0xc1, 0x89, 0x0d, 0x8b, 0x7e, 0xf8, 0x89,
-  0x1d, 0x85, 0xd2, 0x74, 0x16, 0x89, 0xd7, 0x8b, 0x05, 0x85, 0xc0, 0x74,
-  0x0e, 0x89, 0xc2, 0x89, 0xd8, 0xe8, 0x35, 0xff, 0x89, 0xc3, 0x47, 0x47,
-  0x43, 0xeb, 0xec, 0xc6, 0x07, 0x00, 0x43, 0x83, 0x7e, 0x0c, 0x00, 0x74,
-  0x0b, 0x8b, 0x7e, 0xfc, 0x8d, 0x47, 0x02, 0x8b, 0x15, 0xe8, 0x0b, 0xfd,
-  0x8b, 0x5e, 0xfc, 0x31, 0xd2, 0x83, 0x3f, 0x00, 0x74, 0x17, 0x43, 0x43,
-  0x83, 0x3f, 0x00, 0x74, 0x10, 0x85, 0xd2, 0x74, 0x01, 0x42, 0x8b, 0x07,
-  0xe8, 0xd2, 0xe4, 0x43, 0x43, 0x01, 0xc2, 0xeb, 0xeb, 0x83, 0xfa, 0x7e,
-  0x76, 0x17, 0xb8, 0x02, 0x00, 0xe8, 0x37, 0xe5, 0xb8, 0x0a, 0x00, 0x8b,
-  0x5e, 0xfa, 0xe8, 0x63, 0xe5, 0x8b, 0x07, 0xe8, 0xb4, 0xf4, 0xe9, 0x67,
-  0xff, 0x8b, 0x5e, 0x0a, 0xb1, 0x04, 0x89, 0xf0, 0xc7, 0x07, 0x90, 0x00,
-  0xd3, 0xe8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc2, 0x06, 0x00, 0x56, 0x57,
-  0x55, 0x89, 0xe5, 0x50, 0x89, 0xd6, 0x89, 0x5e, 0xfe, 0x85, 0xc9, 0x75,
-  0x01, 0x43, 0x83, 0x3c, 0x00, 0x74, 0x21, 0x46, 0x46, 0x83, 0x3c, 0x00,
-  0x74, 0x1a, 0x89, 0xd8, 0x8b, 0x14, 0xe8, 0xa4, 0xfe, 0x89, 0xc7, 0x46,
-  0x46, 0x89, 0xc3, 0x83, 0x3c, 0x00, 0x74, 0x08, 0x8d, 0x5d, 0x01, 0xc6,
-  0x05, 0x20, 0xeb, 0xe6, 0x85, 0xc9, 0x74, 0x05, 0xc6, 0x07, 0x00, 0xeb,
-  0x0f, 0x88, 0xda, 0xc6, 0x07, 0x0d, 0x2a, 0x56, 0xfe, 0x8b, 0x5e, 0xfe,
-  0xfe, 0xca, 0x88, 0x17, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc3, 0x0e, 0x1f,
-  0xcd, 0x21, 0x73, 0x73, 0x3c, 0x01, 0x75, 0x05, 0xba, 0x2e, 0x00, 0xeb,
-  0x15, 0x3c, 0x0b, 0x75, 0x05, 0xba, 0x2e, 0x00, 0xeb, 0x0c, 0x3c, 0x0a,
-  0x75, 0x05, 0xba, 0x43, 0x00, 0xeb, 0x03, 0xba, 0x5d, 0x00, 0xb4, 0x09,
-  0xcd, 0x21, 0xb0, 0xff, 0xb4, 0x4c, 0xcd, 0x21, 0x42, 0x61, 0x64, 0x20,
-  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x78,
-  0x65, 0x63, 0x0d, 0x0a, 0x24, 0x42, 0x61, 0x64, 0x20, 0x65, 0x6e, 0x76,
-  0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x6e, 0x20,
-  0x65, 0x78, 0x65, 0x63, 0x0d, 0x0a, 0x24, 0x4e, 0x6f, 0x74, 0x20, 0x65,
-  0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
-  0x20, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x0d, 0x0a, 0x24, 0xbe,
-  0x8b, 0x00, 0xad, 0x8b, 0xd0, 0xad, 0x8e, 0xd2, 0x8b, 0xe0, 0xad, 0x50,
-  0xad, 0x50, 0x06, 0x1f, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0e, 0x1f, 0xcd, 0x21, 0x73, 0x73, 0x3c, 0x01, 0x75, 0x05, 0xba,
-  0x2e, 0x00, 0xeb, 0x15, 0x3c, 0x0b, 0x75, 0x05, 0xba, 0x2e, 0x00, 0xeb,
-  0x0c, 0x3c, 0x0a, 0x75, 0x05, 0xba, 0x43, 0x00, 0xeb, 0x03, 0xba, 0x5d,
-  0x00, 0xb4, 0x09, 0xcd, 0x21, 0xb0, 0xff, 0xb4, 0x4c, 0xcd, 0x21, 0x42,
-  0x61, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x6f, 0x6e,
-  0x20, 0x65, 0x78, 0x65, 0x63, 0x0d, 0x0a, 0x24, 0x42, 0x61, 0x64, 0x20,
-  0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20,
-  0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x0d, 0x0a, 0x24, 0x4e, 0x6f,
-  0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x0d,
-  0x0a, 0x24, 0x8c, 0xcb, 0x8c, 0xc0, 0x2b, 0xd8, 0x81, 0xfb, 0x00, 0x10,
-  0x76, 0x03, 0xbb, 0x00, 0x10, 0xb1, 0x04, 0xd3, 0xe3, 0x4b, 0x4b, 0x26,
-  0xc7, 0x07, 0x00, 0x00, 0x8e, 0xd0, 0x8b, 0xe3, 0x06, 0xb8, 0x00, 0x01,
-  0x50, 0x06, 0x1f, 0x8b, 0xc5, 0xcb, 0x8b, 0xec, 0x8c, 0xd0, 0x8e, 0xd8,
-  0xa1, 0x38, 0x04, 0x8e, 0xc0, 0x32, 0xc0, 0xbf, 0x5c, 0x00, 0xb9, 0x24,
-  0x00, 0xf3, 0xaa, 0x8b, 0x76, 0x06, 0x8a, 0x0c, 0x41, 0x41, 0x81, 0xf9,
-  0x80, 0x00, 0x76, 0x03, 0xb9, 0x80, 0x00, 0xf3, 0xa4, 0x1e, 0x8c, 0xc0,
-  0x8e, 0xd8, 0xba, 0x80, 0x00, 0xb4, 0x1a, 0xcd, 0x21, 0xbf, 0x5c, 0x00,
-  0xbe, 0x81, 0x00, 0xb0, 0x01, 0xb4, 0x29, 0xcd, 0x21, 0x3c, 0xff, 0x74,
-  0x02, 0x32, 0xc0, 0x8a, 0xd8, 0xbf, 0x6c, 0x00, 0xb0, 0x01, 0xb4, 0x29,
-  0xcd, 0x21, 0x3c, 0xff, 0x74, 0x02, 0x32, 0xc0, 0x8a, 0xf8, 0x1f, 0x8c,
-  0xd8, 0x8e, 0xc0, 0x8b, 0x7e, 0x04, 0x33, 0xc9, 0xf7, 0xd1, 0x32, 0xc0,
-  0xf2, 0xae, 0xf7, 0xd1, 0x89, 0x0e, 0xa6, 0x05, 0x8b, 0xd1, 0x83, 0xc2,
-  0x0f, 0xb1, 0x04, 0xd3, 0xea, 0x8e, 0x06, 0x38, 0x04, 0x26, 0xa1, 0x02,
-  0x00, 0x2b, 0xc2, 0x83, 0xe8, 0x13, 0x8e, 0xc0, 0xa3, 0xa4, 0x05, 0x33,
-  0xff, 0x83, 0x7e, 0x08, 0x00, 0x74, 0x08, 0xbe, 0x56, 0x24, 0xb9, 0x93,
-  0x00, 0xeb, 0x06, 0xbe, 0xe9, 0x24, 0xb9, 0xa1, 0x00, 0x1e, 0x8c, 0xc8,
-  0x8e, 0xd8, 0xf3, 0xa4, 0x1f, 0xbf, 0x30, 0x01, 0x8b, 0x76, 0x04, 0x8b,
-  0x0e, 0xa6, 0x05, 0xf3, 0xa4, 0x8b, 0x0e, 0x38, 0x04, 0x83, 0xc1, 0x10,
-  0x83, 0x7e, 0x08, 0x00, 0x74, 0x20, 0x8b, 0x46, 0x0a, 0x03, 0xc1, 0x26,
-  0xa3, 0x8b, 0x00, 0x8b, 0x46, 0x0c, 0x26, 0xa3, 0x8d, 0x00, 0x8b, 0x46,
-  0x0e, 0x03, 0xc1, 0x26, 0xa3, 0x8f, 0x00, 0x8b, 0x46, 0x10, 0x26, 0xa3,
-  0x91, 0x00, 0xff, 0x1e, 0x50, 0x04, 0x8b, 0xeb, 0x8c, 0xc0, 0xba, 0x30,
-  0x01, 0x8e, 0xd0, 0x8b, 0xe2, 0x8e, 0x06, 0x38, 0x04, 0xbb, 0x00, 0x01,
-  0x26, 0x89, 0x0f, 0x26, 0x89, 0x4f, 0x02, 0xb8, 0x03, 0x4b, 0xff, 0x2e,
-  0xa2, 0x05, 0xa1, 0xa8, 0x05, 0xc3, 0x53, 0x51, 0x56, 0x57, 0x55, 0x89,
-  0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x89, 0x56, 0xfe, 0x83, 0x7c, 0x06,
-  0x00, 0x74, 0x60, 0x31, 0xff, 0xf6, 0x44, 0x07, 0x10, 0x75, 0x5d, 0x8b,
-  0x44, 0x02, 0x85, 0xc0, 0x74, 0x16, 0xf7, 0xd8, 0x8b, 0x5c, 0x08, 0x99,
-  0x89, 0x5e, 0xfc, 0x89, 0xd1, 0x89, 0xc3, 0xba, 0x01, 0x00, 0x8b, 0x46,
-  0xfc, 0xe8, 0xf8, 0xfa, 0x83, 0x7e, 0xfe, 0x00, 0x74, 0x08, 0x8b, 0x44,
-  0x08, 0xe8, 0xcb, 0x01, 0x09, 0xc7, 0xf6, 0x44, 0x06, 0x08, 0x74, 0x11,
-  0x8b, 0x5c, 0x04, 0x8b, 0x47, 0x04, 0xe8, 0xb5, 0xf1, 0x8b, 0x5c, 0x04,
-  0xc7, 0x47, 0x04, 0x00, 0x00, 0xf6, 0x44, 0x07, 0x08, 0x74, 0x06, 0x89,
-  0xf0, 0xff, 0x16, 0xcc, 0x08, 0x89, 0xf8, 0x89, 0xec, 0x5d, 0x5f, 0x5e,
-  0x59, 0x5b, 0xc3, 0xbf, 0xff, 0xff, 0xeb, 0xf1, 0xe8, 0x1e, 0xf0, 0x89,
-  0xc7, 0xeb, 0x9c, 0x53, 0x89, 0xc3, 0xe8, 0x79, 0xff, 0x89, 0xc2, 0x89,
-  0xd8, 0xe8, 0x26, 0x00, 0x89, 0xd0, 0x5b, 0xc3, 0x53, 0x52, 0x8b, 0x1e,
-  0xb8, 0x07, 0x85, 0xdb, 0x74, 0x09, 0x3b, 0x47, 0x02, 0x74, 0x0a, 0x8b,
-  0x1f, 0xeb, 0xf3, 0xb8, 0xff, 0xff, 0x5a, 0x5b, 0xc3, 0xba, 0x01, 0x00,
-  0xe8, 0xd0, 0xff, 0x5a, 0x5b, 0xc3, 0x53, 0x56, 0x57, 0x89, 0xc7, 0xbe,
-  0xb8, 0x07, 0x8b, 0x1c, 0x85, 0xdb, 0x74, 0x1b, 0x3b, 0x7f, 0x02, 0x74,
-  0x04, 0x89, 0xde, 0xeb, 0xf1, 0x80, 0x4d, 0x06, 0x03, 0x8b, 0x3f, 0x89,
-  0x3c, 0x8b, 0x36, 0xba, 0x07, 0x89, 0x1e, 0xba, 0x07, 0x89, 0x37, 0x5f,
-  0x5e, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x8b, 0x0e, 0xba, 0x07, 0x85, 0xc9,
-  0x75, 0x08, 0x89, 0x0e, 0xba, 0x07, 0x5a, 0x59, 0x5b, 0xc3, 0x89, 0xcb,
-  0x89, 0xc8, 0x89, 0x0e, 0xba, 0x07, 0x8b, 0x17, 0xe8, 0x0b, 0xf1, 0x89,
-  0xd1, 0xeb, 0xe3, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x02,
-  0x89, 0xc6, 0x89, 0x56, 0xfe, 0x89, 0xdf, 0xe8, 0x3c, 0x01, 0xa8, 0x80,
-  0x74, 0x14, 0xb0, 0x02, 0x89, 0xf3, 0x31, 0xd2, 0x31, 0xc9, 0xb4, 0x42,
-  0xcd, 0x21, 0xd1, 0xd2, 0xd1, 0xca, 0x85, 0xd2, 0x7c, 0x26, 0x8b, 0x56,
-  0xfe, 0x89, 0xf9, 0x89, 0xf3, 0xb4, 0x40, 0xcd, 0x21, 0x19, 0xd2, 0x89,
-  0xc6, 0x85, 0xd2, 0x7c, 0x13, 0x39, 0xf8, 0x74, 0x06, 0xb8, 0x0c, 0x00,
-  0xe8, 0x34, 0xe1, 0x89, 0xf0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0xc3,
-  0xe8, 0xa7, 0xe8, 0xeb, 0xf4, 0xe9, 0x9c, 0x02, 0x53, 0x89, 0xc3, 0xf6,
-  0x47, 0x07, 0x20, 0x74, 0x02, 0x5b, 0xc3, 0x8b, 0x47, 0x08, 0xe8, 0x11,
-  0x01, 0x85, 0xc0, 0x74, 0xf4, 0x80, 0x4f, 0x07, 0x20, 0xf6, 0x47, 0x07,
-  0x07, 0x75, 0xea, 0x80, 0x4f, 0x07, 0x02, 0x5b, 0xc3, 0x52, 0x89, 0xc2,
-  0xa1, 0xaa, 0x05, 0x89, 0x16, 0xaa, 0x05, 0x5a, 0xc3, 0x03, 0x06, 0x36,
-  0x04, 0x53, 0x51, 0x52, 0x89, 0xc2, 0x3b, 0x06, 0x40, 0x04, 0x72, 0x3b,
-  0x89, 0xc3, 0xb1, 0x04, 0x83, 0xc3, 0x0f, 0xd3, 0xeb, 0x85, 0xdb, 0x75,
-  0x03, 0xbb, 0x00, 0x10, 0x8c, 0xd8, 0x80, 0x3e, 0x3c, 0x04, 0x00, 0x75,
-  0x0b, 0x8c, 0xd0, 0x2b, 0x06, 0x38, 0x04, 0x01, 0xc3, 0xa1, 0x38, 0x04,
-  0x8e, 0xc0, 0xb4, 0x4a, 0xcd, 0x21, 0x1b, 0xc0, 0x85, 0xc0, 0x75, 0x0b,
-  0xa1, 0x36, 0x04, 0x89, 0x16, 0x36, 0x04, 0x5a, 0x59, 0x5b, 0xc3, 0xe8,
-  0x60, 0xdb, 0x89, 0xc3, 0xb8, 0xff, 0xff, 0xc7, 0x07, 0x05, 0x00, 0xeb,
-  0xee, 0x53, 0x51, 0x56, 0x57, 0x89, 0xc3, 0x89, 0xd0, 0x8c, 0xda, 0xe8,
-  0x14, 0x02, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x53, 0x89, 0xc3, 0x8c, 0xc8,
-  0x89, 0x47, 0x02, 0x8c, 0xd8, 0x89, 0x47, 0x06, 0x8c, 0xc0, 0x89, 0x07,
-  0x8c, 0xd0, 0x89, 0x47, 0x04, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x56, 0x89,
-  0xc1, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0x19, 0xd2, 0x31, 0xf6, 0x85,
-  0xd2, 0x7f, 0x02, 0x75, 0x0e, 0x89, 0xc8, 0x31, 0xd2, 0xe8, 0x3d, 0x00,
-  0x89, 0xf0, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xb8, 0x04, 0x00, 0xbe, 0xff,
-  0xff, 0xe8, 0x43, 0xe0, 0xeb, 0xe7, 0x51, 0x89, 0xd1, 0x89, 0xc2, 0x8a,
-  0xc1, 0xb4, 0x3d, 0xcd, 0x21, 0x72, 0x02, 0x89, 0x07, 0xe8, 0x08, 0xe8,
-  0x59, 0xc3, 0x53, 0x3b, 0x06, 0xac, 0x05, 0x72, 0x04, 0x31, 0xc0, 0x5b,
-  0xc3, 0x8b, 0x1e, 0xd6, 0x05, 0xd1, 0xe0, 0x01, 0xc3, 0x8b, 0x07, 0x5b,
-  0xc3, 0x53, 0x3b, 0x06, 0xac, 0x05, 0x72, 0x02, 0x5b, 0xc3, 0x8b, 0x1e,
-  0xd6, 0x05, 0xd1, 0xe0, 0x01, 0xc3, 0x89, 0x17, 0x5b, 0xc3, 0x53, 0x51,
-  0x52, 0x89, 0xc3, 0xb8, 0x00, 0x44, 0xcd, 0x21, 0x19, 0xc9, 0xf6, 0xc2,
-  0x80, 0x74, 0x07, 0xb8, 0x01, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0x31, 0xc0,
-  0xeb, 0xf8, 0x51, 0x89, 0xd1, 0x89, 0xc2, 0xb4, 0x3c, 0xcd, 0x21, 0x72,
-  0x02, 0x89, 0x07, 0xe8, 0xae, 0xe7, 0x59, 0xc3, 0x51, 0x89, 0xd1, 0x89,
-  0xc2, 0xb4, 0x5b, 0xcd, 0x21, 0x72, 0x02, 0x89, 0x07, 0xe8, 0x9c, 0xe7,
-  0x90, 0x59, 0xc3, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc3, 0xd1, 0xe0,
-  0x81, 0x3e, 0xd6, 0x05, 0xae, 0x05, 0x74, 0x1d, 0x8b, 0x0e, 0xd6, 0x05,
-  0x89, 0xc2, 0x89, 0xc8, 0xe8, 0xa4, 0x04, 0x89, 0xc2, 0x85, 0xd2, 0x75,
-  0x38, 0xb8, 0x05, 0x00, 0xe8, 0x98, 0xdf, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8b, 0x16, 0xac, 0x05, 0x89, 0x16, 0xce, 0x08, 0xe8, 0x6c, 0xe7,
-  0x89, 0xc7, 0x89, 0xc2, 0x85, 0xc0, 0x74, 0xdd, 0x8b, 0x0e, 0xac, 0x05,
-  0xbe, 0xae, 0x05, 0xd1, 0xe1, 0x57, 0x8c, 0xd8, 0x8e, 0xc0, 0xd1, 0xe9,
-  0xf3, 0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0xeb, 0xc4, 0x8b, 0x3e, 0xac,
-  0x05, 0x89, 0xd9, 0x30, 0xc0, 0x2b, 0x0e, 0xac, 0x05, 0xd1, 0xe7, 0xd1,
-  0xe1, 0x01, 0xd7, 0x57, 0x1e, 0x07, 0x8a, 0xe0, 0xd1, 0xe9, 0xf3, 0xab,
-  0x13, 0xc9, 0xf3, 0xaa, 0x5f, 0x89, 0x16, 0xd6, 0x05, 0x89, 0x1e, 0xac,
-  0x05, 0xeb, 0xa4, 0xa1, 0xd6, 0x05, 0x3d, 0xae, 0x05, 0x75, 0x01, 0xc3,
-  0xe8, 0xbb, 0xee, 0xa1, 0xce, 0x08, 0xc7, 0x06, 0xd6, 0x05, 0xae, 0x05,
-  0xa3, 0xac, 0x05, 0xc3, 0x53, 0x51, 0x56, 0x89, 0xc3, 0xa1, 0xac, 0x05,
-  0x39, 0xc3, 0x72, 0x10, 0x89, 0xc1, 0x3d, 0x01, 0x00, 0x7e, 0x2d, 0xb8,
-  0x01, 0x00, 0x01, 0xc8, 0x40, 0xe8, 0x47, 0xff, 0x3b, 0x1e, 0xac, 0x05,
-  0x73, 0x22, 0x89, 0xd9, 0xd1, 0xe1, 0x85, 0xd2, 0x74, 0x1f, 0x89, 0xd8,
-  0xe8, 0x22, 0x00, 0x8b, 0x36, 0xd6, 0x05, 0x01, 0xce, 0x80, 0xce, 0x40,
-  0x89, 0x14, 0x89, 0xd8, 0x5e, 0x59, 0x5b, 0xc3, 0x31, 0xc0, 0xeb, 0xd2,
-  0xbb, 0xff, 0xff, 0xeb, 0xf1, 0x8b, 0x36, 0xd6, 0x05, 0x01, 0xce, 0xeb,
-  0xe7, 0x53, 0x52, 0x3d, 0x05, 0x00, 0x7d, 0x10, 0x89, 0xc2, 0x8b, 0x1e,
-  0xd6, 0x05, 0xd1, 0xe2, 0x01, 0xd3, 0xf6, 0x47, 0x01, 0x40, 0x74, 0x03,
-  0x5a, 0x5b, 0xc3, 0x80, 0x4f, 0x01, 0x40, 0xe8, 0xb0, 0xfe, 0x85, 0xc0,
-  0x74, 0xf2, 0x8b, 0x1e, 0xd6, 0x05, 0x01, 0xd3, 0x80, 0x4f, 0x01, 0x20,
-  0x5a, 0x5b, 0xc3, 0x52, 0x89, 0xc2, 0xe8, 0xc8, 0xff, 0x89, 0xd0, 0xe8,
-  0x68, 0xfe, 0x5a, 0xc3, 0x53, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21, 0xe8,
-  0x62, 0xe6, 0x5b, 0xc3, 0x53, 0x89, 0xc3, 0xb4, 0x68, 0xf8, 0xcd, 0x21,
-  0xe8, 0x55, 0xe6, 0x90, 0x5b, 0xc3, 0x55, 0x1e, 0x52, 0x50, 0x32, 0xff,
-  0x8b, 0xcb, 0xd1, 0xe3, 0x03, 0xd9, 0x81, 0xc3, 0xff, 0x2a, 0x8c, 0xc9,
-  0x8e, 0xc1, 0xe8, 0x2c, 0x00, 0x53, 0x1e, 0x55, 0x8b, 0xec, 0xc5, 0x5e,
-  0x06, 0x9c, 0x8f, 0x47, 0x12, 0x89, 0x07, 0x89, 0x4f, 0x04, 0x89, 0x57,
-  0x06, 0x89, 0x77, 0x0a, 0x89, 0x7f, 0x0c, 0x8f, 0x47, 0x08, 0x8f, 0x47,
-  0x0e, 0x8f, 0x47, 0x02, 0x8c, 0x47, 0x10, 0x83, 0xc4, 0x04, 0x1f, 0x5d,
-  0xc3, 0x06, 0x53, 0x8e, 0xda, 0x8b, 0xd8, 0xff, 0x77, 0x0e, 0x8b, 0x07,
-  0x8b, 0x4f, 0x04, 0x8b, 0x57, 0x06, 0x8b, 0x77, 0x0a, 0x8b, 0x7f, 0x0c,
-  0x8b, 0x6f, 0x08, 0x8e, 0x47, 0x10, 0x8b, 0x5f, 0x02, 0x1f, 0xcb, 0xcd,
-  0x00, 0xc3, 0xcd, 0x01, 0xc3, 0xcd, 0x02, 0xc3, 0xcc, 0x90, 0xc3, 0xcd,
-  0x04, 0xc3, 0xcd, 0x05, 0xc3, 0xcd, 0x06, 0xc3, 0xcd, 0x07, 0xc3, 0xcd,
-  0x08, 0xc3, 0xcd, 0x09, 0xc3, 0xcd, 0x0a, 0xc3, 0xcd, 0x0b, 0xc3, 0xcd,
-  0x0c, 0xc3, 0xcd, 0x0d, 0xc3, 0xcd, 0x0e, 0xc3, 0xcd, 0x0f, 0xc3, 0xcd,
-  0x10, 0xc3, 0xcd, 0x11, 0xc3, 0xcd, 0x12, 0xc3, 0xcd, 0x13, 0xc3, 0xcd,
-  0x14, 0xc3, 0xcd, 0x15, 0xc3, 0xcd, 0x16, 0xc3, 0xcd, 0x17, 0xc3, 0xcd,
-  0x18, 0xc3, 0xcd, 0x19, 0xc3, 0xcd, 0x1a, 0xc3, 0xcd, 0x1b, 0xc3, 0xcd,
-  0x1c, 0xc3, 0xcd, 0x1d, 0xc3, 0xcd, 0x1e, 0xc3, 0xcd, 0x1f, 0xc3, 0xcd,
-  0x20, 0xc3, 0xcd, 0x21, 0xc3, 0xcd, 0x22, 0xc3, 0xcd, 0x23, 0xc3, 0xcd,
-  0x24, 0xc3, 0xe9, 0x8e, 0x02, 0xe9, 0x95, 0x02, 0xcd, 0x27, 0xc3, 0xcd,
-  0x28, 0xc3, 0xcd, 0x29, 0xc3, 0xcd, 0x2a, 0xc3, 0xcd, 0x2b, 0xc3, 0xcd,
-  0x2c, 0xc3, 0xcd, 0x2d, 0xc3, 0xcd, 0x2e, 0xc3, 0xcd, 0x2f, 0xc3, 0xcd,
-  0x30, 0xc3, 0xcd, 0x31, 0xc3, 0xcd, 0x32, 0xc3, 0xcd, 0x33, 0xc3, 0xcd,
-  0x34, 0xc3, 0xcd, 0x35, 0xc3, 0xcd, 0x36, 0xc3, 0xcd, 0x37, 0xc3, 0xcd,
-  0x38, 0xc3, 0xcd, 0x39, 0xc3, 0xcd, 0x3a, 0xc3, 0xcd, 0x3b, 0xc3, 0xcd,
-  0x3c, 0xc3, 0xcd, 0x3d, 0xc3, 0xcd, 0x3e, 0xc3, 0xcd, 0x3f, 0xc3, 0xcd,
-  0x40, 0xc3, 0xcd, 0x41, 0xc3, 0xcd, 0x42, 0xc3, 0xcd, 0x43, 0xc3, 0xcd,
-  0x44, 0xc3, 0xcd, 0x45, 0xc3, 0xcd, 0x46, 0xc3, 0xcd, 0x47, 0xc3, 0xcd,
-  0x48, 0xc3, 0xcd, 0x49, 0xc3, 0xcd, 0x4a, 0xc3, 0xcd, 0x4b, 0xc3, 0xcd,
-  0x4c, 0xc3, 0xcd, 0x4d, 0xc3, 0xcd, 0x4e, 0xc3, 0xcd, 0x4f, 0xc3, 0xcd,
-  0x50, 0xc3, 0xcd, 0x51, 0xc3, 0xcd, 0x52, 0xc3, 0xcd, 0x53, 0xc3, 0xcd,
-  0x54, 0xc3, 0xcd, 0x55, 0xc3, 0xcd, 0x56, 0xc3, 0xcd, 0x57, 0xc3, 0xcd,
-  0x58, 0xc3, 0xcd, 0x59, 0xc3, 0xcd, 0x5a, 0xc3, 0xcd, 0x5b, 0xc3, 0xcd,
-  0x5c, 0xc3, 0xcd, 0x5d, 0xc3, 0xcd, 0x5e, 0xc3, 0xcd, 0x5f, 0xc3, 0xcd,
-  0x60, 0xc3, 0xcd, 0x61, 0xc3, 0xcd, 0x62, 0xc3, 0xcd, 0x63, 0xc3, 0xcd,
-  0x64, 0xc3, 0xcd, 0x65, 0xc3, 0xcd, 0x66, 0xc3, 0xcd, 0x67, 0xc3, 0xcd,
-  0x68, 0xc3, 0xcd, 0x69, 0xc3, 0xcd, 0x6a, 0xc3, 0xcd, 0x6b, 0xc3, 0xcd,
-  0x6c, 0xc3, 0xcd, 0x6d, 0xc3, 0xcd, 0x6e, 0xc3, 0xcd, 0x6f, 0xc3, 0xcd,
-  0x70, 0xc3, 0xcd, 0x71, 0xc3, 0xcd, 0x72, 0xc3, 0xcd, 0x73, 0xc3, 0xcd,
-  0x74, 0xc3, 0xcd, 0x75, 0xc3, 0xcd, 0x76, 0xc3, 0xcd, 0x77, 0xc3, 0xcd,
-  0x78, 0xc3, 0xcd, 0x79, 0xc3, 0xcd, 0x7a, 0xc3, 0xcd, 0x7b, 0xc3, 0xcd,
-  0x7c, 0xc3, 0xcd, 0x7d, 0xc3, 0xcd, 0x7e, 0xc3, 0xcd, 0x7f, 0xc3, 0xcd,
-  0x80, 0xc3, 0xcd, 0x81, 0xc3, 0xcd, 0x82, 0xc3, 0xcd, 0x83, 0xc3, 0xcd,
-  0x84, 0xc3, 0xcd, 0x85, 0xc3, 0xcd, 0x86, 0xc3, 0xcd, 0x87, 0xc3, 0xcd,
-  0x88, 0xc3, 0xcd, 0x89, 0xc3, 0xcd, 0x8a, 0xc3, 0xcd, 0x8b, 0xc3, 0xcd,
-  0x8c, 0xc3, 0xcd, 0x8d, 0xc3, 0xcd, 0x8e, 0xc3, 0xcd, 0x8f, 0xc3, 0xcd,
-  0x90, 0xc3, 0xcd, 0x91, 0xc3, 0xcd, 0x92, 0xc3, 0xcd, 0x93, 0xc3, 0xcd,
-  0x94, 0xc3, 0xcd, 0x95, 0xc3, 0xcd, 0x96, 0xc3, 0xcd, 0x97, 0xc3, 0xcd,
-  0x98, 0xc3, 0xcd, 0x99, 0xc3, 0xcd, 0x9a, 0xc3, 0xcd, 0x9b, 0xc3, 0xcd,
-  0x9c, 0xc3, 0xcd, 0x9d, 0xc3, 0xcd, 0x9e, 0xc3, 0xcd, 0x9f, 0xc3, 0xcd,
-  0xa0, 0xc3, 0xcd, 0xa1, 0xc3, 0xcd, 0xa2, 0xc3, 0xcd, 0xa3, 0xc3, 0xcd,
-  0xa4, 0xc3, 0xcd, 0xa5, 0xc3, 0xcd, 0xa6, 0xc3, 0xcd, 0xa7, 0xc3, 0xcd,
-  0xa8, 0xc3, 0xcd, 0xa9, 0xc3, 0xcd, 0xaa, 0xc3, 0xcd, 0xab, 0xc3, 0xcd,
-  0xac, 0xc3, 0xcd, 0xad, 0xc3, 0xcd, 0xae, 0xc3, 0xcd, 0xaf, 0xc3, 0xcd,
-  0xb0, 0xc3, 0xcd, 0xb1, 0xc3, 0xcd, 0xb2, 0xc3, 0xcd, 0xb3, 0xc3, 0xcd,
-  0xb4, 0xc3, 0xcd, 0xb5, 0xc3, 0xcd, 0xb6, 0xc3, 0xcd, 0xb7, 0xc3, 0xcd,
-  0xb8, 0xc3, 0xcd, 0xb9, 0xc3, 0xcd, 0xba, 0xc3, 0xcd, 0xbb, 0xc3, 0xcd,
-  0xbc, 0xc3, 0xcd, 0xbd, 0xc3, 0xcd, 0xbe, 0xc3, 0xcd, 0xbf, 0xc3, 0xcd,
-  0xc0, 0xc3, 0xcd, 0xc1, 0xc3, 0xcd, 0xc2, 0xc3, 0xcd, 0xc3, 0xc3, 0xcd,
-  0xc4, 0xc3, 0xcd, 0xc5, 0xc3, 0xcd, 0xc6, 0xc3, 0xcd, 0xc7, 0xc3, 0xcd,
-  0xc8, 0xc3, 0xcd, 0xc9, 0xc3, 0xcd, 0xca, 0xc3, 0xcd, 0xcb, 0xc3, 0xcd,
-  0xcc, 0xc3, 0xcd, 0xcd, 0xc3, 0xcd, 0xce, 0xc3, 0xcd, 0xcf, 0xc3, 0xcd,
-  0xd0, 0xc3, 0xcd, 0xd1, 0xc3, 0xcd, 0xd2, 0xc3, 0xcd, 0xd3, 0xc3, 0xcd,
-  0xd4, 0xc3, 0xcd, 0xd5, 0xc3, 0xcd, 0xd6, 0xc3, 0xcd, 0xd7, 0xc3, 0xcd,
-  0xd8, 0xc3, 0xcd, 0xd9, 0xc3, 0xcd, 0xda, 0xc3, 0xcd, 0xdb, 0xc3, 0xcd,
-  0xdc, 0xc3, 0xcd, 0xdd, 0xc3, 0xcd, 0xde, 0xc3, 0xcd, 0xdf, 0xc3, 0xcd,
-  0xe0, 0xc3, 0xcd, 0xe1, 0xc3, 0xcd, 0xe2, 0xc3, 0xcd, 0xe3, 0xc3, 0xcd,
-  0xe4, 0xc3, 0xcd, 0xe5, 0xc3, 0xcd, 0xe6, 0xc3, 0xcd, 0xe7, 0xc3, 0xcd,
-  0xe8, 0xc3, 0xcd, 0xe9, 0xc3, 0xcd, 0xea, 0xc3, 0xcd, 0xeb, 0xc3, 0xcd,
-  0xec, 0xc3, 0xcd, 0xed, 0xc3, 0xcd, 0xee, 0xc3, 0xcd, 0xef, 0xc3, 0xcd,
-  0xf0, 0xc3, 0xcd, 0xf1, 0xc3, 0xcd, 0xf2, 0xc3, 0xcd, 0xf3, 0xc3, 0xcd,
-  0xf4, 0xc3, 0xcd, 0xf5, 0xc3, 0xcd, 0xf6, 0xc3, 0xcd, 0xf7, 0xc3, 0xcd,
-  0xf8, 0xc3, 0xcd, 0xf9, 0xc3, 0xcd, 0xfa, 0xc3, 0xcd, 0xfb, 0xc3, 0xcd,
-  0xfc, 0xc3, 0xcd, 0xfd, 0xc3, 0xcd, 0xfe, 0xc3, 0xcd, 0xff, 0xc3, 0xcd,
-  0x25, 0x73, 0x03, 0x9d, 0xf9, 0xc3, 0x9d, 0xf8, 0xc3, 0xcd, 0x26, 0x73,
-  0x03, 0x9d, 0xf9, 0xc3, 0x9d, 0xf8, 0xc3, 0x53, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xe5, 0x83, 0xec, 0x02, 0x89, 0xc3, 0x89, 0xd1, 0x85, 0xc0, 0x74,
-  0x45, 0x85, 0xd2, 0x74, 0x48, 0xe8, 0x55, 0x00, 0x89, 0xc6, 0x89, 0xd8,
-  0xe8, 0x5d, 0x00, 0x89, 0x46, 0xfe, 0x85, 0xc0, 0x75, 0x25, 0x89, 0xc8,
-  0xe8, 0xb9, 0xe2, 0x89, 0x46, 0xfe, 0x85, 0xc0, 0x74, 0x32, 0x89, 0xf1,
-  0x89, 0xc7, 0x89, 0xde, 0x57, 0x8c, 0xd8, 0x8e, 0xc0, 0xd1, 0xe9, 0xf3,
-  0xa5, 0x13, 0xc9, 0xf3, 0xa4, 0x5f, 0x89, 0xd8, 0xe8, 0x3f, 0xea, 0x8b,
-  0x46, 0xfe, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x89, 0xd0,
-  0xe8, 0x89, 0xe2, 0xeb, 0xf1, 0xe8, 0x2a, 0xea, 0x31, 0xc0, 0xeb, 0xea,
-  0x89, 0xf2, 0x89, 0xd8, 0xe8, 0x11, 0x00, 0xeb, 0xde, 0x53, 0x89, 0xc3,
-  0x83, 0xeb, 0x02, 0x8b, 0x07, 0x24, 0xfe, 0x2d, 0x02, 0x00, 0x5b, 0xc3,
-  0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x89, 0xc6,
-  0x89, 0xd7, 0x80, 0x66, 0xfe, 0xfe, 0x8d, 0x4e, 0xfc, 0x8c, 0xd8, 0x89,
-  0xfb, 0x89, 0xf2, 0xe8, 0x31, 0x00, 0x85, 0xc0, 0x74, 0x1a, 0x3d, 0x01,
-  0x00, 0x74, 0x0b, 0x3d, 0x02, 0x00, 0x75, 0xe6, 0xf6, 0x46, 0xfe, 0x01,
-  0x74, 0x0d, 0x31, 0xc0, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3,
-  0xe9, 0x92, 0x01, 0x8b, 0x46, 0xfc, 0xe8, 0x05, 0xee, 0x85, 0xc0, 0x74,
-  0xe9, 0x80, 0x4e, 0xfe, 0x01, 0xeb, 0xc3, 0x56, 0x57, 0x55, 0x89, 0xe5,
-  0x83, 0xec, 0x0a, 0x89, 0xde, 0x89, 0x4e, 0xfc, 0x83, 0xc3, 0x03, 0x80,
-  0xe3, 0xfe, 0x39, 0xf3, 0x73, 0x60, 0xbb, 0xff, 0xff, 0x89, 0xd6, 0x8e,
-  0xc0, 0x83, 0xee, 0x02, 0x26, 0x8b, 0x0c, 0x80, 0xe1, 0xfe, 0x89, 0x76,
-  0xf6, 0x39, 0xcb, 0x76, 0x59, 0x8b, 0x7e, 0xfc, 0x29, 0xcb, 0x01, 0xce,
-  0x89, 0x1d, 0x8e, 0xc0, 0x26, 0x8b, 0x1c, 0x89, 0x5e, 0xfe, 0x83, 0xfb,
-  0xff, 0x74, 0x3d, 0xf6, 0x46, 0xfe, 0x01, 0x75, 0x40, 0x26, 0x8b, 0x5c,
-  0x04, 0x89, 0x5e, 0xf8, 0x26, 0x8b, 0x5c, 0x02, 0x89, 0x5e, 0xfa, 0x8c,
-  0xdb, 0x39, 0xd8, 0x75, 0x2f, 0x8b, 0x1e, 0x92, 0x05, 0x8e, 0xc0, 0x26,
-  0x83, 0x7f, 0x04, 0x00, 0x74, 0x2d, 0x39, 0xd3, 0x76, 0x20, 0x8e, 0xc0,
-  0x26, 0x8b, 0x5f, 0x04, 0xeb, 0xeb, 0x83, 0xfb, 0x06, 0x73, 0x9e, 0xbb,
-  0x06, 0x00, 0xeb, 0x99, 0xbb, 0x02, 0x00, 0xe9, 0x93, 0x00, 0xe9, 0x9d,
-  0x00, 0xe9, 0x95, 0x00, 0xeb, 0x53, 0x26, 0x8b, 0x0f, 0x01, 0xd9, 0x39,
-  0xd1, 0x76, 0xd7, 0x8e, 0xc0, 0x26, 0x3b, 0x77, 0x06, 0x75, 0x08, 0x26,
-  0x8b, 0x4c, 0x02, 0x26, 0x89, 0x4f, 0x06, 0x8b, 0x7e, 0xfc, 0x8b, 0x4e,
-  0xfe, 0x3b, 0x0d, 0x73, 0x34, 0x8b, 0x7e, 0xfa, 0x8e, 0xc0, 0x8b, 0x4e,
-  0xf8, 0x26, 0x89, 0x4d, 0x04, 0x89, 0xcf, 0x8b, 0x4e, 0xfa, 0x26, 0x89,
-  0x4d, 0x02, 0x8b, 0x7e, 0xf6, 0x8b, 0x4e, 0xfe, 0x26, 0x01, 0x0d, 0x8b,
-  0x7e, 0xfc, 0x26, 0xff, 0x4f, 0x0e, 0x3b, 0x0d, 0x73, 0x3d, 0x01, 0xce,
-  0x29, 0x0d, 0xe9, 0x55, 0xff, 0x31, 0xdb, 0xeb, 0xb2, 0x2b, 0x0d, 0x83,
-  0xf9, 0x06, 0x72, 0xc5, 0x03, 0x35, 0x8e, 0xc0, 0x8b, 0x5e, 0xfa, 0x26,
-  0x89, 0x5c, 0x02, 0x8b, 0x5e, 0xf8, 0x26, 0x89, 0x5c, 0x04, 0x8b, 0x5e,
-  0xfa, 0x26, 0x89, 0x0c, 0x26, 0x89, 0x77, 0x04, 0x8b, 0x5e, 0xf8, 0x26,
-  0x89, 0x77, 0x02, 0x8b, 0x5e, 0xf6, 0x8b, 0x05, 0x26, 0x01, 0x07, 0x31,
-  0xdb, 0x89, 0xd8, 0x89, 0xec, 0x5d, 0x5f, 0x5e, 0xc3, 0xbb, 0x01, 0x00,
-  0xeb, 0xf3, 0x29, 0xd9, 0x83, 0xf9, 0x06, 0x72, 0xea, 0x8b, 0x7e, 0xf6,
-  0x89, 0xde, 0x80, 0xc9, 0x01, 0x01, 0x5e, 0xf6, 0x83, 0xce, 0x01, 0x8b,
-  0x5e, 0xf6, 0x26, 0x89, 0x35, 0x26, 0x89, 0x0f, 0x8c, 0xdb, 0x39, 0xd8,
-  0x75, 0x33, 0x8b, 0x1e, 0x92, 0x05, 0x8e, 0xc0, 0x26, 0x83, 0x7f, 0x04,
-  0x00, 0x74, 0x15, 0x39, 0xd3, 0x76, 0x08, 0x8e, 0xc0, 0x26, 0x8b, 0x5f,
-  0x04, 0xeb, 0xeb, 0x26, 0x8b, 0x0f, 0x01, 0xd9, 0x39, 0xd1, 0x76, 0xef,
-  0x8b, 0x56, 0xf6, 0x8e, 0xc0, 0x83, 0xc2, 0x02, 0x26, 0xff, 0x47, 0x0c,
-  0xe8, 0x0b, 0x00, 0xeb, 0x9a, 0x31, 0xdb, 0xeb, 0xeb, 0x89, 0xf0, 0xe9,
-  0x5e, 0xfe, 0x53, 0x51, 0x89, 0xc1, 0x89, 0xd0, 0x83, 0xfa, 0xff, 0x74,
-  0x09, 0x8c, 0xda, 0x39, 0xd1, 0x75, 0x06, 0xe8, 0x24, 0xe8, 0x59, 0x5b,
-  0xc3, 0x89, 0xca, 0x31, 0xdb, 0xe8, 0x26, 0xea, 0x59, 0x5b, 0xc3, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x44, 0x4f, 0x53, 0x34, 0x47, 0x50,
-  0x41, 0x54, 0x48, 0x00, 0x50, 0x41, 0x54, 0x48, 0x00, 0x2e, 0x65, 0x78,
-  0x65, 0x00, 0x64, 0x6f, 0x73, 0x34, 0x67, 0x77, 0x2e, 0x65, 0x78, 0x65,
-  0x00, 0x64, 0x6f, 0x73, 0x34, 0x67, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x5c,
-  0x64, 0x6f, 0x73, 0x34, 0x67, 0x77, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x53,
-  0x74, 0x75, 0x62, 0x20, 0x65, 0x78, 0x65, 0x63, 0x20, 0x66, 0x61, 0x69,
-  0x6c, 0x65, 0x64, 0x3a, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x65, 0x72, 0x72,
-  0x6f, 0x72, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x66,
-  0x69, 0x6c, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x6f, 0x72, 0x79, 0x00, 0x41, 0x72, 0x67, 0x20, 0x6c, 0x69, 0x73,
-  0x74, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x62, 0x69, 0x67, 0x00, 0x45, 0x78,
-  0x65, 0x63, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x65, 0x72,
-  0x72, 0x6f, 0x72, 0x00, 0x42, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65,
-  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x4e, 0x6f, 0x74, 0x20,
-  0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
-  0x79, 0x00, 0x50, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x64, 0x65, 0x6e, 0x69, 0x65, 0x64, 0x00, 0x46, 0x69, 0x6c, 0x65,
-  0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x00, 0x43, 0x72, 0x6f, 0x73,
-  0x73, 0x2d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6c, 0x69, 0x6e,
-  0x6b, 0x00, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x46, 0x69, 0x6c, 0x65, 0x20,
-  0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c,
-  0x6f, 0x77, 0x00, 0x54, 0x6f, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20,
-  0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x4e,
-  0x6f, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74,
-  0x20, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x41,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x6f, 0x20,
-  0x6c, 0x61, 0x72, 0x67, 0x65, 0x00, 0x52, 0x65, 0x73, 0x75, 0x6c, 0x74,
-  0x20, 0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x00, 0x52,
-  0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64, 0x65, 0x61, 0x64,
-  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6f,
-  0x63, 0x63, 0x75, 0x72, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
-  0x63, 0x61, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x75,
-  0x70, 0x74, 0x65, 0x64, 0x00, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x20, 0x64,
-  0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73,
-  0x74, 0x00, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x75,
-  0x6e, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20,
-  0x74, 0x72, 0x79, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x00, 0x44, 0x65,
-  0x76, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x73, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x20, 0x62, 0x75, 0x73, 0x79, 0x00, 0x46, 0x69,
-  0x6c, 0x65, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65,
-  0x00, 0x49, 0x2f, 0x4f, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x49,
-  0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72,
-  0x79, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x54, 0x6f, 0x6f, 0x20, 0x6d, 0x61,
-  0x6e, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x73, 0x00, 0x42, 0x6c, 0x6f,
-  0x63, 0x6b, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x72, 0x65,
-  0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x61,
-  0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x64,
-  0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20,
-  0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x00, 0x4e, 0x6f, 0x74, 0x20,
-  0x6f, 0x77, 0x6e, 0x65, 0x72, 0x00, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x6e,
-  0x20, 0x70, 0x69, 0x70, 0x65, 0x00, 0x52, 0x65, 0x61, 0x64, 0x2d, 0x6f,
-  0x6e, 0x6c, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x79, 0x73,
-  0x74, 0x65, 0x6d, 0x00, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20,
-  0x73, 0x65, 0x65, 0x6b, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63, 0x68,
-  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x00, 0x54, 0x65, 0x78,
-  0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x62, 0x75, 0x73, 0x79, 0x00,
-  0x42, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x00,
-  0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x6f,
-  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x75, 0x63,
-  0x68, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x4e, 0x6f, 0x20,
-  0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
-  0x6d, 0x00, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x73, 0x79,
-  0x73, 0x74, 0x65, 0x6d, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x44, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-  0x65, 0x6d, 0x70, 0x74, 0x79, 0x00, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61,
-  0x6c, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x62, 0x79, 0x74, 0x65, 0x20,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x00, 0x75, 0x6e, 0x6b,
-  0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x3a,
-  0x20, 0x00, 0x0a, 0x00, 0x50, 0x41, 0x54, 0x48, 0x00, 0x00, 0x4e, 0x6f,
-  0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x0d,
-  0x0a, 0x00, 0x2e, 0x63, 0x6f, 0x6d, 0x00, 0x2e, 0x65, 0x78, 0x65, 0x00,
-  0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6c, 0x6c,
-  0x6f, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73,
-  0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x00, 0x22, 0x00,
-  0x2c, 0x00, 0x6a, 0x00, 0x73, 0x00, 0x8d, 0x00, 0x9e, 0x00, 0xb0, 0x00,
-  0xc0, 0x00, 0xd2, 0x00, 0xe4, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x13, 0x01,
-  0x27, 0x01, 0x3b, 0x01, 0x53, 0x01, 0x66, 0x01, 0x77, 0x01, 0x95, 0x01,
-  0xad, 0x01, 0xc2, 0x01, 0xe2, 0x01, 0xfa, 0x01, 0x09, 0x02, 0x13, 0x02,
-  0x22, 0x02, 0x32, 0x02, 0x41, 0x02, 0x57, 0x02, 0x6e, 0x02, 0x88, 0x02,
-  0x92, 0x02, 0x9e, 0x02, 0xb4, 0x02, 0xc1, 0x02, 0xd1, 0x02, 0xe0, 0x02,
-  0xec, 0x02, 0xfe, 0x02, 0x0d, 0x03, 0x2a, 0x03, 0x3e, 0x03, 0x52, 0x03,
-  0x29, 0x00, 0xac, 0x04, 0xac, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x01, 0x01, 0x0b, 0x06, 0x04, 0x05, 0x05, 0x05, 0x02, 0x03, 0xff, 0x0e,
-  0x07, 0x24, 0x06, 0x08, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xae, 0x05, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x0c, 0x00, 0x00,
-  0x00, 0x20, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x5e, 0x16, 0x00, 0x00,
-  0x00, 0x20, 0x4c, 0x0f, 0x00, 0x00, 0x00, 0x20, 0xb4, 0x1d, 0x00, 0x00,
-  0x00, 0x20, 0x1b, 0x16, 0x00, 0x00, 0x00, 0x01, 0x65, 0x0e, 0x00, 0x00,
-  0x00, 0x1f, 0x17, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x25, 0x17, 0x00, 0x00,
-  0x00, 0x14, 0xd7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x91, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x90, 0x15, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xfb, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00,
-  0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x51, 0x2a, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x51, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x54, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xcf, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x45, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x45, 0x10, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x15, 0x01, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x43, 0x20, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x06, 0x68, 0x65, 0x78, 0x6d, 0x65, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x43, 0x06, 0x00, 0x00, 0x59,
-  0x0a, 0x00, 0x00, 0x48, 0x0f, 0x00, 0x00, 0x1c, 0x13, 0x00, 0x00, 0xe5,
-  0x17, 0x00, 0x00, 0xab, 0x1b, 0x00, 0x00, 0x44, 0x1e, 0x00, 0x00, 0x58,
-  0x20, 0x00, 0x00, 0x45, 0x23, 0x00, 0x00, 0x3a, 0x24, 0x00, 0x00, 0x98,
-  0x25, 0x00, 0x00, 0x6d, 0x27, 0x00, 0x00, 0xcf, 0x27, 0x00, 0x00, 0x54,
-  0x28, 0x00, 0x00, 0xb6, 0x28, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x03,
-  0x03, 0x03, 0x07, 0x00, 0x0e, 0x0f, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x1f,
-  0x0f, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x94, 0x0f, 0x03, 0x6c, 0x0c, 0x07,
-  0x00, 0xd7, 0x0f, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x62, 0x0a, 0x03, 0x50,
-  0x0c, 0x07, 0x00, 0x69, 0x0a, 0x03, 0xd1, 0x0d, 0x07, 0x00, 0x77, 0x0a,
-  0x03, 0xd1, 0x0d, 0x07, 0x00, 0x80, 0x0a, 0x03, 0x68, 0x0c, 0x07, 0x00,
-  0x84, 0x0a, 0x03, 0x58, 0x01, 0x07, 0x00, 0x8f, 0x0a, 0x03, 0xd8, 0x0d,
-  0x07, 0x00, 0x99, 0x0a, 0x03, 0x68, 0x0c, 0x07, 0x00, 0x9d, 0x0a, 0x03,
-  0x7b, 0x01, 0x07, 0x00, 0xad, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xd8,
-  0x0a, 0x03, 0x68, 0x0c, 0x07, 0x00, 0xdc, 0x0a, 0x03, 0x8a, 0x01, 0x07,
-  0x00, 0xe6, 0x0a, 0x03, 0xac, 0x0c, 0x07, 0x00, 0xef, 0x0a, 0x03, 0x68,
-  0x0c, 0x07, 0x00, 0xf3, 0x0a, 0x03, 0xdf, 0x01, 0x07, 0x00, 0xff, 0x0a,
-  0x03, 0x60, 0x0c, 0x07, 0x00, 0x08, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00,
-  0x0e, 0x0b, 0x03, 0x64, 0x0c, 0x07, 0x00, 0x22, 0x0b, 0x03, 0x60, 0x0c,
-  0x07, 0x00, 0x2c, 0x0b, 0x03, 0x64, 0x0c, 0x07, 0x00, 0x35, 0x0b, 0x03,
-  0x60, 0x0c, 0x07, 0x00, 0x3b, 0x0b, 0x03, 0x64, 0x0c, 0x07, 0x00, 0x40,
-  0x0b, 0x03, 0x58, 0x0c, 0x07, 0x00, 0x45, 0x0b, 0x03, 0xa0, 0x0d, 0x07,
-  0x00, 0x4b, 0x0b, 0x03, 0x5c, 0x0c, 0x07, 0x00, 0x7d, 0x0b, 0x03, 0x58,
-  0x0c, 0x07, 0x00, 0x83, 0x0b, 0x03, 0x5c, 0x0c, 0x07, 0x00, 0x89, 0x0b,
-  0x03, 0xc9, 0x0d, 0x07, 0x00, 0x92, 0x0b, 0x03, 0xcb, 0x0d, 0x07, 0x00,
-  0x9b, 0x0b, 0x03, 0x51, 0x0c, 0x07, 0x00, 0xa2, 0x0b, 0x03, 0xc9, 0x0d,
-  0x07, 0x00, 0xab, 0x0b, 0x03, 0x52, 0x0c, 0x07, 0x00, 0xb2, 0x0b, 0x03,
-  0x51, 0x0c, 0x07, 0x00, 0xbb, 0x0b, 0x03, 0x52, 0x0c, 0x07, 0x00, 0xc4,
-  0x0b, 0x03, 0x53, 0x0c, 0x07, 0x00, 0xcd, 0x0b, 0x03, 0x68, 0x0c, 0x07,
-  0x00, 0xd1, 0x0b, 0x03, 0x08, 0x02, 0x07, 0x00, 0xd7, 0x0b, 0x03, 0x53,
-  0x0c, 0x07, 0x00, 0xdf, 0x0b, 0x03, 0x53, 0x0c, 0x07, 0x00, 0xea, 0x0b,
-  0x03, 0x2c, 0x14, 0x07, 0x00, 0xfa, 0x0b, 0x03, 0x2c, 0x14, 0x07, 0x00,
-  0x12, 0x0c, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x1a, 0x0c, 0x03, 0x70, 0x0c,
-  0x07, 0x00, 0x26, 0x0c, 0x03, 0x74, 0x0c, 0x07, 0x00, 0x2b, 0x0c, 0x03,
-  0x70, 0x0c, 0x07, 0x00, 0x30, 0x0c, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x45,
-  0x0c, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x4e, 0x0c, 0x03, 0x74, 0x0c, 0x07,
-  0x00, 0x56, 0x0c, 0x03, 0x78, 0x0c, 0x07, 0x00, 0x75, 0x0c, 0x03, 0x74,
-  0x0c, 0x07, 0x00, 0x85, 0x0c, 0x03, 0x70, 0x0c, 0x07, 0x00, 0x99, 0x0c,
-  0x03, 0x78, 0x0c, 0x07, 0x00, 0x9e, 0x0c, 0x03, 0x6c, 0x0c, 0x07, 0x00,
-  0xa4, 0x0c, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0xca, 0x0c, 0x03, 0x53, 0x0c,
-  0x07, 0x00, 0xfd, 0x0c, 0x03, 0x5c, 0x0c, 0x07, 0x00, 0x0b, 0x0d, 0x03,
-  0x58, 0x0c, 0x07, 0x00, 0x23, 0x0d, 0x03, 0x5c, 0x0c, 0x07, 0x00, 0x31,
-  0x0d, 0x03, 0x58, 0x0c, 0x07, 0x00, 0x40, 0x0d, 0x03, 0x5c, 0x0c, 0x07,
-  0x00, 0x50, 0x0d, 0x03, 0x58, 0x0c, 0x07, 0x00, 0x64, 0x0d, 0x03, 0x5c,
-  0x0c, 0x07, 0x00, 0x72, 0x0d, 0x03, 0x58, 0x0c, 0x07, 0x00, 0x7e, 0x0d,
-  0x03, 0x2c, 0x14, 0x07, 0x00, 0x9d, 0x0d, 0x03, 0x68, 0x0c, 0x07, 0x00,
-  0xa1, 0x0d, 0x03, 0x37, 0x02, 0x07, 0x00, 0xac, 0x0d, 0x03, 0x68, 0x0c,
-  0x07, 0x00, 0xb0, 0x0d, 0x03, 0x78, 0x02, 0x07, 0x00, 0xd1, 0x0d, 0x03,
-  0x68, 0x0c, 0x07, 0x00, 0xd5, 0x0d, 0x03, 0xbb, 0x02, 0x07, 0x00, 0x47,
-  0x0e, 0x03, 0x52, 0x0c, 0x07, 0x00, 0xd3, 0x0e, 0x03, 0x6c, 0x0c, 0x07,
-  0x00, 0xdc, 0x0e, 0x03, 0x78, 0x0c, 0x07, 0x00, 0xfc, 0x0e, 0x03, 0x68,
-  0x0c, 0x07, 0x00, 0x11, 0x00, 0x03, 0x15, 0x00, 0x07, 0x00, 0x16, 0x00,
-  0x03, 0x6c, 0x0a, 0x07, 0x00, 0x5d, 0x00, 0x03, 0x27, 0x00, 0x07, 0x00,
-  0x6d, 0x00, 0x03, 0x2a, 0x00, 0x07, 0x00, 0xb1, 0x00, 0x03, 0x34, 0x0a,
-  0x07, 0x00, 0x13, 0x01, 0x03, 0x2d, 0x00, 0x07, 0x00, 0x18, 0x01, 0x03,
-  0x36, 0x00, 0x07, 0x00, 0x1d, 0x01, 0x03, 0x43, 0x00, 0x07, 0x00, 0x4e,
-  0x01, 0x03, 0x35, 0x0a, 0x07, 0x00, 0xf8, 0x01, 0x03, 0x54, 0x00, 0x07,
-  0x00, 0x05, 0x02, 0x03, 0x52, 0x0a, 0x07, 0x00, 0x14, 0x02, 0x03, 0x59,
-  0x00, 0x07, 0x00, 0x21, 0x02, 0x03, 0x52, 0x0a, 0x07, 0x00, 0x30, 0x02,
-  0x03, 0x5e, 0x00, 0x07, 0x00, 0x3d, 0x02, 0x03, 0x52, 0x0a, 0x07, 0x00,
-  0x4c, 0x02, 0x03, 0x63, 0x00, 0x07, 0x00, 0x59, 0x02, 0x03, 0x52, 0x0a,
-  0x07, 0x00, 0x68, 0x02, 0x03, 0x69, 0x00, 0x07, 0x00, 0x75, 0x02, 0x03,
-  0x52, 0x0a, 0x07, 0x00, 0x84, 0x02, 0x03, 0x70, 0x00, 0x07, 0x00, 0x91,
-  0x02, 0x03, 0x52, 0x0a, 0x07, 0x00, 0xa0, 0x02, 0x03, 0x75, 0x00, 0x07,
-  0x00, 0xad, 0x02, 0x03, 0x52, 0x0a, 0x07, 0x00, 0xbc, 0x02, 0x03, 0x7a,
-  0x00, 0x07, 0x00, 0xc9, 0x02, 0x03, 0x52, 0x0a, 0x07, 0x00, 0xd8, 0x02,
-  0x03, 0x81, 0x00, 0x07, 0x00, 0xdd, 0x02, 0x03, 0x34, 0x0a, 0x07, 0x00,
-  0xff, 0x02, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x08, 0x03, 0x03, 0x48, 0x0e,
-  0x07, 0x00, 0x0f, 0x03, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x17, 0x03, 0x03,
-  0x87, 0x00, 0x07, 0x00, 0x24, 0x03, 0x03, 0xc8, 0x00, 0x07, 0x00, 0x32,
-  0x03, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x3b, 0x03, 0x03, 0xd1, 0x0d, 0x07,
-  0x00, 0x44, 0x03, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x4d, 0x03, 0x03, 0x35,
-  0x0a, 0x07, 0x00, 0x54, 0x03, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x97, 0x03,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0xc2, 0x03, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0xeb, 0x03, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x0d, 0x04, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x2f, 0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x66, 0x04, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x95, 0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xc5,
-  0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xf2, 0x04, 0x03, 0x35, 0x0a, 0x07,
-  0x00, 0xf8, 0x04, 0x03, 0xfd, 0x00, 0x07, 0x00, 0x06, 0x05, 0x03, 0x5c,
-  0x0c, 0x07, 0x00, 0x0c, 0x05, 0x03, 0x58, 0x0c, 0x07, 0x00, 0x12, 0x05,
-  0x03, 0x68, 0x0c, 0x07, 0x00, 0x18, 0x05, 0x03, 0x34, 0x0a, 0x07, 0x00,
-  0x20, 0x05, 0x03, 0x20, 0x01, 0x07, 0x00, 0x27, 0x05, 0x03, 0x24, 0x01,
-  0x07, 0x00, 0x2d, 0x05, 0x03, 0x27, 0x01, 0x07, 0x00, 0x3a, 0x05, 0x03,
-  0x44, 0x01, 0x07, 0x00, 0x5e, 0x05, 0x03, 0x00, 0x11, 0x07, 0x00, 0x6b,
-  0x05, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x7e, 0x05, 0x03, 0x48, 0x0e, 0x07,
-  0x00, 0x8e, 0x05, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x98, 0x05, 0x03, 0x3c,
-  0x0e, 0x07, 0x00, 0xee, 0x05, 0x03, 0x30, 0x0a, 0x07, 0x00, 0x31, 0x06,
-  0x03, 0x30, 0x0a, 0x07, 0x00, 0x55, 0x06, 0x03, 0x30, 0x0a, 0x07, 0x00,
-  0xc2, 0x06, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x1c, 0x07, 0x03, 0x4b, 0x01,
-  0x07, 0x00, 0x8b, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x94, 0x07, 0x03,
-  0x45, 0x0e, 0x07, 0x00, 0xab, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0xb4,
-  0x07, 0x03, 0x45, 0x0e, 0x07, 0x00, 0xf3, 0x07, 0x03, 0x2d, 0x09, 0x07,
-  0x00, 0x55, 0x08, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x80, 0x08, 0x03, 0x48,
-  0x0e, 0x07, 0x00, 0x55, 0x0a, 0x03, 0x50, 0x0c, 0x07, 0x00, 0xbf, 0x0f,
-  0x03, 0xca, 0x0c, 0x07, 0x00, 0xdc, 0x0f, 0x03, 0xd4, 0x0c, 0x07, 0x00,
-  0xe9, 0x0f, 0x03, 0xd8, 0x0c, 0x07, 0x00, 0xf0, 0x0f, 0x03, 0xd5, 0x0c,
-  0x07, 0x00, 0xfc, 0x0f, 0x03, 0xd0, 0x0c, 0x07, 0x00, 0x90, 0x00, 0x03,
-  0x6c, 0x0c, 0x07, 0x00, 0x07, 0x01, 0x03, 0x64, 0x0c, 0x07, 0x00, 0x15,
-  0x01, 0x03, 0x60, 0x0c, 0x07, 0x00, 0x21, 0x01, 0x03, 0x51, 0x0c, 0x07,
-  0x00, 0x53, 0x01, 0x03, 0x60, 0x0c, 0x07, 0x00, 0x5c, 0x01, 0x03, 0x64,
-  0x0c, 0x07, 0x00, 0x8d, 0x01, 0x03, 0x60, 0x0c, 0x07, 0x00, 0xbf, 0x01,
-  0x03, 0x6c, 0x0c, 0x07, 0x00, 0xc8, 0x01, 0x03, 0x78, 0x0c, 0x07, 0x00,
-  0xe4, 0x01, 0x03, 0x68, 0x0c, 0x07, 0x00, 0xe8, 0x01, 0x03, 0x45, 0x03,
-  0x07, 0x00, 0xf7, 0x01, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x21, 0x02, 0x03,
-  0x6c, 0x0c, 0x07, 0x00, 0x0d, 0x03, 0x03, 0x6c, 0x0c, 0x07, 0x00, 0x78,
-  0x03, 0x03, 0x68, 0x0c, 0x07, 0x00, 0x7c, 0x03, 0x03, 0x86, 0x03, 0x07,
-  0x00, 0xad, 0x03, 0x03, 0x28, 0x14, 0x07, 0x00, 0xc2, 0x03, 0x03, 0x28,
-  0x14, 0x07, 0x00, 0xcb, 0x03, 0x03, 0xa8, 0x03, 0x07, 0x00, 0xe2, 0x03,
-  0x03, 0xd8, 0x0f, 0x07, 0x00, 0x4f, 0x04, 0x03, 0xcf, 0x03, 0x07, 0x00,
-  0x70, 0x04, 0x03, 0xe0, 0x03, 0x07, 0x00, 0xe7, 0x04, 0x03, 0xe3, 0x03,
-  0x07, 0x00, 0xf6, 0x04, 0x03, 0xd8, 0x0f, 0x07, 0x00, 0x14, 0x05, 0x03,
-  0xd8, 0x0f, 0x07, 0x00, 0x50, 0x05, 0x03, 0xcf, 0x03, 0x07, 0x00, 0x87,
-  0x05, 0x03, 0x28, 0x14, 0x07, 0x00, 0xd3, 0x05, 0x03, 0x52, 0x0a, 0x07,
-  0x00, 0xb4, 0x0a, 0x01, 0x00, 0x16, 0x07, 0x00, 0xf4, 0x0a, 0x01, 0x1c,
-  0x16, 0x07, 0x00, 0x43, 0x0b, 0x01, 0x38, 0x16, 0x07, 0x00, 0x97, 0x0b,
-  0x01, 0x54, 0x16, 0x07, 0x00, 0xf1, 0x0b, 0x01, 0x70, 0x16, 0x07, 0x00,
-  0xb0, 0x0c, 0x03, 0xec, 0x0c, 0x07, 0x00, 0xb8, 0x0c, 0x03, 0xf0, 0x0c,
-  0x07, 0x00, 0xc7, 0x0c, 0x03, 0xec, 0x0c, 0x07, 0x00, 0xd0, 0x0c, 0x03,
-  0x2b, 0x04, 0x07, 0x00, 0xd5, 0x0c, 0x03, 0x6c, 0x0a, 0x07, 0x00, 0xe9,
-  0x0c, 0x03, 0xec, 0x0c, 0x07, 0x00, 0xf2, 0x0c, 0x03, 0xec, 0x0c, 0x07,
-  0x00, 0x03, 0x0d, 0x03, 0xec, 0x0c, 0x07, 0x00, 0x13, 0x0d, 0x03, 0xec,
-  0x0c, 0x07, 0x00, 0x23, 0x0d, 0x03, 0xec, 0x0c, 0x07, 0x00, 0x30, 0x0d,
-  0x03, 0xec, 0x0c, 0x07, 0x00, 0x84, 0x0d, 0x03, 0xec, 0x0c, 0x07, 0x00,
-  0x8c, 0x0d, 0x03, 0xf0, 0x0c, 0x07, 0x00, 0x9b, 0x0d, 0x03, 0xec, 0x0c,
-  0x07, 0x00, 0xa4, 0x0d, 0x03, 0x2b, 0x04, 0x07, 0x00, 0xa9, 0x0d, 0x03,
-  0x6c, 0x0a, 0x07, 0x00, 0xc2, 0x0d, 0x03, 0xf2, 0x0c, 0x07, 0x00, 0xc8,
-  0x0d, 0x03, 0xec, 0x0c, 0x07, 0x00, 0xdd, 0x0d, 0x03, 0xec, 0x0c, 0x07,
-  0x00, 0xe7, 0x0d, 0x03, 0xec, 0x0c, 0x07, 0x00, 0xf7, 0x0d, 0x03, 0xec,
-  0x0c, 0x07, 0x00, 0x07, 0x0e, 0x03, 0xec, 0x0c, 0x07, 0x00, 0x10, 0x0e,
-  0x03, 0xec, 0x0c, 0x07, 0x00, 0x19, 0x0e, 0x03, 0xec, 0x0c, 0x07, 0x00,
-  0x2d, 0x0e, 0x03, 0xec, 0x0c, 0x07, 0x00, 0x33, 0x0e, 0x03, 0xec, 0x0c,
-  0x07, 0x00, 0xb4, 0x0e, 0x03, 0xcc, 0x0c, 0x07, 0x00, 0xc1, 0x0e, 0x03,
-  0xa8, 0x0c, 0x07, 0x00, 0xca, 0x0e, 0x03, 0xd4, 0x0c, 0x07, 0x00, 0xd1,
-  0x0e, 0x03, 0xcc, 0x0c, 0x07, 0x00, 0x39, 0x0f, 0x03, 0xc8, 0x0c, 0x07,
-  0x00, 0x41, 0x0f, 0x03, 0xd4, 0x0c, 0x07, 0x00, 0x4a, 0x0f, 0x03, 0xca,
-  0x0c, 0x07, 0x00, 0x52, 0x0f, 0x03, 0xd0, 0x0c, 0x07, 0x00, 0x5c, 0x0f,
-  0x03, 0xd8, 0x0c, 0x07, 0x00, 0x63, 0x0f, 0x03, 0xd5, 0x0c, 0x07, 0x00,
-  0x6c, 0x0f, 0x03, 0xd6, 0x0c, 0x07, 0x00, 0x72, 0x0f, 0x03, 0xd4, 0x0c,
-  0x07, 0x00, 0x89, 0x0f, 0x01, 0x8c, 0x16, 0x07, 0x00, 0xb3, 0x0f, 0x03,
-  0xc8, 0x0c, 0x02, 0x00, 0xaa, 0x0e, 0x03, 0x02, 0x00, 0xb7, 0x0e, 0x03,
-  0x07, 0x00, 0xe0, 0x0e, 0x03, 0xaf, 0x0c, 0x07, 0x00, 0xa3, 0x0f, 0x01,
-  0x22, 0x17, 0x07, 0x00, 0x16, 0x08, 0x03, 0x8e, 0x0c, 0x07, 0x00, 0x3b,
-  0x08, 0x03, 0x88, 0x0c, 0x07, 0x00, 0x42, 0x08, 0x03, 0x0f, 0x05, 0x07,
-  0x00, 0xcd, 0x08, 0x03, 0x08, 0x0d, 0x07, 0x00, 0xde, 0x08, 0x03, 0x2c,
-  0x14, 0x07, 0x00, 0xeb, 0x08, 0x03, 0xd1, 0x0d, 0x07, 0x00, 0x02, 0x09,
-  0x03, 0xac, 0x0c, 0x07, 0x00, 0x0e, 0x09, 0x03, 0x30, 0x14, 0x07, 0x00,
-  0x17, 0x09, 0x03, 0x34, 0x14, 0x07, 0x00, 0x3b, 0x09, 0x03, 0x30, 0x14,
-  0x07, 0x00, 0x42, 0x09, 0x03, 0x34, 0x14, 0x07, 0x00, 0x75, 0x09, 0x03,
-  0x30, 0x14, 0x07, 0x00, 0x7d, 0x09, 0x03, 0x34, 0x14, 0x07, 0x00, 0x85,
-  0x09, 0x03, 0x38, 0x14, 0x07, 0x00, 0x8b, 0x09, 0x03, 0xaf, 0x0c, 0x07,
-  0x00, 0x9a, 0x09, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xa4, 0x09, 0x03, 0x2c,
-  0x14, 0x07, 0x00, 0xa9, 0x09, 0x03, 0x30, 0x14, 0x07, 0x00, 0xba, 0x09,
-  0x03, 0x2c, 0x14, 0x07, 0x00, 0xc3, 0x09, 0x03, 0x2c, 0x14, 0x07, 0x00,
-  0xc9, 0x09, 0x03, 0xaf, 0x0c, 0x07, 0x00, 0xd8, 0x09, 0x03, 0x2c, 0x14,
-  0x07, 0x00, 0xe1, 0x09, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xe6, 0x09, 0x03,
-  0x2c, 0x14, 0x07, 0x00, 0xee, 0x09, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xf8,
-  0x09, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xfd, 0x09, 0x03, 0x2c, 0x14, 0x07,
-  0x00, 0x05, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x0f, 0x0a, 0x03, 0x2c,
-  0x14, 0x07, 0x00, 0x15, 0x0a, 0x03, 0x38, 0x14, 0x07, 0x00, 0x24, 0x0a,
-  0x03, 0x2c, 0x14, 0x07, 0x00, 0x2e, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00,
-  0x33, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x3b, 0x0a, 0x03, 0x2c, 0x14,
-  0x07, 0x00, 0x45, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x4a, 0x0a, 0x03,
-  0xac, 0x0c, 0x07, 0x00, 0x58, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x5f,
-  0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x66, 0x0a, 0x03, 0x2c, 0x14, 0x07,
-  0x00, 0x6f, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x76, 0x0a, 0x03, 0xac,
-  0x0c, 0x07, 0x00, 0x7f, 0x0a, 0x03, 0x34, 0x14, 0x07, 0x00, 0x8b, 0x0a,
-  0x03, 0x2c, 0x14, 0x07, 0x00, 0x92, 0x0a, 0x03, 0x08, 0x0d, 0x07, 0x00,
-  0xd2, 0x0a, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xee, 0x0a, 0x03, 0x2c, 0x14,
-  0x07, 0x00, 0x04, 0x0b, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x35, 0x0b, 0x03,
-  0x2c, 0x14, 0x07, 0x00, 0x6a, 0x0b, 0x03, 0x34, 0x14, 0x07, 0x00, 0x76,
-  0x0b, 0x03, 0x38, 0x14, 0x07, 0x00, 0x7c, 0x0b, 0x03, 0x34, 0x14, 0x07,
-  0x00, 0x8b, 0x0b, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x99, 0x0b, 0x03, 0x34,
-  0x14, 0x07, 0x00, 0xa9, 0x0b, 0x03, 0x34, 0x14, 0x07, 0x00, 0xae, 0x0b,
-  0x03, 0x34, 0x14, 0x07, 0x00, 0xc4, 0x0b, 0x03, 0x34, 0x14, 0x07, 0x00,
-  0xd4, 0x0b, 0x03, 0x2c, 0x14, 0x07, 0x00, 0xdd, 0x0b, 0x03, 0x34, 0x14,
-  0x07, 0x00, 0xe8, 0x0b, 0x03, 0x34, 0x14, 0x07, 0x00, 0xfb, 0x0b, 0x03,
-  0x34, 0x14, 0x07, 0x00, 0x3a, 0x0c, 0x03, 0xc9, 0x0d, 0x07, 0x00, 0x47,
-  0x0c, 0x03, 0x38, 0x14, 0x07, 0x00, 0x65, 0x0c, 0x03, 0xcb, 0x0d, 0x07,
-  0x00, 0x77, 0x0c, 0x03, 0xd0, 0x0d, 0x07, 0x00, 0xbd, 0x0c, 0x03, 0x2c,
-  0x14, 0x07, 0x00, 0xee, 0x0c, 0x03, 0x2c, 0x14, 0x07, 0x00, 0x49, 0x0e,
-  0x03, 0xae, 0x0c, 0x07, 0x00, 0x56, 0x0e, 0x03, 0xae, 0x0c, 0x07, 0x00,
-  0x5d, 0x0e, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0x87, 0x0e, 0x03, 0xac, 0x0c,
-  0x07, 0x00, 0xb1, 0x0e, 0x03, 0x45, 0x14, 0x07, 0x00, 0xbe, 0x0e, 0x03,
-  0x44, 0x14, 0x07, 0x00, 0xd8, 0x0e, 0x03, 0xaf, 0x0c, 0x07, 0x00, 0x02,
-  0x00, 0x03, 0xd6, 0x0c, 0x07, 0x00, 0x0a, 0x00, 0x03, 0xd4, 0x0c, 0x07,
-  0x00, 0x11, 0x00, 0x03, 0x9c, 0x0c, 0x07, 0x00, 0x18, 0x00, 0x03, 0xcc,
-  0x0c, 0x07, 0x00, 0x1f, 0x00, 0x03, 0xd4, 0x0c, 0x07, 0x00, 0x34, 0x00,
-  0x01, 0xbe, 0x16, 0x07, 0x00, 0x70, 0x00, 0x03, 0x9c, 0x0c, 0x07, 0x00,
-  0x93, 0x00, 0x03, 0x8e, 0x0c, 0x07, 0x00, 0xc5, 0x00, 0x03, 0x94, 0x0c,
-  0x07, 0x00, 0xc9, 0x00, 0x03, 0x55, 0x04, 0x07, 0x00, 0xd0, 0x00, 0x03,
-  0x8e, 0x0c, 0x07, 0x00, 0xf1, 0x00, 0x03, 0x8c, 0x0c, 0x07, 0x00, 0x08,
-  0x01, 0x03, 0x90, 0x0c, 0x07, 0x00, 0x29, 0x01, 0x03, 0xa0, 0x0c, 0x07,
-  0x00, 0x32, 0x01, 0x03, 0x8e, 0x0c, 0x07, 0x00, 0x42, 0x01, 0x03, 0x8c,
-  0x0c, 0x07, 0x00, 0x84, 0x01, 0x03, 0x94, 0x0c, 0x07, 0x00, 0x88, 0x01,
-  0x03, 0x64, 0x04, 0x07, 0x00, 0x8f, 0x01, 0x03, 0x8e, 0x0c, 0x07, 0x00,
-  0xa8, 0x01, 0x03, 0xad, 0x0c, 0x07, 0x00, 0xb8, 0x01, 0x03, 0xaa, 0x0c,
-  0x07, 0x00, 0xbd, 0x01, 0x03, 0xac, 0x0c, 0x07, 0x00, 0xc4, 0x01, 0x03,
-  0x8e, 0x0c, 0x07, 0x00, 0xcd, 0x01, 0x03, 0xad, 0x0c, 0x07, 0x00, 0xde,
-  0x01, 0x03, 0x98, 0x0c, 0x07, 0x00, 0xe2, 0x01, 0x03, 0x75, 0x04, 0x07,
-  0x00, 0xe8, 0x01, 0x03, 0x8e, 0x0c, 0x07, 0x00, 0xee, 0x01, 0x03, 0xac,
-  0x0c, 0x07, 0x00, 0xf5, 0x01, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0xfc, 0x01,
-  0x03, 0xaa, 0x0c, 0x07, 0x00, 0x35, 0x02, 0x03, 0xaa, 0x0c, 0x07, 0x00,
-  0x4a, 0x02, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x53, 0x02, 0x03, 0xac, 0x0c,
-  0x07, 0x00, 0x5e, 0x02, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0x64, 0x02, 0x03,
-  0xac, 0x0c, 0x07, 0x00, 0x6d, 0x02, 0x03, 0x98, 0x0c, 0x07, 0x00, 0x71,
-  0x02, 0x03, 0x8d, 0x04, 0x07, 0x00, 0x78, 0x02, 0x03, 0xaa, 0x0c, 0x07,
-  0x00, 0x9f, 0x02, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0xa7, 0x02, 0x03, 0xac,
-  0x0c, 0x07, 0x00, 0xae, 0x02, 0x03, 0x98, 0x0c, 0x07, 0x00, 0xb2, 0x02,
-  0x03, 0x9e, 0x04, 0x07, 0x00, 0xbe, 0x02, 0x03, 0xaa, 0x0c, 0x07, 0x00,
-  0xed, 0x02, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0xf5, 0x02, 0x03, 0xac, 0x0c,
-  0x07, 0x00, 0x15, 0x03, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x1d, 0x03, 0x03,
-  0xaa, 0x0c, 0x07, 0x00, 0x25, 0x03, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x2e,
-  0x03, 0x03, 0x98, 0x0c, 0x07, 0x00, 0x32, 0x03, 0x03, 0xaf, 0x04, 0x07,
-  0x00, 0x39, 0x03, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0x42, 0x03, 0x03, 0xac,
-  0x0c, 0x07, 0x00, 0x4c, 0x03, 0x03, 0x8e, 0x0c, 0x07, 0x00, 0x5a, 0x03,
-  0x03, 0x8e, 0x0c, 0x07, 0x00, 0x6c, 0x03, 0x03, 0xac, 0x0c, 0x07, 0x00,
-  0x75, 0x03, 0x03, 0x98, 0x0c, 0x07, 0x00, 0x79, 0x03, 0x03, 0xc0, 0x04,
-  0x07, 0x00, 0x7f, 0x03, 0x03, 0xaa, 0x0c, 0x07, 0x00, 0x87, 0x03, 0x03,
-  0xac, 0x0c, 0x07, 0x00, 0xdd, 0x03, 0x03, 0x98, 0x0c, 0x07, 0x00, 0xe1,
-  0x03, 0x03, 0xe1, 0x04, 0x07, 0x00, 0xe8, 0x03, 0x03, 0xaa, 0x0c, 0x07,
-  0x00, 0xf7, 0x03, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x05, 0x04, 0x03, 0xac,
-  0x0c, 0x07, 0x00, 0x13, 0x04, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x6f, 0x04,
-  0x01, 0xf0, 0x16, 0x07, 0x00, 0xa9, 0x04, 0x03, 0x88, 0x0c, 0x07, 0x00,
-  0x05, 0x05, 0x03, 0x88, 0x0c, 0x07, 0x00, 0x3d, 0x05, 0x03, 0x09, 0x05,
-  0x07, 0x00, 0x5b, 0x05, 0x03, 0x0c, 0x05, 0x07, 0x00, 0x58, 0x06, 0x03,
-  0x88, 0x0c, 0x07, 0x00, 0xf2, 0x07, 0x03, 0x88, 0x0c, 0x07, 0x00, 0x03,
-  0x08, 0x03, 0x8e, 0x0c, 0x02, 0x00, 0xc4, 0x08, 0x03, 0x02, 0x00, 0xdc,
-  0x08, 0x03, 0x07, 0x00, 0xf1, 0x0c, 0x03, 0x98, 0x0d, 0x07, 0x00, 0xf5,
-  0x0c, 0x03, 0xb6, 0x05, 0x07, 0x00, 0x0c, 0x0d, 0x03, 0xd8, 0x0d, 0x07,
-  0x00, 0x14, 0x0d, 0x03, 0xac, 0x0c, 0x07, 0x00, 0x2a, 0x0d, 0x03, 0x9c,
-  0x0d, 0x07, 0x00, 0x2e, 0x0d, 0x03, 0xd9, 0x05, 0x07, 0x00, 0x38, 0x0d,
-  0x01, 0xd8, 0x38, 0x07, 0x00, 0x59, 0x0d, 0x01, 0xc0, 0x38, 0x07, 0x00,
-  0x99, 0x0d, 0x03, 0xf8, 0x0d, 0x07, 0x00, 0xa2, 0x0d, 0x03, 0x98, 0x0d,
-  0x07, 0x00, 0xa6, 0x0d, 0x03, 0x17, 0x06, 0x07, 0x00, 0xae, 0x0d, 0x03,
-  0x94, 0x0d, 0x07, 0x00, 0xb6, 0x0d, 0x03, 0x94, 0x0d, 0x07, 0x00, 0xcb,
-  0x0d, 0x03, 0x9c, 0x0d, 0x07, 0x00, 0xcf, 0x0d, 0x03, 0x4c, 0x06, 0x07,
-  0x00, 0xe6, 0x0d, 0x03, 0x94, 0x0d, 0x07, 0x00, 0xef, 0x0d, 0x03, 0x98,
-  0x0d, 0x07, 0x00, 0xf3, 0x0d, 0x03, 0x63, 0x06, 0x07, 0x00, 0xfa, 0x0d,
-  0x03, 0x96, 0x0d, 0x07, 0x00, 0xff, 0x0d, 0x03, 0x97, 0x0d, 0x07, 0x00,
-  0x06, 0x0e, 0x03, 0x94, 0x0d, 0x07, 0x00, 0x26, 0x0e, 0x03, 0xd8, 0x0d,
-  0x07, 0x00, 0x2f, 0x0e, 0x03, 0xcc, 0x0d, 0x07, 0x00, 0x38, 0x0e, 0x03,
-  0x97, 0x0d, 0x07, 0x00, 0x6a, 0x0e, 0x03, 0x98, 0x0d, 0x07, 0x00, 0x6e,
-  0x0e, 0x03, 0x7d, 0x06, 0x07, 0x00, 0x78, 0x0e, 0x03, 0x94, 0x0d, 0x07,
-  0x00, 0x9e, 0x0e, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0xa7, 0x0e, 0x03, 0xcc,
-  0x0d, 0x07, 0x00, 0xb0, 0x0e, 0x03, 0x96, 0x0d, 0x07, 0x00, 0xe2, 0x0e,
-  0x03, 0x98, 0x0d, 0x07, 0x00, 0xe6, 0x0e, 0x03, 0x7d, 0x06, 0x07, 0x00,
-  0xf0, 0x0e, 0x03, 0x94, 0x0d, 0x07, 0x00, 0xbd, 0x07, 0x03, 0x9e, 0x0c,
-  0x07, 0x00, 0xda, 0x07, 0x01, 0xd4, 0x17, 0x07, 0x00, 0xe8, 0x07, 0x03,
-  0x9e, 0x0c, 0x07, 0x00, 0x15, 0x08, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x37,
-  0x08, 0x01, 0x06, 0x18, 0x07, 0x00, 0x67, 0x08, 0x03, 0x9e, 0x0c, 0x07,
-  0x00, 0x8d, 0x08, 0x03, 0xf4, 0x03, 0x07, 0x00, 0x93, 0x08, 0x03, 0x71,
-  0x05, 0x07, 0x00, 0x99, 0x08, 0x03, 0x78, 0x05, 0x07, 0x00, 0x9f, 0x08,
-  0x03, 0x45, 0x05, 0x07, 0x00, 0xcc, 0x08, 0x03, 0xf8, 0x0d, 0x07, 0x00,
-  0xe3, 0x08, 0x03, 0xf8, 0x0d, 0x07, 0x00, 0xf1, 0x08, 0x03, 0xa0, 0x0d,
-  0x07, 0x00, 0x01, 0x09, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x1c, 0x09, 0x01,
-  0xb0, 0x38, 0x07, 0x00, 0x32, 0x09, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x4c,
-  0x09, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0x82, 0x09, 0x03, 0xa0, 0x0d, 0x07,
-  0x00, 0x93, 0x09, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0xad, 0x09, 0x03, 0xa0,
-  0x0d, 0x07, 0x00, 0xb9, 0x09, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xc5, 0x09,
-  0x03, 0xa0, 0x0d, 0x07, 0x00, 0xd1, 0x09, 0x03, 0xa0, 0x0d, 0x07, 0x00,
-  0xdc, 0x09, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x0a, 0x0a, 0x03, 0xa0, 0x0d,
-  0x07, 0x00, 0x15, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x21, 0x0a, 0x03,
-  0xa0, 0x0d, 0x07, 0x00, 0x2d, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x54,
-  0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x60, 0x0a, 0x03, 0xa0, 0x0d, 0x07,
-  0x00, 0x6c, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x78, 0x0a, 0x03, 0xa0,
-  0x0d, 0x07, 0x00, 0x9f, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xab, 0x0a,
-  0x03, 0xa0, 0x0d, 0x07, 0x00, 0xb7, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00,
-  0xc3, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xce, 0x0a, 0x03, 0xa0, 0x0d,
-  0x07, 0x00, 0xd7, 0x0a, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x01, 0x0b, 0x03,
-  0xa0, 0x0d, 0x07, 0x00, 0x0d, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x19,
-  0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x25, 0x0b, 0x03, 0xa0, 0x0d, 0x07,
-  0x00, 0x30, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x5a, 0x0b, 0x03, 0xa0,
-  0x0d, 0x07, 0x00, 0x66, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x72, 0x0b,
-  0x03, 0xa0, 0x0d, 0x07, 0x00, 0x7e, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00,
-  0x89, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xb3, 0x0b, 0x03, 0xa0, 0x0d,
-  0x07, 0x00, 0xbe, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0xe8, 0x0b, 0x03,
-  0xa0, 0x0d, 0x07, 0x00, 0xf4, 0x0b, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x00,
-  0x0c, 0x03, 0xa0, 0x0d, 0x07, 0x00, 0x0c, 0x0c, 0x03, 0xa0, 0x0d, 0x07,
-  0x00, 0x18, 0x0c, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0x3d, 0x0c, 0x03, 0xd8,
-  0x0d, 0x08, 0x00, 0x43, 0x0c, 0x02, 0x00, 0x00, 0x07, 0x00, 0x48, 0x0c,
-  0x03, 0xd1, 0x0d, 0x07, 0x00, 0x68, 0x0c, 0x03, 0xd8, 0x0d, 0x07, 0x00,
-  0x85, 0x0c, 0x03, 0x95, 0x0d, 0x07, 0x00, 0x92, 0x0c, 0x03, 0x95, 0x0d,
-  0x07, 0x00, 0x99, 0x0c, 0x03, 0x94, 0x0d, 0x07, 0x00, 0xa0, 0x0c, 0x03,
-  0x98, 0x0d, 0x07, 0x00, 0xa4, 0x0c, 0x03, 0x9d, 0x05, 0x07, 0x00, 0xac,
-  0x0c, 0x03, 0x9c, 0x0d, 0x07, 0x00, 0xb0, 0x0c, 0x03, 0x9e, 0x05, 0x07,
-  0x00, 0xb5, 0x0c, 0x03, 0x97, 0x0d, 0x07, 0x00, 0xba, 0x0c, 0x03, 0x96,
-  0x0d, 0x07, 0x00, 0xc0, 0x0c, 0x03, 0xd1, 0x0d, 0x07, 0x00, 0xce, 0x0c,
-  0x03, 0xd8, 0x0d, 0x07, 0x00, 0xd7, 0x0c, 0x03, 0x98, 0x0d, 0x07, 0x00,
-  0xdb, 0x0c, 0x03, 0xa3, 0x05, 0x07, 0x00, 0xe8, 0x0c, 0x03, 0xcc, 0x0d,
-  0x07, 0x00, 0x5b, 0x00, 0x03, 0x18, 0x05, 0x07, 0x00, 0xc3, 0x00, 0x03,
-  0x1d, 0x05, 0x07, 0x00, 0x09, 0x01, 0x03, 0x16, 0x0d, 0x07, 0x00, 0x1c,
-  0x01, 0x03, 0x0c, 0x0d, 0x07, 0x00, 0x25, 0x01, 0x03, 0x0c, 0x0d, 0x07,
-  0x00, 0x2b, 0x01, 0x03, 0x0c, 0x0d, 0x07, 0x00, 0x34, 0x01, 0x03, 0x09,
-  0x0d, 0x07, 0x00, 0x43, 0x01, 0x03, 0x14, 0x0d, 0x07, 0x00, 0x49, 0x01,
-  0x03, 0x10, 0x0d, 0x07, 0x00, 0x4f, 0x01, 0x03, 0x09, 0x0d, 0x07, 0x00,
-  0x5d, 0x01, 0x03, 0x14, 0x0d, 0x07, 0x00, 0x64, 0x01, 0x03, 0x10, 0x0d,
-  0x07, 0x00, 0x71, 0x01, 0x03, 0x0c, 0x0d, 0x07, 0x00, 0x7a, 0x01, 0x03,
-  0x09, 0x0d, 0x07, 0x00, 0x83, 0x01, 0x03, 0x09, 0x0d, 0x07, 0x00, 0x8e,
-  0x01, 0x01, 0xec, 0x30, 0x07, 0x00, 0x9a, 0x01, 0x03, 0x10, 0x0d, 0x07,
-  0x00, 0xa6, 0x01, 0x03, 0x14, 0x0d, 0x07, 0x00, 0xb1, 0x01, 0x03, 0x0c,
-  0x0d, 0x07, 0x00, 0x71, 0x02, 0x03, 0xac, 0x0c, 0x07, 0x00, 0xad, 0x02,
-  0x03, 0x50, 0x0d, 0x07, 0x00, 0xbf, 0x02, 0x03, 0x50, 0x0d, 0x07, 0x00,
-  0xc6, 0x02, 0x03, 0x8c, 0x0c, 0x07, 0x00, 0xcf, 0x02, 0x03, 0x90, 0x0c,
-  0x07, 0x00, 0xd8, 0x02, 0x03, 0x50, 0x0d, 0x07, 0x00, 0x07, 0x03, 0x03,
-  0x50, 0x0d, 0x07, 0x00, 0x23, 0x03, 0x03, 0x48, 0x0d, 0x07, 0x00, 0x59,
-  0x03, 0x03, 0x50, 0x0d, 0x07, 0x00, 0x75, 0x03, 0x03, 0x4c, 0x0d, 0x07,
-  0x00, 0x8f, 0x03, 0x03, 0x50, 0x0d, 0x07, 0x00, 0xab, 0x03, 0x03, 0x50,
-  0x0d, 0x07, 0x00, 0xe2, 0x03, 0x03, 0x50, 0x0d, 0x07, 0x00, 0xf5, 0x03,
-  0x03, 0x50, 0x0d, 0x07, 0x00, 0xfb, 0x03, 0x03, 0x51, 0x0d, 0x07, 0x00,
-  0x15, 0x04, 0x03, 0xf4, 0x03, 0x07, 0x00, 0x1b, 0x04, 0x03, 0x26, 0x05,
-  0x07, 0x00, 0x21, 0x04, 0x03, 0x45, 0x05, 0x07, 0x00, 0x5c, 0x04, 0x03,
-  0x47, 0x05, 0x07, 0x00, 0x98, 0x04, 0x03, 0x54, 0x05, 0x07, 0x00, 0x9d,
-  0x04, 0x03, 0x5d, 0x05, 0x07, 0x00, 0xa2, 0x04, 0x03, 0x47, 0x05, 0x07,
-  0x00, 0xaf, 0x04, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0xc9, 0x04, 0x01, 0x3e,
-  0x17, 0x07, 0x00, 0x08, 0x05, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x23, 0x05,
-  0x03, 0x62, 0x05, 0x07, 0x00, 0x3b, 0x05, 0x03, 0x9e, 0x0c, 0x07, 0x00,
-  0x52, 0x05, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x73, 0x05, 0x03, 0x92, 0x0d,
-  0x07, 0x00, 0x8d, 0x05, 0x03, 0x92, 0x0d, 0x07, 0x00, 0x99, 0x05, 0x03,
-  0x92, 0x0d, 0x07, 0x00, 0xbc, 0x05, 0x03, 0x92, 0x0d, 0x07, 0x00, 0xd2,
-  0x05, 0x03, 0x92, 0x0d, 0x07, 0x00, 0xe1, 0x05, 0x03, 0x92, 0x0d, 0x07,
-  0x00, 0x28, 0x06, 0x03, 0x92, 0x0d, 0x07, 0x00, 0x42, 0x06, 0x03, 0x92,
-  0x0d, 0x07, 0x00, 0x4d, 0x06, 0x03, 0x92, 0x0d, 0x07, 0x00, 0x90, 0x06,
-  0x03, 0x9d, 0x0c, 0x07, 0x00, 0x9f, 0x06, 0x03, 0x9d, 0x0c, 0x07, 0x00,
-  0xa6, 0x06, 0x03, 0x92, 0x0d, 0x07, 0x00, 0xac, 0x06, 0x03, 0x86, 0x0c,
-  0x07, 0x00, 0xb6, 0x06, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0xca, 0x06, 0x03,
-  0x9e, 0x0c, 0x07, 0x00, 0xd6, 0x06, 0x03, 0x86, 0x0c, 0x07, 0x00, 0xe5,
-  0x06, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x01, 0x70, 0x17, 0x07,
-  0x00, 0x1a, 0x07, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x38, 0x07, 0x03, 0x92,
-  0x0d, 0x07, 0x00, 0x3f, 0x07, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x61, 0x07,
-  0x03, 0x9e, 0x0c, 0x07, 0x00, 0x71, 0x07, 0x01, 0xa2, 0x17, 0x07, 0x00,
-  0x7f, 0x07, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x92, 0x07, 0x03, 0x9e, 0x0c,
-  0x07, 0x00, 0x9e, 0x07, 0x03, 0x9e, 0x0c, 0x07, 0x00, 0x3d, 0x0b, 0x03,
-  0x15, 0x0e, 0x07, 0x00, 0x85, 0x0b, 0x03, 0x17, 0x0e, 0x07, 0x00, 0x93,
-  0x0b, 0x03, 0x24, 0x0e, 0x07, 0x00, 0x9c, 0x0b, 0x03, 0x1c, 0x0e, 0x07,
-  0x00, 0xac, 0x0b, 0x03, 0x17, 0x0e, 0x07, 0x00, 0xb5, 0x0b, 0x03, 0x24,
-  0x0e, 0x07, 0x00, 0xd5, 0x0c, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xe1, 0x0c,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xed, 0x0c, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xfc, 0x0c, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x0f, 0x0d, 0x03, 0x60, 0x0e,
-  0x07, 0x00, 0x1d, 0x0d, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x28, 0x0d, 0x03,
-  0x45, 0x0e, 0x07, 0x00, 0x38, 0x0d, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x40,
-  0x0d, 0x03, 0x45, 0x0e, 0x07, 0x00, 0x50, 0x0d, 0x01, 0x6f, 0x4d, 0x07,
-  0x00, 0x54, 0x0d, 0x01, 0x85, 0x4d, 0x07, 0x00, 0x58, 0x0d, 0x01, 0x9b,
-  0x4d, 0x07, 0x00, 0x5c, 0x0d, 0x01, 0xa7, 0x4d, 0x07, 0x00, 0x6b, 0x0d,
-  0x01, 0x50, 0x4d, 0x07, 0x00, 0x71, 0x0d, 0x03, 0x58, 0x0e, 0x07, 0x00,
-  0x7b, 0x0d, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0x87, 0x0d, 0x03, 0x58, 0x0e,
-  0x07, 0x00, 0x91, 0x0d, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0x9d, 0x0d, 0x03,
-  0x58, 0x0e, 0x07, 0x00, 0xa9, 0x0d, 0x03, 0x58, 0x0e, 0x07, 0x00, 0xb3,
-  0x0d, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0xbc, 0x0d, 0x03, 0x58, 0x0e, 0x07,
-  0x00, 0xc2, 0x0d, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0xc7, 0x0d, 0x03, 0x34,
-  0x0e, 0x07, 0x00, 0xce, 0x0d, 0x03, 0x3c, 0x0e, 0x07, 0x00, 0xd4, 0x0d,
-  0x03, 0x38, 0x0e, 0x07, 0x00, 0xda, 0x0d, 0x03, 0x40, 0x0e, 0x07, 0x00,
-  0xe8, 0x0d, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x4d, 0x0e, 0x03, 0x60, 0x0e,
-  0x07, 0x00, 0x56, 0x0e, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x5c, 0x0e, 0x03,
-  0x45, 0x0e, 0x07, 0x00, 0x61, 0x0e, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x66,
-  0x0e, 0x03, 0x64, 0x0e, 0x07, 0x00, 0x6b, 0x0e, 0x03, 0x62, 0x0e, 0x07,
-  0x00, 0x71, 0x0e, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x8c, 0x0e, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x98, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb8, 0x0e,
-  0x03, 0x50, 0x0e, 0x07, 0x00, 0xe4, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xe9, 0x0e, 0x03, 0x64, 0x0e, 0x07, 0x00, 0xf5, 0x0e, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x02, 0x0f, 0x03, 0x60, 0x0e, 0x07, 0x00, 0x08, 0x0f, 0x03,
-  0x50, 0x0e, 0x07, 0x00, 0x14, 0x0f, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x3c,
-  0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x48, 0x0f, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x64, 0x0f, 0x03, 0x50, 0x0e, 0x07, 0x00, 0x6b, 0x0f, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x91, 0x0f, 0x03, 0x50, 0x0e, 0x07, 0x00, 0x9d, 0x0f,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xa9, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xb6, 0x0f, 0x03, 0x60, 0x0e, 0x07, 0x00, 0xbc, 0x0f, 0x03, 0x50, 0x0e,
-  0x07, 0x00, 0xc4, 0x0f, 0x03, 0x47, 0x0e, 0x07, 0x00, 0xce, 0x0f, 0x03,
-  0x58, 0x0e, 0x07, 0x00, 0xd4, 0x0f, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0xd9,
-  0x0f, 0x03, 0x34, 0x0e, 0x07, 0x00, 0xe2, 0x0f, 0x03, 0x38, 0x0e, 0x07,
-  0x00, 0xe7, 0x0f, 0x03, 0x3c, 0x0e, 0x07, 0x00, 0xed, 0x0f, 0x03, 0x40,
-  0x0e, 0x07, 0x00, 0xff, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xa4, 0x01,
-  0x03, 0x0c, 0x0e, 0x07, 0x00, 0xb0, 0x01, 0x03, 0x0c, 0x0e, 0x07, 0x00,
-  0xc0, 0x01, 0x03, 0x9c, 0x0c, 0x07, 0x00, 0x04, 0x02, 0x01, 0x10, 0x3f,
-  0x07, 0x00, 0x0e, 0x02, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x15, 0x02, 0x03,
-  0x9c, 0x0c, 0x07, 0x00, 0x43, 0x02, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x72,
-  0x02, 0x03, 0x0c, 0x0e, 0x07, 0x00, 0x84, 0x02, 0x03, 0x08, 0x0e, 0x07,
-  0x00, 0x93, 0x02, 0x03, 0x10, 0x0e, 0x07, 0x00, 0xad, 0x02, 0x03, 0x10,
-  0x0e, 0x07, 0x00, 0xd6, 0x02, 0x01, 0x42, 0x3f, 0x07, 0x00, 0xe0, 0x02,
-  0x03, 0x04, 0x0e, 0x07, 0x00, 0x22, 0x03, 0x01, 0x74, 0x3f, 0x07, 0x00,
-  0x2c, 0x03, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x6e, 0x03, 0x01, 0xa6, 0x3f,
-  0x07, 0x00, 0x78, 0x03, 0x03, 0x04, 0x0e, 0x07, 0x00, 0xb2, 0x03, 0x01,
-  0xd8, 0x3f, 0x07, 0x00, 0xbc, 0x03, 0x03, 0x04, 0x0e, 0x07, 0x00, 0xc5,
-  0x03, 0x03, 0x10, 0x0e, 0x07, 0x00, 0xdf, 0x03, 0x03, 0xfc, 0x0d, 0x07,
-  0x00, 0x00, 0x04, 0x03, 0xfc, 0x0d, 0x07, 0x00, 0x0d, 0x04, 0x03, 0x00,
-  0x0e, 0x07, 0x00, 0x30, 0x04, 0x01, 0x0a, 0x40, 0x07, 0x00, 0x3f, 0x04,
-  0x03, 0x04, 0x0e, 0x07, 0x00, 0x48, 0x04, 0x03, 0x10, 0x0e, 0x07, 0x00,
-  0xc2, 0x04, 0x01, 0x3c, 0x40, 0x07, 0x00, 0x15, 0x05, 0x01, 0x6e, 0x40,
-  0x07, 0x00, 0x36, 0x05, 0x03, 0x04, 0x0e, 0x07, 0x00, 0xe7, 0x05, 0x01,
-  0xa0, 0x40, 0x07, 0x00, 0xf3, 0x05, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x4d,
-  0x06, 0x01, 0xd2, 0x40, 0x07, 0x00, 0x59, 0x06, 0x03, 0x04, 0x0e, 0x07,
-  0x00, 0xa0, 0x06, 0x01, 0x04, 0x41, 0x07, 0x00, 0xac, 0x06, 0x03, 0x04,
-  0x0e, 0x07, 0x00, 0xb5, 0x06, 0x03, 0x10, 0x0e, 0x07, 0x00, 0x31, 0x07,
-  0x01, 0x36, 0x41, 0x07, 0x00, 0x3d, 0x07, 0x03, 0x04, 0x0e, 0x07, 0x00,
-  0x4a, 0x07, 0x03, 0x10, 0x0e, 0x07, 0x00, 0x5a, 0x08, 0x03, 0xae, 0x06,
-  0x07, 0x00, 0x5f, 0x08, 0x03, 0x6c, 0x0a, 0x07, 0x00, 0xb5, 0x08, 0x03,
-  0x20, 0x0e, 0x07, 0x00, 0xbb, 0x08, 0x03, 0x18, 0x0e, 0x07, 0x00, 0xc1,
-  0x08, 0x03, 0x15, 0x0e, 0x07, 0x00, 0xd1, 0x08, 0x03, 0x20, 0x0e, 0x07,
-  0x00, 0xd8, 0x08, 0x03, 0x18, 0x0e, 0x07, 0x00, 0xf0, 0x08, 0x03, 0xc7,
-  0x06, 0x07, 0x00, 0x05, 0x09, 0x03, 0x15, 0x0e, 0x07, 0x00, 0x0b, 0x09,
-  0x03, 0xc7, 0x06, 0x07, 0x00, 0x2b, 0x09, 0x03, 0x28, 0x0e, 0x07, 0x00,
-  0x47, 0x09, 0x03, 0x2c, 0x0e, 0x07, 0x00, 0x64, 0x09, 0x03, 0xc7, 0x06,
-  0x07, 0x00, 0x75, 0x09, 0x03, 0x15, 0x0e, 0x07, 0x00, 0x7a, 0x09, 0x03,
-  0x17, 0x0e, 0x07, 0x00, 0x81, 0x09, 0x03, 0x1c, 0x0e, 0x07, 0x00, 0x8d,
-  0x09, 0x03, 0x14, 0x0e, 0x07, 0x00, 0xa2, 0x09, 0x03, 0x1c, 0x0e, 0x07,
-  0x00, 0xad, 0x09, 0x03, 0x16, 0x0e, 0x07, 0x00, 0xb2, 0x09, 0x03, 0xc7,
-  0x06, 0x07, 0x00, 0xc1, 0x09, 0x03, 0x24, 0x0e, 0x07, 0x00, 0xcc, 0x09,
-  0x03, 0x30, 0x0e, 0x07, 0x00, 0xd9, 0x09, 0x03, 0x30, 0x0e, 0x07, 0x00,
-  0xe0, 0x09, 0x03, 0x24, 0x0e, 0x07, 0x00, 0xed, 0x09, 0x03, 0x30, 0x0e,
-  0x07, 0x00, 0xfc, 0x09, 0x03, 0x24, 0x0e, 0x07, 0x00, 0x0d, 0x0a, 0x01,
-  0xe0, 0x47, 0x07, 0x00, 0x4f, 0x0a, 0x03, 0x30, 0x0e, 0x07, 0x00, 0x5c,
-  0x0a, 0x03, 0x24, 0x0e, 0x07, 0x00, 0x62, 0x0a, 0x03, 0x30, 0x0e, 0x07,
-  0x00, 0x6a, 0x0a, 0x03, 0x17, 0x0e, 0x07, 0x00, 0x97, 0x0a, 0x03, 0x15,
-  0x0e, 0x07, 0x00, 0xe1, 0x0a, 0x03, 0x15, 0x0e, 0x07, 0x00, 0x2e, 0x0b,
-  0x03, 0x17, 0x0e, 0x07, 0x00, 0x72, 0x0d, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x81, 0x0d, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x8f, 0x0d, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x9f, 0x0d, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xcf, 0x0d, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xde, 0x0d, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x13,
-  0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x1f, 0x0e, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x4f, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x5e, 0x0e, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x7e, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x8d, 0x0e,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xad, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xb9, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xc5, 0x0e, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xd1, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xe4, 0x0e, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xf5, 0x0e, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x63,
-  0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x6f, 0x0f, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x7e, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x8d, 0x0f, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x9c, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xaa, 0x0f,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xb9, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xc5, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xdf, 0x0f, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xee, 0x0f, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xfd, 0x0f, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0x43, 0x06, 0x03, 0x60, 0x0e, 0x07, 0x00, 0x4b,
-  0x06, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x57, 0x06, 0x03, 0x3c, 0x0e, 0x07,
-  0x00, 0x6b, 0x06, 0x03, 0x60, 0x0e, 0x07, 0x00, 0x82, 0x06, 0x03, 0x60,
-  0x0e, 0x07, 0x00, 0x97, 0x06, 0x03, 0x48, 0x0e, 0x07, 0x00, 0xa0, 0x06,
-  0x03, 0x60, 0x0e, 0x07, 0x00, 0xa9, 0x06, 0x03, 0x3c, 0x0e, 0x07, 0x00,
-  0xbe, 0x06, 0x03, 0x60, 0x0e, 0x07, 0x00, 0xc9, 0x06, 0x03, 0x46, 0x0e,
-  0x07, 0x00, 0xdd, 0x06, 0x03, 0x60, 0x0e, 0x07, 0x00, 0x03, 0x07, 0x03,
-  0x44, 0x0e, 0x07, 0x00, 0x17, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x20,
-  0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x26, 0x07, 0x03, 0x47, 0x0e, 0x07,
-  0x00, 0x2e, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x3f, 0x07, 0x03, 0x44,
-  0x0e, 0x07, 0x00, 0x45, 0x07, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x4d, 0x07,
-  0x03, 0x44, 0x0e, 0x07, 0x00, 0x5b, 0x07, 0x03, 0x46, 0x0e, 0x07, 0x00,
-  0x69, 0x07, 0x03, 0x45, 0x0e, 0x07, 0x00, 0x73, 0x07, 0x03, 0x60, 0x0e,
-  0x07, 0x00, 0x7d, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x85, 0x07, 0x03,
-  0x3c, 0x0e, 0x07, 0x00, 0x95, 0x07, 0x03, 0x44, 0x0e, 0x07, 0x00, 0xbc,
-  0x07, 0x03, 0x50, 0x0e, 0x07, 0x00, 0xc6, 0x07, 0x03, 0x45, 0x0e, 0x07,
-  0x00, 0xcd, 0x07, 0x03, 0x60, 0x0e, 0x07, 0x00, 0xd7, 0x07, 0x03, 0x44,
-  0x0e, 0x07, 0x00, 0xe6, 0x07, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xf2, 0x07,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xfe, 0x07, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x0a, 0x08, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x1a, 0x08, 0x03, 0x3c, 0x0e,
-  0x07, 0x00, 0x22, 0x08, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x2d, 0x08, 0x03,
-  0x60, 0x0e, 0x07, 0x00, 0x40, 0x08, 0x03, 0x60, 0x0e, 0x07, 0x00, 0x4a,
-  0x08, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x7d, 0x08, 0x03, 0x78, 0x0e, 0x07,
-  0x00, 0xb9, 0x08, 0x03, 0x84, 0x0e, 0x07, 0x00, 0x47, 0x09, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x53, 0x09, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x5f, 0x09,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x6b, 0x09, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x9e, 0x09, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xad, 0x09, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xc9, 0x09, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xd5, 0x09, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xe1, 0x09, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xed,
-  0x09, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x01, 0x0a, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x0d, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x22, 0x0a, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x39, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x4f, 0x0a,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x60, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x6f, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x7b, 0x0a, 0x03, 0x62, 0x0e,
-  0x07, 0x00, 0x87, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x9a, 0x0a, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xa8, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb4,
-  0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xc0, 0x0a, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0xdc, 0x0a, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xea, 0x0a, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x00, 0x0b, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xbe, 0x0b,
-  0x03, 0x64, 0x0e, 0x07, 0x00, 0xf6, 0x0b, 0x03, 0x64, 0x0e, 0x07, 0x00,
-  0x79, 0x0c, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x86, 0x0c, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x92, 0x0c, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xa0, 0x0c, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xaf, 0x0c, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xff,
-  0xff, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x19, 0x00, 0x03, 0x50, 0x0e, 0x07,
-  0x00, 0x22, 0x00, 0x03, 0x50, 0x0e, 0x07, 0x00, 0x2f, 0x00, 0x03, 0x60,
-  0x0e, 0x07, 0x00, 0x34, 0x00, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x3a, 0x00,
-  0x03, 0x58, 0x0e, 0x07, 0x00, 0x44, 0x00, 0x03, 0x5c, 0x0e, 0x07, 0x00,
-  0x4e, 0x00, 0x03, 0x34, 0x0e, 0x07, 0x00, 0x58, 0x00, 0x03, 0x38, 0x0e,
-  0x07, 0x00, 0x62, 0x00, 0x03, 0x3c, 0x0e, 0x07, 0x00, 0x6c, 0x00, 0x03,
-  0x40, 0x0e, 0x07, 0x00, 0x7e, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x88,
-  0x00, 0x03, 0x50, 0x0e, 0x07, 0x00, 0x8f, 0x00, 0x03, 0x58, 0x0e, 0x07,
-  0x00, 0x99, 0x00, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0xa3, 0x00, 0x03, 0x34,
-  0x0e, 0x07, 0x00, 0xad, 0x00, 0x03, 0x38, 0x0e, 0x07, 0x00, 0xb7, 0x00,
-  0x03, 0x3c, 0x0e, 0x07, 0x00, 0xc1, 0x00, 0x03, 0x40, 0x0e, 0x07, 0x00,
-  0xe4, 0x00, 0x01, 0xe0, 0x4b, 0x07, 0x00, 0xf1, 0x00, 0x03, 0x62, 0x0e,
-  0x07, 0x00, 0xfb, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x22, 0x01, 0x03,
-  0x62, 0x0e, 0x07, 0x00, 0x2f, 0x01, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x40,
-  0x01, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x51, 0x01, 0x03, 0x62, 0x0e, 0x07,
-  0x00, 0x66, 0x01, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x6e, 0x01, 0x03, 0x62,
-  0x0e, 0x07, 0x00, 0x99, 0x01, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xa1, 0x01,
-  0x03, 0x62, 0x0e, 0x07, 0x00, 0xf6, 0x01, 0x01, 0xfc, 0x4b, 0x07, 0x00,
-  0xfc, 0x01, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x24, 0x02, 0x03, 0x62, 0x0e,
-  0x07, 0x00, 0x32, 0x02, 0x01, 0x18, 0x4c, 0x07, 0x00, 0x68, 0x02, 0x03,
-  0x63, 0x0e, 0x07, 0x00, 0x70, 0x02, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xb3,
-  0x02, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xba, 0x02, 0x03, 0x62, 0x0e, 0x07,
-  0x00, 0x33, 0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0x39, 0x03, 0x03, 0x51,
-  0x0e, 0x07, 0x00, 0x52, 0x03, 0x03, 0x51, 0x0e, 0x07, 0x00, 0x5a, 0x03,
-  0x03, 0x51, 0x0e, 0x07, 0x00, 0x83, 0x03, 0x03, 0x63, 0x0e, 0x07, 0x00,
-  0x91, 0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xa0, 0x03, 0x03, 0x51, 0x0e,
-  0x07, 0x00, 0xa7, 0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xb5, 0x03, 0x03,
-  0x62, 0x0e, 0x07, 0x00, 0xc3, 0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xd1,
-  0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xdf, 0x03, 0x03, 0x62, 0x0e, 0x07,
-  0x00, 0xed, 0x03, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xfa, 0x03, 0x03, 0xd0,
-  0x06, 0x07, 0x00, 0x2e, 0x04, 0x03, 0x64, 0x0e, 0x07, 0x00, 0x36, 0x04,
-  0x03, 0x50, 0x0e, 0x07, 0x00, 0x3c, 0x04, 0x03, 0x58, 0x0e, 0x07, 0x00,
-  0x42, 0x04, 0x03, 0x5c, 0x0e, 0x07, 0x00, 0x4a, 0x04, 0x03, 0x58, 0x0e,
-  0x07, 0x00, 0x50, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x55, 0x04, 0x03,
-  0x19, 0x07, 0x07, 0x00, 0x9b, 0x04, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xe0,
-  0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xee, 0x04, 0x03, 0x62, 0x0e, 0x07,
-  0x00, 0x62, 0x05, 0x03, 0x62, 0x0e, 0x07, 0x00, 0xd9, 0x05, 0x03, 0x44,
-  0x0e, 0x07, 0x00, 0xdf, 0x05, 0x03, 0x45, 0x0e, 0x07, 0x00, 0xe6, 0x05,
-  0x03, 0x45, 0x0e, 0x07, 0x00, 0xeb, 0x05, 0x03, 0x45, 0x0e, 0x07, 0x00,
-  0xf1, 0x05, 0x03, 0x48, 0x0e, 0x07, 0x00, 0xfc, 0x05, 0x03, 0x48, 0x0e,
-  0x07, 0x00, 0x03, 0x06, 0x03, 0x45, 0x0e, 0x07, 0x00, 0x20, 0x06, 0x03,
-  0x48, 0x0e, 0x07, 0x00, 0x27, 0x06, 0x03, 0x48, 0x0e, 0x07, 0x00, 0x35,
-  0x06, 0x03, 0x48, 0x0e, 0x07, 0x00, 0xee, 0x09, 0x03, 0x20, 0x09, 0x07,
-  0x00, 0x02, 0x0a, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x2c, 0x0a, 0x03, 0x47,
-  0x0e, 0x07, 0x00, 0x41, 0x0a, 0x03, 0x20, 0x09, 0x07, 0x00, 0x4e, 0x0a,
-  0x03, 0x20, 0x09, 0x07, 0x00, 0x89, 0x0a, 0x03, 0x20, 0x09, 0x07, 0x00,
-  0xad, 0x0a, 0x03, 0x1c, 0x09, 0x07, 0x00, 0xb4, 0x0a, 0x03, 0x24, 0x09,
-  0x07, 0x00, 0xbc, 0x0a, 0x03, 0x18, 0x09, 0x07, 0x00, 0xc3, 0x0a, 0x03,
-  0x20, 0x09, 0x07, 0x00, 0x06, 0x0b, 0x03, 0x74, 0x0e, 0x07, 0x00, 0x64,
-  0x0b, 0x03, 0x24, 0x09, 0x07, 0x00, 0x6d, 0x0b, 0x03, 0x20, 0x09, 0x07,
-  0x00, 0x9d, 0x0b, 0x03, 0x1c, 0x09, 0x07, 0x00, 0xa6, 0x0b, 0x03, 0x18,
-  0x09, 0x07, 0x00, 0xc6, 0x0b, 0x03, 0x24, 0x09, 0x07, 0x00, 0xcf, 0x0b,
-  0x03, 0x20, 0x09, 0x07, 0x00, 0xfd, 0x0b, 0x03, 0x1c, 0x09, 0x07, 0x00,
-  0x06, 0x0c, 0x03, 0x18, 0x09, 0x07, 0x00, 0x4f, 0x0c, 0x03, 0x24, 0x09,
-  0x07, 0x00, 0x57, 0x0c, 0x03, 0x20, 0x09, 0x07, 0x00, 0xa2, 0x0c, 0x03,
-  0x1c, 0x09, 0x07, 0x00, 0xab, 0x0c, 0x03, 0x18, 0x09, 0x07, 0x00, 0xe2,
-  0x0c, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x48, 0x0d, 0x03, 0x68, 0x0e, 0x07,
-  0x00, 0x64, 0x0d, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x6f, 0x0d, 0x03, 0x74,
-  0x0e, 0x07, 0x00, 0x9f, 0x0d, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xa5, 0x0d,
-  0x03, 0x6c, 0x0e, 0x07, 0x00, 0xb1, 0x0d, 0x03, 0x6c, 0x0e, 0x07, 0x00,
-  0xb6, 0x0d, 0x03, 0x68, 0x0e, 0x07, 0x00, 0xc2, 0x0d, 0x03, 0x6c, 0x0e,
-  0x07, 0x00, 0xcd, 0x0d, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xd3, 0x0d, 0x03,
-  0x6c, 0x0e, 0x07, 0x00, 0xd9, 0x0d, 0x03, 0x68, 0x0e, 0x07, 0x00, 0xf2,
-  0x0d, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xf8, 0x0d, 0x03, 0x6c, 0x0e, 0x07,
-  0x00, 0xff, 0x0d, 0x03, 0x68, 0x0e, 0x07, 0x00, 0x0c, 0x0e, 0x03, 0x6c,
-  0x0e, 0x07, 0x00, 0x12, 0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x19, 0x0e,
-  0x03, 0x68, 0x0e, 0x07, 0x00, 0x28, 0x0e, 0x03, 0x68, 0x0e, 0x07, 0x00,
-  0x2e, 0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x4f, 0x0e, 0x03, 0x6c, 0x0e,
-  0x07, 0x00, 0x5d, 0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x63, 0x0e, 0x03,
-  0x6c, 0x0e, 0x07, 0x00, 0xa5, 0x0e, 0x03, 0x70, 0x0e, 0x07, 0x00, 0xce,
-  0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xd4, 0x0e, 0x03, 0x6c, 0x0e, 0x07,
-  0x00, 0xde, 0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xe4, 0x0e, 0x03, 0x68,
-  0x0e, 0x07, 0x00, 0xf0, 0x0e, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xfb, 0x0e,
-  0x03, 0x6c, 0x0e, 0x07, 0x00, 0x01, 0x0f, 0x03, 0x6c, 0x0e, 0x07, 0x00,
-  0x08, 0x0f, 0x03, 0x68, 0x0e, 0x07, 0x00, 0x1c, 0x0f, 0x03, 0x6c, 0x0e,
-  0x07, 0x00, 0x22, 0x0f, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x29, 0x0f, 0x03,
-  0x68, 0x0e, 0x07, 0x00, 0x36, 0x0f, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x3c,
-  0x0f, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0x43, 0x0f, 0x03, 0x68, 0x0e, 0x07,
-  0x00, 0x5b, 0x0f, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xe4, 0x0f, 0x03, 0x48,
-  0x0e, 0x07, 0x00, 0xee, 0x0f, 0x03, 0x47, 0x0e, 0x07, 0x00, 0xfb, 0x0f,
-  0x03, 0x3c, 0x0e, 0x07, 0x00, 0xfd, 0xff, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x09, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x3a, 0x00, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x46, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x52, 0x00, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0x5e, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x6c,
-  0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x7b, 0x00, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x87, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x93, 0x00, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0xa1, 0x00, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb0, 0x00,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0xd1, 0x00, 0x03, 0x62, 0x0e, 0x07, 0x00,
-  0x78, 0x01, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x84, 0x01, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xa8, 0x01, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb4, 0x01, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xd3, 0x01, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xdf,
-  0x01, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xfe, 0x01, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x0a, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x29, 0x02, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x35, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x55, 0x02,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x61, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x7b, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x87, 0x02, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xa6, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb2, 0x02, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xc9, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xd5,
-  0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xe8, 0x02, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0xf4, 0x02, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x06, 0x03, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x12, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x21, 0x03,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x2f, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x6d, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x79, 0x03, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x8d, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x99, 0x03, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xc7, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xd3,
-  0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xeb, 0x03, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0xf7, 0x03, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x0f, 0x04, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x1b, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x31, 0x04,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x43, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0x7c, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x88, 0x04, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0xad, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb9, 0x04, 0x03,
-  0x54, 0x0e, 0x07, 0x00, 0xe9, 0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xf5,
-  0x04, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x1a, 0x05, 0x03, 0x54, 0x0e, 0x07,
-  0x00, 0x26, 0x05, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x49, 0x05, 0x03, 0x54,
-  0x0e, 0x07, 0x00, 0x5b, 0x05, 0x03, 0x54, 0x0e, 0x07, 0x00, 0x81, 0x05,
-  0x03, 0x54, 0x0e, 0x07, 0x00, 0x90, 0x05, 0x03, 0x54, 0x0e, 0x07, 0x00,
-  0xad, 0x05, 0x03, 0x54, 0x0e, 0x07, 0x00, 0xb9, 0x05, 0x03, 0x54, 0x0e,
-  0x07, 0x00, 0x04, 0x06, 0x01, 0x34, 0x4c, 0x07, 0x00, 0x28, 0x06, 0x03,
-  0x48, 0x0e, 0x07, 0x00, 0x50, 0x06, 0x03, 0x70, 0x0e, 0x07, 0x00, 0x5b,
-  0x06, 0x03, 0x3c, 0x0e, 0x07, 0x00, 0x65, 0x06, 0x03, 0x68, 0x0e, 0x07,
-  0x00, 0x95, 0x06, 0x03, 0x6c, 0x0e, 0x07, 0x00, 0xb1, 0x07, 0x03, 0x47,
-  0x0e, 0x07, 0x00, 0x64, 0x09, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x6d, 0x09,
-  0x03, 0x3c, 0x0e, 0x07, 0x00, 0xa6, 0x09, 0x03, 0x47, 0x0e, 0x07, 0x00,
-  0xb3, 0x0b, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xee, 0x0b, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x26, 0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x48, 0x0c, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x6a, 0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xac,
-  0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xe7, 0x0c, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x1f, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x41, 0x0d, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x63, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xae, 0x0d,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0xe7, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0x1f, 0x0e, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x41, 0x0e, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x63, 0x0e, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xa5, 0x0e, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0xe0, 0x0e, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x18,
-  0x0f, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x3a, 0x0f, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x5c, 0x0f, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xa7, 0x0f, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0xe0, 0x0f, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x47, 0x00,
-  0x03, 0x47, 0x0e, 0x07, 0x00, 0x96, 0x00, 0x03, 0x28, 0x09, 0x07, 0x00,
-  0xab, 0x00, 0x03, 0x28, 0x09, 0x07, 0x00, 0xc1, 0x00, 0x03, 0x47, 0x0e,
-  0x07, 0x00, 0xfd, 0x00, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x0f, 0x01, 0x03,
-  0x28, 0x09, 0x07, 0x00, 0x4e, 0x01, 0x03, 0x28, 0x09, 0x07, 0x00, 0x60,
-  0x01, 0x03, 0x28, 0x09, 0x07, 0x00, 0x6c, 0x01, 0x03, 0x28, 0x09, 0x07,
-  0x00, 0x84, 0x01, 0x03, 0x28, 0x09, 0x07, 0x00, 0x98, 0x01, 0x03, 0x47,
-  0x0e, 0x07, 0x00, 0xbc, 0x01, 0x03, 0x28, 0x09, 0x07, 0x00, 0x00, 0x02,
-  0x03, 0x47, 0x0e, 0x07, 0x00, 0x1b, 0x02, 0x03, 0x28, 0x09, 0x07, 0x00,
-  0x45, 0x02, 0x03, 0x28, 0x09, 0x07, 0x00, 0x81, 0x02, 0x03, 0x47, 0x0e,
-  0x07, 0x00, 0xde, 0x02, 0x03, 0x47, 0x0e, 0x07, 0x00, 0x5f, 0x03, 0x01,
-  0x50, 0x4c, 0x07, 0x00, 0xa3, 0x03, 0x03, 0x46, 0x0e, 0x07, 0x00, 0xae,
-  0x03, 0x03, 0x59, 0x07, 0x07, 0x00, 0xb8, 0x03, 0x03, 0x5c, 0x07, 0x07,
-  0x00, 0xbe, 0x03, 0x03, 0x46, 0x0e, 0x07, 0x00, 0xc9, 0x03, 0x03, 0x5e,
-  0x07, 0x07, 0x00, 0xcf, 0x03, 0x03, 0x46, 0x0e, 0x07, 0x00, 0xf2, 0x03,
-  0x03, 0x59, 0x07, 0x07, 0x00, 0xfc, 0x03, 0x03, 0x63, 0x07, 0x07, 0x00,
-  0x02, 0x04, 0x03, 0x46, 0x0e, 0x07, 0x00, 0x0d, 0x04, 0x03, 0x65, 0x07,
-  0x07, 0x00, 0x13, 0x04, 0x03, 0x46, 0x0e, 0x07, 0x00, 0x1f, 0x04, 0x03,
-  0x74, 0x0e, 0x07, 0x00, 0x82, 0x04, 0x03, 0x44, 0x0e, 0x07, 0x00, 0x8a,
-  0x04, 0x03, 0x45, 0x0e, 0x07, 0x00, 0x93, 0x04, 0x03, 0x4c, 0x0e, 0x07,
-  0x00, 0xa5, 0x04, 0x03, 0x4c, 0x0e, 0x07, 0x00, 0xc2, 0x04, 0x03, 0x4c,
-  0x0e, 0x07, 0x00, 0x30, 0x05, 0x03, 0x4c, 0x0e, 0x07, 0x00, 0x8c, 0x05,
-  0x03, 0x4c, 0x0e, 0x07, 0x00, 0xa3, 0x05, 0x03, 0x4c, 0x0e, 0x07, 0x00,
-  0xc3, 0x05, 0x03, 0x4c, 0x0e, 0x07, 0x00, 0xe6, 0x05, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x1d, 0x06, 0x03, 0xa0, 0x0e, 0x07, 0x00, 0x32, 0x06, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x69, 0x06, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xa8,
-  0x06, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xe5, 0x06, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x07, 0x07, 0x03, 0xa0, 0x0e, 0x07, 0x00, 0x1a, 0x07, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x57, 0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x90, 0x07,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0xb2, 0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0xd4, 0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xfa, 0x07, 0x03, 0xa0, 0x0e,
-  0x07, 0x00, 0x07, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x2e, 0x08, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x6b, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xa4,
-  0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xc6, 0x08, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0xe8, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x04, 0x09, 0x03, 0xa0,
-  0x0e, 0x07, 0x00, 0x0d, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x3b, 0x09,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x51, 0x09, 0x03, 0xa0, 0x0e, 0x07, 0x00,
-  0x72, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xb9, 0x09, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0xf4, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x2c, 0x0a, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x4e, 0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x70,
-  0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xb2, 0x0a, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0xed, 0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x25, 0x0b, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x47, 0x0b, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x69, 0x0b,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x54, 0x0e, 0x03, 0x20, 0x10, 0x07, 0x00,
-  0x5a, 0x0e, 0x03, 0x20, 0x10, 0x07, 0x00, 0x52, 0x0f, 0x03, 0x2d, 0x09,
-  0x07, 0x00, 0x18, 0x00, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x3a, 0x00, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x5c, 0x00, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x9e,
-  0x00, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xd9, 0x00, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x11, 0x01, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x33, 0x01, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x55, 0x01, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x98, 0x01,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0xd2, 0x01, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0x0a, 0x02, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x2c, 0x02, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x4e, 0x02, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x8e, 0x02, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0xc8, 0x02, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x00,
-  0x03, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x22, 0x03, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x44, 0x03, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x84, 0x03, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0xbe, 0x03, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xf6, 0x03,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x18, 0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0x3a, 0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x91, 0x04, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0xcc, 0x04, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x04, 0x05, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x26, 0x05, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x48,
-  0x05, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x8a, 0x05, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0xc5, 0x05, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xfd, 0x05, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x1f, 0x06, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x41, 0x06,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x8c, 0x06, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0xc5, 0x06, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xfd, 0x06, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x1f, 0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x41, 0x07, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x83, 0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xbe,
-  0x07, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xf6, 0x07, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x18, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x3a, 0x08, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x84, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xbf, 0x08,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0xf7, 0x08, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0x19, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x3b, 0x09, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x7d, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xb8, 0x09, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0xf0, 0x09, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x12,
-  0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x34, 0x0a, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0x7f, 0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xb8, 0x0a, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0xf0, 0x0a, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x12, 0x0b,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x34, 0x0b, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0x76, 0x0b, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xaf, 0x0b, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0xe7, 0x0b, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x09, 0x0c, 0x03,
-  0xa1, 0x0e, 0x07, 0x00, 0x2b, 0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x6c,
-  0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xa4, 0x0c, 0x03, 0xa1, 0x0e, 0x07,
-  0x00, 0xdc, 0x0c, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xfe, 0x0c, 0x03, 0xa1,
-  0x0e, 0x07, 0x00, 0x20, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x60, 0x0d,
-  0x03, 0xa1, 0x0e, 0x07, 0x00, 0x9a, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00,
-  0xd2, 0x0d, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0xf4, 0x0d, 0x03, 0xa1, 0x0e,
-  0x07, 0x00, 0x16, 0x0e, 0x03, 0xa1, 0x0e, 0x07, 0x00, 0x13, 0x0a, 0x03,
-  0x9c, 0x07, 0x07, 0x00, 0x1d, 0x0a, 0x03, 0x6c, 0x0a, 0x07, 0x00, 0x2c,
-  0x0a, 0x03, 0xf0, 0x0f, 0x07, 0x00, 0x30, 0x0a, 0x01, 0x3c, 0x9a, 0x07,
-  0x00, 0x38, 0x0a, 0x03, 0xf0, 0x0f, 0x07, 0x00, 0x43, 0x0a, 0x03, 0xa0,
-  0x07, 0x07, 0x00, 0xf7, 0x0b, 0x03, 0x20, 0x14, 0x07, 0x00, 0x65, 0x0c,
-  0x03, 0x2e, 0x10, 0x07, 0x00, 0x94, 0x0c, 0x03, 0x2e, 0x10, 0x07, 0x00,
-  0x3b, 0x0d, 0x03, 0xd1, 0x0d, 0x07, 0x00, 0x4e, 0x0d, 0x03, 0xac, 0x0c,
-  0x07, 0x00, 0x81, 0x0d, 0x03, 0xb8, 0x07, 0x07, 0x00, 0x87, 0x0d, 0x03,
-  0xc6, 0x07, 0x07, 0x00, 0x8d, 0x0d, 0x03, 0xe1, 0x07, 0x07, 0x00, 0x93,
-  0x0d, 0x03, 0xf8, 0x07, 0x07, 0x00, 0x99, 0x0d, 0x03, 0x0a, 0x08, 0x07,
-  0x00, 0x9f, 0x0d, 0x03, 0x22, 0x08, 0x07, 0x00, 0xa8, 0x0d, 0x03, 0xf4,
-  0x0f, 0x07, 0x00, 0xb0, 0x0d, 0x03, 0xf4, 0x0f, 0x07, 0x00, 0xbf, 0x0d,
-  0x03, 0xf8, 0x0f, 0x07, 0x00, 0xe0, 0x0d, 0x03, 0xf8, 0x0f, 0x07, 0x00,
-  0xf0, 0x0d, 0x03, 0xf8, 0x0f, 0x07, 0x00, 0x01, 0x0e, 0x03, 0x9c, 0x0c,
-  0x07, 0x00, 0x38, 0x0e, 0x03, 0xf8, 0x0f, 0x07, 0x00, 0x41, 0x0e, 0x03,
-  0x24, 0x08, 0x07, 0x00, 0x46, 0x0e, 0x03, 0x6c, 0x0a, 0x07, 0x00, 0x89,
-  0x0e, 0x01, 0xd0, 0x9c, 0x07, 0x00, 0x92, 0x0e, 0x03, 0xf8, 0x0f, 0x07,
-  0x00, 0xe3, 0x0e, 0x01, 0x02, 0x9d, 0x07, 0x00, 0xec, 0x0e, 0x03, 0xf8,
-  0x0f, 0x07, 0x00, 0x14, 0x0f, 0x03, 0xf8, 0x0f, 0x07, 0x00, 0x63, 0x0f,
-  0x03, 0xf8, 0x0f, 0x07, 0x00, 0xb3, 0x0f, 0x03, 0xf8, 0x0f, 0x07, 0x00,
-  0xed, 0x0f, 0x03, 0xf8, 0x0f, 0x07, 0x00, 0xa8, 0x00, 0x03, 0xa4, 0x0e,
-  0x07, 0x00, 0xb4, 0x00, 0x03, 0xa0, 0x0e, 0x07, 0x00, 0xe8, 0x01, 0x01,
-  0x03, 0x00, 0x07, 0x00, 0xfa, 0x01, 0x03, 0x14, 0x10, 0x07, 0x00, 0x00,
-  0x02, 0x03, 0x00, 0x10, 0x07, 0x00, 0x0a, 0x02, 0x03, 0x0c, 0x10, 0x07,
-  0x00, 0x1a, 0x02, 0x03, 0x37, 0x10, 0x07, 0x00, 0x20, 0x02, 0x03, 0x38,
-  0x10, 0x07, 0x00, 0x41, 0x02, 0x03, 0x0c, 0x10, 0x07, 0x00, 0x5a, 0x02,
-  0x03, 0x00, 0x10, 0x07, 0x00, 0x8e, 0x02, 0x03, 0xc8, 0x0f, 0x07, 0x00,
-  0xa9, 0x02, 0x03, 0x0c, 0x10, 0x07, 0x00, 0xb8, 0x02, 0x03, 0x2e, 0x10,
-  0x07, 0x00, 0xbe, 0x02, 0x03, 0x2f, 0x10, 0x07, 0x00, 0xc9, 0x02, 0x01,
-  0x31, 0x94, 0x07, 0x00, 0xcf, 0x02, 0x03, 0x31, 0x10, 0x07, 0x00, 0xd6,
-  0x02, 0x03, 0x35, 0x10, 0x07, 0x00, 0xde, 0x02, 0x03, 0x0c, 0x10, 0x07,
-  0x00, 0xe3, 0x02, 0x03, 0x86, 0x15, 0x07, 0x00, 0x1a, 0x03, 0x03, 0x35,
-  0x10, 0x07, 0x00, 0x70, 0x03, 0x03, 0x2c, 0x10, 0x07, 0x00, 0x76, 0x03,
-  0x03, 0x40, 0x10, 0x07, 0x00, 0x7c, 0x03, 0x03, 0x10, 0x10, 0x07, 0x00,
-  0x82, 0x03, 0x03, 0xfc, 0x0f, 0x07, 0x00, 0x87, 0x03, 0x03, 0x86, 0x15,
-  0x07, 0x00, 0x8c, 0x03, 0x03, 0x00, 0x11, 0x07, 0x00, 0x94, 0x03, 0x03,
-  0x2e, 0x10, 0x07, 0x00, 0xb9, 0x03, 0x03, 0x86, 0x15, 0x07, 0x00, 0xc3,
-  0x03, 0x03, 0x04, 0x10, 0x07, 0x00, 0xc9, 0x03, 0x03, 0x08, 0x10, 0x07,
-  0x00, 0xe3, 0x03, 0x01, 0xec, 0x91, 0x07, 0x00, 0x03, 0x04, 0x01, 0xf0,
-  0x91, 0x07, 0x00, 0x2c, 0x04, 0x01, 0x31, 0x94, 0x07, 0x00, 0x44, 0x04,
-  0x03, 0x79, 0x0a, 0x07, 0x00, 0x50, 0x04, 0x03, 0x38, 0x0a, 0x07, 0x00,
-  0x56, 0x04, 0x03, 0x79, 0x0a, 0x07, 0x00, 0x5c, 0x04, 0x03, 0x44, 0x0a,
-  0x07, 0x00, 0x74, 0x04, 0x03, 0x20, 0x14, 0x07, 0x00, 0x9d, 0x04, 0x03,
-  0x20, 0x14, 0x07, 0x00, 0xab, 0x04, 0x03, 0x24, 0x14, 0x07, 0x00, 0xc9,
-  0x04, 0x03, 0x6c, 0x07, 0x07, 0x00, 0xe8, 0x04, 0x03, 0x38, 0x0a, 0x07,
-  0x00, 0xef, 0x04, 0x03, 0x20, 0x14, 0x07, 0x00, 0x27, 0x05, 0x03, 0xba,
-  0x0a, 0x07, 0x00, 0xd7, 0x05, 0x01, 0x60, 0x95, 0x07, 0x00, 0x30, 0x06,
-  0x03, 0x58, 0x14, 0x07, 0x00, 0x7a, 0x06, 0x03, 0xd0, 0x0f, 0x07, 0x00,
-  0xb8, 0x06, 0x03, 0xcc, 0x0f, 0x07, 0x00, 0xd9, 0x06, 0x03, 0xcc, 0x0f,
-  0x07, 0x00, 0xf0, 0x06, 0x03, 0x58, 0x14, 0x07, 0x00, 0xf6, 0x06, 0x03,
-  0xd0, 0x0f, 0x07, 0x00, 0x01, 0x07, 0x03, 0xd4, 0x0f, 0x07, 0x00, 0x08,
-  0x07, 0x03, 0xd4, 0x0f, 0x07, 0x00, 0x4c, 0x07, 0x03, 0xd4, 0x0f, 0x07,
-  0x00, 0x54, 0x07, 0x03, 0xd0, 0x0f, 0x07, 0x00, 0x99, 0x07, 0x03, 0xd4,
-  0x0f, 0x07, 0x00, 0x9f, 0x07, 0x03, 0xcc, 0x0f, 0x07, 0x00, 0xa9, 0x07,
-  0x03, 0xd4, 0x0f, 0x07, 0x00, 0xaf, 0x07, 0x03, 0xcc, 0x0f, 0x07, 0x00,
-  0xba, 0x07, 0x03, 0xd0, 0x0f, 0x07, 0x00, 0xc3, 0x07, 0x03, 0xcc, 0x0f,
-  0x07, 0x00, 0xe0, 0x07, 0x03, 0xd4, 0x0f, 0x07, 0x00, 0xf0, 0x07, 0x03,
-  0xd4, 0x0f, 0x07, 0x00, 0x64, 0x08, 0x01, 0x20, 0x98, 0x07, 0x00, 0xc3,
-  0x08, 0x01, 0x20, 0x98, 0x07, 0x00, 0x42, 0x09, 0x03, 0xd8, 0x0f, 0x07,
-  0x00, 0x74, 0x09, 0x03, 0x10, 0x10, 0x07, 0x00, 0x7f, 0x09, 0x03, 0xdc,
-  0x0f, 0x07, 0x00, 0xa1, 0x09, 0x03, 0x10, 0x10, 0x07, 0x00, 0xae, 0x09,
-  0x03, 0xdc, 0x0f, 0x07, 0x00, 0xb6, 0x09, 0x03, 0xde, 0x0f, 0x07, 0x00,
-  0x04, 0x0a, 0x03, 0x6c, 0x0a, 0x07, 0x00, 0x0e, 0x0a, 0x03, 0x6c, 0x0a,
-  0x07, 0x00, 0xf2, 0x00, 0x03, 0x20, 0x10, 0x07, 0x00, 0x95, 0x01, 0x03,
-  0x18, 0x10, 0x07, 0x00, 0xa0, 0x01, 0x03, 0x18, 0x10, 0x07, 0x00, 0xab,
-  0x01, 0x03, 0x1c, 0x10, 0x07, 0x00, 0xb6, 0x01, 0x03, 0x70, 0x14, 0x07,
-  0x00, 0xbb, 0x01, 0x03, 0x6c, 0x14, 0x07, 0x00, 0xe8, 0x01, 0x03, 0xee,
-  0x10, 0x07, 0x00, 0xed, 0x01, 0x03, 0xd0, 0x10, 0x07, 0x00, 0x0d, 0x02,
-  0x03, 0xee, 0x10, 0x07, 0x00, 0x15, 0x02, 0x03, 0xee, 0x10, 0x07, 0x00,
-  0x39, 0x02, 0x03, 0x00, 0x11, 0x07, 0x00, 0x3e, 0x02, 0x03, 0xee, 0x10,
-  0x07, 0x00, 0x5e, 0x02, 0x03, 0x00, 0x11, 0x07, 0x00, 0x66, 0x02, 0x03,
-  0x00, 0x11, 0x07, 0x00, 0x94, 0x02, 0x03, 0x4c, 0x14, 0x07, 0x00, 0x99,
-  0x02, 0x03, 0x48, 0x14, 0x07, 0x00, 0x9f, 0x02, 0x03, 0x04, 0x10, 0x07,
-  0x00, 0xa5, 0x02, 0x03, 0x08, 0x10, 0x07, 0x00, 0xaa, 0x02, 0x03, 0x74,
-  0x14, 0x07, 0x00, 0xb4, 0x02, 0x03, 0x5c, 0x14, 0x07, 0x00, 0xb9, 0x02,
-  0x03, 0x48, 0x14, 0x07, 0x00, 0xbe, 0x02, 0x03, 0x50, 0x14, 0x07, 0x00,
-  0xc3, 0x02, 0x03, 0x6c, 0x14, 0x07, 0x00, 0xc8, 0x02, 0x03, 0x4c, 0x14,
-  0x07, 0x00, 0xcd, 0x02, 0x03, 0x54, 0x14, 0x07, 0x00, 0xd2, 0x02, 0x03,
-  0x70, 0x14, 0x07, 0x00, 0x81, 0x04, 0x03, 0x5c, 0x14, 0x07, 0x00, 0x1f,
-  0x05, 0x03, 0x60, 0x14, 0x07, 0x00, 0x65, 0x05, 0x03, 0x20, 0x14, 0x07,
-  0x00, 0x96, 0x05, 0x03, 0x20, 0x14, 0x07, 0x00, 0xba, 0x05, 0x03, 0x24,
-  0x14, 0x07, 0x00, 0xbf, 0x05, 0x03, 0x24, 0x14, 0x07, 0x00, 0xd3, 0x05,
-  0x03, 0x24, 0x14, 0x07, 0x00, 0xdb, 0x05, 0x03, 0x24, 0x14, 0x07, 0x00,
-  0xe8, 0x05, 0x03, 0x24, 0x14, 0x07, 0x00, 0x35, 0x03, 0x03, 0x4c, 0x10,
-  0x07, 0x00, 0x3f, 0x05, 0x03, 0x78, 0x14, 0x07, 0x00, 0x52, 0x05, 0x03,
-  0x7d, 0x14, 0x07, 0x00, 0xd6, 0x07, 0x03, 0xd0, 0x0f, 0x07, 0x00, 0xdc,
-  0x07, 0x03, 0xcc, 0x0f, 0x07, 0x00, 0xf3, 0x07, 0x03, 0xcc, 0x0f, 0x07,
-  0x00, 0xf9, 0x07, 0x03, 0xd4, 0x0f, 0x07, 0x00, 0xff, 0x07, 0x03, 0x58,
-  0x14, 0x07, 0x00, 0x09, 0x08, 0x03, 0x58, 0x14, 0x07, 0x00, 0x20, 0x08,
-  0x03, 0xd0, 0x0f, 0x07, 0x00, 0x2e, 0x08, 0x03, 0xcc, 0x0f, 0x07, 0x00,
-  0x39, 0x08, 0x03, 0xd0, 0x0f, 0x07, 0x00, 0x57, 0x08, 0x03, 0xcc, 0x0f,
-  0x07, 0x00, 0xca, 0x08, 0x03, 0x54, 0x10, 0x07, 0x00, 0xdf, 0x08, 0x03,
-  0xcc, 0x0f, 0x07, 0x00, 0xd5, 0x09, 0x03, 0xcc, 0x0f, 0x07, 0x00, 0x40,
-  0x0a, 0x03, 0xcc, 0x0f, 0x07, 0x00, 0x53, 0x0a, 0x03, 0xcc, 0x0f, 0x07,
-  0x00, 0x66, 0x0a, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x74, 0x0a, 0x03, 0x30,
-  0x10, 0x07, 0x00, 0x85, 0x0a, 0x03, 0x00, 0x10, 0x07, 0x00, 0x8b, 0x0a,
-  0x03, 0x00, 0x10, 0x07, 0x00, 0xdb, 0x0a, 0x03, 0x82, 0x15, 0x07, 0x00,
-  0x0f, 0x0b, 0x03, 0x80, 0x15, 0x07, 0x00, 0x1b, 0x0b, 0x03, 0x80, 0x15,
-  0x07, 0x00, 0x93, 0x0b, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x9c, 0x0b, 0x03,
-  0x2f, 0x10, 0x07, 0x00, 0xb1, 0x0b, 0x03, 0x58, 0x10, 0x07, 0x00, 0xd2,
-  0x0b, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x0a, 0x0c, 0x03, 0x54, 0x10, 0x07,
-  0x00, 0x14, 0x0c, 0x03, 0x00, 0x10, 0x07, 0x00, 0x31, 0x0c, 0x03, 0x2e,
-  0x10, 0x07, 0x00, 0xcc, 0x0c, 0x03, 0x2e, 0x10, 0x07, 0x00, 0xd5, 0x0c,
-  0x03, 0x2f, 0x10, 0x07, 0x00, 0xde, 0x0c, 0x03, 0x2e, 0x10, 0x07, 0x00,
-  0xe6, 0x0c, 0x03, 0x54, 0x10, 0x07, 0x00, 0xf0, 0x0c, 0x03, 0x00, 0x10,
-  0x07, 0x00, 0x18, 0x0d, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x28, 0x0d, 0x03,
-  0x30, 0x10, 0x07, 0x00, 0x39, 0x0d, 0x03, 0x00, 0x10, 0x07, 0x00, 0x42,
-  0x0d, 0x03, 0x00, 0x10, 0x07, 0x00, 0x76, 0x0d, 0x03, 0xcc, 0x0f, 0x07,
-  0x00, 0x35, 0x0e, 0x01, 0x10, 0xbe, 0x07, 0x00, 0x81, 0x0f, 0x03, 0x64,
-  0x14, 0x07, 0x00, 0x91, 0x0f, 0x03, 0x68, 0x14, 0x07, 0x00, 0xa6, 0x0f,
-  0x03, 0x2e, 0x10, 0x07, 0x00, 0xac, 0x0f, 0x03, 0x58, 0x10, 0x07, 0x00,
-  0xcd, 0x0f, 0x01, 0x33, 0x94, 0x07, 0x00, 0xd2, 0x0f, 0x01, 0x28, 0x94,
-  0x07, 0x00, 0xd8, 0x0f, 0x01, 0x28, 0x94, 0x07, 0x00, 0x07, 0x00, 0x03,
-  0x44, 0x10, 0x07, 0x00, 0x1c, 0x00, 0x03, 0x44, 0x10, 0x07, 0x00, 0x22,
-  0x00, 0x03, 0x48, 0x10, 0x07, 0x00, 0x32, 0x00, 0x03, 0x44, 0x10, 0x07,
-  0x00, 0x38, 0x00, 0x03, 0x48, 0x10, 0x07, 0x00, 0x35, 0x01, 0x03, 0xa0,
-  0x08, 0x07, 0x00, 0xb7, 0x01, 0x03, 0x7c, 0x08, 0x07, 0x00, 0x0c, 0x02,
-  0x03, 0xa0, 0x08, 0x07, 0x00, 0x9a, 0x02, 0x03, 0xa0, 0x08, 0x07, 0x00,
-  0xf2, 0x02, 0x03, 0x7d, 0x14, 0x07, 0x00, 0x14, 0x03, 0x03, 0x54, 0x10,
-  0x07, 0x00, 0x1a, 0x03, 0x03, 0x54, 0x10, 0x07, 0x00, 0x29, 0x03, 0x03,
-  0x2e, 0x10, 0x07, 0x00, 0x32, 0x03, 0x03, 0x2f, 0x10, 0x07, 0x00, 0x4e,
-  0x03, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x99, 0x03, 0x03, 0x2e, 0x10, 0x07,
-  0x00, 0xb6, 0x03, 0x03, 0x00, 0x10, 0x07, 0x00, 0xbb, 0x03, 0x03, 0x00,
-  0x10, 0x07, 0x00, 0x0e, 0x04, 0x03, 0x14, 0x10, 0x07, 0x00, 0x16, 0x04,
-  0x03, 0x2e, 0x10, 0x07, 0x00, 0x67, 0x04, 0x03, 0x00, 0x10, 0x07, 0x00,
-  0x6d, 0x04, 0x03, 0x00, 0x10, 0x07, 0x00, 0xce, 0x04, 0x03, 0x2e, 0x10,
-  0x07, 0x00, 0xd9, 0x04, 0x03, 0x2f, 0x10, 0x07, 0x00, 0x59, 0x05, 0x03,
-  0x37, 0x10, 0x07, 0x00, 0x6d, 0x05, 0x03, 0x59, 0x10, 0x07, 0x00, 0xd3,
-  0x05, 0x03, 0x70, 0x10, 0x07, 0x00, 0xe0, 0x05, 0x03, 0xc4, 0x10, 0x07,
-  0x00, 0xf3, 0x05, 0x03, 0x70, 0x10, 0x07, 0x00, 0xfe, 0x05, 0x03, 0xc4,
-  0x10, 0x07, 0x00, 0x6c, 0x06, 0x01, 0x09, 0xc7, 0x07, 0x00, 0xe0, 0x06,
-  0x01, 0x09, 0xc7, 0x07, 0x00, 0x1a, 0x0a, 0x03, 0xc8, 0x10, 0x07, 0x00,
-  0x24, 0x0a, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x79, 0x0a, 0x03, 0xc8, 0x10,
-  0x07, 0x00, 0x9a, 0x0a, 0x03, 0xc8, 0x10, 0x07, 0x00, 0xd7, 0x0a, 0x03,
-  0x7c, 0x14, 0x07, 0x00, 0xf4, 0x0a, 0x03, 0x78, 0x14, 0x07, 0x00, 0xf9,
-  0x0a, 0x03, 0xcc, 0x10, 0x07, 0x00, 0xfe, 0x0a, 0x03, 0x7c, 0x14, 0x07,
-  0x00, 0x53, 0x0b, 0x03, 0x78, 0x14, 0x07, 0x00, 0x5d, 0x0b, 0x03, 0xcc,
-  0x10, 0x07, 0x00, 0x9b, 0x0b, 0x03, 0x78, 0x14, 0x07, 0x00, 0xce, 0x0b,
-  0x03, 0xcc, 0x10, 0x07, 0x00, 0xe3, 0x0b, 0x03, 0x2e, 0x10, 0x07, 0x00,
-  0x6a, 0x0c, 0x03, 0x84, 0x15, 0x07, 0x00, 0x75, 0x0c, 0x03, 0x2e, 0x10,
-  0x07, 0x00, 0xba, 0x0c, 0x03, 0x84, 0x15, 0x07, 0x00, 0xda, 0x0c, 0x03,
-  0x2e, 0x10, 0x07, 0x00, 0x91, 0x0d, 0x03, 0x84, 0x15, 0x07, 0x00, 0xbf,
-  0x0d, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x49, 0x0e, 0x03, 0x84, 0x15, 0x07,
-  0x00, 0xf5, 0x0e, 0x03, 0x2e, 0x10, 0x07, 0x00, 0xfe, 0x0e, 0x03, 0x30,
-  0x10, 0x07, 0x00, 0x07, 0x0f, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x17, 0x0f,
-  0x03, 0x2e, 0x10, 0x07, 0x00, 0x26, 0x0f, 0x03, 0x2f, 0x10, 0x07, 0x00,
-  0x2f, 0x0f, 0x03, 0x2e, 0x10, 0x07, 0x00, 0x3f, 0x0f, 0x03, 0x2f, 0x10,
-  0x07, 0x00, 0x49, 0x0f, 0x03, 0x84, 0x15, 0x07, 0x00, 0x53, 0x0f, 0x03,
-  0xca, 0x0f, 0x07, 0x00, 0x8c, 0x0f, 0x03, 0xc8, 0x08, 0x07, 0x00, 0x9f,
-  0x0f, 0x03, 0x84, 0x15, 0x07, 0x00, 0xc3, 0x0f, 0x03, 0xee, 0x08, 0x07,
-  0x00, 0xd2, 0x0f, 0x03, 0x2e, 0x10, 0x07, 0x00, 0xdc, 0x0f, 0x03, 0x2f,
-  0x10, 0x07, 0x00, 0xe7, 0x0f, 0x03, 0x84, 0x15, 0x07, 0x00, 0x17, 0x00,
-  0x03, 0xda, 0x0d, 0x07, 0x00, 0x1f, 0x00, 0x03, 0xda, 0x0d, 0x07, 0x00,
-  0x26, 0x00, 0x03, 0xda, 0x0d, 0x07, 0x00, 0x2f, 0x00, 0x03, 0xda, 0x0d,
-  0x07, 0x00, 0x35, 0x00, 0x03, 0xda, 0x0d, 0x07, 0x00, 0x45, 0x00, 0x03,
-  0xd8, 0x0d, 0x07, 0x00, 0x84, 0x00, 0x03, 0xd8, 0x0d, 0x07, 0x00, 0x8e,
-  0x00, 0x03, 0xa4, 0x0d, 0x07, 0x00, 0x9f, 0x00, 0x03, 0xd4, 0x0d, 0x07,
-  0x00, 0xab, 0x00, 0x03, 0xc1, 0x0d, 0x07, 0x00, 0xfd, 0x00, 0x03, 0xb1,
-  0x0d, 0x07, 0x00, 0x03, 0x01, 0x03, 0xb5, 0x0d, 0x07, 0x00, 0x09, 0x01,
-  0x03, 0xb9, 0x0d, 0x07, 0x00, 0x0e, 0x01, 0x03, 0xbd, 0x0d, 0x07, 0x00,
-  0x30, 0x0a, 0x03, 0x04, 0x00, 0x07, 0x00, 0xb0, 0x0c, 0x03, 0xf4, 0x03,
-  0x07, 0x00, 0xb4, 0x0c, 0x03, 0xf9, 0x03, 0x07, 0x00, 0xb8, 0x0c, 0x03,
-  0xfe, 0x03, 0x07, 0x00, 0xbc, 0x0c, 0x03, 0x07, 0x04, 0x07, 0x00, 0xc0,
-  0x0c, 0x03, 0x10, 0x04, 0x07, 0x00, 0xc4, 0x0c, 0x03, 0x13, 0x04, 0x07,
-  0x00, 0x48, 0x0d, 0x03, 0x18, 0x04, 0x07, 0x00, 0x4c, 0x0d, 0x03, 0x1f,
-  0x04, 0x07, 0x00, 0xdc, 0x0d, 0x03, 0x80, 0x05, 0x07, 0x00, 0xe0, 0x0d,
-  0x03, 0x85, 0x05, 0x07, 0x00, 0xe4, 0x0d, 0x03, 0x89, 0x05, 0x07, 0x00,
-  0xe8, 0x0d, 0x03, 0x8d, 0x05, 0x07, 0x00, 0xec, 0x0d, 0x03, 0x91, 0x05,
-  0x07, 0x00, 0xf0, 0x0d, 0x03, 0x95, 0x05, 0x07, 0x00, 0xf4, 0x0d, 0x03,
-  0x99, 0x05, 0x07, 0x00, 0x28, 0x0e, 0x03, 0x9c, 0x06, 0x07, 0x00, 0x2c,
-  0x0e, 0x03, 0xa5, 0x06, 0x07, 0x00, 0xf0, 0x0f, 0x01, 0x3c, 0x9a, 0x07,
-  0x00, 0xd2, 0x00, 0x01, 0x40, 0x94, 0x07, 0x00, 0xf0, 0x00, 0x01, 0x50,
-  0x95, 0x07, 0x00, 0xd8, 0x00, 0x01, 0x90, 0xa2, 0x07, 0x00, 0xf6, 0x00,
-  0x01, 0x80, 0xa4, 0x07, 0x00, 0xde, 0x00, 0x01, 0x7c, 0x99, 0x07, 0x00,
-  0x39, 0x00, 0x01, 0x09, 0xa1, 0x07, 0x00, 0x44, 0x00, 0x01, 0x00, 0xc0,
-  0x07, 0x00, 0x48, 0x00, 0x01, 0x00, 0xc0, 0x07, 0x00, 0x4c, 0x00, 0x01,
-  0xb0, 0xc1, 0x07, 0x00, 0x50, 0x00, 0x01, 0xb0, 0xc1, 0x07, 0x00, 0xe4,
-  0x00, 0x01, 0x00, 0xc3, 0x07, 0x00, 0xc4, 0x00, 0x03, 0x74, 0x10, 0x07,
-  0x00, 0xea, 0x00, 0x01, 0xf0, 0xce, 0x07, 0x00, 0xfc, 0x00, 0x01, 0xd0,
-  0xcf, 0x00, 0x00, 0x00, 0xcc, 0xeb, 0xfd, 0x90, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x68, 0x15, 0x00, 0x00,
-  0x00, 0x68, 0x6c, 0x0a, 0x00, 0x00, 0xe8, 0xa1, 0x08, 0x00, 0x00, 0x83,
-  0xc4, 0x08, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x04, 0x89, 0xc7, 0x89, 0x55, 0xec, 0xbe, 0x01, 0x00, 0x00, 0x00,
-  0x39, 0xf0, 0x7e, 0x52, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x89, 0xd9, 0x03,
-  0x4d, 0xec, 0x8b, 0x09, 0x46, 0x8a, 0x01, 0x83, 0xc3, 0x04, 0x3c, 0x2d,
-  0x74, 0x04, 0x3c, 0x2f, 0x75, 0x26, 0x41, 0x80, 0x39, 0x2d, 0x74, 0xfa,
-  0xba, 0x27, 0x00, 0x00, 0x00, 0x89, 0xc8, 0xe8, 0x88, 0x08, 0x00, 0x00,
-  0x85, 0xc0, 0x74, 0x10, 0xba, 0x2a, 0x00, 0x00, 0x00, 0x89, 0xc8, 0xe8,
-  0x78, 0x08, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x06, 0x39, 0xfe, 0x7c, 0xc1,
-  0xeb, 0x0c, 0xe8, 0x89, 0xff, 0xff, 0xff, 0xb8, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x0c,
-  0x89, 0x45, 0xec, 0x89, 0x5d, 0xf0, 0x89, 0x4d, 0xf4, 0x89, 0xd6, 0x80,
-  0x3d, 0x34, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x90, 0x00, 0x00, 0x00,
-  0x83, 0xf9, 0x01, 0x77, 0x27, 0x74, 0x25, 0xbb, 0x10, 0x00, 0x00, 0x00,
-  0x89, 0xd0, 0x31, 0xc9, 0x31, 0xd2, 0xe8, 0x5d, 0x09, 0x00, 0x00, 0x03,
-  0x45, 0xf0, 0x13, 0x55, 0xf4, 0x83, 0xfa, 0x01, 0x77, 0x0a, 0x0f, 0x85,
-  0x68, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x76, 0x64, 0xc1, 0xe6, 0x04, 0x85,
-  0xf6, 0x76, 0x49, 0x8b, 0x45, 0xec, 0x56, 0x8b, 0x5d, 0xf0, 0x8b, 0x4d,
-  0xf4, 0xe8, 0xea, 0x0a, 0x00, 0x00, 0xe8, 0xb1, 0x0b, 0x00, 0x00, 0x89,
-  0xc7, 0x85, 0xc0, 0x7e, 0x2f, 0x39, 0xf0, 0x7e, 0x19, 0xb9, 0x69, 0x00,
-  0x00, 0x00, 0xbb, 0x2d, 0x00, 0x00, 0x00, 0xba, 0x36, 0x00, 0x00, 0x00,
-  0xb8, 0x43, 0x00, 0x00, 0x00, 0xe8, 0x6a, 0x12, 0x00, 0x00, 0x89, 0xf8,
-  0x99, 0x29, 0xfe, 0x01, 0x45, 0xf0, 0x11, 0x55, 0xf4, 0x01, 0x7d, 0xec,
-  0x85, 0xf6, 0x77, 0xb7, 0x85, 0xf6, 0x0f, 0x84, 0x72, 0x00, 0x00, 0x00,
-  0xba, 0xff, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xec, 0x89, 0xf3, 0xeb, 0x61,
-  0x80, 0x3d, 0x35, 0x0a, 0x00, 0x00, 0x00, 0x75, 0x2e, 0x83, 0x7d, 0xf4,
-  0x00, 0x75, 0x45, 0x81, 0x7d, 0xf0, 0x00, 0x00, 0x10, 0x00, 0x73, 0x3c,
-  0xbb, 0x10, 0x00, 0x00, 0x00, 0x89, 0xf0, 0x31, 0xd2, 0x31, 0xc9, 0xe8,
-  0xbc, 0x08, 0x00, 0x00, 0x03, 0x45, 0xf0, 0x13, 0x55, 0xf4, 0x75, 0x24,
-  0x3d, 0x00, 0x00, 0x10, 0x00, 0x77, 0x1d, 0x8b, 0x7d, 0xec, 0x89, 0xf1,
-  0x8b, 0x75, 0xf0, 0xc1, 0xe1, 0x04, 0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02,
-  0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03, 0xf3, 0xa4, 0x5f, 0xeb, 0x12,
-  0xba, 0xff, 0x00, 0x00, 0x00, 0x89, 0xf3, 0x8b, 0x45, 0xec, 0xc1, 0xe3,
-  0x04, 0xe8, 0xee, 0x13, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5f, 0x5e, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x40, 0xe8, 0x59, 0xfe, 0xff, 0xff, 0xc7, 0x45, 0xc8, 0x00, 0x00,
-  0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x45, 0xc4, 0x00, 0x00,
-  0x00, 0x00, 0xc7, 0x45, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x45, 0xd4,
-  0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x07, 0x89, 0xf0, 0xe9, 0xc0,
-  0x06, 0x00, 0x00, 0x68, 0x54, 0x00, 0x00, 0x00, 0xe8, 0xbf, 0x13, 0x00,
-  0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00, 0x00, 0xe8, 0xe2, 0x13,
-  0x00, 0x00, 0xe8, 0x75, 0x1e, 0x00, 0x00, 0x68, 0x59, 0x00, 0x00, 0x00,
-  0xe8, 0xa3, 0x13, 0x00, 0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00,
-  0x00, 0xe8, 0xc6, 0x13, 0x00, 0x00, 0xe8, 0x6d, 0x1f, 0x00, 0x00, 0x68,
-  0x5e, 0x00, 0x00, 0x00, 0xe8, 0x87, 0x13, 0x00, 0x00, 0x83, 0xc4, 0x04,
-  0xb8, 0x52, 0x0a, 0x00, 0x00, 0xe8, 0xaa, 0x13, 0x00, 0x00, 0xe8, 0xe5,
-  0x39, 0x00, 0x00, 0x68, 0x63, 0x00, 0x00, 0x00, 0xe8, 0x6b, 0x13, 0x00,
-  0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00, 0x00, 0xe8, 0x8e, 0x13,
-  0x00, 0x00, 0xe8, 0x3d, 0x1c, 0x00, 0x00, 0x68, 0x69, 0x00, 0x00, 0x00,
-  0xe8, 0x4f, 0x13, 0x00, 0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00,
-  0x00, 0xe8, 0x72, 0x13, 0x00, 0x00, 0xe8, 0x6d, 0x3f, 0x00, 0x00, 0x68,
-  0x70, 0x00, 0x00, 0x00, 0xe8, 0x33, 0x13, 0x00, 0x00, 0x83, 0xc4, 0x04,
-  0xb8, 0x52, 0x0a, 0x00, 0x00, 0xe8, 0x56, 0x13, 0x00, 0x00, 0xe8, 0x45,
-  0x46, 0x00, 0x00, 0x68, 0x75, 0x00, 0x00, 0x00, 0xe8, 0x17, 0x13, 0x00,
-  0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00, 0x00, 0xe8, 0x3a, 0x13,
-  0x00, 0x00, 0xe8, 0x05, 0x26, 0x00, 0x00, 0x68, 0x7a, 0x00, 0x00, 0x00,
-  0xe8, 0xfb, 0x12, 0x00, 0x00, 0x83, 0xc4, 0x04, 0xb8, 0x52, 0x0a, 0x00,
-  0x00, 0xe8, 0x1e, 0x13, 0x00, 0x00, 0xe8, 0x79, 0x07, 0x00, 0x00, 0x68,
-  0x81, 0x00, 0x00, 0x00, 0xa2, 0x34, 0x0a, 0x00, 0x00, 0xe8, 0xda, 0x12,
-  0x00, 0x00, 0x83, 0xc4, 0x04, 0xe8, 0xe2, 0x4d, 0x00, 0x00, 0x85, 0xc0,
-  0x75, 0x0b, 0x89, 0xf0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d,
-  0xc3, 0x80, 0x3d, 0x48, 0x0e, 0x00, 0x00, 0x32, 0x76, 0x07, 0xc6, 0x05,
-  0x48, 0x0e, 0x00, 0x00, 0x32, 0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x00,
-  0x74, 0x1a, 0x68, 0x87, 0x00, 0x00, 0x00, 0xe8, 0xa0, 0x12, 0x00, 0x00,
-  0x83, 0xc4, 0x04, 0x68, 0xc8, 0x00, 0x00, 0x00, 0xe8, 0x93, 0x12, 0x00,
-  0x00, 0x83, 0xc4, 0x04, 0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x00, 0x75,
-  0x19, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x03, 0x7c, 0x10, 0xf6, 0x05,
-  0x2c, 0x14, 0x00, 0x00, 0x01, 0x75, 0x07, 0xc6, 0x05, 0x35, 0x0a, 0x00,
-  0x00, 0x01, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x0f, 0xb8,
-  0x01, 0x00, 0x00, 0x00, 0xe8, 0x5f, 0x3f, 0x00, 0x00, 0xe9, 0x81, 0x01,
-  0x00, 0x00, 0xfa, 0xe8, 0x7c, 0x72, 0x00, 0x00, 0x84, 0xc0, 0x0f, 0x84,
-  0x63, 0x01, 0x00, 0x00, 0xe8, 0x53, 0x72, 0x00, 0x00, 0xb1, 0xad, 0xbb,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x08, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x88, 0xc8, 0xee, 0xb1, 0xd0, 0xbb, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x4b, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4,
-  0x02, 0x75, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xc8, 0xee, 0xbb,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x44, 0xbb, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x4b, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x22, 0xbb, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x4b, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0xba, 0x60, 0x00, 0x00, 0x00, 0xb1, 0xd1, 0xbb, 0xff, 0xff, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0x45, 0xec,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x08, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x88, 0xc8, 0xee, 0x8a, 0x4d, 0xec, 0xbb, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x80, 0xc9, 0x03, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x08, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x88, 0xc8, 0xee, 0xe8, 0x25, 0x71, 0x00, 0x00, 0xb1,
-  0xae, 0xbb, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x4b, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x08, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x88, 0xc8, 0xee, 0xe8, 0xf5, 0x70, 0x00, 0x00, 0xba,
-  0x92, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xa8, 0x02, 0x75, 0x03, 0x0c,
-  0x03, 0xee, 0xfb, 0x6a, 0x00, 0x6a, 0x00, 0x0f, 0xb6, 0x05, 0x35, 0x0a,
-  0x00, 0x00, 0x50, 0x68, 0xfd, 0x00, 0x00, 0x00, 0xe8, 0xbf, 0x10, 0x00,
-  0x00, 0x83, 0xc4, 0x10, 0xff, 0x35, 0x5c, 0x0c, 0x00, 0x00, 0xff, 0x35,
-  0x58, 0x0c, 0x00, 0x00, 0xff, 0x35, 0x68, 0x0c, 0x00, 0x00, 0x80, 0x3d,
-  0x34, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x07, 0xb8, 0x20, 0x01, 0x00, 0x00,
-  0xeb, 0x05, 0xb8, 0x24, 0x01, 0x00, 0x00, 0x50, 0x68, 0x27, 0x01, 0x00,
-  0x00, 0xe8, 0x8a, 0x10, 0x00, 0x00, 0x83, 0xc4, 0x14, 0x68, 0x44, 0x01,
-  0x00, 0x00, 0xe8, 0x7d, 0x10, 0x00, 0x00, 0x83, 0xc4, 0x04, 0xe8, 0x05,
-  0x89, 0x00, 0x00, 0x83, 0x7d, 0xc8, 0x00, 0x0f, 0x85, 0x5b, 0x03, 0x00,
-  0x00, 0x85, 0xf6, 0x0f, 0x84, 0x87, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x11,
-  0x00, 0x00, 0x8b, 0x5d, 0xd0, 0x8b, 0x4d, 0xd4, 0x0f, 0xb6, 0x15, 0x48,
-  0x0e, 0x00, 0x00, 0x89, 0xf8, 0xe8, 0x26, 0xfb, 0xff, 0xff, 0x31, 0xc0,
-  0x89, 0x45, 0xcc, 0x0f, 0xb6, 0x05, 0x48, 0x0e, 0x00, 0x00, 0x3b, 0x45,
-  0xcc, 0x0f, 0x8e, 0x57, 0x01, 0x00, 0x00, 0x0f, 0xb6, 0x05, 0x47, 0x0e,
-  0x00, 0x00, 0x0f, 0xaf, 0x45, 0xcc, 0x8b, 0x15, 0x3c, 0x0e, 0x00, 0x00,
-  0x01, 0xc0, 0x01, 0xc2, 0x31, 0xf6, 0x89, 0x55, 0xdc, 0x89, 0x55, 0xe4,
-  0x8b, 0x45, 0xcc, 0xbb, 0x10, 0x00, 0x00, 0x00, 0x31, 0xc9, 0x99, 0xe8,
-  0x78, 0x04, 0x00, 0x00, 0x8b, 0x5d, 0xd0, 0x01, 0xc3, 0x89, 0x5d, 0xe0,
-  0x8b, 0x45, 0xd4, 0x11, 0xd0, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x89, 0x45,
-  0xd8, 0x89, 0xf0, 0x31, 0xc9, 0x99, 0xe8, 0x59, 0x04, 0x00, 0x00, 0xbb,
-  0x3c, 0x00, 0x00, 0x00, 0x8b, 0x55, 0xd8, 0x31, 0xc9, 0x29, 0xc3, 0x8b,
-  0x45, 0xe0, 0xe8, 0x85, 0x88, 0x00, 0x00, 0x89, 0xc2, 0xa1, 0x30, 0x0a,
-  0x00, 0x00, 0x46, 0x83, 0xe2, 0x0f, 0x66, 0x0f, 0xb6, 0x04, 0x02, 0x8b,
-  0x55, 0xe4, 0x80, 0xcc, 0x0e, 0x83, 0x45, 0xe4, 0x02, 0x66, 0x89, 0x02,
-  0x83, 0xfe, 0x10, 0x7c, 0x9b, 0x8d, 0x04, 0x36, 0x03, 0x45, 0xdc, 0x46,
-  0x66, 0xc7, 0x00, 0x20, 0x0e, 0x31, 0xc0, 0xeb, 0x07, 0x40, 0x83, 0xf8,
-  0x10, 0x7d, 0x65, 0x90, 0x8a, 0x1f, 0x0f, 0xb6, 0xd3, 0xc1, 0xfa, 0x04,
-  0x89, 0x55, 0xe0, 0x8b, 0x15, 0x30, 0x0a, 0x00, 0x00, 0x03, 0x55, 0xe0,
-  0x66, 0x0f, 0xb6, 0x12, 0x80, 0xce, 0x07, 0x89, 0x55, 0xe8, 0x8d, 0x14,
-  0x36, 0x03, 0x55, 0xdc, 0x8b, 0x4d, 0xe8, 0x66, 0x89, 0x0a, 0x88, 0xda,
-  0x80, 0xe2, 0x0f, 0x8b, 0x1d, 0x30, 0x0a, 0x00, 0x00, 0x0f, 0xb6, 0xd2,
-  0x46, 0x66, 0x0f, 0xb6, 0x1c, 0x1a, 0x8d, 0x14, 0x36, 0x03, 0x55, 0xdc,
-  0x80, 0xcf, 0x07, 0x66, 0x89, 0x1a, 0x89, 0xc2, 0x47, 0x83, 0xe2, 0x01,
-  0x46, 0x83, 0xfa, 0x01, 0x75, 0xa3, 0x8d, 0x14, 0x36, 0x03, 0x55, 0xdc,
-  0x46, 0x66, 0xc7, 0x02, 0x20, 0x00, 0xeb, 0x95, 0x8d, 0x04, 0x36, 0x03,
-  0x45, 0xdc, 0x83, 0xef, 0x10, 0x46, 0x66, 0xc7, 0x00, 0x20, 0x07, 0x8d,
-  0x14, 0x36, 0x31, 0xc0, 0x8a, 0x1f, 0x30, 0xff, 0x47, 0x80, 0xcf, 0x0d,
-  0x46, 0x89, 0x5d, 0xe8, 0x89, 0xd3, 0x40, 0x03, 0x5d, 0xdc, 0x8b, 0x4d,
-  0xe8, 0x83, 0xc2, 0x02, 0x66, 0x89, 0x0b, 0x83, 0xf8, 0x10, 0x7c, 0xe0,
-  0x8d, 0x04, 0x36, 0x0f, 0xb6, 0x15, 0x47, 0x0e, 0x00, 0x00, 0x39, 0xd6,
-  0x7d, 0x10, 0x89, 0xc2, 0x03, 0x55, 0xdc, 0x46, 0x83, 0xc0, 0x02, 0x66,
-  0xc7, 0x02, 0x20, 0x07, 0xeb, 0xe5, 0xff, 0x45, 0xcc, 0xe9, 0x99, 0xfe,
-  0xff, 0xff, 0x31, 0xf6, 0x31, 0xc0, 0xe8, 0xd5, 0x87, 0x00, 0x00, 0x0f,
-  0xb7, 0xc0, 0x89, 0xc3, 0x81, 0xe3, 0xff, 0x00, 0x00, 0x00, 0x83, 0xfb,
-  0x1b, 0x0f, 0x84, 0xb1, 0x01, 0x00, 0x00, 0x83, 0xfb, 0x67, 0x0f, 0x85,
-  0xe6, 0x00, 0x00, 0x00, 0xe8, 0x0b, 0x51, 0x00, 0x00, 0x31, 0xd2, 0x31,
-  0xc0, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xbd, 0x4e, 0x00, 0x00, 0xb8,
-  0x4b, 0x01, 0x00, 0x00, 0x31, 0xdb, 0xe8, 0x79, 0x50, 0x00, 0x00, 0xe8,
-  0x8c, 0x50, 0x00, 0x00, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x1a, 0x87,
-  0x00, 0x00, 0x89, 0xc2, 0x83, 0xf8, 0x0d, 0x0f, 0x84, 0x8a, 0x00, 0x00,
-  0x00, 0x83, 0xf8, 0x1b, 0x0f, 0x84, 0x81, 0x00, 0x00, 0x00, 0x83, 0xf8,
-  0x30, 0x7c, 0x05, 0x83, 0xf8, 0x39, 0x7e, 0x0a, 0x83, 0xfa, 0x61, 0x7c,
-  0x23, 0x83, 0xfa, 0x66, 0x7f, 0x1e, 0x83, 0xfb, 0x10, 0x7d, 0x12, 0x0f,
-  0xb6, 0xc2, 0x88, 0x54, 0x2b, 0xb0, 0x43, 0xe8, 0x84, 0x4f, 0x00, 0x00,
-  0xe8, 0x43, 0x50, 0x00, 0x00, 0xc6, 0x44, 0x2b, 0xb0, 0x00, 0xeb, 0xb5,
-  0x83, 0xfa, 0x08, 0x75, 0xb0, 0x85, 0xdb, 0x7e, 0xac, 0xc6, 0x44, 0x2b,
-  0xaf, 0x00, 0xa0, 0x44, 0x0e, 0x00, 0x00, 0x00, 0xc8, 0x0f, 0xb6, 0x15,
-  0x45, 0x0e, 0x00, 0x00, 0x0f, 0xb6, 0xc0, 0xe8, 0x38, 0x4e, 0x00, 0x00,
-  0xb8, 0x20, 0x00, 0x00, 0x00, 0xe8, 0x4a, 0x4f, 0x00, 0x00, 0xa0, 0x44,
-  0x0e, 0x00, 0x00, 0x00, 0xc8, 0x0f, 0xb6, 0x15, 0x45, 0x0e, 0x00, 0x00,
-  0x0f, 0xb6, 0xc0, 0x4b, 0xe8, 0x17, 0x4e, 0x00, 0x00, 0xe8, 0xf2, 0x4f,
-  0x00, 0x00, 0xe9, 0x66, 0xff, 0xff, 0xff, 0x83, 0xfa, 0x0d, 0x0f, 0x85,
-  0xd2, 0x00, 0x00, 0x00, 0xbb, 0x10, 0x00, 0x00, 0x00, 0x8d, 0x45, 0xb0,
-  0x31, 0xd2, 0xe8, 0x6d, 0x89, 0x00, 0x00, 0x89, 0x45, 0xd0, 0x89, 0x55,
-  0xd4, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0xd0, 0xf6, 0x82, 0x2d,
-  0x09, 0x00, 0x00, 0x20, 0x74, 0x0e, 0x6b, 0x45, 0xc4, 0x0a, 0x83, 0xeb,
-  0x30, 0x01, 0xd8, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0xa8, 0xff, 0x0f, 0x85,
-  0x96, 0x00, 0x00, 0x00, 0x83, 0x7d, 0xc4, 0x00, 0x75, 0x07, 0xc7, 0x45,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xf8, 0x08, 0x83, 0xf8, 0x48, 0x75,
-  0x1e, 0x8b, 0x45, 0xc4, 0xbb, 0x10, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x31,
-  0xc9, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xf5, 0x01, 0x00, 0x00, 0x29,
-  0x45, 0xd0, 0x19, 0x55, 0xd4, 0xeb, 0x5e, 0x83, 0xf8, 0x50, 0x75, 0x05,
-  0x8b, 0x45, 0xc4, 0xeb, 0x3b, 0x83, 0xf8, 0x49, 0x75, 0x26, 0x0f, 0xb6,
-  0x05, 0x48, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0x45, 0xc4, 0xbb, 0x10, 0x00,
-  0x00, 0x00, 0x31, 0xd2, 0x31, 0xc9, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8,
-  0xc0, 0x01, 0x00, 0x00, 0x29, 0x45, 0xd0, 0x19, 0x55, 0xd4, 0xeb, 0x29,
-  0x83, 0xf8, 0x51, 0x75, 0x24, 0x0f, 0xb6, 0x05, 0x48, 0x0e, 0x00, 0x00,
-  0x0f, 0xaf, 0x45, 0xc4, 0xbb, 0x10, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x31,
-  0xc9, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x95, 0x01, 0x00, 0x00, 0x01,
-  0x45, 0xd0, 0x11, 0x55, 0xd4, 0x31, 0xc0, 0x89, 0x45, 0xc4, 0x83, 0x7d,
-  0xc8, 0x00, 0x0f, 0x84, 0xa5, 0xfc, 0xff, 0xff, 0xe8, 0x5b, 0x03, 0x00,
-  0x00, 0x31, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3,
-  0x53, 0x52, 0x83, 0xec, 0x04, 0x8d, 0x44, 0x24, 0x18, 0x89, 0xe3, 0x8b,
-  0x54, 0x24, 0x14, 0x89, 0x04, 0x24, 0x8b, 0x44, 0x24, 0x10, 0xe8, 0xa5,
-  0x8c, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5a, 0x5b, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3b, 0xc2, 0x0f, 0x84, 0x8a, 0x00, 0x00, 0x00, 0x51, 0xa8, 0x03, 0x0f,
-  0x85, 0xaf, 0x00, 0x00, 0x00, 0xf6, 0xc2, 0x03, 0x0f, 0x85, 0xc2, 0x00,
-  0x00, 0x00, 0x53, 0x90, 0x8b, 0x18, 0x8b, 0x0a, 0x3b, 0xcb, 0x75, 0x71,
-  0xf7, 0xd1, 0x81, 0xc3, 0xff, 0xfe, 0xfe, 0xfe, 0x23, 0xd9, 0x81, 0xe3,
-  0x80, 0x80, 0x80, 0x80, 0x75, 0x5a, 0x8b, 0x58, 0x04, 0x8b, 0x4a, 0x04,
-  0x3b, 0xcb, 0x75, 0x55, 0xf7, 0xd1, 0x81, 0xc3, 0xff, 0xfe, 0xfe, 0xfe,
-  0x23, 0xd9, 0x81, 0xe3, 0x80, 0x80, 0x80, 0x80, 0x75, 0x3e, 0x8b, 0x58,
-  0x08, 0x8b, 0x4a, 0x08, 0x3b, 0xcb, 0x75, 0x39, 0xf7, 0xd1, 0x81, 0xc3,
-  0xff, 0xfe, 0xfe, 0xfe, 0x23, 0xd9, 0x81, 0xe3, 0x80, 0x80, 0x80, 0x80,
-  0x75, 0x22, 0x8b, 0x58, 0x0c, 0x8b, 0x4a, 0x0c, 0x3b, 0xcb, 0x75, 0x1d,
-  0x83, 0xc0, 0x10, 0x83, 0xc2, 0x10, 0xf7, 0xd1, 0x81, 0xc3, 0xff, 0xfe,
-  0xfe, 0xfe, 0x23, 0xd9, 0x81, 0xe3, 0x80, 0x80, 0x80, 0x80, 0x74, 0x8c,
-  0x5b, 0x59, 0x2b, 0xc0, 0xc3, 0x3a, 0xd9, 0x75, 0x1f, 0x80, 0xfb, 0x00,
-  0x74, 0xf2, 0x3a, 0xfd, 0x75, 0x16, 0x80, 0xff, 0x00, 0x74, 0xe9, 0xc1,
-  0xeb, 0x10, 0xc1, 0xe9, 0x10, 0x3a, 0xd9, 0x75, 0x07, 0x80, 0xfb, 0x00,
-  0x74, 0xda, 0x3a, 0xfd, 0x19, 0xc0, 0x0c, 0x01, 0x5b, 0x59, 0xc3, 0x90,
-  0x8a, 0x08, 0x40, 0x8a, 0x2a, 0x42, 0x3a, 0xcd, 0x75, 0x6e, 0x0a, 0xc9,
-  0x74, 0x66, 0xa8, 0x03, 0x75, 0xee, 0xf6, 0xc2, 0x03, 0x0f, 0x84, 0x3f,
-  0xff, 0xff, 0xff, 0x90, 0x8b, 0x08, 0x3a, 0x0a, 0x75, 0x56, 0x0a, 0xc9,
-  0x74, 0x4e, 0x3a, 0x6a, 0x01, 0x75, 0x4d, 0x0a, 0xed, 0x74, 0x45, 0xc1,
-  0xe9, 0x10, 0x3a, 0x4a, 0x02, 0x75, 0x41, 0x0a, 0xc9, 0x74, 0x39, 0x3a,
-  0x6a, 0x03, 0x75, 0x38, 0x0a, 0xed, 0x74, 0x30, 0x8b, 0x48, 0x04, 0x3a,
-  0x4a, 0x04, 0x75, 0x2c, 0x0a, 0xc9, 0x74, 0x24, 0x3a, 0x6a, 0x05, 0x75,
-  0x23, 0x0a, 0xed, 0x74, 0x1b, 0xc1, 0xe9, 0x10, 0x3a, 0x4a, 0x06, 0x75,
-  0x17, 0x0a, 0xc9, 0x74, 0x0f, 0x3a, 0x6a, 0x07, 0x75, 0x0e, 0x83, 0xc0,
-  0x08, 0x83, 0xc2, 0x08, 0x0a, 0xed, 0x75, 0xa8, 0x33, 0xc0, 0x59, 0xc3,
-  0x19, 0xc0, 0x0c, 0x01, 0x59, 0xc3, 0x00, 0x00, 0x85, 0xd2, 0x75, 0x07,
-  0x85, 0xc9, 0x75, 0x03, 0xf7, 0xe3, 0xc3, 0x50, 0x52, 0xf7, 0xe1, 0x8b,
-  0xc8, 0x58, 0xf7, 0xe3, 0x03, 0xc8, 0x58, 0xf7, 0xe3, 0x03, 0xd1, 0xc3,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x80, 0x3d, 0x50, 0x0c, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0x7c, 0x01, 0x00, 0x00, 0xc6, 0x05, 0x50, 0x0c,
-  0x00, 0x00, 0x01, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x00, 0x7d, 0x05,
-  0xe8, 0xbb, 0x31, 0x00, 0x00, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x04,
-  0x7d, 0x10, 0xc7, 0x05, 0x68, 0x0c, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00,
-  0x31, 0xc0, 0x5a, 0x59, 0x5b, 0xc3, 0xa0, 0xd8, 0x0d, 0x00, 0x00, 0xa8,
-  0x01, 0x75, 0x10, 0xc7, 0x05, 0x68, 0x0c, 0x00, 0x00, 0x7b, 0x01, 0x00,
-  0x00, 0x31, 0xc0, 0x5a, 0x59, 0x5b, 0xc3, 0xa8, 0x04, 0x74, 0x09, 0x83,
-  0x3d, 0xa0, 0x0d, 0x00, 0x00, 0x00, 0x75, 0x05, 0xe8, 0x4f, 0x2e, 0x00,
-  0x00, 0xe8, 0xca, 0x15, 0x00, 0x00, 0xe8, 0xd9, 0x16, 0x00, 0x00, 0xe8,
-  0xdc, 0x13, 0x00, 0x00, 0xe8, 0x6b, 0x23, 0x00, 0x00, 0xe8, 0xee, 0x1d,
-  0x00, 0x00, 0x85, 0xc0, 0x75, 0x0e, 0xc7, 0x05, 0x68, 0x0c, 0x00, 0x00,
-  0x8a, 0x01, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0x80, 0x3d, 0xac, 0x0c,
-  0x00, 0x00, 0x00, 0x74, 0x10, 0xc7, 0x05, 0x68, 0x0c, 0x00, 0x00, 0xdf,
-  0x01, 0x00, 0x00, 0x31, 0xc0, 0x5a, 0x59, 0x5b, 0xc3, 0xc7, 0x05, 0x60,
-  0x0c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xa0, 0x0d, 0x00, 0x00,
-  0xc7, 0x05, 0x64, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x85, 0xc0,
-  0x74, 0x1a, 0xf6, 0x40, 0x47, 0x20, 0x74, 0x14, 0xc7, 0x05, 0x60, 0x0c,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x05, 0x64, 0x0c, 0x00, 0x00,
-  0xff, 0x00, 0x00, 0x00, 0xa1, 0x60, 0x0c, 0x00, 0x00, 0x8b, 0x15, 0x64,
-  0x0c, 0x00, 0x00, 0xa3, 0x58, 0x0c, 0x00, 0x00, 0xa1, 0xa0, 0x0d, 0x00,
-  0x00, 0x89, 0x15, 0x5c, 0x0c, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x34, 0x81,
-  0x78, 0x34, 0x08, 0x00, 0x00, 0x80, 0x72, 0x2b, 0x8a, 0x40, 0x6c, 0x3c,
-  0x20, 0x73, 0x02, 0xb0, 0x20, 0x0f, 0xb6, 0xd8, 0x31, 0xd2, 0x31, 0xc9,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x2f, 0x83, 0x00, 0x00, 0x83, 0xe8,
-  0x01, 0x83, 0xda, 0x00, 0xa3, 0x58, 0x0c, 0x00, 0x00, 0x89, 0x15, 0x5c,
-  0x0c, 0x00, 0x00, 0xf6, 0x05, 0xc9, 0x0d, 0x00, 0x00, 0x08, 0x74, 0x10,
-  0xf6, 0x05, 0xcb, 0x0d, 0x00, 0x00, 0x02, 0x74, 0x07, 0xc6, 0x05, 0x51,
-  0x0c, 0x00, 0x00, 0x01, 0xf6, 0x05, 0xc9, 0x0d, 0x00, 0x00, 0x40, 0x74,
-  0x07, 0xc6, 0x05, 0x52, 0x0c, 0x00, 0x00, 0x01, 0x80, 0x3d, 0x51, 0x0c,
-  0x00, 0x00, 0x00, 0x75, 0x09, 0x80, 0x3d, 0x52, 0x0c, 0x00, 0x00, 0x00,
-  0x74, 0x09, 0xc6, 0x05, 0x53, 0x0c, 0x00, 0x00, 0x01, 0xeb, 0x11, 0xc7,
-  0x05, 0x68, 0x0c, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xc6, 0x05, 0x53,
-  0x0c, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x05, 0x53, 0x0c, 0x00, 0x00, 0x5a,
-  0x59, 0x5b, 0xc3, 0x90, 0xf6, 0x05, 0x2c, 0x14, 0x00, 0x00, 0x01, 0x0f,
-  0x85, 0xb3, 0x1e, 0x00, 0x00, 0x31, 0xd2, 0xc3, 0xf6, 0x05, 0x2c, 0x14,
-  0x00, 0x00, 0x01, 0x74, 0x06, 0xb8, 0x00, 0x10, 0x00, 0x00, 0xc3, 0xb8,
-  0x00, 0x00, 0x10, 0x00, 0xc3, 0x8d, 0x40, 0x00, 0x83, 0x3d, 0x6c, 0x0c,
-  0x00, 0x00, 0x00, 0x74, 0x1b, 0xa1, 0x70, 0x0c, 0x00, 0x00, 0xe8, 0xfd,
-  0x89, 0x00, 0x00, 0x31, 0xc0, 0xa3, 0x74, 0x0c, 0x00, 0x00, 0xa3, 0x70,
-  0x0c, 0x00, 0x00, 0xa3, 0x6c, 0x0c, 0x00, 0x00, 0xc3, 0x8d, 0x40, 0x00,
-  0x51, 0x89, 0xc1, 0x85, 0xc0, 0x0f, 0x84, 0x6c, 0x00, 0x00, 0x00, 0x83,
-  0x3d, 0x6c, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x17, 0x3b, 0x05, 0x74, 0x0c,
-  0x00, 0x00, 0x77, 0x0f, 0x3a, 0x15, 0x78, 0x0c, 0x00, 0x00, 0x75, 0x07,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0x59, 0xc3, 0x81, 0xc1, 0xff, 0x0f, 0x00,
-  0x00, 0x30, 0xc9, 0x80, 0xe5, 0xf0, 0xe8, 0x9d, 0xff, 0xff, 0xff, 0x89,
-  0x0d, 0x74, 0x0c, 0x00, 0x00, 0x8d, 0x81, 0x00, 0x10, 0x00, 0x00, 0xe8,
-  0x9c, 0x8a, 0x00, 0x00, 0xa3, 0x70, 0x0c, 0x00, 0x00, 0x85, 0xc0, 0x74,
-  0x15, 0x05, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xc0, 0x80, 0xe4, 0xf0, 0x88,
-  0x15, 0x78, 0x0c, 0x00, 0x00, 0xa3, 0x6c, 0x0c, 0x00, 0x00, 0x83, 0x3d,
-  0x6c, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x59,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x38,
-  0x89, 0x45, 0xdc, 0x89, 0x55, 0xe0, 0x89, 0x5d, 0xd8, 0x89, 0x4d, 0xe4,
-  0x80, 0x3d, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xab, 0x06, 0x00,
-  0x00, 0x83, 0x7d, 0x08, 0x00, 0x0f, 0x84, 0xa1, 0x06, 0x00, 0x00, 0x83,
-  0xfa, 0xff, 0x75, 0x09, 0x83, 0xf8, 0xff, 0x0f, 0x84, 0x93, 0x06, 0x00,
-  0x00, 0x83, 0xf9, 0xff, 0x75, 0x09, 0x83, 0xfb, 0xff, 0x0f, 0x84, 0x85,
-  0x06, 0x00, 0x00, 0x3b, 0x15, 0x5c, 0x0c, 0x00, 0x00, 0x0f, 0x87, 0x79,
-  0x06, 0x00, 0x00, 0x75, 0x0c, 0x3b, 0x05, 0x58, 0x0c, 0x00, 0x00, 0x0f,
-  0x87, 0x6b, 0x06, 0x00, 0x00, 0x89, 0xc1, 0x31, 0xd2, 0x03, 0x4d, 0x08,
-  0x8b, 0x45, 0xe0, 0x11, 0xd0, 0x3b, 0x05, 0x5c, 0x0c, 0x00, 0x00, 0x0f,
-  0x87, 0x53, 0x06, 0x00, 0x00, 0x75, 0x0c, 0x3b, 0x0d, 0x58, 0x0c, 0x00,
-  0x00, 0x0f, 0x87, 0x45, 0x06, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x3b, 0x05,
-  0x5c, 0x0c, 0x00, 0x00, 0x0f, 0x87, 0x36, 0x06, 0x00, 0x00, 0x75, 0x0e,
-  0x89, 0xd8, 0x3b, 0x05, 0x58, 0x0c, 0x00, 0x00, 0x0f, 0x87, 0x26, 0x06,
-  0x00, 0x00, 0x89, 0xd8, 0x03, 0x45, 0x08, 0x13, 0x55, 0xe4, 0x3b, 0x15,
-  0x5c, 0x0c, 0x00, 0x00, 0x0f, 0x87, 0x12, 0x06, 0x00, 0x00, 0x75, 0x0c,
-  0x3b, 0x05, 0x58, 0x0c, 0x00, 0x00, 0x0f, 0x87, 0x04, 0x06, 0x00, 0x00,
-  0xf6, 0x05, 0x2c, 0x14, 0x00, 0x00, 0x01, 0x74, 0x34, 0x31, 0xc0, 0x89,
-  0x45, 0xf0, 0x66, 0x8c, 0xc8, 0x66, 0x89, 0x85, 0xf0, 0xff, 0xff, 0xff,
-  0x8b, 0x45, 0xf0, 0xa8, 0x03, 0x74, 0x0f, 0xc7, 0x05, 0x68, 0x0c, 0x00,
-  0x00, 0x37, 0x02, 0x00, 0x00, 0xe9, 0xd6, 0x05, 0x00, 0x00, 0xc7, 0x05,
-  0x68, 0x0c, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0xe9, 0xc7, 0x05, 0x00,
-  0x00, 0x31, 0xc0, 0x89, 0x45, 0xf4, 0x66, 0x8c, 0xc8, 0x66, 0x89, 0x85,
-  0xf4, 0xff, 0xff, 0xff, 0x8b, 0x45, 0xf4, 0xa8, 0x03, 0x74, 0x15, 0xc7,
-  0x05, 0x68, 0x0c, 0x00, 0x00, 0xbb, 0x02, 0x00, 0x00, 0x31, 0xc0, 0x8d,
-  0x65, 0xf8, 0x5f, 0x5e, 0x5d, 0xc2, 0x04, 0x00, 0x8b, 0x45, 0xe4, 0x8b,
-  0x55, 0xd8, 0x0b, 0x45, 0xe0, 0x0b, 0x55, 0xdc, 0x83, 0xf8, 0x01, 0x73,
-  0x45, 0x8b, 0x45, 0xe4, 0x3b, 0x45, 0xe0, 0x77, 0x0a, 0x75, 0x0d, 0x8b,
-  0x45, 0xd8, 0x3b, 0x45, 0xdc, 0x76, 0x05, 0x8b, 0x45, 0xd8, 0xeb, 0x03,
-  0x8b, 0x45, 0xdc, 0x31, 0xd2, 0x29, 0xc2, 0x3b, 0x55, 0x08, 0x76, 0x03,
-  0x8b, 0x55, 0x08, 0x8b, 0x75, 0xd8, 0x8b, 0x7d, 0xdc, 0x89, 0xd1, 0x57,
-  0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03,
-  0xf3, 0xa4, 0x5f, 0x89, 0xd0, 0xe9, 0x48, 0x05, 0x00, 0x00, 0x3d, 0x00,
-  0x00, 0x10, 0x00, 0x0f, 0x83, 0xb4, 0x02, 0x00, 0x00, 0x80, 0x3d, 0x52,
-  0x0c, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xa7, 0x02, 0x00, 0x00, 0x31, 0xc0,
-  0x89, 0x45, 0xc4, 0x8b, 0x45, 0xe4, 0x3b, 0x45, 0xe0, 0x77, 0x0a, 0x75,
-  0x10, 0x8b, 0x45, 0xd8, 0x3b, 0x45, 0xdc, 0x76, 0x08, 0x8b, 0x45, 0xd8,
-  0x8b, 0x55, 0xe4, 0xeb, 0x06, 0x8b, 0x45, 0xdc, 0x8b, 0x55, 0xe0, 0x31,
-  0xc9, 0x29, 0xc1, 0xb8, 0x00, 0x00, 0x10, 0x00, 0x19, 0xd0, 0x75, 0x2a,
-  0x81, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x73, 0x22, 0x8b, 0x45, 0xe4, 0x3b,
-  0x45, 0xe0, 0x77, 0x0a, 0x75, 0x0d, 0x8b, 0x45, 0xd8, 0x3b, 0x45, 0xdc,
-  0x76, 0x05, 0x8b, 0x45, 0xd8, 0xeb, 0x03, 0x8b, 0x45, 0xdc, 0x31, 0xd2,
-  0x29, 0xc2, 0x89, 0xd0, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x89,
-  0x45, 0xcc, 0x3b, 0x45, 0x08, 0x76, 0x06, 0x8b, 0x45, 0x08, 0x89, 0x45,
-  0xcc, 0x81, 0x7d, 0xcc, 0x00, 0x00, 0x20, 0x00, 0x76, 0x07, 0xc7, 0x45,
-  0xcc, 0x00, 0x00, 0x20, 0x00, 0x83, 0x3d, 0x6c, 0x0c, 0x00, 0x00, 0x00,
-  0x74, 0x0d, 0x80, 0x3d, 0x78, 0x0c, 0x00, 0x00, 0x03, 0x0f, 0x84, 0xe9,
-  0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x50, 0x00,
-  0x00, 0xe8, 0x42, 0xfd, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x13, 0xc7, 0x05,
-  0x68, 0x0c, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5f,
-  0x5e, 0x5d, 0xc2, 0x04, 0x00, 0xa1, 0x6c, 0x0c, 0x00, 0x00, 0x89, 0x45,
-  0xc8, 0x8d, 0x48, 0x20, 0x31, 0xd2, 0x89, 0x4d, 0xd4, 0x8b, 0x0d, 0x6c,
-  0x0c, 0x00, 0x00, 0x31, 0xdb, 0x81, 0xc1, 0x00, 0x10, 0x00, 0x00, 0x11,
-  0xdb, 0x31, 0xf6, 0x01, 0xd1, 0x11, 0xf3, 0x83, 0xc0, 0x08, 0x81, 0xc2,
-  0x00, 0x10, 0x00, 0x00, 0x89, 0x58, 0xfc, 0x80, 0xc9, 0x01, 0x89, 0x48,
-  0xf8, 0x3b, 0x45, 0xd4, 0x75, 0xd3, 0x8b, 0x45, 0xc8, 0x8b, 0x55, 0xc8,
-  0x83, 0xc0, 0x20, 0x81, 0xc2, 0x00, 0x10, 0x00, 0x00, 0x8d, 0x40, 0x00,
-  0x39, 0xd0, 0x74, 0x12, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x40,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x83, 0xc0, 0x08, 0xeb, 0xea, 0x31, 0xd0,
-  0x89, 0x45, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xec, 0xeb, 0x14, 0x81, 0x45,
-  0xec, 0x00, 0x10, 0x00, 0x00, 0x80, 0x45, 0xeb, 0x40, 0x81, 0x7d, 0xec,
-  0x00, 0x40, 0x00, 0x00, 0x74, 0x3e, 0x8b, 0x1d, 0x6c, 0x0c, 0x00, 0x00,
-  0x81, 0xc3, 0x00, 0x10, 0x00, 0x00, 0x8b, 0x75, 0xe8, 0x03, 0x5d, 0xec,
-  0x31, 0xd2, 0x89, 0xd8, 0x81, 0xc3, 0x00, 0x10, 0x00, 0x00, 0x8b, 0xc0,
-  0x89, 0xf1, 0x83, 0xc0, 0x08, 0x09, 0xd1, 0xc7, 0x40, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0xc9, 0x87, 0x81, 0xc2, 0x00, 0x00, 0x20, 0x00, 0x89,
-  0x48, 0xf8, 0x39, 0xd8, 0x74, 0xb0, 0xeb, 0xe0, 0x8b, 0x55, 0xd8, 0x8b,
-  0x4d, 0xe4, 0xa1, 0x6c, 0x0c, 0x00, 0x00, 0x81, 0xe2, 0x00, 0x00, 0xe0,
-  0xff, 0x89, 0xd3, 0x81, 0xe1, 0xff, 0xff, 0x0f, 0x00, 0x80, 0xcb, 0x80,
-  0x80, 0xca, 0x87, 0x89, 0x90, 0xe0, 0x4f, 0x00, 0x00, 0x8b, 0x55, 0xd8,
-  0x89, 0x88, 0xe4, 0x4f, 0x00, 0x00, 0x81, 0xc2, 0x00, 0x00, 0x20, 0x00,
-  0x8b, 0x4d, 0xe4, 0x83, 0xd1, 0x00, 0x81, 0xe1, 0xff, 0xff, 0x0f, 0x00,
-  0x81, 0xe2, 0x00, 0x00, 0xe0, 0xff, 0x89, 0xd3, 0x89, 0x88, 0xec, 0x4f,
-  0x00, 0x00, 0x8b, 0x4d, 0xe0, 0x80, 0xcb, 0x80, 0x80, 0xca, 0x87, 0x89,
-  0x90, 0xe8, 0x4f, 0x00, 0x00, 0x8b, 0x55, 0xdc, 0x81, 0xe2, 0x00, 0x00,
-  0xe0, 0xff, 0x89, 0xd3, 0x81, 0xe1, 0xff, 0xff, 0x0f, 0x00, 0x80, 0xcb,
-  0x80, 0x80, 0xca, 0x87, 0x89, 0x90, 0xf0, 0x4f, 0x00, 0x00, 0x8b, 0x55,
-  0xdc, 0x89, 0x88, 0xf4, 0x4f, 0x00, 0x00, 0x81, 0xc2, 0x00, 0x00, 0x20,
-  0x00, 0x8b, 0x4d, 0xe0, 0x83, 0xd1, 0x00, 0x81, 0xe1, 0xff, 0xff, 0x0f,
-  0x00, 0x81, 0xe2, 0x00, 0x00, 0xe0, 0xff, 0x89, 0xd3, 0x89, 0x88, 0xfc,
-  0x4f, 0x00, 0x00, 0x80, 0xcb, 0x80, 0x80, 0xca, 0x87, 0x89, 0x90, 0xf8,
-  0x4f, 0x00, 0x00, 0xfa, 0x0f, 0x20, 0xe0, 0x89, 0x85, 0xc4, 0xff, 0xff,
-  0xff, 0x83, 0xc8, 0x30, 0x0f, 0x22, 0xe0, 0xa1, 0x6c, 0x0c, 0x00, 0x00,
-  0x0f, 0x22, 0xd8, 0x0f, 0x20, 0xc0, 0x0d, 0x01, 0x00, 0x00, 0x80, 0x0f,
-  0x22, 0xc0, 0x8b, 0x75, 0xd8, 0x8b, 0x7d, 0xdc, 0x8b, 0x4d, 0xcc, 0x81,
-  0xe6, 0xff, 0xff, 0x1f, 0x00, 0x81, 0xe7, 0xff, 0xff, 0x1f, 0x00, 0x81,
-  0xee, 0x00, 0x00, 0x80, 0x00, 0x81, 0xef, 0x00, 0x00, 0x40, 0x00, 0x57,
-  0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03,
-  0xf3, 0xa4, 0x5f, 0x0f, 0x20, 0xc0, 0x25, 0xff, 0xff, 0xff, 0x7f, 0x0f,
-  0x22, 0xc0, 0x8b, 0x85, 0xc4, 0xff, 0xff, 0xff, 0x0f, 0x22, 0xe0, 0x33,
-  0xc0, 0x0f, 0x22, 0xd8, 0xfb, 0x8b, 0x45, 0xcc, 0x8d, 0x65, 0xf8, 0x5f,
-  0x5e, 0x5d, 0xc2, 0x04, 0x00, 0x8b, 0x45, 0xe4, 0x8b, 0x55, 0xd8, 0x0b,
-  0x45, 0xe0, 0x0b, 0x55, 0xdc, 0x3b, 0x05, 0x64, 0x0c, 0x00, 0x00, 0x72,
-  0x12, 0x0f, 0x85, 0x63, 0x02, 0x00, 0x00, 0x3b, 0x15, 0x60, 0x0c, 0x00,
-  0x00, 0x0f, 0x87, 0x57, 0x02, 0x00, 0x00, 0x80, 0x3d, 0x51, 0x0c, 0x00,
-  0x00, 0x00, 0x0f, 0x84, 0x4a, 0x02, 0x00, 0x00, 0x31, 0xc0, 0x89, 0x45,
-  0xc0, 0x8b, 0x45, 0xe4, 0x3b, 0x45, 0xe0, 0x77, 0x0a, 0x75, 0x10, 0x8b,
-  0x45, 0xd8, 0x3b, 0x45, 0xdc, 0x76, 0x08, 0x8b, 0x55, 0xd8, 0x8b, 0x45,
-  0xe4, 0xeb, 0x06, 0x8b, 0x55, 0xdc, 0x8b, 0x45, 0xe0, 0x8b, 0x1d, 0x60,
-  0x0c, 0x00, 0x00, 0x83, 0xc3, 0x01, 0x8b, 0x0d, 0x64, 0x0c, 0x00, 0x00,
-  0x83, 0xd1, 0x00, 0x29, 0xd3, 0x19, 0xc1, 0x75, 0x31, 0x81, 0xfb, 0x00,
-  0x00, 0x00, 0x01, 0x73, 0x29, 0x8b, 0x45, 0xe4, 0x3b, 0x45, 0xe0, 0x77,
-  0x0a, 0x75, 0x0d, 0x8b, 0x45, 0xd8, 0x3b, 0x45, 0xdc, 0x76, 0x05, 0x8b,
-  0x45, 0xd8, 0xeb, 0x03, 0x8b, 0x45, 0xdc, 0x8b, 0x15, 0x60, 0x0c, 0x00,
-  0x00, 0x83, 0xc2, 0x01, 0x29, 0xc2, 0x89, 0xd0, 0xeb, 0x05, 0xb8, 0x00,
-  0x00, 0x00, 0x01, 0x89, 0x45, 0xd0, 0x3b, 0x45, 0x08, 0x76, 0x06, 0x8b,
-  0x45, 0x08, 0x89, 0x45, 0xd0, 0x81, 0x7d, 0xd0, 0x00, 0x00, 0x40, 0x00,
-  0x76, 0x07, 0xc7, 0x45, 0xd0, 0x00, 0x00, 0x40, 0x00, 0x83, 0x3d, 0x6c,
-  0x0c, 0x00, 0x00, 0x00, 0x74, 0x09, 0x80, 0x3d, 0x78, 0x0c, 0x00, 0x00,
-  0x02, 0x74, 0x50, 0xba, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x10, 0x00,
-  0x00, 0xe8, 0x5a, 0xfa, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x13, 0xc7, 0x05,
-  0x68, 0x0c, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5f,
-  0x5e, 0x5d, 0xc2, 0x04, 0x00, 0x8b, 0x3d, 0x6c, 0x0c, 0x00, 0x00, 0x31,
-  0xd2, 0x89, 0xf8, 0x8d, 0xb7, 0x00, 0x10, 0x00, 0x00, 0x8d, 0x40, 0x00,
-  0x89, 0xd1, 0x83, 0xc0, 0x04, 0x80, 0xc9, 0x87, 0x81, 0xc2, 0x00, 0x00,
-  0x40, 0x00, 0x89, 0x48, 0xfc, 0x39, 0xf0, 0x74, 0x08, 0xeb, 0xe9, 0x8b,
-  0x3d, 0x6c, 0x0c, 0x00, 0x00, 0x8b, 0x75, 0xd8, 0x8b, 0x55, 0xe4, 0xbb,
-  0x20, 0x00, 0x00, 0x00, 0x81, 0xe6, 0x00, 0x00, 0xc0, 0xff, 0x89, 0xf0,
-  0x31, 0xc9, 0x0c, 0x80, 0x8b, 0x45, 0xd8, 0xe8, 0x2c, 0x7c, 0x00, 0x00,
-  0x83, 0xe0, 0x0f, 0xc1, 0xe0, 0x0d, 0x66, 0x81, 0xce, 0x87, 0x00, 0x09,
-  0xf0, 0x89, 0x87, 0xf0, 0x0f, 0x00, 0x00, 0x8b, 0x45, 0xd8, 0x05, 0x00,
-  0x00, 0x40, 0x00, 0x89, 0xc1, 0x8b, 0x55, 0xe4, 0x83, 0xd2, 0x00, 0x81,
-  0xe1, 0x00, 0x00, 0xc0, 0xff, 0x89, 0xcb, 0x80, 0xcb, 0x80, 0xbb, 0x20,
-  0x00, 0x00, 0x00, 0x80, 0xc9, 0x87, 0x89, 0xce, 0x31, 0xc9, 0xe8, 0xed,
-  0x7b, 0x00, 0x00, 0x83, 0xe0, 0x0f, 0xc1, 0xe0, 0x0d, 0xbb, 0x20, 0x00,
-  0x00, 0x00, 0x09, 0xc6, 0x8b, 0x45, 0xdc, 0x31, 0xc9, 0x25, 0x00, 0x00,
-  0xc0, 0xff, 0x89, 0xc2, 0x89, 0xb7, 0xf4, 0x0f, 0x00, 0x00, 0x80, 0xca,
-  0x80, 0x8b, 0x55, 0xe0, 0x0c, 0x87, 0x89, 0xc6, 0x8b, 0x45, 0xdc, 0xe8,
-  0xbc, 0x7b, 0x00, 0x00, 0x83, 0xe0, 0x0f, 0xc1, 0xe0, 0x0d, 0x09, 0xf0,
-  0x89, 0x87, 0xf8, 0x0f, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x05, 0x00, 0x00,
-  0x40, 0x00, 0x89, 0xc1, 0x8b, 0x55, 0xe0, 0x83, 0xd2, 0x00, 0x81, 0xe1,
-  0x00, 0x00, 0xc0, 0xff, 0x89, 0xcb, 0x80, 0xcb, 0x80, 0xbb, 0x20, 0x00,
-  0x00, 0x00, 0x80, 0xc9, 0x87, 0x89, 0xce, 0x31, 0xc9, 0xe8, 0x82, 0x7b,
-  0x00, 0x00, 0x83, 0xe0, 0x0f, 0xc1, 0xe0, 0x0d, 0x09, 0xf0, 0x89, 0x87,
-  0xfc, 0x0f, 0x00, 0x00, 0xfa, 0x0f, 0x20, 0xe0, 0x89, 0x85, 0xc0, 0xff,
-  0xff, 0xff, 0x83, 0xc8, 0x10, 0x0f, 0x22, 0xe0, 0xa1, 0x6c, 0x0c, 0x00,
-  0x00, 0x0f, 0x22, 0xd8, 0x0f, 0x20, 0xc0, 0x0d, 0x01, 0x00, 0x00, 0x80,
-  0x0f, 0x22, 0xc0, 0x8b, 0x75, 0xd8, 0x8b, 0x7d, 0xdc, 0x8b, 0x4d, 0xd0,
-  0x81, 0xe6, 0xff, 0xff, 0x3f, 0x00, 0x81, 0xe7, 0xff, 0xff, 0x3f, 0x00,
-  0x81, 0xee, 0x00, 0x00, 0x00, 0x01, 0x81, 0xef, 0x00, 0x00, 0x80, 0x00,
-  0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1,
-  0x03, 0xf3, 0xa4, 0x5f, 0x0f, 0x20, 0xc0, 0x25, 0xff, 0xff, 0xff, 0x7f,
-  0x0f, 0x22, 0xc0, 0x8b, 0x85, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0x22, 0xe0,
-  0x33, 0xc0, 0x0f, 0x22, 0xd8, 0xfb, 0x8b, 0x45, 0xd0, 0x8d, 0x65, 0xf8,
-  0x5f, 0x5e, 0x5d, 0xc2, 0x04, 0x00, 0xc7, 0x05, 0x68, 0x0c, 0x00, 0x00,
-  0x86, 0x03, 0x00, 0x00, 0x31, 0xc0, 0x8d, 0x65, 0xf8, 0x5f, 0x5e, 0x5d,
-  0xc2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x57, 0x55, 0x89,
-  0xe5, 0x81, 0xec, 0x04, 0x01, 0x00, 0x00, 0x81, 0xed, 0x82, 0x01, 0x00,
-  0x00, 0xc7, 0x85, 0x7e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83,
-  0x3d, 0x28, 0x14, 0x00, 0x00, 0x00, 0x74, 0x12, 0x31, 0xf6, 0xc7, 0x85,
-  0x7e, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x89, 0x35, 0x28, 0x14,
-  0x00, 0x00, 0x51, 0x53, 0x52, 0x50, 0x68, 0xa8, 0x03, 0x00, 0x00, 0x68,
-  0x00, 0x01, 0x00, 0x00, 0x8d, 0x45, 0x7e, 0x50, 0xe8, 0x33, 0x85, 0x00,
-  0x00, 0x83, 0xc4, 0x1c, 0x80, 0x3d, 0xd8, 0x0f, 0x00, 0x00, 0x00, 0x0f,
-  0x84, 0x5f, 0x01, 0x00, 0x00, 0x8d, 0x7d, 0x7e, 0x06, 0x8c, 0xd8, 0x8e,
-  0xc0, 0x2b, 0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x07,
-  0x83, 0xc1, 0x15, 0x80, 0xe1, 0xfc, 0xe8, 0x65, 0x85, 0x00, 0x00, 0x39,
-  0xc1, 0x0f, 0x83, 0x12, 0x01, 0x00, 0x00, 0x8d, 0x7d, 0x7e, 0x06, 0x8c,
-  0xd8, 0x8e, 0xc0, 0x2b, 0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1,
-  0x49, 0x07, 0x83, 0xc1, 0x15, 0x80, 0xe1, 0xfc, 0x51, 0x8d, 0x7d, 0x7e,
-  0xe8, 0x5f, 0x85, 0x00, 0x00, 0x06, 0x8c, 0xd8, 0x8e, 0xc0, 0x2b, 0xc9,
-  0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x07, 0x8d, 0x41, 0x15,
-  0x24, 0xfc, 0x2b, 0xe0, 0x89, 0xe2, 0xbe, 0xcf, 0x03, 0x00, 0x00, 0x89,
-  0xd7, 0x57, 0x8a, 0x06, 0x88, 0x07, 0x3c, 0x00, 0x74, 0x10, 0x8a, 0x46,
-  0x01, 0x83, 0xc6, 0x02, 0x88, 0x47, 0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00,
-  0x75, 0xe8, 0x5f, 0xbe, 0xe0, 0x03, 0x00, 0x00, 0x06, 0x1e, 0x07, 0x57,
-  0x2b, 0xc9, 0x49, 0xb0, 0x00, 0xf2, 0xae, 0x4f, 0x8a, 0x06, 0x88, 0x07,
-  0x3c, 0x00, 0x74, 0x10, 0x8a, 0x46, 0x01, 0x83, 0xc6, 0x02, 0x88, 0x47,
-  0x01, 0x83, 0xc7, 0x02, 0x3c, 0x00, 0x75, 0xe8, 0x5f, 0x07, 0x8d, 0x75,
-  0x7e, 0x89, 0xd3, 0x06, 0x1e, 0x07, 0x57, 0x2b, 0xc9, 0x49, 0xb0, 0x00,
-  0xf2, 0xae, 0x4f, 0x8a, 0x06, 0x88, 0x07, 0x3c, 0x00, 0x74, 0x10, 0x8a,
-  0x46, 0x01, 0x83, 0xc6, 0x02, 0x88, 0x47, 0x01, 0x83, 0xc7, 0x02, 0x3c,
-  0x00, 0x75, 0xe8, 0x5f, 0x07, 0xe8, 0xa6, 0x84, 0x00, 0x00, 0x83, 0xf8,
-  0x14, 0x76, 0x5d, 0x6a, 0x14, 0xe8, 0xbe, 0x84, 0x00, 0x00, 0xb8, 0x14,
-  0x00, 0x00, 0x00, 0x2b, 0xe0, 0x89, 0xe2, 0x8b, 0x85, 0x7e, 0x01, 0x00,
-  0x00, 0x50, 0x68, 0xe3, 0x03, 0x00, 0x00, 0x52, 0xe8, 0xdf, 0x84, 0x00,
-  0x00, 0x83, 0xc4, 0x0c, 0x80, 0x3d, 0xd8, 0x0f, 0x00, 0x00, 0x00, 0x74,
-  0x15, 0x8c, 0xd8, 0x25, 0xff, 0xff, 0x00, 0x00, 0x50, 0x52, 0xcc, 0xeb,
-  0x06, 0x57, 0x56, 0x49, 0x44, 0x45, 0x4f, 0x83, 0xc4, 0x08, 0x80, 0x3d,
-  0xd8, 0x0f, 0x00, 0x00, 0x00, 0x75, 0x15, 0x8d, 0xa5, 0x82, 0x01, 0x00,
-  0x00, 0x5d, 0x5f, 0x5e, 0xc3, 0x31, 0xd2, 0xe9, 0x22, 0xff, 0xff, 0xff,
-  0x31, 0xd2, 0xeb, 0xaf, 0x31, 0xc0, 0x8c, 0xd8, 0x50, 0x53, 0xcc, 0xeb,
-  0x06, 0x57, 0x56, 0x49, 0x44, 0x45, 0x4f, 0x83, 0xc4, 0x08, 0x8d, 0xa5,
-  0x82, 0x01, 0x00, 0x00, 0x5d, 0x5f, 0x5e, 0xc3, 0x8d, 0x55, 0x7e, 0xb8,
-  0xcf, 0x03, 0x00, 0x00, 0xe8, 0xa7, 0x84, 0x00, 0x00, 0xe8, 0xcc, 0x84,
-  0x00, 0x00, 0x8d, 0xa5, 0x82, 0x01, 0x00, 0x00, 0x5d, 0x5f, 0x5e, 0xc3,
-  0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd2, 0x56, 0x89, 0xc6, 0x89,
-  0xd0, 0x89, 0xda, 0x89, 0xcb, 0x8b, 0x4c, 0x24, 0x08, 0x85, 0xf6, 0x74,
-  0x04, 0x5e, 0xc2, 0x04, 0x00, 0xc7, 0x05, 0x28, 0x14, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0xe8, 0xfc, 0xfd, 0xff, 0xff, 0x5e, 0xc2, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x89, 0xd9, 0x50,
-  0x8a, 0xf2, 0xc1, 0xe2, 0x08, 0x8a, 0xd6, 0xc1, 0xe2, 0x08, 0x8a, 0xd6,
-  0xe8, 0x9b, 0x84, 0x00, 0x00, 0x58, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x52, 0x83, 0xec, 0x04, 0x8d, 0x44, 0x24,
-  0x14, 0x89, 0xe3, 0x8b, 0x54, 0x24, 0x10, 0x89, 0x04, 0x24, 0xb8, 0x52,
-  0x0a, 0x00, 0x00, 0xe8, 0xa4, 0x7f, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5a,
-  0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x08, 0x85, 0x00, 0x00,
-  0xe8, 0x33, 0x86, 0x00, 0x00, 0x31, 0xc0, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x89, 0x45,
-  0xe4, 0x89, 0x55, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xec, 0x66, 0xb8, 0x00,
-  0x06, 0x66, 0x8b, 0x8d, 0xe4, 0xff, 0xff, 0xff, 0x66, 0x8b, 0x9d, 0xe6,
-  0xff, 0xff, 0xff, 0x66, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x8b,
-  0xb5, 0xea, 0xff, 0xff, 0xff, 0xcd, 0x31, 0x0f, 0x82, 0x0a, 0x00, 0x00,
-  0x00, 0xc7, 0x85, 0xec, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8b,
-  0x45, 0xec, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x89, 0x45,
-  0xe4, 0x89, 0x55, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xec, 0x66, 0xb8, 0x01,
-  0x06, 0x66, 0x8b, 0x8d, 0xe4, 0xff, 0xff, 0xff, 0x66, 0x8b, 0x9d, 0xe6,
-  0xff, 0xff, 0xff, 0x66, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x8b,
-  0xb5, 0xea, 0xff, 0xff, 0xff, 0xcd, 0x31, 0x0f, 0x82, 0x0a, 0x00, 0x00,
-  0x00, 0xc7, 0x85, 0xec, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8b,
-  0x45, 0xec, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x89, 0x45,
-  0xe4, 0x89, 0x55, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xec, 0x66, 0xb8, 0x00,
-  0x08, 0x66, 0x8b, 0x8d, 0xe4, 0xff, 0xff, 0xff, 0x66, 0x8b, 0x9d, 0xe6,
-  0xff, 0xff, 0xff, 0x66, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x8b,
-  0xb5, 0xea, 0xff, 0xff, 0xff, 0xcd, 0x31, 0x0f, 0x82, 0x0e, 0x00, 0x00,
-  0x00, 0x66, 0x89, 0x8d, 0xec, 0xff, 0xff, 0xff, 0x66, 0x89, 0x9d, 0xee,
-  0xff, 0xff, 0xff, 0x8b, 0x45, 0xec, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xb8, 0x01, 0x08, 0x66, 0x8b,
-  0x8d, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x8b, 0x9d, 0xea, 0xff, 0xff, 0xff,
-  0xcd, 0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x14, 0x89, 0x45,
-  0xdc, 0x89, 0x55, 0xe0, 0x31, 0xc0, 0x89, 0x45, 0xec, 0x89, 0x45, 0xe8,
-  0x89, 0x45, 0xe4, 0x8b, 0x45, 0xdc, 0x83, 0xc0, 0x0f, 0xc1, 0xe8, 0x04,
-  0x89, 0x45, 0xdc, 0x81, 0x7d, 0xdc, 0x00, 0xff, 0x00, 0x00, 0x72, 0x04,
-  0x31, 0xc0, 0xeb, 0x47, 0x66, 0x8b, 0x9d, 0xdc, 0xff, 0xff, 0xff, 0x66,
-  0xb8, 0x00, 0x01, 0xcd, 0x31, 0x66, 0x89, 0x85, 0xec, 0xff, 0xff, 0xff,
-  0x66, 0x89, 0x95, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x19, 0xc0, 0x66, 0x89,
-  0x85, 0xe4, 0xff, 0xff, 0xff, 0x66, 0x83, 0x7d, 0xe4, 0x00, 0x74, 0x0b,
-  0x31, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x8b,
-  0x45, 0xe8, 0x8b, 0x55, 0xe0, 0x66, 0x89, 0x02, 0x0f, 0xb7, 0x45, 0xec,
-  0xc1, 0xe0, 0x04, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x89,
-  0x45, 0xe8, 0x66, 0xb8, 0x01, 0x01, 0x66, 0x8b, 0x95, 0xe8, 0xff, 0xff,
-  0xff, 0xcd, 0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x10, 0x89, 0x45, 0xe4, 0x89, 0x55, 0xe8, 0x89, 0x5d, 0xec, 0xc7, 0x45,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x3f, 0x8b, 0x9d, 0xe4, 0xff, 0xff,
-  0xff, 0x8b, 0x8d, 0xec, 0xff, 0xff, 0xff, 0x8b, 0x95, 0xe8, 0xff, 0xff,
-  0xff, 0xcd, 0x21, 0x8b, 0xd8, 0x19, 0xdb, 0x0b, 0xc3, 0x89, 0x85, 0xf0,
-  0xff, 0xff, 0xff, 0x8b, 0x45, 0xf0, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x10, 0x89, 0x45, 0xe4, 0x89, 0x55, 0xe8, 0x89, 0x5d, 0xec, 0xc7, 0x45,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x40, 0x8b, 0x9d, 0xe4, 0xff, 0xff,
-  0xff, 0x8b, 0x8d, 0xec, 0xff, 0xff, 0xff, 0x8b, 0x95, 0xe8, 0xff, 0xff,
-  0xff, 0xcd, 0x21, 0x8b, 0xd8, 0x19, 0xdb, 0x0b, 0xc3, 0x89, 0x85, 0xf0,
-  0xff, 0xff, 0xff, 0x8b, 0x45, 0xf0, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x1c, 0xb9, 0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xd0, 0xbe,
-  0x00, 0x16, 0x00, 0x00, 0x8d, 0x5d, 0xd0, 0xf3, 0xa5, 0x8d, 0x55, 0xd0,
-  0x66, 0x89, 0x45, 0xd4, 0xb8, 0x31, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45,
-  0xd0, 0x01, 0x00, 0xe8, 0x6c, 0x81, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x1c, 0xb9, 0x07, 0x00, 0x00, 0x00,
-  0x8d, 0x7d, 0xd0, 0xbe, 0x1c, 0x16, 0x00, 0x00, 0x8d, 0x5d, 0xd0, 0x31,
-  0xc0, 0xf3, 0xa5, 0x8d, 0x55, 0xd0, 0x66, 0x89, 0x45, 0xd0, 0xb8, 0x31,
-  0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xd8, 0x01, 0x00, 0xe8, 0x2a, 0x81,
-  0x00, 0x00, 0xf6, 0x45, 0xe8, 0x01, 0x74, 0x04, 0x31, 0xc0, 0xeb, 0x03,
-  0x8b, 0x45, 0xd0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x1c, 0xb9, 0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xd4, 0xbe, 0x38,
-  0x16, 0x00, 0x00, 0xf3, 0xa5, 0x8d, 0x5d, 0xd4, 0x66, 0x89, 0x45, 0xd8,
-  0x89, 0xd0, 0x66, 0x89, 0x55, 0xe0, 0xc1, 0xe8, 0x10, 0x8d, 0x55, 0xd4,
-  0x66, 0x89, 0x45, 0xdc, 0xb8, 0x31, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45,
-  0xd4, 0x07, 0x00, 0xe8, 0xd0, 0x80, 0x00, 0x00, 0xf6, 0x45, 0xec, 0x01,
-  0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x1c, 0xb9, 0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xd4, 0xbe, 0x54,
-  0x16, 0x00, 0x00, 0xf3, 0xa5, 0x8d, 0x5d, 0xd4, 0x66, 0x89, 0x45, 0xd8,
-  0x89, 0xd0, 0x66, 0x89, 0x55, 0xe0, 0xc1, 0xe8, 0x10, 0x8d, 0x55, 0xd4,
-  0x66, 0x89, 0x45, 0xdc, 0xb8, 0x31, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45,
-  0xd4, 0x08, 0x00, 0xe8, 0x7c, 0x80, 0x00, 0x00, 0xf6, 0x45, 0xec, 0x01,
-  0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x28, 0x89, 0x45, 0xe4, 0x89, 0x55, 0xe8, 0xb9, 0x07, 0x00, 0x00,
-  0x00, 0x8d, 0x7d, 0xc8, 0xbe, 0x70, 0x16, 0x00, 0x00, 0xf3, 0xa5, 0xc6,
-  0x45, 0xec, 0x00, 0x50, 0x0f, 0xb7, 0x85, 0xe4, 0xff, 0xff, 0xff, 0x24,
-  0x03, 0x88, 0x85, 0xec, 0xff, 0xff, 0xff, 0x58, 0x66, 0xc7, 0x45, 0xc8,
-  0x09, 0x00, 0x8b, 0x45, 0xe4, 0x66, 0x89, 0x45, 0xcc, 0x8b, 0x45, 0xe8,
-  0x24, 0x9f, 0x66, 0x0f, 0xb6, 0x55, 0xec, 0xc1, 0xe2, 0x05, 0x8d, 0x5d,
-  0xc8, 0x09, 0xd0, 0x8d, 0x55, 0xc8, 0x66, 0x89, 0x45, 0xd0, 0xb8, 0x31,
-  0x00, 0x00, 0x00, 0xe8, 0x04, 0x80, 0x00, 0x00, 0xf6, 0x45, 0xe0, 0x01,
-  0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0x31, 0xc0, 0x89, 0x45, 0xe8, 0x66,
-  0xb8, 0x01, 0x03, 0x66, 0x33, 0xdb, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe4,
-  0xff, 0xff, 0xff, 0xcd, 0x31, 0x0f, 0x83, 0x18, 0x00, 0x00, 0x00, 0xc7,
-  0x85, 0xe8, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x0f,
-  0x84, 0x06, 0x00, 0x00, 0x00, 0x89, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x8b,
-  0x45, 0xe8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89,
-  0x45, 0xe4, 0x83, 0x3d, 0xec, 0x0c, 0x00, 0x00, 0x00, 0x75, 0x31, 0xba,
-  0xf0, 0x0c, 0x00, 0x00, 0xb8, 0x20, 0x00, 0x00, 0x00, 0xe8, 0x9e, 0xfc,
-  0xff, 0xff, 0xa3, 0xec, 0x0c, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x19, 0x68,
-  0x2b, 0x04, 0x00, 0x00, 0x68, 0x6c, 0x0a, 0x00, 0x00, 0xe8, 0xe2, 0xeb,
-  0xff, 0xff, 0x83, 0xc4, 0x08, 0x31, 0xc0, 0xe9, 0x80, 0x00, 0x00, 0x00,
-  0xa1, 0xec, 0x0c, 0x00, 0x00, 0xc6, 0x00, 0x9a, 0x8b, 0x15, 0xec, 0x0c,
-  0x00, 0x00, 0x8b, 0x45, 0xe4, 0x66, 0x8b, 0x40, 0x2a, 0x66, 0x89, 0x42,
-  0x01, 0x8b, 0x15, 0xec, 0x0c, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x66, 0x8b,
-  0x40, 0x2c, 0x66, 0x89, 0x42, 0x03, 0xa1, 0xec, 0x0c, 0x00, 0x00, 0xc6,
-  0x40, 0x05, 0xcf, 0xfa, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x15, 0xec,
-  0x0c, 0x00, 0x00, 0x8b, 0x00, 0xc1, 0xea, 0x04, 0x89, 0x45, 0xe8, 0xa1,
-  0xec, 0x0c, 0x00, 0x00, 0xc1, 0xe2, 0x10, 0x83, 0xe0, 0x0f, 0x09, 0xc2,
-  0xb8, 0x18, 0x00, 0x00, 0x00, 0x89, 0x10, 0xfb, 0x66, 0xb8, 0x00, 0x03,
-  0x66, 0xbb, 0x06, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe4, 0xff, 0xff,
-  0xff, 0xcd, 0x31, 0xfa, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x55, 0xe8,
-  0x89, 0x10, 0xfb, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0x83, 0x3d,
-  0xec, 0x0c, 0x00, 0x00, 0x00, 0x75, 0x31, 0xba, 0xf0, 0x0c, 0x00, 0x00,
-  0xb8, 0x20, 0x00, 0x00, 0x00, 0xe8, 0xca, 0xfb, 0xff, 0xff, 0xa3, 0xec,
-  0x0c, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x19, 0x68, 0x2b, 0x04, 0x00, 0x00,
-  0x68, 0x6c, 0x0a, 0x00, 0x00, 0xe8, 0x0e, 0xeb, 0xff, 0xff, 0x83, 0xc4,
-  0x08, 0x31, 0xc0, 0xe9, 0xb2, 0x00, 0x00, 0x00, 0xb9, 0x16, 0x00, 0x00,
-  0x00, 0xbe, 0xf2, 0x0c, 0x00, 0x00, 0x8b, 0x3d, 0xec, 0x0c, 0x00, 0x00,
-  0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1,
-  0x03, 0xf3, 0xa4, 0x5f, 0xa1, 0xec, 0x0c, 0x00, 0x00, 0xc6, 0x40, 0x16,
-  0x9a, 0x8b, 0x3d, 0xec, 0x0c, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x66, 0x8b,
-  0x40, 0x2a, 0x66, 0x89, 0x47, 0x17, 0xa1, 0xec, 0x0c, 0x00, 0x00, 0x8b,
-  0x7d, 0xe4, 0x66, 0x8b, 0x7f, 0x2c, 0x66, 0x89, 0x78, 0x19, 0xa1, 0xec,
-  0x0c, 0x00, 0x00, 0xc6, 0x40, 0x1b, 0x89, 0xa1, 0xec, 0x0c, 0x00, 0x00,
-  0xc6, 0x40, 0x1c, 0xec, 0xa1, 0xec, 0x0c, 0x00, 0x00, 0xc6, 0x40, 0x1d,
-  0xcf, 0xfa, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x89, 0x45, 0xe8,
-  0xa1, 0xec, 0x0c, 0x00, 0x00, 0x8b, 0x3d, 0xec, 0x0c, 0x00, 0x00, 0xc1,
-  0xe8, 0x04, 0x83, 0xe7, 0x0f, 0xc1, 0xe0, 0x10, 0x09, 0xc7, 0xb8, 0x18,
-  0x00, 0x00, 0x00, 0x89, 0x38, 0xfb, 0x66, 0xb8, 0x00, 0x03, 0x66, 0xbb,
-  0x06, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe4, 0xff, 0xff, 0xff, 0xcd,
-  0x31, 0xfa, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x7d, 0xe8, 0x89, 0x38,
-  0xfb, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xb8, 0x00, 0x03, 0x66, 0xbb,
-  0x2f, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0xcd,
-  0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x81, 0xec, 0x84, 0x00,
-  0x00, 0x00, 0x80, 0x3d, 0xcc, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xbf,
-  0x01, 0x00, 0x00, 0x80, 0x3d, 0xa8, 0x0c, 0x00, 0x00, 0x01, 0x75, 0x13,
-  0xc6, 0x05, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0xc6, 0x05, 0xcc, 0x0c, 0x00,
-  0x00, 0x01, 0xe9, 0xa3, 0x01, 0x00, 0x00, 0x30, 0xc0, 0x88, 0x45, 0xe4,
-  0x88, 0x45, 0xe8, 0x30, 0xe4, 0x89, 0x45, 0xd8, 0x89, 0x45, 0xdc, 0x89,
-  0x45, 0xe0, 0x31, 0xc0, 0x89, 0x45, 0xd0, 0x06, 0x66, 0xb8, 0x87, 0x16,
-  0xcd, 0x2f, 0x66, 0x0b, 0xc0, 0x0f, 0x85, 0x31, 0x00, 0x00, 0x00, 0xc6,
-  0x85, 0xe4, 0xff, 0xff, 0xff, 0x01, 0x66, 0x89, 0x9d, 0xe0, 0xff, 0xff,
-  0xff, 0x88, 0x8d, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x89, 0x95, 0xd8, 0xff,
-  0xff, 0xff, 0x66, 0x89, 0xb5, 0xdc, 0xff, 0xff, 0xff, 0x66, 0x89, 0xbd,
-  0xd0, 0xff, 0xff, 0xff, 0x66, 0x8c, 0x85, 0xd2, 0xff, 0xff, 0xff, 0x07,
-  0x8b, 0x45, 0xe0, 0x66, 0xa3, 0xc8, 0x0c, 0x00, 0x00, 0x8a, 0x45, 0xe4,
-  0xa2, 0xd4, 0x0c, 0x00, 0x00, 0x8b, 0x45, 0xd8, 0x66, 0xa3, 0xca, 0x0c,
-  0x00, 0x00, 0x8b, 0x45, 0xd0, 0xa3, 0xd0, 0x0c, 0x00, 0x00, 0x8a, 0x45,
-  0xe8, 0x66, 0xc7, 0x05, 0xd8, 0x0c, 0x00, 0x00, 0xff, 0xff, 0xa2, 0xd5,
-  0x0c, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x66, 0xa3, 0xd6, 0x0c, 0x00, 0x00,
-  0x80, 0x3d, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x92, 0x00, 0x00,
-  0x00, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0xbd, 0x68, 0xff, 0xff, 0xff,
-  0xbe, 0x8c, 0x16, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x8d, 0x85, 0x68,
-  0xff, 0xff, 0xff, 0xc7, 0x45, 0x84, 0x87, 0x16, 0x00, 0x00, 0xe8, 0xd5,
-  0xfe, 0xff, 0xff, 0x66, 0xf7, 0x45, 0x84, 0xff, 0xff, 0x75, 0x5d, 0x8b,
-  0x85, 0x78, 0xff, 0xff, 0xff, 0x66, 0xa3, 0xc8, 0x0c, 0x00, 0x00, 0x8b,
-  0x85, 0x7c, 0xff, 0xff, 0xff, 0x66, 0xa3, 0xca, 0x0c, 0x00, 0x00, 0x0f,
-  0xb7, 0x45, 0x8a, 0xc1, 0xe0, 0x10, 0x66, 0x31, 0xc0, 0x89, 0xc2, 0x8b,
-  0x85, 0x68, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0x00, 0x00, 0xc6, 0x05,
-  0xd4, 0x0c, 0x00, 0x00, 0x01, 0x01, 0xc2, 0x8a, 0x45, 0x80, 0x66, 0xc7,
-  0x05, 0xd8, 0x0c, 0x00, 0x00, 0xff, 0xff, 0xa2, 0xd5, 0x0c, 0x00, 0x00,
-  0x8b, 0x85, 0x6c, 0xff, 0xff, 0xff, 0x89, 0x15, 0xd0, 0x0c, 0x00, 0x00,
-  0x66, 0xa3, 0xd6, 0x0c, 0x00, 0x00, 0xeb, 0x07, 0xc6, 0x05, 0xd4, 0x0c,
-  0x00, 0x00, 0x00, 0xc6, 0x05, 0x9c, 0x0c, 0x00, 0x00, 0x00, 0xc6, 0x05,
-  0xcc, 0x0c, 0x00, 0x00, 0x01, 0x80, 0x3d, 0xd4, 0x0c, 0x00, 0x00, 0x00,
-  0x74, 0x58, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0x9c, 0x8d, 0x55,
-  0xd4, 0x31, 0xc0, 0xbe, 0xbe, 0x16, 0x00, 0x00, 0x89, 0x45, 0xd4, 0xb8,
-  0x10, 0x00, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0xe8, 0x1b, 0xf9, 0xff,
-  0xff, 0x89, 0xc2, 0x85, 0xc0, 0x74, 0x2f, 0xc6, 0x00, 0xcb, 0x30, 0xf6,
-  0xc1, 0xe8, 0x04, 0x80, 0xe2, 0x0f, 0x66, 0x89, 0x45, 0xc8, 0x8d, 0x45,
-  0x9c, 0x66, 0x89, 0x55, 0xc6, 0xe8, 0xe6, 0xfb, 0xff, 0xff, 0x85, 0xc0,
-  0x74, 0x07, 0xc6, 0x05, 0x9c, 0x0c, 0x00, 0x00, 0x01, 0x0f, 0xb7, 0x45,
-  0xd4, 0xe8, 0x6a, 0xf9, 0xff, 0xff, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x83, 0xec, 0x1c,
-  0x66, 0x83, 0x3d, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xf5, 0x00,
-  0x00, 0x00, 0x8d, 0x5d, 0xdc, 0x8d, 0x55, 0xdc, 0xb8, 0x21, 0x00, 0x00,
-  0x00, 0x66, 0xc7, 0x45, 0xdc, 0x00, 0x30, 0xe8, 0x8c, 0x7b, 0x00, 0x00,
-  0x66, 0x0f, 0xb6, 0x5d, 0xdc, 0x66, 0x0f, 0xb6, 0x55, 0xdd, 0xc1, 0xe3,
-  0x08, 0x09, 0xd3, 0xc7, 0x05, 0x94, 0x0c, 0x00, 0x00, 0x55, 0x04, 0x00,
-  0x00, 0x66, 0x89, 0x1d, 0x8e, 0x0c, 0x00, 0x00, 0x66, 0x81, 0xfb, 0x00,
-  0x05, 0x72, 0x54, 0x80, 0x7d, 0xe1, 0xfd, 0x75, 0x4e, 0x0f, 0xb6, 0x55,
-  0xe5, 0x0f, 0xb6, 0x5d, 0xe4, 0xc1, 0xe2, 0x10, 0xc1, 0xe3, 0x08, 0xc6,
-  0x05, 0x8c, 0x0c, 0x00, 0x00, 0x02, 0x09, 0xd3, 0x0f, 0xb6, 0x55, 0xe0,
-  0xb8, 0x21, 0x00, 0x00, 0x00, 0x09, 0xd3, 0x8d, 0x55, 0xdc, 0x89, 0x1d,
-  0x90, 0x0c, 0x00, 0x00, 0x8d, 0x5d, 0xdc, 0x66, 0xc7, 0x45, 0xdc, 0xff,
-  0x33, 0xe8, 0x26, 0x7b, 0x00, 0x00, 0x0f, 0xb7, 0x5d, 0xe8, 0x0f, 0xb7,
-  0x55, 0xdc, 0xc1, 0xe3, 0x04, 0x01, 0xd3, 0x89, 0x1d, 0xa0, 0x0c, 0x00,
-  0x00, 0xeb, 0x18, 0x66, 0x81, 0x3d, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x02,
-  0x72, 0x0d, 0x80, 0x7d, 0xe1, 0xff, 0x75, 0x07, 0xc6, 0x05, 0x8c, 0x0c,
-  0x00, 0x00, 0x01, 0x8d, 0x5d, 0xdc, 0x31, 0xc0, 0x8d, 0x55, 0xdc, 0x66,
-  0x89, 0x45, 0xe0, 0xb8, 0x21, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xdc,
-  0x06, 0x33, 0xe8, 0xdd, 0x7a, 0x00, 0x00, 0xf6, 0x45, 0xf4, 0x01, 0x75,
-  0x2a, 0x8a, 0x45, 0xe0, 0x3c, 0x05, 0x72, 0x23, 0x3c, 0x08, 0x77, 0x1f,
-  0x66, 0x0f, 0xb6, 0xd8, 0x66, 0x0f, 0xb6, 0x55, 0xe1, 0xc1, 0xe3, 0x08,
-  0x09, 0xd3, 0xc7, 0x05, 0x94, 0x0c, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00,
-  0x66, 0x89, 0x1d, 0x8e, 0x0c, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5a, 0x5b,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x81, 0xec, 0xb0,
-  0x00, 0x00, 0x00, 0xa0, 0xad, 0x0c, 0x00, 0x00, 0x84, 0xc0, 0x0f, 0x85,
-  0x5d, 0x02, 0x00, 0x00, 0x30, 0xe4, 0x66, 0xa3, 0xaa, 0x0c, 0x00, 0x00,
-  0xa2, 0xac, 0x0c, 0x00, 0x00, 0x0f, 0xb7, 0x05, 0x8e, 0x0c, 0x00, 0x00,
-  0xc1, 0xf8, 0x08, 0xc6, 0x05, 0xad, 0x0c, 0x00, 0x00, 0x01, 0x83, 0xf8,
-  0x14, 0x74, 0x05, 0x83, 0xf8, 0x0a, 0x75, 0x1d, 0xc7, 0x05, 0x98, 0x0c,
-  0x00, 0x00, 0x75, 0x04, 0x00, 0x00, 0x66, 0xa1, 0x8e, 0x0c, 0x00, 0x00,
-  0xc6, 0x05, 0xac, 0x0c, 0x00, 0x00, 0x05, 0x66, 0xa3, 0xaa, 0x0c, 0x00,
-  0x00, 0x66, 0x83, 0x3d, 0xaa, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x85, 0x6e,
-  0x00, 0x00, 0x00, 0x8d, 0x5d, 0xdc, 0x8d, 0x55, 0xdc, 0xb8, 0x2f, 0x00,
-  0x00, 0x00, 0x66, 0xc7, 0x45, 0xdc, 0x0a, 0x16, 0xe8, 0x23, 0x7a, 0x00,
-  0x00, 0x66, 0x83, 0x7d, 0xdc, 0x00, 0x75, 0x51, 0x8b, 0x45, 0xe0, 0x66,
-  0x3d, 0x00, 0x03, 0x72, 0x48, 0x66, 0x3d, 0x00, 0x07, 0x77, 0x42, 0x66,
-  0xa3, 0xaa, 0x0c, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x66, 0x3d, 0x03, 0x00,
-  0x74, 0x0f, 0x66, 0x3d, 0x02, 0x00, 0x75, 0x12, 0xc6, 0x05, 0xac, 0x0c,
-  0x00, 0x00, 0x02, 0xeb, 0x1a, 0xc6, 0x05, 0xac, 0x0c, 0x00, 0x00, 0x03,
-  0xeb, 0x11, 0x31, 0xc0, 0x66, 0xa3, 0xaa, 0x0c, 0x00, 0x00, 0x80, 0x3d,
-  0xac, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x0a, 0xc7, 0x05, 0x98, 0x0c, 0x00,
-  0x00, 0x8d, 0x04, 0x00, 0x00, 0x66, 0x83, 0x3d, 0xaa, 0x0c, 0x00, 0x00,
-  0x00, 0x75, 0x3c, 0x8d, 0x5d, 0xdc, 0x8d, 0x55, 0xdc, 0xb8, 0x2f, 0x00,
-  0x00, 0x00, 0x66, 0xc7, 0x45, 0xdc, 0x80, 0x46, 0xe8, 0xab, 0x79, 0x00,
-  0x00, 0x66, 0x83, 0x7d, 0xdc, 0x00, 0x75, 0x1f, 0x66, 0xc7, 0x05, 0xaa,
-  0x0c, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x05, 0xac, 0x0c, 0x00, 0x00, 0x01,
-  0xc7, 0x05, 0x98, 0x0c, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0xe9, 0x5f,
-  0x01, 0x00, 0x00, 0x66, 0x83, 0x3d, 0xaa, 0x0c, 0x00, 0x00, 0x00, 0x0f,
-  0x85, 0x6d, 0x00, 0x00, 0x00, 0x8d, 0x5d, 0xdc, 0x8d, 0x55, 0xdc, 0xb8,
-  0x2f, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xdc, 0x00, 0x16, 0xe8, 0x61,
-  0x79, 0x00, 0x00, 0x8a, 0x45, 0xdc, 0x3c, 0x01, 0x74, 0x04, 0x3c, 0xff,
-  0x75, 0x12, 0x66, 0xc7, 0x05, 0xaa, 0x0c, 0x00, 0x00, 0x00, 0x02, 0xc6,
-  0x05, 0xac, 0x0c, 0x00, 0x00, 0x03, 0xeb, 0x30, 0x3c, 0x03, 0x74, 0x04,
-  0x3c, 0x04, 0x75, 0x1f, 0x66, 0x0f, 0xb6, 0x55, 0xdc, 0x66, 0x0f, 0xb6,
-  0x45, 0xdd, 0xc1, 0xe2, 0x08, 0x01, 0xc2, 0xc6, 0x05, 0xac, 0x0c, 0x00,
-  0x00, 0x03, 0x66, 0x89, 0x15, 0xaa, 0x0c, 0x00, 0x00, 0xeb, 0x09, 0x80,
-  0x3d, 0xac, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x0a, 0xc7, 0x05, 0x98, 0x0c,
-  0x00, 0x00, 0xaf, 0x04, 0x00, 0x00, 0x66, 0x83, 0x3d, 0xaa, 0x0c, 0x00,
-  0x00, 0x00, 0x75, 0x45, 0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x00, 0x75,
-  0x3c, 0x66, 0x83, 0x3d, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x75, 0x05, 0xe8,
-  0x30, 0xfd, 0xff, 0xff, 0x66, 0xa1, 0x8e, 0x0c, 0x00, 0x00, 0x66, 0x3d,
-  0x10, 0x05, 0x72, 0x21, 0x66, 0x3d, 0x7f, 0x05, 0x77, 0x1b, 0xc6, 0x05,
-  0xac, 0x0c, 0x00, 0x00, 0x04, 0x31, 0xc0, 0xc7, 0x05, 0x98, 0x0c, 0x00,
-  0x00, 0xc0, 0x04, 0x00, 0x00, 0x66, 0xa3, 0xaa, 0x0c, 0x00, 0x00, 0xeb,
-  0x0d, 0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x04, 0x0f, 0x85, 0x7f, 0x00,
-  0x00, 0x00, 0xe8, 0xed, 0x12, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x84, 0x72,
-  0x00, 0x00, 0x00, 0xbb, 0x94, 0x00, 0x00, 0x00, 0x8d, 0x85, 0x48, 0xff,
-  0xff, 0xff, 0x31, 0xd2, 0xe8, 0xef, 0xf1, 0xff, 0xff, 0x8d, 0x85, 0x48,
-  0xff, 0xff, 0xff, 0xc7, 0x85, 0x48, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00,
-  0x00, 0xe8, 0x3e, 0x14, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x47, 0x8b, 0x85,
-  0x4c, 0xff, 0xff, 0xff, 0x8b, 0x95, 0x50, 0xff, 0xff, 0xff, 0xc1, 0xe0,
-  0x08, 0x09, 0xc2, 0xc7, 0x05, 0x98, 0x0c, 0x00, 0x00, 0xe1, 0x04, 0x00,
-  0x00, 0x66, 0x89, 0x15, 0xaa, 0x0c, 0x00, 0x00, 0x83, 0xbd, 0x58, 0xff,
-  0xff, 0xff, 0x02, 0x75, 0x0e, 0xc6, 0x05, 0xac, 0x0c, 0x00, 0x00, 0x04,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x25, 0xc6, 0x05, 0xac, 0x0c, 0x00,
-  0x00, 0x03, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x17, 0x80, 0x3d, 0xac,
-  0x0c, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d,
-  0x65, 0xf8, 0x5a, 0x5b, 0x5d, 0xc3, 0x31, 0xc0, 0x8d, 0x65, 0xf8, 0x5a,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xb8, 0x00, 0x03, 0x66, 0xbb,
-  0x21, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0xcd,
-  0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x38, 0xb9, 0x0c,
-  0x00, 0x00, 0x00, 0x8d, 0x7d, 0xb8, 0xbe, 0xf0, 0x16, 0x00, 0x00, 0xf3,
-  0xa5, 0x66, 0xa5, 0x8d, 0x45, 0xb8, 0xc7, 0x45, 0xd4, 0x00, 0x52, 0x00,
-  0x00, 0xe8, 0xaa, 0xff, 0xff, 0xff, 0xf6, 0x45, 0xd8, 0x01, 0x74, 0x04,
-  0x31, 0xc0, 0xeb, 0x1f, 0x0f, 0xb7, 0x45, 0xda, 0xc1, 0xe0, 0x04, 0x89,
-  0x45, 0xec, 0x8b, 0x45, 0xc8, 0x8b, 0x55, 0xec, 0x25, 0xff, 0xff, 0x00,
-  0x00, 0x01, 0xc2, 0x89, 0x15, 0x88, 0x0c, 0x00, 0x00, 0x89, 0xd0, 0x8d,
-  0x65, 0xf0, 0x5f, 0x5e, 0x5a, 0x59, 0x5d, 0xc3, 0x66, 0x81, 0x78, 0x0a,
-  0x80, 0x00, 0x72, 0x07, 0x66, 0x83, 0x78, 0x0a, 0xff, 0x75, 0x03, 0x31,
-  0xc0, 0xc3, 0x0f, 0xb7, 0x40, 0x0a, 0xc1, 0xe0, 0x04, 0xc3, 0x8b, 0xc0,
-  0x53, 0x51, 0x52, 0x31, 0xdb, 0x31, 0xc9, 0xeb, 0x07, 0x41, 0x40, 0x83,
-  0xf9, 0x08, 0x7d, 0x17, 0x8a, 0x10, 0x84, 0xd2, 0x74, 0x11, 0x80, 0xfa,
-  0x20, 0x72, 0x05, 0x80, 0xfa, 0x7f, 0x72, 0xe9, 0xbb, 0x01, 0x00, 0x00,
-  0x00, 0xeb, 0xe2, 0x89, 0xd8, 0x5a, 0x59, 0x5b, 0xc3, 0x8d, 0x40, 0x00,
-  0xa1, 0x88, 0x0c, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x03, 0x31, 0xc0, 0xc3,
-  0x66, 0x8b, 0x40, 0xfe, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x89, 0xc3, 0x66, 0x83, 0x78,
-  0x0a, 0x00, 0x76, 0x5b, 0x66, 0x81, 0x78, 0x0a, 0x80, 0x00, 0x73, 0x53,
-  0xb9, 0x02, 0x00, 0x00, 0x00, 0x83, 0xc0, 0x0f, 0xbf, 0x09, 0x05, 0x00,
-  0x00, 0x89, 0xc6, 0x89, 0x45, 0xe8, 0x33, 0xc0, 0xf3, 0xa6, 0x74, 0x05,
-  0x19, 0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x74, 0x1c, 0xb9, 0x02, 0x00,
-  0x00, 0x00, 0xbf, 0x0c, 0x05, 0x00, 0x00, 0x8b, 0x75, 0xe8, 0x33, 0xc0,
-  0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x75,
-  0x0c, 0x8d, 0x43, 0x11, 0x31, 0xd2, 0xbb, 0x06, 0x00, 0x00, 0x00, 0xeb,
-  0x21, 0xbb, 0x08, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xe8, 0xeb, 0x15, 0x8d,
-  0x4b, 0x0f, 0x89, 0xc8, 0xe8, 0x43, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x74,
-  0x0e, 0xbb, 0x08, 0x00, 0x00, 0x00, 0x89, 0xc8, 0x31, 0xd2, 0xe8, 0xfd,
-  0xef, 0xff, 0xff, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56, 0x89, 0xc1, 0x80, 0x78,
-  0x0e, 0x5a, 0x74, 0x0e, 0x66, 0x8b, 0x00, 0x66, 0x85, 0xc0, 0x74, 0x06,
-  0x66, 0x3d, 0xff, 0xff, 0x75, 0x07, 0x31, 0xc0, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x66, 0x81, 0x79, 0x02, 0x00, 0x40, 0x72, 0x07, 0x31, 0xc0, 0x5e,
-  0x5a, 0x59, 0x5b, 0xc3, 0x0f, 0xb7, 0x31, 0xc1, 0xe6, 0x04, 0x8d, 0x46,
-  0x10, 0x89, 0x41, 0x04, 0x66, 0x8b, 0x01, 0x66, 0x89, 0x41, 0x0c, 0x8a,
-  0x06, 0x88, 0x41, 0x0e, 0x66, 0x8b, 0x46, 0x01, 0x66, 0x89, 0x41, 0x0a,
-  0x66, 0x8b, 0x46, 0x03, 0x89, 0xca, 0x66, 0x89, 0x41, 0x08, 0x89, 0xf0,
-  0x83, 0xc6, 0x08, 0x42, 0x8a, 0x58, 0x08, 0x40, 0x88, 0x5a, 0x0e, 0x39,
-  0xf0, 0x75, 0xf4, 0x8a, 0x41, 0x0e, 0xc6, 0x41, 0x17, 0x00, 0x3c, 0x5a,
-  0x74, 0x0b, 0x3c, 0x4d, 0x74, 0x07, 0x31, 0xc0, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x66, 0x8b, 0x01, 0x66, 0x03, 0x41, 0x08, 0x40, 0x66, 0x3b, 0x01,
-  0x77, 0x07, 0x31, 0xc0, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x66, 0x89, 0x01,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8b, 0xc0,
-  0x52, 0x89, 0xc2, 0xa1, 0x88, 0x0c, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x24,
-  0x66, 0xc7, 0x42, 0x02, 0x00, 0x00, 0xe8, 0x99, 0xfe, 0xff, 0xff, 0x66,
-  0x89, 0x02, 0x66, 0x85, 0xc0, 0x74, 0x06, 0x66, 0x3d, 0xff, 0xff, 0x75,
-  0x04, 0x31, 0xc0, 0x5a, 0xc3, 0x89, 0xd0, 0xe8, 0x2c, 0xff, 0xff, 0xff,
-  0x5a, 0xc3, 0x8b, 0xc0, 0x53, 0x51, 0x56, 0x57, 0x0f, 0xb7, 0xc0, 0xc1,
-  0xe0, 0x04, 0x89, 0x02, 0x66, 0x8b, 0x40, 0x02, 0x66, 0x89, 0x42, 0x04,
-  0x8b, 0x02, 0x66, 0x8b, 0x40, 0x16, 0x66, 0x89, 0x42, 0x06, 0x8b, 0x02,
-  0x66, 0x8b, 0x40, 0x2c, 0x31, 0xdb, 0x66, 0x89, 0x42, 0x08, 0x31, 0xc0,
-  0x8b, 0x0a, 0x0f, 0xb6, 0xb1, 0x80, 0x00, 0x00, 0x00, 0x39, 0xf0, 0x73,
-  0x0f, 0x8d, 0x34, 0x01, 0x80, 0xbe, 0x81, 0x00, 0x00, 0x00, 0x20, 0x75,
-  0x03, 0x40, 0xeb, 0xe4, 0x8b, 0x0a, 0x0f, 0xb6, 0xb1, 0x80, 0x00, 0x00,
-  0x00, 0x39, 0xf0, 0x73, 0x13, 0x8d, 0x34, 0x01, 0x89, 0xdf, 0x43, 0x8a,
-  0x8e, 0x81, 0x00, 0x00, 0x00, 0x40, 0x88, 0x4c, 0x3a, 0x0a, 0xeb, 0xe0,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x44, 0x1a, 0x0a, 0x00, 0x5f, 0x5e,
-  0x59, 0x5b, 0xc3, 0x90, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc3, 0x8b,
-  0x40, 0x04, 0x89, 0x03, 0x85, 0xc0, 0x74, 0x0f, 0x66, 0x81, 0x7b, 0x12,
-  0x00, 0x02, 0x73, 0x07, 0x66, 0x83, 0x7b, 0x0a, 0xff, 0x75, 0x07, 0x31,
-  0xc0, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x66, 0x8b, 0x00, 0x66, 0x89, 0x43,
-  0x0a, 0x8b, 0x03, 0x66, 0x8b, 0x40, 0x02, 0x66, 0x89, 0x43, 0x08, 0x8b,
-  0x03, 0x66, 0x8b, 0x40, 0x04, 0x66, 0x89, 0x43, 0x0c, 0x8b, 0x03, 0x66,
-  0x8b, 0x40, 0x06, 0x66, 0x89, 0x43, 0x0e, 0x8b, 0x03, 0x66, 0x8b, 0x40,
-  0x08, 0x66, 0x89, 0x43, 0x10, 0x8d, 0x7b, 0x14, 0xf6, 0x43, 0x0d, 0x80,
-  0x75, 0x3c, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x8c, 0xd9, 0x8b, 0x33, 0x8c,
-  0xda, 0x83, 0xc6, 0x0b, 0x1e, 0x06, 0x57, 0x91, 0x8e, 0xd8, 0x8e, 0xc2,
-  0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03,
-  0xf3, 0xa4, 0x58, 0x07, 0x1f, 0x8a, 0x43, 0x14, 0xc6, 0x43, 0x1b, 0x00,
-  0x3c, 0x21, 0x72, 0x04, 0x3c, 0x7f, 0x72, 0x31, 0xc6, 0x43, 0x14, 0x00,
-  0xeb, 0x2b, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x8c, 0xd9, 0x8b, 0x33, 0x8c,
-  0xda, 0x83, 0xc6, 0x0a, 0x1e, 0x06, 0x57, 0x91, 0x8e, 0xd8, 0x8e, 0xc2,
-  0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03,
-  0xf3, 0xa4, 0x58, 0x07, 0x1f, 0xc6, 0x43, 0x1c, 0x00, 0x0f, 0xb7, 0x73,
-  0x08, 0x0f, 0xb7, 0x43, 0x0a, 0xc1, 0xe6, 0x04, 0x66, 0xff, 0x43, 0x12,
-  0x01, 0xc6, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x89, 0x73, 0x04, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc3, 0xb8,
-  0x22, 0x00, 0x00, 0x00, 0x83, 0x3d, 0x88, 0x0c, 0x00, 0x00, 0x00, 0x75,
-  0x07, 0x31, 0xc0, 0xe9, 0x7e, 0x00, 0x00, 0x00, 0x66, 0x81, 0x3d, 0x8e,
-  0x0c, 0x00, 0x00, 0x00, 0x02, 0x73, 0x08, 0x31, 0xc0, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0xc3, 0x66, 0x81, 0x3d, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x03,
-  0x73, 0x07, 0xb8, 0x17, 0x00, 0x00, 0x00, 0xeb, 0x07, 0x75, 0x05, 0xb8,
-  0x28, 0x00, 0x00, 0x00, 0xc7, 0x43, 0x08, 0x00, 0x00, 0x00, 0x00, 0x66,
-  0xc7, 0x43, 0x12, 0x00, 0x00, 0x8b, 0x0d, 0x88, 0x0c, 0x00, 0x00, 0x01,
-  0xc1, 0xbf, 0x0f, 0x05, 0x00, 0x00, 0x89, 0x4b, 0x04, 0x8c, 0xda, 0x89,
-  0x0b, 0x8d, 0x71, 0x0a, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x8c, 0xd9, 0x1e,
-  0x06, 0x91, 0x8e, 0xda, 0x8e, 0xc0, 0x0b, 0xc9, 0xf3, 0xa6, 0x74, 0x05,
-  0x19, 0xc9, 0x83, 0xd9, 0xff, 0x07, 0x1f, 0x85, 0xc9, 0x74, 0x08, 0x31,
-  0xc0, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x89, 0xd8, 0xe8, 0x82, 0xfe,
-  0xff, 0xff, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0xc7, 0x45,
-  0xe8, 0xff, 0xff, 0xff, 0xff, 0x66, 0xb8, 0x06, 0xde, 0x8b, 0x8d, 0xe4,
-  0xff, 0xff, 0xff, 0xcd, 0x67, 0x0a, 0xe4, 0x0f, 0x85, 0x06, 0x00, 0x00,
-  0x00, 0x89, 0x95, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0x45, 0xe8, 0x8d, 0x65,
-  0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x10, 0x80, 0x3d, 0x08, 0x0d, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xbf, 0x01, 0x00, 0x00, 0xbb, 0x10, 0x00, 0x00,
-  0x00, 0xb8, 0x2c, 0x14, 0x00, 0x00, 0x31, 0xd2, 0xe8, 0xb7, 0xec, 0xff,
-  0xff, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x00, 0x7d, 0x05, 0xe8, 0x39,
-  0x13, 0x00, 0x00, 0xe8, 0x8c, 0xf7, 0xff, 0xff, 0xe8, 0x37, 0x05, 0x00,
-  0x00, 0xa0, 0xac, 0x0c, 0x00, 0x00, 0x3c, 0x03, 0x75, 0x13, 0x31, 0xc0,
-  0xc7, 0x05, 0x30, 0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0xa3, 0x34,
-  0x14, 0x00, 0x00, 0xeb, 0x67, 0x3c, 0x04, 0x75, 0x27, 0x31, 0xc0, 0x89,
-  0x45, 0xdc, 0x33, 0xc0, 0x48, 0x0f, 0x20, 0xc0, 0x89, 0x85, 0xdc, 0xff,
-  0xff, 0xff, 0x8b, 0x45, 0xdc, 0x0d, 0x01, 0x00, 0x00, 0x80, 0xa3, 0x30,
-  0x14, 0x00, 0x00, 0x31, 0xc0, 0xa3, 0x34, 0x14, 0x00, 0x00, 0xeb, 0x3c,
-  0x31, 0xc0, 0x89, 0x45, 0xe0, 0x89, 0x45, 0xe4, 0x89, 0x45, 0xe8, 0x33,
-  0xc0, 0x48, 0x0f, 0x20, 0xc0, 0x89, 0x85, 0xe0, 0xff, 0xff, 0xff, 0x0f,
-  0x20, 0xd8, 0x89, 0x85, 0xe4, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xe0, 0x89,
-  0x85, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0x45, 0xe0, 0xa3, 0x30, 0x14, 0x00,
-  0x00, 0x8b, 0x45, 0xe4, 0xa3, 0x34, 0x14, 0x00, 0x00, 0x8b, 0x45, 0xe8,
-  0xa3, 0x38, 0x14, 0x00, 0x00, 0x80, 0x3d, 0xaf, 0x0c, 0x00, 0x00, 0x00,
-  0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x24, 0x01, 0x80, 0x25, 0x2c, 0x14,
-  0x00, 0x00, 0xbf, 0xc0, 0xe0, 0x06, 0x08, 0x05, 0x2c, 0x14, 0x00, 0x00,
-  0xa1, 0x30, 0x14, 0x00, 0x00, 0xc1, 0xe8, 0x1f, 0x85, 0xc0, 0x0f, 0x95,
-  0xc0, 0x0f, 0xb6, 0xc0, 0x80, 0x25, 0x2c, 0x14, 0x00, 0x00, 0xfe, 0x24,
-  0x01, 0x08, 0x05, 0x2c, 0x14, 0x00, 0x00, 0x80, 0x3d, 0xaf, 0x0c, 0x00,
-  0x00, 0x00, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x24, 0x01, 0x80, 0x25,
-  0x2c, 0x14, 0x00, 0x00, 0xfd, 0x00, 0xc0, 0x08, 0x05, 0x2c, 0x14, 0x00,
-  0x00, 0xa0, 0x2c, 0x14, 0x00, 0x00, 0x24, 0x01, 0x80, 0x25, 0x2c, 0x14,
-  0x00, 0x00, 0xfb, 0xc0, 0xe0, 0x02, 0x08, 0x05, 0x2c, 0x14, 0x00, 0x00,
-  0xa0, 0x2c, 0x14, 0x00, 0x00, 0x24, 0x01, 0x80, 0x25, 0x2c, 0x14, 0x00,
-  0x00, 0xf7, 0xc0, 0xe0, 0x03, 0x08, 0x05, 0x2c, 0x14, 0x00, 0x00, 0xf6,
-  0x05, 0x38, 0x14, 0x00, 0x00, 0x20, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0,
-  0x24, 0x01, 0x80, 0x25, 0x2c, 0x14, 0x00, 0x00, 0xef, 0xc0, 0xe0, 0x04,
-  0x08, 0x05, 0x2c, 0x14, 0x00, 0x00, 0xa0, 0x2c, 0x14, 0x00, 0x00, 0x24,
-  0x01, 0x80, 0x25, 0x2c, 0x14, 0x00, 0x00, 0xdf, 0xc0, 0xe0, 0x05, 0x08,
-  0x05, 0x2c, 0x14, 0x00, 0x00, 0xa0, 0xac, 0x0c, 0x00, 0x00, 0x3c, 0x03,
-  0x74, 0x04, 0x3c, 0x04, 0x75, 0x0e, 0x80, 0x25, 0x2c, 0x14, 0x00, 0x00,
-  0x90, 0x80, 0x0d, 0x2c, 0x14, 0x00, 0x00, 0x2f, 0xf6, 0x05, 0x2c, 0x14,
-  0x00, 0x00, 0x10, 0x74, 0x07, 0x80, 0x0d, 0x2c, 0x14, 0x00, 0x00, 0x08,
-  0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x00, 0x75, 0x13, 0x81, 0x3d, 0x34,
-  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x72, 0x07, 0x80, 0x25, 0x2c,
-  0x14, 0x00, 0x00, 0xf7, 0xc6, 0x05, 0x08, 0x0d, 0x00, 0x00, 0x01, 0xb8,
-  0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x24, 0x89, 0x45, 0xe4, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x89, 0x45,
-  0xdc, 0x89, 0x45, 0xe0, 0x30, 0xc0, 0x88, 0x45, 0xe8, 0x88, 0x45, 0xec,
-  0x31, 0xc0, 0x89, 0x45, 0xd4, 0x89, 0x45, 0xd8, 0xf6, 0x05, 0x2c, 0x14,
-  0x00, 0x00, 0x01, 0x75, 0x0a, 0x8b, 0x45, 0xe4, 0x31, 0xd2, 0xe9, 0x94,
-  0x02, 0x00, 0x00, 0x81, 0x7d, 0xe4, 0x00, 0x00, 0x10, 0x00, 0x73, 0x17,
-  0xf6, 0x05, 0x2c, 0x14, 0x00, 0x00, 0x02, 0x75, 0x0e, 0x8b, 0x45, 0xe4,
-  0x31, 0xd2, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0xa0,
-  0x2c, 0x14, 0x00, 0x00, 0xa8, 0x40, 0x74, 0x28, 0xa8, 0x02, 0x75, 0x09,
-  0x81, 0x7d, 0xe4, 0x00, 0x00, 0x0c, 0x00, 0x72, 0x1b, 0x8b, 0x45, 0xe4,
-  0xc1, 0xe8, 0x0c, 0xe8, 0x60, 0xfd, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74,
-  0x0b, 0x31, 0xd2, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3,
-  0xa0, 0x2c, 0x14, 0x00, 0x00, 0xa8, 0x10, 0x0f, 0x85, 0x30, 0x02, 0x00,
-  0x00, 0xa8, 0x08, 0x0f, 0x85, 0x28, 0x02, 0x00, 0x00, 0x31, 0xc0, 0x89,
-  0x45, 0xcc, 0x89, 0x45, 0xd0, 0x33, 0xc0, 0x48, 0x0f, 0x20, 0xd8, 0x89,
-  0x85, 0xcc, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xe0, 0x89, 0x85, 0xd0, 0xff,
-  0xff, 0xff, 0x8b, 0x45, 0xcc, 0xa3, 0x34, 0x14, 0x00, 0x00, 0x8b, 0x45,
-  0xd0, 0xc1, 0x6d, 0xe4, 0x0c, 0xa3, 0x38, 0x14, 0x00, 0x00, 0x81, 0x3d,
-  0x34, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0f, 0x82, 0xe7, 0x01,
-  0x00, 0x00, 0xa0, 0x2c, 0x14, 0x00, 0x00, 0xa8, 0x02, 0x74, 0x3f, 0xa8,
-  0x40, 0x74, 0x3b, 0x81, 0x3d, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x73, 0x2f, 0xc6, 0x45, 0xe8, 0x00, 0x8b, 0x15, 0x34, 0x14, 0x00,
-  0x00, 0xa1, 0x34, 0x14, 0x00, 0x00, 0x30, 0xd2, 0xc1, 0xe8, 0x0c, 0x80,
-  0xe6, 0xf0, 0xe8, 0xc5, 0xfc, 0xff, 0xff, 0x39, 0xd0, 0x75, 0x56, 0xa1,
-  0x34, 0x14, 0x00, 0x00, 0x30, 0xc0, 0x80, 0xe4, 0xf0, 0x89, 0x45, 0xd4,
-  0xeb, 0x47, 0xf6, 0x05, 0x2c, 0x14, 0x00, 0x00, 0x02, 0x75, 0x1f, 0x81,
-  0x3d, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x73, 0x13, 0xa1,
-  0x34, 0x14, 0x00, 0x00, 0x30, 0xc0, 0x80, 0xe4, 0xf0, 0xc6, 0x45, 0xe8,
-  0x00, 0x89, 0x45, 0xd4, 0xeb, 0x1f, 0xa1, 0x34, 0x14, 0x00, 0x00, 0x30,
-  0xc0, 0xba, 0x00, 0x10, 0x00, 0x00, 0x80, 0xe4, 0xf0, 0xe8, 0xd2, 0xec,
-  0xff, 0xff, 0x89, 0x45, 0xd4, 0x85, 0xc0, 0x74, 0x04, 0xc6, 0x45, 0xe8,
-  0x01, 0x83, 0x7d, 0xd4, 0x00, 0x0f, 0x84, 0x09, 0x01, 0x00, 0x00, 0x8b,
-  0x45, 0xe4, 0x8b, 0x55, 0xd4, 0xc1, 0xe8, 0x0a, 0x8b, 0x14, 0x82, 0xf6,
-  0xc2, 0x01, 0x0f, 0x84, 0xf4, 0x00, 0x00, 0x00, 0xf6, 0x05, 0xc9, 0x0d,
-  0x00, 0x00, 0x08, 0x0f, 0x84, 0x77, 0x00, 0x00, 0x00, 0xf6, 0x05, 0x38,
-  0x14, 0x00, 0x00, 0x10, 0x74, 0x6e, 0xf6, 0xc2, 0x80, 0x74, 0x69, 0x89,
-  0xd6, 0x31, 0xc0, 0x81, 0xe6, 0x00, 0x00, 0xc0, 0xff, 0x89, 0x45, 0xe0,
-  0x89, 0x75, 0xdc, 0xf6, 0x05, 0xcb, 0x0d, 0x00, 0x00, 0x02, 0x0f, 0x84,
-  0xbc, 0x00, 0x00, 0x00, 0x89, 0xd0, 0xc1, 0xe8, 0x0d, 0xf6, 0x05, 0xd0,
-  0x0d, 0x00, 0x00, 0x20, 0x74, 0x20, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x25,
-  0xff, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x31, 0xc9, 0xe8, 0x14, 0x62, 0x00,
-  0x00, 0x89, 0x55, 0xe0, 0x09, 0xc6, 0x89, 0x75, 0xdc, 0xe9, 0x8e, 0x00,
-  0x00, 0x00, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x83, 0xe0, 0x0f, 0x31, 0xd2,
-  0x31, 0xc9, 0xe8, 0xf6, 0x61, 0x00, 0x00, 0x89, 0x55, 0xe0, 0x09, 0xc6,
-  0x89, 0x75, 0xdc, 0xe9, 0x70, 0x00, 0x00, 0x00, 0xa0, 0x2c, 0x14, 0x00,
-  0x00, 0xa8, 0x02, 0x74, 0x28, 0xa8, 0x40, 0x74, 0x24, 0x81, 0xfa, 0x00,
-  0x00, 0x10, 0x00, 0x73, 0x1c, 0xc6, 0x45, 0xec, 0x00, 0x89, 0xd0, 0x30,
-  0xd2, 0xc1, 0xe8, 0x0c, 0x80, 0xe6, 0xf0, 0xe8, 0xa0, 0xfb, 0xff, 0xff,
-  0x39, 0xd0, 0x75, 0x44, 0x89, 0x55, 0xd8, 0xeb, 0x3f, 0xa0, 0x2c, 0x14,
-  0x00, 0x00, 0xa8, 0x02, 0x75, 0x1a, 0xa8, 0x02, 0x75, 0x16, 0x81, 0xfa,
-  0x00, 0x00, 0x10, 0x00, 0x73, 0x0e, 0x30, 0xd2, 0x80, 0xe6, 0xf0, 0xc6,
-  0x45, 0xec, 0x00, 0x89, 0x55, 0xd8, 0xeb, 0x1c, 0x30, 0xd2, 0x80, 0xe6,
-  0xf0, 0x89, 0xd0, 0xba, 0x00, 0x10, 0x00, 0x00, 0xe8, 0xbf, 0xeb, 0xff,
-  0xff, 0x89, 0x45, 0xd8, 0x85, 0xc0, 0x74, 0x04, 0xc6, 0x45, 0xec, 0x01,
-  0x83, 0x7d, 0xd8, 0x00, 0x74, 0x23, 0x8b, 0x45, 0xe4, 0x25, 0xff, 0x03,
-  0x00, 0x00, 0xc1, 0xe0, 0x02, 0x03, 0x45, 0xd8, 0x8b, 0x00, 0xa8, 0x01,
-  0x74, 0x0f, 0x30, 0xc0, 0x80, 0xe4, 0xf0, 0xc7, 0x45, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x89, 0x45, 0xdc, 0x80, 0x7d, 0xec, 0x00, 0x74, 0x08, 0x8b,
-  0x45, 0xd8, 0xe8, 0xd5, 0xeb, 0xff, 0xff, 0x80, 0x7d, 0xe8, 0x00, 0x74,
-  0x08, 0x8b, 0x45, 0xd4, 0xe8, 0xc7, 0xeb, 0xff, 0xff, 0x8b, 0x45, 0xdc,
-  0x8b, 0x55, 0xe0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x18, 0x89, 0x45, 0xe0, 0x89,
-  0x55, 0xe4, 0x89, 0x5d, 0xe8, 0x89, 0x4d, 0xf4, 0x31, 0xc0, 0x89, 0x45,
-  0xec, 0x89, 0x45, 0xf0, 0x66, 0xb8, 0x04, 0x05, 0x8b, 0x9d, 0xe0, 0xff,
-  0xff, 0xff, 0x8b, 0x8d, 0xe4, 0xff, 0xff, 0xff, 0x8b, 0x95, 0xe8, 0xff,
-  0xff, 0xff, 0xcd, 0x31, 0x0f, 0x82, 0x0c, 0x00, 0x00, 0x00, 0x89, 0x9d,
-  0xec, 0xff, 0xff, 0xff, 0x89, 0xb5, 0xf0, 0xff, 0xff, 0xff, 0x83, 0x7d,
-  0xec, 0x00, 0x74, 0x0e, 0x83, 0x7d, 0xf4, 0x00, 0x74, 0x08, 0x8b, 0x45,
-  0xf0, 0x8b, 0x55, 0xf4, 0x89, 0x02, 0x8b, 0x45, 0xec, 0x8d, 0x65, 0xf8,
-  0x5f, 0x5e, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0x31, 0xc0, 0x89, 0x45, 0xe8, 0x66,
-  0xb8, 0x02, 0x05, 0x66, 0x8b, 0xbd, 0xe4, 0xff, 0xff, 0xff, 0x66, 0x8b,
-  0xb5, 0xe6, 0xff, 0xff, 0xff, 0xcd, 0x31, 0x0f, 0x82, 0x0a, 0x00, 0x00,
-  0x00, 0xc7, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8b,
-  0x45, 0xe8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0xb8, 0x9c, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x85, 0xc0, 0x0f, 0x94, 0xc0,
-  0x0f, 0xb6, 0xc0, 0xc3, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0xc6, 0x45, 0xe8, 0xff, 0x80, 0x3d, 0xae, 0x0c, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0x89, 0x00, 0x00, 0x00, 0xc6, 0x05, 0xae, 0x0c,
-  0x00, 0x00, 0x01, 0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x08, 0x75, 0x07,
-  0x31, 0xc0, 0xe9, 0x79, 0x00, 0x00, 0x00, 0xe8, 0xb8, 0xff, 0xff, 0xff,
-  0x85, 0xc0, 0x74, 0x0c, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0x5d, 0xc3, 0xe8, 0x17, 0xf3, 0xff, 0xff, 0x80, 0x3d, 0xac,
-  0x0c, 0x00, 0x00, 0x00, 0x74, 0x0c, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x1e, 0x06, 0x66, 0xb8, 0x00, 0xde,
-  0xcd, 0x67, 0x88, 0xa5, 0xe8, 0xff, 0xff, 0xff, 0x66, 0xb8, 0x00, 0x00,
-  0x66, 0x8e, 0xd8, 0x88, 0x3d, 0x45, 0x14, 0x00, 0x00, 0x66, 0xb8, 0x00,
-  0x00, 0x66, 0x8e, 0xd8, 0x88, 0x1d, 0x44, 0x14, 0x00, 0x00, 0x07, 0x1f,
-  0x80, 0x7d, 0xe8, 0x00, 0x74, 0x0c, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0xc6, 0x05, 0xaf, 0x0c, 0x00, 0x00,
-  0x01, 0x0f, 0xb6, 0x05, 0xaf, 0x0c, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x88, 0x45, 0xec, 0x31, 0xc0, 0x89,
-  0x45, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xe4, 0x66, 0xb8, 0x02, 0x02, 0x8a,
-  0x9d, 0xec, 0xff, 0xff, 0xff, 0x66, 0x33, 0xc9, 0x66, 0x33, 0xd2, 0xcd,
-  0x31, 0x66, 0x89, 0x8d, 0xe8, 0xff, 0xff, 0xff, 0x89, 0x95, 0xe4, 0xff,
-  0xff, 0xff, 0x8b, 0x45, 0xe4, 0x8b, 0x55, 0xe8, 0x8d, 0x65, 0xf0, 0x5f,
-  0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x52,
-  0x56, 0x57, 0x83, 0xec, 0x10, 0x88, 0x45, 0xf0, 0x89, 0xca, 0x89, 0xd8,
-  0x89, 0x55, 0xec, 0x89, 0x5d, 0xe4, 0xc7, 0x45, 0xe8, 0x01, 0x00, 0x00,
-  0x00, 0x66, 0xb8, 0x03, 0x02, 0x8a, 0x9d, 0xf0, 0xff, 0xff, 0xff, 0x66,
-  0x8b, 0x8d, 0xec, 0xff, 0xff, 0xff, 0x8b, 0x95, 0xe4, 0xff, 0xff, 0xff,
-  0xcd, 0x31, 0x0f, 0x83, 0x0a, 0x00, 0x00, 0x00, 0xc7, 0x85, 0xe8, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xe8, 0x8d, 0x65, 0xf4,
-  0x5f, 0x5e, 0x5a, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x20, 0x89, 0x45, 0xe8, 0xb9, 0x07,
-  0x00, 0x00, 0x00, 0x8d, 0x7d, 0xcc, 0xbe, 0x22, 0x17, 0x00, 0x00, 0x8d,
-  0x5d, 0xcc, 0x8d, 0x55, 0xcc, 0xf3, 0xa5, 0xb8, 0x21, 0x00, 0x00, 0x00,
-  0x66, 0xc7, 0x45, 0xcc, 0x12, 0xfd, 0x66, 0xc7, 0x45, 0xd0, 0x57, 0x34,
-  0xe8, 0x7b, 0x6c, 0x00, 0x00, 0x66, 0x81, 0x7d, 0xcc, 0x78, 0x56, 0x75,
-  0x3e, 0x8b, 0x55, 0xe8, 0x8a, 0x45, 0xd4, 0x88, 0x02, 0x8b, 0x45, 0xd8,
-  0x66, 0x89, 0x42, 0x02, 0x8b, 0x45, 0xd0, 0x66, 0x89, 0x42, 0x04, 0x66,
-  0x83, 0x7a, 0x02, 0x00, 0x75, 0x1a, 0x66, 0x3d, 0x35, 0x12, 0x75, 0x08,
-  0x66, 0xc7, 0x42, 0x02, 0x00, 0x02, 0xeb, 0x0c, 0x66, 0x3d, 0x37, 0x12,
-  0x75, 0x06, 0x66, 0xc7, 0x42, 0x02, 0x00, 0x03, 0xb8, 0x01, 0x00, 0x00,
-  0x00, 0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x51, 0x52, 0x56, 0x57, 0xba, 0x78, 0x00, 0x00,
-  0x00, 0xeb, 0x08, 0x81, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x7d, 0x48, 0x66,
-  0x8b, 0x34, 0x95, 0x00, 0x00, 0x00, 0x00, 0x66, 0x8b, 0x04, 0x95, 0x02,
-  0x00, 0x00, 0x00, 0x66, 0x83, 0xfe, 0xff, 0x74, 0x0b, 0x66, 0x85, 0xc0,
-  0x74, 0x06, 0x66, 0x3d, 0xff, 0xff, 0x75, 0x03, 0x42, 0xeb, 0xd4, 0x0f,
-  0xb7, 0xf0, 0xb9, 0x04, 0x00, 0x00, 0x00, 0xc1, 0xe6, 0x04, 0xbf, 0x18,
-  0x05, 0x00, 0x00, 0x83, 0xc6, 0x0a, 0x33, 0xc0, 0xf3, 0xa6, 0x74, 0x05,
-  0x19, 0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x75, 0xdb, 0xeb, 0x05, 0xba,
-  0xff, 0xff, 0xff, 0xff, 0x89, 0xd0, 0x5f, 0x5e, 0x5a, 0x59, 0xc3, 0x90,
-  0x51, 0x52, 0x56, 0x57, 0xba, 0x78, 0x00, 0x00, 0x00, 0xeb, 0x08, 0x81,
-  0xfa, 0x90, 0x00, 0x00, 0x00, 0x7d, 0x4b, 0x66, 0x8b, 0x34, 0x95, 0x00,
-  0x00, 0x00, 0x00, 0x66, 0x8b, 0x04, 0x95, 0x02, 0x00, 0x00, 0x00, 0x66,
-  0x83, 0xfe, 0xff, 0x74, 0x0b, 0x66, 0x85, 0xc0, 0x74, 0x06, 0x66, 0x3d,
-  0xff, 0xff, 0x75, 0x03, 0x42, 0xeb, 0xd4, 0x0f, 0xb7, 0xf0, 0xb9, 0x08,
-  0x00, 0x00, 0x00, 0xc1, 0xe6, 0x04, 0xbf, 0x1d, 0x05, 0x00, 0x00, 0x81,
-  0xc6, 0x03, 0x01, 0x00, 0x00, 0x33, 0xc0, 0xf3, 0xa6, 0x74, 0x05, 0x19,
-  0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x75, 0xd8, 0xeb, 0x05, 0xba, 0xff,
-  0xff, 0xff, 0xff, 0x89, 0xd0, 0x5f, 0x5e, 0x5a, 0x59, 0xc3, 0x8b, 0xc0,
-  0x60, 0x1e, 0x06, 0x0f, 0xa0, 0x0f, 0xa8, 0x89, 0xe5, 0xfc, 0xe8, 0x2d,
-  0x63, 0x00, 0x00, 0x1e, 0x07, 0x66, 0xb8, 0x00, 0x03, 0x66, 0xbb, 0x02,
-  0x00, 0x66, 0x33, 0xc9, 0xbf, 0x16, 0x0d, 0x00, 0x00, 0xcd, 0x31, 0x0f,
-  0xa9, 0x0f, 0xa1, 0x07, 0x1f, 0x61, 0xcf, 0x90, 0x53, 0x51, 0x83, 0x3d,
-  0x0c, 0x0d, 0x00, 0x00, 0x00, 0x7e, 0x06, 0xff, 0x0d, 0x0c, 0x0d, 0x00,
-  0x00, 0x83, 0x3d, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x75, 0x36, 0x80, 0x3d,
-  0x09, 0x0d, 0x00, 0x00, 0x00, 0x74, 0x2d, 0xb8, 0x02, 0x00, 0x00, 0x00,
-  0x66, 0x8b, 0x0d, 0x14, 0x0d, 0x00, 0x00, 0x8b, 0x1d, 0x10, 0x0d, 0x00,
-  0x00, 0xc6, 0x05, 0x09, 0x0d, 0x00, 0x00, 0x00, 0xe8, 0x07, 0x6b, 0x00,
-  0x00, 0x31, 0xc0, 0x66, 0xa3, 0x14, 0x0d, 0x00, 0x00, 0x31, 0xc0, 0xa3,
-  0x10, 0x0d, 0x00, 0x00, 0x59, 0x5b, 0xc3, 0x90, 0x53, 0x51, 0x52, 0x83,
-  0x3d, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x75, 0x37, 0x80, 0x3d, 0x09, 0x0d,
-  0x00, 0x00, 0x00, 0x75, 0x2e, 0xc6, 0x05, 0x09, 0x0d, 0x00, 0x00, 0x01,
-  0xb8, 0x02, 0x00, 0x00, 0x00, 0xbb, 0xec, 0x30, 0x00, 0x00, 0xe8, 0xf9,
-  0x6a, 0x00, 0x00, 0x8c, 0xc9, 0xa3, 0x10, 0x0d, 0x00, 0x00, 0xb8, 0x02,
-  0x00, 0x00, 0x00, 0x66, 0x89, 0x15, 0x14, 0x0d, 0x00, 0x00, 0xe8, 0xb1,
-  0x6a, 0x00, 0x00, 0xff, 0x05, 0x0c, 0x0d, 0x00, 0x00, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56, 0x57, 0x66, 0xb8, 0x8f,
-  0x16, 0x66, 0xba, 0x00, 0x03, 0xcd, 0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56, 0x57, 0x66, 0xb8, 0x8f,
-  0x16, 0x66, 0xba, 0x00, 0x02, 0xcd, 0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x08, 0x88, 0x45, 0xe8, 0x31, 0xc0, 0x89, 0x45, 0xe4, 0x80,
-  0x7d, 0xe8, 0x00, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x88, 0x45, 0xe8,
-  0x66, 0xb8, 0x8f, 0x16, 0x66, 0x33, 0xd2, 0x8a, 0x95, 0xe8, 0xff, 0xff,
-  0xff, 0xcd, 0x2f, 0x66, 0x89, 0x85, 0xe4, 0xff, 0xff, 0xff, 0x0f, 0xb7,
-  0x45, 0xe4, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x31,
-  0xc0, 0x89, 0x45, 0xe8, 0x66, 0xb8, 0x8f, 0x16, 0x66, 0xba, 0x00, 0x01,
-  0xcd, 0x2f, 0x66, 0x89, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x66, 0x81, 0x7d,
-  0xe8, 0x8f, 0x16, 0x75, 0x07, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x04,
-  0x0f, 0xb7, 0x45, 0xe8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0xc3, 0x8b, 0xc0, 0xa0, 0xac, 0x0c, 0x00, 0x00, 0x3c, 0x03, 0x74,
-  0x04, 0x3c, 0x04, 0x75, 0x06, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3, 0x31,
-  0xc0, 0xc3, 0x8b, 0xc0, 0x53, 0x51, 0x52, 0x56, 0x57, 0x66, 0xb8, 0x80,
-  0x16, 0x66, 0x33, 0xdb, 0xcd, 0x2f, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0xe8,
-  0xdc, 0xed, 0xff, 0xff, 0xa0, 0x50, 0x0d, 0x00, 0x00, 0x84, 0xc0, 0x7c,
-  0x08, 0x0f, 0xbe, 0xc0, 0xe9, 0x43, 0x01, 0x00, 0x00, 0xc6, 0x05, 0x50,
-  0x0d, 0x00, 0x00, 0x00, 0x80, 0x3d, 0x8c, 0x0c, 0x00, 0x00, 0x02, 0x75,
-  0x1c, 0x83, 0x3d, 0x90, 0x0c, 0x00, 0x00, 0x24, 0x75, 0x13, 0xc6, 0x05,
-  0x50, 0x0d, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0xb8, 0x00, 0xff, 0x0e, 0x00, 0x31, 0xd2,
-  0x80, 0x38, 0x00, 0x75, 0x0f, 0x42, 0x40, 0x81, 0xfa, 0x00, 0x01, 0x00,
-  0x00, 0x7d, 0x16, 0x80, 0x38, 0x00, 0x74, 0xf1, 0x0f, 0xbe, 0x05, 0x50,
-  0x0d, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0xc7, 0x45, 0xe8, 0x00, 0x00, 0x0f, 0x00, 0xba, 0x00, 0x00, 0x0f,
-  0x00, 0x8b, 0x3d, 0x48, 0x0d, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xc9, 0xeb,
-  0x0b, 0x31, 0xc9, 0x40, 0x42, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x7d, 0x17,
-  0x8d, 0x34, 0x0f, 0x8a, 0x1a, 0x3a, 0x1e, 0x75, 0xec, 0x41, 0x80, 0x3c,
-  0x39, 0x00, 0x75, 0xe7, 0x80, 0x7a, 0x01, 0x00, 0x75, 0xe1, 0x40, 0x3d,
-  0x00, 0x10, 0x00, 0x00, 0x7c, 0x11, 0x0f, 0xbe, 0x05, 0x50, 0x0d, 0x00,
-  0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x31,
-  0xd2, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x7d, 0x31, 0x8b, 0x4d, 0xe8, 0x8b,
-  0x3d, 0x4c, 0x0d, 0x00, 0x00, 0x01, 0xc1, 0x8d, 0x34, 0x17, 0x8a, 0x19,
-  0x3a, 0x1e, 0x75, 0x12, 0x42, 0x8d, 0x34, 0x17, 0x80, 0x3e, 0x00, 0x75,
-  0x0b, 0xc6, 0x05, 0x50, 0x0d, 0x00, 0x00, 0x01, 0xeb, 0x0b, 0x31, 0xd2,
-  0x40, 0x41, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x7c, 0xda, 0x3d, 0x00, 0x10,
-  0x00, 0x00, 0x7c, 0x11, 0x0f, 0xbe, 0x05, 0x50, 0x0d, 0x00, 0x00, 0x8d,
-  0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0x55, 0xe8,
-  0x01, 0xc2, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x7d, 0x09, 0x80, 0x3a, 0x20,
-  0x75, 0x04, 0x42, 0x40, 0xeb, 0xf0, 0x31, 0xd2, 0x3d, 0x00, 0x10, 0x00,
-  0x00, 0x7d, 0x1b, 0x89, 0xc1, 0x03, 0x4d, 0xe8, 0x42, 0x8a, 0x19, 0x40,
-  0x88, 0x9a, 0x50, 0x0d, 0x00, 0x00, 0x83, 0xfa, 0x3f, 0x73, 0x07, 0x3d,
-  0x00, 0x10, 0x00, 0x00, 0x7c, 0xe5, 0x0f, 0xbe, 0x05, 0x50, 0x0d, 0x00,
-  0x00, 0xc6, 0x82, 0x51, 0x0d, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x3c, 0x01, 0x74, 0x0a,
-  0x84, 0xc0, 0x75, 0x0c, 0xb8, 0xf4, 0x03, 0x00, 0x00, 0xc3, 0xb8, 0x26,
-  0x05, 0x00, 0x00, 0xc3, 0xb8, 0x45, 0x05, 0x00, 0x00, 0xc3, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0xbb,
-  0xff, 0xff, 0x00, 0x00, 0x31, 0xc0, 0xba, 0x00, 0x04, 0x00, 0x00, 0x89,
-  0x45, 0xe8, 0xeb, 0x12, 0xbb, 0xff, 0xff, 0x00, 0x00, 0xff, 0x45, 0xe8,
-  0x42, 0x81, 0x7d, 0xe8, 0xf4, 0x01, 0x00, 0x00, 0x77, 0x27, 0xb9, 0x0c,
-  0x00, 0x00, 0x00, 0xbe, 0x47, 0x05, 0x00, 0x00, 0x89, 0xd7, 0x33, 0xc0,
-  0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x75,
-  0x06, 0x8d, 0x5a, 0x0c, 0x66, 0x8b, 0x1b, 0x66, 0x83, 0xfb, 0xf0, 0x73,
-  0xc7, 0x89, 0xd8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x34, 0xbb, 0x54, 0x05, 0x00, 0x00, 0xba, 0x5d, 0x05, 0x00,
-  0x00, 0xb8, 0x47, 0x05, 0x00, 0x00, 0xe8, 0x0d, 0x6a, 0x00, 0x00, 0x89,
-  0xc2, 0x66, 0xa3, 0x9e, 0x0c, 0x00, 0x00, 0x66, 0x3d, 0xf0, 0xff, 0x72,
-  0x07, 0x31, 0xc0, 0xe9, 0xa4, 0x00, 0x00, 0x00, 0xb9, 0x0c, 0x00, 0x00,
-  0x00, 0x8d, 0x7d, 0xb8, 0xbe, 0x3e, 0x17, 0x00, 0x00, 0x0f, 0xb7, 0xc0,
-  0xf3, 0xa5, 0x66, 0xa5, 0x89, 0x45, 0xd0, 0x0f, 0xb7, 0xc2, 0x8d, 0x55,
-  0xb8, 0xc7, 0x45, 0xc8, 0x00, 0x00, 0x50, 0xd0, 0xe8, 0x47, 0x69, 0x00,
-  0x00, 0x8b, 0x55, 0xd0, 0x81, 0x7d, 0xc8, 0xaa, 0x55, 0xaa, 0x55, 0x75,
-  0x10, 0x81, 0xfa, 0x00, 0x04, 0x00, 0x00, 0x72, 0x08, 0x81, 0xfa, 0x00,
-  0x06, 0x00, 0x00, 0x76, 0x18, 0x0f, 0xb7, 0x05, 0x9e, 0x0c, 0x00, 0x00,
-  0xe8, 0x63, 0x69, 0x00, 0x00, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0xb9, 0x0e, 0x00, 0x00, 0x00, 0xbf, 0x62,
-  0x05, 0x00, 0x00, 0x89, 0xd6, 0x33, 0xc0, 0xf3, 0xa6, 0x74, 0x05, 0x19,
-  0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x74, 0x18, 0x0f, 0xb7, 0x05, 0x9e,
-  0x0c, 0x00, 0x00, 0xe8, 0x30, 0x69, 0x00, 0x00, 0x31, 0xc0, 0x8d, 0x65,
-  0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x66, 0xa1, 0x9e, 0x0c,
-  0x00, 0x00, 0x66, 0x89, 0x42, 0x0c, 0x66, 0x3d, 0xff, 0xff, 0x0f, 0x95,
-  0xc0, 0x0f, 0xb6, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x52, 0x66, 0xa1, 0x92, 0x0d, 0x00, 0x00, 0x66,
-  0x85, 0xc0, 0x75, 0x04, 0x31, 0xc0, 0x5a, 0xc3, 0x0f, 0xb7, 0xd0, 0xb8,
-  0x01, 0x10, 0x00, 0x00, 0x66, 0xef, 0x0f, 0xb7, 0x15, 0x92, 0x0d, 0x00,
-  0x00, 0x31, 0xc0, 0x42, 0x66, 0xef, 0x0f, 0xb7, 0x15, 0x92, 0x0d, 0x00,
-  0x00, 0x83, 0xc2, 0x02, 0x2b, 0xc0, 0x66, 0xed, 0x5a, 0xc3, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec, 0x10, 0x89, 0x45, 0xe4,
-  0x89, 0x55, 0xe8, 0x89, 0x5d, 0xf0, 0x66, 0xa1, 0x92, 0x0d, 0x00, 0x00,
-  0x66, 0x85, 0xc0, 0x74, 0x48, 0x0f, 0xb7, 0xd0, 0xb8, 0x01, 0x10, 0x00,
-  0x00, 0x66, 0xef, 0x0f, 0xb7, 0x15, 0x92, 0x0d, 0x00, 0x00, 0xb8, 0x01,
-  0x00, 0x00, 0x00, 0x42, 0x66, 0xef, 0x0f, 0xb7, 0x05, 0x92, 0x0d, 0x00,
-  0x00, 0x83, 0xc0, 0x02, 0x89, 0x45, 0xec, 0x60, 0x8b, 0x95, 0xec, 0xff,
-  0xff, 0xff, 0x8b, 0x85, 0xe4, 0xff, 0xff, 0xff, 0x0f, 0xb7, 0x9d, 0xf0,
-  0xff, 0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x8b, 0xbd, 0xe8, 0xff,
-  0xff, 0xff, 0xf3, 0x6c, 0x61, 0x31, 0xc0, 0x8d, 0x65, 0xf4, 0x5f, 0x5e,
-  0x59, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0x66, 0xa1, 0x92, 0x0d, 0x00, 0x00,
-  0x66, 0x85, 0xc0, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x44, 0x0f, 0xb7, 0xd0,
-  0xb8, 0x00, 0x10, 0x00, 0x00, 0x66, 0xef, 0x0f, 0xb7, 0x15, 0x92, 0x0d,
-  0x00, 0x00, 0x31, 0xc0, 0x42, 0x66, 0xef, 0x66, 0xa1, 0x92, 0x0d, 0x00,
-  0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x89, 0x45, 0xe8, 0x56, 0x51, 0x52,
-  0xfc, 0x0f, 0xb7, 0x95, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0xb5, 0xe4, 0xff,
-  0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xf3, 0x6e, 0x5a, 0x59, 0x5e,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x51, 0x52, 0x56, 0x57, 0x83,
-  0xec, 0x34, 0x80, 0x3d, 0x9d, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xa1,
-  0x00, 0x00, 0x00, 0x31, 0xc0, 0xc6, 0x05, 0x9d, 0x0c, 0x00, 0x00, 0x01,
-  0x66, 0xa3, 0x92, 0x0d, 0x00, 0x00, 0xf6, 0x05, 0x86, 0x0c, 0x00, 0x00,
-  0x02, 0x74, 0x10, 0x66, 0xc7, 0x05, 0x9e, 0x0c, 0x00, 0x00, 0xff, 0xff,
-  0x31, 0xc0, 0xe9, 0x87, 0x00, 0x00, 0x00, 0xe8, 0x60, 0xfd, 0xff, 0xff,
-  0x66, 0xa3, 0x9e, 0x0c, 0x00, 0x00, 0x66, 0x3d, 0xff, 0xff, 0x75, 0x0e,
-  0xf6, 0x05, 0x86, 0x0c, 0x00, 0x00, 0x01, 0x75, 0x05, 0xe8, 0xaa, 0xfd,
-  0xff, 0xff, 0x66, 0x83, 0x3d, 0x9e, 0x0c, 0x00, 0x00, 0xff, 0x74, 0x50,
-  0xe8, 0xb3, 0x66, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x0e, 0xb8, 0xf0, 0xff,
-  0x00, 0x00, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x5a, 0x59, 0x5d, 0xc3, 0xb9,
-  0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc, 0xbe, 0x70, 0x17, 0x00, 0x00,
-  0xf3, 0xa5, 0x66, 0xa5, 0x8d, 0x55, 0xbc, 0x0f, 0xb7, 0x05, 0x9e, 0x0c,
-  0x00, 0x00, 0xc7, 0x45, 0xcc, 0x03, 0x00, 0x50, 0xd0, 0xe8, 0x06, 0x67,
-  0x00, 0x00, 0x8b, 0x45, 0xd0, 0x81, 0x7d, 0xcc, 0xaa, 0x55, 0xaa, 0x55,
-  0x75, 0x06, 0x66, 0xa3, 0x92, 0x0d, 0x00, 0x00, 0x66, 0x83, 0x3d, 0x9e,
-  0x0c, 0x00, 0x00, 0xff, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x8d, 0x65,
-  0xf0, 0x5f, 0x5e, 0x5a, 0x59, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x34, 0x66, 0x83, 0x3d, 0x9e, 0x0c, 0x00,
-  0x00, 0xff, 0x74, 0x3c, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc,
-  0xbe, 0xa2, 0x17, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x8d, 0x55, 0xbc,
-  0x0f, 0xb7, 0x05, 0x9e, 0x0c, 0x00, 0x00, 0xc7, 0x45, 0xcc, 0xff, 0xff,
-  0x50, 0xd0, 0xe8, 0xa1, 0x66, 0x00, 0x00, 0x0f, 0xb7, 0x05, 0x9e, 0x0c,
-  0x00, 0x00, 0xe8, 0xd9, 0x66, 0x00, 0x00, 0x66, 0xc7, 0x05, 0x9e, 0x0c,
-  0x00, 0x00, 0xff, 0xff, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x5a, 0x59, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51, 0x52, 0x56, 0x57, 0x83,
-  0xec, 0x34, 0x66, 0x83, 0x3d, 0x9e, 0x0c, 0x00, 0x00, 0xff, 0x75, 0x04,
-  0x31, 0xc0, 0xeb, 0x33, 0xe8, 0xd7, 0x65, 0x00, 0x00, 0x85, 0xc0, 0x74,
-  0x2a, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc, 0xbe, 0xd4, 0x17,
-  0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x8d, 0x55, 0xbc, 0x0f, 0xb7, 0x05,
-  0x9e, 0x0c, 0x00, 0x00, 0xc7, 0x45, 0xcc, 0x02, 0x00, 0x50, 0xd0, 0xe8,
-  0x38, 0x66, 0x00, 0x00, 0x8b, 0x45, 0xcc, 0x8d, 0x65, 0xf0, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x3c, 0x89, 0x45, 0xe4, 0x66, 0x83, 0x3d, 0x9e, 0x0c, 0x00,
-  0x00, 0xff, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x53, 0xe8, 0x7f, 0x65, 0x00,
-  0x00, 0x85, 0xc0, 0x74, 0x4a, 0x31, 0xc0, 0x89, 0x45, 0xe8, 0xb9, 0x0c,
-  0x00, 0x00, 0x00, 0x8d, 0x7d, 0xb0, 0xbe, 0x06, 0x18, 0x00, 0x00, 0xf3,
-  0xa5, 0x66, 0xa5, 0x66, 0x8c, 0x9d, 0xe8, 0xff, 0xff, 0xff, 0xc7, 0x45,
-  0xc0, 0x01, 0x00, 0x50, 0xd0, 0x8b, 0x45, 0xe4, 0xc7, 0x45, 0xc8, 0x01,
-  0x00, 0x00, 0x00, 0x89, 0x45, 0xb4, 0x8b, 0x45, 0xe8, 0x8d, 0x55, 0xb0,
-  0x66, 0x89, 0x45, 0xd4, 0x0f, 0xb7, 0x05, 0x9e, 0x0c, 0x00, 0x00, 0xe8,
-  0xc0, 0x65, 0x00, 0x00, 0x8b, 0x45, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x3c, 0x02, 0x74, 0x14,
-  0x3c, 0x01, 0x74, 0x0a, 0x84, 0xc0, 0x75, 0x12, 0xb8, 0xf4, 0x03, 0x00,
-  0x00, 0xc3, 0xb8, 0x71, 0x05, 0x00, 0x00, 0xc3, 0xb8, 0x78, 0x05, 0x00,
-  0x00, 0xc3, 0xb8, 0x45, 0x05, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1e, 0x50, 0x66, 0xb8, 0x00, 0x00, 0x66, 0x8e, 0xd8, 0x58, 0xc6, 0x05,
-  0xf8, 0x0d, 0x00, 0x00, 0x01, 0x1f, 0x83, 0x04, 0x24, 0x03, 0xcf, 0x90,
-  0x1e, 0x50, 0x66, 0xb8, 0x00, 0x00, 0x66, 0x8e, 0xd8, 0xc6, 0x05, 0xf8,
-  0x0d, 0x00, 0x00, 0x01, 0x83, 0x44, 0x24, 0x14, 0x03, 0x58, 0x1f, 0xcb,
-  0xa1, 0xa0, 0x0d, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x05, 0xe8, 0x22, 0x5d,
-  0x00, 0x00, 0x31, 0xc0, 0xa3, 0xa0, 0x0d, 0x00, 0x00, 0xc3, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x10, 0xb9,
-  0x04, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xdc, 0xbe, 0xb0, 0x38, 0x00, 0x00,
-  0xf3, 0xa5, 0xe8, 0xc9, 0xff, 0xff, 0xff, 0xb8, 0x7c, 0x00, 0x00, 0x00,
-  0xe8, 0xef, 0x5d, 0x00, 0x00, 0xa3, 0xa0, 0x0d, 0x00, 0x00, 0x85, 0xc0,
-  0x0f, 0x84, 0xe5, 0x02, 0x00, 0x00, 0xbb, 0x7c, 0x00, 0x00, 0x00, 0x31,
-  0xd2, 0xe8, 0x56, 0xdc, 0xff, 0xff, 0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00,
-  0x01, 0x0f, 0x84, 0xbf, 0x02, 0x00, 0x00, 0x8d, 0x75, 0xdc, 0xb8, 0x00,
-  0x00, 0x00, 0x80, 0x33, 0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89,
-  0x06, 0x89, 0x5e, 0x04, 0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b, 0x45,
-  0xdc, 0x3d, 0x01, 0x00, 0x00, 0x80, 0x0f, 0x82, 0x96, 0x02, 0x00, 0x00,
-  0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x89, 0x46, 0x34, 0x8d, 0x75, 0xdc,
-  0xb8, 0x01, 0x00, 0x00, 0x80, 0x80, 0x0d, 0xd8, 0x0d, 0x00, 0x00, 0x04,
-  0x33, 0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06, 0x89, 0x5e,
-  0x04, 0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0, 0x0d, 0x00,
-  0x00, 0x8b, 0x45, 0xdc, 0x89, 0x46, 0x38, 0x8b, 0x35, 0xa0, 0x0d, 0x00,
-  0x00, 0x8b, 0x45, 0xe0, 0x89, 0x46, 0x3c, 0x8b, 0x35, 0xa0, 0x0d, 0x00,
-  0x00, 0x8b, 0x45, 0xe4, 0x89, 0x46, 0x40, 0x8b, 0x35, 0xa0, 0x0d, 0x00,
-  0x00, 0x8b, 0x45, 0xe8, 0x89, 0x46, 0x44, 0xa1, 0xa0, 0x0d, 0x00, 0x00,
-  0x81, 0x78, 0x34, 0x04, 0x00, 0x00, 0x80, 0x0f, 0x82, 0xe9, 0x00, 0x00,
-  0x00, 0x8d, 0x75, 0xdc, 0xb8, 0x02, 0x00, 0x00, 0x80, 0x33, 0xdb, 0x8b,
-  0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06, 0x89, 0x5e, 0x04, 0x89, 0x4e,
-  0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45,
-  0xdc, 0x89, 0x06, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe0,
-  0x89, 0x46, 0x04, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe4,
-  0x89, 0x46, 0x08, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe8,
-  0x89, 0x46, 0x0c, 0x8d, 0x75, 0xdc, 0xb8, 0x03, 0x00, 0x00, 0x80, 0x33,
-  0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06, 0x89, 0x5e, 0x04,
-  0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00,
-  0x8b, 0x45, 0xdc, 0x89, 0x46, 0x10, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00,
-  0x8b, 0x45, 0xe0, 0x89, 0x46, 0x14, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00,
-  0x8b, 0x45, 0xe4, 0x89, 0x46, 0x18, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00,
-  0x8b, 0x45, 0xe8, 0x89, 0x46, 0x1c, 0x8d, 0x75, 0xdc, 0xb8, 0x04, 0x00,
-  0x00, 0x80, 0x33, 0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06,
-  0x89, 0x5e, 0x04, 0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0,
-  0x0d, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x89, 0x46, 0x20, 0x8b, 0x35, 0xa0,
-  0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe0, 0x89, 0x46, 0x24, 0x8b, 0x35, 0xa0,
-  0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x89, 0x46, 0x28, 0x8b, 0x35, 0xa0,
-  0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe8, 0x89, 0x46, 0x2c, 0xa1, 0xa0, 0x0d,
-  0x00, 0x00, 0xc6, 0x40, 0x30, 0x00, 0xa1, 0xa0, 0x0d, 0x00, 0x00, 0x81,
-  0x78, 0x34, 0x05, 0x00, 0x00, 0x80, 0x72, 0x4b, 0x8d, 0x75, 0xdc, 0xb8,
-  0x05, 0x00, 0x00, 0x80, 0x33, 0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2,
-  0x89, 0x06, 0x89, 0x5e, 0x04, 0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b,
-  0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x89, 0x46, 0x48, 0x8b,
-  0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe0, 0x89, 0x46, 0x4c, 0x8b,
-  0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x89, 0x46, 0x50, 0x8b,
-  0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe8, 0x89, 0x46, 0x54, 0xa1,
-  0xa0, 0x0d, 0x00, 0x00, 0x81, 0x78, 0x34, 0x06, 0x00, 0x00, 0x80, 0x72,
-  0x4b, 0x8d, 0x75, 0xdc, 0xb8, 0x06, 0x00, 0x00, 0x80, 0x33, 0xdb, 0x8b,
-  0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06, 0x89, 0x5e, 0x04, 0x89, 0x4e,
-  0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45,
-  0xdc, 0x89, 0x46, 0x58, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45,
-  0xe0, 0x89, 0x46, 0x5c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45,
-  0xe4, 0x89, 0x46, 0x60, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45,
-  0xe8, 0x89, 0x46, 0x64, 0xa1, 0xa0, 0x0d, 0x00, 0x00, 0x81, 0x78, 0x34,
-  0x07, 0x00, 0x00, 0x80, 0x72, 0x27, 0x8d, 0x75, 0xdc, 0xb8, 0x07, 0x00,
-  0x00, 0x80, 0x33, 0xdb, 0x8b, 0xcb, 0x8b, 0xd3, 0x0f, 0xa2, 0x89, 0x06,
-  0x89, 0x5e, 0x04, 0x89, 0x4e, 0x08, 0x89, 0x56, 0x0c, 0x8b, 0x35, 0xa0,
-  0x0d, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x89, 0x46, 0x68, 0xa1, 0xa0, 0x0d,
-  0x00, 0x00, 0x81, 0x78, 0x34, 0x08, 0x00, 0x00, 0x80, 0x72, 0x4b, 0x8d,
-  0x75, 0xdc, 0xb8, 0x08, 0x00, 0x00, 0x80, 0x33, 0xdb, 0x8b, 0xcb, 0x8b,
-  0xd3, 0x0f, 0xa2, 0x89, 0x06, 0x89, 0x5e, 0x04, 0x89, 0x4e, 0x08, 0x89,
-  0x56, 0x0c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xdc, 0x89,
-  0x46, 0x6c, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe0, 0x89,
-  0x46, 0x70, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe4, 0x89,
-  0x46, 0x74, 0x8b, 0x35, 0xa0, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xe8, 0x89,
-  0x46, 0x78, 0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x04, 0x0f, 0x95, 0xc0,
-  0x0f, 0xb6, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0xc6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x30, 0xe8, 0x00,
-  0x00, 0x00, 0x00, 0xa2, 0xd1, 0x0d, 0x00, 0x00, 0x31, 0xc0, 0x89, 0x45,
-  0xe8, 0x33, 0xc0, 0x66, 0x8c, 0xc8, 0x66, 0x83, 0xe0, 0x03, 0x89, 0x85,
-  0xe8, 0xff, 0xff, 0xff, 0x83, 0x7d, 0xe8, 0x00, 0x74, 0x07, 0x80, 0x0d,
-  0xd8, 0x0d, 0x00, 0x00, 0x40, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x14, 0x80, 0x3d, 0x95, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x85,
-  0x73, 0x01, 0x00, 0x00, 0xc6, 0x05, 0x95, 0x0d, 0x00, 0x00, 0x01, 0xc6,
-  0x05, 0x94, 0x0d, 0x00, 0x00, 0x00, 0xc7, 0x05, 0x98, 0x0d, 0x00, 0x00,
-  0x9d, 0x05, 0x00, 0x00, 0x30, 0xc0, 0xc7, 0x05, 0x9c, 0x0d, 0x00, 0x00,
-  0x9e, 0x05, 0x00, 0x00, 0xa2, 0x97, 0x0d, 0x00, 0x00, 0xa2, 0x96, 0x0d,
-  0x00, 0x00, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x00, 0x7d, 0x05, 0xe8,
-  0x64, 0xff, 0xff, 0xff, 0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x01, 0x75,
-  0x11, 0xc7, 0x05, 0x98, 0x0d, 0x00, 0x00, 0xa3, 0x05, 0x00, 0x00, 0x31,
-  0xc0, 0xe9, 0x24, 0x01, 0x00, 0x00, 0xf6, 0x05, 0xcc, 0x0d, 0x00, 0x00,
-  0x02, 0x75, 0x16, 0xc7, 0x05, 0x98, 0x0d, 0x00, 0x00, 0xb6, 0x05, 0x00,
-  0x00, 0x31, 0xc0, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d,
-  0xc3, 0xe8, 0x92, 0xe4, 0xff, 0xff, 0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00,
-  0x08, 0x75, 0x15, 0xa0, 0xac, 0x0c, 0x00, 0x00, 0x3c, 0x04, 0x74, 0x0c,
-  0x3c, 0x02, 0x74, 0x08, 0x3c, 0x03, 0x0f, 0x85, 0x9c, 0x00, 0x00, 0x00,
-  0xc7, 0x05, 0x9c, 0x0d, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xb8, 0x06,
-  0x00, 0x00, 0x00, 0xbb, 0xd8, 0x38, 0x00, 0x00, 0xe8, 0xaf, 0xf1, 0xff,
-  0xff, 0x8c, 0xc9, 0x89, 0x45, 0xe0, 0xb8, 0x06, 0x00, 0x00, 0x00, 0x89,
-  0x55, 0xe4, 0xe8, 0xe5, 0xf1, 0xff, 0xff, 0xb8, 0x06, 0x00, 0x00, 0x00,
-  0xbb, 0xc0, 0x38, 0x00, 0x00, 0xe8, 0x2e, 0x5f, 0x00, 0x00, 0x8c, 0xc9,
-  0x89, 0x45, 0xdc, 0xb8, 0x06, 0x00, 0x00, 0x00, 0x89, 0x55, 0xe8, 0xe8,
-  0xec, 0x5e, 0x00, 0x00, 0x0f, 0x57, 0xc0, 0x8b, 0x4d, 0xe8, 0x8b, 0x5d,
-  0xdc, 0xb8, 0x06, 0x00, 0x00, 0x00, 0xe8, 0xd9, 0x5e, 0x00, 0x00, 0x8b,
-  0x4d, 0xe4, 0x8b, 0x5d, 0xe0, 0xb8, 0x06, 0x00, 0x00, 0x00, 0xe8, 0xa1,
-  0xf1, 0xff, 0xff, 0x80, 0x3d, 0xf8, 0x0d, 0x00, 0x00, 0x00, 0x74, 0x0c,
-  0xc7, 0x05, 0x98, 0x0d, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 0xeb, 0x57,
-  0xc6, 0x05, 0x94, 0x0d, 0x00, 0x00, 0x01, 0x0f, 0xb6, 0x05, 0x94, 0x0d,
-  0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0x31, 0xc0, 0x89, 0x45, 0xd8, 0xc7, 0x05, 0x9c, 0x0d, 0x00, 0x00, 0x4c,
-  0x06, 0x00, 0x00, 0x0f, 0x20, 0xe0, 0x89, 0x85, 0xd8, 0xff, 0xff, 0xff,
-  0x8b, 0x45, 0xd8, 0xf6, 0xc4, 0x02, 0x74, 0x09, 0xc6, 0x05, 0x94, 0x0d,
-  0x00, 0x00, 0x01, 0xeb, 0x0a, 0xc7, 0x05, 0x98, 0x0d, 0x00, 0x00, 0x63,
-  0x06, 0x00, 0x00, 0xb0, 0x01, 0xa2, 0x96, 0x0d, 0x00, 0x00, 0xa2, 0x97,
-  0x0d, 0x00, 0x00, 0x0f, 0xb6, 0x05, 0x94, 0x0d, 0x00, 0x00, 0x8d, 0x65,
-  0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x31, 0xc0, 0x89, 0x45, 0xe8,
-  0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x01, 0x74, 0x55, 0xf6, 0x05, 0xcc,
-  0x0d, 0x00, 0x00, 0x02, 0x74, 0x4c, 0x80, 0x3d, 0x97, 0x0d, 0x00, 0x00,
-  0x00, 0x74, 0x43, 0x0f, 0x20, 0xe0, 0x25, 0xff, 0xfd, 0xff, 0xff, 0x0f,
-  0x22, 0xe0, 0x8b, 0xd8, 0x0f, 0x20, 0xe0, 0x25, 0x00, 0x02, 0x00, 0x00,
-  0x81, 0xe3, 0x00, 0x02, 0x00, 0x00, 0x33, 0xc3, 0x89, 0x85, 0xe8, 0xff,
-  0xff, 0xff, 0x83, 0x7d, 0xe8, 0x00, 0x74, 0x0e, 0xc7, 0x05, 0x98, 0x0d,
-  0x00, 0x00, 0x7d, 0x06, 0x00, 0x00, 0x31, 0xc0, 0xeb, 0x0c, 0xc6, 0x05,
-  0x94, 0x0d, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65,
-  0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x31, 0xc0, 0x89, 0x45, 0xe8,
-  0xf6, 0x05, 0xd8, 0x0d, 0x00, 0x00, 0x01, 0x74, 0x55, 0xf6, 0x05, 0xcc,
-  0x0d, 0x00, 0x00, 0x02, 0x74, 0x4c, 0x80, 0x3d, 0x96, 0x0d, 0x00, 0x00,
-  0x00, 0x74, 0x43, 0x0f, 0x20, 0xe0, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x0f,
-  0x22, 0xe0, 0x8b, 0xd8, 0x0f, 0x20, 0xe0, 0x25, 0x00, 0x02, 0x00, 0x00,
-  0x81, 0xe3, 0x00, 0x02, 0x00, 0x00, 0x33, 0xc3, 0x89, 0x85, 0xe8, 0xff,
-  0xff, 0xff, 0x83, 0x7d, 0xe8, 0x00, 0x74, 0x0e, 0xc7, 0x05, 0x98, 0x0d,
-  0x00, 0x00, 0x7d, 0x06, 0x00, 0x00, 0x31, 0xc0, 0xeb, 0x0c, 0xc6, 0x05,
-  0x94, 0x0d, 0x00, 0x00, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65,
-  0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xb8,
-  0x00, 0x03, 0x66, 0xbb, 0x2f, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8,
-  0xff, 0xff, 0xff, 0xcd, 0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xa1, 0x0c, 0x0e, 0x00, 0x00,
-  0x8b, 0x55, 0xe8, 0x66, 0x89, 0x42, 0x2a, 0xa1, 0x0c, 0x0e, 0x00, 0x00,
-  0xc1, 0xe8, 0x10, 0x8b, 0x55, 0xe8, 0x66, 0x89, 0x42, 0x2c, 0x80, 0x3d,
-  0x9c, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0x0a, 0x8b, 0x45, 0xe8, 0xe8, 0xd1,
-  0xda, 0xff, 0xff, 0xeb, 0x12, 0x66, 0xb8, 0x01, 0x03, 0x66, 0x33, 0xdb,
-  0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0xcd, 0x31, 0x8d,
-  0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x50, 0xb9,
-  0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0x9c, 0xbe, 0x10, 0x3f, 0x00, 0x00,
-  0xf3, 0xa5, 0x66, 0xa5, 0xc6, 0x05, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x80,
-  0x3d, 0x9c, 0x0c, 0x00, 0x00, 0x00, 0x7d, 0x05, 0xe8, 0x83, 0xdc, 0xff,
-  0xff, 0x8d, 0x5d, 0xd0, 0x8d, 0x55, 0xd0, 0xb8, 0x2f, 0x00, 0x00, 0x00,
-  0x66, 0xc7, 0x45, 0xd0, 0x00, 0x43, 0xe8, 0x09, 0x5a, 0x00, 0x00, 0x80,
-  0x7d, 0xd0, 0x80, 0x74, 0x04, 0x31, 0xc0, 0xeb, 0x76, 0xc6, 0x05, 0x04,
-  0x0e, 0x00, 0x00, 0x01, 0x8d, 0x45, 0x9c, 0xc7, 0x45, 0xb8, 0x10, 0x43,
-  0x00, 0x00, 0xe8, 0x11, 0xff, 0xff, 0xff, 0x0f, 0xb7, 0x55, 0xbe, 0x8b,
-  0x45, 0xac, 0xc1, 0xe2, 0x10, 0x25, 0xff, 0xff, 0x00, 0x00, 0x09, 0xc2,
-  0x31, 0xc0, 0x89, 0x45, 0xb8, 0x8d, 0x45, 0x9c, 0x89, 0x15, 0x0c, 0x0e,
-  0x00, 0x00, 0xe8, 0x19, 0xff, 0xff, 0xff, 0x8b, 0x45, 0xb8, 0x25, 0xff,
-  0xff, 0x00, 0x00, 0xa3, 0x08, 0x0e, 0x00, 0x00, 0xf6, 0x45, 0xb0, 0x01,
-  0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0xa2, 0x10, 0x0e, 0x00, 0x00, 0x31,
-  0xc0, 0x89, 0x45, 0xac, 0x8d, 0x45, 0x9c, 0xc7, 0x45, 0xb8, 0x00, 0x88,
-  0x00, 0x00, 0xe8, 0xe9, 0xfe, 0xff, 0xff, 0xc6, 0x05, 0x10, 0x0e, 0x00,
-  0x00, 0x02, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x34, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d,
-  0xc0, 0xbe, 0x42, 0x3f, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x80, 0x3d,
-  0x04, 0x0e, 0x00, 0x00, 0x00, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x1c, 0x85,
-  0xc0, 0x0f, 0x9e, 0xc0, 0x0f, 0xb6, 0xc0, 0x83, 0xc0, 0x03, 0xc1, 0xe0,
-  0x08, 0x89, 0x45, 0xdc, 0x8d, 0x45, 0xc0, 0xe8, 0x90, 0xfe, 0xff, 0xff,
-  0x8b, 0x45, 0xdc, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec, 0x34, 0xb9, 0x0c, 0x00,
-  0x00, 0x00, 0x8d, 0x7d, 0xc0, 0xbe, 0x74, 0x3f, 0x00, 0x00, 0xf3, 0xa5,
-  0x66, 0xa5, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x75, 0x04, 0x31,
-  0xc0, 0xeb, 0x1c, 0x85, 0xc0, 0x0f, 0x9e, 0xc0, 0x0f, 0xb6, 0xc0, 0x83,
-  0xc0, 0x05, 0xc1, 0xe0, 0x08, 0x89, 0x45, 0xdc, 0x8d, 0x45, 0xc0, 0xe8,
-  0x44, 0xfe, 0xff, 0xff, 0x8b, 0x45, 0xdc, 0x8d, 0x65, 0xf4, 0x5f, 0x5e,
-  0x59, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x34, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xc0, 0xbe, 0xa6, 0x3f,
-  0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00,
-  0x00, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x12, 0x8d, 0x45, 0xc0, 0xc7, 0x45,
-  0xdc, 0x00, 0x07, 0x00, 0x00, 0xe8, 0x02, 0xfe, 0xff, 0xff, 0x8b, 0x45,
-  0xdc, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x8d, 0x40, 0x00,
-  0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec, 0x34, 0xb9, 0x0c, 0x00,
-  0x00, 0x00, 0x8d, 0x7d, 0xc0, 0xbe, 0xd8, 0x3f, 0x00, 0x00, 0xf3, 0xa5,
-  0x66, 0xa5, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x4e, 0xf6,
-  0x05, 0x10, 0x0e, 0x00, 0x00, 0x02, 0x74, 0x1c, 0x8d, 0x45, 0xc0, 0xc7,
-  0x45, 0xdc, 0x00, 0x88, 0x00, 0x00, 0xe8, 0xb9, 0xfd, 0xff, 0xff, 0x8b,
-  0x45, 0xdc, 0xa3, 0xfc, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xd4, 0xeb, 0x24,
-  0x8d, 0x45, 0xc0, 0xc7, 0x45, 0xdc, 0x00, 0x08, 0x00, 0x00, 0xe8, 0x9d,
-  0xfd, 0xff, 0xff, 0x8b, 0x45, 0xdc, 0x25, 0xff, 0xff, 0x00, 0x00, 0xa3,
-  0xfc, 0x0d, 0x00, 0x00, 0x8b, 0x45, 0xd4, 0x25, 0xff, 0xff, 0x00, 0x00,
-  0xa3, 0x00, 0x0e, 0x00, 0x00, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x34,
-  0x8b, 0x45, 0x08, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xc4, 0xbe,
-  0x0a, 0x40, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0xba, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x5e, 0xf6, 0x05,
-  0x10, 0x0e, 0x00, 0x00, 0x02, 0x74, 0x21, 0x89, 0x45, 0xd8, 0x8d, 0x45,
-  0xc4, 0xc7, 0x45, 0xe0, 0x00, 0x89, 0x00, 0x00, 0xe8, 0x33, 0xfd, 0xff,
-  0xff, 0x8b, 0x45, 0xe0, 0x25, 0xff, 0xff, 0x00, 0x00, 0x83, 0xf8, 0x01,
-  0x75, 0x36, 0xeb, 0x2b, 0x3d, 0xff, 0xff, 0x00, 0x00, 0x73, 0x2d, 0x25,
-  0xff, 0xff, 0x00, 0x00, 0x89, 0x45, 0xd8, 0x8d, 0x45, 0xc4, 0xc7, 0x45,
-  0xe0, 0x00, 0x09, 0x00, 0x00, 0xe8, 0x06, 0xfd, 0xff, 0xff, 0x8b, 0x45,
-  0xe0, 0x25, 0xff, 0xff, 0x00, 0x00, 0x83, 0xf8, 0x01, 0x75, 0x09, 0x8b,
-  0x55, 0xd8, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x89, 0xd0, 0x8d, 0x65,
-  0xf8, 0x5f, 0x5e, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x34, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d,
-  0xc0, 0xbe, 0x3c, 0x40, 0x00, 0x00, 0x25, 0xff, 0xff, 0x00, 0x00, 0xf3,
-  0xa5, 0x66, 0xa5, 0x89, 0x45, 0xd4, 0x8d, 0x45, 0xc0, 0xc7, 0x45, 0xdc,
-  0x00, 0x0a, 0x00, 0x00, 0xe8, 0xb3, 0xfc, 0xff, 0xff, 0x8b, 0x45, 0xdc,
-  0x25, 0xff, 0xff, 0x00, 0x00, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x44,
-  0x89, 0x45, 0xec, 0x89, 0x55, 0xf0, 0x89, 0x5d, 0xe8, 0x89, 0xcb, 0xb9,
-  0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xb4, 0x8d, 0x55, 0xf4, 0x31, 0xc0,
-  0xbe, 0x6e, 0x40, 0x00, 0x00, 0x89, 0x45, 0xf4, 0xb8, 0x10, 0x00, 0x00,
-  0x00, 0xf3, 0xa5, 0x66, 0xa5, 0xe8, 0x3a, 0xd4, 0xff, 0xff, 0x31, 0xc9,
-  0x85, 0xc0, 0x0f, 0x84, 0x95, 0x00, 0x00, 0x00, 0x80, 0x3d, 0x04, 0x0e,
-  0x00, 0x00, 0x00, 0x0f, 0x84, 0x7d, 0x00, 0x00, 0x00, 0x83, 0x7d, 0xe8,
-  0x00, 0x75, 0x0d, 0x89, 0xda, 0xc1, 0xe2, 0x0c, 0x83, 0xe3, 0x0f, 0x66,
-  0x31, 0xd2, 0x09, 0xd3, 0x83, 0x7d, 0xec, 0x00, 0x75, 0x16, 0x8b, 0x55,
-  0xf0, 0xc1, 0xe2, 0x0c, 0x66, 0x31, 0xd2, 0x89, 0xd1, 0x8b, 0x55, 0xf0,
-  0x83, 0xe2, 0x0f, 0x09, 0xd1, 0x89, 0x4d, 0xf0, 0x8b, 0x55, 0x08, 0x89,
-  0x58, 0x06, 0x89, 0x10, 0x8b, 0x55, 0xe8, 0x89, 0xc3, 0x66, 0x89, 0x50,
-  0x04, 0x8b, 0x55, 0xec, 0x30, 0xe7, 0x66, 0x89, 0x50, 0x0a, 0x8b, 0x55,
-  0xf0, 0x80, 0xe3, 0x0f, 0x89, 0x50, 0x0c, 0xc1, 0xe8, 0x04, 0xc7, 0x45,
-  0xd0, 0x00, 0x0b, 0x00, 0x00, 0x89, 0xc2, 0x0f, 0xb7, 0xc3, 0x66, 0x89,
-  0x55, 0xd8, 0x89, 0x45, 0xb8, 0x8d, 0x45, 0xb4, 0x66, 0x89, 0x55, 0xd6,
-  0xe8, 0xdf, 0xfb, 0xff, 0xff, 0x8b, 0x4d, 0xd0, 0x81, 0xe1, 0xff, 0xff,
-  0x00, 0x00, 0x0f, 0xb7, 0x45, 0xf4, 0xe8, 0x21, 0xd4, 0xff, 0xff, 0x89,
-  0xc8, 0x8d, 0x65, 0xf8, 0x5f, 0x5e, 0x5d, 0xc2, 0x04, 0x00, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x34, 0xb9, 0x0c,
-  0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc, 0xbe, 0xa0, 0x40, 0x00, 0x00, 0xf3,
-  0xa5, 0x66, 0xa5, 0x31, 0xd2, 0x80, 0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00,
-  0x74, 0x33, 0x25, 0xff, 0xff, 0x00, 0x00, 0x89, 0x45, 0xd0, 0x8d, 0x45,
-  0xbc, 0xc7, 0x45, 0xd8, 0x00, 0x0c, 0x00, 0x00, 0xe8, 0x83, 0xfb, 0xff,
-  0xff, 0xf6, 0x45, 0xd8, 0x01, 0x74, 0x16, 0x8b, 0x45, 0xd0, 0x8b, 0x55,
-  0xcc, 0x25, 0xff, 0xff, 0x00, 0x00, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00,
-  0xc1, 0xe0, 0x10, 0x09, 0xc2, 0x89, 0xd0, 0x8d, 0x65, 0xf0, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5d, 0xc3, 0x55, 0x89, 0xe5, 0x51, 0x52, 0x56, 0x57, 0x83,
-  0xec, 0x34, 0x89, 0xc2, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc,
-  0xbe, 0xd2, 0x40, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x31, 0xc0, 0x80,
-  0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x20, 0xc7, 0x45, 0xd8, 0x00,
-  0x0d, 0x00, 0x00, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x8d, 0x45, 0xbc,
-  0x89, 0x55, 0xd0, 0xe8, 0x1c, 0xfb, 0xff, 0xff, 0x8b, 0x45, 0xd8, 0x25,
-  0xff, 0xff, 0x00, 0x00, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x5a, 0x59, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x34,
-  0x8b, 0x55, 0x0c, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xc4, 0xbe,
-  0x04, 0x41, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x31, 0xc0, 0x80, 0x3d,
-  0x04, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x5f, 0xf6, 0x05, 0x10, 0x0e, 0x00,
-  0x00, 0x02, 0x74, 0x25, 0x8b, 0x45, 0x08, 0x25, 0xff, 0xff, 0x00, 0x00,
-  0xc7, 0x45, 0xe0, 0x00, 0x8f, 0x00, 0x00, 0x89, 0x45, 0xd8, 0x8d, 0x45,
-  0xc4, 0x89, 0x55, 0xd4, 0xe8, 0xbb, 0xfa, 0xff, 0xff, 0x8b, 0x45, 0xe0,
-  0x25, 0xff, 0xff, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x2d, 0x81, 0xfa, 0xff,
-  0xff, 0x00, 0x00, 0x73, 0x25, 0x8b, 0x45, 0x08, 0x25, 0xff, 0xff, 0x00,
-  0x00, 0xc7, 0x45, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x89, 0x45, 0xd8, 0x8d,
-  0x45, 0xc4, 0x89, 0x55, 0xd4, 0xe8, 0x8a, 0xfa, 0xff, 0xff, 0x8b, 0x45,
-  0xe0, 0x25, 0xff, 0xff, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5f, 0x5e, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83,
-  0xec, 0x34, 0x89, 0xc3, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xbc,
-  0xbe, 0x36, 0x41, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0x31, 0xc0, 0x80,
-  0x3d, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x85, 0x00, 0x00, 0x00,
-  0xf6, 0x05, 0x10, 0x0e, 0x00, 0x00, 0x02, 0x74, 0x3a, 0x89, 0xd8, 0x25,
-  0xff, 0xff, 0x00, 0x00, 0x89, 0x45, 0xd0, 0x8d, 0x45, 0xbc, 0xc7, 0x45,
-  0xd8, 0x00, 0x8e, 0x00, 0x00, 0xe8, 0x2a, 0xfa, 0xff, 0xff, 0x8b, 0x45,
-  0xd0, 0x89, 0x02, 0x8b, 0x45, 0xcc, 0xc1, 0xe8, 0x08, 0x25, 0xff, 0x00,
-  0x00, 0x00, 0x88, 0x42, 0x04, 0x8a, 0x45, 0xcc, 0x88, 0x42, 0x05, 0x8b,
-  0x45, 0xd8, 0x25, 0xff, 0xff, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x3e, 0xc7,
-  0x45, 0xd8, 0x00, 0x0e, 0x00, 0x00, 0x81, 0xe3, 0xff, 0xff, 0x00, 0x00,
-  0x8d, 0x45, 0xbc, 0x89, 0x5d, 0xd0, 0xe8, 0xed, 0xf9, 0xff, 0xff, 0x8b,
-  0x45, 0xd0, 0x25, 0xff, 0xff, 0x00, 0x00, 0x89, 0x02, 0x8b, 0x45, 0xcc,
-  0xc1, 0xe8, 0x08, 0x25, 0xff, 0x00, 0x00, 0x00, 0x88, 0x42, 0x04, 0x8a,
-  0x45, 0xcc, 0x88, 0x42, 0x05, 0x8b, 0x45, 0xd8, 0x25, 0xff, 0xff, 0x00,
-  0x00, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x56, 0x57, 0x83, 0xec, 0x10, 0x89, 0x45,
-  0xe4, 0x89, 0x55, 0xe0, 0x31, 0xc0, 0x89, 0x45, 0xec, 0x89, 0x45, 0xe8,
-  0x66, 0x8c, 0xd8, 0x66, 0x89, 0x85, 0xec, 0xff, 0xff, 0xff, 0x66, 0x8c,
-  0xc0, 0x66, 0x89, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0x45, 0xec, 0x66,
-  0x3b, 0x45, 0xe8, 0x74, 0x27, 0x0f, 0xb7, 0x45, 0xe8, 0x50, 0x0f, 0xb7,
-  0x45, 0xec, 0x50, 0xff, 0x75, 0xe4, 0xff, 0x75, 0xe0, 0x68, 0xae, 0x06,
-  0x00, 0x00, 0x68, 0x6c, 0x0a, 0x00, 0x00, 0xe8, 0x58, 0xc0, 0xff, 0xff,
-  0x83, 0xc4, 0x18, 0xe8, 0xba, 0x51, 0x00, 0x00, 0x8d, 0x65, 0xf0, 0x5f,
-  0x5e, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x89, 0x45, 0xe8, 0x66, 0xb8,
-  0x00, 0x03, 0x66, 0xbb, 0x67, 0x00, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8,
-  0xff, 0xff, 0xff, 0xcd, 0x31, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0x8b, 0xc0, 0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x31, 0xc0, 0x66, 0xa3, 0x20, 0x0e, 0x00, 0x00, 0x66, 0xa3, 0x18,
-  0x0e, 0x00, 0x00, 0x80, 0x3d, 0x15, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x14,
-  0xb4, 0x42, 0x06, 0xcd, 0x67, 0x07, 0x66, 0x89, 0x1d, 0x20, 0x0e, 0x00,
-  0x00, 0x66, 0x89, 0x15, 0x18, 0x0e, 0x00, 0x00, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x34, 0xba, 0xc7, 0x06, 0x00, 0x00, 0xb8, 0x54, 0x01, 0x00,
-  0x00, 0xe8, 0x16, 0xff, 0xff, 0xff, 0xb8, 0x9e, 0x01, 0x00, 0x00, 0xc6,
-  0x05, 0x15, 0x0e, 0x00, 0x00, 0x00, 0xba, 0xc7, 0x06, 0x00, 0x00, 0x0f,
-  0xb7, 0x18, 0xb8, 0x59, 0x01, 0x00, 0x00, 0xe8, 0xf8, 0xfe, 0xff, 0xff,
-  0x89, 0xda, 0xc1, 0xe2, 0x04, 0xb9, 0x08, 0x00, 0x00, 0x00, 0x83, 0xc2,
-  0x0a, 0x8b, 0x3d, 0x28, 0x0e, 0x00, 0x00, 0x89, 0xd6, 0x33, 0xc0, 0xf3,
-  0xa6, 0x74, 0x05, 0x19, 0xc0, 0x83, 0xd8, 0xff, 0x85, 0xc0, 0x74, 0x23,
-  0xb9, 0x08, 0x00, 0x00, 0x00, 0x8b, 0x3d, 0x2c, 0x0e, 0x00, 0x00, 0x89,
-  0xd6, 0x33, 0xc0, 0xf3, 0xa6, 0x74, 0x05, 0x19, 0xc0, 0x83, 0xd8, 0xff,
-  0x85, 0xc0, 0x74, 0x07, 0x31, 0xc0, 0xe9, 0x10, 0x01, 0x00, 0x00, 0xba,
-  0xc7, 0x06, 0x00, 0x00, 0xb8, 0x60, 0x01, 0x00, 0x00, 0xe8, 0xa2, 0xfe,
-  0xff, 0xff, 0xb0, 0x01, 0xa2, 0x15, 0x0e, 0x00, 0x00, 0xa2, 0x17, 0x0e,
-  0x00, 0x00, 0x31, 0xc0, 0xa3, 0x1c, 0x0e, 0x00, 0x00, 0xb4, 0x40, 0x06,
-  0xcd, 0x67, 0x07, 0x88, 0x25, 0x14, 0x0e, 0x00, 0x00, 0xb4, 0x41, 0x06,
-  0xcd, 0x67, 0x07, 0x0a, 0xe4, 0x0f, 0x85, 0x12, 0x00, 0x00, 0x00, 0x66,
-  0x89, 0x1d, 0x1c, 0x0e, 0x00, 0x00, 0xb4, 0x46, 0x06, 0xcd, 0x67, 0x07,
-  0xa2, 0x16, 0x0e, 0x00, 0x00, 0xba, 0xc7, 0x06, 0x00, 0x00, 0xb8, 0x7b,
-  0x01, 0x00, 0x00, 0xe8, 0x54, 0xfe, 0xff, 0xff, 0xa1, 0x24, 0x0e, 0x00,
-  0x00, 0x85, 0xc0, 0x74, 0x1d, 0x0f, 0xb7, 0x05, 0x30, 0x0e, 0x00, 0x00,
-  0xe8, 0x13, 0xd0, 0xff, 0xff, 0x31, 0xc0, 0x66, 0xa3, 0x30, 0x0e, 0x00,
-  0x00, 0x31, 0xc0, 0xa3, 0x24, 0x0e, 0x00, 0x00, 0xeb, 0x06, 0x0f, 0x85,
-  0x82, 0x00, 0x00, 0x00, 0xba, 0x30, 0x0e, 0x00, 0x00, 0xb8, 0x00, 0x04,
-  0x00, 0x00, 0xe8, 0x69, 0xcf, 0xff, 0xff, 0xa3, 0x24, 0x0e, 0x00, 0x00,
-  0x85, 0xc0, 0x74, 0x6a, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xb8,
-  0xbe, 0xe0, 0x47, 0x00, 0x00, 0x89, 0xc3, 0x31, 0xd2, 0xc1, 0xeb, 0x04,
-  0xf3, 0xa5, 0x66, 0xa5, 0x83, 0xe0, 0x0f, 0xc7, 0x45, 0xd4, 0x00, 0x58,
-  0x00, 0x00, 0x89, 0x45, 0xb8, 0x66, 0x89, 0x5d, 0xda, 0x8d, 0x45, 0xb8,
-  0x66, 0x89, 0x5d, 0xdc, 0xe8, 0x43, 0xfe, 0xff, 0xff, 0xf6, 0x45, 0xd4,
-  0xff, 0x75, 0x09, 0x8b, 0x55, 0xd0, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00,
-  0x85, 0xd2, 0x75, 0x1c, 0x0f, 0xb7, 0x05, 0x30, 0x0e, 0x00, 0x00, 0xe8,
-  0x90, 0xcf, 0xff, 0xff, 0x31, 0xc0, 0x89, 0x15, 0x24, 0x0e, 0x00, 0x00,
-  0x66, 0xa3, 0x30, 0x0e, 0x00, 0x00, 0xeb, 0x06, 0x88, 0x15, 0x17, 0x0e,
-  0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89, 0x45, 0xe4, 0xc7, 0x45,
-  0xe8, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3d, 0x15, 0x0e, 0x00, 0x00, 0x00,
-  0x74, 0x20, 0xb4, 0x43, 0x8b, 0x9d, 0xe4, 0xff, 0xff, 0xff, 0x06, 0xcd,
-  0x67, 0x07, 0x0a, 0xe4, 0x0f, 0x85, 0x0c, 0x00, 0x00, 0x00, 0x81, 0xe2,
-  0xff, 0xff, 0x00, 0x00, 0x89, 0x95, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0x45,
-  0xe8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x89,
-  0x45, 0xe4, 0x31, 0xc0, 0x89, 0x45, 0xe8, 0x80, 0x3d, 0x15, 0x0e, 0x00,
-  0x00, 0x00, 0x74, 0x1e, 0xb4, 0x45, 0x8b, 0x95, 0xe4, 0xff, 0xff, 0xff,
-  0x06, 0xcd, 0x67, 0x07, 0x0a, 0xe4, 0x0f, 0x85, 0x0a, 0x00, 0x00, 0x00,
-  0xc7, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x45,
-  0xe8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec, 0x10, 0x89, 0x45, 0xe4,
-  0x89, 0x55, 0xe8, 0x89, 0x5d, 0xec, 0x31, 0xc0, 0x89, 0x45, 0xf0, 0x0f,
-  0xb6, 0x05, 0x17, 0x0e, 0x00, 0x00, 0x3b, 0x45, 0xe8, 0x77, 0x04, 0x31,
-  0xc0, 0xeb, 0x36, 0x80, 0x3d, 0x15, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x2a,
-  0xb4, 0x44, 0x8a, 0x85, 0xe8, 0xff, 0xff, 0xff, 0x8b, 0x9d, 0xec, 0xff,
-  0xff, 0xff, 0x8b, 0x95, 0xe4, 0xff, 0xff, 0xff, 0x06, 0xcd, 0x67, 0x07,
-  0x0a, 0xe4, 0x0f, 0x85, 0x0a, 0x00, 0x00, 0x00, 0xc7, 0x85, 0xf0, 0xff,
-  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xf0, 0x8d, 0x65, 0xf4,
-  0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56,
-  0x89, 0xc6, 0x0f, 0xb6, 0x05, 0x17, 0x0e, 0x00, 0x00, 0x39, 0xc6, 0x73,
-  0x48, 0x85, 0xf6, 0x75, 0x14, 0x83, 0x3d, 0x24, 0x0e, 0x00, 0x00, 0x00,
-  0x75, 0x0b, 0x66, 0xa1, 0x1c, 0x0e, 0x00, 0x00, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x31, 0xc9, 0x31, 0xd2, 0x0f, 0xb6, 0x05, 0x17, 0x0e, 0x00, 0x00,
-  0x39, 0xc1, 0x73, 0x21, 0xa1, 0x24, 0x0e, 0x00, 0x00, 0x85, 0xc0, 0x74,
-  0x18, 0x01, 0xd0, 0x0f, 0xb7, 0x58, 0x02, 0x39, 0xde, 0x75, 0x08, 0x66,
-  0x8b, 0x00, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x83, 0xc2, 0x04, 0x41, 0xeb,
-  0xd4, 0x31, 0xc0, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x51, 0x52, 0xba, 0xcc, 0x03, 0x00, 0x00, 0xfa,
-  0x2b, 0xc0, 0xec, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x89, 0xc1, 0x30, 0xc0,
-  0xee, 0xba, 0xcc, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xa8, 0xef, 0x74,
-  0x0d, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x88, 0xc8, 0xee, 0x31, 0xc0, 0x5a,
-  0x59, 0xc3, 0xb0, 0xef, 0xba, 0xc2, 0x03, 0x00, 0x00, 0xee, 0xba, 0xcc,
-  0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x25, 0xef, 0x00, 0x00, 0x00, 0x3d,
-  0xef, 0x00, 0x00, 0x00, 0x74, 0x0d, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x88,
-  0xc8, 0xee, 0x31, 0xc0, 0x5a, 0x59, 0xc3, 0xba, 0xc2, 0x03, 0x00, 0x00,
-  0x88, 0xc8, 0xee, 0xfb, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x5a, 0x59, 0xc3,
-  0x53, 0x51, 0x52, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x0f, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05,
-  0x2b, 0xc0, 0xec, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x0f, 0xb6, 0xc8,
-  0xb0, 0x0e, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x08,
-  0x0f, 0xb6, 0x1d, 0x60, 0x0e, 0x00, 0x00, 0x09, 0xc1, 0x31, 0xd2, 0x89,
-  0xc8, 0xf7, 0xf3, 0x88, 0x15, 0x44, 0x0e, 0x00, 0x00, 0x89, 0xc8, 0x31,
-  0xd2, 0xf7, 0xf3, 0xa2, 0x45, 0x0e, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3,
-  0x52, 0xb8, 0x50, 0x04, 0x00, 0x00, 0x8a, 0x15, 0x44, 0x0e, 0x00, 0x00,
-  0x88, 0x10, 0x8a, 0x15, 0x45, 0x0e, 0x00, 0x00, 0xb8, 0x51, 0x04, 0x00,
-  0x00, 0x88, 0x10, 0x5a, 0xc3, 0x8d, 0x40, 0x00, 0x6f, 0x4d, 0x00, 0x00,
-  0x85, 0x4d, 0x00, 0x00, 0x9b, 0x4d, 0x00, 0x00, 0xa7, 0x4d, 0x00, 0x00,
-  0x52, 0x3c, 0x03, 0x77, 0x56, 0x0f, 0xb6, 0xc0, 0xff, 0x24, 0x85, 0x50,
-  0x4d, 0x00, 0x00, 0xc7, 0x05, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xc7, 0x05, 0x5c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb,
-  0x36, 0xc7, 0x05, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xc7,
-  0x05, 0x5c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xeb, 0x20, 0xc7,
-  0x05, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0xeb, 0x0a, 0xc7,
-  0x05, 0x58, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0xc7, 0x05, 0x5c,
-  0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xa1, 0x58, 0x0e, 0x00, 0x00,
-  0x8b, 0x15, 0x5c, 0x0e, 0x00, 0x00, 0xa3, 0x34, 0x0e, 0x00, 0x00, 0x01,
-  0xc2, 0xa3, 0x3c, 0x0e, 0x00, 0x00, 0x89, 0x15, 0x38, 0x0e, 0x00, 0x00,
-  0x89, 0x15, 0x40, 0x0e, 0x00, 0x00, 0x5a, 0xc3, 0x53, 0x51, 0x52, 0x88,
-  0xc1, 0x88, 0xc5, 0xa0, 0x62, 0x0e, 0x00, 0x00, 0xc0, 0xe5, 0x02, 0xa8,
-  0x10, 0x74, 0x29, 0xb0, 0x06, 0xba, 0xce, 0x03, 0x00, 0x00, 0xee, 0xba,
-  0xcf, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0x80, 0xe4, 0xf3,
-  0x08, 0xec, 0xba, 0xce, 0x03, 0x00, 0x00, 0xb0, 0x06, 0xee, 0xba, 0xcf,
-  0x03, 0x00, 0x00, 0x88, 0xe0, 0xee, 0xeb, 0x1f, 0xa8, 0x20, 0x74, 0x23,
-  0x66, 0xb8, 0x00, 0x0f, 0xcd, 0x10, 0x88, 0xec, 0x80, 0xcc, 0x02, 0xba,
-  0xce, 0x03, 0x00, 0x00, 0xb0, 0x06, 0xee, 0xba, 0xcf, 0x03, 0x00, 0x00,
-  0x88, 0xe0, 0xee, 0x0f, 0xb6, 0xc1, 0xe8, 0x1d, 0xff, 0xff, 0xff, 0x5a,
-  0x59, 0x5b, 0xc3, 0x90, 0x53, 0x51, 0x52, 0xc6, 0x05, 0x60, 0x0e, 0x00,
-  0x00, 0x50, 0x30, 0xc0, 0xc6, 0x05, 0x48, 0x0e, 0x00, 0x00, 0x19, 0xa2,
-  0x45, 0x0e, 0x00, 0x00, 0xa2, 0x44, 0x0e, 0x00, 0x00, 0xa2, 0x64, 0x0e,
-  0x00, 0x00, 0xa0, 0x62, 0x0e, 0x00, 0x00, 0xc6, 0x05, 0x47, 0x0e, 0x00,
-  0x00, 0x50, 0xa8, 0x10, 0x0f, 0x84, 0xa3, 0x00, 0x00, 0x00, 0xba, 0xcc,
-  0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xa8, 0x01, 0x74, 0x0c, 0xc7, 0x05,
-  0x54, 0x0e, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xeb, 0x0a, 0xc7, 0x05,
-  0x54, 0x0e, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xb0, 0x06, 0xba, 0xce,
-  0x03, 0x00, 0x00, 0xee, 0xba, 0xcf, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x0f, 0x94, 0xc0, 0xa2, 0x50, 0x0e, 0x00, 0x00,
-  0x0f, 0xb6, 0xc4, 0xc1, 0xf8, 0x02, 0x83, 0xe0, 0x03, 0x0f, 0xb6, 0xc0,
-  0xba, 0xc4, 0x03, 0x00, 0x00, 0xe8, 0x8e, 0xfe, 0xff, 0xff, 0xb0, 0x01,
-  0xee, 0xba, 0xc5, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xa8, 0x01, 0x0f,
-  0x94, 0xc0, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xa2, 0x64, 0x0e, 0x00,
-  0x00, 0x83, 0xc2, 0x04, 0xb0, 0x13, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x00, 0xc0, 0xa2, 0x60, 0x0e,
-  0x00, 0x00, 0x80, 0x3d, 0x50, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xb6,
-  0x01, 0x00, 0x00, 0xa2, 0x47, 0x0e, 0x00, 0x00, 0xe8, 0xb3, 0xfd, 0xff,
-  0xff, 0x5a, 0x59, 0x5b, 0xc3, 0xa8, 0x20, 0x0f, 0x84, 0xcc, 0x00, 0x00,
-  0x00, 0xb8, 0x63, 0x04, 0x00, 0x00, 0x8a, 0x00, 0x24, 0xf0, 0x3c, 0xd0,
-  0x74, 0x10, 0x3c, 0xb0, 0x75, 0x0c, 0xc7, 0x05, 0x54, 0x0e, 0x00, 0x00,
-  0xb0, 0x03, 0x00, 0x00, 0xeb, 0x0a, 0xc7, 0x05, 0x54, 0x0e, 0x00, 0x00,
-  0xd0, 0x03, 0x00, 0x00, 0x66, 0xb8, 0x00, 0x0f, 0xcd, 0x10, 0x3c, 0x04,
-  0x72, 0x08, 0x3c, 0x06, 0x76, 0x25, 0x3c, 0x07, 0x77, 0x28, 0xc6, 0x05,
-  0x50, 0x0e, 0x00, 0x00, 0x01, 0x81, 0x3d, 0x54, 0x0e, 0x00, 0x00, 0xb0,
-  0x03, 0x00, 0x00, 0x75, 0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x1a,
-  0xb8, 0x03, 0x00, 0x00, 0x00, 0xeb, 0x13, 0xb8, 0x03, 0x00, 0x00, 0x00,
-  0xeb, 0x05, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc6, 0x05, 0x50, 0x0e, 0x00,
-  0x00, 0x00, 0xe8, 0xc5, 0xfd, 0xff, 0xff, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xb0, 0x13, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x00, 0xc0, 0xa2, 0x60, 0x0e,
-  0x00, 0x00, 0x80, 0x3d, 0x50, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x0a, 0xa2,
-  0x47, 0x0e, 0x00, 0x00, 0xe8, 0x03, 0xfd, 0xff, 0xff, 0xa1, 0x58, 0x0e,
-  0x00, 0x00, 0x8b, 0x15, 0x5c, 0x0e, 0x00, 0x00, 0xa3, 0x34, 0x0e, 0x00,
-  0x00, 0x8d, 0x0c, 0x10, 0x89, 0x0d, 0x38, 0x0e, 0x00, 0x00, 0xa3, 0x3c,
-  0x0e, 0x00, 0x00, 0x89, 0x0d, 0x40, 0x0e, 0x00, 0x00, 0x5a, 0x59, 0x5b,
-  0xc3, 0xa8, 0x40, 0x0f, 0x84, 0x7b, 0x00, 0x00, 0x00, 0xc7, 0x05, 0x54,
-  0x0e, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x66, 0xb8, 0x00, 0x0f, 0xcd,
-  0x10, 0x88, 0xc4, 0x3c, 0x07, 0x74, 0x04, 0x3c, 0x03, 0x77, 0x09, 0xc6,
-  0x05, 0x50, 0x0e, 0x00, 0x00, 0x01, 0xeb, 0x07, 0xc6, 0x05, 0x50, 0x0e,
-  0x00, 0x00, 0x00, 0x80, 0xfc, 0x01, 0x77, 0x0c, 0xb0, 0x28, 0xa2, 0x60,
-  0x0e, 0x00, 0x00, 0xa2, 0x47, 0x0e, 0x00, 0x00, 0xc7, 0x05, 0x58, 0x0e,
-  0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0xc7, 0x05, 0x5c, 0x0e, 0x00, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0xc7, 0x05, 0x34, 0x0e, 0x00, 0x00, 0x00, 0x80,
-  0x0b, 0x00, 0xc7, 0x05, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0xc7, 0x05, 0x3c, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0xc7, 0x05,
-  0x40, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x5a, 0x59, 0x5b, 0xc3,
-  0xa8, 0x80, 0x74, 0x4d, 0xc7, 0x05, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x03,
-  0x00, 0x00, 0xc6, 0x05, 0x50, 0x0e, 0x00, 0x00, 0x01, 0xc7, 0x05, 0x58,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0xc7, 0x05, 0x5c, 0x0e, 0x00,
-  0x00, 0x00, 0x80, 0x00, 0x00, 0xc7, 0x05, 0x34, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x0b, 0x00, 0xc7, 0x05, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x0b,
-  0x00, 0xc7, 0x05, 0x3c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0xc7,
-  0x05, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x5c, 0xb9, 0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xac, 0xbe,
-  0xe0, 0x4b, 0x00, 0x00, 0x31, 0xc0, 0xf3, 0xa5, 0x8d, 0x5d, 0xac, 0x66,
-  0xa3, 0x62, 0x0e, 0x00, 0x00, 0x31, 0xc0, 0x8d, 0x55, 0xac, 0xa3, 0x54,
-  0x0e, 0x00, 0x00, 0xb8, 0x10, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xac,
-  0x00, 0x1a, 0xe8, 0x31, 0x4b, 0x00, 0x00, 0x80, 0x7d, 0xac, 0x1a, 0x0f,
-  0x85, 0x52, 0x00, 0x00, 0x00, 0x8a, 0x45, 0xb0, 0x3c, 0x01, 0x75, 0x09,
-  0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00, 0x80, 0xeb, 0x42, 0x3c, 0x02, 0x75,
-  0x09, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00, 0x40, 0xeb, 0x35, 0x3c, 0x04,
-  0x74, 0x04, 0x3c, 0x05, 0x75, 0x09, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00,
-  0x60, 0xeb, 0x24, 0x3c, 0x07, 0x74, 0x04, 0x3c, 0x08, 0x75, 0x09, 0x80,
-  0x0d, 0x62, 0x0e, 0x00, 0x00, 0x70, 0xeb, 0x13, 0x3c, 0x0a, 0x74, 0x08,
-  0x3c, 0x0b, 0x74, 0x04, 0x3c, 0x0c, 0x75, 0x07, 0x80, 0x0d, 0x62, 0x0e,
-  0x00, 0x00, 0x48, 0x66, 0x83, 0x3d, 0x62, 0x0e, 0x00, 0x00, 0x00, 0x75,
-  0x29, 0x66, 0xc7, 0x45, 0xac, 0x00, 0x12, 0x8d, 0x5d, 0xac, 0x8d, 0x55,
-  0xac, 0xb8, 0x10, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xb0, 0x10, 0xff,
-  0xe8, 0xaf, 0x4a, 0x00, 0x00, 0x80, 0x7d, 0xb1, 0xff, 0x74, 0x07, 0x80,
-  0x0d, 0x62, 0x0e, 0x00, 0x00, 0x60, 0x66, 0x83, 0x3d, 0x62, 0x0e, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xc1, 0x00, 0x00, 0x00, 0xb0, 0x0f, 0xba, 0xd4,
-  0x03, 0x00, 0x00, 0xee, 0xba, 0xd5, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc3, 0xb0, 0xaa, 0xb9, 0xe8, 0x03, 0x00, 0x00, 0xee, 0xba, 0xd5,
-  0x03, 0x00, 0x00, 0x49, 0x74, 0x0a, 0x2b, 0xc0, 0xec, 0x88, 0x45, 0xe4,
-  0x3c, 0xaa, 0x75, 0xf3, 0xba, 0xd5, 0x03, 0x00, 0x00, 0x88, 0xd8, 0xee,
-  0x80, 0x7d, 0xe4, 0xaa, 0x0f, 0x85, 0x83, 0x00, 0x00, 0x00, 0xb9, 0x07,
-  0x00, 0x00, 0x00, 0x8d, 0x7d, 0x90, 0x8d, 0x5d, 0x90, 0xbe, 0xfc, 0x4b,
-  0x00, 0x00, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00, 0x40, 0x8d, 0x55, 0x90,
-  0xf3, 0xa5, 0xb8, 0x1a, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0x90, 0x00,
-  0x81, 0xe8, 0x2a, 0x4a, 0x00, 0x00, 0xf6, 0x45, 0x90, 0x80, 0x74, 0x0d,
-  0xf6, 0x45, 0xa8, 0x01, 0x75, 0x07, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00,
-  0x02, 0xb9, 0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xc8, 0xbe, 0x18, 0x4c,
-  0x00, 0x00, 0x31, 0xc0, 0xf3, 0xa5, 0x8d, 0x5d, 0xc8, 0x66, 0x89, 0x45,
-  0xcc, 0x31, 0xc0, 0x8d, 0x55, 0xc8, 0x89, 0x45, 0xe0, 0xb8, 0x15, 0x00,
-  0x00, 0x00, 0x66, 0xc7, 0x45, 0xc8, 0x00, 0x06, 0xe8, 0xe7, 0x49, 0x00,
-  0x00, 0x66, 0x83, 0x7d, 0xcc, 0x00, 0x74, 0x0d, 0xf6, 0x45, 0xe0, 0x01,
-  0x75, 0x07, 0x80, 0x0d, 0x63, 0x0e, 0x00, 0x00, 0x01, 0x66, 0x83, 0x3d,
-  0x62, 0x0e, 0x00, 0x00, 0x00, 0x75, 0x41, 0xb0, 0x0f, 0xba, 0xb4, 0x03,
-  0x00, 0x00, 0xee, 0xba, 0xb5, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc3, 0xb0, 0xaa, 0xb9, 0xe8, 0x03, 0x00, 0x00, 0xee, 0xba, 0xb5, 0x03,
-  0x00, 0x00, 0x49, 0x74, 0x0a, 0x2b, 0xc0, 0xec, 0x88, 0x45, 0xe4, 0x3c,
-  0xaa, 0x75, 0xf3, 0xba, 0xb5, 0x03, 0x00, 0x00, 0x88, 0xd8, 0xee, 0x80,
-  0x7d, 0xe4, 0xaa, 0x75, 0x07, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00, 0x80,
-  0xf6, 0x05, 0x62, 0x0e, 0x00, 0x00, 0x80, 0x0f, 0x84, 0x9a, 0x00, 0x00,
-  0x00, 0xba, 0xba, 0x03, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x31, 0xf6, 0x88, 0xc3, 0x49, 0x74, 0x40, 0xba, 0xba, 0x03,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc6, 0x80, 0xe6, 0x80, 0x88, 0xda,
-  0x80, 0xe2, 0x80, 0x88, 0x45, 0xe8, 0x38, 0xd6, 0x75, 0x27, 0x0f, 0xb6,
-  0xd0, 0x0f, 0xb6, 0xfb, 0x31, 0xfa, 0xf6, 0xc2, 0x01, 0x74, 0x10, 0x80,
-  0xf3, 0x01, 0xa8, 0x01, 0x74, 0x09, 0x46, 0x81, 0xfe, 0x58, 0x02, 0x00,
-  0x00, 0x73, 0x0a, 0xba, 0x80, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xeb,
-  0xbd, 0x85, 0xc9, 0x76, 0x42, 0x0f, 0xb6, 0x45, 0xe8, 0x0f, 0xb6, 0xd3,
-  0x31, 0xc2, 0xf6, 0xc2, 0x80, 0x74, 0x34, 0xc1, 0xf8, 0x04, 0x83, 0xe0,
-  0x07, 0x80, 0x0d, 0x62, 0x0e, 0x00, 0x00, 0x04, 0xa2, 0x51, 0x0e, 0x00,
-  0x00, 0x83, 0xf8, 0x05, 0x74, 0x05, 0x83, 0xf8, 0x01, 0x75, 0x11, 0x0f,
-  0xb6, 0x45, 0xe8, 0xc1, 0xf8, 0x04, 0x83, 0xe0, 0x07, 0xa2, 0x51, 0x0e,
-  0x00, 0x00, 0xeb, 0x07, 0xc6, 0x05, 0x51, 0x0e, 0x00, 0x00, 0x00, 0xe8,
-  0xe4, 0xfa, 0xff, 0xff, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x51,
-  0x52, 0x81, 0xec, 0x80, 0x00, 0x00, 0x00, 0x89, 0xc1, 0xf6, 0x05, 0x63,
-  0x0e, 0x00, 0x00, 0x01, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x50, 0xf6,
-  0x05, 0x62, 0x0e, 0x00, 0x00, 0x02, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0,
-  0x50, 0x0f, 0xb6, 0x05, 0x51, 0x0e, 0x00, 0x00, 0x50, 0xf6, 0x05, 0x62,
-  0x0e, 0x00, 0x00, 0x04, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x50, 0xf6,
-  0x05, 0x62, 0x0e, 0x00, 0x00, 0x08, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0,
-  0x50, 0xf6, 0x05, 0x62, 0x0e, 0x00, 0x00, 0x80, 0x0f, 0x95, 0xc0, 0x0f,
-  0xb6, 0xc0, 0x50, 0xf6, 0x05, 0x62, 0x0e, 0x00, 0x00, 0x40, 0x0f, 0x95,
-  0xc0, 0x0f, 0xb6, 0xc0, 0x50, 0xf6, 0x05, 0x62, 0x0e, 0x00, 0x00, 0x20,
-  0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x50, 0xf6, 0x05, 0x62, 0x0e, 0x00,
-  0x00, 0x10, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x50, 0x68, 0xd0, 0x06,
-  0x00, 0x00, 0x8d, 0x85, 0x78, 0xff, 0xff, 0xff, 0x50, 0xe8, 0xc6, 0x45,
-  0x00, 0x00, 0x83, 0xc4, 0x2c, 0x85, 0xc9, 0x75, 0x0d, 0x8d, 0x85, 0x78,
-  0xff, 0xff, 0xff, 0xe8, 0x84, 0x03, 0x00, 0x00, 0xeb, 0x0d, 0x8d, 0x85,
-  0x78, 0xff, 0xff, 0xff, 0x89, 0xca, 0xe8, 0x25, 0x4c, 0x00, 0x00, 0x0f,
-  0xb6, 0x05, 0x64, 0x0e, 0x00, 0x00, 0x50, 0x0f, 0xb6, 0x05, 0x50, 0x0e,
-  0x00, 0x00, 0x50, 0xa1, 0x58, 0x0e, 0x00, 0x00, 0x03, 0x05, 0x5c, 0x0e,
-  0x00, 0x00, 0x48, 0x50, 0xff, 0x35, 0x58, 0x0e, 0x00, 0x00, 0xff, 0x35,
-  0x54, 0x0e, 0x00, 0x00, 0x68, 0x19, 0x07, 0x00, 0x00, 0x8d, 0x85, 0x78,
-  0xff, 0xff, 0xff, 0x50, 0xe8, 0x6b, 0x45, 0x00, 0x00, 0x83, 0xc4, 0x1c,
-  0x85, 0xc9, 0x75, 0x0d, 0x8d, 0x85, 0x78, 0xff, 0xff, 0xff, 0xe8, 0x29,
-  0x03, 0x00, 0x00, 0xeb, 0x0d, 0x8d, 0x85, 0x78, 0xff, 0xff, 0xff, 0x89,
-  0xca, 0xe8, 0xca, 0x4b, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5a, 0x59, 0x5d,
-  0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x53, 0x52, 0x83, 0xec, 0x04,
-  0x88, 0xc3, 0xa0, 0x62, 0x0e, 0x00, 0x00, 0xa8, 0x10, 0x74, 0x1e, 0xba,
-  0xcc, 0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x24, 0xfe, 0x0f, 0xb6, 0xc0,
-  0x89, 0x45, 0xf4, 0x0f, 0xb6, 0xc3, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x0b,
-  0x45, 0xf4, 0xee, 0xeb, 0x0e, 0xa8, 0x20, 0x74, 0x0a, 0x88, 0xd8, 0xba,
-  0xc2, 0x03, 0x00, 0x00, 0x0c, 0x02, 0xee, 0x84, 0xdb, 0x74, 0x07, 0xb8,
-  0xd0, 0x03, 0x00, 0x00, 0xeb, 0x05, 0xb8, 0xb0, 0x03, 0x00, 0x00, 0xa3,
-  0x54, 0x0e, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5a, 0x5b, 0x5d, 0xc3, 0x90,
-  0x52, 0xa0, 0x62, 0x0e, 0x00, 0x00, 0xa8, 0x10, 0x74, 0x3a, 0xba, 0xcc,
-  0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x24,
-  0xfe, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0x00, 0x00, 0xee, 0xba, 0xcf,
-  0x03, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0x80, 0xe4, 0xf3, 0x80,
-  0xcc, 0x08, 0xba, 0xce, 0x03, 0x00, 0x00, 0xb0, 0x06, 0xee, 0xba, 0xcf,
-  0x03, 0x00, 0x00, 0x88, 0xe0, 0xee, 0xeb, 0x1c, 0xa8, 0x20, 0x74, 0x28,
-  0xb0, 0x02, 0xba, 0xc2, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x06, 0xba, 0xce,
-  0x03, 0x00, 0x00, 0xee, 0xb0, 0x0a, 0xba, 0xcf, 0x03, 0x00, 0x00, 0xee,
-  0xb8, 0x63, 0x04, 0x00, 0x00, 0xc6, 0x00, 0xb4, 0xb8, 0x10, 0x04, 0x00,
-  0x00, 0x80, 0x08, 0x30, 0x5a, 0xc3, 0x8b, 0xc0, 0x52, 0xa0, 0x62, 0x0e,
-  0x00, 0x00, 0xa8, 0x10, 0x74, 0x3a, 0xba, 0xcc, 0x03, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0xba, 0xc2, 0x03, 0x00, 0x00, 0x0c, 0x01, 0xee, 0xb0, 0x06,
-  0xba, 0xce, 0x03, 0x00, 0x00, 0xee, 0xba, 0xcf, 0x03, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0x80, 0xe4, 0xf3, 0x80, 0xcc, 0x0c, 0xba, 0xce,
-  0x03, 0x00, 0x00, 0xb0, 0x06, 0xee, 0xba, 0xcf, 0x03, 0x00, 0x00, 0x88,
-  0xe0, 0xee, 0xeb, 0x1c, 0xa8, 0x20, 0x74, 0x2b, 0xb0, 0x03, 0xba, 0xc2,
-  0x03, 0x00, 0x00, 0xee, 0xb0, 0x06, 0xba, 0xce, 0x03, 0x00, 0x00, 0xee,
-  0xb0, 0x0e, 0xba, 0xcf, 0x03, 0x00, 0x00, 0xee, 0xb8, 0x63, 0x04, 0x00,
-  0x00, 0xc6, 0x00, 0xd4, 0xb8, 0x10, 0x04, 0x00, 0x00, 0x80, 0x20, 0x10,
-  0x80, 0x08, 0x20, 0x5a, 0xc3, 0x8d, 0x40, 0x00, 0xa2, 0x44, 0x0e, 0x00,
-  0x00, 0x88, 0x15, 0x45, 0x0e, 0x00, 0x00, 0xc3, 0xfe, 0x05, 0x45, 0x0e,
-  0x00, 0x00, 0xa0, 0x45, 0x0e, 0x00, 0x00, 0x3a, 0x05, 0x48, 0x0e, 0x00,
-  0x00, 0x0f, 0x82, 0xf6, 0x00, 0x00, 0x00, 0xa0, 0x48, 0x0e, 0x00, 0x00,
-  0xfe, 0xc8, 0xa2, 0x45, 0x0e, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x83, 0xec, 0x08, 0x88, 0x44, 0x24, 0x04, 0x84, 0xc0,
-  0x0f, 0x84, 0xcd, 0x00, 0x00, 0x00, 0x3a, 0x05, 0x48, 0x0e, 0x00, 0x00,
-  0x76, 0x09, 0xa0, 0x48, 0x0e, 0x00, 0x00, 0x88, 0x44, 0x24, 0x04, 0x8a,
-  0x44, 0x24, 0x04, 0x3a, 0x05, 0x48, 0x0e, 0x00, 0x00, 0x73, 0x54, 0x0f,
-  0xb6, 0x4c, 0x24, 0x04, 0x0f, 0xb6, 0x15, 0x60, 0x0e, 0x00, 0x00, 0x0f,
-  0xaf, 0xd1, 0xa0, 0x48, 0x0e, 0x00, 0x00, 0x2a, 0x44, 0x24, 0x04, 0x88,
-  0x04, 0x24, 0xa1, 0x3c, 0x0e, 0x00, 0x00, 0x01, 0xd2, 0x30, 0xff, 0x01,
-  0xc2, 0x80, 0x3c, 0x24, 0x00, 0x76, 0x28, 0x30, 0xdb, 0x80, 0x3d, 0x60,
-  0x0e, 0x00, 0x00, 0x00, 0x76, 0x16, 0x66, 0x8b, 0x0a, 0x83, 0xc2, 0x02,
-  0xfe, 0xc3, 0x66, 0x89, 0x08, 0x83, 0xc0, 0x02, 0x3a, 0x1d, 0x60, 0x0e,
-  0x00, 0x00, 0x72, 0xea, 0xfe, 0xc7, 0x3a, 0x3c, 0x24, 0x72, 0xd8, 0x0f,
-  0xb6, 0x44, 0x24, 0x04, 0x0f, 0xb6, 0x15, 0x48, 0x0e, 0x00, 0x00, 0x29,
-  0xc2, 0x0f, 0xb6, 0x05, 0x60, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xc2, 0x8b,
-  0x15, 0x3c, 0x0e, 0x00, 0x00, 0x01, 0xc0, 0x01, 0xd0, 0x30, 0xf6, 0x80,
-  0x7c, 0x24, 0x04, 0x00, 0x76, 0x31, 0x30, 0xd2, 0x80, 0x3d, 0x60, 0x0e,
-  0x00, 0x00, 0x00, 0x76, 0x1e, 0x66, 0x0f, 0xb6, 0x0d, 0x46, 0x0e, 0x00,
-  0x00, 0xc1, 0xe1, 0x08, 0x80, 0xc9, 0x20, 0xfe, 0xc2, 0x66, 0x89, 0x08,
-  0x83, 0xc0, 0x02, 0x3a, 0x15, 0x60, 0x0e, 0x00, 0x00, 0x72, 0xe2, 0xfe,
-  0xc6, 0x3a, 0x74, 0x24, 0x04, 0x72, 0xcf, 0x83, 0xc4, 0x08, 0x5a, 0x59,
-  0x5b, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x52, 0x83, 0xec, 0x04, 0x88,
-  0xc2, 0x3c, 0x0a, 0x75, 0x11, 0xc6, 0x05, 0x44, 0x0e, 0x00, 0x00, 0x00,
-  0xe8, 0xd7, 0xfe, 0xff, 0xff, 0xe9, 0x87, 0x00, 0x00, 0x00, 0x3c, 0x09,
-  0x75, 0x28, 0xa0, 0x44, 0x0e, 0x00, 0x00, 0x0c, 0x07, 0xfe, 0xc0, 0xa2,
-  0x44, 0x0e, 0x00, 0x00, 0x3a, 0x05, 0x47, 0x0e, 0x00, 0x00, 0x72, 0x6d,
-  0xc6, 0x05, 0x44, 0x0e, 0x00, 0x00, 0x00, 0xe8, 0xac, 0xfe, 0xff, 0xff,
-  0x8d, 0x65, 0xfc, 0x5a, 0x5d, 0xc3, 0xa0, 0x44, 0x0e, 0x00, 0x00, 0x3a,
-  0x05, 0x47, 0x0e, 0x00, 0x00, 0x72, 0x0c, 0xc6, 0x05, 0x44, 0x0e, 0x00,
-  0x00, 0x00, 0xe8, 0x8d, 0xfe, 0xff, 0xff, 0x66, 0x0f, 0xb6, 0x05, 0x46,
-  0x0e, 0x00, 0x00, 0x30, 0xf6, 0xc1, 0xe0, 0x08, 0x09, 0xc2, 0x0f, 0xb6,
-  0x05, 0x45, 0x0e, 0x00, 0x00, 0x89, 0x55, 0xf8, 0x0f, 0xb6, 0x15, 0x60,
-  0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xd0, 0x0f, 0xb6, 0x05, 0x44, 0x0e, 0x00,
-  0x00, 0x01, 0xd0, 0x8b, 0x15, 0x3c, 0x0e, 0x00, 0x00, 0x01, 0xc0, 0x01,
-  0xd0, 0x8b, 0x55, 0xf8, 0x66, 0x89, 0x10, 0xfe, 0x05, 0x44, 0x0e, 0x00,
-  0x00, 0x8d, 0x65, 0xfc, 0x5a, 0x5d, 0xc3, 0x90, 0x52, 0x89, 0xc2, 0x80,
-  0x38, 0x00, 0x74, 0x0e, 0x0f, 0xb6, 0x02, 0x42, 0xe8, 0x43, 0xff, 0xff,
-  0xff, 0x80, 0x3a, 0x00, 0x75, 0xf2, 0x5a, 0xc3, 0x51, 0x52, 0x80, 0x3d,
-  0x50, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x51, 0x0f, 0xb6, 0x15, 0x45, 0x0e,
-  0x00, 0x00, 0x0f, 0xb6, 0x0d, 0x60, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xd1,
-  0x0f, 0xb6, 0x0d, 0x44, 0x0e, 0x00, 0x00, 0x01, 0xd1, 0x89, 0xca, 0xc1,
-  0xea, 0x08, 0x88, 0xd5, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x0e,
-  0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe8,
-  0x83, 0xc2, 0x05, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x0f,
-  0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xc8,
-  0x83, 0xc2, 0x05, 0xee, 0x5a, 0x59, 0xc3, 0x90, 0x52, 0xa1, 0x3c, 0x0e,
-  0x00, 0x00, 0x30, 0xf6, 0x80, 0x3d, 0x48, 0x0e, 0x00, 0x00, 0x00, 0x76,
-  0x27, 0x30, 0xd2, 0x80, 0x3d, 0x60, 0x0e, 0x00, 0x00, 0x00, 0x76, 0x12,
-  0xfe, 0xc2, 0x66, 0xc7, 0x00, 0x20, 0x07, 0x83, 0xc0, 0x02, 0x3a, 0x15,
-  0x60, 0x0e, 0x00, 0x00, 0x72, 0xee, 0xfe, 0xc6, 0x3a, 0x35, 0x48, 0x0e,
-  0x00, 0x00, 0x72, 0xd9, 0x5a, 0xc3, 0x8b, 0xc0, 0x52, 0xba, 0xb8, 0x03,
-  0x00, 0x00, 0x30, 0xc0, 0xee, 0xb0, 0x01, 0xba, 0xbf, 0x03, 0x00, 0x00,
-  0xee, 0xb0, 0x02, 0xba, 0xb8, 0x03, 0x00, 0x00, 0xee, 0x30, 0xe4, 0x90,
-  0xba, 0xb4, 0x03, 0x00, 0x00, 0x88, 0xe0, 0xee, 0x0f, 0xb6, 0xd4, 0x8a,
-  0x82, 0x78, 0x0e, 0x00, 0x00, 0xba, 0xb5, 0x03, 0x00, 0x00, 0xee, 0xfe,
-  0xc4, 0x80, 0xfc, 0x0c, 0x72, 0xe2, 0xb0, 0x0a, 0xba, 0xb8, 0x03, 0x00,
-  0x00, 0xee, 0x5a, 0xc3, 0x52, 0xba, 0xb8, 0x03, 0x00, 0x00, 0x30, 0xc0,
-  0xee, 0xba, 0xbf, 0x03, 0x00, 0x00, 0xee, 0x30, 0xe4, 0x8d, 0x40, 0x00,
-  0xba, 0xb4, 0x03, 0x00, 0x00, 0x88, 0xe0, 0xee, 0x0f, 0xb6, 0xd4, 0x8a,
-  0x82, 0x84, 0x0e, 0x00, 0x00, 0xba, 0xb5, 0x03, 0x00, 0x00, 0xee, 0xfe,
-  0xc4, 0x80, 0xfc, 0x0c, 0x72, 0xe2, 0xb0, 0x28, 0xba, 0xb8, 0x03, 0x00,
-  0x00, 0xee, 0x5a, 0xc3, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x04, 0x0f, 0xb6,
-  0xc0, 0xc1, 0xe0, 0x05, 0x89, 0x45, 0xfc, 0x0f, 0xb6, 0xc2, 0xba, 0xd9,
-  0x03, 0x00, 0x00, 0x0b, 0x45, 0xfc, 0xee, 0x89, 0xec, 0x5d, 0xc3, 0x90,
-  0x52, 0xba, 0xd8, 0x03, 0x00, 0x00, 0xee, 0x5a, 0xc3, 0x8d, 0x40, 0x00,
-  0x53, 0x88, 0xc7, 0x88, 0xd3, 0xba, 0xda, 0x03, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x0f, 0xb6, 0xc7, 0x83, 0xc0, 0x10, 0xee, 0xba, 0xde, 0x03, 0x00,
-  0x00, 0x88, 0xd8, 0xee, 0xba, 0xda, 0x03, 0x00, 0x00, 0xee, 0x5b, 0xc3,
-  0x52, 0xb0, 0x04, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x06, 0xba,
-  0xc5, 0x03, 0x00, 0x00, 0xee, 0xba, 0xc4, 0x03, 0x00, 0x00, 0x30, 0xc0,
-  0xee, 0xb0, 0x01, 0xba, 0xc5, 0x03, 0x00, 0x00, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0xe3, 0x83, 0xc2, 0x05, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0x30, 0xc0, 0x83, 0xc2, 0x05, 0xee, 0xba, 0xc4, 0x03,
-  0x00, 0x00, 0xee, 0xb0, 0x03, 0xba, 0xc5, 0x03, 0x00, 0x00, 0xee, 0xb0,
-  0x02, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x0f, 0xba, 0xc5, 0x03,
-  0x00, 0x00, 0xee, 0x5a, 0xc3, 0x8d, 0x40, 0x00, 0x51, 0x52, 0x89, 0xc1,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x13, 0x83, 0xc2, 0x04, 0xc1,
-  0xe9, 0x03, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xc8, 0x83,
-  0xc2, 0x05, 0xee, 0x5a, 0x59, 0xc3, 0x8b, 0xc0, 0x51, 0x52, 0x89, 0xc1,
-  0x89, 0xc2, 0xc1, 0xea, 0x08, 0x88, 0xd5, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xb0, 0x0c, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x88, 0xe8, 0x83, 0xc2, 0x05, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xb0, 0x0d, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x88, 0xc8, 0x83, 0xc2, 0x05, 0xee, 0x5a, 0x59, 0xc3, 0x8b, 0xc0,
-  0x52, 0x88, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x08, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83,
-  0xc2, 0x05, 0xee, 0x5a, 0xc3, 0x8d, 0x40, 0x00, 0x53, 0x52, 0x88, 0xc3,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x0a, 0x2b, 0xc0, 0xec,
-  0xb0, 0x33, 0xba, 0xc0, 0x03, 0x00, 0x00, 0xee, 0x88, 0xd8, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x0a, 0x2b, 0xc0, 0xec, 0x5a,
-  0x5b, 0xc3, 0x8b, 0xc0, 0x53, 0x51, 0x52, 0x89, 0xc1, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x18, 0x83, 0xc2, 0x04, 0x89, 0xcb, 0xee, 0xc1,
-  0xeb, 0x08, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xc8, 0x83, 0xc2,
-  0x05, 0x83, 0xe3, 0x01, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xc1,
-  0xe3, 0x04, 0x83, 0xc2, 0x04, 0xf6, 0x05, 0x62, 0x0e, 0x00, 0x00, 0x10,
-  0x74, 0x76, 0xb0, 0x07, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83,
-  0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x24, 0xef, 0x09, 0xd8,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xc4, 0x83, 0xc2, 0x04, 0xb0,
-  0x07, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2,
-  0x05, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x09, 0x83, 0xc2,
-  0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xc1, 0xe9, 0x09, 0x83,
-  0xc2, 0x05, 0x83, 0xe1, 0x01, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xc1,
-  0xe1, 0x06, 0x24, 0xbf, 0x09, 0xc8, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x88, 0xc4, 0x83, 0xc2, 0x04, 0xb0, 0x09, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x5a, 0x59, 0x5b, 0xc3,
-  0xb0, 0x07, 0x80, 0xcb, 0x0f, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x5a, 0x59, 0x5b, 0xc3, 0x8b, 0xc0,
-  0x52, 0xb0, 0x04, 0xba, 0xce, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x02, 0xba,
-  0xcf, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x05, 0xba, 0xce, 0x03, 0x00, 0x00,
-  0xee, 0xba, 0xcf, 0x03, 0x00, 0x00, 0x30, 0xc0, 0xee, 0xb0, 0x06, 0xba,
-  0xce, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x0c, 0xba, 0xcf, 0x03, 0x00, 0x00,
-  0xee, 0xb0, 0x02, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x04, 0xba,
-  0xc5, 0x03, 0x00, 0x00, 0xee, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xb0,
-  0x06, 0xba, 0xc5, 0x03, 0x00, 0x00, 0xee, 0x5a, 0xc3, 0x8d, 0x40, 0x00,
-  0x52, 0xb0, 0x04, 0xba, 0xce, 0x03, 0x00, 0x00, 0xee, 0xba, 0xcf, 0x03,
-  0x00, 0x00, 0x30, 0xc0, 0xee, 0xb0, 0x05, 0xba, 0xce, 0x03, 0x00, 0x00,
-  0xee, 0xb0, 0x10, 0xba, 0xcf, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x06, 0xba,
-  0xce, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x0e, 0xba, 0xcf, 0x03, 0x00, 0x00,
-  0xee, 0xb0, 0x02, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x03, 0xba,
-  0xc5, 0x03, 0x00, 0x00, 0xee, 0xb0, 0x04, 0xba, 0xc4, 0x03, 0x00, 0x00,
-  0xee, 0xb0, 0x02, 0xba, 0xc5, 0x03, 0x00, 0x00, 0xee, 0x5a, 0xc3, 0x90,
-  0x53, 0x52, 0x88, 0xc3, 0x3a, 0x05, 0x64, 0x0e, 0x00, 0x00, 0x74, 0x54,
-  0xb0, 0x01, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xba, 0xc5, 0x03, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0x80, 0xe4, 0xfe, 0x88, 0xd8, 0x34,
-  0x01, 0x08, 0xc4, 0xba, 0xc4, 0x03, 0x00, 0x00, 0xb0, 0x01, 0xee, 0xba,
-  0xc5, 0x03, 0x00, 0x00, 0x88, 0xe0, 0xee, 0xba, 0xcc, 0x03, 0x00, 0x00,
-  0x88, 0x1d, 0x64, 0x0e, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0x80,
-  0xe4, 0xf3, 0x84, 0xdb, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xd0, 0xc1, 0xe2,
-  0x02, 0x0f, 0xb6, 0xc4, 0x09, 0xd0, 0xba, 0xc2, 0x03, 0x00, 0x00, 0xee,
-  0x5a, 0x5b, 0xc3, 0x90, 0x53, 0x51, 0x0f, 0xb7, 0xc8, 0x0f, 0xb7, 0xd2,
-  0x89, 0xc8, 0x89, 0xd3, 0xc1, 0xf8, 0x0e, 0xc1, 0xfb, 0x0e, 0xc1, 0xf9,
-  0x0d, 0xc1, 0xfa, 0x0d, 0x0f, 0xb6, 0xc0, 0xc1, 0xe3, 0x02, 0x83, 0xe1,
-  0x01, 0x09, 0xd8, 0xc1, 0xe1, 0x04, 0x0f, 0xb6, 0xc0, 0x83, 0xe2, 0x01,
-  0x09, 0xc8, 0xc1, 0xe2, 0x05, 0x0f, 0xb6, 0xc0, 0x09, 0xd0, 0x88, 0xc4,
-  0xba, 0xc4, 0x03, 0x00, 0x00, 0xb0, 0x03, 0xee, 0xba, 0xc5, 0x03, 0x00,
-  0x00, 0x88, 0xe0, 0xee, 0x59, 0x5b, 0x8b, 0xc0, 0xc3, 0x8d, 0x40, 0x00,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x83, 0xec, 0x04, 0x89, 0xc1, 0xf6,
-  0x05, 0x62, 0x0e, 0x00, 0x00, 0x10, 0x0f, 0x84, 0x36, 0x04, 0x00, 0x00,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x80, 0xe4, 0x7f, 0x83,
-  0xc2, 0x04, 0xb0, 0x17, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x83, 0xc2, 0x05, 0xee, 0xba, 0xcc, 0x03, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0x80, 0xe4, 0x3b, 0x8a, 0x01, 0x24, 0x03, 0x0f, 0xb6,
-  0xd0, 0xc1, 0xe2, 0x02, 0x0f, 0xb6, 0xc4, 0x09, 0xd0, 0x88, 0xc4, 0x8a,
-  0x01, 0xc0, 0xe0, 0x05, 0xc0, 0xe8, 0x07, 0x0f, 0xb6, 0xd0, 0xc1, 0xe2,
-  0x06, 0x0f, 0xb6, 0xc4, 0x09, 0xd0, 0x88, 0xc4, 0x8a, 0x01, 0xc0, 0xe0,
-  0x04, 0xc0, 0xe8, 0x07, 0x0f, 0xb6, 0xd0, 0xc1, 0xe2, 0x07, 0x0f, 0xb6,
-  0xc4, 0x09, 0xd0, 0xba, 0xc2, 0x03, 0x00, 0x00, 0xee, 0x8a, 0x41, 0x1e,
-  0x24, 0x01, 0x0f, 0xb6, 0xd0, 0x8a, 0x41, 0x1e, 0xc0, 0xe0, 0x06, 0xc0,
-  0xe8, 0x07, 0x0f, 0xb6, 0xc0, 0xc1, 0xe2, 0x02, 0xc1, 0xe0, 0x04, 0x09,
-  0xc2, 0x8a, 0x01, 0xc0, 0xe0, 0x03, 0xc0, 0xe8, 0x07, 0x34, 0x01, 0x0f,
-  0xb6, 0xc0, 0x09, 0xd0, 0x8a, 0x11, 0xc0, 0xe2, 0x02, 0xc0, 0xea, 0x07,
-  0x0f, 0xb6, 0xd2, 0xc1, 0xe2, 0x03, 0x09, 0xd0, 0x88, 0xc4, 0xba, 0xc4,
-  0x03, 0x00, 0x00, 0xb0, 0x01, 0xee, 0xba, 0xc5, 0x03, 0x00, 0x00, 0x88,
-  0xe0, 0xee, 0x30, 0xe4, 0x80, 0x79, 0x16, 0x05, 0x0f, 0x94, 0xc0, 0x0f,
-  0xb6, 0xd0, 0xc1, 0xe2, 0x06, 0x89, 0x55, 0xf0, 0x66, 0x8b, 0x51, 0x14,
-  0x30, 0xf6, 0x80, 0xe2, 0x0f, 0x0f, 0xb7, 0xda, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0x0b, 0x5d, 0xf0, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0xb0,
-  0x06, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x8a, 0x59, 0x10, 0x83, 0xc2,
-  0x04, 0x80, 0xeb, 0x02, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88,
-  0xd8, 0x83, 0xc2, 0x05, 0xee, 0x0f, 0xb7, 0x51, 0x10, 0x83, 0xea, 0x02,
-  0x89, 0xd3, 0x0f, 0xb6, 0xc4, 0xc1, 0xfb, 0x08, 0xc1, 0xfa, 0x09, 0x83,
-  0xe3, 0x01, 0x83, 0xe2, 0x01, 0x09, 0xd8, 0xc1, 0xe2, 0x05, 0x0f, 0xb6,
-  0xc0, 0x09, 0xd0, 0x88, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0,
-  0x10, 0x83, 0xc2, 0x04, 0x8a, 0x59, 0x12, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x0f, 0xb7, 0x51, 0x12,
-  0x89, 0xd3, 0xc1, 0xfb, 0x08, 0x0f, 0xb6, 0xc4, 0x83, 0xe3, 0x01, 0xc1,
-  0xfa, 0x09, 0xc1, 0xe3, 0x02, 0x83, 0xe2, 0x01, 0x09, 0xd8, 0xc1, 0xe2,
-  0x07, 0x0f, 0xb6, 0xc0, 0x8a, 0x59, 0x18, 0x09, 0xd0, 0xfe, 0xcb, 0x88,
-  0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x12, 0x83, 0xc2, 0x04,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xd8, 0x83, 0xc2, 0x05,
-  0xee, 0x0f, 0xb7, 0x51, 0x18, 0x4a, 0x89, 0xd3, 0xc1, 0xfb, 0x08, 0x0f,
-  0xb6, 0xc4, 0x83, 0xe3, 0x01, 0xc1, 0xfa, 0x09, 0x01, 0xdb, 0x83, 0xe2,
-  0x01, 0x09, 0xd8, 0xc1, 0xe2, 0x06, 0x0f, 0xb6, 0xc0, 0x09, 0xd0, 0x88,
-  0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x15, 0x83, 0xc2, 0x04,
-  0x8a, 0x59, 0x1a, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xd8,
-  0x83, 0xc2, 0x05, 0xee, 0x0f, 0xb7, 0x51, 0x1a, 0xc1, 0xfa, 0x08, 0x83,
-  0xe2, 0x01, 0x0f, 0xb6, 0xc4, 0xc1, 0xe2, 0x03, 0x09, 0xd0, 0x88, 0xc4,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x16, 0x83, 0xc2, 0x04, 0x8a,
-  0x59, 0x1c, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xd8, 0x83,
-  0xc2, 0x05, 0xee, 0x8a, 0x01, 0xc0, 0xe8, 0x07, 0x0f, 0xb6, 0x59, 0x17,
-  0x0f, 0xb6, 0xd0, 0xc1, 0xe3, 0x05, 0xc1, 0xe2, 0x06, 0x09, 0xd3, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xd8, 0x83, 0xc2, 0x05, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x07, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a,
-  0x01, 0x00, 0xc0, 0xc0, 0xe8, 0x07, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x34, 0x01, 0x83, 0xc2, 0x04, 0x0f, 0xb6, 0xd8, 0xb0, 0x17, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0xc1, 0xe3, 0x06, 0x2b,
-  0xc0, 0xec, 0x24, 0x10, 0x89, 0xda, 0x0f, 0xb6, 0xc0, 0x09, 0xc2, 0x8a,
-  0x41, 0x1e, 0xc0, 0xe0, 0x05, 0xc0, 0xe8, 0x07, 0x0f, 0xb6, 0xc0, 0xc1,
-  0xe0, 0x05, 0x09, 0xc2, 0x8a, 0x41, 0x1e, 0xc0, 0xe0, 0x04, 0xc0, 0xe8,
-  0x07, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x03, 0x09, 0xc2, 0x8a, 0x41, 0x1e,
-  0xc0, 0xe0, 0x03, 0xc0, 0xe8, 0x07, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x02,
-  0x09, 0xc2, 0x8a, 0x41, 0x1e, 0xc0, 0xe0, 0x02, 0xc0, 0xe8, 0x07, 0x34,
-  0x01, 0x0f, 0xb6, 0xc0, 0x01, 0xc0, 0x09, 0xc2, 0x8a, 0x41, 0x1e, 0x00,
-  0xc0, 0xc0, 0xe8, 0x07, 0x34, 0x01, 0x0f, 0xb6, 0xc0, 0x09, 0xd0, 0x88,
-  0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05,
-  0xee, 0x8a, 0x61, 0x02, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x80, 0xec,
-  0x05, 0x83, 0xc2, 0x04, 0x30, 0xc0, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a, 0x61, 0x04, 0x8b, 0x15,
-  0x54, 0x0e, 0x00, 0x00, 0xfe, 0xcc, 0x83, 0xc2, 0x04, 0xb0, 0x01, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee,
-  0x8a, 0x61, 0x06, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x02, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83,
-  0xc2, 0x05, 0xee, 0x8a, 0x61, 0x08, 0x80, 0xe4, 0x1f, 0x8a, 0x41, 0x0e,
-  0xc0, 0xe0, 0x05, 0x08, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x80,
-  0xcc, 0x80, 0x83, 0xc2, 0x04, 0xb0, 0x03, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8a, 0x61, 0x0a, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x04, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x0f,
-  0xb7, 0x51, 0x08, 0xc1, 0xfa, 0x05, 0x0f, 0xb6, 0x41, 0x0f, 0x83, 0xe2,
-  0x01, 0xc1, 0xe0, 0x05, 0xc1, 0xe2, 0x07, 0x09, 0xc2, 0x66, 0x8b, 0x41,
-  0x0c, 0x30, 0xe4, 0x24, 0x1f, 0x0f, 0xb7, 0xc0, 0x09, 0xd0, 0x88, 0xc4,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x80, 0xcc, 0x80, 0x83,
-  0xc2, 0x04, 0xb0, 0x11, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0,
-  0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83,
-  0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x80, 0xcc, 0x80, 0x83, 0xc2, 0x04, 0xb0, 0x17, 0xee, 0x8b, 0x15,
-  0x54, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x83, 0xc2, 0x05, 0xee, 0x8d, 0x65,
-  0xf4, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x83, 0xec, 0x0c, 0x89, 0xc1, 0xf6, 0x05, 0x62, 0x0e, 0x00,
-  0x00, 0x10, 0x0f, 0x84, 0x0c, 0x05, 0x00, 0x00, 0xba, 0xcc, 0x03, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x89, 0xc2, 0xc1, 0xfa, 0x02,
-  0x83, 0xe2, 0x03, 0x80, 0x21, 0xfc, 0x80, 0xe2, 0x03, 0x08, 0x11, 0x89,
-  0xc2, 0xc1, 0xfa, 0x06, 0x80, 0x21, 0xfb, 0x83, 0xe2, 0x01, 0xc1, 0xf8,
-  0x07, 0x80, 0xe2, 0x01, 0x83, 0xe0, 0x01, 0xc0, 0xe2, 0x02, 0x24, 0x01,
-  0x08, 0x11, 0xc0, 0xe0, 0x03, 0x80, 0x21, 0xf7, 0x08, 0x01, 0xb0, 0x01,
-  0xba, 0xc4, 0x03, 0x00, 0x00, 0xee, 0xba, 0xc5, 0x03, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0x80, 0xe4, 0x01, 0x80, 0xf4, 0x01, 0x80, 0xe4,
-  0x01, 0x80, 0x21, 0xef, 0xc0, 0xe4, 0x04, 0x08, 0x21, 0x0f, 0xb6, 0xc0,
-  0x89, 0xc2, 0xc1, 0xfa, 0x03, 0x83, 0xe2, 0x01, 0x80, 0xe2, 0x01, 0x80,
-  0x21, 0xdf, 0xc0, 0xe2, 0x05, 0x08, 0x11, 0x89, 0xc2, 0xc1, 0xfa, 0x04,
-  0x83, 0xe2, 0x01, 0x80, 0x61, 0x1e, 0xfd, 0x80, 0xe2, 0x01, 0xc1, 0xf8,
-  0x02, 0x00, 0xd2, 0x83, 0xe0, 0x01, 0x08, 0x51, 0x1e, 0x24, 0x01, 0x80,
-  0x61, 0x1e, 0xfe, 0x08, 0x41, 0x1e, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xc1, 0xf8, 0x06,
-  0x83, 0xe0, 0x01, 0x34, 0x01, 0x24, 0x01, 0x80, 0x21, 0xbf, 0xc0, 0xe0,
-  0x06, 0x8d, 0x59, 0x1e, 0x08, 0x01, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00,
-  0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xc1, 0xf8, 0x05,
-  0x83, 0xe0, 0x01, 0x24, 0x01, 0x80, 0x23, 0xfb, 0xc0, 0xe0, 0x02, 0x08,
-  0x03, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0,
-  0xec, 0x0f, 0xb6, 0xc0, 0xc1, 0xf8, 0x03, 0x83, 0xe0, 0x01, 0x24, 0x01,
-  0x80, 0x23, 0xf7, 0xc0, 0xe0, 0x03, 0x08, 0x03, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xc1,
-  0xf8, 0x02, 0x83, 0xe0, 0x01, 0x24, 0x01, 0x80, 0x23, 0xef, 0xc0, 0xe0,
-  0x04, 0x08, 0x03, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05,
-  0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0xd1, 0xf8, 0x83, 0xe0, 0x01, 0x34,
-  0x01, 0x24, 0x01, 0x80, 0x23, 0xdf, 0xc0, 0xe0, 0x05, 0x08, 0x03, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x17, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x24,
-  0x01, 0x34, 0x01, 0x24, 0x01, 0x80, 0x23, 0xbf, 0xc0, 0xe0, 0x06, 0x08,
-  0x03, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x14, 0x83, 0xc2, 0x04,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0,
-  0xec, 0x0f, 0xb6, 0xc0, 0xc1, 0xf8, 0x06, 0x83, 0xe0, 0x01, 0x24, 0x01,
-  0x80, 0x21, 0x7f, 0xc0, 0xe0, 0x07, 0x08, 0x01, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x30, 0xc0, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x30, 0xe4, 0x05, 0x05,
-  0x00, 0x00, 0x00, 0x66, 0x89, 0x41, 0x02, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xb0, 0x01, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x30, 0xe4, 0x40, 0x66, 0x89,
-  0x41, 0x04, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x02, 0x83, 0xc2,
-  0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b,
-  0xc0, 0xec, 0x30, 0xe4, 0x66, 0x89, 0x41, 0x06, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e,
-  0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x89, 0xc3, 0x83, 0xc2, 0x04, 0xb0, 0x03,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0,
-  0xec, 0x24, 0x1f, 0xc1, 0xfb, 0x07, 0x0f, 0xb6, 0xc0, 0xc1, 0xe3, 0x05,
-  0x89, 0xc2, 0x0f, 0xb7, 0x41, 0x06, 0x09, 0xda, 0x24, 0xc0, 0x09, 0xc2,
-  0x66, 0x8b, 0x41, 0x06, 0x66, 0x89, 0x51, 0x08, 0x30, 0xe4, 0x30, 0xf6,
-  0x24, 0x3f, 0x80, 0xe2, 0x3f, 0x66, 0x39, 0xd0, 0x72, 0x05, 0x66, 0x83,
-  0x41, 0x08, 0x40, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x04, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05,
-  0x2b, 0xc0, 0xec, 0x30, 0xe4, 0x66, 0x89, 0x41, 0x0a, 0x89, 0xc3, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x80, 0xe3, 0xe0, 0x2b,
-  0xc0, 0xec, 0x24, 0x1f, 0x66, 0x8b, 0x51, 0x0a, 0x30, 0xe4, 0x30, 0xf6,
-  0x08, 0xd8, 0x80, 0xe2, 0x1f, 0x66, 0x89, 0x41, 0x0c, 0x24, 0x1f, 0x66,
-  0x39, 0xc2, 0x72, 0x05, 0x66, 0x83, 0x41, 0x0c, 0x20, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x03, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0,
-  0xc1, 0xf8, 0x05, 0x83, 0xe0, 0x03, 0x88, 0x41, 0x0e, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x05, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0,
-  0xc1, 0xf8, 0x05, 0x83, 0xe0, 0x03, 0x88, 0x41, 0x0f, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0xb0, 0x07, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54,
-  0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x89, 0xc3, 0x88,
-  0x45, 0xf0, 0x24, 0x01, 0x0f, 0xb6, 0xc0, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xc1, 0xe0, 0x08, 0x83, 0xc2, 0x04, 0x89, 0x45, 0xec, 0xb0, 0x06,
-  0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0,
-  0xec, 0x8b, 0x55, 0xec, 0x0f, 0xb6, 0xc0, 0x0f, 0xb6, 0xdb, 0x09, 0xc2,
-  0x89, 0xd8, 0xc1, 0xf8, 0x05, 0x83, 0xe0, 0x01, 0xc1, 0xe0, 0x09, 0x09,
-  0xd0, 0x83, 0xc0, 0x02, 0x66, 0x89, 0x41, 0x10, 0x89, 0xd8, 0xc1, 0xf8,
-  0x02, 0x83, 0xe0, 0x01, 0xc1, 0xe0, 0x08, 0x89, 0x45, 0xe8, 0x8b, 0x15,
-  0x54, 0x0e, 0x00, 0x00, 0xb0, 0x10, 0x83, 0xc2, 0x04, 0xee, 0x8b, 0x15,
-  0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f, 0xb6,
-  0xd0, 0x89, 0xd8, 0xc1, 0xf8, 0x07, 0x83, 0xe0, 0x01, 0x0b, 0x55, 0xe8,
-  0xc1, 0xe0, 0x09, 0x09, 0xd0, 0x66, 0x89, 0x41, 0x12, 0x89, 0xc3, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x24,
-  0x0f, 0x80, 0xe3, 0xf0, 0x30, 0xe4, 0x66, 0x8b, 0x51, 0x12, 0x09, 0xd8,
-  0x30, 0xf6, 0x66, 0x89, 0x41, 0x14, 0x30, 0xe4, 0x80, 0xe2, 0x0f, 0x24,
-  0x0f, 0x66, 0x39, 0xc2, 0x72, 0x05, 0x66, 0x83, 0x41, 0x14, 0x10, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x11, 0x83, 0xc2, 0x04, 0xee, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x0f,
-  0xb6, 0xc0, 0xc1, 0xf8, 0x06, 0xa8, 0x01, 0x74, 0x07, 0xb8, 0x05, 0x00,
-  0x00, 0x00, 0xeb, 0x05, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x88, 0x41, 0x16,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x14, 0x83, 0xc2, 0x04, 0xee,
-  0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05, 0x2b, 0xc0, 0xec,
-  0x0f, 0xb6, 0xc0, 0xc1, 0xf8, 0x05, 0x83, 0xe0, 0x01, 0x0f, 0xb6, 0x5d,
-  0xf0, 0x88, 0x41, 0x17, 0x89, 0xd8, 0xd1, 0xf8, 0x83, 0xe0, 0x01, 0x8b,
-  0x15, 0x54, 0x0e, 0x00, 0x00, 0xc1, 0xe0, 0x08, 0x83, 0xc2, 0x04, 0x89,
-  0x45, 0xec, 0xb0, 0x12, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83,
-  0xc2, 0x05, 0x2b, 0xc0, 0xec, 0x8b, 0x55, 0xec, 0x0f, 0xb6, 0xc0, 0x09,
-  0xc2, 0x89, 0xd8, 0xc1, 0xf8, 0x06, 0x83, 0xe0, 0x01, 0xc1, 0xe0, 0x09,
-  0x09, 0xd0, 0x40, 0x66, 0x89, 0x41, 0x18, 0x8b, 0x15, 0x54, 0x0e, 0x00,
-  0x00, 0xb0, 0x15, 0x83, 0xc2, 0x04, 0xc1, 0xfb, 0x03, 0xee, 0x8b, 0x15,
-  0x54, 0x0e, 0x00, 0x00, 0x83, 0xe3, 0x01, 0x83, 0xc2, 0x05, 0xc1, 0xe3,
-  0x08, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x09, 0xd8, 0x66, 0x89, 0x41,
-  0x1a, 0x89, 0xc3, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0xb0, 0x16, 0x83,
-  0xc2, 0x04, 0xee, 0x8b, 0x15, 0x54, 0x0e, 0x00, 0x00, 0x83, 0xc2, 0x05,
-  0x2b, 0xc0, 0xec, 0x24, 0x7f, 0x80, 0xe3, 0x80, 0x30, 0xe4, 0x66, 0x8b,
-  0x51, 0x1a, 0x09, 0xd8, 0x30, 0xf6, 0x66, 0x89, 0x41, 0x1c, 0x30, 0xe4,
-  0x80, 0xe2, 0x7f, 0x24, 0x7f, 0x66, 0x39, 0xc2, 0x72, 0x06, 0x66, 0x81,
-  0x41, 0x1c, 0x80, 0x00, 0x8d, 0x65, 0xf4, 0x5a, 0x59, 0x5b, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x1c, 0xb9,
-  0x07, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xd0, 0xbe, 0x34, 0x4c, 0x00, 0x00,
-  0x8d, 0x5d, 0xd0, 0x31, 0xc0, 0xf3, 0xa5, 0x8d, 0x55, 0xd0, 0x66, 0x89,
-  0x45, 0xd4, 0xb8, 0x10, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xd0, 0x12,
-  0x11, 0xe8, 0x1a, 0x36, 0x00, 0x00, 0xc6, 0x05, 0x48, 0x0e, 0x00, 0x00,
-  0x32, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x83, 0x38, 0x01, 0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0xc3, 0x8b, 0xc0,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x83, 0xec, 0x18, 0x0f, 0xb6, 0x35,
-  0x70, 0x0e, 0x00, 0x00, 0x69, 0xf6, 0xa0, 0x00, 0x00, 0x00, 0xa1, 0x3c,
-  0x0e, 0x00, 0x00, 0x01, 0xc6, 0x31, 0xc0, 0x8b, 0x15, 0x68, 0x0e, 0x00,
-  0x00, 0x89, 0x04, 0x24, 0x85, 0xd2, 0x0f, 0x84, 0x05, 0x01, 0x00, 0x00,
-  0x83, 0xf8, 0x50, 0x0f, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x00,
-  0x0f, 0x84, 0xf3, 0x00, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x0c, 0x01, 0x00,
-  0x00, 0x00, 0x8b, 0x1c, 0x24, 0x8b, 0x0a, 0x3b, 0x1d, 0x6c, 0x0e, 0x00,
-  0x00, 0x0f, 0x94, 0xc3, 0x88, 0x5c, 0x24, 0x14, 0x84, 0xdb, 0x74, 0x07,
-  0xbb, 0x00, 0x1f, 0x00, 0x00, 0xeb, 0x05, 0xbb, 0x00, 0x70, 0x00, 0x00,
-  0x89, 0x5c, 0x24, 0x08, 0x80, 0x7c, 0x24, 0x14, 0x00, 0x74, 0x07, 0xbb,
-  0x00, 0x1e, 0x00, 0x00, 0xeb, 0x05, 0xbb, 0x00, 0x71, 0x00, 0x00, 0x89,
-  0x5c, 0x24, 0x04, 0x80, 0x7a, 0x06, 0x50, 0x0f, 0x83, 0xa4, 0x00, 0x00,
-  0x00, 0x8b, 0x5c, 0x24, 0x08, 0x80, 0xcb, 0x20, 0x89, 0x5c, 0x24, 0x10,
-  0x8b, 0x7c, 0x24, 0x10, 0x8d, 0x1c, 0x00, 0x0f, 0xb6, 0x6a, 0x06, 0x39,
-  0xe8, 0x73, 0x0c, 0x89, 0xdd, 0x40, 0x83, 0xc3, 0x02, 0x66, 0x89, 0x3c,
-  0x2e, 0xeb, 0xec, 0x0f, 0xb6, 0x6a, 0x06, 0x0f, 0xb6, 0x5a, 0x07, 0x01,
-  0xeb, 0x39, 0xd8, 0x73, 0x41, 0x80, 0x39, 0x00, 0x74, 0x3c, 0x83, 0x7c,
-  0x24, 0x0c, 0x00, 0x74, 0x23, 0x8a, 0x19, 0x3a, 0x5a, 0x04, 0x75, 0x1c,
-  0x8b, 0x7c, 0x24, 0x04, 0xc7, 0x44, 0x24, 0x0c, 0x00, 0x00, 0x00, 0x00,
-  0x66, 0x0f, 0xb6, 0x19, 0x41, 0x09, 0xdf, 0x89, 0xc3, 0x40, 0x66, 0x89,
-  0x3c, 0x5e, 0xeb, 0xc3, 0x89, 0xc3, 0x66, 0x0f, 0xb6, 0x39, 0x41, 0x0b,
-  0x7c, 0x24, 0x08, 0x40, 0x66, 0x89, 0x3c, 0x5e, 0xeb, 0xb1, 0x8b, 0x7c,
-  0x24, 0x08, 0x8d, 0x0c, 0x00, 0x83, 0xcf, 0x20, 0x0f, 0xb6, 0x5a, 0x06,
-  0x0f, 0xb6, 0x6a, 0x07, 0x01, 0xeb, 0x39, 0xd8, 0x73, 0x0c, 0x89, 0xcb,
-  0x40, 0x83, 0xc1, 0x02, 0x66, 0x89, 0x3c, 0x1e, 0xeb, 0xe6, 0xff, 0x04,
-  0x24, 0x83, 0xc2, 0x0c, 0xe9, 0xfb, 0xfe, 0xff, 0xff, 0x8d, 0x14, 0x00,
-  0x83, 0xf8, 0x50, 0x73, 0x0e, 0x89, 0xd1, 0x40, 0x83, 0xc2, 0x02, 0x66,
-  0xc7, 0x04, 0x31, 0x20, 0x70, 0xeb, 0xed, 0x83, 0xc4, 0x18, 0x5d, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x56,
-  0x57, 0x83, 0xec, 0x0c, 0x89, 0x45, 0xf0, 0x89, 0xce, 0x89, 0xd8, 0x8b,
-  0x3c, 0x82, 0x0f, 0xb6, 0x05, 0x47, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xc3,
-  0x8d, 0x04, 0x45, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x45, 0xf4, 0x01, 0x00,
-  0x00, 0x00, 0x83, 0xc0, 0x02, 0x8b, 0x17, 0x01, 0x45, 0xf0, 0x83, 0xfa,
-  0x01, 0x75, 0x37, 0x8b, 0x45, 0x08, 0x8b, 0x55, 0xf0, 0x0c, 0xcc, 0x31,
-  0xc9, 0x66, 0x89, 0x42, 0xfe, 0x85, 0xf6, 0x76, 0x11, 0x8b, 0x45, 0x08,
-  0x0c, 0xcd, 0x83, 0xc2, 0x02, 0x41, 0x66, 0x89, 0x42, 0xfe, 0x39, 0xf1,
-  0x72, 0xf4, 0x8d, 0x04, 0x36, 0x8b, 0x55, 0x08, 0x03, 0x45, 0xf0, 0x80,
-  0xca, 0xb9, 0x66, 0x89, 0x10, 0xe9, 0x6a, 0x00, 0x00, 0x00, 0x31, 0xc9,
-  0x85, 0xf6, 0x76, 0x4b, 0x8b, 0x5d, 0xf0, 0x80, 0x3a, 0x00, 0x74, 0x43,
-  0x83, 0x7d, 0xf4, 0x00, 0x74, 0x2a, 0x0f, 0xb6, 0x02, 0xe8, 0xba, 0x38,
-  0x00, 0x00, 0x89, 0x45, 0xec, 0x0f, 0xb6, 0x47, 0x04, 0xe8, 0xae, 0x38,
-  0x00, 0x00, 0x3b, 0x45, 0xec, 0x75, 0x11, 0x66, 0x0f, 0xb6, 0x02, 0x0b,
-  0x45, 0x0c, 0x66, 0x89, 0x03, 0x31, 0xc0, 0x89, 0x45, 0xf4, 0xeb, 0x0a,
-  0x66, 0x0f, 0xb6, 0x02, 0x0b, 0x45, 0x08, 0x66, 0x89, 0x03, 0x42, 0x41,
-  0x83, 0xc3, 0x02, 0x39, 0xf1, 0x72, 0xb8, 0x8b, 0x45, 0x08, 0x8d, 0x14,
-  0x09, 0x0c, 0x20, 0x03, 0x55, 0xf0, 0x39, 0xf1, 0x73, 0x0a, 0x83, 0xc2,
-  0x02, 0x41, 0x66, 0x89, 0x42, 0xfe, 0xeb, 0xf2, 0x8d, 0x65, 0xf8, 0x5f,
-  0x5e, 0x5d, 0xc2, 0x08, 0x00, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51,
-  0x56, 0x57, 0x83, 0xec, 0x60, 0x89, 0x45, 0xa4, 0x88, 0x55, 0xec, 0x89,
-  0x5d, 0xac, 0x31, 0xc0, 0xc6, 0x45, 0xf0, 0x01, 0x89, 0x45, 0xa8, 0x89,
-  0x45, 0xe0, 0x81, 0x3b, 0x00, 0x4b, 0x00, 0x00, 0x74, 0x08, 0x81, 0x3b,
-  0x00, 0x4d, 0x00, 0x00, 0x75, 0x03, 0xff, 0x45, 0xe0, 0x8b, 0x45, 0xac,
-  0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x7d, 0xa4, 0x00, 0x0f, 0x84,
-  0x62, 0x04, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x89, 0x45, 0xc8,
-  0x89, 0x45, 0xdc, 0xb8, 0x17, 0x04, 0x00, 0x00, 0x8a, 0x00, 0x24, 0x08,
-  0x0f, 0xb6, 0xc0, 0x89, 0x45, 0x9c, 0x8b, 0x45, 0xa4, 0xbb, 0x02, 0x00,
-  0x00, 0x00, 0x31, 0xf6, 0x8b, 0x40, 0x08, 0x89, 0x75, 0xbc, 0x89, 0x45,
-  0xe8, 0x89, 0xc2, 0x8b, 0x02, 0x85, 0xc0, 0x74, 0x50, 0x83, 0x38, 0x01,
-  0x75, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x18, 0x8b, 0x38, 0x2b,
-  0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x89, 0xc8, 0x83,
-  0xf9, 0x4e, 0x76, 0x05, 0xb8, 0x4e, 0x00, 0x00, 0x00, 0x83, 0xc0, 0x02,
-  0x3b, 0x45, 0xdc, 0x76, 0x03, 0x89, 0x45, 0xdc, 0x8b, 0x45, 0xc8, 0x39,
-  0xc3, 0x76, 0x11, 0x0f, 0xb6, 0x4d, 0xec, 0x83, 0xc0, 0x02, 0x01, 0xc8,
-  0x83, 0xf8, 0x19, 0x77, 0x03, 0x89, 0x5d, 0xc8, 0xff, 0x45, 0xbc, 0x83,
-  0xc2, 0x04, 0x43, 0xeb, 0xaa, 0x8b, 0x45, 0xbc, 0x89, 0x45, 0xd8, 0x8b,
-  0x45, 0xdc, 0x0f, 0xaf, 0x45, 0xc8, 0x01, 0xc0, 0x0f, 0xb6, 0x4d, 0xec,
-  0xe8, 0xbf, 0x2d, 0x00, 0x00, 0x0f, 0xb6, 0x15, 0x47, 0x0e, 0x00, 0x00,
-  0x0f, 0xaf, 0xd1, 0x8b, 0x0d, 0x3c, 0x0e, 0x00, 0x00, 0x01, 0xd2, 0x01,
-  0xca, 0x8b, 0x4d, 0xa4, 0x0f, 0xb6, 0x49, 0x06, 0x01, 0xc9, 0x01, 0xca,
-  0x89, 0x45, 0xb8, 0x89, 0x55, 0xcc, 0x85, 0xc0, 0x0f, 0x84, 0x98, 0x03,
-  0x00, 0x00, 0x31, 0xc0, 0x89, 0x45, 0xc4, 0x83, 0x7d, 0xc8, 0x00, 0x76,
-  0x4f, 0x8b, 0x4d, 0xdc, 0x0f, 0xaf, 0x4d, 0xc4, 0x8b, 0x55, 0xc4, 0x0f,
-  0xb6, 0x05, 0x47, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xd0, 0x89, 0x55, 0xd4,
-  0x31, 0xd2, 0x83, 0x7d, 0xdc, 0x00, 0x76, 0x25, 0x8b, 0x45, 0xd4, 0x8d,
-  0x3c, 0x09, 0x01, 0xc0, 0x03, 0x7d, 0xb8, 0x03, 0x45, 0xcc, 0xff, 0x45,
-  0xd4, 0x42, 0x83, 0xc7, 0x02, 0x41, 0x66, 0x8b, 0x18, 0x83, 0xc0, 0x02,
-  0x66, 0x89, 0x5f, 0xfe, 0x3b, 0x55, 0xdc, 0x72, 0xe9, 0xff, 0x45, 0xc4,
-  0x8b, 0x45, 0xc4, 0x3b, 0x45, 0xc8, 0x72, 0xb1, 0x8b, 0x45, 0xc8, 0x66,
-  0x8b, 0x1d, 0x20, 0x09, 0x00, 0x00, 0x31, 0xd2, 0x48, 0x80, 0xcb, 0xba,
-  0x89, 0x45, 0xb4, 0x85, 0xc0, 0x76, 0x27, 0x0f, 0xb6, 0x0d, 0x47, 0x0e,
-  0x00, 0x00, 0x0f, 0xaf, 0xca, 0x8d, 0x04, 0x09, 0x03, 0x45, 0xcc, 0x66,
-  0x89, 0x18, 0x8b, 0x45, 0xdc, 0x01, 0xc8, 0x01, 0xc0, 0x03, 0x45, 0xcc,
-  0x42, 0x66, 0x89, 0x58, 0xfe, 0x3b, 0x55, 0xb4, 0x72, 0xd9, 0x8b, 0x55,
-  0xb4, 0x0f, 0xb6, 0x05, 0x47, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0xd0, 0x89,
-  0x55, 0xa0, 0x8b, 0x45, 0xa0, 0x8b, 0x4d, 0xdc, 0x01, 0xc0, 0x66, 0x8b,
-  0x1d, 0x20, 0x09, 0x00, 0x00, 0x89, 0x45, 0x98, 0x8b, 0x45, 0xcc, 0x66,
-  0x8b, 0x15, 0x20, 0x09, 0x00, 0x00, 0x03, 0x45, 0x98, 0x80, 0xca, 0xc8,
-  0x80, 0xcb, 0xcd, 0x66, 0x89, 0x10, 0x8b, 0x45, 0xcc, 0xba, 0x01, 0x00,
-  0x00, 0x00, 0x83, 0xc0, 0x02, 0x29, 0xd1, 0x03, 0x45, 0x98, 0x39, 0xd1,
-  0x76, 0x0c, 0x83, 0xc0, 0x02, 0x42, 0x66, 0x89, 0x58, 0xfe, 0x39, 0xca,
-  0x72, 0xf4, 0x8b, 0x45, 0xa0, 0x03, 0x45, 0xdc, 0x01, 0xc0, 0x66, 0x8b,
-  0x15, 0x20, 0x09, 0x00, 0x00, 0x03, 0x45, 0xcc, 0x80, 0xca, 0xbc, 0x31,
-  0xff, 0x66, 0x89, 0x50, 0xfe, 0x83, 0x7d, 0xd8, 0x00, 0x76, 0x3f, 0x8b,
-  0x45, 0xdc, 0x83, 0xe8, 0x02, 0x89, 0x45, 0xb0, 0x39, 0xf7, 0x75, 0x07,
-  0xa1, 0x1c, 0x09, 0x00, 0x00, 0xeb, 0x05, 0xa1, 0x24, 0x09, 0x00, 0x00,
-  0x50, 0x75, 0x07, 0xa1, 0x18, 0x09, 0x00, 0x00, 0xeb, 0x05, 0xa1, 0x20,
-  0x09, 0x00, 0x00, 0x8b, 0x4d, 0xb0, 0x8b, 0x55, 0xe8, 0x50, 0x89, 0xfb,
-  0x8b, 0x45, 0xcc, 0x47, 0xe8, 0xc3, 0xfc, 0xff, 0xff, 0x3b, 0x7d, 0xd8,
-  0x72, 0xca, 0x8b, 0x45, 0xdc, 0x83, 0xe8, 0x02, 0x89, 0x45, 0xd0, 0x8b,
-  0x45, 0xd8, 0x48, 0x89, 0x45, 0x94, 0x80, 0x7d, 0xf0, 0x00, 0x0f, 0x84,
-  0xd5, 0x01, 0x00, 0x00, 0xb8, 0x17, 0x04, 0x00, 0x00, 0x8a, 0x00, 0x24,
-  0x08, 0x0f, 0xb6, 0xd0, 0xff, 0x15, 0x74, 0x0e, 0x00, 0x00, 0x83, 0x7d,
-  0x9c, 0x00, 0x74, 0x11, 0x85, 0xd2, 0x75, 0x0d, 0xff, 0x45, 0xe0, 0x83,
-  0x7d, 0xe0, 0x02, 0x0f, 0x83, 0xac, 0x01, 0x00, 0x00, 0xe8, 0xca, 0x35,
-  0x00, 0x00, 0x89, 0x55, 0x9c, 0x85, 0xc0, 0x74, 0xc1, 0xe8, 0x1e, 0x23,
-  0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x75, 0x0a, 0xe8, 0x13, 0x23, 0x00,
-  0x00, 0x89, 0xc7, 0xc1, 0xe7, 0x08, 0x83, 0xff, 0x1b, 0x0f, 0x84, 0x82,
-  0x01, 0x00, 0x00, 0x83, 0xff, 0x0d, 0x0f, 0x84, 0x6c, 0x01, 0x00, 0x00,
-  0x81, 0xff, 0x00, 0x48, 0x00, 0x00, 0x75, 0x5a, 0x8b, 0x4d, 0xd0, 0x8b,
-  0x55, 0xe8, 0xff, 0x35, 0x24, 0x09, 0x00, 0x00, 0x8b, 0x45, 0xcc, 0xff,
-  0x35, 0x20, 0x09, 0x00, 0x00, 0x89, 0xf3, 0xe8, 0x24, 0xfc, 0xff, 0xff,
-  0x85, 0xf6, 0x75, 0x05, 0x8b, 0x75, 0x94, 0xeb, 0x01, 0x4e, 0x89, 0xf0,
-  0xc1, 0xe0, 0x02, 0x03, 0x45, 0xe8, 0x8b, 0x00, 0xe8, 0xa7, 0xfa, 0xff,
-  0xff, 0x85, 0xc0, 0x75, 0xe3, 0x8b, 0x4d, 0xd0, 0x8b, 0x55, 0xe8, 0xff,
-  0x35, 0x1c, 0x09, 0x00, 0x00, 0x8b, 0x45, 0xcc, 0xff, 0x35, 0x18, 0x09,
-  0x00, 0x00, 0x89, 0xf3, 0xe8, 0xeb, 0xfb, 0xff, 0xff, 0xe9, 0x38, 0xff,
-  0xff, 0xff, 0x81, 0xff, 0x00, 0x50, 0x00, 0x00, 0x75, 0x58, 0x8b, 0x4d,
-  0xd0, 0x8b, 0x55, 0xe8, 0xff, 0x35, 0x24, 0x09, 0x00, 0x00, 0x8b, 0x45,
-  0xcc, 0xff, 0x35, 0x20, 0x09, 0x00, 0x00, 0x89, 0xf3, 0xe8, 0xc2, 0xfb,
-  0xff, 0xff, 0x46, 0x3b, 0x75, 0xd8, 0x72, 0x02, 0x31, 0xf6, 0x89, 0xf0,
-  0xc1, 0xe0, 0x02, 0x03, 0x45, 0xe8, 0x8b, 0x00, 0xe8, 0x47, 0xfa, 0xff,
-  0xff, 0x85, 0xc0, 0x75, 0xe5, 0x8b, 0x4d, 0xd0, 0x8b, 0x55, 0xe8, 0xff,
-  0x35, 0x1c, 0x09, 0x00, 0x00, 0x8b, 0x45, 0xcc, 0xff, 0x35, 0x18, 0x09,
-  0x00, 0x00, 0x89, 0xf3, 0xe8, 0x8b, 0xfb, 0xff, 0xff, 0xe9, 0xd8, 0xfe,
-  0xff, 0xff, 0x81, 0xff, 0x00, 0x4b, 0x00, 0x00, 0x74, 0x08, 0x81, 0xff,
-  0x00, 0x4d, 0x00, 0x00, 0x75, 0x0c, 0x8b, 0x45, 0xac, 0x89, 0x38, 0x31,
-  0xc0, 0xe9, 0x98, 0x00, 0x00, 0x00, 0x83, 0xff, 0x20, 0x0f, 0x86, 0xb3,
-  0xfe, 0xff, 0xff, 0x83, 0xff, 0x7f, 0x0f, 0x83, 0xaa, 0xfe, 0xff, 0xff,
-  0x8b, 0x45, 0xd8, 0x8b, 0x4d, 0xd0, 0x8b, 0x55, 0xe8, 0xff, 0x35, 0x24,
-  0x09, 0x00, 0x00, 0x89, 0xf3, 0xff, 0x35, 0x20, 0x09, 0x00, 0x00, 0x89,
-  0x45, 0xe4, 0x8b, 0x45, 0xcc, 0x46, 0xe8, 0x35, 0xfb, 0xff, 0xff, 0x3b,
-  0x75, 0xd8, 0x72, 0x02, 0x31, 0xf6, 0x89, 0xf0, 0xc1, 0xe0, 0x02, 0x03,
-  0x45, 0xe8, 0x8b, 0x00, 0x0f, 0xb6, 0x40, 0x04, 0xe8, 0x5f, 0x34, 0x00,
-  0x00, 0x89, 0xc2, 0x89, 0xf8, 0xe8, 0x56, 0x34, 0x00, 0x00, 0x39, 0xc2,
-  0x74, 0x0c, 0xff, 0x4d, 0xe4, 0x75, 0x04, 0x31, 0xf6, 0xeb, 0x03, 0x46,
-  0xeb, 0xcd, 0x8b, 0x4d, 0xd0, 0x8b, 0x55, 0xe8, 0xff, 0x35, 0x1c, 0x09,
-  0x00, 0x00, 0x8b, 0x45, 0xcc, 0xff, 0x35, 0x18, 0x09, 0x00, 0x00, 0x89,
-  0xf3, 0xe8, 0xe6, 0xfa, 0xff, 0xff, 0x83, 0x7d, 0xe4, 0x00, 0x0f, 0x8e,
-  0x2e, 0xfe, 0xff, 0xff, 0x89, 0xf0, 0xc1, 0xe0, 0x02, 0x03, 0x45, 0xe8,
-  0x8b, 0x00, 0x89, 0x45, 0xa8, 0x31, 0xc0, 0x89, 0x45, 0xc0, 0x83, 0x7d,
-  0xc8, 0x00, 0x76, 0x46, 0x8b, 0x55, 0xdc, 0x0f, 0xaf, 0x55, 0xc0, 0x0f,
-  0xb6, 0x0d, 0x47, 0x0e, 0x00, 0x00, 0x0f, 0xaf, 0x4d, 0xc0, 0x31, 0xc0,
-  0x83, 0x7d, 0xdc, 0x00, 0x76, 0x21, 0x8d, 0x3c, 0x09, 0x8d, 0x34, 0x12,
-  0x03, 0x7d, 0xcc, 0x03, 0x75, 0xb8, 0x40, 0x83, 0xc7, 0x02, 0x41, 0x66,
-  0x8b, 0x1e, 0x83, 0xc6, 0x02, 0x42, 0x66, 0x89, 0x5f, 0xfe, 0x3b, 0x45,
-  0xdc, 0x72, 0xeb, 0xff, 0x45, 0xc0, 0x8b, 0x45, 0xc0, 0x3b, 0x45, 0xc8,
-  0x72, 0xba, 0x8b, 0x45, 0xb8, 0xe8, 0xfa, 0x28, 0x00, 0x00, 0x8b, 0x45,
-  0xa8, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x8d, 0x40, 0x00,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x31,
-  0xc9, 0x31, 0xff, 0x89, 0x4d, 0xe8, 0x83, 0x3d, 0x68, 0x0e, 0x00, 0x00,
-  0x00, 0x0f, 0x84, 0x17, 0x02, 0x00, 0x00, 0xb8, 0x17, 0x04, 0x00, 0x00,
-  0x8a, 0x00, 0xa8, 0x08, 0x0f, 0x84, 0x06, 0x02, 0x00, 0x00, 0x89, 0x0d,
-  0x6c, 0x0e, 0x00, 0x00, 0xe8, 0xd7, 0xf8, 0xff, 0xff, 0xff, 0x15, 0x74,
-  0x0e, 0x00, 0x00, 0xe8, 0x78, 0x33, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x84,
-  0xf2, 0x00, 0x00, 0x00, 0xe8, 0xcb, 0x20, 0x00, 0x00, 0x85, 0xc0, 0x0f,
-  0x85, 0xe5, 0x00, 0x00, 0x00, 0xe8, 0xbe, 0x20, 0x00, 0x00, 0x89, 0xc3,
-  0x31, 0xd2, 0x3d, 0x9b, 0x00, 0x00, 0x00, 0x75, 0x4c, 0xff, 0x0d, 0x6c,
-  0x0e, 0x00, 0x00, 0x83, 0x3d, 0x6c, 0x0e, 0x00, 0x00, 0x00, 0x7d, 0x25,
-  0x31, 0xc0, 0x31, 0xc9, 0xa3, 0x6c, 0x0e, 0x00, 0x00, 0xa1, 0x68, 0x0e,
-  0x00, 0x00, 0x83, 0x3c, 0x01, 0x00, 0x74, 0x0b, 0xff, 0x05, 0x6c, 0x0e,
-  0x00, 0x00, 0x83, 0xc1, 0x0c, 0xeb, 0xea, 0xff, 0x0d, 0x6c, 0x0e, 0x00,
-  0x00, 0x6b, 0x0d, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0xa1, 0x68, 0x0e, 0x00,
-  0x00, 0x01, 0xc1, 0xe8, 0x60, 0xf8, 0xff, 0xff, 0xe9, 0x89, 0x00, 0x00,
-  0x00, 0x3d, 0x9d, 0x00, 0x00, 0x00, 0x75, 0x36, 0xff, 0x05, 0x6c, 0x0e,
-  0x00, 0x00, 0x6b, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0x8b, 0x15, 0x68,
-  0x0e, 0x00, 0x00, 0x83, 0x3c, 0x02, 0x00, 0x75, 0x07, 0x31, 0xc0, 0xa3,
-  0x6c, 0x0e, 0x00, 0x00, 0x6b, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0x8b,
-  0x0d, 0x68, 0x0e, 0x00, 0x00, 0x01, 0xc1, 0xe8, 0x20, 0xf8, 0xff, 0xff,
-  0xeb, 0x4c, 0x8b, 0x0d, 0x68, 0x0e, 0x00, 0x00, 0x8b, 0x35, 0x6c, 0x0e,
-  0x00, 0x00, 0x83, 0x39, 0x00, 0x74, 0x11, 0x0f, 0xb6, 0x41, 0x05, 0x39,
-  0xc3, 0x74, 0x09, 0x83, 0xc1, 0x0c, 0x42, 0x83, 0x39, 0x00, 0x75, 0xef,
-  0x83, 0x39, 0x00, 0x75, 0x0e, 0xc7, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0x31, 0xc9, 0xeb, 0x06, 0x89, 0x15, 0x6c, 0x0e, 0x00,
-  0x00, 0x3b, 0x35, 0x6c, 0x0e, 0x00, 0x00, 0x74, 0x05, 0xe8, 0xd6, 0xf7,
-  0xff, 0xff, 0x85, 0xc9, 0x75, 0x0f, 0xb8, 0x17, 0x04, 0x00, 0x00, 0x8a,
-  0x00, 0xa8, 0x08, 0x0f, 0x85, 0xec, 0xfe, 0xff, 0xff, 0xb8, 0x17, 0x04,
-  0x00, 0x00, 0x8a, 0x00, 0xa8, 0x08, 0x75, 0x10, 0xe8, 0x5f, 0x32, 0x00,
-  0x00, 0x85, 0xc0, 0x74, 0x07, 0xe8, 0xb6, 0x1f, 0x00, 0x00, 0xeb, 0xf0,
-  0x85, 0xc9, 0x0f, 0x84, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0x70, 0x0e, 0x00,
-  0x00, 0xfe, 0xc0, 0x8d, 0x5d, 0xe8, 0x0f, 0xb6, 0xd0, 0x89, 0xc8, 0xe8,
-  0xc8, 0xf9, 0xff, 0xff, 0x89, 0xc7, 0x85, 0xc0, 0x0f, 0x85, 0x8c, 0x00,
-  0x00, 0x00, 0x8b, 0x45, 0xe8, 0x3d, 0x00, 0x4b, 0x00, 0x00, 0x75, 0x47,
-  0xff, 0x0d, 0x6c, 0x0e, 0x00, 0x00, 0x83, 0x3d, 0x6c, 0x0e, 0x00, 0x00,
-  0x00, 0x7d, 0x24, 0x31, 0xc0, 0xa3, 0x6c, 0x0e, 0x00, 0x00, 0x8b, 0x0d,
-  0x68, 0x0e, 0x00, 0x00, 0x83, 0x3c, 0x01, 0x00, 0x74, 0x0b, 0xff, 0x05,
-  0x6c, 0x0e, 0x00, 0x00, 0x83, 0xc0, 0x0c, 0xeb, 0xe9, 0xff, 0x0d, 0x6c,
-  0x0e, 0x00, 0x00, 0x6b, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0x8b, 0x0d,
-  0x68, 0x0e, 0x00, 0x00, 0x01, 0xc1, 0xe9, 0x55, 0xfe, 0xff, 0xff, 0x3d,
-  0x00, 0x4d, 0x00, 0x00, 0x75, 0x34, 0xff, 0x05, 0x6c, 0x0e, 0x00, 0x00,
-  0x6b, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0x8b, 0x15, 0x68, 0x0e, 0x00,
-  0x00, 0x83, 0x3c, 0x02, 0x00, 0x75, 0x07, 0x31, 0xc0, 0xa3, 0x6c, 0x0e,
-  0x00, 0x00, 0x6b, 0x05, 0x6c, 0x0e, 0x00, 0x00, 0x0c, 0x8b, 0x0d, 0x68,
-  0x0e, 0x00, 0x00, 0x01, 0xc1, 0xe9, 0x1a, 0xfe, 0xff, 0xff, 0xb8, 0x17,
-  0x04, 0x00, 0x00, 0x8a, 0x00, 0xa8, 0x08, 0x75, 0xf5, 0xc7, 0x05, 0x6c,
-  0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xdc, 0xf6, 0xff, 0xff,
-  0x89, 0xf9, 0x89, 0xc8, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x56, 0x57, 0x83, 0xec, 0x3c,
-  0x89, 0xc6, 0x89, 0x55, 0xc4, 0x89, 0x4d, 0xe4, 0x83, 0xfb, 0x01, 0x73,
-  0x05, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xc4, 0x89, 0x5d, 0xd0,
-  0x31, 0xd2, 0x80, 0x38, 0x00, 0x74, 0x20, 0x80, 0x38, 0x0a, 0x75, 0x07,
-  0xff, 0x45, 0xd0, 0x31, 0xd2, 0xeb, 0x0e, 0x80, 0x38, 0x20, 0x72, 0x09,
-  0x42, 0x3b, 0x55, 0xe4, 0x76, 0x03, 0x89, 0x55, 0xe4, 0x40, 0x80, 0x38,
-  0x00, 0x75, 0xe0, 0x83, 0x45, 0xe4, 0x04, 0x83, 0x7d, 0xe4, 0x50, 0x76,
-  0x07, 0xc7, 0x45, 0xe4, 0x50, 0x00, 0x00, 0x00, 0x83, 0x45, 0xd0, 0x02,
-  0x83, 0x7d, 0xd0, 0x19, 0x76, 0x07, 0xc7, 0x45, 0xd0, 0x19, 0x00, 0x00,
-  0x00, 0x0f, 0xb6, 0x0d, 0x48, 0x0e, 0x00, 0x00, 0x2b, 0x4d, 0xd0, 0x0f,
-  0xb6, 0x15, 0x47, 0x0e, 0x00, 0x00, 0xd1, 0xe9, 0x89, 0xd0, 0x0f, 0xaf,
-  0xd1, 0x8b, 0x1d, 0x3c, 0x0e, 0x00, 0x00, 0x2b, 0x45, 0xe4, 0x01, 0xd2,
-  0xd1, 0xe8, 0x01, 0xd3, 0x8d, 0x14, 0x00, 0x89, 0x46, 0x10, 0x8b, 0x45,
-  0xe4, 0x89, 0x46, 0x08, 0x8b, 0x45, 0xd0, 0x89, 0x46, 0x0c, 0x8b, 0x45,
-  0xe4, 0x0f, 0xaf, 0x45, 0xd0, 0x89, 0x4e, 0x14, 0x01, 0xd3, 0x01, 0xc0,
-  0x89, 0x1e, 0xe8, 0xf1, 0x26, 0x00, 0x00, 0x89, 0x46, 0x04, 0x85, 0xc0,
-  0x74, 0x5d, 0x31, 0xc0, 0x89, 0x45, 0xd4, 0x83, 0x7d, 0xd0, 0x00, 0x76,
-  0x52, 0x8b, 0x55, 0xd4, 0x0f, 0xb6, 0x05, 0x47, 0x0e, 0x00, 0x00, 0x0f,
-  0xaf, 0xd0, 0x8b, 0x45, 0xd4, 0x0f, 0xaf, 0x45, 0xe4, 0x31, 0xc9, 0x89,
-  0x55, 0xec, 0x89, 0x45, 0xe8, 0x83, 0x7d, 0xe4, 0x00, 0x76, 0x25, 0x01,
-  0xc0, 0x01, 0xd2, 0xff, 0x45, 0xec, 0xff, 0x45, 0xe8, 0x41, 0x83, 0xc2,
-  0x02, 0x8b, 0x7e, 0x04, 0x8b, 0x1e, 0x01, 0xc7, 0x66, 0x8b, 0x5c, 0x1a,
-  0xfe, 0x83, 0xc0, 0x02, 0x66, 0x89, 0x1f, 0x3b, 0x4d, 0xe4, 0x72, 0xdf,
-  0xff, 0x45, 0xd4, 0x8b, 0x45, 0xd4, 0x3b, 0x45, 0xd0, 0x72, 0xae, 0x66,
-  0x8b, 0x15, 0x28, 0x09, 0x00, 0x00, 0x80, 0xca, 0x20, 0xb8, 0x01, 0x00,
-  0x00, 0x00, 0x89, 0x55, 0xf4, 0x8b, 0x55, 0xd0, 0x66, 0x8b, 0x3d, 0x28,
-  0x09, 0x00, 0x00, 0x29, 0xc2, 0x81, 0xcf, 0xba, 0x00, 0x00, 0x00, 0x89,
-  0x55, 0xcc, 0x39, 0xd0, 0x73, 0x39, 0x0f, 0xb6, 0x15, 0x47, 0x0e, 0x00,
-  0x00, 0x0f, 0xaf, 0xd0, 0x8b, 0x1e, 0x8d, 0x0c, 0x12, 0x66, 0x89, 0x3c,
-  0x19, 0x8b, 0x1e, 0x01, 0xd9, 0x8b, 0x5d, 0xf4, 0x66, 0x89, 0x59, 0x02,
-  0x89, 0xd1, 0x03, 0x4d, 0xe4, 0x8b, 0x16, 0x01, 0xc9, 0x66, 0x89, 0x5c,
-  0x11, 0xfc, 0x8b, 0x16, 0x40, 0x66, 0x89, 0x7c, 0x11, 0xfe, 0x3b, 0x45,
-  0xcc, 0x72, 0xc7, 0x8b, 0x55, 0xcc, 0x0f, 0xb6, 0x05, 0x47, 0x0e, 0x00,
-  0x00, 0x0f, 0xaf, 0xd0, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xe4,
-  0x66, 0x8b, 0x3d, 0x28, 0x09, 0x00, 0x00, 0x29, 0xc8, 0x89, 0x55, 0xe0,
-  0x89, 0x45, 0xc0, 0x8d, 0x04, 0x12, 0x81, 0xcf, 0xcd, 0x00, 0x00, 0x00,
-  0xba, 0x02, 0x00, 0x00, 0x00, 0x83, 0xc0, 0x02, 0x3b, 0x4d, 0xc0, 0x73,
-  0x1a, 0x83, 0xc2, 0x02, 0x8b, 0x1e, 0x83, 0xc0, 0x02, 0x66, 0x89, 0x7c,
-  0x1a, 0xfe, 0x8b, 0x1e, 0x41, 0x66, 0x89, 0x7c, 0x03, 0xfe, 0x3b, 0x4d,
-  0xc0, 0x72, 0xe6, 0x66, 0x8b, 0x15, 0x28, 0x09, 0x00, 0x00, 0x8b, 0x06,
-  0x80, 0xca, 0xc9, 0x66, 0x89, 0x10, 0x8b, 0x45, 0xe4, 0x66, 0x8b, 0x15,
-  0x28, 0x09, 0x00, 0x00, 0x8b, 0x0e, 0x80, 0xca, 0xbb, 0x66, 0x8b, 0x1d,
-  0x28, 0x09, 0x00, 0x00, 0x66, 0x89, 0x54, 0x41, 0xfe, 0x8b, 0x45, 0xe0,
-  0x8b, 0x16, 0x80, 0xcb, 0xc8, 0x66, 0x89, 0x1c, 0x42, 0x66, 0x8b, 0x1d,
-  0x28, 0x09, 0x00, 0x00, 0x03, 0x45, 0xe4, 0x8b, 0x16, 0x80, 0xcb, 0xbc,
-  0x66, 0x89, 0x5c, 0x42, 0xfe, 0x0f, 0xb6, 0x15, 0x47, 0x0e, 0x00, 0x00,
-  0x83, 0xc2, 0x02, 0x31, 0xc0, 0x89, 0x55, 0xe0, 0x8b, 0x55, 0xc4, 0x89,
-  0x45, 0xd8, 0x89, 0x55, 0xdc, 0x80, 0x3a, 0x00, 0x0f, 0x84, 0x89, 0x00,
-  0x00, 0x00, 0x8b, 0x55, 0xd0, 0x66, 0x8b, 0x3d, 0x28, 0x09, 0x00, 0x00,
-  0x8b, 0x5d, 0xe4, 0x83, 0xcf, 0x20, 0x83, 0xea, 0x02, 0x83, 0xeb, 0x04,
-  0x89, 0x55, 0xc8, 0x8b, 0x55, 0xdc, 0x80, 0x3a, 0x0a, 0x75, 0x34, 0x8b,
-  0x4d, 0xe0, 0x01, 0xc9, 0x8d, 0x14, 0x00, 0x01, 0xca, 0x39, 0xd8, 0x73,
-  0x0d, 0x83, 0xc2, 0x02, 0x8b, 0x0e, 0x40, 0x66, 0x89, 0x7c, 0x11, 0xfe,
-  0xeb, 0xef, 0xff, 0x45, 0xd8, 0x8b, 0x55, 0xd8, 0x3b, 0x55, 0xc8, 0x73,
-  0x42, 0x0f, 0xb6, 0x15, 0x47, 0x0e, 0x00, 0x00, 0x31, 0xc0, 0x01, 0x55,
-  0xe0, 0xeb, 0x29, 0x80, 0x3a, 0x20, 0x72, 0x24, 0x39, 0xd8, 0x73, 0x1f,
-  0x66, 0x0f, 0xb6, 0x12, 0x66, 0x0b, 0x15, 0x28, 0x09, 0x00, 0x00, 0x89,
-  0x55, 0xf0, 0x8b, 0x55, 0xe0, 0x01, 0xc2, 0x8b, 0x0e, 0x01, 0xd2, 0x01,
-  0xca, 0x8b, 0x4d, 0xf0, 0x66, 0x89, 0x0a, 0x40, 0xff, 0x45, 0xdc, 0x8b,
-  0x55, 0xdc, 0x80, 0x3a, 0x00, 0x75, 0x90, 0x8b, 0x7d, 0xe4, 0x66, 0x8b,
-  0x1d, 0x28, 0x09, 0x00, 0x00, 0x8b, 0x55, 0xd0, 0x80, 0xcb, 0x20, 0x83,
-  0xea, 0x02, 0x83, 0xef, 0x04, 0x89, 0x55, 0xbc, 0x8b, 0x55, 0xd8, 0x3b,
-  0x55, 0xbc, 0x73, 0x2c, 0x8b, 0x4d, 0xe0, 0x01, 0xc9, 0x8d, 0x14, 0x00,
-  0x01, 0xca, 0x39, 0xf8, 0x73, 0x0d, 0x83, 0xc2, 0x02, 0x8b, 0x0e, 0x40,
-  0x66, 0x89, 0x5c, 0x11, 0xfe, 0xeb, 0xef, 0xff, 0x45, 0xd8, 0x0f, 0xb6,
-  0x15, 0x47, 0x0e, 0x00, 0x00, 0x31, 0xc0, 0x01, 0x55, 0xe0, 0xeb, 0xcc,
-  0x8b, 0x45, 0xe4, 0x89, 0x46, 0x08, 0x8b, 0x45, 0xd0, 0x89, 0x46, 0x0c,
-  0xb8, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xf8, 0x5f, 0x5e, 0x5d, 0xc3,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x0c, 0x89,
-  0xc2, 0x85, 0xc0, 0x0f, 0x84, 0x80, 0x00, 0x00, 0x00, 0x83, 0x78, 0x04,
-  0x00, 0x0f, 0x84, 0x70, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x89, 0x45, 0xe0,
-  0x83, 0x7a, 0x0c, 0x00, 0x76, 0x56, 0x8b, 0x45, 0xe0, 0x0f, 0xaf, 0x42,
-  0x08, 0x8b, 0x4d, 0xe0, 0x89, 0x45, 0xe8, 0x0f, 0xb6, 0x05, 0x47, 0x0e,
-  0x00, 0x00, 0x0f, 0xaf, 0xc8, 0x31, 0xdb, 0x89, 0x4d, 0xe4, 0x83, 0x7a,
-  0x08, 0x00, 0x76, 0x29, 0x8d, 0x04, 0x09, 0x8b, 0x4d, 0xe8, 0x01, 0xc9,
-  0xff, 0x45, 0xe8, 0xff, 0x45, 0xe4, 0x43, 0x83, 0xc1, 0x02, 0x8b, 0x3a,
-  0x8b, 0x72, 0x04, 0x01, 0xc7, 0x66, 0x8b, 0x74, 0x31, 0xfe, 0x66, 0x89,
-  0x37, 0x83, 0xc0, 0x02, 0x3b, 0x5a, 0x08, 0x72, 0xdf, 0xff, 0x45, 0xe0,
-  0x8b, 0x45, 0xe0, 0x3b, 0x42, 0x0c, 0x72, 0xaa, 0x8b, 0x42, 0x04, 0xe8,
-  0xf4, 0x22, 0x00, 0x00, 0xc7, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc7,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x83, 0xec, 0x1c, 0xb9, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xd0, 0xc7,
-  0x45, 0xe8, 0x08, 0x00, 0x00, 0x00, 0xbe, 0x50, 0x4c, 0x00, 0x00, 0xbb,
-  0x02, 0x00, 0x00, 0x00, 0x89, 0xc2, 0xf3, 0xa5, 0x8d, 0x45, 0xd0, 0xb9,
-  0x12, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xfa, 0xfb,
-  0xff, 0xff, 0x85, 0xc0, 0x0f, 0x84, 0xe1, 0x00, 0x00, 0x00, 0x8b, 0x45,
-  0xd8, 0x83, 0xe8, 0x0e, 0x8b, 0x4d, 0xe0, 0xd1, 0xe8, 0x01, 0xc1, 0x8a,
-  0x45, 0xe4, 0x02, 0x45, 0xdc, 0x2c, 0x02, 0x0f, 0xb6, 0xd0, 0x0f, 0xb6,
-  0xc1, 0xc6, 0x05, 0x46, 0x0e, 0x00, 0x00, 0x70, 0xe8, 0x2b, 0xe2, 0xff,
-  0xff, 0xb8, 0x59, 0x07, 0x00, 0x00, 0xe8, 0xe9, 0xe3, 0xff, 0xff, 0xb8,
-  0x5c, 0x07, 0x00, 0x00, 0xc6, 0x05, 0x46, 0x0e, 0x00, 0x00, 0x71, 0xe8,
-  0xd8, 0xe3, 0xff, 0xff, 0xb8, 0x5e, 0x07, 0x00, 0x00, 0xc6, 0x05, 0x46,
-  0x0e, 0x00, 0x00, 0x70, 0xe8, 0xc7, 0xe3, 0xff, 0xff, 0x8a, 0x45, 0xe4,
-  0x02, 0x45, 0xdc, 0x2c, 0x02, 0x0f, 0xb6, 0xd0, 0x8a, 0x45, 0xe8, 0x00,
-  0xc8, 0x0f, 0xb6, 0xc0, 0xe8, 0xe7, 0xe1, 0xff, 0xff, 0xb8, 0x59, 0x07,
-  0x00, 0x00, 0xe8, 0xa5, 0xe3, 0xff, 0xff, 0xb8, 0x63, 0x07, 0x00, 0x00,
-  0xc6, 0x05, 0x46, 0x0e, 0x00, 0x00, 0x71, 0xe8, 0x94, 0xe3, 0xff, 0xff,
-  0xb8, 0x65, 0x07, 0x00, 0x00, 0xc6, 0x05, 0x46, 0x0e, 0x00, 0x00, 0x70,
-  0xe8, 0x83, 0xe3, 0xff, 0xff, 0xff, 0x15, 0x74, 0x0e, 0x00, 0x00, 0xe8,
-  0xc8, 0x2c, 0x00, 0x00, 0x85, 0xc0, 0x74, 0xf1, 0xe8, 0x1f, 0x1a, 0x00,
-  0x00, 0x85, 0xc0, 0x75, 0x08, 0xe8, 0x16, 0x1a, 0x00, 0x00, 0xc1, 0xe0,
-  0x08, 0x83, 0xf8, 0x59, 0x74, 0x05, 0x83, 0xf8, 0x79, 0x75, 0x07, 0xbe,
-  0x01, 0x00, 0x00, 0x00, 0xeb, 0x11, 0x83, 0xf8, 0x4e, 0x74, 0x0a, 0x83,
-  0xf8, 0x6e, 0x74, 0x05, 0x83, 0xf8, 0x1b, 0x75, 0xc0, 0x31, 0xf6, 0x8d,
-  0x45, 0xd0, 0xe8, 0x3d, 0xfe, 0xff, 0xff, 0x89, 0xf0, 0x8d, 0x65, 0xec,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x56, 0x83, 0xec, 0x0c, 0x89, 0x45, 0xe4, 0xa0, 0x44, 0x0e,
-  0x00, 0x00, 0x88, 0x45, 0xec, 0xa0, 0x45, 0x0e, 0x00, 0x00, 0x88, 0x45,
-  0xe8, 0x83, 0x3d, 0x4c, 0x0e, 0x00, 0x00, 0x00, 0x75, 0x17, 0xb8, 0x00,
-  0x01, 0x00, 0x00, 0xe8, 0x7c, 0x22, 0x00, 0x00, 0xa3, 0x4c, 0x0e, 0x00,
-  0x00, 0x85, 0xc0, 0x0f, 0x84, 0x16, 0x01, 0x00, 0x00, 0x81, 0x7d, 0xe4,
-  0xff, 0x00, 0x00, 0x00, 0x76, 0x07, 0xc7, 0x45, 0xe4, 0xff, 0x00, 0x00,
-  0x00, 0xa1, 0x4c, 0x0e, 0x00, 0x00, 0x31, 0xc9, 0xc6, 0x00, 0x00, 0x8a,
-  0x45, 0xec, 0x00, 0xc8, 0x0f, 0xb6, 0x55, 0xe8, 0x0f, 0xb6, 0xc0, 0xe8,
-  0xfc, 0xe0, 0xff, 0xff, 0xe8, 0xd7, 0xe2, 0xff, 0xff, 0xe8, 0x4a, 0xd8,
-  0xff, 0xff, 0xe8, 0x65, 0x19, 0x00, 0x00, 0x89, 0xc3, 0x85, 0xc0, 0x75,
-  0x0a, 0xe8, 0x5a, 0x19, 0x00, 0x00, 0x89, 0xc3, 0xc1, 0xe3, 0x08, 0x83,
-  0xfb, 0x08, 0x75, 0x2a, 0x85, 0xc9, 0x76, 0xe2, 0x8a, 0x45, 0xec, 0x49,
-  0x00, 0xc8, 0x0f, 0xb6, 0x5d, 0xe8, 0x0f, 0xb6, 0xf0, 0x89, 0xda, 0x89,
-  0xf0, 0xe8, 0xbe, 0xe0, 0xff, 0xff, 0xb8, 0x20, 0x00, 0x00, 0x00, 0xe8,
-  0xd0, 0xe1, 0xff, 0xff, 0x89, 0xda, 0x89, 0xf0, 0xeb, 0xad, 0x83, 0xfb,
-  0x1b, 0x75, 0x29, 0xa1, 0x4c, 0x0e, 0x00, 0x00, 0x31, 0xc9, 0xc6, 0x00,
-  0x00, 0x8a, 0x45, 0xec, 0x00, 0xc8, 0x0f, 0xb6, 0x55, 0xe8, 0x0f, 0xb6,
-  0xc0, 0xe8, 0x8e, 0xe0, 0xff, 0xff, 0xe8, 0x69, 0xe2, 0xff, 0xff, 0xe8,
-  0xdc, 0xd7, 0xff, 0xff, 0x31, 0xc0, 0xeb, 0x6f, 0x83, 0xfb, 0x0d, 0x74,
-  0x45, 0x83, 0xfb, 0x20, 0x7d, 0x04, 0x85, 0xdb, 0x7d, 0x80, 0x3b, 0x4d,
-  0xe4, 0x0f, 0x83, 0x77, 0xff, 0xff, 0xff, 0x8a, 0x45, 0xec, 0x0f, 0xb6,
-  0x75, 0xe8, 0x00, 0xc8, 0x89, 0xf2, 0x0f, 0xb6, 0xc0, 0xe8, 0x56, 0xe0,
-  0xff, 0xff, 0x0f, 0xb6, 0xc3, 0xe8, 0x6a, 0xe1, 0xff, 0xff, 0x8b, 0x15,
-  0x4c, 0x0e, 0x00, 0x00, 0x89, 0xc8, 0x41, 0x88, 0x1c, 0x02, 0x8a, 0x45,
-  0xec, 0x00, 0xc8, 0x89, 0xf2, 0xe9, 0x32, 0xff, 0xff, 0xff, 0xa1, 0x4c,
-  0x0e, 0x00, 0x00, 0x0f, 0xb6, 0x55, 0xe8, 0xc6, 0x04, 0x01, 0x00, 0x0f,
-  0xb6, 0x45, 0xec, 0xe8, 0x20, 0xe0, 0xff, 0xff, 0xe8, 0xfb, 0xe1, 0xff,
-  0xff, 0xe8, 0x6e, 0xd7, 0xff, 0xff, 0xa1, 0x4c, 0x0e, 0x00, 0x00, 0x8d,
-  0x65, 0xf0, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x52, 0xba, 0x60, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0xa8, 0x03, 0x75, 0xec, 0xa2, 0xa1, 0x0e, 0x00, 0x00, 0x5a, 0xc3,
-  0x52, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x3d, 0xff, 0x00,
-  0x00, 0x00, 0x0f, 0x95, 0xc0, 0x0f, 0xb6, 0xc0, 0x5a, 0xc3, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x83, 0xec, 0x2c, 0xc6, 0x45, 0xcc,
-  0xad, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x80,
-  0x25, 0xa0, 0x0e, 0x00, 0x00, 0xfe, 0x31, 0xdb, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x09, 0x8a, 0x45, 0xcc, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0xee, 0xe8, 0x87, 0xff, 0xff, 0xff, 0xc6, 0x45, 0xdc,
-  0x47, 0xc6, 0x45, 0xd0, 0x60, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02,
-  0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45, 0xd0,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x91, 0x02,
-  0x00, 0x00, 0x8a, 0x45, 0xdc, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x88, 0x45, 0xd4, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09,
-  0x8a, 0x45, 0xd4, 0xba, 0x60, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f,
-  0x84, 0x52, 0x02, 0x00, 0x00, 0xc6, 0x45, 0xf0, 0xa8, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0xf6, 0xc4, 0x02, 0x75, 0x09, 0x8a, 0x45, 0xf0, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0xee, 0xc6, 0x45, 0xd8, 0xd3, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x80, 0x0d, 0xa0, 0x0e, 0x00, 0x00, 0x01,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45, 0xd8, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xe0, 0x01, 0x00, 0x00, 0xc6,
-  0x45, 0xec, 0xaa, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45, 0xec, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xa3, 0x01, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0x39, 0x01, 0x00, 0x00, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xaa, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0x23, 0x01, 0x00, 0x00, 0xf6, 0x05, 0xa0, 0x0e,
-  0x00, 0x00, 0x01, 0x0f, 0x84, 0x16, 0x01, 0x00, 0x00, 0xf6, 0x05, 0xa1,
-  0x0e, 0x00, 0x00, 0x20, 0x0f, 0x84, 0x09, 0x01, 0x00, 0x00, 0xc6, 0x45,
-  0xe0, 0xd3, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45, 0xe0, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xcc, 0x00, 0x00, 0x00, 0xc6,
-  0x45, 0xc8, 0x55, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45, 0xc8, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x8f, 0x00, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x44, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x22, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x74, 0x29, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x83, 0xf8, 0x55, 0x75, 0x19, 0xf6, 0x05,
-  0xa0, 0x0e, 0x00, 0x00, 0x01, 0x74, 0x10, 0xf6, 0x05, 0xa1, 0x0e, 0x00,
-  0x00, 0x20, 0x74, 0x07, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x04, 0x85,
-  0xdb, 0x74, 0x30, 0xc6, 0x45, 0xe8, 0xa8, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6,
-  0xc4, 0x02, 0x75, 0x12, 0x8a, 0x45, 0xe8, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0xee, 0xeb, 0x07, 0x80, 0x25, 0xa0, 0x0e, 0x00, 0x00, 0xfe, 0xc6, 0x45,
-  0xe4, 0xae, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x75, 0x09, 0x8a,
-  0x45, 0xe4, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x89, 0xd8, 0x8d, 0x65,
-  0xf4, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0, 0x55, 0x89, 0xe5, 0x53,
-  0x51, 0x52, 0x83, 0xec, 0x20, 0x88, 0xc3, 0xc6, 0x45, 0xe4, 0xe7, 0xb7,
-  0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88,
-  0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8,
-  0xee, 0x84, 0xe4, 0x0f, 0x84, 0x84, 0x0a, 0x00, 0x00, 0x8a, 0x7d, 0xe4,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0x49, 0x0a, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x0f, 0x84, 0xdf, 0x09, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85,
-  0xc9, 0x09, 0x00, 0x00, 0xc6, 0x45, 0xd4, 0xe8, 0xb7, 0xd4, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4,
-  0x0f, 0x84, 0x8b, 0x09, 0x00, 0x00, 0x8a, 0x7d, 0xd4, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74,
-  0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f,
-  0x84, 0x50, 0x09, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75,
-  0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xe6,
-  0x08, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f,
-  0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xd0, 0x08, 0x00,
-  0x00, 0x0f, 0xb6, 0xc3, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xc1, 0xf8, 0x06,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x83, 0xe0, 0x03, 0xb7, 0xd4, 0x88, 0x45,
-  0xd8, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x8a, 0x08, 0x00, 0x00, 0x8a,
-  0x7d, 0xd8, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88,
-  0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x4f, 0x08, 0x00, 0x00, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x0f, 0x84, 0xe5, 0x07, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00,
-  0x0f, 0x85, 0xcf, 0x07, 0x00, 0x00, 0xc6, 0x45, 0xe8, 0xe8, 0xb7, 0xd4,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0x91, 0x07, 0x00, 0x00, 0x8a, 0x7d, 0xe8, 0xb9,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84,
-  0xe4, 0x0f, 0x84, 0x56, 0x07, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24,
-  0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f,
-  0x84, 0xec, 0x06, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xd6,
-  0x06, 0x00, 0x00, 0x0f, 0xb6, 0xc3, 0xc6, 0x45, 0xec, 0xd4, 0xc1, 0xf8,
-  0x04, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x83, 0xe0, 0x03, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x88, 0xc7, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4,
-  0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45,
-  0xec, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x8e,
-  0x06, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00,
-  0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x56, 0x06, 0x00, 0x00, 0xb9,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x0f, 0x84, 0xec, 0x05, 0x00, 0x00, 0xba, 0x60, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00,
-  0x00, 0x0f, 0x85, 0xd6, 0x05, 0x00, 0x00, 0xc6, 0x45, 0xf0, 0xe8, 0xb7,
-  0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88,
-  0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8,
-  0xee, 0x84, 0xe4, 0x0f, 0x84, 0x98, 0x05, 0x00, 0x00, 0x8a, 0x7d, 0xf0,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0x5d, 0x05, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x0f, 0x84, 0xf3, 0x04, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85,
-  0xdd, 0x04, 0x00, 0x00, 0x0f, 0xb6, 0xc3, 0xc6, 0x45, 0xe0, 0xd4, 0xc1,
-  0xf8, 0x02, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x83, 0xe0, 0x03, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x88, 0xc7, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6,
-  0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a,
-  0x45, 0xe0, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84,
-  0x95, 0x04, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f,
-  0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x5d, 0x04, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xf3, 0x03, 0x00, 0x00, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xdd, 0x03, 0x00, 0x00, 0xc6, 0x45, 0xdc, 0xe8,
-  0xb7, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88,
-  0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x9f, 0x03, 0x00, 0x00, 0x8a, 0x7d,
-  0xdc, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88,
-  0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8,
-  0xee, 0x84, 0xe4, 0x0f, 0x84, 0x64, 0x03, 0x00, 0x00, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24,
-  0x01, 0x0f, 0x84, 0xfa, 0x02, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f,
-  0x85, 0xe4, 0x02, 0x00, 0x00, 0x88, 0xdf, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0x80, 0xe7, 0x03, 0xba, 0x64, 0x00, 0x00, 0x00, 0xb3, 0xd4, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0xa5, 0x02, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xfb, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4,
-  0x0f, 0x84, 0x6b, 0x02, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84,
-  0x01, 0x02, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xeb, 0x01,
-  0x00, 0x00, 0xb7, 0xf3, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0xb3, 0xd4, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4,
-  0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xaf, 0x01,
-  0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x88, 0xfb, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f,
-  0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x75, 0x01, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0x0b, 0x01, 0x00, 0x00, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xf5, 0x00, 0x00, 0x00, 0xb7, 0x14, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0xb3, 0xd4, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0xb9, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xfb, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0,
-  0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4,
-  0x0f, 0x84, 0x7f, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x75, 0x44, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x22, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x74, 0x19,
-  0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d,
-  0xfa, 0x00, 0x00, 0x00, 0x75, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb,
-  0x02, 0x31, 0xc0, 0x8d, 0x65, 0xf4, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x90,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x83, 0xec, 0x20, 0x88, 0xc3, 0xc6,
-  0x45, 0xe4, 0xe7, 0xb7, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02,
-  0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x88, 0x09, 0x00,
-  0x00, 0x8a, 0x7d, 0xe4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f,
-  0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x4d, 0x09, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xe3, 0x08, 0x00, 0x00, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xcd, 0x08, 0x00, 0x00, 0xc6, 0x45, 0xe0, 0xe8,
-  0xb7, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88,
-  0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x8f, 0x08, 0x00, 0x00, 0x8a, 0x7d,
-  0xe0, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88,
-  0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8,
-  0xee, 0x84, 0xe4, 0x0f, 0x84, 0x54, 0x08, 0x00, 0x00, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24,
-  0x01, 0x0f, 0x84, 0xea, 0x07, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f,
-  0x85, 0xd4, 0x07, 0x00, 0x00, 0x0f, 0xb6, 0xc3, 0xc6, 0x45, 0xdc, 0xd4,
-  0xc1, 0xf8, 0x06, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x83, 0xe0, 0x03, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x88, 0xc7, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09,
-  0x8a, 0x45, 0xdc, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f,
-  0x84, 0x8c, 0x07, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02,
-  0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00,
-  0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x54, 0x07, 0x00,
-  0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xea, 0x06, 0x00, 0x00, 0xba,
-  0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa,
-  0x00, 0x00, 0x00, 0x0f, 0x85, 0xd4, 0x06, 0x00, 0x00, 0xc6, 0x45, 0xec,
-  0xe8, 0xb7, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x96, 0x06, 0x00, 0x00, 0x8a,
-  0x7d, 0xec, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88,
-  0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x5b, 0x06, 0x00, 0x00, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x0f, 0x84, 0xf1, 0x05, 0x00, 0x00, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00,
-  0x0f, 0x85, 0xdb, 0x05, 0x00, 0x00, 0x0f, 0xb6, 0xc3, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xc1, 0xf8, 0x04, 0xba, 0x64, 0x00, 0x00, 0x00, 0x83, 0xe0,
-  0x03, 0xb7, 0xd4, 0x88, 0x45, 0xf0, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84,
-  0x95, 0x05, 0x00, 0x00, 0x8a, 0x7d, 0xf0, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02,
-  0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6,
-  0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba,
-  0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x5a,
-  0x05, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75,
-  0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b,
-  0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88,
-  0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xf0, 0x04, 0x00,
-  0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0,
-  0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xda, 0x04, 0x00, 0x00, 0xc6,
-  0x45, 0xd4, 0xe8, 0xb7, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03,
-  0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02,
-  0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x9c, 0x04, 0x00,
-  0x00, 0x8a, 0x7d, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f,
-  0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00,
-  0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x61, 0x04, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xf7, 0x03, 0x00, 0x00, 0xba, 0x60,
-  0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00,
-  0x00, 0x00, 0x0f, 0x85, 0xe1, 0x03, 0x00, 0x00, 0x0f, 0xb6, 0xc3, 0xc6,
-  0x45, 0xe8, 0xd4, 0xc1, 0xf8, 0x02, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x83,
-  0xe0, 0x03, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xc7, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84,
-  0xc0, 0x74, 0x09, 0x8a, 0x45, 0xe8, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0x99, 0x03, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08,
-  0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84,
-  0x61, 0x03, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0xf7, 0x02,
-  0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6,
-  0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xe1, 0x02, 0x00, 0x00,
-  0xb7, 0xe8, 0xc6, 0x45, 0xd8, 0xd4, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4,
-  0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x09, 0x8a, 0x45,
-  0xd8, 0xba, 0x64, 0x00, 0x00, 0x00, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xa2,
-  0x02, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75,
-  0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94,
-  0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00,
-  0x88, 0xf8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x6a, 0x02, 0x00, 0x00, 0xb9,
-  0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1,
-  0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x48, 0xb9, 0xff, 0xff,
-  0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4,
-  0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00,
-  0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01,
-  0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88,
-  0xe0, 0x24, 0x01, 0x0f, 0x84, 0x00, 0x02, 0x00, 0x00, 0xba, 0x60, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00,
-  0x00, 0x0f, 0x85, 0xea, 0x01, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00,
-  0x80, 0xe3, 0x03, 0xba, 0x64, 0x00, 0x00, 0x00, 0xb7, 0xd4, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4,
-  0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xf8, 0xee,
-  0x84, 0xe4, 0x0f, 0x84, 0xad, 0x01, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x02, 0x74, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08,
-  0xba, 0x60, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4, 0x0f, 0x84,
-  0x75, 0x01, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00,
-  0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01,
-  0x75, 0x48, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x26,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0,
-  0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25,
-  0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x0f, 0x84, 0x0b, 0x01,
-  0x00, 0x00, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x0f, 0xb6,
-  0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xf5, 0x00, 0x00, 0x00,
-  0xb7, 0xe9, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00,
-  0xb3, 0xd4, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49,
-  0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f,
-  0x94, 0xc0, 0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x64, 0x00, 0x00,
-  0x00, 0x88, 0xd8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0xb9, 0x00, 0x00, 0x00,
-  0xb9, 0xff, 0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x88, 0xfb,
-  0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x02, 0x74, 0x03, 0x49, 0x75, 0xf4,
-  0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0xf6, 0xc4, 0x02, 0x0f, 0x94, 0xc0,
-  0x88, 0xc4, 0x84, 0xc0, 0x74, 0x08, 0xba, 0x60, 0x00, 0x00, 0x00, 0x88,
-  0xd8, 0xee, 0x84, 0xe4, 0x0f, 0x84, 0x7f, 0x00, 0x00, 0x00, 0xb9, 0xff,
-  0xff, 0x00, 0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88,
-  0xc4, 0xa8, 0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e,
-  0x00, 0x00, 0x88, 0xe0, 0x24, 0x01, 0x75, 0x44, 0xb9, 0xff, 0xff, 0x00,
-  0x00, 0xba, 0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8,
-  0x01, 0x75, 0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00,
-  0x88, 0xe0, 0x24, 0x01, 0x75, 0x22, 0xb9, 0xff, 0xff, 0x00, 0x00, 0xba,
-  0x64, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec, 0x88, 0xc4, 0xa8, 0x01, 0x75,
-  0x03, 0x49, 0x75, 0xf4, 0x88, 0x25, 0xa1, 0x0e, 0x00, 0x00, 0x88, 0xe0,
-  0x24, 0x01, 0x74, 0x19, 0xba, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xc0, 0xec,
-  0x0f, 0xb6, 0xc0, 0x3d, 0xfa, 0x00, 0x00, 0x00, 0x75, 0x07, 0xb8, 0x01,
-  0x00, 0x00, 0x00, 0xeb, 0x02, 0x31, 0xc0, 0x8d, 0x65, 0xf4, 0x5a, 0x59,
-  0x5b, 0x5d, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x31, 0xd2, 0xa1, 0x20, 0x10, 0x00, 0x00,
-  0x89, 0x15, 0x20, 0x10, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x02, 0x5a, 0xc3,
-  0xb4, 0x08, 0xcd, 0x21, 0x25, 0xff, 0x00, 0x00, 0x00, 0x5a, 0xc3, 0x00,
-  0x8b, 0xcb, 0x80, 0xe1, 0x3f, 0xf6, 0xc1, 0x20, 0x75, 0x06, 0x0f, 0xad,
-  0xd0, 0xd3, 0xea, 0xc3, 0x8b, 0xc2, 0x83, 0xe9, 0x20, 0x33, 0xd2, 0xd3,
-  0xe8, 0xc3, 0x8b, 0xcb, 0x80, 0xe1, 0x3f, 0xf6, 0xc1, 0x20, 0x75, 0x06,
-  0x0f, 0xad, 0xd0, 0xd3, 0xfa, 0xc3, 0x8b, 0xc2, 0x80, 0xe9, 0x20, 0xc1,
-  0xfa, 0x1f, 0xd3, 0xf8, 0xc3, 0x8b, 0xcb, 0x80, 0xe1, 0x3f, 0xf6, 0xc1,
-  0x20, 0x75, 0x06, 0x0f, 0xa5, 0xc2, 0xd3, 0xe0, 0xc3, 0x8b, 0xd0, 0x80,
-  0xe9, 0x20, 0x33, 0xc0, 0xd3, 0xe2, 0xc3, 0x00, 0xe9, 0x4a, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x3c, 0x30, 0x72, 0x0e, 0x3c, 0x39, 0x77, 0x0a, 0x25, 0xff, 0x00,
-  0x00, 0x00, 0x83, 0xe8, 0x30, 0x5a, 0xc3, 0x25, 0xff, 0x00, 0x00, 0x00,
-  0xe8, 0xf3, 0x11, 0x00, 0x00, 0x89, 0xc2, 0x3c, 0x61, 0x72, 0x04, 0x3c,
-  0x69, 0x76, 0x1a, 0x3c, 0x6a, 0x72, 0x04, 0x3c, 0x72, 0x76, 0x08, 0x3c,
-  0x73, 0x72, 0x17, 0x3c, 0x7a, 0x77, 0x13, 0x25, 0xff, 0x00, 0x00, 0x00,
-  0x83, 0xe8, 0x57, 0x5a, 0xc3, 0x31, 0xc0, 0x88, 0xd0, 0x83, 0xe8, 0x57,
-  0x5a, 0xc3, 0xb8, 0x25, 0x00, 0x00, 0x00, 0x5a, 0xc3, 0x8d, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x40, 0x00,
-  0x56, 0x57, 0x55, 0x83, 0xec, 0x28, 0x89, 0x44, 0x24, 0x0c, 0x89, 0x54,
-  0x24, 0x18, 0x89, 0xdf, 0x89, 0x4c, 0x24, 0x04, 0x85, 0xd2, 0x75, 0x14,
-  0x8b, 0x74, 0x24, 0x0c, 0x31, 0xc0, 0x8a, 0x06, 0xf6, 0x80, 0x2d, 0x09,
-  0x00, 0x00, 0x02, 0x74, 0x07, 0x46, 0xeb, 0xf0, 0x89, 0x02, 0xeb, 0xe8,
-  0x88, 0x44, 0x24, 0x24, 0x3c, 0x2b, 0x0f, 0x85, 0xc4, 0x00, 0x00, 0x00,
-  0x46, 0x85, 0xff, 0x0f, 0x85, 0xea, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x30,
-  0x0f, 0x85, 0xc8, 0x00, 0x00, 0x00, 0x8a, 0x4e, 0x01, 0x80, 0xf9, 0x78,
-  0x0f, 0x85, 0xb3, 0x00, 0x00, 0x00, 0xbf, 0x10, 0x00, 0x00, 0x00, 0x80,
-  0x3e, 0x30, 0x0f, 0x84, 0xf4, 0x00, 0x00, 0x00, 0xc6, 0x44, 0x24, 0x20,
-  0x00, 0x89, 0x74, 0x24, 0x14, 0x89, 0xfd, 0x31, 0xc9, 0x31, 0xd2, 0xc1,
-  0xe5, 0x03, 0x31, 0xc0, 0x8a, 0x06, 0xe8, 0x1d, 0xff, 0xff, 0xff, 0x89,
-  0x44, 0x24, 0x1c, 0x39, 0xf8, 0x0f, 0x8c, 0xe7, 0x00, 0x00, 0x00, 0x3b,
-  0x74, 0x24, 0x14, 0x75, 0x04, 0x8b, 0x74, 0x24, 0x0c, 0x8b, 0x7c, 0x24,
-  0x18, 0x85, 0xff, 0x74, 0x02, 0x89, 0x37, 0x83, 0x7c, 0x24, 0x04, 0x01,
-  0x75, 0x1d, 0x81, 0xfa, 0x00, 0x00, 0x00, 0x80, 0x77, 0x02, 0x75, 0x13,
-  0x81, 0xfa, 0x00, 0x00, 0x00, 0x80, 0x75, 0x16, 0x85, 0xc9, 0x75, 0x12,
-  0x80, 0x7c, 0x24, 0x24, 0x2d, 0x75, 0x0b, 0x80, 0x7c, 0x24, 0x20, 0x00,
-  0x0f, 0x84, 0x28, 0x01, 0x00, 0x00, 0xb8, 0x0e, 0x00, 0x00, 0x00, 0xe8,
-  0x34, 0x11, 0x00, 0x00, 0x83, 0x7c, 0x24, 0x04, 0x00, 0x0f, 0x84, 0xf4,
-  0x00, 0x00, 0x00, 0x80, 0x7c, 0x24, 0x24, 0x2d, 0x0f, 0x85, 0xf7, 0x00,
-  0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x80, 0x31, 0xc0, 0x83, 0xc4, 0x28,
-  0x5d, 0x5f, 0x5e, 0xc3, 0x3c, 0x2d, 0x0f, 0x84, 0x34, 0xff, 0xff, 0xff,
-  0xe9, 0x30, 0xff, 0xff, 0xff, 0x80, 0xf9, 0x58, 0x0f, 0x84, 0x44, 0xff,
-  0xff, 0xff, 0x80, 0x3e, 0x30, 0x75, 0x0a, 0xbf, 0x08, 0x00, 0x00, 0x00,
-  0xe9, 0x43, 0xff, 0xff, 0xff, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0x39,
-  0xff, 0xff, 0xff, 0x83, 0xff, 0x02, 0x7c, 0x13, 0x83, 0xff, 0x24, 0x7f,
-  0x0e, 0x83, 0xff, 0x10, 0x0f, 0x84, 0x1d, 0xff, 0xff, 0xff, 0xe9, 0x21,
-  0xff, 0xff, 0xff, 0xb8, 0x0d, 0x00, 0x00, 0x00, 0xe8, 0xbf, 0x10, 0x00,
-  0x00, 0x31, 0xd2, 0x31, 0xc0, 0x83, 0xc4, 0x28, 0x5d, 0x5f, 0x5e, 0xc3,
-  0x8a, 0x56, 0x01, 0x80, 0xfa, 0x78, 0x75, 0x08, 0x83, 0xc6, 0x02, 0xe9,
-  0xfc, 0xfe, 0xff, 0xff, 0x80, 0xfa, 0x58, 0x74, 0xf3, 0xe9, 0xf2, 0xfe,
-  0xff, 0xff, 0x8b, 0x9d, 0xa4, 0x0e, 0x00, 0x00, 0x39, 0xda, 0x77, 0x0a,
-  0x75, 0x0d, 0x3b, 0x8d, 0xa0, 0x0e, 0x00, 0x00, 0x76, 0x05, 0xc6, 0x44,
-  0x24, 0x20, 0x01, 0x89, 0xf8, 0x89, 0x4c, 0x24, 0x10, 0xc1, 0xf8, 0x1f,
-  0x89, 0xfb, 0x89, 0x44, 0x24, 0x08, 0x89, 0xc8, 0x8b, 0x4c, 0x24, 0x08,
-  0x89, 0x14, 0x24, 0xe8, 0x54, 0x79, 0xff, 0xff, 0x8b, 0x5c, 0x24, 0x1c,
-  0x8b, 0x4c, 0x24, 0x1c, 0xc1, 0xfb, 0x1f, 0x01, 0xc1, 0x8b, 0x04, 0x24,
-  0x11, 0xda, 0x39, 0xc2, 0x72, 0x0e, 0x75, 0x06, 0x3b, 0x4c, 0x24, 0x10,
-  0x72, 0x06, 0x46, 0xe9, 0xaa, 0xfe, 0xff, 0xff, 0xc6, 0x44, 0x24, 0x20,
-  0x01, 0x46, 0xe9, 0x9f, 0xfe, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff,
-  0x89, 0xc2, 0x83, 0xc4, 0x28, 0x5d, 0x5f, 0x5e, 0xc3, 0xb8, 0xff, 0xff,
-  0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0x7f, 0x83, 0xc4, 0x28, 0x5d, 0x5f,
-  0x5e, 0xc3, 0x80, 0x7c, 0x24, 0x24, 0x2d, 0x75, 0x07, 0xf7, 0xda, 0xf7,
-  0xd9, 0x83, 0xda, 0x00, 0x89, 0xc8, 0x83, 0xc4, 0x28, 0x5d, 0x5f, 0x5e,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x40, 0x00, 0x51, 0x31, 0xc9, 0xe8, 0xd8, 0xfd, 0xff, 0xff,
-  0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x51, 0xb9, 0x01, 0x00,
-  0x00, 0x00, 0xe8, 0xc5, 0xfd, 0xff, 0xff, 0x59, 0xc3, 0x8d, 0x40, 0x00,
-  0x51, 0x31, 0xc9, 0xe8, 0xb8, 0xfd, 0xff, 0xff, 0x59, 0xc3, 0x8d, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x51, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xa5,
-  0xfd, 0xff, 0xff, 0x59, 0xc3, 0x00, 0x00, 0x00, 0xeb, 0x60, 0x4f, 0x70,
-  0x65, 0x6e, 0x20, 0x57, 0x41, 0x54, 0x43, 0x4f, 0x4d, 0x20, 0x43, 0x2f,
-  0x43, 0x2b, 0x2b, 0x33, 0x32, 0x20, 0x52, 0x75, 0x6e, 0x2d, 0x54, 0x69,
-  0x6d, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x20, 0x50,
-  0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x43, 0x6f, 0x70, 0x79,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29, 0x20, 0x53, 0x79,
-  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x49, 0x6e, 0x63, 0x2e, 0x20, 0x31,
-  0x39, 0x38, 0x38, 0x2d, 0x32, 0x30, 0x30, 0x32, 0x2e, 0x8d, 0x40, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x00, 0x0d, 0x0a, 0xfb, 0x83,
-  0xe4, 0xfc, 0x8b, 0xdc, 0x89, 0x1d, 0x14, 0x10, 0x00, 0x00, 0x89, 0x1d,
-  0x00, 0x10, 0x00, 0x00, 0x66, 0xb8, 0x24, 0x00, 0x66, 0xa3, 0x0c, 0x10,
-  0x00, 0x00, 0xbb, 0x52, 0x41, 0x48, 0x50, 0x2b, 0xc0, 0xb4, 0x30, 0xcd,
-  0x21, 0xa2, 0x37, 0x10, 0x00, 0x00, 0x88, 0x25, 0x38, 0x10, 0x00, 0x00,
-  0x8b, 0xc8, 0x2b, 0xf6, 0xbf, 0x81, 0x00, 0x00, 0x00, 0xc1, 0xe8, 0x10,
-  0x66, 0x3d, 0x58, 0x44, 0x75, 0x3f, 0x80, 0xeb, 0x30, 0x8a, 0xc3, 0xb4,
-  0x00, 0x50, 0x66, 0x8e, 0x05, 0x0c, 0x10, 0x00, 0x00, 0x26, 0x8b, 0x1d,
-  0x5c, 0x00, 0x00, 0x00, 0x81, 0xc3, 0xff, 0x0f, 0x00, 0x00, 0x81, 0xe3,
-  0x00, 0xf0, 0xff, 0xff, 0x89, 0x1d, 0x00, 0x10, 0x00, 0x00, 0xc1, 0xeb,
-  0x0c, 0x66, 0x8c, 0xd8, 0x66, 0x8e, 0xc0, 0xb4, 0x4a, 0xcd, 0x21, 0x58,
-  0x66, 0x8c, 0xdb, 0x66, 0xb9, 0x2c, 0x00, 0xeb, 0x42, 0x66, 0xba, 0x78,
-  0x00, 0x66, 0xb8, 0x00, 0xff, 0xcd, 0x21, 0x3c, 0x00, 0x74, 0x34, 0x66,
-  0x8c, 0xe8, 0x66, 0x83, 0xf8, 0x00, 0x74, 0x06, 0x66, 0xa3, 0xc8, 0x0f,
-  0x00, 0x00, 0x66, 0xb8, 0x06, 0x00, 0x66, 0x8c, 0xdb, 0xcd, 0x31, 0xb0,
-  0x01, 0xb4, 0x00, 0x66, 0x0b, 0xd1, 0x74, 0x02, 0xb4, 0x01, 0x66, 0x8c,
-  0x05, 0x0c, 0x10, 0x00, 0x00, 0x66, 0x26, 0x8b, 0x0d, 0x2c, 0x00, 0x00,
-  0x00, 0xeb, 0x00, 0xa2, 0x2e, 0x10, 0x00, 0x00, 0x88, 0x25, 0x2f, 0x10,
-  0x00, 0x00, 0x66, 0x8e, 0xc3, 0x66, 0x26, 0x8c, 0x1d, 0x31, 0x94, 0x00,
-  0x00, 0x89, 0x35, 0x31, 0x10, 0x00, 0x00, 0x66, 0x89, 0x0d, 0x35, 0x10,
-  0x00, 0x00, 0x56, 0x66, 0x8e, 0x05, 0x0c, 0x10, 0x00, 0x00, 0xba, 0x86,
-  0x15, 0x00, 0x00, 0x83, 0xc2, 0x0f, 0x80, 0xe2, 0xf0, 0x2b, 0xc9, 0x26,
-  0x8a, 0x4f, 0xff, 0xfc, 0xb0, 0x20, 0xf3, 0xae, 0x8d, 0x77, 0xff, 0x8b,
-  0xfa, 0x66, 0x8c, 0xc3, 0x66, 0x8c, 0xda, 0x66, 0x8e, 0xdb, 0x66, 0x8e,
-  0xc2, 0x74, 0x03, 0x41, 0xf3, 0xa4, 0x2a, 0xc0, 0xaa, 0xaa, 0x5e, 0x4f,
-  0x57, 0x52, 0x66, 0x26, 0x8e, 0x1d, 0x35, 0x10, 0x00, 0x00, 0xbd, 0x00,
-  0x01, 0x00, 0x00, 0x8b, 0x06, 0x0d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x6e,
-  0x6f, 0x38, 0x37, 0x75, 0x0b, 0x80, 0x7e, 0x04, 0x3d, 0x75, 0x1b, 0x83,
-  0xcd, 0x01, 0xeb, 0x16, 0x3d, 0x6c, 0x66, 0x6e, 0x3d, 0x75, 0x0f, 0x8a,
-  0x46, 0x04, 0x0c, 0x20, 0x3c, 0x6e, 0x75, 0x06, 0x81, 0xe5, 0xff, 0xfe,
-  0xff, 0xff, 0x80, 0x3e, 0x00, 0xac, 0x75, 0xfa, 0x80, 0x3e, 0x00, 0x75,
-  0xc6, 0xac, 0x46, 0x46, 0x80, 0x3e, 0x00, 0xa4, 0x75, 0xfa, 0x1f, 0x5e,
-  0x8b, 0xdc, 0x8b, 0xc5, 0x83, 0xe5, 0x01, 0xa2, 0x2c, 0x10, 0x00, 0x00,
-  0x20, 0x25, 0x40, 0x10, 0x00, 0x00, 0x89, 0x3d, 0x10, 0x10, 0x00, 0x00,
-  0x89, 0x1d, 0xfc, 0x0f, 0x00, 0x00, 0xb9, 0x86, 0x15, 0x00, 0x00, 0xbf,
-  0x00, 0x11, 0x00, 0x00, 0x2b, 0xcf, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00,
-  0x01, 0x75, 0x0d, 0x81, 0xf9, 0x00, 0x10, 0x00, 0x00, 0x76, 0x05, 0xb9,
-  0x00, 0x10, 0x00, 0x00, 0x8a, 0xd1, 0xc1, 0xe9, 0x02, 0x2b, 0xc0, 0xf3,
-  0xab, 0x8a, 0xca, 0x80, 0xe1, 0x03, 0xf3, 0xaa, 0xb8, 0x86, 0x15, 0x00,
-  0x00, 0x83, 0xc0, 0x0f, 0x24, 0xf0, 0xa3, 0x04, 0x10, 0x00, 0x00, 0x89,
-  0x35, 0x08, 0x10, 0x00, 0x00, 0xb8, 0xff, 0x00, 0x00, 0x00, 0xe8, 0x09,
-  0x0e, 0x00, 0x00, 0x2b, 0xed, 0xe8, 0xb2, 0x0d, 0x00, 0x00, 0xeb, 0x31,
-  0x52, 0x50, 0xba, 0xec, 0x91, 0x00, 0x00, 0x66, 0xb8, 0x01, 0x3d, 0xcd,
-  0x21, 0x66, 0x8b, 0xd8, 0x5a, 0x8b, 0xf2, 0xfc, 0xac, 0x3c, 0x00, 0x75,
-  0xfb, 0x8b, 0xce, 0x2b, 0xca, 0x49, 0xb4, 0x40, 0xcd, 0x21, 0xba, 0xf0,
-  0x91, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x00, 0xb4, 0x40, 0xcd, 0x21,
-  0x58, 0x50, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xba, 0x0f, 0x00, 0x00, 0x00,
-  0xe8, 0x0f, 0x0e, 0x00, 0x00, 0x58, 0xb4, 0x4c, 0xcd, 0x21, 0x8b, 0xc0,
-  0x66, 0x2e, 0x8e, 0x1d, 0x31, 0x94, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0xa0, 0x79, 0x0a, 0x00, 0x00, 0x24, 0xf8, 0x88, 0xc4,
-  0x80, 0xcc, 0x04, 0xb9, 0x38, 0x0a, 0x00, 0x00, 0x88, 0x25, 0x79, 0x0a,
-  0x00, 0x00, 0x83, 0x3d, 0x44, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x44, 0xb8,
-  0x18, 0x00, 0x00, 0x00, 0xe8, 0xb3, 0x02, 0x00, 0x00, 0x85, 0xc0, 0x74,
-  0x42, 0x89, 0xc3, 0xa1, 0x20, 0x14, 0x00, 0x00, 0x89, 0x4b, 0x04, 0x89,
-  0x03, 0x89, 0x59, 0x08, 0xc7, 0x43, 0x08, 0x00, 0x00, 0x00, 0x00, 0x8b,
-  0x41, 0x08, 0xc6, 0x40, 0x14, 0x00, 0x8b, 0x41, 0x08, 0x83, 0xc1, 0x1a,
-  0xc7, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x89, 0x1d, 0x20, 0x14, 0x00,
-  0x00, 0x83, 0x79, 0x0c, 0x00, 0x75, 0xbc, 0x31, 0xc9, 0x89, 0x0d, 0x24,
-  0x14, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0xb8, 0x18, 0x00, 0x00, 0x00,
-  0xe8, 0x63, 0x02, 0x00, 0x00, 0x89, 0xc3, 0x85, 0xc0, 0x75, 0xb0, 0xba,
-  0x01, 0x00, 0x00, 0x00, 0xb8, 0x6c, 0x07, 0x00, 0x00, 0xe8, 0xce, 0x0f,
-  0x00, 0x00, 0xeb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x56, 0x6b, 0xc0, 0x1a, 0xbe,
-  0x38, 0x0a, 0x00, 0x00, 0x01, 0xc6, 0xa1, 0x20, 0x14, 0x00, 0x00, 0x31,
-  0xc9, 0x85, 0xc0, 0x74, 0x22, 0x8b, 0x18, 0x8b, 0x40, 0x04, 0xba, 0x01,
-  0x00, 0x00, 0x00, 0xf6, 0x40, 0x0d, 0x40, 0x75, 0x06, 0xf6, 0x40, 0x0d,
-  0x08, 0x74, 0x13, 0xe8, 0x2c, 0x10, 0x00, 0x00, 0x41, 0x89, 0xd8, 0x85,
-  0xdb, 0x75, 0xde, 0x89, 0xc8, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x39, 0xf0,
-  0x72, 0xef, 0x3d, 0xba, 0x0a, 0x00, 0x00, 0x73, 0xe2, 0x31, 0xd2, 0xeb,
-  0xde, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x40, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x00, 0xeb, 0x99, 0x8d,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x00, 0x31, 0xc0, 0xe8, 0x89,
-  0xff, 0xff, 0xff, 0xe9, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x51, 0x89, 0xc1, 0x89, 0xd0, 0x8b, 0x11, 0xe8, 0x94, 0x10, 0x00, 0x00,
-  0xff, 0x41, 0x10, 0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d,
-  0x92, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x40, 0x00, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xc6, 0x8b, 0x40, 0x08, 0x8b, 0x48, 0x0c, 0x83, 0xf9, 0x01, 0x74,
-  0x0f, 0x85, 0xc9, 0x0f, 0x85, 0x78, 0x00, 0x00, 0x00, 0xc7, 0x40, 0x0c,
-  0x01, 0x00, 0x00, 0x00, 0x8b, 0x6e, 0x0c, 0x8b, 0x46, 0x08, 0x80, 0x66,
-  0x0c, 0xcf, 0x83, 0xe5, 0x30, 0x83, 0x78, 0x08, 0x00, 0x75, 0x07, 0x89,
-  0xf0, 0xe8, 0x06, 0x11, 0x00, 0x00, 0x8a, 0x66, 0x0d, 0x31, 0xff, 0xf6,
-  0xc4, 0x04, 0x74, 0x12, 0x88, 0xe1, 0x80, 0xe1, 0xfa, 0x88, 0xcd, 0x80,
-  0xcd, 0x01, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x88, 0x6e, 0x0d, 0xb9, 0x60,
-  0x95, 0x00, 0x00, 0x89, 0xf0, 0xe8, 0x7e, 0x11, 0x00, 0x00, 0x89, 0xc2,
-  0x85, 0xff, 0x74, 0x14, 0x8a, 0x46, 0x0d, 0x24, 0xfa, 0x88, 0xc4, 0x80,
-  0xcc, 0x04, 0x88, 0x66, 0x0d, 0x89, 0xf0, 0xe8, 0x04, 0x05, 0x00, 0x00,
-  0xf6, 0x46, 0x0c, 0x20, 0x74, 0x05, 0xba, 0xff, 0xff, 0xff, 0xff, 0x89,
-  0xd0, 0x09, 0x6e, 0x0c, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x31, 0xc0, 0x5d,
-  0x5f, 0x5e, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x56, 0x89, 0xc6, 0x85, 0xc0, 0x0f, 0x84, 0xa5, 0x00,
-  0x00, 0x00, 0x8b, 0x0d, 0x58, 0x14, 0x00, 0x00, 0x85, 0xc9, 0x74, 0x40,
-  0x39, 0xc1, 0x77, 0x0c, 0x8b, 0x01, 0x01, 0xc8, 0x39, 0xf0, 0x0f, 0x87,
-  0x90, 0x00, 0x00, 0x00, 0x89, 0xca, 0x8b, 0x49, 0x04, 0x85, 0xc9, 0x74,
-  0x10, 0x39, 0xf1, 0x77, 0x0c, 0x8b, 0x01, 0x01, 0xc8, 0x39, 0xf0, 0x0f,
-  0x87, 0x77, 0x00, 0x00, 0x00, 0x8b, 0x4a, 0x08, 0x85, 0xc9, 0x74, 0x10,
-  0x39, 0xf1, 0x77, 0x0c, 0x8b, 0x01, 0x01, 0xc8, 0x39, 0xf0, 0x0f, 0x87,
-  0x60, 0x00, 0x00, 0x00, 0x8b, 0x0d, 0xd0, 0x0f, 0x00, 0x00, 0x85, 0xc9,
-  0x74, 0x34, 0x39, 0xf1, 0x77, 0x08, 0x8b, 0x01, 0x01, 0xc8, 0x39, 0xf0,
-  0x77, 0x4a, 0x89, 0xca, 0x8b, 0x49, 0x04, 0x85, 0xc9, 0x74, 0x0c, 0x39,
-  0xf1, 0x77, 0x08, 0x8b, 0x01, 0x01, 0xc8, 0x39, 0xf0, 0x77, 0x35, 0x8b,
-  0x4a, 0x08, 0x85, 0xc9, 0x74, 0x0c, 0x39, 0xf1, 0x77, 0x08, 0x8b, 0x01,
-  0x01, 0xc8, 0x39, 0xf0, 0x77, 0x22, 0x8b, 0x0d, 0xcc, 0x0f, 0x00, 0x00,
-  0x85, 0xc9, 0x74, 0x13, 0x39, 0xf1, 0x77, 0x08, 0x8b, 0x01, 0x01, 0xc8,
-  0x39, 0xf0, 0x77, 0x0c, 0x8b, 0x49, 0x08, 0x85, 0xc9, 0x75, 0xed, 0x5e,
-  0x5a, 0x59, 0x5b, 0xc3, 0xb8, 0xcc, 0x0f, 0x00, 0x00, 0x8c, 0xda, 0x81,
-  0xe2, 0xff, 0xff, 0x00, 0x00, 0x89, 0xcb, 0x89, 0xf0, 0xe8, 0x92, 0x1f,
-  0x00, 0x00, 0x89, 0x0d, 0x58, 0x14, 0x00, 0x00, 0x3b, 0x0d, 0xd0, 0x0f,
-  0x00, 0x00, 0x73, 0xd7, 0x8b, 0x41, 0x14, 0x3b, 0x05, 0xd4, 0x0f, 0x00,
-  0x00, 0x76, 0xcc, 0xa3, 0xd4, 0x0f, 0x00, 0x00, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x56, 0x57, 0x06, 0x0f, 0xa0,
-  0x0f, 0xa8, 0x55, 0x83, 0xec, 0x04, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x4b,
-  0x83, 0xf8, 0xd4, 0x77, 0x46, 0x8d, 0x68, 0x0b, 0x83, 0xe5, 0xf8, 0x83,
-  0xfd, 0x10, 0x72, 0x4c, 0xc6, 0x04, 0x24, 0x00, 0x31, 0xd2, 0x3b, 0x2d,
-  0xd4, 0x0f, 0x00, 0x00, 0x76, 0x53, 0x8b, 0x0d, 0xd0, 0x0f, 0x00, 0x00,
-  0x85, 0xc9, 0x74, 0x3b, 0x85, 0xc9, 0x75, 0x55, 0x80, 0x3c, 0x24, 0x00,
-  0x0f, 0x84, 0x8c, 0x00, 0x00, 0x00, 0x89, 0xf8, 0xe8, 0x4f, 0x20, 0x00,
-  0x00, 0x85, 0xc0, 0x0f, 0x84, 0x95, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x24,
-  0x00, 0xeb, 0xcb, 0x31, 0xc0, 0x83, 0xc4, 0x04, 0x5d, 0x0f, 0xa9, 0x0f,
-  0xa1, 0x07, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xbd, 0x10, 0x00, 0x00,
-  0x00, 0xeb, 0xad, 0x89, 0x0d, 0xd4, 0x0f, 0x00, 0x00, 0x8b, 0x0d, 0xcc,
-  0x0f, 0x00, 0x00, 0xeb, 0xb7, 0x31, 0xc9, 0x89, 0x0d, 0xd4, 0x0f, 0x00,
-  0x00, 0x8b, 0x0d, 0xcc, 0x0f, 0x00, 0x00, 0xeb, 0xa7, 0x8b, 0x71, 0x14,
-  0x89, 0x0d, 0xd0, 0x0f, 0x00, 0x00, 0x39, 0xfe, 0x72, 0x1c, 0xb8, 0xcc,
-  0x0f, 0x00, 0x00, 0x8c, 0xda, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x89,
-  0xcb, 0x89, 0xf8, 0xe8, 0xf8, 0x1d, 0x00, 0x00, 0x89, 0xc2, 0x85, 0xc0,
-  0x75, 0x30, 0x3b, 0x35, 0xd4, 0x0f, 0x00, 0x00, 0x77, 0x08, 0x8b, 0x49,
-  0x08, 0xe9, 0x6e, 0xff, 0xff, 0xff, 0x89, 0x35, 0xd4, 0x0f, 0x00, 0x00,
-  0xeb, 0xf0, 0x89, 0xf8, 0xe8, 0xc3, 0x24, 0x00, 0x00, 0x85, 0xc0, 0x0f,
-  0x84, 0x65, 0xff, 0xff, 0xff, 0xc6, 0x04, 0x24, 0x01, 0xe9, 0x3c, 0xff,
-  0xff, 0xff, 0x89, 0xd0, 0x83, 0xc4, 0x04, 0x5d, 0x0f, 0xa9, 0x0f, 0xa1,
-  0x07, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x53, 0x51, 0x56, 0x89,
-  0xd1, 0x8b, 0x10, 0x8b, 0x58, 0x10, 0x3b, 0x5a, 0x04, 0x73, 0x10, 0x8b,
-  0x1a, 0x8d, 0x73, 0x01, 0x89, 0x32, 0x88, 0x0b, 0xff, 0x40, 0x10, 0x5e,
-  0x59, 0x5b, 0xc3, 0xc7, 0x42, 0x08, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x59,
-  0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x56, 0x83, 0xec, 0x0c,
-  0x89, 0xc6, 0x89, 0xd0, 0x89, 0xda, 0x89, 0xcb, 0x48, 0x89, 0x44, 0x24,
-  0x04, 0x31, 0xc0, 0xb9, 0x20, 0x98, 0x00, 0x00, 0x89, 0x44, 0x24, 0x08,
-  0x89, 0xe0, 0x89, 0x34, 0x24, 0xe8, 0xea, 0x0e, 0x00, 0x00, 0xc6, 0x04,
-  0x06, 0x00, 0x83, 0xc4, 0x0c, 0x5e, 0xc3, 0x90, 0x53, 0x51, 0x52, 0x83,
-  0xec, 0x04, 0x8d, 0x44, 0x24, 0x20, 0x89, 0xe1, 0x8b, 0x5c, 0x24, 0x1c,
-  0x8b, 0x54, 0x24, 0x18, 0x89, 0x04, 0x24, 0x8b, 0x44, 0x24, 0x14, 0xe8,
-  0xb0, 0xff, 0xff, 0xff, 0x83, 0xc4, 0x04, 0x5a, 0x59, 0x5b, 0xc3, 0x8d,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x00, 0x56, 0x57, 0x83, 0xec,
-  0x0c, 0x89, 0xc7, 0x89, 0xd6, 0x89, 0xda, 0x89, 0xcb, 0x89, 0x04, 0x24,
-  0x31, 0xc0, 0xb9, 0x20, 0x98, 0x00, 0x00, 0x89, 0x44, 0x24, 0x08, 0x89,
-  0xe0, 0x89, 0x74, 0x24, 0x04, 0xe8, 0x8a, 0x0e, 0x00, 0x00, 0x89, 0xc2,
-  0x39, 0xf0, 0x72, 0x0f, 0x83, 0x7c, 0x24, 0x08, 0x00, 0x75, 0x1b, 0x89,
-  0xd0, 0x83, 0xc4, 0x0c, 0x5f, 0x5e, 0xc3, 0xc6, 0x04, 0x07, 0x00, 0x83,
-  0x7c, 0x24, 0x08, 0x00, 0x75, 0x08, 0x89, 0xd0, 0x83, 0xc4, 0x0c, 0x5f,
-  0x5e, 0xc3, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc4, 0x0c, 0x5f, 0x5e,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x90, 0x53, 0x51, 0x52, 0x83,
-  0xec, 0x04, 0x8d, 0x44, 0x24, 0x20, 0x89, 0xe1, 0x8b, 0x5c, 0x24, 0x1c,
-  0x8b, 0x54, 0x24, 0x18, 0x89, 0x04, 0x24, 0x8b, 0x44, 0x24, 0x14, 0xe8,
-  0x80, 0xff, 0xff, 0xff, 0x83, 0xc4, 0x04, 0x5a, 0x59, 0x5b, 0xc3, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3d, 0xd8, 0x0f,
-  0x00, 0x00, 0x00, 0x75, 0x03, 0x31, 0xc0, 0xc3, 0x81, 0xe2, 0xff, 0xff,
-  0x00, 0x00, 0x52, 0x50, 0xcc, 0xeb, 0x06, 0x57, 0x56, 0x49, 0x44, 0x45,
-  0x4f, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x83, 0xc4, 0x08, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc4, 0x2b, 0x05,
-  0x10, 0x10, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x66, 0x8c, 0x15, 0xdc,
-  0x0f, 0x00, 0x00, 0xc3, 0x87, 0x44, 0x24, 0x04, 0xe8, 0x0a, 0x00, 0x00,
-  0x00, 0x8b, 0x44, 0x24, 0x04, 0xc2, 0x04, 0x00, 0xc2, 0x04, 0x00, 0x3b,
-  0xc4, 0x73, 0x0d, 0x2b, 0xc4, 0xf7, 0xd8, 0x3b, 0x05, 0x10, 0x10, 0x00,
-  0x00, 0x76, 0x01, 0xc3, 0x66, 0x8c, 0xd0, 0x66, 0x3b, 0x05, 0xdc, 0x0f,
-  0x00, 0x00, 0x74, 0x01, 0xc3, 0xb8, 0xde, 0x0f, 0x00, 0x00, 0xba, 0x01,
-  0x00, 0x00, 0x00, 0xe8, 0xdc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x52, 0x83, 0xec,
-  0x04, 0x8d, 0x44, 0x24, 0x18, 0x89, 0xe3, 0x8b, 0x54, 0x24, 0x14, 0x89,
-  0x04, 0x24, 0x8b, 0x44, 0x24, 0x10, 0xe8, 0x45, 0x24, 0x00, 0x00, 0x83,
-  0xc4, 0x04, 0x5a, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x89, 0xd1, 0xba,
-  0x6c, 0x0a, 0x00, 0x00, 0xe8, 0x43, 0x06, 0x00, 0x00, 0xba, 0x6c, 0x0a,
-  0x00, 0x00, 0xb8, 0x9c, 0x07, 0x00, 0x00, 0xe8, 0x34, 0x06, 0x00, 0x00,
-  0xba, 0x6c, 0x0a, 0x00, 0x00, 0x89, 0xc8, 0xe8, 0x28, 0x06, 0x00, 0x00,
-  0x59, 0xc3, 0x81, 0x3d, 0xf0, 0x0f, 0x00, 0x00, 0x3c, 0x9a, 0x00, 0x00,
-  0x74, 0x06, 0xff, 0x15, 0xf0, 0x0f, 0x00, 0x00, 0x52, 0xba, 0xff, 0x00,
-  0x00, 0x00, 0xb8, 0xa0, 0x07, 0x00, 0x00, 0xe8, 0x54, 0x0a, 0x00, 0x00,
-  0x5a, 0xc3, 0x00, 0x00, 0x0b, 0xc9, 0x74, 0x2c, 0x38, 0x10, 0xa8, 0x03,
-  0x74, 0x09, 0x88, 0x10, 0x40, 0xc1, 0xca, 0x08, 0x49, 0x75, 0xf3, 0x51,
-  0xc1, 0xe9, 0x02, 0xe8, 0x1b, 0x00, 0x00, 0x00, 0x59, 0x83, 0xe1, 0x03,
-  0x74, 0x0e, 0x88, 0x10, 0x49, 0x74, 0x09, 0x88, 0x70, 0x01, 0x49, 0x74,
-  0x03, 0x88, 0x50, 0x02, 0xc3, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x0b,
-  0xc9, 0x74, 0x67, 0xa8, 0x1f, 0x74, 0x08, 0x89, 0x10, 0x8d, 0x40, 0x04,
-  0x49, 0x75, 0xf4, 0x51, 0xc1, 0xe9, 0x02, 0x74, 0x3a, 0x49, 0x74, 0x29,
-  0x89, 0x10, 0x89, 0x50, 0x04, 0x49, 0x89, 0x50, 0x08, 0x89, 0x50, 0x0c,
-  0x74, 0x18, 0x38, 0x50, 0x20, 0x89, 0x50, 0x10, 0x89, 0x50, 0x14, 0x49,
-  0x89, 0x50, 0x18, 0x89, 0x50, 0x1c, 0x8d, 0x40, 0x20, 0x75, 0xdd, 0x8d,
-  0x40, 0xf0, 0x8d, 0x40, 0x10, 0x89, 0x10, 0x89, 0x50, 0x04, 0x89, 0x50,
-  0x08, 0x89, 0x50, 0x0c, 0x8d, 0x40, 0x10, 0x59, 0x83, 0xe1, 0x03, 0x74,
-  0x15, 0x89, 0x10, 0x8d, 0x40, 0x04, 0x49, 0x74, 0x0d, 0x89, 0x10, 0x8d,
-  0x40, 0x04, 0x49, 0x74, 0x05, 0x89, 0x10, 0x8d, 0x40, 0x04, 0xc3, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x55, 0x89, 0xc1, 0x31, 0xed, 0xf6, 0x40,
-  0x0d, 0x10, 0x75, 0x5f, 0x8b, 0x40, 0x08, 0x83, 0x78, 0x08, 0x00, 0x74,
-  0x2d, 0x80, 0x61, 0x0c, 0xef, 0xf6, 0x41, 0x0d, 0x20, 0x75, 0x23, 0x8b,
-  0x41, 0x04, 0x85, 0xc0, 0x74, 0x11, 0x89, 0xc2, 0xbb, 0x01, 0x00, 0x00,
-  0x00, 0xf7, 0xda, 0x8b, 0x41, 0x10, 0xe8, 0x15, 0x23, 0x00, 0x00, 0x83,
-  0xf8, 0xff, 0x75, 0x06, 0x89, 0xc5, 0x80, 0x49, 0x0c, 0x20, 0x8b, 0x41,
-  0x08, 0x8b, 0x40, 0x08, 0xc7, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x01, 0x85, 0xed, 0x75, 0x0d, 0x8b, 0x41, 0x08, 0xf6, 0x40, 0x10, 0x01,
-  0x0f, 0x85, 0x6d, 0x00, 0x00, 0x00, 0x89, 0xe8, 0x5d, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5b, 0xc3, 0x80, 0x60, 0x0d, 0xef, 0xf6, 0x40, 0x0c, 0x02, 0x74,
-  0xcd, 0x8b, 0x78, 0x08, 0x8b, 0x5f, 0x08, 0x85, 0xdb, 0x74, 0xc3, 0x8b,
-  0x70, 0x04, 0x89, 0xdf, 0x85, 0xf6, 0x74, 0xba, 0x85, 0xed, 0x75, 0xb6,
-  0x89, 0xf3, 0x89, 0xfa, 0x8b, 0x41, 0x10, 0xe8, 0x04, 0x23, 0x00, 0x00,
-  0x89, 0xc2, 0x83, 0xf8, 0xff, 0x75, 0x0e, 0x89, 0xc5, 0x80, 0x49, 0x0c,
-  0x20, 0x01, 0xd7, 0x29, 0xd6, 0x75, 0xdd, 0xeb, 0x95, 0x85, 0xc0, 0x75,
-  0xf4, 0xb8, 0x0c, 0x00, 0x00, 0x00, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xe8,
-  0x7c, 0x05, 0x00, 0x00, 0x80, 0x49, 0x0c, 0x20, 0x01, 0xd7, 0x29, 0xd6,
-  0x75, 0xbe, 0xe9, 0x73, 0xff, 0xff, 0xff, 0x8b, 0x41, 0x10, 0xe8, 0x45,
-  0x23, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x75, 0x86, 0x89, 0xc5, 0x89, 0xe8,
-  0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x89, 0xc3, 0x8b, 0x15, 0x20, 0x14, 0x00, 0x00, 0x31,
-  0xc9, 0x85, 0xd2, 0x74, 0x1a, 0x8b, 0x42, 0x04, 0x85, 0x58, 0x0c, 0x74,
-  0x0c, 0x41, 0xf6, 0x40, 0x0d, 0x10, 0x74, 0x05, 0xe8, 0xeb, 0xfe, 0xff,
-  0xff, 0x8b, 0x12, 0x85, 0xd2, 0x75, 0xe6, 0x89, 0xc8, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x40, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xb9, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x56, 0x83, 0xec,
-  0x0c, 0x89, 0xc6, 0x89, 0xe0, 0x89, 0xe1, 0xe8, 0xe0, 0x22, 0x00, 0x00,
-  0x89, 0xf0, 0xe8, 0x09, 0x23, 0x00, 0x00, 0x83, 0xc4, 0x0c, 0x5e, 0x59,
-  0xc3, 0x00, 0x00, 0x00, 0x52, 0x89, 0xda, 0x8a, 0x1d, 0x2e, 0x10, 0x00,
-  0x00, 0x80, 0xfb, 0x02, 0x72, 0x13, 0x80, 0xfb, 0x08, 0x77, 0x0e, 0x1e,
-  0x8e, 0xd9, 0x8a, 0xc8, 0xb0, 0x04, 0xb4, 0x25, 0xcd, 0x21, 0x1f, 0x5a,
-  0xc3, 0x1e, 0x8e, 0xd9, 0xb4, 0x25, 0xcd, 0x21, 0x1f, 0x5a, 0xc3, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x8a, 0x15, 0x2e, 0x10, 0x00, 0x00,
-  0x80, 0xfa, 0x02, 0x72, 0x18, 0x80, 0xfa, 0x08, 0x77, 0x13, 0x88, 0xc1,
-  0xb8, 0x02, 0x25, 0x00, 0x00, 0x06, 0xcd, 0x21, 0x66, 0x8c, 0xc2, 0x07,
-  0x89, 0xd8, 0x59, 0x5b, 0xc3, 0x25, 0xff, 0x00, 0x00, 0x00, 0x30, 0xc9,
-  0x80, 0xcc, 0x35, 0x06, 0xcd, 0x21, 0x66, 0x8c, 0xc2, 0x07, 0x89, 0xd8,
-  0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe8, 0x4f, 0x83, 0xff, 0xff, 0x80, 0x3d, 0xd1, 0x0d, 0x00, 0x00, 0x00,
-  0x7d, 0x05, 0xe8, 0xe9, 0x9e, 0xff, 0xff, 0xe8, 0x50, 0x84, 0xff, 0xff,
-  0x80, 0x3d, 0xac, 0x0c, 0x00, 0x00, 0x04, 0x0f, 0x94, 0xc0, 0x0f, 0xb6,
-  0xc0, 0xc3, 0x8b, 0xc0, 0x66, 0x3d, 0xfd, 0xff, 0x72, 0x10, 0x76, 0x28,
-  0x66, 0x3d, 0xff, 0xff, 0x74, 0x16, 0x66, 0x3d, 0xfe, 0xff, 0x74, 0x16,
-  0xeb, 0x2c, 0x66, 0x3d, 0xfc, 0xff, 0x74, 0x1a, 0x66, 0x3d, 0xf0, 0xff,
-  0x74, 0x1a, 0xeb, 0x1e, 0xb8, 0xb8, 0x07, 0x00, 0x00, 0xc3, 0xb8, 0xc6,
-  0x07, 0x00, 0x00, 0xc3, 0xb8, 0xe1, 0x07, 0x00, 0x00, 0xc3, 0xb8, 0xf8,
-  0x07, 0x00, 0x00, 0xc3, 0xb8, 0x0a, 0x08, 0x00, 0x00, 0xc3, 0xb8, 0x22,
-  0x08, 0x00, 0x00, 0xc3, 0x52, 0x66, 0x83, 0x3d, 0xf4, 0x0f, 0x00, 0x00,
-  0x00, 0x75, 0x18, 0xba, 0xf4, 0x0f, 0x00, 0x00, 0xb8, 0x00, 0x04, 0x00,
-  0x00, 0xe8, 0xa6, 0x7b, 0xff, 0xff, 0xa3, 0xf8, 0x0f, 0x00, 0x00, 0x85,
-  0xc0, 0x74, 0x05, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x5a, 0xc3, 0x8b, 0xc0,
-  0x55, 0x89, 0xe5, 0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x04, 0x89,
-  0x45, 0xe8, 0x8b, 0x15, 0xf8, 0x0f, 0x00, 0x00, 0xc1, 0xea, 0x04, 0x8b,
-  0x45, 0xe8, 0x66, 0x89, 0x50, 0x2c, 0x66, 0xa1, 0xf8, 0x0f, 0x00, 0x00,
-  0x30, 0xe4, 0x24, 0x0f, 0x8b, 0x55, 0xe8, 0x66, 0x89, 0x42, 0x2a, 0x80,
-  0x3d, 0x9c, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0x0a, 0x8b, 0x45, 0xe8, 0xe8,
-  0x90, 0x7e, 0xff, 0xff, 0xeb, 0x12, 0x66, 0xb8, 0x01, 0x03, 0x66, 0x33,
-  0xdb, 0x66, 0x33, 0xc9, 0x8b, 0xbd, 0xe8, 0xff, 0xff, 0xff, 0xcd, 0x31,
-  0x8d, 0x65, 0xec, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0x5d, 0xc3, 0x8b, 0xc0,
-  0x53, 0x51, 0x89, 0xc3, 0x89, 0xd1, 0x8b, 0x15, 0xf8, 0x0f, 0x00, 0x00,
-  0x85, 0xd2, 0x75, 0x17, 0x68, 0x24, 0x08, 0x00, 0x00, 0x68, 0x6c, 0x0a,
-  0x00, 0x00, 0xe8, 0x71, 0x6a, 0xff, 0xff, 0x83, 0xc4, 0x08, 0xe8, 0xd3,
-  0xfb, 0xff, 0xff, 0xc7, 0x02, 0xc4, 0xc4, 0x58, 0x02, 0x0f, 0xb7, 0xc3,
-  0xc6, 0x42, 0x04, 0xcb, 0x89, 0x41, 0x1c, 0x89, 0xc8, 0xe8, 0x62, 0xff,
-  0xff, 0xff, 0x59, 0x5b, 0xc3, 0x8d, 0x40, 0x00, 0x55, 0x89, 0xe5, 0x51,
-  0x52, 0x56, 0x57, 0x83, 0xec, 0x34, 0x89, 0xc2, 0xb9, 0x0c, 0x00, 0x00,
-  0x00, 0x8d, 0x7d, 0xbc, 0xbe, 0xd0, 0x9c, 0x00, 0x00, 0xf3, 0xa5, 0x66,
-  0xa5, 0xa1, 0xf8, 0x0f, 0x00, 0x00, 0xc7, 0x00, 0xc4, 0xc4, 0x58, 0x01,
-  0xc6, 0x40, 0x04, 0xcb, 0x0f, 0xb7, 0xc2, 0x89, 0x45, 0xd8, 0x8d, 0x45,
-  0xbc, 0xe8, 0x22, 0xff, 0xff, 0xff, 0x8d, 0x65, 0xf0, 0x5f, 0x5e, 0x5a,
-  0x59, 0x5d, 0xc3, 0x90, 0x55, 0x89, 0xe5, 0x51, 0x56, 0x57, 0x83, 0xec,
-  0x50, 0x89, 0x45, 0xd8, 0x89, 0x55, 0xe4, 0xe8, 0xd8, 0xfe, 0xff, 0xff,
-  0x85, 0xc0, 0x75, 0x0a, 0xb8, 0xf0, 0xff, 0x00, 0x00, 0xe9, 0x67, 0x01,
-  0x00, 0x00, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x7d, 0xa4, 0xbe, 0x02,
-  0x9d, 0x00, 0x00, 0xf3, 0xa5, 0x66, 0xa5, 0xa1, 0xf8, 0x0f, 0x00, 0x00,
-  0x8d, 0x90, 0xff, 0x03, 0x00, 0x00, 0x89, 0x55, 0xe0, 0x8d, 0x50, 0x01,
-  0xc6, 0x00, 0xc4, 0xc6, 0x02, 0xc4, 0x42, 0xc6, 0x02, 0x58, 0x42, 0xc6,
-  0x02, 0x00, 0x42, 0xc6, 0x02, 0xcb, 0x42, 0x89, 0xd0, 0x66, 0x2b, 0x05,
-  0xf8, 0x0f, 0x00, 0x00, 0x8b, 0x7d, 0xd8, 0x89, 0x45, 0xec, 0x2b, 0xc9,
-  0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x0f, 0xb7, 0xc1, 0x8d,
-  0x4c, 0x02, 0x01, 0x3b, 0x4d, 0xe0, 0x73, 0x20, 0x8b, 0x75, 0xd8, 0x40,
-  0x89, 0xd7, 0x89, 0xc1, 0x89, 0x45, 0xdc, 0x57, 0x8b, 0xc1, 0xc1, 0xe9,
-  0x02, 0xf3, 0xa5, 0x8a, 0xc8, 0x80, 0xe1, 0x03, 0xf3, 0xa4, 0x5f, 0x03,
-  0x55, 0xdc, 0xeb, 0x04, 0xc6, 0x02, 0x00, 0x42, 0x83, 0x7d, 0xe4, 0x00,
-  0x74, 0x4b, 0x89, 0xd0, 0x66, 0x2b, 0x05, 0xf8, 0x0f, 0x00, 0x00, 0x8b,
-  0x7d, 0xe4, 0x89, 0x45, 0xe8, 0x2b, 0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae,
-  0xf7, 0xd1, 0x49, 0x0f, 0xb7, 0xc1, 0x8d, 0x4c, 0x02, 0x01, 0x3b, 0x4d,
-  0xe0, 0x73, 0x20, 0x8b, 0x75, 0xe4, 0x40, 0x89, 0xd7, 0x89, 0xc1, 0x89,
-  0x45, 0xdc, 0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8,
-  0x80, 0xe1, 0x03, 0xf3, 0xa4, 0x5f, 0x03, 0x55, 0xdc, 0xeb, 0x0b, 0xc6,
-  0x02, 0x00, 0x42, 0xeb, 0x05, 0x31, 0xc0, 0x89, 0x45, 0xe8, 0x89, 0xd0,
-  0x66, 0x2b, 0x05, 0xf8, 0x0f, 0x00, 0x00, 0x89, 0xdf, 0x89, 0x45, 0xf0,
-  0x2b, 0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x0f, 0xb7,
-  0xc9, 0x8d, 0x44, 0x0a, 0x01, 0x3b, 0x45, 0xe0, 0x73, 0x17, 0x41, 0x89,
-  0xde, 0x89, 0xd7, 0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a,
-  0xc8, 0x80, 0xe1, 0x03, 0xf3, 0xa4, 0x5f, 0xeb, 0x03, 0xc6, 0x02, 0x00,
-  0xa1, 0xf8, 0x0f, 0x00, 0x00, 0xc1, 0xe8, 0x04, 0x66, 0x89, 0x45, 0xc8,
-  0x8b, 0x45, 0xe4, 0x85, 0xc0, 0x74, 0x04, 0x0f, 0xb7, 0x45, 0xc8, 0x66,
-  0x89, 0x45, 0xc6, 0x0f, 0xb7, 0x45, 0xec, 0x89, 0x45, 0xa8, 0x0f, 0xb7,
-  0x45, 0xe8, 0x89, 0x45, 0xa4, 0x0f, 0xb7, 0x45, 0xf0, 0x89, 0x45, 0xb4,
-  0x8d, 0x45, 0xa4, 0xc7, 0x45, 0xbc, 0x32, 0x32, 0x32, 0x32, 0xe8, 0xa5,
-  0xfd, 0xff, 0xff, 0xf6, 0x45, 0xc4, 0x01, 0x74, 0x0d, 0x8b, 0x45, 0xc0,
-  0xf7, 0xd8, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x8b, 0x45,
-  0xc0, 0x8d, 0x65, 0xf4, 0x5f, 0x5e, 0x59, 0x5d, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x56, 0x57, 0x55, 0x89, 0xc1, 0x89,
-  0xd3, 0x8b, 0x42, 0x08, 0x83, 0x78, 0x08, 0x00, 0x74, 0x52, 0x8a, 0x43,
-  0x0d, 0x31, 0xff, 0xa8, 0x04, 0x75, 0x52, 0x89, 0xcd, 0x31, 0xf6, 0x31,
-  0xc0, 0x8a, 0x01, 0x85, 0xc0, 0x74, 0x0f, 0x89, 0xda, 0x41, 0xe8, 0x81,
-  0x05, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x75, 0xeb, 0x89, 0xc6, 0x85, 0xff,
-  0x74, 0x1a, 0x8a, 0x73, 0x0d, 0x80, 0xe6, 0xf9, 0x88, 0xf0, 0x0c, 0x04,
-  0x88, 0x43, 0x0d, 0x85, 0xf6, 0x75, 0x09, 0x89, 0xd8, 0xe8, 0x5e, 0xfa,
-  0xff, 0xff, 0x89, 0xc6, 0x85, 0xf6, 0x75, 0x04, 0x89, 0xce, 0x29, 0xee,
-  0x89, 0xf0, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x89, 0xd0, 0xe8, 0x05,
-  0x06, 0x00, 0x00, 0xeb, 0xa5, 0x88, 0xc4, 0x80, 0xe4, 0xf9, 0x88, 0xe2,
-  0x80, 0xca, 0x02, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x88, 0x53, 0x0d, 0xeb,
-  0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x83, 0xf8, 0x41, 0x7c, 0x08, 0x83, 0xf8, 0x5a,
-  0x7f, 0x03, 0x83, 0xc0, 0x20, 0xc3, 0x00, 0x00, 0x83, 0x3d, 0x20, 0x10,
-  0x00, 0x00, 0x00, 0x74, 0x06, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3, 0xb4,
-  0x0b, 0xcd, 0x21, 0x25, 0xff, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00,
-  0xcd, 0x11, 0xc3, 0x52, 0x8a, 0xe0, 0x8a, 0xf4, 0xcd, 0x16, 0x75, 0x0a,
-  0x80, 0xe6, 0x0f, 0x80, 0xfe, 0x01, 0x75, 0x02, 0x2b, 0xc0, 0x5a, 0xc3,
-  0xcd, 0x12, 0xc3, 0x53, 0x8a, 0xe0, 0x8a, 0xc3, 0xcd, 0x17, 0x8a, 0xc4,
-  0x25, 0xff, 0x00, 0x00, 0x00, 0x5b, 0xc3, 0x53, 0x8a, 0xe0, 0x8a, 0xc3,
-  0xcd, 0x14, 0x5b, 0xc3, 0x52, 0x89, 0xc2, 0xe8, 0x38, 0x1e, 0x00, 0x00,
-  0x89, 0x10, 0x5a, 0xc3, 0xe8, 0x2f, 0x1e, 0x00, 0x00, 0xc7, 0x00, 0x0d,
-  0x00, 0x00, 0x00, 0xc3, 0xe8, 0x23, 0x1e, 0x00, 0x00, 0xc7, 0x00, 0x0e,
-  0x00, 0x00, 0x00, 0xc3, 0xe8, 0x17, 0x1e, 0x00, 0x00, 0xc7, 0x00, 0x09,
-  0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x52, 0x89, 0xc2,
-  0xe8, 0x13, 0x1e, 0x00, 0x00, 0x89, 0x10, 0x5a, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x55, 0x89, 0xe5, 0xa1, 0x18, 0x10, 0x00, 0x00, 0x83, 0xc0, 0x03,
-  0x24, 0xfc, 0x8b, 0x15, 0x18, 0x10, 0x00, 0x00, 0x2b, 0xe0, 0x89, 0xe0,
-  0x01, 0xd0, 0xa3, 0x1c, 0x10, 0x00, 0x00, 0xe8, 0xec, 0x1d, 0x00, 0x00,
-  0x8b, 0x15, 0x70, 0x14, 0x00, 0x00, 0xa1, 0x6c, 0x14, 0x00, 0x00, 0xe8,
-  0xf8, 0x5f, 0xff, 0xff, 0xe8, 0x38, 0x1e, 0x00, 0x00, 0x89, 0xec, 0x5d,
-  0x5a, 0xc3, 0x00, 0x00, 0x06, 0x83, 0x38, 0x00, 0x75, 0x02, 0x07, 0xc3,
-  0x1e, 0x07, 0xff, 0x10, 0x07, 0xc3, 0x8b, 0xc0, 0x53, 0x51, 0x52, 0x56,
-  0x06, 0x88, 0xc6, 0xbe, 0xee, 0x10, 0x00, 0x00, 0xb8, 0xd0, 0x10, 0x00,
-  0x00, 0x89, 0xf1, 0x88, 0xf2, 0x39, 0xc6, 0x76, 0x1a, 0x80, 0x38, 0x02,
-  0x74, 0x0b, 0x8a, 0x78, 0x01, 0x38, 0xfa, 0x72, 0x04, 0x89, 0xc1, 0x88,
-  0xfa, 0x83, 0xc0, 0x06, 0x3d, 0xee, 0x10, 0x00, 0x00, 0x72, 0xe6, 0x81,
-  0xf9, 0xee, 0x10, 0x00, 0x00, 0x74, 0x0d, 0x8d, 0x41, 0x02, 0xe8, 0xad,
-  0xff, 0xff, 0xff, 0xc6, 0x01, 0x02, 0xeb, 0xc4, 0x07, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0x8b, 0xc0, 0x53, 0x51, 0x56, 0x06, 0x88, 0xc3, 0x88, 0xd6,
-  0xbe, 0x00, 0x11, 0x00, 0x00, 0xb8, 0xee, 0x10, 0x00, 0x00, 0x89, 0xf1,
-  0x88, 0xda, 0x39, 0xc6, 0x76, 0x1a, 0x80, 0x38, 0x02, 0x74, 0x0b, 0x8a,
-  0x78, 0x01, 0x38, 0xfa, 0x77, 0x04, 0x89, 0xc1, 0x88, 0xfa, 0x83, 0xc0,
-  0x06, 0x3d, 0x00, 0x11, 0x00, 0x00, 0x72, 0xe6, 0x81, 0xf9, 0x00, 0x11,
-  0x00, 0x00, 0x74, 0x14, 0x3a, 0x71, 0x01, 0x73, 0x05, 0xc6, 0x01, 0x02,
-  0xeb, 0xc7, 0x8d, 0x41, 0x02, 0xe8, 0x52, 0xff, 0xff, 0xff, 0xeb, 0xf1,
-  0x07, 0x5e, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x68, 0x4c, 0x14, 0x00, 0x00,
-  0xb9, 0x48, 0x14, 0x00, 0x00, 0x8b, 0x1d, 0x04, 0x10, 0x00, 0x00, 0x8b,
-  0x15, 0x08, 0x10, 0x00, 0x00, 0xa1, 0x74, 0x14, 0x00, 0x00, 0xe8, 0x2d,
-  0x00, 0x00, 0x00, 0xa3, 0x5c, 0x14, 0x00, 0x00, 0xa1, 0x48, 0x14, 0x00,
-  0x00, 0xa3, 0x50, 0x14, 0x00, 0x00, 0xa3, 0x6c, 0x14, 0x00, 0x00, 0xa1,
-  0x4c, 0x14, 0x00, 0x00, 0xa3, 0x54, 0x14, 0x00, 0x00, 0xa3, 0x70, 0x14,
-  0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x56, 0x57, 0x55, 0x83, 0xec, 0x10, 0x89, 0xc5, 0x89, 0x54, 0x24, 0x08,
-  0x89, 0xde, 0x89, 0x4c, 0x24, 0x04, 0x89, 0xe1, 0x89, 0xf2, 0x31, 0xdb,
-  0xe8, 0x83, 0x00, 0x00, 0x00, 0x8b, 0x14, 0x24, 0x29, 0xf2, 0x40, 0x8d,
-  0x4a, 0x01, 0xc1, 0xe0, 0x02, 0x83, 0xc2, 0x04, 0x83, 0xc0, 0x04, 0x80,
-  0xe2, 0xfc, 0x01, 0xd0, 0x83, 0xc0, 0x03, 0x31, 0xff, 0x24, 0xfc, 0x89,
-  0xd3, 0xe8, 0xfe, 0xf3, 0xff, 0xff, 0x89, 0xc2, 0x89, 0x44, 0x24, 0x0c,
-  0x31, 0xc0, 0x85, 0xd2, 0x75, 0x19, 0x8b, 0x54, 0x24, 0x04, 0x89, 0x02,
-  0x8b, 0x44, 0x24, 0x20, 0x89, 0x38, 0x8b, 0x44, 0x24, 0x0c, 0x83, 0xc4,
-  0x10, 0x5d, 0x5f, 0x5e, 0xc2, 0x04, 0x00, 0x89, 0xd7, 0x06, 0x8c, 0xd8,
-  0x8e, 0xc0, 0x57, 0x8b, 0xc1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x8a, 0xc8,
-  0x80, 0xe1, 0x03, 0xf3, 0xa4, 0x5f, 0x07, 0x8b, 0x44, 0x24, 0x08, 0x8d,
-  0x3c, 0x1a, 0x89, 0xe1, 0x8d, 0x5f, 0x04, 0x89, 0x07, 0x89, 0xe8, 0xe8,
-  0x0c, 0x00, 0x00, 0x00, 0x40, 0x89, 0xc2, 0xc7, 0x04, 0x97, 0x00, 0x00,
-  0x00, 0x00, 0xeb, 0xae, 0x56, 0x57, 0x55, 0x83, 0xec, 0x08, 0x89, 0xc6,
-  0x89, 0x4c, 0x24, 0x04, 0x31, 0xff, 0x8a, 0x02, 0x3c, 0x20, 0x75, 0x03,
-  0x42, 0xeb, 0xf7, 0x3c, 0x09, 0x74, 0xf9, 0x84, 0xc0, 0x0f, 0x84, 0xb4,
-  0x00, 0x00, 0x00, 0x30, 0xc0, 0x80, 0x3a, 0x22, 0x74, 0x17, 0x89, 0x14,
-  0x24, 0x89, 0xd1, 0x80, 0x3a, 0x22, 0x75, 0x3b, 0x85, 0xf6, 0x75, 0x12,
-  0x42, 0x84, 0xc0, 0x75, 0x09, 0xb0, 0x02, 0xeb, 0xee, 0xb0, 0x01, 0x42,
-  0xeb, 0xe4, 0x30, 0xc0, 0xeb, 0xe5, 0x3c, 0x01, 0x75, 0x21, 0x85, 0xdb,
-  0x0f, 0x84, 0x90, 0x00, 0x00, 0x00, 0x89, 0xf8, 0x8b, 0x2c, 0x24, 0x89,
-  0x2c, 0x83, 0x8a, 0x02, 0x47, 0x84, 0xc0, 0x0f, 0x84, 0x6c, 0x00, 0x00,
-  0x00, 0x42, 0xc6, 0x01, 0x00, 0xeb, 0x9f, 0x8a, 0x22, 0x80, 0xfc, 0x20,
-  0x75, 0x26, 0x84, 0xc0, 0x74, 0xd4, 0x8a, 0x22, 0x84, 0xe4, 0x74, 0xce,
-  0x80, 0xfc, 0x5c, 0x75, 0x10, 0x85, 0xf6, 0x75, 0x1a, 0x80, 0x7a, 0x01,
-  0x22, 0x75, 0x06, 0x42, 0x3a, 0x62, 0xfe, 0x74, 0x9a, 0x85, 0xdb, 0x75,
-  0x30, 0x42, 0xeb, 0x93, 0x80, 0xfc, 0x09, 0x74, 0xd5, 0xeb, 0xd7, 0x8a,
-  0x62, 0x01, 0x80, 0xfc, 0x22, 0x75, 0x0b, 0x42, 0x85, 0xdb, 0x75, 0x19,
-  0x42, 0xe9, 0x79, 0xff, 0xff, 0xff, 0x80, 0xfc, 0x5c, 0x75, 0xda, 0x3c,
-  0x01, 0x74, 0xec, 0x85, 0xdb, 0x75, 0x06, 0x42, 0xe9, 0x66, 0xff, 0xff,
-  0xff, 0x41, 0x8a, 0x22, 0x88, 0x61, 0xff, 0x42, 0xe9, 0x5a, 0xff, 0xff,
-  0xff, 0x88, 0x01, 0x8b, 0x44, 0x24, 0x04, 0x89, 0x10, 0x89, 0xf8, 0x83,
-  0xc4, 0x08, 0x5d, 0x5f, 0x5e, 0xc3, 0x47, 0x80, 0x3a, 0x00, 0x74, 0xeb,
-  0x42, 0xe9, 0x1c, 0xff, 0xff, 0xff, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc0, 0xa1, 0x5c, 0x14, 0x00,
-  0x00, 0x85, 0xc0, 0x0f, 0x85, 0x93, 0xf1, 0xff, 0xff, 0xc3, 0x00, 0x00,
-  0xe9, 0x4b, 0xef, 0xff, 0xff, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d,
-  0x52, 0x00, 0x8b, 0xdb, 0x53, 0x51, 0x89, 0xc1, 0x89, 0xd3, 0x8c, 0xda,
-  0xe8, 0x93, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x03, 0x59, 0x5b, 0xc3,
-  0x89, 0xda, 0x89, 0xc8, 0xe8, 0x23, 0xef, 0xff, 0xff, 0x59, 0x5b, 0xc3,
-  0x53, 0x51, 0x56, 0x57, 0x89, 0xc1, 0x89, 0xd7, 0x83, 0x78, 0x0c, 0x00,
-  0x74, 0x5c, 0x31, 0xf6, 0xf6, 0x40, 0x0d, 0x10, 0x75, 0x5b, 0x8b, 0x51,
-  0x04, 0x85, 0xd2, 0x74, 0x0f, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xf7, 0xda,
-  0x8b, 0x41, 0x10, 0xe8, 0x64, 0x19, 0x00, 0x00, 0x85, 0xff, 0x74, 0x0a,
-  0x8b, 0x41, 0x10, 0xe8, 0x58, 0x1b, 0x00, 0x00, 0x09, 0xc6, 0xf6, 0x41,
-  0x0c, 0x08, 0x74, 0x15, 0x8b, 0x41, 0x08, 0x8b, 0x40, 0x08, 0xe8, 0x15,
-  0xf1, 0xff, 0xff, 0x8b, 0x41, 0x08, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0xf6, 0x41, 0x0d, 0x08, 0x74, 0x08, 0x89, 0xc8, 0xff, 0x15, 0x60,
-  0x14, 0x00, 0x00, 0x89, 0xf0, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0xbe, 0xff,
-  0xff, 0xff, 0xff, 0xeb, 0xf2, 0xe8, 0xca, 0xf5, 0xff, 0xff, 0x89, 0xc6,
-  0xeb, 0x9c, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x51, 0x89, 0xc1, 0xe8,
-  0x78, 0xff, 0xff, 0xff, 0x89, 0xc2, 0x89, 0xc8, 0xe8, 0x3f, 0x00, 0x00,
-  0x00, 0x89, 0xd0, 0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d,
-  0x52, 0x00, 0x8b, 0xdb, 0x51, 0x52, 0x89, 0xc1, 0xa1, 0x20, 0x14, 0x00,
-  0x00, 0x85, 0xc0, 0x74, 0x0b, 0x3b, 0x48, 0x04, 0x74, 0x0e, 0x8b, 0x00,
-  0x85, 0xc0, 0x75, 0xf5, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x59, 0xc3,
-  0xba, 0x01, 0x00, 0x00, 0x00, 0x89, 0xc8, 0xe8, 0xb4, 0xff, 0xff, 0xff,
-  0x5a, 0x59, 0xc3, 0x00, 0x53, 0x51, 0x52, 0x89, 0xc1, 0xba, 0x20, 0x14,
-  0x00, 0x00, 0x8b, 0x02, 0x85, 0xc0, 0x74, 0x25, 0x8b, 0x58, 0x04, 0x39,
-  0xd9, 0x74, 0x04, 0x89, 0xc2, 0xeb, 0xef, 0x8a, 0x5b, 0x0c, 0x80, 0xcb,
-  0x03, 0x88, 0x59, 0x0c, 0x8b, 0x08, 0x89, 0x0a, 0x8b, 0x15, 0x24, 0x14,
-  0x00, 0x00, 0xa3, 0x24, 0x14, 0x00, 0x00, 0x89, 0x10, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0x83, 0x3d, 0x24,
-  0x14, 0x00, 0x00, 0x00, 0x74, 0x16, 0xa1, 0x24, 0x14, 0x00, 0x00, 0x8b,
-  0x10, 0xe8, 0x3a, 0xf0, 0xff, 0xff, 0x89, 0x15, 0x24, 0x14, 0x00, 0x00,
-  0x85, 0xd2, 0x75, 0xea, 0x5a, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x55, 0x89,
-  0xc1, 0x8b, 0x42, 0x08, 0x8b, 0x58, 0x0c, 0x83, 0xfb, 0x01, 0x74, 0x0f,
-  0x85, 0xdb, 0x0f, 0x85, 0x7e, 0x00, 0x00, 0x00, 0xc7, 0x40, 0x0c, 0x01,
-  0x00, 0x00, 0x00, 0xf6, 0x42, 0x0c, 0x02, 0x0f, 0x84, 0x76, 0x00, 0x00,
-  0x00, 0x8b, 0x42, 0x08, 0x83, 0x78, 0x08, 0x00, 0x75, 0x07, 0x89, 0xd0,
-  0xe8, 0x87, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x04, 0x00, 0x00, 0x83, 0xf9,
-  0x0a, 0x75, 0x2d, 0xbb, 0x00, 0x06, 0x00, 0x00, 0xf6, 0x42, 0x0c, 0x40,
-  0x75, 0x22, 0x8b, 0x02, 0x80, 0x4a, 0x0d, 0x10, 0xc6, 0x00, 0x0d, 0x8b,
-  0x42, 0x04, 0xff, 0x02, 0x40, 0x89, 0x42, 0x04, 0x3b, 0x42, 0x14, 0x75,
-  0x0b, 0x89, 0xd0, 0xe8, 0x94, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x26,
-  0x8b, 0x02, 0x80, 0x4a, 0x0d, 0x10, 0x88, 0x08, 0x8b, 0x6a, 0x04, 0xff,
-  0x02, 0x45, 0x89, 0x6a, 0x04, 0x85, 0x5a, 0x0c, 0x75, 0x05, 0x3b, 0x6a,
-  0x14, 0x75, 0x2b, 0x89, 0xd0, 0xe8, 0x6e, 0xf4, 0xff, 0xff, 0x85, 0xc0,
-  0x74, 0x20, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x59, 0x5b, 0xc3, 0xb8,
-  0x04, 0x00, 0x00, 0x00, 0xe8, 0x97, 0xfa, 0xff, 0xff, 0xb8, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x4a, 0x0c, 0x20, 0x5d, 0x59, 0x5b, 0xc3, 0x31, 0xc0,
-  0x88, 0xc8, 0x5d, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x53, 0x51, 0x52, 0x89,
-  0xc2, 0xe8, 0xd6, 0x19, 0x00, 0x00, 0x83, 0x7a, 0x14, 0x00, 0x75, 0x0e,
-  0x8a, 0x42, 0x0d, 0xa8, 0x02, 0x74, 0x52, 0xc7, 0x42, 0x14, 0x86, 0x00,
-  0x00, 0x00, 0x8b, 0x42, 0x14, 0xe8, 0x3a, 0xf0, 0xff, 0xff, 0x8b, 0x4a,
-  0x08, 0x89, 0x41, 0x08, 0x8b, 0x42, 0x08, 0x83, 0x78, 0x08, 0x00, 0x75,
-  0x4a, 0x8a, 0x7a, 0x0d, 0x80, 0xe7, 0xf8, 0x88, 0xf9, 0x88, 0x7a, 0x0d,
-  0x80, 0xc9, 0x04, 0x8b, 0x42, 0x08, 0x88, 0x4a, 0x0d, 0x8d, 0x4a, 0x18,
-  0x89, 0x48, 0x08, 0xc7, 0x42, 0x14, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x42,
-  0x08, 0x8b, 0x40, 0x08, 0xc7, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x02, 0x5a, 0x59, 0x5b, 0xc3, 0xa8, 0x04, 0x74, 0x09, 0xc7, 0x42, 0x14,
-  0x40, 0x00, 0x00, 0x00, 0xeb, 0xa8, 0xc7, 0x42, 0x14, 0x00, 0x10, 0x00,
-  0x00, 0xeb, 0x9f, 0x80, 0x4a, 0x0c, 0x08, 0x8b, 0x42, 0x08, 0x8b, 0x40,
-  0x08, 0xc7, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89, 0x02, 0x5a, 0x59,
-  0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x56, 0x57, 0x06, 0x55, 0x81, 0xec, 0x88, 0x00, 0x00, 0x00, 0x89, 0xde,
-  0x89, 0xcf, 0x89, 0x44, 0x24, 0x48, 0x31, 0xc0, 0xc6, 0x84, 0x24, 0x84,
-  0x00, 0x00, 0x00, 0x00, 0x66, 0x89, 0x44, 0x24, 0x4c, 0x31, 0xc0, 0x66,
-  0xc7, 0x44, 0x24, 0x4e, 0xc8, 0x00, 0x89, 0x44, 0x24, 0x58, 0x89, 0x94,
-  0x24, 0x80, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x00, 0x74, 0x33, 0x8b, 0x84,
-  0x24, 0x80, 0x00, 0x00, 0x00, 0x8b, 0xac, 0x24, 0x80, 0x00, 0x00, 0x00,
-  0x8a, 0x28, 0x45, 0x80, 0xfd, 0x25, 0x74, 0x2c, 0x31, 0xd2, 0x8d, 0x44,
-  0x24, 0x48, 0x88, 0xea, 0x89, 0xac, 0x24, 0x80, 0x00, 0x00, 0x00, 0xff,
-  0xd7, 0x8b, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x80, 0x38, 0x00, 0x75,
-  0xcd, 0x8b, 0x44, 0x24, 0x58, 0x81, 0xc4, 0x88, 0x00, 0x00, 0x00, 0x5d,
-  0x07, 0x5f, 0x5e, 0xc3, 0x8d, 0x5c, 0x24, 0x48, 0x8b, 0x06, 0x8d, 0x54,
-  0x24, 0x78, 0x89, 0x44, 0x24, 0x78, 0x89, 0xe8, 0xe8, 0x1f, 0x02, 0x00,
-  0x00, 0x89, 0xc5, 0x8b, 0x44, 0x24, 0x78, 0x45, 0x89, 0x06, 0x8a, 0x45,
-  0xff, 0x89, 0xac, 0x24, 0x80, 0x00, 0x00, 0x00, 0x88, 0x44, 0x24, 0x74,
-  0x84, 0xc0, 0x74, 0xc1, 0x3c, 0x6e, 0x0f, 0x85, 0x8e, 0x00, 0x00, 0x00,
-  0x8a, 0x5c, 0x24, 0x4d, 0xf6, 0xc3, 0x04, 0x74, 0x20, 0x8b, 0x16, 0x83,
-  0xc2, 0x08, 0x89, 0x16, 0x8e, 0x42, 0xfc, 0x8b, 0x6a, 0xf8, 0x8a, 0x4c,
-  0x24, 0x4c, 0xf6, 0xc1, 0x10, 0x74, 0x31, 0x8a, 0x44, 0x24, 0x58, 0x26,
-  0x88, 0x45, 0x00, 0xeb, 0x84, 0xf6, 0xc3, 0x02, 0x74, 0x12, 0x8b, 0x06,
-  0x83, 0xc0, 0x04, 0x89, 0xc5, 0x89, 0x06, 0x8c, 0xd8, 0x8e, 0xc0, 0x8b,
-  0x6d, 0xfc, 0xeb, 0xd6, 0x8b, 0x2e, 0x83, 0xc5, 0x04, 0x8c, 0xd8, 0x89,
-  0x2e, 0x8e, 0xc0, 0x8b, 0x6d, 0xfc, 0xeb, 0xc6, 0xf6, 0xc1, 0x20, 0x74,
-  0x0e, 0x8b, 0x44, 0x24, 0x58, 0x66, 0x26, 0x89, 0x45, 0x00, 0xe9, 0x4a,
-  0xff, 0xff, 0xff, 0xf6, 0xc1, 0x40, 0x74, 0x0d, 0x8b, 0x44, 0x24, 0x58,
-  0x26, 0x89, 0x45, 0x00, 0xe9, 0x38, 0xff, 0xff, 0xff, 0xf6, 0xc1, 0x80,
-  0x74, 0xee, 0x8b, 0x44, 0x24, 0x58, 0x26, 0x89, 0x45, 0x00, 0xc1, 0xf8,
-  0x1f, 0x26, 0x89, 0x45, 0x04, 0xe9, 0x1f, 0xff, 0xff, 0xff, 0x8d, 0x8c,
-  0x24, 0x84, 0x00, 0x00, 0x00, 0x8d, 0x5c, 0x24, 0x48, 0x8b, 0x06, 0x8d,
-  0x54, 0x24, 0x7c, 0x89, 0x44, 0x24, 0x7c, 0x89, 0xe0, 0xe8, 0xe2, 0x05,
-  0x00, 0x00, 0x89, 0xc5, 0x8b, 0x44, 0x24, 0x7c, 0x8e, 0xc2, 0x89, 0x06,
-  0x8b, 0x44, 0x24, 0x5c, 0x03, 0x44, 0x24, 0x60, 0x03, 0x44, 0x24, 0x64,
-  0x03, 0x44, 0x24, 0x68, 0x03, 0x44, 0x24, 0x6c, 0x03, 0x44, 0x24, 0x70,
-  0x29, 0x44, 0x24, 0x50, 0xf6, 0x44, 0x24, 0x4c, 0x08, 0x75, 0x1f, 0x80,
-  0x7c, 0x24, 0x75, 0x20, 0x75, 0x18, 0x83, 0x7c, 0x24, 0x50, 0x00, 0x7e,
-  0x11, 0xba, 0x20, 0x00, 0x00, 0x00, 0x8d, 0x44, 0x24, 0x48, 0xff, 0xd7,
-  0xff, 0x4c, 0x24, 0x50, 0xeb, 0xe8, 0x89, 0xe1, 0x83, 0x7c, 0x24, 0x5c,
-  0x00, 0x7e, 0x18, 0x31, 0xd2, 0x8d, 0x44, 0x24, 0x48, 0x8a, 0x11, 0xff,
-  0xd7, 0x8b, 0x54, 0x24, 0x5c, 0x4a, 0x41, 0x89, 0x54, 0x24, 0x5c, 0x85,
-  0xd2, 0x7f, 0xe8, 0x83, 0x7c, 0x24, 0x60, 0x00, 0x7e, 0x11, 0xba, 0x30,
-  0x00, 0x00, 0x00, 0x8d, 0x44, 0x24, 0x48, 0xff, 0xd7, 0xff, 0x4c, 0x24,
-  0x60, 0xeb, 0xe8, 0x8a, 0x54, 0x24, 0x74, 0x80, 0xfa, 0x73, 0x75, 0x48,
-  0xf6, 0x44, 0x24, 0x4c, 0x40, 0x75, 0x1a, 0x83, 0x7c, 0x24, 0x64, 0x00,
-  0x7e, 0x22, 0x31, 0xd2, 0x8d, 0x44, 0x24, 0x48, 0x26, 0x8a, 0x55, 0x00,
-  0x45, 0xff, 0xd7, 0xff, 0x4c, 0x24, 0x64, 0xeb, 0xe6, 0x8d, 0x5c, 0x24,
-  0x48, 0x89, 0xf9, 0x8c, 0xc2, 0x89, 0xe8, 0xe8, 0xb4, 0x04, 0x00, 0x00,
-  0x83, 0x7c, 0x24, 0x68, 0x00, 0x7e, 0x30, 0xba, 0x30, 0x00, 0x00, 0x00,
-  0x8d, 0x44, 0x24, 0x48, 0xff, 0xd7, 0xff, 0x4c, 0x24, 0x68, 0xeb, 0xe8,
-  0x80, 0xfa, 0x53, 0x74, 0xd4, 0x83, 0x7c, 0x24, 0x64, 0x00, 0x7e, 0xdc,
-  0x31, 0xd2, 0x8d, 0x44, 0x24, 0x48, 0x26, 0x8a, 0x55, 0x00, 0x45, 0xff,
-  0xd7, 0xff, 0x4c, 0x24, 0x64, 0xeb, 0xe6, 0x83, 0x7c, 0x24, 0x6c, 0x00,
-  0x7e, 0x13, 0x31, 0xd2, 0x8d, 0x44, 0x24, 0x48, 0x26, 0x8a, 0x55, 0x00,
-  0x45, 0xff, 0xd7, 0xff, 0x4c, 0x24, 0x6c, 0xeb, 0xe6, 0x83, 0x7c, 0x24,
-  0x70, 0x00, 0x7e, 0x11, 0xba, 0x30, 0x00, 0x00, 0x00, 0x8d, 0x44, 0x24,
-  0x48, 0xff, 0xd7, 0xff, 0x4c, 0x24, 0x70, 0xeb, 0xe8, 0xf6, 0x44, 0x24,
-  0x4c, 0x08, 0x0f, 0x84, 0xd1, 0xfd, 0xff, 0xff, 0x83, 0x7c, 0x24, 0x50,
-  0x00, 0x0f, 0x8e, 0xc6, 0xfd, 0xff, 0xff, 0xba, 0x20, 0x00, 0x00, 0x00,
-  0x8d, 0x44, 0x24, 0x48, 0xff, 0xd7, 0xff, 0x4c, 0x24, 0x50, 0xeb, 0xe4,
-  0x8d, 0x44, 0x20, 0x00, 0x51, 0x56, 0x57, 0x89, 0xd6, 0x89, 0xda, 0xc6,
-  0x43, 0x2d, 0x20, 0xe8, 0x70, 0x01, 0x00, 0x00, 0xc7, 0x43, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x38, 0x2a, 0x74, 0x1f, 0x8a, 0x10, 0x80, 0xfa,
-  0x30, 0x72, 0x2a, 0x80, 0xfa, 0x39, 0x77, 0x25, 0x6b, 0x4b, 0x08, 0x0a,
-  0x31, 0xd2, 0x8a, 0x10, 0x83, 0xea, 0x30, 0x01, 0xd1, 0x40, 0x89, 0x4b,
-  0x08, 0xeb, 0xe1, 0x8b, 0x16, 0x83, 0xc2, 0x04, 0x89, 0x16, 0x8b, 0x52,
-  0xfc, 0x89, 0x53, 0x08, 0x85, 0xd2, 0x7c, 0x39, 0x40, 0xc7, 0x43, 0x0c,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x38, 0x2e, 0x75, 0x4b, 0x40, 0xc7, 0x43,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x38, 0x2a, 0x74, 0x2c, 0x8a, 0x10,
-  0x80, 0xfa, 0x30, 0x72, 0x37, 0x80, 0xfa, 0x39, 0x77, 0x32, 0x6b, 0x4b,
-  0x0c, 0x0a, 0x31, 0xd2, 0x8a, 0x10, 0x83, 0xea, 0x30, 0x01, 0xd1, 0x40,
-  0x89, 0x4b, 0x0c, 0xeb, 0xe1, 0x89, 0xd7, 0x80, 0x4b, 0x04, 0x08, 0xf7,
-  0xdf, 0x89, 0x7b, 0x08, 0xeb, 0xba, 0x8b, 0x16, 0x83, 0xc2, 0x04, 0x89,
-  0x16, 0x8b, 0x52, 0xfc, 0x89, 0x53, 0x0c, 0x85, 0xd2, 0x7c, 0x31, 0x40,
-  0x8a, 0x10, 0x8d, 0x70, 0x01, 0x80, 0xfa, 0x68, 0x73, 0x2f, 0x80, 0xfa,
-  0x4c, 0x0f, 0x83, 0x7d, 0x00, 0x00, 0x00, 0x80, 0xfa, 0x49, 0x0f, 0x85,
-  0x8a, 0x00, 0x00, 0x00, 0x80, 0x78, 0x01, 0x36, 0x75, 0x0a, 0x80, 0x78,
-  0x02, 0x34, 0x0f, 0x84, 0x92, 0x00, 0x00, 0x00, 0x5f, 0x5e, 0x59, 0xc3,
-  0xc7, 0x43, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xc6, 0x8d, 0x48, 0x02,
-  0x77, 0x14, 0x80, 0x78, 0x01, 0x68, 0x0f, 0x85, 0x6c, 0x00, 0x00, 0x00,
-  0x89, 0xc8, 0x80, 0x4b, 0x04, 0x10, 0x5f, 0x5e, 0x59, 0xc3, 0x80, 0xfa,
-  0x74, 0x73, 0x14, 0x80, 0xfa, 0x6c, 0x75, 0x24, 0x3a, 0x50, 0x01, 0x75,
-  0x16, 0x89, 0xc8, 0x80, 0x4b, 0x04, 0x80, 0x5f, 0x5e, 0x59, 0xc3, 0x76,
-  0x5c, 0x80, 0xfa, 0x7a, 0x74, 0x57, 0x80, 0xfa, 0x77, 0x75, 0xb5, 0x40,
-  0x80, 0x4b, 0x04, 0x40, 0x5f, 0x5e, 0x59, 0xc3, 0x80, 0xfa, 0x6a, 0x75,
-  0xa7, 0x40, 0x66, 0x81, 0x4b, 0x04, 0x80, 0x01, 0x5f, 0x5e, 0x59, 0xc3,
-  0x76, 0xf3, 0x80, 0xfa, 0x57, 0x74, 0x14, 0x80, 0xfa, 0x4e, 0x75, 0x90,
-  0x89, 0xf0, 0x80, 0x4b, 0x05, 0x02, 0x5f, 0x5e, 0x59, 0xc3, 0x80, 0xfa,
-  0x46, 0x75, 0x81, 0x40, 0x80, 0x4b, 0x05, 0x04, 0x5f, 0x5e, 0x59, 0xc3,
-  0x89, 0xf0, 0x80, 0x4b, 0x04, 0x20, 0x5f, 0x5e, 0x59, 0xc3, 0x83, 0xc0,
-  0x03, 0x80, 0x4b, 0x04, 0x80, 0x5f, 0x5e, 0x59, 0xc3, 0x40, 0x5f, 0x5e,
-  0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00,
-  0x00, 0x00, 0x8b, 0xc0, 0x53, 0x51, 0x66, 0xc7, 0x42, 0x04, 0x00, 0x00,
-  0x8a, 0x18, 0x80, 0xfb, 0x2d, 0x74, 0x0c, 0x80, 0xfb, 0x23, 0x75, 0x0d,
-  0x80, 0x4a, 0x04, 0x01, 0x40, 0xeb, 0xed, 0x80, 0x4a, 0x04, 0x08, 0xeb,
-  0xf7, 0x80, 0xfb, 0x2b, 0x75, 0x11, 0x8a, 0x6a, 0x04, 0x80, 0xcd, 0x04,
-  0x88, 0xeb, 0x80, 0xe3, 0xfd, 0x88, 0x5a, 0x04, 0x40, 0xeb, 0xd1, 0x80,
-  0xfb, 0x20, 0x75, 0x13, 0x8a, 0x7a, 0x04, 0xf6, 0xc7, 0x04, 0x75, 0xd4,
-  0x88, 0xf9, 0x80, 0xc9, 0x02, 0x88, 0x4a, 0x04, 0x40, 0xeb, 0xb9, 0x80,
-  0xfb, 0x30, 0x75, 0x06, 0x88, 0x5a, 0x2d, 0x40, 0xeb, 0xae, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x51, 0x56, 0x57, 0x06, 0x89, 0xd1, 0x89, 0xdf,
-  0x89, 0xc2, 0x31, 0xc0, 0x85, 0xdb, 0x74, 0x10, 0x8e, 0xc1, 0x89, 0xd6,
-  0x42, 0x26, 0x80, 0x3e, 0x00, 0x74, 0x05, 0x40, 0x39, 0xf8, 0x75, 0xf2,
-  0x07, 0x5f, 0x5e, 0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d,
-  0x52, 0x00, 0x8b, 0xdb, 0x51, 0x56, 0x06, 0x83, 0xec, 0x04, 0x89, 0xde,
-  0x8e, 0xc2, 0x89, 0xc1, 0x31, 0xdb, 0x83, 0xfe, 0xff, 0x75, 0x29, 0x66,
-  0x26, 0x83, 0x39, 0x00, 0x74, 0x19, 0x31, 0xd2, 0x89, 0xe0, 0x66, 0x26,
-  0x8b, 0x11, 0x83, 0xc1, 0x02, 0xe8, 0x96, 0x14, 0x00, 0x00, 0x83, 0xf8,
-  0xff, 0x74, 0xe4, 0x01, 0xc3, 0xeb, 0xe0, 0x89, 0xd8, 0x83, 0xc4, 0x04,
-  0x07, 0x5e, 0x59, 0xc3, 0x66, 0x26, 0x8b, 0x01, 0x66, 0x85, 0xc0, 0x74,
-  0x1c, 0x39, 0xf3, 0x7f, 0x18, 0x31, 0xd2, 0x66, 0x89, 0xc2, 0x89, 0xe0,
-  0x83, 0xc1, 0x02, 0xe8, 0x68, 0x14, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x74,
-  0xdf, 0x01, 0xc3, 0xeb, 0xdb, 0x39, 0xf3, 0x7e, 0xce, 0x89, 0xf0, 0x83,
-  0xc4, 0x04, 0x07, 0x5e, 0x59, 0xc3, 0x8b, 0xc0, 0x51, 0x56, 0x57, 0x55,
-  0x83, 0xec, 0x04, 0x89, 0xd5, 0x89, 0x1c, 0x24, 0xbb, 0x10, 0x00, 0x00,
-  0x00, 0x89, 0xef, 0xe8, 0xb8, 0x14, 0x00, 0x00, 0x06, 0x8c, 0xd8, 0x8e,
-  0xc0, 0x2b, 0xc9, 0x49, 0x33, 0xc0, 0xf2, 0xae, 0xf7, 0xd1, 0x49, 0x07,
-  0x8b, 0x04, 0x24, 0x89, 0xca, 0x48, 0x85, 0xc9, 0x74, 0x14, 0x89, 0xee,
-  0x8d, 0x0c, 0x28, 0x01, 0xea, 0x49, 0x8a, 0x5a, 0xff, 0x4a, 0x48, 0x88,
-  0x59, 0x01, 0x39, 0xf2, 0x75, 0xf3, 0x8d, 0x14, 0x28, 0x85, 0xc0, 0x7c,
-  0x07, 0x48, 0xc6, 0x02, 0x30, 0x4a, 0xeb, 0xf5, 0x03, 0x2c, 0x24, 0xc6,
-  0x45, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x8d,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x51, 0x56, 0x83, 0xec, 0x04, 0x89, 0xc1, 0x89, 0xde, 0x89, 0x14, 0x24,
-  0x85, 0xd2, 0x0f, 0x8c, 0x7e, 0x00, 0x00, 0x00, 0x83, 0x7e, 0x0c, 0xff,
-  0x75, 0x07, 0xc7, 0x46, 0x0c, 0x04, 0x00, 0x00, 0x00, 0xbb, 0x0a, 0x00,
-  0x00, 0x00, 0x31, 0xc0, 0x89, 0xca, 0x66, 0x8b, 0x44, 0x24, 0x02, 0xe8,
-  0x2c, 0x14, 0x00, 0x00, 0x89, 0xcb, 0x80, 0x39, 0x00, 0x74, 0x06, 0x41,
-  0x80, 0x39, 0x00, 0x75, 0xfa, 0x83, 0x7e, 0x0c, 0x00, 0x74, 0x2d, 0xc6,
-  0x01, 0x2e, 0x31, 0xc0, 0x41, 0x83, 0x7e, 0x0c, 0x00, 0x7e, 0x1e, 0x31,
-  0xd2, 0x66, 0x89, 0x54, 0x24, 0x02, 0x6b, 0x14, 0x24, 0x0a, 0x89, 0x14,
-  0x24, 0x8a, 0x54, 0x24, 0x02, 0x80, 0xc2, 0x30, 0x40, 0x88, 0x11, 0x41,
-  0x3b, 0x46, 0x0c, 0x7c, 0xe2, 0xc6, 0x01, 0x00, 0xf6, 0x44, 0x24, 0x01,
-  0x80, 0x74, 0x57, 0x39, 0xd9, 0x74, 0x23, 0x49, 0x80, 0x39, 0x2e, 0x75,
-  0x01, 0x49, 0x8a, 0x11, 0x80, 0xfa, 0x39, 0x75, 0x4b, 0xc6, 0x01, 0x30,
-  0xeb, 0xe9, 0x89, 0xd0, 0xc6, 0x01, 0x2d, 0xf7, 0xd8, 0x41, 0x89, 0x04,
-  0x24, 0xe9, 0x72, 0xff, 0xff, 0xff, 0x8d, 0x4b, 0x01, 0xc6, 0x03, 0x31,
-  0x80, 0x39, 0x30, 0x75, 0x06, 0x41, 0x80, 0x39, 0x30, 0x74, 0xfa, 0x8a,
-  0x01, 0x3c, 0x2e, 0x75, 0x14, 0xc6, 0x01, 0x30, 0x83, 0xc1, 0x02, 0x88,
-  0x41, 0xff, 0x80, 0x39, 0x30, 0x75, 0x06, 0x41, 0x80, 0x39, 0x30, 0x74,
-  0xfa, 0x66, 0xc7, 0x01, 0x30, 0x00, 0x83, 0xc4, 0x04, 0x5e, 0x59, 0xc3,
-  0x88, 0xd6, 0xfe, 0xc6, 0x88, 0x31, 0x83, 0xc4, 0x04, 0x5e, 0x59, 0xc3,
-  0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x52, 0xf6, 0x40, 0x04, 0x08, 0x75, 0x26, 0x80, 0x78, 0x2d, 0x30,
-  0x75, 0x20, 0x8b, 0x50, 0x08, 0x8b, 0x58, 0x18, 0x2b, 0x50, 0x14, 0x29,
-  0xda, 0x2b, 0x50, 0x1c, 0x2b, 0x50, 0x20, 0x2b, 0x50, 0x24, 0x2b, 0x50,
-  0x28, 0x85, 0xd2, 0x7e, 0x05, 0x01, 0xd3, 0x89, 0x58, 0x18, 0x5a, 0x5b,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x40, 0x00, 0x56, 0x57, 0x06, 0x55, 0x83, 0xec, 0x04, 0x8e,
-  0xc2, 0x89, 0xc7, 0x89, 0xcd, 0x83, 0x7b, 0x1c, 0x00, 0x7e, 0x38, 0x31,
-  0xd2, 0x89, 0xe0, 0x66, 0x26, 0x8b, 0x17, 0x83, 0xc7, 0x02, 0xe8, 0x8d,
-  0x12, 0x00, 0x00, 0x89, 0xc1, 0x83, 0xf8, 0xff, 0x74, 0x1b, 0x3b, 0x43,
-  0x1c, 0x7f, 0x24, 0x89, 0xe6, 0x49, 0x83, 0xf9, 0xff, 0x74, 0x0e, 0x31,
-  0xd2, 0x89, 0xd8, 0x8a, 0x16, 0x46, 0xff, 0xd5, 0xff, 0x4b, 0x1c, 0xeb,
-  0xec, 0x83, 0x7b, 0x1c, 0x00, 0x7f, 0xc8, 0x83, 0xc4, 0x04, 0x5d, 0x07,
-  0x5f, 0x5e, 0xc3, 0xc7, 0x43, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x83, 0xc4,
-  0x04, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc0, 0x56, 0x57, 0x06, 0x55,
-  0x83, 0xec, 0x10, 0x89, 0xc7, 0x89, 0xde, 0x89, 0xd0, 0x1e, 0x07, 0xc7,
-  0x43, 0x28, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x53, 0x28, 0x89, 0x53, 0x24,
-  0x89, 0x53, 0x20, 0x89, 0x53, 0x1c, 0x89, 0x53, 0x18, 0x89, 0x53, 0x14,
-  0x8a, 0x53, 0x2c, 0x89, 0xfd, 0x80, 0xfa, 0x62, 0x75, 0x75, 0x8a, 0x5e,
-  0x04, 0xf6, 0xc3, 0x80, 0x0f, 0x84, 0xfa, 0x00, 0x00, 0x00, 0x8b, 0x10,
-  0x83, 0xc2, 0x08, 0x89, 0x10, 0x8b, 0x5a, 0xf8, 0x8b, 0x52, 0xfc, 0x89,
-  0x5c, 0x24, 0x04, 0x89, 0x54, 0x24, 0x08, 0x8a, 0x56, 0x2c, 0xc7, 0x04,
-  0x24, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xfa, 0x64, 0x0f, 0x83, 0xa7, 0x01,
-  0x00, 0x00, 0x80, 0xfa, 0x50, 0x0f, 0x83, 0x3d, 0x04, 0x00, 0x00, 0x80,
-  0xfa, 0x45, 0x0f, 0x83, 0x9d, 0x04, 0x00, 0x00, 0x80, 0xfa, 0x43, 0x0f,
-  0x84, 0x5f, 0x06, 0x00, 0x00, 0xc7, 0x46, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x8a, 0x46, 0x2c, 0x88, 0x07, 0xc7, 0x46, 0x14, 0x01, 0x00, 0x00, 0x00,
-  0x89, 0xf0, 0xe8, 0xb5, 0xfe, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83,
-  0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x80, 0xfa, 0x6f, 0x74, 0x86,
-  0x80, 0xfa, 0x75, 0x74, 0x81, 0x80, 0xfa, 0x78, 0x0f, 0x84, 0x78, 0xff,
-  0xff, 0xff, 0x80, 0xfa, 0x58, 0x0f, 0x84, 0x6f, 0xff, 0xff, 0xff, 0x80,
-  0xfa, 0x64, 0x0f, 0x85, 0xb1, 0x00, 0x00, 0x00, 0x8a, 0x7e, 0x04, 0xf6,
-  0xc7, 0x80, 0x0f, 0x84, 0xb3, 0x00, 0x00, 0x00, 0x8b, 0x18, 0x83, 0xc3,
-  0x08, 0x89, 0x18, 0x89, 0xda, 0x8b, 0x5b, 0xf8, 0x8b, 0x52, 0xfc, 0x89,
-  0x5c, 0x24, 0x04, 0x89, 0x54, 0x24, 0x08, 0x31, 0xd2, 0xf6, 0x46, 0x04,
-  0x80, 0x0f, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x8b, 0x5c, 0x24, 0x08, 0x85,
-  0xdb, 0x7c, 0x08, 0x85, 0xd2, 0x0f, 0x84, 0xcd, 0x00, 0x00, 0x00, 0x8b,
-  0x56, 0x14, 0x8d, 0x5a, 0x01, 0x89, 0x5e, 0x14, 0xc6, 0x04, 0x3a, 0x2d,
-  0xf6, 0x46, 0x04, 0x80, 0x0f, 0x84, 0xaf, 0x00, 0x00, 0x00, 0x8b, 0x54,
-  0x24, 0x08, 0xf7, 0xda, 0x89, 0x54, 0x24, 0x08, 0xf7, 0x5c, 0x24, 0x04,
-  0x83, 0xda, 0x00, 0xe9, 0x17, 0xff, 0xff, 0xff, 0xf6, 0xc3, 0x40, 0x74,
-  0x0f, 0x8b, 0x18, 0x83, 0xc3, 0x04, 0x89, 0x18, 0x8b, 0x4b, 0xfc, 0xe9,
-  0x07, 0xff, 0xff, 0xff, 0x8b, 0x08, 0x83, 0xc1, 0x04, 0x89, 0x08, 0x8a,
-  0x56, 0x04, 0x8b, 0x49, 0xfc, 0xf6, 0xc2, 0x20, 0x74, 0x0b, 0x81, 0xe1,
-  0xff, 0xff, 0x00, 0x00, 0xe9, 0xea, 0xfe, 0xff, 0xff, 0xf6, 0xc2, 0x10,
-  0x0f, 0x84, 0xe1, 0xfe, 0xff, 0xff, 0x81, 0xe1, 0xff, 0x00, 0x00, 0x00,
-  0xe9, 0xd6, 0xfe, 0xff, 0xff, 0x80, 0xfa, 0x69, 0x0f, 0x84, 0x46, 0xff,
-  0xff, 0xff, 0xe9, 0xc8, 0xfe, 0xff, 0xff, 0xf6, 0xc7, 0x40, 0x74, 0x0f,
-  0x8b, 0x08, 0x83, 0xc1, 0x04, 0x89, 0x08, 0x8b, 0x49, 0xfc, 0xe9, 0x50,
-  0xff, 0xff, 0xff, 0x8b, 0x10, 0x83, 0xc2, 0x04, 0x89, 0x10, 0x8b, 0x4a,
-  0xfc, 0x8a, 0x56, 0x04, 0xf6, 0xc2, 0x20, 0x74, 0x08, 0x0f, 0xbf, 0xc9,
-  0xe9, 0x36, 0xff, 0xff, 0xff, 0xf6, 0xc2, 0x10, 0x0f, 0x84, 0x2d, 0xff,
-  0xff, 0xff, 0x0f, 0xbe, 0xc9, 0xe9, 0x25, 0xff, 0xff, 0xff, 0x85, 0xc9,
-  0xe9, 0x30, 0xff, 0xff, 0xff, 0xf7, 0xd9, 0xe9, 0x7b, 0xfe, 0xff, 0xff,
-  0x8a, 0x7e, 0x04, 0xf6, 0xc7, 0x04, 0x74, 0x12, 0x8b, 0x56, 0x14, 0x8d,
-  0x5a, 0x01, 0x89, 0x5e, 0x14, 0xc6, 0x04, 0x3a, 0x2b, 0xe9, 0x61, 0xfe,
-  0xff, 0xff, 0xf6, 0xc7, 0x02, 0x0f, 0x84, 0x58, 0xfe, 0xff, 0xff, 0x8b,
-  0x56, 0x14, 0x8d, 0x5a, 0x01, 0x89, 0x5e, 0x14, 0xc6, 0x04, 0x3a, 0x20,
-  0xe9, 0x46, 0xfe, 0xff, 0xff, 0x0f, 0x87, 0x8e, 0x00, 0x00, 0x00, 0x83,
-  0x7e, 0x0c, 0xff, 0x74, 0x04, 0xc6, 0x46, 0x2d, 0x20, 0x8b, 0x46, 0x14,
-  0x8c, 0xda, 0x01, 0xf8, 0x8e, 0xc2, 0x89, 0xc5, 0xf6, 0x46, 0x04, 0x80,
-  0x0f, 0x84, 0xd2, 0x03, 0x00, 0x00, 0x83, 0x7e, 0x0c, 0x00, 0x0f, 0x85,
-  0x93, 0x03, 0x00, 0x00, 0x83, 0x7c, 0x24, 0x08, 0x00, 0x0f, 0x85, 0x88,
-  0x03, 0x00, 0x00, 0x83, 0x7c, 0x24, 0x04, 0x00, 0x0f, 0x85, 0x7d, 0x03,
-  0x00, 0x00, 0x26, 0xc6, 0x00, 0x00, 0x31, 0xc0, 0x89, 0xc2, 0x8b, 0x4e,
-  0x0c, 0x89, 0x46, 0x1c, 0x39, 0xc8, 0x0f, 0x8c, 0xd9, 0x03, 0x00, 0x00,
-  0xf6, 0x46, 0x04, 0x01, 0x0f, 0x84, 0x22, 0xfe, 0xff, 0xff, 0x83, 0x3c,
-  0x24, 0x0a, 0x0f, 0x8d, 0x18, 0xfe, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x0b,
-  0x26, 0x80, 0x7d, 0x00, 0x30, 0x0f, 0x84, 0x09, 0xfe, 0xff, 0xff, 0xff,
-  0x46, 0x18, 0x89, 0xf0, 0xe8, 0xbb, 0xfc, 0xff, 0xff, 0x8c, 0xc2, 0x89,
-  0xe8, 0x83, 0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x80, 0xfa, 0x6f,
-  0x73, 0x50, 0x80, 0xfa, 0x66, 0x0f, 0x82, 0xdd, 0x01, 0x00, 0x00, 0x0f,
-  0x87, 0xc5, 0x01, 0x00, 0x00, 0xf6, 0x46, 0x04, 0x20, 0x0f, 0x84, 0xcd,
-  0x01, 0x00, 0x00, 0x8b, 0x10, 0x83, 0xc2, 0x04, 0x89, 0xf3, 0x89, 0x10,
-  0x89, 0xf8, 0x8b, 0x52, 0xfc, 0xe8, 0x8e, 0xfb, 0xff, 0xff, 0xbb, 0xff,
-  0xff, 0xff, 0xff, 0x8c, 0xda, 0x89, 0xf8, 0xe8, 0x70, 0xfa, 0xff, 0xff,
-  0x89, 0x46, 0x1c, 0x89, 0xf0, 0xe8, 0x66, 0xfc, 0xff, 0xff, 0x8c, 0xc2,
-  0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x77, 0x0c,
-  0xc7, 0x04, 0x24, 0x08, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xff, 0xff, 0xff,
-  0x80, 0xfa, 0x73, 0x0f, 0x83, 0x97, 0x00, 0x00, 0x00, 0x80, 0xfa, 0x70,
-  0x0f, 0x85, 0x6b, 0xfd, 0xff, 0xff, 0x83, 0x7e, 0x08, 0x00, 0x75, 0x11,
-  0xf6, 0x46, 0x05, 0x04, 0x0f, 0x84, 0x35, 0x03, 0x00, 0x00, 0xc7, 0x46,
-  0x08, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x66, 0x04, 0xf9, 0x8b, 0x18, 0x83,
-  0xc3, 0x04, 0x89, 0x18, 0x89, 0xda, 0x8b, 0x4b, 0xfc, 0xf6, 0x46, 0x05,
-  0x04, 0x0f, 0x84, 0x20, 0x03, 0x00, 0x00, 0x8d, 0x53, 0x04, 0x89, 0x10,
-  0x8b, 0x42, 0xfc, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x25, 0xff, 0xff, 0x00,
-  0x00, 0x89, 0xfa, 0xe8, 0x90, 0xfa, 0xff, 0xff, 0xbb, 0x08, 0x00, 0x00,
-  0x00, 0x8d, 0x57, 0x05, 0x89, 0xc8, 0xc6, 0x47, 0x04, 0x3a, 0xe8, 0x7d,
-  0xfa, 0xff, 0xff, 0x80, 0x7e, 0x2c, 0x50, 0x75, 0x07, 0x89, 0xf8, 0xe8,
-  0x70, 0x0f, 0x00, 0x00, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xc2, 0x89,
-  0xe8, 0xe8, 0xc2, 0xf9, 0xff, 0xff, 0x89, 0x46, 0x14, 0x89, 0xf0, 0xe8,
-  0xb8, 0xfb, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d,
-  0x07, 0x5f, 0x5e, 0xc3, 0x0f, 0x87, 0x76, 0x00, 0x00, 0x00, 0xc6, 0x07,
-  0x00, 0x8a, 0x6e, 0x05, 0xf6, 0xc5, 0x04, 0x0f, 0x84, 0x79, 0x01, 0x00,
-  0x00, 0x8b, 0x18, 0x83, 0xc3, 0x08, 0x89, 0x18, 0x8b, 0x53, 0xf8, 0x66,
-  0x8b, 0x43, 0xfc, 0x85, 0xd2, 0x75, 0x05, 0x66, 0x85, 0xc0, 0x74, 0x04,
-  0x8e, 0xc0, 0x89, 0xd5, 0x80, 0x7e, 0x2c, 0x53, 0x0f, 0x85, 0xa4, 0x01,
-  0x00, 0x00, 0xf6, 0x46, 0x04, 0x20, 0x0f, 0x84, 0x89, 0x01, 0x00, 0x00,
-  0x8c, 0xc2, 0x89, 0xe8, 0x8b, 0x5e, 0x0c, 0xe8, 0x5c, 0xf9, 0xff, 0xff,
-  0x8b, 0x7e, 0x0c, 0x89, 0x46, 0x1c, 0x85, 0xff, 0x0f, 0x8c, 0x92, 0xfc,
-  0xff, 0xff, 0x39, 0xf8, 0x0f, 0x8e, 0x8a, 0xfc, 0xff, 0xff, 0x89, 0x7e,
-  0x1c, 0x89, 0xf0, 0xe8, 0x3c, 0xfb, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8,
-  0x83, 0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x80, 0xfa, 0x78, 0x75,
-  0x47, 0x8a, 0x7e, 0x04, 0xf6, 0xc7, 0x01, 0x74, 0x33, 0xf6, 0xc7, 0x80,
-  0x0f, 0x84, 0x67, 0x01, 0x00, 0x00, 0x83, 0x7c, 0x24, 0x08, 0x00, 0x75,
-  0x07, 0x83, 0x7c, 0x24, 0x04, 0x00, 0x74, 0x1c, 0x8b, 0x46, 0x14, 0x8d,
-  0x50, 0x01, 0x89, 0x56, 0x14, 0xc6, 0x04, 0x07, 0x30, 0x8b, 0x46, 0x14,
-  0x8d, 0x50, 0x01, 0x89, 0x56, 0x14, 0x8a, 0x56, 0x2c, 0x88, 0x14, 0x07,
-  0xc7, 0x04, 0x24, 0x10, 0x00, 0x00, 0x00, 0xe9, 0xa7, 0xfd, 0xff, 0xff,
-  0x80, 0xfa, 0x75, 0x0f, 0x84, 0x9e, 0xfd, 0xff, 0xff, 0xe9, 0x07, 0xfc,
-  0xff, 0xff, 0x80, 0xfa, 0x69, 0x0f, 0x84, 0x90, 0xfd, 0xff, 0xff, 0x80,
-  0xfa, 0x67, 0x0f, 0x85, 0xf5, 0xfb, 0xff, 0xff, 0x89, 0xf3, 0x89, 0xc2,
-  0x89, 0xf8, 0x45, 0xff, 0x15, 0x4c, 0x10, 0x00, 0x00, 0x89, 0xf0, 0xe8,
-  0xb0, 0xfa, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d,
-  0x07, 0x5f, 0x5e, 0xc3, 0x0f, 0x86, 0x64, 0xfe, 0xff, 0xff, 0x80, 0xfa,
-  0x58, 0x73, 0x0e, 0x80, 0xfa, 0x53, 0x0f, 0x84, 0xea, 0xfe, 0xff, 0xff,
-  0xe9, 0xbc, 0xfb, 0xff, 0xff, 0x0f, 0x86, 0x5a, 0xff, 0xff, 0xff, 0x80,
-  0xfa, 0x63, 0x75, 0x30, 0xc7, 0x46, 0x1c, 0x01, 0x00, 0x00, 0x00, 0xf6,
-  0x46, 0x04, 0x40, 0x0f, 0x85, 0x94, 0x01, 0x00, 0x00, 0x8b, 0x10, 0x83,
-  0xc2, 0x04, 0x89, 0x10, 0x8a, 0x42, 0xfc, 0x88, 0x07, 0x89, 0xf0, 0xe8,
-  0x5c, 0xfa, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d,
-  0x07, 0x5f, 0x5e, 0xc3, 0x80, 0xfa, 0x62, 0x0f, 0x85, 0x78, 0xfb, 0xff,
-  0xff, 0xc7, 0x04, 0x24, 0x02, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xfc, 0xff,
-  0xff, 0x0f, 0x86, 0x71, 0xff, 0xff, 0xff, 0x80, 0xfa, 0x47, 0x0f, 0x84,
-  0x68, 0xff, 0xff, 0xff, 0x80, 0xfa, 0x46, 0x0f, 0x84, 0x88, 0xfd, 0xff,
-  0xff, 0xe9, 0x4f, 0xfb, 0xff, 0xff, 0xf6, 0xc5, 0x02, 0x74, 0x1d, 0x8b,
-  0x08, 0x83, 0xc1, 0x04, 0x89, 0x08, 0x8b, 0x41, 0xfc, 0x85, 0xc0, 0x0f,
-  0x84, 0x8b, 0xfe, 0xff, 0xff, 0x8c, 0xda, 0x89, 0xc5, 0x8e, 0xc2, 0xe9,
-  0x80, 0xfe, 0xff, 0xff, 0x8b, 0x10, 0x83, 0xc2, 0x04, 0x89, 0x10, 0x8b,
-  0x42, 0xfc, 0x85, 0xc0, 0x0f, 0x84, 0x6e, 0xfe, 0xff, 0xff, 0x8c, 0xda,
-  0x89, 0xc5, 0x8e, 0xc2, 0xe9, 0x63, 0xfe, 0xff, 0xff, 0x8c, 0xc2, 0x89,
-  0xe8, 0x8b, 0x5e, 0x0c, 0xe8, 0x03, 0xf8, 0xff, 0xff, 0xe9, 0x72, 0xfe,
-  0xff, 0xff, 0xf6, 0x46, 0x04, 0x40, 0x0f, 0x84, 0x5c, 0xfe, 0xff, 0xff,
-  0x8c, 0xc2, 0x89, 0xe8, 0x8b, 0x5e, 0x0c, 0xe8, 0xe8, 0xf7, 0xff, 0xff,
-  0xe9, 0x57, 0xfe, 0xff, 0xff, 0x85, 0xc9, 0x0f, 0x84, 0xbb, 0xfe, 0xff,
-  0xff, 0x8b, 0x46, 0x14, 0x8d, 0x50, 0x01, 0x89, 0x56, 0x14, 0xc6, 0x04,
-  0x07, 0x30, 0x8b, 0x46, 0x14, 0x8d, 0x50, 0x01, 0x89, 0x56, 0x14, 0x8d,
-  0x14, 0x07, 0x8a, 0x46, 0x2c, 0x88, 0x02, 0xc7, 0x04, 0x24, 0x10, 0x00,
-  0x00, 0x00, 0xe9, 0x44, 0xfc, 0xff, 0xff, 0x8b, 0x0c, 0x24, 0x8b, 0x44,
-  0x24, 0x04, 0x8b, 0x5e, 0x14, 0x8b, 0x54, 0x24, 0x08, 0x01, 0xfb, 0xe8,
-  0x4c, 0x0d, 0x00, 0x00, 0x80, 0x7e, 0x2c, 0x58, 0x75, 0x07, 0x89, 0xf8,
-  0xe8, 0xff, 0x0c, 0x00, 0x00, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xc2,
-  0x89, 0xe8, 0xe8, 0x51, 0xf7, 0xff, 0xff, 0xe9, 0x54, 0xfc, 0xff, 0xff,
-  0x83, 0x7e, 0x0c, 0x00, 0x75, 0x08, 0x85, 0xc9, 0x0f, 0x84, 0x40, 0xfc,
-  0xff, 0xff, 0x8b, 0x1c, 0x24, 0x8b, 0x56, 0x14, 0x89, 0xc8, 0x01, 0xfa,
-  0xe8, 0xaf, 0x0d, 0x00, 0x00, 0x80, 0x7e, 0x2c, 0x58, 0x75, 0x07, 0x89,
-  0xf8, 0xe8, 0xc2, 0x0c, 0x00, 0x00, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x8c,
-  0xc2, 0x89, 0xe8, 0xe8, 0x14, 0xf7, 0xff, 0xff, 0xe9, 0x17, 0xfc, 0xff,
-  0xff, 0x89, 0xc8, 0x29, 0xd0, 0x89, 0x46, 0x18, 0x89, 0xf0, 0xe8, 0x01,
-  0xf9, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d, 0x07,
-  0x5f, 0x5e, 0xc3, 0xc7, 0x46, 0x08, 0x08, 0x00, 0x00, 0x00, 0xe9, 0xc6,
-  0xfc, 0xff, 0xff, 0xbb, 0x08, 0x00, 0x00, 0x00, 0x89, 0xfa, 0x89, 0xc8,
-  0xe9, 0xf9, 0xfc, 0xff, 0xff, 0x8b, 0x08, 0x83, 0xc1, 0x04, 0x89, 0x08,
-  0x31, 0xd2, 0x66, 0x8b, 0x41, 0xfc, 0x66, 0x89, 0xc2, 0x8d, 0x44, 0x24,
-  0x0c, 0xe8, 0xb2, 0x0b, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x0f, 0x84, 0xfd,
-  0xf9, 0xff, 0xff, 0x8a, 0x44, 0x24, 0x0c, 0x88, 0x07, 0x83, 0x3d, 0x78,
-  0x14, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xea, 0xf9, 0xff, 0xff, 0x31, 0xc0,
-  0x8a, 0x44, 0x24, 0x0c, 0x8a, 0x80, 0x7d, 0x14, 0x00, 0x00, 0x24, 0x01,
-  0x25, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x84, 0xd1, 0xf9, 0xff, 0xff, 0x8a,
-  0x44, 0x24, 0x0d, 0x88, 0x47, 0x01, 0xff, 0x46, 0x14, 0x89, 0xf0, 0xe8,
-  0x7c, 0xf8, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83, 0xc4, 0x10, 0x5d,
-  0x07, 0x5f, 0x5e, 0xc3, 0x8b, 0x08, 0x83, 0xc1, 0x04, 0x89, 0x08, 0x66,
-  0x8b, 0x51, 0xfc, 0x81, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x89, 0xf8, 0xe8,
-  0x48, 0x0b, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x74, 0x16, 0x89, 0x46, 0x1c,
-  0x89, 0xf0, 0xe8, 0x49, 0xf8, 0xff, 0xff, 0x8c, 0xc2, 0x89, 0xe8, 0x83,
-  0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0xc7, 0x46, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x89, 0xf0, 0xe8, 0x2f, 0xf8, 0xff, 0xff, 0x8c, 0xc2, 0x89,
-  0xe8, 0x83, 0xc4, 0x10, 0x5d, 0x07, 0x5f, 0x5e, 0xc3, 0x00, 0x00, 0x00,
-  0x51, 0x56, 0x57, 0x55, 0x89, 0xda, 0x31, 0xed, 0x85, 0xc0, 0x74, 0x5f,
-  0x8d, 0x58, 0x0b, 0x39, 0xc3, 0x72, 0x58, 0x89, 0xd7, 0x80, 0xe3, 0xf8,
-  0x8b, 0x42, 0x14, 0x83, 0xfb, 0x10, 0x73, 0x05, 0xbb, 0x10, 0x00, 0x00,
-  0x00, 0x39, 0xc3, 0x77, 0x42, 0x8b, 0x4f, 0x10, 0x8b, 0x47, 0x0c, 0x39,
-  0xcb, 0x76, 0x3f, 0x8d, 0x77, 0x20, 0x8b, 0x10, 0x39, 0xd3, 0x77, 0x3d,
-  0x89, 0x4f, 0x10, 0x29, 0xda, 0xff, 0x47, 0x18, 0x83, 0xfa, 0x10, 0x72,
-  0x42, 0x8d, 0x0c, 0x18, 0x89, 0x4f, 0x0c, 0x89, 0x11, 0x89, 0x18, 0x8b,
-  0x58, 0x04, 0x89, 0x59, 0x04, 0x8b, 0x50, 0x08, 0x89, 0x51, 0x08, 0x89,
-  0x4b, 0x08, 0x89, 0x4a, 0x04, 0x8d, 0x68, 0x04, 0x80, 0x08, 0x01, 0x89,
-  0xe8, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x8b, 0x47, 0x28, 0x31, 0xc9, 0xeb,
-  0xba, 0x39, 0xca, 0x76, 0x02, 0x89, 0xd1, 0x8b, 0x40, 0x08, 0x39, 0xf0,
-  0x75, 0xb0, 0x89, 0x4f, 0x14, 0xeb, 0xe0, 0xff, 0x4f, 0x1c, 0x8b, 0x50,
-  0x04, 0x89, 0x57, 0x0c, 0x8b, 0x48, 0x08, 0x89, 0x4a, 0x08, 0x89, 0x51,
-  0x04, 0x8d, 0x68, 0x04, 0x80, 0x08, 0x01, 0x89, 0xe8, 0x5d, 0x5f, 0x5e,
-  0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x51, 0x56, 0x57, 0x85,
-  0xc0, 0x74, 0x61, 0x8d, 0x48, 0xfc, 0xf6, 0x01, 0x01, 0x74, 0x59, 0x8b,
-  0x11, 0x80, 0xe2, 0xfe, 0x8d, 0x04, 0x11, 0x89, 0xde, 0xf6, 0x00, 0x01,
-  0x74, 0x4e, 0x89, 0x11, 0x8b, 0x43, 0x0c, 0x39, 0xc1, 0x0f, 0x83, 0xc9,
-  0x00, 0x00, 0x00, 0x3b, 0x48, 0x04, 0x76, 0x59, 0x8b, 0x50, 0x04, 0x8b,
-  0x3a, 0x01, 0xd7, 0x8b, 0x19, 0x39, 0xcf, 0x0f, 0x85, 0xda, 0x00, 0x00,
-  0x00, 0x03, 0x1a, 0x89, 0x1a, 0x3b, 0x4e, 0x0c, 0x75, 0x03, 0x89, 0x56,
-  0x0c, 0x89, 0xd1, 0xff, 0x4e, 0x18, 0x3b, 0x4e, 0x0c, 0x73, 0x08, 0x3b,
-  0x5e, 0x10, 0x76, 0x03, 0x89, 0x5e, 0x10, 0x3b, 0x5e, 0x14, 0x0f, 0x87,
-  0xc7, 0x00, 0x00, 0x00, 0x5f, 0x5e, 0x59, 0xc3, 0x03, 0x10, 0x89, 0x11,
-  0x3b, 0x43, 0x0c, 0x75, 0x03, 0x89, 0x4b, 0x0c, 0x8b, 0x50, 0x04, 0x8b,
-  0x40, 0x08, 0x89, 0x42, 0x08, 0x89, 0x50, 0x04, 0xff, 0x4e, 0x1c, 0xeb,
-  0xa7, 0x8b, 0x43, 0x28, 0x39, 0xc1, 0x72, 0xa0, 0x8b, 0x7e, 0x1c, 0x8b,
-  0x46, 0x18, 0x31, 0xd2, 0x8d, 0x5f, 0x01, 0xf7, 0xf3, 0x89, 0xc3, 0x39,
-  0xf8, 0x73, 0x27, 0x8b, 0x46, 0x18, 0x29, 0xf8, 0x01, 0xdb, 0x39, 0xf8,
-  0x76, 0x61, 0x8b, 0x01, 0x01, 0xc8, 0x8b, 0x10, 0xf6, 0xc2, 0x01, 0x0f,
-  0x84, 0x73, 0xff, 0xff, 0xff, 0x83, 0xfa, 0xff, 0x74, 0x08, 0x80, 0xe2,
-  0xfe, 0x01, 0xd0, 0x4b, 0x75, 0xe8, 0x8b, 0x46, 0x0c, 0x39, 0xc1, 0x72,
-  0x45, 0x39, 0xc1, 0x0f, 0x82, 0x57, 0xff, 0xff, 0xff, 0x8b, 0x40, 0x08,
-  0x39, 0xc1, 0x0f, 0x82, 0x4c, 0xff, 0xff, 0xff, 0x8b, 0x40, 0x08, 0x39,
-  0xc1, 0x0f, 0x82, 0x41, 0xff, 0xff, 0xff, 0x8b, 0x40, 0x08, 0xeb, 0xdd,
-  0x8b, 0x40, 0x08, 0x39, 0xc1, 0x0f, 0x82, 0x31, 0xff, 0xff, 0xff, 0x8d,
-  0x43, 0x20, 0x8b, 0x50, 0x04, 0x39, 0xd1, 0x0f, 0x87, 0x23, 0xff, 0xff,
-  0xff, 0xeb, 0x81, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x98, 0x8b, 0x46,
-  0x28, 0xeb, 0xb6, 0xff, 0x46, 0x1c, 0x89, 0x41, 0x08, 0x89, 0x51, 0x04,
-  0x89, 0x4a, 0x08, 0x89, 0x48, 0x04, 0xe9, 0x20, 0xff, 0xff, 0xff, 0x89,
-  0x5e, 0x14, 0x5f, 0x5e, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x57,
-  0x8b, 0x0d, 0xd0, 0x0f, 0x00, 0x00, 0x8b, 0x15, 0xcc, 0x0f, 0x00, 0x00,
-  0x39, 0xd0, 0x74, 0x45, 0x39, 0xc8, 0x75, 0x15, 0x8b, 0x49, 0x04, 0x85,
-  0xc9, 0x75, 0x0e, 0x31, 0xdb, 0x8b, 0x0d, 0xcc, 0x0f, 0x00, 0x00, 0x89,
-  0x1d, 0xd4, 0x0f, 0x00, 0x00, 0x3b, 0x05, 0x58, 0x14, 0x00, 0x00, 0x75,
-  0x08, 0x31, 0xff, 0x89, 0x3d, 0x58, 0x14, 0x00, 0x00, 0x8b, 0x50, 0x04,
-  0x8b, 0x40, 0x08, 0x85, 0xd2, 0x74, 0x03, 0x89, 0x42, 0x08, 0x85, 0xc0,
-  0x75, 0x16, 0x89, 0x0d, 0xd0, 0x0f, 0x00, 0x00, 0x5f, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8b, 0x52, 0x08, 0x89, 0x15, 0xcc, 0x0f, 0x00, 0x00, 0xeb, 0xb0,
-  0x89, 0x50, 0x04, 0x89, 0x0d, 0xd0, 0x0f, 0x00, 0x00, 0x5f, 0x5a, 0x59,
-  0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00,
-  0x00, 0x00, 0x8b, 0xc0, 0x53, 0x51, 0x52, 0x56, 0x57, 0x8b, 0x15, 0xcc,
-  0x0f, 0x00, 0x00, 0x85, 0xd2, 0x74, 0x13, 0x8b, 0x42, 0x24, 0x8b, 0x00,
-  0x83, 0xc0, 0x2c, 0x3b, 0x02, 0x74, 0x0d, 0x8b, 0x52, 0x08, 0x85, 0xd2,
-  0x75, 0xed, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8d, 0x4a, 0xf8, 0x89,
-  0xd0, 0x8b, 0x5a, 0x08, 0xe8, 0x4b, 0xff, 0xff, 0xff, 0x89, 0xda, 0x8b,
-  0x59, 0x04, 0x85, 0xdb, 0x75, 0x18, 0x8b, 0x31, 0x66, 0x8b, 0x39, 0xc1,
-  0xee, 0x10, 0xb4, 0x05, 0xb0, 0x02, 0xcd, 0x31, 0x85, 0xd2, 0x75, 0xbf,
-  0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x89, 0xd8, 0x06, 0x66, 0x8e, 0xc0,
-  0xb4, 0x49, 0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x07, 0x85, 0xd2, 0x75,
-  0xa6, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x90, 0x53, 0x51, 0x56, 0x57,
-  0x55, 0x89, 0xc1, 0x89, 0xd5, 0xa1, 0x54, 0x10, 0x00, 0x00, 0x85, 0xc0,
-  0x75, 0x06, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0xe8, 0x73, 0xff, 0xff,
-  0xff, 0x8b, 0x15, 0xcc, 0x0f, 0x00, 0x00, 0x85, 0xd2, 0x74, 0x14, 0x8d,
-  0x42, 0x2c, 0x39, 0xc8, 0x75, 0x06, 0x83, 0x7a, 0x18, 0x01, 0x74, 0x0f,
-  0x8b, 0x52, 0x08, 0x85, 0xd2, 0x75, 0xec, 0x31, 0xc0, 0x5d, 0x5f, 0x5e,
-  0x59, 0x5b, 0xc3, 0x89, 0xd0, 0xe8, 0xc6, 0xfe, 0xff, 0xff, 0x8d, 0x42,
-  0xf8, 0x83, 0x78, 0x04, 0x00, 0x74, 0x08, 0x31, 0xc0, 0x5d, 0x5f, 0x5e,
-  0x59, 0x5b, 0xc3, 0x89, 0xeb, 0x8b, 0x09, 0x8b, 0x12, 0x83, 0xe9, 0x04,
-  0x83, 0xc2, 0x0c, 0x29, 0xcb, 0x01, 0xda, 0x81, 0xc2, 0xff, 0x0f, 0x00,
-  0x00, 0x30, 0xd2, 0x80, 0xe6, 0xf0, 0x89, 0xd3, 0x89, 0xd1, 0xc1, 0xeb,
-  0x10, 0x66, 0x8b, 0x38, 0x66, 0x8b, 0x70, 0x02, 0xb4, 0x05, 0xb0, 0x03,
-  0xcd, 0x31, 0x19, 0xc0, 0x40, 0x74, 0x10, 0x66, 0x8b, 0xc3, 0xc1, 0xe0,
-  0x10, 0x66, 0x8b, 0xc1, 0x66, 0x89, 0x38, 0x66, 0x89, 0x70, 0x02, 0x85,
-  0xc0, 0x0f, 0x84, 0x6b, 0xff, 0xff, 0xff, 0x8d, 0x48, 0x08, 0x83, 0xea,
-  0x0c, 0x45, 0xc7, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89, 0xc8, 0x89,
-  0x11, 0xe8, 0x52, 0x00, 0x00, 0x00, 0xc7, 0x41, 0x18, 0x01, 0x00, 0x00,
-  0x00, 0x83, 0xe5, 0xfe, 0x8b, 0x10, 0x29, 0xea, 0x89, 0xc3, 0x83, 0xfa,
-  0x10, 0x72, 0x29, 0x89, 0xee, 0x66, 0x83, 0xce, 0x01, 0x89, 0x30, 0x01,
-  0xe8, 0x80, 0xca, 0x01, 0x89, 0x10, 0xc7, 0x41, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x83, 0xc0, 0x04, 0xff, 0x41, 0x18, 0xe8, 0x6c, 0xdc, 0xff, 0xff,
-  0x89, 0xd8, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x80, 0x08, 0x01, 0x89,
-  0xd8, 0x5d, 0x5f, 0x5e, 0x59, 0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x52, 0x00, 0x51, 0x52, 0x89, 0xc2, 0xa1, 0xcc, 0x0f, 0x00,
-  0x00, 0x31, 0xc9, 0x85, 0xc0, 0x74, 0x04, 0x39, 0xc2, 0x73, 0x50, 0x89,
-  0x4a, 0x04, 0x89, 0x42, 0x08, 0x85, 0xc9, 0x74, 0x51, 0x89, 0x51, 0x08,
-  0x85, 0xc0, 0x75, 0x52, 0x8d, 0x4a, 0x20, 0x83, 0xc2, 0x2c, 0xc7, 0x42,
-  0xf4, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x42, 0xe4, 0x00, 0x00, 0x00, 0x00,
-  0xc7, 0x42, 0xec, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x42, 0xf0, 0x00, 0x00,
-  0x00, 0x00, 0x89, 0x4a, 0xf8, 0x8b, 0x42, 0xd4, 0x89, 0x4a, 0xfc, 0x83,
-  0xe8, 0x2c, 0x89, 0x4a, 0xe0, 0x89, 0x02, 0xc7, 0x04, 0x02, 0xff, 0xff,
-  0xff, 0xff, 0x89, 0xd0, 0x5a, 0x59, 0xc3, 0x89, 0xc1, 0x8b, 0x40, 0x08,
-  0x85, 0xc0, 0x75, 0xa3, 0xeb, 0xa5, 0x89, 0x15, 0xcc, 0x0f, 0x00, 0x00,
-  0xeb, 0xaa, 0x89, 0x50, 0x04, 0xeb, 0xa9, 0x8d, 0x40, 0x00, 0x8b, 0xc9,
-  0x51, 0x52, 0xa1, 0xcc, 0x0f, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x38, 0x8b,
-  0x50, 0x24, 0x8b, 0x02, 0x01, 0xd0, 0x8d, 0x48, 0x04, 0xa0, 0x2e, 0x10,
-  0x00, 0x00, 0x3c, 0x02, 0x72, 0x1b, 0x3c, 0x08, 0x77, 0x17, 0x80, 0x3d,
-  0x30, 0x10, 0x00, 0x00, 0x00, 0x75, 0x0e, 0x33, 0xc0, 0x66, 0x8c, 0xd8,
-  0x0f, 0x03, 0xc0, 0x40, 0xa3, 0x00, 0x10, 0x00, 0x00, 0x3b, 0x0d, 0x00,
-  0x10, 0x00, 0x00, 0x75, 0x05, 0x8b, 0x02, 0x5a, 0x59, 0xc3, 0x31, 0xc0,
-  0x5a, 0x59, 0xc3, 0x8d, 0x40, 0x00, 0x8b, 0xc9, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x83, 0xec, 0x04, 0x89, 0x04, 0x24, 0x8b, 0x1c, 0x24, 0x8b, 0x0c,
-  0x24, 0xc1, 0xeb, 0x10, 0xe8, 0x97, 0xfd, 0xff, 0xff, 0xb4, 0x05, 0xb0,
-  0x01, 0xcd, 0x31, 0x19, 0xc0, 0x40, 0x74, 0x10, 0x66, 0x8b, 0xc3, 0xc1,
-  0xe0, 0x10, 0x66, 0x8b, 0xc1, 0x66, 0x89, 0x38, 0x66, 0x89, 0x70, 0x02,
-  0x85, 0xc0, 0x75, 0x1f, 0x66, 0xf7, 0x05, 0x82, 0x15, 0x00, 0x00, 0xf0,
-  0xff, 0x75, 0x2a, 0x81, 0x3c, 0x24, 0x00, 0x00, 0x01, 0x00, 0x76, 0x2d,
-  0x31, 0xc0, 0x83, 0xc4, 0x04, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8b,
-  0x1c, 0x24, 0x8d, 0x50, 0x08, 0x83, 0xeb, 0x08, 0x89, 0x1a, 0xc7, 0x40,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd0, 0xeb, 0xe1, 0xc7, 0x05, 0x80,
-  0x15, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xeb, 0xca, 0x8b, 0x1d, 0x80,
-  0x15, 0x00, 0x00, 0xc1, 0xeb, 0x04, 0x80, 0xcb, 0x01, 0xb4, 0x48, 0xcd,
-  0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x89, 0xc2, 0x85, 0xc0, 0x7c, 0xb9, 0x8b,
-  0x1c, 0x24, 0xc1, 0xeb, 0x04, 0xb4, 0x48, 0xcd, 0x21, 0xd1, 0xd0, 0xd1,
-  0xc8, 0x89, 0xc6, 0x89, 0xc3, 0x89, 0xd0, 0x06, 0x66, 0x8e, 0xc0, 0xb4,
-  0x49, 0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x07, 0x85, 0xf6, 0x7c, 0x94,
-  0xb4, 0x00, 0xb0, 0x06, 0xcd, 0x31, 0x8b, 0xc1, 0xc1, 0xe0, 0x10, 0x66,
-  0x8b, 0xc2, 0x83, 0xc0, 0x08, 0x8b, 0x14, 0x24, 0x89, 0x70, 0xfc, 0x83,
-  0xea, 0x08, 0x89, 0x10, 0x83, 0xc4, 0x04, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x89, 0xc1, 0x8b, 0x00, 0x8d,
-  0x50, 0x0b, 0x80, 0xe2, 0xf8, 0x39, 0xc2, 0x72, 0x39, 0x80, 0x3d, 0x2e,
-  0x10, 0x00, 0x00, 0x01, 0x75, 0x36, 0x80, 0x3d, 0x2f, 0x10, 0x00, 0x00,
-  0x00, 0x75, 0x2d, 0x83, 0xc2, 0x08, 0x89, 0x11, 0x83, 0xc2, 0x3c, 0x3b,
-  0x11, 0x72, 0x1b, 0x8b, 0x1d, 0x58, 0x10, 0x00, 0x00, 0x39, 0xda, 0x73,
-  0x05, 0x89, 0xda, 0x80, 0xe2, 0xfe, 0x89, 0x11, 0x81, 0xc2, 0xff, 0x0f,
-  0x00, 0x00, 0x3b, 0x11, 0x73, 0x20, 0x31, 0xc0, 0x5a, 0x59, 0x5b, 0xc3,
-  0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00, 0x09, 0x74, 0xca, 0xe8, 0x72, 0xfe,
-  0xff, 0xff, 0x39, 0xd0, 0x72, 0x04, 0x31, 0xd2, 0xeb, 0xc0, 0x29, 0xc2,
-  0xeb, 0xbc, 0x30, 0xd2, 0x80, 0xe6, 0xf0, 0x89, 0x11, 0x85, 0xd2, 0x0f,
-  0x95, 0xc0, 0x25, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0x90,
-  0x53, 0x51, 0x52, 0x83, 0xec, 0x04, 0x89, 0x04, 0x24, 0xa1, 0x54, 0x10,
-  0x00, 0x00, 0x85, 0xc0, 0x74, 0x0b, 0x83, 0x3d, 0x00, 0x10, 0x00, 0x00,
-  0xfe, 0x75, 0x09, 0x31, 0xc0, 0x83, 0xc4, 0x04, 0x5a, 0x59, 0x5b, 0xc3,
-  0x89, 0xe0, 0xe8, 0x55, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x74, 0xee, 0x80,
-  0x3d, 0x2e, 0x10, 0x00, 0x00, 0x01, 0x75, 0x33, 0x8b, 0x04, 0x24, 0xe8,
-  0x60, 0xfe, 0xff, 0xff, 0x89, 0xc2, 0x85, 0xc0, 0x74, 0x05, 0x8b, 0x00,
-  0x89, 0x04, 0x24, 0x85, 0xd2, 0x74, 0xcc, 0x8b, 0x04, 0x24, 0x83, 0xe8,
-  0x04, 0x3b, 0x04, 0x24, 0x77, 0xc1, 0x89, 0x04, 0x24, 0x83, 0xf8, 0x38,
-  0x73, 0x21, 0x31, 0xc0, 0x83, 0xc4, 0x04, 0x5a, 0x59, 0x5b, 0xc3, 0x8b,
-  0x1c, 0x24, 0xb8, 0x00, 0x48, 0x00, 0x80, 0xcd, 0x21, 0x19, 0xdb, 0xf7,
-  0xd3, 0x23, 0xc3, 0x83, 0x2c, 0x24, 0x04, 0x89, 0xc2, 0xeb, 0xc8, 0x89,
-  0x02, 0x89, 0xd0, 0xe8, 0x44, 0xfd, 0xff, 0xff, 0x89, 0xc1, 0x8b, 0x00,
-  0x89, 0x04, 0x24, 0x0c, 0x01, 0x89, 0x01, 0xc7, 0x42, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x8d, 0x41, 0x04, 0xff, 0x42, 0x18, 0xe8, 0x77, 0xd9, 0xff,
-  0xff, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5a, 0x59, 0x5b,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x00, 0x8b, 0xdb,
-  0x53, 0x51, 0x52, 0x55, 0x83, 0xec, 0x04, 0x89, 0x04, 0x24, 0x80, 0x3d,
-  0x2e, 0x10, 0x00, 0x00, 0x01, 0x75, 0x09, 0x80, 0x3d, 0x2f, 0x10, 0x00,
-  0x00, 0x00, 0x74, 0x25, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00, 0x09, 0x74,
-  0x1c, 0xa1, 0x54, 0x10, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x0b, 0x83, 0x3d,
-  0x00, 0x10, 0x00, 0x00, 0xfe, 0x75, 0x14, 0x31, 0xc0, 0x83, 0xc4, 0x04,
-  0x5d, 0x5a, 0x59, 0x5b, 0xc3, 0x8b, 0x04, 0x24, 0xe8, 0xf7, 0xfe, 0xff,
-  0xff, 0xeb, 0xee, 0x89, 0xe0, 0xe8, 0x6e, 0xfe, 0xff, 0xff, 0x85, 0xc0,
-  0x74, 0xe3, 0x8a, 0x35, 0x2e, 0x10, 0x00, 0x00, 0x80, 0xfe, 0x02, 0x72,
-  0x1c, 0x80, 0xfe, 0x08, 0x77, 0x17, 0x80, 0x3d, 0x30, 0x10, 0x00, 0x00,
-  0x00, 0x75, 0x0e, 0x33, 0xc0, 0x66, 0x8c, 0xd8, 0x0f, 0x03, 0xc0, 0x40,
-  0xa3, 0x00, 0x10, 0x00, 0x00, 0x8b, 0x14, 0x24, 0x8b, 0x0d, 0x00, 0x10,
-  0x00, 0x00, 0x01, 0xca, 0x39, 0xca, 0x73, 0x05, 0xba, 0xfe, 0xff, 0xff,
-  0xff, 0x89, 0xd0, 0xe8, 0xa8, 0x06, 0x00, 0x00, 0x83, 0xf8, 0xff, 0x74,
-  0x9a, 0x89, 0xc1, 0x83, 0xf8, 0xf8, 0x77, 0x93, 0x39, 0xc2, 0x76, 0x8f,
-  0x29, 0xc2, 0x89, 0x14, 0x24, 0x8d, 0x42, 0xfc, 0x39, 0xd0, 0x77, 0x83,
-  0x8b, 0x15, 0xcc, 0x0f, 0x00, 0x00, 0x89, 0x04, 0x24, 0x85, 0xd2, 0x74,
-  0x06, 0x83, 0x7a, 0x08, 0x00, 0x75, 0x4b, 0x85, 0xd2, 0x74, 0x5f, 0x8b,
-  0x02, 0x8d, 0x59, 0xfc, 0x01, 0xd0, 0x39, 0xc3, 0x75, 0x54, 0x89, 0xc1,
-  0x8b, 0x04, 0x24, 0x83, 0xc0, 0x04, 0x89, 0x04, 0x24, 0x01, 0x02, 0x03,
-  0x1c, 0x24, 0xc7, 0x03, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x04, 0x24, 0x0c,
-  0x01, 0x89, 0x01, 0xc7, 0x42, 0x14, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x41,
-  0x04, 0xff, 0x42, 0x18, 0xe8, 0x5b, 0xd8, 0xff, 0xff, 0xb8, 0x01, 0x00,
-  0x00, 0x00, 0x83, 0xc4, 0x04, 0x5d, 0x5a, 0x59, 0x5b, 0xc3, 0x39, 0xca,
-  0x77, 0x0b, 0x8b, 0x02, 0x01, 0xd0, 0x83, 0xc0, 0x04, 0x39, 0xc8, 0x73,
-  0xa6, 0x8b, 0x52, 0x08, 0x85, 0xd2, 0x75, 0x99, 0xeb, 0x9d, 0x8b, 0x2c,
-  0x24, 0x83, 0xfd, 0x38, 0x0f, 0x82, 0x01, 0xff, 0xff, 0xff, 0x89, 0xca,
-  0x89, 0xc8, 0x89, 0x29, 0xe8, 0xcf, 0xfb, 0xff, 0xff, 0x89, 0xc1, 0x8b,
-  0x00, 0x89, 0x04, 0x24, 0xeb, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x89, 0xd1, 0x8b, 0x10, 0x8d, 0x5a, 0x01, 0x89, 0x18, 0x88,
-  0x0a, 0xff, 0x40, 0x10, 0x59, 0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x90, 0x51, 0x56, 0x89, 0xc6,
-  0xb9, 0x10, 0xbe, 0x00, 0x00, 0xe8, 0x22, 0xe9, 0xff, 0xff, 0xc6, 0x04,
-  0x06, 0x00, 0x5e, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x51, 0x57, 0x83, 0xec, 0x04, 0x89, 0xc1, 0x89,
-  0xe7, 0x88, 0xd8, 0x89, 0xcb, 0xb4, 0x42, 0x8b, 0xca, 0xc1, 0xe9, 0x10,
-  0xcd, 0x21, 0x66, 0x36, 0x89, 0x07, 0x66, 0x36, 0x89, 0x57, 0x02, 0xd1,
-  0xd0, 0xd1, 0xc8, 0x89, 0xc2, 0x85, 0xc0, 0x7c, 0x09, 0x8b, 0x04, 0x24,
-  0x83, 0xc4, 0x04, 0x5f, 0x59, 0xc3, 0x31, 0xc0, 0x66, 0x89, 0xd0, 0xe8,
-  0xb4, 0x06, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5f, 0x59, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x51, 0x56, 0x57, 0x55, 0x83, 0xec, 0x04, 0x89, 0xc6, 0x89, 0xd5, 0x89,
-  0xdf, 0xe8, 0x1e, 0x07, 0x00, 0x00, 0xa8, 0x80, 0x74, 0x22, 0xb0, 0x02,
-  0x89, 0xf3, 0x31, 0xd2, 0xb4, 0x42, 0x8b, 0xca, 0xc1, 0xe9, 0x10, 0xcd,
-  0x21, 0x66, 0xd1, 0xd2, 0x66, 0xd1, 0xca, 0xc1, 0xe2, 0x10, 0x66, 0x8b,
-  0xd0, 0x89, 0x14, 0x24, 0x85, 0xd2, 0x7c, 0x2f, 0x89, 0xf9, 0x89, 0xea,
-  0x89, 0xf3, 0xb4, 0x40, 0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x89, 0x04,
-  0x24, 0x89, 0xc2, 0x85, 0xc0, 0x7c, 0x18, 0x39, 0xf8, 0x74, 0x0a, 0xb8,
-  0x0c, 0x00, 0x00, 0x00, 0xe8, 0x43, 0xe2, 0xff, 0xff, 0x89, 0xd0, 0x83,
-  0xc4, 0x04, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x31, 0xc0, 0x66, 0x8b, 0x04,
-  0x24, 0xe8, 0x2e, 0x06, 0x00, 0x00, 0x83, 0xc4, 0x04, 0x5d, 0x5f, 0x5e,
-  0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfb, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x89, 0xc2, 0x8c, 0xc8, 0x66, 0x89, 0x42, 0x02, 0x8c, 0xd8, 0x66,
-  0x89, 0x42, 0x06, 0x8c, 0xc0, 0x66, 0x89, 0x02, 0x8c, 0xd0, 0x66, 0x89,
-  0x42, 0x04, 0x8c, 0xe0, 0x66, 0x89, 0x42, 0x08, 0x8c, 0xe8, 0x66, 0x89,
-  0x42, 0x0a, 0x5a, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x56, 0x57, 0x55, 0x89, 0xd7, 0x89, 0xdd, 0x89, 0xcb, 0x89, 0xea, 0x89,
-  0xc6, 0xe8, 0xbe, 0x06, 0x00, 0x00, 0x8b, 0x45, 0x00, 0x5d, 0x5f, 0x5e,
-  0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x64, 0x14, 0x00,
-  0x00, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x54, 0x22, 0x00,
-  0xb8, 0x68, 0x14, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x56, 0x57, 0xa0, 0x2e, 0x10,
-  0x00, 0x00, 0xc7, 0x05, 0x58, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-  0x3c, 0x02, 0x72, 0x0a, 0x3c, 0x08, 0x77, 0x06, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0xe8, 0x49, 0x0a, 0x00, 0x00, 0x83, 0xf8, 0x01, 0x75, 0xf0,
-  0xba, 0x33, 0x94, 0x00, 0x00, 0xb8, 0x28, 0x94, 0x00, 0x00, 0x81, 0xea,
-  0x28, 0x94, 0x00, 0x00, 0x66, 0x8b, 0xfa, 0xc1, 0xea, 0x10, 0x66, 0x8b,
-  0xf2, 0x66, 0x8b, 0xd8, 0xc1, 0xe8, 0x10, 0x66, 0x8b, 0xc8, 0x66, 0xb8,
-  0x00, 0x06, 0xcd, 0x31, 0x66, 0x19, 0xc0, 0x5f, 0x5e, 0x5a, 0x59, 0x5b,
-  0xc3, 0x00, 0x00, 0x00, 0xc3, 0x51, 0x52, 0x89, 0xc1, 0xff, 0x15, 0x44,
-  0x10, 0x00, 0x00, 0xba, 0xff, 0x00, 0x00, 0x00, 0xb8, 0x10, 0x00, 0x00,
-  0x00, 0xe8, 0x16, 0xe2, 0xff, 0xff, 0xff, 0x15, 0x44, 0x10, 0x00, 0x00,
-  0xff, 0x15, 0x48, 0x10, 0x00, 0x00, 0x89, 0xc8, 0xe9, 0xb1, 0xd3, 0xff,
-  0xff, 0x52, 0x89, 0xc2, 0xff, 0x15, 0x44, 0x10, 0x00, 0x00, 0xff, 0x15,
-  0x48, 0x10, 0x00, 0x00, 0x89, 0xd0, 0xe9, 0x9b, 0xd3, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x56, 0x89, 0xc1, 0x89, 0xc3, 0xb4, 0x3e, 0xcd, 0x21,
-  0xd1, 0xd0, 0xd1, 0xc8, 0x31, 0xf6, 0x85, 0xc0, 0x7c, 0x10, 0x89, 0xc8,
-  0x31, 0xd2, 0xe8, 0x81, 0x05, 0x00, 0x00, 0x89, 0xf0, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0xb8, 0x04, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff,
-  0xe8, 0xbb, 0xe0, 0xff, 0xff, 0x89, 0xc8, 0x31, 0xd2, 0xe8, 0x62, 0x05,
-  0x00, 0x00, 0x89, 0xf0, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x52, 0x89, 0xc2,
-  0xf6, 0x40, 0x0d, 0x20, 0x74, 0x03, 0x5a, 0x5b, 0xc3, 0x8b, 0x40, 0x10,
-  0xe8, 0xfb, 0x09, 0x00, 0x00, 0x85, 0xc0, 0x74, 0xf1, 0x8a, 0x62, 0x0d,
-  0x80, 0xcc, 0x20, 0x88, 0x62, 0x0d, 0xf6, 0xc4, 0x07, 0x75, 0xe3, 0x88,
-  0xe7, 0x80, 0xcf, 0x02, 0x88, 0x7a, 0x0d, 0x5a, 0x5b, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x85, 0xc0, 0x74, 0x1b, 0xf6, 0xc6, 0xff, 0x74, 0x19, 0x89,
-  0xd3, 0x31, 0xc9, 0x30, 0xd3, 0x66, 0x89, 0xd9, 0x88, 0x50, 0x01, 0xc1,
-  0xf9, 0x08, 0x88, 0x08, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x59, 0x5b, 0xc3,
-  0x88, 0x10, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x59, 0x5b, 0xc3, 0x00, 0x00,
-  0x51, 0x56, 0x57, 0x55, 0x83, 0xec, 0x28, 0x89, 0xd5, 0x89, 0xdf, 0xc6,
-  0x04, 0x24, 0x00, 0x8d, 0x4c, 0x24, 0x01, 0x89, 0xd6, 0x8d, 0x5c, 0x24,
-  0x24, 0x89, 0x7c, 0x24, 0x24, 0x33, 0xd2, 0xf7, 0x33, 0x89, 0x03, 0x8a,
-  0x82, 0xa0, 0x08, 0x00, 0x00, 0x88, 0x01, 0x8b, 0x44, 0x24, 0x24, 0x41,
-  0x85, 0xc0, 0x75, 0xe1, 0x46, 0x8a, 0x41, 0xff, 0x49, 0x88, 0x46, 0xff,
-  0x84, 0xc0, 0x75, 0xf4, 0x89, 0xe8, 0x83, 0xc4, 0x28, 0x5d, 0x5f, 0x5e,
-  0x59, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x51, 0x89, 0xd1, 0x83,
-  0xfb, 0x0a, 0x75, 0x04, 0x85, 0xc0, 0x7c, 0x09, 0xe8, 0x9f, 0xff, 0xff,
-  0xff, 0x89, 0xc8, 0x59, 0xc3, 0xf7, 0xd8, 0xc6, 0x02, 0x2d, 0x42, 0xe8,
-  0x90, 0xff, 0xff, 0xff, 0x89, 0xc8, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x52, 0x89, 0xc1,
-  0x89, 0xc2, 0x8a, 0x02, 0x84, 0xc0, 0x74, 0x0f, 0x2c, 0x61, 0x3c, 0x19,
-  0x76, 0x03, 0x42, 0xeb, 0xf1, 0x04, 0x41, 0x88, 0x02, 0xeb, 0xf7, 0x89,
-  0xc8, 0x5a, 0x59, 0xc3, 0x52, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x7c,
-  0x08, 0x00, 0x00, 0xe8, 0xe0, 0xe2, 0xff, 0xff, 0x5a, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x56, 0x57, 0x55, 0x83, 0xec, 0x4c, 0x89, 0x5c, 0x24, 0x48, 0x89, 0xcd,
-  0xc6, 0x04, 0x24, 0x00, 0x8d, 0x74, 0x24, 0x01, 0x89, 0xdf, 0x8d, 0x5c,
-  0x24, 0x44, 0x89, 0x6c, 0x24, 0x44, 0x33, 0xc9, 0x3b, 0x13, 0x0f, 0x82,
-  0x09, 0x00, 0x00, 0x00, 0x8b, 0xc8, 0x8b, 0xc2, 0x33, 0xd2, 0xf7, 0x33,
-  0x91, 0xf7, 0x33, 0x89, 0x13, 0x8b, 0x5c, 0x24, 0x44, 0x46, 0x8a, 0x9b,
-  0xa0, 0x08, 0x00, 0x00, 0x89, 0xca, 0x88, 0x5e, 0xff, 0x85, 0xc9, 0x75,
-  0xcd, 0x85, 0xc0, 0x75, 0xc9, 0x47, 0x8a, 0x46, 0xff, 0x4e, 0x88, 0x47,
-  0xff, 0x84, 0xc0, 0x75, 0xf4, 0x8b, 0x44, 0x24, 0x48, 0x83, 0xc4, 0x4c,
-  0x5d, 0x5f, 0x5e, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92,
-  0x00, 0x00, 0x00, 0x00, 0x56, 0x89, 0xde, 0x83, 0xf9, 0x0a, 0x75, 0x04,
-  0x85, 0xd2, 0x7c, 0x09, 0xe8, 0x7f, 0xff, 0xff, 0xff, 0x89, 0xf0, 0x5e,
-  0xc3, 0xf7, 0xda, 0xc6, 0x03, 0x2d, 0xf7, 0xd8, 0x83, 0xda, 0x00, 0x43,
-  0xe8, 0x6b, 0xff, 0xff, 0xff, 0x89, 0xf0, 0x5e, 0xc3, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x51, 0x56, 0x57, 0x55, 0x83, 0xec, 0x28, 0x89,
-  0xd5, 0x89, 0xdf, 0xc6, 0x04, 0x24, 0x00, 0x8d, 0x4c, 0x24, 0x01, 0x89,
-  0xd6, 0x8d, 0x5c, 0x24, 0x24, 0x89, 0x7c, 0x24, 0x24, 0x33, 0xd2, 0xf7,
-  0x33, 0x89, 0x13, 0x8b, 0x5c, 0x24, 0x24, 0x41, 0x8a, 0x9b, 0xa0, 0x08,
-  0x00, 0x00, 0x88, 0x59, 0xff, 0x85, 0xc0, 0x75, 0xe0, 0x46, 0x8a, 0x41,
-  0xff, 0x49, 0x88, 0x46, 0xff, 0x84, 0xc0, 0x75, 0xf4, 0x89, 0xe8, 0x83,
-  0xc4, 0x28, 0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x8d, 0x40, 0x00, 0x8b, 0xc9,
-  0x51, 0x89, 0xd1, 0x83, 0xfb, 0x0a, 0x75, 0x04, 0x85, 0xc0, 0x7c, 0x09,
-  0xe8, 0x9f, 0xff, 0xff, 0xff, 0x89, 0xc8, 0x59, 0xc3, 0xf7, 0xd8, 0xc6,
-  0x02, 0x2d, 0x42, 0xe8, 0x90, 0xff, 0xff, 0xff, 0x89, 0xc8, 0x59, 0xc3,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8a, 0x80, 0x7d, 0x14, 0x00, 0x00, 0x24, 0x01, 0x25, 0xff, 0x00, 0x00,
-  0x00, 0xc3, 0x8b, 0xc0, 0x31, 0xc0, 0xe9, 0x03, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x89, 0xc2, 0xa1,
-  0x54, 0x10, 0x00, 0x00, 0x89, 0x15, 0x54, 0x10, 0x00, 0x00, 0x5a, 0xc3,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x89, 0xc3, 0x80, 0x3d, 0x2e, 0x10, 0x00,
-  0x00, 0x01, 0x75, 0x67, 0x80, 0x3d, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x75,
-  0x5e, 0x85, 0xdb, 0x0f, 0x8e, 0x9a, 0x00, 0x00, 0x00, 0x81, 0xc3, 0xff,
-  0x0f, 0x00, 0x00, 0x66, 0x81, 0xe3, 0x00, 0xf0, 0x80, 0x3d, 0x2e, 0x10,
-  0x00, 0x00, 0x01, 0x0f, 0x85, 0x73, 0x00, 0x00, 0x00, 0x89, 0xd8, 0xc1,
-  0xf8, 0x10, 0x89, 0xd9, 0x89, 0xc3, 0xb4, 0x05, 0xb0, 0x01, 0xcd, 0x31,
-  0x19, 0xc0, 0x40, 0x74, 0x10, 0x66, 0x8b, 0xc3, 0xc1, 0xe0, 0x10, 0x66,
-  0x8b, 0xc1, 0x66, 0x89, 0x38, 0x66, 0x89, 0x70, 0x02, 0x85, 0xc0, 0x75,
-  0x10, 0xe8, 0xfa, 0xfb, 0xff, 0xff, 0xc7, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0xb8, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8a,
-  0x15, 0x2e, 0x10, 0x00, 0x00, 0x80, 0xfa, 0x09, 0x74, 0x97, 0x80, 0xfa,
-  0x02, 0x72, 0x13, 0x80, 0xfa, 0x08, 0x77, 0x0e, 0x33, 0xc0, 0x66, 0x8c,
-  0xd8, 0x0f, 0x03, 0xc0, 0x40, 0xa3, 0x00, 0x10, 0x00, 0x00, 0xa1, 0x00,
-  0x10, 0x00, 0x00, 0x01, 0xd8, 0xe8, 0x3a, 0x00, 0x00, 0x00, 0x5f, 0x5e,
-  0x5a, 0x59, 0x5b, 0xc3, 0xb8, 0x00, 0x48, 0x00, 0x80, 0xcd, 0x21, 0x19,
-  0xdb, 0xf7, 0xd3, 0x23, 0xc3, 0xeb, 0xa2, 0xe8, 0xa0, 0xfb, 0xff, 0xff,
-  0xc7, 0x00, 0x09, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x5f,
-  0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d,
-  0x92, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x40, 0x00, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0x83, 0xec, 0x04, 0x89, 0x04, 0x24, 0x3b, 0x05, 0x14, 0x10,
-  0x00, 0x00, 0x72, 0x67, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x0f,
-  0x85, 0x99, 0x00, 0x00, 0x00, 0x8d, 0x68, 0x0f, 0xc1, 0xed, 0x04, 0x85,
-  0xed, 0x75, 0x05, 0xbd, 0xff, 0xff, 0xff, 0x0f, 0x31, 0xdb, 0x66, 0x8c,
-  0xd8, 0x66, 0x89, 0xc3, 0xb4, 0xed, 0xcd, 0x21, 0xc1, 0xe0, 0x1f, 0x81,
-  0xe7, 0xff, 0xff, 0x00, 0x00, 0x0b, 0xf8, 0x89, 0xf8, 0x85, 0xff, 0x7c,
-  0x40, 0x89, 0xeb, 0x66, 0x8c, 0xd8, 0x06, 0x66, 0x8e, 0xc0, 0xb4, 0x4a,
-  0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x07, 0x85, 0xc0, 0x7c, 0x3d, 0x8b,
-  0x1c, 0x24, 0xa1, 0x00, 0x10, 0x00, 0x00, 0x89, 0x1d, 0x00, 0x10, 0x00,
-  0x00, 0x83, 0xc4, 0x04, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0xe8,
-  0x00, 0xfb, 0xff, 0xff, 0xc7, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb8, 0xff,
-  0xff, 0xff, 0xff, 0xeb, 0xe4, 0x89, 0xeb, 0x06, 0x66, 0x8e, 0xc0, 0xb4,
-  0x4a, 0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x07, 0x85, 0xc0, 0x7d, 0xad,
-  0xe8, 0xdb, 0xfa, 0xff, 0xff, 0xc7, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb8,
-  0xff, 0xff, 0xff, 0xff, 0x83, 0xc4, 0x04, 0x5d, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0x8d, 0x98, 0xff, 0x0f, 0x00, 0x00, 0xc1, 0xeb, 0x0c, 0x85,
-  0xdb, 0x75, 0x05, 0xbb, 0xff, 0xff, 0x0f, 0x00, 0x8a, 0x25, 0x2e, 0x10,
-  0x00, 0x00, 0x80, 0xfc, 0x01, 0x75, 0x0b, 0x3a, 0x25, 0x2f, 0x10, 0x00,
-  0x00, 0x75, 0x03, 0xc1, 0xe3, 0x08, 0x66, 0x8c, 0xd8, 0x06, 0x66, 0x8e,
-  0xc0, 0xb4, 0x4a, 0xcd, 0x21, 0xd1, 0xd0, 0xd1, 0xc8, 0x07, 0x85, 0xc0,
-  0x0f, 0x8d, 0x69, 0xff, 0xff, 0xff, 0xe8, 0x81, 0xfa, 0xff, 0xff, 0xc7,
-  0x00, 0x05, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc4,
-  0x04, 0x5d, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xd2, 0x75, 0x1c,
-  0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x52, 0x00, 0x8b, 0xdb,
-  0x85, 0xd2, 0x75, 0x0c, 0x31, 0xc0, 0xc3, 0x8d, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x8d, 0x52, 0x00, 0x51, 0x52, 0x89, 0xc1, 0x88, 0xc2, 0x31, 0xc0,
-  0x88, 0xc8, 0xe8, 0x26, 0xdc, 0xff, 0xff, 0x81, 0xf9, 0x00, 0x01, 0x00,
-  0x00, 0x73, 0x45, 0x80, 0x3d, 0x37, 0x10, 0x00, 0x00, 0x03, 0x72, 0x33,
-  0x80, 0xf9, 0x50, 0x75, 0x1c, 0xb2, 0x0e, 0x31, 0xc0, 0x88, 0xd0, 0x8b,
-  0x80, 0x59, 0x10, 0x00, 0x00, 0xc1, 0xf8, 0x18, 0xe8, 0xc7, 0xdb, 0xff,
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x59, 0xc3, 0x80, 0xf9, 0x22,
-  0x72, 0x04, 0xb2, 0x13, 0xeb, 0xdd, 0x80, 0xf9, 0x20, 0x72, 0x04, 0xb2,
-  0x05, 0xeb, 0xd4, 0x80, 0xfa, 0x13, 0x76, 0xcf, 0xb2, 0x13, 0xeb, 0xcb,
-  0x89, 0xc8, 0xc1, 0xe8, 0x08, 0x25, 0xff, 0x00, 0x00, 0x00, 0xe8, 0x95,
-  0xdb, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x59, 0xc3, 0x8d,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x92, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x52, 0x89, 0xc2, 0xe8, 0x78, 0xff, 0xff, 0xff, 0x89, 0xd0, 0x5a, 0xc3,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x3b, 0x05, 0x70, 0x10, 0x00, 0x00, 0x72,
-  0x04, 0x31, 0xc0, 0x5a, 0xc3, 0x89, 0xc2, 0xa1, 0xc4, 0x10, 0x00, 0x00,
-  0xc1, 0xe2, 0x02, 0x8b, 0x04, 0x02, 0x5a, 0xc3, 0x8d, 0x44, 0x20, 0x00,
-  0x51, 0x3b, 0x05, 0x70, 0x10, 0x00, 0x00, 0x72, 0x02, 0x59, 0xc3, 0x89,
-  0xc1, 0xa1, 0xc4, 0x10, 0x00, 0x00, 0xc1, 0xe1, 0x02, 0x89, 0x14, 0x01,
-  0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x89, 0xc3, 0xb4,
-  0x3e, 0xcd, 0x21, 0xe8, 0x50, 0x08, 0x00, 0x00, 0x5b, 0xc3, 0x8b, 0xc0,
-  0x53, 0x89, 0xc3, 0xb4, 0x68, 0xf8, 0xcd, 0x21, 0xe8, 0x3f, 0x08, 0x00,
-  0x00, 0x90, 0x5b, 0xc3, 0x55, 0x06, 0x53, 0x1e, 0x52, 0xe8, 0x2d, 0x00,
-  0x00, 0x00, 0x1e, 0x57, 0x8b, 0xec, 0x8b, 0x7d, 0x08, 0x8e, 0x5d, 0x0c,
-  0x89, 0x07, 0x89, 0x5f, 0x04, 0x89, 0x4f, 0x08, 0x89, 0x57, 0x0c, 0x89,
-  0x77, 0x10, 0x8f, 0x47, 0x14, 0x19, 0xc0, 0x89, 0x47, 0x18, 0x58, 0x5b,
-  0x5b, 0x5b, 0x66, 0x89, 0x43, 0x06, 0x8c, 0x03, 0x07, 0x5d, 0xc3, 0x8d,
-  0x34, 0x76, 0x8d, 0x86, 0x09, 0xc7, 0x00, 0x00, 0x50, 0x8e, 0x03, 0x66,
-  0x8b, 0x6b, 0x06, 0x8b, 0x07, 0x8b, 0x5f, 0x04, 0x8b, 0x4f, 0x08, 0x8b,
-  0x57, 0x0c, 0x8b, 0x77, 0x10, 0x8b, 0x7f, 0x14, 0x66, 0x8e, 0xdd, 0xc3,
-  0x60, 0x0f, 0xa8, 0x0f, 0xa0, 0x06, 0x1e, 0x52, 0xe8, 0x3d, 0x00, 0x00,
-  0x00, 0x53, 0x1e, 0x55, 0x8b, 0xec, 0x8b, 0x5d, 0x0c, 0x8e, 0x5d, 0x10,
-  0x89, 0x03, 0x9c, 0x58, 0x66, 0x89, 0x43, 0x24, 0x89, 0x4b, 0x08, 0x89,
-  0x53, 0x0c, 0x89, 0x73, 0x14, 0x89, 0x7b, 0x18, 0x8f, 0x43, 0x10, 0x58,
-  0x66, 0x89, 0x43, 0x1c, 0x8f, 0x43, 0x04, 0x8c, 0x43, 0x1e, 0x8c, 0x63,
-  0x20, 0x8c, 0x6b, 0x22, 0x83, 0xc4, 0x08, 0x07, 0x0f, 0xa1, 0x0f, 0xa9,
-  0x61, 0xc3, 0x25, 0xff, 0x00, 0x00, 0x00, 0x8d, 0x04, 0x40, 0x8d, 0x80,
-  0x09, 0xc7, 0x00, 0x00, 0x50, 0x8b, 0xda, 0xff, 0x73, 0x1c, 0x8b, 0x03,
-  0x8b, 0x4b, 0x08, 0x8b, 0x53, 0x0c, 0x8b, 0x73, 0x14, 0x8b, 0x7b, 0x18,
-  0x8b, 0x6b, 0x10, 0x8e, 0x43, 0x1e, 0x8e, 0x63, 0x20, 0x8e, 0x6b, 0x22,
-  0x8b, 0x5b, 0x04, 0x1f, 0xc3, 0xcd, 0x00, 0xc3, 0xcd, 0x01, 0xc3, 0xcd,
-  0x02, 0xc3, 0xcc, 0x90, 0xc3, 0xcd, 0x04, 0xc3, 0xcd, 0x05, 0xc3, 0xcd,
-  0x06, 0xc3, 0xcd, 0x07, 0xc3, 0xcd, 0x08, 0xc3, 0xcd, 0x09, 0xc3, 0xcd,
-  0x0a, 0xc3, 0xcd, 0x0b, 0xc3, 0xcd, 0x0c, 0xc3, 0xcd, 0x0d, 0xc3, 0xcd,
-  0x0e, 0xc3, 0xcd, 0x0f, 0xc3, 0xcd, 0x10, 0xc3, 0xcd, 0x11, 0xc3, 0xcd,
-  0x12, 0xc3, 0xcd, 0x13, 0xc3, 0xcd, 0x14, 0xc3, 0xcd, 0x15, 0xc3, 0xcd,
-  0x16, 0xc3, 0xcd, 0x17, 0xc3, 0xcd, 0x18, 0xc3, 0xcd, 0x19, 0xc3, 0xcd,
-  0x1a, 0xc3, 0xcd, 0x1b, 0xc3, 0xcd, 0x1c, 0xc3, 0xcd, 0x1d, 0xc3, 0xcd,
-  0x1e, 0xc3, 0xcd, 0x1f, 0xc3, 0xcd, 0x20, 0xc3, 0xcd, 0x21, 0xc3, 0xcd,
-  0x22, 0xc3, 0xcd, 0x23, 0xc3, 0xcd, 0x24, 0xc3, 0xcd, 0x25, 0xc3, 0xcd,
-  0x26, 0xc3, 0xcd, 0x27, 0xc3, 0xcd, 0x28, 0xc3, 0xcd, 0x29, 0xc3, 0xcd,
-  0x2a, 0xc3, 0xcd, 0x2b, 0xc3, 0xcd, 0x2c, 0xc3, 0xcd, 0x2d, 0xc3, 0xcd,
-  0x2e, 0xc3, 0xcd, 0x2f, 0xc3, 0xcd, 0x30, 0xc3, 0xcd, 0x31, 0xc3, 0xcd,
-  0x32, 0xc3, 0xcd, 0x33, 0xc3, 0xcd, 0x34, 0xc3, 0xcd, 0x35, 0xc3, 0xcd,
-  0x36, 0xc3, 0xcd, 0x37, 0xc3, 0xcd, 0x38, 0xc3, 0xcd, 0x39, 0xc3, 0xcd,
-  0x3a, 0xc3, 0xcd, 0x3b, 0xc3, 0xcd, 0x3c, 0xc3, 0xcd, 0x3d, 0xc3, 0xcd,
-  0x3e, 0xc3, 0xcd, 0x3f, 0xc3, 0xcd, 0x40, 0xc3, 0xcd, 0x41, 0xc3, 0xcd,
-  0x42, 0xc3, 0xcd, 0x43, 0xc3, 0xcd, 0x44, 0xc3, 0xcd, 0x45, 0xc3, 0xcd,
-  0x46, 0xc3, 0xcd, 0x47, 0xc3, 0xcd, 0x48, 0xc3, 0xcd, 0x49, 0xc3, 0xcd,
-  0x4a, 0xc3, 0xcd, 0x4b, 0xc3, 0xcd, 0x4c, 0xc3, 0xcd, 0x4d, 0xc3, 0xcd,
-  0x4e, 0xc3, 0xcd, 0x4f, 0xc3, 0xcd, 0x50, 0xc3, 0xcd, 0x51, 0xc3, 0xcd,
-  0x52, 0xc3, 0xcd, 0x53, 0xc3, 0xcd, 0x54, 0xc3, 0xcd, 0x55, 0xc3, 0xcd,
-  0x56, 0xc3, 0xcd, 0x57, 0xc3, 0xcd, 0x58, 0xc3, 0xcd, 0x59, 0xc3, 0xcd,
-  0x5a, 0xc3, 0xcd, 0x5b, 0xc3, 0xcd, 0x5c, 0xc3, 0xcd, 0x5d, 0xc3, 0xcd,
-  0x5e, 0xc3, 0xcd, 0x5f, 0xc3, 0xcd, 0x60, 0xc3, 0xcd, 0x61, 0xc3, 0xcd,
-  0x62, 0xc3, 0xcd, 0x63, 0xc3, 0xcd, 0x64, 0xc3, 0xcd, 0x65, 0xc3, 0xcd,
-  0x66, 0xc3, 0xcd, 0x67, 0xc3, 0xcd, 0x68, 0xc3, 0xcd, 0x69, 0xc3, 0xcd,
-  0x6a, 0xc3, 0xcd, 0x6b, 0xc3, 0xcd, 0x6c, 0xc3, 0xcd, 0x6d, 0xc3, 0xcd,
-  0x6e, 0xc3, 0xcd, 0x6f, 0xc3, 0xcd, 0x70, 0xc3, 0xcd, 0x71, 0xc3, 0xcd,
-  0x72, 0xc3, 0xcd, 0x73, 0xc3, 0xcd, 0x74, 0xc3, 0xcd, 0x75, 0xc3, 0xcd,
-  0x76, 0xc3, 0xcd, 0x77, 0xc3, 0xcd, 0x78, 0xc3, 0xcd, 0x79, 0xc3, 0xcd,
-  0x7a, 0xc3, 0xcd, 0x7b, 0xc3, 0xcd, 0x7c, 0xc3, 0xcd, 0x7d, 0xc3, 0xcd,
-  0x7e, 0xc3, 0xcd, 0x7f, 0xc3, 0xcd, 0x80, 0xc3, 0xcd, 0x81, 0xc3, 0xcd,
-  0x82, 0xc3, 0xcd, 0x83, 0xc3, 0xcd, 0x84, 0xc3, 0xcd, 0x85, 0xc3, 0xcd,
-  0x86, 0xc3, 0xcd, 0x87, 0xc3, 0xcd, 0x88, 0xc3, 0xcd, 0x89, 0xc3, 0xcd,
-  0x8a, 0xc3, 0xcd, 0x8b, 0xc3, 0xcd, 0x8c, 0xc3, 0xcd, 0x8d, 0xc3, 0xcd,
-  0x8e, 0xc3, 0xcd, 0x8f, 0xc3, 0xcd, 0x90, 0xc3, 0xcd, 0x91, 0xc3, 0xcd,
-  0x92, 0xc3, 0xcd, 0x93, 0xc3, 0xcd, 0x94, 0xc3, 0xcd, 0x95, 0xc3, 0xcd,
-  0x96, 0xc3, 0xcd, 0x97, 0xc3, 0xcd, 0x98, 0xc3, 0xcd, 0x99, 0xc3, 0xcd,
-  0x9a, 0xc3, 0xcd, 0x9b, 0xc3, 0xcd, 0x9c, 0xc3, 0xcd, 0x9d, 0xc3, 0xcd,
-  0x9e, 0xc3, 0xcd, 0x9f, 0xc3, 0xcd, 0xa0, 0xc3, 0xcd, 0xa1, 0xc3, 0xcd,
-  0xa2, 0xc3, 0xcd, 0xa3, 0xc3, 0xcd, 0xa4, 0xc3, 0xcd, 0xa5, 0xc3, 0xcd,
-  0xa6, 0xc3, 0xcd, 0xa7, 0xc3, 0xcd, 0xa8, 0xc3, 0xcd, 0xa9, 0xc3, 0xcd,
-  0xaa, 0xc3, 0xcd, 0xab, 0xc3, 0xcd, 0xac, 0xc3, 0xcd, 0xad, 0xc3, 0xcd,
-  0xae, 0xc3, 0xcd, 0xaf, 0xc3, 0xcd, 0xb0, 0xc3, 0xcd, 0xb1, 0xc3, 0xcd,
-  0xb2, 0xc3, 0xcd, 0xb3, 0xc3, 0xcd, 0xb4, 0xc3, 0xcd, 0xb5, 0xc3, 0xcd,
-  0xb6, 0xc3, 0xcd, 0xb7, 0xc3, 0xcd, 0xb8, 0xc3, 0xcd, 0xb9, 0xc3, 0xcd,
-  0xba, 0xc3, 0xcd, 0xbb, 0xc3, 0xcd, 0xbc, 0xc3, 0xcd, 0xbd, 0xc3, 0xcd,
-  0xbe, 0xc3, 0xcd, 0xbf, 0xc3, 0xcd, 0xc0, 0xc3, 0xcd, 0xc1, 0xc3, 0xcd,
-  0xc2, 0xc3, 0xcd, 0xc3, 0xc3, 0xcd, 0xc4, 0xc3, 0xcd, 0xc5, 0xc3, 0xcd,
-  0xc6, 0xc3, 0xcd, 0xc7, 0xc3, 0xcd, 0xc8, 0xc3, 0xcd, 0xc9, 0xc3, 0xcd,
-  0xca, 0xc3, 0xcd, 0xcb, 0xc3, 0xcd, 0xcc, 0xc3, 0xcd, 0xcd, 0xc3, 0xcd,
-  0xce, 0xc3, 0xcd, 0xcf, 0xc3, 0xcd, 0xd0, 0xc3, 0xcd, 0xd1, 0xc3, 0xcd,
-  0xd2, 0xc3, 0xcd, 0xd3, 0xc3, 0xcd, 0xd4, 0xc3, 0xcd, 0xd5, 0xc3, 0xcd,
-  0xd6, 0xc3, 0xcd, 0xd7, 0xc3, 0xcd, 0xd8, 0xc3, 0xcd, 0xd9, 0xc3, 0xcd,
-  0xda, 0xc3, 0xcd, 0xdb, 0xc3, 0xcd, 0xdc, 0xc3, 0xcd, 0xdd, 0xc3, 0xcd,
-  0xde, 0xc3, 0xcd, 0xdf, 0xc3, 0xcd, 0xe0, 0xc3, 0xcd, 0xe1, 0xc3, 0xcd,
-  0xe2, 0xc3, 0xcd, 0xe3, 0xc3, 0xcd, 0xe4, 0xc3, 0xcd, 0xe5, 0xc3, 0xcd,
-  0xe6, 0xc3, 0xcd, 0xe7, 0xc3, 0xcd, 0xe8, 0xc3, 0xcd, 0xe9, 0xc3, 0xcd,
-  0xea, 0xc3, 0xcd, 0xeb, 0xc3, 0xcd, 0xec, 0xc3, 0xcd, 0xed, 0xc3, 0xcd,
-  0xee, 0xc3, 0xcd, 0xef, 0xc3, 0xcd, 0xf0, 0xc3, 0xcd, 0xf1, 0xc3, 0xcd,
-  0xf2, 0xc3, 0xcd, 0xf3, 0xc3, 0xcd, 0xf4, 0xc3, 0xcd, 0xf5, 0xc3, 0xcd,
-  0xf6, 0xc3, 0xcd, 0xf7, 0xc3, 0xcd, 0xf8, 0xc3, 0xcd, 0xf9, 0xc3, 0xcd,
-  0xfa, 0xc3, 0xcd, 0xfb, 0xc3, 0xcd, 0xfc, 0xc3, 0xcd, 0xfd, 0xc3, 0xcd,
-  0xfe, 0xc3, 0xcd, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x56, 0x57, 0x83, 0xec, 0x08, 0x8b, 0x3d, 0xc8, 0x10,
-  0x00, 0x00, 0x85, 0xff, 0x75, 0x53, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00,
-  0x01, 0x75, 0x5b, 0x30, 0xe4, 0x89, 0xe6, 0x88, 0x24, 0x24, 0x88, 0x64,
-  0x24, 0x01, 0x30, 0xc0, 0x8c, 0xda, 0x66, 0x89, 0x44, 0x24, 0x02, 0x88,
-  0x64, 0x24, 0x04, 0x1e, 0x66, 0x8e, 0xda, 0x66, 0xb8, 0x00, 0x04, 0xcd,
-  0x31, 0x88, 0x26, 0x88, 0x46, 0x01, 0x66, 0x89, 0x5e, 0x02, 0x88, 0x4e,
-  0x04, 0x88, 0x76, 0x05, 0x88, 0x56, 0x06, 0x1f, 0x31, 0xc0, 0x0f, 0xb6,
-  0x74, 0x24, 0x01, 0x8a, 0x04, 0x24, 0x01, 0xf0, 0x85, 0xc0, 0x7e, 0x21,
-  0xbf, 0x01, 0x00, 0x00, 0x00, 0x89, 0xf8, 0x89, 0x3d, 0xc8, 0x10, 0x00,
-  0x00, 0x83, 0xc4, 0x08, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x66, 0xb8,
-  0x86, 0x16, 0xcd, 0x2f, 0x66, 0x85, 0xc0, 0x74, 0x9a, 0xbf, 0xff, 0xff,
-  0xff, 0xff, 0x89, 0xf8, 0x89, 0x3d, 0xc8, 0x10, 0x00, 0x00, 0x83, 0xc4,
-  0x08, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x89, 0xc3, 0x66, 0xb8, 0x00,
-  0x44, 0xcd, 0x21, 0xd1, 0xd2, 0xd1, 0xca, 0xf6, 0xc2, 0x80, 0x0f, 0x95,
-  0xc0, 0x25, 0xff, 0x00, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00,
-  0x53, 0x29, 0xc2, 0x8d, 0x5a, 0x01, 0x05, 0x7c, 0x14, 0x00, 0x00, 0xba,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0xe8, 0xba, 0x4a, 0xff, 0xff, 0x5b, 0xc3,
-  0x53, 0x52, 0xbb, 0x01, 0x01, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xd2, 0xa3,
-  0x78, 0x14, 0x00, 0x00, 0xa3, 0xcc, 0x10, 0x00, 0x00, 0xb8, 0x7c, 0x14,
-  0x00, 0x00, 0xe8, 0x99, 0x4a, 0xff, 0xff, 0x5a, 0x5b, 0xc3, 0x53, 0x51,
-  0x52, 0x06, 0x0f, 0xa0, 0x83, 0xf8, 0xff, 0x74, 0x60, 0x83, 0xf8, 0xfe,
-  0x74, 0x5b, 0x83, 0xf8, 0xfd, 0x75, 0x0a, 0xe8, 0xc4, 0xff, 0xff, 0xff,
-  0xe9, 0xa9, 0x00, 0x00, 0x00, 0x83, 0xf8, 0xfc, 0x75, 0x3c, 0xe8, 0xb5,
-  0xff, 0xff, 0xff, 0xba, 0x9f, 0x00, 0x00, 0x00, 0xb8, 0x81, 0x00, 0x00,
-  0x00, 0xe8, 0x8e, 0xff, 0xff, 0xff, 0xba, 0xfc, 0x00, 0x00, 0x00, 0xb8,
-  0xe0, 0x00, 0x00, 0x00, 0xe8, 0x7f, 0xff, 0xff, 0xff, 0xc7, 0x05, 0x78,
-  0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x05, 0xcc, 0x10, 0x00,
-  0x00, 0xa4, 0x03, 0x00, 0x00, 0xe9, 0x68, 0x00, 0x00, 0x00, 0x85, 0xc0,
-  0x74, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x5f, 0xe8, 0x61, 0x00,
-  0x00, 0x00, 0x89, 0xd3, 0x89, 0xc1, 0x8e, 0xc2, 0x89, 0xc2, 0x85, 0xc0,
-  0x75, 0x05, 0x66, 0x85, 0xdb, 0x74, 0x47, 0xe8, 0x58, 0xff, 0xff, 0xff,
-  0x8e, 0xe3, 0x66, 0x64, 0x83, 0x39, 0x00, 0x74, 0x0a, 0xc7, 0x05, 0x78,
-  0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x89, 0xd1, 0x66, 0x26, 0x83,
-  0x39, 0x00, 0x74, 0x19, 0x26, 0x0f, 0xb7, 0x11, 0x26, 0x8a, 0x01, 0xc1,
-  0xfa, 0x08, 0x0f, 0xb6, 0xc0, 0x0f, 0xb6, 0xd2, 0x41, 0x41, 0xe8, 0x0d,
-  0xff, 0xff, 0xff, 0xeb, 0xe0, 0xe8, 0x05, 0x01, 0x00, 0x00, 0x0f, 0xb7,
-  0xc0, 0xa3, 0xcc, 0x10, 0x00, 0x00, 0x31, 0xc0, 0x0f, 0xa1, 0x07, 0x5a,
-  0x59, 0x5b, 0xc3, 0x53, 0x51, 0x57, 0xc8, 0x70, 0x00, 0x00, 0xa0, 0x2e,
-  0x10, 0x00, 0x00, 0x3c, 0x02, 0x0f, 0x82, 0x84, 0x00, 0x00, 0x00, 0x3c,
-  0x08, 0x0f, 0x87, 0x7c, 0x00, 0x00, 0x00, 0xbb, 0x12, 0x00, 0x00, 0x00,
-  0x8d, 0x45, 0xe0, 0x31, 0xd2, 0xe8, 0x9a, 0x49, 0xff, 0xff, 0xbb, 0x1c,
-  0x00, 0x00, 0x00, 0x8d, 0x45, 0xc4, 0x31, 0xd2, 0xe8, 0x8b, 0x49, 0xff,
-  0xff, 0xbb, 0x0c, 0x00, 0x00, 0x00, 0x8d, 0x45, 0xf4, 0x31, 0xd2, 0xe8,
-  0x7c, 0x49, 0xff, 0xff, 0xc7, 0x45, 0xea, 0x00, 0x63, 0x00, 0x00, 0x66,
-  0xc7, 0x45, 0xe0, 0x21, 0x00, 0xc7, 0x45, 0xc4, 0x11, 0x25, 0x00, 0x00,
-  0x8d, 0x45, 0xe0, 0x8d, 0x5d, 0xf4, 0x8c, 0xda, 0x89, 0x45, 0xd0, 0x8d,
-  0x45, 0xc4, 0x66, 0x89, 0x55, 0xfa, 0x8d, 0x55, 0xc4, 0xe8, 0x2e, 0x02,
-  0x00, 0x00, 0x8b, 0x45, 0xe2, 0x66, 0x3d, 0xff, 0xff, 0x74, 0x6b, 0x0f,
-  0xb7, 0xc0, 0x0f, 0xb7, 0x55, 0xd4, 0xc1, 0xe0, 0x04, 0x01, 0xd0, 0x66,
-  0x8b, 0x15, 0x84, 0x15, 0x00, 0x00, 0xc9, 0x5f, 0x59, 0x5b, 0xc3, 0x80,
-  0x3d, 0x2e, 0x10, 0x00, 0x00, 0x01, 0x75, 0x4a, 0xbb, 0x34, 0x00, 0x00,
-  0x00, 0x8d, 0x45, 0x90, 0x31, 0xd2, 0x8d, 0x7d, 0x90, 0xe8, 0x12, 0x49,
-  0xff, 0xff, 0x31, 0xc9, 0x30, 0xff, 0x8c, 0xda, 0xb3, 0x21, 0xc7, 0x45,
-  0xac, 0x00, 0x63, 0x00, 0x00, 0x06, 0x66, 0x8e, 0xc2, 0x66, 0xb8, 0x00,
-  0x03, 0xcd, 0x31, 0x07, 0x19, 0xc0, 0xf6, 0x45, 0xb0, 0x01, 0x75, 0x16,
-  0x0f, 0xb7, 0x45, 0xb4, 0xc1, 0xe0, 0x04, 0x66, 0x8b, 0x15, 0x84, 0x15,
-  0x00, 0x00, 0x03, 0x45, 0x94, 0xc9, 0x5f, 0x59, 0x5b, 0xc3, 0x31, 0xd2,
-  0x31, 0xc0, 0xc9, 0x5f, 0x59, 0x5b, 0xc3, 0x53, 0x51, 0x52, 0x56, 0x57,
-  0x06, 0xc8, 0x78, 0x00, 0x00, 0xa0, 0x2e, 0x10, 0x00, 0x00, 0x31, 0xf6,
-  0x3c, 0x02, 0x0f, 0x82, 0xd5, 0x00, 0x00, 0x00, 0x3c, 0x08, 0x0f, 0x87,
-  0xcd, 0x00, 0x00, 0x00, 0xbb, 0x1c, 0x00, 0x00, 0x00, 0x8d, 0x45, 0xbc,
-  0x31, 0xd2, 0xe8, 0xa1, 0x48, 0xff, 0xff, 0xbb, 0x0c, 0x00, 0x00, 0x00,
-  0x8d, 0x45, 0xec, 0x31, 0xd2, 0xe8, 0x92, 0x48, 0xff, 0xff, 0xc7, 0x45,
-  0xc0, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x5d, 0xec, 0x8d, 0x55, 0xbc, 0x8d,
-  0x45, 0xbc, 0xc7, 0x45, 0xbc, 0xc0, 0x25, 0x00, 0x00, 0xe8, 0x56, 0x01,
-  0x00, 0x00, 0xbb, 0x12, 0x00, 0x00, 0x00, 0x8d, 0x45, 0xd8, 0x31, 0xd2,
-  0x8b, 0x4d, 0xbc, 0xe8, 0x64, 0x48, 0xff, 0xff, 0xc7, 0x45, 0xe2, 0x01,
-  0x65, 0x00, 0x00, 0xb8, 0xff, 0xff, 0x00, 0x00, 0xc7, 0x45, 0xc4, 0x07,
-  0x00, 0x00, 0x00, 0x66, 0xc7, 0x45, 0xd8, 0x21, 0x00, 0xc7, 0x45, 0xbc,
-  0x11, 0x25, 0x00, 0x00, 0x8d, 0x5d, 0xec, 0x89, 0x45, 0xe6, 0x89, 0x45,
-  0xc0, 0x31, 0xc0, 0x66, 0x89, 0x4d, 0xdc, 0x89, 0x45, 0xd0, 0x8d, 0x45,
-  0xd8, 0x8c, 0xda, 0x89, 0x45, 0xc8, 0x8d, 0x45, 0xbc, 0x66, 0x89, 0x55,
-  0xf2, 0x8d, 0x55, 0xbc, 0xe8, 0xfb, 0x00, 0x00, 0x00, 0x66, 0x83, 0x7d,
-  0xda, 0xff, 0x74, 0x11, 0x0f, 0xb7, 0xf1, 0x8e, 0x05, 0x84, 0x15, 0x00,
-  0x00, 0xc1, 0xe6, 0x04, 0x66, 0x26, 0x8b, 0x76, 0x05, 0x8d, 0x5d, 0xec,
-  0x0f, 0xb7, 0xc1, 0x8d, 0x55, 0xbc, 0x89, 0x45, 0xc4, 0x8d, 0x45, 0xbc,
-  0xc7, 0x45, 0xbc, 0xc1, 0x25, 0x00, 0x00, 0xe8, 0xc8, 0x00, 0x00, 0x00,
-  0xe9, 0xa2, 0x00, 0x00, 0x00, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00, 0x01,
-  0x0f, 0x85, 0x95, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x8d,
-  0x7d, 0x88, 0x66, 0xb8, 0x00, 0x01, 0xcd, 0x31, 0x73, 0x03, 0x66, 0x2b,
-  0xd2, 0x66, 0x92, 0xc1, 0xe0, 0x10, 0x66, 0x8b, 0xc2, 0xbb, 0x34, 0x00,
-  0x00, 0x00, 0x89, 0x45, 0xf8, 0xc1, 0xe8, 0x10, 0x31, 0xd2, 0x89, 0x45,
-  0xfc, 0x8d, 0x45, 0x88, 0x31, 0xc9, 0xe8, 0xa1, 0x47, 0xff, 0xff, 0xc7,
-  0x45, 0xa4, 0x01, 0x65, 0x00, 0x00, 0xc7, 0x45, 0x98, 0xff, 0xff, 0x00,
-  0x00, 0xc7, 0x45, 0xa0, 0x07, 0x00, 0x00, 0x00, 0xc7, 0x45, 0x9c, 0xff,
-  0xff, 0x00, 0x00, 0x8c, 0xda, 0x31, 0xc0, 0x30, 0xff, 0x89, 0x45, 0x88,
-  0x8b, 0x45, 0xf8, 0xb3, 0x21, 0x66, 0x89, 0x45, 0xaa, 0x06, 0x66, 0x8e,
-  0xc2, 0x66, 0xb8, 0x00, 0x03, 0xcd, 0x31, 0x07, 0x19, 0xc0, 0xf6, 0x45,
-  0xa8, 0x01, 0x75, 0x14, 0x0f, 0xb7, 0x45, 0xf8, 0xc1, 0xe0, 0x04, 0x8e,
-  0x05, 0x84, 0x15, 0x00, 0x00, 0x8d, 0x70, 0x05, 0x66, 0x26, 0x8b, 0x36,
-  0x8b, 0x55, 0xfc, 0x66, 0xb8, 0x01, 0x01, 0xcd, 0x31, 0x19, 0xc0, 0x89,
-  0xf0, 0xc9, 0x07, 0x5f, 0x5e, 0x5a, 0x59, 0x5b, 0xc3, 0x00, 0x00, 0x00,
-  0x73, 0x0e, 0x25, 0xff, 0xff, 0x00, 0x00, 0x50, 0xe8, 0xc7, 0xf6, 0xff,
-  0xff, 0x58, 0xeb, 0x02, 0x2b, 0xc0, 0xc3, 0x00, 0x51, 0x56, 0x57, 0x55,
-  0x89, 0xd5, 0x89, 0xc7, 0x55, 0x06, 0x53, 0x1e, 0x52, 0x8e, 0x03, 0x66,
-  0x8b, 0x6b, 0x06, 0x8b, 0x07, 0x8b, 0x5f, 0x04, 0x8b, 0x4f, 0x08, 0x8b,
-  0x57, 0x0c, 0x8b, 0x77, 0x10, 0x8b, 0x7f, 0x14, 0x8e, 0xdd, 0xf8, 0xcd,
-  0x21, 0x1e, 0x57, 0x89, 0xe5, 0x8b, 0x7d, 0x08, 0x8e, 0x5d, 0x0c, 0x89,
-  0x07, 0x89, 0x5f, 0x04, 0x89, 0x4f, 0x08, 0x89, 0x57, 0x0c, 0x89, 0x77,
-  0x10, 0x8f, 0x47, 0x14, 0x58, 0x5b, 0x5b, 0x5b, 0x66, 0x89, 0x43, 0x06,
-  0x8c, 0x03, 0x1b, 0xc0, 0x07, 0x5d, 0x89, 0xc2, 0x8b, 0x5d, 0x00, 0x89,
-  0x45, 0x18, 0x89, 0xd8, 0xe8, 0x3f, 0xf6, 0xff, 0xff, 0x8b, 0x45, 0x00,
-  0x5d, 0x5f, 0x5e, 0x59, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x51, 0x52, 0x80, 0x3d, 0x2e, 0x10, 0x00, 0x00, 0x03, 0x75, 0x09,
-  0x80, 0x3d, 0x30, 0x10, 0x00, 0x00, 0x00, 0x75, 0x4c, 0x8a, 0x15, 0x2e,
-  0x10, 0x00, 0x00, 0x80, 0xfa, 0x02, 0x72, 0x05, 0x80, 0xfa, 0x08, 0x76,
-  0x44, 0x8a, 0x1d, 0x2e, 0x10, 0x00, 0x00, 0x84, 0xdb, 0x74, 0x3a, 0x80,
-  0xfb, 0x01, 0x75, 0x09, 0x80, 0x3d, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x74,
-  0x37, 0x8a, 0x2d, 0x2e, 0x10, 0x00, 0x00, 0x80, 0xfd, 0x09, 0x74, 0x2c,
-  0x80, 0xfd, 0x01, 0x75, 0x08, 0x3a, 0x2d, 0x2f, 0x10, 0x00, 0x00, 0x74,
-  0x24, 0x31, 0xc0, 0x66, 0xa3, 0x84, 0x15, 0x00, 0x00, 0x5a, 0x59, 0x5b,
-  0xc3, 0x66, 0xa1, 0xca, 0x0f, 0x00, 0x00, 0xeb, 0xee, 0x66, 0x8c, 0xd8,
-  0x30, 0xe4, 0x24, 0x03, 0x0c, 0x34, 0xeb, 0xe3, 0x66, 0x8c, 0xd8, 0xeb,
-  0xde, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x66, 0xb8, 0x00, 0x00, 0xcd, 0x31,
-  0x66, 0x8b, 0xd0, 0x66, 0x19, 0xc0, 0xc1, 0xe0, 0x10, 0x66, 0x8b, 0xc2,
-  0x89, 0xc1, 0x85, 0xc0, 0x7d, 0x0f, 0xba, 0xff, 0xff, 0xff, 0xff, 0xb8,
-  0xc8, 0x08, 0x00, 0x00, 0xe8, 0x0b, 0xd5, 0xff, 0xff, 0xba, 0xff, 0xff,
-  0x0f, 0x00, 0x89, 0xcb, 0x66, 0x89, 0x0d, 0x84, 0x15, 0x00, 0x00, 0x66,
-  0x8b, 0xc2, 0xc1, 0xea, 0x10, 0x66, 0x8b, 0xca, 0x66, 0x8b, 0xd0, 0x66,
-  0xb8, 0x08, 0x00, 0xcd, 0x31, 0x66, 0x19, 0xc0, 0x66, 0x85, 0xc0, 0x74,
-  0x90, 0xba, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xee, 0x08, 0x00, 0x00, 0xe8,
-  0xd4, 0xd4, 0xff, 0xff, 0x5a, 0x59, 0x5b, 0xc3, 0x53, 0xa0, 0x2e, 0x10,
-  0x00, 0x00, 0x3c, 0x01, 0x75, 0x08, 0x3a, 0x05, 0x2f, 0x10, 0x00, 0x00,
-  0x74, 0x02, 0x5b, 0xc3, 0x66, 0x8b, 0x1d, 0x84, 0x15, 0x00, 0x00, 0x66,
-  0xb8, 0x01, 0x00, 0xcd, 0x31, 0x5b, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x51, 0x52, 0x56,
-  0x57, 0x55, 0xe8, 0x07, 0x00, 0x00, 0x00, 0x5d, 0x5f, 0x5e, 0x5a, 0x59,
-  0x5b, 0xc3, 0xdb, 0xe3, 0x66, 0xc7, 0x05, 0xda, 0x0d, 0x00, 0x00, 0x5a,
-  0x5a, 0xdd, 0x3d, 0xda, 0x0d, 0x00, 0x00, 0x66, 0x83, 0x3d, 0xda, 0x0d,
-  0x00, 0x00, 0x00, 0x75, 0x1d, 0xd9, 0x3d, 0xda, 0x0d, 0x00, 0x00, 0x66,
-  0xa1, 0xda, 0x0d, 0x00, 0x00, 0x66, 0x25, 0x3f, 0x10, 0x66, 0x83, 0xf8,
-  0x3f, 0x75, 0x07, 0x80, 0x0d, 0xd8, 0x0d, 0x00, 0x00, 0x02, 0x9c, 0x58,
-  0x0d, 0x00, 0x00, 0x04, 0x00, 0x50, 0x9d, 0x9c, 0x58, 0xa9, 0x00, 0x00,
-  0x04, 0x00, 0x75, 0x06, 0xb8, 0x03, 0x00, 0x00, 0x00, 0xc3, 0x25, 0xff,
-  0xff, 0xdf, 0xff, 0x50, 0x9d, 0x9c, 0x58, 0xa9, 0x00, 0x00, 0x20, 0x00,
-  0x75, 0x5d, 0x0d, 0x00, 0x00, 0x20, 0x00, 0x50, 0x9d, 0x9c, 0x58, 0xa9,
-  0x00, 0x00, 0x20, 0x00, 0x74, 0x4d, 0x80, 0x0d, 0xd8, 0x0d, 0x00, 0x00,
-  0x01, 0x31, 0xc0, 0x0f, 0xa2, 0xbe, 0xa4, 0x0d, 0x00, 0x00, 0x89, 0x1e,
-  0x89, 0x56, 0x04, 0x89, 0x4e, 0x08, 0xc6, 0x46, 0x0c, 0x00, 0xa3, 0xd4,
-  0x0d, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xa2, 0xbe, 0xc1,
-  0x0d, 0x00, 0x00, 0x89, 0x06, 0x89, 0x5e, 0x04, 0x89, 0x56, 0x08, 0x89,
-  0x4e, 0x0c, 0xc1, 0xe8, 0x08, 0x83, 0xe0, 0x0f, 0x3c, 0x04, 0x74, 0x0a,
-  0x3c, 0x05, 0x74, 0x06, 0x3c, 0x06, 0x74, 0x02, 0xb0, 0x06, 0xc3, 0xb8,
-  0x04, 0x00, 0x00, 0x00, 0xc3, 0x50, 0x51, 0x52, 0xb9, 0x19, 0x01, 0x00,
-  0x00, 0x0f, 0x32, 0x0d, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x30, 0x5a, 0x59,
-  0x58, 0xc3, 0x50, 0x53, 0x51, 0x52, 0x31, 0xdb, 0x89, 0xd9, 0x89, 0xda,
-  0xb8, 0x03, 0x00, 0x00, 0x00, 0x0f, 0xa2, 0x89, 0x15, 0xb1, 0x0d, 0x00,
-  0x00, 0x89, 0x0d, 0xb5, 0x0d, 0x00, 0x00, 0x89, 0x1d, 0xb9, 0x0d, 0x00,
-  0x00, 0xa3, 0xbd, 0x0d, 0x00, 0x00, 0x5a, 0x59, 0x5b, 0x58, 0xc3, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x01, 0x01, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-  0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x68, 0x65, 0x78,
-  0x6d, 0x65, 0x6d, 0x20, 0x5b, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x5d, 0x0a, 0x00, 0x6e, 0x66, 0x00, 0x6e, 0x62, 0x00, 0x68, 0x65, 0x78,
-  0x6d, 0x65, 0x6d, 0x2e, 0x63, 0x00, 0x63, 0x6f, 0x70, 0x79, 0x5f, 0x64,
-  0x61, 0x74, 0x61, 0x5f, 0x74, 0x6f, 0x00, 0x63, 0x70, 0x79, 0x20, 0x3c,
-  0x3d, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x70, 0x61, 0x72, 0x61, 0x00,
-  0x44, 0x4f, 0x53, 0x20, 0x00, 0x57, 0x49, 0x4e, 0x20, 0x00, 0x43, 0x50,
-  0x55, 0x20, 0x00, 0x44, 0x50, 0x4d, 0x49, 0x20, 0x00, 0x48, 0x49, 0x4d,
-  0x45, 0x4d, 0x20, 0x00, 0x45, 0x4d, 0x4d, 0x20, 0x00, 0x4c, 0x54, 0x50,
-  0x20, 0x00, 0x4c, 0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x00, 0x5b, 0x4f, 0x4b,
-  0x5d, 0x0a, 0x00, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x20,
-  0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x6e,
-  0x20, 0x69, 0x73, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x57, 0x69, 0x6e,
-  0x64, 0x6f, 0x77, 0x73, 0x20, 0x63, 0x68, 0x6f, 0x73, 0x65, 0x73, 0x20,
-  0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69,
-  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x74, 0x20, 0x6d, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63,
-  0x74, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x73, 0x79, 0x73,
-  0x74, 0x65, 0x6d, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2e, 0x0a,
-  0x00, 0x70, 0x74, 0x72, 0x63, 0x61, 0x73, 0x74, 0x3d, 0x25, 0x64, 0x20,
-  0x66, 0x6c, 0x61, 0x74, 0x72, 0x65, 0x61, 0x6c, 0x3d, 0x25, 0x64, 0x20,
-  0x62, 0x69, 0x6f, 0x73, 0x65, 0x78, 0x74, 0x3d, 0x25, 0x64, 0x0a, 0x00,
-  0x79, 0x65, 0x73, 0x00, 0x6e, 0x6f, 0x00, 0x4c, 0x4c, 0x4d, 0x45, 0x4d,
-  0x3a, 0x20, 0x25, 0x73, 0x20, 0x28, 0x25, 0x73, 0x29, 0x20, 0x6c, 0x69,
-  0x6d, 0x69, 0x74, 0x3d, 0x30, 0x78, 0x25, 0x6c, 0x6c, 0x58, 0x0a, 0x00,
-  0x52, 0x65, 0x61, 0x64, 0x79, 0x0a, 0x00, 0x4a, 0x75, 0x6d, 0x70, 0x20,
-  0x74, 0x6f, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x52, 0x65, 0x71, 0x75,
-  0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x20, 0x34, 0x38, 0x36, 0x20, 0x6f,
-  0x72, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f,
-  0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x00, 0x52, 0x65, 0x71, 0x75, 0x69,
-  0x72, 0x65, 0x73, 0x20, 0x43, 0x50, 0x55, 0x49, 0x44, 0x00, 0x52, 0x75,
-  0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f,
-  0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74, 0x20, 0x6b, 0x6e,
-  0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63,
-  0x61, 0x6c, 0x3c, 0x2d, 0x3e, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x20,
-  0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74,
-  0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x4c,
-  0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20,
-  0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d,
-  0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x57, 0x69, 0x6e, 0x64,
-  0x6f, 0x77, 0x73, 0x00, 0x4c, 0x4c, 0x4d, 0x45, 0x4d, 0x20, 0x72, 0x65,
-  0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x43, 0x50, 0x55, 0x20, 0x73, 0x75, 0x70, 0x70,
-  0x6f, 0x72, 0x74, 0x20, 0x50, 0x53, 0x45, 0x20, 0x6f, 0x72, 0x20, 0x50,
-  0x41, 0x45, 0x00, 0x44, 0x50, 0x4d, 0x49, 0x2f, 0x56, 0x43, 0x50, 0x49,
-  0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x72,
-  0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x61,
-  0x67, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x74,
-  0x20, 0x52, 0x69, 0x6e, 0x67, 0x20, 0x30, 0x00, 0x33, 0x32, 0x2d, 0x62,
-  0x69, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x61, 0x67, 0x69,
-  0x6e, 0x67, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65,
-  0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x20, 0x44, 0x50, 0x4d, 0x49, 0x2f, 0x56, 0x43, 0x50, 0x49, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x65, 0x64, 0x00, 0x44, 0x50, 0x4d, 0x49, 0x2f, 0x56, 0x43, 0x50, 0x49,
-  0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x72,
-  0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74,
-  0x20, 0x70, 0x61, 0x67, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x62, 0x75, 0x74,
-  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x74, 0x20, 0x52, 0x69, 0x6e, 0x67,
-  0x20, 0x30, 0x00, 0x6c, 0x6c, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a,
-  0x20, 0x6e, 0x6f, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61,
-  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x32, 0x30,
-  0x4b, 0x42, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x29, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x32, 0x4d, 0x20, 0x50, 0x41, 0x45, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x6c, 0x6c, 0x6d,
-  0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x20, 0x6d, 0x65,
-  0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x28, 0x34, 0x4b, 0x42, 0x20, 0x6e, 0x65, 0x65, 0x64,
-  0x65, 0x64, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x34, 0x4d, 0x20, 0x50,
-  0x53, 0x45, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x00, 0x6c, 0x6c, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x3a, 0x20,
-  0x6e, 0x6f, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x73, 0x20, 0x61,
-  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x68, 0x73, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x25, 0x68, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20,
-  0x25, 0x68, 0x73, 0x2c, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x25, 0x64,
-  0x2e, 0x0a, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x00, 0x3a, 0x20, 0x00, 0x21,
-  0x42, 0x52, 0x45, 0x41, 0x4b, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4e, 0x20,
-  0x25, 0x33, 0x64, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x52, 0x65, 0x61,
-  0x6c, 0x00, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x00, 0x45,
-  0x6e, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x00, 0x4e, 0x54, 0x00, 0x4f,
-  0x53, 0x2f, 0x32, 0x00, 0x42, 0x49, 0x4f, 0x53, 0x3a, 0x20, 0x00, 0x56,
-  0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x42, 0x6f, 0x78, 0x20, 0x00, 0x46,
-  0x41, 0x54, 0x41, 0x4c, 0x3a, 0x20, 0x44, 0x50, 0x4d, 0x49, 0x20, 0x61,
-  0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x63, 0x61, 0x6c,
-  0x6c, 0x3a, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c,
-  0x6c, 0x6f, 0x63, 0x0a, 0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x31, 0x68,
-  0x20, 0x41, 0x48, 0x3d, 0x33, 0x30, 0x68, 0x00, 0x49, 0x4e, 0x54, 0x20,
-  0x32, 0x31, 0x68, 0x20, 0x41, 0x58, 0x3d, 0x33, 0x33, 0x30, 0x36, 0x68,
-  0x00, 0x44, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d,
-  0x20, 0x44, 0x4f, 0x53, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x46, 0x68, 0x20, 0x41, 0x58, 0x3d,
-  0x31, 0x36, 0x30, 0x41, 0x68, 0x00, 0x49, 0x4e, 0x54, 0x20, 0x32, 0x46,
-  0x68, 0x20, 0x41, 0x58, 0x3d, 0x34, 0x36, 0x38, 0x30, 0x68, 0x00, 0x49,
-  0x4e, 0x54, 0x20, 0x32, 0x46, 0x68, 0x20, 0x41, 0x58, 0x3d, 0x31, 0x36,
-  0x30, 0x30, 0x68, 0x00, 0x41, 0x73, 0x73, 0x75, 0x6d, 0x69, 0x6e, 0x67,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x44, 0x4f, 0x53, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-  0x00, 0x47, 0x65, 0x74, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x45,
-  0x78, 0x20, 0x5b, 0x4e, 0x54, 0x56, 0x44, 0x4d, 0x2e, 0x45, 0x58, 0x45,
-  0x20, 0x2b, 0x20, 0x44, 0x4f, 0x53, 0x4e, 0x54, 0x41, 0x53, 0x54, 0x2e,
-  0x56, 0x44, 0x44, 0x5d, 0x00, 0x53, 0x43, 0x00, 0x53, 0x44, 0x00, 0x4e,
-  0x55, 0x4c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x53, 0x42, 0x4f, 0x53,
-  0x00, 0x55, 0x4c, 0x54, 0x52, 0x41, 0x4d, 0x49, 0x44, 0x00, 0x57, 0x49,
-  0x4e, 0x45, 0x20, 0x28, 0x57, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x73, 0x20,
-  0x4e, 0x6f, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x45, 0x6d, 0x75, 0x6c, 0x61,
-  0x74, 0x6f, 0x72, 0x29, 0x00, 0x3f, 0x00, 0x44, 0x4f, 0x53, 0x4e, 0x54,
-  0x41, 0x53, 0x54, 0x2e, 0x56, 0x44, 0x44, 0x00, 0x44, 0x69, 0x73, 0x70,
-  0x61, 0x74, 0x63, 0x68, 0x00, 0x49, 0x6e, 0x69, 0x74, 0x00, 0x44, 0x4f,
-  0x53, 0x4e, 0x54, 0x41, 0x53, 0x54, 0x2e, 0x56, 0x44, 0x44, 0xff, 0xff,
-  0x00, 0x4d, 0x53, 0x2d, 0x44, 0x4f, 0x53, 0x00, 0x46, 0x72, 0x65, 0x65,
-  0x44, 0x4f, 0x53, 0x00, 0x38, 0x30, 0x38, 0x36, 0x00, 0x31, 0x38, 0x36,
-  0x00, 0x32, 0x38, 0x36, 0x00, 0x33, 0x38, 0x36, 0x00, 0x34, 0x38, 0x36,
-  0x00, 0x35, 0x38, 0x36, 0x00, 0x36, 0x38, 0x36, 0x00, 0x00, 0x4e, 0x6f,
-  0x6e, 0x65, 0x00, 0x4e, 0x6f, 0x20, 0x43, 0x50, 0x55, 0x49, 0x44, 0x20,
-  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x43, 0x50,
-  0x55, 0x49, 0x44, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
-  0x73, 0x20, 0x53, 0x53, 0x45, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74,
-  0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x00, 0x48, 0x6f, 0x6f,
-  0x6b, 0x20, 0x49, 0x4e, 0x54, 0x20, 0x36, 0x68, 0x2c, 0x20, 0x65, 0x78,
-  0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x53, 0x53, 0x45, 0x20, 0x74, 0x6f,
-  0x20, 0x73, 0x65, 0x65, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x63,
-  0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x61, 0x75, 0x6c,
-  0x74, 0x20, 0x5b, 0x4d, 0x53, 0x2d, 0x44, 0x4f, 0x53, 0x5d, 0x00, 0x53,
-  0x53, 0x45, 0x20, 0x69, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
-  0x74, 0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64,
-  0x2c, 0x20, 0x6e, 0x6f, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x68, 0x61, 0x73,
-  0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x74, 0x20,
-  0x79, 0x65, 0x74, 0x00, 0x38, 0x30, 0x33, 0x38, 0x36, 0x20, 0x4d, 0x4f,
-  0x56, 0x20, 0x43, 0x52, 0x34, 0x20, 0x5b, 0x4d, 0x53, 0x2d, 0x44, 0x4f,
-  0x53, 0x5d, 0x00, 0x53, 0x53, 0x45, 0x20, 0x69, 0x73, 0x20, 0x63, 0x75,
-  0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 0x61,
-  0x62, 0x6c, 0x65, 0x64, 0x00, 0x41, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65,
-  0x20, 0x43, 0x52, 0x34, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x00,
-  0x45, 0x4d, 0x4d, 0x58, 0x58, 0x58, 0x58, 0x30, 0x00, 0x45, 0x4d, 0x4d,
-  0x51, 0x58, 0x58, 0x58, 0x30, 0x00, 0x25, 0x73, 0x28, 0x25, 0x75, 0x29,
-  0x20, 0x44, 0x53, 0x28, 0x25, 0x58, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x45,
-  0x53, 0x28, 0x25, 0x58, 0x29, 0x0a, 0x00, 0x65, 0x6d, 0x6d, 0x2e, 0x63,
-  0x00, 0x00, 0x00, 0x00, 0x56, 0x47, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x45,
-  0x47, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x43, 0x47, 0x41, 0x3d, 0x25, 0x75,
-  0x20, 0x4d, 0x44, 0x41, 0x3d, 0x25, 0x75, 0x20, 0x4d, 0x43, 0x47, 0x41,
-  0x3d, 0x25, 0x75, 0x20, 0x48, 0x47, 0x43, 0x3d, 0x25, 0x75, 0x28, 0x25,
-  0x75, 0x29, 0x20, 0x54, 0x61, 0x6e, 0x64, 0x79, 0x2f, 0x50, 0x43, 0x6a,
-  0x72, 0x3d, 0x25, 0x75, 0x20, 0x41, 0x6d, 0x73, 0x74, 0x72, 0x61, 0x64,
-  0x3d, 0x25, 0x75, 0x0a, 0x00, 0x20, 0x20, 0x33, 0x78, 0x30, 0x20, 0x49,
-  0x2f, 0x4f, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x78,
-  0x25, 0x30, 0x33, 0x78, 0x20, 0x20, 0x52, 0x41, 0x4d, 0x20, 0x40, 0x20,
-  0x30, 0x78, 0x25, 0x30, 0x35, 0x6c, 0x78, 0x2d, 0x30, 0x78, 0x25, 0x30,
-  0x35, 0x6c, 0x78, 0x20, 0x20, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x3d, 0x25,
-  0x75, 0x20, 0x39, 0x57, 0x3d, 0x25, 0x75, 0x0a, 0x00, 0x20, 0x20, 0x00,
-  0x59, 0x00, 0x65, 0x73, 0x20, 0x20, 0x00, 0x4e, 0x00, 0x6f, 0x20, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75,
-  0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x74, 0x6f,
-  0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69,
-  0x6c, 0x65, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
-  0x73, 0x00, 0x00, 0x00, 0x3a, 0x20, 0x00, 0x00, 0x41, 0x42, 0x4e, 0x4f,
-  0x52, 0x4d, 0x41, 0x4c, 0x20, 0x54, 0x45, 0x52, 0x4d, 0x49, 0x4e, 0x41,
-  0x54, 0x49, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x44, 0x4c, 0x4c, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x44, 0x69,
-  0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x69,
-  0x6e, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64,
-  0x00, 0x49, 0x6e, 0x69, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e,
-  0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00,
-  0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x66,
-  0x61, 0x63, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
-  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x3f, 0x00, 0x45, 0x52, 0x52, 0x4f,
-  0x52, 0x3a, 0x20, 0x41, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74, 0x20, 0x74,
-  0x6f, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x4e, 0x54, 0x56, 0x44, 0x4d,
-  0x2e, 0x45, 0x58, 0x45, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
-  0x68, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65,
-  0x61, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
-  0x6f, 0x75, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
-  0x6e, 0x67, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x21, 0x0a, 0x00, 0x00,
-  0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x6f, 0x69,
-  0x6e, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x00, 0x00, 0x00,
-  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62,
-  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
-  0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-  0x00, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74,
-  0x6f, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x20, 0x72,
-  0x65, 0x61, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x65, 0x6c,
-  0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6c, 0x69, 0x6d, 0x69,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x6d, 0x6f,
-  0x64, 0x65, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00,
-  0x00, 0x70, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
-  0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x0a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x38, 0x38, 0x38,
-  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-  0x0c, 0x0c, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x48, 0x48, 0x48, 0x48,
-  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-  0x48, 0x48, 0x48, 0x48, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x98, 0x98,
-  0x98, 0x98, 0x98, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x0c, 0x0c, 0x0c, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00,
-  0xf9, 0x03, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
-  0x10, 0x04, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xfc, 0x8c, 0xd0, 0x8e, 0xd8, 0x8e, 0xc0, 0x89, 0xe5, 0x8d,
-  0x76, 0x06, 0x83, 0xec, 0x20, 0xb9, 0x10, 0x00, 0x89, 0xe7, 0xf3, 0xa5,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00,
-  0x85, 0x05, 0x00, 0x00, 0x89, 0x05, 0x00, 0x00, 0x8d, 0x05, 0x00, 0x00,
-  0x91, 0x05, 0x00, 0x00, 0x95, 0x05, 0x00, 0x00, 0x99, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x9c, 0x06, 0x00, 0x00, 0xa5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x19, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x2d, 0x2e, 0x07,
-  0x5b, 0x02, 0x57, 0x57, 0x02, 0x03, 0x00, 0x00, 0x61, 0x50, 0x52, 0x0f,
-  0x19, 0x06, 0x19, 0x19, 0x02, 0x0d, 0x0d, 0x0c, 0xd8, 0x23, 0x80, 0x01,
-  0x53, 0x28, 0xb0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x92, 0x24, 0x49, 0x92,
-  0x24, 0x49, 0x92, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-  0x71, 0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0x99, 0x99, 0x99, 0x99,
-  0x99, 0x99, 0x99, 0x19, 0xd1, 0x45, 0x17, 0x5d, 0x74, 0xd1, 0x45, 0x17,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0xb1, 0x13, 0x3b, 0xb1,
-  0x13, 0x3b, 0xb1, 0x13, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x12,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x38, 0x0e, 0x35, 0x94, 0xd7, 0x50,
-  0x5e, 0x43, 0x79, 0x0d, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c,
-  0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xe8, 0xa2, 0x8b, 0x2e,
-  0xba, 0xe8, 0xa2, 0x0b, 0x16, 0xb2, 0x90, 0x85, 0x2c, 0x64, 0x21, 0x0b,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x70, 0x3d, 0x0a, 0xd7,
-  0xa3, 0x70, 0x3d, 0x0a, 0xd8, 0x89, 0x9d, 0xd8, 0x89, 0x9d, 0xd8, 0x09,
-  0x25, 0xb4, 0x97, 0xd0, 0x5e, 0x42, 0x7b, 0x09, 0x24, 0x49, 0x92, 0x24,
-  0x49, 0x92, 0x24, 0x09, 0x08, 0xcb, 0x3d, 0x8d, 0xb0, 0xdc, 0xd3, 0x08,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x08, 0x10, 0x42, 0x08, 0x21,
-  0x84, 0x10, 0x42, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07,
-  0xf0, 0xc1, 0x07, 0x1f, 0x7c, 0xf0, 0xc1, 0x07, 0x87, 0x87, 0x87, 0x87,
-  0x87, 0x87, 0x87, 0x07, 0x50, 0x07, 0x75, 0x50, 0x07, 0x75, 0x50, 0x07,
-  0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0x07, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20,
-  0x4f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x21, 0x00, 0x00, 0x00,
-  0x3c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xb0, 0xc1, 0x00, 0x00,
-  0xb0, 0xc1, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x09, 0x01, 0x01, 0x0b, 0x06, 0x04, 0x05, 0x05, 0x05, 0x02, 0x03,
-  0xff, 0x0e, 0x07, 0x24, 0x06, 0x08, 0x01, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x94,
-  0x00, 0x00, 0x00, 0x0a, 0x90, 0xa2, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x99,
-  0x00, 0x00, 0x00, 0x20, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x02, 0xf0, 0xce,
-  0x00, 0x00, 0x00, 0x20, 0x50, 0x95, 0x00, 0x00, 0x00, 0x20, 0x80, 0xa4,
-  0x00, 0x00, 0x00, 0x02, 0xd0, 0xcf, 0x00, 0x00
+	0x78,0xDA,0xEC,0xBD,0x09,0x74,0x14,0x55,0xF6,0x3F,0xFE,
+	0xAA,0x5E,0xF5,0x92,0x4E,0x2F,0x01,0xC2,0x22,0x0A,0x34,
+	0x88,0x51,0x8C,0x22,0x51,0x44,0x42,0x08,0x04,0x42,0x3A,
+	0xEC,0x04,0x30,0x6C,0x42,0x10,0x21,0x08,0xCA,0x66,0xD2,
+	0x1D,0xC0,0x09,0xA1,0x63,0x93,0x21,0x95,0x4A,0x22,0xAE,
+	0x23,0xAE,0x20,0xEA,0x20,0xA2,0xA2,0x83,0x4C,0x00,0x07,
+	0x3A,0x29,0x4C,0x08,0x58,0x98,0x45,0x31,0x2C,0x03,0x11,
+	0x10,0x2B,0x36,0x60,0x58,0x0C,0x21,0x84,0xF4,0xEF,0xBE,
+	0x77,0x13,0x44,0x67,0xBE,0xF3,0x9D,0xF3,0x3F,0xE7,0x7F,
+	0xFE,0xE7,0xFC,0xCF,0x2F,0x1C,0xFA,0x53,0x77,0x79,0xFB,
+	0x7D,0xF7,0xDE,0x57,0x55,0xE9,0x8C,0x9B,0xD1,0x40,0xEE,
+	0x20,0x12,0x31,0x90,0xAD,0x24,0x18,0x7C,0x95,0x12,0x33,
+	0x21,0xC7,0x25,0x42,0xE2,0xC8,0x7F,0xF1,0xF3,0x08,0x21,
+	0x4F,0x1B,0x08,0xB9,0x0A,0xFF,0x4F,0x18,0xA1,0x8C,0x89,
+	0x90,0xAF,0x03,0x37,0xD6,0xC1,0xCF,0x4D,0x95,0xC9,0x13,
+	0x27,0x4D,0x99,0x5A,0xD4,0x8B,0xE8,0x55,0x24,0xC7,0xEF,
+	0xEE,0xBD,0xB7,0x93,0x51,0x2E,0x9D,0xBA,0x35,0xD7,0x90,
+	0x38,0x98,0x78,0x1A,0x67,0xCB,0x8D,0xBB,0xA2,0x88,0xDE,
+	0x4D,0x90,0x1B,0xF5,0x81,0x02,0xC8,0x25,0xB9,0x31,0x30,
+	0x3E,0xAA,0x3C,0xAA,0x21,0x60,0x1E,0xE6,0x72,0xF9,0xAE,
+	0x89,0xE9,0xB7,0xED,0xEE,0x64,0x2C,0x1A,0x40,0x94,0x97,
+	0x8F,0x52,0x7D,0xAF,0xE0,0x1D,0xD2,0xC9,0x48,0xDC,0x67,
+	0x8A,0x3A,0x19,0x03,0x77,0xFF,0x4E,0xAD,0x13,0x53,0x1B,
+	0x86,0x6A,0xAF,0xB5,0xA9,0x05,0xBE,0x2F,0x1A,0x43,0x66,
+	0xA7,0xCC,0x98,0xFE,0x98,0x3A,0x39,0x59,0xFE,0x31,0xFB,
+	0x5C,0x2E,0xC9,0x3E,0xEF,0x25,0x72,0xB5,0xBE,0x20,0x28,
+	0xBB,0x56,0x28,0x26,0xD9,0xF5,0x6C,0x81,0xAB,0xB1,0x60,
+	0xCA,0x0A,0xFD,0xB0,0x28,0xBB,0x32,0x15,0xD7,0x8A,0x32,
+	0x57,0x16,0x21,0xFA,0xF7,0x62,0xD1,0x54,0xA2,0x1F,0x13,
+	0x81,0xA1,0x7F,0x27,0xEA,0x8D,0xA2,0xAC,0x2A,0x26,0xFD,
+	0x9A,0xA8,0xEF,0x17,0x8B,0x04,0xA2,0x97,0xD1,0x82,0x0F,
+	0xBC,0x64,0x16,0xD4,0xCA,0x06,0x27,0x97,0x29,0x03,0xB6,
+	0x9B,0x72,0x1A,0xDC,0x93,0x61,0x00,0x13,0x94,0x3B,0x72,
+	0x8E,0xB9,0x47,0xC9,0x4D,0xDE,0xA1,0xC4,0x63,0xF0,0x95,
+	0x8A,0x81,0x0B,0x72,0x85,0x1E,0x65,0x04,0x91,0xDD,0x3B,
+	0x34,0xD6,0x73,0xBE,0x20,0x51,0xC0,0x1E,0xC9,0x35,0xFA,
+	0x44,0xA3,0xBE,0xC2,0x28,0x17,0x83,0x42,0xA2,0x51,0x5F,
+	0x62,0x8C,0x2E,0xF6,0x1C,0x02,0xEE,0x4A,0xA3,0xAC,0x02,
+	0x2B,0xCD,0x28,0x97,0x04,0x76,0x46,0xF9,0x03,0x15,0x93,
+	0x27,0xC9,0x25,0xB2,0x9A,0x67,0x5A,0xE3,0x77,0x3B,0xEE,
+	0x1B,0x36,0xF8,0xB6,0x0C,0x1A,0x1F,0xB8,0x28,0xCD,0xC9,
+	0x35,0x05,0xAE,0xCA,0x15,0x33,0x58,0x2F,0xA6,0x4C,0x85,
+	0xE1,0xF9,0xCE,0x49,0x72,0xA9,0x5C,0x0D,0x0D,0xBB,0x63,
+	0xBD,0xAB,0x05,0xE2,0x1E,0xBA,0x33,0x18,0x94,0xAF,0xF6,
+	0xF3,0x9F,0xB6,0xE4,0x1F,0x2D,0x2C,0xB9,0xF4,0x89,0x47,
+	0x9C,0xF0,0xA1,0x72,0x4D,0xCE,0x6A,0x96,0x4F,0xE6,0xD7,
+	0x14,0xFA,0x41,0xFA,0x90,0xFF,0xD2,0x27,0x57,0x2B,0x47,
+	0xC9,0xE3,0x5B,0x94,0xF1,0xCD,0x7D,0x2E,0xC6,0x8C,0x6F,
+	0x49,0xBF,0x27,0xCA,0x2F,0x9F,0x9B,0x35,0x3B,0x05,0x7A,
+	0x98,0xD7,0x39,0x4F,0x1A,0x54,0xE2,0x6E,0x3F,0x98,0xB8,
+	0xAD,0x2E,0x7E,0x69,0x72,0xC1,0xAA,0xFD,0x1C,0xD9,0x20,
+	0xD7,0x07,0x8E,0xCA,0x57,0xF3,0x4C,0x7F,0xA8,0xB9,0x29,
+	0x27,0xE8,0xF6,0x2B,0xE3,0x5B,0xF2,0x4F,0xC8,0x27,0x0B,
+	0x4B,0xE5,0xC3,0x97,0x3F,0x78,0xA7,0x61,0x5F,0x9C,0xC7,
+	0x20,0x1F,0x76,0x05,0xDE,0x96,0x2B,0x02,0x1F,0xB4,0x75,
+	0x54,0x94,0xCB,0xE4,0xC3,0x72,0x4A,0x8B,0xFE,0xB6,0x20,
+	0xAB,0x51,0x55,0x72,0xA3,0xE2,0xD0,0x3F,0x31,0xE4,0xF8,
+	0x3D,0xD3,0x95,0x8C,0x96,0x3C,0x43,0x54,0xD5,0xE0,0x99,
+	0xEE,0x81,0x83,0xFB,0xBA,0xFB,0x0F,0x7E,0xC0,0xDD,0x0F,
+	0x86,0x6D,0xF4,0xAE,0x12,0x06,0xB9,0x23,0x76,0xAD,0x23,
+	0x8A,0xAB,0x45,0xDF,0x61,0x80,0x4F,0x50,0xD4,0x1F,0x30,
+	0x0A,0xA5,0x72,0x89,0x37,0x33,0x38,0xD3,0x6D,0x89,0x7D,
+	0x9E,0xA4,0x1B,0x86,0x97,0x4A,0x33,0x5D,0xBB,0x9F,0x27,
+	0x72,0x7D,0x9F,0x6A,0xB9,0xA9,0x54,0x22,0xFA,0x9D,0x46,
+	0x1C,0x8D,0x2A,0xD7,0xEB,0x49,0x2D,0xB2,0x0A,0x6D,0xD0,
+	0xBA,0x95,0x84,0x4D,0x52,0x23,0x54,0x11,0x55,0xC5,0xA7,
+	0x55,0x1A,0x1C,0xE3,0x19,0x1D,0x93,0xD1,0xE2,0x8E,0xCD,
+	0x1B,0x11,0x84,0xB6,0x3B,0x40,0xBB,0x8E,0xC1,0x83,0xDC,
+	0xA1,0xD9,0x4D,0x37,0xAB,0x95,0x1B,0x59,0x7D,0x5F,0x1A,
+	0x84,0x92,0xEC,0xA6,0x75,0x24,0xBD,0x83,0xDC,0x04,0x55,
+	0x5E,0x62,0x5D,0x89,0xAA,0xD2,0x2F,0x4A,0xB0,0xC0,0xB7,
+	0xB3,0x5A,0xBB,0xC7,0x07,0xDE,0x1D,0xDC,0xCB,0x03,0x4B,
+	0xF4,0x3E,0x2F,0x7C,0x75,0x78,0xAE,0xE4,0x0A,0x5C,0x94,
+	0xF7,0xEB,0x57,0x0D,0x75,0x69,0x41,0x25,0xA5,0xA5,0xD4,
+	0x44,0xEA,0x16,0x06,0x61,0xD1,0x60,0xB5,0x2A,0x77,0x7B,
+	0x49,0xA1,0x71,0xA0,0x14,0x91,0x67,0xDA,0x9D,0x4D,0xFA,
+	0x9D,0xC9,0xF1,0x67,0x85,0x45,0x78,0x87,0x3A,0x3D,0x52,
+	0xFC,0xC8,0xC0,0x25,0xB8,0x0A,0x71,0x37,0x00,0xAF,0xBB,
+	0x5C,0x02,0xF6,0x75,0x17,0x18,0x7A,0x66,0xEF,0xE8,0xFD,
+	0xAB,0xEE,0x1A,0xED,0x6B,0x0A,0xBA,0xBB,0x46,0xE4,0x39,
+	0xE2,0x73,0xAD,0x50,0x39,0xC8,0x4C,0x39,0xE5,0x59,0x14,
+	0x3A,0x18,0xE5,0x67,0x2B,0x07,0x17,0x60,0x1B,0x07,0x46,
+	0x07,0x0E,0x83,0xED,0xA8,0xBB,0x82,0xAB,0xF5,0xE7,0x83,
+	0x72,0x0D,0x33,0x15,0xA5,0xFB,0x76,0x93,0xBE,0xD5,0x00,
+	0x57,0x93,0x76,0x2D,0x91,0xF4,0x4D,0x60,0x6B,0xB1,0xC1,
+	0xA0,0x87,0x82,0x0C,0xE8,0x22,0x0B,0xD1,0x4D,0x26,0x60,
+	0xB8,0x7F,0x01,0x3B,0x05,0x5E,0xD1,0x07,0x46,0xB5,0x68,
+	0xB3,0x51,0x05,0xD3,0xCE,0x34,0xC6,0x18,0xFB,0x49,0x99,
+	0x86,0xA2,0xC5,0x14,0x8C,0x57,0xAD,0x3C,0xAD,0xAC,0x3D,
+	0x41,0x5B,0xB7,0x40,0xEB,0xA2,0x96,0xE8,0x87,0x82,0x6C,
+	0xA7,0x94,0x1A,0xB7,0x18,0x89,0xEC,0x6A,0xC9,0xA9,0xF2,
+	0xCC,0x81,0xF9,0xD9,0xBB,0xC5,0xA8,0xFF,0x23,0x28,0x97,
+	0x76,0x37,0x4D,0x05,0x9B,0xDB,0x46,0x2E,0x7D,0x32,0x21,
+	0x4F,0xCA,0x35,0x80,0x59,0x85,0xE5,0x8D,0x10,0x60,0x8F,
+	0xE4,0x26,0x08,0xBE,0x32,0x11,0x4C,0x4B,0x9F,0xBD,0x27,
+	0x8B,0xFE,0x37,0x6A,0x72,0x23,0x5F,0x56,0xB6,0x8F,0x76,
+	0xA7,0x90,0xA2,0x2D,0xC6,0x3D,0x7F,0xA2,0xAC,0x99,0x7A,
+	0x63,0xA9,0xD1,0x6C,0x22,0xFF,0x4D,0x15,0x75,0xF3,0x82,
+	0x2A,0x9B,0x9D,0x60,0xA7,0x07,0xA5,0x5D,0x41,0x52,0x14,
+	0x46,0xF4,0x95,0x26,0x46,0x04,0x3B,0xF5,0x97,0xE4,0x9A,
+	0xBA,0x76,0x22,0x6C,0xBB,0x9B,0x74,0x45,0x9D,0x20,0x92,
+	0xBA,0x3C,0x32,0x61,0x59,0xEA,0x12,0xE7,0xD4,0x39,0xEE,
+	0xB9,0x4B,0x17,0x3B,0xE3,0x1F,0x88,0x8F,0x8C,0x8C,0x1A,
+	0xE0,0x9C,0xE4,0x59,0x72,0xFF,0xA3,0x0B,0x17,0xA7,0x3A,
+	0xD3,0x57,0xA6,0xBB,0x53,0x17,0xF7,0x75,0x26,0x2D,0x4D,
+	0x73,0x2F,0x5C,0xBA,0x24,0xDD,0x19,0xBF,0x74,0xD9,0xCA,
+	0xB4,0x85,0x4F,0x2E,0x70,0x3B,0xEF,0x89,0xEF,0xE3,0x9C,
+	0xBC,0xF2,0x89,0x39,0xE9,0xA9,0xF7,0x39,0x47,0x2D,0x99,
+	0xDB,0xD7,0x19,0x15,0x3D,0x70,0xE0,0xFD,0x0F,0xF6,0xEB,
+	0xF7,0x60,0xDF,0x7B,0xEF,0xBD,0xD7,0x39,0x3E,0x79,0xEC,
+	0x58,0xE7,0x9C,0xF4,0xF4,0x85,0x4F,0x2E,0x59,0x9C,0xBA,
+	0xC4,0xED,0x9C,0x97,0xEA,0x4E,0x9D,0xEB,0x4E,0x9D,0x47,
+	0xC6,0x2F,0x75,0x3B,0x53,0x97,0x2C,0xF5,0x3C,0xB9,0xC0,
+	0xB9,0x38,0x75,0xF1,0xD2,0xB4,0x95,0x64,0xEE,0xD2,0x25,
+	0xC4,0x66,0xA1,0xE4,0xFA,0xCE,0x10,0x5A,0x58,0xBC,0xBB,
+	0xC2,0xEC,0x53,0x1D,0xDE,0xD3,0xF5,0x11,0x72,0xF7,0x21,
+	0x52,0x44,0x7E,0xF7,0x81,0x12,0x3D,0x8E,0x9C,0xC2,0x4A,
+	0xE5,0x34,0x70,0xE3,0x24,0xA5,0xBA,0xF2,0x67,0xFC,0x17,
+	0xE1,0x1D,0x32,0x58,0x22,0x9E,0x58,0xC5,0x2E,0x92,0x7C,
+	0x7F,0xE4,0xFE,0x98,0xCA,0xB4,0xD0,0xDD,0x02,0x29,0x9A,
+	0x60,0xC8,0x3F,0xA0,0x9F,0x32,0xE6,0xFB,0x95,0xA3,0x95,
+	0xA7,0xF1,0x9F,0x87,0xEE,0x6E,0x09,0x42,0xF1,0x01,0x92,
+	0x72,0x94,0xD6,0x44,0x6C,0x1C,0x28,0x15,0xFA,0x23,0x6B,
+	0xB6,0x8F,0xD6,0x7A,0xE6,0x9F,0x2C,0x2C,0xDB,0x9B,0x4D,
+	0xF2,0xC6,0x05,0xBF,0x20,0xCD,0xDB,0x9C,0x97,0x3F,0x29,
+	0xF0,0x04,0x77,0x41,0x5F,0x4A,0x22,0x94,0x21,0xD0,0x05,
+	0x79,0xC8,0x34,0xE8,0x87,0x71,0x86,0xE4,0xA6,0xC3,0x2E,
+	0xBF,0x77,0xAF,0x7F,0xCB,0x36,0xB2,0x65,0xC2,0xF6,0x7E,
+	0x5A,0xCF,0x88,0x77,0x07,0x49,0x11,0xB9,0x11,0x31,0x92,
+	0xF2,0xCD,0x60,0x9A,0x36,0xAD,0xB0,0xFB,0x7D,0x24,0xB2,
+	0xE1,0x1F,0x44,0x50,0x24,0x9B,0xD3,0x19,0x0B,0x63,0x6C,
+	0x9F,0x9D,0x29,0x0E,0x7C,0xC4,0x73,0xB7,0x37,0x53,0x8A,
+	0xF5,0xF4,0xF4,0x69,0x42,0xE0,0x8E,0xD8,0x45,0xF3,0x3D,
+	0x5D,0x95,0x11,0xA2,0x15,0x14,0x62,0x3D,0xB0,0x88,0x92,
+	0xD5,0x39,0x78,0x89,0xC7,0x94,0xFD,0x63,0xB0,0xC5,0x57,
+	0x6A,0xF0,0x0E,0x26,0x5B,0x3D,0x4D,0xF0,0xE9,0xD9,0xB5,
+	0xD5,0xE5,0x02,0x7C,0xCF,0xD3,0x54,0x78,0x54,0xB9,0x28,
+	0x0F,0x98,0x29,0xE5,0x1B,0x53,0x24,0xE5,0xB8,0xF2,0xD5,
+	0xBB,0x2E,0xC9,0x19,0xF1,0xAC,0x41,0x86,0xBE,0xED,0xAC,
+	0x30,0x43,0xFC,0x89,0xFC,0x66,0x1B,0xB9,0xBC,0xC5,0x37,
+	0x64,0x24,0xCC,0x44,0x97,0xA2,0x44,0xD3,0xA6,0x91,0x52,
+	0xBE,0x7D,0xB4,0xB4,0x69,0x2C,0xC0,0x78,0x69,0x53,0x12,
+	0xC0,0x24,0xE9,0xA1,0xF3,0x45,0x2E,0xD3,0xA6,0x47,0xE1,
+	0x7A,0x8A,0x54,0x14,0x24,0x7A,0x50,0xD2,0x8F,0x1B,0x92,
+	0xD8,0x30,0x8F,0x36,0x17,0x0C,0x21,0xA4,0xB0,0x64,0x67,
+	0x18,0x29,0x12,0x84,0xCB,0x9F,0x4E,0x73,0xC7,0x28,0x35,
+	0x45,0x0F,0xC2,0x0C,0x7E,0x99,0x14,0x32,0x39,0x69,0x52,
+	0xFE,0x37,0x85,0x27,0x77,0xCD,0x31,0x14,0x09,0xB1,0x5A,
+	0x4F,0xA5,0xA6,0xC7,0x0C,0xE5,0x52,0xF3,0x56,0xE8,0xE0,
+	0x75,0xE5,0x50,0xE4,0x81,0x51,0xDB,0xE3,0xB4,0x9E,0x20,
+	0x4E,0x35,0xEC,0x14,0x09,0xBB,0x9E,0x96,0x54,0x44,0xC8,
+	0x2E,0x07,0xD1,0x5B,0xA4,0x69,0xDB,0xC7,0x6A,0x3D,0x93,
+	0x8A,0xA0,0x85,0x9A,0x69,0xEA,0xC1,0x83,0x93,0xA7,0xC8,
+	0x2A,0xF3,0x27,0x77,0xFA,0x86,0xF8,0x4D,0xC4,0xDD,0x2B,
+	0xCF,0xD4,0xEF,0x8C,0x5C,0x9A,0xB7,0x46,0x35,0xF5,0x66,
+	0x81,0xB2,0x3D,0xF3,0xF0,0x1E,0x6B,0x91,0x48,0x52,0x60,
+	0x97,0x0A,0xEC,0x13,0xB6,0x3E,0xDB,0xD6,0x53,0x58,0xA8,
+	0xE8,0x77,0x06,0x8B,0x75,0x92,0x4B,0xFB,0x35,0xE4,0xBD,
+	0xAC,0x9A,0xBC,0xA7,0x84,0x9C,0x2A,0xB7,0x29,0x77,0x5F,
+	0xDE,0x54,0x21,0xB7,0x22,0x05,0xB6,0x76,0xC3,0xBE,0xA0,
+	0xDB,0x9A,0x3D,0x24,0xD3,0xF0,0x1E,0x75,0x0B,0x6A,0xDD,
+	0x1B,0xE6,0xBA,0x0F,0xCC,0xAC,0x51,0x2C,0xD8,0xFD,0x0F,
+	0xED,0xD9,0x79,0x44,0x01,0x5B,0x13,0xE5,0x1A,0x68,0x26,
+	0x3E,0xD0,0x38,0xB9,0x75,0xD3,0x57,0x17,0x4C,0x69,0xD1,
+	0x57,0x9A,0xC1,0xB1,0xB6,0x6F,0x70,0xB5,0x08,0x6E,0x83,
+	0xEF,0xBA,0xE8,0xB6,0xF2,0x28,0x02,0x3D,0x0B,0x06,0x03,
+	0x0D,0x45,0xC4,0x08,0x0A,0x81,0x0B,0xAD,0x71,0x2A,0xFB,
+	0xDC,0x3A,0x92,0x94,0x7D,0xDE,0x2A,0x40,0xD1,0x8C,0xD5,
+	0xFD,0xAA,0xB6,0x27,0x6A,0x3D,0xF5,0xBF,0xB1,0x0A,0x12,
+	0xB6,0xDF,0xA6,0xF5,0x2C,0x73,0xAD,0x1A,0x34,0x53,0x1A,
+	0x56,0x90,0x95,0x99,0xEB,0xCA,0xFC,0x43,0x9C,0x3A,0x30,
+	0xDC,0x97,0xF5,0x2C,0xF1,0xB4,0x8F,0xAE,0xCE,0x88,0x84,
+	0x48,0x99,0x67,0x86,0x00,0x0E,0x9D,0xBB,0x93,0x75,0x02,
+	0xA2,0xF7,0xB3,0x7A,0xBD,0x18,0x30,0xB3,0x08,0xAD,0x80,
+	0x23,0x2C,0xF8,0xC0,0x2A,0x60,0x20,0x83,0xD0,0x53,0x5D,
+	0x64,0x20,0x01,0x7D,0x22,0x04,0xEB,0x3F,0x54,0xB9,0x7F,
+	0xF6,0x74,0x15,0xFA,0x05,0xE1,0xE8,0x68,0xCE,0x31,0x8F,
+	0xC4,0x42,0x45,0xFE,0x31,0xB9,0xAC,0x50,0x65,0x1E,0x24,
+	0x0A,0x94,0x26,0xC8,0x95,0x5B,0xB7,0xAC,0xF1,0xD7,0x36,
+	0xB9,0x69,0x44,0xEE,0x5D,0xD3,0x02,0xFF,0x44,0xED,0xB2,
+	0xFF,0xCE,0x4D,0xB1,0xFA,0x58,0xFC,0xD6,0xB7,0x37,0x41,
+	0x54,0xEF,0xCC,0x5C,0xB0,0xFE,0x21,0x5C,0x96,0x99,0x6C,
+	0x84,0x5D,0xBF,0xC5,0xAF,0xED,0xFC,0xFA,0x05,0xB8,0x86,
+	0x09,0x2B,0x33,0x85,0x30,0x92,0x15,0xF2,0x35,0x05,0xCA,
+	0x49,0xDB,0xAC,0xBD,0x8E,0xC9,0x4B,0xA9,0x3C,0x25,0x43,
+	0x3E,0xA2,0x9F,0xB2,0xC8,0x25,0xCC,0x51,0xD3,0xBA,0x6F,
+	0x89,0x3E,0xB5,0x49,0x2E,0xF3,0xC5,0x0A,0x6E,0x8B,0x3E,
+	0x8E,0x5F,0x85,0x78,0xEA,0xF2,0x24,0x88,0x63,0xA7,0x21,
+	0xB6,0x9D,0xF4,0x66,0x42,0xEC,0x3C,0x52,0xE4,0xA5,0xFA,
+	0x84,0xAB,0x72,0x19,0x4C,0x97,0x06,0x81,0xEB,0x4A,0x4B,
+	0x1C,0xCC,0x5D,0xD1,0x3A,0x12,0xE9,0x7A,0x16,0x52,0x21,
+	0x6F,0x2C,0x71,0xEF,0xD8,0x15,0x43,0x20,0x0F,0x4B,0xB5,
+	0xCA,0xAE,0x2C,0x58,0x0C,0x2B,0xF8,0xD8,0xEB,0xFA,0xD7,
+	0x2D,0x82,0x2A,0xA7,0x64,0x29,0x29,0x59,0x7D,0xAE,0xCB,
+	0x29,0x99,0x31,0x29,0x2B,0x32,0xDA,0x81,0xD1,0xE9,0xF7,
+	0x06,0x59,0xAC,0x98,0x1E,0x64,0x0B,0x3C,0x45,0x6E,0x2A,
+	0xC8,0x3A,0x5B,0xE0,0x3A,0x4B,0xB3,0x32,0xF5,0xA1,0x56,
+	0xEF,0x2A,0x88,0xC7,0x52,0xA9,0x61,0x66,0xA2,0x92,0xF2,
+	0xAC,0x7C,0x09,0xAA,0x8C,0xB4,0x2A,0x53,0x32,0x40,0x2E,
+	0x1F,0xD4,0x23,0xB1,0xDB,0x1E,0xA7,0xBE,0xE9,0x5A,0x5B,
+	0x9F,0xD7,0x5F,0xC3,0x3E,0x5B,0x95,0xAC,0x2C,0x6F,0x6C,
+	0x8C,0x47,0x4A,0xAC,0x5B,0x12,0x94,0x2B,0x78,0x8E,0xC5,
+	0xE7,0xEF,0xB7,0xB4,0x01,0xF2,0x1B,0x65,0xB5,0xE4,0x5B,
+	0x25,0x11,0xF7,0xD8,0xA8,0x60,0x43,0xA2,0x49,0xF2,0x8C,
+	0x91,0x21,0x8C,0x97,0xE7,0x49,0x2C,0x78,0xBA,0x6D,0xF2,
+	0x51,0x97,0x9E,0x40,0x58,0x0B,0xE7,0xE5,0x62,0x48,0x47,
+	0x3A,0x78,0x9F,0x34,0x5D,0xF3,0x4E,0x30,0x49,0x39,0xE5,
+	0x1E,0x13,0x98,0x4C,0xBE,0x15,0xD8,0xE5,0x90,0x92,0x5C,
+	0x8C,0x1C,0xDF,0x22,0xEF,0x6F,0x4B,0x75,0x20,0xDF,0x7A,
+	0xCC,0x16,0xF8,0x98,0x29,0xEF,0x15,0x08,0xE8,0x8B,0x81,
+	0xCD,0xAC,0x59,0x48,0xCE,0xAA,0x95,0xE5,0x92,0x32,0xC2,
+	0x18,0x0B,0xE6,0x6F,0x85,0x16,0x68,0xDD,0x52,0x52,0x36,
+	0xC2,0x28,0x90,0x86,0x44,0xA3,0x08,0xB9,0xC4,0x42,0x02,
+	0x72,0x5F,0x26,0xF8,0x12,0x03,0x54,0xDF,0xC9,0xB6,0x87,
+	0x48,0xBE,0x6B,0x16,0xCF,0x3D,0x7B,0x88,0x11,0x34,0xE2,
+	0x3C,0x3D,0x94,0xA1,0x50,0x5D,0x58,0xA9,0xC1,0x16,0x34,
+	0x05,0x13,0x45,0x25,0x51,0x8C,0x49,0xB4,0x78,0x42,0x40,
+	0x57,0x80,0xEA,0x3C,0x77,0xA2,0x38,0x17,0xA5,0x39,0xCB,
+	0x8D,0x1E,0x73,0xAB,0x8A,0x13,0x54,0x4E,0x84,0x42,0x8B,
+	0x9D,0x61,0x8E,0x79,0x27,0x8B,0x20,0xFF,0xF8,0xFC,0x06,
+	0x50,0xDE,0x09,0x46,0x67,0xE0,0x5C,0xEE,0xFE,0x7E,0x67,
+	0x02,0x67,0xB9,0x35,0xDE,0xB4,0xDC,0xA3,0xF2,0x11,0xB0,
+	0xDD,0x92,0xA9,0x68,0xB1,0x51,0xFE,0xCA,0xBA,0xCB,0x1F,
+	0xB5,0x2B,0xBF,0xBC,0x65,0x5A,0xA0,0x76,0xF2,0x24,0x98,
+	0x43,0xD8,0xDE,0x90,0x97,0xB2,0x9C,0x08,0x2C,0xB1,0x7B,
+	0xB0,0x73,0x8F,0xC0,0x95,0xC9,0x9C,0xCD,0xBC,0x77,0xA2,
+	0x18,0xA1,0x74,0x86,0x3E,0x85,0x40,0xDC,0x36,0xF0,0xED,
+	0xDB,0x3D,0x22,0xD8,0x03,0x54,0x74,0x81,0x1C,0x6C,0x8B,
+	0xF3,0x72,0x71,0x77,0x7D,0xDA,0xF5,0xBD,0x2D,0x86,0xDD,
+	0x47,0x0D,0x72,0x4B,0xEE,0xFE,0xEC,0xEB,0x2D,0x86,0xF4,
+	0x4E,0xDE,0xA1,0x22,0x64,0xBB,0xAA,0x31,0x50,0x3F,0x28,
+	0x51,0x48,0x6B,0x90,0x4F,0xE4,0x25,0x0A,0x81,0x5F,0xB2,
+	0x5B,0x5A,0x0C,0xEE,0xCE,0x05,0x23,0x44,0xE6,0xA1,0xCD,
+	0x7A,0x66,0xB0,0x54,0x12,0x03,0x65,0xF9,0x47,0xF5,0xBC,
+	0x60,0xE0,0x4A,0x8F,0x9B,0x11,0x1C,0xAB,0x6F,0xAB,0x3D,
+	0x57,0xD3,0x1B,0x9B,0x72,0x2B,0xC1,0x51,0xEF,0x6E,0x61,
+	0x2D,0xE8,0xD9,0xD7,0x3B,0x19,0xFF,0xD0,0xC2,0xF2,0xDF,
+	0x5A,0xE8,0x64,0x74,0x77,0x1F,0x34,0x56,0x48,0x37,0xB0,
+	0xBA,0xB5,0xD6,0xB6,0x0C,0x7A,0x58,0x30,0x70,0x01,0x1A,
+	0xEA,0x19,0x0C,0xFC,0xD4,0xA3,0x6D,0x91,0xEB,0x66,0x35,
+	0x41,0xD2,0x55,0x2C,0x1F,0xD6,0x8F,0xB1,0x79,0xA5,0x2C,
+	0x2B,0xDC,0x2F,0x5F,0xD2,0x5D,0x4D,0x70,0x35,0x49,0xE9,
+	0x54,0x6A,0xDE,0xB8,0xCF,0x5C,0x66,0x7C,0xDD,0x40,0x9C,
+	0xFA,0xA1,0xCB,0xFA,0x0F,0x57,0x67,0xA8,0x2C,0xBD,0x29,
+	0xDA,0x6A,0xDA,0xB9,0xC5,0xA4,0x74,0x9F,0x26,0x29,0x9D,
+	0x66,0x4A,0x49,0x1B,0xF7,0x9B,0xF5,0xDB,0xC8,0xA6,0x2F,
+	0x4D,0x1B,0xB7,0x98,0x36,0x7D,0x62,0xDA,0xB4,0xCF,0xBC,
+	0x71,0xAB,0x69,0xD3,0x36,0xD3,0xA6,0x52,0x33,0x1B,0x0C,
+	0x0C,0x62,0xCA,0x54,0xDF,0x39,0x63,0xD2,0x24,0xF9,0x84,
+	0x3C,0xBE,0xB1,0x60,0x7C,0x83,0x7C,0x29,0xEA,0x98,0xFE,
+	0x0C,0x51,0xA6,0x34,0xC4,0xF5,0xB9,0x54,0x59,0x2B,0x57,
+	0xFA,0x4A,0x44,0x83,0x48,0xBC,0xA7,0x5A,0x84,0x8A,0xA8,
+	0x60,0xDC,0xB0,0xDE,0x2D,0x70,0x20,0xD9,0x4B,0x21,0xC7,
+	0x77,0xC1,0x8A,0xC1,0xDC,0x77,0x52,0x52,0x1A,0x65,0x93,
+	0x02,0xE1,0xCB,0xD5,0x24,0x0F,0x2D,0x98,0xDF,0x3C,0x3B,
+	0x65,0x56,0x89,0x48,0xE4,0xEF,0xA7,0x32,0xDF,0x05,0x4B,
+	0xFA,0x7E,0x87,0xF2,0xCB,0xEF,0xCD,0x56,0x5C,0x97,0x84,
+	0x93,0x50,0x7F,0xC1,0x2C,0x51,0x86,0x34,0xF4,0x8A,0x6E,
+	0x23,0x71,0x2C,0x2F,0x13,0xAE,0x97,0xC1,0x39,0x2C,0xB0,
+	0xAB,0xED,0x50,0x90,0x04,0xDE,0x0A,0x6C,0xFD,0x28,0xDB,
+	0x24,0x83,0x9D,0x1E,0xEA,0x0A,0x5C,0x1D,0x1C,0xE2,0xBE,
+	0x06,0xAE,0x61,0x54,0x3F,0xBF,0x77,0x70,0x2F,0xF7,0x6D,
+	0x72,0x46,0xB3,0x7C,0x19,0xAE,0x3C,0x31,0xBE,0xAC,0x26,
+	0x70,0xAF,0xAE,0x35,0x60,0x04,0xDB,0xC4,0xC0,0xB9,0x6D,
+	0x82,0x2B,0x70,0xAA,0x9F,0x3F,0x70,0x7A,0xB0,0xE0,0xE9,
+	0x01,0xF1,0x63,0x9A,0xFC,0x4D,0xE5,0x4F,0xC2,0xF7,0x8A,
+	0xAB,0x59,0x36,0xE4,0x49,0xC3,0xA0,0x8A,0x91,0x2E,0x48,
+	0x67,0x03,0x1F,0xD4,0x4D,0x21,0x5E,0xA8,0xFB,0x1E,0xE0,
+	0xD4,0xC0,0x02,0xB8,0xAB,0xBD,0x83,0x67,0x7A,0x3A,0xF0,
+	0xDA,0x6E,0x07,0xFF,0xD3,0xCB,0x63,0x72,0x79,0x33,0x5B,
+	0x66,0xBA,0x5F,0x87,0xE1,0xDD,0xE9,0x0A,0xBC,0xE4,0x85,
+	0x1E,0x54,0x07,0xBE,0x6B,0x15,0x05,0xEA,0x02,0xBD,0x03,
+	0x1D,0x80,0x98,0xE9,0x39,0x39,0x58,0x70,0xFF,0x12,0x38,
+	0x92,0xD7,0x3B,0xF7,0xEE,0xF8,0xC0,0xE1,0x5C,0x98,0x05,
+	0xB6,0x4B,0x1F,0xE1,0x4B,0xA8,0x0E,0x63,0x55,0x9F,0xAF,
+	0x8B,0x0D,0x6E,0xFC,0xD2,0x04,0x76,0x0A,0x51,0xAB,0xAF,
+	0xE5,0x96,0xFC,0xD3,0x37,0x64,0xBB,0x89,0x78,0x06,0xED,
+	0xBE,0x8F,0xA7,0xD4,0x51,0x0D,0x11,0x8A,0x09,0xCE,0x16,
+	0xAE,0x96,0x42,0x7F,0xD4,0xB1,0x7E,0xFE,0x88,0x41,0x26,
+	0xB7,0x25,0x1E,0x3E,0x3D,0x4D,0xC3,0xE1,0xFC,0x24,0xD7,
+	0xF4,0xA9,0xF7,0x50,0x16,0x2B,0x46,0x88,0x60,0x13,0xEC,
+	0x60,0x10,0x72,0xD3,0x22,0xE5,0x8A,0xCA,0x5A,0x58,0x22,
+	0xA1,0x42,0xBF,0x5B,0xE4,0x2E,0x33,0x7A,0xD3,0x76,0x53,
+	0xA1,0xAB,0x45,0xB6,0xEF,0x31,0xF5,0x2B,0x2F,0x48,0x10,
+	0x23,0x06,0x59,0x3D,0xE1,0x9B,0x3E,0x37,0x95,0xC1,0xC9,
+	0x17,0x14,0xAA,0xDC,0xFB,0x46,0x97,0x1A,0x48,0x62,0xE0,
+	0x57,0xB9,0x9B,0x5C,0x16,0x91,0x27,0xB9,0x72,0x4D,0xF1,
+	0x30,0x89,0xBF,0x06,0xAA,0x21,0xF1,0x97,0x43,0x02,0xEF,
+	0xEB,0x09,0x96,0x8D,0xDB,0x59,0xA7,0xCD,0x1B,0xF7,0x30,
+	0x08,0x55,0xF5,0xB4,0x90,0x28,0x3F,0x54,0x1B,0xB8,0xA0,
+	0x2F,0x60,0x57,0x7B,0x4C,0xEA,0x64,0x08,0xDD,0xEF,0x40,
+	0xAC,0x3E,0x2D,0xF4,0xFB,0x49,0xAE,0x61,0x11,0xBD,0xAE,
+	0x3F,0x61,0x31,0x4B,0xAE,0xCC,0x2E,0x2B,0x31,0xF5,0x29,
+	0xDE,0x26,0x0C,0x4B,0x9C,0xDA,0xDD,0x74,0x79,0xCB,0x6C,
+	0x16,0xB5,0xA6,0xEE,0x14,0x84,0x28,0xFF,0xDE,0x12,0xD3,
+	0x26,0xBF,0x69,0x53,0xA6,0xA1,0x9F,0xFF,0xA6,0x88,0x4F,
+	0x0A,0x8B,0x0E,0xF1,0xB1,0x2D,0x41,0xF7,0x90,0xD8,0x1B,
+	0x41,0x8F,0x11,0x72,0xF3,0xBA,0x4F,0x48,0x6C,0x73,0xD0,
+	0xD3,0x5B,0x57,0x83,0xBB,0xDE,0x21,0x45,0xD9,0x44,0xDF,
+	0x18,0xDC,0xD5,0x4C,0x8A,0x6A,0x89,0xFE,0x5A,0xB0,0xCC,
+	0xE8,0x37,0x09,0xA4,0xCC,0xC8,0x12,0x82,0xBA,0x1C,0x76,
+	0x58,0x37,0xC2,0xEC,0xD4,0xAD,0x22,0xDD,0x1F,0xF2,0x17,
+	0xD6,0x6C,0x9F,0xCB,0x12,0xBF,0x74,0xF1,0xA1,0x60,0x4E,
+	0xD0,0x23,0x2A,0x57,0x7B,0xC8,0x97,0xD9,0x71,0xCF,0x23,
+	0xC1,0xD9,0x63,0xBA,0x9E,0x1E,0x2C,0x2C,0x8B,0xF0,0xC1,
+	0xE2,0x18,0xB1,0x16,0xF9,0x70,0x61,0x69,0x04,0x78,0x1A,
+	0x77,0xFB,0x08,0xC8,0x37,0xE0,0x70,0xD3,0xAF,0xA1,0xDF,
+	0x19,0xBD,0x7F,0x30,0x3E,0x3E,0x70,0xB6,0x7B,0xB2,0x72,
+	0xCE,0x77,0xCE,0xCC,0x2A,0x2D,0x12,0x52,0x77,0x07,0x83,
+	0x3B,0x4D,0x64,0x57,0x30,0x58,0x90,0xD5,0xD8,0xC9,0x04,
+	0x19,0x93,0xEB,0x06,0x34,0xE2,0x57,0x7E,0x9C,0xD5,0x03,
+	0x86,0x14,0xE5,0xC7,0xF5,0x88,0xCD,0x7E,0x2E,0xCD,0x1C,
+	0xFB,0xFA,0x73,0xCB,0xE9,0xFD,0x3D,0x89,0x1A,0x3B,0x87,
+	0x64,0x9A,0x63,0x9F,0x25,0xAB,0xE9,0xFD,0x4E,0x02,0x63,
+	0x95,0xAB,0xE5,0x92,0x22,0x12,0xAF,0xF5,0x4C,0x13,0x65,
+	0x87,0xBE,0x90,0x40,0x01,0x30,0x33,0x33,0xFB,0xA0,0x51,
+	0x7E,0x9E,0xE4,0xE7,0x96,0x40,0xFB,0x1F,0x35,0x66,0x5F,
+	0x27,0x42,0x7A,0xB4,0x77,0xC8,0x20,0x89,0xA6,0x45,0x7A,
+	0xAF,0x27,0x79,0xA4,0xCF,0xED,0x01,0x93,0xF7,0x7A,0xAF,
+	0xB4,0xF0,0xCF,0x3B,0xE4,0x56,0xF7,0x0B,0xE6,0xAD,0xCD,
+	0x32,0xBC,0xA6,0x8F,0x6B,0x04,0x27,0x0B,0x0E,0xD2,0x7B,
+	0xDD,0x99,0x26,0x7D,0x6E,0x08,0xFC,0xE8,0x6D,0xEA,0x90,
+	0x51,0x1B,0x38,0x9E,0xDB,0x08,0x1E,0xF7,0x07,0x16,0x98,
+	0xB7,0x40,0x7C,0x9A,0xA1,0xA6,0x9B,0x92,0xF4,0x0D,0xC1,
+	0x69,0x01,0x31,0xD2,0x7F,0xCB,0x39,0x48,0xE2,0x16,0x33,
+	0x3C,0xF6,0xE7,0xE0,0xF2,0x58,0x03,0x25,0xB0,0xBD,0x5D,
+	0xCD,0xB1,0x46,0x92,0x16,0x53,0xEA,0x6A,0x21,0x51,0x55,
+	0xB0,0x79,0x62,0x8C,0xAF,0x1A,0x32,0x62,0x95,0x01,0x2F,
+	0x1B,0x60,0xF6,0x22,0x73,0x1A,0x3C,0x83,0xBD,0x59,0x2D,
+	0xC4,0x3D,0x07,0x42,0x65,0x01,0xE4,0x41,0xEE,0x05,0x4C,
+	0x33,0x70,0xB8,0xF5,0x24,0xCE,0x26,0xA0,0xCC,0xD5,0x6C,
+	0x24,0x81,0x3D,0xF2,0x80,0x57,0x0D,0xCA,0x80,0x17,0x0D,
+	0x81,0x83,0x51,0x7E,0x86,0x9B,0x5E,0x35,0x04,0xFC,0xCA,
+	0x58,0x8B,0x0C,0x55,0x45,0x5F,0x4B,0x73,0x80,0xFF,0xBF,
+	0x0C,0x95,0xCC,0x30,0xC3,0x79,0xD1,0xEF,0xE9,0x19,0x63,
+	0x7F,0xD5,0xB0,0xDC,0xA0,0xB8,0xA5,0xC0,0x1B,0x32,0x5C,
+	0x82,0x75,0x36,0xEA,0x03,0x99,0xEB,0x7B,0x15,0x1A,0x10,
+	0xEA,0xDC,0x30,0x88,0xC0,0x9B,0x45,0x4E,0xA2,0x8B,0x56,
+	0xE8,0x3E,0xEF,0x7C,0xA7,0x02,0xF0,0x59,0x29,0x3F,0x17,
+	0x4C,0xF9,0xB9,0xA8,0x27,0x29,0x75,0x05,0x26,0xE9,0x5D,
+	0xAC,0x4A,0xCA,0xB9,0xA8,0xAA,0x31,0x63,0x14,0x57,0xA3,
+	0x50,0xDD,0xAE,0xA2,0xD0,0x0F,0xFB,0x2A,0x8E,0x45,0x10,
+	0xE8,0x57,0x52,0x91,0x91,0xE8,0xFB,0x42,0xA7,0xB1,0x39,
+	0xDE,0x3E,0x52,0xEB,0x79,0xDB,0x31,0x68,0xF9,0xD8,0x2A,
+	0x29,0xAA,0x24,0xD0,0x8E,0x6D,0xBB,0x31,0xEC,0xC0,0x50,
+	0x58,0xC2,0x3E,0x41,0xC4,0x6E,0x56,0xF0,0x12,0x2F,0x42,
+	0x89,0x89,0x72,0xF1,0xA8,0xA8,0x63,0x85,0xC5,0x11,0xCA,
+	0x04,0x2A,0x57,0xC7,0x47,0x1F,0x49,0x87,0xE5,0x86,0x2A,
+	0xFB,0x1C,0x29,0xF4,0xCB,0x07,0xDB,0x4A,0xE8,0x6F,0x06,
+	0x79,0x33,0xED,0x89,0x3E,0x2B,0x74,0x1A,0x06,0x89,0x24,
+	0xF0,0xAD,0x27,0xA3,0x1A,0xA2,0xCA,0x21,0xF2,0xB3,0x0D,
+	0xBC,0x32,0x08,0x43,0x0A,0x65,0xCD,0x45,0xC8,0x0E,0xB9,
+	0x38,0x10,0x60,0x0B,0x2C,0x7A,0x3A,0xE4,0x94,0xBB,0x67,
+	0xED,0xCA,0x16,0xD9,0x0E,0x0C,0xB2,0xD3,0xA8,0xDF,0x3D,
+	0x5E,0x3E,0x98,0x73,0x0C,0x92,0xE2,0x26,0x88,0xAD,0x1E,
+	0x38,0x91,0xB2,0x4D,0x5F,0x08,0x87,0xD9,0x08,0xA5,0x47,
+	0xE0,0x2C,0xAC,0x45,0x5F,0x38,0xE6,0x44,0xD7,0xA7,0xDF,
+	0x2B,0x97,0x8C,0x86,0xAE,0x41,0x48,0x9C,0x2A,0xC4,0x74,
+	0x1A,0x28,0x79,0x6E,0x8B,0xA0,0x89,0x14,0x4E,0xE3,0xE3,
+	0xDC,0x21,0x7D,0x2A,0x62,0x5C,0xCD,0xE9,0xE6,0x00,0x8D,
+	0x0B,0x7C,0x57,0xB7,0x89,0x7C,0xC6,0x9C,0x34,0x77,0x37,
+	0xC7,0xA2,0xAA,0xAA,0x7F,0x8A,0x90,0x97,0xDF,0x37,0x55,
+	0xBE,0x1C,0x55,0xAE,0xFB,0x42,0xD9,0xD9,0x51,0xDF,0xD0,
+	0x72,0x73,0x98,0xAD,0x75,0x99,0xA3,0x2B,0xDC,0xD0,0x88,
+	0x67,0x56,0x9B,0x80,0x55,0x3B,0x4A,0xB1,0xC3,0x01,0xAB,
+	0xB8,0x6D,0xC2,0x8A,0x71,0xF8,0xD0,0x9B,0xD6,0x9E,0x30,
+	0x67,0x36,0x81,0x16,0xFA,0x85,0xE2,0x08,0x79,0xAC,0xC8,
+	0x83,0x35,0x65,0xFD,0xB0,0x16,0xFD,0x99,0xEA,0x0F,0xD5,
+	0x6F,0x0B,0xB2,0xC3,0x03,0xCC,0x45,0x60,0x04,0xEB,0x69,
+	0x5C,0x20,0xAF,0xD0,0xBF,0x7D,0x14,0x54,0x51,0x55,0x97,
+	0x19,0x54,0xF8,0xD0,0xCD,0x6D,0x1C,0x18,0xA6,0xB9,0xB0,
+	0xB4,0xF5,0xBA,0xDC,0xDD,0x8E,0xB5,0x0A,0xE3,0x47,0x86,
+	0x7C,0x24,0x10,0x68,0xBB,0x01,0xA4,0xB2,0x23,0xB1,0x1E,
+	0xD2,0x66,0xD8,0x49,0xCA,0x00,0x36,0x4A,0xD8,0xD8,0x4A,
+	0xE2,0x80,0x08,0x65,0x75,0x7F,0x18,0x83,0xC1,0x17,0xEC,
+	0xE2,0x9E,0x28,0x83,0x85,0xB7,0xF0,0x01,0xB8,0x5A,0xE2,
+	0x23,0xF2,0xC2,0x0B,0x8B,0x5D,0x11,0xB9,0x53,0x3B,0xFB,
+	0xAE,0x87,0x67,0xD6,0xED,0x09,0x27,0x72,0x89,0x70,0x75,
+	0x23,0x2F,0xEA,0x8F,0x88,0x59,0xFE,0x60,0x7A,0x3B,0xE8,
+	0xBE,0x37,0x36,0xE8,0x36,0x40,0x1A,0xBA,0xCA,0x92,0x08,
+	0x11,0x26,0xA2,0x2C,0xF1,0xC1,0x70,0x02,0x9F,0xFD,0xBB,
+	0x90,0x08,0x39,0x71,0x00,0x6F,0xBF,0xEE,0xED,0x1B,0x49,
+	0x45,0x9D,0x04,0x7D,0x7E,0xC8,0xB4,0xB6,0x0C,0xB8,0x91,
+	0x24,0x4D,0x9A,0xCC,0x92,0xE0,0xDD,0x63,0xA0,0xD6,0x02,
+	0x97,0x59,0x27,0x57,0x77,0xCD,0x24,0xEC,0xE2,0x11,0xCB,
+	0xAE,0xBE,0x84,0xDD,0xDC,0x61,0xC4,0xBB,0x70,0x62,0xF1,
+	0xF4,0xDB,0xF5,0x2E,0x27,0x26,0x5C,0x89,0xF2,0xC3,0x29,
+	0x4B,0x4C,0x02,0x22,0x49,0x3F,0x1C,0xEA,0xDB,0x67,0x94,
+	0x4B,0x59,0x82,0xF8,0x00,0x94,0x60,0x0A,0xCD,0x21,0xBB,
+	0xFE,0x4A,0x21,0x1B,0xBB,0x55,0xED,0xD3,0x50,0xC8,0x94,
+	0x98,0x22,0xB3,0xAF,0x21,0x57,0x7C,0xD7,0x83,0xEE,0x9E,
+	0xBB,0xEF,0x20,0x05,0x53,0xA6,0x41,0xA7,0x3B,0x5A,0x59,
+	0xF1,0x70,0xB8,0xDA,0x13,0x52,0x44,0x89,0xDE,0xFD,0x4A,
+	0x51,0x28,0xD1,0xC7,0x5D,0xA9,0xEB,0x20,0x28,0xAE,0x69,
+	0xB1,0xE3,0x66,0xB8,0x0D,0xB1,0x33,0xC6,0x79,0x0C,0xBB,
+	0x60,0x3D,0x44,0x88,0x40,0x53,0x32,0x21,0x40,0x74,0xFF,
+	0x0C,0x62,0xF4,0x0C,0x65,0xCA,0x4C,0x83,0x83,0x54,0x9F,
+	0xFA,0x4C,0xF2,0xFD,0xEC,0xAC,0xD6,0x85,0x0A,0xEA,0x7A,
+	0x22,0xD2,0xF5,0x78,0xA0,0xEB,0x2E,0x88,0xEF,0xF5,0x60,
+	0x43,0xE5,0x7A,0xB6,0x75,0x77,0x18,0x31,0x3C,0x4F,0x7C,
+	0x55,0x04,0xA8,0x8F,0x58,0x36,0x2E,0xD7,0x2B,0x29,0x6B,
+	0xF4,0x89,0x10,0x25,0xE2,0x98,0x53,0x95,0xC0,0x8D,0x36,
+	0xC8,0x25,0x90,0x4A,0x94,0xE9,0x6B,0xAF,0x43,0x4E,0x7C,
+	0x9D,0x66,0xAD,0x11,0xD4,0x31,0x63,0x46,0x4F,0x98,0x90,
+	0x53,0x95,0x65,0x54,0x0C,0xB2,0x29,0x70,0x11,0xC6,0x21,
+	0x4B,0xD0,0xFD,0x82,0xF1,0xCF,0xC2,0x98,0x56,0x14,0xA4,
+	0xB8,0x01,0x32,0x94,0x29,0xCF,0x25,0x41,0xC7,0x07,0xDA,
+	0xE4,0x32,0x16,0x1F,0x9E,0x50,0x5C,0x7F,0xFE,0x4C,0xD2,
+	0xCF,0x5E,0x52,0x3A,0x6D,0x30,0x40,0xCF,0x7C,0x25,0x61,
+	0xD5,0x7A,0x41,0x4A,0x2E,0x64,0x26,0xE5,0x02,0x34,0x7C,
+	0x89,0x4D,0xD0,0xFD,0x76,0x48,0xDF,0x15,0xA0,0xAE,0xEB,
+	0x9E,0x66,0x96,0x38,0xE9,0x67,0x6E,0x04,0x33,0x16,0x05,
+	0x33,0x96,0x04,0x33,0x16,0x04,0x33,0xE6,0x07,0x33,0x32,
+	0x0B,0x5C,0xB9,0x7C,0xE2,0xEC,0x7A,0xAE,0x63,0x9D,0x6F,
+	0x9F,0x5D,0x71,0xB9,0xF5,0x17,0x45,0x68,0xA8,0x40,0x04,
+	0x57,0xCA,0x32,0xF9,0xBA,0x8F,0x6E,0xB0,0x73,0xC3,0x6B,
+	0xA6,0x32,0xE3,0x66,0xC3,0xD8,0x70,0x95,0x1D,0x35,0x73,
+	0x2B,0x58,0x4C,0x96,0x4F,0xC4,0xB3,0x9C,0xED,0x4A,0xD4,
+	0x31,0x7E,0xB4,0x64,0x09,0xED,0x11,0x76,0xC0,0xFA,0x7D,
+	0xB6,0xD3,0x76,0x94,0x9A,0x32,0xD5,0x1B,0xE1,0x93,0x1A,
+	0xF7,0x3C,0x2E,0x79,0xED,0x3E,0x89,0x65,0xE6,0x2C,0xA8,
+	0x6E,0xDA,0x65,0x9A,0xCD,0x0E,0xB5,0x45,0x56,0xA2,0xBB,
+	0x9B,0x80,0x33,0x8C,0x5D,0x3D,0xD5,0xC4,0x5D,0xF1,0x3D,
+	0x1B,0x8B,0x4C,0xB2,0x07,0x92,0x24,0x39,0x53,0x2A,0x4B,
+	0x90,0x20,0x62,0x0F,0x29,0x32,0x29,0x99,0x52,0x69,0x82,
+	0x85,0x00,0xF8,0x4A,0xED,0x65,0x09,0x46,0xC8,0x98,0xFE,
+	0xC6,0x6E,0x85,0x6C,0xA5,0x90,0x36,0x7E,0xFF,0x6B,0xE0,
+	0xA0,0x5C,0x16,0x28,0xC3,0xFB,0xBB,0x90,0x53,0x7D,0x46,
+	0xE5,0xA3,0xD5,0xA7,0xF6,0x3E,0x2E,0xF5,0x81,0x34,0x4A,
+	0xE9,0x5E,0x64,0x12,0xBE,0x07,0x47,0x12,0xA9,0x3C,0xA2,
+	0xCC,0x16,0xF3,0x12,0x4D,0xB0,0xD2,0x9B,0xE3,0x3C,0xD2,
+	0x66,0x33,0x8C,0xA6,0x46,0xB7,0x87,0x0D,0x93,0x2F,0x07,
+	0x4E,0x46,0x5F,0x4F,0x83,0x80,0xF3,0x81,0x94,0x0E,0xDE,
+	0x33,0xA0,0xC3,0x41,0x93,0x7B,0x72,0x76,0x0E,0xDD,0x1C,
+	0xE5,0xD7,0x37,0x05,0xEB,0x5C,0x61,0xB7,0xDE,0x3C,0x2B,
+	0x2D,0x03,0xA7,0x4F,0x1A,0x46,0x98,0xC2,0xE0,0x8C,0xB1,
+	0x88,0x28,0x33,0x25,0xDF,0x6A,0x38,0xE6,0xC4,0x78,0xE7,
+	0x19,0x7F,0x01,0xAE,0xD3,0x13,0xA5,0x8C,0x10,0xD7,0xCB,
+	0xD5,0x21,0xAA,0x3B,0x5C,0xAE,0x94,0x55,0x68,0xF3,0xEA,
+	0x11,0x65,0x84,0xF9,0xEA,0x31,0xDF,0x11,0xA2,0x8F,0xB1,
+	0xF8,0x9A,0x82,0x1E,0x3B,0x33,0xCC,0x10,0xA8,0x08,0xCE,
+	0x08,0x63,0x8D,0x4E,0xA8,0x43,0x49,0x94,0xCA,0x46,0x88,
+	0x30,0x64,0xC9,0x07,0x21,0xC6,0x13,0x02,0xAC,0x86,0x44,
+	0xB3,0xE0,0x49,0x01,0xAF,0x70,0x33,0xBA,0x78,0xE7,0x99,
+	0xA0,0x09,0xA3,0xE8,0x3E,0x04,0xD3,0xA1,0x24,0xB0,0x7B,
+	0x99,0xFB,0xE4,0x32,0x65,0xAC,0x08,0xFE,0x61,0x37,0x2F,
+	0xF7,0x85,0x7C,0x50,0x6E,0x82,0xC6,0xF4,0x1D,0x0E,0x3C,
+	0xBF,0xD9,0x60,0xCB,0xB3,0x26,0x84,0xEF,0xFB,0x54,0x06,
+	0x6A,0x60,0xC2,0x1B,0x60,0xC2,0x79,0xC3,0xBA,0xE3,0x62,
+	0xE0,0x47,0xA6,0xFA,0x83,0x83,0x29,0xFE,0x05,0x14,0x03,
+	0x2F,0xB2,0xD5,0xD6,0xAB,0x1D,0xBE,0xD5,0x16,0xE2,0xB1,
+	0xC2,0x84,0x6D,0x16,0xDD,0x71,0x65,0x89,0x96,0x3F,0x13,
+	0x25,0xD1,0xA2,0xAB,0x8D,0x70,0x84,0x92,0x47,0x48,0x6D,
+	0x07,0xA9,0x81,0x70,0x0C,0x6B,0x2C,0x48,0xB4,0x02,0xCD,
+	0x4E,0x6E,0x20,0x01,0x55,0x81,0xF0,0x73,0x18,0x5C,0xB2,
+	0xD1,0x98,0xC0,0x50,0x36,0x4B,0x6E,0x13,0x08,0xE2,0x20,
+	0xD5,0x05,0x20,0x62,0xE0,0x6F,0x70,0x2E,0x32,0x07,0x6A,
+	0xBC,0x43,0x5E,0x33,0x10,0x1E,0xF9,0x27,0x25,0x7D,0x1D,
+	0x30,0x4E,0x9D,0x32,0x6A,0x44,0xC2,0x04,0xD8,0x08,0xBE,
+	0x7D,0x12,0xB3,0x1F,0x18,0x5C,0xB2,0x32,0xE0,0x80,0x19,
+	0xFC,0x60,0xFF,0xE8,0xD2,0xE5,0x66,0x25,0x5C,0xB8,0x14,
+	0x5D,0xB2,0x3C,0x5E,0xBE,0xAC,0xB8,0x45,0x60,0x5A,0x6F,
+	0x61,0xF6,0x85,0x36,0xFF,0xC0,0x9A,0x88,0x61,0xDB,0xD3,
+	0x91,0xC5,0x5F,0x90,0x85,0x44,0x97,0x66,0x3C,0xC6,0x42,
+	0xEC,0xE5,0x40,0x52,0xE0,0xD6,0x0A,0xEF,0xF9,0x77,0x15,
+	0x76,0xC0,0x0A,0x55,0x60,0xED,0x45,0x56,0xC6,0xDF,0x59,
+	0xD0,0xD6,0x9F,0x11,0x64,0xE8,0x53,0x0C,0xD4,0x9D,0x1E,
+	0xA2,0x8C,0xB0,0xB0,0x0C,0x61,0xB9,0x9D,0x59,0x74,0x6B,
+	0xC1,0xA3,0x81,0x37,0x58,0xB0,0x3F,0x0F,0x03,0xE0,0x79,
+	0xA4,0x7B,0x06,0xBB,0xD1,0xCA,0x8C,0xDB,0x37,0xE4,0x73,
+	0x13,0x7B,0xD4,0xA0,0xB2,0x47,0x0D,0x47,0x23,0x3B,0x6D,
+	0x37,0x29,0x03,0x3E,0x37,0x55,0x36,0x09,0x87,0x59,0xB6,
+	0x4C,0xF5,0xD0,0x20,0x3F,0x0E,0x9C,0xE4,0x7A,0x6E,0x23,
+	0x94,0xD6,0x1B,0x5B,0x98,0xDB,0x1A,0x7B,0x95,0x65,0xBD,
+	0xEE,0xCE,0x4C,0x0C,0xA5,0x21,0x15,0x95,0xBB,0x7F,0x6E,
+	0x82,0x74,0x3E,0xCA,0xCF,0xB7,0x12,0x9C,0xEC,0xAF,0xC2,
+	0x24,0xFE,0xE1,0x91,0xCF,0x6F,0xCF,0x1A,0x8A,0xE5,0x29,
+	0x2D,0x72,0x05,0x64,0x26,0x84,0x24,0xE5,0xD7,0xF4,0x60,
+	0x11,0xB6,0xDC,0xBD,0x40,0xDE,0x0F,0x39,0x4F,0xF4,0xFE,
+	0xB4,0xD9,0x90,0xF7,0x9C,0x94,0x8B,0x61,0x7D,0x7D,0xD7,
+	0x8C,0xE9,0x74,0xA7,0x91,0x44,0x17,0x2F,0x1F,0xAD,0x24,
+	0x9B,0x95,0x59,0xC6,0xE8,0xCA,0x0C,0x08,0x1A,0xBE,0xD2,
+	0x30,0xC5,0x04,0xCC,0x71,0x72,0xB2,0xB9,0xCF,0xFE,0x60,
+	0x82,0x95,0x25,0x49,0xD3,0xE5,0x13,0xC2,0x21,0x19,0x4E,
+	0xA8,0x92,0xB2,0x1A,0xB2,0x39,0x39,0x13,0x4E,0xCC,0xCC,
+	0x02,0x64,0x0F,0xA4,0x55,0xB0,0x89,0xBD,0x0E,0x81,0xDD,
+	0x83,0x4A,0x69,0x06,0xFB,0x65,0xAD,0xB2,0xA3,0x08,0x46,
+	0x2B,0x65,0x56,0x38,0xEC,0xB3,0xCD,0xD1,0x15,0x19,0xA2,
+	0x5C,0xA2,0xCC,0x96,0xA2,0x2F,0x7B,0x36,0x30,0x23,0x4F,
+	0xB6,0x30,0xBD,0xC0,0xE1,0xE0,0x38,0xBB,0xB2,0x5C,0x84,
+	0xAA,0x95,0xD5,0x12,0x38,0x82,0xC0,0xE7,0x6D,0x23,0x31,
+	0xB3,0xFB,0xF0,0xD0,0xD7,0x0A,0x3E,0x8A,0x62,0x58,0x5B,
+	0x5A,0xB7,0x9C,0xF8,0x2E,0x88,0x0D,0x92,0xE0,0xFE,0x55,
+	0x09,0x97,0x53,0x5A,0xE0,0xAC,0x26,0x5F,0x16,0xAA,0x1B,
+	0x4C,0x82,0x67,0x09,0xED,0x2C,0x87,0xC7,0xCC,0x32,0x7A,
+	0x28,0xAF,0x4A,0x84,0x96,0xE4,0x59,0x92,0x0C,0x17,0x59,
+	0x2D,0xAC,0x09,0xE8,0x75,0x93,0x22,0xD1,0x8E,0x72,0x56,
+	0x73,0xF4,0x61,0x4F,0x2C,0x35,0xB0,0x13,0x8C,0x21,0x66,
+	0x2A,0x2B,0xB0,0xDA,0xA8,0x64,0x34,0x03,0x1D,0x9C,0x60,
+	0x8D,0x59,0x6E,0x4C,0x37,0xC7,0x24,0x9A,0x33,0xA8,0x9C,
+	0x68,0x06,0x16,0x9C,0xF8,0xD9,0xA5,0x45,0xDE,0xCF,0x7B,
+	0x81,0x43,0xAA,0xDB,0x40,0xE4,0x70,0x36,0x5F,0x27,0xD2,
+	0x68,0xDD,0x33,0x24,0x66,0xB9,0xB8,0xFC,0x1D,0x18,0x26,
+	0x90,0xAF,0x41,0x11,0x65,0xB6,0x5D,0xAE,0x89,0x83,0x66,
+	0x65,0x57,0xA3,0x92,0x60,0x65,0x47,0x9D,0xA6,0xAB,0x19,
+	0x8D,0x72,0x49,0x74,0x4D,0x7A,0x6F,0xC8,0x4A,0xFA,0xD4,
+	0x54,0x9E,0x8A,0xAE,0xC9,0x48,0x52,0xEE,0x10,0x2E,0x2B,
+	0xA6,0xCD,0x02,0x0C,0xEB,0xF1,0x20,0x73,0xFA,0xA6,0xDE,
+	0x2D,0x82,0x3A,0xDA,0x13,0xE0,0x75,0xB0,0xCA,0x1F,0x84,
+	0xFF,0xA7,0xD9,0x94,0x9D,0x48,0x3B,0x8E,0xF0,0x1D,0x40,
+	0xA0,0x0E,0xAF,0xCB,0xE5,0xEB,0x4A,0x62,0x7B,0x9F,0x1A,
+	0x06,0x96,0x9E,0x5B,0xD7,0x2D,0x08,0xC9,0x7A,0xE0,0x23,
+	0x5E,0x36,0x3C,0x50,0xCA,0x46,0x9D,0x60,0x57,0xB2,0x9A,
+	0xE5,0x99,0x30,0xAB,0x22,0x5B,0xA6,0xE5,0x62,0x5D,0xD7,
+	0xE0,0x64,0xF0,0x9B,0xA5,0x4A,0xF7,0x17,0x0D,0x51,0x41,
+	0x70,0x94,0xA1,0x50,0x8D,0x49,0x3E,0xC9,0x2A,0xBD,0xC8,
+	0xB4,0x66,0x4A,0x39,0x41,0x77,0x2C,0x28,0xE7,0x1C,0xF3,
+	0x0C,0x2E,0xC8,0x0C,0x53,0xEE,0xF0,0x95,0x76,0x2A,0x1B,
+	0xD1,0x44,0x48,0xD9,0x88,0x4B,0xEC,0xA3,0x81,0x7D,0x34,
+	0xC2,0x46,0xCF,0x6C,0x96,0x33,0x5B,0x7C,0x81,0x4E,0x72,
+	0x66,0xBD,0x0C,0xE3,0x90,0xEB,0xCB,0x4C,0xEC,0x6E,0x08,
+	0x1C,0xD1,0x58,0x1A,0xEC,0x87,0xC6,0x02,0x7B,0x27,0x6F,
+	0x84,0x9D,0xE8,0x07,0xAF,0xA8,0x2A,0xB3,0xDB,0x2B,0x26,
+	0xA1,0x06,0x8E,0x6E,0x31,0xC6,0x01,0x92,0x47,0x52,0x4C,
+	0xEC,0x10,0xC5,0x6F,0xA6,0xC1,0x6E,0x91,0x4B,0x7C,0x25,
+	0x14,0x96,0x32,0xBA,0x84,0xA5,0x9A,0x60,0xE2,0xFA,0xBE,
+	0x60,0x74,0x45,0xDA,0x9D,0x30,0x73,0x9D,0x7D,0x25,0xDD,
+	0x63,0x3A,0xA7,0xD5,0x6D,0x7C,0xDD,0xC0,0xA4,0x72,0x09,
+	0x5B,0xF1,0xCE,0x10,0xB6,0xBF,0x07,0xC7,0x01,0x9A,0x7D,
+	0x4A,0x02,0xC7,0x26,0x63,0x1A,0xB4,0x71,0x0B,0x6B,0x2C,
+	0xC4,0x37,0x64,0x80,0xD4,0xE2,0x31,0xF3,0x64,0xA9,0x6E,
+	0x71,0xB0,0xC0,0xD5,0x02,0x67,0x28,0x10,0x40,0xA8,0x6E,
+	0xA1,0xDD,0x07,0x48,0x31,0xF0,0x3F,0x9D,0xDD,0x43,0x87,
+	0x80,0xE0,0x08,0x65,0xD3,0xFE,0x2D,0xA4,0x1D,0x8D,0xC1,
+	0xE5,0x5A,0xB4,0x9A,0x51,0xDE,0x47,0x05,0xAB,0x2A,0x48,
+	0x6C,0x89,0xAE,0x59,0xFE,0x0F,0x36,0x4B,0x6C,0xF3,0x1C,
+	0x73,0x1B,0x99,0xC7,0xF7,0x0C,0x86,0xAB,0xF1,0x8A,0xA9,
+	0x20,0xB3,0x45,0xA8,0x89,0x2E,0xF3,0xC4,0xFB,0x5C,0x2D,
+	0x10,0x1D,0xC0,0x94,0x05,0x13,0xCD,0x6A,0x29,0x33,0x04,
+	0x59,0x46,0x67,0x15,0x64,0xE6,0x15,0x21,0xB6,0x8E,0x10,
+	0x83,0x89,0x56,0xFD,0xAE,0xEB,0xEC,0xB0,0x96,0x16,0x8C,
+	0xBE,0x9C,0x61,0x60,0xD3,0xFC,0x59,0xEB,0x3C,0x40,0x36,
+	0xBB,0x2D,0x70,0x01,0x0A,0xC4,0xDE,0x41,0xD2,0x69,0xDD,
+	0x84,0xA0,0x2C,0xC9,0xF5,0xE0,0x6F,0xC0,0x28,0xCB,0xA0,
+	0x52,0xD6,0x70,0x60,0x5B,0x7E,0xA7,0x37,0x0D,0x6A,0xCC,
+	0xBE,0xF4,0x0E,0x91,0xFB,0xAE,0xD6,0xC4,0x18,0x87,0x48,
+	0xCB,0xCD,0xF9,0x15,0x31,0xC6,0x37,0x0D,0x6E,0x41,0xB5,
+	0xCF,0x28,0x3A,0xD6,0x0D,0x02,0xA3,0xAE,0x5E,0x98,0xEC,
+	0x9E,0x33,0xF7,0x69,0xE7,0x84,0x8C,0xD4,0xB4,0xF9,0x8B,
+	0x96,0x2E,0xEF,0x49,0x5A,0xF7,0x4F,0x38,0xBB,0xC1,0xF0,
+	0x8D,0x22,0xC9,0xAE,0x73,0x10,0xA1,0x64,0xD7,0x05,0xF0,
+	0xD2,0xB2,0xAB,0x1E,0x22,0xB3,0xEC,0xBA,0x04,0x81,0x40,
+	0x76,0x35,0x80,0x47,0xE3,0x46,0x0A,0x9C,0x26,0xC5,0x50,
+	0x30,0xE5,0x1C,0x1C,0x89,0x14,0xD7,0xCF,0xFA,0x68,0x8B,
+	0xE2,0x3A,0x27,0x9B,0x14,0xD7,0x05,0x39,0x51,0x54,0x5C,
+	0xF5,0x72,0x22,0xA4,0xD3,0x97,0xE4,0x44,0xA3,0xE2,0x6A,
+	0x60,0xFB,0xC2,0xD5,0x08,0x5B,0x02,0x3A,0x7F,0x17,0x1C,
+	0x29,0x21,0x1E,0xB8,0x9A,0xE4,0x04,0x23,0xBF,0xF9,0xC0,
+	0x8A,0xF1,0x5B,0x02,0x13,0xA7,0xB4,0xED,0x61,0xF6,0x20,
+	0x77,0x7C,0xA3,0x1E,0x62,0x81,0xAC,0x63,0x5E,0x10,0xA4,
+	0xB0,0x81,0xF0,0x9E,0xD2,0x37,0xCA,0x78,0x33,0x64,0xF9,
+	0x87,0xBB,0x17,0xD6,0xB4,0xA5,0x13,0x3D,0xA0,0x6C,0x89,
+	0x48,0xEA,0x2E,0x87,0xDC,0x72,0x4B,0xB8,0x1F,0xBF,0x25,
+	0x3C,0x21,0xB7,0xE2,0xC6,0xA5,0x4F,0x9A,0x61,0xBB,0x5E,
+	0x1B,0xC6,0xEF,0x0E,0xB7,0x0E,0xD3,0xC2,0xEE,0xBC,0x36,
+	0xCB,0x29,0x8D,0xF2,0x37,0x65,0xAE,0x06,0x08,0xB0,0x78,
+	0x2F,0xA5,0x11,0xFA,0x73,0x97,0x8F,0x14,0xA4,0x34,0xF0,
+	0x1B,0x38,0xA1,0x53,0x1A,0xA1,0xFD,0x83,0x21,0xEC,0x64,
+	0x01,0x83,0x88,0x31,0x6E,0x35,0xA4,0x8F,0x6A,0x70,0x35,
+	0x53,0xF7,0xC3,0x40,0x32,0x33,0xB8,0x5F,0x3F,0xCF,0xA4,
+	0x11,0x0D,0xAE,0x1B,0x92,0xDB,0x08,0x22,0xA7,0x67,0x28,
+	0x7C,0xC6,0xB9,0xC3,0x0B,0xA6,0xB4,0x28,0x29,0x70,0xAC,
+	0x61,0x0F,0x06,0x20,0x15,0x2F,0xCE,0xA9,0xCA,0x7C,0xC8,
+	0x97,0xD5,0x10,0xF4,0xC4,0x72,0xAD,0xE8,0x80,0x1D,0x0E,
+	0x59,0x43,0x98,0x8C,0xE5,0x9B,0x9B,0xEB,0xC0,0x43,0xE3,
+	0x24,0x40,0xA9,0x56,0xBE,0x89,0x04,0xCE,0xDE,0xA4,0xE0,
+	0xE0,0x23,0x5E,0x0C,0x1C,0x0F,0x8C,0xD6,0x63,0xCE,0x30,
+	0xFB,0x8F,0x15,0x89,0xE7,0xA0,0x60,0x50,0xBA,0x29,0x89,
+	0x2D,0xEC,0xC6,0x05,0x4B,0x97,0x8B,0xBC,0x82,0xD2,0xA9,
+	0xC6,0x70,0xB5,0xAA,0x67,0x45,0x54,0xD5,0x66,0xAF,0x87,
+	0x42,0x5A,0xC1,0xC6,0x52,0xAF,0xCF,0x65,0xBD,0x7C,0xB3,
+	0x6D,0x0C,0x73,0x7D,0x59,0x8D,0xC4,0xB3,0x00,0x48,0x5D,
+	0x0C,0xE9,0x3D,0x18,0x3C,0x2C,0x5C,0xF5,0x0E,0x61,0xD9,
+	0xA0,0xF7,0x90,0xD3,0x3B,0xBF,0x69,0xB5,0x2F,0xAB,0x49,
+	0xF4,0x50,0xEF,0x01,0xCA,0xEF,0xFA,0xC0,0x85,0x00,0x17,
+	0x02,0xBB,0x10,0xA1,0xFB,0x90,0xD4,0x78,0x0F,0x78,0xE5,
+	0x0A,0x6B,0x1C,0x8C,0x9B,0xBA,0x5D,0xF0,0x29,0xBA,0x45,
+	0xAC,0x66,0x37,0x9B,0xA9,0xBA,0x87,0x82,0x6D,0xA3,0xAB,
+	0xEB,0x71,0xF3,0x32,0xA7,0x6A,0x15,0xAD,0x1B,0x18,0x54,
+	0xA6,0x34,0xF1,0x4E,0xC1,0xEC,0xEA,0x4B,0xCD,0xFC,0x19,
+	0xAE,0x3B,0x58,0xD7,0xD2,0x92,0x3D,0x64,0x85,0x81,0x88,
+	0x9E,0x5D,0x81,0x1D,0xEC,0x2E,0x66,0x41,0x8A,0x45,0x31,
+	0x25,0x41,0x1A,0x1F,0xCC,0x30,0x07,0x33,0x8C,0x10,0x27,
+	0x74,0x23,0x44,0x7D,0x33,0x3E,0xA8,0xC7,0x34,0xAB,0xC0,
+	0x15,0x56,0x30,0x1E,0xA6,0x19,0x52,0x5A,0x2B,0x3B,0xB5,
+	0xB8,0x2C,0x7A,0xF7,0x96,0xD6,0xC3,0x2C,0x7B,0x94,0x2F,
+	0x1F,0x9E,0x7A,0xB5,0x94,0x3D,0xE9,0xC0,0x57,0x14,0xDC,
+	0x11,0x8A,0xB4,0xC6,0xEF,0xEE,0x2E,0x1B,0x7C,0x65,0xE2,
+	0x9A,0x33,0xEE,0xCE,0x60,0xE1,0x40,0xDB,0x81,0x2E,0x95,
+	0x38,0xCB,0x73,0xC2,0x2D,0xE6,0x1A,0xA6,0x71,0x53,0x6C,
+	0x8D,0x27,0x49,0xFA,0x20,0x36,0x22,0xB0,0x16,0xFD,0xB0,
+	0x09,0xEC,0x1E,0x26,0x69,0xD8,0x66,0xC1,0x3D,0x12,0x52,
+	0xC4,0x51,0xB0,0xED,0xA3,0x82,0x0A,0xF4,0x60,0x4A,0x33,
+	0x5B,0xA7,0xA1,0x7C,0x9D,0x5C,0x4D,0xB0,0xD4,0x23,0x41,
+	0x2D,0x46,0x49,0x69,0x8E,0xAA,0x8A,0xF2,0xC7,0x4C,0x69,
+	0x4A,0x4F,0xF5,0x0E,0xED,0xEA,0x1E,0xE8,0x1D,0x6A,0xF3,
+	0x8C,0x8F,0x1F,0x1E,0x38,0xCF,0x6E,0xFE,0x7E,0xF1,0x13,
+	0x0B,0xCA,0x5D,0xE0,0x04,0x1D,0xB8,0x2C,0x1F,0xF9,0xAD,
+	0x7C,0x19,0x14,0x0F,0x69,0x7D,0x24,0x3A,0x5D,0xD5,0x6D,
+	0xBF,0x04,0xAE,0xC8,0xD5,0x51,0xE5,0x51,0x7E,0x58,0xCC,
+	0xC8,0x94,0xA6,0xDB,0xCA,0x7D,0xAA,0xD0,0xAE,0x98,0xAF,
+	0x18,0x09,0x7C,0x2F,0x97,0x26,0xE6,0x39,0x68,0x46,0x73,
+	0x5C,0xAE,0x35,0xF0,0xBE,0xE0,0x6A,0xEE,0xE3,0x6A,0x69,
+	0x70,0x5D,0x73,0x7A,0xF6,0xB0,0x4C,0xCF,0x5D,0x04,0x41,
+	0xE2,0xB7,0xD7,0x09,0x0A,0xB2,0x9A,0x73,0x2B,0x64,0x48,
+	0x50,0xB6,0x0F,0xD7,0x7A,0x0E,0x90,0x0D,0x03,0xE4,0x64,
+	0xB1,0xB2,0xAA,0xF2,0x00,0x34,0x08,0xDB,0xB1,0x59,0x99,
+	0x82,0x49,0xA4,0xAA,0xAF,0xBF,0xB0,0x3E,0x70,0x25,0xB4,
+	0x6A,0x45,0xA7,0xD0,0xF2,0x95,0xC3,0xAE,0x1E,0xC1,0xA4,
+	0xF4,0x11,0x72,0xF5,0xE8,0xD5,0x1A,0xDF,0x51,0xA2,0xB6,
+	0x22,0x08,0xDB,0xB7,0x09,0xBB,0x92,0xD6,0x2B,0x55,0x77,
+	0xB4,0x5D,0xB6,0xA9,0x87,0x96,0x7B,0xBA,0x8E,0x71,0x77,
+	0x8A,0x8F,0x39,0xBA,0x3C,0x44,0xD9,0xAF,0x94,0x44,0x56,
+	0x5D,0xBD,0xFC,0xC2,0xD5,0xCB,0xCA,0x51,0xA5,0x32,0xB2,
+	0x5C,0x8D,0x39,0x90,0xD6,0xD5,0x13,0x16,0x53,0xB3,0xDC,
+	0x1A,0xA9,0x2A,0x35,0x91,0xE5,0x91,0x55,0xE0,0xFB,0x54,
+	0xC0,0x63,0x2F,0xAD,0x3D,0xA0,0x26,0x4F,0x89,0x6C,0x50,
+	0x2E,0xD0,0x63,0x1D,0xCA,0xD3,0xDA,0x25,0x80,0xEA,0xAF,
+	0xCB,0xA5,0x98,0x9A,0x8C,0x5F,0x1A,0x3B,0x34,0x8C,0x5B,
+	0xE1,0xAC,0x3C,0x52,0x79,0x2C,0x52,0xBD,0xED,0xC0,0xAF,
+	0x69,0xF5,0x14,0x68,0x6B,0x65,0x5D,0xE5,0x31,0xAA,0x76,
+	0xA8,0x4C,0xBF,0x18,0x38,0xC9,0x50,0xA9,0x51,0x0E,0x28,
+	0xA5,0x0F,0x55,0xA5,0xCC,0xE2,0x07,0x14,0xF9,0x70,0x9E,
+	0x94,0xCB,0x5F,0x10,0x88,0x77,0xC1,0x9C,0xB2,0xE3,0x49,
+	0xEB,0x1D,0x88,0xC9,0x13,0x73,0xAA,0x20,0xBE,0x40,0xB6,
+	0x15,0xD5,0x00,0x61,0xA2,0xBD,0x5C,0xCD,0xB3,0x31,0x8B,
+	0xFE,0xC6,0x8F,0x71,0xF1,0xF1,0x42,0x69,0xA0,0xDE,0xE5,
+	0xCB,0xB2,0x12,0xB7,0x0D,0x56,0x54,0x31,0xE9,0x39,0x3F,
+	0x42,0x56,0x24,0x94,0x42,0x78,0xF1,0x95,0x3A,0xC0,0xEE,
+	0x20,0x8E,0x19,0x5F,0x37,0xC0,0xF9,0xBA,0xEC,0x3C,0xBF,
+	0xF5,0x78,0x27,0x6C,0xB8,0x2F,0xF1,0xB2,0x0B,0x9C,0x10,
+	0xF4,0x83,0x3F,0x16,0x99,0x89,0xDE,0xF4,0x23,0xF8,0xBE,
+	0x4D,0xAF,0x1B,0x60,0xD5,0x21,0x15,0x50,0xB2,0x9A,0xE4,
+	0x6E,0x3E,0xD5,0x01,0x3C,0xEF,0xE9,0xFA,0xCF,0x24,0xF9,
+	0x24,0x88,0xAA,0x7F,0xC9,0xAF,0x91,0xAF,0x29,0x59,0x66,
+	0xA1,0x58,0xB6,0x29,0x59,0x8D,0x72,0x37,0xE8,0x4D,0x27,
+	0xF9,0x7B,0x85,0x05,0x29,0x3B,0xB8,0xA4,0x1A,0xFD,0x61,
+	0xD8,0x4D,0x89,0x89,0xF1,0x81,0x73,0x90,0xDA,0xC5,0xF3,
+	0x4E,0x85,0x42,0xBC,0x2E,0x00,0x87,0xDB,0x51,0x0F,0xBD,
+	0xC1,0x2D,0x8E,0x9D,0x2A,0x3B,0xC7,0xC7,0x33,0x08,0x83,
+	0xF2,0xC2,0x70,0xE8,0x72,0xD5,0x19,0x18,0x47,0x49,0x20,
+	0xE0,0x6B,0xCA,0xCA,0xE8,0xCC,0x8E,0x6E,0x8F,0xFC,0x58,
+	0x04,0xE7,0xA5,0x94,0x26,0x7D,0xEE,0x8F,0x20,0xDE,0x7E,
+	0xA5,0xEE,0xC9,0xA0,0x92,0x62,0x81,0x7E,0x40,0x4C,0x5E,
+	0x47,0xAA,0x75,0x6E,0x09,0x25,0x46,0x0C,0x0B,0x49,0xFC,
+	0xFD,0x8E,0x9C,0x72,0x8F,0x10,0xCF,0xEE,0x0B,0xF6,0x74,
+	0xB9,0x18,0x74,0x95,0x6B,0x94,0x70,0xFD,0x3D,0x88,0x3D,
+	0x2E,0x17,0x1C,0xB0,0x81,0x63,0x2E,0x98,0x25,0x94,0x1A,
+	0x9C,0x81,0xB3,0x90,0x3B,0x1A,0xD8,0xAD,0x64,0x47,0xEE,
+	0xD1,0x52,0x93,0xED,0x5E,0xE6,0x0A,0x5B,0x5A,0x0E,0xE4,
+	0x76,0x46,0xFB,0xB2,0xF7,0xD0,0x7A,0xA6,0xA7,0x0F,0x16,
+	0xE0,0x50,0xDD,0x97,0x04,0x3A,0x0E,0x0E,0xC5,0x0B,0xEB,
+	0x60,0x0B,0x5C,0xC4,0x93,0x00,0xDD,0x35,0x8B,0x6C,0x0F,
+	0xD1,0x7A,0xE2,0x8D,0x90,0xE1,0x73,0xE6,0x39,0xE7,0x2F,
+	0x4D,0x5B,0x3C,0xC7,0xED,0x5C,0xBA,0xC4,0x99,0xBA,0x22,
+	0x75,0xAE,0xCD,0xD2,0x9B,0x31,0x53,0x97,0x64,0x2C,0x4C,
+	0x5B,0x8A,0x8F,0xD8,0x7F,0x93,0xFC,0xCB,0x33,0xF6,0x5B,
+	0x64,0x7B,0x14,0xF2,0xB1,0x52,0xF1,0x71,0x61,0x95,0x52,
+	0xFB,0x71,0xD2,0xC7,0x49,0xC6,0x1E,0x07,0xDB,0x12,0xE1,
+	0xFF,0xCF,0xBA,0x94,0x7F,0x30,0xDF,0x1F,0x59,0x93,0x7D,
+	0x9D,0x84,0x65,0xD0,0xDD,0x24,0xEC,0x33,0xA9,0xFA,0xF4,
+	0x98,0x31,0x11,0x2C,0x8B,0x2F,0xAC,0x50,0x4E,0x1B,0x8B,
+	0x88,0x00,0xDD,0x54,0xBE,0x3A,0xA8,0x9C,0xCB,0xAF,0x28,
+	0xAC,0xE1,0x0F,0xEE,0x1F,0xF4,0xEF,0x9D,0x49,0x76,0xF6,
+	0x26,0x97,0xB7,0x28,0x19,0xC6,0x3C,0xEB,0xB0,0x61,0xD9,
+	0xD7,0xBC,0x24,0x83,0xEE,0xF4,0x92,0xCB,0xEF,0x75,0xCF,
+	0xF7,0x17,0xD6,0xEC,0xF2,0x92,0xED,0x5D,0xB5,0x9E,0xA0,
+	0xB5,0x27,0x9B,0x6C,0x13,0xB6,0xF7,0xD1,0x7A,0x0E,0x0E,
+	0xBA,0xC5,0x07,0xFD,0x79,0x35,0x7B,0x17,0xFD,0x9E,0xD1,
+	0xD8,0x83,0x85,0x4B,0x25,0x4B,0x7A,0xA8,0xFC,0x6A,0xE5,
+	0x83,0x3C,0x64,0xCA,0xF6,0x0F,0x0C,0x4A,0xA5,0xAF,0xC4,
+	0x01,0x7D,0xF9,0x99,0xBF,0xCE,0xB2,0x51,0x24,0x91,0x25,
+	0x3E,0xBD,0x43,0xA1,0x7F,0xD3,0x7B,0x86,0x87,0x82,0xBE,
+	0x2C,0x33,0x2C,0xF5,0x9E,0x29,0xBD,0x77,0xBE,0x44,0x02,
+	0xC6,0x3D,0x75,0xBD,0x77,0x6E,0x24,0xDD,0xF3,0xF7,0x17,
+	0xD6,0x40,0x24,0xDE,0xDB,0x4F,0x50,0x32,0x24,0x05,0xAA,
+	0xB8,0xFC,0x1E,0xBB,0x89,0xE4,0x2B,0x0E,0xE3,0xEA,0x4E,
+	0xF0,0xCD,0xB4,0x38,0x62,0x93,0x42,0x14,0x97,0x35,0x62,
+	0x53,0x01,0x80,0x9D,0xD1,0xCF,0xC3,0x45,0x58,0xC4,0xA6,
+	0x17,0x48,0xB0,0x7B,0x92,0xA4,0x04,0xF2,0xFD,0xBB,0xFA,
+	0x09,0x30,0xF0,0x53,0xAC,0xDD,0xDD,0x44,0x88,0x90,0x1D,
+	0x11,0xF2,0x04,0xB1,0x88,0x8E,0x09,0xF6,0x7D,0xD7,0xB0,
+	0x71,0xB3,0xE1,0xF7,0xAF,0x47,0x4D,0x69,0xF1,0x65,0x1A,
+	0x89,0xFB,0xF1,0xA8,0x20,0x3B,0x69,0x7B,0x66,0x81,0x3F,
+	0x87,0x8D,0xD2,0xE9,0x6A,0x8D,0x32,0xD3,0xBC,0x1E,0x8E,
+	0x15,0xAD,0x27,0x6B,0xF0,0x6D,0x7A,0x63,0x13,0x77,0x88,
+	0x66,0x76,0x96,0x3D,0x28,0x84,0x94,0xC1,0x09,0xD9,0xEC,
+	0x6E,0x87,0x67,0x6A,0xFD,0x8B,0x8B,0x70,0x51,0x96,0x28,
+	0xF1,0x13,0xBB,0xD9,0x6D,0x94,0xEB,0x83,0x9D,0xBE,0x36,
+	0xB7,0xF9,0xE0,0xC7,0xD4,0xBD,0xE0,0xA8,0x2F,0xEA,0xDD,
+	0xEB,0xE5,0xB2,0xC0,0x9B,0x93,0xE1,0xEC,0xBB,0x32,0xC8,
+	0xF7,0x62,0x04,0x91,0x2B,0x58,0x3A,0xCA,0x6E,0x21,0x40,
+	0x9A,0x17,0x12,0x93,0x28,0xBA,0x2D,0x4A,0x8F,0xC0,0x65,
+	0xBC,0xE1,0x0C,0x2D,0xEB,0x15,0xEC,0x82,0xA5,0xCF,0x65,
+	0x7B,0x8A,0x4C,0xFC,0x6D,0xB2,0xDB,0x63,0x56,0x8B,0x6E,
+	0x49,0x3E,0x11,0xB8,0xE8,0x1D,0x67,0xA4,0xCA,0x50,0x79,
+	0xB0,0x32,0x60,0x17,0x1C,0xD6,0xE0,0xFF,0x23,0x2C,0x15,
+	0x86,0xE0,0xA6,0xD8,0x77,0x99,0x60,0xB3,0x99,0x65,0x40,
+	0xFE,0x00,0xE3,0xA0,0xBC,0x9F,0x5D,0x2B,0x9D,0xF5,0xD0,
+	0x8B,0x72,0x65,0xE0,0xF4,0xAD,0x8F,0x50,0xC1,0x69,0x9F,
+	0xD4,0x07,0x0B,0x9B,0xBD,0xEE,0xF0,0x6D,0xA2,0x7C,0x19,
+	0x02,0x4E,0x39,0x73,0xEF,0xAD,0x7E,0x3D,0x82,0x39,0xF5,
+	0x6B,0xE0,0xF1,0x31,0x0B,0x29,0x05,0x56,0x87,0xE8,0x46,
+	0xB7,0x91,0xDD,0x50,0xE9,0xFF,0x03,0x24,0x8F,0xAD,0x51,
+	0xE6,0xAF,0x7A,0xE0,0x4A,0xDD,0x9B,0x22,0x0C,0xAE,0x21,
+	0xD1,0xE4,0x74,0x8B,0x70,0x54,0x4D,0x34,0xEB,0xED,0xD8,
+	0xCB,0x02,0x57,0xE0,0xD8,0xEE,0x04,0xAE,0xC9,0xF3,0x33,
+	0x7B,0x94,0xFA,0x98,0x3A,0x49,0x2E,0x81,0xB4,0x59,0xEE,
+	0xB4,0xC5,0x30,0x43,0xA5,0x90,0x99,0x43,0x8F,0xE5,0x92,
+	0x18,0x63,0x9C,0x94,0x16,0x23,0xAB,0x9F,0x49,0xE0,0xD4,
+	0xAA,0x03,0x70,0x14,0x60,0xE6,0x9C,0x5F,0x83,0xEF,0xA8,
+	0x84,0xE6,0x57,0x44,0xC2,0x8A,0x0A,0x2A,0x37,0x60,0x76,
+	0x3F,0xF4,0x76,0x3F,0x7B,0x6E,0xB2,0x71,0x80,0x24,0x77,
+	0x1A,0x20,0xF1,0xE7,0x86,0x8F,0x1F,0x6B,0x7D,0x60,0x6E,
+	0x20,0xF8,0x76,0x01,0x7B,0x71,0x2E,0xFF,0xA8,0x1E,0x2E,
+	0xF2,0x35,0x80,0xAE,0xE5,0xEF,0x87,0xC4,0x12,0x3C,0x64,
+	0xA2,0x31,0xDF,0x2F,0x9B,0xF2,0x2B,0x20,0xC1,0xC4,0x57,
+	0x96,0xD8,0x23,0x1F,0x4C,0x31,0x98,0xFF,0x5E,0x2D,0x7A,
+	0xEC,0xF2,0xFE,0xA8,0x2A,0x3D,0x96,0xC8,0xF5,0x78,0x9B,
+	0x46,0x22,0x7B,0x82,0x41,0x3D,0xBE,0x36,0xF0,0xD3,0x44,
+	0xB0,0x89,0x92,0xBC,0xE2,0xED,0xB1,0xFC,0x01,0x83,0x49,
+	0x37,0xEB,0xD3,0xD5,0xC9,0x2C,0x29,0x4A,0x93,0xD8,0xD9,
+	0x42,0xE9,0x7E,0xD8,0x50,0x59,0x2B,0xA8,0xEC,0xAC,0x81,
+	0x6C,0xF1,0x37,0xA6,0xDC,0x99,0x37,0x07,0xDD,0x24,0x23,
+	0xA0,0xB1,0xF2,0x86,0x12,0xAF,0xDB,0xC4,0x8E,0x14,0xD3,
+	0xD9,0xC1,0x24,0xD0,0xC8,0xEB,0xDE,0x3E,0xB8,0xB5,0xE6,
+	0x4F,0x7E,0x9A,0xAE,0x22,0xE7,0xB1,0x56,0xCE,0x9B,0x3F,
+	0xAD,0x6B,0x7D,0x9A,0x23,0xAB,0x95,0xB5,0xD9,0x43,0x0E,
+	0x1B,0x3E,0x31,0xB8,0xBB,0x29,0xF6,0xC3,0x70,0x44,0x81,
+	0xF4,0xEE,0x3D,0x49,0x2E,0x81,0x38,0x34,0x90,0x85,0x8C,
+	0xD7,0x4E,0xE2,0xCD,0x1C,0xA5,0xD3,0x56,0x98,0xE9,0x43,
+	0x66,0x7D,0xD1,0x4F,0x90,0xCE,0x94,0xC0,0x72,0xFC,0x53,
+	0xB1,0x6F,0x35,0xEC,0xF9,0xC4,0x50,0xF9,0xC3,0xEF,0x6F,
+	0xA9,0x05,0xF6,0x29,0x43,0x40,0xF7,0x48,0x3F,0x7F,0x24,
+	0x28,0x54,0xFE,0x54,0xF9,0x83,0xF0,0xFD,0xD4,0xEE,0xA6,
+	0xBC,0x5A,0xF6,0xD4,0x18,0x34,0xB6,0xCC,0x96,0x3B,0x41,
+	0x43,0xDD,0xB7,0x1A,0x02,0xEF,0x6D,0x3C,0x6C,0x88,0xFD,
+	0xC4,0xE0,0x11,0x54,0x7D,0xF7,0x85,0x8D,0x87,0xCC,0x65,
+	0x46,0xD6,0x93,0x4D,0x5B,0xF9,0xEE,0x92,0xD5,0x8D,0x5B,
+	0x0D,0xD1,0x6A,0x5A,0x98,0x5C,0x1C,0x2B,0x90,0xAC,0xFB,
+	0x61,0x7C,0xC2,0xFE,0x38,0x3D,0x31,0x18,0x03,0x45,0xD3,
+	0x7B,0xC9,0x47,0x2A,0x7F,0x80,0xA0,0xD2,0x03,0xCC,0xBF,
+	0x17,0x51,0x06,0x1C,0x36,0x08,0x87,0xBC,0x87,0xE2,0xE4,
+	0x70,0x08,0xA7,0x38,0x0B,0x55,0xBB,0xD9,0x66,0x41,0x49,
+	0xE0,0xA7,0xC9,0x93,0x62,0x0D,0x64,0x55,0x18,0xA4,0x86,
+	0x6C,0x0E,0x4F,0xC1,0xA9,0x3B,0x51,0x88,0x73,0xB3,0x17,
+	0xD4,0xBC,0x13,0x84,0x38,0x7D,0x1B,0xBB,0x99,0x7D,0x89,
+	0xC9,0x84,0x6A,0x60,0x38,0x67,0x70,0xEB,0xD2,0xF7,0x07,
+	0xE5,0x0A,0x7D,0x41,0xCB,0x0C,0xB6,0xE8,0x6C,0x5D,0xF5,
+	0x27,0xCE,0x72,0x03,0xD8,0xBE,0xA0,0x11,0x88,0xE4,0xB3,
+	0xEB,0x1E,0x53,0x93,0xBB,0x4F,0x4A,0x7A,0x30,0xA8,0x1C,
+	0xAC,0x3C,0x4D,0x8F,0x64,0xAB,0xC1,0x7B,0xF3,0xCB,0x0B,
+	0x8B,0xF5,0xFB,0xC8,0x64,0xF6,0x40,0xEA,0xAB,0x14,0xE3,
+	0x9B,0xCF,0x27,0xB6,0x97,0x4D,0xF2,0x04,0x49,0x9E,0x6A,
+	0x94,0x97,0x5B,0xE4,0xD5,0xD6,0xE7,0x13,0xCD,0xCF,0x27,
+	0xDA,0x9F,0x07,0x03,0x4A,0x0C,0xF3,0xED,0x93,0x7A,0xCC,
+	0x52,0x8D,0x93,0x0B,0x8F,0x2A,0x35,0xC1,0xE5,0x76,0xC5,
+	0xA4,0x4C,0x90,0x94,0xA9,0x46,0x65,0xB9,0x45,0x59,0x6D,
+	0x55,0x96,0x9A,0x0B,0x13,0xC3,0x94,0xD9,0x62,0x8F,0x83,
+	0x1A,0x51,0x35,0x41,0xD5,0x44,0xF5,0xEB,0x75,0xAA,0x26,
+	0xA9,0x9A,0x41,0xD5,0x8C,0xAA,0x66,0x52,0x35,0xB3,0xAA,
+	0x85,0xA8,0x9A,0x45,0xD5,0x42,0x55,0xCD,0xAA,0x6A,0x36,
+	0x55,0xB3,0xAB,0x9A,0x43,0xD5,0xC2,0x54,0xAD,0x9D,0xAA,
+	0xB5,0x57,0xB5,0x0E,0xAA,0x16,0xAE,0x6A,0x1D,0x55,0xAD,
+	0x93,0xAA,0x75,0x56,0xB5,0x2E,0xAA,0x76,0x9B,0xAA,0x75,
+	0x55,0xB5,0xDB,0x55,0xED,0x0E,0x55,0xEB,0xA6,0x6A,0xDD,
+	0x55,0xAD,0x87,0xAA,0x39,0x55,0xAD,0xA7,0xAA,0xF5,0x52,
+	0xB5,0x3B,0x55,0xAD,0xB7,0x5A,0x57,0x28,0xD6,0xBD,0x22,
+	0x6A,0x77,0xAB,0xDA,0x3D,0xAA,0xD6,0x47,0xD5,0xEE,0x55,
+	0xB5,0x48,0x55,0xBB,0x4F,0xD5,0xEE,0x57,0xB5,0xBE,0xAA,
+	0xF6,0x80,0xAA,0xF5,0x53,0xB5,0x28,0x55,0x7B,0x50,0xD5,
+	0x1E,0x52,0xB5,0xFE,0xAA,0xF6,0xB0,0xAA,0x0D,0x50,0xB5,
+	0x47,0x54,0x6D,0xA0,0x0A,0x07,0x51,0x6D,0x90,0xAA,0xC5,
+	0xA8,0xDA,0x60,0x55,0x8B,0x55,0xB5,0x21,0xAA,0x36,0x54,
+	0xD5,0xE2,0x54,0x6D,0x98,0xAA,0x0D,0x57,0xB5,0x78,0x55,
+	0x1B,0xA1,0x6A,0x09,0xAA,0xE6,0x52,0xB5,0x44,0x55,0x1B,
+	0xA9,0x6A,0xA3,0x54,0x6D,0xB4,0xAA,0x8D,0x51,0xB5,0xB1,
+	0xAA,0x36,0x4E,0xD5,0xC6,0xAB,0xDA,0x04,0x55,0x4B,0x52,
+	0xB5,0x89,0xAA,0x36,0x49,0xD5,0x26,0xAB,0xDA,0xA3,0xAA,
+	0x96,0xAC,0x6A,0x53,0x54,0x6D,0xAA,0xAA,0x4D,0x53,0xB5,
+	0xE9,0xAA,0x36,0x43,0xD5,0x1E,0x53,0xB5,0x99,0xAA,0x36,
+	0x4B,0xD5,0x52,0x54,0x6D,0xB6,0xAA,0x3D,0xAE,0x6A,0x73,
+	0x54,0xED,0x09,0x55,0x9B,0xAB,0x6A,0xF3,0x54,0x2D,0x55,
+	0xD5,0xE6,0xAB,0xDA,0x93,0xAA,0xB6,0x40,0xD5,0x16,0xAA,
+	0xDA,0x53,0xAA,0xF6,0xB4,0xAA,0x2D,0x52,0xB5,0xC5,0xAA,
+	0xB6,0x44,0xD5,0x96,0xAA,0xDA,0x32,0x55,0x7B,0x46,0xD5,
+	0xD2,0x54,0x2D,0x5D,0xD5,0xDC,0xAA,0xE6,0x51,0xB5,0x0C,
+	0x55,0x5B,0xAE,0x6A,0x2B,0x54,0x6D,0xA5,0xAA,0x3D,0xAB,
+	0x6A,0x7F,0x52,0xB5,0x4C,0x55,0x5B,0xA5,0x6A,0x59,0xAA,
+	0xB6,0x5A,0xD5,0xBC,0xAA,0x96,0xAD,0x6A,0xCF,0xA9,0x9A,
+	0x4F,0xD5,0xD6,0xA8,0x5A,0x8E,0xAA,0xFD,0x59,0xD5,0xD6,
+	0xAA,0x5A,0xAE,0xAA,0xC9,0xAA,0x96,0xA7,0x6A,0x8A,0xAA,
+	0xE5,0xAB,0x5A,0x81,0xAA,0x15,0xAA,0xDA,0xF3,0xAA,0x06,
+	0xCB,0xF4,0x82,0xAA,0xBD,0xA8,0x6A,0x2F,0xA9,0xDA,0xCB,
+	0xAA,0xF6,0x8A,0xAA,0xBD,0xAA,0x6A,0x7F,0x51,0xB5,0xD7,
+	0x54,0x6D,0xBD,0xAA,0xBD,0xAE,0x6A,0x6F,0xA8,0xDA,0x9B,
+	0xAA,0xF6,0x96,0xAA,0xBD,0xAD,0x6A,0xEF,0xA8,0xDA,0x06,
+	0x55,0xDB,0xA8,0x6A,0xEF,0xAA,0xDA,0x26,0x55,0x7B,0x4F,
+	0xD5,0xDE,0x57,0xB5,0x0F,0x54,0xED,0xAF,0xAA,0xB6,0x59,
+	0xD5,0x3E,0x54,0xB5,0x2D,0xAA,0xF6,0x91,0xAA,0x6D,0x55,
+	0xB5,0x8F,0x55,0xED,0x13,0x55,0xFB,0x54,0xD5,0xB6,0xA9,
+	0xDA,0x67,0xAA,0xF6,0xB9,0xAA,0xFD,0x4D,0xD5,0xB6,0xAB,
+	0xDA,0x17,0xAA,0xB6,0x43,0xD5,0xFE,0xAE,0x6A,0x45,0xAA,
+	0xB6,0x53,0xD5,0x76,0xA9,0xDA,0x6E,0x55,0xFB,0x52,0xD5,
+	0xFE,0xA1,0x6A,0x7B,0x54,0x6D,0xAF,0xAA,0xF9,0x55,0xAD,
+	0x58,0xD5,0x4A,0x54,0x4D,0x55,0xB5,0x7D,0xAA,0xF6,0x95,
+	0xAA,0x95,0xAA,0x5A,0x99,0xAA,0xED,0x57,0xB5,0x72,0x55,
+	0x3B,0xA0,0x6A,0x07,0x55,0xED,0x6B,0x55,0xD3,0x54,0xED,
+	0x90,0xAA,0x7D,0xA3,0x6A,0x15,0xAA,0x56,0xA9,0x6A,0x55,
+	0xAA,0x56,0xAD,0x6A,0xDF,0xAA,0xDA,0x77,0xAA,0x76,0x58,
+	0xD5,0xBE,0x57,0xB5,0x1A,0x55,0x3B,0xA2,0x6A,0x47,0x55,
+	0xED,0x98,0xAA,0x1D,0x57,0xB5,0x7F,0xAA,0xDA,0x09,0x55,
+	0x3B,0xA9,0x6A,0xB5,0xAA,0xF6,0x83,0xAA,0x9D,0x52,0xB5,
+	0xD3,0xAA,0x76,0x46,0xD5,0x7E,0x54,0xB5,0xB3,0xAA,0xF6,
+	0x93,0xAA,0xE9,0xAA,0x56,0xA7,0x6A,0x3F,0xAB,0x5A,0x40,
+	0xD5,0xCE,0xA9,0xDA,0x79,0x55,0xBB,0xA0,0x6A,0xBF,0xA8,
+	0x5A,0xBD,0xAA,0x5D,0x54,0xB5,0x4B,0xAA,0x76,0x59,0xD5,
+	0xAE,0xA8,0xDA,0xAF,0xAA,0xD6,0xA0,0x6A,0x57,0x55,0xAD,
+	0x51,0xD5,0xAE,0xA9,0x5A,0x93,0xAA,0x5D,0x57,0xB5,0x66,
+	0x55,0xBB,0xA1,0x6A,0x2D,0xAA,0x16,0x54,0xB5,0xBB,0xD2,
+	0xE9,0x5B,0xD7,0xD4,0xB7,0x40,0x1C,0xD1,0x76,0x75,0xCB,
+	0xFB,0x3B,0xAA,0x5C,0x09,0xDB,0x37,0x01,0xDC,0xC1,0x48,
+	0x3D,0x99,0xBD,0xCB,0x54,0xA3,0xCF,0xE2,0x6F,0x8A,0xFA,
+	0x3D,0x77,0x81,0x3F,0xDB,0x79,0x0A,0x9F,0xD3,0x3D,0x28,
+	0x5F,0x04,0xDF,0x75,0xE2,0x0F,0x4F,0x00,0x6A,0xF4,0xA1,
+	0x3F,0xB7,0xDD,0xB6,0xC6,0x77,0x76,0xE4,0x53,0x10,0x64,
+	0xEF,0xFD,0x19,0x7C,0xC8,0xCF,0xF2,0x25,0x90,0xB7,0x23,
+	0x81,0x13,0xB0,0xE9,0x7D,0x01,0x51,0x31,0xF5,0x6E,0xB9,
+	0x5F,0x24,0x7F,0x78,0x39,0xFA,0x7B,0xEF,0xFC,0x96,0x96,
+	0x82,0xF1,0xCD,0x10,0x11,0xAE,0xCB,0x97,0xF4,0x28,0xF6,
+	0x94,0xBB,0x2B,0x7B,0xB3,0x27,0x94,0x9D,0x8D,0xCF,0xF2,
+	0xF7,0xD7,0x6C,0xBF,0xBD,0x00,0x5D,0xF7,0xA2,0xC0,0x12,
+	0x01,0xC3,0x05,0x50,0xAB,0xF3,0x8E,0x6F,0x11,0x02,0xBF,
+	0xDD,0x0C,0x38,0x21,0x8F,0x6F,0xF6,0xA9,0xD4,0x7B,0xBA,
+	0x25,0xFA,0x72,0xFA,0xE3,0xE0,0xC1,0xE4,0xC3,0x85,0x7E,
+	0xDF,0x05,0x31,0x42,0xB1,0x7A,0x7F,0x68,0x91,0x33,0x1A,
+	0xA2,0x0F,0x66,0x4C,0x87,0x3C,0xBB,0xCF,0x41,0xE1,0x90,
+	0xDC,0x8D,0x3D,0x34,0xBD,0x03,0x12,0x62,0xF6,0x20,0x29,
+	0x96,0x35,0xE3,0x89,0x8B,0x80,0x04,0x42,0x4E,0x69,0x04,
+	0x10,0xE5,0x94,0xA6,0xFC,0x63,0xD1,0x35,0x9E,0x07,0xD8,
+	0xAD,0x20,0x50,0xE5,0x37,0xFE,0xEF,0x8F,0xAE,0xCE,0x70,
+	0xB2,0x72,0xB3,0x25,0x48,0xC2,0xAF,0x1B,0xD3,0xDF,0xDE,
+	0x0D,0xE7,0xBE,0xF5,0xBB,0x45,0x52,0xF7,0x12,0xA9,0x7B,
+	0x8B,0xD4,0xBD,0x42,0x02,0x93,0x23,0x14,0x87,0x70,0x24,
+	0xBA,0x32,0xE3,0x7B,0xFE,0x6C,0xCD,0xE8,0x31,0x47,0x28,
+	0x63,0x45,0xC8,0x7F,0x8C,0xD0,0x32,0x9C,0x32,0x63,0x6C,
+	0xE9,0xFD,0xE1,0xD8,0x00,0xE9,0xDA,0xF8,0xC6,0x08,0x79,
+	0x9C,0xC4,0x6E,0x85,0x34,0xC1,0x85,0xA8,0x64,0x35,0x80,
+	0x38,0x42,0x80,0x23,0x43,0x73,0x44,0x70,0x82,0x1D,0x14,
+	0x63,0x85,0x43,0x7D,0x6C,0x75,0xC9,0xC1,0xA8,0x63,0x81,
+	0xCF,0x23,0x6D,0xBE,0x6B,0xC6,0xB4,0xAF,0xE8,0xC3,0x50,
+	0x32,0x05,0x0A,0xCC,0x14,0x15,0xE8,0xA9,0x0C,0xA9,0x0F,
+	0xA3,0xAC,0x11,0xF2,0x72,0x89,0x33,0x96,0x03,0xBF,0x41,
+	0x31,0x44,0x08,0x26,0xF6,0xF0,0x06,0x53,0xF5,0xDD,0x02,
+	0x9C,0x4E,0xFB,0x1C,0x61,0x15,0xFC,0x0C,0xCD,0xC8,0x27,
+	0xBC,0xE5,0x82,0x90,0xD2,0xE0,0x3B,0x24,0x80,0x6E,0x84,
+	0xFC,0x30,0x24,0x68,0x7C,0xB0,0x0F,0xDD,0x3A,0xD8,0x8E,
+	0x30,0x58,0x73,0xDB,0x60,0xDB,0x06,0xF5,0x8B,0x32,0xA5,
+	0x01,0xE6,0xB4,0x44,0x8C,0x60,0x77,0xB8,0x42,0x49,0xE0,
+	0x75,0xE8,0x5B,0x40,0xAE,0xAF,0x4B,0x69,0x61,0x4F,0x8F,
+	0xE5,0x0A,0xF6,0x16,0x74,0x48,0xFE,0xD1,0xE8,0x4A,0x8F,
+	0x51,0xEF,0xAD,0x33,0x93,0x38,0x10,0x75,0x4C,0x8F,0xF8,
+	0x19,0xAE,0x6E,0xDE,0xAF,0x16,0xFE,0x97,0x1F,0x42,0x46,
+	0x4C,0x98,0xDC,0x3F,0x31,0x69,0xD8,0xA3,0x23,0x09,0xFF,
+	0xE8,0x0B,0x69,0x36,0x99,0xB7,0x34,0xBD,0xFF,0x93,0xCB,
+	0x7F,0xBB,0xE4,0x57,0x33,0x6F,0xE1,0x4E,0x76,0x7B,0x9E,
+	0xE0,0x09,0xB9,0x73,0xFE,0x9C,0x85,0x8B,0x52,0xE7,0x0D,
+	0x22,0x64,0xFC,0x52,0x67,0x6A,0x5A,0xDA,0xD2,0x34,0x76,
+	0x91,0xEE,0x99,0xBB,0xC0,0x39,0x1F,0x04,0xCE,0xA5,0x69,
+	0xCE,0x79,0x0B,0xD3,0x52,0xE7,0xBA,0xD9,0xBB,0xBB,0xC3,
+	0xD2,0x9E,0x74,0x2E,0x5A,0x98,0xEE,0x76,0xBA,0x97,0x2E,
+	0x75,0x3E,0xB1,0xF0,0x49,0x92,0xC0,0x6B,0xC0,0x73,0x01,
+	0x16,0xE6,0x07,0x05,0x56,0x70,0x89,0x67,0xF1,0x13,0xA9,
+	0x69,0xFF,0xE6,0x05,0xE0,0xA4,0xD4,0xB4,0xC5,0x0B,0xD3,
+	0xD3,0x17,0xC2,0x89,0x60,0x5E,0xEA,0x92,0x85,0xA9,0xF3,
+	0x88,0x8B,0xE9,0xA7,0xAE,0x80,0x8A,0xD3,0x49,0x7C,0xDA,
+	0xD2,0xF4,0xF4,0xFB,0xE7,0xA5,0x66,0x2C,0x9C,0x9B,0x0A,
+	0x6D,0x2D,0x79,0x9A,0x8C,0x5A,0x92,0x31,0x67,0xD1,0xC2,
+	0x79,0xCE,0x39,0x69,0x4F,0x7A,0xD8,0x31,0x03,0xD5,0xDD,
+	0x73,0x9E,0x60,0xBD,0x6B,0xBD,0x99,0x47,0x1E,0x85,0x0E,
+	0x2D,0x9E,0xB3,0x04,0xCE,0x19,0xEC,0x05,0x67,0xD6,0x81,
+	0x74,0x3E,0x8E,0x65,0x73,0x58,0x35,0xA9,0xF3,0xF9,0xE1,
+	0x04,0x6B,0x65,0xA3,0xE0,0x15,0xF1,0x51,0x2C,0x82,0x6A,
+	0x53,0xC9,0xA4,0xD4,0x74,0xCF,0xA2,0x3F,0x30,0x96,0x7A,
+	0xD2,0xA0,0xEC,0xBC,0xD4,0x39,0xF3,0x16,0x2D,0x9D,0xFB,
+	0xB4,0x73,0xF9,0x52,0xCF,0xA2,0x79,0xCE,0xA5,0x73,0xE7,
+	0x7A,0xD2,0xC8,0x64,0xFE,0xA2,0xB4,0x73,0xEE,0x9C,0x45,
+	0x8B,0x9C,0x0B,0x97,0xB8,0x61,0xE4,0x9E,0x65,0xEC,0x6D,
+	0xE7,0xF8,0x05,0x0B,0x41,0x67,0xDE,0xD2,0xD4,0x74,0xE7,
+	0x12,0x36,0x6E,0x36,0xA4,0xDF,0xAA,0xF2,0x2C,0x99,0x93,
+	0x01,0x93,0xCD,0x3A,0x7E,0x9F,0xD3,0x0D,0x67,0xA2,0x39,
+	0x4F,0xCE,0x59,0xB8,0x84,0x8C,0xC0,0xB1,0xC2,0x44,0xA7,
+	0xB5,0x69,0x3E,0xE1,0x49,0x5F,0xD9,0x3A,0xCC,0x9B,0x3D,
+	0x1A,0xF5,0xC0,0x84,0xD6,0x29,0x1E,0x95,0xEE,0x9C,0x73,
+	0xCB,0xA2,0xB0,0x19,0xBE,0x95,0xBE,0x39,0x15,0x6C,0xF6,
+	0xD2,0xC9,0x70,0xDE,0xFB,0xD6,0x09,0x4D,0x4B,0x7D,0xC6,
+	0x03,0x8A,0xF3,0x5A,0x0B,0xCD,0x5D,0x30,0x27,0x6D,0xCE,
+	0x5C,0xE8,0x7F,0xDB,0xD4,0xB4,0x2D,0xFD,0xBC,0x9B,0x7D,
+	0x9A,0x33,0x6F,0x1E,0x74,0x2B,0x9D,0x17,0x58,0xBA,0x7C,
+	0x09,0xAC,0xE8,0xF0,0xB4,0xA5,0x4F,0xC3,0x1C,0x2F,0x5B,
+	0xB8,0x8C,0x4D,0xD3,0x9C,0x79,0xF7,0x2F,0x5D,0xB2,0x68,
+	0x25,0xAE,0x39,0xBE,0x40,0x4E,0x46,0x2D,0x5A,0x94,0xFA,
+	0xE4,0x9C,0x45,0xCE,0xF4,0xD4,0xD4,0xA7,0x6F,0x56,0xB9,
+	0x2C,0x6D,0xE9,0x5C,0x56,0xD1,0xA3,0xA9,0x2B,0xDC,0xA8,
+	0xCD,0x47,0xC9,0xEC,0xA5,0xAD,0x0D,0x36,0xE2,0x25,0x73,
+	0x16,0xB7,0x8E,0x7A,0xE9,0x92,0x27,0xFF,0xD0,0x1F,0x46,
+	0xB2,0xD1,0xC0,0xF8,0xDB,0x26,0x12,0xA6,0xBF,0xAD,0xD5,
+	0xE4,0x25,0x4F,0x2F,0x81,0x1E,0xB6,0x92,0x7C,0x71,0xC8,
+	0x88,0xB6,0x59,0xC1,0xF5,0x58,0xBC,0xCC,0xBD,0xF2,0x66,
+	0xEF,0x16,0xC3,0x8A,0x2F,0x7C,0x62,0xA5,0x1B,0xBA,0x0D,
+	0xB3,0x92,0xBA,0x04,0xEA,0xF7,0xB4,0x56,0x81,0xF3,0x3C,
+	0xC8,0x49,0x2C,0xB8,0xA7,0xC8,0x7F,0x38,0xCF,0x92,0xBE,
+	0x73,0x97,0x2E,0xC6,0x5D,0xF7,0xAF,0x5A,0xEE,0xA5,0x4E,
+	0xE8,0xC6,0xD2,0xB9,0x73,0xA0,0x15,0x9C,0x21,0x77,0x9A,
+	0x67,0xAE,0xDB,0x03,0xC3,0x25,0xBD,0xC8,0x7D,0xE4,0x29,
+	0x92,0x4E,0x0A,0xC8,0xDB,0x64,0x1B,0xF1,0x93,0x2A,0x72,
+	0x86,0xD4,0x13,0x51,0xE8,0x20,0xDC,0x2D,0xC4,0x08,0x93,
+	0x85,0xF9,0xC2,0x72,0xE1,0x15,0xE1,0x63,0xA1,0x44,0x38,
+	0x25,0x34,0x09,0x21,0x62,0x07,0xB1,0x97,0xF8,0xA0,0x38,
+	0x4C,0x9C,0x2A,0x2E,0x11,0x73,0xC5,0x17,0xC5,0xB7,0xC5,
+	0xED,0x62,0xB1,0x58,0x29,0xD6,0x8A,0xE7,0xC4,0x16,0xD1,
+	0x46,0xEF,0xA5,0x43,0xE8,0x24,0xDA,0x87,0x6C,0x95,0xB6,
+	0x4A,0xAD,0xCE,0xC3,0x4A,0xFE,0xCB,0x1F,0xE1,0x77,0x94,
+	0xF8,0x3B,0x5A,0x84,0x7F,0xBF,0xFD,0x50,0xF8,0x77,0xAB,
+	0x4C,0x22,0xFF,0x3F,0xFD,0xC1,0x29,0x08,0x11,0x84,0x50,
+	0xA3,0x64,0x30,0x18,0x44,0x1A,0xB4,0x9B,0x7A,0x1B,0xCD,
+	0x42,0xB0,0x4D,0x21,0x8C,0x8F,0xBF,0xC3,0x2D,0x05,0xC2,
+	0xE1,0x3F,0x9B,0x2D,0xFA,0xBB,0x19,0xFB,0x77,0x3F,0x9F,
+	0x18,0x58,0x81,0x6F,0xD8,0xFA,0x38,0x97,0xD9,0xD9,0x67,
+	0x4A,0x27,0xF6,0x39,0xD6,0xC1,0x3E,0xB7,0x77,0x63,0x9F,
+	0xB7,0x33,0x8E,0x90,0xCA,0xA4,0x3D,0x3A,0x73,0xFE,0x5D,
+	0x9D,0xE1,0x33,0xFC,0xFB,0x3E,0xB7,0xD6,0x34,0x36,0xE1,
+	0x0F,0x6B,0x26,0x62,0xCF,0x18,0xB5,0xEE,0x05,0xC2,0x57,
+	0x6B,0x5D,0x47,0xE1,0x26,0xF3,0xFA,0x3D,0xA8,0xF6,0x52,
+	0x6B,0xF9,0x7D,0x04,0x75,0xAC,0xAD,0xC5,0xC7,0xDE,0x82,
+	0x53,0x6E,0x31,0x83,0xA9,0x70,0xFD,0x06,0xFC,0x9F,0x78,
+	0x6F,0xEB,0x73,0xD4,0x56,0x7C,0x74,0xCE,0xBF,0x8E,0x8E,
+	0xFE,0x97,0x76,0xD6,0xF6,0x73,0xF9,0x1B,0x94,0x25,0x38,
+	0x51,0xC3,0xD6,0xCA,0xEF,0x2C,0xE0,0x80,0x12,0xA0,0xEF,
+	0xF6,0x5B,0x4A,0xF3,0xF1,0x40,0x2B,0xF1,0xA0,0xEF,0xC0,
+	0x21,0xDF,0x52,0xBF,0xD8,0xDA,0x03,0x66,0x99,0x6C,0x9A,
+	0x8D,0xF0,0xDF,0x04,0xFF,0xCD,0x6C,0x39,0xE1,0xBF,0x05,
+	0xFE,0x87,0xB6,0x6E,0x0E,0xD6,0x12,0xAB,0xD9,0xC1,0xD7,
+	0xD3,0xB8,0x20,0x75,0x05,0x6C,0xDC,0xB6,0xCA,0x7A,0x42,
+	0x0D,0xF1,0x50,0x7A,0x3A,0x94,0x18,0x09,0x1A,0x77,0xC0,
+	0x5A,0xFF,0x08,0x4B,0xF0,0xD1,0xED,0x10,0x74,0xBB,0x13,
+	0x32,0x0D,0x9A,0x4F,0xB8,0x93,0x90,0x41,0xBD,0x09,0x79,
+	0xED,0x2E,0x42,0x16,0xDF,0x4D,0xC8,0x37,0xF0,0xFF,0x51,
+	0x98,0xE2,0x1D,0xF7,0xF0,0x46,0x1D,0x94,0x52,0x13,0xB1,
+	0x3B,0xE8,0x22,0xAB,0x89,0xF4,0x40,0x78,0x19,0xE1,0x7B,
+	0x84,0x27,0x2C,0x34,0x09,0x60,0xA1,0x85,0x56,0xDA,0x4C,
+	0x64,0x39,0x82,0xD7,0x42,0x17,0x00,0x73,0x8D,0x85,0x4E,
+	0x13,0x4C,0xE4,0x79,0x0B,0xAD,0x01,0xE6,0x7A,0x64,0xBE,
+	0x65,0xA1,0x7F,0x02,0xE6,0xC7,0x16,0xBA,0x01,0x98,0x35,
+	0xC8,0x3C,0x6E,0xA1,0x79,0xC0,0x3C,0x6B,0xA1,0x5B,0x81,
+	0xFA,0x05,0x99,0x97,0x2D,0xF4,0x24,0x30,0x83,0x16,0xFA,
+	0x38,0x50,0xE6,0x50,0x5E,0xC0,0x1E,0x4A,0xE7,0x01,0xD5,
+	0x2B,0x94,0x33,0xEF,0x43,0xEA,0x61,0xA4,0x62,0x90,0x8A,
+	0x0B,0xA5,0xD3,0x00,0x12,0xB0,0xC0,0x98,0x50,0x3A,0x13,
+	0xA8,0x55,0xC8,0xF4,0x21,0x25,0x87,0xD2,0x72,0x90,0xBD,
+	0x18,0x4A,0x0F,0x02,0xBC,0x11,0x4A,0x27,0x02,0xF3,0x5D,
+	0x64,0x7E,0x14,0x4A,0x27,0x01,0xF5,0x39,0x32,0x77,0x23,
+	0xB5,0x2F,0x94,0x4E,0x06,0xD0,0x42,0x79,0xCF,0x2A,0x43,
+	0xA9,0x59,0x84,0x29,0x40,0xE6,0x49,0x84,0x9F,0x43,0xE9,
+	0x7D,0xE1,0x26,0xD2,0x84,0xD0,0xDE,0xCA,0xA7,0xA7,0xAB,
+	0x95,0x2E,0x03,0x88,0xB0,0x52,0x37,0x40,0x24,0x52,0xFD,
+	0x50,0x96,0x80,0x30,0x1E,0x65,0x53,0xAC,0x74,0x05,0x80,
+	0x07,0xA9,0x1C,0xD4,0x5C,0x8F,0xCC,0xB7,0x51,0xF3,0x3D,
+	0x84,0x03,0x56,0xDE,0xDE,0x0D,0x2B,0x1F,0x4A,0xA8,0x8D,
+	0x0F,0xEC,0x4E,0x1B,0xA7,0xA2,0x90,0x8A,0x43,0x2A,0x09,
+	0xA9,0x79,0x48,0xA5,0x21,0x95,0x65,0xE3,0x1D,0x7C,0xCB,
+	0xC6,0x87,0xB2,0xD1,0x46,0x1F,0x81,0xA1,0x6C,0x45,0x6A,
+	0x9B,0x8D,0xAE,0x00,0xAA,0x12,0xA9,0xEF,0x6C,0x74,0x37,
+	0x50,0x89,0x76,0x3E,0x05,0xD5,0x76,0xDE,0xFA,0x71,0x3B,
+	0xEF,0x52,0xB3,0x9D,0xAB,0xB4,0x23,0xB4,0x23,0x18,0x4A,
+	0x27,0x42,0x17,0x59,0x4C,0x64,0x16,0xA1,0x77,0x03,0xB5,
+	0x98,0xD0,0x7B,0x01,0x3E,0x23,0xB4,0x3F,0x30,0x3B,0x08,
+	0xF4,0x7E,0xA0,0xBA,0x08,0x74,0x00,0x40,0x37,0x81,0xC6,
+	0x03,0x8C,0x17,0xE8,0xC3,0x20,0x6B,0x14,0xE8,0xA3,0x40,
+	0x81,0x77,0x9A,0x04,0x54,0xB8,0x48,0xA7,0x03,0xD5,0x13,
+	0xA9,0x7E,0x22,0x4D,0x01,0x2A,0x16,0xA9,0xB1,0x22,0x9D,
+	0x0B,0xD4,0x74,0xA4,0x16,0x88,0x74,0x21,0x50,0x1E,0xA4,
+	0xD6,0x88,0x74,0x19,0x50,0x2F,0x20,0xB5,0x41,0xA4,0x1E,
+	0xA0,0x3E,0x46,0xEA,0x4B,0x91,0x3E,0x0B,0x54,0x39,0x52,
+	0x35,0x22,0xCD,0x06,0xEA,0x9F,0x22,0xEF,0x59,0x50,0xA4,
+	0x23,0xED,0x60,0x59,0x94,0x03,0xD8,0x3A,0x33,0xBE,0xCE,
+	0x94,0xAE,0x05,0x95,0xDE,0x94,0xEE,0x07,0x78,0x10,0x99,
+	0x31,0x94,0xDB,0xF5,0x08,0xCA,0xA7,0x6E,0x1C,0xE5,0x9D,
+	0x7F,0x94,0x52,0x09,0xCA,0xFD,0x85,0xD2,0x8D,0x00,0x25,
+	0x08,0x01,0x04,0x9B,0xC4,0xE1,0x01,0x84,0xF9,0x08,0xAF,
+	0x20,0x7C,0x85,0x70,0x49,0xC2,0x29,0x90,0xE8,0x0D,0x68,
+	0xC8,0x68,0xE0,0x6B,0x64,0x35,0xF0,0x35,0x6A,0x6F,0xE0,
+	0xB3,0xDB,0xC5,0xC0,0xFB,0xE9,0x34,0x50,0x27,0x6C,0x84,
+	0xBB,0x0D,0xB4,0x37,0xC0,0xFD,0x06,0x7A,0x37,0xC0,0x20,
+	0x03,0x1D,0x01,0x90,0x62,0xA0,0xA4,0x9D,0x89,0x3C,0x6D,
+	0xE0,0x63,0xC8,0x42,0x28,0x34,0xD0,0x44,0x80,0xD7,0x0C,
+	0x74,0x30,0xC0,0x05,0x03,0xED,0x07,0xB5,0x44,0x19,0x39,
+	0x24,0x23,0x94,0x18,0xB9,0xCA,0x1D,0x26,0x3A,0x06,0x6A,
+	0x51,0x4C,0x74,0x04,0x50,0x2F,0x9B,0x68,0x02,0xC0,0x47,
+	0x48,0x6D,0x47,0xEA,0xB2,0x89,0xDE,0x1F,0x02,0xE5,0xCC,
+	0xBC,0x6A,0x2F,0x42,0x32,0x6E,0xFB,0xBD,0x0E,0x7A,0x80,
+	0xD9,0x84,0x83,0x7E,0x0B,0x50,0xE7,0xA0,0x35,0x00,0xF5,
+	0x0E,0xFA,0x1D,0xB3,0x10,0x07,0xAD,0x00,0x58,0x47,0xB8,
+	0xD9,0x98,0x04,0xBE,0x37,0x3B,0x0A,0x7C,0xA7,0xF6,0x14,
+	0xF8,0xE6,0x9A,0x8C,0xD4,0x4C,0x94,0x15,0x20,0xB5,0x57,
+	0xE0,0x05,0xF6,0x0B,0xDC,0xCE,0xCE,0x08,0x7C,0x26,0x74,
+	0x81,0x26,0x80,0x27,0xBA,0x8A,0x32,0xB0,0x10,0x06,0x36,
+	0xCA,0x61,0x05,0xE5,0x2A,0x99,0x94,0xFE,0x19,0x54,0x3E,
+	0xA6,0xF4,0x9E,0x70,0xBE,0x1C,0x0C,0x0E,0x52,0xBA,0x19,
+	0x98,0xA7,0x28,0xAD,0x71,0x98,0xC8,0x04,0x89,0x7E,0x03,
+	0xD4,0x32,0x89,0xD6,0x02,0xFC,0x24,0xD1,0xD3,0x00,0x0D,
+	0x12,0x97,0x85,0x1B,0x38,0x24,0x19,0xB8,0xCA,0x5A,0x03,
+	0x2F,0x5E,0x6D,0xE0,0x66,0xB3,0xDD,0x22,0x90,0x4E,0x26,
+	0x72,0xC5,0x22,0xDC,0x01,0x10,0x1F,0x2A,0x0C,0x04,0xF8,
+	0x4B,0xA8,0xF0,0x28,0xC0,0xC5,0x50,0x61,0x19,0xC0,0x36,
+	0x2B,0x3D,0x07,0x9D,0x28,0xB2,0xD2,0x7A,0x80,0x32,0xA4,
+	0x2A,0xAC,0x34,0x52,0x82,0x7D,0x64,0xE5,0xBB,0xA3,0x0E,
+	0x99,0x97,0x10,0xA8,0x8D,0x43,0x07,0x84,0x3B,0x11,0xFA,
+	0x21,0xAC,0x41,0xC8,0xB7,0xF1,0xCA,0xDE,0x40,0xEA,0x3D,
+	0x1B,0xAF,0xEC,0x43,0x1B,0xAF,0xAC,0xC4,0x46,0x2F,0xB1,
+	0x59,0x42,0xD9,0x3F,0x11,0x7E,0x42,0xB8,0x8A,0x60,0xB2,
+	0x73,0x08,0x43,0xB8,0x0D,0xE1,0x7E,0x84,0x87,0x10,0xB6,
+	0xDB,0xE9,0xD7,0x00,0xC5,0x76,0xBA,0x99,0x39,0x16,0x3B,
+	0x5F,0xC6,0x4A,0x64,0x46,0x3B,0xE8,0x7E,0x80,0x61,0xB8,
+	0xB6,0xA3,0x71,0xA5,0x27,0xE1,0xA2,0xCE,0xC4,0x95,0x9E,
+	0x8B,0x2B,0xBD,0xC8,0x41,0x0F,0x33,0xFF,0x82,0x9A,0xB2,
+	0x43,0xC8,0x87,0x09,0xF9,0x1B,0x2B,0x2E,0x92,0x2D,0x76,
+	0x2A,0x92,0xBF,0xDB,0x61,0x4A,0x6B,0xED,0xF4,0x53,0x10,
+	0x6F,0x72,0x08,0xBD,0x3A,0x83,0xC7,0x30,0xD3,0x42,0xB6,
+	0xB1,0xCC,0x34,0x17,0x60,0xB8,0x99,0x3A,0x0C,0xE0,0x5E,
+	0xCD,0xD4,0x0C,0xDB,0xEC,0x84,0x99,0x6F,0xB3,0x80,0x99,
+	0x6F,0x3A,0x31,0x84,0x6F,0x41,0x7B,0x08,0xED,0x07,0xCC,
+	0xCE,0x21,0xB4,0x3F,0x40,0x0C,0x52,0xC3,0x91,0xF2,0x20,
+	0xB5,0x0A,0xA9,0x9C,0x10,0x3A,0x10,0x40,0x09,0xE1,0xED,
+	0xBD,0x1E,0xC2,0x2B,0x7B,0x0F,0xE1,0x43,0xD4,0xDC,0x85,
+	0x94,0x8A,0x50,0x8E,0x9A,0x35,0x48,0xFD,0x80,0x70,0x16,
+	0xE1,0x02,0x42,0x23,0xC2,0x0D,0x04,0x83,0x85,0x83,0x03,
+	0xA1,0xA3,0x85,0xB7,0xD7,0x1B,0xA9,0xBE,0x08,0x0F,0x21,
+	0xC4,0x20,0x24,0x20,0x8C,0xC6,0xF8,0x36,0x0D,0xA9,0xD9,
+	0x08,0xF3,0x11,0x96,0x22,0x64,0xA0,0xCA,0x6A,0x0B,0x1F,
+	0x8A,0x82,0xCC,0x17,0x2D,0x7C,0x5E,0xAA,0x90,0xBA,0x80,
+	0x20,0x61,0xA0,0x79,0x18,0xE1,0xA9,0x50,0x5E,0x20,0x23,
+	0x94,0xF7,0x25,0x13,0x29,0x05,0x65,0xEB,0x91,0xFA,0x10,
+	0xE1,0x13,0x84,0x7D,0x08,0xDF,0xA2,0xCA,0x3F,0x91,0xD2,
+	0x11,0xAE,0x23,0x0C,0xB2,0xF2,0x80,0x98,0x68,0xE5,0x75,
+	0xA6,0x5A,0x79,0xB0,0x5C,0x6E,0xA5,0x15,0x00,0xFF,0xB0,
+	0x62,0x5F,0x10,0x46,0xD9,0xE9,0x27,0x2C,0x86,0x21,0xCC,
+	0xB2,0xF3,0x80,0xBF,0xD6,0xCE,0x87,0xF2,0x99,0x9D,0x26,
+	0x80,0xCA,0x1E,0x3B,0x1D,0x01,0x50,0x83,0x56,0x00,0x49,
+	0x26,0x33,0x19,0x0B,0xE1,0x26,0x03,0x51,0xE4,0x4D,0xE6,
+	0xEE,0x08,0x37,0xBC,0x1E,0xC8,0xEC,0x4F,0x84,0x3D,0x60,
+	0x47,0xCB,0x50,0xF6,0x12,0xE1,0xF6,0xF2,0x15,0xA1,0x2F,
+	0x03,0x94,0x13,0x9A,0x0C,0x7B,0xA1,0x02,0x99,0x17,0x09,
+	0xCD,0x67,0x19,0x82,0x40,0xD7,0x01,0xF4,0x11,0xE8,0x06,
+	0x80,0x07,0x05,0x2E,0x1B,0x2E,0x70,0xD9,0x1A,0x81,0x97,
+	0xCB,0x05,0x4F,0x03,0xE5,0x9E,0x47,0xD9,0x66,0x81,0x7E,
+	0xCC,0xF6,0xAC,0x40,0xB7,0x00,0xFC,0x43,0xE0,0xDD,0xDD,
+	0x87,0x32,0x0D,0x65,0x27,0x04,0xFA,0x1A,0xC0,0x29,0x81,
+	0x7A,0x24,0xEE,0x85,0x98,0xEC,0x02,0x6A,0xFE,0x8A,0xE5,
+	0x9A,0x11,0x1E,0x16,0x39,0x8C,0x16,0xB9,0x6C,0x32,0x42,
+	0x0A,0x32,0xE7,0x21,0xB5,0x58,0xE4,0x95,0x3D,0x23,0xD2,
+	0x02,0xA8,0x6C,0x05,0xCA,0xDE,0x41,0xF8,0x2B,0xAA,0x7C,
+	0x82,0x2A,0x9F,0x8B,0xF4,0x6D,0x50,0xD9,0x83,0xB2,0xF3,
+	0x08,0xBF,0xA2,0x4A,0x47,0x0C,0x49,0xDD,0x28,0x67,0xDE,
+	0x85,0x54,0x5F,0xCA,0xCB,0x41,0xB8,0xFA,0x14,0xCA,0x45,
+	0xA3,0x6C,0x38,0xCA,0xC6,0x52,0xDE,0xEB,0x19,0x08,0x8B,
+	0x90,0xE9,0xC1,0x02,0x2B,0x29,0xF5,0x43,0x81,0xD5,0x58,
+	0x60,0x2D,0xCA,0xFE,0x89,0xB2,0x1F,0x28,0xFD,0x81,0x0D,
+	0x1A,0x65,0x57,0x51,0x66,0x90,0x38,0x74,0x40,0x58,0x2A,
+	0x09,0xF5,0xB0,0x46,0x1F,0x4A,0x7C,0x17,0x1B,0x0C,0x1C,
+	0x62,0x0D,0x34,0x04,0x36,0xF3,0x63,0x06,0x6A,0x05,0x98,
+	0x66,0xE4,0xCC,0x4B,0x26,0x0E,0x94,0x6D,0x7B,0x91,0xEC,
+	0x33,0x83,0x57,0x38,0x6E,0x06,0xAF,0x70,0xD1,0x4A,0x5F,
+	0x03,0x5B,0xF9,0xD5,0x4A,0x77,0x80,0xB2,0xD5,0xC6,0x2D,
+	0x27,0xDC,0xC6,0x6B,0xBF,0xD7,0x46,0xDF,0x04,0xAA,0xAF,
+	0x8D,0x1E,0x01,0xD9,0x40,0x9B,0x50,0x33,0x10,0x32,0x00,
+	0x9B,0xE0,0x07,0x58,0x6F,0xA3,0x8D,0x20,0x7B,0xD7,0xC6,
+	0x8B,0x7F,0x60,0xA3,0x9D,0x8D,0x30,0x7B,0x36,0xFA,0x32,
+	0x50,0x3B,0x10,0x0E,0x62,0xF1,0x6F,0x6C,0x74,0x2C,0xC8,
+	0xCE,0x22,0xF3,0x17,0x2C,0x70,0xD9,0x46,0xE7,0x02,0xB3,
+	0xC9,0x46,0x5F,0x05,0x2A,0x68,0xA3,0x7F,0x01,0x30,0xDA,
+	0xB9,0x4A,0x04,0x9A,0xEF,0x03,0xE0,0x06,0x01,0x06,0xDA,
+	0xB9,0xEC,0x29,0x3B,0x2F,0xB7,0xC4,0x4E,0x57,0x41,0xB9,
+	0x15,0xA8,0xF9,0x36,0x6A,0xFE,0x15,0x35,0xB7,0xD9,0x79,
+	0x65,0xA7,0x50,0xF3,0x2C,0x6A,0xD6,0xA3,0xE6,0x3F,0x4C,
+	0xF4,0x6D,0x18,0xD1,0x51,0x93,0xF0,0x2D,0x38,0x3F,0x1D,
+	0xA9,0x8E,0x66,0x0E,0x8F,0x98,0x05,0x63,0x17,0x13,0x79,
+	0x12,0xA9,0x02,0x33,0xBD,0x02,0xF3,0xF2,0x92,0x99,0x3E,
+	0x03,0x83,0x5E,0x6F,0xA6,0x2B,0x00,0xDE,0x31,0xD3,0x04,
+	0x80,0xAF,0xCD,0x7C,0xD0,0xA7,0x11,0x2E,0x9A,0x79,0x82,
+	0x2B,0x84,0x70,0xB8,0x23,0x44,0xD8,0x06,0xF3,0xF2,0x20,
+	0x52,0x63,0x43,0x78,0xCF,0x9E,0x43,0xEA,0x25,0xA4,0x3E,
+	0x46,0x6A,0x27,0xC2,0x57,0x08,0x95,0x08,0xC7,0x11,0x2C,
+	0x98,0x96,0x77,0x44,0xE8,0x89,0x70,0x3F,0xC2,0xA3,0x08,
+	0x8F,0x23,0x2C,0x42,0x58,0x81,0xF0,0x0E,0xC2,0x47,0x08,
+	0x7F,0x47,0x50,0x11,0x0E,0x21,0x7C,0x8F,0x20,0x60,0x5A,
+	0x6E,0x43,0xB8,0x0D,0xE1,0x2E,0x84,0x7E,0x08,0x33,0x10,
+	0xE6,0x23,0xA4,0x21,0x64,0x21,0xC8,0x08,0x7F,0x43,0xD8,
+	0x83,0xA0,0x23,0x5C,0x41,0x20,0x56,0x0E,0x56,0x84,0x2E,
+	0x56,0x3E,0xF6,0x58,0x06,0x66,0x12,0x0F,0xC6,0x07,0xD9,
+	0xD6,0x48,0x2B,0x0F,0x2D,0x0B,0x50,0x06,0xC9,0xF6,0x2B,
+	0xEC,0x34,0x80,0x00,0x39,0x37,0x5B,0xB1,0x0D,0x68,0x98,
+	0x90,0x73,0xBF,0x05,0x33,0xBF,0xD5,0xCA,0x6D,0x09,0xA2,
+	0xFC,0xDB,0x40,0x7D,0x61,0xE5,0x36,0xB1,0xCB,0xCA,0x17,
+	0xDC,0x8F,0x95,0x1D,0xC2,0xCA,0xBE,0xC7,0x72,0xC7,0xAC,
+	0x74,0x13,0x68,0xEA,0x56,0x6E,0x1A,0x8F,0x11,0xDA,0x05,
+	0x28,0x95,0xD0,0x6E,0x00,0x21,0x02,0xED,0xC4,0x56,0x4C,
+	0xA0,0x56,0x36,0x76,0x84,0x48,0x84,0xFE,0x02,0x0D,0x01,
+	0x88,0x17,0x68,0x38,0xC0,0x28,0x81,0x86,0x01,0x4C,0x40,
+	0xE6,0x2C,0x64,0xCE,0x43,0xE6,0x33,0x58,0xE0,0x59,0x94,
+	0xF9,0x10,0x0A,0x05,0xE1,0x5C,0x3F,0x08,0x7A,0xA8,0xF2,
+	0x01,0x16,0xF8,0x0C,0x35,0x9F,0x41,0xFF,0x01,0x89,0x71,
+	0x12,0x50,0x7B,0x11,0x4A,0x45,0xEE,0x1F,0xBF,0x11,0xB9,
+	0xEF,0xAC,0x41,0xA6,0x89,0x72,0xB8,0x13,0x12,0x63,0x80,
+	0xE9,0x48,0x81,0xC7,0x18,0x0B,0xF0,0x3C,0x52,0x1F,0x21,
+	0x9C,0x42,0xF8,0x15,0xE1,0x3A,0xA5,0x13,0x99,0xF5,0x48,
+	0xDC,0x84,0x6F,0x97,0x68,0x04,0x8C,0xB6,0xA7,0xC4,0x6D,
+	0x77,0xA6,0x44,0x13,0x01,0x5E,0x93,0xE8,0xA3,0x00,0x6F,
+	0x49,0x74,0x16,0xC0,0xBB,0xC8,0xFC,0x54,0xE2,0xA6,0x5F,
+	0x2E,0x09,0x43,0x60,0x77,0x98,0x0D,0x9C,0xBA,0xD3,0x40,
+	0x9F,0x00,0x59,0x0C,0x52,0x93,0x10,0xD2,0x0D,0xF4,0x45,
+	0x68,0xA1,0x00,0x61,0x3D,0xC2,0x97,0x08,0x55,0x08,0x3F,
+	0x20,0xDC,0x63,0xE4,0x30,0x1C,0x61,0x1C,0xC2,0x3A,0x23,
+	0x7D,0x8B,0xF9,0x5C,0x84,0x0F,0x90,0xB9,0xD5,0x48,0xFF,
+	0x0C,0xD4,0x0E,0x23,0x6F,0xE1,0x00,0xC2,0x61,0x64,0xFE,
+	0x88,0x94,0xD5,0x24,0x2C,0x83,0x9E,0x75,0xC5,0x7D,0x3B,
+	0xD0,0xC4,0xCB,0x0D,0x45,0x6A,0x0E,0xC2,0x33,0x26,0xE1,
+	0x5D,0x50,0x59,0x8D,0xD4,0x8B,0x08,0x6F,0x23,0xC4,0x86,
+	0xD2,0x8E,0x90,0x34,0xE7,0x84,0xD2,0xCE,0x00,0x2F,0x85,
+	0xD2,0xDE,0x00,0x6F,0x86,0xD2,0x3B,0x00,0xB6,0x22,0xF3,
+	0x0B,0x64,0x42,0xAA,0xF8,0x28,0xC0,0x0F,0x08,0xE7,0x11,
+	0x9A,0x11,0x1C,0x36,0xFA,0x38,0x40,0x37,0x1B,0xCF,0xCE,
+	0xEF,0xB1,0xF1,0xEC,0x7C,0x20,0x52,0x71,0x48,0x25,0xD9,
+	0x84,0xA5,0xE3,0x60,0xA7,0xDA,0x84,0x1C,0x80,0x69,0x36,
+	0xE1,0x0D,0x80,0x99,0x36,0xE1,0xAF,0x00,0x4F,0xDB,0x84,
+	0x24,0x80,0x67,0xE0,0x14,0x08,0x9A,0x7F,0x82,0x33,0x21,
+	0xC0,0x5A,0xA4,0x5E,0x40,0xEA,0x2D,0xA4,0x3E,0x44,0xF8,
+	0x1B,0x32,0xBF,0x44,0xAA,0x04,0xA9,0x32,0x1B,0xED,0x0F,
+	0x70,0xC8,0xC6,0x8F,0x16,0xDF,0xDA,0xE8,0x40,0x80,0xA3,
+	0x36,0x1A,0x07,0xA0,0xDB,0xE8,0x13,0x00,0xE3,0xEC,0xBC,
+	0x9F,0x90,0x0C,0xB0,0x93,0xC2,0x4C,0x3B,0xEF,0xD9,0x1C,
+	0x3B,0xEF,0xE7,0x7C,0x3B,0x9D,0x07,0xF0,0xB4,0x9D,0x6B,
+	0x3E,0x63,0xE7,0x87,0x90,0x7C,0x3B,0x1F,0xDF,0x6B,0x08,
+	0x45,0x76,0x9A,0x04,0x70,0x06,0xA9,0x3A,0x2C,0xF0,0x2B,
+	0x52,0xA2,0x83,0x57,0x6D,0x76,0x70,0x95,0x70,0x07,0x2F,
+	0x3E,0xD8,0xC1,0x65,0x23,0x11,0xE6,0xA1,0xEC,0x69,0xA4,
+	0x5E,0x40,0xEA,0x2D,0xA4,0x3E,0x44,0xD8,0x81,0xB5,0x7C,
+	0x89,0xB2,0x7D,0x58,0xCB,0x21,0x07,0x1F,0xE6,0xB7,0x0E,
+	0x3E,0xCC,0x23,0x0E,0x3E,0xCC,0x53,0x0E,0x3E,0xBE,0x9F,
+	0x1C,0x7C,0xB4,0xE7,0x1D,0x7C,0x98,0x41,0xAC,0xE5,0x3D,
+	0xD8,0x55,0x00,0xDB,0x10,0xFC,0x02,0x4F,0x53,0x24,0x51,
+	0x08,0x1B,0x0A,0xC9,0xAA,0xC8,0x8F,0x86,0x1D,0x45,0xCE,
+	0x8C,0x47,0x2A,0x4D,0xE4,0x9A,0x70,0x5A,0x35,0x33,0x2B,
+	0x10,0x69,0x98,0x9D,0xEF,0x46,0x06,0x87,0x45,0x61,0x38,
+	0x94,0xAB,0x45,0xCD,0x5E,0x54,0x70,0x03,0x75,0x1F,0x1E,
+	0x30,0x97,0x50,0xE1,0x83,0xA1,0xFC,0x98,0xC3,0xA8,0xCF,
+	0xA9,0x50,0x03,0xD4,0x97,0x48,0x7D,0x45,0x79,0xF1,0x93,
+	0x94,0x36,0x33,0xCF,0x27,0x71,0x80,0xC3,0x27,0x01,0x66,
+	0x3F,0x49,0xB0,0xC4,0x81,0x99,0x4A,0x5C,0x73,0xA4,0xC4,
+	0x35,0x4B,0x24,0x61,0x30,0x30,0x3B,0x1A,0x84,0x25,0x00,
+	0x03,0x0C,0x5C,0xF6,0x93,0x41,0xD8,0x00,0xD4,0x65,0xA4,
+	0xC6,0x19,0x85,0x2A,0xA0,0xA6,0x1B,0x39,0xB5,0xC1,0x28,
+	0x48,0xC3,0xF8,0x26,0x61,0xD4,0x17,0x46,0x5E,0x4B,0x94,
+	0x49,0x18,0x00,0xCC,0x58,0x13,0x67,0x8E,0x36,0x71,0xE6,
+	0x0C,0x33,0xFD,0x04,0x22,0xDE,0x6C,0x33,0x3F,0xA0,0x7C,
+	0x61,0xA6,0x4E,0x60,0xEE,0x36,0xD3,0x2E,0x00,0xC5,0x66,
+	0xBE,0x03,0x2A,0x91,0x59,0x83,0xCC,0x7A,0x33,0x2D,0x83,
+	0x02,0x86,0x10,0x2E,0x0B,0x0D,0xE1,0x54,0x64,0x08,0xBD,
+	0x07,0xA8,0x44,0xC8,0xB4,0xD9,0x6A,0x22,0xD3,0x83,0x2A,
+	0xCF,0x86,0xF0,0xBD,0x92,0x1D,0xC2,0x77,0x4E,0x41,0x08,
+	0x0D,0x07,0x78,0x17,0x29,0x08,0x6E,0x9D,0xD8,0xF4,0x60,
+	0x81,0xE2,0x10,0xBE,0x9D,0xBE,0x86,0x74,0x9F,0xAD,0x26,
+	0x42,0x2D,0x32,0xCF,0x23,0xD5,0x8C,0x94,0xCD,0x22,0xD4,
+	0x26,0x82,0x8B,0xB5,0x70,0xE6,0x4C,0x0B,0x67,0x3E,0x81,
+	0xD4,0x53,0x16,0xDE,0xDE,0x5F,0x2C,0xBC,0xF5,0x1F,0x10,
+	0xFA,0xE2,0x86,0x4D,0xB3,0x71,0x2B,0xC8,0x46,0x78,0x1E,
+	0xE1,0x1D,0x84,0x6F,0x10,0x4E,0x20,0x74,0x40,0xDB,0xED,
+	0x81,0x30,0x01,0x21,0x05,0x21,0x0B,0xA1,0x00,0xE1,0x63,
+	0x84,0x9D,0x08,0x5F,0x21,0x54,0x22,0xB4,0xEE,0x87,0xD6,
+	0x8D,0x30,0x17,0x6D,0x70,0x29,0x42,0x16,0x42,0x01,0xC2,
+	0x9B,0x08,0x5B,0x10,0x76,0x22,0x7C,0x85,0x70,0x12,0xE1,
+	0x02,0xC2,0x0D,0x84,0x78,0x23,0xDF,0x0F,0x63,0x8C,0x7C,
+	0xC3,0x4E,0x35,0x72,0x63,0x7F,0x1A,0x99,0xCF,0x21,0xFC,
+	0x05,0x65,0x1B,0x90,0xFA,0x10,0x55,0xF6,0x20,0x55,0x6E,
+	0xA4,0x2E,0x80,0x7F,0x22,0x45,0xF1,0xE6,0x41,0x67,0x04,
+	0x27,0x42,0x84,0x89,0xEF,0xB1,0xBE,0x48,0x0D,0x45,0x48,
+	0x40,0xE6,0x38,0xA4,0x1E,0x33,0xF1,0x5A,0x16,0xE2,0x4D,
+	0x87,0x74,0x13,0xAF,0x6C,0x15,0xCA,0x72,0x4C,0xBC,0xBD,
+	0x57,0x90,0xFA,0xD2,0xC4,0xF7,0x6D,0x29,0x6A,0x6A,0xA8,
+	0xF9,0x3D,0xCA,0xCE,0x9A,0xF8,0x88,0x2E,0x21,0xB4,0x20,
+	0x58,0xCC,0x1C,0xBA,0x9A,0x79,0x2D,0xBD,0xF0,0x0E,0xC6,
+	0xFD,0x66,0x5E,0x2E,0x0E,0x61,0x34,0x32,0x57,0x41,0xBA,
+	0xC5,0xE6,0xCC,0x4C,0xD7,0xA0,0x0D,0xB2,0x72,0x93,0x11,
+	0x66,0x23,0x3C,0x8D,0xF0,0x36,0xC2,0xC7,0x08,0xE5,0x08,
+	0xDF,0x21,0xFC,0x80,0x70,0x1E,0x41,0xB0,0x70,0xB0,0x21,
+	0xF4,0x42,0x88,0x46,0x98,0x80,0xF0,0x38,0xC2,0x52,0x84,
+	0x3F,0x59,0xB8,0x73,0x5C,0x8B,0xD4,0xEB,0x08,0x9B,0x11,
+	0xB6,0x23,0xF8,0x11,0x8E,0x23,0xFC,0x8C,0x40,0x42,0x39,
+	0x40,0x4E,0xC4,0x3C,0x66,0x03,0xC2,0x4A,0x2B,0xAF,0xEC,
+	0xCF,0x18,0x42,0x5E,0x44,0xD8,0x80,0xF0,0x29,0x42,0x30,
+	0xC8,0xE1,0x36,0xC2,0xA7,0xB5,0x17,0xC2,0x03,0x84,0xCF,
+	0x4B,0x7F,0xC2,0xD7,0x68,0x10,0xE1,0xCE,0x71,0x04,0xE1,
+	0xCE,0x71,0x3C,0xE1,0xCE,0x71,0x1A,0xE1,0xCE,0xF1,0x09,
+	0xC2,0xA7,0x75,0x11,0xE1,0xCE,0x31,0x8B,0xF0,0xCA,0x72,
+	0xB1,0x96,0xE7,0xB1,0xDC,0x7A,0x2C,0xB7,0x09,0xCB,0x7D,
+	0x8C,0xE5,0xFE,0x8E,0xE5,0x8A,0xB1,0xDC,0x19,0x22,0xD4,
+	0x8E,0xE1,0x47,0x39,0xD6,0xDD,0xEB,0x58,0x4B,0x2F,0x81,
+	0x53,0x0F,0x20,0xC4,0x21,0x4C,0x44,0x98,0x8F,0xB0,0x04,
+	0x61,0x3D,0xC2,0x46,0x84,0x06,0x41,0x68,0x1E,0xC3,0x4F,
+	0x66,0x8C,0xEA,0x2D,0x72,0x78,0x50,0x14,0xBA,0x8C,0xE5,
+	0xB7,0x0E,0xE7,0x02,0xB5,0x0C,0x99,0x7F,0x43,0xD8,0x85,
+	0xF0,0x10,0xE5,0x00,0xC7,0xA7,0x89,0x00,0x93,0x10,0x66,
+	0x20,0xF8,0x28,0x2F,0xF7,0x02,0xAA,0x6C,0x40,0xE6,0x5F,
+	0x91,0xFA,0x02,0x41,0x45,0xA8,0x44,0x38,0x89,0x70,0x1E,
+	0xA1,0x89,0xD2,0x0A,0xF0,0x4B,0x7D,0x25,0xBE,0x2A,0x03,
+	0x24,0x3E,0x3D,0x83,0x25,0x3E,0x3D,0xC3,0x25,0x3E,0x3D,
+	0xA3,0x91,0x4A,0x92,0xF8,0xD8,0x93,0x25,0x7A,0x9B,0xC9,
+	0x44,0xDE,0x90,0x78,0xF1,0x5A,0x64,0x5E,0x40,0xEA,0x09,
+	0x03,0x87,0x23,0x06,0x6E,0xF3,0x27,0x0D,0x7C,0x23,0x9C,
+	0x45,0x08,0x20,0x5C,0xC4,0x3B,0x81,0xCD,0x08,0xD4,0xC8,
+	0x99,0x4E,0xDC,0xC5,0x77,0x23,0x3C,0x8C,0x70,0x21,0x84,
+	0x3A,0x43,0x20,0xB4,0x5A,0xF8,0x4A,0xDF,0x87,0x30,0xCC,
+	0xC2,0x99,0xE3,0x11,0x64,0x84,0x8F,0x2D,0xF4,0x8E,0x10,
+	0x6E,0x83,0xBD,0x01,0xBE,0xB4,0xD0,0x2E,0x21,0x3C,0xC9,
+	0x67,0x32,0x63,0x28,0x75,0x33,0x7F,0x1D,0xCA,0x65,0x8B,
+	0x43,0x39,0xF3,0xAD,0x50,0x5E,0xE0,0x83,0x50,0xAE,0x59,
+	0x8A,0xB2,0x6F,0x50,0x76,0x03,0x65,0x46,0x2B,0x97,0x4D,
+	0xB0,0x72,0xD9,0x54,0x2B,0x97,0xBD,0x6B,0xE5,0xB2,0x8F,
+	0x50,0x76,0xCA,0xCA,0xBB,0x34,0xD2,0x46,0x17,0xD8,0xF9,
+	0xCD,0xEC,0x45,0x6C,0xAF,0xD8,0x78,0x7B,0xEF,0x20,0xF5,
+	0x3E,0xC2,0x67,0x08,0x3B,0x50,0xB3,0x04,0x29,0x0D,0xA1,
+	0x1A,0xE1,0x08,0xCA,0x2E,0x21,0xD5,0x88,0x10,0x44,0xA6,
+	0xD5,0xCE,0xA9,0xF6,0x08,0xB7,0xD9,0x39,0xF3,0x1E,0x84,
+	0xBE,0xC8,0x9C,0x80,0x30,0x0B,0x61,0x2E,0xC2,0xFB,0x76,
+	0xBA,0x8C,0x65,0x10,0x48,0x7D,0x8B,0x70,0x02,0xE1,0x0C,
+	0x16,0xAF,0x47,0xEA,0x3A,0x82,0xE0,0xE0,0x00,0x69,0x0C,
+	0x93,0xDD,0x81,0x54,0x2F,0x84,0x3E,0xC8,0x1C,0x80,0xD4,
+	0x60,0x84,0x78,0x64,0x3E,0x86,0xD4,0x19,0x07,0x2E,0x1C,
+	0x26,0x2E,0xD7,0x31,0x39,0xB9,0x81,0xBB,0x38,0x04,0x77,
+	0xCE,0x20,0x04,0x17,0xC2,0x24,0x84,0x14,0x84,0x45,0x08,
+	0x7F,0x42,0x58,0x8B,0xF0,0x12,0xC2,0x46,0x84,0x6D,0x08,
+	0x95,0xB8,0x1B,0x57,0x08,0x9C,0x5A,0x83,0xB0,0x19,0x61,
+	0x3B,0x42,0x35,0xC2,0x49,0x84,0x16,0x04,0x8B,0xC8,0xA1,
+	0x0F,0xC2,0xC3,0x08,0xC9,0x08,0x73,0x10,0xFE,0x84,0xB0,
+	0x16,0xE1,0x03,0x84,0xCF,0x11,0xCA,0x11,0xBE,0x43,0xD0,
+	0x11,0xAE,0x20,0x18,0x29,0x87,0xF6,0x08,0x3D,0x11,0x1E,
+	0x40,0x58,0x8C,0xB0,0x12,0xA1,0x00,0x61,0x3D,0x42,0x19,
+	0x42,0x35,0x42,0x00,0xE1,0x2A,0x82,0x03,0x37,0xD7,0xED,
+	0x08,0x51,0x08,0xF1,0x08,0x99,0x08,0xB9,0x08,0x1F,0x23,
+	0xEC,0x44,0xA8,0x43,0xF8,0x15,0xA1,0xAB,0x81,0x43,0x04,
+	0xC2,0x28,0x84,0xC7,0x10,0xB2,0x11,0xD6,0x21,0x7C,0x8C,
+	0xB0,0x13,0x41,0x32,0x0A,0xFD,0xC7,0xF2,0xF3,0x0A,0x5B,
+	0xD4,0x24,0x23,0xB7,0xA5,0xC7,0x30,0xC2,0xA6,0x1A,0xF9,
+	0xBA,0xBF,0x62,0x44,0xF3,0xC6,0x80,0x09,0x39,0x11,0x83,
+	0xC5,0x21,0x5C,0xE5,0x03,0xA4,0xE0,0x40,0xCC,0x1E,0x2A,
+	0x5C,0x40,0x88,0xB0,0x72,0x18,0x89,0xF0,0x14,0xC2,0x56,
+	0x84,0x9F,0x10,0x7A,0xD8,0x38,0x0C,0x43,0x98,0x8B,0xF0,
+	0x09,0xC2,0x4F,0x08,0x90,0xB1,0x70,0x15,0x84,0xB9,0x08,
+	0xEF,0x23,0xD4,0x22,0x74,0x71,0x70,0x18,0x84,0x30,0x13,
+	0xE1,0xAF,0x08,0xB5,0x08,0x89,0x18,0x42,0x5E,0x25,0xF4,
+	0x1E,0xB6,0xA7,0x11,0x8A,0x91,0x79,0x03,0xC1,0x21,0x70,
+	0xE6,0x78,0x84,0xC7,0x11,0x16,0x21,0xAC,0x41,0x78,0x4D,
+	0xE0,0x9A,0x5F,0x22,0x45,0x44,0x4E,0xDD,0x2E,0x72,0x2A,
+	0x01,0x21,0x1B,0x99,0x27,0x10,0x66,0x53,0x21,0x09,0xA6,
+	0x75,0x13,0xE5,0x69,0xC5,0x27,0x94,0x4E,0x07,0x6F,0x5A,
+	0x44,0xE9,0x4C,0x80,0x3D,0xC8,0x2C,0xA7,0x34,0x05,0xA8,
+	0x6F,0x90,0xBA,0x84,0x2A,0xCD,0xE0,0xE7,0x01,0x44,0x89,
+	0x33,0x21,0x95,0x4E,0x35,0xF1,0xDB,0x5D,0x8C,0xEA,0x21,
+	0x71,0xA7,0xF3,0x9C,0xC4,0xFD,0x6E,0x9E,0xC4,0x9D,0xEA,
+	0x4B,0x12,0x1D,0xCB,0xE6,0x05,0xA1,0x04,0xA1,0x9F,0x81,
+	0x43,0x3E,0xC2,0x26,0x04,0x15,0x01,0x1C,0x35,0x9B,0x97,
+	0x6E,0x46,0xBA,0x81,0x85,0x25,0x23,0xA7,0x16,0x22,0x6C,
+	0x46,0xF8,0x11,0xC1,0x64,0xE2,0x2A,0x70,0xEC,0x64,0xD4,
+	0x54,0x84,0x75,0x08,0x9F,0x23,0x7C,0x8B,0xD0,0x84,0x9A,
+	0x26,0x33,0xA7,0xFA,0x22,0x3C,0x8D,0xF0,0x1E,0x42,0x29,
+	0x82,0x8E,0x20,0x85,0xF0,0x02,0xB6,0x10,0x4E,0xC5,0x20,
+	0x4C,0x44,0x66,0x1A,0x52,0x3B,0x11,0xAE,0x20,0x40,0x60,
+	0x60,0x30,0x1E,0x61,0x19,0xC2,0xE7,0x08,0xE7,0x11,0xEE,
+	0x42,0xE3,0x4B,0x44,0x58,0x88,0xF0,0xA8,0x9D,0x3A,0xC3,
+	0x20,0x8A,0x22,0x4C,0x72,0xF0,0x87,0x49,0x5D,0x08,0x9A,
+	0x0D,0xC2,0x4C,0x84,0xB7,0x11,0x8E,0x20,0xB4,0x13,0x38,
+	0x3C,0x84,0x90,0x8C,0xF0,0x1A,0x42,0x15,0x02,0xB8,0x19,
+	0xDE,0x33,0x84,0xF1,0x08,0x85,0x08,0xFB,0x11,0x08,0x3E,
+	0x8E,0xEB,0x85,0x30,0x02,0x61,0x0D,0xC2,0x1E,0x84,0x06,
+	0x84,0x2E,0xF8,0x54,0x6E,0x10,0xC2,0x0B,0x08,0x5F,0x23,
+	0x48,0xB8,0x62,0x11,0x08,0x23,0x11,0xF2,0x10,0xBE,0x42,
+	0xB8,0x81,0xD0,0x03,0x17,0x6E,0x18,0x42,0x3E,0xC2,0x57,
+	0x08,0x37,0x10,0x7A,0xE0,0x8A,0x0D,0x43,0xF0,0x21,0xEC,
+	0x41,0x68,0x40,0xE8,0x82,0x6B,0x34,0x08,0x61,0x0D,0xC2,
+	0x5E,0x84,0xAB,0x08,0xB7,0xFD,0x6E,0xE1,0x56,0x21,0x14,
+	0x21,0xD4,0x23,0xB4,0xC7,0x55,0xE9,0x8F,0xB0,0x1A,0xA1,
+	0x08,0xA1,0x1E,0xA1,0x3D,0xAE,0x51,0x7F,0x84,0x0C,0x84,
+	0x4F,0x11,0x7E,0x42,0x08,0x41,0x77,0x11,0x89,0xB0,0x08,
+	0xE1,0x3D,0x84,0xE3,0x08,0x2D,0x08,0x4E,0xF4,0x1A,0x8F,
+	0x23,0xBC,0x8E,0x50,0x85,0x70,0x05,0xA1,0x13,0x7A,0x8D,
+	0x0E,0x16,0xFA,0x26,0xEC,0xAA,0x6E,0x16,0x7E,0x52,0x04,
+	0xCB,0xAA,0x77,0xC0,0x96,0xB1,0x08,0x83,0x5F,0x37,0x91,
+	0x81,0x48,0xC5,0x5B,0xE8,0x06,0x50,0xB9,0x0A,0xC9,0x02,
+	0x3E,0x7B,0xE8,0x0B,0xD6,0xF3,0x32,0x42,0x8C,0x8D,0xDF,
+	0x70,0x1B,0x8F,0x77,0x89,0xE1,0x04,0x56,0x64,0xE2,0x77,
+	0x32,0x4A,0x01,0x0A,0x6C,0xF4,0x07,0x80,0x97,0x6C,0xB4,
+	0xD1,0xC4,0xEF,0x12,0x5B,0xCC,0x3C,0x4B,0xE8,0x05,0xB0,
+	0xD9,0x46,0xAF,0x38,0xF8,0x43,0x6E,0x06,0x7B,0x41,0x05,
+	0xA0,0x16,0xA1,0x1E,0x41,0xB0,0xF3,0x13,0xFB,0x40,0x3B,
+	0xA7,0xC0,0xF3,0xF5,0x86,0x72,0x2E,0x3B,0xEF,0xA7,0x6C,
+	0x17,0x2A,0xDE,0x84,0x1C,0x1A,0x65,0xA7,0xED,0x82,0xF8,
+	0x96,0x89,0x9C,0x43,0x2A,0xDC,0xC1,0x61,0x2E,0xC2,0xDF,
+	0x10,0xCE,0x23,0x6C,0x26,0xF4,0x3D,0x16,0x30,0x09,0xDF,
+	0x5C,0xBA,0x20,0x50,0x02,0x1B,0x56,0xA0,0xE1,0x61,0xDC,
+	0x91,0x91,0x30,0x6E,0xC9,0x56,0x80,0xAE,0x22,0x7D,0x04,
+	0xC0,0x29,0xD2,0x81,0x00,0xC3,0x90,0x39,0x03,0x55,0xC0,
+	0xAE,0xF7,0x43,0x65,0x1F,0x22,0xB3,0x48,0xE4,0x33,0xB1,
+	0x47,0xA4,0x0F,0x84,0xB1,0x80,0x29,0x44,0xBD,0xCC,0x6F,
+	0xE2,0x45,0x85,0xB1,0x7B,0x09,0xF4,0xE1,0x30,0xEE,0x07,
+	0x99,0xE6,0x69,0x91,0xFE,0xB9,0x23,0x54,0x4D,0x39,0x73,
+	0x19,0xA5,0xF7,0x01,0x64,0x50,0x1A,0x17,0xC6,0x1F,0x99,
+	0x86,0x01,0x3C,0x47,0x69,0xB3,0x83,0xDF,0xFD,0x67,0x9A,
+	0xF9,0x94,0x3F,0x51,0x7E,0x99,0xF2,0x16,0x76,0x22,0x13,
+	0x52,0x5B,0x29,0x8C,0x7B,0x4C,0x33,0xAB,0x93,0x0A,0xE7,
+	0x5E,0x80,0xAC,0x52,0x12,0xEA,0x01,0xEE,0x93,0x78,0xEB,
+	0x23,0x24,0xBA,0xD2,0xC2,0xD3,0xD7,0x81,0x00,0x53,0x90,
+	0x9A,0x09,0xAE,0x12,0xC0,0x2D,0xF1,0x65,0x7C,0x0B,0xE1,
+	0x23,0x89,0xF6,0x66,0x8F,0xDD,0x24,0xBA,0x08,0xD6,0x48,
+	0xC7,0x02,0xBF,0xA0,0xEC,0x6E,0x03,0xDD,0x05,0xD4,0xF7,
+	0x06,0xE1,0xF1,0x57,0xC0,0x26,0x8C,0x74,0x1A,0x30,0x9F,
+	0x35,0xD2,0x0A,0xE8,0x60,0x91,0x91,0x7E,0x0D,0x70,0x04,
+	0xA1,0x1E,0x65,0x0D,0x28,0x13,0x4C,0xF4,0x5B,0x00,0x33,
+	0xC2,0x58,0x84,0x47,0x4D,0x5C,0xB6,0x1E,0xA9,0x77,0x4C,
+	0xBC,0xDC,0x87,0x48,0x7D,0x8A,0xD4,0x2E,0x54,0x51,0x91,
+	0xAA,0x45,0x59,0x3D,0xC2,0x3C,0xB3,0xE0,0x7C,0x0D,0x64,
+	0x08,0xC3,0x43,0xF8,0x03,0x62,0x77,0x08,0x9F,0xB3,0xD5,
+	0x21,0xF4,0x38,0x50,0x1B,0x91,0xFA,0x04,0xA9,0x1D,0x21,
+	0xF4,0x04,0x80,0x84,0x76,0x6D,0x47,0xB8,0x44,0xB8,0xE7,
+	0x7B,0x45,0xA0,0x5D,0x00,0x36,0x20,0x7C,0x24,0xD0,0x3B,
+	0x00,0x76,0x08,0x74,0x19,0x8C,0x61,0xB7,0x40,0x17,0x85,
+	0xF3,0xC7,0x4B,0x17,0x80,0x79,0x5E,0xA0,0x15,0x00,0x36,
+	0x91,0x53,0x1D,0x11,0xA2,0x45,0xBE,0x2A,0x43,0x90,0x4A,
+	0x41,0x6A,0x3E,0xC2,0xCB,0x22,0x1D,0xCB,0x1E,0xF3,0x89,
+	0x74,0x64,0x38,0x7F,0xA0,0xC4,0x96,0xEA,0x7D,0x91,0x2F,
+	0xD5,0x16,0x91,0xBA,0x81,0xB9,0x5D,0xA4,0x33,0x01,0x76,
+	0xA2,0x0A,0x98,0x4D,0x12,0x7B,0xFC,0x29,0xF2,0x66,0xF7,
+	0x63,0x71,0x0D,0x12,0x2C,0x80,0x2A,0x91,0x77,0x29,0x5B,
+	0xE2,0x05,0x7A,0x18,0xE8,0xE3,0x6C,0xFF,0x19,0xF8,0xE2,
+	0xBC,0x8A,0xB0,0xCB,0xC0,0xD7,0x6F,0x2F,0x42,0x35,0xC2,
+	0x31,0x04,0x1D,0xE1,0x61,0x4A,0xC7,0x42,0xEB,0x43,0x0D,
+	0x74,0x45,0x38,0xBF,0x79,0xBB,0x0A,0xE0,0x30,0xCE,0xF5,
+	0x71,0x9C,0xEB,0xCB,0x08,0xD7,0x70,0xAE,0x83,0x26,0xBE,
+	0x9A,0x21,0x66,0x0E,0x4E,0x33,0xD7,0x84,0x38,0xC6,0x54,
+	0xA2,0x91,0x9A,0x8A,0xD4,0x01,0x38,0xCD,0x43,0xD5,0x27,
+	0x91,0x82,0x23,0x37,0x83,0x38,0x0B,0x87,0xC9,0x08,0xF3,
+	0x2D,0xDC,0x76,0xDD,0x16,0xDA,0x0F,0x20,0xC7,0xC2,0x37,
+	0x90,0x82,0x70,0xCC,0x42,0x9F,0x03,0x83,0x76,0x84,0x52,
+	0x2F,0xC0,0xED,0x08,0x2F,0x85,0xF2,0x02,0x6F,0x86,0xF2,
+	0xED,0xF4,0x59,0x28,0x9D,0x06,0x50,0x85,0x4C,0x8B,0x95,
+	0xB7,0x17,0x6E,0xE5,0xC5,0xA3,0xD0,0x05,0x7D,0x8D,0xF0,
+	0x9D,0x95,0x17,0x38,0x81,0xD4,0x59,0xD4,0xAC,0x47,0xCD,
+	0x2E,0x36,0xCE,0xBC,0xC7,0xC6,0x3B,0x11,0x6D,0xE3,0xCC,
+	0xE1,0x08,0x19,0x36,0xDE,0xCF,0x87,0xED,0x42,0xD8,0x1E,
+	0x98,0x6B,0x07,0x9D,0x17,0xCE,0xEF,0x55,0x2E,0x00,0xF8,
+	0xC0,0xC1,0xCB,0x6D,0x75,0xF0,0x4E,0x68,0x0E,0xE1,0x21,
+	0xD8,0x5C,0x55,0x0E,0xE1,0x1E,0x80,0x1A,0x04,0xD8,0x7A,
+	0x23,0x40,0x76,0x07,0x02,0x9C,0xD8,0x47,0x02,0x3C,0x88,
+	0xD4,0x40,0xA4,0x1E,0x16,0xE8,0x06,0x70,0x5D,0x7F,0x17,
+	0x68,0x26,0x80,0x55,0xE4,0xD4,0xEB,0x08,0x97,0x44,0xBE,
+	0x1C,0xE1,0x94,0x77,0xB7,0x2B,0x42,0x1F,0xDC,0xEF,0x0F,
+	0x52,0x3E,0xA2,0xF1,0x48,0xAD,0x47,0xD8,0x41,0x79,0xAF,
+	0x77,0x23,0xD8,0x25,0xEE,0xBA,0x3A,0x49,0x5C,0xF6,0xA4,
+	0xC4,0x99,0x8B,0x11,0x0E,0x21,0xF3,0x88,0xC4,0x6B,0x99,
+	0x6E,0xE0,0xFE,0x6C,0xB1,0x81,0x4E,0x0F,0xE3,0x86,0xB2,
+	0x0C,0xA0,0xD6,0x40,0xF7,0x85,0xF1,0x9B,0x8D,0x8C,0x6A,
+	0x41,0x6A,0x91,0x51,0x08,0x29,0x03,0x19,0x42,0x57,0x0B,
+	0xDD,0x1F,0xC6,0x9F,0xA8,0xB3,0xCA,0x56,0x22,0xF5,0x3A,
+	0xC2,0xF7,0x16,0x9A,0x19,0xCE,0xDE,0xC5,0xE0,0x96,0x75,
+	0x0D,0x16,0x9C,0xD5,0x82,0xCC,0xC9,0xA1,0x9C,0x39,0x2B,
+	0x94,0x33,0xDF,0x40,0xEA,0x10,0x52,0xA7,0x71,0x35,0x21,
+	0x17,0x5E,0xD3,0x91,0xBF,0x66,0xC5,0xA8,0x5D,0x48,0x1D,
+	0x45,0xEA,0x05,0x1B,0xA7,0xF6,0xE2,0xC2,0x8D,0xB2,0x73,
+	0xEA,0x57,0x3B,0xA7,0x5A,0xEC,0x7C,0x19,0x4D,0xB8,0x38,
+	0x9D,0x11,0x22,0x1C,0x7C,0x98,0x0F,0x20,0x35,0x14,0xA9,
+	0x51,0x0E,0x5E,0x6E,0xB2,0x83,0x1E,0x80,0x25,0xCE,0x77,
+	0xD0,0xFD,0x2C,0x02,0x21,0x53,0x75,0xD0,0x0B,0x66,0xB6,
+	0x9A,0xBC,0xC0,0x71,0x2C,0xF0,0x13,0xCA,0x3A,0x13,0x7A,
+	0xD4,0xC6,0x9F,0x7E,0x33,0x88,0x40,0x78,0x00,0xE1,0x61,
+	0x84,0x04,0xC2,0x1F,0x31,0xAD,0x41,0x28,0x84,0xB8,0xC2,
+	0x1E,0xBD,0x11,0xFA,0xAD,0x8D,0x27,0xD6,0xC5,0x36,0x9E,
+	0x51,0x7F,0x06,0x40,0x05,0xFA,0x85,0x8D,0x3F,0x69,0xDA,
+	0xC9,0x5E,0x9A,0x13,0xE8,0x3F,0xD8,0xE3,0x35,0x0B,0x95,
+	0x08,0x7F,0x88,0xC5,0x1E,0xCF,0x6C,0xB7,0xD2,0x6B,0x94,
+	0xBF,0xB1,0xD2,0x02,0xF0,0xA5,0x95,0x9A,0x24,0xFE,0x2C,
+	0x2B,0x0C,0x60,0x9F,0x95,0x76,0x90,0xF8,0x91,0xBB,0x0B,
+	0xC0,0x58,0x1B,0xED,0x01,0x70,0xDC,0x46,0xBD,0x06,0x1E,
+	0x30,0x73,0x00,0xCE,0xD8,0xA8,0x6C,0xE0,0xF7,0xFC,0x0B,
+	0x00,0xCE,0xD9,0xE8,0x0B,0x06,0x1E,0x45,0x5F,0x31,0xF0,
+	0x68,0xBF,0xDE,0xC0,0x8F,0xCE,0x6F,0x1A,0x21,0x3E,0xD8,
+	0xE9,0xFB,0xEC,0x49,0xA8,0x83,0xC7,0xF7,0x2A,0x22,0xC4,
+	0x81,0x09,0xD7,0x13,0x21,0x09,0x1C,0x7C,0x0D,0x11,0xD6,
+	0xBD,0x0B,0x4E,0x9C,0x08,0xDE,0xF7,0x60,0x1F,0x11,0x21,
+	0x73,0x3D,0xEC,0x15,0x22,0x84,0x6C,0x64,0x77,0x9B,0x04,
+	0xE2,0x87,0x4E,0x20,0x8C,0x25,0xC2,0xB6,0x62,0x08,0x2F,
+	0x08,0x67,0x80,0xA9,0x42,0x3F,0x09,0x75,0xC3,0x0C,0xFE,
+	0x4C,0x84,0xFA,0x43,0x90,0xBA,0x13,0xA1,0x82,0xBD,0x8A,
+	0xD9,0xFA,0x37,0x10,0x6E,0xFE,0x2C,0xE8,0x08,0xCC,0x05,
+	0x8B,0x2C,0x84,0xE8,0x1B,0xCD,0x84,0x7D,0x25,0x81,0xBA,
+	0x2E,0x59,0xFE,0x91,0xFD,0x6A,0x0A,0xFF,0xBA,0x40,0x39,
+	0xF9,0xDC,0x1E,0xF6,0xE6,0x65,0x74,0x7D,0xD6,0xA4,0xDD,
+	0xEC,0xB5,0x4B,0xF9,0x08,0x1D,0x77,0x4E,0x09,0x71,0xE5,
+	0x09,0x3E,0x55,0x1A,0x7C,0xBF,0x5B,0x1A,0xFC,0x80,0x27,
+	0x62,0x98,0x37,0xFA,0x7E,0x77,0xD3,0xAE,0xBB,0x99,0x7C,
+	0xBF,0x9E,0x6B,0x66,0x5F,0xE0,0xE0,0x0E,0xDB,0x75,0x2F,
+	0xD2,0x2B,0x38,0xED,0x31,0x46,0xB7,0x64,0x16,0x07,0xAC,
+	0xBA,0x1C,0x0C,0x06,0x8B,0x58,0x9D,0x01,0x31,0xCA,0x5F,
+	0x90,0x5A,0xCF,0x7E,0x9F,0x65,0x96,0x5A,0x10,0x47,0x5A,
+	0xBF,0x9F,0xD4,0x2A,0x27,0x9C,0x93,0x67,0xD5,0xCB,0xE3,
+	0xAE,0xC8,0x87,0xBD,0xB1,0xFD,0xD9,0x3B,0x9D,0x8E,0x35,
+	0xEC,0xAF,0x36,0xF8,0xAE,0x09,0xCB,0xEF,0x76,0xDF,0xB5,
+	0x9B,0xBD,0xEE,0x2A,0x57,0x44,0x95,0x47,0x55,0xE9,0xB3,
+	0x42,0x20,0x8D,0x4D,0xA8,0xEF,0x90,0x7C,0xC5,0xD7,0x24,
+	0x2C,0xB7,0x38,0x72,0x16,0x10,0xD6,0x56,0xC6,0xBC,0xE2,
+	0xB3,0x52,0x4E,0x43,0xC6,0x28,0x25,0xE1,0xDC,0x14,0x65,
+	0x56,0xBD,0x32,0xEE,0x8A,0xFE,0x33,0x1B,0xE3,0x67,0xA1,
+	0xFC,0x4B,0x31,0xFD,0x59,0x0F,0xC0,0x80,0x6E,0xDB,0xB9,
+	0x10,0xB4,0x77,0xDF,0x0F,0x1F,0xBB,0x06,0xC0,0x47,0x51,
+	0x3C,0x7C,0xE8,0x4F,0xB5,0x07,0x95,0xC6,0xF5,0x7D,0x5A,
+	0x84,0x84,0xFA,0x76,0xC9,0x57,0x84,0x55,0xE7,0x72,0x1A,
+	0x96,0xFF,0x3D,0xA7,0xC1,0xB1,0x26,0x8D,0x29,0xB2,0x77,
+	0x84,0xA1,0x56,0xF9,0x72,0x60,0x8E,0x37,0xF6,0x61,0xD6,
+	0x39,0x4F,0x5F,0xDF,0xAA,0x2B,0xC4,0x93,0x90,0xBD,0xAA,
+	0x9E,0xBD,0x69,0x9A,0x3E,0x18,0x3B,0x58,0xCF,0x7E,0x79,
+	0x55,0xFF,0xD2,0xDC,0xD6,0x41,0x4F,0xEF,0x58,0x26,0x5E,
+	0xDE,0x4D,0x59,0x75,0x4E,0xBE,0xA8,0x78,0xEA,0x8B,0x7F,
+	0x90,0xA6,0x2A,0xC5,0xC5,0x75,0xE2,0xE5,0xF7,0xF3,0xF6,
+	0x7B,0x7F,0xA0,0xEC,0xD7,0x1E,0xDB,0xF3,0xFA,0xE5,0xCB,
+	0xD0,0x42,0xF1,0x69,0x49,0xBF,0xD0,0x81,0x90,0x82,0xD4,
+	0xC6,0xD9,0x29,0x6D,0xF3,0x83,0xEB,0x12,0xA7,0x4F,0x6F,
+	0x09,0x06,0xCB,0x12,0xF6,0xB3,0x57,0x59,0xF9,0xF2,0x94,
+	0x25,0xB0,0x97,0x7D,0x01,0x2A,0x10,0xBE,0x25,0x7C,0x1E,
+	0xDC,0x26,0xB9,0xBE,0xCE,0x6F,0x84,0x15,0x7E,0x94,0x0D,
+	0x6D,0x6F,0x07,0xB6,0xC2,0x52,0xD1,0x24,0x36,0x15,0xA7,
+	0x80,0xD0,0x3D,0xDD,0x41,0x36,0x9D,0xC9,0x36,0xDD,0x2A,
+	0x2B,0x65,0xB2,0xC5,0x3D,0x40,0x96,0xC2,0x64,0x6B,0x6F,
+	0x95,0x6D,0x61,0xB2,0x1F,0xA3,0x41,0x36,0x97,0xC9,0x9E,
+	0xBE,0x55,0x56,0xC8,0x64,0xB1,0x77,0x80,0x8C,0xCD,0xAC,
+	0x3E,0xE1,0x56,0x59,0x1A,0xAF,0x73,0x28,0xC8,0x96,0x31,
+	0xD9,0x43,0xB7,0xCA,0xA6,0x30,0x59,0x82,0x0B,0x64,0x1E,
+	0x26,0xEB,0x7C,0xAB,0x6C,0x10,0x93,0x19,0x22,0x40,0xF6,
+	0x2C,0x93,0x5D,0x6F,0x7F,0x8B,0xAC,0x3B,0x93,0xAD,0x84,
+	0x54,0x71,0x41,0x36,0xC8,0xDE,0x65,0xB6,0xA2,0x1F,0x45,
+	0x05,0xFD,0xD4,0x38,0x6E,0x75,0xA1,0x72,0xFD,0x4D,0x1B,
+	0xF3,0xC6,0x8E,0xB4,0x13,0xF2,0x60,0x86,0xA9,0xD4,0xC0,
+	0x2F,0xBC,0xB1,0x5B,0xD9,0x9B,0xC2,0xEE,0xAE,0x0B,0xD6,
+	0xB2,0xAA,0x37,0x60,0xC9,0x05,0x6C,0x5A,0xF5,0x97,0x90,
+	0x68,0x55,0xF1,0xDC,0xE6,0x8D,0xAD,0xB4,0xC1,0x52,0x66,
+	0x86,0x35,0x18,0xEE,0x0B,0x27,0x44,0xF0,0x40,0x25,0x6C,
+	0xF9,0x05,0x6F,0xAC,0xC4,0x5E,0x33,0x76,0x3B,0xB8,0x4D,
+	0xEB,0xB3,0x61,0x84,0x75,0xD9,0x70,0xD9,0xA4,0x67,0x82,
+	0xC1,0xAC,0xF1,0x3B,0xD6,0xCC,0x05,0x4A,0x9F,0x0C,0xC4,
+	0x67,0x1F,0xEF,0x0E,0xC2,0xFA,0xEE,0x9A,0x07,0x8A,0x91,
+	0xFE,0x73,0xB9,0xFB,0x36,0x8B,0x6E,0x3A,0xC6,0x73,0x25,
+	0xF7,0xAE,0x8D,0x50,0x45,0xC3,0x3E,0xD1,0x63,0xE6,0xB2,
+	0xDC,0xFD,0x17,0x3E,0xAB,0xF8,0xAF,0x55,0xFF,0xA8,0x28,
+	0x78,0x7E,0x53,0xCC,0xAD,0xED,0x2D,0x78,0x46,0xFC,0xAF,
+	0x1A,0xBD,0xFE,0x37,0x0D,0xB7,0x79,0xD7,0xE3,0x28,0xE4,
+	0xF8,0x59,0x25,0x2F,0xC0,0x48,0xDE,0x89,0x84,0x73,0xFF,
+	0x4B,0x1F,0xF3,0xC6,0x9D,0xFB,0xAD,0x09,0x6F,0x39,0xFD,
+	0x9F,0xD4,0x1F,0x47,0x75,0xFD,0xAE,0x67,0xA0,0x91,0x4F,
+	0xFE,0xEB,0x29,0xD0,0x7F,0x05,0x9B,0xDA,0xF5,0x22,0x2A,
+	0x6E,0x16,0x3D,0xD4,0x4A,0x2F,0x5C,0x7F,0x8A,0x3C,0x45,
+	0x1C,0x3B,0xF8,0x22,0x25,0x2D,0xB8,0xC1,0xED,0x3F,0x8C,
+	0xAD,0x69,0x58,0xF0,0xE1,0x99,0xB0,0xA6,0xC1,0x87,0xA7,
+	0xF1,0xCF,0x05,0xF0,0xD9,0xEA,0x66,0xDC,0xA6,0x22,0x27,
+	0xAC,0x55,0xC0,0x50,0xD4,0x5B,0x60,0x85,0xEE,0x66,0x0B,
+	0x97,0xC7,0x0B,0x85,0x2F,0x18,0xC1,0x88,0x55,0x61,0x68,
+	0x5C,0x06,0x19,0x70,0xD5,0x7E,0xE2,0xC8,0x79,0x8C,0x82,
+	0x99,0x81,0x73,0x58,0x0B,0xE2,0xBD,0xA4,0x1D,0x38,0x87,
+	0x59,0x15,0xCA,0xB8,0x6F,0x1D,0x3B,0x3A,0x32,0x13,0x93,
+	0x1B,0xF5,0x88,0xEB,0xEC,0xCB,0xDA,0xE5,0x84,0xAF,0xA1,
+	0x2F,0x8C,0x15,0x03,0x57,0x85,0xEC,0x95,0x7B,0xA0,0x13,
+	0x81,0x76,0x7C,0x9A,0xF0,0xB5,0xD2,0x71,0x30,0x5C,0x09,
+	0x7E,0xA1,0x24,0xAA,0x41,0x4E,0x3E,0x2E,0x27,0x9F,0x51,
+	0x12,0xBE,0xE6,0x6E,0x24,0xAA,0x7C,0xBD,0xBE,0x42,0xE2,
+	0xB5,0x0A,0xAA,0x3C,0xAB,0x56,0x49,0xF8,0xB6,0x5D,0x05,
+	0x3A,0xE2,0x84,0x1A,0xF0,0x31,0x20,0x9E,0x0E,0xD4,0xEE,
+	0xC1,0xCC,0x2D,0x25,0xD7,0x44,0x95,0xF7,0x51,0x95,0x84,
+	0x5A,0x3D,0x27,0x17,0x14,0x4A,0x36,0xF6,0x83,0x51,0xB9,
+	0x7C,0xA7,0x1C,0xF3,0x1D,0x3B,0x24,0x51,0x49,0x3E,0xE3,
+	0xFD,0xDA,0xEE,0x4B,0x38,0x23,0xCE,0x97,0x45,0x5F,0x4B,
+	0x58,0xE6,0x1B,0x05,0xD2,0x00,0x9A,0x70,0xDC,0x35,0xBF,
+	0x8C,0x38,0xED,0x51,0xFE,0x80,0x29,0xCE,0xD7,0x18,0xB6,
+	0x2A,0x75,0x5D,0x5E,0x0F,0xC7,0x8E,0xEA,0xE2,0x26,0x49,
+	0x4E,0xAE,0x55,0x3A,0xB2,0x2A,0x68,0x72,0x2D,0xD4,0xD0,
+	0xDE,0x7B,0xC8,0x24,0x27,0xEB,0x05,0xE1,0x03,0x68,0xF2,
+	0x71,0x65,0x9C,0x3E,0x5F,0xB6,0xE4,0x1E,0xF5,0x9E,0x72,
+	0x28,0xDD,0x98,0x8E,0x63,0x47,0x95,0x0B,0x94,0xEE,0xE8,
+	0x8A,0x72,0xEF,0x37,0xA6,0xF9,0x72,0x57,0xB9,0x24,0xD1,
+	0x77,0x4A,0x70,0x81,0x6F,0xF6,0x6C,0x42,0x3E,0x34,0x26,
+	0x3A,0x49,0xE0,0x15,0x6C,0xDA,0xF7,0x4B,0x18,0x6F,0xDD,
+	0x04,0xC2,0x28,0x7F,0x5E,0x8F,0x7E,0xC1,0x44,0xEF,0x37,
+	0x36,0x97,0x3C,0x4B,0x97,0xAB,0xE3,0xE8,0x2C,0xD6,0x8A,
+	0xAF,0x04,0xBA,0x1B,0x0A,0x1D,0xCB,0xAC,0x85,0x32,0x30,
+	0xAD,0x6C,0xCE,0xA2,0x0F,0xB3,0xDF,0xC2,0x66,0xD5,0xF9,
+	0xFC,0x22,0xAB,0xD1,0x14,0xF8,0x31,0x98,0xF0,0x75,0xDD,
+	0x7A,0x70,0x8B,0x51,0x0D,0x51,0x7E,0xFD,0x3B,0xD8,0xD0,
+	0x8E,0xBF,0xFB,0x65,0x35,0xFB,0x34,0x73,0xA8,0xBE,0xEB,
+	0xB7,0x3B,0xD6,0x7C,0x26,0xB0,0x8B,0x27,0x1D,0x39,0x67,
+	0x99,0x2D,0x84,0x4E,0x84,0xC9,0xAD,0x8A,0xF2,0x73,0xF7,
+	0xA9,0xFF,0x63,0x3C,0xB8,0xFF,0x31,0x70,0x19,0x75,0x4C,
+	0x5F,0x99,0x04,0x8C,0x7C,0xF8,0xD8,0x09,0x81,0x2A,0xA8,
+	0x77,0x5D,0xCB,0xA6,0xD2,0xD7,0x68,0x73,0xAC,0xC9,0x63,
+	0x55,0x35,0x42,0x55,0xD9,0xFC,0xA2,0x5F,0xA6,0xC1,0xD7,
+	0x18,0x9D,0x65,0xF1,0x35,0xCD,0xC9,0xBC,0xD3,0xD7,0x34,
+	0x7F,0x75,0x77,0xDF,0xF5,0xB0,0x55,0xED,0x1D,0x3B,0x4A,
+	0x72,0x1F,0x8D,0xDC,0x16,0xAF,0xAF,0x99,0x00,0x15,0xC5,
+	0x43,0x45,0xA5,0x23,0x22,0xB7,0x91,0xC0,0x17,0xBE,0x26,
+	0xB3,0x67,0x5B,0xCE,0xB1,0xAC,0xAD,0x40,0x7F,0x4A,0x36,
+	0x8C,0x60,0x6E,0x63,0x3F,0x8C,0x28,0x81,0x59,0xC1,0x0E,
+	0xBF,0x3E,0x90,0x75,0xC2,0xC9,0xBA,0x33,0x1A,0x4A,0xFE,
+	0x8B,0x7C,0x8C,0xDE,0x19,0x14,0xF4,0x4B,0x20,0xAB,0x9B,
+	0x0F,0x3D,0xF3,0x35,0xD9,0x1C,0x39,0x55,0x2C,0x82,0x31,
+	0x43,0x29,0x48,0xD8,0x06,0xF1,0x70,0xB1,0xCC,0x0C,0xA3,
+	0x42,0x4E,0xFE,0xB6,0xAE,0x88,0xC5,0xCD,0x1D,0x15,0x0D,
+	0xCF,0xDD,0x0F,0x31,0xD2,0xE9,0xB6,0x3F,0x9D,0xB0,0xCF,
+	0xE2,0x0B,0xF4,0x13,0x6A,0xEA,0xDE,0x00,0xC9,0xE6,0xA0,
+	0x23,0xE7,0x55,0x36,0x8A,0x55,0xFB,0x88,0xC7,0x04,0xE1,
+	0x83,0x4D,0x43,0x71,0xA3,0xD9,0xD7,0x38,0xD2,0xD3,0x5D,
+	0x49,0xD8,0x87,0xC6,0x07,0x11,0x0C,0xE7,0xE7,0x57,0xF8,
+	0xEC,0x93,0x50,0x71,0x5B,0xF2,0xB7,0x81,0x14,0x5F,0x63,
+	0x92,0xC7,0x00,0x2A,0x81,0x18,0x5F,0xE3,0x28,0x4F,0x44,
+	0xAB,0x59,0x83,0x19,0xFF,0xB1,0x90,0xFF,0xB7,0x42,0x7D,
+	0x7C,0x8D,0x13,0x3D,0xBD,0xFF,0x67,0xD5,0x57,0xE0,0x53,
+	0x48,0xA8,0x68,0x97,0xFC,0x2D,0xDB,0x2A,0xFB,0xF8,0xD6,
+	0x5A,0xF3,0x7E,0x33,0x4C,0x3F,0xDB,0x5F,0xB7,0xA4,0x09,
+	0x93,0x27,0x41,0x5A,0x52,0x30,0xA2,0x77,0x17,0xF9,0xB4,
+	0xF2,0x68,0xEF,0x70,0x59,0xEA,0xAD,0x8C,0xE8,0x1D,0xA6,
+	0xBF,0x9F,0xCF,0xF7,0xE5,0x8C,0xC7,0xFE,0xF8,0x9D,0x80,
+	0x31,0x25,0xB8,0x6C,0x13,0x37,0x53,0x47,0xCE,0xA7,0x70,
+	0xD1,0x50,0x02,0x17,0x25,0xEC,0xAF,0x3F,0xAD,0x53,0xBA,
+	0x28,0x96,0x98,0x83,0x9E,0x67,0xAE,0x56,0x66,0xAB,0xC1,
+	0x96,0x96,0x96,0x3B,0x8F,0x64,0x9F,0xF6,0xC2,0x8F,0x67,
+	0x86,0x32,0x4D,0x52,0x46,0x4B,0x20,0x4B,0xFE,0x17,0xD9,
+	0x10,0x65,0x9A,0x59,0x19,0x6D,0x06,0x59,0xF4,0xBF,0xC8,
+	0x7A,0x29,0xD3,0xAC,0xCA,0x68,0x2B,0xC8,0xBA,0xF9,0xFC,
+	0x61,0xBE,0x92,0xB0,0x3F,0x6A,0xB8,0xF3,0x1F,0x9B,0x1E,
+	0xE9,0x57,0x07,0x1D,0xF1,0xF4,0xF0,0x5E,0x27,0xEE,0x4B,
+	0x83,0x6E,0x78,0x3A,0x79,0x83,0xC4,0x5D,0x57,0x1C,0x08,
+	0x2B,0xAE,0x0B,0x03,0xBE,0x89,0xF1,0x8F,0x0E,0xBA,0x71,
+	0x9B,0xDF,0x2A,0x3C,0x36,0x5D,0x5D,0x97,0x67,0x8E,0xCB,
+	0xBB,0x77,0xF8,0x20,0xCD,0xB3,0xC4,0x52,0xEE,0x9E,0xBF,
+	0x99,0x7A,0x2E,0xB0,0x01,0xAC,0x19,0x0A,0xEB,0xBF,0x4E,
+	0x31,0x0F,0xB2,0x78,0xA6,0x00,0x7F,0xFC,0xA0,0xA7,0x04,
+	0xCF,0x38,0xCB,0x79,0x77,0x02,0xAB,0x64,0xB4,0xE8,0x19,
+	0x06,0xCC,0xE8,0x41,0x4F,0x51,0xCF,0x40,0x60,0xF6,0x53,
+	0x46,0x4A,0x83,0x46,0x4B,0x9E,0xFB,0x80,0xD9,0x7B,0xD0,
+	0x53,0x06,0xCF,0x9D,0xC0,0xBC,0x9D,0x6B,0x1A,0x3D,0x9D,
+	0x81,0xE9,0x18,0xF4,0x94,0xC9,0x63,0xF7,0xF9,0xCD,0xBE,
+	0x12,0xB3,0xE5,0xBC,0x67,0xF3,0x43,0xFE,0xE9,0x2A,0x6B,
+	0x7F,0x3A,0x4C,0x66,0x4E,0x95,0x87,0x7D,0x7B,0x07,0xBD,
+	0x7A,0x5A,0x4D,0x9A,0x74,0xF5,0x07,0x65,0xFF,0xB4,0xAB,
+	0xA7,0x29,0xFF,0xA8,0x54,0x5B,0xFF,0x86,0x96,0x37,0x36,
+	0x89,0x85,0x48,0x47,0x4E,0x26,0x2C,0x62,0xA9,0x81,0x11,
+	0x02,0x46,0x4B,0xB2,0xCA,0xA0,0xEF,0x8E,0x62,0xEE,0x95,
+	0x51,0xD2,0xAA,0xB0,0x32,0x03,0xF3,0xB6,0xD3,0xD8,0x3E,
+	0xF3,0xB3,0x2F,0x84,0xD8,0x50,0x03,0x7C,0x08,0x36,0xAD,
+	0x82,0x3F,0xDD,0x14,0x6C,0x96,0xDC,0x21,0xBE,0xD8,0x0D,
+	0xAC,0x0E,0x8F,0x41,0x9F,0xD0,0x17,0x4C,0xE4,0x00,0x64,
+	0xAA,0xFA,0x91,0x4E,0xF0,0x71,0x9C,0x45,0xFD,0xA7,0xEF,
+	0x84,0x8F,0x0B,0xDD,0x78,0x8C,0xB7,0x63,0xF1,0x3C,0x28,
+	0xCE,0xBF,0x33,0xB4,0x35,0xAC,0xB7,0xD6,0x7A,0xF2,0x66,
+	0xAD,0x65,0x86,0xC7,0x99,0xCB,0x87,0x9F,0x8D,0xAC,0xEA,
+	0x32,0xC3,0x3C,0x2B,0xFE,0x7E,0x10,0xFB,0x5D,0xEB,0x86,
+	0xB8,0x44,0xA7,0x3B,0xFC,0x37,0x15,0x94,0x32,0xEF,0xB1,
+	0x91,0xB1,0x94,0x8E,0x8C,0xDC,0xC4,0x62,0x06,0x2F,0x2C,
+	0x77,0x64,0x41,0x04,0x0A,0xF6,0xCF,0x5E,0xD1,0x1F,0x92,
+	0x3C,0x6F,0x5A,0x64,0x5E,0xDC,0xA2,0xC1,0xCE,0x74,0x71,
+	0x9B,0xD3,0xB1,0xA3,0x86,0x99,0x36,0x26,0x04,0x0F,0xF8,
+	0xC0,0x34,0x75,0xC1,0x77,0x14,0x0B,0x63,0xB9,0x06,0x43,
+	0x39,0xD4,0x61,0x76,0x43,0x36,0x71,0x10,0x2E,0x44,0x37,
+	0x64,0x13,0x13,0xD9,0xC4,0xA1,0x20,0x8E,0xD1,0x93,0x70,
+	0x22,0x27,0xF2,0xFC,0x23,0xC4,0x1B,0x3B,0x89,0x0F,0x2A,
+	0xA4,0xD4,0x30,0x99,0x09,0x02,0xED,0x70,0x74,0x66,0x91,
+	0x4D,0xFA,0x64,0xBE,0x02,0x3B,0x38,0xB2,0x91,0xAE,0x6B,
+	0xCD,0x52,0x1C,0x39,0x7F,0xEB,0xCE,0xF6,0x99,0xDA,0x4A,
+	0xBB,0x8D,0x45,0xEC,0xB7,0xC5,0xD4,0x22,0x96,0x8A,0xB2,
+	0x9C,0xD2,0x17,0xBB,0x88,0x57,0x7B,0xFB,0xC6,0x65,0x80,
+	0xFA,0x0D,0x99,0xCD,0xD5,0x26,0x37,0x1B,0x2A,0x63,0x6C,
+	0x62,0x52,0xA6,0x37,0x51,0x2E,0xCE,0x81,0x54,0x66,0x11,
+	0x73,0x19,0xAD,0x45,0x3A,0xC7,0x18,0x98,0xDE,0x72,0xC7,
+	0xA0,0x8E,0x2B,0x00,0x3D,0x26,0x3E,0xDE,0xE9,0x6A,0x76,
+	0x71,0x10,0xE6,0xB4,0x5F,0xB9,0xF7,0xC7,0x7A,0xFD,0x2D,
+	0x98,0x48,0xD9,0xC6,0xD4,0x0A,0xB2,0x59,0xC3,0xFA,0x9B,
+	0x79,0xAD,0x35,0xC3,0xCC,0x75,0x34,0x70,0x45,0xBF,0xF7,
+	0x4C,0x7D,0x2E,0xAF,0x82,0xB7,0xD6,0x5A,0xBD,0xE3,0x15,
+	0x3F,0xF8,0xBC,0xE9,0xB7,0x9C,0x0B,0x06,0xCA,0x09,0x10,
+	0x19,0x6B,0xE5,0x59,0x35,0xF2,0xB8,0x33,0xDE,0x58,0x1C,
+	0xF2,0x9A,0x8F,0x8C,0xCC,0x89,0x99,0xE1,0x6A,0x23,0xBB,
+	0x6A,0x0A,0x7A,0x42,0x7C,0x8D,0x41,0xC7,0x9A,0x97,0x18,
+	0x75,0x8D,0x51,0xD7,0x81,0xCA,0x01,0x2A,0x86,0xCF,0xBC,
+	0x63,0xED,0x4A,0xB8,0xF6,0x58,0x63,0x0C,0xD3,0x38,0xF5,
+	0x34,0x50,0x72,0x71,0x54,0x15,0x1D,0x67,0x86,0xC0,0xD9,
+	0xAE,0x22,0xC6,0x80,0x5A,0x93,0x51,0xCB,0x86,0x5A,0xEC,
+	0x4B,0x78,0x95,0x84,0x33,0x6D,0xC2,0x01,0x4C,0x68,0x97,
+	0x6B,0xDA,0x2A,0x89,0x60,0x95,0xD4,0xD0,0x04,0x73,0x87,
+	0xE4,0x33,0x6D,0xCD,0xB4,0xFF,0x5D,0x33,0x92,0x91,0x2D,
+	0x3A,0xAE,0x41,0x7F,0xE6,0xE3,0xEA,0xE7,0xE7,0xEF,0x9F,
+	0x2F,0xE7,0xD4,0xC3,0x04,0x29,0x09,0xF5,0x9B,0xA9,0xDB,
+	0x81,0xEB,0xF9,0x08,0xAC,0x67,0xDD,0x61,0x03,0xB3,0x4E,
+	0x46,0xAE,0x60,0x24,0xFB,0x46,0x3C,0x56,0xE6,0x0A,0x96,
+	0xB9,0xC2,0xCB,0x5C,0x81,0x32,0x1D,0x51,0x69,0xB7,0x88,
+	0x3E,0x92,0x1D,0x14,0x4A,0x24,0xD6,0x51,0x48,0x05,0x42,
+	0x13,0x6A,0x43,0x93,0x8F,0xFB,0x1A,0x85,0xF4,0x04,0xD6,
+	0xF3,0x84,0xDA,0xE5,0x16,0x8F,0x4D,0x49,0xA8,0x89,0x49,
+	0x38,0x9E,0x01,0xEE,0xBB,0x26,0x40,0x95,0x84,0xE3,0x51,
+	0x55,0x7D,0x4A,0x62,0x92,0xCD,0x19,0x94,0x7D,0xFB,0xA9,
+	0xA7,0x46,0x59,0x75,0x5C,0xAE,0xFC,0xE3,0xA1,0x44,0xAE,
+	0xA8,0x1B,0x09,0x1D,0xE0,0xA7,0x17,0x87,0x6F,0xBB,0xC8,
+	0xF6,0xF3,0x24,0x9C,0xFC,0xBF,0x8A,0xD8,0xB1,0x7D,0x37,
+	0x5B,0x08,0x6B,0x6D,0x01,0x26,0xB3,0x06,0x12,0x8E,0x80,
+	0x11,0x1A,0x51,0x92,0x6B,0x21,0x2F,0x29,0xE6,0x36,0x77,
+	0x5B,0x85,0xE7,0xDE,0xEC,0x6B,0xEC,0xD7,0xF9,0xD2,0x7B,
+	0xFD,0xE7,0x6E,0xC9,0x15,0x90,0x87,0x31,0x45,0x48,0x9D,
+	0x62,0x12,0xCC,0x19,0x50,0x93,0x19,0x2E,0xB3,0x57,0x7D,
+	0x0D,0xE1,0x8C,0x64,0x40,0xCC,0xE2,0x17,0x6D,0xD6,0x68,
+	0xF3,0xC6,0x32,0x13,0x02,0xDF,0x58,0xC7,0x8E,0x69,0xEC,
+	0xB7,0x04,0x8B,0x08,0x8B,0xE4,0xC3,0x6F,0x04,0x83,0xE0,
+	0x23,0x3A,0xE0,0x54,0x51,0xDA,0x76,0xA2,0x82,0x89,0xDA,
+	0xC8,0x8A,0xCA,0x09,0xFB,0x0B,0x46,0x3A,0xA3,0xAA,0xE4,
+	0x71,0xDF,0x2A,0x36,0xC6,0x88,0x3A,0x96,0x5D,0xCC,0x6C,
+	0xB5,0xDD,0xB1,0xA8,0x06,0xA1,0xB2,0xDD,0x65,0x70,0x8C,
+	0xD9,0x25,0x8C,0x21,0x4F,0x6B,0xF6,0x96,0x0B,0xF2,0xC8,
+	0xC6,0x98,0x84,0x6F,0x3D,0xD5,0x4A,0xC2,0x7E,0x25,0x79,
+	0xBF,0xCF,0xEF,0x44,0x21,0xD8,0x69,0x74,0x85,0xBB,0x7D,
+	0x19,0x8F,0x3A,0x65,0x71,0xFC,0x77,0x67,0xA1,0x64,0xE0,
+	0xE7,0xA8,0x0A,0x39,0x41,0x67,0x93,0x74,0x2E,0x10,0x9E,
+	0x9D,0x70,0x8E,0xE9,0x7A,0x13,0x02,0x71,0xD9,0xAB,0xCE,
+	0xB1,0x3F,0x64,0xE8,0x1E,0xA2,0x74,0x63,0x8D,0x66,0xAB,
+	0x4C,0xA0,0x78,0x74,0x3A,0xEB,0x1C,0xF4,0xA5,0xA6,0x95,
+	0xF6,0xCB,0x17,0xA1,0x92,0x90,0xCA,0xB2,0xB8,0x66,0xC2,
+	0x33,0xE7,0xB5,0xD0,0x1A,0x8C,0x1A,0x3A,0x11,0x5D,0xE3,
+	0xDE,0x16,0xA8,0x85,0x85,0x56,0xC6,0x9D,0xE1,0x03,0xC9,
+	0x3E,0x45,0x48,0x6D,0x50,0xAE,0xCE,0xFE,0x21,0x08,0xFB,
+	0xCA,0x7B,0xD0,0xEB,0x3D,0xB0,0x56,0x5E,0x57,0x3B,0x81,
+	0x27,0x86,0x72,0xEE,0x19,0xB8,0xC0,0xC2,0x50,0xC0,0x57,
+	0x49,0x50,0xAD,0xAD,0x90,0x9C,0x7B,0x8E,0x29,0x8E,0xAB,
+	0x6D,0x2B,0xA7,0xF3,0x72,0xC7,0xFF,0x7D,0xA5,0xF5,0x28,
+	0x94,0x73,0xAF,0xDC,0x52,0x69,0xED,0xBF,0xA9,0xB4,0x19,
+	0xE4,0x6D,0x85,0x1A,0xE1,0xBA,0xC9,0xE1,0xAC,0x95,0x73,
+	0xF6,0xB1,0xEC,0x65,0x7F,0x3F,0x47,0xAF,0x5A,0xDE,0x71,
+	0x47,0xAF,0x1A,0x87,0xD3,0x6F,0x03,0xEF,0xE1,0x75,0xF4,
+	0xF2,0xA3,0x19,0x2A,0xE3,0xBE,0xCE,0x3E,0x1B,0x0C,0xF6,
+	0x20,0xD9,0x3F,0xF1,0xCF,0x0B,0x20,0x24,0xD9,0xBF,0xB0,
+	0x3F,0xFE,0xF8,0x47,0xFB,0x84,0xB2,0x77,0x41,0x85,0xAB,
+	0x59,0x59,0x5E,0x35,0xD4,0xFB,0x90,0x1F,0x2A,0xBD,0x0E,
+	0x49,0xF4,0xBF,0xDD,0x14,0x31,0xDC,0xB5,0xA7,0xB5,0x77,
+	0xE4,0xCC,0x15,0x99,0x5F,0x78,0x9C,0x6F,0xD1,0xA9,0xDC,
+	0xB2,0x27,0xA2,0x65,0x8F,0x6E,0xB5,0x6C,0xFF,0xBF,0xB1,
+	0x6C,0x98,0xF2,0x04,0x66,0xD9,0x90,0x05,0x27,0xD4,0x2A,
+	0xDD,0x58,0x69,0x9F,0x2A,0x28,0x36,0x56,0x29,0xCC,0x41,
+	0x9F,0xEA,0xDB,0x8A,0x3D,0x51,0xD9,0xD7,0xB9,0x91,0xF7,
+	0xF9,0x9F,0x8D,0x5C,0xE1,0xED,0xFA,0x4A,0x84,0xDF,0xD9,
+	0x7A,0xC5,0x6F,0xB6,0x5E,0x91,0xBD,0xAA,0x82,0x0D,0x98,
+	0xD9,0x3A,0xBF,0x68,0xB3,0xF5,0x10,0xB4,0x75,0xD1,0x9D,
+	0xB4,0x4B,0xE4,0x76,0xCE,0x3C,0xEB,0x8C,0xA6,0x5B,0xED,
+	0x3C,0xE1,0x56,0x3B,0x57,0x78,0x39,0xF6,0xC7,0x0C,0x0B,
+	0xFE,0xDE,0x6A,0xAB,0x72,0xA5,0xCF,0x2F,0xB5,0x9A,0x13,
+	0x50,0x23,0x9B,0xA3,0xEB,0xDD,0xE6,0x40,0x1D,0x6A,0xB2,
+	0x25,0x48,0x3E,0xB3,0x9B,0xA5,0xA2,0xD9,0x90,0x2C,0xFB,
+	0x83,0xEC,0xA0,0x61,0xF5,0x42,0xC7,0xF5,0xFB,0x32,0xA1,
+	0xCB,0xB5,0x8E,0xE2,0x5A,0xDB,0xFC,0xEC,0x43,0x6B,0x49,
+	0x48,0xBD,0xBC,0xB6,0xDE,0xC1,0x7C,0x63,0x8D,0x81,0x57,
+	0x54,0x0C,0x05,0x7D,0x55,0x60,0x07,0xBC,0xD8,0x41,0x58,
+	0x7B,0x5E,0x0D,0xB4,0x24,0x1F,0x8A,0x2A,0xD7,0xCF,0xFF,
+	0xA9,0xAD,0x38,0x67,0x87,0x94,0xB2,0xCD,0x5E,0x7E,0x17,
+	0x57,0x2E,0x91,0xFF,0x7E,0x05,0xAA,0xF2,0x1E,0xF0,0x82,
+	0xC3,0xB0,0xAE,0x95,0x99,0x4C,0xFF,0xF2,0x66,0x01,0xD6,
+	0x54,0x23,0x6F,0xEA,0xF8,0xCD,0xA6,0x6A,0xFF,0x43,0x53,
+	0xCF,0xFD,0xAE,0x64,0xB3,0xA3,0xCD,0xF8,0xFC,0xDC,0xF8,
+	0xC2,0xFE,0xB3,0xF1,0x55,0x30,0xE3,0x1B,0xCA,0x8D,0x6F,
+	0x28,0x37,0x3E,0x22,0x30,0xE3,0xF3,0xFE,0x67,0xE3,0xF3,
+	0xFF,0xDE,0xF8,0x2A,0x6E,0x2E,0x00,0xAE,0xC9,0x9F,0xE9,
+	0xEF,0xDC,0x34,0xFF,0x69,0xFD,0xF3,0x01,0x12,0xB4,0x9F,
+	0x7D,0xFE,0x39,0xF8,0x2C,0xCB,0xC9,0x12,0xF0,0x97,0x9D,
+	0x7D,0xB1,0xF7,0x84,0xB3,0xD5,0x6E,0x1F,0xD5,0x80,0x4C,
+	0xB6,0xD6,0xF2,0xC3,0x8C,0x39,0x71,0xF2,0xA4,0xA4,0x05,
+	0x9B,0xA1,0xBA,0x05,0x4C,0xB3,0x20,0x21,0x2B,0x49,0x7F,
+	0x28,0x87,0x65,0xC0,0x77,0x78,0x63,0x6B,0x1C,0xDC,0x80,
+	0x67,0x33,0xC1,0xAA,0x2C,0x23,0xFB,0x9E,0x9A,0xC8,0xF2,
+	0x51,0xAD,0x7F,0x53,0xCC,0xE4,0x2B,0xEE,0xE8,0xFD,0xA1,
+	0x59,0x4F,0x05,0xED,0xE8,0x62,0x87,0xAF,0xFD,0x7F,0xD2,
+	0x9A,0x08,0x12,0x7D,0x36,0x68,0xFE,0x51,0x5C,0x30,0xAC,
+	0x63,0xEF,0xE6,0xC8,0x5A,0xF9,0xD4,0x9E,0x6F,0xA0,0x0F,
+	0xF2,0xF7,0x53,0xF3,0x8C,0xB9,0x26,0xFE,0x57,0xC6,0x5C,
+	0xFC,0xAF,0x8C,0x25,0xFE,0xF6,0x37,0x13,0x6B,0x41,0xC1,
+	0xD8,0xDD,0x34,0x15,0x4A,0xE3,0xDF,0x23,0xFB,0x9F,0x34,
+	0x4D,0x05,0x9E,0x2C,0xB9,0xFA,0xBF,0x53,0xD5,0x3F,0x58,
+	0xC3,0xCE,0x5F,0xE1,0x19,0xB3,0x9E,0x0A,0xD7,0xF7,0xC0,
+	0x75,0x11,0x9B,0x28,0xD6,0x21,0x85,0x4F,0x54,0xD2,0x82,
+	0xD3,0xD0,0xEC,0x24,0xFD,0x24,0x53,0xDB,0x67,0x6D,0x9D,
+	0x13,0x77,0xC7,0xFC,0x9A,0xBB,0xD8,0x1D,0x85,0xA4,0x49,
+	0x37,0xBF,0x7B,0xDD,0xB7,0xCF,0xDC,0x2A,0xF5,0x74,0x2C,
+	0x78,0x9F,0xCD,0x3F,0xFB,0x9E,0x98,0xA8,0xAA,0xBA,0x5E,
+	0xB0,0x94,0x51,0x55,0x81,0x4F,0xA3,0xFC,0xF9,0x35,0x49,
+	0x93,0x6F,0xD5,0xFF,0x4D,0xAD,0x20,0x39,0xAB,0x88,0x4D,
+	0x80,0xFE,0x57,0x68,0x47,0xFF,0x1A,0x3E,0x6E,0x91,0x79,
+	0xD9,0xEA,0x2A,0x55,0xEC,0x2F,0x69,0xB2,0x6F,0x29,0x3D,
+	0xA8,0x8C,0xED,0xCD,0xBE,0xD7,0x5D,0x4A,0xE1,0xE6,0xC0,
+	0x16,0x91,0x67,0x87,0xCD,0x10,0x9D,0x52,0x4A,0x7E,0xFB,
+	0xA6,0x85,0x89,0xF2,0x91,0xA4,0xBC,0x4B,0xC5,0xA7,0xCC,
+	0x79,0x87,0xF9,0x87,0xFE,0x06,0x54,0x3B,0x6D,0xFA,0xCD,
+	0x63,0x4D,0xDB,0xF9,0x27,0x9C,0x9F,0x7F,0xC2,0xE0,0xFC,
+	0x83,0x77,0xC2,0xDE,0x5B,0xFD,0xEF,0x0F,0x40,0x90,0xB4,
+	0xE5,0x98,0x73,0xD8,0xFD,0xB6,0x3F,0x33,0xE3,0x53,0xC9,
+	0xFF,0xFD,0xF9,0xBF,0x3F,0xFF,0x0F,0x7E,0x6E,0xDE,0x7B,
+	0xB6,0xCA,0x09,0x67,0xE4,0x64,0x4C,0x68,0xE6,0x17,0x11,
+	0xE3,0x7C,0xA5,0xE0,0x0C,0xEC,0x95,0xF9,0xCA,0x5B,0x67,
+	0x39,0xFC,0x43,0xE7,0xF0,0xC5,0xCF,0x00,0x5A,0x94,0xE3,
+	0x39,0x76,0x5F,0xAD,0x2C,0xE7,0x1C,0x50,0x02,0xDE,0x39,
+	0xBF,0x79,0x94,0x5F,0xF7,0x3F,0xD4,0x29,0xFC,0xBF,0x50,
+	0x27,0x31,0xFF,0x6F,0x75,0xB2,0x9B,0x2D,0xF3,0xE5,0x02,
+	0x56,0xE9,0x7C,0xF9,0xAD,0x0B,0x3C,0xC5,0xFE,0x63,0xBD,
+	0x93,0xF0,0xA1,0x48,0x82,0x0E,0x9D,0x64,0x15,0x62,0x15,
+	0x6F,0x61,0x15,0x05,0xA9,0xE7,0xF8,0xB7,0x1C,0xCE,0x52,
+	0x6F,0xF6,0x21,0x1C,0x4F,0x2C,0xBC,0x0F,0x50,0x0A,0x7A,
+	0x04,0xC1,0xCB,0xE7,0x77,0x14,0xEB,0x50,0xC9,0xF1,0xEC,
+	0x55,0xC7,0xD9,0xF1,0x92,0x7D,0x55,0x63,0x20,0x11,0xAA,
+	0x39,0xCE,0x6A,0x2B,0x22,0x82,0x16,0x05,0x39,0xFE,0xFF,
+	0x61,0xEF,0x6D,0xC0,0xA3,0xAA,0xAE,0x85,0xE1,0x39,0x33,
+	0x67,0x26,0x93,0x30,0xC9,0x19,0x20,0x40,0xC0,0x00,0x83,
+	0x0E,0x16,0x04,0x34,0x53,0xD0,0x12,0x92,0xD4,0x49,0x60,
+	0x22,0xBF,0x1A,0x7E,0xC2,0x4F,0x0A,0x88,0x56,0xA7,0x56,
+	0x2D,0xA5,0xC9,0x1C,0x40,0x0B,0x78,0x70,0x92,0x76,0xF6,
+	0x1C,0x86,0xD2,0x5E,0xBD,0xED,0xED,0xD5,0x56,0x40,0x6F,
+	0x79,0x7D,0x6D,0x9B,0xBE,0xA5,0x10,0xC0,0xE2,0x4C,0x82,
+	0x93,0x84,0x9F,0x3A,0x40,0xD4,0x08,0x54,0x03,0x44,0x3D,
+	0x61,0x22,0x46,0xE1,0x86,0x90,0xC4,0xCC,0xB7,0xD6,0xDE,
+	0x67,0x26,0x33,0x49,0x50,0xCB,0x7D,0x1E,0x9F,0xF7,0x79,
+	0xBE,0x97,0x87,0xCC,0x39,0x67,0xFF,0xAC,0xBD,0xD6,0xDA,
+	0x7B,0xAF,0xBD,0xF6,0xDE,0x6B,0xAF,0xCD,0xF0,0x78,0x9E,
+	0x96,0x30,0xD2,0x0F,0x01,0x14,0x79,0xF7,0xE6,0x66,0x8D,
+	0x6B,0x50,0xDC,0x72,0x88,0xEC,0x50,0x60,0x14,0x74,0x12,
+	0xAD,0xB0,0xDF,0xD1,0x1A,0x68,0xE2,0x63,0x11,0xFD,0xF0,
+	0xE5,0x9C,0x32,0x85,0x16,0x8F,0x28,0x9B,0x5B,0x51,0x54,
+	0xCD,0x8C,0x5D,0x64,0x55,0x6B,0xAD,0x03,0xE7,0x24,0x91,
+	0xBD,0xF7,0xCA,0x2F,0x62,0x99,0x32,0x65,0x89,0x9A,0x77,
+	0x9C,0xDC,0x38,0xF2,0xEC,0xA0,0x9A,0xD8,0xB4,0xC5,0xF7,
+	0xE8,0x55,0x28,0x0E,0xD0,0xF0,0xDF,0x18,0x8E,0xFD,0x5F,
+	0x85,0xA3,0xE2,0x9D,0x79,0x00,0x3D,0x7B,0xF8,0x36,0x87,
+	0x0E,0x6B,0x60,0xD2,0xEF,0x5B,0x15,0xBA,0xF2,0x8A,0xAF,
+	0x38,0xE4,0x24,0x8E,0x86,0x2A,0x1B,0xD6,0x15,0xE8,0x44,
+	0x9C,0x46,0x79,0x72,0x2B,0xEA,0x39,0x51,0x82,0x06,0xCE,
+	0x9F,0xC9,0xF2,0xDB,0xFC,0x51,0x08,0xA1,0x28,0x84,0x46,
+	0x80,0x70,0x07,0x40,0x68,0x77,0x28,0x9C,0x0B,0xEB,0x41,
+	0x47,0x47,0xED,0x44,0xFE,0xB0,0xBA,0x8C,0x82,0x6B,0x38,
+	0x3C,0x1D,0xC0,0x01,0xA4,0x55,0x0D,0x4E,0x5C,0x82,0x05,
+	0x78,0xC5,0x4D,0x01,0xC5,0xEC,0x2B,0xC6,0xEF,0x73,0x51,
+	0xC8,0x0D,0x49,0x1A,0x25,0x24,0x21,0xE4,0x56,0x4E,0x78,
+	0x0E,0xA7,0xB2,0x03,0xB4,0xD1,0x5E,0x98,0x4B,0xBE,0x16,
+	0x4C,0xA3,0x46,0xD9,0xF4,0x55,0x30,0x27,0xB0,0x0A,0x50,
+	0x21,0xD7,0x1D,0x5E,0x47,0x21,0x07,0x61,0xE2,0x51,0x24,
+	0xEC,0xA7,0xAD,0xC8,0xAA,0xF3,0xD0,0xE6,0xB5,0x1C,0x40,
+	0xD6,0x25,0xA3,0x62,0x0C,0x85,0x1C,0x87,0x96,0x64,0xFD,
+	0xBD,0x53,0xD8,0x57,0xDC,0x1A,0xB8,0xA0,0xF7,0xAD,0xAA,
+	0x4B,0x0E,0xF9,0x8A,0xEB,0x62,0xBC,0x52,0x78,0x5A,0x6E,
+	0xD3,0xC0,0xE5,0x52,0x7E,0x83,0xC2,0xDA,0x8C,0x2D,0x1D,
+	0x1B,0x9B,0xCE,0x39,0xF5,0xAC,0x73,0x6A,0xBD,0xFC,0xF7,
+	0x66,0xD6,0xBB,0xDC,0x19,0xB4,0xC7,0x2A,0x6A,0x8F,0x1D,
+	0xE4,0x17,0xCA,0xD1,0x75,0x0B,0xA1,0x21,0x50,0x72,0x9F,
+	0xBE,0x13,0x83,0xE7,0xCE,0x6B,0xA5,0xAB,0x1F,0xB6,0x83,
+	0x6D,0xA6,0xE8,0xDA,0xE8,0xEF,0xBA,0x23,0x91,0xDD,0xAD,
+	0x74,0x05,0x41,0x1C,0xF9,0xD8,0x24,0x3E,0xBA,0x7D,0x79,
+	0x21,0x0C,0x7A,0xDD,0x11,0xA3,0xCD,0xDF,0x82,0x43,0xEF,
+	0x4E,0x4C,0x11,0xD4,0xFC,0x56,0x1E,0x86,0x2F,0x48,0xA3,
+	0x6C,0xBF,0xC3,0x49,0x0A,0xB8,0xF8,0x80,0xC9,0x10,0xA0,
+	0x63,0x29,0xED,0xFA,0xB7,0x3A,0xAB,0x10,0x4B,0x35,0x5E,
+	0x13,0xB8,0x84,0x1D,0x87,0x46,0x06,0x2E,0x98,0x41,0x91,
+	0x4C,0xAE,0xA6,0xF1,0xC4,0xDC,0x05,0x9D,0x54,0xE7,0x3C,
+	0x64,0xD0,0xC4,0x51,0xA8,0xE6,0x85,0x86,0x6F,0xEE,0xA2,
+	0xCB,0x20,0x03,0xB7,0xC9,0x1B,0xD1,0x74,0xB4,0x6B,0x60,
+	0x9A,0xD2,0x62,0x34,0xFD,0x1F,0x48,0x76,0x00,0xBD,0x06,
+	0x1D,0xFE,0x1C,0xD1,0xA3,0x30,0xFA,0xEA,0xA2,0x2A,0x25,
+	0xC3,0x7F,0xCB,0xA2,0x63,0x44,0xDF,0x37,0x82,0xC6,0xC8,
+	0x9B,0xE1,0xFB,0x19,0xA0,0x79,0xE3,0x48,0x35,0xE5,0x2D,
+	0x44,0x7D,0xC9,0x6C,0x55,0x5F,0x46,0x47,0xB9,0xA0,0x89,
+	0x12,0xCF,0x60,0x81,0xC4,0x72,0x7F,0x0C,0xBA,0xB4,0x39,
+	0xB9,0x96,0x71,0x61,0xFA,0x97,0x70,0x61,0xB3,0x02,0xD1,
+	0x7D,0xB8,0xD0,0x57,0x1E,0x61,0xDE,0xBB,0x58,0xDE,0xBE,
+	0x52,0x29,0xD6,0xA6,0xB6,0xB6,0x96,0xA3,0x3E,0x9F,0x77,
+	0x9C,0x2D,0x2F,0xBE,0x81,0x3A,0x7A,0xDE,0x1E,0x5C,0xFC,
+	0x12,0x87,0x06,0xF5,0x0D,0x18,0x1A,0xD4,0x63,0x24,0xD7,
+	0xB2,0x9B,0xC3,0x85,0x24,0x8F,0xA3,0xD9,0xE3,0x50,0xB2,
+	0x9A,0xB1,0x0F,0x81,0xE4,0x75,0x50,0xC9,0x1B,0x32,0x38,
+	0xAB,0x7E,0x3E,0xFC,0xC4,0x5D,0x4E,0x68,0x75,0x15,0xD8,
+	0x96,0x83,0xB4,0x17,0x70,0x20,0xE5,0x9B,0xE0,0xE9,0x61,
+	0x52,0x9C,0x3C,0xDF,0x48,0x1F,0x7F,0xA3,0x52,0x98,0xFC,
+	0x3D,0x84,0x8F,0x6D,0x15,0xA7,0xE0,0x91,0x04,0xB3,0x3C,
+	0xE7,0xEE,0x3A,0x5C,0x60,0x74,0x34,0xEF,0x6A,0xA0,0x9C,
+	0x6D,0x74,0xEE,0x3E,0x4A,0x5F,0x42,0xBB,0x43,0x34,0x42,
+	0x71,0xD6,0xEA,0x1B,0xE9,0xCA,0xE1,0xAE,0xB7,0x69,0xC4,
+	0x39,0xE7,0xEE,0x77,0xE8,0xCE,0x52,0x03,0x9B,0x50,0xE2,
+	0xE6,0xD4,0x01,0x7C,0xF5,0xFD,0xFD,0x31,0x00,0x7A,0x78,
+	0x1B,0xED,0x97,0xCE,0x57,0x7C,0x15,0xF8,0x59,0xEB,0x28,
+	0xFF,0x39,0x2E,0x6D,0xBE,0xDD,0x03,0xC5,0x5E,0x73,0x94,
+	0x47,0x22,0xE2,0x2A,0xB9,0x62,0x23,0x22,0x41,0x4B,0x96,
+	0x2B,0x36,0xD1,0x77,0x2C,0x14,0x44,0xBD,0x17,0x6A,0xC2,
+	0x09,0xC4,0x55,0xCB,0x34,0x37,0xD5,0x6A,0x19,0x47,0x38,
+	0xAE,0xDA,0xEB,0x90,0xFA,0x20,0x53,0xF1,0x24,0x2E,0xC3,
+	0x0D,0x43,0x4C,0x19,0x56,0xE1,0xA4,0x18,0xFF,0x5E,0x88,
+	0x63,0xA3,0x8A,0xAC,0x6B,0x39,0x43,0x74,0xF3,0x0B,0x3E,
+	0x5C,0x8F,0x3F,0x7C,0x78,0x38,0xAE,0x92,0x34,0x54,0xE1,
+	0x92,0x3D,0xA2,0xAC,0xDC,0x72,0x1D,0xC0,0xA1,0xFB,0xDE,
+	0xBB,0x82,0x9A,0x63,0x59,0xED,0xD0,0x38,0xA4,0x0B,0x82,
+	0x13,0x17,0x52,0x1C,0x2F,0x80,0xE8,0x0A,0x2A,0x1F,0x75,
+	0xE1,0x5C,0x14,0x17,0x31,0x11,0x3C,0x07,0x18,0x37,0x28,
+	0x8F,0x43,0xA6,0xC4,0xF6,0x00,0xAA,0x6C,0xA6,0xD3,0x9D,
+	0xB7,0x9D,0x55,0xEF,0x7F,0x63,0x91,0xAB,0xCE,0xF9,0x8A,
+	0xCF,0x55,0x8D,0x63,0xF2,0xEE,0x9C,0x26,0x4B,0xD9,0x06,
+	0xB3,0x38,0x90,0x4A,0xAB,0xCE,0xA1,0x68,0xFA,0x67,0xE0,
+	0xA2,0x31,0xF9,0x74,0xAD,0xFE,0x39,0xC8,0x51,0xCC,0xE3,
+	0x78,0x3D,0x1A,0x33,0x3B,0x61,0xAE,0xAD,0x2F,0x5D,0x22,
+	0x6D,0x3E,0xFF,0x85,0x78,0x3F,0x24,0xFB,0x10,0xD2,0x37,
+	0x43,0xA7,0x85,0xD4,0x41,0xFD,0x36,0x9C,0x28,0x27,0x9F,
+	0x86,0xE0,0x26,0x0A,0x37,0xF9,0x34,0x94,0x40,0x46,0xEF,
+	0x30,0xD1,0xD2,0xB0,0x94,0xC8,0x54,0xE5,0xF6,0x9F,0x22,
+	0x5B,0x57,0x29,0xC2,0xFE,0xE2,0x73,0x81,0x8B,0x3C,0x77,
+	0x9A,0x8C,0x7E,0x09,0xD9,0x94,0xE1,0xDC,0xCA,0xD0,0xD3,
+	0x96,0xA6,0x02,0xF8,0x08,0x6E,0xFA,0x22,0x40,0x0E,0xB2,
+	0xC2,0x28,0x5C,0x7C,0x0E,0x88,0x6E,0x8A,0xA1,0x6B,0x98,
+	0xAA,0xFC,0xF3,0x69,0x14,0x93,0x57,0x39,0xF1,0x0E,0xAF,
+	0xA3,0x29,0x57,0x5F,0x7A,0x5B,0xAE,0x71,0xC3,0x58,0x40,
+	0xBD,0x11,0xD1,0x3F,0x1F,0x87,0xFE,0x23,0xBD,0xE8,0xC3,
+	0x84,0xB0,0x24,0x26,0x27,0x16,0x6D,0x6D,0xAD,0x04,0x70,
+	0x2F,0xFD,0xD1,0x44,0xF7,0x8E,0x2B,0x56,0xC1,0xA4,0x2F,
+	0xAB,0xD9,0xB9,0xFB,0x55,0xF8,0xDE,0xF5,0x1A,0xAD,0x7D,
+	0x3D,0x66,0x0A,0x74,0x00,0x6D,0x98,0x88,0x83,0x79,0x90,
+	0x4B,0xEF,0xEE,0x48,0x11,0x47,0xD7,0xEA,0x7F,0x83,0xEB,
+	0xB0,0x08,0x79,0x27,0xA6,0x09,0xEA,0x31,0x83,0x9E,0x65,
+	0x06,0x46,0xBF,0xCA,0x18,0xBD,0xB6,0x97,0xD1,0x77,0xA9,
+	0x98,0xA7,0x0C,0x57,0x6E,0x7B,0x1A,0xD3,0x80,0x4A,0x22,
+	0x2E,0xC4,0xF6,0x9E,0xA7,0xD1,0x95,0xCE,0x86,0xDF,0xA4,
+	0x0D,0x05,0x2C,0x3F,0x4A,0x93,0x3C,0x9D,0xC6,0x25,0x38,
+	0xD1,0x1F,0xE9,0x10,0x06,0x5B,0x1B,0x1E,0xC5,0x5E,0x74,
+	0xE1,0xC1,0x36,0x3F,0x4B,0x18,0x5D,0x7D,0x4F,0x61,0xE8,
+	0xF8,0xF8,0xDE,0xB2,0xC5,0xDC,0x3E,0xE5,0x4A,0x85,0xCA,
+	0xFF,0x7E,0x2A,0x5A,0xEE,0x58,0x68,0xB5,0x34,0x99,0x8E,
+	0xC1,0xE4,0x18,0x80,0xDF,0x01,0x80,0x16,0x9C,0xCD,0xF6,
+	0x52,0xF0,0xA3,0xFE,0x14,0x68,0x86,0x2B,0x0F,0x3D,0x85,
+	0x1D,0xF1,0x5C,0x2E,0x8C,0xE4,0xB9,0x11,0x71,0x48,0x14,
+	0x9A,0x36,0x8A,0x61,0x56,0xAE,0x0E,0x62,0x78,0x11,0xEB,
+	0xA3,0x18,0xDB,0x93,0xE3,0x9F,0x30,0xC5,0xE2,0xAA,0xD5,
+	0x78,0x27,0x19,0x86,0xE9,0xC3,0xC9,0x7D,0x08,0xF8,0x73,
+	0x3C,0x01,0x8E,0xA8,0x3D,0x40,0x6E,0xB4,0xE1,0x8A,0x7A,
+	0x25,0x0B,0xE6,0x70,0x8C,0xE3,0xCE,0x3C,0xB3,0xBE,0x74,
+	0x9C,0x33,0xEF,0x19,0xFD,0x86,0x5B,0x18,0x58,0x50,0x2A,
+	0x18,0x18,0x3F,0x82,0xA1,0x0C,0x0A,0xA7,0x32,0x20,0xBC,
+	0x50,0xF1,0x0C,0x0A,0xFF,0x4F,0x86,0xD0,0x69,0x1A,0x35,
+	0x2F,0x39,0xF4,0x1C,0x92,0x56,0x31,0x9B,0xCE,0x3E,0x95,
+	0x4F,0x3F,0x83,0x2E,0x43,0x3F,0x6A,0xE9,0x2F,0x46,0x2A,
+	0xDF,0x4D,0xA7,0x8B,0xE7,0xF7,0xC9,0x15,0xF3,0xA9,0x42,
+	0x55,0x04,0xBF,0x81,0x26,0x63,0x72,0x35,0x2B,0xE7,0x3C,
+	0x6D,0x58,0x94,0x14,0xF7,0xDF,0x97,0x43,0x9C,0x56,0x4C,
+	0x53,0x51,0x61,0x46,0x37,0xE3,0x55,0x7A,0xD9,0xD7,0x88,
+	0x28,0xB5,0x26,0x55,0x60,0xD3,0xB6,0x48,0x57,0x29,0x4A,
+	0x06,0xD2,0x7B,0x51,0x6E,0x8F,0xBB,0xB1,0xDC,0x66,0x49,
+	0xA7,0xAB,0xF2,0xA3,0xEA,0x70,0x5B,0x54,0xCA,0x39,0xAA,
+	0xD0,0x28,0x65,0x11,0xDA,0x8F,0x40,0xB6,0x76,0xD0,0xBC,
+	0xA8,0xBE,0x35,0x16,0x44,0xC3,0x19,0xD0,0x5B,0x41,0x41,
+	0xA6,0xEB,0xA9,0xAD,0x54,0x94,0x71,0xD5,0x64,0x98,0x07,
+	0x97,0x66,0x43,0x54,0xD1,0x28,0x01,0xCD,0xD0,0xB9,0x75,
+	0x63,0x8A,0xA4,0x29,0x4D,0x72,0xBA,0x37,0xA6,0x44,0xE8,
+	0x0D,0x6A,0xC2,0x7E,0x7B,0x0A,0xE4,0x84,0x7E,0x03,0x08,
+	0xE2,0xF5,0x84,0xE1,0xA4,0x7C,0xBB,0xFB,0xBA,0x71,0xF3,
+	0x08,0xAF,0xB9,0xFC,0x94,0x6B,0xB0,0xD4,0x69,0x29,0xD5,
+	0x4B,0x9D,0xCF,0x94,0xB6,0x1C,0xA2,0x94,0x5E,0x20,0x8D,
+	0xB8,0x33,0x02,0x3A,0xDD,0x4E,0x0F,0x1B,0x69,0x11,0x0A,
+	0x8C,0x90,0x3D,0x31,0x3D,0x4F,0xA5,0xB3,0x06,0x0B,0xD1,
+	0xAC,0xFF,0x1E,0x2B,0xB3,0x6C,0xF1,0x01,0x2D,0x5D,0xCB,
+	0x15,0xDE,0x48,0xC6,0x2B,0x75,0x83,0xC0,0x87,0xA9,0xFE,
+	0x2B,0xFF,0xE5,0xD2,0x8F,0xF4,0xBB,0x1B,0x51,0xCC,0x65,
+	0xD2,0x04,0x6F,0x98,0xF4,0x74,0x01,0x37,0x21,0x4E,0x34,
+	0xF9,0x66,0x0E,0xB6,0x9D,0x3A,0x84,0xDA,0x4E,0x78,0xDC,
+	0x21,0x23,0x9D,0xAE,0x28,0xE1,0x61,0xBE,0x79,0x02,0xA9,
+	0x53,0x66,0x46,0xA8,0x98,0x4C,0xA3,0xE1,0xD4,0xC9,0xFB,
+	0x17,0x9F,0xC6,0x0B,0x49,0xC0,0x8B,0x39,0x84,0x97,0x36,
+	0xA6,0x95,0xB8,0xD2,0x9C,0xB2,0xC6,0x89,0x77,0xDF,0x3A,
+	0xF1,0xF2,0xBA,0x24,0xBC,0x0A,0x0D,0xE8,0x71,0x6E,0x7D,
+	0x4A,0xAB,0xB1,0x97,0x46,0x3F,0x85,0xFD,0xB6,0xC0,0x47,
+	0xBC,0xAF,0xD0,0x4C,0xF2,0x79,0xA7,0x0C,0x83,0x5C,0xBE,
+	0xC9,0x6B,0xF0,0xE4,0x43,0xDE,0x42,0xFC,0x48,0x81,0xA7,
+	0x8E,0x1C,0x85,0x37,0x23,0x69,0x73,0x07,0x8D,0x05,0xDE,
+	0xE5,0x46,0xBB,0xA7,0x24,0x2D,0xBB,0x4D,0xBC,0xEA,0xCD,
+	0x4F,0x0B,0xE6,0x8F,0xD0,0xE4,0x96,0xB8,0x06,0xE5,0x2E,
+	0x70,0xC5,0xE0,0x03,0x10,0x5D,0xBE,0xD1,0xEE,0xCC,0xE1,
+	0x36,0xC4,0xC2,0x08,0x47,0x5B,0x0B,0x73,0xEA,0xEE,0x47,
+	0x17,0xFA,0x8C,0xA5,0x2E,0xAB,0xB3,0xB6,0x00,0x98,0xA1,
+	0xE0,0x46,0x3C,0xCC,0x4A,0x7A,0xD1,0x85,0xCA,0x2E,0x41,
+	0xB7,0xC8,0x93,0x81,0xE4,0x12,0x5A,0x67,0x4B,0x97,0x09,
+	0xFB,0xFD,0x58,0xF5,0x5A,0xA8,0x03,0x2D,0x68,0x62,0xBC,
+	0x8C,0x6F,0xC3,0xE1,0xCD,0x40,0xDF,0x26,0xDB,0xCE,0xC2,
+	0x3B,0x28,0x3F,0x72,0x8A,0xB0,0xEF,0x2F,0x12,0x35,0x42,
+	0x2B,0x13,0x7C,0xD3,0x38,0xE9,0x30,0xEE,0xBF,0x5B,0x44,
+	0x9D,0x3D,0xDC,0x1C,0x1F,0x37,0x14,0xE2,0xC8,0x07,0x33,
+	0xBD,0xDB,0x31,0xDA,0xEE,0x99,0x3F,0x23,0x25,0xDC,0x44,
+	0xF1,0x0C,0xCE,0x1A,0x95,0xA2,0xA1,0x6E,0x93,0x77,0xA8,
+	0x0E,0xEB,0x65,0x3B,0x4F,0x74,0x80,0x9C,0xE0,0xDC,0xFA,
+	0xD3,0x21,0x1A,0x6D,0x19,0xB4,0xAB,0x9F,0xA6,0x50,0xA6,
+	0xD2,0x7D,0x73,0xE4,0x34,0x99,0x99,0x22,0xEB,0x18,0x6A,
+	0x33,0x8D,0xF4,0x8D,0x87,0x37,0x13,0x7D,0x33,0xC0,0x5B,
+	0x1A,0x7D,0x33,0xC2,0x9B,0xD9,0xF7,0xD3,0xF4,0xF6,0x99,
+	0xA9,0x92,0x98,0x5B,0x85,0x15,0xB9,0xED,0x3D,0x79,0xEA,
+	0xB6,0x33,0xEE,0xE0,0xA0,0x31,0x86,0x65,0xBF,0xDC,0xDE,
+	0xB8,0xBD,0x3A,0x51,0x4D,0x5B,0x9E,0x34,0xD6,0x3B,0x33,
+	0x3D,0x38,0xF3,0x16,0x4D,0xEE,0xB8,0x52,0x3E,0xF7,0x99,
+	0x52,0x5B,0x70,0x66,0xBA,0x26,0x3C,0x29,0x21,0x6F,0xCA,
+	0x0D,0xF3,0x06,0x67,0x66,0xC2,0x18,0x50,0x66,0x14,0xF6,
+	0xCF,0x4C,0x81,0x9A,0x76,0x46,0x66,0x0E,0xE1,0x82,0x94,
+	0x4A,0x52,0xC6,0x33,0x37,0xFB,0x2A,0x8D,0x55,0xB7,0xD2,
+	0x45,0x44,0x0F,0x95,0x52,0x48,0xD9,0x16,0xA4,0x2C,0x3A,
+	0xA0,0x95,0x19,0xA3,0x37,0x18,0x47,0x83,0x74,0x65,0x49,
+	0x55,0xE8,0x85,0x32,0x9C,0x24,0xEA,0xAB,0xD0,0x95,0x64,
+	0xED,0x4C,0x44,0x09,0xC4,0xEB,0x4C,0x90,0x50,0x72,0x2A,
+	0x02,0xE2,0x02,0x6F,0x08,0xD8,0x09,0xE6,0xF1,0xDB,0xCE,
+	0x90,0x41,0xBE,0x9F,0xA4,0xA8,0x58,0x8F,0x31,0xFC,0x72,
+	0xFB,0x99,0xED,0xFE,0x41,0xF5,0xB4,0xED,0xD7,0xBB,0xDF,
+	0x8B,0x24,0x8D,0xAD,0xA8,0x77,0xC5,0xCA,0x20,0x8D,0xCA,
+	0xB3,0x3D,0x78,0x3B,0x9A,0x7A,0x0F,0x79,0x9C,0x3E,0x5C,
+	0xEB,0x40,0x41,0x02,0x33,0x5F,0xC3,0xFB,0x6C,0x8A,0x7E,
+	0xE2,0x07,0x29,0xCD,0x42,0x05,0x9D,0x1F,0x3C,0xFF,0x25,
+	0xF3,0x03,0xB3,0x94,0x67,0x4C,0x8D,0x29,0x86,0xD4,0x9E,
+	0xA0,0x0A,0xF7,0xD7,0xA0,0x17,0xED,0x87,0xE9,0x4D,0xEF,
+	0x0E,0x74,0x36,0x6E,0x17,0x6F,0xBB,0x16,0x89,0x28,0xDF,
+	0x01,0xD4,0x5F,0x42,0x71,0x97,0xAB,0x13,0x87,0xA2,0x60,
+	0xCE,0x62,0xCB,0x70,0xD2,0xEE,0x69,0xF0,0x12,0xFE,0x01,
+	0x0C,0x0E,0xDF,0x42,0x95,0xF1,0xDC,0x54,0xFF,0x6C,0xC1,
+	0xE2,0x27,0x15,0xE7,0x68,0xF1,0xE7,0xE8,0xEA,0xF0,0x6E,
+	0x4C,0x6C,0xF3,0xB3,0xA4,0xB9,0x98,0xAC,0x09,0xA7,0x5A,
+	0x28,0x0C,0x58,0x62,0xD4,0x26,0x05,0x4B,0x23,0x9B,0xAA,
+	0xD3,0xA5,0x66,0x86,0x7D,0x13,0xCD,0x09,0xE3,0x27,0xCD,
+	0x0A,0xD4,0xEC,0x9E,0x9E,0x8E,0xC3,0xE4,0x9F,0x7B,0xB7,
+	0x39,0xAD,0x9C,0x34,0x1E,0x71,0x7F,0xC3,0xDF,0x64,0x30,
+	0xD2,0x5D,0xC2,0x9D,0x98,0x27,0xA0,0x8C,0x85,0x81,0x81,
+	0xA6,0x60,0xF1,0x3D,0x56,0x8E,0x45,0x0F,0x98,0xFB,0x0B,
+	0x8D,0x9F,0xC5,0xBE,0x84,0x3F,0xD1,0xD0,0x2E,0x7F,0x93,
+	0x76,0x80,0xE0,0x6B,0xFE,0x26,0x1D,0x0B,0x6E,0xD7,0x23,
+	0x3E,0x96,0x44,0x58,0x9F,0xFA,0x9B,0xF8,0x01,0x72,0x7D,
+	0xE0,0x6F,0xD2,0xAB,0xC1,0x8C,0x8F,0x74,0x44,0x4D,0x63,
+	0x91,0x3B,0xA4,0x54,0x7C,0xDC,0xC5,0xF6,0x39,0xCD,0xAE,
+	0x24,0xF6,0x6D,0x8C,0x8E,0x99,0x43,0xB7,0xE6,0x21,0x07,
+	0x70,0x07,0xA2,0x34,0x49,0xC5,0x22,0xA8,0xC7,0x4A,0xE4,
+	0x06,0x9E,0x33,0x61,0x35,0x5B,0x81,0xC9,0x55,0xD8,0x40,
+	0x98,0x46,0x8F,0x4A,0xBE,0xE2,0x71,0xB4,0x22,0xFF,0x1B,
+	0x40,0xCF,0x8F,0x5A,0xE3,0xA5,0x00,0x7F,0x6D,0xA7,0x5A,
+	0x9E,0x03,0xE1,0xB3,0x75,0x73,0x33,0xB5,0xC3,0x1C,0xC1,
+	0xE2,0x60,0xFC,0xA3,0x71,0xB1,0x39,0x2B,0x25,0x68,0x8F,
+	0xDD,0x35,0x61,0x8F,0x56,0x4C,0xA6,0x89,0x4D,0x9A,0xD2,
+	0x5B,0x20,0x4D,0x40,0x31,0x29,0x6B,0x60,0x2C,0x77,0x77,
+	0x44,0x5C,0x83,0xFA,0x65,0x30,0x0B,0x15,0x59,0x00,0x7D,
+	0x8F,0x51,0xA8,0x98,0xA0,0x6E,0x0E,0x1D,0x87,0xD9,0x05,
+	0xAD,0x7D,0xA8,0xF4,0xE3,0xD1,0x4A,0x0F,0xD1,0x4A,0x3F,
+	0xAE,0x56,0x76,0x28,0xF0,0xA3,0x66,0x13,0xAD,0xF0,0x5E,
+	0xE2,0x85,0x67,0x3F,0xE6,0x54,0xBE,0xEE,0xD1,0xBA,0xEE,
+	0x05,0x54,0x72,0xD4,0x48,0x44,0xFB,0xAE,0xA0,0x43,0x81,
+	0x59,0x28,0x7E,0xEF,0xC4,0x9F,0xAC,0x53,0x80,0x97,0xF4,
+	0x51,0x9B,0xF2,0x26,0x4C,0x7C,0xB3,0x43,0xE2,0x52,0x16,
+	0x8A,0xBB,0xE6,0xC0,0x82,0xF0,0x7D,0x51,0x2A,0xC7,0xC6,
+	0xC1,0x18,0xDA,0x9B,0x06,0xA1,0x61,0xBA,0xB1,0x6A,0xD0,
+	0x41,0xBA,0x01,0xD9,0xDC,0xA6,0x9C,0x6A,0x45,0x9E,0x36,
+	0x80,0x10,0xE4,0x21,0x0D,0xE7,0xDE,0xDC,0x00,0xB3,0x94,
+	0x64,0x4E,0xC3,0x76,0xCA,0x1A,0x02,0x4A,0x8A,0x9C,0xFE,
+	0x6C,0x7B,0x35,0x27,0x94,0x5F,0xD5,0xC4,0x0C,0x16,0x84,
+	0xF2,0x0D,0x9A,0x68,0x8B,0x31,0xBB,0xD6,0xE2,0x9D,0x21,
+	0x3F,0x24,0xEF,0xD8,0xFC,0xEA,0x36,0x11,0x74,0x09,0xF1,
+	0x9C,0x6A,0xD2,0x20,0x94,0xBF,0x4E,0xED,0x74,0x03,0x4A,
+	0x6A,0xBB,0x3E,0x94,0x8A,0x36,0x48,0x16,0xBA,0x41,0x33,
+	0x3E,0xA2,0x9A,0xFE,0x28,0xE9,0x0F,0x43,0x82,0xE2,0xA6,
+	0xE4,0x20,0xE4,0x6A,0xD9,0x8E,0xEA,0x0F,0xC6,0xC3,0x5C,
+	0x9B,0xC6,0xB6,0x3F,0x14,0x17,0x8B,0x36,0xA3,0x51,0x8E,
+	0x4D,0x00,0x8E,0x59,0xB7,0x76,0x52,0x4A,0x33,0x71,0x65,
+	0x83,0x84,0x62,0x4C,0x7A,0xA9,0x8B,0x32,0x69,0x16,0x29,
+	0x6E,0x0C,0xDF,0xAB,0x66,0x10,0x47,0xC1,0xDF,0x70,0x35,
+	0x43,0x5A,0xD6,0x29,0x48,0x47,0x73,0x41,0x92,0x4C,0xFA,
+	0x45,0x42,0x94,0x2B,0xCA,0x1B,0x61,0x64,0x49,0x23,0x63,
+	0x49,0x2B,0xB0,0xA4,0x51,0xE3,0xBA,0x0D,0xD8,0x31,0x3E,
+	0xA2,0x83,0xCE,0xD8,0xA4,0xD5,0x39,0x1A,0x65,0xCD,0x1E,
+	0xCE,0x25,0x50,0xCE,0xD6,0x3A,0x9A,0x34,0xD4,0x0E,0xEF,
+	0x9C,0xB4,0xB9,0x15,0x2F,0xE3,0x71,0x34,0x2A,0x6F,0x03,
+	0x04,0x69,0xB3,0x42,0xBF,0x1A,0x94,0xDA,0x30,0x15,0x1F,
+	0x72,0x71,0x53,0xFC,0xBA,0x1C,0xB6,0xEA,0x0C,0x64,0x55,
+	0x71,0x33,0x1A,0xBA,0x2D,0xB8,0xAA,0xAE,0x0F,0xB6,0x39,
+	0xAB,0x78,0xBD,0x4C,0x27,0xA5,0x4C,0x10,0x46,0x17,0xEC,
+	0x84,0x67,0xB1,0xFB,0x90,0x17,0x71,0xD1,0x86,0xFC,0x0D,
+	0x97,0xCC,0xDC,0x58,0x60,0x1A,0x9A,0x1D,0x63,0x41,0x6D,
+	0x72,0xF1,0x55,0xA2,0xA5,0xCB,0x95,0xD4,0x54,0x78,0xC0,
+	0x35,0x19,0xAD,0xDE,0xC9,0xA6,0xE9,0x4E,0xF9,0x6F,0x1F,
+	0x25,0xAC,0xA3,0x2A,0xB1,0x75,0xD4,0x38,0x39,0x5B,0xF5,
+	0x02,0xB6,0x04,0xD4,0x4B,0xE9,0x82,0x4F,0xFC,0xFC,0x1D,
+	0x5A,0x0B,0x48,0xD7,0x3F,0x31,0x55,0x9C,0xD0,0xD9,0xE3,
+	0x9F,0x98,0xE9,0x0A,0x5A,0xF3,0x18,0xE9,0x50,0xF3,0x14,
+	0x6A,0xAA,0x55,0x4C,0xBD,0x31,0xA1,0x36,0x19,0x85,0xAB,
+	0x8C,0xB8,0x82,0xB2,0x59,0xD5,0x39,0xE3,0x63,0xC6,0xC0,
+	0x3C,0x5D,0xF3,0xFE,0x89,0x1F,0x78,0x5E,0x51,0xD8,0x42,
+	0xA8,0xC6,0xB9,0xBD,0xD1,0x93,0xE7,0x80,0x2A,0x8C,0x7E,
+	0x8C,0x9E,0x05,0x1F,0x49,0x63,0x29,0x83,0x13,0xF2,0x06,
+	0xF5,0x7F,0xA6,0xF3,0xCC,0x7D,0xF4,0x39,0xA0,0x1C,0x31,
+	0xA9,0x42,0x83,0xAE,0x08,0x37,0x03,0x3F,0xB4,0x5E,0xCA,
+	0x50,0x50,0x65,0x9D,0x53,0x4F,0xE1,0x9A,0x2B,0x5D,0x08,
+	0x20,0xCF,0x53,0xCE,0x63,0x17,0x50,0xFA,0xD8,0xA6,0xB3,
+	0x51,0xC7,0xE3,0x68,0x23,0x47,0x49,0x23,0x29,0x6E,0x25,
+	0xAB,0x70,0xEC,0x42,0xCE,0x39,0xAB,0x74,0x00,0xAD,0x8D,
+	0x32,0x57,0x5D,0xE6,0x8C,0x2E,0x7C,0xF5,0xB2,0x58,0x13,
+	0x65,0xF1,0x55,0x40,0x6E,0x55,0xA2,0xCE,0x69,0x01,0xBC,
+	0xD4,0x15,0xBB,0xE3,0x87,0x6F,0x1D,0x81,0xB3,0x9B,0xE3,
+	0xBE,0xE2,0xE3,0x57,0x5E,0x89,0xCE,0x2D,0x8F,0x0F,0xF9,
+	0x02,0x17,0x3C,0x97,0x4D,0x53,0x7E,0xFA,0x24,0x0E,0xE2,
+	0x9B,0x8F,0x6F,0x5C,0x2A,0x7E,0x17,0x70,0xF4,0x3A,0x1A,
+	0x3C,0x5A,0x5C,0x8F,0x20,0x05,0xF0,0x08,0xA1,0x1A,0xE5,
+	0x74,0x3F,0x0D,0x33,0xB4,0x51,0xCE,0xBC,0xBB,0x87,0x88,
+	0x46,0xAA,0x8F,0x69,0xC3,0x26,0x67,0xDE,0x77,0x86,0x88,
+	0x06,0xFA,0xA5,0x8B,0x33,0xBE,0x8F,0xE9,0xEE,0x88,0xC7,
+	0xC1,0x8D,0x18,0x6E,0xDC,0xDA,0x89,0xC6,0xF6,0x9B,0x67,
+	0x3B,0xE5,0x69,0xCF,0xD3,0xF1,0x5F,0xE6,0x9F,0x47,0x05,
+	0xD7,0xE9,0xEE,0x01,0xB9,0xD8,0xAB,0xD2,0xE9,0x0A,0xC2,
+	0x0D,0xC2,0xFE,0xB6,0x03,0xB8,0x79,0x05,0x9A,0xC8,0x1B,
+	0x19,0x30,0xBA,0x82,0xE6,0x92,0xA8,0xFF,0x9E,0x0D,0xEB,
+	0x0F,0x52,0xE9,0x1D,0xC2,0x92,0x06,0x2A,0x67,0xDE,0xD7,
+	0x2D,0xC7,0xA8,0x96,0x33,0x1A,0xCA,0xD9,0x1A,0xD4,0x01,
+	0x11,0x89,0x45,0x35,0x26,0x16,0x25,0xFB,0xD7,0x8C,0x31,
+	0x08,0x2F,0x09,0x7B,0xC8,0x87,0xDD,0xCA,0x94,0xEF,0x6B,
+	0x34,0x63,0x92,0xD8,0xF4,0x45,0x8B,0xD3,0x97,0x37,0x86,
+	0x43,0x5B,0x85,0x0A,0xFA,0x5F,0xC2,0xCE,0xA4,0xB1,0x0F,
+	0xBD,0x05,0x7A,0xA1,0x3B,0xCF,0x84,0x0A,0xC3,0x16,0x43,
+	0x24,0x15,0x5F,0xD4,0x4F,0xF1,0x1E,0x29,0x2F,0x19,0x5F,
+	0x5C,0x53,0xAA,0x28,0x72,0x72,0x6A,0x3A,0x7C,0xCA,0xA3,
+	0xCD,0xA9,0xD8,0xF0,0x69,0x94,0x92,0xF4,0x04,0x8E,0x07,
+	0xCE,0xDD,0x18,0x03,0x1A,0x02,0x46,0xA9,0xBA,0x66,0x14,
+	0xCA,0x77,0x54,0x28,0xE2,0x9D,0x2C,0x0F,0x47,0x81,0x1D,
+	0x6A,0xCD,0x82,0xDC,0xD7,0x1F,0x07,0x0D,0xAA,0x9E,0xE6,
+	0x62,0x45,0x90,0x61,0x08,0x48,0xF9,0x0B,0x84,0x47,0xF4,
+	0x98,0x5F,0x9D,0xB7,0xD0,0xC6,0xE2,0xAC,0xFA,0xC5,0x70,
+	0xE7,0x41,0x8D,0xEE,0xC4,0x5D,0x4C,0x99,0xEA,0x13,0xAE,
+	0x8D,0x0B,0x8F,0x93,0x03,0x1E,0xB5,0xDD,0x63,0xD7,0x61,
+	0x03,0xBD,0x07,0x85,0x02,0x64,0x99,0x7A,0xCA,0xCB,0xC4,
+	0xCC,0x5D,0xEA,0x26,0x03,0xCC,0xC8,0x9A,0x07,0x5C,0xB7,
+	0x53,0x05,0x09,0x2D,0x86,0xA3,0xC9,0x69,0x47,0xDD,0xBA,
+	0x59,0xF9,0xC5,0x70,0x31,0x89,0x8E,0xD1,0x61,0x1E,0x72,
+	0x2B,0xF1,0xFD,0x2F,0x5E,0x4D,0x30,0xD0,0x86,0x07,0x93,
+	0x4B,0x36,0x67,0x43,0x9C,0x25,0x40,0xE0,0x6C,0x14,0xE5,
+	0xB8,0xB2,0x94,0x73,0x9F,0x44,0x22,0x2F,0x15,0xA5,0xE2,
+	0x22,0xC8,0x26,0xA3,0x70,0xD8,0xDF,0x32,0x93,0x19,0x17,
+	0xA6,0xD2,0x15,0x41,0xBA,0xA8,0x23,0x66,0xBA,0xF3,0x70,
+	0x19,0xC7,0x8A,0xAB,0x81,0x34,0x22,0xBE,0x45,0x57,0x69,
+	0x22,0x69,0x30,0xCA,0x48,0xD3,0x35,0xA2,0x50,0x60,0x07,
+	0xE1,0x0F,0xF9,0x37,0x0F,0x87,0x4F,0xD7,0x67,0xC2,0x61,
+	0x9A,0xBC,0x37,0x2D,0x74,0x63,0xB4,0x03,0x3C,0x88,0x3F,
+	0x72,0xDE,0x6C,0x5A,0x8B,0x30,0x9F,0x1C,0x64,0xAB,0xB7,
+	0x17,0xE4,0xE1,0xC8,0xB0,0x79,0x84,0x6F,0x9A,0xE0,0x1D,
+	0x35,0x63,0x8C,0xD8,0x9A,0x2F,0xE5,0x66,0x6B,0xC4,0x8F,
+	0xA5,0xA7,0x39,0x8D,0x78,0xDE,0x4E,0x63,0x37,0x0D,0xEE,
+	0x07,0xD1,0x76,0x8A,0xE5,0xB3,0xC9,0x0B,0x14,0x39,0x6F,
+	0x3E,0xD6,0x78,0xC0,0x37,0x6D,0x84,0x77,0x24,0x80,0x18,
+	0x52,0x00,0x6F,0xD2,0x77,0x35,0xE2,0x20,0x86,0x36,0x07,
+	0x05,0x9D,0xB2,0xE7,0x33,0x50,0x67,0x6E,0x04,0x11,0xFA,
+	0x3A,0x57,0xCD,0x80,0x26,0x4B,0x33,0x2C,0x22,0x5F,0x60,
+	0x0F,0xB7,0x45,0x8B,0xB9,0x85,0x04,0x74,0x0B,0x94,0x02,
+	0xEF,0x48,0xBB,0xE7,0xB7,0x98,0xCD,0xDD,0x79,0x6F,0x59,
+	0x12,0x83,0xF4,0xA1,0x0A,0x29,0xF8,0xEC,0xC2,0xD4,0x3E,
+	0x3A,0x56,0x2E,0xE7,0x4A,0x29,0x87,0x29,0x6A,0xD5,0x55,
+	0x1D,0x9A,0x04,0xDE,0xAE,0xC7,0x5F,0x07,0xFE,0xC6,0xAF,
+	0x59,0xF3,0xD4,0x0A,0xDF,0x06,0x8A,0x03,0x5E,0x4F,0x0F,
+	0x93,0xD7,0x21,0x34,0x20,0xE2,0x50,0x0A,0xA0,0xEA,0xAF,
+	0x02,0x5B,0x37,0x7C,0x8B,0xCE,0xF7,0x0F,0xDF,0x87,0x33,
+	0x83,0x77,0x13,0x3B,0xA5,0xC1,0x57,0x62,0x72,0xCA,0xB7,
+	0x38,0xDD,0x5D,0x6D,0x65,0xB5,0xA4,0xB1,0xFF,0xDE,0x0A,
+	0x2D,0x63,0xDA,0xA1,0x25,0x90,0xF7,0xE0,0x2A,0xF8,0xA9,
+	0x42,0x28,0x4A,0xEA,0xE3,0x68,0x74,0xED,0xDC,0xFD,0x3B,
+	0xBA,0xA8,0xD2,0x16,0xC1,0xF9,0x6D,0xCB,0xCB,0xB1,0x25,
+	0xD4,0xCD,0x55,0x87,0xBF,0x3B,0x82,0x5A,0x78,0xE3,0xE2,
+	0x02,0x68,0x61,0xC2,0xFE,0x6A,0x5F,0x71,0x15,0x3D,0x11,
+	0x53,0x14,0x52,0xEE,0xFB,0x21,0xAE,0xC5,0x87,0xB6,0x6E,
+	0xAE,0x7B,0xB5,0xF8,0xD5,0x62,0xD1,0x0C,0xB5,0x0F,0xB8,
+	0x97,0x82,0xC4,0x41,0x8F,0xF1,0xEB,0x33,0x84,0xFD,0x7A,
+	0x04,0xAC,0x7C,0xFF,0x87,0x89,0x6D,0xE6,0x00,0x6E,0x02,
+	0xBE,0xF1,0x30,0x92,0xF1,0x4E,0xE2,0x14,0x3F,0x96,0x25,
+	0xAB,0x4F,0x16,0xE7,0x4E,0x8A,0x22,0x29,0x30,0xA1,0xAC,
+	0x62,0x5D,0x2B,0x9E,0xC7,0x8B,0x9C,0x3B,0x7F,0x05,0x7C,
+	0x07,0x69,0xC6,0xA6,0xC0,0xC2,0xFE,0x50,0x15,0x07,0xF5,
+	0xE2,0xFC,0x54,0xD8,0x3F,0xEC,0x57,0xB4,0xA5,0x15,0xC4,
+	0xDE,0xDD,0xD5,0xDA,0x49,0x7E,0xE7,0x27,0x25,0x03,0xED,
+	0xA7,0xB5,0xC5,0x00,0xB9,0x66,0xF7,0x03,0x42,0x3B,0x16,
+	0x85,0xA3,0xA7,0x70,0xFC,0x5A,0xD0,0x28,0xD6,0xC8,0xCF,
+	0xD3,0xB1,0x48,0xED,0xD5,0x74,0x7C,0x3A,0x40,0x07,0x7A,
+	0xBA,0x74,0x73,0xE5,0xC9,0x87,0x90,0x10,0xB6,0xF1,0xD6,
+	0x67,0x1F,0x27,0x01,0xE9,0xF0,0x2C,0x2C,0x4F,0xD3,0x0F,
+	0x69,0x96,0x48,0x4F,0xAD,0x52,0x1C,0xCA,0xD2,0x85,0x8B,
+	0xBA,0x85,0xFD,0x6C,0xC2,0xF6,0xB7,0xE6,0x68,0x51,0x57,
+	0xD6,0x96,0xAC,0x58,0xDD,0x47,0xB9,0xEF,0x5D,0x27,0x9A,
+	0x26,0xE5,0xBD,0xC8,0xD4,0x88,0x9D,0xB4,0xF7,0x06,0xF5,
+	0xF8,0xC9,0x39,0x77,0x23,0xE0,0x76,0xFD,0xCF,0xA8,0x8D,
+	0x93,0xD9,0x59,0x4B,0x59,0x8F,0xA7,0x28,0x5A,0xE8,0x39,
+	0x1D,0xD4,0xD1,0xA3,0x4D,0x03,0xC6,0x87,0x34,0x96,0x92,
+	0x13,0xF5,0xCA,0xAB,0x18,0xE3,0xCE,0xA3,0xC9,0x5D,0x45,
+	0xCA,0x5F,0x9D,0xCC,0x3C,0xB8,0xAA,0x2D,0x82,0x08,0xA8,
+	0x4B,0x49,0x6A,0x13,0x7A,0xFD,0xF0,0xBA,0x11,0xEA,0xE2,
+	0x54,0xF1,0xEB,0x6A,0xF5,0xC2,0x40,0xAB,0xC3,0x06,0x64,
+	0xF8,0x01,0xD5,0xDD,0x61,0x98,0xA5,0x0D,0xC8,0xC0,0x30,
+	0x8A,0x42,0x8E,0xD6,0xB2,0x0A,0x2F,0x8E,0x9E,0x58,0xD9,
+	0xB9,0xB1,0x42,0x76,0x0D,0x54,0x48,0x24,0x02,0x85,0xEC,
+	0x74,0xD2,0xD5,0x5C,0xDA,0xAC,0xDE,0x73,0xE2,0x30,0xAF,
+	0xD2,0x19,0x83,0xAC,0xEE,0xCF,0x26,0xC2,0xA6,0x55,0x32,
+	0x55,0x79,0xF7,0x51,0xBA,0xE0,0x72,0x47,0xAC,0xA0,0x86,
+	0x81,0x0A,0xD2,0x22,0x35,0xD3,0x9D,0x48,0xCD,0xF1,0x18,
+	0xD8,0xDE,0xBA,0xCE,0xC5,0xBA,0x8E,0x87,0xBB,0x58,0x79,
+	0x86,0xC1,0x9D,0x4B,0xA5,0xBD,0x0A,0xBC,0xF2,0xB0,0x21,
+	0x83,0x01,0x77,0x6E,0x7B,0x51,0xA1,0xDB,0x15,0x7E,0x0E,
+	0x20,0xCB,0x38,0x7B,0xAF,0xA3,0x6B,0x0F,0x8E,0xBD,0xA8,
+	0xDB,0x14,0x57,0xE2,0xFE,0x6C,0x94,0x28,0xFF,0xA3,0x58,
+	0xAE,0x3F,0xA1,0xCF,0xE7,0x6A,0x5D,0xE9,0xAA,0xDC,0x19,
+	0xA2,0xCA,0x9D,0x9F,0x50,0xB9,0xB3,0xB1,0x57,0xFA,0x7C,
+	0x99,0x1D,0xC2,0x98,0x22,0x55,0x19,0x5C,0x1E,0xD4,0x77,
+	0xA0,0xF0,0x1C,0xEB,0xE6,0xAD,0xBA,0xB7,0x76,0xC4,0xC2,
+	0xD5,0x60,0xF7,0x2C,0x6B,0xBA,0x6E,0xF9,0xD8,0x63,0xD4,
+	0x56,0x1B,0xE8,0xD1,0x2B,0xB7,0xAE,0xA2,0x83,0x33,0x7E,
+	0x27,0xC8,0x37,0x33,0x55,0x60,0x7C,0x9B,0xCF,0x1D,0xAE,
+	0x9C,0x8E,0x44,0x2A,0xF5,0x78,0x3E,0x71,0x13,0x36,0xB4,
+	0x4F,0x21,0xCB,0x6E,0x06,0x40,0x28,0xFF,0x10,0x1A,0xFA,
+	0xA1,0x4D,0x74,0xEA,0xA2,0x2C,0x3D,0x17,0x89,0x30,0x75,
+	0x17,0xA6,0x47,0x6F,0x40,0x84,0x4F,0x3C,0x87,0xEB,0x46,
+	0xD2,0xD4,0xB3,0xF2,0x31,0xF9,0xB4,0xB0,0x8B,0x18,0xC8,
+	0x6A,0x9E,0xDC,0x6F,0x24,0x4B,0x4D,0x30,0x01,0xC8,0xA3,
+	0xD6,0x65,0xCF,0xFE,0x3B,0x24,0x94,0xEF,0xA6,0xC6,0xE3,
+	0x85,0xD3,0x30,0x07,0x06,0x4B,0xA9,0x08,0x86,0x1F,0x28,
+	0x23,0x4D,0x0A,0xD9,0x49,0xE1,0xF4,0xE8,0x7B,0x13,0x29,
+	0xCC,0x8D,0xBE,0x37,0x93,0x42,0x7B,0xF4,0x5D,0x21,0x85,
+	0xB3,0x28,0xA9,0x5B,0x37,0x4E,0xE3,0x69,0x61,0x68,0x05,
+	0x8B,0x65,0x68,0x6F,0x80,0x55,0x0C,0xB8,0x21,0x0E,0x36,
+	0x1F,0x07,0xDB,0x18,0x07,0xDB,0x84,0x90,0x74,0x5F,0x05,
+	0xA9,0xD0,0x1C,0x07,0x2A,0x3D,0x0E,0x54,0x46,0x1C,0xA8,
+	0x4C,0x04,0xC5,0x7F,0x25,0x28,0x4B,0x1C,0x28,0x6B,0x1C,
+	0xA8,0x09,0x71,0xA0,0x26,0x53,0x8A,0x83,0xF6,0x2C,0x4D,
+	0x94,0x74,0x3D,0xDA,0xE1,0xCF,0xC3,0x12,0xF4,0x5F,0x59,
+	0xC2,0xEC,0xB8,0x12,0xE6,0xC7,0x95,0x50,0x14,0x57,0xC2,
+	0x92,0x28,0x60,0x43,0x0C,0xB0,0xE1,0x2B,0x01,0x2F,0x8F,
+	0x03,0xBC,0x32,0x0E,0xF0,0x9A,0x38,0xC0,0x8F,0x44,0x01,
+	0x27,0x21,0xE0,0x6F,0x21,0xE0,0xA4,0xAF,0x04,0xFC,0x58,
+	0x34,0x93,0x31,0x86,0x8D,0xF1,0x2B,0x33,0x3D,0x19,0x87,
+	0xCD,0xBA,0x38,0x6C,0x5C,0x71,0xD8,0x6C,0x64,0x6D,0x99,
+	0xEF,0x3B,0x7C,0x25,0xAE,0x8B,0x07,0x69,0xA2,0x2C,0x05,
+	0xBB,0xE1,0xAE,0x93,0xA9,0x6C,0x09,0x44,0x99,0xEA,0x47,
+	0xA3,0x74,0x77,0x93,0x8E,0xA9,0x83,0x6E,0x9C,0x9B,0x25,
+	0xB1,0x46,0x6D,0x1F,0x60,0x4F,0xD7,0xDD,0x9A,0x2E,0xE5,
+	0x3D,0xCF,0xD6,0xED,0xCA,0xA8,0x4A,0x87,0x1F,0x5C,0x50,
+	0xFF,0x1C,0x86,0xD5,0xEA,0x7F,0x03,0x8F,0x17,0xF5,0xB8,
+	0x50,0x51,0xAB,0x7F,0x01,0xDE,0x7F,0x07,0xEF,0xBB,0x7E,
+	0x0D,0x2F,0xBB,0xFE,0x3D,0x35,0x7A,0x90,0x04,0x17,0xF5,
+	0x1E,0x89,0xC4,0x7A,0xA0,0x38,0x98,0x65,0xDB,0x4D,0xAD,
+	0xE4,0x5B,0xF0,0xE8,0x5E,0xBB,0xFE,0x38,0x2E,0x41,0x88,
+	0xC3,0x59,0xCC,0x3E,0x7D,0xE2,0xA0,0xAD,0xFC,0xAA,0x39,
+	0x9A,0xDB,0x28,0x0E,0x63,0x2A,0x2A,0xEF,0x32,0x81,0x6C,
+	0x32,0xE6,0xEA,0x84,0x8A,0x17,0x28,0x26,0x58,0xFA,0x7B,
+	0xA8,0x90,0xE0,0x4A,0xE4,0xA1,0x46,0x90,0x0D,0xCA,0x9F,
+	0x3F,0x8B,0x44,0xB6,0xD5,0xE3,0x96,0x1F,0x5D,0x9D,0x2C,
+	0x6E,0x56,0x3E,0x84,0x10,0x96,0xC0,0x8F,0x09,0xEE,0x7C,
+	0x10,0x55,0x79,0x34,0xD9,0x60,0x09,0x14,0xA5,0x75,0x35,
+	0x50,0xBA,0xCC,0x8F,0x6A,0xE0,0x2A,0x16,0xAA,0xBC,0xB7,
+	0x1A,0x0D,0xAD,0x9B,0xE5,0x55,0x0C,0x8C,0xB2,0xF3,0x33,
+	0x9C,0x11,0x77,0xD0,0x49,0x86,0x89,0x21,0x3C,0x02,0x22,
+	0xC2,0xCB,0x18,0x53,0x70,0x56,0xFB,0x5C,0xA2,0x72,0x09,
+	0x7C,0x6F,0x64,0x08,0xCE,0x87,0x84,0x74,0xD5,0xA9,0x91,
+	0xCE,0x5A,0x1B,0xDB,0x8F,0x68,0xF1,0x84,0x08,0xCD,0x17,
+	0x4E,0x61,0xC0,0xBE,0x0F,0x69,0x2A,0x39,0xCA,0x3F,0xCA,
+	0xC9,0x7E,0xF0,0xFA,0xEA,0xF8,0x2A,0x5F,0x5D,0xC5,0x2A,
+	0x1B,0x5D,0xF3,0xA5,0xBC,0x5F,0x53,0xF4,0x66,0x42,0x59,
+	0xE3,0x23,0x5F,0x50,0x2B,0x57,0xB9,0x11,0x3F,0xD0,0x28,
+	0x75,0xEB,0x45,0xFC,0x9D,0x5A,0x13,0xD7,0x02,0xD2,0x58,
+	0xD1,0x9B,0x0D,0xC8,0xF8,0xB0,0x49,0xAD,0xDE,0x1B,0xDB,
+	0x04,0xDC,0xB0,0xDC,0x7F,0x8F,0x95,0x9B,0x8A,0x85,0xDC,
+	0x54,0xB9,0x7D,0x57,0x17,0xFF,0x9F,0x35,0xDF,0xFF,0xFB,
+	0xF7,0x8D,0xD8,0x4B,0xFE,0x8B,0xF6,0x2E,0x6A,0xDA,0x9D,
+	0xA6,0x34,0x6A,0x4A,0x04,0x93,0x8A,0x3B,0xE8,0x7B,0x40,
+	0x31,0xB3,0xCF,0xC9,0x52,0x1E,0x35,0xD7,0xD8,0x92,0x02,
+	0x62,0x5B,0x39,0x79,0x06,0x26,0xDC,0x43,0xE2,0xAD,0xAD,
+	0x06,0xB6,0xEF,0x53,0x61,0x17,0x45,0x8D,0x3A,0x0E,0x9B,
+	0xEF,0x65,0xCA,0x5C,0x50,0x4F,0x4F,0xAE,0xAB,0x40,0x41,
+	0xA8,0xBA,0x41,0xAD,0xF1,0xAD,0x0A,0xF9,0x8A,0x43,0xD1,
+	0x7D,0xF5,0x90,0x66,0xA6,0x92,0x5C,0x02,0x69,0x36,0x87,
+	0x24,0xBA,0x61,0xBB,0x9E,0x65,0xE2,0x7C,0x8E,0x17,0x6A,
+	0x1D,0x55,0xE6,0x99,0x20,0xBF,0x06,0xD3,0xE9,0x45,0xF1,
+	0x61,0xD9,0xF1,0x5A,0xE0,0x82,0x99,0x6E,0xE0,0x26,0x57,
+	0x63,0x87,0xAE,0x82,0x44,0x64,0x18,0x52,0xA0,0x8C,0xA4,
+	0xE2,0xA9,0x8A,0x46,0xEE,0x36,0xE2,0xF1,0x6D,0x47,0x25,
+	0xC7,0x86,0x9B,0x5D,0xE6,0x34,0x36,0x94,0xBC,0xC6,0x60,
+	0x6A,0x3C,0x90,0xBE,0xA5,0x27,0x12,0x09,0xEA,0x31,0x46,
+	0xDB,0xA7,0xF3,0xC6,0xD9,0x2C,0x4E,0x53,0x29,0xF2,0x1F,
+	0x2E,0x50,0x29,0x52,0xCF,0xE2,0x53,0x55,0x36,0x13,0x94,
+	0xB6,0xDF,0x61,0x01,0x6E,0xBF,0x2E,0xD0,0x04,0xB3,0x9A,
+	0x73,0x3E,0x87,0x5F,0xD9,0xD1,0x43,0x97,0x64,0xE3,0xE7,
+	0x3D,0x7D,0x60,0xB9,0xBE,0x1C,0x96,0xBE,0x17,0xD6,0xAC,
+	0xAF,0x84,0xF5,0x5F,0x03,0xC0,0x1A,0x02,0x59,0xD1,0x60,
+	0x01,0xC6,0x7B,0x45,0x9B,0x08,0x61,0x40,0xDA,0x1A,0x13,
+	0x61,0xB8,0xEE,0x6F,0x67,0x7C,0x71,0x65,0xAA,0x80,0x90,
+	0x5F,0x07,0xBE,0xA0,0x80,0x76,0x77,0xD3,0x21,0xBD,0x21,
+	0x6C,0x55,0xE3,0x40,0x3F,0x50,0x5E,0x64,0x71,0x8C,0xF7,
+	0x6A,0x02,0xF6,0x81,0xF7,0xA3,0x25,0x96,0x4D,0x8B,0x96,
+	0x1D,0x46,0xB5,0xF4,0x23,0x87,0x53,0xEC,0xAC,0x74,0xBA,
+	0xB2,0x16,0x45,0x61,0x75,0x14,0x85,0x71,0x30,0x10,0xF9,
+	0x1C,0x47,0x70,0x25,0x9C,0xA0,0x8D,0x39,0x2D,0xA9,0x89,
+	0x02,0x77,0x77,0x70,0xE2,0x3D,0xE1,0x49,0x79,0xF8,0x5E,
+	0x36,0x85,0x06,0xF5,0x26,0x4E,0x86,0xC4,0x86,0x3E,0x89,
+	0x93,0xE5,0xE2,0xC6,0xAD,0x17,0x68,0xBA,0x50,0x82,0xCF,
+	0x8B,0x3E,0xFC,0xC8,0xB5,0xE3,0x16,0x42,0x84,0xA1,0x05,
+	0xB3,0x0D,0x95,0x52,0x34,0x97,0xFB,0x6B,0x77,0x2F,0xA5,
+	0xFD,0xE9,0x9A,0x85,0xAB,0xEC,0xC5,0x6D,0xB8,0xE6,0x7E,
+	0x4C,0x85,0xB6,0xD7,0x57,0x7C,0xD5,0xE6,0x3F,0xBC,0xD6,
+	0x8E,0xC8,0x5D,0xED,0x35,0x70,0x9A,0xD1,0x00,0xB3,0xCD,
+	0x7A,0xD4,0xFA,0x9F,0xA7,0x1D,0x84,0x92,0x2D,0x94,0x6F,
+	0xA6,0x07,0xA6,0x15,0x8D,0x98,0x4A,0xCE,0x04,0x2E,0x98,
+	0xDC,0x17,0x05,0xA7,0xED,0x54,0xF2,0x69,0x5C,0x8D,0x17,
+	0x87,0xCB,0xC5,0x6D,0x10,0x06,0x01,0xE4,0x24,0xBC,0xBA,
+	0x2F,0x08,0xC9,0x27,0xC9,0x82,0x36,0xB9,0xD8,0x48,0x96,
+	0x1B,0x08,0x76,0x60,0x52,0xE3,0x24,0x45,0xBC,0x5C,0xDC,
+	0x9A,0xF5,0x31,0xBC,0xA4,0x40,0x22,0xE9,0xA2,0x40,0x8A,
+	0x4C,0x01,0x85,0xC7,0x8E,0x86,0x9E,0x49,0xAA,0x85,0xFD,
+	0x90,0xA8,0xB8,0x91,0xF6,0x9D,0xBD,0xF0,0xF6,0x8E,0xF2,
+	0x41,0x17,0xD0,0xB4,0x20,0x84,0x07,0xAB,0xA8,0xE9,0xD7,
+	0x55,0x65,0x1C,0x20,0x47,0xEA,0x7A,0x0F,0xF7,0xF8,0x7B,
+	0xE7,0x88,0xB1,0xC9,0xE0,0x4B,0x6A,0xB5,0xD9,0x4E,0x45,
+	0xEB,0x6C,0xAA,0x5A,0x05,0x21,0x9F,0xE3,0xF5,0x5A,0x47,
+	0x23,0x5E,0x91,0xA7,0xB8,0xBB,0x54,0x53,0x8C,0xE1,0x30,
+	0xD9,0x95,0x8B,0x8F,0xD3,0x24,0xAC,0x0E,0xD0,0xD4,0xAF,
+	0x3A,0xCE,0xFE,0xA2,0xB7,0x0C,0x52,0x1D,0x2B,0xE5,0x54,
+	0xB4,0x14,0x7F,0xB4,0x14,0x0B,0x82,0x4E,0x8D,0x02,0x81,
+	0xA2,0x48,0x71,0x48,0xC9,0xEC,0xA2,0xBA,0x89,0x5A,0x2D,
+	0x09,0x73,0x5B,0xD6,0xDE,0x8A,0x4D,0xB1,0xF6,0xC6,0xE7,
+	0xF7,0x05,0xF9,0x60,0xB4,0xB1,0x8D,0x87,0x76,0x49,0x61,
+	0x60,0x0B,0xFA,0x45,0xB4,0x39,0x91,0xE2,0x06,0xE5,0x50,
+	0x67,0x6F,0x53,0x82,0xF9,0xFE,0x94,0xAD,0x9D,0xB4,0xD5,
+	0x25,0x64,0x10,0xE2,0x33,0x78,0xE3,0x32,0x0C,0xE0,0x5F,
+	0x65,0x1A,0xE9,0x5D,0x24,0xB8,0xA7,0x2F,0x42,0x42,0x79,
+	0x05,0xDD,0x02,0x63,0x48,0xCD,0x20,0x8D,0x7D,0x18,0xBB,
+	0x1D,0x18,0x7B,0x07,0x85,0x1F,0xC2,0x4D,0x99,0xE3,0x01,
+	0xC5,0x48,0x77,0xBC,0x3C,0x05,0xBC,0xD7,0x71,0xDC,0x53,
+	0xA0,0x8F,0xB2,0x02,0x30,0xFD,0x2E,0x66,0x48,0x43,0x4D,
+	0x26,0xCA,0xAE,0x55,0x21,0xE5,0x93,0xEB,0x34,0x33,0x03,
+	0xFB,0xA5,0x10,0x62,0x1B,0x14,0xFF,0x93,0x91,0x2A,0x6E,
+	0x8F,0x84,0x2D,0x36,0xC5,0xEC,0xD5,0x9D,0xDB,0x1A,0xA3,
+	0x96,0xE8,0xDB,0xFC,0xCE,0xE8,0x76,0x76,0xAB,0x33,0xC7,
+	0xA1,0xB8,0xBE,0x85,0x0B,0xBD,0x45,0x68,0x75,0x5E,0x14,
+	0x11,0x9B,0x23,0x62,0xD3,0x63,0x7F,0x32,0x44,0xAD,0x56,
+	0x97,0xFB,0xD1,0x6A,0x35,0x43,0x39,0xB8,0x30,0x0E,0xC5,
+	0x3E,0x36,0x36,0xD1,0x31,0xF1,0x07,0x03,0x8E,0x89,0xB2,
+	0x3F,0xB6,0xAE,0x8D,0xEB,0xEA,0x96,0x34,0xB4,0x9D,0xCA,
+	0x48,0xC3,0xAE,0x38,0x8C,0x36,0x8A,0xF4,0xBD,0x05,0x86,
+	0x13,0x3F,0x48,0x72,0x92,0xD1,0x34,0x8E,0x0C,0xC3,0xC8,
+	0x07,0x55,0x7B,0x94,0xB8,0x75,0xC5,0x83,0xB5,0x80,0x55,
+	0xD5,0x12,0x74,0xDD,0x31,0x1C,0xA7,0xF5,0xBF,0xA3,0x53,
+	0x0E,0x0A,0x83,0x46,0x09,0xFB,0x33,0xAA,0x56,0x60,0x6C,
+	0x07,0x48,0x62,0xEC,0xD4,0x3C,0xDD,0x66,0x70,0x57,0xA7,
+	0xC8,0x79,0x13,0xD2,0xFA,0xAF,0x03,0xDE,0x46,0xA3,0xE5,
+	0xBC,0xC9,0x03,0xC4,0xE1,0x12,0xA5,0x99,0x53,0x01,0x57,
+	0xAD,0x41,0xA8,0xBB,0x00,0x2A,0xA8,0xDE,0x58,0xDE,0xAE,
+	0x11,0x74,0x98,0xDB,0x9D,0x09,0x8F,0xBD,0x76,0x44,0xDE,
+	0x33,0x3E,0x1D,0xDF,0xF3,0xF1,0x1D,0x2D,0x1E,0x86,0xD0,
+	0xB5,0xFF,0xD1,0x34,0x41,0x21,0x06,0xEE,0x1A,0x9E,0x16,
+	0x85,0x86,0x27,0xE3,0x95,0x25,0x00,0x6D,0xA7,0x35,0x8D,
+	0xAE,0x67,0x8C,0x16,0xF6,0xEB,0xB3,0x70,0x64,0x1D,0x1A,
+	0xC2,0x85,0x31,0xE7,0xEE,0x2C,0x06,0x1E,0xA3,0xC3,0x06,
+	0xA1,0xE2,0x59,0xA4,0x10,0xC3,0xAA,0x70,0xE9,0x53,0xF9,
+	0xE1,0x5B,0x91,0xC8,0x6E,0x35,0xEB,0xE3,0xB1,0x35,0xD4,
+	0xA6,0xFB,0x80,0x8A,0x1A,0xDB,0xA9,0x40,0x98,0xC7,0x26,
+	0xEE,0x6E,0x12,0xD0,0x48,0x6B,0x39,0xB6,0xE6,0x2A,0x27,
+	0x59,0x75,0xC6,0x47,0x1F,0xE7,0x94,0x99,0x3D,0x28,0x27,
+	0x1A,0x22,0x28,0xA3,0x43,0xAC,0x6B,0x57,0x9C,0x12,0x33,
+	0xA3,0x28,0xEC,0x78,0x8B,0x7A,0x38,0x19,0x66,0xA5,0xD5,
+	0x94,0x45,0x31,0xF0,0x0C,0x43,0x7A,0x07,0x1C,0xBB,0xFB,
+	0xDB,0x7E,0x44,0x6B,0xD5,0xB2,0x77,0x26,0x3B,0x2C,0x10,
+	0x65,0x09,0x22,0xAA,0x8E,0x09,0xFD,0x4D,0x41,0x06,0xB2,
+	0x3D,0x8F,0x42,0x1A,0xB3,0xD7,0xC1,0xF6,0xE0,0xA2,0x90,
+	0xBE,0x64,0xAB,0x73,0x47,0xFF,0xB3,0x0B,0xF4,0x80,0x36,
+	0xCC,0x93,0x46,0x50,0x7F,0x2D,0xCA,0x06,0x1C,0xB7,0xEF,
+	0x89,0xC2,0xBE,0x63,0xEF,0x2C,0x2F,0xEB,0x0B,0x2F,0xF6,
+	0xEE,0xF5,0x25,0x96,0xD3,0x16,0x2B,0xA7,0x2D,0x6E,0x1C,
+	0xA2,0xB6,0x5C,0x41,0x15,0x6C,0x76,0xB0,0x6C,0x76,0x45,
+	0xBB,0x98,0xEE,0xCE,0xB3,0x52,0xD5,0x60,0x90,0x73,0x27,
+	0xD6,0x3C,0x6D,0xC2,0xE8,0xDA,0x2A,0x9A,0x2C,0x50,0x36,
+	0x2E,0x5A,0xE7,0x19,0x5C,0x48,0xD8,0xBF,0x5C,0x9B,0xFD,
+	0xBE,0x68,0x74,0xCA,0x2C,0xA5,0xBB,0x9A,0xCF,0x0F,0x37,
+	0xA8,0x66,0x59,0xFF,0x37,0xE9,0xBF,0x0B,0x17,0x1D,0x3C,
+	0xAE,0xD3,0x68,0x3A,0xD1,0x45,0x50,0x35,0x1E,0x12,0x0C,
+	0x64,0xF9,0x2F,0xD3,0x20,0xF4,0xD0,0xF3,0xA9,0x2B,0x95,
+	0x86,0x7A,0xEA,0x2E,0xA3,0x67,0x86,0x9A,0xCA,0x4F,0xE9,
+	0x67,0x2C,0xC1,0xF8,0x4F,0x01,0x44,0xDE,0xA7,0xF4,0x5C,
+	0x77,0x42,0xC2,0xE8,0x07,0x33,0x2F,0x87,0x00,0xE0,0xA9,
+	0x3C,0x6C,0x09,0xF0,0xA7,0x52,0x00,0x5E,0x5C,0x66,0xEF,
+	0xEE,0x6A,0x3D,0x00,0x61,0xEF,0xC2,0xBE,0xBA,0xCA,0xB4,
+	0xBE,0x51,0xA0,0xC9,0x81,0x1A,0x27,0xEC,0x1B,0xBD,0x06,
+	0x82,0x92,0x03,0x30,0x66,0xD7,0x5D,0xBB,0xE2,0x19,0x86,
+	0x1E,0x57,0xD0,0x0C,0xEF,0xDA,0x95,0x5D,0xE8,0x73,0x05,
+	0x79,0xBA,0xA8,0xAA,0x08,0xFA,0x8F,0x97,0x46,0x79,0xCC,
+	0x5E,0xEA,0x8B,0xA5,0x6A,0x21,0x8F,0x1F,0x25,0x58,0xA7,
+	0x3F,0x46,0x2F,0x53,0xF0,0xF7,0x9F,0xF0,0xF7,0x07,0xF8,
+	0x5B,0x94,0xAB,0xDB,0xB0,0x14,0xC0,0x47,0xAC,0x15,0x45,
+	0x0B,0x70,0x19,0x61,0x39,0xD6,0x2E,0x68,0x27,0xB5,0xFA,
+	0x95,0x69,0xEC,0xCA,0xDB,0xF0,0x3D,0xFD,0x43,0x39,0x4D,
+	0xD8,0x12,0x0D,0x1D,0xA4,0xC1,0x99,0x3B,0x7D,0x97,0x06,
+	0x45,0x53,0x48,0x1A,0xCD,0x4E,0x0C,0x92,0x87,0xE1,0xE7,
+	0xEE,0x69,0xA8,0x83,0x57,0xEF,0x46,0xAF,0x41,0x64,0xD8,
+	0x74,0xFA,0x6B,0x47,0x8C,0x91,0x1F,0x9E,0x80,0xE7,0xCD,
+	0x97,0x1E,0x86,0x2F,0xFF,0x87,0xDA,0x3D,0x66,0xD7,0xC4,
+	0x4A,0xC3,0xC1,0x7F,0x50,0xE6,0xBE,0xA5,0x53,0x1D,0x29,
+	0x49,0xCD,0x57,0x8C,0xAD,0x34,0xB0,0xD2,0xC0,0x82,0x3D,
+	0x4D,0x97,0xC3,0x63,0xF7,0x58,0x5C,0xB7,0x81,0x54,0x16,
+	0x4E,0x98,0x3D,0xAD,0xD2,0x71,0x6D,0xDF,0x04,0xC2,0xBE,
+	0x80,0x32,0x1A,0xCD,0xF7,0xD4,0xBD,0xCD,0xA0,0x1E,0xB9,
+	0x57,0x94,0xE5,0x67,0xDE,0xB4,0x46,0x52,0x9E,0xED,0x42,
+	0x46,0xED,0x7A,0x04,0x7E,0x28,0x0A,0x41,0xEA,0xE2,0xA8,
+	0x68,0x8F,0x59,0x28,0xDF,0x8D,0x12,0x29,0xDA,0x00,0x38,
+	0x5C,0xE9,0xC0,0xFA,0x08,0x41,0x00,0x92,0x4B,0xAB,0x90,
+	0x96,0xD7,0x17,0xD9,0x3D,0x78,0xE6,0x64,0x57,0x11,0xAD,
+	0xCA,0x23,0x81,0x0E,0xAD,0xBB,0x49,0x07,0xFC,0x3D,0x78,
+	0x04,0x0F,0x5E,0x6E,0xA7,0xF2,0xF5,0xF2,0xC1,0x37,0xA3,
+	0x60,0x21,0x29,0xAB,0x67,0x8A,0x02,0x54,0x7B,0xE5,0xD0,
+	0x84,0x8A,0xD7,0xF8,0x77,0xAD,0xA1,0xC3,0x48,0x11,0x1B,
+	0xCA,0xF7,0x41,0x33,0xDA,0x85,0x28,0x2A,0x7F,0xFD,0x82,
+	0x51,0xB6,0xC7,0x22,0x94,0x1F,0xC7,0xB5,0x8A,0xEF,0x63,
+	0xBD,0x6B,0xAC,0x6D,0xB9,0x21,0x97,0x39,0xB7,0x52,0x34,
+	0xF5,0xE2,0x18,0xC5,0x17,0x71,0x67,0xFC,0xCA,0xE5,0x4B,
+	0x8D,0xB9,0x86,0xF5,0xE3,0x73,0x93,0x36,0x4C,0x08,0xEA,
+	0x11,0x36,0xB7,0x35,0x2F,0x9A,0x5C,0x4C,0xA2,0xDB,0xBA,
+	0xE1,0x51,0xB8,0x82,0xAA,0x09,0x0F,0x65,0x0F,0x3D,0xB3,
+	0x4C,0xA4,0x89,0x35,0xCA,0x9B,0xA8,0x0C,0xB3,0x76,0x3C,
+	0xB4,0x6F,0x63,0x4D,0xC4,0xD9,0x95,0xC2,0xF0,0xD5,0x41,
+	0x8E,0xBE,0x2D,0xC2,0x67,0x32,0x93,0x54,0x6C,0x0D,0xAC,
+	0x61,0xA4,0xDA,0xD5,0x46,0xBC,0xC7,0x2E,0x94,0xFF,0x94,
+	0x2E,0x6A,0x25,0xA2,0xED,0x39,0x92,0x9B,0xE4,0xE2,0xA1,
+	0xC5,0x26,0xAB,0x48,0xE3,0xB9,0x00,0x5A,0x8A,0xD4,0xCD,
+	0x6D,0x30,0x55,0x4E,0xA0,0x05,0xD3,0xF2,0x06,0x6A,0x90,
+	0xB5,0xFA,0x69,0xB1,0xB0,0xE9,0x69,0xEC,0x52,0xF2,0x5A,
+	0x7D,0x6E,0x2C,0xCC,0xAE,0x86,0x51,0x14,0x24,0xD7,0x82,
+	0x5E,0x0E,0xAA,0xC5,0xF5,0xB6,0xF8,0x7E,0x40,0x35,0x31,
+	0xA0,0x14,0x54,0x6E,0x2C,0xCC,0xAE,0x86,0xF5,0xDB,0xE3,
+	0x5E,0xA9,0x1A,0x50,0xBC,0x76,0xB8,0x69,0x1E,0x0E,0x85,
+	0x78,0x9C,0xEA,0x35,0xE7,0xEE,0x87,0xE9,0xB8,0xE8,0x2B,
+	0x7E,0x6D,0x37,0x16,0x4E,0x55,0x7C,0x98,0xD7,0xBE,0xA6,
+	0x19,0xA5,0xD8,0xE6,0xE1,0xBC,0xF6,0xB5,0x51,0x42,0xC5,
+	0x22,0x0D,0x5A,0x8E,0x57,0xE6,0xC2,0x24,0x44,0x4A,0xC5,
+	0x0C,0x52,0xB8,0x20,0x57,0x1B,0xFD,0xB0,0x87,0xEF,0xCE,
+	0xE5,0x81,0x4D,0xFA,0x68,0xC0,0x9A,0xB0,0x95,0xF2,0xCD,
+	0x18,0x0D,0x58,0x17,0x1E,0x9A,0x9B,0xE2,0x32,0xE6,0x0E,
+	0x82,0x40,0x93,0x98,0xC4,0x02,0x67,0x3B,0xDD,0x79,0x0F,
+	0x53,0xD1,0x3E,0x91,0x16,0x38,0x04,0xD0,0x01,0x34,0xA2,
+	0x18,0x54,0x9A,0x23,0xCA,0x9F,0xE7,0x22,0x06,0x7F,0x89,
+	0xB8,0xD4,0x2C,0x6B,0xA2,0x59,0x84,0x8A,0x80,0x06,0x45,
+	0xDA,0xC1,0x06,0xDA,0x17,0xDE,0x56,0xFB,0x42,0x4D,0xE5,
+	0xAB,0x07,0x94,0x58,0xC8,0x1C,0x57,0x0A,0x06,0x3A,0x9A,
+	0x73,0x5F,0x15,0xAF,0xD0,0x10,0x4F,0xE3,0x65,0x69,0x73,
+	0xF3,0xAB,0x42,0x85,0x1B,0x77,0x4A,0x19,0x3B,0x76,0xF8,
+	0x56,0xED,0x38,0xDC,0x8D,0xA4,0x32,0x62,0x7C,0xC5,0x3B,
+	0xAE,0xBC,0x52,0x35,0x8A,0x21,0xB1,0x43,0xB3,0x55,0xB9,
+	0x63,0x2E,0xCE,0xC6,0x77,0x48,0xAE,0xD4,0x76,0xC7,0x1E,
+	0x2E,0x8A,0xBD,0x36,0x76,0x80,0x2C,0x63,0x7E,0x94,0x9B,
+	0x78,0x1C,0xEC,0x38,0xF2,0xB2,0x0E,0x97,0x40,0x87,0x31,
+	0x10,0x75,0x1A,0x83,0xF2,0xF1,0x1C,0x6A,0xC3,0x7F,0x5C,
+	0x83,0x30,0x9A,0x28,0x8C,0xEF,0x63,0xFD,0xC6,0x38,0x90,
+	0x0F,0xA4,0xEC,0xA5,0x88,0xFF,0xAD,0x1F,0x29,0x7F,0xEB,
+	0x47,0xCA,0xDF,0x7A,0x49,0x89,0xA2,0x23,0xB5,0xEB,0xE9,
+	0x43,0x28,0xFF,0x2D,0x8A,0x11,0x74,0xEF,0x71,0x40,0xF5,
+	0x40,0x67,0x6B,0xF7,0xD4,0xCC,0x71,0xD9,0x69,0x18,0x02,
+	0x09,0x4A,0x1F,0x49,0xE8,0x97,0x4C,0xF2,0x38,0x94,0xE9,
+	0xEF,0x88,0xDF,0x12,0xF6,0x85,0x84,0x7D,0x5D,0xB6,0xCE,
+	0xF6,0x6A,0xCE,0x65,0x96,0xAE,0x70,0x20,0x7B,0x92,0x0B,
+	0xB7,0xF6,0x2C,0x87,0x3E,0x59,0x96,0x72,0x50,0x62,0x3E,
+	0xE3,0xC2,0x7F,0xAF,0xA8,0x5F,0x5F,0x20,0xEC,0x73,0x28,
+	0xC2,0xBE,0xD3,0xB6,0x6A,0xB4,0x6B,0x9B,0x16,0xE8,0xE0,
+	0xDD,0x4D,0x6A,0xF9,0xFC,0xAE,0x85,0xD8,0x1F,0x3B,0xF4,
+	0x78,0xD4,0x82,0x13,0x07,0x63,0x4A,0x16,0x4F,0x23,0xB0,
+	0xDF,0x2C,0xA4,0x1D,0xB9,0xB9,0x53,0x75,0x6E,0xD9,0x77,
+	0xBF,0x73,0x6B,0x2B,0x16,0x45,0x02,0xED,0x7A,0xCA,0x1A,
+	0xB6,0xF6,0x51,0xC4,0xC8,0xD2,0xAA,0x5F,0x30,0xE6,0x23,
+	0x14,0x35,0x94,0x4F,0x48,0x63,0x4C,0xF8,0x92,0x12,0xBE,
+	0xEC,0x09,0x5F,0x96,0x84,0x2F,0xB3,0xFA,0xF5,0x58,0xC8,
+	0x80,0x27,0x0B,0xF0,0x48,0x51,0x91,0x12,0x74,0xE0,0x69,
+	0xF1,0xC9,0x15,0xF5,0x62,0x2A,0x0B,0x52,0xCA,0x51,0xAE,
+	0xA9,0x1F,0xE4,0xA8,0x32,0x7E,0x3E,0x5D,0x27,0x46,0x21,
+	0x8A,0x58,0x61,0x6F,0x2D,0xA2,0xD2,0x46,0x47,0x3B,0xEA,
+	0xEC,0xA2,0xC8,0xDD,0xF8,0x15,0xB9,0x1B,0x3B,0xD5,0x63,
+	0x23,0x93,0x7A,0x41,0x3F,0x41,0x41,0x67,0xC6,0x81,0x9E,
+	0x98,0x08,0xFA,0xE8,0x3C,0x76,0xCC,0x20,0x36,0x07,0xA4,
+	0x47,0xDA,0x3D,0x35,0x74,0xBC,0x80,0xF1,0x6A,0x4C,0x74,
+	0x90,0xB0,0xF6,0x00,0xDE,0x30,0x2D,0x17,0xF6,0xB1,0x61,
+	0x7F,0x90,0xE3,0xEA,0xE5,0x70,0x1A,0x0C,0x52,0x29,0x9E,
+	0x46,0x1A,0x60,0xD2,0x5E,0x2E,0x3F,0xEB,0x4A,0xAA,0xA2,
+	0x63,0x88,0xBE,0x0A,0x05,0x0B,0xED,0xE4,0xD1,0xB3,0x0B,
+	0x8B,0xA2,0x20,0x67,0x44,0x41,0xD2,0x6C,0xD6,0x9E,0xCB,
+	0x03,0x0E,0x89,0xD2,0x71,0x63,0xBF,0x31,0x31,0x13,0x8A,
+	0x9B,0x50,0xA9,0x65,0xDA,0x49,0x34,0x57,0x65,0x0A,0x8D,
+	0xBF,0x4C,0x87,0x88,0xA0,0x66,0x6F,0x95,0x19,0xF7,0xB3,
+	0x8C,0x59,0xB8,0x6F,0x7F,0x83,0x32,0x4D,0xDC,0x8D,0xCA,
+	0x34,0x0D,0x58,0xE6,0xA4,0x4A,0x5D,0x9F,0x32,0xD3,0x12,
+	0xCA,0x6C,0x60,0x65,0x5A,0xCC,0x92,0xD1,0x42,0xF5,0x10,
+	0x3A,0xEE,0x7A,0xA8,0x7A,0x52,0xD3,0xA3,0xC7,0xC7,0x4B,
+	0xF8,0x33,0x83,0x39,0x5C,0x7B,0xB6,0x1D,0xCD,0x27,0xF1,
+	0xB5,0xA7,0x8E,0x0E,0xD3,0xB4,0x89,0xA2,0x7D,0x52,0xAB,
+	0xD1,0x33,0xCB,0xCA,0xA3,0x97,0xCA,0x13,0x9A,0x68,0xF2,
+	0xF5,0xC9,0x34,0x29,0x46,0x78,0xE1,0x8F,0x05,0x96,0x2D,
+	0x11,0xF6,0xCD,0xB7,0xF2,0xC2,0xBE,0x61,0x6B,0xA8,0x0B,
+	0xB7,0x93,0x34,0xCD,0x1D,0x10,0xEF,0xE1,0xAD,0x3B,0xA9,
+	0xFB,0xC2,0x53,0x59,0x11,0xAE,0x5A,0xCA,0xB5,0x6A,0xD6,
+	0x4F,0xC8,0x3A,0x2B,0xE5,0x61,0x3A,0xCD,0xFA,0xE1,0x4E,
+	0x39,0xC5,0x5D,0xAD,0xED,0xA9,0x71,0x12,0xA3,0xDB,0xAF,
+	0x9D,0x41,0x55,0xAE,0xD2,0x4B,0x3D,0xB5,0x33,0x72,0xAD,
+	0xA5,0x8D,0xC2,0xBE,0x59,0x14,0x26,0xC2,0x9A,0x58,0x0D,
+	0x2D,0x8D,0x01,0xAF,0x8E,0x39,0x44,0x0C,0x65,0xB5,0x4B,
+	0x9B,0xAC,0xBC,0x66,0xBD,0x2D,0xEB,0x54,0x14,0xE4,0x18,
+	0xA7,0xB0,0x2F,0xB5,0x10,0x17,0x46,0xCF,0x1B,0xA5,0x7A,
+	0x4B,0x4F,0xB5,0x0A,0x9A,0x62,0x56,0x7A,0xA1,0x27,0x38,
+	0xC3,0x65,0xE5,0x4B,0xDF,0x72,0x1F,0x31,0xC6,0xE6,0x83,
+	0xB4,0x89,0x55,0xE7,0xA6,0x88,0x83,0x83,0x7A,0xEA,0x57,
+	0x4F,0x79,0x17,0x54,0x07,0x6A,0x4E,0x90,0x9B,0x2C,0x4E,
+	0xA0,0xBE,0xF6,0x4C,0x49,0x3D,0x7E,0xCA,0xC6,0x19,0x54,
+	0x69,0x29,0xFD,0x51,0x34,0xE9,0x6B,0x3D,0xB8,0x27,0xDF,
+	0x5D,0xB2,0xAA,0xE6,0xA5,0xB8,0x68,0x53,0x34,0xDA,0x87,
+	0x67,0x1D,0x00,0x75,0xC4,0x28,0xAB,0x9D,0x1E,0xC5,0x81,
+	0x2F,0xE4,0x32,0x29,0xEE,0x88,0xF1,0x0B,0x84,0x10,0x4D,
+	0xCF,0x85,0x7A,0x69,0x93,0x8B,0x3B,0x9C,0xC4,0xDC,0x43,
+	0xC3,0x59,0x01,0x3B,0x16,0x91,0x6A,0xB4,0x51,0x4A,0x13,
+	0xF6,0x69,0x0B,0xE8,0xF9,0x10,0x69,0x86,0x46,0xFC,0xBC,
+	0xA4,0x86,0xBA,0x59,0xA3,0xE3,0xFF,0xC2,0x98,0x47,0xC0,
+	0x54,0xB5,0x26,0xE0,0x8D,0x42,0x3E,0x49,0x8E,0x06,0x2E,
+	0x19,0x3D,0x6F,0xAB,0x8A,0x44,0x9C,0xD6,0xEB,0x51,0x40,
+	0x95,0xB8,0xDC,0x5F,0x51,0xF6,0xD4,0x61,0x38,0xDA,0xE5,
+	0x2D,0xA2,0x55,0x08,0xCC,0xA6,0x2E,0x52,0x35,0xEB,0xBF,
+	0xD5,0xCB,0xEE,0x21,0xC0,0x60,0xF4,0xD1,0xD8,0xCB,0xE2,
+	0xCB,0xC0,0xE2,0xBB,0x31,0x5D,0xE9,0x7B,0xB4,0xCD,0x1F,
+	0x44,0x95,0x06,0xF4,0xFB,0x4A,0xEE,0xE0,0x1B,0xB4,0xB1,
+	0x6A,0x69,0xC8,0xE5,0xAC,0xE6,0x1D,0x54,0xEC,0x53,0xE5,
+	0xB1,0xC1,0xFB,0xEC,0x46,0x9C,0xCF,0xA2,0x74,0xBF,0xDC,
+	0x73,0x44,0xEA,0x36,0x95,0x5E,0x80,0x9E,0x44,0x13,0x96,
+	0xD4,0xC4,0x60,0x30,0x08,0x59,0xCD,0xD0,0xA6,0x13,0xF2,
+	0x96,0xF7,0xCB,0x3B,0x21,0x9A,0x17,0xEA,0x17,0xAA,0x97,
+	0xEA,0xF4,0x7A,0xE2,0xE8,0x16,0xF6,0x55,0x1F,0x7C,0x8F,
+	0xCA,0x8B,0xEE,0xCB,0xA4,0x15,0x79,0x7A,0xB0,0x91,0x25,
+	0xC4,0x39,0x98,0xA7,0xD6,0x73,0xFA,0xE0,0x19,0xD6,0x05,
+	0x85,0x7D,0xB5,0x6E,0xBF,0xF9,0xF2,0xC1,0xF7,0xD9,0x80,
+	0x43,0x83,0x2F,0x83,0xCE,0x5F,0xC9,0x53,0xF5,0x12,0x3B,
+	0xDF,0x9B,0xB4,0xCB,0x1E,0x89,0xD1,0x47,0xBF,0x55,0x46,
+	0x8E,0xE8,0x65,0x64,0xE5,0xC5,0x38,0x06,0xA7,0xF7,0x86,
+	0x67,0xF9,0x31,0x5C,0x85,0xA6,0x63,0xB9,0x81,0x3B,0xEC,
+	0x5B,0x60,0xDF,0x14,0xAF,0x85,0x8B,0x48,0x20,0x4E,0x01,
+	0x0C,0xB4,0xE8,0xFA,0x56,0x91,0xEC,0xC7,0x34,0xA4,0x3A,
+	0xBE,0x8A,0x4D,0x37,0xA8,0xE2,0xD4,0x01,0xAA,0x18,0xEA,
+	0xC9,0x73,0x44,0x8D,0x37,0xC6,0xC5,0x37,0xD1,0x78,0xCA,
+	0x9B,0x45,0x9E,0x9A,0xA8,0xE2,0x89,0xE3,0x71,0xE5,0xD4,
+	0x83,0x7E,0x44,0x10,0x58,0x13,0x1F,0x5C,0xF2,0x3D,0x66,
+	0xBF,0x17,0x43,0x38,0x03,0xA0,0x91,0x63,0x97,0x03,0x61,
+	0x63,0x5C,0x91,0xEE,0x8B,0x9C,0x9A,0x2B,0x70,0x91,0x87,
+	0x04,0xEA,0x68,0xE4,0x5A,0x5F,0x99,0xD4,0x77,0x2A,0x66,
+	0xFD,0x34,0xB9,0x51,0xCD,0x79,0x04,0x55,0xF6,0xA4,0x04,
+	0xD4,0xD4,0x42,0x92,0x7B,0x51,0x0E,0xB4,0x24,0x63,0x01,
+	0xE7,0x39,0x75,0x26,0x77,0xDE,0x60,0x7D,0x23,0xB9,0x2E,
+	0x1E,0x42,0x72,0x22,0x71,0x20,0x05,0x2A,0x93,0xA4,0x63,
+	0x42,0x34,0xB4,0x31,0x1A,0x0A,0x3C,0x81,0xBA,0xFE,0x87,
+	0x5A,0x2B,0x54,0xC0,0x56,0xEA,0xE3,0xC4,0x34,0xD6,0x79,
+	0x54,0x00,0x9B,0xD4,0xF8,0x68,0xED,0xF1,0x71,0x6D,0x23,
+	0xD6,0x52,0x28,0x1F,0x63,0x30,0x63,0x30,0x54,0x98,0x95,
+	0x66,0x15,0x46,0x1F,0xA1,0x1E,0x83,0x19,0x6D,0x21,0xD1,
+	0xF6,0xA7,0x8D,0x42,0xDD,0x81,0x75,0x33,0x83,0x8E,0xC7,
+	0xAE,0x25,0xD0,0x0C,0x69,0x74,0x74,0xDA,0x83,0x23,0x49,
+	0x8F,0xA7,0x71,0x1A,0x67,0x3C,0x42,0x23,0xA2,0x33,0x22,
+	0xE8,0x3A,0x74,0x10,0xF2,0x8C,0xC6,0x7C,0xD1,0x21,0xA7,
+	0xFC,0x2C,0xD5,0x08,0x42,0x81,0x0B,0x5A,0x98,0x50,0x25,
+	0x87,0xD8,0x38,0x53,0x42,0xE7,0x74,0xC2,0xFE,0x3A,0x61,
+	0x3F,0x4C,0x86,0xC9,0xE9,0x40,0x47,0x5A,0xA0,0x2B,0x2D,
+	0x70,0x3D,0x35,0xD0,0x99,0x8A,0x3C,0xBE,0xA8,0x05,0x7E,
+	0x27,0x37,0x06,0xCE,0x63,0x3F,0x73,0x5F,0xE0,0x92,0xEB,
+	0x02,0x17,0xF4,0xF0,0x9A,0x1C,0xF2,0xA8,0x85,0xEA,0x62,
+	0x85,0xAE,0xF8,0x1E,0x5B,0xBF,0x63,0xBA,0x39,0xAE,0xF6,
+	0x05,0xA2,0xBA,0x48,0xF9,0x3D,0xE8,0xCB,0xB6,0x5F,0xF7,
+	0x61,0x4D,0x21,0xDA,0x3C,0xA5,0xE6,0x67,0xB0,0x12,0x47,
+	0x24,0x54,0x62,0x74,0x38,0x45,0x1A,0x72,0xBC,0x9C,0x55,
+	0x17,0x47,0x82,0xE7,0x88,0x97,0xF3,0x37,0xE9,0xFD,0x4A,
+	0x12,0x0D,0x34,0xC4,0x05,0xF2,0xD1,0xC0,0xA4,0x38,0x62,
+	0xBD,0xF9,0x63,0xAC,0x1C,0x84,0xC2,0xD3,0xDF,0x64,0xA0,
+	0x29,0xFC,0x00,0x2B,0xD0,0xC4,0x27,0x57,0x63,0x26,0x1D,
+	0x04,0x4D,0xE3,0x28,0x75,0xDE,0xC1,0xFE,0x0B,0x5A,0xFF,
+	0x25,0x48,0x71,0x2A,0x70,0x41,0xD7,0x4B,0x6D,0x2F,0x8B,
+	0xB3,0x9A,0xA5,0xA7,0x86,0xEB,0xA9,0x99,0x3C,0x96,0x4D,
+	0x8A,0xDB,0x9C,0xF2,0xC2,0x74,0x90,0xA4,0x17,0x04,0x61,
+	0xFF,0x19,0x95,0xD6,0xC1,0x40,0xD0,0xA0,0x55,0x6D,0x09,
+	0x0D,0xB0,0xD2,0xC0,0xBE,0xBC,0x2B,0xCC,0x10,0x2B,0x85,
+	0xB5,0x09,0xB1,0xC2,0xFE,0x85,0x66,0xF7,0x25,0x2D,0x39,
+	0x8D,0xB3,0xDE,0x2E,0x63,0xA0,0x33,0x19,0x7A,0x14,0x32,
+	0xBE,0xB1,0x97,0xF1,0x2A,0x70,0xCC,0xEE,0x5D,0x31,0xA4,
+	0x6F,0xF6,0x21,0x50,0x8B,0x5D,0x46,0xC8,0x0E,0x19,0x21,
+	0x3B,0x56,0x21,0xCB,0x8E,0xE4,0x7A,0x57,0x64,0x24,0x87,
+	0x7A,0x8E,0xC5,0x60,0x0C,0x89,0x93,0x08,0x51,0x00,0x19,
+	0x73,0x13,0x21,0x70,0x67,0x55,0x00,0x86,0xC4,0xF2,0x87,
+	0xD1,0xF2,0x47,0xF5,0xCD,0x3E,0x2A,0xD0,0x69,0x84,0x0C,
+	0x88,0x3F,0xE3,0x9C,0x9A,0x7C,0x38,0x4D,0x9E,0x99,0x90,
+	0x1C,0xB8,0x8E,0xB5,0xB0,0x62,0x04,0x32,0xF1,0xA2,0x1E,
+	0x8A,0x48,0x3E,0xDD,0x5F,0x9A,0xB2,0xB4,0x6A,0x78,0x52,
+	0x5F,0x19,0xE6,0xE5,0x34,0x7E,0x80,0xC2,0x82,0xA6,0x71,
+	0x10,0x2D,0xEC,0x6B,0x8C,0xB5,0x22,0x48,0x11,0xB8,0x68,
+	0x40,0xB5,0xD2,0x4C,0xCE,0x20,0xFE,0xD5,0xB4,0xF6,0xF5,
+	0x6A,0xED,0x37,0xE9,0xD5,0x00,0x3E,0x1A,0xA0,0x53,0x03,
+	0x74,0xD1,0x00,0xAD,0x1A,0xA0,0x8D,0xB6,0x0E,0x8E,0x01,
+	0xA1,0xA5,0xAA,0xCD,0x25,0x46,0xE4,0x88,0x7E,0xD8,0x3D,
+	0xA4,0x55,0x5B,0x77,0xAB,0x1E,0xE2,0x40,0x2A,0x24,0xC6,
+	0xF2,0xEC,0xB3,0xE7,0x38,0x36,0x7D,0xAE,0x4F,0xA4,0xDA,
+	0x52,0x2A,0xB5,0xFD,0xA1,0x1A,0xA5,0xE6,0xB1,0xDE,0xFC,
+	0x34,0x3C,0x97,0x15,0xED,0x3E,0xC7,0x25,0x84,0xA1,0xEB,
+	0x93,0x30,0x45,0x85,0xC1,0xF7,0x85,0x01,0x55,0x05,0xCD,
+	0x0B,0xDA,0x54,0xBE,0x00,0xD5,0x05,0x9C,0x80,0x16,0x92,
+	0x5C,0xED,0x94,0xF3,0x4D,0x59,0xCD,0xD6,0xB1,0xC2,0xFE,
+	0x78,0xB2,0xF4,0x7D,0x33,0xC7,0xB5,0xEF,0x81,0xFB,0x32,
+	0x43,0x66,0xF0,0x40,0x99,0x46,0x7C,0x45,0xA6,0x44,0x01,
+	0xE0,0x7B,0xF4,0x6A,0x82,0x3F,0x0D,0x74,0xF1,0xD3,0x2B,
+	0x57,0xF0,0xF0,0x6D,0x54,0x44,0xE0,0xB4,0xA1,0x3A,0xD0,
+	0x09,0xCD,0x5D,0x27,0x8D,0xEB,0x96,0x2E,0xE8,0x8C,0x83,
+	0xF1,0xDB,0x20,0x8D,0xEB,0x42,0x02,0x3B,0x92,0xA4,0x0B,
+	0x9C,0xBB,0x89,0x83,0x8E,0x6D,0xE5,0x8C,0x83,0xA1,0x86,
+	0xA5,0x71,0xD7,0x8C,0xDC,0x40,0x52,0x95,0x93,0xAE,0x72,
+	0xF8,0x3B,0xEE,0x53,0x7F,0x33,0x6F,0x1C,0xA7,0x02,0xD6,
+	0x01,0x14,0x00,0x21,0x8D,0xFB,0xC0,0x7F,0x41,0xCF,0x60,
+	0xF3,0x18,0xF4,0xD0,0x98,0x2F,0x24,0x84,0xAF,0xD5,0x9C,
+	0x02,0xF0,0xC6,0x85,0x20,0x64,0x20,0xAC,0xC7,0x98,0x3F,
+	0xE6,0x46,0x04,0x63,0xBB,0xEA,0x30,0x40,0xE2,0x69,0x1C,
+	0xA4,0x1D,0x87,0xC7,0xFF,0x7C,0x2B,0xC6,0x18,0xB9,0x2F,
+	0x4D,0xAF,0x87,0xF4,0x90,0xFA,0x36,0x7A,0xB0,0x4F,0xF7,
+	0xA5,0x49,0x75,0x6A,0x52,0x7A,0xD8,0xEF,0xCB,0x93,0x6A,
+	0xD5,0xA4,0xF4,0xE0,0xDF,0x97,0x25,0x3D,0xD9,0x11,0xC5,
+	0xF7,0x36,0x7A,0x1A,0xF0,0x86,0x69,0xAD,0x6A,0x2A,0x7A,
+	0xA8,0x51,0xD7,0xBF,0x37,0xF7,0x61,0x01,0x32,0xE0,0x19,
+	0x7F,0x53,0x52,0x94,0x7A,0x54,0x9D,0x12,0x93,0x66,0x35,
+	0xEB,0xF5,0x74,0x8F,0x24,0x5F,0xED,0x4A,0x95,0x5C,0xFF,
+	0x24,0x76,0x88,0xE6,0xFB,0x77,0x97,0x68,0x34,0xC4,0x1A,
+	0xFA,0xB7,0xE5,0x18,0x2A,0xEC,0x93,0xD4,0xC4,0x77,0x20,
+	0x95,0x9A,0xB1,0x81,0x2E,0x2A,0x07,0x2E,0xEA,0x71,0x9B,
+	0x36,0xDF,0x90,0x7C,0xC6,0xEA,0xA7,0xDD,0xC4,0xE0,0x24,
+	0x0B,0x8D,0x59,0xCD,0x59,0xED,0xD6,0x7B,0xA5,0x0B,0xF7,
+	0x3A,0xB3,0x43,0xA5,0x7A,0xA7,0x3B,0xDF,0x68,0xEF,0xDF,
+	0xDF,0xE2,0x90,0x48,0x21,0x35,0x03,0xA2,0x21,0x5D,0x6C,
+	0xA2,0x85,0xC1,0x18,0x92,0x82,0x30,0x8D,0x8D,0xD2,0x85,
+	0xB1,0x78,0x8A,0x1B,0x82,0xB2,0xAB,0x29,0x64,0x93,0x45,
+	0xCD,0xA9,0xBB,0x51,0xF3,0xD0,0x79,0xF2,0xD3,0xBE,0x84,
+	0xC8,0x68,0x1A,0xA1,0xBF,0x24,0x65,0x69,0x48,0x8D,0xC7,
+	0xD1,0x86,0x23,0xA4,0xCA,0x0F,0x98,0xD3,0xA0,0x8A,0xE7,
+	0x68,0x85,0x69,0x6A,0xC2,0x0A,0x7B,0x31,0x82,0x13,0xF6,
+	0x9D,0x4D,0xAE,0x26,0x8D,0xAC,0x61,0x06,0x9A,0x92,0x93,
+	0x43,0xE8,0x94,0x9D,0xE4,0x9B,0x31,0x4C,0x4B,0xC3,0x8C,
+	0xC4,0xA1,0xC4,0x0D,0x56,0x7D,0x10,0x0A,0x61,0xC2,0x24,
+	0x48,0x38,0xA8,0x58,0xA1,0xF9,0x21,0xF3,0x90,0x18,0x7F,
+	0xFA,0x89,0x16,0xAB,0x20,0x5D,0x6C,0x03,0x26,0xCA,0x0B,
+	0x87,0x24,0x37,0x66,0xB5,0x43,0xE2,0x74,0x18,0x83,0x2F,
+	0x08,0x56,0x21,0xCA,0xA1,0x74,0xF3,0x8D,0xF2,0xB2,0xD6,
+	0xB6,0x87,0x73,0x25,0xA1,0x85,0x28,0xAE,0x1A,0xE0,0x62,
+	0xAC,0x27,0x7F,0xF8,0x97,0x36,0x4F,0x24,0x4C,0xD8,0xB7,
+	0xAA,0xCD,0x93,0x3F,0x82,0x34,0xD2,0xF6,0xDF,0x97,0x2F,
+	0x43,0x06,0xE0,0x0B,0x63,0x8A,0x21,0xCA,0x14,0x6C,0x98,
+	0x19,0x71,0x23,0x66,0xA0,0x2B,0xD6,0xC0,0x60,0x60,0xC7,
+	0xD1,0xC9,0xC8,0xCA,0x4B,0x6E,0x84,0x94,0xA3,0x62,0xF4,
+	0x0F,0xEF,0x47,0xFF,0x33,0xD2,0x45,0x89,0xD2,0x3F,0x4A,
+	0xA5,0x3F,0x13,0xE9,0x7F,0xC6,0xFA,0x0C,0xD2,0x6F,0x70,
+	0x6E,0xCD,0xCF,0x94,0x34,0x51,0x69,0x39,0x90,0x3F,0xAC,
+	0x69,0xF3,0xFB,0xF8,0xC3,0x6A,0x88,0x2E,0x4A,0x86,0x86,
+	0x0C,0x56,0x46,0xDD,0x83,0xEB,0xB3,0xF4,0x7E,0x8C,0xB8,
+	0x35,0x2C,0xF7,0x74,0xD5,0xF5,0x53,0xF4,0xEC,0x4E,0xB1,
+	0xBB,0x35,0x43,0xD8,0x77,0xF7,0x3A,0x48,0xF7,0xC3,0xF6,
+	0x97,0xD0,0xE3,0x12,0x9D,0xD5,0x06,0x6D,0xD0,0x66,0x1E,
+	0xC3,0x3E,0xC4,0x5B,0x2B,0x4E,0x09,0xE5,0x7A,0x74,0xBA,
+	0xDF,0x51,0x24,0xB8,0xD1,0x7F,0xAD,0x7B,0x86,0x46,0x28,
+	0xBF,0x82,0x0B,0xD1,0xB3,0xAC,0x26,0xBA,0x3F,0x96,0x69,
+	0x95,0x53,0x72,0x46,0x3F,0x89,0xF3,0xD8,0xE7,0x6A,0x3C,
+	0x2B,0xAD,0xE9,0xB8,0xA0,0x73,0x48,0x33,0x16,0xAB,0xE6,
+	0x90,0x66,0x1D,0x80,0x59,0x69,0x35,0x4A,0x9B,0xAC,0xE9,
+	0x1A,0x0C,0x1E,0xC3,0x82,0x7F,0x42,0x83,0x79,0xE9,0x69,
+	0x03,0xC0,0xC5,0x43,0x21,0x32,0x26,0x3A,0x66,0x81,0x40,
+	0xB3,0xBC,0xC9,0x6A,0xF6,0x65,0xC2,0xE4,0xF8,0x71,0x43,
+	0xB6,0x52,0x66,0x22,0xFF,0xB4,0xBB,0x6B,0xA0,0x31,0xE6,
+	0xDE,0x19,0x6E,0xC5,0x30,0x61,0x5F,0x49,0x12,0x17,0xCE,
+	0x6E,0x2C,0xCB,0x97,0xB2,0x35,0xAE,0x5C,0xF7,0x26,0xAB,
+	0x49,0xE3,0xBA,0xCD,0x3B,0x72,0x46,0x09,0x2F,0x66,0x42,
+	0x5E,0x1E,0x31,0xA3,0x87,0xD1,0x84,0x7D,0x23,0xF3,0x93,
+	0x3F,0x20,0x35,0x50,0x6D,0xB9,0xAB,0xC3,0x35,0xA4,0x06,
+	0x42,0xB2,0xF3,0x07,0x6D,0xB2,0x1A,0x59,0xC8,0x5F,0x20,
+	0xB5,0xD1,0x67,0xD2,0xB8,0xDF,0xB2,0x00,0x50,0x00,0xFC,
+	0x38,0x03,0x6C,0x22,0xC7,0xEC,0xEE,0x00,0x16,0x39,0x26,
+	0xFC,0x51,0x84,0xB7,0xBA,0xAB,0x4D,0x2D,0x5D,0xB8,0x80,
+	0x90,0x8E,0x7C,0x28,0x4B,0x23,0x27,0xED,0x78,0xA5,0x41,
+	0x2D,0x6F,0xB3,0xAC,0x0B,0x7F,0xE2,0x3E,0x92,0xB1,0x2A,
+	0xFE,0xBC,0x96,0xEA,0xB9,0xAE,0x8D,0xFC,0x83,0x34,0xCA,
+	0xB9,0xCF,0xC6,0xAE,0x88,0xA8,0xF1,0xF1,0x0E,0x76,0xB3,
+	0xCB,0x55,0xEA,0x1A,0xD4,0xAF,0x95,0x47,0x70,0x8E,0x36,
+	0xBC,0x58,0xE1,0x3B,0xB2,0xC3,0x28,0x17,0xB7,0x99,0x8E,
+	0xDB,0xEA,0x9D,0xA4,0xA0,0xA7,0xA2,0x7D,0xFD,0x60,0x08,
+	0x31,0x9D,0x80,0x52,0xF2,0x31,0x20,0xFB,0xB3,0xD2,0xAB,
+	0x3E,0xFE,0x1E,0xB9,0xD8,0xA8,0x73,0xB4,0x49,0x47,0x0F,
+	0x38,0x89,0xB9,0xE5,0x71,0x7A,0xB3,0x04,0x24,0x9D,0x27,
+	0xAF,0x6A,0x93,0x66,0x68,0x5C,0x33,0xE9,0x59,0xD2,0x3B,
+	0x84,0x7D,0x5A,0xE5,0xE0,0x74,0xDC,0xFF,0x05,0x6E,0xDD,
+	0xC7,0x2B,0x7F,0x9A,0x8E,0xFB,0x9F,0xAD,0xE2,0x60,0x20,
+	0x5E,0x3B,0xC8,0x61,0x72,0x12,0x1D,0xF5,0x43,0x1D,0x4E,
+	0x61,0x01,0x46,0x08,0x28,0xC8,0x07,0x0E,0x43,0x21,0x55,
+	0x50,0xAA,0x2F,0x3D,0xD9,0x64,0xD1,0x15,0xB7,0x65,0x7F,
+	0x56,0x96,0x12,0x2D,0x3F,0xFC,0xB9,0x6A,0xAA,0x62,0xD4,
+	0xC4,0xD9,0xF3,0xAC,0x21,0x8E,0x97,0x3D,0x78,0x86,0xF2,
+	0x35,0x9B,0x3F,0xE8,0x68,0xE3,0x88,0x63,0x0F,0x71,0x34,
+	0x6D,0xCD,0xD1,0xCC,0x83,0x19,0x8E,0x11,0x9E,0x0B,0x34,
+	0x1A,0x51,0x17,0x71,0x34,0xC9,0x8E,0xD7,0x98,0x4F,0x65,
+	0xF7,0xE6,0x97,0xA1,0xF5,0x3C,0xCC,0xAB,0x8B,0x57,0xC4,
+	0x51,0x87,0x76,0xB6,0x23,0xD8,0x2E,0x8D,0x91,0x2E,0x15,
+	0xBE,0x20,0x3B,0x5E,0x46,0x5F,0xD8,0x1A,0x5B,0xBB,0x6C,
+	0x37,0x12,0xF1,0x75,0x74,0xBA,0x57,0x2D,0x6B,0x2B,0xFC,
+	0xAE,0x22,0x68,0xC0,0xAA,0x87,0xF2,0x70,0x86,0x3C,0xBD,
+	0xD7,0x99,0x29,0xA9,0x73,0x5F,0xBF,0x7F,0xBD,0xBE,0xEA,
+	0x7E,0xC6,0x56,0xF4,0xD0,0xAB,0x03,0xC0,0xB2,0xA3,0x2E,
+	0xBB,0x66,0xFD,0x60,0x61,0xDF,0x82,0x56,0x08,0xE5,0xEA,
+	0xDC,0x1D,0x23,0x37,0xE8,0xC8,0xAA,0xBA,0x88,0xE3,0x75,
+	0xE8,0x8F,0x33,0xC3,0xAF,0xCA,0x0E,0x80,0xDE,0x28,0x3B,
+	0xCE,0x09,0x7F,0x76,0xD4,0x71,0x7E,0x4C,0xA8,0xBC,0x31,
+	0x05,0x97,0x65,0x86,0xB1,0x2A,0x3B,0x29,0xA7,0xB2,0x55,
+	0x31,0xEE,0xA8,0xBC,0xE0,0x65,0x61,0xDF,0x1C,0x03,0x57,
+	0xCF,0x1D,0x25,0x8E,0x2A,0x52,0x7C,0x1C,0x2D,0x8B,0x7E,
+	0xA3,0x53,0x7D,0x67,0xE3,0x65,0x07,0xEB,0x1F,0x90,0x17,
+	0x00,0xA4,0x05,0x47,0xE4,0xE2,0x23,0xB1,0x4A,0xC7,0x6B,
+	0x1C,0x6C,0xA7,0xD0,0x37,0xCE,0xFA,0xF1,0xB2,0xA3,0xC1,
+	0x97,0x9B,0xCC,0xF9,0x75,0x9B,0xAB,0x74,0x8E,0xE3,0x11,
+	0x47,0x43,0x81,0xBB,0x16,0xF8,0x2B,0x67,0x50,0x59,0xFB,
+	0x60,0x4F,0x4E,0xF1,0xB9,0xD2,0x96,0x08,0x3A,0xE2,0x3E,
+	0x92,0xE3,0xA8,0x2B,0xFD,0x0B,0xE0,0xEF,0x94,0x47,0x5B,
+	0x92,0xF1,0xB8,0xC2,0x6C,0xE9,0xD8,0x41,0xE2,0xD8,0x5B,
+	0xE1,0x5F,0xFF,0x2D,0x61,0x5F,0x2A,0x83,0x7D,0xD4,0xC7,
+	0x27,0x03,0x20,0x27,0xC9,0x00,0x12,0x38,0x20,0x00,0x3E,
+	0x0A,0x9C,0x64,0x39,0x00,0xDA,0x5B,0xFA,0x9E,0x5C,0xBC,
+	0x37,0x1E,0x8B,0x97,0x64,0xC7,0x4B,0x80,0x1F,0xE7,0x57,
+	0x41,0x12,0xC7,0x6F,0x64,0xC8,0x2B,0x0F,0xB3,0xD0,0xEB,
+	0x97,0x7E,0x23,0x1D,0xAD,0x93,0x8E,0x9D,0x80,0x86,0x05,
+	0xA1,0x07,0xD5,0xF6,0x39,0xF1,0x24,0x44,0x64,0x9F,0x5C,
+	0x6F,0x82,0x77,0x0A,0x38,0xFB,0x68,0xE9,0x55,0x80,0xA3,
+	0x73,0x50,0x38,0x6A,0xD6,0xE3,0xD2,0xD1,0xD7,0x6D,0x11,
+	0x27,0x29,0xEA,0xC1,0xC3,0xD6,0xEB,0xEF,0x45,0xFF,0x88,
+	0x8A,0x96,0x38,0x2A,0xB3,0xAF,0x89,0x49,0x3B,0x33,0x93,
+	0xB1,0xC3,0xEF,0xB4,0xC2,0xA3,0x08,0x3E,0x33,0xD8,0x27,
+	0xE6,0x94,0x17,0x54,0xCA,0xC5,0x4A,0x11,0x41,0x17,0xCF,
+	0xF7,0x29,0x35,0xDD,0x91,0x48,0xCE,0xE6,0xC6,0xD2,0xA3,
+	0xD1,0xEC,0x21,0xD9,0xD1,0x38,0x9B,0x38,0x9E,0x93,0x36,
+	0xB7,0x41,0x9B,0x79,0x1B,0x50,0x8A,0x6B,0x28,0xA1,0xC8,
+	0x30,0x17,0x0A,0xD3,0xCD,0x2F,0x68,0x5C,0x83,0x2B,0x4E,
+	0x89,0xA9,0xD0,0xCA,0xDC,0x9B,0x9B,0xB4,0x82,0xFB,0x35,
+	0xB4,0xB2,0x38,0x7A,0x37,0x2E,0xDC,0xBD,0x00,0x6D,0x26,
+	0xA0,0x8C,0xB9,0x8D,0x5D,0x17,0x25,0xA6,0x28,0x43,0xE9,
+	0x6B,0xE0,0x63,0xA3,0x3B,0x72,0x8B,0x50,0x8E,0x6E,0x5E,
+	0xDD,0x91,0x54,0xA1,0xFC,0x49,0x74,0xDC,0x1B,0xD1,0xCC,
+	0x86,0xD6,0x5A,0x22,0x2F,0x08,0x01,0x52,0x91,0xBB,0x11,
+	0x5F,0xC0,0x2B,0x72,0x37,0xE5,0xD5,0x15,0xC5,0x0A,0xE8,
+	0x55,0xB4,0x8B,0x7A,0x59,0x7C,0x2E,0xCC,0xDD,0x4F,0xDA,
+	0xE8,0x49,0x72,0x45,0xD6,0x28,0x7F,0x60,0x2E,0x9B,0x2F,
+	0x46,0x33,0x66,0x46,0x33,0x66,0xB0,0x8C,0xE1,0xAE,0x48,
+	0xA4,0x65,0x7A,0x24,0x12,0x81,0x12,0x8A,0xA0,0x84,0xE5,
+	0x37,0x2A,0xA1,0x1A,0x12,0x16,0xE6,0x88,0x8D,0xA5,0x5A,
+	0x5B,0x7B,0x1C,0xFC,0xFB,0x18,0xFC,0x0F,0x6F,0x04,0x5F,
+	0x46,0xF8,0x8D,0x3D,0x14,0x3E,0xEB,0x77,0x11,0xDA,0xEF,
+	0x4C,0xD0,0xE9,0xC8,0x74,0x9B,0xBF,0xE5,0x37,0x58,0x97,
+	0x11,0x8B,0xF0,0xB3,0xBF,0x42,0x22,0x77,0xE4,0x19,0xC1,
+	0xFD,0x2A,0xB5,0x58,0x6C,0x8C,0x47,0x84,0x5C,0x51,0xF1,
+	0x40,0xF7,0x96,0xC7,0x0B,0x95,0xBB,0x01,0x6A,0x3F,0x5C,
+	0x84,0x7D,0x76,0x5E,0x79,0x70,0x1A,0xDA,0xB8,0x91,0x0E,
+	0x65,0x29,0xBC,0x64,0x57,0xBB,0x4C,0x91,0x05,0xCD,0x22,
+	0x6F,0x6B,0x0F,0xEB,0x0A,0xC3,0x27,0x6E,0x84,0xE4,0x47,
+	0x9D,0x68,0xDB,0xDD,0xAC,0x11,0xB6,0xDF,0x89,0x36,0x3A,
+	0x31,0x88,0x20,0x31,0xA8,0x83,0x6E,0xDA,0x7D,0x0A,0xE5,
+	0x62,0xE8,0x3E,0xC5,0xFE,0x58,0xFB,0x5E,0xE0,0xB7,0xF9,
+	0x69,0xCF,0x19,0x07,0xDD,0xC6,0x37,0x6D,0x88,0x6E,0xF3,
+	0x71,0x9D,0x58,0x65,0x67,0x9D,0x66,0x8C,0x3B,0x88,0x6D,
+	0x12,0x7A,0x8D,0xE3,0x5C,0x69,0x38,0x82,0x4E,0xBE,0xFD,
+	0xD8,0x6B,0x0E,0xCA,0x8E,0x2A,0xA5,0x73,0x02,0x96,0xBF,
+	0x27,0xD1,0x7E,0x30,0x66,0xA7,0x5E,0x6F,0x8B,0x90,0x05,
+	0x8A,0x3B,0xEF,0x31,0xB6,0x7F,0x3C,0x42,0x1B,0x6B,0x5A,
+	0x7B,0x8C,0x42,0xB9,0x41,0x8B,0xDB,0xAE,0x38,0x9C,0x29,
+	0xEF,0x76,0x40,0xBD,0xD1,0x86,0xA6,0x6C,0x9C,0xCA,0x4E,
+	0x10,0x7D,0x8E,0xAB,0xC5,0xC7,0x2C,0xCC,0x29,0xEF,0x87,
+	0xF8,0x71,0xD8,0xC2,0x0C,0x70,0xF2,0xF0,0x4A,0x16,0x71,
+	0x7E,0x84,0x66,0x75,0xE7,0xE1,0xAF,0x66,0xF3,0x78,0x3C,
+	0x84,0xBA,0x1B,0xDF,0x77,0x62,0x69,0xEE,0x5C,0x4E,0xE3,
+	0x1A,0x14,0xD1,0xD3,0x24,0x01,0x53,0xF8,0x12,0x4B,0xFD,
+	0x04,0xFD,0x35,0xD1,0x24,0x5C,0x40,0x59,0x03,0xC5,0xB6,
+	0xE0,0xA1,0xFC,0xBC,0x17,0xE9,0xE9,0x65,0x96,0xFE,0x09,
+	0xFA,0x6B,0x62,0x23,0xB3,0x3B,0x57,0x4B,0xFD,0xC1,0xEC,
+	0x8E,0x8F,0x49,0x55,0xF3,0x5B,0x20,0x7F,0x78,0x3E,0xFB,
+	0x94,0xEF,0xA6,0x65,0xC1,0x40,0x09,0x72,0x30,0x5F,0x9F,
+	0x5D,0xE3,0x4A,0x86,0x82,0x0B,0x20,0x40,0xFC,0x14,0x7F,
+	0xD2,0x6A,0x69,0x66,0xB4,0xE0,0xB1,0xD5,0x87,0x0D,0x64,
+	0x18,0x7E,0xE5,0xD0,0x4C,0x2E,0xBD,0xF2,0xCE,0x35,0x68,
+	0x7C,0xF5,0xA2,0xD0,0xCB,0x9E,0x8A,0x56,0xA8,0xC0,0xD8,
+	0xA7,0x68,0x56,0x1E,0xFC,0x36,0xBB,0xA4,0x4C,0xD9,0x87,
+	0x03,0x7E,0x5B,0x45,0xBD,0x50,0xFE,0x2A,0x6E,0x54,0xA0,
+	0x52,0xD1,0xE3,0xF7,0xAD,0x52,0x50,0x37,0xAC,0x53,0xEA,
+	0xD0,0xDD,0x5C,0x2D,0x32,0x6D,0x1B,0xB3,0xDD,0xC9,0xC3,
+	0xD6,0x2A,0xDE,0x97,0xC8,0x2E,0xAB,0x4A,0x11,0xC3,0x3D,
+	0x81,0x5B,0x7E,0x53,0xB8,0x45,0xE5,0x56,0x22,0xB9,0x2D,
+	0xC5,0x80,0x51,0x1E,0x6D,0xF3,0xD3,0xFE,0x45,0x4E,0xB5,
+	0x8C,0x4A,0x20,0xE6,0xBF,0x7B,0x79,0xA1,0x9C,0x6B,0x07,
+	0x7C,0xAF,0xA3,0x89,0x66,0x82,0x1F,0x02,0x76,0xE0,0x2E,
+	0x48,0x8A,0x8F,0x90,0x05,0xCD,0xEE,0x2E,0xAE,0x4C,0x7F,
+	0x88,0xD9,0x08,0x1D,0x21,0xA0,0x8C,0xE1,0x49,0x65,0x97,
+	0x45,0x9A,0x9E,0x22,0x26,0x45,0x1C,0xF0,0x19,0x4E,0x93,
+	0xA6,0x5B,0x4A,0x93,0x0B,0x72,0x8A,0x9B,0x61,0x40,0x2A,
+	0x6E,0xB6,0xE3,0x49,0xE6,0x26,0xB7,0xA3,0x99,0x87,0xCE,
+	0x50,0x84,0x2E,0xE1,0x9B,0x8B,0xB0,0x77,0x3A,0x42,0x5A,
+	0xF7,0xE6,0xD0,0x48,0xEA,0x23,0x7E,0x24,0xBD,0x04,0x24,
+	0x15,0x75,0xB7,0x49,0x0B,0x42,0xEA,0x48,0x74,0xB2,0x85,
+	0x84,0x70,0x34,0x1A,0x8D,0xA3,0xD1,0x24,0x47,0x33,0x77,
+	0xEA,0xA4,0xC2,0x9D,0x06,0x75,0x04,0xCF,0x6B,0xB1,0x83,
+	0x5E,0x8E,0x10,0x29,0x84,0x3E,0xDF,0x0C,0x43,0x59,0x88,
+	0xDC,0x9F,0xCE,0x9D,0xE6,0xFC,0x64,0x8C,0xF2,0xD9,0xED,
+	0x78,0x50,0x8D,0x87,0x0A,0x5A,0x45,0xBD,0xAD,0x40,0x31,
+	0x9A,0xF5,0x8B,0xE4,0xE2,0x86,0xDE,0xA1,0x01,0x46,0x25,
+	0xC8,0xD3,0x6C,0xAB,0x47,0x77,0x08,0x0E,0x05,0xBB,0xE9,
+	0xFA,0xF1,0x9C,0x9F,0x3B,0x15,0x71,0xB4,0x46,0x1C,0x4A,
+	0x3E,0xE8,0x00,0xF2,0x16,0x5E,0x1E,0xC3,0xD5,0x3A,0xE5,
+	0x95,0xA3,0x7A,0xE8,0x58,0x35,0x36,0x67,0x41,0x73,0xE9,
+	0x07,0x30,0x82,0x41,0xE6,0x1C,0x47,0xA8,0xF4,0x4F,0x30,
+	0x18,0x4C,0x48,0x46,0xBF,0xEF,0x16,0x36,0xB0,0x17,0x5F,
+	0x95,0x41,0x2B,0x95,0xF3,0x30,0x70,0x62,0xF5,0xD6,0xB7,
+	0x0E,0xD2,0xC0,0xE3,0xD9,0xA1,0xB2,0xEC,0xD8,0xE0,0x1A,
+	0x92,0xC7,0xF8,0x4C,0x43,0x40,0xC9,0x1A,0x09,0xC0,0xDF,
+	0x93,0x57,0x5D,0x75,0x92,0x15,0x5A,0x72,0x52,0xB7,0xA0,
+	0x59,0x1E,0xCE,0x81,0x1E,0xB4,0x72,0x70,0xB7,0x3C,0x1C,
+	0x14,0xB5,0x4D,0x83,0xA1,0x8F,0x1F,0x2F,0xAD,0x95,0x8B,
+	0x8F,0xF7,0x62,0xCD,0x0E,0xC1,0xA2,0x77,0x4C,0x56,0x46,
+	0x1D,0xDE,0x2A,0xE2,0xF0,0xFB,0xF8,0x21,0x5B,0xDF,0xC2,
+	0x5D,0xB0,0x83,0x5A,0x55,0x17,0x58,0xE0,0x2F,0x1B,0x85,
+	0x24,0x8C,0xA1,0x88,0x6F,0x1A,0xD5,0x23,0x8F,0x01,0x95,
+	0x66,0x93,0xAE,0x07,0x62,0x4A,0x3F,0x52,0xF1,0x96,0x0D,
+	0xD2,0xD1,0x7A,0x3A,0xF6,0x35,0x47,0x43,0xD2,0xA4,0xA3,
+	0x87,0x60,0xA8,0xC4,0x77,0x27,0x59,0x92,0xDF,0x83,0xD7,
+	0x04,0x0C,0x97,0x8E,0xD5,0x39,0x49,0x66,0x81,0x1A,0xAE,
+	0x03,0x61,0x09,0x41,0xAF,0x03,0xAA,0x05,0x3D,0x2A,0x59,
+	0x50,0x14,0x30,0xBA,0xB8,0x09,0x74,0x00,0xF4,0x60,0x59,
+	0x7C,0x4E,0x42,0x7D,0x99,0x50,0xC7,0xA2,0x51,0x86,0xC8,
+	0xAB,0x9A,0x41,0xE3,0x74,0x5F,0xD2,0xBA,0xC3,0x3C,0x29,
+	0xAE,0x93,0x31,0x51,0x8A,0x38,0x4D,0x5E,0xD0,0xC4,0xD5,
+	0x43,0x9D,0x72,0x47,0x41,0x05,0x4D,0x45,0x9C,0xD3,0x18,
+	0xF5,0xE1,0x4F,0x23,0x78,0x11,0x47,0x63,0x4E,0x71,0x5D,
+	0x59,0x81,0x5A,0x8E,0xCD,0xCF,0x15,0x37,0x85,0x27,0x4A,
+	0x33,0x2C,0xA5,0x56,0x48,0x8E,0xFE,0xF0,0x86,0x38,0x07,
+	0x51,0xD4,0x49,0x71,0x9B,0x5C,0xDC,0xC4,0x55,0xCB,0x69,
+	0x4C,0x6F,0x69,0x73,0x92,0x14,0x7B,0x04,0x5D,0x98,0x20,
+	0x32,0xE2,0x0E,0xEA,0x43,0x94,0x12,0x00,0x28,0x81,0xCA,
+	0x8D,0x88,0x7C,0x0A,0x88,0xBC,0x4E,0x8B,0x78,0xBD,0x6C,
+	0x72,0x1C,0x22,0x1D,0xBD,0x88,0xAC,0x54,0x11,0x49,0x40,
+	0xE0,0x78,0x7C,0xEB,0x8B,0x7A,0x9F,0x4B,0xF4,0x5F,0x62,
+	0x42,0x2F,0x93,0x42,0x39,0xEE,0x9C,0xBB,0x37,0xF2,0xC0,
+	0x8C,0x75,0x1A,0xA6,0x34,0x35,0xB9,0x9F,0x36,0x69,0xD6,
+	0x2F,0x05,0xC6,0x0A,0x7F,0x2E,0x30,0x42,0xA1,0x04,0x77,
+	0xEE,0xD5,0x0A,0xAE,0xB3,0x9D,0xC5,0x1E,0xF6,0xB4,0x51,
+	0xB3,0x7E,0x22,0xA8,0x39,0xF2,0x02,0x85,0xAB,0x87,0xD6,
+	0x18,0x71,0x34,0xCF,0x04,0xCD,0x5C,0x9E,0x21,0x97,0xF2,
+	0xD8,0x20,0x5D,0xB6,0x1E,0x27,0xF9,0x0E,0xD6,0x73,0x89,
+	0x11,0x1B,0x24,0xA8,0x9A,0x4D,0x39,0x05,0xA6,0xD2,0x57,
+	0xE5,0x02,0x5E,0xB9,0x7A,0x2B,0x28,0xDB,0x05,0xD4,0x2F,
+	0x7B,0x2D,0x36,0x07,0xCD,0x80,0x76,0x87,0x99,0x07,0x0C,
+	0x6C,0x4E,0x55,0xEB,0x50,0xD0,0x30,0xF4,0x70,0xD1,0x7C,
+	0x76,0x1B,0x0B,0x0C,0x73,0x30,0xB9,0x72,0x84,0x0E,0x0C,
+	0x89,0xDE,0xD0,0xA8,0x74,0x52,0x9F,0x98,0x42,0xF9,0x79,
+	0xDA,0xF8,0x1A,0xDD,0x4A,0x1A,0xA0,0x0D,0x5D,0x31,0xE0,
+	0x75,0x34,0x6B,0x1D,0xE7,0x26,0x6B,0xA9,0xA1,0x42,0x20,
+	0x48,0xF7,0x11,0xD7,0x29,0x93,0x2E,0x80,0x78,0x59,0x81,
+	0x87,0x04,0x5A,0x2E,0xC2,0xDB,0xCA,0x24,0x9C,0x95,0x61,
+	0xD4,0x4F,0x94,0x46,0x0C,0x58,0x1D,0x0B,0x58,0xA7,0xD4,
+	0x42,0x40,0x1C,0x14,0xAF,0x43,0xC1,0x7B,0xC3,0xFC,0xCA,
+	0xC7,0xE7,0xA3,0x30,0x5E,0xC1,0x2C,0xDF,0x8F,0x83,0xF1,
+	0x1C,0x06,0x3C,0x1A,0x07,0xC3,0x7D,0x31,0x36,0x5E,0xD5,
+	0x4D,0xA6,0x62,0xF9,0x33,0x65,0xEC,0x28,0x6A,0xA5,0x6C,
+	0x54,0x86,0x8F,0x62,0x93,0xDD,0x8E,0x15,0x68,0xFF,0xF0,
+	0x94,0x98,0x44,0x49,0x0A,0x0F,0x76,0x77,0xDC,0xEF,0x4A,
+	0x71,0x77,0xAC,0xC5,0xD0,0x5B,0x44,0xBF,0xAD,0x1D,0x48,
+	0x56,0xF2,0xE8,0x30,0xDD,0x9F,0x5F,0xCC,0x27,0x37,0xDD,
+	0x42,0xF5,0x38,0x5A,0xE9,0xF6,0xB4,0x07,0x64,0x46,0xDE,
+	0x7C,0x6A,0x22,0x32,0xA2,0x0A,0x3D,0x34,0x28,0x9B,0x80,
+	0xEF,0xBB,0xE7,0xA7,0xB1,0x01,0x73,0x38,0x47,0xBD,0x39,
+	0xA1,0xED,0x33,0x15,0x78,0xF4,0x32,0x26,0x8C,0xB4,0xD5,
+	0x07,0xD1,0x62,0xA7,0x15,0xC9,0x2C,0x56,0x90,0xD4,0xEE,
+	0x26,0x10,0xBC,0xEF,0x02,0xCF,0x94,0xB9,0x8D,0xF0,0xF3,
+	0xE8,0x48,0x1C,0x58,0xA9,0xE2,0x56,0x42,0x5F,0x61,0x76,
+	0xED,0xEE,0x32,0x8A,0x77,0x54,0xD4,0xAF,0xBF,0x00,0x19,
+	0xE7,0x60,0x4E,0x1C,0x5F,0xDA,0xC8,0x19,0xD2,0xA6,0x1C,
+	0x86,0xDC,0xCC,0x13,0x6F,0xE8,0x3C,0xDA,0x01,0x93,0xB6,
+	0xF0,0x1F,0xDD,0x5D,0xB7,0x88,0x13,0x6F,0x50,0xDA,0x76,
+	0x2C,0xED,0x87,0x58,0xDA,0xB9,0x77,0xD1,0xF6,0x35,0xFC,
+	0x63,0x77,0x57,0xAA,0xCB,0xE1,0xEE,0xB2,0x6C,0xE6,0x2B,
+	0xCE,0x6E,0x96,0x40,0xC4,0x09,0xEE,0x0D,0x11,0xAC,0x15,
+	0x98,0x48,0x89,0x50,0x1D,0xE4,0x73,0xCC,0xB7,0x14,0xF2,
+	0x09,0xFB,0x6A,0x94,0xC7,0xCF,0xA3,0xB9,0xD7,0x7C,0x6A,
+	0x6E,0x98,0xEF,0xC9,0xD4,0x52,0xE0,0xE4,0xF3,0x96,0x6F,
+	0xE3,0xD5,0x54,0xF3,0xE9,0xE6,0x6E,0xB1,0x12,0xE4,0x39,
+	0x78,0x3A,0x5A,0x15,0x0B,0x96,0xD6,0x05,0x59,0x94,0xB5,
+	0xEF,0xAA,0xF1,0xBE,0x47,0xDB,0x18,0x73,0x17,0xC5,0xEE,
+	0x65,0x54,0xAF,0x49,0xDC,0xA3,0x13,0x5B,0x77,0xED,0xA4,
+	0xB6,0x80,0x8B,0xA2,0x61,0x79,0x91,0x98,0xAF,0xB0,0x92,
+	0xB8,0xF5,0xD3,0xC9,0x41,0xC7,0xF1,0x3F,0x1E,0xE8,0xBD,
+	0x96,0x71,0xFC,0x4B,0x38,0xEE,0xDA,0xCE,0xC6,0x2E,0x5B,
+	0x9C,0x13,0x7F,0xD9,0x62,0xB2,0x17,0x94,0x7B,0x4C,0x77,
+	0x59,0xF9,0x39,0xA0,0x19,0x74,0x9C,0xBB,0x2F,0xE8,0x08,
+	0xAD,0x39,0xD0,0xFF,0x8E,0xC6,0xF8,0x6C,0xC2,0x73,0x7E,
+	0xCF,0x91,0x72,0xBF,0x0B,0x72,0x87,0x58,0xEE,0xF2,0x66,
+	0xA1,0xFC,0x97,0x5A,0xEA,0xAA,0xB3,0x37,0xAF,0xC7,0xD1,
+	0xF0,0x55,0xD9,0x1B,0x28,0xA5,0x34,0xFB,0x22,0xBC,0xF3,
+	0xCA,0xD1,0xB6,0xE7,0x2B,0xCA,0x46,0x94,0xDB,0x58,0xA1,
+	0x41,0x47,0xE3,0xE9,0x38,0x4A,0x53,0x91,0x52,0xEE,0xAB,
+	0x4A,0x6C,0xEC,0x45,0xB8,0x09,0xED,0xC6,0x1D,0xAD,0xAF,
+	0x7E,0x7D,0x6A,0x5B,0x7B,0xD1,0x45,0xE7,0xC4,0x07,0xFA,
+	0x5F,0xB0,0x39,0x27,0xE1,0x0A,0xCE,0xD9,0x5F,0x99,0xE2,
+	0xF6,0xAF,0x4A,0x21,0x94,0x67,0xA3,0xF9,0xB9,0xDA,0x20,
+	0xA0,0xB2,0xF3,0x5E,0xA5,0xB6,0x64,0xB7,0xD1,0x13,0xB1,
+	0x94,0x64,0xD6,0xA7,0xDA,0xF5,0x3B,0xA9,0x9D,0x10,0x75,
+	0xF7,0x15,0x74,0x34,0x9D,0xFE,0xFA,0x64,0x35,0xF5,0xF2,
+	0x04,0xAD,0x24,0x83,0x8E,0xBA,0xE2,0xAF,0x9F,0xB9,0xAE,
+	0x97,0x27,0xBF,0xD0,0x7C,0x0D,0x9E,0xCC,0xFA,0xCA,0x14,
+	0xB7,0x7E,0x55,0x0A,0xD7,0xC4,0x38,0x7E,0xB8,0x3B,0x8A,
+	0xC5,0x91,0x2A,0x27,0xF0,0xEA,0x35,0xCA,0x05,0x57,0x12,
+	0xF3,0x0F,0x0A,0x1D,0xD7,0x95,0x15,0x74,0x28,0x5F,0xD9,
+	0xAA,0x86,0x80,0x7C,0x65,0x5C,0x08,0x27,0xA9,0x7D,0x26,
+	0xE8,0x68,0xFE,0xD3,0xD7,0x68,0x8C,0xCD,0x2C,0x1B,0xBA,
+	0x41,0xE9,0xBB,0x97,0x61,0xF1,0xD4,0x00,0x90,0x8F,0xF7,
+	0x37,0x7C,0x4D,0x6E,0xAA,0x57,0x9F,0x76,0x50,0x66,0x96,
+	0xA7,0x40,0x77,0xDA,0xDC,0xFC,0xB5,0xB3,0xAE,0xE9,0xCD,
+	0x3A,0x27,0xE5,0x9B,0x6A,0x9B,0x1F,0x24,0x27,0xB6,0xCD,
+	0x4E,0xDA,0x36,0xEB,0x93,0xB1,0x11,0x35,0x28,0x37,0x47,
+	0xB8,0x9C,0x8C,0x84,0x37,0xDC,0x0C,0xE1,0x45,0xC9,0xDF,
+	0x14,0xE1,0x1F,0x19,0x07,0x22,0x3C,0x64,0x44,0x29,0x5F,
+	0x43,0xB3,0x07,0x3A,0x0C,0x14,0x82,0xBB,0x49,0xB7,0xBF,
+	0xC1,0xE3,0x68,0xFC,0xFA,0x0C,0xF0,0x1A,0x91,0x01,0x8D,
+	0x37,0xC3,0x80,0x07,0x8C,0xDF,0x14,0x03,0x3E,0x4C,0x1A,
+	0x88,0x01,0x6F,0xA1,0xF2,0xE1,0x50,0x6E,0xB2,0xE6,0x7F,
+	0x99,0x84,0x84,0x2B,0x37,0x43,0xF8,0xD2,0xA4,0x6F,0x8A,
+	0xF0,0x56,0xC3,0x40,0x84,0xBF,0x63,0xA0,0x35,0x0F,0xC3,
+	0x49,0x43,0xA0,0x83,0xA7,0x50,0xA0,0xE2,0x19,0x71,0xB5,
+	0x5F,0x3D,0xAC,0xC4,0xE4,0xEF,0x76,0x43,0x7F,0x3A,0xBE,
+	0x16,0xFD,0x86,0x6F,0x8C,0x7E,0xFD,0x80,0xF4,0xEB,0xE9,
+	0xE8,0x7D,0x93,0x15,0xFF,0x1B,0x3D,0x56,0x7C,0xDB,0xCD,
+	0x10,0x8E,0xEE,0xA5,0xBE,0x19,0xC2,0xAF,0xF0,0x03,0x11,
+	0xFE,0x4F,0x5E,0xAD,0xF8,0x26,0xA8,0x78,0xED,0xBF,0x58,
+	0xF1,0x71,0x03,0xEF,0xF3,0xFC,0xCD,0x55,0xFC,0x2A,0xFE,
+	0x1B,0xA3,0x5F,0x37,0x20,0xFD,0x68,0xF9,0xEF,0x38,0x77,
+	0x93,0x15,0xFF,0x7B,0x1D,0x56,0xFC,0xB9,0x9B,0x21,0xFC,
+	0x11,0xDD,0x37,0x45,0x78,0xA7,0x76,0x20,0xC2,0x9B,0x21,
+	0xD4,0xF3,0x01,0xCD,0x2D,0x7D,0xCC,0x2A,0xFC,0xAF,0x0D,
+	0x5F,0x87,0xF2,0x46,0x8A,0xFE,0x2B,0xDA,0x78,0xF4,0x3D,
+	0x5D,0x5F,0x87,0x70,0x96,0xF3,0x09,0xED,0x37,0x45,0x38,
+	0x37,0x20,0xE1,0x61,0xD0,0xAC,0xF6,0x5F,0xE9,0xCD,0xFD,
+	0xAF,0x50,0xFD,0x67,0xEE,0x66,0xA9,0x16,0xBF,0x31,0x7D,
+	0x7B,0x10,0x37,0x10,0xD5,0x78,0x93,0xC5,0xFE,0xF4,0x9B,
+	0xA3,0xFA,0x80,0xE6,0x66,0xA9,0x7E,0xE6,0x9B,0xD2,0xA8,
+	0x47,0xF6,0xA5,0x38,0xBA,0xAF,0x46,0x3D,0x8A,0x5E,0x8D,
+	0x9F,0xF3,0xFF,0x0F,0xF5,0x5A,0x4F,0xF2,0x4D,0xEB,0xB5,
+	0x0B,0xBE,0x31,0xF5,0xEE,0xE2,0x80,0xEA,0xDD,0x09,0x23,
+	0x9D,0x59,0xDD,0xA4,0xAC,0xFB,0x05,0x55,0xEB,0x9A,0x6E,
+	0x86,0xF0,0x25,0xDF,0x98,0x5A,0x77,0x69,0x40,0xB5,0xAE,
+	0x21,0x49,0x1D,0xE4,0xCE,0xC1,0x20,0x67,0xF8,0x17,0x07,
+	0xB9,0x73,0xBD,0x83,0xDC,0xB6,0xA4,0x9B,0x1B,0xE4,0x96,
+	0x7C,0x63,0xDA,0xDD,0xA5,0x01,0xB5,0xBB,0x06,0x03,0x5D,
+	0x29,0xB8,0xC9,0x8A,0xFF,0x77,0x03,0x56,0x7C,0xEB,0xCD,
+	0x10,0xFE,0xBD,0x6F,0x4C,0xAD,0xFB,0x6C,0x40,0xB5,0xEE,
+	0xAC,0x3E,0x7E,0x42,0xC3,0xC7,0x4F,0x68,0xDA,0xBE,0x3E,
+	0x03,0x9E,0xBF,0x79,0xF5,0xAE,0xE4,0x1B,0x53,0xEF,0xDA,
+	0x06,0x54,0xEF,0xCE,0xF0,0xFF,0x93,0xA9,0xEC,0x0B,0xFC,
+	0x4D,0x4F,0x65,0x1F,0xFA,0xC6,0xF4,0xBA,0x6B,0x03,0xEA,
+	0x75,0xE7,0x75,0x6A,0x97,0x57,0x6E,0x42,0xAF,0x55,0x7A,
+	0xBB,0xFC,0x7F,0xE8,0x6E,0xAE,0xCB,0x3F,0xF4,0x8D,0xA9,
+	0x77,0xD7,0x06,0xD4,0x72,0xCE,0x43,0xE8,0x7E,0x25,0xE8,
+	0x68,0x6C,0xF8,0xFA,0x4B,0x61,0x71,0x6B,0x8B,0xBB,0xB4,
+	0x37,0x47,0xF6,0xE3,0xDF,0x98,0x72,0xA7,0x19,0x90,0xEC,
+	0x4B,0x51,0x35,0x4B,0xBA,0xC8,0x2A,0x7B,0x7F,0xC3,0xD7,
+	0x6F,0xEE,0x7F,0xE4,0xFE,0x55,0xA2,0xFF,0x2F,0xD2,0xED,
+	0x5A,0xFE,0x7F,0xAD,0xDB,0x25,0xF8,0x79,0x58,0x64,0x3B,
+	0xB5,0xD3,0x62,0x46,0xFF,0x03,0xF8,0x5B,0xE1,0x77,0x69,
+	0x4B,0x6A,0xF6,0x1A,0x4F,0x8C,0xA3,0x0E,0x6B,0x4A,0x6A,
+	0x34,0xF2,0x31,0xE9,0xFC,0xBD,0xED,0x01,0x8B,0x68,0x10,
+	0xFE,0x18,0x3A,0x7D,0xA9,0x46,0xAE,0x76,0xB7,0x58,0xA6,
+	0x9E,0x3A,0xAD,0xD4,0x24,0xC6,0x74,0x42,0x8C,0xD4,0x62,
+	0x09,0x74,0x8E,0x3D,0xDD,0x11,0x1F,0xF5,0x4A,0xF5,0xE9,
+	0xA6,0x1A,0x39,0x04,0x51,0x53,0xFD,0xA7,0x2F,0xD4,0x68,
+	0x5A,0xE6,0x0E,0x49,0x2C,0x3F,0x37,0xAB,0x34,0x2D,0x37,
+	0x7B,0x43,0x0A,0x2D,0xD0,0xAD,0x64,0x95,0xD4,0xD0,0x37,
+	0xE5,0xCA,0x60,0xDC,0x84,0xCB,0x7D,0xA8,0x94,0xCF,0xFD,
+	0xE1,0xFA,0x51,0xB9,0x8F,0xC3,0xB3,0x74,0xBD,0x31,0xB7,
+	0xAC,0x74,0x44,0xEE,0xD3,0x1B,0x86,0xAA,0xA9,0x97,0x95,
+	0xD4,0xD8,0xFC,0x9E,0x10,0x7D,0xA9,0x1A,0x4F,0x31,0x66,
+	0x17,0x37,0xFB,0x7E,0x45,0x7F,0xED,0x1A,0x6A,0xE8,0x38,
+	0x81,0xCC,0xB2,0x9A,0xC8,0x12,0x6B,0x06,0xF9,0x80,0xCC,
+	0xB7,0xF2,0x15,0xA7,0xC4,0x74,0xD9,0x65,0x35,0xD9,0xFC,
+	0x5E,0x43,0xBB,0x34,0x25,0x19,0xFD,0x00,0x25,0x15,0x86,
+	0xDB,0x88,0x36,0xAC,0x78,0x66,0x59,0xAD,0xB9,0x93,0x84,
+	0x8A,0x23,0x90,0xBD,0xB0,0x22,0x02,0xBD,0x04,0xF7,0x1B,
+	0xBE,0x9B,0x25,0x54,0xD4,0xE1,0x21,0xF3,0xFB,0x39,0xE9,
+	0xFA,0x46,0xA1,0xE2,0xAF,0xE8,0x67,0xDA,0xAC,0xC6,0xD0,
+	0xFB,0x35,0x82,0xB3,0xAC,0x16,0x0D,0x71,0x59,0xD3,0xC9,
+	0x17,0xE8,0xFD,0x23,0xF0,0xA1,0x0E,0xA1,0x53,0x7F,0x0B,
+	0x50,0x78,0x66,0x76,0x87,0xB0,0xED,0x63,0x48,0x96,0x03,
+	0x29,0x44,0x1E,0x0B,0x97,0x37,0x59,0x33,0x2A,0x22,0x2E,
+	0x2D,0xF9,0x8E,0x7B,0x93,0x95,0xE7,0xC4,0xD1,0x78,0xBF,
+	0x85,0x46,0xDA,0xA0,0x15,0x87,0xB2,0x37,0x71,0x78,0x45,
+	0xBD,0x38,0x44,0xDA,0x64,0xB5,0x4E,0x11,0x07,0xC1,0xC3,
+	0xA2,0x11,0xCA,0x27,0xA0,0x25,0x14,0x3D,0xB4,0x38,0x0D,
+	0xD8,0x83,0x19,0x35,0xAC,0x78,0x9A,0x4C,0xA8,0xB8,0x86,
+	0xBB,0xDF,0xF8,0x69,0xF3,0xBB,0x8F,0x4C,0xC0,0x7B,0xAC,
+	0x73,0xA7,0x08,0xE5,0xD3,0x00,0x89,0x96,0x2C,0x3C,0x8B,
+	0x78,0x7D,0xB9,0x50,0x3E,0x0B,0x5F,0xBE,0x9B,0x25,0xA6,
+	0xBC,0x81,0x3B,0x9E,0x2D,0x78,0x46,0xF1,0x0D,0xF4,0x7A,
+	0xD2,0x92,0x8D,0x4E,0x18,0x23,0xDA,0x4D,0x43,0xDD,0x11,
+	0xEB,0x33,0x69,0xEE,0x88,0x59,0x28,0x47,0xF4,0x5B,0xC6,
+	0xA1,0xE3,0x1D,0xEA,0x27,0x1F,0x49,0xB6,0x9D,0x8A,0xC1,
+	0xF6,0x2E,0xE5,0xA4,0xCE,0x8D,0xA2,0xD1,0x1D,0xD4,0xB6,
+	0x74,0xF7,0x00,0xD4,0xCE,0xE5,0xAE,0x2B,0x2D,0x9F,0xA3,
+	0x85,0xD1,0x8B,0x2F,0xA3,0xEF,0x93,0x33,0x1B,0x52,0xC4,
+	0xD4,0x1C,0x1F,0x2E,0xB1,0xAF,0xD7,0x23,0x87,0x38,0xD2,
+	0x01,0x15,0x60,0x0E,0x74,0x8C,0x25,0x5D,0xC0,0x16,0x23,
+	0xA9,0xC3,0x6B,0xB5,0x49,0xBA,0x55,0x59,0xF2,0x14,0xE4,
+	0x5A,0x69,0xCD,0x84,0xEF,0xCC,0x40,0xD7,0x58,0x2E,0x20,
+	0xF3,0xD6,0xC1,0x67,0xB2,0xAB,0x4B,0xD3,0x44,0x43,0x0E,
+	0x64,0x29,0x35,0x14,0xB6,0xA0,0xED,0x12,0x85,0x52,0xD8,
+	0xF2,0x7B,0x34,0xDE,0xA0,0x97,0x05,0x54,0xAB,0xC8,0xD0,
+	0x2F,0xF4,0x72,0xF6,0x8C,0x1A,0xC0,0x38,0x97,0x74,0xED,
+	0xCC,0xB5,0xF7,0xDC,0x67,0x34,0xA4,0x4E,0x0D,0xEE,0xD3,
+	0x3E,0x16,0xDA,0xEA,0x95,0xC6,0x2F,0x22,0x91,0x15,0x6A,
+	0xC4,0x42,0x6A,0x5C,0x40,0xFD,0x39,0xAC,0xA8,0x51,0xE3,
+	0xAB,0xFA,0xC7,0xBF,0x42,0x83,0xB0,0x63,0xAD,0x79,0x60,
+	0xDD,0xA3,0x6B,0x2D,0xCB,0xF2,0x97,0xCC,0x7C,0x60,0x81,
+	0x65,0xE6,0x5D,0x33,0x27,0x4D,0x9A,0xFA,0x6D,0xCB,0x22,
+	0x71,0xED,0x94,0x25,0x3F,0xFC,0xD1,0xA3,0x96,0xB2,0xA7,
+	0xCA,0x5C,0x8F,0xFE,0xE8,0x4E,0x4B,0xD1,0x8F,0x4B,0x5D,
+	0x3F,0xFC,0xF1,0xDA,0x32,0xCB,0xCC,0x1F,0xAF,0x7B,0xAA,
+	0xF4,0x87,0x3F,0x78,0xCC,0x65,0x99,0x30,0x73,0xA2,0x65,
+	0xF1,0x53,0x0F,0x3F,0x54,0xF6,0xE8,0x64,0xCB,0x9C,0xB5,
+	0xDF,0xBF,0xD3,0x62,0xCB,0x9E,0x3E,0x7D,0xCA,0xB7,0xB3,
+	0xB2,0xBE,0x7D,0x27,0x94,0x8B,0x66,0xCD,0xDF,0xFF,0xF1,
+	0x5A,0x4D,0x6A,0x4A,0x97,0xBB,0xB9,0x5B,0x3E,0x47,0x46,
+	0xA7,0x63,0x2F,0x1D,0x4D,0xDD,0x78,0x57,0x59,0x35,0xCE,
+	0xDD,0x26,0x78,0x3B,0xB4,0x28,0x7F,0x76,0xD1,0x24,0xFF,
+	0xDE,0xAC,0x13,0xE3,0x76,0x7D,0x07,0xBE,0x3D,0xE3,0xA7,
+	0xC3,0xAF,0x5C,0x37,0xA9,0xFD,0x0D,0xBC,0x43,0x2B,0xA0,
+	0x98,0x9D,0x79,0xCB,0x67,0x89,0xF7,0x4A,0xE1,0x2C,0x6F,
+	0xCD,0x5E,0x4D,0x91,0x73,0xBB,0x1E,0xB3,0xDD,0x2E,0x8F,
+	0x5E,0x89,0x9E,0x79,0x6A,0x22,0x02,0xF5,0xC2,0xD9,0x06,
+	0x7C,0xA4,0x90,0x03,0x61,0x13,0x3A,0x8D,0xDA,0xEE,0xDF,
+	0x3B,0xF7,0xC4,0xB8,0xE5,0xCE,0x6D,0x67,0x9D,0x07,0x26,
+	0x6B,0xC2,0x05,0xCE,0x83,0x1B,0xD1,0xE3,0x44,0xE4,0xC4,
+	0xB8,0x5C,0x8D,0x6B,0x9A,0x73,0x9B,0xE2,0x74,0x77,0x68,
+	0x5C,0x06,0xE7,0xEE,0x3A,0x01,0xB1,0x31,0x68,0x20,0xE5,
+	0x09,0x5B,0x25,0xB7,0x57,0xE3,0x1C,0x74,0xD2,0xA5,0xDD,
+	0xCB,0x39,0xB7,0xD1,0x72,0x9C,0xB7,0xCB,0xA9,0x93,0x91,
+	0x49,0x9A,0x5D,0x77,0x52,0xEC,0xEE,0xC2,0xC0,0xED,0x35,
+	0xCE,0xDB,0xB7,0x8D,0xB6,0x3D,0x07,0xE4,0xDC,0x6D,0xC3,
+	0x00,0x92,0x7A,0x37,0x3C,0x96,0xAA,0xC8,0x1D,0xFC,0xD9,
+	0x30,0x34,0xA5,0x10,0xA4,0x0B,0x6D,0x93,0xEA,0x6F,0xF7,
+	0x3E,0x10,0xE9,0xAE,0xB4,0x5C,0xF9,0x93,0x6F,0x43,0x44,
+	0xEE,0x74,0x6E,0xAB,0x71,0x6E,0x3B,0xE3,0xDC,0x7E,0xD6,
+	0xB9,0xBD,0xDA,0xA5,0xCB,0xBF,0xF2,0xF2,0x1D,0xFE,0x57,
+	0x5F,0x5D,0xFD,0xC0,0xB2,0x45,0xCE,0xDB,0xB7,0x8F,0x46,
+	0x18,0x7F,0xC7,0x3D,0x68,0xD9,0x90,0x6A,0x81,0x7F,0x79,
+	0x6B,0x7F,0x3C,0xFD,0x3B,0xD0,0x73,0xB6,0xF0,0x79,0xE2,
+	0x2D,0xEE,0x13,0x5C,0x78,0x78,0xDE,0x93,0xCE,0xB5,0x79,
+	0xA2,0xE0,0x2D,0xE4,0x4D,0x96,0xDC,0xB5,0xA2,0x61,0xEB,
+	0x87,0x11,0x6C,0xB5,0xDF,0xD5,0xBC,0x26,0x76,0xA2,0x3F,
+	0xFF,0xE0,0x6B,0x85,0x85,0xF0,0x7C,0x59,0xEC,0x1C,0xBB,
+	0x5A,0x3E,0x27,0xBF,0xE9,0xFE,0x90,0xDB,0x35,0x19,0xA0,
+	0x5A,0xC6,0xDB,0x91,0xF7,0x79,0x66,0x5A,0x03,0xDD,0x40,
+	0xF3,0x01,0xC4,0xF1,0x0D,0x0D,0xF4,0xC1,0x49,0x6F,0x49,
+	0x79,0x48,0x1B,0x27,0xA6,0x6E,0xBD,0x8E,0x2C,0x5C,0xAF,
+	0x3F,0x80,0x0F,0xEF,0xC9,0x40,0x8B,0x76,0x92,0xFF,0xCA,
+	0xFF,0xF6,0x1E,0xC5,0x9B,0xBF,0x5E,0xAD,0xA2,0x54,0xF9,
+	0x05,0x6B,0xDB,0x6E,0x1E,0xC1,0xDC,0x6D,0x84,0xDF,0x2A,
+	0x2A,0xE9,0x92,0xD1,0xAE,0xE7,0x13,0xE5,0xFF,0x40,0x17,
+	0x0B,0xDB,0x16,0x15,0x1D,0x6C,0xFD,0x25,0x32,0x95,0xCB,
+	0x3B,0x31,0xCE,0x29,0x37,0x96,0xC8,0x9F,0x77,0xBF,0x96,
+	0xAB,0x11,0xBB,0xE4,0x7F,0x4C,0x3A,0x3A,0x67,0xAF,0xFD,
+	0xC4,0xB8,0x83,0x6D,0x10,0x4F,0x6F,0xAC,0xC3,0xAF,0xE5,
+	0x45,0xE8,0xB7,0x5A,0x73,0x50,0x40,0x48,0x02,0x40,0x5A,
+	0xBE,0x77,0xFE,0x89,0x71,0xB2,0xDF,0x79,0xE7,0x76,0xCA,
+	0xE2,0xBE,0x4E,0x85,0x60,0x52,0xFF,0xD2,0x53,0xD0,0xDD,
+	0xAD,0x1D,0x9E,0x23,0xD2,0x71,0xFE,0xC0,0xF4,0x14,0xAC,
+	0x17,0x0C,0x71,0xE7,0xCD,0x42,0x31,0xE0,0x9A,0x45,0x2F,
+	0x81,0x55,0xFE,0xAA,0xA5,0xC3,0x41,0x01,0xA9,0xD9,0x69,
+	0x49,0xA7,0x37,0x86,0x11,0x1D,0x59,0x61,0x54,0xEF,0x14,
+	0x93,0xF3,0x8D,0x41,0x7B,0x3A,0x3E,0xDC,0x81,0x51,0xB5,
+	0x76,0x6A,0x72,0x4D,0x46,0x63,0x42,0xF7,0x53,0x26,0x8D,
+	0xF8,0xBA,0xAD,0x9E,0xA4,0x5A,0xD3,0x99,0xF7,0x12,0x06,
+	0xEF,0xFB,0x5A,0x75,0x47,0xBF,0x92,0x5A,0x98,0x56,0x3D,
+	0x89,0x66,0x0D,0xFF,0x00,0xB4,0xC3,0xBF,0xEF,0x83,0xDF,
+	0xD2,0x27,0xFC,0xA3,0x0E,0x23,0x5E,0x5C,0x90,0x16,0x8D,
+	0x8E,0xFC,0x5C,0xB7,0xCA,0x19,0xB2,0x9D,0xA7,0x59,0xDB,
+	0xED,0xA9,0x76,0xD1,0x00,0xBF,0x46,0xD7,0x50,0x05,0xEB,
+	0x27,0x9F,0x34,0x56,0x9C,0x15,0xDF,0x27,0x75,0xD4,0x10,
+	0x3B,0xBB,0xAD,0xF4,0xD3,0xBC,0x83,0x90,0xBD,0xEC,0x82,
+	0xED,0x54,0xF8,0xFD,0x3E,0xFD,0x9D,0x1D,0x1B,0xF8,0x0F,
+	0x35,0x74,0x91,0xC6,0xE6,0x57,0x08,0x0A,0x39,0x97,0x59,
+	0xF5,0x7B,0x44,0x02,0x24,0x24,0x0F,0x56,0x9E,0x83,0xEF,
+	0x48,0xBE,0x79,0x45,0x3F,0x79,0x01,0x03,0x0A,0x09,0xCA,
+	0x76,0xA3,0x3C,0xDB,0xE4,0xBE,0xCE,0xB9,0x84,0x8A,0x7A,
+	0xA1,0x02,0xEF,0x43,0x01,0x26,0x50,0xB3,0xA4,0xB5,0x26,
+	0xB9,0xD0,0x28,0x39,0x4D,0x6F,0xB9,0x3F,0xCC,0x72,0x6F,
+	0x34,0xC2,0x00,0x4C,0xDA,0x14,0x03,0xB4,0x14,0xAF,0x33,
+	0xD5,0x16,0x69,0x3F,0xC2,0xBB,0x86,0x78,0xCE,0x4B,0xE7,
+	0x3B,0x3D,0x27,0xA4,0x13,0x1C,0xDE,0x7C,0xA6,0xF1,0xAC,
+	0x4D,0x3D,0xB0,0xE6,0x79,0xE0,0x4E,0x9B,0xB2,0x85,0x0E,
+	0x7A,0x30,0x2C,0xA4,0x7B,0x0B,0x53,0xAD,0x9D,0xB4,0x8A,
+	0x3C,0xCE,0x54,0x88,0xE1,0x01,0xEF,0xF6,0x42,0x93,0xC5,
+	0x15,0xBD,0x23,0x25,0x79,0xAD,0x09,0xC4,0xD9,0x0A,0x18,
+	0xFF,0xE8,0x23,0x9E,0x7F,0x24,0x88,0xC6,0x17,0xAF,0x20,
+	0x36,0xA9,0xCB,0xF1,0xB6,0xC9,0x7A,0x97,0x3D,0x3B,0xB0,
+	0xC1,0x24,0x73,0x5C,0x5D,0x76,0x9B,0xF0,0x73,0xBC,0xB6,
+	0x85,0x1C,0x95,0xE7,0xF0,0x10,0x61,0xCE,0xFE,0xAC,0x37,
+	0x02,0xEF,0x86,0x92,0xE7,0x1A,0xFB,0x06,0xAF,0xA1,0x90,
+	0x42,0x02,0x85,0x34,0x0D,0x62,0x8C,0x2C,0x66,0xC3,0xDC,
+	0x28,0x14,0x53,0x5C,0xE0,0xDD,0x0C,0x42,0x7C,0xD0,0xAD,
+	0x72,0xEA,0x71,0x96,0x7B,0x68,0x5C,0xA8,0x49,0x9E,0x03,
+	0x09,0xC5,0x4F,0x68,0xAD,0x55,0x61,0x82,0x6D,0x67,0x54,
+	0x67,0x61,0xC7,0x80,0xE2,0x5F,0x8D,0x45,0x5B,0x4C,0xC4,
+	0x3F,0x87,0x96,0x5D,0xF6,0xAE,0x9C,0x9F,0x9E,0xA3,0x6F,
+	0x80,0xD7,0xF5,0xC7,0x77,0xE3,0x63,0x20,0xA7,0x59,0xD4,
+	0xB0,0x87,0x5E,0x1B,0x53,0x8C,0x07,0x57,0x6B,0xA1,0xE9,
+	0xCC,0x73,0x77,0x34,0x6C,0x28,0xF4,0x3D,0x36,0xC8,0xFD,
+	0x61,0x87,0xFB,0x0B,0x73,0xE9,0xFC,0x20,0x6F,0x85,0x61,
+	0x2C,0x67,0x0A,0x05,0xB5,0x38,0x46,0x59,0x0E,0x20,0x53,
+	0x8C,0xEE,0x0F,0x84,0x72,0xB4,0x53,0x24,0x1D,0xCA,0x03,
+	0xCC,0xD6,0x93,0x3A,0x91,0xC4,0x4C,0xE1,0x63,0x38,0xF6,
+	0xF1,0xAB,0xE8,0xAD,0x33,0xCC,0xEC,0xFF,0xEF,0xD8,0x6E,
+	0xC2,0x7F,0x24,0xA9,0x08,0x8C,0x91,0x19,0xDE,0x8F,0xAD,
+	0x3F,0xEE,0xFB,0x0F,0xF2,0x4F,0xD2,0x09,0x2D,0x25,0xBB,
+	0xA7,0x34,0xB3,0x2F,0xA5,0x1D,0x4A,0xC7,0x68,0x5A,0xEB,
+	0x7E,0x31,0x2B,0xE7,0x6E,0xCC,0x06,0x1C,0x9A,0x63,0x6C,
+	0x59,0x8B,0xD5,0x4C,0xBF,0x41,0x33,0xE9,0x50,0x6A,0xAC,
+	0x0C,0x97,0x47,0xD1,0x76,0x83,0xB7,0x72,0x2D,0xB9,0xB4,
+	0x19,0xF4,0x41,0x07,0xE8,0x5F,0x4A,0x4E,0xCA,0x66,0x79,
+	0xB9,0x39,0xA7,0x84,0x2F,0x33,0xCB,0xA3,0x7C,0x65,0x1C,
+	0xF9,0xB6,0x67,0x50,0xC4,0x6E,0xC6,0xFB,0x13,0x6B,0x0B,
+	0x8C,0xD8,0x7C,0xF0,0x95,0x35,0x6C,0x6A,0xD5,0x13,0x24,
+	0x21,0x72,0x86,0x1C,0x9B,0x0D,0x43,0x32,0x6F,0xF3,0x1F,
+	0xB0,0xFC,0x06,0xF0,0xC1,0xD1,0xB9,0x89,0x4C,0xB3,0x2A,
+	0x97,0xD0,0x0D,0x14,0x6F,0xD0,0xB8,0x8F,0x98,0x56,0xB3,
+	0x3B,0x71,0x5A,0x79,0x1F,0x8C,0xC2,0xE4,0x3C,0x1D,0xAF,
+	0x51,0xAB,0xE2,0xAD,0xF2,0x2C,0x6B,0xBA,0x52,0x89,0x0A,
+	0xC4,0x11,0xBE,0x24,0x06,0x1C,0xFA,0x17,0xB3,0x02,0xAB,
+	0x25,0xEF,0x60,0x01,0x90,0x30,0x11,0xBC,0xCB,0xCA,0x2B,
+	0x5E,0xB4,0xA2,0xA9,0x86,0x5E,0x2B,0x80,0x3E,0x03,0xFD,
+	0xE5,0x16,0x24,0xCA,0x04,0x23,0x75,0x90,0x4F,0xD2,0xB0,
+	0x20,0x63,0x34,0x88,0x0E,0xF2,0xEC,0x95,0x95,0xF0,0xA5,
+	0xF8,0x48,0xBD,0xF8,0xC4,0xDA,0x87,0x94,0xD7,0x88,0xA2,
+	0x92,0xDE,0x1D,0xCA,0xAA,0x60,0x51,0xD1,0xF1,0xB0,0x61,
+	0xD9,0xD2,0x39,0xB3,0x1C,0x0F,0x50,0x55,0xD9,0x7D,0xC4,
+	0x18,0xD7,0xA8,0xE4,0x23,0x93,0xF4,0x28,0xF7,0x31,0xC8,
+	0xB9,0x6D,0xD8,0x39,0xC8,0x5C,0xF3,0x73,0x60,0x93,0x82,
+	0xB2,0x12,0x4A,0xE1,0xAB,0x79,0x0D,0xFC,0xCF,0x39,0x52,
+	0x96,0x3A,0xE9,0xC8,0xB5,0xC6,0x1C,0x9A,0x78,0x3D,0x07,
+	0xE3,0x54,0xC8,0x99,0xA3,0xC7,0xE4,0x2E,0xAE,0xA6,0xEA,
+	0x7D,0x78,0x52,0xD9,0xA5,0x9C,0x4B,0xE9,0xD3,0x5E,0x55,
+	0xF4,0x33,0xC8,0x45,0x40,0x3D,0x9D,0xA1,0x6E,0x56,0x1C,
+	0x56,0x44,0x84,0x2F,0xE9,0xD7,0xBE,0x17,0x92,0x93,0x07,
+	0xA9,0x93,0xC6,0x99,0xB8,0x7A,0x85,0x6F,0x55,0x2F,0xA0,
+	0x24,0x9D,0x16,0xFD,0x24,0x75,0xCA,0x04,0x78,0x5F,0x51,
+	0xB3,0x35,0xAF,0x0D,0x4A,0xCD,0xFD,0x2D,0x60,0x60,0x88,
+	0x0C,0xC3,0xF7,0x45,0x07,0x71,0xBC,0xA9,0x7A,0x09,0xD3,
+	0x2F,0x49,0xA1,0xEA,0xBD,0x66,0x50,0xBD,0x6B,0xF2,0x74,
+	0xF3,0x1E,0x9D,0x2B,0xD9,0x63,0xB6,0x07,0x8E,0x1A,0xE7,
+	0x88,0x57,0x16,0xC2,0xC8,0xA5,0xDC,0x02,0x29,0x57,0xB8,
+	0xCF,0xEB,0x5C,0x69,0x1E,0xF3,0x1C,0x88,0x5C,0xC7,0xCD,
+	0x71,0xE9,0x3C,0x45,0xDA,0x9A,0x1D,0xF4,0x1F,0x64,0xFB,
+	0xC1,0x9E,0xB1,0x2E,0x23,0x31,0xFB,0xEC,0x3C,0x4C,0x41,
+	0x30,0x8F,0x6B,0xC6,0x1C,0xD7,0x44,0x62,0x26,0x45,0xFC,
+	0x1C,0x52,0x64,0x24,0x45,0x26,0x57,0xC6,0xF4,0x22,0x0B,
+	0x29,0x82,0x90,0x74,0x08,0xC9,0x20,0x45,0x99,0x3E,0xBB,
+	0x45,0xFC,0xA7,0xCF,0xDE,0xE6,0xB3,0x9B,0x69,0x42,0x96,
+	0x0E,0xBE,0x68,0x51,0xC3,0x18,0x34,0x57,0xAA,0xFA,0xD4,
+	0xD3,0x67,0x4D,0xFF,0xFE,0x5D,0x4C,0x02,0xB6,0x4F,0x60,
+	0x00,0x30,0x8B,0x0F,0x82,0x24,0x46,0x29,0xEB,0x9A,0x22,
+	0x3D,0x64,0xFA,0xB4,0x3D,0x3F,0xD5,0x22,0xDE,0x26,0xE7,
+	0xA3,0xCD,0xEB,0x60,0x52,0x4D,0xED,0x42,0xAE,0x9D,0x91,
+	0xF3,0xCD,0xCA,0xB0,0xDB,0xF0,0x18,0x53,0x44,0x34,0x90,
+	0x37,0xA5,0x39,0x26,0x0B,0x8C,0x5B,0x90,0xB1,0x36,0x9F,
+	0xDA,0x07,0x12,0xAE,0xE2,0x13,0x31,0x15,0x82,0xDA,0xED,
+	0x66,0x8E,0x5D,0x4E,0x4C,0x14,0xF5,0x54,0x8F,0xB4,0x26,
+	0xF5,0xD3,0x76,0xBB,0x49,0xEB,0x3A,0x21,0x6F,0x34,0xCA,
+	0x0F,0x1A,0x2B,0xCE,0xBA,0x6A,0xE4,0x75,0x3C,0xF9,0xA0,
+	0xA2,0xDD,0x75,0x10,0xB2,0xED,0x23,0x57,0x48,0x27,0x16,
+	0xC0,0xE3,0xF1,0x82,0x6A,0x2C,0x22,0x8D,0x15,0xC1,0xBD,
+	0x3B,0xF1,0x1D,0xF1,0x9F,0xE1,0xE7,0xA1,0x5B,0x5F,0xAD,
+	0xC2,0xF1,0xF1,0xEF,0xD4,0xB6,0x78,0x13,0x5E,0x6C,0x10,
+	0x8D,0x3E,0xDC,0x52,0x86,0x0E,0x08,0x21,0xBB,0x43,0xC5,
+	0xEF,0x67,0xE4,0xCD,0x58,0xD9,0x51,0x7A,0xF1,0x24,0x99,
+	0x3A,0x0E,0x9E,0x72,0x8D,0x92,0x0B,0xF8,0x8A,0xE5,0x26,
+	0x97,0x29,0x1F,0xE9,0x77,0xE9,0x95,0x30,0xAA,0xDB,0x43,
+	0x60,0x4A,0xF3,0x11,0xA9,0x8B,0xEB,0x79,0xB1,0xF1,0x8E,
+	0x5E,0xEB,0x74,0xA0,0xB7,0xFD,0xA8,0x1D,0xBE,0x89,0x9C,
+	0x57,0x9A,0x6E,0xA5,0x83,0x4E,0x32,0x96,0x0D,0x9D,0x9B,
+	0x0E,0x22,0x8B,0xC8,0x19,0xEF,0x68,0x54,0x68,0xA4,0x2E,
+	0x6D,0xE9,0x50,0xA9,0xCB,0xB8,0x21,0x6D,0xCC,0xF6,0xF7,
+	0xBC,0x75,0x95,0xFC,0xDE,0xF1,0x27,0xC6,0x8D,0x2D,0xA9,
+	0x81,0x2F,0xF5,0x4D,0xC5,0xCF,0x3B,0x8C,0x26,0xEF,0xD4,
+	0x96,0x66,0x48,0x9D,0xC6,0x0D,0x43,0x3D,0x81,0x2A,0x2D,
+	0x4C,0xC5,0x0C,0xA0,0xBE,0x6C,0xAB,0x4E,0x22,0x8D,0x80,
+	0x13,0x9D,0xAD,0x65,0xD5,0x4B,0xC7,0xEF,0x8E,0x0F,0xFD,
+	0xC6,0x7C,0x19,0x2A,0x0F,0xB8,0xE3,0xEF,0x13,0x6D,0xF9,
+	0x1D,0xD4,0x43,0x51,0x79,0xF4,0x1A,0x3B,0x3E,0x76,0x2E,
+	0xCE,0x99,0xF7,0x45,0xA4,0xD4,0xBC,0x7E,0x02,0xDE,0x4A,
+	0xE3,0x1A,0xEE,0xCC,0xEB,0x81,0xDF,0xF0,0x64,0x67,0x5E,
+	0x77,0xC4,0x35,0x0A,0x2F,0x31,0x72,0x8D,0x0A,0x8F,0xA9,
+	0xC2,0x7B,0x1E,0x6A,0xAA,0x82,0xF4,0xF7,0x3C,0xFD,0xED,
+	0xA0,0xBF,0x29,0x46,0xFC,0xBD,0x15,0x7F,0x17,0x39,0xDD,
+	0x79,0x57,0xA9,0x94,0xC9,0x38,0x88,0x4F,0xE6,0xC2,0xF3,
+	0xBF,0x7E,0x1A,0x89,0xEC,0xEE,0x10,0xD8,0x6D,0x26,0xCC,
+	0xFD,0x61,0xE2,0x3D,0x4D,0xF4,0x8C,0x25,0x26,0x08,0x5C,
+	0xE2,0x65,0x87,0xE2,0x24,0x45,0x93,0x9D,0x3B,0xF1,0x3B,
+	0xAB,0xD9,0x2A,0xA8,0xFE,0xC4,0x13,0x1C,0x88,0xEF,0xD8,
+	0xF2,0x55,0x0E,0xC4,0xF1,0xAC,0x1F,0xA9,0x81,0x01,0x81,
+	0xC2,0x85,0x46,0x32,0xE2,0x31,0x90,0xA7,0xAA,0x9B,0xD7,
+	0x9F,0x3C,0x8E,0xE2,0xD1,0xA8,0x9C,0xEE,0x8A,0x44,0x6A,
+	0xB5,0x47,0x8E,0x2C,0xD7,0x0A,0xFB,0x6B,0x82,0x05,0xFC,
+	0x31,0x92,0x9F,0x09,0x52,0xE4,0x61,0x80,0x15,0x3B,0xD7,
+	0xD6,0xDF,0x77,0x70,0xE8,0x05,0xE6,0x57,0x97,0x62,0x58,
+	0xAB,0x81,0xEC,0x5C,0xD0,0xCE,0x1F,0x13,0xF6,0x57,0x53,
+	0x37,0xBD,0xAF,0x2B,0xB7,0x46,0xE2,0x6E,0xC2,0x89,0xF9,
+	0xE8,0x2C,0xA2,0x96,0xD1,0xCD,0x0A,0x9E,0x5A,0x41,0xF3,
+	0x4E,0x7A,0xB5,0x4F,0xCB,0x0F,0xB8,0xD8,0xCD,0x50,0x2F,
+	0x1F,0xD6,0xBE,0x18,0x07,0xD9,0xB7,0x03,0xEF,0x6E,0x24,
+	0xC5,0x4D,0xBE,0x22,0x2E,0xA8,0x39,0x12,0xD4,0x1E,0x29,
+	0x08,0x6A,0x97,0xC3,0x9F,0x06,0xFE,0x8E,0x15,0x90,0x90,
+	0x73,0x92,0x1E,0xD3,0xC9,0x9B,0x1B,0x89,0xA3,0xB5,0xF7,
+	0x58,0x98,0xB0,0x3F,0xE0,0x9B,0xAF,0xE5,0x72,0x16,0x34,
+	0x95,0x59,0x64,0xB1,0xD1,0x4E,0xDE,0x05,0xC5,0xCE,0x71,
+	0x6E,0x59,0xE2,0x7D,0xBC,0x0F,0xEA,0x8A,0xCF,0x85,0x79,
+	0x04,0x86,0xA6,0xEF,0xAE,0x79,0x71,0xE0,0xF0,0x66,0xD8,
+	0x1B,0x81,0x6B,0xFE,0x32,0x70,0x83,0x10,0x5C,0x58,0x4F,
+	0xDD,0x99,0xC6,0xE0,0x91,0x0F,0x88,0xA3,0x2D,0x1E,0x5C,
+	0xBD,0x6F,0x56,0x0A,0x97,0xE3,0x68,0x2A,0x1B,0x91,0x4F,
+	0xDE,0x27,0xEF,0xF6,0x05,0x14,0xD6,0x01,0x14,0xCA,0x80,
+	0x80,0xC2,0x3B,0x89,0xA3,0x4E,0x76,0x34,0xE3,0xB5,0x96,
+	0xC2,0x7E,0x07,0x7A,0x71,0x0B,0xA2,0xE3,0x5E,0xE2,0xD8,
+	0x83,0x4E,0x7C,0x89,0xE3,0x65,0x78,0xB4,0x11,0xC7,0x5E,
+	0x9F,0xE3,0xE5,0x5A,0xC7,0xEB,0xDF,0x86,0x7F,0x74,0x7E,
+	0xDA,0xEE,0x38,0xC2,0xB9,0x52,0x65,0x87,0xFF,0x5A,0x63,
+	0xF4,0x30,0x0C,0xBD,0xCD,0x87,0xBD,0xC6,0xE4,0x29,0x15,
+	0xA7,0xE4,0xB4,0x5C,0xC0,0x04,0xE9,0x22,0xEF,0x4C,0xD0,
+	0x53,0xF7,0xF0,0xE2,0x22,0x72,0xC2,0xD6,0x6E,0xF3,0x7B,
+	0x39,0xBC,0x66,0x99,0x9C,0xC9,0x57,0xB6,0xEA,0x99,0x8C,
+	0x0A,0x83,0x7E,0x09,0x7D,0xC1,0x5B,0x96,0x2A,0x7D,0x74,
+	0xDD,0xD3,0x66,0xE2,0x3D,0x33,0x53,0x2B,0xDA,0xC5,0x64,
+	0xD2,0xA8,0xAC,0xEE,0x04,0x9D,0x24,0x08,0x1F,0x3C,0xF9,
+	0xC7,0xC4,0xCB,0xA4,0x6D,0x15,0xBD,0xB4,0x99,0x84,0x14,
+	0x3D,0x5E,0x88,0xF1,0x0A,0x1E,0xC9,0xBF,0xEE,0xB9,0x20,
+	0x1D,0xD5,0x32,0xC5,0x77,0x71,0x6A,0xF8,0xB7,0x7D,0xFA,
+	0xAA,0xBB,0x23,0x7F,0x93,0xD1,0xDD,0x51,0xF2,0x8C,0xCE,
+	0xED,0xB7,0xD4,0xE0,0xAC,0x04,0xD7,0xA5,0x60,0x08,0x63,
+	0x77,0xCF,0xED,0x1D,0xA4,0x2E,0x4D,0xD5,0x40,0xDC,0x89,
+	0xC1,0x35,0x8B,0xBC,0x4D,0xDE,0xAB,0x27,0x86,0x8B,0x29,
+	0xD2,0x47,0x82,0xD4,0xC3,0x89,0x30,0xE5,0x2A,0xA9,0x39,
+	0x31,0xA4,0x66,0x31,0x84,0xD7,0x9C,0x18,0xE1,0x3D,0x42,
+	0x13,0x7F,0x4F,0xFD,0x4E,0xFF,0x5E,0xCD,0x22,0x52,0xAD,
+	0x4C,0x1F,0x03,0x15,0x62,0x2E,0xA9,0x51,0xEE,0x1A,0x83,
+	0x4D,0x17,0xC5,0x42,0x8D,0x72,0x1B,0x7D,0x4F,0xA3,0xEF,
+	0x23,0xE8,0x7B,0x32,0x0E,0x96,0x28,0x3E,0x69,0xA6,0xA1,
+	0x6A,0xA6,0x3E,0xF8,0x2E,0x82,0x86,0xBD,0x33,0xC3,0x8C,
+	0x73,0x3B,0x9D,0xB5,0x5B,0x1E,0x86,0xAF,0x93,0x9A,0x48,
+	0x13,0x17,0xDA,0x9D,0x89,0x57,0x92,0xB6,0x8E,0x46,0x7F,
+	0x29,0xEB,0xF0,0x32,0xD8,0x27,0xD3,0xD1,0x4F,0xF1,0x83,
+	0x20,0x7C,0x28,0x02,0xAD,0xAB,0x10,0x98,0xC1,0x3D,0x5D,
+	0x23,0x6A,0x93,0x6A,0xC6,0x24,0x45,0xCC,0x49,0xEA,0xD9,
+	0x5C,0x83,0x27,0x78,0xF8,0x32,0x4E,0x0F,0x43,0x38,0x53,
+	0xFC,0xCC,0xF3,0x79,0x76,0x70,0xFD,0x28,0x69,0xBA,0xD6,
+	0x35,0xC8,0xBB,0x91,0x9B,0xDE,0x59,0xCA,0x93,0x80,0xA7,
+	0xD3,0xED,0x37,0xE4,0x61,0xA2,0xD2,0x8F,0xB6,0x5E,0xC7,
+	0xA7,0x2B,0xD5,0x97,0xAF,0x55,0xFE,0x88,0xDA,0x21,0xA7,
+	0x0D,0x1F,0x49,0x52,0x7D,0x29,0x43,0xFD,0x1A,0x3C,0x35,
+	0x9E,0x77,0x0E,0xE3,0x64,0xB5,0xEA,0x32,0x03,0x78,0x26,
+	0x11,0xE0,0x86,0x18,0x40,0x4C,0x84,0x00,0xF1,0xE9,0x4A,
+	0x9F,0xF1,0x13,0xAE,0x4C,0x8F,0xD0,0x6A,0x11,0xF4,0x22,
+	0x1C,0x48,0x3E,0x4B,0x5A,0x9D,0x28,0xB9,0x01,0xDF,0xC7,
+	0xE6,0x03,0x61,0x07,0x66,0xE3,0x75,0xB9,0xA3,0x71,0x6E,
+	0x2B,0x0F,0xC3,0xB9,0xED,0x4E,0x17,0x92,0x3B,0x05,0x92,
+	0xEC,0x5E,0x89,0xD4,0x63,0xFC,0xEE,0x22,0xFC,0x41,0x3E,
+	0xEC,0xC4,0x3C,0xBB,0x97,0xE0,0xCF,0x3A,0x75,0x9A,0xA8,
+	0xEA,0xA3,0xB8,0x5E,0x67,0x86,0x51,0x70,0x09,0x28,0x88,
+	0xEF,0xE3,0x6A,0x1D,0x39,0x4F,0x3E,0xB7,0x9D,0x55,0xD0,
+	0x25,0xA2,0x9C,0x6E,0x9D,0xF8,0xB9,0xDD,0x37,0x97,0x0B,
+	0x34,0xA1,0x6B,0x00,0xB7,0x9F,0x97,0x2E,0x74,0x73,0x21,
+	0x60,0xBD,0x2D,0x62,0xED,0x26,0xA7,0x95,0x9E,0x2B,0xB8,
+	0x22,0x84,0xAB,0x7D,0x36,0x3F,0x48,0xBB,0x91,0xA0,0x52,
+	0xF1,0x44,0x2B,0xA3,0x76,0x38,0x1D,0x7E,0x4D,0xEE,0x23,
+	0x66,0x68,0x92,0xA0,0xAF,0x91,0x77,0x0D,0xDB,0x1A,0xB7,
+	0xFB,0xFB,0x76,0xBB,0x24,0x48,0x64,0xF4,0xE5,0x8E,0x22,
+	0xE7,0x7D,0x0F,0xF2,0x24,0x89,0x28,0x0A,0x0A,0x25,0x3B,
+	0xA9,0xAE,0xE5,0x7F,0x8D,0xD8,0x85,0xFF,0x44,0xF1,0x33,
+	0xC2,0x00,0x0A,0x98,0xD9,0x22,0x5E,0x6D,0xAE,0x05,0xEF,
+	0xB7,0xBC,0x96,0x9B,0xEC,0xBA,0x8E,0x4E,0xD8,0xF6,0x6A,
+	0xE8,0xB5,0xBD,0x33,0x6E,0x75,0x8D,0x20,0xE9,0x56,0x72,
+	0x12,0xDE,0xC4,0x1C,0xE8,0x0F,0x43,0x0A,0xCA,0xFD,0x62,
+	0x72,0xA5,0x36,0x7C,0xB9,0x92,0x2B,0x08,0x37,0x67,0xF9,
+	0xC3,0x1F,0xE6,0x72,0xE2,0xB8,0x8A,0xB3,0x42,0x39,0x9D,
+	0x8D,0x75,0xC8,0x93,0xAD,0x64,0xB2,0xDB,0xAB,0xBD,0x0F,
+	0xA1,0x3C,0x89,0xB7,0xC1,0x05,0x39,0x98,0x1A,0x7B,0x6F,
+	0x95,0xBA,0x2D,0xE2,0xED,0xE5,0x7E,0x57,0x83,0xF7,0xD6,
+	0xF2,0x66,0xD7,0x3F,0xA4,0xEE,0x95,0xA2,0x19,0x00,0x8E,
+	0x92,0x9E,0xE6,0x6E,0x15,0x0D,0x05,0x33,0x1E,0xEE,0x71,
+	0xFD,0x16,0x66,0xBF,0x59,0x05,0xE1,0x7F,0x93,0xBA,0x93,
+	0x5D,0x6F,0x87,0xDF,0xF5,0x3E,0xCC,0x49,0xDD,0xB7,0x8A,
+	0x83,0x0A,0x20,0x78,0x64,0x41,0xCB,0x53,0xB8,0xDE,0x07,
+	0xB9,0xCE,0xE4,0x72,0xAE,0x56,0x08,0x32,0x14,0xB4,0x38,
+	0x21,0x28,0xDF,0x7B,0xAB,0xE7,0xA1,0x48,0x41,0x4B,0x09,
+	0xBC,0x7B,0x38,0xD4,0x64,0x41,0x23,0xEB,0x80,0xF1,0x00,
+	0x17,0xC9,0xEE,0xC3,0x33,0xC5,0xE1,0x82,0x96,0x4C,0x94,
+	0xE1,0x71,0x0A,0x85,0xEC,0xDF,0x89,0x95,0x89,0x47,0xB9,
+	0xFE,0xED,0x33,0xE8,0x18,0x20,0xBA,0xE7,0x7D,0x1A,0x4B,
+	0xB2,0x48,0x23,0x9F,0x5D,0x8C,0x13,0xE8,0xD3,0xDB,0xCE,
+	0x28,0xFF,0x76,0x95,0x5E,0x1E,0xAB,0xC3,0xFE,0x7F,0x06,
+	0x86,0x93,0xDB,0x3E,0xA5,0xC3,0x09,0xCA,0x1B,0x48,0xF1,
+	0xAE,0x7B,0xA3,0x49,0xE3,0x5A,0x69,0x6B,0xA7,0x5A,0xDC,
+	0xF7,0xE4,0x85,0x3C,0xE8,0x36,0x42,0x9C,0xC2,0xF6,0xC8,
+	0x48,0x28,0x26,0xE2,0x4A,0xC1,0xF7,0xE5,0xA0,0x8C,0x26,
+	0x07,0xDB,0xF3,0x4D,0x46,0xD7,0x30,0xA6,0xB9,0x29,0xC3,
+	0x3E,0x43,0xBD,0xC9,0x58,0x6B,0xA7,0xAB,0x11,0xA0,0xF7,
+	0x19,0x41,0x17,0xAD,0x8B,0x0C,0x5B,0x83,0x4B,0x15,0xD4,
+	0x63,0x79,0xCD,0x61,0xAA,0xF9,0x7C,0xAE,0x1C,0xFD,0x6F,
+	0x94,0x49,0xE1,0x17,0xD4,0xF5,0x3B,0x12,0x50,0xA8,0x23,
+	0xC3,0x6A,0xC0,0xE9,0x5E,0x7A,0xC1,0xF1,0x8A,0x9A,0x38,
+	0xFC,0xD1,0x2D,0x16,0x5D,0x75,0x00,0xDC,0x07,0xE5,0xCC,
+	0xE6,0x5D,0x69,0x78,0x89,0xAE,0xF8,0xDF,0x54,0x10,0xA0,
+	0x03,0x63,0x7A,0xC4,0xA9,0x4E,0xD9,0xCB,0x3E,0xA9,0x7E,
+	0x16,0x38,0x88,0x19,0xE8,0x31,0xE5,0xF1,0xF2,0x72,0x3E,
+	0xFB,0x3D,0x17,0x4F,0xAA,0xC3,0x9F,0x7A,0xBF,0x67,0x92,
+	0x8E,0xE9,0x3C,0x2B,0x4C,0xB2,0x91,0xA4,0xC8,0xC3,0x70,
+	0x39,0x64,0x37,0xFE,0x80,0x14,0x89,0x35,0xF7,0x1D,0x8B,
+	0xDC,0x79,0x18,0xA6,0x71,0x0D,0xDF,0x89,0x4F,0xD9,0xAC,
+	0xCC,0xC0,0xD5,0x38,0x9A,0x1A,0x5A,0xF0,0xA5,0xBE,0x02,
+	0x67,0xF1,0x42,0x90,0xD6,0x20,0xAB,0xE5,0xE5,0x26,0x77,
+	0x17,0x2E,0x3F,0x9C,0x15,0x2A,0xB6,0xF4,0x2E,0x3F,0xB4,
+	0x17,0x98,0xB4,0x42,0xF9,0x7A,0xAC,0x2A,0x26,0xCF,0xC5,
+	0x24,0x90,0xBE,0xE8,0x26,0xEF,0x10,0x2A,0x21,0xEE,0xEB,
+	0x29,0xE2,0x94,0x43,0x78,0x89,0x22,0x24,0xB4,0x8B,0xB7,
+	0xCA,0x5A,0x69,0x6E,0xAA,0x39,0xA8,0x49,0x05,0xAD,0x32,
+	0xA2,0xB5,0x93,0x02,0x3E,0xA7,0x20,0x5D,0x1C,0x04,0x59,
+	0x9E,0xA3,0xD5,0x27,0xDE,0xCE,0x52,0x78,0x8C,0xF2,0xE3,
+	0x90,0xC0,0x41,0x1E,0xE7,0x2B,0x4A,0x4C,0xA2,0x3E,0xE7,
+	0xF1,0x74,0x71,0x12,0xA4,0x5A,0xCB,0x2A,0xD9,0x42,0xB9,
+	0xB3,0x0A,0xA7,0xF1,0xA8,0x51,0x2B,0xBF,0xEE,0x54,0x57,
+	0x67,0xA5,0xB9,0x26,0x0B,0x06,0xDB,0xFC,0x9E,0xBA,0x55,
+	0x54,0x70,0x20,0xBF,0xAA,0x95,0x77,0xA0,0x76,0xDD,0x4F,
+	0xA7,0x6B,0xC4,0x34,0x6F,0x41,0xEA,0x1E,0xAD,0x6B,0x51,
+	0x6D,0x41,0xFA,0xCF,0x28,0xD2,0xE9,0x94,0x7E,0x79,0xAE,
+	0x91,0x40,0x45,0xAB,0x24,0xCC,0xF5,0x3E,0x9D,0x2A,0x7D,
+	0xDC,0xE1,0xB9,0xEE,0x81,0x67,0x3D,0x0F,0xC1,0x9E,0xB9,
+	0xA9,0xBE,0xB9,0x19,0x64,0xB6,0x11,0xF2,0x71,0x8C,0x58,
+	0xD4,0xE7,0xD9,0x79,0x1F,0xA2,0xA5,0x0E,0x6B,0x79,0x57,
+	0x32,0xC4,0xDA,0xB1,0xD7,0xEE,0x81,0x17,0x5C,0x94,0x0B,
+	0xFF,0x1E,0x10,0x32,0x0E,0x90,0xB8,0x97,0xBF,0x4B,0x97,
+	0x19,0x8A,0xB7,0xB6,0x7A,0x30,0xE6,0x7D,0xF2,0x16,0x48,
+	0x92,0xD9,0x36,0x7F,0xB0,0xDC,0x5A,0x4E,0x7D,0x0A,0xC0,
+	0xE7,0x7C,0x9B,0xDF,0x59,0x3B,0xCB,0x7A,0x7F,0x1D,0x4E,
+	0x61,0x97,0x93,0xE7,0xAC,0x58,0x8D,0xD8,0x5B,0xA6,0xCA,
+	0xE5,0xF4,0x5D,0x7E,0x8D,0x3E,0xBC,0x13,0x1C,0xD2,0x17,
+	0xE3,0x5D,0x93,0x6D,0xA7,0x60,0x72,0x37,0xDB,0x73,0x89,
+	0xB0,0xE0,0xC8,0xBB,0x6A,0x32,0x3C,0x0D,0x78,0x02,0x7A,
+	0xDD,0xF2,0xAD,0x47,0xB0,0xB0,0x55,0x49,0x38,0xA5,0x5D,
+	0x69,0x9D,0x2D,0x1B,0x7C,0x4B,0xAC,0x1B,0x01,0xF6,0x46,
+	0x10,0x3E,0x63,0x71,0xCD,0xEC,0x4D,0x48,0xB5,0xD1,0x41,
+	0x0C,0x5E,0x47,0x44,0x05,0xE2,0x99,0x65,0x75,0x81,0x44,
+	0x08,0xE4,0xAE,0x15,0x2A,0xF0,0xD6,0x6D,0xEF,0x4A,0xEB,
+	0x82,0xF6,0x1A,0xDE,0x65,0x91,0x87,0xBB,0xAB,0x8D,0x64,
+	0xF8,0xF6,0x82,0x6E,0xF9,0xF1,0x0E,0xEF,0x7C,0xEB,0xFC,
+	0xF6,0x80,0xD9,0x65,0xF3,0x42,0x29,0xB7,0x7B,0x1C,0x9A,
+	0x70,0x79,0x7B,0x8D,0xD6,0x35,0x44,0x36,0x80,0xDC,0x04,
+	0x01,0x4B,0x05,0xA0,0xFC,0xA3,0xEE,0xF0,0x3B,0xF2,0x9D,
+	0xEE,0x37,0xF9,0x6D,0x8D,0xE4,0x4E,0xF6,0x1D,0x6C,0x0F,
+	0x58,0xA0,0xD9,0x43,0x2E,0xE7,0xED,0xC4,0xA1,0x69,0x99,
+	0x8B,0x57,0x75,0x05,0xEC,0xA0,0x4A,0x20,0x20,0x0C,0x99,
+	0x4E,0x43,0x24,0xD7,0xE5,0x68,0x48,0xA0,0x63,0x2C,0x3C,
+	0xF8,0x96,0xB1,0x28,0x2F,0xB6,0x51,0x6E,0xC5,0x88,0xD9,
+	0x04,0xC4,0x6C,0x22,0x4D,0xCA,0x05,0xBD,0x4A,0xCC,0xA6,
+	0xED,0xD5,0xC4,0x00,0xCF,0x95,0xBA,0x59,0xD6,0x35,0xF0,
+	0xF7,0x08,0xFC,0x3D,0x06,0x7F,0x4F,0xC2,0xDF,0xBA,0x89,
+	0xB3,0xAC,0x45,0xED,0xC0,0x66,0xA3,0x38,0x56,0xDA,0x64,
+	0x15,0x2D,0x62,0x86,0x7B,0x93,0xB5,0x48,0xB3,0x65,0xF0,
+	0x41,0x3C,0xDE,0x83,0xBC,0x8C,0xBC,0x1B,0x99,0x6F,0x2D,
+	0x0A,0x2B,0xE4,0x3C,0xC4,0xAC,0xD4,0x6C,0xC9,0x60,0x2C,
+	0xF6,0x0E,0x06,0xDE,0x2E,0xB1,0xAE,0x9C,0x9B,0x0F,0x43,
+	0xC7,0xCA,0x8A,0x53,0xCF,0x28,0x10,0xBD,0x06,0x33,0x66,
+	0xC5,0x67,0x5C,0x13,0x56,0xBC,0x4B,0xAC,0x2E,0xA9,0xB3,
+	0x4C,0x9C,0x8D,0xE5,0xD8,0xC5,0x51,0x90,0xEE,0x11,0xCD,
+	0x96,0x5B,0x19,0x98,0xDB,0xBD,0xC5,0x1A,0x07,0x4D,0xF9,
+	0x48,0xF8,0x23,0xA4,0x81,0x5C,0xDF,0x56,0x0D,0x55,0xB1,
+	0x97,0xA7,0xFB,0x2D,0x8F,0x69,0xB6,0x64,0x25,0x02,0x7C,
+	0x2C,0xAC,0x48,0x9D,0x8B,0x5D,0x0D,0x0C,0xCA,0xB9,0x01,
+	0xA0,0x40,0xCC,0x93,0x9A,0x2D,0x43,0xFB,0xC6,0x3C,0x49,
+	0x63,0xD6,0xF5,0xC3,0x70,0x5D,0x58,0xA1,0x0C,0x10,0xCA,
+	0x4F,0xE2,0x5D,0xF6,0x48,0xBD,0xB0,0x3D,0x08,0xAF,0x7D,
+	0x39,0xD0,0xEC,0x9B,0x65,0xC1,0xF5,0x48,0x5C,0x5B,0x09,
+	0xCE,0x9C,0x62,0x51,0xD6,0x41,0x57,0x50,0xD7,0x67,0xA5,
+	0xE9,0x77,0xB8,0xC6,0x7A,0xCD,0x52,0x67,0x56,0xE9,0x1D,
+	0x52,0x67,0xF6,0x86,0xF1,0x4F,0xCC,0x33,0xA6,0xD8,0x4E,
+	0x79,0xCD,0xEE,0x4B,0x59,0xDC,0x49,0x3B,0x99,0x67,0x0C,
+	0x9F,0xC7,0xD6,0xC2,0x93,0xE1,0xF2,0xA2,0x6E,0xB2,0xD8,
+	0x58,0x71,0x6A,0x53,0xB6,0xBD,0x76,0xA6,0x89,0xF6,0xDA,
+	0xE9,0x77,0x8A,0xF3,0xF0,0x23,0x0A,0x69,0x32,0x83,0xF4,
+	0x1D,0x84,0xF4,0xED,0x27,0xE6,0x99,0x12,0x20,0x99,0xC2,
+	0xE7,0xC9,0xBB,0xD2,0x3C,0xDE,0x78,0xED,0x03,0xF2,0x53,
+	0x63,0xF8,0x60,0x3C,0x58,0x13,0x80,0xB5,0xD9,0xBD,0x66,
+	0xDF,0x3A,0x4E,0xEA,0x7C,0xAC,0xEC,0x2E,0xA9,0x73,0xBE,
+	0xE0,0xC6,0x5B,0x58,0xA4,0xCE,0x39,0x42,0x85,0x17,0x5F,
+	0x36,0x72,0xF7,0x80,0xF6,0xB6,0x51,0x3B,0x4D,0x28,0xC7,
+	0x21,0x06,0xD7,0x32,0x55,0x34,0xC2,0x41,0xDF,0x6C,0xED,
+	0x86,0x74,0x48,0xF1,0x98,0x50,0xF1,0x24,0x15,0xBB,0x50,
+	0x8C,0x19,0x53,0x48,0x9D,0xAE,0xB2,0x74,0xA9,0xF3,0x49,
+	0xD1,0x3A,0xA3,0x88,0x13,0x87,0xD3,0x08,0x09,0x23,0xD6,
+	0xAF,0x94,0x3A,0x9F,0x76,0x2D,0x93,0x3A,0x37,0x88,0x7F,
+	0xB3,0x43,0xA0,0x9D,0xA5,0x7E,0x5C,0xFC,0x83,0xDD,0xB9,
+	0x15,0xD2,0x70,0x34,0xD1,0x15,0xA9,0x73,0x99,0x0B,0xF2,
+	0xDF,0x2F,0xEE,0x20,0x6D,0xD2,0x3C,0xBD,0x96,0xA5,0x2A,
+	0x14,0xB7,0x42,0x1E,0x3D,0x8F,0x5F,0x18,0xCE,0x5B,0xF0,
+	0x0D,0xB4,0x8B,0x28,0x74,0x0A,0x2D,0x71,0x3C,0x5C,0xBC,
+	0xD0,0x49,0x25,0x89,0x37,0x43,0xEA,0x9A,0xE2,0x32,0x49,
+	0x5D,0xB7,0x89,0xA9,0xD2,0x5C,0x9E,0xB3,0x87,0x3F,0x81,
+	0x87,0x31,0x7C,0x4D,0xEA,0x9A,0x24,0x0E,0xF6,0x3E,0xCE,
+	0x4B,0x27,0x78,0x4F,0x58,0xBA,0xF8,0x85,0xA7,0x84,0xB7,
+	0x87,0x4F,0x4A,0x5D,0x16,0x71,0xA8,0xF7,0x69,0xBE,0xBD,
+	0x96,0x17,0x1B,0x3C,0xD7,0xA5,0x7A,0xAD,0x67,0x2E,0x84,
+	0x1F,0x90,0xBA,0xB2,0x44,0x83,0xA7,0x64,0x8A,0x3D,0xFC,
+	0x27,0x36,0xF7,0x82,0xFA,0x35,0x90,0x93,0x30,0x7D,0xA8,
+	0x06,0x8D,0xE6,0xAC,0xCB,0xBC,0x3D,0x40,0xDE,0x29,0xB8,
+	0x5D,0xFA,0xAE,0xC6,0xA5,0xB7,0x67,0x77,0x88,0x9F,0x27,
+	0xC5,0xA1,0x44,0xC7,0xAF,0xA5,0x06,0x9C,0x4A,0xBE,0x0F,
+	0x7D,0x2C,0x60,0x3B,0xEB,0xEE,0x89,0x88,0x13,0x9D,0xB7,
+	0xE3,0x11,0xF0,0x91,0xB6,0x53,0xA4,0xC9,0x79,0xBB,0x3C,
+	0xD8,0x1D,0xD0,0x2A,0xFF,0x9E,0x4E,0x55,0x79,0x57,0x33,
+	0x57,0x13,0x6E,0x22,0x8D,0xEE,0x23,0x3C,0xE8,0x75,0x35,
+	0x10,0xCB,0xE1,0xFD,0xB4,0x99,0xD9,0x57,0x9E,0x81,0x5E,
+	0xE5,0x84,0x31,0xB2,0x09,0x53,0x3F,0xA6,0xA6,0xFE,0x00,
+	0x52,0x9F,0xCD,0xBE,0xB2,0xE5,0x1F,0xA4,0x4D,0xCD,0x21,
+	0xFB,0x17,0x52,0x85,0x88,0x27,0x6F,0x93,0x4C,0xEB,0x21,
+	0xD4,0xD4,0xC9,0xA7,0x4A,0x15,0xA4,0xA7,0xD2,0xA5,0x77,
+	0xC2,0x93,0x24,0xF3,0x56,0x72,0x74,0x76,0x45,0xBD,0x2B,
+	0x9D,0x5C,0xF6,0x99,0x26,0x70,0x97,0xE6,0x78,0x4B,0x22,
+	0x73,0x67,0x7B,0x56,0x70,0xD9,0x9F,0x8B,0x57,0x7C,0xE9,
+	0x13,0x2A,0xFC,0x9B,0x92,0x66,0x07,0xB5,0x59,0x73,0xC3,
+	0xFF,0xAD,0x9B,0x6C,0x65,0x0E,0x8E,0xF9,0x55,0x7D,0x19,
+	0xBE,0x03,0xD7,0x2F,0x40,0x5D,0x05,0xE1,0x9C,0x8E,0xFE,
+	0x69,0xB6,0xE1,0xD8,0xE7,0xDE,0x62,0x8A,0x88,0x49,0xB5,
+	0x85,0x26,0x94,0xE8,0x87,0x52,0xD8,0x11,0xD3,0xA3,0x4E,
+	0x10,0x31,0x5A,0x65,0x32,0x0E,0xB8,0xC7,0xD0,0x59,0x8C,
+	0x01,0x5D,0xC6,0x88,0x9D,0x90,0x58,0xE3,0x9A,0x12,0xE4,
+	0xEE,0xB4,0xF9,0xF3,0xF1,0x7D,0xCB,0x18,0xA4,0x74,0x89,
+	0x55,0xFB,0x44,0xBA,0x35,0x05,0x80,0x82,0x74,0xD0,0x4A,
+	0xD5,0x59,0x76,0xCF,0xE0,0xFC,0x9C,0x42,0xD3,0xA6,0x0B,
+	0xA0,0x86,0x41,0x77,0xE4,0x24,0xD7,0x32,0x18,0xD7,0x6F,
+	0x9B,0x23,0x65,0xDF,0x29,0x72,0x73,0xBC,0x83,0xA1,0x2B,
+	0x88,0xF3,0x82,0x5C,0x56,0xB8,0x85,0x84,0x82,0xDC,0x94,
+	0x6B,0x8D,0xF9,0x84,0xB7,0xB6,0x94,0xA2,0xFC,0x9B,0xC7,
+	0x05,0x75,0x36,0x29,0x1B,0x2A,0x12,0x4A,0xCC,0x72,0x75,
+	0x7A,0xB9,0xDC,0x3B,0xC5,0x74,0x48,0x0B,0xBC,0xF4,0xE4,
+	0x47,0xE2,0x62,0x9C,0xB5,0x5C,0x16,0x92,0x09,0x44,0x7A,
+	0xDE,0xE9,0x09,0x7A,0x6C,0xEC,0x3D,0x9E,0xE0,0xC5,0x8B,
+	0xDA,0xED,0xBC,0x51,0xBC,0x5D,0xDA,0x38,0x25,0x4B,0xB4,
+	0xC8,0x45,0x30,0xF0,0x67,0x4C,0x2A,0x4A,0x9F,0x78,0x66,
+	0x52,0x51,0xE6,0xA4,0x22,0xCB,0xA4,0x22,0xEB,0xA4,0xA2,
+	0x09,0x15,0xA7,0xB6,0xE8,0xB9,0xD3,0x64,0x79,0x46,0xC9,
+	0xF7,0xFA,0xEF,0x7F,0x1B,0xB0,0x7E,0xA0,0x39,0xD4,0x92,
+	0x13,0xEE,0x9F,0x66,0x6A,0xB6,0x4C,0x57,0x1B,0xC2,0x08,
+	0x77,0xAD,0x56,0xF1,0x0D,0x41,0x9F,0xD6,0x58,0xB9,0xB7,
+	0xE4,0xCC,0xCC,0x7C,0xC6,0x4A,0x3E,0x9A,0xE3,0xBE,0x1E,
+	0x71,0xA5,0x41,0x9A,0x46,0xEF,0xF0,0xC2,0xC8,0xDB,0x91,
+	0x79,0x99,0xE1,0x56,0xCC,0xF7,0x4C,0x1D,0xD6,0x07,0x0E,
+	0x53,0xB5,0x33,0x33,0xE9,0x4C,0x4D,0xFD,0x4C,0xEC,0x0F,
+	0xAC,0x3C,0x33,0x94,0xF6,0x3E,0x09,0x8D,0x49,0xAA,0x9D,
+	0x39,0x81,0x86,0x2F,0x9E,0x40,0x16,0x5B,0xC9,0x62,0x0B,
+	0x59,0x9C,0x49,0x16,0x67,0x90,0xC5,0xE9,0xDE,0xC5,0x93,
+	0xC9,0x17,0x52,0xE7,0xC3,0xA2,0xE8,0x5D,0xCD,0xB7,0xD7,
+	0x48,0x42,0x39,0x6E,0x7A,0xCB,0x66,0x1C,0xC0,0xCC,0x72,
+	0x49,0x07,0x8A,0x8F,0x95,0xA0,0x93,0xC2,0x34,0xC0,0xBB,
+	0x74,0x72,0x2D,0x6F,0x4D,0xA1,0x52,0xE3,0x11,0xC1,0xFD,
+	0x07,0xBC,0x75,0xB5,0xB3,0x48,0x70,0xE7,0xA1,0x07,0xE5,
+	0x4E,0x87,0xE0,0x7E,0x91,0xBE,0xCC,0x14,0xCA,0x1F,0x04,
+	0xC5,0xA6,0xB6,0x90,0x0A,0x40,0x6F,0xE1,0x64,0x0F,0x34,
+	0x09,0xAA,0x1D,0x90,0x36,0xE5,0x6F,0x3D,0x91,0x08,0xCA,
+	0x71,0x9C,0x00,0x20,0xD2,0x52,0xE7,0x8F,0x5D,0x3F,0x93,
+	0x3A,0x45,0xD7,0x56,0xA9,0x73,0xA3,0x50,0x8E,0x1A,0xA1,
+	0xD4,0xB9,0x5C,0x28,0xFF,0x31,0x7D,0x79,0x44,0xA8,0xF8,
+	0x0B,0xC2,0xD8,0x02,0xFD,0x13,0x30,0xC3,0xDD,0x7E,0x39,
+	0xC3,0x5D,0x63,0x24,0x19,0xE4,0x8C,0xFC,0xBD,0x78,0xDC,
+	0x6C,0xA7,0xDA,0x0B,0x79,0x48,0xF2,0x96,0xEA,0xC5,0xA8,
+	0xE2,0xEC,0x26,0x23,0xBA,0x4D,0xC2,0x63,0xE8,0xF2,0xD2,
+	0x74,0x5F,0x09,0x47,0x56,0xA7,0x07,0xF9,0x19,0x53,0x58,
+	0xB2,0x3F,0x63,0x30,0x64,0xBB,0x76,0x06,0x33,0x5F,0x03,
+	0x20,0xEE,0x33,0x9A,0x96,0x11,0x38,0x9C,0xD6,0xD8,0x5D,
+	0x02,0x16,0xC2,0x93,0x0C,0x79,0x5E,0x77,0x4B,0x12,0x2E,
+	0x0C,0x1A,0xDD,0x01,0x9E,0x00,0xFD,0xBC,0x3C,0xA7,0xBB,
+	0xBD,0xDA,0xE2,0x1A,0xC4,0x6E,0x91,0x6A,0xB9,0x84,0xF7,
+	0xB9,0x54,0x9B,0x85,0xF2,0xF3,0xE8,0xFB,0xE3,0x3C,0x4E,
+	0x71,0x5B,0xDE,0xA1,0x1B,0xF0,0x3F,0x14,0xCA,0x0B,0x71,
+	0x3B,0xAB,0x0E,0x53,0xD4,0x22,0x48,0x06,0x03,0x00,0xB4,
+	0x14,0x21,0x48,0x74,0xDF,0x05,0x0C,0x9E,0xDB,0x0D,0x50,
+	0x11,0xA4,0x51,0x78,0xA3,0xBE,0xE5,0x9E,0x88,0x0A,0x6F,
+	0x0A,0x5E,0x05,0x77,0xB8,0xBE,0x65,0x7C,0x04,0x7D,0x3F,
+	0x50,0x9B,0x81,0x6B,0xEF,0xB5,0xFC,0x14,0x80,0x51,0x5E,
+	0xF0,0xA0,0x3D,0xC4,0x11,0x35,0xA9,0xE5,0x21,0x5A,0x0C,
+	0x68,0x9C,0xCB,0x71,0x15,0x32,0x2E,0xCA,0xD2,0x52,0x08,
+	0x21,0xC2,0xCF,0xB7,0xAB,0xDD,0xD3,0xC5,0x07,0x0B,0xA7,
+	0x58,0xE4,0xC2,0xF4,0x6D,0x67,0xB8,0x0E,0x68,0x8C,0x6F,
+	0x32,0x7E,0x9C,0xD2,0xD1,0x68,0x0D,0x4C,0x27,0x74,0x1A,
+	0xB6,0xD8,0x2F,0x54,0x78,0x74,0x51,0xD3,0x86,0x8A,0xCD,
+	0xF0,0x7A,0x7B,0x90,0xF6,0xE7,0x6A,0xF9,0x7E,0x13,0x29,
+	0xCC,0xCC,0xAE,0x13,0xB6,0xA1,0x73,0x60,0xC8,0xCF,0x09,
+	0xE5,0xB7,0xA2,0x5B,0x93,0x5C,0x6B,0x8A,0xE0,0xCB,0xA0,
+	0xEB,0x49,0xAE,0x41,0xB7,0x4B,0x9B,0x35,0x59,0x42,0x79,
+	0x32,0x7C,0x46,0x0A,0x33,0xA0,0xE6,0x0F,0x75,0xF7,0xAB,
+	0xF9,0xB2,0x22,0xA9,0xD3,0x29,0x3C,0xFB,0x4F,0x68,0x1B,
+	0xC2,0xCF,0xDF,0xE4,0x28,0x30,0x0B,0xD4,0x19,0xC7,0x1A,
+	0x20,0x4F,0xAE,0xE0,0x54,0x08,0x6A,0x59,0xD9,0xDE,0x15,
+	0x89,0x1C,0xC2,0xB1,0x68,0xDB,0x19,0xD2,0xA1,0xAC,0xC3,
+	0xD5,0x8D,0xC2,0x4C,0x00,0xEA,0xEC,0x03,0x74,0x83,0x09,
+	0x5A,0x28,0x35,0xA7,0x10,0x68,0x03,0x2A,0x13,0xDC,0xBF,
+	0xA6,0xED,0x75,0x9D,0x50,0xF1,0x04,0x8E,0xE2,0x5B,0x40,
+	0x8D,0x1D,0xDC,0x5E,0xA8,0xE7,0x85,0xF2,0xBB,0x75,0xB4,
+	0x91,0xE2,0xAA,0x83,0xE4,0xE4,0xAF,0xAB,0x75,0x0E,0x0D,
+	0x6B,0x5E,0x37,0x4B,0x60,0x81,0x04,0xBE,0xC5,0x58,0x4B,
+	0x05,0xDD,0x87,0x50,0xA4,0xB1,0x9B,0xA4,0x3A,0x95,0x1D,
+	0x50,0xFE,0x21,0x2C,0xC5,0xB7,0x4C,0x4F,0xEA,0x82,0xF7,
+	0xF1,0x33,0x94,0xCD,0x10,0x24,0x6D,0x99,0x5C,0x04,0x6A,
+	0x3E,0xE0,0x27,0x80,0xF8,0xA3,0xD8,0xA2,0xC6,0x52,0x8D,
+	0x5E,0x37,0x0A,0xD3,0x01,0xDB,0xAA,0xAE,0x44,0x6C,0x85,
+	0x9F,0xE3,0x04,0x21,0x98,0xA4,0xF1,0xAE,0xD5,0xB7,0xBF,
+	0x09,0x25,0x3E,0xC5,0xC5,0x1A,0xB8,0xBC,0xB8,0xC3,0x29,
+	0xCF,0xEC,0x86,0xA9,0x87,0x1E,0x87,0x02,0x7E,0xBB,0x9F,
+	0xBC,0x0D,0x05,0x2C,0x16,0x2A,0x5E,0x8E,0x31,0x8A,0xC0,
+	0x1B,0xC2,0x93,0x57,0x9B,0x94,0x95,0x78,0xD9,0xD5,0x16,
+	0xAC,0x99,0x8A,0x88,0xB0,0xED,0x57,0xC0,0x97,0xEC,0x0E,
+	0x61,0xBB,0x17,0x9E,0x64,0x0B,0x72,0x2A,0xB7,0xAB,0x2F,
+	0xFB,0x37,0x8A,0xF7,0xD1,0xC6,0xC4,0xB9,0xA6,0xD2,0xDE,
+	0x85,0x6B,0x7F,0x6C,0x9B,0x27,0x89,0xD6,0xBA,0x2B,0x13,
+	0x9A,0x89,0xAF,0x88,0x23,0x4B,0xA1,0x21,0x25,0x65,0xC5,
+	0x3E,0x40,0x0C,0x78,0xD2,0x93,0x80,0xCF,0x38,0xCA,0xB4,
+	0xFC,0xE1,0x0B,0xE4,0xB3,0x28,0x94,0xFF,0x0E,0x5E,0x5A,
+	0x92,0xBA,0xD5,0xC6,0xBF,0x83,0x06,0xFF,0x40,0xA8,0xF8,
+	0x6F,0x28,0x17,0xEA,0xB1,0x9A,0x74,0x38,0x22,0xC3,0xE6,
+	0x9B,0xA9,0x10,0xA8,0xEC,0xEC,0xC3,0x87,0x9F,0x3D,0xC2,
+	0xAC,0x56,0xCA,0xD2,0x40,0x85,0x13,0xCA,0xB1,0x5B,0xB5,
+	0xBC,0x0E,0x19,0x85,0x9F,0x95,0xD0,0x6A,0xFC,0xBE,0x98,
+	0x55,0x5B,0x98,0x49,0xE7,0x55,0x85,0xBC,0x5D,0xA8,0x78,
+	0x2E,0xD6,0x42,0xCC,0xDE,0x82,0x6E,0x0F,0xEE,0xEC,0xAE,
+	0xEC,0xEC,0x4B,0xDF,0xC3,0x42,0xC5,0x46,0x5C,0x51,0xE5,
+	0xAD,0xB8,0x47,0xDF,0xD2,0xD3,0x8D,0xF0,0x7E,0x42,0xE1,
+	0xDD,0x27,0x94,0x3F,0x46,0x5F,0x0A,0x85,0x72,0x0F,0xE2,
+	0xFD,0x00,0x5E,0xE0,0xF6,0xA6,0xD6,0x35,0x3A,0xDA,0x4D,
+	0xF3,0xBB,0x71,0x8F,0x4F,0xEE,0xA1,0x2D,0xEE,0xCD,0xED,
+	0xD5,0x2D,0x52,0x4F,0x6F,0xA7,0x2D,0xA0,0x91,0x6B,0x7B,
+	0x23,0xBF,0xAF,0x4A,0x35,0xAC,0x08,0x1D,0x3A,0x8E,0x29,
+	0xC5,0xFE,0x88,0xA8,0x96,0xAF,0x8C,0x8B,0x52,0xAE,0x41,
+	0xD4,0x32,0xEC,0x20,0xF5,0x42,0xF9,0x21,0x04,0x38,0x20,
+	0x83,0x7D,0xE9,0x49,0x28,0x35,0xB5,0x51,0x16,0xCF,0xC2,
+	0xDB,0xF8,0x4C,0xB8,0x1F,0xC5,0xCB,0xAB,0xD3,0x51,0x6C,
+	0x71,0x5D,0xCA,0x7C,0xBC,0xC5,0x77,0xCB,0xE4,0xE5,0xB4,
+	0xC1,0x45,0x4C,0xF1,0x0D,0x6E,0x21,0x16,0xB3,0xA4,0x1B,
+	0x5B,0xBB,0x49,0x23,0x1A,0xB1,0x30,0x3B,0x82,0xC8,0xB4,
+	0x82,0x64,0x20,0x75,0x5C,0xA7,0xF2,0xE7,0xF8,0xCC,0xD5,
+	0x09,0x99,0xD3,0x31,0xF3,0x08,0x6C,0x36,0x75,0x13,0x43,
+	0x84,0xF6,0x5C,0xEE,0x7A,0x22,0x6B,0xA1,0xD3,0xD0,0x2E,
+	0x16,0xEC,0x56,0xBB,0x01,0xE9,0x24,0x75,0x2D,0xD7,0xBB,
+	0x63,0x82,0x12,0x06,0x72,0x60,0x20,0xA8,0x2D,0xA0,0x24,
+	0x9B,0x94,0xFF,0x33,0x88,0x6A,0x2D,0x42,0xF9,0x17,0x00,
+	0x07,0xE6,0x40,0x26,0x4F,0x92,0x3B,0x6F,0x63,0x3A,0x75,
+	0xFB,0x73,0xE9,0x3A,0x9E,0xFA,0xC7,0x40,0xAF,0xB4,0x19,
+	0x82,0xAC,0x1C,0x5D,0x27,0x04,0x95,0x9B,0xA5,0x4D,0xF5,
+	0xDC,0xC7,0x45,0x68,0xDF,0xD9,0xD4,0x91,0x88,0x84,0x5A,
+	0x94,0x53,0x5E,0xD8,0xAD,0xEE,0xE0,0x76,0x28,0xB3,0x59,
+	0x49,0xAE,0xE1,0x4C,0x38,0xCC,0xE9,0xE8,0x8B,0x37,0x1D,
+	0x2F,0x21,0xE6,0xAE,0x3E,0x31,0x74,0x3F,0x66,0x59,0x31,
+	0x39,0x63,0xFB,0x04,0xFA,0xDA,0x83,0xBE,0xE5,0x83,0xB2,
+	0x6B,0x4A,0x97,0x83,0x36,0x7D,0xB1,0x03,0x66,0xC2,0xEE,
+	0x2E,0x73,0x99,0x9E,0xEA,0x54,0xD9,0x35,0x1B,0x0A,0xE4,
+	0x07,0xCC,0xF2,0x7D,0xA6,0xEC,0x63,0xEB,0xEF,0xF5,0x6D,
+	0xB0,0xC8,0xE6,0xEC,0xD3,0x1B,0xF2,0xC8,0x03,0xE6,0x89,
+	0x67,0x22,0xF7,0x65,0xB8,0x3B,0xCD,0xA5,0x05,0x3E,0x53,
+	0x06,0x79,0xC0,0x44,0x06,0x43,0x17,0x5E,0xCE,0x93,0x15,
+	0x3C,0xA8,0x0A,0x64,0xA1,0x11,0x14,0x7D,0x32,0x97,0xF7,
+	0x3D,0xC6,0x4B,0x46,0x8E,0x6E,0x2C,0x81,0xCE,0x76,0xDF,
+	0x04,0x5B,0x7D,0xF8,0x60,0xF6,0xD1,0xF5,0x5A,0x72,0x12,
+	0x26,0xC2,0xD9,0x6D,0x62,0x25,0x79,0x20,0x3D,0xDC,0x14,
+	0x79,0x20,0x53,0x2E,0xE2,0xC9,0x32,0x93,0x3C,0x1B,0x32,
+	0x41,0xEE,0xC4,0x7C,0xEA,0xFA,0xC9,0xD2,0x65,0x80,0xEA,
+	0x43,0xBE,0xD9,0xDD,0xED,0x1C,0xE7,0x5A,0x21,0x0F,0x96,
+	0x2E,0xF4,0xF8,0xF8,0xC1,0xE4,0xFD,0x76,0x0D,0xE7,0xBA,
+	0x9F,0x0C,0x96,0x67,0x9A,0xB2,0x03,0x82,0xBB,0x1E,0x6D,
+	0xDD,0x66,0xF3,0xEB,0x57,0x00,0x44,0x79,0x06,0xF7,0xAE,
+	0x3C,0x32,0xFB,0x2D,0xA1,0xE2,0x0C,0x84,0xEA,0x46,0x91,
+	0x51,0x39,0xF7,0x9B,0x44,0x1D,0x59,0x6A,0x22,0x27,0x23,
+	0xF7,0x67,0xC0,0x47,0x99,0x31,0x67,0xB5,0x79,0xBD,0x8E,
+	0xAC,0x36,0xE7,0xAC,0x4E,0x17,0x7E,0x5E,0xAB,0xCE,0x03,
+	0x74,0x66,0x32,0x38,0x67,0x26,0x26,0x9D,0x67,0x42,0x38,
+	0x76,0x23,0x29,0x30,0x92,0x22,0x3E,0x72,0x7F,0x66,0xF8,
+	0x0F,0xF2,0xCC,0x09,0xD9,0x81,0xD2,0x97,0xE4,0x2D,0x20,
+	0x2E,0x70,0x0A,0xF8,0x20,0x77,0xED,0x0A,0xA9,0xC9,0xEE,
+	0x28,0xFB,0x16,0x7C,0x4F,0xEC,0xE0,0xCE,0x66,0x77,0xAC,
+	0x7F,0x08,0x2D,0x0D,0x64,0x73,0x7B,0x35,0x0C,0x15,0xB8,
+	0xD3,0xE6,0xEE,0x8C,0xB8,0x8C,0x80,0x30,0x17,0x9A,0x27,
+	0x2A,0x72,0x21,0x60,0x5A,0xEA,0x00,0x6C,0x9F,0x5D,0x86,
+	0x23,0x23,0x70,0x02,0x5E,0xE7,0xF7,0xBE,0xE6,0xB3,0xD7,
+	0xF0,0x3F,0xD5,0x6F,0x1B,0x2A,0x77,0x33,0x41,0x07,0xE3,
+	0xB3,0x4F,0x0A,0x3F,0xBF,0x0D,0x67,0x28,0x5B,0x69,0x03,
+	0x0E,0xFF,0x46,0x2E,0x9C,0x10,0xDE,0x17,0x81,0xDA,0xCF,
+	0x47,0xB6,0x21,0xF3,0x66,0xF3,0x2D,0x16,0x5C,0x66,0x5A,
+	0x9D,0x1E,0x6F,0x9D,0x81,0x23,0x59,0xBF,0xFD,0xCC,0x65,
+	0xCC,0x02,0x41,0x1E,0x86,0x86,0x01,0xD9,0x21,0x97,0x23,
+	0xBB,0x4E,0x1C,0x46,0xED,0x2A,0xC4,0x34,0xDB,0x59,0x66,
+	0x43,0x40,0x46,0xA3,0x21,0x40,0x8E,0x1E,0xCD,0x21,0x44,
+	0xA3,0x2D,0x42,0xF2,0xF0,0x8D,0x31,0xA5,0xE2,0x94,0x4B,
+	0x07,0x8C,0xA9,0xF0,0xC3,0x44,0x88,0x42,0x7A,0x90,0x2E,
+	0xFD,0x2E,0x32,0x12,0x0A,0x31,0x5C,0x89,0x1B,0xAD,0xBD,
+	0x11,0x7D,0xE7,0x2F,0x8B,0x96,0x2E,0x63,0x45,0x03,0x9C,
+	0xA1,0x72,0x81,0x55,0xD6,0xB8,0xFD,0x93,0x73,0xB4,0x30,
+	0xDD,0x5F,0x04,0xA0,0xC5,0x4F,0x54,0xF7,0x86,0x73,0x3B,
+	0x48,0x48,0x2E,0x31,0x2A,0xF3,0x90,0xAA,0x33,0xF2,0x0A,
+	0xBE,0xE2,0xAC,0x98,0x21,0xDB,0x9C,0x72,0x76,0xE0,0xB2,
+	0x79,0xAF,0xBE,0x52,0x7B,0xC2,0x06,0xA9,0xDF,0x60,0xA9,
+	0x49,0xA3,0x01,0x8D,0xC8,0xE6,0x9C,0x18,0x77,0x32,0x74,
+	0xB2,0x2E,0x09,0x22,0xFE,0x8B,0x45,0xEC,0x88,0xEE,0x37,
+	0xBC,0xBD,0x73,0x09,0xB5,0x37,0x15,0x0D,0x6C,0x8F,0x40,
+	0xA1,0x3B,0xA1,0x51,0x3C,0xD2,0x7D,0x05,0x93,0x81,0x0B,
+	0x06,0xF7,0xD3,0x19,0x1C,0xE8,0x30,0x14,0x91,0x56,0x66,
+	0xE9,0x42,0xB7,0x13,0x82,0xE8,0x90,0xB1,0xA0,0x03,0x7D,
+	0xCA,0xB8,0x8C,0xB1,0xF0,0xB0,0x9C,0x2C,0x0F,0x71,0xB7,
+	0xF0,0xEE,0x6A,0xD3,0xC4,0x63,0xDC,0x99,0xAD,0xD5,0x68,
+	0xDE,0x96,0x75,0x4A,0xFA,0xA8,0x8D,0x9C,0x26,0x27,0x03,
+	0x61,0xB3,0x53,0x9E,0xEE,0x94,0xD7,0x69,0x01,0x5B,0xDD,
+	0x09,0xDB,0x48,0xBF,0xDD,0x05,0x21,0x35,0x81,0x26,0xF8,
+	0x0D,0x38,0xC9,0x74,0x27,0x59,0xA7,0x45,0x01,0xFB,0x04,
+	0xD6,0xF3,0x6C,0xA3,0xFB,0x92,0xC9,0x51,0x6B,0x67,0x8B,
+	0x44,0x75,0x64,0xB0,0x82,0x97,0x0C,0xD5,0xE6,0x67,0x50,
+	0x13,0x81,0x0F,0x7B,0x64,0xF3,0xC4,0x4B,0xA4,0x06,0x7B,
+	0xDE,0x44,0x72,0xD9,0xE9,0xFE,0x07,0x47,0xB2,0x38,0x45,
+	0x3A,0xCA,0x11,0x73,0x6D,0x7E,0x3A,0x55,0x8F,0xFD,0x7C,
+	0x24,0x3F,0x43,0x79,0xF2,0x1C,0xB0,0xAB,0x91,0x21,0x88,
+	0x7D,0x49,0x7D,0x8D,0xCD,0xD8,0x70,0x39,0x6C,0x27,0x52,
+	0x4D,0xAD,0x9C,0xF8,0xEC,0xEA,0xB2,0x22,0xE8,0xB0,0x58,
+	0x9D,0xF5,0xAE,0x85,0xD0,0x81,0x81,0x43,0x8B,0x7C,0x73,
+	0x2D,0xEE,0xEA,0xC9,0xB5,0x05,0x57,0xA9,0x37,0x9B,0x82,
+	0x66,0xF6,0x68,0x65,0x8F,0x36,0x8A,0xE0,0x5C,0x10,0x18,
+	0x0D,0x64,0x6E,0xB7,0x5B,0x99,0x4C,0xE6,0x36,0x11,0x90,
+	0xE1,0x5A,0x66,0x26,0x54,0x02,0x53,0xD9,0x00,0x36,0x12,
+	0xBF,0xB8,0x3B,0xFC,0x8A,0xDA,0x22,0x5E,0x85,0x16,0x11,
+	0xFE,0x5F,0x30,0x3B,0x90,0xEB,0x17,0x2E,0xA2,0xA5,0x43,
+	0xD9,0xD3,0xE5,0x22,0xAB,0xAC,0xE5,0x42,0xBE,0xD9,0xFC,
+	0x4B,0xB8,0xA3,0x9B,0xAB,0x2D,0xBD,0x25,0xD7,0xB8,0x61,
+	0x84,0x94,0x97,0x85,0x32,0x48,0x4C,0xC3,0x9B,0xE2,0x1B,
+	0x05,0x9D,0xDF,0xBE,0x1B,0xD7,0xD2,0x72,0x52,0xF1,0x57,
+	0xD4,0xCB,0xDA,0x12,0x34,0x42,0x2A,0xA1,0xD6,0x92,0x72,
+	0x7D,0x6C,0x33,0x93,0xB7,0xA2,0xE0,0x37,0x59,0x81,0xED,
+	0xCA,0xAF,0x61,0xAC,0x03,0xA6,0x73,0x37,0x64,0xBA,0x38,
+	0xD6,0x79,0x4D,0xFF,0xEC,0x30,0x8D,0xA6,0x2D,0x22,0xDE,
+	0xB1,0x35,0xD7,0x8A,0x17,0xAA,0xAD,0x9F,0x42,0x8D,0x6D,
+	0xD4,0x4B,0x21,0x33,0xAD,0xBE,0x22,0xA3,0x3B,0x6C,0x24,
+	0xA3,0xA2,0x75,0x12,0x0A,0x9F,0xAF,0xD5,0x4B,0xC3,0xD0,
+	0x67,0x97,0xA0,0x09,0x1F,0x95,0x47,0xE3,0x7B,0x20,0xCC,
+	0x4B,0xC7,0xB8,0xBD,0xB3,0x59,0xC3,0x43,0xA3,0x9A,0x4D,
+	0x07,0x20,0x2F,0x04,0xC7,0xC2,0x82,0x04,0x5A,0x50,0x62,
+	0xF3,0x6C,0xDF,0xF4,0xDC,0x5E,0x4D,0xA5,0xE1,0x84,0x4D,
+	0x0E,0x50,0xC4,0xAA,0xDD,0x7E,0xA3,0x9C,0x6E,0x25,0xEB,
+	0xBA,0xDD,0x97,0x60,0x3A,0x12,0xC3,0x82,0xDD,0x01,0x08,
+	0xFC,0xD4,0xF8,0x8A,0x06,0x49,0x17,0x3A,0xB2,0xAB,0x4B,
+	0xB3,0xA3,0xE6,0x7F,0xF7,0x48,0x79,0x77,0x51,0x3E,0x4D,
+	0xC1,0x29,0xCC,0x60,0x77,0x75,0x6E,0xCE,0xE0,0xD2,0x5B,
+	0xE4,0xD1,0xCB,0xCD,0x68,0x08,0x5B,0xA6,0x27,0x67,0x40,
+	0xF0,0x90,0xC1,0xAC,0x51,0xE6,0x0C,0x2E,0xB3,0x20,0xCF,
+	0xA0,0x4D,0xD0,0xEC,0xC9,0xAE,0xA3,0x0A,0x8E,0xDD,0xD9,
+	0xA1,0x52,0xDE,0x76,0x2A,0xEC,0x9F,0x58,0x1D,0x7E,0x9D,
+	0x35,0xDC,0xC1,0x30,0x9B,0x78,0xDE,0xCF,0xAC,0xB1,0xD5,
+	0x7B,0xDB,0x18,0x77,0xD5,0xFE,0xE3,0x1A,0xE4,0xCE,0xC3,
+	0x8A,0xE8,0x11,0x93,0x29,0xBB,0x68,0xEF,0x6B,0x52,0x8A,
+	0x23,0x54,0x1D,0xBE,0x1C,0xC5,0x6E,0x2A,0xCC,0xBF,0x95,
+	0x35,0xE8,0xD8,0xA7,0x1A,0xB7,0x9F,0x65,0xE6,0xDE,0xD5,
+	0x75,0x1C,0x82,0xDD,0x0A,0x9F,0xC3,0x5B,0x37,0x04,0x20,
+	0xC4,0xDD,0x31,0xBD,0x6C,0x5C,0x0C,0x0C,0xF0,0xAD,0x4A,
+	0x33,0x5B,0x23,0x9D,0x18,0x37,0xF2,0xEC,0xB5,0xD3,0xB7,
+	0xD5,0xB8,0x27,0x5B,0x71,0x5D,0xBB,0x8E,0x68,0xA1,0x07,
+	0xCE,0x82,0x2A,0x45,0x46,0x40,0x2E,0x13,0x47,0x38,0x5C,
+	0x60,0xC5,0x06,0x9D,0xCF,0x47,0x0A,0x32,0x94,0x0D,0xEF,
+	0xA9,0x97,0x28,0xF5,0xB5,0x06,0xC2,0xFD,0x81,0x45,0xC5,
+	0x8C,0x80,0x28,0x6A,0xC9,0x2A,0xE3,0x5C,0xE3,0xA3,0xBC,
+	0xC8,0xEC,0x47,0x5B,0x3A,0xB3,0xBB,0xA2,0x58,0x01,0x21,
+	0xD7,0x80,0x90,0xF0,0x65,0x20,0x73,0x2D,0xD3,0xFA,0x2F,
+	0x7A,0xEF,0xA6,0x36,0x08,0x3D,0xDA,0xD2,0x4C,0xA9,0xE7,
+	0xC6,0x6D,0x16,0xEA,0x54,0xA6,0xCD,0x96,0x3B,0x9A,0x7D,
+	0xB4,0x4C,0x7F,0xB0,0x87,0x76,0x11,0x65,0x8F,0x81,0x8D,
+	0xDF,0xBF,0xC5,0x99,0x70,0xC7,0x86,0x7F,0xCB,0xAE,0x5E,
+	0xFF,0x8B,0x89,0xD5,0x24,0xDD,0xEA,0x2B,0xE8,0xCE,0x0E,
+	0x6D,0x70,0x33,0xB1,0xC4,0x38,0x66,0x40,0xB7,0x54,0xE2,
+	0x3C,0x78,0x7B,0x50,0xD6,0xFA,0x56,0x74,0x73,0xA1,0xEC,
+	0x1A,0x71,0x09,0x41,0x73,0x65,0x5C,0x56,0xE5,0xAD,0x9C,
+	0x56,0x97,0x69,0xAD,0xD5,0x61,0xEF,0x93,0x63,0xBC,0xC1,
+	0x2F,0x95,0x37,0xDF,0x6B,0xEC,0xE5,0x0D,0x25,0x28,0xFB,
+	0xE8,0x86,0x41,0xD8,0xEF,0x20,0x7B,0x76,0x5D,0xD9,0x7F,
+	0x31,0x61,0xF7,0x1F,0xE1,0x17,0xE5,0xC9,0x56,0xF7,0x17,
+	0xD3,0x85,0x67,0x39,0x7A,0xED,0x12,0x88,0xA0,0x89,0xCA,
+	0x5B,0x5D,0x31,0xA6,0x87,0x77,0x45,0xC7,0x0F,0x34,0xF7,
+	0xC2,0x79,0x57,0x86,0x27,0x25,0x62,0x37,0xF7,0x11,0xF0,
+	0x3B,0x16,0x2E,0x25,0xC1,0x03,0xE6,0xC3,0x1A,0x8D,0x72,
+	0x6B,0x0B,0x1A,0x8E,0x19,0x34,0x09,0xC3,0x91,0x66,0xE1,
+	0x32,0xB6,0x9E,0xF2,0xB1,0xA7,0x91,0x1C,0xDB,0x5B,0x20,
+	0x1F,0x0D,0xB4,0x98,0x4F,0x8C,0x73,0xDE,0x43,0x92,0xE0,
+	0x6F,0x99,0x36,0xD6,0x8B,0x92,0x91,0x40,0xE8,0x07,0xD8,
+	0xD7,0x9D,0xC0,0xB3,0xBD,0x06,0x4A,0xC1,0x83,0x2B,0xFA,
+	0xEC,0x4F,0x44,0xD7,0x83,0x82,0xE4,0x6D,0xF2,0x81,0x32,
+	0x26,0x49,0xA3,0xD9,0x23,0xB9,0x6E,0xAD,0xD4,0x92,0x2B,
+	0xB6,0x53,0xBD,0xE0,0x4F,0x9E,0x72,0x9E,0x3C,0x1A,0xB8,
+	0x00,0x5D,0x2D,0x44,0xD7,0x71,0x36,0xDD,0x45,0xAE,0x93,
+	0x4B,0xE4,0x0A,0x5A,0xB4,0xD2,0x22,0x79,0x2B,0x2D,0x35,
+	0x23,0xBB,0xC3,0x95,0x42,0xAD,0x67,0x94,0x99,0x17,0xA2,
+	0xE6,0x6E,0xCC,0xEA,0xD1,0x89,0x0D,0xE1,0x4E,0x43,0xEF,
+	0x32,0x11,0x2B,0xBF,0xA5,0xCB,0x90,0xB8,0x3F,0x4B,0xAA,
+	0xB7,0xD5,0x39,0x49,0x81,0x16,0xEF,0xC2,0x2D,0x30,0xE0,
+	0x3D,0xB8,0xDA,0x6D,0x21,0x78,0xE5,0xB7,0x35,0xC1,0xAF,
+	0x71,0x1B,0x9A,0x55,0xA4,0xF4,0xEE,0xB2,0xE0,0xE8,0xF4,
+	0x2E,0xF9,0x27,0x39,0x06,0xE8,0x04,0x95,0xC3,0x06,0xF4,
+	0xF5,0xA5,0x59,0xC5,0x74,0x35,0xFC,0x57,0xF5,0x08,0x34,
+	0xF4,0x28,0x8B,0x97,0xDC,0xAA,0xA9,0xC2,0xC5,0xB1,0x9A,
+	0x3E,0xF6,0x49,0x54,0x7E,0xD6,0xEA,0x97,0x9B,0xD9,0x95,
+	0x78,0x20,0x49,0x53,0x40,0x92,0x1A,0x98,0x10,0x51,0xD0,
+	0x65,0x0B,0x5E,0x42,0xD6,0x76,0x70,0xEA,0x73,0x00,0x70,
+	0x02,0xFC,0x6C,0xBD,0x84,0xBF,0x4E,0xB9,0x33,0x70,0x09,
+	0x78,0xF2,0xB9,0x53,0x6E,0x44,0xD3,0x6D,0xB9,0xCE,0x59,
+	0xA5,0x01,0xA9,0xE4,0x1C,0xE9,0x8F,0x59,0x04,0xD5,0xA0,
+	0xFC,0x89,0x0C,0x9B,0x85,0x86,0xD2,0xD4,0x9A,0x0B,0xCB,
+	0x50,0x86,0x5F,0x40,0xE7,0x5F,0x18,0x18,0x19,0x36,0x1B,
+	0x27,0x3B,0x75,0x2D,0x7F,0x39,0x1D,0x89,0x00,0xF1,0x09,
+	0xA1,0xA1,0x96,0xFF,0x3C,0x8D,0x3A,0x6B,0x1F,0x7B,0x2A,
+	0xA8,0xFE,0x9A,0xBD,0xDF,0x65,0x9C,0xB7,0xB5,0x03,0xDB,
+	0xCD,0x78,0x89,0x26,0xDD,0xEF,0x27,0x6D,0xCC,0x3A,0x13,
+	0x45,0x2E,0xDD,0x50,0x53,0x0E,0x35,0xA1,0x8E,0x0E,0xD1,
+	0x0F,0xF7,0x46,0x27,0xD8,0xB3,0x91,0xEA,0x76,0x7B,0xAA,
+	0xC5,0xA5,0xC3,0x6B,0x66,0xEC,0x66,0xA5,0x2B,0x99,0x39,
+	0x23,0xF3,0x3E,0x9C,0x2A,0x1D,0xB7,0x78,0x1E,0x4E,0x6D,
+	0x3F,0x92,0x24,0x5E,0xF4,0x7C,0x2C,0xBD,0xA5,0xF5,0x3C,
+	0x9D,0xDA,0xCF,0xC0,0x6D,0xF1,0x42,0x48,0x7C,0x4B,0x7B,
+	0x30,0xE2,0x1A,0x49,0x4E,0xDB,0xEA,0xB3,0x4E,0x3B,0xC9,
+	0x7B,0x9E,0x22,0x2E,0x70,0xDD,0xE8,0x31,0xD2,0x6B,0x18,
+	0xA1,0x38,0x8F,0x99,0x76,0x20,0x5A,0xF0,0x42,0xF5,0x80,
+	0x07,0xB4,0x36,0xB4,0xD0,0xF4,0xCD,0xB7,0x72,0xE4,0x1D,
+	0xDF,0x4A,0xAB,0x95,0x6C,0xB2,0x5A,0xA7,0x9E,0xBA,0x36,
+	0x95,0xE8,0xBC,0xCF,0xBE,0x04,0xB3,0x05,0xBA,0xC7,0x69,
+	0xCD,0x87,0xB1,0xE6,0x7C,0xA1,0x37,0x3F,0x32,0xC7,0x53,
+	0x18,0x29,0xF7,0x8B,0x57,0x51,0x19,0x9F,0x10,0xAF,0xDF,
+	0x92,0x93,0xEE,0xAE,0x14,0x91,0xC7,0x26,0xAF,0xFC,0x1E,
+	0xBB,0x5E,0xDD,0x8A,0x9A,0x6B,0x8D,0x41,0xED,0x94,0x02,
+	0x65,0x87,0xFA,0x99,0x78,0x4F,0x2A,0xDE,0xE9,0xE3,0xD5,
+	0x96,0xFB,0x5D,0xC2,0xE4,0x87,0x72,0x47,0xAE,0xD7,0x15,
+	0x84,0x3F,0xE3,0xF3,0x3D,0xDA,0xF0,0x35,0xB4,0xC7,0xAA,
+	0x59,0xC4,0xAC,0x9D,0x37,0xE1,0x45,0xEE,0x4D,0x50,0x4B,
+	0x7D,0xF7,0xF3,0x28,0xFA,0xF3,0x09,0x6E,0x34,0x9C,0xA0,
+	0x04,0xB8,0x80,0x80,0x0F,0x80,0x80,0x59,0xE4,0x49,0xEB,
+	0xAC,0xA9,0xF5,0x39,0x43,0x85,0x67,0xD1,0x10,0x41,0xAE,
+	0x93,0xAB,0x91,0x9C,0x5F,0x02,0x45,0x43,0x65,0x88,0x2E,
+	0xF4,0xFE,0x27,0x92,0x45,0x8E,0x7A,0x56,0xA3,0x9B,0xCE,
+	0x13,0x40,0x58,0xFD,0x7D,0xDE,0xC2,0xC8,0xFD,0x9E,0xFB,
+	0x28,0x61,0x40,0xED,0x6C,0xF7,0x91,0xF9,0x7D,0x8F,0x3C,
+	0x2C,0x25,0xEF,0xE3,0x26,0x20,0x0F,0x7D,0x2E,0x59,0x79,
+	0x06,0x09,0x6A,0x5B,0x5D,0x73,0xED,0x4C,0x50,0x37,0xE5,
+	0x5A,0xA3,0xFB,0x8C,0x66,0xA6,0xF2,0x84,0x1A,0x96,0xD0,
+	0x9F,0xBF,0x8C,0xBF,0x88,0x8D,0x35,0x9F,0x61,0xE3,0x59,
+	0x81,0x9B,0x86,0x4D,0x37,0x60,0x30,0xD5,0x37,0xFE,0x45,
+	0xFE,0x26,0xCC,0xCF,0x6A,0x64,0xBF,0xCD,0xDF,0xA2,0x33,
+	0x26,0xF6,0x6F,0x3A,0x5A,0x90,0x61,0xF8,0x4B,0xEF,0x4F,
+	0x5D,0xBA,0x8C,0xD4,0x44,0x07,0x97,0x1F,0x44,0x47,0xE5,
+	0xD5,0x15,0x67,0x85,0xED,0xBF,0x8D,0x1D,0x7A,0x70,0xE2,
+	0xA9,0x07,0x35,0x91,0x50,0x51,0x86,0xFA,0x44,0x63,0xA0,
+	0xC3,0x4C,0xDE,0x83,0x9E,0xF0,0xA5,0x8A,0x8A,0x99,0xFA,
+	0x01,0xAC,0xD5,0xE8,0xA3,0xC6,0x21,0xFF,0x5F,0x7B,0xCF,
+	0x1E,0x1F,0x55,0x75,0xE6,0x99,0x64,0x26,0x09,0x21,0x71,
+	0x62,0x41,0x85,0x2D,0xC2,0x89,0x25,0x2C,0x54,0x1E,0x09,
+	0x09,0x88,0x91,0x14,0x42,0x32,0x40,0x34,0x8F,0x31,0x93,
+	0x97,0x64,0x23,0x0E,0x33,0x77,0x98,0x31,0x93,0x99,0x38,
+	0x73,0x27,0x8F,0x0A,0x35,0x16,0xD1,0x5C,0x86,0x44,0xEA,
+	0xDA,0x55,0x5C,0xDC,0x95,0x87,0xBB,0xEA,0x6E,0x77,0xF1,
+	0x55,0x50,0x69,0x9B,0xF0,0xB1,0x0D,0x3E,0xBE,0x8A,0x88,
+	0x2B,0x0D,0xDA,0x52,0xF1,0x31,0x6D,0xD0,0xB5,0xAD,0xCB,
+	0x06,0x44,0x67,0xBF,0x73,0xEE,0xCD,0x83,0xD7,0x6F,0xDD,
+	0xDF,0xB6,0xDD,0xFE,0x91,0xEF,0x77,0xCF,0xBD,0xF7,0xBC,
+	0xBE,0xFB,0x7D,0xDF,0x39,0xE7,0x3B,0xDF,0xB9,0xF7,0x9C,
+	0x7B,0xF4,0x96,0x39,0x34,0x09,0x6E,0x9C,0xFA,0x90,0x98,
+	0x09,0x37,0x41,0xCC,0x84,0x3B,0xAF,0xF3,0xD9,0x2E,0x3B,
+	0x9E,0xA3,0xB1,0x7C,0x36,0xB4,0xD3,0xF5,0x39,0xBD,0xEB,
+	0xC0,0x8E,0xD8,0x63,0x12,0xF3,0xB8,0x73,0x31,0x9F,0xF7,
+	0x3E,0x77,0xE8,0xDF,0xED,0xA2,0xAB,0xB9,0xC1,0x22,0xD6,
+	0x84,0x84,0xD6,0xEA,0x7C,0x30,0xEB,0xC6,0xAD,0x22,0x8D,
+	0xD7,0xDA,0xFB,0xB1,0x79,0xE3,0xC7,0x11,0x8B,0x98,0x70,
+	0x68,0xCD,0x39,0x26,0x77,0x01,0x87,0xE7,0x3E,0xC6,0xCC,
+	0xDE,0xE3,0xD3,0xEE,0xFE,0x48,0xB4,0xFF,0xF1,0x83,0xDA,
+	0xE0,0xC6,0xF8,0xBA,0xA5,0xDA,0x00,0x45,0x26,0x19,0xCB,
+	0x3D,0x74,0x53,0xA8,0x67,0x5D,0x01,0xF5,0xFB,0x92,0x56,
+	0x7D,0x49,0x88,0xAE,0x5E,0xA5,0xE2,0x62,0xE7,0x72,0x3E,
+	0xF0,0xBE,0x36,0x70,0x5E,0xE6,0xF5,0x3F,0x88,0x1D,0x3B,
+	0x73,0x4E,0xA2,0x91,0xEC,0x5D,0x0F,0x0B,0xC1,0xF7,0x0E,
+	0xA4,0xD1,0xC0,0xC1,0xF2,0x92,0x30,0xDA,0x36,0x65,0x49,
+	0xA1,0x9D,0x35,0x45,0xC6,0xE7,0xCB,0xA5,0x21,0x91,0xC4,
+	0xDE,0x13,0x29,0x17,0x92,0x64,0xED,0xF2,0x09,0xCD,0x73,
+	0xF7,0xA5,0x30,0x8F,0xAE,0x2F,0x62,0x5F,0xEB,0xD1,0xF6,
+	0x06,0xF9,0xD3,0x68,0xCC,0x35,0xDA,0xDE,0xEE,0xED,0xDC,
+	0x2F,0xBE,0x47,0xC7,0x66,0x90,0x69,0x7E,0xF7,0x69,0xB1,
+	0x62,0x24,0x6C,0xEB,0x28,0x10,0xCB,0x67,0x12,0x43,0xB9,
+	0x1D,0xA7,0xED,0x91,0x29,0xCF,0x5C,0x26,0x56,0x95,0x45,
+	0x3B,0x6E,0x11,0x4B,0x62,0x06,0x27,0xC5,0xFA,0x8E,0x19,
+	0xDF,0xB3,0xA9,0x41,0x77,0x9C,0xBE,0x26,0x64,0x7E,0x66,
+	0xC2,0xC0,0xBB,0x1D,0xA7,0x39,0xDD,0x58,0x06,0x8E,0x74,
+	0x9C,0x99,0xD0,0xF2,0x3A,0x85,0xBC,0xAA,0x1D,0x1C,0xDA,
+	0xE9,0x3D,0xF6,0xFD,0x51,0x39,0xCE,0xE9,0x8F,0xC5,0xD7,
+	0xEF,0x36,0xDD,0x32,0x97,0x74,0x57,0xDE,0x60,0x69,0x16,
+	0x85,0x68,0x26,0x73,0x10,0xA8,0x2E,0x1F,0x10,0x8F,0x7C,
+	0x2F,0x21,0x6A,0x4E,0x58,0x05,0xF2,0xFB,0x9E,0x11,0x9F,
+	0x20,0xEC,0x78,0x3D,0xF6,0x57,0x09,0xDA,0x44,0xD3,0x50,
+	0x2B,0x71,0xE8,0xAA,0x3B,0x66,0x4F,0x11,0xD3,0x9C,0x68,
+	0x3C,0x47,0x7E,0xEF,0x20,0x05,0x2C,0xA1,0x80,0x2D,0xF5,
+	0x50,0x9D,0xE4,0x98,0x5A,0x29,0xA7,0xE1,0x4C,0xAD,0x8D,
+	0x9E,0x8C,0xAE,0x4F,0xE9,0x6E,0x48,0xD3,0x92,0xB5,0xD5,
+	0x66,0xAD,0x22,0x85,0x86,0xFA,0x5A,0x6B,0xC6,0xFD,0x2B,
+	0x26,0x4E,0xEE,0xD1,0x56,0x4C,0xAA,0xAB,0xAF,0xAF,0xF7,
+	0x68,0x45,0x49,0x9B,0x13,0x93,0x1B,0xA0,0x2B,0xAF,0xA5,
+	0xEB,0xDE,0x71,0x34,0x10,0xB7,0x77,0x27,0x7A,0xA2,0x8D,
+	0x49,0xD1,0xE4,0xE8,0x6A,0x73,0xB4,0x22,0x25,0x5A,0x9B,
+	0x16,0x6D,0xCD,0x88,0xDE,0x35,0xD1,0xD3,0xFD,0x2E,0xDC,
+	0x66,0x7D,0xC2,0xFA,0x58,0x12,0xA1,0x2F,0x10,0x84,0x4C,
+	0xAD,0x26,0xFC,0x0D,0x69,0xDD,0x0D,0x19,0x5A,0xE2,0xB6,
+	0x3A,0xC2,0x34,0x5D,0xBC,0x7C,0x70,0xA4,0x69,0xE1,0x89,
+	0xDA,0x9D,0x93,0xEE,0x2F,0xCA,0x10,0x61,0x53,0xEE,0x2F,
+	0x32,0x6F,0x2E,0x9A,0xBA,0xD9,0xC5,0x37,0x37,0x5E,0xB3,
+	0xE1,0x40,0x4A,0xB2,0x75,0xBB,0xF5,0x49,0xA7,0x3E,0x41,
+	0xB4,0xCB,0xBC,0xB4,0xAB,0x43,0x3E,0x33,0xDA,0x1F,0x0F,
+	0x4F,0x89,0x26,0x46,0x6F,0x4A,0x89,0x3A,0xD2,0xA2,0xE1,
+	0x89,0xD1,0x3B,0x27,0x45,0x1B,0x33,0xBA,0x8B,0xA6,0x76,
+	0xBB,0x78,0x77,0xE3,0x35,0xD1,0x7A,0xF3,0x34,0x40,0x06,
+	0x68,0x02,0x4C,0x80,0xD7,0xB6,0x00,0x9A,0x01,0x2D,0x80,
+	0x49,0x80,0xC9,0x80,0x29,0x80,0xE3,0x00,0x53,0x01,0xC7,
+	0x03,0xA6,0x01,0xA6,0x03,0x5E,0x06,0x68,0x05,0xCC,0x00,
+	0xBC,0x5C,0x4C,0x0D,0xC3,0x09,0x80,0x13,0x01,0xAF,0x00,
+	0xBC,0x12,0xF0,0x2A,0xC0,0x49,0x80,0x93,0x01,0xFF,0x02,
+	0xF0,0xEB,0x80,0x53,0x00,0xAF,0x06,0x9C,0x0A,0x48,0xF8,
+	0x39,0x60,0x26,0xE0,0x35,0x80,0xDF,0x00,0x9C,0x0E,0x98,
+	0x05,0x38,0x03,0xF0,0x2F,0x01,0x67,0x02,0xCE,0x02,0xFC,
+	0x26,0xE0,0xB5,0x80,0xB3,0x01,0xE7,0x00,0xCE,0x05,0x9C,
+	0x07,0x98,0x0D,0x98,0x03,0x38,0x1F,0x30,0x17,0x30,0x0F,
+	0x70,0x01,0xE0,0x42,0xC0,0xEB,0x00,0x17,0x01,0x5E,0x0F,
+	0x98,0x0F,0x78,0x03,0xE0,0x62,0xC0,0x02,0xC0,0x6F,0x01,
+	0x2E,0x01,0x5C,0x0A,0x58,0x08,0xB8,0x0C,0xB0,0x08,0xB0,
+	0x18,0xD0,0x06,0xB8,0x1C,0x70,0x05,0xE0,0x4A,0xC0,0x12,
+	0xC0,0x1B,0x01,0x6F,0x02,0x2C,0x05,0x2C,0x03,0x2C,0x07,
+	0xAC,0x00,0xB4,0x03,0xDE,0x0C,0x58,0x09,0xE8,0x00,0xAC,
+	0x02,0xAC,0x06,0xAC,0x01,0xAC,0x05,0xAC,0x03,0xBC,0x05,
+	0x70,0x15,0x60,0x3D,0xE0,0x5F,0x01,0x36,0x00,0xDE,0x0A,
+	0xB8,0x1A,0xF0,0x36,0x40,0x27,0xE0,0x1A,0x40,0x17,0xA0,
+	0x1B,0x50,0x01,0xF4,0x00,0xAE,0x05,0xF4,0x02,0xFA,0x00,
+	0x6F,0x07,0x6C,0x04,0xF4,0x03,0x36,0x01,0x06,0x00,0x83,
+	0x80,0xCD,0x80,0x77,0x00,0x86,0x00,0xC3,0x80,0x2A,0x60,
+	0x04,0xB0,0x05,0xB0,0x15,0xB0,0x0D,0xB0,0x1D,0xF0,0xDB,
+	0x80,0x77,0x02,0xAE,0x03,0x5C,0x0F,0xF8,0x1D,0xC0,0xBB,
+	0x00,0x3B,0x00,0xEF,0x06,0xFC,0x2E,0xE0,0x06,0xC0,0x7B,
+	0x00,0x37,0x02,0xDE,0x0B,0x78,0x1F,0x60,0x27,0xA0,0x06,
+	0xB8,0x09,0x30,0x0A,0xB8,0x19,0xB0,0x0B,0xB0,0x1B,0xF0,
+	0x7E,0x40,0x2A,0xA6,0xEF,0x01,0x3E,0x00,0xF8,0xD7,0x80,
+	0x0F,0x02,0x7E,0x1F,0xF0,0x6F,0x00,0x1F,0x02,0x7C,0x18,
+	0x70,0x2B,0xE0,0x23,0x80,0x7F,0x0B,0xB8,0x0D,0xF0,0x51,
+	0xC0,0xBF,0x03,0xFC,0x7B,0xC0,0xC7,0x00,0xB7,0x03,0xEE,
+	0x00,0xDC,0x09,0xB8,0x0B,0xF0,0x71,0xC0,0x7F,0x00,0xFC,
+	0x47,0xC0,0x27,0x00,0x9F,0x04,0x7C,0x0A,0xF0,0x9F,0x00,
+	0xFF,0x19,0xF0,0x07,0x80,0xFF,0x02,0xF8,0xAF,0x80,0xBB,
+	0x01,0x9F,0x06,0x7C,0x06,0xF0,0x59,0xC0,0xE7,0x00,0x9F,
+	0x07,0xFC,0x21,0xE0,0x1E,0xC0,0xBD,0x80,0x2F,0x00,0xBE,
+	0x08,0xF8,0x12,0xE0,0x3E,0xC0,0x1F,0x01,0xFE,0x18,0xF0,
+	0x27,0x80,0x3D,0x80,0xBD,0x80,0xFB,0x01,0x01,0xF0,0x00,
+	0xE0,0xBF,0x01,0xFE,0x14,0xB0,0x0F,0xF0,0x20,0xE0,0xCB,
+	0x80,0xAF,0x00,0xBE,0x0A,0xF8,0x1A,0x20,0x02,0xFE,0x0C,
+	0xF0,0x75,0xC0,0x43,0x80,0x6F,0x00,0x1E,0x06,0x7C,0x13,
+	0xF0,0x08,0xE0,0x5B,0x80,0xFF,0x0E,0xF8,0x36,0xE0,0x51,
+	0xC0,0x9F,0x03,0xF6,0x03,0x1E,0x03,0x7C,0x07,0xF0,0x5D,
+	0xC0,0x5F,0x00,0xFE,0x12,0xF0,0x38,0xE0,0xAF,0x00,0xDF,
+	0x03,0x3C,0x01,0xF8,0x3E,0xE0,0x07,0x80,0x1F,0x02,0x7E,
+	0x04,0x18,0x03,0xFC,0x35,0xE0,0x6F,0x00,0x07,0x00,0x4F,
+	0x02,0x7E,0x0C,0xF8,0x09,0xE0,0x7F,0x00,0x7E,0x0A,0xF8,
+	0x5B,0xC0,0xDF,0x01,0xFE,0x1E,0xF0,0x33,0xC0,0xFF,0x04,
+	0x3C,0x05,0xF8,0x5F,0x80,0x83,0x80,0xA7,0x01,0xCF,0x00,
+	0x7E,0x0E,0x78,0x16,0xF0,0x0B,0xC0,0x2F,0x01,0xE3,0x30,
+	0xDA,0xDE,0xDC,0x70,0x32,0x25,0x5A,0x70,0x50,0x8C,0x99,
+	0xE2,0x11,0xC7,0x50,0xD7,0x57,0x9F,0xFD,0xBE,0xF6,0x61,
+	0xE7,0xF4,0xE9,0x9D,0xEE,0xE9,0xA6,0xEC,0x9E,0xCD,0xFD,
+	0x62,0xF6,0x4A,0x02,0x79,0xCC,0x53,0x3D,0xDD,0xFD,0x64,
+	0x58,0x9A,0x31,0xA7,0x73,0x46,0xE7,0x72,0x93,0x47,0xBB,
+	0x35,0xA1,0xB3,0xDC,0xDC,0xD9,0x62,0xE9,0xAC,0x49,0x9A,
+	0x96,0xD3,0x63,0xFD,0x21,0x99,0x20,0x9B,0x68,0x20,0xF3,
+	0xE9,0xC6,0x9E,0xEF,0x64,0xCA,0x89,0x9A,0xDA,0xA0,0x26,
+	0xD1,0x53,0x83,0xD5,0x35,0xAE,0x67,0xEF,0xBD,0x57,0xE2,
+	0x3C,0xF1,0x81,0xE0,0x91,0x9F,0xC8,0xF7,0x0C,0xE7,0x27,
+	0x18,0x6D,0x5F,0x6A,0x94,0x9C,0x15,0x93,0x36,0x3F,0xFC,
+	0xC6,0x2B,0xA7,0xF6,0x77,0x8C,0x1E,0xCE,0x52,0xFC,0xAC,
+	0xFD,0x34,0x78,0xB1,0xAC,0x9B,0x68,0x2C,0x90,0x58,0x1A,
+	0x7B,0xF1,0xC6,0x78,0xBC,0x1E,0x1C,0x95,0x2F,0x99,0x4C,
+	0xE2,0x75,0x59,0xCE,0xE1,0x9D,0xE2,0xA5,0xED,0xCE,0xD7,
+	0xC4,0x84,0x48,0x91,0x2C,0xB6,0x95,0x12,0xAC,0x12,0x33,
+	0xC9,0x2A,0x93,0xAC,0x8F,0x89,0x71,0xDB,0x6D,0x1B,0x06,
+	0xBF,0x54,0xEB,0x37,0x0C,0x7E,0x11,0x49,0x8D,0x1D,0x10,
+	0x5F,0xBF,0x9E,0x94,0x13,0x49,0xCF,0x46,0x16,0xC7,0x9E,
+	0x17,0x8B,0x42,0xC5,0x02,0xB3,0xBD,0x62,0x3D,0x64,0xAC,
+	0x5B,0x78,0xC5,0x4E,0x26,0x7B,0x8F,0x0B,0xAF,0xB0,0x7F,
+	0xFA,0x2C,0x02,0xBD,0x49,0xEE,0xAE,0x2D,0x9E,0xB1,0x2B,
+	0x91,0x06,0x11,0x5E,0xA6,0xFF,0xD8,0x5C,0x5F,0x3B,0xBD,
+	0x3A,0xE6,0x14,0x42,0x78,0x53,0xEB,0xED,0xDE,0x2F,0xD7,
+	0xE9,0x58,0x3C,0x1B,0x8F,0xA9,0x2B,0x62,0x75,0x94,0xBD,
+	0xFB,0x84,0xC7,0x2D,0x3E,0xAF,0xA7,0x8E,0xE0,0xD1,0xDE,
+	0x30,0xBE,0xB8,0xCF,0xB0,0xEE,0xB9,0x7C,0xC6,0x26,0x53,
+	0xEF,0x99,0x14,0xB9,0xCB,0xCE,0xE1,0xC2,0xC2,0x58,0xBA,
+	0xE8,0x37,0x8F,0xC7,0xC4,0xAE,0x2A,0xD6,0x3D,0x3D,0x92,
+	0x29,0x92,0xF8,0xF6,0xE4,0x55,0x72,0x6A,0x5C,0xED,0xC1,
+	0x66,0xC6,0x8C,0x97,0x2F,0xD6,0xEF,0x8A,0x59,0x34,0x8B,
+	0x53,0xAC,0xF7,0xAD,0x13,0x5F,0xB5,0xC5,0xAA,0xE9,0x2E,
+	0xDB,0x71,0xB2,0xBB,0x1F,0x29,0x89,0xC7,0x5F,0x9A,0x22,
+	0xBD,0x07,0xC8,0x1B,0x15,0x5E,0x39,0x75,0xDA,0xF6,0x19,
+	0x79,0xD7,0x91,0xB7,0xCF,0xF6,0x1B,0xE6,0x92,0xFB,0xC1,
+	0x1C,0xCF,0x64,0x7D,0xB6,0x03,0x97,0x67,0xC9,0xBC,0x5D,
+	0x0D,0x9F,0x6D,0xEE,0xD7,0x6C,0x87,0x28,0x9F,0x47,0xAB,
+	0x3E,0xD3,0x55,0x7D,0x20,0x36,0x37,0x41,0x8C,0x6F,0xDE,
+	0x93,0x13,0xDE,0x1B,0x89,0x20,0xEB,0x9E,0xEA,0x23,0xBD,
+	0xC7,0xCD,0xA6,0x43,0x9E,0xE8,0x15,0xF7,0x5C,0xC1,0xD8,
+	0xCB,0xAB,0x87,0x5F,0x51,0x98,0x22,0x37,0xBE,0x94,0x27,
+	0x1F,0xB3,0x25,0xE7,0x70,0xD7,0xFA,0x2D,0xB1,0xAF,0x95,
+	0x88,0xDF,0xC6,0x67,0xC7,0x37,0xF7,0x3F,0x9B,0x29,0xF6,
+	0xC7,0xA6,0x27,0x52,0xBF,0xBD,0x9F,0xCA,0x3A,0x11,0x73,
+	0x92,0x27,0xF7,0x9C,0xB2,0xED,0x36,0x45,0xAE,0xB4,0xEE,
+	0xB1,0x3D,0x47,0x18,0x0D,0x7C,0x89,0xB6,0x07,0x25,0x4A,
+	0xB1,0x88,0x58,0xDE,0xE8,0xCB,0xB5,0x0E,0xB6,0x19,0x6C,
+	0xE7,0x9C,0x12,0x8C,0xBF,0x65,0x30,0x2E,0x3E,0xA2,0x1A,
+	0x9C,0xEE,0x23,0xD6,0xB6,0xAF,0x1C,0xE6,0xF4,0x24,0x79,
+	0x1F,0x58,0x29,0x38,0xED,0x91,0xFF,0x9D,0x6E,0x38,0xD9,
+	0x55,0xBD,0x8F,0x52,0xF5,0xD9,0xF6,0xF5,0x10,0xB3,0xB1,
+	0x1A,0xD3,0xB0,0xC8,0x8E,0xE6,0x1C,0x8E,0x96,0xED,0x8B,
+	0xB9,0x65,0xEA,0xF7,0x4C,0x8A,0xB4,0x1E,0xC4,0x46,0x2C,
+	0x07,0x92,0xF5,0x3D,0x73,0x8E,0x0A,0x19,0xED,0x93,0x32,
+	0x6A,0x38,0xA9,0xD9,0x3E,0xD4,0x6C,0x3D,0x62,0x88,0x5B,
+	0xF6,0x8E,0x14,0xD5,0x51,0x21,0xB2,0x83,0x84,0x9A,0x44,
+	0xF6,0x3B,0x7A,0x48,0xEC,0x73,0x26,0xF7,0xCA,0xEE,0x8F,
+	0xAB,0x97,0x5B,0xF7,0xFC,0xB6,0xDB,0x22,0xD8,0xEA,0xFD,
+	0xD0,0xEC,0x99,0x11,0x6D,0xB1,0x10,0x02,0x31,0x51,0xBC,
+	0x7A,0x9F,0x66,0x3B,0xA0,0x53,0xD3,0x2B,0xA8,0x11,0x2B,
+	0xC7,0x7F,0xBD,0x43,0x2E,0x3E,0x32,0x0C,0x4E,0xB1,0xA0,
+	0x4C,0x4E,0x76,0xEC,0x5A,0xDF,0x49,0x02,0x23,0x7B,0x33,
+	0x9C,0xE8,0xB9,0xF6,0xB0,0xE7,0x01,0xFD,0xF5,0x93,0x14,
+	0xB4,0x66,0x1B,0xA4,0x41,0x60,0xCE,0x61,0xCD,0x76,0xB6,
+	0xCB,0xD6,0x99,0xF3,0x72,0x6C,0xFB,0x0A,0xC1,0xC2,0x2E,
+	0xC1,0x42,0x9F,0xED,0x61,0x9D,0x09,0xB1,0x96,0x87,0x2E,
+	0xDB,0x84,0x6F,0x73,0x7F,0x4E,0x4F,0x76,0x5C,0xB3,0x75,
+	0x46,0x6D,0x83,0xCF,0x66,0x7A,0x34,0xDB,0x53,0xE7,0x95,
+	0xC7,0x13,0xA6,0xC8,0x44,0x2A,0x8F,0x41,0x2A,0x0F,0x9D,
+	0xEE,0xAE,0x66,0x0B,0xD1,0xBD,0x30,0x5A,0x7D,0xD6,0xB3,
+	0xD7,0x24,0x8D,0x5E,0xED,0xD3,0x97,0x93,0x87,0x5B,0x70,
+	0xF8,0x32,0xF9,0xE5,0xD1,0x1E,0xEB,0x3B,0x15,0x8F,0xD7,
+	0x0D,0x24,0x5C,0xDB,0x03,0xFA,0xF7,0x8A,0xB7,0xB4,0x3E,
+	0x69,0x57,0x5C,0xC2,0x36,0xE8,0x7E,0x97,0x0C,0x90,0xA9,
+	0xB5,0xDA,0x07,0x97,0x30,0x37,0x46,0x2C,0x8D,0xAF,0xF7,
+	0x24,0x37,0x68,0xFB,0xA3,0x0D,0xC4,0xEC,0x24,0xED,0x68,
+	0x6C,0xC9,0x29,0xB1,0x39,0x05,0x1B,0xBD,0xA0,0xD1,0x21,
+	0x36,0xCE,0x15,0x52,0x4B,0x14,0x2F,0x8A,0xF4,0xB7,0x3A,
+	0xA5,0x23,0x4B,0x4E,0x2C,0x64,0x68,0xB7,0x14,0xEB,0x2B,
+	0x56,0xEE,0x39,0xA6,0xE6,0x77,0x7C,0x3E,0xEA,0x85,0xD2,
+	0x75,0x9B,0xE6,0xC8,0x74,0x5F,0x8C,0x53,0x67,0x77,0x7C,
+	0x61,0x8A,0xA4,0xE4,0xCF,0x11,0x11,0xEA,0x74,0x2A,0xDF,
+	0x9D,0x82,0x7F,0xA9,0xCA,0xB6,0xBF,0x22,0x5E,0x89,0x7E,
+	0x42,0x66,0x67,0xF6,0xFB,0xD3,0x13,0xD3,0xF2,0x06,0x4E,
+	0xD0,0xED,0xC0,0x2F,0xE4,0x3A,0x6F,0x12,0x1E,0xA3,0xF1,
+	0x77,0xF4,0x10,0x0D,0xC1,0xF5,0xA2,0xD1,0x7A,0xC9,0xCA,
+	0xB5,0xCA,0x35,0x98,0x7B,0x0F,0x8A,0x41,0xDD,0xF8,0xB7,
+	0xE4,0xB2,0x73,0x2B,0xD3,0x5E,0xF5,0x68,0xE9,0x02,0x2B,
+	0xA5,0x92,0xC3,0xF8,0x57,0x44,0xBE,0xBD,0x29,0x4C,0x0E,
+	0xE0,0x85,0xAE,0xDC,0xA2,0x67,0xFB,0x44,0x64,0x3B,0x72,
+	0x44,0xD8,0x86,0xD4,0x00,0xF4,0xE6,0x2E,0x88,0xB3,0x48,
+	0xE2,0x12,0x88,0xA4,0xE8,0xD5,0x12,0x0F,0x69,0x1F,0xCC,
+	0xA9,0xBF,0xD8,0xFA,0xA7,0x98,0x28,0x76,0xC3,0xFA,0x3D,
+	0x76,0xC2,0xD3,0x67,0xE9,0x4F,0x27,0x6E,0x56,0xBD,0x5B,
+	0x20,0xAE,0x9E,0x0D,0xF2,0xC2,0x22,0x57,0xFF,0x5C,0xF7,
+	0x6F,0x97,0xE7,0xAC,0x25,0x19,0x9E,0x0D,0x83,0x4B,0xC4,
+	0x8E,0xEC,0x47,0xC9,0x9F,0xB0,0xAD,0x8E,0xCE,0x66,0x66,
+	0x7F,0x74,0x5B,0xDD,0x93,0xE2,0x26,0x92,0x24,0xF7,0xD2,
+	0x22,0x5B,0x2C,0xFE,0xCB,0xB8,0x11,0xCA,0x59,0xA4,0x21,
+	0x5D,0x5C,0x86,0xFD,0x6A,0x99,0x9E,0xDD,0x44,0x6A,0x6B,
+	0xC7,0x8F,0x77,0xD1,0x9D,0x36,0x55,0xAB,0x31,0x6B,0xE5,
+	0x29,0x3F,0x5D,0x9E,0xC6,0x76,0x1E,0x49,0x37,0xB6,0xF7,
+	0xA1,0xC8,0x5E,0x11,0x99,0xA4,0xDD,0x6A,0xD6,0x6A,0x52,
+	0xB4,0xF2,0x34,0xB2,0x8D,0x37,0x1C,0xB7,0x2E,0x36,0xAB,
+	0xA9,0x8B,0x2D,0x6A,0xD2,0xE2,0x24,0x35,0x61,0x77,0x92,
+	0xFE,0x62,0x01,0xEC,0x37,0x57,0xBE,0x30,0x59,0xA8,0xC4,
+	0xF9,0xF2,0x61,0xD6,0xEC,0x55,0xB7,0xD4,0x81,0x9D,0x58,
+	0xCD,0x39,0x46,0x23,0xB2,0x7E,0x49,0x97,0x75,0x87,0x76,
+	0xC5,0xD3,0x02,0x63,0xFA,0xF3,0xE2,0x7C,0xF5,0x0B,0x74,
+	0xDE,0xF9,0xA3,0x74,0x59,0x88,0x75,0x7F,0xBA,0xB5,0x44,
+	0x63,0x30,0x06,0x63,0x30,0x06,0x63,0x30,0x06,0x63,0x30,
+	0x06,0x63,0x30,0x06,0x63,0x30,0x06,0x63,0x30,0x06,0x7F,
+	0x0A,0x30,0x99,0x4C,0x2C,0x3B,0x67,0x7E,0x6E,0xDE,0x82,
+	0x85,0xD7,0x2D,0xBA,0xBE,0x70,0x59,0x51,0xB1,0x6D,0x39,
+	0xF3,0x2A,0x6D,0x4D,0x4A,0x13,0xAF,0x0F,0x36,0xCB,0x9F,
+	0xCC,0x35,0xA4,0xB2,0x80,0x87,0x05,0xD6,0x18,0xE1,0x73,
+	0x5D,0xCC,0x15,0x6C,0x6E,0x5F,0xED,0x76,0xAA,0xCE,0xD5,
+	0x6A,0x90,0xB9,0x9A,0xDB,0xF9,0xE2,0x02,0x3E,0xD3,0x17,
+	0x50,0x67,0x35,0x3B,0x43,0x4E,0x56,0x5C,0xE1,0xE0,0xAC,
+	0xB6,0xA4,0x9C,0xB3,0x22,0x7B,0x35,0x67,0xC5,0xF6,0xB2,
+	0x12,0xCE,0x56,0x96,0x94,0xD9,0xCA,0x38,0xB3,0x95,0xD1,
+	0xA9,0xB4,0xCA,0x4E,0xA7,0x52,0x19,0x50,0x5F,0x71,0x13,
+	0xE1,0xAF,0x75,0x86,0x02,0xBE,0xC0,0xDA,0x7C,0x5E,0xA6,
+	0x34,0x05,0x43,0xED,0x3C,0xEC,0x0D,0xB6,0x06,0xB8,0x2F,
+	0xCC,0x5B,0xBD,0x4E,0x95,0xD7,0xFA,0x02,0xEE,0x60,0x6B,
+	0x98,0xBB,0xBC,0xC1,0xB0,0x12,0xE6,0x6A,0x90,0x37,0x39,
+	0x1B,0x15,0xEE,0x6C,0x71,0xFA,0xFC,0xCE,0x35,0x7E,0x65,
+	0x6E,0x2A,0xE3,0x43,0x50,0xA2,0xF2,0x26,0xF9,0x3F,0xBC,
+	0x40,0x50,0xE5,0x21,0xC5,0xE3,0x57,0x5C,0x2A,0x77,0xBA,
+	0xD4,0x88,0xD3,0x6F,0xFC,0x3D,0x8F,0x37,0xC9,0x67,0x50,
+	0xA6,0x66,0x35,0xE4,0x72,0x86,0xD5,0x82,0x2C,0x37,0xF7,
+	0xF8,0x9D,0x6A,0x48,0x71,0xFA,0xC5,0xFD,0x1A,0x1F,0x3D,
+	0xA6,0x4D,0x04,0xA7,0xB2,0x76,0x25,0xCC,0x02,0x41,0x9D,
+	0xD8,0x7C,0x9E,0x15,0xE6,0x33,0xB3,0xC2,0xB3,0xB8,0xDF,
+	0xD7,0xE4,0x53,0x0B,0xB2,0xDB,0xB2,0xFC,0xFE,0xBA,0x54,
+	0x56,0xA9,0x38,0xDD,0xED,0xA9,0xEC,0xC6,0x48,0x53,0x33,
+	0xD1,0x96,0xCF,0xE5,0x77,0x38,0xE5,0x8E,0x88,0x2F,0x44,
+	0xC4,0x3A,0x79,0xDE,0xA2,0x85,0x3C,0x18,0xE2,0x5E,0xA2,
+	0x4A,0x09,0xF1,0xE6,0x50,0xD0,0xA5,0x84,0xC3,0xC1,0xD0,
+	0x48,0x12,0x92,0x52,0x49,0x31,0xAB,0x8C,0x04,0x54,0xF1,
+	0x8B,0x3F,0x25,0xD0,0xE2,0x0B,0x05,0x03,0x4D,0x4A,0x40,
+	0xE5,0xEE,0x20,0x45,0x0B,0x46,0x9A,0x95,0x10,0x3D,0x91,
+	0x37,0x06,0x82,0xAD,0x24,0x26,0xDE,0xEC,0x6D,0x0F,0xFB,
+	0x5C,0x4E,0xFF,0xE2,0x39,0xDF,0xF2,0xFB,0x02,0x8A,0x93,
+	0xD0,0x3A,0xD7,0x2A,0x5C,0x15,0xC2,0xE0,0x6A,0xC8,0x19,
+	0x08,0x13,0x3B,0x54,0x74,0x86,0x90,0x5D,0xCE,0x80,0x40,
+	0x12,0x24,0x2C,0x4E,0x55,0xE1,0x9E,0x50,0xB0,0x89,0xB7,
+	0xFA,0x54,0xAF,0x2F,0x30,0x24,0x5A,0x23,0x61,0x68,0x88,
+	0x24,0x55,0x88,0x5D,0xF5,0x2A,0x82,0x36,0x1E,0x8E,0x34,
+	0x37,0x07,0x43,0x2A,0xB7,0x3B,0x6C,0x82,0x11,0x7B,0xA1,
+	0x4D,0x96,0xE9,0xBC,0x9A,0x22,0x7B,0x09,0x0F,0x2B,0xA1,
+	0x16,0x62,0x8B,0x8A,0x2A,0x14,0x09,0x88,0x32,0xA4,0x6C,
+	0xE4,0x71,0x05,0xDD,0x8A,0x7C,0x86,0xA0,0x8C,0x42,0x67,
+	0x4B,0x36,0x08,0x69,0xA5,0x48,0x92,0xCD,0x72,0xE7,0xCF,
+	0x59,0x43,0x0C,0x8D,0x4A,0xC1,0x9D,0xFE,0x90,0x10,0x24,
+	0x09,0x40,0xB0,0xE1,0xE6,0x91,0x80,0x9B,0x10,0x8F,0x3C,
+	0x49,0x20,0xF0,0x35,0x35,0xFB,0x15,0x21,0x1A,0xC5,0xFD,
+	0xBF,0xA0,0x21,0x18,0x51,0x87,0xC9,0x58,0x13,0x51,0xCF,
+	0x23,0xC5,0xEF,0xA7,0x0A,0x41,0x95,0x38,0x9F,0xC2,0x8D,
+	0xBA,0x31,0x52,0xB5,0xF8,0xCC,0xF9,0xD9,0x37,0x2D,0xE3,
+	0x01,0x45,0x71,0x2B,0xEE,0x59,0xDC,0x43,0xFC,0xCF,0x2F,
+	0x13,0x22,0x18,0x25,0xF1,0xFF,0x09,0x43,0xDE,0x79,0x08,
+	0xF2,0xCA,0xA4,0x28,0x2F,0x8D,0x80,0x28,0x76,0x87,0x47,
+	0x30,0x88,0xFA,0x94,0xE5,0x0D,0xCF,0xE6,0x9E,0x48,0xC0,
+	0x25,0x8A,0x95,0xEB,0x3E,0x1F,0x21,0x97,0x77,0xA2,0x0E,
+	0xF0,0x2C,0x37,0xD5,0xE8,0xC2,0x30,0xC9,0x42,0x26,0x59,
+	0x4E,0x99,0x49,0x48,0x54,0x1B,0x33,0x97,0x55,0xDA,0x0A,
+	0x6F,0xAA,0xB4,0x55,0x55,0x57,0x96,0xF3,0xAC,0x5C,0x37,
+	0x2B,0x0F,0x06,0x14,0x51,0x69,0xFD,0xCC,0xA1,0x3A,0x03,
+	0x6E,0x67,0xC8,0xCD,0x6C,0x01,0xAF,0x33,0xE0,0xA2,0xF4,
+	0xE5,0x55,0xAC,0xC2,0x31,0x6F,0x3E,0x5B,0x56,0x52,0xE1,
+	0xA0,0xBC,0x35,0xBE,0x90,0x68,0x39,0xCB,0x82,0x6D,0x9C,
+	0x2D,0x2F,0xAC,0x2A,0x2C,0xCD,0x97,0x05,0x42,0x65,0xA5,
+	0x2A,0xA1,0x80,0xA8,0x4C,0x54,0x0B,0xFD,0xF9,0x43,0x35,
+	0x8C,0xEE,0x83,0xAE,0x54,0x56,0x52,0x5E,0xC5,0xE7,0xE7,
+	0x78,0x79,0xE1,0xCA,0x82,0xDC,0x6C,0xEF,0x88,0xB7,0xAE,
+	0x20,0x37,0x37,0x7B,0xA1,0x97,0x15,0x2B,0xEE,0x88,0xCB,
+	0xA8,0x87,0x42,0x59,0x50,0xE1,0x85,0x45,0x6D,0x95,0x09,
+	0x97,0xCB,0x84,0x39,0x0B,0xB3,0x0B,0xBD,0xA3,0x03,0xF2,
+	0x16,0x2E,0xCA,0xF6,0x9E,0x97,0x82,0x02,0x88,0xE1,0x48,
+	0x93,0x28,0xC7,0xF3,0x91,0xF1,0x40,0xA4,0x69,0x8D,0x12,
+	0x62,0x2B,0x14,0xB5,0x46,0x0F,0xB1,0xB5,0xF1,0xFA,0xF2,
+	0xAA,0x9A,0xE2,0xB2,0xB9,0xB6,0x3A,0x1B,0xBF,0x56,0x24,
+	0x2E,0xAF,0x2A,0x74,0x54,0xCD,0xAD,0x29,0x2E,0x6E,0x60,
+	0x8E,0x22,0xE6,0x28,0x66,0xE5,0xD5,0xA5,0x52,0x8B,0x30,
+	0xC7,0xB2,0x0A,0x07,0xAB,0x2E,0xAD,0xAA,0x2C,0x2C,0xA3,
+	0xB6,0x49,0xCA,0xCC,0xC6,0x67,0xD6,0x0A,0x31,0x97,0x84,
+	0x79,0xB9,0xE0,0x34,0xC0,0x6D,0x4D,0x11,0x6A,0x65,0xC1,
+	0xD0,0x2C,0xB6,0x84,0x8D,0xC6,0xC5,0x8A,0x7D,0xE1,0x66,
+	0xA7,0xEA,0x22,0x6A,0x03,0x3E,0xF5,0x9C,0xA8,0x78,0x9C,
+	0x95,0x39,0xE6,0x50,0x08,0x5B,0x1E,0x52,0x14,0x71,0x5D,
+	0x94,0xBD,0x68,0x21,0xCB,0x21,0x37,0x9F,0x5C,0x2E,0x39,
+	0xD2,0x16,0x6C,0x01,0xB9,0x85,0xE4,0xF4,0x92,0x2A,0x0F,
+	0xEA,0x1A,0x62,0x54,0x85,0xD0,0xFD,0xD4,0x74,0x49,0x09,
+	0xA8,0xD4,0x5C,0x1D,0x54,0x9D,0x7C,0x86,0xA6,0xA0,0xE6,
+	0x4B,0xED,0x83,0xAD,0x0C,0x06,0x1B,0xB9,0x10,0xD7,0x42,
+	0xEF,0x6C,0xAE,0xB4,0x29,0xAE,0x08,0x15,0x96,0x48,0x47,
+	0xDA,0x33,0xAC,0x28,0xDC,0xE7,0xE1,0xD4,0xFE,0x5C,0xCE,
+	0x48,0x58,0x2A,0x29,0x8F,0x33,0xE2,0x57,0x79,0xBD,0x4E,
+	0x1D,0x49,0x43,0x47,0xE8,0x8A,0x84,0x42,0x84,0xCC,0xDF,
+	0xCE,0xDD,0xBE,0xB0,0x6C,0x95,0xA2,0x1D,0xAF,0x09,0x52,
+	0x2B,0xF5,0x3A,0xC3,0xC3,0x2D,0x95,0x10,0xB5,0x2B,0x2A,
+	0xF1,0x42,0x0C,0xF0,0xB2,0x8A,0x1A,0x5E,0x54,0x99,0xF7,
+	0x15,0x70,0xB1,0x42,0x95,0xD4,0x31,0xF5,0x31,0xA2,0xC1,
+	0x06,0x79,0x6B,0xC8,0x47,0x24,0x8A,0xAC,0x1E,0xBD,0xEE,
+	0x52,0x5F,0x51,0x47,0x90,0x2D,0x6E,0x6E,0x96,0x37,0x59,
+	0xE1,0x99,0x59,0x91,0x59,0xBC,0xD8,0x31,0x33,0xAB,0x6E,
+	0x16,0xCF,0x2C,0xE0,0x36,0x79,0x97,0xCA,0x94,0x26,0xD1,
+	0x2D,0x89,0xF9,0x48,0x2B,0x0A,0x0B,0xB2,0x22,0xDC,0xA6,
+	0x5F,0x8A,0xF4,0x4B,0x59,0xB1,0x7E,0x31,0xBC,0x2B,0x57,
+	0x14,0xD1,0x45,0x62,0xAA,0xA2,0xFA,0xDF,0x3E,0xCF,0x5E,
+	0x74,0x7B,0x48,0x44,0x14,0x36,0x85,0x49,0x79,0xBA,0xE9,
+	0x56,0x74,0x28,0xB9,0x6D,0xD9,0xBC,0x64,0x5E,0x05,0x17,
+	0xBF,0x54,0xE5,0x05,0x9C,0xB4,0x7D,0x76,0x6E,0x1B,0xE7,
+	0x54,0x23,0xF8,0x52,0xE9,0x5B,0xE0,0x6F,0x9B,0x63,0x5C,
+	0x39,0x2F,0x2C,0xB5,0xAF,0x94,0xD8,0xAF,0xAF,0x35,0xF2,
+	0xB3,0x5B,0x18,0x89,0x96,0xB3,0x72,0x16,0xE4,0xB2,0x4F,
+	0x10,0xF5,0x46,0x09,0x04,0x23,0x6B,0xBD,0x43,0x4A,0x82,
+	0xB8,0x96,0x4D,0x46,0x6A,0x65,0xD1,0x9C,0xE9,0xF9,0x11,
+	0xEA,0xAB,0xA8,0x0C,0x29,0xBD,0xE8,0x49,0x0A,0x97,0x95,
+	0x57,0x54,0x96,0x15,0x96,0xF2,0x2A,0x5B,0x65,0x59,0x49,
+	0x79,0x61,0x55,0x49,0x85,0xD8,0x99,0x9E,0x15,0x97,0x96,
+	0xCA,0xE2,0xF6,0x04,0x49,0x4D,0x0E,0xD7,0x38,0x1E,0x22,
+	0x55,0x27,0x6A,0xE9,0x48,0x94,0xA8,0x83,0x17,0x09,0xBE,
+	0x80,0x16,0x4A,0x48,0x4D,0xDA,0xE3,0x74,0xE9,0xA9,0x46,
+	0xEA,0xDA,0x12,0x66,0xAB,0xAC,0xAC,0xA8,0xCC,0xE7,0x46,
+	0x69,0x09,0xA2,0x45,0xA3,0xE7,0x23,0x6D,0xC9,0x3D,0xF4,
+	0x78,0x19,0x4E,0xF1,0xA2,0x27,0xE5,0x4D,0xA3,0xD5,0xAF,
+	0xC1,0xA6,0x6C,0xA9,0xBE,0x50,0x58,0xCD,0x4C,0x65,0x6C,
+	0xB9,0x3F,0x28,0x43,0xE6,0x34,0x07,0xC9,0x76,0x18,0xEE,
+	0x66,0xC4,0xE3,0x29,0x86,0xD4,0x25,0xF1,0x39,0x62,0x9B,
+	0x38,0xD7,0xB8,0xDC,0x8A,0x67,0xAD,0xD7,0x77,0x7B,0xA3,
+	0xBF,0x29,0x10,0x6C,0xBE,0x83,0xB0,0x44,0x5A,0x5A,0xDB,
+	0xDA,0xBF,0x2D,0xE4,0x51,0x1D,0xD0,0xFB,0xBE,0x51,0x02,
+	0x1D,0x21,0x22,0xAC,0x08,0x2B,0x80,0xBA,0xDC,0x91,0x54,
+	0x61,0x45,0xD5,0x7B,0x71,0x1E,0xF4,0x5C,0x2C,0x25,0x13,
+	0x3B,0xCB,0xDE,0x41,0xEE,0x2A,0x31,0xD5,0xC5,0x70,0xA6,
+	0x21,0x48,0x14,0x60,0xBA,0x00,0x52,0xD3,0xCE,0x85,0x45,
+	0xC3,0x60,0x04,0xD4,0x49,0x58,0x79,0x11,0xD0,0xE3,0x1F,
+	0x96,0xD0,0x79,0x11,0x10,0xB1,0xA6,0x3F,0x03,0x7B,0xD1,
+	0x7C,0x31,0x1B,0xF2,0x92,0xA9,0x13,0x2E,0x19,0x9B,0x60,
+	0xB8,0x0B,0x21,0xD1,0x70,0x17,0xCF,0x63,0x1E,0x33,0xD9,
+	0xFF,0xCC,0x06,0x10,0x7F,0x3C,0xD4,0x71,0x76,0xDE,0xE4,
+	0x62,0x82,0xCF,0xA8,0x6A,0x9C,0x26,0xF7,0x25,0xB9,0x64,
+	0xAA,0x0C,0x19,0xE4,0x26,0x5C,0xA4,0x52,0x5C,0x98,0x73,
+	0x08,0xCE,0x6E,0x3E,0xD4,0x7D,0xB4,0xBB,0x47,0xFB,0xA0,
+	0xAB,0x25,0x69,0xC3,0x49,0xFE,0x42,0x06,0xD3,0x3E,0xFA,
+	0xFD,0xE3,0xFF,0x57,0x5A,0x27,0x11,0x0D,0xD3,0xCC,0x82,
+	0xE6,0xFF,0x67,0x18,0x45,0x40,0x87,0x85,0xB1,0x8D,0x62,
+	0x56,0x35,0xB9,0x2E,0x72,0xDF,0x23,0x27,0xF6,0x53,0xD9,
+	0x6A,0xF9,0xCA,0x28,0x86,0x61,0x5B,0x12,0x63,0x8F,0x27,
+	0x5D,0x2A,0x47,0xB2,0x7D,0xF2,0x25,0x62,0xEC,0xE7,0x94,
+	0xC9,0x48,0xA9,0x2C,0x98,0x33,0x37,0xB9,0x3E,0xA1,0xB6,
+	0x36,0x81,0xCA,0xD1,0x69,0xAF,0xB4,0x4E,0x4E,0x9A,0x3C,
+	0x39,0x21,0x3D,0x3D,0xED,0xE8,0x37,0x3A,0x4C,0x8E,0x99,
+	0xBB,0x2F,0x59,0xAB,0xE2,0x3A,0xDC,0x55,0x6D,0x80,0xE1,
+	0x5F,0x92,0x6B,0xC0,0x53,0x3A,0x7C,0xF3,0x81,0xE9,0x25,
+	0xF2,0x30,0xE2,0xA7,0xDD,0x31,0xA5,0x4F,0x1E,0x5B,0x75,
+	0x98,0xFC,0x86,0xED,0xAA,0x06,0x95,0x4E,0x06,0x9A,0x2B,
+	0x9E,0x9E,0x70,0x83,0x3C,0xF4,0x5C,0x25,0x5F,0xBB,0xDC,
+	0x00,0x23,0xBF,0x75,0x08,0x16,0x75,0x9F,0x10,0xC7,0x65,
+	0x0B,0x1E,0x7C,0xDB,0x7E,0x6B,0x51,0x7B,0xFA,0x6B,0x3A,
+	0xA4,0x65,0xA7,0x81,0x3C,0x62,0x3B,0xA2,0x73,0x5F,0x8C,
+	0xED,0x18,0x7F,0xE5,0x33,0x5B,0x36,0xCE,0x76,0x67,0x8E,
+	0x37,0xE8,0x49,0x6D,0x2E,0x48,0x7D,0x7B,0x27,0x9D,0x8E,
+	0x6A,0x8F,0x8A,0x63,0x5C,0xD6,0x73,0x0F,0x1D,0xBA,0x75,
+	0xD9,0x9D,0xE3,0x0C,0x32,0xC7,0xA5,0xBC,0x5A,0xD0,0xB5,
+	0xFB,0x9D,0x37,0x53,0x0C,0x75,0x9F,0x92,0xB1,0x2C,0x25,
+	0xF3,0x9E,0x0C,0xFD,0xEF,0xBA,0x04,0xC9,0x9F,0xF6,0x26,
+	0x4F,0x5B,0x47,0xA7,0xFB,0x74,0x48,0xB6,0x27,0x47,0xE4,
+	0x61,0xB0,0x95,0xCC,0x2F,0x2A,0x2D,0xB2,0xEF,0x5D,0x8D,
+	0xBC,0x82,0x4C,0x62,0x8F,0x3F,0xD8,0x9A,0xC9,0xF4,0xFF,
+	0xB7,0xFE,0x41,0x60,0xDC,0xF6,0x91,0xFB,0x1E,0xDD,0xED,
+	0xEE,0xD5,0x9D,0x2C,0x3C,0x31,0x63,0x62,0x9C,0xC9,0x34,
+	0x3E,0xC9,0x6C,0xB1,0x58,0x12,0x12,0xE3,0x97,0x25,0x4F,
+	0x4F,0x4A,0x31,0xC5,0x27,0x1A,0x2A,0x63,0x48,0xFF,0x27,
+	0x5E,0xB2,0x1F,0xF8,0xEA,0x30,0xF4,0xAF,0x6D,0x09,0x7C,
+	0xE9,0x83,0x74,0x4E,0xDD,0x22,0xE6,0xC7,0xF0,0x75,0x62,
+	0x06,0x33,0x97,0xEB,0x29,0x12,0x3E,0xFD,0x99,0xB8,0xB7,
+	0x8B,0xA9,0x32,0xBC,0x63,0x97,0x08,0x39,0xF4,0x3A,0x63,
+	0xFF,0x0D,0x83,0xA2,0xE0,0xCC,
 };
 
 struct BuiltinFileBlob bfb_HEXMEM32_EXE = {
 	/*recommended file name*/	"HEXMEM32.EXE",
 	/*data*/			bin_hexmem32_exe,
-	/*length*/			sizeof(bin_hexmem32_exe)
+	/*length*/			86612,
+	/*compressed length*/	sizeof(bin_hexmem32_exe)
 };
 
@@ -23,6 +23,7 @@
 	static uint32_t	add_mask;
 	static Bitu	count,count_left;
 	static Bits	add_index;
+	bool block = false;
 
 	count_left=0;
 
@@ -63,7 +64,9 @@
 		try {
 			switch (inst.code.op) {
 				case R_OUTSB:
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,1u);
 						IO_WriteB(reg_dx,LoadMb(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -72,7 +75,9 @@
 					} while (count != 0); break;
 				case R_OUTSW:
 					add_index<<=1;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,2u);
 						IO_WriteW(reg_dx,LoadMw(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -81,7 +86,9 @@
 					} while (count != 0); break;
 				case R_OUTSD:
 					add_index<<=2;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,4u);
 						IO_WriteD(reg_dx,LoadMd(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -90,7 +97,9 @@
 					} while (count != 0); break;
 
 				case R_INSB:
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,1u);
 						SaveMb(di_base+di_index,IO_ReadB(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -99,7 +108,9 @@
 					} while (count != 0); break;
 				case R_INSW:
 					add_index<<=1;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,2u);
 						SaveMw(di_base+di_index,IO_ReadW(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -108,7 +119,9 @@
 					} while (count != 0); break;
 				case R_INSD:
 					add_index<<=2;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,4u);
 						SaveMd(di_base+di_index,IO_ReadD(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
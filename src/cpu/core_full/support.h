@@ -150,6 +150,21 @@ enum {
 	R_CMPSB,R_CMPSW,R_CMPSD
 };
 
+/* REP INS/OUTS on a port with a block handler: move whole page runs of plain RAM at once,
+ * whatever the block path leaves over goes through the per element loop below it. Like that
+ * loop it moves no more elements than there are cycles left, and one once they are used up */
+#define STRING_IO_BLOCK(blockfunc,index,base,size) \
+	if (block && count > 1 && ((index) + (count * (size)) - 1u) <= add_mask) { \
+		const Bitu n = blockfunc(reg_dx,(base)+(index),std::min<Bitu>(count,(Bitu)std::max<Bits>(CPU_Cycles,1)),size); \
+		if (n != 0) { \
+			index=(index+(n*(size))) & add_mask; \
+			count-=n; \
+			CPU_Cycles-=(Bits)n; \
+			if (count == 0 || CPU_Cycles <= 0) break; \
+			continue; \
+		} \
+	}
+
 enum {
 	M_None=0,
 	M_Ebx,M_Eb,M_Gb,M_EbGb,M_GbEb,
@@ -33,6 +33,21 @@ enum STRING_OP_NORMAL {
 
 #define LoadD(_BLAH) _BLAH
 
+/* REP INS/OUTS on a port with a block handler: move whole page runs of plain RAM at once,
+ * whatever the block path leaves over goes through the per element loop below it. Like that
+ * loop it moves no more elements than there are cycles left, and one once they are used up */
+#define STRING_IO_BLOCK(blockfunc,index,base,size) \
+	if (block && count > 1 && ((index) + (count * (size)) - 1u) <= add_mask) { \
+		const Bitu n = blockfunc(reg_dx,(base)+(index),std::min<Bitu>(count,(Bitu)std::max<Bits>(CPU_Cycles,1)),size); \
+		if (n != 0) { \
+			index=(index+(n*(size))) & add_mask; \
+			count-=n; \
+			CPU_Cycles-=(Bits)n; \
+			if (count == 0 || CPU_Cycles <= 0) break; \
+			continue; \
+		} \
+	}
+
 extern int cpu_rep_max;
 
 void DoString(STRING_OP_NORMAL type) {
@@ -41,6 +56,7 @@ void DoString(STRING_OP_NORMAL type) {
 	static uint32_t	add_mask;
 	static Bitu	count,count_left;
 	static Bits	add_index;
+	bool block = false;
 
 	count_left=0;
 	si_base=BaseDS;
@@ -99,7 +115,9 @@ void DoString(STRING_OP_NORMAL type) {
 		try {
 			switch (type) {
 				case R_OUTSB:
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,1u);
 						IO_WriteB(reg_dx,LoadMb(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -108,7 +126,9 @@ void DoString(STRING_OP_NORMAL type) {
 					} while (count != 0); break;
 				case R_OUTSW:
 					add_index<<=1;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,2u);
 						IO_WriteW(reg_dx,LoadMw(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -117,7 +137,9 @@ void DoString(STRING_OP_NORMAL type) {
 					} while (count != 0); break;
 				case R_OUTSD:
 					add_index<<=2;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_WriteBlockFromMem,si_index,si_base,4u);
 						IO_WriteD(reg_dx,LoadMd(si_base+si_index));
 						si_index=(si_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -126,7 +148,9 @@ void DoString(STRING_OP_NORMAL type) {
 					} while (count != 0); break;
 
 				case R_INSB:
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,1u);
 						SaveMb(di_base+di_index,IO_ReadB(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -135,7 +159,9 @@ void DoString(STRING_OP_NORMAL type) {
 					} while (count != 0); break;
 				case R_INSW:
 					add_index<<=1;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,2u);
 						SaveMw(di_base+di_index,IO_ReadW(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
@@ -144,7 +170,9 @@ void DoString(STRING_OP_NORMAL type) {
 					} while (count != 0); break;
 				case R_INSD:
 					add_index<<=2;
+					block = add_index > 0 && count > 1 && IO_HasBlockHandler(reg_dx);
 					do {
+						STRING_IO_BLOCK(IO_ReadBlockToMem,di_index,di_base,4u);
 						SaveMd(di_base+di_index,IO_ReadD(reg_dx));
 						di_index=(di_index+(Bitu)add_index) & add_mask;
 						count--;
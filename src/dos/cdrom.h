@@ -28,8 +28,13 @@
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include <list>
+#include <deque>
+#include <unordered_map>
 #if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 #endif
 
 #include "mem.h"
@@ -311,18 +316,36 @@ private:
         void setAudioPosition(uint32_t pos) override { audio_pos = pos; }
         chd_file*       getChd() { return this->chd; }
     private:
+        enum HunkState { HUNK_QUEUED, HUNK_BUSY, HUNK_READING, HUNK_READY, HUNK_ERROR };
+        struct Hunk {
+            uint32_t             index;
+            HunkState            state;
+            std::vector<uint8_t> data;
+        };
+        using hunk_iter = std::list<Hunk>::iterator;
+
+        hunk_iter   FindHunk(uint32_t index);
+        hunk_iter   InsertHunk(uint32_t index, HunkState state);
+        void        ReadAhead(uint32_t index);
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+        void        HunkWorker(void);
+#endif
+
+              std::string  filename;                    // workers open their own chd_file, libchdr is not thread safe
               chd_file*   chd               = nullptr;
         const chd_header* header            = nullptr; // chd header
-                /*
-                    TODO: cache more than one hunk
-                    or wait for https://github.com/rtissera/libchdr/issues/36
-                */
-              uint8_t*     hunk_buffer       = nullptr; // buffer to hold one hunk // size of hunks in CHD up to 1 MiB
-              uint8_t*     hunk_buffer_next  = nullptr; // index + 1 prefetch
-              int          hunk_buffer_index = -1;      // hunk index for buffer
+              int          hunk_last         = -1;      // last hunk accessed, to tell the access direction
+              int          hunk_direction    = 1;       // +1 reading forward, -1 reading backward
+              // LRU cache of decompressed hunks (size of hunks in CHD up to 1 MiB), most recently used first,
+              // shared by data reads and CD audio playback
+              std::list<Hunk>                         hunk_lru;
+              std::unordered_map<uint32_t, hunk_iter> hunk_map;
 #if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
-              std::thread* hunk_thread       = nullptr; // used for prefetch
-              bool         hunk_thread_error = true;
+              std::vector<std::thread> hunk_workers;     // decompression pool for read-ahead
+              std::deque<uint32_t>     hunk_queue;       // read-ahead hunks waiting for a worker
+              std::mutex               hunk_mutex;       // guards hunk_lru, hunk_map and hunk_queue
+              std::condition_variable  hunk_cond;
+              bool                     hunk_quit = false;
 #endif
     public:
               bool         skip_sync         = false;   // this will fail if a CHD contains 2048 and 2352 sector tracks
@@ -375,6 +398,8 @@ public:
     //!
     //! \description images[] is static and not specific to any C++ class instance.
 	static CDROM_Interface_Image* images[26];
+    //! \brief Stop and join the CD audio decode-ahead worker, if running
+	static void DecodeAheadShutdown(void);
 
 private:
 	static struct imagePlayer {
@@ -400,6 +425,23 @@ private:
 		int      playbackRemaining;
 		uint16_t   bufferPos;
 		uint16_t   bufferConsumed;
+		// decode-ahead of codec-based (Vorbis, FLAC, Opus, MP3) tracks on a worker thread
+		bool       decodeAhead       = false; // mixer pulls chunks from decodeRing instead of decoding itself
+		bool       decodePrimed      = false; // first chunk after a flush has arrived
+		uint32_t   decodeUnderruns   = 0;
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+		std::thread*            decodeThread = nullptr;
+		std::mutex              decodeMutex;
+		std::condition_variable decodeCond;
+		std::vector<uint8_t>    decodeRing;         // multiple of the track's chunkSize
+		TrackFile* decodeFile        = nullptr; // track being decoded, nullptr when idle
+		size_t     decodeHead        = 0;       // ring read position (mixer side)
+		size_t     decodeFill        = 0;       // decoded bytes waiting in the ring
+		int64_t    decodeSeek        = -1;      // pending seek in Red Book bytes, -1 if none
+		uint32_t   decodeGeneration  = 0;       // bumped on every flush, stale chunks are dropped
+		bool       decodeBusy        = false;   // worker is inside seek()/decode() with the mutex released
+		bool       decodeQuit        = false;
+#endif
 	} player;
 
 	// Private utility functions
@@ -409,6 +451,12 @@ private:
 	int	  GetTrack(unsigned long sector);
 	static void CDAudioCallBack (Bitu len);
 
+	// Decode-ahead worker for codec-based audio tracks
+	static bool     DecodeAheadStart (TrackFile *file, int64_t offset, uint32_t bytesPerMs);
+	static void     DecodeAheadStop  (void);
+	static uint16_t DecodeAheadRead  (uint8_t *buffer, uint16_t count);
+	static void     DecodeAheadThread(void);
+
 	// Private functions for cue sheet processing
 	bool  LoadCueSheet(char *cuefile);
 	bool  LoadChdFile(char* chdfile);
@@ -42,6 +42,7 @@
 #define IS_BIGENDIAN false
 #endif
 
+#include "control.h"
 #include "cross.h"
 #include "drives.h"
 #include "logging.h"
@@ -87,6 +88,14 @@ using namespace std;
 #define MAX_LINE_LENGTH 512
 #define MAX_FILENAME_LENGTH 256
 
+// How many milliseconds of codec-based CD audio to decode ahead, 0 to decode from the mixer callback
+static unsigned int cdda_prebuffer_ms = 0;
+
+// CHD hunk cache: cached hunk count, hunks to decompress ahead and decompression threads per CHD image
+static unsigned int chd_hunk_cache = 64;
+static unsigned int chd_read_ahead = 4;
+static unsigned int chd_threads = 2;
+
 std::string get_basename(const std::string& filename) {
 	// Guard against corner cases: '', '/', '\', 'a'
 	if (filename.length() <= 1)
@@ -311,39 +320,138 @@ CDROM_Interface_Image::CHDFile::CHDFile(const char* filename, bool& error)
 {
     error = chd_open(filename, CHD_OPEN_READ, NULL, &this->chd) != CHDERR_NONE;
     if (!error) {
+        this->filename         = filename;
         this->header           = chd_get_header(this->chd);
-        this->hunk_buffer      = new uint8_t[this->header->hunkbytes];
-        this->hunk_buffer_next = new uint8_t[this->header->hunkbytes];
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+        for (unsigned int i = 0; i < chd_threads && chd_read_ahead > 0; i++)
+            this->hunk_workers.emplace_back(&CHDFile::HunkWorker, this);
+#endif
     }
 }
 
 CDROM_Interface_Image::CHDFile::~CHDFile()
 {
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+    // stop the workers before the cache goes away
+    {
+        std::lock_guard<std::mutex> lock(this->hunk_mutex);
+        this->hunk_quit = true;
+        this->hunk_cond.notify_all();
+    }
+    for (auto &worker : this->hunk_workers)
+        worker.join();
+    this->hunk_workers.clear();
+#endif
+
     // Guard: only cleanup if needed
     if (this->chd) {
         chd_close(this->chd);
         this->chd = nullptr;
     }
+}
+
+// Look up a cached hunk and mark it most recently used. Caller holds hunk_mutex.
+CDROM_Interface_Image::CHDFile::hunk_iter CDROM_Interface_Image::CHDFile::FindHunk(uint32_t index)
+{
+    const auto it = this->hunk_map.find(index);
+    if (it == this->hunk_map.end())
+        return this->hunk_lru.end();
 
-    if (this->hunk_buffer) {
-        delete[] this->hunk_buffer;
-        this->hunk_buffer = nullptr;
+    this->hunk_lru.splice(this->hunk_lru.begin(), this->hunk_lru, it->second);
+    return it->second;
+}
+
+// Add a hunk to the cache, evicting the least recently used ones. Caller holds hunk_mutex.
+CDROM_Interface_Image::CHDFile::hunk_iter CDROM_Interface_Image::CHDFile::InsertHunk(uint32_t index, HunkState state)
+{
+    // room for the read-ahead window plus the hunk being read
+    const size_t capacity = std::max<size_t>(chd_hunk_cache, chd_read_ahead + 2u);
+    std::vector<uint8_t> data;
+
+    while (this->hunk_lru.size() >= capacity) {
+        // Evicting a hunk a worker is still busy with is fine, the worker drops the result.
+        // Recycle the buffer instead of freeing it.
+        Hunk &victim = this->hunk_lru.back();
+        if (data.empty()) data.swap(victim.data);
+        this->hunk_map.erase(victim.index);
+        this->hunk_lru.pop_back();
     }
 
+    data.resize(this->header->hunkbytes);
+    this->hunk_lru.push_front(Hunk{index, state, std::move(data)});
+    this->hunk_map[index] = this->hunk_lru.begin();
+    return this->hunk_lru.begin();
+}
+
+// Queue the next chd_read_ahead hunks in the access direction. Caller holds hunk_mutex.
+void CDROM_Interface_Image::CHDFile::ReadAhead(uint32_t index)
+{
 #if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
-    if (this->hunk_thread) {
-        this->hunk_thread->join();
-        delete hunk_thread;
-        this->hunk_thread = nullptr;
+    if (this->hunk_workers.empty()) return;
+
+    // anything still queued from an earlier access pattern is no longer wanted
+    this->hunk_queue.clear();
+
+    int64_t next = index;
+    for (unsigned int i = 0; i < chd_read_ahead; i++) {
+        next += this->hunk_direction;
+        if (next < 0 || next >= (int64_t)this->header->totalhunks) break;
+
+        hunk_iter hunk = FindHunk((uint32_t)next);
+        if (hunk == this->hunk_lru.end())
+            hunk = InsertHunk((uint32_t)next, HUNK_QUEUED);
+        if (hunk->state == HUNK_QUEUED)
+            this->hunk_queue.push_back((uint32_t)next);
     }
+
+    if (!this->hunk_queue.empty())
+        this->hunk_cond.notify_all();
+#else
+    (void)index;
 #endif
 }
 
 #if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
-void hunk_thread_func(chd_file* chd, int hunk_index, uint8_t* buffer, bool* error)
+void CDROM_Interface_Image::CHDFile::HunkWorker(void)
 {
-    // loads one hunk into buffer
-    *error = chd_read(chd, hunk_index, buffer) != CHDERR_NONE;
+    // libchdr keeps per-file decompression state, so every worker needs its own handle
+    chd_file* worker_chd = nullptr;
+    if (chd_open(this->filename.c_str(), CHD_OPEN_READ, NULL, &worker_chd) != CHDERR_NONE) {
+        LOG_MSG("CDROM: CHD decompression thread failed to open %s", this->filename.c_str());
+        return;
+    }
+    std::vector<uint8_t> buffer(this->header->hunkbytes);
+
+    std::unique_lock<std::mutex> lock(this->hunk_mutex);
+    while (!this->hunk_quit) {
+        if (this->hunk_queue.empty()) {
+            this->hunk_cond.wait(lock);
+            continue;
+        }
+
+        const uint32_t index = this->hunk_queue.front();
+        this->hunk_queue.pop_front();
+
+        // the hunk may have been evicted, or taken over by the reader, in the meantime
+        auto it = this->hunk_map.find(index);
+        if (it == this->hunk_map.end() || it->second->state != HUNK_QUEUED)
+            continue;
+        it->second->state = HUNK_BUSY;
+
+        lock.unlock();
+        const bool error = chd_read(worker_chd, index, buffer.data()) != CHDERR_NONE;
+        lock.lock();
+
+        it = this->hunk_map.find(index);
+        if (it != this->hunk_map.end() && it->second->state == HUNK_BUSY) {
+            it->second->data.swap(buffer);
+            it->second->state = error ? HUNK_ERROR : HUNK_READY;
+        }
+        this->hunk_cond.notify_all();
+    }
+    lock.unlock();
+
+    chd_close(worker_chd);
 }
 #endif
 
@@ -361,49 +469,61 @@ bool CDROM_Interface_Image::CHDFile::read(uint8_t* buffer,int64_t offset, int co
         return false;
     }
 
-    // read new hunk if needed
-    if ((int)needed_hunk != this->hunk_buffer_index) {
-#if defined(HX_DOS) || defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR)
-        if (chd_read(this->chd, needed_hunk, this->hunk_buffer) != CHDERR_NONE)
-            return false;
-#else
-        // make sure our thread is done
-        if (this->hunk_thread) this->hunk_thread->join();
-
-        // can we use our prefetched hunk
-        if (((int)needed_hunk == (this->hunk_buffer_index + 1)) && (!this->hunk_thread_error)) {
-            // swap pointers and we're good :)
-            std::swap(this->hunk_buffer, this->hunk_buffer_next);
-
-        } else {
-            // read new hunk
-            bool error = true;
-            hunk_thread_func(this->chd, (int)needed_hunk, this->hunk_buffer, &error);
-            if (error) {
-                return false;
-            }
-        }
+    // the overlying read code thinks there is a sync header
+    // so for 2048 sector size images we need to subtract 16 from the offset to account for the missing sync header
+    const uint64_t hunk_offset = ((uint64_t)offset - (uint64_t)needed_hunk * this->header->hunkbytes) - ((uint64_t)16 * this->skip_sync);
+    const uint32_t index = (uint32_t)needed_hunk;
+
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+    std::unique_lock<std::mutex> lock(this->hunk_mutex);
 #endif
 
-        this->hunk_buffer_index = (int)needed_hunk;
+    // keep reading ahead in the direction the guest (or CD audio playback) is moving
+    if ((int)index != this->hunk_last) {
+        if (this->hunk_last >= 0)
+            this->hunk_direction = ((int)index < this->hunk_last) ? -1 : 1;
+        this->hunk_last = (int)index;
+        FindHunk(index); // make it recently used so the read-ahead does not evict it
+        ReadAhead(index);
+    }
 
+    hunk_iter hunk = FindHunk(index);
 #if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
-        // prefetch: let our thread decode the next hunk
-        if (hunk_thread) delete this->hunk_thread;
-        this->hunk_thread = new std::thread(
-            [this, needed_hunk]() {
-                hunk_thread_func(this->chd, (int)(needed_hunk + 1), this->hunk_buffer_next, &this->hunk_thread_error);
-            }
-        );
+    // a worker is already decompressing it, which is quicker than starting over
+    while (hunk != this->hunk_lru.end() && hunk->state == HUNK_BUSY) {
+        this->hunk_cond.wait(lock);
+        hunk = FindHunk(index);
+    }
 #endif
+
+    if (hunk != this->hunk_lru.end() && hunk->state == HUNK_READY) {
+        memcpy(buffer, hunk->data.data() + hunk_offset, min(count, RAW_SECTOR_SIZE));
+        return true;
     }
 
-    // copy data
-    // the overlying read code thinks there is a sync header
-    // so for 2048 sector size images we need to subtract 16 from the offset to account for the missing sync header
-    uint8_t* source = this->hunk_buffer + ((uint64_t)offset - (uint64_t)needed_hunk * this->header->hunkbytes) - ((uint64_t)16 * this->skip_sync);
-    memcpy(buffer, source, min(count, RAW_SECTOR_SIZE));
+    // Not cached (or only queued): decompress it here rather than wait behind the read-ahead queue.
+    // Workers leave HUNK_READING alone and only this thread evicts, so the hunk stays put while unlocked.
+    if (hunk == this->hunk_lru.end())
+        hunk = InsertHunk(index, HUNK_READING);
+    else
+        hunk->state = HUNK_READING;
 
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+    lock.unlock();
+#endif
+    const bool error = chd_read(this->chd, index, hunk->data.data()) != CHDERR_NONE;
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+    lock.lock();
+#endif
+
+    if (error) {
+        this->hunk_map.erase(index);
+        this->hunk_lru.erase(hunk);
+        return false;
+    }
+    hunk->state = HUNK_READY;
+
+    memcpy(buffer, hunk->data.data() + hunk_offset, min(count, RAW_SECTOR_SIZE));
     return true;
 }
 
@@ -686,7 +806,17 @@ bool CDROM_Interface_Image::PlayAudioSector(unsigned long start, unsigned long l
             //       rather than the start of target track, so go to the target track in such case.
         }
     
-        is_playable = trackFile->seek(offset);
+        // Codec-based tracks are decoded ahead on a worker thread, which also carries
+        // out the (potentially slow) seek so that it does not stall the emulation.
+        player.decodeAhead = cdda_prebuffer_ms > 0 && dynamic_cast<AudioFile*>(trackFile) != nullptr;
+        if (player.decodeAhead) {
+            const uint32_t bytesPerMs = (trackFile->getRate() * trackFile->getChannels() * 2 + 999) / 1000;
+            is_playable = DecodeAheadStart(trackFile, offset, bytesPerMs);
+        }
+        else {
+            DecodeAheadStop();
+            is_playable = trackFile->seek(offset);
+        }
 		// only initialize the player elements if our track is playable
 		if (is_playable) {
             trackFile->setAudioPosition(offset);
@@ -753,6 +883,12 @@ bool CDROM_Interface_Image::PauseAudio(bool resume)
 
 bool CDROM_Interface_Image::StopAudio(void)
 {
+	if (player.decodeAhead) {
+		DecodeAheadStop();
+		player.decodeAhead = false;
+		if (player.decodeUnderruns > 0)
+			LOG_MSG("CDROM: Audio decode-ahead underran %u times during playback, consider raising cd-da prebuffer", player.decodeUnderruns);
+	}
 	player.isPlaying = false;
 	player.isPaused = false;
 	if (player.channel)
@@ -955,7 +1091,13 @@ void CDROM_Interface_Image::CDAudioCallBack(Bitu len)
 			      (player.bufferPos - player.bufferConsumed < player.playbackRemaining ||
 				   player.bufferPos - player.bufferConsumed < requested) ) {
 
-				const uint16_t decoded = player.trackFile->decode(player.buffer + player.bufferPos);
+				uint16_t decoded;
+				if (player.decodeAhead) {
+					decoded = DecodeAheadRead(player.buffer + player.bufferPos, chunkSize);
+					if (decoded == 0) break; // the worker has not caught up, see underrun handling below
+				}
+				else
+					decoded = player.trackFile->decode(player.buffer + player.bufferPos);
 				player.bufferPos += decoded;
 
 				// if we decoded less than expected, which could be due to EOF or if the CUE file specified
@@ -973,6 +1115,21 @@ void CDROM_Interface_Image::CDAudioCallBack(Bitu len)
 				}
 				// printProgress( (player.bufferPos - player.bufferConsumed)/(float)AUDIO_DECODE_BUFFER_SIZE, "fill");
 			} // end of fill-while
+
+			// Underrun: the decode-ahead worker is behind (or still seeking after a flush).
+			// Feed the mixer silence for this request without advancing the playback position,
+			// and keep what has been decoded so far for the next callback.
+			if (player.decodeAhead && player.bufferPos - player.bufferConsumed < requested) {
+				static const int16_t silence[AUDIO_DECODE_BUFFER_SIZE / sizeof(int16_t)] = {};
+				(player.channel->*player.addSamples)(requested / bytes_per_request, silence);
+				if (player.decodePrimed) {
+					player.decodeUnderruns++;
+					#ifdef DEBUG
+					LOG_MSG("%s CDROM: Decode-ahead underrun, feeding mixer with %u bytes of silence.", get_time(), requested);
+					#endif
+				}
+				break;
+			}
 		} // end of decode and fill loop
 	} // end while total_requested
 
@@ -982,6 +1139,135 @@ void CDROM_Interface_Image::CDAudioCallBack(Bitu len)
 	}
 }
 
+bool CDROM_Interface_Image::DecodeAheadStart(TrackFile *file, int64_t offset, uint32_t bytesPerMs)
+{
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	// Without a known length we cannot validate the seek up front, so let the caller seek synchronously
+	const int64_t length = file->getLength();
+	if (length < 0) {
+		player.decodeAhead = false;
+		DecodeAheadStop();
+		return file->seek(offset);
+	}
+	if (offset >= length) return false;
+
+	// Keep at least two chunks in flight so the worker can decode while the mixer consumes
+	const size_t chunks = std::max<size_t>(2u, ceil_udivide((size_t)cdda_prebuffer_ms * bytesPerMs, (size_t)file->chunkSize));
+
+	std::unique_lock<std::mutex> lock(player.decodeMutex);
+	player.decodeGeneration++;
+	player.decodeFile = nullptr;
+	player.decodeCond.wait(lock, [] { return !player.decodeBusy; });
+
+	player.decodeRing.assign(chunks * file->chunkSize, 0);
+	player.decodeHead = 0;
+	player.decodeFill = 0;
+	player.decodeSeek = offset;
+	player.decodeFile = file;
+	player.decodePrimed = false;
+	player.decodeUnderruns = 0;
+	if (player.decodeThread == nullptr)
+		player.decodeThread = new std::thread(DecodeAheadThread);
+	player.decodeCond.notify_all();
+	return true;
+#else
+	(void)bytesPerMs;
+	player.decodeAhead = false;
+	return file->seek(offset);
+#endif
+}
+
+void CDROM_Interface_Image::DecodeAheadStop(void)
+{
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	// Waits for a decode in progress, so the caller may seek, decode or delete the track file afterwards
+	std::unique_lock<std::mutex> lock(player.decodeMutex);
+	player.decodeGeneration++;
+	player.decodeFile = nullptr;
+	player.decodeSeek = -1;
+	player.decodeHead = 0;
+	player.decodeFill = 0;
+	player.decodeCond.wait(lock, [] { return !player.decodeBusy; });
+#endif
+}
+
+uint16_t CDROM_Interface_Image::DecodeAheadRead(uint8_t *buffer, uint16_t count)
+{
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	// The worker fills the ring in whole chunks, so reads of chunkSize never straddle its end
+	std::lock_guard<std::mutex> lock(player.decodeMutex);
+	if (player.decodeFill < count) return 0;
+	memcpy(buffer, &player.decodeRing[player.decodeHead], count);
+	player.decodeHead = (player.decodeHead + count) % player.decodeRing.size();
+	player.decodeFill -= count;
+	player.decodePrimed = true;
+	player.decodeCond.notify_all();
+	return count;
+#else
+	(void)buffer;
+	(void)count;
+	return 0;
+#endif
+}
+
+void CDROM_Interface_Image::DecodeAheadThread(void)
+{
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	std::vector<uint8_t> chunk;
+	std::unique_lock<std::mutex> lock(player.decodeMutex);
+	while (!player.decodeQuit) {
+		TrackFile *file = player.decodeFile;
+		if (file == nullptr || (player.decodeSeek < 0 && player.decodeRing.size() - player.decodeFill < file->chunkSize)) {
+			player.decodeCond.wait(lock);
+			continue;
+		}
+
+		const int64_t seekTo = player.decodeSeek;
+		const uint32_t generation = player.decodeGeneration;
+		player.decodeSeek = -1;
+		player.decodeBusy = true;
+		lock.unlock();
+
+		// seek() goes through Sound_Seek(), which uses the MP3 seek table for MP3 tracks
+		bool ok = true;
+		if (seekTo >= 0) ok = file->seek(seekTo);
+		chunk.resize(file->chunkSize);
+		const uint16_t decoded = ok ? file->decode(chunk.data()) : 0;
+		// Pad short decodes (EOF, or a track slightly shorter than its cue sheet entry) with zeros
+		if (decoded < file->chunkSize)
+			memset(chunk.data() + decoded, 0, file->chunkSize - decoded);
+
+		lock.lock();
+		player.decodeBusy = false;
+		// Drop the chunk if the ring was flushed (stop, or seek to another position) meanwhile
+		if (generation == player.decodeGeneration && player.decodeRing.size() - player.decodeFill >= chunk.size()) {
+			const size_t tail = (player.decodeHead + player.decodeFill) % player.decodeRing.size();
+			memcpy(&player.decodeRing[tail], chunk.data(), chunk.size());
+			player.decodeFill += chunk.size();
+		}
+		player.decodeCond.notify_all();
+	}
+#endif
+}
+
+void CDROM_Interface_Image::DecodeAheadShutdown(void)
+{
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	if (player.decodeThread == nullptr) return;
+	{
+		std::lock_guard<std::mutex> lock(player.decodeMutex);
+		player.decodeQuit = true;
+		player.decodeFile = nullptr;
+		player.decodeCond.notify_all();
+	}
+	player.decodeThread->join();
+	delete player.decodeThread;
+	player.decodeThread = nullptr;
+	player.decodeQuit = false;
+#endif
+	player.decodeAhead = false;
+}
+
 bool CDROM_Interface_Image::LoadIsoFile(char* filename)
 {
 	tracks.clear();
@@ -1788,6 +2074,18 @@ bool CDROM_Interface_Image::GetCueString(string &str, istream &in) const
 
 void CDROM_Interface_Image::ClearTracks()
 {
+#if !defined(HX_DOS) && !(defined(__MINGW32__) && !defined(__MINGW64_VERSION_MAJOR))
+	// the decode-ahead worker must not be left inside one of our track files
+	if (player.decodeAhead) {
+		for (const auto &track : tracks) {
+			if (track.file == player.decodeFile) {
+				StopAudio();
+				break;
+			}
+		}
+	}
+#endif
+
 	vector<Track>::iterator i = tracks.begin();
 	vector<Track>::iterator end = tracks.end();
 
@@ -1804,10 +2102,19 @@ void CDROM_Interface_Image::ClearTracks()
 }
 
 void CDROM_Image_ShutDown(Section* /*sec*/) {
+	CDROM_Interface_Image::DecodeAheadShutdown();
 	Sound_Quit();
 }
 
 void CDROM_Image_Init() {
+	const Section_prop* section = static_cast<Section_prop*>(control->GetSection("mixer"));
+	cdda_prebuffer_ms = (unsigned int)section->Get_int("cd-da prebuffer");
+
+	const Section_prop* dos_section = static_cast<Section_prop*>(control->GetSection("dos"));
+	chd_hunk_cache = (unsigned int)dos_section->Get_int("chd hunk cache");
+	chd_read_ahead = (unsigned int)dos_section->Get_int("chd read ahead");
+	chd_threads = (unsigned int)dos_section->Get_int("chd threads");
+
 	Sound_Init();
 	AddExitFunction(AddExitFunctionFuncPair(CDROM_Image_ShutDown));
 }
@@ -187,6 +187,7 @@ DOS_File ** Files = NULL;
 DOS_Drive * Drives[DOS_DRIVES] = {NULL};
 bool force_sfn = false;
 int sdrive = 0;
+uint32_t dos_file_generation = 0;
 
 /* This is the LFN filefind handle that is currently being used, with normal values between
  * 0 and 254 for LFN calls. The value LFN_FILEFIND_INTERNAL and LFN_FILEFIND_IMG are used
@@ -620,6 +621,7 @@ static bool PathExists(char const * const name) {
 }
 
 bool DOS_Rename(char const * const oldname,char const * const newname) {
+	dos_file_generation++;
 	uint8_t driveold;char fullold[DOS_PATHLENGTH];
 	uint8_t drivenew;char fullnew[DOS_PATHLENGTH];
 	if (!DOS_MakeName(oldname,fullold,&driveold)) return false;
@@ -823,6 +825,9 @@ bool DOS_WriteFile(uint16_t entry,const uint8_t * data,uint16_t * amount,bool fc
     if (log_fileio) {
         LOG(LOG_FILES, LOG_DEBUG)("Writing %d bytes to %s", *amount, Files[handle]->name);
     }
+	/* writes to CON and other devices do not change any file */
+	if (!(Files[handle]->GetInformation() & DeviceInfoFlags::Device))
+		dos_file_generation++;
 /*
 	if ((Files[handle]->flags & 0x0f) == OPEN_READ)) {
 		DOS_SetError(DOSERR_INVALID_HANDLE);
@@ -932,6 +937,7 @@ bool DOS_CreateFile(char const * name,uint16_t attributes,uint16_t * entry,bool
 	if (DOS_FindDevice(name) != DOS_DEVICES)
 		return DOS_OpenFile(name, OPEN_READ, entry, fcb);
 
+	dos_file_generation++;
 	LOG(LOG_FILES,LOG_NORMAL)("file create attributes %X file %s",attributes,name);
 	char fullname[DOS_PATHLENGTH];uint8_t drive;
 	DOS_PSP psp(dos.psp());
@@ -1109,6 +1115,7 @@ bool DOS_OpenFileExtended(char const * name, uint16_t flags, uint16_t createAttr
 }
 
 bool DOS_UnlinkFile(char const * const name) {
+	dos_file_generation++;
 	char fullname[DOS_PATHLENGTH];uint8_t drive;
     // An existing device returns an access denied error
     if (log_fileio) {
@@ -64,6 +64,7 @@
 #include "../ints/int10.h"
 #include "../output/output_opengl.h"
 #include "paging.h"
+#include "forkserver.h"
 
 #if defined(OS2)
 #define INCL DOSFILEMGR
@@ -5772,6 +5773,10 @@ class IMGMOUNT : public Program {
 					if (strcasecmp(temp_line.c_str(), "-u")&&!qmount) WriteOut(MSG_Get("PROGRAM_IMGMOUNT_SPECIFY_FILE"));
 					return; 
 				}
+				if (paths.size() > 1 && HasDelta()) {
+					WriteOut(MSG_Get("PROGRAM_IMGMOUNT_DELTA_MULTIPLE"));
+					return;
+				}
 				if (!rtype&&!rfstype&&fstype!="none"&&paths[0].length()>4) {
 					const char *ext = strrchr(paths[0].c_str(), '.');
 					if (ext != NULL) {
@@ -6510,7 +6515,7 @@ class IMGMOUNT : public Program {
 							else if (!strcasecmp(ext, ".vhd")) {
 								ro=wpcolon&&paths[i].length()>1&&paths[i].c_str()[0]==':';
 								//load the file with imageDiskVHD, which supports fixed/dynamic/differential disks
-								imageDiskVHD::ErrorCodes ret = imageDiskVHD::Open(ro?paths[i].c_str()+1:paths[i].c_str(), ro||roflag, &vhdImage);
+								imageDiskVHD::ErrorCodes ret = imageDiskVHD::Open(ro?paths[i].c_str()+1:paths[i].c_str(), ro||roflag||HasDelta(), &vhdImage);
 								switch (ret) {
 									case imageDiskVHD::UNSUPPORTED_WRITE:
 										options.emplace_back("readonly");
@@ -6549,7 +6554,7 @@ class IMGMOUNT : public Program {
 							else if(!strcasecmp(ext, ".qcow2")) {
 								ro = wpcolon && paths[i].length() > 1 && paths[i].c_str()[0] == ':';
 								const char* fname = ro ? paths[i].c_str() + 1 : paths[i].c_str();
-								FILE* newDisk = fopen_lock(fname, ro ? "rb" : "rb+", ro);
+								FILE* newDisk = fopen_lock(fname, (ro || HasDelta()) ? "rb" : "rb+", ro);
 								if(!newDisk) {
 									if(!qmount) WriteOut(MSG_Get("PROGRAM_IMGMOUNT_OPEN_ERROR"), fname);
 									return false;
@@ -6598,6 +6603,12 @@ class IMGMOUNT : public Program {
 					}
 				}
 
+				if (!errorMessage && (vhdImage != NULL || newImage != NULL)) {
+					if (vhdImage != NULL) vhdImage = AttachDelta(vhdImage);
+					else newImage = AttachDelta(newImage);
+					if (vhdImage == NULL && newImage == NULL) errorMessage = MSG_Get("PROGRAM_IMGMOUNT_CANT_CREATE");
+				}
+
 				if (!errorMessage) {
 					DOS_Drive* newDrive = NULL;
 					if (vhdImage) {
@@ -7088,7 +7099,7 @@ class IMGMOUNT : public Program {
 				if (ext != NULL) {
 					if (!strcasecmp(ext, ".vhd")) {
 						bool ro=wpcolon&&strlen(fileName)>1&&fileName[0]==':';
-						imageDiskVHD::ErrorCodes ret = imageDiskVHD::Open(ro?fileName+1:fileName, ro||roflag, &newImage);
+						imageDiskVHD::ErrorCodes ret = imageDiskVHD::Open(ro?fileName+1:fileName, ro||roflag||HasDelta(), &newImage);
 						switch (ret) {
 							case imageDiskVHD::ERROR_OPENING: WriteOut(MSG_Get("VHD_ERROR_OPENING")); break;
 							case imageDiskVHD::INVALID_DATA: WriteOut(MSG_Get("VHD_INVALID_DATA")); break;
@@ -7101,7 +7112,7 @@ class IMGMOUNT : public Program {
 							case imageDiskVHD::UNSUPPORTED_WRITE: roflag=true; break;
 							default: break;
 						}
-						return newImage;
+						return AttachDelta(newImage);
 					}
 					else if (!strcasecmp(ext, ".hdi")) {
 						assumeHardDisk = true; /* bugfix for HDI images smaller than 2.88MB so that the .hdi file is not mistaken for a floppy disk image */
@@ -7115,7 +7126,7 @@ class IMGMOUNT : public Program {
 
 			bool readonly = wpcolon&&strlen(fileName)>1&&fileName[0]==':';
 			const char* fname=readonly?fileName+1:fileName;
-			FILE *newDisk = file==NULL?fopen_lock(fname, readonly||roflag?"rb":"rb+", roflag):file;
+			FILE *newDisk = file==NULL?fopen_lock(fname, readonly||roflag||HasDelta()?"rb":"rb+", roflag):file;
 			if (!newDisk) {
 				if (!qmount) WriteOut(MSG_Get("PROGRAM_IMGMOUNT_OPEN_ERROR"), fname);
 				return NULL;
@@ -7235,7 +7246,31 @@ class IMGMOUNT : public Program {
 			if (imagesize > 2880) newImage->Set_Geometry((uint32_t)sizes[2], (uint32_t)sizes[3], (uint32_t)sizes[1], (uint32_t)sizes[0]);
 			if (reserved_cylinders > 0) newImage->Set_Reserved_Cylinders((Bitu)reserved_cylinders);
 
-			return newImage;
+			return AttachDelta(newImage);
+		}
+
+		bool HasDelta(void) {
+			std::string deltaname;
+			uint32_t deltacluster;
+
+			return imageDiskOverlay::ParseOptions(options, deltaname, deltacluster);
+		}
+
+		/* put the delta file given with -o delta=file in front of the image, the image is
+		 * freed if that fails */
+		imageDisk* AttachDelta(imageDisk *image) {
+			std::string deltaname, error;
+			uint32_t deltacluster;
+
+			if (image == NULL || !imageDiskOverlay::ParseOptions(options, deltaname, deltacluster))
+				return image;
+
+			imageDisk *overlay = imageDiskOverlay::Open(image, deltaname.c_str(), deltacluster, error);
+			if (overlay == NULL) {
+				if (!qmount) WriteOut(MSG_Get("PROGRAM_IMGMOUNT_DELTA_ERROR"), deltaname.c_str(), error.c_str());
+				delete image;
+			}
+			return overlay;
 		}
 };
 
@@ -7578,6 +7613,58 @@ void CAPMOUSE_ProgramStart(Program** make)
 	*make = new CAPMOUSE;
 }
 
+class FORKPT : public Program
+{
+public:
+	void Run() override
+    {
+        if (cmd->FindExist("/?", false)) {
+            WriteOut(MSG_Get("PROGRAM_FORKPT_HELP"));
+            return;
+        }
+        if (FORKSERVER_IsChild()) return;
+        if (!FORKSERVER_Enabled()) {
+            WriteOut(MSG_Get("PROGRAM_FORKPT_DISABLED"));
+            return;
+        }
+
+        std::string command;
+        switch (FORKSERVER_Run(command, true)) {
+            case FORKSERVER_CHILD:
+                break;
+            case FORKSERVER_STOPPED: /* shut down the server */
+                throw(0);
+            case FORKSERVER_FAILED:
+                WriteOut(MSG_Get("PROGRAM_FORKPT_FAILED"));
+                return;
+        }
+
+        /* child: run the command of the request and exit, without one carry on
+         * with the rest of the batch file that started the fork server */
+        if (command.empty()) return;
+
+        std::istringstream lines(command);
+        std::string line;
+        char cmdline[CMD_MAXLINE];
+
+        while (std::getline(lines, line)) {
+            DOS_Shell shell;
+            shell.echo = false;
+            strncpy(cmdline, line.c_str(), CMD_MAXLINE - 1);
+            cmdline[CMD_MAXLINE - 1] = 0;
+            shell.ParseLine(cmdline);
+            shell.RunInternal();
+        }
+        /* the ERRORLEVEL of the last command, for whoever waits on the child */
+        FORKSERVER_ExitChild(dos.return_code);
+    }
+};
+
+void FORKPT_ProgramStart(Program** make)
+{
+	*make = new FORKPT;
+}
+
 class LABEL : public Program
 {
 	public:
@@ -9553,6 +9640,9 @@ void Add_VFiles(bool usecp) {
         PROGRAMS_MakeFile("PC98UTIL.COM",PC98UTIL_ProgramStart,"/BIN/");
 
     PROGRAMS_MakeFile("CAPMOUSE.COM", CAPMOUSE_ProgramStart,"/SYSTEM/");
+#if defined(LINUX)
+    PROGRAMS_MakeFile("FORKPT.COM", FORKPT_ProgramStart,"/SYSTEM/");
+#endif
     PROGRAMS_MakeFile("LOADFIX.COM",LOADFIX_ProgramStart,"/DOS/");
     PROGRAMS_MakeFile("LABEL.COM", LABEL_ProgramStart,"/DOS/");
     PROGRAMS_MakeFile("TREE.COM", TREE_ProgramStart,"/DOS/");
@@ -10098,6 +10188,8 @@ void DOS_SetupPrograms(void) {
             "Sector size must be larger than 512 bytes and evenly divide the image cluster size of %lu bytes.\n");
     MSG_Add("PROGRAM_IMGMOUNT_OPEN_ERROR","Unable to open '%s'\n");
     MSG_Add("PROGRAM_IMGMOUNT_QCOW2_INVALID","qcow2 image '%s' is not supported\n");
+    MSG_Add("PROGRAM_IMGMOUNT_DELTA_ERROR","Unable to use delta file '%s': %s\n");
+    MSG_Add("PROGRAM_IMGMOUNT_DELTA_MULTIPLE","A delta file can only be used with a single image file\n");
     MSG_Add("PROGRAM_IMGMOUNT_GEOMETRY_ERROR", "Unable to detect geometry\n");
     MSG_Add("PROGRAM_IMGMOUNT_DOS_VERSION",
             "Mounting this image file requires a reported DOS version of %u.%u or higher.\n%s");
@@ -10125,6 +10217,8 @@ void DOS_SetupPrograms(void) {
         " -size size|ss,s,h,c Specify the size in KB, or sector size and CHS geometry.\n"
         " -bootcd cdDrive     Specify the CD drive to load the bootable floppy from.\n"
         " -o partidx=#        Specify a hard disk partition number to mount as drive.\n"
+        " -o delta=file       Keep writes in sparse delta file, the image is only read.\n"
+        " -o deltacluster=#   Bytes copied to a new delta file per first write (4096).\n"
         " -ro                 Mount image(s) read-only (or leading ':' for read-only).\n"
         " -u                  Unmount the drive or drive number.\n"
         " \033[32;1m-examples           Show some usage examples.\033[0m"
@@ -10150,6 +10244,8 @@ void DOS_SetupPrograms(void) {
         "  \033[32;1mIMGMOUNT A -bootcd D\033[0m           - mount bootable floppy A: from CD drive D:\n"
         "  \033[32;1mIMGMOUNT C -t ram -size 10000\033[0m  - mount hard drive C: as a 10MB RAM drive\n"
         "  \033[32;1mIMGMOUNT D d.img -o partidx=4\033[0m  - mount 1st logical partition of d.img as D:\n"
+        "  \033[32;1mIMGMOUNT C c.img -o delta=c.dlt\033[0m - mount c.img as C: with all writes going to\n"
+        "                                   c.dlt, merge them with \033[33;1mdeltacommit\033[0m later\n"
         "  \033[32;1mIMGMOUNT C disk.img -u\033[0m         - force mount hard disk image disk.img as C:,\n"
         "                                   auto-unmount drive beforehand if necessary\n"
         "  \033[32;1mIMGMOUNT A -u\033[0m                  - unmount previously-mounted drive A:\n"
@@ -10450,6 +10546,13 @@ void DOS_SetupPrograms(void) {
     MSG_Add("PROGRAM_CAPMOUSE_CURRENTLY", "is currently ");
     MSG_Add("PROGRAM_CAPMOUSE_CAPTURED", "captured");
     MSG_Add("PROGRAM_CAPMOUSE_RELEASED", "released");
+    MSG_Add("PROGRAM_FORKPT_HELP","Marks the point the fork server forks its children from.\n\n"
+            "FORKPT\n\n"
+            "Waits for requests on the socket given with -fork-server. Each child continues\n"
+            "from here and runs the command of its request, or the rest of the batch file.\n"
+            "A child that ran a command exits with the ERRORLEVEL of the last one.\n");
+    MSG_Add("PROGRAM_FORKPT_DISABLED","The fork server is not enabled, start DOSBox-X with -fork-server <socket>.\n");
+    MSG_Add("PROGRAM_FORKPT_FAILED","The fork server could not be started, see the log for the reason.\n");
     MSG_Add("PROGRAM_AUTOTYPE_HELP",
             "Performs scripted keyboard entry into a running DOS program.\n\n"
             "AUTOTYPE [-list] [-w WAIT] [-p PACE] button_1 [button_2 [...]]\n\n"
@@ -1364,9 +1364,13 @@ fatDrive::fatDrive(const char* sysFilename, uint32_t bytesector, uint32_t cylsec
 
 	std::vector<std::string>::iterator it = std::find(options.begin(), options.end(), "readonly");
 	bool roflag = it!=options.end();
+	std::string deltaname;
+	uint32_t deltacluster;
+	/* with a delta file the image itself is only ever read, and may be shared */
+	bool delta = imageDiskOverlay::ParseOptions(options, deltaname, deltacluster);
 	readonly = wpcolon&&strlen(sysFilename)>1&&sysFilename[0]==':';
 	const char *fname=readonly?sysFilename+1:sysFilename;
-	diskfile = fopen_lock(fname, readonly||roflag?"rb":"rb+", readonly);
+	diskfile = fopen_lock(fname, readonly||roflag||delta?"rb":"rb+", readonly);
 	if (!diskfile) {created_successfully = false;return;}
 	opts.bytesector = bytesector;
 	opts.cylsector = cylsector;
@@ -1431,6 +1435,19 @@ fatDrive::fatDrive(const char* sysFilename, uint32_t bytesector, uint32_t cylsec
 		}
 	}
 
+	if (delta) {
+		std::string error;
+		imageDisk *overlay = imageDiskOverlay::Open(loadedDisk, deltaname.c_str(), deltacluster, error);
+		if (overlay == NULL) {
+			LOG_MSG("FAT: cannot use delta file %s, %s",deltaname.c_str(),error.c_str());
+			delete loadedDisk;
+			loadedDisk = NULL;
+			created_successfully = false;
+			return;
+		}
+		loadedDisk = overlay;
+	}
+
 	fatDriveInit(sysFilename, bytesector, cylsector, headscyl, cylinders, filesize, options);
 }
 
@@ -1616,6 +1633,9 @@ void fatDrive::fatDriveInit(const char *sysFilename, uint32_t bytesector, uint32
 			if (!value.empty())
 				int13 = strtoul(value.c_str(),NULL,0);
 		}
+		else if (name == "delta" || name == "deltacluster") {
+			/* handled when the image is opened, see imageDiskOverlay::ParseOptions() */
+		}
 		else {
 			LOG(LOG_DOSMISC,LOG_DEBUG)("FAT: option '%s' = '%s' ignored, unknown",name.c_str(),value.c_str());
 		}
@@ -20,6 +20,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <map>
+#include <vector>
+#include <zlib.h>
 #include "dosbox.h"
 #include "dos_inc.h"
 #include "drives.h"
@@ -35,6 +38,7 @@ struct VFILE_Block {
 	const char * name;
 	const char * lname;
 	uint8_t * data;
+	const BuiltinFileBlob * blob = NULL; /* compressed builtin file, data is NULL until it is inflated */
 	uint32_t size;
 	uint16_t date;
 	uint16_t time;
@@ -197,12 +201,41 @@ void VFILE_Shutdown(void) {
     vfpos=1;
 }
 
+/* Builtin files stored compressed, inflated the first time anything reads them.
+ * They stay around afterwards since the Z: drive is rebuilt on every reboot. */
+static std::map<const BuiltinFileBlob*,std::vector<uint8_t> > vfile_unpacked;
+
+const uint8_t *VFILE_BuiltinFileBlobData(const struct BuiltinFileBlob &b) {
+	if (b.compressed_length == 0) return b.data;
+
+	auto i = vfile_unpacked.find(&b);
+	if (i != vfile_unpacked.end()) return i->second.data();
+
+	std::vector<uint8_t> buf(b.length);
+	uLongf len = (uLongf)b.length;
+	if (uncompress(buf.data(),&len,b.data,(uLong)b.compressed_length) != Z_OK || len != b.length) {
+		LOG(LOG_DOSMISC,LOG_ERROR)("Unable to unpack builtin file %s",b.recommended_file_name);
+		return NULL;
+	}
+	LOG(LOG_DOSMISC,LOG_DEBUG)("Unpacked builtin file %s, %u bytes",b.recommended_file_name,(unsigned int)b.length);
+	return (vfile_unpacked[&b] = std::move(buf)).data();
+}
+
+static void VFILE_RegisterBlock(const char * name,uint8_t * data,const BuiltinFileBlob * blob,uint32_t size,const char *dir);
+
 void VFILE_RegisterBuiltinFileBlob(const struct BuiltinFileBlob &b, const char *dir) {
-	VFILE_Register(b.recommended_file_name, (uint8_t*)b.data, (uint32_t)b.length, dir);
+	if (b.compressed_length != 0)
+		VFILE_RegisterBlock(b.recommended_file_name, NULL, &b, (uint32_t)b.length, dir);
+	else
+		VFILE_RegisterBlock(b.recommended_file_name, (uint8_t*)b.data, NULL, (uint32_t)b.length, dir);
 }
 
 uint16_t fztime=0, fzdate=0;
 void VFILE_Register(const char * name,uint8_t * data,uint32_t size,const char *dir) {
+	VFILE_RegisterBlock(name, data, NULL, size, dir);
+}
+
+static void VFILE_RegisterBlock(const char * name,uint8_t * data,const BuiltinFileBlob * blob,uint32_t size,const char *dir) {
     if (vfpos>=MAX_VFILES) return;
     std::istringstream in(hidefiles);
     bool hidden=false;
@@ -253,6 +286,7 @@ void VFILE_Register(const char * name,uint8_t * data,uint32_t size,const char *d
 	vfpos++;
 	new_file->intprog = internal_program;
 	new_file->data=data;
+	new_file->blob=blob;
 	new_file->size=size;
 	new_file->date=fztime||fzdate?fzdate:DOS_PackDate(2002,10,1);
 	new_file->time=fztime||fzdate?fztime:DOS_PackTime(12,34,56);
@@ -300,6 +334,8 @@ uint32_t VFILE_GetCPIData(const char *filename, std::vector<uint8_t> &cpibuf) {
 	while (chan) {
 		if (onpos==chan->onpos && (strcmp(filename,chan->name) == 0 || strcmp(filename,chan->lname) == 0)) {
             if (chan->size>65535) return 0;
+            if (chan->data == NULL && chan->blob != NULL) chan->data = (uint8_t*)VFILE_BuiltinFileBlobData(*chan->blob);
+            if (chan->data == NULL) return 0;
             for (size_t bct=0; bct<chan->size; bct++) cpibuf.push_back(chan->data[bct]);
             return chan->size;
 		}
@@ -310,7 +346,7 @@ uint32_t VFILE_GetCPIData(const char *filename, std::vector<uint8_t> &cpibuf) {
 
 class Virtual_File : public DOS_File {
 public:
-	Virtual_File(uint8_t * in_data,uint32_t in_size);
+	Virtual_File(uint8_t * in_data,uint32_t in_size,const BuiltinFileBlob * in_blob = NULL);
 	bool Read(uint8_t * data,uint16_t * size) override;
 	bool Write(const uint8_t * data,uint16_t * size) override;
 	bool Seek(uint32_t * new_pos,uint32_t type) override;
@@ -320,15 +356,24 @@ private:
 	uint32_t file_size;
     uint32_t file_pos = 0;
 	uint8_t * file_data;
+	const BuiltinFileBlob * file_blob;
 };
 
-Virtual_File::Virtual_File(uint8_t* in_data, uint32_t in_size) : file_size(in_size), file_data(in_data) {
+Virtual_File::Virtual_File(uint8_t* in_data, uint32_t in_size, const BuiltinFileBlob* in_blob) : file_size(in_size), file_data(in_data), file_blob(in_blob) {
 	date=DOS_PackDate(2002,10,1);
 	time=DOS_PackTime(12,34,56);
 	open=true;
 }
 
 bool Virtual_File::Read(uint8_t * data,uint16_t * size) {
+	if (file_data == NULL && file_blob != NULL) {
+		/* Compressed builtin file, opening it for a directory listing or a seek does not need the contents */
+		file_data = (uint8_t*)VFILE_BuiltinFileBlobData(*file_blob);
+		if (file_data == NULL) {
+			DOS_SetError(DOSERR_ACCESS_DENIED);
+			return false;
+		}
+	}
 	uint32_t left=file_size-file_pos;
 	if (left<=*size) { 
 		memcpy(data,&file_data[file_pos],left);
@@ -398,7 +443,7 @@ bool Virtual_Drive::FileOpen(DOS_File * * file,const char * name,uint32_t flags)
             strcasecmp(name,(std::string(onpos?vfnames[onpos]+std::string(1, '\\'):"")+cur_file->name).c_str())==0||
             strcasecmp(name,(std::string(onpos?vfnames[onpos]+std::string(1, '\\'):"")+cur_file->lname).c_str())==0))) {
 			/* We have a match */
-			*file=new Virtual_File(cur_file->data,cur_file->size);
+			*file=new Virtual_File(cur_file->data,cur_file->size,cur_file->data == NULL ? cur_file->blob : NULL);
             (*file)->SetName(cur_file->name);
 			(*file)->flags=flags;
 			return true;
@@ -1387,6 +1387,7 @@ void DOSBOX_SetupConfigSections(void) {
     const char* vsyncmode[] = { "off", "on" ,"force", "host", nullptr };
     const char* captureformats[] = { "default", "avi-zmbv", "mpegts-h264", nullptr };
     const char* blocksizes[] = {"1024", "2048", "4096", "8192", "512", "256", nullptr };
+    const char* mixeroutformats[] = {"16bit", "24bit", "float", nullptr };
     const char* capturechromaformats[] = { "auto", "4:4:4", "4:2:2", "4:2:0", nullptr };
     const char* controllertypes[] = { "auto", "at", "xt", "pcjr", "pc98", nullptr }; // Future work: Tandy(?) and USB
     const char* auxdevices[] = {"none","2button","3button","intellimouse","intellimouse45",nullptr};
@@ -1970,6 +1971,16 @@ void DOSBOX_SetupConfigSections(void) {
         "For Tandy and PCjr emulation, it is strongly recommended.\n"
         "to specify a size that is a multiple of 32 (kb).\n");
 
+    Pbool = secprop->Add_bool("release freed memory", Property::Changeable::OnlyAtStart,false);
+    Pbool->Set_help("If set, extended memory that XMS/EMS clients free is handed back to the host OS, so the\n"
+                    "memory use of DOSBox-X follows what the guest actually has allocated. Freed memory reads as zero\n"
+                    "once it is allocated again. Only applies when guest memory is not backed by a memory file.");
+
+    Pbool = secprop->Add_bool("mergeable memory", Property::Changeable::OnlyAtStart,false);
+    Pbool->Set_help("If set, guest memory is marked so that the host OS may merge identical pages (Linux KSM).\n"
+                    "This can save a lot of memory when running many instances, at the cost of some CPU time on the host.\n"
+                    "Only applies when guest memory is not backed by a memory file.");
+
     Pint = secprop->Add_int("dos mem limit", Property::Changeable::WhenIdle,0);
     Pint->SetMinMax(0,1023);
     Pint->Set_help( "Limit DOS conventional memory to this amount. Does not affect extended memory.\n"
@@ -3442,6 +3453,21 @@ void DOSBOX_SetupConfigSections(void) {
     Pint->Set_help("How many milliseconds of data to keep on top of the blocksize.");
     Pint->SetBasic(true);
 
+    Pint = secprop->Add_int("cd-da prebuffer",Property::Changeable::OnlyAtStart,500);
+    Pint->SetMinMax(0,5000);
+    Pint->Set_help("How many milliseconds of CD audio to decode ahead on a separate thread for compressed audio tracks\n"
+            "(Vorbis, FLAC, Opus or MP3 files referenced by a CUE sheet). Set to 0 to decode on the emulation thread.");
+
+    Pstring = secprop->Add_string("output format",Property::Changeable::OnlyAtStart,"16bit");
+    Pstring->Set_values(mixeroutformats);
+    Pstring->Set_help("Sample format sent to the host audio device. The mix itself is done in floating point either way.\n"
+            "24bit is sent in a 32-bit container. 24bit and float need SDL2, SDL1 builds always use 16bit.");
+
+    Pstring = secprop->Add_string("wave capture format",Property::Changeable::WhenIdle,"16bit");
+    Pstring->Set_values(mixeroutformats);
+    Pstring->Set_help("Sample format of WAV audio captures. 24bit adds resolution but clips at the same full scale as 16bit,\n"
+            "only float keeps the headroom above full scale. Video and multitrack captures are always 16-bit.");
+
     secprop=control->AddSection_prop("midi",&Null_Init,true);//done
 
     Pbool = secprop->Add_bool("roland gs sysex",Property::Changeable::OnlyAtStart,true);
@@ -3688,6 +3714,20 @@ void DOSBOX_SetupConfigSections(void) {
 	Pint = secprop->Add_int("fluid.chorus.type",Property::Changeable::WhenIdle,0);
 	Pint->Set_values(fluidchorustypes);
 	Pint->Set_help("Fluidsynth chorus type. 0 is sine wave, 1 is triangle wave.");
+
+	Pbool = secprop->Add_bool("synth.thread",Property::Changeable::WhenIdle,false);
+	Pbool->Set_help("Render the built-in MIDI synth (mididevice=synth) in a separate thread.\n"
+		"MIDI events are timestamped and applied at the exact sample they are due, at a fixed latency of synth.prebuffer.");
+
+	Pint = secprop->Add_int("synth.prebuffer",Property::Changeable::WhenIdle,32);
+	Pint->SetMinMax(3,200);
+	Pint->Set_help("How many milliseconds of audio the synth render thread stays ahead of the mixer. (min 3, max 200)\n"
+		"Increasing this value may help to avoid underruns but also increases audio lag.");
+
+	Pint = secprop->Add_int("synth.cpu-cores",Property::Changeable::WhenIdle,1);
+	Pint->SetMinMax(1,256);
+	Pint->Set_help("Number of CPU cores the built-in MIDI synth renders voices on. Values above 1 let dense pieces with large\n"
+		"soundfonts spread their voices across additional threads.");
 #endif
 
 	{
@@ -4094,6 +4134,12 @@ void DOSBOX_SetupConfigSections(void) {
     Pint->Set_values(qualityno);
     Pint->Set_help("Set SID emulation quality level (0 to 3).");
     Pint->SetBasic(true);
+    Pbool = secprop->Add_bool("thread",Property::Changeable::WhenIdle,false);
+    Pbool->Set_help("Render the SID in a separate thread. Register writes are timestamped and applied at the exact\n"
+        "sample they are due, at a fixed latency of prebuffer. Mostly useful with the resampling quality levels 2 and 3.");
+    Pint = secprop->Add_int("prebuffer",Property::Changeable::WhenIdle,20);
+    Pint->SetMinMax(3,200);
+    Pint->Set_help("How many milliseconds of audio the SID render thread stays ahead of the mixer. (min 3, max 200)");
 
     secprop = control->AddSection_prop("imfc", &Null_Init, Property::Changeable::WhenIdle);
     Pbool = secprop->Add_bool("imfc", Property::Changeable::WhenIdle, false);
@@ -4570,6 +4616,21 @@ void DOSBOX_SetupConfigSections(void) {
     Pstring = secprop->Add_string("mscdex device name",Property::Changeable::WhenIdle,"");
     Pstring->Set_help("If set, use this name as the MSCDEX device name instead of MSCD001");
 
+    Pint = secprop->Add_int("chd hunk cache",Property::Changeable::OnlyAtStart,64);
+    Pint->SetMinMax(1,4096);
+    Pint->Set_help("Number of decompressed hunks to keep in memory per mounted CHD image. A CD-ROM CHD hunk is usually 8 sectors (about 19KB).\n"
+            "A larger cache helps programs that jump back and forth, such as FMV games interleaving CD audio and data reads.");
+
+    Pint = secprop->Add_int("chd read ahead",Property::Changeable::OnlyAtStart,4);
+    Pint->SetMinMax(0,256);
+    Pint->Set_help("Number of CHD hunks to decompress ahead of the current read position, in the direction the reads are moving.\n"
+            "Set to 0 to disable read-ahead.");
+
+    Pint = secprop->Add_int("chd threads",Property::Changeable::OnlyAtStart,2);
+    Pint->SetMinMax(0,16);
+    Pint->Set_help("Number of threads per mounted CHD image that decompress read-ahead hunks in the background.\n"
+            "Set to 0 to decompress only on demand on the emulation thread.");
+
     Pbool = secprop->Add_bool("hma",Property::Changeable::WhenIdle,true);
     Pbool->Set_help("Report through XMS that HMA exists (not necessarily available)");
     Pbool->SetBasic(true);
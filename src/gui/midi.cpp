@@ -509,7 +509,72 @@ void MIDI_State_LoadMessage()
 }
 
 
+/* Software synths load their ROMs or SoundFonts when opened, which is the slow
+ * part of starting up. When one is selected by name it is opened on the first
+ * MIDI byte instead, until then MIDI is reported available with no handler. */
+static bool midi_open_pending = false;
+static std::string midi_pending_dev, midi_pending_conf;
+
+static bool MIDI_OpenLate(const char *dev) {
+	return !strcasecmp(dev,"mt32") || !strcasecmp(dev,"fluidsynth") || !strcasecmp(dev,"synth");
+}
+
+static MidiHandler *MIDI_OpenHandler(const char *dev, const char *conf) {
+	/* If device = "default" go for first handler that works */
+	MidiHandler * handler;
+	bool opened = false;
+
+	if (strcasecmp(dev,"default")) {
+		for (handler = handler_list; handler; handler = handler->next) {
+			if (!strcasecmp(dev,handler->GetName())) {
+				opened = handler->Open(conf);
+				break;
+			}
+		}
+		if (handler == NULL)
+			LOG_MSG("MIDI:Cannot find device:%s. Finding default handler.",dev);
+		else if (!opened)
+			LOG_MSG("MIDI:Cannot open device:%s with config:%s. Finding default handler.",dev,conf);
+	}
+
+	if (!opened) {
+		for (handler = handler_list; handler; handler = handler->next) {
+			opened = handler->Open(conf);
+			if (opened) break;
+		}
+	}
+
+	if (!opened) {
+		// This shouldn't be possible
+		LOG_MSG("MIDI:Could not open a handler");
+		return NULL;
+	}
+
+	LOG_MSG("MIDI:Opened device:%s",handler->GetName());
+	return handler;
+}
+
+void MIDI_OpenPending(void) {
+	if (!midi_open_pending) return;
+	midi_open_pending = false;
+
+	MidiHandler *handler = MIDI_OpenHandler(midi_pending_dev.c_str(), midi_pending_conf.c_str());
+	if (handler == NULL) {
+		midi.available = false;
+		midi.handler = nullptr;
+		return;
+	}
+	midi.handler = handler;
+
+	// force reset to prevent crashes (when not properly shutdown)
+	midi_state[0].init = false;
+	MIDI_State_LoadMessage();
+}
+
 void MIDI_RawOutByte(uint8_t data) {
+	if (midi_open_pending) MIDI_OpenPending();
+	if (midi.handler == nullptr) return;
+
 	if (midi.sysex.start) {
 		uint32_t passed_ticks = GetTicks() - midi.sysex.start;
 		if (passed_ticks < midi.sysex.delay) SDL_Delay((Uint32)(midi.sysex.delay - passed_ticks));
@@ -618,10 +683,6 @@ public:
 #endif
 		if (control->opt_silent) dev = "none";
 
-		/* If device = "default" go for first handler that works */
-		MidiHandler * handler;
-		bool opened = false;
-
 		roland_gs_sysex = section->Get_bool("roland gs sysex");
 
 //		MAPPER_AddHandler(MIDI_SaveRawEvent,MK_f8,MMOD1|MMOD2,"caprawmidi","Cap MIDI");
@@ -639,35 +700,21 @@ public:
 		midi.cmd_pos=0;
 		midi.cmd_len=0;
 
-		if (strcasecmp(dev,"default")) {
-			for (handler = handler_list; handler; handler = handler->next) {
-				if (!strcasecmp(dev,handler->GetName())) {
-					opened = handler->Open(conf);
-					break;
-				}
-			}
-			if (handler == NULL)
-				LOG_MSG("MIDI:Cannot find device:%s. Finding default handler.",dev);
-			else if (!opened)
-				LOG_MSG("MIDI:Cannot open device:%s with config:%s. Finding default handler.",dev,conf);
-		}
-
-		if (!opened) {
-			for (handler = handler_list; handler; handler = handler->next) {
-				opened = handler->Open(conf);
-				if (opened) break;
-			}
-		}
-
-		if (!opened) {
-			// This shouldn't be possible
-			LOG_MSG("MIDI:Could not open a handler");
+		if (MIDI_OpenLate(dev)) {
+			midi_pending_dev = dev;
+			midi_pending_conf = conf;
+			midi_open_pending = true;
+			midi.available = true;
+			midi.handler = nullptr;
+			LOG(LOG_MISC,LOG_DEBUG)("MIDI:Opening device %s on first use",dev);
 			return;
 		}
 
+		MidiHandler *handler = MIDI_OpenHandler(dev, conf);
+		if (handler == NULL) return;
+
 		midi.available=true;
 		midi.handler=handler;
-		LOG_MSG("MIDI:Opened device:%s",handler->GetName());
 
 		// force reset to prevent crashes (when not properly shutdown)
 		// ex. Roland VSC = unexpected hard system crash
@@ -675,6 +722,13 @@ public:
 		MIDI_State_LoadMessage();
 	}
 	~MIDI(){
+		if (midi_open_pending) {
+			// Never used, nothing to flush or close
+			midi_open_pending = false;
+			midi.available = false;
+			return;
+		}
+		if (midi.handler == nullptr) return;
 		if( midi.status < 0xf0 ) {
 			// throw invalid midi message - start new cmd
 			MIDI_RawOutByte(0x80);
@@ -23,6 +23,8 @@
 #endif
 #include <math.h>
 #include <string.h>
+#include <deque>
+#include <vector>
 #include "control.h"
 
 /* Protect against multiple inclusions */
@@ -59,16 +61,68 @@ static void synth_log(int level,
 	}
 }
 
-static void synth_CallBack(Bitu len) {
-	if (synth_soft != NULL) {
-		fluid_synth_write_s16(synth_soft, (int)len, MixTemp, 0, 2, MixTemp, 1, 2);
-		if (master_volume < 128) {
-			for (unsigned int i=0;i < (len*2);i++) {
-				((int16_t*)MixTemp)[i] = (int16_t)(((((int16_t*)MixTemp)[i]) * master_volume) >> 7);
-			}
+static void synth_Render(int16_t *buf, Bitu frames) {
+	fluid_synth_write_s16(synth_soft, (int)frames, buf, 0, 2, buf, 1, 2);
+	if (master_volume < 128) {
+		for (unsigned int i=0;i < (frames*2);i++) {
+			buf[i] = (int16_t)((buf[i] * master_volume) >> 7);
 		}
+	}
+}
+
+/* synth.thread: the render thread keeps a ring of synthesized audio synth.prebuffer ms
+ * ahead of the mixer. MIDI events are queued with the output frame they are due at and
+ * applied by the render thread just before that frame, so timing stays sample accurate
+ * at a constant latency instead of being quantized to the render chunk size. */
+struct synth_event {
+	uint64_t frame;
+	std::vector<uint8_t> msg;
+};
+
+static bool synth_threaded = false;
+static SDL_Thread *synth_thread = NULL;
+static SDL_mutex *synth_lock = NULL;
+static SDL_cond *synth_cond = NULL;
+static std::deque<synth_event> synth_events;
+static std::vector<int16_t> synth_ring;		// stereo frames
+static Bitu synth_ring_frames = 0;
+static Bitu synth_min_render = 0;			// frames, smallest chunk worth waking up for
+static uint64_t synth_rendered = 0;			// frames rendered into the ring so far
+static uint64_t synth_played = 0;			// frames handed to the mixer so far
+static bool synth_stop = false;
+
+static void synth_CallBack(Bitu len) {
+	if (synth_soft == NULL) return;
+
+	if (!synth_threaded) {
+		synth_Render((int16_t*)MixTemp, len);
 		synthchan->AddSamples_s16(len,(int16_t *)MixTemp);
+		return;
 	}
+
+	if (len > (sizeof(MixTemp)/4)) len = sizeof(MixTemp)/4;
+
+	SDL_LockMutex(synth_lock);
+	while (synth_rendered == synth_played && !synth_stop)
+		SDL_CondWait(synth_cond, synth_lock);
+
+	Bitu avail = (Bitu)(synth_rendered - synth_played);
+	if (len > avail) len = avail;
+
+	int16_t *out = (int16_t*)MixTemp;
+	for (Bitu done = 0;done < len;) {
+		const Bitu pos = (Bitu)(synth_played % synth_ring_frames);
+		Bitu todo = synth_ring_frames - pos;
+		if (todo > (len - done)) todo = len - done;
+		memcpy(out + (done * 2), &synth_ring[pos * 2], todo * 4);
+		synth_played += todo;
+		done += todo;
+	}
+
+	SDL_CondSignal(synth_cond);
+	SDL_UnlockMutex(synth_lock);
+
+	if (len > 0) synthchan->AddSamples_s16(len,(int16_t *)MixTemp);
 }
 
 #if defined (WIN32) || defined (OS2)
@@ -85,6 +139,58 @@ private:
 	int sfont_id;
 	bool isOpen;
 
+	static int RenderThread(void *data) {
+		((MidiHandler_synth*)data)->RenderLoop();
+		return 0;
+	}
+
+	void RenderLoop(void) {
+		std::vector<synth_event> due;
+
+		SDL_LockMutex(synth_lock);
+		while (!synth_stop) {
+			const Bitu room = synth_ring_frames - (Bitu)(synth_rendered - synth_played);
+			if (room == 0 || (room < synth_min_render && synth_events.empty())) {
+				SDL_CondWait(synth_cond, synth_lock);
+				continue;
+			}
+
+			while (!synth_events.empty() && synth_events.front().frame <= synth_rendered) {
+				due.push_back(std::move(synth_events.front()));
+				synth_events.pop_front();
+			}
+
+			/* render up to the next queued event, or as far as there is room */
+			Bitu todo = room;
+			if (!synth_events.empty() && (synth_events.front().frame - synth_rendered) < todo)
+				todo = (Bitu)(synth_events.front().frame - synth_rendered);
+
+			const Bitu pos = (Bitu)(synth_rendered % synth_ring_frames);
+			if (todo > (synth_ring_frames - pos)) todo = synth_ring_frames - pos;
+
+			SDL_UnlockMutex(synth_lock);
+			for (auto &ev : due) PlayEvent(ev.msg.data(), ev.msg.size());
+			due.clear();
+			synth_Render(&synth_ring[pos * 2], todo);
+			SDL_LockMutex(synth_lock);
+
+			synth_rendered += todo;
+			SDL_CondSignal(synth_cond);
+		}
+		SDL_UnlockMutex(synth_lock);
+	}
+
+	void QueueEvent(const uint8_t *msg, Bitu len) {
+		synth_event ev;
+		ev.msg.assign(msg, msg + len);
+
+		SDL_LockMutex(synth_lock);
+		ev.frame = synth_played + synth_ring_frames;
+		synth_events.push_back(std::move(ev));
+		SDL_CondSignal(synth_cond);
+		SDL_UnlockMutex(synth_lock);
+	}
+
 	void PlayEvent(uint8_t *msg, Bitu len) {
 		uint8_t event = msg[0], channel, p1, p2;
 
@@ -219,8 +325,11 @@ public:
 			return false;
 		}
 
+		Section_prop *section = static_cast<Section_prop *>(control->GetSection("midi"));
+
 		fluid_settings_setstr(settings, "audio.sample-format", "16bits");
 		fluid_settings_setnum(settings, "synth.sample-rate", (double)synthsamplerate);
+		fluid_settings_setint(settings, "synth.cpu-cores", section->Get_int("synth.cpu-cores"));
 		//fluid_settings_setnum(settings, "synth.gain", 0.5);
 
 		/* Create the synthesizer. */
@@ -251,6 +360,40 @@ public:
 		master_volume = 128;
 		synthchan = MIXER_AddChannel(synth_CallBack, (unsigned int)synthsamplerate, "SYNTH");
 		synthchan->Enable(false);
+
+		synth_threaded = section->Get_bool("synth.thread");
+		if (synth_threaded) {
+			const int prebuffer = section->Get_int("synth.prebuffer");
+			synth_ring_frames = (Bitu)((prebuffer * synthsamplerate) / 1000);
+			if (synth_ring_frames < 64) synth_ring_frames = 64;
+			synth_min_render = synth_ring_frames / 4;
+			synth_ring.assign(synth_ring_frames * 2, 0);
+			synth_events.clear();
+			synth_rendered = synth_played = 0;
+			synth_stop = false;
+			synth_lock = SDL_CreateMutex();
+			synth_cond = SDL_CreateCond();
+			if (synth_lock != NULL && synth_cond != NULL) {
+#if defined(C_SDL2)
+				synth_thread = SDL_CreateThread(RenderThread, "SYNTH", this);
+#else
+				synth_thread = SDL_CreateThread(RenderThread, this);
+#endif
+			}
+			if (synth_thread != NULL) {
+				LOG_MSG("MIDI synth: rendering in a separate thread, %d ms ahead", prebuffer);
+			}
+			else {
+				LOG_MSG("MIDI synth: Unable to start render thread, rendering from the mixer");
+				if (synth_lock != NULL) SDL_DestroyMutex(synth_lock);
+				if (synth_cond != NULL) SDL_DestroyCond(synth_cond);
+				synth_lock = NULL;
+				synth_cond = NULL;
+				synth_ring.clear();
+				synth_threaded = false;
+			}
+		}
+
 		isOpen = true;
 		return true;
 	};
@@ -259,6 +402,21 @@ public:
 		if (!isOpen) return;
 
 		synthchan->Enable(false);
+		if (synth_threaded) {
+			SDL_LockMutex(synth_lock);
+			synth_stop = true;
+			SDL_CondBroadcast(synth_cond);
+			SDL_UnlockMutex(synth_lock);
+			SDL_WaitThread(synth_thread, NULL);
+			synth_thread = NULL;
+			SDL_DestroyMutex(synth_lock);
+			synth_lock = NULL;
+			SDL_DestroyCond(synth_cond);
+			synth_cond = NULL;
+			synth_events.clear();
+			synth_ring.clear();
+			synth_threaded = false;
+		}
 		MIXER_DelChannel(synthchan);
 		delete_fluid_synth(synth_soft);
 		delete_fluid_settings(settings);
@@ -271,11 +429,13 @@ public:
 
 	void PlayMsg(uint8_t *msg) override {
 		synthchan->Enable(true);
-		PlayEvent(msg, MIDI_evt_len[*msg]);
+		if (synth_threaded) QueueEvent(msg, MIDI_evt_len[*msg]);
+		else PlayEvent(msg, MIDI_evt_len[*msg]);
 	};
 
 	void PlaySysex(uint8_t *sysex, Bitu len) override {
-		PlayEvent(sysex, len);
+		if (synth_threaded) QueueEvent(sysex, len);
+		else PlayEvent(sysex, len);
 	};
 
 	void ListAll(Program* base) override {
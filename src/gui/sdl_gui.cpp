@@ -2576,6 +2576,7 @@ protected:
 public:
     ShowMidiDevice(GUI::Screen *parent, int x, int y, const char *title) :
         ToplevelWindow(parent, x, y, 320, 260, title) {
+            MIDI_OpenPending();
             std::string name=!midi.handler||!midi.handler->GetName()?"-":midi.handler->GetName();
             std::string sf_rom{};
             if (name.size()) {
@@ -110,6 +110,7 @@ char* revert_escape_newlines(const char* aMessage);
 #include <stdarg.h>
 #include <sys/types.h>
 #include <algorithm> // std::transform
+#include <chrono>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <gtest/gtest.h>
@@ -143,6 +144,7 @@ char* revert_escape_newlines(const char* aMessage);
 #include "inout.h"
 #include "jfont.h"
 #include "render.h"
+#include "forkserver.h"
 #include "../dos/cdrom.h"
 #include "../dos/drives.h"
 #include "../ints/int10.h"
@@ -3795,6 +3797,8 @@ static void GUI_StartUp() {
     MAPPER_AddHandler(RebootGuest, MK_b, MMODHOST, "reboot", "Reboot DOS system", &item); /* Reboot guest system or integrated DOS */
     item->set_text("Reboot guest system");
 
+    FORKSERVER_Init();
+
 #if !defined(HX_DOS)
     MAPPER_AddHandler(LoadMapFile, MK_nothing, 0, "loadmap", "Load mapper file", &item);
     item->set_text("Load mapper file...");
@@ -7219,6 +7223,9 @@ bool DOSBOX_parse_argv() {
             fprintf(stderr,"  -set <section property=value>           Set the config option (overriding the config file).\n");
             fprintf(stderr,"                                          Make sure to surround the string in quotes to cover spaces.\n");
             fprintf(stderr,"  -time-limit <n>                         Kill the emulator after 'n' seconds\n");
+#if defined(LINUX)
+            fprintf(stderr,"  -fork-server <socket>                   Fork copies of the machine on request from the FORKPT command\n");
+#endif
             fprintf(stderr,"  -fastlaunch                             Fast launch mode (skip the BIOS logo and welcome banner)\n");
 #if C_DEBUG
             fprintf(stderr,"  -helpdebug                              Show debug-related options\n");
@@ -7250,6 +7257,7 @@ bool DOSBOX_parse_argv() {
             fprintf(stderr,"  -nolog                                  Do not log anything to log file\n");
             fprintf(stderr,"  -tests                                  Run unit tests to test the DOSBox-X code\n");
             fprintf(stderr,"  -print-ticks                            (Debug) Print emulator time and SDL_GetTicks()\n");
+            fprintf(stderr,"  -time-startup                           (Debug) Log the time taken by each startup function\n");
             fprintf(stderr,"  -force-gfx-hardware                     Force render scaler system to act as if GFX_HARDWARE\n");
             fprintf(stderr,"\n");
 
@@ -7488,6 +7496,12 @@ bool DOSBOX_parse_argv() {
             control->opt_print_ticks = true;
             control->opt_console = true;
         }
+        else if (optname == "time-startup") {
+            control->opt_time_startup = true;
+        }
+        else if (optname == "fork-server") {
+            if (!control->cmdline->NextOptArgv(control->opt_fork_server)) return false;
+        }
         else if (optname == "socket") {
             if (!control->cmdline->NextOptArgv(tmp)) return false;
             socknum = std::stoi(tmp);
@@ -7609,6 +7623,15 @@ void FDC_Primary_Init();
 void AUTOEXEC_Init();
 void DOS_InitClock();
 
+/* -time-startup: runs an init function and records how long it took */
+#define STARTUP_STEP(x) do { \
+        const std::chrono::steady_clock::time_point startup_t0 = std::chrono::steady_clock::now(); \
+        x(); \
+        if (control->opt_time_startup) \
+            STARTUP_AddTime(#x, std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - startup_t0).count()); \
+    } while (0)
+
+
 #if defined(WIN32)
 // NTS: I intend to add code that not only indicates High DPI awareness but also queries the monitor DPI
 //      and then factor the DPI into DOSBox-X's scaler and UI decisions.
@@ -9236,77 +9259,77 @@ int main(int argc, char* argv[]) SDL_MAIN_NOEXCEPT {
 
         /* Start up main machine */
 
-        MAPPER_StartUp();
-        DOSBOX_InitTickLoop();
-        DOSBOX_RealInit();
+        STARTUP_STEP(MAPPER_StartUp);
+        STARTUP_STEP(DOSBOX_InitTickLoop);
+        STARTUP_STEP(DOSBOX_RealInit);
 
         /* at this point: If the machine type is PC-98, and the mapper keyboard layout was "Japanese",
          * then change the mapper layout to "Japanese PC-98" */
         if (host_keyboard_layout == DKM_JPN && IS_PC98_ARCH)
             SetMapperKeyboardLayout(DKM_JPN_PC98);
 
-        RENDER_Init();
-        CAPTURE_Init();
-        IO_Init();
-        HARDWARE_Init();
-        CPU_PreInit();
-        Init_AddressLimitAndGateMask(); /* <- need to init address mask so Init_RAM knows the maximum amount of RAM possible */
-        Init_MemoryAccessArray(); /* <- NTS: In DOSBox-X this is the "cache" of devices that responded to memory access */
-        Init_A20_Gate(); // FIXME: Should be handled by motherboard!
-        Init_PS2_Port_92h(); // FIXME: Should be handled by motherboard!
-        Init_RAM();
-        Init_DMA();
-        Init_PIC();
-        TIMER_Init();
-        PCIBUS_Init();
-        PAGING_Init(); /* <- NTS: At this time, must come before memory init because paging is so well integrated into emulation code */
-        CMOS_Init();
-        ROMBIOS_Init();
-        CALLBACK_Init(); /* <- NTS: This relies on ROM BIOS allocation and it must happen AFTER ROMBIOS init */
+        STARTUP_STEP(RENDER_Init);
+        STARTUP_STEP(CAPTURE_Init);
+        STARTUP_STEP(IO_Init);
+        STARTUP_STEP(HARDWARE_Init);
+        STARTUP_STEP(CPU_PreInit);
+        STARTUP_STEP(Init_AddressLimitAndGateMask); /* <- need to init address mask so Init_RAM knows the maximum amount of RAM possible */
+        STARTUP_STEP(Init_MemoryAccessArray); /* <- NTS: In DOSBox-X this is the "cache" of devices that responded to memory access */
+        STARTUP_STEP(Init_A20_Gate); // FIXME: Should be handled by motherboard!
+        STARTUP_STEP(Init_PS2_Port_92h); // FIXME: Should be handled by motherboard!
+        STARTUP_STEP(Init_RAM);
+        STARTUP_STEP(Init_DMA);
+        STARTUP_STEP(Init_PIC);
+        STARTUP_STEP(TIMER_Init);
+        STARTUP_STEP(PCIBUS_Init);
+        STARTUP_STEP(PAGING_Init); /* <- NTS: At this time, must come before memory init because paging is so well integrated into emulation code */
+        STARTUP_STEP(CMOS_Init);
+        STARTUP_STEP(ROMBIOS_Init);
+        STARTUP_STEP(CALLBACK_Init); /* <- NTS: This relies on ROM BIOS allocation and it must happen AFTER ROMBIOS init */
 #if C_DEBUG
-        DEBUG_Init(); /* <- NTS: Relies on callback system */
-#endif
-        Init_VGABIOS();
-        VOODOO_Init();
-        GLIDE_Init();
-        PROGRAMS_Init(); /* <- NTS: Does not init programs, it inits the callback used later when creating the .COM programs on drive Z: */
-        PCSPEAKER_Init();
-        TANDYSOUND_Init();
-        MPU401_Init();
-        MIXER_Init();
-        MIDI_Init();
+        STARTUP_STEP(DEBUG_Init); /* <- NTS: Relies on callback system */
+#endif
+        STARTUP_STEP(Init_VGABIOS);
+        STARTUP_STEP(VOODOO_Init);
+        STARTUP_STEP(GLIDE_Init);
+        STARTUP_STEP(PROGRAMS_Init); /* <- NTS: Does not init programs, it inits the callback used later when creating the .COM programs on drive Z: */
+        STARTUP_STEP(PCSPEAKER_Init);
+        STARTUP_STEP(TANDYSOUND_Init);
+        STARTUP_STEP(MPU401_Init);
+        STARTUP_STEP(MIXER_Init);
+        STARTUP_STEP(MIDI_Init);
         {
             DOSBoxMenu::item *item;
 
             MAPPER_AddHandler(Sendkeymapper, MK_delete, MMODHOST, "sendkey_mapper", "Send special key", &item);
             item->set_text("Send special key");
         }
-        CPU_Init();
-        Weitek_Init();
+        STARTUP_STEP(CPU_Init);
+        STARTUP_STEP(Weitek_Init);
 #if C_FPU
-        FPU_Init();
-#endif
-        VGA_Init();
-        ISAPNP_Cfg_Init();
-        FDC_Primary_Init();
-        KEYBOARD_Init();
-        SBLASTER_Init();
-        JOYSTICK_Init();
-        PS1SOUND_Init();
-        DISNEY_Init();
-        GUS_Init();
-        IDE_Init();
-        IMFC_Init();
-        INNOVA_Init();
-        BIOS_Init();
-        INT10_Init();
-        SERIAL_Init();
-        DONGLE_Init();
+        STARTUP_STEP(FPU_Init);
+#endif
+        STARTUP_STEP(VGA_Init);
+        STARTUP_STEP(ISAPNP_Cfg_Init);
+        STARTUP_STEP(FDC_Primary_Init);
+        STARTUP_STEP(KEYBOARD_Init);
+        STARTUP_STEP(SBLASTER_Init);
+        STARTUP_STEP(JOYSTICK_Init);
+        STARTUP_STEP(PS1SOUND_Init);
+        STARTUP_STEP(DISNEY_Init);
+        STARTUP_STEP(GUS_Init);
+        STARTUP_STEP(IDE_Init);
+        STARTUP_STEP(IMFC_Init);
+        STARTUP_STEP(INNOVA_Init);
+        STARTUP_STEP(BIOS_Init);
+        STARTUP_STEP(INT10_Init);
+        STARTUP_STEP(SERIAL_Init);
+        STARTUP_STEP(DONGLE_Init);
 #if C_PRINTER
-        PRINTER_Init();
+        STARTUP_STEP(PRINTER_Init);
 #endif
-        PARALLEL_Init();
-        NE2K_Init();
+        STARTUP_STEP(PARALLEL_Init);
+        STARTUP_STEP(NE2K_Init);
 
 #if DOSBOXMENU_TYPE == DOSBOXMENU_HMENU
         Reflect_Menu();
@@ -9353,30 +9376,30 @@ int main(int argc, char* argv[]) SDL_MAIN_NOEXCEPT {
 #endif
 
         /* OS init now */
-        DOS_Init();
-        DRIVES_Init();
-        DOS_KeyboardLayout_Init();
-        MOUSE_Init(); // FIXME: inits INT 15h and INT 33h at the same time. Also uses DOS_GetMemory() which is why DOS_Init must come first
-        XMS_Init();
-        EMS_Init();
-        AUTOEXEC_Init();
+        STARTUP_STEP(DOS_Init);
+        STARTUP_STEP(DRIVES_Init);
+        STARTUP_STEP(DOS_KeyboardLayout_Init);
+        STARTUP_STEP(MOUSE_Init); // FIXME: inits INT 15h and INT 33h at the same time. Also uses DOS_GetMemory() which is why DOS_Init must come first
+        STARTUP_STEP(XMS_Init);
+        STARTUP_STEP(EMS_Init);
+        STARTUP_STEP(AUTOEXEC_Init);
 #if C_IPX
-        IPX_Init();
+        STARTUP_STEP(IPX_Init);
 #endif
-        MSCDEX_Init();
-        CDROM_Image_Init();
+        STARTUP_STEP(MSCDEX_Init);
+        STARTUP_STEP(CDROM_Image_Init);
 
         /* Init memhandle system. This part is used by DOSBox-X's XMS/EMS emulation to associate handles
          * per page. FIXME: I would like to push this down to the point that it's never called until
          * XMS/EMS emulation needs it. I would also like the code to free the mhandle array immediately
          * upon booting into a guest OS, since memory handles no longer have meaning in the guest OS
          * memory layout. */
-        Init_MemHandles();
+        STARTUP_STEP(Init_MemHandles);
 
         /* finally, the mapper */
-        MAPPER_Init();
+        STARTUP_STEP(MAPPER_Init);
         AllocCallback2();
-        MSG_Init();
+        STARTUP_STEP(MSG_Init);
 
         /* stop at this point, and show the configuration tool/mapper editor, if instructed */
         if (control->opt_startui) {
@@ -9735,6 +9758,9 @@ fresh_boot:
             else {
                 LOG(LOG_MISC,LOG_DEBUG)("Emulation threw DOSBox-X kill switch signal");
 
+                /* the threads the normal shutdown waits for were left behind in the fork server */
+                if (FORKSERVER_IsChild()) FORKSERVER_ExitChild(0);
+
                 // kill switch (see instances of throw(0) and throw(1) elsewhere in DOSBox)
                 run_machine = false;
                 dos_kernel_shutdown = false;
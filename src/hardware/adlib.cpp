@@ -1054,6 +1054,7 @@ void Module::PortWrite( Bitu port, Bitu val, Bitu iolen ) {
 	if ( !mixerChan->enabled ) {
 		mixerChan->Enable(true);
 	}
+	mixerChan->WakeUp();
 
 	if ( mode == MODE_ESFM && esfm_nativemode ) {
 		switch (port & 3)
@@ -1256,12 +1257,14 @@ static Adlib::Module * module = nullptr;
 
 static void OPL_CallBack(Bitu len) {
 	module->handler->Generate( module->mixerChan, len );
-	//Disable the sound generation after 30 seconds of silence
-	if ((PIC_Ticks - module->lastUsed) > 30000) {
+	//Stop sound generation once every note is keyed off and the output has decayed to nothing.
+	//Register writes wake the channel up again, the OPL timers do not depend on sample generation.
+	//ESFM native mode does not go through the register cache, so there is no key-on state to check.
+	if (module->mixerChan->IsQuiet(100) && !module->esfm_nativemode) {
 		Bitu i;
 		for (i=0xb0;i<0xb9;i++) if (module->cache[i]&0x20||module->cache[i+0x100]&0x20) break;
-		if (i==0xb9) module->mixerChan->Enable(false);
-		else module->lastUsed = (uint32_t)PIC_Ticks;
+		//0xBD: rhythm mode in bit 5, key-on of the five drums in bits 0-4
+		if (i==0xb9 && (module->cache[0xbd]&0x3f) <= 0x20) module->mixerChan->Sleep();
 	}
 }
 
@@ -198,7 +198,7 @@ class Module: public Module_base {
 public:
 	static OPL_Mode oplmode;
 	MixerChannel* mixerChan;
-	uint32_t lastUsed;				//Ticks when adlib was last used to turn of mixing after a few second
+	uint32_t lastUsed;				//Ticks when adlib was last written to
 	bool esfm_nativemode;			// When using MODE_ESFM, whether the synth is in native mode or not - affects port mapping
 
 	Handler* handler;				//Handler that will generate the sound
@@ -34,13 +34,14 @@
 
 //My mixer channel
 static MixerChannel * cms_chan;
-//Timer to disable the channel after a while
+//Time of the last write
 static uint32_t lastWriteTicks;
 static uint32_t cmsBase;
 static saa1099_device* device[2];
 
 static void write_cms(Bitu port, Bitu val, Bitu /* iolen */) {
 	if(cms_chan && (!cms_chan->enabled)) cms_chan->Enable(true);
+	if(cms_chan) cms_chan->WakeUp();
 	lastWriteTicks = (uint32_t)PIC_Ticks;
 	switch ( port - cmsBase ) {
 	case 1:
@@ -68,11 +69,6 @@ static void CMS_CallBack(Bitu len) {
 
 	if ( cms_chan ) {
 
-		//Have there been 10 seconds of no commands, disable channel
-		if ( lastWriteTicks + 10000 < PIC_Ticks ) {
-			cms_chan->Enable( false );
-			return;
-		}
 		int32_t result[BUFFER_SIZE][2];
 		int16_t work[2][BUFFER_SIZE];
 		int16_t* buffers[2] = { work[0], work[1] };
@@ -88,6 +84,10 @@ static void CMS_CallBack(Bitu len) {
 			result[i][1] += work[1][i];
 		}
 		cms_chan->AddSamples_s32( len, result[0] );
+
+		//Sleep once the output has been silent for a second. Slow envelopes can sit at zero
+		//for a while before coming back, so wait longer than for the other chips.
+		if ( cms_chan->IsQuiet( 1000 ) ) cms_chan->Sleep();
 	}
 }
 
@@ -452,10 +452,100 @@ class GUSChannel {
 			UpdateVolumes();
 		}
 
-		void generateSamples(int32_t* stream, uint32_t len) {
-			int32_t tmpsamp;
-			int i;
+		/* Number of samples (up to len) that can be rendered before WaveUpdate() does anything more than
+		 * step the current position, i.e. before the voice hits its end position (loop, stop, rollover, IRQ).
+		 * Returns 0 if the update after the very next sample hits it. */
+		INLINE uint32_t WaveRunLength(const uint32_t len) const {
+			if (WaveCtrl & (WCTRL_STOP | WCTRL_STOPPED)) return len; /* position does not move while stopped */
+
+			const uint32_t mask = (uint32_t)(((Bitu)1 << ((Bitu)WAVE_FRACT + (Bitu)20/*1MB*/)) - 1);
+			if (WaveCtrl & WCTRL_DECREASING/*backwards (direction)*/) {
+				/* the position is masked after stepping backwards, and a loop may have left it unmasked */
+				const uint32_t addr = WaveAddr & mask;
+				if (addr < WaveStart) return 0;
+				if (WaveAdd == 0) return len;
+				return std::min(len, (addr - WaveStart) / WaveAdd);
+			}
+			else {
+				const uint32_t limit = std::min(WaveEnd, mask);
+				if (WaveAddr > limit) return 0;
+				if (WaveAdd == 0) return len;
+				return std::min(len, (limit - WaveAddr) / WaveAdd);
+			}
+		}
+		/* Same for RampUpdate(): samples until the volume ramp reaches its end point or clamps */
+		INLINE uint32_t RampRunLength(const uint32_t len) const {
+			if (RampCtrl & 0x3) return len; /* ramping is off, the volume does not change */
 
+			if (RampCtrl & 0x40) {
+				if ((int32_t)RampVol <= (int32_t)RampStart) return 0;
+				if (RampAdd == 0) return len;
+				return std::min(len, (uint32_t)((int32_t)RampVol - (int32_t)RampStart - 1) / RampAdd);
+			}
+			else {
+				const int32_t limit = std::min((int32_t)RampEnd, (int32_t)(4096 << RAMP_FRACT));
+				if ((int32_t)RampVol >= limit) return 0;
+				if (RampAdd == 0) return len;
+				return std::min(len, (uint32_t)(limit - (int32_t)RampVol - 1) / RampAdd);
+			}
+		}
+		/* Render one sample and step the voice, handling any loop/end/ramp event it runs into.
+		 * Lc/Rc route the voice's left/right output to the output channels as the ICS mixer does. */
+		INLINE void RenderSample(int32_t* const sp,const unsigned char Lc,const unsigned char Rc) {
+			const int32_t tmpsamp = (WaveCtrl & WCTRL_16BIT) ? GetSample16() : GetSample8();
+			const int32_t L = tmpsamp * VolLeft;
+			const int32_t R = tmpsamp * VolRight;
+
+			if (Lc & 1) sp[0] += L;
+			if (Lc & 2) sp[1] += L;
+			if (Rc & 1) sp[0] += R;
+			if (Rc & 2) sp[1] += R;
+
+			WaveUpdate();
+			RampUpdate();
+		}
+		/* Render a run of samples known (from WaveRunLength/RampRunLength) to contain no loop/end/ramp event,
+		 * so that the position and volume simply step by a constant amount per sample. */
+		template <const bool sample16,const bool ramping> void RenderRun(int32_t* sp,const uint32_t count,const unsigned char Lc,const unsigned char Rc) {
+			const uint32_t step = (WaveCtrl & (WCTRL_STOP | WCTRL_STOPPED)) ? 0u : ((WaveCtrl & WCTRL_DECREASING) ? (0u - WaveAdd) : WaveAdd);
+			const int32_t LL = Lc & 1, LR = (Lc >> 1) & 1, RL = Rc & 1, RR = (Rc >> 1) & 1;
+			int32_t gainL = VolLeft * LL + VolRight * RL;
+			int32_t gainR = VolLeft * LR + VolRight * RR;
+			uint32_t addr = WaveAddr;
+
+			if (ramping) {
+				const uint32_t rampstep = (RampCtrl & 0x40) ? (0u - RampAdd) : RampAdd;
+				for (uint32_t i = 0; i < count; i++, sp += 2) {
+					const int32_t tmpsamp = sample16 ? myGUS.GetSample16(addr) : myGUS.GetSample8(addr);
+					sp[0] += tmpsamp * gainL;
+					sp[1] += tmpsamp * gainR;
+					addr += step;
+
+					RampVol += rampstep;
+					UpdateVolumes();
+					gainL = VolLeft * LL + VolRight * RL;
+					gainR = VolLeft * LR + VolRight * RR;
+				}
+			}
+			else {
+				for (uint32_t i = 0; i < count; i++, sp += 2) {
+					const int32_t tmpsamp = sample16 ? myGUS.GetSample16(addr) : myGUS.GetSample8(addr);
+					sp[0] += tmpsamp * gainL;
+					sp[1] += tmpsamp * gainR;
+					addr += step;
+				}
+			}
+
+			if (step != 0) addr &= ((Bitu)1 << ((Bitu)WAVE_FRACT + (Bitu)20/*1MB*/)) - 1;
+			WaveAddr = addr;
+		}
+
+		/* Voice and ramp stopped, and not in the state where a stopped voice keeps firing IRQs */
+		bool IsIdle(void) const {
+			return (WaveCtrl & (WCTRL_STOP | WCTRL_STOPPED)) && !(WaveCtrl & WCTRL_IRQENABLED) && (RampCtrl & 0x3);
+		}
+
+		void generateSamples(int32_t* stream, uint32_t len) {
 			/* NTS: The GUS is *always* rendering the audio sample at the current position,
 			 *      even if the voice is stopped. This can be confirmed using DOSLIB, loading
 			 *      the Ultrasound test program, loading a WAV file into memory, then using
@@ -464,51 +554,43 @@ class GUSChannel {
 			 *      is stopped. You will hear "popping" noises come out the GUS audio output
 			 *      as the current position changes and the piece of the sample rendered
 			 *      abruptly changes as well. */
+
+			/* Nothing is output and the voice does not advance unless DAC enable is on */
+			if ((myGUS.GUS_reset_reg & 0x02/*DAC enable*/) != 0x02)
+				return;
+
+			/* normal output, or mapped through ICS mixer including channel remapping */
+			unsigned char Lc = 1, Rc = 2;
 			if (gus_ics_mixer) {
-				const unsigned char Lc = read_GF1_mapping_control(0);
-				const unsigned char Rc = read_GF1_mapping_control(1);
-
-				// output mapped through ICS mixer including channel remapping
-				for (i = 0; i < (int)len; i++) {
-					// Get sample
-					if (WaveCtrl & WCTRL_16BIT)
-						tmpsamp = GetSample16();
-					else
-						tmpsamp = GetSample8();
-					// Output stereo sample if DAC enable on
-					if ((myGUS.GUS_reset_reg & 0x02/*DAC enable*/) == 0x02) {
-						int32_t* const sp = stream + (i << 1);
-						const int32_t L = tmpsamp * VolLeft;
-						const int32_t R = tmpsamp * VolRight;
-
-						if (Lc & 1) sp[0] += L;
-						if (Lc & 2) sp[1] += L;
-						if (Rc & 1) sp[0] += R;
-						if (Rc & 2) sp[1] += R;
-
-						WaveUpdate();
-						RampUpdate();
-					}
-				}
+				Lc = read_GF1_mapping_control(0);
+				Rc = read_GF1_mapping_control(1);
 			}
-			else {
-				// normal output
-				for (i = 0; i < (int)len; i++) {
-					// Get sample
-					if (WaveCtrl & WCTRL_16BIT)
-						tmpsamp = GetSample16();
-					else
-						tmpsamp = GetSample8();
-
-					// Output stereo sample if DAC enable on
-					if ((myGUS.GUS_reset_reg & 0x02/*DAC enable*/) == 0x02) {
-						stream[i << 1] += tmpsamp * VolLeft;
-						stream[(i << 1) + 1] += tmpsamp * VolRight;
-
-						WaveUpdate();
-						RampUpdate();
-					}
+
+			/* Render in runs between loop/end/ramp events, and one sample at a time at the events themselves */
+			uint32_t i = 0;
+			while (i < len) {
+				const uint32_t run = RampRunLength(WaveRunLength(len - i));
+
+				if (run == 0) {
+					RenderSample(stream + (i << 1), Lc, Rc);
+					i++;
+					continue;
+				}
+
+				/* A stopped voice does not move, but may still fire IRQs (see WaveUpdate) */
+				if (WaveCtrl & (WCTRL_STOP | WCTRL_STOPPED))
+					WaveUpdate();
+
+				const bool ramping = (RampCtrl & 0x3) == 0;
+				if (WaveCtrl & WCTRL_16BIT) {
+					if (ramping) RenderRun<true,true>(stream + (i << 1), run, Lc, Rc);
+					else RenderRun<true,false>(stream + (i << 1), run, Lc, Rc);
 				}
+				else {
+					if (ramping) RenderRun<false,true>(stream + (i << 1), run, Lc, Rc);
+					else RenderRun<false,false>(stream + (i << 1), run, Lc, Rc);
+				}
+				i += run;
 			}
 		}
 };
@@ -1605,9 +1687,13 @@ static Bitu read_gus(Bitu port,Bitu iolen) {
 }
 
 
+static void GUS_WakeUp(void);
+
 static void write_gus(Bitu port,Bitu val,Bitu iolen) {
 	//	LOG_MSG("Write gus port %x val %x",port,val);
 
+	if (gus_chan->sleeping) GUS_WakeUp();
+
 	/* 12-bit ISA decode (FIXME: Check GUS MAX ISA card to confirm)
 	 *
 	 * More than 10 bits must be decoded in order for GUS MAX extended registers at 7xx to work */
@@ -2176,6 +2262,27 @@ static void GUS_CallBack(Bitu len) {
 
 	gus_chan->AddSamples_s32(len, buffer[0]);
 	CheckVoiceIrq();
+
+	/* Nothing left that can change without the guest touching the card: stop rendering until the next port write */
+	if (gus_chan->IsQuiet(100)) {
+		bool idle = true;
+		if ((myGUS.GUS_reset_reg & 0x03) == 0x03) {
+			for (Bitu i = 0; i < myGUS.ActiveChannels && idle; i++)
+				idle = guschan[i]->IsIdle();
+		}
+		if (idle) gus_chan->Sleep();
+	}
+}
+
+static void GUS_WakeUp(void) {
+	const double slept = gus_chan->WakeUp();
+
+	/* the auto-amp recovery would have continued one step per sample while asleep */
+	if (AutoAmp < myGUS.masterVolumeMul) {
+		const double steps = (slept * GUS_RATE) / 1000.0;
+		if (steps >= (double)(myGUS.masterVolumeMul - AutoAmp)) AutoAmp = myGUS.masterVolumeMul;
+		else AutoAmp += (int32_t)steps;
+	}
 }
 
 // Generate logarithmic to linear volume conversion tables
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <limits.h>
+#include <atomic>
 #include <vector>
 
 #include "bitmapinfoheader.h"
@@ -37,6 +38,7 @@
 #include "mixer.h"
 #include "render.h"
 #include "cross.h"
+#include "SDL.h"
 #include "wave_mmreg.h"
 
 #if (C_SSHOT) || (C_AVCODEC)
@@ -346,19 +348,42 @@ void OPL_SaveRawEvent(bool pressed), SetGameState_Run(int value), ResolvePath(st
 
 #define WAVE_BUF 16*1024
 #define MIDI_BUF 4*1024
+#define MTWAVE_RING 64*1024	/* frames per multitrack ring, must be a power of 2 */
+#define MTWAVE_CHUNK 4*1024	/* frames per multitrack AVI chunk */
+
+/* One per multitrack AVI stream. The emulation thread copies mixer channel samples in,
+ * the writer thread converts them to 16-bit and writes them out. */
+struct mtwave_track {
+	float			ring[MTWAVE_RING][2];
+	std::atomic<uint32_t>	head;		/* frames added, only advanced by the emulation thread */
+	std::atomic<uint32_t>	tail;		/* frames written, only advanced by the writer thread */
+	std::atomic<float>	vol[2];		/* recording volume */
+	uint32_t		dropped;	/* frames lost to a full ring */
+	size_t			stream;		/* AVI stream index */
+
+	mtwave_track() : head(0), tail(0), dropped(0), stream(0) {
+		vol[0] = vol[1] = 1.0f;
+	}
+};
 
 static struct {
 	struct {
 		riff_wav_writer *writer;
-		int16_t buf[WAVE_BUF][2];
-		Bitu used;
+		uint8_t buf[WAVE_BUF*2*4];	/* WAVE_BUF frames of up to 32-bit stereo */
+		Bitu used;			/* in frames */
+		Bitu frame_size;		/* 4 (16-bit), 6 (24-bit) or 8 (float) */
 		uint32_t length;
 		uint32_t freq;
     } wave = {};
     struct {
         avi_writer  *writer;
 		Bitu		audiorate;
-        std::map<std::string,size_t> name_to_stream_index;
+        std::map<std::string,size_t> name_to_stream_index;	/* into tracks */
+		std::vector<mtwave_track*> tracks;
+		SDL_Thread	*thread;
+		SDL_mutex	*lock;
+		SDL_cond	*cond;
+		bool		quit;
     } multitrack_wave = {};
 	struct {
 		FILE * handle;
@@ -1614,7 +1639,111 @@ void CAPTURE_RawScreenShotEvent(bool pressed) {
 
 MixerChannel * MIXER_FirstChannel(void);
 
-void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, int16_t * data,const char *name) {
+#if !defined(C_EMSCRIPTEN)
+/* Write whatever has accumulated in each track ring to the AVI file. Writer thread only,
+ * or the emulation thread once the writer thread has stopped. */
+static void CAPTURE_MTWaveFlush(void) {
+	int16_t convert[MTWAVE_CHUNK][2];
+
+	for (size_t t=0;t < capture.multitrack_wave.tracks.size();t++) {
+		mtwave_track *tr = capture.multitrack_wave.tracks[t];
+		uint32_t tail = tr->tail.load(std::memory_order_relaxed);
+		const uint32_t head = tr->head.load(std::memory_order_acquire);
+		const float vol0 = tr->vol[0].load(std::memory_order_relaxed);
+		const float vol1 = tr->vol[1].load(std::memory_order_relaxed);
+
+		if (tr->stream >= (size_t)capture.multitrack_wave.writer->avi_stream_alloc)
+			continue;
+
+		avi_writer_stream *os = capture.multitrack_wave.writer->avi_stream + tr->stream;
+
+		while (tail != head) {
+			const uint32_t pos = tail & (MTWAVE_RING - 1);
+			uint32_t n = head - tail;
+
+			if (n > MTWAVE_RING - pos) n = MTWAVE_RING - pos;
+			if (n > MTWAVE_CHUNK) n = MTWAVE_CHUNK;
+
+			for (uint32_t i=0;i < n;i++) {
+				float l = tr->ring[pos+i][0] * vol0;
+				float r = tr->ring[pos+i][1] * vol1;
+
+				if (l > MAX_AUDIO) l = MAX_AUDIO; else if (l < MIN_AUDIO) l = MIN_AUDIO;
+				if (r > MAX_AUDIO) r = MAX_AUDIO; else if (r < MIN_AUDIO) r = MIN_AUDIO;
+				host_writew((HostPt)&convert[i][0],(uint16_t)((int16_t)l));
+				host_writew((HostPt)&convert[i][1],(uint16_t)((int16_t)r));
+			}
+
+			avi_writer_stream_write(capture.multitrack_wave.writer,os,convert,n * 2 * 2,/*keyframe*/0x10);
+			tail += n;
+			tr->tail.store(tail,std::memory_order_release);
+		}
+	}
+}
+
+static int CAPTURE_MTWaveThread(void *) {
+	SDL_LockMutex(capture.multitrack_wave.lock);
+	while (!capture.multitrack_wave.quit) {
+		SDL_UnlockMutex(capture.multitrack_wave.lock);
+		CAPTURE_MTWaveFlush();
+		SDL_LockMutex(capture.multitrack_wave.lock);
+		if (!capture.multitrack_wave.quit)
+			SDL_CondWaitTimeout(capture.multitrack_wave.cond,capture.multitrack_wave.lock,50);
+	}
+	SDL_UnlockMutex(capture.multitrack_wave.lock);
+	return 0;
+}
+
+static void CAPTURE_MTWaveStartThread(void) {
+	capture.multitrack_wave.quit = false;
+	capture.multitrack_wave.lock = SDL_CreateMutex();
+	capture.multitrack_wave.cond = SDL_CreateCond();
+	if (capture.multitrack_wave.lock != NULL && capture.multitrack_wave.cond != NULL) {
+#if defined(C_SDL2)
+		capture.multitrack_wave.thread = SDL_CreateThread(CAPTURE_MTWaveThread,"MTWAVE",NULL);
+#else
+		capture.multitrack_wave.thread = SDL_CreateThread(CAPTURE_MTWaveThread,NULL);
+#endif
+	}
+	if (capture.multitrack_wave.thread == NULL)
+		LOG_MSG("Multitrack: Unable to start writer thread, writing from the emulation thread");
+}
+
+/* stop the writer thread, write out what is left in the rings and free them */
+static void CAPTURE_MTWaveStopThread(void) {
+	if (capture.multitrack_wave.thread != NULL) {
+		SDL_LockMutex(capture.multitrack_wave.lock);
+		capture.multitrack_wave.quit = true;
+		SDL_CondSignal(capture.multitrack_wave.cond);
+		SDL_UnlockMutex(capture.multitrack_wave.lock);
+		SDL_WaitThread(capture.multitrack_wave.thread,NULL);
+		capture.multitrack_wave.thread = NULL;
+	}
+	if (capture.multitrack_wave.cond != NULL) {
+		SDL_DestroyCond(capture.multitrack_wave.cond);
+		capture.multitrack_wave.cond = NULL;
+	}
+	if (capture.multitrack_wave.lock != NULL) {
+		SDL_DestroyMutex(capture.multitrack_wave.lock);
+		capture.multitrack_wave.lock = NULL;
+	}
+
+	if (capture.multitrack_wave.writer != NULL)
+		CAPTURE_MTWaveFlush();
+
+	for (size_t t=0;t < capture.multitrack_wave.tracks.size();t++) {
+		mtwave_track *tr = capture.multitrack_wave.tracks[t];
+		if (tr->dropped != 0)
+			LOG_MSG("Multitrack: %u frames dropped from stream %u, capture could not keep up",(unsigned int)tr->dropped,(unsigned int)tr->stream);
+		delete tr;
+	}
+	capture.multitrack_wave.tracks.clear();
+	capture.multitrack_wave.name_to_stream_index.clear();
+}
+#endif
+
+/* data == NULL adds silence. Called from the emulation thread. */
+void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, const float * data, const float vol[2], const char *name) {
 #if !defined(C_EMSCRIPTEN)
 	if (CaptureState & CAPTURE_MULTITRACK_WAVE) {
 		if (capture.multitrack_wave.writer == NULL) {
@@ -1715,7 +1844,10 @@ void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, int16_t * data,const
 
 					if (c->name != NULL && *(c->name) != 0) {
 						LOG_MSG("multitrack audio, mixer channel '%s' is AVI stream %d",c->name,astream->index);
-						capture.multitrack_wave.name_to_stream_index[c->name] = (size_t)astream->index;
+						mtwave_track *tr = new mtwave_track();
+						tr->stream = (size_t)astream->index;
+						capture.multitrack_wave.name_to_stream_index[c->name] = capture.multitrack_wave.tracks.size();
+						capture.multitrack_wave.tracks.push_back(tr);
 						astream->name = c->name;
 					}
 
@@ -1734,20 +1866,46 @@ void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, int16_t * data,const
 			if (realpath(path.c_str(), fullpath) != NULL) path = fullpath;
 #endif
 			LOG_MSG("Started capturing multitrack audio (%u channels) to: %s",streams, path.c_str());
+			CAPTURE_MTWaveStartThread();
 		}
 
 		if (capture.multitrack_wave.writer != NULL) {
 			std::map<std::string,size_t>::iterator ni = capture.multitrack_wave.name_to_stream_index.find(name);
 			if (ni != capture.multitrack_wave.name_to_stream_index.end()) {
-				size_t index = ni->second;
+				mtwave_track *tr = capture.multitrack_wave.tracks[ni->second];
+				uint32_t head = tr->head.load(std::memory_order_relaxed);
+				const uint32_t room = MTWAVE_RING - (head - tr->tail.load(std::memory_order_acquire));
 
-				if (index < (size_t)capture.multitrack_wave.writer->avi_stream_alloc) {
-					avi_writer_stream *os = capture.multitrack_wave.writer->avi_stream + index;
-					avi_writer_stream_write(capture.multitrack_wave.writer,os,data,len * 2 * 2,/*keyframe*/0x10);
+				if (len > room) {
+					tr->dropped += len - room;
+					len = room;
 				}
-				else {
-					LOG_MSG("Multitrack: Ignoring unknown track '%s', out of range\n",name);
+
+				tr->vol[0].store(vol[0],std::memory_order_relaxed);
+				tr->vol[1].store(vol[1],std::memory_order_relaxed);
+				while (len > 0) {
+					const uint32_t pos = head & (MTWAVE_RING - 1);
+					uint32_t n = len;
+
+					if (n > MTWAVE_RING - pos) n = MTWAVE_RING - pos;
+					if (data != NULL) {
+						memcpy(&tr->ring[pos][0],data,n * sizeof(float) * 2);
+						data += n * 2;
+					}
+					else {
+						memset(&tr->ring[pos][0],0,n * sizeof(float) * 2);
+					}
+
+					head += n;
+					len -= n;
 				}
+				tr->head.store(head,std::memory_order_release);
+
+				/* wake the writer early once a ring is a quarter full */
+				if (capture.multitrack_wave.thread == NULL)
+					CAPTURE_MTWaveFlush();
+				else if ((head - tr->tail.load(std::memory_order_relaxed)) >= (MTWAVE_RING / 4))
+					SDL_CondSignal(capture.multitrack_wave.cond);
 			}
 			else {
 				LOG_MSG("Multitrack: Ignoring unknown track '%s'\n",name);
@@ -1757,6 +1915,7 @@ void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, int16_t * data,const
 
 	return;
 skip_mt_wav:
+	CAPTURE_MTWaveStopThread();
 	capture.multitrack_wave.writer = avi_writer_destroy(capture.multitrack_wave.writer);
 #endif
 }
@@ -1823,7 +1982,38 @@ void Capture_WritePacket(bool /*send*/,const unsigned char *buf,size_t len) {
 	}
 }
 
-void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data) {
+/* Convert mixer output for the WAV file. fdata is the same audio unclipped, 16-bit full scale */
+static void CAPTURE_WaveConvert(uint8_t *dst,const int16_t *data,const float *fdata,Bitu frames) {
+	if (capture.wave.frame_size == 8 && fdata != NULL) {
+		for (Bitu i=0;i < frames*2;i++) {
+			const float f = fdata[i] * (1.0f / 32768.0f);
+			memcpy(dst,&f,4); /* IEEE float WAV is little endian */
+#if defined(WORDS_BIGENDIAN)
+			std::swap(dst[0],dst[3]); std::swap(dst[1],dst[2]);
+#endif
+			dst += 4;
+		}
+	}
+	else if (capture.wave.frame_size == 6 && fdata != NULL) {
+		for (Bitu i=0;i < frames*2;i++) {
+			float f = fdata[i] * 256.0f;
+			if (f > 8388607.0f) f = 8388607.0f;
+			else if (f < -8388608.0f) f = -8388608.0f;
+			const int32_t v = (int32_t)f;
+			*dst++ = (uint8_t)v;
+			*dst++ = (uint8_t)(v >> 8);
+			*dst++ = (uint8_t)(v >> 16);
+		}
+	}
+	else {
+		for (Bitu i=0;i < frames*2;i++) {
+			host_writew(dst,(uint16_t)data[i]);
+			dst += 2;
+		}
+	}
+}
+
+void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data, const float * fdata) {
 #if !defined(C_EMSCRIPTEN)
 #if (C_SSHOT)
 	if (CaptureState & CAPTURE_VIDEO) {
@@ -1851,22 +2041,30 @@ void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data) {
 				return;
 			}
 
-			windows_WAVEFORMAT fmt;
+			windows_WAVEFORMATEX fmt;
+			const std::string wfmt = static_cast<Section_prop *>(control->GetSection("mixer"))->Get_string("wave capture format");
+			unsigned int bits = 16;
+
+			if (wfmt == "24bit") bits = 24;
+			else if (wfmt == "float") bits = 32;
+			capture.wave.frame_size = (bits / 8u) * 2u;
 
 			memset(&fmt,0,sizeof(fmt));
-			__w_le_u16(&fmt.wFormatTag,windows_WAVE_FORMAT_PCM);
+			__w_le_u16(&fmt.wFormatTag,bits == 32 ? windows_WAVE_FORMAT_IEEE_FLOAT : windows_WAVE_FORMAT_PCM);
 			__w_le_u16(&fmt.nChannels,2);			/* stereo */
 			__w_le_u32(&fmt.nSamplesPerSec,freq);
-			__w_le_u16(&fmt.wBitsPerSample,16);		/* 16-bit/sample */
-			__w_le_u16(&fmt.nBlockAlign,2*2);
-			__w_le_u32(&fmt.nAvgBytesPerSec,freq*2*2);
+			__w_le_u16(&fmt.wBitsPerSample,bits);
+			__w_le_u16(&fmt.nBlockAlign,(uint16_t)capture.wave.frame_size);
+			__w_le_u32(&fmt.nAvgBytesPerSec,freq*(uint32_t)capture.wave.frame_size);
 
 			if (!riff_wav_writer_open_file(capture.wave.writer,path.c_str())) {
 				CaptureState &= ~((unsigned int)CAPTURE_WAVE);
 				capture.wave.writer = riff_wav_writer_destroy(capture.wave.writer);
 				return;
 			}
-			if (!riff_wav_writer_set_format(capture.wave.writer,&fmt) ||
+			/* float is not PCM, it needs the full WAVEFORMATEX (and 'fact' chunk the writer adds) */
+			if (!(bits == 32 ? riff_wav_writer_set_format_ex(capture.wave.writer,&fmt,sizeof(fmt)) :
+				riff_wav_writer_set_format(capture.wave.writer,(windows_WAVEFORMAT*)(&fmt))) ||
 				!riff_wav_writer_begin_header(capture.wave.writer) ||
 				!riff_wav_writer_begin_data(capture.wave.writer)) {
 				CaptureState &= ~((unsigned int)CAPTURE_WAVE);
@@ -1887,19 +2085,21 @@ void CAPTURE_AddWave(uint32_t freq, uint32_t len, int16_t * data) {
 			LOG_MSG("Started capturing wave output to: %s", path.c_str());
 		}
 		int16_t * read = data;
+		const float * fread = fdata;
 		while (len > 0 ) {
 			Bitu left = WAVE_BUF - capture.wave.used;
 			if (!left) {
-				riff_wav_writer_data_write(capture.wave.writer,capture.wave.buf,2*2*WAVE_BUF);
-				capture.wave.length += 4*WAVE_BUF;
+				riff_wav_writer_data_write(capture.wave.writer,capture.wave.buf,capture.wave.frame_size*WAVE_BUF);
+				capture.wave.length += (uint32_t)(capture.wave.frame_size*WAVE_BUF);
 				capture.wave.used = 0;
 				left = WAVE_BUF;
 			}
 			if (left > len)
 				left = len;
-			memcpy( &capture.wave.buf[capture.wave.used], read, left*4);
+			CAPTURE_WaveConvert(&capture.wave.buf[capture.wave.used*capture.wave.frame_size],read,fread,left);
 			capture.wave.used += left;
 			read += left*2;
+			if (fread != NULL) fread += left*2;
 			len -= (uint32_t)left;
 		}
 	}
@@ -1914,7 +2114,7 @@ void CAPTURE_MTWaveEvent(bool pressed) {
     if (CaptureState & CAPTURE_MULTITRACK_WAVE) {
         if (capture.multitrack_wave.writer != NULL) {
             LOG_MSG("Stopped capturing multitrack wave output.");
-            capture.multitrack_wave.name_to_stream_index.clear();
+            CAPTURE_MTWaveStopThread();
             avi_writer_end_data(capture.multitrack_wave.writer);
             avi_writer_finish(capture.multitrack_wave.writer);
             avi_writer_close_file(capture.multitrack_wave.writer);
@@ -1960,8 +2160,8 @@ void CAPTURE_WaveEvent(bool pressed) {
         if (capture.wave.writer != NULL) {
             LOG_MSG("Stopped capturing wave output.");
             /* Write last piece of audio in buffer */
-            riff_wav_writer_data_write(capture.wave.writer,capture.wave.buf,2*2*capture.wave.used);
-            capture.wave.length+=(uint32_t)(capture.wave.used*4);
+            riff_wav_writer_data_write(capture.wave.writer,capture.wave.buf,capture.wave.frame_size*capture.wave.used);
+            capture.wave.length+=(uint32_t)(capture.wave.used*capture.wave.frame_size);
             riff_wav_writer_end_data(capture.wave.writer);
             capture.wave.writer = riff_wav_writer_destroy(capture.wave.writer);
             CaptureState &= ~((unsigned int)CAPTURE_WAVE);
@@ -116,6 +116,8 @@ static void ide_altio_w(Bitu port,Bitu val,Bitu iolen);
 static Bitu ide_altio_r(Bitu port,Bitu iolen);
 static void ide_baseio_w(Bitu port,Bitu val,Bitu iolen);
 static Bitu ide_baseio_r(Bitu port,Bitu iolen);
+static Bitu ide_baseio_r_block(Bitu port,uint8_t *buf,Bitu count,Bitu iolen);
+static Bitu ide_baseio_w_block(Bitu port,const uint8_t *buf,Bitu count,Bitu iolen);
 bool GetMSCDEXDrive(unsigned char drive_letter,CDROM_Interface **_cdrom);
 
 enum IDEDeviceType {
@@ -215,6 +217,8 @@ public:
     virtual void writecommand(uint8_t cmd);
     virtual Bitu data_read(Bitu iolen); /* read from 1F0h data port from IDE device */
     virtual void data_write(Bitu v,Bitu iolen);/* write to 1F0h data port to IDE device */
+    virtual Bitu data_read_block(uint8_t *buf,Bitu count,Bitu iolen); /* REP INS from 1F0h, returns elements moved */
+    virtual Bitu data_write_block(const uint8_t *buf,Bitu count,Bitu iolen); /* REP OUTS to 1F0h, returns elements moved */
     virtual bool command_interruption_ok(uint8_t cmd);
     virtual void abort_silent();
 };
@@ -233,6 +237,8 @@ public:
     void update_from_biosdisk();
     virtual Bitu data_read(Bitu iolen) override; /* read from 1F0h data port from IDE device */
     virtual void data_write(Bitu v,Bitu iolen) override;/* write to 1F0h data port to IDE device */
+    virtual Bitu data_read_block(uint8_t *buf,Bitu count,Bitu iolen) override;
+    virtual Bitu data_write_block(const uint8_t *buf,Bitu count,Bitu iolen) override;
     virtual void generate_identify_device();
     virtual void prepare_read(Bitu offset,Bitu size);
     virtual void prepare_write(Bitu offset,Bitu size);
@@ -271,6 +277,7 @@ public:
     void update_from_cdrom();
     Bitu data_read(Bitu iolen) override; /* read from 1F0h data port from IDE device */
     void data_write(Bitu v,Bitu iolen) override; /* write to 1F0h data port to IDE device */
+    Bitu data_read_block(uint8_t *buf,Bitu count,Bitu iolen) override;
     virtual void generate_identify_device();
     virtual void generate_mmc_inquiry();
     virtual void prepare_read(Bitu offset,Bitu size);
@@ -327,6 +334,7 @@ public:
     unsigned char interface_index;
     IO_ReadHandleObject ReadHandler[8],ReadHandlerAlt[2];
     IO_WriteHandleObject WriteHandler[8],WriteHandlerAlt[2];
+    IO_BlockHandleObject DataBlockHandler;
 public:
     IDEDevice* device[2];       /* IDE devices (master, slave) */
     Bitu select;   /* which is selected */
@@ -1877,6 +1885,26 @@ Bitu IDEATAPICDROMDevice::data_read(Bitu iolen) {
     return w;
 }
 
+/* REP INSW/INSD of a PACKET data transfer, stops at the end of the current DRQ block */
+Bitu IDEATAPICDROMDevice::data_read_block(uint8_t *buf,Bitu count,Bitu iolen) {
+    if (state != IDE_DEV_DATA_READ || !(status & IDE_STATUS_DRQ) || iolen < 2)
+        return 0;
+    if (sector_i >= sector_total)
+        return 0;
+
+    Bitu n = (sector_total - sector_i) / iolen;
+    if (n > count) n = count;
+    if (n == 0) return 0;
+
+    memcpy(buf,sector+sector_i,n*iolen);
+    sector_i += n*iolen;
+
+    if (sector_i >= sector_total)
+        io_completion();
+
+    return n;
+}
+
 static const uint16_t ReadCDTransferSectorSizeTable[5/*SectorType-1*/][0x20/*READ CD byte 9 >> 3*/] = {
         /* Sector type 0: Any
          * Sector type 1: CDDA */
@@ -2399,7 +2427,44 @@ void IDEATADevice::data_write(Bitu v,Bitu iolen) {
     if (sector_i >= sector_total)
         io_completion();
 }
-        
+
+/* REP INSW/INSD and REP OUTSW/OUTSD of a sector, in one memcpy instead of
+ * 256 data_read() calls. Stops at the end of the sector so that io_completion()
+ * (next sector, IRQ, BSY) happens exactly where it would have one word at a time */
+Bitu IDEATADevice::data_read_block(uint8_t *buf,Bitu count,Bitu iolen) {
+    if (state != IDE_DEV_DATA_READ || !(status & IDE_STATUS_DRQ))
+        return 0;
+
+    Bitu n = (sector_i < sector_total) ? ((sector_total - sector_i) / iolen) : 0;
+    if (n > count) n = count;
+    if (n == 0) return 0;
+
+    memcpy(buf,sector+sector_i,n*iolen);
+    sector_i += n*iolen;
+
+    if (sector_i >= sector_total)
+        io_completion();
+
+    return n;
+}
+
+Bitu IDEATADevice::data_write_block(const uint8_t *buf,Bitu count,Bitu iolen) {
+    if (state != IDE_DEV_DATA_WRITE || !(status & IDE_STATUS_DRQ))
+        return 0;
+
+    Bitu n = (sector_i < sector_total) ? ((sector_total - sector_i) / iolen) : 0;
+    if (n > count) n = count;
+    if (n == 0) return 0;
+
+    memcpy(sector+sector_i,buf,n*iolen);
+    sector_i += n*iolen;
+
+    if (sector_i >= sector_total)
+        io_completion();
+
+    return n;
+}
+
 void IDEATAPICDROMDevice::prepare_read(Bitu offset,Bitu size) {
     /* I/O must be WORD ALIGNED */
     assert((offset&1) == 0);
@@ -3911,6 +3976,21 @@ void IDEDevice::data_write(Bitu v,Bitu iolen) {
     (void)v;//UNUSED
 }
 
+/* devices without a block path decline, the CPU then falls back to data_read/data_write */
+Bitu IDEDevice::data_read_block(uint8_t *buf,Bitu count,Bitu iolen) {
+    (void)buf;//UNUSED
+    (void)count;//UNUSED
+    (void)iolen;//UNUSED
+    return 0;
+}
+
+Bitu IDEDevice::data_write_block(const uint8_t *buf,Bitu count,Bitu iolen) {
+    (void)buf;//UNUSED
+    (void)count;//UNUSED
+    (void)iolen;//UNUSED
+    return 0;
+}
+
 IDEDevice::IDEDevice(IDEController *c,bool _slave) {
     type = IDE_TYPE_NONE;
     slave = _slave;
@@ -4491,6 +4571,8 @@ void IDEController::install_io_port(){
             WriteHandler[i].Install(base_io+i,ide_baseio_w,IO_MA);
             ReadHandler[i].Install(base_io+i,ide_baseio_r,IO_MA);
         }
+
+        DataBlockHandler.Install(base_io,ide_baseio_r_block,ide_baseio_w_block);
     }
 
     if (alt_io != 0) {
@@ -4899,8 +4981,41 @@ void (*ide_inits[MAX_IDE_CONTROLLERS])(Section *) = {
     &IDE_Octernary_Init
 };
 
+/* block path for the data port, anything the device or controller state does not
+ * allow is declined (returns 0) and goes through ide_baseio_r/w one element at a time */
+static IDEDevice *ide_block_device(Bitu port,Bitu iolen) {
+    IDEController *ide = match_ide_controller(port);
+    if (ide == NULL) return NULL;
+
+    if (iolen == 4 && (!ide->enable_pio32 || ide->ignore_pio32))
+        return NULL;
+
+    if (IS_PC98_ARCH)
+        port = (port >> 1) & 7;
+    else
+        port &= 7;
+    if (port != 0) return NULL;
+
+    IDEDevice *dev = ide->device[ide->select];
+    if (dev == NULL || (dev->status & IDE_STATUS_BUSY))
+        return NULL;
+
+    return dev;
+}
+
+static Bitu ide_baseio_r_block(Bitu port,uint8_t *buf,Bitu count,Bitu iolen) {
+    IDEDevice *dev = ide_block_device(port,iolen);
+    return (dev != NULL && iolen >= 2) ? dev->data_read_block(buf,count,iolen) : 0;
+}
+
+static Bitu ide_baseio_w_block(Bitu port,const uint8_t *buf,Bitu count,Bitu iolen) {
+    IDEDevice *dev = ide_block_device(port,iolen);
+    return (dev != NULL && iolen >= 2) ? dev->data_write_block(buf,count,iolen) : 0;
+}
+
 IO_ReadHandleObject  PC98_ReadHandler[8], PC98_ReadHandlerAlt[2], PC98_ReadHandlerSel[3];
 IO_WriteHandleObject PC98_WriteHandler[8],PC98_WriteHandlerAlt[2],PC98_WriteHandlerSel[3];
+IO_BlockHandleObject PC98_DataBlockHandler;
 
 void PC98_IDE_UpdateIRQ(void) {
     if (IS_PC98_ARCH) {
@@ -4930,6 +5045,9 @@ void IDE_OnReset(Section *sec) {
             PC98_ReadHandler[i].Install(0x640+(i*2),ide_baseio_r,IO_MA);
         }
 
+        PC98_DataBlockHandler.Uninstall();
+        PC98_DataBlockHandler.Install(0x640,ide_baseio_r_block,ide_baseio_w_block);
+
         for (size_t i=0;i < 2;i++) {
             PC98_WriteHandlerAlt[i].Uninstall();
             PC98_ReadHandlerAlt[i].Uninstall();
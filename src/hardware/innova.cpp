@@ -17,6 +17,8 @@
  */
 
 #include <string.h>
+#include <deque>
+#include <vector>
 #include "dosbox.h"
 #include "inout.h"
 #include "logging.h"
@@ -24,33 +26,206 @@
 #include "pic.h"
 #include "setup.h"
 #include "control.h"
+#include "SDL.h"
 
 #include "reSID/sid.h"
 
 #define SID_FREQ 894886
+#define INNOVA_CATCHUP_MAX_MS 250	// longest SID catch-up after the channel slept
 
 static struct {
 	SID2* sid;
 	Bitu rate;
 	Bitu basePort;
 	Bitu last_used;
+	double clocked_to;	// while the channel sleeps, time up to which the SID has been clocked
 	MixerChannel * chan;
 } innova;
 
+/* [innova] thread: reSID is clocked on a render thread that keeps a ring of samples
+ * prebuffer ms ahead of the mixer. Register writes are queued with the output sample
+ * they are due at and applied by the render thread just before it, so timing stays
+ * sample accurate at a constant latency. The SID itself is guarded by its own lock so
+ * that reads (OSC3/ENV3) and the sleep catch-up never wait for the mixer. */
+struct innova_write_event {
+	uint64_t frame;
+	reg8 reg, val;
+};
+
+static struct {
+	bool enabled;
+	SDL_Thread *thread;
+	SDL_mutex *lock;			// ring, queue and counters
+	SDL_mutex *sid_lock;		// the SID2 object
+	SDL_cond *cond;
+	std::deque<innova_write_event> writes;
+	std::vector<short> ring;
+	Bitu ring_frames;
+	Bitu min_render;			// smallest chunk worth waking up for
+	uint64_t rendered;			// samples rendered into the ring so far
+	uint64_t played;			// samples handed to the mixer so far
+	bool stop;
+} innova_thread = {};
+
+/* Render len samples, one batch of cycles per call. The cycle budget covers one sample
+ * more than asked for, reSID stops as soon as the buffer is full and carries the fraction
+ * of a sample itself, so every block comes out complete without drifting against the mixer. */
+static void innova_render(short* buffer,Bitu len) {
+	cycle_count delta_t = (cycle_count)(SID_FREQ*(len+1)/innova.rate)+1;
+	Bitu bufindex = 0;
+
+	while(delta_t && bufindex != len) {
+		bufindex += (Bitu)innova.sid->clock(delta_t, buffer+bufindex, (int)(len-bufindex));
+	}
+	if (bufindex != len) memset(buffer+bufindex, 0, (len-bufindex)*sizeof(short));
+}
+
+static int INNOVA_RenderThread(void *data) {
+	(void)data;//UNUSED
+	std::vector<innova_write_event> due;
+
+	SDL_LockMutex(innova_thread.lock);
+	while (!innova_thread.stop) {
+		const Bitu room = innova_thread.ring_frames - (Bitu)(innova_thread.rendered - innova_thread.played);
+		if (room == 0 || (room < innova_thread.min_render && innova_thread.writes.empty())) {
+			SDL_CondWait(innova_thread.cond, innova_thread.lock);
+			continue;
+		}
+
+		while (!innova_thread.writes.empty() && innova_thread.writes.front().frame <= innova_thread.rendered) {
+			due.push_back(innova_thread.writes.front());
+			innova_thread.writes.pop_front();
+		}
+
+		/* render up to the next queued write, or as far as there is room */
+		Bitu todo = room;
+		if (!innova_thread.writes.empty() && (innova_thread.writes.front().frame - innova_thread.rendered) < todo)
+			todo = (Bitu)(innova_thread.writes.front().frame - innova_thread.rendered);
+
+		const Bitu pos = (Bitu)(innova_thread.rendered % innova_thread.ring_frames);
+		if (todo > (innova_thread.ring_frames - pos)) todo = innova_thread.ring_frames - pos;
+
+		SDL_UnlockMutex(innova_thread.lock);
+		SDL_LockMutex(innova_thread.sid_lock);
+		for (auto &w : due) innova.sid->write(w.reg, w.val);
+		due.clear();
+		if (todo > 0) innova_render(&innova_thread.ring[pos], todo);
+		SDL_UnlockMutex(innova_thread.sid_lock);
+		SDL_LockMutex(innova_thread.lock);
+
+		innova_thread.rendered += todo;
+		SDL_CondSignal(innova_thread.cond);
+	}
+	SDL_UnlockMutex(innova_thread.lock);
+	return 0;
+}
+
+static void INNOVA_StartThread(int prebuffer) {
+	innova_thread.ring_frames = (Bitu)((prebuffer * innova.rate) / 1000);
+	if (innova_thread.ring_frames < 64) innova_thread.ring_frames = 64;
+	innova_thread.min_render = innova_thread.ring_frames / 4;
+	innova_thread.ring.assign(innova_thread.ring_frames, 0);
+	innova_thread.writes.clear();
+	innova_thread.rendered = innova_thread.played = 0;
+	innova_thread.stop = false;
+	innova_thread.lock = SDL_CreateMutex();
+	innova_thread.sid_lock = SDL_CreateMutex();
+	innova_thread.cond = SDL_CreateCond();
+	if (innova_thread.lock != NULL && innova_thread.sid_lock != NULL && innova_thread.cond != NULL) {
+#if defined(C_SDL2)
+		innova_thread.thread = SDL_CreateThread(INNOVA_RenderThread, "INNOVA", NULL);
+#else
+		innova_thread.thread = SDL_CreateThread(INNOVA_RenderThread, NULL);
+#endif
+	}
+	if (innova_thread.thread == NULL) {
+		LOG_MSG("INNOVA:Unable to start render thread, rendering from the mixer");
+		if (innova_thread.lock != NULL) SDL_DestroyMutex(innova_thread.lock);
+		if (innova_thread.sid_lock != NULL) SDL_DestroyMutex(innova_thread.sid_lock);
+		if (innova_thread.cond != NULL) SDL_DestroyCond(innova_thread.cond);
+		innova_thread.lock = innova_thread.sid_lock = NULL;
+		innova_thread.cond = NULL;
+		innova_thread.ring.clear();
+		return;
+	}
+	innova_thread.enabled = true;
+}
+
+static void INNOVA_StopThread(void) {
+	if (!innova_thread.enabled) return;
+
+	SDL_LockMutex(innova_thread.lock);
+	innova_thread.stop = true;
+	SDL_CondBroadcast(innova_thread.cond);
+	SDL_UnlockMutex(innova_thread.lock);
+	SDL_WaitThread(innova_thread.thread, NULL);
+	innova_thread.thread = NULL;
+	SDL_DestroyMutex(innova_thread.lock);
+	innova_thread.lock = NULL;
+	SDL_DestroyMutex(innova_thread.sid_lock);
+	innova_thread.sid_lock = NULL;
+	SDL_DestroyCond(innova_thread.cond);
+	innova_thread.cond = NULL;
+	innova_thread.writes.clear();
+	innova_thread.ring.clear();
+	innova_thread.enabled = false;
+}
+
+/* Nothing clocks the SID while the mixer channel sleeps. Bring envelopes and oscillators
+ * up to date before the guest can observe them, through OSC3/ENV3 or a new write.
+ * The catch-up runs on the emulation thread with sid_lock held, so it is capped: the
+ * channel only sleeps once the output went quiet, and a slow release that is still
+ * running after the cap simply continues from there. */
+static void innova_catchup(void) {
+	const double now = PIC_FullIndex();
+	double ms = now - innova.clocked_to;
+	innova.clocked_to = now;
+	if (ms > INNOVA_CATCHUP_MAX_MS) ms = INNOVA_CATCHUP_MAX_MS;
+	if (ms <= 0) return;
+
+	if (innova_thread.enabled) SDL_LockMutex(innova_thread.sid_lock);
+	innova.sid->clock((cycle_count)(ms * SID_FREQ / 1000));
+	if (innova_thread.enabled) SDL_UnlockMutex(innova_thread.sid_lock);
+}
+
 static void innova_write(Bitu port,Bitu val,Bitu iolen) {
     (void)iolen;//UNUSED
 	if (!innova.last_used) {
 		innova.chan->Enable(true);
 	}
+	if (innova.chan->sleeping) {
+		innova_catchup();
+		innova.chan->WakeUp();
+	}
 	innova.last_used=PIC_Ticks;
 
 	Bitu sidPort = port-innova.basePort;
+	if (innova_thread.enabled) {
+		innova_write_event w;
+		w.reg = (reg8)sidPort;
+		w.val = (reg8)val;
+
+		SDL_LockMutex(innova_thread.lock);
+		w.frame = innova_thread.played + innova_thread.ring_frames;
+		innova_thread.writes.push_back(w);
+		SDL_CondSignal(innova_thread.cond);
+		SDL_UnlockMutex(innova_thread.lock);
+		return;
+	}
 	innova.sid->write((reg8)sidPort, (reg8)val);
 }
 
 static Bitu innova_read(Bitu port,Bitu iolen) {
     (void)iolen;//UNUSED
 	Bitu sidPort = port-innova.basePort;
+	if (innova.chan->sleeping) innova_catchup();
+	if (innova_thread.enabled) {
+		/* the render thread runs up to prebuffer ms ahead, OSC3/ENV3 reflect that */
+		SDL_LockMutex(innova_thread.sid_lock);
+		Bitu val = innova.sid->read((reg8)sidPort);
+		SDL_UnlockMutex(innova_thread.sid_lock);
+		return val;
+	}
 	return innova.sid->read((reg8)sidPort);
 }
 
@@ -58,18 +233,40 @@ static Bitu innova_read(Bitu port,Bitu iolen) {
 static void INNOVA_CallBack(Bitu len) {
 	if (!len) return;
 
-	cycle_count delta_t = (cycle_count)(SID_FREQ*len/innova.rate);
 	short* buffer = (short*)MixTemp;
-	Bitu bufindex = 0;
 
-	while(delta_t && bufindex != len) {
-		bufindex += (Bitu)innova.sid->clock(delta_t, buffer+bufindex, (int)(len-bufindex));
+	if (!innova_thread.enabled) {
+		innova_render(buffer, len);
+	}
+	else {
+		if (len > (sizeof(MixTemp)/sizeof(short))) len = sizeof(MixTemp)/sizeof(short);
+
+		SDL_LockMutex(innova_thread.lock);
+		while (innova_thread.rendered == innova_thread.played && !innova_thread.stop)
+			SDL_CondWait(innova_thread.cond, innova_thread.lock);
+
+		Bitu avail = (Bitu)(innova_thread.rendered - innova_thread.played);
+		if (len > avail) len = avail;
+
+		for (Bitu done = 0;done < len;) {
+			const Bitu pos = (Bitu)(innova_thread.played % innova_thread.ring_frames);
+			Bitu todo = innova_thread.ring_frames - pos;
+			if (todo > (len - done)) todo = len - done;
+			memcpy(buffer + done, &innova_thread.ring[pos], todo * sizeof(short));
+			innova_thread.played += todo;
+			done += todo;
+		}
+
+		SDL_CondSignal(innova_thread.cond);
+		SDL_UnlockMutex(innova_thread.lock);
+
+		if (!len) return;
 	}
 	innova.chan->AddSamples_m16(len, buffer);
 
-	if (innova.last_used+5000<PIC_Ticks) {
-		innova.last_used=0;
-		innova.chan->Enable(false);
+	if (innova.chan->IsQuiet(100) || innova.last_used+5000<PIC_Ticks) {
+		innova.clocked_to=PIC_FullIndex();
+		innova.chan->Sleep();
 	}
 }
 
@@ -106,10 +303,18 @@ public:
 		innova.sid->set_sampling_parameters(SID_FREQ, method, (double)innova.rate, -1, 0.97);
 
 		innova.last_used=0;
+		innova.clocked_to=0;
+
+		if (section->Get_bool("thread")) {
+			const int prebuffer = section->Get_int("prebuffer");
+			INNOVA_StartThread(prebuffer);
+			if (innova_thread.enabled) LOG_MSG("INNOVA:Rendering in a separate thread, %d ms ahead", prebuffer);
+		}
 
 		LOG_MSG("INNOVA:... finished.");
 	}
 	~INNOVA(){
+		INNOVA_StopThread();
 		delete innova.sid;
 	}
 };
@@ -26,6 +26,7 @@
 #include "cpu.h"
 #include "../src/cpu/lazyflags.h"
 #include "callback.h"
+#include "paging.h"
 
 //#define ENABLE_PORTLOG
 
@@ -397,6 +398,44 @@ IO_WriteHandleObject::~IO_WriteHandleObject(){
 	//LOG_MSG("FreeWritehandler called with port %X",m_port);
 }
 
+static IO_ReadBlockHandler * io_readblockhandlers[IO_MAX];
+static IO_WriteBlockHandler * io_writeblockhandlers[IO_MAX];
+
+void IO_RegisterBlockHandler(Bitu port,IO_ReadBlockHandler * r_handler,IO_WriteBlockHandler * w_handler,Bitu range) {
+	while (range--) {
+		io_readblockhandlers[port]=r_handler;
+		io_writeblockhandlers[port]=w_handler;
+		port++;
+	}
+}
+
+void IO_FreeBlockHandler(Bitu port,Bitu range) {
+	while (range--) {
+		io_readblockhandlers[port]=NULL;
+		io_writeblockhandlers[port]=NULL;
+		port++;
+	}
+}
+
+void IO_BlockHandleObject::Install(Bitu port,IO_ReadBlockHandler * r_handler,IO_WriteBlockHandler * w_handler,Bitu range) {
+	if(!installed) {
+		installed=true;
+		m_port=port;
+		m_range=range;
+		IO_RegisterBlockHandler(port,r_handler,w_handler,range);
+	} else E_Exit("IO_blockHandler already installed port %x",(int)port);
+}
+
+void IO_BlockHandleObject::Uninstall() {
+	if(!installed) return;
+	IO_FreeBlockHandler(m_port,m_range);
+	installed=false;
+}
+
+IO_BlockHandleObject::~IO_BlockHandleObject(){
+	Uninstall();
+}
+
 
 /* Some code to make io operations take some virtual time. Helps certain
  * games with their timing of certain operations
@@ -562,6 +601,68 @@ uint32_t IO_ReadD(Bitu port) {
 	return retval;
 }
 
+/* The block fast path is skipped wherever single element I/O would do more than call the
+ * handler: V86 mode (the I/O permission bitmap may trap the port) and port logging */
+static inline bool IO_BlockAllowed(void) {
+#ifdef ENABLE_PORTLOG
+	return false;
+#else
+	return !GETFLAG(VM);
+#endif
+}
+
+bool IO_HasBlockHandler(Bitu port) {
+	return io_readblockhandlers[port] != NULL || io_writeblockhandlers[port] != NULL;
+}
+
+Bitu IO_ReadBlockToMem(Bitu port,uint32_t addr,Bitu count,Bitu iolen) {
+	IO_ReadBlockHandler * const handler = io_readblockhandlers[port];
+	if (handler == NULL || !IO_BlockAllowed()) return 0;
+
+	const unsigned int szidx = (iolen == 4) ? 2 : (iolen == 2 ? 1 : 0);
+	Bitu done = 0;
+	while (done < count) {
+		/* one run per page, straight into RAM, without consuming anything from the
+		 * device the CPU could then fail to store */
+		const LinearPt a = (LinearPt)(addr + done * iolen);
+		const HostPt tlb_addr = get_tlb_write(a);
+		if (tlb_addr == NULL) break;
+		Bitu n = (4096u - (a & 0xfffu)) / iolen;
+		if (n == 0) break;
+		if (n > (count - done)) n = count - done;
+
+		const Bitu got = handler(port,tlb_addr + a,n,iolen);
+		done += got;
+		if (got < n) break;
+	}
+
+	for (Bitu i=0;i < done;i++) IO_USEC_read_delay(szidx);
+	return done;
+}
+
+Bitu IO_WriteBlockFromMem(Bitu port,uint32_t addr,Bitu count,Bitu iolen) {
+	IO_WriteBlockHandler * const handler = io_writeblockhandlers[port];
+	if (handler == NULL || !IO_BlockAllowed()) return 0;
+
+	const unsigned int szidx = (iolen == 4) ? 2 : (iolen == 2 ? 1 : 0);
+	Bitu done = 0;
+	while (done < count) {
+		const LinearPt a = (LinearPt)(addr + done * iolen);
+		const HostPt tlb_addr = get_tlb_read(a);
+		if (tlb_addr == NULL) break;
+		Bitu n = (4096u - (a & 0xfffu)) / iolen;
+		if (n == 0) break;
+		if (n > (count - done)) n = count - done;
+
+		const Bitu got = handler(port,tlb_addr + a,n,iolen);
+		done += got;
+		if (got < n) break;
+	}
+
+	for (Bitu i=0;i < done;i++) IO_USEC_write_delay(szidx);
+	return done;
+}
+
 void IO_Reset(Section * /*sec*/) { // Reset or power on
 	Section_prop * section=static_cast<Section_prop *>(control->GetSection("dosbox"));
 
@@ -25,6 +25,7 @@
 #include <time.h>
 #include <stdio.h>
 #include <assert.h>
+#include <unordered_map>
 #include "cross.h"
 #include "logging.h"
 #include "support.h"
@@ -76,7 +77,7 @@ SDLNet_SocketSet clientSocketSet;
 packetBuffer incomingPacket;
 
 static uint16_t socketCount;
-static uint16_t opensockets[SOCKTABLESIZE]; 
+static uint32_t opensockets[0x10000/32];	// bit per socket number
 
 static uint16_t swapByte(uint16_t sockNum) {
 	return ((sockNum>> 8) | (sockNum << 8));
@@ -94,6 +95,16 @@ void PackIP(IPaddress ipAddr, PackedIP *ipPack) {
 
 ECBClass *ECBList;  // Linked list of ECB's
 ECBClass* ESRList;	// ECBs waiting to be ESR notified
+static ECBClass *ECBListTail;
+static ECBClass *ESRListTail;
+
+/* Listening ECBs by socket number, oldest first, so that an incoming packet
+ * finds its ECB without walking all of ECBList */
+struct ECBSocketList {
+	ECBClass *head = NULL;
+	ECBClass *tail = NULL;
+};
+static std::unordered_map<uint16_t,ECBSocketList> ECBListening;
 
 #ifdef IPX_DEBUGMSG 
 Bitu ECBSerialNumber = 0;
@@ -120,21 +131,19 @@ ECBClass::ECBClass(uint16_t segment, uint16_t offset) {
 		RealOff(ECBAddr)+4),segment,offset);
 #endif
 	isInESRList = false;
+	isListening = false;
 	prevECB = NULL;
 	nextECB = NULL;
+	prevSockECB = NULL;
+	nextSockECB = NULL;
 	
 	if (ECBList == NULL)
 		ECBList = this;
 	else {
-		// Transverse the list until we hit the end
-		ECBClass *useECB = ECBList;
-		
-		while(useECB->nextECB != NULL)
-			useECB = useECB->nextECB;
-
-		useECB->nextECB = this;
-		this->prevECB = useECB;
+		ECBListTail->nextECB = this;
+		this->prevECB = ECBListTail;
 	}
+	ECBListTail = this;
 
 	iuflag = getInUseFlag();
 	mysocket = getSocket();
@@ -187,9 +196,36 @@ uint8_t ECBClass::getInUseFlag(void) {
 void ECBClass::setInUseFlag(uint8_t flagval) {
 	assert(!dos_kernel_disabled);//Do NOT touch guest memory if the DOSBox kernel is not running!
 	iuflag = flagval;
+	if (flagval == USEFLAG_LISTENING && !isInESRList) linkListening();
+	else unlinkListening();
 	real_writeb(RealSeg(ECBAddr), RealOff(ECBAddr) + 0x8, flagval);
 }
 
+void ECBClass::linkListening(void) {
+	if (isListening) return;
+	ECBSocketList &sock = ECBListening[mysocket];
+	prevSockECB = sock.tail;
+	nextSockECB = NULL;
+	if (sock.tail != NULL) sock.tail->nextSockECB = this;
+	else sock.head = this;
+	sock.tail = this;
+	isListening = true;
+}
+
+void ECBClass::unlinkListening(void) {
+	if (!isListening) return;
+	auto sock = ECBListening.find(mysocket);
+	assert(sock != ECBListening.end());
+	if (prevSockECB != NULL) prevSockECB->nextSockECB = nextSockECB;
+	else sock->second.head = nextSockECB;
+	if (nextSockECB != NULL) nextSockECB->prevSockECB = prevSockECB;
+	else sock->second.tail = prevSockECB;
+	if (sock->second.head == NULL) ECBListening.erase(sock);
+	prevSockECB = NULL;
+	nextSockECB = NULL;
+	isListening = false;
+}
+
 void ECBClass::setCompletionFlag(uint8_t flagval) {
 	assert(!dos_kernel_disabled);//Do NOT touch guest memory if the DOSBox kernel is not running!
 	real_writeb(RealSeg(ECBAddr), RealOff(ECBAddr) + 0x9, flagval);
@@ -224,13 +260,15 @@ void ECBClass::NotifyESR(void) {
 	if(ESRval || databuffer) { // databuffer: write data at realmode/v86 time
 		// LOG_IPX("ECB: SN%7d to be notified.", SerialNumber);
 		// take the ECB out of the current list
+		unlinkListening();
 		if(prevECB == NULL) {	// was the first in the list
 			ECBList = nextECB;
 			if(ECBList != NULL) ECBList->prevECB = NULL;
 		} else {		// not the first
 			prevECB->nextECB = nextECB;
-			if(nextECB != NULL) nextECB->prevECB = prevECB;
 		}
+		if(nextECB != NULL) nextECB->prevECB = prevECB;
+		else ECBListTail = prevECB;
 
 		nextECB = NULL;
 		// put it to the notification queue
@@ -238,14 +276,10 @@ void ECBClass::NotifyESR(void) {
 			ESRList = this;
 			prevECB = NULL;
 		} else  {// put to end of ESR list
-			ECBClass* useECB = ESRList;
-		
-			while(useECB->nextECB != NULL)
-				useECB = useECB->nextECB;
-
-			useECB->nextECB = this;
-			prevECB = useECB;
+			ESRListTail->nextECB = this;
+			prevECB = ESRListTail;
 		}
+		ESRListTail = this;
 		isInESRList = true;
 		PIC_ActivateIRQ(11);
 	}
@@ -274,14 +308,18 @@ ECBClass::~ECBClass() {
 	if(isInESRList) {
 		// in ESR list, always the first element is deleted.
 		ESRList=nextECB;
+		if(ESRList != NULL) ESRList->prevECB = NULL;
+		else ESRListTail = NULL;
 	} else {
+		unlinkListening();
 		if(prevECB == NULL) {	// was the first in the list
 			ECBList = nextECB;
 			if(ECBList != NULL) ECBList->prevECB = NULL;
 		} else {	// not the first
 			prevECB->nextECB = nextECB;
-			if(nextECB != NULL) nextECB->prevECB = prevECB;
 		}
+		if(nextECB != NULL) nextECB->prevECB = prevECB;
+		else ECBListTail = prevECB;
 	}
 	if (databuffer) delete[] databuffer;
 }
@@ -289,10 +327,7 @@ ECBClass::~ECBClass() {
 
 
 static bool sockInUse(uint16_t sockNum) {
-	for(Bitu i=0;i<socketCount;i++) {
-		if (opensockets[i] == sockNum) return true;
-	}
-	return false;
+	return (opensockets[sockNum >> 5u] >> (sockNum & 31u)) & 1u;
 }
 
 static void OpenSocket(void) {
@@ -321,7 +356,7 @@ static void OpenSocket(void) {
 		} 
 	}
 
-	opensockets[socketCount] = sockNum;
+	opensockets[sockNum >> 5u] |= 1u << (sockNum & 31u);
 	socketCount++;
 
 	reg_al = 0x00; // Success
@@ -346,10 +381,11 @@ static void DumpAllSockets(void) {
 	}
 
 	ECBList = NULL;
+	ECBListTail = NULL;
 }
 
 static void CloseSocket(void) {
-	uint16_t sockNum, i;
+	uint16_t sockNum;
 	ECBClass* tmpECB = ECBList;
 	ECBClass* tmp2ECB = ECBList;
 
@@ -358,13 +394,7 @@ static void CloseSocket(void) {
 	sockNum = swapByte(reg_dx);
 	if(!sockInUse(sockNum)) return;
 
-	for(i=0;i<socketCount-1;i++) {
-		if (opensockets[i] == sockNum) {
-			// Realign list of open sockets
-			memcpy(&opensockets[i], &opensockets[i+1], size_t(SOCKTABLESIZE - (i + 1)));
-			break;
-		}
-	}
+	opensockets[sockNum >> 5u] &= ~(1u << (sockNum & 31u));
 	--socketCount;
 	
 	// delete all ECBs of that socket
@@ -621,9 +651,9 @@ static void pingSend(void) {
 
 void NE2K_IncomingIPX(const unsigned char *buf,unsigned int len);
 
-static void receivePacket(uint8_t *buffer, int16_t bufSize) {
+// Returns false if nobody was listening for the packet
+static bool receivePacket(uint8_t *buffer, int16_t bufSize) {
 	ECBClass *useECB;
-	ECBClass *nextECB;
 	uint16_t *bufword = (uint16_t *)buffer;
 	uint16_t useSocket = swapByte(bufword[8]);
 	IPXHeader * tmpHeader;
@@ -631,7 +661,7 @@ static void receivePacket(uint8_t *buffer, int16_t bufSize) {
 
 	if (ne2k_ipx_redirect) {
 		NE2K_IncomingIPX(buffer,bufSize);
-		return;
+		return true;
 	}
 
 	// Check to see if ping packet
@@ -643,34 +673,34 @@ static void receivePacket(uint8_t *buffer, int16_t bufSize) {
 			IPaddress tmpAddr;
 			UnpackIP(tmpHeader->src.addr.byIP, &tmpAddr);
 			pingAck(tmpAddr);
-			return;
+			return true;
 		}
 	}
 
-	useECB = ECBList;
-	while(useECB != NULL)
-	{
-		nextECB = useECB->nextECB;
-		if(useECB->iuflag == USEFLAG_LISTENING && useECB->mysocket == useSocket) {
-			useECB->writeDataBuffer(buffer, (uint16_t)bufSize);
-			useECB->NotifyESR();
-			return;
-		}
-		useECB = nextECB;
+	auto listening = ECBListening.find(useSocket);
+	if(listening != ECBListening.end()) {
+		useECB = listening->second.head;
+		assert(useECB != NULL && useECB->iuflag == USEFLAG_LISTENING);
+		useECB->writeDataBuffer(buffer, (uint16_t)bufSize);
+		useECB->NotifyESR();
+		return true;
 	}
 	LOG_IPX("IPX: RX Packet loss!");
+	return false;
 }
 
 static void IPX_ClientLoop(void) {
-	int numrecv;
 	UDPpacket inPacket;
 	inPacket.data = (Uint8 *)recvBuffer;
 	inPacket.maxlen = IPXBUFFERSIZE;
 	inPacket.channel = UDPChannel;
 
 	// Its amazing how much simpler UDP is than TCP
-	numrecv = SDLNet_UDP_Recv(ipxClientSocket, &inPacket);
-	if(numrecv) receivePacket(inPacket.data, inPacket.len);
+	// Take everything that is waiting while the guest has ECBs posted for it,
+	// the rest stays queued in the socket until the ESRs repost theirs
+	while(incomingPacket.connected && SDLNet_UDP_Recv(ipxClientSocket, &inPacket) > 0) {
+		if(!receivePacket(inPacket.data, inPacket.len)) break;
+	}
 }
 
 
@@ -944,6 +974,7 @@ void IPX_NetworkInit() {
 	localIpxAddr.netnode[5] = 0x00;
 
 	socketCount = 0;
+	memset(opensockets,0,sizeof(opensockets));
 	return;
 }
 
@@ -1118,10 +1149,10 @@ public:
 				if(isIpxServer) {
 					WriteOut("List of active connections:\n\n");
 					int i;
-					IPaddress *ptrAddr;
+					IPaddress connAddr;
 					for(i=0;i<SOCKETTABLESIZE;i++) {
-						if(IPX_isConnectedToServer(i,&ptrAddr)) {
-							WriteOut("     %d.%d.%d.%d from port %d\n", CONVIP(ptrAddr->host), SDLNet_Read16(&ptrAddr->port));
+						if(IPX_isConnectedToServer(i,&connAddr)) {
+							WriteOut("     %d.%d.%d.%d from port %d\n", CONVIP(connAddr.host), SDLNet_Read16(&connAddr.port));
 						}
 					}
 					WriteOut("\n");
@@ -1209,6 +1240,9 @@ public:
 
 		ECBList = NULL;
 		ESRList = NULL;
+		ECBListTail = NULL;
+		ESRListTail = NULL;
+		ECBListening.clear();
 		isIpxServer = false;
 		isIpxConnected = false;
 		IPX_NetworkInit();
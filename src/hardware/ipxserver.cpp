@@ -24,10 +24,20 @@
 #include "dosbox.h"
 #include "ipxserver.h"
 #include "logging.h"
-#include "timer.h"
 #include <stdlib.h>
 #include <string.h>
 #include "ipx.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* The server runs on a thread of its own, sleeping until packets arrive and
+ * then forwarding everything that is waiting, so a busy session no longer
+ * gets one packet per emulated millisecond out of it. Clients are found
+ * through a hash of their IPX node address, broadcasts go to a compact list
+ * of the connected ones. */
 
 IPaddress ipxServerIp;  // IPAddress for server's listening port
 UDPsocket ipxServerSocket;  // Listening server socket
@@ -39,7 +49,16 @@ PackedIP ipconnguest[SOCKETTABLESIZE]; // the MAC address associated with each c
 IPaddress ipconn[SOCKETTABLESIZE];  // Active TCP/IP connection 
 UDPsocket tcpconn[SOCKETTABLESIZE];  // Active TCP/IP connections
 SDLNet_SocketSet serverSocketSet;
-TIMER_TickHandler* serverTimer;
+
+static std::mutex serverLock;	// the tables above, against IPX_isConnectedToServer
+static std::unordered_map<uint64_t,uint16_t> serverNodes;	// guest node -> table index
+static std::vector<uint16_t> serverActive;	// connected table indices, for broadcasts
+static std::thread serverThread;
+static std::atomic<bool> serverStop(false);
+
+static inline uint64_t nodeKey(uint32_t host, uint16_t port) {
+	return ((uint64_t)port << 32) | host;
+}
 
 uint8_t packetCRC(uint8_t *buffer, uint16_t bufSize) {
 	uint8_t tmpCRC = 0;
@@ -68,7 +87,6 @@ static void closeSocket(uint16_t sockidx) {
 static void sendIPXPacket(uint8_t *buffer, int16_t bufSize) {
 	uint16_t srcport, destport;
 	uint32_t srchost, desthost;
-	uint16_t i;
 	Bits result;
 	UDPpacket outPacket;
 	outPacket.channel = -1;
@@ -85,41 +103,37 @@ static void sendIPXPacket(uint8_t *buffer, int16_t bufSize) {
 	destport = tmpHeader->dest.addr.byIP.port;
 
 	if(desthost == 0xffffffff) {
-		// Broadcast
-		for(i=0;i<SOCKETTABLESIZE;i++) {
-			if(connBuffer[i].connected && ((ipconnguest[i].host != srchost)||(ipconnguest[i].port!=srcport))) {
-				outPacket.address = ipconn[i];
-				result = SDLNet_UDP_Send(ipxServerSocket,-1,&outPacket);
-				if(result == 0) {
-					LOG_MSG("IPXSERVER: %s", SDLNet_GetError());
-					continue;
-				}
-				//LOG_MSG("IPXSERVER: Packet of %d bytes sent from %d.%d.%d.%d to %d.%d.%d.%d (BROADCAST) (%x CRC)", bufSize, CONVIP(srchost), CONVIP(ipconn[i].host), packetCRC(&buffer[30], bufSize-30));
+		// Broadcast to everybody but the sender
+		auto src = serverNodes.find(nodeKey(srchost,srcport));
+		const int srcidx = (src != serverNodes.end()) ? (int)src->second : -1;
+		for(uint16_t i : serverActive) {
+			if((int)i == srcidx) continue;
+			outPacket.address = ipconn[i];
+			result = SDLNet_UDP_Send(ipxServerSocket,-1,&outPacket);
+			if(result == 0) {
+				LOG_MSG("IPXSERVER: %s", SDLNet_GetError());
+				continue;
 			}
+			//LOG_MSG("IPXSERVER: Packet of %d bytes sent from %d.%d.%d.%d to %d.%d.%d.%d (BROADCAST) (%x CRC)", bufSize, CONVIP(srchost), CONVIP(ipconn[i].host), packetCRC(&buffer[30], bufSize-30));
 		}
 	} else {
 		// Specific address
-		for(i=0;i<SOCKETTABLESIZE;i++) {
-			if((connBuffer[i].connected) && (ipconnguest[i].host == desthost) && (ipconnguest[i].port == destport)) {
-				outPacket.address = ipconn[i];
-				result = SDLNet_UDP_Send(ipxServerSocket,-1,&outPacket);
-				if(result == 0) {
-					LOG_MSG("IPXSERVER: %s", SDLNet_GetError());
-					continue;
-				}
-				//LOG_MSG("IPXSERVER: Packet sent from %d.%d.%d.%d to %d.%d.%d.%d", CONVIP(srchost), CONVIP(desthost));
-			}
+		auto dest = serverNodes.find(nodeKey(desthost,destport));
+		if(dest != serverNodes.end()) {
+			outPacket.address = ipconn[dest->second];
+			result = SDLNet_UDP_Send(ipxServerSocket,-1,&outPacket);
+			if(result == 0)
+				LOG_MSG("IPXSERVER: %s", SDLNet_GetError());
+			//LOG_MSG("IPXSERVER: Packet sent from %d.%d.%d.%d to %d.%d.%d.%d", CONVIP(srchost), CONVIP(desthost));
 		}
 	}
-
-
-
-
 }
 
-bool IPX_isConnectedToServer(Bits tableNum, IPaddress ** ptrAddr) {
+/* copies the address out, the table entry may be reused as soon as the lock is dropped */
+bool IPX_isConnectedToServer(Bits tableNum, IPaddress * ptrAddr) {
 	if(tableNum >= SOCKETTABLESIZE) return false;
-	*ptrAddr = &ipconn[tableNum];
+	std::lock_guard<std::mutex> guard(serverLock);
+	*ptrAddr = ipconn[tableNum];
 	return connBuffer[tableNum].connected;
 }
 
@@ -153,80 +167,102 @@ static void ackClient(IPaddress clientAddr,bool extAck,PackedIP *guestmac) {
 	SDLNet_UDP_Send(ipxServerSocket,-1,&regPacket);
 }
 
-static void IPX_ServerLoop() {
-	UDPpacket inPacket;
+// Returns true if the packet was a registration and has been handled
+static bool registerClient(UDPpacket &inPacket) {
 	IPaddress tmpAddr;
+	uint32_t host;
+	IPXHeader *tmpHeader;
+	tmpHeader = (IPXHeader *)&inBuffer[0];
+
+	// Check to see if incoming packet is a registration packet
+	// For this, I just spoofed the echo protocol packet designation 0x02
+	if(SDLNet_Read16(tmpHeader->dest.socket) != 0x2) return false;
+	// Null destination node means it's a server registration packet
+	if(tmpHeader->dest.addr.byIP.host != 0x0) return false;
+
+	UnpackIP(tmpHeader->src.addr.byIP, &tmpAddr);
+	auto known = serverNodes.find(nodeKey(tmpAddr.host,tmpAddr.port));
+	if(known != serverNodes.end()) {
+		const uint16_t i = known->second;
+		LOG_MSG("IPXSERVER: Reconnect from %d.%d.%d.%d", CONVIP(tmpAddr.host));
+		// Update anonymous port number if changed
+		ipconn[i].port = inPacket.address.port;
+		ackClient(inPacket.address,false,&ipconnguest[i]);
+		return true;
+	}
 
-	//char regString[] = "IPX Register\0";
+	for(uint16_t i=0;i<SOCKETTABLESIZE;i++) {
+		if(connBuffer[i].connected) continue;
 
-	uint16_t i;
-	uint32_t host;
-	Bits result;
+		bool extAck = false;
+
+		// Use preferred host IP rather than the reported source IP
+		// It may be better to use the reported source
+		ipconn[i] = inPacket.address;
+
+		// Other DOSBox forks may expect the MAC address to match the IP host + port combined. Default behavior.
+		ipconnguest[i].host = inPacket.address.host;
+		ipconnguest[i].port = inPacket.address.port;
+
+		// Allow client to register their own MAC address. Guest MAC address sits just after header at offset 30.
+		if (tmpHeader->transControl == (unsigned char)'M' && inPacket.len >= (30+6)) {
+			LOG_MSG("IPXSERVER: Allowing client to register their own MAC address (DOSBox-X extension) %02x:%02x:%02x:%02x:%02x:%02x",
+				inBuffer[30],inBuffer[31],inBuffer[32],inBuffer[33],inBuffer[34],inBuffer[35]);
+			memcpy(&ipconnguest[i],&inBuffer[30],6);
+			extAck = true;
+		}
+
+		connBuffer[i].connected = true;
+		serverNodes[nodeKey(ipconnguest[i].host,ipconnguest[i].port)] = i;
+		serverActive.push_back(i);
+		host = ipconn[i].host;
+		LOG_MSG("IPXSERVER: Connect from %d.%d.%d.%d", CONVIP(host));
+		ackClient(inPacket.address,extAck,&ipconnguest[i]);
+		return true;
+	}
+
+	LOG_MSG("IPXSERVER: Connection table full, %d.%d.%d.%d not registered", CONVIP(inPacket.address.host));
+	return true;
+}
+
+static void IPX_ServerLoop() {
+	UDPpacket inPacket;
 
 	inPacket.channel = -1;
 	inPacket.data = &inBuffer[0];
 	inPacket.maxlen = IPXBUFFERSIZE;
 
+	SDLNet_SocketSet set = SDLNet_AllocSocketSet(1);
+	if(!set) {
+		LOG_MSG("IPXSERVER: %s", SDLNet_GetError());
+		return;
+	}
+	SDLNet_UDP_AddSocket(set,ipxServerSocket);
 
-	result = SDLNet_UDP_Recv(ipxServerSocket, &inPacket);
-	if (result != 0) {
-		// Check to see if incoming packet is a registration packet
-		// For this, I just spoofed the echo protocol packet designation 0x02
-		IPXHeader *tmpHeader;
-		tmpHeader = (IPXHeader *)&inBuffer[0];
-
-		// Check to see if echo packet
-		if(SDLNet_Read16(tmpHeader->dest.socket) == 0x2) {
-			// Null destination node means it's a server registration packet
-			if(tmpHeader->dest.addr.byIP.host == 0x0) {
-				UnpackIP(tmpHeader->src.addr.byIP, &tmpAddr);
-				for(i=0;i<SOCKETTABLESIZE;i++) {
-					if(!connBuffer[i].connected) {
-						bool extAck = false;
-
-						// Use preferred host IP rather than the reported source IP
-						// It may be better to use the reported source
-						ipconn[i] = inPacket.address;
-
-						// Other DOSBox forks may expect the MAC address to match the IP host + port combined. Default behavior.
-						ipconnguest[i].host = inPacket.address.host;
-						ipconnguest[i].port = inPacket.address.port;
-
-						// Allow client to register their own MAC address. Guest MAC address sits just after header at offset 30.
-						if (tmpHeader->transControl == (unsigned char)'M' && inPacket.len >= (30+6)) {
-							LOG_MSG("IPXSERVER: Allowing client to register their own MAC address (DOSBox-X extension) %02x:%02x:%02x:%02x:%02x:%02x",
-								inBuffer[30],inBuffer[31],inBuffer[32],inBuffer[33],inBuffer[34],inBuffer[35]);
-							memcpy(&ipconnguest[i],&inBuffer[30],6);
-							extAck = true;
-						}
-
-						connBuffer[i].connected = true;
-						host = ipconn[i].host;
-						LOG_MSG("IPXSERVER: Connect from %d.%d.%d.%d", CONVIP(host));
-						ackClient(inPacket.address,extAck,&ipconnguest[i]);
-						return;
-					} else {
-						if((ipconnguest[i].host == tmpAddr.host) && (ipconnguest[i].port == tmpAddr.port)) {
-							LOG_MSG("IPXSERVER: Reconnect from %d.%d.%d.%d", CONVIP(tmpAddr.host));
-							// Update anonymous port number if changed
-							ipconn[i].port = inPacket.address.port;
-							ackClient(inPacket.address,false,&ipconnguest[i]);
-							return;
-						}
-					}
-					
-				}
-			}
-		}
+	while(!serverStop) {
+		// the timeout only bounds how long IPX_StopServer waits
+		if(SDLNet_CheckSockets(set,100) <= 0) continue;
 
-		// IPX packet is complete.  Now interpret IPX header and send to respective IP address
-		sendIPXPacket((uint8_t *)inPacket.data, inPacket.len);
+		// forward everything that is waiting
+		while(!serverStop && SDLNet_UDP_Recv(ipxServerSocket, &inPacket) > 0) {
+			std::lock_guard<std::mutex> guard(serverLock);
+			if(registerClient(inPacket)) continue;
+
+			// IPX packet is complete.  Now interpret IPX header and send to respective IP address
+			sendIPXPacket((uint8_t *)inPacket.data, inPacket.len);
+		}
 	}
+
+	SDLNet_FreeSocketSet(set);
 }
 
 void IPX_StopServer() {
-	TIMER_DelTickHandler(&IPX_ServerLoop);
+	if(serverThread.joinable()) {
+		serverStop = true;
+		serverThread.join();
+	}
 	SDLNet_UDP_Close(ipxServerSocket);
+	ipxServerSocket = NULL;
 }
 
 bool IPX_StartServer(uint16_t portnum) {
@@ -239,8 +275,11 @@ bool IPX_StartServer(uint16_t portnum) {
 		if(!ipxServerSocket) return false;
 
 		for(i=0;i<SOCKETTABLESIZE;i++) connBuffer[i].connected = false;
+		serverNodes.clear();
+		serverActive.clear();
 
-		TIMER_AddTickHandler(&IPX_ServerLoop);
+		serverStop = false;
+		serverThread = std::thread(IPX_ServerLoop);
 		return true;
 	}
 	return false;
@@ -50,6 +50,8 @@
 #include "glidedef.h"
 
 #include <string.h>
+#include <map>
+#include <set>
 
 #if C_GAMELINK
 #include "../gamelink/gamelink.h"
@@ -986,30 +988,138 @@ Bitu MEM_TotalPagesAt4GB(void) {
     return memory.reported_pages_4gb;
 }
 
-Bitu MEM_FreeLargest(void) {
-    Bitu size=0;Bitu largest=0;
-    Bitu index=XMS_START;   
-    while (index<memory.reported_pages) {
+/* Guest RAM that came from an anonymous mapping. The host supplies zero pages
+ * on first touch, so RAM the guest never uses is not committed, and pages the
+ * guest frees through XMS/EMS can be handed back to the host. */
+static bool mem_anonymous_map = false;
+static bool mem_release_freed = false;
+
+static inline bool MEM_PageHasCode(uint32_t page) {
+    return page < memory.handler_pages && memory.phandlers[page] != NULL && (memory.phandlers[page]->flags & PFLAG_HASCODE) != 0;
+}
+
+static void MEM_ReleaseHostPages(uint32_t page,uint32_t count) {
+#if C_HAVE_MMAP && defined(MADV_DONTNEED) && !C_GAMELINK
+    if (!mem_anonymous_map || !mem_release_freed || MemBase == NULL) return;
+
+    /* only whole host pages, which may be larger than 4KB */
+    static const uintptr_t host_page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uint32_t end_page = page + count;
+
+    /* The dynamic cores keep translated code per page and only notice guest writes
+     * through the page handler, zeroing behind their back would leave stale code.
+     * Pages with code are therefore kept, the runs between them are released. */
+    while (page < end_page) {
+        while (page < end_page && MEM_PageHasCode(page)) page++;
+
+        const uint32_t run = page;
+        while (page < end_page && !MEM_PageHasCode(page)) page++;
+        if (page == run) continue;
+
+        uintptr_t start = (uintptr_t)MemBase + ((uintptr_t)run << 12u);
+        uintptr_t end = (uintptr_t)MemBase + ((uintptr_t)page << 12u);
+        start = (start + host_page - 1u) & ~(host_page - 1u);
+        end &= ~(host_page - 1u);
+        if (end > start) madvise((void*)start,(size_t)(end - start),MADV_DONTNEED);
+    }
+#else
+    (void)page;
+    (void)count;
+#endif
+}
+
+/* Free runs of EMS/XMS pages, kept in step with memory.mhandles so that the
+ * allocator does not have to walk the whole handle array on every call. The
+ * handle array is still the authoritative state (it is what savestates store),
+ * the extents are rebuilt from it whenever it is replaced wholesale. */
+static std::map<uint32_t,uint32_t> mem_free_by_start;              /* first page -> pages */
+static std::set< std::pair<uint32_t,uint32_t> > mem_free_by_size;  /* (pages, first page), best fit order */
+static Bitu mem_free_pages = 0;
+
+static void MEM_FreeExtentInsert(uint32_t start,uint32_t count) {
+    mem_free_by_start[start] = count;
+    mem_free_by_size.insert(std::make_pair(count,start));
+}
+
+static void MEM_FreeExtentErase(std::map<uint32_t,uint32_t>::iterator it) {
+    mem_free_by_size.erase(std::make_pair(it->second,it->first));
+    mem_free_by_start.erase(it);
+}
+
+/* extent holding page, or end() if the page is not free */
+static std::map<uint32_t,uint32_t>::iterator MEM_FreeExtentAt(uint32_t page) {
+    auto it = mem_free_by_start.upper_bound(page);
+    if (it == mem_free_by_start.begin()) return mem_free_by_start.end();
+    --it;
+    if (page >= it->first + it->second) return mem_free_by_start.end();
+    return it;
+}
+
+static void MEM_FreeExtentsRebuild(void) {
+    mem_free_by_start.clear();
+    mem_free_by_size.clear();
+    mem_free_pages = 0;
+    if (memory.mhandles == NULL) return;
+
+    uint32_t first = 0;
+    for (uint32_t index = XMS_START;index < memory.reported_pages;index++) {
         if (!memory.mhandles[index]) {
-            size++;
-        } else {
-            if (size>largest) largest=size;
-            size=0;
+            if (!first) first = index;
+        }
+        else if (first) {
+            MEM_FreeExtentInsert(first,index - first);
+            mem_free_pages += index - first;
+            first = 0;
         }
-        index++;
     }
-    if (size>largest) largest=size;
-    return largest;
+    if (first) {
+        MEM_FreeExtentInsert(first,(uint32_t)memory.reported_pages - first);
+        mem_free_pages += memory.reported_pages - first;
+    }
 }
 
-Bitu MEM_FreeTotal(void) {
-    Bitu free=0;
-    Bitu index=XMS_START;   
-    while (index<memory.reported_pages) {
-        if (!memory.mhandles[index]) free++;
-        index++;
+/* mark [start,start+count) allocated, the range must lie within one free extent */
+static void MEM_FreeExtentTake(uint32_t start,uint32_t count) {
+    auto it = MEM_FreeExtentAt(start);
+    if (it == mem_free_by_start.end() || (start + count) > (it->first + it->second))
+        E_Exit("MEM:corruption during allocate");
+
+    const uint32_t ext_start = it->first, ext_end = it->first + it->second;
+    MEM_FreeExtentErase(it);
+    if (start > ext_start) MEM_FreeExtentInsert(ext_start,start - ext_start);
+    if (start + count < ext_end) MEM_FreeExtentInsert(start + count,ext_end - (start + count));
+    mem_free_pages -= count;
+}
+
+/* return [start,start+count) to the free extents, merging with its neighbours */
+static void MEM_FreeExtentGive(uint32_t start,uint32_t count) {
+    if (start < XMS_START || (start + count) > memory.reported_pages) return;
+    MEM_ReleaseHostPages(start,count);
+    mem_free_pages += count;
+
+    auto next = mem_free_by_start.lower_bound(start);
+    if (next != mem_free_by_start.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == start) {
+            start = prev->first;
+            count += prev->second;
+            MEM_FreeExtentErase(prev);
+        }
     }
-    return free;
+    if (next != mem_free_by_start.end() && next->first == start + count) {
+        count += next->second;
+        MEM_FreeExtentErase(next);
+    }
+    MEM_FreeExtentInsert(start,count);
+}
+
+Bitu MEM_FreeLargest(void) {
+    if (mem_free_by_size.empty()) return 0;
+    return mem_free_by_size.rbegin()->first;
+}
+
+Bitu MEM_FreeTotal(void) {
+    return mem_free_pages;
 }
 
 Bitu MEM_AllocatedPages(MemHandle handle) 
@@ -1024,48 +1134,17 @@ Bitu MEM_AllocatedPages(MemHandle handle)
 
 //TODO Maybe some protection for this whole allocation scheme
 
+/* smallest free block that fits, the lowest one of those if there are several */
 INLINE uint32_t BestMatch(Bitu size) {
-    uint32_t index=XMS_START;   
-    uint32_t first=0;
-    uint32_t best=0xfffffff;
-    uint32_t best_first=0;
-    while (index<memory.reported_pages) {
-        /* Check if we are searching for first free page */
-        if (!first) {
-            /* Check if this is a free page */
-            if (!memory.mhandles[index]) {
-                first=index;    
-            }
-        } else {
-            /* Check if this still is used page */
-            if (memory.mhandles[index]) {
-                uint32_t pages=index-first;
-                if (pages==size) {
-                    return first;
-                } else if (pages>size) {
-                    if (pages<best) {
-                        best=pages;
-                        best_first=first;
-                    }
-                }
-                first=0;            //Always reset for new search
-            }
-        }
-        index++;
-    }
-    /* Check for the final block if we can */
-    if (first && (index-first>=size) && (index-first<best)) {
-        return first;
-    }
-    return best_first;
+    auto it = mem_free_by_size.lower_bound(std::make_pair((uint32_t)size,(uint32_t)0));
+    if (it == mem_free_by_size.end()) return 0;
+    return it->second;
 }
 
 /* alternate copy, that will only allocate memory on addresses
  * where the 20th address bit is zero. memory allocated in this
  * way will always be accessible no matter the state of the A20 gate */
 INLINE uint32_t BestMatch_A20_friendly(Bitu size) {
-    uint32_t index=XMS_START;
-    uint32_t first=0;
     uint32_t best=0xfffffff;
     uint32_t best_first=0;
 
@@ -1078,39 +1157,29 @@ INLINE uint32_t BestMatch_A20_friendly(Bitu size) {
      *        by instead scanning from the top down i.e. so the EMS system memory takes the top of
      *        extended memory and the DOS program is free to gobble up a large continuous range from
      *        below? */
-    while (index<memory.reported_pages) {
-        /* Check if we are searching for first free page */
-        if (!first) {
-            /* if the index is now on an odd megabyte, skip forward and try again */
+    for (const auto &ext : mem_free_by_start) {
+        uint32_t index = ext.first;
+        const uint32_t ext_end = ext.first + ext.second;
+
+        /* split each free block at the odd megabytes, which count as used */
+        while (index < ext_end) {
             if (index & 0x100) {
                 index = (index|0xFF)+1; /* round up to an even megabyte */
                 continue;
             }
 
-            /* Check if this is a free page */
-            if (!memory.mhandles[index]) {
-                first=index;
-            }
-        } else {
-            /* Check if this still is used page or on odd megabyte */
-            if (memory.mhandles[index] || (index & 0x100)) {
-                uint32_t pages=index-first;
-                if (pages==size) {
-                    return first;
-                } else if (pages>size) {
-                    if (pages<best) {
-                        best=pages;
-                        best_first=first;
-                    }
+            const uint32_t first = index;
+            index = std::min(ext_end,(index|0xFF)+1);
+            const uint32_t pages = index-first;
+            if (pages==size) {
+                return first;
+            } else if (pages>size) {
+                if (pages<best) {
+                    best=pages;
+                    best_first=first;
                 }
-                first=0;            //Always reset for new search
             }
         }
-        index++;
-    }
-    /* Check for the final block if we can */
-    if (first && (index-first>=size) && (index-first<best)) {
-        return first;
     }
     return best_first;
 }
@@ -1121,6 +1190,7 @@ MemHandle MEM_AllocatePages(Bitu pages,bool sequence) {
     if (sequence) {
         uint32_t index=BestMatch(pages);
         if (!index) return 0;
+        MEM_FreeExtentTake(index,(uint32_t)pages);
         MemHandle * next=&ret;
         while (pages) {
             *next=(MemHandle)index;
@@ -1134,10 +1204,13 @@ MemHandle MEM_AllocatePages(Bitu pages,bool sequence) {
         while (pages) {
             uint32_t index=BestMatch(1);
             if (!index) E_Exit("MEM:corruption during allocate");
-            while (pages && (!memory.mhandles[index])) {
+            uint32_t run=(uint32_t)std::min(pages,(Bitu)mem_free_by_start[index]);
+            MEM_FreeExtentTake(index,run);
+            pages-=run;
+            while (run) {
                 *next=(MemHandle)index;
                 next=&memory.mhandles[index];
-                index++;pages--;
+                index++;run--;
             }
             *next=-1;       //Invalidate it in case we need another match
         }
@@ -1158,6 +1231,7 @@ MemHandle MEM_AllocatePages_A20_friendly(Bitu pages,bool sequence) {
         if (index & 0x100) E_Exit("MEM_AllocatePages_A20_friendly failed to make sure address has bit 20 == 0");
         if ((index+pages-1) & 0x100) E_Exit("MEM_AllocatePages_A20_friendly failed to make sure last page has bit 20 == 0");
 #endif
+        MEM_FreeExtentTake(index,(uint32_t)pages);
         MemHandle * next=&ret;
         while (pages) {
             *next=(MemHandle)index;
@@ -1174,10 +1248,15 @@ MemHandle MEM_AllocatePages_A20_friendly(Bitu pages,bool sequence) {
 #if C_DEBUG
             if (index & 0x100) E_Exit("MEM_AllocatePages_A20_friendly failed to make sure address has bit 20 == 0");
 #endif
-            while (pages && (!memory.mhandles[index])) {
+            auto ext=MEM_FreeExtentAt(index);
+            if (ext == mem_free_by_start.end()) E_Exit("MEM:corruption during allocate");
+            uint32_t run=(uint32_t)std::min(pages,(Bitu)(ext->first+ext->second-index));
+            MEM_FreeExtentTake(index,run);
+            pages-=run;
+            while (run) {
                 *next=(MemHandle)index;
                 next=&memory.mhandles[index];
-                index++;pages--;
+                index++;run--;
             }
             *next=-1;       //Invalidate it in case we need another match
         }
@@ -1195,11 +1274,22 @@ void MEM_ReleasePages(MemHandle handle) {
         return;
     }
 
+    /* hand the chain back in runs of consecutive pages */
+    uint32_t run_start=0,run=0;
     while (handle>0) {
         MemHandle next=memory.mhandles[handle];
+        if (!next) break;   /* already free, not part of an allocation */
         memory.mhandles[handle]=0;
+        if (run && (uint32_t)handle==run_start+run) {
+            run++;
+        } else {
+            if (run) MEM_FreeExtentGive(run_start,run);
+            run_start=(uint32_t)handle;
+            run=1;
+        }
         handle=next;
     }
+    if (run) MEM_FreeExtentGive(run_start,run);
 }
 
 bool MEM_ReAllocatePages(MemHandle & handle,Bitu pages,bool sequence) {
@@ -1223,32 +1313,23 @@ bool MEM_ReAllocatePages(MemHandle & handle,Bitu pages,bool sequence) {
     if (old_pages == pages) return true;
     if (old_pages > pages) {
         /* Decrease size */
-        pages--;index=handle;old_pages--;
+        pages--;index=handle;
         while (pages) {
             index=memory.mhandles[index];
-            pages--;old_pages--;
+            pages--;
         }
         MemHandle next=memory.mhandles[index];
         memory.mhandles[index]=-1;
-        index=next;
-        while (old_pages) {
-            next=memory.mhandles[index];
-            memory.mhandles[index]=0;
-            index=next;
-            old_pages--;
-        }
+        MEM_ReleasePages(next);
         return true;
     } else {
         /* Increase size, check for enough free space */
         Bitu need=pages-old_pages;
         if (sequence) {
-            index=last+1;
-            Bitu free=0;
-            while ((index<(MemHandle)memory.reported_pages) && !memory.mhandles[index]) {
-                index++;free++;
-            }
-            if (free>=need) {
+            auto ext=mem_free_by_start.find((uint32_t)last+1);
+            if (ext!=mem_free_by_start.end() && ext->second>=need) {
                 /* Enough space allocate more pages */
+                MEM_FreeExtentTake((uint32_t)last+1,(uint32_t)need);
                 index=last;
                 while (need) {
                     memory.mhandles[index]=index+1;
@@ -1987,6 +2068,7 @@ void ShutDownRAM(Section * sec) {
 #endif
         }
         MemBase = NULL;
+        mem_anonymous_map = false;
     }
     MemSize = 0;
     ACPI_free();
@@ -2361,8 +2443,14 @@ void Init_RAM() {
 #if C_GAMELINK
         MemBase = GameLink::AllocRAM(memory.pages*4096);
 #elif C_HAVE_MMAP
-        MemBase = (uint8_t*)mmap(NULL,memory.pages*4096u,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,0,0);
+        MemBase = (uint8_t*)mmap(NULL,memory.pages*4096u,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
         if (MemBase == (uint8_t*)MAP_FAILED) E_Exit("Failed to mmap allocate memory");
+        mem_anonymous_map = true;
+# if defined(MADV_MERGEABLE)
+        /* let KSM fold identical pages, across several instances for example */
+        if (section->Get_bool("mergeable memory") && madvise(MemBase,memory.pages*4096u,MADV_MERGEABLE) != 0)
+            LOG_MSG("Unable to mark guest memory mergeable, %s",strerror(errno));
+# endif
 #else // C_GAMELINK
         MemBase = new(std::nothrow) uint8_t[memory.pages*4096];
 #endif // C_GAMELINK
@@ -2374,6 +2462,9 @@ void Init_RAM() {
     if (memory_file_base && memory_file_already_zero) {
         LOG_MSG("Host OS should treat memory map as all zeros, skipping memory clear");
     }
+    else if (mem_anonymous_map) {
+        /* fresh anonymous mapping, already zero. clearing it would commit all of it */
+    }
     else {
         memset((void*)MemBase,0,memory.reported_pages*4096);
     }
@@ -2389,6 +2480,8 @@ void Init_RAM() {
     // sanity check. if this condition is false the loops below will overrun the array!
     assert(memory.reported_pages <= memory.handler_pages);
 
+    mem_release_freed = section->Get_bool("release freed memory");
+
     PageHandler *ram_ptr = (PageHandler*)(&ram_page_handler);
 
     for (i=0;i < memory.reported_pages;i++)
@@ -2445,6 +2538,7 @@ void ShutDownMemHandles(Section * sec) {
         delete [] memory.mhandles;
         memory.mhandles = NULL;
     }
+    MEM_FreeExtentsRebuild();
 }
 
 /* this is called on hardware reset. the BIOS needs the A20 gate ON to boot properly on 386 or higher!
@@ -2584,6 +2678,8 @@ void Init_MemHandles() {
     if (isa_memory_hole_15mb) {
         for (i=0xF00;i<=0xFFF && i < memory.pages;i++) memory.mhandles[i] = 0x7FFFFFFF;
     }
+
+    MEM_FreeExtentsRebuild();
 }
 
 void Init_MemoryAccessArray() {
@@ -2901,6 +2997,7 @@ private:
 				READ_POD_SIZE( &m, sizeof(MemHandle) );
 			}
 		}
+		MEM_FreeExtentsRebuild();
 		READ_POD( &pagehandler_idx, pagehandler_idx );
 
 
@@ -23,6 +23,7 @@
 */
 
 #include <assert.h>
+#include <float.h>
 #include <string.h>
 #include <sys/types.h>
 #define _USE_MATH_DEFINES // needed for M_PI in Visual Studio as documented [https://msdn.microsoft.com/en-us/library/4hwaceh6.aspx]
@@ -61,8 +62,10 @@
 #include "programs.h"
 #include "midi.h"
 
-#define MIXER_SSIZE 4
-#define MIXER_VOLSHIFT 13
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
 
 #ifdef C_SDL2
 SDL_AudioDeviceID SDL2_AudioDevice = 0; /* valid IDs are 2 or higher, 1 for compat, 0 is never a valid ID */
@@ -84,8 +87,15 @@ struct mixedFraction {
     unsigned int        fn,fd;
 };
 
+/* sample format handed to SDL. the mix itself is always float, 16-bit full scale */
+enum MixerOutputFormat {
+    MIXER_OUT_S16=0,
+    MIXER_OUT_S32,          /* 24-bit precision, in a 32-bit container */
+    MIXER_OUT_F32
+};
+
 static struct {
-    int32_t          work[MIXER_BUFSIZE][2];
+    float           work[MIXER_BUFSIZE][2];
     Bitu            work_in,work_out,work_wrap;
     Bitu            pos,done;
     float           mastervol[2];
@@ -102,6 +112,8 @@ static struct {
     bool            prebuffer_wait;
     Bitu            prebuffer_samples;
     bool            mute;
+    MixerOutputFormat output_format;
+    Bitu            output_ssize;   /* bytes per stereo frame in the SDL stream */
 } mixer;
 
 uint32_t Mixer_MIXQ(void) {
@@ -114,6 +126,48 @@ uint32_t Mixer_MIXQ(void) {
 
 uint8_t MixTemp[MIXER_BUFSIZE];
 
+/* dst += src over 'frames' stereo frames, optionally with left/right swapped */
+static inline void MIXER_Accumulate(float *dst,const float *src,Bitu frames,const bool swap) {
+#if defined(__SSE__)
+    while (frames >= 2) {
+        __m128 v = _mm_loadu_ps(src);
+        if (swap) v = _mm_shuffle_ps(v,v,_MM_SHUFFLE(2,3,0,1));
+        _mm_storeu_ps(dst,_mm_add_ps(_mm_loadu_ps(dst),v));
+        dst += 4; src += 4; frames -= 2;
+    }
+#endif
+    while (frames > 0) {
+        if (swap) {
+            dst[0] += src[1];
+            dst[1] += src[0];
+        }
+        else {
+            dst[0] += src[0];
+            dst[1] += src[1];
+        }
+        dst += 2; src += 2; frames--;
+    }
+}
+
+/* dst = clamp(src * vol) over 'frames' stereo frames */
+static inline void MIXER_ScaleClamp(float *dst,const float *src,Bitu frames,const float vol0,const float vol1,const float lo,const float hi) {
+#if defined(__SSE__)
+    const __m128 v = _mm_set_ps(vol1,vol0,vol1,vol0);
+    const __m128 vlo = _mm_set1_ps(lo);
+    const __m128 vhi = _mm_set1_ps(hi);
+    while (frames >= 2) {
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(src),v);
+        _mm_storeu_ps(dst,_mm_min_ps(_mm_max_ps(x,vlo),vhi));
+        dst += 4; src += 4; frames -= 2;
+    }
+#endif
+    while (frames > 0) {
+        dst[0] = clamp(src[0] * vol0,lo,hi);
+        dst[1] = clamp(src[1] * vol1,lo,hi);
+        dst += 2; src += 2; frames--;
+    }
+}
+
 inline void MixerChannel::updateSlew(void) {
     /* "slew" affects the linear interpolation ramp.
      * but, our implementation can only shorten the linear interpolation
@@ -147,9 +201,13 @@ MixerChannel * MIXER_AddChannel(MIXER_Handler handler,Bitu freq,const char * nam
     chan->lowpass_freq = 0;
     chan->lowpass_alpha = 0;
 
+    chan->lowpass_out_alpha = 0;
+
     for (unsigned int i=0;i < LOWPASS_ORDER;i++) {
-        for (unsigned int j=0;j < 2;j++)
+        for (unsigned int j=0;j < 2;j++) {
             chan->lowpass[i][j] = 0;
+            chan->lowpass_out[i][j] = 0;
+        }
     }
 
     chan->lowpass_on_load = false;
@@ -161,6 +219,9 @@ MixerChannel * MIXER_AddChannel(MIXER_Handler handler,Bitu freq,const char * nam
     chan->SetScale(1.0);
     chan->SetVolume(1,1);
     chan->enabled=false;
+    chan->sleeping=false;
+    chan->sleep_start=0;
+    chan->quiet_ms=0;
     chan->last[0] = chan->last[1] = 0;
     chan->delta[0] = chan->delta[1] = 0;
     chan->current[0] = chan->current[1] = 0;
@@ -197,8 +258,8 @@ void MIXER_DelChannel(MixerChannel* delchan) {
 }
 
 void MixerChannel::UpdateVolume(void) {
-    volmul[0]=(Bits)((1 << MIXER_VOLSHIFT)*scale[0]*volmain[0]);
-    volmul[1]=(Bits)((1 << MIXER_VOLSHIFT)*scale[1]*volmain[1]);
+    volmul[0]=scale[0]*volmain[0];
+    volmul[1]=scale[1]*volmain[1];
 }
 
 void MixerChannel::SetVolume(float _left,float _right) {
@@ -229,9 +290,39 @@ static void MIXER_FillUp(void);
 void MixerChannel::Enable(bool _yesno) {
     if (_yesno==enabled) return;
     enabled=_yesno;
+    quiet_ms=0;
     if (!enabled) freq_f=0;
 }
 
+void MixerChannel::Sleep(void) {
+    if (sleeping) return;
+    sleeping=true;
+    sleep_start=(double)PIC_FullIndex();
+    freq_f=0;
+}
+
+double MixerChannel::WakeUp(void) {
+    quiet_ms=0; // a write may have changed what the device is about to render
+    if (!sleeping) return 0;
+    sleeping=false;
+
+    /* the mixer kept advancing rend_n while we slept. pad the gap with silence so that
+     * whatever the device renders next lands at the time of the wakeup, not earlier */
+    if (msbuffer_o < rend_n) {
+        while (msbuffer_o < rend_n) {
+            msbuffer[msbuffer_o][0] = 0;
+            msbuffer[msbuffer_o][1] = 0;
+            msbuffer_o++;
+        }
+        msbuffer_i = rend_n;
+        current[0] = current[1] = 0;
+        last[0] = last[1] = 0;
+    }
+
+    double slept=(double)PIC_FullIndex()-sleep_start;
+    return slept > 0 ? slept : 0;
+}
+
 void MixerChannel::lowpassUpdate() {
     if (lowpass_freq != 0) {
         double timeInterval;
@@ -251,6 +342,7 @@ void MixerChannel::lowpassUpdate() {
         tau = 1.0 / (lowpass_freq * 2 * M_PI);
         talpha = timeInterval / (tau + timeInterval);
         lowpass_alpha = (int32_t)(talpha * 0x10000); // double -> 16.16 fixed point
+        lowpass_out_alpha = (float)talpha;
 
 //      LOG_MSG("Lowpass freq_n=%u freq_d=%u timeInterval=%.12f tau=%.12f alpha=%.6f onload=%u onout=%u",
 //          freq_n,freq_d_orig,timeInterval,tau,talpha,lowpass_on_load,lowpass_on_out);
@@ -276,6 +368,16 @@ inline void MixerChannel::lowpassProc(int32_t ch[2]) {
     }
 }
 
+inline void MixerChannel::lowpassProcOut(float ch[2]) {
+    for (unsigned int i=0;i < lowpass_order;i++) {
+        for (unsigned int c=0;c < 2;c++) {
+            float &st = lowpass_out[i][c];
+            st += (ch[c] - st) * lowpass_out_alpha;
+            ch[c] = st;
+        }
+    }
+}
+
 void MixerChannel::SetLowpassFreq(Bitu _freq,unsigned int order) {
     if (order > LOWPASS_ORDER) order = LOWPASS_ORDER;
     if (_freq == lowpass_freq && lowpass_order == order) return;
@@ -305,11 +407,27 @@ void MixerChannel::SetFreq(Bitu _freq,Bitu _den) {
     lowpassUpdate();
 }
 
-void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, int16_t * data,const char *name);
+void CAPTURE_MultiTrackAddWave(uint32_t freq, uint32_t len, const float * data, const float vol[2], const char *name);
 
 void MixerChannel::EndFrame(Bitu samples) {
+    if (!sleeping) {
+        Bitu chk = msbuffer_o;
+        Bitu i;
+
+        if (chk > samples) chk = samples;
+        for (i=0;i < chk;i++) {
+            if (msbuffer[i][0] != 0 || msbuffer[i][1] != 0)
+                break;
+        }
+
+        if (i < chk || (chk < samples && (current[0] | current[1]) != 0))
+            quiet_ms = 0;
+        else
+            quiet_ms++;
+    }
+
     if (CaptureState & CAPTURE_MULTITRACK_WAVE) {// TODO: should be a separate call!
-        int16_t convert[1024][2];
+        /* hand the samples as-is to the capture ring, the capture writer thread converts them */
         Bitu cnv = msbuffer_o;
         Bitu padding = 0;
 
@@ -318,23 +436,10 @@ void MixerChannel::EndFrame(Bitu samples) {
         else
             padding = samples - cnv;
 
-        if (cnv > 0) {
-            int32_t volscale1 = (int32_t)(mixer.recordvol[0] * (1 << MIXER_VOLSHIFT));
-            int32_t volscale2 = (int32_t)(mixer.recordvol[1] * (1 << MIXER_VOLSHIFT));
-
-            if (cnv > 1024) cnv = 1024;
-            for (Bitu i=0;i<cnv;i++) {
-                convert[i][0]=MIXER_CLIP(((int64_t)msbuffer[i][0] * (int64_t)volscale1) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-                convert[i][1]=MIXER_CLIP(((int64_t)msbuffer[i][1] * (int64_t)volscale2) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-            }
-            CAPTURE_MultiTrackAddWave(mixer.freq,cnv,(int16_t*)convert,name);
-        }
-
-        if (padding > 0) {
-            if (padding > 1024) padding = 1024;
-            memset(&convert[0][0],0,padding*sizeof(int16_t)*2);
-            CAPTURE_MultiTrackAddWave(mixer.freq,padding,(int16_t*)convert,name);
-        }
+        if (cnv > 0)
+            CAPTURE_MultiTrackAddWave(mixer.freq,(uint32_t)cnv,&msbuffer[0][0],mixer.recordvol,name);
+        if (padding > 0)
+            CAPTURE_MultiTrackAddWave(mixer.freq,(uint32_t)padding,NULL,mixer.recordvol,name);
     }
 
     rend_n = rend_d = 0;
@@ -353,32 +458,30 @@ void MixerChannel::EndFrame(Bitu samples) {
 }
 
 void MixerChannel::Mix(Bitu whole,Bitu frac) {
-    unsigned int patience = 2;
     Bitu upto;
 
     if (whole <= rend_n) return;
     assert(whole <= mixer.samples_this_ms.w);
     assert(rend_n < mixer.samples_this_ms.w);
-    int32_t *outptr = &mixer.work[mixer.work_in+rend_n][0];
+    float *outptr = &mixer.work[mixer.work_in+rend_n][0];
 
-    if (!enabled) {
+    if (!enabled || sleeping) {
         rend_n = whole;
         rend_d = frac;
         return;
     }
 
-    // HACK: We iterate twice only because of the Sound Blaster emulation. No other emulation seems to need this.
+    // One call per fill. Handlers are expected to render the whole request, including
+    // the Sound Blaster across DMA block boundaries. Any shortfall is padded below.
     rendering_to_n = whole;
     rendering_to_d = frac;
-    while (msbuffer_o < whole) {
+    if (msbuffer_o < whole) {
         uint64_t todo = (uint64_t)(whole - msbuffer_o) * (uint64_t)freq_n;
         todo += (uint64_t)freq_f;
         todo += (uint64_t)freq_d - (uint64_t)1;
         todo /= (uint64_t)freq_d;
         if (!current_loaded) todo++;
         handler(todo);
-
-        if (--patience == 0) break;
     }
 
     if (msbuffer_o < whole)
@@ -392,27 +495,18 @@ void MixerChannel::Mix(Bitu whole,Bitu frac) {
         Bitu t_msbuffer_i = msbuffer_i;
 
         while (t_rend_n < whole && t_msbuffer_i < upto) {
-            lowpassProc(msbuffer[t_msbuffer_i]);
+            lowpassProcOut(msbuffer[t_msbuffer_i]);
             t_msbuffer_i++;
             t_rend_n++;
         }
     }
 
-    if (mixer.swapstereo) {
-        while (rend_n < whole && msbuffer_i < upto) {
-            *outptr++ += msbuffer[msbuffer_i][1];
-            *outptr++ += msbuffer[msbuffer_i][0];
-            msbuffer_i++;
-            rend_n++;
-        }
-    }
-    else {
-        while (rend_n < whole && msbuffer_i < upto) {
-            *outptr++ += msbuffer[msbuffer_i][0];
-            *outptr++ += msbuffer[msbuffer_i][1];
-            msbuffer_i++;
-            rend_n++;
-        }
+    if (rend_n < whole && msbuffer_i < upto) {
+        Bitu count = whole - rend_n;
+        if (count > (upto - msbuffer_i)) count = upto - msbuffer_i;
+
+        MIXER_Accumulate(outptr,&msbuffer[msbuffer_i][0],count,mixer.swapstereo);
+        msbuffer_i += count;
     }
 
     rend_n = whole;
@@ -508,9 +602,9 @@ inline void MixerChannel::padFillSampleInterpolation(const Bitu upto) {
     if (msbuffer_o < upto) {
         if (freq_f > freq_d) freq_f = freq_d; // this is an abrupt stop, so interpolation must not carry over, to help avoid popping artifacts
 
-        while (msbuffer_o < upto) {
-            msbuffer[msbuffer_o][0] = current[0];
-            msbuffer[msbuffer_o][1] = current[1];
+        while (msbuffer_o < upto) { /* silence, the device had nothing more for us */
+            msbuffer[msbuffer_o][0] = 0;
+            msbuffer[msbuffer_o][1] = 0;
             msbuffer_o++;
         }
     }
@@ -532,9 +626,9 @@ inline bool MixerChannel::runSampleInterpolation(const Bitu upto) {
 
     while (freq_fslew < freq_d) {
         int sample = last[0] + (int)(((int64_t)delta[0] * (int64_t)freq_fslew) / (int64_t)freq_d);
-        msbuffer[msbuffer_o][0] = sample * volmul[0];
+        msbuffer[msbuffer_o][0] = (float)sample * volmul[0];
         sample = last[1] + (int)(((int64_t)delta[1] * (int64_t)freq_fslew) / (int64_t)freq_d);
-        msbuffer[msbuffer_o][1] = sample * volmul[1];
+        msbuffer[msbuffer_o][1] = (float)sample * volmul[1];
 
         freq_f += freq_n;
         freq_fslew += freq_nslew;
@@ -544,9 +638,11 @@ inline bool MixerChannel::runSampleInterpolation(const Bitu upto) {
 
     current[0] = last[0] + delta[0];
     current[1] = last[1] + delta[1];
+    const float cur0 = (float)current[0] * volmul[0];
+    const float cur1 = (float)current[1] * volmul[1];
     while (freq_f < freq_d) {
-        msbuffer[msbuffer_o][0] = current[0] * volmul[0];
-        msbuffer[msbuffer_o][1] = current[1] * volmul[1];
+        msbuffer[msbuffer_o][0] = cur0;
+        msbuffer[msbuffer_o][1] = cur1;
 
         freq_f += freq_n;
         if ((++msbuffer_o) >= upto)
@@ -689,19 +785,19 @@ static void MIXER_MixData(Bitu fracs/*render up to*/) {
     }
 
     if (CaptureState & (CAPTURE_WAVE|CAPTURE_VIDEO)) {
-        int32_t volscale1 = (int32_t)(mixer.recordvol[0] * (1 << MIXER_VOLSHIFT));
-        int32_t volscale2 = (int32_t)(mixer.recordvol[1] * (1 << MIXER_VOLSHIFT));
+        float scaled[1024][2];
         int16_t convert[1024][2];
         Bitu added = whole - prev_rendered;
         if (added>1024) added=1024;
         Bitu readpos = mixer.work_in + prev_rendered;
+        assert((readpos+added) <= MIXER_BUFSIZE);
+        /* unclipped copy for 24-bit/float WAV capture, clipped 16-bit for everything else */
+        MIXER_ScaleClamp(&scaled[0][0],&mixer.work[readpos][0],added,mixer.recordvol[0],mixer.recordvol[1],-FLT_MAX,FLT_MAX);
         for (Bitu i=0;i<added;i++) {
-            convert[i][0]=MIXER_CLIP(((int64_t)mixer.work[readpos][0] * (int64_t)volscale1) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-            convert[i][1]=MIXER_CLIP(((int64_t)mixer.work[readpos][1] * (int64_t)volscale2) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-            readpos++;
+            convert[i][0]=MIXER_CLIP((Bits)scaled[i][0]);
+            convert[i][1]=MIXER_CLIP((Bits)scaled[i][1]);
         }
-        assert(readpos <= MIXER_BUFSIZE);
-        CAPTURE_AddWave( mixer.freq, added, (int16_t*)convert );
+        CAPTURE_AddWave( mixer.freq, added, (int16_t*)convert, &scaled[0][0] );
     }
 
     mixer.samples_rendered_ms.w = whole;
@@ -766,7 +862,7 @@ static void MIXER_Mix(void) {
     }
     assert((mixer.work_in+thr) <= MIXER_BUFSIZE);
     assert((mixer.work_in+mixer.samples_this_ms.w) <= MIXER_BUFSIZE);
-    memset(&mixer.work[mixer.work_in][0],0,sizeof(int32_t)*2*mixer.samples_this_ms.w);
+    memset(&mixer.work[mixer.work_in][0],0,sizeof(float)*2*mixer.samples_this_ms.w);
     mixer.samples_rendered_ms.fn = 0;
     mixer.samples_rendered_ms.w = 0;
 #ifdef C_SDL2
@@ -777,12 +873,46 @@ static void MIXER_Mix(void) {
     MIXER_FillUp();
 }
 
+/* master volume and conversion to the SDL sample format, 'frames' stereo frames */
+static void MIXER_Output(Uint8 *stream,const float *in,Bitu frames) {
+    float tmp[512][2];
+
+    while (frames > 0) {
+        Bitu todo = frames > 512 ? 512 : frames;
+
+        switch (mixer.output_format) {
+            case MIXER_OUT_S32: {
+                int32_t *out = (int32_t*)stream;
+                MIXER_ScaleClamp(&tmp[0][0],in,todo,mixer.mastervol[0]*65536.0f,mixer.mastervol[1]*65536.0f,-2147483648.0f,2147483520.0f);
+                for (Bitu i=0;i < todo;i++) {
+                    *out++ = (int32_t)tmp[i][0];
+                    *out++ = (int32_t)tmp[i][1];
+                }
+                break; }
+            case MIXER_OUT_F32:
+                /* no clipping here, the host (or SDL) deals with anything above full scale */
+                MIXER_ScaleClamp((float*)stream,in,todo,mixer.mastervol[0]/32768.0f,mixer.mastervol[1]/32768.0f,-FLT_MAX,FLT_MAX);
+                break;
+            default: {
+                int16_t *out = (int16_t*)stream;
+                MIXER_ScaleClamp(&tmp[0][0],in,todo,mixer.mastervol[0],mixer.mastervol[1],MIN_AUDIO,MAX_AUDIO);
+                for (Bitu i=0;i < todo;i++) {
+                    *out++ = (int16_t)tmp[i][0];
+                    *out++ = (int16_t)tmp[i][1];
+                }
+                break; }
+        }
+
+        stream += todo * mixer.output_ssize;
+        in += todo * 2;
+        frames -= todo;
+    }
+}
+
 static void SDLCALL MIXER_CallBack(void * userdata, Uint8 *stream, int len) {
     (void)userdata;//UNUSED
-    int32_t volscale1 = (int32_t)(mixer.mastervol[0] * (1 << MIXER_VOLSHIFT));
-    int32_t volscale2 = (int32_t)(mixer.mastervol[1] * (1 << MIXER_VOLSHIFT));
-    Bitu need = (Bitu)len/MIXER_SSIZE;
-    int16_t *output = (int16_t*)stream;
+    Bitu need = (Bitu)len/mixer.output_ssize;
+    Uint8 *output = stream;
     int remains;
 
     if (mixer.mute) {
@@ -802,27 +932,23 @@ static void SDLCALL MIXER_CallBack(void * userdata, Uint8 *stream, int len) {
     }
 
     if (!mixer.prebuffer_wait && !mixer.mute) {
-        int32_t *in = &mixer.work[mixer.work_out][0];
-        while (need > 0) {
-            if (mixer.work_out == mixer.work_in) break;
-            *output++ = MIXER_CLIP((((int64_t)(*in++)) * (int64_t)volscale1) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-            *output++ = MIXER_CLIP((((int64_t)(*in++)) * (int64_t)volscale2) >> (MIXER_VOLSHIFT + MIXER_VOLSHIFT));
-            mixer.work_out++;
-            if (mixer.work_out >= mixer.work_wrap) {
+        while (need > 0 && mixer.work_out != mixer.work_in) {
+            /* contiguous run up to the write position or the wrap point */
+            Bitu span = (mixer.work_in > mixer.work_out ? mixer.work_in : mixer.work_wrap) - mixer.work_out;
+            if (span > need) span = need;
+
+            MIXER_Output(output,&mixer.work[mixer.work_out][0],span);
+            output += span * mixer.output_ssize;
+            mixer.work_out += span;
+            if (mixer.work_out >= mixer.work_wrap)
                 mixer.work_out = 0;
-                in = &mixer.work[mixer.work_out][0];
-            }
-            need--;
+            need -= span;
         }
     }
 
-    if (need > 0)
+    if (need > 0) {
         mixer.prebuffer_wait = true;
-
-    while (need > 0) {
-        *output++ = 0;
-        *output++ = 0;
-        need--;
+        memset(output,0,need * mixer.output_ssize); /* zero bits are silence in all three formats */
     }
 
     remains = (int)mixer.work_in - (int)mixer.work_out;
@@ -944,6 +1070,7 @@ public:
     }
 private:
     void ListMidi(){
+        MIDI_OpenPending();
         if(midi.handler) {
             WriteOut("MIDI handler: %s\n", midi.handler->GetName());
             midi.handler->ListAll(this);
@@ -1072,6 +1199,15 @@ void MIXER_Init() {
     mixer.swapstereo=section->Get_bool("swapstereo");
     mixer.sampleaccurate=section->Get_bool("sample accurate");
     mixer.mute=false;
+    {
+        const std::string fmt = section->Get_string("output format");
+        if (fmt == "24bit") mixer.output_format = MIXER_OUT_S32;
+        else if (fmt == "float") mixer.output_format = MIXER_OUT_F32;
+        else mixer.output_format = MIXER_OUT_S16;
+#if !defined(C_SDL2)
+        mixer.output_format = MIXER_OUT_S16; /* SDL 1.2 only does 16-bit */
+#endif
+    }
     if (control->opt_silent) mixer.nosound = true;
 
     /* Initialize the internal stuff */
@@ -1090,8 +1226,15 @@ void MIXER_Init() {
     SDL_AudioSpec spec;
     SDL_AudioSpec obtained;
 
+    Uint16 want_format = AUDIO_S16SYS;
+#ifdef C_SDL2
+    if (mixer.output_format == MIXER_OUT_S32) want_format = AUDIO_S32SYS;
+    else if (mixer.output_format == MIXER_OUT_F32) want_format = AUDIO_F32SYS;
+#endif
+    mixer.output_ssize = (mixer.output_format == MIXER_OUT_S16 ? 2u : 4u) * 2u;
+
     spec.freq=(int)mixer.freq;
-    spec.format=AUDIO_S16SYS;
+    spec.format=want_format;
     spec.channels=2;
     spec.callback=MIXER_CallBack;
     spec.userdata=NULL;
@@ -1115,7 +1258,7 @@ void MIXER_Init() {
         mixer.nosound = true;
         LOG(LOG_MISC,LOG_DEBUG)("MIXER:Can't open audio: %s , running in nosound mode.",SDL_GetError());
         TIMER_AddTickHandler(MIXER_Mix);
-    } else if (obtained.format != AUDIO_S16SYS) {
+    } else if (obtained.format != want_format) {
         mixer.nosound = true;
         LOG(LOG_MISC,LOG_DEBUG)("MIXER:Failed to get the sample format I wanted.");
         TIMER_AddTickHandler(MIXER_Mix);
@@ -1211,6 +1354,13 @@ void MixerChannel::LoadState( std::istream& stream )
 	//READ_POD( &freq_add, freq_add );
 	READ_POD( &enabled, enabled );
 
+	// volmul is derived, and was fixed point in older save states
+	UpdateVolume();
+
+	// sleep state is not saved, let the device decide again once it runs
+	sleeping = false;
+	quiet_ms = 0;
+
 	//********************************************
 	//********************************************
 	//********************************************
@@ -519,13 +519,8 @@ bx_ne2k_c::asic_read(uint32_t offset, unsigned int io_len)
       BX_NE2K_THIS s.remote_bytes = 0;
 
 	// If all bytes have been written, signal remote-DMA complete
-	if (BX_NE2K_THIS s.remote_bytes == 0) {
-	    BX_NE2K_THIS s.ISR.rdma_done = 1;
-	    if (BX_NE2K_THIS s.IMR.rdma_inte) {
-			PIC_ActivateIRQ((unsigned int)s.base_irq);
-		//DEV_pic_raise_irq(BX_NE2K_THIS s.base_irq);
-		}
-	}
+	if (BX_NE2K_THIS s.remote_bytes == 0)
+	    remote_dma_done();
     break;
 
   case 0xf:  // Reset register
@@ -568,13 +563,8 @@ bx_ne2k_c::asic_write(uint32_t offset, uint32_t value, unsigned io_len)
       BX_NE2K_THIS s.remote_bytes = 0;
 
     // If all bytes have been written, signal remote-DMA complete
-    if (BX_NE2K_THIS s.remote_bytes == 0) {
-      BX_NE2K_THIS s.ISR.rdma_done = 1;
-      if (BX_NE2K_THIS s.IMR.rdma_inte) {
-	  PIC_ActivateIRQ((unsigned int)s.base_irq);
-	  //DEV_pic_raise_irq(BX_NE2K_THIS s.base_irq);
-      }
-    }
+    if (BX_NE2K_THIS s.remote_bytes == 0)
+      remote_dma_done();
     break;
 
   case 0xf:  // Reset register
@@ -587,6 +577,105 @@ bx_ne2k_c::asic_write(uint32_t offset, uint32_t value, unsigned io_len)
   }
 }
 
+void
+bx_ne2k_c::remote_dma_done(void)
+{
+  BX_NE2K_THIS s.ISR.rdma_done = 1;
+  if (BX_NE2K_THIS s.IMR.rdma_inte) {
+    PIC_ActivateIRQ((unsigned int)s.base_irq);
+    //DEV_pic_raise_irq(BX_NE2K_THIS s.base_irq);
+  }
+}
+
+//
+// remote_read_block/remote_write_block - REP INSW/OUTSW on the data
+// port. Moves up to count accesses of io_len bytes in one go, with
+// the same address wrap and byte count rules as asic_read/asic_write,
+// and memcpy for the runs that stay within the packet memory. Only
+// the common case is handled: the access width matching the DCR word
+// size, and no more than the remote byte count. Returns the number of
+// accesses done, the caller does the rest through asic_read/asic_write
+// so the odd cases keep their exact (and logged) behavior.
+//
+unsigned
+bx_ne2k_c::remote_read_block(uint8_t *buf, unsigned count, unsigned io_len)
+{
+  if (io_len != (unsigned)(BX_NE2K_THIS s.DCR.wdsize + 1))
+    return 0;
+
+  unsigned done = 0;
+  while (done < count) {
+    const unsigned addr = BX_NE2K_THIS s.remote_dma;
+    const unsigned stop = (unsigned)BX_NE2K_THIS s.page_stop << 8;
+    if ((addr & (io_len - 1)) || BX_NE2K_THIS s.remote_bytes < io_len)
+      break;
+
+    unsigned bytes = (count - done) * io_len;
+    if (bytes > BX_NE2K_THIS s.remote_bytes) bytes = BX_NE2K_THIS s.remote_bytes & ~(io_len - 1);
+    if (addr < stop && bytes > (stop - addr)) bytes = stop - addr;
+    if (addr >= BX_NE2K_MEMSTART && addr < BX_NE2K_MEMEND) {
+      if (bytes > (unsigned)(BX_NE2K_MEMEND - addr)) bytes = BX_NE2K_MEMEND - addr;
+      memcpy(buf, &BX_NE2K_THIS s.mem[addr - BX_NE2K_MEMSTART], bytes);
+    } else {
+      // MAC address PROM and unmapped space, one access at a time
+      bytes = io_len;
+      const uint32_t v = chipmem_read(addr, io_len);
+      buf[0] = (uint8_t)v;
+      if (io_len == 2) buf[1] = (uint8_t)(v >> 8);
+    }
+
+    buf += bytes;
+    done += bytes / io_len;
+    BX_NE2K_THIS s.remote_dma = (uint16_t)(addr + bytes);
+    if (BX_NE2K_THIS s.remote_dma == stop)
+      BX_NE2K_THIS s.remote_dma = BX_NE2K_THIS s.page_start << 8;
+    BX_NE2K_THIS s.remote_bytes -= bytes;
+  }
+
+  if (done != 0 && BX_NE2K_THIS s.remote_bytes == 0)
+    remote_dma_done();
+
+  return done;
+}
+
+unsigned
+bx_ne2k_c::remote_write_block(const uint8_t *buf, unsigned count, unsigned io_len)
+{
+  if (io_len != (unsigned)(BX_NE2K_THIS s.DCR.wdsize + 1))
+    return 0;
+
+  unsigned done = 0;
+  while (done < count) {
+    const unsigned addr = BX_NE2K_THIS s.remote_dma;
+    const unsigned stop = (unsigned)BX_NE2K_THIS s.page_stop << 8;
+    if ((addr & (io_len - 1)) || BX_NE2K_THIS s.remote_bytes < io_len)
+      break;
+
+    unsigned bytes = (count - done) * io_len;
+    if (bytes > BX_NE2K_THIS s.remote_bytes) bytes = BX_NE2K_THIS s.remote_bytes & ~(io_len - 1);
+    if (addr < stop && bytes > (stop - addr)) bytes = stop - addr;
+    if (addr >= BX_NE2K_MEMSTART && addr < BX_NE2K_MEMEND) {
+      if (bytes > (unsigned)(BX_NE2K_MEMEND - addr)) bytes = BX_NE2K_MEMEND - addr;
+      memcpy(&BX_NE2K_THIS s.mem[addr - BX_NE2K_MEMSTART], buf, bytes);
+    } else {
+      bytes = io_len;
+      BX_DEBUG("out-of-bounds chipmem write, %04X", addr);
+    }
+
+    buf += bytes;
+    done += bytes / io_len;
+    BX_NE2K_THIS s.remote_dma = (uint16_t)(addr + bytes);
+    if (BX_NE2K_THIS s.remote_dma == stop)
+      BX_NE2K_THIS s.remote_dma = BX_NE2K_THIS s.page_start << 8;
+    BX_NE2K_THIS s.remote_bytes -= bytes;
+  }
+
+  if (done != 0 && BX_NE2K_THIS s.remote_bytes == 0)
+    remote_dma_done();
+
+  return done;
+}
+
 //
 // page0_read/page0_write - These routines handle reads/writes to
 // the 'zeroth' page of the DS8390 register file
@@ -1335,8 +1424,8 @@ bx_ne2k_c::rx_handler(void *arg, const void *buf, unsigned len)
  * rx ring has enough room, it is copied into it and
  * the receive process is updated
  */
-void
-bx_ne2k_c::rx_frame(const void *buf, unsigned io_len)
+bool
+bx_ne2k_c::rx_frame(const void *buf, unsigned io_len, bool raise_irq)
 {
   int pages;
   int avail;
@@ -1361,7 +1450,7 @@ bx_ne2k_c::rx_frame(const void *buf, unsigned io_len)
       (BX_NE2K_THIS s.page_start == 0) /*||
       ((BX_NE2K_THIS s.DCR.loop == 0) &&
        (BX_NE2K_THIS s.TCR.loop_cntl != 0))*/) {
-    return;
+    return false;
   }
 
   // Add the pkt header + CRC to the length, and work
@@ -1385,12 +1474,12 @@ bx_ne2k_c::rx_frame(const void *buf, unsigned io_len)
 #endif
       ) {
 	BX_DEBUG("no space");
-    return;
+    return false;
   }
 
   if ((io_len < 40/*60*/) && !BX_NE2K_THIS s.RCR.runts_ok) {
     BX_DEBUG("rejected small packet, length %d", io_len);
-    return;
+    return false;
   }
   // some computers don't care...
   if (io_len < 60) io_len=60;
@@ -1399,24 +1488,24 @@ bx_ne2k_c::rx_frame(const void *buf, unsigned io_len)
   if (! BX_NE2K_THIS s.RCR.promisc) {
     if (!memcmp(buf, bcast_addr, 6)) {
       if (!BX_NE2K_THIS s.RCR.broadcast) {
-	return;
+	return false;
       }
     } else if (pktbuf[0] & 0x01) {
 	if (! BX_NE2K_THIS s.RCR.multicast) {
-	    return;
+	    return false;
 	}
       idx = mcast_index(buf);
       if (!(BX_NE2K_THIS s.mchash[idx >> 3] & (1 << (idx & 0x7)))) {
-	return;
+	return false;
       }
     } else if (0 != memcmp(buf, BX_NE2K_THIS s.physaddr, 6)) {
-      return;
+      return false;
     }
   } else {
       BX_DEBUG(("rx_frame promiscuous receive"));
   }
 
-    BX_INFO("rx_frame %d to %x:%x:%x:%x:%x:%x from %x:%x:%x:%x:%x:%x",
+    BX_DEBUG("rx_frame %d to %x:%x:%x:%x:%x:%x from %x:%x:%x:%x:%x:%x",
   	   io_len,
   	   pktbuf[0], pktbuf[1], pktbuf[2], pktbuf[3], pktbuf[4], pktbuf[5],
   	   pktbuf[6], pktbuf[7], pktbuf[8], pktbuf[9], pktbuf[10], pktbuf[11]);
@@ -1464,12 +1553,13 @@ bx_ne2k_c::rx_frame(const void *buf, unsigned io_len)
 
   BX_NE2K_THIS s.ISR.pkt_rx = 1;
 
-  if (BX_NE2K_THIS s.IMR.rx_inte) {
+  if (raise_irq && BX_NE2K_THIS s.IMR.rx_inte) {
 	//LOG_MSG("packet rx interrupt");
 	  PIC_ActivateIRQ((unsigned int)s.base_irq);
     //DEV_pic_raise_irq(BX_NE2K_THIS s.base_irq);
   } //else LOG_MSG("no packet rx interrupt");
 
+  return true;
 }
 
 //uint8_t macaddr[6] = { 0xAC, 0xDE, 0x48, 0x8E, 0x89, 0x19 };
@@ -1486,6 +1576,15 @@ void dosbox_write(Bitu port, Bitu val, Bitu len) {
 	theNE2kDevice->write((uint32_t)port, (uint32_t)val, (unsigned int)len);
 }
 
+static Bitu dosbox_read_block(Bitu port, uint8_t *buf, Bitu count, Bitu len) {
+	(void)port;//UNUSED
+	return theNE2kDevice->remote_read_block(buf,(unsigned int)count,(unsigned int)len);
+}
+static Bitu dosbox_write_block(Bitu port, const uint8_t *buf, Bitu count, Bitu len) {
+	(void)port;//UNUSED
+	return theNE2kDevice->remote_write_block(buf,(unsigned int)count,(unsigned int)len);
+}
+
 void bx_ne2k_c::init()
 {
   //BX_DEBUG(("Init $Id: ne2k.cc,v 1.56.2.1 2004/02/02 22:37:22 cbothamy Exp $"));
@@ -1544,7 +1643,10 @@ static void NE2000_TX_Event(Bitu val) {
 }
 
 static void NE2000_Poller(void) {
-	ethernet->GetPackets([](const uint8_t* packet, int len) {
+	bool received = false;
+
+	// Take everything the backend has queued up, with a single interrupt for the lot
+	ethernet->GetPackets([&received](const uint8_t* packet, int len) {
 		//LOG_MSG("NE2000: Received %d bytes", header->len);
 
 		// don't receive in loopback modes
@@ -1557,8 +1659,12 @@ static void NE2000_Poller(void) {
 			return;
 #endif
 
-		theNE2kDevice->rx_frame(packet, len);
+		if (theNE2kDevice->rx_frame(packet, len, false))
+			received = true;
 	});
+
+	if (received && theNE2kDevice->s.IMR.rx_inte)
+		PIC_ActivateIRQ((unsigned int)theNE2kDevice->s.base_irq);
 }
 
 #if C_IPX
@@ -1589,6 +1695,7 @@ private:
 	// Data
 	IO_ReadHandleObject ReadHandler8[0x20];
 	IO_WriteHandleObject WriteHandler8[0x20];
+	IO_BlockHandleObject DataBlockHandler;
 	IO_ReadHandleObject ReadHandler16[0x10];
 	IO_WriteHandleObject WriteHandler16[0x10];
 
@@ -1667,6 +1774,8 @@ public:
 			WriteHandler8[i].Install((i+theNE2kDevice->s.base_address),
 				dosbox_write,IO_MB|IO_MW);
 		}
+		// REP INSW/OUTSW on the data port move whole remote DMA runs at once
+		DataBlockHandler.Install(theNE2kDevice->s.base_address+0x10,dosbox_read_block,dosbox_write_block);
 		TIMER_AddTickHandler(NE2000_Poller);
 		addne2k = true;
 	}
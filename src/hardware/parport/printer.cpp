@@ -42,7 +42,7 @@
 #include <output/output_ttf.h>
 
 #if defined(USE_TTF)
-extern unsigned char DOSBoxTTFbi[48868];
+extern const unsigned char DOSBoxTTFbi[48868];
 extern bool printfont;
 extern void resetFontSize();
 extern FT_Face GetTTFFace();
@@ -59,6 +59,7 @@ extern bool showdbcs, dbcs_sbcs, autoboxdraw;
 extern bool halfwidthkana, mouselocked;
 
 static CPrinter* defaultPrinter = NULL;
+static void PRINTER_OutputTick(void);
 
 #define PARAM16(I) (params[I+1]*256+params[I])
 #define PIXX ((Bitu)floor(curX*dpi+0.5))
@@ -78,6 +79,7 @@ static std::string actstd, acterr;
 void UpdateDefaultPrinterFont() {
     if (defaultPrinter!=NULL) {
         defaultPrinter->curFont = NULL;
+        defaultPrinter->flushGlyphCache();
         defaultPrinter->updateFont();
     }
 }
@@ -132,6 +134,45 @@ void CPrinter::getPrinterContext() {
 #endif
 }
 
+SDL_Surface* CPrinter::createPage()
+{
+	SDL_Surface* pg = SDL_CreateRGBSurface(SDL_SWSURFACE, (int)(defaultPageWidth*dpi), (int)(defaultPageHeight*dpi), 8, 0, 0, 0, 0);
+	if (pg == NULL) return NULL;
+
+	// Set a grey palette
+	SDL_Palette* palette = pg->format->palette;
+
+	for (Bitu i = 0; i < 32; i++)
+	{
+		palette->colors[i].r = 255;
+		palette->colors[i].g = 255;
+		palette->colors[i].b = 255;
+	}
+	// 0 = all white needed for logic 000
+	FillPalette(  0,   0,   0, 1, palette);
+	// 1 = magenta* 001
+	FillPalette(  0, 255,   0, 1, palette);
+	// 2 = cyan*    010
+	FillPalette(255,   0,   0, 2, palette);
+	// 3 = "violet" 011
+	FillPalette(255, 255,   0, 3, palette);
+	// 4 = yellow*  100
+	FillPalette(  0,   0, 255, 4, palette);
+	// 5 = red      101
+	FillPalette(  0, 255, 255, 5, palette);
+	// 6 = green    110
+	FillPalette(255,   0, 255, 6, palette);
+	// 7 = black    111
+	FillPalette(255, 255, 255, 7, palette);
+
+	// yyyxxxxx bit pattern: yyy=color xxxxx = intensity: 31=max
+	// Printing colors on top of each other ORs them and gets the
+	// correct resulting color.
+	// i.e. magenta on blank page yyy=001
+	// then yellow on magenta 001 | 100 = 101 = red
+	return pg;
+}
+
 CPrinter::CPrinter(uint16_t dpi, uint16_t width, uint16_t height, char* output, bool multipageOutput) 
 {
 	if (FT_Init_FreeType(&FTlib))
@@ -148,41 +189,8 @@ CPrinter::CPrinter(uint16_t dpi, uint16_t width, uint16_t height, char* output,
 		defaultPageWidth = (double)width / (double)10;
 		defaultPageHeight = (double)height / (double)10;
 
-		// Create page
-		page = SDL_CreateRGBSurface(SDL_SWSURFACE, (int)(defaultPageWidth*dpi), (int)(defaultPageHeight*dpi), 8, 0, 0, 0, 0);
+		page = createPage();
 
-		// Set a grey palette
-		SDL_Palette* palette = page->format->palette;
-		
-		for (Bitu i = 0; i < 32; i++)
-		{
-			palette->colors[i].r = 255;
-			palette->colors[i].g = 255;
-			palette->colors[i].b = 255;
-		}
-		// 0 = all white needed for logic 000
-		FillPalette(  0,   0,   0, 1, palette);
-		// 1 = magenta* 001
-		FillPalette(  0, 255,   0, 1, palette);
-		// 2 = cyan*    010
-		FillPalette(255,   0,   0, 2, palette);
-		// 3 = "violet" 011
-		FillPalette(255, 255,   0, 3, palette);
-		// 4 = yellow*  100
-		FillPalette(  0,   0, 255, 4, palette);
-		// 5 = red      101
-		FillPalette(  0, 255, 255, 5, palette);
-		// 6 = green    110
-		FillPalette(255,   0, 255, 6, palette);
-		// 7 = black    111
-		FillPalette(255, 255, 255, 7, palette);
-
-		// yyyxxxxx bit pattern: yyy=color xxxxx = intensity: 31=max
-		// Printing colors on top of each other ORs them and gets the
-		// correct resulting color.
-		// i.e. magenta on blank page yyy=001
-		// then yellow on magenta 001 | 100 = 101 = red
-		
 		color = COLOR_BLACK;
 		
 		curFont = NULL;
@@ -259,6 +267,20 @@ void CPrinter::resetPrinter()
 CPrinter::~CPrinter(void)
 {
 	finishMultipage();
+	if (outputThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(outputLock);
+			outputStop = true;
+		}
+		outputCond.notify_all();
+		outputThread.join();
+		TIMER_DelTickHandler(PRINTER_OutputTick);
+		checkOutput();
+	}
+	for (SDL_Surface* pg : sparePages)
+		SDL_FreeSurface(pg);
+	sparePages.clear();
 	if (page != NULL)
 	{
 		SDL_FreeSurface(page);
@@ -301,6 +323,8 @@ void CPrinter::selectCodepage(uint16_t cp)
 
 void CPrinter::updateFont()
 {
+	std::string fontKey;
+
 	if (curFont != NULL) {
 		FT_Done_Face(curFont);
 		curFont = NULL;
@@ -308,6 +332,7 @@ void CPrinter::updateFont()
 
 #if defined(USE_TTF)
     if (TTF_using()&&printfont) curFont = GetTTFFace();
+    if (curFont != NULL) fontKey = "<ttf>";
     if (curFont == NULL)
 #endif
     {
@@ -454,6 +479,7 @@ void CPrinter::updateFont()
             curFont = NULL;
         }
 	}
+    fontKey = fontName;
     }
 
 	double horizPoints = 10.5;
@@ -539,7 +565,50 @@ void CPrinter::updateFont()
 		matrix.yx = 0;
 		matrix.yy = 0x10000L;
 		FT_Set_Transform(curFont, &matrix, nullptr);
+		fontKey += "/i";
 	}
+
+	// Glyphs rendered with the same face, size and slant are shared in the glyph cache
+	fontKey += "/" + std::to_string((unsigned int)(uint16_t)horizPoints) + "x" + std::to_string((unsigned int)(uint16_t)vertPoints);
+	std::map<std::string, uint32_t>::iterator it = fontKeys.find(fontKey);
+	if (it == fontKeys.end())
+		it = fontKeys.insert(std::make_pair(fontKey, (uint32_t)fontKeys.size())).first;
+	curFontKey = it->second;
+}
+
+void CPrinter::flushGlyphCache()
+{
+	glyphCache.clear();
+	fontKeys.clear();
+}
+
+const CPrinter::CachedGlyph* CPrinter::getGlyph(FT_UInt index)
+{
+	const uint64_t key = ((uint64_t)curFontKey << 32) | index;
+	std::unordered_map<uint64_t, CachedGlyph>::iterator it = glyphCache.find(key);
+	if (it != glyphCache.end()) return &it->second;
+
+	// Load the glyph 
+	if (FT_Load_Glyph(curFont, index, FT_LOAD_DEFAULT)) return NULL;
+
+	// Render a high-quality bitmap
+	if (FT_Render_Glyph(curFont->glyph, FT_RENDER_MODE_NORMAL)) return NULL;
+
+	// Keep the cache bounded, a document rarely uses more than a few hundred glyphs
+	if (glyphCache.size() >= 4096) glyphCache.clear();
+
+	const FT_GlyphSlot slot = curFont->glyph;
+	CachedGlyph& glyph = glyphCache[key];
+	glyph.buffer.resize((size_t)slot->bitmap.rows * slot->bitmap.width);
+	for (unsigned int y = 0; y < slot->bitmap.rows; y++)
+		memcpy(&glyph.buffer[(size_t)y * slot->bitmap.width], slot->bitmap.buffer + (ptrdiff_t)y * slot->bitmap.pitch, slot->bitmap.width);
+	glyph.bitmap = slot->bitmap;
+	glyph.bitmap.pitch = (int)slot->bitmap.width;
+	glyph.bitmap.buffer = glyph.buffer.empty() ? NULL : &glyph.buffer[0];
+	glyph.left = slot->bitmap_left;
+	glyph.top = slot->bitmap_top;
+	glyph.advance = slot->advance.x;
+	return &glyph;
 }
 
 bool CPrinter::processCommandChar(uint8_t ch)
@@ -1564,38 +1633,37 @@ void CPrinter::printChar(uint8_t ch, int box)
         }
     }
 	FT_UInt index = FT_Get_Char_Index(curFont, printch);
-	
-	// Load the glyph 
-	FT_Load_Glyph(curFont, index, FT_LOAD_DEFAULT);
 
-	// Render a high-quality bitmap
-	FT_Render_Glyph(curFont->glyph, FT_RENDER_MODE_NORMAL);
+	// Rendered bitmaps are cached, FreeType only sees each glyph once per font setup
+	static const CachedGlyph noGlyph = {};
+	const CachedGlyph* glyph = getGlyph(index);
+	if (!glyph) glyph = &noGlyph;
 
-	uint16_t penX = (uint16_t)(PIXX + curFont->glyph->bitmap_left);
-	uint16_t penY = (uint16_t)(PIXY - curFont->glyph->bitmap_top + curFont->size->metrics.ascender / 64);
+	uint16_t penX = (uint16_t)(PIXX + glyph->left);
+	uint16_t penY = (uint16_t)(PIXY - glyph->top + curFont->size->metrics.ascender / 64);
 
-	if (style & STYLE_SUBSCRIPT) penY += curFont->glyph->bitmap.rows / 2;
+	if (style & STYLE_SUBSCRIPT) penY += glyph->bitmap.rows / 2;
 
 	// Copy bitmap into page
 	SDL_LockSurface(page);
 
-	blitGlyph(curFont->glyph->bitmap, penX, penY, false);
-	blitGlyph(curFont->glyph->bitmap, penX+1, penY, true);
+	blitGlyph(glyph->bitmap, penX, penY, false);
+	blitGlyph(glyph->bitmap, penX+1, penY, true);
 
 	// Doublestrike => Print the glyph a second time one pixel below
 	if (style & STYLE_DOUBLESTRIKE)
     {
-		blitGlyph(curFont->glyph->bitmap, penX, penY+1, true);
-		blitGlyph(curFont->glyph->bitmap, penX+1, penY+1, true);
+		blitGlyph(glyph->bitmap, penX, penY+1, true);
+		blitGlyph(glyph->bitmap, penX+1, penY+1, true);
 	}
 
 	// Bold => Print the glyph a second time one pixel to the right
 	// or be a bit more bold...
 	if (style & STYLE_BOLD)
     {
-		blitGlyph(curFont->glyph->bitmap, penX+1, penY, true);
-		blitGlyph(curFont->glyph->bitmap, penX+2, penY, true);
-		blitGlyph(curFont->glyph->bitmap, penX+3, penY, true);
+		blitGlyph(glyph->bitmap, penX+1, penY, true);
+		blitGlyph(glyph->bitmap, penX+2, penY, true);
+		blitGlyph(glyph->bitmap, penX+3, penY, true);
 	}
 	SDL_UnlockSurface(page);
 
@@ -1605,7 +1673,7 @@ void CPrinter::printChar(uint8_t ch, int box)
 	// advance the cursor to the right
 	double x_advance;
 	if ((style & STYLE_PROP) || dbcs)
-		x_advance = (double)((double)(curFont->glyph->advance.x) / (double)(dpi * 64));
+		x_advance = (double)((double)(glyph->advance) / (double)(dpi * 64));
 	else
     {
 		if (hmi < 0)
@@ -1981,11 +2049,99 @@ void CPrinter::doAction(const char *fname) {
             fail=system((action+" "+fname).c_str())!=0;
 #endif
         }
-        if (fail) systemmessagebox("Error", "The requested file handler failed to complete.", "ok","error", 1);
+        // Pages are written on the output thread, the message box is shown by PRINTER_OutputTick
+        if (fail) actionFailed = true;
     }
 }
 
-void CPrinter::outputPage() 
+static void PRINTER_OutputTick(void)
+{
+	if (defaultPrinter) defaultPrinter->checkOutput();
+}
+
+// save state support
+void *PRINTER_OutputTick_PIC_Timer = (void*)((uintptr_t)PRINTER_OutputTick);
+
+void CPrinter::checkOutput()
+{
+	if (actionFailed.exchange(false))
+		systemmessagebox("Error", "The requested file handler failed to complete.", "ok","error", 1);
+}
+
+void CPrinter::outputPage()
+{
+	// Direct printing needs the print dialog and stays on this thread
+	if (strcasecmp(output, "printer") == 0)
+	{
+		writePage(page);
+		return;
+	}
+
+	// Hand the finished page to the output thread and continue on a spare one,
+	// newPage() clears it before anything is printed
+	SDL_Surface* next = NULL;
+	{
+		std::unique_lock<std::mutex> lock(outputLock);
+		outputCond.wait(lock, [this] { return outputQueue.size() < 4; });
+		if (!sparePages.empty())
+		{
+			next = sparePages.back();
+			sparePages.pop_back();
+		}
+	}
+	if (next == NULL) next = createPage();
+	if (next == NULL)
+	{
+		drainOutput();
+		writePage(page);
+		return;
+	}
+
+	if (!outputThread.joinable())
+	{
+		outputThread = std::thread(&CPrinter::outputThreadRun, this);
+		TIMER_AddTickHandler(PRINTER_OutputTick);
+	}
+	{
+		std::lock_guard<std::mutex> lock(outputLock);
+		outputQueue.push_back(page);
+	}
+	outputCond.notify_all();
+	page = next;
+}
+
+void CPrinter::outputThreadRun()
+{
+	std::unique_lock<std::mutex> lock(outputLock);
+	for (;;)
+	{
+		outputCond.wait(lock, [this] { return outputStop || !outputQueue.empty(); });
+		if (outputQueue.empty()) break;
+
+		// The job stays queued while it is written, so drainOutput() waits for it
+		SDL_Surface* pg = outputQueue.front();
+		lock.unlock();
+		if (pg != NULL) writePage(pg);
+		else writeFinish();
+		lock.lock();
+		outputQueue.pop_front();
+
+		if (pg != NULL)
+		{
+			if (sparePages.size() < 2) sparePages.push_back(pg);
+			else SDL_FreeSurface(pg);
+		}
+		outputCond.notify_all();
+	}
+}
+
+void CPrinter::drainOutput()
+{
+	std::unique_lock<std::mutex> lock(outputLock);
+	outputCond.wait(lock, [this] { return outputQueue.empty(); });
+}
+
+void CPrinter::writePage(SDL_Surface* pg)
 {
 	char fname[512];
 
@@ -2002,15 +2158,15 @@ void CPrinter::outputPage()
 
 		double scaleW, scaleH;
 
-		if (page->w > physW) 
-	        scaleW = (double)page->w / (double)physW;
+		if (pg->w > physW) 
+	        scaleW = (double)pg->w / (double)physW;
 	    else 
-			scaleW = (double)physW / (double)page->w; 
+			scaleW = (double)physW / (double)pg->w; 
  
-		if (page->h > physH) 
-	        scaleH = (double)page->h / (double)physH;
+		if (pg->h > physH) 
+	        scaleH = (double)pg->h / (double)physH;
 	    else 
-			scaleH = (double)physH / (double)page->h; 
+			scaleH = (double)physH / (double)pg->h; 
 
 		// Start new printer job?
 		if (outputHandle == NULL)
@@ -2043,15 +2199,15 @@ void CPrinter::outputPage()
         BITMAPINFO bmi;
         ZeroMemory(&bmi, sizeof(bmi));
         bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-        bmi.bmiHeader.biWidth = page->w;
-        bmi.bmiHeader.biHeight = -((LONG)page->h); // top-down bitmap
+        bmi.bmiHeader.biWidth = pg->w;
+        bmi.bmiHeader.biHeight = -((LONG)pg->h); // top-down bitmap
         bmi.bmiHeader.biPlanes = 1;
         bmi.bmiHeader.biBitCount = 8;
         bmi.bmiHeader.biCompression = BI_RGB;
 
         // Fill the color table with the SDL palette (256 colors)
-        SDL_LockSurface(page);
-        SDL_Palette* sdlpal = page->format->palette;
+        SDL_LockSurface(pg);
+        SDL_Palette* sdlpal = pg->format->palette;
         for(int i = 0; i < 256; i++) {
             bmi.bmiColors[i].rgbRed = sdlpal->colors[i].r;
             bmi.bmiColors[i].rgbGreen = sdlpal->colors[i].g;
@@ -2065,15 +2221,15 @@ void CPrinter::outputPage()
         HBITMAP hOldBitmap = (HBITMAP)SelectObject(memHDC, hBitmap);
 
         // Copy the entire 8-bit pixel data from the SDL surface to the DIBSection
-        for(int y = 0; y < page->h; y++) {
-            memcpy((uint8_t*)pBits + y * page->w,
-                (uint8_t*)page->pixels + y * page->pitch,
-                page->w);
+        for(int y = 0; y < pg->h; y++) {
+            memcpy((uint8_t*)pBits + y * pg->w,
+                (uint8_t*)pg->pixels + y * pg->pitch,
+                pg->w);
         }
-        SDL_UnlockSurface(page);  
+        SDL_UnlockSurface(pg);  
 
         // Stretch and copy the bitmap from the memory DC to the printer DC, scaling it to the printer's physical dimensions
-		StretchBlt(printerDC, 0, 0, physW, physH, memHDC, 0, 0, page->w, page->h, SRCCOPY);
+		StretchBlt(printerDC, 0, 0, physW, physH, memHDC, 0, 0, pg->w, pg->h, SRCCOPY);
 
 		EndPage(printerDC);
 
@@ -2135,23 +2291,23 @@ void CPrinter::outputPage()
 		png_set_compression_method(png_ptr, 8);
 		png_set_compression_buffer_size(png_ptr, 8192);
 		
-		png_set_IHDR(png_ptr, info_ptr, page->w, page->h,
+		png_set_IHDR(png_ptr, info_ptr, pg->w, pg->h,
 			8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
 			PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 		for (i = 0; i < 256; i++) 
 		{
-			palette[i].red = page->format->palette->colors[i].r;
-			palette[i].green = page->format->palette->colors[i].g;
-			palette[i].blue = page->format->palette->colors[i].b;
+			palette[i].red = pg->format->palette->colors[i].r;
+			palette[i].green = pg->format->palette->colors[i].g;
+			palette[i].blue = pg->format->palette->colors[i].b;
 		}
 		png_set_PLTE(png_ptr, info_ptr, palette,256);
 		
-		SDL_LockSurface(page);
+		SDL_LockSurface(pg);
 
 		// Allocate an array of scanline pointers
-		row_pointers = (png_bytep*)malloc(page->h * sizeof(png_bytep));
-		for (i = 0; i < (Bitu)page->h; i++) 
-			row_pointers[i] = ((uint8_t*)page->pixels + (i * page->pitch));
+		row_pointers = (png_bytep*)malloc(pg->h * sizeof(png_bytep));
+		for (i = 0; i < (Bitu)pg->h; i++) 
+			row_pointers[i] = ((uint8_t*)pg->pixels + (i * pg->pitch));
 
 		// tell the png library what to encode.
 		png_set_rows(png_ptr, info_ptr, row_pointers);
@@ -2159,7 +2315,7 @@ void CPrinter::outputPage()
 		// Write image to file
 		png_write_png(png_ptr, info_ptr, 0, NULL);
 
-		SDL_UnlockSurface(page);
+		SDL_UnlockSurface(pg);
 		
 		/*close file*/
 		fclose(fp);
@@ -2208,27 +2364,27 @@ void CPrinter::outputPage()
 
 		fprintf(psfile, "%%%%Page: %i %i\n", multiPageCounter, multiPageCounter);
 		fprintf(psfile, "%i %i scale\n", (uint16_t)(defaultPageWidth * 72), (uint16_t)(defaultPageHeight * 72));
-		fprintf(psfile, "%i %i 8 [%i 0 0 -%i 0 %i]\n", page->w, page->h, page->w, page->h, page->h);
+		fprintf(psfile, "%i %i 8 [%i 0 0 -%i 0 %i]\n", pg->w, pg->h, pg->w, pg->h, pg->h);
 		fprintf(psfile, "currentfile\n");
 		fprintf(psfile, "/ASCII85Decode filter\n");
 		fprintf(psfile, "/RunLengthDecode filter\n");
 		fprintf(psfile, "image\n");
 
-		SDL_LockSurface(page);
+		SDL_LockSurface(pg);
 
 		uint32_t pix = 0;
-		uint32_t numpix = page->h * page->w;
+		uint32_t numpix = pg->h * pg->w;
 		ASCII85BufferPos = ASCII85CurCol = 0;
 
 		while (pix < numpix)
 		{
 			// Compress data using RLE
-			if ((pix < numpix - 2) && (getPixel(pix) == getPixel(pix + 1)) && (getPixel(pix) == getPixel(pix + 2)))
+			if ((pix < numpix - 2) && (getPixel(pg, pix) == getPixel(pg, pix + 1)) && (getPixel(pg, pix) == getPixel(pg, pix + 2)))
 			{
 				// Found three or more pixels with the same color
 				uint8_t sameCount = 3;
-				uint8_t col = getPixel(pix);
-				while (sameCount < 128 && sameCount + pix < numpix && col == getPixel(pix + sameCount))
+				uint8_t col = getPixel(pg, pix);
+				while (sameCount < 128 && sameCount + pix < numpix && col == getPixel(pg, pix + sameCount))
 					sameCount++;
 
 				fprintASCII85(psfile, 257 - sameCount);
@@ -2244,13 +2400,13 @@ void CPrinter::outputPage()
 				while (
                     diffCount < 128 && diffCount + pix < numpix && 
 					(
-				        (diffCount + pix < numpix - 2) || (getPixel(pix + diffCount) != getPixel(pix + diffCount+1)) || (getPixel(pix + diffCount) != getPixel(pix + diffCount+2))
+				        (diffCount + pix < numpix - 2) || (getPixel(pg, pix + diffCount) != getPixel(pg, pix + diffCount+1)) || (getPixel(pg, pix + diffCount) != getPixel(pg, pix + diffCount+2))
 					)
                 ) diffCount++;
 
 				fprintASCII85(psfile, diffCount-1);
 				for (uint8_t i = 0; i < diffCount; i++)
-					fprintASCII85(psfile, 255 - getPixel(pix++));
+					fprintASCII85(psfile, 255 - getPixel(pg, pix++));
 			}
 		}
 
@@ -2258,7 +2414,7 @@ void CPrinter::outputPage()
 		fprintASCII85(psfile, 128);
 		fprintASCII85(psfile, 256);
 
-		SDL_UnlockSurface(page);
+		SDL_UnlockSurface(pg);
 
 		fprintf(psfile, "showpage\n");
 
@@ -2280,7 +2436,7 @@ void CPrinter::outputPage()
 	{	
 		// Find a page that does not exists
 		findNextName("page", ".bmp", &fname[0]);
-		SDL_SaveBMP(page, fname);
+		SDL_SaveBMP(pg, fname);
 		doAction(fname);
 	}
 }
@@ -2352,6 +2508,21 @@ void CPrinter::fprintASCII85(FILE* f, uint16_t b)
 }
 
 void CPrinter::finishMultipage()
+{
+	// Closing the document has to wait for the pages queued before it
+	if (outputThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(outputLock);
+			outputQueue.push_back(NULL);
+		}
+		outputCond.notify_all();
+	}
+	else
+		writeFinish();
+}
+
+void CPrinter::writeFinish()
 {
 	if (outputHandle != NULL)
 	{
@@ -2378,19 +2549,25 @@ bool CPrinter::isBlank()
 
 	SDL_LockSurface(page);
 
-	for (uint16_t y = 0; y < page->h; y++)
+	for (uint16_t y = 0; y < page->h && blank; y++)
+	{
+		const uint8_t* row = (uint8_t*)page->pixels + (y * page->pitch);
 		for (uint16_t x = 0; x < page->w; x++)
-			if (*((uint8_t*)page->pixels + x + (y * page->pitch)) != 0)
+			if (row[x] != 0)
+			{
 				blank = false;
+				break;
+			}
+	}
 
 	SDL_UnlockSurface(page);
 	return blank;
 }
 
-uint8_t CPrinter::getPixel(uint32_t num)
+uint8_t CPrinter::getPixel(SDL_Surface* pg, uint32_t num)
 {
 	// Respect the pitch
-	return *((uint8_t*)page->pixels + (num % page->w) + ((num / page->w) * page->pitch));
+	return *((uint8_t*)pg->pixels + (num % pg->w) + ((num / pg->w) * pg->pitch));
 }
 
 static uint8_t dataregister; // contents of the parallel port data register
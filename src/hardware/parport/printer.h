@@ -30,6 +30,16 @@
 
 #include "SDL.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
@@ -120,6 +130,12 @@ public:
 	// Returns true if the current page is blank
 	bool isBlank();
 
+	// Drops all cached glyph bitmaps, needed when the TTF face changes
+	void flushGlyphCache();
+
+	// Reports a failed file handler, called on the emulation thread
+	void checkOutput();
+
 private:
 
 	// used to fill the color "sub-palettes"
@@ -136,6 +152,17 @@ private:
 	// Clears page. If save is true, saves the current page to a bitmap
 	void newPage(bool save, bool resetx);
 
+	struct CachedGlyph					// A rendered glyph bitmap and its metrics
+	{
+		std::vector<uint8_t> buffer;	// Copy of the FreeType bitmap
+		FT_Bitmap bitmap;				// Points into buffer
+		FT_Int left, top;				// Bitmap offset from the pen position
+		FT_Pos advance;					// Horizontal advance (26.6 fixed point)
+	};
+
+	// Returns the glyph with the given index in the current font, rendering it on a cache miss
+	const CachedGlyph* getGlyph(FT_UInt index);
+
 	// Blits the given glyph on the page surface. If add is true, the values of bitmap are
 	// added to the values of the pixels in the page
 	void blitGlyph(FT_Bitmap bitmap, uint16_t destx, uint16_t desty, bool add);
@@ -158,18 +185,43 @@ private:
 	// Output current page 
 	void outputPage();
 
+	// Creates a page surface with the printer palette
+	SDL_Surface* createPage();
+
+	// Writes the given page to the selected output. Runs on the output thread unless printing directly
+	void writePage(SDL_Surface* pg);
+
+	// Output thread: writes queued pages in order and recycles their surfaces
+	void outputThreadRun();
+
+	// Waits until the output thread has written all queued pages
+	void drainOutput();
+
 	// Prints out a byte using ASCII85 encoding (only outputs something every four bytes). When b>255, closes the ASCII85 string
 	void fprintASCII85(FILE* f, uint16_t b);
 
 	// Closes a multipage document
 	void finishMultipage();
+	void writeFinish();
 
 	// Returns value of the num-th pixel (counting left-right, top-down) in a safe way
-	uint8_t getPixel(uint32_t num);
+	uint8_t getPixel(SDL_Surface* pg, uint32_t num);
 
 	FT_Library FTlib;					// FreeType2 library used to render the characters
 
 	SDL_Surface* page;					// Surface representing the current page
+
+	std::thread outputThread;					// Encodes finished pages off the emulation thread
+	std::mutex outputLock;						// Guards outputQueue, sparePages and outputStop
+	std::condition_variable outputCond;			// Signalled when a page is queued or written
+	std::deque<SDL_Surface*> outputQueue;		// Pages owned by the output thread, NULL closes a multipage document
+	std::vector<SDL_Surface*> sparePages;		// Written pages kept for reuse
+	bool outputStop = false;					// Output thread exits once the queue is empty
+	std::atomic<bool> actionFailed = {false};	// A file handler failed on the output thread
+
+	std::unordered_map<uint64_t, CachedGlyph> glyphCache;	// Rendered glyphs by font key and glyph index
+	std::map<std::string, uint32_t> fontKeys;	// Face, size and slant => font key
+	uint32_t curFontKey = 0;					// Font key of curFont
 	uint8_t color = 0;
 
 	double curX = 0, curY = 0;					// Position of the print head (in inch)
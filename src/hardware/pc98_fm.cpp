@@ -53,7 +53,11 @@ extern "C" unsigned char *CGetMemBase() {
 }
 
 extern "C" void sound_sync(void) {
-    if (pc98_mixer) pc98_mixer->FillUp();
+    // every register write on the board goes through here first
+    if (pc98_mixer) {
+        pc98_mixer->WakeUp();
+        pc98_mixer->FillUp();
+    }
 }
 
 extern "C" void _TRACEOUT(const char *fmt,...) {
@@ -196,6 +200,25 @@ extern "C" void pc98_fm_dosbox_fmtimer_clearevent(unsigned int n) {
     PIC_RemoveEvents(n ? fmport_b_pic_event : fmport_a_pic_event);
 }
 
+// true if no generator can start sounding or raise an IRQ again without a write from the guest
+static bool pc98_fm_idle(void) {
+    if (opngen.playing || rhythm.hdr.playing || adpcm.play) return false;
+#if defined(SUPPORT_PX)
+    if (rhythm2.hdr.playing || rhythm3.hdr.playing || adpcm2.play || adpcm3.play) return false;
+#endif	// defined(SUPPORT_PX)
+    if ((pcm86.fifo & 0x80) || pcm86.reqirq) return false;
+
+    // a repeating PSG envelope keeps changing the volume on its own
+    for (unsigned int i=0;i < 3;i++) {
+        for (unsigned int ch=0;ch < 3;ch++) {
+            if ((__psg[i].reg.vol[ch] & 0x10) && !(__psg[i].envmode & PSGENV_ONESHOT))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 // mixer callback
 
 static void pc98_mix_CallBack(Bitu len) {
@@ -230,6 +253,9 @@ static void pc98_mix_CallBack(Bitu len) {
 	avsdrv_check_size(start - pcm86.realbuf);
 
     pc98_mixer->AddSamples_s32(s, (int32_t*)MixTemp);
+
+    if (pc98_mixer->IsQuiet(100) && pc98_fm_idle())
+        pc98_mixer->Sleep();
 }
 
 static bool pc98fm_init = false;
@@ -1141,6 +1141,13 @@ extern void *KEYBOARD_TickHandler_PIC_Timer;			// Keyboard.cpp
 extern void *KEYBOARD_TickHandler_PIC_Timer;			// Keyboard.cpp
 //extern void *MIXER_Mix_NoSound_PIC_Timer;					// Mixer.cpp
 extern void *MIXER_Mix_PIC_Timer;
+extern void *VHD_FlushTick_PIC_Timer;						// Bios_vhd.cpp
+#if C_MODEM
+extern void *NetReactor_Tick_PIC_Timer;						// Misc_util.cpp
+#endif
+#if C_PRINTER
+extern void *PRINTER_OutputTick_PIC_Timer;					// Printer.cpp
+#endif
 
 //extern void *NE2000_Poller_PIC_Event;							// Ne2000.cpp
 
@@ -1193,6 +1200,13 @@ const void *pic_state_timer_table[] = {
 	KEYBOARD_TickHandler_PIC_Timer,
 	//MIXER_Mix_NoSound_PIC_Timer,
 	MIXER_Mix_PIC_Timer,
+	VHD_FlushTick_PIC_Timer,
+#if C_MODEM
+	NetReactor_Tick_PIC_Timer,
+#endif
+#if C_PRINTER
+	PRINTER_OutputTick_PIC_Timer,
+#endif
 
 	//NE2000_Poller_PIC_Event,
 };
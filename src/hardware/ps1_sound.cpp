@@ -134,10 +134,18 @@ static void PS1DAC_Reset(bool bTotal)
 }
 
 
+static void PS1DAC_WakeUp(void)
+{
+	ps1.chanDAC->WakeUp();
+	// Catch up on the idle reset PS1SOUNDUpdate would have done had it kept running
+	if ((ps1.last_writeDAC+5000)<PIC_Ticks) PS1DAC_Reset(false);
+}
+
 #include "regs.h"
 static void PS1SOUNDWrite(Bitu port,Bitu data,Bitu iolen) {
     (void)iolen;//UNUSED
 	if( port != 0x0205 ) {
+		if (ps1.chanDAC->sleeping) PS1DAC_WakeUp();
 		ps1.last_writeDAC=PIC_Ticks;
 		if (!ps1.enabledDAC) {
 			ps1.chanDAC->Enable(true);
@@ -227,6 +235,7 @@ static void PS1SOUNDWrite(Bitu port,Bitu data,Bitu iolen) {
 
 static Bitu PS1SOUNDRead(Bitu port,Bitu iolen) {
     (void)iolen;//UNUSED
+	if (ps1.chanDAC->sleeping) PS1DAC_WakeUp();
 	ps1.last_writeDAC=PIC_Ticks;
 	if (!ps1.enabledDAC) {
 		ps1.chanDAC->Enable(true);
@@ -323,6 +332,10 @@ static void PS1SOUNDUpdate(Bitu length)
 	ps1.Pending = (Bitu)pending;
 
 	ps1.chanDAC->AddSamples_m8(length,MixTemp);
+
+	// FIFO drained and the IRQ for it already delivered: only the guest can restart playback
+	if (ps1.Pending == 0 && !ps1.CanTriggerIRQ && ps1.chanDAC->IsQuiet(100))
+		ps1.chanDAC->Sleep();
 }
 
 static void PS1SN76496Update(Bitu length)
@@ -410,6 +410,8 @@ struct SB_INFO {
 		DMA_MODES mode;
 		Bitu rate,mul;
 		Bitu total,left,min;
+		Bitu blocks;		/* number of blocks completed, to tell a block end apart from the next one */
+		bool end_pending;	/* END_DMA_Event is scheduled for the end of the current block */
 		uint64_t start;
 		union {
 			uint8_t  b8[DMA_BUFSIZE];
@@ -587,6 +589,8 @@ struct SB_INFO {
 	void DSP_FlushData(void);
 	std::string GetSBtype();
 	void CheckDMAEnd(void);
+	void ScheduleDMABlockEnd(void);
+	void CancelDMABlockEnd(void);
 	bool DSP_busy_cycle();
 	void DSP_Reset(void);
 	void ESS_StartDMA();
@@ -740,7 +744,7 @@ void SB_INFO::DSP_SetSpeaker(bool how) {
 		PIC_RemoveEvents(DMA_Silent_Event);
 		CheckDMAEnd();
 	} else {
-		;
+		CancelDMABlockEnd();
 	}
 }
 
@@ -812,7 +816,8 @@ void SB_INFO::sb_update_recording_source_settings() {
 void SB_INFO::SB_OnEndOfDMA(void) {
 	bool was_irq=false;
 
-	PIC_RemoveEvents(END_DMA_Event);
+	CancelDMABlockEnd();
+	dma.blocks++;
 	if (ess_type == ESS_NONE && reveal_sc_type == RSC_NONE && dma.mode >= DSP_DMA_16) {
 		was_irq = irq.pending_16bit;
 		SB_RaiseIRQ(SB_IRQ_16);
@@ -1054,7 +1059,10 @@ void SB_INFO::GenerateDMASound(Bitu size) {
 		}
 	}
 	dma.left-=read;
-	if (!dma.left) SB_OnEndOfDMA();
+	if (!dma.left) {
+		SB_OnEndOfDMA();
+		ScheduleDMABlockEnd();
+	}
 }
 
 void SB_INFO::CheckDMAEnd(void) {
@@ -1064,10 +1072,29 @@ void SB_INFO::CheckDMAEnd(void) {
 		float delay=(bigger*1000.0f)/dma.rate;
 		PIC_AddEvent(DMA_Silent_Event,delay,bigger | (card_index << CARD_INDEX_BIT));
 		LOG(LOG_SB,LOG_NORMAL)("Silent DMA Transfer scheduling IRQ in %.3f milliseconds",delay);
-	} else if (dma.left<dma.min) {
-		float delay=(dma.left*1000.0f)/dma.rate;
-		LOG(LOG_SB,LOG_NORMAL)("Short transfer scheduling IRQ in %.3f milliseconds",delay);
-		PIC_AddEvent(END_DMA_Event,delay,dma.left | (card_index << CARD_INDEX_BIT));
+	} else {
+		ScheduleDMABlockEnd();
+	}
+}
+
+/* The mixer pulls DMA data once per tick, which on its own would put the block end
+ * (and the IRQ) anywhere up to a tick late. Instead the end of every block is known
+ * in advance from the transfer rate, so schedule an event at exactly that time which
+ * renders up to it and completes the block. */
+void SB_INFO::ScheduleDMABlockEnd(void) {
+	CancelDMABlockEnd();
+	if (mode != MODE_DMA || !dma.left || dma.rate == 0 || dma.chan == NULL || dma_dac_mode) return;
+	if (!speaker && type!=SBT_16 && ess_type==ESS_NONE) return; /* DMA_Silent_Event handles it */
+
+	const double delay=(dma.left*1000.0)/dma.rate;
+	PIC_AddEvent(END_DMA_Event,delay,card_index << CARD_INDEX_BIT);
+	dma.end_pending = true;
+}
+
+void SB_INFO::CancelDMABlockEnd(void) {
+	if (dma.end_pending) {
+		PIC_RemoveSpecificEvents(END_DMA_Event,card_index << CARD_INDEX_BIT);
+		dma.end_pending = false;
 	}
 }
 
@@ -1075,6 +1102,7 @@ void SB_INFO::DSP_ChangeMode(DSP_MODES new_mode) {
 	if (mode == new_mode) return;
 	else chan->FillUp();
 	mode=new_mode;
+	if (mode != MODE_DMA) CancelDMABlockEnd();
 }
 
 void SB_INFO::DSP_DoDMATransfer(DMA_MODES new_mode,Bitu freq,bool stereo,bool dontInitLeft) {
@@ -1193,7 +1221,7 @@ void SB_INFO::DSP_DoDMATransfer(DMA_MODES new_mode,Bitu freq,bool stereo,bool do
 	}
 	dma.mode=dma.mode_assigned=new_mode;
 	PIC_RemoveEvents(DMA_DAC_Event);
-	PIC_RemoveEvents(END_DMA_Event);
+	CancelDMABlockEnd();
 
 	if (dma_dac_mode)
 		PIC_AddEvent(DMA_DAC_Event,1000.0 / dma_dac_srcrate,(card_index << CARD_INDEX_BIT));
@@ -1348,6 +1376,7 @@ void SB_INFO::DSP_PrepareDMA_New(DMA_MODES new_mode,Bitu length,bool autoinit,bo
 		if (!autoinit) dma.total=length;
 		dma.left=dma.total;
 		dma.autoinit=autoinit;
+		ScheduleDMABlockEnd();
 		return;
 	}
 
@@ -1450,7 +1479,7 @@ void SB_INFO::DSP_Reset(void) {
 	chan->SetFreq(22050);
 	updateSoundBlasterFilter(22050);
 	//  DSP_SetSpeaker(false);
-	PIC_RemoveEvents(END_DMA_Event);
+	CancelDMABlockEnd();
 	PIC_RemoveEvents(DMA_DAC_Event);
 }
 
@@ -1513,7 +1542,7 @@ void SB_INFO::ESS_StopDMA() {
 	// DMA stop
 	DSP_ChangeMode(MODE_NONE);
 	if (dma.chan) dma.chan->Clear_Request();
-	PIC_RemoveEvents(END_DMA_Event);
+	CancelDMABlockEnd();
 	PIC_RemoveEvents(DMA_DAC_Event);
 }
 
@@ -2263,7 +2292,7 @@ is responsible for some failures such as [https://github.com/joncampbell123/dosb
 				// possibly different code here that does not switch to MODE_DMA_PAUSE
 			}
 			mode=MODE_DMA_PAUSE;
-			PIC_RemoveEvents(END_DMA_Event);
+			CancelDMABlockEnd();
 			PIC_RemoveEvents(DMA_DAC_Event);
 			break;
 		case 0xd1:  /* Enable Speaker */
@@ -3179,6 +3208,8 @@ Bitu SB_INFO::read_sb(Bitu port,Bitu /*iolen*/) {
 }
 
 void SB_INFO::write_sb(Bitu port,Bitu val,Bitu /*iolen*/) {
+	chan->WakeUp();
+
 	/* All Creative hardware prior to Sound Blaster 16 appear to alias most of the I/O ports.
 	 * This has been confirmed on a Sound Blaster 2.0 and a Sound Blaster Pro (v3.1).
 	 * DSP aliasing is also faithfully emulated by the ESS AudioDrive. */
@@ -3249,6 +3280,9 @@ static void SBLASTER_CallBack(const size_t ci,Bitu len) {
 
 	switch (sb[ci].mode) {
 		case MODE_NONE:
+			/* No DMA, no direct DAC: nothing happens until the next DSP write */
+			if (sb[ci].chan->IsQuiet(100)) sb[ci].chan->Sleep();
+			/* fall through */
 		case MODE_DMA_PAUSE:
 		case MODE_DMA_MASKED:
 		case MODE_DMA_REQUIRE_IRQ_ACK:
@@ -3261,8 +3295,29 @@ static void SBLASTER_CallBack(const size_t ci,Bitu len) {
 			len*=sb[ci].dma.mul;
 			if (len&SB_SH_MASK) len+=1 << SB_SH;
 			len>>=SB_SH;
-			if (len>sb[ci].dma.left) len=sb[ci].dma.left;
-			sb[ci].GenerateDMASound(len);
+
+			/* Fill the whole request in one call. If an auto-init block ends inside it
+			 * (the block end event normally gets there first, so this is rounding only)
+			 * carry straight on into the next block. */
+			while (len > 0 && sb[ci].mode == MODE_DMA && sb[ci].dma.left > 0) {
+				const Bitu blocks = sb[ci].dma.blocks;
+				const Bitu left = sb[ci].dma.left;
+				Bitu todo = len;
+				Bitu used;
+
+				if (todo > left) todo = left;
+				sb[ci].GenerateDMASound(todo);
+
+				if (blocks != sb[ci].dma.blocks) used = left;
+				else used = left - sb[ci].dma.left;
+
+				if (used == 0) break;
+				len -= (used < len) ? used : len;
+			}
+
+			/* DMA started (or resumed) by a path that did not schedule the block end */
+			if (sb[ci].mode == MODE_DMA && !sb[ci].dma.end_pending)
+				sb[ci].ScheduleDMABlockEnd();
 			break;
 	}
 }
@@ -3580,7 +3635,8 @@ static void DSP_DMA_CallBack(DmaChannel * chan, DMAEvent event) {
 	const size_t ci = chan->userData;
 	assert(ci < MAX_CARDS);
 	if (chan!=sb[ci].dma.chan || event==DMA_REACHED_TC) return;
-	else if (event==DMA_READ_COUNTER) {
+	sb[ci].chan->WakeUp();
+	if (event==DMA_READ_COUNTER) {
 		sb[ci].chan->FillUp();
 	}
 	else if (event==DMA_MASKED) {
@@ -3754,9 +3810,25 @@ static void DMA_DAC_Event(Bitu val) {
 }
 
 static void END_DMA_Event(Bitu val) {
-	const size_t ci = (size_t)(val >> (Bitu)CARD_INDEX_BIT); val &= (1u << CARD_INDEX_BIT) - 1u;
+	const size_t ci = (size_t)(val >> (Bitu)CARD_INDEX_BIT);
 	assert(ci < MAX_CARDS);
-	sb[ci].GenerateDMASound(val);
+
+	sb[ci].dma.end_pending = false;
+	if (sb[ci].mode != MODE_DMA || sb[ci].dma.chan == NULL || sb[ci].dma.chan->masked) return;
+
+	/* Render everything up to now, which may itself complete the block */
+	const Bitu blocks = sb[ci].dma.blocks;
+	sb[ci].chan->FillUp();
+
+	/* Then take whatever is left of the block, raising the IRQ right now */
+	while (sb[ci].mode == MODE_DMA && blocks == sb[ci].dma.blocks && sb[ci].dma.left > 0) {
+		const Bitu left = sb[ci].dma.left;
+		sb[ci].GenerateDMASound(left > (DMA_BUFSIZE/2) ? (DMA_BUFSIZE/2) : left);
+		if (blocks == sb[ci].dma.blocks && sb[ci].dma.left == left) break;
+	}
+
+	if (sb[ci].mode == MODE_DMA && !sb[ci].dma.end_pending)
+		sb[ci].ScheduleDMABlockEnd();
 }
 
 static void DSP_RaiseIRQEvent(Bitu val) {
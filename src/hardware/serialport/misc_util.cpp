@@ -41,8 +41,14 @@
 #include "logging.h"
 #include "misc_util.h"
 #include "timer.h"
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <limits.h>
+#include <mutex>
+#include <thread>
 
 #ifdef NATIVESOCKETS
  #define CAPWORD (NETWRAPPER_TCP|NETWRAPPER_TCP_NATIVESOCKET)
@@ -140,12 +146,24 @@ bool NETClientSocket::SendByteBuffered(uint8_t val)
 	return SendArray(sendbuffer.data(), sendbuffer.size());
 }
 
+bool NETClientSocket::SetNotify(std::function<void()> notify)
+{
+	(void)notify;
+	return false;
+}
+
 NETServerSocket::NETServerSocket()
 {}
 
 NETServerSocket::~NETServerSocket()
 {}
 
+bool NETServerSocket::SetNotify(std::function<void()> notify)
+{
+	(void)notify;
+	return false;
+}
+
 NETServerSocket *NETServerSocket::NETServerFactory(SocketTypesE socketType,
                                                    uint16_t port)
 {
@@ -587,6 +605,299 @@ bool NetWrapper_InitializeSDLNet()
 	return sdl_net_manager.IsInitialized();
 }
 
+// --- TCP SOCKET REACTOR ----------------------------------------------------
+//
+// One thread services every TCP socket of the serial port emulation. It
+// sleeps in SDLNet_CheckSockets() and reads whatever arrives into a buffer
+// per socket, so receiving never touches the network on the emulation thread.
+// Owners are told about new data, hangups and callers from the timer tick,
+// which costs a single atomic load per millisecond while all lines are idle.
+// A loopback UDP socket in the same set wakes the thread up whenever the set
+// of watched sockets changes.
+
+struct NetReactorEntry {
+	TCPsocket sock = nullptr;
+	bool listening = false;
+	bool watch = true;    // reactor lock, off while the buffer is full or a caller waits
+	bool removed = false; // reactor lock
+
+	std::mutex rx_lock;
+	std::deque<uint8_t> rx = {}; // rx_lock
+
+	std::atomic<bool> throttled = {false};
+	std::atomic<bool> closed = {false};
+	std::atomic<bool> pending = {false};
+	std::function<void()> notify = nullptr; // emulation thread only
+};
+
+// stop reading a socket whose owner does not keep up, TCP flow control
+// then slows down the other end
+constexpr size_t net_reactor_rx_limit = 64 * 1024;
+
+static void NetReactor_Tick(void);
+
+class NetReactor {
+public:
+	NetReactor() = default;
+	NetReactor(const NetReactor &) = delete; // prevent copying
+	NetReactor &operator=(const NetReactor &) = delete; // prevent assignment
+
+	~NetReactor()
+	{
+		if (thread.joinable()) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				stop = true;
+				Wake();
+			}
+			thread.join();
+		}
+		if (wake_packet)
+			SDLNet_FreePacket(wake_packet);
+		if (wake_sock)
+			SDLNet_UDP_Close(wake_sock);
+	}
+
+	NetReactorEntry *Add(TCPsocket sock, bool listening)
+	{
+		if (!Start())
+			return nullptr;
+
+		NetReactorEntry *e = new NetReactorEntry;
+		e->sock = sock;
+		e->listening = listening;
+
+		std::lock_guard<std::mutex> guard(lock);
+		entries.push_back(e);
+		Wake();
+		return e;
+	}
+
+	// Once this returns the thread no longer uses the socket and it can be closed
+	void Remove(NetReactorEntry *e)
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		for (auto i = entries.begin(); i != entries.end(); ++i) {
+			if (*i == e) {
+				entries.erase(i);
+				break;
+			}
+		}
+		e->removed = true;
+		Wake();
+		// only the poll running now can still use the socket, the next
+		// one builds its set without it
+		if (in_poll) {
+			const uint64_t gen = poll_generation;
+			idle.wait(guard, [this, gen] { return poll_generation != gen; });
+		}
+		guard.unlock();
+		delete e;
+	}
+
+	// Watch a socket again after its buffer drained or a caller was accepted
+	void Watch(NetReactorEntry *e)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (!e->removed && !e->watch) {
+			e->watch = true;
+			Wake();
+		}
+	}
+
+	void Signal(NetReactorEntry *e)
+	{
+		e->pending = true;
+		any_pending = true;
+	}
+
+	void Tick()
+	{
+		if (!any_pending.load(std::memory_order_relaxed))
+			return;
+		any_pending = false;
+
+		// one at a time, a notify may well add or remove sockets
+		for (;;) {
+			std::function<void()> notify = nullptr;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				for (NetReactorEntry *e : entries) {
+					if (e->pending.exchange(false) && e->notify) {
+						notify = e->notify;
+						break;
+					}
+				}
+			}
+			if (!notify)
+				break;
+			notify();
+		}
+	}
+
+private:
+	bool Start()
+	{
+		if (thread.joinable())
+			return true;
+		if (failed)
+			return false;
+
+		IPaddress *local = nullptr;
+		wake_sock = SDLNet_UDP_Open(0);
+		if (wake_sock)
+			local = SDLNet_UDP_GetPeerAddress(wake_sock, -1);
+		wake_packet = SDLNet_AllocPacket(16);
+		if (!local || !wake_packet ||
+		    SDLNet_ResolveHost(&wake_addr, "127.0.0.1", 0) != 0) {
+			LOG_MSG("SDLNET: Socket reactor unavailable, serial sockets are polled: %s",
+			        SDLNet_GetError());
+			failed = true;
+			return false;
+		}
+		wake_addr.port = local->port;
+
+		TIMER_AddTickHandler(NetReactor_Tick);
+		thread = std::thread(&NetReactor::Run, this);
+		return true;
+	}
+
+	// Called with the lock held
+	void Wake()
+	{
+		wake_packet->address = wake_addr;
+		wake_packet->data[0] = 0;
+		wake_packet->len = 1;
+		SDLNet_UDP_Send(wake_sock, -1, wake_packet);
+	}
+
+	void Run()
+	{
+		std::vector<NetReactorEntry *> polled;
+		UDPpacket *drain = SDLNet_AllocPacket(16);
+		uint8_t buf[4096];
+
+		for (;;) {
+			SDLNet_SocketSet set = nullptr;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				if (stop)
+					break;
+
+				polled.clear();
+				for (NetReactorEntry *e : entries)
+					if (e->watch)
+						polled.push_back(e);
+
+				set = SDLNet_AllocSocketSet(static_cast<int>(polled.size()) + 1);
+				if (set) {
+					SDLNet_UDP_AddSocket(set, wake_sock);
+					for (NetReactorEntry *e : polled)
+						SDLNet_TCP_AddSocket(set, e->sock);
+					in_poll = true;
+				}
+			}
+			if (!set) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+
+			// the timeout only bounds how long a lost wakeup could last
+			const int ready = SDLNet_CheckSockets(set, 1000);
+
+			std::lock_guard<std::mutex> guard(lock);
+			if (ready > 0 && SDLNet_SocketReady(wake_sock))
+				while (drain && SDLNet_UDP_Recv(wake_sock, drain) > 0) {}
+
+			for (NetReactorEntry *e : polled) {
+				if (ready <= 0 || e->removed || !SDLNet_SocketReady(e->sock))
+					continue;
+
+				if (e->listening) {
+					// the owner accepts, then watches again
+					e->watch = false;
+					Signal(e);
+					continue;
+				}
+
+				const int got = SDLNet_TCP_Recv(e->sock, buf, sizeof(buf));
+				if (got < 1) {
+					e->watch = false;
+					e->closed = true;
+				} else {
+					std::lock_guard<std::mutex> rx_guard(e->rx_lock);
+					e->rx.insert(e->rx.end(), buf, buf + got);
+					if (e->rx.size() >= net_reactor_rx_limit) {
+						e->watch = false;
+						e->throttled = true;
+					}
+				}
+				Signal(e);
+			}
+
+			SDLNet_FreeSocketSet(set);
+			in_poll = false;
+			poll_generation++;
+			idle.notify_all();
+		}
+
+		if (drain)
+			SDLNet_FreePacket(drain);
+	}
+
+	std::mutex lock;
+	std::condition_variable idle;
+	std::vector<NetReactorEntry *> entries = {}; // lock
+	bool in_poll = false;                        // lock
+	uint64_t poll_generation = 0;                // lock, polls finished
+	bool stop = false;                           // lock
+	bool failed = false;
+	std::atomic<bool> any_pending = {false};
+	std::thread thread;
+	UDPsocket wake_sock = nullptr;
+	UDPpacket *wake_packet = nullptr;
+	IPaddress wake_addr = {0, 0};
+};
+
+// Only ever used after NetWrapper_InitializeSDLNet(), so that it goes away
+// before SDL_net does
+static NetReactor &GetNetReactor()
+{
+	static NetReactor reactor;
+	return reactor;
+}
+
+static void NetReactor_Tick(void)
+{
+	GetNetReactor().Tick();
+}
+
+// save state support
+void *NetReactor_Tick_PIC_Timer = (void *)((uintptr_t)NetReactor_Tick);
+
+// Reads up to n buffered bytes, returns how many
+static size_t NetReactor_Read(NetReactorEntry *e, uint8_t *data, size_t n)
+{
+	size_t got = 0;
+	bool resume = false;
+	{
+		std::lock_guard<std::mutex> guard(e->rx_lock);
+		if (n > e->rx.size())
+			n = e->rx.size();
+		for (; got < n; got++) {
+			data[got] = e->rx.front();
+			e->rx.pop_front();
+		}
+		if (e->throttled && e->rx.size() < (net_reactor_rx_limit / 2)) {
+			e->throttled = false;
+			resume = true;
+		}
+	}
+	if (resume)
+		GetNetReactor().Watch(e);
+	return got;
+}
+
 #ifdef NATIVESOCKETS
 TCPClientSocket::TCPClientSocket(int platformsocket)
 {
@@ -625,6 +936,7 @@ TCPClientSocket::TCPClientSocket(int platformsocket)
 		if(!listensocketset) return;
 		SDLNet_TCP_AddSocket(listensocketset, mysock);
 		isopen=true;
+		reactor = GetNetReactor().Add(mysock, false);
 		return;
 	}
 	return;
@@ -643,6 +955,7 @@ TCPClientSocket::TCPClientSocket(TCPsocket source)
 		SDLNet_TCP_AddSocket(listensocketset, source);
 
 		isopen=true;
+		reactor = GetNetReactor().Add(mysock, false);
 	}
 }
 
@@ -661,11 +974,14 @@ TCPClientSocket::TCPClientSocket(const char *destination, uint16_t port)
 			return;
 		SDLNet_TCP_AddSocket(listensocketset, mysock);
 		isopen=true;
+		reactor = GetNetReactor().Add(mysock, false);
 	}
 }
 
 TCPClientSocket::~TCPClientSocket()
 {
+	if (reactor)
+		GetNetReactor().Remove(reactor);
 #ifdef NATIVESOCKETS
 	delete nativetcpstruct;
 #endif
@@ -693,9 +1009,29 @@ bool TCPClientSocket::GetRemoteAddressString(char *buffer)
 	return true;
 }
 
+bool TCPClientSocket::SetNotify(std::function<void()> notify)
+{
+	if (!reactor)
+		return false;
+	reactor->notify = notify;
+	// anything that came in before
+	GetNetReactor().Signal(reactor);
+	return true;
+}
+
 bool TCPClientSocket::ReceiveArray(uint8_t *data, size_t &n)
 {
 	assert(data);
+	if (reactor) {
+		// closed is only set once everything before it is buffered
+		const bool closed = reactor->closed;
+		n = NetReactor_Read(reactor, data, n);
+		if (n == 0 && closed) {
+			isopen = false;
+			return false;
+		}
+		return true;
+	}
 	if (SDLNet_CheckSockets(listensocketset, 0)) {
 		const int result = SDLNet_TCP_Recv(mysock, data, static_cast<int>(n));
 		if(result < 1) {
@@ -715,6 +1051,16 @@ bool TCPClientSocket::ReceiveArray(uint8_t *data, size_t &n)
 SocketState TCPClientSocket::GetcharNonBlock(uint8_t &val)
 {
 	SocketState state = SocketState::Empty;
+	if (reactor) {
+		const bool closed = reactor->closed;
+		if (NetReactor_Read(reactor, &val, 1) == 1)
+			return SocketState::Good;
+		if (closed) {
+			isopen = false;
+			return SocketState::Closed;
+		}
+		return SocketState::Empty;
+	}
 	if(SDLNet_CheckSockets(listensocketset,0))
 	{
 		if (SDLNet_TCP_Recv(mysock, &val, 1) == 1)
@@ -761,10 +1107,13 @@ TCPServerSocket::TCPServerSocket(const uint16_t port)
 		return;
 	}
 	isopen = true;
+	reactor = GetNetReactor().Add(mysock, true);
 }
 
 TCPServerSocket::~TCPServerSocket()
 {
+	if (reactor)
+		GetNetReactor().Remove(reactor);
 	if (mysock) {
 		SDLNet_TCP_Close(mysock);
 		LOG_MSG("SDLNET: closed server TCP listening socket");
@@ -776,6 +1125,8 @@ NETClientSocket *TCPServerSocket::Accept()
 	TCPsocket new_tcpsock;
 
 	new_tcpsock=SDLNet_TCP_Accept(mysock);
+	if (reactor)
+		GetNetReactor().Watch(reactor);
 	if(!new_tcpsock) {
 		//printf("SDLNet_TCP_Accept: %s\n", SDLNet_GetError());
 		return nullptr;
@@ -783,4 +1134,13 @@ NETClientSocket *TCPServerSocket::Accept()
 	
 	return new TCPClientSocket(new_tcpsock);
 }
+
+bool TCPServerSocket::SetNotify(std::function<void()> notify)
+{
+	if (!reactor)
+		return false;
+	reactor->notify = notify;
+	GetNetReactor().Signal(reactor);
+	return true;
+}
 #endif // #if C_MODEM
@@ -26,6 +26,7 @@
 
 #if C_MODEM
 
+#include <functional>
 #include <vector>
 #ifndef DOSBOX_SUPPORT_H
 #include "support.h"
@@ -113,6 +114,11 @@ public:
 	virtual bool ReceiveArray(uint8_t *data, size_t &n) = 0;
 	virtual bool GetRemoteAddressString(char *buffer) = 0;
 
+	// Event driven sockets call notify from the timer tick, on the emulation
+	// thread, when data or a hangup is waiting. Returns false if the socket
+	// has to be polled instead.
+	virtual bool SetNotify(std::function<void()> notify);
+
 	void FlushBuffer();
 	void SetSendBufferSize(size_t n);
 	bool SendByteBuffered(uint8_t val);
@@ -137,6 +143,9 @@ public:
 
 	virtual NETClientSocket *Accept() = 0;
 
+	// As NETClientSocket::SetNotify, for a waiting connection
+	virtual bool SetNotify(std::function<void()> notify);
+
 	bool isopen = false;
 };
 
@@ -190,6 +199,8 @@ private:
 
 // --- TCP NET INTERFACE -----------------------------------------------------
 
+struct NetReactorEntry; // shared receive thread, see misc_util.cpp
+
 struct _TCPsocketX {
 	int ready = 0;
 #ifdef NATIVESOCKETS
@@ -217,8 +228,10 @@ public:
 	bool SendArray(const uint8_t *data, size_t n) override;
 	bool ReceiveArray(uint8_t *data, size_t &n) override;
 	bool GetRemoteAddressString(char *buffer) override;
+	bool SetNotify(std::function<void()> notify) override;
 
 private:
+	NetReactorEntry *reactor = nullptr;
 
 #ifdef NATIVESOCKETS
 	_TCPsocketX *nativetcpstruct = nullptr;
@@ -239,6 +252,10 @@ public:
 	~TCPServerSocket();
 
 	NETClientSocket *Accept() override;
+	bool SetNotify(std::function<void()> notify) override;
+
+private:
+	NetReactorEntry *reactor = nullptr;
 };
 
 #endif // C_MODEM
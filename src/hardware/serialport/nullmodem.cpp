@@ -46,6 +46,7 @@ CNullModem::CNullModem(Bitu id, CommandLine* cmd):CSerial (id, cmd) {
 	
 	dtrrespect=false;
 	tx_block=false;
+	rx_notify=false;
 	receiveblock=false;
 	transparent=false;
     nonlocal=false;
@@ -224,7 +225,8 @@ bool CNullModem::ClientConnect(NETClientSocket *newsocket) {
 	if (!transparent) setRTSDTR(getRTS(), getDTR());
 	rx_state=N_RX_IDLE;
 	LOG_MSG("Serial%d: Connected to %s",(int)COMNUMBER,peernamebuf);
-	setEvent(SERIAL_POLLING_EVENT, 1);
+	rx_notify = clientsocket->SetNotify([this]() { SocketEvent(); });
+	if (!rx_notify) setEvent(SERIAL_POLLING_EVENT, 1);
 	setCD(true);
 	return true;
 }
@@ -235,7 +237,8 @@ bool CNullModem::ServerListen() {
 	if (!serversocket->isopen) return false;
 	LOG_MSG("Serial%d: Nullmodem server waiting for connection on %s port %d...",
 		(int)COMNUMBER,socketType ? "ENet" : "TCP",serverport);
-	setEvent(SERIAL_SERVER_POLLING_EVENT, 50);
+	if (!serversocket->SetNotify([this]() { ServerSocketEvent(); }))
+		setEvent(SERIAL_SERVER_POLLING_EVENT, 50);
 	setCD(false);
 	return true;
 }
@@ -263,7 +266,8 @@ bool CNullModem::ServerConnect() {
 
 	clientsocket->SetSendBufferSize(256);
 	rx_state=N_RX_IDLE;
-	setEvent(SERIAL_POLLING_EVENT, 1);
+	rx_notify = clientsocket->SetNotify([this]() { SocketEvent(); });
+	if (!rx_notify) setEvent(SERIAL_POLLING_EVENT, 1);
 	
 	// we don't accept further connections
 	delete serversocket;
@@ -282,15 +286,20 @@ void CNullModem::Disconnect() {
 	LOG_MSG("Serial%d: Disconnected.",(int)COMNUMBER);
 	delete clientsocket;
 	clientsocket = nullptr;
+	rx_notify = false;
 	setDSR(false);
 	setCTS(false);
 	setCD(false);
 	
 	if (serverport) {
 		serversocket = NETServerSocket::NETServerFactory(socketType,serverport);
-		if (serversocket->isopen)
-			setEvent(SERIAL_SERVER_POLLING_EVENT, 50);
-		else delete serversocket;
+		if (serversocket->isopen) {
+			if (!serversocket->SetNotify([this]() { ServerSocketEvent(); }))
+				setEvent(SERIAL_SERVER_POLLING_EVENT, 50);
+		} else {
+			delete serversocket;
+			serversocket = nullptr;
+		}
 	} else if (dtrrespect) {
 		setEvent(SERIAL_NULLMODEM_DTR_EVENT,50);
 		DTR_delta = getDTR(); // try to reconnect the next time DTR is set
@@ -302,8 +311,9 @@ void CNullModem::handleUpperEvent(uint16_t type) {
 	switch(type) {
 		case SERIAL_POLLING_EVENT: {
 			// periodically check if new data arrived, disconnect
-			// if required. Add it back.
-			setEvent(SERIAL_POLLING_EVENT, 1.0f);
+			// if required. Add it back. An event driven socket
+			// only needs it to time out a blocked receiver.
+			if (!rx_notify) setEvent(SERIAL_POLLING_EVENT, 1.0f);
 			// update Modem input line states
 			updateMSR();
 			switch(rx_state) {
@@ -362,6 +372,8 @@ void CNullModem::handleUpperEvent(uint16_t type) {
 				case N_RX_FASTWAIT:
 					break;
 			}
+			if (rx_notify && clientsocket && rx_state==N_RX_BLOCKED)
+				setEvent(SERIAL_POLLING_EVENT, 1.0f);
 			break;
 		}
 		case SERIAL_RX_EVENT: {
@@ -395,6 +407,12 @@ void CNullModem::handleUpperEvent(uint16_t type) {
 							log_ser(dbg_aux,"Nullmodem: rx still blocked (retry=%d)",rx_retry);
 						else log_ser(dbg_aux,"Nullmodem: block on continued rx (retry=%d).",rx_retry);
 #endif
+						// an event driven socket has no polling event running,
+						// start the one that times the block out
+						if (rx_state!=N_RX_BLOCKED && rx_notify && clientsocket) {
+							removeEvent(SERIAL_POLLING_EVENT);
+							setEvent(SERIAL_POLLING_EVENT, 1.0f);
+						}
 						setEvent(SERIAL_RX_EVENT, bytetime*0.65f);
 						rx_state=N_RX_BLOCKED;
 					}
@@ -474,6 +492,18 @@ bool CNullModem::doReceive () {
 		return false;
 }
  
+// The client socket has data or was closed. A receiver that is busy picks it
+// up by itself, an idle one gets the SERIAL_POLLING_EVENT treatment right away.
+void CNullModem::SocketEvent() {
+	if (!clientsocket || rx_state!=N_RX_IDLE) return;
+	removeEvent(SERIAL_POLLING_EVENT);
+	handleUpperEvent(SERIAL_POLLING_EVENT);
+}
+
+void CNullModem::ServerSocketEvent() {
+	if (serversocket) ServerConnect();
+}
+
 void CNullModem::transmitByte (uint8_t val, bool first) {
  	// transmit it later in THR_Event
 	if (first) setEvent(SERIAL_THR_EVENT, bytetime/8);
@@ -68,6 +68,8 @@ private:
 #define N_RX_DISC		4
 
 	bool doReceive();
+	void SocketEvent();
+	void ServerSocketEvent();
 	bool ClientConnect(NETClientSocket * newsocket);
 	bool ServerListen();
 	bool ServerConnect();
@@ -82,6 +84,9 @@ private:
 	bool tx_block;		// true while the SERIAL_TX_REDUCTION event
 						// is pending
 
+	bool rx_notify;		// the client socket tells us about new data,
+						// no SERIAL_POLLING_EVENT while idle
+
 	Bitu rx_retry;		// counter of retries
 
 	Bitu rx_retry_max;	// how many POLL_EVENTS to wait before causing
@@ -132,6 +132,7 @@ CSerialModem::CSerialModem(Bitu id, CommandLine* cmd):CSerial(id, cmd) {
 	waitingclientsocket = nullptr;
 	clientsocket = nullptr;
 	serversocket = nullptr;
+	server_notify = false;
 	getBituSubstring("listenport:", &listenport, cmd);
 	
 	// TODO: Fix dialtones if requested
@@ -142,6 +143,7 @@ CSerialModem::CSerialModem(Bitu id, CommandLine* cmd):CSerial(id, cmd) {
 	CSerial::Init_Registers();
 	Reset(); // reset calls EnterIdleState
 		
+	polling = true;
 	setEvent(SERIAL_POLLING_EVENT,1);
 	InstallationSuccessful=true;
 }
@@ -186,6 +188,7 @@ void CSerialModem::handleUpperEvent(uint16_t type) {
 			}
 		}
 		ByteTransmitted();
+		WakePolling();
 		break;
 	}
 	case SERIAL_POLLING_EVENT: {
@@ -194,7 +197,13 @@ void CSerialModem::handleUpperEvent(uint16_t type) {
 			setEvent(SERIAL_RX_EVENT, (float)0.01);
 		}
 		Timer2();
-		setEvent(SERIAL_POLLING_EVENT,1);
+		// on hook with nothing queued, the modem only waits for the
+		// guest (MODEM_TX_EVENT) or for a caller (server socket notify)
+		if (connected || ringing || clientsocket || waitingclientsocket ||
+			tqueue->inuse() || rqueue->inuse() || (serversocket && !server_notify))
+			setEvent(SERIAL_POLLING_EVENT,1);
+		else
+			polling = false;
 		break;
 	}
 
@@ -204,6 +213,13 @@ void CSerialModem::handleUpperEvent(uint16_t type) {
 	}
 }
 
+void CSerialModem::WakePolling(void) {
+	if (!polling) {
+		polling = true;
+		setEvent(SERIAL_POLLING_EVENT,1);
+	}
+}
+
 void CSerialModem::SendLine(const char *line) {
 	rqueue->addb(0xd);
 	rqueue->addb(0xa);
@@ -371,6 +387,7 @@ void CSerialModem::EnterIdleState(void){
 	} else if (listenport) {
 
 		serversocket=NETServerSocket::NETServerFactory(socketType,listenport);
+		server_notify = serversocket->isopen && serversocket->SetNotify([this]() { WakePolling(); });
 		if(!serversocket->isopen) {
 			LOG_MSG("Serial%d: Modem could not open %s port %u.",
                                 static_cast<uint32_t>(COMNUMBER), socketType ? "ENet" : "TCP",
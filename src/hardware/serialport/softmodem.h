@@ -193,6 +193,7 @@ public:
 
 	//TODO
 	void Timer2(void);
+	void WakePolling(void);
 	void handleUpperEvent(uint16_t type) override;
 
 	void RXBufferEmpty();
@@ -220,6 +221,8 @@ protected:
 	bool telnetmode;		// true: process IAC commands.
 	
 	bool connected;
+	bool polling;			// SERIAL_POLLING_EVENT is scheduled
+	bool server_notify;		// the server socket tells us about callers
 	Bitu doresponse;
 
 	uint8_t waiting_tx_character;
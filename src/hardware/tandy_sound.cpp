@@ -77,6 +77,7 @@ static void SN76496Write(Bitu /*port*/,Bitu data,Bitu /*iolen*/) {
 		tandy.chan->Enable(true);
 		tandy.enabled=true;
 	}
+	tandy.chan->WakeUp();
 
 	// assume state change, always.
 	// this hack allows sample accurate rendering without enabling sample accurate mode in the mixer.
@@ -88,12 +89,6 @@ static void SN76496Write(Bitu /*port*/,Bitu data,Bitu /*iolen*/) {
 }
 
 static void SN76496Update(Bitu length) {
-	//Disable the channel if it's been quiet for a while
-	if ((tandy.last_write+5000)<PIC_Ticks) {
-		tandy.enabled=false;
-		tandy.chan->Enable(false);
-		return;
-	}
 	const Bitu MAX_SAMPLES = 2048;
 	if (length > MAX_SAMPLES)
 		return;
@@ -103,6 +98,9 @@ static void SN76496Update(Bitu length) {
 	device_sound_interface::sound_stream stream;
 	static_cast<device_sound_interface&>(device).sound_stream_update(stream, nullptr, &outputs, (int)length);
 	tandy.chan->AddSamples_m16(length, buffer);
+
+	//All voices attenuated to silence: nothing changes until the next write
+	if (tandy.chan->IsQuiet(100)) tandy.chan->Sleep();
 }
 
 bool TS_Get_Address(Bitu& tsaddr, Bitu& tsirq, Bitu& tsdma) {
@@ -166,6 +164,7 @@ static void TandyDACDMADisabled(void) {
 }
 
 static void TandyDACWrite(Bitu port,Bitu data,Bitu /*iolen*/) {
+	tandy.dac.chan->WakeUp();
 	switch (port) {
 	case 0xc4: {
 		Bitu oldmode = tandy.dac.mode;
@@ -284,6 +283,7 @@ static void TandyDACUpdate(Bitu length) {
 		}
 	} else {
 		tandy.dac.chan->AddSilence();
+		if (tandy.dac.chan->IsQuiet(100)) tandy.dac.chan->Sleep();
 	}
 }
 
@@ -1343,6 +1343,14 @@ uint8_t imageDisk::Read_Sector(uint32_t head,uint32_t cylinder,uint32_t sector,v
 uint8_t imageDisk::Read_AbsoluteSector(uint32_t sectnum, void * data) {
 	if (ffdd) return ffdd->ReadSector(sectnum, data);
 
+    if (private_writes) {
+        auto i = private_sectors.find(sectnum);
+        if (i != private_sectors.end()) {
+            memcpy(data, i->second.data(), sector_size);
+            return 0x00;
+        }
+    }
+
     uint64_t bytenum,res;
     int got;
 
@@ -1399,6 +1407,12 @@ uint8_t imageDisk::Write_AbsoluteSector(uint32_t sectnum, const void *data) {
     }
     bytenum += image_base;
 
+    if (private_writes) {
+        const uint8_t *src = (const uint8_t*)data;
+        private_sectors[sectnum].assign(src, src + sector_size);
+        return 0x00;
+    }
+
     //LOG_MSG("Writing sectors to %ld at bytenum %d", sectnum, bytenum);
 
     fseeko64(diskimg,(fseek_ofs_t)bytenum,SEEK_SET);
@@ -1411,6 +1425,30 @@ uint8_t imageDisk::Write_AbsoluteSector(uint32_t sectnum, const void *data) {
 
 }
 
+/* Called in a fork server child. The FILE inherited from the server shares its file
+ * offset with the server and every other child, so open our own read only handle and
+ * keep the sectors this child writes in memory, they go away when the child exits. */
+bool imageDisk::Can_Fork_Private(void) const {
+    return class_id == ID_BASE && ffdd == NULL && diskimg != NULL && !diskname.empty();
+}
+
+bool imageDisk::Fork_Private(void) {
+    if (private_writes) return true;
+    if (!Can_Fork_Private())
+        return false;
+
+    FILE *f = fopen_wrap(diskname.c_str(), "rb");
+    if (f == NULL) {
+        LOG_MSG("Fork server: cannot reopen disk image %s",diskname.c_str());
+        return false;
+    }
+
+    fclose(diskimg);
+    diskimg = f;
+    private_writes = true;
+    return true;
+}
+
 void imageDisk::Set_Reserved_Cylinders(Bitu resCyl) {
     reserved_cylinders = resCyl;
 }
@@ -0,0 +1,408 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "dosbox.h"
+#include "logging.h"
+#include "bios_disk.h"
+#include "qcow2_disk.h"
+#include "diskdelta.h"
+
+#if C_HAVE_MMAP
+# include <sys/mman.h>
+#endif
+
+FILE * fopen_lock(const char * fname, const char * mode, bool &readonly);
+
+/* imageDiskOverlay puts a sparse delta file in front of another image, so that
+ * several instances can share one read only base image and each keep their
+ * own writes.
+ *
+ * The delta is written a cluster at a time: the first write into a cluster
+ * copies the rest of it up from the base image, then marks the cluster in the
+ * bitmap. Reads of clusters never written go straight to the base image, so
+ * unmodified regions read as fast as the base image itself.
+ *
+ * The bitmap is mapped from the delta file where mmap() is available and
+ * otherwise kept in memory and written through a byte at a time. The data is
+ * stored at its offset in the disk (see diskdelta.h), which leaves the delta
+ * file sparse on filesystems that support it. */
+
+imageDiskOverlay::imageDiskOverlay(imageDisk *base) : imageDisk(ID_OVERLAY) {
+	basedisk = base;
+	basedisk->Addref();
+
+	drvnum         = basedisk->drvnum;
+	diskname       = basedisk->diskname;
+	active         = basedisk->active;
+	sector_size    = basedisk->sector_size;
+	heads          = basedisk->heads;
+	cylinders      = basedisk->cylinders;
+	sectors        = basedisk->sectors;
+	hardDrive      = basedisk->hardDrive;
+	diskSizeK      = basedisk->diskSizeK;
+	diskChangeFlag = basedisk->diskChangeFlag;
+}
+
+imageDiskOverlay* imageDiskOverlay::Open(imageDisk *base, const char *deltaName, uint32_t clusterSize, std::string &error) {
+	unsigned char hdrbuf[DISKDELTA_HEADER_SIZE];
+	DiskDeltaHeader hdr;
+	uint64_t base_size;
+
+	if (base == NULL || base->getSectSize() == 0) {
+		error = "base image has no sector size";
+		return NULL;
+	}
+
+	base_size = base->getImageLength();
+	if (base_size == 0) base_size = base->diskSizeK * 1024u;
+	if (base_size == 0) base_size = (uint64_t)base->cylinders * base->heads * base->sectors * base->getSectSize();
+	if (base_size == 0) {
+		error = "base image has no size";
+		return NULL;
+	}
+
+	/* what identifies the base image to the delta, see diskdelta.h */
+	const uint32_t base_format = (base->class_id == imageDisk::ID_BASE && base->ffdd == NULL &&
+		base->diskimg != NULL && dynamic_cast<QCow2Disk*>(base) == NULL) ? DISKDELTA_BASE_FILE : DISKDELTA_BASE_OTHER;
+	const uint64_t base_offset = base_format == DISKDELTA_BASE_FILE ? base->getImageBase() : 0;
+	std::vector<uint8_t> first(base->getSectSize());
+	if (base->Read_AbsoluteSector(0, first.data()) != 0x00) {
+		error = "cannot read the first sector of the base image";
+		return NULL;
+	}
+	const uint32_t base_check = DiskDeltaHeader::checksum(first.data(), first.size());
+
+	/* locked like the base images, two instances writing one delta would corrupt it */
+	bool readonly = false;
+	FILE *f = fopen_lock(deltaName, "rb+", readonly);
+	if (f == NULL && errno == ENOENT) {
+		hdr.cluster_size = clusterSize != 0 ? clusterSize : DISKDELTA_DEFAULT_CLUSTER;
+		hdr.sector_size = base->getSectSize();
+		hdr.disk_size = base_size;
+		hdr.base_offset = base_offset;
+		hdr.base_format = base_format;
+		hdr.base_check = base_check;
+		hdr.layout();
+		if (!hdr.valid()) {
+			error = "cluster size must be a power of two and a multiple of the sector size";
+			return NULL;
+		}
+
+		f = fopen(deltaName, "wb+");
+		if (f == NULL) {
+			error = strerror(errno);
+			return NULL;
+		}
+
+		/* header and an empty bitmap, the data area stays a hole until written */
+		std::vector<uint8_t> zero((size_t)hdr.bitmap_bytes(), 0);
+		hdr.encode(hdrbuf);
+		if (fwrite(hdrbuf, DISKDELTA_HEADER_SIZE, 1, f) != 1 ||
+			fseeko64(f, (fseek_ofs_t)hdr.bitmap_offset, SEEK_SET) != 0 ||
+			fwrite(zero.data(), zero.size(), 1, f) != 1 || fflush(f) != 0) {
+			fclose(f);
+			error = "cannot write the delta file header";
+			return NULL;
+		}
+		fclose(f);
+
+		/* and open it again the same way as an existing one */
+		readonly = false;
+		f = fopen_lock(deltaName, "rb+", readonly);
+	}
+	if (f == NULL) {
+		error = (errno == EWOULDBLOCK || errno == EAGAIN) ? "delta file is in use by another instance" : strerror(errno);
+		return NULL;
+	}
+	if (readonly) {
+		fclose(f);
+		error = "delta file is read-only";
+		return NULL;
+	}
+
+	if (fread(hdrbuf, DISKDELTA_HEADER_SIZE, 1, f) != 1 || !hdr.decode(hdrbuf) || !hdr.valid()) {
+		fclose(f);
+		error = "not a delta file or unsupported version";
+		return NULL;
+	}
+	if (hdr.disk_size != base_size) {
+		fclose(f);
+		error = "delta file was made for an image of a different size";
+		return NULL;
+	}
+	if (hdr.base_format != base_format || hdr.base_offset != base_offset || hdr.base_check != base_check) {
+		fclose(f);
+		error = "delta file was made for a different image";
+		return NULL;
+	}
+	if (clusterSize != 0 && clusterSize != hdr.cluster_size)
+		LOG_MSG("Delta file %s: using its cluster size of %u bytes",deltaName,(unsigned int)hdr.cluster_size);
+
+	/* the header and bitmap must be there in full, touching a mapping past the end raises SIGBUS */
+	const int64_t delta_size = fseeko64(f, 0, SEEK_END) == 0 ? (int64_t)ftello64(f) : -1;
+	if (delta_size < 0 || (uint64_t)delta_size < hdr.bitmap_offset + hdr.bitmap_bytes()) {
+		fclose(f);
+		error = "delta file is truncated";
+		return NULL;
+	}
+
+	// same as the base images, see fatDrive::fatDrive()
+	setbuf(f, NULL);
+
+	uint8_t *map = NULL;
+	size_t map_size = 0;
+	std::vector<uint8_t> copy;
+
+#if C_HAVE_MMAP
+	map_size = (size_t)(hdr.bitmap_offset + hdr.bitmap_bytes());
+	map = (uint8_t*)mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(f), 0);
+	if ((void*)map == MAP_FAILED) {
+		map = NULL;
+		map_size = 0;
+	}
+#endif
+	if (map == NULL) {
+		copy.resize((size_t)hdr.bitmap_bytes());
+		if (fseeko64(f, (fseek_ofs_t)hdr.bitmap_offset, SEEK_SET) != 0 ||
+			fread(copy.data(), copy.size(), 1, f) != 1) {
+			fclose(f);
+			error = "cannot read the delta file bitmap";
+			return NULL;
+		}
+	}
+
+	imageDiskOverlay *ov = new imageDiskOverlay(base);
+	ov->deltaimg = f;
+	ov->deltaname = deltaName;
+	ov->cluster_size = hdr.cluster_size;
+	ov->disk_size = hdr.disk_size;
+	ov->image_length = hdr.disk_size;
+	ov->bitmap_offset = hdr.bitmap_offset;
+	ov->data_offset = hdr.data_offset;
+	if (map != NULL) {
+		ov->bitmap = map + hdr.bitmap_offset;
+		ov->bitmap_map_size = map_size;
+	}
+	else {
+		ov->bitmap_copy.swap(copy);
+		ov->bitmap = ov->bitmap_copy.data();
+	}
+
+	return ov;
+}
+
+bool imageDiskOverlay::ParseOptions(const std::vector<std::string> &options, std::string &deltaName, uint32_t &clusterSize) {
+	deltaName.clear();
+	clusterSize = 0;
+
+	for (const auto &opt : options) {
+		if (opt.compare(0, 6, "delta=") == 0)
+			deltaName = opt.substr(6);
+		else if (opt.compare(0, 13, "deltacluster=") == 0)
+			clusterSize = (uint32_t)strtoul(opt.c_str() + 13, NULL, 0);
+	}
+
+	return !deltaName.empty();
+}
+
+bool imageDiskOverlay::setClusterPresent(uint64_t cluster) {
+	bitmap[cluster >> 3u] |= (uint8_t)(1u << (cluster & 7u));
+
+	if (bitmap_map_size == 0) {
+		if (fseeko64(deltaimg, (fseek_ofs_t)(bitmap_offset + (cluster >> 3u)), SEEK_SET) != 0 ||
+			fwrite(&bitmap[cluster >> 3u], 1, 1, deltaimg) != 1)
+			return false;
+	}
+
+	return true;
+}
+
+/* first write into a cluster: gather the cluster from the base image with the
+ * new sector in place and write it in one go, the bit is set only after that */
+uint8_t imageDiskOverlay::copyUpCluster(uint64_t cluster, uint32_t sectnum, const void *data) {
+	const uint64_t start = cluster * cluster_size;
+	const uint64_t end = std::min(start + cluster_size, disk_size);
+	std::vector<uint8_t> buf((size_t)(end - start));
+
+	for (uint64_t ofs = start;(ofs + sector_size) <= end;ofs += sector_size) {
+		const uint32_t s = (uint32_t)(ofs / sector_size);
+		uint8_t *dst = buf.data() + (ofs - start);
+
+		if (s == sectnum) {
+			memcpy(dst, data, sector_size);
+		}
+		else {
+			const uint8_t ret = basedisk->Read_AbsoluteSector(s, dst);
+			if (ret != 0x00) return ret;
+		}
+	}
+
+	if (fseeko64(deltaimg, (fseek_ofs_t)(data_offset + start), SEEK_SET) != 0 ||
+		fwrite(buf.data(), buf.size(), 1, deltaimg) != 1) {
+		LOG_MSG("Delta file: cannot write cluster %llu",(unsigned long long)cluster);
+		return 0x05;
+	}
+
+	if (!setClusterPresent(cluster)) {
+		LOG_MSG("Delta file: cannot update bitmap for cluster %llu",(unsigned long long)cluster);
+		return 0x05;
+	}
+
+	return 0x00;
+}
+
+uint8_t imageDiskOverlay::Read_AbsoluteSector(uint32_t sectnum, void * data) {
+	const uint64_t ofs = (uint64_t)sectnum * sector_size;
+
+	if (private_writes) {
+		auto i = private_sectors.find(sectnum);
+		if (i != private_sectors.end()) {
+			memcpy(data, i->second.data(), sector_size);
+			return 0x00;
+		}
+	}
+
+	if ((ofs + sector_size) > disk_size || sector_size == 0 || (cluster_size % sector_size) != 0)
+		return basedisk->Read_AbsoluteSector(sectnum, data);
+
+	if (!isClusterPresent(ofs / cluster_size))
+		return basedisk->Read_AbsoluteSector(sectnum, data);
+
+	if (fseeko64(deltaimg, (fseek_ofs_t)(data_offset + ofs), SEEK_SET) != 0 ||
+		fread(data, sector_size, 1, deltaimg) != 1)
+		return 0x05;
+
+	return 0x00;
+}
+
+uint8_t imageDiskOverlay::Write_AbsoluteSector(uint32_t sectnum, const void * data) {
+	const uint64_t ofs = (uint64_t)sectnum * sector_size;
+
+	if (sector_size == 0 || (cluster_size % sector_size) != 0)
+		return 0x05;
+	if ((ofs + sector_size) > disk_size) {
+		LOG_MSG("Attempt to write invalid sector in imageDiskOverlay::Write_AbsoluteSector for sector %lu.\n", (unsigned long)sectnum);
+		return 0x05;
+	}
+
+	if (private_writes) {
+		const uint8_t *src = (const uint8_t*)data;
+		private_sectors[sectnum].assign(src, src + sector_size);
+		return 0x00;
+	}
+
+	const uint64_t cluster = ofs / cluster_size;
+	if (!isClusterPresent(cluster))
+		return copyUpCluster(cluster, sectnum, data);
+
+	if (fseeko64(deltaimg, (fseek_ofs_t)(data_offset + ofs), SEEK_SET) != 0 ||
+		fwrite(data, sector_size, 1, deltaimg) != 1)
+		return 0x05;
+
+	return 0x00;
+}
+
+bool imageDiskOverlay::Flush(void) {
+	bool ok = true;
+
+	if (deltaimg == NULL) return true;
+#if C_HAVE_MMAP
+	if (bitmap_map_size != 0 && msync(bitmap - bitmap_offset, bitmap_map_size, MS_SYNC) != 0)
+		ok = false;
+#endif
+	if (fflush(deltaimg) != 0)
+		ok = false;
+
+	return ok;
+}
+
+bool imageDiskOverlay::Can_Fork_Private(void) const {
+	return deltaimg != NULL && !deltaname.empty() && basedisk->Can_Fork_Private();
+}
+
+/* Fork server child: the delta, like the base image, is only read from now on,
+ * through a handle of our own, with a copy of the bitmap so that what the server
+ * writes after the fork does not show through. */
+bool imageDiskOverlay::Fork_Private(void) {
+	if (private_writes) return true;
+	if (!Can_Fork_Private() || !basedisk->Fork_Private())
+		return false;
+
+	FILE *f = fopen(deltaname.c_str(), "rb");
+	if (f == NULL) {
+		LOG_MSG("Fork server: cannot reopen delta file %s",deltaname.c_str());
+		return false;
+	}
+	setbuf(f, NULL);
+
+#if C_HAVE_MMAP
+	if (bitmap_map_size != 0) {
+		bitmap_copy.assign(bitmap, bitmap + (bitmap_map_size - (size_t)bitmap_offset));
+		munmap(bitmap - bitmap_offset, bitmap_map_size);
+		bitmap = bitmap_copy.data();
+		bitmap_map_size = 0;
+	}
+#endif
+	fclose(deltaimg);
+	deltaimg = f;
+	private_writes = true;
+	return true;
+}
+
+void imageDiskOverlay::UpdateFloppyType(void) {
+	basedisk->UpdateFloppyType();
+}
+
+void imageDiskOverlay::Set_Reserved_Cylinders(Bitu resCyl) {
+	basedisk->Set_Reserved_Cylinders(resCyl);
+}
+
+uint32_t imageDiskOverlay::Get_Reserved_Cylinders() {
+	return basedisk->Get_Reserved_Cylinders();
+}
+
+void imageDiskOverlay::Set_Geometry(uint32_t setHeads, uint32_t setCyl, uint32_t setSect, uint32_t setSectSize) {
+	heads = setHeads;
+	cylinders = setCyl;
+	sectors = setSect;
+	sector_size = setSectSize;
+	if (sector_size == 0 || (cluster_size % sector_size) != 0)
+		LOG_MSG("Delta file: sector size %u does not divide the cluster size %u, writes will fail",(unsigned int)sector_size,(unsigned int)cluster_size);
+	basedisk->Set_Geometry(setHeads,setCyl,setSect,setSectSize);
+}
+
+uint8_t imageDiskOverlay::GetBiosType(void) {
+	return basedisk->GetBiosType();
+}
+
+imageDiskOverlay::~imageDiskOverlay() {
+	if (deltaimg != NULL) {
+		if (!Flush())
+			LOG_MSG("Delta file: flushing %s failed",diskname.c_str());
+#if C_HAVE_MMAP
+		if (bitmap_map_size != 0)
+			munmap(bitmap - bitmap_offset, bitmap_map_size);
+#endif
+		fclose(deltaimg);
+		deltaimg = NULL;
+	}
+	basedisk->Release();
+}
@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <time.h>
+#include <set>
 #if defined(__linux__)
 #include <linux/limits.h>
 #endif
@@ -32,6 +33,8 @@
 #include "dos_inc.h" /* for Drives[] */
 #include "../dos/drives.h"
 #include "mapper.h"
+#include "pic.h"
+#include "timer.h"
 #include "SDL.h"
 
 #if defined(__linux__) && !defined(__GLIBC__)
@@ -270,8 +273,12 @@ imageDiskVHD::ErrorCodes imageDiskVHD::Open(const char* fileName, const bool rea
 	vhd->blockMapSectors = blockMapSectors;
 	vhd->blockMapSize = blockMapSectors * 512;
 	vhd->sectorsPerBlock = sectorsPerBlock;
-	vhd->currentBlockDirtyMap = (uint8_t*)malloc(vhd->blockMapSize);
-	if (!vhd->currentBlockDirtyMap) { delete vhd; return INVALID_DATA; }
+
+	//load the BAT, from now on it is only read from memory
+	vhd->bat.resize(dynHeader.maxTableEntries);
+	if (fseeko64(file, (off_t)dynHeader.tableOffset, SEEK_SET)) { delete vhd; return INVALID_DATA; }
+	if (fread(vhd->bat.data(), sizeof(uint32_t), vhd->bat.size(), file) != vhd->bat.size()) { delete vhd; return INVALID_DATA; }
+	for (auto &entry : vhd->bat) entry = SDL_SwapBE32(entry);
 
 	//try loading the first block
 	if (!vhd->loadBlock(0)) {
@@ -390,16 +397,39 @@ imageDiskVHD::ErrorCodes imageDiskVHD::TryOpenParent(const char* childFileName,
 
 uint8_t imageDiskVHD::Read_AbsoluteSector(uint32_t sectnum, void * data) {
     if(vhdType == VHD_TYPE_FIXED) return fixedDisk->Read_AbsoluteSector(sectnum, data);
+	//sequential reads mostly come from the run read ahead by an earlier call
+	if ((sectnum - readAheadStart) < readAheadCount) {
+		memcpy(data, &readAhead[(sectnum - readAheadStart) * 512u], 512);
+		return 0;
+	}
 	uint32_t blockNumber = sectnum / sectorsPerBlock;
 	uint32_t sectorOffset = sectnum % sectorsPerBlock;
+	//sectors of blocks this image never allocated come straight from the parent, no bitmap needed
+	if (blockNumber < bat.size() && bat[blockNumber] == 0xFFFFFFFFul) {
+		if (parentDisk) return parentDisk->Read_AbsoluteSector(sectnum, data);
+		memset(data, 0, 512);
+		return 0;
+	}
 	if (!loadBlock(blockNumber)) return 0x05; //can't load block
 	if (currentBlockAllocated) {
 		uint32_t byteNum = sectorOffset / 8;
 		uint32_t bitNum = sectorOffset % 8;
 		bool hasData = currentBlockDirtyMap[byteNum] & (1 << (7 - bitNum));
 		if (hasData) {
+			//read the whole run of sectors present in this block with one fread
+			uint32_t count = 1;
+			while (count < readAheadMaxSectors && (sectorOffset + count) < sectorsPerBlock) {
+				uint32_t next = sectorOffset + count;
+				if (!(currentBlockDirtyMap[next / 8] & (1 << (7 - (next % 8))))) break;
+				count++;
+			}
+			readAheadCount = 0;
+			readAhead.resize(count * 512u);
 			if (fseeko64(diskimg, (off_t)(((uint64_t)currentBlockSectorOffset + blockMapSectors + sectorOffset) * 512ull), SEEK_SET)) return 0x05; //can't seek
-			if (fread(data, sizeof(uint8_t), 512, diskimg) != 512) return 0x05; //can't read
+			if (fread(readAhead.data(), sizeof(uint8_t), count * 512u, diskimg) != count * 512u) return 0x05; //can't read
+			readAheadStart = sectnum;
+			readAheadCount = count;
+			memcpy(data, readAhead.data(), 512);
 			return 0;
 		}
 	}
@@ -422,7 +452,8 @@ bool imageDiskVHD::is_zeroed_sector(const void* data) {
 }
 
 bool imageDiskVHD::is_block_allocated(uint32_t blockNumber) {
-    if(currentBlockAllocated) return true;
+    if(vhdType == VHD_TYPE_FIXED) return true;
+    if(blockNumber < bat.size() && bat[blockNumber] != 0xFFFFFFFFul) return true;
     if(parentDisk && ((imageDiskVHD*) parentDisk)->is_block_allocated(blockNumber)) return true;
     return false;
 }
@@ -457,36 +488,40 @@ uint8_t imageDiskVHD::Write_AbsoluteSector(uint32_t sectnum, const void * data)
 		//save the new block location and new footer position
 		uint32_t newBlockSectorNumber = (uint32_t)((footerPosition + 511ul) / 512ul);
 		footerPosition = newFooterPosition;
-		//clear the dirty flags for the new footer position
-		for (uint32_t i = 0; i < blockMapSize; i++) currentBlockDirtyMap[i] = 0;
+		//start the new block with a clear dirty map
+		BlockMap* bm = getBlockMap(blockNumber, newBlockSectorNumber, false);
+		if (!bm) return 0x05;
 		//write the dirty map
-		if (fseeko64(diskimg, (off_t)(newBlockSectorNumber * 512ull), SEEK_SET)) return 0x05;
-		if (fwrite(currentBlockDirtyMap, sizeof(uint8_t), blockMapSize, diskimg) != blockMapSize) return 0x05;
+		if (!writeBlockMap(*bm)) return 0x05;
 		//flush the data to disk after expanding the file, before allocating the block in the BAT
 		if (fflush(diskimg)) return 0x05;
 		//update the BAT
 		if (fseeko64(diskimg, (off_t)(dynamicHeader.tableOffset + (blockNumber * 4ull)), SEEK_SET)) return 0x05;
 		uint32_t newBlockSectorNumberBE = SDL_SwapBE32(newBlockSectorNumber);
 		if (fwrite(&newBlockSectorNumberBE, sizeof(uint8_t), 4, diskimg) != 4) return false;
+		bat[blockNumber] = newBlockSectorNumber;
 		currentBlockAllocated = true;
 		currentBlockSectorOffset = newBlockSectorNumber;
+		currentBlockMap = bm;
+		currentBlockDirtyMap = bm->map.data();
 		//flush the data to disk after allocating a block
 		if (fflush(diskimg)) return 0x05;
 	}
 	//current block has now been allocated
+	//write the sector
+	if (fseeko64(diskimg, (off_t)(((uint64_t)currentBlockSectorOffset + (uint64_t)blockMapSectors + (uint64_t)sectorOffset) * 512ull), SEEK_SET)) return 0x05; //can't seek
+	if (fwrite(data, sizeof(uint8_t), 512, diskimg) != 512) return 0x05; //can't write
+	if ((sectnum - readAheadStart) < readAheadCount)
+		memcpy(&readAhead[(sectnum - readAheadStart) * 512u], data, 512);
 	uint32_t byteNum = sectorOffset / 8;
 	uint32_t bitNum = sectorOffset % 8;
 	bool hasData = currentBlockDirtyMap[byteNum] & (1 << (7 - bitNum));
-	//if the sector hasn't been marked as dirty, mark it as dirty
+	//if the sector hasn't been marked as dirty, mark it as dirty, the cache writes the map back later
 	if (!hasData) {
 		currentBlockDirtyMap[byteNum] |= 1 << (7 - bitNum);
-		if (fseeko64(diskimg, (off_t)(currentBlockSectorOffset * 512ull), SEEK_SET)) return 0x05; //can't seek
-		if (fwrite(currentBlockDirtyMap, sizeof(uint8_t), blockMapSize, diskimg) != blockMapSize) return 0x05;
+		currentBlockMap->dirty = true;
+		noteDirtyMap();
 	}
-	//current sector has now been marked as dirty
-	//write the sector
-	if (fseeko64(diskimg, (off_t)(((uint64_t)currentBlockSectorOffset + (uint64_t)blockMapSectors + (uint64_t)sectorOffset) * 512ull), SEEK_SET)) return 0x05; //can't seek
-	if (fwrite(data, sizeof(uint8_t), 512, diskimg) != 512) return 0x05; //can't write
 	return 0;
 }
 
@@ -506,31 +541,117 @@ imageDiskVHD::VHDTypes imageDiskVHD::GetVHDType(const char* fileName) {
 
 bool imageDiskVHD::loadBlock(const uint32_t blockNumber) {
 	if (currentBlock == blockNumber) return true;
-	if (blockNumber >= dynamicHeader.maxTableEntries) return false;
-	if (fseeko64(diskimg, (off_t)(dynamicHeader.tableOffset + (blockNumber * 4ull)), SEEK_SET)) return false;
-	uint32_t blockSectorOffset;
-	if (fread(&blockSectorOffset, sizeof(uint8_t), 4, diskimg) != 4) return false;
-	blockSectorOffset = SDL_SwapBE32(blockSectorOffset);
+	if (blockNumber >= bat.size()) return false;
+	uint32_t blockSectorOffset = bat[blockNumber];
 	if (blockSectorOffset == 0xFFFFFFFFul) {
 		currentBlock = blockNumber;
 		currentBlockAllocated = false;
+		currentBlockMap = nullptr;
+		currentBlockDirtyMap = nullptr;
 	}
 	else {
-		if (fseeko64(diskimg, (off_t)(blockSectorOffset * (uint64_t)512), SEEK_SET)) return false;
 		currentBlock = 0xFFFFFFFFul;
+		BlockMap* bm = getBlockMap(blockNumber, blockSectorOffset, true);
+		if (!bm) return false;
 		currentBlockAllocated = true;
 		currentBlockSectorOffset = blockSectorOffset;
-		if (fread(currentBlockDirtyMap, sizeof(uint8_t), blockMapSize, diskimg) != blockMapSize) return false;
+		currentBlockMap = bm;
+		currentBlockDirtyMap = bm->map.data();
 		currentBlock = blockNumber;
 	}
 	return true;
 }
 
+//returns the cached dirty map of a block, loading it from the image (or starting it clear) if needed
+imageDiskVHD::BlockMap* imageDiskVHD::getBlockMap(const uint32_t blockNumber, const uint32_t blockSectorOffset, const bool load) {
+	auto i = blockMapIndex.find(blockNumber);
+	if (i != blockMapIndex.end()) {
+		blockMaps.splice(blockMaps.begin(), blockMaps, i->second);
+		return &blockMaps.front();
+	}
+	//make room, the least recently used map goes last
+	if (blockMaps.size() >= blockMapCacheSize) {
+		BlockMap& old = blockMaps.back();
+		if (old.dirty && !writeBlockMap(old)) return nullptr;
+		blockMapIndex.erase(old.block);
+		blockMaps.pop_back();
+	}
+	BlockMap bm;
+	bm.block = blockNumber;
+	bm.sectorOffset = blockSectorOffset;
+	bm.map.assign(blockMapSize, 0);
+	if (load) {
+		if (fseeko64(diskimg, (off_t)(blockSectorOffset * (uint64_t)512), SEEK_SET)) return nullptr;
+		if (fread(bm.map.data(), sizeof(uint8_t), blockMapSize, diskimg) != blockMapSize) return nullptr;
+	}
+	blockMaps.push_front(std::move(bm));
+	blockMapIndex[blockNumber] = blockMaps.begin();
+	return &blockMaps.front();
+}
+
+bool imageDiskVHD::writeBlockMap(BlockMap& bm) {
+	if (fseeko64(diskimg, (off_t)(bm.sectorOffset * 512ull), SEEK_SET)) return false;
+	if (fwrite(bm.map.data(), sizeof(uint8_t), blockMapSize, diskimg) != blockMapSize) return false;
+	bm.dirty = false;
+	return true;
+}
+
+//disks with maps changed since their last periodic flush
+static std::set<imageDiskVHD*> vhd_unflushed;
+//loading a saved state replaces the tick handlers, with or without FlushTick,
+//so whether it still runs is told by when it last did
+static bool vhd_flush_ticking = false;
+static Bitu vhd_flush_last_run = 0;
+
+//a sector written without its bit in the map is lost if the emulator goes away,
+//so do not leave changed maps in the cache for long
+void imageDiskVHD::noteDirtyMap() {
+	if (vhd_unflushed.insert(this).second) mapsDirtySince = PIC_Ticks;
+	if (!vhd_flush_ticking || (PIC_Ticks - vhd_flush_last_run) > 1) {
+		TIMER_DelTickHandler(FlushTick);
+		TIMER_AddTickHandler(FlushTick);
+		vhd_flush_ticking = true;
+		vhd_flush_last_run = PIC_Ticks;
+	}
+}
+
+void imageDiskVHD::FlushTick(void) {
+	vhd_flush_last_run = PIC_Ticks;
+	for (auto i = vhd_unflushed.begin(); i != vhd_unflushed.end();) {
+		imageDiskVHD* vhd = *i;
+		if ((PIC_Ticks - vhd->mapsDirtySince) < mapFlushTicks) {
+			++i;
+			continue;
+		}
+		if (!vhd->FlushBlockMaps())
+			LOG_MSG("VHD: could not write back the sector bitmaps of %s", vhd->diskname.c_str());
+		i = vhd_unflushed.erase(i);
+	}
+	if (vhd_unflushed.empty()) {
+		TIMER_DelTickHandler(FlushTick);
+		vhd_flush_ticking = false;
+	}
+}
+
+//writes back all dirty maps held in the cache
+bool imageDiskVHD::FlushBlockMaps() {
+	bool ok = true;
+	for (auto &bm : blockMaps) {
+		if (bm.dirty && !writeBlockMap(bm)) ok = false;
+	}
+	if (diskimg && fflush(diskimg)) ok = false;
+	return ok;
+}
+
 imageDiskVHD::~imageDiskVHD() {
-	if (currentBlockDirtyMap) {
-		free(currentBlockDirtyMap);
-		currentBlockDirtyMap = nullptr;
+	if (vhd_unflushed.erase(this) && vhd_unflushed.empty()) {
+		TIMER_DelTickHandler(FlushTick);
+		vhd_flush_ticking = false;
 	}
+	if (!FlushBlockMaps())
+		LOG_MSG("VHD: could not write back the sector bitmaps of %s", diskname.c_str());
+	currentBlockMap = nullptr;
+	currentBlockDirtyMap = nullptr;
 	if (parentDisk) {
 		parentDisk->Release();
 		parentDisk = nullptr;
@@ -913,10 +1034,7 @@ uint32_t imageDiskVHD::GetInfo(VHDInfo* info) {
     if(vhdType != VHD_TYPE_FIXED) {
         info->blockSize = dynamicHeader.blockSize;
         info->totalBlocks = dynamicHeader.maxTableEntries;
-        fseeko64(diskimg, dynamicHeader.tableOffset, SEEK_SET);
-        for(int i = 0; i < info->totalBlocks; i++) {
-            uint32_t n;
-            if(fread(&n, 1, 4, diskimg) != 4) return ERROR_OPENING;
+        for(const auto &n : bat) {
             if(n != 0xFFFFFFFF) info->allocatedBlocks++;
         }
     }
@@ -962,11 +1080,8 @@ bool imageDiskVHD::MergeSnapshot(uint32_t* totalSectorsMerged, uint32_t* totalBl
     *totalSectorsMerged = 0;
     *totalBlocksUpdated = 0;
     for(uint32_t block = 0; block < dynamicHeader.maxTableEntries; block++) {
-        uint32_t n;
-        fseeko64(diskimg, dynamicHeader.tableOffset+block*4, SEEK_SET);
-        if(fread(&n, 1, 4, diskimg) != 4) { return false; }
-        if(n == 0xFFFFFFFF) continue;
-        loadBlock(block);
+        if(bat[block] == 0xFFFFFFFF) continue;
+        if(!loadBlock(block)) return false;
         bool blockUpdated = false;
         //scan bitmap
         for(uint32_t sector = 0; sector < sectorsPerBlock; sector++) {
@@ -989,6 +1104,11 @@ bool imageDiskVHD::MergeSnapshot(uint32_t* totalSectorsMerged, uint32_t* totalBl
         }
         if(blockUpdated) (*totalBlocksUpdated)++;
     }
+    imageDiskVHD* parentVHD = dynamic_cast<imageDiskVHD*>(parentDisk);
+    if(parentVHD && !parentVHD->FlushBlockMaps()) {
+        LOG_MSG("Couldn't write back parent's sector bitmaps, merging aborted!");
+        return false;
+    }
     LOG_MSG("Merged %d sectors in %d blocks", *totalSectorsMerged, *totalBlocksUpdated);
     if (! ((imageDiskVHD*)parentDisk)->UpdateUUID() )
         LOG_MSG("Warning: parent UUID not updated, invalid children might remain!");
@@ -1001,6 +1121,8 @@ uint32_t imageDiskVHD::CreateSnapshot() {
     mk_uuid(buf);
     char name[255];
     sprintf(name, "{%08x-%08x-%08x-%08x}.vhd", *((uint32_t*)(buf)), *((uint32_t*)(buf+4)), *((uint32_t*)(buf+8)), *((uint32_t*)(buf+12)));
+    //the snapshot opens this image as its parent, it has to see every sector written so far
+    if(vhdType != VHD_TYPE_FIXED && !FlushBlockMaps()) return ERROR_WRITING;
     uint32_t ret = CreateDifferencing(name, diskname.c_str());
     return ret;
 }
@@ -1115,3 +1237,6 @@ uint64_t imageDiskVHD::scanMBR(uint8_t* mbr, Bitu sizes[], uint64_t disksize) {
 
     return lba;
 }
+
+//save state support
+void *VHD_FlushTick_PIC_Timer = (void*)((uintptr_t)imageDiskVHD::FlushTick);
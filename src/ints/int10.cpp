@@ -1644,7 +1644,6 @@ fail:
 }
 
 extern VideoModeBlock PC98_Mode;
-extern uint8_t pc98_freecg_sbcs[256 * 16];
 
 void Load_JFont_As_PC98(bool &sbcs_ok, bool &dbcs_ok) {
     unsigned int hibyte,lowbyte,r,o,i,i1,i2;
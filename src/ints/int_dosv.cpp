@@ -1233,7 +1233,7 @@ uint8_t *GetDbcsFont(Bitu code)
 					if (c==code) {
 						memcpy(&jfont_dbcs_16[code * 32], JPNZN16X+p, 32);
 						jfont_cache_dbcs_16[code] = 1;
-						return JPNZN16X+p;
+						return &jfont_dbcs_16[code * 32];
 					}
 					p+=32;
 				}
@@ -1334,7 +1334,7 @@ uint8_t *GetDbcs14Font(Bitu code, bool &is14)
                         memcpy(&jfont_dbcs_14[code * 28], SHMZN14X+p, 28);
                         jfont_cache_dbcs_14[code] = 1;
                         is14 = true;
-                        return SHMZN14X+p;
+                        return &jfont_dbcs_14[code * 28];
                     }
                     p+=28;
                 }
@@ -25,6 +25,14 @@
 #include "logging.h"
 #include "support.h" /* strcasecmp */
 #include <cstring>
+#include <algorithm>
+#include <chrono>
+
+#ifndef WIN32
+#include <sys/select.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 extern std::string niclist;
 
@@ -130,6 +138,15 @@ PcapEthernetConnection::PcapEthernetConnection()
 
 PcapEthernetConnection::~PcapEthernetConnection()
 {
+	if(io_thread.joinable()) {
+		io_stop = true;
+		Wake();
+		io_thread.join();
+	}
+#ifndef WIN32
+	if(wake_fds[0] >= 0) close(wake_fds[0]);
+	if(wake_fds[1] >= 0) close(wake_fds[1]);
+#endif
 	if(adhandle) pcap_close(adhandle);
 }
 
@@ -251,26 +268,101 @@ bool PcapEthernetConnection::Initialize(Section* config)
 	pcap_freealldevs(alldevs);
 #ifndef WIN32
 	pcap_setnonblock(adhandle,1,errbuf);
+	if(pipe(wake_fds) != 0) wake_fds[0] = wake_fds[1] = -1;
+	else {
+		fcntl(wake_fds[0], F_SETFL, fcntl(wake_fds[0], F_GETFL) | O_NONBLOCK);
+		fcntl(wake_fds[1], F_SETFL, fcntl(wake_fds[1], F_GETFL) | O_NONBLOCK);
+	}
 #endif
+	io_thread = std::thread(&PcapEthernetConnection::Run, this);
 	return true;
 }
 
 void PcapEthernetConnection::SendPacket(const uint8_t* packet, int len)
 {
-	int ret = pcap_sendpacket(adhandle, packet, len);
-	if(ret) LOG_MSG("PCAP error: %s", pcap_geterr(adhandle));
+	if(!tx_queue.Push(packet, len))
+		LOG(LOG_MISC,LOG_DEBUG)("PCAP: Send queue full, dropping frame");
+	Wake();
 }
 
 void PcapEthernetConnection::GetPackets(std::function<void(const uint8_t*, int)> callback)
 {
-	int res;
+	if(!rx_queue.Empty()) rx_queue.Drain(callback);
+}
+
+void PcapEthernetConnection::Wake()
+{
+#ifndef WIN32
+	if(wake_fds[1] >= 0)
+	{
+		const char c = 0;
+		/* A full pipe is fine, the thread is going to wake up anyway */
+		if(write(wake_fds[1], &c, 1) < 0) { }
+	}
+#endif
+}
+
+void PcapEthernetConnection::Run()
+{
 	struct pcap_pkthdr *header;
 	u_char *pkt_data;
-//#if 0
-	while((res = pcap_next_ex( adhandle, &header, (const u_char **)&pkt_data)) > 0) {
-		callback(pkt_data, header->len);
+	/* After a receive error the device is left alone for a second, it stays
+	 * readable and would otherwise keep this thread busy */
+	std::chrono::steady_clock::time_point rx_retry;
+	bool rx_failed = false;
+#if !defined(WIN32) && !defined(MACOSX)
+	const int pcap_fd = pcap_get_selectable_fd(adhandle);
+#endif
+
+	while(!io_stop) {
+		tx_queue.Drain([this](const uint8_t* packet, int len)
+		{
+			if(pcap_sendpacket(adhandle, packet, len))
+				LOG_MSG("PCAP error: %s", pcap_geterr(adhandle));
+		});
+
+		if(!rx_failed || std::chrono::steady_clock::now() >= rx_retry) {
+			int ret;
+			while((ret = pcap_next_ex( adhandle, &header, (const u_char **)&pkt_data)) > 0) {
+				/* Like a real NIC with a full ring, drop what the guest doesn't pick up in time */
+				rx_queue.Push(pkt_data, header->len);
+			}
+			if(ret < 0) {
+				if(!rx_failed) LOG_MSG("PCAP error: %s, retrying every second", pcap_geterr(adhandle));
+				rx_failed = true;
+				rx_retry = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+			}
+			else if(rx_failed) {
+				LOG_MSG("PCAP: Receiving again");
+				rx_failed = false;
+			}
+		}
+
+#ifndef WIN32
+#ifndef MACOSX
+		/* BPF on macOS only becomes readable once its buffer fills or the read
+		 * timeout passes, so it is polled below like on Windows */
+		if(pcap_fd >= 0 && wake_fds[0] >= 0) {
+			fd_set readfds;
+			FD_ZERO(&readfds);
+			if(!rx_failed) FD_SET(pcap_fd, &readfds);
+			FD_SET(wake_fds[0], &readfds);
+			struct timeval timeout;
+			timeout.tv_sec = 0;
+			timeout.tv_usec = 100000;
+			if(select(std::max(pcap_fd, wake_fds[0]) + 1, &readfds, NULL, NULL, &timeout) > 0 &&
+				FD_ISSET(wake_fds[0], &readfds)) {
+				char buf[64];
+				while(read(wake_fds[0], buf, sizeof(buf)) > 0) { }
+			}
+			continue;
+		}
+#endif
+		usleep(1000);
+#else
+		Sleep(1);
+#endif
 	}
-//#endif
 }
 
 #endif
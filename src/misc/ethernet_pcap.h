@@ -24,6 +24,8 @@
 #if C_PCAP
 
 #include "ethernet.h"
+#include <atomic>
+#include <thread>
 
 #ifdef WIN32
 #define HAVE_REMOTE
@@ -47,7 +49,26 @@ class PcapEthernetConnection : public EthernetConnection {
 		void GetPackets(std::function<void(const uint8_t*, int)> callback) override;
 
 	private:
+		/* The I/O thread, the only user of the pcap handle once started */
+		void Run();
+		void Wake();
+
 		pcap_t* adhandle = nullptr; /*!< The pcap handle used for this device */
+
+		/** Frames between the emulation thread and the I/O thread
+		 * A pcap handle may not be used from two threads at once, so the
+		 * frames the guest sends are queued and the I/O thread woken up
+		 * to send them. The I/O thread sleeps until the device has frames
+		 * or the guest sends one, so the emulation thread no longer needs
+		 * to make a syscall every tick to find out there is nothing.
+		 */
+		EthernetFrameQueue rx_queue; /*!< device to guest */
+		EthernetFrameQueue tx_queue; /*!< guest to device */
+		std::thread io_thread;
+		std::atomic<bool> io_stop = {false};
+#ifndef WIN32
+		int wake_fds[2] = { -1, -1 }; /*!< Pipe to wake the I/O thread from select() */
+#endif
 };
 
 #endif
@@ -94,6 +94,8 @@ int inet_pton_win(int af, const char* src, void* dst)
 #else /* !WIN32 */
 #include <arpa/inet.h>
 #include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif /* WIN32 */
 
 /* Begin boilerplate to map libslirp's C-based callbacks to our C++
@@ -196,6 +198,16 @@ SlirpEthernetConnection::SlirpEthernetConnection()
 
 SlirpEthernetConnection::~SlirpEthernetConnection()
 {
+	if(io_thread.joinable())
+	{
+		io_stop = true;
+		Wake();
+		io_thread.join();
+	}
+#ifndef WIN32
+	if(wake_fds[0] >= 0) close(wake_fds[0]);
+	if(wake_fds[1] >= 0) close(wake_fds[1]);
+#endif
 	if(slirp) slirp_cleanup(slirp);
 }
 
@@ -245,6 +257,19 @@ bool SlirpEthernetConnection::Initialize(Section* dosbox_config)
 		ClearPortForwards(is_udp, forwarded_udp_ports);
 		forwarded_udp_ports = SetupPortForwards(is_udp, section->Get_string("udp_port_forwards"));
 
+#ifndef WIN32
+		if(pipe(wake_fds) == 0)
+		{
+			fcntl(wake_fds[0], F_SETFL, fcntl(wake_fds[0], F_GETFL) | O_NONBLOCK);
+			fcntl(wake_fds[1], F_SETFL, fcntl(wake_fds[1], F_GETFL) | O_NONBLOCK);
+		}
+		else
+		{
+			wake_fds[0] = wake_fds[1] = -1;
+		}
+#endif
+		io_thread = std::thread(&SlirpEthernetConnection::Run, this);
+
 		LOG_MSG("SLIRP: Successfully initialized");
         niclist = "You have currently enabled the slirp backend for NE2000 Ethernet emulation.\nTo show a list of network interfaces please enable the pcap backend instead.\nCheck [ne2000] and [ethernet, pcap] sections of the DOSBox-X configuration.";
 		return true;
@@ -387,24 +412,68 @@ std::map<int, int> SlirpEthernetConnection::SetupPortForwards(const bool is_udp,
 
 void SlirpEthernetConnection::SendPacket(const uint8_t* packet, int len)
 {
-	slirp_input(slirp, packet, len);
+	if(!tx_queue.Push(packet, len))
+		LOG(LOG_MISC,LOG_DEBUG)("SLIRP: Send queue full, dropping frame");
+	Wake();
 }
 
 void SlirpEthernetConnection::GetPackets(std::function<void(const uint8_t*, int)> callback)
 {
-	get_packet_callback = callback;
-	uint32_t timeout_ms = 0;
-	PollsClear();
-	PollsAddRegistered();
-	slirp_pollfds_fill(slirp, &timeout_ms, slirp_add_poll, this);
-	bool poll_failed = !PollsPoll(timeout_ms);
-	slirp_pollfds_poll(slirp, poll_failed, slirp_get_revents, this);
-	TimersRun();
+	if(!rx_queue.Empty()) rx_queue.Drain(callback);
 }
 
 void SlirpEthernetConnection::ReceivePacket(const uint8_t* packet, int len)
 {
-	get_packet_callback(packet, len);
+	/* Like a real NIC with a full ring, drop what the guest doesn't pick up in time */
+	rx_queue.Push(packet, len);
+}
+
+void SlirpEthernetConnection::Wake()
+{
+#ifndef WIN32
+	if(wake_fds[1] >= 0)
+	{
+		const char c = 0;
+		/* A full pipe is fine, the thread is going to wake up anyway */
+		if(write(wake_fds[1], &c, 1) < 0) { }
+	}
+#endif
+}
+
+void SlirpEthernetConnection::Run()
+{
+	while(!io_stop)
+	{
+		tx_queue.Drain([this](const uint8_t* packet, int len)
+		{
+			slirp_input(slirp, packet, len);
+		});
+
+#ifndef WIN32
+		uint32_t timeout_ms = TimersNextTimeout(wake_fds[0] >= 0 ? 1000 : 1);
+#else
+		/* select() can't wait on anything but sockets, so Wake() is a no-op
+		 * and the guest's frames are picked up on the next millisecond */
+		uint32_t timeout_ms = TimersNextTimeout(1);
+#endif
+		PollsClear();
+#ifndef WIN32
+		int wake_idx = -1;
+		if(wake_fds[0] >= 0) wake_idx = PollAdd(wake_fds[0], SLIRP_POLL_IN);
+#endif
+		PollsAddRegistered();
+		slirp_pollfds_fill(slirp, &timeout_ms, slirp_add_poll, this);
+		bool poll_failed = !PollsPoll(timeout_ms);
+#ifndef WIN32
+		if(!poll_failed && wake_idx >= 0 && (polls[wake_idx].revents & POLLIN))
+		{
+			char buf[64];
+			while(read(wake_fds[0], buf, sizeof(buf)) > 0) { }
+		}
+#endif
+		slirp_pollfds_poll(slirp, poll_failed, slirp_get_revents, this);
+		TimersRun();
+	}
 }
 
 struct slirp_timer* SlirpEthernetConnection::TimerNew(SlirpTimerCb cb, void *cb_opaque)
@@ -419,7 +488,7 @@ struct slirp_timer* SlirpEthernetConnection::TimerNew(SlirpTimerCb cb, void *cb_
 
 void SlirpEthernetConnection::TimerFree(struct slirp_timer* timer)
 {
-	std::remove(timers.begin(), timers.end(), timer);
+	timers.remove(timer);
 	delete timer;
 }
 
@@ -442,6 +511,19 @@ void SlirpEthernetConnection::TimersRun()
 	});
 }
 
+uint32_t SlirpEthernetConnection::TimersNextTimeout(uint32_t max_ms)
+{
+	int64_t now = slirp_clock_get_ns(NULL);
+	int64_t timeout_ns = (int64_t)max_ms * 1000000;
+	std::for_each(timers.begin(), timers.end(), [now, &timeout_ns](struct slirp_timer*& timer)
+	{
+		if(timer->expires && (timer->expires - now) < timeout_ns)
+			timeout_ns = std::max<int64_t>(timer->expires - now, 0);
+	});
+	/* round up, TimersRun only fires timers that have expired */
+	return (uint32_t)((timeout_ns + 999999) / 1000000);
+}
+
 void SlirpEthernetConnection::TimersClear()
 {
 	std::for_each(timers.begin(), timers.end(), [](struct slirp_timer*& timer)
@@ -463,7 +545,7 @@ void SlirpEthernetConnection::PollRegister(int fd)
 
 void SlirpEthernetConnection::PollUnregister(int fd)
 {
-	std::remove(registered_fds.begin(), registered_fds.end(), fd);
+	registered_fds.remove(fd);
 }
 
 void SlirpEthernetConnection::PollsAddRegistered()
@@ -543,6 +625,12 @@ bool SlirpEthernetConnection::PollsPoll(uint32_t timeout_ms)
 	struct timeval timeout;
 	timeout.tv_sec = timeout_ms / 1000;
 	timeout.tv_usec = (timeout_ms % 1000) * 1000;
+	if(readfds.fd_count == 0 && writefds.fd_count == 0 && exceptfds.fd_count == 0)
+	{
+		/* select() fails right away without any sockets, wait out the timeout instead */
+		Sleep(timeout_ms);
+		return true;
+	}
 	int ret = select(0, &readfds, &writefds, &exceptfds, &timeout);
 	return (ret > -1);
 }
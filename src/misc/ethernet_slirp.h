@@ -25,8 +25,10 @@
 
 #include "ethernet.h"
 #include <slirp/libslirp.h>
+#include <atomic>
 #include <list>
 #include <map>
+#include <thread>
 
 /*
  * libslirp really wants a poll() API, so we'll use that when we're
@@ -66,7 +68,7 @@ class SlirpEthernetConnection : public EthernetConnection {
 		void SendPacket(const uint8_t* packet, int len) override;
 		void GetPackets(std::function<void(const uint8_t*, int)> callback) override;
 
-		/* Called by libslirp when it has a packet for us */
+		/* Called by libslirp when it has a packet for us, on the I/O thread */
 		void ReceivePacket(const uint8_t* packet, int len);
 
                 /* Called by libslirp to create, free and modify timers */
@@ -81,9 +83,14 @@ class SlirpEthernetConnection : public EthernetConnection {
 		void PollUnregister(int fd);
 
 	private:
+		/* The I/O thread, owns libslirp once started */
+		void Run();
+		void Wake();
+
 		/* Runs and clears all the timers */
 		void TimersRun();
 		void TimersClear();
+		uint32_t TimersNextTimeout(uint32_t max_ms);
 
 		void ClearPortForwards(const bool is_udp, std::map<int, int> &existing_port_forwards);
 		std::map<int, int> SetupPortForwards(const bool is_udp, const std::string &port_forward_rules);
@@ -98,15 +105,20 @@ class SlirpEthernetConnection : public EthernetConnection {
 		SlirpCb slirp_callbacks = { nullptr }; /*!< Callbacks used by libslirp */
 		std::list<struct slirp_timer*> timers; /*!< Stored timers */
 
-		/** The GetPacket callback
-		 * When libslirp has a new packet for us it calls ReceivePacket,
-		 * but the EthernetConnection interface requires users to poll
-		 * for new packets using GetPackets. We temporarily store the
-		 * callback from GetPackets here for ReceivePacket.
-		 * This might seem racy, but keep in mind we control when
-		 * libslirp sends us packets via our polling system.
+		/** Frames between the emulation thread and the I/O thread
+		 * All libslirp calls happen on the I/O thread, which sleeps in
+		 * poll() until a socket, a timer or the guest needs it. Frames
+		 * the guest sends are queued and the thread woken up, frames
+		 * libslirp produces are queued for GetPackets. When the
+		 * network is idle GetPackets costs a single atomic load.
 		 */
-		std::function<void(const uint8_t*, int)> get_packet_callback;
+		EthernetFrameQueue rx_queue; /*!< libslirp to guest */
+		EthernetFrameQueue tx_queue; /*!< guest to libslirp */
+		std::thread io_thread;
+		std::atomic<bool> io_stop = {false};
+#ifndef WIN32
+		int wake_fds[2] = { -1, -1 }; /*!< Pipe to wake the I/O thread from poll() */
+#endif
 
 		std::list<int> registered_fds; /*!< File descriptors to watch */
 
@@ -0,0 +1,365 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <set>
+#include <chrono>
+#include "dosbox.h"
+#include "logging.h"
+#include "control.h"
+#include "mapper.h"
+#include "bios_disk.h"
+#include "forkserver.h"
+#include "../dos/drives.h"
+
+#if defined(LINUX)
+#include <unistd.h>
+#include <errno.h>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+/* Request format, one connection per child:
+ *
+ *   command=<DOS command line>    run in the child shell, may be given more than once,
+ *                                 refused when forked from the mapper event
+ *   capture=<host directory>      capture directory of the child
+ *   <empty line or end of data>
+ *
+ * answered with "OK <pid>" or "ERR <reason>". A request consisting of "stop" ends
+ * the server, which then continues past the fork point and shuts down as usual. */
+
+extern std::string capturedir;
+
+void CAPTURE_Destroy(Section *sec);
+void CAPTURE_StopOPL(void);
+
+static bool forkserver_child = false;
+static bool forkserver_done = false;
+
+bool FORKSERVER_Enabled(void) {
+    return control != NULL && !control->opt_fork_server.empty() && !forkserver_child && !forkserver_done;
+}
+
+bool FORKSERVER_IsChild(void) {
+    return forkserver_child;
+}
+
+static unsigned int FORKSERVER_ThreadCount(void) {
+    unsigned int count = 0;
+    DIR *dir = opendir("/proc/self/task");
+    if (dir == NULL) return 0;
+    struct dirent *d;
+    while ((d = readdir(dir)) != NULL) {
+        if (d->d_name[0] != '.') count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+static void FORKSERVER_Reply(int fd, const std::string &msg) {
+    std::string line = msg + "\n";
+    const char *p = line.c_str();
+    size_t left = line.size();
+    while (left > 0) {
+        ssize_t r = write(fd, p, left);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        p += r;
+        left -= (size_t)r;
+    }
+}
+
+static void FORKSERVER_Reap(void) {
+    int status;
+    pid_t pid;
+
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        if (WIFEXITED(status))
+            LOG_MSG("Fork server: child %d exited with code %d", (int)pid, WEXITSTATUS(status));
+        else if (WIFSIGNALED(status))
+            LOG_MSG("Fork server: child %d killed by signal %d", (int)pid, WTERMSIG(status));
+    }
+}
+
+/* read the request up to an empty line or end of data, a client that does not
+ * finish it in time is dropped so that it cannot hold up the server */
+static bool FORKSERVER_ReadRequest(int fd, std::string &req) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    char tmp[512];
+
+    req.clear();
+    while (req.size() < 65536) {
+        if (req == "\n" || req.find("\n\n") != std::string::npos) break;
+
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        const int p = poll(&pfd, 1, 100);
+        if (p < 0 && errno == EINTR) continue;
+        if (p < 0) return false;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            LOG_MSG("Fork server: dropped a client that did not finish its request");
+            return false;
+        }
+        if (p == 0) {
+            FORKSERVER_Reap();
+            continue;
+        }
+
+        ssize_t r = read(fd, tmp, sizeof(tmp));
+        if (r < 0 && errno == EINTR) continue;
+        if (r < 0) return false;
+        if (r == 0) break;
+        req.append(tmp, (size_t)r);
+    }
+
+    return true;
+}
+
+/* every image backed disk, drives over a host directory and RAM disks live in
+ * the copy on write memory of the child and need nothing */
+static void FORKSERVER_ImageDisks(std::set<imageDisk*> &disks) {
+    for (unsigned int i=0;i < MAX_DISK_IMAGES;i++) {
+        if (imageDiskList[i] != NULL) disks.insert(imageDiskList[i]);
+    }
+    for (unsigned int i=0;i < MAX_SWAPPABLE_DISKS;i++) {
+        if (diskSwap[i] != NULL) disks.insert(diskSwap[i]);
+    }
+    for (unsigned int i=0;i < DOS_DRIVES;i++) {
+        fatDrive *fdp = dynamic_cast<fatDrive*>(Drives[i]);
+        if (fdp != NULL && fdp->loadedDisk != NULL) disks.insert(fdp->loadedDisk);
+    }
+
+    for (auto i = disks.begin(); i != disks.end();) {
+        imageDisk *disk = *i;
+        if (disk->ffdd != NULL || disk->class_id == imageDisk::ID_EMPTY_DRIVE || disk->class_id == imageDisk::ID_MEMORY)
+            i = disks.erase(i);
+        else
+            ++i;
+    }
+}
+
+/* Children would all write into the same file through a disk that cannot be made
+ * private (VHD, qcow2, ...), so the server refuses to fork while one is mounted */
+static bool FORKSERVER_CanPrivatizeDisks(std::string &name) {
+    std::set<imageDisk*> disks;
+
+    FORKSERVER_ImageDisks(disks);
+    for (auto &disk : disks) {
+        if (!disk->Can_Fork_Private()) {
+            name = disk->diskname;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Give every image backed disk of the child its own file handle and in memory
+ * write overlay, so children neither share the file offset of the inherited
+ * FILE nor write into the image the other children are reading. */
+static bool FORKSERVER_PrivatizeDisks(void) {
+    std::set<imageDisk*> disks;
+
+    FORKSERVER_ImageDisks(disks);
+    for (auto &disk : disks) {
+        if (!disk->Fork_Private()) {
+            LOG_MSG("Fork server: cannot make disk image %s private to the child",disk->diskname.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FORKSERVER_RESULT FORKSERVER_Run(std::string &command, bool with_commands) {
+    command.clear();
+    if (!FORKSERVER_Enabled()) return FORKSERVER_FAILED;
+
+    const std::string &path = control->opt_fork_server;
+    struct sockaddr_un addr;
+
+    if (path.size() >= sizeof(addr.sun_path)) {
+        LOG_MSG("Fork server: socket path %s is too long",path.c_str());
+        forkserver_done = true;
+        return FORKSERVER_FAILED;
+    }
+
+    int lfd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (lfd < 0) {
+        LOG_MSG("Fork server: socket() failed, %s",strerror(errno));
+        forkserver_done = true;
+        return FORKSERVER_FAILED;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path.c_str());
+    unlink(path.c_str());
+    if (bind(lfd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(lfd, 16) < 0) {
+        LOG_MSG("Fork server: cannot listen on %s, %s",path.c_str(),strerror(errno));
+        close(lfd);
+        forkserver_done = true;
+        return FORKSERVER_FAILED;
+    }
+
+    /* fork() only carries the calling thread into the child */
+    if (FORKSERVER_ThreadCount() > 1)
+        LOG_MSG("Fork server: %u threads are running, they will not exist in the children. Use a headless setup (SDL_VIDEODRIVER=dummy, -nosound) and no threaded devices",FORKSERVER_ThreadCount());
+
+    LOG_MSG("Fork server: waiting for requests on %s",path.c_str());
+
+    while (true) {
+        struct pollfd pfd;
+        pfd.fd = lfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        FORKSERVER_Reap();
+        if (poll(&pfd, 1, 250) <= 0 || !(pfd.revents & POLLIN)) continue;
+
+        int cfd = accept4(lfd, NULL, NULL, SOCK_CLOEXEC);
+        if (cfd < 0) continue;
+
+        std::string req;
+        if (!FORKSERVER_ReadRequest(cfd, req)) {
+            close(cfd);
+            continue;
+        }
+
+        std::string cmd, capture;
+        bool stop = false;
+        size_t pos = 0;
+
+        while (pos < req.size()) {
+            size_t nl = req.find('\n', pos);
+            std::string line = req.substr(pos, (nl == std::string::npos ? req.size() : nl) - pos);
+            pos = (nl == std::string::npos) ? req.size() : nl + 1;
+
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty()) break;
+
+            if (line == "stop") stop = true;
+            else if (line.compare(0, 8, "command=") == 0) {
+                if (!cmd.empty()) cmd += '\n';
+                cmd += line.substr(8);
+            }
+            else if (line.compare(0, 8, "capture=") == 0) capture = line.substr(8);
+        }
+
+        if (stop) {
+            FORKSERVER_Reply(cfd, "OK");
+            close(cfd);
+            break;
+        }
+        if (!cmd.empty() && !with_commands) {
+            FORKSERVER_Reply(cfd, "ERR not forked from a DOS prompt, cannot run a command");
+            close(cfd);
+            continue;
+        }
+        std::string shared_disk;
+        if (!FORKSERVER_CanPrivatizeDisks(shared_disk)) {
+            FORKSERVER_Reply(cfd, "ERR disk image " + shared_disk + " cannot be kept private to a child");
+            close(cfd);
+            continue;
+        }
+
+        fflush(NULL); /* or the child writes out whatever the server had buffered too */
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            FORKSERVER_Reply(cfd, std::string("ERR ") + strerror(errno));
+            close(cfd);
+            continue;
+        }
+        if (pid == 0) {
+            close(cfd);
+            close(lfd);
+            forkserver_child = true;
+
+            if (!capture.empty()) capturedir = capture;
+            if (!FORKSERVER_PrivatizeDisks()) FORKSERVER_ExitChild(1);
+
+            LOG_MSG("Fork server: child %d started",(int)getpid());
+            command = cmd;
+            return FORKSERVER_CHILD;
+        }
+
+        FORKSERVER_Reply(cfd, "OK " + std::to_string((int)pid));
+        close(cfd);
+    }
+
+    close(lfd);
+    unlink(path.c_str());
+    forkserver_done = true;
+    LOG_MSG("Fork server: stopped");
+    return FORKSERVER_STOPPED;
+}
+
+void FORKSERVER_ExitChild(int code) {
+    CAPTURE_Destroy(NULL);
+    CAPTURE_StopOPL();
+    fflush(NULL);
+    _exit(code);
+}
+
+static void FORKSERVER_ForkPointEvent(bool pressed) {
+    if (!pressed) return;
+    if (!FORKSERVER_Enabled()) return;
+
+    /* a guest OS is running, there is no DOS shell to hand a command to */
+    std::string command;
+    if (FORKSERVER_Run(command, false) == FORKSERVER_STOPPED)
+        throw(0);
+}
+
+void FORKSERVER_Init(void) {
+    DOSBoxMenu::item *item;
+
+    if (control->opt_fork_server.empty()) return;
+
+    MAPPER_AddHandler(FORKSERVER_ForkPointEvent, MK_nothing, 0, "forkpoint", "Fork point", &item);
+    item->set_text("Start fork server");
+}
+#else
+bool FORKSERVER_Enabled(void) {
+    return false;
+}
+
+bool FORKSERVER_IsChild(void) {
+    return false;
+}
+
+FORKSERVER_RESULT FORKSERVER_Run(std::string &command, bool with_commands) {
+    (void)with_commands;
+    command.clear();
+    return FORKSERVER_FAILED;
+}
+
+void FORKSERVER_ExitChild(int code) {
+    exit(code);
+}
+
+void FORKSERVER_Init(void) {
+}
+#endif
@@ -25,6 +25,7 @@
 #include "support.h"
 
 #include <assert.h>
+#include <chrono>
 #include <fstream>
 #include <string>
 #include <sstream>
@@ -1159,18 +1160,55 @@ const char *GetVMEventName(enum vm_event event) {
     return VM_EVENT_string[event];
 }
 
+static const std::chrono::steady_clock::time_point startup_begin = std::chrono::steady_clock::now();
+static std::vector< std::pair<std::string,double> > startup_times;
+static bool startup_reported = false;
+
 void DispatchVMEvent(enum vm_event event) {
     assert(event < VM_EVENT_MAX);
 
     LOG(LOG_MISC,LOG_DEBUG)("Dispatching VM event %s",GetVMEventName(event));
 
+    const bool timed = control != NULL && control->opt_time_startup && !startup_reported;
+
     vm_dispatch_state.begin_event(event);
     for (std::list<Function_wrapper>::iterator i=vm_event_functions[event].begin();i!=vm_event_functions[event].end();++i) {
         LOG(LOG_MISC,LOG_DEBUG)("Calling event %s handler (%p) '%s'",GetVMEventName(event),(void*)((uintptr_t)((*i).function)),(*i).name.c_str());
-        (*i).function(NULL);
+        if (timed) {
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            (*i).function(NULL);
+            STARTUP_AddTime((std::string(GetVMEventName(event)) + ": " + (*i).name).c_str(),
+                std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - t0).count());
+        }
+        else {
+            (*i).function(NULL);
+        }
     }
 
     vm_dispatch_state.end_event();
+
+    if (timed && (event == VM_EVENT_DOS_INIT_SHELL_READY || event == VM_EVENT_GUEST_OS_BOOT))
+        STARTUP_Report();
+}
+
+void STARTUP_AddTime(const char *name,double ms) {
+    if (!startup_reported) startup_times.push_back(std::make_pair(std::string(name),ms));
+}
+
+void STARTUP_Report(void) {
+    if (startup_reported) return;
+    startup_reported = true;
+
+    double total = 0;
+    LOG_MSG("Startup timing (ms):");
+    for (std::vector< std::pair<std::string,double> >::const_iterator i=startup_times.begin();i!=startup_times.end();++i) {
+        LOG_MSG("  %9.3f  %s",i->second,i->first.c_str());
+        total += i->second;
+    }
+    LOG_MSG("  %9.3f  total of the above, %.3f since process start",total,
+        std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - startup_begin).count());
+    startup_times.clear();
+    startup_times.shrink_to_fit();
 }
 
 Config::~Config() {
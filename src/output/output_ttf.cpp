@@ -97,7 +97,7 @@ int switchoutput = -1;
 int checkcol = 0;
 
 static unsigned long ttfSize = sizeof(DOSBoxTTFbi), ttfSizeb = 0, ttfSizei = 0, ttfSizebi = 0;
-static void * ttfFont = DOSBoxTTFbi, * ttfFontb = NULL, * ttfFonti = NULL, * ttfFontbi = NULL;
+static const void * ttfFont = DOSBoxTTFbi, * ttfFontb = NULL, * ttfFonti = NULL, * ttfFontbi = NULL;
 extern int posx, posy, eurAscii, transparency, NonUserResizeCounter;
 extern bool rtl, gbk, chinasea, switchttf, force_conversion, blinking, showdbcs, loadlang, window_was_maximized;
 extern const char* RunningProgram;
@@ -299,12 +299,13 @@ bool setColors(const char *colorArray, int n) {
 	return true;
 }
 
-bool readTTFStyle(unsigned long& size, void*& font, FILE * fh) {
+bool readTTFStyle(unsigned long& size, const void*& font, FILE * fh) {
     long pos = ftell(fh);
     if (pos != -1L) {
         size = pos;
-        font = malloc((size_t)size);
-        if (font && !fseek(fh, 0, SEEK_SET) && fread(font, 1, (size_t)size, fh) == (size_t)size) {
+        void *buf = malloc((size_t)size);
+        font = buf;
+        if (buf && !fseek(fh, 0, SEEK_SET) && fread(buf, 1, (size_t)size, fh) == (size_t)size) {
             fclose(fh);
             return true;
         }
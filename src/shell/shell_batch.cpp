@@ -19,10 +19,12 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 
 #include "logging.h"
 #include "shell.h"
 #include "support.h"
+#include "timer.h"
 
 BatchFile::BatchFile(DOS_Shell * host,char const * const resolved_name,char const * const entered_name, char const * const cmd_line) {
 	location = 0;
@@ -48,14 +50,48 @@ BatchFile::~BatchFile() {
 	shell->echo=echo;
 }
 
+bool BatchFile::Refresh(void) {
+	/* Guest writes are caught by the generation counter, host side edits
+	 * by size and modification time where the drive can report them. The
+	 * host file is looked at no more than once a second, not for every line */
+	const uint32_t now = GetTicks();
+	if (loaded && loaded_generation == dos_file_generation && (now - host_checked) < 1000u)
+		return true;
+	host_checked = now;
+
+	struct stat status;
+	const bool have_stat = DOS_GetFileAttrEx(filename.c_str(), &status);
+	if (loaded && loaded_generation == dos_file_generation && have_stat == host_stat &&
+		(!have_stat || (host_size == (int64_t)status.st_size && host_mtime == (int64_t)status.st_mtime)))
+		return true;
+
+	if (!DOS_OpenFile(filename.c_str(),(DOS_NOT_INHERIT|OPEN_READ),&file_handle)) return false;
+	loaded_generation = dos_file_generation;
+	contents.clear();
+	uint8_t buffer[32768];
+	uint16_t n;
+	do {
+		n=sizeof(buffer);
+		if (!DOS_ReadFile(file_handle,buffer,&n)) break;
+		contents.insert(contents.end(),buffer,buffer+n);
+	} while (n==sizeof(buffer));
+	DOS_CloseFile(file_handle);
+
+	loaded = true;
+	host_stat = have_stat;
+	host_size = have_stat ? (int64_t)status.st_size : 0;
+	host_mtime = have_stat ? (int64_t)status.st_mtime : 0;
+	labels_valid = false;
+	return true;
+}
+
 bool BatchFile::ReadLine(char * line) {
-	//Open the batchfile and seek to stored position
-	if (!DOS_OpenFile(filename.c_str(),(DOS_NOT_INHERIT|OPEN_READ),&file_handle)) {
+	//Make sure the cached copy of the batchfile is current
+	if (!Refresh()) {
 		LOG(LOG_MISC,LOG_ERROR)("ReadLine Can't open BatchFile %s",filename.c_str());
 		delete this;
 		return false;
 	}
-	DOS_SeekFile(file_handle,&(this->location),DOS_SEEK_SET);
 
 	uint8_t c=0;uint16_t n=1;
 	char temp[CMD_MAXLINE];
@@ -63,14 +99,13 @@ bool BatchFile::ReadLine(char * line) {
 emptyline:
 	char * cmd_write=temp;
 	do {
-		n=1;
-		DOS_ReadFile(file_handle,&c,&n);
+		n=(this->location<contents.size())?1:0;
 		if (n>0) {
+			c=contents[this->location++];
 			if (c==0x1a) {
 				// Stop at EOF character
 				n=0;
-				this->location=0;
-				DOS_SeekFile(file_handle,&(this->location),DOS_SEEK_END);
+				this->location=(uint32_t)contents.size();
 				break;
 			}
 			/* Why are we filtering this ?
@@ -91,8 +126,7 @@ emptyline:
 	} while (c!='\n' && n);
 	*cmd_write=0;
 	if (!n && cmd_write==temp) {
-		//Close file and delete bat file
-		DOS_CloseFile(file_handle);
+		//Delete bat file
 		delete this;
 		return false;	
 	}
@@ -181,74 +215,74 @@ emptyline:
 		}
 	}
 	*cmd_write = 0;
-	//Store current location and close bat file
-	this->location = 0;
-	DOS_SeekFile(file_handle,&(this->location),DOS_SEEK_CUR);
-	DOS_CloseFile(file_handle);
 	return true;	
 }
 
 bool BatchFile::Goto(const char * where) {
-	//Open bat file and search for the where string
-	if (!DOS_OpenFile(filename.c_str(),128,&file_handle)) {
+	//Make sure the cached copy of the batchfile is current
+	if (!Refresh()) {
 		LOG(LOG_MISC,LOG_ERROR)("SHELL:Goto Can't open BatchFile %s",filename.c_str());
 		delete this;
 		return false;
 	}
 
-	char cmd_buffer[CMD_MAXLINE];
-	char * cmd_write;
-
-	/* Scan till we have a match or return false */
-	uint8_t c;uint16_t n;
-again:
-	cmd_write=cmd_buffer;
-	do {
-		n=1;
-		DOS_ReadFile(file_handle,&c,&n);
-		if (n>0) {
-			if (c>31) {
-				if (((cmd_write - cmd_buffer) + 1) < (CMD_MAXLINE - 1))
-					*cmd_write++ = (char)c;
-			} else if (c==0x1a) {
-				n = 0;
-				break;
-			} else if (c!=0x1b && c!='\t' && c!=7 && c!=8) {
-					if (c != '\n' && c != '\r')
-					LOG(LOG_MISC,LOG_DEBUG)("Encountered non-standard control character in batch file: Dec %03u and Hex %#04x.\n", c, c);
-			}
-		}
-	} while (c!='\n' && n);
-	*cmd_write++ = 0;
-	char *nospace = trim(cmd_buffer);
-	if (nospace[0] == ':') {
-		nospace++; //Skip :
-		//Strip spaces and = from it.
-		while(*nospace && (isspace(*reinterpret_cast<unsigned char*>(nospace)) || (*nospace == '=')))
-			nospace++;
+	/* Index all labels on the first GOTO after (re)loading the file,
+	 * the first occurrence of a label wins like with a scan from the top */
+	if (!labels_valid) {
+		labels.clear();
+		char cmd_buffer[CMD_MAXLINE];
+		char * cmd_write;
+		uint32_t pos = 0;
+		uint8_t c = 0;uint16_t n;
+		do {
+			cmd_write=cmd_buffer;
+			do {
+				n=(pos<contents.size())?1:0;
+				if (n>0) {
+					c=contents[pos++];
+					if (c>31) {
+						if (((cmd_write - cmd_buffer) + 1) < (CMD_MAXLINE - 1))
+							*cmd_write++ = (char)c;
+					} else if (c==0x1a) {
+						n = 0;
+						break;
+					} else if (c!=0x1b && c!='\t' && c!=7 && c!=8) {
+							if (c != '\n' && c != '\r')
+							LOG(LOG_MISC,LOG_DEBUG)("Encountered non-standard control character in batch file: Dec %03u and Hex %#04x.\n", c, c);
+					}
+				}
+			} while (c!='\n' && n);
+			*cmd_write++ = 0;
+			char *nospace = trim(cmd_buffer);
+			if (nospace[0] == ':') {
+				nospace++; //Skip :
+				//Strip spaces and = from it.
+				while(*nospace && (isspace(*reinterpret_cast<unsigned char*>(nospace)) || (*nospace == '=')))
+					nospace++;
 
-		//label is until space/=/eol
-		const char* beginlabel = nospace;
-		while(*nospace && !isspace(*reinterpret_cast<unsigned char*>(nospace)) && (*nospace != '=')) 
-			nospace++;
+				//label is until space/=/eol
+				char* beginlabel = nospace;
+				while(*nospace && !isspace(*reinterpret_cast<unsigned char*>(nospace)) && (*nospace != '='))
+					nospace++;
 
-		*nospace = 0;
-		if (strcasecmp(beginlabel,where)==0) {
-		//Found it! Store location and continue
-			this->location = 0;
-			DOS_SeekFile(file_handle,&(this->location),DOS_SEEK_CUR);
-			DOS_CloseFile(file_handle);
-			return true;
-		}
-	   
+				*nospace = 0;
+				upcase(beginlabel);
+				labels.insert(std::make_pair(std::string(beginlabel),pos));
+			}
+		} while (n);
+		labels_valid = true;
 	}
-	if (!n) {
-		DOS_CloseFile(file_handle);
+
+	std::string label = where;
+	upcase(label);
+	std::map<std::string,uint32_t>::const_iterator it = labels.find(label);
+	if (it == labels.end()) {
 		delete this;
-		return false;	
+		return false;
 	}
-	goto again;
-	return false;
+	//Found it! Store location and continue
+	this->location = it->second;
+	return true;
 }
 
 void BatchFile::Shift(void) {
@@ -0,0 +1,185 @@
+/* Offline merge tool for IMGMOUNT delta files (-o delta=file).
+
+   deltacommit delta                 show what the delta file holds
+   deltacommit delta image           write the clusters of the delta back into
+                                     image, which must be the base image the
+                                     delta was made against and a plain image
+                                     file (not VHD or qcow2)
+   deltacommit delta image output    write a merged copy of image and delta to
+                                     output, leaving both inputs untouched
+
+   Nothing may have the image or the delta mounted while this runs. After an
+   in place commit the delta file holds nothing new and can be deleted, it is
+   updated to match the committed image so it can also stay in use.
+
+   Build with "make src/tool/deltacommit", the file format is described in
+   include/diskdelta.h. */
+
+#define _FILE_OFFSET_BITS 64
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "diskdelta.h"
+
+using namespace std;
+
+static bool read_at(FILE *fp,uint64_t ofs,void *buf,size_t len) {
+	if (fseeko(fp,(off_t)ofs,SEEK_SET) != 0) return false;
+	return fread(buf,len,1,fp) == 1;
+}
+
+static bool write_at(FILE *fp,uint64_t ofs,const void *buf,size_t len) {
+	if (fseeko(fp,(off_t)ofs,SEEK_SET) != 0) return false;
+	return fwrite(buf,len,1,fp) == 1;
+}
+
+static uint64_t file_size(FILE *fp) {
+	if (fseeko(fp,0,SEEK_END) != 0) return 0;
+	return (uint64_t)ftello(fp);
+}
+
+static bool copy_file(FILE *src,FILE *dst,uint64_t size) {
+	vector<unsigned char> buf(1024u * 1024u);
+
+	if (fseeko(src,0,SEEK_SET) != 0 || fseeko(dst,0,SEEK_SET) != 0) return false;
+	while (size > 0) {
+		const size_t len = size < buf.size() ? (size_t)size : buf.size();
+		if (fread(buf.data(),len,1,src) != 1 || fwrite(buf.data(),len,1,dst) != 1) return false;
+		size -= len;
+	}
+
+	return true;
+}
+
+int main(int argc,char **argv) {
+	if (argc < 2 || argc > 4) {
+		fprintf(stderr,"deltacommit <delta file> [<base image> [<output image>]]\n");
+		return 1;
+	}
+
+	const char *delta_name = argv[1];
+	const char *base_name = argc > 2 ? argv[2] : NULL;
+	const char *out_name = argc > 3 ? argv[3] : NULL;
+
+	FILE *delta = fopen(delta_name,base_name != NULL && out_name == NULL ? "rb+" : "rb");
+	if (delta == NULL) {
+		fprintf(stderr,"Cannot open %s\n",delta_name);
+		return 1;
+	}
+
+	unsigned char hdrbuf[DISKDELTA_HEADER_SIZE];
+	DiskDeltaHeader hdr;
+	if (!read_at(delta,0,hdrbuf,sizeof(hdrbuf)) || !hdr.decode(hdrbuf) || !hdr.valid()) {
+		fprintf(stderr,"%s is not a delta file, or of an unsupported version\n",delta_name);
+		return 1;
+	}
+
+	vector<unsigned char> bitmap((size_t)hdr.bitmap_bytes());
+	if (!read_at(delta,hdr.bitmap_offset,bitmap.data(),bitmap.size())) {
+		fprintf(stderr,"Cannot read the bitmap of %s\n",delta_name);
+		return 1;
+	}
+
+	const uint64_t clusters = hdr.clusters();
+	uint64_t present = 0;
+	for (uint64_t c=0;c < clusters;c++) {
+		if ((bitmap[c >> 3u] >> (c & 7u)) & 1u) present++;
+	}
+
+	printf("%s: image of %llu bytes, %u byte clusters (%u byte sectors), %llu of %llu clusters changed\n",
+		delta_name,(unsigned long long)hdr.disk_size,(unsigned int)hdr.cluster_size,(unsigned int)hdr.sector_size,
+		(unsigned long long)present,(unsigned long long)clusters);
+
+	if (base_name == NULL) return 0;
+
+	if (hdr.base_format != DISKDELTA_BASE_FILE) {
+		fprintf(stderr,"%s was made over a VHD, qcow2 or other non plain image and cannot be merged\n",delta_name);
+		return 1;
+	}
+
+	FILE *base = fopen(base_name,out_name != NULL ? "rb" : "rb+");
+	if (base == NULL) {
+		fprintf(stderr,"Cannot open %s\n",base_name);
+		return 1;
+	}
+
+	/* the base image may carry a few stray bytes past the last whole kilobyte,
+	   and a header (NHD, HDI, FDI) in front of the disk */
+	const uint64_t base_size = file_size(base);
+	if (base_size < hdr.base_offset + hdr.disk_size || base_size >= hdr.base_offset + hdr.disk_size + 1024u) {
+		fprintf(stderr,"%s is %llu bytes, the delta was made for an image of %llu bytes after a %llu byte header\n",
+			base_name,(unsigned long long)base_size,(unsigned long long)hdr.disk_size,(unsigned long long)hdr.base_offset);
+		return 1;
+	}
+
+	vector<unsigned char> first(hdr.sector_size);
+	if (!read_at(base,hdr.base_offset,first.data(),first.size())) {
+		fprintf(stderr,"Cannot read %s\n",base_name);
+		return 1;
+	}
+	if (DiskDeltaHeader::checksum(first.data(),first.size()) != hdr.base_check) {
+		fprintf(stderr,"%s is not the image the delta was made against\n",base_name);
+		return 1;
+	}
+
+	FILE *target = base;
+	if (out_name != NULL) {
+		target = fopen(out_name,"wb");
+		if (target == NULL) {
+			fprintf(stderr,"Cannot create %s\n",out_name);
+			return 1;
+		}
+		if (!copy_file(base,target,base_size)) {
+			fprintf(stderr,"Cannot copy %s to %s\n",base_name,out_name);
+			return 1;
+		}
+	}
+
+	vector<unsigned char> buf(hdr.cluster_size);
+	for (uint64_t c=0;c < clusters;c++) {
+		if (!((bitmap[c >> 3u] >> (c & 7u)) & 1u)) continue;
+
+		const uint64_t start = c * hdr.cluster_size;
+		const size_t len = (size_t)((hdr.disk_size - start) < hdr.cluster_size ? (hdr.disk_size - start) : hdr.cluster_size);
+
+		if (!read_at(delta,hdr.data_offset + start,buf.data(),len)) {
+			fprintf(stderr,"Cannot read cluster %llu from %s\n",(unsigned long long)c,delta_name);
+			return 1;
+		}
+		if (!write_at(target,hdr.base_offset + start,buf.data(),len)) {
+			fprintf(stderr,"Cannot write cluster %llu to %s\n",(unsigned long long)c,out_name != NULL ? out_name : base_name);
+			return 1;
+		}
+	}
+
+	if (fflush(target) != 0) {
+		fprintf(stderr,"Cannot write %s\n",out_name != NULL ? out_name : base_name);
+		return 1;
+	}
+
+	printf("%llu clusters written to %s\n",(unsigned long long)present,out_name != NULL ? out_name : base_name);
+
+	/* the first sector of the base image may have changed with it */
+	if (target == base) {
+		if (!read_at(base,hdr.base_offset,first.data(),first.size())) {
+			fprintf(stderr,"Cannot read %s\n",base_name);
+			return 1;
+		}
+		hdr.base_check = DiskDeltaHeader::checksum(first.data(),first.size());
+		hdr.encode(hdrbuf);
+		if (!write_at(delta,0,hdrbuf,sizeof(hdrbuf)) || fflush(delta) != 0) {
+			fprintf(stderr,"Cannot update %s, it no longer matches %s\n",delta_name,base_name);
+			return 1;
+		}
+	}
+
+	if (target != base) fclose(target);
+	fclose(base);
+	fclose(delta);
+	return 0;
+}
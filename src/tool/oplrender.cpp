@@ -0,0 +1,468 @@
+
+/* Offline OPL capture renderer and emulator benchmark.
+
+   Plays back a DOSBox DRO (v2) or Rdos RAW OPL capture through one of the
+   OPL emulation cores used by DOSBox-X (DBOPL, Nuked OPL3 or ESFMu) without
+   starting the emulator, and writes the result to a 16-bit stereo WAV file.
+   With -bench nothing is written; instead each selected core renders the
+   capture as fast as it can and the throughput in samples per second is
+   reported, optionally with several copies running at once (-threads) to
+   see how a core scales across CPU cores.
+
+   Build with "make src/tool/oplrender" after the main build, the cores are
+   linked straight from the objects in src/hardware. */
+
+#include <stdint.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dbopl.h"
+#include "nukedopl.h"
+#include "esfmu/esfm.h"
+
+/* dbopl.cpp hands its output to the mixer in DBOPL::Handler::Generate, which
+   this tool never calls. Satisfy the linker without dragging in the mixer. */
+void MixerChannel::AddSamples_m32(Bitu len, const int32_t *data) {
+	(void)len; (void)data;
+}
+
+void MixerChannel::AddSamples_s32(Bitu len, const int32_t *data) {
+	(void)len; (void)data;
+}
+
+using namespace std;
+
+struct OplEvent {
+	uint64_t	frame;		/* sample frame at the capture rate (1 kHz for DRO) */
+	uint16_t	reg;
+	uint8_t		val;
+};
+
+struct OplCapture {
+	bool		opl3 = false;
+	double		tick_rate = 1000;	/* event frames per second */
+	uint64_t	length = 0;		/* total length in event frames */
+	vector<OplEvent> events;
+};
+
+static bool read_file(const char *path,vector<uint8_t> &buf) {
+	FILE *fp = fopen(path,"rb");
+	if (fp == NULL) return false;
+
+	uint8_t tmp[16384];
+	size_t rd;
+	while ((rd=fread(tmp,1,sizeof(tmp),fp)) > 0)
+		buf.insert(buf.end(),tmp,tmp+rd);
+
+	fclose(fp);
+	return true;
+}
+
+static inline uint32_t le32(const uint8_t *p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8u) | ((uint32_t)p[2] << 16u) | ((uint32_t)p[3] << 24u);
+}
+
+static inline uint16_t le16(const uint8_t *p) {
+	return (uint16_t)(p[0] | (p[1] << 8u));
+}
+
+/* Dual OPL2 captures are stored as two OPL2 register sets. Play them on one
+   OPL3 the same way Adlib::Module::DualWrite does, left chip on the left. */
+static void add_dual_opl2(OplCapture &cap,uint64_t frame,unsigned int chip,uint8_t reg,uint8_t val) {
+	if (reg == 0x05) return;
+	if (reg >= 0xE0) val &= 3;
+	if (reg >= 0xC0 && reg <= 0xC8) val = (uint8_t)((val & 0x0f) | (chip ? 0xA0 : 0x50));
+	cap.events.push_back({frame,(uint16_t)(reg + (chip ? 0x100u : 0u)),val});
+}
+
+static bool load_dro(const vector<uint8_t> &buf,OplCapture &cap) {
+	if (buf.size() < 26 || memcmp(&buf[0],"DBRAWOPL",8) != 0) return false;
+	if (le16(&buf[8]) != 2) {
+		fprintf(stderr,"Only version 2 DRO captures are supported\n");
+		return false;
+	}
+
+	const uint32_t commands = le32(&buf[12]);
+	const uint8_t hardware = buf[20];
+	const uint8_t delay256 = buf[23];
+	const uint8_t delayShift8 = buf[24];
+	const uint8_t tableSize = buf[25];
+
+	if (buf[21] != 0 || buf[22] != 0 || tableSize > 128 || buf.size() < 26u + tableSize) {
+		fprintf(stderr,"Unsupported DRO format or compression\n");
+		return false;
+	}
+
+	const uint8_t *table = &buf[26];
+	size_t pos = 26u + tableSize;
+	uint64_t frame = 0;
+	const bool dual = (hardware == 1);
+
+	cap.opl3 = (hardware != 0);
+	cap.tick_rate = 1000;
+	if (dual) {
+		/* Unlock the OPL3 register set so the second chip is heard */
+		cap.events.push_back({0,0x105,1});
+	}
+
+	for (uint32_t i=0;i < commands && (pos+2) <= buf.size();i++,pos += 2) {
+		const uint8_t raw = buf[pos];
+		const uint8_t val = buf[pos+1];
+
+		if (raw == delay256) {
+			frame += (uint64_t)val + 1u;
+		}
+		else if (raw == delayShift8) {
+			frame += ((uint64_t)val + 1u) << 8u;
+		}
+		else {
+			if ((raw & 0x7f) >= tableSize) continue;
+			const uint8_t reg = table[raw & 0x7f];
+			const unsigned int chip = (raw & 0x80) ? 1 : 0;
+
+			if (dual) add_dual_opl2(cap,frame,chip,reg,val);
+			else cap.events.push_back({frame,(uint16_t)(reg + (chip ? 0x100u : 0u)),val});
+		}
+	}
+
+	cap.length = frame;
+	return true;
+}
+
+/* Rdos RAW: delays are in ticks of the PIT clock divided by the clock value */
+static bool load_raw(const vector<uint8_t> &buf,OplCapture &cap) {
+	if (buf.size() < 10 || memcmp(&buf[0],"RAWADATA",8) != 0) return false;
+
+	const double pit = 1193180.0;
+	unsigned int clock = le16(&buf[8]);
+	double when = 0; /* in PIT ticks */
+	unsigned int chip = 0;
+	size_t pos = 10;
+
+	if (clock == 0) clock = 0xffff;
+
+	/* Use the PIT rate as the event clock so that clock changes mid stream
+	   can be expressed exactly. */
+	cap.tick_rate = pit;
+	cap.opl3 = false;
+
+	while ((pos+2) <= buf.size()) {
+		const uint8_t data = buf[pos];
+		const uint8_t ctrl = buf[pos+1];
+		pos += 2;
+
+		if (data == 0xff && ctrl == 0xff) break;
+
+		if (ctrl == 0x00) {
+			when += (double)(data ? data : 0x100) * clock;
+		}
+		else if (ctrl == 0x02) {
+			if (data == 0x00) {
+				if ((pos+2) > buf.size()) break;
+				clock = le16(&buf[pos]);
+				if (clock == 0) clock = 0xffff;
+				pos += 2;
+			}
+			else if (data == 0x01 || data == 0x02) {
+				chip = data - 1u;
+				if (chip) cap.opl3 = true;
+			}
+		}
+		else {
+			cap.events.push_back({(uint64_t)when,(uint16_t)(ctrl + (chip ? 0x100u : 0u)),data});
+		}
+	}
+
+	cap.length = (uint64_t)when;
+	return true;
+}
+
+/* Common interface over the cores, always producing 16-bit stereo */
+struct OplCore {
+	virtual ~OplCore() {}
+	virtual void WriteReg(uint16_t reg,uint8_t val) = 0;
+	virtual void Generate(int16_t *out,uint32_t frames) = 0;
+};
+
+struct DBOPLCore : public OplCore {
+	DBOPL::Handler handler;
+	vector<int32_t> tmp;
+
+	DBOPLCore(bool opl3,uint32_t rate) : handler(opl3) {
+		handler.Init(rate);
+	}
+	void WriteReg(uint16_t reg,uint8_t val) override {
+		handler.WriteReg(reg,val);
+	}
+	void Generate(int16_t *out,uint32_t frames) override {
+		while (frames > 0) {
+			const uint32_t todo = frames > 512 ? 512 : frames;
+
+			tmp.resize(todo * 2);
+			if (handler.chip.opl3Active) {
+				handler.chip.GenerateBlock3(todo,tmp.data());
+				for (uint32_t i=0;i < todo*2;i++) out[i] = clamp16(tmp[i]);
+			}
+			else {
+				handler.chip.GenerateBlock2(todo,tmp.data());
+				for (uint32_t i=0;i < todo;i++) out[i*2] = out[i*2+1] = clamp16(tmp[i]);
+			}
+
+			out += todo * 2;
+			frames -= todo;
+		}
+	}
+	static inline int16_t clamp16(int32_t s) {
+		if (s > 32767) return 32767;
+		if (s < -32768) return -32768;
+		return (int16_t)s;
+	}
+};
+
+struct NukedCore : public OplCore {
+	opl3_chip chip;
+
+	NukedCore(uint32_t rate) {
+		OPL3_Reset(&chip,rate);
+	}
+	void WriteReg(uint16_t reg,uint8_t val) override {
+		OPL3_WriteRegBuffered(&chip,reg,val);
+	}
+	void Generate(int16_t *out,uint32_t frames) override {
+		OPL3_GenerateStream(&chip,out,frames);
+	}
+};
+
+struct ESFMuCore : public OplCore {
+	esfm_chip chip = {};
+
+	ESFMuCore() {
+		ESFM_init(&chip);
+	}
+	void WriteReg(uint16_t reg,uint8_t val) override {
+		ESFM_write_reg_buffered_fast(&chip,reg,val);
+	}
+	void Generate(int16_t *out,uint32_t frames) override {
+		ESFM_generate_stream(&chip,out,frames);
+	}
+};
+
+static const char *core_names[] = { "dbopl", "nuked", "esfmu" };
+
+static OplCore *make_core(const string &name,bool opl3,uint32_t rate) {
+	if (name == "dbopl") return new DBOPLCore(opl3,rate);
+	if (name == "nuked") return new NukedCore(rate);
+	if (name == "esfmu") return new ESFMuCore();
+	return NULL;
+}
+
+/* ESFMu runs at the native chip rate only */
+static uint32_t core_rate(const string &name,uint32_t rate) {
+	return name == "esfmu" ? 49716u : rate;
+}
+
+/* Render the whole capture, handing each block to sink (may be NULL) */
+static uint64_t render(OplCore *core,const OplCapture &cap,uint32_t rate,FILE *sink) {
+	vector<int16_t> block;
+	const double scale = (double)rate / cap.tick_rate;
+	const uint64_t total = (uint64_t)(cap.length * scale);
+	uint64_t done = 0;
+	size_t ev = 0;
+
+	while (done < total || ev < cap.events.size()) {
+		while (ev < cap.events.size() && (uint64_t)(cap.events[ev].frame * scale) <= done) {
+			core->WriteReg(cap.events[ev].reg,cap.events[ev].val);
+			ev++;
+		}
+
+		uint64_t until = total;
+		if (ev < cap.events.size()) until = (uint64_t)(cap.events[ev].frame * scale);
+		if (until > done + 4096u) until = done + 4096u;
+		if (until <= done) {
+			if (ev < cap.events.size()) continue;
+			break;
+		}
+
+		const uint32_t todo = (uint32_t)(until - done);
+		block.resize(todo * 2);
+		core->Generate(block.data(),todo);
+		if (sink != NULL) fwrite(block.data(),sizeof(int16_t),todo * 2,sink);
+		done += todo;
+	}
+
+	return done;
+}
+
+static void put_le32(uint8_t *p,uint32_t v) {
+	p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8u); p[2] = (uint8_t)(v >> 16u); p[3] = (uint8_t)(v >> 24u);
+}
+
+static void put_le16(uint8_t *p,uint16_t v) {
+	p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8u);
+}
+
+static void write_wav_header(FILE *fp,uint32_t rate,uint64_t frames) {
+	uint8_t hdr[44];
+	const uint32_t data_len = (uint32_t)(frames * 4u);
+
+	memcpy(hdr+0,"RIFF",4);
+	put_le32(hdr+4,36u + data_len);
+	memcpy(hdr+8,"WAVEfmt ",8);
+	put_le32(hdr+16,16);
+	put_le16(hdr+20,1);		/* PCM */
+	put_le16(hdr+22,2);		/* stereo */
+	put_le32(hdr+24,rate);
+	put_le32(hdr+28,rate * 4u);
+	put_le16(hdr+32,4);
+	put_le16(hdr+34,16);
+	memcpy(hdr+36,"data",4);
+	put_le32(hdr+40,data_len);
+
+	fseek(fp,0,SEEK_SET);
+	fwrite(hdr,sizeof(hdr),1,fp);
+}
+
+static void bench_core(const string &name,const OplCapture &cap,uint32_t rate,unsigned int threads) {
+	vector<thread> workers;
+	vector<uint64_t> rendered(threads,0);
+	vector<double> elapsed(threads,0);
+
+	rate = core_rate(name,rate);
+	for (unsigned int t=0;t < threads;t++) {
+		workers.emplace_back([&,t]() {
+			OplCore *core = make_core(name,cap.opl3,rate);
+			const auto start = chrono::steady_clock::now();
+			rendered[t] = render(core,cap,rate,NULL);
+			elapsed[t] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+			delete core;
+		});
+	}
+	for (auto &w : workers) w.join();
+
+	double total_rate = 0,worst = 0;
+	for (unsigned int t=0;t < threads;t++) {
+		const double sps = elapsed[t] > 0 ? rendered[t] / elapsed[t] : 0;
+		total_rate += sps;
+		if (elapsed[t] > worst) worst = elapsed[t];
+	}
+
+	printf("%-6s %7u Hz  %10llu frames  %8.3f s  %12.0f samples/sec per core  %6.1fx realtime",
+		name.c_str(),rate,(unsigned long long)rendered[0],worst,total_rate / threads,
+		(total_rate / threads) / rate);
+	if (threads > 1) printf("  (%u threads, %.0f samples/sec total)",threads,total_rate);
+	printf("\n");
+}
+
+static void usage(const char *argv0) {
+	fprintf(stderr,"%s [options] <capture.dro|capture.raw>\n",argv0);
+	fprintf(stderr,"  -core <dbopl|nuked|esfmu|all>  OPL core to use (default dbopl)\n");
+	fprintf(stderr,"  -rate <hz>                     Output sample rate (default 49716)\n");
+	fprintf(stderr,"  -o <file.wav>                  Output file (default out.wav)\n");
+	fprintf(stderr,"  -bench                         Measure render speed, write nothing\n");
+	fprintf(stderr,"  -threads <n>                   Render n copies at once in -bench\n");
+}
+
+int main(int argc,char **argv) {
+	string core_name = "dbopl";
+	string out_path = "out.wav";
+	const char *in_path = NULL;
+	uint32_t rate = 49716;
+	unsigned int threads = 1;
+	bool bench = false;
+
+	for (int i=1;i < argc;i++) {
+		const char *a = argv[i];
+
+		if (!strcmp(a,"-core") && (i+1) < argc)
+			core_name = argv[++i];
+		else if (!strcmp(a,"-rate") && (i+1) < argc)
+			rate = (uint32_t)strtoul(argv[++i],NULL,0);
+		else if (!strcmp(a,"-o") && (i+1) < argc)
+			out_path = argv[++i];
+		else if (!strcmp(a,"-threads") && (i+1) < argc)
+			threads = (unsigned int)strtoul(argv[++i],NULL,0);
+		else if (!strcmp(a,"-bench"))
+			bench = true;
+		else if (a[0] == '-') {
+			usage(argv[0]);
+			return 1;
+		}
+		else
+			in_path = a;
+	}
+
+	if (in_path == NULL) {
+		usage(argv[0]);
+		return 1;
+	}
+	if (rate < 8000) rate = 8000;
+	if (threads < 1) threads = 1;
+
+	vector<uint8_t> buf;
+	if (!read_file(in_path,buf)) {
+		fprintf(stderr,"Unable to read %s\n",in_path);
+		return 1;
+	}
+
+	OplCapture cap;
+	if (!load_dro(buf,cap) && !load_raw(buf,cap)) {
+		fprintf(stderr,"%s is not a supported DRO or RAW capture\n",in_path);
+		return 1;
+	}
+
+	vector<string> cores;
+	if (core_name == "all") cores.assign(core_names,core_names+3);
+	else cores.push_back(core_name);
+
+	for (const auto &n : cores) {
+		OplCore *core = make_core(n,false,rate);
+		if (core == NULL) {
+			fprintf(stderr,"Unknown core %s\n",n.c_str());
+			return 1;
+		}
+		delete core;
+	}
+
+	printf("%s: %s, %zu register writes, %.1f seconds\n",in_path,cap.opl3 ? "OPL3" : "OPL2",
+		cap.events.size(),cap.length / cap.tick_rate);
+
+	if (bench) {
+		for (const auto &n : cores) bench_core(n,cap,rate,threads);
+		return 0;
+	}
+
+	for (const auto &n : cores) {
+		string path = out_path;
+
+		/* One file per core when rendering all of them */
+		if (cores.size() > 1) {
+			const size_t dot = path.rfind('.');
+			path = (dot != string::npos ? path.substr(0,dot) : path) + "-" + n + ".wav";
+		}
+
+		FILE *fp = fopen(path.c_str(),"wb");
+		if (fp == NULL) {
+			fprintf(stderr,"Unable to write %s\n",path.c_str());
+			return 1;
+		}
+
+		const uint32_t r = core_rate(n,rate);
+		OplCore *core = make_core(n,cap.opl3,r);
+		write_wav_header(fp,r,0);
+		const uint64_t frames = render(core,cap,r,fp);
+		write_wav_header(fp,r,frames);
+		fclose(fp);
+		delete core;
+
+		printf("%s: wrote %llu frames at %u Hz to %s\n",n.c_str(),(unsigned long long)frames,r,path.c_str());
+	}
+
+	return 0;
+}
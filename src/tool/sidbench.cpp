@@ -0,0 +1,239 @@
+/* reSID quality mode benchmark.
+
+   Drives the reSID core behind the Innovation SSI-2001 emulation with a
+   synthetic 50 Hz "player" (three voices cycling through all waveforms with
+   pulse width and filter sweeps) and reports how fast each [innova] quality
+   setting renders compared to real time. Audio is pulled the same way the
+   mixer does it, in blocks of -chunk samples (default 1 ms worth), so the
+   effect of the mixer block size on the batched clocking can be compared as
+   well. With -o the first selected quality is also written to a 16-bit mono
+   WAV file to listen to.
+
+   Build with "make src/tool/sidbench" after the main build, the core is
+   linked straight from src/hardware/reSID/libresid.a. */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "reSID/sid.h"
+
+using namespace std;
+
+#define SID_FREQ 894886	/* same clock as src/hardware/innova.cpp */
+
+static const char *quality_names[4] = {
+	"0 (fast)",
+	"1 (interpolate)",
+	"2 (resample fast)",
+	"3 (resample interpolate)"
+};
+
+static const sampling_method quality_methods[4] = {
+	SAMPLE_FAST, SAMPLE_INTERPOLATE, SAMPLE_RESAMPLE_FAST, SAMPLE_RESAMPLE_INTERPOLATE
+};
+
+/* One 50 Hz player tick worth of register writes */
+static void player_tick(SID2 &sid,unsigned int tick) {
+	static const unsigned int notes[8] = { 0x1167, 0x14EF, 0x1753, 0x1A1E, 0x22CE, 0x29DF, 0x2EA6, 0x343C };
+	static const unsigned int waves[4] = { 0x10, 0x20, 0x40, 0x80 };
+
+	if (tick == 0) {
+		for (unsigned int v=0;v < 3;v++) {
+			sid.write(v*7+5,0x09);		/* attack 0, decay 9 */
+			sid.write(v*7+6,0x8A);		/* sustain 8, release 10 */
+		}
+		sid.write(0x17,0xF7);			/* resonance 15, filter all voices */
+	}
+
+	for (unsigned int v=0;v < 3;v++) {
+		const unsigned int step = tick + v * 5;
+		const unsigned int freq = notes[(step / 3 + v * 2) & 7] >> (2 - v);
+		const unsigned int pw = (step * 37) & 0xFFF;
+		const unsigned int wave = waves[(tick / 64 + v) & 3];
+		const bool gate = (step % 12) < 9;
+
+		sid.write(v*7+0,freq & 0xFF);
+		sid.write(v*7+1,freq >> 8);
+		sid.write(v*7+2,pw & 0xFF);
+		sid.write(v*7+3,pw >> 8);
+		sid.write(v*7+4,wave | (gate ? 1 : 0));
+	}
+
+	const unsigned int cutoff = 0x100 + ((tick * 13) % 0x600);
+	sid.write(0x15,cutoff & 7);
+	sid.write(0x16,cutoff >> 3);
+	sid.write(0x18,((tick / 256) & 1) ? 0x2F : 0x1F);	/* alternate lowpass and bandpass, volume 15 */
+}
+
+/* Render seconds of the player tune, pulling chunk samples at a time like INNOVA_CallBack */
+static double render(unsigned int quality,chip_model model,unsigned int rate,unsigned int seconds,unsigned int chunk,vector<int16_t> *out) {
+	SID2 sid;
+	vector<int16_t> buf(chunk);
+	const uint64_t total = (uint64_t)rate * seconds;
+	const uint64_t per_tick = rate / 50;
+	uint64_t done = 0;
+	unsigned int tick = 0;
+
+	sid.set_chip_model(model);
+	sid.enable_filter(true);
+	sid.enable_external_filter(true);
+	if (!sid.set_sampling_parameters(SID_FREQ,quality_methods[quality],(double)rate,-1,0.97)) {
+		fprintf(stderr,"Quality %s cannot be used at %u Hz\n",quality_names[quality],rate);
+		return -1;
+	}
+
+	if (out != NULL) out->clear();
+
+	const auto start = chrono::steady_clock::now();
+	while (done < total) {
+		if (done >= tick * per_tick)
+			player_tick(sid,tick++);
+
+		unsigned int len = chunk;
+		if (len > total - done) len = (unsigned int)(total - done);
+
+		/* same math as INNOVA_CallBack */
+		cycle_count delta_t = (cycle_count)((uint64_t)SID_FREQ * (len + 1) / rate) + 1;
+		unsigned int bufindex = 0;
+		while (delta_t && bufindex != len)
+			bufindex += (unsigned int)sid.clock(delta_t,&buf[bufindex],(int)(len - bufindex));
+		if (bufindex < len) memset(&buf[bufindex],0,(len - bufindex) * sizeof(int16_t));
+
+		if (out != NULL) out->insert(out->end(),buf.begin(),buf.begin() + len);
+		done += len;
+	}
+	const auto end = chrono::steady_clock::now();
+
+	return chrono::duration<double>(end - start).count();
+}
+
+static bool write_wav(const char *path,const vector<int16_t> &pcm,unsigned int rate) {
+	FILE *fp = fopen(path,"wb");
+	if (fp == NULL) return false;
+
+	const uint32_t data_len = (uint32_t)(pcm.size() * 2);
+	unsigned char hdr[44];
+	memcpy(hdr,"RIFF",4);
+	const uint32_t riff_len = 36 + data_len;
+	const uint32_t byte_rate = rate * 2;
+	for (unsigned int i=0;i < 4;i++) hdr[4+i] = (unsigned char)(riff_len >> (i*8));
+	memcpy(hdr+8,"WAVEfmt ",8);
+	hdr[16] = 16; hdr[17] = hdr[18] = hdr[19] = 0;
+	hdr[20] = 1; hdr[21] = 0;		/* PCM */
+	hdr[22] = 1; hdr[23] = 0;		/* mono */
+	for (unsigned int i=0;i < 4;i++) hdr[24+i] = (unsigned char)(rate >> (i*8));
+	for (unsigned int i=0;i < 4;i++) hdr[28+i] = (unsigned char)(byte_rate >> (i*8));
+	hdr[32] = 2; hdr[33] = 0;		/* block align */
+	hdr[34] = 16; hdr[35] = 0;		/* bits per sample */
+	memcpy(hdr+36,"data",4);
+	for (unsigned int i=0;i < 4;i++) hdr[40+i] = (unsigned char)(data_len >> (i*8));
+	fwrite(hdr,sizeof(hdr),1,fp);
+
+	for (size_t i=0;i < pcm.size();i++) {
+		const uint16_t s = (uint16_t)pcm[i];
+		const unsigned char b[2] = { (unsigned char)(s & 0xFF), (unsigned char)(s >> 8) };
+		fwrite(b,2,1,fp);
+	}
+
+	fclose(fp);
+	return true;
+}
+
+static void usage(void) {
+	fprintf(stderr,"sidbench [options]\n");
+	fprintf(stderr,"  -quality <0-3|all>  reSID quality to benchmark, as [innova] quality (default all)\n");
+	fprintf(stderr,"  -rate <hz>          output sample rate (default 22050)\n");
+	fprintf(stderr,"  -seconds <n>        length of the test tune (default 60)\n");
+	fprintf(stderr,"  -chunk <samples>    samples per clock() batch (default 1 ms worth)\n");
+	fprintf(stderr,"  -model <6581|8580>  SID chip model (default 6581)\n");
+	fprintf(stderr,"  -o <file.wav>       also write the first quality rendered to a WAV file\n");
+}
+
+int main(int argc,char **argv) {
+	int quality = -1;
+	unsigned int rate = 22050;
+	unsigned int seconds = 60;
+	unsigned int chunk = 0;
+	chip_model model = MOS6581;
+	const char *out_path = NULL;
+
+	for (int i=1;i < argc;i++) {
+		const char *a = argv[i];
+		const char *v = (i+1 < argc) ? argv[i+1] : NULL;
+
+		if (!strcmp(a,"-h") || !strcmp(a,"--help")) {
+			usage();
+			return 0;
+		}
+		else if (v == NULL) {
+			usage();
+			return 1;
+		}
+		else if (!strcmp(a,"-quality")) {
+			quality = strcmp(v,"all") ? atoi(v) : -1;
+			if (quality > 3) { usage(); return 1; }
+			i++;
+		}
+		else if (!strcmp(a,"-rate")) {
+			rate = (unsigned int)atoi(v);
+			i++;
+		}
+		else if (!strcmp(a,"-seconds")) {
+			seconds = (unsigned int)atoi(v);
+			i++;
+		}
+		else if (!strcmp(a,"-chunk")) {
+			chunk = (unsigned int)atoi(v);
+			i++;
+		}
+		else if (!strcmp(a,"-model")) {
+			model = atoi(v) == 8580 ? MOS8580 : MOS6581;
+			i++;
+		}
+		else if (!strcmp(a,"-o")) {
+			out_path = v;
+			i++;
+		}
+		else {
+			usage();
+			return 1;
+		}
+	}
+
+	if (rate < 4000 || rate > 96000 || seconds == 0) {
+		usage();
+		return 1;
+	}
+	if (chunk == 0) chunk = (rate + 999) / 1000;
+
+	printf("reSID %s, %s, %u Hz, %u s tune, %u samples per batch\n",
+		resid_version_string,model == MOS8580 ? "8580" : "6581",rate,seconds,chunk);
+
+	vector<int16_t> pcm;
+	bool wrote = false;
+	for (unsigned int q=0;q < 4;q++) {
+		if (quality >= 0 && (unsigned int)quality != q) continue;
+
+		const bool capture = out_path != NULL && !wrote;
+		const double t = render(q,model,rate,seconds,chunk,capture ? &pcm : NULL);
+		if (t < 0) continue;
+
+		printf("  quality %-26s %8.3f s  %8.1fx real time\n",quality_names[q],t,t > 0 ? seconds / t : 0.0);
+
+		if (capture) {
+			if (!write_wav(out_path,pcm,rate)) {
+				fprintf(stderr,"Cannot write %s\n",out_path);
+				return 1;
+			}
+			wrote = true;
+		}
+	}
+
+	return 0;
+}
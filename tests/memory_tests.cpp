@@ -0,0 +1,294 @@
+/*
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "mem.h"
+#include "paging.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dosbox_test_fixture.h"
+
+namespace {
+
+class MEM_AllocatorTest : public DOSBoxTestFixture {};
+
+/* The EMS/XMS page allocator as it was before it kept free extents: every query
+ * walks the handle array. It works on a copy of that array and serves as the
+ * reference the extent based allocator in memory.cpp has to agree with. */
+class LinearAllocator {
+public:
+	std::vector<MemHandle> mhandles;
+	uint32_t reported_pages;
+
+	LinearAllocator() : reported_pages((uint32_t)MEM_TotalPages())
+	{
+		for (uint32_t i = 0; i < reported_pages; i++)
+			mhandles.push_back(MEM_NextHandle((MemHandle)i));
+	}
+
+	Bitu FreeLargest()
+	{
+		Bitu size = 0, largest = 0;
+		for (uint32_t index = XMS_START; index < reported_pages; index++) {
+			if (!mhandles[index]) {
+				size++;
+			} else {
+				if (size > largest) largest = size;
+				size = 0;
+			}
+		}
+		if (size > largest) largest = size;
+		return largest;
+	}
+
+	Bitu FreeTotal()
+	{
+		Bitu free = 0;
+		for (uint32_t index = XMS_START; index < reported_pages; index++)
+			if (!mhandles[index]) free++;
+		return free;
+	}
+
+	Bitu AllocatedPages(MemHandle handle)
+	{
+		Bitu pages = 0;
+		while (handle > 0) {
+			pages++;
+			handle = mhandles[handle];
+		}
+		return pages;
+	}
+
+	uint32_t BestMatch(Bitu size, bool a20)
+	{
+		uint32_t index = XMS_START, first = 0;
+		uint32_t best = 0xfffffff, best_first = 0;
+
+		if (a20 && size > 0x100) return 0;
+		while (index < reported_pages) {
+			if (!first) {
+				if (a20 && (index & 0x100)) {
+					index = (index | 0xFF) + 1;
+					continue;
+				}
+				if (!mhandles[index]) first = index;
+			} else if (mhandles[index] || (a20 && (index & 0x100))) {
+				uint32_t pages = index - first;
+				if (pages == size) {
+					return first;
+				} else if (pages > size) {
+					if (pages < best) {
+						best = pages;
+						best_first = first;
+					}
+				}
+				first = 0;
+			}
+			index++;
+		}
+		if (first && (index - first >= size) && (index - first < best))
+			return first;
+		return best_first;
+	}
+
+	MemHandle AllocatePages(Bitu pages, bool sequence, bool a20 = false)
+	{
+		MemHandle ret = 0;
+		if (!pages) return 0;
+		if (sequence) {
+			uint32_t index = BestMatch(pages, a20);
+			if (!index) return 0;
+			MemHandle *next = &ret;
+			while (pages) {
+				*next = (MemHandle)index;
+				next = &mhandles[index];
+				index++; pages--;
+			}
+			*next = -1;
+		} else {
+			if (FreeTotal() < pages) return 0;
+			MemHandle *next = &ret;
+			while (pages) {
+				uint32_t index = BestMatch(1, a20);
+				if (!index) return 0;
+				/* the old loop had no end check and ran past reported_pages on a free last block */
+				while (pages && index < reported_pages && !mhandles[index]) {
+					*next = (MemHandle)index;
+					next = &mhandles[index];
+					index++; pages--;
+				}
+				*next = -1;
+			}
+		}
+		return ret;
+	}
+
+	void ReleasePages(MemHandle handle)
+	{
+		while (handle > 0) {
+			MemHandle next = mhandles[handle];
+			mhandles[handle] = 0;
+			handle = next;
+		}
+	}
+
+	bool ReAllocatePages(MemHandle &handle, Bitu pages, bool sequence)
+	{
+		if (handle <= 0) {
+			if (!pages) return true;
+			handle = AllocatePages(pages, sequence);
+			return (handle > 0);
+		}
+		if (!pages) {
+			ReleasePages(handle);
+			handle = -1;
+			return true;
+		}
+		MemHandle index = handle, last = 0;
+		Bitu old_pages = 0;
+		while (index > 0) {
+			old_pages++;
+			last = index;
+			index = mhandles[index];
+		}
+		if (old_pages == pages) return true;
+		if (old_pages > pages) {
+			pages--; index = handle; old_pages--;
+			while (pages) {
+				index = mhandles[index];
+				pages--; old_pages--;
+			}
+			MemHandle next = mhandles[index];
+			mhandles[index] = -1;
+			index = next;
+			while (old_pages) {
+				next = mhandles[index];
+				mhandles[index] = 0;
+				index = next;
+				old_pages--;
+			}
+			return true;
+		}
+		Bitu need = pages - old_pages;
+		if (sequence) {
+			Bitu free = 0;
+			index = last + 1;
+			while (index < (MemHandle)reported_pages && !mhandles[index]) {
+				index++; free++;
+			}
+			if (free >= need) {
+				index = last;
+				while (need) {
+					mhandles[index] = index + 1;
+					need--; index++;
+				}
+				mhandles[index] = -1;
+				return true;
+			}
+			MemHandle newhandle = AllocatePages(pages, true);
+			if (!newhandle) return false;
+			ReleasePages(handle);
+			handle = newhandle;
+			return true;
+		}
+		MemHandle rem = AllocatePages(need, false);
+		if (!rem) return false;
+		mhandles[last] = rem;
+		return true;
+	}
+
+	bool SameAsEmulator()
+	{
+		for (uint32_t i = XMS_START; i < reported_pages; i++)
+			if (mhandles[i] != MEM_NextHandle((MemHandle)i)) return false;
+		return true;
+	}
+};
+
+TEST_F(MEM_AllocatorTest, ExtentsMatchLinearScan)
+{
+	LinearAllocator ref;
+	if (ref.reported_pages <= XMS_START + 16) GTEST_SKIP();
+
+	const Bitu free_before = MEM_FreeTotal();
+	ASSERT_EQ(ref.FreeTotal(), free_before);
+	ASSERT_EQ(ref.FreeLargest(), MEM_FreeLargest());
+
+	std::mt19937 rng(0x71);
+	const Bitu max_pages = (ref.reported_pages - XMS_START) / 16;
+	std::vector<MemHandle> handles, ref_handles;
+
+	/* the reference walks every page on each call, fewer operations with a large memsize */
+	const Bitu ops = std::min<Bitu>(200000, ((Bitu)1 << 30) / ref.reported_pages);
+
+	for (Bitu op = 0; op < ops; op++) {
+		const unsigned int what = rng() % 8;
+		const bool sequence = (rng() & 1) != 0;
+		const Bitu pages = 1 + rng() % max_pages;
+
+		if (handles.empty() || what < 3) {
+			/* the A20 friendly allocator gives up on a non-sequential request it cannot place */
+			const bool a20 = what == 0 && sequence;
+			const Bitu a20_pages = 1 + pages % 0x100;
+			const MemHandle got = a20 ? MEM_AllocatePages_A20_friendly(a20_pages, sequence)
+			                          : MEM_AllocatePages(pages, sequence);
+			const MemHandle want = ref.AllocatePages(a20 ? a20_pages : pages, sequence, a20);
+			ASSERT_EQ(want, got) << "allocate, op " << op;
+			if (got > 0) {
+				handles.push_back(got);
+				ref_handles.push_back(want);
+			}
+		} else if (what < 5) {
+			const size_t i = rng() % handles.size();
+			MEM_ReleasePages(handles[i]);
+			ref.ReleasePages(ref_handles[i]);
+			handles.erase(handles.begin() + (long)i);
+			ref_handles.erase(ref_handles.begin() + (long)i);
+		} else {
+			const size_t i = rng() % handles.size();
+			const Bitu new_pages = (what == 7) ? ref.AllocatedPages(ref_handles[i]) / 2 : pages;
+			const bool got = MEM_ReAllocatePages(handles[i], new_pages, sequence);
+			const bool want = ref.ReAllocatePages(ref_handles[i], new_pages, sequence);
+			ASSERT_EQ(want, got) << "reallocate, op " << op;
+			ASSERT_EQ(ref_handles[i], handles[i]) << "reallocate, op " << op;
+			if (handles[i] <= 0) {
+				handles.erase(handles.begin() + (long)i);
+				ref_handles.erase(ref_handles.begin() + (long)i);
+			}
+		}
+
+		ASSERT_EQ(ref.FreeTotal(), MEM_FreeTotal()) << "op " << op;
+		ASSERT_EQ(ref.FreeLargest(), MEM_FreeLargest()) << "op " << op;
+		if ((op % 64) == 0) {
+			ASSERT_TRUE(ref.SameAsEmulator()) << "op " << op;
+		}
+	}
+	ASSERT_TRUE(ref.SameAsEmulator());
+
+	for (size_t i = 0; i < handles.size(); i++) {
+		EXPECT_EQ(ref.AllocatedPages(ref_handles[i]), MEM_AllocatedPages(handles[i]));
+		MEM_ReleasePages(handles[i]);
+	}
+	EXPECT_EQ(free_before, MEM_FreeTotal());
+}
+
+} // namespace
@@ -0,0 +1,155 @@
+/*
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "shell.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cross.h"
+#include "dos_inc.h"
+#include "timer.h"
+#include "../src/dos/drives.h"
+
+#include "dosbox_test_fixture.h"
+
+namespace {
+
+/* Batch files are run from a local directory mounted as Y: for the duration of each test */
+class DOS_Shell_BatchTest : public DOSBoxTestFixture {
+public:
+	void SetUp() override
+	{
+#if defined(WIN32)
+		const char *tmp = getenv("TEMP");
+		if (tmp == NULL || !*tmp) tmp = ".";
+#else
+		const char *tmp = getenv("TMPDIR");
+		if (tmp == NULL || !*tmp) tmp = "/tmp";
+#endif
+		dir = std::string(tmp) + CROSS_FILESPLIT + "dosbox-x-batch-test" + CROSS_FILESPLIT;
+		Cross::CreateDir(dir);
+
+		saved_drive = Drives[drive];
+		std::vector<std::string> options;
+		Drives[drive] = new localDrive(dir.c_str(), 512, 32, 32765, 16000, 0xF8, options);
+	}
+
+	void TearDown() override
+	{
+		DriveManager::UnmountDrive(drive);
+		Drives[drive] = saved_drive;
+		remove((dir + "T.BAT").c_str());
+	}
+
+	void WriteHost(const std::string &contents)
+	{
+		FILE *f = fopen((dir + "T.BAT").c_str(), "wb");
+		ASSERT_NE(f, nullptr);
+		fwrite(contents.data(), 1, contents.size(), f);
+		fclose(f);
+	}
+
+	void WriteGuest(const std::string &contents)
+	{
+		uint16_t handle, n = (uint16_t)contents.size();
+		ASSERT_TRUE(DOS_CreateFile("Y:\\T.BAT", DOS_ATTR_ARCHIVE, &handle));
+		EXPECT_TRUE(DOS_WriteFile(handle, (uint8_t *)contents.data(), &n));
+		DOS_CloseFile(handle);
+	}
+
+	std::string dir;
+	DOS_Drive *saved_drive = nullptr;
+	const int drive = 'Y' - 'A';
+};
+
+class TestBatchFile : public BatchFile {
+public:
+	TestBatchFile(DOS_Shell *host, const char *name) : BatchFile(host, name, name, "") {}
+	/* skip the once a second throttle on looking at the host file */
+	void ExpireHostCheck() { host_checked = GetTicks() - 1000u; }
+};
+
+TEST_F(DOS_Shell_BatchTest, Reload_After_Guest_Rewrite)
+{
+	DOS_Shell shell;
+	char line[CMD_MAXLINE];
+	WriteHost("echo one\r\necho two\r\necho three\r\n");
+
+	TestBatchFile *bf = new TestBatchFile(&shell, "Y:\\T.BAT");
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo one");
+
+	// Same length, execution goes on at the same byte offset
+	const uint32_t generation = dos_file_generation;
+	WriteGuest("echo one\r\necho TWO\r\necho THREE\r\n");
+	EXPECT_NE(generation, dos_file_generation);
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo TWO");
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo THREE");
+	EXPECT_FALSE(bf->ReadLine(line)); // end of file, deletes the batch file object
+}
+
+TEST_F(DOS_Shell_BatchTest, Reload_After_Host_Rewrite)
+{
+	DOS_Shell shell;
+	char line[CMD_MAXLINE];
+	WriteHost("echo one\r\necho two\r\n");
+
+	TestBatchFile *bf = new TestBatchFile(&shell, "Y:\\T.BAT");
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo one");
+
+	// Edited outside the emulator: no guest write, only size and mtime tell
+	const uint32_t generation = dos_file_generation;
+	WriteHost("echo one\r\necho edited on the host\r\necho last\r\n");
+	EXPECT_EQ(generation, dos_file_generation);
+	bf->ExpireHostCheck();
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo edited on the host");
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo last");
+	EXPECT_FALSE(bf->ReadLine(line));
+}
+
+TEST_F(DOS_Shell_BatchTest, Goto_Label_Case_Insensitive)
+{
+	DOS_Shell shell;
+	char line[CMD_MAXLINE];
+	WriteHost("goto Target\r\necho skipped\r\n:tARGET\r\necho reached\r\n:target\r\necho second label\r\n");
+
+	TestBatchFile *bf = new TestBatchFile(&shell, "Y:\\T.BAT");
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "goto Target");
+	ASSERT_TRUE(bf->Goto("Target"));
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo reached"); // the first label with the name wins
+
+	ASSERT_TRUE(bf->Goto("TARGET"));
+	ASSERT_TRUE(bf->ReadLine(line));
+	EXPECT_STREQ(line, "echo reached");
+
+	EXPECT_FALSE(bf->Goto("missing")); // not found, deletes the batch file object
+}
+
+} // namespace
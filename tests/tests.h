@@ -23,6 +23,8 @@
 
 #include "dos_files_tests.cpp"
 #include "drives_tests.cpp"
+#include "memory_tests.cpp"
+#include "shell_batch_tests.cpp"
 #include "shell_cmds_tests.cpp"
 #include "shell_redirection_tests.cpp"
 